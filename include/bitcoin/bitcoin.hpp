@@ -20,23 +20,54 @@
 #include <bitcoin/bitcoin/define.hpp>
 #include <bitcoin/bitcoin/error.hpp>
 #include <bitcoin/bitcoin/handlers.hpp>
+#include <bitcoin/bitcoin/network_profiles.hpp>
 #include <bitcoin/bitcoin/settings.hpp>
 #include <bitcoin/bitcoin/version.hpp>
 #include <bitcoin/bitcoin/chain/block.hpp>
+#include <bitcoin/bitcoin/chain/block_archive.hpp>
+#include <bitcoin/bitcoin/chain/block_assembler.hpp>
+#include <bitcoin/bitcoin/chain/block_file.hpp>
+#include <bitcoin/bitcoin/chain/block_importer.hpp>
+#include <bitcoin/bitcoin/chain/block_pipeline.hpp>
+#include <bitcoin/bitcoin/chain/block_validation_view.hpp>
+#include <bitcoin/bitcoin/chain/block_view.hpp>
 #include <bitcoin/bitcoin/chain/chain_state.hpp>
 #include <bitcoin/bitcoin/chain/compact.hpp>
+#include <bitcoin/bitcoin/chain/compact_filter.hpp>
 #include <bitcoin/bitcoin/chain/header.hpp>
+#include <bitcoin/bitcoin/chain/header_file.hpp>
+#include <bitcoin/bitcoin/chain/header_hasher.hpp>
+#include <bitcoin/bitcoin/chain/header_index.hpp>
 #include <bitcoin/bitcoin/chain/input.hpp>
 #include <bitcoin/bitcoin/chain/input_point.hpp>
+#include <bitcoin/bitcoin/chain/merkle_tree.hpp>
 #include <bitcoin/bitcoin/chain/output.hpp>
 #include <bitcoin/bitcoin/chain/output_point.hpp>
 #include <bitcoin/bitcoin/chain/payment_record.hpp>
+#include <bitcoin/bitcoin/chain/payment_record_columns.hpp>
 #include <bitcoin/bitcoin/chain/point.hpp>
+#include <bitcoin/bitcoin/chain/point_link.hpp>
 #include <bitcoin/bitcoin/chain/point_value.hpp>
 #include <bitcoin/bitcoin/chain/points_value.hpp>
+#include <bitcoin/bitcoin/chain/prevout_source.hpp>
+#include <bitcoin/bitcoin/chain/redeem_script_cache.hpp>
 #include <bitcoin/bitcoin/chain/script.hpp>
+#include <bitcoin/bitcoin/chain/script_cache.hpp>
+#include <bitcoin/bitcoin/chain/script_dictionary.hpp>
 #include <bitcoin/bitcoin/chain/stealth_record.hpp>
+#include <bitcoin/bitcoin/chain/stealth_record_columns.hpp>
 #include <bitcoin/bitcoin/chain/transaction.hpp>
+#include <bitcoin/bitcoin/chain/transaction_index.hpp>
+#include <bitcoin/bitcoin/chain/transaction_package.hpp>
+#include <bitcoin/bitcoin/chain/transaction_pool_index.hpp>
+#include <bitcoin/bitcoin/chain/transaction_recycler.hpp>
+#include <bitcoin/bitcoin/chain/transaction_signer.hpp>
+#include <bitcoin/bitcoin/chain/transaction_view.hpp>
+#include <bitcoin/bitcoin/chain/utxo_set.hpp>
+#include <bitcoin/bitcoin/chain/utxo_snapshot.hpp>
+#include <bitcoin/bitcoin/chain/validation_capture.hpp>
+#include <bitcoin/bitcoin/chain/validation_timing.hpp>
+#include <bitcoin/bitcoin/chain/view_list.hpp>
 #include <bitcoin/bitcoin/chain/witness.hpp>
 #include <bitcoin/bitcoin/config/authority.hpp>
 #include <bitcoin/bitcoin/config/base16.hpp>
@@ -45,6 +76,7 @@
 #include <bitcoin/bitcoin/config/base64.hpp>
 #include <bitcoin/bitcoin/config/block.hpp>
 #include <bitcoin/bitcoin/config/checkpoint.hpp>
+#include <bitcoin/bitcoin/config/checkpoint_index.hpp>
 #include <bitcoin/bitcoin/config/directory.hpp>
 #include <bitcoin/bitcoin/config/endpoint.hpp>
 #include <bitcoin/bitcoin/config/hash160.hpp>
@@ -66,15 +98,18 @@
 #include <bitcoin/bitcoin/formats/base_58.hpp>
 #include <bitcoin/bitcoin/formats/base_64.hpp>
 #include <bitcoin/bitcoin/formats/base_85.hpp>
+#include <bitcoin/bitcoin/log/async_file_sink.hpp>
 #include <bitcoin/bitcoin/log/attributes.hpp>
 #include <bitcoin/bitcoin/log/file_char_traits.hpp>
 #include <bitcoin/bitcoin/log/file_collector.hpp>
 #include <bitcoin/bitcoin/log/file_collector_repository.hpp>
 #include <bitcoin/bitcoin/log/file_counter_formatter.hpp>
+#include <bitcoin/bitcoin/log/metrics.hpp>
 #include <bitcoin/bitcoin/log/rotable_file.hpp>
 #include <bitcoin/bitcoin/log/severity.hpp>
 #include <bitcoin/bitcoin/log/sink.hpp>
 #include <bitcoin/bitcoin/log/source.hpp>
+#include <bitcoin/bitcoin/log/statsd_client.hpp>
 #include <bitcoin/bitcoin/log/statsd_sink.hpp>
 #include <bitcoin/bitcoin/log/statsd_source.hpp>
 #include <bitcoin/bitcoin/log/udp_client_sink.hpp>
@@ -83,6 +118,7 @@
 #include <bitcoin/bitcoin/log/features/metric.hpp>
 #include <bitcoin/bitcoin/log/features/rate.hpp>
 #include <bitcoin/bitcoin/log/features/timer.hpp>
+#include <bitcoin/bitcoin/machine/instruction.hpp>
 #include <bitcoin/bitcoin/machine/interpreter.hpp>
 #include <bitcoin/bitcoin/machine/number.hpp>
 #include <bitcoin/bitcoin/machine/opcode.hpp>
@@ -90,28 +126,49 @@
 #include <bitcoin/bitcoin/machine/program.hpp>
 #include <bitcoin/bitcoin/machine/rule_fork.hpp>
 #include <bitcoin/bitcoin/machine/script_pattern.hpp>
+#include <bitcoin/bitcoin/machine/script_profile.hpp>
 #include <bitcoin/bitcoin/machine/script_version.hpp>
 #include <bitcoin/bitcoin/machine/sighash_algorithm.hpp>
+#include <bitcoin/bitcoin/machine/stack_element.hpp>
+#include <bitcoin/bitcoin/machine/verification_context.hpp>
+#include <bitcoin/bitcoin/math/cache_snapshot.hpp>
 #include <bitcoin/bitcoin/math/checksum.hpp>
 #include <bitcoin/bitcoin/math/crypto.hpp>
 #include <bitcoin/bitcoin/math/ec_point.hpp>
+#include <bitcoin/bitcoin/math/ec_point_table.hpp>
 #include <bitcoin/bitcoin/math/ec_scalar.hpp>
+#include <bitcoin/bitcoin/math/ec_workspace.hpp>
 #include <bitcoin/bitcoin/math/elliptic_curve.hpp>
 #include <bitcoin/bitcoin/math/hash.hpp>
 #include <bitcoin/bitcoin/math/limits.hpp>
+#include <bitcoin/bitcoin/math/murmur3.hpp>
+#include <bitcoin/bitcoin/math/pin_sketch.hpp>
+#include <bitcoin/bitcoin/math/muhash.hpp>
+#include <bitcoin/bitcoin/math/public_key_cache.hpp>
 #include <bitcoin/bitcoin/math/ring_signature.hpp>
+#include <bitcoin/bitcoin/math/salted_hash.hpp>
+#include <bitcoin/bitcoin/math/signature_backend.hpp>
+#include <bitcoin/bitcoin/math/signature_batch.hpp>
+#include <bitcoin/bitcoin/math/signature_cache.hpp>
+#include <bitcoin/bitcoin/math/siphash.hpp>
 #include <bitcoin/bitcoin/math/stealth.hpp>
 #include <bitcoin/bitcoin/math/uint256.hpp>
 #include <bitcoin/bitcoin/message/address.hpp>
+#include <bitcoin/bitcoin/message/address_book.hpp>
 #include <bitcoin/bitcoin/message/alert.hpp>
 #include <bitcoin/bitcoin/message/alert_payload.hpp>
 #include <bitcoin/bitcoin/message/block.hpp>
 #include <bitcoin/bitcoin/message/block_transactions.hpp>
+#include <bitcoin/bitcoin/message/bloom_filter.hpp>
 #include <bitcoin/bitcoin/message/compact_block.hpp>
+#include <bitcoin/bitcoin/message/compact_block_builder.hpp>
+#include <bitcoin/bitcoin/message/compact_reconstructor.hpp>
+#include <bitcoin/bitcoin/message/encoded.hpp>
 #include <bitcoin/bitcoin/message/fee_filter.hpp>
 #include <bitcoin/bitcoin/message/filter_add.hpp>
 #include <bitcoin/bitcoin/message/filter_clear.hpp>
 #include <bitcoin/bitcoin/message/filter_load.hpp>
+#include <bitcoin/bitcoin/message/framer.hpp>
 #include <bitcoin/bitcoin/message/get_address.hpp>
 #include <bitcoin/bitcoin/message/get_block_transactions.hpp>
 #include <bitcoin/bitcoin/message/get_blocks.hpp>
@@ -130,9 +187,12 @@
 #include <bitcoin/bitcoin/message/ping.hpp>
 #include <bitcoin/bitcoin/message/pong.hpp>
 #include <bitcoin/bitcoin/message/prefilled_transaction.hpp>
+#include <bitcoin/bitcoin/message/raw_message.hpp>
+#include <bitcoin/bitcoin/message/reconciliation_set.hpp>
 #include <bitcoin/bitcoin/message/reject.hpp>
 #include <bitcoin/bitcoin/message/send_compact.hpp>
 #include <bitcoin/bitcoin/message/send_headers.hpp>
+#include <bitcoin/bitcoin/message/statistics.hpp>
 #include <bitcoin/bitcoin/message/transaction.hpp>
 #include <bitcoin/bitcoin/message/verack.hpp>
 #include <bitcoin/bitcoin/message/version.hpp>
@@ -147,13 +207,21 @@
 #include <bitcoin/bitcoin/utility/array_slice.hpp>
 #include <bitcoin/bitcoin/utility/asio.hpp>
 #include <bitcoin/bitcoin/utility/assert.hpp>
+#include <bitcoin/bitcoin/utility/async_file_writer.hpp>
 #include <bitcoin/bitcoin/utility/atomic.hpp>
 #include <bitcoin/bitcoin/utility/binary.hpp>
+#include <bitcoin/bitcoin/utility/binary_set.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
+#include <bitcoin/bitcoin/utility/cbor_writer.hpp>
+#include <bitcoin/bitcoin/utility/cold_ptr.hpp>
 #include <bitcoin/bitcoin/utility/collection.hpp>
 #include <bitcoin/bitcoin/utility/color.hpp>
 #include <bitcoin/bitcoin/utility/conditional_lock.hpp>
 #include <bitcoin/bitcoin/utility/container_sink.hpp>
 #include <bitcoin/bitcoin/utility/container_source.hpp>
+#include <bitcoin/bitcoin/utility/coroutine.hpp>
+#include <bitcoin/bitcoin/utility/cpu_features.hpp>
 #include <bitcoin/bitcoin/utility/data.hpp>
 #include <bitcoin/bitcoin/utility/deadline.hpp>
 #include <bitcoin/bitcoin/utility/decorator.hpp>
@@ -163,23 +231,46 @@
 #include <bitcoin/bitcoin/utility/enable_shared_from_base.hpp>
 #include <bitcoin/bitcoin/utility/endian.hpp>
 #include <bitcoin/bitcoin/utility/exceptions.hpp>
+#include <bitcoin/bitcoin/utility/flat_hash_map.hpp>
+#include <bitcoin/bitcoin/utility/flat_hash_set.hpp>
 #include <bitcoin/bitcoin/utility/flush_lock.hpp>
+#include <bitcoin/bitcoin/utility/hash_writer.hpp>
 #include <bitcoin/bitcoin/utility/interprocess_lock.hpp>
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
+#include <bitcoin/bitcoin/utility/json_writer.hpp>
+#include <bitcoin/bitcoin/utility/keyed_pending.hpp>
+#include <bitcoin/bitcoin/utility/large_page_allocator.hpp>
+#include <bitcoin/bitcoin/utility/memory_budget.hpp>
 #include <bitcoin/bitcoin/utility/monitor.hpp>
+#include <bitcoin/bitcoin/utility/mpmc_queue.hpp>
 #include <bitcoin/bitcoin/utility/noncopyable.hpp>
+#include <bitcoin/bitcoin/utility/once_cell.hpp>
 #include <bitcoin/bitcoin/utility/ostream_writer.hpp>
+#include <bitcoin/bitcoin/utility/packed_strings.hpp>
+#include <bitcoin/bitcoin/utility/parallel.hpp>
 #include <bitcoin/bitcoin/utility/pending.hpp>
 #include <bitcoin/bitcoin/utility/png.hpp>
+#include <bitcoin/bitcoin/utility/pool_allocator.hpp>
 #include <bitcoin/bitcoin/utility/prioritized_mutex.hpp>
 #include <bitcoin/bitcoin/utility/property_tree.hpp>
+#include <bitcoin/bitcoin/utility/property_writer.hpp>
 #include <bitcoin/bitcoin/utility/pseudo_random.hpp>
 #include <bitcoin/bitcoin/utility/reader.hpp>
+#include <bitcoin/bitcoin/utility/relay_queue.hpp>
 #include <bitcoin/bitcoin/utility/resubscriber.hpp>
+#include <bitcoin/bitcoin/utility/ring_buffer.hpp>
+#include <bitcoin/bitcoin/utility/rolling_bloom_filter.hpp>
 #include <bitcoin/bitcoin/utility/scope_lock.hpp>
+#include <bitcoin/bitcoin/utility/secure_allocator.hpp>
+#include <bitcoin/bitcoin/utility/send_queue.hpp>
+#include <bitcoin/bitcoin/utility/seqlocked.hpp>
 #include <bitcoin/bitcoin/utility/sequencer.hpp>
 #include <bitcoin/bitcoin/utility/sequential_lock.hpp>
 #include <bitcoin/bitcoin/utility/serializer.hpp>
+#include <bitcoin/bitcoin/utility/sha256_writer.hpp>
+#include <bitcoin/bitcoin/utility/sharded_map.hpp>
+#include <bitcoin/bitcoin/utility/shared_snapshot.hpp>
+#include <bitcoin/bitcoin/utility/shared_window.hpp>
 #include <bitcoin/bitcoin/utility/socket.hpp>
 #include <bitcoin/bitcoin/utility/string.hpp>
 #include <bitcoin/bitcoin/utility/subscriber.hpp>
@@ -187,11 +278,19 @@
 #include <bitcoin/bitcoin/utility/thread.hpp>
 #include <bitcoin/bitcoin/utility/threadpool.hpp>
 #include <bitcoin/bitcoin/utility/timer.hpp>
+#include <bitcoin/bitcoin/utility/timer_wheel.hpp>
+#include <bitcoin/bitcoin/utility/trace.hpp>
 #include <bitcoin/bitcoin/utility/track.hpp>
+#include <bitcoin/bitcoin/utility/tree_writer.hpp>
 #include <bitcoin/bitcoin/utility/work.hpp>
+#include <bitcoin/bitcoin/utility/work_stealing_pool.hpp>
 #include <bitcoin/bitcoin/utility/writer.hpp>
+#include <bitcoin/bitcoin/wallet/address_extractor.hpp>
+#include <bitcoin/bitcoin/wallet/address_generator.hpp>
+#include <bitcoin/bitcoin/wallet/address_index.hpp>
 #include <bitcoin/bitcoin/wallet/bitcoin_uri.hpp>
 #include <bitcoin/bitcoin/wallet/dictionary.hpp>
+#include <bitcoin/bitcoin/wallet/dictionary_index.hpp>
 #include <bitcoin/bitcoin/wallet/ec_private.hpp>
 #include <bitcoin/bitcoin/wallet/ec_public.hpp>
 #include <bitcoin/bitcoin/wallet/ek_private.hpp>
@@ -200,6 +299,7 @@
 #include <bitcoin/bitcoin/wallet/electrum.hpp>
 #include <bitcoin/bitcoin/wallet/electrum_dictionary.hpp>
 #include <bitcoin/bitcoin/wallet/encrypted_keys.hpp>
+#include <bitcoin/bitcoin/wallet/hd_cache.hpp>
 #include <bitcoin/bitcoin/wallet/hd_private.hpp>
 #include <bitcoin/bitcoin/wallet/hd_public.hpp>
 #include <bitcoin/bitcoin/wallet/message.hpp>
@@ -211,6 +311,7 @@
 #include <bitcoin/bitcoin/wallet/stealth_address.hpp>
 #include <bitcoin/bitcoin/wallet/stealth_receiver.hpp>
 #include <bitcoin/bitcoin/wallet/stealth_sender.hpp>
+#include <bitcoin/bitcoin/wallet/unspent_index.hpp>
 #include <bitcoin/bitcoin/wallet/uri.hpp>
 #include <bitcoin/bitcoin/wallet/uri_reader.hpp>
 
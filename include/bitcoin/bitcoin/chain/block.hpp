@@ -21,6 +21,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <istream>
 #include <memory>
 #include <string>
@@ -28,14 +29,20 @@
 #include <boost/optional.hpp>
 #include <bitcoin/bitcoin/chain/chain_state.hpp>
 #include <bitcoin/bitcoin/chain/header.hpp>
+#include <bitcoin/bitcoin/chain/output_point.hpp>
+#include <bitcoin/bitcoin/chain/prevout_source.hpp>
 #include <bitcoin/bitcoin/chain/transaction.hpp>
+#include <bitcoin/bitcoin/chain/validation_timing.hpp>
 #include <bitcoin/bitcoin/define.hpp>
 #include <bitcoin/bitcoin/error.hpp>
 #include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/math/muhash.hpp>
 #include <bitcoin/bitcoin/utility/asio.hpp>
+#include <bitcoin/bitcoin/utility/cold_ptr.hpp>
 #include <bitcoin/bitcoin/utility/data.hpp>
 #include <bitcoin/bitcoin/utility/reader.hpp>
 #include <bitcoin/bitcoin/utility/thread.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
 #include <bitcoin/bitcoin/utility/writer.hpp>
 
 namespace libbitcoin {
@@ -49,6 +56,8 @@ class BC_API block
 public:
     typedef std::vector<block> list;
     typedef std::vector<size_t> indexes;
+    typedef std::function<void(const code&)> result_handler;
+    typedef transaction::encoding_ptr encoding_ptr;
 
     // THIS IS FOR LIBRARY USE ONLY, DO NOT CREATE A DEPENDENCY ON IT.
     struct validation
@@ -64,6 +73,9 @@ public:
         asio::time_point start_push;
         asio::time_point end_push;
         float cache_efficiency;
+
+        /// Stage metrics of check, accept and connect, if set (not owned).
+        validation_timing* timing;
     };
 
     // Constructors.
@@ -94,10 +106,26 @@ public:
     static block factory(std::istream& stream, bool witness=false);
     static block factory(reader& source, bool witness=false);
 
+    // Deserialization retaining the encoding (see below).
+    static block factory(encoding_ptr data, size_t offset=0, bool witness=false, bool lazy=false);
+
     bool from_data(const data_chunk& data, bool witness=false);
     bool from_data(std::istream& stream, bool witness=false);
     bool from_data(reader& source, bool witness=false);
 
+    /// Scan the transaction boundaries, then decode, hash and count legacy
+    /// sigops of the transactions concurrently on the pool and the calling
+    /// thread. The result is that of the sequential from_data.
+    bool from_data(const data_chunk& data, bool witness, threadpool& pool);
+
+    /// Deserialize from the offset of a shared buffer, retaining a reference
+    /// to the consumed bytes in the block and each of its transactions (see
+    /// transaction::from_data). Serialization and sizing reuse the retained
+    /// bytes until the block is changed, which releases them. Witnesses are
+    /// lazy as specified (see transaction::from_data).
+    bool from_data(encoding_ptr data, size_t offset=0, bool witness=false,
+        bool lazy=false);
+
     bool is_valid() const;
 
     // Serialization.
@@ -108,11 +136,24 @@ public:
     void to_data(writer& sink, bool witness=false) const;
     hash_list to_hashes(bool witness=false) const;
 
+    /// Hash transactions concurrently on the pool and the calling thread.
+    hash_list to_hashes(bool witness, threadpool& pool) const;
+
     // Properties (size, accessors, cache).
     //-------------------------------------------------------------------------
 
     size_t serialized_size(bool witness=false) const;
 
+    /// Heap bytes of the transactions and caches, excluding sizeof.
+    size_t heap_size() const;
+
+    /// The retained encoding, empty if none is retained.
+    data_slice encoding() const;
+
+    /// True if the serialization (witness as specified) is the retained
+    /// encoding.
+    bool is_retained(bool witness) const;
+
     const chain::header& header() const;
     void set_header(const chain::header& value);
     void set_header(chain::header&& value);
@@ -138,6 +179,10 @@ public:
     static uint64_t subsidy(size_t height, uint64_t subsidy_interval,
         uint64_t initial_block_subsidy_satoshi);
 
+    /// The subsidy at the height under a network profile (see profiles).
+    template <typename Profile>
+    static uint64_t subsidy(size_t height);
+
     uint64_t fees() const;
     uint64_t claim() const;
     uint64_t reward(size_t height, uint64_t subsidy_interval,
@@ -149,6 +194,11 @@ public:
     size_t total_inputs() const;
     size_t weight() const;
 
+    /// The UTXO set hash change of connecting the block at the height, to be
+    /// applied to a running set hash with *=. Previous outputs must be
+    /// populated. See transaction::utxo_delta.
+    muhash utxo_delta(size_t height) const;
+
     bool is_extra_coinbases() const;
     bool is_final(size_t height, uint32_t block_time) const;
     bool is_distinct_transaction_set() const;
@@ -164,15 +214,75 @@ public:
     code check(uint64_t max_money, uint32_t timestamp_limit_seconds,
         uint32_t proof_of_work_limit, bool scrypt=false) const;
     code check_transactions(uint64_t max_money) const;
+
+    /// Check under a network profile (see profiles).
+    template <typename Profile>
+    code check(bool scrypt=false) const;
+
+    /// The forward reference or else internal double spend result of check,
+    /// determined in one pass over the inputs.
+    code check_internal_spends() const;
+
     code accept(const settings& settings, bool transactions=true,
         bool header=true) const;
     code accept(const chain_state& state, const settings& settings,
         bool transactions=true, bool header=true) const;
     code accept_transactions(const chain_state& state) const;
+
+    /// Accept under a network profile (see profiles), so that its parameters
+    /// are constants. A custom network is accepted under its settings.
+    template <typename Profile>
+    code accept(const chain_state& state, bool transactions=true,
+        bool header=true) const;
     code connect() const;
     code connect(const chain_state& state) const;
     code connect_transactions(const chain_state& state) const;
 
+    /// Parallel variants execute on the pool and the calling thread, each
+    /// producing the result of the serial variant (the first failure code in
+    /// block order).
+    uint64_t fees(threadpool& pool) const;
+    muhash utxo_delta(size_t height, threadpool& pool) const;
+    hash_digest generate_merkle_root(bool witness, threadpool& pool) const;
+    size_t signature_operations(bool bip16, bool bip141,
+        threadpool& pool) const;
+    code check(uint64_t max_money, uint32_t timestamp_limit_seconds,
+        uint32_t proof_of_work_limit, threadpool& pool,
+        bool scrypt=false) const;
+    code check_transactions(uint64_t max_money, threadpool& pool) const;
+    code accept(const chain_state& state, const settings& settings,
+        threadpool& pool, bool transactions=true, bool header=true) const;
+    template <typename Profile>
+    code check(threadpool& pool, bool scrypt=false) const;
+    template <typename Profile>
+    code accept(const chain_state& state, threadpool& pool,
+        bool transactions=true, bool header=true) const;
+    code accept_transactions(const chain_state& state,
+        threadpool& pool) const;
+
+    /// Connect inputs concurrently on the pool and the calling thread.
+    /// Stops on failure, returning the first failure code in block order.
+    code connect(threadpool& pool) const;
+    code connect(const chain_state& state, threadpool& pool) const;
+    code connect_transactions(const chain_state& state,
+        threadpool& pool) const;
+
+    /// The distinct and sorted previous outputs of non-coinbase inputs that
+    /// are not outputs of an earlier transaction of the block.
+    output_point::list missing_previous_outputs() const;
+
+    /// Populate the previous output metadata of each non-coinbase input.
+    /// Outputs of earlier transactions of the block are populated directly,
+    /// the missing previous outputs by one batch from the source.
+    code populate_previous_outputs(const chain_state& state,
+        prevout_source& source) const;
+
+    /// Populate on the pool, so that the lookup overlaps the caller's work.
+    /// The block and source must remain valid until the handler is invoked.
+    void populate_previous_outputs(const chain_state& state,
+        prevout_source& source, threadpool& pool,
+        result_handler handler) const;
+
     // THIS IS FOR LIBRARY USE ONLY, DO NOT CREATE A DEPENDENCY ON IT.
     mutable validation metadata;
 
@@ -183,8 +293,20 @@ private:
     typedef boost::optional<size_t> optional_size;
 
     optional_size total_inputs_cache() const;
+
+    // A null pool implies serial execution.
+    code check(uint64_t max_money, uint32_t timestamp_limit_seconds,
+        uint32_t proof_of_work_limit, bool scrypt, threadpool* pool) const;
+    code accept(const chain_state& state, uint64_t subsidy,
+        bool transactions, bool header, threadpool* pool) const;
     optional_size non_coinbase_inputs_cache() const;
 
+    // Previous outputs of the block are populated only if populate is set.
+    output_point::list previous_outputs(size_t height,
+        uint32_t median_time_past, bool populate) const;
+    code populate_previous_outputs(size_t height, uint32_t median_time_past,
+        prevout_source& source) const;
+
     chain::header header_;
     transaction::list transactions_;
 
@@ -195,9 +317,25 @@ private:
     mutable boost::optional<size_t> base_size_;
     mutable boost::optional<size_t> total_size_;
     mutable upgrade_mutex mutex_;
+
+    // The encoding from which the block was read, if retained, and whether it
+    // is the serialization without and with witness.
+    struct retained
+    {
+        encoding_ptr data;
+        size_t offset;
+        size_t size;
+        bool base;
+        bool total;
+    };
+
+    // This is held out of line and released by any change.
+    cold_ptr<retained> retained_;
 };
 
 } // namespace chain
 } // namespace libbitcoin
 
+#include <bitcoin/bitcoin/impl/chain/block.ipp>
+
 #endif
@@ -0,0 +1,104 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHAIN_BLOCK_ARCHIVE_HPP
+#define LIBBITCOIN_CHAIN_BLOCK_ARCHIVE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <bitcoin/bitcoin/chain/block.hpp>
+#include <bitcoin/bitcoin/chain/header.hpp>
+#include <bitcoin/bitcoin/chain/script_dictionary.hpp>
+#include <bitcoin/bitcoin/chain/transaction.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+/**
+ * A compact storage form of a block, in which each transaction is separately
+ * encoded, so that any one transaction is decoded without the others.
+ *
+ * [header:80][hashes][hash:32]...[transactions][size]...[transaction]...
+ *
+ * The hashes are the previous output transaction hashes that are referenced
+ * by more than one input of the block, in order of first reference. An input
+ * references its point hash by position in this table plus one, or by zero
+ * followed by the hash. The point index is written plus one (so a null index
+ * is zero), and the sequence as its difference from the maximum.
+ *
+ * A transaction is [version][witness:1][inputs][input]...[outputs][output]...
+ * [locktime], with each input as [hash reference][hash][index][compact script]
+ * [sequence][witness], the witness only if flagged. An output is either the
+ * dictionary position of its script plus one and its compressed value, or
+ * zero and its compact form. All counts and integers are base 128.
+ */
+class BC_API block_archive
+{
+public:
+    /// Encode the block, referencing the scripts of the dictionary.
+    static data_chunk encode(const block& block,
+        const script_dictionary& dictionary);
+
+    /// Construct a closed archive that decodes with the dictionary, which
+    /// must remain in scope for the lifetime of the archive.
+    block_archive(const script_dictionary& dictionary);
+
+    /// Read the header and transaction index of the encoded block, which
+    /// must remain in scope until closed. False if the index is malformed.
+    bool open(data_slice data);
+
+    /// Release the encoded block.
+    void close();
+
+    bool is_open() const;
+
+    /// The header of the block.
+    const chain::header& header() const;
+
+    /// The number of transactions of the block.
+    size_t size() const;
+
+    /// The encoded size of the transaction at the position.
+    size_t size(size_t position) const;
+
+    /// Decode the transaction at the position, false if out of range or it
+    /// is not fully and validly encoded.
+    bool read(transaction& out, size_t position) const;
+
+    /// Decode the block, false if any transaction fails to decode or the
+    /// transactions do not match the merkle root of the header.
+    bool read(block& out) const;
+
+private:
+    bool read_index(data_slice data);
+
+    const script_dictionary& dictionary_;
+    chain::header header_;
+    std::vector<hash_digest> hashes_;
+    std::vector<const uint8_t*> offsets_;
+    bool open_;
+};
+
+} // namespace chain
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,77 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHAIN_BLOCK_ASSEMBLER_HPP
+#define LIBBITCOIN_CHAIN_BLOCK_ASSEMBLER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/bitcoin/chain/block.hpp>
+#include <bitcoin/bitcoin/chain/chain_state.hpp>
+#include <bitcoin/bitcoin/chain/script.hpp>
+#include <bitcoin/bitcoin/chain/transaction_pool_index.hpp>
+#include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/settings.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+/**
+ * Builds block templates from a transaction pool index. Transactions are
+ * selected as packages with their unselected ancestors, in order of the
+ * package fee rate. The pool keeps its entries ordered by ancestor fee
+ * rate as it changes, so a template (or its refresh after new transactions)
+ * walks only as far as the block fills, and only the descendants of
+ * selected transactions are reordered. Weight is bounded by four times the
+ * virtual size and space is reserved for the coinbase.
+ */
+class BC_API block_assembler
+{
+public:
+    /// The weight and sigops reserved for the coinbase.
+    static BC_CONSTEXPR size_t coinbase_weight = 4000;
+    static BC_CONSTEXPR size_t coinbase_sigops = 400;
+
+    block_assembler(const transaction_pool_index& pool,
+        size_t max_weight=max_block_weight, size_t max_sigops=max_fast_sigops);
+
+    /// The pool entries selected for the next block of the state, each
+    /// after its in-pool parents. Pointers are valid until the pool changes.
+    transaction_pool_index::entries select(const chain_state& state,
+        uint32_t timestamp) const;
+
+    /// A template for the next block of the state, with merkle root and
+    /// (if bip141 is active) witness commitment. The coinbase pays the
+    /// subsidy and fees to the script. The timestamp is raised above the
+    /// median time past if necessary, and the nonce is zero.
+    block assemble(const chain_state& state, const settings& settings,
+        const hash_digest& parent, const script& pay_to,
+        uint32_t timestamp) const;
+
+private:
+    const transaction_pool_index& pool_;
+    const size_t max_weight_;
+    const size_t max_sigops_;
+};
+
+} // namespace chain
+} // namespace libbitcoin
+
+#endif
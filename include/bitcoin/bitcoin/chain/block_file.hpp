@@ -0,0 +1,77 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHAIN_BLOCK_FILE_HPP
+#define LIBBITCOIN_CHAIN_BLOCK_FILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <boost/filesystem.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+/// This class is not thread safe.
+/// A read-only memory mapping of a block file (blk*.dat or bootstrap.dat), in
+/// which each block is framed by the network magic and its little-endian
+/// size. Blocks are sliced from the mapping without copying, so slices are
+/// valid only while the file remains open. Zero fill and other bytes between
+/// frames are skipped, as is a frame that is oversized or truncated.
+class BC_API block_file
+  : noncopyable
+{
+public:
+    typedef boost::filesystem::path path;
+
+    /// The size of the magic and size prefix of each block.
+    static BC_CONSTEXPR size_t frame_size = 2 * sizeof(uint32_t);
+
+    /// Construct a closed file, framed by the network magic (identifier).
+    block_file(uint32_t magic);
+
+    /// Map the file, false if it cannot be opened or is empty.
+    bool open(const path& file);
+
+    /// Unmap the file, invalidating all slices.
+    void close();
+
+    bool is_open() const;
+
+    /// The mapped file.
+    data_slice data() const;
+
+    /// The offset of the next frame search.
+    size_t position() const;
+
+    /// Slice the next framed block, false when no frame remains.
+    bool next(data_slice& out_block);
+
+private:
+    const uint32_t magic_;
+    boost::iostreams::mapped_file_source file_;
+    size_t position_;
+};
+
+} // namespace chain
+} // namespace libbitcoin
+
+#endif
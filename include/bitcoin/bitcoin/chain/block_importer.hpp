@@ -0,0 +1,73 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHAIN_BLOCK_IMPORTER_HPP
+#define LIBBITCOIN_CHAIN_BLOCK_IMPORTER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <bitcoin/bitcoin/chain/block.hpp>
+#include <bitcoin/bitcoin/chain/block_file.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/settings.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+/// This class is not thread safe.
+/// Import the framed blocks of a block file through a pipeline of parse,
+/// hash (header and transaction hashes) and check stages. Each stage
+/// runs on its own thread and stages are joined by bounded queues, so that
+/// import proceeds at the pace of the slowest stage rather than of all
+/// stages in sequence. Each stage consumes in order, so blocks are delivered
+/// in file order. Blocks are parsed directly from the mapping, and the file
+/// must remain open until import returns.
+class BC_API block_importer
+  : noncopyable
+{
+public:
+    /// Invoked on the check thread with the check result of each block
+    /// (error::bad_stream if it could not be parsed), return false to stop.
+    typedef std::function<bool(const code&, block&&)> block_handler;
+
+    /// The default number of blocks buffered between each pair of stages.
+    static BC_CONSTEXPR size_t default_depth = 64;
+
+    block_importer(const settings& settings, bool witness=true,
+        size_t depth=default_depth);
+
+    /// Deliver each remaining block of the file to the handler in order.
+    /// Returns the code of the block for which the handler returned false,
+    /// or success once all blocks have been delivered.
+    code import(block_file& file, block_handler handler) const;
+
+private:
+    const uint64_t max_money_;
+    const uint32_t timestamp_limit_seconds_;
+    const uint32_t proof_of_work_limit_;
+    const bool witness_;
+    const size_t depth_;
+};
+
+} // namespace chain
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,133 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHAIN_BLOCK_PIPELINE_HPP
+#define LIBBITCOIN_CHAIN_BLOCK_PIPELINE_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <bitcoin/bitcoin/chain/block.hpp>
+#include <bitcoin/bitcoin/chain/chain_state.hpp>
+#include <bitcoin/bitcoin/chain/prevout_source.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/settings.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+/// Stage depth and threads of a block pipeline.
+struct BC_API block_pipeline_options
+{
+    /// The number of blocks buffered between each pair of stages, and so
+    /// the number that may be checked ahead of the block that connects.
+    size_t depth = 8;
+
+    /// The number of threads checking blocks ahead, zero for the number of
+    /// cores.
+    size_t check_threads = 2;
+
+    /// The number of threads connecting the inputs of each block with the
+    /// connect stage thread, zero for the number of cores.
+    size_t connect_threads = 0;
+};
+
+/**
+ * Block pipeline metrics by stage, of the last validation. Durations are
+ * busy time, and the check duration is summed over the check threads.
+ * Blocks that are not reached (after a failure) are not recorded.
+ */
+struct BC_API block_pipeline_metrics
+{
+    typedef std::chrono::nanoseconds duration;
+
+    /// The duration of the validation.
+    duration elapsed = duration::zero();
+
+    /// check: context-free check, including transaction hashing.
+    duration check = duration::zero();
+
+    /// prepare: previous output population, including the source.
+    duration populate = duration::zero();
+
+    /// prepare: contextual acceptance.
+    duration accept = duration::zero();
+
+    /// connect: input connection, including signature verification.
+    duration connect = duration::zero();
+
+    /// connect: the handler, which commits the block.
+    duration commit = duration::zero();
+
+    /// The number of blocks delivered to the handler.
+    size_t blocks = 0;
+
+    /// The busy fraction of the elapsed time of a stage with the threads.
+    double utilization(duration busy, size_t threads=1) const;
+};
+
+/// This class is not thread safe.
+/// Validate a sequence of consecutive blocks through a pipeline of check,
+/// prepare (populate and accept) and connect stages, joined by bounded
+/// queues. Blocks ahead are checked (and so hashed) on a pool of check
+/// threads, and the next block is populated and accepted while the current
+/// block connects on the connect pool. Outputs created and spent by blocks
+/// that are accepted but not yet committed overlay the source, so that the
+/// population of a block does not wait for the commit of its parent.
+/// Results are delivered in block order and the pipeline stops at the first
+/// failure, as each block depends on its predecessors.
+class BC_API block_pipeline
+  : noncopyable
+{
+public:
+    /// Set the next block and its (block) chain state, return false once
+    /// there are no more blocks. Invoked on the validating thread.
+    typedef std::function<bool(block& out_block, chain_state::ptr& out_state)>
+        block_source;
+
+    /// Invoked on the connect thread in block order with the validation
+    /// result of each block, return false to stop. Commit a valid block to
+    /// the source here, as the source is not queried while this runs.
+    typedef std::function<bool(const code&, block&&, const chain_state&)>
+        block_handler;
+
+    block_pipeline(const settings& settings,
+        const block_pipeline_options& options={});
+
+    /// Validate each block of the source, delivering each to the handler.
+    /// Returns the code of the block that failed or for which the handler
+    /// returned false, or success once all blocks have been delivered.
+    code validate(prevout_source& source, block_source next,
+        block_handler handler);
+
+    /// The stage metrics of the last validation.
+    const block_pipeline_metrics& metrics() const;
+
+private:
+    const settings& settings_;
+    const block_pipeline_options options_;
+    block_pipeline_metrics metrics_;
+};
+
+} // namespace chain
+} // namespace libbitcoin
+
+#endif
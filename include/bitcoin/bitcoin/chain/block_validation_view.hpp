@@ -0,0 +1,112 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHAIN_BLOCK_VALIDATION_VIEW_HPP
+#define LIBBITCOIN_CHAIN_BLOCK_VALIDATION_VIEW_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <bitcoin/bitcoin/chain/block.hpp>
+#include <bitcoin/bitcoin/chain/chain_state.hpp>
+#include <bitcoin/bitcoin/chain/input.hpp>
+#include <bitcoin/bitcoin/chain/point.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+/// The non-coinbase inputs of a block flattened into parallel arrays in
+/// block order, so that block level validation iterates contiguous memory
+/// rather than each transaction, its inputs and their previous outputs.
+/// Construct once the previous outputs are populated, a missing previous
+/// output has the not_found value and an empty script. Scripts are views of
+/// the block's script bytes, so the block must outlive the view and must not
+/// be modified while it is in use.
+class BC_API block_validation_view
+{
+public:
+    typedef std::vector<data_slice> slices;
+
+    explicit block_validation_view(const block& block);
+
+    /// The number of non-coinbase inputs, the size of each input array.
+    size_t size() const;
+
+    /// The number of non-coinbase transactions.
+    size_t transactions() const;
+
+    // Input arrays, indexed by non-coinbase input.
+    //-------------------------------------------------------------------------
+
+    const point::list& points() const;
+    const std::vector<uint64_t>& values() const;
+    const slices& previous_scripts() const;
+    const slices& scripts() const;
+    const std::vector<uint32_t>& sequences() const;
+
+    /// The block position of the transaction of each input.
+    const std::vector<uint32_t>& positions() const;
+
+    /// The transaction input index of each input.
+    const std::vector<uint32_t>& indexes() const;
+
+    // Validation.
+    //-------------------------------------------------------------------------
+
+    /// Equivalent to the block methods of the same names.
+    bool is_internal_double_spend() const;
+    uint64_t fees() const;
+    size_t signature_operations(bool bip16, bool bip141) const;
+
+    /// True if any transaction spends more than its inputs provide.
+    bool is_overspent() const;
+
+    /// Connect inputs concurrently on the pool and the calling thread.
+    /// Stops on failure, returning the first failure code in block order.
+    code connect(const chain_state& state, threadpool& pool) const;
+
+private:
+    // The sum of the previous output values of the non-coinbase transaction,
+    // with missing previous outputs as zero. Returns max_uint64 on overflow.
+    uint64_t input_value(size_t transaction) const;
+
+    const block& block_;
+
+    // Non-coinbase transaction arrays, offsets has a terminating entry.
+    std::vector<uint32_t> offsets_;
+    std::vector<uint64_t> output_values_;
+
+    // Non-coinbase input arrays.
+    std::vector<const input*> inputs_;
+    point::list points_;
+    std::vector<uint64_t> values_;
+    slices previous_scripts_;
+    slices scripts_;
+    std::vector<uint32_t> sequences_;
+    std::vector<uint32_t> positions_;
+    std::vector<uint32_t> indexes_;
+};
+
+} // namespace chain
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,74 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHAIN_BLOCK_VIEW_HPP
+#define LIBBITCOIN_CHAIN_BLOCK_VIEW_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/bitcoin/chain/block.hpp>
+#include <bitcoin/bitcoin/chain/transaction_view.hpp>
+#include <bitcoin/bitcoin/chain/view_list.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+/// Read-only view of a wire serialized block, parsed over borrowed memory
+/// which must outlive the view and any views or slices obtained from it.
+/// Construction validates the framing of the header and all transactions.
+class BC_API block_view
+{
+public:
+    typedef view_list<transaction_view> transaction_views;
+
+    block_view();
+
+    /// Parse the block at the front of the buffer.
+    explicit block_view(data_slice data);
+
+    bool is_valid() const;
+
+    /// The serialized block.
+    data_slice data() const;
+    size_t serialized_size() const;
+
+    /// The 80 byte serialized header.
+    data_slice header() const;
+
+    /// The header hash, computed over the underlying bytes.
+    hash_digest hash() const;
+
+    transaction_views transactions() const;
+
+    /// Deserialize an owning block, witness is stripped unless set.
+    block to_block(bool witness=false) const;
+
+private:
+    const uint8_t* begin_;
+    const uint8_t* transactions_;
+    const uint8_t* end_;
+    size_t transaction_count_;
+};
+
+} // namespace chain
+} // namespace libbitcoin
+
+#endif
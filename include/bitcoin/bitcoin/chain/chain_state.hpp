@@ -19,16 +19,18 @@
 #ifndef LIBBITCOIN_CHAIN_CHAIN_STATE_HPP
 #define LIBBITCOIN_CHAIN_CHAIN_STATE_HPP
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
-#include <deque>
 #include <bitcoin/bitcoin/config/checkpoint.hpp>
+#include <bitcoin/bitcoin/config/checkpoint_index.hpp>
 #include <bitcoin/bitcoin/constants.hpp>
 #include <bitcoin/bitcoin/define.hpp>
 #include <bitcoin/bitcoin/math/hash.hpp>
 #include <bitcoin/bitcoin/machine/opcode.hpp>
 #include <bitcoin/bitcoin/machine/rule_fork.hpp>
+#include <bitcoin/bitcoin/utility/shared_window.hpp>
 
 namespace libbitcoin {
 
@@ -42,13 +44,16 @@ class header;
 class BC_API chain_state
 {
 public:
-    typedef std::deque<uint32_t> bitss;
-    typedef std::deque<uint32_t> versions;
-    typedef std::deque<uint32_t> timestamps;
+    /// Header value histories share storage between successive states, so
+    /// deriving a state does not copy them.
+    typedef shared_window<uint32_t> bitss;
+    typedef shared_window<uint32_t> versions;
+    typedef shared_window<uint32_t> timestamps;
     typedef struct { size_t count; size_t high; } range;
 
     typedef std::shared_ptr<chain_state> ptr;
     typedef config::checkpoint::list checkpoints;
+    typedef config::checkpoint_index::const_ptr checkpoint_index_ptr;
 
     /// Heights used to identify construction requirements.
     /// All values are lower-bounded by the genesis block height.
@@ -152,11 +157,16 @@ public:
     chain_state(const chain_state& parent, const chain::header& header,
         const settings& settings);
 
-    /// Checkpoints must be ordered by height with greatest at back.
     /// Forks and checkpoints must match those provided for map creation.
+    /// This indexes the checkpoints, prefer sharing one index across states.
     chain_state(data&& values, const checkpoints& checkpoints, uint32_t forks,
         uint32_t stale_seconds, const settings& settings);
 
+    /// Forks and checkpoints must match those provided for map creation.
+    /// The index is shared by all states derived from this state.
+    static ptr from_index(data&& values, checkpoint_index_ptr checkpoints,
+        uint32_t forks, uint32_t stale_seconds, const settings& settings);
+
     /// Properties.
     const hash_digest& hash() const;
     size_t height() const;
@@ -166,6 +176,11 @@ public:
     uint32_t median_time_past() const;
     uint32_t work_required() const;
 
+    /// The values and configured forks from which the state was computed,
+    /// sufficient to recompute it (given settings and checkpoints).
+    const data& values() const;
+    uint32_t forks() const;
+
     /// Construction with zero height or any empty array causes invalid state.
     bool is_valid() const;
 
@@ -194,13 +209,34 @@ protected:
         uint32_t maximum_transaction_version;
     };
 
+    /// Rolling summaries of the version and timestamp histories.
+    struct summary
+    {
+        /// Versions in the history at or above each bip34-based version.
+        size_t bip34_count;
+        size_t bip66_count;
+        size_t bip65_count;
+
+        /// The timestamp history in ascending order, unless oversized.
+        size_t times_size;
+        std::array<uint32_t, median_time_past_interval> times;
+    };
+
     static activations activation(const data& values, uint32_t forks,
         const settings& settings);
+    static activations activation(const data& values, const summary& tally,
+        uint32_t forks, const settings& settings);
     static uint32_t median_time_past(const data& values, uint32_t forks);
+    static uint32_t median_time_past(const data& values,
+        const summary& tally);
     static uint32_t work_required(const data& values, uint32_t forks,
         const settings& settings);
 
 private:
+    // Distinct from the public list constructor, which is called with {}.
+    chain_state(checkpoint_index_ptr checkpoints, data&& values,
+        uint32_t forks, uint32_t stale_seconds, const settings& settings);
+
     static size_t bits_count(size_t height, uint32_t forks,
         size_t retargeting_interval);
     static size_t version_count(size_t height, uint32_t forks,
@@ -213,6 +249,10 @@ private:
     static size_t bip9_bit1_height(size_t height,
         const config::checkpoint& bip9_bit1_active_checkpoint);
 
+    static summary summarize(const data& values, const settings& settings);
+    static summary summarize(const chain_state& parent, const data& values,
+        const settings& settings);
+
     static data to_pool(const chain_state& top, const settings& settings);
     static data to_block(const chain_state& pool, const block& block,
         const config::checkpoint& bip9_bit0_active_checkpoint,
@@ -248,7 +288,10 @@ private:
     const uint32_t stale_seconds_;
 
     // Checkpoints do not affect the data that is collected or promoted.
-    const config::checkpoint::list& checkpoints_;
+    const checkpoint_index_ptr checkpoints_;
+
+    // This is advanced from the parent summary, or computed from raw data.
+    const summary summary_;
 
     // These are computed on construct from sample and checkpoints.
     const activations active_;
@@ -22,6 +22,7 @@
 #include <cstdint>
 #include <bitcoin/bitcoin/define.hpp>
 #include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/math/uint256.hpp>
 
 namespace libbitcoin {
 namespace chain {
@@ -47,6 +48,10 @@ public:
     /// This is either saved or generated from the construction parameter.
     operator const uint256_t&() const;
 
+    /// Expand a 32 bit compact number into the little-endian bytes of the
+    /// number it represents, as a hash compares. False on overflow (zeroed).
+    static bool expand(hash_digest& out, uint32_t compact);
+
 private:
     static bool from_compact(uint256_t& out, uint32_t compact);
     static uint32_t from_big(const uint256_t& big);
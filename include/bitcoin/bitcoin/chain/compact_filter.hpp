@@ -0,0 +1,79 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHAIN_COMPACT_FILTER_HPP
+#define LIBBITCOIN_CHAIN_COMPACT_FILTER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <bitcoin/bitcoin/chain/block.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+/**
+ * This class is not thread safe.
+ * Build and match bip158 basic block filters (Golomb-coded sets of scripts).
+ * Buffers are retained across calls, so an instance reused for each block
+ * (or query) does not allocate once it has grown to the largest block.
+ */
+class BC_API compact_filter
+  : noncopyable
+{
+public:
+    /// The bip158 basic filter type.
+    static const uint8_t basic_type;
+
+    /// The bip158 basic filter Golomb-Rice parameter (P).
+    static const uint8_t golomb_bits;
+
+    /// The bip158 basic filter false positive rate inverse (M).
+    static const uint64_t golomb_rate;
+
+    /// Build the basic filter of the block into out, replacing its content.
+    /// Prevout scripts are read from each input's previous output metadata
+    /// cache, false if the cache of any non-coinbase input is not populated.
+    bool build(data_chunk& out, const block& block);
+
+    /// True if the script is (probably) a member of the filter.
+    static bool match(const data_chunk& filter, const hash_digest& block_hash,
+        data_slice script);
+
+    /// True if any of the scripts is (probably) a member of the filter.
+    /// The filter is decoded once, in merge with the sorted queries.
+    bool match_any(const data_chunk& filter, const hash_digest& block_hash,
+        const data_stack& scripts);
+
+    /// The bip157 header of the filter, chained to the previous header.
+    static hash_digest to_header(const data_chunk& filter,
+        const hash_digest& previous_header);
+
+private:
+    std::vector<data_slice> elements_;
+    std::vector<uint64_t> values_;
+};
+
+} // namespace chain
+} // namespace libbitcoin
+
+#endif
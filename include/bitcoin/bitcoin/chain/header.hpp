@@ -29,7 +29,9 @@
 #include <bitcoin/bitcoin/define.hpp>
 #include <bitcoin/bitcoin/error.hpp>
 #include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/math/uint256.hpp>
 #include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/once_cell.hpp>
 #include <bitcoin/bitcoin/utility/reader.hpp>
 #include <bitcoin/bitcoin/utility/thread.hpp>
 #include <bitcoin/bitcoin/utility/writer.hpp>
@@ -38,6 +40,12 @@ namespace libbitcoin {
 
 class settings;
 
+namespace message {
+
+class headers;
+
+} // namespace message
+
 namespace chain {
 
 class BC_API header
@@ -49,6 +57,10 @@ public:
     typedef std::vector<ptr> ptr_list;
     typedef std::vector<const_ptr> const_ptr_list;
 
+    /// The serialized size is fixed, allowing serialization to an array.
+    static BC_CONSTEXPR size_t wire_size = 80;
+    typedef byte_array<wire_size> wire_data;
+
     // THIS IS FOR LIBRARY USE ONLY, DO NOT CREATE A DEPENDENCY ON IT.
     struct validation
     {
@@ -114,6 +126,7 @@ public:
     bool from_data(reader& source, bool wire=true);
     bool from_data(reader& source, hash_digest&& hash, bool wire=true);
     bool from_data(reader& source, const hash_digest& hash, bool wire=true);
+    bool from_wire_data(const wire_data& data);
 
     bool is_valid() const;
 
@@ -123,6 +136,7 @@ public:
     data_chunk to_data(bool wire=true) const;
     void to_data(std::ostream& stream, bool wire=true) const;
     void to_data(writer& sink, bool wire=true) const;
+    wire_data to_wire_data() const;
 
     // Properties (size, accessors, cache).
     //-------------------------------------------------------------------------
@@ -130,6 +144,9 @@ public:
     static size_t satoshi_fixed_size();
     size_t serialized_size(bool wire=true) const;
 
+    /// A header owns no heap memory, this is zero.
+    size_t heap_size() const;
+
     uint32_t version() const;
     void set_version(uint32_t value);
 
@@ -163,8 +180,20 @@ public:
     bool is_valid_proof_of_work(uint32_t proof_of_work_limit,
         bool scrypt=false) const;
 
+    /// Validate the work of a precomputed proof of work hash of the header.
+    bool is_valid_proof_of_work(uint32_t proof_of_work_limit,
+        const hash_digest& pow_hash) const;
+
     code check(uint32_t timestamp_limit_seconds, uint32_t proof_of_work_limit,
         bool scrypt=false) const;
+
+    /// Check with a precomputed proof of work hash, such as of a batch.
+    code check(uint32_t timestamp_limit_seconds, uint32_t proof_of_work_limit,
+        const hash_digest& pow_hash) const;
+
+    /// Check under a network profile (see profiles).
+    template <typename Profile>
+    code check(bool scrypt=false) const;
     code accept() const;
     code accept(const chain_state& state) const;
 
@@ -175,16 +204,17 @@ protected:
     // So that block may call reset from its own.
     friend class block;
 
+    // So that headers may cache the hashes of a batch.
+    friend class message::headers;
+
     void reset();
     void invalidate_cache() const;
 
-private:
-    typedef std::shared_ptr<hash_digest> hash_ptr;
+    // Sets the hash if not yet cached, the hash must be that of this header.
+    void set_hash(const hash_digest& hash) const;
 
-    hash_ptr hash_cache() const;
-
-    mutable hash_ptr hash_;
-    mutable upgrade_mutex mutex_;
+private:
+    once_cell<hash_digest> hash_;
 
     uint32_t version_;
     hash_digest previous_block_hash_;
@@ -197,4 +227,6 @@ private:
 } // namespace chain
 } // namespace libbitcoin
 
+#include <bitcoin/bitcoin/impl/chain/header.ipp>
+
 #endif
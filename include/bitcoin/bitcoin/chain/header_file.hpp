@@ -0,0 +1,121 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHAIN_HEADER_FILE_HPP
+#define LIBBITCOIN_CHAIN_HEADER_FILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <boost/filesystem.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <bitcoin/bitcoin/chain/chain_state.hpp>
+#include <bitcoin/bitcoin/chain/header.hpp>
+#include <bitcoin/bitcoin/chain/header_index.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/math/uint256.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+/**
+ * This class is not thread safe.
+ * A read-only memory mapping of the entries of a header_index, stored in
+ * fixed-stride records in index position order, so that an entry is read
+ * in place without parsing or hashing the preceding headers. The index is
+ * restored from the file, and the chain state data of any entry is read
+ * from the headers of its windows alone, so that restart does not scale
+ * with the number of headers.
+ *
+ * [magic:4][version:4][top:8]
+ * records: [header:80][hash:32][work:32][height:4][parent:4][skip:4][zero:4]
+ *
+ * Integers are little-endian, work is a little-endian 256 bit value, and the
+ * parent of the genesis entry is max_uint32.
+ */
+class BC_API header_file
+  : noncopyable
+{
+public:
+    typedef boost::filesystem::path path;
+
+    /// The file magic ("hdrs" as written) and the version written.
+    static BC_CONSTEXPR uint32_t magic = 0x73726468;
+    static BC_CONSTEXPR uint32_t version = 1;
+
+    /// The size of the file prefix and of each record.
+    static BC_CONSTEXPR size_t prefix_size = 16;
+    static BC_CONSTEXPR size_t record_size = 160;
+
+    /// Append the entries of the index that are not stored to the file, and
+    /// store the top, creating the file if it does not exist. The stored
+    /// entries must be those of the index, which is verified by the hash of
+    /// the last stored entry. A mapping of the file must be reopened to see
+    /// the appended entries.
+    static bool store(const path& file, const header_index& index);
+
+    /// Construct a closed file.
+    header_file();
+
+    /// Map the file, false if it cannot be opened or is not a header file.
+    bool open(const path& file);
+
+    /// Unmap the file.
+    void close();
+
+    bool is_open() const;
+
+    /// The number of entries and the position of the top.
+    size_t size() const;
+    size_t top() const;
+
+    /// Properties of the entry at the position, which must be stored.
+    chain::header header(size_t position) const;
+    hash_digest hash(size_t position) const;
+    uint256_t work(size_t position) const;
+    size_t height(size_t position) const;
+    size_t parent(size_t position) const;
+    size_t skip(size_t position) const;
+
+    /// The serialized header of the entry at the position, which must be
+    /// stored. Records are contiguous, at a stride of record_size.
+    const uint8_t* header_data(size_t position) const;
+
+    /// The position of the ancestor of position at height, not_found if
+    /// height exceeds that of position.
+    size_t ancestor(size_t position, size_t height) const;
+
+    /// Populate the chain state data of the entry at the position, reading
+    /// the heights of the map from the branch of the entry. False if the
+    /// position is not stored or a window exceeds its height.
+    bool populate(chain_state::data& out, const chain_state::map& map,
+        size_t position) const;
+
+private:
+    const uint8_t* record(size_t position) const;
+
+    boost::iostreams::mapped_file_source file_;
+    size_t size_;
+    size_t top_;
+};
+
+} // namespace chain
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,62 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHAIN_HEADER_HASHER_HPP
+#define LIBBITCOIN_CHAIN_HEADER_HASHER_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/bitcoin/chain/header.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+/**
+ * Hashes a header over varied nonces. The sha256 midstate of the first 64
+ * bytes and the padded second block are computed once, so each nonce costs
+ * one compression of the second block and the second hash. A batch of
+ * nonces is hashed across SIMD lanes where supported by the cpu.
+ */
+class BC_API header_hasher
+{
+public:
+    /// Cache the midstate of the header, its nonce is not used.
+    header_hasher(const header& header);
+
+    /// The hash of the header with the nonce, as header::hash().
+    hash_digest hash(uint32_t nonce) const;
+
+    /// The hashes of count nonces into out.
+    void hash(const uint32_t* nonces, size_t count, hash_digest* out) const;
+
+    /// The hashes of count consecutive nonces from first into out (wraps).
+    void hash(uint32_t first, size_t count, hash_digest* out) const;
+
+private:
+    // The sha256 state, and the header bytes between it and the nonce.
+    std::array<uint32_t, 8> midstate_;
+    std::array<uint8_t, 12> tail_;
+};
+
+} // namespace chain
+} // namespace libbitcoin
+
+#endif
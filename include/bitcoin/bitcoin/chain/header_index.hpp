@@ -0,0 +1,115 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHAIN_HEADER_INDEX_HPP
+#define LIBBITCOIN_CHAIN_HEADER_INDEX_HPP
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+#include <bitcoin/bitcoin/chain/header.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/math/salted_hash.hpp>
+#include <bitcoin/bitcoin/math/uint256.hpp>
+#include <bitcoin/bitcoin/utility/large_page_allocator.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+class header_file;
+
+/// This class is not thread safe.
+/// An in-memory tree of headers rooted at a genesis header. Headers are held
+/// in a contiguous array in order of insertion, with a hash table for lookup.
+/// Each entry records its height, cumulative proof of work and a skip link
+/// to a lower ancestor, so that any ancestor is reached in O(log n) steps
+/// (as bitcoind). The top is the first entry inserted with the most work.
+class BC_API header_index
+{
+public:
+    /// The position of a header that is not indexed.
+    static const size_t not_found;
+
+    /// Construct an index of the genesis header alone, at position zero.
+    header_index(const chain::header& genesis);
+
+    /// Construct an index of the entries of the file, which must be open and
+    /// not empty. Entries are copied without hashing or summing work.
+    header_index(const header_file& file);
+
+    /// Reserve space for the number of headers.
+    void reserve(size_t size);
+
+    /// Index the header, false if it is already indexed or is an orphan.
+    bool insert(const chain::header& header);
+
+    /// The position of the header with the hash, or not_found.
+    size_t find(const hash_digest& hash) const;
+
+    /// The number of indexed headers.
+    size_t size() const;
+
+    /// The position of the entry with the most cumulative work.
+    size_t top() const;
+
+    /// Properties of the header at the position, which must be indexed.
+    const chain::header& header(size_t position) const;
+    size_t height(size_t position) const;
+    size_t parent(size_t position) const;
+    const uint256_t& work(size_t position) const;
+    size_t skip(size_t position) const;
+
+    /// The height of the skip link of an entry at the height.
+    static size_t skip_height(size_t height);
+
+    /// The position of the ancestor of position at height, not_found if
+    /// height exceeds that of position.
+    size_t ancestor(size_t position, size_t height) const;
+
+    /// The position of the highest common ancestor of the two positions.
+    size_t fork_point(size_t first, size_t second) const;
+
+    /// The block locator of the header at the position.
+    hash_list locator(size_t position) const;
+
+    /// The position of the first locator hash in the branch of the top, or
+    /// zero (genesis) if there is none.
+    size_t locate(const hash_list& locator) const;
+
+private:
+    struct entry
+    {
+        chain::header header;
+        uint256_t work;
+        size_t height;
+        size_t parent;
+        size_t skip;
+    };
+
+    // The entries may be backed by huge pages, as configured by large_pages.
+    std::vector<entry, large_page_allocator<entry>> entries_;
+    std::unordered_map<hash_digest, size_t, salted_hash<hash_digest>>
+        positions_;
+    size_t top_;
+};
+
+} // namespace chain
+} // namespace libbitcoin
+
+#endif
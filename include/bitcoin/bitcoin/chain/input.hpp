@@ -29,6 +29,8 @@
 #include <bitcoin/bitcoin/chain/witness.hpp>
 #include <bitcoin/bitcoin/define.hpp>
 #include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/cold_ptr.hpp>
+#include <bitcoin/bitcoin/utility/once_cell.hpp>
 #include <bitcoin/bitcoin/utility/reader.hpp>
 #include <bitcoin/bitcoin/utility/thread.hpp>
 #include <bitcoin/bitcoin/utility/writer.hpp>
@@ -80,6 +82,14 @@ public:
     bool from_data(std::istream& stream, bool wire=true, bool witness=false);
     bool from_data(reader& source, bool wire=true, bool witness=false);
 
+    /// Deserialize into this input, retaining the capacity of its script and
+    /// witness. A wire witness is not read or cleared, as it follows the
+    /// outputs, so the transaction must then read or strip it.
+    bool recycle(reader& source, bool wire=true, bool witness=false);
+
+    /// Deserialize the wire witness into this input, retaining its capacity.
+    bool recycle_witness(reader& source);
+
     bool is_valid() const;
 
     // Serialization.
@@ -95,6 +105,10 @@ public:
     /// This accounts for wire witness, but does not read or write it.
     size_t serialized_size(bool wire=true, bool witness=false) const;
 
+    /// Heap bytes of the script, witness, caches and the populated previous
+    /// output, excluding sizeof.
+    size_t heap_size() const;
+
     output_point& previous_output();
     const output_point& previous_output() const;
     void set_previous_output(const output_point& value);
@@ -129,6 +143,9 @@ public:
     bool is_final() const;
     bool is_segregated() const;
     bool is_locked(size_t block_height, uint32_t median_time_past) const;
+
+    /// The p2sh and witness counts require a populated previous output, and
+    /// the total is then cached for the first bip16/bip141 combination.
     size_t signature_operations(bool bip16, bool bip141) const;
     bool extract_reserved_hash(hash_digest& out) const;
     bool extract_embedded_script(chain::script& out) const;
@@ -140,17 +157,26 @@ protected:
     void invalidate_cache() const;
 
 private:
-    typedef std::shared_ptr<wallet::payment_address::list> addresses_ptr;
+    struct sigop_count
+    {
+        bool bip16;
+        bool bip141;
+        size_t value;
+    };
 
-    addresses_ptr addresses_cache() const;
+    bool read(reader& source, bool wire, bool witness, bool recycle);
+    size_t count_signature_operations(bool bip16, bool bip141) const;
 
-    mutable upgrade_mutex mutex_;
-    mutable addresses_ptr addresses_;
+    typedef once_cell<wallet::payment_address::list> addresses_cell;
 
     output_point previous_output_;
+    uint32_t sequence_;
     chain::script script_;
     chain::witness witness_;
-    uint32_t sequence_;
+    once_cell<sigop_count> sigops_;
+
+    // This is rarely used, so is held out of line.
+    mutable cold_ptr<addresses_cell> addresses_;
 };
 
 } // namespace chain
@@ -0,0 +1,146 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHAIN_MERKLE_TREE_HPP
+#define LIBBITCOIN_CHAIN_MERKLE_TREE_HPP
+
+#include <cstddef>
+#include <deque>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+#include <bitcoin/bitcoin/utility/thread.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+class block;
+
+/**
+ * All levels of a merkle tree, computed once from its leaves. Each level is
+ * hashed in one batch of the double sha256 of 64 byte sibling pairs. A tree
+ * is immutable, so it may be shared between threads (such as from a cache).
+ */
+class BC_API merkle_tree
+{
+public:
+    typedef std::shared_ptr<const merkle_tree> const_ptr;
+    typedef std::vector<hash_list> levels;
+
+    /// The root of a leaf at the index, given its branch.
+    static hash_digest root(const hash_digest& leaf, const hash_list& branch,
+        size_t index);
+
+    /// Construct the tree of the leaf hashes, in order.
+    merkle_tree(const hash_list& leaves);
+    merkle_tree(hash_list&& leaves);
+
+    /// Construct the tree of the transaction (or witness) hashes of a block.
+    merkle_tree(const block& block, bool witness=false);
+
+    /// The number of leaves.
+    size_t size() const;
+
+    /// The root, null_hash if there are no leaves.
+    const hash_digest& root() const;
+
+    /// The leaves at the front and the root at the back (empty if none).
+    const levels& all_levels() const;
+
+    /// The sibling hashes of the leaf at the index, from the leaf level up,
+    /// excluding the root. This is empty if the index is out of range. An
+    /// odd last node of a level is its own sibling.
+    hash_list branch(size_t index) const;
+
+private:
+    void populate();
+
+    levels levels_;
+};
+
+/**
+ * The right-hand siblings of the leftmost path of a merkle tree. These are
+ * retained so that the root for a changed first (coinbase) leaf costs one
+ * hash per level, as when rolling the extranonce of a block template. The
+ * coinbase leaf of a witness tree is null_hash (bip141), so its root does not
+ * change with the coinbase.
+ */
+class BC_API coinbase_merkle
+{
+public:
+    /// Retain the branch of the first leaf (its value is not used).
+    coinbase_merkle(const hash_list& leaves);
+
+    /// Retain the branch of the coinbase of the transaction (or witness) tree
+    /// of a block.
+    coinbase_merkle(const block& block, bool witness=false);
+
+    /// The number of leaves.
+    size_t size() const;
+
+    /// The siblings of the first leaf, from the leaf level up.
+    const hash_list& branch() const;
+
+    /// The root for the given first leaf. With one leaf this is the leaf.
+    hash_digest root(const hash_digest& coinbase_hash) const;
+
+private:
+    size_t size_;
+    hash_list branch_;
+};
+
+/**
+ * A bounded cache of the merkle trees of recent blocks, keyed by block hash
+ * and tree type. The oldest tree is evicted when the cache is full. A tree
+ * is built outside of the lock on a miss. This class is thread safe.
+ */
+class BC_API merkle_tree_cache
+  : noncopyable
+{
+public:
+    /// Construct a cache of at most the given number of trees.
+    merkle_tree_cache(size_t capacity);
+
+    /// The cached tree of the block, built and cached if not found.
+    merkle_tree::const_ptr get(const block& block, bool witness=false);
+
+    /// The number of cached trees.
+    size_t size() const;
+
+    /// Remove all trees.
+    void clear();
+
+private:
+    typedef std::pair<hash_digest, bool> key;
+
+    const size_t capacity_;
+
+    // These are protected by mutex.
+    std::map<key, merkle_tree::const_ptr> trees_;
+    std::deque<key> order_;
+    mutable shared_mutex mutex_;
+};
+
+} // namespace chain
+} // namespace libbitcoin
+
+#endif
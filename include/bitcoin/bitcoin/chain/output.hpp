@@ -27,6 +27,8 @@
 #include <vector>
 #include <bitcoin/bitcoin/chain/script.hpp>
 #include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/utility/cold_ptr.hpp>
+#include <bitcoin/bitcoin/utility/once_cell.hpp>
 #include <bitcoin/bitcoin/utility/reader.hpp>
 #include <bitcoin/bitcoin/utility/thread.hpp>
 #include <bitcoin/bitcoin/utility/writer.hpp>
@@ -95,6 +97,11 @@ public:
     bool from_data(std::istream& stream, bool wire=true);
     bool from_data(reader& source, bool wire=true, bool unused=false);
 
+    /// Deserialize the compact form written by to_compact.
+    bool from_compact(const data_chunk& data);
+    bool from_compact(std::istream& stream);
+    bool from_compact(reader& source);
+
     bool is_valid() const;
 
     // Serialization.
@@ -104,10 +111,24 @@ public:
     void to_data(std::ostream& stream, bool wire=true) const;
     void to_data(writer& sink, bool wire=true, bool unused=false) const;
 
+    /// Serialize for storage, with a compressed value and compact script.
+    data_chunk to_compact() const;
+    void to_compact(std::ostream& stream) const;
+    void to_compact(writer& sink) const;
+
+    /// The compressed value of the compact form, the source is invalidated
+    /// by a value that is not in its one encoding.
+    static uint64_t read_compact_value(reader& source);
+    static void write_compact_value(writer& sink, uint64_t value);
+
     // Properties (size, accessors, cache).
     //-------------------------------------------------------------------------
 
     size_t serialized_size(bool wire=true) const;
+    size_t compact_size() const;
+
+    /// Heap bytes of the script and caches, excluding sizeof.
+    size_t heap_size() const;
 
     uint64_t value() const;
     void set_value(uint64_t value);
@@ -141,15 +162,13 @@ protected:
     void invalidate_cache() const;
 
 private:
-    typedef std::shared_ptr<wallet::payment_address::list> addresses_ptr;
-
-    addresses_ptr addresses_cache() const;
-
-    mutable upgrade_mutex mutex_;
-    mutable addresses_ptr addresses_;
+    typedef once_cell<wallet::payment_address::list> addresses_cell;
 
     uint64_t value_;
     chain::script script_;
+
+    // This is rarely used, so is held out of line.
+    mutable cold_ptr<addresses_cell> addresses_;
 };
 
 } // namespace chain
@@ -26,6 +26,7 @@
 #include <bitcoin/bitcoin/chain/point.hpp>
 #include <bitcoin/bitcoin/chain/script.hpp>
 #include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/utility/cold_ptr.hpp>
 
 namespace libbitcoin {
 namespace chain {
@@ -34,6 +35,7 @@ class BC_API output_point
   : public point
 {
 public:
+    typedef std::vector<output_point> list;
 
     // THIS IS FOR LIBRARY USE ONLY, DO NOT CREATE A DEPENDENCY ON IT.
     struct validation
@@ -103,8 +105,13 @@ public:
     /// True if cached previous output is mature enough to spend from height.
     bool is_mature(size_t height) const;
 
+    /// The cached previous output, invalid (not found) if not populated.
+    /// Unpopulated metadata is not allocated by this query.
+    const output& cached_output() const;
+
     // THIS IS FOR LIBRARY USE ONLY, DO NOT CREATE A DEPENDENCY ON IT.
-    mutable validation metadata;
+    /// This is held out of line, allocated when first accessed.
+    mutable cold_ptr<validation> metadata;
 
 protected:
     // So that input may call reset from its own.
@@ -112,6 +119,14 @@ protected:
 };
 
 } // namespace chain
+
+// Allow output_point to be keyed in salted hash containers.
+template <>
+struct salted_hash<chain::output_point>
+  : salted_hash<chain::point>
+{
+};
+
 } // namespace libbitcoin
 
 #endif
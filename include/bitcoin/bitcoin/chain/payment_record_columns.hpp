@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHAIN_PAYMENT_RECORD_COLUMNS_HPP
+#define LIBBITCOIN_CHAIN_PAYMENT_RECORD_COLUMNS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <bitcoin/bitcoin/chain/payment_record.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/reader.hpp>
+#include <bitcoin/bitcoin/utility/writer.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+/// This class models a columnar serialization of a set of payment records.
+/// The set header carries the row count, height range and body size. The
+/// wire body holds delta encoded heights and the point hashes, the store
+/// body holds delta encoded links. Both follow with packed output flags,
+/// base128 point indexes and fixed width data values.
+class BC_API payment_record_columns
+{
+public:
+    // Constructors.
+    //-------------------------------------------------------------------------
+
+    payment_record_columns();
+
+    payment_record_columns(payment_record_columns&& other);
+    payment_record_columns(const payment_record_columns& other);
+
+    payment_record_columns(payment_record::list&& records);
+    payment_record_columns(const payment_record::list& records);
+
+    // Operators.
+    //-------------------------------------------------------------------------
+
+    payment_record_columns& operator=(payment_record_columns&& other);
+    payment_record_columns& operator=(const payment_record_columns& other);
+
+    bool operator==(const payment_record_columns& other) const;
+    bool operator!=(const payment_record_columns& other) const;
+
+    // Deserialization.
+    //-------------------------------------------------------------------------
+
+    static payment_record_columns factory(const data_chunk& data,
+        bool wire=true);
+    static payment_record_columns factory(std::istream& stream,
+        bool wire=true);
+    static payment_record_columns factory(reader& source, bool wire=true);
+
+    bool from_data(const data_chunk& data, bool wire=true);
+    bool from_data(std::istream& stream, bool wire=true);
+    bool from_data(reader& source, bool wire=true);
+
+    /// Read only the records within the inclusive height range (wire only).
+    /// A set entirely outside the range is skipped without reading its body.
+    bool from_data(reader& source, size_t start_height, size_t stop_height);
+
+    bool is_valid() const;
+
+    // Serialization.
+    //-------------------------------------------------------------------------
+
+    data_chunk to_data(bool wire=true) const;
+    void to_data(std::ostream& stream, bool wire=true) const;
+    void to_data(writer& sink, bool wire=true) const;
+
+    // Properties (size, accessors).
+    //-------------------------------------------------------------------------
+
+    size_t serialized_size(bool wire=true) const;
+    const payment_record::list& records() const;
+
+protected:
+    void reset();
+
+private:
+    bool valid_;
+    payment_record::list records_;
+};
+
+} // namespace chain
+} // namespace libbitcoin
+
+#endif
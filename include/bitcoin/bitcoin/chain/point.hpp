@@ -26,6 +26,8 @@
 #include <boost/functional/hash.hpp>
 #include <bitcoin/bitcoin/define.hpp>
 #include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/math/salted_hash.hpp>
+#include <bitcoin/bitcoin/math/siphash.hpp>
 #include <bitcoin/bitcoin/utility/data.hpp>
 #include <bitcoin/bitcoin/utility/reader.hpp>
 #include <bitcoin/bitcoin/utility/writer.hpp>
@@ -121,6 +123,18 @@ private:
 };
 
 } // namespace chain
+
+// Allow point to be keyed in salted hash containers.
+template <>
+struct salted_hash<chain::point>
+{
+    size_t operator()(const chain::point& point) const
+    {
+        return static_cast<size_t>(siphash13(hash_salt(), point.hash(),
+            point.index()));
+    }
+};
+
 } // namespace libbitcoin
 
 #endif
@@ -0,0 +1,120 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHAIN_POINT_LINK_HPP
+#define LIBBITCOIN_CHAIN_POINT_LINK_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include <boost/functional/hash.hpp>
+#include <bitcoin/bitcoin/chain/output_point.hpp>
+#include <bitcoin/bitcoin/chain/point.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+class transaction;
+
+/**
+ * A compact reference to an output, for internal indexes of many points
+ * (e.g. unspent outputs, spends and double spend detection). The transaction
+ * is identified by its store link (as transaction::validation::link) rather
+ * than its hash. The link is held as two words, so that an instance is 12
+ * bytes with 4 byte alignment, a third of the size of an output_point.
+ */
+class BC_API point_link
+{
+public:
+    typedef std::vector<point_link> list;
+
+    /// A default instance is unlinked, with the null index.
+    point_link();
+
+    point_link(uint64_t link, uint32_t index);
+
+    /// The point of the output at the index of the linked transaction.
+    point_link(const transaction& tx, uint32_t index);
+
+    /// The point of the output with the same index, in the transaction at
+    /// the link, which must be that of the hash of the point.
+    point_link(const point& point, uint64_t link);
+
+    // Operators.
+    //-------------------------------------------------------------------------
+
+    bool operator<(const point_link& other) const;
+    bool operator==(const point_link& other) const;
+    bool operator!=(const point_link& other) const;
+
+    // Properties.
+    //-------------------------------------------------------------------------
+
+    uint64_t link() const;
+    uint32_t index() const;
+
+    /// False if the link is transaction::validation::unlinked.
+    bool is_linked() const;
+
+    /// The output point, of the hash of the transaction at the link.
+    output_point to_point(const hash_digest& hash) const;
+
+    /// A well-distributed hash of the link and index (not salted, as links
+    /// are assigned by the store and cannot be chosen by a peer).
+    size_t hash() const;
+
+private:
+    uint32_t link_low_;
+    uint32_t link_high_;
+    uint32_t index_;
+};
+
+} // namespace chain
+} // namespace libbitcoin
+
+// Extend std and boost namespaces with our hash wrappers.
+//-----------------------------------------------------------------------------
+
+namespace std
+{
+template <>
+struct hash<bc::chain::point_link>
+{
+    size_t operator()(const bc::chain::point_link& point) const
+    {
+        return point.hash();
+    }
+};
+} // namespace std
+
+namespace boost
+{
+template <>
+struct hash<bc::chain::point_link>
+{
+    size_t operator()(const bc::chain::point_link& point) const
+    {
+        return point.hash();
+    }
+};
+} // namespace boost
+
+#endif
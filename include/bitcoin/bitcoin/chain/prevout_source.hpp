@@ -0,0 +1,48 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHAIN_PREVOUT_SOURCE_HPP
+#define LIBBITCOIN_CHAIN_PREVOUT_SOURCE_HPP
+
+#include <bitcoin/bitcoin/chain/output_point.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/error.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+/**
+ * Interface to a store of previous outputs, queried in batches.
+ * A batch allows the store to order and overlap its reads, where a lookup
+ * per input is bound by the latency of each.
+ */
+class BC_API prevout_source
+{
+public:
+    virtual ~prevout_source() {}
+
+    /// Populate the metadata of each of the distinct and sorted points.
+    /// The metadata cache of a point that is not found is left invalid.
+    /// Return an error only if the store fails, not for a missing point.
+    virtual code populate(const output_point::list& points) = 0;
+};
+
+} // namespace chain
+} // namespace libbitcoin
+
+#endif
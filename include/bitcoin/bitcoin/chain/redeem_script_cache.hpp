@@ -0,0 +1,123 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHAIN_REDEEM_SCRIPT_CACHE_HPP
+#define LIBBITCOIN_CHAIN_REDEEM_SCRIPT_CACHE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <bitcoin/bitcoin/chain/script.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/math/salted_hash.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+#include <bitcoin/bitcoin/utility/sharded_map.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+/**
+ * A bounded map of P2SH script hashes (hash160) to their decoded redeem
+ * scripts and accurate sigop counts. Popular redeem scripts (such as the
+ * multisig templates of a custodian) recur across many inputs, so this
+ * saves the parse and decode of each recurrence. Cached scripts are const
+ * and shared, so they may be evaluated by any number of threads. An entry
+ * is found only if its serialization matches that of the caller. Entries
+ * are partitioned over independently-locked shards (see sharded_map), and
+ * when full entries are evicted for each insertion. A zero byte budget
+ * disables the cache. This class is thread safe.
+ */
+class BC_API redeem_script_cache
+  : noncopyable
+{
+public:
+    typedef std::shared_ptr<const script> script_ptr;
+
+    struct entry
+    {
+        script_ptr script;
+        size_t sigops;
+    };
+
+    /// The approximate memory cost of an entry excluding its script heap.
+    static const size_t entry_overhead;
+
+    /// The cache consulted by script::verify and input sigop counting,
+    /// disabled by default. Enable by resize, this is shared by all threads
+    /// of the process.
+    static redeem_script_cache& redeem_scripts();
+
+    /// The key of a P2SH prevout script (its script hash), false if not P2SH.
+    static bool to_key(short_hash& out, const script& prevout_script);
+
+    /// Construct a cache limited to the given number of bytes.
+    redeem_script_cache(size_t maximum_bytes=0);
+
+    /// Find the decoded script of the hash with the given serialization.
+    bool find(entry& out, const short_hash& hash, data_slice bytes) const;
+
+    /// Record the script of the hash, decoded and counted here if not cached.
+    void insert(const short_hash& hash, script_ptr script);
+
+    /// Change the byte budget, evicting entries as necessary.
+    void resize(size_t maximum_bytes);
+
+    /// Remove all entries, counters are retained.
+    void clear();
+
+    /// The cache has a non-zero budget.
+    bool enabled() const;
+
+    /// The number of entries.
+    size_t size() const;
+
+    /// The approximate number of bytes consumed by entries.
+    size_t bytes() const;
+
+    /// The maximum number of bytes consumed by entries.
+    size_t capacity() const;
+
+    /// The number of find() calls that found an entry.
+    uint64_t hits() const;
+
+    /// The number of find() calls that did not find an entry.
+    uint64_t misses() const;
+
+    /// The number of entries evicted to make room.
+    uint64_t evictions() const;
+
+    /// The proportion of find() calls that found an entry, zero if none.
+    float hit_rate() const;
+
+private:
+    typedef sharded_map<short_hash, entry, salted_hash<short_hash>> entries;
+
+    // These count only finds confirmed by serialization.
+    mutable std::atomic<uint64_t> hits_;
+    mutable std::atomic<uint64_t> misses_;
+
+    entries entries_;
+};
+
+} // namespace chain
+} // namespace libbitcoin
+
+#endif
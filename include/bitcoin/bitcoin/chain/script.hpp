@@ -28,11 +28,16 @@
 #include <bitcoin/bitcoin/define.hpp>
 #include <bitcoin/bitcoin/error.hpp>
 #include <bitcoin/bitcoin/math/elliptic_curve.hpp>
+#include <bitcoin/bitcoin/math/signature_cache.hpp>
+#include <bitcoin/bitcoin/machine/instruction.hpp>
 #include <bitcoin/bitcoin/machine/operation.hpp>
 #include <bitcoin/bitcoin/machine/rule_fork.hpp>
 #include <bitcoin/bitcoin/machine/script_pattern.hpp>
+#include <bitcoin/bitcoin/machine/script_profile.hpp>
 #include <bitcoin/bitcoin/machine/script_version.hpp>
+#include <bitcoin/bitcoin/machine/verification_context.hpp>
 #include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/once_cell.hpp>
 #include <bitcoin/bitcoin/utility/reader.hpp>
 #include <bitcoin/bitcoin/utility/thread.hpp>
 #include <bitcoin/bitcoin/utility/writer.hpp>
@@ -46,10 +51,12 @@ class witness;
 class BC_API script
 {
 public:
+    typedef machine::instruction instruction;
     typedef machine::operation operation;
     typedef machine::rule_fork rule_fork;
     typedef machine::script_pattern script_pattern;
     typedef machine::script_version script_version;
+    typedef machine::verification_context verification_context;
 
     // Constructors.
     //-------------------------------------------------------------------------
@@ -87,6 +94,11 @@ public:
     bool from_data(std::istream& stream, bool prefix);
     bool from_data(reader& source, bool prefix);
 
+    /// Deserialize the compact form written by to_compact.
+    bool from_compact(const data_chunk& encoded);
+    bool from_compact(std::istream& stream);
+    bool from_compact(reader& source);
+
     /// Deserialization invalidates the iterator.
     void from_operations(operation::list&& ops);
     void from_operations(const operation::list& ops);
@@ -105,6 +117,12 @@ public:
     void to_data(std::ostream& stream, bool prefix) const;
     void to_data(writer& sink, bool prefix) const;
 
+    /// Serialize for storage, in which each standard payment template is
+    /// reduced to a code and its hash, and other scripts are sized by code.
+    data_chunk to_compact() const;
+    void to_compact(std::ostream& stream) const;
+    void to_compact(writer& sink) const;
+
     std::string to_string(uint32_t active_forks) const;
 
     // Iteration.
@@ -123,8 +141,19 @@ public:
     //-------------------------------------------------------------------------
 
     size_t serialized_size(bool prefix) const;
+    size_t compact_size() const;
+
+    /// Heap bytes of the script and its decoded caches, excluding sizeof.
+    size_t heap_size() const;
+
     const operation::list& operations() const;
 
+    /// The serialized script, without the size prefix.
+    const data_chunk& bytes() const;
+
+    /// Compact decoding of the script bytes, no push data is copied.
+    const instruction::list& instructions() const;
+
     // Signing.
     //-------------------------------------------------------------------------
 
@@ -134,11 +163,20 @@ public:
         uint64_t value=max_uint64);
 
     static bool check_signature(const ec_signature& signature,
-        uint8_t sighash_type, const data_chunk& public_key,
+        uint8_t sighash_type, data_slice public_key,
         const script& script_code, const transaction& tx, uint32_t input_index,
         script_version version=script_version::unversioned,
         uint64_t value=max_uint64);
 
+    /// Successful checks consulted by check_signature, disabled by default.
+    /// Enable by resize, this is shared by all threads of the process.
+    static signature_cache& verified_signatures();
+
+    /// Add the count and duration of each signature check made on the
+    /// calling thread to the metrics, until detached by nullptr.
+    static void record_signatures(
+        machine::script_profile::operation_metrics* metrics);
+
     static bool create_endorsement(endorsement& out, const ec_secret& secret,
         const script& prevout_script, const transaction& tx,
         uint32_t input_index, uint8_t sighash_type,
@@ -166,6 +204,13 @@ public:
     static bool is_commitment_pattern(const operation::list& ops);
     static bool is_witness_program_pattern(const operation::list& ops);
 
+    /// Consensus patterns (compact), data is referenced in the script bytes.
+    static bool is_relaxed_push(const instruction::list& ops);
+    static bool is_witness_program_pattern(const instruction::list& ops);
+    static bool is_pay_multisig_pattern(const instruction::list& ops,
+        const data_chunk& bytes);
+    static bool is_pay_key_hash_pattern(const instruction::list& ops);
+    static bool is_pay_script_hash_pattern(const instruction::list& ops);
 
     /// Common output patterns (psh and pwsh are also consensus).
     static bool is_pay_null_data_pattern(const operation::list& ops);
@@ -175,6 +220,21 @@ public:
     static bool is_pay_script_hash_pattern(const operation::list& ops);
     static bool is_pay_witness_script_hash_pattern(const operation::list& ops);
 
+    /// Common output patterns (serialized), matched on the script bytes
+    /// without decoding. Any hash or key is returned as a view of bytes.
+    static bool is_pay_null_data_pattern(data_slice bytes);
+    static bool is_pay_public_key_pattern(data_slice& out_key,
+        data_slice bytes);
+    static bool is_pay_key_hash_pattern(data_slice& out_hash,
+        data_slice bytes);
+    static bool is_pay_script_hash_pattern(data_slice& out_hash,
+        data_slice bytes);
+    static bool is_pay_witness_script_hash_pattern(data_slice& out_hash,
+        data_slice bytes);
+
+    /// Count sigops on the serialized script, without an operation list.
+    static size_t sigops(data_slice bytes, bool accurate);
+
     /// Common input patterns (skh is also consensus).
     static bool is_sign_multisig_pattern(const operation::list& ops);
     static bool is_sign_public_key_pattern(const operation::list& ops);
@@ -201,7 +261,7 @@ public:
     script_pattern input_pattern() const;
     script_pattern output_pattern() const;
 
-    /// Consensus computations.
+    /// Consensus computations, the inaccurate (legacy) count is cached.
     size_t sigops(bool accurate) const;
     void find_and_delete(const data_stack& endorsements);
     bool is_unspendable() const;
@@ -216,6 +276,28 @@ public:
     static code verify(const transaction& tx, uint32_t input_index,
         uint32_t forks, const script& prevout_script, uint64_t value);
 
+    /// As above, with program stacks reused from the verification context.
+    static code verify(const transaction& tx, uint32_t input_index,
+        uint32_t forks, verification_context& context);
+
+    static code verify(const transaction& tx, uint32_t input_index,
+        uint32_t forks, const script& prevout_script, uint64_t value,
+        verification_context& context);
+
+    /// Straight-line verification of p2pkh, p2wpkh, p2sh-p2wpkh and bare
+    /// multisig. False means only that the input was not verified here.
+    static bool verify_standard(const transaction& tx, uint32_t input_index,
+        uint32_t forks, const script& prevout_script, uint64_t value);
+
+    /// Verification by the script interpreter alone (no standard paths).
+    static code verify_interpreted(const transaction& tx,
+        uint32_t input_index, uint32_t forks, const script& prevout_script,
+        uint64_t value);
+
+    static code verify_interpreted(const transaction& tx,
+        uint32_t input_index, uint32_t forks, const script& prevout_script,
+        uint64_t value, verification_context& context);
+
 protected:
     // So that input and output may call reset from their own.
     friend class input;
@@ -237,13 +319,12 @@ private:
 
     void find_and_delete_(const data_chunk& endorsement);
 
-    operation::list& operations_move();
-    const operation::list& operations_copy() const;
+    // Decoded from bytes_ on first use.
+    once_cell<operation::list> operations_;
+    once_cell<instruction::list> instructions_;
 
-    // These are protected by mutex.
-    mutable operation::list operations_;
-    mutable bool cached_;
-    mutable upgrade_mutex mutex_;
+    // Counted by deserialization or on first use.
+    once_cell<size_t> legacy_sigops_;
 
     data_chunk bytes_;
     bool valid_;
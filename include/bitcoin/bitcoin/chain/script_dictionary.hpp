@@ -0,0 +1,81 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHAIN_SCRIPT_DICTIONARY_HPP
+#define LIBBITCOIN_CHAIN_SCRIPT_DICTIONARY_HPP
+
+#include <cstddef>
+#include <map>
+#include <vector>
+#include <bitcoin/bitcoin/chain/block.hpp>
+#include <bitcoin/bitcoin/chain/script.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+/**
+ * A table of frequent output scripts, referenced by position from a block
+ * archive in place of the script. The table is trained once on a sample of
+ * blocks and must be retained (as to_data) to decode archives encoded with it.
+ *
+ * [count][script size][script bytes]... with counts and sizes in base 128.
+ */
+class BC_API script_dictionary
+{
+public:
+    typedef std::vector<data_chunk> list;
+
+    /// The most scripts referenced in two bytes (by position plus one).
+    static BC_CONSTEXPR size_t default_size = 16383;
+
+    /// Select the output scripts of the sample that occur more than once, in
+    /// order of descending frequency (then by bytes), up to the size.
+    static script_dictionary train(const block::list& sample,
+        size_t size=default_size);
+
+    /// Construct an empty dictionary.
+    script_dictionary();
+
+    /// Construct a dictionary of the distinct scripts, in order.
+    script_dictionary(list&& scripts);
+
+    bool from_data(const data_chunk& data);
+    data_chunk to_data() const;
+
+    size_t size() const;
+    bool empty() const;
+
+    /// The position of the script bytes, or size() if not present.
+    size_t find(const data_chunk& script) const;
+
+    /// The script at the position, which must be less than size().
+    script at(size_t position) const;
+
+private:
+    void index();
+
+    list scripts_;
+    std::map<data_chunk, size_t> positions_;
+};
+
+} // namespace chain
+} // namespace libbitcoin
+
+#endif
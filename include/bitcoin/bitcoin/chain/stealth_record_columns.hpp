@@ -0,0 +1,104 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHAIN_STEALTH_RECORD_COLUMNS_HPP
+#define LIBBITCOIN_CHAIN_STEALTH_RECORD_COLUMNS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <bitcoin/bitcoin/chain/stealth_record.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/utility/binary.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/reader.hpp>
+#include <bitcoin/bitcoin/utility/writer.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+/// This class models a columnar serialization of a set of stealth records.
+/// The set header carries the row count, height range and body size. The
+/// body holds delta encoded heights followed by the fixed width columns of
+/// prefixes, ephemeral keys, public key hashes and transaction hashes, so
+/// rows are selected by height and prefix before any hash is read.
+class BC_API stealth_record_columns
+{
+public:
+    // Constructors.
+    //-------------------------------------------------------------------------
+
+    stealth_record_columns();
+
+    stealth_record_columns(stealth_record_columns&& other);
+    stealth_record_columns(const stealth_record_columns& other);
+
+    stealth_record_columns(stealth_record::list&& records);
+    stealth_record_columns(const stealth_record::list& records);
+
+    // Operators.
+    //-------------------------------------------------------------------------
+
+    stealth_record_columns& operator=(stealth_record_columns&& other);
+    stealth_record_columns& operator=(const stealth_record_columns& other);
+
+    bool operator==(const stealth_record_columns& other) const;
+    bool operator!=(const stealth_record_columns& other) const;
+
+    // Deserialization.
+    //-------------------------------------------------------------------------
+
+    static stealth_record_columns factory(const data_chunk& data);
+    static stealth_record_columns factory(std::istream& stream);
+    static stealth_record_columns factory(reader& source);
+
+    bool from_data(const data_chunk& data);
+    bool from_data(std::istream& stream);
+    bool from_data(reader& source);
+
+    /// Read only the records at or above the height that match the filter.
+    /// A set entirely below the height is skipped without reading its body.
+    bool from_data(reader& source, size_t start_height, const binary& filter);
+
+    bool is_valid() const;
+
+    // Serialization.
+    //-------------------------------------------------------------------------
+
+    data_chunk to_data() const;
+    void to_data(std::ostream& stream) const;
+    void to_data(writer& sink) const;
+
+    // Properties (size, accessors).
+    //-------------------------------------------------------------------------
+
+    size_t serialized_size() const;
+    const stealth_record::list& records() const;
+
+protected:
+    void reset();
+
+private:
+    bool valid_;
+    stealth_record::list records_;
+};
+
+} // namespace chain
+} // namespace libbitcoin
+
+#endif
@@ -30,12 +30,17 @@
 #include <bitcoin/bitcoin/chain/input.hpp>
 #include <bitcoin/bitcoin/chain/output.hpp>
 #include <bitcoin/bitcoin/chain/point.hpp>
+#include <bitcoin/bitcoin/chain/script_cache.hpp>
 #include <bitcoin/bitcoin/define.hpp>
 #include <bitcoin/bitcoin/error.hpp>
 #include <bitcoin/bitcoin/math/elliptic_curve.hpp>
 #include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/math/muhash.hpp>
 #include <bitcoin/bitcoin/machine/opcode.hpp>
 #include <bitcoin/bitcoin/machine/rule_fork.hpp>
+#include <bitcoin/bitcoin/machine/verification_context.hpp>
+#include <bitcoin/bitcoin/utility/cold_ptr.hpp>
+#include <bitcoin/bitcoin/utility/once_cell.hpp>
 #include <bitcoin/bitcoin/utility/reader.hpp>
 #include <bitcoin/bitcoin/utility/thread.hpp>
 #include <bitcoin/bitcoin/utility/writer.hpp>
@@ -43,10 +48,14 @@
 namespace libbitcoin {
 namespace chain {
 
+struct sighash_precompute;
+
 class BC_API transaction
 {
 public:
     typedef std::vector<transaction> list;
+    typedef std::shared_ptr<const sighash_precompute> sighash_precompute_ptr;
+    typedef std::shared_ptr<const data_chunk> encoding_ptr;
 
     // THIS IS FOR LIBRARY USE ONLY, DO NOT CREATE A DEPENDENCY ON IT.
     struct validation
@@ -85,6 +94,9 @@ public:
 
     transaction();
 
+    /// A copy shares the inputs and outputs (and so the previous output
+    /// metadata of the inputs) with the original, until either modifies
+    /// them. So a pooled transaction is cheaply copied into a block.
     transaction(transaction&& other);
     transaction(const transaction& other);
 
@@ -113,6 +125,9 @@ public:
     static transaction factory(reader& source, hash_digest&& hash,bool wire=true, bool witness=false);
     static transaction factory(reader& source, const hash_digest& hash,bool wire=true, bool witness=false);
 
+    // Wire deserialization retaining the encoding (see below).
+    static transaction factory(encoding_ptr data, size_t offset=0, bool witness=false, bool lazy=false);
+
     bool from_data(const data_chunk& data, bool wire=true, bool witness=false);
     bool from_data(std::istream& stream, bool wire=true, bool witness=false);
     bool from_data(reader& source, bool wire=true, bool witness=false);
@@ -121,6 +136,24 @@ public:
     bool from_data(reader& source, hash_digest&& hash, bool wire=true, bool witness=false);
     bool from_data(reader& source, const hash_digest& hash, bool wire=true, bool witness=false);
 
+    /// Wire deserialization from the offset of a shared buffer, retaining a
+    /// reference to the consumed bytes. Wire serialization, sizing and hashing
+    /// reuse the retained bytes until the transaction is changed, which
+    /// releases them. A witness that is not read is not reused. A lazy
+    /// witness refers to the retained bytes and is parsed upon first access
+    /// to its stack, so a consumer that does not access it does not parse
+    /// or allocate it (see witness::is_deferred).
+    bool from_data(encoding_ptr data, size_t offset=0, bool witness=false,
+        bool lazy=false);
+
+    /// Deserialize into this transaction, retaining the capacity of its input
+    /// and output lists and of their scripts and witnesses. So a transaction
+    /// that is repeatedly recycled (see transaction_pool) reaches a steady
+    /// state without allocation for typical sizes. Lists shared with a copy
+    /// are not changed, and are replaced.
+    bool recycle(const data_chunk& data, bool wire=true, bool witness=false);
+    bool recycle(reader& source, bool wire=true, bool witness=false);
+
     bool is_valid() const;
 
     // Serialization.
@@ -136,20 +169,34 @@ public:
     static size_t maximum_size(bool is_coinbase);
     size_t serialized_size(bool wire=true, bool witness=false) const;
 
+    /// The heap bytes owned by the transaction: its input and output vectors
+    /// and their elements, and the caches that are populated. The total
+    /// memory use is sizeof(transaction) plus this. Allocator overhead is not
+    /// included, and inputs, outputs or a cache shared with a copy are
+    /// counted by each.
+    size_t heap_size() const;
+
+    /// The retained wire encoding, empty if none is retained.
+    data_slice encoding() const;
+
+    /// True if the wire serialization (witness as specified, and disabled if
+    /// not segregated) is the retained encoding.
+    bool is_retained(bool witness) const;
+
     uint32_t version() const;
     void set_version(uint32_t value);
 
     uint32_t locktime() const;
     void set_locktime(uint32_t value);
 
-    // Deprecated (unsafe).
+    // Deprecated (unsafe), this detaches shared inputs.
     input::list& inputs();
 
     const input::list& inputs() const;
     void set_inputs(const input::list& value);
     void set_inputs(input::list&& value);
 
-    // Deprecated (unsafe).
+    // Deprecated (unsafe), this detaches shared outputs.
     output::list& outputs();
 
     const output::list& outputs() const;
@@ -161,6 +208,10 @@ public:
     hash_digest sequences_hash() const;
     hash_digest hash(bool witness=false) const;
 
+    // THIS IS FOR LIBRARY USE ONLY, DO NOT CREATE A DEPENDENCY ON IT.
+    /// Serialized segments and midstates common to all unversioned sighashes.
+    sighash_precompute_ptr sighash_precomputation() const;
+
     // Utilities.
     //-------------------------------------------------------------------------
 
@@ -171,6 +222,13 @@ public:
     //-------------------------------------------------------------------------
 
     uint64_t fees() const;
+
+    /// Apply the UTXO set change of the transaction, confirmed at the height,
+    /// to the set hash: spendable outputs are inserted and previous outputs
+    /// (which must be populated) removed. Elements are serialized as in the
+    /// bitcoind set hash: point, (height << 1 | coinbase) and output.
+    void utxo_delta(muhash& set, size_t height) const;
+
     point::list previous_outputs() const;
     point::list missing_previous_outputs() const;
     hash_list missing_previous_transactions() const;
@@ -180,6 +238,12 @@ public:
     size_t signature_operations(bool bip16, bool bip141) const;
     size_t weight() const;
 
+    /// The weight in virtual bytes, rounded up (bip141).
+    size_t virtual_size() const;
+
+    /// The fee in satoshis per thousand virtual bytes, rounded down.
+    uint64_t fee_rate() const;
+
     bool is_coinbase() const;
     bool is_null_non_coinbase() const;
     bool is_oversized_coinbase() const;
@@ -201,40 +265,73 @@ public:
     code connect(const chain_state& state) const;
     code connect_input(const chain_state& state, size_t input_index) const;
 
+    /// As above, with program stacks reused across inputs from the context.
+    code connect_input(const chain_state& state, size_t input_index,
+        machine::verification_context& context) const;
+
+    /// Inputs verified by connect_input, disabled by default.
+    /// Enable by resize, this is shared by all threads of the process.
+    static script_cache& verified_inputs();
+
     // THIS IS FOR LIBRARY USE ONLY, DO NOT CREATE A DEPENDENCY ON IT.
-    mutable validation metadata;
+    /// This is held out of line, allocated when first accessed.
+    mutable cold_ptr<validation> metadata;
 
 protected:
     void reset();
     void invalidate_cache() const;
+    size_t compute_size(bool wire, bool witness) const;
     bool all_inputs_final() const;
 
 private:
-    typedef std::shared_ptr<hash_digest> hash_ptr;
-    typedef boost::optional<uint64_t> optional_value;
+    typedef std::shared_ptr<input::list> input_list_ptr;
+    typedef std::shared_ptr<output::list> output_list_ptr;
 
-    hash_ptr hash_cache() const;
-    optional_value total_input_value_cache() const;
-    optional_value total_output_value_cache() const;
+    input::list& mutable_inputs();
+    output::list& mutable_outputs();
+    bool decode(reader& source, bool wire, bool witness, bool recycle,
+        const encoding_ptr& lazy);
+    void clear();
 
     uint32_t version_;
     uint32_t locktime_;
-    input::list inputs_;
-    output::list outputs_;
-
-    // These share a mutex as they are not expected to contend.
-    mutable hash_ptr hash_;
-    mutable hash_ptr witness_hash_;
-    mutable hash_ptr outputs_hash_;
-    mutable hash_ptr inpoints_hash_;
-    mutable hash_ptr sequences_hash_;
-    mutable upgrade_mutex hash_mutex_;
-
-    // These share a mutex as they are not expected to contend.
-    mutable optional_value total_input_value_;
-    mutable optional_value total_output_value_;
-    mutable boost::optional<bool> segregated_;
-    mutable upgrade_mutex mutex_;
+
+    // These are shared by copies, copied on write, null when empty.
+    input_list_ptr inputs_;
+    output_list_ptr outputs_;
+
+    // These are used only by witness commitment and signature hashing.
+    struct witness_cache
+    {
+        once_cell<hash_digest> witness_hash;
+        once_cell<hash_digest> outputs_hash;
+        once_cell<hash_digest> inpoints_hash;
+        once_cell<hash_digest> sequences_hash;
+        once_cell<sighash_precompute_ptr> sighash_precompute;
+    };
+
+    // These are computed on first use and reset by invalidation.
+    once_cell<hash_digest> hash_;
+    once_cell<size_t> base_size_;
+    once_cell<size_t> total_size_;
+    once_cell<uint64_t> total_input_value_;
+    once_cell<uint64_t> total_output_value_;
+    once_cell<bool> segregated_;
+
+    // The wire encoding from which the transaction was read, if retained.
+    struct retained
+    {
+        encoding_ptr data;
+        size_t offset;
+        size_t size;
+
+        // The encoding carries the witness marker, flag and witnesses.
+        bool witness;
+    };
+
+    // These are held out of line and released by invalidation.
+    mutable cold_ptr<witness_cache> witness_cache_;
+    cold_ptr<retained> retained_;
 };
 
 } // namespace chain
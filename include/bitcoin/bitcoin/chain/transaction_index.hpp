@@ -0,0 +1,202 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHAIN_TRANSACTION_INDEX_HPP
+#define LIBBITCOIN_CHAIN_TRANSACTION_INDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <boost/filesystem.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <bitcoin/bitcoin/chain/block.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+#include <bitcoin/bitcoin/utility/thread.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+/**
+ * Queries are thread safe, open and close are not.
+ * An immutable, read-only memory mapping of the locations of transactions
+ * (in block files) by transaction hash. Hashes are split into partitions of
+ * about partition_size, and each partition has a minimal perfect hash of
+ * its hashes (hash and displace), so a query reads the pilot of the bucket
+ * of the hash and then the record at its slot. Slots beyond the count of a
+ * partition are remapped to the free slots below it, which costs a third
+ * read for a few percent of hashes. A hash that is not stored is rejected
+ * by the hash of its record. The hash of the records is a partition-local
+ * perfect hash, so partitions are built independently and in parallel.
+ *
+ * [magic:4][version:4][count:8][partitions:4][zero:4]
+ * partitions: [record:8][pilot:8][remap:8][count:4][buckets:4][slots:4]
+ *     [seed:4]
+ * pilots: [pilot:4]
+ * remaps: [slot:4]
+ * records: [hash:32][offset:8][file:4][length:4]
+ *
+ * Integers are little-endian. Partition fields are the first of its records,
+ * pilots and remaps, which follow those of the preceding partitions, and
+ * the seed of its hash, which is advanced if a pilot is not found.
+ */
+class BC_API transaction_index
+  : noncopyable
+{
+public:
+    typedef boost::filesystem::path path;
+    typedef std::vector<path> paths;
+
+    /// The location of a transaction in a block file.
+    struct location
+    {
+        uint32_t file;
+        uint64_t offset;
+        uint32_t length;
+    };
+
+    struct entry
+    {
+        typedef std::vector<entry> list;
+
+        hash_digest hash;
+        transaction_index::location location;
+    };
+
+    /// The file magic ("txix" as written) and the version written.
+    static BC_CONSTEXPR uint32_t magic = 0x78697874;
+    static BC_CONSTEXPR uint32_t version = 1;
+
+    /// The size of the file prefix, a partition and a record.
+    static BC_CONSTEXPR size_t prefix_size = 24;
+    static BC_CONSTEXPR size_t partition_size = 40;
+    static BC_CONSTEXPR size_t record_size = 48;
+
+    /// The target number of hashes in a partition.
+    static BC_CONSTEXPR size_t partition_target = 65536;
+
+    /// Append the entry of each transaction of the block, which is
+    /// serialized (with witness) at the offset of the file.
+    static void collect(entry::list& out, const block& block, uint32_t file,
+        uint64_t offset);
+
+    /// Write the entries to the file, replacing it, building partitions in
+    /// parallel. Of entries of the same hash the first is stored, so a
+    /// duplicated transaction is located at its first occurrence.
+    static bool store(const path& file, const entry::list& entries,
+        threadpool& pool);
+
+    /// Write the entries of the segments to the file, replacing it, as if
+    /// stored from the entries of each segment in order.
+    static bool merge(const path& file, const paths& segments,
+        threadpool& pool);
+
+    /// Construct a closed index.
+    transaction_index();
+
+    /// Map the file, false if it cannot be opened or is not an index file.
+    bool open(const path& file);
+
+    /// Unmap the file.
+    void close();
+
+    bool is_open() const;
+
+    /// The number of transactions and of partitions.
+    size_t size() const;
+    size_t partitions() const;
+
+    /// Append the entry of each transaction, in the order stored.
+    void entries(entry::list& out) const;
+
+    /// Read the location of the transaction, false if not stored.
+    bool find(location& out, const hash_digest& hash) const;
+
+private:
+    struct partition
+    {
+        uint64_t record;
+        uint64_t pilot;
+        uint64_t remap;
+        uint32_t count;
+        uint32_t buckets;
+        uint32_t slots;
+        uint32_t seed;
+    };
+
+    partition read_partition(size_t position) const;
+    const uint8_t* data(uint64_t offset) const;
+
+    boost::iostreams::mapped_file_source file_;
+    size_t size_;
+    size_t partitions_;
+    uint64_t pilots_;
+    uint64_t remaps_;
+    uint64_t records_;
+};
+
+/**
+ * This class is thread safe.
+ * A set of transaction index segments, each built from a range of blocks,
+ * queried in the order added. Segments are merged into a single segment in
+ * the background (by the caller's thread) while queries continue, so that
+ * a query reads fewer segments.
+ */
+class BC_API transaction_index_set
+  : noncopyable
+{
+public:
+    typedef transaction_index::path path;
+
+    /// Construct an empty set.
+    transaction_index_set();
+
+    /// Open and add the segment after those added, false if it cannot be
+    /// opened.
+    bool add(const path& file);
+
+    /// Merge the segments (as of the call) into the file, and replace them
+    /// with it, preserving any segments added during the merge. False if
+    /// the merge or open of the file fails, in which case the set is
+    /// unchanged.
+    bool merge(const path& file, threadpool& pool);
+
+    /// The number of segments and of transactions (with duplicates).
+    size_t segments() const;
+    size_t size() const;
+
+    /// Read the location of the transaction from the first segment that
+    /// stores it, false if none.
+    bool find(transaction_index::location& out,
+        const hash_digest& hash) const;
+
+private:
+    typedef std::shared_ptr<transaction_index> segment;
+    typedef std::vector<segment> list;
+
+    list segments_;
+    mutable shared_mutex mutex_;
+};
+
+} // namespace chain
+} // namespace libbitcoin
+
+#endif
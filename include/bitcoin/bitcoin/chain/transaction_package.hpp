@@ -0,0 +1,98 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHAIN_TRANSACTION_PACKAGE_HPP
+#define LIBBITCOIN_CHAIN_TRANSACTION_PACKAGE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <bitcoin/bitcoin/chain/chain_state.hpp>
+#include <bitcoin/bitcoin/chain/output_point.hpp>
+#include <bitcoin/bitcoin/chain/prevout_source.hpp>
+#include <bitcoin/bitcoin/chain/transaction.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+/**
+ * A set of unconfirmed transactions validated together, such as a child and
+ * the parents that it pays for. Transactions are ordered by their depth in
+ * the graph of spends within the package, so that each follows its package
+ * parents, and transactions of equal depth (a level) are independent.
+ * Previous outputs within the package are populated in memory and the
+ * others from a store. Each level is validated in parallel, and a
+ * transaction is not validated if any of its package parents fails.
+ */
+class BC_API transaction_package
+{
+public:
+    typedef std::vector<code> codes;
+
+    /// Order the transactions by depth, otherwise retaining their order.
+    transaction_package(const transaction::list& transactions);
+    transaction_package(transaction::list&& transactions);
+
+    /// The transactions, in order of depth.
+    const transaction::list& transactions() const;
+
+    /// The number of levels of transactions.
+    size_t levels() const;
+
+    /// The positions of the package parents of the transaction at position.
+    const std::vector<size_t>& parents(size_t position) const;
+
+    /// The distinct and sorted previous outputs not of the package.
+    output_point::list missing_previous_outputs() const;
+
+    /// Populate previous outputs of the package as unconfirmed outputs at
+    /// the state height, and others from the source.
+    code populate_previous_outputs(const chain_state& state,
+        prevout_source& source) const;
+
+    /// Check, accept and connect each transaction for the pool, with its
+    /// previous outputs populated. Results are in order of transactions().
+    /// A repeated transaction is duplicate_transaction, a second spend of
+    /// an output within the package is double_spend, and a transaction of
+    /// which a package parent fails is orphan_transaction.
+    codes validate(const chain_state& state, uint64_t max_money) const;
+    codes validate(const chain_state& state, uint64_t max_money,
+        threadpool& pool) const;
+
+private:
+    void order(transaction::list&& transactions);
+    code validate(size_t position, const chain_state& state,
+        uint64_t max_money, const codes& results) const;
+
+    transaction::list transactions_;
+    std::vector<std::vector<size_t>> parents_;
+
+    // The end position of each level.
+    std::vector<size_t> levels_;
+
+    // Failures determined by the graph, success otherwise.
+    codes conflicts_;
+};
+
+} // namespace chain
+} // namespace libbitcoin
+
+#endif
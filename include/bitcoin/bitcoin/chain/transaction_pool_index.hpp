@@ -0,0 +1,181 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHAIN_TRANSACTION_POOL_INDEX_HPP
+#define LIBBITCOIN_CHAIN_TRANSACTION_POOL_INDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <set>
+#include <vector>
+#include <bitcoin/bitcoin/chain/chain_state.hpp>
+#include <bitcoin/bitcoin/chain/output_point.hpp>
+#include <bitcoin/bitcoin/chain/transaction.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/flat_hash_map.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+/**
+ * An index of unconfirmed transactions, keyed by hash and by each spent
+ * output point. Each entry holds the totals of its in-pool ancestors and of
+ * its in-pool descendants (each including itself), which are updated on
+ * insert and remove by visiting only the related entries. Entries are held
+ * in a vector of slots, reused after removal, and ordered both by descendant
+ * fee rate for eviction and by ancestor fee rate for mining. A transaction
+ * must be inserted after its in-pool parents. This class is not thread safe.
+ */
+class BC_API transaction_pool_index
+  : noncopyable
+{
+public:
+    /// The totals of a set of related transactions.
+    struct totals
+    {
+        size_t count;
+        size_t size;
+        uint64_t fees;
+        size_t sigops;
+    };
+
+    struct entry
+    {
+        transaction tx;
+        hash_digest hash;
+
+        /// The virtual size of the transaction.
+        size_t size;
+        uint64_t fee;
+        size_t sigops;
+
+        /// The transaction and its in-pool ancestors.
+        totals ancestors;
+
+        /// The transaction and its in-pool descendants.
+        totals descendants;
+    };
+
+    typedef std::vector<const entry*> entries;
+
+    /// Handler of an entry, return false to stop the visit.
+    typedef std::function<bool(const entry&)> visitor;
+
+    /// Construct an empty index, with space for the number of transactions.
+    transaction_pool_index(size_t capacity=0);
+
+    /// Add the transaction with its fee and signature operations.
+    /// False if present or if it spends an output spent by the pool.
+    bool insert(const transaction& tx, uint64_t fee, size_t sigops);
+
+    /// Add the transaction, with previous outputs populated, computing its
+    /// fee and signature operations under the rules of the state.
+    bool insert(const transaction& tx, const chain_state& state);
+
+    /// Remove the transaction and its descendants, returning the number
+    /// removed (zero if not present).
+    size_t erase(const hash_digest& hash);
+
+    /// Remove the transaction as confirmed, retaining its descendants.
+    /// False if not present or if any of its parents is in the pool.
+    bool confirm(const hash_digest& hash);
+
+    /// Remove the transaction of lowest descendant fee rate with its
+    /// descendants, returning the number removed (zero if empty).
+    size_t evict();
+
+    /// The transaction of lowest descendant fee rate, nullptr if empty.
+    const entry* lowest() const;
+
+    /// The entry of the transaction, nullptr if not present.
+    const entry* find(const hash_digest& hash) const;
+
+    /// The entry of the transaction spending the point, nullptr if none.
+    const entry* spender(const output_point& point) const;
+
+    /// The in-pool ancestors of the entry, excluding itself.
+    entries ancestors(const entry& value) const;
+
+    /// The in-pool descendants of the entry, excluding itself.
+    entries descendants(const entry& value) const;
+
+    /// Invoke the handler for each entry in order of highest ancestor fee
+    /// rate, false if stopped by the handler. Entry pointers are valid until
+    /// the index is changed.
+    bool visit(visitor handler) const;
+
+    /// The number of transactions.
+    size_t size() const;
+    bool empty() const;
+
+    /// The total virtual size of the transactions.
+    size_t virtual_size() const;
+
+private:
+    typedef uint32_t slot;
+    typedef std::vector<slot> slots;
+
+    struct node
+    {
+        entry value;
+        slots parents;
+        slots children;
+        mutable uint32_t mark;
+        bool live;
+    };
+
+    // Orders by the fee rate of the totals, then by slot.
+    class lower_rate
+    {
+    public:
+        lower_rate(const std::vector<node>& nodes, totals entry::* aggregate);
+        bool operator()(slot left, slot right) const;
+
+    private:
+        const std::vector<node>& nodes_;
+        totals entry::* aggregate_;
+    };
+
+    typedef std::set<slot, lower_rate> ordering;
+
+    void advance() const;
+    slots ancestors(slot position) const;
+    slots descendants(slot position) const;
+    entries to_entries(const slots& positions) const;
+    void add(totals& to, const entry& value) const;
+    void subtract(totals& from, const entry& value) const;
+    void remove(const slots& positions);
+    void release(slot position);
+
+    std::vector<node> nodes_;
+    slots free_;
+    flat_hash_map<hash_digest, slot> hashes_;
+    flat_hash_map<output_point, slot> spends_;
+    ordering rates_;
+    ordering mining_;
+    mutable uint32_t epoch_;
+    size_t virtual_size_;
+};
+
+} // namespace chain
+} // namespace libbitcoin
+
+#endif
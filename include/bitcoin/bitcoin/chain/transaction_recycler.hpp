@@ -0,0 +1,81 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHAIN_TRANSACTION_RECYCLER_HPP
+#define LIBBITCOIN_CHAIN_TRANSACTION_RECYCLER_HPP
+
+#include <cstddef>
+#include <memory>
+#include <bitcoin/bitcoin/chain/transaction.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+/**
+ * A bounded free list of transactions for decoding with transaction::recycle.
+ * A transaction acquired here returns to the free list when released, so a
+ * relay worker that decodes into acquired transactions reuses the capacity
+ * of their lists, scripts and witnesses. Acquisition and release do not
+ * allocate once the free list is populated. A released transaction is
+ * deleted if the free list is full or the recycler has been destroyed. This
+ * class is thread safe.
+ */
+class BC_API transaction_recycler
+  : noncopyable
+{
+private:
+    struct state;
+
+public:
+    /// Returns a transaction to the recycler that it was acquired from.
+    class BC_API releaser
+    {
+    public:
+        releaser();
+        releaser(std::weak_ptr<state> owner);
+        void operator()(transaction* value) const;
+
+    private:
+        std::weak_ptr<state> owner_;
+    };
+
+    typedef std::unique_ptr<transaction, releaser> ptr;
+
+    /// Construct a recycler that retains up to capacity free transactions.
+    transaction_recycler(size_t capacity);
+
+    /// A free transaction, or a new one if there is none.
+    /// The value is stale until decoded with transaction::recycle.
+    ptr acquire();
+
+    /// The number of free transactions.
+    size_t size() const;
+
+    /// The maximum number of free transactions.
+    size_t capacity() const;
+
+private:
+    std::shared_ptr<state> state_;
+};
+
+} // namespace chain
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,95 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHAIN_TRANSACTION_SIGNER_HPP
+#define LIBBITCOIN_CHAIN_TRANSACTION_SIGNER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <bitcoin/bitcoin/chain/script.hpp>
+#include <bitcoin/bitcoin/chain/transaction.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/math/elliptic_curve.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+/**
+ * A batch of input endorsements of one transaction. The signature hash
+ * serializations shared by the inputs (the bip143 hashes and the legacy
+ * sighash_all midstates) are computed once, before the inputs are signed,
+ * and each input is then hashed and signed independently (RFC6979 nonce and
+ * ECDSA), optionally on a threadpool. The transaction must outlive the
+ * signer and must not be modified while signing.
+ */
+class BC_API transaction_signer
+{
+public:
+    typedef std::vector<endorsement> endorsements;
+
+    /// The secret and previous output of an input to be endorsed.
+    struct signing_input
+    {
+        uint32_t index;
+        ec_secret secret;
+        script prevout_script;
+        uint8_t sighash_type;
+        script::script_version version;
+        uint64_t value;
+    };
+
+    typedef std::vector<signing_input> signing_inputs;
+
+    explicit transaction_signer(const transaction& tx);
+
+    /// Queue the endorsement of the input at index, as create_endorsement.
+    void add(uint32_t index, const ec_secret& secret,
+        const script& prevout_script, uint8_t sighash_type,
+        script::script_version version=script::script_version::unversioned,
+        uint64_t value=max_uint64);
+
+    /// The queued inputs, in order of addition.
+    const signing_inputs& inputs() const;
+
+    /// The number of queued inputs.
+    size_t size() const;
+
+    /// Clear all queued inputs.
+    void clear();
+
+    /// Endorse each queued input, in order of addition. False if any input
+    /// index is invalid or any signature fails, in which case out is empty.
+    bool sign(endorsements& out) const;
+
+    /// As sign(), signing concurrently on the pool and calling thread.
+    bool sign(endorsements& out, threadpool& pool) const;
+
+private:
+    void precompute() const;
+    bool sign(endorsement& out, size_t position) const;
+
+    const transaction& tx_;
+    signing_inputs inputs_;
+};
+
+} // namespace chain
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,169 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHAIN_TRANSACTION_VIEW_HPP
+#define LIBBITCOIN_CHAIN_TRANSACTION_VIEW_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/bitcoin/chain/transaction.hpp>
+#include <bitcoin/bitcoin/chain/view_list.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+/// Views borrow the underlying buffer, which must outlive them and any
+/// slices they return. Views never allocate, conversion to owning objects
+/// does. An invalid view has no data and its other properties are zero.
+
+/// Read-only view of a wire serialized transaction input.
+class BC_API input_view
+{
+public:
+    input_view();
+
+    /// Parse the input at the front of the buffer.
+    explicit input_view(data_slice data);
+
+    bool is_valid() const;
+
+    /// The serialized input.
+    data_slice data() const;
+
+    /// The 36 byte serialized previous output point.
+    data_slice previous_output() const;
+    hash_digest previous_output_hash() const;
+    uint32_t previous_output_index() const;
+
+    /// The script, excluding its size prefix.
+    data_slice script() const;
+    uint32_t sequence() const;
+
+private:
+    const uint8_t* begin_;
+    const uint8_t* script_;
+    const uint8_t* end_;
+};
+
+/// Read-only view of a wire serialized transaction output.
+class BC_API output_view
+{
+public:
+    output_view();
+
+    /// Parse the output at the front of the buffer.
+    explicit output_view(data_slice data);
+
+    bool is_valid() const;
+
+    /// The serialized output.
+    data_slice data() const;
+    uint64_t value() const;
+
+    /// The script, excluding its size prefix.
+    data_slice script() const;
+
+private:
+    const uint8_t* begin_;
+    const uint8_t* script_;
+    const uint8_t* end_;
+};
+
+/// Read-only view of a wire serialized input witness (bip144).
+class BC_API witness_view
+{
+public:
+    witness_view();
+
+    /// Parse the witness at the front of the buffer.
+    explicit witness_view(data_slice data);
+
+    bool is_valid() const;
+
+    /// The serialized witness, including its element count prefix.
+    data_slice data() const;
+
+    /// The number of stack elements.
+    size_t size() const;
+
+    /// The element at the stack index, walks the witness (not for loops).
+    data_slice element(size_t index) const;
+
+private:
+    const uint8_t* begin_;
+    const uint8_t* end_;
+    size_t count_;
+};
+
+/// Read-only view of a wire serialized transaction, parsed over borrowed
+/// memory. Construction validates the framing of the entire transaction.
+class BC_API transaction_view
+{
+public:
+    typedef view_list<input_view> input_views;
+    typedef view_list<output_view> output_views;
+    typedef view_list<witness_view> witness_views;
+
+    transaction_view();
+
+    /// Parse the transaction at the front of the buffer.
+    explicit transaction_view(data_slice data);
+
+    bool is_valid() const;
+
+    /// True if serialized with witness marker and flag (bip144).
+    bool is_segregated() const;
+
+    /// The serialized transaction (witness, if present, included).
+    data_slice data() const;
+    size_t serialized_size() const;
+
+    uint32_t version() const;
+    uint32_t locktime() const;
+
+    input_views inputs() const;
+    output_views outputs() const;
+
+    /// One witness per input if segregated, otherwise empty.
+    witness_views witnesses() const;
+
+    /// Hashes are computed over the underlying bytes, and are not cached.
+    hash_digest hash() const;
+    hash_digest witness_hash() const;
+
+    /// Deserialize an owning transaction, witness is stripped unless set.
+    transaction to_transaction(bool witness=false) const;
+
+private:
+    const uint8_t* begin_;
+    const uint8_t* inputs_;
+    const uint8_t* outputs_;
+    const uint8_t* witnesses_;
+    const uint8_t* end_;
+    size_t input_count_;
+    size_t output_count_;
+    bool segregated_;
+};
+
+} // namespace chain
+} // namespace libbitcoin
+
+#endif
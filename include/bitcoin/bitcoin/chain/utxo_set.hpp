@@ -0,0 +1,163 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHAIN_UTXO_SET_HPP
+#define LIBBITCOIN_CHAIN_UTXO_SET_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+#include <bitcoin/bitcoin/chain/block.hpp>
+#include <bitcoin/bitcoin/chain/output.hpp>
+#include <bitcoin/bitcoin/chain/output_point.hpp>
+#include <bitcoin/bitcoin/chain/prevout_source.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/math/siphash.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/large_page_allocator.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+/**
+ * A compact in-memory set of unspent outputs, keyed by output point.
+ * The table is open-addressed over eight byte slots, probed a cache line at
+ * a time, and located by a salted siphash of the point. Each slot refers to a
+ * variable-length record in paged storage, of the output in its compact
+ * form and the index and height as variable-length integers. Unspendable
+ * outputs are not stored. Erased records are reclaimed by compaction.
+ * This class is not thread safe.
+ */
+class BC_API utxo_set
+  : public prevout_source, noncopyable
+{
+public:
+    /// The number of table slots in one cache line.
+    static BC_CONSTEXPR size_t slots_per_line = 8;
+
+    /// Handler of a stored output, return false to stop the visit.
+    typedef std::function<bool(const output_point& point,
+        const output& output, size_t height, bool coinbase)> visitor;
+
+    /// Construct an empty set, with table space for the number of outputs.
+    utxo_set(size_t capacity=0);
+
+    /// Ensure table space for the number of outputs.
+    void reserve(size_t capacity);
+
+    /// Add the output, false if the point is already present.
+    /// An unspendable output is not stored, but is reported as added.
+    bool insert(const output_point& point, const output& output,
+        size_t height, bool coinbase);
+
+    /// Add an output given in its compact form, false if the point is
+    /// already present. The form must be canonical and spendable, as decoded
+    /// by output::from_compact, as it is stored without decoding.
+    bool insert_compact(const hash_digest& hash, uint32_t index,
+        const data_slice& compact, size_t height, bool coinbase);
+
+    /// Remove the output, false if the point is not present.
+    bool erase(const output_point& point);
+
+    /// Populate the output of the point, false if not present.
+    bool find(output& out_output, size_t& out_height, bool& out_coinbase,
+        const output_point& point) const;
+
+    /// True if the point is present.
+    bool contains(const output_point& point) const;
+
+    /// Invoke the handler for each output, ordered by point hash (as bytes)
+    /// and then index, false if stopped by the handler.
+    bool visit(visitor handler) const;
+
+    /// Add the spendable outputs of each transaction of the block.
+    /// A point already present is replaced, as required by the bip30
+    /// exception blocks.
+    void insert(const block& block, size_t height);
+
+    /// Remove the outputs spent by each non-coinbase input of the block.
+    /// Insert the block first, so that outputs spent within it are removed.
+    /// False if any spent output is not present, the others are removed.
+    bool erase(const block& block);
+
+    /// Populate each found point as confirmed, with its height and coinbase.
+    /// Median time past is not stored, and is left for the caller to set.
+    code populate(const output_point::list& points) override;
+
+    /// Remove all outputs and release all memory.
+    void clear();
+
+    /// The number of outputs.
+    size_t size() const;
+
+    /// The number of bytes allocated to the table and records.
+    size_t allocated() const;
+
+private:
+    // The tag is the upper half of the point hash, or a reserved state.
+    struct slot
+    {
+        uint32_t tag;
+        uint32_t offset;
+    };
+
+    // The table may be backed by huge pages, as configured by large_pages.
+    typedef std::vector<slot, large_page_allocator<slot>> table;
+
+    // Records are units of eight bytes, none span a page.
+    typedef std::unique_ptr<uint64_t[]> page;
+    typedef std::vector<page> pages;
+
+    uint64_t to_code(const hash_digest& hash) const;
+    static uint64_t to_code(uint64_t base, uint32_t index);
+    static uint32_t to_tag(uint64_t code);
+
+    slot* locate(uint64_t code, const hash_digest& hash,
+        uint32_t index) const;
+    uint8_t* emplace(uint64_t code, const hash_digest& hash, uint32_t index,
+        size_t height, bool coinbase, size_t compact_size, bool replace);
+    bool insert(uint64_t code, const hash_digest& hash, uint32_t index,
+        const output& output, size_t height, bool coinbase, bool replace);
+    void remove(slot& entry);
+
+    uint8_t* to_record(uint32_t offset) const;
+    uint32_t allocate(size_t bytes);
+    void rehash(size_t lines);
+    void compact();
+
+    siphash_key key_;
+    table storage_;
+    slot* slots_;
+    size_t lines_;
+    size_t live_;
+    size_t erased_;
+
+    pages pages_;
+    size_t cursor_;
+    size_t garbage_;
+};
+
+} // namespace chain
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,168 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHAIN_UTXO_SNAPSHOT_HPP
+#define LIBBITCOIN_CHAIN_UTXO_SNAPSHOT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include <boost/filesystem.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <bitcoin/bitcoin/chain/output.hpp>
+#include <bitcoin/bitcoin/chain/output_point.hpp>
+#include <bitcoin/bitcoin/chain/utxo_set.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/math/muhash.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+/**
+ * A snapshot of the unspent outputs as of a block, for loading in place of
+ * synchronizing to that block. Outputs are ordered by point hash (as bytes)
+ * and then index, and are written in chunks that are loaded independently.
+ *
+ * [magic:4][version:1][block hash:32][height:4]
+ * chunks: [payload size:4][outputs:4][sha256(payload):32][payload]
+ * trailer: [zero:4][outputs:8][set hash:32]
+ *
+ * A payload is a sequence of groups, one for each transaction hash present
+ * in the chunk, of [hash:32][outputs] and then each output as [index]
+ * [height:coinbase][compact output]. Counts and heights are base 128, and
+ * the index is the difference from the preceding index of the group, less
+ * one. The set hash is the muhash of the outputs, as transaction::utxo_delta.
+ */
+class BC_API utxo_snapshot
+  : noncopyable
+{
+public:
+    typedef boost::filesystem::path path;
+
+    /// The snapshot magic ("utxo" as written) and the version written.
+    static BC_CONSTEXPR uint32_t magic = 0x6f787475;
+    static BC_CONSTEXPR uint8_t version = 1;
+
+    /// Construct a closed snapshot.
+    utxo_snapshot();
+
+    /// Map the file and read its header and chunk frames, false if it cannot
+    /// be opened or is not a complete snapshot. Chunks are not verified.
+    bool open(const path& file);
+
+    /// Unmap the file.
+    void close();
+
+    bool is_open() const;
+
+    /// The block of the snapshot.
+    const hash_digest& block_hash() const;
+    size_t height() const;
+
+    /// The number of outputs and chunks.
+    size_t size() const;
+    size_t chunks() const;
+
+    /// The set hash of the outputs, as written.
+    const hash_digest& set_hash() const;
+
+    /// Insert the outputs into the set, decoding and verifying chunks in
+    /// parallel. Chunk hashes, output order and encoding, the output count
+    /// and the set hash are verified, and each point must not be in the
+    /// set. Upon failure the set retains any outputs inserted.
+    code load(utxo_set& set, threadpool& pool) const;
+
+private:
+    struct chunk
+    {
+        const uint8_t* frame;
+        size_t size;
+        size_t outputs;
+    };
+
+    bool read_frames(data_slice data);
+
+    boost::iostreams::mapped_file_source file_;
+    hash_digest block_hash_;
+    size_t height_;
+    uint64_t outputs_;
+    hash_digest set_hash_;
+    std::vector<chunk> chunks_;
+};
+
+/**
+ * This class is not thread safe.
+ * Writes a snapshot to a stream, outputs must be written in point order.
+ * A chunk is written once its payload reaches the chunk size.
+ */
+class BC_API utxo_snapshot_writer
+  : noncopyable
+{
+public:
+    /// The default payload size of a chunk.
+    static BC_CONSTEXPR size_t default_chunk_size = 1024 * 1024;
+
+    /// Write the header of the snapshot of the block.
+    utxo_snapshot_writer(std::ostream& stream, const hash_digest& block_hash,
+        size_t height, size_t chunk_size=default_chunk_size);
+
+    /// Write an output, false if unspendable, not following the preceding
+    /// point, finished or if the stream failed.
+    bool write(const output_point& point, const output& output,
+        size_t height, bool coinbase);
+
+    /// Write each output of the set, false if the stream failed.
+    bool write(const utxo_set& set);
+
+    /// Write the last chunk and the trailer, false if the stream failed.
+    bool finish();
+
+    /// The number of outputs written.
+    size_t size() const;
+
+private:
+    void close_group();
+    void write_chunk();
+
+    std::ostream& stream_;
+    const size_t chunk_size_;
+    muhash set_;
+    uint64_t outputs_;
+    bool finished_;
+
+    // The current chunk and transaction group.
+    data_chunk payload_;
+    data_chunk group_;
+    size_t chunk_outputs_;
+    size_t group_outputs_;
+    hash_digest hash_;
+    uint32_t index_;
+    bool empty_;
+    data_chunk element_;
+};
+
+} // namespace chain
+} // namespace libbitcoin
+
+#endif
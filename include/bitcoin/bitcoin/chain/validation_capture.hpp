@@ -0,0 +1,131 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHAIN_VALIDATION_CAPTURE_HPP
+#define LIBBITCOIN_CHAIN_VALIDATION_CAPTURE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <vector>
+#include <bitcoin/bitcoin/chain/block.hpp>
+#include <bitcoin/bitcoin/chain/chain_state.hpp>
+#include <bitcoin/bitcoin/chain/output_point.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/reader.hpp>
+#include <bitcoin/bitcoin/utility/writer.hpp>
+
+namespace libbitcoin {
+
+class settings;
+
+namespace chain {
+
+/**
+ * A block captured with everything required to replay its validation
+ * outside of the node: the witness serialized block, the previous output
+ * metadata of each of its non-coinbase inputs (in block order) and the
+ * chain state values and configured forks under which it was validated.
+ * Captures may be concatenated in a file and read until exhausted.
+ *
+ * [magic:4][version:1][block size][block]
+ * [forks:4][height][hash:32][bip9 bit0 hash:32][bip9 bit1 hash:32]
+ * [bits self:4][count][bits:4...][version self:4][count][versions:4...]
+ * [timestamp self:4][retarget:4][count][timestamps:4...]
+ * [inputs] and for each input [flags:1][height][median time past:4] and,
+ * if found, the previous output (wire serialized).
+ *
+ * Sizes, counts and heights are variable length. Flags are coinbase (1),
+ * found (2), confirmed (4), candidate (8) and spent (16).
+ */
+class BC_API validation_capture
+{
+public:
+    typedef std::vector<output_point::validation> prevouts;
+
+    /// The capture magic ("bcvc" as written) and the version written.
+    static BC_CONSTEXPR uint32_t magic = 0x63766362;
+    static BC_CONSTEXPR uint8_t version = 1;
+
+    // Constructors.
+    //-------------------------------------------------------------------------
+
+    validation_capture();
+
+    /// Capture the block, its previous outputs should be populated.
+    validation_capture(const block& block, const chain_state& state);
+
+    // Deserialization.
+    //-------------------------------------------------------------------------
+
+    static validation_capture factory(const data_chunk& data);
+    static validation_capture factory(std::istream& stream);
+    static validation_capture factory(reader& source);
+
+    bool from_data(const data_chunk& data);
+    bool from_data(std::istream& stream);
+    bool from_data(reader& source);
+
+    bool is_valid() const;
+
+    // Serialization.
+    //-------------------------------------------------------------------------
+
+    data_chunk to_data() const;
+    void to_data(std::ostream& stream) const;
+    void to_data(writer& sink) const;
+
+    // Properties.
+    //-------------------------------------------------------------------------
+
+    /// The witness serialized block.
+    const data_chunk& block_data() const;
+
+    /// The configured forks and chain state values.
+    uint32_t forks() const;
+    const chain_state::data& values() const;
+
+    /// The previous output metadata of each non-coinbase input.
+    const prevouts& previous_outputs() const;
+
+    // Replay.
+    //-------------------------------------------------------------------------
+
+    /// Deserialize the block (with witness) and populate the previous output
+    /// metadata of its inputs, false if invalid or not of the capture.
+    bool to_block(block& out) const;
+
+    /// The chain state of the capture. Checkpoints are not captured, so the
+    /// state is not under checkpoint and all validation is performed.
+    chain_state::ptr to_state(const bc::settings& settings) const;
+
+protected:
+    void reset();
+
+private:
+    data_chunk block_;
+    uint32_t forks_;
+    chain_state::data values_;
+    prevouts prevouts_;
+};
+
+} // namespace chain
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,74 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHAIN_VALIDATION_TIMING_HPP
+#define LIBBITCOIN_CHAIN_VALIDATION_TIMING_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/bitcoin/define.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+/**
+ * Block validation metrics by stage, collected only when attached to the
+ * block metadata. Without timing the stages are not measured. Durations
+ * accumulate over calls, and those of parallel stages are summed over
+ * threads. Stages that are not reached (after a failure) are not recorded.
+ */
+struct BC_API validation_timing
+{
+    typedef std::chrono::nanoseconds duration;
+
+    /// check: merkle root generation.
+    duration merkle_root = duration::zero();
+
+    /// check and accept: coinbase position, count, script and claim.
+    duration coinbase = duration::zero();
+
+    /// check: forward reference and internal double spend.
+    duration double_spend = duration::zero();
+
+    /// accept: signature operation count.
+    duration sigops = duration::zero();
+
+    /// accept: transaction finality.
+    duration finality = duration::zero();
+
+    /// connect: input connection, including signature verification.
+    duration connect = duration::zero();
+
+    /// connect: signature verification (script checksig operations).
+    duration signatures = duration::zero();
+
+    /// The number of non-coinbase inputs connected.
+    size_t input_count = 0;
+
+    /// The signature operation count of accept.
+    size_t sigop_count = 0;
+
+    /// The number of signatures checked by connect.
+    uint64_t signature_count = 0;
+};
+
+} // namespace chain
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,135 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHAIN_VIEW_LIST_HPP
+#define LIBBITCOIN_CHAIN_VIEW_LIST_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <bitcoin/bitcoin/utility/data.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+/// Forward range over a count of consecutive serialized elements, each
+/// parsed on dereference by View(data_slice). The buffer must be valid for
+/// at least the number of elements announced, which the owning view ensures.
+template <typename View>
+class view_list
+{
+public:
+    class const_iterator
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef View value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const View* pointer;
+        typedef const View& reference;
+
+        const_iterator(const uint8_t* position, const uint8_t* end,
+            size_t remaining)
+          : remaining_(remaining), end_(end),
+            view_(remaining == 0 ? View() : View({ position, end }))
+        {
+        }
+
+        reference operator*() const
+        {
+            return view_;
+        }
+
+        pointer operator->() const
+        {
+            return &view_;
+        }
+
+        const_iterator& operator++()
+        {
+            if (--remaining_ == 0)
+                view_ = View();
+            else
+                view_ = View({ view_.data().end(), end_ });
+
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            auto copy = *this;
+            ++(*this);
+            return copy;
+        }
+
+        bool operator==(const const_iterator& other) const
+        {
+            return remaining_ == other.remaining_;
+        }
+
+        bool operator!=(const const_iterator& other) const
+        {
+            return !(*this == other);
+        }
+
+    private:
+        size_t remaining_;
+        const uint8_t* end_;
+        View view_;
+    };
+
+    view_list()
+      : view_list(nullptr, nullptr, 0)
+    {
+    }
+
+    view_list(const uint8_t* begin, const uint8_t* end, size_t count)
+      : begin_(begin), end_(end), count_(count)
+    {
+    }
+
+    size_t size() const
+    {
+        return count_;
+    }
+
+    bool empty() const
+    {
+        return count_ == 0;
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator(begin_, end_, count_);
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator(end_, end_, 0);
+    }
+
+private:
+    const uint8_t* begin_;
+    const uint8_t* end_;
+    size_t count_;
+};
+
+} // namespace chain
+} // namespace libbitcoin
+
+#endif
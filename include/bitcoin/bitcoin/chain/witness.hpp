@@ -21,11 +21,15 @@
 
 #include <cstddef>
 #include <istream>
+#include <memory>
 #include <string>
 #include <bitcoin/bitcoin/chain/script.hpp>
 #include <bitcoin/bitcoin/define.hpp>
 #include <bitcoin/bitcoin/machine/operation.hpp>
+#include <bitcoin/bitcoin/machine/verification_context.hpp>
+#include <bitcoin/bitcoin/utility/cold_ptr.hpp>
 #include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/once_cell.hpp>
 #include <bitcoin/bitcoin/utility/reader.hpp>
 #include <bitcoin/bitcoin/utility/thread.hpp>
 #include <bitcoin/bitcoin/utility/writer.hpp>
@@ -38,6 +42,7 @@ class BC_API witness
 public:
     typedef machine::operation operation;
     typedef data_stack::const_iterator iterator;
+    typedef std::shared_ptr<const data_chunk> encoding_ptr;
 
     // Constructors.
     //-------------------------------------------------------------------------
@@ -76,6 +81,18 @@ public:
     bool from_data(std::istream& stream, bool prefix);
     bool from_data(reader& source, bool prefix);
 
+    /// Read the prefixed witness lazily, from a source that reads the
+    /// remainder of the shared encoding. Only the element sizes are read,
+    /// and the stack is parsed from the encoding upon first access to it.
+    /// Sizing and serialization reuse the encoding without parsing.
+    bool from_data(reader& source, encoding_ptr data);
+
+    /// Advance the source past a prefixed witness, reading only its sizes.
+    static void skip(reader& source);
+
+    /// True if the stack is not yet parsed from a lazily read encoding.
+    bool is_deferred() const;
+
     /// The witness deserialized ccording to count and size prefixing.
     bool is_valid() const;
 
@@ -106,6 +123,9 @@ public:
     size_t serialized_size(bool prefix) const;
     const data_stack& stack() const;
 
+    /// Heap bytes of the stack and its elements, excluding sizeof.
+    size_t heap_size() const;
+
     // Utilities.
     //-------------------------------------------------------------------------
 
@@ -117,12 +137,23 @@ public:
     bool extract_embedded_script(script& out_script, data_stack& out_stack,
         const script& program_script) const;
 
+    /// As above, without copying. The initial stack is [begin(), out_end).
+    /// A P2WSH script is decoded once and retained by this witness, a P2WPKH
+    /// script is built into the buffer. The out script refers to one of them.
+    bool extract_embedded_script(const script*& out_script, iterator& out_end,
+        script& buffer, const script& program_script) const;
+
     // Validation.
     //-------------------------------------------------------------------------
 
     code verify(const transaction& tx, uint32_t input_index, uint32_t forks,
         const script& program_script, uint64_t value) const;
 
+    /// As above, with program stacks reused from the verification context.
+    code verify(const transaction& tx, uint32_t input_index, uint32_t forks,
+        const script& program_script, uint64_t value,
+        machine::verification_context& context) const;
+
 protected:
     // So that input may call reset from its own.
     friend class input;
@@ -130,11 +161,34 @@ protected:
     void reset();
 
 private:
+    // The encoding of a lazily read witness, parsed once.
+    struct deferred
+    {
+        encoding_ptr data;
+        size_t offset;
+        size_t size;
+        size_t count;
+        once_cell<bool> parsed;
+    };
+
+    static bool read_stack(data_stack& stack, reader& source, bool prefix);
     static size_t serialized_size(const data_stack& stack);
     static operation::list to_pay_key_hash(data_chunk&& program);
+    static bool is_push_size(iterator first, iterator last);
+
+    const script& embedded_script() const;
+    const data_stack& parsed() const;
+
+    typedef once_cell<script> script_cell;
 
     bool valid_;
-    data_stack stack_;
+    mutable data_stack stack_;
+
+    // A lazily read witness is parsed into the stack on first access.
+    cold_ptr<deferred> deferred_;
+
+    // Witness script derived from the last stack element, retained.
+    mutable cold_ptr<script_cell> embedded_;
 };
 
 } // namespace chain
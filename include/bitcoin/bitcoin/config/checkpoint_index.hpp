@@ -0,0 +1,87 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CONFIG_CHECKPOINT_INDEX_HPP
+#define LIBBITCOIN_CONFIG_CHECKPOINT_INDEX_HPP
+
+#include <cstddef>
+#include <memory>
+#include <bitcoin/bitcoin/config/checkpoint.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+
+namespace libbitcoin {
+namespace config {
+
+/**
+ * An immutable index of checkpoints ordered by height.
+ * This is built once from the configured list and shared between states, so
+ * that lookups are logarithmic in the number of checkpoints.
+ */
+class BC_API checkpoint_index
+{
+public:
+    typedef std::shared_ptr<const checkpoint_index> const_ptr;
+
+    /**
+     * Construct the index from a list of checkpoints in any order.
+     * @param[in]  checks  The list of checkpoints.
+     */
+    checkpoint_index(const checkpoint::list& checks);
+
+    /**
+     * Getter.
+     * @return The checkpoints, ordered by height with greatest at back.
+     */
+    const checkpoint::list& checkpoints() const;
+
+    /**
+     * Getter.
+     * @return The height of the top checkpoint, zero if there are none.
+     */
+    size_t top_height() const;
+
+    /**
+     * Confirm a height is at or below the top checkpoint.
+     * @param[in]  height  The height of checkpoint.
+     */
+    bool covered(size_t height) const;
+
+    /**
+     * Validate a hash against the checkpoints at its height.
+     * @param[in]  hash    The hash of the checkpoint.
+     * @param[in]  height  The height of checkpoint.
+     */
+    bool validate(const hash_digest& hash, size_t height) const;
+
+    /**
+     * Find the (first) checkpoint at a height.
+     * @param[in]  height  The height of checkpoint.
+     * @return             The checkpoint or nullptr if there is none.
+     */
+    const checkpoint* find(size_t height) const;
+
+private:
+    const checkpoint::list checks_;
+    const size_t top_height_;
+};
+
+} // namespace config
+} // namespace libbitcoin
+
+#endif
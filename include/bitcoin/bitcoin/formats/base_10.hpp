@@ -19,8 +19,10 @@
 #ifndef LIBBITCOIN_BASE_10_HPP
 #define LIBBITCOIN_BASE_10_HPP
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
+#include <vector>
 #include <bitcoin/bitcoin/compat.hpp>
 #include <bitcoin/bitcoin/define.hpp>
 
@@ -30,6 +32,10 @@ BC_CONSTEXPR uint8_t btc_decimal_places = 8;
 BC_CONSTEXPR uint8_t mbtc_decimal_places = 5;
 BC_CONSTEXPR uint8_t ubtc_decimal_places = 2;
 
+/// The maximum size of an encoded amount, for any decimal places
+/// ("0." and 255 fractional digits).
+BC_CONSTEXPR size_t base10_maximum_size = 2 + 255;
+
 /**
  * Validates and parses an amount string according to the BIP 21 grammar.
  * @param decmial_places the location of the decimal point.
@@ -50,6 +56,29 @@ BC_API bool decode_base10(uint64_t& out, const std::string& amount,
 BC_API std::string encode_base10(uint64_t amount,
     uint8_t decimal_places=0);
 
+/**
+ * Append each amount followed by the delimiter to out, as encode_base10.
+ * This does not allocate once out has capacity for the column.
+ */
+BC_API void encode_base10(std::string& out,
+    const std::vector<uint64_t>& amounts, uint8_t decimal_places=0,
+    char delimiter='\n');
+
+/**
+ * Parse the characters [first, last) as decode_base10, without allocation.
+ * @return false for failure.
+ */
+BC_API bool base10_from_chars(uint64_t& out, const char* first,
+    const char* last, uint8_t decimal_places=0, bool strict=true);
+
+/**
+ * Write the amount to [first, last) as encode_base10, without allocation.
+ * No terminator is written.
+ * @return the end of the written characters, or nullptr if they do not fit.
+ */
+BC_API char* base10_to_chars(char* first, char* last, uint64_t amount,
+    uint8_t decimal_places=0);
+
 // Old names:
 BC_API bool btc_to_satoshi(uint64_t& satoshi, const std::string& btc);
 BC_API std::string satoshi_to_btc(uint64_t satoshi);
@@ -57,4 +86,3 @@ BC_API std::string satoshi_to_btc(uint64_t satoshi);
 } // namespace libbitcoin
 
 #endif
-
@@ -19,6 +19,7 @@
 #ifndef LIBBITCOIN_BASE_16_HPP
 #define LIBBITCOIN_BASE_16_HPP
 
+#include <cstddef>
 #include <string>
 #include <bitcoin/bitcoin/define.hpp>
 #include <bitcoin/bitcoin/math/hash.hpp>
@@ -34,9 +35,21 @@ bool is_base16(const char c);
 
 /**
  * Convert data into a user-readable hex string.
+ * Sixteen or more bytes are converted per step where supported by the cpu.
  */
 BC_API std::string encode_base16(data_slice data);
 
+/**
+ * Convert data into a hex string in out, reusing its capacity.
+ */
+BC_API void encode_base16(std::string& out, data_slice data);
+
+/**
+ * Convert data into hex characters at out, which must hold 2 * data.size()
+ * characters. No terminator is written.
+ */
+BC_API void encode_base16(char* out, data_slice data);
+
 /**
  * Convert a hex string into bytes.
  * @return false if the input is malformed.
@@ -62,7 +75,19 @@ byte_array<(Size - 1) / 2> base16_literal(const char (&string)[Size]);
  * Converts a bitcoin_hash to a string.
  * The bitcoin_hash format is like base16, but with the bytes reversed.
  */
-BC_API std::string encode_hash(hash_digest hash);
+BC_API std::string encode_hash(const hash_digest& hash);
+
+/**
+ * Converts a bitcoin_hash to a string in out, reusing its capacity.
+ */
+BC_API void encode_hash(std::string& out, const hash_digest& hash);
+
+/**
+ * Converts a bitcoin_hash to characters at out, which must hold
+ * 2 * hash_size characters. The bytes are reversed as they are encoded.
+ * No terminator is written.
+ */
+BC_API void encode_hash(char* out, const hash_digest& hash);
 
 /**
  * Convert a string into a bitcoin_hash.
@@ -20,8 +20,10 @@
 #define LIBBITCOIN_BASE_32_HPP
 
 #include <string>
+#include <vector>
 #include <bitcoin/bitcoin/define.hpp>
 #include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/string.hpp>
 
 namespace libbitcoin {
 
@@ -42,11 +44,30 @@ struct BC_API base32
 BC_API std::string encode_base32(const base32& unencoded);
 
 /**
- * Decode base32 data.
+ * Encode data as base32 into out, reusing its capacity.
+ */
+BC_API void encode_base32(std::string& out, const base32& unencoded);
+
+/**
+ * Encode each value as base32 into out, reusing the capacity of its strings.
+ * The prefix checksum is shared by consecutive values of the same prefix.
+ */
+BC_API void encode_base32(string_list& out, const std::vector<base32>& unencoded);
+
+/**
+ * Decode base32 data, reusing the capacity of the out prefix and payload.
  * @return false if the input is not a valid base32 encoded string.
  */
 BC_API bool decode_base32(base32& out, const std::string& in);
 
+/**
+ * Decode each string as base32 into out, reusing the capacity of its values.
+ * The prefix checksum is shared by consecutive strings of the same prefix.
+ * @return false if any input is not a valid base32 encoded string, in which
+ * case its value is cleared and the remaining strings are still decoded.
+ */
+BC_API bool decode_base32(std::vector<base32>& out, const string_list& in);
+
 } // namespace libbitcoin
 
 #endif
@@ -19,6 +19,7 @@
 #ifndef LIBBITCOIN_BASE_58_HPP
 #define LIBBITCOIN_BASE_58_HPP
 
+#include <cstddef>
 #include <string>
 #include <bitcoin/bitcoin/define.hpp>
 #include <bitcoin/bitcoin/utility/data.hpp>
@@ -50,6 +51,26 @@ byte_array<Size * 733 / 1000> base58_literal(const char(&string)[Size]);
  */
 BC_API std::string encode_base58(data_slice unencoded);
 
+/**
+ * Encode data as base58 into out, reusing its capacity.
+ * Intermediate limbs are on the stack unless the data is unusually large.
+ */
+BC_API void encode_base58(std::string& out, data_slice unencoded);
+
+/**
+ * Encode a fixed size array as base58, such as a 25 byte payment address
+ * or 82 byte extended key, with intermediate limbs always on the stack.
+ * @return the base58 encoded string.
+ */
+template <size_t Size>
+std::string encode_base58(const byte_array<Size>& unencoded);
+
+/**
+ * Encode a fixed size array as base58 into out, reusing its capacity.
+ */
+template <size_t Size>
+void encode_base58(std::string& out, const byte_array<Size>& unencoded);
+
 /**
  * Attempt to decode base58 data.
  * @return false if the input contains non-base58 characters.
@@ -19,6 +19,7 @@
 #ifndef LIBBITCOIN_BASE_64_HPP
 #define LIBBITCOIN_BASE_64_HPP
 
+#include <ostream>
 #include <string>
 #include <bitcoin/bitcoin/define.hpp>
 #include <bitcoin/bitcoin/utility/data.hpp>
@@ -31,8 +32,21 @@ namespace libbitcoin {
  */
 BC_API std::string encode_base64(data_slice unencoded);
 
+/**
+ * Encode data as base64 in out, reusing its capacity.
+ * Twelve or more bytes are converted per step where supported by the cpu.
+ */
+BC_API void encode_base64(std::string& out, data_slice unencoded);
+
+/**
+ * Encode data as base64 to the stream, in fixed-size chunks, so that the
+ * full encoding is never held in memory.
+ */
+BC_API void encode_base64(std::ostream& out, data_slice unencoded);
+
 /**
  * Attempt to decode base64 data.
+ * Padding is accepted only at the end of the final group.
  * @return false if the input contains non-base64 characters.
  */
 BC_API bool decode_base64(data_chunk& out, const std::string& in);
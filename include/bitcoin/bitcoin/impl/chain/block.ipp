@@ -0,0 +1,76 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHAIN_BLOCK_IPP
+#define LIBBITCOIN_CHAIN_BLOCK_IPP
+
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/bitcoin/chain/chain_state.hpp>
+#include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+// The divisor is a constant, so the division is folded to a multiply.
+template <typename Profile>
+uint64_t block::subsidy(size_t height)
+{
+    static_assert(Profile::subsidy_interval != 0, "zero subsidy interval");
+    static BC_CONSTEXPR size_t overflow = sizeof(uint64_t) * byte_bits;
+    const auto halvings = height / Profile::subsidy_interval;
+    return Profile::initial_block_subsidy_satoshi >>
+        (halvings >= overflow ? 0 : halvings);
+}
+
+template <typename Profile>
+code block::check(bool scrypt) const
+{
+    return check(Profile::max_money, Profile::timestamp_limit_seconds,
+        Profile::proof_of_work_limit, scrypt, nullptr);
+}
+
+template <typename Profile>
+code block::check(threadpool& pool, bool scrypt) const
+{
+    return check(Profile::max_money, Profile::timestamp_limit_seconds,
+        Profile::proof_of_work_limit, scrypt, &pool);
+}
+
+template <typename Profile>
+code block::accept(const chain_state& state, bool transactions,
+    bool header) const
+{
+    return accept(state, subsidy<Profile>(state.height()), transactions,
+        header, nullptr);
+}
+
+template <typename Profile>
+code block::accept(const chain_state& state, threadpool& pool,
+    bool transactions, bool header) const
+{
+    return accept(state, subsidy<Profile>(state.height()), transactions,
+        header, &pool);
+}
+
+} // namespace chain
+} // namespace libbitcoin
+
+#endif
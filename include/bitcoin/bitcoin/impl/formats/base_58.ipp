@@ -19,6 +19,10 @@
 #ifndef LIBBITCOIN_BASE_58_IPP
 #define LIBBITCOIN_BASE_58_IPP
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
 #include <bitcoin/bitcoin/utility/assert.hpp>
 #include <bitcoin/bitcoin/utility/data.hpp>
 
@@ -28,17 +32,45 @@ namespace libbitcoin {
 BC_API bool decode_base58_private(uint8_t* out, size_t out_size,
     const char* in);
 
+// For support of template implementation only, do not call directly.
+// The limbs must hold (out_size + 3) / 4 words.
+BC_API bool decode_base58_private(uint8_t* out, size_t out_size,
+    const char* in, uint32_t* limbs);
+
+// For support of template implementation only, do not call directly.
+// The limbs must hold (size * 138 / 100 + 1) / 5 + 1 words.
+BC_API void encode_base58_private(std::string& out, data_slice unencoded,
+    uint32_t* limbs);
+
 template <size_t Size>
 bool decode_base58(byte_array<Size>& out, const std::string &in)
 {
     byte_array<Size> result;
-    if (!decode_base58_private(result.data(), result.size(), in.data()))
+    std::array<uint32_t, Size / 4 + 1> limbs;
+    if (!decode_base58_private(result.data(), result.size(), in.data(),
+        limbs.data()))
         return false;
 
     out = result;
     return true;
 }
 
+template <size_t Size>
+std::string encode_base58(const byte_array<Size>& unencoded)
+{
+    std::string out;
+    encode_base58(out, unencoded);
+    return out;
+}
+
+template <size_t Size>
+void encode_base58(std::string& out, const byte_array<Size>& unencoded)
+{
+    // log(256) / log(58), rounded up, in limbs of five digits.
+    std::array<uint32_t, (Size * 138 / 100 + 1) / 5 + 1> limbs;
+    encode_base58_private(out, unencoded, limbs.data());
+}
+
 // TODO: determine if the sizing function is always accurate.
 template <size_t Size>
 byte_array<Size * 733 / 1000> base58_literal(const char(&string)[Size])
@@ -265,7 +265,7 @@ inline interpreter::result interpreter::op_if_dup(program& program)
 
 inline interpreter::result interpreter::op_depth(program& program)
 {
-    program.push_move(number(program.size()).data());
+    program.push_move(number(program.size()).element());
     return error::success;
 }
 
@@ -367,7 +367,7 @@ inline interpreter::result interpreter::op_size(program& program)
     auto top = program.pop();
     const auto size = top.size();
     program.push_move(std::move(top));
-    program.push_move(number(size).data());
+    program.push_move(number(size).element());
     return error::success;
 }
 
@@ -396,7 +396,7 @@ inline interpreter::result interpreter::op_add1(program& program)
         return error::op_add1;
 
     number += 1;
-    program.push_move(number.data());
+    program.push_move(number.element());
     return error::success;
 }
 
@@ -407,7 +407,7 @@ inline interpreter::result interpreter::op_sub1(program& program)
         return error::op_sub1;
 
     number -= 1;
-    program.push_move(number.data());
+    program.push_move(number.element());
     return error::success;
 }
 
@@ -418,7 +418,7 @@ inline interpreter::result interpreter::op_negate(program& program)
         return error::op_negate;
 
     number = -number;
-    program.push_move(number.data());
+    program.push_move(number.element());
     return error::success;
 }
 
@@ -431,7 +431,7 @@ inline interpreter::result interpreter::op_abs(program& program)
     if (number < 0)
         number = -number;
 
-    program.push_move(number.data());
+    program.push_move(number.element());
     return error::success;
 }
 
@@ -462,7 +462,7 @@ inline interpreter::result interpreter::op_add(program& program)
         return error::op_add;
 
     const auto result = first + second;
-    program.push_move(result.data());
+    program.push_move(result.element());
     return error::success;
 }
 
@@ -473,7 +473,7 @@ inline interpreter::result interpreter::op_sub(program& program)
         return error::op_sub;
 
     const auto result = second - first;
-    program.push_move(result.data());
+    program.push_move(result.element());
     return error::success;
 }
 
@@ -574,7 +574,7 @@ inline interpreter::result interpreter::op_min(program& program)
     if (!program.pop_binary(first, second))
         return error::op_min;
 
-    program.push_move(second < first ? second.data() : first.data());
+    program.push_move(second < first ? second.element() : first.element());
     return error::success;
 }
 
@@ -584,7 +584,7 @@ inline interpreter::result interpreter::op_max(program& program)
     if (!program.pop_binary(first, second))
         return error::op_max;
 
-    program.push_move(second > first ? second.data() : first.data());
+    program.push_move(second > first ? second.element() : first.element());
     return error::success;
 }
 
@@ -657,22 +657,23 @@ inline interpreter::result interpreter::op_check_sig_verify(program& program)
 
     uint8_t sighash;
     ec_signature signature;
-    der_signature distinguished;
-    auto bip66 = chain::script::is_enabled(program.forks(), bip66_rule);
-    auto bip143 = chain::script::is_enabled(program.forks(), bip143_rule);
+    data_slice distinguished(nullptr, nullptr);
+    const auto bip66 = chain::script::is_enabled(program.forks(), bip66_rule);
+    const auto bip143 = chain::script::is_enabled(program.forks(), bip143_rule);
 
     const auto public_key = program.pop();
-    auto endorsement = program.pop();
+    const auto endorsement = program.pop();
 
     // Create a subscript with endorsements stripped (sort of).
     chain::script script_code(program.subscript());
 
     // BIP143: find and delete of the signature is not applied for v0.
     if (!(bip143 && program.version() == script_version::zero))
-        script_code.find_and_delete({ endorsement });
+        script_code.find_and_delete({ endorsement.to_data() });
 
     // BIP62: An empty endorsement is not considered lax encoding.
-    if (!parse_endorsement(sighash, distinguished, std::move(endorsement)))
+    // The signature is parsed in place from the stack element.
+    if (!parse_endorsement(sighash, distinguished, endorsement))
         return error::invalid_signature_encoding;
 
     // Parse DER signature into an EC signature.
@@ -681,7 +682,8 @@ inline interpreter::result interpreter::op_check_sig_verify(program& program)
             error::invalid_signature_encoding;
 
     // Version condition preserves independence of bip141 and bip143.
-    auto version = bip143 ? program.version() : script_version::unversioned;
+    const auto version = bip143 ? program.version() :
+        script_version::unversioned;
 
     return chain::script::check_signature(signature, sighash, public_key,
         script_code, program.transaction(), program.input_index(),
@@ -712,7 +714,7 @@ inline interpreter::result interpreter::op_check_multisig_verify(
     if (!program.increment_operation_count(key_count))
         return error::op_check_multisig_verify2;
 
-    data_stack public_keys;
+    program::element_stack public_keys;
     if (!program.pop(public_keys, key_count))
         return error::op_check_multisig_verify3;
 
@@ -723,7 +725,7 @@ inline interpreter::result interpreter::op_check_multisig_verify(
     if (signature_count < 0 || signature_count > key_count)
         return error::op_check_multisig_verify5;
 
-    data_stack endorsements;
+    program::element_stack endorsements;
     if (!program.pop(endorsements, signature_count))
         return error::op_check_multisig_verify6;
 
@@ -739,25 +741,44 @@ inline interpreter::result interpreter::op_check_multisig_verify(
 
     uint8_t sighash;
     ec_signature signature;
-    der_signature distinguished;
+    data_slice distinguished(nullptr, nullptr);
     auto public_key = public_keys.begin();
-    auto bip66 = chain::script::is_enabled(program.forks(), bip66_rule);
-    auto bip143 = chain::script::is_enabled(program.forks(), bip143_rule);
+    const auto bip66 = chain::script::is_enabled(program.forks(), bip66_rule);
+    const auto bip143 = chain::script::is_enabled(program.forks(), bip143_rule);
+
+    // Version condition preserves independence of bip141 and bip143.
+    const auto version = bip143 ? program.version() :
+        script_version::unversioned;
 
     // Before looping create subscript with endorsements stripped (sort of).
     chain::script script_code(program.subscript());
 
     // BIP143: find and delete of the signature is not applied for v0.
     if (!(bip143 && program.version() == script_version::zero))
-        script_code.find_and_delete(endorsements);
+    {
+        data_stack stripped;
+        stripped.reserve(endorsements.size());
+
+        for (const auto& endorsement: endorsements)
+            stripped.push_back(endorsement.to_data());
+
+        script_code.find_and_delete(stripped);
+    }
+
+    // Speculation is of no benefit to a single signature and key pair.
+    const auto pool = program.multisig_pool();
+    if (pool != nullptr && endorsements.size() * public_keys.size() > 1)
+        return check_multisig_speculative(program, script_code, endorsements,
+            public_keys, *pool);
 
     // The exact number of signatures are required and must be in order.
     // One key can validate more than one script. So we always advance
     // until we exhaust either pubkeys (fail) or signatures (pass).
-    for (auto& endorsement: endorsements)
+    for (const auto& endorsement: endorsements)
     {
         // BIP62: An empty endorsement is not considered lax encoding.
-        if (!parse_endorsement(sighash, distinguished, std::move(endorsement)))
+        // The signature is parsed in place from the stack element.
+        if (!parse_endorsement(sighash, distinguished, endorsement))
             return error::invalid_signature_encoding;
 
         // Parse DER signature into an EC signature.
@@ -765,12 +786,8 @@ inline interpreter::result interpreter::op_check_multisig_verify(
             return bip66 ? error::invalid_signature_lax_encoding :
                 error::invalid_signature_encoding;
 
-        // Version condition preserves independence of bip141 and bip143.
-        auto version = bip143 ? program.version() : script_version::unversioned;
-
         while (true)
         {
-            // Version condition preserves independence of bip141 and bip143.
             if (chain::script::check_signature(signature, sighash, *public_key,
                 script_code, program.transaction(), program.input_index(),
                     version, program.value()))
@@ -31,6 +31,72 @@ namespace machine {
 
 static BC_CONSTEXPR auto invalid_code = opcode::disabled_xor;
 
+// Opcode property table.
+//-----------------------------------------------------------------------------
+
+namespace detail {
+
+// A template so that the table is defined in the header, once per program.
+template <typename Unused=void>
+struct opcode_table
+{
+    static const uint16_t properties[256];
+};
+
+// The operation::property mask of each opcode value, as a literal aggregate
+// so that it is constant initialized on all supported compilers, and so is
+// never read before initialization by static operations in other units.
+// Each row is eight opcode values, the first of which is noted.
+//
+// push:         value <= 96, excluding 80 (reserved_80).
+// payload:      1 <= value <= 78.
+// counted:      value >= 97.
+// version:      0, or 81 <= value <= 96.
+// numeric:      79, or 81 <= value <= 96.
+// positive:     81 <= value <= 96.
+// reserved:     80, 98, 137, 138, or value >= 186.
+// disabled:     101, 102, 126-129, 131-134, 141, 142, 149-153.
+// conditional:  99, 100, 103, 104.
+// relaxed_push: value <= 96.
+template <typename Unused>
+const uint16_t opcode_table<Unused>::properties[256] =
+{
+    0x209, 0x203, 0x203, 0x203, 0x203, 0x203, 0x203, 0x203,  // 0x00
+    0x203, 0x203, 0x203, 0x203, 0x203, 0x203, 0x203, 0x203,  // 0x08
+    0x203, 0x203, 0x203, 0x203, 0x203, 0x203, 0x203, 0x203,  // 0x10
+    0x203, 0x203, 0x203, 0x203, 0x203, 0x203, 0x203, 0x203,  // 0x18
+    0x203, 0x203, 0x203, 0x203, 0x203, 0x203, 0x203, 0x203,  // 0x20
+    0x203, 0x203, 0x203, 0x203, 0x203, 0x203, 0x203, 0x203,  // 0x28
+    0x203, 0x203, 0x203, 0x203, 0x203, 0x203, 0x203, 0x203,  // 0x30
+    0x203, 0x203, 0x203, 0x203, 0x203, 0x203, 0x203, 0x203,  // 0x38
+    0x203, 0x203, 0x203, 0x203, 0x203, 0x203, 0x203, 0x203,  // 0x40
+    0x203, 0x203, 0x203, 0x203, 0x203, 0x203, 0x203, 0x211,  // 0x48
+    0x240, 0x239, 0x239, 0x239, 0x239, 0x239, 0x239, 0x239,  // 0x50
+    0x239, 0x239, 0x239, 0x239, 0x239, 0x239, 0x239, 0x239,  // 0x58
+    0x239, 0x004, 0x044, 0x104, 0x104, 0x084, 0x084, 0x104,  // 0x60
+    0x104, 0x004, 0x004, 0x004, 0x004, 0x004, 0x004, 0x004,  // 0x68
+    0x004, 0x004, 0x004, 0x004, 0x004, 0x004, 0x004, 0x004,  // 0x70
+    0x004, 0x004, 0x004, 0x004, 0x004, 0x004, 0x084, 0x084,  // 0x78
+    0x084, 0x084, 0x004, 0x084, 0x084, 0x084, 0x084, 0x004,  // 0x80
+    0x004, 0x044, 0x044, 0x004, 0x004, 0x084, 0x084, 0x004,  // 0x88
+    0x004, 0x004, 0x004, 0x004, 0x004, 0x084, 0x084, 0x084,  // 0x90
+    0x084, 0x084, 0x004, 0x004, 0x004, 0x004, 0x004, 0x004,  // 0x98
+    0x004, 0x004, 0x004, 0x004, 0x004, 0x004, 0x004, 0x004,  // 0xa0
+    0x004, 0x004, 0x004, 0x004, 0x004, 0x004, 0x004, 0x004,  // 0xa8
+    0x004, 0x004, 0x004, 0x004, 0x004, 0x004, 0x004, 0x004,  // 0xb0
+    0x004, 0x004, 0x044, 0x044, 0x044, 0x044, 0x044, 0x044,  // 0xb8
+    0x044, 0x044, 0x044, 0x044, 0x044, 0x044, 0x044, 0x044,  // 0xc0
+    0x044, 0x044, 0x044, 0x044, 0x044, 0x044, 0x044, 0x044,  // 0xc8
+    0x044, 0x044, 0x044, 0x044, 0x044, 0x044, 0x044, 0x044,  // 0xd0
+    0x044, 0x044, 0x044, 0x044, 0x044, 0x044, 0x044, 0x044,  // 0xd8
+    0x044, 0x044, 0x044, 0x044, 0x044, 0x044, 0x044, 0x044,  // 0xe0
+    0x044, 0x044, 0x044, 0x044, 0x044, 0x044, 0x044, 0x044,  // 0xe8
+    0x044, 0x044, 0x044, 0x044, 0x044, 0x044, 0x044, 0x044,  // 0xf0
+    0x044, 0x044, 0x044, 0x044, 0x044, 0x044, 0x044, 0x044   // 0xf8
+};
+
+} // namespace detail
+
 // Constructors.
 //-----------------------------------------------------------------------------
 
@@ -255,68 +321,51 @@ inline uint8_t operation::opcode_to_positive(opcode code)
     return static_cast<uint8_t>(code) - op_81 + 1;
 }
 
+inline uint16_t operation::properties(opcode code)
+{
+    return detail::opcode_table<>::properties[static_cast<uint8_t>(code)];
+}
+
 // opcode: [0..79, 81..96]
 inline bool operation::is_push(opcode code)
 {
-    BC_CONSTEXPR auto op_80 = static_cast<uint8_t>(opcode::reserved_80);
-    BC_CONSTEXPR auto op_96 = static_cast<uint8_t>(opcode::push_positive_16);
-    const auto value = static_cast<uint8_t>(code);
-    return value <= op_96 && value != op_80;
+    return (properties(code) & push) != 0;
 }
 
 // opcode: [1..78]
 inline bool operation::is_payload(opcode code)
 {
-    BC_CONSTEXPR auto op_1 = static_cast<uint8_t>(opcode::push_size_1);
-    BC_CONSTEXPR auto op_78 = static_cast<uint8_t>(opcode::push_four_size);
-    const auto value = static_cast<uint8_t>(code);
-    return value >= op_1 && value <= op_78;
+    return (properties(code) & payload) != 0;
 }
 
 // opcode: [97..255]
 inline bool operation::is_counted(opcode code)
 {
-    BC_CONSTEXPR auto op_97 = static_cast<uint8_t>(opcode::nop);
-    const auto value = static_cast<uint8_t>(code);
-    return value >= op_97;
+    return (properties(code) & counted) != 0;
 }
 
 // stack: [[], 1..16]
 inline bool operation::is_version(opcode code)
 {
-    return code == opcode::push_size_0 || is_positive(code);
+    return (properties(code) & version) != 0;
 }
 
 // stack: [-1, 1..16]
 inline bool operation::is_numeric(opcode code)
 {
-    return is_positive(code) || code == opcode::push_negative_1;
+    return (properties(code) & numeric) != 0;
 }
 
 // stack: [1..16]
 inline bool operation::is_positive(opcode code)
 {
-    BC_CONSTEXPR auto op_81 = static_cast<uint8_t>(opcode::push_positive_1);
-    BC_CONSTEXPR auto op_96 = static_cast<uint8_t>(opcode::push_positive_16);
-    const auto value = static_cast<uint8_t>(code);
-    return value >= op_81 && value <= op_96;
+    return (properties(code) & positive) != 0;
 }
 
 // opcode: [80, 98, 137, 138, 186..255]
 inline bool operation::is_reserved(opcode code)
 {
-    BC_CONSTEXPR auto op_186 = static_cast<uint8_t>(opcode::reserved_186);
-
-    switch (code)
-    {
-        case opcode::reserved_80:
-        case opcode::reserved_98:
-        case opcode::reserved_137:
-        case opcode::reserved_138:
-            return true;
-        default:
-            return static_cast<uint8_t>(code) >= op_186;
-    }
+    return (properties(code) & reserved) != 0;
 }
 
 //*****************************************************************************
@@ -330,29 +379,7 @@ inline bool operation::is_reserved(opcode code)
 //*****************************************************************************
 inline bool operation::is_disabled(opcode code)
 {
-    switch (code)
-    {
-        case opcode::disabled_cat:
-        case opcode::disabled_substr:
-        case opcode::disabled_left:
-        case opcode::disabled_right:
-        case opcode::disabled_invert:
-        case opcode::disabled_and:
-        case opcode::disabled_or:
-        case opcode::disabled_xor:
-        case opcode::disabled_mul2:
-        case opcode::disabled_div2:
-        case opcode::disabled_mul:
-        case opcode::disabled_div:
-        case opcode::disabled_mod:
-        case opcode::disabled_lshift:
-        case opcode::disabled_rshift:
-        case opcode::disabled_verif:
-        case opcode::disabled_vernotif:
-            return true;
-        default:
-            return false;
-    }
+    return (properties(code) & disabled) != 0;
 }
 
 //*****************************************************************************
@@ -361,16 +388,7 @@ inline bool operation::is_disabled(opcode code)
 //*****************************************************************************
 inline bool operation::is_conditional(opcode code)
 {
-    switch (code)
-    {
-        case opcode::if_:
-        case opcode::notif:
-        case opcode::else_:
-        case opcode::endif:
-            return true;
-        default:
-            return false;
-    }
+    return (properties(code) & conditional) != 0;
 }
 
 //*****************************************************************************
@@ -381,9 +399,7 @@ inline bool operation::is_conditional(opcode code)
 // opcode: [0..96]
 inline bool operation::is_relaxed_push(opcode code)
 {
-    BC_CONSTEXPR auto op_96 = static_cast<uint8_t>(opcode::push_positive_16);
-    const auto value = static_cast<uint8_t>(code);
-    return value <= op_96;
+    return (properties(code) & relaxed_push) != 0;
 }
 
 inline bool operation::is_push() const
@@ -22,18 +22,23 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <utility>
 #include <bitcoin/bitcoin/chain/script.hpp>
 #include <bitcoin/bitcoin/chain/transaction.hpp>
 #include <bitcoin/bitcoin/constants.hpp>
 #include <bitcoin/bitcoin/machine/number.hpp>
 #include <bitcoin/bitcoin/machine/operation.hpp>
 #include <bitcoin/bitcoin/machine/script_version.hpp>
+#include <bitcoin/bitcoin/machine/stack_element.hpp>
 #include <bitcoin/bitcoin/utility/assert.hpp>
 #include <bitcoin/bitcoin/utility/data.hpp>
 
 namespace libbitcoin {
 namespace machine {
 
+// The condition stack first false position when no value is false.
+static BC_CONSTEXPR size_t no_false_condition = max_size_t;
+
 // Constant registers.
 //-----------------------------------------------------------------------------
 
@@ -68,6 +73,16 @@ inline const chain::transaction& program::transaction() const
     return transaction_;
 }
 
+inline script_profile* program::profile() const
+{
+    return context_ == nullptr ? nullptr : context_->profile();
+}
+
+inline threadpool* program::multisig_pool() const
+{
+    return context_ == nullptr ? nullptr : context_->multisig_pool();
+}
+
 // Program registers.
 //-----------------------------------------------------------------------------
 
@@ -171,10 +186,10 @@ inline void program::push_copy(const value_type& item)
 //-----------------------------------------------------------------------------
 
 // This must be guarded.
-inline data_chunk program::pop()
+inline program::value_type program::pop()
 {
     BITCOIN_ASSERT(!empty());
-    const auto value = primary_.back();
+    auto value = std::move(primary_.back());
     primary_.pop_back();
     return value;
 }
@@ -189,9 +204,15 @@ inline bool program::pop(int32_t& out_value)
     return true;
 }
 
+// The number is decoded from the top element in place, before it is popped.
 inline bool program::pop(number& out_number, size_t maxiumum_size)
 {
-    return !empty() && out_number.set_data(pop(), maxiumum_size);
+    if (empty())
+        return false;
+
+    const auto result = out_number.set_data(primary_.back(), maxiumum_size);
+    primary_.pop_back();
+    return result;
 }
 
 inline bool program::pop_binary(number& first, number& second)
@@ -228,7 +249,7 @@ inline bool program::pop_position(stack_iterator& out_position)
 }
 
 // pop1/pop2/.../pop[count]
-inline bool program::pop(data_stack& section, size_t count)
+inline bool program::pop(element_stack& section, size_t count)
 {
     if (size() < count)
         return false;
@@ -239,6 +260,18 @@ inline bool program::pop(data_stack& section, size_t count)
     return true;
 }
 
+// pop1/pop2/.../pop[count]
+inline bool program::pop(data_stack& section, size_t count)
+{
+    if (size() < count)
+        return false;
+
+    for (size_t i = 0; i < count; ++i)
+        section.push_back(pop().to_data());
+
+    return true;
+}
+
 // Primary push/pop optimizations (active).
 //-----------------------------------------------------------------------------
 
@@ -253,8 +286,8 @@ inline void program::swap(size_t index_left, size_t index_right)
 {
     // TODO: refactor to allow DRY without const_cast here.
     std::swap(
-        const_cast<data_stack::value_type&>(item(index_left)),
-        const_cast<data_stack::value_type&>(item(index_right)));
+        const_cast<value_type&>(item(index_left)),
+        const_cast<value_type&>(item(index_right)));
 }
 
 // pop1/pop2/.../pop[pos-1]/pop[pos]/push[pos-1]/.../push2/push1
@@ -320,7 +353,7 @@ inline bool program::if_(const operation& op) const
     return op.is_conditional() || succeeded();
 }
 
-inline const data_stack::value_type& program::item(size_t index) /*const*/
+inline const program::value_type& program::item(size_t index) /*const*/
 {
     return *position(index);
 }
@@ -370,7 +403,7 @@ inline void program::push_alternate(value_type&& value)
 inline program::value_type program::pop_alternate()
 {
     BITCOIN_ASSERT(!alternate_.empty());
-    const auto value = alternate_.back();
+    auto value = std::move(alternate_.back());
     alternate_.pop_back();
     return value;
 }
@@ -380,21 +413,23 @@ inline program::value_type program::pop_alternate()
 
 inline void program::open(bool value)
 {
-    negative_count_ += (value ? 0 : 1);
-    condition_.push_back(value);
+    if (!value && first_false_ == no_false_condition)
+        first_false_ = condition_size_;
+
+    ++condition_size_;
 }
 
 // This must be guarded.
 inline void program::negate()
 {
     BITCOIN_ASSERT(!closed());
+    const auto top = condition_size_ - 1;
 
-    const auto value = condition_.back();
-    negative_count_ += (value ? 1 : -1);
-    condition_.back() = !value;
-
-    // Optimized above to avoid succeeded loop.
-    ////condition_.back() = !condition_.back();
+    // A top value above the first false is unobservable, so is not toggled.
+    if (first_false_ == no_false_condition)
+        first_false_ = top;
+    else if (first_false_ == top)
+        first_false_ = no_false_condition;
 }
 
 // This must be guarded.
@@ -402,26 +437,18 @@ inline void program::close()
 {
     BITCOIN_ASSERT(!closed());
 
-    const auto value = condition_.back();
-    negative_count_ += (value ? 0 : -1);
-    condition_.pop_back();
-
-    // Optimized above to avoid succeeded loop.
-    ////condition_.pop_back();
+    if (first_false_ == --condition_size_)
+        first_false_ = no_false_condition;
 }
 
 inline bool program::closed() const
 {
-    return condition_.empty();
+    return condition_size_ == 0;
 }
 
 inline bool program::succeeded() const
 {
-    return negative_count_ == 0;
-
-    // Optimized above to avoid succeeded loop.
-    ////const auto is_true = [](bool value) { return value; };
-    ////return std::all_of(condition_.begin(), condition_.end(), true);
+    return first_false_ == no_false_condition;
 }
 
 } // namespace machine
@@ -0,0 +1,198 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_MACHINE_STACK_ELEMENT_IPP
+#define LIBBITCOIN_MACHINE_STACK_ELEMENT_IPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <utility>
+#include <bitcoin/bitcoin/utility/assert.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+
+namespace libbitcoin {
+namespace machine {
+
+// Constructors.
+//-----------------------------------------------------------------------------
+
+inline stack_element::stack_element()
+  : size_(0)
+{
+}
+
+inline stack_element::stack_element(stack_element&& other)
+  : size_(other.size_), heap_(std::move(other.heap_))
+{
+    if (is_inline())
+        std::copy_n(other.buffer_, size_, buffer_);
+
+    other.size_ = 0;
+}
+
+inline stack_element::stack_element(const stack_element& other)
+  : size_(other.size_), heap_(other.heap_)
+{
+    if (is_inline())
+        std::copy_n(other.buffer_, size_, buffer_);
+}
+
+inline stack_element::stack_element(data_chunk&& data)
+  : size_(data.size())
+{
+    if (is_inline())
+        std::copy_n(data.begin(), size_, buffer_);
+    else
+        heap_ = std::move(data);
+}
+
+inline stack_element::stack_element(const data_chunk& data)
+  : size_(0)
+{
+    assign(data.data(), data.size());
+}
+
+inline stack_element::stack_element(std::initializer_list<uint8_t> bytes)
+  : size_(0)
+{
+    assign(bytes.begin(), bytes.size());
+}
+
+inline stack_element::stack_element(data_slice data)
+  : size_(0)
+{
+    assign(data.data(), data.size());
+}
+
+// private
+inline void stack_element::assign(const uint8_t* data, size_t size)
+{
+    size_ = size;
+
+    if (is_inline())
+    {
+        heap_.clear();
+        std::copy_n(data, size_, buffer_);
+    }
+    else
+    {
+        heap_.assign(data, data + size);
+    }
+}
+
+// Operators.
+//-----------------------------------------------------------------------------
+
+inline stack_element& stack_element::operator=(stack_element&& other)
+{
+    if (this == &other)
+        return *this;
+
+    size_ = other.size_;
+    heap_ = std::move(other.heap_);
+
+    if (is_inline())
+        std::copy_n(other.buffer_, size_, buffer_);
+
+    other.size_ = 0;
+    return *this;
+}
+
+inline stack_element& stack_element::operator=(const stack_element& other)
+{
+    if (this != &other)
+        assign(other.data(), other.size());
+
+    return *this;
+}
+
+inline bool stack_element::operator==(const stack_element& other) const
+{
+    return size_ == other.size_ && std::equal(begin(), end(), other.begin());
+}
+
+inline bool stack_element::operator!=(const stack_element& other) const
+{
+    return !(*this == other);
+}
+
+inline uint8_t stack_element::operator[](size_t index) const
+{
+    BITCOIN_ASSERT(index < size_);
+    return data()[index];
+}
+
+// Properties.
+//-----------------------------------------------------------------------------
+
+// private
+inline bool stack_element::is_inline() const
+{
+    return size_ <= inline_capacity;
+}
+
+inline const uint8_t* stack_element::data() const
+{
+    return is_inline() ? buffer_ : heap_.data();
+}
+
+inline size_t stack_element::size() const
+{
+    return size_;
+}
+
+inline bool stack_element::empty() const
+{
+    return size_ == 0;
+}
+
+inline stack_element::const_iterator stack_element::begin() const
+{
+    return data();
+}
+
+inline stack_element::const_iterator stack_element::end() const
+{
+    return data() + size_;
+}
+
+// This must be guarded.
+inline uint8_t stack_element::front() const
+{
+    BITCOIN_ASSERT(!empty());
+    return data()[0];
+}
+
+// This must be guarded.
+inline uint8_t stack_element::back() const
+{
+    BITCOIN_ASSERT(!empty());
+    return data()[size_ - 1];
+}
+
+inline data_chunk stack_element::to_data() const
+{
+    return data_chunk(begin(), end());
+}
+
+} // namespace machine
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,553 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_UINT256_IPP
+#define LIBBITCOIN_UINT256_IPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iterator>
+#include <ostream>
+#include <stdexcept>
+#include <vector>
+#include <bitcoin/bitcoin/compat.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/assert.hpp>
+#include <bitcoin/bitcoin/utility/endian.hpp>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+    #include <intrin.h>
+#endif
+
+namespace libbitcoin {
+
+// Constructors
+//-----------------------------------------------------------------------------
+
+BC_CONSTCTOR uint256_t::uint256_t()
+  : uint256_t(0, 0, 0, 0)
+{
+}
+
+BC_CONSTCTOR uint256_t::uint256_t(uint64_t value)
+  : uint256_t(value, 0, 0, 0)
+{
+}
+
+BC_CONSTCTOR uint256_t::uint256_t(uint64_t word0, uint64_t word1,
+    uint64_t word2, uint64_t word3)
+  : words_{ word0, word1, word2, word3 }
+{
+}
+
+inline uint256_t::uint256_t(const hash_digest& hash)
+  : uint256_t()
+{
+    auto word = hash.begin();
+
+    for (size_t index = 0; index < word_count; ++index)
+    {
+        words_[index] = from_little_endian_unsafe<uint64_t>(word);
+        word += sizeof(uint64_t);
+    }
+}
+
+// Properties
+//-----------------------------------------------------------------------------
+
+inline hash_digest uint256_t::hash() const
+{
+    hash_digest out;
+    auto word = out.begin();
+
+    for (size_t index = 0; index < word_count; ++index)
+    {
+        const auto bytes = to_little_endian(words_[index]);
+        word = std::copy(bytes.begin(), bytes.end(), word);
+    }
+
+    return out;
+}
+
+inline size_t uint256_t::bit_length() const
+{
+    for (auto index = word_count; index > 0; --index)
+    {
+        const auto word = words_[index - 1u];
+
+        if (word != 0)
+            return index * 64u - leading_zeros(word);
+    }
+
+    return 0;
+}
+
+inline size_t uint256_t::byte_length() const
+{
+    return (bit_length() + 7u) / 8u;
+}
+
+BC_CONSTFUNC uint64_t uint256_t::operator[](size_t index) const
+{
+    return words_[index];
+}
+
+BC_CONSTFUNC uint256_t::operator uint64_t() const
+{
+    return words_[0];
+}
+
+// Operators
+//-----------------------------------------------------------------------------
+
+BC_CONSTFUNC uint256_t uint256_t::operator~() const
+{
+    return{ ~words_[0], ~words_[1], ~words_[2], ~words_[3] };
+}
+
+inline uint256_t uint256_t::operator-() const
+{
+    auto value = ~(*this);
+    return ++value;
+}
+
+inline uint256_t uint256_t::operator>>(uint32_t shift) const
+{
+    auto value = *this;
+    return value >>= shift;
+}
+
+inline uint256_t uint256_t::operator<<(uint32_t shift) const
+{
+    auto value = *this;
+    return value <<= shift;
+}
+
+inline uint256_t& uint256_t::operator++()
+{
+    for (size_t index = 0; index < word_count; ++index)
+        if (++words_[index] != 0)
+            break;
+
+    return *this;
+}
+
+inline uint256_t& uint256_t::operator>>=(uint32_t shift)
+{
+    const size_t offset = shift / 64u;
+    const auto bits = shift % 64u;
+
+    for (size_t index = 0; index < word_count; ++index)
+    {
+        const auto low = index + offset;
+        const auto high = low + 1u;
+        const auto low_word = low < word_count ? words_[low] : 0;
+        const auto high_word = high < word_count ? words_[high] : 0;
+        words_[index] = bits == 0 ? low_word :
+            (low_word >> bits) | (high_word << (64u - bits));
+    }
+
+    return *this;
+}
+
+inline uint256_t& uint256_t::operator<<=(uint32_t shift)
+{
+    const size_t offset = shift / 64u;
+    const auto bits = shift % 64u;
+
+    for (auto index = word_count; index > 0; --index)
+    {
+        // Indexes that would underflow are instead above the word count.
+        const auto high = index - 1u - offset;
+        const auto low = high - 1u;
+        const auto high_word = high < word_count ? words_[high] : 0;
+        const auto low_word = low < word_count ? words_[low] : 0;
+        words_[index - 1u] = bits == 0 ? high_word :
+            (high_word << bits) | (low_word >> (64u - bits));
+    }
+
+    return *this;
+}
+
+inline uint256_t& uint256_t::operator+=(const uint256_t& value)
+{
+    uint64_t carry = 0;
+
+    for (size_t index = 0; index < word_count; ++index)
+    {
+        const auto sum = words_[index] + value.words_[index];
+        const auto total = sum + carry;
+        carry = (sum < words_[index] ? 1u : 0u) + (total < sum ? 1u : 0u);
+        words_[index] = total;
+    }
+
+    return *this;
+}
+
+inline uint256_t& uint256_t::operator-=(const uint256_t& value)
+{
+    uint64_t borrow = 0;
+
+    for (size_t index = 0; index < word_count; ++index)
+    {
+        const auto difference = words_[index] - value.words_[index];
+        const auto total = difference - borrow;
+        borrow = (difference > words_[index] ? 1u : 0u) +
+            (total > difference ? 1u : 0u);
+        words_[index] = total;
+    }
+
+    return *this;
+}
+
+inline uint256_t& uint256_t::operator*=(uint32_t value)
+{
+    uint64_t carry = 0;
+
+    for (size_t index = 0; index < word_count; ++index)
+    {
+        uint64_t high;
+        const auto low = multiply(words_[index], value, high);
+        words_[index] = low + carry;
+        carry = high + (words_[index] < low ? 1u : 0u);
+    }
+
+    return *this;
+}
+
+// Products above 2^256 are discarded, so only the low half is computed.
+inline uint256_t& uint256_t::operator*=(const uint256_t& value)
+{
+    uint64_t product[word_count] = { 0, 0, 0, 0 };
+
+    for (size_t row = 0; row < word_count; ++row)
+    {
+        uint64_t carry = 0;
+
+        for (size_t column = 0; row + column < word_count; ++column)
+        {
+            uint64_t high;
+            auto low = multiply(words_[column], value.words_[row], high);
+            low += carry;
+            high += (low < carry ? 1u : 0u);
+            auto& word = product[row + column];
+            word += low;
+            carry = high + (word < low ? 1u : 0u);
+        }
+    }
+
+    std::copy(product, product + word_count, words_);
+    return *this;
+}
+
+inline uint256_t& uint256_t::operator/=(uint32_t value)
+{
+    if (value == 0)
+        throw std::overflow_error("division by zero");
+
+    divide(value);
+    return *this;
+}
+
+// This is Knuth's Algorithm D (TAOCP 4.3.1) over 32 bit digits.
+inline uint256_t& uint256_t::operator/=(const uint256_t& value)
+{
+    static BC_CONSTEXPR size_t count = 2 * word_count;
+    static BC_CONSTEXPR uint64_t base = 0x100000000;
+
+    const auto divisor_bits = value.bit_length();
+
+    if (divisor_bits == 0)
+        throw std::overflow_error("division by zero");
+
+    if (divisor_bits <= 32u)
+        return *this /= static_cast<uint32_t>(value.words_[0]);
+
+    if (*this < value)
+        return *this = 0;
+
+    digits dividend;
+    digits divisor;
+    to_digits(dividend);
+    value.to_digits(divisor);
+
+    const auto m = (bit_length() + 31u) / 32u;
+    const auto n = (divisor_bits + 31u) / 32u;
+
+    // Normalize so that the high divisor digit has its high bit set.
+    const auto shift = leading_zeros(divisor[n - 1u]) - 32u;
+    uint32_t normal[count];
+    uint32_t remainder[count + 1u];
+
+    for (auto index = n - 1u; index > 0; --index)
+        normal[index] = static_cast<uint32_t>((divisor[index] << shift) |
+            (uint64_t(divisor[index - 1u]) >> (32u - shift)));
+
+    normal[0] = static_cast<uint32_t>(divisor[0] << shift);
+    remainder[m] = static_cast<uint32_t>(uint64_t(dividend[m - 1u]) >>
+        (32u - shift));
+
+    for (auto index = m - 1u; index > 0; --index)
+        remainder[index] = static_cast<uint32_t>((dividend[index] << shift) |
+            (uint64_t(dividend[index - 1u]) >> (32u - shift)));
+
+    remainder[0] = static_cast<uint32_t>(dividend[0] << shift);
+
+    digits quotient = { 0, 0, 0, 0, 0, 0, 0, 0 };
+
+    for (auto digit = m - n + 1u; digit > 0; --digit)
+    {
+        const auto j = digit - 1u;
+
+        // Estimate the quotient digit from the two high remainder digits.
+        const auto top = (uint64_t(remainder[j + n]) << 32) |
+            remainder[j + n - 1u];
+        auto estimate = top / normal[n - 1u];
+        auto rest = top % normal[n - 1u];
+
+        while (estimate >= base || estimate * normal[n - 2u] >
+            ((rest << 32) | remainder[j + n - 2u]))
+        {
+            --estimate;
+            rest += normal[n - 1u];
+
+            if (rest >= base)
+                break;
+        }
+
+        // Multiply and subtract, the borrow is signed.
+        int64_t borrow = 0;
+        int64_t difference;
+
+        for (size_t index = 0; index < n; ++index)
+        {
+            const auto product = estimate * normal[index];
+            difference = int64_t(remainder[index + j]) - borrow -
+                int64_t(product & 0xffffffff);
+            remainder[index + j] = static_cast<uint32_t>(difference);
+            borrow = int64_t(product >> 32) - (difference >> 32);
+        }
+
+        difference = int64_t(remainder[j + n]) - borrow;
+        remainder[j + n] = static_cast<uint32_t>(difference);
+        quotient[j] = static_cast<uint32_t>(estimate);
+
+        // The estimate was one too large, so add back the divisor.
+        if (difference < 0)
+        {
+            --quotient[j];
+            uint64_t carry = 0;
+
+            for (size_t index = 0; index < n; ++index)
+            {
+                const auto sum = uint64_t(remainder[index + j]) +
+                    normal[index] + carry;
+                remainder[index + j] = static_cast<uint32_t>(sum);
+                carry = sum >> 32;
+            }
+
+            remainder[j + n] += static_cast<uint32_t>(carry);
+        }
+    }
+
+    from_digits(quotient);
+    return *this;
+}
+
+// Private
+//-----------------------------------------------------------------------------
+
+inline size_t uint256_t::leading_zeros(uint64_t value)
+{
+    BITCOIN_ASSERT(value != 0);
+
+#if defined(__GNUC__)
+    return static_cast<size_t>(__builtin_clzll(value));
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return 63u - index;
+#else
+    size_t zeros = 0;
+    for (auto bit = uint64_t(1) << 63; (value & bit) == 0; bit >>= 1)
+        ++zeros;
+
+    return zeros;
+#endif
+}
+
+// Returns the low word of the product and sets the high word.
+inline uint64_t uint256_t::multiply(uint64_t left, uint64_t right,
+    uint64_t& high)
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 uint128_t;
+    const auto product = uint128_t(left) * right;
+    high = static_cast<uint64_t>(product >> 64);
+    return static_cast<uint64_t>(product);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    return _umul128(left, right, &high);
+#else
+    const auto left_low = left & 0xffffffff;
+    const auto left_high = left >> 32;
+    const auto right_low = right & 0xffffffff;
+    const auto right_high = right >> 32;
+
+    const auto low_low = left_low * right_low;
+    const auto high_low = left_high * right_low;
+    const auto low_high = left_low * right_high;
+    const auto high_high = left_high * right_high;
+
+    const auto middle = (low_low >> 32) + (high_low & 0xffffffff) +
+        (low_high & 0xffffffff);
+
+    high = high_high + (high_low >> 32) + (low_high >> 32) + (middle >> 32);
+    return (middle << 32) | (low_low & 0xffffffff);
+#endif
+}
+
+// Divides in place by a nonzero 32 bit divisor and returns the remainder.
+inline uint32_t uint256_t::divide(uint32_t divisor)
+{
+    BITCOIN_ASSERT(divisor != 0);
+
+    digits value;
+    to_digits(value);
+    uint64_t remainder = 0;
+
+    for (auto index = 2 * word_count; index > 0; --index)
+    {
+        const auto current = (remainder << 32) | value[index - 1u];
+        value[index - 1u] = static_cast<uint32_t>(current / divisor);
+        remainder = current % divisor;
+    }
+
+    from_digits(value);
+    return static_cast<uint32_t>(remainder);
+}
+
+inline void uint256_t::to_digits(digits& out) const
+{
+    for (size_t index = 0; index < word_count; ++index)
+    {
+        out[2u * index] = static_cast<uint32_t>(words_[index]);
+        out[2u * index + 1u] = static_cast<uint32_t>(words_[index] >> 32);
+    }
+}
+
+inline void uint256_t::from_digits(const digits& value)
+{
+    for (size_t index = 0; index < word_count; ++index)
+        words_[index] = (uint64_t(value[2u * index + 1u]) << 32) |
+            value[2u * index];
+}
+
+// Comparison
+//-----------------------------------------------------------------------------
+
+BC_CONSTFUNC bool operator==(const uint256_t& left, const uint256_t& right)
+{
+    return left[0] == right[0] && left[1] == right[1] &&
+        left[2] == right[2] && left[3] == right[3];
+}
+
+BC_CONSTFUNC bool operator!=(const uint256_t& left, const uint256_t& right)
+{
+    return !(left == right);
+}
+
+BC_CONSTFUNC bool operator<(const uint256_t& left, const uint256_t& right)
+{
+    return
+        left[3] != right[3] ? left[3] < right[3] :
+        left[2] != right[2] ? left[2] < right[2] :
+        left[1] != right[1] ? left[1] < right[1] :
+        left[0] < right[0];
+}
+
+BC_CONSTFUNC bool operator>(const uint256_t& left, const uint256_t& right)
+{
+    return right < left;
+}
+
+BC_CONSTFUNC bool operator<=(const uint256_t& left, const uint256_t& right)
+{
+    return !(right < left);
+}
+
+BC_CONSTFUNC bool operator>=(const uint256_t& left, const uint256_t& right)
+{
+    return !(left < right);
+}
+
+// Arithmetic
+//-----------------------------------------------------------------------------
+
+inline uint256_t operator+(uint256_t left, const uint256_t& right)
+{
+    return left += right;
+}
+
+inline uint256_t operator-(uint256_t left, const uint256_t& right)
+{
+    return left -= right;
+}
+
+inline uint256_t operator*(uint256_t left, const uint256_t& right)
+{
+    return left *= right;
+}
+
+inline uint256_t operator/(uint256_t left, const uint256_t& right)
+{
+    return left /= right;
+}
+
+// Serialization
+//-----------------------------------------------------------------------------
+
+inline std::ostream& operator<<(std::ostream& output, const uint256_t& value)
+{
+    // Each decimal chunk is a remainder of division by 10^9.
+    static BC_CONSTEXPR uint32_t chunk = 1000000000;
+    std::vector<uint32_t> chunks;
+    auto copy = value;
+
+    do
+    {
+        chunks.push_back(copy.divide(chunk));
+    } while (copy != 0);
+
+    output << chunks.back();
+
+    for (auto it = std::next(chunks.rbegin()); it != chunks.rend(); ++it)
+        output << std::setfill('0') << std::setw(9) << *it;
+
+    return output;
+}
+
+inline uint256_t to_uint256(const hash_digest& hash)
+{
+    return uint256_t(hash);
+}
+
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,70 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_BYTE_READER_IPP
+#define LIBBITCOIN_BYTE_READER_IPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/bitcoin/utility/endian.hpp>
+
+namespace libbitcoin {
+
+inline const uint8_t* byte_reader::consume(size_t size)
+{
+    if (!valid_ || size > static_cast<size_t>(end_ - position_))
+    {
+        valid_ = false;
+        return nullptr;
+    }
+
+    const auto start = position_;
+    position_ += size;
+    return start;
+}
+
+template <size_t Size>
+byte_array<Size> byte_reader::read_forward()
+{
+    byte_array<Size> out{ {} };
+    const auto start = consume(Size);
+
+    if (start != nullptr)
+        std::copy_n(start, Size, out.begin());
+
+    return out;
+}
+
+template <typename Integer>
+Integer byte_reader::read_big_endian()
+{
+    const auto start = consume(sizeof(Integer));
+    return start == nullptr ? 0 : from_big_endian_unsafe<Integer>(start);
+}
+
+template <typename Integer>
+Integer byte_reader::read_little_endian()
+{
+    const auto start = consume(sizeof(Integer));
+    return start == nullptr ? 0 : from_little_endian_unsafe<Integer>(start);
+}
+
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,252 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_COROUTINE_IPP
+#define LIBBITCOIN_COROUTINE_IPP
+
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <future>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <bitcoin/bitcoin/error.hpp>
+
+namespace libbitcoin {
+
+// frame_pool
+// ----------------------------------------------------------------------------
+
+inline frame_pool::lists::~lists()
+{
+    for (auto head: heads)
+    {
+        while (head != nullptr)
+        {
+            const auto next = head->next;
+            ::operator delete(head);
+            head = next;
+        }
+    }
+}
+
+inline frame_pool::lists& frame_pool::local()
+{
+    static thread_local lists instance;
+    return instance;
+}
+
+inline void* frame_pool::allocate(size_t size)
+{
+    const auto index = (size - 1) / granularity;
+    if (size == 0 || index >= classes)
+        return ::operator new(size);
+
+    auto& pool = local();
+    const auto head = pool.heads[index];
+
+    if (head == nullptr)
+        return ::operator new((index + 1) * granularity);
+
+    pool.heads[index] = head->next;
+    --pool.sizes[index];
+    return head;
+}
+
+inline void frame_pool::deallocate(void* frame, size_t size) noexcept
+{
+    const auto index = (size - 1) / granularity;
+    if (size == 0 || index >= classes)
+    {
+        ::operator delete(frame);
+        return;
+    }
+
+    // Retain a bounded number of frames per class, release the excess.
+    auto& pool = local();
+    if (pool.sizes[index] == depth)
+    {
+        ::operator delete(frame);
+        return;
+    }
+
+    const auto released = static_cast<node*>(frame);
+    released->next = pool.heads[index];
+    pool.heads[index] = released;
+    ++pool.sizes[index];
+}
+
+// Composition.
+// ----------------------------------------------------------------------------
+
+namespace detail {
+
+// Awaits the counter, after starting the tasks, unless all have completed.
+template <typename Start>
+class join_awaiter
+{
+public:
+    join_awaiter(join_counter& counter, Start&& start)
+      : counter_(counter), start_(std::forward<Start>(start))
+    {
+    }
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    bool await_suspend(std::coroutine_handle<> awaiting)
+    {
+        counter_.set_waiter(awaiting);
+        start_();
+        return !counter_.arrive();
+    }
+
+    void await_resume() const noexcept
+    {
+    }
+
+private:
+    join_counter& counter_;
+    Start start_;
+};
+
+template <typename Start>
+join_awaiter<Start> join(join_counter& counter, Start&& start)
+{
+    return join_awaiter<Start>(counter, std::forward<Start>(start));
+}
+
+inline detached join_one(const task<void>& job, std::exception_ptr& error,
+    join_counter& counter)
+{
+    try
+    {
+        co_await job;
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+
+    counter.complete();
+}
+
+inline detached join_one(const task<code>& job, code& result,
+    std::exception_ptr& error, join_counter& counter)
+{
+    try
+    {
+        result = co_await job;
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+
+    counter.complete();
+}
+
+inline detached start_one(task<void> job)
+{
+    co_await job;
+}
+
+template <typename Result>
+detached fulfill(task<Result> job, std::promise<Result> result)
+{
+    try
+    {
+        if constexpr (std::is_void<Result>::value)
+        {
+            co_await job;
+            result.set_value();
+        }
+        else
+        {
+            result.set_value(co_await job);
+        }
+    }
+    catch (...)
+    {
+        result.set_exception(std::current_exception());
+    }
+}
+
+} // namespace detail
+
+inline task<void> when_all(std::vector<task<void>> tasks)
+{
+    std::vector<std::exception_ptr> errors(tasks.size());
+    detail::join_counter counter(tasks.size());
+
+    co_await detail::join(counter, [&]()
+    {
+        for (size_t index = 0; index < tasks.size(); ++index)
+            detail::join_one(tasks[index], errors[index], counter);
+    });
+
+    for (const auto& error: errors)
+        if (error)
+            std::rethrow_exception(error);
+}
+
+inline task<code> when_all(std::vector<task<code>> tasks)
+{
+    std::vector<code> results(tasks.size());
+    std::vector<std::exception_ptr> errors(tasks.size());
+    detail::join_counter counter(tasks.size());
+
+    co_await detail::join(counter, [&]()
+    {
+        for (size_t index = 0; index < tasks.size(); ++index)
+            detail::join_one(tasks[index], results[index], errors[index],
+                counter);
+    });
+
+    for (const auto& error: errors)
+        if (error)
+            std::rethrow_exception(error);
+
+    for (const auto& result: results)
+        if (result)
+            co_return result;
+
+    co_return error::success;
+}
+
+inline void spawn(task<void>&& job)
+{
+    detail::start_one(std::move(job));
+}
+
+template <typename Result>
+Result sync_wait(task<Result>&& job)
+{
+    std::promise<Result> result;
+    auto future = result.get_future();
+    detail::fulfill(std::move(job), std::move(result));
+    return future.get();
+}
+
+} // namespace libbitcoin
+
+#endif
@@ -64,7 +64,7 @@ template <typename Iterator, bool CheckSafe>
 bool deserializer<Iterator, CheckSafe>::is_exhausted() const
 {
     // This is always true in an unsafe reader.
-    return !valid_ || remaining() == 0;
+    return !valid_ || available() == 0;
 }
 
 template <typename Iterator, bool CheckSafe>
@@ -186,6 +186,13 @@ uint64_t deserializer<Iterator, CheckSafe>::read_8_bytes_little_endian()
 template <typename Iterator, bool CheckSafe>
 uint64_t deserializer<Iterator, CheckSafe>::read_variable_little_endian()
 {
+    typedef std::integral_constant<bool,
+        CheckSafe && is_contiguous_bytes<Iterator>::value> contiguous;
+
+    uint64_t size;
+    if (read_variable_in_place(size, contiguous()))
+        return size;
+
     const auto value = read_byte();
 
     switch (value)
@@ -215,6 +222,37 @@ size_t deserializer<Iterator, CheckSafe>::read_size_little_endian()
     return 0;
 }
 
+template <typename Iterator, bool CheckSafe>
+uint64_t deserializer<Iterator, CheckSafe>::read_variable_base128()
+{
+    uint64_t value = 0;
+
+    // Each continued group is stored less one, so each value has one form.
+    while (true)
+    {
+        const auto byte = read_byte();
+
+        if (value > (max_uint64 >> 7))
+        {
+            invalidate();
+            return 0;
+        }
+
+        value = (value << 7) | (byte & 0x7f);
+
+        if ((byte & 0x80) == 0)
+            return value;
+
+        if (value == max_uint64)
+        {
+            invalidate();
+            return 0;
+        }
+
+        ++value;
+    }
+}
+
 // Bytes.
 //-----------------------------------------------------------------------------
 
@@ -240,7 +278,7 @@ template <typename Iterator, bool CheckSafe>
 data_chunk deserializer<Iterator, CheckSafe>::read_bytes()
 {
     // This read is always safe but always reads zero bytes in unsafe reader.
-    return read_bytes(remaining());
+    return read_bytes(available());
 }
 
 // Return size is guaranteed.
@@ -264,6 +302,23 @@ data_chunk deserializer<Iterator, CheckSafe>::read_bytes(size_t size)
     return out;
 }
 
+template <typename Iterator, bool CheckSafe>
+void deserializer<Iterator, CheckSafe>::read_bytes(data_chunk& out,
+    size_t size)
+{
+    out.assign(size, 0);
+
+    if (!safe(size))
+        invalidate();
+
+    if (!valid_ || size == 0)
+        return;
+
+    const auto begin = iterator_;
+    iterator_ += size;
+    std::copy_n(begin, size, out.begin());
+}
+
 template <typename Iterator, bool CheckSafe>
 std::string deserializer<Iterator, CheckSafe>::read_string()
 {
@@ -380,6 +435,38 @@ Integer deserializer<Iterator, CheckSafe>::read_little_endian()
 
 // private
 
+template <typename Iterator, bool CheckSafe>
+bool deserializer<Iterator, CheckSafe>::read_variable_in_place(uint64_t&,
+    std::false_type)
+{
+    return false;
+}
+
+// With the widest form in bounds the value is one load, truncated to width.
+template <typename Iterator, bool CheckSafe>
+bool deserializer<Iterator, CheckSafe>::read_variable_in_place(uint64_t& out,
+    std::true_type)
+{
+    if (!valid_ || available() <= sizeof(uint64_t))
+        return false;
+
+    const auto prefix = *iterator_++;
+
+    if (prefix < varint_two_bytes)
+    {
+        out = prefix;
+        return true;
+    }
+
+    const auto value = load_little_endian<uint64_t>(&*iterator_);
+    const auto size = size_t(2) << (prefix - varint_two_bytes);
+    iterator_ += size;
+
+    out = size == sizeof(uint64_t) ? value :
+        value & ((uint64_t(1) << (size * byte_bits)) - 1);
+    return true;
+}
+
 template <typename Iterator, bool CheckSafe>
 bool deserializer<Iterator, CheckSafe>::safe(size_t size) const
 {
@@ -387,11 +474,18 @@ bool deserializer<Iterator, CheckSafe>::safe(size_t size) const
     if (!CheckSafe)
         return true;
 
-    return size <= remaining();
+    return size <= available();
 }
 
 template <typename Iterator, bool CheckSafe>
 size_t deserializer<Iterator, CheckSafe>::remaining() const
+{
+    // An unsafe reader does not know its end.
+    return CheckSafe ? available() : max_size_t;
+}
+
+template <typename Iterator, bool CheckSafe>
+size_t deserializer<Iterator, CheckSafe>::available() const
 {
     return std::distance(iterator_, end_);
 }
@@ -19,13 +19,127 @@
 #ifndef LIBBITCOIN_ENDIAN_IPP
 #define LIBBITCOIN_ENDIAN_IPP
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <type_traits>
+#include <bitcoin/bitcoin/utility/data.hpp>
+
+#ifdef _MSC_VER
+#include <stdlib.h>
+#endif
 
 namespace libbitcoin {
 
+// Hosts other than gcc/clang big endian are treated as little endian (msvc).
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && \
+    (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    #define BC_BIG_ENDIAN_HOST
+#endif
+
 #define VERIFY_UNSIGNED(T) static_assert(std::is_unsigned<T>::value, \
     "The endian functions only work on unsigned types")
 
+// Iterators over contiguous bytes, which are read and written as one
+// unaligned move and a byte swap (if the host order differs).
+template <typename Iterator>
+struct is_contiguous_bytes
+  : std::integral_constant<bool,
+        std::is_same<Iterator, uint8_t*>::value ||
+        std::is_same<Iterator, const uint8_t*>::value ||
+        std::is_same<Iterator, data_chunk::iterator>::value ||
+        std::is_same<Iterator, data_chunk::const_iterator>::value>
+{
+};
+
+template <size_t Size>
+struct byte_swapper;
+
+template <>
+struct byte_swapper<1>
+{
+    template <typename Integer>
+    static Integer swap(Integer value)
+    {
+        return value;
+    }
+};
+
+template <>
+struct byte_swapper<2>
+{
+    template <typename Integer>
+    static Integer swap(Integer value)
+    {
+#if defined(_MSC_VER)
+        return static_cast<Integer>(_byteswap_ushort(value));
+#elif defined(__GNUC__)
+        return static_cast<Integer>(__builtin_bswap16(value));
+#else
+        return static_cast<Integer>((value << 8) | (value >> 8));
+#endif
+    }
+};
+
+template <>
+struct byte_swapper<4>
+{
+    template <typename Integer>
+    static Integer swap(Integer value)
+    {
+#if defined(_MSC_VER)
+        return static_cast<Integer>(_byteswap_ulong(value));
+#elif defined(__GNUC__)
+        return static_cast<Integer>(__builtin_bswap32(value));
+#else
+        value = ((value << 8) & 0xff00ff00) | ((value >> 8) & 0x00ff00ff);
+        return (value << 16) | (value >> 16);
+#endif
+    }
+};
+
+template <>
+struct byte_swapper<8>
+{
+    template <typename Integer>
+    static Integer swap(Integer value)
+    {
+#if defined(_MSC_VER)
+        return static_cast<Integer>(_byteswap_uint64(value));
+#elif defined(__GNUC__)
+        return static_cast<Integer>(__builtin_bswap64(value));
+#else
+        value = ((value << 8) & 0xff00ff00ff00ff00) |
+            ((value >> 8) & 0x00ff00ff00ff00ff);
+        value = ((value << 16) & 0xffff0000ffff0000) |
+            ((value >> 16) & 0x0000ffff0000ffff);
+        return (value << 32) | (value >> 32);
+#endif
+    }
+};
+
+// Convert between host order and little or big endian order (symmetrical).
+template <typename Integer>
+Integer little_endian_order(Integer value)
+{
+#ifdef BC_BIG_ENDIAN_HOST
+    return byte_swapper<sizeof(Integer)>::swap(value);
+#else
+    return value;
+#endif
+}
+
+template <typename Integer>
+Integer big_endian_order(Integer value)
+{
+#ifdef BC_BIG_ENDIAN_HOST
+    return value;
+#else
+    return byte_swapper<sizeof(Integer)>::swap(value);
+#endif
+}
+
 template <typename Integer, typename Iterator>
 Integer from_big_endian(Iterator start, const Iterator end)
 {
@@ -54,9 +168,8 @@ Integer from_little_endian(Iterator start, const Iterator end)
 }
 
 template <typename Integer, typename Iterator>
-Integer from_big_endian_unsafe(Iterator start)
+Integer from_big_endian_unsafe(Iterator start, std::false_type)
 {
-    VERIFY_UNSIGNED(Integer);
     Integer out = 0;
     size_t i = sizeof(Integer);
 
@@ -67,9 +180,24 @@ Integer from_big_endian_unsafe(Iterator start)
 }
 
 template <typename Integer, typename Iterator>
-Integer from_little_endian_unsafe(Iterator start)
+Integer from_big_endian_unsafe(Iterator start, std::true_type)
+{
+    Integer out;
+    std::memcpy(&out, &*start, sizeof(Integer));
+    return big_endian_order(out);
+}
+
+template <typename Integer, typename Iterator>
+Integer from_big_endian_unsafe(Iterator start)
 {
     VERIFY_UNSIGNED(Integer);
+    return from_big_endian_unsafe<Integer>(start,
+        is_contiguous_bytes<Iterator>());
+}
+
+template <typename Integer, typename Iterator>
+Integer from_little_endian_unsafe(Iterator start, std::false_type)
+{
     Integer out = 0;
     size_t i = 0;
 
@@ -79,6 +207,22 @@ Integer from_little_endian_unsafe(Iterator start)
     return out;
 }
 
+template <typename Integer, typename Iterator>
+Integer from_little_endian_unsafe(Iterator start, std::true_type)
+{
+    Integer out;
+    std::memcpy(&out, &*start, sizeof(Integer));
+    return little_endian_order(out);
+}
+
+template <typename Integer, typename Iterator>
+Integer from_little_endian_unsafe(Iterator start)
+{
+    VERIFY_UNSIGNED(Integer);
+    return from_little_endian_unsafe<Integer>(start,
+        is_contiguous_bytes<Iterator>());
+}
+
 template <typename Integer>
 Integer from_big_endian_stream_unsafe(std::istream& stream)
 {
@@ -116,13 +260,7 @@ byte_array<sizeof(Integer)> to_big_endian(Integer value)
 {
     VERIFY_UNSIGNED(Integer);
     byte_array<sizeof(Integer)> out;
-
-    for (auto it = out.rbegin(); it != out.rend(); ++it)
-    {
-        *it = static_cast<uint8_t>(value);
-        value >>= 8;
-    }
-
+    store_big_endian(out.data(), value);
     return out;
 }
 
@@ -131,16 +269,39 @@ byte_array<sizeof(Integer)> to_little_endian(Integer value)
 {
     VERIFY_UNSIGNED(Integer);
     byte_array<sizeof(Integer)> out;
+    store_little_endian(out.data(), value);
+    return out;
+}
 
-    for (auto it = out.begin(); it != out.end(); ++it)
-    {
-        *it = static_cast<uint8_t>(value);
-        value >>= 8;
-    }
+template <typename Integer>
+Integer load_big_endian(const uint8_t* data)
+{
+    return from_big_endian_unsafe<Integer>(data);
+}
 
-    return out;
+template <typename Integer>
+Integer load_little_endian(const uint8_t* data)
+{
+    return from_little_endian_unsafe<Integer>(data);
+}
+
+template <typename Integer>
+void store_big_endian(uint8_t* data, Integer value)
+{
+    VERIFY_UNSIGNED(Integer);
+    value = big_endian_order(value);
+    std::memcpy(data, &value, sizeof(Integer));
+}
+
+template <typename Integer>
+void store_little_endian(uint8_t* data, Integer value)
+{
+    VERIFY_UNSIGNED(Integer);
+    value = little_endian_order(value);
+    std::memcpy(data, &value, sizeof(Integer));
 }
 
+#undef BC_BIG_ENDIAN_HOST
 #undef VERIFY_UNSIGNED
 
 } // namespace libbitcoin
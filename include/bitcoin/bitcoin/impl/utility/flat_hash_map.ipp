@@ -0,0 +1,353 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_FLAT_HASH_MAP_IPP
+#define LIBBITCOIN_FLAT_HASH_MAP_IPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <bitcoin/bitcoin/constants.hpp>
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #define FLAT_HASH_MAP_SSE2
+    #include <emmintrin.h>
+#endif
+
+namespace libbitcoin {
+
+// Control bytes below empty hold the low seven bits of a live key's hash.
+static BC_CONSTEXPR uint8_t flat_hash_empty = 0x80;
+static BC_CONSTEXPR uint8_t flat_hash_erased = 0xfe;
+static BC_CONSTEXPR size_t flat_hash_not_found = max_size_t;
+
+template <typename Key, typename Value, typename Hash>
+flat_hash_map<Key, Value, Hash>::flat_hash_map(size_t entries)
+  : groups_(0), size_(0), erased_(0)
+{
+    reserve(entries);
+}
+
+template <typename Key, typename Value, typename Hash>
+void flat_hash_map<Key, Value, Hash>::reserve(size_t entries)
+{
+    const auto groups = to_groups(entries);
+
+    if (groups > groups_)
+        rehash(groups);
+}
+
+template <typename Key, typename Value, typename Hash>
+bool flat_hash_map<Key, Value, Hash>::insert(const Key& key, Value value)
+{
+    const auto hash = hasher_(key);
+
+    if (locate(key, hash) != flat_hash_not_found)
+        return false;
+
+    slots_[add(key, hash)].second = std::move(value);
+    return true;
+}
+
+template <typename Key, typename Value, typename Hash>
+Value& flat_hash_map<Key, Value, Hash>::operator[](const Key& key)
+{
+    const auto hash = hasher_(key);
+    const auto slot = locate(key, hash);
+    return slots_[slot == flat_hash_not_found ? add(key, hash) : slot].second;
+}
+
+template <typename Key, typename Value, typename Hash>
+Value* flat_hash_map<Key, Value, Hash>::find(const Key& key)
+{
+    const auto slot = locate(key, hasher_(key));
+    return slot == flat_hash_not_found ? nullptr : &slots_[slot].second;
+}
+
+template <typename Key, typename Value, typename Hash>
+const Value* flat_hash_map<Key, Value, Hash>::find(const Key& key) const
+{
+    const auto slot = locate(key, hasher_(key));
+    return slot == flat_hash_not_found ? nullptr : &slots_[slot].second;
+}
+
+template <typename Key, typename Value, typename Hash>
+bool flat_hash_map<Key, Value, Hash>::contains(const Key& key) const
+{
+    return locate(key, hasher_(key)) != flat_hash_not_found;
+}
+
+// A probe ends at a group with an empty slot, so no probe has passed a group
+// that has one, and such a slot can be emptied rather than marked erased.
+template <typename Key, typename Value, typename Hash>
+bool flat_hash_map<Key, Value, Hash>::erase(const Key& key)
+{
+    const auto slot = locate(key, hasher_(key));
+
+    if (slot == flat_hash_not_found)
+        return false;
+
+    const auto group = &controls_[slot - (slot % group_size)];
+
+    if (match_empty(group) != 0)
+    {
+        controls_[slot] = flat_hash_empty;
+    }
+    else
+    {
+        controls_[slot] = flat_hash_erased;
+        ++erased_;
+    }
+
+    // Release any resources of the entry.
+    slots_[slot] = value_type();
+    --size_;
+    return true;
+}
+
+template <typename Key, typename Value, typename Hash>
+void flat_hash_map<Key, Value, Hash>::clear()
+{
+    for (size_t slot = 0; slot < capacity(); ++slot)
+    {
+        if (controls_[slot] < flat_hash_empty)
+            slots_[slot] = value_type();
+
+        controls_[slot] = flat_hash_empty;
+    }
+
+    size_ = 0;
+    erased_ = 0;
+}
+
+template <typename Key, typename Value, typename Hash>
+void flat_hash_map<Key, Value, Hash>::shrink_to_fit()
+{
+    const auto groups = to_groups(size_);
+
+    if (groups < groups_)
+        rehash(groups);
+}
+
+template <typename Key, typename Value, typename Hash>
+bool flat_hash_map<Key, Value, Hash>::empty() const
+{
+    return size_ == 0;
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t flat_hash_map<Key, Value, Hash>::size() const
+{
+    return size_;
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t flat_hash_map<Key, Value, Hash>::capacity() const
+{
+    return groups_ * group_size;
+}
+
+template <typename Key, typename Value, typename Hash>
+template <typename Handler>
+void flat_hash_map<Key, Value, Hash>::for_each(Handler&& handler) const
+{
+    for (size_t slot = 0; slot < capacity(); ++slot)
+        if (controls_[slot] < flat_hash_empty)
+            handler(slots_[slot].first, slots_[slot].second);
+}
+
+// private
+//-----------------------------------------------------------------------------
+
+// The load is limited to 7/8 of slots, and groups are a power of two.
+template <typename Key, typename Value, typename Hash>
+size_t flat_hash_map<Key, Value, Hash>::to_groups(size_t entries)
+{
+    if (entries == 0)
+        return 0;
+
+    const auto slots = entries + entries / 7 + 1;
+    const auto minimum = (slots + group_size - 1) / group_size;
+    size_t groups = 1;
+
+    while (groups < minimum)
+        groups <<= 1;
+
+    return groups;
+}
+
+// Bit i of each match is set if control byte i of the group qualifies.
+template <typename Key, typename Value, typename Hash>
+uint32_t flat_hash_map<Key, Value, Hash>::match(const uint8_t* group,
+    uint8_t control)
+{
+#ifdef FLAT_HASH_MAP_SSE2
+    const auto controls = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(group));
+    const auto value = _mm_set1_epi8(static_cast<char>(control));
+    return static_cast<uint32_t>(_mm_movemask_epi8(
+        _mm_cmpeq_epi8(controls, value)));
+#else
+    uint32_t mask = 0;
+
+    for (size_t slot = 0; slot < group_size; ++slot)
+        if (group[slot] == control)
+            mask |= uint32_t(1) << slot;
+
+    return mask;
+#endif
+}
+
+template <typename Key, typename Value, typename Hash>
+uint32_t flat_hash_map<Key, Value, Hash>::match_empty(const uint8_t* group)
+{
+    return match(group, flat_hash_empty);
+}
+
+// Empty and erased controls are those with the high bit set.
+template <typename Key, typename Value, typename Hash>
+uint32_t flat_hash_map<Key, Value, Hash>::match_free(const uint8_t* group)
+{
+#ifdef FLAT_HASH_MAP_SSE2
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(group))));
+#else
+    uint32_t mask = 0;
+
+    for (size_t slot = 0; slot < group_size; ++slot)
+        if (group[slot] >= flat_hash_empty)
+            mask |= uint32_t(1) << slot;
+
+    return mask;
+#endif
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t flat_hash_map<Key, Value, Hash>::lowest(uint32_t mask)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<size_t>(__builtin_ctz(mask));
+#else
+    size_t index = 0;
+
+    for (; (mask & 1) == 0; mask >>= 1)
+        ++index;
+
+    return index;
+#endif
+}
+
+// Groups are probed triangularly, which visits each group once.
+template <typename Key, typename Value, typename Hash>
+size_t flat_hash_map<Key, Value, Hash>::locate(const Key& key,
+    size_t hash) const
+{
+    const auto control = static_cast<uint8_t>(hash & 0x7f);
+    auto group = (hash >> 7) & (groups_ - 1);
+
+    for (size_t step = 1; step <= groups_; ++step)
+    {
+        const auto base = group * group_size;
+        const auto controls = &controls_[base];
+
+        for (auto mask = match(controls, control); mask != 0; mask &= mask - 1)
+        {
+            const auto slot = base + lowest(mask);
+
+            if (slots_[slot].first == key)
+                return slot;
+        }
+
+        if (match_empty(controls) != 0)
+            break;
+
+        group = (group + step) & (groups_ - 1);
+    }
+
+    return flat_hash_not_found;
+}
+
+// The key must not be present.
+template <typename Key, typename Value, typename Hash>
+size_t flat_hash_map<Key, Value, Hash>::add(const Key& key, size_t hash)
+{
+    // Erased slots are counted, since they also lengthen probes.
+    if ((size_ + erased_ + 1) * 8 > capacity() * 7)
+        rehash(std::max(groups_, to_groups(size_ + 1)));
+
+    const auto slot = claim(hash);
+    slots_[slot].first = key;
+    return slot;
+}
+
+// The claimed slot is the first free slot of the probe sequence, which
+// exists as the load is limited.
+template <typename Key, typename Value, typename Hash>
+size_t flat_hash_map<Key, Value, Hash>::claim(size_t hash)
+{
+    auto group = (hash >> 7) & (groups_ - 1);
+
+    for (size_t step = 1; ; ++step)
+    {
+        const auto base = group * group_size;
+        const auto mask = match_free(&controls_[base]);
+
+        if (mask != 0)
+        {
+            const auto slot = base + lowest(mask);
+
+            if (controls_[slot] == flat_hash_erased)
+                --erased_;
+
+            controls_[slot] = static_cast<uint8_t>(hash & 0x7f);
+            ++size_;
+            return slot;
+        }
+
+        group = (group + step) & (groups_ - 1);
+    }
+}
+
+template <typename Key, typename Value, typename Hash>
+void flat_hash_map<Key, Value, Hash>::rehash(size_t groups)
+{
+    const auto old_capacity = capacity();
+    const auto old_controls = std::move(controls_);
+    const auto old_slots = std::move(slots_);
+
+    groups_ = groups;
+    size_ = 0;
+    erased_ = 0;
+    controls_.reset(new uint8_t[capacity()]);
+    slots_.reset(new value_type[capacity()]);
+    std::fill(controls_.get(), controls_.get() + capacity(), flat_hash_empty);
+
+    for (size_t slot = 0; slot < old_capacity; ++slot)
+    {
+        if (old_controls[slot] < flat_hash_empty)
+        {
+            auto& entry = old_slots[slot];
+            slots_[claim(hasher_(entry.first))] = std::move(entry);
+        }
+    }
+}
+
+} // namespace libbitcoin
+
+#endif
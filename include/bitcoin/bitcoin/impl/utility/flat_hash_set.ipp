@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_FLAT_HASH_SET_IPP
+#define LIBBITCOIN_FLAT_HASH_SET_IPP
+
+#include <cstddef>
+
+namespace libbitcoin {
+
+template <typename Key, typename Hash>
+flat_hash_set<Key, Hash>::flat_hash_set(size_t keys)
+  : map_(keys)
+{
+}
+
+template <typename Key, typename Hash>
+void flat_hash_set<Key, Hash>::reserve(size_t keys)
+{
+    map_.reserve(keys);
+}
+
+template <typename Key, typename Hash>
+bool flat_hash_set<Key, Hash>::insert(const Key& key)
+{
+    return map_.insert(key, none());
+}
+
+template <typename Key, typename Hash>
+bool flat_hash_set<Key, Hash>::contains(const Key& key) const
+{
+    return map_.contains(key);
+}
+
+template <typename Key, typename Hash>
+bool flat_hash_set<Key, Hash>::erase(const Key& key)
+{
+    return map_.erase(key);
+}
+
+template <typename Key, typename Hash>
+void flat_hash_set<Key, Hash>::clear()
+{
+    map_.clear();
+}
+
+template <typename Key, typename Hash>
+bool flat_hash_set<Key, Hash>::empty() const
+{
+    return map_.empty();
+}
+
+template <typename Key, typename Hash>
+size_t flat_hash_set<Key, Hash>::size() const
+{
+    return map_.size();
+}
+
+template <typename Key, typename Hash>
+size_t flat_hash_set<Key, Hash>::capacity() const
+{
+    return map_.capacity();
+}
+
+template <typename Key, typename Hash>
+template <typename Handler>
+void flat_hash_set<Key, Hash>::for_each(Handler&& handler) const
+{
+    map_.for_each([&handler](const Key& key, const none&)
+    {
+        handler(key);
+    });
+}
+
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,228 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_KEYED_PENDING_IPP
+#define LIBBITCOIN_KEYED_PENDING_IPP
+
+#include <cstddef>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/utility/thread.hpp>
+
+namespace libbitcoin {
+
+template <class Element, class Key, class KeyOf, class Hash>
+keyed_pending<Element, Key, KeyOf, Hash>::keyed_pending(
+    size_t initial_capacity, const KeyOf& key_of)
+  : key_of_(key_of),
+    stopped_(false)
+{
+    elements_.reserve(initial_capacity);
+}
+
+template <class Element, class Key, class KeyOf, class Hash>
+keyed_pending<Element, Key, KeyOf, Hash>::~keyed_pending()
+{
+    ////BITCOIN_ASSERT_MSG(elements_.empty(), "Pending collection not cleared.");
+}
+
+template <class Element, class Key, class KeyOf, class Hash>
+typename keyed_pending<Element, Key, KeyOf, Hash>::elements
+keyed_pending<Element, Key, KeyOf, Hash>::collection() const
+{
+    elements out;
+
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    shared_lock lock(mutex_);
+
+    out.reserve(elements_.size());
+
+    for (const auto& entry: elements_)
+        out.push_back(entry.second);
+
+    return out;
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+template <class Element, class Key, class KeyOf, class Hash>
+size_t keyed_pending<Element, Key, KeyOf, Hash>::size() const
+{
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    shared_lock lock(mutex_);
+
+    return elements_.size();
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+template <class Element, class Key, class KeyOf, class Hash>
+bool keyed_pending<Element, Key, KeyOf, Hash>::exists(const Key& key) const
+{
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    shared_lock lock(mutex_);
+
+    return elements_.find(key) != elements_.end();
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+template <class Element, class Key, class KeyOf, class Hash>
+typename keyed_pending<Element, Key, KeyOf, Hash>::element_ptr
+keyed_pending<Element, Key, KeyOf, Hash>::find(const Key& key) const
+{
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    shared_lock lock(mutex_);
+
+    const auto it = elements_.find(key);
+    return it == elements_.end() ? nullptr : it->second;
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+template <class Element, class Key, class KeyOf, class Hash>
+code keyed_pending<Element, Key, KeyOf, Hash>::store(element_ptr element)
+{
+    // Compute the key outside of the lock.
+    auto key = key_of_(*element);
+
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    mutex_.lock_upgrade();
+
+    const auto stopped = stopped_.load();
+
+    if (!stopped && elements_.find(key) == elements_.end())
+    {
+        mutex_.unlock_upgrade_and_lock();
+        //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        elements_.emplace(std::move(key), element);
+        //---------------------------------------------------------------------
+        mutex_.unlock();
+        return error::success;
+    }
+
+    mutex_.unlock_upgrade();
+    ///////////////////////////////////////////////////////////////////////////
+
+    // Stopped and found are the only ways to get here.
+    return stopped ? error::service_stopped : error::address_in_use;
+}
+
+template <class Element, class Key, class KeyOf, class Hash>
+void keyed_pending<Element, Key, KeyOf, Hash>::remove(element_ptr element)
+{
+    const auto key = key_of_(*element);
+
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    mutex_.lock_upgrade();
+
+    const auto it = elements_.find(key);
+
+    // Another element may hold the key, so match the element itself.
+    if (it != elements_.end() && it->second == element)
+    {
+        mutex_.unlock_upgrade_and_lock();
+        //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        elements_.erase(it);
+        //---------------------------------------------------------------------
+        mutex_.unlock();
+        return;
+    }
+
+    mutex_.unlock_upgrade();
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+template <class Element, class Key, class KeyOf, class Hash>
+typename keyed_pending<Element, Key, KeyOf, Hash>::element_ptr
+keyed_pending<Element, Key, KeyOf, Hash>::remove(const Key& key)
+{
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    mutex_.lock_upgrade();
+
+    const auto it = elements_.find(key);
+
+    if (it != elements_.end())
+    {
+        mutex_.unlock_upgrade_and_lock();
+        //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        const auto element = it->second;
+        elements_.erase(it);
+        //---------------------------------------------------------------------
+        mutex_.unlock();
+        return element;
+    }
+
+    mutex_.unlock_upgrade();
+    ///////////////////////////////////////////////////////////////////////////
+
+    return nullptr;
+}
+
+// This is idempotent.
+template <class Element, class Key, class KeyOf, class Hash>
+void keyed_pending<Element, Key, KeyOf, Hash>::stop(const code& ec)
+{
+    elements copy;
+
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    mutex_.lock_upgrade();
+
+    if (!stopped_)
+    {
+        mutex_.unlock_upgrade_and_lock();
+        //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        stopped_ = true;
+        //---------------------------------------------------------------------
+        mutex_.unlock_and_lock_upgrade();
+
+        // Once stopped list cannot increase, but copy to escape lock.
+        copy.reserve(elements_.size());
+
+        for (const auto& entry: elements_)
+            copy.push_back(entry.second);
+    }
+
+    mutex_.unlock_upgrade();
+    ///////////////////////////////////////////////////////////////////////////
+
+    for (const auto element: copy)
+        element->stop(ec);
+}
+
+template <class Element, class Key, class KeyOf, class Hash>
+void keyed_pending<Element, Key, KeyOf, Hash>::close()
+{
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    unique_lock lock(mutex_);
+
+    // Close should block until element has freed all resources.
+    for (const auto& entry: elements_)
+        entry.second->close();
+
+    elements_.clear();
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,544 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_MPMC_QUEUE_IPP
+#define LIBBITCOIN_MPMC_QUEUE_IPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
+
+namespace libbitcoin {
+
+template <class Type>
+mpmc_queue<Type>::mpmc_queue(size_t capacity)
+  : mask_(round_up(capacity) - 1),
+    storage_(new char[(mask_ + 1) * stride() + cache_line]),
+    slots_(align(storage_.get())),
+    closed_(false),
+    consumers_waiting_(0),
+    producers_waiting_(0)
+{
+    for (size_t index = 0; index <= mask_; ++index)
+    {
+        const auto cell = new (slots_ + index * stride()) slot();
+        cell->sequence.store(index, std::memory_order_relaxed);
+    }
+
+    head_.value.store(0, std::memory_order_relaxed);
+    tail_.value.store(0, std::memory_order_relaxed);
+}
+
+template <class Type>
+mpmc_queue<Type>::~mpmc_queue()
+{
+    for (size_t index = 0; index <= mask_; ++index)
+        at(index).~slot();
+}
+
+template <class Type>
+size_t mpmc_queue<Type>::round_up(size_t capacity)
+{
+    size_t size = 2;
+
+    while (size < capacity)
+        size <<= 1;
+
+    return size;
+}
+
+// Each slot occupies whole cache lines, so neighbors never share a line.
+template <class Type>
+size_t mpmc_queue<Type>::stride()
+{
+    return (sizeof(slot) + cache_line - 1) / cache_line * cache_line;
+}
+
+template <class Type>
+char* mpmc_queue<Type>::align(char* storage)
+{
+    const auto address = reinterpret_cast<uintptr_t>(storage);
+    const auto offset = (cache_line - address % cache_line) % cache_line;
+    return storage + offset;
+}
+
+template <class Type>
+typename mpmc_queue<Type>::slot& mpmc_queue<Type>::at(size_t position) const
+{
+    return *reinterpret_cast<slot*>(slots_ + (position & mask_) * stride());
+}
+
+template <class Type>
+size_t mpmc_queue<Type>::capacity() const
+{
+    return mask_ + 1;
+}
+
+template <class Type>
+size_t mpmc_queue<Type>::size() const
+{
+    const auto tail = tail_.value.load(std::memory_order_acquire);
+    const auto head = head_.value.load(std::memory_order_acquire);
+    return head > tail ? std::min(head - tail, capacity()) : 0;
+}
+
+template <class Type>
+bool mpmc_queue<Type>::empty() const
+{
+    return !can_pop();
+}
+
+template <class Type>
+bool mpmc_queue<Type>::closed() const
+{
+    return closed_.load(std::memory_order_acquire);
+}
+
+template <class Type>
+void mpmc_queue<Type>::close()
+{
+    std::deque<parked> stopped;
+    closed_.store(true, std::memory_order_release);
+
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    std::unique_lock<std::mutex> lock(mutex_);
+    consumers_waiting_.fetch_sub(parked_.size());
+    stopped.swap(parked_);
+    not_empty_.notify_all();
+    not_full_.notify_all();
+    lock.unlock();
+    ///////////////////////////////////////////////////////////////////////////
+
+    for (const auto& consumer: stopped)
+        consumer.pool->service().post(std::bind(consumer.handle,
+            error::service_stopped, Type()));
+}
+
+// Claims.
+// ----------------------------------------------------------------------------
+
+// Claim up to maximum consecutive free positions, returning the count.
+template <class Type>
+size_t mpmc_queue<Type>::claim_push(size_t maximum, size_t& first)
+{
+    auto position = head_.value.load(std::memory_order_relaxed);
+
+    while (maximum != 0)
+    {
+        size_t count = 0;
+
+        // A slot is free at this lap when its sequence equals the position.
+        while (count < maximum && at(position + count).sequence.load(
+            std::memory_order_acquire) == position + count)
+            ++count;
+
+        if (count == 0)
+        {
+            const auto sequence = at(position).sequence.load(
+                std::memory_order_acquire);
+
+            // The slot holds the value of the previous lap, so full.
+            if (static_cast<intptr_t>(sequence - position) < 0)
+                return 0;
+
+            // Another producer claimed the position, reload and retry.
+            position = head_.value.load(std::memory_order_relaxed);
+            continue;
+        }
+
+        // Failure reloads the position.
+        if (head_.value.compare_exchange_weak(position, position + count,
+            std::memory_order_relaxed))
+        {
+            first = position;
+            return count;
+        }
+    }
+
+    return 0;
+}
+
+// Claim up to maximum consecutive published positions, returning the count.
+template <class Type>
+size_t mpmc_queue<Type>::claim_pop(size_t maximum, size_t& first)
+{
+    auto position = tail_.value.load(std::memory_order_relaxed);
+
+    while (maximum != 0)
+    {
+        size_t count = 0;
+
+        // A slot is published when its sequence follows the position.
+        while (count < maximum && at(position + count).sequence.load(
+            std::memory_order_acquire) == position + count + 1)
+            ++count;
+
+        if (count == 0)
+        {
+            const auto sequence = at(position).sequence.load(
+                std::memory_order_acquire);
+
+            // The producer of the position has not published, so empty.
+            if (static_cast<intptr_t>(sequence - (position + 1)) < 0)
+                return 0;
+
+            // Another consumer claimed the position, reload and retry.
+            position = tail_.value.load(std::memory_order_relaxed);
+            continue;
+        }
+
+        if (tail_.value.compare_exchange_weak(position, position + count,
+            std::memory_order_relaxed))
+        {
+            first = position;
+            return count;
+        }
+    }
+
+    return 0;
+}
+
+template <class Type>
+bool mpmc_queue<Type>::can_push() const
+{
+    while (true)
+    {
+        const auto position = head_.value.load(std::memory_order_relaxed);
+        const auto sequence = at(position).sequence.load(
+            std::memory_order_acquire);
+        const auto lag = static_cast<intptr_t>(sequence - position);
+
+        // A stale position is reloaded.
+        if (lag <= 0)
+            return lag == 0;
+    }
+}
+
+template <class Type>
+bool mpmc_queue<Type>::can_pop() const
+{
+    while (true)
+    {
+        const auto position = tail_.value.load(std::memory_order_relaxed);
+        const auto sequence = at(position).sequence.load(
+            std::memory_order_acquire);
+        const auto lag = static_cast<intptr_t>(sequence - (position + 1));
+
+        // A stale position is reloaded.
+        if (lag <= 0)
+            return lag == 0;
+    }
+}
+
+// Notification.
+// ----------------------------------------------------------------------------
+// A waiter registers under the lock and then checks the queue, a publisher
+// publishes and then checks for waiters, each separated by a full fence. So
+// either the waiter sees the values or the publisher sees the waiter, and the
+// publisher locks (only) to wake waiters, which cannot be between check and
+// wait while it holds the lock.
+
+template <class Type>
+void mpmc_queue<Type>::published(size_t count)
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (consumers_waiting_.load(std::memory_order_relaxed) == 0)
+        return;
+
+    std::vector<parked> unparked;
+
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    for (; count != 0 && !parked_.empty(); --count)
+    {
+        unparked.push_back(std::move(parked_.front()));
+        parked_.pop_front();
+        consumers_waiting_.fetch_sub(1);
+    }
+
+    if (count == 1)
+        not_empty_.notify_one();
+    else if (count > 1)
+        not_empty_.notify_all();
+
+    lock.unlock();
+    ///////////////////////////////////////////////////////////////////////////
+
+    // Each retries, and parks again if another consumer took the value.
+    for (const auto& consumer: unparked)
+    {
+        const auto pool = consumer.pool;
+        const auto handle = consumer.handle;
+        pool->service().post([this, pool, handle]()
+        {
+            pop(*pool, handle);
+        });
+    }
+}
+
+template <class Type>
+void mpmc_queue<Type>::released(size_t count)
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (producers_waiting_.load(std::memory_order_relaxed) == 0)
+        return;
+
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (count == 1)
+        not_full_.notify_one();
+    else
+        not_full_.notify_all();
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+// False if closed (and full).
+template <class Type>
+bool mpmc_queue<Type>::wait_push()
+{
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    std::unique_lock<std::mutex> lock(mutex_);
+    producers_waiting_.fetch_add(1);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    while (!closed() && !can_push())
+        not_full_.wait(lock);
+
+    producers_waiting_.fetch_sub(1);
+    return !closed();
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+// False if closed and empty.
+template <class Type>
+bool mpmc_queue<Type>::wait_pop()
+{
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    std::unique_lock<std::mutex> lock(mutex_);
+    consumers_waiting_.fetch_add(1);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    while (!closed() && !can_pop())
+        not_empty_.wait(lock);
+
+    consumers_waiting_.fetch_sub(1);
+    return can_pop();
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+// Non-blocking.
+// ----------------------------------------------------------------------------
+
+template <class Type>
+bool mpmc_queue<Type>::try_push(Type&& value)
+{
+    return try_push(std::make_move_iterator(&value),
+        std::make_move_iterator(&value + 1)) != 0;
+}
+
+template <class Type>
+bool mpmc_queue<Type>::try_push(const Type& value)
+{
+    return try_push(&value, &value + 1) != 0;
+}
+
+template <class Type>
+template <class Iterator>
+size_t mpmc_queue<Type>::try_push(Iterator first, Iterator last)
+{
+    if (closed())
+        return 0;
+
+    size_t position;
+    const auto maximum = static_cast<size_t>(std::distance(first, last));
+    const auto count = claim_push(maximum, position);
+
+    for (size_t index = 0; index < count; ++index, ++first)
+    {
+        auto& cell = at(position + index);
+        cell.value = *first;
+        cell.sequence.store(position + index + 1, std::memory_order_release);
+    }
+
+    if (count != 0)
+        published(count);
+
+    return count;
+}
+
+template <class Type>
+bool mpmc_queue<Type>::try_pop(Type& out)
+{
+    size_t position;
+
+    if (claim_pop(1, position) == 0)
+        return false;
+
+    auto& cell = at(position);
+    out = std::move(cell.value);
+
+    // Release the slot to the producer of the next lap.
+    cell.sequence.store(position + mask_ + 1, std::memory_order_release);
+    released(1);
+    return true;
+}
+
+template <class Type>
+size_t mpmc_queue<Type>::try_pop(list& out, size_t maximum)
+{
+    size_t position;
+    const auto count = claim_pop(maximum, position);
+    out.reserve(out.size() + count);
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        auto& cell = at(position + index);
+        out.push_back(std::move(cell.value));
+        cell.sequence.store(position + index + mask_ + 1,
+            std::memory_order_release);
+    }
+
+    if (count != 0)
+        released(count);
+
+    return count;
+}
+
+// Blocking.
+// ----------------------------------------------------------------------------
+
+template <class Type>
+bool mpmc_queue<Type>::push(Type&& value)
+{
+    return push(std::make_move_iterator(&value),
+        std::make_move_iterator(&value + 1)) != 0;
+}
+
+template <class Type>
+bool mpmc_queue<Type>::push(const Type& value)
+{
+    return push(&value, &value + 1) != 0;
+}
+
+template <class Type>
+template <class Iterator>
+size_t mpmc_queue<Type>::push(Iterator first, Iterator last)
+{
+    size_t pushed = 0;
+
+    while (first != last)
+    {
+        const auto count = try_push(first, last);
+        std::advance(first, count);
+        pushed += count;
+
+        if (first != last && !wait_push())
+            break;
+    }
+
+    return pushed;
+}
+
+template <class Type>
+bool mpmc_queue<Type>::pop(Type& out)
+{
+    while (!try_pop(out))
+        if (!wait_pop())
+            return false;
+
+    return true;
+}
+
+template <class Type>
+size_t mpmc_queue<Type>::pop(list& out, size_t maximum)
+{
+    if (maximum == 0)
+        return 0;
+
+    size_t count;
+
+    while ((count = try_pop(out, maximum)) == 0)
+        if (!wait_pop())
+            return 0;
+
+    return count;
+}
+
+// Threadpool.
+// ----------------------------------------------------------------------------
+
+template <class Type>
+void mpmc_queue<Type>::pop(threadpool& pool, handler handle)
+{
+    Type value;
+
+    if (try_pop(value))
+    {
+        pool.service().post(std::bind(handle, error::success,
+            std::move(value)));
+        return;
+    }
+
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    std::unique_lock<std::mutex> lock(mutex_);
+    consumers_waiting_.fetch_add(1);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // Park unless a value was published before registration, or closed.
+    if (!can_pop() && !closed())
+    {
+        parked_.push_back({ &pool, std::move(handle) });
+        return;
+    }
+
+    consumers_waiting_.fetch_sub(1);
+    lock.unlock();
+    ///////////////////////////////////////////////////////////////////////////
+
+    if (try_pop(value))
+        pool.service().post(std::bind(handle, error::success,
+            std::move(value)));
+    else if (closed())
+        pool.service().post(std::bind(handle, error::service_stopped,
+            Type()));
+    else
+        pop(pool, handle);
+}
+
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,219 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_PACKED_STRINGS_IPP
+#define LIBBITCOIN_PACKED_STRINGS_IPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace libbitcoin {
+
+// const_iterator
+// ----------------------------------------------------------------------------
+
+template <size_t Size>
+packed_strings<Size>::const_iterator::const_iterator(const char* strings,
+    const uint16_t* offset)
+  : strings_(strings), offset_(offset)
+{
+}
+
+template <size_t Size>
+typename packed_strings<Size>::const_iterator::reference
+packed_strings<Size>::const_iterator::operator*() const
+{
+    return strings_ + *offset_;
+}
+
+template <size_t Size>
+typename packed_strings<Size>::const_iterator::reference
+packed_strings<Size>::const_iterator::operator[](
+    difference_type distance) const
+{
+    return strings_ + offset_[distance];
+}
+
+template <size_t Size>
+typename packed_strings<Size>::const_iterator&
+packed_strings<Size>::const_iterator::operator++()
+{
+    ++offset_;
+    return *this;
+}
+
+template <size_t Size>
+typename packed_strings<Size>::const_iterator
+packed_strings<Size>::const_iterator::operator++(int)
+{
+    auto copy = *this;
+    ++offset_;
+    return copy;
+}
+
+template <size_t Size>
+typename packed_strings<Size>::const_iterator&
+packed_strings<Size>::const_iterator::operator--()
+{
+    --offset_;
+    return *this;
+}
+
+template <size_t Size>
+typename packed_strings<Size>::const_iterator
+packed_strings<Size>::const_iterator::operator--(int)
+{
+    auto copy = *this;
+    --offset_;
+    return copy;
+}
+
+template <size_t Size>
+typename packed_strings<Size>::const_iterator&
+packed_strings<Size>::const_iterator::operator+=(difference_type distance)
+{
+    offset_ += distance;
+    return *this;
+}
+
+template <size_t Size>
+typename packed_strings<Size>::const_iterator&
+packed_strings<Size>::const_iterator::operator-=(difference_type distance)
+{
+    offset_ -= distance;
+    return *this;
+}
+
+template <size_t Size>
+typename packed_strings<Size>::const_iterator
+packed_strings<Size>::const_iterator::operator+(
+    difference_type distance) const
+{
+    return const_iterator(strings_, offset_ + distance);
+}
+
+template <size_t Size>
+typename packed_strings<Size>::const_iterator
+packed_strings<Size>::const_iterator::operator-(
+    difference_type distance) const
+{
+    return const_iterator(strings_, offset_ - distance);
+}
+
+template <size_t Size>
+typename packed_strings<Size>::const_iterator::difference_type
+packed_strings<Size>::const_iterator::operator-(
+    const const_iterator& other) const
+{
+    return offset_ - other.offset_;
+}
+
+template <size_t Size>
+bool packed_strings<Size>::const_iterator::operator==(
+    const const_iterator& other) const
+{
+    return offset_ == other.offset_;
+}
+
+template <size_t Size>
+bool packed_strings<Size>::const_iterator::operator!=(
+    const const_iterator& other) const
+{
+    return offset_ != other.offset_;
+}
+
+template <size_t Size>
+bool packed_strings<Size>::const_iterator::operator<(
+    const const_iterator& other) const
+{
+    return offset_ < other.offset_;
+}
+
+template <size_t Size>
+bool packed_strings<Size>::const_iterator::operator>(
+    const const_iterator& other) const
+{
+    return offset_ > other.offset_;
+}
+
+template <size_t Size>
+bool packed_strings<Size>::const_iterator::operator<=(
+    const const_iterator& other) const
+{
+    return offset_ <= other.offset_;
+}
+
+template <size_t Size>
+bool packed_strings<Size>::const_iterator::operator>=(
+    const const_iterator& other) const
+{
+    return offset_ >= other.offset_;
+}
+
+// packed_strings
+// ----------------------------------------------------------------------------
+
+template <size_t Size>
+const char* packed_strings<Size>::operator[](size_t position) const
+{
+    return strings + offsets[position];
+}
+
+template <size_t Size>
+typename packed_strings<Size>::const_iterator
+packed_strings<Size>::begin() const
+{
+    return const_iterator(strings, offsets);
+}
+
+template <size_t Size>
+typename packed_strings<Size>::const_iterator
+packed_strings<Size>::end() const
+{
+    return const_iterator(strings, offsets + Size);
+}
+
+template <size_t Size>
+size_t packed_strings<Size>::size() const
+{
+    return Size;
+}
+
+template <size_t Size>
+bool packed_strings<Size>::operator==(const packed_strings& other) const
+{
+    if (strings == other.strings && offsets == other.offsets)
+        return true;
+
+    for (size_t position = 0; position < Size; ++position)
+        if (std::strcmp((*this)[position], other[position]) != 0)
+            return false;
+
+    return true;
+}
+
+template <size_t Size>
+bool packed_strings<Size>::operator!=(const packed_strings& other) const
+{
+    return !(*this == other);
+}
+
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,225 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_PARALLEL_IPP
+#define LIBBITCOIN_PARALLEL_IPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
+#include <bitcoin/bitcoin/utility/trace.hpp>
+
+namespace libbitcoin {
+namespace detail {
+
+// Shared state of a parallel loop, outlives the call if jobs are delayed.
+// Jobs that run after return find no remaining chunks, and so do not
+// reference the function.
+template <typename Function>
+class parallel_loop
+{
+public:
+    parallel_loop(size_t count, size_t grain, Function& function)
+      : count_(count),
+        grain_(grain),
+        chunks_((count + grain - 1) / grain),
+        function_(function),
+        next_(0),
+        stop_(count),
+        failed_(count),
+        running_(0),
+        result_(error::success)
+    {
+    }
+
+    size_t chunks() const
+    {
+        return chunks_;
+    }
+
+    // Claim and run chunks in order until exhausted or failed.
+    void run()
+    {
+        mutex_.lock();
+        ++running_;
+        mutex_.unlock();
+
+        size_t chunk;
+        while ((chunk = next_.fetch_add(1)) < chunks_)
+        {
+            const auto end = std::min(count_, (chunk + 1) * grain_);
+
+            // Indexes beyond a known failure need not be run.
+            for (auto index = chunk * grain_; index < end &&
+                index < stop_.load(); ++index)
+            {
+                try
+                {
+                    const auto ec = function_(index);
+
+                    if (ec)
+                    {
+                        fail(index, ec, nullptr);
+                        break;
+                    }
+                }
+                catch (...)
+                {
+                    fail(index, error::operation_failed,
+                        std::current_exception());
+                    break;
+                }
+            }
+        }
+
+        mutex_.lock();
+        const auto idle = (--running_ == 0);
+        mutex_.unlock();
+
+        if (idle)
+            finished_.notify_all();
+    }
+
+    // Wait for all claimed chunks to complete, call only after run().
+    code wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        finished_.wait(lock, [this]() { return running_ == 0; });
+
+        if (exception_)
+            std::rethrow_exception(exception_);
+
+        return result_;
+    }
+
+private:
+    void fail(size_t index, const code& ec, std::exception_ptr exception)
+    {
+        // Exhaust the claims, all preceding chunks are in progress.
+        next_.store(chunks_);
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        // Retain the result of the earliest failure in index order.
+        if (index < failed_)
+        {
+            failed_ = index;
+            stop_.store(index);
+            result_ = ec;
+            exception_ = exception;
+        }
+    }
+
+    const size_t count_;
+    const size_t grain_;
+    const size_t chunks_;
+    Function& function_;
+    std::atomic<size_t> next_;
+    std::atomic<size_t> stop_;
+
+    // These are protected by mutex.
+    size_t failed_;
+    size_t running_;
+    code result_;
+    std::exception_ptr exception_;
+    std::mutex mutex_;
+    std::condition_variable finished_;
+};
+
+} // namespace detail
+
+template <typename Function>
+code parallel_for(threadpool& pool, size_t count, size_t grain,
+    Function&& function)
+{
+    grain = std::max(grain, size_t(1));
+
+    // There is no benefit in dispatching fewer than two chunks.
+    if (pool.empty() || count <= grain)
+    {
+        code ec;
+        for (size_t index = 0; index < count; ++index)
+            if ((ec = function(index)))
+                return ec;
+
+        return error::success;
+    }
+
+    typedef typename std::remove_reference<Function>::type function_type;
+    const auto loop = std::make_shared<detail::parallel_loop<function_type>>(
+        count, grain, function);
+
+    // The calling thread is one of the workers.
+    const auto jobs = std::min(pool.size(), loop->chunks() - 1);
+
+    for (size_t job = 0; job < jobs; ++job)
+        pool.service().post([loop]()
+        {
+            BC_TRACE_SPAN("threadpool", "parallel_for");
+            loop->run();
+        });
+
+    loop->run();
+    return loop->wait();
+}
+
+template <typename Value, typename Map, typename Combine>
+Value parallel_reduce(threadpool& pool, size_t count, size_t grain,
+    const Value& identity, Map&& map, Combine&& combine)
+{
+    // Wrapped so that each chunk result is a distinct object (vector<bool>).
+    struct partial
+    {
+        Value value;
+    };
+
+    grain = std::max(grain, size_t(1));
+    const auto chunks = (count + grain - 1) / grain;
+    std::vector<partial> partials(chunks, partial{ identity });
+
+    const auto reduce_chunk = [&](size_t chunk)
+    {
+        auto& result = partials[chunk].value;
+        const auto end = std::min(count, (chunk + 1) * grain);
+
+        for (auto index = chunk * grain; index < end; ++index)
+            result = combine(std::move(result), map(index));
+
+        return code(error::success);
+    };
+
+    parallel_for(pool, chunks, 1, reduce_chunk);
+
+    auto result = identity;
+    for (auto& chunk: partials)
+        result = combine(std::move(result), std::move(chunk.value));
+
+    return result;
+}
+
+} // namespace libbitcoin
+
+#endif
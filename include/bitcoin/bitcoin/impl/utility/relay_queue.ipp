@@ -0,0 +1,115 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_RELAY_QUEUE_IPP
+#define LIBBITCOIN_RELAY_QUEUE_IPP
+
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <bitcoin/bitcoin/utility/thread.hpp>
+
+namespace libbitcoin {
+namespace detail {
+
+// Compile time index sequences for unpacking argument tuples (C++11).
+template <size_t... Indexes>
+struct indexes
+{
+};
+
+template <size_t Count, size_t... Indexes>
+struct make_indexes
+  : make_indexes<Count - 1, Count - 1, Indexes...>
+{
+};
+
+template <size_t... Indexes>
+struct make_indexes<0, Indexes...>
+{
+    typedef indexes<Indexes...> type;
+};
+
+template <typename Handler, typename Tuple, size_t... Indexes>
+void apply(Handler& handler, Tuple& arguments, indexes<Indexes...>)
+{
+    handler(std::get<Indexes>(arguments)...);
+}
+
+} // namespace detail
+
+template <typename... Args>
+relay_queue<Args...>::relay_queue()
+  : draining_(false)
+{
+}
+
+template <typename... Args>
+bool relay_queue<Args...>::push(Args... args)
+{
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    unique_lock lock(mutex_);
+
+    pending_.emplace_back(args...);
+
+    if (draining_)
+        return false;
+
+    draining_ = true;
+    return true;
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+template <typename... Args>
+template <typename Handler>
+void relay_queue<Args...>::drain(Handler&& handler)
+{
+    typedef typename detail::make_indexes<sizeof...(Args)>::type sequence;
+    list batch;
+
+    while (true)
+    {
+        batch.clear();
+
+        // Critical Section
+        ///////////////////////////////////////////////////////////////////////
+        mutex_.lock();
+
+        if (pending_.empty())
+        {
+            draining_ = false;
+            mutex_.unlock();
+            //-----------------------------------------------------------------
+            return;
+        }
+
+        // The batch buffer is recycled as the pending buffer.
+        std::swap(batch, pending_);
+
+        mutex_.unlock();
+        ///////////////////////////////////////////////////////////////////////
+
+        for (auto& arguments: batch)
+            detail::apply(handler, arguments, sequence());
+    }
+}
+
+} // namespace libbitcoin
+
+#endif
@@ -20,11 +20,13 @@
 #define LIBBITCOIN_RESUBSCRIBER_IPP
 
 #include <functional>
+#include <iterator>
 #include <memory>
 #include <string>
 #include <utility>
 #include <bitcoin/bitcoin/utility/assert.hpp>
 #include <bitcoin/bitcoin/utility/dispatcher.hpp>
+#include <bitcoin/bitcoin/utility/relay_queue.hpp>
 #include <bitcoin/bitcoin/utility/thread.hpp>
 #include <bitcoin/bitcoin/utility/threadpool.hpp>
 ////#include <bitcoin/bitcoin/utility/track.hpp>
@@ -119,9 +121,21 @@ void resubscriber<Args...>::invoke(Args... args)
 template <typename... Args>
 void resubscriber<Args...>::relay(Args... args)
 {
-    // This enqueues work while maintaining order.
-    dispatch_.ordered(&resubscriber<Args...>::do_invoke,
-        this->shared_from_this(), args...);
+    // This enqueues work while maintaining order. Relays queued while a
+    // drain is scheduled or running are delivered by that drain.
+    if (relays_.push(args...))
+        dispatch_.ordered(&resubscriber<Args...>::do_relay,
+            this->shared_from_this());
+}
+
+// private
+template <typename... Args>
+void resubscriber<Args...>::do_relay()
+{
+    relays_.drain([this](Args... args)
+    {
+        do_invoke(args...);
+    });
 }
 
 // private
@@ -144,34 +158,44 @@ void resubscriber<Args...>::do_invoke(Args... args)
     ///////////////////////////////////////////////////////////////////////////
 
     // Subscriptions may be created while this loop is executing.
-    // Invoke subscribers from temporary list and resubscribe as indicated.
-    for (const auto& handler: subscriptions)
+    // Invoke subscribers from temporary list, retaining (by move) those that
+    // resubscribe, compacted in place so that no handler is copied.
+    auto renewed = subscriptions.begin();
+
+    for (auto& handler: subscriptions)
     {
         //!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
         // DEADLOCK RISK, handler must not return to invoke.
         //!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
         if (handler(args...))
         {
-            // Critical Section
-            ///////////////////////////////////////////////////////////////////
-            subscribe_mutex_.lock_upgrade();
-
-            if (stopped_)
-            {
-                subscribe_mutex_.unlock_upgrade();
-                //-------------------------------------------------------------
-                continue;
-            }
-
-            subscribe_mutex_.unlock_upgrade_and_lock();
-            //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-            subscriptions_.push_back(handler);
-
-            subscribe_mutex_.unlock();
-            ///////////////////////////////////////////////////////////////////
+            if (&(*renewed) != &handler)
+                *renewed = std::move(handler);
+
+            ++renewed;
         }
     }
 
+    subscriptions.erase(renewed, subscriptions.end());
+
+    if (subscriptions.empty())
+        return;
+
+    // Critical Section (resubscribe all renewals under one lock)
+    ///////////////////////////////////////////////////////////////////////////
+    subscribe_mutex_.lock();
+
+    // Renewals are dropped if stopped during invocation.
+    if (!stopped_)
+    {
+        // Renewals precede subscriptions created during invocation.
+        subscriptions.insert(subscriptions.end(),
+            std::make_move_iterator(subscriptions_.begin()),
+            std::make_move_iterator(subscriptions_.end()));
+        std::swap(subscriptions, subscriptions_);
+    }
+
+    subscribe_mutex_.unlock();
     ///////////////////////////////////////////////////////////////////////////
 }
 
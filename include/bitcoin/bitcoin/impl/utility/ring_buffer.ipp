@@ -0,0 +1,133 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_RING_BUFFER_IPP
+#define LIBBITCOIN_RING_BUFFER_IPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace libbitcoin {
+
+template <class Type>
+ring_buffer<Type>::ring_buffer(size_t capacity)
+  : mask_(round_up(capacity) - 1),
+    slots_(new slot[mask_ + 1]),
+    head_(0),
+    tail_(0)
+{
+    for (size_t index = 0; index <= mask_; ++index)
+        slots_[index].sequence.store(index, std::memory_order_relaxed);
+}
+
+template <class Type>
+size_t ring_buffer<Type>::round_up(size_t capacity)
+{
+    size_t size = 2;
+
+    while (size < capacity)
+        size <<= 1;
+
+    return size;
+}
+
+template <class Type>
+size_t ring_buffer<Type>::capacity() const
+{
+    return mask_ + 1;
+}
+
+template <class Type>
+bool ring_buffer<Type>::push(Type&& value)
+{
+    return enqueue(std::move(value));
+}
+
+template <class Type>
+bool ring_buffer<Type>::push(const Type& value)
+{
+    return enqueue(value);
+}
+
+template <class Type>
+template <class Value>
+bool ring_buffer<Type>::enqueue(Value&& value)
+{
+    auto position = head_.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        auto& cell = slots_[position & mask_];
+        const auto sequence = cell.sequence.load(std::memory_order_acquire);
+        const auto lag = static_cast<intptr_t>(sequence) -
+            static_cast<intptr_t>(position);
+
+        // The slot is free at this position, try to claim it.
+        if (lag == 0)
+        {
+            if (head_.compare_exchange_weak(position, position + 1,
+                std::memory_order_relaxed))
+            {
+                cell.value = std::forward<Value>(value);
+                cell.sequence.store(position + 1, std::memory_order_release);
+                return true;
+            }
+        }
+
+        // The slot still holds the value of the previous lap, so full.
+        else if (lag < 0)
+            return false;
+
+        // Another producer claimed the position, reload and retry.
+        else
+            position = head_.load(std::memory_order_relaxed);
+    }
+}
+
+template <class Type>
+bool ring_buffer<Type>::pop(Type& out)
+{
+    const auto position = tail_.load(std::memory_order_relaxed);
+    auto& cell = slots_[position & mask_];
+    const auto sequence = cell.sequence.load(std::memory_order_acquire);
+
+    // The producer of this position has not yet published its value.
+    if (sequence != position + 1)
+        return false;
+
+    out = std::move(cell.value);
+
+    // Release the slot to the producer of the next lap.
+    cell.sequence.store(position + mask_ + 1, std::memory_order_release);
+    tail_.store(position + 1, std::memory_order_relaxed);
+    return true;
+}
+
+template <class Type>
+bool ring_buffer<Type>::empty() const
+{
+    const auto position = tail_.load(std::memory_order_relaxed);
+    const auto& cell = slots_[position & mask_];
+    return cell.sequence.load(std::memory_order_acquire) != position + 1;
+}
+
+} // namespace libbitcoin
+
+#endif
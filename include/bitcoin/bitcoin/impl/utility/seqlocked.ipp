@@ -0,0 +1,107 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SEQLOCKED_IPP
+#define LIBBITCOIN_SEQLOCKED_IPP
+
+#include <atomic>
+#include <cstring>
+#include <bitcoin/bitcoin/utility/sequential_lock.hpp>
+#include <bitcoin/bitcoin/utility/thread.hpp>
+
+namespace libbitcoin {
+
+template <typename Type>
+seqlocked<Type>::seqlocked()
+  : seqlocked(Type{})
+{
+}
+
+template <typename Type>
+seqlocked<Type>::seqlocked(const Type& value)
+{
+    buffer in{};
+    std::memcpy(in.data(), &value, sizeof(Type));
+    write(in);
+}
+
+template <typename Type>
+Type seqlocked<Type>::load() const
+{
+    Type value;
+    while (!try_load(value));
+    return value;
+}
+
+template <typename Type>
+bool seqlocked<Type>::try_load(Type& out_value) const
+{
+    const auto handle = sequence_.begin_read();
+
+    if (sequential_lock::is_write_locked(handle))
+        return false;
+
+    buffer out;
+    read(out);
+
+    // The copy must complete before the sequence is tested.
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    if (!sequence_.is_read_valid(handle))
+        return false;
+
+    std::memcpy(&out_value, out.data(), sizeof(Type));
+    return true;
+}
+
+template <typename Type>
+void seqlocked<Type>::store(const Type& value)
+{
+    buffer in{};
+    std::memcpy(in.data(), &value, sizeof(Type));
+
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    unique_lock lock(mutex_);
+
+    sequence_.begin_write();
+    write(in);
+    sequence_.end_write();
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+// private
+//-----------------------------------------------------------------------------
+
+template <typename Type>
+void seqlocked<Type>::read(buffer& out) const
+{
+    for (size_t word = 0; word < words; ++word)
+        out[word] = value_[word].load(std::memory_order_relaxed);
+}
+
+template <typename Type>
+void seqlocked<Type>::write(const buffer& in)
+{
+    for (size_t word = 0; word < words; ++word)
+        value_[word].store(in[word], std::memory_order_relaxed);
+}
+
+} // namespace libbitcoin
+
+#endif
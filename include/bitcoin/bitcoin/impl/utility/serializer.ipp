@@ -155,22 +155,32 @@ void serializer<Iterator>::write_variable_little_endian(uint64_t value)
     if (value < varint_two_bytes)
     {
         write_byte(static_cast<uint8_t>(value));
+        return;
     }
-    else if (value <= max_uint16)
+
+    // The prefix and value are written as one, the value stored in full and
+    // then truncated to its width (its low order bytes).
+    uint8_t buffer[sizeof(uint8_t) + sizeof(uint64_t)];
+    size_t size;
+
+    if (value <= max_uint16)
     {
-        write_byte(varint_two_bytes);
-        write_2_bytes_little_endian(static_cast<uint16_t>(value));
+        buffer[0] = varint_two_bytes;
+        size = sizeof(uint16_t);
     }
     else if (value <= max_uint32)
     {
-        write_byte(varint_four_bytes);
-        write_4_bytes_little_endian(static_cast<uint32_t>(value));
+        buffer[0] = varint_four_bytes;
+        size = sizeof(uint32_t);
     }
     else
     {
-        write_byte(varint_eight_bytes);
-        write_8_bytes_little_endian(value);
+        buffer[0] = varint_eight_bytes;
+        size = sizeof(uint64_t);
     }
+
+    store_little_endian(&buffer[1], value);
+    write_bytes(buffer, sizeof(uint8_t) + size);
 }
 
 template <typename Iterator>
@@ -179,6 +189,23 @@ void serializer<Iterator>::write_size_little_endian(size_t value)
     write_variable_little_endian(value);
 }
 
+template <typename Iterator>
+void serializer<Iterator>::write_variable_base128(uint64_t value)
+{
+    uint8_t buffer[10];
+    auto position = sizeof(buffer);
+    buffer[--position] = value & 0x7f;
+
+    // Each continued group is stored less one, so each value has one form.
+    while (value > 0x7f)
+    {
+        value = (value >> 7) - 1;
+        buffer[--position] = (value & 0x7f) | 0x80;
+    }
+
+    write_bytes(&buffer[position], sizeof(buffer) - position);
+}
+
 // Bytes (unchecked).
 //-----------------------------------------------------------------------------
 
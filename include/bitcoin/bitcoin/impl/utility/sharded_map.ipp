@@ -0,0 +1,467 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SHARDED_MAP_IPP
+#define LIBBITCOIN_SHARDED_MAP_IPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <bitcoin/bitcoin/utility/thread.hpp>
+
+namespace libbitcoin {
+
+template <typename Key, typename Value, typename Hash>
+BC_CONSTEXPR size_t sharded_map<Key, Value, Hash>::default_shards;
+
+// The slot, and the index entry with its control byte at maximum load.
+template <typename Key, typename Value, typename Hash>
+const size_t sharded_map<Key, Value, Hash>::entry_size = sizeof(slot) +
+    (sizeof(std::pair<Key, size_t>) + 1) * 8 / 7;
+
+template <typename Key, typename Value, typename Hash>
+sharded_map<Key, Value, Hash>::slot::slot()
+  : key{}, value{}, cost(0), used(false), referenced(false)
+{
+}
+
+// Slots are moved only by growth of the slot vector, under exclusive lock.
+template <typename Key, typename Value, typename Hash>
+sharded_map<Key, Value, Hash>::slot::slot(slot&& other)
+  : key(std::move(other.key)),
+    value(std::move(other.value)),
+    cost(other.cost),
+    used(other.used),
+    referenced(other.referenced.load(std::memory_order_relaxed))
+{
+}
+
+template <typename Key, typename Value, typename Hash>
+sharded_map<Key, Value, Hash>::shard::shard()
+  : hand(0), hits(0), misses(0), insertions(0), evictions(0)
+{
+}
+
+template <typename Key, typename Value, typename Hash>
+sharded_map<Key, Value, Hash>::sharded_map(size_t capacity, size_t shards)
+  : shard_count_(to_shards(shards)),
+    shift_(to_shift(shard_count_)),
+    capacity_(capacity),
+    cost_(0),
+    shards_(new shard[shard_count_])
+{
+}
+
+template <typename Key, typename Value, typename Hash>
+bool sharded_map<Key, Value, Hash>::find(Value& out, const Key& key) const
+{
+    const auto& part = shards_[to_shard(key)];
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Critical Section
+    shared_lock lock(part.mutex);
+    const auto entry = locate(part, key);
+
+    if (entry != nullptr)
+        out = entry->value;
+
+    return entry != nullptr;
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+template <typename Key, typename Value, typename Hash>
+bool sharded_map<Key, Value, Hash>::contains(const Key& key) const
+{
+    const auto& part = shards_[to_shard(key)];
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Critical Section
+    shared_lock lock(part.mutex);
+    return locate(part, key) != nullptr;
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+template <typename Key, typename Value, typename Hash>
+bool sharded_map<Key, Value, Hash>::insert(const Key& key, Value value,
+    size_t cost)
+{
+    const auto start = to_shard(key);
+    auto& part = shards_[start];
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Critical Section
+    part.mutex.lock_shared();
+    const auto present = part.positions.contains(key);
+    part.mutex.unlock_shared();
+    ///////////////////////////////////////////////////////////////////////////
+
+    // Avoid evicting for a key that is already present.
+    if (present || !reserve(cost, start))
+        return false;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Critical Section
+    unique_lock lock(part.mutex);
+
+    // The key may have been inserted since it was found to be absent.
+    if (part.positions.contains(key))
+    {
+        cost_.fetch_sub(cost);
+        return false;
+    }
+
+    size_t position;
+
+    if (part.vacant.empty())
+    {
+        position = part.slots.size();
+        part.slots.emplace_back();
+    }
+    else
+    {
+        position = part.vacant.back();
+        part.vacant.pop_back();
+    }
+
+    // A new entry is not referenced, so it is the first evicted if unused.
+    auto& entry = part.slots[position];
+    entry.key = key;
+    entry.value = std::move(value);
+    entry.cost = cost;
+    entry.used = true;
+    entry.referenced.store(false, std::memory_order_relaxed);
+    part.positions.insert(key, position);
+    part.insertions.fetch_add(1, std::memory_order_relaxed);
+    return true;
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+template <typename Key, typename Value, typename Hash>
+void sharded_map<Key, Value, Hash>::resize(size_t capacity)
+{
+    capacity_ = capacity;
+    auto evicted = true;
+
+    // Stops if all of the cost is reserved by pending insertions.
+    while (evicted && cost_ > capacity_)
+        evicted = evict(0);
+
+    if (capacity != 0)
+        return;
+
+    for (size_t index = 0; index < shard_count_; ++index)
+    {
+        auto& part = shards_[index];
+
+        ///////////////////////////////////////////////////////////////////////
+        // Critical Section
+        unique_lock lock(part.mutex);
+        part.positions.clear();
+        part.positions.shrink_to_fit();
+        part.slots = std::vector<slot>{};
+        part.vacant = std::vector<size_t>{};
+        part.hand = 0;
+        ///////////////////////////////////////////////////////////////////////
+    }
+}
+
+// Slot storage is retained for reuse, and released only by resize(0).
+template <typename Key, typename Value, typename Hash>
+void sharded_map<Key, Value, Hash>::clear()
+{
+    for (size_t index = 0; index < shard_count_; ++index)
+    {
+        auto& part = shards_[index];
+
+        ///////////////////////////////////////////////////////////////////////
+        // Critical Section
+        unique_lock lock(part.mutex);
+
+        for (size_t position = 0; position < part.slots.size(); ++position)
+        {
+            auto& entry = part.slots[position];
+
+            if (!entry.used)
+                continue;
+
+            cost_.fetch_sub(entry.cost);
+            entry.used = false;
+            entry.value = Value{};
+            part.vacant.push_back(position);
+        }
+
+        part.positions.clear();
+        ///////////////////////////////////////////////////////////////////////
+    }
+}
+
+template <typename Key, typename Value, typename Hash>
+template <typename Handler>
+void sharded_map<Key, Value, Hash>::visit(Handler&& handler) const
+{
+    for (size_t index = 0; index < shard_count_; ++index)
+    {
+        const auto& part = shards_[index];
+
+        ///////////////////////////////////////////////////////////////////////
+        // Critical Section
+        shared_lock lock(part.mutex);
+
+        for (const auto& entry: part.slots)
+            if (entry.used)
+                handler(entry.key, entry.value);
+        ///////////////////////////////////////////////////////////////////////
+    }
+}
+
+template <typename Key, typename Value, typename Hash>
+bool sharded_map<Key, Value, Hash>::enabled() const
+{
+    return capacity_ > 0;
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t sharded_map<Key, Value, Hash>::size() const
+{
+    size_t total = 0;
+
+    for (size_t index = 0; index < shard_count_; ++index)
+    {
+        const auto& part = shards_[index];
+
+        ///////////////////////////////////////////////////////////////////////
+        // Critical Section
+        shared_lock lock(part.mutex);
+        total += part.positions.size();
+        ///////////////////////////////////////////////////////////////////////
+    }
+
+    return total;
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t sharded_map<Key, Value, Hash>::cost() const
+{
+    return cost_;
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t sharded_map<Key, Value, Hash>::capacity() const
+{
+    return capacity_;
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t sharded_map<Key, Value, Hash>::shards() const
+{
+    return shard_count_;
+}
+
+template <typename Key, typename Value, typename Hash>
+uint64_t sharded_map<Key, Value, Hash>::hits() const
+{
+    uint64_t total = 0;
+
+    for (size_t index = 0; index < shard_count_; ++index)
+        total += shards_[index].hits.load(std::memory_order_relaxed);
+
+    return total;
+}
+
+template <typename Key, typename Value, typename Hash>
+uint64_t sharded_map<Key, Value, Hash>::misses() const
+{
+    uint64_t total = 0;
+
+    for (size_t index = 0; index < shard_count_; ++index)
+        total += shards_[index].misses.load(std::memory_order_relaxed);
+
+    return total;
+}
+
+template <typename Key, typename Value, typename Hash>
+uint64_t sharded_map<Key, Value, Hash>::insertions() const
+{
+    uint64_t total = 0;
+
+    for (size_t index = 0; index < shard_count_; ++index)
+        total += shards_[index].insertions.load(std::memory_order_relaxed);
+
+    return total;
+}
+
+template <typename Key, typename Value, typename Hash>
+uint64_t sharded_map<Key, Value, Hash>::evictions() const
+{
+    uint64_t total = 0;
+
+    for (size_t index = 0; index < shard_count_; ++index)
+        total += shards_[index].evictions.load(std::memory_order_relaxed);
+
+    return total;
+}
+
+template <typename Key, typename Value, typename Hash>
+float sharded_map<Key, Value, Hash>::hit_rate() const
+{
+    const auto hit = hits();
+    const auto total = hit + misses();
+    return total == 0 ? 0.0f : static_cast<float>(hit) / total;
+}
+
+// private
+//-----------------------------------------------------------------------------
+
+template <typename Key, typename Value, typename Hash>
+size_t sharded_map<Key, Value, Hash>::to_shards(size_t shards)
+{
+    size_t count = 1;
+
+    while (count < shards)
+        count <<= 1;
+
+    return count;
+}
+
+// The shard is selected by the high bits of the hash, as the index of the
+// shard consumes the low bits. A single shard selects zero by the mask.
+template <typename Key, typename Value, typename Hash>
+size_t sharded_map<Key, Value, Hash>::to_shift(size_t shards)
+{
+    size_t bits = 0;
+
+    while ((size_t(1) << bits) < shards)
+        ++bits;
+
+    return bits == 0 ? 0 : sizeof(size_t) * 8 - bits;
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t sharded_map<Key, Value, Hash>::to_shard(const Key& key) const
+{
+    return (hasher_(key) >> shift_) & (shard_count_ - 1);
+}
+
+// Call under shared or exclusive lock of the shard.
+// A found entry is marked as referenced, sparing it from the next sweep.
+template <typename Key, typename Value, typename Hash>
+const typename sharded_map<Key, Value, Hash>::slot*
+sharded_map<Key, Value, Hash>::locate(const shard& part, const Key& key) const
+{
+    const auto position = part.positions.find(key);
+
+    if (position == nullptr)
+    {
+        part.misses.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    const auto& entry = part.slots[*position];
+
+    // Avoid writing the line of a recently referenced entry.
+    if (!entry.referenced.load(std::memory_order_relaxed))
+        entry.referenced.store(true, std::memory_order_relaxed);
+
+    part.hits.fetch_add(1, std::memory_order_relaxed);
+    return &entry;
+}
+
+// Reserve the cost within the capacity, evicting as necessary, so that the
+// capacity is never exceeded by concurrent insertions.
+template <typename Key, typename Value, typename Hash>
+bool sharded_map<Key, Value, Hash>::reserve(size_t cost, size_t start)
+{
+    auto current = cost_.load();
+
+    while (true)
+    {
+        const size_t capacity = capacity_;
+
+        if (cost > capacity)
+            return false;
+
+        if (current + cost <= capacity)
+        {
+            if (cost_.compare_exchange_weak(current, current + cost))
+                return true;
+
+            continue;
+        }
+
+        // Fails if all of the cost is reserved by pending insertions.
+        if (!evict(start))
+            return false;
+
+        current = cost_.load();
+    }
+}
+
+// Evict one entry from the first populated shard, from the start shard.
+// Only one shard is locked at a time, so eviction cannot deadlock.
+template <typename Key, typename Value, typename Hash>
+bool sharded_map<Key, Value, Hash>::evict(size_t start)
+{
+    for (size_t offset = 0; offset < shard_count_; ++offset)
+    {
+        auto& part = shards_[(start + offset) & (shard_count_ - 1)];
+
+        ///////////////////////////////////////////////////////////////////////
+        // Critical Section
+        unique_lock lock(part.mutex);
+
+        if (part.positions.empty())
+            continue;
+
+        cost_.fetch_sub(evict(part));
+        part.evictions.fetch_add(1, std::memory_order_relaxed);
+        return true;
+        ///////////////////////////////////////////////////////////////////////
+    }
+
+    return false;
+}
+
+// Call under exclusive lock of a populated shard, returns the evicted cost.
+// The hand sweeps the slots, clearing the referenced mark of each entry
+// until it reaches one that is not marked, so a sweep ends within two turns.
+template <typename Key, typename Value, typename Hash>
+size_t sharded_map<Key, Value, Hash>::evict(shard& part)
+{
+    while (true)
+    {
+        const auto position = part.hand;
+        auto& entry = part.slots[position];
+        part.hand = (position + 1) % part.slots.size();
+
+        if (!entry.used ||
+            entry.referenced.exchange(false, std::memory_order_relaxed))
+            continue;
+
+        part.positions.erase(entry.key);
+        part.vacant.push_back(position);
+        entry.used = false;
+        entry.value = Value{};
+        return entry.cost;
+    }
+}
+
+} // namespace libbitcoin
+
+#endif
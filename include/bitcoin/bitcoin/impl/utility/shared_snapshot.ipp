@@ -0,0 +1,99 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SHARED_SNAPSHOT_IPP
+#define LIBBITCOIN_SHARED_SNAPSHOT_IPP
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <utility>
+#include <bitcoin/bitcoin/utility/thread.hpp>
+
+namespace libbitcoin {
+
+template <typename Type>
+shared_snapshot<Type>::shared_snapshot()
+  : shared_snapshot(nullptr)
+{
+}
+
+template <typename Type>
+shared_snapshot<Type>::shared_snapshot(ptr value)
+  : version_(0)
+{
+    for (auto& slot: slots_)
+        slot.readers.store(0);
+
+    slots_.front().value = std::move(value);
+}
+
+// The readers count is raised before the version is confirmed, and a writer
+// tests the count after publishing the prior version (all sequentially
+// consistent). So either the writer sees the reader, or the reader sees the
+// newer version and backs off without touching the slot.
+template <typename Type>
+typename shared_snapshot<Type>::ptr shared_snapshot<Type>::load() const
+{
+    while (true)
+    {
+        const auto version = version_.load();
+        const auto& slot = slots_[version % slots];
+        ++slot.readers;
+
+        if (version_.load() == version)
+        {
+            auto value = slot.value;
+            --slot.readers;
+            return value;
+        }
+
+        --slot.readers;
+    }
+}
+
+template <typename Type>
+void shared_snapshot<Type>::store(ptr value)
+{
+    ptr prior;
+
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    mutex_.lock();
+
+    const auto version = version_.load() + 1;
+    auto& slot = slots_[version % slots];
+
+    // Readers of the superseded slot hold it only to copy the pointer.
+    while (slot.readers.load() != 0)
+        std::this_thread::yield();
+
+    prior = std::move(slot.value);
+    slot.value = std::move(value);
+    version_.store(version);
+
+    mutex_.unlock();
+    ///////////////////////////////////////////////////////////////////////////
+
+    // The superseded snapshot is released outside of the lock.
+    prior.reset();
+}
+
+} // namespace libbitcoin
+
+#endif
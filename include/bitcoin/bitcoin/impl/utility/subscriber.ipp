@@ -25,6 +25,7 @@
 #include <utility>
 #include <bitcoin/bitcoin/utility/assert.hpp>
 #include <bitcoin/bitcoin/utility/dispatcher.hpp>
+#include <bitcoin/bitcoin/utility/relay_queue.hpp>
 #include <bitcoin/bitcoin/utility/thread.hpp>
 #include <bitcoin/bitcoin/utility/threadpool.hpp>
 ////#include <bitcoin/bitcoin/utility/track.hpp>
@@ -119,9 +120,21 @@ void subscriber<Args...>::invoke(Args... args)
 template <typename... Args>
 void subscriber<Args...>::relay(Args... args)
 {
-    // This enqueues work while maintaining order.
-    dispatch_.ordered(&subscriber<Args...>::do_invoke,
-        this->shared_from_this(), args...);
+    // This enqueues work while maintaining order. Relays queued while a
+    // drain is scheduled or running are delivered by that drain.
+    if (relays_.push(args...))
+        dispatch_.ordered(&subscriber<Args...>::do_relay,
+            this->shared_from_this());
+}
+
+// private
+template <typename... Args>
+void subscriber<Args...>::do_relay()
+{
+    relays_.drain([this](Args... args)
+    {
+        do_invoke(args...);
+    });
 }
 
 // private
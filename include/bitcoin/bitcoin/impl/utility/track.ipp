@@ -24,7 +24,6 @@
 #include <string>
 #include <bitcoin/bitcoin/define.hpp>
 #include <bitcoin/bitcoin/log/source.hpp>
-#include <bitcoin/bitcoin/utility/assert.hpp>
 
 // libbitcoin defines the log and tracking but does not use them.
 // These are defined in bc so that they can be used in network and blockchain.
@@ -33,24 +32,30 @@
 #define LOG_SYSTEM "system"
 
 template <class Shared>
-std::atomic<size_t> track<Shared>::instances(0);
-
-template <class Shared>
-track<Shared>::track(const std::string& DEBUG_ONLY(class_name))
+track<Shared>::track(const std::string& class_name)
+  : counters_(track_registry::counters(class_name))
 #ifndef NDEBUG
-  : class_(class_name)
+  , class_(class_name)
 #endif
 {
-#ifndef NDEBUG
-    LOG_DEBUG(LOG_SYSTEM) << class_ << "(" << ++instances << ")";
+    counters_.total.fetch_add(1, std::memory_order_relaxed);
+
+#ifdef NDEBUG
+    counters_.live.fetch_add(1, std::memory_order_relaxed);
+#else
+    const auto live = counters_.live.fetch_add(1, std::memory_order_relaxed);
+    LOG_DEBUG(LOG_SYSTEM) << class_ << "(" << live + 1 << ")";
 #endif
 }
 
 template <class Shared>
 track<Shared>::~track()
 {
-#ifndef NDEBUG
-    LOG_DEBUG(LOG_SYSTEM) << "~" << class_ << "(" << --instances << ")";
+#ifdef NDEBUG
+    counters_.live.fetch_sub(1, std::memory_order_relaxed);
+#else
+    const auto live = counters_.live.fetch_sub(1, std::memory_order_relaxed);
+    LOG_DEBUG(LOG_SYSTEM) << "~" << class_ << "(" << live - 1 << ")";
 #endif
 }
 
@@ -0,0 +1,132 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_LOG_ASYNC_FILE_SINK_HPP
+#define LIBBITCOIN_LOG_ASYNC_FILE_SINK_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <boost/log/core/record_view.hpp>
+#include <boost/log/sinks/basic_sink_backend.hpp>
+#include <boost/log/sinks/text_file_backend.hpp>
+#include <boost/shared_ptr.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/utility/asio.hpp>
+#include <bitcoin/bitcoin/utility/ring_buffer.hpp>
+
+namespace libbitcoin {
+namespace log {
+
+/// The behavior of a producer when the async sink buffer is full.
+enum class overflow_policy
+{
+    /// Discard the record and count it as dropped.
+    drop,
+
+    /// Wait for the writer to free space in the buffer.
+    block
+};
+
+struct async_options
+{
+    /// The number of buffered records (rounded up to a power of two).
+    size_t capacity;
+
+    /// The maximum number of records written between flushes.
+    size_t batch_size;
+
+    /// The maximum time a written record may remain unflushed.
+    uint32_t flush_interval_milliseconds;
+
+    overflow_policy overflow;
+};
+
+/**
+ * An asynchronous text file backend, for use with an unlocked_sink frontend.
+ * Records are formatted by the producer thread and pushed into a lock-free
+ * ring buffer. A single writer thread drains the buffer in batches to the
+ * file backend, which retains rotation, and flushes once per batch or
+ * interval rather than per record.
+ */
+class BC_API async_file_sink
+  : public boost::log::sinks::basic_formatted_sink_backend<char,
+        boost::log::sinks::combine_requirements<
+            boost::log::sinks::concurrent_feeding,
+            boost::log::sinks::flushing>::type>
+{
+public:
+    typedef boost::shared_ptr<boost::log::sinks::text_file_backend> file_ptr;
+
+    /// Construct the sink and start its writer thread.
+    async_file_sink(file_ptr file, const async_options& options);
+
+    /// Stops the sink, writing all buffered records.
+    ~async_file_sink();
+
+    /// Buffer the formatted record (thread safe).
+    void consume(const boost::log::record_view& record,
+        const std::string& message);
+
+    /// Signal the writer to flush buffered records now (thread safe).
+    void flush();
+
+    /// Write all buffered records and join the writer (idempotent).
+    void stop();
+
+    /// The number of records discarded under the drop policy.
+    size_t dropped() const;
+
+private:
+    struct entry
+    {
+        boost::log::record_view record;
+        std::string message;
+    };
+
+    void run();
+    size_t write();
+
+    // These are thread safe.
+    const file_ptr file_;
+    const size_t batch_size_;
+    const asio::duration interval_;
+    const overflow_policy overflow_;
+    ring_buffer<entry> buffer_;
+    std::atomic<bool> stopped_;
+    std::atomic<bool> sleeping_;
+    std::atomic<bool> flush_;
+    std::atomic<size_t> dropped_;
+    std::atomic<size_t> waiting_;
+
+    // These are protected by mutex.
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable space_;
+
+    std::unique_ptr<asio::thread> thread_;
+};
+
+} // namespace log
+} // namespace libbitcoin
+
+#endif
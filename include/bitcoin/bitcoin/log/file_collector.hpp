@@ -19,7 +19,9 @@
 #define LIBBITCOIN_LOG_FILE_COLLECTOR_HPP
 
 #include <ctime>
+#include <deque>
 #include <list>
+#include <map>
 #include <string>
 #include <boost/enable_shared_from_this.hpp>
 #include <boost/filesystem/path.hpp>
@@ -30,12 +32,15 @@
 #include <boost/shared_ptr.hpp>
 
 #if !defined(BOOST_LOG_NO_THREADS)
+#include <boost/thread/condition_variable.hpp>
 #include <boost/thread/locks.hpp>
 #include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
 #endif // !defined(BOOST_LOG_NO_THREADS)
 
 #include <bitcoin/bitcoin/define.hpp>
 #include <bitcoin/bitcoin/log/file_counter_formatter.hpp>
+#include <bitcoin/bitcoin/log/rotable_file.hpp>
 
 namespace libbitcoin {
 namespace log {
@@ -61,11 +66,13 @@ public:
         boost::filesystem::path const& target_dir,
         size_t max_size,
         size_t min_free_space,
-        size_t max_files);
+        size_t max_files,
+        compression compress=compression::none);
 
     virtual ~file_collector();
 
-    //! The function stores the specified file in the storage
+    //! The function moves the specified file to the storage, compression
+    //! and enforcement of storage restrictions are done by a worker thread
     void store_file(boost::filesystem::path const& src_path) override;
 
     //! Scans the target directory for the files that have already been stored
@@ -73,7 +80,8 @@ public:
         boost::filesystem::path const& pattern, unsigned int* counter) override;
 
     //! The function updates storage restrictions
-    void update(size_t max_size, size_t min_free_space, size_t max_files);
+    void update(size_t max_size, size_t min_free_space, size_t max_files,
+        compression compress=compression::none);
 
     //! The function checks if the directory is governed by this collector
     bool is_governed(boost::filesystem::path const& dir) const;
@@ -100,6 +108,15 @@ private:
     bool match_pattern(path_string_type const& file_name,
         path_string_type const& pattern, unsigned int& file_counter);
 
+    //! Compresses the stored file if configured and indexes it
+    void archive(file_info info);
+
+    //! Indexes the stored file and erases old files beyond restrictions
+    void index(file_info const& info);
+
+    //! Processes stored files until stopped
+    void work();
+
 private:
     //! A reference to the repository this collector belongs to
     boost::shared_ptr<file_collector_repository> repository_;
@@ -115,6 +132,8 @@ private:
     size_t min_free_space_;
     //! File count upper limit
     size_t max_files_;
+    //! Compression of stored files
+    compression compression_;
 
     //! The current path at the point when the collector is created
     /*
@@ -131,6 +150,19 @@ private:
     uintmax_t total_size_;
 
     file_counter_formatter formatter_;
+    //! The next file counter to try for each file stem
+    std::map<path_string_type, unsigned int> counters_;
+
+#if !defined(BOOST_LOG_NO_THREADS)
+    //! Files moved to the storage, awaiting the worker
+    std::deque<file_info> pending_;
+    //! Signals the worker of a pending file or stop
+    boost::condition_variable pending_condition_;
+    //! Set to drain the pending files and stop the worker
+    bool stopping_;
+    //! Compresses and prunes off of the rotating (logging) thread
+    boost::thread worker_;
+#endif // !defined(BOOST_LOG_NO_THREADS)
 };
 
 } // namespace log
@@ -0,0 +1,158 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_LOG_METRICS_HPP
+#define LIBBITCOIN_LOG_METRICS_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/utility/asio.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+#include <bitcoin/bitcoin/utility/thread.hpp>
+
+namespace libbitcoin {
+namespace log {
+
+/**
+ * This class is thread safe.
+ * A registry of in-process statsd metrics, independent of boost::log.
+ * Metric updates are lock-free, the registry is locked only to create a
+ * metric (retain the returned reference) and to collect the datagrams.
+ * Collection resets counters and timers, so each flush reports the interval.
+ */
+class BC_API metrics
+  : noncopyable
+{
+public:
+    typedef std::vector<std::string> datagrams;
+
+    /// A counter reported as the sum of increments since the last flush.
+    class BC_API counter
+      : noncopyable
+    {
+    public:
+        counter();
+        void increment(int64_t value=1);
+        int64_t value() const;
+
+    private:
+        friend class metrics;
+        std::atomic<int64_t> value_;
+    };
+
+    /// A gauge reported as its latest value, when set since the last flush.
+    class BC_API gauge
+      : noncopyable
+    {
+    public:
+        gauge();
+        void set(uint64_t value);
+        uint64_t value() const;
+
+    private:
+        friend class metrics;
+        std::atomic<uint64_t> value_;
+        std::atomic<bool> updated_;
+    };
+
+    /// A timer reported as count, mean, max and percentiles of its samples.
+    /// Samples are binned log-linearly in microseconds, with eight bins per
+    /// power of two, so percentiles are within 12.5% of the true sample.
+    class BC_API timer
+      : noncopyable
+    {
+    public:
+        static BC_CONSTEXPR size_t sub_bits = 3;
+        static BC_CONSTEXPR size_t sub_bins = size_t(1) << sub_bits;
+        static BC_CONSTEXPR size_t bins = sub_bins * (64 - sub_bits + 1);
+
+        /// The distribution of an interval, bins are microseconds.
+        struct snapshot
+        {
+            uint64_t count;
+            uint64_t total;
+            uint64_t maximum;
+            std::vector<uint64_t> bins;
+
+            /// The sample (microseconds) below which the fraction of samples.
+            uint64_t percentile(double fraction) const;
+        };
+
+        timer();
+        void record(const asio::duration& elapsed);
+        void record(uint64_t microseconds);
+
+        /// Take and reset the distribution.
+        snapshot take();
+
+        /// Add a distribution, such as one taken from another timer.
+        void merge(const snapshot& interval);
+
+        /// The bin of the value and the least value of a bin.
+        static size_t bin(uint64_t microseconds);
+        static uint64_t floor(size_t bin);
+
+    private:
+        std::atomic<uint64_t> total_;
+        std::atomic<uint64_t> maximum_;
+        std::atomic<uint64_t> bins_[bins];
+    };
+
+    /// Invoked at each collection to set metrics from sampled state.
+    typedef std::function<void(metrics&)> sampler;
+
+    metrics();
+
+    /// Get or create the metric of the name, references remain valid.
+    counter& get_counter(const std::string& name);
+    gauge& get_gauge(const std::string& name);
+    timer& get_timer(const std::string& name);
+
+    /// Add a sampler, invoked (outside of the lock) before each collection.
+    void add_sampler(sampler handler);
+
+    /// Format and reset the interval as newline-separated statsd lines, packed
+    /// into datagrams of up to mtu bytes (a longer line is sent alone).
+    datagrams collect(const std::string& prefix, size_t mtu);
+
+private:
+    template <class Metric>
+    using registry = std::map<std::string, std::unique_ptr<Metric>>;
+
+    template <class Metric>
+    Metric& get(registry<Metric>& metrics, const std::string& name);
+
+    // These are protected by mutex.
+    registry<counter> counters_;
+    registry<gauge> gauges_;
+    registry<timer> timers_;
+    std::vector<sampler> samplers_;
+    mutable upgrade_mutex mutex_;
+};
+
+} // namespace log
+} // namespace libbitcoin
+
+#endif
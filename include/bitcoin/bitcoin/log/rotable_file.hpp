@@ -29,6 +29,13 @@ namespace log {
 typedef boost::shared_ptr<std::ostream> stream;
 typedef boost::log::formatting_ostream::ostream_type formatter;
 
+/// The compression applied to archived (rotated) log files.
+enum class compression
+{
+    none,
+    gzip
+};
+
 struct rotable_file
 {
     boost::filesystem::path original_log;
@@ -37,6 +44,7 @@ struct rotable_file
     size_t minimum_free_space;
     size_t maximum_archive_size;
     size_t maximum_archive_files;
+    compression archive_compression;
 };
 
 } // namespace log
@@ -22,6 +22,7 @@
 #include <iostream>
 #include <boost/smart_ptr.hpp>
 #include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/log/async_file_sink.hpp>
 #include <bitcoin/bitcoin/log/rotable_file.hpp>
 #include <bitcoin/bitcoin/log/severity.hpp>
 #include <bitcoin/bitcoin/unicode/ofstream.hpp>
@@ -42,6 +43,12 @@ void initialize(log::file& debug_file, log::file& error_file,
 void initialize(const rotable_file& debug_file, const rotable_file& error_file,
     log::stream& output_stream, log::stream& error_stream, bool verbose);
 
+/// Initializes default rotable libbitcoin logging sinks and formats, with
+/// file sinks written asynchronously by a dedicated writer thread each.
+void initialize(const rotable_file& debug_file, const rotable_file& error_file,
+    log::stream& output_stream, log::stream& error_stream, bool verbose,
+    const async_options& async);
+
 /// Log stream operator.
 formatter& operator<<(formatter& stream, severity value);
 
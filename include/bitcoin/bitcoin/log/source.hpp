@@ -19,6 +19,7 @@
 #ifndef LIBBITCOIN_LOG_SOURCE_HPP
 #define LIBBITCOIN_LOG_SOURCE_HPP
 
+#include <atomic>
 #include <string>
 #include <boost/log/attributes/clock.hpp>
 #include <boost/log/sources/global_logger_storage.hpp>
@@ -41,7 +42,37 @@ BOOST_LOG_INLINE_GLOBAL_LOGGER_INIT(source, severity_source)
     return logger;
 }
 
+/// The runtime threshold, statements below it are not evaluated.
+BC_API void set_threshold(severity level);
+BC_API severity threshold();
+
+namespace detail {
+BC_API extern std::atomic<severity> threshold;
+} // namespace detail
+
+/// True if statements of the level pass the runtime threshold.
+/// This is a single relaxed load, evaluated before any log argument.
+inline bool enabled(severity level)
+{
+    return static_cast<int>(level) >= static_cast<int>(
+        detail::threshold.load(std::memory_order_relaxed));
+}
+
+// Statements below the compile-time floor are discarded by the compiler,
+// though still type checked. The floor is the ordinal of the lowest retained
+// severity, verbose (0) by default. Define BC_LOG_FLOOR=2 (info) to strip
+// verbose and debug statements, as with --enable-lean-log.
+#ifndef BC_LOG_FLOOR
+    #define BC_LOG_FLOOR 0
+#endif
+
+#define BC_LOG_ENABLED(level) \
+    (static_cast<int>(bc::log::severity::level) >= BC_LOG_FLOOR && \
+        bc::log::enabled(bc::log::severity::level))
+
+// The stream arguments are evaluated only if the statement is enabled.
 #define BC_LOG_SEVERITY(id, level) \
+    if (!BC_LOG_ENABLED(level)) {} else \
     BOOST_LOG_CHANNEL_SEV(bc::log::source::get(), id, bc::log::severity::level)
 
 #define LOG_VERBOSE(module) BC_LOG_SEVERITY(module, verbose)
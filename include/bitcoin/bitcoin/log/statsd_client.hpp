@@ -0,0 +1,99 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_LOG_STATSD_CLIENT_HPP
+#define LIBBITCOIN_LOG_STATSD_CLIENT_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <boost/asio.hpp>
+#include <bitcoin/bitcoin/config/authority.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/log/metrics.hpp>
+#include <bitcoin/bitcoin/utility/asio.hpp>
+#include <bitcoin/bitcoin/utility/deadline.hpp>
+#include <bitcoin/bitcoin/utility/enable_shared_from_base.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
+
+namespace libbitcoin {
+namespace log {
+
+/**
+ * This class is thread safe.
+ * Periodically flushes a metrics registry to a statsd server, as packed
+ * multiple-metric datagrams, without routing metrics through boost::log.
+ */
+class BC_API statsd_client
+  : public enable_shared_from_base<statsd_client>,
+    noncopyable
+{
+public:
+    typedef std::shared_ptr<statsd_client> ptr;
+
+    /// Conservative for ethernet after IPv6 and UDP headers.
+    static BC_CONSTEXPR size_t default_mtu = 1432;
+
+    /**
+     * Construct a client, the registry must outlive it.
+     * @param[in]  pool      The threadpool of the socket and flush timer.
+     * @param[in]  source    The registry of metrics to flush.
+     * @param[in]  server    The statsd server.
+     * @param[in]  interval  The period between flushes.
+     * @param[in]  prefix    The prefix of each metric name (e.g. "bn.").
+     * @param[in]  mtu       The maximum datagram payload size.
+     */
+    statsd_client(threadpool& pool, metrics& source,
+        const config::authority& server, const asio::duration& interval,
+        const std::string& prefix="", size_t mtu=default_mtu);
+
+    /// Open the socket and start the flush timer, false if already started.
+    bool start();
+
+    /// Stop the flush timer and send the final interval.
+    void stop();
+
+    /// Collect and send the current interval now.
+    void flush();
+
+private:
+    void send(const metrics::datagrams& payloads);
+    void handle_timer(const code& ec);
+
+    // These are thread safe.
+    metrics& metrics_;
+    const std::string prefix_;
+    const size_t mtu_;
+    const boost::asio::ip::udp::endpoint endpoint_;
+    deadline::ptr timer_;
+    std::atomic<bool> started_;
+    std::atomic<bool> stopped_;
+
+    // This is protected by mutex.
+    boost::asio::ip::udp::socket socket_;
+    mutable std::mutex mutex_;
+};
+
+} // namespace log
+} // namespace libbitcoin
+
+#endif
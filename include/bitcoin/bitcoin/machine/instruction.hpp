@@ -0,0 +1,90 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_MACHINE_INSTRUCTION_HPP
+#define LIBBITCOIN_MACHINE_INSTRUCTION_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/machine/opcode.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+
+namespace libbitcoin {
+namespace machine {
+
+/// A compact decoded operation, push data is not copied but is referenced by
+/// offset and size within the script bytes from which it was decoded.
+class BC_API instruction
+{
+public:
+    typedef std::vector<instruction> list;
+    typedef list::const_iterator iterator;
+
+    /// Decode script bytes, a failed op is the trailing (invalid) instruction.
+    static list decode(data_slice bytes);
+
+    /// Decode the instruction at position, which must be within the bytes,
+    /// and advance position past it. A failed op exhausts the position.
+    static instruction decode(data_slice bytes, size_t& position);
+
+    // Constructors.
+    //-------------------------------------------------------------------------
+
+    /// An invalid instruction (the code is disabled, as with operation).
+    instruction();
+
+    instruction(opcode code, uint32_t offset, uint32_t size);
+
+    // Properties.
+    //-------------------------------------------------------------------------
+
+    opcode code() const;
+    bool is_valid() const;
+
+    /// The position and size of the push data within the script bytes.
+    uint32_t offset() const;
+    uint32_t size() const;
+
+    /// The push data, bytes must be those from which this was decoded.
+    data_slice data(const data_chunk& bytes) const;
+
+    // Utilities.
+    //-------------------------------------------------------------------------
+
+    bool is_push() const;
+    bool is_payload() const;
+    bool is_counted() const;
+    bool is_version() const;
+    bool is_positive() const;
+    bool is_disabled() const;
+    bool is_relaxed_push() const;
+    bool is_oversized() const;
+
+private:
+    opcode code_;
+    bool valid_;
+    uint32_t offset_;
+    uint32_t size_;
+};
+
+} // namespace machine
+} // namespace libbitcoin
+
+#endif
@@ -26,6 +26,7 @@
 #include <bitcoin/bitcoin/machine/operation.hpp>
 #include <bitcoin/bitcoin/machine/program.hpp>
 #include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
 
 namespace libbitcoin {
 namespace machine {
@@ -118,7 +119,15 @@ public:
     static code run(const operation& op, program& program);
 
 private:
+    template <typename Recorder>
+    static code run(program& program, Recorder& recorder);
+
     static result run_op(const operation& op, program& program);
+
+    static result check_multisig_speculative(const program& program,
+        const chain::script& script_code,
+        const program::element_stack& endorsements,
+        const program::element_stack& public_keys, threadpool& pool);
 };
 
 } // namespace machine
@@ -20,7 +20,9 @@
 #define LIBBITCOIN_MACHINE_NUMBER_HPP
 
 #include <cstddef>
+#include <cstdint>
 #include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/machine/stack_element.hpp>
 #include <bitcoin/bitcoin/utility/data.hpp>
 
 namespace libbitcoin {
@@ -36,6 +38,9 @@ namespace machine {
  * an int64 and allowing out-of-range values to be returned as a vector of
  * bytes but throwing an exception if arithmetic is done or the result is
  * interpreted as an integer.
+ *
+ * Encoding and decoding use fixed buffers, so numeric opcodes convert
+ * between stack elements and values without heap allocation.
  */
 class BC_API number
 {
@@ -61,6 +66,9 @@ public:
     static const uint8_t positive_16;
     static const uint8_t negative_mask;
 
+    /// Any int64 encodes to at most this many bytes (magnitude and sign).
+    static BC_CONSTEXPR size_t max_encoded_size = sizeof(int64_t) + 1;
+
     /// Construct with zero value.
     number();
 
@@ -68,7 +76,7 @@ public:
     explicit number(int64_t value);
 
     /// Replace the value derived from a byte vector with LSB first ordering.
-    bool set_data(const data_chunk& data, size_t max_size);
+    bool set_data(data_slice data, size_t max_size);
 
     // Properties
     //-------------------------------------------------------------------------
@@ -76,6 +84,9 @@ public:
     /// Return the value as a byte vector with LSB first ordering.
     data_chunk data() const;
 
+    /// Return the value as an inline stack element with LSB first ordering.
+    stack_element element() const;
+
     /// Return the value bounded by the limits of int32.
     int32_t int32() const;
 
@@ -126,6 +137,10 @@ public:
     number& operator-=(const number& other);
 
 private:
+    typedef byte_array<max_encoded_size> encoding;
+
+    size_t encode(encoding& out) const;
+
     int64_t value_;
 };
 
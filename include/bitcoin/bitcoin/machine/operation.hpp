@@ -116,6 +116,24 @@ public:
     /// Convert the opcode to the corresponding [1..16] value (or undefined).
     static uint8_t opcode_to_positive(opcode code);
 
+    /// Opcode categories, as bits of the opcode property table.
+    enum property : uint16_t
+    {
+        push = 1 << 0,
+        payload = 1 << 1,
+        counted = 1 << 2,
+        version = 1 << 3,
+        numeric = 1 << 4,
+        positive = 1 << 5,
+        reserved = 1 << 6,
+        disabled = 1 << 7,
+        conditional = 1 << 8,
+        relaxed_push = 1 << 9
+    };
+
+    /// The categories of the opcode, from a constant initialized table.
+    static uint16_t properties(opcode code);
+
     /// Categories of opcodes.
     static bool is_push(opcode code);
     static bool is_payload(opcode code);
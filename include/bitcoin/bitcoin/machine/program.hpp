@@ -28,7 +28,10 @@
 #include <bitcoin/bitcoin/machine/opcode.hpp>
 #include <bitcoin/bitcoin/machine/operation.hpp>
 #include <bitcoin/bitcoin/machine/script_version.hpp>
+#include <bitcoin/bitcoin/machine/stack_element.hpp>
+#include <bitcoin/bitcoin/machine/verification_context.hpp>
 #include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
 
 namespace libbitcoin {
 namespace machine {
@@ -36,14 +39,15 @@ namespace machine {
 class BC_API program
 {
 public:
-    typedef data_stack::value_type value_type;
+    typedef stack_element value_type;
+    typedef stack_element::list element_stack;
     typedef operation::iterator op_iterator;
 
     // Older libstdc++ does not allow erase with const iterator.
     // This is a bug that requires we up the minimum compiler version.
     // So presently stack_iterator is a non-const iterator.
-    ////typedef data_stack::const_iterator stack_iterator;
-    typedef data_stack::iterator stack_iterator;
+    ////typedef element_stack::const_iterator stack_iterator;
+    typedef element_stack::iterator stack_iterator;
 
     /// Create an instance that does not expect to verify signatures.
     /// This is useful for script utilities but not with input metadata.
@@ -59,17 +63,36 @@ public:
     program(const chain::script& script, const chain::transaction& transaction,
         uint32_t input_index, uint32_t forks);
 
+    /// As above, with stacks taken from and returned to the context.
+    program(const chain::script& script, const chain::transaction& transaction,
+        uint32_t input_index, uint32_t forks, verification_context& context);
+
     /// Create an instance with initialized stack (witness run, v0 by default).
     program(const chain::script& script, const chain::transaction& transaction,
         uint32_t input_index, uint32_t forks, data_stack&& stack,
         uint64_t value, script_version version=script_version::zero);
 
-    /// Create using copied tx, input, forks, value, stack (prevout run).
+    /// As above, with stacks taken from and returned to the context.
+    program(const chain::script& script, const chain::transaction& transaction,
+        uint32_t input_index, uint32_t forks, data_stack&& stack,
+        uint64_t value, script_version version, verification_context& context);
+
+    /// As above, with the stack read from the [first, last) range of chunks.
+    program(const chain::script& script, const chain::transaction& transaction,
+        uint32_t input_index, uint32_t forks, data_stack::const_iterator first,
+        data_stack::const_iterator last, uint64_t value,
+        script_version version, verification_context& context);
+
+    /// Create using copied tx, input, forks, value, context, stack (prevout).
     program(const chain::script& script, const program& other);
 
-    /// Create using copied tx, input, forks, value and moved stack (p2sh run).
+    /// Create using copied tx, input, forks, value, context and moved stack
+    /// (p2sh run, or prevout run when the input stack is not required later).
     program(const chain::script& script, program&& other, bool move);
 
+    /// Stacks are returned to the context, if any.
+    ~program();
+
     /// Constant registers.
     bool is_valid() const;
     uint32_t forks() const;
@@ -78,6 +101,12 @@ public:
     script_version version() const;
     const chain::transaction& transaction() const;
 
+    /// The profile of the context, or nullptr if not measured.
+    script_profile* profile() const;
+
+    /// The multisig pool of the context, or nullptr if matched serially.
+    threadpool* multisig_pool() const;
+
     /// Program registers.
     op_iterator begin() const;
     op_iterator jump() const;
@@ -100,12 +129,13 @@ public:
     void push_copy(const value_type& item);
 
     /// Primary pop.
-    data_chunk pop();
+    value_type pop();
     bool pop(int32_t& out_value);
     bool pop(number& out_number, size_t maxiumum_size=max_number_size);
     bool pop_binary(number& first, number& second);
     bool pop_ternary(number& first, number& second, number& third);
     bool pop_position(stack_iterator& out_position);
+    bool pop(element_stack& section, size_t count);
     bool pop(data_stack& section, size_t count);
 
     /// Primary push/pop optimizations (active).
@@ -143,8 +173,9 @@ public:
     bool succeeded() const;
 
 private:
-    // A space-efficient dynamic bitset (specialized).
-    typedef std::vector<bool> bool_stack;
+    program(const chain::script& script, const chain::transaction& transaction,
+        uint32_t input_index, uint32_t forks, data_stack&& stack,
+        uint64_t value, script_version version, verification_context* context);
 
     void reserve_stacks();
     bool stack_to_bool(bool clean) const;
@@ -154,14 +185,18 @@ private:
     const uint32_t input_index_;
     const uint32_t forks_;
     const uint64_t value_;
+    verification_context* const context_;
 
     script_version version_;
-    size_t negative_count_;
     size_t operation_count_;
     op_iterator jump_;
-    data_stack primary_;
-    data_stack alternate_;
-    bool_stack condition_;
+    element_stack primary_;
+    element_stack alternate_;
+
+    // The condition stack is represented by its size and the position of its
+    // first false value, as values above a false value cannot be observed.
+    size_t condition_size_;
+    size_t first_false_;
 };
 
 } // namespace machine
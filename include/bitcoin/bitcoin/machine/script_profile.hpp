@@ -0,0 +1,89 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_MACHINE_SCRIPT_PROFILE_HPP
+#define LIBBITCOIN_MACHINE_SCRIPT_PROFILE_HPP
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/machine/opcode.hpp>
+
+namespace libbitcoin {
+namespace machine {
+
+/**
+ * Script execution metrics, collected only when attached to a verification
+ * context. Without a profile the interpreter runs its unmeasured loop.
+ * This is not thread safe, use one instance per verifying thread and merge
+ * the instances into a total for export.
+ */
+class BC_API script_profile
+{
+public:
+    typedef std::chrono::nanoseconds duration;
+
+    struct operation_metrics
+    {
+        uint64_t count;
+        duration elapsed;
+    };
+
+    /// Construct with no recorded metrics.
+    script_profile();
+
+    /// Record one executed operation and its execution time.
+    void record_operation(opcode code, duration elapsed);
+
+    /// Record the primary stack depth, retaining the high-water mark.
+    void record_depth(size_t depth);
+
+    /// Record one verified input and its total verification time.
+    void record_input(duration elapsed);
+
+    /// Accumulate the metrics of another profile into this one.
+    void merge(const script_profile& other);
+
+    /// Clear all recorded metrics.
+    void reset();
+
+    // Properties.
+    //-------------------------------------------------------------------------
+
+    const operation_metrics& operation(opcode code) const;
+    size_t depth() const;
+    uint64_t inputs() const;
+    duration input_elapsed() const;
+
+    /// Send the metrics to the statsd source, with names under prefix.
+    void publish(const std::string& prefix) const;
+
+private:
+    std::array<operation_metrics, 256> operations_;
+    size_t depth_;
+    uint64_t inputs_;
+    duration input_elapsed_;
+};
+
+} // namespace machine
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,101 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_MACHINE_STACK_ELEMENT_HPP
+#define LIBBITCOIN_MACHINE_STACK_ELEMENT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/math/elliptic_curve.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+
+namespace libbitcoin {
+namespace machine {
+
+/**
+ * An immutable script stack element with inline storage for values up to
+ * the size of an endorsement, which covers numbers, hashes, public keys
+ * and signatures. Only larger pushes (such as scripts) use the heap, and a
+ * moved data_chunk of that size is retained without copy.
+ */
+class BC_API stack_element
+{
+public:
+    typedef std::vector<stack_element> list;
+    typedef const uint8_t* const_iterator;
+
+    /// Values of up to this many bytes do not allocate.
+    static BC_CONSTEXPR size_t inline_capacity = max_endorsement_size;
+
+    // Constructors.
+    //-------------------------------------------------------------------------
+
+    stack_element();
+
+    stack_element(stack_element&& other);
+    stack_element(const stack_element& other);
+
+    stack_element(data_chunk&& data);
+    stack_element(const data_chunk& data);
+    stack_element(std::initializer_list<uint8_t> bytes);
+    explicit stack_element(data_slice data);
+
+    // Operators.
+    //-------------------------------------------------------------------------
+
+    stack_element& operator=(stack_element&& other);
+    stack_element& operator=(const stack_element& other);
+
+    bool operator==(const stack_element& other) const;
+    bool operator!=(const stack_element& other) const;
+
+    uint8_t operator[](size_t index) const;
+
+    // Properties.
+    //-------------------------------------------------------------------------
+
+    const uint8_t* data() const;
+    size_t size() const;
+    bool empty() const;
+
+    const_iterator begin() const;
+    const_iterator end() const;
+    uint8_t front() const;
+    uint8_t back() const;
+
+    /// Copy the value to a new data_chunk.
+    data_chunk to_data() const;
+
+private:
+    bool is_inline() const;
+    void assign(const uint8_t* data, size_t size);
+
+    size_t size_;
+    data_chunk heap_;
+    uint8_t buffer_[inline_capacity];
+};
+
+} // namespace machine
+} // namespace libbitcoin
+
+#include <bitcoin/bitcoin/impl/machine/stack_element.ipp>
+
+#endif
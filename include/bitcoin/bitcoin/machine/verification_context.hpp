@@ -0,0 +1,85 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_MACHINE_VERIFICATION_CONTEXT_HPP
+#define LIBBITCOIN_MACHINE_VERIFICATION_CONTEXT_HPP
+
+#include <cstddef>
+#include <vector>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/machine/script_profile.hpp>
+#include <bitcoin/bitcoin/machine/stack_element.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
+
+namespace libbitcoin {
+namespace machine {
+
+/**
+ * Stack storage shared by the programs that verify an input (input, prevout,
+ * p2sh and witness runs). Programs take their stacks from the context and
+ * return them on destruction, so the reserved capacity is allocated once and
+ * retained across stages and across the inputs of a transaction.
+ * A context may also carry a script profile, to which the programs that use
+ * it report execution metrics, and a threadpool on which multisig
+ * signatures are matched to keys speculatively.
+ * This is not thread safe, use one instance per verifying thread.
+ */
+class BC_API verification_context
+  : noncopyable
+{
+public:
+    typedef stack_element::list element_stack;
+
+    /// Construct without a profile, execution is not measured.
+    verification_context();
+
+    /// Construct with a profile to receive execution metrics.
+    verification_context(script_profile& profile);
+
+    /// Take an empty stack, reserved to max_stack_size if newly created.
+    element_stack acquire();
+
+    /// Return a stack, elements are dropped but capacity is retained.
+    void release(element_stack&& stack);
+
+    /// The number of stacks held for reuse.
+    size_t size() const;
+
+    /// The attached profile, or nullptr if execution is not measured.
+    script_profile* profile() const;
+
+    /// Set the pool on which all multisig signature and key pairs are
+    /// verified concurrently, or nullptr (default) to match serially. This
+    /// trades additional verifications for latency. The pool must outlive
+    /// its use by this context.
+    void set_multisig_pool(threadpool* pool);
+
+    /// The multisig pool, or nullptr if multisig is matched serially.
+    threadpool* multisig_pool() const;
+
+private:
+    script_profile* const profile_;
+    threadpool* multisig_pool_;
+    std::vector<element_stack> stacks_;
+};
+
+} // namespace machine
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,112 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CACHE_SNAPSHOT_HPP
+#define LIBBITCOIN_CACHE_SNAPSHOT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <boost/filesystem.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/asio.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
+
+namespace libbitcoin {
+
+/**
+ * This class is not thread safe.
+ * A read-only memory mapping of the keys of a salted cache, so that a cache
+ * may be warmed at startup from the keys it held at shutdown. Keys are the
+ * salted hashes of the cache, so a key cannot be forged for chosen content
+ * without the salt, which is derived from a secret that is not stored here.
+ * The prefix and each chunk of keys are authenticated by a salted MAC, so a
+ * snapshot of another salt is rejected and a corrupt chunk is skipped.
+ *
+ * [magic:4][version:4][count:8][tag:4][zero:4][mac:32]
+ * chunks: [key:32]...[mac:32]
+ *
+ * Integers are little-endian, each chunk holds chunk_keys keys (the last
+ * the remainder) and each mac is hmac_sha256(salt) of the preceding bytes of
+ * the prefix or chunk. The tag is a value of the cache under which the keys
+ * were hashed, such as its enabled forks.
+ */
+class BC_API cache_snapshot
+  : noncopyable
+{
+public:
+    typedef boost::filesystem::path path;
+
+    /// Return false if the key is not accepted and loading should stop.
+    typedef std::function<bool(const hash_digest&)> inserter;
+
+    /// The file magic ("csnp" as written) and the version written.
+    static BC_CONSTEXPR uint32_t magic = 0x706e7363;
+    static BC_CONSTEXPR uint32_t version = 1;
+
+    /// The size of the file prefix and the keys of each chunk.
+    static BC_CONSTEXPR size_t prefix_size = 56;
+    static BC_CONSTEXPR size_t chunk_keys = 4096;
+
+    /// The salt of the named cache, derived from a persistent secret.
+    static hash_digest to_salt(const hash_digest& secret,
+        const std::string& name);
+
+    /// Write the keys, hashed under the salt and tag, to the file.
+    static bool store(const path& file, const hash_digest& salt, uint32_t tag,
+        const hash_list& keys);
+
+    /// Construct a closed file.
+    cache_snapshot();
+
+    /// Map the file, false if it cannot be opened, is not a snapshot, or its
+    /// prefix is not authenticated under the salt.
+    bool open(const path& file, const hash_digest& salt);
+
+    /// Unmap the file.
+    void close();
+
+    bool is_open() const;
+
+    /// The number of keys and the tag under which they were hashed.
+    size_t size() const;
+    uint32_t tag() const;
+
+    /// Pass each key of each authenticated chunk to insert, chunks in
+    /// parallel on the pool, until insert returns false or the timeout
+    /// expires. Return the number of keys accepted. Insert must be thread
+    /// safe.
+    size_t load(threadpool& pool, const asio::duration& timeout,
+        const inserter& insert) const;
+
+private:
+    size_t chunks() const;
+
+    boost::iostreams::mapped_file_source file_;
+    hash_digest salt_;
+    size_t size_;
+    uint32_t tag_;
+};
+
+} // namespace libbitcoin
+
+#endif
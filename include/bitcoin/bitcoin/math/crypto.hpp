@@ -19,6 +19,7 @@
 #ifndef LIBBITCOIN_AES256_HPP
 #define LIBBITCOIN_AES256_HPP
 
+#include <cstddef>
 #include <cstdint>
 #include <bitcoin/bitcoin/compat.hpp>
 #include <bitcoin/bitcoin/define.hpp>
@@ -48,6 +49,21 @@ BC_API void aes256_encrypt(const aes_secret& key, aes_block& block);
  */
 BC_API void aes256_decrypt(const aes_secret& key, aes_block& block);
 
+/**
+ * Perform aes256 encryption on count contiguous data blocks, each
+ * independently (ecb). The key is expanded once for all blocks, and blocks
+ * are pipelined where the cpu provides hardware aes.
+ */
+BC_API void aes256_encrypt(const aes_secret& key, aes_block* blocks,
+    size_t count);
+
+/**
+ * Perform aes256 decryption on count contiguous data blocks, each
+ * independently (ecb).
+ */
+BC_API void aes256_decrypt(const aes_secret& key, aes_block* blocks,
+    size_t count);
+
 } // namespace libbitcoin
 
 #endif
@@ -0,0 +1,73 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_EC_POINT_TABLE_HPP
+#define LIBBITCOIN_EC_POINT_TABLE_HPP
+
+#include <cstddef>
+#include <vector>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/math/elliptic_curve.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+
+namespace libbitcoin {
+
+/**
+ * Precomputed multiples of a fixed point, for multiplication of the point by
+ * many scalars (such as a stealth scan or spend key, or a public parent key).
+ * Construction sums 1024 points (64KB table), each multiplication is then the
+ * sum of 65 table points, several times faster than ec_multiply. Table
+ * selection is constant time, as the scalar may be secret. The table is
+ * immutable once constructed and so may be shared between threads.
+ */
+class BC_API ec_point_table
+{
+public:
+    /// The point is parsed once, the table is invalid if the point is.
+    ec_point_table(const ec_compressed& point);
+
+    /// True if the point is valid.
+    operator bool() const;
+
+    /// The fixed point.
+    const ec_compressed& point() const;
+
+    /// Multiply the point by the scalar, as ec_multiply(point, scalar).
+    /// False if the table or scalar is invalid (zero or not below order).
+    bool multiply(ec_compressed& out, const ec_secret& scalar) const;
+    bool multiply(ec_uncompressed& out, const ec_secret& scalar) const;
+
+private:
+    // Opaque copy of the parsed secp256k1 point, to avoid external types.
+    typedef byte_array<64> parsed_point;
+
+    template <size_t Size>
+    bool multiply(byte_array<Size>& out, const ec_secret& scalar) const;
+
+    ec_compressed point_;
+
+    // Multiples (digit + 1) * 16^window * point, by window and then digit.
+    std::vector<parsed_point> table_;
+
+    // The negated sum of 16^window * point, offsetting the digit increment.
+    parsed_point offset_;
+};
+
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,103 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_EC_WORKSPACE_HPP
+#define LIBBITCOIN_EC_WORKSPACE_HPP
+
+#include <cstddef>
+#include <vector>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/math/elliptic_curve.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+
+namespace libbitcoin {
+
+/**
+ * A sequence of point operations over parsed points, for chains such as
+ * stealth and BIP32 derivation or ring signature commitments. Each input is
+ * parsed once and each output serialized once (on compress or decompress),
+ * where the equivalent ec_add/ec_multiply/ec_sum calls parse and serialize
+ * at every step. Points are referenced by index, in order of push. A failed
+ * operation invalidates its target, and operations on an invalid point fail.
+ * Not thread safe.
+ */
+class BC_API ec_workspace
+{
+public:
+    typedef std::vector<size_t> indexes;
+
+    /// Reserve space for the expected number of points.
+    void reserve(size_t count);
+
+    /// The number of points, valid or not.
+    size_t size() const;
+
+    /// Remove all points.
+    void clear();
+
+    /// True if the indexed point exists and is valid.
+    bool valid(size_t index) const;
+
+    /// Append a point, false (and appended invalid) if it does not parse.
+    bool push(const ec_compressed& point);
+    bool push(const ec_uncompressed& point);
+
+    /// Append scalar * G, false (and appended invalid) if scalar is invalid.
+    bool push(const ec_secret& scalar);
+
+    /// Append the sum of the indexed points, combined in a single pass.
+    /// False (and appended invalid) if any point is invalid or the sum is
+    /// infinity.
+    bool sum(const indexes& points);
+
+    /// Replace the indexed point with point + scalar * G (ec_add).
+    bool add(size_t index, const ec_secret& scalar);
+
+    /// Replace the indexed point with point * scalar (ec_multiply).
+    bool multiply(size_t index, const ec_secret& scalar);
+
+    /// Replace the indexed point with its negation (ec_negate).
+    bool negate(size_t index);
+
+    /// Serialize the indexed point, false if it does not exist or is invalid.
+    bool compress(ec_compressed& out, size_t index) const;
+    bool decompress(ec_uncompressed& out, size_t index) const;
+
+    /// Serialize all points in order, invalid points as null_compressed_point.
+    /// False if any point is invalid.
+    bool compress(point_list& out) const;
+
+private:
+    // Opaque copy of the parsed secp256k1 point, to avoid external types.
+    typedef byte_array<64> parsed_point;
+
+    template <size_t Size>
+    bool push(const byte_array<Size>& point);
+
+    template <size_t Size>
+    bool serialize(byte_array<Size>& out, size_t index) const;
+
+    bool append(const parsed_point& point, bool valid);
+
+    std::vector<parsed_point> points_;
+    std::vector<bool> valid_;
+};
+
+} // namespace libbitcoin
+
+#endif
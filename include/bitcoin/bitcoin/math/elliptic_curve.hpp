@@ -66,6 +66,22 @@ struct BC_API recoverable_signature
     uint8_t recovery_id;
 };
 
+/// BIP340 x-only public key (the x coordinate of the point with even y):
+static BC_CONSTEXPR size_t ec_xonly_size = 32;
+typedef byte_array<ec_xonly_size> ec_xonly;
+
+/// BIP340 Schnorr signature (the x coordinate of R and the scalar s):
+static BC_CONSTEXPR size_t schnorr_signature_size = 64;
+typedef byte_array<schnorr_signature_size> schnorr_signature;
+
+/// BIP340 Schnorr verification, for batch verification:
+struct BC_API schnorr_check
+{
+    ec_xonly point;
+    hash_digest message;
+    schnorr_signature signature;
+};
+
 static BC_CONSTEXPR ec_compressed null_compressed_point =
 {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -80,6 +96,14 @@ static BC_CONSTEXPR ec_uncompressed null_uncompressed_point =
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
 };
 
+// Initialize EC contexts
+// ----------------------------------------------------------------------------
+
+/// Create the shared secp256k1 contexts now, rather than on first use. Call
+/// at startup (or from a background thread) to keep table generation off the
+/// first request. Each context is created once, regardless of calls.
+BC_API void ec_initialize(bool for_signing=true, bool for_verification=true);
+
 // Add and multiply EC values
 // ----------------------------------------------------------------------------
 
@@ -92,6 +116,12 @@ BC_API bool ec_add(ec_uncompressed& point, const ec_secret& scalar);
 /// Compute the sum a = (a + b) % n, where n is the curve order.
 BC_API bool ec_add(ec_secret& left, const ec_secret& right);
 
+/// Compute the sums out[i] = a + G*b[i] for count scalars, parsing a once.
+/// A sum that fails is set to null_compressed_point.
+/// @return false if the point is invalid.
+BC_API bool ec_add(ec_compressed* out, const ec_compressed& point,
+    const ec_secret* scalars, size_t count);
+
 /// Compute the product point *= secret.
 BC_API bool ec_multiply(ec_compressed& point, const ec_secret& scalar);
 
@@ -162,10 +192,17 @@ bool is_endorsement(const endorsement& endorsement);
 BC_API bool parse_endorsement(uint8_t& sighash_type,
     der_signature& der_signature, endorsement&& endorsement);
 
+/// Split an endorsement into signature hash type and DER signature without
+/// copying, the DER signature refers to the endorsement.
+BC_API bool parse_endorsement(uint8_t& sighash_type,
+    data_slice& der_signature, data_slice endorsement);
+
 /// Parse a DER encoded signature with optional strict DER enforcement.
 /// Treat an empty DER signature as invalid, in accordance with BIP66.
-BC_API bool parse_signature(ec_signature& out,
-    const der_signature& der_signature, bool strict);
+/// Strict encodings of in-range values (all standard signatures) are read
+/// in place, and the lax parser is used only if this fails and not strict.
+BC_API bool parse_signature(ec_signature& out, data_slice der_signature,
+    bool strict);
 
 /// Encode an EC signature as DER (strict).
 BC_API bool encode_signature(der_signature& out, const ec_signature& signature);
@@ -189,6 +226,24 @@ BC_API bool verify_signature(const ec_uncompressed& point,
 BC_API bool verify_signature(data_slice point, const hash_digest& hash,
     const ec_signature& signature);
 
+// Schnorr sign/verify (BIP340)
+// ----------------------------------------------------------------------------
+
+/// Create a BIP340 Schnorr signature of the message, with auxiliary random
+/// data mixed into the nonce (null_hash is acceptable but not recommended).
+BC_API bool sign_schnorr(schnorr_signature& out, const ec_secret& secret,
+    const hash_digest& message, const hash_digest& auxiliary=null_hash);
+
+/// Verify a BIP340 Schnorr signature using an x-only point.
+BC_API bool verify_schnorr(const ec_xonly& point, const hash_digest& message,
+    const schnorr_signature& signature);
+
+/// Verify BIP340 Schnorr signatures together, true if all are valid. The
+/// signatures are combined with random weights into one multi-scalar
+/// multiplication, so the cost per signature falls as the count grows. Small
+/// counts are verified individually, where that is expected to be faster.
+BC_API bool verify_schnorr(const schnorr_check* checks, size_t count);
+
 // Recoverable sign/recover
 // ----------------------------------------------------------------------------
 
@@ -20,17 +20,20 @@
 #define LIBBITCOIN_HASH_HPP
 
 #include <cstddef>
+#include <memory>
 #include <string>
 #include <vector>
 #include <boost/functional/hash_fwd.hpp>
-#include <boost/multiprecision/cpp_int.hpp>
 #include <bitcoin/bitcoin/compat.hpp>
 #include <bitcoin/bitcoin/define.hpp>
 #include <bitcoin/bitcoin/utility/data.hpp>
 #include <bitcoin/bitcoin/utility/endian.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
 
 namespace libbitcoin {
 
+class threadpool;
+
 // Common bitcoin hash container sizes.
 static BC_CONSTEXPR size_t hash_size = 32;
 static BC_CONSTEXPR size_t half_hash_size = hash_size / 2;
@@ -55,9 +58,6 @@ typedef std::vector<long_hash> long_hash_list;
 typedef std::vector<short_hash> short_hash_list;
 typedef std::vector<mini_hash> mini_hash_list;
 
-// Alias for boost big integer type.
-typedef boost::multiprecision::uint256_t uint256_t;
-
 // Null-valued common bitcoin hashes.
 
 BC_CONSTEXPR hash_digest null_hash
@@ -107,11 +107,6 @@ BC_CONSTEXPR mini_hash null_mini_hash
     }
 };
 
-inline uint256_t to_uint256(const hash_digest& hash)
-{
-    return from_little_endian<uint256_t>(hash.begin(), hash.end());
-}
-
 /// Generate a scrypt hash to fill a byte array.
 template <size_t Size>
 byte_array<Size> scrypt(data_slice data, data_slice salt, uint64_t N,
@@ -121,15 +116,38 @@ byte_array<Size> scrypt(data_slice data, data_slice salt, uint64_t N,
 BC_API data_chunk scrypt(data_slice data, data_slice salt, uint64_t N,
     uint32_t p, uint32_t r, size_t length);
 
+/// The scratch memory of one scrypt mix (of p per hash), about N * r * 128.
+BC_API size_t scrypt_scratch_size(uint64_t N, uint32_t r);
+
+/// Generate scrypt hashes of specified length for count independent data and
+/// salt pairs into out. The p mixes of all hashes run concurrently on the
+/// pool, with no more at once than fit in memory_budget (at least one).
+BC_API void scrypt_batch(const data_slice* data, const data_slice* salts,
+    size_t count, uint64_t N, uint32_t p, uint32_t r, size_t length,
+    data_chunk* out, threadpool& pool, size_t memory_budget);
+
 /// Generate a bitcoin hash.
 BC_API hash_digest bitcoin_hash(data_slice data);
 
-/// Generate a scrypt hash.
+/// Generate a scrypt hash, scrypt(data, data, 1024, 1, 1). The hash of an 80
+/// byte header uses a dedicated mix with per thread scratch.
 BC_API hash_digest scrypt_hash(data_slice data);
 
+/// The number of headers mixed together by scrypt_hash_batch.
+BC_API size_t scrypt_hash_lanes();
+
+/// Generate scrypt hashes of count data into out, as scrypt_hash. The 80 byte
+/// headers are mixed together in SIMD lanes, up to scrypt_hash_lanes().
+BC_API void scrypt_hash_batch(const data_slice* data, size_t count,
+    hash_digest* out);
+
 /// Generate a bitcoin short hash.
 BC_API short_hash bitcoin_short_hash(data_slice data);
 
+/// Generate a bitcoin short hash of a compressed public key, with the fixed
+/// single block padding of each hash precomputed.
+BC_API short_hash bitcoin_short_hash(const byte_array<1 + hash_size>& point);
+
 /// Generate a ripemd160 hash
 BC_API short_hash ripemd160_hash(data_slice data);
 BC_API data_chunk ripemd160_hash_chunk(data_slice data);
@@ -146,6 +164,51 @@ BC_API data_chunk sha256_hash_chunk(data_slice data);
 /// This hash function was used in electrum seed stretching (obsoleted).
 BC_API hash_digest sha256_hash(data_slice first, data_slice second);
 
+/// Incremental sha256 hashing of a message that arrives in parts.
+class BC_API sha256_context
+  : noncopyable
+{
+public:
+    sha256_context();
+    ~sha256_context();
+
+    /// Begin a new message.
+    void reset();
+
+    /// Append the data to the message.
+    void write(data_slice data);
+
+    /// The hash of the message, reset before writing another.
+    hash_digest digest();
+
+private:
+    struct state;
+    const std::unique_ptr<state> state_;
+};
+
+/// Generate sha256 hashes of count independent messages into out.
+/// Messages are interleaved across SIMD lanes where supported by the cpu.
+BC_API void sha256_hash_batch(const data_slice* data, size_t count,
+    hash_digest* out);
+
+/// Generate bitcoin hashes of count independent messages into out.
+BC_API void bitcoin_hash_batch(const data_slice* data, size_t count,
+    hash_digest* out);
+
+/// Generate bitcoin short hashes of count independent messages into out.
+/// Both hashes are interleaved across SIMD lanes where supported by the cpu.
+BC_API void bitcoin_short_hash_batch(const data_slice* data, size_t count,
+    short_hash* out);
+
+/// Generate the bitcoin hash of the concatenation of two hashes.
+/// This is the merkle tree node hash, computed without allocation.
+BC_API hash_digest merkle_hash(const hash_digest& left,
+    const hash_digest& right);
+
+/// Replace a merkle tree level with its parent level, hashing all nodes of
+/// the level in one batch. An odd last hash is paired with itself.
+BC_API void merkle_hash_level(hash_list& level);
+
 // Generate a hmac sha256 hash.
 BC_API hash_digest hmac_sha256_hash(data_slice data, data_slice key);
 
@@ -155,10 +218,39 @@ BC_API long_hash sha512_hash(data_slice data);
 /// Generate a hmac sha512 hash.
 BC_API long_hash hmac_sha512_hash(data_slice data, data_slice key);
 
+/// Generate hmac sha512 hashes of count independent data and key pairs into
+/// out. Four hashes share SIMD lanes where supported by the cpu, such as for
+/// concurrent hd key derivations.
+BC_API void hmac_sha512_hash_batch(const data_slice* data,
+    const data_slice* keys, size_t count, long_hash* out);
+
+/// A hmac sha512 keyed once and applied to many messages.
+/// The key pads are hashed on construction. This class is thread safe.
+class BC_API hmac_sha512_context
+  : noncopyable
+{
+public:
+    hmac_sha512_context(data_slice key);
+    ~hmac_sha512_context();
+
+    /// The hmac of the message under the key.
+    long_hash digest(data_slice data) const;
+
+private:
+    struct state;
+    const std::unique_ptr<state> state_;
+};
+
 /// Generate a pkcs5 pbkdf2 hmac sha512 hash.
 BC_API long_hash pkcs5_pbkdf2_hmac_sha512(data_slice passphrase,
     data_slice salt, size_t iterations);
 
+/// Generate pkcs5 pbkdf2 hmac sha512 hashes of count independent passphrase
+/// and salt pairs into out. Four derivations share SIMD lanes where supported
+/// by the cpu, such as when testing many mnemonic candidates.
+BC_API void pkcs5_pbkdf2_hmac_sha512_batch(const data_slice* passphrases,
+    const data_slice* salts, size_t count, size_t iterations, long_hash* out);
+
 } // namespace libbitcoin
 
 // Extend std and boost namespaces with our hash wrappers.
@@ -0,0 +1,71 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_MUHASH_HPP
+#define LIBBITCOIN_MUHASH_HPP
+
+#include <array>
+#include <cstdint>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+
+namespace libbitcoin {
+
+/**
+ * MuHash3072 rolling set hash, as used for the bitcoind UTXO set hash. Each
+ * element is mapped to a 3072 bit number (the ChaCha20 keystream keyed by
+ * the sha256 of the element) and the set is the product of these modulo the
+ * prime 2^3072 - 1103717. Insertion and removal commute, so the hash is
+ * independent of order and sets may be combined. Removals are multiplied
+ * into a separate denominator, so that only digest() computes an inverse.
+ * An insertion or removal costs one 3072 bit modular multiplication.
+ */
+class BC_API muhash
+{
+public:
+    /// The empty set.
+    muhash();
+
+    /// Insert the element into the set.
+    void insert(data_slice element);
+
+    /// Remove the element from the set, it need not have been inserted.
+    void remove(data_slice element);
+
+    /// Apply the insertions and removals of the other set.
+    muhash& operator*=(const muhash& other);
+
+    /// Reverse the insertions and removals of the other set.
+    muhash& operator/=(const muhash& other);
+
+    /// The sha256 hash of the set product (384 bytes, little-endian). This
+    /// inverts the denominator, which costs several thousand multiplications.
+    hash_digest digest() const;
+
+private:
+    // Opaque copy of the 3072 bit number, to avoid external types.
+    typedef std::array<uint64_t, 48> number;
+
+    number numerator_;
+    number denominator_;
+};
+
+} // namespace libbitcoin
+
+#endif
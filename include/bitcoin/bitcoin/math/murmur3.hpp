@@ -0,0 +1,40 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_MURMUR3_HPP
+#define LIBBITCOIN_MURMUR3_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+
+namespace libbitcoin {
+
+/// Generate a MurmurHash3 (x86, 32 bit) value of the data.
+BC_API uint32_t murmur3(uint32_t seed, data_slice data);
+
+/// Generate MurmurHash3 values of the data for count seeds into out.
+/// The seed-independent mixing of each block is computed once and applied
+/// to all seeds, which are updated together so that lanes can vectorize.
+BC_API void murmur3(const uint32_t* seeds, size_t count, data_slice data,
+    uint32_t* out);
+
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,90 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_PIN_SKETCH_HPP
+#define LIBBITCOIN_PIN_SKETCH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+
+namespace libbitcoin {
+
+/**
+ * PinSketch of a set of nonzero 32 bit elements, as used by minisketch for
+ * transaction set reconciliation (Erlay). A sketch of capacity c is the odd
+ * power sums s1, s3, ... s(2c-1) of its elements in GF(2^32), so it is 4c
+ * bytes regardless of the set size. Adding an element twice removes it, and
+ * merging two sketches sketches the symmetric difference of their sets,
+ * which decodes if it has no more than capacity elements. Insertion costs c
+ * field multiplications (carry-less if available), decoding is quadratic in
+ * the capacity (Berlekamp-Massey and Berlekamp trace root finding).
+ */
+class BC_API pin_sketch
+{
+public:
+    typedef uint32_t element;
+    typedef std::vector<element> elements;
+
+    /// The serialized size of each power sum.
+    static const size_t element_size;
+
+    /// The capacity for reconciliation of sets of the given sizes, where q
+    /// is the expected fraction of the smaller set that differs (bip330):
+    /// |local - remote| + q * min(local, remote) + 1, limited to maximum.
+    static size_t estimate_capacity(size_t local, size_t remote, double q,
+        size_t maximum);
+
+    /// The sketch of the empty set.
+    pin_sketch(size_t capacity);
+
+    /// Deserialize a sketch, with capacity of the data size / element_size.
+    /// Returns false if the size is not a multiple of element_size.
+    bool from_data(const data_chunk& data);
+
+    /// Serialize the power sums, little-endian.
+    data_chunk to_data() const;
+
+    /// The number of differences that can be decoded.
+    size_t capacity() const;
+
+    /// Add the element, or remove it if present. Zero is ignored.
+    void add(element value);
+
+    /// Merge the other sketch, truncating to the smaller capacity.
+    /// The result is the sketch of the symmetric difference of the sets.
+    pin_sketch& operator^=(const pin_sketch& other);
+
+    bool operator==(const pin_sketch& other) const;
+    bool operator!=(const pin_sketch& other) const;
+
+    /// Decode the elements of the sketch, in ascending order. Returns false
+    /// if the set has more elements than the capacity, which is detected
+    /// with high probability except at the smallest capacities, where any
+    /// sum decodes (a capacity of one decodes every sketch).
+    bool decode(elements& out) const;
+
+private:
+    std::vector<element> sums_;
+};
+
+} // namespace libbitcoin
+
+#endif
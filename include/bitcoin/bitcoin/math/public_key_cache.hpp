@@ -0,0 +1,108 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_PUBLIC_KEY_CACHE_HPP
+#define LIBBITCOIN_PUBLIC_KEY_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/math/elliptic_curve.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/math/salted_hash.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+#include <bitcoin/bitcoin/utility/sharded_map.hpp>
+
+namespace libbitcoin {
+
+/**
+ * A bounded map of serialized public keys (compressed, uncompressed or
+ * hybrid) to their parsed form, which for compressed keys includes the
+ * decompression (a modular square root). Keys are recycled across many
+ * inputs by large wallets, so this saves the parse of each recurrence.
+ * Entries are keyed by the serialization (and its size), hashed under the
+ * process salt, and partitioned over independently-locked shards (see
+ * sharded_map). When full an entry is evicted for each insertion. A zero
+ * byte budget disables the cache. This class is thread safe.
+ */
+class BC_API public_key_cache
+  : noncopyable
+{
+public:
+    /// Opaque copy of a parsed secp256k1 public key, for library use only.
+    typedef byte_array<64> parsed_key;
+
+    /// The approximate memory cost of one entry, including container overhead.
+    static const size_t entry_size;
+
+    /// The cache consulted by verify_signature(data_slice, ...), disabled by
+    /// default. Enable by resize, this is shared by all threads of the
+    /// process.
+    static public_key_cache& parsed_keys();
+
+    /// Construct a cache limited to the given number of bytes.
+    public_key_cache(size_t maximum_bytes=0);
+
+    /// Find the parsed form of the serialized key, false if not cached.
+    bool find(parsed_key& out, data_slice point) const;
+
+    /// Record the parsed form of a (valid) serialized key.
+    void insert(data_slice point, const parsed_key& parsed);
+
+    /// Change the byte budget, evicting entries as necessary.
+    void resize(size_t maximum_bytes);
+
+    /// Remove all entries, counters are retained.
+    void clear();
+
+    /// The cache has a non-zero budget.
+    bool enabled() const;
+
+    /// The number of entries.
+    size_t size() const;
+
+    /// The maximum number of entries.
+    size_t capacity() const;
+
+    /// The number of find() calls that found an entry.
+    uint64_t hits() const;
+
+    /// The number of find() calls that did not find an entry.
+    uint64_t misses() const;
+
+    /// The number of entries evicted to make room.
+    uint64_t evictions() const;
+
+    /// The proportion of find() calls that found an entry, zero if none.
+    float hit_rate() const;
+
+private:
+    // The size precedes the serialization, so that keys of distinct sizes
+    // are distinct. Larger serializations are not cached (not valid keys).
+    typedef byte_array<ec_uncompressed_size + 1> key;
+    typedef sharded_map<key, parsed_key, salted_hash<key>> entries;
+
+    static bool to_key(key& out, data_slice point);
+
+    entries entries_;
+};
+
+} // namespace libbitcoin
+
+#endif
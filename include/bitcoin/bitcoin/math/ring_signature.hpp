@@ -24,6 +24,7 @@
 #include <bitcoin/bitcoin/math/elliptic_curve.hpp>
 #include <bitcoin/bitcoin/math/hash.hpp>
 #include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
 
 namespace libbitcoin {
 
@@ -84,6 +85,34 @@ BC_API bool sign(ring_signature& out, const secret_list& secrets,
 BC_API bool verify(const key_rings& rings, const hash_digest& digest,
     const ring_signature& signature);
 
+/**
+ * Verify a borromean ring signature, computing the rings concurrently.
+ * Each ring is sequential, so concurrency is limited to the ring count.
+ * @param[in]  rings        The rings each with N_i public keys.
+ * @param[in]  digest       The message digest to verify.
+ * @param[in]  signature    Signature.
+ * @param[in]  pool         The threadpool on which to compute rings.
+ * @return false if the verify operation fails.
+ */
+BC_API bool verify(const key_rings& rings, const hash_digest& digest,
+    const ring_signature& signature, threadpool& pool);
+
+/**
+ * Verify many borromean ring signatures over a shared set of rings.
+ * Multiples of each ring key are precomputed once for all signatures when
+ * there are enough signatures to amortize them, and each ring of each
+ * signature is computed concurrently.
+ * @param[in]  rings        The rings each with N_i public keys.
+ * @param[in]  digests      The message digest of each signature.
+ * @param[in]  signatures   The signatures, one per digest.
+ * @param[in]  pool         The threadpool on which to compute rings.
+ * @return The verification result of each signature, false for all if the
+ *         digest and signature counts differ.
+ */
+BC_API std::vector<bool> verify(const key_rings& rings,
+    const hash_list& digests, const std::vector<ring_signature>& signatures,
+    threadpool& pool);
+
 } // namespace libbitcoin
 
 #endif
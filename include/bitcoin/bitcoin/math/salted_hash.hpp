@@ -0,0 +1,50 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SALTED_HASH_HPP
+#define LIBBITCOIN_SALTED_HASH_HPP
+
+#include <cstddef>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/math/siphash.hpp>
+
+namespace libbitcoin {
+
+/// The siphash key of this process, drawn at random upon first use.
+BC_API const siphash_key& hash_salt();
+
+/// A hash functor for hash-keyed containers, the SipHash-1-3 of the key
+/// under the process salt. Unlike std::hash this precludes the construction
+/// of colliding keys by a peer. Specialized for other keys as is std::hash.
+template <typename Key>
+struct salted_hash;
+
+template <size_t Size>
+struct salted_hash<byte_array<Size>>
+{
+    size_t operator()(const byte_array<Size>& key) const
+    {
+        // Selects the word-wise overload for hash_digest.
+        return static_cast<size_t>(siphash13(hash_salt(), key));
+    }
+};
+
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,100 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SIGNATURE_BACKEND_HPP
+#define LIBBITCOIN_SIGNATURE_BACKEND_HPP
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/math/elliptic_curve.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+
+namespace libbitcoin {
+
+/**
+ * Interface to a batch signature verifier, such as a GPU or FPGA verifier.
+ * A batch of ECDSA and BIP340 Schnorr verifications is submitted, and the
+ * result of the batch is returned to a completion handler. Signature batches
+ * dispatch to the registered backend, and verify batches smaller than its
+ * minimum on the cpu. Implementations must be thread safe.
+ */
+class BC_API signature_backend
+{
+public:
+    typedef std::shared_ptr<signature_backend> ptr;
+
+    /// Invoked once, on any thread, true if all signatures are valid.
+    typedef std::function<void(bool)> result_handler;
+
+    /// An ECDSA verification of a serialized point and a normalized
+    /// (low-s) signature.
+    struct ecdsa_check
+    {
+        data_chunk point;
+        hash_digest hash;
+        ec_signature signature;
+    };
+
+    typedef std::vector<ecdsa_check> ecdsa_checks;
+    typedef std::vector<schnorr_check> schnorr_checks;
+
+    virtual ~signature_backend() {}
+
+    /// The name of the backend, for logging.
+    virtual std::string name() const = 0;
+
+    /// Batches of fewer verifications are verified on the cpu, where the
+    /// overhead of submission would exceed the gain.
+    virtual size_t minimum_batch() const = 0;
+
+    /// Submit the batch. The checks must remain valid until the handler is
+    /// invoked, which may be before this returns.
+    virtual void submit(const ecdsa_checks& ecdsa,
+        const schnorr_checks& schnorr, result_handler handler) = 0;
+};
+
+/**
+ * The default backend, verifying on the calling thread with libsecp256k1.
+ * Its minimum batch is unbounded, so signature batches verify directly on
+ * the cpu (and over a threadpool), never through this backend.
+ */
+class BC_API cpu_signature_backend
+  : public signature_backend
+{
+public:
+    std::string name() const override;
+    size_t minimum_batch() const override;
+    void submit(const ecdsa_checks& ecdsa, const schnorr_checks& schnorr,
+        result_handler handler) override;
+};
+
+/// Register the backend to which signature batches dispatch, or nullptr to
+/// restore the default cpu backend. This is thread safe.
+BC_API void set_signature_backend(signature_backend::ptr backend);
+
+/// The registered backend, or the default cpu backend. This is thread safe.
+BC_API signature_backend::ptr get_signature_backend();
+
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,99 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SIGNATURE_BATCH_HPP
+#define LIBBITCOIN_SIGNATURE_BATCH_HPP
+
+#include <cstddef>
+#include <map>
+#include <vector>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/math/elliptic_curve.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/math/signature_backend.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
+
+namespace libbitcoin {
+
+/**
+ * A collector of ECDSA verifications (point, hash, signature) that are
+ * verified together. Each distinct point is parsed once per batch and each
+ * signature is normalized once, on addition. BIP340 Schnorr verifications
+ * are collected alongside and verified by verify_schnorr in batches, split
+ * into chunks over the threadpool. Addition is not thread safe, verification
+ * is const and may proceed concurrently on a threadpool. A batch of at least
+ * the minimum of the registered signature backend is verified by it.
+ */
+class BC_API signature_batch
+{
+public:
+    signature_batch();
+
+    /// Queue a verification, false if the point is invalid (batch fails).
+    bool add(data_slice point, const hash_digest& hash,
+        const ec_signature& signature);
+
+    /// Queue a BIP340 Schnorr verification, parsed on verification.
+    void add_schnorr(const ec_xonly& point, const hash_digest& message,
+        const schnorr_signature& signature);
+
+    /// The number of queued verifications.
+    size_t size() const;
+
+    /// There are no queued verifications.
+    bool empty() const;
+
+    /// Clear all queued verifications and parsed points.
+    void clear();
+
+    /// True if all points parsed and all signatures are valid.
+    bool verify() const;
+
+    /// As verify(), verifying concurrently on the pool and calling thread.
+    bool verify(threadpool& pool) const;
+
+private:
+    struct verifier;
+
+    // Opaque copy of the parsed secp256k1 point, to avoid external types.
+    typedef byte_array<64> parsed_point;
+
+    struct check
+    {
+        size_t point;
+        hash_digest hash;
+        ec_signature signature;
+    };
+
+    bool verify(size_t index) const;
+    bool verify(signature_backend& backend) const;
+    bool verify_schnorr(size_t chunk, size_t chunks) const;
+    size_t schnorr_chunks(size_t threads) const;
+
+    bool valid_;
+    std::vector<check> checks_;
+    std::vector<schnorr_check> schnorr_checks_;
+    std::vector<parsed_point> points_;
+    std::vector<const data_chunk*> keys_;
+    std::map<data_chunk, size_t> indexes_;
+};
+
+} // namespace libbitcoin
+
+#endif
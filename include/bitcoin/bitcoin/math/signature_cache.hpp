@@ -0,0 +1,123 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SIGNATURE_CACHE_HPP
+#define LIBBITCOIN_SIGNATURE_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/math/cache_snapshot.hpp>
+#include <bitcoin/bitcoin/math/elliptic_curve.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/asio.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+#include <bitcoin/bitcoin/utility/sharded_map.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
+
+namespace libbitcoin {
+
+/**
+ * A bounded set of successful ECDSA verifications (sighash, point,
+ * signature), keyed by a salted hash of the triple. Entries are partitioned
+ * over independently-locked shards (see sharded_map). When full an entry is
+ * evicted for each insertion. A zero byte budget disables the cache. This
+ * class is thread safe.
+ */
+class BC_API signature_cache
+  : noncopyable
+{
+public:
+    typedef cache_snapshot::path path;
+
+    /// The approximate memory cost of one entry, including container overhead.
+    static const size_t entry_size;
+
+    /// Construct a cache limited to the given number of bytes.
+    signature_cache(size_t maximum_bytes=0);
+
+    /// True if the verification has been recorded.
+    bool contains(const hash_digest& sighash, data_slice point,
+        const ec_signature& signature) const;
+
+    /// Record a successful verification.
+    void insert(const hash_digest& sighash, data_slice point,
+        const ec_signature& signature);
+
+    /// Change the byte budget, evicting entries as necessary.
+    void resize(size_t maximum_bytes);
+
+    /// Derive the salt from a persistent secret, clearing the cache, so that
+    /// entries may be stored and loaded across restarts. Call before use.
+    void set_secret(const hash_digest& secret);
+
+    /// Write the entries to a snapshot, false if the salt is not derived from
+    /// a secret or the file cannot be written.
+    bool store(const path& file) const;
+
+    /// Load the entries of a snapshot stored under the same secret, in
+    /// parallel on the pool, until full or the timeout expires. Return the
+    /// number loaded, zero if the file is not a snapshot under the secret.
+    size_t load(const path& file, threadpool& pool,
+        const asio::duration& timeout);
+
+    /// Remove all entries, counters are retained.
+    void clear();
+
+    /// The cache has a non-zero budget.
+    bool enabled() const;
+
+    /// The number of entries.
+    size_t size() const;
+
+    /// The maximum number of entries.
+    size_t capacity() const;
+
+    /// The number of contains() calls that found an entry.
+    uint64_t hits() const;
+
+    /// The number of contains() calls that did not find an entry.
+    uint64_t misses() const;
+
+    /// The number of entries evicted to make room.
+    uint64_t evictions() const;
+
+    /// The proportion of contains() calls that found an entry, zero if none.
+    float hit_rate() const;
+
+private:
+    // The key is a uniformly-distributed digest, so it is its own hash.
+    struct key_hasher
+    {
+        size_t operator()(const hash_digest& key) const;
+    };
+
+    typedef sharded_map<hash_digest, bool, key_hasher> entries;
+
+    hash_digest to_key(const hash_digest& sighash, data_slice point,
+        const ec_signature& signature) const;
+
+    hash_digest salt_;
+    bool persistent_;
+    entries entries_;
+};
+
+} // namespace libbitcoin
+
+#endif
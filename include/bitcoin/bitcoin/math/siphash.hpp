@@ -0,0 +1,67 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SIPHASH_HPP
+#define LIBBITCOIN_SIPHASH_HPP
+
+#include <cstdint>
+#include <vector>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+
+namespace libbitcoin {
+
+/// The pair of 64 bit words (k0, k1) that key a siphash.
+struct siphash_key
+{
+    uint64_t first;
+    uint64_t second;
+};
+
+/// Generate a SipHash-2-4 value of the message.
+BC_API uint64_t siphash(const siphash_key& key, data_slice message);
+
+/// Generate a SipHash-2-4 value of the hash, without buffering.
+/// This is equivalent to siphash(key, data_slice(hash)).
+BC_API uint64_t siphash(const siphash_key& key, const hash_digest& hash);
+
+/// Generate the SipHash-2-4 value of each hash, in order. Hashes are
+/// computed four at a time in interleaved lanes, which the compiler may
+/// vectorize, and otherwise overlap in the pipeline.
+BC_API std::vector<uint64_t> siphash(const siphash_key& key,
+    const hash_list& hashes);
+
+/// Generate a SipHash-1-3 value of the message, for hash table keys.
+BC_API uint64_t siphash13(const siphash_key& key, data_slice message);
+
+/// Generate a SipHash-1-3 value of the hash, without buffering.
+/// This is equivalent to siphash13(key, data_slice(hash)).
+BC_API uint64_t siphash13(const siphash_key& key, const hash_digest& hash);
+
+/// Generate a SipHash-1-3 value of the hash followed by the little-endian
+/// index (a point), without buffering.
+BC_API uint64_t siphash13(const siphash_key& key, const hash_digest& hash,
+    uint32_t index);
+
+/// The key formed from the first two little-endian words of the hash.
+BC_API siphash_key to_siphash_key(const hash_digest& hash);
+
+} // namespace libbitcoin
+
+#endif
@@ -16,15 +16,96 @@
  * You should have received a copy of the GNU Affero General Public License
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
-#ifndef LIBBBITCOIN_UINT256_HPP
-#define LIBBBITCOIN_UINT256_HPP
+#ifndef LIBBITCOIN_UINT256_HPP
+#define LIBBITCOIN_UINT256_HPP
 
-#include <boost/multiprecision/cpp_int.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <bitcoin/bitcoin/compat.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
 
 namespace libbitcoin {
 
+/// A fixed width 256 bit unsigned integer of four little-endian 64 bit words.
+/// Arithmetic is modulo 2^256 and division by zero throws overflow_error.
+class uint256_t
+{
+public:
+    static BC_CONSTEXPR size_t word_count = 4;
 
+    /// Constructors.
+    BC_CONSTCTOR uint256_t();
+    BC_CONSTCTOR uint256_t(uint64_t value);
+    BC_CONSTCTOR uint256_t(uint64_t word0, uint64_t word1, uint64_t word2,
+        uint64_t word3);
+
+    /// The hash is interpreted as a little-endian value.
+    explicit uint256_t(const hash_digest& hash);
+
+    /// Properties.
+    hash_digest hash() const;
+    size_t bit_length() const;
+    size_t byte_length() const;
+
+    /// The word at the index, least significant first (index must be < 4).
+    BC_CONSTFUNC uint64_t operator[](size_t index) const;
+
+    /// The least significant word, higher words are truncated.
+    BC_CONSTFUNC explicit operator uint64_t() const;
+
+    /// Operators.
+    BC_CONSTFUNC uint256_t operator~() const;
+    uint256_t operator-() const;
+    uint256_t operator>>(uint32_t shift) const;
+    uint256_t operator<<(uint32_t shift) const;
+
+    uint256_t& operator++();
+    uint256_t& operator>>=(uint32_t shift);
+    uint256_t& operator<<=(uint32_t shift);
+    uint256_t& operator+=(const uint256_t& value);
+    uint256_t& operator-=(const uint256_t& value);
+    uint256_t& operator*=(uint32_t value);
+    uint256_t& operator*=(const uint256_t& value);
+    uint256_t& operator/=(uint32_t value);
+    uint256_t& operator/=(const uint256_t& value);
+
+private:
+    typedef uint32_t digits[2 * word_count];
+
+    static size_t leading_zeros(uint64_t value);
+    static uint64_t multiply(uint64_t left, uint64_t right, uint64_t& high);
+
+    uint32_t divide(uint32_t divisor);
+    void to_digits(digits& out) const;
+    void from_digits(const digits& value);
+
+    uint64_t words_[word_count];
+
+    friend std::ostream& operator<<(std::ostream& output,
+        const uint256_t& value);
+};
+
+BC_CONSTFUNC bool operator==(const uint256_t& left, const uint256_t& right);
+BC_CONSTFUNC bool operator!=(const uint256_t& left, const uint256_t& right);
+BC_CONSTFUNC bool operator<(const uint256_t& left, const uint256_t& right);
+BC_CONSTFUNC bool operator>(const uint256_t& left, const uint256_t& right);
+BC_CONSTFUNC bool operator<=(const uint256_t& left, const uint256_t& right);
+BC_CONSTFUNC bool operator>=(const uint256_t& left, const uint256_t& right);
+
+uint256_t operator+(uint256_t left, const uint256_t& right);
+uint256_t operator-(uint256_t left, const uint256_t& right);
+uint256_t operator*(uint256_t left, const uint256_t& right);
+uint256_t operator/(uint256_t left, const uint256_t& right);
+
+/// Write the value to the stream in decimal notation.
+std::ostream& operator<<(std::ostream& output, const uint256_t& value);
+
+/// Interpret the hash as a little-endian 256 bit value.
+uint256_t to_uint256(const hash_digest& hash);
 
 } // namespace libbitcoin
 
+#include <bitcoin/bitcoin/impl/math/uint256.ipp>
+
 #endif
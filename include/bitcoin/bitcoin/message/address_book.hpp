@@ -0,0 +1,95 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_MESSAGE_ADDRESS_BOOK_HPP
+#define LIBBITCOIN_MESSAGE_ADDRESS_BOOK_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/math/siphash.hpp>
+#include <bitcoin/bitcoin/message/address.hpp>
+#include <bitcoin/bitcoin/message/network_address.hpp>
+
+namespace libbitcoin {
+namespace message {
+
+/**
+ * This class is not thread safe.
+ * A fixed capacity table of relayed addresses, in buckets of slots. The
+ * bucket of an address is determined by its network group (the /16 of an
+ * ipv4 address or the /32 of an ipv6 address) and its slot within the
+ * bucket by the address and port, each by SipHash-1-3 under a random key of
+ * the book. So each address has one slot, and a peer relaying addresses of
+ * one network group can fill only one bucket. An address is replaced only
+ * by one with a more recent timestamp. Slots are allocated once.
+ */
+class BC_API address_book
+{
+public:
+    static BC_CONSTEXPR size_t default_buckets = 1024;
+    static BC_CONSTEXPR size_t default_bucket_size = 64;
+
+    address_book(size_t buckets=default_buckets,
+        size_t bucket_size=default_bucket_size);
+
+    /// Store the address, true if added or replacing another address.
+    /// An address with port zero is not stored. A stored address is updated
+    /// to the more recent timestamp and services, and is not counted.
+    bool insert(const network_address& address);
+
+    /// Store each address of the message, returning the number added.
+    size_t insert(const address& message);
+
+    /// The stored address of the ip and port, nullptr if not stored.
+    const network_address* find(const ip_address& ip, uint16_t port) const;
+
+    bool contains(const ip_address& ip, uint16_t port) const;
+
+    /// Remove the address, false if not stored.
+    bool erase(const ip_address& ip, uint16_t port);
+
+    /// Populate a stored address chosen at random, false if empty.
+    bool sample(network_address& out_address) const;
+
+    /// Remove all addresses, drawing a new key.
+    void clear();
+
+    /// The number of stored addresses.
+    size_t size() const;
+    bool empty() const;
+
+    /// The number of slots.
+    size_t capacity() const;
+
+private:
+    size_t to_slot(const ip_address& ip, uint16_t port) const;
+    static bool is_empty(const network_address& address);
+
+    const size_t buckets_;
+    const size_t bucket_size_;
+    std::vector<network_address> slots_;
+    siphash_key key_;
+    size_t size_;
+};
+
+} // namespace message
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,97 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_MESSAGE_BLOOM_FILTER_HPP
+#define LIBBITCOIN_MESSAGE_BLOOM_FILTER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <bitcoin/bitcoin/chain/block.hpp>
+#include <bitcoin/bitcoin/chain/point.hpp>
+#include <bitcoin/bitcoin/chain/script.hpp>
+#include <bitcoin/bitcoin/chain/transaction.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/message/filter_add.hpp>
+#include <bitcoin/bitcoin/message/filter_load.hpp>
+#include <bitcoin/bitcoin/message/merkle_block.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+
+namespace libbitcoin {
+namespace message {
+
+/**
+ * This class is not thread safe.
+ * A bip37 bloom filter, as loaded by a peer, for matching transactions.
+ * Each element is hashed by all of the hash functions in one pass.
+ */
+class BC_API bloom_filter
+{
+public:
+    /// The filter_load flags that determine outputs inserted on match.
+    enum update: uint8_t
+    {
+        none = 0,
+        all = 1,
+        pay_public_key_only = 2,
+        mask = 3
+    };
+
+    bloom_filter(const filter_load& load);
+    bloom_filter(data_chunk&& filter, uint32_t hash_functions,
+        uint32_t tweak, uint8_t flags);
+
+    /// The filter is within bip37 size and hash function limits.
+    bool is_valid() const;
+
+    /// The filter bits, as they would be loaded.
+    const data_chunk& filter() const;
+
+    bool contains(data_slice element) const;
+    bool contains(const chain::point& point) const;
+
+    void insert(data_slice element);
+    void insert(const chain::point& point);
+
+    /// Insert the element of a filter_add message.
+    void add(const filter_add& add);
+
+    /// Match the transaction by bip37 rules, inserting the points of matched
+    /// outputs as the update flags require (so that spends also match).
+    bool match(const chain::transaction& tx);
+
+    /// Match each transaction of the block in order and build the merkle
+    /// block of the matches.
+    merkle_block to_merkle_block(const chain::block& block);
+
+private:
+    typedef std::vector<uint32_t> seeds;
+
+    static seeds to_seeds(uint32_t hash_functions, uint32_t tweak);
+
+    bool is_updated(const chain::script& script) const;
+
+    data_chunk filter_;
+    const seeds seeds_;
+    const uint8_t flags_;
+};
+
+} // namespace message
+} // namespace libbitcoin
+
+#endif
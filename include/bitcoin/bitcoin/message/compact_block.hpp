@@ -22,6 +22,7 @@
 #include <istream>
 #include <bitcoin/bitcoin/define.hpp>
 #include <bitcoin/bitcoin/chain/header.hpp>
+#include <bitcoin/bitcoin/math/siphash.hpp>
 #include <bitcoin/bitcoin/message/prefilled_transaction.hpp>
 #include <bitcoin/bitcoin/utility/data.hpp>
 #include <bitcoin/bitcoin/utility/reader.hpp>
@@ -43,6 +44,12 @@ public:
     static compact_block factory(uint32_t version, std::istream& stream);
     static compact_block factory(uint32_t version, reader& source);
 
+    /// The bip152 short id key, of the sha256 of the header and nonce.
+    static siphash_key to_key(const chain::header& header, uint64_t nonce);
+
+    /// The bip152 short id of a siphash value (its low 48 bits).
+    static short_id to_short_id(uint64_t value);
+
     compact_block();
     compact_block(const chain::header& header, uint64_t nonce,
         const short_id_list& short_ids,
@@ -0,0 +1,68 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_MESSAGE_COMPACT_BLOCK_BUILDER_HPP
+#define LIBBITCOIN_MESSAGE_COMPACT_BLOCK_BUILDER_HPP
+
+#include <cstdint>
+#include <memory>
+#include <bitcoin/bitcoin/chain/block.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/message/compact_block.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+
+namespace libbitcoin {
+namespace message {
+
+/**
+ * The bip152 compact block of a block, built and serialized once to be sent
+ * to each high bandwidth peer. The nonce is of the block rather than of the
+ * peer, so the short ids and their encoding are the same for all. Short ids
+ * are computed in one batch and the coinbase is prefilled. The message and
+ * its encoding are immutable, so they may be shared between threads.
+ */
+class BC_API compact_block_builder
+{
+public:
+    typedef std::shared_ptr<const data_chunk> payload_ptr;
+
+    /// Witness selects bip152 version 2 short ids (witness hashes).
+    compact_block_builder(const chain::block& block, bool witness,
+        uint64_t nonce);
+
+    /// Use a random nonce.
+    compact_block_builder(const chain::block& block, bool witness);
+
+    /// The compact block message.
+    compact_block::const_ptr message() const;
+
+    /// The serialized message (without the message header).
+    payload_ptr payload() const;
+
+private:
+    static compact_block build(const chain::block& block, bool witness,
+        uint64_t nonce);
+
+    compact_block::const_ptr message_;
+    payload_ptr payload_;
+};
+
+} // namespace message
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,110 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_MESSAGE_COMPACT_RECONSTRUCTOR_HPP
+#define LIBBITCOIN_MESSAGE_COMPACT_RECONSTRUCTOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include <bitcoin/bitcoin/chain/block.hpp>
+#include <bitcoin/bitcoin/chain/header.hpp>
+#include <bitcoin/bitcoin/chain/transaction.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/math/siphash.hpp>
+#include <bitcoin/bitcoin/message/block_transactions.hpp>
+#include <bitcoin/bitcoin/message/compact_block.hpp>
+#include <bitcoin/bitcoin/message/get_block_transactions.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+
+namespace libbitcoin {
+namespace message {
+
+/**
+ * This class is not thread safe.
+ * Reconstruct a block from a bip152 compact block and the transaction pool.
+ * Pool transactions are referenced when matched and copied only once, into
+ * the assembled block, so each must remain valid until assemble returns.
+ * The copy shares the inputs and outputs of the pooled transaction.
+ * Message indexes are differentially encoded, as on the wire.
+ */
+class BC_API compact_reconstructor
+  : noncopyable
+{
+public:
+    typedef compact_block::short_id short_id;
+
+    /// Witness selects bip152 version 2 short ids (witness hashes).
+    compact_reconstructor(const compact_block& block, bool witness);
+
+    /// Index the compact block, required before any other call.
+    /// Returns bad_stream on invalid prefilled indexes, or operation_failed if
+    /// short ids collide within the block (the full block is required).
+    code initialize();
+
+    /// The bip152 short id of the transaction hash (txid or wtxid).
+    short_id to_short_id(const hash_digest& hash) const;
+
+    /// Match a pool transaction, true if it fills an empty slot.
+    /// Two distinct pool transactions with the same short id leave the slot
+    /// empty, so that it is requested from the peer.
+    bool match(const chain::transaction& tx);
+
+    /// The number of slots not yet filled.
+    size_t missing() const;
+
+    /// The request for the slots not yet filled.
+    get_block_transactions request() const;
+
+    /// Fill the requested slots from the peer response, in request order.
+    /// Returns bad_stream if the response does not match the request.
+    code fill(block_transactions&& response);
+
+    /// Assemble the block, once all slots are filled.
+    /// Returns merkle_mismatch if the block does not match its header, which
+    /// implies a short id collision with the pool (the full block is required).
+    code assemble(chain::block& out);
+
+private:
+    struct slot
+    {
+        const chain::transaction* pool;
+        chain::transaction* owned;
+        bool collided;
+    };
+
+    static uint64_t to_key(const short_id& id);
+
+    const bool witness_;
+    const chain::header header_;
+    const siphash_key key_;
+    const compact_block::short_id_list short_ids_;
+    std::vector<uint64_t> prefilled_;
+    chain::transaction::list owned_;
+    std::vector<slot> slots_;
+    std::unordered_map<uint64_t, size_t> positions_;
+    size_t missing_;
+};
+
+} // namespace message
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,110 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_MESSAGE_ENCODED_HPP
+#define LIBBITCOIN_MESSAGE_ENCODED_HPP
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/message/messages.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+#include <bitcoin/bitcoin/utility/thread.hpp>
+
+namespace libbitcoin {
+namespace message {
+
+/// An immutable wire encoding of a message, heading included.
+/// Shared (by const_ptr) across channels of the same version and magic, so
+/// a relayed message is serialized and checksummed once.
+class BC_API encoded
+{
+public:
+    typedef std::shared_ptr<const encoded> const_ptr;
+
+    template <typename Message>
+    static const_ptr create(uint32_t version, const Message& packet,
+        uint32_t magic)
+    {
+        data_chunk data;
+        serialize(version, packet, magic, data);
+        return std::make_shared<const encoded>(version, magic,
+            Message::command, std::move(data));
+    }
+
+    encoded(uint32_t version, uint32_t magic, const std::string& command,
+        data_chunk&& data);
+
+    /// The protocol version and network magic of the encoding.
+    uint32_t version() const;
+    uint32_t magic() const;
+    const std::string& command() const;
+
+    /// The full message, heading followed by payload.
+    const data_chunk& data() const;
+
+    /// The payload, excluding the heading.
+    data_slice payload() const;
+
+private:
+    const uint32_t version_;
+    const uint32_t magic_;
+    const std::string command_;
+    const data_chunk data_;
+};
+
+/**
+ * This class is thread safe.
+ * Serialize-once store of the encodings of a single message, one per
+ * distinct version and magic, for relay of the message to many peers.
+ */
+class BC_API encoding_cache
+  : noncopyable
+{
+public:
+    encoding_cache();
+
+    /// Get the encoding for the version and magic, creating it once.
+    template <typename Message>
+    encoded::const_ptr get(uint32_t version, const Message& packet,
+        uint32_t magic)
+    {
+        const auto cached = find(version, magic);
+        return cached ? cached :
+            store(encoded::create(version, packet, magic));
+    }
+
+    /// The number of distinct encodings.
+    size_t size() const;
+
+private:
+    encoded::const_ptr find(uint32_t version, uint32_t magic) const;
+    encoded::const_ptr store(encoded::const_ptr encoding);
+
+    // These are protected by mutex.
+    std::vector<encoded::const_ptr> encodings_;
+    mutable upgrade_mutex mutex_;
+};
+
+} // namespace message
+} // namespace libbitcoin
+
+#endif
@@ -24,6 +24,7 @@
 #include <memory>
 #include <string>
 #include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
 #include <bitcoin/bitcoin/utility/reader.hpp>
 #include <bitcoin/bitcoin/utility/writer.hpp>
 
@@ -41,6 +42,11 @@ public:
     static fee_filter factory(uint32_t version, reader& source);
     static size_t satoshi_fixed_size(uint32_t version);
 
+    /// The serialized size is fixed, allowing serialization to an array.
+    /// The array codec does not check the protocol version.
+    static BC_CONSTEXPR size_t wire_size = 8;
+    typedef byte_array<wire_size> wire_data;
+
     fee_filter();
     fee_filter(uint64_t minimum);
     fee_filter(const fee_filter& other);
@@ -52,9 +58,11 @@ public:
     bool from_data(uint32_t version, const data_chunk& data);
     bool from_data(uint32_t version, std::istream& stream);
     bool from_data(uint32_t version, reader& source);
+    bool from_wire_data(const wire_data& data);
     data_chunk to_data(uint32_t version) const;
     void to_data(uint32_t version, std::ostream& stream) const;
     void to_data(uint32_t version, writer& sink) const;
+    wire_data to_wire_data() const;
     bool is_valid() const;
     void reset();
     size_t serialized_size(uint32_t version) const;
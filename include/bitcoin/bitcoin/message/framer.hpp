@@ -0,0 +1,91 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_MESSAGE_FRAMER_HPP
+#define LIBBITCOIN_MESSAGE_FRAMER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/message/heading.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+
+namespace libbitcoin {
+namespace message {
+
+/**
+ * This class is not thread safe.
+ * A resumable framer of the wire protocol, fed arbitrary chunks of a stream.
+ * The heading is validated (magic and size limit) as soon as it is complete
+ * and the payload is hashed as it arrives, so the checksum is validated
+ * without a second pass over the payload.
+ */
+class BC_API framer
+  : noncopyable
+{
+public:
+    /// The payload is valid only for the duration of the handler. It refers
+    /// into the written chunk (zero copy) when wholly contained by it.
+    typedef std::function<void(const heading& head, data_slice payload)>
+        handler;
+
+    /**
+     * Construct a framer.
+     * @param[in]  magic    The required heading magic.
+     * @param[in]  version  The protocol version, for the payload size limit.
+     * @param[in]  witness  Allow payloads up to the witness size limit.
+     */
+    framer(uint32_t magic, uint32_t version, bool witness);
+
+    /**
+     * Consume a chunk, invoking the handler for each complete message.
+     * Returns bad_stream on invalid magic, size or checksum, after which all
+     * writes fail until reset.
+     */
+    code write(data_slice chunk, handler handle);
+
+    /// Discard the partial message and any failure.
+    void reset();
+
+    /// The number of bytes required to complete the heading or payload.
+    size_t needed() const;
+
+private:
+    bool read_heading();
+    bool read_payload(data_slice payload, handler& handle);
+
+    const uint32_t magic_;
+    const size_t maximum_payload_;
+
+    bool failed_;
+    bool payload_expected_;
+    size_t heading_size_;
+    data_chunk heading_data_;
+    heading heading_;
+    data_chunk payload_;
+    sha256_context hasher_;
+};
+
+} // namespace message
+} // namespace libbitcoin
+
+#endif
@@ -19,18 +19,21 @@
 #ifndef LIBBITCOIN_MESSAGE_HEADERS_HPP
 #define LIBBITCOIN_MESSAGE_HEADERS_HPP
 
+#include <cstddef>
 #include <cstdint>
 #include <initializer_list>
 #include <istream>
 #include <memory>
 #include <string>
 #include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/error.hpp>
 #include <bitcoin/bitcoin/math/hash.hpp>
 #include <bitcoin/bitcoin/message/header.hpp>
 #include <bitcoin/bitcoin/message/inventory.hpp>
 #include <bitcoin/bitcoin/message/inventory_vector.hpp>
 #include <bitcoin/bitcoin/utility/data.hpp>
 #include <bitcoin/bitcoin/utility/reader.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
 #include <bitcoin/bitcoin/utility/writer.hpp>
 
 namespace libbitcoin {
@@ -59,10 +62,34 @@ public:
     void set_elements(header::list&& values);
 
     bool is_sequential() const;
+
+    /// Check each header and its link to the hash of its predecessor.
+    /// Uncached header hashes are computed in one batch and then cached.
+    /// On failure out_index is set to the index of the first failed header.
+    code check_all(size_t& out_index, uint32_t timestamp_limit_seconds,
+        uint32_t proof_of_work_limit, bool scrypt=false) const;
+
+    /// As above, with header checks distributed over the threadpool.
+    code check_all(size_t& out_index, uint32_t timestamp_limit_seconds,
+        uint32_t proof_of_work_limit, threadpool& pool,
+        bool scrypt=false) const;
+
     void to_hashes(hash_list& out) const;
     void to_inventory(inventory_vector::list& out,
         inventory::type_id type) const;
 
+    /// Serialize a headers message (heading and payload) to out from count
+    /// serialized headers, each at stride bytes from its predecessor, such
+    /// as the records of a header_file. Headers are copied and hashed in one
+    /// pass, without construction of header objects. The buffer is resized
+    /// to the message, as by message::serialize.
+    static void serialize(const uint8_t* headers, size_t count,
+        size_t stride, uint32_t magic, data_chunk& out);
+
+    /// As above, for contiguous serialized headers (80 bytes each).
+    static void serialize(data_slice headers, uint32_t magic,
+        data_chunk& out);
+
     bool from_data(uint32_t version, const data_chunk& data);
     bool from_data(uint32_t version, std::istream& stream);
     bool from_data(uint32_t version, reader& source);
@@ -85,6 +112,9 @@ public:
     static const uint32_t version_maximum;
 
 private:
+    void hash_all() const;
+    size_t first_unlinked() const;
+
     header::list elements_;
 };
 
@@ -58,6 +58,10 @@ public:
     static inventory_vector factory(uint32_t version, reader& source);
     static size_t satoshi_fixed_size(uint32_t version);
 
+    /// The serialized size is fixed, allowing serialization to an array.
+    static BC_CONSTEXPR size_t wire_size = sizeof(uint32_t) + hash_size;
+    typedef byte_array<wire_size> wire_data;
+
     inventory_vector();
     inventory_vector(type_id type, const hash_digest& hash);
     inventory_vector(type_id type, hash_digest&& hash);
@@ -78,9 +82,11 @@ public:
     bool from_data(uint32_t version, const data_chunk& data);
     bool from_data(uint32_t version, std::istream& stream);
     bool from_data(uint32_t version, reader& source);
+    bool from_wire_data(const wire_data& data);
     data_chunk to_data(uint32_t version) const;
     void to_data(uint32_t version, std::ostream& stream) const;
     void to_data(uint32_t version, writer& sink) const;
+    wire_data to_wire_data() const;
     bool is_valid() const;
     void reset();
     void to_witness();
@@ -22,6 +22,7 @@
 #include <istream>
 #include <memory>
 #include <string>
+#include <vector>
 #include <bitcoin/bitcoin/define.hpp>
 #include <bitcoin/bitcoin/chain/block.hpp>
 #include <bitcoin/bitcoin/chain/header.hpp>
@@ -49,6 +50,11 @@ public:
     merkle_block(chain::header&& header, size_t total_transactions,
         hash_list&& hashes, data_chunk&& flags);
     merkle_block(const chain::block& block);
+
+    /// The bip37 partial merkle tree of the matched transactions, where
+    /// matches are in block order. Tree levels are hashed in batches from
+    /// the (cached) transaction hashes, and each node is hashed once.
+    merkle_block(const chain::block& block, const std::vector<bool>& matches);
     merkle_block(const merkle_block& other);
     merkle_block(merkle_block&& other);
 
@@ -92,6 +98,14 @@ public:
     static const uint32_t version_maximum;
 
 private:
+    typedef std::vector<hash_list> hash_tree;
+    typedef std::vector<std::vector<bool>> match_tree;
+    typedef std::vector<bool> bit_list;
+
+    static void traverse(const hash_tree& hashes, const match_tree& matches,
+        size_t height, size_t position, hash_list& out_hashes,
+        bit_list& out_bits);
+
     chain::header header_;
     size_t total_transactions_;
     hash_list hashes_;
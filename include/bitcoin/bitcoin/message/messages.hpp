@@ -51,11 +51,15 @@
 #include <bitcoin/bitcoin/message/reject.hpp>
 #include <bitcoin/bitcoin/message/send_compact.hpp>
 #include <bitcoin/bitcoin/message/send_headers.hpp>
+#include <bitcoin/bitcoin/message/statistics.hpp>
 #include <bitcoin/bitcoin/message/transaction.hpp>
 #include <bitcoin/bitcoin/message/verack.hpp>
 #include <bitcoin/bitcoin/message/version.hpp>
+#include <bitcoin/bitcoin/utility/asio.hpp>
+#include <bitcoin/bitcoin/utility/assert.hpp>
 #include <bitcoin/bitcoin/utility/container_sink.hpp>
 #include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/serializer.hpp>
 
 // Minimum current libbitcoin protocol version:     31402
 // Minimum current satoshi client protocol version: 31800
@@ -148,46 +152,55 @@ DECLARE_MESSAGE_POINTER_LIST_POINTER_TYPES(transaction);
 namespace message {
 
 /// Serialize a message object to the Bitcoin wire protocol encoding.
+/// The buffer is resized to the message, so a reused (pooled) buffer does not
+/// reallocate once its capacity suffices. Writes are direct, not streamed.
+/// The serialization is recorded when message statistics are enabled.
 template <typename Message>
-data_chunk serialize(uint32_t version, const Message& packet,
-    uint32_t magic)
+void serialize(uint32_t version, const Message& packet, uint32_t magic,
+    data_chunk& out)
 {
+    const auto recorded = statistics::enabled();
+    const auto start = recorded ? asio::steady_clock::now() :
+        asio::time_point();
+
     const auto heading_size = heading::satoshi_fixed_size();
     const auto payload_size = packet.serialized_size(version);
     const auto message_size = heading_size + payload_size;
 
-    // Unfortunately data_sink doesn't support seek, so this is a little ugly.
-    // The header requires payload size and checksum but prepends the payload.
-    // Use a stream to prevent unnecessary copying of the payload.
-    data_chunk data;
-
-    // Reserve memory for the full message.
-    data.reserve(message_size);
-
-    // Size the vector for the heading so that payload insertion will follow.
-    data.resize(heading_size);
-
-    // Insert the payload after the heading and into the reservation.
-    data_sink ostream(data);
-    packet.to_data(version, ostream);
-    ostream.flush();
-    BITCOIN_ASSERT(data.size() == message_size);
+    // The heading requires payload size and checksum but prepends the
+    // payload, so write the payload after space reserved for the heading.
+    out.resize(message_size);
+    auto payload = make_unsafe_serializer(out.data() + heading_size);
+    packet.to_data(version, payload);
+    BITCOIN_ASSERT(payload);
 
     // Create the payload checksum without copying the buffer.
-    data_slice slice(data.data() + heading_size, data.data() + message_size);
+    const data_slice slice(out.data() + heading_size, out.data() + message_size);
     const auto check = bitcoin_checksum(slice);
     const auto payload_size32 = safe_unsigned<uint32_t>(payload_size);
 
-    // Create and serialize the heading to a temporary variable (12 bytes).
-    heading head(magic, Message::command, payload_size32, check);
-    auto heading = head.to_data();
+    // Write the heading into the beginning of the message buffer.
+    const heading head(magic, Message::command, payload_size32, check);
+    auto prefix = make_unsafe_serializer(out.data());
+    head.to_data(prefix);
 
-    // Move the heading into the allocated beginning of the message buffer.
-    std::move(heading.begin(), heading.end(), data.begin());
+    if (recorded)
+        statistics::record(statistics::type<Message>(),
+            statistics::operation::serialize, payload_size, start);
+}
+
+/// Serialize a message object to the Bitcoin wire protocol encoding.
+template <typename Message>
+data_chunk serialize(uint32_t version, const Message& packet,
+    uint32_t magic)
+{
+    data_chunk data;
+    serialize(version, packet, magic, data);
     return data;
 }
 
 BC_API size_t variable_uint_size(uint64_t value);
+BC_API size_t variable_base128_size(uint64_t value);
 
 } // namespace message
 } // namespace libbitcoin
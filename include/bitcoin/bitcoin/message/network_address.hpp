@@ -45,6 +45,11 @@ public:
         bool with_timestamp);
     static size_t satoshi_fixed_size(uint32_t version, bool with_timestamp);
 
+    /// The timestamped (address relay) serialized size is fixed, allowing
+    /// serialization to an array.
+    static BC_CONSTEXPR size_t wire_size = 30;
+    typedef byte_array<wire_size> wire_data;
+
     network_address();
 
     // BC_CONSTCTOR required for declaration of constexpr address types.
@@ -80,10 +85,12 @@ public:
     bool from_data(uint32_t version, std::istream& stream,
         bool with_timestamp);
     bool from_data(uint32_t version, reader& source, bool with_timestamp);
+    bool from_wire_data(const wire_data& data);
     data_chunk to_data(uint32_t version, bool with_timestamp) const;
     void to_data(uint32_t version, std::ostream& stream,
         bool with_timestamp) const;
     void to_data(uint32_t version, writer& sink, bool with_timestamp) const;
+    wire_data to_wire_data() const;
     bool is_valid() const;
     void reset();
     size_t serialized_size(uint32_t version, bool with_timestamp) const;
@@ -42,6 +42,11 @@ public:
     static ping factory(uint32_t version, reader& source);
     static size_t satoshi_fixed_size(uint32_t version);
 
+    /// The serialized size is fixed at bip31 and above, allowing
+    /// serialization to an array.
+    static BC_CONSTEXPR size_t wire_size = 8;
+    typedef byte_array<wire_size> wire_data;
+
     ping();
     ping(uint64_t nonce);
     ping(const ping& other);
@@ -52,10 +57,12 @@ public:
     bool from_data(uint32_t version, const data_chunk& data);
     bool from_data(uint32_t version, std::istream& stream);
     bool from_data(uint32_t version, reader& source);
+    bool from_wire_data(const wire_data& data);
 
     data_chunk to_data(uint32_t version) const;
     void to_data(uint32_t version, std::ostream& stream) const;
     void to_data(uint32_t version, writer& sink) const;
+    wire_data to_wire_data() const;
     bool is_valid() const;
     void reset();
     size_t serialized_size(uint32_t version) const;
@@ -0,0 +1,82 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_MESSAGE_RAW_MESSAGE_HPP
+#define LIBBITCOIN_MESSAGE_RAW_MESSAGE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/utility/asio.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+
+namespace libbitcoin {
+namespace message {
+
+/**
+ * This class is thread safe.
+ * A message over an existing serialized payload, such as a block sliced from
+ * a memory-mapped block file. Only the heading is written, the payload is
+ * neither copied nor deserialized, and it is not hashed when the checksum is
+ * provided. The payload must remain valid for the life of the message, which
+ * may be ensured by sharing ownership of its storage with the message.
+ */
+class BC_API raw_message
+{
+public:
+    typedef std::shared_ptr<const raw_message> const_ptr;
+    typedef std::shared_ptr<const void> storage_ptr;
+    typedef std::array<boost::asio::const_buffer, 2> buffers;
+    typedef byte_array<24> heading_bytes;
+
+    /// The payload is hashed once for the heading checksum.
+    raw_message(uint32_t magic, const std::string& command,
+        data_slice payload, storage_ptr storage=nullptr);
+
+    /// The checksum is trusted, for payloads checksummed when stored.
+    raw_message(uint32_t magic, const std::string& command,
+        data_slice payload, uint32_t checksum, storage_ptr storage=nullptr);
+
+    /// The serialized heading.
+    const heading_bytes& head() const;
+
+    /// The payload, which is not owned unless its storage is shared.
+    data_slice payload() const;
+
+    /// The size of the heading and payload.
+    size_t size() const;
+
+    /// The heading and payload for a gathered write, neither is copied.
+    buffers to_buffers() const;
+
+    /// A copy of the heading and payload, for writers that cannot gather.
+    data_chunk to_data() const;
+
+private:
+    const heading_bytes head_;
+    const data_slice payload_;
+    const storage_ptr storage_;
+};
+
+} // namespace message
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,98 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_MESSAGE_RECONCILIATION_SET_HPP
+#define LIBBITCOIN_MESSAGE_RECONCILIATION_SET_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/math/pin_sketch.hpp>
+#include <bitcoin/bitcoin/math/siphash.hpp>
+#include <bitcoin/bitcoin/message/inventory.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+
+namespace libbitcoin {
+namespace message {
+
+/**
+ * This class is not thread safe.
+ * The transactions to be announced to a peer, reconciled by the exchange of
+ * PinSketch sketches of salted 32 bit short ids (bip330) rather than by
+ * flooding inventory. The decoded differences are the short ids of the
+ * transactions held by only one side. Those held locally are announced as
+ * inventory and the others are requested by short id. A failed decode
+ * (differences beyond the capacity) falls back to flooding.
+ */
+class BC_API reconciliation_set
+  : noncopyable
+{
+public:
+    typedef pin_sketch::element short_id;
+    typedef pin_sketch::elements short_id_list;
+
+    /// The largest sketch capacity, bounding sketch size and decode time.
+    static const size_t max_capacity;
+
+    /// The key of the short ids is salted by the salts of both peers, in
+    /// either order, so each side computes the same short ids.
+    reconciliation_set(uint64_t local_salt, uint64_t remote_salt);
+
+    /// The nonzero short id of the witness hash, 1 + (siphash mod 2^32 - 1).
+    short_id to_short_id(const hash_digest& hash) const;
+
+    /// Add the witness hash, false if its short id is already present.
+    bool insert(const hash_digest& hash);
+
+    /// Remove the witness hash, false if it is not present.
+    bool erase(const hash_digest& hash);
+
+    size_t size() const;
+    bool empty() const;
+    void clear();
+
+    /// The capacity for reconciliation with a remote set of the size, where
+    /// q is the expected fraction of the smaller set that differs.
+    size_t capacity(size_t remote_size, double q=0.25) const;
+
+    /// The sketch of the set with the given capacity.
+    pin_sketch sketch(size_t capacity) const;
+
+    /// Decode the differences between the set and the remote sketch (of the
+    /// remote set), false if they exceed the capacity of the remote sketch.
+    bool differences(short_id_list& out, const pin_sketch& remote) const;
+
+    /// The witness transaction inventory of the differences held locally.
+    /// The short ids of the differences not held locally are appended to
+    /// missing, to be requested from the peer.
+    inventory to_inventory(const short_id_list& differences,
+        short_id_list& missing) const;
+
+private:
+    static siphash_key to_key(uint64_t local_salt, uint64_t remote_salt);
+
+    const siphash_key key_;
+    std::unordered_map<short_id, hash_digest> hashes_;
+};
+
+} // namespace message
+} // namespace libbitcoin
+
+#endif
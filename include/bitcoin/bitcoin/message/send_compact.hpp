@@ -19,6 +19,7 @@
 #ifndef LIBBITCOIN_MESSAGE_SEND_COMPACT_BLOCKS_HPP
 #define LIBBITCOIN_MESSAGE_SEND_COMPACT_BLOCKS_HPP
 
+#include <cstdint>
 #include <istream>
 #include <memory>
 #include <string>
@@ -41,6 +42,11 @@ public:
     static send_compact factory(uint32_t version, reader& source);
     static size_t satoshi_fixed_size(uint32_t version);
 
+    /// The serialized size is fixed, allowing serialization to an array.
+    /// The array codec does not check the protocol version.
+    static BC_CONSTEXPR size_t wire_size = 9;
+    typedef byte_array<wire_size> wire_data;
+
     send_compact();
     send_compact(bool high_bandwidth_mode, uint64_t version);
     send_compact(const send_compact& other);
@@ -55,9 +61,11 @@ public:
     bool from_data(uint32_t version, const data_chunk& data);
     bool from_data(uint32_t version, std::istream& stream);
     bool from_data(uint32_t version, reader& source);
+    bool from_wire_data(const wire_data& data);
     data_chunk to_data(uint32_t version) const;
     void to_data(uint32_t version, std::ostream& stream) const;
     void to_data(uint32_t version, writer& sink) const;
+    wire_data to_wire_data() const;
     bool is_valid() const;
     void reset();
     size_t serialized_size(uint32_t version) const;
@@ -0,0 +1,121 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_MESSAGE_STATISTICS_HPP
+#define LIBBITCOIN_MESSAGE_STATISTICS_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/log/metrics.hpp>
+#include <bitcoin/bitcoin/message/heading.hpp>
+#include <bitcoin/bitcoin/utility/asio.hpp>
+
+namespace libbitcoin {
+namespace message {
+
+/**
+ * This class is thread safe.
+ * Optional process-wide statistics of message parsing (factories) and
+ * serialization, by message type. Each thread records into its own counters,
+ * without locking or sharing cache lines, and the counters of all threads are
+ * merged into metrics periodically (at each metrics collection once attached).
+ * Recording is disabled by default, at the cost of one relaxed load.
+ */
+class BC_API statistics
+{
+public:
+    enum class operation
+    {
+        parse,
+        serialize
+    };
+
+    /// Enable or disable recording.
+    static void enable(bool value=true);
+
+    /// Recording is enabled.
+    static bool enabled()
+    {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    /// The command of the message type, empty for unknown.
+    static const std::string& command(message_type type);
+
+    /// The message type of the message class, resolved once.
+    template <class Message>
+    static message_type type();
+
+    /// Record an operation on a payload of bytes started at the time.
+    static void record(message_type type, operation action, size_t bytes,
+        const asio::time_point& start);
+
+    /**
+     * Move the counters of all threads into the metrics, by command, as:
+     * <prefix><command>.<parse|serialize>.bytes      payload bytes (counter)
+     * <prefix><command>.<parse|serialize>.nanoseconds elapsed (counter)
+     * <prefix><command>.<parse|serialize>.time       elapsed (timer, count)
+     */
+    static void merge(log::metrics& metrics,
+        const std::string& prefix="message.");
+
+    /// Merge into the metrics before each of its collections.
+    static void attach(log::metrics& metrics,
+        const std::string& prefix="message.");
+
+    /// Construct the message from the source (data chunk, stream or reader),
+    /// recording the parse and its payload size when enabled.
+    template <class Message, class Source>
+    static Message factory(uint32_t version, Source& source);
+
+private:
+    static std::atomic<bool> enabled_;
+};
+
+template <class Message>
+message_type statistics::type()
+{
+    static const auto type = heading(0, Message::command, 0, 0).type();
+    return type;
+}
+
+template <class Message, class Source>
+Message statistics::factory(uint32_t version, Source& source)
+{
+    Message instance;
+
+    if (!enabled())
+    {
+        instance.from_data(version, source);
+        return instance;
+    }
+
+    const auto start = asio::steady_clock::now();
+    const auto valid = instance.from_data(version, source);
+    const auto bytes = valid ? instance.serialized_size(version) : 0;
+    record(type<Message>(), operation::parse, bytes, start);
+    return instance;
+}
+
+} // namespace message
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,125 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_NETWORK_PROFILES_HPP
+#define LIBBITCOIN_NETWORK_PROFILES_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/bitcoin/define.hpp>
+
+namespace libbitcoin {
+namespace profiles {
+
+/**
+ * Compile-time network parameters, for use as the template argument of the
+ * validation entry points (such as block::accept<profiles::mainnet>), so
+ * that the parameters are constants of the validation code. These are the
+ * scalar parameters of settings(config::settings), which is populated from
+ * them. A custom network uses the runtime settings.
+ */
+struct common
+{
+    static BC_CONSTEXPR uint32_t timestamp_limit_seconds = 2 * 60 * 60;
+
+    // Retargeting.
+    static BC_CONSTEXPR uint32_t retargeting_factor = 4;
+    static BC_CONSTEXPR uint32_t block_spacing_seconds = 10 * 60;
+    static BC_CONSTEXPR uint32_t retargeting_interval_seconds =
+        2 * 7 * 24 * 60 * 60;
+    static BC_CONSTEXPR uint32_t minimum_timespan =
+        retargeting_interval_seconds / retargeting_factor;
+    static BC_CONSTEXPR uint32_t maximum_timespan =
+        retargeting_interval_seconds * retargeting_factor;
+    static BC_CONSTEXPR size_t retargeting_interval =
+        retargeting_interval_seconds / block_spacing_seconds;
+
+    // Currency units.
+    static BC_CONSTEXPR uint64_t satoshi_per_bitcoin = 100000000;
+    static BC_CONSTEXPR uint64_t initial_block_subsidy_bitcoin = 50;
+    static BC_CONSTEXPR uint64_t initial_block_subsidy_satoshi =
+        initial_block_subsidy_bitcoin * satoshi_per_bitcoin;
+
+    // The sum of the halvings of the initial block subsidy in satoshi.
+    static BC_CONSTEXPR uint64_t recursive_money = 9999999989u;
+
+    // Consensus rule change activation and enforcement versions.
+    static BC_CONSTEXPR uint32_t first_version = 1;
+    static BC_CONSTEXPR uint32_t bip34_version = 2;
+    static BC_CONSTEXPR uint32_t bip66_version = 3;
+    static BC_CONSTEXPR uint32_t bip65_version = 4;
+    static BC_CONSTEXPR uint32_t bip9_version_bit0 = 1u << 0;
+    static BC_CONSTEXPR uint32_t bip9_version_bit1 = 1u << 1;
+    static BC_CONSTEXPR uint32_t bip9_version_base = 0x20000000;
+
+    // Activation parameters (bip34-style activations).
+    static BC_CONSTEXPR size_t activation_threshold = 750;
+    static BC_CONSTEXPR size_t enforcement_threshold = 950;
+    static BC_CONSTEXPR size_t activation_sample = 1000;
+};
+
+struct mainnet
+  : common
+{
+    static BC_CONSTEXPR uint32_t proof_of_work_limit = 0x1d00ffff;
+    static BC_CONSTEXPR uint64_t subsidy_interval = 210000;
+    static BC_CONSTEXPR uint64_t max_money = recursive_money *
+        subsidy_interval;
+
+    static BC_CONSTEXPR size_t bip65_freeze = 388381;
+    static BC_CONSTEXPR size_t bip66_freeze = 363725;
+    static BC_CONSTEXPR size_t bip34_freeze = 227931;
+    static BC_CONSTEXPR uint32_t bip16_activation_time = 0x4f779a80;
+};
+
+struct testnet
+  : common
+{
+    static BC_CONSTEXPR uint32_t proof_of_work_limit = 0x1d00ffff;
+    static BC_CONSTEXPR uint64_t subsidy_interval = 210000;
+    static BC_CONSTEXPR uint64_t max_money = recursive_money *
+        subsidy_interval;
+
+    static BC_CONSTEXPR size_t activation_threshold = 51;
+    static BC_CONSTEXPR size_t enforcement_threshold = 75;
+    static BC_CONSTEXPR size_t activation_sample = 100;
+
+    static BC_CONSTEXPR size_t bip65_freeze = 581885;
+    static BC_CONSTEXPR size_t bip66_freeze = 330776;
+    static BC_CONSTEXPR size_t bip34_freeze = 21111;
+    static BC_CONSTEXPR uint32_t bip16_activation_time = 0x4f3af580;
+};
+
+struct regtest
+  : common
+{
+    static BC_CONSTEXPR uint32_t proof_of_work_limit = 0x207fffff;
+    static BC_CONSTEXPR uint64_t subsidy_interval = 150;
+    static BC_CONSTEXPR uint64_t max_money = recursive_money *
+        subsidy_interval;
+
+    static BC_CONSTEXPR size_t bip65_freeze = 1351;
+    static BC_CONSTEXPR size_t bip66_freeze = 1251;
+    static BC_CONSTEXPR size_t bip34_freeze = 0;
+    static BC_CONSTEXPR uint32_t bip16_activation_time = 0x4f3af580;
+};
+
+} // namespace profiles
+} // namespace libbitcoin
+
+#endif
@@ -60,6 +60,12 @@ public:
 
     config::block genesis_block;
 
+    // Cache settings.
+    //--------------------------------------------------------------------------
+
+    // The total of memory_budget::process(), zero leaves caches as configured.
+    size_t cache_budget_bytes;
+
     // Fork settings.
     //--------------------------------------------------------------------------
 
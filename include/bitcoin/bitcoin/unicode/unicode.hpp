@@ -145,7 +145,8 @@ std::ostream& cerr_stream();
 
 /**
  * Normalize a string value using nfc normalization.
- * This function requires the ICU dependency.
+ * This function requires the ICU dependency, though an ASCII value is
+ * returned as is. The ICU locale is generated once per process.
  * @param[in]  value  The value to normalize.
  * @return            The normalized value.
  */
@@ -153,7 +154,8 @@ BC_API std::string to_normal_nfc_form(const std::string& value);
 
 /**
  * Normalize a string value using nfkd normalization.
- * This function requires the ICU dependency.
+ * This function requires the ICU dependency, though an ASCII value is
+ * returned as is. The ICU locale is generated once per process.
  * @param[in]  value  The value to normalize.
  * @return            The normalized value.
  */
@@ -0,0 +1,161 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_ASYNC_FILE_WRITER_HPP
+#define LIBBITCOIN_ASYNC_FILE_WRITER_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <boost/filesystem.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
+
+namespace libbitcoin {
+
+/// This class is not thread safe.
+/// A heap buffer aligned for direct i/o, its size is rounded up to alignment.
+class BC_API aligned_buffer
+  : noncopyable
+{
+public:
+    typedef std::shared_ptr<aligned_buffer> ptr;
+
+    /// The alignment of address, size and file offset required by direct i/o.
+    static const size_t alignment;
+
+    /// Round the size up to the next multiple of alignment.
+    static size_t align(size_t size);
+
+    /// Allocate a zeroized buffer, throws std::bad_alloc on failure.
+    explicit aligned_buffer(size_t size);
+    ~aligned_buffer();
+
+    uint8_t* data();
+    const uint8_t* data() const;
+    size_t size() const;
+
+private:
+    uint8_t* data_;
+    const size_t size_;
+};
+
+/**
+ * This class is thread safe.
+ * Writes a file asynchronously, with completion handlers posted to the pool.
+ * Writes and syncs are queued and then started together by submit, so that
+ * a batch costs one system call. A sync is a barrier, it starts once all
+ * operations queued before it have completed and operations queued after it
+ * start once it has completed. Each buffer is retained until its write
+ * completes. On linux the writer uses io_uring where the kernel permits,
+ * otherwise operations are executed in order on a thread of the pool.
+ */
+class BC_API async_file_writer
+  : noncopyable
+{
+public:
+    typedef boost::filesystem::path path;
+    typedef std::function<void(const code&)> handler;
+
+    /// The default limit of operations outstanding in the kernel.
+    static const size_t default_depth;
+
+    /// Construct a writer with the default queue depth.
+    async_file_writer(threadpool& pool);
+
+    /// Construct a writer with the given queue depth (one or more).
+    async_file_writer(threadpool& pool, size_t depth);
+
+    /// Close the file, waiting for outstanding operations.
+    ~async_file_writer();
+
+    /// Open (or create) the file for writing. With direct the page cache is
+    /// bypassed where the platform supports it, and each write must then
+    /// be of aligned size at an aligned offset.
+    code open(const path& file, bool direct=false);
+
+    /// Queue a write of the first size bytes of buffer at the file offset.
+    void write(uint64_t offset, aligned_buffer::ptr buffer, size_t size,
+        handler handle);
+
+    /// Queue a write of the full buffer at the file offset.
+    void write(uint64_t offset, aligned_buffer::ptr buffer, handler handle);
+
+    /// Queue a barrier that flushes all prior writes to the device.
+    void sync(handler handle);
+
+    /// Start all queued operations.
+    void submit();
+
+    /// Submit queued operations, wait for all to complete and close the file.
+    code close();
+
+    /// True if the file is open.
+    bool is_open() const;
+
+    /// True if operations are executed by io_uring.
+    bool is_kernel_queued() const;
+
+private:
+    struct operation;
+    struct ring;
+    typedef std::shared_ptr<operation> operation_ptr;
+    typedef std::deque<operation_ptr> operations;
+
+    static code execute(int file, const operation& op);
+
+    void enqueue(operation_ptr op);
+    void complete(operation_ptr op, const code& ec);
+
+    // Kernel queue (linux only).
+    bool start_ring();
+    void stop_ring();
+    void submit_ring();
+    void reap_ring();
+
+    // Pool queue.
+    void submit_pool();
+    void drain_pool();
+
+    // This is thread safe.
+    threadpool& pool_;
+    const size_t depth_;
+
+    // These are protected by mutex.
+    int file_;
+    bool direct_;
+    bool draining_;
+    size_t outstanding_;
+    operations queued_;
+    operations pending_;
+    std::unique_ptr<ring> ring_;
+    std::thread reaper_;
+    std::condition_variable idle_;
+    mutable std::mutex mutex_;
+};
+
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,95 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_BINARY_SET_HPP
+#define LIBBITCOIN_BINARY_SET_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/utility/binary.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+
+namespace libbitcoin {
+
+/// A packed array of fixed width bit records, for matching one prefix
+/// against many records. Each record occupies whole 64 bit words, so a
+/// prefix of up to 64 bits is matched with a single mask and compare.
+class BC_API binary_set
+{
+public:
+    typedef binary::size_type size_type;
+    typedef std::vector<size_type> index_list;
+
+    /// Records are truncated or zero padded to this many bits.
+    binary_set(size_type bits);
+
+    /// The width of each record in bits.
+    size_type bits() const;
+
+    /// The number of records.
+    size_type size() const;
+    bool empty() const;
+    void reserve(size_type count);
+    void clear();
+
+    /// Add a record, with bits ordered as binary(bits(), record).
+    void push_back(data_slice record);
+
+    /// Add a record, with the field little endian as binary(bits(), field).
+    void push_back(uint32_t field);
+
+    /// The record at the index.
+    binary operator[](size_type index) const;
+
+    /// True if the prefix is a prefix of the record at the index.
+    bool is_prefix(const binary& prefix, size_type index) const;
+
+    /// The number of records of which the prefix is a prefix.
+    size_type count(const binary& prefix) const;
+
+    /// The ascending indexes of the records of which the prefix is a prefix.
+    index_list match(const binary& prefix) const;
+
+private:
+    typedef std::vector<uint64_t> word_list;
+
+    // The prefix reduced to masked words over the record width.
+    struct filter
+    {
+        word_list masks;
+        word_list values;
+        bool none;
+    };
+
+    filter to_filter(const binary& prefix) const;
+    bool is_match(const filter& filter, size_type index) const;
+
+    template <typename Visitor>
+    void scan(const filter& filter, Visitor visitor) const;
+
+    const size_type bits_;
+    const size_type stride_;
+    size_type size_;
+    word_list words_;
+};
+
+} // namespace libbitcoin
+
+#endif
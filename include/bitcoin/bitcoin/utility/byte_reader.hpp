@@ -0,0 +1,119 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_BYTE_READER_HPP
+#define LIBBITCOIN_BYTE_READER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/reader.hpp>
+
+namespace libbitcoin {
+
+/// Reader over contiguous memory, which must outlive the reader.
+/// The bounds are checked once per read, so a failed read consumes nothing,
+/// invalidates the reader and returns zero (or empty). This is a faster
+/// alternative to istream_reader over a data_source, with the same results.
+class BC_API byte_reader final
+  : public reader
+{
+public:
+    byte_reader(const data_slice data);
+
+    template <size_t Size>
+    byte_array<Size> read_forward();
+
+    template <typename Integer>
+    Integer read_big_endian();
+
+    template <typename Integer>
+    Integer read_little_endian();
+
+    /// The number of bytes not yet read.
+    size_t remaining() const;
+
+    /// Context.
+    operator bool() const;
+    bool operator!() const;
+    bool is_exhausted() const;
+    void invalidate();
+
+    /// Read hashes.
+    hash_digest read_hash();
+    short_hash read_short_hash();
+    mini_hash read_mini_hash();
+
+    /// Read big endian integers.
+    uint16_t read_2_bytes_big_endian();
+    uint32_t read_4_bytes_big_endian();
+    uint64_t read_8_bytes_big_endian();
+    uint64_t read_variable_big_endian();
+    size_t read_size_big_endian();
+
+    /// Read little endian integers.
+    code read_error_code();
+    uint16_t read_2_bytes_little_endian();
+    uint32_t read_4_bytes_little_endian();
+    uint64_t read_8_bytes_little_endian();
+    uint64_t read_variable_little_endian();
+    size_t read_size_little_endian();
+
+    /// Read base 128 integer, most significant group first.
+    uint64_t read_variable_base128();
+
+    /// Read/peek one byte, peek past the end does not invalidate.
+    uint8_t peek_byte();
+    uint8_t read_byte();
+
+    /// Read all remaining bytes.
+    data_chunk read_bytes();
+
+    /// Read required size buffer, nothing is allocated if unavailable.
+    data_chunk read_bytes(size_t size);
+
+    /// Read required size buffer into out, reusing its capacity.
+    void read_bytes(data_chunk& out, size_t size);
+
+    /// Read variable length string.
+    std::string read_string();
+
+    /// Read up to size characters, trim nulls (a short read is valid).
+    std::string read_string(size_t size);
+
+    /// Advance without reading.
+    void skip(size_t size);
+
+private:
+    // Consume size bytes, or invalidate and return nullptr.
+    const uint8_t* consume(size_t size);
+
+    const uint8_t* position_;
+    const uint8_t* const end_;
+    bool valid_;
+};
+
+} // namespace libbitcoin
+
+#include <bitcoin/bitcoin/impl/utility/byte_reader.ipp>
+
+#endif
@@ -0,0 +1,62 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CBOR_WRITER_HPP
+#define LIBBITCOIN_CBOR_WRITER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/tree_writer.hpp>
+
+namespace libbitcoin {
+
+/// Writer that appends cbor (rfc 7049) to a data chunk, which must outlive
+/// the writer. Containers are indefinite length, so no counts are required,
+/// strings are text and numbers are unsigned integers.
+class BC_API cbor_writer final
+  : public tree_writer
+{
+public:
+    cbor_writer(data_chunk& sink);
+
+    /// Containers.
+    void begin_object();
+    void end_object();
+    void begin_array();
+    void end_array();
+
+    /// Write the key of the next object member.
+    void write_key(const char* key);
+
+    /// Write a value.
+    void write_value(const std::string& value);
+    void write_value(uint64_t value);
+
+private:
+    void write_head(uint8_t major, uint64_t value);
+    void write_text(const char* text, size_t size);
+
+    data_chunk& sink_;
+};
+
+} // namespace libbitcoin
+
+#endif
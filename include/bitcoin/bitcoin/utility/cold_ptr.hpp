@@ -0,0 +1,146 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_COLD_PTR_HPP
+#define LIBBITCOIN_COLD_PTR_HPP
+
+#include <atomic>
+#include <utility>
+
+namespace libbitcoin {
+
+/// A value held out of line and allocated on first access, so that an owner
+/// pays one pointer for state that is rarely populated. Copies are deep and
+/// an unallocated value is copied as unallocated. Concurrent first accesses
+/// race to install an allocation and the losers discard their own, so any
+/// number of threads may access the value. Reset, assignment and copy from
+/// a value being accessed are not thread safe, consistent with the
+/// non-concurrent mutation of the owning objects.
+template <typename Type>
+class cold_ptr
+{
+public:
+    cold_ptr()
+      : value_(nullptr)
+    {
+    }
+
+    cold_ptr(const cold_ptr& other)
+      : value_(other.clone())
+    {
+    }
+
+    cold_ptr(cold_ptr&& other)
+      : value_(other.value_.exchange(nullptr, std::memory_order_acq_rel))
+    {
+    }
+
+    ~cold_ptr()
+    {
+        delete value_.load(std::memory_order_acquire);
+    }
+
+    cold_ptr& operator=(const cold_ptr& other)
+    {
+        if (this != &other)
+            replace(other.clone());
+
+        return *this;
+    }
+
+    cold_ptr& operator=(cold_ptr&& other)
+    {
+        if (this != &other)
+            replace(other.value_.exchange(nullptr, std::memory_order_acq_rel));
+
+        return *this;
+    }
+
+    /// Assign the value, allocating if not allocated.
+    cold_ptr& operator=(const Type& value)
+    {
+        get() = value;
+        return *this;
+    }
+
+    /// True if the value is allocated.
+    operator bool() const
+    {
+        return peek() != nullptr;
+    }
+
+    /// The value if allocated, otherwise nullptr (nothing is allocated).
+    Type* peek() const
+    {
+        return value_.load(std::memory_order_acquire);
+    }
+
+    /// The value, default constructed on first access. This is not const so
+    /// that a read of a const owner cannot allocate, use peek for reads.
+    Type& get()
+    {
+        auto value = value_.load(std::memory_order_acquire);
+
+        if (value != nullptr)
+            return *value;
+
+        const auto created = new Type();
+
+        if (value_.compare_exchange_strong(value, created,
+            std::memory_order_acq_rel))
+            return *created;
+
+        // Another thread installed first, value is now its allocation.
+        delete created;
+        return *value;
+    }
+
+    Type& operator*()
+    {
+        return get();
+    }
+
+    Type* operator->()
+    {
+        return &get();
+    }
+
+    /// Release the value, a subsequent access allocates a default.
+    void reset() const
+    {
+        replace(nullptr);
+    }
+
+private:
+    Type* clone() const
+    {
+        const auto value = peek();
+        return value == nullptr ? nullptr : new Type(*value);
+    }
+
+    void replace(Type* value) const
+    {
+        delete value_.exchange(value, std::memory_order_acq_rel);
+    }
+
+    mutable std::atomic<Type*> value_;
+};
+
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,570 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_COROUTINE_HPP
+#define LIBBITCOIN_COROUTINE_HPP
+
+// Coroutines require C++20, this header is empty under prior standards.
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+    #if __has_include(<coroutine>)
+        #define BC_COROUTINES
+    #endif
+#endif
+
+#ifdef BC_COROUTINES
+
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <optional>
+#include <utility>
+#include <vector>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/utility/asio.hpp>
+#include <bitcoin/bitcoin/utility/deadline.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
+#include <bitcoin/bitcoin/utility/work_stealing_pool.hpp>
+
+namespace libbitcoin {
+
+/// Recycles coroutine frames through per thread free lists, by size class,
+/// so that steady state coroutine calls do not allocate. Frames larger than
+/// the largest class are allocated from the heap. A frame released on
+/// another thread is retained by that thread.
+class frame_pool
+{
+public:
+    static BC_CONSTEXPR size_t granularity = 64;
+    static BC_CONSTEXPR size_t classes = 16;
+    static BC_CONSTEXPR size_t depth = 256;
+
+    static void* allocate(size_t size);
+    static void deallocate(void* frame, size_t size) noexcept;
+
+private:
+    struct node
+    {
+        node* next;
+    };
+
+    struct lists
+    {
+        ~lists();
+        node* heads[classes] = {};
+        size_t sizes[classes] = {};
+    };
+
+    static lists& local();
+};
+
+/// Base for promises, allocates frames from the frame pool.
+class frame_allocated
+{
+public:
+    static void* operator new(size_t size)
+    {
+        return frame_pool::allocate(size);
+    }
+
+    static void operator delete(void* frame, size_t size) noexcept
+    {
+        frame_pool::deallocate(frame, size);
+    }
+};
+
+/// A lazily started coroutine, which starts when awaited and resumes the
+/// awaiting coroutine upon completion. Exceptions propagate to the awaiter.
+template <typename Result=void>
+class task;
+
+namespace detail {
+
+class promise_base
+  : public frame_allocated
+{
+public:
+    struct final_awaiter
+    {
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        template <typename Promise>
+        std::coroutine_handle<> await_suspend(
+            std::coroutine_handle<Promise> handle) noexcept
+        {
+            const auto next = handle.promise().continuation();
+            return next ? next : std::noop_coroutine();
+        }
+
+        void await_resume() const noexcept
+        {
+        }
+    };
+
+    std::suspend_always initial_suspend() const noexcept
+    {
+        return {};
+    }
+
+    final_awaiter final_suspend() const noexcept
+    {
+        return {};
+    }
+
+    void unhandled_exception() noexcept
+    {
+        exception_ = std::current_exception();
+    }
+
+    void set_continuation(std::coroutine_handle<> continuation) noexcept
+    {
+        continuation_ = continuation;
+    }
+
+    std::coroutine_handle<> continuation() const noexcept
+    {
+        return continuation_;
+    }
+
+protected:
+    void rethrow() const
+    {
+        if (exception_)
+            std::rethrow_exception(exception_);
+    }
+
+private:
+    std::coroutine_handle<> continuation_;
+    std::exception_ptr exception_;
+};
+
+template <typename Result>
+class promise
+  : public promise_base
+{
+public:
+    task<Result> get_return_object() noexcept;
+
+    void return_value(Result value)
+    {
+        value_.emplace(std::move(value));
+    }
+
+    Result result()
+    {
+        rethrow();
+        return std::move(*value_);
+    }
+
+private:
+    std::optional<Result> value_;
+};
+
+template <>
+class promise<void>
+  : public promise_base
+{
+public:
+    task<void> get_return_object() noexcept;
+
+    void return_void() const noexcept
+    {
+    }
+
+    void result() const
+    {
+        rethrow();
+    }
+};
+
+// A self destroying coroutine, used to start tasks without awaiting them.
+struct detached
+{
+    struct promise_type
+      : public frame_allocated
+    {
+        detached get_return_object() const noexcept
+        {
+            return {};
+        }
+
+        std::suspend_never initial_suspend() const noexcept
+        {
+            return {};
+        }
+
+        std::suspend_never final_suspend() const noexcept
+        {
+            return {};
+        }
+
+        void return_void() const noexcept
+        {
+        }
+
+        void unhandled_exception() const noexcept
+        {
+            std::terminate();
+        }
+    };
+};
+
+// Counts arrivals of tasks and of the awaiter itself, the last to arrive
+// resumes the awaiter (unless it is the awaiter).
+class join_counter
+  : noncopyable
+{
+public:
+    explicit join_counter(size_t count) noexcept
+      : remaining_(count + 1)
+    {
+    }
+
+    bool arrive() noexcept
+    {
+        return remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1;
+    }
+
+    void complete() noexcept
+    {
+        if (arrive())
+            waiter_.resume();
+    }
+
+    void set_waiter(std::coroutine_handle<> waiter) noexcept
+    {
+        waiter_ = waiter;
+    }
+
+private:
+    std::atomic<size_t> remaining_;
+    std::coroutine_handle<> waiter_;
+};
+
+} // namespace detail
+
+template <typename Result>
+class task
+  : noncopyable
+{
+public:
+    typedef detail::promise<Result> promise_type;
+    typedef std::coroutine_handle<promise_type> handle;
+
+    class awaiter
+    {
+    public:
+        explicit awaiter(handle coroutine) noexcept
+          : coroutine_(coroutine)
+        {
+        }
+
+        bool await_ready() const noexcept
+        {
+            return !coroutine_ || coroutine_.done();
+        }
+
+        std::coroutine_handle<> await_suspend(
+            std::coroutine_handle<> awaiting) noexcept
+        {
+            // Symmetric transfer, the task runs on the awaiting thread.
+            coroutine_.promise().set_continuation(awaiting);
+            return coroutine_;
+        }
+
+        Result await_resume()
+        {
+            return coroutine_.promise().result();
+        }
+
+    private:
+        handle coroutine_;
+    };
+
+    explicit task(handle coroutine) noexcept
+      : coroutine_(coroutine)
+    {
+    }
+
+    task(task&& other) noexcept
+      : coroutine_(std::exchange(other.coroutine_, {}))
+    {
+    }
+
+    task& operator=(task&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (coroutine_)
+                coroutine_.destroy();
+
+            coroutine_ = std::exchange(other.coroutine_, {});
+        }
+
+        return *this;
+    }
+
+    ~task()
+    {
+        if (coroutine_)
+            coroutine_.destroy();
+    }
+
+    awaiter operator co_await() const noexcept
+    {
+        return awaiter(coroutine_);
+    }
+
+private:
+    handle coroutine_;
+};
+
+template <typename Result>
+task<Result> detail::promise<Result>::get_return_object() noexcept
+{
+    return task<Result>(task<Result>::handle::from_promise(*this));
+}
+
+inline task<void> detail::promise<void>::get_return_object() noexcept
+{
+    return task<void>(task<void>::handle::from_promise(*this));
+}
+
+// Awaitables.
+//-----------------------------------------------------------------------------
+
+/// Resumes the awaiting coroutine on a thread of the asio service.
+class service_awaiter
+{
+public:
+    explicit service_awaiter(asio::service& service) noexcept
+      : service_(service)
+    {
+    }
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    void await_suspend(std::coroutine_handle<> awaiting) const
+    {
+        service_.post([awaiting]() { awaiting.resume(); });
+    }
+
+    void await_resume() const noexcept
+    {
+    }
+
+private:
+    asio::service& service_;
+};
+
+/// Resumes the awaiting coroutine on the strand, not concurrently with any
+/// other job of the strand.
+class strand_awaiter
+{
+public:
+    explicit strand_awaiter(asio::service::strand& strand) noexcept
+      : strand_(strand)
+    {
+    }
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    void await_suspend(std::coroutine_handle<> awaiting) const
+    {
+        strand_.post([awaiting]() { awaiting.resume(); });
+    }
+
+    void await_resume() const noexcept
+    {
+    }
+
+private:
+    asio::service::strand& strand_;
+};
+
+/// Resumes the awaiting coroutine on a thread of the work stealing pool.
+class executor_awaiter
+{
+public:
+    explicit executor_awaiter(work_stealing_pool& executor) noexcept
+      : executor_(executor)
+    {
+    }
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    void await_suspend(std::coroutine_handle<> awaiting) const
+    {
+        executor_.post([awaiting]() { awaiting.resume(); });
+    }
+
+    void await_resume() const noexcept
+    {
+    }
+
+private:
+    work_stealing_pool& executor_;
+};
+
+/// Resumes the awaiting coroutine on a pool thread after the duration,
+/// producing success or the normalized timer error code.
+class timer_awaiter
+{
+public:
+    timer_awaiter(threadpool& pool, const asio::duration& duration)
+      : timer_(pool.service()), duration_(duration)
+    {
+    }
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    void await_suspend(std::coroutine_handle<> awaiting)
+    {
+        timer_.expires_from_now(duration_);
+        timer_.async_wait([this, awaiting](const boost_code& ec)
+        {
+            ec_ = ec;
+            awaiting.resume();
+        });
+    }
+
+    code await_resume() const
+    {
+        if (ec_)
+            return error::boost_to_error_code(ec_);
+
+        return error::success;
+    }
+
+private:
+    asio::timer timer_;
+    asio::duration duration_;
+    boost_code ec_;
+};
+
+/// Restarts the deadline and resumes the awaiting coroutine on a pool thread
+/// upon expiration, producing the deadline result code.
+/// A deadline stopped while awaited does not resume the awaiting coroutine.
+class deadline_awaiter
+{
+public:
+    deadline_awaiter(deadline::ptr timer, const asio::duration& duration)
+      : timer_(timer), duration_(duration)
+    {
+    }
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    void await_suspend(std::coroutine_handle<> awaiting)
+    {
+        timer_->start([this, awaiting](const code& ec)
+        {
+            ec_ = ec;
+            awaiting.resume();
+        }, duration_);
+    }
+
+    code await_resume() const noexcept
+    {
+        return ec_;
+    }
+
+private:
+    deadline::ptr timer_;
+    asio::duration duration_;
+    code ec_;
+};
+
+/// co_await schedule(pool) continues the coroutine on a pool thread.
+inline service_awaiter schedule(threadpool& pool)
+{
+    return service_awaiter(pool.service());
+}
+
+/// co_await schedule(strand) continues the coroutine on the strand.
+inline strand_awaiter schedule(asio::service::strand& strand)
+{
+    return strand_awaiter(strand);
+}
+
+/// co_await schedule(executor) continues the coroutine on the executor.
+inline executor_awaiter schedule(work_stealing_pool& executor)
+{
+    return executor_awaiter(executor);
+}
+
+/// co_await delay(pool, duration) continues on a pool thread when elapsed.
+inline timer_awaiter delay(threadpool& pool, const asio::duration& duration)
+{
+    return timer_awaiter(pool, duration);
+}
+
+/// co_await wait(timer, duration) continues upon the deadline expiration.
+inline deadline_awaiter wait(deadline::ptr timer,
+    const asio::duration& duration)
+{
+    return deadline_awaiter(timer, duration);
+}
+
+// Composition.
+//-----------------------------------------------------------------------------
+
+/// Start each task in order on the awaiting thread, each runs concurrently
+/// from its first suspension. Completes when all have completed, on the
+/// thread of the last to complete, rethrowing the first (by order) exception.
+task<void> when_all(std::vector<task<void>> tasks);
+
+/// As above, then producing the first (by order) failure code or success, as
+/// the synchronizer does for callbacks.
+task<code> when_all(std::vector<task<code>> tasks);
+
+/// Start the task without awaiting it. The task must not throw.
+void spawn(task<void>&& job);
+
+/// Block the calling thread until the task completes, producing its result.
+/// This must not be called from a thread on which the task may be resumed.
+template <typename Result>
+Result sync_wait(task<Result>&& job);
+
+} // namespace libbitcoin
+
+#include <bitcoin/bitcoin/impl/utility/coroutine.ipp>
+
+#endif // BC_COROUTINES
+
+#endif
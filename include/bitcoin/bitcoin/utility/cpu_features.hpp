@@ -0,0 +1,66 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CPU_FEATURES_HPP
+#define LIBBITCOIN_CPU_FEATURES_HPP
+
+#include <cstdint>
+#include <string>
+#include <bitcoin/bitcoin/define.hpp>
+
+namespace libbitcoin {
+
+/// Processor features used to select hashing, cypher, encoding and field
+/// arithmetic kernels.
+/// The avx2 feature implies operating system support for the AVX state.
+enum cpu_feature : uint32_t
+{
+    no_features = 0,
+
+    sse2_feature = 1u << 0,
+    ssse3_feature = 1u << 1,
+    sse41_feature = 1u << 2,
+    avx2_feature = 1u << 3,
+    sha_ni_feature = 1u << 4,
+    aes_ni_feature = 1u << 5,
+    clmul_feature = 1u << 6,
+    arm_sha2_feature = 1u << 8,
+    arm_sha512_feature = 1u << 9,
+    arm_aes_feature = 1u << 10,
+    all_features = 0xffffffff
+};
+
+/// The features of the executing processor, detected once.
+BC_API uint32_t cpu_features_detected();
+
+/// The detected features enabled for kernel selection.
+BC_API uint32_t cpu_features();
+
+/// Restrict kernel selection to the detected features in the mask, with zero
+/// forcing portable code and all_features restoring the default. Each
+/// kernel is reselected on its next use. This is for testing and benchmarks,
+/// it must not be called concurrently with hashing.
+BC_API void set_cpu_features(uint32_t mask);
+
+/// The enabled features and the kernel selected by each module, for example:
+/// "features=sse2,ssse3,avx2 sha256=shani+avx2 sha512=portable+avx2 ...".
+BC_API std::string cpu_kernels();
+
+} // namespace libbitcoin
+
+#endif
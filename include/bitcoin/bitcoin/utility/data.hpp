@@ -28,6 +28,8 @@
 #include <vector>
 #include <bitcoin/bitcoin/define.hpp>
 #include <bitcoin/bitcoin/utility/array_slice.hpp>
+#include <bitcoin/bitcoin/utility/pool_allocator.hpp>
+#include <bitcoin/bitcoin/utility/secure_allocator.hpp>
 
 namespace libbitcoin {
 
@@ -45,7 +47,16 @@ struct byte_array_parts
 // Define arbitrary byte storage types.
 typedef byte_array<1> one_byte;
 typedef array_slice<uint8_t> data_slice;
+typedef std::vector<uint8_t, pool_allocator<uint8_t>> pooled_chunk;
+typedef std::vector<uint8_t, secure_allocator<uint8_t>> secure_chunk;
+
+// Pooling of all data chunks changes the type, so is selected at configure.
+#ifdef BC_POOLED_CHUNK
+typedef pooled_chunk data_chunk;
+#else
 typedef std::vector<uint8_t> data_chunk;
+#endif
+
 typedef std::queue<data_chunk> data_queue;
 typedef std::vector<data_chunk> data_stack;
 typedef std::initializer_list<data_slice> loaf;
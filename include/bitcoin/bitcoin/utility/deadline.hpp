@@ -28,6 +28,7 @@
 #include <bitcoin/bitcoin/utility/noncopyable.hpp>
 #include <bitcoin/bitcoin/utility/thread.hpp>
 #include <bitcoin/bitcoin/utility/threadpool.hpp>
+#include <bitcoin/bitcoin/utility/timer_wheel.hpp>
 ////#include <bitcoin/bitcoin/utility/track.hpp>
 
 namespace libbitcoin {
@@ -59,6 +60,17 @@ public:
      */
     deadline(threadpool& pool, const asio::duration duration);
 
+    /**
+     * Construct a deadline timer attached to a shared timer wheel.
+     * Start and stop are constant time, expiration is rounded up to the
+     * wheel resolution. The wheel must outlive the timer.
+     * @param[in]  pool      The thread pool used by the timer.
+     * @param[in]  wheel     The timer wheel that schedules the timer.
+     * @param[in]  duration  The default time period from start to expiration.
+     */
+    deadline(threadpool& pool, timer_wheel& wheel,
+        const asio::duration duration);
+
     /**
      * Start or restart the timer.
      * The handler will not be invoked within the scope of this call.
@@ -86,6 +98,7 @@ private:
 
     asio::timer timer_;
     asio::duration duration_;
+    const timer_wheel::timer::ptr entry_;
     mutable shared_mutex mutex_;
 };
 
@@ -23,6 +23,7 @@
 #include <cstdint>
 #include <functional>
 #include <string>
+#include <type_traits>
 #include <bitcoin/bitcoin/error.hpp>
 #include <bitcoin/bitcoin/math/hash.hpp>
 #include <bitcoin/bitcoin/utility/data.hpp>
@@ -84,6 +85,9 @@ public:
     uint64_t read_variable_little_endian();
     size_t read_size_little_endian();
 
+    /// Read base 128 integer, most significant group first.
+    uint64_t read_variable_base128();
+
     /// Read/peek one byte.
     uint8_t peek_byte();
     uint8_t read_byte();
@@ -94,6 +98,9 @@ public:
     /// Read required size buffer.
     data_chunk read_bytes(size_t size);
 
+    /// Read required size buffer into out, reusing its capacity.
+    void read_bytes(data_chunk& out, size_t size);
+
     /// Read variable length string.
     std::string read_string();
 
@@ -103,12 +110,20 @@ public:
     /// Advance iterator without reading.
     void skip(size_t size);
 
+    /// The number of bytes remaining, max_size_t if unsafe (unchecked).
+    size_t remaining() const;
+
 private:
+    // Read a compact size from contiguous bytes of a safe deserializer, false
+    // if not contiguous or if the widest form is not in bounds.
+    bool read_variable_in_place(uint64_t& out, std::false_type);
+    bool read_variable_in_place(uint64_t& out, std::true_type);
+
     // True if is a safe deserializer and size does not exceed remaining bytes.
     bool safe(size_t size) const;
 
     // The number of bytes remaining in the buffer.
-    size_t remaining() const;
+    size_t available() const;
 
     bool valid_;
     Iterator iterator_;
@@ -33,6 +33,7 @@
 #include <bitcoin/bitcoin/utility/synchronizer.hpp>
 #include <bitcoin/bitcoin/utility/threadpool.hpp>
 #include <bitcoin/bitcoin/utility/work.hpp>
+#include <bitcoin/bitcoin/utility/work_stealing_pool.hpp>
 
 namespace libbitcoin {
 
@@ -61,10 +62,24 @@ public:
 
     dispatcher(threadpool& pool, const std::string& name);
 
-    ////size_t ordered_backlog();
-    ////size_t unordered_backlog();
-    ////size_t concurrent_backlog();
-    ////size_t combined_backlog();
+    /// Concurrent jobs are posted to the executor, others to the pool.
+    dispatcher(threadpool& pool, work_stealing_pool& executor,
+        const std::string& name);
+
+    /// Jobs queued and not yet started, by context.
+    size_t ordered_backlog() const;
+    size_t unordered_backlog() const;
+    size_t concurrent_backlog() const;
+    size_t sequential_backlog() const;
+    size_t keyed_backlog() const;
+    size_t combined_backlog() const;
+
+    /// The number of keyed strands and the backlog of one, to find hot keys.
+    size_t shards() const;
+    size_t keyed_backlog(size_t shard) const;
+
+    /// Send the queue depth and latency metrics to the statsd source.
+    void publish(const std::string& prefix) const;
 
     /// Invokes a job on the current thread. Equivalent to invoking std::bind.
     template <typename... Args>
@@ -87,6 +102,14 @@ public:
         heap_->ordered(BIND_ARGS(args));
     }
 
+    /// Post a job to the strand of the key. Ordered and not concurrent with
+    /// jobs of the same key, concurrent with jobs of most other keys.
+    template <typename Key, typename... Args>
+    void ordered_by(const Key& key, Args&&... args)
+    {
+        heap_->ordered_by(key, BIND_ARGS(args));
+    }
+
     /// Posts a strand-wrapped job to the service. Not ordered or concurrent.
     /// The wrap provides non-concurrency, order is prevented by service post.
     template <typename... Args>
@@ -19,6 +19,7 @@
 #ifndef LIBBITCOIN_ENDIAN_HPP
 #define LIBBITCOIN_ENDIAN_HPP
 
+#include <cstdint>
 #include <istream>
 #include <bitcoin/bitcoin/define.hpp>
 #include <bitcoin/bitcoin/utility/data.hpp>
@@ -49,6 +50,20 @@ byte_array<sizeof(Integer)> to_big_endian(Integer value);
 template <typename Integer>
 byte_array<sizeof(Integer)> to_little_endian(Integer value);
 
+/// Fixed layout codecs, data must address sizeof(Integer) bytes.
+/// On little endian hosts the little endian forms are a single unaligned move.
+template <typename Integer>
+Integer load_big_endian(const uint8_t* data);
+
+template <typename Integer>
+Integer load_little_endian(const uint8_t* data);
+
+template <typename Integer>
+void store_big_endian(uint8_t* data, Integer value);
+
+template <typename Integer>
+void store_little_endian(uint8_t* data, Integer value);
+
 } // namespace libbitcoin
 
 #include <bitcoin/bitcoin/impl/utility/endian.ipp>
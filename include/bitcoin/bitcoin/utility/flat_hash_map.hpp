@@ -0,0 +1,113 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_FLAT_HASH_MAP_HPP
+#define LIBBITCOIN_FLAT_HASH_MAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <bitcoin/bitcoin/math/salted_hash.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+
+namespace libbitcoin {
+
+/**
+ * This class is not thread safe.
+ * An open-addressing hash map of keys and values stored inline in flat
+ * arrays, so that insertion does not allocate per entry. Slots are grouped
+ * sixteen to a group, and each slot has a control byte holding seven bits of
+ * its key's hash (or an empty or erased mark). A probe compares the control
+ * bytes of a whole group at once (with SSE2 where available) before any key
+ * is compared, and ends at the first group with an empty slot. Key and Value
+ * must be default constructible and move assignable. Pointers to values are
+ * invalidated by insertion. The default hash is salted (see salted_hash).
+ */
+template <typename Key, typename Value, typename Hash=salted_hash<Key>>
+class flat_hash_map
+  : noncopyable
+{
+public:
+    typedef std::pair<Key, Value> value_type;
+
+    /// The number of slots in a group.
+    static BC_CONSTEXPR size_t group_size = 16;
+
+    /// Construct a map with space for the number of entries.
+    flat_hash_map(size_t entries=0);
+
+    /// Allow for the number of entries without further allocation.
+    void reserve(size_t entries);
+
+    /// Insert the entry, false (and unchanged) if the key is present.
+    bool insert(const Key& key, Value value);
+
+    /// The value of the key, inserting a default value if not present.
+    Value& operator[](const Key& key);
+
+    /// The value of the key, nullptr if not present.
+    Value* find(const Key& key);
+    const Value* find(const Key& key) const;
+
+    bool contains(const Key& key) const;
+
+    /// Erase the entry, false if the key is not present.
+    bool erase(const Key& key);
+
+    /// Remove all entries, retaining allocated space.
+    void clear();
+
+    /// Release allocated space in excess of that required by the entries.
+    void shrink_to_fit();
+
+    bool empty() const;
+    size_t size() const;
+
+    /// The number of slots.
+    size_t capacity() const;
+
+    /// Invoke handler(key, value) for each entry, in no particular order.
+    template <typename Handler>
+    void for_each(Handler&& handler) const;
+
+private:
+    static size_t to_groups(size_t entries);
+    static uint32_t match(const uint8_t* group, uint8_t control);
+    static uint32_t match_empty(const uint8_t* group);
+    static uint32_t match_free(const uint8_t* group);
+    static size_t lowest(uint32_t mask);
+
+    size_t locate(const Key& key, size_t hash) const;
+    size_t add(const Key& key, size_t hash);
+    size_t claim(size_t hash);
+    void rehash(size_t groups);
+
+    Hash hasher_;
+    size_t groups_;
+    size_t size_;
+    size_t erased_;
+    std::unique_ptr<uint8_t[]> controls_;
+    std::unique_ptr<value_type[]> slots_;
+};
+
+} // namespace libbitcoin
+
+#include <bitcoin/bitcoin/impl/utility/flat_hash_map.ipp>
+
+#endif
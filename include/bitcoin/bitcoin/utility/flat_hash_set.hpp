@@ -0,0 +1,78 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_FLAT_HASH_SET_HPP
+#define LIBBITCOIN_FLAT_HASH_SET_HPP
+
+#include <cstddef>
+#include <bitcoin/bitcoin/math/salted_hash.hpp>
+#include <bitcoin/bitcoin/utility/flat_hash_map.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+
+namespace libbitcoin {
+
+/**
+ * This class is not thread safe.
+ * An open-addressing hash set of keys stored inline in a flat array, as
+ * flat_hash_map (which it wraps with an empty value).
+ */
+template <typename Key, typename Hash=salted_hash<Key>>
+class flat_hash_set
+  : noncopyable
+{
+public:
+    /// Construct a set with space for the number of keys.
+    flat_hash_set(size_t keys=0);
+
+    /// Allow for the number of keys without further allocation.
+    void reserve(size_t keys);
+
+    /// Insert the key, false if it is present.
+    bool insert(const Key& key);
+
+    bool contains(const Key& key) const;
+
+    /// Erase the key, false if it is not present.
+    bool erase(const Key& key);
+
+    /// Remove all keys, retaining allocated space.
+    void clear();
+
+    bool empty() const;
+    size_t size() const;
+
+    /// The number of slots.
+    size_t capacity() const;
+
+    /// Invoke handler(key) for each key, in no particular order.
+    template <typename Handler>
+    void for_each(Handler&& handler) const;
+
+private:
+    struct none
+    {
+    };
+
+    flat_hash_map<Key, none, Hash> map_;
+};
+
+} // namespace libbitcoin
+
+#include <bitcoin/bitcoin/impl/utility/flat_hash_set.ipp>
+
+#endif
@@ -50,6 +50,9 @@ public:
     bool is_exhausted() const;
     void invalidate();
 
+    /// The size of a stream is unknown, so this is max_size_t.
+    size_t remaining() const;
+
     /// Read hashes.
     hash_digest read_hash();
     short_hash read_short_hash();
@@ -70,6 +73,9 @@ public:
     uint64_t read_variable_little_endian();
     size_t read_size_little_endian();
 
+    /// Read base 128 integer, most significant group first.
+    uint64_t read_variable_base128();
+
     /// Read/peek one byte.
     uint8_t peek_byte();
     uint8_t read_byte();
@@ -80,6 +86,9 @@ public:
     /// Read required size buffer.
     data_chunk read_bytes(size_t size);
 
+    /// Read required size buffer into out, reusing its capacity.
+    void read_bytes(data_chunk& out, size_t size);
+
     /// Read variable length string.
     std::string read_string();
 
@@ -0,0 +1,62 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_JSON_WRITER_HPP
+#define LIBBITCOIN_JSON_WRITER_HPP
+
+#include <cstdint>
+#include <string>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/utility/tree_writer.hpp>
+
+namespace libbitcoin {
+
+/// Writer that appends compact json to a string, which must outlive the
+/// writer. Clear and reuse the string to avoid reallocation. Numbers are
+/// written as strings and escaping follows boost::property_tree, so output
+/// matches write_json(stream, tree, false) without the trailing newline.
+class BC_API json_writer final
+  : public tree_writer
+{
+public:
+    json_writer(std::string& sink);
+
+    /// Containers.
+    void begin_object();
+    void end_object();
+    void begin_array();
+    void end_array();
+
+    /// Write the key of the next object member.
+    void write_key(const char* key);
+
+    /// Write a value.
+    void write_value(const std::string& value);
+    void write_value(uint64_t value);
+
+private:
+    void separate();
+    void write_escaped(const char* text, size_t size);
+
+    std::string& sink_;
+    bool first_;
+};
+
+} // namespace libbitcoin
+
+#endif
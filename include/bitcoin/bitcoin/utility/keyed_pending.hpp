@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_KEYED_PENDING_HPP
+#define LIBBITCOIN_KEYED_PENDING_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+#include <bitcoin/bitcoin/utility/thread.hpp>
+
+namespace libbitcoin {
+
+/// A managed collection of object pointers, unique by key.
+/// KeyOf maps an element to its key: Key operator()(const Element&) const.
+/// The key of an element must not change while it is in the collection.
+template <class Element, class Key, class KeyOf, class Hash=std::hash<Key>>
+class keyed_pending
+  : noncopyable
+{
+public:
+    typedef Key key_type;
+    typedef std::shared_ptr<Element> element_ptr;
+    typedef std::vector<element_ptr> elements;
+
+    keyed_pending(size_t initial_capacity, const KeyOf& key_of=KeyOf());
+    virtual ~keyed_pending();
+
+    /// Safely copy the member collection.
+    elements collection() const;
+
+    /// The number of elements in the collection.
+    size_t size() const;
+
+    /// Determine if there exists an element with the key.
+    bool exists(const Key& key) const;
+
+    /// Get the element with the key, or nullptr if not found.
+    element_ptr find(const Key& key) const;
+
+    /// Store a uniquely-keyed element (fails if stopped or key exists).
+    code store(element_ptr element);
+
+    /// Remove the element from the collection, if stored.
+    void remove(element_ptr element);
+
+    /// Remove the element with the key, returns the element or nullptr.
+    element_ptr remove(const Key& key);
+
+    /// Stop all elements of the collection (idempotent).
+    void stop(const code& ec);
+
+    /// Close and erase all elements of the collection (blocking).
+    void close();
+
+private:
+    typedef std::unordered_map<Key, element_ptr, Hash> map;
+
+    // These are thread safe.
+    const KeyOf key_of_;
+    std::atomic<bool> stopped_;
+
+    // This is protected by mutex.
+    map elements_;
+    mutable upgrade_mutex mutex_;
+};
+
+} // namespace libbitcoin
+
+#include <bitcoin/bitcoin/impl/utility/keyed_pending.ipp>
+
+#endif
@@ -0,0 +1,154 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_LARGE_PAGE_ALLOCATOR_HPP
+#define LIBBITCOIN_LARGE_PAGE_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <bitcoin/bitcoin/define.hpp>
+
+namespace libbitcoin {
+namespace log {
+    class metrics;
+} // namespace log
+} // namespace libbitcoin
+
+namespace libbitcoin {
+
+/**
+ * This class is thread safe.
+ * Process-wide mapping of large tables (e.g. the utxo table and the header
+ * index) onto huge pages, which reduces the TLB misses of random access over
+ * gigabytes. Each allocation takes the largest page size permitted by the
+ * policy that the system provides, falling back to transparent huge pages
+ * (advised) and then to standard pages. Smaller allocations, and all
+ * allocations under the default policy, are taken from the heap.
+ */
+class BC_API large_pages
+{
+public:
+    /// The pages backing an allocation, in order of preference.
+    enum class mode
+    {
+        heap,
+        standard,
+        transparent,
+        huge_2mb,
+        huge_1gb
+    };
+
+    struct policy
+    {
+        /// The largest page size to request, heap disables mapping.
+        mode pages = mode::heap;
+
+        /// The NUMA node of mapped memory, negative for the default.
+        int numa_node = -1;
+
+        /// Allocations below this size are taken from the heap.
+        size_t minimum = size_t(2) << 20;
+    };
+
+    /// Bytes currently allocated by mode (heap is not counted) and the
+    /// number of requests that were not satisfied as requested.
+    struct usage
+    {
+        size_t standard;
+        size_t transparent;
+        size_t huge_2mb;
+        size_t huge_1gb;
+        size_t page_fallbacks;
+        size_t numa_fallbacks;
+    };
+
+    /// Set the policy of subsequent allocations.
+    static void configure(const policy& value);
+
+    /// The policy of subsequent allocations.
+    static policy configuration();
+
+    /// Allocate memory, page aligned if mapped, throws std::bad_alloc.
+    static void* allocate(size_t size);
+
+    /// Release memory obtained from allocate, of the same size.
+    static void deallocate(void* address, size_t size) noexcept;
+
+    /// The mode of memory obtained from allocate (heap if unknown).
+    static mode page_mode(const void* address);
+
+    /// The name of the mode, as used in metrics.
+    static const char* to_string(mode value);
+
+    /// Bytes currently allocated by mode.
+    static usage current();
+
+    /// Set "pages.<mode>" byte gauges and "pages.fallbacks" gauges, this may
+    /// be added as a metrics sampler for periodic export to statsd.
+    static void publish(log::metrics& metrics);
+};
+
+/// A standard allocator over large pages, for large contiguous tables.
+template <typename Type>
+class large_page_allocator
+{
+public:
+    typedef Type value_type;
+
+    large_page_allocator() noexcept
+    {
+    }
+
+    template <typename Other>
+    large_page_allocator(const large_page_allocator<Other>&) noexcept
+    {
+    }
+
+    Type* allocate(size_t count)
+    {
+        if (count > std::numeric_limits<size_t>::max() / sizeof(Type))
+            throw std::bad_alloc();
+
+        return static_cast<Type*>(large_pages::allocate(count * sizeof(Type)));
+    }
+
+    void deallocate(Type* buffer, size_t count) noexcept
+    {
+        large_pages::deallocate(buffer, count * sizeof(Type));
+    }
+};
+
+template <typename Left, typename Right>
+bool operator==(const large_page_allocator<Left>&,
+    const large_page_allocator<Right>&)
+{
+    return true;
+}
+
+template <typename Left, typename Right>
+bool operator!=(const large_page_allocator<Left>&,
+    const large_page_allocator<Right>&)
+{
+    return false;
+}
+
+} // namespace libbitcoin
+
+#endif
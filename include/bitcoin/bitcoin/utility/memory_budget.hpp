@@ -0,0 +1,128 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_MEMORY_BUDGET_HPP
+#define LIBBITCOIN_MEMORY_BUDGET_HPP
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+
+namespace libbitcoin {
+
+/**
+ * A single memory budget shared by caches. Each enrolled cache is given a
+ * byte limit, its weighted share of the total, on each rebalance. Under
+ * pressure, shrink reduces the caches of lowest priority first until the
+ * requested bytes are released, and the limits are restored by the next
+ * rebalance. A zero total leaves the caches as individually configured.
+ * Handlers are invoked under the lock of the budget, so they must not call
+ * into it. This class is thread safe.
+ */
+class BC_API memory_budget
+  : noncopyable
+{
+public:
+    typedef size_t token;
+
+    /// The bytes in use by the cache.
+    typedef std::function<size_t()> usage_handler;
+
+    /// Limit the cache to the bytes, evicting as necessary.
+    typedef std::function<void(size_t)> resize_handler;
+
+    struct participant
+    {
+        /// The name of the cache, for reporting.
+        std::string name;
+
+        /// The relative share of the total given to the cache.
+        size_t weight;
+
+        /// Caches of lower priority are shrunk first under pressure.
+        size_t priority;
+
+        usage_handler usage;
+        resize_handler resize;
+    };
+
+    struct report
+    {
+        std::string name;
+        size_t limit;
+        size_t usage;
+    };
+
+    typedef std::vector<report> reports;
+
+    /// The budget of the library's process caches (public keys and redeem
+    /// scripts), which are enrolled on first use.
+    static memory_budget& process();
+
+    memory_budget(size_t total_bytes=0);
+
+    /// Enroll the cache and rebalance, the token withdraws it.
+    token enroll(const participant& cache);
+
+    /// Withdraw the cache and rebalance, false if not enrolled.
+    bool withdraw(token cache);
+
+    /// Set the total bytes shared by the caches and rebalance.
+    void set_total(size_t total_bytes);
+
+    /// The total bytes shared by the caches.
+    size_t total() const;
+
+    /// Give each cache its weighted share of the total.
+    void rebalance();
+
+    /// Shrink caches, lowest priority first, to release the bytes in use.
+    /// Returns the bytes released, which is less if all caches are emptied.
+    size_t shrink(size_t bytes);
+
+    /// The sum of the bytes in use by the caches.
+    size_t usage() const;
+
+    /// The limit and usage of each cache, in enrollment order.
+    reports state() const;
+
+private:
+    struct record
+    {
+        participant cache;
+        size_t limit;
+    };
+
+    typedef std::map<token, record> records;
+
+    void rebalance_unlocked();
+
+    size_t total_;
+    token next_;
+    records records_;
+    mutable std::mutex mutex_;
+};
+
+} // namespace libbitcoin
+
+#endif
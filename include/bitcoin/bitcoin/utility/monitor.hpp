@@ -19,46 +19,140 @@
 #ifndef LIBBITCOIN_MONITOR_HPP
 #define LIBBITCOIN_MONITOR_HPP
 
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+#include <bitcoin/bitcoin/utility/trace.hpp>
 
 // libbitcoin defines the log and tracking but does not use them.
 // These are defined in bc so that they can be used in network and blockchain.
 
 namespace libbitcoin {
 
-/// A reference counting wrapper for closures placed on the asio work heap.
+/// Queue depth and latency metrics for closures placed on the asio work heap.
+/// This class is thread safe, each metric is independently atomic.
 class BC_API monitor
+  : noncopyable
 {
 public:
+    typedef std::chrono::steady_clock clock;
+    typedef std::chrono::microseconds duration;
     typedef std::atomic<size_t> count;
-    typedef std::shared_ptr<count> count_ptr;
+    typedef std::shared_ptr<monitor> ptr;
 
-    monitor(count_ptr counter, std::string&& name);
-    virtual ~monitor();
+    /// A log2 histogram of microsecond durations, bucket n counts durations
+    /// of bit length n (bucket zero counts zero), the last is unbounded.
+    class BC_API histogram
+      : noncopyable
+    {
+    public:
+        static BC_CONSTEXPR size_t buckets = 32;
+
+        histogram();
+
+        void record(duration elapsed);
+
+        /// The upper bound of the bucket in microseconds (exclusive).
+        static uint64_t limit(size_t bucket);
+
+        uint64_t bucket(size_t index) const;
+        uint64_t samples() const;
+        duration total() const;
+
+        /// Send the histogram to the statsd source under the name.
+        void publish(const std::string& name) const;
 
+    private:
+        std::array<std::atomic<uint64_t>, buckets> counts_;
+        std::atomic<uint64_t> total_;
+    };
+
+    /// The handler wrapper, counts are shared with the monitor by reference
+    /// counting, so queuing a handler does not allocate.
     template <typename Handler>
-    void invoke(Handler handler) const
+    class tracked
     {
-        ////trace(*counter_, "*");
-        handler();
-    }
+    public:
+        tracked(Handler&& handler, ptr owner)
+          : handler_(std::forward<Handler>(handler)),
+            owner_(owner),
+            enqueued_(clock::now())
+        {
+        }
+
+        template <typename... Args>
+        void operator()(Args&&... args)
+        {
+            BC_TRACE_SPAN("threadpool", owner_->trace_name());
+            const auto start = clock::now();
+            owner_->start(start - enqueued_);
+            handler_(std::forward<Args>(args)...);
+            owner_->stop(clock::now() - start);
+        }
+
+    private:
+        typename std::decay<Handler>::type handler_;
+        ptr owner_;
+        clock::time_point enqueued_;
+    };
+
+    monitor(std::string&& name);
 
-    void trace(size_t, const std::string&) const
+    /// Count the handler into the backlog and wrap it for measurement.
+    /// A handler that is discarded without invocation remains in backlog.
+    template <typename Handler>
+    static tracked<Handler> track(ptr owner, Handler&& handler)
     {
-        ////#ifndef NDEBUG
-        ////    LOG_DEBUG(LOG_SYSTEM)
-        ////        << action << " " << name_ << " {" << count << "}";
-        ////#endif
+        ++owner->backlog_;
+        return tracked<Handler>(std::forward<Handler>(handler), owner);
     }
 
+    // Properties.
+    //-------------------------------------------------------------------------
+
+    const std::string& name() const;
+
+    /// The name as the process-wide string of trace spans, null unless
+    /// compiled with BC_TRACE.
+    const char* trace_name() const;
+
+    /// Handlers queued and not yet started.
+    size_t backlog() const;
+
+    /// Handlers started.
+    uint64_t started() const;
+
+    /// Handlers started and not yet completed.
+    size_t running() const;
+
+    /// Time from queueing to start of execution.
+    const histogram& latency() const;
+
+    /// Time from start to completion of execution.
+    const histogram& runtime() const;
+
+    /// Send the metrics to the statsd source, with names under the prefix.
+    void publish(const std::string& prefix) const;
+
 private:
-    count_ptr counter_;
+    void start(clock::duration waited);
+    void stop(clock::duration elapsed);
+
     const std::string name_;
+    const char* const trace_name_;
+    count backlog_;
+    count running_;
+    std::atomic<uint64_t> started_;
+    histogram latency_;
+    histogram runtime_;
 };
 
 } // namespace libbitcoin
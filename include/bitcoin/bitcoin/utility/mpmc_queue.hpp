@@ -0,0 +1,188 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_MPMC_QUEUE_HPP
+#define LIBBITCOIN_MPMC_QUEUE_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
+
+namespace libbitcoin {
+
+/**
+ * This class is thread safe.
+ * A bounded lock-free queue of multiple producers and multiple consumers, for
+ * handoff between pipeline stages. Each slot carries a sequence number, so
+ * producers and consumers each claim positions with one compare-exchange
+ * (Vyukov), and a batch claims consecutive positions with one. Slots and the
+ * two positions occupy their own cache lines, avoiding false sharing.
+ *
+ * The try_ operations never wait. The blocking operations wait on condition
+ * variables once the queue is full (or empty), which is signaled only when a
+ * waiter is registered, so an unwaited queue takes no lock. A consumer on a
+ * threadpool parks its handler while the queue is empty, holding no thread,
+ * and the handler is posted to the pool once a value is pushed.
+ *
+ * Closing wakes all waiters and fails further pushes, while values already
+ * queued remain poppable. Type must be default constructible and movable.
+ */
+template <class Type>
+class mpmc_queue
+  : noncopyable
+{
+public:
+    typedef std::vector<Type> list;
+    typedef std::function<void(const code&, Type)> handler;
+
+    /// The assumed cache line size, for padding.
+    static BC_CONSTEXPR size_t cache_line = 64;
+
+    /// The capacity is rounded up to a power of two (minimum two).
+    explicit mpmc_queue(size_t capacity);
+
+    /// The queue must not be destroyed with handlers parked, so close first.
+    ~mpmc_queue();
+
+    /// The number of slots in the queue.
+    size_t capacity() const;
+
+    /// The number of queued values, approximate under concurrency.
+    size_t size() const;
+
+    /// True if no value is queued, approximate under concurrency.
+    bool empty() const;
+
+    /// Wake all waiters, fail pushes and parked handlers (service_stopped).
+    void close();
+
+    /// True if the queue has been closed.
+    bool closed() const;
+
+    // Non-blocking.
+    // ------------------------------------------------------------------------
+
+    /// Push the value, false if the queue is full or closed.
+    bool try_push(Type&& value);
+    bool try_push(const Type& value);
+
+    /// Push values in order from the front of the range, with one claim for
+    /// those that fit, returning the number pushed (assigned from *first).
+    template <class Iterator>
+    size_t try_push(Iterator first, Iterator last);
+
+    /// Pop the oldest value, false if the queue is empty.
+    bool try_pop(Type& out);
+
+    /// Append up to maximum of the oldest values, returning the number popped.
+    size_t try_pop(list& out, size_t maximum);
+
+    // Blocking.
+    // ------------------------------------------------------------------------
+
+    /// Push the value, waiting while full, false if closed.
+    bool push(Type&& value);
+    bool push(const Type& value);
+
+    /// Push all values of the range in order, waiting while full, returning
+    /// the number pushed (less than the range only if closed).
+    template <class Iterator>
+    size_t push(Iterator first, Iterator last);
+
+    /// Pop the oldest value, waiting while empty, false if closed and empty.
+    bool pop(Type& out);
+
+    /// Append up to maximum of the oldest values, waiting for at least one,
+    /// returning the number popped (zero only if closed and empty).
+    size_t pop(list& out, size_t maximum);
+
+    // Threadpool.
+    // ------------------------------------------------------------------------
+
+    /// Invoke the handler on the pool with the oldest value, once available.
+    /// The handler is parked while the queue is empty, so no pool thread is
+    /// held or spinning, and is invoked with service_stopped if closed.
+    void pop(threadpool& pool, handler handle);
+
+private:
+    struct slot
+    {
+        std::atomic<size_t> sequence;
+        Type value;
+    };
+
+    // A position alone in its cache line (within an aligned object).
+    struct padded_position
+    {
+        std::atomic<size_t> value;
+        char padding[cache_line - sizeof(std::atomic<size_t>)];
+    };
+
+    struct parked
+    {
+        threadpool* pool;
+        handler handle;
+    };
+
+    static size_t round_up(size_t capacity);
+    static size_t stride();
+    static char* align(char* storage);
+
+    slot& at(size_t position) const;
+    size_t claim_push(size_t maximum, size_t& first);
+    size_t claim_pop(size_t maximum, size_t& first);
+    bool can_push() const;
+    bool can_pop() const;
+    bool wait_push();
+    bool wait_pop();
+    void published(size_t count);
+    void released(size_t count);
+
+    // Producers contend on head, consumers contend on tail.
+    padded_position head_;
+    padded_position tail_;
+
+    const size_t mask_;
+    const std::unique_ptr<char[]> storage_;
+    char* const slots_;
+
+    // Waiters are counted, so that notification takes no lock when none.
+    std::atomic<bool> closed_;
+    std::atomic<size_t> consumers_waiting_;
+    std::atomic<size_t> producers_waiting_;
+
+    // These are protected by mutex.
+    std::deque<parked> parked_;
+    std::condition_variable not_empty_;
+    std::condition_variable not_full_;
+    mutable std::mutex mutex_;
+};
+
+} // namespace libbitcoin
+
+#include <bitcoin/bitcoin/impl/utility/mpmc_queue.ipp>
+
+#endif
@@ -0,0 +1,188 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_ONCE_CELL_HPP
+#define LIBBITCOIN_ONCE_CELL_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <utility>
+
+namespace libbitcoin {
+
+/// A lazily computed value that is set at most once between resets.
+/// Once set, a read is a single acquire load. Concurrent first reads race on
+/// a state flag, one computes and the others yield until it is published.
+/// Reset, assignment and copy from a cell being set are not thread safe,
+/// consistent with the non-concurrent mutation of the owning objects.
+template <typename Type>
+class once_cell
+{
+public:
+    once_cell()
+      : state_(empty)
+    {
+    }
+
+    /// Copy the value if set, otherwise the new cell is empty.
+    once_cell(const once_cell& other)
+      : state_(empty)
+    {
+        if (other.state_.load(std::memory_order_acquire) == ready)
+            set(other.value_);
+    }
+
+    once_cell(once_cell&& other)
+      : state_(empty)
+    {
+        if (other.state_.load(std::memory_order_acquire) == ready)
+            set(std::move(other.value_));
+
+        other.reset();
+    }
+
+    once_cell& operator=(const once_cell& other)
+    {
+        if (this != &other)
+        {
+            reset();
+
+            if (other.state_.load(std::memory_order_acquire) == ready)
+                set(other.value_);
+        }
+
+        return *this;
+    }
+
+    once_cell& operator=(once_cell&& other)
+    {
+        if (this != &other)
+        {
+            reset();
+
+            if (other.state_.load(std::memory_order_acquire) == ready)
+                set(std::move(other.value_));
+
+            other.reset();
+        }
+
+        return *this;
+    }
+
+    /// True if the value is set.
+    operator bool() const
+    {
+        return state_.load(std::memory_order_acquire) == ready;
+    }
+
+    /// The value if set, otherwise nullptr (the value is not computed).
+    const Type* peek() const
+    {
+        return state_.load(std::memory_order_acquire) == ready ? &value_ :
+            nullptr;
+    }
+
+    /// The value, computed by the factory if not set. The reference is
+    /// invalidated by reset, so callers that may race a reset should copy.
+    /// If the factory throws the cell remains empty and the exception is
+    /// propagated, a waiting reader then computes the value.
+    template <typename Factory>
+    const Type& get(Factory factory) const
+    {
+        auto state = state_.load(std::memory_order_acquire);
+
+        while (state != ready)
+        {
+            uint8_t expected = empty;
+
+            if (state_.compare_exchange_strong(expected, busy,
+                std::memory_order_acq_rel))
+            {
+                assign(factory);
+                break;
+            }
+
+            std::this_thread::yield();
+            state = state_.load(std::memory_order_acquire);
+        }
+
+        return value_;
+    }
+
+    /// Set the value if not set, returns false if already set (or setting).
+    template <typename Value>
+    bool set(Value&& value) const
+    {
+        uint8_t expected = empty;
+
+        if (!state_.compare_exchange_strong(expected, busy,
+            std::memory_order_acq_rel))
+            return false;
+
+        const auto factory = [&value]() -> Value&&
+        {
+            return std::forward<Value>(value);
+        };
+
+        assign(factory);
+        return true;
+    }
+
+    /// Clear the value, releasing its resources.
+    void reset() const
+    {
+        if (state_.load(std::memory_order_acquire) == empty)
+            return;
+
+        value_ = Type();
+        state_.store(empty, std::memory_order_release);
+    }
+
+private:
+    // Assign the value of a busy cell, restoring it to empty on exception.
+    template <typename Factory>
+    void assign(Factory& factory) const
+    {
+        try
+        {
+            value_ = factory();
+        }
+        catch (...)
+        {
+            state_.store(empty, std::memory_order_release);
+            throw;
+        }
+
+        state_.store(ready, std::memory_order_release);
+    }
+
+    enum : uint8_t
+    {
+        empty,
+        busy,
+        ready
+    };
+
+    mutable std::atomic<uint8_t> state_;
+    mutable Type value_;
+};
+
+} // namespace libbitcoin
+
+#endif
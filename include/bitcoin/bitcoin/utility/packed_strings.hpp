@@ -0,0 +1,103 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_PACKED_STRINGS_HPP
+#define LIBBITCOIN_PACKED_STRINGS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+namespace libbitcoin {
+
+/**
+ * A constant array of Size strings packed into one character array, each
+ * null terminated and located by its offset into the array. Unlike an array
+ * of pointers to literals both arrays are plain constant data, so a shared
+ * library requires no relocation (or private page) for them as it loads.
+ * This is an aggregate, so that it is constant-initialized, for example:
+ * static const char words[] = "a\0" "b\0";
+ * static const uint16_t offsets[2] = { 0, 2 };
+ * const packed_strings<2> list{ words, offsets };
+ */
+template <size_t Size>
+struct packed_strings
+{
+    /// A random access iterator over the strings.
+    class const_iterator
+    {
+    public:
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef const char* value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const value_type* pointer;
+        typedef value_type reference;
+
+        const_iterator(const char* strings, const uint16_t* offset);
+
+        reference operator*() const;
+        reference operator[](difference_type distance) const;
+
+        const_iterator& operator++();
+        const_iterator operator++(int);
+        const_iterator& operator--();
+        const_iterator operator--(int);
+        const_iterator& operator+=(difference_type distance);
+        const_iterator& operator-=(difference_type distance);
+        const_iterator operator+(difference_type distance) const;
+        const_iterator operator-(difference_type distance) const;
+        difference_type operator-(const const_iterator& other) const;
+
+        bool operator==(const const_iterator& other) const;
+        bool operator!=(const const_iterator& other) const;
+        bool operator<(const const_iterator& other) const;
+        bool operator>(const const_iterator& other) const;
+        bool operator<=(const const_iterator& other) const;
+        bool operator>=(const const_iterator& other) const;
+
+    private:
+        const char* strings_;
+        const uint16_t* offset_;
+    };
+
+    typedef const char* value_type;
+    typedef const_iterator iterator;
+
+    /// The string at the position, which must be less than Size.
+    const char* operator[](size_t position) const;
+
+    const_iterator begin() const;
+    const_iterator end() const;
+    size_t size() const;
+
+    /// Equal if each string is equal.
+    bool operator==(const packed_strings& other) const;
+    bool operator!=(const packed_strings& other) const;
+
+    /// The packed strings, at most 64KiB.
+    const char* strings;
+
+    /// The offset of each string in strings.
+    const uint16_t* offsets;
+};
+
+} // namespace libbitcoin
+
+#include <bitcoin/bitcoin/impl/utility/packed_strings.ipp>
+
+#endif
@@ -0,0 +1,56 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_PARALLEL_HPP
+#define LIBBITCOIN_PARALLEL_HPP
+
+#include <cstddef>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
+
+namespace libbitcoin {
+
+/**
+ * Invoke function(index), returning a code, for each index in [0, count).
+ * Chunks of grain indexes are claimed in order by the calling thread and by
+ * up to pool.size() pool jobs, so this does not deadlock when invoked from a
+ * pool thread. Claiming stops upon failure, but all indexes preceding the
+ * failure complete before return. The result is therefore the code of the
+ * failure at the least index (or the exception thrown at the least index is
+ * rethrown), as with serial execution. The function must be thread safe.
+ * Without pool threads or more than one chunk the loop is serial.
+ */
+template <typename Function>
+code parallel_for(threadpool& pool, size_t count, size_t grain,
+    Function&& function);
+
+/**
+ * Reduce map(index) for each index in [0, count) with combine(left, right),
+ * starting from identity. Each chunk of grain indexes is reduced in order
+ * and chunk results are combined in order, so combine must be associative
+ * but need not be commutative. Exceptions propagate as in parallel_for.
+ */
+template <typename Value, typename Map, typename Combine>
+Value parallel_reduce(threadpool& pool, size_t count, size_t grain,
+    const Value& identity, Map&& map, Combine&& combine);
+
+} // namespace libbitcoin
+
+#include <bitcoin/bitcoin/impl/utility/parallel.ipp>
+
+#endif
@@ -21,6 +21,7 @@
 
 #include <cstdint>
 #include <istream>
+#include <ostream>
 #include <bitcoin/bitcoin/compat.hpp>
 #include <bitcoin/bitcoin/define.hpp>
 #include <bitcoin/bitcoin/utility/color.hpp>
@@ -86,6 +87,58 @@ public:
         const color& background, std::ostream& out);
 };
 
+/**
+ * This class is not thread safe.
+ * Writes encoded qrcodes as png images, each row passed to libpng as it is
+ * formed and the compressed image written to the stream as it is produced.
+ * Row and module buffers are retained across images, so one writer should be
+ * reused to render many codes with the same settings.
+ */
+class BC_API png_writer
+{
+public:
+    /// Leaves the libpng default of a compression setting in effect.
+    static BC_CONSTEXPR int32_t default_setting = -1;
+
+    struct BC_API options
+    {
+        /// The png defaults at the size (dots per module), and the libpng
+        /// compression defaults.
+        options(uint32_t size);
+
+        uint32_t size;
+        uint32_t dots_per_inch;
+        uint32_t margin;
+        uint32_t inches_per_meter;
+        color foreground;
+        color background;
+
+        /// The zlib level, from 0 (stored) to 9 (smallest).
+        int32_t level;
+
+        /// A mask of the PNG_FILTER_NONE...PNG_FILTER_PAETH row filters.
+        int32_t filters;
+
+        /// The zlib strategy, such as Z_FILTERED, Z_RLE or Z_HUFFMAN_ONLY.
+        int32_t strategy;
+    };
+
+    png_writer(const options& settings);
+
+    /// Write the encoded qrcode (as from qr::encode) as png to the stream.
+    bool write(const data_chunk& qrcode, std::ostream& out);
+
+    /// Read the encoded qrcode from the stream and write it as png.
+    bool write(std::istream& in, std::ostream& out);
+
+private:
+    bool write(const uint8_t* modules, uint32_t width, std::ostream& out);
+
+    const options options_;
+    data_chunk modules_;
+    data_chunk row_;
+};
+
 } // namespace libbitcoin
 
 #endif // WITH_PNG
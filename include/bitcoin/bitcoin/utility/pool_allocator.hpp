@@ -0,0 +1,111 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_POOL_ALLOCATOR_HPP
+#define LIBBITCOIN_POOL_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <bitcoin/bitcoin/define.hpp>
+
+namespace libbitcoin {
+
+/// Thread-caching pool of small buffers by size class. The classes are tuned
+/// to common script and element sizes (20, 25, 33, 34 and 72 bytes). Larger
+/// buffers are allocated from the heap. A buffer released on another thread
+/// is retained by that thread, up to depth buffers per class.
+class BC_API chunk_pool
+{
+public:
+    static BC_CONSTEXPR size_t classes = 9;
+    static BC_CONSTEXPR size_t maximum = 128;
+    static BC_CONSTEXPR size_t depth = 1024;
+
+    /// The size class of a buffer size, classes if not pooled.
+    static size_t size_class(size_t size);
+
+    /// The buffer size of a size class.
+    static size_t class_size(size_t index);
+
+    static void* allocate(size_t size);
+    static void deallocate(void* buffer, size_t size) noexcept;
+
+private:
+    struct node
+    {
+        node* next;
+    };
+
+    struct lists
+    {
+        ~lists();
+        node* heads[classes] = {};
+        size_t sizes[classes] = {};
+    };
+
+    static lists& local();
+};
+
+/// A standard allocator over the chunk pool, for byte containers that are
+/// frequently created and destroyed (e.g. scripts and witness elements).
+template <typename Type>
+class pool_allocator
+{
+public:
+    typedef Type value_type;
+
+    pool_allocator() noexcept
+    {
+    }
+
+    template <typename Other>
+    pool_allocator(const pool_allocator<Other>&) noexcept
+    {
+    }
+
+    Type* allocate(size_t count)
+    {
+        if (count > std::numeric_limits<size_t>::max() / sizeof(Type))
+            throw std::bad_alloc();
+
+        return static_cast<Type*>(chunk_pool::allocate(count * sizeof(Type)));
+    }
+
+    void deallocate(Type* buffer, size_t count) noexcept
+    {
+        chunk_pool::deallocate(buffer, count * sizeof(Type));
+    }
+};
+
+template <typename Left, typename Right>
+bool operator==(const pool_allocator<Left>&, const pool_allocator<Right>&)
+{
+    return true;
+}
+
+template <typename Left, typename Right>
+bool operator!=(const pool_allocator<Left>&, const pool_allocator<Right>&)
+{
+    return false;
+}
+
+} // namespace libbitcoin
+
+#endif
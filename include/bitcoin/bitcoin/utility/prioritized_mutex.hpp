@@ -19,8 +19,14 @@
 #ifndef LIBBITCOIN_PRIORITIZED_MUTEX_HPP
 #define LIBBITCOIN_PRIORITIZED_MUTEX_HPP
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <string>
 #include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/utility/monitor.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
 #include <bitcoin/bitcoin/utility/thread.hpp>
 
 namespace libbitcoin {
@@ -29,11 +35,56 @@ namespace libbitcoin {
 /// Encapsulation of prioritized locking conditions.
 /// This is unconcerned with thread priority and is instead explicit.
 class BC_API prioritized_mutex
+  : noncopyable
 {
 public:
     typedef std::shared_ptr<prioritized_mutex> ptr;
 
-    prioritized_mutex(bool prioritize=true);
+    /// Acquisition metrics of one priority, each independently atomic.
+    class BC_API contention
+      : noncopyable
+    {
+    public:
+        contention();
+
+        /// Locks acquired.
+        uint64_t acquisitions() const;
+
+        /// Locks not acquired on the first attempt.
+        uint64_t contended() const;
+
+        /// High priority locks acquired while this priority was waiting.
+        uint64_t preemptions() const;
+
+        /// Time from the lock request to acquisition.
+        const monitor::histogram& wait() const;
+
+        /// Time from acquisition to release.
+        const monitor::histogram& hold() const;
+
+        /// Send the metrics to the statsd source under the name.
+        void publish(const std::string& name) const;
+
+    private:
+        friend class prioritized_mutex;
+
+        std::atomic<uint64_t> acquisitions_;
+        std::atomic<uint64_t> contended_;
+        std::atomic<uint64_t> preemptions_;
+        monitor::histogram wait_;
+        monitor::histogram hold_;
+    };
+
+    /**
+     * Construct a mutex.
+     * @param[in]  prioritize   Give high priority locks precedence.
+     * @param[in]  instrument   Record contention metrics of each priority.
+     * @param[in]  spin_limit   The most attempts to acquire without parking,
+     *                          adapted to recent contention, zero parks at
+     *                          the first failure.
+     */
+    prioritized_mutex(bool prioritize=true, bool instrument=false,
+        size_t spin_limit=0);
 
     void lock_low_priority();
     void unlock_low_priority();
@@ -41,11 +92,35 @@ public:
     void lock_high_priority();
     void unlock_high_priority();
 
+    /// Contention metrics, recorded only if instrumented.
+    const contention& low_priority() const;
+    const contention& high_priority() const;
+
+    /// Send the metrics of each priority to the statsd source.
+    void publish(const std::string& prefix) const;
+
 private:
+    typedef monitor::clock clock;
+
+    bool acquire(shared_mutex& mutex);
+    void acquired(contention& metrics, clock::time_point requested,
+        bool contended);
+    void released(contention& metrics);
+
+    // These are thread safe.
     const bool prioritize_;
+    const bool instrument_;
+    const size_t spin_limit_;
+    std::atomic<size_t> spins_;
+    std::atomic<size_t> low_waiting_;
+    contention low_;
+    contention high_;
     shared_mutex data_mutex_;
     shared_mutex next_mutex_;
     shared_mutex wait_mutex_;
+
+    // This is protected by data_mutex_.
+    clock::time_point held_since_;
 };
 
 } // namespace libbitcoin
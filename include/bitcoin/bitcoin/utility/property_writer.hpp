@@ -0,0 +1,162 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_PROPERTY_WRITER_HPP
+#define LIBBITCOIN_PROPERTY_WRITER_HPP
+
+#include <vector>
+#include <bitcoin/bitcoin/chain/input.hpp>
+#include <bitcoin/bitcoin/chain/output.hpp>
+#include <bitcoin/bitcoin/chain/points_value.hpp>
+#include <bitcoin/bitcoin/config/header.hpp>
+#include <bitcoin/bitcoin/config/input.hpp>
+#include <bitcoin/bitcoin/config/transaction.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/utility/tree_writer.hpp>
+
+namespace libbitcoin {
+
+// These stream the schema of the corresponding property_list and
+// property_tree functions (utility/property_tree.hpp) to a tree_writer, with
+// no intermediate tree. With json_writer the output matches compact
+// write_json output of the property tree.
+
+/**
+ * Write a property list for a block header.
+ * @param[in]  out     The writer.
+ * @param[in]  header  The header.
+ */
+BC_API void property_list(tree_writer& out, const config::header& header);
+
+/**
+ * Write a property tree for a block header.
+ * @param[in]  out     The writer.
+ * @param[in]  header  The header.
+ */
+BC_API void property_tree(tree_writer& out, const config::header& header);
+
+/**
+ * Write a property tree for a set of headers.
+ * @param[in]  out      The writer.
+ * @param[in]  headers  The set of headers.
+ * @param[in]  json     Use json array formatting.
+ */
+BC_API void property_tree(tree_writer& out,
+    const std::vector<config::header>& headers, bool json);
+
+/**
+ * Write a property list for a transaction input.
+ * @param[in]  out       The writer.
+ * @param[in]  tx_input  The input.
+ */
+BC_API void property_list(tree_writer& out, const chain::input& tx_input);
+
+/**
+ * Write a property tree for a transaction input.
+ * @param[in]  out       The writer.
+ * @param[in]  tx_input  The input.
+ */
+BC_API void property_tree(tree_writer& out, const chain::input& tx_input);
+
+/**
+ * Write a property tree for a set of transaction inputs.
+ * @param[in]  out        The writer.
+ * @param[in]  tx_inputs  The set of transaction inputs.
+ * @param[in]  json       Use json array formatting.
+ */
+BC_API void property_tree(tree_writer& out, const chain::input::list& tx_inputs,
+    bool json);
+
+/**
+ * Write a property tree for a set of inputs.
+ * @param[in]  out     The writer.
+ * @param[in]  inputs  The set of inputs.
+ * @param[in]  json    Use json array formatting.
+ */
+BC_API void property_tree(tree_writer& out,
+    const std::vector<config::input>& inputs, bool json);
+
+/**
+ * Write a property list for a transaction output.
+ * @param[in]  out        The writer.
+ * @param[in]  tx_output  The transaction output.
+ */
+BC_API void property_list(tree_writer& out, const chain::output& tx_output);
+
+/**
+ * Write a property tree for a transaction output.
+ * @param[in]  out        The writer.
+ * @param[in]  tx_output  The transaction output.
+ */
+BC_API void property_tree(tree_writer& out, const chain::output& tx_output);
+
+/**
+ * Write a property tree for a set of transaction outputs.
+ * @param[in]  out         The writer.
+ * @param[in]  tx_outputs  The set of transaction outputs.
+ * @param[in]  json        Use json array formatting.
+ */
+BC_API void property_tree(tree_writer& out,
+    const chain::output::list& tx_outputs, bool json);
+
+/**
+ * Write a property list for a point value.
+ * @param[in]  out    The writer.
+ * @param[in]  point  The point value.
+ */
+BC_API void property_list(tree_writer& out, const chain::point_value& point);
+
+/**
+ * Write a property tree for points value.
+ * @param[in]  out     The writer.
+ * @param[in]  values  The points value.
+ * @param[in]  json    Use json array formatting.
+ */
+BC_API void property_tree(tree_writer& out, const chain::points_value& values,
+    bool json);
+
+/**
+ * Write a property list for a transaction.
+ * @param[in]  out          The writer.
+ * @param[in]  transaction  The transaction.
+ * @param[in]  json         Use json array formatting.
+ */
+BC_API void property_list(tree_writer& out,
+    const config::transaction& transaction, bool json);
+
+/**
+ * Write a property tree for a transaction.
+ * @param[in]  out          The writer.
+ * @param[in]  transaction  The transaction.
+ * @param[in]  json         Use json array formatting.
+ */
+BC_API void property_tree(tree_writer& out,
+    const config::transaction& transaction, bool json);
+
+/**
+ * Write a property tree for a set of transactions.
+ * @param[in]  out           The writer.
+ * @param[in]  transactions  The set of transactions.
+ * @param[in]  json          Use json array formatting.
+ */
+BC_API void property_tree(tree_writer& out,
+    const std::vector<config::transaction>& transactions, bool json);
+
+} // namespace libbitcoin
+
+#endif
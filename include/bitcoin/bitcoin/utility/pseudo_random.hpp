@@ -19,7 +19,8 @@
 #ifndef LIBBITCOIN_PSEUDO_RANDOM_HPP
 #define LIBBITCOIN_PSEUDO_RANDOM_HPP
 
-#include <random>
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <bitcoin/bitcoin/constants.hpp>
 #include <bitcoin/bitcoin/define.hpp>
@@ -28,34 +29,84 @@
 
 namespace libbitcoin {
 
+/**
+ * The xoshiro256** generator of Blackman and Vigna, a fast non-cryptographic
+ * engine with 32 bytes of state, satisfying UniformRandomBitGenerator.
+ */
+class BC_API xoshiro256
+{
+public:
+    typedef uint64_t result_type;
+
+    static BC_CONSTEXPR result_type min()
+    {
+        return 0;
+    }
+
+    static BC_CONSTEXPR result_type max()
+    {
+        return max_uint64;
+    }
+
+    /// The state is expanded from the seed by splitmix64.
+    explicit xoshiro256(uint64_t seed);
+
+    result_type operator()()
+    {
+        const auto result = rotate(state_[1] * 5, 7) * 9;
+        const auto shifted = state_[1] << 17;
+
+        state_[2] ^= state_[0];
+        state_[3] ^= state_[1];
+        state_[1] ^= state_[2];
+        state_[0] ^= state_[3];
+        state_[2] ^= shifted;
+        state_[3] = rotate(state_[3], 45);
+        return result;
+    }
+
+private:
+    static uint64_t rotate(uint64_t value, int bits)
+    {
+        return (value << bits) | (value >> (64 - bits));
+    }
+
+    uint64_t state_[4];
+};
+
 class BC_API pseudo_random
 {
   public:
     /**
-     * Fill a container with randomness using the default random engine.
+     * Fill a container of bytes with randomness from the thread engine,
+     * eight bytes per generated word.
      */
     template<class Container>
     static void fill(Container& out)
     {
-        // uniform_int_distribution is undefined for sizes < 16 bits.
-        std::uniform_int_distribution<uint16_t> distribution(0, max_uint8);
-        auto& twister = pseudo_random::get_twister();
+        auto& engine = get_engine();
+        auto it = out.begin();
+        const auto end = out.end();
 
-        const auto fill = [&distribution, &twister](uint8_t)
+        while (it != end)
         {
-            return static_cast<uint8_t>(distribution(twister));
-        };
-
-        std::transform(out.begin(), out.end(), out.begin(), fill);
+            auto word = engine();
+
+            for (size_t byte = 0; byte < sizeof(word) && it != end; ++byte)
+            {
+                *it++ = static_cast<uint8_t>(word);
+                word >>= 8;
+            }
+        }
     }
 
     /**
-     * Shuffle a container using the default random engine.
+     * Shuffle a container using the thread engine.
      */
     template<class Container>
     static void shuffle(Container& out)
     {
-        std::shuffle(out.begin(), out.end(), get_twister());
+        std::shuffle(out.begin(), out.end(), get_engine());
     }
 
     /**
@@ -80,8 +131,11 @@ class BC_API pseudo_random
     static asio::duration duration(const asio::duration& maximum,
         uint8_t ratio=2);
 
-  private:
-    static std::mt19937& get_twister();
+    /**
+     * The engine of the calling thread, seeded on first use by the thread.
+     * This is not thread safe, the engine must not be shared with threads.
+     */
+    static xoshiro256& get_engine();
 };
 
 /**
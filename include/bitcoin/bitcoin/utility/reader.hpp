@@ -22,6 +22,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <string>
+#include <bitcoin/bitcoin/compat.hpp>
 #include <bitcoin/bitcoin/error.hpp>
 #include <bitcoin/bitcoin/utility/data.hpp>
 #include <bitcoin/bitcoin/math/hash.hpp>
@@ -38,6 +39,14 @@ public:
     virtual bool is_exhausted() const = 0;
     virtual void invalidate() = 0;
 
+    /// The number of bytes that may yet be read, or max_size_t if the size
+    /// of the source is unknown (as with a stream) or unchecked. Unknown by
+    /// default, which does not bound read_count.
+    virtual size_t remaining() const
+    {
+        return BC_MAX_SIZE;
+    }
+
     /// Read hashes.
     virtual hash_digest read_hash() = 0;
     virtual short_hash read_short_hash() = 0;
@@ -58,6 +67,36 @@ public:
     virtual uint64_t read_variable_little_endian() = 0;
     virtual size_t read_size_little_endian() = 0;
 
+    /// Read base 128 integer, most significant group first.
+    /// Each continued group is stored less one, so each value has one form.
+    virtual uint64_t read_variable_base128()
+    {
+        uint64_t value = 0;
+
+        while (true)
+        {
+            if (is_exhausted() || value > (MAX_UINT64 >> 7))
+            {
+                invalidate();
+                return 0;
+            }
+
+            const auto byte = read_byte();
+            value = (value << 7) | (byte & 0x7f);
+
+            if ((byte & 0x80) == 0)
+                return value;
+
+            if (value == MAX_UINT64)
+            {
+                invalidate();
+                return 0;
+            }
+
+            ++value;
+        }
+    }
+
     /// Read/peek one byte.
     virtual uint8_t peek_byte() = 0;
     virtual uint8_t read_byte() = 0;
@@ -68,6 +107,13 @@ public:
     /// Read required size buffer.
     virtual data_chunk read_bytes(size_t size) = 0;
 
+    /// Read required size buffer into out, reusing its capacity where the
+    /// reader supports it (by default the buffer is replaced).
+    virtual void read_bytes(data_chunk& out, size_t size)
+    {
+        out = read_bytes(size);
+    }
+
     /// Read variable length string.
     virtual std::string read_string() = 0;
 
@@ -78,6 +124,24 @@ public:
     virtual void skip(size_t size) = 0;
 };
 
+/// Read the count prefix of a collection of elements, each of which
+/// consumes at least the minimum size. The source is invalidated and zero
+/// returned if the count exceeds the maximum, or if the elements cannot fit
+/// in the remaining bytes. This guards allocation for the collection before
+/// its elements are read, so a short message cannot cause a large one.
+inline size_t read_count(reader& source, size_t minimum_size, size_t maximum)
+{
+    const auto count = source.read_size_little_endian();
+
+    if (count > maximum || count > source.remaining() / minimum_size)
+    {
+        source.invalidate();
+        return 0;
+    }
+
+    return count;
+}
+
 } // namespace libbitcoin
 
 #endif
@@ -0,0 +1,62 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_RELAY_QUEUE_HPP
+#define LIBBITCOIN_RELAY_QUEUE_HPP
+
+#include <tuple>
+#include <type_traits>
+#include <vector>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+#include <bitcoin/bitcoin/utility/thread.hpp>
+
+namespace libbitcoin {
+
+/// This class is thread safe.
+/// Queues notification arguments for relay, so that a burst of notifications
+/// is delivered in order by one pool job rather than by a job per relay.
+template <typename... Args>
+class relay_queue
+  : noncopyable
+{
+public:
+    relay_queue();
+
+    /// Queue the arguments, true if the caller must schedule a drain.
+    bool push(Args... args);
+
+    /// Invoke the handler with each queued set of arguments in order, until
+    /// the queue is empty. Arguments pushed during the drain are included.
+    template <typename Handler>
+    void drain(Handler&& handler);
+
+private:
+    typedef std::tuple<typename std::decay<Args>::type...> arguments;
+    typedef std::vector<arguments> list;
+
+    // These are protected by mutex.
+    list pending_;
+    bool draining_;
+    mutable shared_mutex mutex_;
+};
+
+} // namespace libbitcoin
+
+#include <bitcoin/bitcoin/impl/utility/relay_queue.ipp>
+
+#endif
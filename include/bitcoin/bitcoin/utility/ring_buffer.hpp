@@ -0,0 +1,81 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_RING_BUFFER_HPP
+#define LIBBITCOIN_RING_BUFFER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+
+namespace libbitcoin {
+
+/**
+ * A bounded lock-free queue of multiple producers and a single consumer.
+ * Push is thread safe, pop and empty must be called only by the consumer.
+ * Each slot carries a sequence number, so producers claim slots with a single
+ * compare-exchange and the consumer never contends with them (Vyukov).
+ * Type must be default constructible and move assignable.
+ */
+template <class Type>
+class ring_buffer
+  : noncopyable
+{
+public:
+    /// The capacity is rounded up to a power of two (minimum two).
+    explicit ring_buffer(size_t capacity);
+
+    /// The number of slots in the buffer.
+    size_t capacity() const;
+
+    /// Push the value, false if the buffer is full (thread safe).
+    bool push(Type&& value);
+    bool push(const Type& value);
+
+    /// Pop the oldest value, false if the buffer is empty (consumer only).
+    bool pop(Type& out);
+
+    /// True if there is no value to pop (consumer only).
+    bool empty() const;
+
+private:
+    struct slot
+    {
+        std::atomic<size_t> sequence;
+        Type value;
+    };
+
+    static size_t round_up(size_t capacity);
+
+    template <class Value>
+    bool enqueue(Value&& value);
+
+    const size_t mask_;
+    const std::unique_ptr<slot[]> slots_;
+
+    // Producers contend on head, only the consumer moves tail.
+    std::atomic<size_t> head_;
+    std::atomic<size_t> tail_;
+};
+
+} // namespace libbitcoin
+
+#include <bitcoin/bitcoin/impl/utility/ring_buffer.ipp>
+
+#endif
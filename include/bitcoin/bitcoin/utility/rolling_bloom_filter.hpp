@@ -0,0 +1,88 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_ROLLING_BLOOM_FILTER_HPP
+#define LIBBITCOIN_ROLLING_BLOOM_FILTER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/math/siphash.hpp>
+#include <bitcoin/bitcoin/message/inventory.hpp>
+#include <bitcoin/bitcoin/message/inventory_vector.hpp>
+
+namespace libbitcoin {
+
+/**
+ * This class is not thread safe.
+ * A bloom filter of the most recent hashes, in fixed memory. Hashes are
+ * inserted in generations of half the capacity, and each bit position holds
+ * the two bit number (1 to 3) of the generation that last set it. Starting
+ * a fourth generation clears the positions of the oldest, so that at least
+ * the capacity of most recent hashes is retained. Positions are derived
+ * from one SipHash-1-3 of the hash under a random key of the filter, so a
+ * peer cannot construct hashes that collide in the filters of others.
+ */
+class BC_API rolling_bloom_filter
+{
+public:
+    /// A filter retaining at least the capacity of most recent hashes, with
+    /// the false positive rate (0 < rate < 1) for a filter at capacity.
+    rolling_bloom_filter(size_t capacity, double false_positive_rate);
+
+    /// Insert the hash, starting a new generation if the current is full.
+    void insert(const hash_digest& hash);
+
+    /// Insert the hash of each inventory vector.
+    void insert(const message::inventory& inventory);
+
+    /// True if the hash may have been inserted (subject to false positives
+    /// and to the loss of older generations).
+    bool contains(const hash_digest& hash) const;
+    bool contains(const message::inventory_vector& inventory) const;
+
+    /// The inventory vectors that are not contained, in order.
+    message::inventory_vector::list unknown(
+        const message::inventory& inventory) const;
+
+    /// Remove all hashes, drawing a new key.
+    void clear();
+
+    /// The number of hash functions.
+    size_t hash_functions() const;
+
+    /// The number of bytes of the filter.
+    size_t allocated() const;
+
+private:
+    uint64_t to_hash(const hash_digest& hash) const;
+    void advance();
+
+    const size_t generation_size_;
+    const size_t hash_functions_;
+    std::vector<uint64_t> words_;
+    siphash_key key_;
+    size_t inserted_;
+    uint32_t generation_;
+};
+
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,85 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SECURE_ALLOCATOR_HPP
+#define LIBBITCOIN_SECURE_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <bitcoin/bitcoin/define.hpp>
+
+namespace libbitcoin {
+
+/// Overwrite the buffer with zeros, not elided by the optimizer.
+inline void zeroize(void* buffer, size_t size)
+{
+    volatile auto bytes = static_cast<volatile uint8_t*>(buffer);
+
+    while (size-- != 0)
+        *bytes++ = 0;
+}
+
+/// A standard allocator that zeroizes buffers on release, for containers of
+/// key material. Buffers are not pooled, so are never shared with other use.
+template <typename Type>
+class secure_allocator
+{
+public:
+    typedef Type value_type;
+
+    secure_allocator() noexcept
+    {
+    }
+
+    template <typename Other>
+    secure_allocator(const secure_allocator<Other>&) noexcept
+    {
+    }
+
+    Type* allocate(size_t count)
+    {
+        if (count > std::numeric_limits<size_t>::max() / sizeof(Type))
+            throw std::bad_alloc();
+
+        return static_cast<Type*>(::operator new(count * sizeof(Type)));
+    }
+
+    void deallocate(Type* buffer, size_t count) noexcept
+    {
+        zeroize(buffer, count * sizeof(Type));
+        ::operator delete(buffer);
+    }
+};
+
+template <typename Left, typename Right>
+bool operator==(const secure_allocator<Left>&, const secure_allocator<Right>&)
+{
+    return true;
+}
+
+template <typename Left, typename Right>
+bool operator!=(const secure_allocator<Left>&, const secure_allocator<Right>&)
+{
+    return false;
+}
+
+} // namespace libbitcoin
+
+#endif
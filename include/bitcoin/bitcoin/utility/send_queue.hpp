@@ -0,0 +1,134 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SEND_QUEUE_HPP
+#define LIBBITCOIN_SEND_QUEUE_HPP
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/utility/asio.hpp>
+#include <bitcoin/bitcoin/utility/deadline.hpp>
+#include <bitcoin/bitcoin/utility/enable_shared_from_base.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+#include <bitcoin/bitcoin/utility/socket.hpp>
+#include <bitcoin/bitcoin/utility/thread.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
+
+namespace libbitcoin {
+
+/**
+ * This class is thread safe.
+ * An outbound queue for a socket, which gathers the buffers of all pending
+ * messages into a single write, so that a burst of small messages costs one
+ * system call rather than one each. Buffers are not copied, each is retained
+ * by its shared storage until its write completes. At most one write is
+ * outstanding on the socket, messages sent during a write form the next.
+ */
+class BC_API send_queue
+  : public enable_shared_from_base<send_queue>,
+    noncopyable
+{
+public:
+    typedef std::shared_ptr<send_queue> ptr;
+    typedef std::function<void(const code&)> handler;
+    typedef std::shared_ptr<const void> storage_ptr;
+    typedef boost::asio::const_buffer buffer;
+
+    struct policy
+    {
+        /// Messages are held until this many bytes are pending, zero writes
+        /// each message as soon as the socket is idle.
+        size_t cork_bytes = 0;
+
+        /// The longest that a message is held below the cork size.
+        asio::duration cork_latency = asio::milliseconds(0);
+
+        /// Disable coalescing by the stack (TCP_NODELAY).
+        bool no_delay = true;
+
+        /// Cork the socket for the duration of each write (TCP_CORK), where
+        /// the platform supports it.
+        bool tcp_cork = false;
+    };
+
+    /// Construct a queue that writes each message when the socket is idle.
+    send_queue(threadpool& pool, socket::ptr socket);
+
+    /// Construct a queue with the given coalescing policy.
+    send_queue(threadpool& pool, socket::ptr socket, const policy& policy);
+
+    /// Queue a message, the handler is invoked once it has been written.
+    void send(const buffer& message, storage_ptr storage, handler handle);
+
+    /// Queue a message as heading and payload, such as a raw message.
+    void send(const buffer& heading, const buffer& payload,
+        storage_ptr storage, handler handle);
+
+    /// Write pending messages without waiting for the cork.
+    void flush();
+
+    /// Fail pending messages, an outstanding write completes (or fails).
+    void stop();
+
+    /// The number of bytes pending, excluding an outstanding write.
+    size_t pending_bytes() const;
+
+    /// The number of writes started, each of one or more messages.
+    size_t writes() const;
+
+private:
+    struct entry
+    {
+        buffer heading;
+        buffer payload;
+        storage_ptr storage;
+        handler handle;
+    };
+
+    typedef std::vector<entry> entries;
+
+    static void notify(const entries& list, const code& ec);
+
+    void write();
+    void handle_cork(const code& ec);
+    void handle_write(const boost_code& ec, size_t size);
+
+    // These are thread safe.
+    const socket::ptr socket_;
+    const policy policy_;
+    const deadline::ptr timer_;
+
+    // These are protected by mutex.
+    entries pending_;
+    entries writing_;
+    std::vector<buffer> buffers_;
+    size_t pending_bytes_;
+    size_t writes_;
+    bool configured_;
+    bool armed_;
+    bool stopped_;
+    mutable shared_mutex mutex_;
+};
+
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SEQLOCKED_HPP
+#define LIBBITCOIN_SEQLOCKED_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+#include <bitcoin/bitcoin/utility/sequential_lock.hpp>
+#include <bitcoin/bitcoin/utility/thread.hpp>
+
+namespace libbitcoin {
+
+/// This class is thread safe.
+/// A trivially copyable value guarded by a sequential lock. Readers copy the
+/// value and retry if a write intervened, so a read never takes a lock and
+/// never blocks a writer. Writers are serialized by a mutex. The value is
+/// held as atomic words, so a torn copy is discarded rather than undefined.
+template <typename Type>
+class seqlocked
+  : noncopyable
+{
+public:
+    static_assert(std::is_trivially_copyable<Type>::value,
+        "seqlocked requires a trivially copyable type.");
+
+    /// Construct with a value initialized value.
+    seqlocked();
+
+    /// Construct with the given value.
+    explicit seqlocked(const Type& value);
+
+    /// A consistent copy of the value, retrying while a write intervenes.
+    Type load() const;
+
+    /// A single read attempt, false if a write intervened.
+    bool try_load(Type& out_value) const;
+
+    /// Replace the value.
+    void store(const Type& value);
+
+private:
+    static BC_CONSTEXPR size_t words = (sizeof(Type) + sizeof(uint64_t) - 1) /
+        sizeof(uint64_t);
+
+    typedef std::array<uint64_t, words> buffer;
+
+    void read(buffer& out) const;
+    void write(const buffer& in);
+
+    // These are thread safe.
+    sequential_lock sequence_;
+    std::array<std::atomic<uint64_t>, words> value_;
+
+    // This is used only by writers.
+    shared_mutex mutex_;
+};
+
+} // namespace libbitcoin
+
+#include <bitcoin/bitcoin/impl/utility/seqlocked.ipp>
+
+#endif
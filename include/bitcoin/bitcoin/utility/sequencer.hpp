@@ -19,16 +19,19 @@
 #ifndef LIBBITCOIN_SEQUENCER_HPP
 #define LIBBITCOIN_SEQUENCER_HPP
 
+#include <atomic>
+#include <cstddef>
 #include <functional>
 #include <memory>
-#include <queue>
 #include <bitcoin/bitcoin/utility/asio.hpp>
 #include <bitcoin/bitcoin/utility/enable_shared_from_base.hpp>
-#include <bitcoin/bitcoin/utility/thread.hpp>
 ////#include <bitcoin/bitcoin/utility/track.hpp>
 
 namespace libbitcoin {
 
+/// This class is thread safe and lock free.
+/// Actions are queued on a multiple producer single consumer list, and the
+/// count of locked actions determines the one thread that dequeues the next.
 class sequencer
   : public enable_shared_from_base<sequencer>
     /*, track<sequencer>*/
@@ -37,20 +40,44 @@ public:
     typedef std::shared_ptr<sequencer> ptr;
     typedef std::function<void()> action;
 
+    /// Each action is posted to the service.
     sequencer(asio::service& service);
+
+    /// Unlock invokes the next action on the calling thread, unless the
+    /// thread is already within inline_depth nested invocations, in which
+    /// case the action is posted. The caller of unlock must not hold locks
+    /// required by the next action.
+    sequencer(asio::service& service, size_t inline_depth);
+
     virtual ~sequencer();
 
+    /// Queue the action, it is posted once all prior actions are unlocked.
     void lock(action&& handler);
+
+    /// Complete the current action and start the next, if any.
     void unlock();
 
 private:
-    // This is thread safe.
+    struct node
+    {
+        action handler;
+        std::atomic<node*> next;
+    };
+
+    void push(node* item);
+    node* pop();
+    action next();
+    void invoke(action&& handler);
+
+    // These are thread safe.
     asio::service& service_;
+    const size_t inline_depth_;
+    std::atomic<size_t> count_;
+    std::atomic<node*> head_;
 
-    // These are protected by mutex.
-    bool executing_;
-    std::queue<action> actions_;
-    mutable shared_mutex mutex_;
+    // These are accessed only by the thread that holds the sequence.
+    node* tail_;
+    node stub_;
 };
 
 } // namespace libbitcoin
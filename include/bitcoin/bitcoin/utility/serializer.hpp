@@ -77,6 +77,9 @@ public:
     void write_variable_little_endian(uint64_t value);
     void write_size_little_endian(size_t value);
 
+    /// Write base 128 integer, most significant group first.
+    void write_variable_base128(uint64_t value);
+
     /// Write one byte.
     void write_byte(uint8_t value);
 
@@ -0,0 +1,56 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SHA256_WRITER_HPP
+#define LIBBITCOIN_SHA256_WRITER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/hash_writer.hpp>
+
+namespace libbitcoin {
+
+/// Writer that produces the sha256 or bitcoin hash of the serialization of
+/// any object with to_data(writer&), without buffering it, for example:
+/// sha256_writer sink; tx.to_data(sink); const auto txid = sink.bitcoin_digest();
+/// A digest begins a new message, so the writer may be reused.
+class BC_API sha256_writer final
+  : public hash_writer
+{
+public:
+    /// Begin a new message.
+    void reset();
+
+    /// The sha256 hash of the message.
+    hash_digest sha256_digest();
+
+    /// The bitcoin hash (double sha256) of the message.
+    hash_digest bitcoin_digest();
+
+protected:
+    void update(const uint8_t* data, size_t size) override;
+
+private:
+    sha256_context context_;
+};
+
+} // namespace libbitcoin
+
+#endif
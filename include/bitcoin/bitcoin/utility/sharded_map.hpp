@@ -0,0 +1,169 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SHARDED_MAP_HPP
+#define LIBBITCOIN_SHARDED_MAP_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/math/salted_hash.hpp>
+#include <bitcoin/bitcoin/utility/flat_hash_map.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+#include <bitcoin/bitcoin/utility/thread.hpp>
+
+namespace libbitcoin {
+
+/**
+ * A bounded map for caches shared by many threads. Entries are partitioned
+ * by hash over independently-locked shards, so there is no global lock, and
+ * readers of a shard share its lock. Each entry has a cost and the total
+ * cost is bounded by the capacity, which is shared by all shards. To make
+ * room an entry is evicted by CLOCK (second chance), from the shard of the
+ * inserted key first. The storage of an evicted entry is reused by the next
+ * insertion into its shard, so storage is bounded by the capacity. The
+ * default hash is salted (see salted_hash). The value is copied out by
+ * find, so a large value should be held by shared pointer. Key and Value
+ * must be default constructible and move assignable. This class is thread
+ * safe.
+ */
+template <typename Key, typename Value, typename Hash=salted_hash<Key>>
+class sharded_map
+  : noncopyable
+{
+public:
+    /// The default number of independently-locked partitions.
+    static BC_CONSTEXPR size_t default_shards = 16;
+
+    /// The approximate storage of one entry, excluding any heap of its value.
+    static const size_t entry_size;
+
+    /// Construct a map bounded to the total entry cost, over the number of
+    /// shards (rounded up to a power of two).
+    sharded_map(size_t capacity=0, size_t shards=default_shards);
+
+    /// Copy the value of the key to out, false if not present.
+    bool find(Value& out, const Key& key) const;
+
+    /// True if the key is present.
+    bool contains(const Key& key) const;
+
+    /// Insert the entry, evicting as necessary, false (and unchanged) if the
+    /// key is present or the cost exceeds the capacity.
+    bool insert(const Key& key, Value value, size_t cost=1);
+
+    /// Change the capacity, evicting entries as necessary. The storage of
+    /// the shards is released if the capacity is zero.
+    void resize(size_t capacity);
+
+    /// Remove all entries, counters are retained.
+    void clear();
+
+    /// Invoke handler(key, value) for each entry, a shard at a time under its
+    /// shared lock. The handler must not call into the map.
+    template <typename Handler>
+    void visit(Handler&& handler) const;
+
+    /// The capacity is non-zero.
+    bool enabled() const;
+
+    /// The number of entries.
+    size_t size() const;
+
+    /// The total cost of the entries.
+    size_t cost() const;
+
+    /// The maximum total cost of the entries.
+    size_t capacity() const;
+
+    /// The number of shards.
+    size_t shards() const;
+
+    /// The number of find() and contains() calls that found the key.
+    uint64_t hits() const;
+
+    /// The number of find() and contains() calls that did not find the key.
+    uint64_t misses() const;
+
+    /// The number of entries inserted.
+    uint64_t insertions() const;
+
+    /// The number of entries evicted to make room (not by clear).
+    uint64_t evictions() const;
+
+    /// The proportion of lookups that found the key, zero if none.
+    float hit_rate() const;
+
+private:
+    typedef flat_hash_map<Key, size_t, Hash> index;
+
+    struct slot
+    {
+        slot();
+        slot(slot&& other);
+
+        Key key;
+        Value value;
+        size_t cost;
+        bool used;
+
+        // This is set by readers under the shared lock.
+        mutable std::atomic<bool> referenced;
+    };
+
+    struct shard
+    {
+        shard();
+
+        // These are protected by mutex.
+        index positions;
+        std::vector<slot> slots;
+        std::vector<size_t> vacant;
+        size_t hand;
+        mutable shared_mutex mutex;
+
+        mutable std::atomic<uint64_t> hits;
+        mutable std::atomic<uint64_t> misses;
+        std::atomic<uint64_t> insertions;
+        std::atomic<uint64_t> evictions;
+    };
+
+    static size_t to_shards(size_t shards);
+    static size_t to_shift(size_t shards);
+    size_t to_shard(const Key& key) const;
+    const slot* locate(const shard& part, const Key& key) const;
+    bool reserve(size_t cost, size_t start);
+    bool evict(size_t start);
+    static size_t evict(shard& part);
+
+    Hash hasher_;
+    const size_t shard_count_;
+    const size_t shift_;
+    std::atomic<size_t> capacity_;
+    std::atomic<size_t> cost_;
+    std::unique_ptr<shard[]> shards_;
+};
+
+} // namespace libbitcoin
+
+#include <bitcoin/bitcoin/impl/utility/sharded_map.ipp>
+
+#endif
@@ -0,0 +1,80 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SHARED_SNAPSHOT_HPP
+#define LIBBITCOIN_SHARED_SNAPSHOT_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+#include <bitcoin/bitcoin/utility/thread.hpp>
+
+namespace libbitcoin {
+
+/// This class is thread safe.
+/// An immutable snapshot of a value of any type, replaced as a whole (RCU).
+/// A reader obtains shared ownership of the current snapshot without a lock,
+/// and retains it regardless of later replacement. Snapshots are published
+/// alternately in two slots, each with a count of the readers copying from
+/// it, and a writer waits only for readers of the slot it is replacing,
+/// which was superseded by the prior write. Writers are serialized by a
+/// mutex, std::atomic_load of shared_ptr is avoided as it is not lock free.
+template <typename Type>
+class shared_snapshot
+  : noncopyable
+{
+public:
+    typedef std::shared_ptr<const Type> ptr;
+
+    /// Construct with an empty snapshot.
+    shared_snapshot();
+
+    /// Construct with the given snapshot.
+    explicit shared_snapshot(ptr value);
+
+    /// The current snapshot.
+    ptr load() const;
+
+    /// Replace the snapshot.
+    void store(ptr value);
+
+private:
+    static BC_CONSTEXPR size_t slots = 2;
+
+    struct slot
+    {
+        ptr value;
+        mutable std::atomic<size_t> readers;
+    };
+
+    // These are thread safe.
+    std::atomic<size_t> version_;
+    std::array<slot, slots> slots_;
+
+    // This is used only by writers.
+    shared_mutex mutex_;
+};
+
+} // namespace libbitcoin
+
+#include <bitcoin/bitcoin/impl/utility/shared_snapshot.ipp>
+
+#endif
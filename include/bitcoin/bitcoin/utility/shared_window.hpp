@@ -0,0 +1,196 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SHARED_WINDOW_HPP
+#define LIBBITCOIN_SHARED_WINDOW_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <bitcoin/bitcoin/utility/assert.hpp>
+
+namespace libbitcoin {
+
+/// An ordered window of values, used as a deque (push_back, pop_front),
+/// whose copies share storage. Copy and pop_front are constant time, and so
+/// is push_back when no other window has already extended the storage from
+/// the same end. Otherwise push_back first copies the window to new storage,
+/// with room to grow by its size, so sliding a window is amortized constant.
+/// Stored values are never modified, so windows that share storage may be
+/// read and extended concurrently. A single instance is not thread safe.
+template <typename Value>
+class shared_window
+{
+public:
+    typedef Value value_type;
+    typedef const Value* const_iterator;
+    typedef const_iterator iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+    typedef const_reverse_iterator reverse_iterator;
+
+    shared_window()
+      : first_(0), last_(0)
+    {
+    }
+
+    shared_window(std::initializer_list<Value> values)
+      : shared_window()
+    {
+        for (const auto& value: values)
+            push_back(value);
+    }
+
+    // Modifiers.
+    //-------------------------------------------------------------------------
+
+    void push_back(const Value& value)
+    {
+        if (storage_ && last_ < storage_->capacity)
+        {
+            auto expected = last_;
+
+            // Claim the next slot, fails if another window has taken it.
+            if (storage_->size.compare_exchange_strong(expected, last_ + 1,
+                std::memory_order_relaxed))
+            {
+                storage_->values[last_++] = value;
+                return;
+            }
+        }
+
+        // New storage is sized for the window to slide by its own size.
+        const size_t minimum_capacity = 16;
+        const auto count = size();
+        const auto capacity = std::max(minimum_capacity, 2 * count + 1);
+        const auto fresh = std::make_shared<storage>(capacity);
+        std::copy(begin(), end(), fresh->values.get());
+        fresh->values[count] = value;
+        fresh->size.store(count + 1, std::memory_order_relaxed);
+
+        storage_ = fresh;
+        first_ = 0;
+        last_ = count + 1;
+    }
+
+    void pop_front()
+    {
+        BITCOIN_ASSERT(!empty());
+        ++first_;
+    }
+
+    void clear()
+    {
+        storage_.reset();
+        first_ = 0;
+        last_ = 0;
+    }
+
+    // Properties.
+    //-------------------------------------------------------------------------
+
+    size_t size() const
+    {
+        return last_ - first_;
+    }
+
+    bool empty() const
+    {
+        return first_ == last_;
+    }
+
+    // This must be guarded.
+    const Value& front() const
+    {
+        BITCOIN_ASSERT(!empty());
+        return *begin();
+    }
+
+    // This must be guarded.
+    const Value& back() const
+    {
+        BITCOIN_ASSERT(!empty());
+        return *(end() - 1);
+    }
+
+    const Value& operator[](size_t index) const
+    {
+        BITCOIN_ASSERT(index < size());
+        return begin()[index];
+    }
+
+    // Iteration.
+    //-------------------------------------------------------------------------
+
+    const_iterator begin() const
+    {
+        return storage_ ? storage_->values.get() + first_ : nullptr;
+    }
+
+    const_iterator end() const
+    {
+        return storage_ ? storage_->values.get() + last_ : nullptr;
+    }
+
+    const_reverse_iterator rbegin() const
+    {
+        return const_reverse_iterator(end());
+    }
+
+    const_reverse_iterator rend() const
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    const_reverse_iterator crbegin() const
+    {
+        return rbegin();
+    }
+
+    const_reverse_iterator crend() const
+    {
+        return rend();
+    }
+
+private:
+    struct storage
+    {
+        storage(size_t capacity)
+          : capacity(capacity), size(0), values(new Value[capacity])
+        {
+        }
+
+        // The number of slots, fixed so that values are never relocated.
+        const size_t capacity;
+
+        // The number of slots claimed by windows.
+        std::atomic<size_t> size;
+
+        std::unique_ptr<Value[]> values;
+    };
+
+    std::shared_ptr<storage> storage_;
+    size_t first_;
+    size_t last_;
+};
+
+} // namespace libbitcoin
+
+#endif
@@ -25,6 +25,7 @@
 #include <vector>
 #include <bitcoin/bitcoin/utility/dispatcher.hpp>
 #include <bitcoin/bitcoin/utility/enable_shared_from_base.hpp>
+#include <bitcoin/bitcoin/utility/relay_queue.hpp>
 #include <bitcoin/bitcoin/utility/thread.hpp>
 #include <bitcoin/bitcoin/utility/threadpool.hpp>
 ////#include <bitcoin/bitcoin/utility/track.hpp>
@@ -62,9 +63,11 @@ private:
     typedef std::vector<handler> list;
 
     void do_invoke(Args... args);
+    void do_relay();
 
     bool stopped_;
     list subscriptions_;
+    relay_queue<Args...> relays_;
     dispatcher dispatch_;
     mutable upgrade_mutex invoke_mutex_;
     mutable upgrade_mutex subscribe_mutex_;
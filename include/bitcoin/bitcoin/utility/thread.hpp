@@ -22,6 +22,8 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <string>
+#include <vector>
 #include <boost/thread.hpp>
 #include <bitcoin/bitcoin/define.hpp>
 
@@ -48,6 +50,30 @@ enum class thread_priority
     lowest
 };
 
+/// Placement and identification of spawned threads, applied by the thread
+/// to itself on start. Each setting is best effort, unsupported platforms
+/// ignore it.
+struct BC_API thread_options
+{
+    /// The scheduling priority of each thread.
+    thread_priority priority = thread_priority::normal;
+
+    /// The logical processors (cores) to which threads are pinned, empty for
+    /// no pinning. Unless distributed, each thread may run on any of the set.
+    std::vector<size_t> cores;
+
+    /// Pin each thread to the single core of the set at its spawn index.
+    bool distribute = false;
+
+    /// Allocate thread memory from the NUMA node on which the thread runs,
+    /// overriding any inherited (e.g. interleaved) memory policy.
+    bool numa_local = false;
+
+    /// The thread name is this prefix and the spawn index, empty for none.
+    /// Names are truncated to the platform limit (15 characters on linux).
+    std::string name;
+};
+
 typedef boost::shared_mutex shared_mutex;
 typedef boost::upgrade_mutex upgrade_mutex;
 
@@ -58,6 +84,10 @@ typedef std::shared_ptr<boost::shared_mutex> shared_mutex_ptr;
 typedef std::shared_ptr<boost::upgrade_mutex> upgrade_mutex_ptr;
 
 BC_API void set_priority(thread_priority priority);
+BC_API bool set_affinity(const std::vector<size_t>& cores);
+BC_API bool set_numa_local();
+BC_API bool set_thread_name(const std::string& name);
+BC_API void set_options(const thread_options& options, size_t index);
 BC_API thread_priority priority(bool priority);
 BC_API size_t thread_default(size_t configured);
 BC_API size_t thread_ceiling(size_t configured);
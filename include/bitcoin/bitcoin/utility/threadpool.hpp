@@ -48,6 +48,13 @@ public:
      threadpool(size_t number_threads=0,
         thread_priority priority=thread_priority::normal);
 
+    /**
+     * Threadpool constructor, spawns the specified number of threads.
+     * @param[in]   number_threads  Number of threads to spawn.
+     * @param[in]   options         Placement and naming of threads to spawn.
+     */
+    threadpool(size_t number_threads, const thread_options& options);
+
     virtual ~threadpool();
 
     /**
@@ -68,6 +75,14 @@ public:
     void spawn(size_t number_threads=1,
         thread_priority priority=thread_priority::normal);
 
+    /**
+     * Add the specified number of threads to this threadpool.
+     * Thread indexes (for names and distribution) continue from the size.
+     * @param[in]   number_threads  Number of threads to add.
+     * @param[in]   options         Placement and naming of threads to add.
+     */
+    void spawn(size_t number_threads, const thread_options& options);
+
     /**
      * Abandon outstanding operations without dispatching handlers.
      * WARNING: This call is unsave and should be avoided.
@@ -97,7 +112,7 @@ public:
     const asio::service& service() const;
 
 private:
-    void spawn_once(thread_priority priority=thread_priority::normal);
+    void spawn_once(const thread_options& options);
 
     // This is thread safe.
     asio::service service_;
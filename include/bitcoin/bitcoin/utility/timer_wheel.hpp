@@ -0,0 +1,137 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_TIMER_WHEEL_HPP
+#define LIBBITCOIN_TIMER_WHEEL_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/utility/asio.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
+
+namespace libbitcoin {
+
+/**
+ * This class is thread safe.
+ * A hashed timer wheel, shared by many timers, with constant time arm and
+ * cancel. Expiration is rounded up to the tick resolution. A single tick
+ * thread advances the wheel, sleeping while no timer is armed, and posts
+ * expired handlers to the threadpool with a success code. Canceled (and
+ * re-armed) handlers are not invoked, as with deadline.
+ */
+class BC_API timer_wheel
+  : noncopyable
+{
+public:
+    typedef std::function<void(const code&)> handler;
+
+    /// A reusable wheel entry, arming requires no allocation.
+    /// An entry must not outlive its wheel.
+    class BC_API timer
+      : noncopyable
+    {
+    public:
+        typedef std::shared_ptr<timer> ptr;
+
+        explicit timer(timer_wheel& wheel);
+
+        /// Cancels the timer.
+        ~timer();
+
+        /// The wheel of the timer.
+        timer_wheel& wheel() const;
+
+    private:
+        friend class timer_wheel;
+
+        timer_wheel& wheel_;
+
+        // These are protected by the wheel mutex.
+        timer* previous_;
+        timer* next_;
+        size_t slot_;
+        uint64_t rounds_;
+        bool armed_;
+        handler handler_;
+    };
+
+    /**
+     * Construct a wheel and start its tick thread.
+     * @param[in]  pool        The threadpool on which handlers are invoked.
+     * @param[in]  resolution  The duration of a tick.
+     * @param[in]  slots       The number of slots in the wheel.
+     */
+    timer_wheel(threadpool& pool,
+        const asio::duration& resolution=asio::milliseconds(1),
+        size_t slots=1024);
+
+    /// Stops the wheel and joins the tick thread.
+    ~timer_wheel();
+
+    /// Create an entry on this wheel.
+    timer::ptr create();
+
+    /// Arm or re-arm the timer to invoke the handler after the duration.
+    void arm(timer& entry, handler&& handle, const asio::duration& duration);
+
+    /// Disarm the timer, the handler is not invoked.
+    void cancel(timer& entry);
+
+    /// Stop the tick thread, armed handlers are not invoked.
+    void stop();
+
+    /// The number of armed timers.
+    size_t armed() const;
+
+private:
+    typedef std::vector<handler> handlers;
+
+    uint64_t current_tick() const;
+    asio::time_point tick_time(uint64_t tick) const;
+    void link(timer& entry, uint64_t tick);
+    void unlink(timer& entry);
+    void expire(uint64_t tick, handlers& expired);
+    void run();
+
+    // These are thread safe.
+    threadpool& pool_;
+    const asio::duration resolution_;
+    const asio::time_point start_;
+
+    // These are protected by mutex.
+    std::vector<timer*> slots_;
+    uint64_t next_tick_;
+    size_t armed_;
+    bool stopped_;
+    mutable std::mutex mutex_;
+    std::condition_variable wake_;
+
+    std::unique_ptr<asio::thread> thread_;
+};
+
+} // namespace libbitcoin
+
+#endif
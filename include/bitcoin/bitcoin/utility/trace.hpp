@@ -0,0 +1,132 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_TRACE_HPP
+#define LIBBITCOIN_TRACE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+
+// Define BC_TRACE (--enable-trace) to compile the library trace spans in.
+// Otherwise BC_TRACE_SPAN expands to nothing, so that spans cost nothing.
+// Compiled in, a span costs one relaxed load unless recording is started.
+#ifdef BC_TRACE
+    #define BC_TRACE_JOIN(left, right) left##right
+    #define BC_TRACE_LOCAL(line) BC_TRACE_JOIN(trace_span_, line)
+    #define BC_TRACE_SPAN(category, name) \
+        const bc::trace_span BC_TRACE_LOCAL(__LINE__)(category, name)
+#else
+    #define BC_TRACE_SPAN(category, name)
+#endif
+
+namespace libbitcoin {
+
+/**
+ * This class is thread safe.
+ * The process-wide recorder of completed spans (begin and end), exported in
+ * the chrome trace event json format, which perfetto also loads. Each thread
+ * records into its own buffer without locking, allocated by its first span.
+ * A full buffer drops (and counts) further spans until cleared.
+ */
+class BC_API trace_events
+{
+public:
+    struct event
+    {
+        const char* category;
+        const char* name;
+        uint64_t begin;
+        uint64_t end;
+    };
+
+    static const size_t default_capacity = 65536;
+
+    /// Start recording, with capacity spans in each thread buffer allocated
+    /// after this (existing buffers keep their capacity).
+    static void start(size_t capacity=default_capacity);
+
+    /// Stop recording, spans in progress are still recorded.
+    static void stop();
+
+    /// Recording is started.
+    static bool recording()
+    {
+        return recording_.load(std::memory_order_relaxed);
+    }
+
+    /// Discard the recorded spans, which must not be concurrent with write.
+    static void clear();
+
+    /// Nanoseconds since the trace epoch (steady clock).
+    static uint64_t now();
+
+    /// Record a span on the thread buffer, names must outlive the export.
+    static void record(const char* category, const char* name,
+        uint64_t begin, uint64_t end);
+
+    /// A copy of the name that lives for the process, for dynamic names.
+    static const char* intern(const std::string& name);
+
+    /// The number of spans recorded and dropped since cleared.
+    static size_t size();
+    static size_t dropped();
+
+    /// Write the recorded spans as a trace event json object, named threads
+    /// first. This may be concurrent with recording.
+    static void write(std::ostream& out);
+
+private:
+    static std::atomic<bool> recording_;
+};
+
+/// Record the lifetime of the span, if recording when constructed.
+/// Use BC_TRACE_SPAN for spans that are compiled out without BC_TRACE.
+class BC_API trace_span
+  : noncopyable
+{
+public:
+    trace_span(const char* category, const char* name)
+      : category_(category),
+        name_(name),
+        recording_(trace_events::recording()),
+        begin_(recording_ ? trace_events::now() : 0)
+    {
+    }
+
+    ~trace_span()
+    {
+        if (recording_)
+            trace_events::record(category_, name_, begin_,
+                trace_events::now());
+    }
+
+private:
+    const char* const category_;
+    const char* const name_;
+    const bool recording_;
+    const uint64_t begin_;
+};
+
+} // namespace libbitcoin
+
+#endif
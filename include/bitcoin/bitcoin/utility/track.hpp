@@ -22,6 +22,8 @@
 #include <atomic>
 #include <cstddef>
 #include <string>
+#include <vector>
+#include <bitcoin/bitcoin/define.hpp>
 
 // libbitcoin defines the log and tracking but does not use them.
 // These are defined in bc so that they can be used in network and blockchain.
@@ -29,18 +31,66 @@
 #define CONSTRUCT_TRACK(class_name) \
     track<class_name>(#class_name)
 
-template <class Shared>
-class track
+namespace libbitcoin {
+namespace log {
+    class metrics;
+} // namespace log
+} // namespace libbitcoin
+
+/// The instance counts of a tracked class, updated lock-free.
+struct BC_API track_counters
+{
+    track_counters();
+
+    /// Instances currently constructed.
+    std::atomic<size_t> live;
+
+    /// Instances constructed since process start.
+    std::atomic<size_t> total;
+};
+
+/**
+ * This class is thread safe.
+ * The process-wide registry of tracked class counters, by class name.
+ * The registry is locked only to register a class (once per class) and to
+ * take a snapshot, construction and destruction are relaxed atomic updates.
+ */
+class BC_API track_registry
 {
 public:
-    static std::atomic<size_t> instances;
+    struct entry
+    {
+        std::string class_name;
+        size_t live;
+        size_t total;
+    };
 
+    typedef std::vector<entry> snapshot;
+
+    /// Get or create the counters of the class, the reference remains valid.
+    static track_counters& counters(const std::string& class_name);
+
+    /// The counts of all registered classes, ordered by class name.
+    static snapshot counts();
+
+    /// Set "track.<class>.live" and "track.<class>.total" gauges, this may be
+    /// added as a metrics sampler for periodic export to statsd.
+    static void publish(libbitcoin::log::metrics& metrics);
+};
+
+template <class Shared>
+class track
+{
 protected:
     track(const std::string& class_name);
     virtual ~track();
 
 private:
+    track_counters& counters_;
+
+#ifndef NDEBUG
     const std::string class_;
+#endif
 };
 
 #include <bitcoin/bitcoin/impl/utility/track.ipp>
@@ -0,0 +1,50 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_TREE_WRITER_HPP
+#define LIBBITCOIN_TREE_WRITER_HPP
+
+#include <cstdint>
+#include <string>
+#include <bitcoin/bitcoin/define.hpp>
+
+namespace libbitcoin {
+
+/// Streaming writer interface for structured (object and array) documents.
+/// Each begin must be matched by its end and each object member value must
+/// be preceded by its key. Output is emitted as written, with no tree.
+class BC_API tree_writer
+{
+public:
+    /// Containers.
+    virtual void begin_object() = 0;
+    virtual void end_object() = 0;
+    virtual void begin_array() = 0;
+    virtual void end_array() = 0;
+
+    /// Write the key of the next object member.
+    virtual void write_key(const char* key) = 0;
+
+    /// Write a value.
+    virtual void write_value(const std::string& value) = 0;
+    virtual void write_value(uint64_t value) = 0;
+};
+
+} // namespace libbitcoin
+
+#endif
@@ -19,10 +19,13 @@
 #ifndef LIBBITCOIN_WORK_HPP
 #define LIBBITCOIN_WORK_HPP
 
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <string>
 #include <memory>
 #include <utility>
+#include <vector>
 #include <bitcoin/bitcoin/define.hpp>
 #include <bitcoin/bitcoin/error.hpp>
 #include <bitcoin/bitcoin/utility/asio.hpp>
@@ -30,6 +33,7 @@
 #include <bitcoin/bitcoin/utility/noncopyable.hpp>
 #include <bitcoin/bitcoin/utility/sequencer.hpp>
 #include <bitcoin/bitcoin/utility/threadpool.hpp>
+#include <bitcoin/bitcoin/utility/work_stealing_pool.hpp>
 
 namespace libbitcoin {
 
@@ -37,6 +41,7 @@ namespace libbitcoin {
 #define UNORDERED "unordered"
 #define CONCURRENT "concurrent"
 #define SEQUENCE "sequence"
+#define KEYED "keyed"
 
 #define FORWARD_ARGS(args) \
     std::forward<Args>(args)...
@@ -56,6 +61,10 @@ public:
     /// Create an instance.
     work(threadpool& pool, const std::string& name);
 
+    /// Create an instance with concurrent execution on the executor.
+    work(threadpool& pool, work_stealing_pool& executor,
+        const std::string& name);
+
     /// Local execution for any operation, equivalent to std::bind.
     template <typename Handler, typename... Args>
     static void bound(Handler&& handler, Args&&... args)
@@ -68,9 +77,10 @@ public:
     void concurrent(Handler&& handler, Args&&... args)
     {
         // Service post ensures the job does not execute in the current thread.
-        service_.post(BIND_HANDLER(handler, args));
-        ////service_.post(inject(BIND_HANDLER(handler, args), CONCURRENT,
-        ////    concurrent_));
+        if (executor_ != nullptr)
+            executor_->post(inject(BIND_HANDLER(handler, args), concurrent_));
+        else
+            service_.post(inject(BIND_HANDLER(handler, args), concurrent_));
     }
 
     /// Sequential execution for synchronous operations.
@@ -79,8 +89,17 @@ public:
     {
         // Use a strand to prevent concurrency and post vs. dispatch to ensure
         // that the job is not executed in the current thread.
-        strand_.post(BIND_HANDLER(handler, args));
-        ////strand_.post(inject(BIND_HANDLER(handler, args), ORDERED, ordered_));
+        strand_.post(inject(BIND_HANDLER(handler, args), ordered_));
+    }
+
+    /// Sequential execution for synchronous operations of the same key.
+    /// Keys are hashed onto a fixed set of strands, so operations of one key
+    /// are ordered and those of keys on other strands may be concurrent.
+    template <typename Key, typename Handler, typename... Args>
+    void ordered_by(const Key& key, Handler&& handler, Args&&... args)
+    {
+        auto& shard = shards_[to_shard(std::hash<Key>()(key))];
+        shard.strand.post(inject(BIND_HANDLER(handler, args), shard.counter));
     }
 
     /// Non-concurrent execution for synchronous operations.
@@ -89,9 +108,8 @@ public:
     {
         // Use a strand wrapper to prevent concurrency and a service post
         // to deny ordering while ensuring execution on another thread.
-        service_.post(strand_.wrap(BIND_HANDLER(handler, args)));
-        ////service_.post(strand_.wrap(inject(BIND_HANDLER(handler, args),
-        ////    UNORDERED, unordered_)));
+        service_.post(strand_.wrap(inject(BIND_HANDLER(handler, args),
+            unordered_)));
     }
 
     /// Begin sequential execution for a set of asynchronous operations.
@@ -101,9 +119,7 @@ public:
     {
         // Use a sequence to track the asynchronous operation to completion,
         // ensuring each asynchronous op executes independently and in order.
-        sequence_.lock(BIND_HANDLER(handler, args));
-        ////sequence_.lock(inject(BIND_HANDLER(handler, args), SEQUENCE,
-        ////    sequence_));
+        sequence_.lock(inject(BIND_HANDLER(handler, args), sequential_));
     }
 
     /// Complete sequential execution.
@@ -112,35 +128,60 @@ public:
         sequence_.unlock();
     }
 
-    ////size_t ordered_backlog();
-    ////size_t unordered_backlog();
-    ////size_t concurrent_backlog();
-    ////size_t sequential_backlog();
-    ////size_t combined_backlog();
+    /// Jobs queued and not yet started, by context.
+    size_t ordered_backlog() const;
+    size_t unordered_backlog() const;
+    size_t concurrent_backlog() const;
+    size_t sequential_backlog() const;
+    size_t keyed_backlog() const;
+    size_t combined_backlog() const;
+
+    /// The number of keyed strands and the backlog of one, to find hot keys.
+    size_t shards() const;
+    size_t keyed_backlog(size_t shard) const;
+
+    /// Queue depth and latency metrics, by context.
+    const monitor& ordered_metrics() const;
+    const monitor& unordered_metrics() const;
+    const monitor& concurrent_metrics() const;
+    const monitor& sequential_metrics() const;
+    const monitor& keyed_metrics(size_t shard) const;
+
+    /// Send the metrics of each context to the statsd source.
+    void publish(const std::string& prefix) const;
 
 private:
-    ////template <typename Handler>
-    ////auto inject(Handler&& handler, const std::string& context,
-    ////    monitor::count_ptr counter) -> std::function<void()>
-    ////{
-    ////    auto label = name_ + "_" + context;
-    ////    auto capture = std::make_shared<monitor>(counter, std::move(label));
-    ////    return [=]() { capture->invoke(handler); };
-
-    ////    //// TODO: use this to prevent handler copy into closure.
-    ////    ////return std::bind(&monitor::invoke<Handler>, capture,
-    ////    ////    std::forward<Handler>(handler));
-    ////}
+    struct shard
+    {
+        asio::service::strand strand;
+        monitor::ptr counter;
+    };
+
+    static std::vector<shard> to_shards(asio::service& service,
+        const std::string& name);
+
+    // The strand of a key hash.
+    size_t to_shard(size_t hash) const;
+
+    // The monitor is captured by reference count, the handler by value.
+    template <typename Handler>
+    static monitor::tracked<Handler> inject(Handler&& handler,
+        monitor::ptr counter)
+    {
+        return monitor::track(counter, FORWARD_HANDLER(handler));
+    }
 
     // These are thread safe.
     const std::string name_;
-    ////monitor::count_ptr ordered_;
-    ////monitor::count_ptr unordered_;
-    ////monitor::count_ptr concurrent_;
-    ////monitor::count_ptr sequential_;
+    const monitor::ptr ordered_;
+    const monitor::ptr unordered_;
+    const monitor::ptr concurrent_;
+    const monitor::ptr sequential_;
     asio::service& service_;
+    work_stealing_pool* const executor_;
     asio::service::strand strand_;
     sequencer sequence_;
+    std::vector<shard> shards_;
 };
 
 #undef FORWARD_ARGS
@@ -0,0 +1,131 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_WORK_STEALING_POOL_HPP
+#define LIBBITCOIN_WORK_STEALING_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <boost/thread/tss.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/utility/asio.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+#include <bitcoin/bitcoin/utility/thread.hpp>
+
+namespace libbitcoin {
+
+/**
+ * This class is thread safe.
+ * A collection of threads, each with its own job deque, which steal jobs
+ * from each other when idle. Jobs posted from a pool thread are queued to
+ * that thread (and executed last in first out), other jobs are distributed
+ * round robin. There is no global queue lock, idle threads share a mutex
+ * only to sleep and are woken only when threads are known to be sleeping.
+ */
+class BC_API work_stealing_pool
+  : noncopyable
+{
+public:
+    typedef std::function<void()> handler;
+
+    /**
+     * Work stealing pool constructor, spawns the specified number of threads.
+     * The number of threads is fixed for the lifetime of the pool.
+     * @param[in]   number_threads  Number of threads to spawn.
+     * @param[in]   priority        Priority of threads to spawn.
+     */
+    work_stealing_pool(size_t number_threads=0,
+        thread_priority priority=thread_priority::normal);
+
+    virtual ~work_stealing_pool();
+
+    /**
+     * There are no threads configured in the pool.
+     */
+    bool empty() const;
+
+    /**
+     * The number of threads configured in the pool.
+     */
+    size_t size() const;
+
+    /**
+     * Queue the job for execution on a pool thread.
+     * The job is never executed in the calling thread.
+     * @param[in]   job  The job to execute.
+     */
+    void post(handler job);
+
+    /**
+     * Abandon outstanding operations without dispatching handlers.
+     * WARNING: This call is unsafe and should be avoided.
+     */
+    void abort();
+
+    /**
+     * Allow threads to terminate once all outstanding jobs have executed.
+     * Caller should next call join.
+     */
+    void shutdown();
+
+    /**
+     * Wait for all threads in the pool to terminate.
+     * This must not be called from a thread in the pool.
+     */
+    void join();
+
+private:
+    struct queue
+    {
+        std::deque<handler> jobs;
+        std::mutex mutex;
+    };
+
+    void run(size_t index, thread_priority priority);
+    bool pop(size_t index, handler& out);
+    bool steal(size_t index, handler& out);
+    void notify();
+
+    // These are thread safe.
+    std::atomic<size_t> next_;
+    std::atomic<size_t> pending_;
+    std::atomic<size_t> sleeping_;
+    std::atomic<bool> stopped_;
+    std::atomic<bool> aborted_;
+    boost::thread_specific_ptr<size_t> index_;
+
+    // The set of queues is fixed at construction, each is protected by mutex.
+    std::vector<std::unique_ptr<queue>> queues_;
+
+    // These are protected by mutex.
+    std::mutex idle_mutex_;
+    std::condition_variable idle_;
+
+    std::vector<asio::thread> threads_;
+    mutable upgrade_mutex threads_mutex_;
+};
+
+} // namespace libbitcoin
+
+#endif
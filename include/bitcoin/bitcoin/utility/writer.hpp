@@ -55,6 +55,9 @@ public:
     virtual void write_variable_little_endian(uint64_t value) = 0;
     virtual void write_size_little_endian(size_t value) = 0;
 
+    /// Write base 128 integer, most significant group first.
+    virtual void write_variable_base128(uint64_t value) = 0;
+
     /// Write one byte.
     virtual void write_byte(uint8_t value) = 0;
 
@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_WALLET_ADDRESS_EXTRACTOR_HPP
+#define LIBBITCOIN_WALLET_ADDRESS_EXTRACTOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <bitcoin/bitcoin/chain/block.hpp>
+#include <bitcoin/bitcoin/chain/point.hpp>
+#include <bitcoin/bitcoin/chain/transaction.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
+#include <bitcoin/bitcoin/wallet/payment_address.hpp>
+
+namespace libbitcoin {
+namespace wallet {
+
+/**
+ * An extractor of the payment addresses of every input and output of a
+ * block (or transaction) into one flat list, for address history indexing.
+ * Addresses are those of payment_address::extract_output, applied to the
+ * prevout script of an input where populated, otherwise those of
+ * payment_address::extract_input. Scripts are matched on their bytes
+ * without decoding, and the public keys and redeem scripts of a transaction
+ * are hashed together in one batch. Rows are in block order, each
+ * transaction's inputs followed by its outputs. Scripts without an address
+ * have no row. This class is thread safe.
+ */
+class BC_API address_extractor
+{
+public:
+    struct row
+    {
+        typedef std::vector<row> list;
+
+        /// The address hash and version, as of payment_address.
+        short_hash hash;
+        uint8_t version;
+
+        /// The point of the input (spender) or of the output.
+        chain::point point;
+
+        /// The output value, or the prevout value of an input if populated
+        /// (otherwise chain::output::not_found).
+        uint64_t value;
+
+        /// The point is an output.
+        bool output;
+    };
+
+    /// Construct an extractor for the given address versions.
+    address_extractor(uint8_t p2kh_version=payment_address::mainnet_p2kh,
+        uint8_t p2sh_version=payment_address::mainnet_p2sh);
+
+    /// The rows of the transaction.
+    row::list extract(const chain::transaction& tx) const;
+
+    /// The rows of the block.
+    row::list extract(const chain::block& block) const;
+
+    /// As above, extracting transactions concurrently on the pool.
+    row::list extract(const chain::block& block, threadpool& pool) const;
+
+private:
+    void extract(row::list& out, const chain::transaction& tx) const;
+
+    const uint8_t p2kh_version_;
+    const uint8_t p2sh_version_;
+};
+
+} // namespace wallet
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,72 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_WALLET_ADDRESS_GENERATOR_HPP
+#define LIBBITCOIN_WALLET_ADDRESS_GENERATOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/math/elliptic_curve.hpp>
+#include <bitcoin/bitcoin/utility/string.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
+#include <bitcoin/bitcoin/wallet/payment_address.hpp>
+
+namespace libbitcoin {
+namespace wallet {
+
+/**
+ * A generator of encoded payment addresses from secrets, for provisioning
+ * addresses in bulk. Secrets are processed in batches: each public key is
+ * computed from the fixed base table, then the keys of the batch are hashed
+ * together (hash160), the checksums of the batch are hashed together, and
+ * each payload is base58 encoded into its string. Each address is that of
+ * payment_address(ec_private(secret, version), version).encoded().
+ * This class is thread safe.
+ */
+class BC_API address_generator
+{
+public:
+    /// The number of secrets hashed together in one batch.
+    static BC_CONSTEXPR size_t batch_size = 64;
+
+    /// Construct a generator for the given key form and address version.
+    address_generator(bool compress=true,
+        uint8_t version=payment_address::mainnet_p2kh);
+
+    /// Generate the address of each secret into out (resized to match).
+    /// The address of an invalid secret is empty, and false is returned.
+    bool generate(string_list& out, const secret_list& secrets) const;
+
+    /// As above, generating batches concurrently on the pool.
+    bool generate(string_list& out, const secret_list& secrets,
+        threadpool& pool) const;
+
+private:
+    bool generate(std::string* out, const ec_secret* secrets,
+        size_t count) const;
+
+    const bool compress_;
+    const uint8_t version_;
+};
+
+} // namespace wallet
+} // namespace libbitcoin
+
+#endif
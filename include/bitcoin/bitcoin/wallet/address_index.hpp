@@ -0,0 +1,182 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_WALLET_ADDRESS_INDEX_HPP
+#define LIBBITCOIN_WALLET_ADDRESS_INDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <boost/filesystem.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <bitcoin/bitcoin/chain/block.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/flat_hash_map.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
+#include <bitcoin/bitcoin/wallet/address_extractor.hpp>
+
+namespace libbitcoin {
+namespace wallet {
+
+/**
+ * Queries are thread safe, open and close are not.
+ * An immutable, read-only memory mapping of a segment of an inverted index
+ * from address hash to its history (postings), as built from a range of
+ * blocks. Keys are sorted and fixed-stride, so a key is found by binary
+ * search, and the postings of a key are contiguous.
+ *
+ * [magic:4][version:4][keys:8][postings:8]
+ * keys: [hash:20][count:4][offset:8]
+ * lists: [column]...
+ *
+ * Postings are ordered by height, link, index and direction. A list has six
+ * columns of 32 bit values, of the height (less that of the preceding
+ * posting), the low and high words of the link (zigzag, less that of the
+ * preceding posting), the index and direction (index * 2 + output), and the
+ * low and high words of the value. A column is [size:base128][controls]
+ * [data], in which each control byte holds the byte lengths (less one) of
+ * four values, from its low bits, and the data is their little-endian bytes
+ * (stream vbyte). Columns are so decoded four values to a shuffle. A list
+ * ends at the offset of the next key, or the end of the file.
+ */
+class BC_API address_index
+  : noncopyable
+{
+public:
+    typedef boost::filesystem::path path;
+    typedef std::vector<path> paths;
+
+    struct posting
+    {
+        typedef std::vector<posting> list;
+
+        /// The height of the block of the transaction.
+        size_t height;
+
+        /// The caller's link of the transaction (such as its sequence).
+        uint64_t link;
+
+        /// The index of the input (spender) or of the output.
+        uint32_t index;
+
+        /// The value of address_extractor::row.
+        uint64_t value;
+
+        /// The posting is an output (otherwise a spend).
+        bool output;
+
+        bool operator<(const posting& other) const;
+        bool operator==(const posting& other) const;
+    };
+
+    /// The file magic ("adix" as written) and the version written.
+    static BC_CONSTEXPR uint32_t magic = 0x78696461;
+    static BC_CONSTEXPR uint32_t version = 1;
+
+    /// The size of the file prefix and of a key.
+    static BC_CONSTEXPR size_t prefix_size = 24;
+    static BC_CONSTEXPR size_t key_size = 32;
+
+    /// Write the postings of the segments to the file, replacing it. Lists
+    /// of a key in one segment are copied, otherwise they are merged.
+    static bool merge(const path& file, const paths& segments);
+
+    /// Construct a closed index.
+    address_index();
+
+    /// Map the file, false if it cannot be opened or is not an index file.
+    bool open(const path& file);
+
+    /// Unmap the file.
+    void close();
+
+    bool is_open() const;
+
+    /// The number of keys and of postings.
+    size_t keys() const;
+    size_t size() const;
+
+    /// Append the postings of the key, in order, false if not stored or if
+    /// the list is invalid.
+    bool find(posting::list& out, const short_hash& key) const;
+
+private:
+    friend class address_index_builder;
+
+    static void encode(data_chunk& out, const posting::list& postings);
+    static bool decode(posting::list& out, size_t count, data_slice list);
+
+    size_t find(const short_hash& key) const;
+    const uint8_t* key_data(size_t position) const;
+    data_slice list(size_t position) const;
+    uint32_t count(size_t position) const;
+
+    boost::iostreams::mapped_file_source file_;
+    size_t keys_;
+    size_t size_;
+};
+
+/**
+ * This class is not thread safe.
+ * Accumulates the postings of a segment of blocks, for address_index.
+ */
+class BC_API address_index_builder
+  : noncopyable
+{
+public:
+    typedef address_index::path path;
+    typedef address_index::posting posting;
+
+    /// Construct a builder extracting with the extractor.
+    address_index_builder(
+        const address_extractor& extractor=address_extractor());
+
+    /// Add the posting of the key.
+    void add(const short_hash& key, const posting& posting);
+
+    /// Add the rows of a transaction (as extracted) at the height and link.
+    void add(const address_extractor::row::list& rows, size_t height,
+        uint64_t link);
+
+    /// Add the rows of the block at the height, linking each transaction as
+    /// link plus its position, extracting transactions concurrently.
+    void add(const chain::block& block, size_t height, uint64_t link,
+        threadpool& pool);
+
+    /// The number of keys and of postings.
+    size_t keys() const;
+    size_t size() const;
+
+    /// Write the postings to the file, replacing it.
+    bool store(const path& file) const;
+
+    /// Remove all postings.
+    void clear();
+
+private:
+    const address_extractor extractor_;
+    flat_hash_map<short_hash, posting::list> postings_;
+    size_t size_;
+};
+
+} // namespace wallet
+} // namespace libbitcoin
+
+#endif
@@ -19,9 +19,9 @@
 #ifndef LIBBITCOIN_WALLET_DICTIONARY_HPP
 #define LIBBITCOIN_WALLET_DICTIONARY_HPP
 
-#include <array>
 #include <vector>
 #include <bitcoin/bitcoin/compat.hpp>
+#include <bitcoin/bitcoin/utility/packed_strings.hpp>
 
 namespace libbitcoin {
 namespace wallet {
@@ -34,10 +34,10 @@ static BC_CONSTEXPR size_t dictionary_size = 2048;
 /**
  * Dictionary definitions for creating mnemonics.
  * The bip39 spec calls this a "wordlist".
- * This is a POD type, which means the compiler can write it directly
- * to static memory with no run-time overhead.
+ * The words are packed constant data, which the compiler writes directly
+ * to static memory with no load-time relocation or run-time overhead.
  */
-typedef std::array<const char*, dictionary_size> dictionary;
+typedef packed_strings<dictionary_size> dictionary;
 
 /**
  * A collection of candidate dictionaries for mnemonic metadata.
@@ -0,0 +1,89 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_WALLET_DICTIONARY_INDEX_HPP
+#define LIBBITCOIN_WALLET_DICTIONARY_INDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+#include <bitcoin/bitcoin/utility/string.hpp>
+#include <bitcoin/bitcoin/wallet/dictionary.hpp>
+
+namespace libbitcoin {
+namespace wallet {
+
+/**
+ * A hash index of the words of a dictionary, giving constant time lookup of
+ * the position of a word. Each slot holds a position and a fingerprint of
+ * the word hash, so a lookup compares only the word that it finds. The index
+ * refers to the words of the dictionary, which must outlive it.
+ */
+class BC_API dictionary_index
+  : noncopyable
+{
+public:
+    /// Index the words of a dictionary.
+    dictionary_index(const dictionary& lexicon);
+
+    /// Index size packed words, such as a dictionary of another size.
+    dictionary_index(const char* words, const uint16_t* offsets, size_t size);
+
+    /// The position of the word in the dictionary, or -1 if not present.
+    int find(const std::string& word) const;
+
+    /// The number of words indexed.
+    size_t size() const;
+
+private:
+    static uint64_t hash(const char* word, size_t length);
+
+    const char* words_;
+    const uint16_t* offsets_;
+    const size_t size_;
+    size_t mask_;
+    std::vector<uint32_t> slots_;
+};
+
+/**
+ * The index of a built-in dictionary (see language::all), or nullptr if the
+ * lexicon is not built in. Built-in indexes are created as the library loads.
+ */
+BC_API const dictionary_index* find_index(const dictionary& lexicon);
+
+/**
+ * The position of the word in the lexicon, or -1 if not present. Built-in
+ * lexicons are searched by index and others linearly.
+ */
+BC_API int find_word(const dictionary& lexicon, const std::string& word);
+
+/**
+ * The lexicons of the list that contain all of the words, in list order.
+ * A lexicon is eliminated by the first word that misses its index, so the
+ * language of a mnemonic is found without scanning any dictionary.
+ */
+BC_API dictionary_list find_lexicons(const string_list& words,
+    const dictionary_list& lexicons=language::all);
+
+} // namespace wallet
+} // namespace libbitcoin
+
+#endif
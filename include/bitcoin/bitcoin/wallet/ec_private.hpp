@@ -91,6 +91,9 @@ public:
     ec_private(const ec_secret& secret, uint16_t version=mainnet,
         bool compress=true);
 
+    /// The secret is zeroized on destruction.
+    ~ec_private();
+
     /// Operators.
     ec_private& operator=(ec_private other);
     bool operator<(const ec_private& other) const;
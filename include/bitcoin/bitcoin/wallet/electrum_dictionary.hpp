@@ -19,9 +19,9 @@
 #ifndef LIBBITCOIN_WALLET_ELECTRUM_DICTIONARY_HPP
 #define LIBBITCOIN_WALLET_ELECTRUM_DICTIONARY_HPP
 
-#include <array>
 #include <vector>
 #include <bitcoin/bitcoin/compat.hpp>
+#include <bitcoin/bitcoin/utility/packed_strings.hpp>
 #include <bitcoin/bitcoin/wallet/dictionary.hpp>
 
 namespace libbitcoin {
@@ -36,7 +36,7 @@ static BC_CONSTEXPR size_t dictionary_size_v1 = 1626;
 /**
  * Dictionary definitions for creating electrum mnemonics.
  */
-typedef std::array<const char*, dictionary_size_v1> dictionary_v1;
+typedef packed_strings<dictionary_size_v1> dictionary_v1;
 
 /**
  * A collection of candidate dictionaries for mnemonic metadata.
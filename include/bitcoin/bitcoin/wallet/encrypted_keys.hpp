@@ -20,11 +20,13 @@
 #define LIBBITCOIN_ENCRYPTED_KEYS_HPP
 
 #include <string>
+#include <vector>
 #include <bitcoin/bitcoin/compat.hpp>
 #include <bitcoin/bitcoin/define.hpp>
 #include <bitcoin/bitcoin/math/crypto.hpp>
 #include <bitcoin/bitcoin/math/elliptic_curve.hpp>
 #include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
 #include <bitcoin/bitcoin/wallet/payment_address.hpp>
 
 namespace libbitcoin {
@@ -67,6 +69,7 @@ typedef byte_array<encrypted_token_decoded_size> encrypted_token;
 static BC_CONSTEXPR size_t ek_private_encoded_size = 58;
 static BC_CONSTEXPR size_t ek_private_decoded_size = 43;
 typedef byte_array<ek_private_decoded_size> encrypted_private;
+typedef std::vector<encrypted_private> encrypted_private_list;
 
 /**
  * DEPRECATED
@@ -177,6 +180,41 @@ BC_API bool decrypt(ec_secret& out_secret, uint8_t& out_version,
     bool& out_compressed, const encrypted_private& key,
     const std::string& passphrase);
 
+/**
+ * The result of decrypting one encrypted private key of a list.
+ */
+struct BC_API ek_decryption
+{
+    bool valid;
+    ec_secret secret;
+    uint8_t version;
+    bool compressed;
+};
+
+typedef std::vector<ek_decryption> ek_decryption_list;
+
+/**
+ * The default limit of concurrent scrypt scratch memory for decrypting a
+ * list of keys, room for about sixteen bip38 scrypt mixes of 16 MiB each.
+ */
+static BC_CONSTEXPR size_t ek_scratch_budget = 16 * 16 * 1024 * 1024;
+
+/**
+ * Decrypt the ec secrets associated with a list of encrypted private keys
+ * that share a passphrase, such as a paper wallet export. The scrypt work of
+ * all keys is distributed across the pool, and concurrent scrypt mixes are
+ * limited to those that fit the memory budget (at least one).
+ * @param[out] out_secrets    The decryption of each key, in order of keys.
+ * @param[in]  keys           The encrypted private keys.
+ * @param[in]  passphrase     The passphrase from the encryption or token.
+ * @param[in]  pool           The threadpool for the scrypt work.
+ * @param[in]  memory_budget  The limit of concurrent scrypt scratch memory.
+ * @return false if the checksum or passphrase is not valid for any key.
+ */
+BC_API bool decrypt(ek_decryption_list& out_secrets,
+    const encrypted_private_list& keys, const std::string& passphrase,
+    threadpool& pool, size_t memory_budget=ek_scratch_budget);
+
 /**
  * DEPRECATED
  * Decrypt the ec point associated with the encrypted public key.
@@ -0,0 +1,81 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_WALLET_HD_CACHE_HPP
+#define LIBBITCOIN_WALLET_HD_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+#include <bitcoin/bitcoin/wallet/hd_private.hpp>
+#include <bitcoin/bitcoin/wallet/hd_public.hpp>
+
+namespace libbitcoin {
+namespace wallet {
+
+/**
+ * A bounded least-recently-used cache of intermediate hd nodes, keyed by a
+ * digest of the root key and the path prefix. A derivation resumes from the
+ * longest cached prefix of its path, so that repeated derivations of paths
+ * such as m/84'/0'/n'/change/i compute only their last level. The final node
+ * of a path is returned but not cached. Private and public nodes are bounded
+ * independently, and cached private keys are zeroized when evicted or
+ * cleared. This class is thread safe.
+ */
+class BC_API hd_cache
+  : noncopyable
+{
+public:
+    typedef std::vector<uint32_t> path;
+
+    /// Construct a cache of up to capacity private and capacity public nodes.
+    hd_cache(size_t capacity=256);
+    ~hd_cache();
+
+    /// Derive the private key at the path from the root.
+    /// @return an invalid key if any level of the derivation is invalid.
+    hd_private derive_private(const hd_private& root, const path& indexes);
+
+    /// Derive the public key at the path (non-hardened) from the root.
+    /// @return an invalid key if any level of the derivation is invalid.
+    hd_public derive_public(const hd_public& root, const path& indexes);
+
+    /// Remove (and zeroize) all nodes.
+    void clear();
+
+    /// The number of cached nodes, private and public.
+    size_t size() const;
+
+    /// The maximum number of cached nodes of each kind.
+    size_t capacity() const;
+
+private:
+    struct state;
+
+    static void zeroize(hd_private& node);
+
+    const std::unique_ptr<state> state_;
+};
+
+} // namespace wallet
+} // namespace libbitcoin
+
+#endif
@@ -32,6 +32,8 @@
 namespace libbitcoin {
 namespace wallet {
 
+class hd_cache;
+
 /// An extended private key, as defined by BIP 32.
 class BC_API hd_private
   : public hd_public
@@ -62,6 +64,9 @@ public:
     hd_private(const std::string& encoded, uint64_t prefixes);
     hd_private(const std::string& encoded, uint32_t public_prefix);
 
+    /// The secret is zeroized on destruction.
+    ~hd_private();
+
     /// Operators.
     bool operator<(const hd_private& other) const;
     bool operator==(const hd_private& other) const;
@@ -78,8 +83,12 @@ public:
     operator const ec_secret&() const;
 
     /// Serializer.
+    /// The encoding is not cached, as it exposes the secret.
     std::string encoded() const;
 
+    /// Assign the encoding to out, reusing its capacity.
+    void encoded(std::string& out) const;
+
     /// Accessors.
     const ec_secret& secret() const;
 
@@ -90,6 +99,9 @@ public:
     hd_public derive_public(uint32_t index) const;
 
 private:
+    // Zeroizes the secret of evicted nodes.
+    friend class hd_cache;
+
     /// Factories.
     static hd_private from_seed(data_slice seed, uint64_t prefixes);
     static hd_private from_key(const hd_key& decoded, uint32_t prefix);
@@ -22,9 +22,13 @@
 #include <cstdint>
 #include <iostream>
 #include <string>
+#include <vector>
 #include <bitcoin/bitcoin/define.hpp>
 #include <bitcoin/bitcoin/math/elliptic_curve.hpp>
+#include <bitcoin/bitcoin/utility/cold_ptr.hpp>
 #include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/once_cell.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
 #include <bitcoin/bitcoin/wallet/ec_public.hpp>
 
 namespace libbitcoin {
@@ -89,8 +93,12 @@ public:
     operator const ec_compressed&() const;
 
     /// Serializer.
+    /// The encoding is cached on first use, as the key is immutable.
     std::string encoded() const;
 
+    /// Assign the encoding to out, reusing its capacity.
+    void encoded(std::string& out) const;
+
     /// Accessors.
     const hd_chain_code& chain_code() const;
     const hd_lineage& lineage() const;
@@ -100,6 +108,18 @@ public:
     hd_key to_hd_key() const;
     hd_public derive_public(uint32_t index) const;
 
+    /// Derive the count children from first into out, where out[i] is the
+    /// child at first + i. The hmac key pads and the parsed parent point are
+    /// shared across the range. A child that is invalid under BIP32 is left
+    /// invalid, so that the caller may skip it.
+    /// @return false if invalid, too deep, or the range reaches hardened.
+    bool derive_public_range(uint32_t first, size_t count,
+        std::vector<hd_public>& out) const;
+
+    /// As above, with the range divided among the threads of the pool.
+    bool derive_public_range(uint32_t first, size_t count,
+        std::vector<hd_public>& out, threadpool& pool) const;
+
 protected:
     /// Factories.
     static hd_public from_secret(const ec_secret& secret,
@@ -116,6 +136,9 @@ protected:
     ec_compressed point_;
 
 private:
+    struct deriver;
+    typedef once_cell<std::string> string_cell;
+
     static hd_public from_key(const hd_key& public_key);
     static hd_public from_string(const std::string& encoded);
     static hd_public from_key(const hd_key& public_key, uint32_t prefix);
@@ -123,6 +146,10 @@ private:
 
     hd_public(const ec_compressed& point,
         const hd_chain_code& chain_code, const hd_lineage& lineage);
+
+    const std::string& cached_encoding() const;
+
+    mutable cold_ptr<string_cell> encoded_;
 };
 
 } // namespace wallet
@@ -19,11 +19,16 @@
 #ifndef LIBBITCOIN_WALLET_MESSAGE_HPP
 #define LIBBITCOIN_WALLET_MESSAGE_HPP
 
+#include <cstddef>
 #include <string>
+#include <vector>
 #include <bitcoin/bitcoin/compat.hpp>
 #include <bitcoin/bitcoin/define.hpp>
 #include <bitcoin/bitcoin/math/elliptic_curve.hpp>
 #include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/asio.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
 #include <bitcoin/bitcoin/wallet/payment_address.hpp>
 
 namespace libbitcoin {
@@ -80,6 +85,42 @@ BC_API bool sign_message(message_signature& out_signature, data_slice message,
 BC_API bool verify_message(data_slice message, const payment_address& address,
     const message_signature& signature);
 
+/**
+ * A message to verify in a batch. The message data is not owned and must
+ * outlive the verification.
+ */
+struct BC_API signed_message
+{
+    data_slice message;
+    payment_address address;
+    message_signature signature;
+};
+
+/**
+ * The results of a batch of message verifications.
+ */
+struct BC_API message_verification
+{
+    /// Messages verified per second, zero if no time elapsed.
+    double throughput() const;
+
+    /// For each message in order, true if verify_message succeeds.
+    std::vector<bool> valid;
+
+    /// The number of messages that verified.
+    size_t valid_count;
+
+    /// The time taken to verify the batch.
+    asio::duration elapsed;
+};
+
+/**
+ * Verifies a batch of messages, as verify_message, concurrently on the pool
+ * and calling thread. Each thread hashes with a reused sha256 context.
+ */
+BC_API message_verification verify_messages(
+    const std::vector<signed_message>& messages, threadpool& pool);
+
 /// Exposed primarily for independent testability.
 BC_API bool recovery_id_to_magic(uint8_t& out_magic, uint8_t recovery_id,
     bool compressed);
@@ -31,7 +31,10 @@
 #include <bitcoin/bitcoin/math/checksum.hpp>
 #include <bitcoin/bitcoin/math/elliptic_curve.hpp>
 #include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/math/salted_hash.hpp>
+#include <bitcoin/bitcoin/utility/cold_ptr.hpp>
 #include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/once_cell.hpp>
 #include <bitcoin/bitcoin/wallet/ec_private.hpp>
 #include <bitcoin/bitcoin/wallet/ec_public.hpp>
 
@@ -88,8 +91,12 @@ public:
     operator const short_hash&() const;
 
     /// Serializer.
+    /// The encoding is cached on first use, as the address is immutable.
     std::string encoded() const;
 
+    /// Assign the encoding to out, reusing its capacity.
+    void encoded(std::string& out) const;
+
     /// Accessors.
     uint8_t version() const;
     const short_hash& hash() const;
@@ -109,11 +116,16 @@ private:
     static payment_address from_script(const chain::script& script,
         uint8_t version);
 
+    typedef once_cell<std::string> string_cell;
+
+    const std::string& cached_encoding() const;
+
     /// Members.
     /// These should be const, apart from the need to implement assignment.
     bool valid_;
     uint8_t version_;
     short_hash hash_;
+    mutable cold_ptr<string_cell> encoded_;
 };
 
 /// The pre-encoded structure of a payment address or other similar data.
@@ -125,6 +137,17 @@ struct BC_API wrapped_data
 };
 
 } // namespace wallet
+
+// Allow payment_address to be keyed in salted hash containers.
+template <>
+struct salted_hash<wallet::payment_address>
+{
+    size_t operator()(const wallet::payment_address& address) const
+    {
+        return salted_hash<short_hash>()(address.hash());
+    }
+};
+
 } // namespace libbitcoin
 
 // Allow payment_address to be in indexed in std::*map classes.
@@ -21,10 +21,13 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <iostream>
+#include <string>
 #include <bitcoin/bitcoin/compat.hpp>
 #include <bitcoin/bitcoin/define.hpp>
 #include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/string.hpp>
 
 #ifdef WITH_QRENCODE
 #include <qrencode.h>
@@ -43,6 +46,39 @@ public:
     static BC_CONSTEXPR encode_mode mode = QR_MODE_8;
     static BC_CONSTEXPR error_recovery_level level = QR_ECLEVEL_L;
 
+    /**
+     * This class is not thread safe.
+     * Encodes many codes with the same parameters, into one retained buffer.
+     * Paired with a png_writer this renders a batch of codes without
+     * intermediate streams or per-code buffer allocation.
+     */
+    class BC_API encoder
+    {
+    public:
+        /// Handle each code of a batch, return false to stop the batch.
+        typedef std::function<bool(size_t index, const data_chunk& code)>
+            handler;
+
+        encoder(uint32_t version=qr::version,
+            error_recovery_level level=qr::level, encode_mode mode=qr::mode,
+            bool case_sensitive=qr::case_sensitive);
+
+        /// Encode the text, empty if it cannot be encoded. The result is
+        /// valid until the next encoding.
+        const data_chunk& encode(const std::string& text);
+
+        /// Encode each text in order and pass its code to the handler.
+        /// False if a text cannot be encoded or the handler returns false.
+        bool encode(const string_list& texts, handler handle);
+
+    private:
+        const uint32_t version_;
+        const error_recovery_level level_;
+        const encode_mode mode_;
+        const bool case_sensitive_;
+        data_chunk code_;
+    };
+
     /**
      * A method that takes an input stream and writes the encoded qr data
      * to the specified output stream with default parameter values.
@@ -19,9 +19,13 @@
 #ifndef LIBBITCOIN_WALLET_SELECT_OUTPUTS_HPP
 #define LIBBITCOIN_WALLET_SELECT_OUTPUTS_HPP
 
+#include <cstddef>
 #include <cstdint>
+#include <vector>
 #include <bitcoin/bitcoin/define.hpp>
 #include <bitcoin/bitcoin/chain/points_value.hpp>
+#include <bitcoin/bitcoin/utility/asio.hpp>
+#include <bitcoin/bitcoin/wallet/unspent_index.hpp>
 
 namespace libbitcoin {
 namespace wallet {
@@ -37,7 +41,35 @@ struct BC_API select_outputs
 
         /// A set of individually sufficient unspent outputs. Each individual
         /// member of the set is sufficient. Return ascending order by value.
-        individual
+        individual,
+
+        /// A set within the default budget by branch and bound (see below),
+        /// for which no fee is deducted from values.
+        branch_and_bound
+    };
+
+    /// Parameters of branch and bound selection.
+    struct BC_API budget
+    {
+        /// Defaults to no input fee or change cost, 100000 tries, no timeout.
+        budget(uint64_t input_fee=0, uint64_t cost_of_change=0,
+            size_t maximum_tries=100000,
+            asio::duration timeout=asio::duration::zero());
+
+        /// The fee of spending one output (fee rate times input size). This
+        /// is deducted from each output value to give its effective value,
+        /// and outputs of no effective value are not selected.
+        uint64_t input_fee;
+
+        /// The excess over the minimum value that may be given up to fee in
+        /// place of a change output (the cost of creating and spending it).
+        uint64_t cost_of_change;
+
+        /// The maximum number of search steps, across both algorithms.
+        size_t maximum_tries;
+
+        /// The maximum search time, or zero for no time limit.
+        asio::duration timeout;
     };
 
     /// Select outpoints for a spend from a list of unspent outputs.
@@ -45,7 +77,27 @@ struct BC_API select_outputs
         const chain::points_value& unspent, uint64_t minimum_value,
         algorithm option=algorithm::greedy);
 
+    /// Select outpoints for a spend from an index of unspent outputs, with
+    /// effective value of at least minimum_value. Branch and bound searches
+    /// for the set of least excess that is within the cost of change, so no
+    /// change output is required. If there is none within the budget, a
+    /// knapsack search returns the set of least excess found. Outputs are
+    /// returned in descending order of value, or none if insufficient.
+    /// @return true if the selection requires no change output.
+    static bool select(chain::points_value& out, const unspent_index& unspent,
+        uint64_t minimum_value, const budget& limits=budget());
+
 private:
+    typedef std::vector<uint64_t> values;
+
+    struct search;
+
+    static bool branch_and_bound(std::vector<size_t>& out,
+        const values& effective, uint64_t minimum_value, search& limits);
+
+    static void knapsack(std::vector<size_t>& out, const values& effective,
+        uint64_t minimum_value, search& limits);
+
     static void greedy(chain::points_value& out,
         const chain::points_value& unspent, uint64_t minimum_value);
 
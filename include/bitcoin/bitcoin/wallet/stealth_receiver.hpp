@@ -19,10 +19,15 @@
 #ifndef LIBBITCOIN_WALLET_STEALTH_RECEIVER_HPP
 #define LIBBITCOIN_WALLET_STEALTH_RECEIVER_HPP
 
+#include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <bitcoin/bitcoin/chain/stealth_record.hpp>
 #include <bitcoin/bitcoin/define.hpp>
 #include <bitcoin/bitcoin/math/elliptic_curve.hpp>
 #include <bitcoin/bitcoin/utility/binary.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
 #include <bitcoin/bitcoin/wallet/payment_address.hpp>
 #include <bitcoin/bitcoin/wallet/stealth_address.hpp>
 
@@ -33,6 +38,8 @@ namespace wallet {
 class BC_API stealth_receiver
 {
 public:
+    typedef std::function<void(const chain::stealth_record&)> scan_handler;
+
     /// Constructors.
     stealth_receiver(const ec_secret& scan_private,
         const ec_secret& spend_private, const binary& filter,
@@ -52,7 +59,25 @@ public:
     bool derive_private(ec_secret& out_private,
         const ec_compressed& ephemeral_public) const;
 
+    /// Scan store-serialized records (see stealth_record::to_data(false)),
+    /// packed end to end, invoking the handler in order with each record at
+    /// or above start_height that pays this receiver. The prefix filter is
+    /// applied as one word compare per record.
+    /// @return false if records is not a whole number of records.
+    bool scan(data_slice records, size_t start_height,
+        scan_handler handler) const;
+
+    /// As above, with the shared secrets of filtered records computed across
+    /// the threads of the pool. Records are matched in chunks, so that the
+    /// handler receives matches while the scan proceeds.
+    bool scan(data_slice records, size_t start_height, scan_handler handler,
+        threadpool& pool) const;
+
 private:
+    struct matcher;
+
+    bool is_match(const uint8_t* record) const;
+
     const uint8_t version_;
     const ec_secret scan_private_;
     const ec_secret spend_private_;
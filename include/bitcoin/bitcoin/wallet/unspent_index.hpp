@@ -0,0 +1,76 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_WALLET_UNSPENT_INDEX_HPP
+#define LIBBITCOIN_WALLET_UNSPENT_INDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/bitcoin/chain/point_value.hpp>
+#include <bitcoin/bitcoin/chain/points_value.hpp>
+#include <bitcoin/bitcoin/define.hpp>
+
+namespace libbitcoin {
+namespace wallet {
+
+/**
+ * A set of unspent outputs kept in descending order of value (and then of
+ * point), with a running total. This is maintained incrementally as outputs
+ * are received and spent, so that repeated selection over a large wallet
+ * neither copies nor sorts the set. Insertion and removal are by binary
+ * search and shift. This class is not thread safe.
+ */
+class BC_API unspent_index
+{
+public:
+    /// Construct an empty index.
+    unspent_index();
+
+    /// Construct an index of the unspent outputs (sorted once).
+    unspent_index(const chain::points_value& unspent);
+
+    /// Add an unspent output, false if it is already present.
+    bool insert(const chain::point_value& point);
+
+    /// Remove an unspent output, false if it is not present.
+    bool erase(const chain::point_value& point);
+
+    /// Remove all unspent outputs.
+    void clear();
+
+    /// The unspent outputs in descending order of value.
+    const chain::point_value::list& points() const;
+
+    /// The number of unspent outputs.
+    size_t size() const;
+
+    /// The total value of the unspent outputs.
+    uint64_t value() const;
+
+private:
+    static bool greater(const chain::point_value& left,
+        const chain::point_value& right);
+
+    chain::point_value::list points_;
+    uint64_t value_;
+};
+
+} // namespace wallet
+} // namespace libbitcoin
+
+#endif
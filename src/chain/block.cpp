@@ -19,6 +19,8 @@
 #include <bitcoin/bitcoin/chain/block.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <limits>
 #include <cfenv>
@@ -28,12 +30,14 @@
 #include <numeric>
 #include <type_traits>
 #include <utility>
-#include <unordered_map>
+#include <vector>
 #include <boost/range/adaptor/reversed.hpp>
+#include <bitcoin/bitcoin/chain/block_validation_view.hpp>
 #include <bitcoin/bitcoin/chain/chain_state.hpp>
 #include <bitcoin/bitcoin/chain/compact.hpp>
 #include <bitcoin/bitcoin/chain/input_point.hpp>
 #include <bitcoin/bitcoin/chain/script.hpp>
+#include <bitcoin/bitcoin/chain/witness.hpp>
 #include <bitcoin/bitcoin/config/checkpoint.hpp>
 #include <bitcoin/bitcoin/constants.hpp>
 #include <bitcoin/bitcoin/error.hpp>
@@ -43,14 +47,20 @@
 #include <bitcoin/bitcoin/machine/number.hpp>
 #include <bitcoin/bitcoin/machine/opcode.hpp>
 #include <bitcoin/bitcoin/machine/rule_fork.hpp>
+#include <bitcoin/bitcoin/machine/script_profile.hpp>
 #include <bitcoin/bitcoin/message/messages.hpp>
 #include <bitcoin/bitcoin/settings.hpp>
 #include <bitcoin/bitcoin/utility/asio.hpp>
 #include <bitcoin/bitcoin/utility/assert.hpp>
-#include <bitcoin/bitcoin/utility/container_sink.hpp>
-#include <bitcoin/bitcoin/utility/container_source.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
+#include <bitcoin/bitcoin/utility/flat_hash_map.hpp>
+#include <bitcoin/bitcoin/utility/flat_hash_set.hpp>
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
 #include <bitcoin/bitcoin/utility/ostream_writer.hpp>
+#include <bitcoin/bitcoin/utility/parallel.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
+#include <bitcoin/bitcoin/utility/trace.hpp>
 
 namespace libbitcoin {
 namespace chain {
@@ -59,6 +69,30 @@ using namespace bc::config;
 using namespace bc::machine;
 using namespace boost::adaptors;
 
+// Transactions claimed per parallel job, amortizing the claim.
+static constexpr size_t transaction_grain = 8;
+
+static validation_timing::duration elapsed(const asio::time_point& start)
+{
+    return std::chrono::duration_cast<validation_timing::duration>(
+        asio::steady_clock::now() - start);
+}
+
+// Add the duration of the function to the stage, if timing is requested.
+template <typename Function>
+static auto timed(validation_timing* timing,
+    validation_timing::duration validation_timing::* stage,
+    Function function) -> decltype(function())
+{
+    if (timing == nullptr)
+        return function();
+
+    const auto start = asio::steady_clock::now();
+    const auto result = function();
+    timing->*stage += elapsed(start);
+    return result;
+}
+
 // Constructors.
 //-----------------------------------------------------------------------------
 
@@ -73,6 +107,7 @@ block::block(const block& other)
     non_coinbase_inputs_(other.non_coinbase_inputs_cache()),
     header_(other.header_),
     transactions_(other.transactions_),
+    retained_(other.retained_),
     metadata(other.metadata)
 {
 }
@@ -82,6 +117,7 @@ block::block(block&& other)
     non_coinbase_inputs_(other.non_coinbase_inputs_cache()),
     header_(std::move(other.header_)),
     transactions_(std::move(other.transactions_)),
+    retained_(std::move(other.retained_)),
     metadata(other.metadata)
 {
 }
@@ -122,6 +158,7 @@ block& block::operator=(block&& other)
     non_coinbase_inputs_ = other.non_coinbase_inputs_cache();
     header_ = std::move(other.header_);
     transactions_ = std::move(other.transactions_);
+    retained_ = std::move(other.retained_);
     metadata = std::move(other.metadata);
     return *this;
 }
@@ -163,10 +200,19 @@ block block::factory(reader& source, bool witness)
     return instance;
 }
 
+// static
+block block::factory(encoding_ptr data, size_t offset, bool witness,
+    bool lazy)
+{
+    block instance;
+    instance.from_data(data, offset, witness, lazy);
+    return instance;
+}
+
 bool block::from_data(const data_chunk& data, bool witness)
 {
-    data_source istream(data);
-    return from_data(istream, witness);
+    byte_reader source(data);
+    return from_data(source, witness);
 }
 
 bool block::from_data(std::istream& stream, bool witness)
@@ -175,6 +221,9 @@ bool block::from_data(std::istream& stream, bool witness)
     return from_data(source, witness);
 }
 
+// The smallest wire serialization of a transaction (no inputs or outputs).
+static constexpr size_t min_transaction_size = 4 + 1 + 1 + 4;
+
 // Full block deserialization is always canonical encoding.
 bool block::from_data(reader& source, bool witness)
 {
@@ -184,13 +233,9 @@ bool block::from_data(reader& source, bool witness)
     if (!header_.from_data(source, true))
         return false;
 
-    const auto count = source.read_size_little_endian();
-
     // Guard against potential for arbitary memory allocation.
-    if (count > max_block_size)
-        source.invalidate();
-    else
-        transactions_.resize(count);
+    transactions_.resize(read_count(source, min_transaction_size,
+        max_block_size));
 
     // Order is required, explicit loop allows early termination.
     for (auto& tx: transactions_)
@@ -208,12 +253,185 @@ bool block::from_data(reader& source, bool witness)
     return source;
 }
 
+// The smallest wire serializations of an input and an output (empty script).
+static constexpr size_t min_input_size = hash_size + 4 + 1 + 4;
+static constexpr size_t min_output_size = 8 + 1;
+
+// Skip a wire transaction, reading only its size prefixes. The bounds are
+// those of transaction::from_data, so each fails on the same input.
+static bool skip_transaction(reader& source)
+{
+    source.skip(sizeof(uint32_t));
+    auto inputs = read_count(source, min_input_size, max_block_size);
+
+    // Detect witness as no inputs (marker) and expected flag (bip144).
+    const auto marker = inputs == witness_marker &&
+        source.peek_byte() == witness_flag;
+
+    if (marker)
+    {
+        source.skip(1);
+        inputs = read_count(source, min_input_size, max_block_size);
+    }
+
+    for (size_t input = 0; input < inputs && source; ++input)
+    {
+        source.skip(hash_size + sizeof(uint32_t));
+        source.skip(read_count(source, 1, max_block_size));
+        source.skip(sizeof(uint32_t));
+    }
+
+    const auto outputs = read_count(source, min_output_size, max_block_size);
+
+    for (size_t output = 0; output < outputs && source; ++output)
+    {
+        source.skip(sizeof(uint64_t));
+        source.skip(read_count(source, 1, max_block_size));
+    }
+
+    if (marker)
+        for (size_t input = 0; input < inputs && source; ++input)
+            witness::skip(source);
+
+    source.skip(sizeof(uint32_t));
+    return source;
+}
+
+// Full block deserialization is always canonical encoding.
+bool block::from_data(const data_chunk& data, bool witness, threadpool& pool)
+{
+    metadata.start_deserialize = asio::steady_clock::now();
+    reset();
+
+    byte_reader source(data);
+
+    if (!header_.from_data(source, true))
+        return false;
+
+    // Guard against potential for arbitary memory allocation.
+    const auto count = read_count(source, min_transaction_size,
+        max_block_size);
+
+    // Record the end offset of each transaction, the start of the next.
+    std::vector<size_t> ends;
+    ends.reserve(count);
+    const auto start = data.size() - source.remaining();
+
+    for (size_t tx = 0; tx < count && skip_transaction(source); ++tx)
+        ends.push_back(data.size() - source.remaining());
+
+    if (!source)
+    {
+        reset();
+        metadata.end_deserialize = asio::steady_clock::now();
+        return false;
+    }
+
+    transactions_.resize(count);
+    auto& txs = transactions_;
+
+    // Each transaction is decoded from exactly its own bytes.
+    const auto decode = [&](size_t index)
+    {
+        const auto begin = index == 0 ? start : ends[index - 1];
+        byte_reader slice({ &data[begin], &data[begin] + ends[index] - begin });
+        auto& tx = txs[index];
+
+        if (!tx.from_data(slice, true, witness) || !slice.is_exhausted())
+            return code(error::bad_stream);
+
+        // Populate the hash and sigop caches while the tx is hot.
+        tx.hash();
+        if (witness)
+            tx.hash(true);
+
+        tx.signature_operations(false, false);
+        return code(error::success);
+    };
+
+    const auto ec = parallel_for(pool, count, transaction_grain, decode);
+
+    if (ec)
+        reset();
+
+    metadata.end_deserialize = asio::steady_clock::now();
+    return !ec;
+}
+
+// Full block deserialization is always canonical encoding.
+bool block::from_data(encoding_ptr data, size_t offset, bool witness,
+    bool lazy)
+{
+    metadata.start_deserialize = asio::steady_clock::now();
+    reset();
+
+    if (!data || offset > data->size())
+        return false;
+
+    const auto end = data->data() + data->size();
+    byte_reader source({ data->data() + offset, end });
+
+    if (!header_.from_data(source, true))
+        return false;
+
+    // Guard against potential for arbitary memory allocation.
+    transactions_.resize(read_count(source, min_transaction_size,
+        max_block_size));
+
+    // Each transaction retains its own bytes, which the reader then skips.
+    for (auto& tx: transactions_)
+    {
+        if (!source || !tx.from_data(data, data->size() - source.remaining(),
+            witness, lazy))
+        {
+            source.invalidate();
+            break;
+        }
+
+        source.skip(tx.encoding().size());
+    }
+
+    // TODO: optimize by having reader skip witness data.
+    if (!witness)
+        strip_witness();
+
+    if (!source)
+    {
+        reset();
+        metadata.end_deserialize = asio::steady_clock::now();
+        return false;
+    }
+
+    const auto base_retained = [](const transaction& tx)
+    {
+        return tx.is_retained(false);
+    };
+
+    const auto total_retained = [](const transaction& tx)
+    {
+        return tx.is_retained(true);
+    };
+
+    // Concatenated, the encodings of the transactions are those of the block.
+    const auto& txs = transactions_;
+    const auto base = std::all_of(txs.begin(), txs.end(), base_retained);
+    const auto total = std::all_of(txs.begin(), txs.end(), total_retained);
+    const auto size = (data->size() - offset) - source.remaining();
+
+    if (base || total)
+        retained_ = retained{ data, offset, size, base, total };
+
+    metadata.end_deserialize = asio::steady_clock::now();
+    return true;
+}
+
 // private
 void block::reset()
 {
     header_.reset();
     transactions_.clear();
     transactions_.shrink_to_fit();
+    retained_.reset();
 }
 
 bool block::is_valid() const
@@ -229,9 +447,8 @@ data_chunk block::to_data(bool witness) const
     data_chunk data;
     const auto size = serialized_size(witness);
     data.reserve(size);
-    data_sink ostream(data);
-    to_data(ostream);
-    ostream.flush();
+    byte_writer sink(data);
+    to_data(sink, witness);
     BITCOIN_ASSERT(data.size() == size);
     return data;
 }
@@ -245,6 +462,12 @@ void block::to_data(std::ostream& stream, bool witness) const
 // Full block serialization is always canonical encoding.
 void block::to_data(writer& sink, bool witness) const
 {
+    if (is_retained(witness))
+    {
+        sink.write_bytes(encoding());
+        return;
+    }
+
     header_.to_data(sink, true);
     sink.write_variable_little_endian(transactions_.size());
     const auto to = [&sink, witness](const transaction& tx)
@@ -269,12 +492,30 @@ hash_list block::to_hashes(bool witness) const
     return out;
 }
 
+// Each hash is written to its own position, so ordering is preserved.
+hash_list block::to_hashes(bool witness, threadpool& pool) const
+{
+    hash_list out(transactions_.size());
+    const auto& txs = transactions_;
+    const auto to_hash = [&out, &txs, witness](size_t index)
+    {
+        out[index] = txs[index].hash(witness);
+        return code(error::success);
+    };
+
+    parallel_for(pool, txs.size(), transaction_grain, to_hash);
+    return out;
+}
+
 // Properties (size, accessors, cache).
 //-----------------------------------------------------------------------------
 
 // Full block serialization is always canonical encoding.
 size_t block::serialized_size(bool witness) const
 {
+    if (is_retained(witness))
+        return retained_.peek()->size;
+
     size_t value;
 
     ///////////////////////////////////////////////////////////////////////////
@@ -321,6 +562,34 @@ size_t block::serialized_size(bool witness) const
     return value;
 }
 
+size_t block::heap_size() const
+{
+    auto size = transactions_.capacity() * sizeof(transaction) +
+        header_.heap_size();
+
+    for (const auto& tx: transactions_)
+        size += tx.heap_size();
+
+    return size;
+}
+
+data_slice block::encoding() const
+{
+    const auto value = retained_.peek();
+
+    if (value == nullptr)
+        return data_slice(nullptr, nullptr);
+
+    const auto begin = value->data->data() + value->offset;
+    return data_slice(begin, begin + value->size);
+}
+
+bool block::is_retained(bool witness) const
+{
+    const auto value = retained_.peek();
+    return value != nullptr && (witness ? value->total : value->base);
+}
+
 const chain::header& block::header() const
 {
     return header_;
@@ -329,11 +598,13 @@ const chain::header& block::header() const
 void block::set_header(const chain::header& value)
 {
     header_ = value;
+    retained_.reset();
 }
 
 void block::set_header(chain::header&& value)
 {
     header_ = std::move(value);
+    retained_.reset();
 }
 
 const transaction::list& block::transactions() const
@@ -349,6 +620,7 @@ void block::set_transactions(const transaction::list& value)
     non_coinbase_inputs_ = boost::none;
     base_size_ = boost::none;
     total_size_ = boost::none;
+    retained_.reset();
 }
 
 void block::set_transactions(transaction::list&& value)
@@ -359,6 +631,7 @@ void block::set_transactions(transaction::list&& value)
     non_coinbase_inputs_ = boost::none;
     base_size_ = boost::none;
     total_size_ = boost::none;
+    retained_.reset();
 }
 
 // Convenience property.
@@ -429,6 +702,11 @@ void block::strip_witness()
     segregated_ = false;
     total_size_ = boost::none;
     std::for_each(transactions_.begin(), transactions_.end(), strip);
+
+    // Only an encoding without witness remains that of the stripped block.
+    const auto value = retained_.peek();
+    if (value != nullptr && !value->base)
+        retained_.reset();
     ///////////////////////////////////////////////////////////////////////////
 }
 
@@ -472,6 +750,20 @@ size_t block::signature_operations(bool bip16, bool bip141) const
     return std::accumulate(txs.begin(), txs.end(), size_t{0}, value);
 }
 
+// Returns max_size_t in case of overflow.
+size_t block::signature_operations(bool bip16, bool bip141,
+    threadpool& pool) const
+{
+    const auto& txs = transactions_;
+    const auto value = [&txs, bip16, bip141](size_t index)
+    {
+        return txs[index].signature_operations(bip16, bip141);
+    };
+
+    return parallel_reduce(pool, txs.size(), transaction_grain, size_t{0},
+        value, ceiling_add<size_t>);
+}
+
 size_t block::total_non_coinbase_inputs() const
 {
     size_t value;
@@ -577,13 +869,13 @@ bool block::is_final(size_t height, uint32_t block_time) const
 // Distinctness is defined by transaction hash.
 bool block::is_distinct_transaction_set() const
 {
-    const auto hasher = [](const transaction& tx) { return tx.hash(); };
-    const auto& txs = transactions_;
-    hash_list hashes(txs.size());
-    std::transform(txs.begin(), txs.end(), hashes.begin(), hasher);
-    std::sort(hashes.begin(), hashes.end());
-    const auto distinct_end = std::unique(hashes.begin(), hashes.end());
-    return distinct_end == hashes.end();
+    flat_hash_set<hash_digest> hashes(transactions_.size());
+
+    for (const auto& tx: transactions_)
+        if (!hashes.insert(tx.hash()))
+            return false;
+
+    return true;
 }
 
 hash_digest block::generate_merkle_root(bool witness) const
@@ -591,24 +883,30 @@ hash_digest block::generate_merkle_root(bool witness) const
     if (transactions_.empty())
         return null_hash;
 
-    hash_list update;
     auto merkle = to_hashes(witness);
 
-    // Initial capacity is half of the original list (clear doesn't reset).
-    update.reserve((merkle.size() + 1) / 2);
+    // Each level is reduced in place, an odd level is padded by one hash.
+    merkle.reserve(merkle.size() + 1);
 
     while (merkle.size() > 1)
-    {
-        // If number of hashes is odd, duplicate last hash in the list.
-        if (merkle.size() % 2 != 0)
-            merkle.push_back(merkle.back());
+        merkle_hash_level(merkle);
 
-        for (auto it = merkle.begin(); it != merkle.end(); it += 2)
-            update.push_back(bitcoin_hash(build_chunk({ it[0], it[1] })));
+    // There is now only one item in the list.
+    return merkle.front();
+}
 
-        std::swap(merkle, update);
-        update.clear();
-    }
+hash_digest block::generate_merkle_root(bool witness, threadpool& pool) const
+{
+    if (transactions_.empty())
+        return null_hash;
+
+    auto merkle = to_hashes(witness, pool);
+
+    // Each level is reduced in place, an odd level is padded by one hash.
+    merkle.reserve(merkle.size() + 1);
+
+    while (merkle.size() > 1)
+        merkle_hash_level(merkle);
 
     // There is now only one item in the list.
     return merkle.front();
@@ -620,15 +918,15 @@ hash_digest block::generate_merkle_root(bool witness) const
 //*****************************************************************************
 bool block::is_forward_reference() const
 {
-    std::unordered_map<hash_digest, bool> hashes(transactions_.size());
+    flat_hash_set<hash_digest> hashes(transactions_.size());
     const auto is_forward = [&hashes](const input& input)
     {
-        return hashes.count(input.previous_output().hash()) != 0;
+        return hashes.contains(input.previous_output().hash());
     };
 
     for (const auto& tx: reverse(transactions_))
     {
-        hashes.emplace(tx.hash(), true);
+        hashes.insert(tx.hash());
 
         if (std::any_of(tx.inputs().begin(), tx.inputs().end(), is_forward))
             return true;
@@ -643,21 +941,53 @@ bool block::is_internal_double_spend() const
     if (transactions_.empty())
         return false;
 
-    point::list outs;
-    outs.reserve(total_non_coinbase_inputs());
     const auto& txs = transactions_;
+    flat_hash_set<point> outs(total_non_coinbase_inputs());
 
     // Merge the prevouts of all non-coinbase transactions into one set.
     for (auto tx = txs.begin() + 1; tx != txs.end(); ++tx)
+        for (const auto& input: tx->inputs())
+            if (!outs.insert(input.previous_output()))
+                return true;
+
+    return false;
+}
+
+// A forward reference is a spend of the same or a later transaction, so each
+// hash is mapped to its last position. Forward references take precedence,
+// so once a double spend is found only forward references are sought.
+code block::check_internal_spends() const
+{
+    const auto& txs = transactions_;
+
+    if (txs.empty())
+        return error::success;
+
+    flat_hash_map<hash_digest, size_t> positions(txs.size());
+    flat_hash_set<point> spends(total_non_coinbase_inputs());
+    auto double_spend = false;
+
+    for (size_t position = 0; position < txs.size(); ++position)
+        positions[txs[position].hash()] = position;
+
+    for (size_t position = 0; position < txs.size(); ++position)
     {
-        auto out = tx->previous_outputs();
-        std::move(out.begin(), out.end(), std::inserter(outs, outs.end()));
+        for (const auto& input: txs[position].inputs())
+        {
+            const auto& prevout = input.previous_output();
+            const auto spent = positions.find(prevout.hash());
+
+            if (spent != nullptr && *spent >= position)
+                return error::forward_reference;
+
+            // The first transaction is excluded, as the coinbase.
+            if (position != 0 && !double_spend)
+                double_spend = !spends.insert(prevout);
+        }
     }
 
-    std::sort(outs.begin(), outs.end());
-    const auto distinct_end = std::unique(outs.begin(), outs.end());
-    const auto distinct = (distinct_end == outs.end());
-    return !distinct;
+    return double_spend ? error::block_internal_double_spend :
+        error::success;
 }
 
 bool block::is_valid_merkle_root() const
@@ -678,6 +1008,56 @@ uint64_t block::fees() const
     return std::accumulate(txs.begin(), txs.end(), uint64_t{0}, value);
 }
 
+// Overflow returns max_uint64.
+uint64_t block::fees(threadpool& pool) const
+{
+    const auto& txs = transactions_;
+    const auto value = [&txs](size_t index)
+    {
+        return txs[index].fees();
+    };
+
+    return parallel_reduce(pool, txs.size(), transaction_grain, uint64_t{0},
+        value, ceiling_add<uint64_t>);
+}
+
+muhash block::utxo_delta(size_t height) const
+{
+    muhash set;
+
+    for (const auto& tx: transactions_)
+        tx.utxo_delta(set, height);
+
+    return set;
+}
+
+// Each chunk of transactions is applied to one partial set, as combining sets
+// costs two multiplications.
+muhash block::utxo_delta(size_t height, threadpool& pool) const
+{
+    const auto& txs = transactions_;
+    const auto chunks = (txs.size() + transaction_grain - 1) /
+        transaction_grain;
+
+    const auto value = [&txs, height](size_t chunk)
+    {
+        muhash set;
+        const auto end = std::min(txs.size(), (chunk + 1) * transaction_grain);
+
+        for (auto index = chunk * transaction_grain; index < end; ++index)
+            txs[index].utxo_delta(set, height);
+
+        return set;
+    };
+
+    const auto combine = [](muhash left, const muhash& right)
+    {
+        return left *= right;
+    };
+
+    return parallel_reduce(pool, chunks, 1, muhash{}, value, combine);
+}
+
 uint64_t block::claim() const
 {
     return transactions_.empty() ? 0 :
@@ -786,12 +1166,93 @@ code block::accept_transactions(const chain_state& state) const
 code block::connect_transactions(const chain_state& state) const
 {
     code ec;
+    const auto timing = metadata.timing;
+
+    if (timing == nullptr)
+    {
+        for (const auto& tx: transactions_)
+            if ((ec = tx.connect(state)))
+                return ec;
+
+        return error::success;
+    }
+
+    script_profile::operation_metrics signatures{ 0, {} };
+    script::record_signatures(&signatures);
 
     for (const auto& tx: transactions_)
         if ((ec = tx.connect(state)))
-            return ec;
+            break;
 
-    return error::success;
+    script::record_signatures(nullptr);
+    timing->signature_count += signatures.count;
+    timing->signatures += signatures.elapsed;
+    return ec;
+}
+
+code block::check_transactions(uint64_t max_money, threadpool& pool) const
+{
+    const auto& txs = transactions_;
+    const auto check = [&txs, max_money](size_t index)
+    {
+        return txs[index].check(max_money, false);
+    };
+
+    return parallel_for(pool, txs.size(), transaction_grain, check);
+}
+
+code block::accept_transactions(const chain_state& state,
+    threadpool& pool) const
+{
+    const auto& txs = transactions_;
+    const auto accept = [&txs, &state](size_t index)
+    {
+        return txs[index].accept(state, false);
+    };
+
+    return parallel_for(pool, txs.size(), transaction_grain, accept);
+}
+
+// Inputs are connected individually, as script verification dominates.
+// Coinbase inputs are not connected.
+code block::connect_transactions(const chain_state& state,
+    threadpool& pool) const
+{
+    const block_validation_view view(*this);
+    const auto timing = metadata.timing;
+
+    if (timing == nullptr)
+        return view.connect(state, pool);
+
+    const auto& positions = view.positions();
+    const auto& indexes = view.indexes();
+    const auto connect = [this, &positions, &indexes, &state](size_t index)
+    {
+        const auto& tx = transactions_[positions[index]];
+        return tx.connect_input(state, indexes[index]);
+    };
+
+    // Signature checks are recorded per input and totalled over threads.
+    std::atomic<uint64_t> signature_count(0);
+    std::atomic<uint64_t> signature_nanoseconds(0);
+
+    const auto measured = [&connect, &signature_count,
+        &signature_nanoseconds](size_t index)
+    {
+        script_profile::operation_metrics signatures{ 0, {} };
+        script::record_signatures(&signatures);
+        const auto ec = connect(index);
+        script::record_signatures(nullptr);
+
+        signature_count += signatures.count;
+        signature_nanoseconds += signatures.elapsed.count();
+        return ec;
+    };
+
+    const auto ec = parallel_for(pool, view.size(), 1, measured);
+    timing->signature_count += signature_count;
+    timing->signatures += validation_timing::duration(signature_nanoseconds);
+    return ec;
 }
 
 // Validation.
@@ -801,9 +1262,47 @@ code block::connect_transactions(const chain_state& state) const
 code block::check(uint64_t max_money, uint32_t timestamp_limit_seconds,
     uint32_t proof_of_work_limit, bool scrypt) const
 {
+    return check(max_money, timestamp_limit_seconds, proof_of_work_limit,
+        scrypt, nullptr);
+}
+
+code block::check(uint64_t max_money, uint32_t timestamp_limit_seconds,
+    uint32_t proof_of_work_limit, threadpool& pool, bool scrypt) const
+{
+    return check(max_money, timestamp_limit_seconds, proof_of_work_limit,
+        scrypt, &pool);
+}
+
+// private
+code block::check(uint64_t max_money, uint32_t timestamp_limit_seconds,
+    uint32_t proof_of_work_limit, bool scrypt, threadpool* pool) const
+{
+    BC_TRACE_SPAN("validation", "block.check");
     metadata.start_check = asio::steady_clock::now();
 
     code ec;
+    const auto timing = metadata.timing;
+
+    const auto first_not_coinbase = [this]()
+    {
+        return !transactions_.front().is_coinbase();
+    };
+
+    const auto extra_coinbases = [this]()
+    {
+        return is_extra_coinbases();
+    };
+
+    const auto internal_spends = [this]()
+    {
+        return check_internal_spends();
+    };
+
+    const auto merkle_root = [this, pool]()
+    {
+        return pool == nullptr ? generate_merkle_root() :
+            generate_merkle_root(false, *pool);
+    };
 
     if ((ec = header_.check(timestamp_limit_seconds, proof_of_work_limit,
         scrypt)))
@@ -816,26 +1315,24 @@ code block::check(uint64_t max_money, uint32_t timestamp_limit_seconds,
     else if (transactions_.empty())
         return error::empty_block;
 
-    else if (!transactions_.front().is_coinbase())
+    else if (timed(timing, &validation_timing::coinbase, first_not_coinbase))
         return error::first_not_coinbase;
 
-    else if (is_extra_coinbases())
+    else if (timed(timing, &validation_timing::coinbase, extra_coinbases))
         return error::extra_coinbases;
 
-    // TODO: determinable from tx pool graph.
-    else if (is_forward_reference())
-        return error::forward_reference;
-
     // This is subset of is_internal_double_spend if collisions cannot happen.
     ////else if (!is_distinct_transaction_set())
     ////    return error::internal_duplicate;
 
     // TODO: determinable from tx pool graph.
-    else if (is_internal_double_spend())
-        return error::block_internal_double_spend;
+    else if ((ec = timed(timing, &validation_timing::double_spend,
+        internal_spends)))
+        return ec;
 
     // TODO: relates height to tx.hash(false) (pool cache).
-    else if (!is_valid_merkle_root())
+    else if (timed(timing, &validation_timing::merkle_root, merkle_root) !=
+        header_.merkle())
         return error::merkle_mismatch;
 
     // We cannot know if bip16 is enabled at this point so we disable it.
@@ -845,8 +1342,11 @@ code block::check(uint64_t max_money, uint32_t timestamp_limit_seconds,
     ////else if (signature_operations(false, false) > max_block_sigops)
     ////    return error::block_legacy_sigop_limit;
 
-    else
+    else if (pool == nullptr)
         return check_transactions(max_money);
+
+    else
+        return check_transactions(max_money, *pool);
 }
 
 code block::accept(const bc::settings& settings, bool transactions, bool header)
@@ -861,6 +1361,25 @@ code block::accept(const bc::settings& settings, bool transactions, bool header)
 code block::accept(const chain_state& state, const bc::settings& settings,
     bool transactions, bool header) const
 {
+    const auto value = subsidy(state.height(), settings.subsidy_interval(),
+        settings.bitcoin_to_satoshi(settings.initial_block_subsidy_bitcoin()));
+    return accept(state, value, transactions, header, nullptr);
+}
+
+code block::accept(const chain_state& state, const bc::settings& settings,
+    threadpool& pool, bool transactions, bool header) const
+{
+    const auto value = subsidy(state.height(), settings.subsidy_interval(),
+        settings.bitcoin_to_satoshi(settings.initial_block_subsidy_bitcoin()));
+    return accept(state, value, transactions, header, &pool);
+}
+
+// private
+// The subsidy is that of the state height under the network parameters.
+code block::accept(const chain_state& state, uint64_t subsidy,
+    bool transactions, bool header, threadpool* pool) const
+{
+    BC_TRACE_SPAN("validation", "block.accept");
     metadata.start_accept = asio::steady_clock::now();
 
     code ec;
@@ -872,6 +1391,34 @@ code block::accept(const chain_state& state, const bc::settings& settings,
     const auto max_sigops = bip141 ? max_fast_sigops : max_block_sigops;
     const auto block_time = bip113 ? state.median_time_past() :
         header_.timestamp();
+    const auto timing = metadata.timing;
+
+    const auto invalid_coinbase_script = [this, &state, bip34]()
+    {
+        return bip34 && !is_valid_coinbase_script(state.height());
+    };
+
+    const auto invalid_coinbase_claim = [this, subsidy]()
+    {
+        return claim() > ceiling_add(fees(), subsidy);
+    };
+
+    const auto non_final = [this, &state, block_time]()
+    {
+        return !is_final(state.height(), block_time);
+    };
+
+    const auto sigops = [this, pool, timing, bip16, bip141]()
+    {
+        const auto count = pool == nullptr ?
+            signature_operations(bip16, bip141) :
+            signature_operations(bip16, bip141, *pool);
+
+        if (timing != nullptr)
+            timing->sigop_count = count;
+
+        return count;
+    };
 
     if (header && (ec = header_.accept(state)))
         return ec;
@@ -883,17 +1430,17 @@ code block::accept(const chain_state& state, const bc::settings& settings,
     else if (bip141 && weight() > max_block_weight)
         return error::block_weight_limit;
 
-    else if (bip34 && !is_valid_coinbase_script(state.height()))
+    else if (timed(timing, &validation_timing::coinbase,
+        invalid_coinbase_script))
         return error::coinbase_height_mismatch;
 
     // TODO: relates height to total of tx.fee (pool cach).
-    else if (!is_valid_coinbase_claim(state.height(),
-            settings.subsidy_interval(), settings.bitcoin_to_satoshi(
-                settings.initial_block_subsidy_bitcoin())))
+    else if (timed(timing, &validation_timing::coinbase,
+        invalid_coinbase_claim))
         return error::coinbase_value_limit;
 
     // TODO: relates median time past to tx.locktime (pool cache min tx.time).
-    else if (!is_final(state.height(), block_time))
+    else if (timed(timing, &validation_timing::finality, non_final))
         return error::block_non_final;
 
     // TODO: relates height to tx.hash(true) (pool cache).
@@ -902,12 +1449,16 @@ code block::accept(const chain_state& state, const bc::settings& settings,
 
     // TODO: determine if performance benefit is worth excluding sigops here.
     // TODO: relates block limit to total of tx.sigops (pool cache).
-    else if (transactions && signature_operations(bip16, bip141) > max_sigops)
+    else if (transactions && timed(timing, &validation_timing::sigops,
+        sigops) > max_sigops)
         return error::block_embedded_sigop_limit;
 
-    else if (transactions)
+    else if (transactions && pool == nullptr)
         return accept_transactions(state);
 
+    else if (transactions)
+        return accept_transactions(state, *pool);
+
     else
         return ec;
 }
@@ -920,13 +1471,176 @@ code block::connect() const
 
 code block::connect(const chain_state& state) const
 {
+    BC_TRACE_SPAN("validation", "block.connect");
     metadata.start_connect = asio::steady_clock::now();
 
     if (state.is_under_checkpoint())
         return error::success;
 
-    else
+    const auto timing = metadata.timing;
+    if (timing == nullptr)
         return connect_transactions(state);
+
+    const auto ec = connect_transactions(state);
+    timing->input_count = total_non_coinbase_inputs();
+    timing->connect += elapsed(metadata.start_connect);
+    return ec;
+}
+
+code block::connect(threadpool& pool) const
+{
+    const auto state = header_.metadata.state;
+    return state ? connect(*state, pool) : error::operation_failed;
+}
+
+code block::connect(const chain_state& state, threadpool& pool) const
+{
+    BC_TRACE_SPAN("validation", "block.connect");
+    metadata.start_connect = asio::steady_clock::now();
+
+    if (state.is_under_checkpoint())
+        return error::success;
+
+    const auto timing = metadata.timing;
+    if (timing == nullptr)
+        return connect_transactions(state, pool);
+
+    const auto ec = connect_transactions(state, pool);
+    timing->input_count = total_non_coinbase_inputs();
+    timing->connect += elapsed(metadata.start_connect);
+    return ec;
+}
+
+// Previous outputs.
+//-----------------------------------------------------------------------------
+
+// private
+// An output of an earlier transaction of the block is populated as if
+// confirmed at the height of the block, so it matures with the block.
+output_point::list block::previous_outputs(size_t height,
+    uint32_t median_time_past, bool populate) const
+{
+    output_point::list points;
+
+    if (transactions_.empty())
+        return points;
+
+    flat_hash_map<hash_digest, size_t> positions(transactions_.size());
+    points.reserve(total_non_coinbase_inputs());
+    positions.insert(transactions_.front().hash(), 0);
+
+    // A spend of a later transaction (forward reference) is missing.
+    for (size_t position = 1; position < transactions_.size(); ++position)
+    {
+        const auto& tx = transactions_[position];
+
+        for (const auto& input: tx.inputs())
+        {
+            const auto& prevout = input.previous_output();
+            const auto previous_position = positions.find(prevout.hash());
+
+            if (previous_position == nullptr)
+            {
+                points.push_back(prevout);
+                continue;
+            }
+
+            if (!populate)
+                continue;
+
+            const auto& outputs = transactions_[*previous_position].outputs();
+            const auto index = prevout.index();
+            auto& previous = *prevout.metadata;
+            previous.cache = index < outputs.size() ? outputs[index] :
+                output{};
+            previous.spent = false;
+            previous.candidate = false;
+            previous.confirmed = false;
+            previous.coinbase = (*previous_position == 0);
+            previous.height = height;
+            previous.median_time_past = median_time_past;
+        }
+
+        // The first of duplicate transaction hashes is retained.
+        positions.insert(tx.hash(), position);
+    }
+
+    std::sort(points.begin(), points.end());
+    points.erase(std::unique(points.begin(), points.end()), points.end());
+    return points;
+}
+
+output_point::list block::missing_previous_outputs() const
+{
+    return previous_outputs(0, 0, false);
+}
+
+// private
+code block::populate_previous_outputs(size_t height,
+    uint32_t median_time_past, prevout_source& source) const
+{
+    BC_TRACE_SPAN("validation", "block.populate");
+    metadata.start_populate = asio::steady_clock::now();
+    const auto points = previous_outputs(height, median_time_past, true);
+
+    if (points.empty())
+        return error::success;
+
+    const auto fetch = [&source, &points]()
+    {
+        BC_TRACE_SPAN("prevout", "fetch");
+        return source.populate(points);
+    };
+
+    const auto ec = fetch();
+
+    if (ec)
+        return ec;
+
+    const auto& txs = transactions_;
+
+    // Scatter the metadata of each distinct point to each of its spends.
+    for (auto tx = txs.begin() + 1; tx != txs.end(); ++tx)
+    {
+        for (const auto& input: tx->inputs())
+        {
+            const auto& prevout = input.previous_output();
+            const auto it = std::lower_bound(points.begin(), points.end(),
+                prevout);
+
+            if (it != points.end() && *it == prevout)
+                prevout.metadata = it->metadata;
+        }
+    }
+
+    return error::success;
+}
+
+code block::populate_previous_outputs(const chain_state& state,
+    prevout_source& source) const
+{
+    return populate_previous_outputs(state.height(),
+        state.median_time_past(), source);
+}
+
+void block::populate_previous_outputs(const chain_state& state,
+    prevout_source& source, threadpool& pool, result_handler handler) const
+{
+    const auto height = state.height();
+    const auto median_time_past = state.median_time_past();
+
+    // An empty pool has no thread to run the lookup.
+    if (pool.size() == 0)
+    {
+        handler(populate_previous_outputs(height, median_time_past, source));
+        return;
+    }
+
+    pool.service().post([this, height, median_time_past, &source, handler]()
+    {
+        BC_TRACE_SPAN("threadpool", "populate");
+        handler(populate_previous_outputs(height, median_time_past, source));
+    });
 }
 
 } // namespace chain
@@ -0,0 +1,401 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/chain/block_archive.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <bitcoin/bitcoin/chain/block.hpp>
+#include <bitcoin/bitcoin/chain/header.hpp>
+#include <bitcoin/bitcoin/chain/input.hpp>
+#include <bitcoin/bitcoin/chain/output.hpp>
+#include <bitcoin/bitcoin/chain/output_point.hpp>
+#include <bitcoin/bitcoin/chain/script.hpp>
+#include <bitcoin/bitcoin/chain/script_dictionary.hpp>
+#include <bitcoin/bitcoin/chain/transaction.hpp>
+#include <bitcoin/bitcoin/chain/witness.hpp>
+#include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/reader.hpp>
+#include <bitcoin/bitcoin/utility/writer.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+typedef std::unordered_map<hash_digest, size_t> hash_positions;
+
+static const uint8_t witness_flag = 0x01;
+
+// The fewest bytes of an encoded input, output and transaction.
+static const size_t minimum_input_size = 4;
+static const size_t minimum_output_size = 2;
+static const size_t minimum_transaction_size = 5;
+
+// Read a base 128 count of elements of at least the minimum size each, so
+// that allocation is bounded by the remaining bytes.
+static size_t read_base128_count(reader& source, size_t minimum_size)
+{
+    const auto count = source.read_variable_base128();
+
+    if (count > source.remaining() / minimum_size)
+    {
+        source.invalidate();
+        return 0;
+    }
+
+    return static_cast<size_t>(count);
+}
+
+static uint32_t read_base128_uint32(reader& source)
+{
+    const auto value = source.read_variable_base128();
+
+    if (value > max_uint32)
+        source.invalidate();
+
+    return static_cast<uint32_t>(value);
+}
+
+// The hashes referenced by more than one input, in order of first reference.
+static std::vector<hash_digest> to_hashes(const block& block)
+{
+    hash_positions counts;
+    std::vector<hash_digest> order;
+
+    for (const auto& tx: block.transactions())
+        for (const auto& input: tx.inputs())
+        {
+            const auto& hash = input.previous_output().hash();
+
+            if (++counts[hash] == 2)
+                order.push_back(hash);
+        }
+
+    return order;
+}
+
+// Encoding.
+//-----------------------------------------------------------------------------
+
+static void write_transaction(writer& sink, const transaction& tx,
+    const hash_positions& positions, const script_dictionary& dictionary)
+{
+    const auto witness = tx.is_segregated();
+    sink.write_variable_base128(tx.version());
+    sink.write_byte(witness ? witness_flag : 0);
+    sink.write_variable_base128(tx.inputs().size());
+
+    for (const auto& input: tx.inputs())
+    {
+        const auto& point = input.previous_output();
+        const auto it = positions.find(point.hash());
+
+        if (it == positions.end())
+        {
+            sink.write_variable_base128(0);
+            sink.write_hash(point.hash());
+        }
+        else
+        {
+            sink.write_variable_base128(it->second + 1);
+        }
+
+        // The null index wraps to zero.
+        sink.write_variable_base128(static_cast<uint32_t>(point.index() + 1));
+        input.script().to_compact(sink);
+        sink.write_variable_base128(max_input_sequence - input.sequence());
+
+        if (witness)
+            input.witness().to_data(sink, true);
+    }
+
+    sink.write_variable_base128(tx.outputs().size());
+
+    for (const auto& output: tx.outputs())
+    {
+        const auto position = dictionary.find(output.script().bytes());
+
+        if (position == dictionary.size())
+        {
+            sink.write_variable_base128(0);
+            output.to_compact(sink);
+        }
+        else
+        {
+            sink.write_variable_base128(position + 1);
+            output::write_compact_value(sink, output.value());
+        }
+    }
+
+    sink.write_variable_base128(tx.locktime());
+}
+
+data_chunk block_archive::encode(const block& block,
+    const script_dictionary& dictionary)
+{
+    const auto hashes = to_hashes(block);
+    hash_positions positions;
+
+    for (size_t position = 0; position < hashes.size(); ++position)
+        positions.emplace(hashes[position], position);
+
+    const auto& txs = block.transactions();
+    std::vector<data_chunk> records(txs.size());
+
+    for (size_t position = 0; position < txs.size(); ++position)
+    {
+        byte_writer sink(records[position]);
+        write_transaction(sink, txs[position], positions, dictionary);
+    }
+
+    data_chunk data;
+    byte_writer sink(data);
+    block.header().to_data(sink);
+    sink.write_variable_base128(hashes.size());
+
+    for (const auto& hash: hashes)
+        sink.write_hash(hash);
+
+    sink.write_variable_base128(records.size());
+
+    for (const auto& record: records)
+        sink.write_variable_base128(record.size());
+
+    for (const auto& record: records)
+        sink.write_bytes(record);
+
+    return data;
+}
+
+// Decoding.
+//-----------------------------------------------------------------------------
+
+static bool read_input(reader& source, input& out,
+    const std::vector<hash_digest>& hashes, bool witness)
+{
+    const auto reference = source.read_variable_base128();
+    hash_digest hash;
+
+    if (reference == 0)
+    {
+        hash = source.read_hash();
+    }
+    else if (reference <= hashes.size())
+    {
+        hash = hashes[static_cast<size_t>(reference - 1)];
+    }
+    else
+    {
+        source.invalidate();
+        return false;
+    }
+
+    const auto index = read_base128_uint32(source) - 1;
+    chain::script script;
+    script.from_compact(source);
+    const auto sequence = max_input_sequence - read_base128_uint32(source);
+    chain::witness stack;
+
+    if (witness)
+        stack.from_data(source, true);
+
+    if (!source)
+        return false;
+
+    out = input({ std::move(hash), index }, std::move(script),
+        std::move(stack), sequence);
+    return true;
+}
+
+static bool read_output(reader& source, output& out,
+    const script_dictionary& dictionary)
+{
+    const auto reference = source.read_variable_base128();
+
+    if (reference == 0)
+        return out.from_compact(source);
+
+    if (reference > dictionary.size())
+    {
+        source.invalidate();
+        return false;
+    }
+
+    const auto value = output::read_compact_value(source);
+
+    if (!source)
+        return false;
+
+    out = output(value, dictionary.at(static_cast<size_t>(reference - 1)));
+    return true;
+}
+
+static bool read_transaction(reader& source, transaction& out,
+    const std::vector<hash_digest>& hashes,
+    const script_dictionary& dictionary)
+{
+    const auto version = read_base128_uint32(source);
+    const auto flags = source.read_byte();
+
+    if (flags > witness_flag)
+        source.invalidate();
+
+    input::list inputs(read_base128_count(source, minimum_input_size));
+
+    for (auto& input: inputs)
+        if (!read_input(source, input, hashes, flags == witness_flag))
+            return false;
+
+    output::list outputs(read_base128_count(source, minimum_output_size));
+
+    for (auto& output: outputs)
+        if (!read_output(source, output, dictionary))
+            return false;
+
+    const auto locktime = read_base128_uint32(source);
+
+    if (!source)
+        return false;
+
+    out = transaction(version, locktime, std::move(inputs),
+        std::move(outputs));
+    return true;
+}
+
+block_archive::block_archive(const script_dictionary& dictionary)
+  : dictionary_(dictionary), open_(false)
+{
+}
+
+bool block_archive::open(data_slice data)
+{
+    close();
+    open_ = read_index(data);
+
+    if (!open_)
+        close();
+
+    return open_;
+}
+
+// private
+// The sizes of the transactions must account for all bytes that follow.
+bool block_archive::read_index(data_slice data)
+{
+    byte_reader source(data);
+
+    if (!header_.from_data(source))
+        return false;
+
+    hashes_.resize(read_base128_count(source, hash_size));
+
+    for (auto& hash: hashes_)
+        hash = source.read_hash();
+
+    const auto count = read_base128_count(source, minimum_transaction_size);
+    std::vector<size_t> sizes(count);
+    size_t total = 0;
+
+    for (auto& size: sizes)
+    {
+        size = static_cast<size_t>(source.read_variable_base128());
+
+        if (size > source.remaining())
+            return false;
+
+        total += size;
+    }
+
+    if (!source || total != source.remaining())
+        return false;
+
+    auto offset = data.end() - total;
+    offsets_.reserve(count + 1);
+
+    for (const auto size: sizes)
+    {
+        offsets_.push_back(offset);
+        offset += size;
+    }
+
+    offsets_.push_back(offset);
+    return true;
+}
+
+void block_archive::close()
+{
+    header_ = {};
+    hashes_.clear();
+    offsets_.clear();
+    open_ = false;
+}
+
+bool block_archive::is_open() const
+{
+    return open_;
+}
+
+const chain::header& block_archive::header() const
+{
+    return header_;
+}
+
+size_t block_archive::size() const
+{
+    return offsets_.empty() ? 0 : offsets_.size() - 1;
+}
+
+size_t block_archive::size(size_t position) const
+{
+    return position < size() ?
+        offsets_[position + 1] - offsets_[position] : 0;
+}
+
+bool block_archive::read(transaction& out, size_t position) const
+{
+    if (position >= size())
+        return false;
+
+    byte_reader source({ offsets_[position], offsets_[position + 1] });
+    return read_transaction(source, out, hashes_, dictionary_) &&
+        source.is_exhausted();
+}
+
+bool block_archive::read(block& out) const
+{
+    if (!open_)
+        return false;
+
+    transaction::list txs(size());
+
+    for (size_t position = 0; position < txs.size(); ++position)
+        if (!read(txs[position], position))
+            return false;
+
+    out = block(chain::header(header_), std::move(txs));
+    return out.is_valid_merkle_root();
+}
+
+} // namespace chain
+} // namespace libbitcoin
@@ -0,0 +1,318 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/chain/block_assembler.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <bitcoin/bitcoin/chain/block.hpp>
+#include <bitcoin/bitcoin/chain/chain_state.hpp>
+#include <bitcoin/bitcoin/chain/header.hpp>
+#include <bitcoin/bitcoin/chain/input.hpp>
+#include <bitcoin/bitcoin/chain/merkle_tree.hpp>
+#include <bitcoin/bitcoin/chain/output.hpp>
+#include <bitcoin/bitcoin/chain/script.hpp>
+#include <bitcoin/bitcoin/chain/transaction.hpp>
+#include <bitcoin/bitcoin/chain/transaction_pool_index.hpp>
+#include <bitcoin/bitcoin/chain/witness.hpp>
+#include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/machine/number.hpp>
+#include <bitcoin/bitcoin/machine/opcode.hpp>
+#include <bitcoin/bitcoin/machine/operation.hpp>
+#include <bitcoin/bitcoin/machine/rule_fork.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/settings.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/endian.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+using namespace bc::machine;
+
+typedef transaction_pool_index::entry entry;
+typedef transaction_pool_index::entries entries;
+typedef transaction_pool_index::totals totals;
+
+// The selection stops after this many consecutive failures near full.
+static constexpr size_t maximum_failures = 1000;
+
+// Virtual size is weight divided by four, rounded up (bip141).
+static constexpr size_t weight_per_size = 4;
+
+block_assembler::block_assembler(const transaction_pool_index& pool,
+    size_t max_weight, size_t max_sigops)
+  : pool_(pool), max_weight_(max_weight), max_sigops_(max_sigops)
+{
+}
+
+// Selection.
+//-----------------------------------------------------------------------------
+
+entries block_assembler::select(const chain_state& state,
+    uint32_t timestamp) const
+{
+    const auto bip113 = state.is_enabled(rule_fork::bip113_rule);
+    const auto height = state.height();
+    const auto block_time = bip113 ? state.median_time_past() :
+        std::max(timestamp, state.median_time_past() + 1);
+    const auto weight_limit = max_weight_ > coinbase_weight ?
+        max_weight_ - coinbase_weight : 0;
+    const auto sigop_limit = max_sigops_ > coinbase_sigops ?
+        max_sigops_ - coinbase_sigops : 0;
+
+    entries selected;
+    size_t weight = 0;
+    size_t sigops = 0;
+    size_t failures = 0;
+    std::unordered_set<const entry*> included;
+    std::unordered_set<const entry*> failed;
+
+    // Ancestor totals of entries with selected ancestors, less those.
+    std::unordered_map<const entry*, totals> modified;
+
+    const auto higher_rate = [&modified](const entry* left,
+        const entry* right)
+    {
+        const auto& first = modified.at(left);
+        const auto& second = modified.at(right);
+        const auto higher = static_cast<double>(first.fees) * second.size;
+        const auto lower = static_cast<double>(second.fees) * first.size;
+        return higher == lower ? left->hash < right->hash : higher > lower;
+    };
+
+    std::set<const entry*, decltype(higher_rate)> queue(higher_rate);
+
+    // Select the candidate with its unselected ancestors, or fail it.
+    const auto add_package = [&](const entry& candidate)
+    {
+        auto package = pool_.ancestors(candidate);
+        package.erase(std::remove_if(package.begin(), package.end(),
+            [&included](const entry* value)
+            {
+                return included.count(value) != 0;
+            }), package.end());
+        package.push_back(&candidate);
+
+        size_t package_weight = 0;
+        size_t package_sigops = 0;
+        auto final = true;
+
+        for (const auto value: package)
+        {
+            package_weight += value->size * weight_per_size;
+            package_sigops += value->sigops;
+            final &= value->tx.is_final(height, block_time);
+        }
+
+        if (!final || weight + package_weight > weight_limit ||
+            sigops + package_sigops > sigop_limit)
+        {
+            failed.insert(&candidate);
+            return false;
+        }
+
+        // An ancestor has fewer ancestors than each of its descendants.
+        std::sort(package.begin(), package.end(),
+            [](const entry* left, const entry* right)
+            {
+                return left->ancestors.count < right->ancestors.count;
+            });
+
+        for (const auto value: package)
+        {
+            included.insert(value);
+            selected.push_back(value);
+
+            if (modified.count(value) != 0)
+            {
+                queue.erase(value);
+                modified.erase(value);
+            }
+        }
+
+        weight += package_weight;
+        sigops += package_sigops;
+
+        // Reorder the unselected descendants by their remaining ancestors.
+        for (const auto value: package)
+        {
+            for (const auto descendant: pool_.descendants(*value))
+            {
+                if (included.count(descendant) != 0)
+                    continue;
+
+                const auto it = modified.find(descendant);
+
+                if (it == modified.end())
+                    modified.emplace(descendant, descendant->ancestors);
+                else
+                    queue.erase(descendant);
+
+                auto& remaining = modified.at(descendant);
+                remaining.count -= 1;
+                remaining.size -= value->size;
+                remaining.fees -= value->fee;
+                remaining.sigops -= value->sigops;
+                queue.insert(descendant);
+            }
+        }
+
+        return true;
+    };
+
+    const auto full = [&]()
+    {
+        return failures > maximum_failures &&
+            weight + coinbase_weight > weight_limit;
+    };
+
+    // Take the modified candidate first while its rate is higher.
+    const auto drain = [&](const entry* next)
+    {
+        while (!queue.empty() && !full())
+        {
+            const auto top = *queue.begin();
+
+            if (next != nullptr)
+            {
+                const auto& first = modified.at(top);
+                const auto& second = next->ancestors;
+                const auto higher = static_cast<double>(first.fees) *
+                    second.size;
+                const auto lower = static_cast<double>(second.fees) *
+                    first.size;
+
+                if (higher <= lower)
+                    return;
+            }
+
+            queue.erase(queue.begin());
+            modified.erase(top);
+            failures = add_package(*top) ? 0 : failures + 1;
+        }
+    };
+
+    pool_.visit([&](const entry& candidate)
+    {
+        drain(&candidate);
+
+        if (full())
+            return false;
+
+        if (included.count(&candidate) != 0 ||
+            failed.count(&candidate) != 0 ||
+            modified.count(&candidate) != 0)
+            return true;
+
+        failures = add_package(candidate) ? 0 : failures + 1;
+        return true;
+    });
+
+    drain(nullptr);
+    return selected;
+}
+
+// Template.
+//-----------------------------------------------------------------------------
+
+block block_assembler::assemble(const chain_state& state,
+    const settings& settings, const hash_digest& parent,
+    const script& pay_to, uint32_t timestamp) const
+{
+    const auto height = state.height();
+    const auto bip141 = state.is_enabled(rule_fork::bip141_rule);
+    const auto time = std::max(timestamp, state.median_time_past() + 1);
+    const auto selected = select(state, time);
+
+    transaction::list transactions;
+    hash_list hashes;
+    hash_list witness_hashes;
+    transactions.reserve(selected.size() + 1);
+    hashes.reserve(selected.size() + 1);
+    witness_hashes.reserve(selected.size() + 1);
+    uint64_t fees = 0;
+
+    // The coinbase leaves are set once the fees are known.
+    transactions.emplace_back();
+    hashes.push_back(null_hash);
+    witness_hashes.push_back(null_hash);
+
+    for (const auto value: selected)
+    {
+        fees += value->fee;
+        transactions.push_back(value->tx);
+        hashes.push_back(value->hash);
+        witness_hashes.push_back(value->tx.hash(true));
+    }
+
+    // The height is pushed as a nominal push (bip34), with an extra nonce.
+    const script signature(operation::list
+    {
+        { number(height).data(), false },
+        { data_chunk(sizeof(uint32_t), 0), false }
+    });
+
+    const auto subsidy = block::subsidy(height, settings.subsidy_interval(),
+        settings.bitcoin_to_satoshi(settings.initial_block_subsidy_bitcoin()));
+
+    output::list outputs{ { subsidy + fees, pay_to } };
+    input::list inputs
+    {
+        { { null_hash, point::null_index }, signature, max_input_sequence }
+    };
+
+    // The witness root does not depend on the coinbase (bip141), so the
+    // commitment is of the witness root and a null reserved value.
+    if (bip141)
+    {
+        const hash_digest reserved = null_hash;
+        const auto root = coinbase_merkle(witness_hashes).root(null_hash);
+        const auto commitment = bitcoin_hash(build_chunk({ root, reserved }));
+        const auto head = to_big_endian(witness_head);
+        outputs.push_back({ 0, script(script::to_pay_null_data_pattern(
+            build_chunk({ head, commitment }))) });
+        inputs.front().set_witness(witness(data_stack{ to_chunk(reserved) }));
+    }
+
+    transactions.front() = { 1, 0, std::move(inputs), std::move(outputs) };
+    const auto root = coinbase_merkle(hashes).root(
+        transactions.front().hash());
+
+    block instance;
+    instance.set_transactions(std::move(transactions));
+    instance.set_header(
+    {
+        state.minimum_block_version(),
+        parent,
+        root,
+        time,
+        state.work_required(),
+        0
+    });
+
+    return instance;
+}
+
+} // namespace chain
+} // namespace libbitcoin
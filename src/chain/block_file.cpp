@@ -0,0 +1,120 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/chain/block_file.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <boost/filesystem.hpp>
+#include <boost/system/error_code.hpp>
+#include <bitcoin/bitcoin/chain/header.hpp>
+#include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/endian.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+block_file::block_file(uint32_t magic)
+  : magic_(magic), position_(0)
+{
+}
+
+bool block_file::open(const path& file)
+{
+    close();
+    boost::system::error_code ec;
+
+    // An empty file cannot be mapped.
+    if (boost::filesystem::file_size(file, ec) == 0 || ec)
+        return false;
+
+    try
+    {
+        file_.open(file.string());
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+
+    return file_.is_open();
+}
+
+void block_file::close()
+{
+    if (file_.is_open())
+        file_.close();
+
+    position_ = 0;
+}
+
+bool block_file::is_open() const
+{
+    return file_.is_open();
+}
+
+data_slice block_file::data() const
+{
+    if (!file_.is_open())
+        return{ nullptr, nullptr };
+
+    const auto begin = reinterpret_cast<const uint8_t*>(file_.data());
+    return{ begin, begin + file_.size() };
+}
+
+size_t block_file::position() const
+{
+    return position_;
+}
+
+// Advance by one byte upon mismatch, as bitcoind does, so that a frame is
+// found following zero fill or a partially written block.
+bool block_file::next(data_slice& out_block)
+{
+    const auto file = data();
+    const auto begin = file.begin();
+    const auto size = file.size();
+
+    for (; position_ + frame_size <= size; ++position_)
+    {
+        const auto frame = begin + position_;
+
+        if (from_little_endian_unsafe<uint32_t>(frame) != magic_)
+            continue;
+
+        const size_t length = from_little_endian_unsafe<uint32_t>(frame +
+            sizeof(uint32_t));
+
+        if (length < header::satoshi_fixed_size() ||
+            length > max_block_weight ||
+            length > size - position_ - frame_size)
+            continue;
+
+        const auto block = frame + frame_size;
+        out_block = { block, block + length };
+        position_ += frame_size + length;
+        return true;
+    }
+
+    return false;
+}
+
+} // namespace chain
+} // namespace libbitcoin
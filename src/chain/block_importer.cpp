@@ -0,0 +1,154 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/chain/block_importer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <bitcoin/bitcoin/chain/block.hpp>
+#include <bitcoin/bitcoin/chain/block_file.hpp>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/settings.hpp>
+#include <bitcoin/bitcoin/utility/asio.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/deserializer.hpp>
+#include "bounded_queue.hpp"
+
+namespace libbitcoin {
+namespace chain {
+
+// A block in progress, passed from stage to stage.
+struct import_job
+{
+    const uint8_t* begin;
+    const uint8_t* end;
+    code ec;
+    block value;
+};
+
+typedef bounded_queue<import_job> import_queue;
+
+// Consume each job of in, pass it to out and close out once in is drained.
+template <typename Stage>
+static void run_stage(import_queue& in, import_queue& out, Stage&& stage)
+{
+    import_job job;
+
+    while (in.pop(job))
+    {
+        stage(job);
+
+        if (!out.push(std::move(job)))
+            break;
+    }
+
+    out.close();
+}
+
+block_importer::block_importer(const settings& settings, bool witness,
+    size_t depth)
+  : max_money_(settings.max_money()),
+    timestamp_limit_seconds_(settings.timestamp_limit_seconds),
+    proof_of_work_limit_(settings.proof_of_work_limit),
+    witness_(witness),
+    depth_(depth)
+{
+}
+
+code block_importer::import(block_file& file, block_handler handler) const
+{
+    import_queue framed(depth_);
+    import_queue parsed(depth_);
+    import_queue hashed(depth_);
+    code result(error::success);
+
+    const auto stop = [&]()
+    {
+        framed.stop();
+        parsed.stop();
+        hashed.stop();
+    };
+
+    // The block must consume its entire frame.
+    asio::thread parse([&]()
+    {
+        run_stage(framed, parsed, [this](import_job& job)
+        {
+            auto source = make_safe_deserializer(job.begin, job.end);
+
+            if (!job.value.from_data(source, witness_) ||
+                !source.is_exhausted())
+                job.ec = error::bad_stream;
+        });
+    });
+
+    // Hashes are cached by the block, so they are not computed again by
+    // the merkle root and header checks.
+    asio::thread hash([&]()
+    {
+        run_stage(parsed, hashed, [](import_job& job)
+        {
+            if (job.ec)
+                return;
+
+            job.value.header().hash();
+
+            for (const auto& tx: job.value.transactions())
+                tx.hash();
+        });
+    });
+
+    asio::thread check([&]()
+    {
+        import_job job;
+
+        while (hashed.pop(job))
+        {
+            if (!job.ec)
+                job.ec = job.value.check(max_money_, timestamp_limit_seconds_,
+                    proof_of_work_limit_);
+
+            if (!handler(job.ec, std::move(job.value)))
+            {
+                result = job.ec;
+                stop();
+                break;
+            }
+        }
+    });
+
+    data_slice slice(nullptr, nullptr);
+
+    while (file.next(slice))
+    {
+        import_job job{ slice.begin(), slice.end(), error::success, {} };
+
+        if (!framed.push(std::move(job)))
+            break;
+    }
+
+    framed.close();
+    parse.join();
+    hash.join();
+    check.join();
+    return result;
+}
+
+} // namespace chain
+} // namespace libbitcoin
@@ -0,0 +1,368 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/chain/block_pipeline.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <bitcoin/bitcoin/chain/block.hpp>
+#include <bitcoin/bitcoin/chain/chain_state.hpp>
+#include <bitcoin/bitcoin/chain/output.hpp>
+#include <bitcoin/bitcoin/chain/output_point.hpp>
+#include <bitcoin/bitcoin/chain/point.hpp>
+#include <bitcoin/bitcoin/chain/prevout_source.hpp>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/math/salted_hash.hpp>
+#include <bitcoin/bitcoin/settings.hpp>
+#include <bitcoin/bitcoin/utility/asio.hpp>
+#include <bitcoin/bitcoin/utility/thread.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
+#include "bounded_queue.hpp"
+
+namespace libbitcoin {
+namespace chain {
+
+typedef block_pipeline_metrics::duration duration;
+
+static duration elapsed(asio::time_point start)
+{
+    return std::chrono::duration_cast<duration>(
+        asio::steady_clock::now() - start);
+}
+
+// A block in progress, passed from stage to stage.
+struct pipeline_job
+{
+    size_t sequence;
+    std::shared_ptr<block> value;
+    chain_state::ptr state;
+    std::future<code> checked;
+    code ec;
+};
+
+typedef bounded_queue<pipeline_job> pipeline_queue;
+
+// The outputs created and spent by accepted blocks that are not yet
+// committed, over the source. The source is queried and committed to (by
+// the handler) under the same lock, so a block is never absent from both.
+class overlay_source
+  : public prevout_source
+{
+public:
+    overlay_source(prevout_source& source)
+      : source_(source)
+    {
+    }
+
+    // Outputs created by an earlier block of the overlay are reported
+    // confirmed, and outputs spent by one are reported spent.
+    code populate(const output_point::list& points) override
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto ec = source_.populate(points);
+
+        if (ec || entries_.empty())
+            return ec;
+
+        for (const auto& point: points)
+        {
+            const auto it = entries_.find(point);
+
+            if (it == entries_.end())
+                continue;
+
+            auto& metadata = *point.metadata;
+            const auto& entry = it->second;
+            metadata.spent = entry.spent;
+
+            // An output spent from the source remains as populated.
+            if (!entry.value.is_valid())
+                continue;
+
+            metadata.cache = entry.value;
+            metadata.candidate = false;
+            metadata.confirmed = true;
+            metadata.coinbase = entry.coinbase;
+            metadata.height = entry.height;
+            metadata.median_time_past = entry.median_time_past;
+        }
+
+        return error::success;
+    }
+
+    // Add the outputs created and spent by the accepted block. A spend of
+    // an output of the overlay passes its entry to the spending block.
+    void add(size_t sequence, const block& block, const chain_state& state)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto& txs = block.transactions();
+        const auto height = state.height();
+        const auto median_time_past = state.median_time_past();
+
+        for (auto tx = txs.begin(); tx != txs.end(); ++tx)
+        {
+            const auto hash = tx->hash();
+            const auto coinbase = tx == txs.begin();
+            const auto& outputs = tx->outputs();
+
+            for (uint32_t index = 0; index < outputs.size(); ++index)
+                entries_[point{ hash, index }] = entry{ sequence, false,
+                    coinbase, height, median_time_past, outputs[index] };
+
+            if (coinbase)
+                continue;
+
+            for (const auto& input: tx->inputs())
+            {
+                const auto& prevout = input.previous_output();
+                const auto it = entries_.find(prevout);
+
+                if (it == entries_.end())
+                {
+                    entries_.emplace(prevout, entry{ sequence, true, false,
+                        0, 0, {} });
+                    continue;
+                }
+
+                it->second.sequence = sequence;
+                it->second.spent = true;
+            }
+        }
+    }
+
+    // Remove the entries owned by the block and invoke the handler (which
+    // commits the block) under the lock.
+    template <typename Handler>
+    bool commit(size_t sequence, const block& block, Handler&& handler)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto& txs = block.transactions();
+
+        for (auto tx = txs.begin(); tx != txs.end(); ++tx)
+        {
+            const auto hash = tx->hash();
+
+            for (uint32_t index = 0; index < tx->outputs().size(); ++index)
+                remove(sequence, point{ hash, index });
+
+            if (tx != txs.begin())
+                for (const auto& input: tx->inputs())
+                    remove(sequence, input.previous_output());
+        }
+
+        return handler();
+    }
+
+private:
+    struct entry
+    {
+        size_t sequence;
+        bool spent;
+        bool coinbase;
+        size_t height;
+        uint32_t median_time_past;
+        output value;
+    };
+
+    typedef std::unordered_map<point, entry, salted_hash<point>> entries;
+
+    void remove(size_t sequence, const point& key)
+    {
+        const auto it = entries_.find(key);
+
+        if (it != entries_.end() && it->second.sequence == sequence)
+            entries_.erase(it);
+    }
+
+    prevout_source& source_;
+
+    // These are protected by mutex.
+    entries entries_;
+    std::mutex mutex_;
+};
+
+double block_pipeline_metrics::utilization(duration busy,
+    size_t threads) const
+{
+    const auto capacity = elapsed.count() * (threads == 0 ? 1 : threads);
+    return capacity == 0 ? 0.0 : static_cast<double>(busy.count()) / capacity;
+}
+
+block_pipeline::block_pipeline(const settings& settings,
+    const block_pipeline_options& options)
+  : settings_(settings),
+    options_(options)
+{
+}
+
+const block_pipeline_metrics& block_pipeline::metrics() const
+{
+    return metrics_;
+}
+
+code block_pipeline::validate(prevout_source& source, block_source next,
+    block_handler handler)
+{
+    const auto start = asio::steady_clock::now();
+    const auto max_money = settings_.max_money();
+    const auto timestamp_limit_seconds = settings_.timestamp_limit_seconds;
+    const auto proof_of_work_limit = settings_.proof_of_work_limit;
+
+    threadpool check_pool(thread_default(options_.check_threads));
+    threadpool connect_pool(thread_default(options_.connect_threads));
+    pipeline_queue checked(options_.depth);
+    pipeline_queue prepared(options_.depth);
+    overlay_source overlay(source);
+    code result(error::success);
+    std::atomic<int64_t> check_ticks(0);
+    block_pipeline_metrics metrics;
+
+    const auto stop = [&]()
+    {
+        checked.stop();
+        prepared.stop();
+    };
+
+    // Wait for the check of each block in order, then populate and accept
+    // it. Blocks behind a failure are not prepared, as they depend on it.
+    asio::thread prepare([&]()
+    {
+        pipeline_job job;
+
+        while (checked.pop(job))
+        {
+            job.ec = job.checked.get();
+
+            if (!job.ec)
+            {
+                const auto& state = *job.state;
+                const auto populate = asio::steady_clock::now();
+                job.ec = job.value->populate_previous_outputs(state, overlay);
+                metrics.populate += elapsed(populate);
+            }
+
+            if (!job.ec)
+            {
+                const auto& state = *job.state;
+                const auto accept = asio::steady_clock::now();
+                job.ec = job.value->accept(state, settings_, true, true);
+                metrics.accept += elapsed(accept);
+            }
+
+            if (!job.ec)
+                overlay.add(job.sequence, *job.value, *job.state);
+
+            const auto failed = !!job.ec;
+
+            if (!prepared.push(std::move(job)) || failed)
+                break;
+        }
+
+        prepared.close();
+    });
+
+    // Connect each block, then deliver it in order, stopping the pipeline
+    // at the first failure or when the handler returns false.
+    asio::thread connect([&]()
+    {
+        pipeline_job job;
+
+        while (prepared.pop(job))
+        {
+            if (!job.ec)
+            {
+                const auto connect = asio::steady_clock::now();
+                job.ec = job.value->connect(*job.state, connect_pool);
+                metrics.connect += elapsed(connect);
+            }
+
+            const auto commit = asio::steady_clock::now();
+            const auto& value = *job.value;
+            const auto proceed = overlay.commit(job.sequence, value, [&]()
+            {
+                return handler(job.ec, std::move(*job.value), *job.state);
+            });
+
+            metrics.commit += elapsed(commit);
+            ++metrics.blocks;
+
+            if (job.ec || !proceed)
+            {
+                result = job.ec;
+                stop();
+                break;
+            }
+        }
+    });
+
+    // Post the check of each block ahead, so that blocks are hashed and
+    // checked concurrently while earlier blocks are prepared and connected.
+    for (size_t sequence = 0;; ++sequence)
+    {
+        auto value = std::make_shared<block>();
+        chain_state::ptr state;
+
+        if (!next(*value, state))
+            break;
+
+        auto promise = std::make_shared<std::promise<code>>();
+        pipeline_job job{ sequence, value, state, promise->get_future(),
+            error::success };
+
+        // Hashes are cached by the block, so they are not computed again by
+        // the merkle root and header checks.
+        check_pool.service().post([=, &check_ticks]()
+        {
+            const auto check = asio::steady_clock::now();
+            value->header().hash();
+
+            for (const auto& tx: value->transactions())
+                tx.hash();
+
+            promise->set_value(value->check(max_money,
+                timestamp_limit_seconds, proof_of_work_limit));
+            check_ticks += elapsed(check).count();
+        });
+
+        if (!checked.push(std::move(job)))
+            break;
+    }
+
+    checked.close();
+    prepare.join();
+    connect.join();
+    check_pool.shutdown();
+    check_pool.join();
+    connect_pool.shutdown();
+    connect_pool.join();
+
+    metrics.check = duration(check_ticks.load());
+    metrics.elapsed = elapsed(start);
+    metrics_ = metrics;
+    return result;
+}
+
+} // namespace chain
+} // namespace libbitcoin
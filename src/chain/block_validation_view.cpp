@@ -0,0 +1,219 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/chain/block_validation_view.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <bitcoin/bitcoin/chain/block.hpp>
+#include <bitcoin/bitcoin/chain/chain_state.hpp>
+#include <bitcoin/bitcoin/chain/input.hpp>
+#include <bitcoin/bitcoin/chain/output.hpp>
+#include <bitcoin/bitcoin/chain/point.hpp>
+#include <bitcoin/bitcoin/chain/transaction.hpp>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/math/limits.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/flat_hash_set.hpp>
+#include <bitcoin/bitcoin/utility/parallel.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+block_validation_view::block_validation_view(const block& block)
+  : block_(block)
+{
+    const auto& txs = block.transactions();
+    const auto transactions = txs.empty() ? 0 : txs.size() - 1;
+    const auto count = txs.empty() ? 0 : block.total_non_coinbase_inputs();
+
+    offsets_.reserve(transactions + 1);
+    output_values_.reserve(transactions);
+    inputs_.reserve(count);
+    points_.reserve(count);
+    values_.reserve(count);
+    previous_scripts_.reserve(count);
+    scripts_.reserve(count);
+    sequences_.reserve(count);
+    positions_.reserve(count);
+    indexes_.reserve(count);
+
+    // The coinbase is excluded, as it has no previous outputs.
+    for (uint32_t position = 1; position < txs.size(); ++position)
+    {
+        const auto& tx = txs[position];
+        const auto& inputs = tx.inputs();
+        offsets_.push_back(static_cast<uint32_t>(inputs_.size()));
+        output_values_.push_back(tx.total_output_value());
+
+        for (uint32_t index = 0; index < inputs.size(); ++index)
+        {
+            const auto& input = inputs[index];
+            const auto& point = input.previous_output();
+            const auto prevout = point.metadata.peek();
+            const auto found = prevout != nullptr && prevout->cache.is_valid();
+
+            inputs_.push_back(&input);
+            points_.push_back(point);
+            values_.push_back(found ? prevout->cache.value() :
+                output::not_found);
+            previous_scripts_.push_back(found ?
+                data_slice(prevout->cache.script().bytes()) :
+                data_slice(nullptr, nullptr));
+            scripts_.push_back(input.script().bytes());
+            sequences_.push_back(input.sequence());
+            positions_.push_back(position);
+            indexes_.push_back(index);
+        }
+    }
+
+    offsets_.push_back(static_cast<uint32_t>(inputs_.size()));
+}
+
+size_t block_validation_view::size() const
+{
+    return inputs_.size();
+}
+
+size_t block_validation_view::transactions() const
+{
+    return output_values_.size();
+}
+
+const point::list& block_validation_view::points() const
+{
+    return points_;
+}
+
+const std::vector<uint64_t>& block_validation_view::values() const
+{
+    return values_;
+}
+
+const block_validation_view::slices&
+    block_validation_view::previous_scripts() const
+{
+    return previous_scripts_;
+}
+
+const block_validation_view::slices& block_validation_view::scripts() const
+{
+    return scripts_;
+}
+
+const std::vector<uint32_t>& block_validation_view::sequences() const
+{
+    return sequences_;
+}
+
+const std::vector<uint32_t>& block_validation_view::positions() const
+{
+    return positions_;
+}
+
+const std::vector<uint32_t>& block_validation_view::indexes() const
+{
+    return indexes_;
+}
+
+// Validation.
+//-----------------------------------------------------------------------------
+
+// private
+uint64_t block_validation_view::input_value(size_t transaction) const
+{
+    uint64_t total = 0;
+
+    // Treat missing previous outputs as zero, no math on sentinel.
+    for (auto index = offsets_[transaction];
+        index < offsets_[transaction + 1]; ++index)
+        total = ceiling_add(total, values_[index] == output::not_found ? 0 :
+            values_[index]);
+
+    return total;
+}
+
+bool block_validation_view::is_internal_double_spend() const
+{
+    flat_hash_set<point> outs(points_.size());
+
+    for (const auto& point: points_)
+        if (!outs.insert(point))
+            return true;
+
+    return false;
+}
+
+// Overflow returns max_uint64.
+uint64_t block_validation_view::fees() const
+{
+    uint64_t total = 0;
+
+    for (size_t tx = 0; tx < output_values_.size(); ++tx)
+        total = ceiling_add(total, floor_subtract(input_value(tx),
+            output_values_[tx]));
+
+    return total;
+}
+
+bool block_validation_view::is_overspent() const
+{
+    for (size_t tx = 0; tx < output_values_.size(); ++tx)
+        if (output_values_[tx] > input_value(tx))
+            return true;
+
+    return false;
+}
+
+// Returns max_size_t in case of overflow.
+size_t block_validation_view::signature_operations(bool bip16,
+    bool bip141) const
+{
+    const auto& txs = block_.transactions();
+
+    // Coinbase input sigops are counted (legacy) as in the block.
+    auto total = txs.empty() ? size_t{0} :
+        txs.front().signature_operations(bip16, bip141);
+
+    for (const auto input: inputs_)
+        total = ceiling_add(total, input->signature_operations(bip16, bip141));
+
+    for (size_t position = 1; position < txs.size(); ++position)
+        for (const auto& output: txs[position].outputs())
+            total = ceiling_add(total, output.signature_operations(bip141));
+
+    return total;
+}
+
+// Inputs are connected individually, as script verification dominates.
+code block_validation_view::connect(const chain_state& state,
+    threadpool& pool) const
+{
+    const auto& txs = block_.transactions();
+    const auto connect = [this, &txs, &state](size_t index)
+    {
+        return txs[positions_[index]].connect_input(state, indexes_[index]);
+    };
+
+    return parallel_for(pool, inputs_.size(), 1, connect);
+}
+
+} // namespace chain
+} // namespace libbitcoin
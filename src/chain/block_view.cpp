@@ -0,0 +1,106 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/chain/block_view.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/bitcoin/chain/block.hpp>
+#include <bitcoin/bitcoin/chain/header.hpp>
+#include <bitcoin/bitcoin/chain/transaction_view.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/deserializer.hpp>
+#include "wire_cursor.hpp"
+
+namespace libbitcoin {
+namespace chain {
+
+block_view::block_view()
+  : begin_(nullptr), transactions_(nullptr), end_(nullptr),
+    transaction_count_(0)
+{
+}
+
+block_view::block_view(data_slice data)
+  : block_view()
+{
+    size_t count;
+    wire_cursor cursor(data.begin(), data.end());
+
+    if (!cursor.skip(header::satoshi_fixed_size()) || !cursor.read_size(count))
+        return;
+
+    const auto transactions = cursor.position();
+
+    // Order is required, explicit loop allows early termination.
+    for (auto tx = count; tx > 0; --tx)
+    {
+        const transaction_view view({ cursor.position(),
+            cursor.position() + cursor.remaining() });
+
+        if (!view.is_valid() || !cursor.skip(view.serialized_size()))
+            return;
+    }
+
+    begin_ = data.begin();
+    transactions_ = transactions;
+    end_ = cursor.position();
+    transaction_count_ = count;
+}
+
+bool block_view::is_valid() const
+{
+    return begin_ != nullptr;
+}
+
+data_slice block_view::data() const
+{
+    return{ begin_, end_ };
+}
+
+size_t block_view::serialized_size() const
+{
+    return static_cast<size_t>(end_ - begin_);
+}
+
+data_slice block_view::header() const
+{
+    return is_valid() ?
+        data_slice{ begin_, begin_ + header::satoshi_fixed_size() } :
+        data_slice{ begin_, begin_ };
+}
+
+hash_digest block_view::hash() const
+{
+    return bitcoin_hash(header());
+}
+
+block_view::transaction_views block_view::transactions() const
+{
+    return{ transactions_, end_, transaction_count_ };
+}
+
+block block_view::to_block(bool witness) const
+{
+    auto source = make_safe_deserializer(begin_, end_);
+    return block::factory(source, witness);
+}
+
+} // namespace chain
+} // namespace libbitcoin
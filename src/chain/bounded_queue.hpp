@@ -0,0 +1,115 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHAIN_BOUNDED_QUEUE_HPP
+#define LIBBITCOIN_CHAIN_BOUNDED_QUEUE_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <utility>
+#include <bitcoin/bitcoin/utility/noncopyable.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+/// A bounded queue joining a producing pipeline stage to a consuming stage.
+template <typename Job>
+class bounded_queue
+  : noncopyable
+{
+public:
+    bounded_queue(size_t depth)
+      : depth_(depth == 0 ? 1 : depth), closed_(false), stopped_(false)
+    {
+    }
+
+    /// Wait for space, false if the pipeline has stopped.
+    bool push(Job&& job)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        space_.wait(lock, [this]()
+        {
+            return stopped_ || jobs_.size() < depth_;
+        });
+
+        if (stopped_)
+            return false;
+
+        jobs_.push_back(std::move(job));
+        lock.unlock();
+        ready_.notify_one();
+        return true;
+    }
+
+    /// Wait for a job, false once closed and drained or if stopped.
+    bool pop(Job& out)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        ready_.wait(lock, [this]()
+        {
+            return stopped_ || closed_ || !jobs_.empty();
+        });
+
+        if (stopped_ || jobs_.empty())
+            return false;
+
+        out = std::move(jobs_.front());
+        jobs_.pop_front();
+        lock.unlock();
+        space_.notify_one();
+        return true;
+    }
+
+    /// The producer has no more jobs.
+    void close()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        closed_ = true;
+        lock.unlock();
+        ready_.notify_all();
+    }
+
+    /// Release the producer and consumer, discarding queued jobs.
+    void stop()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        stopped_ = true;
+        jobs_.clear();
+        lock.unlock();
+        ready_.notify_all();
+        space_.notify_all();
+    }
+
+private:
+    const size_t depth_;
+
+    // These are protected by mutex.
+    bool closed_;
+    bool stopped_;
+    std::deque<Job> jobs_;
+    std::mutex mutex_;
+    std::condition_variable ready_;
+    std::condition_variable space_;
+};
+
+} // namespace chain
+} // namespace libbitcoin
+
+#endif
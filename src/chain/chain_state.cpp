@@ -22,16 +22,20 @@
 #include <cstddef>
 #include <cstdint>
 #include <iterator>
-#include <boost/multiprecision/integer.hpp>
+#include <memory>
+#include <utility>
+#include <vector>
 #include <boost/range/adaptor/reversed.hpp>
 #include <bitcoin/bitcoin/chain/block.hpp>
 #include <bitcoin/bitcoin/chain/chain_state.hpp>
 #include <bitcoin/bitcoin/chain/compact.hpp>
 #include <bitcoin/bitcoin/chain/script.hpp>
 #include <bitcoin/bitcoin/config/checkpoint.hpp>
+#include <bitcoin/bitcoin/config/checkpoint_index.hpp>
 #include <bitcoin/bitcoin/constants.hpp>
 #include <bitcoin/bitcoin/math/hash.hpp>
 #include <bitcoin/bitcoin/math/limits.hpp>
+#include <bitcoin/bitcoin/math/uint256.hpp>
 #include <bitcoin/bitcoin/machine/opcode.hpp>
 #include <bitcoin/bitcoin/machine/rule_fork.hpp>
 #include <bitcoin/bitcoin/settings.hpp>
@@ -78,38 +82,35 @@ inline uint32_t bits_high(const chain_state::data& values)
 // activation
 //-----------------------------------------------------------------------------
 
+//*****************************************************************************
+// CONSENSUS: Though unspecified in bip34, the satoshi implementation
+// performed this comparison using the signed integer version value.
+//*****************************************************************************
+inline bool is_at_or_above(uint32_t value, uint32_t version)
+{
+    return static_cast<int32_t>(value) >= static_cast<int32_t>(version);
+}
+
 chain_state::activations chain_state::activation(const data& values,
     uint32_t forks, const bc::settings& settings)
+{
+    return activation(values, summarize(values, settings), forks, settings);
+}
+
+chain_state::activations chain_state::activation(const data& values,
+    const summary& tally, uint32_t forks, const bc::settings& settings)
 {
     const auto height = values.height;
     const auto version = values.version.self;
-    const auto& history = values.version.ordered;
     const auto frozen = script::is_enabled(forks, rule_fork::bip90_rule);
     const auto difficult = script::is_enabled(forks, rule_fork::difficult);
     const auto retarget = script::is_enabled(forks, rule_fork::retarget);
     const auto mainnet = retarget && difficult;
 
-    //*************************************************************************
-    // CONSENSUS: Though unspecified in bip34, the satoshi implementation
-    // performed this comparison using the signed integer version value.
-    //*************************************************************************
-    const auto ge = [](uint32_t value, uint32_t version)
-    {
-        return static_cast<int32_t>(value) >= static_cast<int32_t>(version);
-    };
-
-    // Declare bip34-based version predicates.
-    const auto ge_2 = [=](uint32_t value) { return ge(value,
-        settings.bip34_version); };
-    const auto ge_3 = [=](uint32_t value) { return ge(value,
-        settings.bip66_version); };
-    const auto ge_4 = [=](uint32_t value) { return ge(value,
-        settings.bip65_version); };
-
-    // Compute bip34-based activation version summaries.
-    const auto count_2 = std::count_if(history.begin(), history.end(), ge_2);
-    const auto count_3 = std::count_if(history.begin(), history.end(), ge_3);
-    const auto count_4 = std::count_if(history.begin(), history.end(), ge_4);
+    // The bip34-based activation version summaries are rolling counts.
+    const auto count_2 = tally.bip34_count;
+    const auto count_3 = tally.bip66_count;
+    const auto count_4 = tally.bip65_count;
 
     // Frozen activations (require version and enforce above freeze height).
     const auto bip34_ice = frozen && height >= settings.bip34_freeze;
@@ -275,10 +276,22 @@ size_t chain_state::bip9_bit1_height(size_t height,
 // median_time_past
 //-----------------------------------------------------------------------------
 
+// The summary holds the sorted timestamps unless they exceed the interval.
+uint32_t chain_state::median_time_past(const data& values,
+    const summary& tally)
+{
+    if (tally.times_size > median_time_past_interval)
+        return median_time_past(values, 0);
+
+    // Consensus defines median time using modulo 2 element selection.
+    return tally.times_size == 0 ? 0 : tally.times[tally.times_size / 2];
+}
+
 uint32_t chain_state::median_time_past(const data& values, uint32_t)
 {
-    // Create a copy for the in-place sort.
-    auto times = values.timestamp.ordered;
+    // Create a copy for the in-place sort (the history storage is shared).
+    const auto& ordered = values.timestamp.ordered;
+    std::vector<uint32_t> times(ordered.begin(), ordered.end());
 
     // Sort the times by value to obtain the median.
     std::sort(times.begin(), times.end());
@@ -288,6 +301,111 @@ uint32_t chain_state::median_time_past(const data& values, uint32_t)
     return times.empty() ? 0 : times[times.size() / 2];
 }
 
+// summary
+//-----------------------------------------------------------------------------
+
+chain_state::summary chain_state::summarize(const data& values,
+    const bc::settings& settings)
+{
+    summary tally{ 0, 0, 0, 0, {} };
+
+    for (const auto version: values.version.ordered)
+    {
+        tally.bip34_count += is_at_or_above(version, settings.bip34_version);
+        tally.bip66_count += is_at_or_above(version, settings.bip66_version);
+        tally.bip65_count += is_at_or_above(version, settings.bip65_version);
+    }
+
+    const auto& times = values.timestamp.ordered;
+    tally.times_size = times.size();
+
+    // An oversized history is not summarized, its median is computed.
+    if (tally.times_size <= median_time_past_interval)
+    {
+        std::copy(times.begin(), times.end(), tally.times.begin());
+        std::sort(tally.times.begin(), tally.times.begin() + tally.times_size);
+    }
+
+    return tally;
+}
+
+// This assumes the values were promoted from the parent by to_pool, where
+// each history is extended by the parent self value and may drop its oldest.
+chain_state::summary chain_state::summarize(const chain_state& parent,
+    const data& values, const bc::settings& settings)
+{
+    const auto& from = parent.data_;
+
+    // A block state has the histories of its same-height pool state.
+    if (values.height == from.height)
+        return parent.summary_;
+
+    auto tally = parent.summary_;
+    const auto& versions = from.version.ordered;
+    const auto& times = from.timestamp.ordered;
+    const auto version_dropped = values.version.ordered.size() == versions.size();
+    const auto time_dropped = values.timestamp.ordered.size() == times.size();
+
+    BITCOIN_ASSERT(version_dropped ||
+        values.version.ordered.size() == versions.size() + 1u);
+    BITCOIN_ASSERT(time_dropped ||
+        values.timestamp.ordered.size() == times.size() + 1u);
+
+    const auto count = [&](uint32_t version, bool add)
+    {
+        const auto update = [add](size_t& total, bool counted)
+        {
+            if (counted)
+                total = add ? total + 1u : total - 1u;
+        };
+
+        update(tally.bip34_count, is_at_or_above(version, settings.bip34_version));
+        update(tally.bip66_count, is_at_or_above(version, settings.bip66_version));
+        update(tally.bip65_count, is_at_or_above(version, settings.bip65_version));
+    };
+
+    // A value dropped from an empty history is the value just added.
+    if (!version_dropped || !versions.empty())
+    {
+        count(from.version.self, true);
+
+        if (version_dropped)
+            count(versions.front(), false);
+    }
+
+    const auto size = values.timestamp.ordered.size();
+
+    if (size > median_time_past_interval ||
+        tally.times_size > median_time_past_interval)
+    {
+        tally.times_size = size;
+        return tally;
+    }
+
+    if (!time_dropped || !times.empty())
+    {
+        const auto begin = tally.times.begin();
+        auto end = begin + tally.times_size;
+
+        if (time_dropped)
+        {
+            const auto drop = std::lower_bound(begin, end, times.front());
+            BITCOIN_ASSERT(drop != end && *drop == times.front());
+            std::copy(drop + 1, end, drop);
+            --end;
+        }
+
+        const auto value = from.timestamp.self;
+        const auto add = std::upper_bound(begin, end, value);
+        std::copy_backward(add, end, end + 1);
+        *add = value;
+        ++end;
+        tally.times_size = std::distance(begin, end);
+    }
+
+    return tally;
+}
+
 // work_required
 //-----------------------------------------------------------------------------
 
@@ -330,9 +448,8 @@ uint32_t chain_state::work_required_retarget(const data& values, uint32_t forks,
     uint256_t target(bits);
     const auto retarget_overflow = script::is_enabled(forks,
         rule_fork::retarget_overflow_patch);
-    using namespace boost::multiprecision;
-    const auto shift = retarget_overflow && (msb(target) + 1 > msb(pow_limit)) ?
-        1u : 0u;
+    const auto shift = retarget_overflow &&
+        (target.bit_length() + 1u > pow_limit.bit_length()) ? 1u : 0u;
     target >>= shift;
     target *= retarget_timespan(values, minimum_timespan, maximum_timespan);
     target /= retargeting_interval_seconds;
@@ -527,6 +644,7 @@ chain_state::data chain_state::to_pool(const chain_state& top,
     const auto retarget = script::is_enabled(forks, rule_fork::retarget);
 
     // Copy data from presumed previous-height block state.
+    // The histories share storage, so this does not copy their values.
     auto data = top.data_;
 
     // If this overflows height is zero and result is handled as invalid.
@@ -578,9 +696,10 @@ chain_state::chain_state(const chain_state& top, const bc::settings& settings)
     forks_(top.forks_),
     stale_seconds_(top.stale_seconds_),
     checkpoints_(top.checkpoints_),
-    active_(activation(data_, forks_, settings)),
+    summary_(summarize(top, data_, settings)),
+    active_(activation(data_, summary_, forks_, settings)),
     work_required_(work_required(data_, forks_, settings)),
-    median_time_past_(median_time_past(data_, forks_))
+    median_time_past_(median_time_past(data_, summary_))
 {
 }
 
@@ -619,9 +738,10 @@ chain_state::chain_state(const chain_state& pool, const block& block,
     forks_(pool.forks_),
     stale_seconds_(pool.stale_seconds_),
     checkpoints_(pool.checkpoints_),
-    active_(activation(data_, forks_, settings)),
+    summary_(summarize(pool, data_, settings)),
+    active_(activation(data_, summary_, forks_, settings)),
     work_required_(work_required(data_, forks_, settings)),
-    median_time_past_(median_time_past(data_, forks_))
+    median_time_past_(median_time_past(data_, summary_))
 {
 }
 
@@ -659,22 +779,42 @@ chain_state::chain_state(const chain_state& parent, const header& header,
     forks_(parent.forks_),
     stale_seconds_(parent.stale_seconds_),
     checkpoints_(parent.checkpoints_),
-    active_(activation(data_, forks_, settings)),
+    summary_(summarize(parent, data_, settings)),
+    active_(activation(data_, summary_, forks_, settings)),
     work_required_(work_required(data_, forks_, settings)),
-    median_time_past_(median_time_past(data_, forks_))
+    median_time_past_(median_time_past(data_, summary_))
 {
 }
 
 // Constructor (from raw data).
 chain_state::chain_state(data&& values, const checkpoints& checkpoints,
     uint32_t forks, uint32_t stale_seconds, const bc::settings& settings)
+  : chain_state(std::make_shared<const config::checkpoint_index>(checkpoints),
+        std::move(values), forks, stale_seconds, settings)
+{
+}
+
+// Factory (from raw data and a shared checkpoint index).
+chain_state::ptr chain_state::from_index(data&& values,
+    checkpoint_index_ptr checkpoints, uint32_t forks, uint32_t stale_seconds,
+    const bc::settings& settings)
+{
+    // The constructor is private, so make_shared is not available.
+    return ptr(new chain_state(checkpoints, std::move(values), forks,
+        stale_seconds, settings));
+}
+
+// private
+chain_state::chain_state(checkpoint_index_ptr checkpoints, data&& values,
+    uint32_t forks, uint32_t stale_seconds, const bc::settings& settings)
   : data_(std::move(values)),
     forks_(forks),
     stale_seconds_(stale_seconds),
     checkpoints_(checkpoints),
-    active_(activation(data_, forks_, settings)),
+    summary_(summarize(data_, settings)),
+    active_(activation(data_, summary_, forks_, settings)),
     work_required_(work_required(data_, forks_, settings)),
-    median_time_past_(median_time_past(data_, forks_))
+    median_time_past_(median_time_past(data_, summary_))
 {
 }
 
@@ -731,6 +871,16 @@ uint32_t chain_state::work_required() const
     return work_required_;
 }
 
+const chain_state::data& chain_state::values() const
+{
+    return data_;
+}
+
+uint32_t chain_state::forks() const
+{
+    return forks_;
+}
+
 // Forks.
 //-----------------------------------------------------------------------------
 
@@ -741,13 +891,12 @@ bool chain_state::is_enabled(rule_fork fork) const
 
 bool chain_state::is_checkpoint_conflict(const hash_digest& hash) const
 {
-    return !checkpoint::validate(hash, data_.height, checkpoints_);
+    return !checkpoints_->validate(hash, data_.height);
 }
 
 bool chain_state::is_under_checkpoint() const
 {
-    // This assumes that the checkpoints are sorted.
-    return checkpoint::covered(data_.height, checkpoints_);
+    return checkpoints_->covered(data_.height);
 }
 
 } // namespace chain
@@ -18,9 +18,12 @@
  */
 #include <bitcoin/bitcoin/chain/compact.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/math/uint256.hpp>
 #include <bitcoin/bitcoin/utility/assert.hpp>
+#include <bitcoin/bitcoin/utility/endian.hpp>
 
 namespace libbitcoin {
 namespace chain {
@@ -79,16 +82,6 @@ inline uint32_t shift_high(uint8_t exponent)
     return  8 * (exponent - 3);
 }
 
-inline size_t logical_size(uint256_t value)
-{
-    auto byte = 0;
-
-    for (; value != 0; ++byte)
-        value >>= 8;
-
-    return byte;
-}
-
 // Constructors
 //-----------------------------------------------------------------------------
 
@@ -156,10 +149,39 @@ bool compact::from_compact(uint256_t& out, uint32_t compact)
     return true;
 }
 
+// Returns false on overflow, negatives are converted to zero (as above).
+bool compact::expand(hash_digest& out, uint32_t compact)
+{
+    out.fill(0);
+
+    if (is_negated(compact))
+        return true;
+
+    auto mantissa = compact & mantissa_max;
+    const auto exponent = static_cast<uint8_t>(compact >> mantissa_bits);
+
+    if (exponent <= 3)
+    {
+        mantissa >>= shift_low(exponent);
+        store_little_endian<uint32_t>(out.data(), mantissa);
+        return true;
+    }
+
+    if (is_overflow(exponent, mantissa))
+        return false;
+
+    // The mantissa bytes from the shift, high zero bytes may exceed the hash.
+    const size_t shift = exponent - 3;
+    for (size_t byte = 0; byte < 3 && shift + byte < hash_size; ++byte)
+        out[shift + byte] = static_cast<uint8_t>(mantissa >> (8 * byte));
+
+    return true;
+}
+
 uint32_t compact::from_big(const uint256_t& big)
 {
     // This value is limited to 32, so exponent cannot overflow.
-    auto exponent = static_cast<uint8_t>(logical_size(big));
+    auto exponent = static_cast<uint8_t>(big.byte_length());
 
     // Shift the big number significant digits into the mantissa.
     const auto mantissa64 = exponent <= 3 ?
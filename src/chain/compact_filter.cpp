@@ -0,0 +1,421 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/chain/compact_filter.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <bitcoin/bitcoin/chain/block.hpp>
+#include <bitcoin/bitcoin/machine/opcode.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/math/siphash.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+using namespace bc::machine;
+
+const uint8_t compact_filter::basic_type = 0x00;
+const uint8_t compact_filter::golomb_bits = 19;
+const uint64_t compact_filter::golomb_rate = 784931;
+
+// Utilities.
+//-----------------------------------------------------------------------------
+
+// The high word of the 128 bit product, a uniform map of hash onto [0, range).
+static inline uint64_t to_range(uint64_t hash, uint64_t range)
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 uint128_t;
+    return static_cast<uint64_t>((uint128_t(hash) * range) >> 64);
+#else
+    const auto hash_low = hash & 0xffffffff;
+    const auto hash_high = hash >> 32;
+    const auto range_low = range & 0xffffffff;
+    const auto range_high = range >> 32;
+
+    const auto low_low = hash_low * range_low;
+    const auto high_low = hash_high * range_low;
+    const auto low_high = hash_low * range_high;
+    const auto high_high = hash_high * range_high;
+
+    const auto middle = (low_low >> 32) + (high_low & 0xffffffff) +
+        (low_high & 0xffffffff);
+
+    return high_high + (high_low >> 32) + (low_high >> 32) + (middle >> 32);
+#endif
+}
+
+static inline bool less(const data_slice& left, const data_slice& right)
+{
+    return std::lexicographical_compare(left.begin(), left.end(),
+        right.begin(), right.end());
+}
+
+static inline bool equal(const data_slice& left, const data_slice& right)
+{
+    return left.size() == right.size() &&
+        std::equal(left.begin(), left.end(), right.begin());
+}
+
+static void write_size(data_chunk& out, uint64_t value)
+{
+    const auto write = [&out](uint64_t value, size_t bytes)
+    {
+        for (size_t byte = 0; byte < bytes; ++byte)
+            out.push_back(static_cast<uint8_t>(value >> (8u * byte)));
+    };
+
+    if (value < 0xfd)
+    {
+        write(value, 1);
+    }
+    else if (value <= max_uint16)
+    {
+        out.push_back(0xfd);
+        write(value, 2);
+    }
+    else if (value <= max_uint32)
+    {
+        out.push_back(0xfe);
+        write(value, 4);
+    }
+    else
+    {
+        out.push_back(0xff);
+        write(value, 8);
+    }
+}
+
+// Returns the number of bytes read, or zero if the size is truncated.
+static size_t read_size(uint64_t& out, const data_chunk& data)
+{
+    if (data.empty())
+        return 0;
+
+    const auto prefix = data.front();
+    const size_t bytes = prefix < 0xfd ? 0 : (prefix == 0xfd ? 2 :
+        (prefix == 0xfe ? 4 : 8));
+
+    if (bytes == 0)
+    {
+        out = prefix;
+        return 1;
+    }
+
+    if (data.size() < bytes + 1)
+        return 0;
+
+    out = 0;
+    for (size_t byte = 0; byte < bytes; ++byte)
+        out |= static_cast<uint64_t>(data[byte + 1]) << (8u * byte);
+
+    return bytes + 1;
+}
+
+// Golomb-Rice coding.
+//-----------------------------------------------------------------------------
+
+// Bits are written most significant first, up to 32 bits per write.
+class bit_writer
+{
+public:
+    bit_writer(data_chunk& out)
+      : out_(out), buffer_(0), count_(0)
+    {
+    }
+
+    void write(uint64_t value, size_t bits)
+    {
+        buffer_ = (buffer_ << bits) | value;
+        count_ += bits;
+
+        while (count_ >= byte_bits)
+        {
+            count_ -= byte_bits;
+            out_.push_back(static_cast<uint8_t>(buffer_ >> count_));
+        }
+    }
+
+    void write_unary(uint64_t value)
+    {
+        for (; value >= 32; value -= 32)
+            write(0xffffffff, 32);
+
+        // The value ones are terminated by a zero.
+        write(((uint64_t(1) << value) - 1) << 1, value + 1);
+    }
+
+    void flush()
+    {
+        if (count_ != 0)
+            out_.push_back(static_cast<uint8_t>(buffer_ << (byte_bits - count_)));
+
+        count_ = 0;
+    }
+
+private:
+    data_chunk& out_;
+    uint64_t buffer_;
+    size_t count_;
+};
+
+// Bits are read most significant first, up to 32 bits per read.
+class bit_reader
+{
+public:
+    bit_reader(const uint8_t* begin, const uint8_t* end)
+      : next_(begin), end_(end), buffer_(0), count_(0)
+    {
+    }
+
+    // False if the stream is exhausted.
+    bool read(uint64_t& out, size_t bits)
+    {
+        while (count_ < bits)
+        {
+            if (next_ == end_)
+                return false;
+
+            buffer_ = (buffer_ << byte_bits) | *next_++;
+            count_ += byte_bits;
+        }
+
+        count_ -= bits;
+        out = (buffer_ >> count_) & ((uint64_t(1) << bits) - 1);
+        return true;
+    }
+
+    bool read_unary(uint64_t& out)
+    {
+        out = 0;
+        uint64_t bit;
+
+        while (read(bit, 1))
+        {
+            if (bit == 0)
+                return true;
+
+            ++out;
+        }
+
+        return false;
+    }
+
+private:
+    const uint8_t* next_;
+    const uint8_t* end_;
+    uint64_t buffer_;
+    size_t count_;
+};
+
+// Decodes the sorted set values in order, without materializing the set.
+class set_reader
+{
+public:
+    set_reader(const data_chunk& filter)
+      : count_(0), value_(0), reader_(nullptr, nullptr)
+    {
+        const auto prefix = read_size(count_, filter);
+
+        if (prefix == 0)
+            count_ = 0;
+
+        reader_ = bit_reader(filter.data() + prefix,
+            filter.data() + filter.size());
+    }
+
+    uint64_t count() const
+    {
+        return count_;
+    }
+
+    // False once all values are read, or if the set is truncated.
+    bool next(uint64_t& out)
+    {
+        if (count_ == 0)
+            return false;
+
+        uint64_t quotient;
+        uint64_t remainder;
+
+        if (!reader_.read_unary(quotient) ||
+            !reader_.read(remainder, compact_filter::golomb_bits))
+        {
+            count_ = 0;
+            return false;
+        }
+
+        --count_;
+        value_ += (quotient << compact_filter::golomb_bits) | remainder;
+        out = value_;
+        return true;
+    }
+
+private:
+    uint64_t count_;
+    uint64_t value_;
+    bit_reader reader_;
+};
+
+// Build.
+//-----------------------------------------------------------------------------
+
+bool compact_filter::build(data_chunk& out, const block& block)
+{
+    elements_.clear();
+
+    // Scripts are referenced, not copied.
+    for (const auto& tx: block.transactions())
+    {
+        for (const auto& output: tx.outputs())
+        {
+            const auto& bytes = output.script().bytes();
+
+            if (!bytes.empty() &&
+                bytes.front() != static_cast<uint8_t>(opcode::return_))
+                elements_.emplace_back(bytes);
+        }
+
+        if (tx.is_coinbase())
+            continue;
+
+        for (const auto& input: tx.inputs())
+        {
+            const auto& prevout = input.previous_output().cached_output();
+
+            if (!prevout.is_valid())
+                return false;
+
+            const auto& bytes = prevout.script().bytes();
+
+            if (!bytes.empty())
+                elements_.emplace_back(bytes);
+        }
+    }
+
+    std::sort(elements_.begin(), elements_.end(), less);
+    elements_.erase(std::unique(elements_.begin(), elements_.end(), equal),
+        elements_.end());
+
+    const auto count = static_cast<uint64_t>(elements_.size());
+    const auto range = count * golomb_rate;
+    const auto key = to_siphash_key(block.hash());
+
+    values_.clear();
+    values_.reserve(elements_.size());
+
+    for (const auto& element: elements_)
+        values_.push_back(to_range(siphash(key, element), range));
+
+    std::sort(values_.begin(), values_.end());
+
+    // Twenty bits per element is the expected P + 1.5 rounded up.
+    out.clear();
+    out.reserve(sizeof(uint64_t) + 1 + (elements_.size() * 20) / byte_bits);
+    write_size(out, count);
+
+    bit_writer writer(out);
+    const auto mask = (uint64_t(1) << golomb_bits) - 1;
+    uint64_t previous = 0;
+
+    for (const auto value: values_)
+    {
+        const auto delta = value - previous;
+        writer.write_unary(delta >> golomb_bits);
+        writer.write(delta & mask, golomb_bits);
+        previous = value;
+    }
+
+    writer.flush();
+    return true;
+}
+
+// Match.
+//-----------------------------------------------------------------------------
+
+bool compact_filter::match(const data_chunk& filter,
+    const hash_digest& block_hash, data_slice script)
+{
+    set_reader reader(filter);
+    const auto range = reader.count() * golomb_rate;
+
+    if (range == 0)
+        return false;
+
+    const auto target = to_range(siphash(to_siphash_key(block_hash), script),
+        range);
+
+    uint64_t value;
+    while (reader.next(value))
+        if (value >= target)
+            return value == target;
+
+    return false;
+}
+
+bool compact_filter::match_any(const data_chunk& filter,
+    const hash_digest& block_hash, const data_stack& scripts)
+{
+    set_reader reader(filter);
+    const auto range = reader.count() * golomb_rate;
+
+    if (range == 0 || scripts.empty())
+        return false;
+
+    const auto key = to_siphash_key(block_hash);
+
+    values_.clear();
+    values_.reserve(scripts.size());
+
+    for (const auto& script: scripts)
+        values_.push_back(to_range(siphash(key, script), range));
+
+    std::sort(values_.begin(), values_.end());
+
+    // Both sequences ascend, so each is traversed once.
+    auto query = values_.begin();
+    uint64_t value;
+
+    while (reader.next(value))
+    {
+        while (*query < value)
+            if (++query == values_.end())
+                return false;
+
+        if (*query == value)
+            return true;
+    }
+
+    return false;
+}
+
+// Header.
+//-----------------------------------------------------------------------------
+
+hash_digest compact_filter::to_header(const data_chunk& filter,
+    const hash_digest& previous_header)
+{
+    return merkle_hash(bitcoin_hash(filter), previous_header);
+}
+
+} // namespace chain
+} // namespace libbitcoin
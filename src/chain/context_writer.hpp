@@ -0,0 +1,76 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHAIN_CONTEXT_WRITER_HPP
+#define LIBBITCOIN_CHAIN_CONTEXT_WRITER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/hash_writer.hpp>
+#include "../math/external/sha256.h"
+
+namespace libbitcoin {
+namespace chain {
+
+/// Hash writer over an inline sha256 context, for the txid and signature
+/// hashes. Unlike sha256_writer this does not allocate, and it may continue
+/// the message of a (midstate) context.
+class context_writer final
+  : public hash_writer
+{
+public:
+    /// Begin a new message.
+    context_writer()
+    {
+        SHA256Init(&context_);
+    }
+
+    /// Continue the message of the context.
+    context_writer(const SHA256CTX& context)
+      : context_(context)
+    {
+    }
+
+    /// Single and double sha256 of the message (valid once only).
+    hash_digest sha256_digest()
+    {
+        hash_digest hash;
+        SHA256Final(&context_, hash.data());
+        return hash;
+    }
+
+    hash_digest bitcoin_digest()
+    {
+        return sha256_hash(sha256_digest());
+    }
+
+protected:
+    void update(const uint8_t* data, size_t size) override
+    {
+        SHA256Update(&context_, data, size);
+    }
+
+private:
+    SHA256CTX context_;
+};
+
+} // namespace chain
+} // namespace libbitcoin
+
+#endif
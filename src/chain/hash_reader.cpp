@@ -0,0 +1,319 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "hash_reader.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/endian.hpp>
+#include <bitcoin/bitcoin/utility/reader.hpp>
+#include "../math/external/sha256.h"
+
+namespace libbitcoin {
+namespace chain {
+
+hash_reader::hash_reader(reader& source, bool witness_stream)
+  : source_(source), witness_stream_(witness_stream), witness_(false)
+{
+    SHA256Init(&base_);
+    SHA256Init(&witness_context_);
+}
+
+void hash_reader::set_witness(bool witness)
+{
+    witness_ = witness;
+}
+
+hash_digest hash_reader::base_hash()
+{
+    hash_digest hash;
+    SHA256Final(&base_, hash.data());
+    return sha256_hash(hash);
+}
+
+hash_digest hash_reader::witness_hash()
+{
+    hash_digest hash;
+    SHA256Final(&witness_context_, hash.data());
+    return sha256_hash(hash);
+}
+
+// private
+void hash_reader::write(const uint8_t* data, size_t size)
+{
+    if (!witness_)
+        SHA256Update(&base_, data, size);
+
+    if (witness_stream_)
+        SHA256Update(&witness_context_, data, size);
+}
+
+// private
+void hash_reader::write_variable(uint64_t value, bool little)
+{
+    const auto put = [this, little](uint8_t prefix, uint64_t value,
+        size_t size)
+    {
+        write(&prefix, 1);
+        const auto bytes = little ? to_little_endian(value) :
+            to_big_endian(value);
+
+        // Truncate to the prefixed size from the appropriate end.
+        write(little ? bytes.data() : bytes.data() + bytes.size() - size,
+            size);
+    };
+
+    if (value < varint_two_bytes)
+    {
+        const auto byte = static_cast<uint8_t>(value);
+        write(&byte, 1);
+    }
+    else if (value <= max_uint16)
+        put(varint_two_bytes, value, sizeof(uint16_t));
+    else if (value <= max_uint32)
+        put(varint_four_bytes, value, sizeof(uint32_t));
+    else
+        put(varint_eight_bytes, value, sizeof(uint64_t));
+}
+
+// Context.
+//-----------------------------------------------------------------------------
+
+hash_reader::operator bool() const
+{
+    return source_;
+}
+
+bool hash_reader::operator!() const
+{
+    return !source_;
+}
+
+bool hash_reader::is_exhausted() const
+{
+    return source_.is_exhausted();
+}
+
+void hash_reader::invalidate()
+{
+    source_.invalidate();
+}
+
+size_t hash_reader::remaining() const
+{
+    return source_.remaining();
+}
+
+// Hashes.
+//-----------------------------------------------------------------------------
+
+hash_digest hash_reader::read_hash()
+{
+    const auto value = source_.read_hash();
+    write(value);
+    return value;
+}
+
+short_hash hash_reader::read_short_hash()
+{
+    const auto value = source_.read_short_hash();
+    write(value);
+    return value;
+}
+
+mini_hash hash_reader::read_mini_hash()
+{
+    const auto value = source_.read_mini_hash();
+    write(value);
+    return value;
+}
+
+// Big Endian Integers.
+//-----------------------------------------------------------------------------
+
+uint16_t hash_reader::read_2_bytes_big_endian()
+{
+    const auto value = source_.read_2_bytes_big_endian();
+    write(to_big_endian(value));
+    return value;
+}
+
+uint32_t hash_reader::read_4_bytes_big_endian()
+{
+    const auto value = source_.read_4_bytes_big_endian();
+    write(to_big_endian(value));
+    return value;
+}
+
+uint64_t hash_reader::read_8_bytes_big_endian()
+{
+    const auto value = source_.read_8_bytes_big_endian();
+    write(to_big_endian(value));
+    return value;
+}
+
+uint64_t hash_reader::read_variable_big_endian()
+{
+    const auto value = source_.read_variable_big_endian();
+    write_variable(value, false);
+    return value;
+}
+
+size_t hash_reader::read_size_big_endian()
+{
+    const auto value = source_.read_size_big_endian();
+    write_variable(value, false);
+    return value;
+}
+
+// Little Endian Integers.
+//-----------------------------------------------------------------------------
+
+code hash_reader::read_error_code()
+{
+    const auto value = source_.read_error_code();
+    write(to_little_endian(static_cast<uint32_t>(value.value())));
+    return value;
+}
+
+uint16_t hash_reader::read_2_bytes_little_endian()
+{
+    const auto value = source_.read_2_bytes_little_endian();
+    write(to_little_endian(value));
+    return value;
+}
+
+uint32_t hash_reader::read_4_bytes_little_endian()
+{
+    const auto value = source_.read_4_bytes_little_endian();
+    write(to_little_endian(value));
+    return value;
+}
+
+uint64_t hash_reader::read_8_bytes_little_endian()
+{
+    const auto value = source_.read_8_bytes_little_endian();
+    write(to_little_endian(value));
+    return value;
+}
+
+uint64_t hash_reader::read_variable_little_endian()
+{
+    const auto value = source_.read_variable_little_endian();
+    write_variable(value, true);
+    return value;
+}
+
+size_t hash_reader::read_size_little_endian()
+{
+    const auto value = source_.read_size_little_endian();
+    write_variable(value, true);
+    return value;
+}
+
+// The bytes are hashed as they are read.
+uint64_t hash_reader::read_variable_base128()
+{
+    uint64_t value = 0;
+
+    // Each continued group is stored less one, so each value has one form.
+    while (true)
+    {
+        const auto byte = read_byte();
+
+        if (value > (max_uint64 >> 7))
+        {
+            invalidate();
+            return 0;
+        }
+
+        value = (value << 7) | (byte & 0x7f);
+
+        if ((byte & 0x80) == 0)
+            return value;
+
+        if (value == max_uint64)
+        {
+            invalidate();
+            return 0;
+        }
+
+        ++value;
+    }
+}
+
+// Bytes.
+//-----------------------------------------------------------------------------
+
+uint8_t hash_reader::peek_byte()
+{
+    return source_.peek_byte();
+}
+
+uint8_t hash_reader::read_byte()
+{
+    const auto value = source_.read_byte();
+    write(&value, 1);
+    return value;
+}
+
+data_chunk hash_reader::read_bytes()
+{
+    const auto value = source_.read_bytes();
+    write(value);
+    return value;
+}
+
+data_chunk hash_reader::read_bytes(size_t size)
+{
+    const auto value = source_.read_bytes(size);
+    write(value);
+    return value;
+}
+
+void hash_reader::read_bytes(data_chunk& out, size_t size)
+{
+    source_.read_bytes(out, size);
+    write(out);
+}
+
+std::string hash_reader::read_string()
+{
+    return read_string(read_size_little_endian());
+}
+
+// Removes trailing zeros, required for bitcoin string comparisons.
+std::string hash_reader::read_string(size_t size)
+{
+    const auto value = read_bytes(size);
+    return{ value.begin(), std::find(value.begin(), value.end(), 0x00) };
+}
+
+void hash_reader::skip(size_t size)
+{
+    read_bytes(size);
+}
+
+} // namespace chain
+} // namespace libbitcoin
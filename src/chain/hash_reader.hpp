@@ -0,0 +1,124 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHAIN_HASH_READER_HPP
+#define LIBBITCOIN_CHAIN_HASH_READER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/reader.hpp>
+#include "../math/external/sha256.h"
+
+namespace libbitcoin {
+namespace chain {
+
+/// Reader decorator that feeds each consumed value, in its canonical wire
+/// encoding, into two running sha256 contexts. The witness stream receives
+/// all bytes, the base stream excludes those read while witness is set.
+/// This produces the txid and wtxid preimage hashes as a side effect of
+/// transaction deserialization. Peeked bytes are not consumed.
+class hash_reader
+  : public reader
+{
+public:
+    hash_reader(reader& source, bool witness_stream);
+
+    /// Exclude subsequent bytes from the base stream.
+    void set_witness(bool witness);
+
+    /// Double sha256 of the base and witness streams (valid once only).
+    hash_digest base_hash();
+    hash_digest witness_hash();
+
+    /// Context.
+    operator bool() const;
+    bool operator!() const;
+    bool is_exhausted() const;
+    void invalidate();
+    size_t remaining() const;
+
+    /// Read hashes.
+    hash_digest read_hash();
+    short_hash read_short_hash();
+    mini_hash read_mini_hash();
+
+    /// Read big endian integers.
+    uint16_t read_2_bytes_big_endian();
+    uint32_t read_4_bytes_big_endian();
+    uint64_t read_8_bytes_big_endian();
+    uint64_t read_variable_big_endian();
+    size_t read_size_big_endian();
+
+    /// Read little endian integers.
+    code read_error_code();
+    uint16_t read_2_bytes_little_endian();
+    uint32_t read_4_bytes_little_endian();
+    uint64_t read_8_bytes_little_endian();
+    uint64_t read_variable_little_endian();
+    size_t read_size_little_endian();
+
+    /// Read base 128 integer, most significant group first.
+    uint64_t read_variable_base128();
+
+    /// Read/peek one byte.
+    uint8_t peek_byte();
+    uint8_t read_byte();
+
+    /// Read all remaining bytes.
+    data_chunk read_bytes();
+
+    /// Read required size buffer.
+    data_chunk read_bytes(size_t size);
+
+    /// Read required size buffer into out, reusing its capacity.
+    void read_bytes(data_chunk& out, size_t size);
+
+    /// Read variable length string.
+    std::string read_string();
+
+    /// Read required length string and trim nulls.
+    std::string read_string(size_t size);
+
+    /// Advance iterator, the skipped bytes are hashed.
+    void skip(size_t size);
+
+private:
+    void write(const uint8_t* data, size_t size);
+    void write_variable(uint64_t value, bool little);
+
+    template <typename Data>
+    void write(const Data& data)
+    {
+        write(data.data(), data.size());
+    }
+
+    reader& source_;
+    const bool witness_stream_;
+    bool witness_;
+    SHA256CTX base_;
+    SHA256CTX witness_context_;
+};
+
+} // namespace chain
+} // namespace libbitcoin
+
+#endif
@@ -18,6 +18,7 @@
  */
 #include <bitcoin/bitcoin/chain/header.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <utility>
@@ -26,8 +27,9 @@
 #include <bitcoin/bitcoin/constants.hpp>
 #include <bitcoin/bitcoin/error.hpp>
 #include <bitcoin/bitcoin/math/hash.hpp>
-#include <bitcoin/bitcoin/utility/container_sink.hpp>
-#include <bitcoin/bitcoin/utility/container_source.hpp>
+#include <bitcoin/bitcoin/math/uint256.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/endian.hpp>
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
 #include <bitcoin/bitcoin/utility/ostream_writer.hpp>
 
@@ -37,6 +39,15 @@ namespace chain {
 // Use system clock because we require accurate time of day.
 using wall_clock = std::chrono::system_clock;
 
+BC_CONSTEXPR size_t header::wire_size;
+
+// Offsets of the fixed serialization.
+static BC_CONSTEXPR size_t previous_offset = 4;
+static BC_CONSTEXPR size_t merkle_offset = previous_offset + hash_size;
+static BC_CONSTEXPR size_t timestamp_offset = merkle_offset + hash_size;
+static BC_CONSTEXPR size_t bits_offset = timestamp_offset + 4;
+static BC_CONSTEXPR size_t nonce_offset = bits_offset + 4;
+
 // Constructors.
 //-----------------------------------------------------------------------------
 
@@ -46,7 +57,7 @@ header::header()
 }
 
 header::header(header&& other)
-  : hash_(other.hash_cache()),
+  : hash_(other.hash_),
     version_(other.version_),
     previous_block_hash_(std::move(other.previous_block_hash_)),
     merkle_(std::move(other.merkle_)),
@@ -58,7 +69,7 @@ header::header(header&& other)
 }
 
 header::header(const header& other)
-  : hash_(other.hash_cache()),
+  : hash_(other.hash_),
     version_(other.version_),
     previous_block_hash_(other.previous_block_hash_),
     merkle_(other.merkle_),
@@ -94,19 +105,12 @@ header::header(uint32_t version, const hash_digest& previous_block_hash,
 {
 }
 
-// Private cache access for copy/move construction.
-header::hash_ptr header::hash_cache() const
-{
-    shared_lock lock(mutex_);
-    return hash_;
-}
-
 // Operators.
 //-----------------------------------------------------------------------------
 
 header& header::operator=(header&& other)
 {
-    hash_ = other.hash_cache();
+    hash_ = other.hash_;
     version_ = other.version_;
     previous_block_hash_ = std::move(other.previous_block_hash_);
     merkle_ = std::move(other.merkle_);
@@ -119,7 +123,7 @@ header& header::operator=(header&& other)
 
 header& header::operator=(const header& other)
 {
-    hash_ = other.hash_cache();
+    hash_ = other.hash_;
     version_ = other.version_;
     previous_block_hash_ = other.previous_block_hash_;
     merkle_ = other.merkle_;
@@ -190,8 +194,8 @@ header header::factory(reader& source, const hash_digest& hash, bool wire)
 
 bool header::from_data(const data_chunk& data, bool wire)
 {
-    data_source istream(data);
-    return from_data(istream, wire);
+    byte_reader source(data);
+    return from_data(source, wire);
 }
 
 bool header::from_data(std::istream& stream, bool wire)
@@ -222,7 +226,8 @@ bool header::from_data(reader& source, hash_digest&& hash, bool wire)
     if (!from_data(source, wire))
         return false;
 
-    hash_ = std::make_shared<hash_digest>(std::move(hash));
+    hash_.reset();
+    hash_.set(std::move(hash));
     return true;
 }
 
@@ -231,7 +236,22 @@ bool header::from_data(reader& source, const hash_digest& hash, bool wire)
     if (!from_data(source, wire))
         return false;
 
-    hash_ = std::make_shared<hash_digest>(hash);
+    hash_.reset();
+    hash_.set(hash);
+    return true;
+}
+
+bool header::from_wire_data(const wire_data& data)
+{
+    const auto bytes = data.data();
+    version_ = load_little_endian<uint32_t>(bytes);
+    std::copy_n(bytes + previous_offset, hash_size,
+        previous_block_hash_.begin());
+    std::copy_n(bytes + merkle_offset, hash_size, merkle_.begin());
+    timestamp_ = load_little_endian<uint32_t>(bytes + timestamp_offset);
+    bits_ = load_little_endian<uint32_t>(bytes + bits_offset);
+    nonce_ = load_little_endian<uint32_t>(bytes + nonce_offset);
+    invalidate_cache();
     return true;
 }
 
@@ -260,16 +280,10 @@ bool header::is_valid() const
 // Serialization.
 //-----------------------------------------------------------------------------
 
-data_chunk header::to_data(bool wire) const
+data_chunk header::to_data(bool) const
 {
-    data_chunk data;
-    const auto size = serialized_size(wire);
-    data.reserve(size);
-    data_sink ostream(data);
-    to_data(ostream, wire);
-    ostream.flush();
-    BITCOIN_ASSERT(data.size() == size);
-    return data;
+    const auto data = to_wire_data();
+    return data_chunk(data.begin(), data.end());
 }
 
 void header::to_data(std::ostream& stream, bool wire) const
@@ -288,18 +302,27 @@ void header::to_data(writer& sink, bool) const
     sink.write_4_bytes_little_endian(nonce_);
 }
 
+header::wire_data header::to_wire_data() const
+{
+    wire_data data;
+    const auto bytes = data.data();
+    store_little_endian(bytes, version_);
+    std::copy(previous_block_hash_.begin(), previous_block_hash_.end(),
+        bytes + previous_offset);
+    std::copy(merkle_.begin(), merkle_.end(), bytes + merkle_offset);
+    store_little_endian(bytes + timestamp_offset, timestamp_);
+    store_little_endian(bytes + bits_offset, bits_);
+    store_little_endian(bytes + nonce_offset, nonce_);
+    return data;
+}
+
 // Size.
 //-----------------------------------------------------------------------------
 
 // static
 size_t header::satoshi_fixed_size()
 {
-    return sizeof(version_)
-        + hash_size
-        + hash_size
-        + sizeof(timestamp_)
-        + sizeof(bits_)
-        + sizeof(nonce_);
+    return wire_size;
 }
 
 size_t header::serialized_size(bool) const
@@ -307,6 +330,11 @@ size_t header::serialized_size(bool) const
     return satoshi_fixed_size();
 }
 
+size_t header::heap_size() const
+{
+    return 0;
+}
+
 // Accessors.
 //-----------------------------------------------------------------------------
 
@@ -394,48 +422,58 @@ void header::set_nonce(uint32_t value)
 // protected
 void header::invalidate_cache() const
 {
-    ///////////////////////////////////////////////////////////////////////////
-    // Critical Section
-    mutex_.lock_upgrade();
+    hash_.reset();
+}
+
+// protected
+void header::set_hash(const hash_digest& hash) const
+{
+    hash_.set(hash);
+}
+
+hash_digest header::hash() const
+{
+    return hash_.get([this]()
+    {
+        return bitcoin_hash(to_wire_data());
+    });
+}
+
+// Validation helpers.
+//-----------------------------------------------------------------------------
 
-    if (hash_)
+// True if the little-endian value is no greater than the little-endian
+// maximum, comparing words from the most significant until they differ.
+static bool is_at_most(const hash_digest& value, const hash_digest& maximum)
+{
+    for (auto offset = hash_size; offset != 0; offset -= sizeof(uint64_t))
     {
-        mutex_.unlock_upgrade_and_lock();
-        //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-        hash_.reset();
-        //---------------------------------------------------------------------
-        mutex_.unlock_and_lock_upgrade();
+        const auto left = load_little_endian<uint64_t>(&value[offset - 8]);
+        const auto right = load_little_endian<uint64_t>(&maximum[offset - 8]);
+
+        if (left != right)
+            return left < right;
     }
 
-    mutex_.unlock_upgrade();
-    ///////////////////////////////////////////////////////////////////////////
+    return true;
 }
 
-hash_digest header::hash() const
+// The expanded proof of work limit of the last network checked by the thread.
+// The initial value is the (zero) expansion of a zero limit.
+static const hash_digest& pow_limit(uint32_t proof_of_work_limit)
 {
-    ///////////////////////////////////////////////////////////////////////////
-    // Critical Section
-    mutex_.lock_upgrade();
+    thread_local uint32_t limit = 0;
+    thread_local hash_digest expanded = null_hash;
 
-    if (!hash_)
+    if (proof_of_work_limit != limit)
     {
-        //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-        mutex_.unlock_upgrade_and_lock();
-        hash_ = std::make_shared<hash_digest>(bitcoin_hash(to_data()));
-        mutex_.unlock_and_lock_upgrade();
-        //---------------------------------------------------------------------
+        compact::expand(expanded, proof_of_work_limit);
+        limit = proof_of_work_limit;
     }
 
-    const auto hash = *hash_;
-    mutex_.unlock_upgrade();
-    ///////////////////////////////////////////////////////////////////////////
-
-    return hash;
+    return expanded;
 }
 
-// Validation helpers.
-//-----------------------------------------------------------------------------
-
 /// BUGBUG: bitcoin 32bit unix time: en.wikipedia.org/wiki/Year_2038_problem
 bool header::is_valid_timestamp(uint32_t timestamp_limit_seconds) const
 {
@@ -449,20 +487,25 @@ bool header::is_valid_timestamp(uint32_t timestamp_limit_seconds) const
 bool header::is_valid_proof_of_work(uint32_t proof_of_work_limit,
     bool scrypt) const
 {
-    const auto bits = compact(bits_);
-    static const uint256_t pow_limit(compact{ proof_of_work_limit });
+    return is_valid_proof_of_work(proof_of_work_limit,
+        scrypt ? scrypt_hash(to_wire_data()) : hash());
+}
 
-    if (bits.is_overflowed())
-        return false;
+bool header::is_valid_proof_of_work(uint32_t proof_of_work_limit,
+    const hash_digest& pow_hash) const
+{
+    hash_digest target;
 
-    uint256_t target(bits);
+    if (!compact::expand(target, bits_))
+        return false;
 
     // Ensure claimed work is within limits.
-    if (target < 1 || target > pow_limit)
+    if (target == null_hash || !is_at_most(target,
+        pow_limit(proof_of_work_limit)))
         return false;
 
     // Ensure actual work is at least claimed amount (smaller is more work).
-    return to_uint256(scrypt ? scrypt_hash(to_data()) : hash()) <= target;
+    return is_at_most(pow_hash, target);
 }
 
 // static
@@ -502,8 +545,14 @@ uint256_t header::proof() const
 code header::check(uint32_t timestamp_limit_seconds,
     uint32_t proof_of_work_limit, bool scrypt) const
 {
+    return check(timestamp_limit_seconds, proof_of_work_limit,
+        scrypt ? scrypt_hash(to_wire_data()) : hash());
+}
 
-    if (!is_valid_proof_of_work(proof_of_work_limit, scrypt))
+code header::check(uint32_t timestamp_limit_seconds,
+    uint32_t proof_of_work_limit, const hash_digest& pow_hash) const
+{
+    if (!is_valid_proof_of_work(proof_of_work_limit, pow_hash))
         return error::invalid_proof_of_work;
 
     else if (!is_valid_timestamp(timestamp_limit_seconds))
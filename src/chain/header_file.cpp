@@ -0,0 +1,411 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/chain/header_file.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <vector>
+#include <boost/filesystem.hpp>
+#include <boost/system/error_code.hpp>
+#include <bitcoin/bitcoin/chain/chain_state.hpp>
+#include <bitcoin/bitcoin/chain/header.hpp>
+#include <bitcoin/bitcoin/chain/header_index.hpp>
+#include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/math/uint256.hpp>
+#include <bitcoin/bitcoin/utility/assert.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/endian.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+// Record field offsets.
+static const size_t hash_offset = 80;
+static const size_t work_offset = hash_offset + hash_size;
+static const size_t height_offset = work_offset + hash_size;
+static const size_t parent_offset = height_offset + sizeof(uint32_t);
+static const size_t skip_offset = parent_offset + sizeof(uint32_t);
+
+// Header field offsets, in its wire serialization.
+static const size_t version_offset = 0;
+static const size_t timestamp_offset = 68;
+static const size_t bits_offset = 72;
+
+// The parent of the genesis entry.
+static const uint32_t no_parent = max_uint32;
+
+static uint32_t to_value(const uint8_t* record, size_t offset)
+{
+    return from_little_endian_unsafe<uint32_t>(record + offset);
+}
+
+// Storage.
+//-----------------------------------------------------------------------------
+
+static void write_record(data_chunk& out, const header_index& index,
+    size_t position)
+{
+    const auto parent = index.parent(position);
+    const auto& header = index.header(position);
+
+    byte_writer sink(out);
+    header.to_data(sink);
+    sink.write_hash(header.hash());
+    sink.write_hash(index.work(position).hash());
+    sink.write_4_bytes_little_endian(
+        static_cast<uint32_t>(index.height(position)));
+    sink.write_4_bytes_little_endian(parent == header_index::not_found ?
+        no_parent : static_cast<uint32_t>(parent));
+    sink.write_4_bytes_little_endian(
+        static_cast<uint32_t>(index.skip(position)));
+    sink.write_4_bytes_little_endian(0);
+}
+
+// static
+bool header_file::store(const path& file, const header_index& index)
+{
+    // The file is created (not truncated) by an appending output stream, as
+    // an input and output stream does not create.
+    {
+        std::ofstream create(file.string(), std::ios::binary |
+            std::ios::app);
+
+        if (!create)
+            return false;
+    }
+
+    std::fstream stream(file.string(), std::ios::in | std::ios::out |
+        std::ios::binary);
+    stream.seekg(0, std::ios::end);
+    const auto end = static_cast<size_t>(stream.tellg());
+
+    if (!stream || (end != 0 && (end < prefix_size ||
+        (end - prefix_size) % record_size != 0)))
+        return false;
+
+    const auto stored = end == 0 ? 0 : (end - prefix_size) / record_size;
+
+    if (stored > index.size())
+        return false;
+
+    data_chunk data;
+
+    // The file must be a header file, of which the last stored entry is
+    // that of the index.
+    if (end != 0)
+    {
+        data.resize(record_size);
+        stream.seekg(0);
+        stream.read(reinterpret_cast<char*>(data.data()), prefix_size);
+
+        if (!stream || to_value(data.data(), 0) != magic ||
+            to_value(data.data(), sizeof(uint32_t)) != version)
+            return false;
+    }
+
+    if (stored > 0)
+    {
+        stream.seekg(end - record_size);
+        stream.read(reinterpret_cast<char*>(data.data()), record_size);
+        const auto position = stored - 1;
+
+        if (!stream || !std::equal(data.begin() + hash_offset,
+            data.begin() + work_offset,
+            index.header(position).hash().begin()))
+            return false;
+    }
+
+    data.clear();
+    data.reserve(prefix_size + (index.size() - stored) * record_size);
+    byte_writer sink(data);
+    sink.write_4_bytes_little_endian(magic);
+    sink.write_4_bytes_little_endian(version);
+    sink.write_8_bytes_little_endian(index.top());
+
+    for (auto position = stored; position < index.size(); ++position)
+        write_record(data, index, position);
+
+    const auto records = reinterpret_cast<const char*>(data.data()) +
+        prefix_size;
+    stream.seekp(0);
+    stream.write(reinterpret_cast<const char*>(data.data()), prefix_size);
+    stream.seekp(end == 0 ? prefix_size : end);
+    stream.write(records, data.size() - prefix_size);
+    stream.flush();
+    return !!stream;
+}
+
+// Construction.
+//-----------------------------------------------------------------------------
+
+header_file::header_file()
+  : size_(0), top_(0)
+{
+}
+
+bool header_file::open(const path& file)
+{
+    close();
+    boost::system::error_code ec;
+
+    // An empty file cannot be mapped.
+    if (boost::filesystem::file_size(file, ec) == 0 || ec)
+        return false;
+
+    try
+    {
+        file_.open(file.string());
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+
+    if (!file_.is_open())
+        return false;
+
+    const auto begin = reinterpret_cast<const uint8_t*>(file_.data());
+    const auto size = file_.size();
+    const auto records = size < prefix_size ? 0 :
+        (size - prefix_size) / record_size;
+    byte_reader source({ begin, begin + size });
+
+    if (source.read_4_bytes_little_endian() != magic ||
+        source.read_4_bytes_little_endian() != version ||
+        (size - prefix_size) % record_size != 0)
+    {
+        close();
+        return false;
+    }
+
+    const auto top = source.read_8_bytes_little_endian();
+
+    if (!source || top >= records)
+    {
+        close();
+        return false;
+    }
+
+    size_ = records;
+    top_ = static_cast<size_t>(top);
+    return true;
+}
+
+void header_file::close()
+{
+    if (file_.is_open())
+        file_.close();
+
+    size_ = 0;
+    top_ = 0;
+}
+
+bool header_file::is_open() const
+{
+    return file_.is_open();
+}
+
+// Properties.
+//-----------------------------------------------------------------------------
+
+size_t header_file::size() const
+{
+    return size_;
+}
+
+size_t header_file::top() const
+{
+    return top_;
+}
+
+// private
+const uint8_t* header_file::record(size_t position) const
+{
+    BITCOIN_ASSERT(position < size_);
+    return reinterpret_cast<const uint8_t*>(file_.data()) + prefix_size +
+        position * record_size;
+}
+
+const uint8_t* header_file::header_data(size_t position) const
+{
+    return record(position);
+}
+
+chain::header header_file::header(size_t position) const
+{
+    const auto entry = record(position);
+    byte_reader source({ entry, entry + hash_offset });
+    return chain::header::factory(source, hash(position));
+}
+
+hash_digest header_file::hash(size_t position) const
+{
+    hash_digest out;
+    const auto entry = record(position) + hash_offset;
+    std::copy_n(entry, hash_size, out.begin());
+    return out;
+}
+
+uint256_t header_file::work(size_t position) const
+{
+    hash_digest value;
+    const auto entry = record(position) + work_offset;
+    std::copy_n(entry, hash_size, value.begin());
+    return uint256_t(value);
+}
+
+size_t header_file::height(size_t position) const
+{
+    return to_value(record(position), height_offset);
+}
+
+size_t header_file::parent(size_t position) const
+{
+    const auto value = to_value(record(position), parent_offset);
+    return value == no_parent ? header_index::not_found : value;
+}
+
+size_t header_file::skip(size_t position) const
+{
+    return to_value(record(position), skip_offset);
+}
+
+// As header_index::ancestor.
+size_t header_file::ancestor(size_t position, size_t height) const
+{
+    auto current = this->height(position);
+
+    if (height > current)
+        return header_index::not_found;
+
+    while (current > height)
+    {
+        const auto skip = header_index::skip_height(current);
+        const auto previous = header_index::skip_height(current - 1);
+
+        if (skip == height || (skip > height &&
+            !(previous + 2 < skip && previous >= height)))
+        {
+            position = this->skip(position);
+            current = skip;
+        }
+        else
+        {
+            position = parent(position);
+            --current;
+        }
+    }
+
+    return position;
+}
+
+// Chain state.
+//-----------------------------------------------------------------------------
+
+// The windows lie directly below the entry, so they are read by following
+// parents from the entry. Other heights are reached by skip links.
+bool header_file::populate(chain_state::data& out,
+    const chain_state::map& map, size_t position) const
+{
+    static const auto unrequested = chain_state::map::unrequested;
+
+    if (position >= size_)
+        return false;
+
+    const auto height = this->height(position);
+    auto low = height;
+
+    const auto lower = [&](const chain_state::range& range)
+    {
+        if (range.count == 0)
+            return true;
+
+        if (range.high > height || range.count > range.high + 1)
+            return false;
+
+        low = std::min(low, range.high + 1 - range.count);
+        return true;
+    };
+
+    if (!lower(map.bits) || !lower(map.version) || !lower(map.timestamp))
+        return false;
+
+    std::vector<const uint8_t*> window(height - low + 1);
+    auto current = position;
+
+    for (auto index = window.size(); index > 0; --index)
+    {
+        window[index - 1] = record(current);
+        current = parent(current);
+    }
+
+    // A height of the window or of an ancestor (which must not be above).
+    const auto at = [&](size_t value)
+    {
+        return value >= low ? window[value - low] :
+            record(ancestor(position, value));
+    };
+
+    const auto fill = [&](shared_window<uint32_t>& ordered,
+        const chain_state::range& range, size_t offset)
+    {
+        ordered.clear();
+
+        for (auto value = range.high + 1 - range.count; value <= range.high &&
+            range.count > 0; ++value)
+            ordered.push_back(to_value(at(value), offset));
+    };
+
+    const auto self = [&](size_t value, size_t offset)
+    {
+        return value == unrequested || value > height ? 0 :
+            to_value(at(value), offset);
+    };
+
+    const auto hash_at = [&](size_t value)
+    {
+        return value == unrequested || value > height ? null_hash :
+            hash(ancestor(position, value));
+    };
+
+    out.height = height;
+    out.hash = hash(position);
+    out.bip9_bit0_hash = hash_at(map.bip9_bit0_height);
+    out.bip9_bit1_hash = hash_at(map.bip9_bit1_height);
+
+    fill(out.bits.ordered, map.bits, bits_offset);
+    out.bits.self = self(map.bits_self, bits_offset);
+
+    fill(out.version.ordered, map.version, version_offset);
+    out.version.self = self(map.version_self, version_offset);
+
+    fill(out.timestamp.ordered, map.timestamp, timestamp_offset);
+    out.timestamp.self = self(map.timestamp_self, timestamp_offset);
+    out.timestamp.retarget = self(map.timestamp_retarget, timestamp_offset);
+    return true;
+}
+
+} // namespace chain
+} // namespace libbitcoin
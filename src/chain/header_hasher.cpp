@@ -0,0 +1,80 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/chain/header_hasher.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/bitcoin/chain/header.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include "../math/external/sha256.h"
+
+namespace libbitcoin {
+namespace chain {
+
+// The nonces of a consecutive sweep are generated in chunks of this size.
+static BC_CONSTEXPR size_t nonce_chunk = 64;
+
+static_assert(header::wire_size == SHA256_BLOCK_LENGTH +
+    SHA256_NONCE_TAIL_LENGTH + sizeof(uint32_t), "unexpected header size");
+
+header_hasher::header_hasher(const header& header)
+{
+    const auto data = header.to_wire_data();
+    SHA256Midstate(data.data(), midstate_.data());
+    std::copy_n(data.begin() + SHA256_BLOCK_LENGTH, tail_.size(),
+        tail_.begin());
+}
+
+hash_digest header_hasher::hash(uint32_t nonce) const
+{
+    hash_digest out;
+    hash(&nonce, 1, &out);
+    return out;
+}
+
+void header_hasher::hash(const uint32_t* nonces, size_t count,
+    hash_digest* out) const
+{
+    static_assert(sizeof(hash_digest) == SHA256_DIGEST_LENGTH,
+        "unexpected digest size");
+
+    const auto digests = reinterpret_cast<uint8_t(*)[SHA256_DIGEST_LENGTH]>(
+        out);
+    SHA256Double80Batch(midstate_.data(), tail_.data(), nonces, count,
+        digests);
+}
+
+void header_hasher::hash(uint32_t first, size_t count, hash_digest* out) const
+{
+    std::array<uint32_t, nonce_chunk> nonces;
+
+    for (size_t offset = 0; offset < count; offset += nonce_chunk)
+    {
+        const auto size = std::min(nonce_chunk, count - offset);
+
+        for (size_t index = 0; index < size; ++index)
+            nonces[index] = static_cast<uint32_t>(first + offset + index);
+
+        hash(nonces.data(), size, out + offset);
+    }
+}
+
+} // namespace chain
+} // namespace libbitcoin
@@ -0,0 +1,258 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/chain/header_index.hpp>
+
+#include <cstddef>
+#include <bitcoin/bitcoin/chain/block.hpp>
+#include <bitcoin/bitcoin/chain/header.hpp>
+#include <bitcoin/bitcoin/chain/header_file.hpp>
+#include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/math/uint256.hpp>
+#include <bitcoin/bitcoin/utility/assert.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+const size_t header_index::not_found = max_size_t;
+
+header_index::header_index(const chain::header& genesis)
+  : top_(0)
+{
+    entries_.push_back({ genesis, genesis.proof(), 0, not_found, 0 });
+    positions_.emplace(genesis.hash(), 0);
+}
+
+// The hashes and work of the file are trusted, as the file was stored from
+// an index.
+header_index::header_index(const header_file& file)
+  : top_(file.top())
+{
+    BITCOIN_ASSERT(file.is_open() && file.size() > 0);
+    const auto size = file.size();
+    reserve(size);
+
+    for (size_t position = 0; position < size; ++position)
+    {
+        const auto header = file.header(position);
+        entries_.push_back({ header, file.work(position),
+            file.height(position), file.parent(position),
+            file.skip(position) });
+        positions_.emplace(header.hash(), position);
+    }
+}
+
+void header_index::reserve(size_t size)
+{
+    entries_.reserve(size);
+    positions_.reserve(size);
+}
+
+bool header_index::insert(const chain::header& header)
+{
+    const auto hash = header.hash();
+
+    if (positions_.find(hash) != positions_.end())
+        return false;
+
+    const auto it = positions_.find(header.previous_block_hash());
+
+    if (it == positions_.end())
+        return false;
+
+    const auto parent = it->second;
+    const auto height = entries_[parent].height + 1;
+    const auto skip = ancestor(parent, skip_height(height));
+    const auto work = entries_[parent].work + header.proof();
+    const auto position = entries_.size();
+
+    entries_.push_back({ header, work, height, parent, skip });
+    positions_.emplace(hash, position);
+
+    // Ties are resolved in favor of the first inserted.
+    if (work > entries_[top_].work)
+        top_ = position;
+
+    return true;
+}
+
+size_t header_index::find(const hash_digest& hash) const
+{
+    const auto it = positions_.find(hash);
+    return it == positions_.end() ? not_found : it->second;
+}
+
+size_t header_index::size() const
+{
+    return entries_.size();
+}
+
+size_t header_index::top() const
+{
+    return top_;
+}
+
+const chain::header& header_index::header(size_t position) const
+{
+    BITCOIN_ASSERT(position < entries_.size());
+    return entries_[position].header;
+}
+
+size_t header_index::height(size_t position) const
+{
+    BITCOIN_ASSERT(position < entries_.size());
+    return entries_[position].height;
+}
+
+size_t header_index::parent(size_t position) const
+{
+    BITCOIN_ASSERT(position < entries_.size());
+    return entries_[position].parent;
+}
+
+const uint256_t& header_index::work(size_t position) const
+{
+    BITCOIN_ASSERT(position < entries_.size());
+    return entries_[position].work;
+}
+
+size_t header_index::skip(size_t position) const
+{
+    BITCOIN_ASSERT(position < entries_.size());
+    return entries_[position].skip;
+}
+
+// Skip links.
+//-----------------------------------------------------------------------------
+
+// Clear the lowest set bit.
+inline size_t invert_lowest_one(size_t value)
+{
+    return value & (value - 1);
+}
+
+// Any value lower than the height would do, but this choice (as bitcoind)
+// reaches any ancestor from any height in O(log n) steps.
+size_t header_index::skip_height(size_t height)
+{
+    if (height < 2)
+        return 0;
+
+    return (height & 1) != 0 ?
+        invert_lowest_one(invert_lowest_one(height - 1)) + 1 :
+        invert_lowest_one(height);
+}
+
+size_t header_index::ancestor(size_t position, size_t height) const
+{
+    BITCOIN_ASSERT(position < entries_.size());
+    auto current = entries_[position].height;
+
+    if (height > current)
+        return not_found;
+
+    while (current > height)
+    {
+        const auto skip = skip_height(current);
+        const auto previous = skip_height(current - 1);
+
+        // Follow the skip unless the parent's skip reaches closer.
+        if (skip == height || (skip > height &&
+            !(previous + 2 < skip && previous >= height)))
+        {
+            position = entries_[position].skip;
+            current = skip;
+        }
+        else
+        {
+            position = entries_[position].parent;
+            --current;
+        }
+    }
+
+    return position;
+}
+
+size_t header_index::fork_point(size_t first, size_t second) const
+{
+    const auto first_height = height(first);
+    const auto second_height = height(second);
+
+    if (first_height > second_height)
+        first = ancestor(first, second_height);
+    else if (second_height > first_height)
+        second = ancestor(second, first_height);
+
+    // Entries of equal height have skips of equal height, so differing skips
+    // imply that the fork point is below them.
+    while (first != second)
+    {
+        const auto& left = entries_[first];
+        const auto& right = entries_[second];
+
+        if (left.skip != right.skip)
+        {
+            first = left.skip;
+            second = right.skip;
+        }
+        else
+        {
+            first = left.parent;
+            second = right.parent;
+        }
+    }
+
+    return first;
+}
+
+// Locators.
+//-----------------------------------------------------------------------------
+
+// Heights descend, so each ancestor is reached from the last.
+hash_list header_index::locator(size_t position) const
+{
+    const auto heights = block::locator_heights(height(position));
+    hash_list hashes;
+    hashes.reserve(heights.size());
+
+    for (const auto height: heights)
+    {
+        position = ancestor(position, height);
+        hashes.push_back(entries_[position].header.hash());
+    }
+
+    return hashes;
+}
+
+size_t header_index::locate(const hash_list& locator) const
+{
+    for (const auto& hash: locator)
+    {
+        const auto position = find(hash);
+
+        if (position != not_found &&
+            ancestor(top_, entries_[position].height) == position)
+            return position;
+    }
+
+    return 0;
+}
+
+} // namespace chain
+} // namespace libbitcoin
@@ -20,11 +20,12 @@
 
 #include <algorithm>
 #include <sstream>
+#include <bitcoin/bitcoin/chain/redeem_script_cache.hpp>
 #include <bitcoin/bitcoin/chain/script.hpp>
 #include <bitcoin/bitcoin/chain/witness.hpp>
 #include <bitcoin/bitcoin/constants.hpp>
-#include <bitcoin/bitcoin/utility/container_sink.hpp>
-#include <bitcoin/bitcoin/utility/container_source.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
 #include <bitcoin/bitcoin/utility/ostream_writer.hpp>
 #include <bitcoin/bitcoin/wallet/payment_address.hpp>
@@ -40,63 +41,58 @@ using namespace bc::machine;
 
 input::input()
   : previous_output_{},
-    script_{},
-    sequence_(0)
+    sequence_(0),
+    script_{}
 {
 }
 
 input::input(input&& other)
-  : addresses_(other.addresses_cache()),
-    previous_output_(std::move(other.previous_output_)),
+  : previous_output_(std::move(other.previous_output_)),
+    sequence_(other.sequence_),
     script_(std::move(other.script_)),
     witness_(std::move(other.witness_)),
-    sequence_(other.sequence_)
+    sigops_(other.sigops_),
+    addresses_(std::move(other.addresses_))
 {
 }
 
 input::input(const input& other)
-  : addresses_(other.addresses_cache()),
-    previous_output_(other.previous_output_),
-    script_(std::move(other.script_)),
+  : previous_output_(other.previous_output_),
+    sequence_(other.sequence_),
+    script_(other.script_),
     witness_(other.witness_),
-    sequence_(other.sequence_)
+    sigops_(other.sigops_),
+    addresses_(other.addresses_)
 {
 }
 
 input::input(output_point&& previous_output, chain::script&& script,
     uint32_t sequence)
   : previous_output_(std::move(previous_output)),
-    script_(std::move(script)),
-    sequence_(sequence)
+    sequence_(sequence),
+    script_(std::move(script))
 {
 }
 
 input::input(const output_point& previous_output, const chain::script& script,
     uint32_t sequence)
   : previous_output_(previous_output),
-    script_(script),
-    sequence_(sequence)
+    sequence_(sequence),
+    script_(script)
 {
 }
 
-// Private cache access for copy/move construction.
-input::addresses_ptr input::addresses_cache() const
-{
-    shared_lock lock(mutex_);
-    return addresses_;
-}
-
 input::input(output_point&& previous_output, chain::script&& script,
     chain::witness&& witness, uint32_t sequence)
-  : previous_output_(std::move(previous_output)), script_(std::move(script)),
-    witness_(std::move(witness)), sequence_(sequence)
+  : previous_output_(std::move(previous_output)), sequence_(sequence),
+    script_(std::move(script)), witness_(std::move(witness))
 {
 }
 
 input::input(const output_point& previous_output, const chain::script& script,
     const chain::witness& witness, uint32_t sequence)
-  : previous_output_(previous_output), script_(script), witness_(witness),
-    sequence_(sequence)
+  : previous_output_(previous_output), sequence_(sequence), script_(script),
+    witness_(witness)
 {
 }
 
@@ -105,21 +101,23 @@ input::input(const output_point& previous_output, const chain::script& script,
 
 input& input::operator=(input&& other)
 {
-    addresses_ = other.addresses_cache();
     previous_output_ = std::move(other.previous_output_);
+    sequence_ = other.sequence_;
     script_ = std::move(other.script_);
     witness_ = std::move(other.witness_);
-    sequence_ = other.sequence_;
+    sigops_ = other.sigops_;
+    addresses_ = std::move(other.addresses_);
     return *this;
 }
 
 input& input::operator=(const input& other)
 {
-    addresses_ = other.addresses_cache();
     previous_output_ = other.previous_output_;
+    sequence_ = other.sequence_;
     script_ = other.script_;
     witness_ = other.witness_;
-    sequence_ = other.sequence_;
+    sigops_ = other.sigops_;
+    addresses_ = other.addresses_;
     return *this;
 }
 
@@ -162,8 +160,8 @@ input input::factory(reader& source, bool wire, bool witness)
 
 bool input::from_data(const data_chunk& data, bool wire, bool witness)
 {
-    data_source istream(data);
-    return from_data(istream, wire, witness);
+    byte_reader source(data);
+    return from_data(source, wire, witness);
 }
 
 bool input::from_data(std::istream& stream, bool wire, bool witness)
@@ -173,14 +171,43 @@ bool input::from_data(std::istream& stream, bool wire, bool witness)
 }
 
 bool input::from_data(reader& source, bool wire, bool witness)
+{
+    return read(source, wire, witness, false);
+}
+
+bool input::recycle(reader& source, bool wire, bool witness)
+{
+    return read(source, wire, witness, true);
+}
+
+bool input::recycle_witness(reader& source)
+{
+    invalidate_cache();
+    return witness_.from_data(source, true);
+}
+
+// private
+// The script and witness are read in place, retaining their capacity.
+bool input::read(reader& source, bool wire, bool witness, bool recycle)
 {
     // Always write witness to store so that we know how to read it.
     witness |= !wire;
 
-    reset();
+    invalidate_cache();
+
+    // Metadata of a recycled previous output is stale, but its storage is kept.
+    if (previous_output_.metadata)
+        previous_output_.metadata = output_point::validation{};
+
+    // A recycled wire witness is left for the transaction to read or strip.
+    if (wire && !recycle)
+        witness_.reset();
 
     if (!previous_output_.from_data(source, wire))
+    {
+        reset();
         return false;
+    }
 
     script_.from_data(source, true);
 
@@ -202,6 +229,7 @@ void input::reset()
     script_.reset();
     witness_.reset();
     sequence_ = 0;
+    invalidate_cache();
 }
 
 // Since empty scripts and zero sequence are valid this relies on the prevout.
@@ -219,9 +247,8 @@ data_chunk input::to_data(bool wire, bool witness) const
     data_chunk data;
     const auto size = serialized_size(wire, witness);
     data.reserve(size);
-    data_sink ostream(data);
-    to_data(ostream, wire, witness);
-    ostream.flush();
+    byte_writer sink(data);
+    to_data(sink, wire, witness);
     BITCOIN_ASSERT(data.size() == size);
     return data;
 }
@@ -263,6 +290,27 @@ size_t input::serialized_size(bool wire, bool witness) const
         + sizeof(sequence_);
 }
 
+size_t input::heap_size() const
+{
+    // The previous output is owned once populated.
+    auto size = script_.heap_size() + witness_.heap_size();
+
+    const auto prevout = previous_output_.metadata.peek();
+    if (prevout != nullptr)
+        size += sizeof(output_point::validation) + prevout->cache.heap_size();
+
+    const auto cell = addresses_.peek();
+    const auto addresses = cell == nullptr ? nullptr : cell->peek();
+
+    if (cell != nullptr)
+        size += sizeof(addresses_cell);
+
+    if (addresses != nullptr)
+        size += addresses->capacity() * sizeof(wallet::payment_address);
+
+    return size;
+}
+
 // Accessors.
 //-----------------------------------------------------------------------------
 
@@ -279,11 +327,13 @@ const output_point& input::previous_output() const
 void input::set_previous_output(const output_point& value)
 {
     previous_output_ = value;
+    sigops_.reset();
 }
 
 void input::set_previous_output(output_point&& value)
 {
     previous_output_ = std::move(value);
+    sigops_.reset();
 }
 
 const chain::script& input::script() const
@@ -333,21 +383,8 @@ void input::set_sequence(uint32_t value)
 // protected
 void input::invalidate_cache() const
 {
-    ///////////////////////////////////////////////////////////////////////////
-    // Critical Section
-    mutex_.lock_upgrade();
-
-    if (addresses_)
-    {
-        mutex_.unlock_upgrade_and_lock();
-        //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-        addresses_.reset();
-        //---------------------------------------------------------------------
-        mutex_.unlock_and_lock_upgrade();
-    }
-
-    mutex_.unlock_upgrade();
-    ///////////////////////////////////////////////////////////////////////////
+    addresses_.reset();
+    sigops_.reset();
 }
 
 payment_address input::address() const
@@ -358,27 +395,11 @@ payment_address input::address() const
 
 payment_address::list input::addresses() const
 {
-    ///////////////////////////////////////////////////////////////////////////
-    // Critical Section
-    mutex_.lock_upgrade();
-
-    if (!addresses_)
+    // TODO: expand to include segregated witness address extraction.
+    return addresses_->get([this]()
     {
-        //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-        mutex_.unlock_upgrade_and_lock();
-
-        // TODO: expand to include segregated witness address extraction.
-        addresses_ = std::make_shared<payment_address::list>(
-            payment_address::extract_input(script_));
-        mutex_.unlock_and_lock_upgrade();
-        //---------------------------------------------------------------------
-    }
-
-    const auto addresses = *addresses_;
-    mutex_.unlock_upgrade();
-    ///////////////////////////////////////////////////////////////////////////
-
-    return addresses;
+        return payment_address::extract_input(script_);
+    });
 }
 
 // Utilities.
@@ -387,6 +408,7 @@ payment_address::list input::addresses() const
 void input::strip_witness()
 {
     witness_.clear();
+    sigops_.reset();
 }
 
 // Validation helpers.
@@ -410,7 +432,7 @@ bool input::is_locked(size_t block_height, uint32_t median_time_past) const
 
     // bip68: a minimum block-height constraint over the input's age.
     const auto minimum = (sequence_ & relative_locktime_mask);
-    const auto& prevout = previous_output_.metadata;
+    const auto& prevout = *previous_output_.metadata;
 
     if ((sequence_ & relative_locktime_time_locked) != 0)
     {
@@ -425,12 +447,47 @@ bool input::is_locked(size_t block_height, uint32_t median_time_past) const
     return age_blocks < minimum;
 }
 
+size_t input::signature_operations(bool bip16, bool bip141) const
+{
+    // Only the legacy (cached script) count is independent of the prevout.
+    if (!previous_output_.cached_output().is_valid())
+        return count_signature_operations(bip16, bip141);
+
+    const auto cached = sigops_.get([=]()
+    {
+        return sigop_count{ bip16, bip141,
+            count_signature_operations(bip16, bip141) };
+    });
+
+    return cached.bip16 == bip16 && cached.bip141 == bip141 ? cached.value :
+        count_signature_operations(bip16, bip141);
+}
+
+// The redeem script cache holds the embedded sigop count of a P2SH input.
+static bool find_embedded_script(redeem_script_cache::entry& out,
+    const script& input_script, const script& prevout_script)
+{
+    short_hash hash;
+    auto& cache = redeem_script_cache::redeem_scripts();
+
+    if (!cache.enabled() || !redeem_script_cache::to_key(hash, prevout_script))
+        return false;
+
+    const auto& ops = input_script.operations();
+
+    if (ops.empty() || !script::is_relaxed_push(ops))
+        return false;
+
+    return cache.find(out, hash, ops.back().data());
+}
+
+// private
 // This requires that previous outputs have been populated.
 // This cannot overflow because each total is limited by max ops.
-size_t input::signature_operations(bool bip16, bool bip141) const
+size_t input::count_signature_operations(bool bip16, bool bip141) const
 {
     chain::script witness, embedded;
-    const auto& prevout = previous_output_.metadata.cache.script();
+    const auto& prevout = previous_output_.cached_output().script();
     ////BITCOIN_ASSERT_MSG(!bip141 || bip16, "bip141 implies bip16");
 
     // Penalize quadratic signature operations (bip141).
@@ -445,6 +502,21 @@ size_t input::signature_operations(bool bip16, bool bip141) const
         return sigops + witness.sigops(true);
     }
 
+    redeem_script_cache::entry cached;
+    if (bip16 && find_embedded_script(cached, script_, prevout))
+    {
+        if (bip141 && witness_.extract_sigop_script(witness, *cached.script))
+        {
+            // Add sigops in the embedded witness (bip141).
+            return sigops + witness.sigops(true);
+        }
+        else
+        {
+            // Add heavy sigops in the embedded script (bip16).
+            return sigops + cached.sigops * sigops_factor;
+        }
+    }
+
     if (bip16 && extract_embedded_script(embedded))
     {
         if (bip141 && witness_.extract_sigop_script(witness, embedded))
@@ -467,7 +539,7 @@ bool input::extract_embedded_script(chain::script& out) const
 {
     ////BITCOIN_ASSERT(previous_output_.is_valid());
     const auto& ops = script_.operations();
-    const auto& prevout_script = previous_output_.metadata.cache.script();
+    const auto& prevout_script = previous_output_.cached_output().script();
 
     // There are no embedded sigops when the prevout script is not p2sh.
     if (!prevout_script.is_pay_to_script_hash(rule_fork::bip16_rule))
@@ -0,0 +1,227 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/chain/merkle_tree.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <bitcoin/bitcoin/chain/block.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/thread.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+// merkle_tree
+// ----------------------------------------------------------------------------
+
+hash_digest merkle_tree::root(const hash_digest& leaf,
+    const hash_list& branch, size_t index)
+{
+    auto node = leaf;
+
+    for (const auto& sibling: branch)
+    {
+        node = (index % 2 == 0) ? merkle_hash(node, sibling) :
+            merkle_hash(sibling, node);
+        index /= 2;
+    }
+
+    return node;
+}
+
+merkle_tree::merkle_tree(const hash_list& leaves)
+  : levels_{ leaves }
+{
+    populate();
+}
+
+merkle_tree::merkle_tree(hash_list&& leaves)
+  : levels_{}
+{
+    levels_.push_back(std::move(leaves));
+    populate();
+}
+
+merkle_tree::merkle_tree(const block& block, bool witness)
+  : merkle_tree(block.to_hashes(witness))
+{
+}
+
+// Each level above the leaves is its batch-hashed child level.
+void merkle_tree::populate()
+{
+    if (levels_.front().empty())
+    {
+        levels_.clear();
+        return;
+    }
+
+    while (levels_.back().size() > 1)
+    {
+        auto level = levels_.back();
+        merkle_hash_level(level);
+        levels_.push_back(std::move(level));
+    }
+}
+
+size_t merkle_tree::size() const
+{
+    return levels_.empty() ? 0 : levels_.front().size();
+}
+
+const hash_digest& merkle_tree::root() const
+{
+    return levels_.empty() ? null_hash : levels_.back().front();
+}
+
+const merkle_tree::levels& merkle_tree::all_levels() const
+{
+    return levels_;
+}
+
+hash_list merkle_tree::branch(size_t index) const
+{
+    hash_list siblings;
+
+    if (index >= size())
+        return siblings;
+
+    siblings.reserve(levels_.size() - 1);
+
+    for (size_t depth = 0; depth + 1 < levels_.size(); ++depth)
+    {
+        const auto& level = levels_[depth];
+        const auto sibling = index ^ 1;
+        siblings.push_back(sibling < level.size() ? level[sibling] :
+            level[index]);
+        index /= 2;
+    }
+
+    return siblings;
+}
+
+// coinbase_merkle
+// ----------------------------------------------------------------------------
+
+// Only the right-hand sibling of each level is retained, the first leaf (and
+// so each node of the leftmost path) is arbitrary.
+static hash_list first_branch(hash_list level)
+{
+    hash_list siblings;
+
+    while (level.size() > 1)
+    {
+        siblings.push_back(level[1]);
+        merkle_hash_level(level);
+    }
+
+    return siblings;
+}
+
+coinbase_merkle::coinbase_merkle(const hash_list& leaves)
+  : size_(leaves.size()), branch_(first_branch(leaves))
+{
+}
+
+coinbase_merkle::coinbase_merkle(const block& block, bool witness)
+  : coinbase_merkle(block.to_hashes(witness))
+{
+}
+
+size_t coinbase_merkle::size() const
+{
+    return size_;
+}
+
+const hash_list& coinbase_merkle::branch() const
+{
+    return branch_;
+}
+
+hash_digest coinbase_merkle::root(const hash_digest& coinbase_hash) const
+{
+    auto node = coinbase_hash;
+
+    for (const auto& sibling: branch_)
+        node = merkle_hash(node, sibling);
+
+    return node;
+}
+
+// merkle_tree_cache
+// ----------------------------------------------------------------------------
+
+merkle_tree_cache::merkle_tree_cache(size_t capacity)
+  : capacity_(capacity)
+{
+}
+
+merkle_tree::const_ptr merkle_tree_cache::get(const block& block,
+    bool witness)
+{
+    const key entry{ block.hash(), witness };
+
+    {
+        shared_lock lock(mutex_);
+        const auto it = trees_.find(entry);
+
+        if (it != trees_.end())
+            return it->second;
+    }
+
+    const auto tree = std::make_shared<const merkle_tree>(block, witness);
+
+    if (capacity_ == 0)
+        return tree;
+
+    unique_lock lock(mutex_);
+
+    // Another thread may have cached the same tree while it was built.
+    const auto inserted = trees_.emplace(entry, tree);
+
+    if (!inserted.second)
+        return inserted.first->second;
+
+    order_.push_back(entry);
+
+    if (order_.size() > capacity_)
+    {
+        trees_.erase(order_.front());
+        order_.pop_front();
+    }
+
+    return tree;
+}
+
+size_t merkle_tree_cache::size() const
+{
+    shared_lock lock(mutex_);
+    return trees_.size();
+}
+
+void merkle_tree_cache::clear()
+{
+    unique_lock lock(mutex_);
+    trees_.clear();
+    order_.clear();
+}
+
+} // namespace chain
+} // namespace libbitcoin
@@ -23,8 +23,9 @@
 #include <cstdint>
 #include <sstream>
 #include <bitcoin/bitcoin/constants.hpp>
-#include <bitcoin/bitcoin/utility/container_sink.hpp>
-#include <bitcoin/bitcoin/utility/container_source.hpp>
+#include <bitcoin/bitcoin/message/messages.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
 #include <bitcoin/bitcoin/utility/ostream_writer.hpp>
 #include <bitcoin/bitcoin/wallet/payment_address.hpp>
@@ -42,6 +43,64 @@ const uint32_t output::validation::unspent = max_uint32;
 const uint8_t output::validation::candidate_spent = 1;
 const uint8_t output::validation::candidate_unspent = 0;
 
+// Compact values.
+//-----------------------------------------------------------------------------
+// Trailing decimal zeros are factored out, as most values are round. Values
+// from compress_limit, beyond any money supply, are escaped to eight bytes.
+
+static const uint64_t compress_limit = uint64_t(1) << 56;
+static const uint64_t value_escape = uint64_t(1) << 60;
+
+static uint64_t compress_value(uint64_t value)
+{
+    if (value == 0)
+        return 0;
+
+    uint64_t exponent = 0;
+
+    while ((value % 10) == 0 && exponent < 9)
+    {
+        value /= 10;
+        ++exponent;
+    }
+
+    if (exponent < 9)
+    {
+        const auto digit = value % 10;
+        value /= 10;
+        return 1 + (value * 9 + digit - 1) * 10 + exponent;
+    }
+
+    return 1 + (value - 1) * 10 + 9;
+}
+
+static uint64_t decompress_value(uint64_t code)
+{
+    if (code == 0)
+        return 0;
+
+    --code;
+    auto exponent = code % 10;
+    code /= 10;
+    uint64_t value;
+
+    if (exponent < 9)
+    {
+        const auto digit = (code % 9) + 1;
+        code /= 9;
+        value = code * 10 + digit;
+    }
+    else
+    {
+        value = code + 1;
+    }
+
+    for (; exponent > 0; --exponent)
+        value *= 10;
+
+    return value;
+}
+
 // Constructors.
 //-----------------------------------------------------------------------------
 
@@ -53,17 +112,17 @@ output::output()
 }
 
 output::output(output&& other)
-  : addresses_(other.addresses_cache()),
-    value_(other.value_),
+  : value_(other.value_),
     script_(std::move(other.script_)),
+    addresses_(std::move(other.addresses_)),
     metadata(other.metadata)
 {
 }
 
 output::output(const output& other)
-  : addresses_(other.addresses_cache()),
-    value_(other.value_),
+  : value_(other.value_),
     script_(other.script_),
+    addresses_(other.addresses_),
     metadata(other.metadata)
 {
 }
@@ -82,30 +141,23 @@ output::output(uint64_t value, const chain::script& script)
 {
 }
 
-// Private cache access for copy/move construction.
-output::addresses_ptr output::addresses_cache() const
-{
-    shared_lock lock(mutex_);
-    return addresses_;
-}
-
 // Operators.
 //-----------------------------------------------------------------------------
 
 output& output::operator=(output&& other)
 {
-    addresses_ = other.addresses_cache();
     value_ = other.value_;
     script_ = std::move(other.script_);
+    addresses_ = std::move(other.addresses_);
     metadata = std::move(other.metadata);
     return *this;
 }
 
 output& output::operator=(const output& other)
 {
-    addresses_ = other.addresses_cache();
     value_ = other.value_;
     script_ = other.script_;
+    addresses_ = other.addresses_;
     metadata = other.metadata;
     return *this;
 }
@@ -146,8 +198,8 @@ output output::factory(reader& source, bool wire)
 
 bool output::from_data(const data_chunk& data, bool wire)
 {
-    data_source istream(data);
-    return from_data(istream, wire);
+    byte_reader source(data);
+    return from_data(source, wire);
 }
 
 bool output::from_data(std::istream& stream, bool wire)
@@ -156,9 +208,10 @@ bool output::from_data(std::istream& stream, bool wire)
     return from_data(source, wire);
 }
 
+// The script is read in place, so an output read again retains capacity.
 bool output::from_data(reader& source, bool wire, bool)
 {
-    reset();
+    invalidate_cache();
 
     if (!wire)
     {
@@ -170,6 +223,11 @@ bool output::from_data(reader& source, bool wire, bool)
         metadata.candidate_spend = spent;
         metadata.confirmed_spend_height = source.read_4_bytes_little_endian();
     }
+    else
+    {
+        // An output read again does not retain its spentness.
+        metadata = validation{};
+    }
 
     value_ = source.read_8_bytes_little_endian();
     script_.from_data(source, true);
@@ -180,6 +238,55 @@ bool output::from_data(reader& source, bool wire, bool)
     return source;
 }
 
+bool output::from_compact(const data_chunk& data)
+{
+    byte_reader source(data);
+    return from_compact(source);
+}
+
+bool output::from_compact(std::istream& stream)
+{
+    istream_reader source(stream);
+    return from_compact(source);
+}
+
+bool output::from_compact(reader& source)
+{
+    reset();
+    value_ = read_compact_value(source);
+    script_.from_compact(source);
+
+    if (!source)
+        reset();
+
+    return source;
+}
+
+// Only the one encoding of each value is accepted, so that the form is
+// symmetrical (this also precludes an overflowed decompression).
+uint64_t output::read_compact_value(reader& source)
+{
+    const auto code = source.read_variable_base128();
+
+    if (code == value_escape)
+    {
+        const auto value = source.read_8_bytes_little_endian();
+
+        if (value < compress_limit)
+            source.invalidate();
+
+        return value;
+    }
+
+    const auto value = decompress_value(code);
+
+    if (code > value_escape || value >= compress_limit ||
+        compress_value(value) != code)
+        source.invalidate();
+
+    return value;
+}
+
 // protected
 void output::reset()
 {
@@ -201,9 +308,8 @@ data_chunk output::to_data(bool wire) const
     data_chunk data;
     const auto size = serialized_size(wire);
     data.reserve(size);
-    data_sink ostream(data);
-    to_data(ostream, wire);
-    ostream.flush();
+    byte_writer sink(data);
+    to_data(sink, wire);
     BITCOIN_ASSERT(data.size() == size);
     return data;
 }
@@ -232,6 +338,42 @@ void output::to_data(writer& sink, bool wire, bool) const
     script_.to_data(sink, true);
 }
 
+data_chunk output::to_compact() const
+{
+    data_chunk data;
+    const auto size = compact_size();
+    data.reserve(size);
+    byte_writer sink(data);
+    to_compact(sink);
+    BITCOIN_ASSERT(data.size() == size);
+    return data;
+}
+
+void output::to_compact(std::ostream& stream) const
+{
+    ostream_writer sink(stream);
+    to_compact(sink);
+}
+
+void output::to_compact(writer& sink) const
+{
+    write_compact_value(sink, value_);
+    script_.to_compact(sink);
+}
+
+void output::write_compact_value(writer& sink, uint64_t value)
+{
+    if (value < compress_limit)
+    {
+        sink.write_variable_base128(compress_value(value));
+    }
+    else
+    {
+        sink.write_variable_base128(value_escape);
+        sink.write_8_bytes_little_endian(value);
+    }
+}
+
 // Size.
 //-----------------------------------------------------------------------------
 
@@ -241,6 +383,31 @@ size_t output::serialized_size(bool wire) const
     return metadata + sizeof(value_) + script_.serialized_size(true);
 }
 
+size_t output::heap_size() const
+{
+    auto size = script_.heap_size();
+
+    const auto cell = addresses_.peek();
+    const auto addresses = cell == nullptr ? nullptr : cell->peek();
+
+    if (cell != nullptr)
+        size += sizeof(addresses_cell);
+
+    if (addresses != nullptr)
+        size += addresses->capacity() * sizeof(wallet::payment_address);
+
+    return size;
+}
+
+size_t output::compact_size() const
+{
+    const auto value = value_ < compress_limit ?
+        message::variable_base128_size(compress_value(value_)) :
+        message::variable_base128_size(value_escape) + sizeof(value_);
+
+    return value + script_.compact_size();
+}
+
 // Accessors.
 //-----------------------------------------------------------------------------
 
@@ -274,21 +441,7 @@ void output::set_script(chain::script&& value)
 // protected
 void output::invalidate_cache() const
 {
-    ///////////////////////////////////////////////////////////////////////////
-    // Critical Section
-    mutex_.lock_upgrade();
-
-    if (addresses_)
-    {
-        mutex_.unlock_upgrade_and_lock();
-        //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-        addresses_.reset();
-        //---------------------------------------------------------------------
-        mutex_.unlock_and_lock_upgrade();
-    }
-
-    mutex_.unlock_upgrade();
-    ///////////////////////////////////////////////////////////////////////////
+    addresses_.reset();
 }
 
 payment_address output::address(uint8_t p2kh_version,
@@ -301,26 +454,11 @@ payment_address output::address(uint8_t p2kh_version,
 payment_address::list output::addresses(uint8_t p2kh_version,
     uint8_t p2sh_version) const
 {
-    ///////////////////////////////////////////////////////////////////////////
-    // Critical Section
-    mutex_.lock_upgrade();
-
-    if (!addresses_)
+    return addresses_->get([&]()
     {
-        //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-        mutex_.unlock_upgrade_and_lock();
-        addresses_ = std::make_shared<payment_address::list>(
-            payment_address::extract_output(script_, p2kh_version,
-                p2sh_version));
-        mutex_.unlock_and_lock_upgrade();
-        //---------------------------------------------------------------------
-    }
-
-    const auto addresses = *addresses_;
-    mutex_.unlock_upgrade();
-    ///////////////////////////////////////////////////////////////////////////
-
-    return addresses;
+        return payment_address::extract_output(script_, p2kh_version,
+            p2sh_version);
+    });
 }
 
 // Validation helpers.
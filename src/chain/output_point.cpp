@@ -143,15 +143,25 @@ output_point output_point::factory(reader& source, bool wire)
 // Validation.
 //-----------------------------------------------------------------------------
 
+const output& output_point::cached_output() const
+{
+    static const output missing{};
+    const auto prevout = metadata.peek();
+    return prevout == nullptr ? missing : prevout->cache;
+}
+
 // For tx pool validation height is that of the candidate block.
 bool output_point::is_mature(size_t height) const
 {
+    // Unpopulated metadata is not allocated by the query.
+    const auto prevout = metadata.peek();
+
     // Coinbase (null) inputs and those with non-coinbase prevouts are mature.
-    if (!metadata.coinbase || is_null())
+    if (prevout == nullptr || !prevout->coinbase || is_null())
         return true;
 
     // The (non-coinbase) input refers to a coinbase output, so validate depth.
-    return floor_subtract(height, metadata.height) >= coinbase_maturity;
+    return floor_subtract(height, prevout->height) >= coinbase_maturity;
 }
 
 } // namespace chain
@@ -0,0 +1,388 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/chain/payment_record_columns.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <utility>
+#include <vector>
+#include <bitcoin/bitcoin/chain/payment_record.hpp>
+#include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/message/messages.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/istream_reader.hpp>
+#include <bitcoin/bitcoin/utility/ostream_writer.hpp>
+#include "record_columns.hpp"
+
+namespace libbitcoin {
+namespace chain {
+
+// HACK: must match payment_record unlinked.
+static constexpr uint64_t unlinked = max_uint64;
+
+static BC_CONSTEXPR size_t data_width = sizeof(uint64_t);
+
+static size_t flags_size(size_t count)
+{
+    return (count + byte_bits - 1) / byte_bits;
+}
+
+// Wire records carry heights, store records carry links.
+static column to_column(const payment_record::list& records, bool wire)
+{
+    column values;
+    values.reserve(records.size());
+
+    for (const auto& record: records)
+        values.push_back(wire ? record.height() : record.link());
+
+    return values;
+}
+
+static size_t body_size(const payment_record::list& records,
+    const column& values, bool wire)
+{
+    const auto count = records.size();
+    auto size = delta_column_size(values) + (wire ? count * hash_size : 0) +
+        flags_size(count) + count * data_width;
+
+    for (const auto& record: records)
+        size += message::variable_base128_size(record.index());
+
+    return size;
+}
+
+// Constructors.
+//-----------------------------------------------------------------------------
+
+// A default instance is invalid (until modified).
+payment_record_columns::payment_record_columns()
+  : valid_(false)
+{
+}
+
+payment_record_columns::payment_record_columns(
+    payment_record_columns&& other)
+  : valid_(other.valid_), records_(std::move(other.records_))
+{
+}
+
+payment_record_columns::payment_record_columns(
+    const payment_record_columns& other)
+  : valid_(other.valid_), records_(other.records_)
+{
+}
+
+payment_record_columns::payment_record_columns(payment_record::list&& records)
+  : valid_(true), records_(std::move(records))
+{
+}
+
+payment_record_columns::payment_record_columns(
+    const payment_record::list& records)
+  : valid_(true), records_(records)
+{
+}
+
+// Operators.
+//-----------------------------------------------------------------------------
+
+payment_record_columns& payment_record_columns::operator=(
+    payment_record_columns&& other)
+{
+    valid_ = other.valid_;
+    records_ = std::move(other.records_);
+    return *this;
+}
+
+payment_record_columns& payment_record_columns::operator=(
+    const payment_record_columns& other)
+{
+    valid_ = other.valid_;
+    records_ = other.records_;
+    return *this;
+}
+
+bool payment_record_columns::operator==(
+    const payment_record_columns& other) const
+{
+    return records_ == other.records_;
+}
+
+bool payment_record_columns::operator!=(
+    const payment_record_columns& other) const
+{
+    return !(*this == other);
+}
+
+// Deserialization.
+//-----------------------------------------------------------------------------
+
+payment_record_columns payment_record_columns::factory(const data_chunk& data,
+    bool wire)
+{
+    payment_record_columns instance;
+    instance.from_data(data, wire);
+    return instance;
+}
+
+payment_record_columns payment_record_columns::factory(std::istream& stream,
+    bool wire)
+{
+    payment_record_columns instance;
+    instance.from_data(stream, wire);
+    return instance;
+}
+
+payment_record_columns payment_record_columns::factory(reader& source,
+    bool wire)
+{
+    payment_record_columns instance;
+    instance.from_data(source, wire);
+    return instance;
+}
+
+bool payment_record_columns::from_data(const data_chunk& data, bool wire)
+{
+    byte_reader source(data);
+    return from_data(source, wire);
+}
+
+bool payment_record_columns::from_data(std::istream& stream, bool wire)
+{
+    istream_reader source(stream);
+    return from_data(source, wire);
+}
+
+bool payment_record_columns::from_data(reader& source, bool wire)
+{
+    if (wire)
+        return from_data(source, 0, max_size_t);
+
+    reset();
+    size_t count;
+    size_t body;
+    uint32_t min_height;
+    uint32_t max_height;
+
+    if (!read_header(source, count, min_height, max_height, body))
+        return false;
+
+    const auto links = read_delta_column(source, count);
+    const auto outputs = source.read_bytes(flags_size(count));
+    std::vector<uint32_t> indexes;
+
+    for (size_t row = 0; row < count && source; ++row)
+        indexes.push_back(static_cast<uint32_t>(
+            source.read_variable_base128()));
+
+    if (!source)
+    {
+        reset();
+        return false;
+    }
+
+    records_.reserve(count);
+
+    for (size_t row = 0; row < count; ++row)
+    {
+        const auto output = (outputs[row / byte_bits] >> (row % byte_bits)) & 1;
+        records_.emplace_back(links[row], indexes[row],
+            source.read_8_bytes_little_endian(), output != 0);
+    }
+
+    if (!source)
+    {
+        reset();
+        return false;
+    }
+
+    valid_ = true;
+    return true;
+}
+
+// Heights are read to select rows, other fixed width columns are skipped.
+bool payment_record_columns::from_data(reader& source, size_t start_height,
+    size_t stop_height)
+{
+    reset();
+    size_t count;
+    size_t body;
+    uint32_t min_height;
+    uint32_t max_height;
+
+    if (!read_header(source, count, min_height, max_height, body))
+        return false;
+
+    // The set is outside of the range, so none of its rows are read.
+    if (max_height < start_height || min_height > stop_height)
+    {
+        source.skip(body);
+        valid_ = source;
+        return source;
+    }
+
+    const auto heights = read_delta_column(source, count);
+
+    if (!source)
+    {
+        reset();
+        return false;
+    }
+
+    std::vector<size_t> rows;
+
+    for (size_t row = 0; row < count; ++row)
+        if (heights[row] >= start_height && heights[row] <= stop_height)
+            rows.push_back(row);
+
+    const auto selected = rows.size();
+    std::vector<hash_digest> hashes(selected);
+    std::vector<uint64_t> data(selected);
+
+    read_rows(source, count, hash_size, rows, [&](size_t index)
+    {
+        hashes[index] = source.read_hash();
+    });
+
+    const auto outputs = source.read_bytes(flags_size(count));
+    std::vector<uint32_t> indexes;
+
+    for (size_t row = 0; row < count && source; ++row)
+        indexes.push_back(static_cast<uint32_t>(
+            source.read_variable_base128()));
+
+    read_rows(source, count, data_width, rows, [&](size_t index)
+    {
+        data[index] = source.read_8_bytes_little_endian();
+    });
+
+    if (!source)
+    {
+        reset();
+        return false;
+    }
+
+    records_.reserve(selected);
+
+    for (size_t index = 0; index < selected; ++index)
+    {
+        const auto row = rows[index];
+        const auto output = (outputs[row / byte_bits] >> (row % byte_bits)) & 1;
+        records_.emplace_back(unlinked, indexes[row], data[index],
+            output != 0);
+        records_.back().set_height(static_cast<size_t>(heights[row]));
+        records_.back().set_hash(std::move(hashes[index]));
+    }
+
+    valid_ = true;
+    return true;
+}
+
+// protected
+void payment_record_columns::reset()
+{
+    valid_ = false;
+    records_.clear();
+}
+
+bool payment_record_columns::is_valid() const
+{
+    return valid_;
+}
+
+// Serialization.
+//-----------------------------------------------------------------------------
+
+data_chunk payment_record_columns::to_data(bool wire) const
+{
+    data_chunk data;
+    const auto size = serialized_size(wire);
+    data.reserve(size);
+    byte_writer sink(data);
+    to_data(sink, wire);
+    BITCOIN_ASSERT(data.size() == size);
+    return data;
+}
+
+void payment_record_columns::to_data(std::ostream& stream, bool wire) const
+{
+    ostream_writer sink(stream);
+    to_data(sink, wire);
+}
+
+// Wire assumes height and point.hash population.
+void payment_record_columns::to_data(writer& sink, bool wire) const
+{
+    const auto values = to_column(records_, wire);
+    uint32_t min_height = 0;
+    uint32_t max_height = 0;
+
+    if (wire && !values.empty())
+    {
+        const auto range = std::minmax_element(values.begin(), values.end());
+        BITCOIN_ASSERT(*range.second <= max_uint32);
+        min_height = static_cast<uint32_t>(*range.first);
+        max_height = static_cast<uint32_t>(*range.second);
+    }
+
+    write_header(sink, records_.size(), min_height, max_height,
+        body_size(records_, values, wire));
+
+    write_delta_column(sink, values);
+
+    if (wire)
+        for (const auto& record: records_)
+            sink.write_hash(record.hash());
+
+    data_chunk outputs(flags_size(records_.size()), 0x00);
+
+    for (size_t row = 0; row < records_.size(); ++row)
+        if (records_[row].is_output())
+            outputs[row / byte_bits] |= uint8_t(1) << (row % byte_bits);
+
+    sink.write_bytes(outputs);
+
+    for (const auto& record: records_)
+        sink.write_variable_base128(record.index());
+
+    for (const auto& record: records_)
+        sink.write_8_bytes_little_endian(record.data());
+}
+
+// Properties (size, accessors).
+//-----------------------------------------------------------------------------
+
+size_t payment_record_columns::serialized_size(bool wire) const
+{
+    const auto body = body_size(records_, to_column(records_, wire), wire);
+    return header_size(records_.size(), body) + body;
+}
+
+const payment_record::list& payment_record_columns::records() const
+{
+    return records_;
+}
+
+} // namespace chain
+} // namespace libbitcoin
@@ -0,0 +1,120 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/chain/point_link.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/bitcoin/chain/output_point.hpp>
+#include <bitcoin/bitcoin/chain/point.hpp>
+#include <bitcoin/bitcoin/chain/transaction.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+static_assert(sizeof(point_link) == 12, "point_link must not be padded");
+
+// Constructors.
+//-----------------------------------------------------------------------------
+
+point_link::point_link()
+  : point_link(transaction::validation::unlinked, point::null_index)
+{
+}
+
+point_link::point_link(uint64_t link, uint32_t index)
+  : link_low_(static_cast<uint32_t>(link)),
+    link_high_(static_cast<uint32_t>(link >> 32)),
+    index_(index)
+{
+}
+
+// An unpopulated transaction is unlinked, and is not populated by this.
+point_link::point_link(const transaction& tx, uint32_t index)
+  : point_link(tx.metadata ? tx.metadata.peek()->link :
+        transaction::validation::unlinked, index)
+{
+}
+
+point_link::point_link(const point& point, uint64_t link)
+  : point_link(link, point.index())
+{
+}
+
+// Operators.
+//-----------------------------------------------------------------------------
+
+// Links order by their position in the store.
+bool point_link::operator<(const point_link& other) const
+{
+    const auto left = link();
+    const auto right = other.link();
+    return left == right ? index_ < other.index_ : left < right;
+}
+
+bool point_link::operator==(const point_link& other) const
+{
+    return link_low_ == other.link_low_ && link_high_ == other.link_high_ &&
+        index_ == other.index_;
+}
+
+bool point_link::operator!=(const point_link& other) const
+{
+    return !(*this == other);
+}
+
+// Properties.
+//-----------------------------------------------------------------------------
+
+uint64_t point_link::link() const
+{
+    return (static_cast<uint64_t>(link_high_) << 32) | link_low_;
+}
+
+uint32_t point_link::index() const
+{
+    return index_;
+}
+
+bool point_link::is_linked() const
+{
+    return link() != transaction::validation::unlinked;
+}
+
+output_point point_link::to_point(const hash_digest& hash) const
+{
+    return{ hash, index_ };
+}
+
+// The outputs of one transaction have sequential links and low indexes, so
+// the index is multiplied into the upper bits and the sum is finalized by
+// the murmur3 mixer, distributing both across all bits of the result.
+size_t point_link::hash() const
+{
+    auto value = link() ^ (index_ * 0x9e3779b97f4a7c15);
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccd;
+    value ^= value >> 33;
+    value *= 0xc4ceb9fe1a85ec53;
+    value ^= value >> 33;
+    return static_cast<size_t>(value);
+}
+
+} // namespace chain
+} // namespace libbitcoin
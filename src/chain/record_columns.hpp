@@ -0,0 +1,146 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHAIN_RECORD_COLUMNS_HPP
+#define LIBBITCOIN_CHAIN_RECORD_COLUMNS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/message/messages.hpp>
+#include <bitcoin/bitcoin/utility/reader.hpp>
+#include <bitcoin/bitcoin/utility/writer.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+/// Shared encoding of the record column formats. A column set starts with
+/// the row count, the height range of the rows and the byte size of the
+/// columns, so that a reader can skip a set that is out of range unread.
+typedef std::vector<uint64_t> column;
+
+// Map signed to unsigned so that deltas of small magnitude are short.
+inline uint64_t to_zigzag(uint64_t delta)
+{
+    return (delta << 1) ^ (0 - (delta >> 63));
+}
+
+inline uint64_t from_zigzag(uint64_t value)
+{
+    return (value >> 1) ^ (0 - (value & 1));
+}
+
+/// Base128 deltas from the preceding value (modulo 2^64, so any order).
+inline size_t delta_column_size(const column& values)
+{
+    size_t size = 0;
+    uint64_t prior = 0;
+
+    for (const auto value: values)
+    {
+        size += message::variable_base128_size(to_zigzag(value - prior));
+        prior = value;
+    }
+
+    return size;
+}
+
+inline void write_delta_column(writer& sink, const column& values)
+{
+    uint64_t prior = 0;
+
+    for (const auto value: values)
+    {
+        sink.write_variable_base128(to_zigzag(value - prior));
+        prior = value;
+    }
+}
+
+inline column read_delta_column(reader& source, size_t count)
+{
+    column values;
+    uint64_t prior = 0;
+
+    for (size_t row = 0; row < count && source; ++row)
+    {
+        prior += from_zigzag(source.read_variable_base128());
+        values.push_back(prior);
+    }
+
+    return values;
+}
+
+inline size_t header_size(size_t count, size_t body)
+{
+    return message::variable_base128_size(count) + 2 * sizeof(uint32_t) +
+        message::variable_base128_size(body);
+}
+
+inline void write_header(writer& sink, size_t count, uint32_t min_height,
+    uint32_t max_height, size_t body)
+{
+    sink.write_variable_base128(count);
+    sink.write_4_bytes_little_endian(min_height);
+    sink.write_4_bytes_little_endian(max_height);
+    sink.write_variable_base128(body);
+}
+
+/// False if the header cannot describe the body of a valid set.
+inline bool read_header(reader& source, size_t& count, uint32_t& min_height,
+    uint32_t& max_height, size_t& body)
+{
+    const auto rows = source.read_variable_base128();
+    min_height = source.read_4_bytes_little_endian();
+    max_height = source.read_4_bytes_little_endian();
+    const auto bytes = source.read_variable_base128();
+
+    // Each row occupies at least one byte of the body.
+    if (!source || rows > bytes || bytes > max_size_t ||
+        min_height > max_height)
+    {
+        source.invalidate();
+        return false;
+    }
+
+    count = static_cast<size_t>(rows);
+    body = static_cast<size_t>(bytes);
+    return true;
+}
+
+/// Read the fixed width column for the (ascending) rows, skipping others.
+template <typename Read>
+void read_rows(reader& source, size_t count, size_t width,
+    const std::vector<size_t>& rows, Read read)
+{
+    size_t position = 0;
+
+    for (size_t index = 0; index < rows.size(); ++index)
+    {
+        source.skip((rows[index] - position) * width);
+        read(index);
+        position = rows[index] + 1;
+    }
+
+    source.skip((count - position) * width);
+}
+
+} // namespace chain
+} // namespace libbitcoin
+
+#endif
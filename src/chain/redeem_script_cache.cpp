@@ -0,0 +1,150 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/chain/redeem_script_cache.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <bitcoin/bitcoin/chain/script.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+// Entry storage, script and shared control block (approximate).
+const size_t redeem_script_cache::entry_overhead = entries::entry_size +
+    sizeof(script) + 2 * sizeof(size_t);
+
+// static
+redeem_script_cache& redeem_script_cache::redeem_scripts()
+{
+    static redeem_script_cache cache;
+    return cache;
+}
+
+// static
+// Bip16 has matched the hash to the redeem script once the prevout succeeds.
+bool redeem_script_cache::to_key(short_hash& out,
+    const script& prevout_script)
+{
+    data_slice hash(nullptr, nullptr);
+    if (!script::is_pay_script_hash_pattern(hash, prevout_script.bytes()))
+        return false;
+
+    std::copy(hash.begin(), hash.end(), out.begin());
+    return true;
+}
+
+redeem_script_cache::redeem_script_cache(size_t maximum_bytes)
+  : hits_(0), misses_(0), entries_(maximum_bytes)
+{
+}
+
+bool redeem_script_cache::find(entry& out, const short_hash& hash,
+    data_slice bytes) const
+{
+    if (!enabled())
+        return false;
+
+    auto found = entries_.find(out, hash);
+
+    // The serialization is confirmed, as the hash is provided by the caller.
+    if (found)
+    {
+        const auto& serialized = out.script->bytes();
+        found = serialized.size() == bytes.size() &&
+            std::equal(bytes.begin(), bytes.end(), serialized.begin());
+    }
+
+    if (found)
+        ++hits_;
+    else
+        ++misses_;
+
+    return found;
+}
+
+void redeem_script_cache::insert(const short_hash& hash, script_ptr script)
+{
+    if (!enabled() || !script || entries_.contains(hash))
+        return;
+
+    // Decode and count outside of the lock, the script is retained decoded.
+    script->operations();
+    const auto sigops = script->sigops(true);
+    const auto cost = entry_overhead + script->heap_size();
+    entries_.insert(hash, { std::move(script), sigops }, cost);
+}
+
+void redeem_script_cache::resize(size_t maximum_bytes)
+{
+    entries_.resize(maximum_bytes);
+}
+
+void redeem_script_cache::clear()
+{
+    entries_.clear();
+}
+
+bool redeem_script_cache::enabled() const
+{
+    return entries_.enabled();
+}
+
+size_t redeem_script_cache::size() const
+{
+    return entries_.size();
+}
+
+size_t redeem_script_cache::bytes() const
+{
+    return entries_.cost();
+}
+
+size_t redeem_script_cache::capacity() const
+{
+    return entries_.capacity();
+}
+
+uint64_t redeem_script_cache::hits() const
+{
+    return hits_;
+}
+
+uint64_t redeem_script_cache::misses() const
+{
+    return misses_;
+}
+
+uint64_t redeem_script_cache::evictions() const
+{
+    return entries_.evictions();
+}
+
+float redeem_script_cache::hit_rate() const
+{
+    const uint64_t hits = hits_;
+    const auto total = hits + misses_;
+    return total == 0 ? 0.0f : static_cast<float>(hits) / total;
+}
+
+} // namespace chain
+} // namespace libbitcoin
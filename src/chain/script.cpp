@@ -19,6 +19,7 @@
 #include <bitcoin/bitcoin/chain/script.hpp>
 
 #include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <iterator>
@@ -28,6 +29,7 @@
 #include <utility>
 #include <boost/range/adaptor/reversed.hpp>
 #include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/chain/redeem_script_cache.hpp>
 #include <bitcoin/bitcoin/chain/transaction.hpp>
 #include <bitcoin/bitcoin/chain/witness.hpp>
 #include <bitcoin/bitcoin/error.hpp>
@@ -35,21 +37,26 @@
 #include <bitcoin/bitcoin/math/elliptic_curve.hpp>
 #include <bitcoin/bitcoin/math/hash.hpp>
 #include <bitcoin/bitcoin/machine/interpreter.hpp>
+#include <bitcoin/bitcoin/machine/number.hpp>
 #include <bitcoin/bitcoin/machine/opcode.hpp>
 #include <bitcoin/bitcoin/machine/operation.hpp>
 #include <bitcoin/bitcoin/machine/program.hpp>
 #include <bitcoin/bitcoin/machine/rule_fork.hpp>
 #include <bitcoin/bitcoin/machine/script_pattern.hpp>
+#include <bitcoin/bitcoin/machine/script_profile.hpp>
 #include <bitcoin/bitcoin/machine/script_version.hpp>
 #include <bitcoin/bitcoin/machine/sighash_algorithm.hpp>
 #include <bitcoin/bitcoin/message/messages.hpp>
 #include <bitcoin/bitcoin/utility/assert.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
 #include <bitcoin/bitcoin/utility/container_sink.hpp>
 #include <bitcoin/bitcoin/utility/container_source.hpp>
 #include <bitcoin/bitcoin/utility/data.hpp>
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
 #include <bitcoin/bitcoin/utility/ostream_writer.hpp>
 #include <bitcoin/bitcoin/utility/string.hpp>
+#include "context_writer.hpp"
+#include "sighash_precompute.hpp"
 
 namespace libbitcoin {
 namespace chain {
@@ -61,27 +68,131 @@ using namespace boost::adaptors;
 static const auto one_hash = hash_literal(
     "0000000000000000000000000000000000000000000000000000000000000001");
 
+// Compact serialization.
+//-----------------------------------------------------------------------------
+// Each standard payment template is matched byte for byte, so that it is
+// restored exactly. Codes from compact_forms are the size of a raw script.
+
+struct compact_template
+{
+    const uint8_t* prefix;
+    size_t prefix_size;
+    size_t hash_size;
+    const uint8_t* suffix;
+    size_t suffix_size;
+};
+
+static const uint8_t pay_key_hash_prefix[] =
+{
+    static_cast<uint8_t>(opcode::dup),
+    static_cast<uint8_t>(opcode::hash160),
+    static_cast<uint8_t>(opcode::push_size_20)
+};
+
+static const uint8_t pay_key_hash_suffix[] =
+{
+    static_cast<uint8_t>(opcode::equalverify),
+    static_cast<uint8_t>(opcode::checksig)
+};
+
+static const uint8_t pay_script_hash_prefix[] =
+{
+    static_cast<uint8_t>(opcode::hash160),
+    static_cast<uint8_t>(opcode::push_size_20)
+};
+
+static const uint8_t pay_script_hash_suffix[] =
+{
+    static_cast<uint8_t>(opcode::equal)
+};
+
+static const uint8_t pay_witness_key_hash_prefix[] =
+{
+    static_cast<uint8_t>(opcode::push_size_0),
+    static_cast<uint8_t>(opcode::push_size_20)
+};
+
+static const uint8_t pay_witness_script_hash_prefix[] =
+{
+    static_cast<uint8_t>(opcode::push_size_0),
+    static_cast<uint8_t>(opcode::push_size_32)
+};
+
+// The order of the templates is their code, and must not change.
+static const compact_template compact_templates[] =
+{
+    {
+        pay_key_hash_prefix, sizeof(pay_key_hash_prefix), short_hash_size,
+        pay_key_hash_suffix, sizeof(pay_key_hash_suffix)
+    },
+    {
+        pay_script_hash_prefix, sizeof(pay_script_hash_prefix),
+        short_hash_size, pay_script_hash_suffix,
+        sizeof(pay_script_hash_suffix)
+    },
+    {
+        pay_witness_key_hash_prefix, sizeof(pay_witness_key_hash_prefix),
+        short_hash_size, nullptr, 0
+    },
+    {
+        pay_witness_script_hash_prefix,
+        sizeof(pay_witness_script_hash_prefix), hash_size, nullptr, 0
+    }
+};
+
+static BC_CONSTEXPR uint64_t compact_forms = sizeof(compact_templates) /
+    sizeof(compact_template);
+
+static const compact_template* compact_form(uint64_t code)
+{
+    return code < compact_forms ? &compact_templates[code] : nullptr;
+}
+
+static uint64_t to_compact_code(data_slice& out_hash, const data_chunk& bytes)
+{
+    for (uint64_t code = 0; code < compact_forms; ++code)
+    {
+        const auto& form = compact_templates[code];
+        const auto suffix = form.prefix_size + form.hash_size;
+
+        if (bytes.size() == suffix + form.suffix_size &&
+            std::equal(form.prefix, form.prefix + form.prefix_size,
+                bytes.begin()) &&
+            std::equal(form.suffix, form.suffix + form.suffix_size,
+                bytes.begin() + suffix))
+        {
+            out_hash = data_slice(bytes.data() + form.prefix_size,
+                bytes.data() + suffix);
+            return code;
+        }
+    }
+
+    out_hash = bytes;
+    return compact_forms + bytes.size();
+}
+
 // Constructors.
 //-----------------------------------------------------------------------------
 
 // A default instance is invalid (until modified).
 script::script()
-  : cached_(false),
-    valid_(false)
+  : valid_(false)
 {
 }
 
 script::script(script&& other)
-  : operations_(std::move(other.operations_move())),
-    cached_(!operations_.empty()),
+  : operations_(std::move(other.operations_)),
+    instructions_(std::move(other.instructions_)),
+    legacy_sigops_(std::move(other.legacy_sigops_)),
     bytes_(std::move(other.bytes_)),
     valid_(other.valid_)
 {
 }
 
 script::script(const script& other)
-  : operations_(other.operations_copy()),
-    cached_(!operations_.empty()),
+  : operations_(other.operations_),
+    instructions_(other.instructions_),
+    legacy_sigops_(other.legacy_sigops_),
     bytes_(other.bytes_),
     valid_(other.valid_)
 {
@@ -107,7 +218,6 @@ script::script(data_chunk&& encoded, bool prefix)
 
     // This is an optimization that avoids streaming the encoded bytes.
     bytes_ = std::move(encoded);
-    cached_ = false;
     valid_ = true;
 }
 
@@ -116,28 +226,15 @@ script::script(const data_chunk& encoded, bool prefix)
     valid_ = from_data(encoded, prefix);
 }
 
-// Private cache access for move construction.
-script::operation::list& script::operations_move()
-{
-    shared_lock lock(mutex_);
-    return operations_;
-}
-
-// Private cache access for copy construction.
-const script::operation::list& script::operations_copy() const
-{
-    shared_lock lock(mutex_);
-    return operations_;
-}
-
 // Operators.
 //-----------------------------------------------------------------------------
 
 // Concurrent read/write is not supported, so no critical section.
 script& script::operator=(script&& other)
 {
-    operations_ = other.operations_move();
-    cached_ = !operations_.empty();
+    operations_ = std::move(other.operations_);
+    instructions_ = std::move(other.instructions_);
+    legacy_sigops_ = std::move(other.legacy_sigops_);
     bytes_ = std::move(other.bytes_);
     valid_ = other.valid_;
     return *this;
@@ -146,8 +243,9 @@ script& script::operator=(script&& other)
 // Concurrent read/write is not supported, so no critical section.
 script& script::operator=(const script& other)
 {
-    operations_ = other.operations_copy();
-    cached_ = !operations_.empty();
+    operations_ = other.operations_;
+    instructions_ = other.instructions_;
+    legacy_sigops_ = other.legacy_sigops_;
     bytes_ = other.bytes_;
     valid_ = other.valid_;
     return *this;
@@ -203,27 +301,80 @@ bool script::from_data(std::istream& stream, bool prefix)
 }
 
 // Concurrent read/write is not supported, so no critical section.
+// The bytes are read in place, so a script decoded again retains capacity.
 bool script::from_data(reader& source, bool prefix)
 {
-    reset();
     valid_ = true;
+    operations_.reset();
+    instructions_.reset();
+    legacy_sigops_.reset();
 
     if (prefix)
     {
-        const auto size = source.read_size_little_endian();
-
         // The max_script_size constant limits evaluation, but not all scripts
         // evaluate, so use max_block_size to guard memory allocation here.
-        if (size > max_block_size)
-            source.invalidate();
-        else
-            bytes_ = source.read_bytes(size);
+        const auto size = read_count(source, 1, max_block_size);
+        source.read_bytes(bytes_, size);
     }
     else
     {
         bytes_ = source.read_bytes();
     }
 
+    if (!source)
+        reset();
+    else
+        legacy_sigops_.set(sigops(bytes_, false));
+
+    return source;
+}
+
+bool script::from_compact(const data_chunk& encoded)
+{
+    data_source istream(encoded);
+    return from_compact(istream);
+}
+
+bool script::from_compact(std::istream& stream)
+{
+    istream_reader source(stream);
+    return from_compact(source);
+}
+
+// Concurrent read/write is not supported, so no critical section.
+bool script::from_compact(reader& source)
+{
+    reset();
+    valid_ = true;
+
+    const auto code = source.read_variable_base128();
+    const auto form = compact_form(code);
+
+    if (form != nullptr)
+    {
+        bytes_.reserve(form->prefix_size + form->hash_size +
+            form->suffix_size);
+        bytes_.assign(form->prefix, form->prefix + form->prefix_size);
+        extend_data(bytes_, source.read_bytes(form->hash_size));
+        bytes_.insert(bytes_.end(), form->suffix,
+            form->suffix + form->suffix_size);
+    }
+    else
+    {
+        const auto size = code - compact_forms;
+
+        // As with from_data, max_block_size guards memory allocation.
+        if (size > max_block_size)
+            source.invalidate();
+        else
+            bytes_ = source.read_bytes(static_cast<size_t>(size));
+
+        // A template script must not also be accepted in its raw form.
+        data_slice hash(bytes_);
+        if (source && to_compact_code(hash, bytes_) != code)
+            source.invalidate();
+    }
+
     if (!source)
         reset();
 
@@ -254,8 +405,10 @@ void script::from_operations(operation::list&& ops)
 {
     ////reset();
     bytes_ = operations_to_data(ops);
-    operations_ = std::move(ops);
-    cached_ = true;
+    operations_.reset();
+    instructions_.reset();
+    legacy_sigops_.reset();
+    operations_.set(std::move(ops));
     valid_ = true;
 }
 
@@ -264,8 +417,10 @@ void script::from_operations(const operation::list& ops)
 {
     ////reset();
     bytes_ = operations_to_data(ops);
-    operations_ = ops;
-    cached_ = true;
+    operations_.reset();
+    instructions_.reset();
+    legacy_sigops_.reset();
+    operations_.set(ops);
     valid_ = true;
 }
 
@@ -304,9 +459,9 @@ void script::reset()
     bytes_.clear();
     bytes_.shrink_to_fit();
     valid_ = false;
-    cached_ = false;
-    operations_.clear();
-    operations_.shrink_to_fit();
+    operations_.reset();
+    instructions_.reset();
+    legacy_sigops_.reset();
 }
 
 bool script::is_valid() const
@@ -320,7 +475,8 @@ bool script::is_valid_operations() const
 {
     // Script validity is independent of individual operation validity.
     // There is a trailing invalid/default op if a push op had a size mismatch.
-    return operations().empty() || operations_.back().is_valid();
+    const auto& ops = instructions();
+    return ops.empty() || ops.back().is_valid();
 }
 
 // Serialization.
@@ -331,9 +487,8 @@ data_chunk script::to_data(bool prefix) const
     data_chunk data;
     const auto size = serialized_size(prefix);
     data.reserve(size);
-    data_sink ostream(data);
-    to_data(ostream, prefix);
-    ostream.flush();
+    byte_writer sink(data);
+    to_data(sink, prefix);
     BITCOIN_ASSERT(data.size() == size);
     return data;
 }
@@ -353,6 +508,31 @@ void script::to_data(writer& sink, bool prefix) const
     sink.write_bytes(bytes_);
 }
 
+data_chunk script::to_compact() const
+{
+    data_chunk data;
+    const auto size = compact_size();
+    data.reserve(size);
+    byte_writer sink(data);
+    to_compact(sink);
+    BITCOIN_ASSERT(data.size() == size);
+    return data;
+}
+
+void script::to_compact(std::ostream& stream) const
+{
+    ostream_writer sink(stream);
+    to_compact(sink);
+}
+
+void script::to_compact(writer& sink) const
+{
+    data_slice hash(bytes_);
+    const auto code = to_compact_code(hash, bytes_);
+    sink.write_variable_base128(code);
+    sink.write_bytes(hash);
+}
+
 std::string script::to_string(uint32_t active_forks) const
 {
     auto first = true;
@@ -380,12 +560,12 @@ void script::clear()
 
 bool script::empty() const
 {
-    return operations().empty();
+    return instructions().empty();
 }
 
 size_t script::size() const
 {
-    return operations().size();
+    return instructions().size();
 }
 
 const operation& script::front() const
@@ -429,54 +609,81 @@ size_t script::serialized_size(bool prefix) const
     return size;
 }
 
-// protected
-const operation::list& script::operations() const
+size_t script::heap_size() const
 {
-    ///////////////////////////////////////////////////////////////////////////
-    // Critical Section
-    mutex_.lock_upgrade();
+    auto size = bytes_.capacity();
 
-    if (cached_)
+    // Decoded caches are counted only if populated.
+    const auto ops = operations_.peek();
+    if (ops != nullptr)
     {
-        mutex_.unlock_upgrade();
-        //---------------------------------------------------------------------
-        return operations_;
+        size += ops->capacity() * sizeof(operation);
+
+        for (const auto& op: *ops)
+            size += op.data().capacity();
     }
 
-    operation op;
-    data_source istream(bytes_);
-    istream_reader source(istream);
-    const auto size = bytes_.size();
-
-    //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-    mutex_.unlock_upgrade_and_lock();
-
-    // One operation per byte is the upper limit of operations.
-    operations_.reserve(size);
-
-    // ************************************************************************
-    // CONSENSUS: In the case of a coinbase script we must parse the entire
-    // script, beyond just the BIP34 requirements, so that sigops can be
-    // calculated from the script. These are counted despite being irrelevant.
-    // In this case an invalid script is parsed to the extent possible.
-    // ************************************************************************
-
-    // If an op fails it is pushed to operations and the loop terminates.
-    // To validate the ops the caller must test the last op.is_valid(), or may
-    // text script.is_valid_operations(), which is done in script metadata.
-    while (!source.is_exhausted())
+    const auto instructions = instructions_.peek();
+    if (instructions != nullptr)
+        size += instructions->capacity() * sizeof(instruction);
+
+    return size;
+}
+
+size_t script::compact_size() const
+{
+    data_slice hash(bytes_);
+    const auto code = to_compact_code(hash, bytes_);
+    return message::variable_base128_size(code) + hash.size();
+}
+
+// protected
+const operation::list& script::operations() const
+{
+    return operations_.get([this]()
     {
-        op.from_data(source);
-        operations_.push_back(std::move(op));
-    }
+        operation op;
+        operation::list ops;
+        data_source istream(bytes_);
+        istream_reader source(istream);
+
+        // One operation per byte is the upper limit of operations.
+        ops.reserve(bytes_.size());
+
+        // ********************************************************************
+        // CONSENSUS: In the case of a coinbase script we must parse the entire
+        // script, beyond just the BIP34 requirements, so that sigops can be
+        // calculated from the script. These are counted despite being
+        // irrelevant. In this case an invalid script is parsed to the extent
+        // possible.
+        // ********************************************************************
+
+        // If an op fails it is pushed to operations and the loop terminates.
+        // To validate the ops the caller must test the last op.is_valid(), or
+        // may text script.is_valid_operations(), which is done in metadata.
+        while (!source.is_exhausted())
+        {
+            op.from_data(source);
+            ops.push_back(std::move(op));
+        }
 
-    operations_.shrink_to_fit();
-    cached_ = true;
+        ops.shrink_to_fit();
+        return ops;
+    });
+}
 
-    mutex_.unlock();
-    ///////////////////////////////////////////////////////////////////////////
+const instruction::list& script::instructions() const
+{
+    return instructions_.get([this]()
+    {
+        // This parses as operations() does, but without copying push data.
+        return instruction::decode(bytes_);
+    });
+}
 
-    return operations_;
+const data_chunk& script::bytes() const
+{
+    return bytes_;
 }
 
 // Signing (unversioned).
@@ -487,9 +694,10 @@ inline hash_digest signature_hash(const transaction& tx, uint32_t sighash_type)
     // There is no rational interpretation of a signature hash for a coinbase.
     BITCOIN_ASSERT(!tx.is_coinbase());
 
-    auto serialized = tx.to_data(true, false);
-    extend_data(serialized, to_little_endian(sighash_type));
-    return bitcoin_hash(serialized);
+    context_writer sink;
+    tx.to_data(sink, true, false);
+    sink.write_4_bytes_little_endian(sighash_type);
+    return sink.bitcoin_digest();
 }
 
 //*****************************************************************************
@@ -586,38 +794,104 @@ static hash_digest sign_single(const transaction& tx, uint32_t input_index,
         std::move(outs) }, sighash_type);
 }
 
-static hash_digest sign_all(const transaction& tx, uint32_t input_index,
-    const script& script_code, uint8_t sighash_type)
+// The sighash_all preimage of input i (without anyone_can_pay) is:
+// [version][count][blank 0..i-1][self i][blank i+1..n-1][suffix][type]
+// Blanks are of fixed size, so a midstate is cached for each prefix and the
+// self segment and remaining blanks are hashed from the cached serialization.
+
+// Outpoint, empty script size and sequence.
+const size_t sighash_precompute::blank_input_size =
+    point::satoshi_fixed_size() + sizeof(uint8_t) + sizeof(uint32_t);
+
+sighash_precompute::sighash_precompute(const transaction& tx)
 {
-    input::list ins;
     const auto& inputs = tx.inputs();
-    const auto any = (sighash_type & sighash_algorithm::anyone_can_pay) != 0;
-    ins.reserve(any ? 1 : inputs.size());
+    const auto& outputs = tx.outputs();
 
-    BITCOIN_ASSERT(input_index < inputs.size());
-    const auto& self = inputs[input_index];
+    blanks.reserve(inputs.size() * blank_input_size);
+    data_sink blank_stream(blanks);
+    ostream_writer blank_sink(blank_stream);
 
-    if (any)
+    for (const auto& input: inputs)
     {
-        // Retain only self.
-        ins.emplace_back(self.previous_output(), script_code, self.sequence());
+        input.previous_output().to_data(blank_sink);
+        script{}.to_data(blank_sink, true);
+        blank_sink.write_4_bytes_little_endian(input.sequence());
     }
-    else
+
+    blank_stream.flush();
+    BITCOIN_ASSERT(blanks.size() == inputs.size() * blank_input_size);
+
+    const auto sum = [&](size_t total, const output& output)
     {
-        // Erase all input scripts.
-        for (const auto& input: inputs)
-            ins.emplace_back(input.previous_output(), script{},
-                input.sequence());
+        return total + output.serialized_size();
+    };
 
-        // Replace self that is lost in the loop.
-        ins[input_index].set_script(script_code);
-        ////ins[input_index].set_sequence(self.sequence());
+    suffix.reserve(message::variable_uint_size(outputs.size()) +
+        std::accumulate(outputs.begin(), outputs.end(), size_t(0), sum) +
+        sizeof(uint32_t));
+    data_sink suffix_stream(suffix);
+    ostream_writer suffix_sink(suffix_stream);
+    suffix_sink.write_variable_little_endian(outputs.size());
+
+    for (const auto& output: outputs)
+        output.to_data(suffix_sink);
+
+    suffix_sink.write_4_bytes_little_endian(tx.locktime());
+    suffix_stream.flush();
+
+    const auto version = to_little_endian(tx.version());
+    static const uint8_t single_count = 1;
+    const auto counts = [&]()
+    {
+        data_chunk data;
+        data_sink stream(data);
+        ostream_writer sink(stream);
+        sink.write_variable_little_endian(inputs.size());
+        stream.flush();
+        return data;
+    }();
+
+    SHA256CTX context;
+    SHA256Init(&context);
+    SHA256Update(&context, version.data(), version.size());
+
+    single = context;
+    SHA256Update(&single, &single_count, sizeof(single_count));
+    SHA256Update(&context, counts.data(), counts.size());
+
+    prefixes.reserve(inputs.size());
+    for (size_t index = 0; index < inputs.size(); ++index)
+    {
+        prefixes.push_back(context);
+        SHA256Update(&context, &blanks[index * blank_input_size],
+            blank_input_size);
     }
+}
+
+hash_digest sighash_precompute::sign_all(uint32_t input_index,
+    const script& script_code, uint8_t sighash_type) const
+{
+    BITCOIN_ASSERT(input_index < prefixes.size());
+    const auto any = (sighash_type & sighash_algorithm::anyone_can_pay) != 0;
+    const auto outpoint_size = point::satoshi_fixed_size();
+    const auto self = blanks.data() + input_index * blank_input_size;
+    const auto next = self + blank_input_size;
+    const auto end = blanks.data() + blanks.size();
+
+    // Retain only self (anyone_can_pay) or all inputs with self scripted.
+    context_writer sink(any ? single : prefixes[input_index]);
+    sink.write_bytes(self, outpoint_size);
+    script_code.to_data(sink, true);
+    sink.write_bytes(self + outpoint_size + sizeof(uint8_t),
+        sizeof(uint32_t));
+
+    if (!any)
+        sink.write_bytes(next, std::distance(next, end));
 
-    // Move new inputs and copy outputs to new transaction.
-    transaction out(tx.version(), tx.locktime(), input::list{}, tx.outputs());
-    out.set_inputs(std::move(ins));
-    return signature_hash(out, sighash_type);
+    sink.write_bytes(suffix);
+    sink.write_4_bytes_little_endian(sighash_type);
+    return sink.bitcoin_digest();
 }
 
 static script strip_code_seperators(const script& script_code)
@@ -660,7 +934,8 @@ hash_digest script::generate_unversioned_signature_hash(const transaction& tx,
             return sign_single(tx, input_index, stripped, sighash_type);
         default:
         case sighash_algorithm::all:
-            return sign_all(tx, input_index, stripped, sighash_type);
+            return tx.sighash_precomputation()->sign_all(input_index,
+                stripped, sighash_type);
     }
 }
 
@@ -669,91 +944,39 @@ hash_digest script::generate_unversioned_signature_hash(const transaction& tx,
 
 hash_digest script::to_outputs(const transaction& tx)
 {
-    const auto sum = [&](size_t total, const output& output)
-    {
-        return total + output.serialized_size();
-    };
+    context_writer sink;
 
-    const auto& outs = tx.outputs();
-    auto size = std::accumulate(outs.begin(), outs.end(), size_t(0), sum);
-    data_chunk data;
-    data.reserve(size);
-    data_sink ostream(data);
-    ostream_writer sink(ostream);
-
-    const auto write = [&](const output& output)
-    {
+    for (const auto& output: tx.outputs())
         output.to_data(sink, true);
-    };
 
-    std::for_each(outs.begin(), outs.end(), write);
-    ostream.flush();
-    BITCOIN_ASSERT(data.size() == size);
-    return bitcoin_hash(data);
+    return sink.bitcoin_digest();
 }
 
 hash_digest script::to_inpoints(const transaction& tx)
 {
-    const auto sum = [&](size_t total, const input& input)
-    {
-        return total + input.previous_output().serialized_size();
-    };
-
-    const auto& ins = tx.inputs();
-    auto size = std::accumulate(ins.begin(), ins.end(), size_t(0), sum);
-    data_chunk data;
-    data.reserve(size);
-    data_sink ostream(data);
-    ostream_writer sink(ostream);
+    context_writer sink;
 
-    const auto write = [&](const input& input)
-    {
+    for (const auto& input: tx.inputs())
         input.previous_output().to_data(sink);
-    };
 
-    std::for_each(ins.begin(), ins.end(), write);
-    ostream.flush();
-    BITCOIN_ASSERT(data.size() == size);
-    return bitcoin_hash(data);
+    return sink.bitcoin_digest();
 }
 
 hash_digest script::to_sequences(const transaction& tx)
 {
-    const auto sum = [&](size_t total, const input& /* input */)
-    {
-        return total + sizeof(uint32_t);
-    };
+    context_writer sink;
 
-    const auto& ins = tx.inputs();
-    auto size = std::accumulate(ins.begin(), ins.end(), size_t(0), sum);
-    data_chunk data;
-    data.reserve(size);
-    data_sink ostream(data);
-    ostream_writer sink(ostream);
-
-    const auto write = [&](const input& input)
-    {
+    for (const auto& input: tx.inputs())
         sink.write_4_bytes_little_endian(input.sequence());
-    };
 
-    std::for_each(ins.begin(), ins.end(), write);
-    ostream.flush();
-    BITCOIN_ASSERT(data.size() == size);
-    return bitcoin_hash(data);
+    return sink.bitcoin_digest();
 }
 
-static size_t preimage_size(size_t script_size)
+static hash_digest to_output(const output& output)
 {
-    return sizeof(uint32_t)
-        + hash_size
-        + hash_size
-        + point::satoshi_fixed_size()
-        + script_size
-        + sizeof(uint64_t)
-        + sizeof(uint32_t)
-        + hash_size
-        + sizeof(uint32_t)
-        + sizeof(uint32_t);
+    context_writer sink;
+    output.to_data(sink, true);
+    return sink.bitcoin_digest();
 }
 
 // private/static
@@ -764,12 +987,7 @@ hash_digest script::generate_version_0_signature_hash(const transaction& tx,
     // Unlike unversioned algorithm this does not allow an invalid input index.
     BITCOIN_ASSERT(input_index < tx.inputs().size());
     const auto& input = tx.inputs()[input_index];
-    const auto size = preimage_size(script_code.serialized_size(true));
-
-    data_chunk data;
-    data.reserve(size);
-    data_sink ostream(data);
-    ostream_writer sink(ostream);
+    context_writer sink;
 
     // Flags derived from the signature hash byte.
     const auto sighash = to_sighash_enum(sighash_type);
@@ -803,17 +1021,14 @@ hash_digest script::generate_version_0_signature_hash(const transaction& tx,
     // 8. outputs hash (32-byte hash).
     sink.write_hash(all ? tx.outputs_hash() :
         (single && input_index < tx.outputs().size() ?
-            bitcoin_hash(tx.outputs()[input_index].to_data()) : null_hash));
+            to_output(tx.outputs()[input_index]) : null_hash));
 
     // 9. transaction locktime (4-byte little endian).
     sink.write_little_endian(tx.locktime());
 
     // 10. sighash type of the signature (4-byte [not 1] little endian).
     sink.write_4_bytes_little_endian(sighash_type);
-
-    ostream.flush();
-    BITCOIN_ASSERT(data.size() == size);
-    return bitcoin_hash(data);
+    return sink.bitcoin_digest();
 }
 
 // Signing (common).
@@ -840,11 +1055,20 @@ hash_digest script::generate_signature_hash(const transaction& tx,
     }
 }
 
+// The signature metrics of the thread, if attached.
+static thread_local script_profile::operation_metrics* signature_metrics =
+    nullptr;
+
 // static
-bool script::check_signature(const ec_signature& signature,
-    uint8_t sighash_type, const data_chunk& public_key,
+void script::record_signatures(script_profile::operation_metrics* metrics)
+{
+    signature_metrics = metrics;
+}
+
+inline bool check_signature_unmeasured(const ec_signature& signature,
+    uint8_t sighash_type, data_slice public_key,
     const script& script_code, const transaction& tx, uint32_t input_index,
-    script_version version, uint64_t value)
+    script::script_version version, uint64_t value)
 {
     if (public_key.empty())
         return false;
@@ -853,8 +1077,45 @@ bool script::check_signature(const ec_signature& signature,
     const auto sighash = chain::script::generate_signature_hash(tx,
         input_index, script_code, sighash_type, version, value);
 
+    // Only successes are cached, a failure invalidates the transaction.
+    auto& cache = script::verified_signatures();
+    if (cache.contains(sighash, public_key, signature))
+        return true;
+
     // Validate the EC signature.
-    return verify_signature(public_key, sighash, signature);
+    if (!verify_signature(public_key, sighash, signature))
+        return false;
+
+    cache.insert(sighash, public_key, signature);
+    return true;
+}
+
+// static
+bool script::check_signature(const ec_signature& signature,
+    uint8_t sighash_type, data_slice public_key,
+    const script& script_code, const transaction& tx, uint32_t input_index,
+    script_version version, uint64_t value)
+{
+    const auto metrics = signature_metrics;
+    if (metrics == nullptr)
+        return check_signature_unmeasured(signature, sighash_type, public_key,
+            script_code, tx, input_index, version, value);
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto valid = check_signature_unmeasured(signature, sighash_type,
+        public_key, script_code, tx, input_index, version, value);
+
+    ++metrics->count;
+    metrics->elapsed += std::chrono::duration_cast<script_profile::duration>(
+        std::chrono::steady_clock::now() - start);
+    return valid;
+}
+
+// static
+signature_cache& script::verified_signatures()
+{
+    static signature_cache cache;
+    return cache;
 }
 
 // static
@@ -905,6 +1166,16 @@ bool script::is_relaxed_push(const operation::list& ops)
     return std::all_of(ops.begin(), ops.end(), push);
 }
 
+bool script::is_relaxed_push(const instruction::list& ops)
+{
+    const auto push = [&](const instruction& op)
+    {
+        return op.is_relaxed_push();
+    };
+
+    return std::all_of(ops.begin(), ops.end(), push);
+}
+
 //*****************************************************************************
 // CONSENSUS: BIP34 requires coinbase input script to begin with one byte that
 // indicates the height size. This is inconsistent with an extreme future where
@@ -943,6 +1214,14 @@ bool script::is_witness_program_pattern(const operation::list& ops)
         && ops[1].data().size() <= max_witness_program;
 }
 
+bool script::is_witness_program_pattern(const instruction::list& ops)
+{
+    return ops.size() == 2
+        && ops[0].is_version()
+        && ops[1].size() >= min_witness_program
+        && ops[1].size() <= max_witness_program;
+}
+
 // The satoshi client tests for 83 bytes total. This allows for the waste of
 // one byte to represent up to 75 bytes using the push_one_size opcode.
 // It also allows any number of push ops and limits it to 0 value and 1 per tx.
@@ -998,6 +1277,36 @@ bool script::is_pay_multisig_pattern(const operation::list& ops)
     return true;
 }
 
+bool script::is_pay_multisig_pattern(const instruction::list& ops,
+    const data_chunk& bytes)
+{
+    static constexpr auto op_1 = static_cast<uint8_t>(opcode::push_positive_1);
+    static constexpr auto op_16 = static_cast<uint8_t>(opcode::push_positive_16);
+
+    const auto op_count = ops.size();
+
+    if (op_count < 4 || ops[op_count - 1].code() != opcode::checkmultisig)
+        return false;
+
+    const auto op_m = static_cast<uint8_t>(ops[0].code());
+    const auto op_n = static_cast<uint8_t>(ops[op_count - 2].code());
+
+    if (op_m < op_1 || op_m > op_n || op_n < op_1 || op_n > op_16)
+        return false;
+
+    const auto number = op_n - op_1 + 1u;
+    const auto points = op_count - 3u;
+
+    if (number != points)
+        return false;
+
+    for (auto op = ops.begin() + 1; op != ops.end() - 2; ++op)
+        if (!is_public_key(op->data(bytes)))
+            return false;
+
+    return true;
+}
+
 // The satoshi client considers this non-standard for policy.
 bool script::is_pay_public_key_pattern(const operation::list& ops)
 {
@@ -1016,6 +1325,16 @@ bool script::is_pay_key_hash_pattern(const operation::list& ops)
         && ops[4].code() == opcode::checksig;
 }
 
+bool script::is_pay_key_hash_pattern(const instruction::list& ops)
+{
+    return ops.size() == 5
+        && ops[0].code() == opcode::dup
+        && ops[1].code() == opcode::hash160
+        && ops[2].size() == short_hash_size
+        && ops[3].code() == opcode::equalverify
+        && ops[4].code() == opcode::checksig;
+}
+
 //*****************************************************************************
 // CONSENSUS: this pattern is used to activate bip16 validation rules.
 //*****************************************************************************
@@ -1027,6 +1346,14 @@ bool script::is_pay_script_hash_pattern(const operation::list& ops)
         && ops[2].code() == opcode::equal;
 }
 
+bool script::is_pay_script_hash_pattern(const instruction::list& ops)
+{
+    return ops.size() == 3
+        && ops[0].code() == opcode::hash160
+        && ops[1].code() == opcode::push_size_20
+        && ops[2].code() == opcode::equal;
+}
+
 //*****************************************************************************
 // CONSENSUS: this pattern is used to activate bip141 validation rules.
 //*****************************************************************************
@@ -1037,6 +1364,160 @@ bool script::is_pay_witness_script_hash_pattern(const operation::list& ops)
         && ops[1].code() == opcode::push_size_32;
 }
 
+// Serialized patterns.
+//-----------------------------------------------------------------------------
+// These match the operation patterns above, including non-minimal pushes
+// where the operation pattern only tests the size of the pushed data.
+
+// Read the push operation at offset, referencing its data in bytes.
+static bool read_push(opcode& out_code, data_slice& out_data,
+    const data_slice& bytes, size_t& offset)
+{
+    if (offset >= bytes.size())
+        return false;
+
+    const auto data = bytes.data();
+    const auto end = bytes.size();
+    const auto code = static_cast<opcode>(data[offset++]);
+    size_t size;
+
+    switch (code)
+    {
+        case opcode::push_one_size:
+            if (end - offset < 1)
+                return false;
+
+            size = data[offset];
+            offset += 1;
+            break;
+
+        case opcode::push_two_size:
+            if (end - offset < 2)
+                return false;
+
+            size = from_little_endian_unsafe<uint16_t>(data + offset);
+            offset += 2;
+            break;
+
+        case opcode::push_four_size:
+            if (end - offset < 4)
+                return false;
+
+            size = from_little_endian_unsafe<uint32_t>(data + offset);
+            offset += 4;
+            break;
+
+        default:
+            if (code > opcode::push_size_75)
+                return false;
+
+            size = static_cast<uint8_t>(code);
+            break;
+    }
+
+    if (end - offset < size)
+        return false;
+
+    out_code = code;
+    out_data = data_slice(data + offset, data + offset + size);
+    offset += size;
+    return true;
+}
+
+// Read a push of exactly size bytes at offset, in any push encoding.
+inline bool read_push(data_slice& out_data, const data_slice& bytes,
+    size_t& offset, size_t size)
+{
+    opcode code;
+    return read_push(code, out_data, bytes, offset)
+        && out_data.size() == size;
+}
+
+inline bool is_code(const data_slice& bytes, size_t offset, opcode code)
+{
+    return offset < bytes.size() &&
+        bytes.data()[offset] == static_cast<uint8_t>(code);
+}
+
+bool script::is_pay_null_data_pattern(data_slice bytes)
+{
+    opcode code;
+    size_t offset = 1;
+    data_slice data(bytes);
+
+    if (!is_code(bytes, 0, opcode::return_) ||
+        !read_push(code, data, bytes, offset) || offset != bytes.size() ||
+        data.size() > max_null_data_size)
+        return false;
+
+    // Minimal encoding uses a numeric opcode for these single byte values.
+    if (data.size() == 1 && (data.data()[0] == number::negative_1 ||
+        data.data()[0] <= number::positive_16))
+        return false;
+
+    return code == operation::opcode_from_size(data.size());
+}
+
+bool script::is_pay_public_key_pattern(data_slice& out_key, data_slice bytes)
+{
+    opcode code;
+    size_t offset = 0;
+    data_slice key(bytes);
+
+    if (!read_push(code, key, bytes, offset) || !is_public_key(key) ||
+        !is_code(bytes, offset, opcode::checksig) || offset + 1 != bytes.size())
+        return false;
+
+    out_key = key;
+    return true;
+}
+
+bool script::is_pay_key_hash_pattern(data_slice& out_hash, data_slice bytes)
+{
+    size_t offset = 2;
+    data_slice hash(bytes);
+
+    // The fixed prefix fails fast for the common case of other patterns.
+    if (!is_code(bytes, 0, opcode::dup) || !is_code(bytes, 1, opcode::hash160) ||
+        !read_push(hash, bytes, offset, short_hash_size) ||
+        !is_code(bytes, offset, opcode::equalverify) ||
+        !is_code(bytes, offset + 1, opcode::checksig) ||
+        offset + 2 != bytes.size())
+        return false;
+
+    out_hash = hash;
+    return true;
+}
+
+bool script::is_pay_script_hash_pattern(data_slice& out_hash,
+    data_slice bytes)
+{
+    static BC_CONSTEXPR size_t size = 1 + 1 + short_hash_size + 1;
+
+    // The bip16 pattern requires push_size_20, so the script size is fixed.
+    if (bytes.size() != size || !is_code(bytes, 0, opcode::hash160) ||
+        !is_code(bytes, 1, opcode::push_size_20) ||
+        !is_code(bytes, size - 1, opcode::equal))
+        return false;
+
+    out_hash = data_slice(bytes.data() + 2, bytes.data() + size - 1);
+    return true;
+}
+
+bool script::is_pay_witness_script_hash_pattern(data_slice& out_hash,
+    data_slice bytes)
+{
+    static BC_CONSTEXPR size_t size = 1 + 1 + hash_size;
+
+    // The bip141 pattern requires push_size_32, so the script size is fixed.
+    if (bytes.size() != size || !is_code(bytes, 0, opcode::push_size_0) ||
+        !is_code(bytes, 1, opcode::push_size_32))
+        return false;
+
+    out_hash = data_slice(bytes.data() + 2, bytes.data() + size);
+    return true;
+}
+
 // The first push is based on wacky satoshi op_check_multisig behavior that
 // we must perpetuate, though it's appearance here is policy not consensus.
 // Limiting to push_size_0 eliminates pattern ambiguity with little downside.
@@ -1177,15 +1658,16 @@ operation::list script::to_pay_multisig_pattern(uint8_t signatures,
 
 data_chunk script::witness_program() const
 {
-    // The first operations access must be method-based to guarantee the cache.
-    const auto& ops = operations();
-    return is_witness_program_pattern(ops) ? ops[1].data() : data_chunk{};
+    // The first instructions access must be method-based to guarantee cache.
+    const auto& ops = instructions();
+    return is_witness_program_pattern(ops) ? to_chunk(ops[1].data(bytes_)) :
+        data_chunk{};
 }
 
 script_version script::version() const
 {
-    // The first operations access must be method-based to guarantee the cache.
-    const auto& ops = operations();
+    // The first instructions access must be method-based to guarantee cache.
+    const auto& ops = instructions();
 
     if (!is_witness_program_pattern(ops))
         return script_version::unversioned;
@@ -1205,22 +1687,25 @@ script_pattern script::pattern() const
 
 // Output patterns are mutually and input unambiguous.
 // The bip141 coinbase pattern is not tested here, must test independently.
+// Patterns are matched on the script bytes, so operations are not decoded.
 script_pattern script::output_pattern() const
 {
-    // The first operations access must be method-based to guarantee the cache.
-    if (is_pay_key_hash_pattern(operations()))
+    // The referenced hash or key is not used here.
+    data_slice data(bytes_);
+
+    if (is_pay_key_hash_pattern(data, bytes_))
         return script_pattern::pay_key_hash;
 
-    if (is_pay_script_hash_pattern(operations_))
+    if (is_pay_script_hash_pattern(data, bytes_))
         return script_pattern::pay_script_hash;
 
-    if (is_pay_null_data_pattern(operations_))
+    if (is_pay_null_data_pattern(bytes_))
         return script_pattern::pay_null_data;
 
-    if (is_pay_public_key_pattern(operations_))
+    if (is_pay_public_key_pattern(data, bytes_))
         return script_pattern::pay_public_key;
 
-    if (is_pay_multisig_pattern(operations_))
+    if (is_pay_multisig_pattern(instructions(), bytes_))
         return script_pattern::pay_multisig;
 
     return script_pattern::non_standard;
@@ -1230,18 +1715,19 @@ script_pattern script::output_pattern() const
 // The bip34 coinbase pattern is not tested here, must test independently.
 script_pattern script::input_pattern() const
 {
-    // The first operations access must be method-based to guarantee the cache.
-    if (is_sign_key_hash_pattern(operations()))
+    const auto& ops = operations();
+
+    if (is_sign_key_hash_pattern(ops))
         return script_pattern::sign_key_hash;
 
     // This must follow is_sign_key_hash_pattern for ambiguity comment to hold.
-    if (is_sign_script_hash_pattern(operations_))
+    if (is_sign_script_hash_pattern(ops))
         return script_pattern::sign_script_hash;
 
-    if (is_sign_public_key_pattern(operations_))
+    if (is_sign_public_key_pattern(ops))
         return script_pattern::sign_public_key;
 
-    if (is_sign_multisig_pattern(operations_))
+    if (is_sign_multisig_pattern(ops))
         return script_pattern::sign_multisig;
 
     return script_pattern::non_standard;
@@ -1250,17 +1736,17 @@ script_pattern script::input_pattern() const
 bool script::is_pay_to_witness(uint32_t forks) const
 {
     // This is used internally as an optimization over using script::pattern.
-    // The first operations access must be method-based to guarantee the cache.
+    // The first instructions access must be method-based to guarantee cache.
     return is_enabled(forks, rule_fork::bip141_rule) &&
-        is_witness_program_pattern(operations());
+        is_witness_program_pattern(instructions());
 }
 
 bool script::is_pay_to_script_hash(uint32_t forks) const
 {
     // This is used internally as an optimization over using script::pattern.
-    // The first operations access must be method-based to guarantee the cache.
+    // The first instructions access must be method-based to guarantee cache.
     return is_enabled(forks, rule_fork::bip16_rule) &&
-        is_pay_script_hash_pattern(operations());
+        is_pay_script_hash_pattern(instructions());
 }
 
 // Count 1..16 multisig accurately for embedded (bip16) and witness (bip141).
@@ -1270,15 +1756,27 @@ inline size_t multisig_sigops(bool accurate, opcode code)
         operation::opcode_to_positive(code) : multisig_default_sigops;
 }
 
-size_t script::sigops(bool accurate) const
+// static
+size_t script::sigops(data_slice bytes, bool accurate)
 {
+    data_slice hash(bytes);
+
+    // The common output patterns are counted without decoding.
+    if (is_pay_key_hash_pattern(hash, bytes))
+        return 1;
+
+    if (is_pay_script_hash_pattern(hash, bytes) ||
+        is_pay_witness_script_hash_pattern(hash, bytes))
+        return 0;
+
     size_t total = 0;
+    size_t position = 0;
     auto preceding = opcode::push_negative_1;
 
-    // The first operations access must be method-based to guarantee the cache.
-    for (const auto& op: operations())
+    // A failed op ends the count, as it ends operation decoding.
+    while (position < bytes.size())
     {
-        const auto code = op.code();
+        const auto code = instruction::decode(bytes, position).code();
 
         if (code == opcode::checksig ||
             code == opcode::checksigverify)
@@ -1298,6 +1796,17 @@ size_t script::sigops(bool accurate) const
     return total;
 }
 
+size_t script::sigops(bool accurate) const
+{
+    if (accurate)
+        return sigops(bytes_, true);
+
+    return legacy_sigops_.get([this]()
+    {
+        return sigops(bytes_, false);
+    });
+}
+
 //*****************************************************************************
 // CONSENSUS: this is a pointless, broken, premature optimization attempt.
 // The comparison and erase are not limited to a single operation and so can
@@ -1345,9 +1854,10 @@ void script::find_and_delete(const data_stack& endorsements)
     for (const auto& endorsement: endorsements)
         find_and_delete_(endorsement);
 
-    // Invalidate the cache so that the operations may be regenerated.
-    operations_.clear();
-    cached_ = false;
+    // Invalidate the caches so that the operations may be regenerated.
+    operations_.reset();
+    instructions_.reset();
+    legacy_sigops_.reset();
     bytes_.shrink_to_fit();
 }
 
@@ -1370,9 +1880,207 @@ void script::find_and_delete(const data_stack& endorsements)
 // The criteria below are not be comprehensive but are fast to evaluate.
 bool script::is_unspendable() const
 {
-    // The first operations access must be method-based to guarantee the cache.
-    return (!operations().empty() && operations_[0].code() == opcode::return_)
-        || serialized_size(false) > max_script_size;
+    const auto& ops = instructions();
+    return (!ops.empty() && ops.front().code() == opcode::return_) ||
+        serialized_size(false) > max_script_size;
+}
+
+// Standard verification.
+//-----------------------------------------------------------------------------
+// Each path mirrors the interpreter for one template but reports only success.
+// On any other outcome the interpreter is run to produce the exact error code.
+
+// A push accepted by the interpreter without counting or number encoding.
+inline bool is_data_push(const instruction& op)
+{
+    static constexpr auto op_78 = static_cast<uint8_t>(opcode::push_four_size);
+
+    return op.is_valid() && !op.is_oversized() &&
+        static_cast<uint8_t>(op.code()) <= op_78;
+}
+
+// This is the program::stack_to_bool test applied to a single element.
+inline bool is_stack_true(data_slice element)
+{
+    for (auto it = element.begin(); it != element.end(); ++it)
+        if (*it != 0)
+            return !(it == element.end() - 1 && *it == number::negative_0);
+
+    return false;
+}
+
+inline bool is_key_hash(data_slice public_key, data_slice hash)
+{
+    const auto key_hash = bitcoin_short_hash(public_key);
+    return hash.size() == key_hash.size() &&
+        std::equal(key_hash.begin(), key_hash.end(), hash.begin());
+}
+
+// The endorsement parse of op_check_sig_verify and op_check_multisig_verify.
+static bool parse_signature(uint8_t& sighash_type, ec_signature& signature,
+    data_slice endorsement, bool bip66)
+{
+    data_slice distinguished(nullptr, nullptr);
+    return bc::parse_endorsement(sighash_type, distinguished, endorsement) &&
+        bc::parse_signature(signature, distinguished, bip66);
+}
+
+// [endorsement] [public key] : dup hash160 [hash] equalverify checksig
+// The version and value are those of the p2pkh or the p2wpkh program.
+static bool verify_key_hash(const transaction& tx, uint32_t input_index,
+    uint32_t forks, const data_chunk& endorsement, data_slice public_key,
+    const script& script_code, script_version version, uint64_t value)
+{
+    uint8_t sighash;
+    ec_signature signature;
+    const auto bip66 = script::is_enabled(forks, rule_fork::bip66_rule);
+    const auto bip143 = script::is_enabled(forks, rule_fork::bip143_rule);
+
+    if (!parse_signature(sighash, signature, endorsement, bip66))
+        return false;
+
+    // BIP143: find and delete of the signature is not applied for v0.
+    if (bip143 && version == script_version::zero)
+        return script::check_signature(signature, sighash, public_key,
+            script_code, tx, input_index, version, value);
+
+    script stripped(script_code);
+    stripped.find_and_delete({ endorsement });
+
+    // Version condition preserves independence of bip141 and bip143.
+    return script::check_signature(signature, sighash, public_key, stripped,
+        tx, input_index, bip143 ? version : script_version::unversioned,
+        value);
+}
+
+// The witness must be [endorsement] [public key] for a v0 20 byte program.
+static bool verify_witness_key_hash(const transaction& tx,
+    uint32_t input_index, uint32_t forks, data_slice program, uint64_t value)
+{
+    const auto& stack = tx.inputs()[input_index].witness().stack();
+
+    // Stack must be 2 elements, within push size limit (bip141).
+    if (stack.size() != 2 || !witness::is_push_size(stack) ||
+        !is_key_hash(stack[1], program))
+        return false;
+
+    short_hash hash;
+    std::copy(program.begin(), program.end(), hash.begin());
+    const script script_code(script::to_pay_key_hash_pattern(hash));
+
+    // The checksig result is the only remaining element, a clean true stack.
+    return verify_key_hash(tx, input_index, forks, stack[0], stack[1],
+        script_code, script_version::zero, value);
+}
+
+// 0 [endorsement]... : m [public key]... n checkmultisig
+static bool verify_multisig(const transaction& tx, uint32_t input_index,
+    uint32_t forks, const instruction::list& ops, const data_chunk& bytes,
+    const script& prevout_script, const instruction::list& keys,
+    const data_chunk& prevout_bytes)
+{
+    const auto key_count = keys.size() - 3u;
+    const auto signature_count = operation::opcode_to_positive(
+        keys.front().code());
+
+    // Precluding extra elements makes the checkmultisig result the stack.
+    if (ops.size() != signature_count + 1u ||
+        ops.front().code() != opcode::push_size_0 ||
+        !std::all_of(ops.begin(), ops.end(), is_data_push) ||
+        bytes.size() > max_script_size)
+        return false;
+
+    // Endorsements and keys are popped, so both are consumed top down.
+    data_stack endorsements;
+    endorsements.reserve(signature_count);
+    for (auto op = ops.rbegin(); op != ops.rend() - 1; ++op)
+        endorsements.push_back(to_chunk(op->data(bytes)));
+
+    script script_code(prevout_script);
+    script_code.find_and_delete(endorsements);
+
+    uint8_t sighash;
+    ec_signature signature;
+    auto key = key_count;
+    const auto bip66 = script::is_enabled(forks, rule_fork::bip66_rule);
+
+    for (const auto& endorsement: endorsements)
+    {
+        if (!parse_signature(sighash, signature, endorsement, bip66))
+            return false;
+
+        while (!script::check_signature(signature, sighash,
+            keys[key].data(prevout_bytes), script_code, tx, input_index,
+            script_version::unversioned, max_uint64))
+            if (--key == 0)
+                return false;
+    }
+
+    return true;
+}
+
+bool script::verify_standard(const transaction& tx, uint32_t input_index,
+    uint32_t forks, const script& prevout_script, uint64_t value)
+{
+    if (input_index >= tx.inputs().size())
+        return false;
+
+    // Patterns are matched on the compact instructions, so that operations
+    // (and their push data copies) are not decoded for standard scripts.
+    const auto& in = tx.inputs()[input_index];
+    const auto& bytes = in.script().bytes_;
+    const auto& ops = in.script().instructions();
+    const auto& prevout_bytes = prevout_script.bytes_;
+    const auto& prevout_ops = prevout_script.instructions();
+
+    // Witness must be empty if no bip141 or valid witness program (bip141).
+    if (is_pay_key_hash_pattern(prevout_ops))
+        return in.witness().empty() && ops.size() == 2 &&
+            is_data_push(ops[0]) && is_data_push(ops[1]) &&
+            is_key_hash(ops[1].data(bytes),
+                prevout_ops[2].data(prevout_bytes)) &&
+            verify_key_hash(tx, input_index, forks,
+                to_chunk(ops[0].data(bytes)), ops[1].data(bytes),
+                prevout_script, script_version::unversioned, max_uint64);
+
+    if (is_pay_multisig_pattern(prevout_ops, prevout_bytes))
+        return in.witness().empty() && verify_multisig(tx, input_index, forks,
+            ops, bytes, prevout_script, prevout_ops, prevout_bytes);
+
+    // The program must be true on the stack (precludes -0 programs).
+    if (prevout_script.is_pay_to_witness(forks))
+        return ops.empty() &&
+            prevout_ops[0].code() == opcode::push_size_0 &&
+            prevout_ops[1].size() == short_hash_size &&
+            is_stack_true(prevout_ops[1].data(prevout_bytes)) &&
+            verify_witness_key_hash(tx, input_index, forks,
+                prevout_ops[1].data(prevout_bytes), value);
+
+    // The embedded script must be exactly [0] [20 byte program].
+    static constexpr auto embedded_size = 2u + short_hash_size;
+
+    if (prevout_script.is_pay_to_script_hash(forks) &&
+        is_enabled(forks, rule_fork::bip141_rule))
+    {
+        if (ops.size() != 1 || !is_data_push(ops[0]))
+            return false;
+
+        const auto embedded = ops[0].data(bytes);
+        if (embedded.size() != embedded_size || embedded.data()[0] != 0x00 ||
+            embedded.data()[1] != short_hash_size)
+            return false;
+
+        const auto hash = bitcoin_short_hash(embedded);
+        const auto expected = prevout_ops[1].data(prevout_bytes);
+        const data_slice program(embedded.data() + 2,
+            embedded.data() + embedded_size);
+
+        return std::equal(hash.begin(), hash.end(), expected.begin()) &&
+            is_stack_true(program) &&
+            verify_witness_key_hash(tx, input_index, forks, program, value);
+    }
+
+    return false;
 }
 
 // Validation.
@@ -1380,6 +2088,65 @@ bool script::is_unspendable() const
 
 code script::verify(const transaction& tx, uint32_t input_index,
     uint32_t forks, const script& prevout_script, uint64_t value)
+{
+    verification_context context;
+    return verify(tx, input_index, forks, prevout_script, value, context);
+}
+
+// Standard templates are only reported here if they succeed.
+inline code verify_unmeasured(const transaction& tx, uint32_t input_index,
+    uint32_t forks, const script& prevout_script, uint64_t value,
+    verification_context& context)
+{
+    if (script::verify_standard(tx, input_index, forks, prevout_script, value))
+        return error::success;
+
+    return script::verify_interpreted(tx, input_index, forks, prevout_script,
+        value, context);
+}
+
+code script::verify(const transaction& tx, uint32_t input_index,
+    uint32_t forks, const script& prevout_script, uint64_t value,
+    verification_context& context)
+{
+    if (input_index >= tx.inputs().size())
+        return error::operation_failed;
+
+    const auto profile = context.profile();
+    if (profile == nullptr)
+        return verify_unmeasured(tx, input_index, forks, prevout_script, value,
+            context);
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto ec = verify_unmeasured(tx, input_index, forks, prevout_script,
+        value, context);
+
+    profile->record_input(std::chrono::duration_cast<
+        script_profile::duration>(std::chrono::steady_clock::now() - start));
+    return ec;
+}
+
+// This precludes bare witness programs of -0 (undocumented).
+inline code evaluate_prevout(program& prevout)
+{
+    const auto ec = prevout.evaluate();
+    if (ec)
+        return ec;
+
+    return prevout.stack_result(false) ? error::success : error::stack_false;
+}
+
+code script::verify_interpreted(const transaction& tx, uint32_t input_index,
+    uint32_t forks, const script& prevout_script, uint64_t value)
+{
+    verification_context context;
+    return verify_interpreted(tx, input_index, forks, prevout_script, value,
+        context);
+}
+
+code script::verify_interpreted(const transaction& tx, uint32_t input_index,
+    uint32_t forks, const script& prevout_script, uint64_t value,
+    verification_context& context)
 {
     if (input_index >= tx.inputs().size())
         return error::operation_failed;
@@ -1389,18 +2156,26 @@ code script::verify(const transaction& tx, uint32_t input_index,
     const auto& in = tx.inputs()[input_index];
 
     // Evaluate input script.
-    program input(in.script(), tx, input_index, forks);
+    program input(in.script(), tx, input_index, forks, context);
     if ((ec = input.evaluate()))
         return ec;
 
     // Evaluate output script using stack result from input script.
-    program prevout(prevout_script, input);
-    if ((ec = prevout.evaluate()))
-        return ec;
+    // The input stack is used again only for p2sh, otherwise it is moved.
+    const auto embed = prevout_script.is_pay_to_script_hash(forks);
 
-    // This precludes bare witness programs of -0 (undocumented).
-    if (!prevout.stack_result(false))
-        return error::stack_false;
+    if (embed)
+    {
+        program prevout(prevout_script, input);
+        if ((ec = evaluate_prevout(prevout)))
+            return ec;
+    }
+    else
+    {
+        program prevout(prevout_script, std::move(input), true);
+        if ((ec = evaluate_prevout(prevout)))
+            return ec;
+    }
 
     // Triggered by output script push of version and witness program (bip141).
     if ((witnessed = prevout_script.is_pay_to_witness(forks)))
@@ -1411,18 +2186,36 @@ code script::verify(const transaction& tx, uint32_t input_index,
 
         // This is a valid witness script so validate it.
         if ((ec = in.witness().verify(tx, input_index, forks,
-            prevout_script, value)))
+            prevout_script, value, context)))
             return ec;
     }
 
     // p2sh and p2w are mutually exclusive.
-    else if (prevout_script.is_pay_to_script_hash(forks))
+    else if (embed)
     {
         if (!is_relaxed_push(in.script().operations()))
             return error::invalid_script_embed;
 
         // Embedded script must be at the top of the stack (bip16).
-        script embedded_script(input.pop(), false);
+        const auto top = input.pop();
+        const data_slice bytes(top.data(), top.data() + top.size());
+
+        // The decoded script is shared by the redeem script cache if enabled.
+        short_hash hash;
+        script buffer;
+        redeem_script_cache::entry entry;
+        auto& cache = redeem_script_cache::redeem_scripts();
+        const auto cacheable = cache.enabled() &&
+            redeem_script_cache::to_key(hash, prevout_script);
+        const auto cached = cacheable && cache.find(entry, hash, bytes);
+
+        if (!cacheable)
+            buffer.from_data(top.to_data(), false);
+        else if (!cached)
+            entry.script = std::make_shared<const script>(top.to_data(),
+                false);
+
+        const auto& embedded_script = cacheable ? *entry.script : buffer;
 
         program embedded(embedded_script, std::move(input), true);
         if ((ec = embedded.evaluate()))
@@ -1441,9 +2234,13 @@ code script::verify(const transaction& tx, uint32_t input_index,
 
             // This is a valid embedded witness script so validate it.
             if ((ec = in.witness().verify(tx, input_index, forks,
-                embedded_script, value)))
+                embedded_script, value, context)))
                 return ec;
         }
+
+        // Only a successfully evaluated redeem script is cached.
+        if (cacheable && !cached)
+            cache.insert(hash, entry.script);
     }
 
     // Witness must be empty if no bip141 or valid witness program (bip141).
@@ -1460,9 +2257,21 @@ code script::verify(const transaction& tx, uint32_t input_index,
         return error::operation_failed;
 
     const auto& in = tx.inputs()[input_index];
-    const auto& prevout = in.previous_output().metadata.cache;
+    const auto& prevout = in.previous_output().cached_output();
     return verify(tx, input_index, forks, prevout.script(), prevout.value());
 }
 
+code script::verify(const transaction& tx, uint32_t input_index,
+    uint32_t forks, verification_context& context)
+{
+    if (input_index >= tx.inputs().size())
+        return error::operation_failed;
+
+    const auto& in = tx.inputs()[input_index];
+    const auto& prevout = in.previous_output().cached_output();
+    return verify(tx, input_index, forks, prevout.script(), prevout.value(),
+        context);
+}
+
 } // namespace chain
 } // namespace libbitcoin
@@ -0,0 +1,195 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/chain/script_cache.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/endian.hpp>
+#include <bitcoin/bitcoin/utility/pseudo_random.hpp>
+#include "../math/external/sha256.h"
+
+namespace libbitcoin {
+namespace chain {
+
+const size_t script_cache::entry_size = entries::entry_size;
+
+script_cache::script_cache(size_t maximum_bytes)
+  : persistent_(false), forks_(0),
+    entries_(to_capacity(maximum_bytes), shard_count)
+{
+    // The salt precludes construction of colliding keys by a peer.
+    pseudo_random::fill(salt_);
+}
+
+size_t script_cache::key_hasher::operator()(const hash_digest& key) const
+{
+    size_t value;
+    std::memcpy(&value, key.data(), sizeof(value));
+    return value;
+}
+
+// private
+// The capacity is a whole number of entries for each shard.
+size_t script_cache::to_capacity(size_t maximum_bytes)
+{
+    return maximum_bytes / entry_size / shard_count * shard_count;
+}
+
+// private
+hash_digest script_cache::to_key(const hash_digest& witness_hash,
+    uint32_t input_index, uint32_t forks) const
+{
+    // The forks are keyed, so entries inserted during a change are not hit.
+    const auto index = to_little_endian(input_index);
+    const auto flags = to_little_endian(forks);
+
+    hash_digest key;
+    SHA256CTX context;
+    SHA256Init(&context);
+    SHA256Update(&context, salt_.data(), salt_.size());
+    SHA256Update(&context, witness_hash.data(), witness_hash.size());
+    SHA256Update(&context, index.data(), index.size());
+    SHA256Update(&context, flags.data(), flags.size());
+    SHA256Final(&context, key.data());
+    return key;
+}
+
+// private
+void script_cache::set_forks(uint32_t forks)
+{
+    auto expected = forks_.load();
+
+    // Only the thread that changes the forks clears the cache.
+    if (expected != forks && forks_.compare_exchange_strong(expected, forks))
+        clear();
+}
+
+bool script_cache::contains(const hash_digest& witness_hash,
+    uint32_t input_index, uint32_t forks) const
+{
+    if (!enabled())
+        return false;
+
+    return entries_.contains(to_key(witness_hash, input_index, forks));
+}
+
+void script_cache::insert(const hash_digest& witness_hash,
+    uint32_t input_index, uint32_t forks)
+{
+    if (!enabled())
+        return;
+
+    set_forks(forks);
+    entries_.insert(to_key(witness_hash, input_index, forks), true);
+}
+
+void script_cache::resize(size_t maximum_bytes)
+{
+    entries_.resize(to_capacity(maximum_bytes));
+}
+
+void script_cache::set_secret(const hash_digest& secret)
+{
+    clear();
+    salt_ = cache_snapshot::to_salt(secret, "script_cache");
+    persistent_ = true;
+}
+
+bool script_cache::store(const path& file) const
+{
+    if (!persistent_)
+        return false;
+
+    hash_list keys;
+    keys.reserve(entries_.size());
+    entries_.visit([&keys](const hash_digest& key, bool)
+    {
+        keys.push_back(key);
+    });
+
+    return cache_snapshot::store(file, salt_, forks_.load(), keys);
+}
+
+size_t script_cache::load(const path& file, threadpool& pool,
+    const asio::duration& timeout)
+{
+    cache_snapshot snapshot;
+
+    if (!enabled() || !persistent_ || !snapshot.open(file, salt_))
+        return 0;
+
+    set_forks(snapshot.tag());
+
+    // Loading stops when full, so as not to evict loaded entries.
+    const auto insert = [this](const hash_digest& key)
+    {
+        if (entries_.cost() >= entries_.capacity())
+            return false;
+
+        entries_.insert(key, true);
+        return true;
+    };
+
+    return snapshot.load(pool, timeout, insert);
+}
+
+void script_cache::clear()
+{
+    entries_.clear();
+}
+
+bool script_cache::enabled() const
+{
+    return entries_.enabled();
+}
+
+size_t script_cache::size() const
+{
+    return entries_.size();
+}
+
+size_t script_cache::capacity() const
+{
+    return entries_.capacity();
+}
+
+uint64_t script_cache::hits() const
+{
+    return entries_.hits();
+}
+
+uint64_t script_cache::misses() const
+{
+    return entries_.misses();
+}
+
+uint64_t script_cache::evictions() const
+{
+    return entries_.evictions();
+}
+
+float script_cache::hit_rate() const
+{
+    return entries_.hit_rate();
+}
+
+} // namespace chain
+} // namespace libbitcoin
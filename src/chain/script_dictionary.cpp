@@ -0,0 +1,167 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/chain/script_dictionary.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+#include <bitcoin/bitcoin/chain/block.hpp>
+#include <bitcoin/bitcoin/chain/script.hpp>
+#include <bitcoin/bitcoin/utility/assert.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+BC_CONSTEXPR size_t script_dictionary::default_size;
+
+script_dictionary script_dictionary::train(const block::list& sample,
+    size_t size)
+{
+    typedef std::pair<size_t, const data_chunk*> frequency;
+    std::map<data_chunk, size_t> counts;
+
+    for (const auto& block: sample)
+        for (const auto& tx: block.transactions())
+            for (const auto& output: tx.outputs())
+                ++counts[output.script().bytes()];
+
+    std::vector<frequency> frequent;
+
+    for (const auto& count: counts)
+        if (count.second > 1)
+            frequent.emplace_back(count.second, &count.first);
+
+    // The map is ordered by bytes, so a stable sort orders ties by bytes.
+    std::stable_sort(frequent.begin(), frequent.end(),
+        [](const frequency& left, const frequency& right)
+        {
+            return left.first > right.first;
+        });
+
+    list scripts;
+    scripts.reserve(std::min(size, frequent.size()));
+
+    for (size_t index = 0; index < scripts.capacity(); ++index)
+        scripts.push_back(*frequent[index].second);
+
+    return { std::move(scripts) };
+}
+
+script_dictionary::script_dictionary()
+{
+}
+
+script_dictionary::script_dictionary(list&& scripts)
+  : scripts_(std::move(scripts))
+{
+    index();
+}
+
+// Duplicate scripts are not accepted, as the one position is ambiguous.
+bool script_dictionary::from_data(const data_chunk& data)
+{
+    scripts_.clear();
+    positions_.clear();
+
+    byte_reader source(data);
+    const auto count = source.read_variable_base128();
+
+    // Each script consumes at least its size byte.
+    if (count > source.remaining())
+        return false;
+
+    scripts_.reserve(static_cast<size_t>(count));
+
+    for (uint64_t index = 0; index < count && source; ++index)
+    {
+        const auto size = source.read_variable_base128();
+
+        if (size > source.remaining())
+            return false;
+
+        scripts_.push_back(source.read_bytes(static_cast<size_t>(size)));
+    }
+
+    index();
+
+    if (!source || !source.is_exhausted() ||
+        positions_.size() != scripts_.size())
+    {
+        scripts_.clear();
+        positions_.clear();
+        return false;
+    }
+
+    return true;
+}
+
+data_chunk script_dictionary::to_data() const
+{
+    data_chunk data;
+    byte_writer sink(data);
+    sink.write_variable_base128(scripts_.size());
+
+    for (const auto& script: scripts_)
+    {
+        sink.write_variable_base128(script.size());
+        sink.write_bytes(script);
+    }
+
+    return data;
+}
+
+size_t script_dictionary::size() const
+{
+    return scripts_.size();
+}
+
+bool script_dictionary::empty() const
+{
+    return scripts_.empty();
+}
+
+size_t script_dictionary::find(const data_chunk& script) const
+{
+    const auto it = positions_.find(script);
+    return it == positions_.end() ? scripts_.size() : it->second;
+}
+
+script script_dictionary::at(size_t position) const
+{
+    BITCOIN_ASSERT(position < scripts_.size());
+    return { scripts_[position], false };
+}
+
+// private
+void script_dictionary::index()
+{
+    positions_.clear();
+
+    for (size_t position = 0; position < scripts_.size(); ++position)
+        positions_.emplace(scripts_[position], position);
+}
+
+} // namespace chain
+} // namespace libbitcoin
@@ -0,0 +1,64 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHAIN_SIGHASH_PRECOMPUTE_HPP
+#define LIBBITCOIN_CHAIN_SIGHASH_PRECOMPUTE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <bitcoin/bitcoin/chain/script.hpp>
+#include <bitcoin/bitcoin/chain/transaction.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include "../math/external/sha256.h"
+
+namespace libbitcoin {
+namespace chain {
+
+/// Serialization segments and sha256 midstates shared by the unversioned
+/// sighash_all preimages of all inputs of a transaction. Immutable once built.
+struct sighash_precompute
+{
+    /// The serialized size of an input with an empty script.
+    static const size_t blank_input_size;
+
+    explicit sighash_precompute(const transaction& tx);
+
+    /// The unversioned signature hash for sighash_all (any anyone_can_pay).
+    hash_digest sign_all(uint32_t input_index, const script& script_code,
+        uint8_t sighash_type) const;
+
+    /// Midstate over version and input count (anyone_can_pay uses one).
+    SHA256CTX single;
+
+    /// Midstates over version, input count and the blank inputs preceding
+    /// the input of the same index.
+    std::vector<SHA256CTX> prefixes;
+
+    /// The concatenation of all inputs serialized with empty scripts.
+    data_chunk blanks;
+
+    /// The serialized output count, outputs and locktime.
+    data_chunk suffix;
+};
+
+} // namespace chain
+} // namespace libbitcoin
+
+#endif
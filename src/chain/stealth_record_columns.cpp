@@ -0,0 +1,322 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/chain/stealth_record_columns.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <utility>
+#include <vector>
+#include <bitcoin/bitcoin/chain/stealth_record.hpp>
+#include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/binary.hpp>
+#include <bitcoin/bitcoin/utility/binary_set.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/istream_reader.hpp>
+#include <bitcoin/bitcoin/utility/ostream_writer.hpp>
+#include "record_columns.hpp"
+
+namespace libbitcoin {
+namespace chain {
+
+// The fixed width columns: prefix, ephemeral key, key hash and tx hash.
+static BC_CONSTEXPR size_t prefix_width = sizeof(uint32_t);
+static BC_CONSTEXPR size_t fixed_width = prefix_width + hash_size +
+    short_hash_size + hash_size;
+
+static column to_heights(const stealth_record::list& records)
+{
+    column heights;
+    heights.reserve(records.size());
+
+    for (const auto& record: records)
+        heights.push_back(record.height());
+
+    return heights;
+}
+
+static size_t body_size(const column& heights)
+{
+    return delta_column_size(heights) + heights.size() * fixed_width;
+}
+
+// Constructors.
+//-----------------------------------------------------------------------------
+
+// A default instance is invalid (until modified).
+stealth_record_columns::stealth_record_columns()
+  : valid_(false)
+{
+}
+
+stealth_record_columns::stealth_record_columns(
+    stealth_record_columns&& other)
+  : valid_(other.valid_), records_(std::move(other.records_))
+{
+}
+
+stealth_record_columns::stealth_record_columns(
+    const stealth_record_columns& other)
+  : valid_(other.valid_), records_(other.records_)
+{
+}
+
+stealth_record_columns::stealth_record_columns(stealth_record::list&& records)
+  : valid_(true), records_(std::move(records))
+{
+}
+
+stealth_record_columns::stealth_record_columns(
+    const stealth_record::list& records)
+  : valid_(true), records_(records)
+{
+}
+
+// Operators.
+//-----------------------------------------------------------------------------
+
+stealth_record_columns& stealth_record_columns::operator=(
+    stealth_record_columns&& other)
+{
+    valid_ = other.valid_;
+    records_ = std::move(other.records_);
+    return *this;
+}
+
+stealth_record_columns& stealth_record_columns::operator=(
+    const stealth_record_columns& other)
+{
+    valid_ = other.valid_;
+    records_ = other.records_;
+    return *this;
+}
+
+bool stealth_record_columns::operator==(
+    const stealth_record_columns& other) const
+{
+    return records_ == other.records_;
+}
+
+bool stealth_record_columns::operator!=(
+    const stealth_record_columns& other) const
+{
+    return !(*this == other);
+}
+
+// Deserialization.
+//-----------------------------------------------------------------------------
+
+stealth_record_columns stealth_record_columns::factory(const data_chunk& data)
+{
+    stealth_record_columns instance;
+    instance.from_data(data);
+    return instance;
+}
+
+stealth_record_columns stealth_record_columns::factory(std::istream& stream)
+{
+    stealth_record_columns instance;
+    instance.from_data(stream);
+    return instance;
+}
+
+stealth_record_columns stealth_record_columns::factory(reader& source)
+{
+    stealth_record_columns instance;
+    instance.from_data(source);
+    return instance;
+}
+
+bool stealth_record_columns::from_data(const data_chunk& data)
+{
+    byte_reader source(data);
+    return from_data(source);
+}
+
+bool stealth_record_columns::from_data(std::istream& stream)
+{
+    istream_reader source(stream);
+    return from_data(source);
+}
+
+bool stealth_record_columns::from_data(reader& source)
+{
+    return from_data(source, 0, {});
+}
+
+// Heights and prefixes are read to select rows, other columns are skipped.
+bool stealth_record_columns::from_data(reader& source, size_t start_height,
+    const binary& filter)
+{
+    reset();
+    size_t count;
+    size_t body;
+    uint32_t min_height;
+    uint32_t max_height;
+
+    if (!read_header(source, count, min_height, max_height, body))
+        return false;
+
+    // The set is below the start height, so none of its rows are read.
+    if (max_height < start_height)
+    {
+        source.skip(body);
+        valid_ = source;
+        return source;
+    }
+
+    const auto heights = read_delta_column(source, count);
+
+    binary_set prefix_set(binary::bits_per_block * prefix_width);
+    std::vector<uint32_t> prefixes;
+
+    for (size_t row = 0; row < count && source; ++row)
+    {
+        prefixes.push_back(source.read_4_bytes_little_endian());
+        prefix_set.push_back(prefixes.back());
+    }
+
+    if (!source)
+    {
+        reset();
+        return false;
+    }
+
+    auto rows = prefix_set.match(filter);
+    rows.erase(std::remove_if(rows.begin(), rows.end(),
+        [&](size_t row) { return heights[row] < start_height; }), rows.end());
+
+    const auto selected = rows.size();
+    std::vector<hash_digest> ephemerals(selected);
+    std::vector<short_hash> public_key_hashes(selected);
+    std::vector<hash_digest> transaction_hashes(selected);
+
+    read_rows(source, count, hash_size, rows, [&](size_t index)
+    {
+        ephemerals[index] = source.read_hash();
+    });
+
+    read_rows(source, count, short_hash_size, rows, [&](size_t index)
+    {
+        public_key_hashes[index] = source.read_short_hash();
+    });
+
+    read_rows(source, count, hash_size, rows, [&](size_t index)
+    {
+        transaction_hashes[index] = source.read_hash();
+    });
+
+    if (!source)
+    {
+        reset();
+        return false;
+    }
+
+    records_.reserve(selected);
+
+    for (size_t index = 0; index < selected; ++index)
+    {
+        const auto row = rows[index];
+        records_.emplace_back(static_cast<size_t>(heights[row]),
+            prefixes[row], std::move(ephemerals[index]),
+            std::move(public_key_hashes[index]),
+            std::move(transaction_hashes[index]));
+    }
+
+    valid_ = true;
+    return true;
+}
+
+// protected
+void stealth_record_columns::reset()
+{
+    valid_ = false;
+    records_.clear();
+}
+
+bool stealth_record_columns::is_valid() const
+{
+    return valid_;
+}
+
+// Serialization.
+//-----------------------------------------------------------------------------
+
+data_chunk stealth_record_columns::to_data() const
+{
+    data_chunk data;
+    const auto size = serialized_size();
+    data.reserve(size);
+    byte_writer sink(data);
+    to_data(sink);
+    BITCOIN_ASSERT(data.size() == size);
+    return data;
+}
+
+void stealth_record_columns::to_data(std::ostream& stream) const
+{
+    ostream_writer sink(stream);
+    to_data(sink);
+}
+
+void stealth_record_columns::to_data(writer& sink) const
+{
+    const auto heights = to_heights(records_);
+    const auto range = std::minmax_element(heights.begin(), heights.end());
+    const auto min_height = heights.empty() ? 0 : *range.first;
+    const auto max_height = heights.empty() ? 0 : *range.second;
+
+    write_header(sink, records_.size(), static_cast<uint32_t>(min_height),
+        static_cast<uint32_t>(max_height), body_size(heights));
+
+    write_delta_column(sink, heights);
+
+    for (const auto& record: records_)
+        sink.write_4_bytes_little_endian(record.prefix());
+
+    for (const auto& record: records_)
+        sink.write_hash(record.unsigned_ephemeral_public_key());
+
+    for (const auto& record: records_)
+        sink.write_short_hash(record.public_key_hash());
+
+    for (const auto& record: records_)
+        sink.write_hash(record.transaction_hash());
+}
+
+// Properties (size, accessors).
+//-----------------------------------------------------------------------------
+
+size_t stealth_record_columns::serialized_size() const
+{
+    const auto body = body_size(to_heights(records_));
+    return header_size(records_.size(), body) + body;
+}
+
+const stealth_record::list& stealth_record_columns::records() const
+{
+    return records_;
+}
+
+} // namespace chain
+} // namespace libbitcoin
@@ -22,6 +22,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <memory>
 #include <numeric>
 #include <type_traits>
 #include <sstream>
@@ -40,13 +41,18 @@
 #include <bitcoin/bitcoin/machine/opcode.hpp>
 #include <bitcoin/bitcoin/machine/operation.hpp>
 #include <bitcoin/bitcoin/machine/rule_fork.hpp>
+#include <bitcoin/bitcoin/machine/verification_context.hpp>
 #include <bitcoin/bitcoin/message/messages.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
 #include <bitcoin/bitcoin/utility/collection.hpp>
-#include <bitcoin/bitcoin/utility/container_sink.hpp>
-#include <bitcoin/bitcoin/utility/container_source.hpp>
 #include <bitcoin/bitcoin/utility/endian.hpp>
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
 #include <bitcoin/bitcoin/utility/ostream_writer.hpp>
+#include <bitcoin/bitcoin/utility/trace.hpp>
+#include "hash_reader.hpp"
+#include "context_writer.hpp"
+#include "sighash_precompute.hpp"
 
 namespace libbitcoin {
 namespace chain {
@@ -56,23 +62,40 @@ using namespace bc::machine;
 // HACK: unlinked must match tx slab_map::not_found.
 const uint64_t transaction::validation::unlinked = max_int64;
 
+// The smallest wire serializations of an input and an output (empty script).
+static constexpr size_t min_input_size = hash_size + 4 + 1 + 4;
+static constexpr size_t min_output_size = 8 + 1;
+
+// A recycled input leaves its wire witness to be read after the outputs.
+inline bool read_put(reader& source, input& put, bool wire, bool witness,
+    bool recycle)
+{
+    return recycle ? put.recycle(source, wire, witness) :
+        put.from_data(source, wire, witness);
+}
+
+// An output is always read in place.
+inline bool read_put(reader& source, output& put, bool wire, bool witness,
+    bool)
+{
+    return put.from_data(source, wire, witness);
+}
+
 // Read a length-prefixed collection of inputs or outputs from the source.
+// Each put consumes at least the minimum size, which bounds the count.
 template<class Source, class Put>
-bool read(Source& source, std::vector<Put>& puts, bool wire, bool witness)
+bool read(Source& source, std::vector<Put>& puts, bool wire, bool witness,
+    bool recycle, size_t minimum=1)
 {
     auto result = true;
-    const auto count = source.read_size_little_endian();
 
     // Guard against potential for arbitary memory allocation.
-    if (count > max_block_size)
-        source.invalidate();
-    else
-        puts.resize(count);
+    puts.resize(read_count(source, minimum, max_block_size));
 
     const auto deserialize = [&](Put& put)
     {
-        result = result && put.from_data(source, wire, witness);
-#ifndef NDBEUG
+        result = result && read_put(source, put, wire, witness, recycle);
+#ifndef NDEBUG
         put.script().operations();
 #endif
     };
@@ -96,16 +119,41 @@ void write(Sink& sink, const std::vector<Put>& puts, bool wire, bool witness)
 }
 
 // Input list must be pre-populated as it determines witness count.
-inline void read_witnesses(reader& source, input::list& inputs)
+inline void read_witnesses(reader& source, input::list& inputs, bool recycle)
 {
     const auto deserialize = [&](input& input)
     {
-        input.set_witness(witness::factory(source, true));
+        if (recycle)
+            input.recycle_witness(source);
+        else
+            input.set_witness(witness::factory(source, true));
     };
 
     std::for_each(inputs.begin(), inputs.end(), deserialize);
 }
 
+// The source reads the remainder of the encoding, to which each witness
+// refers until it is parsed.
+inline void read_witnesses(reader& source, input::list& inputs,
+    const transaction::encoding_ptr& data)
+{
+    const auto deserialize = [&](input& input)
+    {
+        witness value;
+        value.from_data(source, data);
+        input.set_witness(std::move(value));
+    };
+
+    std::for_each(inputs.begin(), inputs.end(), deserialize);
+}
+
+// Witnesses that are not retained are not read.
+inline void skip_witnesses(reader& source, size_t inputs)
+{
+    for (; inputs > 0 && source; --inputs)
+        witness::skip(source);
+}
+
 // Witness count is not written as it is inferred from input count.
 inline void write_witnesses(writer& sink, const input::list& inputs)
 {
@@ -117,6 +165,22 @@ inline void write_witnesses(writer& sink, const input::list& inputs)
     std::for_each(inputs.begin(), inputs.end(), serialize);
 }
 
+// Empty lists are not allocated, the null list reads as empty.
+template <class List>
+std::shared_ptr<typename std::decay<List>::type> share(List&& list)
+{
+    typedef typename std::decay<List>::type type;
+    return list.empty() ? nullptr :
+        std::make_shared<type>(std::forward<List>(list));
+}
+
+// Unpopulated metadata is not allocated by the query.
+static chain_state::ptr populated_state(const transaction& tx)
+{
+    const auto metadata = tx.metadata.peek();
+    return metadata == nullptr ? nullptr : metadata->state;
+}
+
 // Constructors.
 //-----------------------------------------------------------------------------
 
@@ -126,25 +190,31 @@ transaction::transaction()
 }
 
 transaction::transaction(transaction&& other)
-  : hash_(other.hash_cache()),
-    total_input_value_(other.total_input_value_cache()),
-    total_output_value_(other.total_output_value_cache()),
-    version_(other.version_),
+  : version_(other.version_),
     locktime_(other.locktime_),
     inputs_(std::move(other.inputs_)),
     outputs_(std::move(other.outputs_)),
+    hash_(other.hash_),
+    base_size_(other.base_size_),
+    total_size_(other.total_size_),
+    total_input_value_(other.total_input_value_),
+    total_output_value_(other.total_output_value_),
+    retained_(std::move(other.retained_)),
     metadata(std::move(other.metadata))
 {
 }
 
 transaction::transaction(const transaction& other)
-  : hash_(other.hash_cache()),
-    total_input_value_(other.total_input_value_cache()),
-    total_output_value_(other.total_output_value_cache()),
-    version_(other.version_),
+  : version_(other.version_),
     locktime_(other.locktime_),
     inputs_(other.inputs_),
     outputs_(other.outputs_),
+    hash_(other.hash_),
+    base_size_(other.base_size_),
+    total_size_(other.total_size_),
+    total_input_value_(other.total_input_value_),
+    total_output_value_(other.total_output_value_),
+    retained_(other.retained_),
     metadata(other.metadata)
 {
 }
@@ -153,8 +223,8 @@ transaction::transaction(uint32_t version, uint32_t locktime,
     input::list&& inputs, output::list&& outputs)
   : version_(version),
     locktime_(locktime),
-    inputs_(std::move(inputs)),
-    outputs_(std::move(outputs)),
+    inputs_(share(std::move(inputs))),
+    outputs_(share(std::move(outputs))),
     metadata{}
 {
 }
@@ -163,59 +233,44 @@ transaction::transaction(uint32_t version, uint32_t locktime,
     const input::list& inputs, const output::list& outputs)
   : version_(version),
     locktime_(locktime),
-    inputs_(inputs),
-    outputs_(outputs),
+    inputs_(share(inputs)),
+    outputs_(share(outputs)),
     metadata{}
 {
 }
 
-// Private cache access for copy/move construction.
-transaction::hash_ptr transaction::hash_cache() const
-{
-    shared_lock lock(mutex_);
-    return hash_;
-}
-
-// Private cache access for copy/move construction.
-transaction::optional_value transaction::total_input_value_cache() const
-{
-    shared_lock lock(mutex_);
-    return total_input_value_;
-}
-
-// Private cache access for copy/move construction.
-transaction::optional_value transaction::total_output_value_cache() const
-{
-    shared_lock lock(mutex_);
-    return total_output_value_;
-}
-
 // Operators.
 //-----------------------------------------------------------------------------
 
 transaction& transaction::operator=(transaction&& other)
 {
-    hash_ = other.hash_cache();
-    total_input_value_ = other.total_input_value_cache();
-    total_output_value_ = other.total_output_value_cache();
+    hash_ = other.hash_;
+    base_size_ = other.base_size_;
+    total_size_ = other.total_size_;
+    total_input_value_ = other.total_input_value_;
+    total_output_value_ = other.total_output_value_;
     version_ = other.version_;
     locktime_ = other.locktime_;
     inputs_ = std::move(other.inputs_);
     outputs_ = std::move(other.outputs_);
+    retained_ = std::move(other.retained_);
     metadata = std::move(other.metadata);
     return *this;
 }
 
-// This can be expensive, try to avoid.
+// The inputs and outputs are shared, not copied.
 transaction& transaction::operator=(const transaction& other)
 {
-    hash_ = other.hash_cache();
-    total_input_value_ = other.total_input_value_cache();
-    total_output_value_ = other.total_output_value_cache();
+    hash_ = other.hash_;
+    base_size_ = other.base_size_;
+    total_size_ = other.total_size_;
+    total_input_value_ = other.total_input_value_;
+    total_output_value_ = other.total_output_value_;
     version_ = other.version_;
     locktime_ = other.locktime_;
     inputs_ = other.inputs_;
     outputs_ = other.outputs_;
+    retained_ = other.retained_;
     metadata = other.metadata;
     return *this;
 }
@@ -224,8 +279,8 @@ bool transaction::operator==(const transaction& other) const
 {
     return (version_ == other.version_)
         && (locktime_ == other.locktime_)
-        && (inputs_ == other.inputs_)
-        && (outputs_ == other.outputs_);
+        && (inputs_ == other.inputs_ || inputs() == other.inputs())
+        && (outputs_ == other.outputs_ || outputs() == other.outputs());
 }
 
 bool transaction::operator!=(const transaction& other) const
@@ -280,10 +335,19 @@ transaction transaction::factory(reader& source, const hash_digest& hash,
     return instance;
 }
 
+// static
+transaction transaction::factory(encoding_ptr data, size_t offset,
+    bool witness, bool lazy)
+{
+    transaction instance;
+    instance.from_data(data, offset, witness, lazy);
+    return instance;
+}
+
 bool transaction::from_data(const data_chunk& data, bool wire, bool witness)
 {
-    data_source istream(data);
-    return from_data(istream, wire, witness);
+    byte_reader source(data);
+    return from_data(source, wire, witness);
 }
 
 bool transaction::from_data(std::istream& stream, bool wire, bool witness)
@@ -295,40 +359,104 @@ bool transaction::from_data(std::istream& stream, bool wire, bool witness)
 // Witness is not used by outputs, just for template normalization.
 bool transaction::from_data(reader& source, bool wire, bool witness)
 {
-    reset();
+    return decode(source, wire, witness, false, nullptr);
+}
+
+bool transaction::recycle(const data_chunk& data, bool wire, bool witness)
+{
+    byte_reader source(data);
+    return recycle(source, wire, witness);
+}
+
+bool transaction::recycle(reader& source, bool wire, bool witness)
+{
+    return decode(source, wire, witness, true, nullptr);
+}
+
+// private
+// A lazy witness refers to the encoding read by the source, if not null.
+bool transaction::decode(reader& source, bool wire, bool witness,
+    bool recycle, const encoding_ptr& lazy)
+{
+    if (recycle)
+        clear();
+    else
+        reset();
 
     if (wire)
     {
         // Wire (satoshi protocol) deserialization.
-        version_ = source.read_4_bytes_little_endian();
-        read(source, inputs_, wire, witness);
+        // The txid and wtxid are hashed from the bytes as they are consumed.
+        hash_reader hasher(source, witness);
+        auto& inputs = mutable_inputs();
+        auto& outputs = mutable_outputs();
+        version_ = hasher.read_4_bytes_little_endian();
+
+        // A zero input count is presumed to be the marker, excluded from txid.
+        const auto presumed = hasher.peek_byte() == witness_marker;
+        auto marker = false;
+
+        if (presumed)
+        {
+            hasher.set_witness(true);
+            hasher.read_byte();
+
+            // Detect witness as no inputs (marker) and expected flag (bip144).
+            marker = hasher.peek_byte() == witness_flag;
+
+            // Skip over the peeked witness flag, otherwise there are no inputs.
+            if (marker)
+                hasher.read_byte();
+            else
+                inputs.clear();
+        }
+
+        hasher.set_witness(false);
 
-        // Detect witness as no inputs (marker) and expected flag (bip144).
-        const auto marker = inputs_.size() == witness_marker &&
-            source.peek_byte() == witness_flag;
+        if (!presumed || marker)
+            read(hasher, inputs, wire, witness, recycle, min_input_size);
+
+        read(hasher, outputs, wire, witness, recycle, min_output_size);
 
         // This is always enabled so caller should validate with is_segregated.
         if (marker)
         {
-            // Skip over the peeked witness flag.
-            source.skip(1);
-            read(source, inputs_, wire, witness);
-            read(source, outputs_, wire, witness);
-            read_witnesses(source, inputs_);
+            hasher.set_witness(true);
+
+            if (!witness)
+                skip_witnesses(hasher, inputs.size());
+            else if (lazy)
+                read_witnesses(hasher, inputs, lazy);
+            else
+                read_witnesses(hasher, inputs, recycle);
+
+            hasher.set_witness(false);
         }
-        else
+        else if (recycle)
         {
-            read(source, outputs_, wire, witness);
+            // The witnesses of recycled inputs are stale.
+            strip_witness();
         }
 
-        locktime_ = source.read_4_bytes_little_endian();
+        locktime_ = hasher.read_4_bytes_little_endian();
+
+        // A presumed marker without flag was wrongly excluded, hash lazily.
+        if (source && (marker || !presumed))
+        {
+            hash_.set(hasher.base_hash());
+
+            // Witness coinbase tx hash is assumed to be null_hash (bip141).
+            if (marker && witness)
+                witness_cache_->witness_hash.set(is_coinbase() ? null_hash :
+                    hasher.witness_hash());
+        }
     }
     else
     {
         // Database (outputs forward) serialization.
         // Witness data is managed internal to inputs.
-        read(source, outputs_, wire, witness);
-        read(source, inputs_, wire, witness);
+        read(source, mutable_outputs(), wire, witness, recycle);
+        read(source, mutable_inputs(), wire, witness, recycle);
         const auto locktime = source.read_variable_little_endian();
         const auto version = source.read_variable_little_endian();
 
@@ -339,7 +467,7 @@ bool transaction::from_data(reader& source, bool wire, bool witness)
         version_ = static_cast<uint32_t>(version);
     }
 
-    // TODO: optimize by having reader skip witness data.
+    // A wire witness is skipped, a store witness is read by the inputs.
     if (!witness)
         strip_witness();
 
@@ -355,7 +483,8 @@ bool transaction::from_data(reader& source, hash_digest&& hash, bool wire,
     if (!from_data(source, wire, witness))
         return false;
 
-    hash_ = std::make_shared<hash_digest>(std::move(hash));
+    hash_.reset();
+    hash_.set(std::move(hash));
     return true;
 }
 
@@ -365,7 +494,34 @@ bool transaction::from_data(reader& source, const hash_digest& hash, bool wire,
     if (!from_data(source, wire, witness))
         return false;
 
-    hash_ = std::make_shared<hash_digest>(hash);
+    hash_.reset();
+    hash_.set(hash);
+    return true;
+}
+
+bool transaction::from_data(encoding_ptr data, size_t offset, bool witness,
+    bool lazy)
+{
+    if (!data || offset > data->size())
+    {
+        reset();
+        return false;
+    }
+
+    const auto begin = data->data() + offset;
+    byte_reader source({ begin, data->data() + data->size() });
+
+    if (!decode(source, true, witness, false, lazy ? data : nullptr))
+        return false;
+
+    const auto size = (data->size() - offset) - source.remaining();
+
+    // The marker and flag follow the version when there is a witness.
+    const auto marker = size > sizeof(version_) + 1 &&
+        begin[sizeof(version_)] == witness_marker &&
+        begin[sizeof(version_) + 1] == witness_flag;
+
+    retained_ = retained{ data, offset, size, marker };
     return true;
 }
 
@@ -374,23 +530,41 @@ void transaction::reset()
 {
     version_ = 0;
     locktime_ = 0;
-    inputs_.clear();
-    inputs_.shrink_to_fit();
-    outputs_.clear();
-    outputs_.shrink_to_fit();
+    inputs_.reset();
+    outputs_.reset();
+    invalidate_cache();
+    segregated_.reset();
+    total_input_value_.reset();
+    total_output_value_.reset();
+}
+
+// private
+// Lists shared with a copy are released rather than detached, as the copy
+// must not change. Otherwise the lists and their elements are retained.
+void transaction::clear()
+{
+    if (inputs_.use_count() > 1)
+        inputs_.reset();
+
+    if (outputs_.use_count() > 1)
+        outputs_.reset();
+
+    version_ = 0;
+    locktime_ = 0;
     invalidate_cache();
-    outputs_hash_.reset();
-    inpoints_hash_.reset();
-    sequences_hash_.reset();
-    segregated_ = boost::none;
-    total_input_value_ = boost::none;
-    total_output_value_ = boost::none;
+    segregated_.reset();
+    total_input_value_.reset();
+    total_output_value_.reset();
+
+    // Metadata of a recycled transaction is stale, but its storage is kept.
+    if (metadata)
+        metadata = validation{};
 }
 
 bool transaction::is_valid() const
 {
-    return (version_ != 0) || (locktime_ != 0) || !inputs_.empty() ||
-        !outputs_.empty();
+    return (version_ != 0) || (locktime_ != 0) || !inputs().empty() ||
+        !outputs().empty();
 }
 
 // Serialization.
@@ -410,9 +584,8 @@ data_chunk transaction::to_data(bool wire, bool witness) const
     // generate_signature_hash extension by addition of the sighash_type.
     data.reserve(size + sizeof(uint8_t));
 
-    data_sink ostream(data);
-    to_data(ostream, wire, witness);
-    ostream.flush();
+    byte_writer sink(data);
+    to_data(sink, wire, witness);
     BITCOIN_ASSERT(data.size() == size);
     return data;
 }
@@ -434,6 +607,12 @@ void transaction::to_data(writer& sink, bool wire, bool witness) const
         // Witness handling must be disabled for non-segregated txs.
         witness &= is_segregated();
 
+        if (is_retained(witness))
+        {
+            sink.write_bytes(encoding());
+            return;
+        }
+
         // Wire (satoshi protocol) serialization.
         sink.write_4_bytes_little_endian(version_);
 
@@ -441,14 +620,14 @@ void transaction::to_data(writer& sink, bool wire, bool witness) const
         {
             sink.write_byte(witness_marker);
             sink.write_byte(witness_flag);
-            write(sink, inputs_, wire, witness);
-            write(sink, outputs_, wire, witness);
-            write_witnesses(sink, inputs_);
+            write(sink, inputs(), wire, witness);
+            write(sink, outputs(), wire, witness);
+            write_witnesses(sink, inputs());
         }
         else
         {
-            write(sink, inputs_, wire, witness);
-            write(sink, outputs_, wire, witness);
+            write(sink, inputs(), wire, witness);
+            write(sink, outputs(), wire, witness);
         }
 
         sink.write_4_bytes_little_endian(locktime_);
@@ -457,8 +636,8 @@ void transaction::to_data(writer& sink, bool wire, bool witness) const
     {
         // Database (outputs forward) serialization.
         // Witness data is managed internal to inputs.
-        write(sink, outputs_, wire, witness);
-        write(sink, inputs_, wire, witness);
+        write(sink, outputs(), wire, witness);
+        write(sink, inputs(), wire, witness);
         sink.write_variable_little_endian(locktime_);
         sink.write_variable_little_endian(version_);
     }
@@ -486,6 +665,76 @@ size_t transaction::serialized_size(bool wire, bool witness) const
     // The witness parameter must be set to false for non-segregated txs.
     witness &= is_segregated();
 
+    // Only the wire sizes are cached, as these are used for weight and fees.
+    if (!wire)
+        return compute_size(wire, witness);
+
+    if (is_retained(witness))
+        return retained_.peek()->size;
+
+    if (witness)
+        return total_size_.get([this]()
+        {
+            return compute_size(true, true);
+        });
+
+    return base_size_.get([this]()
+    {
+        return compute_size(true, false);
+    });
+}
+
+size_t transaction::heap_size() const
+{
+    auto size = inputs().capacity() * sizeof(input) +
+        outputs().capacity() * sizeof(output);
+
+    for (const auto& input: inputs())
+        size += input.heap_size();
+
+    for (const auto& output: outputs())
+        size += output.heap_size();
+
+    const auto cache = witness_cache_.peek();
+    const auto precompute = cache == nullptr ? nullptr :
+        cache->sighash_precompute.peek();
+
+    if (cache != nullptr)
+        size += sizeof(witness_cache);
+
+    if (precompute != nullptr && *precompute)
+    {
+        const auto& value = **precompute;
+        size += sizeof(sighash_precompute) + value.blanks.capacity() +
+            value.suffix.capacity() +
+            value.prefixes.capacity() * sizeof(SHA256CTX);
+    }
+
+    return size;
+}
+
+data_slice transaction::encoding() const
+{
+    const auto value = retained_.peek();
+
+    if (value == nullptr)
+        return data_slice(nullptr, nullptr);
+
+    const auto begin = value->data->data() + value->offset;
+    return data_slice(begin, begin + value->size);
+}
+
+// The encoding includes a witness or not, and a stripped witness is not read.
+bool transaction::is_retained(bool witness) const
+{
+    const auto value = retained_.peek();
+    return value != nullptr && value->witness == (witness && is_segregated());
+}
+
+// protected
+size_t transaction::compute_size(bool wire, bool witness) const
+{
+
     // Returns space for the witness although not serialized by input.
     // Returns witness space if specified even if input not segregated.
     const auto ins = [wire, witness](size_t size, const input& input)
@@ -503,10 +752,10 @@ size_t transaction::serialized_size(bool wire, bool witness) const
         + (wire && witness ? sizeof(witness_flag) : 0)
         + (wire ? sizeof(version_) : message::variable_uint_size(version_))
         + (wire ? sizeof(locktime_) : message::variable_uint_size(locktime_))
-        + message::variable_uint_size(inputs_.size())
-        + message::variable_uint_size(outputs_.size())
-        + std::accumulate(inputs_.begin(), inputs_.end(), size_t{0}, ins)
-        + std::accumulate(outputs_.begin(), outputs_.end(), size_t{0}, outs);
+        + message::variable_uint_size(inputs().size())
+        + message::variable_uint_size(outputs().size())
+        + std::accumulate(inputs().begin(), inputs().end(), size_t{0}, ins)
+        + std::accumulate(outputs().begin(), outputs().end(), size_t{0}, outs);
 }
 
 // Accessors.
@@ -536,79 +785,97 @@ void transaction::set_locktime(uint32_t value)
 
 input::list& transaction::inputs()
 {
-    return inputs_;
+    return mutable_inputs();
 }
 
 const input::list& transaction::inputs() const
 {
-    return inputs_;
+    static const input::list empty;
+    return inputs_ ? *inputs_ : empty;
 }
 
 void transaction::set_inputs(const input::list& value)
 {
-    inputs_ = value;
+    inputs_ = share(value);
     invalidate_cache();
-    inpoints_hash_.reset();
-    sequences_hash_.reset();
-    segregated_ = boost::none;
-    total_input_value_ = boost::none;
+    segregated_.reset();
+    total_input_value_.reset();
 }
 
 void transaction::set_inputs(input::list&& value)
 {
-    inputs_ = std::move(value);
+    inputs_ = share(std::move(value));
     invalidate_cache();
-    segregated_ = boost::none;
-    total_input_value_ = boost::none;
+    segregated_.reset();
+    total_input_value_.reset();
 }
 
 output::list& transaction::outputs()
 {
-    return outputs_;
+    return mutable_outputs();
 }
 
 const output::list& transaction::outputs() const
 {
-    return outputs_;
+    static const output::list empty;
+    return outputs_ ? *outputs_ : empty;
 }
 
 void transaction::set_outputs(const output::list& value)
 {
-    outputs_ = value;
+    outputs_ = share(value);
     invalidate_cache();
-    outputs_hash_.reset();
-    total_output_value_ = boost::none;
+    total_output_value_.reset();
 }
 
 void transaction::set_outputs(output::list&& value)
 {
-    outputs_ = std::move(value);
+    outputs_ = share(std::move(value));
     invalidate_cache();
-    total_output_value_ = boost::none;
+    total_output_value_.reset();
+}
+
+// private
+// Detach the inputs from copies before modification.
+input::list& transaction::mutable_inputs()
+{
+    retained_.reset();
+
+    if (!inputs_)
+        inputs_ = std::make_shared<input::list>();
+    else if (inputs_.use_count() > 1)
+        inputs_ = std::make_shared<input::list>(*inputs_);
+
+    return *inputs_;
+}
+
+// private
+// Detach the outputs from copies before modification.
+output::list& transaction::mutable_outputs()
+{
+    retained_.reset();
+
+    if (!outputs_)
+        outputs_ = std::make_shared<output::list>();
+    else if (outputs_.use_count() > 1)
+        outputs_ = std::make_shared<output::list>(*outputs_);
+
+    return *outputs_;
 }
 
 // Cache.
 //-----------------------------------------------------------------------------
 
 // protected
+// The witness cache and retained encoding are released, as any change
+// invalidates some of them.
 void transaction::invalidate_cache() const
 {
-    ///////////////////////////////////////////////////////////////////////////
-    // Critical Section
-    hash_mutex_.lock_upgrade();
-
-    if (hash_ || witness_hash_)
-    {
-        hash_mutex_.unlock_upgrade_and_lock();
-        //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-        hash_.reset();
-        witness_hash_.reset();
-        //---------------------------------------------------------------------
-        hash_mutex_.unlock_and_lock_upgrade();
-    }
-
-    hash_mutex_.unlock_upgrade();
-    ///////////////////////////////////////////////////////////////////////////
+    hash_.reset();
+    base_size_.reset();
+    total_size_.reset();
+    witness_cache_.reset();
+    retained_.reset();
 }
 
 hash_digest transaction::hash(bool witness) const
@@ -616,111 +883,62 @@ hash_digest transaction::hash(bool witness) const
     // Witness hashing must be disabled for non-segregated txs.
     witness &= is_segregated();
 
-    ///////////////////////////////////////////////////////////////////////////
-    // Critical Section
-    hash_mutex_.lock_upgrade();
-
+    // Witness coinbase tx hash is assumed to be null_hash (bip141).
     if (witness)
-    {
-        if (!witness_hash_)
+        return witness_cache_->witness_hash.get([this]()
         {
-            //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-            hash_mutex_.unlock_upgrade_and_lock();
+            if (is_coinbase())
+                return null_hash;
 
-            // Witness coinbase tx hash is assumed to be null_hash (bip141).
-            witness_hash_ = std::make_shared<hash_digest>(
-                is_coinbase() ? null_hash : bitcoin_hash(to_data(true, true)));
+            if (is_retained(true))
+                return bitcoin_hash(encoding());
 
-            hash_mutex_.unlock_and_lock_upgrade();
-            //-----------------------------------------------------------------
-        }
-    }
-    else
-    {
-        if (!hash_)
-        {
-            //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-            hash_mutex_.unlock_upgrade_and_lock();
-            hash_ = std::make_shared<hash_digest>(bitcoin_hash(to_data(true)));
-            hash_mutex_.unlock_and_lock_upgrade();
-            //-----------------------------------------------------------------
-        }
-    }
+            context_writer sink;
+            to_data(sink, true, true);
+            return sink.bitcoin_digest();
+        });
 
-    const auto hash = witness ? *witness_hash_ : *hash_;
-    hash_mutex_.unlock_upgrade();
-    ///////////////////////////////////////////////////////////////////////////
+    return hash_.get([this]()
+    {
+        if (is_retained(false))
+            return bitcoin_hash(encoding());
 
-    return hash;
+        context_writer sink;
+        to_data(sink, true, false);
+        return sink.bitcoin_digest();
+    });
 }
 
 hash_digest transaction::outputs_hash() const
 {
-    ///////////////////////////////////////////////////////////////////////////
-    // Critical Section
-    hash_mutex_.lock_upgrade();
-
-    if (!outputs_hash_)
+    return witness_cache_->outputs_hash.get([this]()
     {
-        //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-        hash_mutex_.unlock_upgrade_and_lock();
-        outputs_hash_ = std::make_shared<hash_digest>(
-            script::to_outputs(*this));
-        hash_mutex_.unlock_and_lock_upgrade();
-        //-----------------------------------------------------------------
-    }
-
-    const auto hash = *outputs_hash_;
-    hash_mutex_.unlock_upgrade();
-    ///////////////////////////////////////////////////////////////////////////
-
-    return hash;
+        return script::to_outputs(*this);
+    });
 }
 
 hash_digest transaction::inpoints_hash() const
 {
-    ///////////////////////////////////////////////////////////////////////////
-    // Critical Section
-    hash_mutex_.lock_upgrade();
-
-    if (!inpoints_hash_)
+    return witness_cache_->inpoints_hash.get([this]()
     {
-        //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-        hash_mutex_.unlock_upgrade_and_lock();
-        inpoints_hash_ = std::make_shared<hash_digest>(
-            script::to_inpoints(*this));
-        hash_mutex_.unlock_and_lock_upgrade();
-        //-----------------------------------------------------------------
-    }
-
-    const auto hash = *inpoints_hash_;
-    hash_mutex_.unlock_upgrade();
-    ///////////////////////////////////////////////////////////////////////////
-
-    return hash;
+        return script::to_inpoints(*this);
+    });
 }
 
 hash_digest transaction::sequences_hash() const
 {
-    ///////////////////////////////////////////////////////////////////////////
-    // Critical Section
-    hash_mutex_.lock_upgrade();
-
-    if (!sequences_hash_)
+    return witness_cache_->sequences_hash.get([this]()
     {
-        //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-        hash_mutex_.unlock_upgrade_and_lock();
-        sequences_hash_ = std::make_shared<hash_digest>(
-            script::to_sequences(*this));
-        hash_mutex_.unlock_and_lock_upgrade();
-        //-----------------------------------------------------------------
-    }
-
-    const auto hash = *sequences_hash_;
-    hash_mutex_.unlock_upgrade();
-    ///////////////////////////////////////////////////////////////////////////
+        return script::to_sequences(*this);
+    });
+}
 
-    return hash;
+transaction::sighash_precompute_ptr transaction::sighash_precomputation() const
+{
+    return witness_cache_->sighash_precompute.get([this]()
+    {
+        return std::make_shared<const sighash_precompute>(*this);
+    });
 }
 
 // Utilities.
@@ -729,18 +947,32 @@ hash_digest transaction::sequences_hash() const
 // Clear witness from all inputs (does not change default transaction hash).
 void transaction::strip_witness()
 {
+    const auto witnessed = [](const input& input)
+    {
+        return input.witness().is_valid();
+    };
+
     const auto strip = [](input& input)
     {
         input.strip_witness();
     };
 
-    ///////////////////////////////////////////////////////////////////////////
-    // Critical Section
-    unique_lock lock(mutex_);
+    segregated_.reset();
+    segregated_.set(false);
+    total_size_.reset();
+
+    // The retained encoding of a witness no longer serializes the inputs.
+    const auto value = retained_.peek();
+    if (value != nullptr && value->witness)
+        retained_.reset();
+
+    // Avoid detaching shared inputs that have no witness to strip.
+    const auto& ins = static_cast<const transaction&>(*this).inputs();
+    if (!std::any_of(ins.begin(), ins.end(), witnessed))
+        return;
 
-    segregated_ = false;
-    std::for_each(inputs_.begin(), inputs_.end(), strip);
-    ///////////////////////////////////////////////////////////////////////////
+    auto& inputs = mutable_inputs();
+    std::for_each(inputs.begin(), inputs.end(), strip);
 }
 
 // Validation helpers.
@@ -748,7 +980,8 @@ void transaction::strip_witness()
 
 bool transaction::is_coinbase() const
 {
-    return inputs_.size() == 1 && inputs_.front().previous_output().is_null();
+    const auto& ins = inputs();
+    return ins.size() == 1 && ins.front().previous_output().is_null();
 }
 
 // True if coinbase and has invalid input[0] script size.
@@ -757,7 +990,7 @@ bool transaction::is_oversized_coinbase() const
     if (!is_coinbase())
         return false;
 
-    const auto script_size = inputs_.front().script().serialized_size(false);
+    const auto script_size = inputs().front().script().serialized_size(false);
     return script_size < min_coinbase_size || script_size > max_coinbase_size;
 }
 
@@ -772,7 +1005,7 @@ bool transaction::is_null_non_coinbase() const
         return input.previous_output().is_null();
     };
 
-    return std::any_of(inputs_.begin(), inputs_.end(), invalid);
+    return std::any_of(inputs().begin(), inputs().end(), invalid);
 }
 
 // private
@@ -783,7 +1016,7 @@ bool transaction::all_inputs_final() const
         return input.is_final();
     };
 
-    return std::all_of(inputs_.begin(), inputs_.end(), finalized);
+    return std::all_of(inputs().begin(), inputs().end(), finalized);
 }
 
 bool transaction::is_final(size_t block_height, uint32_t block_time) const
@@ -809,7 +1042,7 @@ bool transaction::is_locked(size_t block_height,
     };
 
     // If any input is relative time locked the transaction is as well.
-    return std::any_of(inputs_.begin(), inputs_.end(), locked);
+    return std::any_of(inputs().begin(), inputs().end(), locked);
 }
 
 // This is not a consensus rule, just detection of an irrational use.
@@ -821,78 +1054,95 @@ bool transaction::is_locktime_conflict() const
 // Returns max_uint64 in case of overflow.
 uint64_t transaction::total_input_value() const
 {
-    uint64_t value;
-
-    ///////////////////////////////////////////////////////////////////////////
-    // Critical Section
-    mutex_.lock_upgrade();
-
-    if (total_input_value_ != boost::none)
+    return total_input_value_.get([this]()
     {
-        value = total_input_value_.get();
-        mutex_.unlock_upgrade();
-        //---------------------------------------------------------------------
-        return value;
-    }
+        ////static_assert(max_money() < max_uint64, "overflow sentinel");
+        const auto sum = [](uint64_t total, const input& input)
+        {
+            const auto& prevout = input.previous_output().cached_output();
+            const auto missing = !prevout.is_valid();
 
-    mutex_.unlock_upgrade_and_lock();
-    //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+            // Treat missing previous outputs as zero, no math on sentinel.
+            return ceiling_add(total, missing ? 0 : prevout.value());
+        };
 
-    ////static_assert(max_money() < max_uint64, "overflow sentinel invalid");
-    const auto sum = [](uint64_t total, const input& input)
-    {
-        const auto& prevout = input.previous_output().metadata.cache;
-        const auto missing = !prevout.is_valid();
+        return std::accumulate(inputs().begin(), inputs().end(), uint64_t(0),
+            sum);
+    });
+}
 
-        // Treat missing previous outputs as zero-valued, no math on sentinel.
-        return ceiling_add(total, missing ? 0 : prevout.value());
-    };
+// Returns max_uint64 in case of overflow.
+uint64_t transaction::total_output_value() const
+{
+    return total_output_value_.get([this]()
+    {
+        ////static_assert(max_money() < max_uint64, "overflow sentinel");
+        const auto sum = [](uint64_t total, const output& output)
+        {
+            return ceiling_add(total, output.value());
+        };
 
-    value = std::accumulate(inputs_.begin(), inputs_.end(), uint64_t(0), sum);
-    total_input_value_ = value;
-    mutex_.unlock();
-    ///////////////////////////////////////////////////////////////////////////
+        return std::accumulate(outputs().begin(), outputs().end(), uint64_t(0),
+            sum);
+    });
+}
 
-    return value;
+uint64_t transaction::fees() const
+{
+    return floor_subtract(total_input_value(), total_output_value());
 }
 
-// Returns max_uint64 in case of overflow.
-uint64_t transaction::total_output_value() const
+// The set element of an unspent output, reusing the buffer.
+static void utxo_element(data_chunk& out, const output_point& outpoint,
+    size_t height, bool coinbase, const output& prevout)
 {
-    uint64_t value;
+    const auto code = static_cast<uint32_t>(height << 1) | (coinbase ? 1 : 0);
+    out.clear();
+    out.reserve(point::satoshi_fixed_size() + sizeof(uint32_t) +
+        prevout.serialized_size());
 
-    ///////////////////////////////////////////////////////////////////////////
-    // Critical Section
-    mutex_.lock_upgrade();
+    byte_writer sink(out);
+    outpoint.to_data(sink);
+    sink.write_4_bytes_little_endian(code);
+    prevout.to_data(sink);
+}
 
-    if (total_output_value_ != boost::none)
+void transaction::utxo_delta(muhash& set, size_t height) const
+{
+    data_chunk element;
+    const auto coinbase = is_coinbase();
+
+    if (!coinbase)
     {
-        value = total_output_value_.get();
-        mutex_.unlock_upgrade();
-        //---------------------------------------------------------------------
-        return value;
+        // Unpopulated metadata is not allocated by the query.
+        const output_point::validation unpopulated{};
+
+        for (const auto& input: inputs())
+        {
+            const auto& prevout = input.previous_output();
+            const auto populated = prevout.metadata.peek();
+            const auto& metadata = populated == nullptr ? unpopulated :
+                *populated;
+            utxo_element(element, prevout, metadata.height, metadata.coinbase,
+                metadata.cache);
+            set.remove(element);
+        }
     }
 
-    mutex_.unlock_upgrade_and_lock();
-    //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    const auto tx_hash = hash();
+    const auto& outs = outputs();
 
-    ////static_assert(max_money() < max_uint64, "overflow sentinel invalid");
-    const auto sum = [](uint64_t total, const output& output)
+    for (uint32_t index = 0; index < outs.size(); ++index)
     {
-        return ceiling_add(total, output.value());
-    };
-
-    value = std::accumulate(outputs_.begin(), outputs_.end(), uint64_t(0), sum);
-    total_output_value_ = value;
-    mutex_.unlock();
-    ///////////////////////////////////////////////////////////////////////////
+        const auto& output = outs[index];
 
-    return value;
-}
+        // Unspendable outputs are never added to the UTXO set.
+        if (output.script().is_unspendable())
+            continue;
 
-uint64_t transaction::fees() const
-{
-    return floor_subtract(total_input_value(), total_output_value());
+        utxo_element(element, { tx_hash, index }, height, coinbase, output);
+        set.insert(element);
+    }
 }
 
 bool transaction::is_overspent() const
@@ -903,10 +1153,14 @@ bool transaction::is_overspent() const
 // Returns max_size_t in case of overflow.
 size_t transaction::signature_operations() const
 {
-    const auto state = metadata.state;
+    const auto state = populated_state(*this);
+
+    if (!state)
+        return max_size_t;
+
     const auto bip16 = state->is_enabled(rule_fork::bip16_rule);
     const auto bip141 = state->is_enabled(rule_fork::bip141_rule);
-    return state ? signature_operations(bip16, bip141) : max_size_t;
+    return signature_operations(bip16, bip141);
 }
 
 // Returns max_size_t in case of overflow.
@@ -923,8 +1177,8 @@ size_t transaction::signature_operations(bool bip16, bool bip141) const
         return ceiling_add(total, output.signature_operations(bip141));
     };
 
-    return std::accumulate(inputs_.begin(), inputs_.end(), size_t{0}, in) +
-        std::accumulate(outputs_.begin(), outputs_.end(), size_t{0}, out);
+    return std::accumulate(inputs().begin(), inputs().end(), size_t{0}, in) +
+        std::accumulate(outputs().begin(), outputs().end(), size_t{0}, out);
 }
 
 size_t transaction::weight() const
@@ -934,30 +1188,50 @@ size_t transaction::weight() const
         total_size_contribution * serialized_size(true, true);
 }
 
+size_t transaction::virtual_size() const
+{
+    static BC_CONSTEXPR auto contribution = base_size_contribution +
+        total_size_contribution;
+
+    return (weight() + contribution - 1) / contribution;
+}
+
+// Returns max_uint64 in case of overflow.
+uint64_t transaction::fee_rate() const
+{
+    static BC_CONSTEXPR uint64_t kilobyte = 1000;
+    const auto fee = fees();
+
+    if (fee > max_uint64 / kilobyte)
+        return max_uint64;
+
+    return fee * kilobyte / virtual_size();
+}
+
 bool transaction::is_missing_previous_outputs() const
 {
     const auto missing = [](const input& input)
     {
         const auto& prevout = input.previous_output();
         const auto coinbase = prevout.is_null();
-        const auto missing = !prevout.metadata.cache.is_valid();
+        const auto missing = !prevout.cached_output().is_valid();
         return missing && !coinbase;
     };
 
     // This is an optimization of !missing_inputs().empty();
-    return std::any_of(inputs_.begin(), inputs_.end(), missing);
+    return std::any_of(inputs().begin(), inputs().end(), missing);
 }
 
 point::list transaction::previous_outputs() const
 {
     point::list prevouts;
-    prevouts.reserve(inputs_.size());
+    prevouts.reserve(inputs().size());
     const auto pointer = [&prevouts](const input& input)
     {
         prevouts.push_back(input.previous_output());
     };
 
-    const auto& ins = inputs_;
+    const auto& ins = inputs();
     std::for_each(ins.begin(), ins.end(), pointer);
     return prevouts;
 }
@@ -965,17 +1239,17 @@ point::list transaction::previous_outputs() const
 point::list transaction::missing_previous_outputs() const
 {
     point::list prevouts;
-    prevouts.reserve(inputs_.size());
+    prevouts.reserve(inputs().size());
     const auto accumulator = [&prevouts](const input& input)
     {
         const auto& prevout = input.previous_output();
-        const auto missing = !prevout.metadata.cache.is_valid();
+        const auto missing = !prevout.cached_output().is_valid();
 
         if (missing && !prevout.is_null())
             prevouts.push_back(prevout);
     };
 
-    std::for_each(inputs_.begin(), inputs_.end(), accumulator);
+    std::for_each(inputs().begin(), inputs().end(), accumulator);
     prevouts.shrink_to_fit();
     return prevouts;
 }
@@ -1007,10 +1281,12 @@ bool transaction::is_confirmed_double_spend() const
 {
     const auto spent = [](const input& input)
     {
-        return input.previous_output().metadata.spent;
+        // Unpopulated metadata is not allocated by the query.
+        const auto prevout = input.previous_output().metadata.peek();
+        return prevout != nullptr && prevout->spent;
     };
 
-    return std::any_of(inputs_.begin(), inputs_.end(), spent);
+    return std::any_of(inputs().begin(), inputs().end(), spent);
 }
 
 bool transaction::is_dusty(uint64_t minimum_output_value) const
@@ -1020,7 +1296,7 @@ bool transaction::is_dusty(uint64_t minimum_output_value) const
         return output.is_dust(minimum_output_value);
     };
 
-    return std::any_of(outputs_.begin(), outputs_.end(), dust);
+    return std::any_of(outputs().begin(), outputs().end(), dust);
 }
 
 bool transaction::is_mature(size_t height) const
@@ -1030,52 +1306,44 @@ bool transaction::is_mature(size_t height) const
         return input.previous_output().is_mature(height);
     };
 
-    return std::all_of(inputs_.begin(), inputs_.end(), mature);
+    return std::all_of(inputs().begin(), inputs().end(), mature);
 }
 
 bool transaction::is_segregated() const
 {
-    bool value;
-
-    ///////////////////////////////////////////////////////////////////////////
-    // Critical Section
-    mutex_.lock_upgrade();
-
-    if (segregated_ != boost::none)
+    return segregated_.get([this]()
     {
-        value = segregated_.get();
-        mutex_.unlock_upgrade();
-        //---------------------------------------------------------------------
-        return value;
-    }
-
-    mutex_.unlock_upgrade_and_lock();
-    //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-
-    const auto segregated = [](const input& input)
-    {
-        return input.is_segregated();
-    };
-
-    // If no block tx is has witness data the commitment is optional (bip141).
-    value = std::any_of(inputs_.begin(), inputs_.end(), segregated);
-    mutex_.unlock();
-    ///////////////////////////////////////////////////////////////////////////
+        const auto segregated = [](const input& input)
+        {
+            return input.is_segregated();
+        };
 
-    return value;
+        // If no block tx has witness data the commitment is optional (bip141).
+        return std::any_of(inputs().begin(), inputs().end(), segregated);
+    });
 }
 
 // Coinbase transactions return success, to simplify iteration.
 code transaction::connect_input(const chain_state& state,
     size_t input_index) const
 {
-    if (input_index >= inputs_.size())
+    verification_context context;
+    return connect_input(state, input_index, context);
+}
+
+// Coinbase transactions return success, to simplify iteration.
+code transaction::connect_input(const chain_state& state,
+    size_t input_index, verification_context& context) const
+{
+    BC_TRACE_SPAN("script", "connect_input");
+
+    if (input_index >= inputs().size())
         return error::operation_failed;
 
     if (is_coinbase())
         return error::success;
 
-    const auto& prevout = inputs_[input_index].previous_output().metadata;
+    const auto& prevout = *inputs()[input_index].previous_output().metadata;
 
     // Verify that the previous output cache has been populated.
     if (!prevout.cache.is_valid())
@@ -1083,9 +1351,30 @@ code transaction::connect_input(const chain_state& state,
 
     const auto forks = state.enabled_forks();
     const auto index32 = static_cast<uint32_t>(input_index);
+    auto& cache = verified_inputs();
 
     // Verify the transaction input script against the previous output.
-    return script::verify(*this, index32, forks);
+    if (!cache.enabled())
+        return script::verify(*this, index32, forks, context);
+
+    // The witness hash commits to the previous output and all scripts.
+    const auto witness_hash = hash(true);
+    if (cache.contains(witness_hash, index32, forks))
+        return error::success;
+
+    const auto ec = script::verify(*this, index32, forks, context);
+
+    if (!ec)
+        cache.insert(witness_hash, index32, forks);
+
+    return ec;
+}
+
+// static
+script_cache& transaction::verified_inputs()
+{
+    static script_cache cache;
+    return cache;
 }
 
 // Validation.
@@ -1094,7 +1383,7 @@ code transaction::connect_input(const chain_state& state,
 // These checks are self-contained; blockchain (and so version) independent.
 code transaction::check(uint64_t max_money, bool transaction_pool) const
 {
-    if (inputs_.empty() || outputs_.empty())
+    if (inputs().empty() || outputs().empty())
         return error::empty_transaction;
 
     else if (is_null_non_coinbase())
@@ -1132,7 +1421,7 @@ code transaction::check(uint64_t max_money, bool transaction_pool) const
 
 code transaction::accept(bool transaction_pool) const
 {
-    const auto state = metadata.state;
+    const auto state = populated_state(*this);
     return state ? accept(*state, transaction_pool) : error::operation_failed;
 }
 
@@ -1163,7 +1452,7 @@ code transaction::accept(const chain_state& state, bool transaction_pool) const
     //// An unconfirmed transaction hash that exists in the chain is not accepted
     //// even if the original is spent in the new block. This is not necessary
     //// nor is it described by BIP30, but it is in the code referenced by BIP30.
-    //else if (bip30 && metadata.existed)
+    //else if (bip30 && metadata->existed)
     //    return error::unspent_duplicate;
 
     else if (is_missing_previous_outputs())
@@ -1187,7 +1476,6 @@ code transaction::accept(const chain_state& state, bool transaction_pool) const
     else if (transaction_pool && signature_operations(bip16, bip141) > max_sigops)
         return error::transaction_embedded_sigop_limit;
 
-    // This causes second serialized_size(true, false) computation (uncached).
     // TODO: reduce by header, txcount and smallest coinbase size for height.
     else if (transaction_pool && bip141 && weight() > max_block_weight)
         return error::transaction_weight_limit;
@@ -1198,16 +1486,18 @@ code transaction::accept(const chain_state& state, bool transaction_pool) const
 
 code transaction::connect() const
 {
-    const auto state = metadata.state;
+    const auto state = populated_state(*this);
     return state ? connect(*state) : error::operation_failed;
 }
 
 code transaction::connect(const chain_state& state) const
 {
     code ec;
+    verification_context context;
 
-    for (size_t input = 0; input < inputs_.size(); ++input)
-        if ((ec = connect_input(state, input)))
+    // Program stack capacity is retained across the inputs.
+    for (size_t input = 0; input < inputs().size(); ++input)
+        if ((ec = connect_input(state, input, context)))
             return ec;
 
     return error::success;
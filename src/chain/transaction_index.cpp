@@ -0,0 +1,703 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/chain/transaction_index.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <memory>
+#include <vector>
+#include <boost/filesystem.hpp>
+#include <boost/system/error_code.hpp>
+#include <bitcoin/bitcoin/chain/block.hpp>
+#include <bitcoin/bitcoin/chain/header.hpp>
+#include <bitcoin/bitcoin/chain/transaction.hpp>
+#include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/message/messages.hpp>
+#include <bitcoin/bitcoin/utility/assert.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/endian.hpp>
+#include <bitcoin/bitcoin/utility/parallel.hpp>
+#include <bitcoin/bitcoin/utility/thread.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+// The average number of hashes in a bucket, and the percentage of slots that
+// are occupied before remapping. Pilots are sought in order and a partition
+// is rebuilt with the next seed upon reaching the pilot limit.
+static const size_t bucket_target = 4;
+static const size_t slot_load = 97;
+static const uint32_t pilot_limit = 1u << 20;
+static const uint32_t seed_limit = 16;
+
+// Record field offsets.
+static const size_t offset_offset = hash_size;
+static const size_t file_offset = offset_offset + sizeof(uint64_t);
+static const size_t length_offset = file_offset + sizeof(uint32_t);
+
+// The hash words that select the partition, bucket and slot.
+static const size_t partition_word = 3;
+static const size_t bucket_word = 0;
+static const size_t slot_word = 1;
+
+typedef std::vector<const transaction_index::entry*> entry_pointers;
+
+// A built partition, its records in slot order.
+struct built_partition
+{
+    uint32_t seed;
+    std::vector<uint32_t> pilots;
+    std::vector<uint32_t> remaps;
+    entry_pointers records;
+};
+
+// The splitmix64 finalizer, as hashes are uniform only by construction.
+static uint64_t mix(uint64_t value)
+{
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111eb;
+    return value ^ (value >> 31);
+}
+
+static uint64_t word(const hash_digest& hash, size_t index)
+{
+    return from_little_endian_unsafe<uint64_t>(hash.begin() +
+        index * sizeof(uint64_t));
+}
+
+static size_t partition_of(const hash_digest& hash, size_t partitions)
+{
+    return static_cast<size_t>(word(hash, partition_word) % partitions);
+}
+
+static size_t bucket_of(const hash_digest& hash, uint32_t seed,
+    uint32_t buckets)
+{
+    return static_cast<size_t>(mix(word(hash, bucket_word) ^ seed) %
+        buckets);
+}
+
+static size_t slot_of(const hash_digest& hash, uint32_t seed, uint32_t pilot,
+    uint32_t slots)
+{
+    return static_cast<size_t>(mix(word(hash, slot_word) ^ seed ^
+        mix(pilot)) % slots);
+}
+
+static uint32_t buckets_of(size_t count)
+{
+    return static_cast<uint32_t>(count == 0 ? 0 :
+        (count + bucket_target - 1) / bucket_target);
+}
+
+static uint32_t slots_of(size_t count)
+{
+    return static_cast<uint32_t>((count * 100 + slot_load - 1) / slot_load);
+}
+
+// Storage.
+//-----------------------------------------------------------------------------
+
+// Place the hashes with the seed, false if a bucket exhausts the pilots.
+static bool place(built_partition& out, const entry_pointers& entries,
+    uint32_t seed)
+{
+    const auto count = entries.size();
+    const auto buckets = buckets_of(count);
+    const auto slots = slots_of(count);
+
+    // Order the entries by bucket.
+    std::vector<size_t> bucket_start(buckets + 1, 0);
+    std::vector<size_t> bucket_index(count);
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        bucket_index[index] = bucket_of(entries[index]->hash, seed, buckets);
+        ++bucket_start[bucket_index[index] + 1];
+    }
+
+    for (size_t bucket = 0; bucket < buckets; ++bucket)
+        bucket_start[bucket + 1] += bucket_start[bucket];
+
+    entry_pointers ordered(count);
+    auto next = bucket_start;
+
+    for (size_t index = 0; index < count; ++index)
+        ordered[next[bucket_index[index]]++] = entries[index];
+
+    // Larger buckets are placed first, while most slots are free.
+    std::vector<uint32_t> order(buckets);
+
+    for (uint32_t bucket = 0; bucket < buckets; ++bucket)
+        order[bucket] = bucket;
+
+    std::stable_sort(order.begin(), order.end(),
+        [&bucket_start](uint32_t left, uint32_t right)
+        {
+            return bucket_start[left + 1] - bucket_start[left] >
+                bucket_start[right + 1] - bucket_start[right];
+        });
+
+    out.seed = seed;
+    out.pilots.assign(buckets, 0);
+    out.records.assign(slots, nullptr);
+    std::vector<size_t> placed_slots;
+
+    for (const auto bucket: order)
+    {
+        const auto begin = ordered.begin() + bucket_start[bucket];
+        const auto end = ordered.begin() + bucket_start[bucket + 1];
+        uint32_t pilot = 0;
+
+        for (; pilot < pilot_limit; ++pilot)
+        {
+            placed_slots.clear();
+
+            for (auto it = begin; it != end; ++it)
+            {
+                const auto slot = slot_of((*it)->hash, seed, pilot, slots);
+
+                if (out.records[slot] != nullptr)
+                    break;
+
+                out.records[slot] = *it;
+                placed_slots.push_back(slot);
+            }
+
+            if (placed_slots.size() == static_cast<size_t>(end - begin))
+                break;
+
+            for (const auto slot: placed_slots)
+                out.records[slot] = nullptr;
+        }
+
+        if (pilot == pilot_limit)
+            return false;
+
+        out.pilots[bucket] = pilot;
+    }
+
+    // Move the records of slots beyond the count to the free slots below it.
+    out.remaps.assign(slots - count, 0);
+    size_t free = 0;
+
+    for (auto slot = count; slot < slots; ++slot)
+    {
+        if (out.records[slot] == nullptr)
+            continue;
+
+        while (out.records[free] != nullptr)
+            ++free;
+
+        out.remaps[slot - count] = static_cast<uint32_t>(free);
+        out.records[free] = out.records[slot];
+    }
+
+    out.records.resize(count);
+    return true;
+}
+
+static code build(built_partition& out, entry_pointers& entries)
+{
+    // Keep the first of entries of the same hash, as entries are pointers
+    // into a single list.
+    std::sort(entries.begin(), entries.end(),
+        [](const transaction_index::entry* left,
+            const transaction_index::entry* right)
+        {
+            return left->hash < right->hash ||
+                (left->hash == right->hash && left < right);
+        });
+
+    entries.erase(std::unique(entries.begin(), entries.end(),
+        [](const transaction_index::entry* left,
+            const transaction_index::entry* right)
+        {
+            return left->hash == right->hash;
+        }), entries.end());
+
+    for (uint32_t seed = 0; seed < seed_limit; ++seed)
+        if (place(out, entries, seed))
+            return error::success;
+
+    return error::operation_failed;
+}
+
+static void write_record(byte_writer& sink,
+    const transaction_index::entry& entry)
+{
+    sink.write_hash(entry.hash);
+    sink.write_8_bytes_little_endian(entry.location.offset);
+    sink.write_4_bytes_little_endian(entry.location.file);
+    sink.write_4_bytes_little_endian(entry.location.length);
+}
+
+// static
+void transaction_index::collect(entry::list& out, const block& block,
+    uint32_t file, uint64_t offset)
+{
+    const auto& txs = block.transactions();
+    offset += block.header().serialized_size() +
+        message::variable_uint_size(txs.size());
+    out.reserve(out.size() + txs.size());
+
+    for (const auto& tx: txs)
+    {
+        const auto length = tx.serialized_size(true, true);
+        out.push_back({ tx.hash(), { file, offset,
+            static_cast<uint32_t>(length) } });
+        offset += length;
+    }
+}
+
+// static
+bool transaction_index::store(const path& file, const entry::list& entries,
+    threadpool& pool)
+{
+    const auto partitions = std::max(size_t(1),
+        (entries.size() + partition_target - 1) / partition_target);
+
+    if (partitions > max_uint32)
+        return false;
+
+    std::vector<entry_pointers> partitioned(partitions);
+
+    for (auto& partition: partitioned)
+        partition.reserve(partition_target + partition_target / 8);
+
+    for (const auto& entry: entries)
+        partitioned[partition_of(entry.hash, partitions)].push_back(&entry);
+
+    std::vector<built_partition> built(partitions);
+
+    const auto build_partition = [&](size_t position)
+    {
+        const auto ec = build(built[position], partitioned[position]);
+        entry_pointers().swap(partitioned[position]);
+        return ec;
+    };
+
+    if (parallel_for(pool, partitions, 1, build_partition))
+        return false;
+
+    std::ofstream stream(file.string(), std::ios::binary | std::ios::trunc);
+
+    if (!stream)
+        return false;
+
+    uint64_t count = 0;
+    uint64_t pilots = 0;
+    uint64_t remaps = 0;
+    data_chunk data;
+    data.reserve(prefix_size + partitions * partition_size);
+    byte_writer sink(data);
+
+    for (const auto& partition: built)
+        count += partition.records.size();
+
+    sink.write_4_bytes_little_endian(magic);
+    sink.write_4_bytes_little_endian(version);
+    sink.write_8_bytes_little_endian(count);
+    sink.write_4_bytes_little_endian(static_cast<uint32_t>(partitions));
+    sink.write_4_bytes_little_endian(0);
+    count = 0;
+
+    for (const auto& partition: built)
+    {
+        sink.write_8_bytes_little_endian(count);
+        sink.write_8_bytes_little_endian(pilots);
+        sink.write_8_bytes_little_endian(remaps);
+        sink.write_4_bytes_little_endian(
+            static_cast<uint32_t>(partition.records.size()));
+        sink.write_4_bytes_little_endian(
+            static_cast<uint32_t>(partition.pilots.size()));
+        sink.write_4_bytes_little_endian(static_cast<uint32_t>(
+            partition.records.size() + partition.remaps.size()));
+        sink.write_4_bytes_little_endian(partition.seed);
+        count += partition.records.size();
+        pilots += partition.pilots.size();
+        remaps += partition.remaps.size();
+    }
+
+    // Sections are written a partition at a time.
+    const auto write = [&stream, &data]()
+    {
+        stream.write(reinterpret_cast<const char*>(data.data()),
+            data.size());
+        data.clear();
+    };
+
+    write();
+
+    for (const auto& partition: built)
+    {
+        for (const auto pilot: partition.pilots)
+            sink.write_4_bytes_little_endian(pilot);
+
+        write();
+    }
+
+    for (const auto& partition: built)
+    {
+        for (const auto remap: partition.remaps)
+            sink.write_4_bytes_little_endian(remap);
+
+        write();
+    }
+
+    for (const auto& partition: built)
+    {
+        for (const auto entry: partition.records)
+            write_record(sink, *entry);
+
+        write();
+    }
+
+    stream.flush();
+    return !!stream;
+}
+
+// static
+bool transaction_index::merge(const path& file, const paths& segments,
+    threadpool& pool)
+{
+    entry::list entries;
+
+    for (const auto& segment: segments)
+    {
+        transaction_index index;
+
+        if (!index.open(segment))
+            return false;
+
+        index.entries(entries);
+    }
+
+    return store(file, entries, pool);
+}
+
+// Construction.
+//-----------------------------------------------------------------------------
+
+transaction_index::transaction_index()
+  : size_(0), partitions_(0), pilots_(0), remaps_(0), records_(0)
+{
+}
+
+bool transaction_index::open(const path& file)
+{
+    close();
+    boost::system::error_code ec;
+
+    // An empty file cannot be mapped.
+    if (boost::filesystem::file_size(file, ec) == 0 || ec)
+        return false;
+
+    try
+    {
+        file_.open(file.string());
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+
+    if (!file_.is_open())
+        return false;
+
+    const auto begin = reinterpret_cast<const uint8_t*>(file_.data());
+    const auto size = static_cast<uint64_t>(file_.size());
+    byte_reader source({ begin, begin + std::min(file_.size(), prefix_size) });
+
+    const auto is_index = source.read_4_bytes_little_endian() == magic &&
+        source.read_4_bytes_little_endian() == version;
+    const auto count = source.read_8_bytes_little_endian();
+    const auto partitions = source.read_4_bytes_little_endian();
+
+    if (!source || !is_index || partitions == 0 ||
+        size < prefix_size + uint64_t(partitions) * partition_size)
+    {
+        close();
+        return false;
+    }
+
+    // Partitions must be contiguous, so that reads are within the file.
+    partitions_ = partitions;
+    uint64_t records = 0;
+    uint64_t pilots = 0;
+    uint64_t remaps = 0;
+
+    for (size_t position = 0; position < partitions_; ++position)
+    {
+        const auto partition = read_partition(position);
+
+        if (partition.record != records || partition.pilot != pilots ||
+            partition.remap != remaps || partition.slots < partition.count ||
+            partition.buckets != buckets_of(partition.count))
+        {
+            close();
+            return false;
+        }
+
+        records += partition.count;
+        pilots += partition.buckets;
+        remaps += partition.slots - partition.count;
+    }
+
+    pilots_ = prefix_size + partitions_ * partition_size;
+    remaps_ = pilots_ + pilots * sizeof(uint32_t);
+    records_ = remaps_ + remaps * sizeof(uint32_t);
+
+    if (records != count || records_ + count * record_size != size)
+    {
+        close();
+        return false;
+    }
+
+    size_ = static_cast<size_t>(count);
+    return true;
+}
+
+void transaction_index::close()
+{
+    if (file_.is_open())
+        file_.close();
+
+    size_ = 0;
+    partitions_ = 0;
+    pilots_ = 0;
+    remaps_ = 0;
+    records_ = 0;
+}
+
+bool transaction_index::is_open() const
+{
+    return file_.is_open();
+}
+
+// Properties.
+//-----------------------------------------------------------------------------
+
+size_t transaction_index::size() const
+{
+    return size_;
+}
+
+size_t transaction_index::partitions() const
+{
+    return partitions_;
+}
+
+void transaction_index::entries(entry::list& out) const
+{
+    out.reserve(out.size() + size_);
+
+    for (size_t position = 0; position < size_; ++position)
+    {
+        const auto record = data(records_ + position * record_size);
+        entry value;
+        std::copy_n(record, hash_size, value.hash.begin());
+        value.location.offset = from_little_endian_unsafe<uint64_t>(
+            record + offset_offset);
+        value.location.file = from_little_endian_unsafe<uint32_t>(
+            record + file_offset);
+        value.location.length = from_little_endian_unsafe<uint32_t>(
+            record + length_offset);
+        out.push_back(value);
+    }
+}
+
+// Queries.
+//-----------------------------------------------------------------------------
+
+bool transaction_index::find(location& out, const hash_digest& hash) const
+{
+    if (partitions_ == 0)
+        return false;
+
+    const auto partition = read_partition(partition_of(hash, partitions_));
+
+    if (partition.count == 0)
+        return false;
+
+    const auto bucket = bucket_of(hash, partition.seed, partition.buckets);
+    const auto pilot = from_little_endian_unsafe<uint32_t>(data(pilots_ +
+        (partition.pilot + bucket) * sizeof(uint32_t)));
+    auto slot = slot_of(hash, partition.seed, pilot, partition.slots);
+
+    if (slot >= partition.count)
+    {
+        slot = from_little_endian_unsafe<uint32_t>(data(remaps_ +
+            (partition.remap + slot - partition.count) * sizeof(uint32_t)));
+
+        // A remap is only read here, so a corrupt remap is a miss.
+        if (slot >= partition.count)
+            return false;
+    }
+
+    const auto record = data(records_ + (partition.record + slot) *
+        record_size);
+
+    if (!std::equal(hash.begin(), hash.end(), record))
+        return false;
+
+    out.offset = from_little_endian_unsafe<uint64_t>(record + offset_offset);
+    out.file = from_little_endian_unsafe<uint32_t>(record + file_offset);
+    out.length = from_little_endian_unsafe<uint32_t>(record + length_offset);
+    return true;
+}
+
+// private
+transaction_index::partition transaction_index::read_partition(
+    size_t position) const
+{
+    BITCOIN_ASSERT(position < partitions_);
+    const auto begin = data(prefix_size + position * partition_size);
+    byte_reader source({ begin, begin + partition_size });
+
+    partition value;
+    value.record = source.read_8_bytes_little_endian();
+    value.pilot = source.read_8_bytes_little_endian();
+    value.remap = source.read_8_bytes_little_endian();
+    value.count = source.read_4_bytes_little_endian();
+    value.buckets = source.read_4_bytes_little_endian();
+    value.slots = source.read_4_bytes_little_endian();
+    value.seed = source.read_4_bytes_little_endian();
+    return value;
+}
+
+// private
+const uint8_t* transaction_index::data(uint64_t offset) const
+{
+    return reinterpret_cast<const uint8_t*>(file_.data()) + offset;
+}
+
+// Segments.
+//-----------------------------------------------------------------------------
+
+transaction_index_set::transaction_index_set()
+{
+}
+
+bool transaction_index_set::add(const path& file)
+{
+    const auto segment = std::make_shared<transaction_index>();
+
+    if (!segment->open(file))
+        return false;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Critical Section
+    unique_lock lock(mutex_);
+    segments_.push_back(segment);
+    ///////////////////////////////////////////////////////////////////////////
+
+    return true;
+}
+
+bool transaction_index_set::merge(const path& file, threadpool& pool)
+{
+    list merged;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Critical Section
+    {
+        shared_lock lock(mutex_);
+        merged = segments_;
+    }
+    ///////////////////////////////////////////////////////////////////////////
+
+    transaction_index::entry::list entries;
+
+    for (const auto& segment: merged)
+        segment->entries(entries);
+
+    const auto segment = std::make_shared<transaction_index>();
+
+    if (!transaction_index::store(file, entries, pool) ||
+        !segment->open(file))
+        return false;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Critical Section
+    unique_lock lock(mutex_);
+
+    // Another merge has replaced the segments.
+    if (segments_.size() < merged.size() ||
+        !std::equal(merged.begin(), merged.end(), segments_.begin()))
+        return false;
+
+    // Segments are unmapped once no query reads them.
+    segments_.erase(segments_.begin(), segments_.begin() + merged.size());
+    segments_.insert(segments_.begin(), segment);
+    return true;
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+size_t transaction_index_set::segments() const
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Critical Section
+    shared_lock lock(mutex_);
+    return segments_.size();
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+size_t transaction_index_set::size() const
+{
+    size_t count = 0;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Critical Section
+    shared_lock lock(mutex_);
+
+    for (const auto& segment: segments_)
+        count += segment->size();
+
+    return count;
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+bool transaction_index_set::find(transaction_index::location& out,
+    const hash_digest& hash) const
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Critical Section
+    shared_lock lock(mutex_);
+
+    for (const auto& segment: segments_)
+        if (segment->find(out, hash))
+            return true;
+
+    return false;
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+} // namespace chain
+} // namespace libbitcoin
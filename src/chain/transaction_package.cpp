@@ -0,0 +1,353 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/chain/transaction_package.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <utility>
+#include <vector>
+#include <bitcoin/bitcoin/chain/chain_state.hpp>
+#include <bitcoin/bitcoin/chain/output.hpp>
+#include <bitcoin/bitcoin/chain/output_point.hpp>
+#include <bitcoin/bitcoin/chain/prevout_source.hpp>
+#include <bitcoin/bitcoin/chain/transaction.hpp>
+#include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/flat_hash_map.hpp>
+#include <bitcoin/bitcoin/utility/flat_hash_set.hpp>
+#include <bitcoin/bitcoin/utility/parallel.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+// Constructors.
+//-----------------------------------------------------------------------------
+
+transaction_package::transaction_package(const transaction::list& transactions)
+{
+    order(transaction::list(transactions));
+}
+
+transaction_package::transaction_package(transaction::list&& transactions)
+{
+    order(std::move(transactions));
+}
+
+// Graph.
+//-----------------------------------------------------------------------------
+
+void transaction_package::order(transaction::list&& transactions)
+{
+    const auto count = transactions.size();
+    codes conflicts(count, error::success);
+    flat_hash_map<hash_digest, size_t> positions(count);
+
+    // The first of duplicate transaction hashes is retained.
+    for (size_t position = 0; position < count; ++position)
+        if (!positions.insert(transactions[position].hash(), position))
+            conflicts[position] = error::duplicate_transaction;
+
+    // Parents may follow their children in the given order.
+    std::vector<std::vector<size_t>> parents(count);
+    std::vector<std::vector<size_t>> children(count);
+
+    for (size_t position = 0; position < count; ++position)
+    {
+        auto& edges = parents[position];
+
+        for (const auto& input: transactions[position].inputs())
+        {
+            const auto parent = positions.find(input.previous_output().hash());
+
+            if (parent != nullptr && *parent != position)
+                edges.push_back(*parent);
+        }
+
+        std::sort(edges.begin(), edges.end());
+        edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+        for (const auto parent: edges)
+            children[parent].push_back(position);
+    }
+
+    // Kahn's algorithm, the depth of each is one more than its deepest parent.
+    static const auto unreached = max_size_t;
+    std::vector<size_t> depths(count, unreached);
+    std::vector<size_t> pending(count);
+    std::vector<size_t> queue;
+    queue.reserve(count);
+    size_t deepest = 0;
+
+    for (size_t position = 0; position < count; ++position)
+    {
+        pending[position] = parents[position].size();
+
+        if (pending[position] == 0)
+        {
+            depths[position] = 0;
+            queue.push_back(position);
+        }
+    }
+
+    for (size_t next = 0; next < queue.size(); ++next)
+    {
+        const auto position = queue[next];
+        deepest = std::max(deepest, depths[position]);
+
+        for (const auto child: children[position])
+        {
+            if (depths[child] == unreached || depths[child] <= depths[position])
+                depths[child] = depths[position] + 1;
+
+            if (--pending[child] == 0)
+                queue.push_back(child);
+        }
+    }
+
+    // Transactions in or descending from a cycle cannot be valid, and are
+    // placed in a final level.
+    if (queue.size() != count)
+    {
+        ++deepest;
+
+        for (size_t position = 0; position < count; ++position)
+        {
+            if (pending[position] != 0)
+            {
+                depths[position] = deepest;
+                conflicts[position] = error::orphan_transaction;
+            }
+        }
+    }
+
+    std::vector<size_t> sequence(count);
+    std::iota(sequence.begin(), sequence.end(), size_t{ 0 });
+    std::stable_sort(sequence.begin(), sequence.end(),
+        [&depths](size_t left, size_t right)
+        {
+            return depths[left] < depths[right];
+        });
+
+    std::vector<size_t> ordered(count);
+    for (size_t position = 0; position < count; ++position)
+        ordered[sequence[position]] = position;
+
+    transactions_.reserve(count);
+    parents_.resize(count);
+    conflicts_.reserve(count);
+
+    for (size_t position = 0; position < count; ++position)
+    {
+        const auto original = sequence[position];
+        transactions_.push_back(std::move(transactions[original]));
+        conflicts_.push_back(conflicts[original]);
+
+        auto& edges = parents_[position];
+        edges.reserve(parents[original].size());
+
+        for (const auto parent: parents[original])
+            edges.push_back(ordered[parent]);
+
+        if (position + 1 == count ||
+            depths[sequence[position + 1]] != depths[original])
+            levels_.push_back(position + 1);
+    }
+
+    // The later of two spends of an output within the package conflicts.
+    flat_hash_set<output_point> spent(count);
+
+    for (size_t position = 0; position < count; ++position)
+        for (const auto& input: transactions_[position].inputs())
+            if (!spent.insert(input.previous_output()) && !conflicts_[position])
+                conflicts_[position] = error::double_spend;
+}
+
+// Properties.
+//-----------------------------------------------------------------------------
+
+const transaction::list& transaction_package::transactions() const
+{
+    return transactions_;
+}
+
+size_t transaction_package::levels() const
+{
+    return levels_.size();
+}
+
+const std::vector<size_t>& transaction_package::parents(size_t position) const
+{
+    return parents_[position];
+}
+
+// Previous outputs.
+//-----------------------------------------------------------------------------
+
+output_point::list transaction_package::missing_previous_outputs() const
+{
+    output_point::list points;
+    flat_hash_map<hash_digest, size_t> positions(transactions_.size());
+
+    for (size_t position = 0; position < transactions_.size(); ++position)
+        positions.insert(transactions_[position].hash(), position);
+
+    for (size_t position = 0; position < transactions_.size(); ++position)
+    {
+        for (const auto& input: transactions_[position].inputs())
+        {
+            const auto& prevout = input.previous_output();
+            const auto parent = positions.find(prevout.hash());
+
+            if (parent == nullptr || *parent == position)
+                points.push_back(prevout);
+        }
+    }
+
+    std::sort(points.begin(), points.end());
+    points.erase(std::unique(points.begin(), points.end()), points.end());
+    return points;
+}
+
+code transaction_package::populate_previous_outputs(const chain_state& state,
+    prevout_source& source) const
+{
+    flat_hash_map<hash_digest, size_t> positions(transactions_.size());
+
+    for (size_t position = 0; position < transactions_.size(); ++position)
+        positions.insert(transactions_[position].hash(), position);
+
+    // Outputs of the package are unconfirmed, as if of the next block.
+    for (size_t position = 0; position < transactions_.size(); ++position)
+    {
+        for (const auto& input: transactions_[position].inputs())
+        {
+            const auto& prevout = input.previous_output();
+            const auto parent = positions.find(prevout.hash());
+
+            if (parent == nullptr || *parent == position)
+                continue;
+
+            const auto& outputs = transactions_[*parent].outputs();
+            const auto index = prevout.index();
+            auto& previous = *prevout.metadata;
+            previous.cache = index < outputs.size() ? outputs[index] :
+                output{};
+            previous.spent = false;
+            previous.candidate = false;
+            previous.confirmed = false;
+            previous.coinbase = transactions_[*parent].is_coinbase();
+            previous.height = state.height();
+            previous.median_time_past = state.median_time_past();
+        }
+    }
+
+    const auto points = missing_previous_outputs();
+
+    if (points.empty())
+        return error::success;
+
+    const auto ec = source.populate(points);
+
+    if (ec)
+        return ec;
+
+    // Scatter the metadata of each distinct point to each of its spends.
+    for (const auto& tx: transactions_)
+    {
+        for (const auto& input: tx.inputs())
+        {
+            const auto& prevout = input.previous_output();
+            const auto it = std::lower_bound(points.begin(), points.end(),
+                prevout);
+
+            if (it != points.end() && *it == prevout)
+                prevout.metadata = it->metadata;
+        }
+    }
+
+    return error::success;
+}
+
+// Validation.
+//-----------------------------------------------------------------------------
+
+code transaction_package::validate(size_t position, const chain_state& state,
+    uint64_t max_money, const codes& results) const
+{
+    code ec;
+
+    if ((ec = conflicts_[position]))
+        return ec;
+
+    // Parents are of prior levels, so their results are complete.
+    for (const auto parent: parents_[position])
+        if (results[parent])
+            return error::orphan_transaction;
+
+    const auto& tx = transactions_[position];
+
+    if ((ec = tx.check(max_money, true)))
+        return ec;
+
+    if ((ec = tx.accept(state, true)))
+        return ec;
+
+    return tx.connect(state);
+}
+
+transaction_package::codes transaction_package::validate(
+    const chain_state& state, uint64_t max_money) const
+{
+    codes results(transactions_.size(), error::success);
+
+    for (size_t position = 0; position < transactions_.size(); ++position)
+        results[position] = validate(position, state, max_money, results);
+
+    return results;
+}
+
+transaction_package::codes transaction_package::validate(
+    const chain_state& state, uint64_t max_money, threadpool& pool) const
+{
+    codes results(transactions_.size(), error::success);
+    size_t begin = 0;
+
+    for (const auto end: levels_)
+    {
+        // Each job returns success so that all of the level is validated.
+        const auto job = [&, begin](size_t offset)
+        {
+            const auto position = begin + offset;
+            results[position] = validate(position, state, max_money, results);
+            return code(error::success);
+        };
+
+        parallel_for(pool, end - begin, 1, job);
+        begin = end;
+    }
+
+    return results;
+}
+
+} // namespace chain
+} // namespace libbitcoin
@@ -0,0 +1,431 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/chain/transaction_pool_index.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <bitcoin/bitcoin/chain/chain_state.hpp>
+#include <bitcoin/bitcoin/chain/output_point.hpp>
+#include <bitcoin/bitcoin/chain/transaction.hpp>
+#include <bitcoin/bitcoin/machine/rule_fork.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/assert.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+using namespace bc::machine;
+
+// Ordering.
+//-----------------------------------------------------------------------------
+
+transaction_pool_index::lower_rate::lower_rate(const std::vector<node>& nodes,
+    totals entry::* aggregate)
+  : nodes_(nodes), aggregate_(aggregate)
+{
+}
+
+// Fee rates are compared by cross multiplication, avoiding division.
+bool transaction_pool_index::lower_rate::operator()(slot left,
+    slot right) const
+{
+    const auto& first = nodes_[left].value.*aggregate_;
+    const auto& second = nodes_[right].value.*aggregate_;
+    const auto lower = static_cast<double>(first.fees) * second.size;
+    const auto upper = static_cast<double>(second.fees) * first.size;
+    return lower == upper ? left < right : lower < upper;
+}
+
+// Constructors.
+//-----------------------------------------------------------------------------
+
+transaction_pool_index::transaction_pool_index(size_t capacity)
+  : hashes_(capacity),
+    spends_(capacity),
+    rates_(lower_rate(nodes_, &entry::descendants)),
+    mining_(lower_rate(nodes_, &entry::ancestors)),
+    epoch_(0),
+    virtual_size_(0)
+{
+    nodes_.reserve(capacity);
+}
+
+// Insertion.
+//-----------------------------------------------------------------------------
+
+bool transaction_pool_index::insert(const transaction& tx, uint64_t fee,
+    size_t sigops)
+{
+    const auto hash = tx.hash();
+
+    if (hashes_.contains(hash))
+        return false;
+
+    for (const auto& input: tx.inputs())
+        if (spends_.contains(input.previous_output()))
+            return false;
+
+    slot position;
+
+    if (free_.empty())
+    {
+        position = static_cast<slot>(nodes_.size());
+        nodes_.emplace_back();
+    }
+    else
+    {
+        position = free_.back();
+        free_.pop_back();
+    }
+
+    auto& added = nodes_[position];
+    added.value.tx = tx;
+    added.value.hash = hash;
+    added.value.size = tx.virtual_size();
+    added.value.fee = fee;
+    added.value.sigops = sigops;
+    added.value.ancestors = { 0, 0, 0, 0 };
+    added.value.descendants = { 0, 0, 0, 0 };
+    added.mark = 0;
+    added.live = true;
+    add(added.value.ancestors, added.value);
+    add(added.value.descendants, added.value);
+
+    for (const auto& input: tx.inputs())
+    {
+        const auto parent = hashes_.find(input.previous_output().hash());
+
+        if (parent != nullptr)
+            added.parents.push_back(*parent);
+    }
+
+    std::sort(added.parents.begin(), added.parents.end());
+    added.parents.erase(std::unique(added.parents.begin(),
+        added.parents.end()), added.parents.end());
+
+    for (const auto parent: added.parents)
+        nodes_[parent].children.push_back(position);
+
+    // Each ancestor is reordered as its descendant totals change.
+    for (const auto ancestor: ancestors(position))
+    {
+        auto& value = nodes_[ancestor].value;
+        add(added.value.ancestors, value);
+        rates_.erase(ancestor);
+        add(value.descendants, added.value);
+        rates_.insert(ancestor);
+    }
+
+    hashes_.insert(hash, position);
+
+    for (const auto& input: tx.inputs())
+        spends_.insert(input.previous_output(), position);
+
+    rates_.insert(position);
+    mining_.insert(position);
+    virtual_size_ += added.value.size;
+    return true;
+}
+
+bool transaction_pool_index::insert(const transaction& tx,
+    const chain_state& state)
+{
+    const auto bip16 = state.is_enabled(rule_fork::bip16_rule);
+    const auto bip141 = state.is_enabled(rule_fork::bip141_rule);
+    return insert(tx, tx.fees(), tx.signature_operations(bip16, bip141));
+}
+
+// Removal.
+//-----------------------------------------------------------------------------
+
+size_t transaction_pool_index::erase(const hash_digest& hash)
+{
+    const auto position = hashes_.find(hash);
+
+    if (position == nullptr)
+        return 0;
+
+    auto removed = descendants(*position);
+    removed.push_back(*position);
+    remove(removed);
+    return removed.size();
+}
+
+bool transaction_pool_index::confirm(const hash_digest& hash)
+{
+    const auto position = hashes_.find(hash);
+
+    if (position == nullptr || !nodes_[*position].parents.empty())
+        return false;
+
+    remove({ *position });
+    return true;
+}
+
+size_t transaction_pool_index::evict()
+{
+    if (rates_.empty())
+        return 0;
+
+    const auto position = *rates_.begin();
+    auto removed = descendants(position);
+    removed.push_back(position);
+    remove(removed);
+    return removed.size();
+}
+
+// Removed entries are first marked, so that only the totals of remaining
+// ancestors and descendants are updated.
+void transaction_pool_index::remove(const slots& positions)
+{
+    for (const auto position: positions)
+    {
+        rates_.erase(position);
+        mining_.erase(position);
+        nodes_[position].live = false;
+    }
+
+    for (const auto position: positions)
+    {
+        const auto& value = nodes_[position].value;
+
+        for (const auto ancestor: ancestors(position))
+        {
+            if (!nodes_[ancestor].live)
+                continue;
+
+            rates_.erase(ancestor);
+            subtract(nodes_[ancestor].value.descendants, value);
+            rates_.insert(ancestor);
+        }
+
+        for (const auto descendant: descendants(position))
+        {
+            if (!nodes_[descendant].live)
+                continue;
+
+            mining_.erase(descendant);
+            subtract(nodes_[descendant].value.ancestors, value);
+            mining_.insert(descendant);
+        }
+    }
+
+    for (const auto position: positions)
+    {
+        const auto& removed = nodes_[position];
+
+        for (const auto parent: removed.parents)
+        {
+            auto& children = nodes_[parent].children;
+            children.erase(std::remove(children.begin(), children.end(),
+                position), children.end());
+        }
+
+        for (const auto child: removed.children)
+        {
+            auto& parents = nodes_[child].parents;
+            parents.erase(std::remove(parents.begin(), parents.end(),
+                position), parents.end());
+        }
+    }
+
+    for (const auto position: positions)
+        release(position);
+}
+
+void transaction_pool_index::release(slot position)
+{
+    auto& removed = nodes_[position];
+    hashes_.erase(removed.value.hash);
+
+    for (const auto& input: removed.value.tx.inputs())
+        spends_.erase(input.previous_output());
+
+    BITCOIN_ASSERT(virtual_size_ >= removed.value.size);
+    virtual_size_ -= removed.value.size;
+    removed.value.tx = transaction{};
+    removed.parents.clear();
+    removed.children.clear();
+    free_.push_back(position);
+}
+
+// Traversal.
+//-----------------------------------------------------------------------------
+
+// Marks are compared to the epoch, so that no traversal clears them.
+void transaction_pool_index::advance() const
+{
+    if (++epoch_ != 0)
+        return;
+
+    for (auto& value: nodes_)
+        value.mark = 0;
+
+    epoch_ = 1;
+}
+
+transaction_pool_index::slots transaction_pool_index::ancestors(
+    slot position) const
+{
+    advance();
+    slots found;
+    slots pending{ position };
+    nodes_[position].mark = epoch_;
+
+    while (!pending.empty())
+    {
+        const auto next = pending.back();
+        pending.pop_back();
+
+        for (const auto parent: nodes_[next].parents)
+        {
+            if (nodes_[parent].mark == epoch_)
+                continue;
+
+            nodes_[parent].mark = epoch_;
+            found.push_back(parent);
+            pending.push_back(parent);
+        }
+    }
+
+    return found;
+}
+
+transaction_pool_index::slots transaction_pool_index::descendants(
+    slot position) const
+{
+    advance();
+    slots found;
+    slots pending{ position };
+    nodes_[position].mark = epoch_;
+
+    while (!pending.empty())
+    {
+        const auto next = pending.back();
+        pending.pop_back();
+
+        for (const auto child: nodes_[next].children)
+        {
+            if (nodes_[child].mark == epoch_)
+                continue;
+
+            nodes_[child].mark = epoch_;
+            found.push_back(child);
+            pending.push_back(child);
+        }
+    }
+
+    return found;
+}
+
+transaction_pool_index::entries transaction_pool_index::to_entries(
+    const slots& positions) const
+{
+    entries values;
+    values.reserve(positions.size());
+
+    for (const auto position: positions)
+        values.push_back(&nodes_[position].value);
+
+    return values;
+}
+
+void transaction_pool_index::add(totals& to, const entry& value) const
+{
+    to.count += 1;
+    to.size += value.size;
+    to.fees += value.fee;
+    to.sigops += value.sigops;
+}
+
+void transaction_pool_index::subtract(totals& from, const entry& value) const
+{
+    BITCOIN_ASSERT(from.count > 0 && from.size >= value.size);
+    from.count -= 1;
+    from.size -= value.size;
+    from.fees -= value.fee;
+    from.sigops -= value.sigops;
+}
+
+// Properties.
+//-----------------------------------------------------------------------------
+
+const transaction_pool_index::entry* transaction_pool_index::lowest() const
+{
+    return rates_.empty() ? nullptr : &nodes_[*rates_.begin()].value;
+}
+
+const transaction_pool_index::entry* transaction_pool_index::find(
+    const hash_digest& hash) const
+{
+    const auto position = hashes_.find(hash);
+    return position == nullptr ? nullptr : &nodes_[*position].value;
+}
+
+const transaction_pool_index::entry* transaction_pool_index::spender(
+    const output_point& point) const
+{
+    const auto position = spends_.find(point);
+    return position == nullptr ? nullptr : &nodes_[*position].value;
+}
+
+transaction_pool_index::entries transaction_pool_index::ancestors(
+    const entry& value) const
+{
+    const auto position = hashes_.find(value.hash);
+    return position == nullptr ? entries{} : to_entries(ancestors(*position));
+}
+
+transaction_pool_index::entries transaction_pool_index::descendants(
+    const entry& value) const
+{
+    const auto position = hashes_.find(value.hash);
+    return position == nullptr ? entries{} :
+        to_entries(descendants(*position));
+}
+
+bool transaction_pool_index::visit(visitor handler) const
+{
+    for (auto it = mining_.rbegin(); it != mining_.rend(); ++it)
+        if (!handler(nodes_[*it].value))
+            return false;
+
+    return true;
+}
+
+size_t transaction_pool_index::size() const
+{
+    return hashes_.size();
+}
+
+bool transaction_pool_index::empty() const
+{
+    return hashes_.empty();
+}
+
+size_t transaction_pool_index::virtual_size() const
+{
+    return virtual_size_;
+}
+
+} // namespace chain
+} // namespace libbitcoin
@@ -0,0 +1,129 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/chain/transaction_recycler.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <bitcoin/bitcoin/chain/transaction.hpp>
+#include <bitcoin/bitcoin/utility/thread.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+// The free list is reserved to capacity so that release does not allocate.
+struct transaction_recycler::state
+{
+    state(size_t capacity)
+      : capacity(capacity)
+    {
+        free.reserve(capacity);
+    }
+
+    ~state()
+    {
+        for (const auto value: free)
+            delete value;
+    }
+
+    const size_t capacity;
+
+    // This is protected by mutex.
+    std::vector<transaction*> free;
+    mutable shared_mutex mutex;
+};
+
+transaction_recycler::releaser::releaser()
+{
+}
+
+transaction_recycler::releaser::releaser(std::weak_ptr<state> owner)
+  : owner_(std::move(owner))
+{
+}
+
+void transaction_recycler::releaser::operator()(transaction* value) const
+{
+    if (value == nullptr)
+        return;
+
+    const auto owner = owner_.lock();
+
+    if (owner)
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // Critical Section
+        unique_lock lock(owner->mutex);
+
+        if (owner->free.size() < owner->capacity)
+        {
+            owner->free.push_back(value);
+            return;
+        }
+        ///////////////////////////////////////////////////////////////////////
+    }
+
+    delete value;
+}
+
+transaction_recycler::transaction_recycler(size_t capacity)
+  : state_(std::make_shared<state>(capacity))
+{
+}
+
+transaction_recycler::ptr transaction_recycler::acquire()
+{
+    transaction* value = nullptr;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Critical Section
+    state_->mutex.lock();
+
+    if (!state_->free.empty())
+    {
+        value = state_->free.back();
+        state_->free.pop_back();
+    }
+
+    state_->mutex.unlock();
+    ///////////////////////////////////////////////////////////////////////////
+
+    if (value == nullptr)
+        value = new transaction;
+
+    return ptr(value, releaser(state_));
+}
+
+size_t transaction_recycler::size() const
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Critical Section
+    shared_lock lock(state_->mutex);
+    return state_->free.size();
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+size_t transaction_recycler::capacity() const
+{
+    return state_->capacity;
+}
+
+} // namespace chain
+} // namespace libbitcoin
@@ -0,0 +1,152 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/chain/transaction_signer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/bitcoin/chain/script.hpp>
+#include <bitcoin/bitcoin/chain/transaction.hpp>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/machine/sighash_algorithm.hpp>
+#include <bitcoin/bitcoin/math/elliptic_curve.hpp>
+#include <bitcoin/bitcoin/utility/parallel.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+using namespace bc::machine;
+
+// Inputs signed per parallel job, each is a signature hash and an ECDSA sign.
+static constexpr size_t signing_grain = 8;
+
+transaction_signer::transaction_signer(const transaction& tx)
+  : tx_(tx)
+{
+}
+
+void transaction_signer::add(uint32_t index, const ec_secret& secret,
+    const script& prevout_script, uint8_t sighash_type,
+    script::script_version version, uint64_t value)
+{
+    inputs_.push_back(
+    {
+        index, secret, prevout_script, sighash_type, version, value
+    });
+}
+
+const transaction_signer::signing_inputs& transaction_signer::inputs() const
+{
+    return inputs_;
+}
+
+size_t transaction_signer::size() const
+{
+    return inputs_.size();
+}
+
+void transaction_signer::clear()
+{
+    inputs_.clear();
+}
+
+// private
+// The transaction caches these hashes, so that each is computed once here
+// rather than concurrently (and redundantly) by the first inputs signed.
+void transaction_signer::precompute() const
+{
+    auto legacy = false;
+    auto segregated = false;
+
+    for (const auto& input: inputs_)
+    {
+        // Masked values other than single and none are all (consensus).
+        const auto sighash = input.sighash_type & sighash_algorithm::mask;
+
+        if (input.version == script::script_version::zero)
+            segregated = true;
+        else if (sighash != sighash_algorithm::single &&
+            sighash != sighash_algorithm::none)
+            legacy = true;
+    }
+
+    if (legacy)
+        tx_.sighash_precomputation();
+
+    if (segregated)
+    {
+        tx_.inpoints_hash();
+        tx_.sequences_hash();
+        tx_.outputs_hash();
+    }
+}
+
+// private
+bool transaction_signer::sign(endorsement& out, size_t position) const
+{
+    const auto& input = inputs_[position];
+
+    // The version 0 signature hash does not allow an invalid input index.
+    return input.index < tx_.inputs().size() &&
+        script::create_endorsement(out, input.secret, input.prevout_script,
+            tx_, input.index, input.sighash_type, input.version, input.value);
+}
+
+bool transaction_signer::sign(endorsements& out) const
+{
+    precompute();
+    out.clear();
+    out.resize(inputs_.size());
+
+    for (size_t position = 0; position < inputs_.size(); ++position)
+    {
+        if (!sign(out[position], position))
+        {
+            out.clear();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool transaction_signer::sign(endorsements& out, threadpool& pool) const
+{
+    precompute();
+    out.clear();
+    out.resize(inputs_.size());
+
+    // Each endorsement is written to its own position, so order is retained.
+    const auto endorse = [this, &out](size_t position)
+    {
+        return sign(out[position], position) ? error::success :
+            error::operation_failed;
+    };
+
+    if (parallel_for(pool, inputs_.size(), signing_grain, endorse))
+    {
+        out.clear();
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace chain
+} // namespace libbitcoin
@@ -0,0 +1,375 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/chain/transaction_view.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/bitcoin/chain/transaction.hpp>
+#include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/deserializer.hpp>
+#include <bitcoin/bitcoin/utility/endian.hpp>
+#include "../math/external/sha256.h"
+#include "wire_cursor.hpp"
+
+namespace libbitcoin {
+namespace chain {
+
+static const size_t point_size = hash_size + sizeof(uint32_t);
+
+// input_view
+//-----------------------------------------------------------------------------
+
+input_view::input_view()
+  : begin_(nullptr), script_(nullptr), end_(nullptr)
+{
+}
+
+input_view::input_view(data_slice data)
+  : input_view()
+{
+    size_t size;
+    wire_cursor cursor(data.begin(), data.end());
+
+    if (!cursor.skip(point_size) || !cursor.read_size(size))
+        return;
+
+    const auto script = cursor.position();
+
+    if (!cursor.skip(size) || !cursor.skip(sizeof(uint32_t)))
+        return;
+
+    begin_ = data.begin();
+    script_ = script;
+    end_ = cursor.position();
+}
+
+bool input_view::is_valid() const
+{
+    return begin_ != nullptr;
+}
+
+data_slice input_view::data() const
+{
+    return{ begin_, end_ };
+}
+
+data_slice input_view::previous_output() const
+{
+    return is_valid() ? data_slice{ begin_, begin_ + point_size } :
+        data_slice{ begin_, begin_ };
+}
+
+hash_digest input_view::previous_output_hash() const
+{
+    hash_digest hash{ { 0 } };
+
+    if (is_valid())
+        std::copy(begin_, begin_ + hash_size, hash.begin());
+
+    return hash;
+}
+
+uint32_t input_view::previous_output_index() const
+{
+    return is_valid() ?
+        from_little_endian_unsafe<uint32_t>(begin_ + hash_size) : 0;
+}
+
+data_slice input_view::script() const
+{
+    return is_valid() ? data_slice{ script_, end_ - sizeof(uint32_t) } :
+        data_slice{ begin_, begin_ };
+}
+
+uint32_t input_view::sequence() const
+{
+    return is_valid() ?
+        from_little_endian_unsafe<uint32_t>(end_ - sizeof(uint32_t)) : 0;
+}
+
+// output_view
+//-----------------------------------------------------------------------------
+
+output_view::output_view()
+  : begin_(nullptr), script_(nullptr), end_(nullptr)
+{
+}
+
+output_view::output_view(data_slice data)
+  : output_view()
+{
+    size_t size;
+    wire_cursor cursor(data.begin(), data.end());
+
+    if (!cursor.skip(sizeof(uint64_t)) || !cursor.read_size(size))
+        return;
+
+    const auto script = cursor.position();
+
+    if (!cursor.skip(size))
+        return;
+
+    begin_ = data.begin();
+    script_ = script;
+    end_ = cursor.position();
+}
+
+bool output_view::is_valid() const
+{
+    return begin_ != nullptr;
+}
+
+data_slice output_view::data() const
+{
+    return{ begin_, end_ };
+}
+
+uint64_t output_view::value() const
+{
+    return is_valid() ? from_little_endian_unsafe<uint64_t>(begin_) : 0;
+}
+
+data_slice output_view::script() const
+{
+    return{ script_, end_ };
+}
+
+// witness_view
+//-----------------------------------------------------------------------------
+
+witness_view::witness_view()
+  : begin_(nullptr), end_(nullptr), count_(0)
+{
+}
+
+witness_view::witness_view(data_slice data)
+  : witness_view()
+{
+    size_t count;
+    wire_cursor cursor(data.begin(), data.end());
+
+    if (!cursor.read_size(count))
+        return;
+
+    size_t size;
+    for (auto element = count; element > 0; --element)
+        if (!cursor.read_size(size) || !cursor.skip(size))
+            return;
+
+    begin_ = data.begin();
+    end_ = cursor.position();
+    count_ = count;
+}
+
+bool witness_view::is_valid() const
+{
+    return begin_ != nullptr;
+}
+
+data_slice witness_view::data() const
+{
+    return{ begin_, end_ };
+}
+
+size_t witness_view::size() const
+{
+    return count_;
+}
+
+data_slice witness_view::element(size_t index) const
+{
+    if (index >= count_)
+        return{ end_, end_ };
+
+    size_t size;
+    wire_cursor cursor(begin_, end_);
+    cursor.read_size(size);
+
+    for (; index > 0; --index)
+    {
+        cursor.read_size(size);
+        cursor.skip(size);
+    }
+
+    cursor.read_size(size);
+    const auto element = cursor.position();
+    return{ element, element + size };
+}
+
+// transaction_view
+//-----------------------------------------------------------------------------
+
+transaction_view::transaction_view()
+  : begin_(nullptr), inputs_(nullptr), outputs_(nullptr),
+    witnesses_(nullptr), end_(nullptr), input_count_(0), output_count_(0),
+    segregated_(false)
+{
+}
+
+transaction_view::transaction_view(data_slice data)
+  : transaction_view()
+{
+    uint8_t flag;
+    size_t inputs, outputs;
+    wire_cursor cursor(data.begin(), data.end());
+
+    if (!cursor.skip(sizeof(uint32_t)) || !cursor.read_size(inputs))
+        return;
+
+    // Detect witness as no inputs (marker) and expected flag (bip144).
+    const auto segregated = inputs == witness_marker &&
+        cursor.peek_byte(flag) && flag == witness_flag;
+
+    if (segregated && (!cursor.skip(1) || !cursor.read_size(inputs)))
+        return;
+
+    // Each element is parsed to find its extent, a no-op for the cursor.
+    const auto walk = [&cursor](size_t count, data_slice(*extent)(data_slice))
+    {
+        for (; count > 0; --count)
+        {
+            const auto element = extent({ cursor.position(),
+                cursor.position() + cursor.remaining() });
+
+            if (element.empty() || !cursor.skip(element.size()))
+                return false;
+        }
+
+        return true;
+    };
+
+    const auto input = [](data_slice data) { return input_view(data).data(); };
+    const auto output = [](data_slice data) { return output_view(data).data(); };
+    const auto witness = [](data_slice data)
+    {
+        return witness_view(data).data();
+    };
+
+    const auto inputs_begin = cursor.position();
+
+    if (!walk(inputs, input) || !cursor.read_size(outputs))
+        return;
+
+    const auto outputs_begin = cursor.position();
+
+    if (!walk(outputs, output))
+        return;
+
+    const auto witnesses_begin = cursor.position();
+
+    if (segregated && !walk(inputs, witness))
+        return;
+
+    if (!cursor.skip(sizeof(uint32_t)))
+        return;
+
+    begin_ = data.begin();
+    inputs_ = inputs_begin;
+    outputs_ = outputs_begin;
+    witnesses_ = witnesses_begin;
+    end_ = cursor.position();
+    input_count_ = inputs;
+    output_count_ = outputs;
+    segregated_ = segregated;
+}
+
+bool transaction_view::is_valid() const
+{
+    return begin_ != nullptr;
+}
+
+bool transaction_view::is_segregated() const
+{
+    return segregated_;
+}
+
+data_slice transaction_view::data() const
+{
+    return{ begin_, end_ };
+}
+
+size_t transaction_view::serialized_size() const
+{
+    return static_cast<size_t>(end_ - begin_);
+}
+
+uint32_t transaction_view::version() const
+{
+    return is_valid() ? from_little_endian_unsafe<uint32_t>(begin_) : 0;
+}
+
+uint32_t transaction_view::locktime() const
+{
+    return is_valid() ?
+        from_little_endian_unsafe<uint32_t>(end_ - sizeof(uint32_t)) : 0;
+}
+
+transaction_view::input_views transaction_view::inputs() const
+{
+    return{ inputs_, end_, input_count_ };
+}
+
+transaction_view::output_views transaction_view::outputs() const
+{
+    return{ outputs_, end_, output_count_ };
+}
+
+transaction_view::witness_views transaction_view::witnesses() const
+{
+    return{ witnesses_, end_, segregated_ ? input_count_ : 0 };
+}
+
+// The witness serialization excludes marker, flag and witnesses (bip144).
+hash_digest transaction_view::hash() const
+{
+    if (!segregated_)
+        return bitcoin_hash(data());
+
+    // Marker and flag follow the version.
+    static const auto version_size = sizeof(uint32_t);
+    static const auto marker_size = 2u;
+    const auto locktime = end_ - sizeof(uint32_t);
+    const auto inputs = begin_ + version_size + marker_size;
+
+    hash_digest first;
+    SHA256CTX context;
+    SHA256Init(&context);
+    SHA256Update(&context, begin_, version_size);
+    SHA256Update(&context, inputs, witnesses_ - inputs);
+    SHA256Update(&context, locktime, sizeof(uint32_t));
+    SHA256Final(&context, first.data());
+    return sha256_hash(first);
+}
+
+// Transactions without witness hash as the transaction hash (bip141).
+hash_digest transaction_view::witness_hash() const
+{
+    return bitcoin_hash(data());
+}
+
+transaction transaction_view::to_transaction(bool witness) const
+{
+    auto source = make_safe_deserializer(begin_, end_);
+    return transaction::factory(source, true, witness);
+}
+
+} // namespace chain
+} // namespace libbitcoin
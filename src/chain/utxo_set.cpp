@@ -0,0 +1,571 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/chain/utxo_set.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <utility>
+#include <vector>
+#include <bitcoin/bitcoin/chain/block.hpp>
+#include <bitcoin/bitcoin/chain/output.hpp>
+#include <bitcoin/bitcoin/chain/output_point.hpp>
+#include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/math/siphash.hpp>
+#include <bitcoin/bitcoin/message/messages.hpp>
+#include <bitcoin/bitcoin/utility/assert.hpp>
+#include <bitcoin/bitcoin/utility/deserializer.hpp>
+#include <bitcoin/bitcoin/utility/large_page_allocator.hpp>
+#include <bitcoin/bitcoin/utility/pseudo_random.hpp>
+#include <bitcoin/bitcoin/utility/serializer.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+// Slot states, a tag is never less than first_tag.
+static const uint32_t empty_tag = 0;
+static const uint32_t erased_tag = 1;
+static const uint32_t first_tag = 2;
+
+// Slots in use (live and erased) are limited to seven of eight.
+static const size_t load_numerator = 7;
+static const size_t load_denominator = 8;
+static const size_t line_bytes = utxo_set::slots_per_line * sizeof(uint64_t);
+
+// Pages of 2^16 units (512KiB), offsets of 32 bits address 32GiB of records.
+static const size_t unit_size = sizeof(uint64_t);
+static const size_t page_bits = 16;
+static const size_t page_units = size_t(1) << page_bits;
+static const size_t page_mask = page_units - 1;
+static const uint64_t offset_limit = uint64_t(1) << 32;
+
+// Decorrelates the line and tag of the outputs of one transaction.
+static const uint64_t index_multiplier = 0x9e3779b97f4a7c15;
+
+// Record flags, combined with the height.
+static const uint64_t coinbase_flag = 1;
+static const size_t flag_bits = 1;
+
+// Records.
+//-----------------------------------------------------------------------------
+// [hash:32][body size][index][height:flags][compact output]
+
+static size_t record_size(const uint8_t* record)
+{
+    auto source = make_unsafe_deserializer(record + hash_size);
+    const auto body = source.read_variable_base128();
+    return hash_size + message::variable_base128_size(body) +
+        static_cast<size_t>(body);
+}
+
+static size_t to_units(size_t bytes)
+{
+    return (bytes + unit_size - 1) / unit_size;
+}
+
+// Construction.
+//-----------------------------------------------------------------------------
+
+utxo_set::utxo_set(size_t capacity)
+  : slots_(nullptr), lines_(0), live_(0), erased_(0), cursor_(0),
+    garbage_(0)
+{
+    // The salt precludes construction of colliding points by a peer.
+    key_.first = pseudo_random::next();
+    key_.second = pseudo_random::next();
+    reserve(capacity);
+}
+
+void utxo_set::reserve(size_t capacity)
+{
+    const auto slots = capacity * load_denominator / load_numerator + 1;
+    const auto minimum = (slots + slots_per_line - 1) / slots_per_line;
+
+    auto lines = std::max(lines_, size_t(1));
+    while (lines < minimum)
+        lines <<= 1;
+
+    if (lines != lines_)
+        rehash(lines);
+}
+
+// Hashing.
+//-----------------------------------------------------------------------------
+
+// private
+uint64_t utxo_set::to_code(const hash_digest& hash) const
+{
+    return siphash13(key_, hash);
+}
+
+// private
+// The outputs of one transaction share the hash of its salted digest.
+uint64_t utxo_set::to_code(uint64_t base, uint32_t index)
+{
+    return base ^ ((index + uint64_t(1)) * index_multiplier);
+}
+
+// private
+uint32_t utxo_set::to_tag(uint64_t code)
+{
+    return std::max(static_cast<uint32_t>(code >> 32), first_tag);
+}
+
+// Storage.
+//-----------------------------------------------------------------------------
+
+// private
+uint8_t* utxo_set::to_record(uint32_t offset) const
+{
+    const auto units = pages_[offset >> page_bits].get();
+    return reinterpret_cast<uint8_t*>(units + (offset & page_mask));
+}
+
+// private
+// A record that does not fit the remainder of the last page starts a page.
+uint32_t utxo_set::allocate(size_t bytes)
+{
+    const auto units = to_units(bytes);
+    BITCOIN_ASSERT(units <= page_units);
+
+    if ((cursor_ & page_mask) + units > page_units)
+    {
+        const auto remainder = page_units - (cursor_ & page_mask);
+        garbage_ += remainder;
+        cursor_ += remainder;
+    }
+
+    if (cursor_ + units > offset_limit)
+        throw std::bad_alloc();
+
+    if ((cursor_ >> page_bits) == pages_.size())
+        pages_.emplace_back(new uint64_t[page_units]);
+
+    const auto offset = static_cast<uint32_t>(cursor_);
+    cursor_ += units;
+    return offset;
+}
+
+// private
+// Move live records to new pages, in slot order, releasing all garbage.
+void utxo_set::compact()
+{
+    pages old;
+    std::swap(old, pages_);
+    pages_.reserve(old.size());
+    cursor_ = 0;
+    garbage_ = 0;
+
+    const auto slots = lines_ * slots_per_line;
+
+    for (auto entry = slots_; entry != slots_ + slots; ++entry)
+    {
+        if (entry->tag < first_tag)
+            continue;
+
+        const auto from = reinterpret_cast<const uint8_t*>(
+            old[entry->offset >> page_bits].get() +
+            (entry->offset & page_mask));
+
+        const auto size = record_size(from);
+        entry->offset = allocate(size);
+        std::memcpy(to_record(entry->offset), from, size);
+    }
+}
+
+// private
+// Place each live slot into a new table, discarding erased slots.
+void utxo_set::rehash(size_t lines)
+{
+    BITCOIN_ASSERT(lines > 0 && (lines & (lines - 1)) == 0);
+
+    // The slack allows the table to start on a cache line boundary.
+    const auto slots = lines * slots_per_line;
+    table storage(slots + slots_per_line, slot{ empty_tag, 0 });
+    const auto address = reinterpret_cast<uintptr_t>(storage.data());
+    const auto aligned = (address + line_bytes - 1) & ~(line_bytes - 1);
+    const auto table = reinterpret_cast<slot*>(aligned);
+    const auto line_mask = lines - 1;
+
+    for (auto entry = slots_; entry != slots_ + lines_ * slots_per_line;
+        ++entry)
+    {
+        if (entry->tag < first_tag)
+            continue;
+
+        auto source = make_unsafe_deserializer(to_record(entry->offset));
+        const auto hash = source.read_hash();
+        source.read_variable_base128();
+        const auto index = source.read_variable_base128();
+        const auto code = to_code(to_code(hash), static_cast<uint32_t>(index));
+
+        auto position = (code & line_mask) * slots_per_line;
+        while (table[position].tag != empty_tag)
+            position = (position + 1) % slots;
+
+        table[position] = *entry;
+    }
+
+    storage_.swap(storage);
+    slots_ = table;
+    lines_ = lines;
+    erased_ = 0;
+}
+
+// Lookup.
+//-----------------------------------------------------------------------------
+
+// private
+utxo_set::slot* utxo_set::locate(uint64_t code, const hash_digest& hash,
+    uint32_t index) const
+{
+    if (lines_ == 0)
+        return nullptr;
+
+    const auto tag = to_tag(code);
+    const auto slots = lines_ * slots_per_line;
+    auto position = (code & (lines_ - 1)) * slots_per_line;
+
+    // The load limit ensures that an empty slot terminates the probe.
+    for (; slots_[position].tag != empty_tag;
+        position = (position + 1) % slots)
+    {
+        const auto& entry = slots_[position];
+
+        if (entry.tag != tag)
+            continue;
+
+        const auto record = to_record(entry.offset);
+
+        if (std::memcmp(record, hash.data(), hash_size) != 0)
+            continue;
+
+        auto source = make_unsafe_deserializer(record + hash_size);
+        source.read_variable_base128();
+
+        if (source.read_variable_base128() == index)
+            return &slots_[position];
+    }
+
+    return nullptr;
+}
+
+bool utxo_set::find(output& out_output, size_t& out_height,
+    bool& out_coinbase, const output_point& point) const
+{
+    const auto code = to_code(to_code(point.hash()), point.index());
+    const auto entry = locate(code, point.hash(), point.index());
+
+    if (entry == nullptr)
+        return false;
+
+    auto source = make_unsafe_deserializer(to_record(entry->offset) +
+        hash_size);
+    source.read_variable_base128();
+    source.read_variable_base128();
+    const auto flags = source.read_variable_base128();
+
+    out_height = static_cast<size_t>(flags >> flag_bits);
+    out_coinbase = (flags & coinbase_flag) != 0;
+    out_output.from_compact(source);
+    return true;
+}
+
+bool utxo_set::contains(const output_point& point) const
+{
+    const auto code = to_code(to_code(point.hash()), point.index());
+    return locate(code, point.hash(), point.index()) != nullptr;
+}
+
+// Records are sorted by reference, decoding the index once per record.
+bool utxo_set::visit(visitor handler) const
+{
+    struct reference
+    {
+        uint32_t offset;
+        uint32_t index;
+    };
+
+    std::vector<reference> references;
+    references.reserve(live_);
+    const auto slots = lines_ * slots_per_line;
+
+    for (auto entry = slots_; entry != slots_ + slots; ++entry)
+    {
+        if (entry->tag < first_tag)
+            continue;
+
+        auto source = make_unsafe_deserializer(to_record(entry->offset) +
+            hash_size);
+        source.read_variable_base128();
+        const auto index = source.read_variable_base128();
+        references.push_back({ entry->offset, static_cast<uint32_t>(index) });
+    }
+
+    const auto ascending = [this](const reference& left,
+        const reference& right)
+    {
+        const auto order = std::memcmp(to_record(left.offset),
+            to_record(right.offset), hash_size);
+        return order == 0 ? left.index < right.index : order < 0;
+    };
+
+    std::sort(references.begin(), references.end(), ascending);
+    output_point point;
+    output value;
+
+    for (const auto& item: references)
+    {
+        auto source = make_unsafe_deserializer(to_record(item.offset));
+        point.set_hash(source.read_hash());
+        point.set_index(item.index);
+        source.read_variable_base128();
+        source.read_variable_base128();
+        const auto flags = source.read_variable_base128();
+
+        value.from_compact(source);
+        const auto height = static_cast<size_t>(flags >> flag_bits);
+        const auto coinbase = (flags & coinbase_flag) != 0;
+
+        if (!handler(point, value, height, coinbase))
+            return false;
+    }
+
+    return true;
+}
+
+// Insertion.
+//-----------------------------------------------------------------------------
+
+// private
+// Allocate the record and its slot, returning the position of the compact
+// output to be written, or nullptr if present and not replaced.
+uint8_t* utxo_set::emplace(uint64_t code, const hash_digest& hash,
+    uint32_t index, size_t height, bool coinbase, size_t compact_size,
+    bool replace)
+{
+    const auto existing = locate(code, hash, index);
+
+    if (existing != nullptr)
+    {
+        if (!replace)
+            return nullptr;
+
+        remove(*existing);
+    }
+
+    // Grow if live slots would exceed half of the limit, otherwise rehash
+    // in place to recover the erased slots.
+    const auto limit = lines_ * slots_per_line * load_numerator /
+        load_denominator;
+
+    if (live_ + erased_ + 1 > limit)
+        rehash(lines_ == 0 ? 1 : (live_ + 1 > limit / 2 ? lines_ << 1 :
+            lines_));
+
+    const auto flags = (uint64_t(height) << flag_bits) |
+        (coinbase ? coinbase_flag : 0);
+    const auto body = message::variable_base128_size(index) +
+        message::variable_base128_size(flags) + compact_size;
+    const auto size = hash_size + message::variable_base128_size(body) + body;
+
+    const auto offset = allocate(size);
+    auto sink = make_unsafe_serializer(to_record(offset));
+    sink.write_hash(hash);
+    sink.write_variable_base128(body);
+    sink.write_variable_base128(index);
+    sink.write_variable_base128(flags);
+    const auto compact = to_record(offset) + (size - compact_size);
+
+    // The point is not present, so the first free slot of the probe is used.
+    const auto slots = lines_ * slots_per_line;
+    auto position = (code & (lines_ - 1)) * slots_per_line;
+    while (slots_[position].tag >= first_tag)
+        position = (position + 1) % slots;
+
+    if (slots_[position].tag == erased_tag)
+        --erased_;
+
+    slots_[position] = slot{ to_tag(code), offset };
+    ++live_;
+    return compact;
+}
+
+// private
+bool utxo_set::insert(uint64_t code, const hash_digest& hash, uint32_t index,
+    const output& output, size_t height, bool coinbase, bool replace)
+{
+    const auto compact = emplace(code, hash, index, height, coinbase,
+        output.compact_size(), replace);
+
+    if (compact == nullptr)
+        return false;
+
+    auto sink = make_unsafe_serializer(compact);
+    output.to_compact(sink);
+    return true;
+}
+
+bool utxo_set::insert(const output_point& point, const output& output,
+    size_t height, bool coinbase)
+{
+    if (output.script().is_unspendable())
+        return true;
+
+    const auto code = to_code(to_code(point.hash()), point.index());
+    return insert(code, point.hash(), point.index(), output, height, coinbase,
+        false);
+}
+
+bool utxo_set::insert_compact(const hash_digest& hash, uint32_t index,
+    const data_slice& compact, size_t height, bool coinbase)
+{
+    const auto code = to_code(to_code(hash), index);
+    const auto record = emplace(code, hash, index, height, coinbase,
+        compact.size(), false);
+
+    if (record == nullptr)
+        return false;
+
+    std::memcpy(record, compact.data(), compact.size());
+    return true;
+}
+
+void utxo_set::insert(const block& block, size_t height)
+{
+    for (const auto& tx: block.transactions())
+    {
+        const auto hash = tx.hash();
+        const auto base = to_code(hash);
+        const auto coinbase = tx.is_coinbase();
+        const auto& outputs = tx.outputs();
+
+        for (uint32_t index = 0; index < outputs.size(); ++index)
+        {
+            const auto& output = outputs[index];
+
+            if (!output.script().is_unspendable())
+                insert(to_code(base, index), hash, index, output, height,
+                    coinbase, true);
+        }
+    }
+}
+
+// Removal.
+//-----------------------------------------------------------------------------
+
+// private
+void utxo_set::remove(slot& entry)
+{
+    garbage_ += to_units(record_size(to_record(entry.offset)));
+    entry.tag = erased_tag;
+    ++erased_;
+    --live_;
+
+    // Compact once more than half of multiple pages is garbage.
+    if (garbage_ > cursor_ / 2 && cursor_ > page_units)
+        compact();
+}
+
+bool utxo_set::erase(const output_point& point)
+{
+    const auto code = to_code(to_code(point.hash()), point.index());
+    const auto entry = locate(code, point.hash(), point.index());
+
+    if (entry == nullptr)
+        return false;
+
+    remove(*entry);
+    return true;
+}
+
+bool utxo_set::erase(const block& block)
+{
+    auto result = true;
+
+    for (const auto& tx: block.transactions())
+    {
+        if (tx.is_coinbase())
+            continue;
+
+        for (const auto& input: tx.inputs())
+            result &= erase(input.previous_output());
+    }
+
+    return result;
+}
+
+// Population.
+//-----------------------------------------------------------------------------
+
+code utxo_set::populate(const output_point::list& points)
+{
+    size_t height;
+    bool coinbase;
+
+    for (const auto& point: points)
+    {
+        auto& metadata = *point.metadata;
+        metadata.cache = output{};
+        metadata.spent = false;
+        metadata.candidate = false;
+        metadata.confirmed = find(metadata.cache, height, coinbase, point);
+
+        if (metadata.confirmed)
+        {
+            metadata.height = height;
+            metadata.coinbase = coinbase;
+        }
+    }
+
+    return error::success;
+}
+
+// Properties.
+//-----------------------------------------------------------------------------
+
+void utxo_set::clear()
+{
+    table().swap(storage_);
+    pages().swap(pages_);
+    slots_ = nullptr;
+    lines_ = 0;
+    live_ = 0;
+    erased_ = 0;
+    cursor_ = 0;
+    garbage_ = 0;
+}
+
+size_t utxo_set::size() const
+{
+    return live_;
+}
+
+size_t utxo_set::allocated() const
+{
+    return storage_.capacity() * sizeof(slot) +
+        pages_.size() * page_units * unit_size;
+}
+
+} // namespace chain
+} // namespace libbitcoin
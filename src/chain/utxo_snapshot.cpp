@@ -0,0 +1,468 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/chain/utxo_snapshot.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <mutex>
+#include <vector>
+#include <boost/filesystem.hpp>
+#include <boost/system/error_code.hpp>
+#include <bitcoin/bitcoin/chain/output.hpp>
+#include <bitcoin/bitcoin/chain/output_point.hpp>
+#include <bitcoin/bitcoin/chain/utxo_set.hpp>
+#include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/math/muhash.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/parallel.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+// The payload size is written in four bytes, with space for a final output.
+static const size_t maximum_chunk_size = size_t(1) << 30;
+
+// The payload size and output count precede the payload hash.
+static const size_t frame_prefix = 2 * sizeof(uint32_t);
+
+// The height is combined with the coinbase flag.
+static const uint64_t coinbase_flag = 1;
+
+// Points are ordered by hash (as bytes) and then index.
+static bool is_ascending(const uint8_t* hash, uint32_t index,
+    const uint8_t* next_hash, uint32_t next_index)
+{
+    const auto order = std::memcmp(hash, next_hash, hash_size);
+    return order == 0 ? index < next_index : order < 0;
+}
+
+// The set element of an output, as serialized by transaction::utxo_delta.
+static void to_element(data_chunk& out, const uint8_t* hash, uint32_t index,
+    uint64_t flags, const output& output)
+{
+    out.clear();
+    byte_writer sink(out);
+    sink.write_bytes(hash, hash_size);
+    sink.write_4_bytes_little_endian(index);
+    sink.write_4_bytes_little_endian(static_cast<uint32_t>(flags));
+    output.to_data(sink);
+}
+
+static uint64_t to_flags(size_t height, bool coinbase)
+{
+    return (uint64_t(height) << 1) | (coinbase ? coinbase_flag : 0);
+}
+
+// utxo_snapshot
+//-----------------------------------------------------------------------------
+
+utxo_snapshot::utxo_snapshot()
+  : block_hash_(null_hash), height_(0), outputs_(0), set_hash_(null_hash)
+{
+}
+
+bool utxo_snapshot::open(const path& file)
+{
+    close();
+    boost::system::error_code ec;
+
+    // An empty file cannot be mapped.
+    if (boost::filesystem::file_size(file, ec) == 0 || ec)
+        return false;
+
+    try
+    {
+        file_.open(file.string());
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+
+    if (!file_.is_open())
+        return false;
+
+    const auto begin = reinterpret_cast<const uint8_t*>(file_.data());
+
+    if (!read_frames({ begin, begin + file_.size() }))
+    {
+        close();
+        return false;
+    }
+
+    return true;
+}
+
+// private
+// The frames are skipped over, so opening is independent of the set size.
+bool utxo_snapshot::read_frames(data_slice data)
+{
+    byte_reader source(data);
+
+    if (source.read_4_bytes_little_endian() != magic ||
+        source.read_byte() != version)
+        return false;
+
+    block_hash_ = source.read_hash();
+    height_ = source.read_4_bytes_little_endian();
+    uint64_t outputs = 0;
+
+    while (source)
+    {
+        const auto frame = data.data() + (data.size() - source.remaining());
+        const size_t size = source.read_4_bytes_little_endian();
+
+        // The trailer is distinguished by an empty payload.
+        if (size == 0)
+            break;
+
+        const size_t count = source.read_4_bytes_little_endian();
+        source.skip(hash_size + size);
+        chunks_.push_back({ frame, size, count });
+        outputs += count;
+    }
+
+    outputs_ = source.read_8_bytes_little_endian();
+    set_hash_ = source.read_hash();
+    return source && source.is_exhausted() && outputs_ == outputs;
+}
+
+void utxo_snapshot::close()
+{
+    if (file_.is_open())
+        file_.close();
+
+    block_hash_ = null_hash;
+    height_ = 0;
+    outputs_ = 0;
+    set_hash_ = null_hash;
+    chunks_.clear();
+}
+
+bool utxo_snapshot::is_open() const
+{
+    return file_.is_open();
+}
+
+const hash_digest& utxo_snapshot::block_hash() const
+{
+    return block_hash_;
+}
+
+size_t utxo_snapshot::height() const
+{
+    return height_;
+}
+
+size_t utxo_snapshot::size() const
+{
+    return static_cast<size_t>(outputs_);
+}
+
+size_t utxo_snapshot::chunks() const
+{
+    return chunks_.size();
+}
+
+const hash_digest& utxo_snapshot::set_hash() const
+{
+    return set_hash_;
+}
+
+// Each chunk is hashed, decoded and its partial set hash computed in
+// parallel. Decoded outputs are then inserted under a lock, in their compact
+// form as read, which is a small part of the work of a chunk. As insertion
+// order does not affect the set, chunks are inserted as they complete, and
+// the order of chunks is verified from their first and last points.
+code utxo_snapshot::load(utxo_set& set, threadpool& pool) const
+{
+    if (!is_open())
+        return error::operation_failed;
+
+    struct entry
+    {
+        const uint8_t* hash;
+        uint32_t index;
+        uint64_t flags;
+        const uint8_t* begin;
+        const uint8_t* end;
+    };
+
+    struct bounds
+    {
+        const uint8_t* first_hash;
+        uint32_t first_index;
+        const uint8_t* last_hash;
+        uint32_t last_index;
+    };
+
+    std::vector<bounds> ranges(chunks_.size());
+    std::mutex mutex;
+    muhash total;
+
+    set.reserve(set.size() + size());
+
+    const auto load_chunk = [&](size_t position) -> code
+    {
+        const auto& chunk = chunks_[position];
+        const auto digest = chunk.frame + frame_prefix;
+        const auto payload = digest + hash_size;
+        const data_slice data(payload, payload + chunk.size);
+        const auto hash = sha256_hash(data);
+
+        if (!std::equal(hash.begin(), hash.end(), digest))
+            return error::bad_stream;
+
+        std::vector<entry> entries;
+        entries.reserve(chunk.outputs);
+        data_chunk element;
+        output value;
+        muhash partial;
+
+        byte_reader source(data);
+        const auto offset = [&]()
+        {
+            return payload + (chunk.size - source.remaining());
+        };
+
+        while (source && !source.is_exhausted())
+        {
+            const auto group = offset();
+            source.skip(hash_size);
+            const auto count = source.read_variable_base128();
+
+            // Groups are distinct and ascending by hash within a chunk.
+            if (count == 0 || (!entries.empty() &&
+                std::memcmp(entries.back().hash, group, hash_size) >= 0))
+                return error::bad_stream;
+
+            uint64_t index = 0;
+
+            for (uint64_t number = 0; source && number < count; ++number)
+            {
+                const auto delta = source.read_variable_base128();
+                const auto flags = source.read_variable_base128();
+                const auto begin = offset();
+
+                if (delta > max_uint32)
+                    return error::bad_stream;
+
+                index = (number == 0 ? delta : index + delta + 1);
+
+                if (index > max_uint32 || !value.from_compact(source) ||
+                    value.script().is_unspendable())
+                    return error::bad_stream;
+
+                const auto point_index = static_cast<uint32_t>(index);
+                entries.push_back({ group, point_index, flags, begin,
+                    offset() });
+
+                to_element(element, group, point_index, flags, value);
+                partial.insert(element);
+            }
+        }
+
+        if (!source || entries.size() != chunk.outputs)
+            return error::bad_stream;
+
+        const auto& first = entries.front();
+        const auto& last = entries.back();
+        ranges[position] =
+        {
+            first.hash, first.index, last.hash, last.index
+        };
+
+        hash_digest point_hash;
+        std::lock_guard<std::mutex> lock(mutex);
+        total *= partial;
+
+        for (const auto& entry: entries)
+        {
+            std::copy_n(entry.hash, hash_size, point_hash.begin());
+
+            if (!set.insert_compact(point_hash, entry.index,
+                { entry.begin, entry.end },
+                static_cast<size_t>(entry.flags >> 1),
+                (entry.flags & coinbase_flag) != 0))
+                return error::unspent_duplicate;
+        }
+
+        return error::success;
+    };
+
+    const auto ec = parallel_for(pool, chunks_.size(), 1, load_chunk);
+
+    if (ec)
+        return ec;
+
+    for (size_t position = 1; position < ranges.size(); ++position)
+    {
+        const auto& prior = ranges[position - 1];
+        const auto& next = ranges[position];
+
+        if (!is_ascending(prior.last_hash, prior.last_index, next.first_hash,
+            next.first_index))
+            return error::bad_stream;
+    }
+
+    return total.digest() == set_hash_ ? error::success : error::bad_stream;
+}
+
+// utxo_snapshot_writer
+//-----------------------------------------------------------------------------
+
+utxo_snapshot_writer::utxo_snapshot_writer(std::ostream& stream,
+    const hash_digest& block_hash, size_t height, size_t chunk_size)
+  : stream_(stream),
+    chunk_size_(std::min(std::max(chunk_size, size_t(1)),
+        maximum_chunk_size)),
+    outputs_(0),
+    finished_(false),
+    chunk_outputs_(0),
+    group_outputs_(0),
+    hash_(null_hash),
+    index_(0),
+    empty_(true)
+{
+    data_chunk header;
+    byte_writer sink(header);
+    sink.write_4_bytes_little_endian(utxo_snapshot::magic);
+    sink.write_byte(utxo_snapshot::version);
+    sink.write_hash(block_hash);
+    sink.write_4_bytes_little_endian(static_cast<uint32_t>(height));
+    stream_.write(reinterpret_cast<const char*>(header.data()),
+        header.size());
+}
+
+bool utxo_snapshot_writer::write(const output_point& point,
+    const output& output, size_t height, bool coinbase)
+{
+    const auto& hash = point.hash();
+    const auto index = point.index();
+
+    if (finished_ || !stream_ || output.script().is_unspendable() ||
+        (!empty_ && !is_ascending(hash_.data(), index_, hash.data(), index)))
+        return false;
+
+    if (empty_ || hash != hash_)
+        close_group();
+
+    const auto first = (group_outputs_ == 0);
+    const auto flags = to_flags(height, coinbase);
+    byte_writer sink(group_);
+    sink.write_variable_base128(first ? index : index - index_ - 1);
+    sink.write_variable_base128(flags);
+    output.to_compact(sink);
+
+    to_element(element_, hash.data(), index, flags, output);
+    set_.insert(element_);
+
+    hash_ = hash;
+    index_ = index;
+    empty_ = false;
+    ++group_outputs_;
+    ++chunk_outputs_;
+    ++outputs_;
+
+    if (payload_.size() + group_.size() >= chunk_size_)
+        write_chunk();
+
+    return !!stream_;
+}
+
+bool utxo_snapshot_writer::write(const utxo_set& set)
+{
+    return set.visit([this](const output_point& point, const output& output,
+        size_t height, bool coinbase)
+    {
+        return write(point, output, height, coinbase);
+    });
+}
+
+bool utxo_snapshot_writer::finish()
+{
+    if (finished_)
+        return false;
+
+    write_chunk();
+    finished_ = true;
+
+    data_chunk trailer;
+    byte_writer sink(trailer);
+    sink.write_4_bytes_little_endian(0);
+    sink.write_8_bytes_little_endian(outputs_);
+    sink.write_hash(set_.digest());
+    stream_.write(reinterpret_cast<const char*>(trailer.data()),
+        trailer.size());
+    stream_.flush();
+    return !!stream_;
+}
+
+size_t utxo_snapshot_writer::size() const
+{
+    return static_cast<size_t>(outputs_);
+}
+
+// private
+void utxo_snapshot_writer::close_group()
+{
+    if (group_outputs_ == 0)
+        return;
+
+    byte_writer sink(payload_);
+    sink.write_hash(hash_);
+    sink.write_variable_base128(group_outputs_);
+    sink.write_bytes(group_);
+    group_.clear();
+    group_outputs_ = 0;
+}
+
+// private
+void utxo_snapshot_writer::write_chunk()
+{
+    close_group();
+
+    if (chunk_outputs_ == 0)
+        return;
+
+    data_chunk frame;
+    frame.reserve(frame_prefix + hash_size);
+    byte_writer sink(frame);
+    sink.write_4_bytes_little_endian(static_cast<uint32_t>(payload_.size()));
+    sink.write_4_bytes_little_endian(static_cast<uint32_t>(chunk_outputs_));
+    sink.write_hash(sha256_hash(payload_));
+    stream_.write(reinterpret_cast<const char*>(frame.data()), frame.size());
+    stream_.write(reinterpret_cast<const char*>(payload_.data()),
+        payload_.size());
+
+    payload_.clear();
+    chunk_outputs_ = 0;
+}
+
+} // namespace chain
+} // namespace libbitcoin
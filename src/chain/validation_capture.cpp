@@ -0,0 +1,327 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/chain/validation_capture.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <utility>
+#include <bitcoin/bitcoin/chain/block.hpp>
+#include <bitcoin/bitcoin/chain/chain_state.hpp>
+#include <bitcoin/bitcoin/chain/output_point.hpp>
+#include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/settings.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
+#include <bitcoin/bitcoin/utility/istream_reader.hpp>
+#include <bitcoin/bitcoin/utility/ostream_writer.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+enum capture_flags : uint8_t
+{
+    coinbase_flag = 1,
+    found_flag = 2,
+    confirmed_flag = 4,
+    candidate_flag = 8,
+    spent_flag = 16
+};
+
+// Bounds a deserialized count to guard against allocation of garbage.
+static const size_t maximum_count = max_block_size;
+
+static void write_window(writer& sink, uint32_t self,
+    const chain_state::bitss& ordered)
+{
+    sink.write_4_bytes_little_endian(self);
+    sink.write_variable_little_endian(ordered.size());
+
+    for (const auto value: ordered)
+        sink.write_4_bytes_little_endian(value);
+}
+
+static void read_window(reader& source, chain_state::bitss& ordered)
+{
+    const auto count = source.read_variable_little_endian();
+
+    if (count > maximum_count)
+    {
+        source.invalidate();
+        return;
+    }
+
+    for (uint64_t index = 0; source && index < count; ++index)
+        ordered.push_back(source.read_4_bytes_little_endian());
+}
+
+// Constructors.
+//-----------------------------------------------------------------------------
+
+validation_capture::validation_capture()
+  : forks_(0), values_()
+{
+}
+
+validation_capture::validation_capture(const block& block,
+    const chain_state& state)
+  : block_(block.to_data(true)),
+    forks_(state.forks()),
+    values_(state.values())
+{
+    const auto& txs = block.transactions();
+
+    if (txs.empty())
+        return;
+
+    prevouts_.reserve(block.total_non_coinbase_inputs());
+
+    for (auto tx = txs.begin() + 1; tx != txs.end(); ++tx)
+    {
+        for (const auto& input: tx->inputs())
+        {
+            const auto metadata = input.previous_output().metadata.peek();
+            prevouts_.push_back(metadata == nullptr ?
+                output_point::validation{} : *metadata);
+        }
+    }
+}
+
+// Deserialization.
+//-----------------------------------------------------------------------------
+
+validation_capture validation_capture::factory(const data_chunk& data)
+{
+    validation_capture instance;
+    instance.from_data(data);
+    return instance;
+}
+
+validation_capture validation_capture::factory(std::istream& stream)
+{
+    validation_capture instance;
+    instance.from_data(stream);
+    return instance;
+}
+
+validation_capture validation_capture::factory(reader& source)
+{
+    validation_capture instance;
+    instance.from_data(source);
+    return instance;
+}
+
+bool validation_capture::from_data(const data_chunk& data)
+{
+    byte_reader source(data);
+    return from_data(source);
+}
+
+bool validation_capture::from_data(std::istream& stream)
+{
+    istream_reader source(stream);
+    return from_data(source);
+}
+
+bool validation_capture::from_data(reader& source)
+{
+    reset();
+
+    if (source.read_4_bytes_little_endian() != magic ||
+        source.read_byte() != version)
+        source.invalidate();
+
+    const auto size = source.read_variable_little_endian();
+
+    if (size > max_block_weight)
+        source.invalidate();
+    else
+        block_ = source.read_bytes(static_cast<size_t>(size));
+
+    forks_ = source.read_4_bytes_little_endian();
+    values_.height = static_cast<size_t>(
+        source.read_variable_little_endian());
+    values_.hash = source.read_hash();
+    values_.bip9_bit0_hash = source.read_hash();
+    values_.bip9_bit1_hash = source.read_hash();
+    values_.bits.self = source.read_4_bytes_little_endian();
+    read_window(source, values_.bits.ordered);
+    values_.version.self = source.read_4_bytes_little_endian();
+    read_window(source, values_.version.ordered);
+    values_.timestamp.self = source.read_4_bytes_little_endian();
+    values_.timestamp.retarget = source.read_4_bytes_little_endian();
+    read_window(source, values_.timestamp.ordered);
+
+    const auto count = source.read_variable_little_endian();
+
+    if (count > maximum_count)
+        source.invalidate();
+    else
+        prevouts_.resize(static_cast<size_t>(count));
+
+    for (auto& prevout: prevouts_)
+    {
+        if (!source)
+            break;
+
+        const auto flags = source.read_byte();
+        prevout.coinbase = (flags & coinbase_flag) != 0;
+        prevout.confirmed = (flags & confirmed_flag) != 0;
+        prevout.candidate = (flags & candidate_flag) != 0;
+        prevout.spent = (flags & spent_flag) != 0;
+        prevout.height = static_cast<size_t>(
+            source.read_variable_little_endian());
+        prevout.median_time_past = source.read_4_bytes_little_endian();
+
+        if ((flags & found_flag) != 0)
+            prevout.cache.from_data(source);
+    }
+
+    if (!source)
+        reset();
+
+    return source;
+}
+
+// protected
+void validation_capture::reset()
+{
+    block_.clear();
+    block_.shrink_to_fit();
+    forks_ = 0;
+    values_ = chain_state::data();
+    prevouts_.clear();
+    prevouts_.shrink_to_fit();
+}
+
+bool validation_capture::is_valid() const
+{
+    return !block_.empty();
+}
+
+// Serialization.
+//-----------------------------------------------------------------------------
+
+data_chunk validation_capture::to_data() const
+{
+    data_chunk data;
+    byte_writer sink(data);
+    to_data(sink);
+    return data;
+}
+
+void validation_capture::to_data(std::ostream& stream) const
+{
+    ostream_writer sink(stream);
+    to_data(sink);
+}
+
+void validation_capture::to_data(writer& sink) const
+{
+    sink.write_4_bytes_little_endian(magic);
+    sink.write_byte(version);
+    sink.write_variable_little_endian(block_.size());
+    sink.write_bytes(block_);
+    sink.write_4_bytes_little_endian(forks_);
+    sink.write_variable_little_endian(values_.height);
+    sink.write_hash(values_.hash);
+    sink.write_hash(values_.bip9_bit0_hash);
+    sink.write_hash(values_.bip9_bit1_hash);
+    write_window(sink, values_.bits.self, values_.bits.ordered);
+    write_window(sink, values_.version.self, values_.version.ordered);
+    sink.write_4_bytes_little_endian(values_.timestamp.self);
+    write_window(sink, values_.timestamp.retarget, values_.timestamp.ordered);
+    sink.write_variable_little_endian(prevouts_.size());
+
+    for (const auto& prevout: prevouts_)
+    {
+        const auto found = prevout.cache.is_valid();
+        const uint8_t flags =
+            (prevout.coinbase ? coinbase_flag : 0) |
+            (found ? found_flag : 0) |
+            (prevout.confirmed ? confirmed_flag : 0) |
+            (prevout.candidate ? candidate_flag : 0) |
+            (prevout.spent ? spent_flag : 0);
+
+        sink.write_byte(flags);
+        sink.write_variable_little_endian(prevout.height);
+        sink.write_4_bytes_little_endian(prevout.median_time_past);
+
+        if (found)
+            prevout.cache.to_data(sink);
+    }
+}
+
+// Properties.
+//-----------------------------------------------------------------------------
+
+const data_chunk& validation_capture::block_data() const
+{
+    return block_;
+}
+
+uint32_t validation_capture::forks() const
+{
+    return forks_;
+}
+
+const chain_state::data& validation_capture::values() const
+{
+    return values_;
+}
+
+const validation_capture::prevouts&
+    validation_capture::previous_outputs() const
+{
+    return prevouts_;
+}
+
+// Replay.
+//-----------------------------------------------------------------------------
+
+bool validation_capture::to_block(block& out) const
+{
+    if (!out.from_data(block_, true))
+        return false;
+
+    const auto& txs = out.transactions();
+
+    if (txs.empty() || out.total_non_coinbase_inputs() != prevouts_.size())
+        return false;
+
+    auto prevout = prevouts_.begin();
+
+    for (auto tx = txs.begin() + 1; tx != txs.end(); ++tx)
+        for (const auto& input: tx->inputs())
+            input.previous_output().metadata = *prevout++;
+
+    return true;
+}
+
+chain_state::ptr validation_capture::to_state(
+    const bc::settings& settings) const
+{
+    auto values = values_;
+    return std::make_shared<chain_state>(std::move(values),
+        chain_state::checkpoints{}, forks_, 0, settings);
+}
+
+} // namespace chain
+} // namespace libbitcoin
@@ -0,0 +1,155 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHAIN_WIRE_CURSOR_HPP
+#define LIBBITCOIN_CHAIN_WIRE_CURSOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/utility/endian.hpp>
+
+namespace libbitcoin {
+namespace chain {
+
+/// Bounded forward cursor over a borrowed wire buffer, used by the views.
+/// Reads never allocate and any overrun invalidates the cursor permanently.
+class wire_cursor
+{
+public:
+    wire_cursor(const uint8_t* begin, const uint8_t* end)
+      : valid_(begin <= end), position_(begin), end_(end)
+    {
+    }
+
+    operator bool() const
+    {
+        return valid_;
+    }
+
+    const uint8_t* position() const
+    {
+        return position_;
+    }
+
+    size_t remaining() const
+    {
+        return valid_ ? static_cast<size_t>(end_ - position_) : 0;
+    }
+
+    bool skip(size_t size)
+    {
+        if (size > remaining())
+            return invalidate();
+
+        position_ += size;
+        return true;
+    }
+
+    bool peek_byte(uint8_t& out) const
+    {
+        if (remaining() < 1)
+            return false;
+
+        out = *position_;
+        return true;
+    }
+
+    bool read_4_bytes(uint32_t& out)
+    {
+        if (remaining() < sizeof(uint32_t))
+            return invalidate();
+
+        out = from_little_endian_unsafe<uint32_t>(position_);
+        position_ += sizeof(uint32_t);
+        return true;
+    }
+
+    bool read_8_bytes(uint64_t& out)
+    {
+        if (remaining() < sizeof(uint64_t))
+            return invalidate();
+
+        out = from_little_endian_unsafe<uint64_t>(position_);
+        position_ += sizeof(uint64_t);
+        return true;
+    }
+
+    // Non-minimal encodings are accepted, as with the owning deserializers.
+    bool read_variable(uint64_t& out)
+    {
+        if (remaining() < 1)
+            return invalidate();
+
+        const auto prefix = *position_++;
+        size_t size;
+
+        switch (prefix)
+        {
+            case varint_eight_bytes:
+                size = sizeof(uint64_t);
+                break;
+            case varint_four_bytes:
+                size = sizeof(uint32_t);
+                break;
+            case varint_two_bytes:
+                size = sizeof(uint16_t);
+                break;
+            default:
+                out = prefix;
+                return true;
+        }
+
+        if (remaining() < size)
+            return invalidate();
+
+        out = 0;
+        for (size_t byte = 0; byte < size; ++byte)
+            out |= static_cast<uint64_t>(position_[byte]) << (8 * byte);
+
+        position_ += size;
+        return true;
+    }
+
+    // Byte sizes and element counts cannot exceed the remaining bytes.
+    bool read_size(size_t& out)
+    {
+        uint64_t value;
+        if (!read_variable(value) || value > remaining())
+            return invalidate();
+
+        out = static_cast<size_t>(value);
+        return true;
+    }
+
+private:
+    bool invalidate()
+    {
+        valid_ = false;
+        return false;
+    }
+
+    bool valid_;
+    const uint8_t* position_;
+    const uint8_t* end_;
+};
+
+} // namespace chain
+} // namespace libbitcoin
+
+#endif
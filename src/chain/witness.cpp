@@ -32,10 +32,12 @@
 #include <bitcoin/bitcoin/machine/operation.hpp>
 #include <bitcoin/bitcoin/machine/program.hpp>
 #include <bitcoin/bitcoin/machine/script_pattern.hpp>
+#include <bitcoin/bitcoin/machine/verification_context.hpp>
 #include <bitcoin/bitcoin/message/messages.hpp>
 #include <bitcoin/bitcoin/utility/assert.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
 #include <bitcoin/bitcoin/utility/collection.hpp>
-#include <bitcoin/bitcoin/utility/container_sink.hpp>
 #include <bitcoin/bitcoin/utility/container_source.hpp>
 #include <bitcoin/bitcoin/utility/data.hpp>
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
@@ -56,12 +58,15 @@ witness::witness()
 }
 
 witness::witness(witness&& other)
-  : stack_(std::move(other.stack_)), valid_(other.valid_)
+  : valid_(other.valid_), stack_(std::move(other.stack_)),
+    deferred_(std::move(other.deferred_)),
+    embedded_(std::move(other.embedded_))
 {
 }
 
 witness::witness(const witness& other)
-  : stack_(other.stack_), valid_(other.valid_)
+  : valid_(other.valid_), stack_(other.stack_), deferred_(other.deferred_),
+    embedded_(other.embedded_)
 {
 }
 
@@ -93,6 +98,8 @@ witness& witness::operator=(witness&& other)
     reset();
     stack_ = std::move(other.stack_);
     valid_ = other.valid_;
+    deferred_ = std::move(other.deferred_);
+    embedded_ = std::move(other.embedded_);
     return *this;
 }
 
@@ -101,11 +108,14 @@ witness& witness::operator=(const witness& other)
     reset();
     stack_ = other.stack_;
     valid_ = other.valid_;
+    deferred_ = other.deferred_;
+    embedded_ = other.embedded_;
     return *this;
 }
+
 bool witness::operator==(const witness& other) const
 {
-    return stack_ == other.stack_;
+    return parsed() == other.parsed();
 }
 
 bool witness::operator!=(const witness& other) const
@@ -153,45 +163,116 @@ bool witness::from_data(std::istream& stream, bool prefix)
 }
 
 // Prefixed data assumed valid here though caller may confirm with is_valid.
+// The stack and its elements are read in place, retaining their capacity.
 bool witness::from_data(reader& source, bool prefix)
+{
+    valid_ = true;
+    embedded_.reset();
+    deferred_.reset();
+    read_stack(stack_, source, prefix);
+
+    if (!source)
+        reset();
+
+    return source;
+}
+
+// The element sizes are validated as they are skipped, so the parse of a
+// deferred stack cannot fail.
+bool witness::from_data(reader& source, encoding_ptr data)
 {
     reset();
+
+    if (!data || source.remaining() > data->size())
+    {
+        source.invalidate();
+        return false;
+    }
+
+    const auto offset = data->size() - source.remaining();
+    skip(source);
+
+    if (!source)
+        return false;
+
+    const auto begin = data->data() + offset;
+    const auto size = (data->size() - source.remaining()) - offset;
+    byte_reader prefix({ begin, begin + size });
+    const auto count = prefix.read_size_little_endian();
     valid_ = true;
 
-    const auto read_element = [](reader& source)
+    // An empty witness is not deferred, so is_segregated does not parse.
+    if (count > 0)
+        deferred_ = deferred{ data, offset, size, count, {} };
+
+    return true;
+}
+
+// static
+void witness::skip(reader& source)
+{
+    auto count = read_count(source, 1, max_block_weight);
+
+    for (; count > 0 && source; --count)
+        source.skip(read_count(source, 1, max_block_weight));
+}
+
+bool witness::is_deferred() const
+{
+    const auto value = deferred_.peek();
+    return value != nullptr && !value->parsed;
+}
+
+// private/static
+// The stack and its elements are read in place, retaining their capacity.
+bool witness::read_stack(data_stack& stack, reader& source, bool prefix)
+{
+    const auto read_element = [](reader& source, data_chunk& out)
     {
         // Tokens encoded as variable integer prefixed byte array (bip144).
-        const auto size = source.read_size_little_endian();
-
         // The max_script_size and max_push_data_size constants limit
         // evaluation, but not all stacks evaluate, so use max_block_weight
         // to guard memory allocation here.
-        if (size > max_block_weight)
-        {
-            source.invalidate();
-            return data_chunk{};
-        }
+        const auto size = read_count(source, 1, max_block_weight);
 
-        return source.read_bytes(size);
+        if (source)
+            source.read_bytes(out, size);
+        else
+            out.clear();
     };
 
+    size_t count = 0;
+
     // TODO: optimize store serialization to avoid loop, reading data directly.
     if (prefix)
     {
         // Witness prefix is an element count, not byte length (unlike script).
         // On wire each witness is prefixed with number of elements (bip144).
-        for (auto count = source.read_size_little_endian(); count > 0; --count)
-             stack_.push_back(read_element(source));
+        // Each element consumes at least its one byte size prefix.
+        const auto elements = read_count(source, 1, max_block_weight);
+
+        // The count is not bounded by remaining bytes when reading a stream,
+        // so grow the stack as elements are read to guard allocation.
+        for (; count < elements && source; ++count)
+        {
+            if (count == stack.size())
+                stack.emplace_back();
+
+            read_element(source, stack[count]);
+        }
     }
     else
     {
-        while (!source.is_exhausted())
-            stack_.push_back(read_element(source));
-    }
+        for (; !source.is_exhausted(); ++count)
+        {
+            if (count == stack.size())
+                stack.emplace_back();
 
-    if (!source)
-        reset();
+            read_element(source, stack[count]);
+        }
+    }
 
+    stack.resize(count);
     return source;
 }
 
@@ -214,6 +295,8 @@ void witness::reset()
     valid_ = false;
     stack_.clear();
     stack_.shrink_to_fit();
+    deferred_.reset();
+    embedded_.reset();
 }
 
 bool witness::is_valid() const
@@ -230,9 +313,8 @@ data_chunk witness::to_data(bool prefix) const
     data_chunk data;
     const auto size = serialized_size(prefix);
     data.reserve(size);
-    data_sink ostream(data);
-    to_data(ostream, prefix);
-    ostream.flush();
+    byte_writer sink(data);
+    to_data(sink, prefix);
     BITCOIN_ASSERT(data.size() == size);
     return data;
 }
@@ -245,6 +327,18 @@ void witness::to_data(std::ostream& stream, bool prefix) const
 
 void witness::to_data(writer& sink, bool prefix) const
 {
+    const auto value = deferred_.peek();
+
+    // A deferred witness is written from its encoding, parsed or not.
+    if (value != nullptr)
+    {
+        const auto skipped = prefix ? 0 :
+            message::variable_uint_size(value->count);
+        sink.write_bytes(value->data->data() + value->offset + skipped,
+            value->size - skipped);
+        return;
+    }
+
     // Witness prefix is an element count, not byte length (unlike script).
     if (prefix)
         sink.write_variable_little_endian(stack_.size());
@@ -271,7 +365,8 @@ std::string witness::to_string() const
         text += "[" + encode_base16(element) + "] ";
     };
 
-    std::for_each(stack_.begin(), stack_.end(), serialize);
+    const auto& stack = parsed();
+    std::for_each(stack.begin(), stack.end(), serialize);
     return boost::trim_copy(text);
 }
 
@@ -286,40 +381,41 @@ void witness::clear()
 
 bool witness::empty() const
 {
-    return stack_.empty();
+    return size() == 0;
 }
 
 size_t witness::size() const
 {
-    return stack_.size();
+    const auto value = deferred_.peek();
+    return value != nullptr ? value->count : stack_.size();
 }
 
 const data_chunk& witness::front() const
 {
-    BITCOIN_ASSERT(!stack_.empty());
-    return stack_.front();
+    BITCOIN_ASSERT(!empty());
+    return parsed().front();
 }
 
 const data_chunk& witness::back() const
 {
-    BITCOIN_ASSERT(!stack_.empty());
-    return stack_.back();
+    BITCOIN_ASSERT(!empty());
+    return parsed().back();
 }
 
 const data_chunk& witness::operator[](size_t index) const
 {
-    BITCOIN_ASSERT(index < stack_.size());
-    return stack_[index];
+    BITCOIN_ASSERT(index < size());
+    return parsed()[index];
 }
 
 witness::iterator witness::begin() const
 {
-    return stack_.begin();
+    return parsed().begin();
 }
 
 witness::iterator witness::end() const
 {
-    return stack_.end();
+    return parsed().end();
 }
 
 // Properties (size).
@@ -327,13 +423,48 @@ witness::iterator witness::end() const
 
 size_t witness::serialized_size(bool prefix) const
 {
+    const auto value = deferred_.peek();
+
+    if (value != nullptr)
+        return value->size - (prefix ? 0 :
+            message::variable_uint_size(value->count));
+
     // Witness prefix is an element count, not a byte length (unlike script).
     return (prefix ? message::variable_uint_size(stack_.size()) : 0u) +
         serialized_size(stack_);
 }
 
+size_t witness::heap_size() const
+{
+    auto size = stack_.capacity() * sizeof(data_chunk);
+
+    for (const auto& element: stack_)
+        size += element.capacity();
+
+    return size;
+}
+
 const data_stack& witness::stack() const
 {
+    return parsed();
+}
+
+// private
+const data_stack& witness::parsed() const
+{
+    const auto value = deferred_.peek();
+
+    if (value != nullptr)
+    {
+        value->parsed.get([this, value]()
+        {
+            const auto begin = value->data->data() + value->offset;
+            byte_reader source({ begin, begin + value->size });
+            read_stack(stack_, source, true);
+            return true;
+        });
+    }
+
     return stack_;
 }
 
@@ -351,6 +482,17 @@ bool witness::is_push_size(const data_stack& stack)
     return std::all_of(stack.begin(), stack.end(), push_size);
 }
 
+// private
+bool witness::is_push_size(iterator first, iterator last)
+{
+    const auto push_size = [](const data_chunk& element)
+    {
+        return element.size() <= max_push_data_size;
+    };
+
+    return std::all_of(first, last, push_size);
+}
+
 // static
 // The (only) coinbase witness must be (arbitrary) 32-byte value (bip141).
 bool witness::is_reserved_pattern(const data_stack& stack)
@@ -375,6 +517,18 @@ operation::list witness::to_pay_key_hash(data_chunk&& program)
     };
 }
 
+// private
+// The witness script is decoded from the last element on first use only.
+const script& witness::embedded_script() const
+{
+    BITCOIN_ASSERT(!parsed().empty());
+
+    return embedded_->get([this]()
+    {
+        return script(parsed().back(), false);
+    });
+}
+
 // The return script is useful only for sigop counting.
 // Returns true if is a witness program - even if potentially invalid.
 bool witness::extract_sigop_script(script& out_script,
@@ -393,8 +547,8 @@ bool witness::extract_sigop_script(script& out_script,
                     return true;
 
                 case hash_size:
-                    if (!stack_.empty())
-                        out_script.from_data(stack_.back(), false);
+                    if (!empty())
+                        out_script.from_data(back(), false);
 
                     return true;
 
@@ -423,7 +577,7 @@ bool witness::extract_embedded_script(script& out_script,
         {
             auto program = program_script.witness_program();
             const auto program_size = program.size();
-            out_stack = stack_;
+            out_stack = parsed();
 
             // always: <signature> <pubkey>
             if (program_size == short_hash_size)
@@ -453,7 +607,71 @@ bool witness::extract_embedded_script(script& out_script,
 
                 // SHA256 of the witness script must match program (bip141).
                 return std::equal(program.begin(), program.end(),
-                    sha256_hash(out_script.to_data(false)).begin());
+                    sha256_hash(out_script.bytes()).begin());
+            }
+
+            return false;
+        }
+
+        // These versions are reserved for future extensions (bip141).
+        case script_version::reserved:
+            return true;
+
+        case script_version::unversioned:
+        default:
+            return false;
+    }
+}
+
+// Extract P2WPKH or P2WSH script without copying the witness stack.
+bool witness::extract_embedded_script(const script*& out_script,
+    iterator& out_end, script& buffer, const script& program_script) const
+{
+    const auto& stack = parsed();
+    out_script = &buffer;
+    out_end = stack.end();
+
+    switch (program_script.version())
+    {
+        // The v0 program size must be either 20 or 32 bytes (bip141).
+        case script_version::zero:
+        {
+            auto program = program_script.witness_program();
+            const auto program_size = program.size();
+
+            // always: <signature> <pubkey>
+            if (program_size == short_hash_size)
+            {
+                // Stack must be 2 elements, within push size limit (bip141).
+                if (stack.size() != 2 || !is_push_size(stack))
+                    return false;
+
+                // The hash160 of public key must match the program (bip141).
+                buffer.from_operations(to_pay_key_hash(std::move(program)));
+                return true;
+            }
+
+            // example: 0 <signature1> <1 <pubkey1> <pubkey2> 2 CHECKMULTISIG>
+            if (program_size == hash_size)
+            {
+                // The witness must consist of at least 1 item (bip141).
+                if (stack.empty())
+                    return false;
+
+                // The script is popped off the initial witness stack (bip141).
+                out_end = std::prev(stack.end());
+
+                // Stack elements must be within push size limit (bip141).
+                if (!is_push_size(stack.begin(), out_end))
+                    return false;
+
+                // SHA256 of the witness script must match program (bip141).
+                if (!std::equal(program.begin(), program.end(),
+                    sha256_hash(stack.back()).begin()))
+                    return false;
+
+                out_script = &embedded_script();
+                return true;
             }
 
             return false;
@@ -477,6 +695,14 @@ bool witness::extract_embedded_script(script& out_script,
 // It validates this witness, from which the witness script is derived.
 code witness::verify(const transaction& tx, uint32_t input_index,
     uint32_t forks, const script& program_script, uint64_t value) const
+{
+    verification_context context;
+    return verify(tx, input_index, forks, program_script, value, context);
+}
+
+code witness::verify(const transaction& tx, uint32_t input_index,
+    uint32_t forks, const script& program_script, uint64_t value,
+    verification_context& context) const
 {
     const auto version = program_script.version();
 
@@ -485,14 +711,16 @@ code witness::verify(const transaction& tx, uint32_t input_index,
         case script_version::zero:
         {
             code ec;
-            script script;
-            data_stack stack;
+            script buffer;
+            iterator end;
+            const script* script;
 
-            if (!extract_embedded_script(script, stack, program_script))
+            if (!extract_embedded_script(script, end, buffer, program_script))
                 return error::invalid_witness;
 
-            program witness(script, tx, input_index, forks, std::move(stack),
-                value, version);
+            // The initial stack is read in place from this witness.
+            program witness(*script, tx, input_index, forks, parsed().begin(),
+                end, value, version, context);
 
             if ((ec = witness.evaluate()))
                 return ec;
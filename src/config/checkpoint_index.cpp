@@ -0,0 +1,104 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/config/checkpoint_index.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <bitcoin/bitcoin/config/checkpoint.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+
+namespace libbitcoin {
+namespace config {
+
+// The sort is stable, so checkpoints at one height retain their order.
+static checkpoint::list sort_stable(const checkpoint::list& checks)
+{
+    const auto comparitor = [](const checkpoint& left, const checkpoint& right)
+    {
+        return left.height() < right.height();
+    };
+
+    auto copy = checks;
+    std::stable_sort(copy.begin(), copy.end(), comparitor);
+    return copy;
+}
+
+// The range of checkpoints at the height.
+static std::pair<checkpoint::list::const_iterator,
+    checkpoint::list::const_iterator> at_height(const checkpoint::list& checks,
+    size_t height)
+{
+    struct compare
+    {
+        bool operator()(const checkpoint& left, size_t right) const
+        {
+            return left.height() < right;
+        }
+
+        bool operator()(size_t left, const checkpoint& right) const
+        {
+            return left < right.height();
+        }
+    };
+
+    return std::equal_range(checks.begin(), checks.end(), height, compare());
+}
+
+checkpoint_index::checkpoint_index(const checkpoint::list& checks)
+  : checks_(sort_stable(checks)),
+    top_height_(checks_.empty() ? 0 : checks_.back().height())
+{
+}
+
+const checkpoint::list& checkpoint_index::checkpoints() const
+{
+    return checks_;
+}
+
+size_t checkpoint_index::top_height() const
+{
+    return top_height_;
+}
+
+bool checkpoint_index::covered(size_t height) const
+{
+    return !checks_.empty() && height <= top_height_;
+}
+
+// A hash conflicts with any checkpoint of another hash at its height.
+bool checkpoint_index::validate(const hash_digest& hash, size_t height) const
+{
+    const auto range = at_height(checks_, height);
+
+    for (auto it = range.first; it != range.second; ++it)
+        if (it->hash() != hash)
+            return false;
+
+    return true;
+}
+
+const checkpoint* checkpoint_index::find(size_t height) const
+{
+    const auto range = at_height(checks_, height);
+    return range.first == range.second ? nullptr : &*range.first;
+}
+
+} // namespace config
+} // namespace libbitcoin
@@ -18,13 +18,18 @@
  */
 #include <bitcoin/bitcoin/formats/base_10.hpp>
 
-#include <iomanip>
-#include <sstream>
-#include <boost/algorithm/string.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
 #include <bitcoin/bitcoin/constants.hpp>
 
 namespace libbitcoin {
 
+// The number of decimal digits of max_uint64.
+static BC_CONSTEXPR size_t maximum_digits = 20;
+
 /**
  * Returns true if a character is one of `[0-9]`.
  *
@@ -38,65 +43,129 @@ static bool is_digit(const char c)
     return '0' <= c && c <= '9';
 }
 
-template <char C>
-bool char_is(const char c)
+// Accumulate the digit, false on overflow.
+static bool push_digit(uint64_t& number, uint8_t digit)
 {
-    return c == C;
+    if (number > (max_uint64 - digit) / 10)
+        return false;
+
+    number = number * 10 + digit;
+    return true;
 }
 
-bool decode_base10(uint64_t& out, const std::string& amount,
+bool base10_from_chars(uint64_t& out, const char* first, const char* last,
     uint8_t decimal_places, bool strict)
 {
-    std::string value(amount);
-
-    // Get rid of the decimal point:
-    auto point = std::find(value.begin(), value.end(), '.');
-    if (point != value.end())
-        point = value.erase(point);
-
-    // Only digits should remain:
-    if (!std::all_of(value.begin(), value.end(), is_digit))
+    // Only digits and one decimal point are allowed:
+    const auto point = std::find(first, last, '.');
+    if (!std::all_of(first, point, is_digit) ||
+        (point != last && !std::all_of(point + 1, last, is_digit)))
         return false;
 
-    // Add digits to the end if there are too few:
-    auto actual_places = value.end() - point;
-    if (actual_places < decimal_places)
-        value.append(decimal_places - actual_places, '0');
+    // Digits past the decimal places are rounded upwards if not zero:
+    const auto fraction = point == last ? last : point + 1;
+    const auto places = std::min<size_t>(last - fraction, decimal_places);
+    const auto round = !std::all_of(fraction + places, last,
+        [](char c) { return c == '0'; });
 
-    // Remove digits from the end if there are too many:
-    bool round = false;
-    if (actual_places > decimal_places)
-    {
-        auto end = point + decimal_places;
-        round = !std::all_of(end, value.end(), char_is<'0'>);
-        value.erase(end, value.end());
-    }
     if (strict && round)
         return false;
 
-    // Convert to an integer:
-    std::istringstream stream(value);
+    // Convert to an integer, adding zeros if there are too few places:
     uint64_t number = 0;
-    if (value.size() && !(stream >> number))
-        return false;
+
+    for (auto it = first; it != point; ++it)
+        if (!push_digit(number, *it - '0'))
+            return false;
+
+    for (auto it = fraction; it != fraction + places; ++it)
+        if (!push_digit(number, *it - '0'))
+            return false;
+
+    for (auto zeros = places; zeros < decimal_places; ++zeros)
+        if (!push_digit(number, 0))
+            return false;
 
     // Round and return:
     if (round && number == max_uint64)
         return false;
+
     out = number + round;
     return true;
 }
 
+char* base10_to_chars(char* first, char* last, uint64_t amount,
+    uint8_t decimal_places)
+{
+    // The digits, least significant first:
+    char digits[maximum_digits];
+    size_t count = 0;
+
+    do
+    {
+        digits[count++] = '0' + amount % 10;
+        amount /= 10;
+    } while (amount != 0);
+
+    const auto digit = [&](size_t index)
+    {
+        return index < count ? digits[index] : '0';
+    };
+
+    // Trailing zeros of the fraction are omitted, as is an empty fraction:
+    size_t trailing = 0;
+    while (trailing < decimal_places && digit(trailing) == '0')
+        ++trailing;
+
+    const auto whole = count > decimal_places ? count - decimal_places : 1;
+    const auto fraction = decimal_places - trailing;
+    const auto size = whole + (fraction == 0 ? 0 : 1 + fraction);
+
+    if (static_cast<size_t>(last - first) < size)
+        return nullptr;
+
+    auto out = first;
+    for (auto index = decimal_places + whole; index > decimal_places;)
+        *out++ = digit(--index);
+
+    if (fraction == 0)
+        return out;
+
+    *out++ = '.';
+    for (auto index = decimal_places; index > trailing;)
+        *out++ = digit(--index);
+
+    return out;
+}
+
+bool decode_base10(uint64_t& out, const std::string& amount,
+    uint8_t decimal_places, bool strict)
+{
+    const auto data = amount.data();
+    return base10_from_chars(out, data, data + amount.size(), decimal_places,
+        strict);
+}
+
 std::string encode_base10(uint64_t amount, uint8_t decimal_places)
 {
-    std::ostringstream stream;
-    stream << std::setfill('0') << std::setw(1 + decimal_places) << amount;
-
-    auto string = stream.str();
-    string.insert(string.size() - decimal_places, 1, '.');
-    boost::algorithm::trim_right_if(string, char_is<'0'>);
-    boost::algorithm::trim_right_if(string, char_is<'.'>);
-    return string;
+    char buffer[base10_maximum_size];
+    const auto end = base10_to_chars(buffer, buffer + base10_maximum_size,
+        amount, decimal_places);
+    return std::string(buffer, end);
+}
+
+void encode_base10(std::string& out, const std::vector<uint64_t>& amounts,
+    uint8_t decimal_places, char delimiter)
+{
+    char buffer[base10_maximum_size];
+
+    for (const auto amount: amounts)
+    {
+        const auto end = base10_to_chars(buffer,
+            buffer + base10_maximum_size, amount, decimal_places);
+        out.append(buffer, end);
+        out.push_back(delimiter);
+    }
 }
 
 bool btc_to_satoshi(uint64_t& satoshi, const std::string& btc)
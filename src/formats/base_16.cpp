@@ -19,21 +19,39 @@
 #include <bitcoin/bitcoin/formats/base_16.hpp>
 
 #include <algorithm>
-#include <iomanip>
-#include <sstream>
-#include <boost/algorithm/string.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/assert.hpp>
 #include <bitcoin/bitcoin/utility/data.hpp>
+#include "../math/external/cpu_features.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #define BASE16_SSE2
+    #include <emmintrin.h>
+    #if defined(__GNUC__) || defined(__clang__)
+        #define BASE16_AVX2
+        #define BASE16_TARGET_AVX2 __attribute__((target("avx2")))
+        #include <immintrin.h>
+    #elif defined(_MSC_VER)
+        #define BASE16_AVX2
+        #define BASE16_TARGET_AVX2
+        #include <immintrin.h>
+    #endif
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+    #define BASE16_NEON
+    #include <arm_neon.h>
+#endif
 
 namespace libbitcoin {
 
-std::string encode_base16(data_slice data)
-{
-    std::stringstream ss;
-    ss << std::hex << std::setfill('0');
-    for (int val: data)
-        ss << std::setw(2) << val;
-    return ss.str();
-}
+// Each byte is two characters, the high nibble first, in lower case. Wide
+// kernels convert 16 (or 32) bytes per step, the scalar loop the remainder.
+
+static const char hex_digits[] = "0123456789abcdef";
+static BC_CONSTEXPR uint8_t invalid_nibble = 0xff;
 
 bool is_base16(const char c)
 {
@@ -43,13 +61,335 @@ bool is_base16(const char c)
         ('a' <= c && c <= 'f');
 }
 
-static unsigned from_hex(const char c)
+static uint8_t from_hex(const char c)
 {
+    if ('0' <= c && c <= '9')
+        return static_cast<uint8_t>(c - '0');
     if ('A' <= c && c <= 'F')
-        return 10 + c - 'A';
+        return static_cast<uint8_t>(10 + c - 'A');
     if ('a' <= c && c <= 'f')
-        return 10 + c - 'a';
-    return c - '0';
+        return static_cast<uint8_t>(10 + c - 'a');
+    return invalid_nibble;
+}
+
+static void encode_scalar(char* out, const uint8_t* data, size_t size)
+{
+    for (size_t byte = 0; byte < size; ++byte)
+    {
+        *out++ = hex_digits[data[byte] >> 4];
+        *out++ = hex_digits[data[byte] & 0x0f];
+    }
+}
+
+static bool decode_scalar(uint8_t* out, const char* in, size_t size)
+{
+    for (size_t byte = 0; byte < size; ++byte, in += 2)
+    {
+        const auto high = from_hex(in[0]);
+        const auto low = from_hex(in[1]);
+
+        if (high == invalid_nibble || low == invalid_nibble)
+            return false;
+
+        out[byte] = static_cast<uint8_t>((high << 4) | low);
+    }
+
+    return true;
+}
+
+#ifdef BASE16_SSE2
+
+// Map each nibble to '0'..'9' or 'a'..'f'.
+static inline __m128i to_hex(__m128i nibbles)
+{
+    const auto letters = _mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9));
+    return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')),
+        _mm_and_si128(letters, _mm_set1_epi8('a' - '0' - 10)));
+}
+
+// Encode 16 bytes as 32 characters.
+static inline void encode_block(char* out, __m128i bytes)
+{
+    const auto mask = _mm_set1_epi8(0x0f);
+    const auto high = to_hex(_mm_and_si128(_mm_srli_epi16(bytes, 4), mask));
+    const auto low = to_hex(_mm_and_si128(bytes, mask));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out),
+        _mm_unpacklo_epi8(high, low));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 16),
+        _mm_unpackhi_epi8(high, low));
+}
+
+// Reverse the order of 16 bytes.
+static inline __m128i reverse_block(__m128i bytes)
+{
+    bytes = _mm_shuffle_epi32(bytes, _MM_SHUFFLE(0, 1, 2, 3));
+    bytes = _mm_shufflelo_epi16(bytes, _MM_SHUFFLE(2, 3, 0, 1));
+    bytes = _mm_shufflehi_epi16(bytes, _MM_SHUFFLE(2, 3, 0, 1));
+    return _mm_or_si128(_mm_slli_epi16(bytes, 8), _mm_srli_epi16(bytes, 8));
+}
+
+// Map 16 characters to nibbles, clearing valid if any is not base16.
+static inline __m128i to_nibbles(__m128i characters, __m128i& valid)
+{
+    const auto digits = _mm_and_si128(
+        _mm_cmpgt_epi8(characters, _mm_set1_epi8('0' - 1)),
+        _mm_cmplt_epi8(characters, _mm_set1_epi8('9' + 1)));
+
+    // Setting the case bit maps upper case letters to lower case.
+    const auto lower = _mm_or_si128(characters, _mm_set1_epi8(0x20));
+    const auto letters = _mm_and_si128(
+        _mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+        _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+
+    valid = _mm_and_si128(valid, _mm_or_si128(digits, letters));
+    return _mm_or_si128(
+        _mm_and_si128(digits, _mm_sub_epi8(characters, _mm_set1_epi8('0'))),
+        _mm_and_si128(letters, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10))));
+}
+
+// Combine pairs of nibbles (high first) into the low byte of each word.
+static inline __m128i to_words(__m128i nibbles)
+{
+    return _mm_or_si128(
+        _mm_slli_epi16(_mm_and_si128(nibbles, _mm_set1_epi16(0x00ff)), 4),
+        _mm_srli_epi16(nibbles, 8));
+}
+
+// Decode 32 characters as 16 bytes, false if any is not base16.
+static inline bool decode_block(uint8_t* out, const char* in)
+{
+    auto valid = _mm_set1_epi8(-1);
+    const auto first = to_nibbles(_mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(in)), valid);
+    const auto second = to_nibbles(_mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(in + 16)), valid);
+
+    if (_mm_movemask_epi8(valid) != 0xffff)
+        return false;
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out),
+        _mm_packus_epi16(to_words(first), to_words(second)));
+    return true;
+}
+
+#endif // BASE16_SSE2
+
+#ifdef BASE16_AVX2
+
+static bool has_avx2()
+{
+    return (CPUFeatures() & CPU_FEATURE_AVX2) != 0;
+}
+
+BASE16_TARGET_AVX2
+static inline __m256i to_hex(__m256i nibbles)
+{
+    const auto letters = _mm256_cmpgt_epi8(nibbles, _mm256_set1_epi8(9));
+    return _mm256_add_epi8(_mm256_add_epi8(nibbles, _mm256_set1_epi8('0')),
+        _mm256_and_si256(letters, _mm256_set1_epi8('a' - '0' - 10)));
+}
+
+BASE16_TARGET_AVX2
+static inline __m256i to_nibbles(__m256i characters, __m256i& valid)
+{
+    const auto digits = _mm256_and_si256(
+        _mm256_cmpgt_epi8(characters, _mm256_set1_epi8('0' - 1)),
+        _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), characters));
+
+    const auto lower = _mm256_or_si256(characters, _mm256_set1_epi8(0x20));
+    const auto letters = _mm256_and_si256(
+        _mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)),
+        _mm256_cmpgt_epi8(_mm256_set1_epi8('f' + 1), lower));
+
+    valid = _mm256_and_si256(valid, _mm256_or_si256(digits, letters));
+    return _mm256_or_si256(
+        _mm256_and_si256(digits,
+            _mm256_sub_epi8(characters, _mm256_set1_epi8('0'))),
+        _mm256_and_si256(letters,
+            _mm256_sub_epi8(lower, _mm256_set1_epi8('a' - 10))));
+}
+
+BASE16_TARGET_AVX2
+static inline __m256i to_words(__m256i nibbles)
+{
+    return _mm256_or_si256(
+        _mm256_slli_epi16(
+            _mm256_and_si256(nibbles, _mm256_set1_epi16(0x00ff)), 4),
+        _mm256_srli_epi16(nibbles, 8));
+}
+
+// Encode 32 bytes per step, returns the number of bytes encoded.
+BASE16_TARGET_AVX2
+static size_t encode_avx2(char* out, const uint8_t* data, size_t size)
+{
+    const auto mask = _mm256_set1_epi8(0x0f);
+    size_t byte = 0;
+
+    for (; byte + 32 <= size; byte += 32, out += 64)
+    {
+        const auto bytes = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(data + byte));
+        const auto high = to_hex(_mm256_and_si256(
+            _mm256_srli_epi16(bytes, 4), mask));
+        const auto low = to_hex(_mm256_and_si256(bytes, mask));
+
+        // Unpacking is within 128 bit lanes, so the halves are exchanged.
+        const auto first = _mm256_unpacklo_epi8(high, low);
+        const auto second = _mm256_unpackhi_epi8(high, low);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out),
+            _mm256_permute2x128_si256(first, second, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 32),
+            _mm256_permute2x128_si256(first, second, 0x31));
+    }
+
+    return byte;
+}
+
+// Decode 32 bytes per step, returns the number of bytes decoded, or -1 if
+// any character is not base16.
+BASE16_TARGET_AVX2
+static ptrdiff_t decode_avx2(uint8_t* out, const char* in, size_t size)
+{
+    size_t byte = 0;
+
+    for (; byte + 32 <= size; byte += 32, in += 64)
+    {
+        auto valid = _mm256_set1_epi8(-1);
+        const auto first = to_nibbles(_mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(in)), valid);
+        const auto second = to_nibbles(_mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(in + 32)), valid);
+
+        if (_mm256_movemask_epi8(valid) != -1)
+            return -1;
+
+        // Packing is within 128 bit lanes, so the middle quarters exchange.
+        const auto packed = _mm256_packus_epi16(to_words(first),
+            to_words(second));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + byte),
+            _mm256_permute4x64_epi64(packed, _MM_SHUFFLE(3, 1, 2, 0)));
+    }
+
+    return static_cast<ptrdiff_t>(byte);
+}
+
+#endif // BASE16_AVX2
+
+#ifdef BASE16_NEON
+
+static inline uint8x16_t to_hex(uint8x16_t nibbles)
+{
+    const auto letters = vcgtq_u8(nibbles, vdupq_n_u8(9));
+    return vaddq_u8(vaddq_u8(nibbles, vdupq_n_u8('0')),
+        vandq_u8(letters, vdupq_n_u8('a' - '0' - 10)));
+}
+
+// Encode 16 bytes as 32 characters, interleaved by the store.
+static inline void encode_block(char* out, uint8x16_t bytes)
+{
+    uint8x16x2_t characters;
+    characters.val[0] = to_hex(vshrq_n_u8(bytes, 4));
+    characters.val[1] = to_hex(vandq_u8(bytes, vdupq_n_u8(0x0f)));
+    vst2q_u8(reinterpret_cast<uint8_t*>(out), characters);
+}
+
+static inline uint8x16_t reverse_block(uint8x16_t bytes)
+{
+    const auto reversed = vrev64q_u8(bytes);
+    return vextq_u8(reversed, reversed, 8);
+}
+
+static inline uint8x16_t to_nibbles(uint8x16_t characters, uint8x16_t& valid)
+{
+    const auto digits = vsubq_u8(characters, vdupq_n_u8('0'));
+    const auto letters = vsubq_u8(vorrq_u8(characters, vdupq_n_u8(0x20)),
+        vdupq_n_u8('a'));
+    const auto is_digit = vcltq_u8(digits, vdupq_n_u8(10));
+    const auto is_letter = vcltq_u8(letters, vdupq_n_u8(6));
+
+    valid = vandq_u8(valid, vorrq_u8(is_digit, is_letter));
+    return vbslq_u8(is_digit, digits, vaddq_u8(letters, vdupq_n_u8(10)));
+}
+
+// Decode 32 characters as 16 bytes, deinterleaved by the load.
+static inline bool decode_block(uint8_t* out, const char* in)
+{
+    auto valid = vdupq_n_u8(0xff);
+    const auto characters = vld2q_u8(reinterpret_cast<const uint8_t*>(in));
+    const auto high = to_nibbles(characters.val[0], valid);
+    const auto low = to_nibbles(characters.val[1], valid);
+
+    if (vminvq_u8(valid) != 0xff)
+        return false;
+
+    vst1q_u8(out, vorrq_u8(vshlq_n_u8(high, 4), low));
+    return true;
+}
+
+#endif // BASE16_NEON
+
+// For the sizes of hashes and scripts the 16 byte kernel is used directly.
+static void encode(char* out, const uint8_t* data, size_t size)
+{
+    size_t byte = 0;
+
+#ifdef BASE16_AVX2
+    if (size >= 64 && has_avx2())
+        byte = encode_avx2(out, data, size);
+#endif
+
+#if defined(BASE16_SSE2)
+    for (; byte + 16 <= size; byte += 16)
+        encode_block(out + 2 * byte, _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(data + byte)));
+#elif defined(BASE16_NEON)
+    for (; byte + 16 <= size; byte += 16)
+        encode_block(out + 2 * byte, vld1q_u8(data + byte));
+#endif
+
+    encode_scalar(out + 2 * byte, data + byte, size - byte);
+}
+
+static bool decode(uint8_t* out, const char* in, size_t size)
+{
+    size_t byte = 0;
+
+#ifdef BASE16_AVX2
+    if (size >= 64 && has_avx2())
+    {
+        const auto decoded = decode_avx2(out, in, size);
+        if (decoded < 0)
+            return false;
+
+        byte = static_cast<size_t>(decoded);
+    }
+#endif
+
+#if defined(BASE16_SSE2) || defined(BASE16_NEON)
+    for (; byte + 16 <= size; byte += 16)
+        if (!decode_block(out + byte, in + 2 * byte))
+            return false;
+#endif
+
+    return decode_scalar(out + byte, in + 2 * byte, size - byte);
+}
+
+void encode_base16(char* out, data_slice data)
+{
+    encode(out, data.data(), data.size());
+}
+
+void encode_base16(std::string& out, data_slice data)
+{
+    out.resize(2 * data.size());
+    encode(&out[0], data.data(), data.size());
+}
+
+std::string encode_base16(data_slice data)
+{
+    std::string out;
+    encode_base16(out, data);
+    return out;
 }
 
 bool decode_base16(data_chunk& out, const std::string& in)
@@ -59,18 +399,43 @@ bool decode_base16(data_chunk& out, const std::string& in)
         return false;
 
     data_chunk result(in.size() / 2);
-    if (!decode_base16_private(result.data(), result.size(), in.data()))
+    if (!decode(result.data(), in.data(), result.size()))
         return false;
 
-    out = result;
+    out = std::move(result);
     return true;
 }
 
 // Bitcoin hash format (these are all reversed):
-std::string encode_hash(hash_digest hash)
+void encode_hash(char* out, const hash_digest& hash)
 {
-    std::reverse(hash.begin(), hash.end());
-    return encode_base16(hash);
+#if defined(BASE16_SSE2)
+    const auto data = reinterpret_cast<const __m128i*>(hash.data());
+    encode_block(out, reverse_block(_mm_loadu_si128(data + 1)));
+    encode_block(out + 32, reverse_block(_mm_loadu_si128(data)));
+#elif defined(BASE16_NEON)
+    encode_block(out, reverse_block(vld1q_u8(hash.data() + 16)));
+    encode_block(out + 32, reverse_block(vld1q_u8(hash.data())));
+#else
+    for (auto byte = hash.rbegin(); byte != hash.rend(); ++byte)
+    {
+        *out++ = hex_digits[*byte >> 4];
+        *out++ = hex_digits[*byte & 0x0f];
+    }
+#endif
+}
+
+void encode_hash(std::string& out, const hash_digest& hash)
+{
+    out.resize(2 * hash_size);
+    encode_hash(&out[0], hash);
+}
+
+std::string encode_hash(const hash_digest& hash)
+{
+    std::string out;
+    encode_hash(out, hash);
+    return out;
 }
 
 bool decode_hash(hash_digest& out, const std::string& in)
@@ -79,7 +444,7 @@ bool decode_hash(hash_digest& out, const std::string& in)
         return false;
 
     hash_digest result;
-    if (!decode_base16_private(result.data(), result.size(), in.data()))
+    if (!decode(result.data(), in.data(), result.size()))
         return false;
 
     // Reverse:
@@ -100,16 +465,7 @@ hash_digest hash_literal(const char (&string)[2 * hash_size + 1])
 // For support of template implementation only, do not call directly.
 bool decode_base16_private(uint8_t* out, size_t out_size, const char* in)
 {
-    if (!std::all_of(in, in + 2 * out_size, is_base16))
-        return false;
-
-    for (size_t i = 0; i < out_size; ++i)
-    {
-        out[i] = (from_hex(in[0]) << 4) + from_hex(in[1]);
-        in += 2;
-    }
-
-    return true;
+    return decode(out, in, out_size);
 }
 
 } // namespace libbitcoin
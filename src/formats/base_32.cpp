@@ -21,9 +21,10 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
-#include <iterator>
 #include <string>
+#include <vector>
 #include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/string.hpp>
 
 namespace libbitcoin {
 
@@ -31,7 +32,7 @@ static constexpr size_t checksum_size = 6;
 static constexpr size_t prefix_min_size = 1;
 static constexpr size_t combined_max_size = 90;
 static constexpr uint8_t null = 255;
-static constexpr uint8_t separator = '1';
+static constexpr char separator = '1';
 static const char encode_table[] = "qpzry9x8gf2tvdw0s3jn54khce6mua7l";
 static const uint8_t decode_table[] =
 {
@@ -53,113 +54,121 @@ static const uint8_t decode_table[] =
     6,    4,    2,    null, null, null, null, null
 };
 
-inline char ascii_to_lowercase(char character)
+// The generator terms selected by each value of the top five checksum bits:
+// 0x3b6a57b2, 0x26508e6d, 0x1ea119fa, 0x3d4233dd, 0x2a1462b3 (bip173).
+static const uint32_t generator_table[] =
 {
-    return character + ('a' - 'A');
+    0x00000000, 0x3b6a57b2, 0x26508e6d, 0x1d3ad9df,
+    0x1ea119fa, 0x25cb4e48, 0x38f19797, 0x039bc025,
+    0x3d4233dd, 0x0628646f, 0x1b12bdb0, 0x2078ea02,
+    0x23e32a27, 0x18897d95, 0x05b3a44a, 0x3ed9f3f8,
+    0x2a1462b3, 0x117e3501, 0x0c44ecde, 0x372ebb6c,
+    0x34b57b49, 0x0fdf2cfb, 0x12e5f524, 0x298fa296,
+    0x1756516e, 0x2c3c06dc, 0x3106df03, 0x0a6c88b1,
+    0x09f74894, 0x329d1f26, 0x2fa7c6f9, 0x14cd914b
+};
+
+// Fold one five bit value into the checksum.
+inline uint32_t polymod(uint32_t result, uint8_t value)
+{
+    return ((result & 0x1ffffff) << 5) ^ value ^ generator_table[result >> 25];
 }
 
-// Expand the prefix for checksum computation.
-data_chunk expand(const std::string& prefix)
+// Fold the expanded prefix into the checksum, without materializing it.
+static uint32_t polymod_prefix(const std::string& prefix)
 {
-    data_chunk result(2 * prefix.size() + 1);
-    auto iterator = result.begin();
+    uint32_t result = 1;
 
     for (const auto character: prefix)
-    {
-        *iterator = static_cast<uint8_t>(character >> 5);
-        ++iterator;
-    }
+        result = polymod(result, static_cast<uint8_t>(character >> 5));
 
-    // Current position is initialized to 0x00 so skip it.
-    ++iterator;
+    result = polymod(result, 0x00);
 
     for (const auto character: prefix)
-    {
-        *iterator = static_cast<uint8_t>(character & 31);
-        ++iterator;
-    }
+        result = polymod(result, static_cast<uint8_t>(character & 31));
 
     return result;
 }
 
-// Do the checksum math.
-uint32_t polymod(const data_chunk& values)
+// The prefix checksum of the last prefix, reused while the prefix repeats.
+class prefix_cache
 {
-    static const uint32_t magic_numbers[] =
+public:
+    prefix_cache()
+      : checksum_(0), valid_(false)
     {
-        0x3b6a57b2, 0x26508e6d, 0x1ea119fa, 0x3d4233dd, 0x2a1462b3
-    };
+    }
 
-    uint32_t result = 1;
-    for (const auto value: values)
+    uint32_t checksum(const std::string& prefix)
     {
-        const auto shift = (result >> 25);
-        result = (result & 0x1ffffff) << 5 ^ value;
+        if (!valid_ || prefix != prefix_)
+        {
+            prefix_ = prefix;
+            checksum_ = polymod_prefix(prefix);
+            valid_ = true;
+        }
 
-        for (auto index = 0; index < 5; ++index)
-            result ^= (((shift >> index) & 1) != 0 ? magic_numbers[index] : 0);
+        return checksum_;
     }
 
-    return result;
-}
+private:
+    std::string prefix_;
+    uint32_t checksum_;
+    bool valid_;
+};
 
-// Compute the checksum.
-data_chunk checksum(const base32& value)
+// Encode the value following the prefix checksum, reusing the out capacity.
+static void encode(std::string& out, const base32& unencoded,
+    uint32_t prefix_checksum)
 {
-    static const data_chunk empty_checksum
-    {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-    };
-
-    const auto expanded = build_chunk(
+    const auto& prefix = unencoded.prefix;
+    const auto& payload = unencoded.payload;
+    out.resize(prefix.size() + sizeof(separator) + payload.size() +
+        checksum_size);
+
+    // Copy the prefix and separator.
+    auto it = std::copy(prefix.begin(), prefix.end(), out.begin());
+    *it++ = separator;
+
+    // Encode the payload, folding it into the checksum.
+    auto result = prefix_checksum;
+    for (const auto value: payload)
     {
-        expand(value.prefix),
-        value.payload,
-        empty_checksum
-    });
-
-    data_chunk checksum(checksum_size);
-    const auto modified = polymod(expanded) ^ 1;
+        *it++ = encode_table[value];
+        result = polymod(result, value);
+    }
 
-    for (size_t index = 0; index < checksum.size(); ++index)
-        checksum[index] = (modified >> (5 * (5 - index))) & 31;
+    // Fold six zero values into the checksum and encode it.
+    for (size_t index = 0; index < checksum_size; ++index)
+        result = polymod(result, 0x00);
 
-    return checksum;
+    result ^= 1;
+    for (size_t index = 0; index < checksum_size; ++index)
+        *it++ = encode_table[(result >> (5 * (5 - index))) & 31];
 }
 
-// Normalize and validate input characters.
-static bool normalize(data_chunk& out, const std::string& in)
+// Lowercase and validate an input character, noting its case.
+inline bool normalize(char& character, bool& uppercase, bool& lowercase)
 {
-    out.clear();
-    out.reserve(in.length());
-    auto uppercase = false;
-    auto lowercase = false;
-
-    for (auto character: in)
+    if (character >= 'A' && character <= 'Z')
     {
-        if (character >= 'A' && character <= 'Z')
-        {
-            uppercase = true;
-            character = ascii_to_lowercase(character);
-        }
-        else if (character >= 'a' && character <= 'z')
-        {
-            lowercase = true;
-        }
-        else if (character < '!' || character > '~')
-        {
-            return false;
-        }
-
-        out.push_back(static_cast<uint8_t>(character));
+        uppercase = true;
+        character += ('a' - 'A');
+    }
+    else if (character >= 'a' && character <= 'z')
+    {
+        lowercase = true;
+    }
+    else if (character < '!' || character > '~')
+    {
+        return false;
     }
 
-    // Must not accept mixed case strings.
-    return !(uppercase && lowercase);
+    return true;
 }
 
-// Split the prefix from the payload and validate sizes.
-static bool split(base32& out, const data_chunk& in)
+// Split, normalize and decode the input in a single pass over it.
+static bool decode(base32& out, const std::string& in, prefix_cache& cache)
 {
     static const auto separator_size = sizeof(separator);
     static const auto payload_min_size = checksum_size;
@@ -169,35 +178,60 @@ static bool split(base32& out, const data_chunk& in)
     if (in.size() > combined_max_size)
         return false;
 
-    // Find the last instance of the separator byte.
-    const auto reverse = std::find(in.rbegin(), in.rend(), separator);
+    // Find the last instance of the separator character.
+    const auto offset = in.rfind(separator);
 
-    if (reverse == in.rend())
+    if (offset == std::string::npos)
         return false;
 
-    // Convert separator iterator from reverse to forward (min distance is 1).
-    const auto offset = std::distance(reverse, in.rend()) - 1;
+    const auto prefix_size = offset;
+    const auto payload_size = in.size() - offset - separator_size;
 
-    // Clang 3.4 cannot handle iterator variable here, so this is a bit ugly.
-    out.prefix = { in.begin(), std::next(in.begin(), offset) };
-    out.payload = { std::next(in.begin(), offset + 1), in.end() };
+    if (prefix_size < prefix_min_size || prefix_size > prefix_max_size ||
+        payload_size < payload_min_size)
+        return false;
 
-    return
-        out.prefix.size() >= prefix_min_size &&
-        out.prefix.size() <= prefix_max_size &&
-        out.payload.size() >= payload_min_size;
-}
+    auto uppercase = false;
+    auto lowercase = false;
+    out.prefix.resize(prefix_size);
 
-// Verify the checksummed payload.
-bool verify(const base32& value)
-{
-    const auto expanded = build_chunk(
+    for (size_t index = 0; index < prefix_size; ++index)
+    {
+        auto character = in[index];
+
+        if (!normalize(character, uppercase, lowercase))
+            return false;
+
+        out.prefix[index] = character;
+    }
+
+    auto result = cache.checksum(out.prefix);
+    out.payload.resize(payload_size);
+
+    // Decode the payload with checksum, folding it into the checksum.
+    for (size_t index = 0; index < payload_size; ++index)
     {
-        expand(value.prefix),
-        value.payload
-    });
+        auto character = in[offset + separator_size + index];
+
+        if (!normalize(character, uppercase, lowercase))
+            return false;
+
+        const auto value = decode_table[static_cast<uint8_t>(character)];
+
+        if (value == null)
+            return false;
 
-    return polymod(expanded) == 1;
+        out.payload[index] = value;
+        result = polymod(result, value);
+    }
+
+    // Must not accept mixed case strings, and verify the checksum.
+    if ((uppercase && lowercase) || result != 1)
+        return false;
+
+    // Truncate checksum from payload.
+    out.payload.resize(payload_size - checksum_size);
+    return true;
 }
 
 // public
@@ -213,50 +247,60 @@ bool verify(const base32& value)
 std::string encode_base32(const base32& unencoded)
 {
     std::string encoded;
-    encoded.reserve(unencoded.prefix.size() + sizeof(separator) +
-        unencoded.payload.size() + checksum_size);
-
-    // Copy the prefix and add the separator.
-    encoded = unencoded.prefix;
-    encoded += separator;
+    encode_base32(encoded, unencoded);
+    return encoded;
+}
 
-    // Encode and add the payload.
-    for (const auto value: unencoded.payload)
-        encoded += encode_table[value];
+void encode_base32(std::string& out, const base32& unencoded)
+{
+    encode(out, unencoded, polymod_prefix(unencoded.prefix));
+}
 
-    // Compute, encode and add the checksum.
-    for (const auto value: checksum(unencoded))
-        encoded += encode_table[value];
+void encode_base32(string_list& out, const std::vector<base32>& unencoded)
+{
+    prefix_cache cache;
+    out.resize(unencoded.size());
 
-    return encoded;
+    for (size_t index = 0; index < unencoded.size(); ++index)
+    {
+        const auto& value = unencoded[index];
+        encode(out[index], value, cache.checksum(value.prefix));
+    }
 }
 
 bool decode_base32(base32& out, const std::string& in)
 {
-    static const auto check = checksum_size;
-    data_chunk normal;
+    prefix_cache cache;
 
-    // Normalize and validate input characters.
-    if (!normalize(normal, in))
+    if (!decode(out, in, cache))
+    {
+        out.prefix.clear();
+        out.payload.clear();
         return false;
+    }
 
-    // Set prefix and payload with checksum.
-    if (!split(out, normal))
-        return false;
+    return true;
+}
 
-    // Decode payload/checksum in place.
-    for (auto it = out.payload.begin(); it != out.payload.end(); ++it)
-        if (((*it = decode_table[*it])) == null)
-            return false;
+bool decode_base32(std::vector<base32>& out, const string_list& in)
+{
+    prefix_cache cache;
+    auto result = true;
+    out.resize(in.size());
 
-    // Verify checksummed payload.
-    if (!verify(out))
-        return false;
+    for (size_t index = 0; index < in.size(); ++index)
+    {
+        auto& value = out[index];
 
-    // Truncate checksum from payload.
-    out.payload.resize(out.payload.size() - check);
-    out.payload.shrink_to_fit();
-    return true;
+        if (!decode(value, in[index], cache))
+        {
+            value.prefix.clear();
+            value.payload.clear();
+            result = false;
+        }
+    }
+
+    return result;
 }
 
 } // namespace libbitcoin
@@ -18,8 +18,17 @@
  */
 #include <bitcoin/bitcoin/formats/base_58.hpp>
 
-#include <boost/algorithm/string.hpp>
-#include <bitcoin/bitcoin/utility/assert.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <bitcoin/bitcoin/compat.hpp>
+#include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/endian.hpp>
 
 namespace libbitcoin {
 
@@ -42,155 +51,315 @@ bool is_base58(const std::string& text)
     return std::all_of(text.begin(), text.end(), test);
 }
 
-template <typename Data>
-auto search_first_nonzero(const Data& data) -> decltype(data.cbegin())
+// Base58 digits are grouped into limbs of five (58^5 < 2^30) for encoding
+// and bytes into limbs of four (2^32) for decoding, so that each carry step
+// of the radix conversion is a single 64 bit multiply and divide. Limbs are
+// little-endian (least significant limb first).
+static BC_CONSTEXPR size_t digits_per_limb = 5;
+static BC_CONSTEXPR size_t bytes_per_limb = sizeof(uint32_t);
+static BC_CONSTEXPR uint64_t digits_radix = 656356768;
+static BC_CONSTEXPR size_t stack_limbs = 64;
+static BC_CONSTEXPR uint8_t invalid_digit = 0xff;
+
+static const uint64_t powers_of_58[] =
 {
-    auto first_nonzero = data.cbegin();
-    while (first_nonzero != data.end() && *first_nonzero == 0)
-        ++first_nonzero;
+    1, 58, 3364, 195112, 11316496, 656356768
+};
 
-    return first_nonzero;
+static size_t base58_encode_limbs(size_t bytes)
+{
+    // log(256) / log(58), rounded up.
+    return (bytes * 138 / 100 + 1) / digits_per_limb + 1;
+}
+
+static size_t base58_decode_limbs(size_t characters)
+{
+    // log(58) / log(256), rounded up.
+    return (characters * 733 / 1000 + 1) / bytes_per_limb + 1;
 }
 
-size_t count_leading_zeros(data_slice unencoded)
+// Map a character to its base58 digit value, or invalid_digit.
+static uint8_t to_digit(char character)
 {
-    // Skip and count leading '1's.
-    size_t leading_zeros = 0;
-    for (const uint8_t byte: unencoded)
+    static const struct table
     {
-        if (byte != 0)
-            break;
+        table()
+        {
+            std::fill(std::begin(values), std::end(values), invalid_digit);
 
-        ++leading_zeros;
-    }
+            for (size_t digit = 0; digit < base58_chars.size(); ++digit)
+                values[static_cast<uint8_t>(base58_chars[digit])] =
+                    static_cast<uint8_t>(digit);
+        }
+
+        uint8_t values[256];
+    } digits;
 
-    return leading_zeros;
+    return digits.values[static_cast<uint8_t>(character)];
 }
 
-void pack_value(data_chunk& indexes, size_t carry)
+// Limbs are held on the stack unless the value is unusually large.
+class limb_buffer
+{
+public:
+    limb_buffer(uint32_t* limbs, size_t size)
+      : limbs_(limbs)
+    {
+        if (limbs_ == nullptr)
+        {
+            if (size > stack_limbs)
+            {
+                heap_.resize(size);
+                limbs_ = heap_.data();
+            }
+            else
+            {
+                limbs_ = stack_;
+            }
+        }
+    }
+
+    uint32_t* data()
+    {
+        return limbs_;
+    }
+
+private:
+    uint32_t* limbs_;
+    uint32_t stack_[stack_limbs];
+    std::vector<uint32_t> heap_;
+};
+
+// Encoding.
+//-----------------------------------------------------------------------------
+
+// Apply "limbs = limbs * multiplier + carry" in base 58^5.
+static void encode_word(uint32_t* limbs, size_t& used, uint64_t multiplier,
+    uint64_t carry)
 {
-    // Apply "b58 = b58 * 256 + ch".
-    for (auto it = indexes.rbegin(); it != indexes.rend(); ++it)
+    for (size_t limb = 0; limb < used; ++limb)
     {
-        carry += 256 * (*it);
-        *it = carry % 58;
-        carry /= 58;
+        carry += limbs[limb] * multiplier;
+        limbs[limb] = static_cast<uint32_t>(carry % digits_radix);
+        carry /= digits_radix;
     }
 
-    BITCOIN_ASSERT(carry == 0);
+    for (; carry != 0; carry /= digits_radix)
+        limbs[used++] = static_cast<uint32_t>(carry % digits_radix);
 }
 
-std::string encode_base58(data_slice unencoded)
+// For support of template implementation only, do not call directly.
+void encode_base58_private(std::string& out, data_slice unencoded,
+    uint32_t* limbs)
 {
-    size_t leading_zeros = count_leading_zeros(unencoded);
+    const auto begin = unencoded.begin();
+    const auto end = unencoded.end();
+    const auto first = std::find_if(begin, end, [](uint8_t byte)
+    {
+        return byte != 0;
+    });
 
-    // size = log(256) / log(58), rounded up.
-    const size_t number_nonzero = unencoded.size() - leading_zeros;
-    const size_t indexes_size = number_nonzero * 138 / 100 + 1;
+    const auto leading_zeros = static_cast<size_t>(first - begin);
+    const auto size = static_cast<size_t>(end - first);
+    limb_buffer buffer(limbs, base58_encode_limbs(size));
+    const auto digits = buffer.data();
+    size_t used = 0;
 
-    // Allocate enough space in big-endian base58 representation.
-    data_chunk indexes(indexes_size);
+    // The leading partial word aligns the remainder to whole words.
+    auto it = first;
+    const auto head = size % bytes_per_limb;
 
-    // Process the bytes.
-    for (auto it = unencoded.begin() + leading_zeros;
-        it != unencoded.end(); ++it)
+    if (head != 0)
     {
-        pack_value(indexes, *it);
+        uint64_t word = 0;
+        for (size_t byte = 0; byte < head; ++byte)
+            word = (word << byte_bits) | *it++;
+
+        encode_word(digits, used, 0, word);
     }
 
-    // Skip leading zeroes in base58 result.
-    auto first_nonzero = search_first_nonzero(indexes);
+    for (; it != end; it += bytes_per_limb)
+        encode_word(digits, used, uint64_t(1) << 32,
+            from_big_endian_unsafe<uint32_t>(it));
 
-    // Translate the result into a string.
-    std::string encoded;
-    const size_t estimated_size = leading_zeros +
-        (indexes.end() - first_nonzero);
-    encoded.reserve(estimated_size);
-    encoded.assign(leading_zeros, '1');
+    out.assign(leading_zeros, base58_chars[0]);
+
+    if (used == 0)
+        return;
+
+    out.reserve(leading_zeros + used * digits_per_limb);
 
-    // Set actual main bytes.
-    for (auto it = first_nonzero; it != indexes.end(); ++it)
+    // The most significant limb is not zero padded.
+    char group[digits_per_limb];
+    auto value = digits[used - 1];
+    auto position = digits_per_limb;
+
+    for (; value != 0; value /= 58)
+        group[--position] = base58_chars[value % 58];
+
+    out.append(group + position, group + digits_per_limb);
+
+    for (auto limb = used - 1; limb > 0; --limb)
     {
-        const size_t index = *it;
-        encoded += base58_chars[index];
+        value = digits[limb - 1];
+
+        for (position = digits_per_limb; position > 0; value /= 58)
+            group[--position] = base58_chars[value % 58];
+
+        out.append(group, group + digits_per_limb);
     }
+}
+
+void encode_base58(std::string& out, data_slice unencoded)
+{
+    encode_base58_private(out, unencoded, nullptr);
+}
 
+std::string encode_base58(data_slice unencoded)
+{
+    std::string encoded;
+    encode_base58(encoded, unencoded);
     return encoded;
 }
 
-size_t count_leading_zeros(const std::string& encoded)
+// Decoding.
+//-----------------------------------------------------------------------------
+
+// Apply "limbs = limbs * multiplier + carry" in base 2^32.
+// Returns false if the value exceeds the limb capacity.
+static bool decode_word(uint32_t* limbs, size_t capacity, size_t& used,
+    uint64_t multiplier, uint64_t carry)
 {
-    // Skip and count leading '1's.
-    size_t leading_zeros = 0;
-    for (const uint8_t digit: encoded)
+    for (size_t limb = 0; limb < used; ++limb)
     {
-        if (digit != base58_chars[0])
-            break;
-
-        ++leading_zeros;
+        carry += limbs[limb] * multiplier;
+        limbs[limb] = static_cast<uint32_t>(carry);
+        carry >>= 32;
     }
 
-    return leading_zeros;
+    if (carry == 0)
+        return true;
+
+    if (used == capacity)
+        return false;
+
+    limbs[used++] = static_cast<uint32_t>(carry);
+    return true;
 }
 
-void unpack_char(data_chunk& data, size_t carry)
+// Decode the significant (non-leading-zero) value of in into limbs.
+// Returns false if a character is not base58 or the value is too large.
+static bool decode_limbs(uint32_t* limbs, size_t capacity, size_t& used,
+    const char* begin, const char* end)
 {
-    for (auto it = data.rbegin(); it != data.rend(); it++)
+    used = 0;
+
+    for (auto it = begin; it != end;)
     {
-        carry += 58 * (*it);
-        *it = carry % 256;
-        carry /= 256;
+        // Leading characters align the remainder to whole limbs.
+        const auto remaining = static_cast<size_t>(end - it);
+        const auto count = (remaining % digits_per_limb == 0) ?
+            digits_per_limb : remaining % digits_per_limb;
+
+        uint64_t word = 0;
+        for (size_t character = 0; character < count; ++character)
+        {
+            const auto digit = to_digit(*it++);
+            if (digit == invalid_digit)
+                return false;
+
+            word = word * 58 + digit;
+        }
+
+        if (!decode_word(limbs, capacity, used, powers_of_58[count], word))
+            return false;
     }
 
-    BITCOIN_ASSERT(carry == 0);
+    return true;
 }
 
-bool decode_base58(data_chunk& out, const std::string& in)
+// The number of significant bytes of the decoded limbs.
+static size_t significant_bytes(const uint32_t* limbs, size_t used)
 {
-    // Trim spaces and newlines around the string.
-    const auto leading_zeros = count_leading_zeros(in);
-
-    // log(58) / log(256), rounded up.
-    const size_t data_size = in.size() * 733 / 1000 + 1;
+    if (used == 0)
+        return 0;
 
-    // Allocate enough space in big-endian base256 representation.
-    data_chunk data(data_size);
+    size_t bytes = (used - 1) * bytes_per_limb;
+    for (auto top = limbs[used - 1]; top != 0; top >>= byte_bits)
+        ++bytes;
 
-    // Process the characters.
-    for (auto it = in.begin() + leading_zeros; it != in.end(); ++it)
-    {
-        const auto carry = base58_chars.find(*it);
-        if (carry == std::string::npos)
-            return false;
+    return bytes;
+}
 
-        unpack_char(data, carry);
-    }
+// Write the significant bytes big-endian into out.
+static void to_bytes(uint8_t* out, const uint32_t* limbs, size_t bytes)
+{
+    for (size_t byte = 0; byte < bytes; ++byte)
+        out[bytes - byte - 1] = static_cast<uint8_t>(
+            limbs[byte / bytes_per_limb] >> (byte_bits * (byte % bytes_per_limb)));
+}
 
-    // Skip leading zeroes in data.
-    auto first_nonzero = search_first_nonzero(data);
+static size_t count_leading_ones(const char* begin, const char* end)
+{
+    return static_cast<size_t>(std::find_if(begin, end, [](char character)
+    {
+        return character != base58_chars[0];
+    }) - begin);
+}
 
-    // Copy result into output vector.
-    data_chunk decoded;
-    const size_t estimated_size = leading_zeros + (data.end() - first_nonzero);
-    decoded.reserve(estimated_size);
-    decoded.assign(leading_zeros, 0x00);
-    decoded.insert(decoded.end(), first_nonzero, data.cend());
+bool decode_base58(data_chunk& out, const std::string& in)
+{
+    const auto begin = in.data();
+    const auto end = begin + in.size();
+    const auto leading_zeros = count_leading_ones(begin, end);
+    const auto size = in.size() - leading_zeros;
+    const auto capacity = base58_decode_limbs(size);
+    limb_buffer buffer(nullptr, capacity);
+    const auto limbs = buffer.data();
+
+    size_t used;
+    if (!decode_limbs(limbs, capacity, used, begin + leading_zeros, end))
+        return false;
 
-    out = decoded;
+    const auto bytes = significant_bytes(limbs, used);
+    out.assign(leading_zeros + bytes, 0x00);
+    to_bytes(out.data() + leading_zeros, limbs, bytes);
     return true;
 }
 
 // For support of template implementation only, do not call directly.
-bool decode_base58_private(uint8_t* out, size_t out_size, const char* in)
+bool decode_base58_private(uint8_t* out, size_t out_size, const char* in,
+    uint32_t* limbs)
 {
-    data_chunk buffer;
-    if (!decode_base58(buffer, in) || buffer.size() != out_size)
+    const auto begin = in;
+    const auto end = in + std::strlen(in);
+    const auto leading_zeros = count_leading_ones(begin, end);
+
+    if (leading_zeros > out_size)
         return false;
 
-    for (size_t i = 0; i < out_size; ++i)
-        out[i] = buffer[i];
+    // The significant value cannot exceed the remaining bytes of out.
+    const auto capacity = (out_size - leading_zeros + bytes_per_limb - 1) /
+        bytes_per_limb;
+    limb_buffer buffer(limbs, capacity);
+    const auto digits = buffer.data();
 
+    size_t used;
+    if (!decode_limbs(digits, capacity, used, begin + leading_zeros, end))
+        return false;
+
+    const auto bytes = significant_bytes(digits, used);
+    if (leading_zeros + bytes != out_size)
+        return false;
+
+    std::fill(out, out + leading_zeros, 0x00);
+    to_bytes(out + leading_zeros, digits, bytes);
     return true;
 }
 
+bool decode_base58_private(uint8_t* out, size_t out_size, const char* in)
+{
+    return decode_base58_private(out, out_size, in, nullptr);
+}
+
 } // namespace libbitcoin
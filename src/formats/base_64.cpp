@@ -18,134 +18,419 @@
  */
 #include <bitcoin/bitcoin/formats/base_64.hpp>
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <ostream>
 #include <string>
+#include <utility>
 #include <bitcoin/bitcoin/utility/data.hpp>
+#include "../math/external/cpu_features.h"
 
-// This implementation derived from public domain:
+#if defined(__x86_64__) || defined(__i386__) || \
+    defined(_M_X64) || defined(_M_IX86)
+    #define BASE64_SSSE3
+    #if defined(__GNUC__) || defined(__clang__)
+        #define BASE64_TARGET_SSSE3 __attribute__((target("ssse3")))
+    #else
+        #define BASE64_TARGET_SSSE3
+    #endif
+    #include <tmmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+    #define BASE64_NEON
+    #include <arm_neon.h>
+#endif
+
+// The scalar implementation was derived from public domain:
 // en.wikibooks.org/wiki/Algorithm_Implementation/Miscellaneous/Base64
+// The vector kernels follow Mula and Lemire, "Faster Base64 Encoding and
+// Decoding Using AVX2 Instructions" (2018), at 128 bits.
 
 namespace libbitcoin {
 
 const static char pad = '=';
+static BC_CONSTEXPR uint8_t invalid = 0xff;
 
 const static char table[] =
     "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
 
-std::string encode_base64(data_slice unencoded)
+// The input bytes encoded per stream write (a multiple of three).
+static BC_CONSTEXPR size_t stream_chunk = 3 * 1024;
+static BC_CONSTEXPR size_t stream_buffer = stream_chunk / 3 * 4;
+
+static size_t encoded_size(size_t size)
 {
-    std::string encoded;
-    const auto size = unencoded.size();
-    encoded.reserve(((size / 3) + (size % 3 > 0)) * 4);
+    return ((size + 2) / 3) * 4;
+}
 
-    uint32_t value;
-    auto cursor = unencoded.begin();
-    for (size_t position = 0; position < size / 3; position++)
+// Map each character to its six bit value, or invalid.
+static uint8_t to_value(char character)
+{
+    static const struct values
+    {
+        values()
+        {
+            for (auto& value: map)
+                value = invalid;
+
+            for (uint8_t index = 0; index < 64; ++index)
+                map[static_cast<uint8_t>(table[index])] = index;
+        }
+
+        uint8_t map[256];
+    } decode_table;
+
+    return decode_table.map[static_cast<uint8_t>(character)];
+}
+
+// Scalar.
+//-----------------------------------------------------------------------------
+
+static void encode_scalar(char* out, const uint8_t* data, size_t size)
+{
+    for (; size >= 3; size -= 3, data += 3)
     {
         // Convert to big endian.
-        value = (*cursor++) << 16;
-
-        value += (*cursor++) << 8;
-        value += (*cursor++);
-        encoded.append(1, table[(value & 0x00FC0000) >> 18]);
-        encoded.append(1, table[(value & 0x0003F000) >> 12]);
-        encoded.append(1, table[(value & 0x00000FC0) >> 6]);
-        encoded.append(1, table[(value & 0x0000003F) >> 0]);
+        const uint32_t value = (data[0] << 16) | (data[1] << 8) | data[2];
+        *out++ = table[(value >> 18) & 0x3f];
+        *out++ = table[(value >> 12) & 0x3f];
+        *out++ = table[(value >> 6) & 0x3f];
+        *out++ = table[value & 0x3f];
     }
 
-    switch (size % 3)
+    switch (size)
     {
         case 1:
-            // Convert to big endian.
-            value = (*cursor++) << 16;
-
-            encoded.append(1, table[(value & 0x00FC0000) >> 18]);
-            encoded.append(1, table[(value & 0x0003F000) >> 12]);
-            encoded.append(2, pad);
+        {
+            const uint32_t value = data[0] << 16;
+            *out++ = table[(value >> 18) & 0x3f];
+            *out++ = table[(value >> 12) & 0x3f];
+            *out++ = pad;
+            *out++ = pad;
             break;
+        }
         case 2:
-            // Convert to big endian.
-            value = (*cursor++) << 16;
-
-            value += (*cursor++) << 8;
-            encoded.append(1, table[(value & 0x00FC0000) >> 18]);
-            encoded.append(1, table[(value & 0x0003F000) >> 12]);
-            encoded.append(1, table[(value & 0x00000FC0) >> 6]);
-            encoded.append(1, pad);
+        {
+            const uint32_t value = (data[0] << 16) | (data[1] << 8);
+            *out++ = table[(value >> 18) & 0x3f];
+            *out++ = table[(value >> 12) & 0x3f];
+            *out++ = table[(value >> 6) & 0x3f];
+            *out++ = pad;
+            break;
+        }
+    }
+}
+
+// Decode whole groups of four characters (no padding).
+static bool decode_scalar(uint8_t* out, const char* in, size_t groups)
+{
+    for (; groups > 0; --groups, in += 4)
+    {
+        const auto first = to_value(in[0]);
+        const auto second = to_value(in[1]);
+        const auto third = to_value(in[2]);
+        const auto fourth = to_value(in[3]);
+
+        if (first == invalid || second == invalid || third == invalid ||
+            fourth == invalid)
+            return false;
+
+        const uint32_t value = (first << 18) | (second << 12) |
+            (third << 6) | fourth;
+        *out++ = static_cast<uint8_t>(value >> 16);
+        *out++ = static_cast<uint8_t>(value >> 8);
+        *out++ = static_cast<uint8_t>(value);
+    }
+
+    return true;
+}
+
+// Vector.
+//-----------------------------------------------------------------------------
+
+#ifdef BASE64_SSSE3
+
+static bool has_vector()
+{
+    return (CPUFeatures() & CPU_FEATURE_SSSE3) != 0;
+}
+
+// Encode 12 bytes (of 16 loaded) as 16 characters per step.
+// Returns the number of bytes encoded.
+BASE64_TARGET_SSSE3
+static size_t encode_vector(char* out, const uint8_t* data, size_t size)
+{
+    const auto split = _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10,
+        9, 11, 10);
+    const auto shift = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '+' - 62, '/' - 63, 'A', 0, 0);
+
+    size_t byte = 0;
+    for (; byte + 16 <= size; byte += 12, out += 16)
+    {
+        // Spread each three bytes over a 32 bit word as four six bit fields.
+        const auto in = _mm_shuffle_epi8(_mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(data + byte)), split);
+        const auto high = _mm_mulhi_epu16(
+            _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00)),
+            _mm_set1_epi32(0x04000040));
+        const auto low = _mm_mullo_epi16(
+            _mm_and_si128(in, _mm_set1_epi32(0x003f03f0)),
+            _mm_set1_epi32(0x01000010));
+        const auto indexes = _mm_or_si128(high, low);
+
+        // Map each index range to its character offset.
+        auto range = _mm_subs_epu8(indexes, _mm_set1_epi8(51));
+        const auto upper = _mm_cmpgt_epi8(_mm_set1_epi8(26), indexes);
+        range = _mm_or_si128(range, _mm_and_si128(upper, _mm_set1_epi8(13)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out),
+            _mm_add_epi8(indexes, _mm_shuffle_epi8(shift, range)));
+    }
+
+    return byte;
+}
+
+// Decode 16 characters as 12 bytes (of 16 stored) per step, while at least
+// eight characters follow (so the overwrite is within out).
+// Returns the number of groups decoded, or stops at an invalid character,
+// which is then reported by the scalar decode.
+BASE64_TARGET_SSSE3
+static size_t decode_vector(uint8_t* out, const char* in, size_t groups)
+{
+    const auto low_table = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a);
+    const auto high_table = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08,
+        0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    const auto roll_table = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71,
+        0, 0, 0, 0, 0, 0, 0, 0);
+    const auto join = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12,
+        -1, -1, -1, -1);
+    const auto mask = _mm_set1_epi8(0x2f);
+
+    size_t group = 0;
+    for (; group + 6 <= groups; group += 4, in += 16, out += 12)
+    {
+        const auto characters = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(in));
+        const auto high = _mm_and_si128(_mm_srli_epi32(characters, 4), mask);
+        const auto low = _mm_and_si128(characters, mask);
+        const auto classes = _mm_and_si128(_mm_shuffle_epi8(low_table, low),
+            _mm_shuffle_epi8(high_table, high));
+
+        // Any character outside of the alphabet has a nonzero class.
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(classes,
+            _mm_setzero_si128())) != 0xffff)
+            break;
+
+        const auto slash = _mm_cmpeq_epi8(characters, mask);
+        const auto roll = _mm_shuffle_epi8(roll_table,
+            _mm_add_epi8(slash, high));
+        const auto values = _mm_add_epi8(characters, roll);
+
+        // Join four six bit values into three bytes per 32 bit word.
+        const auto pairs = _mm_maddubs_epi16(values,
+            _mm_set1_epi32(0x01400140));
+        const auto words = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out),
+            _mm_shuffle_epi8(words, join));
+    }
+
+    return group;
+}
+
+#endif // BASE64_SSSE3
+
+#ifdef BASE64_NEON
+
+static bool has_vector()
+{
+    return true;
+}
+
+static const uint8_t neon_table[64] =
+{
+    'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O',
+    'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', 'a', 'b', 'c', 'd',
+    'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's',
+    't', 'u', 'v', 'w', 'x', 'y', 'z', '0', '1', '2', '3', '4', '5', '6', '7',
+    '8', '9', '+', '/'
+};
+
+// Encode 48 bytes as 64 characters per step, deinterleaved by the load.
+static size_t encode_vector(char* out, const uint8_t* data, size_t size)
+{
+    const auto lookup = vld1q_u8_x4(neon_table);
+    const auto mask = vdupq_n_u8(0x3f);
+
+    size_t byte = 0;
+    for (; byte + 48 <= size; byte += 48, out += 64)
+    {
+        const auto in = vld3q_u8(data + byte);
+        uint8x16x4_t indexes;
+        indexes.val[0] = vshrq_n_u8(in.val[0], 2);
+        indexes.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[0], 4),
+            vshrq_n_u8(in.val[1], 4)), mask);
+        indexes.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[1], 2),
+            vshrq_n_u8(in.val[2], 6)), mask);
+        indexes.val[3] = vandq_u8(in.val[2], mask);
+
+        uint8x16x4_t characters;
+        characters.val[0] = vqtbl4q_u8(lookup, indexes.val[0]);
+        characters.val[1] = vqtbl4q_u8(lookup, indexes.val[1]);
+        characters.val[2] = vqtbl4q_u8(lookup, indexes.val[2]);
+        characters.val[3] = vqtbl4q_u8(lookup, indexes.val[3]);
+        vst4q_u8(reinterpret_cast<uint8_t*>(out), characters);
+    }
+
+    return byte;
+}
+
+// Map 16 characters to six bit values, setting invalid lanes in errors.
+static inline uint8x16_t to_values(uint8x16_t characters, uint8x16_t& errors)
+{
+    const auto upper = vsubq_u8(characters, vdupq_n_u8('A'));
+    const auto lower = vsubq_u8(characters, vdupq_n_u8('a'));
+    const auto digit = vsubq_u8(characters, vdupq_n_u8('0'));
+    const auto is_upper = vcltq_u8(upper, vdupq_n_u8(26));
+    const auto is_lower = vcltq_u8(lower, vdupq_n_u8(26));
+    const auto is_digit = vcltq_u8(digit, vdupq_n_u8(10));
+    const auto is_plus = vceqq_u8(characters, vdupq_n_u8('+'));
+    const auto is_slash = vceqq_u8(characters, vdupq_n_u8('/'));
+
+    auto values = vandq_u8(is_upper, upper);
+    values = vorrq_u8(values, vandq_u8(is_lower,
+        vaddq_u8(lower, vdupq_n_u8(26))));
+    values = vorrq_u8(values, vandq_u8(is_digit,
+        vaddq_u8(digit, vdupq_n_u8(52))));
+    values = vorrq_u8(values, vandq_u8(is_plus, vdupq_n_u8(62)));
+    values = vorrq_u8(values, vandq_u8(is_slash, vdupq_n_u8(63)));
+
+    const auto valid = vorrq_u8(vorrq_u8(is_upper, is_lower),
+        vorrq_u8(vorrq_u8(is_digit, is_plus), is_slash));
+    errors = vorrq_u8(errors, vmvnq_u8(valid));
+    return values;
+}
+
+// Decode 64 characters as 48 bytes per step, deinterleaved by the load.
+static size_t decode_vector(uint8_t* out, const char* in, size_t groups)
+{
+    size_t group = 0;
+    for (; group + 16 <= groups; group += 16, in += 64, out += 48)
+    {
+        const auto characters = vld4q_u8(reinterpret_cast<const uint8_t*>(in));
+        auto errors = vdupq_n_u8(0);
+        const auto first = to_values(characters.val[0], errors);
+        const auto second = to_values(characters.val[1], errors);
+        const auto third = to_values(characters.val[2], errors);
+        const auto fourth = to_values(characters.val[3], errors);
+
+        if (vmaxvq_u8(errors) != 0)
             break;
+
+        uint8x16x3_t bytes;
+        bytes.val[0] = vorrq_u8(vshlq_n_u8(first, 2), vshrq_n_u8(second, 4));
+        bytes.val[1] = vorrq_u8(vshlq_n_u8(second, 4), vshrq_n_u8(third, 2));
+        bytes.val[2] = vorrq_u8(vshlq_n_u8(third, 6), fourth);
+        vst3q_u8(out, bytes);
     }
 
+    return group;
+}
+
+#endif // BASE64_NEON
+
+// Public.
+//-----------------------------------------------------------------------------
+
+static void encode(char* out, const uint8_t* data, size_t size)
+{
+    size_t byte = 0;
+
+#if defined(BASE64_SSSE3) || defined(BASE64_NEON)
+    if (has_vector())
+        byte = encode_vector(out, data, size);
+#endif
+
+    encode_scalar(out + (byte / 3) * 4, data + byte, size - byte);
+}
+
+void encode_base64(std::string& out, data_slice unencoded)
+{
+    out.resize(encoded_size(unencoded.size()));
+
+    if (!out.empty())
+        encode(&out[0], unencoded.data(), unencoded.size());
+}
+
+std::string encode_base64(data_slice unencoded)
+{
+    std::string encoded;
+    encode_base64(encoded, unencoded);
     return encoded;
 }
 
-bool decode_base64(data_chunk& out, const std::string& in)
+void encode_base64(std::ostream& out, data_slice unencoded)
 {
-    const static uint32_t mask = 0x000000FF;
+    char buffer[stream_buffer];
+    auto data = unencoded.data();
+    auto size = unencoded.size();
 
+    for (; size > 0; data += stream_chunk)
+    {
+        const auto chunk = std::min(size, stream_chunk);
+        encode(buffer, data, chunk);
+        out.write(buffer, encoded_size(chunk));
+        size -= chunk;
+    }
+}
+
+bool decode_base64(data_chunk& out, const std::string& in)
+{
     const auto length = in.length();
     if ((length % 4) != 0)
         return false;
 
+    // Padding is only valid at the end of the last group.
     size_t padding = 0;
-    if (length > 0)
-    {
-        if (in[length - 1] == pad)
-            padding++;
-        if (in[length - 2] == pad)
-            padding++;
-    }
+    if (length > 0 && in[length - 1] == pad)
+        padding = in[length - 2] == pad ? 2 : 1;
+
+    const auto groups = length / 4;
+    const auto whole = padding == 0 ? groups : groups - 1;
+    data_chunk decoded((groups * 3) - padding);
+    const auto characters = in.data();
+    size_t group = 0;
 
-    data_chunk decoded;
-    decoded.reserve(((length / 4) * 3) - padding);
+#if defined(BASE64_SSSE3) || defined(BASE64_NEON)
+    if (has_vector())
+        group = decode_vector(decoded.data(), characters, whole);
+#endif
 
-    uint32_t value = 0;
-    for (auto cursor = in.begin(); cursor < in.end();)
+    if (!decode_scalar(decoded.data() + group * 3, characters + group * 4,
+        whole - group))
+        return false;
+
+    if (padding != 0)
     {
-        for (size_t position = 0; position < 4; position++)
-        {
-            value <<= 6;
-            if (*cursor >= 0x41 && *cursor <= 0x5A)
-                value |= *cursor - 0x41;
-            else if (*cursor >= 0x61 && *cursor <= 0x7A)
-                value |= *cursor - 0x47;
-            else if (*cursor >= 0x30 && *cursor <= 0x39)
-                value |= *cursor + 0x04;
-            else if (*cursor == 0x2B)
-                value |= 0x3E;
-            else if (*cursor == 0x2F)
-                value |= 0x3F;
-            else if (*cursor == pad)
-            {
-                // Handle 1 or 2 pad characters.
-                switch (in.end() - cursor)
-                {
-                    case 1:
-                        decoded.push_back((value >> 16) & mask);
-                        decoded.push_back((value >> 8) & mask);
-                        out = decoded;
-                        return true;
-                    case 2:
-                        decoded.push_back((value >> 10) & mask);
-                        out = decoded;
-                        return true;
-                    default:
-                        return false;
-                }
-            }
-            else
-                return false;
-
-            cursor++;
-        }
+        const auto last = &characters[whole * 4];
+        const auto first = to_value(last[0]);
+        const auto second = to_value(last[1]);
+        const auto third = padding == 1 ? to_value(last[2]) : uint8_t(0);
 
-        decoded.push_back((value >> 16) & mask);
-        decoded.push_back((value >> 8) & mask);
-        decoded.push_back((value >> 0) & mask);
+        if (first == invalid || second == invalid || third == invalid)
+            return false;
+
+        const auto end = decoded.data() + whole * 3;
+        const uint32_t value = (first << 18) | (second << 12) | (third << 6);
+        end[0] = static_cast<uint8_t>(value >> 16);
+
+        if (padding == 1)
+            end[1] = static_cast<uint8_t>(value >> 8);
     }
 
-    out = decoded;
+    out = std::move(decoded);
     return true;
 }
 
 } // namespace libbitcoin
-
@@ -0,0 +1,196 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/log/async_file_sink.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <bitcoin/bitcoin/utility/asio.hpp>
+
+namespace libbitcoin {
+namespace log {
+
+using namespace boost::log;
+
+static const asio::milliseconds retry_interval(1);
+
+async_file_sink::async_file_sink(file_ptr file, const async_options& options)
+  : file_(file),
+    batch_size_(std::max(options.batch_size, size_t(1))),
+    interval_(asio::milliseconds(options.flush_interval_milliseconds)),
+    overflow_(options.overflow),
+    buffer_(options.capacity),
+    stopped_(false),
+    sleeping_(false),
+    flush_(false),
+    dropped_(0),
+    waiting_(0)
+{
+    thread_.reset(new asio::thread(std::bind(&async_file_sink::run, this)));
+}
+
+async_file_sink::~async_file_sink()
+{
+    stop();
+}
+
+void async_file_sink::consume(const record_view& record,
+    const std::string& message)
+{
+    entry item{ record, message };
+
+    while (!buffer_.push(std::move(item)))
+    {
+        // Records arriving after stop are not written.
+        if (stopped_ || overflow_ == overflow_policy::drop)
+        {
+            ++dropped_;
+            return;
+        }
+
+        // Critical Section
+        ///////////////////////////////////////////////////////////////////////
+        std::unique_lock<std::mutex> lock(mutex_);
+        ++waiting_;
+        wake_.notify_one();
+
+        // The timeout bounds a wakeup missed between push and wait.
+        space_.wait_for(lock, retry_interval);
+        --waiting_;
+        ///////////////////////////////////////////////////////////////////////
+    }
+
+    // The writer polls at the flush interval, so a missed wakeup only delays.
+    if (sleeping_)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        wake_.notify_one();
+    }
+}
+
+void async_file_sink::flush()
+{
+    flush_ = true;
+    std::lock_guard<std::mutex> lock(mutex_);
+    wake_.notify_one();
+}
+
+void async_file_sink::stop()
+{
+    if (stopped_.exchange(true))
+        return;
+
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        wake_.notify_one();
+        space_.notify_all();
+    }
+    ///////////////////////////////////////////////////////////////////////////
+
+    thread_->join();
+}
+
+size_t async_file_sink::dropped() const
+{
+    return dropped_;
+}
+
+// Writer thread.
+// ----------------------------------------------------------------------------
+
+// Write up to one batch of records to the file backend.
+size_t async_file_sink::write()
+{
+    size_t count = 0;
+    entry item;
+
+    while (count < batch_size_ && buffer_.pop(item))
+    {
+        file_->consume(item.record, item.message);
+        ++count;
+    }
+
+    // Release the record now, it holds its attribute values.
+    item = entry();
+    return count;
+}
+
+void async_file_sink::run()
+{
+    auto dirty = false;
+    auto deadline = asio::steady_clock::now() + interval_;
+
+    while (true)
+    {
+        const auto written = write();
+        dirty |= (written != 0);
+
+        if (written != 0 && waiting_ != 0)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            space_.notify_all();
+        }
+
+        const auto now = asio::steady_clock::now();
+
+        // Flush once per interval (or on demand) rather than once per record.
+        if (dirty && (flush_ || stopped_ || now >= deadline))
+        {
+            file_->flush();
+            flush_ = false;
+            dirty = false;
+            deadline = now + interval_;
+        }
+
+        // A full batch implies more records may be buffered.
+        if (written == batch_size_)
+            continue;
+
+        if (stopped_ && buffer_.empty())
+            break;
+
+        // Critical Section
+        ///////////////////////////////////////////////////////////////////////
+        std::unique_lock<std::mutex> lock(mutex_);
+        sleeping_ = true;
+
+        // Written records remain unflushed until the deadline at the latest.
+        if (buffer_.empty() && !stopped_ && !flush_)
+        {
+            if (dirty)
+                wake_.wait_until(lock, deadline);
+            else
+                wake_.wait_for(lock, interval_);
+        }
+
+        sleeping_ = false;
+        ///////////////////////////////////////////////////////////////////////
+    }
+
+    if (dirty)
+        file_->flush();
+}
+
+} // namespace log
+} // namespace libbitcoin
@@ -17,9 +17,13 @@
 
 #include <bitcoin/bitcoin/log/file_collector.hpp>
 
+#include <iterator>
 #include <boost/bind.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include <boost/iostreams/filter/gzip.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
 #include <boost/spirit/home/qi/numeric/numeric_utils.hpp>
 
 #include <bitcoin/bitcoin/compat.hpp>
@@ -65,6 +69,49 @@ inline void move_file(
 #endif
 }
 
+//! The extension appended to compressed files
+static const char* const gzip_extension = ".gz";
+
+//! Determines if the file is a compressed file
+static bool is_compressed(filesystem::path const& path)
+{
+    return path.extension() == filesystem::path(gzip_extension);
+}
+
+//! The path of the file once compressed
+static filesystem::path compressed_path(filesystem::path const& path)
+{
+    filesystem::path target = path;
+    target += gzip_extension;
+    return target;
+}
+
+//! Compresses the file to the target path, false on failure
+static bool compress_file(filesystem::path const& from,
+    filesystem::path const& to)
+{
+    try
+    {
+        filesystem::ifstream input(from, std::ios_base::binary);
+        filesystem::ofstream output(to, std::ios_base::binary);
+        if (!input || !output)
+            return false;
+
+        boost::iostreams::filtering_ostream stream;
+        stream.push(boost::iostreams::gzip_compressor());
+        stream.push(output);
+        stream << input.rdbuf();
+
+        // Flush the compressor and write the gzip trailer
+        stream.reset();
+        return output.good();
+    }
+    catch (std::exception&)
+    {
+        return false;
+    }
+}
+
 //! The function parses the format placeholder for file counter
 bool parse_counter_placeholder(path_string_type::const_iterator& it,
     path_string_type::const_iterator end, unsigned int& width)
@@ -262,67 +309,115 @@ file_collector::file_collector(
     filesystem::path const& target_dir,
     size_t max_size,
     size_t min_free_space,
-    size_t max_files)
+    size_t max_files,
+    compression compress)
   : repository_(repo), max_size_(max_size), min_free_space_(min_free_space),
-    max_files_(max_files), base_path_(filesystem::current_path()),
-    total_size_(0), formatter_(5)
+    max_files_(max_files), compression_(compress),
+    base_path_(filesystem::current_path()), total_size_(0), formatter_(5)
+#if !defined(BOOST_LOG_NO_THREADS)
+    , stopping_(false)
+#endif // !defined(BOOST_LOG_NO_THREADS)
 {
     storage_dir_ = make_absolute(target_dir);
     filesystem::create_directories(storage_dir_);
+
+#if !defined(BOOST_LOG_NO_THREADS)
+    worker_ = boost::thread(boost::bind(&file_collector::work, this));
+#endif // !defined(BOOST_LOG_NO_THREADS)
 }
 
 
 file_collector::~file_collector()
 {
+#if !defined(BOOST_LOG_NO_THREADS)
+    // The worker drains the pending files before it exits
+    {
+        boost::lock_guard<boost::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+
+    pending_condition_.notify_one();
+    worker_.join();
+#endif // !defined(BOOST_LOG_NO_THREADS)
+
     repository_->remove_collector(this);
 }
 
-//! The function stores the specified file in the storage
-void file_collector::store_file(filesystem::path const& src_path)
+#if !defined(BOOST_LOG_NO_THREADS)
+//! Processes stored files until stopped
+void file_collector::work()
 {
-    // NOTE FOR THE FOLLOWING CODE:
-    // Avoid using Boost.Filesystem functions that would call path::codecvt(). store_file() can be called
-    // at process termination, and the global codecvt facet can already be destroyed at this point.
-    // https://svn.boost.org/trac/boost/ticket/8642
+    while (true)
+    {
+        file_info info;
 
-    // Let's construct the new file name
-    file_info info;
-    info.timestamp = filesystem::last_write_time(src_path);
-    info.size = filesystem::file_size(src_path);
+        {
+            boost::unique_lock<boost::mutex> lock(mutex_);
+            while (pending_.empty() && !stopping_)
+                pending_condition_.wait(lock);
 
-#ifdef _MSC_VER
-    path_string_type stem = src_path.stem().wstring();
-    path_string_type extension = src_path.extension().wstring();
-#else
-    path_string_type stem = src_path.stem().string();
-    path_string_type extension = src_path.extension().string();
-#endif
+            if (pending_.empty())
+                return;
 
-//    info.path = storage_dir_ / file_name_path;
+            info = pending_.front();
+            pending_.pop_front();
+        }
 
-    // If the file already exists, try to mangle the file name
-    // to ensure there's no conflict. I'll need to make this customizable some day.
-    unsigned int n = 0;
-    do
-    {
-        filesystem::path alt_file_name = formatter_(stem, extension, n++);
-        info.path = storage_dir_ / alt_file_name;
+        try
+        {
+            archive(info);
+        }
+        catch (std::exception&)
+        {
+            // A failed archival must not terminate the worker.
+        }
     }
-    while (filesystem::exists(info.path) && n < (std::numeric_limits<unsigned int>::max)());
+}
+#endif // !defined(BOOST_LOG_NO_THREADS)
 
+//! Compresses the stored file if configured and indexes it
+void file_collector::archive(file_info info)
+{
+    if (compression_ == compression::gzip && !is_compressed(info.path))
+    {
+        const filesystem::path target = compressed_path(info.path);
 
-    // The directory should have been created in constructor, but just in case it got deleted since then...
-    filesystem::create_directories(storage_dir_);
+        if (compress_file(info.path, target))
+        {
+            // Retain the original time so that pruning remains chronological
+            filesystem::last_write_time(target, info.timestamp);
+            filesystem::remove(info.path);
+            info.path = target;
+            info.size = filesystem::file_size(target);
+        }
+        else
+        {
+            // Keep the uncompressed file, the partial target is discarded
+            boost::system::error_code ec;
+            filesystem::remove(target, ec);
+        }
+    }
 
+    index(info);
+}
+
+//! Indexes the stored file and erases old files beyond restrictions
+void file_collector::index(file_info const& info)
+{
     BOOST_LOG_EXPR_IF_MT(boost::lock_guard<boost::mutex> lock(mutex_);)
 
+    // The stored file is indexed first, so its own size counts against the
+    // limits, and it is never itself erased (it is the newest).
+    files_.push_back(info);
+    total_size_ += info.size;
+
     // Check if an old file should be erased
     uintmax_t free_space = min_free_space_ ?
         filesystem::space(storage_dir_).available : 0;
 
-    file_list::iterator it = files_.begin(), end = files_.end();
+    file_list::iterator it = files_.begin(), end = std::prev(files_.end());
     while (it != end &&
-        (total_size_ + info.size > max_size_ || min_free_space_ > free_space || max_files_ <= files_.size()))
+        (total_size_ > max_size_ || min_free_space_ > free_space || max_files_ < files_.size()))
     {
         file_info& old_info = *it;
         if (filesystem::exists(old_info.path) && filesystem::is_regular_file(old_info.path))
@@ -350,12 +445,66 @@ void file_collector::store_file(filesystem::path const& src_path)
             files_.erase(it++);
         }
     }
+}
 
-    // Move/rename the file to the target storage
-    move_file(src_path, info.path);
+//! The function stores the specified file in the storage
+void file_collector::store_file(filesystem::path const& src_path)
+{
+    // NOTE FOR THE FOLLOWING CODE:
+    // Avoid using Boost.Filesystem functions that would call path::codecvt(). store_file() can be called
+    // at process termination, and the global codecvt facet can already be destroyed at this point.
+    // https://svn.boost.org/trac/boost/ticket/8642
 
-    files_.push_back(info);
-    total_size_ += info.size;
+    // Let's construct the new file name
+    file_info info;
+    info.timestamp = filesystem::last_write_time(src_path);
+    info.size = filesystem::file_size(src_path);
+
+#ifdef _MSC_VER
+    path_string_type stem = src_path.stem().wstring();
+    path_string_type extension = src_path.extension().wstring();
+#else
+    path_string_type stem = src_path.stem().string();
+    path_string_type extension = src_path.extension().string();
+#endif
+
+//    info.path = storage_dir_ / file_name_path;
+
+    // The directory should have been created in constructor, but just in case it got deleted since then...
+    filesystem::create_directories(storage_dir_);
+
+    {
+        BOOST_LOG_EXPR_IF_MT(boost::lock_guard<boost::mutex> lock(mutex_);)
+
+        // If the file already exists, try to mangle the file name
+        // to ensure there's no conflict. I'll need to make this customizable some day.
+        // The search resumes after the last name used for the stem, so the
+        // directory is not probed from the first name on each rotation.
+        unsigned int& n = counters_[stem];
+        do
+        {
+            filesystem::path alt_file_name = formatter_(stem, extension, n++);
+            info.path = storage_dir_ / alt_file_name;
+        }
+        while ((filesystem::exists(info.path) ||
+            filesystem::exists(compressed_path(info.path))) &&
+            n < (std::numeric_limits<unsigned int>::max)());
+
+        // Move/rename the file to the target storage, guarded so that
+        // concurrent stores cannot select the same name.
+        move_file(src_path, info.path);
+
+#if !defined(BOOST_LOG_NO_THREADS)
+        // Compression and erasure of old files are left to the worker
+        pending_.push_back(info);
+#endif // !defined(BOOST_LOG_NO_THREADS)
+    }
+
+#if !defined(BOOST_LOG_NO_THREADS)
+    pending_condition_.notify_one();
+#else
+    archive(info);
+#endif // !defined(BOOST_LOG_NO_THREADS)
 }
 
 
@@ -410,8 +559,11 @@ uintmax_t file_collector::scan_for_files(
                     {
                         // Check that the file name matches the pattern
                         unsigned int file_number = 0;
+                        // A compressed file matches without its extension
                         if (method != boost::log::sinks::file::scan_matching ||
-                            match_pattern(filename_string(info.path), mask, file_number))
+                            match_pattern(filename_string(info.path), mask, file_number) ||
+                            (is_compressed(info.path) &&
+                                match_pattern(filename_string(info.path.stem()), mask, file_number)))
                         {
                             info.size = filesystem::file_size(info.path);
                             total_size += info.size;
@@ -439,13 +591,18 @@ uintmax_t file_collector::scan_for_files(
 
 //! The function updates storage restrictions
 void file_collector::update(
-    size_t max_size, size_t min_free_space, size_t max_files)
+    size_t max_size, size_t min_free_space, size_t max_files,
+    compression compress)
 {
     BOOST_LOG_EXPR_IF_MT(boost::lock_guard<boost::mutex> lock(mutex_);)
 
     max_size_ = (std::min)(max_size_, max_size);
     min_free_space_ = (std::max)(min_free_space_, min_free_space);
     max_files_ = (std::min)(max_files_, max_files);
+
+    // Compression is enabled if requested by any sharing sink.
+    if (compress != compression::none)
+        compression_ = compress;
 }
 
 bool file_collector::is_governed(filesystem::path const& dir) const
@@ -29,7 +29,7 @@ static boost::arg<1> _1;
 
 boost::shared_ptr<boost::log::sinks::file::collector> file_collector_repository::get_collector(
     boost::filesystem::path const& target_dir, size_t max_size,
-    size_t min_free_space, size_t max_files)
+    size_t min_free_space, size_t max_files, compression compress)
 {
     BOOST_LOG_EXPR_IF_MT(boost::lock_guard<boost::mutex> lock(mutex_);)
 
@@ -42,7 +42,7 @@ boost::shared_ptr<boost::log::sinks::file::collector> file_collector_repository:
     {
         // This may throw if the collector is being currently destroyed
         result = it->shared_from_this();
-        result->update(max_size, min_free_space, max_files);
+        result->update(max_size, min_free_space, max_files, compress);
     }
     catch (boost::bad_weak_ptr&)
     {
@@ -52,7 +52,7 @@ boost::shared_ptr<boost::log::sinks::file::collector> file_collector_repository:
     {
         result = boost::make_shared<file_collector>(
             file_collector_repository::get(),
-            target_dir, max_size, min_free_space, max_files);
+            target_dir, max_size, min_free_space, max_files, compress);
 
         collectors_.push_back(*result);
     }
@@ -76,10 +76,11 @@ boost::shared_ptr<boost::log::sinks::file::collector> make_collector(
     boost::filesystem::path const& target_dir,
     size_t max_size,
     size_t min_free_space,
-    size_t max_files)
+    size_t max_files,
+    compression compress)
 {
     return file_collector_repository::get()->get_collector(target_dir,
-        max_size, min_free_space, max_files);
+        max_size, min_free_space, max_files, compress);
 }
 
 } // namespace log
@@ -0,0 +1,344 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/log/metrics.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <bitcoin/bitcoin/utility/asio.hpp>
+#include <bitcoin/bitcoin/utility/thread.hpp>
+
+namespace libbitcoin {
+namespace log {
+
+static const size_t percentile_count = 3;
+static const double percentiles[percentile_count] = { 0.5, 0.9, 0.99 };
+static const char* const percentile_names[percentile_count] =
+{
+    "p50", "p90", "p99"
+};
+
+// counter
+// ----------------------------------------------------------------------------
+
+metrics::counter::counter()
+  : value_(0)
+{
+}
+
+void metrics::counter::increment(int64_t value)
+{
+    value_.fetch_add(value, std::memory_order_relaxed);
+}
+
+int64_t metrics::counter::value() const
+{
+    return value_.load(std::memory_order_relaxed);
+}
+
+// gauge
+// ----------------------------------------------------------------------------
+
+metrics::gauge::gauge()
+  : value_(0), updated_(false)
+{
+}
+
+void metrics::gauge::set(uint64_t value)
+{
+    value_.store(value, std::memory_order_relaxed);
+    updated_.store(true, std::memory_order_relaxed);
+}
+
+uint64_t metrics::gauge::value() const
+{
+    return value_.load(std::memory_order_relaxed);
+}
+
+// timer
+// ----------------------------------------------------------------------------
+
+metrics::timer::timer()
+  : total_(0), maximum_(0)
+{
+    for (auto& bin: bins_)
+        bin.store(0, std::memory_order_relaxed);
+}
+
+void metrics::timer::record(const asio::duration& elapsed)
+{
+    const auto value = std::chrono::duration_cast<asio::microseconds>(elapsed);
+    record(static_cast<uint64_t>(std::max(value.count(),
+        asio::microseconds::rep(0))));
+}
+
+void metrics::timer::record(uint64_t microseconds)
+{
+    bins_[bin(microseconds)].fetch_add(1, std::memory_order_relaxed);
+    total_.fetch_add(microseconds, std::memory_order_relaxed);
+
+    auto maximum = maximum_.load(std::memory_order_relaxed);
+    while (microseconds > maximum && !maximum_.compare_exchange_weak(maximum,
+        microseconds, std::memory_order_relaxed));
+}
+
+// Samples recorded during the take may be split between intervals.
+metrics::timer::snapshot metrics::timer::take()
+{
+    snapshot out{ 0, 0, 0, std::vector<uint64_t>(bins, 0) };
+
+    for (size_t index = 0; index < bins; ++index)
+    {
+        out.bins[index] = bins_[index].exchange(0, std::memory_order_relaxed);
+        out.count += out.bins[index];
+    }
+
+    out.total = total_.exchange(0, std::memory_order_relaxed);
+    out.maximum = maximum_.exchange(0, std::memory_order_relaxed);
+    return out;
+}
+
+void metrics::timer::merge(const snapshot& interval)
+{
+    if (interval.count == 0)
+        return;
+
+    const auto count = std::min(interval.bins.size(), bins);
+
+    for (size_t index = 0; index < count; ++index)
+        if (interval.bins[index] != 0)
+            bins_[index].fetch_add(interval.bins[index],
+                std::memory_order_relaxed);
+
+    total_.fetch_add(interval.total, std::memory_order_relaxed);
+
+    auto maximum = maximum_.load(std::memory_order_relaxed);
+    while (interval.maximum > maximum && !maximum_.compare_exchange_weak(
+        maximum, interval.maximum, std::memory_order_relaxed));
+}
+
+size_t metrics::timer::bin(uint64_t microseconds)
+{
+    if (microseconds < sub_bins)
+        return static_cast<size_t>(microseconds);
+
+    size_t exponent = 0;
+    for (auto value = microseconds; value > 1; value >>= 1)
+        ++exponent;
+
+    // The sub bin is the sub_bits following the leading one.
+    const auto shift = exponent - sub_bits;
+    const auto sub = static_cast<size_t>(microseconds >> shift) & (sub_bins - 1);
+    return sub_bins + shift * sub_bins + sub;
+}
+
+uint64_t metrics::timer::floor(size_t bin)
+{
+    if (bin < sub_bins)
+        return bin;
+
+    const auto shift = (bin - sub_bins) / sub_bins;
+    const auto sub = (bin - sub_bins) % sub_bins;
+    return static_cast<uint64_t>(sub_bins + sub) << shift;
+}
+
+uint64_t metrics::timer::snapshot::percentile(double fraction) const
+{
+    if (count == 0)
+        return 0;
+
+    const auto rank = std::max(uint64_t(1), static_cast<uint64_t>(
+        std::ceil(fraction * count)));
+
+    uint64_t cumulative = 0;
+
+    for (size_t index = 0; index < bins.size(); ++index)
+    {
+        cumulative += bins[index];
+
+        if (cumulative < rank)
+            continue;
+
+        // The bin midpoint, which cannot exceed the largest sample.
+        const auto low = floor(index);
+        const auto high = index + 1 < timer::bins ? floor(index + 1) : low;
+        return std::min(maximum, low + (high - low) / 2);
+    }
+
+    return maximum;
+}
+
+// metrics
+// ----------------------------------------------------------------------------
+
+metrics::metrics()
+{
+}
+
+template <class Metric>
+Metric& metrics::get(registry<Metric>& metrics, const std::string& name)
+{
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    mutex_.lock_upgrade();
+
+    const auto it = metrics.find(name);
+
+    if (it != metrics.end())
+    {
+        auto& metric = *it->second;
+        mutex_.unlock_upgrade();
+        //---------------------------------------------------------------------
+        return metric;
+    }
+
+    mutex_.unlock_upgrade_and_lock();
+    //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    auto& metric = metrics[name];
+
+    // Another thread may have created it while upgrading.
+    if (!metric)
+        metric.reset(new Metric);
+
+    auto& out = *metric;
+    mutex_.unlock();
+    ///////////////////////////////////////////////////////////////////////////
+
+    return out;
+}
+
+metrics::counter& metrics::get_counter(const std::string& name)
+{
+    return get(counters_, name);
+}
+
+metrics::gauge& metrics::get_gauge(const std::string& name)
+{
+    return get(gauges_, name);
+}
+
+metrics::timer& metrics::get_timer(const std::string& name)
+{
+    return get(timers_, name);
+}
+
+void metrics::add_sampler(sampler handler)
+{
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    unique_lock lock(mutex_);
+    samplers_.push_back(handler);
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+static std::string milliseconds(uint64_t microseconds)
+{
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(3) << (microseconds / 1000.0);
+    return out.str();
+}
+
+static void pack(metrics::datagrams& out, std::string& datagram,
+    const std::string& line, size_t mtu)
+{
+    if (!datagram.empty() && datagram.size() + 1 + line.size() > mtu)
+    {
+        out.push_back(datagram);
+        datagram.clear();
+    }
+
+    if (!datagram.empty())
+        datagram += '\n';
+
+    datagram += line;
+}
+
+metrics::datagrams metrics::collect(const std::string& prefix, size_t mtu)
+{
+    datagrams out;
+    std::string datagram;
+
+    const auto emit = [&](const std::string& name, const std::string& value,
+        const char* type)
+    {
+        pack(out, datagram, prefix + name + ":" + value + "|" + type, mtu);
+    };
+
+    // Samplers set metrics, so are invoked outside of the lock.
+    std::vector<sampler> samplers;
+    {
+        shared_lock lock(mutex_);
+        samplers = samplers_;
+    }
+
+    for (const auto& sample: samplers)
+        sample(*this);
+
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    shared_lock lock(mutex_);
+
+    for (const auto& entry: counters_)
+    {
+        const auto value = entry.second->value_.exchange(0,
+            std::memory_order_relaxed);
+
+        if (value != 0)
+            emit(entry.first, std::to_string(value), "c");
+    }
+
+    for (const auto& entry: gauges_)
+        if (entry.second->updated_.exchange(false, std::memory_order_relaxed))
+            emit(entry.first, std::to_string(entry.second->value()), "g");
+
+    for (const auto& entry: timers_)
+    {
+        const auto snapshot = entry.second->take();
+
+        if (snapshot.count == 0)
+            continue;
+
+        // Aggregates are gauges as statsd cannot recombine them.
+        const auto& name = entry.first;
+        emit(name + ".count", std::to_string(snapshot.count), "c");
+        emit(name + ".mean", milliseconds(snapshot.total / snapshot.count),
+            "g");
+        emit(name + ".max", milliseconds(snapshot.maximum), "g");
+
+        for (size_t index = 0; index < percentile_count; ++index)
+            emit(name + "." + percentile_names[index],
+                milliseconds(snapshot.percentile(percentiles[index])), "g");
+    }
+    ///////////////////////////////////////////////////////////////////////////
+
+    if (!datagram.empty())
+        out.push_back(datagram);
+
+    return out;
+}
+
+} // namespace log
+} // namespace libbitcoin
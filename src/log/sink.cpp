@@ -28,10 +28,13 @@
 #include <boost/log/support/date_time.hpp>
 #include <boost/smart_ptr/make_shared.hpp>
 #include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/log/async_file_sink.hpp>
 #include <bitcoin/bitcoin/log/attributes.hpp>
 #include <bitcoin/bitcoin/log/file_collector_repository.hpp>
 #include <bitcoin/bitcoin/log/severity.hpp>
+#include <bitcoin/bitcoin/log/source.hpp>
 #include <bitcoin/bitcoin/unicode/ofstream.hpp>
+#include <bitcoin/bitcoin/utility/cpu_features.hpp>
 
 namespace libbitcoin {
 namespace log {
@@ -57,6 +60,7 @@ using namespace boost::posix_time;
     << MESSAGE_FORMATTER
 
 typedef synchronous_sink<text_file_backend> text_file_sink;
+typedef unlocked_sink<async_file_sink> async_text_file_sink;
 typedef synchronous_sink<text_ostream_backend> text_stream_sink;
 
 static const auto base_filter =
@@ -101,17 +105,16 @@ static boost::shared_ptr<collector> file_collector(
             rotation.maximum_archive_size,
         rotation.minimum_free_space,
         rotation.maximum_archive_files == 0 ? max_size_t :
-            rotation.maximum_archive_files);
+            rotation.maximum_archive_files,
+        rotation.archive_compression);
 }
 
-static boost::shared_ptr<text_file_sink> add_text_file_sink(
-    const rotable_file& rotation)
+static boost::shared_ptr<text_file_backend> make_text_file_backend(
+    const rotable_file& rotation, bool auto_flush)
 {
-    // Construct a log sink.
-    const auto sink = boost::make_shared<text_file_sink>();
-    const auto backend = sink->locked_backend();
+    const auto backend = boost::make_shared<text_file_backend>();
 
-    // Add a file stream for the sink to write to.
+    // Add a file stream for the backend to write to.
     backend->set_file_name_pattern(rotation.original_log);
 
     // Set archival parameters.
@@ -124,8 +127,35 @@ static boost::shared_ptr<text_file_sink> add_text_file_sink(
         backend->scan_for_files();
     }
 
-    // Flush the sink after each logical line.
-    backend->auto_flush(true);
+    // Flush the backend after each logical line (synchronous only).
+    backend->auto_flush(auto_flush);
+    return backend;
+}
+
+static boost::shared_ptr<text_file_sink> add_text_file_sink(
+    const rotable_file& rotation)
+{
+    // Construct a log sink.
+    const auto sink = boost::make_shared<text_file_sink>(
+        make_text_file_backend(rotation, true));
+
+    // Add the formatter to the sink.
+    sink->set_formatter(LINE_FORMATTER);
+
+    // Register the sink with the logging core.
+    core::get()->add_sink(sink);
+    return sink;
+}
+
+static boost::shared_ptr<async_text_file_sink> add_async_text_file_sink(
+    const rotable_file& rotation, const async_options& async)
+{
+    // The writer thread batches the flushes of the file backend.
+    const auto backend = boost::make_shared<async_file_sink>(
+        make_text_file_backend(rotation, false), async);
+
+    // Construct a log sink, formatting occurs on the logging thread.
+    const auto sink = boost::make_shared<async_text_file_sink>(backend);
 
     // Add the formatter to the sink.
     sink->set_formatter(LINE_FORMATTER);
@@ -157,6 +187,12 @@ static boost::shared_ptr<text_stream_sink> add_text_stream_sink(
     return sink;
 }
 
+// Report the processor kernels once the sinks are established.
+static void log_kernels()
+{
+    LOG_INFO("system") << "Processor " << cpu_kernels();
+}
+
 void initialize()
 {
     struct null_stream : public std::ostream
@@ -181,6 +217,8 @@ void initialize()
 void initialize(log::file& debug_file, log::file& error_file,
     log::stream& output_stream, log::stream& error_stream, bool verbose)
 {
+    set_threshold(verbose ? severity::verbose : severity::debug);
+
     if (verbose)
         add_text_stream_sink(debug_file)->set_filter(base_filter);
     else
@@ -189,11 +227,14 @@ void initialize(log::file& debug_file, log::file& error_file,
     add_text_stream_sink(error_file)->set_filter(error_filter);
     add_text_stream_sink(output_stream)->set_filter(info_filter);
     add_text_stream_sink(error_stream)->set_filter(error_filter);
+    log_kernels();
 }
 
 void initialize(const rotable_file& debug_file, const rotable_file& error_file,
     log::stream& output_stream, log::stream& error_stream, bool verbose)
 {
+    set_threshold(verbose ? severity::verbose : severity::debug);
+
     if (verbose)
         add_text_file_sink(debug_file)->set_filter(base_filter);
     else
@@ -202,6 +243,24 @@ void initialize(const rotable_file& debug_file, const rotable_file& error_file,
     add_text_file_sink(error_file)->set_filter(error_filter);
     add_text_stream_sink(output_stream)->set_filter(info_filter);
     add_text_stream_sink(error_stream)->set_filter(error_filter);
+    log_kernels();
+}
+
+void initialize(const rotable_file& debug_file, const rotable_file& error_file,
+    log::stream& output_stream, log::stream& error_stream, bool verbose,
+    const async_options& async)
+{
+    set_threshold(verbose ? severity::verbose : severity::debug);
+
+    if (verbose)
+        add_async_text_file_sink(debug_file, async)->set_filter(base_filter);
+    else
+        add_async_text_file_sink(debug_file, async)->set_filter(lean_filter);
+
+    add_async_text_file_sink(error_file, async)->set_filter(error_filter);
+    add_text_stream_sink(output_stream)->set_filter(info_filter);
+    add_text_stream_sink(error_stream)->set_filter(error_filter);
+    log_kernels();
 }
 
 } // namespace log
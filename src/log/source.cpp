@@ -0,0 +1,41 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/log/source.hpp>
+
+#include <atomic>
+#include <bitcoin/bitcoin/log/severity.hpp>
+
+namespace libbitcoin {
+namespace log {
+
+// The threshold admits all statements until set.
+std::atomic<severity> detail::threshold(severity::verbose);
+
+void set_threshold(severity level)
+{
+    detail::threshold.store(level, std::memory_order_relaxed);
+}
+
+severity threshold()
+{
+    return detail::threshold.load(std::memory_order_relaxed);
+}
+
+} // namespace log
+} // namespace libbitcoin
@@ -0,0 +1,130 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/log/statsd_client.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <boost/asio.hpp>
+#include <bitcoin/bitcoin/config/authority.hpp>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/log/metrics.hpp>
+#include <bitcoin/bitcoin/utility/asio.hpp>
+#include <bitcoin/bitcoin/utility/deadline.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
+
+namespace libbitcoin {
+namespace log {
+
+using namespace std::placeholders;
+using namespace boost::asio;
+using namespace boost::asio::ip;
+
+statsd_client::statsd_client(threadpool& pool, metrics& source,
+    const config::authority& server, const asio::duration& interval,
+    const std::string& prefix, size_t mtu)
+  : metrics_(source),
+    prefix_(prefix),
+    mtu_(mtu),
+    endpoint_(server.asio_ip(), server.port()),
+    timer_(std::make_shared<deadline>(pool, interval)),
+    started_(false),
+    stopped_(false),
+    socket_(pool.service())
+{
+}
+
+bool statsd_client::start()
+{
+    if (started_.exchange(true))
+        return false;
+
+    boost_code ec;
+
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        socket_.open(udp::v6(), ec);
+    }
+    ///////////////////////////////////////////////////////////////////////////
+
+    if (ec)
+        return false;
+
+    timer_->start(std::bind(&statsd_client::handle_timer,
+        shared_from_this(), _1));
+    return true;
+}
+
+void statsd_client::stop()
+{
+    if (stopped_.exchange(true))
+        return;
+
+    timer_->stop();
+    flush();
+
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    std::lock_guard<std::mutex> lock(mutex_);
+    boost_code ignore;
+    socket_.close(ignore);
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+void statsd_client::flush()
+{
+    send(metrics_.collect(prefix_, mtu_));
+}
+
+void statsd_client::send(const metrics::datagrams& payloads)
+{
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (!socket_.is_open())
+        return;
+
+    // One syscall per packed datagram, a lost datagram is not retried.
+    for (const auto& payload: payloads)
+    {
+        boost_code ignore;
+        socket_.send_to(buffer(payload), endpoint_, 0, ignore);
+    }
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+void statsd_client::handle_timer(const code& ec)
+{
+    if (ec || stopped_)
+        return;
+
+    flush();
+
+    // Restart the timer with the same period.
+    timer_->start(std::bind(&statsd_client::handle_timer,
+        shared_from_this(), _1));
+}
+
+} // namespace log
+} // namespace libbitcoin
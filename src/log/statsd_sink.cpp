@@ -85,7 +85,8 @@ static boost::shared_ptr<collector> file_collector(
             rotation.maximum_archive_size,
         rotation.minimum_free_space,
         rotation.maximum_archive_files == 0 ? max_size_t :
-            rotation.maximum_archive_files);
+            rotation.maximum_archive_files,
+        rotation.archive_compression);
 }
 
 static boost::shared_ptr<text_file_sink> add_text_file_sink(
@@ -0,0 +1,195 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/machine/instruction.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/machine/opcode.hpp>
+#include <bitcoin/bitcoin/machine/operation.hpp>
+#include <bitcoin/bitcoin/utility/assert.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+
+namespace libbitcoin {
+namespace machine {
+
+// Decoding.
+//-----------------------------------------------------------------------------
+
+// This must produce the same sequence as script operation decoding.
+instruction::list instruction::decode(data_slice bytes)
+{
+    list instructions;
+    size_t position = 0;
+
+    // One instruction per byte is the upper limit of instructions.
+    instructions.reserve(bytes.size());
+
+    while (position < bytes.size())
+    {
+        instructions.push_back(decode(bytes, position));
+
+        if (!instructions.back().is_valid())
+            break;
+    }
+
+    instructions.shrink_to_fit();
+    return instructions;
+}
+
+instruction instruction::decode(data_slice bytes, size_t& position)
+{
+    BC_CONSTEXPR auto op_75 = static_cast<uint8_t>(opcode::push_size_75);
+
+    const auto data = bytes.data();
+    const auto end = bytes.size();
+    BITCOIN_ASSERT(position < end);
+
+    const auto code = static_cast<opcode>(data[position++]);
+    const auto remaining = end - position;
+    size_t prefix = 0;
+    size_t size = 0;
+
+    switch (code)
+    {
+        case opcode::push_one_size:
+            prefix = sizeof(uint8_t);
+            break;
+        case opcode::push_two_size:
+            prefix = sizeof(uint16_t);
+            break;
+        case opcode::push_four_size:
+            prefix = sizeof(uint32_t);
+            break;
+        default:
+            const auto byte = static_cast<uint8_t>(code);
+            size = byte <= op_75 ? byte : 0;
+    }
+
+    if (prefix > remaining)
+    {
+        position = end;
+        return{};
+    }
+
+    // Sizes are little endian.
+    for (size_t byte = 0; byte < prefix; ++byte)
+        size |= static_cast<size_t>(data[position + byte]) << (8 * byte);
+
+    position += prefix;
+
+    // The max_block_size guard matches that of operation decoding.
+    if (size > max_block_size || size > end - position)
+    {
+        position = end;
+        return{};
+    }
+
+    const auto offset = static_cast<uint32_t>(position);
+    position += size;
+    return{ code, offset, static_cast<uint32_t>(size) };
+}
+
+// Constructors.
+//-----------------------------------------------------------------------------
+
+instruction::instruction()
+  : code_(invalid_code), valid_(false), offset_(0), size_(0)
+{
+}
+
+instruction::instruction(opcode code, uint32_t offset, uint32_t size)
+  : code_(code), valid_(true), offset_(offset), size_(size)
+{
+}
+
+// Properties.
+//-----------------------------------------------------------------------------
+
+opcode instruction::code() const
+{
+    return code_;
+}
+
+bool instruction::is_valid() const
+{
+    return valid_;
+}
+
+uint32_t instruction::offset() const
+{
+    return offset_;
+}
+
+uint32_t instruction::size() const
+{
+    return size_;
+}
+
+data_slice instruction::data(const data_chunk& bytes) const
+{
+    const auto begin = bytes.data() + offset_;
+    return { begin, begin + size_ };
+}
+
+// Utilities.
+//-----------------------------------------------------------------------------
+
+bool instruction::is_push() const
+{
+    return operation::is_push(code_);
+}
+
+bool instruction::is_payload() const
+{
+    return operation::is_payload(code_);
+}
+
+bool instruction::is_counted() const
+{
+    return operation::is_counted(code_);
+}
+
+bool instruction::is_version() const
+{
+    return operation::is_version(code_);
+}
+
+bool instruction::is_positive() const
+{
+    return operation::is_positive(code_);
+}
+
+bool instruction::is_disabled() const
+{
+    return operation::is_disabled(code_);
+}
+
+bool instruction::is_relaxed_push() const
+{
+    return operation::is_relaxed_push(code_);
+}
+
+bool instruction::is_oversized() const
+{
+    return size_ > max_push_data_size;
+}
+
+} // namespace machine
+} // namespace libbitcoin
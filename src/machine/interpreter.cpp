@@ -18,21 +18,88 @@
  */
 #include <bitcoin/bitcoin/machine/interpreter.hpp>
 
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <bitcoin/bitcoin/chain/script.hpp>
 #include <bitcoin/bitcoin/constants.hpp>
 #include <bitcoin/bitcoin/error.hpp>
 #include <bitcoin/bitcoin/machine/operation.hpp>
 #include <bitcoin/bitcoin/machine/program.hpp>
+#include <bitcoin/bitcoin/machine/rule_fork.hpp>
+#include <bitcoin/bitcoin/machine/script_profile.hpp>
+#include <bitcoin/bitcoin/math/elliptic_curve.hpp>
+#include <bitcoin/bitcoin/utility/parallel.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
 
 namespace libbitcoin {
 namespace machine {
 
-code interpreter::run(program& program)
+// Recorders are resolved at compile time, so the unprofiled loop carries no
+// measurement code. The profiled loop times each executed operation.
+class no_recorder
 {
-    code ec;
+public:
+    void start()
+    {
+    }
 
+    void stop(const operation&, const program&)
+    {
+    }
+};
+
+class profile_recorder
+{
+public:
+    profile_recorder(script_profile& profile)
+      : profile_(profile)
+    {
+    }
+
+    void start()
+    {
+        start_ = clock::now();
+    }
+
+    void stop(const operation& op, const program& program)
+    {
+        const auto elapsed = clock::now() - start_;
+        profile_.record_operation(op.code(),
+            std::chrono::duration_cast<script_profile::duration>(elapsed));
+        profile_.record_depth(program.size());
+    }
+
+private:
+    typedef std::chrono::steady_clock clock;
+
+    script_profile& profile_;
+    clock::time_point start_;
+};
+
+code interpreter::run(program& program)
+{
     if (!program.is_valid())
         return error::invalid_script;
 
+    const auto profile = program.profile();
+
+    if (profile == nullptr)
+    {
+        no_recorder recorder;
+        return run(program, recorder);
+    }
+
+    profile_recorder recorder(*profile);
+    return run(program, recorder);
+}
+
+template <typename Recorder>
+code interpreter::run(program& program, Recorder& recorder)
+{
+    code ec;
+
     for (const auto& op: program)
     {
         if (op.is_oversized())
@@ -46,7 +113,11 @@ code interpreter::run(program& program)
 
         if (program.if_(op))
         {
-            if ((ec = run_op(op, program)))
+            recorder.start();
+            ec = run_op(op, program);
+            recorder.stop(op, program);
+
+            if (ec)
                 return ec;
 
             if (program.is_stack_overflow())
@@ -62,5 +133,91 @@ code interpreter::run(const operation& op, program& program)
     return run_op(op, program);
 }
 
+// private
+// Every signature and key pair that the serial match could reach is
+// verified concurrently, and the serial match is then replayed over the
+// results. So the result (including the precedence of encoding failures)
+// is that of the serial match, at the cost of additional verifications.
+interpreter::result interpreter::check_multisig_speculative(
+    const program& program, const chain::script& script_code,
+    const program::element_stack& endorsements,
+    const program::element_stack& public_keys, threadpool& pool)
+{
+    struct parsed
+    {
+        uint8_t sighash;
+        ec_signature signature;
+    };
+
+    const auto forks = program.forks();
+    const auto bip66 = chain::script::is_enabled(forks, rule_fork::bip66_rule);
+    const auto bip143 = chain::script::is_enabled(forks,
+        rule_fork::bip143_rule);
+
+    // Version condition preserves independence of bip141 and bip143.
+    const auto version = bip143 ? program.version() :
+        script_version::unversioned;
+
+    // Signatures are parsed up to the first failure, which is not reachable
+    // by the serial match unless all preceding signatures match.
+    result failure = error::success;
+    std::vector<parsed> signatures;
+    signatures.reserve(endorsements.size());
+
+    for (const auto& endorsement: endorsements)
+    {
+        parsed signature;
+        data_slice distinguished(nullptr, nullptr);
+
+        // BIP62: An empty endorsement is not considered lax encoding.
+        if (!parse_endorsement(signature.sighash, distinguished, endorsement))
+        {
+            failure = error::invalid_signature_encoding;
+            break;
+        }
+
+        // Parse DER signature into an EC signature.
+        if (!parse_signature(signature.signature, distinguished, bip66))
+        {
+            failure = bip66 ? error::invalid_signature_lax_encoding :
+                error::invalid_signature_encoding;
+            break;
+        }
+
+        signatures.push_back(signature);
+    }
+
+    // Bytes rather than bools, so that results are written concurrently.
+    const auto keys = public_keys.size();
+    std::vector<uint8_t> matches(signatures.size() * keys, 0);
+
+    const auto verify = [&](size_t index)
+    {
+        const auto& signature = signatures[index / keys];
+        const auto& public_key = public_keys[index % keys];
+
+        matches[index] = chain::script::check_signature(signature.signature,
+            signature.sighash, public_key, script_code, program.transaction(),
+            program.input_index(), version, program.value()) ? 1 : 0;
+
+        return code(error::success);
+    };
+
+    // Each verification is costly, so pairs are claimed individually.
+    parallel_for(pool, matches.size(), 1, verify);
+
+    // The exact number of signatures are required and must be in order.
+    // One key can validate more than one script. So we always advance
+    // until we exhaust either pubkeys (fail) or signatures (pass).
+    size_t key = 0;
+
+    for (size_t index = 0; index < signatures.size(); ++index)
+        while (matches[index * keys + key] == 0)
+            if (++key == keys)
+                return error::incorrect_signature;
+
+    return failure;
+}
+
 } // namespace machine
 } // namespace libbitcoin
@@ -20,6 +20,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <iterator>
 #include <utility>
 #include <bitcoin/bitcoin/chain/script.hpp>
 #include <bitcoin/bitcoin/chain/transaction.hpp>
@@ -35,15 +36,23 @@ using namespace bc::chain;
 
 // Fixed tuning parameters, max_stack_size ensures no reallocation.
 static constexpr size_t stack_capactity = max_stack_size;
-static constexpr size_t condition_capactity = max_counted_ops;
 static const chain::transaction default_tx_;
 static const chain::script default_script_;
 
 void program::reserve_stacks()
 {
-    primary_.reserve(stack_capactity);
-    alternate_.reserve(stack_capactity);
-    condition_.reserve(condition_capactity);
+    if (context_ == nullptr)
+    {
+        primary_.reserve(stack_capactity);
+        alternate_.reserve(stack_capactity);
+        return;
+    }
+
+    // A primary stack moved from another program is already reserved.
+    if (primary_.capacity() == 0)
+        primary_ = context_->acquire();
+
+    alternate_ = context_->acquire();
 }
 
 // Constructors.
@@ -55,10 +64,12 @@ program::program()
     input_index_(0),
     forks_(0),
     value_(0),
+    context_(nullptr),
     version_(script_version::unversioned),
-    negative_count_(0),
     operation_count_(0),
-    jump_(script_.begin())
+    jump_(script_.begin()),
+    condition_size_(0),
+    first_false_(no_false_condition)
 {
     reserve_stacks();
 }
@@ -69,10 +80,12 @@ program::program(const script& script)
     input_index_(0),
     forks_(0),
     value_(0),
+    context_(nullptr),
     version_(script_version::unversioned),
-    negative_count_(0),
     operation_count_(0),
-    jump_(script_.begin())
+    jump_(script_.begin()),
+    condition_size_(0),
+    first_false_(no_false_condition)
 {
     reserve_stacks();
 }
@@ -84,10 +97,29 @@ program::program(const script& script, const chain::transaction& transaction,
     input_index_(input_index),
     forks_(forks),
     value_(max_uint64),
+    context_(nullptr),
     version_(script_version::unversioned),
-    negative_count_(0),
     operation_count_(0),
-    jump_(script_.begin())
+    jump_(script_.begin()),
+    condition_size_(0),
+    first_false_(no_false_condition)
+{
+    reserve_stacks();
+}
+
+program::program(const script& script, const chain::transaction& transaction,
+    uint32_t input_index, uint32_t forks, verification_context& context)
+  : script_(script),
+    transaction_(transaction),
+    input_index_(input_index),
+    forks_(forks),
+    value_(max_uint64),
+    context_(&context),
+    version_(script_version::unversioned),
+    operation_count_(0),
+    jump_(script_.begin()),
+    condition_size_(0),
+    first_false_(no_false_condition)
 {
     reserve_stacks();
 }
@@ -96,20 +128,60 @@ program::program(const script& script, const chain::transaction& transaction,
 program::program(const script& script, const chain::transaction& transaction,
     uint32_t input_index, uint32_t forks, data_stack&& stack, uint64_t value,
     script_version version)
+  : program(script, transaction, input_index, forks, std::move(stack), value,
+        version, nullptr)
+{
+}
+
+// Condition, alternate, jump and operation_count are not copied.
+program::program(const script& script, const chain::transaction& transaction,
+    uint32_t input_index, uint32_t forks, data_stack&& stack, uint64_t value,
+    script_version version, verification_context& context)
+  : program(script, transaction, input_index, forks, std::move(stack), value,
+        version, &context)
+{
+}
+
+// private
+program::program(const script& script, const chain::transaction& transaction,
+    uint32_t input_index, uint32_t forks, data_stack&& stack, uint64_t value,
+    script_version version, verification_context* context)
   : script_(script),
     transaction_(transaction),
     input_index_(input_index),
     forks_(forks),
     value_(value),
+    context_(context),
     version_(version),
-    negative_count_(0),
     operation_count_(0),
     jump_(script_.begin()),
-    primary_(std::move(stack))
+    condition_size_(0),
+    first_false_(no_false_condition)
 {
     reserve_stacks();
+    primary_.reserve(stack.size());
+
+    // Chunks are adopted by their elements, avoiding a copy of large items.
+    for (auto& item: stack)
+        primary_.emplace_back(std::move(item));
+
+    stack.clear();
 }
 
+// Condition, alternate, jump and operation_count are not copied.
+program::program(const script& script, const chain::transaction& transaction,
+    uint32_t input_index, uint32_t forks, data_stack::const_iterator first,
+    data_stack::const_iterator last, uint64_t value, script_version version,
+    verification_context& context)
+  : program(script, transaction, input_index, forks, data_stack{}, value,
+        version, &context)
+{
+    primary_.reserve(std::distance(first, last));
+
+    // Elements are read from the slices, small items without allocation.
+    for (auto it = first; it != last; ++it)
+        primary_.emplace_back(data_slice(*it));
+}
 
 // Condition, alternate, jump and operation_count are not copied.
 program::program(const script& script, const program& other)
@@ -118,13 +190,16 @@ program::program(const script& script, const program& other)
     input_index_(other.input_index_),
     forks_(other.forks_),
     value_(other.value_),
+    context_(other.context_),
     version_(script_version::unversioned),
-    negative_count_(0),
     operation_count_(0),
     jump_(script_.begin()),
-    primary_(other.primary_)
+    condition_size_(0),
+    first_false_(no_false_condition)
 {
+    // The copy is made into reserved capacity.
     reserve_stacks();
+    primary_ = other.primary_;
 }
 
 // Condition, alternate, jump and operation_count are not moved.
@@ -134,15 +209,26 @@ program::program(const script& script, program&& other, bool)
     input_index_(other.input_index_),
     forks_(other.forks_),
     value_(other.value_),
+    context_(other.context_),
     version_(script_version::unversioned),
-    negative_count_(0),
     operation_count_(0),
     jump_(script_.begin()),
-    primary_(std::move(other.primary_))
+    primary_(std::move(other.primary_)),
+    condition_size_(0),
+    first_false_(no_false_condition)
 {
     reserve_stacks();
 }
 
+program::~program()
+{
+    if (context_ == nullptr)
+        return;
+
+    context_->release(std::move(primary_));
+    context_->release(std::move(alternate_));
+}
+
 // Instructions.
 //-----------------------------------------------------------------------------
 
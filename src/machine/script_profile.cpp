@@ -0,0 +1,130 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/machine/script_profile.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <boost/log/common.hpp>
+#include <boost/log/expressions.hpp>
+#include <boost/thread/lock_guard.hpp>
+#include <bitcoin/bitcoin/log/statsd_source.hpp>
+#include <bitcoin/bitcoin/machine/opcode.hpp>
+#include <bitcoin/bitcoin/machine/rule_fork.hpp>
+
+namespace libbitcoin {
+namespace machine {
+
+using namespace std::chrono;
+
+script_profile::script_profile()
+{
+    reset();
+}
+
+void script_profile::record_operation(opcode code, duration elapsed)
+{
+    auto& metrics = operations_[static_cast<uint8_t>(code)];
+    ++metrics.count;
+    metrics.elapsed += elapsed;
+}
+
+void script_profile::record_depth(size_t depth)
+{
+    depth_ = std::max(depth_, depth);
+}
+
+void script_profile::record_input(duration elapsed)
+{
+    ++inputs_;
+    input_elapsed_ += elapsed;
+}
+
+void script_profile::merge(const script_profile& other)
+{
+    for (size_t code = 0; code < operations_.size(); ++code)
+    {
+        operations_[code].count += other.operations_[code].count;
+        operations_[code].elapsed += other.operations_[code].elapsed;
+    }
+
+    depth_ = std::max(depth_, other.depth_);
+    inputs_ += other.inputs_;
+    input_elapsed_ += other.input_elapsed_;
+}
+
+void script_profile::reset()
+{
+    operations_.fill({ 0, duration::zero() });
+    depth_ = 0;
+    inputs_ = 0;
+    input_elapsed_ = duration::zero();
+}
+
+// Properties.
+//-----------------------------------------------------------------------------
+
+const script_profile::operation_metrics& script_profile::operation(
+    opcode code) const
+{
+    return operations_[static_cast<uint8_t>(code)];
+}
+
+size_t script_profile::depth() const
+{
+    return depth_;
+}
+
+uint64_t script_profile::inputs() const
+{
+    return inputs_;
+}
+
+script_profile::duration script_profile::input_elapsed() const
+{
+    return input_elapsed_;
+}
+
+// Operation times are sent as nanosecond counters, since the statsd timer is
+// millisecond resolution and most operations complete in less than that.
+void script_profile::publish(const std::string& prefix) const
+{
+    for (size_t code = 0; code < operations_.size(); ++code)
+    {
+        const auto& metrics = operations_[code];
+        if (metrics.count == 0)
+            continue;
+
+        const auto name = prefix + ".operation." + opcode_to_string(
+            static_cast<opcode>(code), rule_fork::all_rules);
+
+        BC_STATS_COUNTER(name + ".count", metrics.count);
+        BC_STATS_COUNTER(name + ".nanoseconds", metrics.elapsed.count());
+    }
+
+    BC_STATS_GAUGE(prefix + ".depth", depth_);
+    BC_STATS_COUNTER(prefix + ".inputs", inputs_);
+    BC_STATS_TIMER(prefix + ".input",
+        duration_cast<milliseconds>(input_elapsed_));
+}
+
+} // namespace machine
+} // namespace libbitcoin
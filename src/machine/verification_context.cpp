@@ -0,0 +1,86 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/machine/verification_context.hpp>
+
+#include <cstddef>
+#include <utility>
+#include <bitcoin/bitcoin/constants.hpp>
+
+namespace libbitcoin {
+namespace machine {
+
+// Fixed tuning parameter, max_stack_size ensures no reallocation.
+static constexpr size_t stack_capactity = max_stack_size;
+
+verification_context::verification_context()
+  : profile_(nullptr), multisig_pool_(nullptr)
+{
+}
+
+verification_context::verification_context(script_profile& profile)
+  : profile_(&profile), multisig_pool_(nullptr)
+{
+}
+
+verification_context::element_stack verification_context::acquire()
+{
+    if (stacks_.empty())
+    {
+        element_stack stack;
+        stack.reserve(stack_capactity);
+        return stack;
+    }
+
+    auto stack = std::move(stacks_.back());
+    stacks_.pop_back();
+    return stack;
+}
+
+void verification_context::release(element_stack&& stack)
+{
+    // A moved-from stack has no capacity worth retaining.
+    if (stack.capacity() < stack_capactity)
+        return;
+
+    stack.clear();
+    stacks_.push_back(std::move(stack));
+}
+
+size_t verification_context::size() const
+{
+    return stacks_.size();
+}
+
+script_profile* verification_context::profile() const
+{
+    return profile_;
+}
+
+void verification_context::set_multisig_pool(threadpool* pool)
+{
+    multisig_pool_ = pool;
+}
+
+threadpool* verification_context::multisig_pool() const
+{
+    return multisig_pool_;
+}
+
+} // namespace machine
+} // namespace libbitcoin
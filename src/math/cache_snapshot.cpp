@@ -0,0 +1,225 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/math/cache_snapshot.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <string>
+#include <boost/filesystem.hpp>
+#include <boost/system/error_code.hpp>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/asio.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/parallel.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
+
+namespace libbitcoin {
+
+// The prefix before its mac.
+static BC_CONSTEXPR size_t header_size = 24;
+
+hash_digest cache_snapshot::to_salt(const hash_digest& secret,
+    const std::string& name)
+{
+    return hmac_sha256_hash(to_chunk(name), secret);
+}
+
+bool cache_snapshot::store(const path& file, const hash_digest& salt,
+    uint32_t tag, const hash_list& keys)
+{
+    std::ofstream stream(file.string(), std::ios::binary | std::ios::trunc);
+
+    if (!stream)
+        return false;
+
+    data_chunk data;
+    data.reserve(chunk_keys * hash_size + hash_size);
+    byte_writer sink(data);
+
+    const auto write = [&]()
+    {
+        sink.write_hash(hmac_sha256_hash(data, salt));
+        stream.write(reinterpret_cast<const char*>(data.data()),
+            data.size());
+        data.clear();
+    };
+
+    sink.write_4_bytes_little_endian(magic);
+    sink.write_4_bytes_little_endian(version);
+    sink.write_8_bytes_little_endian(keys.size());
+    sink.write_4_bytes_little_endian(tag);
+    sink.write_4_bytes_little_endian(0);
+    write();
+
+    for (size_t index = 0; index < keys.size(); ++index)
+    {
+        sink.write_hash(keys[index]);
+
+        if ((index + 1) % chunk_keys == 0 || index + 1 == keys.size())
+            write();
+    }
+
+    stream.flush();
+    return static_cast<bool>(stream);
+}
+
+cache_snapshot::cache_snapshot()
+  : salt_(null_hash), size_(0), tag_(0)
+{
+}
+
+bool cache_snapshot::open(const path& file, const hash_digest& salt)
+{
+    close();
+    boost::system::error_code ec;
+
+    // An empty file cannot be mapped.
+    if (boost::filesystem::file_size(file, ec) == 0 || ec)
+        return false;
+
+    try
+    {
+        file_.open(file.string());
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+
+    if (!file_.is_open())
+        return false;
+
+    const auto begin = reinterpret_cast<const uint8_t*>(file_.data());
+    const auto size = file_.size();
+    byte_reader source({ begin, begin + size });
+
+    const auto file_magic = source.read_4_bytes_little_endian();
+    const auto file_version = source.read_4_bytes_little_endian();
+    const auto count = source.read_8_bytes_little_endian();
+    const auto tag = source.read_4_bytes_little_endian();
+    source.skip(4);
+    const auto mac = source.read_hash();
+
+    if (!source || file_magic != magic || file_version != version ||
+        count > (size - prefix_size) / hash_size ||
+        mac != hmac_sha256_hash({ begin, begin + header_size }, salt))
+    {
+        close();
+        return false;
+    }
+
+    const auto count_keys = static_cast<size_t>(count);
+    const auto chunks = (count_keys + chunk_keys - 1) / chunk_keys;
+
+    if (size != prefix_size + (count_keys + chunks) * hash_size)
+    {
+        close();
+        return false;
+    }
+
+    salt_ = salt;
+    size_ = count_keys;
+    tag_ = tag;
+    return true;
+}
+
+void cache_snapshot::close()
+{
+    if (file_.is_open())
+        file_.close();
+
+    salt_ = null_hash;
+    size_ = 0;
+    tag_ = 0;
+}
+
+bool cache_snapshot::is_open() const
+{
+    return file_.is_open();
+}
+
+size_t cache_snapshot::size() const
+{
+    return size_;
+}
+
+uint32_t cache_snapshot::tag() const
+{
+    return tag_;
+}
+
+// private
+size_t cache_snapshot::chunks() const
+{
+    return (size_ + chunk_keys - 1) / chunk_keys;
+}
+
+size_t cache_snapshot::load(threadpool& pool, const asio::duration& timeout,
+    const inserter& insert) const
+{
+    if (!is_open())
+        return 0;
+
+    const auto deadline = asio::steady_clock::now() + timeout;
+    const auto begin = reinterpret_cast<const uint8_t*>(file_.data()) +
+        prefix_size;
+    std::atomic<size_t> accepted(0);
+
+    // A failure code only stops the claiming of further chunks.
+    const auto load_chunk = [&](size_t chunk)
+    {
+        if (asio::steady_clock::now() >= deadline)
+            return error::channel_timeout;
+
+        const auto first = chunk * chunk_keys;
+        const auto keys = std::min(size_t(chunk_keys), size_ - first);
+        const auto start = begin + (first + chunk) * hash_size;
+        const auto end = start + keys * hash_size;
+
+        // A chunk that is not authenticated is skipped, not loaded in part.
+        if (!std::equal(end, end + hash_size,
+            hmac_sha256_hash({ start, end }, salt_).begin()))
+            return error::success;
+
+        for (auto key = start; key != end; key += hash_size)
+        {
+            hash_digest value;
+            std::copy(key, key + hash_size, value.begin());
+
+            if (!insert(value))
+                return error::operation_failed;
+
+            ++accepted;
+        }
+
+        return error::success;
+    };
+
+    parallel_for(pool, chunks(), 1, load_chunk);
+    return accepted;
+}
+
+} // namespace libbitcoin
@@ -18,6 +18,7 @@
  */
 #include <bitcoin/bitcoin/math/crypto.hpp>
 
+#include <cstddef>
 #include <bitcoin/bitcoin/math/elliptic_curve.hpp>
 #include <bitcoin/bitcoin/math/hash.hpp>
 #include <bitcoin/bitcoin/utility/assert.hpp>
@@ -26,19 +27,34 @@
 
 namespace libbitcoin {
 
+// The aes_block array is contiguous and has no padding.
+static_assert(sizeof(aes_block) == AES256_BLOCK_LENGTH, "block size");
+
 void aes256_encrypt(const aes_secret& key, aes_block& block)
+{
+    aes256_encrypt(key, &block, 1);
+}
+
+void aes256_decrypt(const aes_secret& key, aes_block& block)
+{
+    aes256_decrypt(key, &block, 1);
+}
+
+void aes256_encrypt(const aes_secret& key, aes_block* blocks, size_t count)
 {
     aes256_context context;
     aes256_init(&context, key.data());
-    aes256_encrypt_ecb(&context, block.data());
+    aes256_encrypt_ecb_blocks(&context, reinterpret_cast<uint8_t*>(blocks),
+        count);
     aes256_done(&context);
 }
 
-void aes256_decrypt(const aes_secret& key, aes_block& block)
+void aes256_decrypt(const aes_secret& key, aes_block* blocks, size_t count)
 {
     aes256_context context;
     aes256_init(&context, key.data());
-    aes256_decrypt_ecb(&context, block.data());
+    aes256_decrypt_ecb_blocks(&context, reinterpret_cast<uint8_t*>(blocks),
+        count);
     aes256_done(&context);
 }
 
@@ -0,0 +1,176 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/math/ec_point_table.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <secp256k1.h>
+#include <bitcoin/bitcoin/math/elliptic_curve.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include "secp256k1_initializer.hpp"
+
+namespace libbitcoin {
+
+static_assert(sizeof(secp256k1_pubkey) == 64, "parsed point size");
+
+// Four bit windows over the 256 bit scalar.
+static constexpr size_t window_bits = 4;
+static constexpr size_t digits = 1 << window_bits;
+static constexpr size_t windows = 8 * ec_secret_size / window_bits;
+
+// A window digit of the big endian scalar, least significant window first.
+static size_t digit(const ec_secret& scalar, size_t window)
+{
+    const auto byte = scalar[ec_secret_size - 1 - window / 2];
+    return (window % 2 == 0) ? (byte & 0x0f) : (byte >> 4);
+}
+
+static void to_parsed(byte_array<64>& out,
+    const secp256k1_pubkey& point)
+{
+    std::copy_n(std::begin(point.data), out.size(), out.begin());
+}
+
+static void to_pubkey(secp256k1_pubkey& out,
+    const byte_array<64>& point)
+{
+    std::copy_n(point.begin(), point.size(), std::begin(out.data));
+}
+
+static bool sum(const secp256k1_context* context, secp256k1_pubkey& out,
+    const secp256k1_pubkey& left, const secp256k1_pubkey& right)
+{
+    const secp256k1_pubkey* points[] = { &left, &right };
+    return secp256k1_ec_pubkey_combine(context, &out, points, 2) == 1;
+}
+
+ec_point_table::ec_point_table(const ec_compressed& point)
+  : point_(point)
+{
+    secp256k1_pubkey base;
+    secp256k1_pubkey total;
+    const auto context = verification.context();
+
+    if (secp256k1_ec_pubkey_parse(context, &base, point.data(),
+        point.size()) != 1)
+        return;
+
+    std::vector<parsed_point> table(windows * digits);
+    auto entry = table.begin();
+    total = base;
+
+    // Each window's multiples are successive sums of its base, the last being
+    // the base of the next window. Sums of multiples of a valid point (below
+    // the group order) cannot be infinity, so cannot fail.
+    for (size_t window = 0; window < windows; ++window)
+    {
+        auto multiple = base;
+        to_parsed(*entry++, multiple);
+
+        for (size_t index = 1; index < digits; ++index)
+        {
+            sum(context, multiple, multiple, base);
+            to_parsed(*entry++, multiple);
+        }
+
+        if (window != 0)
+            sum(context, total, total, base);
+
+        base = multiple;
+    }
+
+    secp256k1_ec_pubkey_negate(context, &total);
+    to_parsed(offset_, total);
+    table_.swap(table);
+}
+
+ec_point_table::operator bool() const
+{
+    return !table_.empty();
+}
+
+const ec_compressed& ec_point_table::point() const
+{
+    return point_;
+}
+
+bool ec_point_table::multiply(ec_compressed& out,
+    const ec_secret& scalar) const
+{
+    return multiply<ec_compressed_size>(out, scalar);
+}
+
+bool ec_point_table::multiply(ec_uncompressed& out,
+    const ec_secret& scalar) const
+{
+    return multiply<ec_uncompressed_size>(out, scalar);
+}
+
+// private
+template <size_t Size>
+bool ec_point_table::multiply(byte_array<Size>& out,
+    const ec_secret& scalar) const
+{
+    const auto context = verification.context();
+
+    if (table_.empty() || secp256k1_ec_seckey_verify(context,
+        scalar.data()) != 1)
+        return false;
+
+    // Each digit d selects (d + 1) * 16^window * point, reading every entry
+    // of the window so that memory access is independent of the scalar.
+    secp256k1_pubkey selected[windows + 1];
+    const secp256k1_pubkey* points[windows + 1];
+
+    for (size_t window = 0; window < windows; ++window)
+    {
+        auto& point = selected[window];
+        std::fill(std::begin(point.data), std::end(point.data), 0);
+        const auto value = digit(scalar, window);
+        const auto row = table_.begin() + window * digits;
+
+        for (size_t index = 0; index < digits; ++index)
+        {
+            // All ones if index equals value, otherwise zero.
+            const auto mask = static_cast<uint8_t>(
+                (((index ^ value) - 1) >> 8) & 0xff);
+
+            const auto& entry = row[index];
+            for (size_t byte = 0; byte < entry.size(); ++byte)
+                point.data[byte] |= entry[byte] & mask;
+        }
+
+        points[window] = &point;
+    }
+
+    to_pubkey(selected[windows], offset_);
+    points[windows] = &selected[windows];
+
+    secp256k1_pubkey product;
+    auto size = Size;
+    const auto flags = Size == ec_compressed_size ? SECP256K1_EC_COMPRESSED :
+        SECP256K1_EC_UNCOMPRESSED;
+
+    return secp256k1_ec_pubkey_combine(context, &product, points,
+        windows + 1) == 1 && secp256k1_ec_pubkey_serialize(context,
+            out.data(), &size, &product, flags) == 1 && size == Size;
+}
+
+} // namespace libbitcoin
@@ -0,0 +1,237 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/math/ec_workspace.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+#include <secp256k1.h>
+#include <bitcoin/bitcoin/math/elliptic_curve.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include "secp256k1_initializer.hpp"
+
+namespace libbitcoin {
+
+static_assert(sizeof(secp256k1_pubkey) == 64, "parsed point size");
+
+static void to_parsed(byte_array<64>& out,
+    const secp256k1_pubkey& point)
+{
+    std::copy_n(std::begin(point.data), out.size(), out.begin());
+}
+
+static void to_pubkey(secp256k1_pubkey& out,
+    const byte_array<64>& point)
+{
+    std::copy_n(point.begin(), point.size(), std::begin(out.data));
+}
+
+void ec_workspace::reserve(size_t count)
+{
+    points_.reserve(count);
+    valid_.reserve(count);
+}
+
+size_t ec_workspace::size() const
+{
+    return points_.size();
+}
+
+void ec_workspace::clear()
+{
+    points_.clear();
+    valid_.clear();
+}
+
+bool ec_workspace::valid(size_t index) const
+{
+    return index < valid_.size() && valid_[index];
+}
+
+bool ec_workspace::push(const ec_compressed& point)
+{
+    return push<ec_compressed_size>(point);
+}
+
+bool ec_workspace::push(const ec_uncompressed& point)
+{
+    return push<ec_uncompressed_size>(point);
+}
+
+bool ec_workspace::push(const ec_secret& scalar)
+{
+    secp256k1_pubkey pubkey;
+    const auto context = signing.context();
+    const auto valid = secp256k1_ec_pubkey_create(context, &pubkey,
+        scalar.data()) == 1;
+
+    parsed_point parsed{};
+    if (valid)
+        to_parsed(parsed, pubkey);
+
+    return append(parsed, valid);
+}
+
+bool ec_workspace::sum(const indexes& points)
+{
+    parsed_point parsed{};
+    auto valid = !points.empty();
+    std::vector<secp256k1_pubkey> keys(points.size());
+    std::vector<const secp256k1_pubkey*> pointers(points.size());
+
+    for (size_t point = 0; valid && point < points.size(); ++point)
+    {
+        valid = this->valid(points[point]);
+        if (valid)
+        {
+            to_pubkey(keys[point], points_[points[point]]);
+            pointers[point] = &keys[point];
+        }
+    }
+
+    // The combination accumulates in projective coordinates, converting to
+    // affine (a single field inversion) only for the result.
+    secp256k1_pubkey pubkey;
+    if (valid)
+        valid = secp256k1_ec_pubkey_combine(verification.context(), &pubkey,
+            pointers.data(), pointers.size()) == 1;
+
+    if (valid)
+        to_parsed(parsed, pubkey);
+
+    return append(parsed, valid);
+}
+
+bool ec_workspace::add(size_t index, const ec_secret& scalar)
+{
+    if (!valid(index))
+        return false;
+
+    secp256k1_pubkey pubkey;
+    to_pubkey(pubkey, points_[index]);
+    valid_[index] = secp256k1_ec_pubkey_tweak_add(verification.context(),
+        &pubkey, scalar.data()) == 1;
+
+    if (valid_[index])
+        to_parsed(points_[index], pubkey);
+
+    return valid_[index];
+}
+
+bool ec_workspace::multiply(size_t index, const ec_secret& scalar)
+{
+    if (!valid(index))
+        return false;
+
+    secp256k1_pubkey pubkey;
+    to_pubkey(pubkey, points_[index]);
+    valid_[index] = secp256k1_ec_pubkey_tweak_mul(verification.context(),
+        &pubkey, scalar.data()) == 1;
+
+    if (valid_[index])
+        to_parsed(points_[index], pubkey);
+
+    return valid_[index];
+}
+
+bool ec_workspace::negate(size_t index)
+{
+    if (!valid(index))
+        return false;
+
+    secp256k1_pubkey pubkey;
+    to_pubkey(pubkey, points_[index]);
+    valid_[index] = secp256k1_ec_pubkey_negate(verification.context(),
+        &pubkey) == 1;
+
+    if (valid_[index])
+        to_parsed(points_[index], pubkey);
+
+    return valid_[index];
+}
+
+bool ec_workspace::compress(ec_compressed& out, size_t index) const
+{
+    return serialize<ec_compressed_size>(out, index);
+}
+
+bool ec_workspace::decompress(ec_uncompressed& out, size_t index) const
+{
+    return serialize<ec_uncompressed_size>(out, index);
+}
+
+bool ec_workspace::compress(point_list& out) const
+{
+    auto valid = true;
+    out.resize(points_.size());
+
+    for (size_t index = 0; index < points_.size(); ++index)
+    {
+        if (!compress(out[index], index))
+        {
+            out[index] = null_compressed_point;
+            valid = false;
+        }
+    }
+
+    return valid;
+}
+
+// private
+template <size_t Size>
+bool ec_workspace::push(const byte_array<Size>& point)
+{
+    secp256k1_pubkey pubkey;
+    const auto valid = secp256k1_ec_pubkey_parse(verification.context(),
+        &pubkey, point.data(), Size) == 1;
+
+    parsed_point parsed{};
+    if (valid)
+        to_parsed(parsed, pubkey);
+
+    return append(parsed, valid);
+}
+
+// private
+template <size_t Size>
+bool ec_workspace::serialize(byte_array<Size>& out, size_t index) const
+{
+    if (!valid(index))
+        return false;
+
+    secp256k1_pubkey pubkey;
+    to_pubkey(pubkey, points_[index]);
+
+    auto size = Size;
+    const auto flags = Size == ec_compressed_size ? SECP256K1_EC_COMPRESSED :
+        SECP256K1_EC_UNCOMPRESSED;
+
+    return secp256k1_ec_pubkey_serialize(verification.context(), out.data(),
+        &size, &pubkey, flags) == 1 && size == Size;
+}
+
+// private
+bool ec_workspace::append(const parsed_point& point, bool valid)
+{
+    points_.push_back(point);
+    valid_.push_back(valid);
+    return valid;
+}
+
+} // namespace libbitcoin
@@ -19,16 +19,22 @@
 #include <bitcoin/bitcoin/math/elliptic_curve.hpp>
 
 #include <algorithm>
+#include <cstdint>
+#include <string>
 #include <utility>
+#include <vector>
 #include <secp256k1.h>
 #include <secp256k1_recovery.h>
 #include <boost/ptr_container/ptr_vector.hpp>
 #include <bitcoin/bitcoin/math/hash.hpp>
 #include <bitcoin/bitcoin/math/limits.hpp>
+#include <bitcoin/bitcoin/math/public_key_cache.hpp>
 #include <bitcoin/bitcoin/utility/assert.hpp>
 #include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/endian.hpp>
 #include <bitcoin/bitcoin/wallet/hd_private.hpp>
 #include "../math/external/lax_der_parsing.h"
+#include "../math/external/sha256.h"
 #include "secp256k1_initializer.hpp"
 
 namespace libbitcoin {
@@ -132,6 +138,315 @@ bool verify_signature(const secp256k1_context* context,
     return secp256k1_ecdsa_verify(context, &normal, hash.data(), &point) == 1;
 }
 
+// Schnorr helpers
+// ----------------------------------------------------------------------------
+
+typedef std::vector<const secp256k1_pubkey*> pointers;
+
+// A point and its scalar, a term of a multi-scalar multiplication.
+struct multiple
+{
+    secp256k1_pubkey point;
+    ec_secret scalar;
+};
+
+typedef std::vector<multiple> multiples;
+
+// The secp256k1 group order (big endian).
+static BC_CONSTEXPR ec_secret curve_order =
+{
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0xba, 0xae, 0xdc, 0xe6, 0xaf, 0x48, 0xa0, 0x3b,
+    0xbf, 0xd2, 0x5e, 0x8c, 0xd0, 0x36, 0x41, 0x41
+};
+
+// The secp256k1 field prime (big endian).
+static BC_CONSTEXPR ec_secret field_prime =
+{
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0x2f
+};
+
+static BC_CONSTEXPR ec_compressed generator_point =
+{
+    0x02,
+    0x79, 0xbe, 0x66, 0x7e, 0xf9, 0xdc, 0xbb, 0xac,
+    0x55, 0xa0, 0x62, 0x95, 0xce, 0x87, 0x0b, 0x07,
+    0x02, 0x9b, 0xfc, 0xdb, 0x2d, 0xce, 0x28, 0xd9,
+    0x59, 0xf2, 0x81, 0x5b, 0x16, 0xf8, 0x17, 0x98
+};
+
+// Estimated costs, in point additions, of a field inversion (each point sum
+// is normalized by one) and of the verification of a single signature.
+static constexpr size_t inversion_cost = 25;
+static constexpr size_t verification_cost = 450;
+
+// Windows wider than this have too many buckets to be of benefit.
+static constexpr size_t maximum_window_bits = 8;
+static constexpr size_t scalar_bits = 8 * ec_secret_size;
+
+// The width of the batch weights, which halves the work for nonce points.
+static constexpr size_t weight_size = ec_secret_size / 2;
+
+static bool is_zero(const ec_secret& value)
+{
+    return std::all_of(value.begin(), value.end(), [](uint8_t byte)
+    {
+        return byte == 0;
+    });
+}
+
+// True if the big endian value is below the big endian maximum.
+static bool is_below(const uint8_t* value, const ec_secret& maximum)
+{
+    return std::lexicographical_compare(value, value + ec_secret_size,
+        maximum.begin(), maximum.end());
+}
+
+// Reduce the hash modulo the curve order, which is subtracted at most once.
+static ec_secret to_scalar(const hash_digest& hash)
+{
+    if (is_below(hash.data(), curve_order))
+        return hash;
+
+    auto borrow = 0;
+    ec_secret out;
+
+    for (auto index = ec_secret_size; index-- > 0;)
+    {
+        const auto difference = hash[index] - curve_order[index] - borrow;
+        out[index] = static_cast<uint8_t>(difference);
+        borrow = difference < 0 ? 1 : 0;
+    }
+
+    return out;
+}
+
+// Modular scalar arithmetic, with zero (which is not a valid secret) allowed.
+static void scalar_negate(const secp256k1_context* context, ec_secret& value)
+{
+    if (!is_zero(value))
+        secp256k1_ec_privkey_negate(context, value.data());
+}
+
+static void scalar_add(const secp256k1_context* context, ec_secret& left,
+    const ec_secret& right)
+{
+    if (is_zero(right))
+        return;
+
+    if (is_zero(left))
+        left = right;
+
+    // This fails only if the sum is zero, the scalars are below the order.
+    else if (secp256k1_ec_privkey_tweak_add(context, left.data(),
+        right.data()) != 1)
+        left.fill(0);
+}
+
+static void scalar_multiply(const secp256k1_context* context,
+    ec_secret& left, const ec_secret& right)
+{
+    // The product of nonzero scalars is nonzero, as the order is prime.
+    if (is_zero(left) || is_zero(right))
+        left.fill(0);
+    else
+        secp256k1_ec_privkey_tweak_mul(context, left.data(), right.data());
+}
+
+// The tag prefix of a tagged hash is one block, so its midstate is reused.
+static SHA256CTX tag_midstate(const std::string& tag)
+{
+    SHA256CTX context;
+    const auto tag_hash = sha256_hash(to_chunk(tag));
+    SHA256Init(&context);
+    SHA256Update(&context, tag_hash.data(), tag_hash.size());
+    SHA256Update(&context, tag_hash.data(), tag_hash.size());
+    return context;
+}
+
+static hash_digest tagged_hash(const SHA256CTX& midstate, loaf slices)
+{
+    hash_digest out;
+    auto context = midstate;
+
+    for (const auto& slice: slices)
+        SHA256Update(&context, slice.data(), slice.size());
+
+    SHA256Final(&context, out.data());
+    return out;
+}
+
+static const SHA256CTX& auxiliary_tag()
+{
+    static const auto midstate = tag_midstate("BIP0340/aux");
+    return midstate;
+}
+
+static const SHA256CTX& nonce_tag()
+{
+    static const auto midstate = tag_midstate("BIP0340/nonce");
+    return midstate;
+}
+
+static const SHA256CTX& challenge_tag()
+{
+    static const auto midstate = tag_midstate("BIP0340/challenge");
+    return midstate;
+}
+
+// The challenge e = hash(R.x || P.x || m) modulo the curve order.
+static ec_secret challenge(const uint8_t* nonce, const ec_xonly& point,
+    const hash_digest& message)
+{
+    const data_slice nonce_x(nonce, nonce + ec_xonly_size);
+    return to_scalar(tagged_hash(challenge_tag(),
+        { nonce_x, point, message }));
+}
+
+// Parse the point with the x coordinate and even y, false if there is none.
+static bool lift_x(const secp256k1_context* context, secp256k1_pubkey& out,
+    const uint8_t* x)
+{
+    ec_compressed point;
+    point.front() = compressed_even;
+    std::copy_n(x, ec_xonly_size, point.begin() + 1);
+    return is_below(x, field_prime) && parse(context, out, point);
+}
+
+// The sum of the points, or nullptr if the sum is infinity (or empty). A
+// single point is returned as is, avoiding its normalization.
+static const secp256k1_pubkey* sum(const secp256k1_context* context,
+    secp256k1_pubkey& out, const pointers& points)
+{
+    if (points.empty())
+        return nullptr;
+
+    if (points.size() == 1)
+        return points.front();
+
+    return secp256k1_ec_pubkey_combine(context, &out, points.data(),
+        points.size()) == 1 ? &out : nullptr;
+}
+
+// The window digit of the scalar, from the least significant bit.
+static size_t digit(const ec_secret& scalar, size_t window, size_t bits)
+{
+    size_t value = 0;
+    const auto first = window * bits;
+
+    for (size_t bit = 0; bit < bits && first + bit < scalar_bits; ++bit)
+    {
+        const auto position = first + bit;
+        const auto byte = scalar[ec_secret_size - 1 - position / 8];
+        value |= static_cast<size_t>((byte >> (position % 8)) & 1) << bit;
+    }
+
+    return value;
+}
+
+// The estimated cost of a multiplication of count terms with the window.
+static size_t multiply_cost(size_t count, size_t bits)
+{
+    const auto windows = (scalar_bits + bits - 1) / bits;
+    const auto buckets = (size_t{ 1 } << bits) - 1;
+    const auto additions = count + (bits / 2 + 2) * buckets;
+    const auto inversions = buckets + bits + 1;
+    return windows * (additions + inversions * inversion_cost);
+}
+
+static size_t window_bits(size_t count)
+{
+    size_t best = 1;
+
+    for (auto bits = best + 1; bits <= maximum_window_bits; ++bits)
+        if (multiply_cost(count, bits) < multiply_cost(count, best))
+            best = bits;
+
+    return best;
+}
+
+// The sum of the multiples by the bucket (Pippenger) method, false if the sum
+// is infinity. Each window sorts the points into buckets by digit, so that
+// each point is added once per window rather than once per set bit. The
+// buckets are then summed by each bit of their digit and these are added to
+// the shifted total in one sum. Sums at infinity are represented by omission.
+static bool multiply_sum(const secp256k1_context* context,
+    secp256k1_pubkey& out, const multiples& terms)
+{
+    const auto bits = window_bits(terms.size());
+    const auto buckets = (size_t{ 1 } << bits) - 1;
+    const auto windows = (scalar_bits + bits - 1) / bits;
+
+    auto has_total = false;
+    std::vector<pointers> digits(buckets);
+    std::vector<secp256k1_pubkey> bucket_sums(buckets);
+    std::vector<secp256k1_pubkey> bit_sums(bits);
+    pointers summed(buckets);
+    pointers selected;
+    pointers addends;
+
+    for (auto window = windows; window-- > 0;)
+    {
+        for (auto& bucket: digits)
+            bucket.clear();
+
+        for (const auto& term: terms)
+        {
+            const auto value = digit(term.scalar, window, bits);
+            if (value != 0)
+                digits[value - 1].push_back(&term.point);
+        }
+
+        for (size_t bucket = 0; bucket < buckets; ++bucket)
+            summed[bucket] = sum(context, bucket_sums[bucket], digits[bucket]);
+
+        // The shift of the total by the window, 2^bits * total.
+        addends.clear();
+        if (has_total)
+            addends.assign(size_t{ 1 } << bits, &out);
+
+        // Each bucket sum is weighted by its digit, 2^bit for each set bit.
+        for (size_t bit = 0; bit < bits; ++bit)
+        {
+            selected.clear();
+            for (size_t bucket = 0; bucket < buckets; ++bucket)
+                if (summed[bucket] != nullptr && (((bucket + 1) >> bit) & 1))
+                    selected.push_back(summed[bucket]);
+
+            const auto bit_sum = sum(context, bit_sums[bit], selected);
+            if (bit_sum != nullptr)
+                addends.insert(addends.end(), size_t{ 1 } << bit, bit_sum);
+        }
+
+        // The combined sum is written after its addends are read, but out is
+        // cleared first, so the total is summed to a separate point.
+        secp256k1_pubkey next;
+        const auto total = sum(context, next, addends);
+        has_total = (total != nullptr);
+
+        if (has_total)
+            out = *total;
+    }
+
+    return has_total;
+}
+
+// Initialize EC contexts
+// ----------------------------------------------------------------------------
+
+void ec_initialize(bool for_signing, bool for_verification)
+{
+    if (for_signing)
+        signing.shared_context();
+
+    if (for_verification)
+        verification.context();
+}
+
 // Add and multiply EC values
 // ----------------------------------------------------------------------------
 
@@ -154,6 +469,29 @@ bool ec_add(ec_secret& left, const ec_secret& right)
         right.data()) == 1;
 }
 
+bool ec_add(ec_compressed* out, const ec_compressed& point,
+    const ec_secret* scalars, size_t count)
+{
+    secp256k1_pubkey parent;
+    const auto context = verification.context();
+
+    if (!parse(context, parent, point))
+        return false;
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        // The parsed point is already decompressed, so copying it avoids
+        // recovering its y coordinate for each sum.
+        auto pubkey = parent;
+        if (secp256k1_ec_pubkey_tweak_add(context, &pubkey,
+            scalars[index].data()) != 1 ||
+            !serialize(context, out[index], pubkey))
+            out[index] = null_compressed_point;
+    }
+
+    return true;
+}
+
 bool ec_multiply(ec_compressed& point, const ec_secret& scalar)
 {
     const auto context = verification.context();
@@ -308,7 +646,77 @@ bool parse_endorsement(uint8_t& sighash_type, der_signature& der_signature,
     return true;
 }
 
-bool parse_signature(ec_signature& out, const der_signature& der_signature,
+bool parse_endorsement(uint8_t& sighash_type, data_slice& der_signature,
+    data_slice endorsement)
+{
+    if (endorsement.empty())
+        return false;
+
+    const auto last = endorsement.end() - 1;
+    sighash_type = *last;
+    der_signature = { endorsement.begin(), last };
+    return true;
+}
+
+// Read a DER integer of a strict signature into its 32 byte compact form.
+// Only positive values minimally encoded in 32 bytes (and a sign byte) are
+// read, as the parsers produce a zero value for others (or are lax).
+static bool read_integer(uint8_t* out, const uint8_t*& it,
+    const uint8_t* end)
+{
+    if (end - it < 2 || it[0] != 0x02)
+        return false;
+
+    size_t size = it[1];
+    it += 2;
+
+    if (size == 0 || size > static_cast<size_t>(end - it) ||
+        (it[0] & 0x80) != 0)
+        return false;
+
+    // A zero byte is allowed (required) only where the next high bit is set.
+    if (it[0] == 0x00)
+    {
+        if (size == 1 || (it[1] & 0x80) == 0)
+            return false;
+
+        ++it;
+        --size;
+    }
+
+    if (size > ec_secret_size)
+        return false;
+
+    std::fill_n(out, ec_secret_size - size, 0x00);
+    std::copy_n(it, size, out + ec_secret_size - size);
+    it += size;
+    return true;
+}
+
+// This reads the common encoding, with short form lengths, without copying
+// the DER signature, false if the signature requires the full DER parser.
+static bool parse_compact_der(const secp256k1_context* context,
+    secp256k1_ecdsa_signature& out, data_slice der_signature)
+{
+    const auto size = der_signature.size();
+    auto it = der_signature.data();
+    const auto end = it + size;
+
+    if (size < 8 || size > max_der_signature_size || it[0] != 0x30 ||
+        it[1] != size - 2)
+        return false;
+
+    it += 2;
+    byte_array<ec_signature_size> compact;
+
+    // An overflowed value is not parsed here (the parsers produce zero).
+    return read_integer(compact.data(), it, end) &&
+        read_integer(compact.data() + ec_secret_size, it, end) &&
+        it == end && secp256k1_ecdsa_signature_parse_compact(context, &out,
+            compact.data()) == 1;
+}
+
+bool parse_signature(ec_signature& out, data_slice der_signature,
     bool strict)
 {
     if (der_signature.empty())
@@ -318,7 +726,9 @@ bool parse_signature(ec_signature& out, const der_signature& der_signature,
     secp256k1_ecdsa_signature parsed;
     const auto context = verification.context();
 
-    if (strict)
+    if (parse_compact_der(context, parsed, der_signature))
+        valid = true;
+    else if (strict)
         valid = secp256k1_ecdsa_signature_parse_der(context, &parsed,
             der_signature.data(), der_signature.size()) == 1;
     else
@@ -398,11 +808,216 @@ bool verify_signature(data_slice point, const hash_digest& hash,
 
     // This uses a data slice and calls secp256k1_ec_pubkey_parse() in place of
     // parse() so that we can support the der_verify data_chunk optimization.
+    // Parsed keys are cached (if enabled), as the parse of a compressed key
+    // includes its decompression. Only valid keys are cached.
     secp256k1_pubkey pubkey;
-    const auto size = point.size();
-    return
-        secp256k1_ec_pubkey_parse(context, &pubkey, point.data(), size) == 1 &&
-        secp256k1_ecdsa_verify(context, &normal, hash.data(), &pubkey) == 1;
+    public_key_cache::parsed_key parsed_key;
+    auto& cache = public_key_cache::parsed_keys();
+    static_assert(sizeof(parsed_key) == sizeof(pubkey.data), "unexpected");
+
+    if (cache.find(parsed_key, point))
+    {
+        std::copy(parsed_key.begin(), parsed_key.end(),
+            std::begin(pubkey.data));
+    }
+    else
+    {
+        if (secp256k1_ec_pubkey_parse(context, &pubkey, point.data(),
+            point.size()) != 1)
+            return false;
+
+        std::copy_n(std::begin(pubkey.data), parsed_key.size(),
+            parsed_key.begin());
+        cache.insert(point, parsed_key);
+    }
+
+    return secp256k1_ecdsa_verify(context, &normal, hash.data(), &pubkey) == 1;
+}
+
+// Schnorr sign/verify (BIP340)
+// ----------------------------------------------------------------------------
+
+bool sign_schnorr(schnorr_signature& out, const ec_secret& secret,
+    const hash_digest& message, const hash_digest& auxiliary)
+{
+    ec_xonly xonly;
+    ec_compressed point;
+    ec_compressed nonce_point;
+    secp256k1_pubkey pubkey;
+    const auto context = signing.context();
+
+    if (secp256k1_ec_pubkey_create(context, &pubkey, secret.data()) != 1 ||
+        !serialize(context, point, pubkey))
+        return false;
+
+    // The point is x-only, so the secret of a point with odd y is negated.
+    auto key = secret;
+    if (point.front() == compressed_odd)
+        scalar_negate(context, key);
+
+    std::copy_n(point.begin() + 1, ec_xonly_size, xonly.begin());
+    const auto masked = xor_data<ec_secret_size>(key,
+        tagged_hash(auxiliary_tag(), { auxiliary }));
+    auto nonce = to_scalar(tagged_hash(nonce_tag(),
+        { masked, xonly, message }));
+
+    if (is_zero(nonce) ||
+        secp256k1_ec_pubkey_create(context, &pubkey, nonce.data()) != 1 ||
+        !serialize(context, nonce_point, pubkey))
+        return false;
+
+    if (nonce_point.front() == compressed_odd)
+        scalar_negate(context, nonce);
+
+    // s = k + e.d
+    auto scalar = challenge(nonce_point.data() + 1, xonly, message);
+    scalar_multiply(context, scalar, key);
+    scalar_add(context, scalar, nonce);
+
+    std::copy_n(nonce_point.begin() + 1, ec_xonly_size, out.begin());
+    std::copy_n(scalar.begin(), ec_secret_size, out.begin() + ec_xonly_size);
+    return true;
+}
+
+bool verify_schnorr(const ec_xonly& point, const hash_digest& message,
+    const schnorr_signature& signature)
+{
+    ec_secret scalar;
+    secp256k1_pubkey pubkey;
+    const auto nonce = signature.data();
+    const auto context = verification.context();
+    std::copy_n(signature.begin() + ec_xonly_size, ec_secret_size,
+        scalar.begin());
+
+    if (!is_below(nonce, field_prime) ||
+        !is_below(scalar.data(), curve_order) ||
+        !lift_x(context, pubkey, point.data()))
+        return false;
+
+    // R = s.G - e.P, as s.G + (n - e).P, omitting a term with zero scalar.
+    auto negated = challenge(nonce, point, message);
+    scalar_negate(context, negated);
+
+    pointers terms;
+    secp256k1_pubkey products[2];
+
+    if (!is_zero(scalar))
+    {
+        if (secp256k1_ec_pubkey_create(signing.context(), &products[0],
+            scalar.data()) != 1)
+            return false;
+
+        terms.push_back(&products[0]);
+    }
+
+    if (!is_zero(negated))
+    {
+        products[1] = pubkey;
+        if (secp256k1_ec_pubkey_tweak_mul(context, &products[1],
+            negated.data()) != 1)
+            return false;
+
+        terms.push_back(&products[1]);
+    }
+
+    // R must not be infinity, must have even y and its x must be the nonce.
+    secp256k1_pubkey combined;
+    ec_compressed nonce_point;
+    const auto result = sum(context, combined, terms);
+    return result != nullptr && serialize(context, nonce_point, *result) &&
+        nonce_point.front() == compressed_even &&
+        std::equal(nonce, nonce + ec_xonly_size, nonce_point.begin() + 1);
+}
+
+// The batch is valid if sum(a.R) + sum(a.e.P) - sum(a.s).G is infinity, with
+// random weights a. Weights are derived from all of the checks, so a forger
+// cannot choose signatures for which the invalid terms cancel (BIP340).
+bool verify_schnorr(const schnorr_check* checks, size_t count)
+{
+    // Each check contributes a nonce point and a public point.
+    const auto points = 2 * count + 1;
+
+    if (multiply_cost(points, window_bits(points)) >=
+        count * verification_cost)
+    {
+        for (size_t index = 0; index < count; ++index)
+            if (!verify_schnorr(checks[index].point, checks[index].message,
+                checks[index].signature))
+                return false;
+
+        return true;
+    }
+
+    hash_digest seed;
+    SHA256CTX seeder;
+    SHA256Init(&seeder);
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        const auto& check = checks[index];
+        SHA256Update(&seeder, check.point.data(), check.point.size());
+        SHA256Update(&seeder, check.message.data(), check.message.size());
+        SHA256Update(&seeder, check.signature.data(), check.signature.size());
+    }
+
+    SHA256Final(&seeder, seed.data());
+
+    multiples terms;
+    terms.reserve(points);
+    ec_secret generator_scalar{};
+    const auto context = verification.context();
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        ec_secret scalar;
+        multiple nonce_term;
+        multiple point_term;
+        const auto& check = checks[index];
+        const auto nonce = check.signature.data();
+        std::copy_n(check.signature.begin() + ec_xonly_size, ec_secret_size,
+            scalar.begin());
+
+        if (!is_below(nonce, field_prime) ||
+            !is_below(scalar.data(), curve_order) ||
+            !lift_x(context, nonce_term.point, nonce) ||
+            !lift_x(context, point_term.point, check.point.data()))
+            return false;
+
+        // The first weight is one, the others are 128 bit random values.
+        ec_secret weight{};
+        if (index == 0)
+        {
+            weight.back() = 1;
+        }
+        else
+        {
+            const auto random = sha256_hash(build_chunk(
+                { seed, to_little_endian<uint64_t>(index) }));
+            std::copy_n(random.begin(), weight_size,
+                weight.begin() + ec_secret_size - weight_size);
+        }
+
+        nonce_term.scalar = weight;
+        point_term.scalar = challenge(nonce, check.point, check.message);
+        scalar_multiply(context, point_term.scalar, weight);
+        scalar_multiply(context, scalar, weight);
+        scalar_add(context, generator_scalar, scalar);
+
+        terms.push_back(nonce_term);
+        terms.push_back(point_term);
+    }
+
+    scalar_negate(context, generator_scalar);
+    multiple generator_term;
+    generator_term.scalar = generator_scalar;
+
+    if (!parse(context, generator_term.point, generator_point))
+        return false;
+
+    terms.push_back(generator_term);
+
+    secp256k1_pubkey total;
+    return !multiply_sum(context, total, terms);
 }
 
 // Recoverable sign/recover
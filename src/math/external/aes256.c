@@ -23,6 +23,21 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
+#include "aes256_arm.h"
+#include "aes256_ni.h"
+#include "cpu_features.h"
+#include "zeroize.h"
+
+typedef void(*aes256_blocks_function)(
+    const uint8_t schedule[AES256_SCHEDULE_LENGTH], uint8_t* blocks,
+    size_t count);
+
+/* The selection is idempotent, so a race between initializing threads is
+ * benign. The software cypher is used if no backend is selected. It is
+ * repeated if the enabled processor features change. */
+static volatile int initialized = 0;
+static volatile aes256_blocks_function encrypt_blocks = NULL;
+static volatile aes256_blocks_function decrypt_blocks = NULL;
 
 #define F(x)   (((x)<<1) ^ ((((x)>>7) & 1) * 0x1b))
 #define FD(x)  (((x) >> 1) ^ (((x) & 1) ? 0x8d : 0))
@@ -299,14 +314,102 @@ void aes_expandDecKey(uint8_t* k, uint8_t* rc)
 } /* aes_expandDecKey */
 
 
+/* -------------------------------------------------------------------------- */
+/* Select a hardware backend supported by the executing processor. */
+static void aes256_initialize(void)
+{
+    uint32_t features;
+
+    if (initialized == CPUFeaturesGeneration())
+        return;
+
+    features = CPUFeatures();
+    encrypt_blocks = NULL;
+    decrypt_blocks = NULL;
+
+#if defined(AES256_X86)
+    if ((features & CPU_FEATURE_AES_NI) && (features & CPU_FEATURE_SSE2))
+    {
+        encrypt_blocks = aes256_encrypt_blocks_ni;
+        decrypt_blocks = aes256_decrypt_blocks_ni;
+    }
+#elif defined(AES256_ARM)
+    if (features & CPU_FEATURE_ARM_AES)
+    {
+        encrypt_blocks = aes256_encrypt_blocks_arm;
+        decrypt_blocks = aes256_decrypt_blocks_arm;
+    }
+#else
+    (void)features;
+#endif
+
+    initialized = CPUFeaturesGeneration();
+} /* aes256_initialize */
+
+/* -------------------------------------------------------------------------- */
+const char* aes256_kernel(void)
+{
+    aes256_initialize();
+
+#if defined(AES256_X86)
+    return encrypt_blocks != NULL ? "aes-ni" : "portable";
+#elif defined(AES256_ARM)
+    return encrypt_blocks != NULL ? "arm" : "portable";
+#else
+    return "portable";
+#endif
+} /* aes256_kernel */
+
+/* -------------------------------------------------------------------------- */
+/* Expand the round keys, and their inverse for the equivalent inverse cypher,
+ * in which the inverse mix columns is applied to all but the outer keys. */
+static void aes_expandSchedule(aes256_context* context, const uint8_t* key)
+{
+    uint8_t k[AES256_KEY_LENGTH];
+    uint8_t rcon = 1;
+    uint8_t* schedule = context->schedule;
+    uint8_t* inverse = context->inverse;
+    size_t round;
+
+    memcpy(k, key, sizeof k);
+    memcpy(schedule, k, sizeof k);
+
+    for (round = 2; round <= AES256_ROUNDS; round += 2)
+    {
+        aes_expandEncKey(k, &rcon);
+        memcpy(schedule + round * AES256_BLOCK_LENGTH, k,
+            round < AES256_ROUNDS ? sizeof k : AES256_BLOCK_LENGTH);
+    }
+
+    memcpy(inverse, schedule + AES256_ROUNDS * AES256_BLOCK_LENGTH,
+        AES256_BLOCK_LENGTH);
+    memcpy(inverse + AES256_ROUNDS * AES256_BLOCK_LENGTH, schedule,
+        AES256_BLOCK_LENGTH);
+
+    for (round = 1; round < AES256_ROUNDS; ++round)
+    {
+        uint8_t* target = inverse + round * AES256_BLOCK_LENGTH;
+        memcpy(target, schedule + (AES256_ROUNDS - round) *
+            AES256_BLOCK_LENGTH, AES256_BLOCK_LENGTH);
+        aes_mixColumns_inv(target);
+    }
+
+    zeroize(k, sizeof k);
+} /* aes_expandSchedule */
+
 /* -------------------------------------------------------------------------- */
 void aes256_init(aes256_context* context, const uint8_t* key)
 {
     uint8_t rcon = 1;
     register uint8_t i;
 
+    aes256_initialize();
+
     for (i = 0; i < sizeof(context->key); i++) context->enckey[i] = context->deckey[i] = key[i];
     for (i = 8;--i;) aes_expandEncKey(context->deckey, &rcon);
+
+    /* Always expanded, since the backend may be reselected. */
+    aes_expandSchedule(context, key);
 } /* aes256_init */
 
 /* -------------------------------------------------------------------------- */
@@ -316,13 +419,50 @@ void aes256_done(aes256_context* context)
 
     for (i = 0; i < sizeof(context->key); i++) 
         context->key[i] = context->enckey[i] = context->deckey[i] = 0;
+
+    zeroize(context->schedule, sizeof(context->schedule));
+    zeroize(context->inverse, sizeof(context->inverse));
 } /* aes256_done */
 
+/* -------------------------------------------------------------------------- */
+void aes256_encrypt_ecb_blocks(aes256_context* context, uint8_t* buf,
+    size_t count)
+{
+    if (encrypt_blocks != NULL)
+    {
+        encrypt_blocks(context->schedule, buf, count);
+        return;
+    }
+
+    for (; count > 0; --count, buf += AES256_BLOCK_LENGTH)
+        aes256_encrypt_ecb(context, buf);
+} /* aes256_encrypt_ecb_blocks */
+
+/* -------------------------------------------------------------------------- */
+void aes256_decrypt_ecb_blocks(aes256_context* context, uint8_t* buf,
+    size_t count)
+{
+    if (decrypt_blocks != NULL)
+    {
+        decrypt_blocks(context->inverse, buf, count);
+        return;
+    }
+
+    for (; count > 0; --count, buf += AES256_BLOCK_LENGTH)
+        aes256_decrypt_ecb(context, buf);
+} /* aes256_decrypt_ecb_blocks */
+
 /* -------------------------------------------------------------------------- */
 void aes256_encrypt_ecb(aes256_context* context, uint8_t* buf)
 {
     uint8_t i, rcon;
 
+    if (encrypt_blocks != NULL)
+    {
+        encrypt_blocks(context->schedule, buf, 1);
+        return;
+    }
+
     aes_addRoundKey_cpy(buf, context->enckey, context->key);
     for(i = 1, rcon = 1; i < 14; ++i)
     {
@@ -343,6 +483,12 @@ void aes256_decrypt_ecb(aes256_context* context, uint8_t* buf)
 {
     uint8_t i, rcon;
 
+    if (decrypt_blocks != NULL)
+    {
+        decrypt_blocks(context->inverse, buf, 1);
+        return;
+    }
+
     aes_addRoundKey_cpy(buf, context->deckey, context->key);
     aes_shiftRows_inv(buf);
     aes_subBytes_inv(buf);
@@ -25,6 +25,15 @@
 
 #define AES256_KEY_LENGTH 32U
 #define AES256_BLOCK_LENGTH 16U
+#define AES256_ROUNDS 14U
+#define AES256_SCHEDULE_LENGTH ((AES256_ROUNDS + 1U) * AES256_BLOCK_LENGTH)
+
+#if defined(__x86_64__) || defined(__i386__) || \
+    defined(_M_X64) || defined(_M_IX86)
+    #define AES256_X86
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+    #define AES256_ARM
+#endif
 
 #ifdef __cplusplus
 extern "C" { 
@@ -35,6 +44,10 @@ typedef struct
     uint8_t key[AES256_KEY_LENGTH];
     uint8_t enckey[AES256_KEY_LENGTH];
     uint8_t deckey[AES256_KEY_LENGTH];
+
+    /* Expanded round keys, used by a hardware backend. */
+    uint8_t schedule[AES256_SCHEDULE_LENGTH];
+    uint8_t inverse[AES256_SCHEDULE_LENGTH];
 } aes256_context; 
 
 void aes256_init(aes256_context* context, 
@@ -48,6 +61,17 @@ void aes256_encrypt_ecb(aes256_context* context,
 void aes256_decrypt_ecb(aes256_context* context,
     uint8_t cypher_text[AES256_BLOCK_LENGTH]);
 
+/* Encrypt count contiguous blocks in place, pipelined if available. */
+void aes256_encrypt_ecb_blocks(aes256_context* context, uint8_t* plain_text,
+    size_t count);
+
+/* Decrypt count contiguous blocks in place, pipelined if available. */
+void aes256_decrypt_ecb_blocks(aes256_context* context, uint8_t* cypher_text,
+    size_t count);
+
+/* The name of the selected backend, for diagnostics. */
+const char* aes256_kernel(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,132 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "aes256_arm.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include "aes256.h"
+
+#ifdef AES256_ARM
+
+#include <arm_neon.h>
+
+#if defined(__clang__)
+    #define AES256_TARGET_ARM __attribute__((target("crypto")))
+#elif defined(__GNUC__)
+    #define AES256_TARGET_ARM __attribute__((target("+crypto")))
+#else
+    #define AES256_TARGET_ARM
+#endif
+
+/* Independent blocks are interleaved to hide the latency of each round. */
+#define AES256_ARM_INTERLEAVE 4U
+
+AES256_TARGET_ARM
+static void load_schedule(uint8x16_t keys[AES256_ROUNDS + 1],
+    const uint8_t schedule[AES256_SCHEDULE_LENGTH])
+{
+    size_t round;
+
+    for (round = 0; round <= AES256_ROUNDS; ++round)
+        keys[round] = vld1q_u8(schedule + round * AES256_BLOCK_LENGTH);
+}
+
+/* The ARMv8 round adds the key first, so the last key is added after. */
+AES256_TARGET_ARM
+void aes256_encrypt_blocks_arm(
+    const uint8_t schedule[AES256_SCHEDULE_LENGTH], uint8_t* blocks,
+    size_t count)
+{
+    size_t round, lane;
+    uint8x16_t keys[AES256_ROUNDS + 1];
+    uint8x16_t state[AES256_ARM_INTERLEAVE];
+
+    load_schedule(keys, schedule);
+
+    for (; count >= AES256_ARM_INTERLEAVE; count -= AES256_ARM_INTERLEAVE)
+    {
+        for (lane = 0; lane < AES256_ARM_INTERLEAVE; ++lane)
+            state[lane] = vld1q_u8(blocks + lane * AES256_BLOCK_LENGTH);
+
+        for (round = 0; round < AES256_ROUNDS - 1; ++round)
+            for (lane = 0; lane < AES256_ARM_INTERLEAVE; ++lane)
+                state[lane] = vaesmcq_u8(vaeseq_u8(state[lane], keys[round]));
+
+        for (lane = 0; lane < AES256_ARM_INTERLEAVE; ++lane)
+            vst1q_u8(blocks + lane * AES256_BLOCK_LENGTH, veorq_u8(
+                vaeseq_u8(state[lane], keys[AES256_ROUNDS - 1]),
+                keys[AES256_ROUNDS]));
+
+        blocks += AES256_ARM_INTERLEAVE * AES256_BLOCK_LENGTH;
+    }
+
+    for (; count > 0; --count, blocks += AES256_BLOCK_LENGTH)
+    {
+        state[0] = vld1q_u8(blocks);
+
+        for (round = 0; round < AES256_ROUNDS - 1; ++round)
+            state[0] = vaesmcq_u8(vaeseq_u8(state[0], keys[round]));
+
+        vst1q_u8(blocks, veorq_u8(vaeseq_u8(state[0],
+            keys[AES256_ROUNDS - 1]), keys[AES256_ROUNDS]));
+    }
+}
+
+AES256_TARGET_ARM
+void aes256_decrypt_blocks_arm(
+    const uint8_t inverse[AES256_SCHEDULE_LENGTH], uint8_t* blocks,
+    size_t count)
+{
+    size_t round, lane;
+    uint8x16_t keys[AES256_ROUNDS + 1];
+    uint8x16_t state[AES256_ARM_INTERLEAVE];
+
+    load_schedule(keys, inverse);
+
+    for (; count >= AES256_ARM_INTERLEAVE; count -= AES256_ARM_INTERLEAVE)
+    {
+        for (lane = 0; lane < AES256_ARM_INTERLEAVE; ++lane)
+            state[lane] = vld1q_u8(blocks + lane * AES256_BLOCK_LENGTH);
+
+        for (round = 0; round < AES256_ROUNDS - 1; ++round)
+            for (lane = 0; lane < AES256_ARM_INTERLEAVE; ++lane)
+                state[lane] = vaesimcq_u8(vaesdq_u8(state[lane],
+                    keys[round]));
+
+        for (lane = 0; lane < AES256_ARM_INTERLEAVE; ++lane)
+            vst1q_u8(blocks + lane * AES256_BLOCK_LENGTH, veorq_u8(
+                vaesdq_u8(state[lane], keys[AES256_ROUNDS - 1]),
+                keys[AES256_ROUNDS]));
+
+        blocks += AES256_ARM_INTERLEAVE * AES256_BLOCK_LENGTH;
+    }
+
+    for (; count > 0; --count, blocks += AES256_BLOCK_LENGTH)
+    {
+        state[0] = vld1q_u8(blocks);
+
+        for (round = 0; round < AES256_ROUNDS - 1; ++round)
+            state[0] = vaesimcq_u8(vaesdq_u8(state[0], keys[round]));
+
+        vst1q_u8(blocks, veorq_u8(vaesdq_u8(state[0],
+            keys[AES256_ROUNDS - 1]), keys[AES256_ROUNDS]));
+    }
+}
+
+#endif
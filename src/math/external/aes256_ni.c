@@ -0,0 +1,135 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "aes256_ni.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include "aes256.h"
+
+#ifdef AES256_X86
+
+#include <wmmintrin.h>
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define AES256_TARGET_NI __attribute__((target("sse2,aes")))
+#else
+    #define AES256_TARGET_NI
+#endif
+
+/* Independent blocks are interleaved to hide the latency of each round. */
+#define AES256_NI_INTERLEAVE 4U
+
+AES256_TARGET_NI
+static void load_schedule(__m128i keys[AES256_ROUNDS + 1],
+    const uint8_t schedule[AES256_SCHEDULE_LENGTH])
+{
+    size_t round;
+
+    for (round = 0; round <= AES256_ROUNDS; ++round)
+        keys[round] = _mm_loadu_si128((const __m128i*)(schedule +
+            round * AES256_BLOCK_LENGTH));
+}
+
+AES256_TARGET_NI
+void aes256_encrypt_blocks_ni(
+    const uint8_t schedule[AES256_SCHEDULE_LENGTH], uint8_t* blocks,
+    size_t count)
+{
+    size_t round, lane;
+    __m128i keys[AES256_ROUNDS + 1];
+    __m128i state[AES256_NI_INTERLEAVE];
+
+    load_schedule(keys, schedule);
+
+    for (; count >= AES256_NI_INTERLEAVE; count -= AES256_NI_INTERLEAVE)
+    {
+        __m128i* const data = (__m128i*)blocks;
+
+        for (lane = 0; lane < AES256_NI_INTERLEAVE; ++lane)
+            state[lane] = _mm_xor_si128(_mm_loadu_si128(data + lane),
+                keys[0]);
+
+        for (round = 1; round < AES256_ROUNDS; ++round)
+            for (lane = 0; lane < AES256_NI_INTERLEAVE; ++lane)
+                state[lane] = _mm_aesenc_si128(state[lane], keys[round]);
+
+        for (lane = 0; lane < AES256_NI_INTERLEAVE; ++lane)
+            _mm_storeu_si128(data + lane, _mm_aesenclast_si128(state[lane],
+                keys[AES256_ROUNDS]));
+
+        blocks += AES256_NI_INTERLEAVE * AES256_BLOCK_LENGTH;
+    }
+
+    for (; count > 0; --count, blocks += AES256_BLOCK_LENGTH)
+    {
+        state[0] = _mm_xor_si128(_mm_loadu_si128((const __m128i*)blocks),
+            keys[0]);
+
+        for (round = 1; round < AES256_ROUNDS; ++round)
+            state[0] = _mm_aesenc_si128(state[0], keys[round]);
+
+        _mm_storeu_si128((__m128i*)blocks, _mm_aesenclast_si128(state[0],
+            keys[AES256_ROUNDS]));
+    }
+}
+
+AES256_TARGET_NI
+void aes256_decrypt_blocks_ni(
+    const uint8_t inverse[AES256_SCHEDULE_LENGTH], uint8_t* blocks,
+    size_t count)
+{
+    size_t round, lane;
+    __m128i keys[AES256_ROUNDS + 1];
+    __m128i state[AES256_NI_INTERLEAVE];
+
+    load_schedule(keys, inverse);
+
+    for (; count >= AES256_NI_INTERLEAVE; count -= AES256_NI_INTERLEAVE)
+    {
+        __m128i* const data = (__m128i*)blocks;
+
+        for (lane = 0; lane < AES256_NI_INTERLEAVE; ++lane)
+            state[lane] = _mm_xor_si128(_mm_loadu_si128(data + lane),
+                keys[0]);
+
+        for (round = 1; round < AES256_ROUNDS; ++round)
+            for (lane = 0; lane < AES256_NI_INTERLEAVE; ++lane)
+                state[lane] = _mm_aesdec_si128(state[lane], keys[round]);
+
+        for (lane = 0; lane < AES256_NI_INTERLEAVE; ++lane)
+            _mm_storeu_si128(data + lane, _mm_aesdeclast_si128(state[lane],
+                keys[AES256_ROUNDS]));
+
+        blocks += AES256_NI_INTERLEAVE * AES256_BLOCK_LENGTH;
+    }
+
+    for (; count > 0; --count, blocks += AES256_BLOCK_LENGTH)
+    {
+        state[0] = _mm_xor_si128(_mm_loadu_si128((const __m128i*)blocks),
+            keys[0]);
+
+        for (round = 1; round < AES256_ROUNDS; ++round)
+            state[0] = _mm_aesdec_si128(state[0], keys[round]);
+
+        _mm_storeu_si128((__m128i*)blocks, _mm_aesdeclast_si128(state[0],
+            keys[AES256_ROUNDS]));
+    }
+}
+
+#endif
@@ -0,0 +1,46 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_AES256_NI_H
+#define LIBBITCOIN_AES256_NI_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "aes256.h"
+
+#ifdef __cplusplus
+extern "C" 
+{
+#endif
+
+/* AES-NI encryption of count contiguous blocks, requires AES and SSE2. */
+void aes256_encrypt_blocks_ni(
+    const uint8_t schedule[AES256_SCHEDULE_LENGTH], uint8_t* blocks,
+    size_t count);
+
+/* AES-NI decryption of count contiguous blocks, with the inverse
+ * (equivalent inverse cipher) schedule. */
+void aes256_decrypt_blocks_ni(
+    const uint8_t inverse[AES256_SCHEDULE_LENGTH], uint8_t* blocks,
+    size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
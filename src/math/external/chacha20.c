@@ -0,0 +1,115 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "chacha20.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define CHACHA20_WORDS 16U
+#define CHACHA20_ROUNDS 20U
+
+static uint32_t rotate(uint32_t value, unsigned bits)
+{
+    return (value << bits) | (value >> (32U - bits));
+}
+
+static uint32_t load32(const uint8_t* input)
+{
+    return (uint32_t)input[0] | ((uint32_t)input[1] << 8) |
+        ((uint32_t)input[2] << 16) | ((uint32_t)input[3] << 24);
+}
+
+static void store32(uint8_t* output, uint32_t value)
+{
+    output[0] = (uint8_t)value;
+    output[1] = (uint8_t)(value >> 8);
+    output[2] = (uint8_t)(value >> 16);
+    output[3] = (uint8_t)(value >> 24);
+}
+
+#define QUARTER_ROUND(a, b, c, d) \
+    a += b; d = rotate(d ^ a, 16); \
+    c += d; b = rotate(b ^ c, 12); \
+    a += b; d = rotate(d ^ a, 8); \
+    c += d; b = rotate(b ^ c, 7)
+
+static void ChaCha20Block(const uint32_t input[CHACHA20_WORDS],
+    uint8_t output[CHACHA20_BLOCK_LENGTH])
+{
+    uint32_t x[CHACHA20_WORDS];
+    unsigned i;
+
+    memcpy(x, input, sizeof(x));
+
+    for (i = 0; i < CHACHA20_ROUNDS; i += 2)
+    {
+        QUARTER_ROUND(x[0], x[4], x[8], x[12]);
+        QUARTER_ROUND(x[1], x[5], x[9], x[13]);
+        QUARTER_ROUND(x[2], x[6], x[10], x[14]);
+        QUARTER_ROUND(x[3], x[7], x[11], x[15]);
+        QUARTER_ROUND(x[0], x[5], x[10], x[15]);
+        QUARTER_ROUND(x[1], x[6], x[11], x[12]);
+        QUARTER_ROUND(x[2], x[7], x[8], x[13]);
+        QUARTER_ROUND(x[3], x[4], x[9], x[14]);
+    }
+
+    for (i = 0; i < CHACHA20_WORDS; ++i)
+        store32(&output[4 * i], x[i] + input[i]);
+}
+
+void ChaCha20Keystream(const uint8_t key[CHACHA20_KEY_LENGTH],
+    const uint8_t nonce[CHACHA20_NONCE_LENGTH], uint32_t counter,
+    uint8_t* output, size_t length)
+{
+    uint32_t state[CHACHA20_WORDS];
+    uint8_t block[CHACHA20_BLOCK_LENGTH];
+    unsigned i;
+
+    /* "expand 32-byte k" */
+    state[0] = 0x61707865;
+    state[1] = 0x3320646e;
+    state[2] = 0x79622d32;
+    state[3] = 0x6b206574;
+
+    for (i = 0; i < 8; ++i)
+        state[4 + i] = load32(&key[4 * i]);
+
+    state[12] = counter;
+    state[13] = load32(&nonce[0]);
+    state[14] = load32(&nonce[4]);
+    state[15] = load32(&nonce[8]);
+
+    while (length >= CHACHA20_BLOCK_LENGTH)
+    {
+        ChaCha20Block(state, output);
+        output += CHACHA20_BLOCK_LENGTH;
+        length -= CHACHA20_BLOCK_LENGTH;
+        ++state[12];
+    }
+
+    if (length > 0)
+    {
+        ChaCha20Block(state, block);
+        memcpy(output, block, length);
+        memset(block, 0, sizeof(block));
+    }
+
+    memset(state, 0, sizeof(state));
+}
@@ -0,0 +1,44 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CHACHA20_H
+#define LIBBITCOIN_CHACHA20_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define CHACHA20_KEY_LENGTH 32U
+#define CHACHA20_NONCE_LENGTH 12U
+#define CHACHA20_BLOCK_LENGTH 64U
+
+#ifdef __cplusplus
+extern "C" 
+{
+#endif
+
+/* Write length bytes of the ChaCha20 keystream (RFC 8439), from the block
+ * counter, for the key and nonce. */
+void ChaCha20Keystream(const uint8_t key[CHACHA20_KEY_LENGTH],
+    const uint8_t nonce[CHACHA20_NONCE_LENGTH], uint32_t counter,
+    uint8_t* output, size_t length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
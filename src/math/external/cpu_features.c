@@ -0,0 +1,178 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "cpu_features.h"
+
+#include <stdint.h>
+
+#if defined(CPU_FEATURES_X86) && defined(_MSC_VER)
+    #include <intrin.h>
+#elif defined(CPU_FEATURES_X86)
+    #include <cpuid.h>
+#elif defined(CPU_FEATURES_ARM) && defined(__APPLE__)
+    #include <sys/sysctl.h>
+#elif defined(CPU_FEATURES_ARM) && defined(__linux__)
+    #include <sys/auxv.h>
+    #include <asm/hwcap.h>
+#endif
+
+/* Detection is idempotent, so a race between detecting threads is benign. */
+static volatile int detected = 0;
+static volatile uint32_t features = 0;
+static volatile uint32_t enabled = 0xffffffffU;
+static volatile int generation = 1;
+
+static uint32_t CPUFeaturesDetect(void)
+{
+    uint32_t result = 0;
+
+#if defined(CPU_FEATURES_X86)
+    {
+        uint32_t leaf1_ecx = 0, leaf1_edx = 0, leaf7_ebx = 0, maximum;
+        uint64_t xcr0 = 0;
+
+#if defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 0);
+        maximum = (uint32_t)info[0];
+
+        if (maximum >= 1)
+        {
+            __cpuid(info, 1);
+            leaf1_ecx = (uint32_t)info[2];
+            leaf1_edx = (uint32_t)info[3];
+        }
+
+        if (maximum >= 7)
+        {
+            __cpuidex(info, 7, 0);
+            leaf7_ebx = (uint32_t)info[1];
+        }
+#else
+        uint32_t eax, ebx, ecx, edx;
+        maximum = (uint32_t)__get_cpuid_max(0, 0);
+
+        if (maximum >= 1)
+        {
+            __cpuid(1, eax, ebx, ecx, edx);
+            leaf1_ecx = ecx;
+            leaf1_edx = edx;
+        }
+
+        if (maximum >= 7)
+        {
+            __cpuid_count(7, 0, eax, ebx, ecx, edx);
+            leaf7_ebx = ebx;
+        }
+#endif
+
+        /* AVX state must also be enabled by the operating system. */
+        if ((leaf1_ecx >> 27) & 1)
+        {
+#if defined(_MSC_VER)
+            xcr0 = _xgetbv(0);
+#else
+            uint32_t low, high;
+            __asm__ __volatile__("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+            xcr0 = ((uint64_t)high << 32) | low;
+#endif
+        }
+
+        if ((leaf1_edx >> 26) & 1)
+            result |= CPU_FEATURE_SSE2;
+
+        if ((leaf1_ecx >> 9) & 1)
+            result |= CPU_FEATURE_SSSE3;
+
+        if ((leaf1_ecx >> 19) & 1)
+            result |= CPU_FEATURE_SSE41;
+
+        if (((leaf1_ecx >> 28) & 1) && ((leaf7_ebx >> 5) & 1) &&
+            (xcr0 & 6) == 6)
+            result |= CPU_FEATURE_AVX2;
+
+        if ((leaf7_ebx >> 29) & 1)
+            result |= CPU_FEATURE_SHA_NI;
+
+        if ((leaf1_ecx >> 25) & 1)
+            result |= CPU_FEATURE_AES_NI;
+
+        if ((leaf1_ecx >> 1) & 1)
+            result |= CPU_FEATURE_CLMUL;
+    }
+#elif defined(CPU_FEATURES_ARM) && defined(__APPLE__)
+    {
+        int supported = 0;
+        size_t size = sizeof(supported);
+
+        /* All Apple aarch64 processors have the SHA2 and AES extensions. */
+        result |= CPU_FEATURE_ARM_SHA2 | CPU_FEATURE_ARM_AES;
+
+        if (sysctlbyname("hw.optional.armv8_2_sha512", &supported, &size,
+            NULL, 0) == 0 && supported != 0)
+            result |= CPU_FEATURE_ARM_SHA512;
+    }
+#elif defined(CPU_FEATURES_ARM) && defined(__linux__)
+    {
+        const unsigned long hwcap = getauxval(AT_HWCAP);
+        (void)hwcap;
+
+#if defined(HWCAP_SHA2)
+        if ((hwcap & HWCAP_SHA2) != 0)
+            result |= CPU_FEATURE_ARM_SHA2;
+#endif
+#if defined(HWCAP_SHA512)
+        if ((hwcap & HWCAP_SHA512) != 0)
+            result |= CPU_FEATURE_ARM_SHA512;
+#endif
+#if defined(HWCAP_AES)
+        if ((hwcap & HWCAP_AES) != 0)
+            result |= CPU_FEATURE_ARM_AES;
+#endif
+    }
+#endif
+
+    return result;
+}
+
+uint32_t CPUFeaturesDetected(void)
+{
+    if (!detected)
+    {
+        features = CPUFeaturesDetect();
+        detected = 1;
+    }
+
+    return features;
+}
+
+uint32_t CPUFeatures(void)
+{
+    return CPUFeaturesDetected() & enabled;
+}
+
+void CPUFeaturesEnable(uint32_t mask)
+{
+    enabled = mask;
+    generation = generation + 1;
+}
+
+int CPUFeaturesGeneration(void)
+{
+    return generation;
+}
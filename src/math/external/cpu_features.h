@@ -0,0 +1,67 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_CPU_FEATURES_H
+#define LIBBITCOIN_CPU_FEATURES_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#if defined(__x86_64__) || defined(__i386__) || \
+    defined(_M_X64) || defined(_M_IX86)
+    #define CPU_FEATURES_X86
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+    #define CPU_FEATURES_ARM
+#endif
+
+/* Processor features used by the kernels, AVX2 implies operating system
+ * support for the AVX state. */
+#define CPU_FEATURE_SSE2 0x00000001U
+#define CPU_FEATURE_SSSE3 0x00000002U
+#define CPU_FEATURE_SSE41 0x00000004U
+#define CPU_FEATURE_AVX2 0x00000008U
+#define CPU_FEATURE_SHA_NI 0x00000010U
+#define CPU_FEATURE_AES_NI 0x00000020U
+#define CPU_FEATURE_CLMUL 0x00000040U
+#define CPU_FEATURE_ARM_SHA2 0x00000100U
+#define CPU_FEATURE_ARM_SHA512 0x00000200U
+#define CPU_FEATURE_ARM_AES 0x00000400U
+
+/* The features of the executing processor, detected once. */
+uint32_t CPUFeaturesDetected(void);
+
+/* The detected features that are enabled for kernel selection. */
+uint32_t CPUFeatures(void);
+
+/* Restrict kernel selection to the masked features (zero for portable
+ * code). This is for testing and is not thread safe with hashing. */
+void CPUFeaturesEnable(uint32_t mask);
+
+/* Nonzero and changed by each CPUFeaturesEnable, so that a kernel selection
+ * cached against the generation is repeated once it changes. */
+int CPUFeaturesGeneration(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -35,12 +35,18 @@
 #include <bitcoin/bitcoin/compat.h>
 #include "pbkdf2_sha256.h"
 
+#ifdef SCRYPT_SSE2
+    #include <emmintrin.h>
+#endif
+
+#ifndef SCRYPT_SSE2
 static void blkcpy(uint8_t*, uint8_t*, size_t);
 static void blkxor(uint8_t*, uint8_t*, size_t);
 static void salsa20_8(uint8_t[64]);
 static void blockmix_salsa8(uint8_t*, uint8_t*, size_t);
 static uint64_t integerify(uint8_t*, size_t);
 static void smix(uint8_t* , size_t, uint64_t, uint8_t*, uint8_t*);
+#endif
 
 static BC_C_INLINE uint32_t le32dec(const void* pp)
 {
@@ -69,6 +75,8 @@ static BC_C_INLINE uint64_t le64dec(const void* pp)
 }
 
 
+#ifndef SCRYPT_SSE2
+
 static void blkcpy(uint8_t* dest, uint8_t* src, size_t len)
 {
     size_t i;
@@ -222,38 +230,223 @@ static void smix(uint8_t* B, size_t r,
     blkcpy(B, X, 128 * r);
 }
 
+#else /* SCRYPT_SSE2 */
+
 /**
- * crypto_scrypt(passwd, passwdlen, salt, saltlen, N, r, p, buf, buflen):
- * Compute scrypt(passwd[0 .. passwdlen - 1], salt[0 .. saltlen - 1], N, r,
- * p, buflen) and write the result into buf.  The parameters r, p, and buflen
- * must satisfy r * p < 2^30 and buflen <= (2^32 - 1) * 32.  The parameter N
- * must be a power of 2.
- *
- * Return 0 on success; or -1 on error.
+ * The SSE2 implementation holds each 64 byte block as four rows of the salsa
+ * state taken along its diagonals, so that the column and row rounds each
+ * operate on four independent quarter-rounds at once. Position p of a block
+ * holds word salsa_order[p] of the little-endian block.
  */
-int crypto_scrypt(const uint8_t* passphrase, size_t passphrase_length,
-    const uint8_t* salt, size_t salt_length, uint64_t N,
-    uint32_t r, uint32_t p, uint8_t* buf, size_t buf_length)
+static const uint8_t salsa_order[16] =
 {
-    uint8_t* B;
-    uint8_t* V;
-    uint8_t* XY;
-    uint32_t i;
+    0, 5, 10, 15, 4, 9, 14, 3, 8, 13, 2, 7, 12, 1, 6, 11
+};
 
-    /* Sanity-check parameters. */
+#define ROTATE_XOR(x, t, b) \
+    x = _mm_xor_si128(x, _mm_slli_epi32(t, b)); \
+    x = _mm_xor_si128(x, _mm_srli_epi32(t, 32 - (b)))
+
+/**
+ * salsa20_8_sse2(X0, X1, X2, X3):
+ * Apply the salsa20/8 core to the block held in diagonal rows.
+ */
+static BC_C_INLINE void salsa20_8_sse2(__m128i* X0, __m128i* X1, __m128i* X2,
+    __m128i* X3)
+{
+    __m128i x0 = *X0;
+    __m128i x1 = *X1;
+    __m128i x2 = *X2;
+    __m128i x3 = *X3;
+    __m128i t;
+    size_t i;
+
+    for (i = 0; i < 8; i += 2) {
+        /* Operate on columns. */
+        t = _mm_add_epi32(x0, x3);
+        ROTATE_XOR(x1, t, 7);
+        t = _mm_add_epi32(x1, x0);
+        ROTATE_XOR(x2, t, 9);
+        t = _mm_add_epi32(x2, x1);
+        ROTATE_XOR(x3, t, 13);
+        t = _mm_add_epi32(x3, x2);
+        ROTATE_XOR(x0, t, 18);
+
+        /* Rearrange the diagonals so that rows line up as columns. */
+        x1 = _mm_shuffle_epi32(x1, 0x93);
+        x2 = _mm_shuffle_epi32(x2, 0x4e);
+        x3 = _mm_shuffle_epi32(x3, 0x39);
+
+        /* Operate on rows. */
+        t = _mm_add_epi32(x0, x1);
+        ROTATE_XOR(x3, t, 7);
+        t = _mm_add_epi32(x3, x0);
+        ROTATE_XOR(x2, t, 9);
+        t = _mm_add_epi32(x2, x3);
+        ROTATE_XOR(x1, t, 13);
+        t = _mm_add_epi32(x1, x2);
+        ROTATE_XOR(x0, t, 18);
+
+        /* Restore the diagonals. */
+        x1 = _mm_shuffle_epi32(x1, 0x39);
+        x2 = _mm_shuffle_epi32(x2, 0x4e);
+        x3 = _mm_shuffle_epi32(x3, 0x93);
+    }
+
+    *X0 = _mm_add_epi32(*X0, x0);
+    *X1 = _mm_add_epi32(*X1, x1);
+    *X2 = _mm_add_epi32(*X2, x2);
+    *X3 = _mm_add_epi32(*X3, x3);
+}
+
+#undef ROTATE_XOR
+
+/**
+ * blockmix_salsa8_sse2(B, V, Y, r):
+ * Compute Y = BlockMix_{salsa20/8, r}(B \xor V), where V may be NULL in
+ * place of zero.  All blocks are 128r bytes in diagonal order, and Y must
+ * not overlap B or V.
+ */
+static void blockmix_salsa8_sse2(const uint8_t* B, const uint8_t* V,
+    uint8_t* Y, size_t r)
+{
+    const __m128i* b = (const __m128i*)B;
+    const __m128i* v = (const __m128i*)V;
+    __m128i* y = (__m128i*)Y;
+    __m128i X0, X1, X2, X3;
+    size_t i;
+    size_t last = (2 * r - 1) * 4;
+
+    /* 1: X <-- B_{2r - 1} */
+    X0 = _mm_loadu_si128(&b[last + 0]);
+    X1 = _mm_loadu_si128(&b[last + 1]);
+    X2 = _mm_loadu_si128(&b[last + 2]);
+    X3 = _mm_loadu_si128(&b[last + 3]);
+
+    if (v != NULL) {
+        X0 = _mm_xor_si128(X0, _mm_loadu_si128(&v[last + 0]));
+        X1 = _mm_xor_si128(X1, _mm_loadu_si128(&v[last + 1]));
+        X2 = _mm_xor_si128(X2, _mm_loadu_si128(&v[last + 2]));
+        X3 = _mm_xor_si128(X3, _mm_loadu_si128(&v[last + 3]));
+    }
+
+    /* 2: for i = 0 to 2r - 1 do */
+    for (i = 0; i < 2 * r; i++) {
+        /* 6: Y_i goes to B'_{i / 2} or B'_{r + i / 2}. */
+        __m128i* out = &y[((i & 1) * r + i / 2) * 4];
+
+        /* 3: X <-- H(X \xor B_i) */
+        X0 = _mm_xor_si128(X0, _mm_loadu_si128(&b[i * 4 + 0]));
+        X1 = _mm_xor_si128(X1, _mm_loadu_si128(&b[i * 4 + 1]));
+        X2 = _mm_xor_si128(X2, _mm_loadu_si128(&b[i * 4 + 2]));
+        X3 = _mm_xor_si128(X3, _mm_loadu_si128(&b[i * 4 + 3]));
+
+        if (v != NULL) {
+            X0 = _mm_xor_si128(X0, _mm_loadu_si128(&v[i * 4 + 0]));
+            X1 = _mm_xor_si128(X1, _mm_loadu_si128(&v[i * 4 + 1]));
+            X2 = _mm_xor_si128(X2, _mm_loadu_si128(&v[i * 4 + 2]));
+            X3 = _mm_xor_si128(X3, _mm_loadu_si128(&v[i * 4 + 3]));
+        }
+
+        salsa20_8_sse2(&X0, &X1, &X2, &X3);
+
+        /* 4: Y_i <-- X */
+        _mm_storeu_si128(&out[0], X0);
+        _mm_storeu_si128(&out[1], X1);
+        _mm_storeu_si128(&out[2], X2);
+        _mm_storeu_si128(&out[3], X3);
+    }
+}
+
+/**
+ * integerify_sse2(B, r):
+ * Return the result of parsing B_{2r-1} as a little-endian integer, where B
+ * is in diagonal order (words 0 and 1 are at positions 0 and 13).
+ */
+static BC_C_INLINE uint64_t integerify_sse2(const uint8_t* B, size_t r)
+{
+    const uint8_t* X = &B[(2 * r - 1) * 64];
+
+    return ((uint64_t)(le32dec(&X[0 * 4])) +
+        ((uint64_t)(le32dec(&X[13 * 4])) << 32));
+}
+
+/**
+ * smix_sse2(B, r, N, V, XY):
+ * Compute B = SMix_r(B, N) as smix, holding X and V in diagonal order.  Each
+ * V_{i + 1} is mixed directly from V_i, so the first loop copies nothing.
+ */
+static void smix_sse2(uint8_t* B, size_t r, uint64_t N, uint8_t* V,
+    uint8_t* XY)
+{
+    const size_t size = 128 * r;
+    uint8_t* X = XY;
+    uint8_t* Y = &XY[size];
+    uint8_t* T;
+    uint64_t i;
+    uint64_t j;
+    size_t k;
+    size_t p;
+
+    /* 1: V_0 <-- B, in diagonal order. */
+    for (k = 0; k < 2 * r; k++)
+        for (p = 0; p < 16; p++)
+            memcpy(&V[(k * 16 + p) * 4], &B[(k * 16 + salsa_order[p]) * 4], 4);
+
+    /* 2: for i = 0 to N - 1 do */
+    for (i = 0; i < N - 1; i++) {
+        /* 3, 4: V_{i + 1} <-- H(V_i) */
+        blockmix_salsa8_sse2(&V[i * size], NULL, &V[(i + 1) * size], r);
+    }
+
+    /* 4: X <-- H(V_{N - 1}) */
+    blockmix_salsa8_sse2(&V[(N - 1) * size], NULL, X, r);
+
+    /* 6: for i = 0 to N - 1 do */
+    for (i = 0; i < N; i++) {
+        /* 7: j <-- Integerify(X) mod N */
+        j = integerify_sse2(X, r) & (N - 1);
+
+        /* 8: X <-- H(X \xor V_j) */
+        blockmix_salsa8_sse2(X, &V[j * size], Y, r);
+        T = X;
+        X = Y;
+        Y = T;
+    }
+
+    /* 10: B' <-- X, in natural order. */
+    for (k = 0; k < 2 * r; k++)
+        for (p = 0; p < 16; p++)
+            memcpy(&B[(k * 16 + salsa_order[p]) * 4], &X[(k * 16 + p) * 4], 4);
+}
+
+#endif /* SCRYPT_SSE2 */
+
+void crypto_scrypt_smix(uint8_t* B, uint32_t r, uint64_t N, uint8_t* V,
+    uint8_t* XY)
+{
+#ifdef SCRYPT_SSE2
+    smix_sse2(B, r, N, V, XY);
+#else
+    smix(B, r, N, V, XY);
+#endif
+}
+
+int crypto_scrypt_check(uint64_t N, uint32_t r, uint32_t p, size_t buf_length)
+{
 #if SIZE_MAX > UINT32_MAX
     if (buf_length > (((uint64_t)(1) << 32) - 1) * 32) {
         errno = EFBIG;
-        goto err0;
+        return (-1);
     }
 #endif
     if ((uint64_t)(r) * (uint64_t)(p) >= (1 << 30)) {
         errno = EFBIG;
-        goto err0;
+        return (-1);
     }
     if (((N & (N - 1)) != 0) || (N == 0)) {
         errno = EINVAL;
-        goto err0;
+        return (-1);
     }
     if ((r > SIZE_MAX / 128 / p) ||
 #if SIZE_MAX / 256 <= UINT32_MAX
@@ -261,9 +454,34 @@ int crypto_scrypt(const uint8_t* passphrase, size_t passphrase_length,
 #endif
         (N > SIZE_MAX / 128 / r)) {
         errno = ENOMEM;
-        goto err0;
+        return (-1);
     }
 
+    return (0);
+}
+
+/**
+ * crypto_scrypt(passwd, passwdlen, salt, saltlen, N, r, p, buf, buflen):
+ * Compute scrypt(passwd[0 .. passwdlen - 1], salt[0 .. saltlen - 1], N, r,
+ * p, buflen) and write the result into buf.  The parameters r, p, and buflen
+ * must satisfy r * p < 2^30 and buflen <= (2^32 - 1) * 32.  The parameter N
+ * must be a power of 2.
+ *
+ * Return 0 on success; or -1 on error.
+ */
+int crypto_scrypt(const uint8_t* passphrase, size_t passphrase_length,
+    const uint8_t* salt, size_t salt_length, uint64_t N,
+    uint32_t r, uint32_t p, uint8_t* buf, size_t buf_length)
+{
+    uint8_t* B;
+    uint8_t* V;
+    uint8_t* XY;
+    uint32_t i;
+
+    /* Sanity-check parameters. */
+    if (crypto_scrypt_check(N, r, p, buf_length) != 0)
+        goto err0;
+
     /* Allocate memory. */
     if ((B = malloc(128 * r * p)) == NULL)
         goto err0;
@@ -279,7 +497,7 @@ int crypto_scrypt(const uint8_t* passphrase, size_t passphrase_length,
     /* 2: for i = 0 to p - 1 do */
     for (i = 0; i < p; i++) {
         /* 3: B_i <-- MF(B_i, N) */
-        smix(&B[i * 128 * r], r, N, V, XY);
+        crypto_scrypt_smix(&B[i * 128 * r], r, N, V, XY);
     }
 
     /* 5: DK <-- PBKDF2(P, B, 1, dkLen) */
@@ -32,6 +32,12 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+/* SSE2 is part of the x86-64 baseline, and may be enabled for x86. */
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define SCRYPT_SSE2
+#endif
+
 #ifdef __cplusplus
 extern "C" 
 {
@@ -50,6 +56,26 @@ int crypto_scrypt(const uint8_t* passphrase, size_t passphrase_length,
     const uint8_t* salt, size_t salt_length, uint64_t N, uint32_t r,
     uint32_t p, uint8_t* buf, size_t buf_length);
 
+/**
+ * crypto_scrypt_check(N, r, p, buflen):
+ * Validate the scrypt parameters as crypto_scrypt does, so that the steps of
+ * the function may be distributed by the caller.
+ *
+ * Return 0 on success; or -1 with errno set on error.
+ */
+int crypto_scrypt_check(uint64_t N, uint32_t r, uint32_t p,
+    size_t buf_length);
+
+/**
+ * crypto_scrypt_smix(B, r, N, V, XY):
+ * Compute B = SMix_r(B, N), one of the p independent mixes of scrypt.  The
+ * input B must be 128r bytes in length; the temporary storage V must be
+ * 128rN bytes in length; the temporary storage XY must be 256r bytes in
+ * length.  Mixes of distinct B with distinct V and XY may run concurrently.
+ */
+void crypto_scrypt_smix(uint8_t* B, uint32_t r, uint64_t N, uint8_t* V,
+    uint8_t* XY);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,136 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "gf2_32.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include "cpu_features.h"
+#include "gf2_32_clmul.h"
+
+typedef uint32_t(*gf2_32_multiply_function)(uint32_t left, uint32_t right);
+typedef void(*gf2_32_add_odd_powers_function)(uint32_t* sums, size_t count,
+    uint32_t element);
+
+/* The selection is idempotent, so a race between initializing threads is
+ * benign. The portable arithmetic is used if no backend is selected. It is
+ * repeated if the enabled processor features change. */
+static volatile int initialized = 0;
+static volatile gf2_32_multiply_function multiply = NULL;
+static volatile gf2_32_add_odd_powers_function add_odd_powers = NULL;
+
+/* -------------------------------------------------------------------------- */
+/* The product has degree under 63, the reduction of the high word (degree
+ * under 31) by x^32 = x^7 + x^3 + x^2 + 1 overflows by under 7 bits, which
+ * is reduced once more without overflow. */
+uint32_t gf2_32_reduce(uint64_t product)
+{
+    const uint64_t high = product >> 32;
+    const uint64_t folded = high ^ (high << 2) ^ (high << 3) ^ (high << 7);
+    const uint64_t over = folded >> 32;
+
+    return (uint32_t)product ^ (uint32_t)folded ^
+        (uint32_t)(over ^ (over << 2) ^ (over << 3) ^ (over << 7));
+} /* gf2_32_reduce */
+
+/* -------------------------------------------------------------------------- */
+/* Carry-less multiplication four bits of the right operand at a time, over a
+ * table of the left operand multiplied by each four bit value. */
+static uint32_t gf2_32_multiply_portable(uint32_t left, uint32_t right)
+{
+    uint64_t table[16];
+    uint64_t product = 0;
+    int shift;
+    size_t index;
+
+    table[0] = 0;
+
+    for (index = 1; index < 16; ++index)
+        table[index] = (index & 1) ? table[index - 1] ^ left :
+            table[index >> 1] << 1;
+
+    for (shift = 28; shift >= 0; shift -= 4)
+        product = (product << 4) ^ table[(right >> shift) & 0x0f];
+
+    return gf2_32_reduce(product);
+} /* gf2_32_multiply_portable */
+
+static void gf2_32_add_odd_powers_portable(uint32_t* sums, size_t count,
+    uint32_t element)
+{
+    const uint32_t square = gf2_32_multiply_portable(element, element);
+    uint32_t power = element;
+    size_t index;
+
+    for (index = 0; index < count; ++index)
+    {
+        sums[index] ^= power;
+        power = gf2_32_multiply_portable(power, square);
+    }
+} /* gf2_32_add_odd_powers_portable */
+
+/* -------------------------------------------------------------------------- */
+/* Select a hardware backend supported by the executing processor. */
+static void gf2_32_initialize(void)
+{
+    uint32_t features;
+
+    if (initialized == CPUFeaturesGeneration())
+        return;
+
+    features = CPUFeatures();
+    multiply = NULL;
+    add_odd_powers = NULL;
+
+#if defined(GF2_32_X86)
+    if ((features & CPU_FEATURE_CLMUL) && (features & CPU_FEATURE_SSE2))
+    {
+        multiply = gf2_32_multiply_clmul;
+        add_odd_powers = gf2_32_add_odd_powers_clmul;
+    }
+#else
+    (void)features;
+#endif
+
+    initialized = CPUFeaturesGeneration();
+} /* gf2_32_initialize */
+
+/* -------------------------------------------------------------------------- */
+uint32_t gf2_32_multiply(uint32_t left, uint32_t right)
+{
+    gf2_32_initialize();
+
+    return multiply != NULL ? multiply(left, right) :
+        gf2_32_multiply_portable(left, right);
+} /* gf2_32_multiply */
+
+void gf2_32_add_odd_powers(uint32_t* sums, size_t count, uint32_t element)
+{
+    gf2_32_initialize();
+
+    if (add_odd_powers != NULL)
+        add_odd_powers(sums, count, element);
+    else
+        gf2_32_add_odd_powers_portable(sums, count, element);
+} /* gf2_32_add_odd_powers */
+
+const char* gf2_32_kernel(void)
+{
+    gf2_32_initialize();
+    return multiply != NULL ? "clmul" : "portable";
+} /* gf2_32_kernel */
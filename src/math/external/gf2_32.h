@@ -0,0 +1,56 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_GF2_32_H
+#define LIBBITCOIN_GF2_32_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__x86_64__) || defined(__i386__) || \
+    defined(_M_X64) || defined(_M_IX86)
+    #define GF2_32_X86
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Elements of GF(2^32) are polynomials over GF(2) of degree under 32, with
+ * bit i the coefficient of x^i, modulo x^32 + x^7 + x^3 + x^2 + 1. */
+#define GF2_32_MODULUS 0x8dU
+
+/* Reduce a carry-less product of two elements modulo the field polynomial. */
+uint32_t gf2_32_reduce(uint64_t product);
+
+/* The product of the elements, carry-less if available. */
+uint32_t gf2_32_multiply(uint32_t left, uint32_t right);
+
+/* Add the odd powers element^1, element^3, ... element^(2 * count - 1) to
+ * the count sums, in order. */
+void gf2_32_add_odd_powers(uint32_t* sums, size_t count, uint32_t element);
+
+/* The name of the selected backend, for diagnostics. */
+const char* gf2_32_kernel(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
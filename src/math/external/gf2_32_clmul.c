@@ -0,0 +1,72 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "gf2_32_clmul.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include "gf2_32.h"
+
+#ifdef GF2_32_X86
+
+#include <emmintrin.h>
+#include <wmmintrin.h>
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define GF2_32_TARGET_CLMUL __attribute__((target("sse2,pclmul")))
+#else
+    #define GF2_32_TARGET_CLMUL
+#endif
+
+GF2_32_TARGET_CLMUL
+static uint64_t clmul(uint32_t left, uint32_t right)
+{
+    const __m128i product = _mm_clmulepi64_si128(
+        _mm_cvtsi32_si128((int)left), _mm_cvtsi32_si128((int)right), 0x00);
+
+#if defined(__x86_64__) || defined(_M_X64)
+    return (uint64_t)_mm_cvtsi128_si64(product);
+#else
+    return (uint64_t)(uint32_t)_mm_cvtsi128_si32(product) |
+        ((uint64_t)(uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(product, 4))
+            << 32);
+#endif
+}
+
+GF2_32_TARGET_CLMUL
+uint32_t gf2_32_multiply_clmul(uint32_t left, uint32_t right)
+{
+    return gf2_32_reduce(clmul(left, right));
+}
+
+GF2_32_TARGET_CLMUL
+void gf2_32_add_odd_powers_clmul(uint32_t* sums, size_t count,
+    uint32_t element)
+{
+    const uint32_t square = gf2_32_reduce(clmul(element, element));
+    uint32_t power = element;
+    size_t index;
+
+    for (index = 0; index < count; ++index)
+    {
+        sums[index] ^= power;
+        power = gf2_32_reduce(clmul(power, square));
+    }
+}
+
+#endif
@@ -0,0 +1,42 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_GF2_32_CLMUL_H
+#define LIBBITCOIN_GF2_32_CLMUL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "gf2_32.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* PCLMULQDQ product of the elements, requires CLMUL and SSE2. */
+uint32_t gf2_32_multiply_clmul(uint32_t left, uint32_t right);
+
+/* PCLMULQDQ accumulation of odd powers, requires CLMUL and SSE2. */
+void gf2_32_add_odd_powers_clmul(uint32_t* sums, size_t count,
+    uint32_t element);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
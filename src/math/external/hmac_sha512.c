@@ -28,6 +28,7 @@
 #include <stdint.h>
 #include <string.h>
 #include "sha512.h"
+#include "sha512_avx2.h"
 #include "zeroize.h"
 
 void HMACSHA512(const uint8_t* input, size_t length, const uint8_t* key,
@@ -89,3 +90,197 @@ void HMACSHA512Update(HMACSHA512CTX* context, const uint8_t* input,
 {
     SHA512Update(&context->ictx, input, length);
 }
+
+/* Batch */
+
+#ifdef SHA512_X86
+
+/* The blocks of one inner message, which follow the keyed block. */
+typedef struct HMACSHA512Lane
+{
+    const uint8_t* input;
+    size_t blocks;
+    size_t pads;
+    uint8_t padding[2 * SHA512_BLOCK_LENGTH];
+} HMACSHA512Lane;
+
+static void be64enc(uint8_t* p, uint64_t x)
+{
+    size_t i;
+
+    for (i = 0; i < 8; i++)
+        p[i] = (uint8_t)(x >> (56 - 8 * i));
+}
+
+static void be64enc_vect(uint8_t* dst, const uint64_t* src, size_t length)
+{
+    size_t i;
+
+    for (i = 0; i < length / 8; i++)
+        be64enc(dst + i * 8, src[i]);
+}
+
+/* Pad the message tail, counting the keyed block that precedes it. */
+static void HMACSHA512LaneLoad(HMACSHA512Lane* lane, const uint8_t* input,
+    size_t length)
+{
+    const size_t r = length % SHA512_BLOCK_LENGTH;
+    const uint64_t total = (uint64_t)length + SHA512_BLOCK_LENGTH;
+    uint8_t* end;
+
+    lane->input = input;
+    lane->blocks = length / SHA512_BLOCK_LENGTH;
+    lane->pads = (r < 112) ? 1 : 2;
+
+    memset(lane->padding, 0, sizeof lane->padding);
+
+    if (r != 0)
+        memcpy(lane->padding, input + length - r, r);
+
+    lane->padding[r] = 0x80;
+    end = lane->padding + lane->pads * SHA512_BLOCK_LENGTH;
+    be64enc(end - 16, total >> 61);
+    be64enc(end - 8, total << 3);
+}
+
+/* The key padded for the inner (0x36) or outer (0x5c) hash. */
+static void HMACSHA512KeyPad(uint8_t pad[SHA512_BLOCK_LENGTH],
+    const uint8_t* key, size_t key_length, uint8_t value)
+{
+    size_t i;
+
+    memset(pad, value, SHA512_BLOCK_LENGTH);
+
+    for (i = 0; i < key_length; i++)
+        pad[i] ^= key[i];
+}
+
+/* Hash four message and key pairs, a lane each. Shorter messages complete
+ * early, and their lanes then compress into a discarded state. */
+static void HMACSHA512Lanes(const uint8_t* const inputs[],
+    const size_t lengths[], const uint8_t* const keys[],
+    const size_t key_lengths[], uint8_t digests[][HMACSHA512_DIGEST_LENGTH])
+{
+    size_t lane, step, steps = 0;
+    SHA512CTX initial;
+    HMACSHA512Lane lanes[SHA512_AVX2_LANES];
+    uint64_t inner[SHA512_AVX2_LANES][SHA512_STATE_LENGTH];
+    uint64_t outer[SHA512_AVX2_LANES][SHA512_STATE_LENGTH];
+    uint64_t discard[SHA512_AVX2_LANES][SHA512_STATE_LENGTH];
+    uint8_t key_hash[SHA512_AVX2_LANES][SHA512_DIGEST_LENGTH];
+    uint8_t block[SHA512_AVX2_LANES][SHA512_BLOCK_LENGTH];
+    uint64_t* states[SHA512_AVX2_LANES];
+    const uint8_t* blocks[SHA512_AVX2_LANES];
+    const uint8_t* key[SHA512_AVX2_LANES];
+    size_t key_length[SHA512_AVX2_LANES];
+
+    SHA512Init(&initial);
+
+    for (lane = 0; lane < SHA512_AVX2_LANES; lane++)
+    {
+        key[lane] = keys[lane];
+        key_length[lane] = key_lengths[lane];
+
+        if (key_length[lane] > SHA512_BLOCK_LENGTH)
+        {
+            SHA512_(key[lane], key_length[lane], key_hash[lane]);
+            key[lane] = key_hash[lane];
+            key_length[lane] = SHA512_DIGEST_LENGTH;
+        }
+
+        HMACSHA512KeyPad(block[lane], key[lane], key_length[lane], 0x36);
+        memcpy(inner[lane], initial.state, sizeof(inner[lane]));
+        states[lane] = inner[lane];
+        blocks[lane] = block[lane];
+    }
+
+    SHA512TransformAvx2(states, blocks);
+
+    for (lane = 0; lane < SHA512_AVX2_LANES; lane++)
+    {
+        HMACSHA512KeyPad(block[lane], key[lane], key_length[lane], 0x5c);
+        memcpy(outer[lane], initial.state, sizeof(outer[lane]));
+        states[lane] = outer[lane];
+    }
+
+    SHA512TransformAvx2(states, blocks);
+
+    for (lane = 0; lane < SHA512_AVX2_LANES; lane++)
+    {
+        HMACSHA512LaneLoad(&lanes[lane], inputs[lane], lengths[lane]);
+
+        if (lanes[lane].blocks + lanes[lane].pads > steps)
+            steps = lanes[lane].blocks + lanes[lane].pads;
+    }
+
+    for (step = 0; step < steps; step++)
+    {
+        for (lane = 0; lane < SHA512_AVX2_LANES; lane++)
+        {
+            const HMACSHA512Lane* current = &lanes[lane];
+
+            if (step < current->blocks)
+            {
+                states[lane] = inner[lane];
+                blocks[lane] = current->input + step * SHA512_BLOCK_LENGTH;
+            }
+            else if (step < current->blocks + current->pads)
+            {
+                states[lane] = inner[lane];
+                blocks[lane] = current->padding + (step - current->blocks) *
+                    SHA512_BLOCK_LENGTH;
+            }
+            else
+            {
+                states[lane] = discard[lane];
+                blocks[lane] = current->padding;
+            }
+        }
+
+        SHA512TransformAvx2(states, blocks);
+    }
+
+    /* The outer message is the inner digest, in a single padded block. */
+    for (lane = 0; lane < SHA512_AVX2_LANES; lane++)
+    {
+        memset(block[lane], 0, SHA512_BLOCK_LENGTH);
+        be64enc_vect(block[lane], inner[lane], SHA512_DIGEST_LENGTH);
+        block[lane][SHA512_DIGEST_LENGTH] = 0x80;
+        be64enc(block[lane] + SHA512_BLOCK_LENGTH - 8,
+            (uint64_t)(SHA512_BLOCK_LENGTH + SHA512_DIGEST_LENGTH) << 3);
+        states[lane] = outer[lane];
+        blocks[lane] = block[lane];
+    }
+
+    SHA512TransformAvx2(states, blocks);
+
+    for (lane = 0; lane < SHA512_AVX2_LANES; lane++)
+        be64enc_vect(digests[lane], outer[lane], HMACSHA512_DIGEST_LENGTH);
+
+    zeroize(lanes, sizeof(lanes));
+    zeroize(inner, sizeof(inner));
+    zeroize(outer, sizeof(outer));
+    zeroize(discard, sizeof(discard));
+    zeroize(key_hash, sizeof(key_hash));
+    zeroize(block, sizeof(block));
+}
+
+#endif
+
+void HMACSHA512Batch(const uint8_t* const inputs[], const size_t lengths[],
+    const uint8_t* const keys[], const size_t key_lengths[], size_t count,
+    uint8_t digests[][HMACSHA512_DIGEST_LENGTH])
+{
+    size_t next = 0;
+
+#ifdef SHA512_X86
+    if (SHA512Avx2Supported())
+        for (; next + SHA512_AVX2_LANES <= count; next += SHA512_AVX2_LANES)
+            HMACSHA512Lanes(inputs + next, lengths + next, keys + next,
+                key_lengths + next, digests + next);
+#endif
+
+    for (; next < count; ++next)
+        HMACSHA512(inputs[next], lengths[next], keys[next], key_lengths[next],
+            digests[next]);
+}
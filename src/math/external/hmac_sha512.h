@@ -55,6 +55,11 @@ void HMACSHA512Init(HMACSHA512CTX* context, const uint8_t* key,
 void HMACSHA512Update(HMACSHA512CTX* context, const uint8_t* input,
     size_t length);
 
+/* Hash count independent message and key pairs, interleaved if available. */
+void HMACSHA512Batch(const uint8_t* const inputs[], const size_t lengths[],
+    const uint8_t* const keys[], const size_t key_lengths[], size_t count,
+    uint8_t digests[][HMACSHA512_DIGEST_LENGTH]);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,316 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "num3072.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+    #include <intrin.h>
+#endif
+
+#define NUM3072_PRODUCT_LIMBS (2U * NUM3072_LIMBS)
+
+/* The prime is 2^3072 - NUM3072_DIFFERENCE. */
+#define NUM3072_DIFFERENCE 1103717U
+
+/* The inverse exponent, prime - 2, is (2^3051 - 1) * 2^21 + 993433. */
+#define NUM3072_INVERSE_ONES 3051U
+#define NUM3072_INVERSE_SHIFT 21U
+#define NUM3072_INVERSE_TAIL 993433U
+
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 uint128_t;
+#endif
+
+static void Multiply64(uint64_t left, uint64_t right, uint64_t* low,
+    uint64_t* high)
+{
+#if defined(__SIZEOF_INT128__)
+    const uint128_t product = (uint128_t)left * right;
+    *low = (uint64_t)product;
+    *high = (uint64_t)(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    *low = _umul128(left, right, high);
+#else
+    const uint64_t left_low = (uint32_t)left;
+    const uint64_t left_high = left >> 32;
+    const uint64_t right_low = (uint32_t)right;
+    const uint64_t right_high = right >> 32;
+    const uint64_t low_low = left_low * right_low;
+    const uint64_t high_low = left_high * right_low;
+    const uint64_t low_high = left_low * right_high;
+    const uint64_t middle = (low_low >> 32) + (uint32_t)high_low +
+        (uint32_t)low_high;
+    *low = (middle << 32) | (uint32_t)low_low;
+    *high = left_high * right_high + (high_low >> 32) + (low_high >> 32) +
+        (middle >> 32);
+#endif
+}
+
+/* Add the value into the three limb accumulator. */
+static void Add(uint64_t accumulator[3], uint64_t value)
+{
+    accumulator[0] += value;
+    if (accumulator[0] < value && ++accumulator[1] == 0)
+        ++accumulator[2];
+}
+
+/* Add the product into the three limb accumulator. The high limb of a
+ * product is at most 2^64 - 2, so its carry increment does not overflow. */
+static void Accumulate(uint64_t accumulator[3], uint64_t left,
+    uint64_t right)
+{
+#if defined(__SIZEOF_INT128__)
+    const uint128_t product = (uint128_t)left * right;
+    const uint128_t sum = (((uint128_t)accumulator[1] << 64) |
+        accumulator[0]) + product;
+    accumulator[0] = (uint64_t)sum;
+    accumulator[1] = (uint64_t)(sum >> 64);
+    accumulator[2] += (sum < product);
+#else
+    uint64_t low, high;
+    Multiply64(left, right, &low, &high);
+    accumulator[0] += low;
+    high += (accumulator[0] < low);
+    accumulator[1] += high;
+    accumulator[2] += (accumulator[1] < high);
+#endif
+}
+
+/* Emit the low accumulator limb and shift the accumulator down. */
+static uint64_t Shift(uint64_t accumulator[3])
+{
+    const uint64_t limb = accumulator[0];
+    accumulator[0] = accumulator[1];
+    accumulator[1] = accumulator[2];
+    accumulator[2] = 0;
+    return limb;
+}
+
+/* True if the value is not below the prime, so that all limbs above the
+ * first are ones and the first is at least 2^64 - NUM3072_DIFFERENCE. */
+static int IsOverflow(const Num3072* value)
+{
+    size_t i;
+
+    if (value->limbs[0] < (uint64_t)0 - NUM3072_DIFFERENCE)
+        return 0;
+
+    for (i = 1; i < NUM3072_LIMBS; ++i)
+        if (value->limbs[i] != (uint64_t)0 - 1)
+            return 0;
+
+    return 1;
+}
+
+/* Add carry * 2^3072 as carry * NUM3072_DIFFERENCE, until there is none. */
+static void FoldCarry(Num3072* value, uint64_t carry)
+{
+    uint64_t low, high;
+    size_t i;
+
+    while (carry != 0)
+    {
+        Multiply64(carry, NUM3072_DIFFERENCE, &low, &high);
+        value->limbs[0] += low;
+        high += (value->limbs[0] < low);
+        value->limbs[1] += high;
+        carry = (value->limbs[1] < high);
+
+        for (i = 2; carry != 0 && i < NUM3072_LIMBS; ++i)
+            carry = (++value->limbs[i] == 0);
+    }
+}
+
+/* Reduce a double width product, folding the high half into the low half
+ * as 2^3072 = NUM3072_DIFFERENCE (modulo the prime). */
+static void Reduce(Num3072* out, const uint64_t product[NUM3072_PRODUCT_LIMBS])
+{
+    uint64_t accumulator[3] = { 0, 0, 0 };
+    size_t i;
+
+    for (i = 0; i < NUM3072_LIMBS; ++i)
+    {
+        Add(accumulator, product[i]);
+        Accumulate(accumulator, product[NUM3072_LIMBS + i],
+            NUM3072_DIFFERENCE);
+        out->limbs[i] = Shift(accumulator);
+    }
+
+    /* The remaining carry is less than 2^22, so it fits the low limb. */
+    FoldCarry(out, accumulator[0]);
+}
+
+/* Add the second accumulator into the first. */
+static void Merge(uint64_t accumulator[3], const uint64_t other[3])
+{
+    Add(accumulator, other[0]);
+    accumulator[1] += other[1];
+    accumulator[2] += other[2] + (accumulator[1] < other[1]);
+}
+
+/* The full product by columns (Comba), each column in one accumulator. */
+static void Product(uint64_t product[NUM3072_PRODUCT_LIMBS],
+    const Num3072* left, const Num3072* right)
+{
+    uint64_t accumulator[3] = { 0, 0, 0 };
+    size_t column, i, first, last;
+
+    for (column = 0; column < NUM3072_PRODUCT_LIMBS - 1; ++column)
+    {
+        first = column < NUM3072_LIMBS ? 0 : column - NUM3072_LIMBS + 1;
+        last = column < NUM3072_LIMBS ? column : NUM3072_LIMBS - 1;
+
+        for (i = first; i <= last; ++i)
+            Accumulate(accumulator, left->limbs[i], right->limbs[column - i]);
+
+        product[column] = Shift(accumulator);
+    }
+
+    product[NUM3072_PRODUCT_LIMBS - 1] = accumulator[0];
+}
+
+/* The full square by columns, each cross product computed once. */
+static void SquareProduct(uint64_t product[NUM3072_PRODUCT_LIMBS],
+    const Num3072* value)
+{
+    uint64_t accumulator[3] = { 0, 0, 0 };
+    uint64_t doubled[3];
+    size_t column, i, first, last;
+
+    for (column = 0; column < NUM3072_PRODUCT_LIMBS - 1; ++column)
+    {
+        first = column < NUM3072_LIMBS ? 0 : column - NUM3072_LIMBS + 1;
+        last = column < NUM3072_LIMBS ? column : NUM3072_LIMBS - 1;
+        doubled[0] = doubled[1] = doubled[2] = 0;
+
+        for (i = first; i < column - i && i <= last; ++i)
+            Accumulate(doubled, value->limbs[i], value->limbs[column - i]);
+
+        /* The cross products appear twice in the column. */
+        doubled[2] = (doubled[2] << 1) | (doubled[1] >> 63);
+        doubled[1] = (doubled[1] << 1) | (doubled[0] >> 63);
+        doubled[0] <<= 1;
+
+        if ((column & 1) == 0)
+            Accumulate(doubled, value->limbs[column / 2],
+                value->limbs[column / 2]);
+
+        Merge(accumulator, doubled);
+        product[column] = Shift(accumulator);
+    }
+
+    product[NUM3072_PRODUCT_LIMBS - 1] = accumulator[0];
+}
+
+void Num3072SetOne(Num3072* out)
+{
+    memset(out->limbs, 0, sizeof(out->limbs));
+    out->limbs[0] = 1;
+}
+
+void Num3072FromBytes(Num3072* out, const uint8_t input[NUM3072_BYTES])
+{
+    size_t i, j;
+
+    for (i = 0; i < NUM3072_LIMBS; ++i)
+    {
+        out->limbs[i] = 0;
+        for (j = 0; j < 8; ++j)
+            out->limbs[i] |= (uint64_t)input[8 * i + j] << (8 * j);
+    }
+}
+
+void Num3072ToBytes(uint8_t output[NUM3072_BYTES], const Num3072* value)
+{
+    Num3072 reduced = *value;
+    size_t i, j;
+
+    /* Subtract the prime, as adding the difference modulo 2^3072. */
+    if (IsOverflow(&reduced))
+    {
+        reduced.limbs[0] += NUM3072_DIFFERENCE;
+        for (i = 1; i < NUM3072_LIMBS; ++i)
+            reduced.limbs[i] = 0;
+    }
+
+    for (i = 0; i < NUM3072_LIMBS; ++i)
+        for (j = 0; j < 8; ++j)
+            output[8 * i + j] = (uint8_t)(reduced.limbs[i] >> (8 * j));
+}
+
+void Num3072Multiply(Num3072* out, const Num3072* left, const Num3072* right)
+{
+    uint64_t product[NUM3072_PRODUCT_LIMBS];
+    Product(product, left, right);
+    Reduce(out, product);
+}
+
+void Num3072Square(Num3072* out, const Num3072* value)
+{
+    uint64_t product[NUM3072_PRODUCT_LIMBS];
+    SquareProduct(product, value);
+    Reduce(out, product);
+}
+
+/* Fermat inversion, value^(prime - 2). The exponent is mostly ones, so the
+ * power value^(2^n - 1) is built by doubling n, each doubling costing n
+ * squares and one product, rather than one product for each exponent bit. */
+void Num3072Inverse(Num3072* out, const Num3072* value)
+{
+    Num3072 ones, shifted, tail;
+    size_t count = 1, bit, i;
+
+    ones = *value;
+
+    /* The top bit of the count of ones is bit 11. */
+    for (bit = 11; bit-- > 0;)
+    {
+        shifted = ones;
+        for (i = 0; i < count; ++i)
+            Num3072Square(&shifted, &shifted);
+
+        Num3072Multiply(&ones, &shifted, &ones);
+        count *= 2;
+
+        if (((NUM3072_INVERSE_ONES >> bit) & 1) != 0)
+        {
+            Num3072Square(&ones, &ones);
+            Num3072Multiply(&ones, &ones, value);
+            ++count;
+        }
+    }
+
+    for (i = 0; i < NUM3072_INVERSE_SHIFT; ++i)
+        Num3072Square(&ones, &ones);
+
+    Num3072SetOne(&tail);
+
+    /* The top bit of the tail is bit 19. */
+    for (bit = 20; bit-- > 0;)
+    {
+        Num3072Square(&tail, &tail);
+        if (((NUM3072_INVERSE_TAIL >> bit) & 1) != 0)
+            Num3072Multiply(&tail, &tail, value);
+    }
+
+    Num3072Multiply(out, &ones, &tail);
+}
@@ -0,0 +1,58 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_NUM3072_H
+#define LIBBITCOIN_NUM3072_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define NUM3072_LIMBS 48U
+#define NUM3072_BYTES 384U
+
+#ifdef __cplusplus
+extern "C" 
+{
+#endif
+
+/* An integer modulo the prime 2^3072 - 1103717, as little-endian 64 bit
+ * limbs. Any 3072 bit value is accepted as an operand, and results are not
+ * necessarily below the prime until serialized. */
+typedef struct Num3072
+{
+    uint64_t limbs[NUM3072_LIMBS];
+} Num3072;
+
+void Num3072SetOne(Num3072* out);
+
+/* Parse and serialize 384 bytes, little-endian (serialization is reduced). */
+void Num3072FromBytes(Num3072* out, const uint8_t input[NUM3072_BYTES]);
+void Num3072ToBytes(uint8_t output[NUM3072_BYTES], const Num3072* value);
+
+/* Modular product and square, out may alias the operands. */
+void Num3072Multiply(Num3072* out, const Num3072* left, const Num3072* right);
+void Num3072Square(Num3072* out, const Num3072* value);
+
+/* Modular inverse (by exponentiation), zero for zero. */
+void Num3072Inverse(Num3072* out, const Num3072* value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -18,51 +18,102 @@
 
 #include <stddef.h>
 #include <stdint.h>
-#include <stdlib.h>
 #include <string.h>
 #include "hmac_sha512.h"
+#include "sha512.h"
+#include "sha512_avx2.h"
 #include "zeroize.h"
 
+/* Each iteration hashes one 64 byte digest after one keyed block. */
+#define PBKDF2_MESSAGE_BITS ((SHA512_BLOCK_LENGTH + HMACSHA512_DIGEST_LENGTH) * 8)
+
+static void be64enc_vect(uint8_t* dst, const uint64_t* src, size_t length)
+{
+    size_t i, j;
+
+    for (i = 0; i < length / 8; i++)
+        for (j = 0; j < 8; j++)
+            dst[i * 8 + j] = (uint8_t)(src[i] >> (56 - 8 * j));
+}
+
+/* Pad a block holding a digest message, so that only the digest changes. */
+static void pkcs5_pbkdf2_pad(uint8_t block[SHA512_BLOCK_LENGTH])
+{
+    memset(block + HMACSHA512_DIGEST_LENGTH, 0,
+        SHA512_BLOCK_LENGTH - HMACSHA512_DIGEST_LENGTH);
+    block[HMACSHA512_DIGEST_LENGTH] = 0x80;
+    block[SHA512_BLOCK_LENGTH - 2] = (PBKDF2_MESSAGE_BITS >> 8) & 0xff;
+    block[SHA512_BLOCK_LENGTH - 1] = (PBKDF2_MESSAGE_BITS >> 0) & 0xff;
+}
+
+/* The first iteration, the hmac of the salt and block count. */
+static void pkcs5_pbkdf2_first(const HMACSHA512CTX* keyed, const uint8_t* salt,
+    size_t salt_length, size_t count, uint8_t digest[HMACSHA512_DIGEST_LENGTH])
+{
+    HMACSHA512CTX context = *keyed;
+    uint8_t number[4];
+
+    number[0] = (count >> 24) & 0xff;
+    number[1] = (count >> 16) & 0xff;
+    number[2] = (count >> 8) & 0xff;
+    number[3] = (count >> 0) & 0xff;
+
+    HMACSHA512Update(&context, salt, salt_length);
+    HMACSHA512Update(&context, number, sizeof(number));
+    HMACSHA512Final(&context, digest);
+    zeroize(&context, sizeof(context));
+}
+
+/* Each later iteration continues from the keyed midstates. */
+static void pkcs5_pbkdf2_block(const HMACSHA512CTX* keyed,
+    const uint8_t* salt, size_t salt_length, size_t count,
+    uint8_t buffer[HMACSHA512_DIGEST_LENGTH], size_t iterations)
+{
+    size_t index, iteration;
+    uint64_t state[SHA512_STATE_LENGTH];
+    uint8_t block[SHA512_BLOCK_LENGTH];
+
+    pkcs5_pbkdf2_first(keyed, salt, salt_length, count, block);
+    memcpy(buffer, block, HMACSHA512_DIGEST_LENGTH);
+    pkcs5_pbkdf2_pad(block);
+
+    for (iteration = 1; iteration < iterations; iteration++)
+    {
+        memcpy(state, keyed->ictx.state, sizeof(state));
+        SHA512Transform(state, block);
+        be64enc_vect(block, state, HMACSHA512_DIGEST_LENGTH);
+
+        memcpy(state, keyed->octx.state, sizeof(state));
+        SHA512Transform(state, block);
+        be64enc_vect(block, state, HMACSHA512_DIGEST_LENGTH);
+
+        for (index = 0; index < HMACSHA512_DIGEST_LENGTH; index++)
+            buffer[index] ^= block[index];
+    }
+
+    zeroize(state, sizeof(state));
+    zeroize(block, sizeof(block));
+}
+
 int pkcs5_pbkdf2(const uint8_t* passphrase, size_t passphrase_length,
     const uint8_t* salt, size_t salt_length, uint8_t* key, size_t key_length,
     size_t iterations)
 {
-    uint8_t* asalt;
-    size_t asalt_size;
-    size_t count, index, iteration, length;
+    size_t count, length;
+    HMACSHA512CTX keyed;
     uint8_t buffer[HMACSHA512_DIGEST_LENGTH];
-    uint8_t digest1[HMACSHA512_DIGEST_LENGTH];
-    uint8_t digest2[HMACSHA512_DIGEST_LENGTH];
 
     /* An iteration count of 0 is equivalent to a count of 1. */
     /* A key_length of 0 is a no-op. */
     /* A salt_length of 0 is perfectly valid. */
 
-    if (salt_length > SIZE_MAX - 4)
-        return -1;
-    asalt_size = salt_length + 4;
-    asalt = malloc(asalt_size);
-    if (asalt == NULL)
-        return -1;
+    /* The passphrase pads are hashed once, not once per iteration. */
+    HMACSHA512Init(&keyed, passphrase, passphrase_length);
 
-    memcpy(asalt, salt, salt_length);
     for (count = 1; key_length > 0; count++)
     {
-        asalt[salt_length + 0] = (count >> 24) & 0xff;
-        asalt[salt_length + 1] = (count >> 16) & 0xff;
-        asalt[salt_length + 2] = (count >> 8) & 0xff;
-        asalt[salt_length + 3] = (count >> 0) & 0xff;
-        HMACSHA512(asalt, asalt_size, passphrase, passphrase_length, digest1);
-        memcpy(buffer, digest1, sizeof(buffer));
-
-        for (iteration = 1; iteration < iterations; iteration++)
-        {
-            HMACSHA512(digest1, sizeof(digest1), passphrase, passphrase_length,
-                digest2);
-            memcpy(digest1, digest2, sizeof(digest1));
-            for (index = 0; index < sizeof(buffer); index++)
-                buffer[index] ^= digest1[index];
-        }
+        pkcs5_pbkdf2_block(&keyed, salt, salt_length, count, buffer,
+            iterations);
 
         length = (key_length < sizeof(buffer) ? key_length : sizeof(buffer));
         memcpy(key, buffer, length);
@@ -70,11 +121,86 @@ int pkcs5_pbkdf2(const uint8_t* passphrase, size_t passphrase_length,
         key_length -= length;
     };
 
-    zeroize(digest1, sizeof(digest1));
-    zeroize(digest2, sizeof(digest2));
+    zeroize(&keyed, sizeof(keyed));
     zeroize(buffer, sizeof(buffer));
-    zeroize(asalt, asalt_size);
-    free(asalt);
 
     return 0;
 }
+
+#ifdef SHA512_X86
+
+/* Derive the first key block of four passphrases, a lane each. */
+static void pkcs5_pbkdf2_lanes(const uint8_t* const passphrases[],
+    const size_t passphrase_lengths[], const uint8_t* const salts[],
+    const size_t salt_lengths[], uint8_t keys[][HMACSHA512_DIGEST_LENGTH],
+    size_t iterations)
+{
+    size_t lane, index, iteration;
+    HMACSHA512CTX keyed[SHA512_AVX2_LANES];
+    uint64_t state[SHA512_AVX2_LANES][SHA512_STATE_LENGTH];
+    uint8_t block[SHA512_AVX2_LANES][SHA512_BLOCK_LENGTH];
+    uint64_t* states[SHA512_AVX2_LANES];
+    const uint8_t* blocks[SHA512_AVX2_LANES];
+
+    for (lane = 0; lane < SHA512_AVX2_LANES; lane++)
+    {
+        HMACSHA512Init(&keyed[lane], passphrases[lane],
+            passphrase_lengths[lane]);
+        pkcs5_pbkdf2_first(&keyed[lane], salts[lane], salt_lengths[lane], 1,
+            block[lane]);
+        memcpy(keys[lane], block[lane], HMACSHA512_DIGEST_LENGTH);
+        pkcs5_pbkdf2_pad(block[lane]);
+        states[lane] = state[lane];
+        blocks[lane] = block[lane];
+    }
+
+    for (iteration = 1; iteration < iterations; iteration++)
+    {
+        for (lane = 0; lane < SHA512_AVX2_LANES; lane++)
+            memcpy(state[lane], keyed[lane].ictx.state, sizeof(state[lane]));
+
+        SHA512TransformAvx2(states, blocks);
+
+        for (lane = 0; lane < SHA512_AVX2_LANES; lane++)
+        {
+            be64enc_vect(block[lane], state[lane], HMACSHA512_DIGEST_LENGTH);
+            memcpy(state[lane], keyed[lane].octx.state, sizeof(state[lane]));
+        }
+
+        SHA512TransformAvx2(states, blocks);
+
+        for (lane = 0; lane < SHA512_AVX2_LANES; lane++)
+        {
+            be64enc_vect(block[lane], state[lane], HMACSHA512_DIGEST_LENGTH);
+
+            for (index = 0; index < HMACSHA512_DIGEST_LENGTH; index++)
+                keys[lane][index] ^= block[lane][index];
+        }
+    }
+
+    zeroize(keyed, sizeof(keyed));
+    zeroize(state, sizeof(state));
+    zeroize(block, sizeof(block));
+}
+
+#endif
+
+void pkcs5_pbkdf2_batch(const uint8_t* const passphrases[],
+    const size_t passphrase_lengths[], const uint8_t* const salts[],
+    const size_t salt_lengths[], size_t count,
+    uint8_t keys[][HMACSHA512_DIGEST_LENGTH], size_t iterations)
+{
+    size_t next = 0;
+
+#ifdef SHA512_X86
+    if (SHA512Avx2Supported())
+        for (; next + SHA512_AVX2_LANES <= count; next += SHA512_AVX2_LANES)
+            pkcs5_pbkdf2_lanes(passphrases + next, passphrase_lengths + next,
+                salts + next, salt_lengths + next, keys + next, iterations);
+#endif
+
+    for (; next < count; ++next)
+        pkcs5_pbkdf2(passphrases[next], passphrase_lengths[next], salts[next],
+            salt_lengths[next], keys[next], HMACSHA512_DIGEST_LENGTH,
+            iterations);
+}
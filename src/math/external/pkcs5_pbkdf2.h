@@ -19,7 +19,7 @@
 
 #include <stddef.h>
 #include <stdint.h>
-#include "pkcs5_pbkdf2.h"
+#include "hmac_sha512.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -33,6 +33,13 @@ int pkcs5_pbkdf2(const uint8_t* passphrase, size_t passphrase_length,
     const uint8_t* salt, size_t salt_length, uint8_t* key, size_t key_length,
     size_t iterations);
 
+/* Derive one 64 byte key for each of count passphrase and salt pairs. */
+/* Passphrases are processed four at a time with AVX2 where supported. */
+void pkcs5_pbkdf2_batch(const uint8_t* const passphrases[],
+    const size_t passphrase_lengths[], const uint8_t* const salts[],
+    const size_t salt_lengths[], size_t count,
+    uint8_t keys[][HMACSHA512_DIGEST_LENGTH], size_t iterations);
+
 #ifdef __cplusplus
 }
 #endif
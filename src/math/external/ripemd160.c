@@ -8,6 +8,7 @@
 \********************************************************************/
 #include "ripemd160.h"
 
+#include "ripemd160_sse2.h"
 #include "zeroize.h"
 
 /* collect four bytes into one word: */
@@ -143,6 +144,76 @@ void RMDFinal(RMD160CTX* context, uint8_t digest[RMD160_DIGEST_LENGTH])
     }
 }
 
+/* Fixed length */
+
+/* Load a 32 byte message and its padding, which is the same for all. */
+static void RMDload32(uint32_t chunk[RMD160_CHUNK_LENGTH],
+    const uint8_t* message)
+{
+    size_t i;
+
+    for (i = 0; i < RMD160_HASH32_LENGTH / 4; i++)
+    {
+        chunk[i] = BYTES_TO_DWORD(message);
+        message += 4;
+    }
+
+    chunk[8] = 0x00000080UL;
+    chunk[9] = chunk[10] = chunk[11] = chunk[12] = chunk[13] = 0;
+    chunk[14] = RMD160_HASH32_LENGTH << 3;
+    chunk[15] = 0;
+}
+
+void RMD160Hash32(const uint8_t message[RMD160_HASH32_LENGTH],
+    uint8_t digest[RMD160_DIGEST_LENGTH])
+{
+    RMD160CTX context;
+    RMDInit(&context);
+    RMDload32(context.chunk, message);
+    RMDcompress(&context);
+    RMDFinal(&context, digest);
+}
+
+void RMD160Hash32Batch(const uint8_t* messages, size_t count,
+    uint8_t digests[][RMD160_DIGEST_LENGTH])
+{
+    size_t next = 0;
+
+#ifdef RMD160_SSE2
+    {
+        size_t lane;
+        RMD160CTX lanes[RMD160_SSE2_LANES];
+        uint32_t* states[RMD160_SSE2_LANES];
+        const uint32_t* chunks[RMD160_SSE2_LANES];
+
+        for (lane = 0; lane < RMD160_SSE2_LANES; ++lane)
+        {
+            states[lane] = lanes[lane].state;
+            chunks[lane] = lanes[lane].chunk;
+        }
+
+        /* Uniform lengths keep the lanes in step, so no refill is needed. */
+        for (; count - next >= RMD160_SSE2_LANES; next += RMD160_SSE2_LANES)
+        {
+            for (lane = 0; lane < RMD160_SSE2_LANES; ++lane)
+            {
+                RMDInit(&lanes[lane]);
+                RMDload32(lanes[lane].chunk, messages +
+                    (next + lane) * RMD160_HASH32_LENGTH);
+            }
+
+            RMD160TransformSse2(states, chunks);
+
+            for (lane = 0; lane < RMD160_SSE2_LANES; ++lane)
+                RMDFinal(&lanes[lane], digests[next + lane]);
+        }
+    }
+#endif
+
+    for (; next < count; ++next)
+        RMD160Hash32(messages + next * RMD160_HASH32_LENGTH, digests[next]);
+}
+
 /* Local */
 
 void RMDcompress(RMD160CTX* context)
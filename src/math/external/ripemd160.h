@@ -16,6 +16,11 @@
 #define RMD160_CHUNK_LENGTH 16U
 #define RMD160_BLOCK_LENGTH 64U
 #define RMD160_DIGEST_LENGTH 20U
+#define RMD160_HASH32_LENGTH 32U
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #define RMD160_SSE2
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -34,6 +39,14 @@ void RMDInit(RMD160CTX* context);
 void RMDUpdate(RMD160CTX* context, const uint8_t* message, size_t length);
 void RMDFinal(RMD160CTX* context, uint8_t digest[RMD160_DIGEST_LENGTH]);
 
+/* Hash a 32 byte message (sha256 digest) with fixed single block padding. */
+void RMD160Hash32(const uint8_t message[RMD160_HASH32_LENGTH],
+    uint8_t digest[RMD160_DIGEST_LENGTH]);
+
+/* Hash count contiguous 32 byte messages, interleaved if available. */
+void RMD160Hash32Batch(const uint8_t* messages, size_t count,
+    uint8_t digests[][RMD160_DIGEST_LENGTH]);
+
 #ifdef __cplusplus
 }
 #endif
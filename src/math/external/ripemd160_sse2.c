@@ -0,0 +1,177 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "ripemd160_sse2.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include "ripemd160.h"
+
+#ifdef RMD160_SSE2
+
+#include <emmintrin.h>
+
+/* Message word selection of the left and right lines. */
+static const uint8_t RL[80] =
+{
+     0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15,
+     7,  4, 13,  1, 10,  6, 15,  3, 12,  0,  9,  5,  2, 14, 11,  8,
+     3, 10, 14,  4,  9, 15,  8,  1,  2,  7,  0,  6, 13, 11,  5, 12,
+     1,  9, 11, 10,  0,  8, 12,  4, 13,  3,  7, 15, 14,  5,  6,  2,
+     4,  0,  5,  9,  7, 12,  2, 10, 14,  1,  3,  8, 11,  6, 15, 13
+};
+
+static const uint8_t RR[80] =
+{
+     5, 14,  7,  0,  9,  2, 11,  4, 13,  6, 15,  8,  1, 10,  3, 12,
+     6, 11,  3,  7,  0, 13,  5, 10, 14, 15,  8, 12,  4,  9,  1,  2,
+    15,  5,  1,  3,  7, 14,  6,  9, 11,  8, 12,  2, 10,  0,  4, 13,
+     8,  6,  4,  1,  3, 11, 15,  0,  5, 12,  2, 13,  9,  7, 10, 14,
+    12, 15, 10,  4,  1,  5,  8,  7,  6,  2, 13, 14,  0,  3,  9, 11
+};
+
+/* Rotation amounts of the left and right lines. */
+static const uint8_t SL[80] =
+{
+    11, 14, 15, 12,  5,  8,  7,  9, 11, 13, 14, 15,  6,  7,  9,  8,
+     7,  6,  8, 13, 11,  9,  7, 15,  7, 12, 15,  9, 11,  7, 13, 12,
+    11, 13,  6,  7, 14,  9, 13, 15, 14,  8, 13,  6,  5, 12,  7,  5,
+    11, 12, 14, 15, 14, 15,  9,  8,  9, 14,  5,  6,  8,  6,  5, 12,
+     9, 15,  5, 11,  6,  8, 13, 12,  5, 12, 13, 14, 11,  8,  5,  6
+};
+
+static const uint8_t SR[80] =
+{
+     8,  9,  9, 11, 13, 15, 15,  5,  7,  7,  8, 11, 14, 14, 12,  6,
+     9, 13, 15,  7, 12,  8,  9, 11,  7,  7, 12,  7,  6, 15, 13, 11,
+     9,  7, 15, 11,  8,  6,  6, 14, 12, 13,  5, 14, 13, 13,  7,  5,
+    15,  5,  8, 11, 14, 14,  6, 14,  6,  9, 12,  9, 12,  5, 15,  8,
+     8,  5, 12,  9, 12,  5, 14,  6,  8, 13,  6,  5, 15, 13, 11, 11
+};
+
+/* Round constants of the left and right lines. */
+static const uint32_t KL[5] =
+{
+    0x00000000UL, 0x5a827999UL, 0x6ed9eba1UL, 0x8f1bbcdcUL, 0xa953fd4eUL
+};
+
+static const uint32_t KR[5] =
+{
+    0x50a28be6UL, 0x5c4dd124UL, 0x6d703ef3UL, 0x7a6d76e9UL, 0x00000000UL
+};
+
+#define ADD(x, y)       _mm_add_epi32(x, y)
+#define AND(x, y)       _mm_and_si128(x, y)
+#define ANDNOT(x, y)    _mm_andnot_si128(x, y)
+#define OR(x, y)        _mm_or_si128(x, y)
+#define XOR(x, y)       _mm_xor_si128(x, y)
+#define NOT(x)          XOR(x, _mm_set1_epi32(-1))
+
+/* The rotation is variable, so shift counts are passed in registers. */
+static __m128i rol(__m128i x, int n)
+{
+    return OR(_mm_sll_epi32(x, _mm_cvtsi32_si128(n)),
+        _mm_srl_epi32(x, _mm_cvtsi32_si128(32 - n)));
+}
+
+/* The five basic functions, by round, as used by the left line. */
+static __m128i f(int round, __m128i x, __m128i y, __m128i z)
+{
+    switch (round)
+    {
+        case 0:
+            return XOR(XOR(x, y), z);
+        case 1:
+            return OR(AND(x, y), ANDNOT(x, z));
+        case 2:
+            return XOR(OR(x, NOT(y)), z);
+        case 3:
+            return OR(AND(x, z), ANDNOT(z, y));
+        default:
+            return XOR(x, OR(y, NOT(z)));
+    }
+}
+
+static __m128i gather(uint32_t* const states[RMD160_SSE2_LANES], size_t word)
+{
+    return _mm_set_epi32(
+        (int)states[3][word], (int)states[2][word],
+        (int)states[1][word], (int)states[0][word]);
+}
+
+void RMD160TransformSse2(uint32_t* const states[RMD160_SSE2_LANES],
+    const uint32_t* const chunks[RMD160_SSE2_LANES])
+{
+    int i, lane, word;
+    __m128i X[RMD160_CHUNK_LENGTH];
+    __m128i L[RMD160_STATE_LENGTH];
+    __m128i R[RMD160_STATE_LENGTH];
+    __m128i S[RMD160_STATE_LENGTH];
+    __m128i t;
+    uint32_t out[RMD160_SSE2_LANES];
+
+    for (word = 0; word < (int)RMD160_CHUNK_LENGTH; ++word)
+        X[word] = _mm_set_epi32(
+            (int)chunks[3][word], (int)chunks[2][word],
+            (int)chunks[1][word], (int)chunks[0][word]);
+
+    for (word = 0; word < (int)RMD160_STATE_LENGTH; ++word)
+        S[word] = L[word] = R[word] = gather(states, word);
+
+    for (i = 0; i < 80; ++i)
+    {
+        const int round = i / 16;
+
+        t = ADD(ADD(L[0], f(round, L[1], L[2], L[3])),
+            ADD(X[RL[i]], _mm_set1_epi32((int)KL[round])));
+        t = ADD(rol(t, SL[i]), L[4]);
+        L[0] = L[4];
+        L[4] = L[3];
+        L[3] = rol(L[2], 10);
+        L[2] = L[1];
+        L[1] = t;
+
+        /* The right line applies the functions in reverse order. */
+        t = ADD(ADD(R[0], f(4 - round, R[1], R[2], R[3])),
+            ADD(X[RR[i]], _mm_set1_epi32((int)KR[round])));
+        t = ADD(rol(t, SR[i]), R[4]);
+        R[0] = R[4];
+        R[4] = R[3];
+        R[3] = rol(R[2], 10);
+        R[2] = R[1];
+        R[1] = t;
+    }
+
+    /* Combine the lines, rotating the state words as does the scalar. */
+    t = ADD(ADD(S[1], L[2]), R[3]);
+    S[1] = ADD(ADD(S[2], L[3]), R[4]);
+    S[2] = ADD(ADD(S[3], L[4]), R[0]);
+    S[3] = ADD(ADD(S[4], L[0]), R[1]);
+    S[4] = ADD(ADD(S[0], L[1]), R[2]);
+    S[0] = t;
+
+    for (word = 0; word < (int)RMD160_STATE_LENGTH; ++word)
+    {
+        _mm_storeu_si128((__m128i*)out, S[word]);
+
+        for (lane = 0; lane < (int)RMD160_SSE2_LANES; ++lane)
+            states[lane][word] = out[lane];
+    }
+}
+
+#endif
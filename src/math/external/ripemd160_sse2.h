@@ -0,0 +1,41 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_RIPEMD160_SSE2_H
+#define LIBBITCOIN_RIPEMD160_SSE2_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "ripemd160.h"
+
+#ifdef __cplusplus
+extern "C" 
+{
+#endif
+
+#define RMD160_SSE2_LANES 4U
+
+/* SSE2 compression of one decoded chunk in each of four independent states. */
+void RMD160TransformSse2(uint32_t* const states[RMD160_SSE2_LANES],
+    const uint32_t* const chunks[RMD160_SSE2_LANES]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
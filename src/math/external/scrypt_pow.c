@@ -0,0 +1,226 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "scrypt_pow.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "cpu_features.h"
+#include "crypto_scrypt.h"
+#include "hmac_sha256.h"
+#include "scrypt_pow_avx2.h"
+#include "scrypt_pow_sse2.h"
+#include "sha256.h"
+
+#define SCRYPT_POW_BLOCK_LENGTH (SCRYPT_POW_BLOCK_WORDS * 4U)
+
+typedef void(*ScryptPowMixFunction)(uint32_t* const blocks[],
+    uint32_t* scratch);
+
+static ScryptPowMixFunction ScryptPowInitialize(void);
+
+/* The selection is idempotent and only the final mix is stored, so a race
+ * between initializing threads is benign. Without a multiple lane mix each
+ * hash uses the smix of crypto_scrypt. The selection is repeated if the
+ * enabled processor features change. */
+static volatile int initialized = 0;
+static volatile ScryptPowMixFunction selected = NULL;
+
+static uint32_t le32dec(const uint8_t* p)
+{
+    return ((uint32_t)(p[0]) + ((uint32_t)(p[1]) << 8) +
+        ((uint32_t)(p[2]) << 16) + ((uint32_t)(p[3]) << 24));
+}
+
+static void le32enc(uint8_t* p, uint32_t x)
+{
+    p[0] = x & 0xff;
+    p[1] = (x >> 8) & 0xff;
+    p[2] = (x >> 16) & 0xff;
+    p[3] = (x >> 24) & 0xff;
+}
+
+/* B <-- PBKDF2(input, input, 1, 128), and the HMAC key for the final step.
+ * The inner hash of the input is shared by the four blocks of B. */
+static void ScryptPowExpand(const uint8_t input[SCRYPT_POW_INPUT_LENGTH],
+    HMACSHA256CTX* key, uint8_t B[SCRYPT_POW_BLOCK_LENGTH])
+{
+    HMACSHA256CTX salted;
+    HMACSHA256CTX context;
+    uint8_t counter[4] = { 0, 0, 0, 0 };
+    size_t block;
+
+    HMACSHA256Init(key, input, SCRYPT_POW_INPUT_LENGTH);
+    salted = *key;
+    HMACSHA256Update(&salted, input, SCRYPT_POW_INPUT_LENGTH);
+
+    for (block = 0; block < SCRYPT_POW_BLOCK_LENGTH / 32U; ++block)
+    {
+        counter[3] = (uint8_t)(block + 1);
+        context = salted;
+        HMACSHA256Update(&context, counter, sizeof(counter));
+        HMACSHA256Final(&context, &B[block * 32U]);
+    }
+}
+
+/* DK <-- PBKDF2(input, B, 1, 32), with the HMAC key of the input. */
+static void ScryptPowCompress(const HMACSHA256CTX* key,
+    const uint8_t B[SCRYPT_POW_BLOCK_LENGTH],
+    uint8_t digest[SCRYPT_POW_DIGEST_LENGTH])
+{
+    static const uint8_t counter[4] = { 0, 0, 0, 1 };
+    HMACSHA256CTX context = *key;
+    HMACSHA256Update(&context, B, SCRYPT_POW_BLOCK_LENGTH);
+    HMACSHA256Update(&context, counter, sizeof(counter));
+    HMACSHA256Final(&context, digest);
+}
+
+void ScryptPowHash(const uint8_t input[SCRYPT_POW_INPUT_LENGTH],
+    uint8_t digest[SCRYPT_POW_DIGEST_LENGTH], uint32_t* scratch)
+{
+    HMACSHA256CTX key;
+    uint8_t B[SCRYPT_POW_BLOCK_LENGTH];
+    uint8_t XY[2 * SCRYPT_POW_BLOCK_LENGTH];
+
+    ScryptPowExpand(input, &key, B);
+    crypto_scrypt_smix(B, 1, SCRYPT_POW_N, (uint8_t*)scratch, XY);
+    ScryptPowCompress(&key, B, digest);
+}
+
+static size_t ScryptPowMixLanes(ScryptPowMixFunction mix)
+{
+#if defined(SCRYPT_POW_X86)
+    if (mix == ScryptPowMixAvx2)
+        return SCRYPT_POW_AVX2_LANES;
+#endif
+#if defined(SCRYPT_POW_SSE2)
+    if (mix == ScryptPowMixSse2)
+        return SCRYPT_POW_SSE2_LANES;
+#endif
+    return 1;
+}
+
+size_t ScryptPowLanes(void)
+{
+    return ScryptPowMixLanes(ScryptPowInitialize());
+}
+
+const char* ScryptPowKernel(void)
+{
+    const ScryptPowMixFunction mix = ScryptPowInitialize();
+
+#if defined(SCRYPT_POW_X86)
+    if (mix == ScryptPowMixAvx2)
+        return "avx2";
+#endif
+#if defined(SCRYPT_POW_SSE2)
+    if (mix == ScryptPowMixSse2)
+        return "sse2";
+#endif
+    (void)mix;
+    return "portable";
+}
+
+/* Mix whole groups of lanes together, returning the number hashed. */
+static size_t ScryptPowHashGroups(ScryptPowMixFunction mix, size_t group,
+    const uint8_t* const inputs[], size_t count,
+    uint8_t digests[][SCRYPT_POW_DIGEST_LENGTH], uint32_t* scratch)
+{
+    HMACSHA256CTX keys[SCRYPT_POW_MAX_LANES];
+    uint8_t B[SCRYPT_POW_BLOCK_LENGTH];
+    uint32_t X[SCRYPT_POW_MAX_LANES][SCRYPT_POW_BLOCK_WORDS];
+    uint32_t* blocks[SCRYPT_POW_MAX_LANES];
+    size_t first, lane, word;
+
+    if (mix == NULL || group < 2)
+        return 0;
+
+    for (first = 0; first + group <= count; first += group)
+    {
+        for (lane = 0; lane < group; ++lane)
+        {
+            ScryptPowExpand(inputs[first + lane], &keys[lane], B);
+
+            for (word = 0; word < SCRYPT_POW_BLOCK_WORDS; ++word)
+                X[lane][word] = le32dec(&B[word * 4U]);
+
+            blocks[lane] = X[lane];
+        }
+
+        mix(blocks, scratch);
+
+        for (lane = 0; lane < group; ++lane)
+        {
+            for (word = 0; word < SCRYPT_POW_BLOCK_WORDS; ++word)
+                le32enc(&B[word * 4U], X[lane][word]);
+
+            ScryptPowCompress(&keys[lane], B, digests[first + lane]);
+        }
+    }
+
+    return first;
+}
+
+void ScryptPowHashBatch(const uint8_t* const inputs[], size_t count,
+    uint8_t digests[][SCRYPT_POW_DIGEST_LENGTH], uint32_t* scratch)
+{
+    const ScryptPowMixFunction mix = ScryptPowInitialize();
+    size_t done = ScryptPowHashGroups(mix, ScryptPowMixLanes(mix), inputs,
+        count, digests, scratch);
+
+#if defined(SCRYPT_POW_SSE2)
+    /* A remainder of the wider mix may fill the narrower, which is enabled
+     * whenever any mix is, and requires no more scratch. */
+    if (mix != NULL)
+        done += ScryptPowHashGroups(ScryptPowMixSse2, SCRYPT_POW_SSE2_LANES,
+            inputs + done, count - done, digests + done, scratch);
+#endif
+
+    for (; done < count; ++done)
+        ScryptPowHash(inputs[done], digests[done], scratch);
+}
+
+/* Local */
+
+/* Select the widest mix supported by the executing processor. */
+static ScryptPowMixFunction ScryptPowInitialize(void)
+{
+    ScryptPowMixFunction mix = NULL;
+    uint32_t features;
+
+    if (initialized == CPUFeaturesGeneration())
+        return selected;
+
+    features = CPUFeatures();
+
+#if defined(SCRYPT_POW_SSE2)
+    if (features & CPU_FEATURE_SSE2)
+        mix = ScryptPowMixSse2;
+#endif
+
+#if defined(SCRYPT_POW_X86)
+    if (features & CPU_FEATURE_AVX2)
+        mix = ScryptPowMixAvx2;
+#endif
+
+    (void)features;
+    selected = mix;
+    initialized = CPUFeaturesGeneration();
+    return mix;
+}
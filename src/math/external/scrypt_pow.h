@@ -0,0 +1,70 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SCRYPT_POW_H
+#define LIBBITCOIN_SCRYPT_POW_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#if defined(__x86_64__) || defined(__i386__) || \
+    defined(_M_X64) || defined(_M_IX86)
+    #define SCRYPT_POW_X86
+#endif
+
+/* SSE2 is part of the x86-64 baseline, and may be enabled for x86. */
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define SCRYPT_POW_SSE2
+#endif
+
+#define SCRYPT_POW_INPUT_LENGTH 80U
+#define SCRYPT_POW_DIGEST_LENGTH 32U
+#define SCRYPT_POW_N 1024U
+#define SCRYPT_POW_BLOCK_WORDS 32U
+#define SCRYPT_POW_MAX_LANES 8U
+
+/* The scratch words of one lane, N blocks of 128 bytes. */
+#define SCRYPT_POW_SCRATCH_WORDS (SCRYPT_POW_N * SCRYPT_POW_BLOCK_WORDS)
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* scrypt(input, input, N=1024, r=1, p=1) of an 80 byte header, the proof of
+ * work hash of scrypt networks. The scratch is SCRYPT_POW_SCRATCH_WORDS. */
+void ScryptPowHash(const uint8_t input[SCRYPT_POW_INPUT_LENGTH],
+    uint8_t digest[SCRYPT_POW_DIGEST_LENGTH], uint32_t* scratch);
+
+/* The lanes mixed together by the batch on the executing processor. */
+size_t ScryptPowLanes(void);
+
+/* The name of the selected mix, for diagnostics. */
+const char* ScryptPowKernel(void);
+
+/* Hash count 80 byte headers, mixing ScryptPowLanes() of them together.
+ * The scratch is ScryptPowLanes() * SCRYPT_POW_SCRATCH_WORDS. */
+void ScryptPowHashBatch(const uint8_t* const inputs[], size_t count,
+    uint8_t digests[][SCRYPT_POW_DIGEST_LENGTH], uint32_t* scratch);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
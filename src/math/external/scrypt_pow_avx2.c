@@ -0,0 +1,154 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "scrypt_pow_avx2.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include "scrypt_pow.h"
+
+#ifdef SCRYPT_POW_X86
+
+#include <immintrin.h>
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define SCRYPT_POW_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+    #define SCRYPT_POW_TARGET_AVX2
+#endif
+
+#define LANES SCRYPT_POW_AVX2_LANES
+#define WORDS SCRYPT_POW_BLOCK_WORDS
+
+/* Each vector holds the same word of every lane, so the salsa20/8 of all
+ * lanes is the scalar algorithm over vectors. */
+#define ROTATE(x, s) _mm256_or_si256(_mm256_slli_epi32(x, s), \
+    _mm256_srli_epi32(x, 32 - (s)))
+#define STEP(t, a, b, s) t = _mm256_xor_si256(t, ROTATE(_mm256_add_epi32(a, b), s))
+
+/* B <-- salsa20/8(B xor Bx) */
+SCRYPT_POW_TARGET_AVX2
+static void xor_salsa8(__m256i B[16], const __m256i Bx[16])
+{
+    __m256i x[16];
+    size_t i;
+
+    for (i = 0; i < 16; ++i)
+        x[i] = B[i] = _mm256_xor_si256(B[i], Bx[i]);
+
+    for (i = 0; i < 8; i += 2)
+    {
+        /* Operate on columns. */
+        STEP(x[4], x[0], x[12], 7);
+        STEP(x[8], x[4], x[0], 9);
+        STEP(x[12], x[8], x[4], 13);
+        STEP(x[0], x[12], x[8], 18);
+        STEP(x[9], x[5], x[1], 7);
+        STEP(x[13], x[9], x[5], 9);
+        STEP(x[1], x[13], x[9], 13);
+        STEP(x[5], x[1], x[13], 18);
+        STEP(x[14], x[10], x[6], 7);
+        STEP(x[2], x[14], x[10], 9);
+        STEP(x[6], x[2], x[14], 13);
+        STEP(x[10], x[6], x[2], 18);
+        STEP(x[3], x[15], x[11], 7);
+        STEP(x[7], x[3], x[15], 9);
+        STEP(x[11], x[7], x[3], 13);
+        STEP(x[15], x[11], x[7], 18);
+
+        /* Operate on rows. */
+        STEP(x[1], x[0], x[3], 7);
+        STEP(x[2], x[1], x[0], 9);
+        STEP(x[3], x[2], x[1], 13);
+        STEP(x[0], x[3], x[2], 18);
+        STEP(x[6], x[5], x[4], 7);
+        STEP(x[7], x[6], x[5], 9);
+        STEP(x[4], x[7], x[6], 13);
+        STEP(x[5], x[4], x[7], 18);
+        STEP(x[11], x[10], x[9], 7);
+        STEP(x[8], x[11], x[10], 9);
+        STEP(x[9], x[8], x[11], 13);
+        STEP(x[10], x[9], x[8], 18);
+        STEP(x[12], x[15], x[14], 7);
+        STEP(x[13], x[12], x[15], 9);
+        STEP(x[14], x[13], x[12], 13);
+        STEP(x[15], x[14], x[13], 18);
+    }
+
+    for (i = 0; i < 16; ++i)
+        B[i] = _mm256_add_epi32(B[i], x[i]);
+}
+
+#undef STEP
+#undef ROTATE
+
+/* V is interleaved by lane, so each word of a block is one vector. */
+SCRYPT_POW_TARGET_AVX2
+void ScryptPowMixAvx2(uint32_t* const blocks[LANES], uint32_t* scratch)
+{
+    __m256i X[WORDS];
+    __m256i* V = (__m256i*)scratch;
+    size_t i, word;
+
+    for (word = 0; word < WORDS; ++word)
+        X[word] = _mm256_set_epi32((int)blocks[7][word],
+            (int)blocks[6][word], (int)blocks[5][word], (int)blocks[4][word],
+            (int)blocks[3][word], (int)blocks[2][word], (int)blocks[1][word],
+            (int)blocks[0][word]);
+
+    /* V_i <-- X, X <-- H(X) */
+    for (i = 0; i < SCRYPT_POW_N; ++i)
+    {
+        for (word = 0; word < WORDS; ++word)
+            _mm256_storeu_si256(&V[i * WORDS + word], X[word]);
+
+        xor_salsa8(&X[0], &X[16]);
+        xor_salsa8(&X[16], &X[0]);
+    }
+
+    const __m256i mask = _mm256_set1_epi32((int)(SCRYPT_POW_N - 1));
+    const __m256i lane = _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+
+    /* X <-- H(X xor V_j), with j <-- Integerify(X) mod N in each lane. */
+    for (i = 0; i < SCRYPT_POW_N; ++i)
+    {
+        /* Gather word w of V_j in each lane at (j * WORDS + w) * LANES. */
+        const __m256i index = _mm256_add_epi32(_mm256_slli_epi32(
+            _mm256_and_si256(X[16], mask), 8), lane);
+
+        for (word = 0; word < WORDS; ++word)
+            X[word] = _mm256_xor_si256(X[word],
+                _mm256_i32gather_epi32((const int*)&scratch[word * LANES],
+                index, 4));
+
+        xor_salsa8(&X[0], &X[16]);
+        xor_salsa8(&X[16], &X[0]);
+    }
+
+    for (word = 0; word < WORDS; ++word)
+    {
+        uint32_t lanes[LANES];
+        size_t lane;
+        _mm256_storeu_si256((__m256i*)lanes, X[word]);
+
+        for (lane = 0; lane < LANES; ++lane)
+            blocks[lane][word] = lanes[lane];
+    }
+}
+
+#endif
@@ -0,0 +1,146 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "scrypt_pow_sse2.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include "scrypt_pow.h"
+
+#ifdef SCRYPT_POW_SSE2
+
+#include <emmintrin.h>
+
+#define LANES SCRYPT_POW_SSE2_LANES
+#define WORDS SCRYPT_POW_BLOCK_WORDS
+
+/* Each vector holds the same word of every lane, so the salsa20/8 of all
+ * lanes is the scalar algorithm over vectors. */
+#define ROTATE(x, s) _mm_or_si128(_mm_slli_epi32(x, s), \
+    _mm_srli_epi32(x, 32 - (s)))
+#define STEP(t, a, b, s) t = _mm_xor_si128(t, ROTATE(_mm_add_epi32(a, b), s))
+
+/* B <-- salsa20/8(B xor Bx) */
+static void xor_salsa8(__m128i B[16], const __m128i Bx[16])
+{
+    __m128i x[16];
+    size_t i;
+
+    for (i = 0; i < 16; ++i)
+        x[i] = B[i] = _mm_xor_si128(B[i], Bx[i]);
+
+    for (i = 0; i < 8; i += 2)
+    {
+        /* Operate on columns. */
+        STEP(x[4], x[0], x[12], 7);
+        STEP(x[8], x[4], x[0], 9);
+        STEP(x[12], x[8], x[4], 13);
+        STEP(x[0], x[12], x[8], 18);
+        STEP(x[9], x[5], x[1], 7);
+        STEP(x[13], x[9], x[5], 9);
+        STEP(x[1], x[13], x[9], 13);
+        STEP(x[5], x[1], x[13], 18);
+        STEP(x[14], x[10], x[6], 7);
+        STEP(x[2], x[14], x[10], 9);
+        STEP(x[6], x[2], x[14], 13);
+        STEP(x[10], x[6], x[2], 18);
+        STEP(x[3], x[15], x[11], 7);
+        STEP(x[7], x[3], x[15], 9);
+        STEP(x[11], x[7], x[3], 13);
+        STEP(x[15], x[11], x[7], 18);
+
+        /* Operate on rows. */
+        STEP(x[1], x[0], x[3], 7);
+        STEP(x[2], x[1], x[0], 9);
+        STEP(x[3], x[2], x[1], 13);
+        STEP(x[0], x[3], x[2], 18);
+        STEP(x[6], x[5], x[4], 7);
+        STEP(x[7], x[6], x[5], 9);
+        STEP(x[4], x[7], x[6], 13);
+        STEP(x[5], x[4], x[7], 18);
+        STEP(x[11], x[10], x[9], 7);
+        STEP(x[8], x[11], x[10], 9);
+        STEP(x[9], x[8], x[11], 13);
+        STEP(x[10], x[9], x[8], 18);
+        STEP(x[12], x[15], x[14], 7);
+        STEP(x[13], x[12], x[15], 9);
+        STEP(x[14], x[13], x[12], 13);
+        STEP(x[15], x[14], x[13], 18);
+    }
+
+    for (i = 0; i < 16; ++i)
+        B[i] = _mm_add_epi32(B[i], x[i]);
+}
+
+#undef STEP
+#undef ROTATE
+
+/* V is interleaved by lane, so each word of a block is one vector. */
+void ScryptPowMixSse2(uint32_t* const blocks[LANES], uint32_t* scratch)
+{
+    __m128i X[WORDS];
+    __m128i* V = (__m128i*)scratch;
+    size_t i, word;
+
+    for (word = 0; word < WORDS; ++word)
+        X[word] = _mm_set_epi32((int)blocks[3][word], (int)blocks[2][word],
+            (int)blocks[1][word], (int)blocks[0][word]);
+
+    /* V_i <-- X, X <-- H(X) */
+    for (i = 0; i < SCRYPT_POW_N; ++i)
+    {
+        for (word = 0; word < WORDS; ++word)
+            _mm_storeu_si128(&V[i * WORDS + word], X[word]);
+
+        xor_salsa8(&X[0], &X[16]);
+        xor_salsa8(&X[16], &X[0]);
+    }
+
+    /* X <-- H(X xor V_j), with j <-- Integerify(X) mod N in each lane. */
+    for (i = 0; i < SCRYPT_POW_N; ++i)
+    {
+        uint32_t j[LANES];
+        const uint32_t* v[LANES];
+        size_t lane;
+        _mm_storeu_si128((__m128i*)j, X[16]);
+
+        for (lane = 0; lane < LANES; ++lane)
+            v[lane] = &scratch[(j[lane] & (SCRYPT_POW_N - 1)) * WORDS * LANES +
+                lane];
+
+        for (word = 0; word < WORDS; ++word)
+            X[word] = _mm_xor_si128(X[word], _mm_set_epi32(
+                (int)v[3][word * LANES], (int)v[2][word * LANES],
+                (int)v[1][word * LANES], (int)v[0][word * LANES]));
+
+        xor_salsa8(&X[0], &X[16]);
+        xor_salsa8(&X[16], &X[0]);
+    }
+
+    for (word = 0; word < WORDS; ++word)
+    {
+        uint32_t lanes[LANES];
+        _mm_storeu_si128((__m128i*)lanes, X[word]);
+        blocks[0][word] = lanes[0];
+        blocks[1][word] = lanes[1];
+        blocks[2][word] = lanes[2];
+        blocks[3][word] = lanes[3];
+    }
+}
+
+#endif
@@ -0,0 +1,42 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SCRYPT_POW_SSE2_H
+#define LIBBITCOIN_SCRYPT_POW_SSE2_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "scrypt_pow.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define SCRYPT_POW_SSE2_LANES 4U
+
+/* SSE2 mix of the 32 word block of each of four independent hashes, with
+ * SCRYPT_POW_SSE2_LANES * SCRYPT_POW_SCRATCH_WORDS of scratch. */
+void ScryptPowMixSse2(uint32_t* const blocks[SCRYPT_POW_SSE2_LANES],
+    uint32_t* scratch);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
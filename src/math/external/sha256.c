@@ -27,6 +27,10 @@
 
 #include <stdint.h>
 #include <string.h>
+#include "cpu_features.h"
+#include "sha256_arm.h"
+#include "sha256_avx2.h"
+#include "sha256_shani.h"
 #include "zeroize.h"
 
 static uint32_t be32dec(const void* pp)
@@ -95,9 +99,58 @@ static unsigned char PAD[SHA256_BLOCK_LENGTH] =
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
 };
 
+/* The padding block that completes a 64 byte (512 bit) message. */
+static const uint8_t PAD64[SHA256_BLOCK_LENGTH] =
+{
+    0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x02, 0x00
+};
+
+/* The padding that completes a 32 byte (256 bit) message in one block. */
+static const uint8_t PAD32[SHA256_BLOCK_LENGTH - SHA256_DIGEST_LENGTH] =
+{
+    0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01, 0x00
+};
+
+static const uint32_t IV[SHA256_STATE_LENGTH] =
+{
+    0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A,
+    0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19
+};
+
+typedef void (*SHA256TransformFunction)(uint32_t state[SHA256_STATE_LENGTH],
+    const uint8_t* blocks, size_t count);
+
+typedef struct SHA256Lane
+{
+    uint32_t state[SHA256_STATE_LENGTH];
+    const uint8_t* input;
+    size_t blocks;
+    const uint8_t* pad;
+    size_t pads;
+    uint8_t padding[2 * SHA256_BLOCK_LENGTH];
+    uint8_t* digest;
+} SHA256Lane;
+
 void SHA256Pad(SHA256CTX* context);
 void SHA256Transform(uint32_t state[SHA256_STATE_LENGTH],
     const uint8_t block[SHA256_BLOCK_LENGTH]);
+static void SHA256TransformBlocks(uint32_t state[SHA256_STATE_LENGTH],
+    const uint8_t* blocks, size_t count);
+static void SHA256Initialize(void);
+
+/* The selection is idempotent, and each candidate is a valid transform, so a
+ * race between initializing threads is benign. It is repeated if the enabled
+ * processor features change. */
+static volatile int initialized = 0;
+static volatile SHA256TransformFunction transform = SHA256TransformBlocks;
+
+#ifdef SHA256_X86
+static volatile int multiple_lanes = 0;
+#endif
 
 void SHA256_(const uint8_t* input, size_t length,
     uint8_t digest[SHA256_DIGEST_LENGTH])
@@ -108,8 +161,28 @@ void SHA256_(const uint8_t* input, size_t length,
     SHA256Final(&context, digest);
 }
 
+void SHA256Block(const uint8_t* input, size_t length,
+    uint8_t digest[SHA256_DIGEST_LENGTH])
+{
+    uint32_t state[SHA256_STATE_LENGTH];
+    uint8_t block[SHA256_BLOCK_LENGTH];
+
+    SHA256Initialize();
+
+    memset(block, 0, sizeof block);
+    memcpy(block, input, length);
+    block[length] = 0x80;
+    be32enc(block + SHA256_BLOCK_LENGTH - 4, (uint32_t)(length << 3));
+
+    memcpy(state, IV, sizeof state);
+    transform(state, block, 1);
+    be32enc_vect(digest, state, SHA256_DIGEST_LENGTH);
+}
+
 void SHA256Init(SHA256CTX* context)
 {
+    SHA256Initialize();
+
     context->count[0] = context->count[1] = 0;
 
     context->state[0] = 0x6A09E667;
@@ -144,16 +217,16 @@ void SHA256Update(SHA256CTX* context, const uint8_t* input, size_t length)
     }
 
     memcpy(&context->buf[r], input, 64 - r);
-    SHA256Transform(context->state, context->buf);
+    transform(context->state, context->buf, 1);
 
     input += 64 - r;
     length -= 64 - r;
 
-    while (length >= 64)
+    if (length >= 64)
     {
-        SHA256Transform(context->state, input);
-        input += 64;
-        length -= 64;
+        transform(context->state, input, length / 64);
+        input += length & ~(size_t)63;
+        length &= 63;
     }
 
     memcpy(context->buf, input, length);
@@ -166,8 +239,371 @@ void SHA256Final(SHA256CTX* context, uint8_t digest[SHA256_DIGEST_LENGTH])
     zeroize((void*)context, sizeof *context);
 }
 
+/* Batch */
+
+static void SHA256LaneLoad(SHA256Lane* lane, const uint8_t* input,
+    size_t length, uint8_t* digest)
+{
+    const size_t r = length % SHA256_BLOCK_LENGTH;
+    const uint64_t bits = (uint64_t)length << 3;
+    uint8_t* end;
+
+    lane->input = input;
+    lane->blocks = length / SHA256_BLOCK_LENGTH;
+    lane->pad = lane->padding;
+    lane->pads = (r < 56) ? 1 : 2;
+    lane->digest = digest;
+
+    memset(lane->padding, 0, sizeof lane->padding);
+
+    if (r != 0)
+        memcpy(lane->padding, input + length - r, r);
+
+    lane->padding[r] = 0x80;
+    end = lane->padding + lane->pads * SHA256_BLOCK_LENGTH;
+    be32enc(end - 8, (uint32_t)(bits >> 32));
+    be32enc(end - 4, (uint32_t)bits);
+
+    memcpy(lane->state, IV, sizeof IV);
+}
+
+static const uint8_t* SHA256LaneBlock(const SHA256Lane* lane)
+{
+    return lane->blocks != 0 ? lane->input : lane->pad;
+}
+
+/* Advance past the current block, returns nonzero when the lane is done. */
+static int SHA256LaneNext(SHA256Lane* lane)
+{
+    if (lane->blocks != 0)
+    {
+        lane->input += SHA256_BLOCK_LENGTH;
+        lane->blocks--;
+    }
+    else
+    {
+        lane->pad += SHA256_BLOCK_LENGTH;
+        lane->pads--;
+    }
+
+    return lane->blocks == 0 && lane->pads == 0;
+}
+
+static void SHA256LaneFinish(SHA256Lane* lane)
+{
+    transform(lane->state, lane->input, lane->blocks);
+    transform(lane->state, lane->pad, lane->pads);
+    be32enc_vect(lane->digest, lane->state, SHA256_DIGEST_LENGTH);
+}
+
+void SHA256Batch(const uint8_t* const inputs[], const size_t lengths[],
+    size_t count, uint8_t digests[][SHA256_DIGEST_LENGTH])
+{
+    size_t next = 0;
+
+    SHA256Initialize();
+
+#ifdef SHA256_X86
+    if (multiple_lanes && count >= SHA256_AVX2_LANES)
+    {
+        size_t lane;
+        int exhausted = 0;
+        int done[SHA256_AVX2_LANES];
+        uint32_t* states[SHA256_AVX2_LANES];
+        const uint8_t* blocks[SHA256_AVX2_LANES];
+        SHA256Lane lanes[SHA256_AVX2_LANES];
+
+        for (lane = 0; lane < SHA256_AVX2_LANES; ++lane, ++next)
+        {
+            SHA256LaneLoad(&lanes[lane], inputs[next], lengths[next],
+                digests[next]);
+            states[lane] = lanes[lane].state;
+            done[lane] = 0;
+        }
+
+        /* Refill each lane as it completes, until the messages run out. */
+        while (!exhausted)
+        {
+            for (lane = 0; lane < SHA256_AVX2_LANES; ++lane)
+                blocks[lane] = SHA256LaneBlock(&lanes[lane]);
+
+            SHA256TransformAvx2(states, blocks);
+
+            for (lane = 0; lane < SHA256_AVX2_LANES; ++lane)
+            {
+                if (!SHA256LaneNext(&lanes[lane]))
+                    continue;
+
+                be32enc_vect(lanes[lane].digest, lanes[lane].state,
+                    SHA256_DIGEST_LENGTH);
+
+                if (next < count)
+                {
+                    SHA256LaneLoad(&lanes[lane], inputs[next],
+                        lengths[next], digests[next]);
+                    ++next;
+                }
+                else
+                {
+                    done[lane] = 1;
+                    exhausted = 1;
+                }
+            }
+        }
+
+        /* Lanes cannot be filled, so complete the remainder individually. */
+        for (lane = 0; lane < SHA256_AVX2_LANES; ++lane)
+            if (!done[lane])
+                SHA256LaneFinish(&lanes[lane]);
+
+        zeroize((void*)lanes, sizeof lanes);
+    }
+#endif
+
+    for (; next < count; ++next)
+        SHA256_(inputs[next], lengths[next], digests[next]);
+}
+
+/* Merkle */
+
+void SHA256Double64(const uint8_t input[2 * SHA256_DIGEST_LENGTH],
+    uint8_t digest[SHA256_DIGEST_LENGTH])
+{
+    uint32_t state[SHA256_STATE_LENGTH];
+    uint8_t block[SHA256_BLOCK_LENGTH];
+
+    SHA256Initialize();
+
+    memcpy(state, IV, sizeof state);
+    transform(state, input, 1);
+    transform(state, PAD64, 1);
+
+    be32enc_vect(block, state, SHA256_DIGEST_LENGTH);
+    memcpy(block + SHA256_DIGEST_LENGTH, PAD32, sizeof PAD32);
+
+    memcpy(state, IV, sizeof state);
+    transform(state, block, 1);
+    be32enc_vect(digest, state, SHA256_DIGEST_LENGTH);
+}
+
+void SHA256Double64Batch(const uint8_t* inputs, size_t count,
+    uint8_t digests[][SHA256_DIGEST_LENGTH])
+{
+    size_t next = 0;
+
+    SHA256Initialize();
+
+#ifdef SHA256_X86
+    if (multiple_lanes)
+    {
+        size_t lane;
+        uint32_t state[SHA256_AVX2_LANES][SHA256_STATE_LENGTH];
+        uint8_t second[SHA256_AVX2_LANES][SHA256_BLOCK_LENGTH];
+        uint32_t* states[SHA256_AVX2_LANES];
+        const uint8_t* blocks[SHA256_AVX2_LANES];
+
+        for (lane = 0; lane < SHA256_AVX2_LANES; ++lane)
+            states[lane] = state[lane];
+
+        /* Uniform lengths keep the lanes in step, so no refill is needed. */
+        for (; count - next >= SHA256_AVX2_LANES; next += SHA256_AVX2_LANES)
+        {
+            for (lane = 0; lane < SHA256_AVX2_LANES; ++lane)
+            {
+                memcpy(state[lane], IV, sizeof IV);
+                blocks[lane] = inputs + (next + lane) * 2 *
+                    SHA256_DIGEST_LENGTH;
+            }
+
+            SHA256TransformAvx2(states, blocks);
+
+            for (lane = 0; lane < SHA256_AVX2_LANES; ++lane)
+                blocks[lane] = PAD64;
+
+            SHA256TransformAvx2(states, blocks);
+
+            for (lane = 0; lane < SHA256_AVX2_LANES; ++lane)
+            {
+                be32enc_vect(second[lane], state[lane], SHA256_DIGEST_LENGTH);
+                memcpy(second[lane] + SHA256_DIGEST_LENGTH, PAD32,
+                    sizeof PAD32);
+                memcpy(state[lane], IV, sizeof IV);
+                blocks[lane] = second[lane];
+            }
+
+            SHA256TransformAvx2(states, blocks);
+
+            for (lane = 0; lane < SHA256_AVX2_LANES; ++lane)
+                be32enc_vect(digests[next + lane], state[lane],
+                    SHA256_DIGEST_LENGTH);
+        }
+    }
+#endif
+
+    for (; next < count; ++next)
+        SHA256Double64(inputs + next * 2 * SHA256_DIGEST_LENGTH,
+            digests[next]);
+}
+
+/* Nonce */
+
+void SHA256Midstate(const uint8_t block[SHA256_BLOCK_LENGTH],
+    uint32_t state[SHA256_STATE_LENGTH])
+{
+    SHA256Initialize();
+
+    memcpy(state, IV, sizeof IV);
+    transform(state, block, 1);
+}
+
+/* The padded second block of an 80 byte message, without its nonce. */
+static void SHA256NonceBlock(uint8_t block[SHA256_BLOCK_LENGTH],
+    const uint8_t tail[SHA256_NONCE_TAIL_LENGTH])
+{
+    memset(block, 0, SHA256_BLOCK_LENGTH);
+    memcpy(block, tail, SHA256_NONCE_TAIL_LENGTH);
+    block[SHA256_NONCE_TAIL_LENGTH + 4] = 0x80;
+
+    /* The message is 640 bits. */
+    block[SHA256_BLOCK_LENGTH - 2] = 0x02;
+    block[SHA256_BLOCK_LENGTH - 1] = 0x80;
+}
+
+static void SHA256SetNonce(uint8_t block[SHA256_BLOCK_LENGTH], uint32_t nonce)
+{
+    block[SHA256_NONCE_TAIL_LENGTH + 0] = nonce & 0xff;
+    block[SHA256_NONCE_TAIL_LENGTH + 1] = (nonce >> 8) & 0xff;
+    block[SHA256_NONCE_TAIL_LENGTH + 2] = (nonce >> 16) & 0xff;
+    block[SHA256_NONCE_TAIL_LENGTH + 3] = (nonce >> 24) & 0xff;
+}
+
+void SHA256Double80Batch(const uint32_t midstate[SHA256_STATE_LENGTH],
+    const uint8_t tail[SHA256_NONCE_TAIL_LENGTH],
+    const uint32_t nonces[], size_t count,
+    uint8_t digests[][SHA256_DIGEST_LENGTH])
+{
+    size_t next = 0;
+    uint32_t state[SHA256_STATE_LENGTH];
+    uint8_t first[SHA256_BLOCK_LENGTH];
+    uint8_t second[SHA256_BLOCK_LENGTH];
+
+    SHA256Initialize();
+    SHA256NonceBlock(first, tail);
+
+#ifdef SHA256_X86
+    if (multiple_lanes)
+    {
+        size_t lane;
+        uint32_t states[SHA256_AVX2_LANES][SHA256_STATE_LENGTH];
+        uint8_t firsts[SHA256_AVX2_LANES][SHA256_BLOCK_LENGTH];
+        uint8_t seconds[SHA256_AVX2_LANES][SHA256_BLOCK_LENGTH];
+        uint32_t* lanes[SHA256_AVX2_LANES];
+        const uint8_t* blocks[SHA256_AVX2_LANES];
+
+        for (lane = 0; lane < SHA256_AVX2_LANES; ++lane)
+        {
+            lanes[lane] = states[lane];
+            memcpy(firsts[lane], first, sizeof first);
+            memcpy(seconds[lane] + SHA256_DIGEST_LENGTH, PAD32, sizeof PAD32);
+        }
+
+        /* Each lane resumes from the midstate with only its nonce changed. */
+        for (; count - next >= SHA256_AVX2_LANES; next += SHA256_AVX2_LANES)
+        {
+            for (lane = 0; lane < SHA256_AVX2_LANES; ++lane)
+            {
+                memcpy(states[lane], midstate, sizeof IV);
+                SHA256SetNonce(firsts[lane], nonces[next + lane]);
+                blocks[lane] = firsts[lane];
+            }
+
+            SHA256TransformAvx2(lanes, blocks);
+
+            for (lane = 0; lane < SHA256_AVX2_LANES; ++lane)
+            {
+                be32enc_vect(seconds[lane], states[lane],
+                    SHA256_DIGEST_LENGTH);
+                memcpy(states[lane], IV, sizeof IV);
+                blocks[lane] = seconds[lane];
+            }
+
+            SHA256TransformAvx2(lanes, blocks);
+
+            for (lane = 0; lane < SHA256_AVX2_LANES; ++lane)
+                be32enc_vect(digests[next + lane], states[lane],
+                    SHA256_DIGEST_LENGTH);
+        }
+    }
+#endif
+
+    memcpy(second + SHA256_DIGEST_LENGTH, PAD32, sizeof PAD32);
+
+    for (; next < count; ++next)
+    {
+        memcpy(state, midstate, sizeof IV);
+        SHA256SetNonce(first, nonces[next]);
+        transform(state, first, 1);
+
+        be32enc_vect(second, state, SHA256_DIGEST_LENGTH);
+        memcpy(state, IV, sizeof IV);
+        transform(state, second, 1);
+        be32enc_vect(digests[next], state, SHA256_DIGEST_LENGTH);
+    }
+}
+
 /* Local */
 
+/* Select the fastest transform supported by the executing processor. */
+static void SHA256Initialize(void)
+{
+    uint32_t features;
+
+    if (initialized == CPUFeaturesGeneration())
+        return;
+
+    features = CPUFeatures();
+    transform = SHA256TransformBlocks;
+
+#if defined(SHA256_X86)
+    /* Eight AVX2 lanes outperform SHA-NI for batches of messages. */
+    if ((features & CPU_FEATURE_SSSE3) && (features & CPU_FEATURE_SSE41) &&
+        (features & CPU_FEATURE_SHA_NI))
+        transform = SHA256TransformShani;
+
+    multiple_lanes = (features & CPU_FEATURE_AVX2) != 0;
+#elif defined(SHA256_ARM)
+    if (features & CPU_FEATURE_ARM_SHA2)
+        transform = SHA256TransformArm;
+#else
+    (void)features;
+#endif
+
+    initialized = CPUFeaturesGeneration();
+}
+
+const char* SHA256Kernel(void)
+{
+    SHA256Initialize();
+
+#if defined(SHA256_X86)
+    if (transform == SHA256TransformShani)
+        return multiple_lanes ? "shani+avx2" : "shani";
+
+    return multiple_lanes ? "portable+avx2" : "portable";
+#elif defined(SHA256_ARM)
+    return transform == SHA256TransformArm ? "arm" : "portable";
+#else
+    return "portable";
+#endif
+}
+
+static void SHA256TransformBlocks(uint32_t state[SHA256_STATE_LENGTH],
+    const uint8_t* blocks, size_t count)
+{
+    for (; count > 0; --count, blocks += SHA256_BLOCK_LENGTH)
+        SHA256Transform(state, blocks);
+}
+
 void SHA256Pad(SHA256CTX* context)
 {
     uint8_t len[8];
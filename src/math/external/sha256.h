@@ -33,6 +33,14 @@
 #define SHA256_COUNT_LENGTH 2U
 #define SHA256_BLOCK_LENGTH 64U
 #define SHA256_DIGEST_LENGTH 32U
+#define SHA256_NONCE_TAIL_LENGTH 12U
+
+#if defined(__x86_64__) || defined(__i386__) || \
+    defined(_M_X64) || defined(_M_IX86)
+    #define SHA256_X86
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+    #define SHA256_ARM
+#endif
 
 #ifdef __cplusplus
 extern "C" 
@@ -49,10 +57,43 @@ typedef struct SHA256CTX
 void SHA256_(const uint8_t* input, size_t length,
     uint8_t digest[SHA256_DIGEST_LENGTH]);
 
+/* Hash a message of no more than 55 bytes, padded into a single block. */
+void SHA256Block(const uint8_t* input, size_t length,
+    uint8_t digest[SHA256_DIGEST_LENGTH]);
+
 void SHA256Init(SHA256CTX* context);
 void SHA256Update(SHA256CTX* context, const uint8_t* input, size_t length);
 void SHA256Final(SHA256CTX* context, uint8_t digest[SHA256_DIGEST_LENGTH]);
 
+/* Hash independent messages, interleaved across SIMD lanes if available. */
+void SHA256Batch(const uint8_t* const inputs[], const size_t lengths[],
+    size_t count, uint8_t digests[][SHA256_DIGEST_LENGTH]);
+
+/* Double hash a 64 byte message (merkle tree node) with fixed padding. */
+void SHA256Double64(const uint8_t input[2 * SHA256_DIGEST_LENGTH],
+    uint8_t digest[SHA256_DIGEST_LENGTH]);
+
+/* Double hash count contiguous 64 byte messages, interleaved if available.
+ * Digests may overlap inputs at the same base, as digest i is written only
+ * after input i is consumed and never overlaps a later input. */
+void SHA256Double64Batch(const uint8_t* inputs, size_t count,
+    uint8_t digests[][SHA256_DIGEST_LENGTH]);
+
+/* The state after the first block of a message from the initial state. */
+void SHA256Midstate(const uint8_t block[SHA256_BLOCK_LENGTH],
+    uint32_t state[SHA256_STATE_LENGTH]);
+
+/* Double hash count 80 byte messages that differ only in their last four
+ * bytes (the nonce, little-endian), given the midstate of the first block
+ * and the twelve bytes that follow it. Interleaved if available. */
+void SHA256Double80Batch(const uint32_t midstate[SHA256_STATE_LENGTH],
+    const uint8_t tail[SHA256_NONCE_TAIL_LENGTH],
+    const uint32_t nonces[], size_t count,
+    uint8_t digests[][SHA256_DIGEST_LENGTH]);
+
+/* The name of the selected transform, for diagnostics. */
+const char* SHA256Kernel(void);
+
 #ifdef __cplusplus
 }
 #endif
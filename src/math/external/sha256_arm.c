@@ -0,0 +1,97 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "sha256_arm.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include "sha256.h"
+
+#ifdef SHA256_ARM
+
+#include <arm_neon.h>
+
+#if defined(__clang__)
+    #define SHA256_TARGET_ARM __attribute__((target("crypto")))
+#elif defined(__GNUC__)
+    #define SHA256_TARGET_ARM __attribute__((target("+crypto")))
+#else
+    #define SHA256_TARGET_ARM
+#endif
+
+static const uint32_t K[64] =
+{
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+    0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+    0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+    0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+    0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+    0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+SHA256_TARGET_ARM
+void SHA256TransformArm(uint32_t state[SHA256_STATE_LENGTH],
+    const uint8_t* blocks, size_t count)
+{
+    int j;
+    uint32x4_t W[4];
+    uint32x4_t abcd, efgh, save_abcd, save_efgh, message, tmp;
+
+    abcd = vld1q_u32(&state[0]);
+    efgh = vld1q_u32(&state[4]);
+
+    for (; count > 0; --count, blocks += SHA256_BLOCK_LENGTH)
+    {
+        save_abcd = abcd;
+        save_efgh = efgh;
+
+        for (j = 0; j < 16; ++j)
+        {
+            /* W[j & 3] holds the previous four message words of group j. */
+            if (j < 4)
+                W[j] = vreinterpretq_u32_u8(vrev32q_u8(
+                    vld1q_u8(blocks + 16 * j)));
+            else
+                W[j & 3] = vsha256su1q_u32(vsha256su0q_u32(W[j & 3],
+                    W[(j + 1) & 3]), W[(j + 2) & 3], W[(j + 3) & 3]);
+
+            message = vaddq_u32(W[j & 3], vld1q_u32(&K[4 * j]));
+            tmp = abcd;
+            abcd = vsha256hq_u32(abcd, efgh, message);
+            efgh = vsha256h2q_u32(efgh, tmp, message);
+        }
+
+        abcd = vaddq_u32(abcd, save_abcd);
+        efgh = vaddq_u32(efgh, save_efgh);
+    }
+
+    vst1q_u32(&state[0], abcd);
+    vst1q_u32(&state[4], efgh);
+}
+
+#endif
@@ -0,0 +1,39 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SHA256_ARM_H
+#define LIBBITCOIN_SHA256_ARM_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "sha256.h"
+
+#ifdef __cplusplus
+extern "C" 
+{
+#endif
+
+/* ARMv8 cryptography extensions transform, requires SHA2. */
+void SHA256TransformArm(uint32_t state[SHA256_STATE_LENGTH],
+    const uint8_t* blocks, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,143 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "sha256_avx2.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "sha256.h"
+
+#ifdef SHA256_X86
+
+#include <immintrin.h>
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define SHA256_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+    #define SHA256_TARGET_AVX2
+#endif
+
+static const uint32_t K[64] =
+{
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+    0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+    0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+    0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+    0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+    0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+#define ADD(x, y)      _mm256_add_epi32(x, y)
+#define AND(x, y)      _mm256_and_si256(x, y)
+#define OR(x, y)       _mm256_or_si256(x, y)
+#define XOR(x, y)      _mm256_xor_si256(x, y)
+#define SHR(x, n)      _mm256_srli_epi32(x, n)
+#define ROTR(x, n)     OR(SHR(x, n), _mm256_slli_epi32(x, 32 - n))
+#define Ch(x, y, z)    XOR(AND(x, XOR(y, z)), z)
+#define Maj(x, y, z)   OR(AND(x, OR(y, z)), AND(y, z))
+#define S0(x)          XOR(XOR(ROTR(x, 2), ROTR(x, 13)), ROTR(x, 22))
+#define S1(x)          XOR(XOR(ROTR(x, 6), ROTR(x, 11)), ROTR(x, 25))
+#define s0(x)          XOR(XOR(ROTR(x, 7), ROTR(x, 18)), SHR(x, 3))
+#define s1(x)          XOR(XOR(ROTR(x, 17), ROTR(x, 19)), SHR(x, 10))
+
+SHA256_TARGET_AVX2
+static __m256i gather(uint32_t* const states[SHA256_AVX2_LANES], size_t word)
+{
+    return _mm256_set_epi32(
+        (int)states[7][word], (int)states[6][word],
+        (int)states[5][word], (int)states[4][word],
+        (int)states[3][word], (int)states[2][word],
+        (int)states[1][word], (int)states[0][word]);
+}
+
+/* Load the big-endian word at offset from each of the eight blocks. */
+SHA256_TARGET_AVX2
+static __m256i load(const uint8_t* const blocks[SHA256_AVX2_LANES],
+    size_t offset)
+{
+    size_t lane;
+    uint32_t words[SHA256_AVX2_LANES];
+    const __m256i swap = _mm256_set_epi64x(
+        0x0c0d0e0f08090a0bll, 0x0405060700010203ll,
+        0x0c0d0e0f08090a0bll, 0x0405060700010203ll);
+
+    for (lane = 0; lane < SHA256_AVX2_LANES; ++lane)
+        memcpy(&words[lane], blocks[lane] + offset, sizeof(uint32_t));
+
+    return _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)words),
+        swap);
+}
+
+SHA256_TARGET_AVX2
+void SHA256TransformAvx2(uint32_t* const states[SHA256_AVX2_LANES],
+    const uint8_t* const blocks[SHA256_AVX2_LANES])
+{
+    int i, lane, word;
+    __m256i W[16];
+    __m256i S[8];
+    __m256i T[8];
+    __m256i t0, t1;
+    uint32_t out[SHA256_AVX2_LANES];
+
+    for (word = 0; word < 8; ++word)
+        T[word] = S[word] = gather(states, word);
+
+    for (i = 0; i < 64; ++i)
+    {
+        /* W is a rolling window of the message schedule. */
+        if (i < 16)
+            W[i] = load(blocks, 4 * i);
+        else
+            W[i & 15] = ADD(ADD(s1(W[(i - 2) & 15]), W[(i - 7) & 15]),
+                ADD(s0(W[(i - 15) & 15]), W[i & 15]));
+
+        t0 = ADD(ADD(ADD(S[7], S1(S[4])), Ch(S[4], S[5], S[6])),
+            ADD(_mm256_set1_epi32((int)K[i]), W[i & 15]));
+        t1 = ADD(S0(S[0]), Maj(S[0], S[1], S[2]));
+
+        S[7] = S[6];
+        S[6] = S[5];
+        S[5] = S[4];
+        S[4] = ADD(S[3], t0);
+        S[3] = S[2];
+        S[2] = S[1];
+        S[1] = S[0];
+        S[0] = ADD(t0, t1);
+    }
+
+    for (word = 0; word < 8; ++word)
+    {
+        _mm256_storeu_si256((__m256i*)out, ADD(S[word], T[word]));
+
+        for (lane = 0; lane < (int)SHA256_AVX2_LANES; ++lane)
+            states[lane][word] = out[lane];
+    }
+}
+
+#endif
@@ -0,0 +1,41 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SHA256_AVX2_H
+#define LIBBITCOIN_SHA256_AVX2_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "sha256.h"
+
+#ifdef __cplusplus
+extern "C" 
+{
+#endif
+
+#define SHA256_AVX2_LANES 8U
+
+/* AVX2 transform of one block in each of eight independent states. */
+void SHA256TransformAvx2(uint32_t* const states[SHA256_AVX2_LANES],
+    const uint8_t* const blocks[SHA256_AVX2_LANES]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
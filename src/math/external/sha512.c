@@ -27,6 +27,8 @@
 
 #include <string.h>
 #include <stdint.h>
+#include "cpu_features.h"
+#include "sha512_arm.h"
 #include "zeroize.h"
 
 static uint64_t be64dec(const void* pp)
@@ -105,10 +107,19 @@ static unsigned char PAD[SHA512_BLOCK_LENGTH] =
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
 };
 
+typedef void(*SHA512TransformFunction)(uint64_t state[SHA512_STATE_LENGTH],
+    const uint8_t block[SHA512_BLOCK_LENGTH]);
+
 void SHA512Pad(SHA512CTX* context);
-void SHA512Transform(uint64_t state[SHA512_STATE_LENGTH],
+static void SHA512TransformPortable(uint64_t state[SHA512_STATE_LENGTH],
     const uint8_t block[SHA512_BLOCK_LENGTH]);
 
+/* The selection is idempotent, and each candidate is a valid transform, so a
+ * race between initializing threads is benign. It is repeated if the enabled
+ * processor features change. */
+static volatile int initialized = 0;
+static volatile SHA512TransformFunction transform = SHA512TransformPortable;
+
 void SHA512_(const uint8_t* input, size_t length,
     uint8_t digest[SHA512_DIGEST_LENGTH])
 {
@@ -192,8 +203,42 @@ void SHA512Pad(SHA512CTX* context)
     SHA512Update(context, len, 16);
 }
 
+/* Select the fastest transform supported by the executing processor. */
+static void SHA512Initialize(void)
+{
+    uint32_t features;
+
+    if (initialized == CPUFeaturesGeneration())
+        return;
+
+    features = CPUFeatures();
+    transform = SHA512TransformPortable;
+
+#if defined(SHA512_ARM)
+    if (features & CPU_FEATURE_ARM_SHA512)
+        transform = SHA512TransformArm;
+#else
+    (void)features;
+#endif
+
+    initialized = CPUFeaturesGeneration();
+}
+
+const char* SHA512Kernel(void)
+{
+    SHA512Initialize();
+    return transform == SHA512TransformPortable ? "portable" : "arm";
+}
+
 void SHA512Transform(uint64_t state[SHA512_STATE_LENGTH],
     const uint8_t block[SHA512_BLOCK_LENGTH])
+{
+    SHA512Initialize();
+    transform(state, block);
+}
+
+static void SHA512TransformPortable(uint64_t state[SHA512_STATE_LENGTH],
+    const uint8_t block[SHA512_BLOCK_LENGTH])
 {
     int i;
     uint64_t W[80];
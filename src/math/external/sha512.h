@@ -34,6 +34,13 @@
 #define SHA512_BLOCK_LENGTH 128U
 #define SHA512_DIGEST_LENGTH 64U
 
+#if defined(__x86_64__) || defined(__i386__) || \
+    defined(_M_X64) || defined(_M_IX86)
+    #define SHA512_X86
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+    #define SHA512_ARM
+#endif
+
 #ifdef __cplusplus
 extern "C" 
 {
@@ -53,6 +60,14 @@ void SHA512Init(SHA512CTX* context);
 void SHA512Update(SHA512CTX* context, const uint8_t* input, size_t length);
 void SHA512Final(SHA512CTX* context, uint8_t digest[SHA512_DIGEST_LENGTH]);
 
+/* Compress one block into the state, without padding or counting.
+ * Uses the ARMv8.2 SHA512 instructions where supported. */
+void SHA512Transform(uint64_t state[SHA512_STATE_LENGTH],
+    const uint8_t block[SHA512_BLOCK_LENGTH]);
+
+/* The name of the selected transform, for diagnostics. */
+const char* SHA512Kernel(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,122 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "sha512_arm.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include "sha512.h"
+
+#ifdef SHA512_ARM
+
+#include <arm_neon.h>
+
+#if defined(__clang__)
+    #define SHA512_TARGET_ARM __attribute__((target("sha3")))
+#elif defined(__GNUC__)
+    #define SHA512_TARGET_ARM __attribute__((target("arch=armv8.2-a+sha3")))
+#else
+    #define SHA512_TARGET_ARM
+#endif
+
+static const uint64_t K[80] =
+{
+    0x428a2f98d728ae22ULL, 0x7137449123ef65cdULL, 0xb5c0fbcfec4d3b2fULL,
+    0xe9b5dba58189dbbcULL, 0x3956c25bf348b538ULL, 0x59f111f1b605d019ULL,
+    0x923f82a4af194f9bULL, 0xab1c5ed5da6d8118ULL, 0xd807aa98a3030242ULL,
+    0x12835b0145706fbeULL, 0x243185be4ee4b28cULL, 0x550c7dc3d5ffb4e2ULL,
+    0x72be5d74f27b896fULL, 0x80deb1fe3b1696b1ULL, 0x9bdc06a725c71235ULL,
+    0xc19bf174cf692694ULL, 0xe49b69c19ef14ad2ULL, 0xefbe4786384f25e3ULL,
+    0x0fc19dc68b8cd5b5ULL, 0x240ca1cc77ac9c65ULL, 0x2de92c6f592b0275ULL,
+    0x4a7484aa6ea6e483ULL, 0x5cb0a9dcbd41fbd4ULL, 0x76f988da831153b5ULL,
+    0x983e5152ee66dfabULL, 0xa831c66d2db43210ULL, 0xb00327c898fb213fULL,
+    0xbf597fc7beef0ee4ULL, 0xc6e00bf33da88fc2ULL, 0xd5a79147930aa725ULL,
+    0x06ca6351e003826fULL, 0x142929670a0e6e70ULL, 0x27b70a8546d22ffcULL,
+    0x2e1b21385c26c926ULL, 0x4d2c6dfc5ac42aedULL, 0x53380d139d95b3dfULL,
+    0x650a73548baf63deULL, 0x766a0abb3c77b2a8ULL, 0x81c2c92e47edaee6ULL,
+    0x92722c851482353bULL, 0xa2bfe8a14cf10364ULL, 0xa81a664bbc423001ULL,
+    0xc24b8b70d0f89791ULL, 0xc76c51a30654be30ULL, 0xd192e819d6ef5218ULL,
+    0xd69906245565a910ULL, 0xf40e35855771202aULL, 0x106aa07032bbd1b8ULL,
+    0x19a4c116b8d2d0c8ULL, 0x1e376c085141ab53ULL, 0x2748774cdf8eeb99ULL,
+    0x34b0bcb5e19b48a8ULL, 0x391c0cb3c5c95a63ULL, 0x4ed8aa4ae3418acbULL,
+    0x5b9cca4f7763e373ULL, 0x682e6ff3d6b2b8a3ULL, 0x748f82ee5defb2fcULL,
+    0x78a5636f43172f60ULL, 0x84c87814a1f0ab72ULL, 0x8cc702081a6439ecULL,
+    0x90befffa23631e28ULL, 0xa4506cebde82bde9ULL, 0xbef9a3f7b2c67915ULL,
+    0xc67178f2e372532bULL, 0xca273eceea26619cULL, 0xd186b8c721c0c207ULL,
+    0xeada7dd6cde0eb1eULL, 0xf57d4f7fee6ed178ULL, 0x06f067aa72176fbaULL,
+    0x0a637dc5a2c898a6ULL, 0x113f9804bef90daeULL, 0x1b710b35131c471bULL,
+    0x28db77f523047d84ULL, 0x32caab7b40c72493ULL, 0x3c9ebe0a15c9bebcULL,
+    0x431d67c49c100d4cULL, 0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL,
+    0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL
+};
+
+/* Each double round consumes a pair of message words. The state is held as
+ * the pairs ab, cd, ef and gh, with the first word of each in lane zero. */
+SHA512_TARGET_ARM
+void SHA512TransformArm(uint64_t state[SHA512_STATE_LENGTH],
+    const uint8_t block[SHA512_BLOCK_LENGTH])
+{
+    int pair;
+    uint64x2_t W[8];
+    uint64x2_t ab, cd, ef, gh, fg, de, kw, sum;
+
+    const uint64x2_t ab0 = vld1q_u64(state + 0);
+    const uint64x2_t cd0 = vld1q_u64(state + 2);
+    const uint64x2_t ef0 = vld1q_u64(state + 4);
+    const uint64x2_t gh0 = vld1q_u64(state + 6);
+
+    for (pair = 0; pair < 8; ++pair)
+        W[pair] = vreinterpretq_u64_u8(vrev64q_u8(vld1q_u8(block +
+            16 * pair)));
+
+    ab = ab0;
+    cd = cd0;
+    ef = ef0;
+    gh = gh0;
+
+    for (pair = 0; pair < 40; ++pair)
+    {
+        uint64x2_t* const words = &W[pair & 7];
+        kw = vaddq_u64(vld1q_u64(K + 2 * pair), *words);
+
+        /* Schedule the pair used eight double rounds from now. */
+        if (pair < 32)
+            *words = vsha512su1q_u64(
+                vsha512su0q_u64(*words, W[(pair + 1) & 7]),
+                W[(pair + 7) & 7],
+                vextq_u64(W[(pair + 4) & 7], W[(pair + 5) & 7], 1));
+
+        fg = vextq_u64(ef, gh, 1);
+        de = vextq_u64(cd, ef, 1);
+        gh = vaddq_u64(gh, vextq_u64(kw, kw, 1));
+        sum = vsha512hq_u64(gh, fg, de);
+
+        gh = ef;
+        ef = vaddq_u64(cd, sum);
+        sum = vsha512h2q_u64(sum, cd, ab);
+        cd = ab;
+        ab = sum;
+    }
+
+    vst1q_u64(state + 0, vaddq_u64(ab, ab0));
+    vst1q_u64(state + 2, vaddq_u64(cd, cd0));
+    vst1q_u64(state + 4, vaddq_u64(ef, ef0));
+    vst1q_u64(state + 6, vaddq_u64(gh, gh0));
+}
+
+#endif
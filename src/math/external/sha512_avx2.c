@@ -0,0 +1,158 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "sha512_avx2.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "cpu_features.h"
+#include "sha512.h"
+
+#ifdef SHA512_X86
+
+#include <immintrin.h>
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define SHA512_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+    #define SHA512_TARGET_AVX2
+#endif
+
+static const uint64_t K[80] =
+{
+    0x428a2f98d728ae22ULL, 0x7137449123ef65cdULL, 0xb5c0fbcfec4d3b2fULL,
+    0xe9b5dba58189dbbcULL, 0x3956c25bf348b538ULL, 0x59f111f1b605d019ULL,
+    0x923f82a4af194f9bULL, 0xab1c5ed5da6d8118ULL, 0xd807aa98a3030242ULL,
+    0x12835b0145706fbeULL, 0x243185be4ee4b28cULL, 0x550c7dc3d5ffb4e2ULL,
+    0x72be5d74f27b896fULL, 0x80deb1fe3b1696b1ULL, 0x9bdc06a725c71235ULL,
+    0xc19bf174cf692694ULL, 0xe49b69c19ef14ad2ULL, 0xefbe4786384f25e3ULL,
+    0x0fc19dc68b8cd5b5ULL, 0x240ca1cc77ac9c65ULL, 0x2de92c6f592b0275ULL,
+    0x4a7484aa6ea6e483ULL, 0x5cb0a9dcbd41fbd4ULL, 0x76f988da831153b5ULL,
+    0x983e5152ee66dfabULL, 0xa831c66d2db43210ULL, 0xb00327c898fb213fULL,
+    0xbf597fc7beef0ee4ULL, 0xc6e00bf33da88fc2ULL, 0xd5a79147930aa725ULL,
+    0x06ca6351e003826fULL, 0x142929670a0e6e70ULL, 0x27b70a8546d22ffcULL,
+    0x2e1b21385c26c926ULL, 0x4d2c6dfc5ac42aedULL, 0x53380d139d95b3dfULL,
+    0x650a73548baf63deULL, 0x766a0abb3c77b2a8ULL, 0x81c2c92e47edaee6ULL,
+    0x92722c851482353bULL, 0xa2bfe8a14cf10364ULL, 0xa81a664bbc423001ULL,
+    0xc24b8b70d0f89791ULL, 0xc76c51a30654be30ULL, 0xd192e819d6ef5218ULL,
+    0xd69906245565a910ULL, 0xf40e35855771202aULL, 0x106aa07032bbd1b8ULL,
+    0x19a4c116b8d2d0c8ULL, 0x1e376c085141ab53ULL, 0x2748774cdf8eeb99ULL,
+    0x34b0bcb5e19b48a8ULL, 0x391c0cb3c5c95a63ULL, 0x4ed8aa4ae3418acbULL,
+    0x5b9cca4f7763e373ULL, 0x682e6ff3d6b2b8a3ULL, 0x748f82ee5defb2fcULL,
+    0x78a5636f43172f60ULL, 0x84c87814a1f0ab72ULL, 0x8cc702081a6439ecULL,
+    0x90befffa23631e28ULL, 0xa4506cebde82bde9ULL, 0xbef9a3f7b2c67915ULL,
+    0xc67178f2e372532bULL, 0xca273eceea26619cULL, 0xd186b8c721c0c207ULL,
+    0xeada7dd6cde0eb1eULL, 0xf57d4f7fee6ed178ULL, 0x06f067aa72176fbaULL,
+    0x0a637dc5a2c898a6ULL, 0x113f9804bef90daeULL, 0x1b710b35131c471bULL,
+    0x28db77f523047d84ULL, 0x32caab7b40c72493ULL, 0x3c9ebe0a15c9bebcULL,
+    0x431d67c49c100d4cULL, 0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL,
+    0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL
+};
+
+#define ADD(x, y)      _mm256_add_epi64(x, y)
+#define AND(x, y)      _mm256_and_si256(x, y)
+#define OR(x, y)       _mm256_or_si256(x, y)
+#define XOR(x, y)      _mm256_xor_si256(x, y)
+#define SHR(x, n)      _mm256_srli_epi64(x, n)
+#define ROTR(x, n)     OR(SHR(x, n), _mm256_slli_epi64(x, 64 - n))
+#define Ch(x, y, z)    XOR(AND(x, XOR(y, z)), z)
+#define Maj(x, y, z)   OR(AND(x, OR(y, z)), AND(y, z))
+#define S0(x)          XOR(XOR(ROTR(x, 28), ROTR(x, 34)), ROTR(x, 39))
+#define S1(x)          XOR(XOR(ROTR(x, 14), ROTR(x, 18)), ROTR(x, 41))
+#define s0(x)          XOR(XOR(ROTR(x, 1), ROTR(x, 8)), SHR(x, 7))
+#define s1(x)          XOR(XOR(ROTR(x, 19), ROTR(x, 61)), SHR(x, 6))
+
+int SHA512Avx2Supported(void)
+{
+    return (CPUFeatures() & CPU_FEATURE_AVX2) != 0;
+}
+
+SHA512_TARGET_AVX2
+static __m256i gather(uint64_t* const states[SHA512_AVX2_LANES], size_t word)
+{
+    return _mm256_set_epi64x(
+        (long long)states[3][word], (long long)states[2][word],
+        (long long)states[1][word], (long long)states[0][word]);
+}
+
+/* Load the big-endian word at offset from each of the four blocks. */
+SHA512_TARGET_AVX2
+static __m256i load(const uint8_t* const blocks[SHA512_AVX2_LANES],
+    size_t offset)
+{
+    size_t lane;
+    uint64_t words[SHA512_AVX2_LANES];
+    const __m256i swap = _mm256_set_epi64x(
+        0x08090a0b0c0d0e0fll, 0x0001020304050607ll,
+        0x08090a0b0c0d0e0fll, 0x0001020304050607ll);
+
+    for (lane = 0; lane < SHA512_AVX2_LANES; ++lane)
+        memcpy(&words[lane], blocks[lane] + offset, sizeof(uint64_t));
+
+    return _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)words),
+        swap);
+}
+
+SHA512_TARGET_AVX2
+void SHA512TransformAvx2(uint64_t* const states[SHA512_AVX2_LANES],
+    const uint8_t* const blocks[SHA512_AVX2_LANES])
+{
+    int i, lane, word;
+    __m256i W[16];
+    __m256i S[8];
+    __m256i T[8];
+    __m256i t0, t1;
+    uint64_t out[SHA512_AVX2_LANES];
+
+    for (word = 0; word < 8; ++word)
+        T[word] = S[word] = gather(states, word);
+
+    for (i = 0; i < 80; ++i)
+    {
+        /* W is a rolling window of the message schedule. */
+        if (i < 16)
+            W[i] = load(blocks, 8 * i);
+        else
+            W[i & 15] = ADD(ADD(s1(W[(i - 2) & 15]), W[(i - 7) & 15]),
+                ADD(s0(W[(i - 15) & 15]), W[i & 15]));
+
+        t0 = ADD(ADD(ADD(S[7], S1(S[4])), Ch(S[4], S[5], S[6])),
+            ADD(_mm256_set1_epi64x((long long)K[i]), W[i & 15]));
+        t1 = ADD(S0(S[0]), Maj(S[0], S[1], S[2]));
+
+        S[7] = S[6];
+        S[6] = S[5];
+        S[5] = S[4];
+        S[4] = ADD(S[3], t0);
+        S[3] = S[2];
+        S[2] = S[1];
+        S[1] = S[0];
+        S[0] = ADD(t0, t1);
+    }
+
+    for (word = 0; word < 8; ++word)
+    {
+        _mm256_storeu_si256((__m256i*)out, ADD(S[word], T[word]));
+
+        for (lane = 0; lane < (int)SHA512_AVX2_LANES; ++lane)
+            states[lane][word] = out[lane];
+    }
+}
+
+#endif
@@ -0,0 +1,44 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SHA512_AVX2_H
+#define LIBBITCOIN_SHA512_AVX2_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "sha512.h"
+
+#ifdef __cplusplus
+extern "C" 
+{
+#endif
+
+#define SHA512_AVX2_LANES 4U
+
+/* Nonzero if the executing processor and system support the transform. */
+int SHA512Avx2Supported(void);
+
+/* AVX2 transform of one block in each of four independent states. */
+void SHA512TransformAvx2(uint64_t* const states[SHA512_AVX2_LANES],
+    const uint8_t* const blocks[SHA512_AVX2_LANES]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
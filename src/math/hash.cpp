@@ -19,16 +19,24 @@
 #include <bitcoin/bitcoin/math/hash.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdint>
 #include <errno.h>
+#include <memory>
+#include <mutex>
 #include <new>
 #include <stdexcept>
+#include <vector>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
 #include "../math/external/crypto_scrypt.h"
 #include "../math/external/hmac_sha256.h"
 #include "../math/external/hmac_sha512.h"
 #include "../math/external/pkcs5_pbkdf2.h"
+#include "../math/external/pbkdf2_sha256.h"
 #include "../math/external/ripemd160.h"
+#include "../math/external/scrypt_pow.h"
 #include "../math/external/sha1.h"
 #include "../math/external/sha256.h"
 #include "../math/external/sha512.h"
@@ -40,14 +48,82 @@ hash_digest bitcoin_hash(data_slice data)
     return sha256_hash(sha256_hash(data));
 }
 
+// The scratch of the header proof of work mixes, retained by each thread.
+static uint32_t* scrypt_pow_scratch(size_t lanes)
+{
+    thread_local std::vector<uint32_t> scratch;
+    const auto size = lanes * SCRYPT_POW_SCRATCH_WORDS;
+
+    if (scratch.size() < size)
+        scratch.resize(size);
+
+    return scratch.data();
+}
+
 hash_digest scrypt_hash(data_slice data)
 {
-    return scrypt<hash_size>(data, data, 1024u, 1u, 1u);
+    if (data.size() != SCRYPT_POW_INPUT_LENGTH)
+        return scrypt<hash_size>(data, data, 1024u, 1u, 1u);
+
+    hash_digest hash;
+    ScryptPowHash(data.data(), hash.data(), scrypt_pow_scratch(1));
+    return hash;
+}
+
+size_t scrypt_hash_lanes()
+{
+    return ScryptPowLanes();
+}
+
+void scrypt_hash_batch(const data_slice* data, size_t count,
+    hash_digest* out)
+{
+    static_assert(sizeof(hash_digest) == SCRYPT_POW_DIGEST_LENGTH,
+        "unexpected digest size");
+
+    std::vector<const uint8_t*> inputs;
+    inputs.reserve(count);
+    size_t index = 0;
+
+    // Runs of header sized data are mixed together, others are hashed alone.
+    while (index < count)
+    {
+        inputs.clear();
+        const auto first = index;
+
+        for (; index < count && data[index].size() == SCRYPT_POW_INPUT_LENGTH;
+            ++index)
+            inputs.push_back(data[index].data());
+
+        if (!inputs.empty())
+        {
+            const auto digests = reinterpret_cast<uint8_t(*)[
+                SCRYPT_POW_DIGEST_LENGTH]>(out[first].data());
+            ScryptPowHashBatch(inputs.data(), inputs.size(), digests,
+                scrypt_pow_scratch(ScryptPowLanes()));
+        }
+        else
+        {
+            out[index] = scrypt_hash(data[index]);
+            ++index;
+        }
+    }
 }
 
 short_hash bitcoin_short_hash(data_slice data)
 {
-    return ripemd160_hash(sha256_hash(data));
+    short_hash hash;
+    RMD160Hash32(sha256_hash(data).data(), hash.data());
+    return hash;
+}
+
+short_hash bitcoin_short_hash(const byte_array<1 + hash_size>& point)
+{
+    hash_digest digest;
+    short_hash hash;
+    SHA256Block(point.data(), point.size(), digest.data());
+    RMD160Hash32(digest.data(), hash.data());
+    return hash;
 }
 
 short_hash ripemd160_hash(data_slice data)
@@ -103,6 +179,115 @@ hash_digest sha256_hash(data_slice first, data_slice second)
     return hash;
 }
 
+struct sha256_context::state
+{
+    SHA256CTX context;
+};
+
+sha256_context::sha256_context()
+  : state_(new state)
+{
+    reset();
+}
+
+sha256_context::~sha256_context()
+{
+}
+
+void sha256_context::reset()
+{
+    SHA256Init(&state_->context);
+}
+
+void sha256_context::write(data_slice data)
+{
+    SHA256Update(&state_->context, data.data(), data.size());
+}
+
+hash_digest sha256_context::digest()
+{
+    hash_digest hash;
+    SHA256Final(&state_->context, hash.data());
+    return hash;
+}
+
+void sha256_hash_batch(const data_slice* data, size_t count,
+    hash_digest* out)
+{
+    std::vector<const uint8_t*> inputs;
+    std::vector<size_t> lengths;
+    inputs.reserve(count);
+    lengths.reserve(count);
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        inputs.push_back(data[index].data());
+        lengths.push_back(data[index].size());
+    }
+
+    // The hash_digest array is contiguous and has no padding.
+    static_assert(sizeof(hash_digest) == SHA256_DIGEST_LENGTH, "digest size");
+    const auto digests = reinterpret_cast<uint8_t(*)[SHA256_DIGEST_LENGTH]>(
+        out);
+
+    SHA256Batch(inputs.data(), lengths.data(), count, digests);
+}
+
+void bitcoin_hash_batch(const data_slice* data, size_t count,
+    hash_digest* out)
+{
+    hash_list firsts(count);
+    sha256_hash_batch(data, count, firsts.data());
+
+    const std::vector<data_slice> seconds(firsts.begin(), firsts.end());
+    sha256_hash_batch(seconds.data(), count, out);
+}
+
+void bitcoin_short_hash_batch(const data_slice* data, size_t count,
+    short_hash* out)
+{
+    if (count == 0)
+        return;
+
+    hash_list firsts(count);
+    sha256_hash_batch(data, count, firsts.data());
+
+    // The hash arrays are contiguous and have no padding.
+    static_assert(sizeof(short_hash) == RMD160_DIGEST_LENGTH, "digest size");
+    const auto digests = reinterpret_cast<uint8_t(*)[RMD160_DIGEST_LENGTH]>(
+        out);
+
+    RMD160Hash32Batch(firsts.front().data(), count, digests);
+}
+
+hash_digest merkle_hash(const hash_digest& left, const hash_digest& right)
+{
+    hash_digest hash;
+    uint8_t node[2 * hash_size];
+    std::copy(left.begin(), left.end(), node);
+    std::copy(right.begin(), right.end(), node + hash_size);
+    SHA256Double64(node, hash.data());
+    return hash;
+}
+
+void merkle_hash_level(hash_list& level)
+{
+    if (level.empty())
+        return;
+
+    if (level.size() % 2 != 0)
+        level.push_back(level.back());
+
+    // Sibling hashes are contiguous, so each pair is hashed in place.
+    const auto count = level.size() / 2;
+    const auto nodes = reinterpret_cast<const uint8_t*>(level.data());
+    const auto parents = reinterpret_cast<uint8_t(*)[SHA256_DIGEST_LENGTH]>(
+        level.data());
+
+    SHA256Double64Batch(nodes, count, parents);
+    level.resize(count);
+}
+
 hash_digest hmac_sha256_hash(data_slice data, data_slice key)
 {
     hash_digest hash;
@@ -124,6 +309,61 @@ long_hash hmac_sha512_hash(data_slice data, data_slice key)
     return hash;
 }
 
+void hmac_sha512_hash_batch(const data_slice* data, const data_slice* keys,
+    size_t count, long_hash* out)
+{
+    std::vector<const uint8_t*> inputs;
+    std::vector<size_t> lengths;
+    std::vector<const uint8_t*> key_data;
+    std::vector<size_t> key_lengths;
+    inputs.reserve(count);
+    lengths.reserve(count);
+    key_data.reserve(count);
+    key_lengths.reserve(count);
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        inputs.push_back(data[index].data());
+        lengths.push_back(data[index].size());
+        key_data.push_back(keys[index].data());
+        key_lengths.push_back(keys[index].size());
+    }
+
+    // The long_hash array is contiguous and has no padding.
+    static_assert(sizeof(long_hash) == HMACSHA512_DIGEST_LENGTH,
+        "digest size");
+    const auto hashes = reinterpret_cast<uint8_t(*)[HMACSHA512_DIGEST_LENGTH]>(
+        out);
+
+    HMACSHA512Batch(inputs.data(), lengths.data(), key_data.data(),
+        key_lengths.data(), count, hashes);
+}
+
+struct hmac_sha512_context::state
+{
+    HMACSHA512CTX context;
+};
+
+hmac_sha512_context::hmac_sha512_context(data_slice key)
+  : state_(new state)
+{
+    HMACSHA512Init(&state_->context, key.data(), key.size());
+}
+
+hmac_sha512_context::~hmac_sha512_context()
+{
+}
+
+long_hash hmac_sha512_context::digest(data_slice data) const
+{
+    // Continue from a copy of the keyed state.
+    auto context = state_->context;
+    long_hash hash;
+    HMACSHA512Update(&context, data.data(), data.size());
+    HMACSHA512Final(&context, hash.data());
+    return hash;
+}
+
 long_hash pkcs5_pbkdf2_hmac_sha512(data_slice passphrase,
     data_slice salt, size_t iterations)
 {
@@ -137,6 +377,36 @@ long_hash pkcs5_pbkdf2_hmac_sha512(data_slice passphrase,
     return hash;
 }
 
+void pkcs5_pbkdf2_hmac_sha512_batch(const data_slice* passphrases,
+    const data_slice* salts, size_t count, size_t iterations, long_hash* out)
+{
+    std::vector<const uint8_t*> keys;
+    std::vector<size_t> key_lengths;
+    std::vector<const uint8_t*> salt_data;
+    std::vector<size_t> salt_lengths;
+    keys.reserve(count);
+    key_lengths.reserve(count);
+    salt_data.reserve(count);
+    salt_lengths.reserve(count);
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        keys.push_back(passphrases[index].data());
+        key_lengths.push_back(passphrases[index].size());
+        salt_data.push_back(salts[index].data());
+        salt_lengths.push_back(salts[index].size());
+    }
+
+    // The long_hash array is contiguous and has no padding.
+    static_assert(sizeof(long_hash) == HMACSHA512_DIGEST_LENGTH,
+        "digest size");
+    const auto hashes = reinterpret_cast<uint8_t(*)[HMACSHA512_DIGEST_LENGTH]>(
+        out);
+
+    pkcs5_pbkdf2_batch(keys.data(), key_lengths.data(), salt_data.data(),
+        salt_lengths.data(), count, hashes, iterations);
+}
+
 static void handle_script_result(int result)
 {
     if (result == 0)
@@ -165,4 +435,127 @@ data_chunk scrypt(data_slice data, data_slice salt, uint64_t N, uint32_t p,
     return output;
 }
 
+size_t scrypt_scratch_size(uint64_t N, uint32_t r)
+{
+    // V is 128rN bytes and XY is 256r bytes.
+    return 128u * r * (static_cast<size_t>(N) + 2u);
+}
+
+// Claims and computes the mixes of a scrypt batch until exhausted. Each
+// participant allocates its own scratch, and leaves if it cannot.
+struct scrypt_mixer
+{
+    scrypt_mixer(std::vector<data_chunk>& blocks, uint64_t N, uint32_t p,
+        uint32_t r)
+      : blocks(blocks),
+        N(N),
+        p(p),
+        r(r),
+        size(blocks.size() * p),
+        next(0),
+        mixed(0),
+        running(0)
+    {
+    }
+
+    void run()
+    {
+        mutex.lock();
+        ++running;
+        mutex.unlock();
+
+        // Avoid allocating scratch if there is nothing left to claim.
+        if (next.load() < size)
+        {
+            try
+            {
+                data_chunk scratch(scrypt_scratch_size(N, r));
+                const auto V = scratch.data();
+                const auto XY = V + 128u * r * static_cast<size_t>(N);
+
+                size_t index;
+                while ((index = next.fetch_add(1)) < size)
+                {
+                    const auto B = blocks[index / p].data() +
+                        128u * r * (index % p);
+                    crypto_scrypt_smix(B, r, N, V, XY);
+                    ++mixed;
+                }
+            }
+            catch (const std::bad_alloc&)
+            {
+            }
+        }
+
+        mutex.lock();
+        const auto idle = (--running == 0);
+        mutex.unlock();
+
+        if (idle)
+            finished.notify_all();
+    }
+
+    // Wait for all claimed mixes to complete, call only after run().
+    bool wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        finished.wait(lock, [this]() { return running == 0; });
+        return mixed.load() == size;
+    }
+
+    std::vector<data_chunk>& blocks;
+    const uint64_t N;
+    const uint32_t p;
+    const uint32_t r;
+    const size_t size;
+    std::atomic<size_t> next;
+    std::atomic<size_t> mixed;
+
+    // This is protected by mutex.
+    size_t running;
+    std::mutex mutex;
+    std::condition_variable finished;
+};
+
+void scrypt_batch(const data_slice* data, const data_slice* salts,
+    size_t count, uint64_t N, uint32_t p, uint32_t r, size_t length,
+    data_chunk* out, threadpool& pool, size_t memory_budget)
+{
+    handle_script_result(crypto_scrypt_check(N, r, p, length));
+
+    if (count == 0)
+        return;
+
+    // 1: (B_0 ... B_{p-1}) <-- PBKDF2(P, S, 1, p * MFLen), for each hash.
+    std::vector<data_chunk> blocks(count, data_chunk(128u * r * p));
+    for (size_t index = 0; index < count; ++index)
+        pbkdf2_sha256(data[index].data(), data[index].size(),
+            salts[index].data(), salts[index].size(), 1,
+            blocks[index].data(), blocks[index].size());
+
+    // 2: B_i <-- MF(B_i, N), for all blocks of all hashes.
+    const auto mixer = std::make_shared<scrypt_mixer>(blocks, N, p, r);
+    const auto lanes = std::max(size_t(1),
+        memory_budget / scrypt_scratch_size(N, r));
+
+    // The calling thread is one of the mixers.
+    const auto jobs = std::min({ pool.size(), lanes - 1, mixer->size - 1 });
+
+    for (size_t job = 0; job < jobs; ++job)
+        pool.service().post([mixer]() { mixer->run(); });
+
+    mixer->run();
+    if (!mixer->wait())
+        throw std::bad_alloc();
+
+    // 5: DK <-- PBKDF2(P, B, 1, dkLen), for each hash.
+    for (size_t index = 0; index < count; ++index)
+    {
+        out[index].resize(length);
+        pbkdf2_sha256(data[index].data(), data[index].size(),
+            blocks[index].data(), blocks[index].size(), 1,
+            out[index].data(), length);
+    }
+}
+
 } // namespace libbitcoin
@@ -0,0 +1,119 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/math/muhash.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include "../math/external/chacha20.h"
+#include "../math/external/num3072.h"
+
+namespace libbitcoin {
+
+// This is the type of muhash::number, which is private.
+typedef std::array<uint64_t, NUM3072_LIMBS> limbs;
+
+// Copy to and from the opaque number, to avoid exposing external types.
+static Num3072 to_num(const limbs& value)
+{
+    Num3072 out;
+    std::copy(value.begin(), value.end(), std::begin(out.limbs));
+    return out;
+}
+
+static limbs from_num(const Num3072& value)
+{
+    limbs out;
+    std::copy(std::begin(value.limbs), std::end(value.limbs), out.begin());
+    return out;
+}
+
+static limbs one()
+{
+    Num3072 value;
+    Num3072SetOne(&value);
+    return from_num(value);
+}
+
+// The element is the keystream of its hash, with a zero nonce and counter.
+static Num3072 to_element(data_slice element)
+{
+    Num3072 out;
+    byte_array<NUM3072_BYTES> stream;
+    static const byte_array<CHACHA20_NONCE_LENGTH> nonce{};
+    const auto key = sha256_hash(element);
+    ChaCha20Keystream(key.data(), nonce.data(), 0, stream.data(),
+        stream.size());
+    Num3072FromBytes(&out, stream.data());
+    return out;
+}
+
+static void multiply(limbs& in_out, const Num3072& factor)
+{
+    auto value = to_num(in_out);
+    Num3072Multiply(&value, &value, &factor);
+    in_out = from_num(value);
+}
+
+muhash::muhash()
+  : numerator_(one()),
+    denominator_(one())
+{
+}
+
+void muhash::insert(data_slice element)
+{
+    multiply(numerator_, to_element(element));
+}
+
+void muhash::remove(data_slice element)
+{
+    multiply(denominator_, to_element(element));
+}
+
+muhash& muhash::operator*=(const muhash& other)
+{
+    multiply(numerator_, to_num(other.numerator_));
+    multiply(denominator_, to_num(other.denominator_));
+    return *this;
+}
+
+muhash& muhash::operator/=(const muhash& other)
+{
+    multiply(numerator_, to_num(other.denominator_));
+    multiply(denominator_, to_num(other.numerator_));
+    return *this;
+}
+
+hash_digest muhash::digest() const
+{
+    Num3072 inverse;
+    auto value = to_num(numerator_);
+    const auto denominator = to_num(denominator_);
+    Num3072Inverse(&inverse, &denominator);
+    Num3072Multiply(&value, &value, &inverse);
+
+    byte_array<NUM3072_BYTES> bytes;
+    Num3072ToBytes(bytes.data(), &value);
+    return sha256_hash(bytes);
+}
+
+} // namespace libbitcoin
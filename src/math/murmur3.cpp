@@ -0,0 +1,113 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/math/murmur3.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/endian.hpp>
+
+namespace libbitcoin {
+
+// MurmurHash3 x86_32 (Appleby), as specified for bip37 bloom filters.
+
+static constexpr size_t block_size = sizeof(uint32_t);
+static constexpr uint32_t c1 = 0xcc9e2d51;
+static constexpr uint32_t c2 = 0x1b873593;
+
+static inline uint32_t rotate_left(uint32_t value, uint32_t shift)
+{
+    return (value << shift) | (value >> (32u - shift));
+}
+
+// The block mixing depends only upon the data, not the seed.
+static inline uint32_t mix(uint32_t block)
+{
+    block *= c1;
+    block = rotate_left(block, 15);
+    return block * c2;
+}
+
+static inline uint32_t combine(uint32_t hash, uint32_t mixed)
+{
+    hash ^= mixed;
+    hash = rotate_left(hash, 13);
+    return hash * 5u + 0xe6546b64;
+}
+
+static inline uint32_t finalize(uint32_t hash, uint32_t size)
+{
+    hash ^= size;
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6b;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+uint32_t murmur3(uint32_t seed, data_slice data)
+{
+    uint32_t out;
+    murmur3(&seed, 1, data, &out);
+    return out;
+}
+
+void murmur3(const uint32_t* seeds, size_t count, data_slice data,
+    uint32_t* out)
+{
+    const auto size = data.size();
+    const auto bytes = data.data();
+    const auto blocks = size / block_size;
+
+    for (size_t lane = 0; lane < count; ++lane)
+        out[lane] = seeds[lane];
+
+    for (size_t block = 0; block < blocks; ++block)
+    {
+        const auto mixed = mix(from_little_endian_unsafe<uint32_t>(
+            bytes + block * block_size));
+
+        for (size_t lane = 0; lane < count; ++lane)
+            out[lane] = combine(out[lane], mixed);
+    }
+
+    const auto tail = bytes + blocks * block_size;
+    const auto remaining = size % block_size;
+
+    if (remaining != 0)
+    {
+        uint32_t last = 0;
+
+        for (size_t byte = 0; byte < remaining; ++byte)
+            last |= static_cast<uint32_t>(tail[byte]) << (8u * byte);
+
+        const auto mixed = mix(last);
+
+        for (size_t lane = 0; lane < count; ++lane)
+            out[lane] ^= mixed;
+    }
+
+    const auto length = static_cast<uint32_t>(size);
+
+    for (size_t lane = 0; lane < count; ++lane)
+        out[lane] = finalize(out[lane], length);
+}
+
+} // namespace libbitcoin
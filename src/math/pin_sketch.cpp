@@ -0,0 +1,372 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/math/pin_sketch.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include "../math/external/gf2_32.h"
+
+namespace libbitcoin {
+
+// Polynomials over GF(2^32), coefficients in ascending order of degree,
+// without leading zero coefficients (the zero polynomial is empty).
+typedef std::vector<uint32_t> polynomial;
+
+static const size_t field_bits = 32;
+
+const size_t pin_sketch::element_size = sizeof(pin_sketch::element);
+
+static uint32_t multiply(uint32_t left, uint32_t right)
+{
+    return gf2_32_multiply(left, right);
+}
+
+// The inverse is value^(2^32 - 2), value must be nonzero.
+static uint32_t invert(uint32_t value)
+{
+    auto result = value;
+
+    // value^(2^31 - 1), by value^(2^(k+1) - 1) = (value^(2^k - 1))^2 * value.
+    for (size_t bit = 1; bit < field_bits - 1; ++bit)
+        result = multiply(multiply(result, result), value);
+
+    return multiply(result, result);
+}
+
+static size_t degree(const polynomial& value)
+{
+    return value.size() - 1;
+}
+
+static void trim(polynomial& value)
+{
+    while (!value.empty() && value.back() == 0)
+        value.pop_back();
+}
+
+static void make_monic(polynomial& value)
+{
+    const auto inverse = invert(value.back());
+
+    for (auto& coefficient: value)
+        coefficient = multiply(coefficient, inverse);
+}
+
+// Reduce the value modulo the monic modulus.
+static void reduce(polynomial& value, const polynomial& modulus)
+{
+    const auto order = degree(modulus);
+
+    while (!value.empty() && value.size() > order)
+    {
+        const auto lead = value.back();
+        const auto offset = value.size() - modulus.size();
+
+        for (size_t index = 0; index < order; ++index)
+            value[offset + index] ^= multiply(lead, modulus[index]);
+
+        value.pop_back();
+        trim(value);
+    }
+}
+
+// The square of the value modulo the monic modulus. The square of a sum is
+// the sum of the squares in characteristic two.
+static polynomial square(const polynomial& value, const polynomial& modulus)
+{
+    polynomial out(value.empty() ? 0 : 2 * value.size() - 1, 0);
+
+    for (size_t index = 0; index < value.size(); ++index)
+        out[2 * index] = multiply(value[index], value[index]);
+
+    reduce(out, modulus);
+    return out;
+}
+
+// The monic greatest common divisor of the values, left must be nonzero.
+static polynomial gcd(polynomial left, polynomial right)
+{
+    while (!right.empty())
+    {
+        make_monic(right);
+        reduce(left, right);
+        std::swap(left, right);
+    }
+
+    make_monic(left);
+    return left;
+}
+
+// The quotient of the value by a monic divisor of it.
+static polynomial divide(polynomial value, const polynomial& divisor)
+{
+    const auto order = degree(divisor);
+    polynomial quotient(value.size() - order, 0);
+
+    for (auto position = value.size(); position > order; --position)
+    {
+        const auto lead = value[position - 1];
+        const auto offset = position - 1 - order;
+        quotient[offset] = lead;
+
+        for (size_t index = 0; index < order; ++index)
+            value[offset + index] ^= multiply(lead, divisor[index]);
+    }
+
+    return quotient;
+}
+
+// True if the monic polynomial is a product of distinct linear factors,
+// which is if it divides x^(2^32) - x (the product of x - a over the field).
+static bool splits(const polynomial& value)
+{
+    polynomial identity{ 0, 1 };
+    reduce(identity, value);
+    auto power = identity;
+
+    for (size_t bit = 0; bit < field_bits; ++bit)
+        power = square(power, value);
+
+    return power == identity;
+}
+
+// The roots of a monic product of distinct linear factors (Berlekamp trace
+// algorithm). The trace of (basis * x) is zero or one at each root, so its
+// gcd with the polynomial separates the roots unless all share a trace. The
+// trace form is nondegenerate, so the basis elements 2^i separate any roots.
+static bool find_roots(pin_sketch::elements& out, const polynomial& value,
+    size_t basis)
+{
+    if (degree(value) == 1)
+    {
+        out.push_back(value.front());
+        return true;
+    }
+
+    for (; basis < field_bits; ++basis)
+    {
+        polynomial power{ 0, uint32_t(1) << basis };
+        reduce(power, value);
+        auto trace = power;
+
+        for (size_t bit = 1; bit < field_bits; ++bit)
+        {
+            power = square(power, value);
+            trace.resize(std::max(trace.size(), power.size()), 0);
+
+            for (size_t index = 0; index < power.size(); ++index)
+                trace[index] ^= power[index];
+        }
+
+        trim(trace);
+
+        if (trace.empty())
+            continue;
+
+        const auto factor = gcd(value, trace);
+
+        if (degree(factor) > 0 && degree(factor) < degree(value))
+            return find_roots(out, factor, basis + 1) &&
+                find_roots(out, divide(value, factor), basis + 1);
+    }
+
+    return false;
+}
+
+// The connection polynomial of the power sums s1, s2, ... s(2c) (Berlekamp-
+// Massey), which is the error locator 1 + ... of the elements of the set.
+static polynomial locate(const std::vector<uint32_t>& sums)
+{
+    polynomial current{ 1 };
+    polynomial prior{ 1 };
+    uint32_t prior_discrepancy = 1;
+    size_t length = 0;
+    size_t shift = 1;
+
+    for (size_t step = 0; step < sums.size(); ++step)
+    {
+        auto discrepancy = sums[step];
+
+        for (size_t index = 1; index <= length && index < current.size();
+            ++index)
+            discrepancy ^= multiply(current[index], sums[step - index]);
+
+        if (discrepancy == 0)
+        {
+            ++shift;
+            continue;
+        }
+
+        const auto scale = multiply(discrepancy, invert(prior_discrepancy));
+        auto next = current;
+        next.resize(std::max(next.size(), prior.size() + shift), 0);
+
+        for (size_t index = 0; index < prior.size(); ++index)
+            next[index + shift] ^= multiply(scale, prior[index]);
+
+        if (2 * length <= step)
+        {
+            prior = std::move(current);
+            prior_discrepancy = discrepancy;
+            length = step + 1 - length;
+            shift = 1;
+        }
+        else
+        {
+            ++shift;
+        }
+
+        current = std::move(next);
+        trim(current);
+    }
+
+    // A locator of lower degree than its length has a zero root (invalid).
+    return degree(current) == length ? current : polynomial{};
+}
+
+// static
+size_t pin_sketch::estimate_capacity(size_t local, size_t remote, double q,
+    size_t maximum)
+{
+    const auto difference = local > remote ? local - remote : remote - local;
+    const auto smaller = std::min(local, remote);
+    const auto expected = static_cast<size_t>(std::max(q, 0.0) * smaller);
+    return std::min(difference + expected + 1, maximum);
+}
+
+pin_sketch::pin_sketch(size_t capacity)
+  : sums_(capacity, 0)
+{
+}
+
+bool pin_sketch::from_data(const data_chunk& data)
+{
+    if (data.size() % element_size != 0)
+        return false;
+
+    byte_reader source(data);
+    sums_.resize(data.size() / element_size);
+
+    for (auto& sum: sums_)
+        sum = source.read_4_bytes_little_endian();
+
+    return true;
+}
+
+data_chunk pin_sketch::to_data() const
+{
+    data_chunk out;
+    out.reserve(sums_.size() * element_size);
+    byte_writer sink(out);
+
+    for (const auto sum: sums_)
+        sink.write_4_bytes_little_endian(sum);
+
+    return out;
+}
+
+size_t pin_sketch::capacity() const
+{
+    return sums_.size();
+}
+
+void pin_sketch::add(element value)
+{
+    if (value != 0)
+        gf2_32_add_odd_powers(sums_.data(), sums_.size(), value);
+}
+
+pin_sketch& pin_sketch::operator^=(const pin_sketch& other)
+{
+    sums_.resize(std::min(sums_.size(), other.sums_.size()));
+
+    for (size_t index = 0; index < sums_.size(); ++index)
+        sums_[index] ^= other.sums_[index];
+
+    return *this;
+}
+
+bool pin_sketch::operator==(const pin_sketch& other) const
+{
+    return sums_ == other.sums_;
+}
+
+bool pin_sketch::operator!=(const pin_sketch& other) const
+{
+    return !(*this == other);
+}
+
+bool pin_sketch::decode(elements& out) const
+{
+    out.clear();
+
+    // The even power sums are the squares of the half powers: s2k = sk^2.
+    std::vector<uint32_t> sums(2 * sums_.size());
+
+    for (size_t power = 1; power <= sums.size(); ++power)
+    {
+        if (power % 2 == 1)
+        {
+            sums[power - 1] = sums_[power / 2];
+            continue;
+        }
+
+        const auto half = sums[power / 2 - 1];
+        sums[power - 1] = multiply(half, half);
+    }
+
+    const auto locator = locate(sums);
+
+    if (locator.empty() || degree(locator) > sums_.size())
+        return false;
+
+    if (degree(locator) == 0)
+        return true;
+
+    // The reversed locator is the monic product of (x - element).
+    const polynomial roots(locator.rbegin(), locator.rend());
+
+    if (!splits(roots) || !find_roots(out, roots, 0))
+    {
+        out.clear();
+        return false;
+    }
+
+    // Sketching the decoded set guards against a false decode.
+    pin_sketch check(sums_.size());
+
+    for (const auto value: out)
+        check.add(value);
+
+    if (check != *this)
+    {
+        out.clear();
+        return false;
+    }
+
+    std::sort(out.begin(), out.end());
+    return true;
+}
+
+} // namespace libbitcoin
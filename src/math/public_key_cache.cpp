@@ -0,0 +1,120 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/math/public_key_cache.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/bitcoin/math/elliptic_curve.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+
+namespace libbitcoin {
+
+const size_t public_key_cache::entry_size = entries::entry_size;
+
+// static
+public_key_cache& public_key_cache::parsed_keys()
+{
+    static public_key_cache cache;
+    return cache;
+}
+
+public_key_cache::public_key_cache(size_t maximum_bytes)
+  : entries_(maximum_bytes / entry_size)
+{
+}
+
+// private
+bool public_key_cache::to_key(key& out, data_slice point)
+{
+    const auto size = point.size();
+
+    if (size > ec_uncompressed_size)
+        return false;
+
+    out.front() = static_cast<uint8_t>(size);
+    std::copy_n(point.begin(), size, out.begin() + 1);
+    std::fill(out.begin() + 1 + size, out.end(), 0x00);
+    return true;
+}
+
+bool public_key_cache::find(parsed_key& out, data_slice point) const
+{
+    key value;
+    if (!enabled() || !to_key(value, point))
+        return false;
+
+    return entries_.find(out, value);
+}
+
+void public_key_cache::insert(data_slice point, const parsed_key& parsed)
+{
+    key value;
+    if (!enabled() || !to_key(value, point))
+        return;
+
+    entries_.insert(value, parsed);
+}
+
+void public_key_cache::resize(size_t maximum_bytes)
+{
+    entries_.resize(maximum_bytes / entry_size);
+}
+
+void public_key_cache::clear()
+{
+    entries_.clear();
+}
+
+bool public_key_cache::enabled() const
+{
+    return entries_.enabled();
+}
+
+size_t public_key_cache::size() const
+{
+    return entries_.size();
+}
+
+size_t public_key_cache::capacity() const
+{
+    return entries_.capacity();
+}
+
+uint64_t public_key_cache::hits() const
+{
+    return entries_.hits();
+}
+
+uint64_t public_key_cache::misses() const
+{
+    return entries_.misses();
+}
+
+uint64_t public_key_cache::evictions() const
+{
+    return entries_.evictions();
+}
+
+float public_key_cache::hit_rate() const
+{
+    return entries_.hit_rate();
+}
+
+} // namespace libbitcoin
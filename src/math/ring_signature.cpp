@@ -19,20 +19,31 @@
 #include <bitcoin/bitcoin/math/ring_signature.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <map>
+#include <memory>
 #include <numeric>
 #include <vector>
 #include <secp256k1.h>
+#include <bitcoin/bitcoin/error.hpp>
 #include <bitcoin/bitcoin/math/ec_point.hpp>
+#include <bitcoin/bitcoin/math/ec_point_table.hpp>
 #include <bitcoin/bitcoin/math/ec_scalar.hpp>
 #include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/parallel.hpp>
 #include <bitcoin/bitcoin/utility/serializer.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
 #include <bitcoin/bitcoin/wallet/hd_private.hpp>
 
 namespace libbitcoin {
 
 typedef std::vector<uint32_t> index_list;
 typedef std::map<ec_compressed, ec_secret> secret_keys_map;
+typedef std::shared_ptr<const ec_point_table> point_table_ptr;
+
+// A key table costs several multiplications to build, so tables are only
+// built for batches of at least this many signatures.
+static constexpr size_t table_threshold = 8;
 
 static ec_scalar borromean_hash(const hash_digest& M, data_slice R, uint32_t i,
     uint32_t j)
@@ -132,20 +143,40 @@ static bool generate_known_indexes(index_list& out, const key_rings& rings,
     return !has_empty && create_key_indexes(out, rings, known_keys_by_ring);
 }
 
+// R = s * G + e * P. The product of G uses the generator multiples of the
+// signing context, and the product of P uses its table if one is provided.
+static bool calculate_R(ec_compressed& out, const ec_scalar& s,
+    const ec_scalar& e, const ec_compressed& P, const ec_point_table* table)
+{
+    auto product = P;
+
+    if (!secret_to_public(out, s.secret()))
+        return false;
+
+    if (table == nullptr ? !ec_multiply(product, e.secret()) :
+        !table->multiply(product, e.secret()))
+        return false;
+
+    return ec_sum(out, { out, product });
+}
+
 static ec_point calculate_R(const ec_scalar& s, const ec_scalar& e,
-    const ec_point& P)
+    const ec_compressed& P)
 {
-    return s * ec_point::G + e * P;
+    ec_compressed R;
+    return calculate_R(R, s, e, P, nullptr) ? ec_point(R) : ec_point();
 }
 
 static ec_point calculate_last_R_signing(const point_list& ring,
     uint32_t i, const hash_digest& digest, const ring_signature& signature,
     const uint32_t known_key_index, const secret_list& salts)
 {
-    auto R_i_j = salts[i] * ec_point::G;
-    if (!R_i_j)
+    ec_compressed R;
+    if (!secret_to_public(R, salts[i]))
         return ec_point();
 
+    ec_point R_i_j(R);
+
     // Start one above index of known key and loop until the end.
     for (uint32_t j = known_key_index + 1; j < ring.size(); ++j)
     {
@@ -264,32 +295,69 @@ static bool join_rings(ring_signature& out, const key_rings& rings,
     return true;
 }
 
-static ec_point calculate_last_R_verify(const point_list& ring,
-    ec_scalar e_i_j, uint32_t i, const hash_digest& digest,
+// The rings and proofs must correspond, and the ring indexes must fit.
+static bool is_matched(const key_rings& rings,
     const ring_signature& signature)
 {
-    ec_point R_i_j;
+    if (rings.size() >= max_uint32 ||
+        signature.proofs.size() != rings.size())
+        return false;
+
+    for (size_t i = 0; i < rings.size(); ++i)
+        if (signature.proofs[i].size() != rings[i].size())
+            return false;
+
+    return true;
+}
+
+// Calculate the last R value of ring i, from its first e value. The tables,
+// if not null, are those of the keys of the ring in order.
+static bool calculate_last_R_verify(ec_compressed& out,
+    const point_list& ring, uint32_t i, const hash_digest& digest,
+    const ring_signature& signature, const point_table_ptr* tables)
+{
     BITCOIN_ASSERT(signature.proofs[i].size() == ring.size());
 
+    // Calculate first e value for this ring.
+    auto e_i_j = borromean_hash(digest, signature.challenge, i, 0);
+
+    if (ring.empty())
+        return false;
+
     for (uint32_t j = 0; j < ring.size(); ++j)
     {
         // s_i_j
         const ec_scalar s = signature.proofs[i][j];
 
         if (!s || !e_i_j)
-            return ec_point();
+            return false;
 
         // Calculate R and e values until the end.
-        R_i_j = calculate_R(s, e_i_j, ring[j]);
-        if (!R_i_j)
-            return ec_point();
+        const auto table = tables == nullptr ? nullptr : tables[j].get();
+        if (!calculate_R(out, s, e_i_j, ring[j], table))
+            return false;
 
         // Calculate the next e value.
-        e_i_j = borromean_hash(digest, R_i_j.point(), i, j + 1u);
+        e_i_j = borromean_hash(digest, out, i, j + 1u);
         if (!e_i_j)
-            return ec_point();
+            return false;
     }
-    return R_i_j;
+
+    return true;
+}
+
+// Hash the last R value of each ring with the digest to recalculate e0.
+static bool is_challenge(const point_list& last_Rs, const hash_digest& digest,
+    const ring_signature& signature)
+{
+    data_chunk e0_data;
+    e0_data.reserve(ec_compressed_size * last_Rs.size() + hash_size);
+
+    for (const auto& last_R: last_Rs)
+        extend_data(e0_data, last_R);
+
+    extend_data(e0_data, digest);
+    return sha256_hash(e0_data) == signature.challenge;
 }
 
 // API
@@ -347,38 +415,116 @@ bool sign(ring_signature& out, const secret_list& secrets,
 bool verify(const key_rings& rings, const hash_digest& digest,
     const ring_signature& signature)
 {
-    // Guard against overflow.
-    if (rings.size() >= max_uint32)
+    if (!is_matched(rings, signature))
         return false;
 
-    data_chunk e0_data;
-    e0_data.reserve(ec_compressed_size * rings.size() + hash_size);
-    BITCOIN_ASSERT(signature.proofs.size() == rings.size());
+    point_list last_Rs(rings.size());
 
     for (uint32_t i = 0; i < rings.size(); ++i)
-    {
-        // Calculate first e value for this ring.
-        const auto e_i_0 = borromean_hash(digest, signature.challenge, i, 0);
-        if (!e_i_0)
+        if (!calculate_last_R_verify(last_Rs[i], rings[i], i, digest,
+            signature, nullptr))
             return false;
 
-        // Calculate the last R value.
-        const auto last_R = calculate_last_R_verify(rings[i], e_i_0, i,
-            digest, signature);
-        if (!last_R)
-            return false;
+    return is_challenge(last_Rs, digest, signature);
+}
 
-        // Add this ring to e0.
-        extend_data(e0_data, last_R.point());
+// Each ring depends only upon the challenge, so rings are independent.
+bool verify(const key_rings& rings, const hash_digest& digest,
+    const ring_signature& signature, threadpool& pool)
+{
+    if (!is_matched(rings, signature))
+        return false;
+
+    point_list last_Rs(rings.size());
+
+    const auto ring = [&](size_t i)
+    {
+        return calculate_last_R_verify(last_Rs[i], rings[i],
+            static_cast<uint32_t>(i), digest, signature, nullptr) ?
+                error::success : error::operation_failed;
+    };
+
+    return !parallel_for(pool, rings.size(), 1, ring) &&
+        is_challenge(last_Rs, digest, signature);
+}
+
+std::vector<bool> verify(const key_rings& rings, const hash_list& digests,
+    const std::vector<ring_signature>& signatures, threadpool& pool)
+{
+    const auto count = signatures.size();
+    const auto ring_count = rings.size();
+
+    if (digests.size() != count)
+        return std::vector<bool>(count, false);
+
+    // The table of each key is at the offset of its ring plus its index.
+    std::vector<size_t> offsets;
+    std::vector<point_table_ptr> tables;
+
+    if (count >= table_threshold)
+    {
+        point_list keys;
+
+        for (const auto& ring: rings)
+        {
+            offsets.push_back(keys.size());
+            keys.insert(keys.end(), ring.begin(), ring.end());
+        }
+
+        tables.resize(keys.size());
+
+        const auto build = [&keys, &tables](size_t index)
+        {
+            tables[index] = std::make_shared<ec_point_table>(keys[index]);
+            return error::success;
+        };
+
+        parallel_for(pool, keys.size(), 1, build);
     }
 
-    extend_data(e0_data, digest);
+    // Bytes rather than bits, so that results are written concurrently.
+    std::vector<uint8_t> matched(count);
+    std::vector<uint8_t> computed(count * ring_count, 0);
+    std::vector<point_list> last_Rs(count, point_list(ring_count));
+
+    for (size_t index = 0; index < count; ++index)
+        matched[index] = is_matched(rings, signatures[index]) ? 1 : 0;
+
+    // Each ring of each signature is independent.
+    const auto ring = [&](size_t index)
+    {
+        const auto signature = index / ring_count;
+        const auto i = index % ring_count;
 
-    // Hash data to produce e0 value.
-    const auto e0_hash = sha256_hash(e0_data);
+        if (matched[signature] == 0)
+            return error::success;
+
+        const auto ring_tables = tables.empty() ? nullptr :
+            &tables[offsets[i]];
+
+        computed[index] = calculate_last_R_verify(last_Rs[signature][i],
+            rings[i], static_cast<uint32_t>(i), digests[signature],
+            signatures[signature], ring_tables) ? 1 : 0;
+
+        return error::success;
+    };
+
+    parallel_for(pool, count * ring_count, 1, ring);
+
+    std::vector<bool> out(count, false);
+
+    for (size_t signature = 0; signature < count; ++signature)
+    {
+        const auto first = computed.begin() + signature * ring_count;
+        const auto complete = std::all_of(first, first + ring_count,
+            [](uint8_t value) { return value != 0; });
+
+        out[signature] = matched[signature] != 0 && complete &&
+            is_challenge(last_Rs[signature], digests[signature],
+                signatures[signature]);
+    }
 
-    // Verification step.
-    return e0_hash == signature.challenge;
+    return out;
 }
 
 } // namespace libbitcoin
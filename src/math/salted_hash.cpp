@@ -0,0 +1,38 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/math/salted_hash.hpp>
+
+#include <bitcoin/bitcoin/math/siphash.hpp>
+#include <bitcoin/bitcoin/utility/pseudo_random.hpp>
+
+namespace libbitcoin {
+
+static siphash_key new_salt()
+{
+    return{ pseudo_random::next(), pseudo_random::next() };
+}
+
+// Static initialization of the local is thread safe.
+const siphash_key& hash_salt()
+{
+    static const auto salt = new_salt();
+    return salt;
+}
+
+} // namespace libbitcoin
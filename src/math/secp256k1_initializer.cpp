@@ -18,8 +18,12 @@
  */
 #include "secp256k1_initializer.hpp"
 
+#include <cstdint>
 #include <mutex>
+#include <random>
 #include <secp256k1.h>
+#include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
 
 namespace libbitcoin {
 
@@ -60,6 +64,51 @@ secp256k1_signing::secp256k1_signing()
 {
 }
 
+// Destroys the thread's clone on thread exit.
+struct thread_signing_context
+{
+    ~thread_signing_context()
+    {
+        if (context != nullptr)
+            secp256k1_context_destroy(context);
+    }
+
+    secp256k1_context* context = nullptr;
+};
+
+// Cloning copies the generator tables, which is much cheaper than creating
+// them. Randomization blinds the generator multiplication with a seed unique
+// to the thread. Signatures are deterministic (rfc6979), so are unaffected.
+secp256k1_context* secp256k1_signing::context()
+{
+    static thread_local thread_signing_context local;
+
+    if (local.context != nullptr)
+        return local.context;
+
+    const auto shared = shared_context();
+    const auto clone = secp256k1_context_clone(shared);
+
+    if (clone == nullptr)
+        return shared;
+
+    std::random_device device;
+    std::uniform_int_distribution<uint16_t> distribution(0, max_uint8);
+    hash_digest seed;
+
+    for (auto& byte: seed)
+        byte = static_cast<uint8_t>(distribution(device));
+
+    secp256k1_context_randomize(clone, seed.data());
+    local.context = clone;
+    return clone;
+}
+
+secp256k1_context* secp256k1_signing::shared_context()
+{
+    return secp256k1_initializer::context();
+}
+
 // Concrete type for verification init.
 secp256k1_verification::secp256k1_verification()
   : secp256k1_initializer(SECP256K1_CONTEXT_VERIFY)
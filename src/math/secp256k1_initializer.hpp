@@ -63,6 +63,9 @@ private:
 
 /**
  * Create and hold this class to initialize signing context on first use.
+ * The shared context is cloned for each thread that signs and the clone is
+ * randomized (blinded against side channels) with a fresh seed, so that the
+ * clone may be mutated without synchronization.
  */
 class BC_API secp256k1_signing
   : public secp256k1_initializer
@@ -72,6 +75,17 @@ public:
      * Construct a signing context initializer.
      */
     secp256k1_signing();
+
+    /**
+     * Call to obtain the calling thread's randomized secp256k1 context,
+     * cloned from the shared context on first call by the thread.
+     */
+    secp256k1_context* context();
+
+    /**
+     * Call to obtain the shared (unrandomized) secp256k1 context.
+     */
+    secp256k1_context* shared_context();
 };
 
 /**
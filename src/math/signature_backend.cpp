@@ -0,0 +1,81 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/math/signature_backend.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/math/elliptic_curve.hpp>
+
+namespace libbitcoin {
+
+static std::mutex backend_mutex;
+static signature_backend::ptr backend;
+
+std::string cpu_signature_backend::name() const
+{
+    return "cpu";
+}
+
+size_t cpu_signature_backend::minimum_batch() const
+{
+    return max_size_t;
+}
+
+void cpu_signature_backend::submit(const ecdsa_checks& ecdsa,
+    const schnorr_checks& schnorr, result_handler handler)
+{
+    if (!schnorr.empty() && !verify_schnorr(schnorr.data(), schnorr.size()))
+    {
+        handler(false);
+        return;
+    }
+
+    for (const auto& check: ecdsa)
+    {
+        if (!verify_signature(check.point, check.hash, check.signature))
+        {
+            handler(false);
+            return;
+        }
+    }
+
+    handler(true);
+}
+
+void set_signature_backend(signature_backend::ptr value)
+{
+    std::lock_guard<std::mutex> lock(backend_mutex);
+    backend = std::move(value);
+}
+
+signature_backend::ptr get_signature_backend()
+{
+    std::lock_guard<std::mutex> lock(backend_mutex);
+
+    if (!backend)
+        backend = std::make_shared<cpu_signature_backend>();
+
+    return backend;
+}
+
+} // namespace libbitcoin
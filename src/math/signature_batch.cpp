@@ -0,0 +1,289 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/math/signature_batch.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <secp256k1.h>
+#include <bitcoin/bitcoin/math/elliptic_curve.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/math/signature_backend.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
+#include <bitcoin/bitcoin/utility/trace.hpp>
+#include "secp256k1_initializer.hpp"
+
+namespace libbitcoin {
+
+static_assert(sizeof(secp256k1_pubkey) == 64, "parsed point size");
+static_assert(sizeof(secp256k1_ecdsa_signature) == ec_signature_size,
+    "parsed signature size");
+
+// Schnorr batches smaller than this are not split over threads, as the
+// multi-scalar multiplication is less efficient for fewer signatures.
+static constexpr size_t minimum_schnorr_chunk = 256;
+
+// Claims and verifies checks in order until exhausted or failed. The Schnorr
+// chunks are claimed first, as each is much larger than an ECDSA check.
+struct signature_batch::verifier
+{
+    verifier(const signature_batch& batch, size_t chunks)
+      : batch(batch),
+        chunks(chunks),
+        size(chunks + batch.checks_.size()),
+        next(0),
+        valid(true),
+        running(0)
+    {
+    }
+
+    void run()
+    {
+        mutex.lock();
+        ++running;
+        mutex.unlock();
+
+        size_t index;
+        while ((index = next.fetch_add(1)) < size)
+        {
+            if (!(index < chunks ? batch.verify_schnorr(index, chunks) :
+                batch.verify(index - chunks)))
+            {
+                // Exhaust the claims, the batch has failed.
+                next.store(size);
+                valid.store(false);
+            }
+        }
+
+        mutex.lock();
+        const auto idle = (--running == 0);
+        mutex.unlock();
+
+        if (idle)
+            finished.notify_all();
+    }
+
+    // Wait for all claimed checks to complete, call only after run().
+    bool wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        finished.wait(lock, [this]() { return running == 0; });
+        return valid.load();
+    }
+
+    const signature_batch& batch;
+    const size_t chunks;
+    const size_t size;
+    std::atomic<size_t> next;
+    std::atomic<bool> valid;
+
+    // This is protected by mutex.
+    size_t running;
+    std::mutex mutex;
+    std::condition_variable finished;
+};
+
+signature_batch::signature_batch()
+  : valid_(true)
+{
+}
+
+bool signature_batch::add(data_slice point, const hash_digest& hash,
+    const ec_signature& signature)
+{
+    const auto context = verification.context();
+    const data_chunk key(point.begin(), point.end());
+    auto it = indexes_.find(key);
+
+    if (it == indexes_.end())
+    {
+        secp256k1_pubkey pubkey;
+        if (secp256k1_ec_pubkey_parse(context, &pubkey, point.data(),
+            point.size()) != 1)
+        {
+            valid_ = false;
+            return false;
+        }
+
+        parsed_point parsed;
+        std::copy_n(std::begin(pubkey.data), parsed.size(), parsed.begin());
+        points_.push_back(parsed);
+        it = indexes_.emplace(key, points_.size() - 1).first;
+        keys_.push_back(&it->first);
+    }
+
+    // Copy to avoid exposing external types.
+    secp256k1_ecdsa_signature parsed;
+    std::copy_n(signature.begin(), ec_signature_size, std::begin(parsed.data));
+
+    // secp256k1_ecdsa_verify rejects non-normalized (low-s) signatures, but
+    // bitcoin does not have such a limitation, so we always normalize.
+    secp256k1_ecdsa_signature normal;
+    secp256k1_ecdsa_signature_normalize(context, &normal, &parsed);
+
+    check entry{ it->second, hash, {} };
+    std::copy_n(std::begin(normal.data), ec_signature_size,
+        entry.signature.begin());
+    checks_.push_back(entry);
+    return true;
+}
+
+void signature_batch::add_schnorr(const ec_xonly& point,
+    const hash_digest& message, const schnorr_signature& signature)
+{
+    schnorr_checks_.push_back({ point, message, signature });
+}
+
+size_t signature_batch::size() const
+{
+    return checks_.size() + schnorr_checks_.size();
+}
+
+bool signature_batch::empty() const
+{
+    return checks_.empty() && schnorr_checks_.empty();
+}
+
+void signature_batch::clear()
+{
+    valid_ = true;
+    checks_.clear();
+    schnorr_checks_.clear();
+    points_.clear();
+    keys_.clear();
+    indexes_.clear();
+}
+
+// private
+bool signature_batch::verify(size_t index) const
+{
+    const auto& entry = checks_[index];
+    const auto& point = points_[entry.point];
+
+    secp256k1_pubkey pubkey;
+    std::copy_n(point.begin(), point.size(), std::begin(pubkey.data));
+
+    secp256k1_ecdsa_signature signature;
+    std::copy_n(entry.signature.begin(), ec_signature_size,
+        std::begin(signature.data));
+
+    const auto context = verification.context();
+    return secp256k1_ecdsa_verify(context, &signature, entry.hash.data(),
+        &pubkey) == 1;
+}
+
+// private
+// The backend is given serialized points, as the parsed form is internal to
+// libsecp256k1. The handler may be invoked on any thread.
+bool signature_batch::verify(signature_backend& backend) const
+{
+    signature_backend::ecdsa_checks ecdsa;
+    ecdsa.reserve(checks_.size());
+
+    for (const auto& check: checks_)
+        ecdsa.push_back({ *keys_[check.point], check.hash, check.signature });
+
+    std::promise<bool> promise;
+    backend.submit(ecdsa, schnorr_checks_, [&promise](bool valid)
+    {
+        promise.set_value(valid);
+    });
+
+    return promise.get_future().get();
+}
+
+// private
+// The Schnorr checks are divided evenly into the number of chunks.
+bool signature_batch::verify_schnorr(size_t chunk, size_t chunks) const
+{
+    const auto count = schnorr_checks_.size();
+    const auto begin = count * chunk / chunks;
+    const auto end = count * (chunk + 1) / chunks;
+    return libbitcoin::verify_schnorr(schnorr_checks_.data() + begin,
+        end - begin);
+}
+
+// private
+size_t signature_batch::schnorr_chunks(size_t threads) const
+{
+    const auto count = schnorr_checks_.size();
+    const auto chunks = (count + minimum_schnorr_chunk - 1) /
+        minimum_schnorr_chunk;
+    return std::min(chunks, threads);
+}
+
+bool signature_batch::verify() const
+{
+    BC_TRACE_SPAN("script", "signature_batch");
+
+    if (!valid_)
+        return false;
+
+    const auto backend = get_signature_backend();
+
+    if (!empty() && size() >= backend->minimum_batch())
+        return verify(*backend);
+
+    if (!schnorr_checks_.empty() && !verify_schnorr(0, 1))
+        return false;
+
+    for (size_t index = 0; index < checks_.size(); ++index)
+        if (!verify(index))
+            return false;
+
+    return true;
+}
+
+// The calling thread participates in verification, so this will not deadlock
+// when invoked from a thread of the pool. Pool jobs that run after return
+// find no remaining checks and so do not reference the batch.
+bool signature_batch::verify(threadpool& pool) const
+{
+    // The calling thread is one of the verifiers.
+    const auto threads = pool.size() + 1;
+    const auto chunks = schnorr_chunks(threads);
+    const auto claims = chunks + checks_.size();
+
+    // There is no benefit in dispatching fewer than two claims. The
+    // registered backend is also dispatched to by verify().
+    if (!valid_ || pool.empty() || claims < 2 ||
+        size() >= get_signature_backend()->minimum_batch())
+        return verify();
+
+    BC_TRACE_SPAN("script", "signature_batch");
+    const auto checker = std::make_shared<verifier>(*this, chunks);
+    const auto jobs = std::min(pool.size(), claims - 1);
+
+    for (size_t job = 0; job < jobs; ++job)
+        pool.service().post([checker]()
+        {
+            BC_TRACE_SPAN("threadpool", "signature_batch");
+            checker->run();
+        });
+
+    checker->run();
+    return checker->wait();
+}
+
+} // namespace libbitcoin
@@ -0,0 +1,169 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/math/signature_cache.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <bitcoin/bitcoin/math/elliptic_curve.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/pseudo_random.hpp>
+#include "../math/external/sha256.h"
+
+namespace libbitcoin {
+
+const size_t signature_cache::entry_size = entries::entry_size;
+
+signature_cache::signature_cache(size_t maximum_bytes)
+  : persistent_(false), entries_(maximum_bytes / entry_size)
+{
+    // The salt precludes construction of colliding keys by a peer.
+    pseudo_random::fill(salt_);
+}
+
+size_t signature_cache::key_hasher::operator()(const hash_digest& key) const
+{
+    size_t value;
+    std::memcpy(&value, key.data(), sizeof(value));
+    return value;
+}
+
+// private
+hash_digest signature_cache::to_key(const hash_digest& sighash,
+    data_slice point, const ec_signature& signature) const
+{
+    hash_digest key;
+    SHA256CTX context;
+    SHA256Init(&context);
+    SHA256Update(&context, salt_.data(), salt_.size());
+    SHA256Update(&context, sighash.data(), sighash.size());
+    SHA256Update(&context, point.data(), point.size());
+    SHA256Update(&context, signature.data(), signature.size());
+    SHA256Final(&context, key.data());
+    return key;
+}
+
+bool signature_cache::contains(const hash_digest& sighash, data_slice point,
+    const ec_signature& signature) const
+{
+    if (!enabled())
+        return false;
+
+    return entries_.contains(to_key(sighash, point, signature));
+}
+
+void signature_cache::insert(const hash_digest& sighash, data_slice point,
+    const ec_signature& signature)
+{
+    if (!enabled())
+        return;
+
+    entries_.insert(to_key(sighash, point, signature), true);
+}
+
+void signature_cache::resize(size_t maximum_bytes)
+{
+    entries_.resize(maximum_bytes / entry_size);
+}
+
+void signature_cache::set_secret(const hash_digest& secret)
+{
+    clear();
+    salt_ = cache_snapshot::to_salt(secret, "signature_cache");
+    persistent_ = true;
+}
+
+bool signature_cache::store(const path& file) const
+{
+    if (!persistent_)
+        return false;
+
+    hash_list keys;
+    keys.reserve(entries_.size());
+    entries_.visit([&keys](const hash_digest& key, bool)
+    {
+        keys.push_back(key);
+    });
+
+    return cache_snapshot::store(file, salt_, 0, keys);
+}
+
+size_t signature_cache::load(const path& file, threadpool& pool,
+    const asio::duration& timeout)
+{
+    cache_snapshot snapshot;
+
+    if (!enabled() || !persistent_ || !snapshot.open(file, salt_))
+        return 0;
+
+    // Loading stops when full, so as not to evict loaded entries.
+    const auto insert = [this](const hash_digest& key)
+    {
+        if (entries_.cost() >= entries_.capacity())
+            return false;
+
+        entries_.insert(key, true);
+        return true;
+    };
+
+    return snapshot.load(pool, timeout, insert);
+}
+
+void signature_cache::clear()
+{
+    entries_.clear();
+}
+
+bool signature_cache::enabled() const
+{
+    return entries_.enabled();
+}
+
+size_t signature_cache::size() const
+{
+    return entries_.size();
+}
+
+size_t signature_cache::capacity() const
+{
+    return entries_.capacity();
+}
+
+uint64_t signature_cache::hits() const
+{
+    return entries_.hits();
+}
+
+uint64_t signature_cache::misses() const
+{
+    return entries_.misses();
+}
+
+uint64_t signature_cache::evictions() const
+{
+    return entries_.evictions();
+}
+
+float signature_cache::hit_rate() const
+{
+    return entries_.hit_rate();
+}
+
+} // namespace libbitcoin
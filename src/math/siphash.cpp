@@ -0,0 +1,292 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/math/siphash.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/endian.hpp>
+
+namespace libbitcoin {
+
+// SipHash-c-d (Aumasson and Bernstein), c compression rounds per word and d
+// finalization rounds. SipHash-2-4 is the standard (and bip152) variant,
+// SipHash-1-3 is the faster variant used for hash table keys.
+
+static constexpr size_t word_size = sizeof(uint64_t);
+
+struct siphash_state
+{
+    uint64_t v0;
+    uint64_t v1;
+    uint64_t v2;
+    uint64_t v3;
+};
+
+static inline uint64_t rotate_left(uint64_t value, uint32_t shift)
+{
+    return (value << shift) | (value >> (64u - shift));
+}
+
+static inline void sip_round(siphash_state& state)
+{
+    state.v0 += state.v1;
+    state.v1 = rotate_left(state.v1, 13);
+    state.v1 ^= state.v0;
+    state.v0 = rotate_left(state.v0, 32);
+    state.v2 += state.v3;
+    state.v3 = rotate_left(state.v3, 16);
+    state.v3 ^= state.v2;
+    state.v0 += state.v3;
+    state.v3 = rotate_left(state.v3, 21);
+    state.v3 ^= state.v0;
+    state.v2 += state.v1;
+    state.v1 = rotate_left(state.v1, 17);
+    state.v1 ^= state.v2;
+    state.v2 = rotate_left(state.v2, 32);
+}
+
+static inline siphash_state initialize(const siphash_key& key)
+{
+    return
+    {
+        0x736f6d6570736575ull ^ key.first,
+        0x646f72616e646f6dull ^ key.second,
+        0x6c7967656e657261ull ^ key.first,
+        0x7465646279746573ull ^ key.second
+    };
+}
+
+template <size_t Rounds>
+static inline void compress(siphash_state& state, uint64_t word)
+{
+    state.v3 ^= word;
+
+    for (size_t round = 0; round < Rounds; ++round)
+        sip_round(state);
+
+    state.v0 ^= word;
+}
+
+template <size_t Rounds>
+static inline uint64_t finalize(siphash_state& state)
+{
+    state.v2 ^= 0xff;
+
+    for (size_t round = 0; round < Rounds; ++round)
+        sip_round(state);
+
+    return state.v0 ^ state.v1 ^ state.v2 ^ state.v3;
+}
+
+template <size_t Compression, size_t Finalization>
+static uint64_t siphash_message(const siphash_key& key, data_slice message)
+{
+    auto state = initialize(key);
+    const auto size = message.size();
+    const auto data = message.data();
+    const auto words = size / word_size;
+
+    for (size_t word = 0; word < words; ++word)
+        compress<Compression>(state, from_little_endian_unsafe<uint64_t>(
+            data + word * word_size));
+
+    // The final word carries the remaining bytes and the low byte of size.
+    auto last = static_cast<uint64_t>(size) << 56;
+    const auto tail = data + words * word_size;
+
+    for (size_t byte = 0; byte < size % word_size; ++byte)
+        last |= static_cast<uint64_t>(tail[byte]) << (8u * byte);
+
+    compress<Compression>(state, last);
+    return finalize<Finalization>(state);
+}
+
+template <size_t Compression>
+static inline void compress(siphash_state& state, const hash_digest& hash)
+{
+    const auto data = hash.data();
+    compress<Compression>(state, from_little_endian_unsafe<uint64_t>(
+        data + 0 * word_size));
+    compress<Compression>(state, from_little_endian_unsafe<uint64_t>(
+        data + 1 * word_size));
+    compress<Compression>(state, from_little_endian_unsafe<uint64_t>(
+        data + 2 * word_size));
+    compress<Compression>(state, from_little_endian_unsafe<uint64_t>(
+        data + 3 * word_size));
+}
+
+uint64_t siphash(const siphash_key& key, data_slice message)
+{
+    return siphash_message<2, 4>(key, message);
+}
+
+uint64_t siphash(const siphash_key& key, const hash_digest& hash)
+{
+    static constexpr auto terminal = uint64_t(hash_size) << 56;
+
+    auto state = initialize(key);
+    compress<2>(state, hash);
+    compress<2>(state, terminal);
+    return finalize<4>(state);
+}
+
+// Four states in separate arrays of each word, so that each step of a round
+// is the same operation over the lanes.
+static constexpr size_t lanes = 4;
+
+struct siphash_lanes
+{
+    uint64_t v0[lanes];
+    uint64_t v1[lanes];
+    uint64_t v2[lanes];
+    uint64_t v3[lanes];
+};
+
+static inline void sip_round(siphash_lanes& state)
+{
+    for (size_t lane = 0; lane < lanes; ++lane)
+    {
+        state.v0[lane] += state.v1[lane];
+        state.v1[lane] = rotate_left(state.v1[lane], 13);
+        state.v1[lane] ^= state.v0[lane];
+        state.v0[lane] = rotate_left(state.v0[lane], 32);
+        state.v2[lane] += state.v3[lane];
+        state.v3[lane] = rotate_left(state.v3[lane], 16);
+        state.v3[lane] ^= state.v2[lane];
+        state.v0[lane] += state.v3[lane];
+        state.v3[lane] = rotate_left(state.v3[lane], 21);
+        state.v3[lane] ^= state.v0[lane];
+        state.v2[lane] += state.v1[lane];
+        state.v1[lane] = rotate_left(state.v1[lane], 17);
+        state.v1[lane] ^= state.v2[lane];
+        state.v2[lane] = rotate_left(state.v2[lane], 32);
+    }
+}
+
+static inline void compress(siphash_lanes& state,
+    const uint64_t (&words)[lanes])
+{
+    for (size_t lane = 0; lane < lanes; ++lane)
+        state.v3[lane] ^= words[lane];
+
+    sip_round(state);
+    sip_round(state);
+
+    for (size_t lane = 0; lane < lanes; ++lane)
+        state.v0[lane] ^= words[lane];
+}
+
+std::vector<uint64_t> siphash(const siphash_key& key,
+    const hash_list& hashes)
+{
+    static constexpr auto terminal = uint64_t(hash_size) << 56;
+    static constexpr size_t hash_words = hash_size / word_size;
+
+    std::vector<uint64_t> out;
+    out.reserve(hashes.size());
+    const auto initial = initialize(key);
+    const auto batches = hashes.size() / lanes;
+
+    for (size_t batch = 0; batch < batches; ++batch)
+    {
+        const auto first = &hashes[batch * lanes];
+        siphash_lanes state;
+        uint64_t words[lanes];
+
+        for (size_t lane = 0; lane < lanes; ++lane)
+        {
+            state.v0[lane] = initial.v0;
+            state.v1[lane] = initial.v1;
+            state.v2[lane] = initial.v2;
+            state.v3[lane] = initial.v3;
+        }
+
+        for (size_t word = 0; word < hash_words; ++word)
+        {
+            for (size_t lane = 0; lane < lanes; ++lane)
+                words[lane] = from_little_endian_unsafe<uint64_t>(
+                    first[lane].data() + word * word_size);
+
+            compress(state, words);
+        }
+
+        for (size_t lane = 0; lane < lanes; ++lane)
+            words[lane] = terminal;
+
+        compress(state, words);
+
+        for (size_t lane = 0; lane < lanes; ++lane)
+            state.v2[lane] ^= 0xff;
+
+        for (size_t round = 0; round < 4; ++round)
+            sip_round(state);
+
+        for (size_t lane = 0; lane < lanes; ++lane)
+            out.push_back(state.v0[lane] ^ state.v1[lane] ^ state.v2[lane] ^
+                state.v3[lane]);
+    }
+
+    for (auto hash = hashes.begin() + batches * lanes; hash != hashes.end();
+        ++hash)
+        out.push_back(siphash(key, *hash));
+
+    return out;
+}
+
+uint64_t siphash13(const siphash_key& key, data_slice message)
+{
+    return siphash_message<1, 3>(key, message);
+}
+
+uint64_t siphash13(const siphash_key& key, const hash_digest& hash)
+{
+    static constexpr auto terminal = uint64_t(hash_size) << 56;
+
+    auto state = initialize(key);
+    compress<1>(state, hash);
+    compress<1>(state, terminal);
+    return finalize<3>(state);
+}
+
+// The index is the little-endian tail of a 36 byte message.
+uint64_t siphash13(const siphash_key& key, const hash_digest& hash,
+    uint32_t index)
+{
+    static constexpr auto terminal = uint64_t(hash_size +
+        sizeof(uint32_t)) << 56;
+
+    auto state = initialize(key);
+    compress<1>(state, hash);
+    compress<1>(state, terminal | index);
+    return finalize<3>(state);
+}
+
+siphash_key to_siphash_key(const hash_digest& hash)
+{
+    return
+    {
+        from_little_endian_unsafe<uint64_t>(hash.data()),
+        from_little_endian_unsafe<uint64_t>(hash.data() + word_size)
+    };
+}
+
+} // namespace libbitcoin
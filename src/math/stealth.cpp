@@ -52,7 +52,7 @@ bool to_stealth_prefix(uint32_t& out_prefix, const script& script)
     // A stealth filter is a leftmost substring of the stealth prefix.
     ////constexpr size_t size = binary::bits_per_block * sizeof(uint32_t);
 
-    const auto script_hash = bitcoin_hash(script.to_data(false));
+    const auto script_hash = bitcoin_hash(script.bytes());
     out_prefix = from_little_endian_unsafe<uint32_t>(script_hash.begin());
     return true;
 }
@@ -20,9 +20,10 @@
 
 #include <bitcoin/bitcoin/math/limits.hpp>
 #include <bitcoin/bitcoin/message/messages.hpp>
+#include <bitcoin/bitcoin/message/statistics.hpp>
 #include <bitcoin/bitcoin/message/version.hpp>
-#include <bitcoin/bitcoin/utility/container_sink.hpp>
-#include <bitcoin/bitcoin/utility/container_source.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
 #include <bitcoin/bitcoin/utility/ostream_writer.hpp>
 
@@ -35,23 +36,17 @@ const uint32_t address::version_maximum = version::level::maximum;
 
 address address::factory(uint32_t version, const data_chunk& data)
 {
-    address instance;
-    instance.from_data(version, data);
-    return instance;
+    return statistics::factory<address>(version, data);
 }
 
 address address::factory(uint32_t version, std::istream& stream)
 {
-    address instance;
-    instance.from_data(version, stream);
-    return instance;
+    return statistics::factory<address>(version, stream);
 }
 
 address address::factory(uint32_t version, reader& source)
 {
-    address instance;
-    instance.from_data(version, source);
-    return instance;
+    return statistics::factory<address>(version, source);
 }
 
 address::address()
@@ -92,8 +87,8 @@ void address::reset()
 
 bool address::from_data(uint32_t version, const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(version, istream);
+    byte_reader source(data);
+    return from_data(version, source);
 }
 
 bool address::from_data(uint32_t version, std::istream& stream)
@@ -106,13 +101,9 @@ bool address::from_data(uint32_t version, reader& source)
 {
     reset();
 
-    const auto count = source.read_size_little_endian();
-
     // Guard against potential for arbitary memory allocation.
-    if (count > max_address)
-        source.invalidate();
-    else
-        addresses_.resize(count);
+    const auto size = network_address::satoshi_fixed_size(version, true);
+    addresses_.resize(read_count(source, size, max_address));
 
     for (auto& address: addresses_)
         if (!address.from_data(version, source, true))
@@ -129,9 +120,8 @@ data_chunk address::to_data(uint32_t version) const
     data_chunk data;
     const auto size = serialized_size(version);
     data.reserve(size);
-    data_sink ostream(data);
-    to_data(version, ostream);
-    ostream.flush();
+    byte_writer sink(data);
+    to_data(version, sink);
     BITCOIN_ASSERT(data.size() == size);
     return data;
 }
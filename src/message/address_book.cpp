@@ -0,0 +1,223 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/message/address_book.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/bitcoin/math/siphash.hpp>
+#include <bitcoin/bitcoin/message/address.hpp>
+#include <bitcoin/bitcoin/message/network_address.hpp>
+#include <bitcoin/bitcoin/utility/assert.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/pseudo_random.hpp>
+
+namespace libbitcoin {
+namespace message {
+
+// Random probes of a sample before scanning from a random slot.
+static constexpr size_t sample_probes = 64;
+
+// The ipv4-mapped ipv6 prefix (::ffff:0:0/96).
+static const std::array<uint8_t, 12> ipv4_prefix
+{
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xff, 0xff }
+};
+
+address_book::address_book(size_t buckets, size_t bucket_size)
+  : buckets_(std::max(size_t{ 1 }, buckets)),
+    bucket_size_(std::max(size_t{ 1 }, bucket_size)),
+    slots_(buckets_ * bucket_size_, unspecified_network_address),
+    key_{ pseudo_random::next(), pseudo_random::next() },
+    size_(0)
+{
+}
+
+// Slots.
+//-----------------------------------------------------------------------------
+
+// A slot is empty if its port is unspecified, as no address is stored so.
+bool address_book::is_empty(const network_address& address)
+{
+    return address.port() == unspecified_ip_port;
+}
+
+// The group is hashed with a leading byte distinguishing ipv4 from ipv6, and
+// the address with its port (big endian, as on the wire), without buffering.
+size_t address_book::to_slot(const ip_address& ip, uint16_t port) const
+{
+    std::array<uint8_t, 5> group{ { 0, 0, 0, 0, 0 } };
+    std::array<uint8_t, 18> endpoint;
+
+    if (std::equal(ipv4_prefix.begin(), ipv4_prefix.end(), ip.begin()))
+    {
+        group[0] = 4;
+        group[1] = ip[12];
+        group[2] = ip[13];
+    }
+    else
+    {
+        group[0] = 6;
+        std::copy_n(ip.begin(), 4, group.begin() + 1);
+    }
+
+    std::copy(ip.begin(), ip.end(), endpoint.begin());
+    endpoint[16] = static_cast<uint8_t>(port >> 8);
+    endpoint[17] = static_cast<uint8_t>(port);
+
+    const auto bucket = siphash13(key_, group) % buckets_;
+    const auto position = siphash13(key_, endpoint) % bucket_size_;
+    return static_cast<size_t>(bucket * bucket_size_ + position);
+}
+
+// Insertion.
+//-----------------------------------------------------------------------------
+
+bool address_book::insert(const network_address& address)
+{
+    if (is_empty(address))
+        return false;
+
+    auto& slot = slots_[to_slot(address.ip(), address.port())];
+
+    if (is_empty(slot))
+    {
+        slot = address;
+        ++size_;
+        return true;
+    }
+
+    if (slot.timestamp() >= address.timestamp())
+        return false;
+
+    const auto same = slot.ip() == address.ip() &&
+        slot.port() == address.port();
+    slot = address;
+    return !same;
+}
+
+size_t address_book::insert(const address& message)
+{
+    size_t added = 0;
+
+    for (const auto& address: message.addresses())
+        added += insert(address) ? 1 : 0;
+
+    return added;
+}
+
+bool address_book::erase(const ip_address& ip, uint16_t port)
+{
+    if (port == unspecified_ip_port)
+        return false;
+
+    auto& slot = slots_[to_slot(ip, port)];
+
+    if (is_empty(slot) || slot.ip() != ip || slot.port() != port)
+        return false;
+
+    slot = unspecified_network_address;
+    --size_;
+    return true;
+}
+
+void address_book::clear()
+{
+    std::fill(slots_.begin(), slots_.end(), unspecified_network_address);
+    key_ = { pseudo_random::next(), pseudo_random::next() };
+    size_ = 0;
+}
+
+// Queries.
+//-----------------------------------------------------------------------------
+
+const network_address* address_book::find(const ip_address& ip,
+    uint16_t port) const
+{
+    if (port == unspecified_ip_port)
+        return nullptr;
+
+    const auto& slot = slots_[to_slot(ip, port)];
+    return !is_empty(slot) && slot.ip() == ip && slot.port() == port ?
+        &slot : nullptr;
+}
+
+bool address_book::contains(const ip_address& ip, uint16_t port) const
+{
+    return find(ip, port) != nullptr;
+}
+
+// Random probes are expected to succeed in a book that is not sparse, and
+// the scan bounds the cost otherwise.
+bool address_book::sample(network_address& out_address) const
+{
+    if (size_ == 0)
+        return false;
+
+    const auto last = slots_.size() - 1;
+
+    for (size_t probe = 0; probe < sample_probes; ++probe)
+    {
+        const auto& slot = slots_[pseudo_random::next(0, last)];
+
+        if (!is_empty(slot))
+        {
+            out_address = slot;
+            return true;
+        }
+    }
+
+    const auto start = pseudo_random::next(0, last);
+
+    for (size_t offset = 0; offset < slots_.size(); ++offset)
+    {
+        const auto& slot = slots_[(start + offset) % slots_.size()];
+
+        if (!is_empty(slot))
+        {
+            out_address = slot;
+            return true;
+        }
+    }
+
+    BITCOIN_ASSERT_MSG(false, "address book size is inconsistent");
+    return false;
+}
+
+// Properties.
+//-----------------------------------------------------------------------------
+
+size_t address_book::size() const
+{
+    return size_;
+}
+
+bool address_book::empty() const
+{
+    return size_ == 0;
+}
+
+size_t address_book::capacity() const
+{
+    return slots_.size();
+}
+
+} // namespace message
+} // namespace libbitcoin
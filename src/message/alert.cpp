@@ -20,10 +20,11 @@
 
 #include <bitcoin/bitcoin/math/limits.hpp>
 #include <bitcoin/bitcoin/message/messages.hpp>
+#include <bitcoin/bitcoin/message/statistics.hpp>
 #include <bitcoin/bitcoin/message/version.hpp>
 #include <bitcoin/bitcoin/utility/assert.hpp>
-#include <bitcoin/bitcoin/utility/container_sink.hpp>
-#include <bitcoin/bitcoin/utility/container_source.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
 #include <bitcoin/bitcoin/utility/ostream_writer.hpp>
 
@@ -36,23 +37,17 @@ const uint32_t alert::version_maximum = version::level::maximum;
 
 alert alert::factory(uint32_t version, const data_chunk& data)
 {
-    alert instance;
-    instance.from_data(version, data);
-    return instance;
+    return statistics::factory<alert>(version, data);
 }
 
 alert alert::factory(uint32_t version, std::istream& stream)
 {
-    alert instance;
-    instance.from_data(version, stream);
-    return instance;
+    return statistics::factory<alert>(version, stream);
 }
 
 alert alert::factory(uint32_t version, reader& source)
 {
-    alert instance;
-    instance.from_data(version, source);
-    return instance;
+    return statistics::factory<alert>(version, source);
 }
 
 alert::alert()
@@ -95,8 +90,8 @@ void alert::reset()
 
 bool alert::from_data(uint32_t version, const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(version, istream);
+    byte_reader source(data);
+    return from_data(version, source);
 }
 
 bool alert::from_data(uint32_t version, std::istream& stream)
@@ -109,8 +104,8 @@ bool alert::from_data(uint32_t , reader& source)
 {
     reset();
 
-    payload_ = source.read_bytes(source.read_size_little_endian());
-    signature_ = source.read_bytes(source.read_size_little_endian());
+    payload_ = source.read_bytes(read_count(source, 1, max_size_t));
+    signature_ = source.read_bytes(read_count(source, 1, max_size_t));
 
     if (!source)
         reset();
@@ -123,9 +118,8 @@ data_chunk alert::to_data(uint32_t version) const
     data_chunk data;
     const auto size = serialized_size(version);
     data.reserve(size);
-    data_sink ostream(data);
-    to_data(version, ostream);
-    ostream.flush();
+    byte_writer sink(data);
+    to_data(version, sink);
     BITCOIN_ASSERT(data.size() == size);
     return data;
 }
@@ -20,8 +20,8 @@
 
 #include <bitcoin/bitcoin/constants.hpp>
 #include <bitcoin/bitcoin/message/messages.hpp>
-#include <bitcoin/bitcoin/utility/container_sink.hpp>
-#include <bitcoin/bitcoin/utility/container_source.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
 #include <bitcoin/bitcoin/utility/ostream_writer.hpp>
 
@@ -214,8 +214,8 @@ void alert_payload::reset()
 
 bool alert_payload::from_data(uint32_t version, const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(version, istream);
+    byte_reader source(data);
+    return from_data(version, source);
 }
 
 bool alert_payload::from_data(uint32_t version, std::istream& stream)
@@ -233,16 +233,20 @@ bool alert_payload::from_data(uint32_t , reader& source)
     expiration_ = source.read_8_bytes_little_endian();
     id_ = source.read_4_bytes_little_endian();
     cancel_ = source.read_4_bytes_little_endian();
-    set_cancel_.reserve(source.read_size_little_endian());
 
-    for (size_t i = 0; i < set_cancel_.capacity() && source; i++)
+    // Guard against potential for arbitary memory allocation.
+    const auto cancels = read_count(source, sizeof(uint32_t), max_size_t);
+    set_cancel_.reserve(cancels);
+
+    for (size_t i = 0; i < cancels && source; i++)
         set_cancel_.push_back(source.read_4_bytes_little_endian());
 
     min_version_ = source.read_4_bytes_little_endian();
     max_version_ = source.read_4_bytes_little_endian();
-    set_sub_version_.reserve(source.read_size_little_endian());
+    const auto sub_versions = read_count(source, 1, max_size_t);
+    set_sub_version_.reserve(sub_versions);
 
-    for (size_t i = 0; i < set_sub_version_.capacity() && source; i++)
+    for (size_t i = 0; i < sub_versions && source; i++)
         set_sub_version_.push_back(source.read_string());
 
     priority_ = source.read_4_bytes_little_endian();
@@ -261,9 +265,8 @@ data_chunk alert_payload::to_data(uint32_t version) const
     data_chunk data;
     const auto size = serialized_size(version);
     data.reserve(size);
-    data_sink ostream(data);
-    to_data(version, ostream);
-    ostream.flush();
+    byte_writer sink(data);
+    to_data(version, sink);
     BITCOIN_ASSERT(data.size() == size);
     return data;
 }
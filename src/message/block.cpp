@@ -22,6 +22,7 @@
 #include <cstddef>
 #include <istream>
 #include <utility>
+#include <bitcoin/bitcoin/message/statistics.hpp>
 #include <bitcoin/bitcoin/message/version.hpp>
 #include <bitcoin/bitcoin/chain/header.hpp>
 #include <bitcoin/bitcoin/chain/transaction.hpp>
@@ -37,23 +38,17 @@ const uint32_t block::version_maximum = version::level::maximum;
 
 block block::factory(uint32_t version, const data_chunk& data)
 {
-    block instance;
-    instance.from_data(version, data);
-    return instance;
+    return statistics::factory<block>(version, data);
 }
 
 block block::factory(uint32_t version, std::istream& stream)
 {
-    block instance;
-    instance.from_data(version, stream);
-    return instance;
+    return statistics::factory<block>(version, stream);
 }
 
 block block::factory(uint32_t version, reader& source)
 {
-    block instance;
-    instance.from_data(version, source);
-    return instance;
+    return statistics::factory<block>(version, source);
 }
 
 block::block()
@@ -20,15 +20,19 @@
 
 #include <bitcoin/bitcoin/math/limits.hpp>
 #include <bitcoin/bitcoin/message/messages.hpp>
+#include <bitcoin/bitcoin/message/statistics.hpp>
 #include <bitcoin/bitcoin/message/version.hpp>
-#include <bitcoin/bitcoin/utility/container_sink.hpp>
-#include <bitcoin/bitcoin/utility/container_source.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
 #include <bitcoin/bitcoin/utility/ostream_writer.hpp>
 
 namespace libbitcoin {
 namespace message {
 
+// The smallest wire serialization of a transaction (no inputs or outputs).
+static constexpr size_t min_transaction_size = 4 + 1 + 1 + 4;
+
 const std::string block_transactions::command = "blocktxn";
 const uint32_t block_transactions::version_minimum = version::level::bip152;
 const uint32_t block_transactions::version_maximum = version::level::bip152;
@@ -36,25 +40,19 @@ const uint32_t block_transactions::version_maximum = version::level::bip152;
 block_transactions block_transactions::factory(uint32_t version,
     const data_chunk& data)
 {
-    block_transactions instance;
-    instance.from_data(version, data);
-    return instance;
+    return statistics::factory<block_transactions>(version, data);
 }
 
 block_transactions block_transactions::factory(uint32_t version,
     std::istream& stream)
 {
-    block_transactions instance;
-    instance.from_data(version, stream);
-    return instance;
+    return statistics::factory<block_transactions>(version, stream);
 }
 
 block_transactions block_transactions::factory(uint32_t version,
     reader& source)
 {
-    block_transactions instance;
-    instance.from_data(version, source);
-    return instance;
+    return statistics::factory<block_transactions>(version, source);
 }
 
 block_transactions::block_transactions()
@@ -100,8 +98,8 @@ void block_transactions::reset()
 bool block_transactions::from_data(uint32_t version,
     const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(version, istream);
+    byte_reader source(data);
+    return from_data(version, source);
 }
 
 bool block_transactions::from_data(uint32_t version,
@@ -116,13 +114,10 @@ bool block_transactions::from_data(uint32_t version, reader& source)
     reset();
 
     block_hash_ = source.read_hash();
-    const auto count = source.read_size_little_endian();
 
     // Guard against potential for arbitary memory allocation.
-    if (count > max_block_size)
-        source.invalidate();
-    else
-        transactions_.resize(count);
+    transactions_.resize(read_count(source, min_transaction_size,
+        max_block_size));
 
     // Order is required.
     for (auto& tx: transactions_)
@@ -143,9 +138,8 @@ data_chunk block_transactions::to_data(uint32_t version) const
     data_chunk data;
     const auto size = serialized_size(version);
     data.reserve(size);
-    data_sink ostream(data);
-    to_data(version, ostream);
-    ostream.flush();
+    byte_writer sink(data);
+    to_data(version, sink);
     BITCOIN_ASSERT(data.size() == size);
     return data;
 }
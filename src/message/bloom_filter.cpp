@@ -0,0 +1,237 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/message/bloom_filter.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <bitcoin/bitcoin/chain/block.hpp>
+#include <bitcoin/bitcoin/chain/point.hpp>
+#include <bitcoin/bitcoin/chain/script.hpp>
+#include <bitcoin/bitcoin/chain/transaction.hpp>
+#include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/machine/script_pattern.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/math/murmur3.hpp>
+#include <bitcoin/bitcoin/message/filter_add.hpp>
+#include <bitcoin/bitcoin/message/filter_load.hpp>
+#include <bitcoin/bitcoin/message/merkle_block.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/endian.hpp>
+
+namespace libbitcoin {
+namespace message {
+
+using namespace bc::chain;
+using namespace bc::machine;
+
+// The bip37 seed of hash function n is (n * 0xfba4c795 + tweak).
+static constexpr uint32_t seed_factor = 0xfba4c795;
+
+// The wire serialization of a point (hash and little-endian index).
+static constexpr size_t point_size = hash_size + sizeof(uint32_t);
+typedef byte_array<point_size> point_bytes;
+
+static point_bytes to_bytes(const point& point)
+{
+    point_bytes out;
+    const auto index = to_little_endian(point.index());
+    const auto& hash = point.hash();
+    std::copy(hash.begin(), hash.end(), out.begin());
+    std::copy(index.begin(), index.end(), out.begin() + hash_size);
+    return out;
+}
+
+bloom_filter::bloom_filter(const filter_load& load)
+  : bloom_filter(data_chunk(load.filter()), load.hash_functions(),
+      load.tweak(), load.flags())
+{
+}
+
+bloom_filter::bloom_filter(data_chunk&& filter, uint32_t hash_functions,
+    uint32_t tweak, uint8_t flags)
+  : filter_(std::move(filter)),
+    seeds_(to_seeds(hash_functions, tweak)),
+    flags_(flags)
+{
+}
+
+bloom_filter::seeds bloom_filter::to_seeds(uint32_t hash_functions,
+    uint32_t tweak)
+{
+    // Excess functions invalidate the filter, so are not seeded.
+    const auto count = std::min(hash_functions,
+        static_cast<uint32_t>(max_filter_functions + 1));
+
+    seeds out;
+    out.reserve(count);
+
+    for (uint32_t function = 0; function < count; ++function)
+        out.push_back(function * seed_factor + tweak);
+
+    return out;
+}
+
+bool bloom_filter::is_valid() const
+{
+    return filter_.size() <= max_filter_load &&
+        seeds_.size() <= max_filter_functions;
+}
+
+const data_chunk& bloom_filter::filter() const
+{
+    return filter_;
+}
+
+// The element bits are found by all hash functions in one pass (no heap).
+bool bloom_filter::contains(data_slice element) const
+{
+    // An empty filter matches everything (and avoids division by zero).
+    if (filter_.empty())
+        return true;
+
+    uint32_t hashes[max_filter_functions + 1];
+    murmur3(seeds_.data(), seeds_.size(), element, hashes);
+    const auto bits = filter_.size() * byte_bits;
+
+    for (size_t function = 0; function < seeds_.size(); ++function)
+    {
+        const auto bit = hashes[function] % bits;
+
+        if ((filter_[bit / byte_bits] & (1u << (bit % byte_bits))) == 0)
+            return false;
+    }
+
+    return true;
+}
+
+bool bloom_filter::contains(const point& point) const
+{
+    return contains(to_bytes(point));
+}
+
+void bloom_filter::insert(data_slice element)
+{
+    if (filter_.empty())
+        return;
+
+    uint32_t hashes[max_filter_functions + 1];
+    murmur3(seeds_.data(), seeds_.size(), element, hashes);
+    const auto bits = filter_.size() * byte_bits;
+
+    for (size_t function = 0; function < seeds_.size(); ++function)
+    {
+        const auto bit = hashes[function] % bits;
+        filter_[bit / byte_bits] |= (1u << (bit % byte_bits));
+    }
+}
+
+void bloom_filter::insert(const point& point)
+{
+    insert(to_bytes(point));
+}
+
+void bloom_filter::add(const filter_add& add)
+{
+    insert(add.data());
+}
+
+bool bloom_filter::is_updated(const script& script) const
+{
+    switch (flags_ & update::mask)
+    {
+        case update::all:
+            return true;
+
+        case update::pay_public_key_only:
+        {
+            const auto pattern = script.output_pattern();
+            return pattern == script_pattern::pay_public_key ||
+                pattern == script_pattern::pay_multisig;
+        }
+
+        default:
+            return false;
+    }
+}
+
+// Script data is matched by reference to the script bytes (no copy).
+static bool contains_data(const bloom_filter& filter, const script& script)
+{
+    const auto& bytes = script.bytes();
+
+    for (const auto& op: script.instructions())
+    {
+        if (!op.is_valid())
+            break;
+
+        if (op.size() != 0 && filter.contains(op.data(bytes)))
+            return true;
+    }
+
+    return false;
+}
+
+bool bloom_filter::match(const transaction& tx)
+{
+    const auto& hash = tx.hash();
+    auto matched = contains(hash);
+    const auto& outputs = tx.outputs();
+
+    // Matched outputs are inserted so that their spends are also matched.
+    for (uint32_t index = 0; index < outputs.size(); ++index)
+    {
+        const auto& script = outputs[index].script();
+
+        if (contains_data(*this, script))
+        {
+            matched = true;
+
+            if (is_updated(script))
+                insert(point{ hash, index });
+        }
+    }
+
+    if (matched)
+        return true;
+
+    for (const auto& input: tx.inputs())
+        if (contains(input.previous_output()) ||
+            contains_data(*this, input.script()))
+            return true;
+
+    return false;
+}
+
+merkle_block bloom_filter::to_merkle_block(const block& block)
+{
+    const auto& transactions = block.transactions();
+    std::vector<bool> matches;
+    matches.reserve(transactions.size());
+
+    for (const auto& tx: transactions)
+        matches.push_back(match(tx));
+
+    return { block, matches };
+}
+
+} // namespace message
+} // namespace libbitcoin
@@ -18,41 +18,62 @@
  */
 #include <bitcoin/bitcoin/message/compact_block.hpp>
 
+#include <algorithm>
 #include <initializer_list>
+#include <bitcoin/bitcoin/math/hash.hpp>
 #include <bitcoin/bitcoin/math/limits.hpp>
+#include <bitcoin/bitcoin/math/siphash.hpp>
 #include <bitcoin/bitcoin/message/messages.hpp>
+#include <bitcoin/bitcoin/message/statistics.hpp>
 #include <bitcoin/bitcoin/message/version.hpp>
-#include <bitcoin/bitcoin/utility/container_sink.hpp>
-#include <bitcoin/bitcoin/utility/container_source.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
+#include <bitcoin/bitcoin/utility/endian.hpp>
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
 #include <bitcoin/bitcoin/utility/ostream_writer.hpp>
+#include <bitcoin/bitcoin/utility/sha256_writer.hpp>
 
 namespace libbitcoin {
 namespace message {
 
+// The smallest wire serialization of a prefilled transaction (no puts).
+static constexpr size_t min_prefilled_size = 1 + 4 + 1 + 1 + 4;
+
 const std::string compact_block::command = "cmpctblock";
 const uint32_t compact_block::version_minimum = version::level::bip152;
 const uint32_t compact_block::version_maximum = version::level::bip152;
 
 compact_block compact_block::factory(uint32_t version, const data_chunk& data)
 {
-    compact_block instance;
-    instance.from_data(version, data);
-    return instance;
+    return statistics::factory<compact_block>(version, data);
 }
 
 compact_block compact_block::factory(uint32_t version, std::istream& stream)
 {
-    compact_block instance;
-    instance.from_data(version, stream);
-    return instance;
+    return statistics::factory<compact_block>(version, stream);
 }
 
 compact_block compact_block::factory(uint32_t version, reader& source)
 {
-    compact_block instance;
-    instance.from_data(version, source);
-    return instance;
+    return statistics::factory<compact_block>(version, source);
+}
+
+// The siphash key is the sha256 of the wire header and little-endian nonce.
+siphash_key compact_block::to_key(const chain::header& header, uint64_t nonce)
+{
+    sha256_writer sink;
+    header.to_data(sink);
+    sink.write_8_bytes_little_endian(nonce);
+    return to_siphash_key(sink.sha256_digest());
+}
+
+// The short id is the low 48 bits of the siphash, little-endian.
+compact_block::short_id compact_block::to_short_id(uint64_t value)
+{
+    const auto bytes = to_little_endian(value);
+    short_id out;
+    std::copy_n(bytes.begin(), out.size(), out.begin());
+    return out;
 }
 
 compact_block::compact_block()
@@ -108,8 +129,8 @@ void compact_block::reset()
 
 bool compact_block::from_data(uint32_t version, const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(version, istream);
+    byte_reader source(data);
+    return from_data(version, source);
 }
 
 bool compact_block::from_data(uint32_t version, std::istream& stream)
@@ -126,25 +147,18 @@ bool compact_block::from_data(uint32_t version, reader& source)
         return false;
 
     nonce_ = source.read_8_bytes_little_endian();
-    auto count = source.read_size_little_endian();
 
     // Guard against potential for arbitary memory allocation.
-    if (count > max_block_size)
-        source.invalidate();
-    else
-        short_ids_.reserve(count);
+    auto count = read_count(source, mini_hash_size, max_block_size);
+    short_ids_.reserve(count);
 
     // Order is required.
     for (size_t id = 0; id < count && source; ++id)
         short_ids_.push_back(source.read_mini_hash());
 
-    count = source.read_size_little_endian();
-
     // Guard against potential for arbitary memory allocation.
-    if (count > max_block_size)
-        source.invalidate();
-    else
-        transactions_.resize(count);
+    count = read_count(source, min_prefilled_size, max_block_size);
+    transactions_.resize(count);
 
     // Order is required.
     for (auto& tx : transactions_)
@@ -165,9 +179,8 @@ data_chunk compact_block::to_data(uint32_t version) const
     data_chunk data;
     const auto size = serialized_size(version);
     data.reserve(size);
-    data_sink ostream(data);
-    to_data(version, ostream);
-    ostream.flush();
+    byte_writer sink(data);
+    to_data(version, sink);
     BITCOIN_ASSERT(data.size() == size);
     return data;
 }
@@ -0,0 +1,96 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/message/compact_block_builder.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <bitcoin/bitcoin/chain/block.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/math/siphash.hpp>
+#include <bitcoin/bitcoin/message/compact_block.hpp>
+#include <bitcoin/bitcoin/message/prefilled_transaction.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/pseudo_random.hpp>
+
+namespace libbitcoin {
+namespace message {
+
+compact_block_builder::compact_block_builder(const chain::block& block,
+    bool witness, uint64_t nonce)
+  : message_(std::make_shared<const compact_block>(
+        build(block, witness, nonce))),
+    payload_(std::make_shared<const data_chunk>(
+        message_->to_data(compact_block::version_maximum)))
+{
+}
+
+compact_block_builder::compact_block_builder(const chain::block& block,
+    bool witness)
+  : compact_block_builder(block, witness, pseudo_random::next())
+{
+}
+
+// The coinbase is prefilled at (differential) index zero, and each other
+// transaction is represented by its short id, in block order.
+compact_block compact_block_builder::build(const chain::block& block,
+    bool witness, uint64_t nonce)
+{
+    const auto& transactions = block.transactions();
+    const auto& header = block.header();
+
+    if (transactions.empty())
+        return { header, nonce, {}, {} };
+
+    auto hashes = block.to_hashes(witness);
+    hashes.erase(hashes.begin());
+
+    const auto values = siphash(compact_block::to_key(header, nonce),
+        hashes);
+
+    compact_block::short_id_list short_ids;
+    short_ids.reserve(values.size());
+
+    for (const auto value: values)
+        short_ids.push_back(compact_block::to_short_id(value));
+
+    return
+    {
+        chain::header(header),
+        nonce,
+        std::move(short_ids),
+        { { 0, transactions.front() } }
+    };
+}
+
+// Properties.
+//-----------------------------------------------------------------------------
+
+compact_block::const_ptr compact_block_builder::message() const
+{
+    return message_;
+}
+
+compact_block_builder::payload_ptr compact_block_builder::payload() const
+{
+    return payload_;
+}
+
+} // namespace message
+} // namespace libbitcoin
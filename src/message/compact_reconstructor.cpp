@@ -0,0 +1,227 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/message/compact_reconstructor.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <bitcoin/bitcoin/chain/block.hpp>
+#include <bitcoin/bitcoin/chain/transaction.hpp>
+#include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/math/siphash.hpp>
+#include <bitcoin/bitcoin/message/block_transactions.hpp>
+#include <bitcoin/bitcoin/message/compact_block.hpp>
+#include <bitcoin/bitcoin/message/get_block_transactions.hpp>
+#include <bitcoin/bitcoin/utility/assert.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+
+namespace libbitcoin {
+namespace message {
+
+using namespace bc::chain;
+
+compact_reconstructor::compact_reconstructor(const compact_block& block,
+    bool witness)
+  : witness_(witness),
+    header_(block.header()),
+    key_(compact_block::to_key(block.header(), block.nonce())),
+    short_ids_(block.short_ids()),
+    missing_(0)
+{
+    const auto& prefilled = block.transactions();
+
+    // Reserved for prefilled and all received, so that pointers are stable.
+    owned_.reserve(prefilled.size() + short_ids_.size());
+    prefilled_.reserve(prefilled.size());
+
+    for (const auto& element: prefilled)
+    {
+        prefilled_.push_back(element.index());
+        owned_.push_back(element.transaction());
+    }
+}
+
+uint64_t compact_reconstructor::to_key(const short_id& id)
+{
+    uint64_t key = 0;
+
+    for (size_t byte = 0; byte < id.size(); ++byte)
+        key |= static_cast<uint64_t>(id[byte]) << (8u * byte);
+
+    return key;
+}
+
+compact_reconstructor::short_id compact_reconstructor::to_short_id(
+    const hash_digest& hash) const
+{
+    return compact_block::to_short_id(siphash(key_, hash));
+}
+
+code compact_reconstructor::initialize()
+{
+    const auto count = prefilled_.size() + short_ids_.size();
+
+    // Prefilled indexes are limited to 16 bits (bip152).
+    if (count == 0 || count > max_uint16)
+        return error::bad_stream;
+
+    slots_.assign(count, { nullptr, nullptr, false });
+    positions_.clear();
+    positions_.reserve(short_ids_.size());
+
+    // Decode the differential prefilled indexes.
+    uint64_t next = 0;
+    for (size_t index = 0; index < prefilled_.size(); ++index)
+    {
+        // Guard against overflow of the decoded index.
+        if (prefilled_[index] >= count - next)
+            return error::bad_stream;
+
+        next += prefilled_[index];
+        slots_[next++].owned = &owned_[index];
+    }
+
+    // Short ids fill the remaining slots in order.
+    size_t id = 0;
+    for (size_t position = 0; position < count; ++position)
+    {
+        if (slots_[position].owned != nullptr)
+            continue;
+
+        if (!positions_.emplace(to_key(short_ids_[id++]), position).second)
+            return error::operation_failed;
+    }
+
+    BITCOIN_ASSERT(id == short_ids_.size());
+    missing_ = short_ids_.size();
+    return error::success;
+}
+
+bool compact_reconstructor::match(const transaction& tx)
+{
+    const auto hash = tx.hash(witness_);
+    const auto it = positions_.find(to_key(to_short_id(hash)));
+
+    if (it == positions_.end())
+        return false;
+
+    auto& slot = slots_[it->second];
+
+    if (slot.collided)
+        return false;
+
+    if (slot.pool == nullptr)
+    {
+        slot.pool = &tx;
+        --missing_;
+        return true;
+    }
+
+    // A second pool transaction with the same short id, request the slot.
+    if (slot.pool->hash(witness_) != hash)
+    {
+        slot.pool = nullptr;
+        slot.collided = true;
+        ++missing_;
+    }
+
+    return false;
+}
+
+size_t compact_reconstructor::missing() const
+{
+    return missing_;
+}
+
+get_block_transactions compact_reconstructor::request() const
+{
+    std::vector<uint64_t> indexes;
+    indexes.reserve(missing_);
+
+    // Encode the missing positions differentially.
+    uint64_t next = 0;
+    for (size_t position = 0; position < slots_.size(); ++position)
+    {
+        const auto& slot = slots_[position];
+
+        if (slot.owned == nullptr && slot.pool == nullptr)
+        {
+            indexes.push_back(position - next);
+            next = position + 1;
+        }
+    }
+
+    return { header_.hash(), std::move(indexes) };
+}
+
+code compact_reconstructor::fill(block_transactions&& response)
+{
+    auto& transactions = response.transactions();
+
+    if (response.block_hash() != header_.hash() ||
+        transactions.size() != missing_)
+        return error::bad_stream;
+
+    auto tx = transactions.begin();
+    for (auto& slot: slots_)
+    {
+        if (slot.owned == nullptr && slot.pool == nullptr)
+        {
+            owned_.push_back(std::move(*tx++));
+            slot.owned = &owned_.back();
+        }
+    }
+
+    BITCOIN_ASSERT(tx == transactions.end());
+    missing_ = 0;
+    return error::success;
+}
+
+code compact_reconstructor::assemble(block& out)
+{
+    if (slots_.empty() || missing_ != 0)
+        return error::operation_failed;
+
+    transaction::list transactions;
+    transactions.reserve(slots_.size());
+
+    // Owned transactions are moved, pool transactions are copied once.
+    for (const auto& slot: slots_)
+    {
+        if (slot.owned != nullptr)
+            transactions.push_back(std::move(*slot.owned));
+        else
+            transactions.push_back(*slot.pool);
+    }
+
+    block result(header_, std::move(transactions));
+
+    if (result.generate_merkle_root() != header_.merkle())
+        return error::merkle_mismatch;
+
+    out = std::move(result);
+    slots_.clear();
+    return error::success;
+}
+
+} // namespace message
+} // namespace libbitcoin
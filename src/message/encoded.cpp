@@ -0,0 +1,121 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/message/encoded.hpp>
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <bitcoin/bitcoin/message/heading.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/thread.hpp>
+
+namespace libbitcoin {
+namespace message {
+
+// encoded
+//-----------------------------------------------------------------------------
+
+encoded::encoded(uint32_t version, uint32_t magic, const std::string& command,
+    data_chunk&& data)
+  : version_(version),
+    magic_(magic),
+    command_(command),
+    data_(std::move(data))
+{
+}
+
+uint32_t encoded::version() const
+{
+    return version_;
+}
+
+uint32_t encoded::magic() const
+{
+    return magic_;
+}
+
+const std::string& encoded::command() const
+{
+    return command_;
+}
+
+const data_chunk& encoded::data() const
+{
+    return data_;
+}
+
+data_slice encoded::payload() const
+{
+    const auto heading_size = heading::satoshi_fixed_size();
+    return data_slice(data_.data() + heading_size,
+        data_.data() + data_.size());
+}
+
+// encoding_cache
+//-----------------------------------------------------------------------------
+
+encoding_cache::encoding_cache()
+{
+}
+
+size_t encoding_cache::size() const
+{
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    shared_lock lock(mutex_);
+
+    return encodings_.size();
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+encoded::const_ptr encoding_cache::find(uint32_t version,
+    uint32_t magic) const
+{
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    shared_lock lock(mutex_);
+
+    // There are very few distinct versions, so a linear search is optimal.
+    for (const auto& encoding: encodings_)
+        if (encoding->version() == version && encoding->magic() == magic)
+            return encoding;
+
+    return nullptr;
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+encoded::const_ptr encoding_cache::store(encoded::const_ptr encoding)
+{
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    unique_lock lock(mutex_);
+
+    // Another thread may have stored the same encoding, share the first.
+    for (const auto& existing: encodings_)
+        if (existing->version() == encoding->version() &&
+            existing->magic() == encoding->magic())
+            return existing;
+
+    encodings_.push_back(encoding);
+    return encoding;
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+} // namespace message
+} // namespace libbitcoin
@@ -18,9 +18,11 @@
  */
 #include <bitcoin/bitcoin/message/fee_filter.hpp>
 
+#include <bitcoin/bitcoin/message/statistics.hpp>
 #include <bitcoin/bitcoin/message/version.hpp>
-#include <bitcoin/bitcoin/utility/container_sink.hpp>
-#include <bitcoin/bitcoin/utility/container_source.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
+#include <bitcoin/bitcoin/utility/endian.hpp>
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
 #include <bitcoin/bitcoin/utility/ostream_writer.hpp>
 
@@ -30,28 +32,23 @@ namespace message {
 const std::string fee_filter::command = "feefilter";
 const uint32_t fee_filter::version_minimum = version::level::bip133;
 const uint32_t fee_filter::version_maximum = version::level::bip133;
+BC_CONSTEXPR size_t fee_filter::wire_size;
 
 fee_filter fee_filter::factory(uint32_t version,
     const data_chunk& data)
 {
-    fee_filter instance;
-    instance.from_data(version, data);
-    return instance;
+    return statistics::factory<fee_filter>(version, data);
 }
 
 fee_filter fee_filter::factory(uint32_t version,
     std::istream& stream)
 {
-    fee_filter instance;
-    instance.from_data(version, stream);
-    return instance;
+    return statistics::factory<fee_filter>(version, stream);
 }
 
 fee_filter fee_filter::factory(uint32_t version, reader& source)
 {
-    fee_filter instance;
-    instance.from_data(version, source);
-    return instance;
+    return statistics::factory<fee_filter>(version, source);
 }
 
 size_t fee_filter::satoshi_fixed_size(uint32_t)
@@ -89,8 +86,8 @@ fee_filter::fee_filter(fee_filter&& other)
 
 bool fee_filter::from_data(uint32_t version, const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(version, istream);
+    byte_reader source(data);
+    return from_data(version, source);
 }
 
 bool fee_filter::from_data(uint32_t version, std::istream& stream)
@@ -117,14 +114,20 @@ bool fee_filter::from_data(uint32_t version, reader& source)
     return source;
 }
 
+bool fee_filter::from_wire_data(const wire_data& data)
+{
+    insufficient_version_ = false;
+    minimum_fee_ = load_little_endian<uint64_t>(data.data());
+    return true;
+}
+
 data_chunk fee_filter::to_data(uint32_t version) const
 {
     data_chunk data;
     const auto size = serialized_size(version);
     data.reserve(size);
-    data_sink ostream(data);
-    to_data(version, ostream);
-    ostream.flush();
+    byte_writer sink(data);
+    to_data(version, sink);
     BITCOIN_ASSERT(data.size() == size);
     return data;
 }
@@ -140,6 +143,13 @@ void fee_filter::to_data(uint32_t , writer& sink) const
     sink.write_8_bytes_little_endian(minimum_fee_);
 }
 
+fee_filter::wire_data fee_filter::to_wire_data() const
+{
+    wire_data data;
+    store_little_endian(data.data(), minimum_fee_);
+    return data;
+}
+
 bool fee_filter::is_valid() const
 {
     return !insufficient_version_ || (minimum_fee_ > 0);
@@ -20,10 +20,11 @@
 
 #include <bitcoin/bitcoin/math/limits.hpp>
 #include <bitcoin/bitcoin/message/messages.hpp>
+#include <bitcoin/bitcoin/message/statistics.hpp>
 #include <bitcoin/bitcoin/message/version.hpp>
 #include <bitcoin/bitcoin/utility/assert.hpp>
-#include <bitcoin/bitcoin/utility/container_sink.hpp>
-#include <bitcoin/bitcoin/utility/container_source.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
 #include <bitcoin/bitcoin/utility/ostream_writer.hpp>
 
@@ -37,25 +38,19 @@ const uint32_t filter_add::version_maximum = version::level::maximum;
 filter_add filter_add::factory(uint32_t version,
     const data_chunk& data)
 {
-    filter_add instance;
-    instance.from_data(version, data);
-    return instance;
+    return statistics::factory<filter_add>(version, data);
 }
 
 filter_add filter_add::factory(uint32_t version,
     std::istream& stream)
 {
-    filter_add instance;
-    instance.from_data(version, stream);
-    return instance;
+    return statistics::factory<filter_add>(version, stream);
 }
 
 filter_add filter_add::factory(uint32_t version,
     reader& source)
 {
-    filter_add instance;
-    instance.from_data(version, source);
-    return instance;
+    return statistics::factory<filter_add>(version, source);
 }
 
 filter_add::filter_add()
@@ -96,8 +91,8 @@ void filter_add::reset()
 
 bool filter_add::from_data(uint32_t version, const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(version, istream);
+    byte_reader source(data);
+    return from_data(version, source);
 }
 
 bool filter_add::from_data(uint32_t version, std::istream& stream)
@@ -110,12 +105,7 @@ bool filter_add::from_data(uint32_t version, reader& source)
 {
     reset();
 
-    const auto size = source.read_size_little_endian();
-
-    if (size > max_filter_add)
-        source.invalidate();
-    else
-        data_ = source.read_bytes(size);
+    data_ = source.read_bytes(read_count(source, 1, max_filter_add));
 
     if (version < filter_add::version_minimum)
         source.invalidate();
@@ -131,9 +121,8 @@ data_chunk filter_add::to_data(uint32_t version) const
     data_chunk data;
     const auto size = serialized_size(version);
     data.reserve(size);
-    data_sink ostream(data);
-    to_data(version, ostream);
-    ostream.flush();
+    byte_writer sink(data);
+    to_data(version, sink);
     BITCOIN_ASSERT(data.size() == size);
     return data;
 }
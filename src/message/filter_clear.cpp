@@ -18,9 +18,10 @@
  */
 #include <bitcoin/bitcoin/message/filter_clear.hpp>
 
+#include <bitcoin/bitcoin/message/statistics.hpp>
 #include <bitcoin/bitcoin/message/version.hpp>
-#include <bitcoin/bitcoin/utility/container_sink.hpp>
-#include <bitcoin/bitcoin/utility/container_source.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
 #include <bitcoin/bitcoin/utility/ostream_writer.hpp>
 
@@ -34,25 +35,19 @@ const uint32_t filter_clear::version_maximum = version::level::maximum;
 filter_clear filter_clear::factory(uint32_t version,
     const data_chunk& data)
 {
-    filter_clear instance;
-    instance.from_data(version, data);
-    return instance;
+    return statistics::factory<filter_clear>(version, data);
 }
 
 filter_clear filter_clear::factory(uint32_t version,
     std::istream& stream)
 {
-    filter_clear instance;
-    instance.from_data(version, stream);
-    return instance;
+    return statistics::factory<filter_clear>(version, stream);
 }
 
 filter_clear filter_clear::factory(uint32_t version,
     reader& source)
 {
-    filter_clear instance;
-    instance.from_data(version, source);
-    return instance;
+    return statistics::factory<filter_clear>(version, source);
 }
 
 // This is a default instance so is invalid.
@@ -92,8 +87,8 @@ void filter_clear::reset()
 
 bool filter_clear::from_data(uint32_t version, const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(version, istream);
+    byte_reader source(data);
+    return from_data(version, source);
 }
 
 bool filter_clear::from_data(uint32_t version, std::istream& stream)
@@ -123,9 +118,8 @@ data_chunk filter_clear::to_data(uint32_t version) const
     data_chunk data;
     const auto size = serialized_size(version);
     data.reserve(size);
-    data_sink ostream(data);
-    to_data(version, ostream);
-    ostream.flush();
+    byte_writer sink(data);
+    to_data(version, sink);
     BITCOIN_ASSERT(data.size() == size);
     return data;
 }
@@ -0,0 +1,169 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/message/framer.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/message/heading.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/deserializer.hpp>
+#include <bitcoin/bitcoin/utility/endian.hpp>
+
+namespace libbitcoin {
+namespace message {
+
+framer::framer(uint32_t magic, uint32_t version, bool witness)
+  : magic_(magic),
+    maximum_payload_(heading::maximum_payload_size(version, witness)),
+    failed_(false),
+    payload_expected_(false),
+    heading_size_(0),
+    heading_data_(heading::satoshi_fixed_size())
+{
+}
+
+void framer::reset()
+{
+    failed_ = false;
+    payload_expected_ = false;
+    heading_size_ = 0;
+    payload_.clear();
+}
+
+size_t framer::needed() const
+{
+    return payload_expected_ ? heading_.payload_size() - payload_.size() :
+        heading_data_.size() - heading_size_;
+}
+
+code framer::write(data_slice chunk, handler handle)
+{
+    if (failed_)
+        return error::bad_stream;
+
+    auto it = chunk.begin();
+    const auto end = chunk.end();
+
+    while (it != end)
+    {
+        if (!payload_expected_)
+        {
+            const auto size = std::min(needed(), size_t(end - it));
+            std::copy(it, it + size, heading_data_.begin() + heading_size_);
+            heading_size_ += size;
+            it += size;
+
+            if (heading_size_ < heading_data_.size())
+                break;
+
+            if (!read_heading())
+            {
+                failed_ = true;
+                return error::bad_stream;
+            }
+
+            // A message may have no payload, so complete it here.
+            if (heading_.payload_size() == 0 &&
+                !read_payload({ it, it }, handle))
+            {
+                failed_ = true;
+                return error::bad_stream;
+            }
+
+            continue;
+        }
+
+        const auto remaining = needed();
+        const auto available = size_t(end - it);
+
+        // The payload is wholly contained by the chunk, so do not copy it.
+        if (payload_.empty() && available >= remaining)
+        {
+            const data_slice payload(it, it + remaining);
+            hasher_.write(payload);
+            it += remaining;
+
+            if (!read_payload(payload, handle))
+            {
+                failed_ = true;
+                return error::bad_stream;
+            }
+
+            continue;
+        }
+
+        // Buffer the partial payload, hashing it as it arrives. The size has
+        // been validated against the limit, so reserve it all at once.
+        const auto size = std::min(remaining, available);
+
+        if (payload_.empty())
+            payload_.reserve(heading_.payload_size());
+
+        hasher_.write({ it, it + size });
+        payload_.insert(payload_.end(), it, it + size);
+        it += size;
+
+        if (payload_.size() == heading_.payload_size() &&
+            !read_payload(payload_, handle))
+        {
+            failed_ = true;
+            return error::bad_stream;
+        }
+    }
+
+    return error::success;
+}
+
+bool framer::read_heading()
+{
+    auto source = make_safe_deserializer(heading_data_.begin(),
+        heading_data_.end());
+
+    if (!heading_.from_data(source) || heading_.magic() != magic_ ||
+        heading_.payload_size() > maximum_payload_)
+        return false;
+
+    payload_expected_ = true;
+    hasher_.reset();
+    return true;
+}
+
+bool framer::read_payload(data_slice payload, handler& handle)
+{
+    // The checksum is the double sha256 over the payload hashed so far.
+    const auto check = from_little_endian_unsafe<uint32_t>(
+        sha256_hash(hasher_.digest()).begin());
+
+    if (check != heading_.checksum())
+        return false;
+
+    handle(heading_, payload);
+
+    // Prepare for the next heading.
+    payload_expected_ = false;
+    heading_size_ = 0;
+    payload_.clear();
+    return true;
+}
+
+} // namespace message
+} // namespace libbitcoin
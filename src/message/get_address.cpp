@@ -18,9 +18,10 @@
  */
 #include <bitcoin/bitcoin/message/get_address.hpp>
 
+#include <bitcoin/bitcoin/message/statistics.hpp>
 #include <bitcoin/bitcoin/message/version.hpp>
-#include <bitcoin/bitcoin/utility/container_sink.hpp>
-#include <bitcoin/bitcoin/utility/container_source.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
 #include <bitcoin/bitcoin/utility/ostream_writer.hpp>
 
@@ -34,25 +35,19 @@ const uint32_t get_address::version_maximum = version::level::maximum;
 get_address get_address::factory(uint32_t version,
     const data_chunk& data)
 {
-    get_address instance;
-    instance.from_data(version, data);
-    return instance;
+    return statistics::factory<get_address>(version, data);
 }
 
 get_address get_address::factory(uint32_t version,
     std::istream& stream)
 {
-    get_address instance;
-    instance.from_data(version, stream);
-    return instance;
+    return statistics::factory<get_address>(version, stream);
 }
 
 get_address get_address::factory(uint32_t version,
     reader& source)
 {
-    get_address instance;
-    instance.from_data(version, source);
-    return instance;
+    return statistics::factory<get_address>(version, source);
 }
 
 get_address::get_address()
@@ -70,8 +65,8 @@ void get_address::reset()
 
 bool get_address::from_data(uint32_t version, const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(version, istream);
+    byte_reader source(data);
+    return from_data(version, source);
 }
 
 bool get_address::from_data(uint32_t version, std::istream& stream)
@@ -91,9 +86,8 @@ data_chunk get_address::to_data(uint32_t version) const
     data_chunk data;
     const auto size = serialized_size(version);
     data.reserve(size);
-    data_sink ostream(data);
-    to_data(version, ostream);
-    ostream.flush();
+    byte_writer sink(data);
+    to_data(version, sink);
     BITCOIN_ASSERT(data.size() == size);
     return data;
 }
@@ -21,9 +21,10 @@
 #include <initializer_list>
 #include <bitcoin/bitcoin/math/limits.hpp>
 #include <bitcoin/bitcoin/message/messages.hpp>
+#include <bitcoin/bitcoin/message/statistics.hpp>
 #include <bitcoin/bitcoin/message/version.hpp>
-#include <bitcoin/bitcoin/utility/container_sink.hpp>
-#include <bitcoin/bitcoin/utility/container_source.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
 #include <bitcoin/bitcoin/utility/ostream_writer.hpp>
 
@@ -37,25 +38,19 @@ const uint32_t get_block_transactions::version_maximum = version::level::bip152;
 get_block_transactions get_block_transactions::factory(
     uint32_t version, const data_chunk& data)
 {
-    get_block_transactions instance;
-    instance.from_data(version, data);
-    return instance;
+    return statistics::factory<get_block_transactions>(version, data);
 }
 
 get_block_transactions get_block_transactions::factory(
     uint32_t version, std::istream& stream)
 {
-    get_block_transactions instance;
-    instance.from_data(version, stream);
-    return instance;
+    return statistics::factory<get_block_transactions>(version, stream);
 }
 
 get_block_transactions get_block_transactions::factory(
     uint32_t version, reader& source)
 {
-    get_block_transactions instance;
-    instance.from_data(version, source);
-    return instance;
+    return statistics::factory<get_block_transactions>(version, source);
 }
 
 get_block_transactions::get_block_transactions()
@@ -102,8 +97,8 @@ void get_block_transactions::reset()
 bool get_block_transactions::from_data(uint32_t version,
     const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(version, istream);
+    byte_reader source(data);
+    return from_data(version, source);
 }
 
 bool get_block_transactions::from_data(uint32_t version,
@@ -119,13 +114,10 @@ bool get_block_transactions::from_data(uint32_t ,
     reset();
 
     block_hash_ = source.read_hash();
-    const auto count = source.read_size_little_endian();
 
     // Guard against potential for arbitary memory allocation.
-    if (count > max_block_size)
-        source.invalidate();
-    else
-        indexes_.reserve(count);
+    const auto count = read_count(source, 1, max_block_size);
+    indexes_.reserve(count);
 
     for (size_t position = 0; position < count && source; ++position)
         indexes_.push_back(source.read_size_little_endian());
@@ -141,9 +133,8 @@ data_chunk get_block_transactions::to_data(uint32_t version) const
     data_chunk data;
     const auto size = serialized_size(version);
     data.reserve(size);
-    data_sink ostream(data);
-    to_data(version, ostream);
-    ostream.flush();
+    byte_writer sink(data);
+    to_data(version, sink);
     BITCOIN_ASSERT(data.size() == size);
     return data;
 }
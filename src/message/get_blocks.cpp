@@ -20,9 +20,10 @@
 
 #include <bitcoin/bitcoin/math/limits.hpp>
 #include <bitcoin/bitcoin/message/messages.hpp>
+#include <bitcoin/bitcoin/message/statistics.hpp>
 #include <bitcoin/bitcoin/message/version.hpp>
-#include <bitcoin/bitcoin/utility/container_sink.hpp>
-#include <bitcoin/bitcoin/utility/container_source.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
 #include <bitcoin/bitcoin/utility/ostream_writer.hpp>
 
@@ -36,25 +37,19 @@ const uint32_t get_blocks::version_maximum = version::level::maximum;
 get_blocks get_blocks::factory(uint32_t version,
     const data_chunk& data)
 {
-    get_blocks instance;
-    instance.from_data(version, data);
-    return instance;
+    return statistics::factory<get_blocks>(version, data);
 }
 
 get_blocks get_blocks::factory(uint32_t version,
     std::istream& stream)
 {
-    get_blocks instance;
-    instance.from_data(version, stream);
-    return instance;
+    return statistics::factory<get_blocks>(version, stream);
 }
 
 get_blocks get_blocks::factory(uint32_t version,
     reader& source)
 {
-    get_blocks instance;
-    instance.from_data(version, source);
-    return instance;
+    return statistics::factory<get_blocks>(version, source);
 }
 
 get_blocks::get_blocks()
@@ -96,8 +91,8 @@ void get_blocks::reset()
 
 bool get_blocks::from_data(uint32_t version, const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(version, istream);
+    byte_reader source(data);
+    return from_data(version, source);
 }
 
 bool get_blocks::from_data(uint32_t version, std::istream& stream)
@@ -112,13 +107,10 @@ bool get_blocks::from_data(uint32_t , reader& source)
 
     // Discard protocol version because it is stupid.
     source.read_4_bytes_little_endian();
-    const auto count = source.read_size_little_endian();
 
     // Guard against potential for arbitary memory allocation.
-    if (count > max_get_blocks)
-        source.invalidate();
-    else
-        start_hashes_.reserve(count);
+    const auto count = read_count(source, hash_size, max_get_blocks);
+    start_hashes_.reserve(count);
 
     for (size_t hash = 0; hash < count && source; ++hash)
         start_hashes_.push_back(source.read_hash());
@@ -136,9 +128,8 @@ data_chunk get_blocks::to_data(uint32_t version) const
     data_chunk data;
     const auto size = serialized_size(version);
     data.reserve(size);
-    data_sink ostream(data);
-    to_data(version, ostream);
-    ostream.flush();
+    byte_writer sink(data);
+    to_data(version, sink);
     BITCOIN_ASSERT(data.size() == size);
     return data;
 }
@@ -23,6 +23,7 @@
 #include <bitcoin/bitcoin/math/hash.hpp>
 #include <bitcoin/bitcoin/message/inventory.hpp>
 #include <bitcoin/bitcoin/message/inventory_vector.hpp>
+#include <bitcoin/bitcoin/message/statistics.hpp>
 #include <bitcoin/bitcoin/message/version.hpp>
 
 namespace libbitcoin {
@@ -35,25 +36,19 @@ const uint32_t get_data::version_maximum = version::level::maximum;
 get_data get_data::factory(uint32_t version,
     const data_chunk& data)
 {
-    get_data instance;
-    instance.from_data(version,data);
-    return instance;
+    return statistics::factory<get_data>(version, data);
 }
 
 get_data get_data::factory(uint32_t version,
     std::istream& stream)
 {
-    get_data instance;
-    instance.from_data(version, stream);
-    return instance;
+    return statistics::factory<get_data>(version, stream);
 }
 
 get_data get_data::factory(uint32_t version,
     reader& source)
 {
-    get_data instance;
-    instance.from_data(version, source);
-    return instance;
+    return statistics::factory<get_data>(version, source);
 }
 
 get_data::get_data()
@@ -19,6 +19,7 @@
 #include <bitcoin/bitcoin/message/get_headers.hpp>
 
 #include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/message/statistics.hpp>
 #include <bitcoin/bitcoin/message/version.hpp>
 
 namespace libbitcoin {
@@ -31,25 +32,19 @@ const uint32_t get_headers::version_maximum = version::level::maximum;
 get_headers get_headers::factory(uint32_t version,
     const data_chunk& data)
 {
-    get_headers instance;
-    instance.from_data(version, data);
-    return instance;
+    return statistics::factory<get_headers>(version, data);
 }
 
 get_headers get_headers::factory(uint32_t version,
     std::istream& stream)
 {
-    get_headers instance;
-    instance.from_data(version, stream);
-    return instance;
+    return statistics::factory<get_headers>(version, stream);
 }
 
 get_headers get_headers::factory(uint32_t version,
     reader& source)
 {
-    get_headers instance;
-    instance.from_data(version, source);
-    return instance;
+    return statistics::factory<get_headers>(version, source);
 }
 
 get_headers::get_headers()
@@ -19,19 +19,34 @@
 #include <bitcoin/bitcoin/message/headers.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <initializer_list>
 #include <istream>
+#include <memory>
+#include <mutex>
 #include <utility>
+#include <vector>
+#include <bitcoin/bitcoin/chain/header.hpp>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
 #include <bitcoin/bitcoin/math/limits.hpp>
+#include <bitcoin/bitcoin/message/heading.hpp>
 #include <bitcoin/bitcoin/message/inventory.hpp>
 #include <bitcoin/bitcoin/message/inventory_vector.hpp>
 #include <bitcoin/bitcoin/message/messages.hpp>
+#include <bitcoin/bitcoin/message/statistics.hpp>
 #include <bitcoin/bitcoin/message/version.hpp>
-#include <bitcoin/bitcoin/utility/container_sink.hpp>
-#include <bitcoin/bitcoin/utility/container_source.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
+#include <bitcoin/bitcoin/utility/endian.hpp>
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
 #include <bitcoin/bitcoin/utility/ostream_writer.hpp>
+#include <bitcoin/bitcoin/utility/serializer.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
 
 namespace libbitcoin {
 namespace message {
@@ -42,23 +57,17 @@ const uint32_t headers::version_maximum = version::level::maximum;
 
 headers headers::factory(uint32_t version, const data_chunk& data)
 {
-    headers instance;
-    instance.from_data(version, data);
-    return instance;
+    return statistics::factory<headers>(version, data);
 }
 
 headers headers::factory(uint32_t version, std::istream& stream)
 {
-    headers instance;
-    instance.from_data(version, stream);
-    return instance;
+    return statistics::factory<headers>(version, stream);
 }
 
 headers headers::factory(uint32_t version, reader& source)
 {
-    headers instance;
-    instance.from_data(version, source);
-    return instance;
+    return statistics::factory<headers>(version, source);
 }
 
 headers::headers()
@@ -105,8 +114,8 @@ void headers::reset()
 
 bool headers::from_data(uint32_t version, const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(version, istream);
+    byte_reader source(data);
+    return from_data(version, source);
 }
 
 bool headers::from_data(uint32_t version, std::istream& stream)
@@ -119,13 +128,9 @@ bool headers::from_data(uint32_t version, reader& source)
 {
     reset();
 
-    const auto count = source.read_size_little_endian();
-
     // Guard against potential for arbitary memory allocation.
-    if (count > max_get_headers)
-        source.invalidate();
-    else
-        elements_.resize(count);
+    elements_.resize(read_count(source, header::satoshi_fixed_size(version),
+        max_get_headers));
 
     // Order is required.
     for (auto& element: elements_)
@@ -146,9 +151,8 @@ data_chunk headers::to_data(uint32_t version) const
     data_chunk data;
     const auto size = serialized_size(version);
     data.reserve(size);
-    data_sink ostream(data);
-    to_data(version, ostream);
-    ostream.flush();
+    byte_writer sink(data);
+    to_data(version, sink);
     BITCOIN_ASSERT(data.size() == size);
     return data;
 }
@@ -167,6 +171,61 @@ void headers::to_data(uint32_t version, writer& sink) const
         element.to_data(version, sink);
 }
 
+// Headers are hashed in groups that remain in cache from the copy.
+static const size_t hash_group = 64;
+
+void headers::serialize(const uint8_t* headers, size_t count, size_t stride,
+    uint32_t magic, data_chunk& out)
+{
+    static const auto header_size = chain::header::satoshi_fixed_size();
+    static const auto element_size = header_size + 1;
+    const auto heading_size = heading::satoshi_fixed_size();
+    const auto prefix_size = variable_uint_size(count);
+    const auto payload_size = prefix_size + count * element_size;
+
+    out.resize(heading_size + payload_size);
+    const auto payload = out.data() + heading_size;
+    auto sink = make_unsafe_serializer(payload);
+    sink.write_variable_little_endian(count);
+
+    sha256_context context;
+    context.write({ payload, payload + prefix_size });
+    auto to = payload + prefix_size;
+
+    for (size_t index = 0; index < count; index += hash_group)
+    {
+        const auto group = std::min(hash_group, count - index);
+        const auto start = to;
+
+        // Each header is followed by a zero transaction count.
+        for (auto end = to + group * element_size; to != end;
+            to += element_size, headers += stride)
+        {
+            std::memcpy(to, headers, header_size);
+            to[header_size] = 0x00;
+        }
+
+        context.write({ start, to });
+    }
+
+    const auto hash = sha256_hash(context.digest());
+    const auto check = from_little_endian_unsafe<uint32_t>(hash.begin());
+    const auto payload_size32 = safe_unsigned<uint32_t>(payload_size);
+
+    const heading head(magic, command, payload_size32, check);
+    auto prefix = make_unsafe_serializer(out.data());
+    head.to_data(prefix);
+}
+
+void headers::serialize(data_slice headers, uint32_t magic, data_chunk& out)
+{
+    static const auto header_size = chain::header::satoshi_fixed_size();
+    BITCOIN_ASSERT(headers.size() % header_size == 0);
+
+    serialize(headers.data(), headers.size() / header_size, header_size,
+        magic, out);
+}
+
 bool headers::is_sequential() const
 {
     if (elements_.empty())
@@ -185,6 +244,272 @@ bool headers::is_sequential() const
     return true;
 }
 
+// Validation.
+//-----------------------------------------------------------------------------
+
+// Headers with cached hashes are skipped, the others are hashed in a batch.
+void headers::hash_all() const
+{
+    static const auto size = chain::header::satoshi_fixed_size();
+    std::vector<const chain::header*> pending;
+    pending.reserve(elements_.size());
+
+    for (const chain::header& element: elements_)
+        if (!element.hash_)
+            pending.push_back(&element);
+
+    if (pending.empty())
+        return;
+
+    data_chunk buffer(pending.size() * size);
+    auto sink = make_unsafe_serializer(buffer.begin());
+
+    for (const auto element: pending)
+        element->to_data(sink);
+
+    std::vector<data_slice> slices;
+    slices.reserve(pending.size());
+
+    const auto data = buffer.data();
+
+    for (size_t index = 0; index < pending.size(); ++index)
+        slices.emplace_back(data + index * size, data + (index + 1u) * size);
+
+    hash_list hashes(pending.size());
+    bitcoin_hash_batch(slices.data(), slices.size(), hashes.data());
+
+    for (size_t index = 0; index < pending.size(); ++index)
+        pending[index]->set_hash(hashes[index]);
+}
+
+// Returns the element count if all headers are linked to their predecessors.
+size_t headers::first_unlinked() const
+{
+    for (size_t index = 1; index < elements_.size(); ++index)
+        if (elements_[index].previous_block_hash() !=
+            elements_[index - 1u].hash())
+            return index;
+
+    return elements_.size();
+}
+
+// The scrypt proof of work hashes of count headers from first, mixed in a
+// batch of the header serializations.
+static void scrypt_hashes(const header::list& headers, size_t first,
+    size_t count, hash_list& out)
+{
+    static const auto size = chain::header::satoshi_fixed_size();
+    data_chunk buffer(count * size);
+    auto sink = make_unsafe_serializer(buffer.begin());
+
+    for (size_t index = 0; index < count; ++index)
+        headers[first + index].to_data(sink);
+
+    std::vector<data_slice> slices;
+    slices.reserve(count);
+
+    const auto data = buffer.data();
+
+    for (size_t index = 0; index < count; ++index)
+        slices.emplace_back(data + index * size, data + (index + 1u) * size);
+
+    out.resize(count);
+    scrypt_hash_batch(slices.data(), slices.size(), out.data());
+}
+
+// Check count headers from first in order, setting out_index to a failure.
+// Scrypt proof of work hashes are computed together in groups of the lanes.
+static code check_range(const header::list& headers, size_t first,
+    size_t count, size_t& out_index, uint32_t timestamp_limit_seconds,
+    uint32_t proof_of_work_limit, bool scrypt)
+{
+    if (!scrypt)
+    {
+        for (auto index = first; index < first + count; ++index)
+        {
+            const auto ec = headers[index].check(timestamp_limit_seconds,
+                proof_of_work_limit);
+
+            if (ec)
+            {
+                out_index = index;
+                return ec;
+            }
+        }
+
+        return error::success;
+    }
+
+    const auto lanes = scrypt_hash_lanes();
+    hash_list hashes;
+
+    for (auto group = first; group < first + count; group += lanes)
+    {
+        const auto size = std::min(lanes, first + count - group);
+        scrypt_hashes(headers, group, size, hashes);
+
+        for (size_t offset = 0; offset < size; ++offset)
+        {
+            const auto ec = headers[group + offset].check(
+                timestamp_limit_seconds, proof_of_work_limit, hashes[offset]);
+
+            if (ec)
+            {
+                out_index = group + offset;
+                return ec;
+            }
+        }
+    }
+
+    return error::success;
+}
+
+code headers::check_all(size_t& out_index, uint32_t timestamp_limit_seconds,
+    uint32_t proof_of_work_limit, bool scrypt) const
+{
+    hash_all();
+
+    // Headers above the first unlinked header need not be checked.
+    const auto unlinked = first_unlinked();
+    const auto count = std::min(unlinked + 1u, elements_.size());
+
+    const auto ec = check_range(elements_, 0, count, out_index,
+        timestamp_limit_seconds, proof_of_work_limit, scrypt);
+
+    if (ec)
+        return ec;
+
+    if (unlinked == elements_.size())
+        return error::success;
+
+    out_index = unlinked;
+    return error::invalid_previous_block;
+}
+
+// Shared state of a parallel check, outlives the call if jobs are delayed.
+struct parallel_check
+{
+    parallel_check(const header::list& headers, size_t count,
+        uint32_t timestamp_limit_seconds, uint32_t proof_of_work_limit,
+        bool scrypt)
+      : headers(headers),
+        count(count),
+        timestamp_limit_seconds(timestamp_limit_seconds),
+        proof_of_work_limit(proof_of_work_limit),
+        scrypt(scrypt),
+        grain(scrypt ? scrypt_hash_lanes() : 1),
+        next(0),
+        failed(count),
+        running(0),
+        result(error::success)
+    {
+    }
+
+    // Claim and check headers in order until exhausted or failed. Scrypt
+    // headers are claimed in groups of the lanes that are mixed together.
+    void run()
+    {
+        mutex.lock();
+        ++running;
+        mutex.unlock();
+
+        size_t first;
+        while ((first = next.fetch_add(grain)) < count)
+        {
+            size_t index;
+            const auto ec = check_range(headers, first,
+                std::min(grain, count - first), index,
+                timestamp_limit_seconds, proof_of_work_limit, scrypt);
+
+            if (ec)
+            {
+                // Exhaust the claims, all preceding headers are in progress.
+                next.store(count);
+                std::lock_guard<std::mutex> lock(mutex);
+
+                // Retain the code of the earliest failure in header order.
+                if (index < failed)
+                {
+                    failed = index;
+                    result = ec;
+                }
+            }
+        }
+
+        mutex.lock();
+        const auto idle = (--running == 0);
+        mutex.unlock();
+
+        if (idle)
+            finished.notify_all();
+    }
+
+    // Wait for all claimed headers to complete, call only after run().
+    code wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        finished.wait(lock, [this]() { return running == 0; });
+        return result;
+    }
+
+    const header::list& headers;
+    const size_t count;
+    const uint32_t timestamp_limit_seconds;
+    const uint32_t proof_of_work_limit;
+    const bool scrypt;
+    const size_t grain;
+    std::atomic<size_t> next;
+
+    // These are protected by mutex.
+    size_t failed;
+    size_t running;
+    code result;
+    std::mutex mutex;
+    std::condition_variable finished;
+};
+
+// The calling thread participates in checking, so this will not deadlock
+// when invoked from a thread of the pool. The result is that of the serial
+// check, as all headers preceding a failure are checked before returning.
+code headers::check_all(size_t& out_index, uint32_t timestamp_limit_seconds,
+    uint32_t proof_of_work_limit, threadpool& pool, bool scrypt) const
+{
+    hash_all();
+
+    // Headers above the first unlinked header need not be checked.
+    const auto unlinked = first_unlinked();
+    const auto count = std::min(unlinked + 1u, elements_.size());
+
+    // There is no benefit in dispatching fewer than two headers.
+    if (pool.empty() || count < 2)
+        return check_all(out_index, timestamp_limit_seconds,
+            proof_of_work_limit, scrypt);
+
+    const auto checker = std::make_shared<parallel_check>(elements_, count,
+        timestamp_limit_seconds, proof_of_work_limit, scrypt);
+
+    // The calling thread is one of the checkers.
+    const auto jobs = std::min(pool.size(), count - 1u);
+
+    for (size_t job = 0; job < jobs; ++job)
+        pool.service().post([checker]() { checker->run(); });
+
+    checker->run();
+    const auto ec = checker->wait();
+
+    if (ec)
+    {
+        out_index = checker->failed;
+        return ec;
+    }
+
+    if (unlinked == elements_.size())
+        return error::success;
+
+    out_index = unlinked;
+    return error::invalid_previous_block;
+}
+
 void headers::to_hashes(hash_list& out) const
 {
     out.clear();
@@ -21,8 +21,8 @@
 #include <bitcoin/bitcoin/constants.hpp>
 #include <bitcoin/bitcoin/message/messages.hpp>
 #include <bitcoin/bitcoin/message/version.hpp>
-#include <bitcoin/bitcoin/utility/container_sink.hpp>
-#include <bitcoin/bitcoin/utility/container_source.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
 #include <bitcoin/bitcoin/utility/ostream_writer.hpp>
 
@@ -131,8 +131,8 @@ void heading::reset()
 
 bool heading::from_data(const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(istream);
+    byte_reader source(data);
+    return from_data(source);
 }
 
 bool heading::from_data(std::istream& stream)
@@ -160,9 +160,8 @@ data_chunk heading::to_data() const
     data_chunk data;
     const auto size = satoshi_fixed_size();
     data.reserve(size);
-    data_sink ostream(data);
-    to_data(ostream);
-    ostream.flush();
+    byte_writer sink(data);
+    to_data(sink);
     BITCOIN_ASSERT(data.size() == size);
     return data;
 }
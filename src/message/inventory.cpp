@@ -25,9 +25,10 @@
 #include <bitcoin/bitcoin/message/inventory.hpp>
 #include <bitcoin/bitcoin/message/inventory_vector.hpp>
 #include <bitcoin/bitcoin/message/messages.hpp>
+#include <bitcoin/bitcoin/message/statistics.hpp>
 #include <bitcoin/bitcoin/message/version.hpp>
-#include <bitcoin/bitcoin/utility/container_sink.hpp>
-#include <bitcoin/bitcoin/utility/container_source.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
 #include <bitcoin/bitcoin/utility/ostream_writer.hpp>
 
@@ -41,25 +42,19 @@ const uint32_t inventory::version_maximum = version::level::maximum;
 inventory inventory::factory(uint32_t version,
     const data_chunk& data)
 {
-    inventory instance;
-    instance.from_data(version, data);
-    return instance;
+    return statistics::factory<inventory>(version, data);
 }
 
 inventory inventory::factory(uint32_t version,
     std::istream& stream)
 {
-    inventory instance;
-    instance.from_data(version, stream);
-    return instance;
+    return statistics::factory<inventory>(version, stream);
 }
 
 inventory inventory::factory(uint32_t version,
     reader& source)
 {
-    inventory instance;
-    instance.from_data(version, source);
-    return instance;
+    return statistics::factory<inventory>(version, source);
 }
 
 inventory::inventory()
@@ -117,8 +112,8 @@ void inventory::reset()
 
 bool inventory::from_data(uint32_t version, const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(version, istream);
+    byte_reader source(data);
+    return from_data(version, source);
 }
 
 bool inventory::from_data(uint32_t version, std::istream& stream)
@@ -131,13 +126,9 @@ bool inventory::from_data(uint32_t version, reader& source)
 {
     reset();
 
-    const auto count = source.read_size_little_endian();
-
     // Guard against potential for arbitary memory allocation.
-    if (count > max_inventory)
-        source.invalidate();
-    else
-        inventories_.resize(count);
+    const auto size = inventory_vector::satoshi_fixed_size(version);
+    inventories_.resize(read_count(source, size, max_inventory));
 
     // Order is required.
     for (auto& inventory: inventories_)
@@ -155,9 +146,8 @@ data_chunk inventory::to_data(uint32_t version) const
     data_chunk data;
     const auto size = serialized_size(version);
     data.reserve(size);
-    data_sink ostream(data);
-    to_data(version, ostream);
-    ostream.flush();
+    byte_writer sink(data);
+    to_data(version, sink);
     BITCOIN_ASSERT(data.size() == size);
     return data;
 }
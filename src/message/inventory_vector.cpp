@@ -18,17 +18,21 @@
  */
 #include <bitcoin/bitcoin/message/inventory_vector.hpp>
 
+#include <algorithm>
 #include <cstdint>
 #include <string>
 #include <bitcoin/bitcoin/message/inventory.hpp>
-#include <bitcoin/bitcoin/utility/container_sink.hpp>
-#include <bitcoin/bitcoin/utility/container_source.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
+#include <bitcoin/bitcoin/utility/endian.hpp>
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
 #include <bitcoin/bitcoin/utility/ostream_writer.hpp>
 
 namespace libbitcoin {
 namespace message {
 
+BC_CONSTEXPR size_t inventory_vector::wire_size;
+
 uint32_t inventory_vector::to_number(type_id inventory_type)
 {
     return static_cast<uint32_t>(inventory_type);
@@ -132,8 +136,8 @@ void inventory_vector::to_witness()
 bool inventory_vector::from_data(uint32_t version,
     const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(version, istream);
+    byte_reader source(data);
+    return from_data(version, source);
 }
 
 bool inventory_vector::from_data(uint32_t version,
@@ -158,14 +162,21 @@ bool inventory_vector::from_data(uint32_t ,
     return source;
 }
 
+bool inventory_vector::from_wire_data(const wire_data& data)
+{
+    const auto bytes = data.data();
+    type_ = inventory_vector::to_type(load_little_endian<uint32_t>(bytes));
+    std::copy_n(bytes + sizeof(uint32_t), hash_size, hash_.begin());
+    return true;
+}
+
 data_chunk inventory_vector::to_data(uint32_t version) const
 {
     data_chunk data;
     const auto size = serialized_size(version);
     data.reserve(size);
-    data_sink ostream(data);
-    to_data(version, ostream);
-    ostream.flush();
+    byte_writer sink(data);
+    to_data(version, sink);
     BITCOIN_ASSERT(data.size() == size);
     return data;
 }
@@ -185,6 +196,15 @@ void inventory_vector::to_data(uint32_t ,
     sink.write_hash(hash_);
 }
 
+inventory_vector::wire_data inventory_vector::to_wire_data() const
+{
+    wire_data data;
+    const auto bytes = data.data();
+    store_little_endian(bytes, inventory_vector::to_number(type_));
+    std::copy(hash_.begin(), hash_.end(), bytes + sizeof(uint32_t));
+    return data;
+}
+
 size_t inventory_vector::serialized_size(uint32_t version) const
 {
     return inventory_vector::satoshi_fixed_size(version);
@@ -18,9 +18,10 @@
  */
 #include <bitcoin/bitcoin/message/memory_pool.hpp>
 
+#include <bitcoin/bitcoin/message/statistics.hpp>
 #include <bitcoin/bitcoin/message/version.hpp>
-#include <bitcoin/bitcoin/utility/container_sink.hpp>
-#include <bitcoin/bitcoin/utility/container_source.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
 #include <bitcoin/bitcoin/utility/ostream_writer.hpp>
 
@@ -34,25 +35,19 @@ const uint32_t memory_pool::version_maximum = version::level::maximum;
 memory_pool memory_pool::factory(uint32_t version,
     const data_chunk& data)
 {
-    memory_pool instance;
-    instance.from_data(version, data);
-    return instance;
+    return statistics::factory<memory_pool>(version, data);
 }
 
 memory_pool memory_pool::factory(uint32_t version,
     std::istream& stream)
 {
-    memory_pool instance;
-    instance.from_data(version, stream);
-    return instance;
+    return statistics::factory<memory_pool>(version, stream);
 }
 
 memory_pool memory_pool::factory(uint32_t version,
     reader& source)
 {
-    memory_pool instance;
-    instance.from_data(version, source);
-    return instance;
+    return statistics::factory<memory_pool>(version, source);
 }
 
 // This is a default instance so is invalid.
@@ -91,8 +86,8 @@ void memory_pool::reset()
 
 bool memory_pool::from_data(uint32_t version, const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(version, istream);
+    byte_reader source(data);
+    return from_data(version, source);
 }
 
 bool memory_pool::from_data(uint32_t version, std::istream& stream)
@@ -122,9 +117,8 @@ data_chunk memory_pool::to_data(uint32_t version) const
     data_chunk data;
     const auto size = serialized_size(version);
     data.reserve(size);
-    data_sink ostream(data);
-    to_data(version, ostream);
-    ostream.flush();
+    byte_writer sink(data);
+    to_data(version, sink);
     BITCOIN_ASSERT(data.size() == size);
     return data;
 }
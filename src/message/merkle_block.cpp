@@ -18,14 +18,20 @@
  */
 #include <bitcoin/bitcoin/message/merkle_block.hpp>
 
+#include <cstddef>
+#include <utility>
+#include <vector>
 #include <bitcoin/bitcoin/chain/block.hpp>
 #include <bitcoin/bitcoin/chain/header.hpp>
+#include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
 #include <bitcoin/bitcoin/math/limits.hpp>
 #include <bitcoin/bitcoin/message/messages.hpp>
+#include <bitcoin/bitcoin/message/statistics.hpp>
 #include <bitcoin/bitcoin/message/version.hpp>
 #include <bitcoin/bitcoin/utility/assert.hpp>
-#include <bitcoin/bitcoin/utility/container_sink.hpp>
-#include <bitcoin/bitcoin/utility/container_source.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
 #include <bitcoin/bitcoin/utility/ostream_writer.hpp>
 
@@ -38,23 +44,17 @@ const uint32_t merkle_block::version_maximum = version::level::maximum;
 
 merkle_block merkle_block::factory(uint32_t version, const data_chunk& data)
 {
-    merkle_block instance;
-    instance.from_data(version, data);
-    return instance;
+    return statistics::factory<merkle_block>(version, data);
 }
 
 merkle_block merkle_block::factory(uint32_t version, std::istream& stream)
 {
-    merkle_block instance;
-    instance.from_data(version, stream);
-    return instance;
+    return statistics::factory<merkle_block>(version, stream);
 }
 
 merkle_block merkle_block::factory(uint32_t version, reader& source)
 {
-    merkle_block instance;
-    instance.from_data(version, source);
-    return instance;
+    return statistics::factory<merkle_block>(version, source);
 }
 
 merkle_block::merkle_block()
@@ -86,6 +86,70 @@ merkle_block::merkle_block(const chain::block& block)
 {
 }
 
+merkle_block::merkle_block(const chain::block& block,
+    const std::vector<bool>& matches)
+  : header_(block.header()),
+    total_transactions_(block.transactions().size()),
+    hashes_(),
+    flags_()
+{
+    BITCOIN_ASSERT(matches.size() == total_transactions_);
+
+    if (total_transactions_ == 0)
+        return;
+
+    // Level zero is the transaction hashes, each above is its parents.
+    hash_tree hashes{ block.to_hashes() };
+    match_tree tree{ matches };
+    tree.front().resize(total_transactions_, false);
+
+    while (hashes.back().size() > 1)
+    {
+        auto level = hashes.back();
+        merkle_hash_level(level);
+        hashes.push_back(std::move(level));
+
+        const auto& children = tree.back();
+        std::vector<bool> parents((children.size() + 1) / 2);
+
+        for (size_t child = 0; child < children.size(); ++child)
+            if (children[child])
+                parents[child / 2] = true;
+
+        tree.push_back(std::move(parents));
+    }
+
+    bit_list bits;
+    traverse(hashes, tree, hashes.size() - 1, 0, hashes_, bits);
+
+    // Bits are packed from the least significant bit of each byte.
+    flags_.resize((bits.size() + byte_bits - 1) / byte_bits, 0x00);
+
+    for (size_t bit = 0; bit < bits.size(); ++bit)
+        if (bits[bit])
+            flags_[bit / byte_bits] |= (1u << (bit % byte_bits));
+}
+
+// Depth first, a node without matches below it (or a leaf) is its hash.
+void merkle_block::traverse(const hash_tree& hashes, const match_tree& matches,
+    size_t height, size_t position, hash_list& out_hashes, bit_list& out_bits)
+{
+    const auto parent = matches[height][position];
+    out_bits.push_back(parent);
+
+    if (height == 0 || !parent)
+    {
+        out_hashes.push_back(hashes[height][position]);
+        return;
+    }
+
+    const auto left = position * 2;
+    traverse(hashes, matches, height - 1, left, out_hashes, out_bits);
+
+    if (left + 1 < hashes[height - 1].size())
+        traverse(hashes, matches, height - 1, left + 1, out_hashes, out_bits);
+}
+
 merkle_block::merkle_block(const merkle_block& other)
   : merkle_block(other.header_, other.total_transactions_, other.hashes_,
       other.flags_)
@@ -115,8 +179,8 @@ void merkle_block::reset()
 
 bool merkle_block::from_data(uint32_t version, const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(version, istream);
+    byte_reader source(data);
+    return from_data(version, source);
 }
 
 bool merkle_block::from_data(uint32_t version, std::istream& stream)
@@ -133,18 +197,15 @@ bool merkle_block::from_data(uint32_t version, reader& source)
         return false;
 
     total_transactions_ = source.read_4_bytes_little_endian();
-    const auto count = source.read_size_little_endian();
 
     // Guard against potential for arbitary memory allocation.
-    if (count > max_block_size)
-        source.invalidate();
-    else
-        hashes_.reserve(count);
+    const auto count = read_count(source, hash_size, max_block_size);
+    hashes_.reserve(count);
 
-    for (size_t hash = 0; hash < hashes_.capacity() && source; ++hash)
+    for (size_t hash = 0; hash < count && source; ++hash)
         hashes_.push_back(source.read_hash());
 
-    flags_ = source.read_bytes(source.read_size_little_endian());
+    flags_ = source.read_bytes(read_count(source, 1, max_block_size));
 
     if (version < merkle_block::version_minimum)
         source.invalidate();
@@ -160,9 +221,8 @@ data_chunk merkle_block::to_data(uint32_t version) const
     data_chunk data;
     const auto size = serialized_size(version);
     data.reserve(size);
-    data_sink ostream(data);
-    to_data(version, ostream);
-    ostream.flush();
+    byte_writer sink(data);
+    to_data(version, sink);
     BITCOIN_ASSERT(data.size() == size);
     return data;
 }
@@ -36,5 +36,15 @@ size_t variable_uint_size(uint64_t value)
         return 9;
 }
 
+size_t variable_base128_size(uint64_t value)
+{
+    size_t size = 1;
+
+    for (; value > 0x7f; ++size)
+        value = (value >> 7) - 1;
+
+    return size;
+}
+
 } // namespace message
 } // namespace libbitcoin
@@ -20,19 +20,27 @@
 
 #include <algorithm>
 #include <cstdint>
-#include <bitcoin/bitcoin/utility/container_sink.hpp>
-#include <bitcoin/bitcoin/utility/container_source.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
+#include <bitcoin/bitcoin/utility/endian.hpp>
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
 #include <bitcoin/bitcoin/utility/ostream_writer.hpp>
 
 namespace libbitcoin {
 namespace message {
 
+BC_CONSTEXPR size_t network_address::wire_size;
+
 static const ip_address null_address
 {
     { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }
 };
 
+// Offsets of the timestamped serialization.
+static BC_CONSTEXPR size_t services_offset = 4;
+static BC_CONSTEXPR size_t ip_offset = services_offset + 8;
+static BC_CONSTEXPR size_t port_offset = ip_offset + 16;
+
 // TODO: create derived address that adds the timestamp.
 network_address::network_address(uint32_t timestamp, uint64_t services,
     ip_address&& ip, uint16_t port)
@@ -99,8 +107,8 @@ void network_address::reset()
 bool network_address::from_data(uint32_t version,
     const data_chunk& data, bool with_timestamp)
 {
-    data_source istream(data);
-    return from_data(version, istream, with_timestamp);
+    byte_reader source(data);
+    return from_data(version, source, with_timestamp);
 }
 
 bool network_address::from_data(uint32_t version,
@@ -130,15 +138,24 @@ bool network_address::from_data(uint32_t , reader& source,
     return source;
 }
 
+bool network_address::from_wire_data(const wire_data& data)
+{
+    const auto bytes = data.data();
+    timestamp_ = load_little_endian<uint32_t>(bytes);
+    services_ = load_little_endian<uint64_t>(bytes + services_offset);
+    std::copy_n(bytes + ip_offset, ip_.size(), ip_.begin());
+    port_ = load_big_endian<uint16_t>(bytes + port_offset);
+    return true;
+}
+
 data_chunk network_address::to_data(uint32_t version,
     bool with_timestamp) const
 {
     data_chunk data;
     const auto size = serialized_size(version, with_timestamp);
     data.reserve(size);
-    data_sink ostream(data);
-    to_data(version, ostream, with_timestamp);
-    ostream.flush();
+    byte_writer sink(data);
+    to_data(version, sink, with_timestamp);
     BITCOIN_ASSERT(data.size() == size);
     return data;
 }
@@ -161,6 +178,17 @@ void network_address::to_data(uint32_t ,
     sink.write_2_bytes_big_endian(port_);
 }
 
+network_address::wire_data network_address::to_wire_data() const
+{
+    wire_data data;
+    const auto bytes = data.data();
+    store_little_endian(bytes, timestamp_);
+    store_little_endian(bytes + services_offset, services_);
+    std::copy(ip_.begin(), ip_.end(), bytes + ip_offset);
+    store_big_endian(bytes + port_offset, port_);
+    return data;
+}
+
 size_t network_address::serialized_size(uint32_t version,
     bool with_timestamp) const
 {
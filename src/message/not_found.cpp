@@ -21,6 +21,7 @@
 #include <initializer_list>
 #include <bitcoin/bitcoin/math/hash.hpp>
 #include <bitcoin/bitcoin/message/inventory.hpp>
+#include <bitcoin/bitcoin/message/statistics.hpp>
 #include <bitcoin/bitcoin/message/version.hpp>
 
 namespace libbitcoin {
@@ -33,25 +34,19 @@ const uint32_t not_found::version_maximum = version::level::maximum;
 not_found not_found::factory(uint32_t version,
     const data_chunk& data)
 {
-    not_found instance;
-    instance.from_data(version, data);
-    return instance;
+    return statistics::factory<not_found>(version, data);
 }
 
 not_found not_found::factory(uint32_t version,
     std::istream& stream)
 {
-    not_found instance;
-    instance.from_data(version, stream);
-    return instance;
+    return statistics::factory<not_found>(version, stream);
 }
 
 not_found not_found::factory(uint32_t version,
     reader& source)
 {
-    not_found instance;
-    instance.from_data(version, source);
-    return instance;
+    return statistics::factory<not_found>(version, source);
 }
 
 not_found::not_found()
@@ -18,9 +18,11 @@
  */
 #include <bitcoin/bitcoin/message/ping.hpp>
 
+#include <bitcoin/bitcoin/message/statistics.hpp>
 #include <bitcoin/bitcoin/message/version.hpp>
-#include <bitcoin/bitcoin/utility/container_sink.hpp>
-#include <bitcoin/bitcoin/utility/container_source.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
+#include <bitcoin/bitcoin/utility/endian.hpp>
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
 #include <bitcoin/bitcoin/utility/ostream_writer.hpp>
 
@@ -30,26 +32,21 @@ namespace message {
 const std::string ping::command = "ping";
 const uint32_t ping::version_minimum = version::level::minimum;
 const uint32_t ping::version_maximum = version::level::maximum;
+BC_CONSTEXPR size_t ping::wire_size;
 
 ping ping::factory(uint32_t version, const data_chunk& data)
 {
-    ping instance;
-    instance.from_data(version, data);
-    return instance;
+    return statistics::factory<ping>(version, data);
 }
 
 ping ping::factory(uint32_t version, std::istream& stream)
 {
-    ping instance;
-    instance.from_data(version, stream);
-    return instance;
+    return statistics::factory<ping>(version, stream);
 }
 
 ping ping::factory(uint32_t version, reader& source)
 {
-    ping instance;
-    instance.from_data(version, source);
-    return instance;
+    return statistics::factory<ping>(version, source);
 }
 
 size_t ping::satoshi_fixed_size(uint32_t version)
@@ -74,8 +71,8 @@ ping::ping(const ping& other)
 
 bool ping::from_data(uint32_t version, const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(version, istream);
+    byte_reader source(data);
+    return from_data(version, source);
 }
 
 bool ping::from_data(uint32_t version, std::istream& stream)
@@ -100,14 +97,21 @@ bool ping::from_data(uint32_t version, reader& source)
     return source;
 }
 
+bool ping::from_wire_data(const wire_data& data)
+{
+    valid_ = true;
+    nonceless_ = false;
+    nonce_ = load_little_endian<uint64_t>(data.data());
+    return true;
+}
+
 data_chunk ping::to_data(uint32_t version) const
 {
     data_chunk data;
     const auto size = serialized_size(version);
     data.reserve(size);
-    data_sink ostream(data);
-    to_data(version, ostream);
-    ostream.flush();
+    byte_writer sink(data);
+    to_data(version, sink);
     BITCOIN_ASSERT(data.size() == size);
     return data;
 }
@@ -124,6 +128,13 @@ void ping::to_data(uint32_t version, writer& sink) const
         sink.write_8_bytes_little_endian(nonce_);
 }
 
+ping::wire_data ping::to_wire_data() const
+{
+    wire_data data;
+    store_little_endian(data.data(), nonce_);
+    return data;
+}
+
 bool ping::is_valid() const
 {
     return valid_ || nonceless_ || nonce_ != 0;
@@ -18,9 +18,11 @@
  */
 #include <bitcoin/bitcoin/message/pong.hpp>
 
+#include <bitcoin/bitcoin/message/statistics.hpp>
 #include <bitcoin/bitcoin/message/version.hpp>
-#include <bitcoin/bitcoin/utility/container_sink.hpp>
-#include <bitcoin/bitcoin/utility/container_source.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
+#include <bitcoin/bitcoin/utility/endian.hpp>
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
 #include <bitcoin/bitcoin/utility/ostream_writer.hpp>
 
@@ -30,26 +32,21 @@ namespace message {
 const std::string pong::command = "pong";
 const uint32_t pong::version_minimum = version::level::minimum;
 const uint32_t pong::version_maximum = version::level::maximum;
+BC_CONSTEXPR size_t pong::wire_size;
 
 pong pong::factory(uint32_t version, const data_chunk& data)
 {
-    pong instance;
-    instance.from_data(version, data);
-    return instance;
+    return statistics::factory<pong>(version, data);
 }
 
 pong pong::factory(uint32_t version, std::istream& stream)
 {
-    pong instance;
-    instance.from_data(version, stream);
-    return instance;
+    return statistics::factory<pong>(version, stream);
 }
 
 pong pong::factory(uint32_t version, reader& source)
 {
-    pong instance;
-    instance.from_data(version, source);
-    return instance;
+    return statistics::factory<pong>(version, source);
 }
 
 size_t pong::satoshi_fixed_size(uint32_t)
@@ -74,8 +71,8 @@ pong::pong(const pong& other)
 
 bool pong::from_data(uint32_t version, const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(version, istream);
+    byte_reader source(data);
+    return from_data(version, source);
 }
 
 bool pong::from_data(uint32_t version, std::istream& stream)
@@ -97,14 +94,20 @@ bool pong::from_data(uint32_t , reader& source)
     return source;
 }
 
+bool pong::from_wire_data(const wire_data& data)
+{
+    valid_ = true;
+    nonce_ = load_little_endian<uint64_t>(data.data());
+    return true;
+}
+
 data_chunk pong::to_data(uint32_t version) const
 {
     data_chunk data;
     const auto size = serialized_size(version);
     data.reserve(size);
-    data_sink ostream(data);
-    to_data(version, ostream);
-    ostream.flush();
+    byte_writer sink(data);
+    to_data(version, sink);
     BITCOIN_ASSERT(data.size() == size);
     return data;
 }
@@ -120,6 +123,13 @@ void pong::to_data(uint32_t , writer& sink) const
     sink.write_8_bytes_little_endian(nonce_);
 }
 
+pong::wire_data pong::to_wire_data() const
+{
+    wire_data data;
+    store_little_endian(data.data(), nonce_);
+    return data;
+}
+
 bool pong::is_valid() const
 {
     return valid_ || (nonce_ != 0);
@@ -0,0 +1,98 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/message/raw_message.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/math/checksum.hpp>
+#include <bitcoin/bitcoin/message/heading.hpp>
+#include <bitcoin/bitcoin/utility/assert.hpp>
+#include <bitcoin/bitcoin/utility/asio.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+
+namespace libbitcoin {
+namespace message {
+
+static raw_message::heading_bytes to_head(uint32_t magic,
+    const std::string& command, data_slice payload, uint32_t checksum)
+{
+    BITCOIN_ASSERT(payload.size() <= max_uint32);
+    const auto size = static_cast<uint32_t>(payload.size());
+    const auto data = heading(magic, command, size, checksum).to_data();
+    BITCOIN_ASSERT(data.size() == heading::satoshi_fixed_size());
+
+    raw_message::heading_bytes head;
+    std::copy(data.begin(), data.end(), head.begin());
+    return head;
+}
+
+raw_message::raw_message(uint32_t magic, const std::string& command,
+    data_slice payload, storage_ptr storage)
+  : raw_message(magic, command, payload, bitcoin_checksum(payload), storage)
+{
+}
+
+raw_message::raw_message(uint32_t magic, const std::string& command,
+    data_slice payload, uint32_t checksum, storage_ptr storage)
+  : head_(to_head(magic, command, payload, checksum)),
+    payload_(payload),
+    storage_(storage)
+{
+}
+
+const raw_message::heading_bytes& raw_message::head() const
+{
+    return head_;
+}
+
+data_slice raw_message::payload() const
+{
+    return payload_;
+}
+
+size_t raw_message::size() const
+{
+    return head_.size() + payload_.size();
+}
+
+raw_message::buffers raw_message::to_buffers() const
+{
+    return
+    {
+        {
+            boost::asio::buffer(head_.data(), head_.size()),
+            boost::asio::buffer(payload_.data(), payload_.size())
+        }
+    };
+}
+
+data_chunk raw_message::to_data() const
+{
+    data_chunk data;
+    data.reserve(size());
+    extend_data(data, head_);
+    extend_data(data, payload_);
+    return data;
+}
+
+} // namespace message
+} // namespace libbitcoin
@@ -0,0 +1,144 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/message/reconciliation_set.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/math/pin_sketch.hpp>
+#include <bitcoin/bitcoin/math/siphash.hpp>
+#include <bitcoin/bitcoin/message/inventory.hpp>
+#include <bitcoin/bitcoin/message/inventory_vector.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/sha256_writer.hpp>
+
+namespace libbitcoin {
+namespace message {
+
+const size_t reconciliation_set::max_capacity = 1000;
+
+static const std::string salt_tag = "Tx Relay Salting";
+
+// The key is the tagged sha256 of the lesser then the greater salt (bip330).
+siphash_key reconciliation_set::to_key(uint64_t local_salt,
+    uint64_t remote_salt)
+{
+    const auto tag = sha256_hash(to_chunk(salt_tag));
+    sha256_writer sink;
+    sink.write_bytes(tag);
+    sink.write_bytes(tag);
+    sink.write_8_bytes_little_endian(std::min(local_salt, remote_salt));
+    sink.write_8_bytes_little_endian(std::max(local_salt, remote_salt));
+    return to_siphash_key(sink.sha256_digest());
+}
+
+reconciliation_set::reconciliation_set(uint64_t local_salt,
+    uint64_t remote_salt)
+  : key_(to_key(local_salt, remote_salt))
+{
+}
+
+reconciliation_set::short_id reconciliation_set::to_short_id(
+    const hash_digest& hash) const
+{
+    return static_cast<short_id>(1 + siphash(key_, hash) % max_uint32);
+}
+
+bool reconciliation_set::insert(const hash_digest& hash)
+{
+    return hashes_.emplace(to_short_id(hash), hash).second;
+}
+
+bool reconciliation_set::erase(const hash_digest& hash)
+{
+    const auto it = hashes_.find(to_short_id(hash));
+
+    if (it == hashes_.end() || it->second != hash)
+        return false;
+
+    hashes_.erase(it);
+    return true;
+}
+
+size_t reconciliation_set::size() const
+{
+    return hashes_.size();
+}
+
+bool reconciliation_set::empty() const
+{
+    return hashes_.empty();
+}
+
+void reconciliation_set::clear()
+{
+    hashes_.clear();
+}
+
+size_t reconciliation_set::capacity(size_t remote_size, double q) const
+{
+    return pin_sketch::estimate_capacity(hashes_.size(), remote_size, q,
+        max_capacity);
+}
+
+pin_sketch reconciliation_set::sketch(size_t capacity) const
+{
+    pin_sketch out(std::min(capacity, max_capacity));
+
+    for (const auto& entry: hashes_)
+        out.add(entry.first);
+
+    return out;
+}
+
+bool reconciliation_set::differences(short_id_list& out,
+    const pin_sketch& remote) const
+{
+    if (remote.capacity() > max_capacity)
+        return false;
+
+    auto merged = sketch(remote.capacity());
+    merged ^= remote;
+    return merged.decode(out);
+}
+
+inventory reconciliation_set::to_inventory(const short_id_list& differences,
+    short_id_list& missing) const
+{
+    static const auto type = inventory_vector::type_id::witness_transaction;
+    inventory_vector::list out;
+
+    for (const auto id: differences)
+    {
+        const auto it = hashes_.find(id);
+
+        if (it == hashes_.end())
+            missing.push_back(id);
+        else
+            out.emplace_back(type, it->second);
+    }
+
+    return { std::move(out) };
+}
+
+} // namespace message
+} // namespace libbitcoin
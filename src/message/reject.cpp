@@ -20,10 +20,11 @@
 
 #include <bitcoin/bitcoin/message/block.hpp>
 #include <bitcoin/bitcoin/message/messages.hpp>
+#include <bitcoin/bitcoin/message/statistics.hpp>
 #include <bitcoin/bitcoin/message/transaction.hpp>
 #include <bitcoin/bitcoin/message/version.hpp>
-#include <bitcoin/bitcoin/utility/container_sink.hpp>
-#include <bitcoin/bitcoin/utility/container_source.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
 #include <bitcoin/bitcoin/utility/ostream_writer.hpp>
 
@@ -37,25 +38,19 @@ const uint32_t reject::version_maximum = version::level::maximum;
 reject reject::factory(uint32_t version,
     const data_chunk& data)
 {
-    reject instance;
-    instance.from_data(version, data);
-    return instance;
+    return statistics::factory<reject>(version, data);
 }
 
 reject reject::factory(uint32_t version,
     std::istream& stream)
 {
-    reject instance;
-    instance.from_data(version, stream);
-    return instance;
+    return statistics::factory<reject>(version, stream);
 }
 
 reject reject::factory(uint32_t version,
     reader& source)
 {
-    reject instance;
-    instance.from_data(version, source);
-    return instance;
+    return statistics::factory<reject>(version, source);
 }
 
 reject::reject()
@@ -126,8 +121,8 @@ void reject::reset()
 
 bool reject::from_data(uint32_t version, const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(version, istream);
+    byte_reader source(data);
+    return from_data(version, source);
 }
 
 bool reject::from_data(uint32_t version, std::istream& stream)
@@ -169,9 +164,8 @@ data_chunk reject::to_data(uint32_t version) const
     data_chunk data;
     const auto size = serialized_size(version);
     data.reserve(size);
-    data_sink ostream(data);
-    to_data(version, ostream);
-    ostream.flush();
+    byte_writer sink(data);
+    to_data(version, sink);
     BITCOIN_ASSERT(data.size() == size);
     return data;
 }
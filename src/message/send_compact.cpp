@@ -19,9 +19,11 @@
 #include <bitcoin/bitcoin/message/send_compact.hpp>
 
 #include <cstdint>
+#include <bitcoin/bitcoin/message/statistics.hpp>
 #include <bitcoin/bitcoin/message/version.hpp>
-#include <bitcoin/bitcoin/utility/container_sink.hpp>
-#include <bitcoin/bitcoin/utility/container_source.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
+#include <bitcoin/bitcoin/utility/endian.hpp>
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
 #include <bitcoin/bitcoin/utility/ostream_writer.hpp>
 
@@ -31,29 +33,24 @@ namespace message {
 const std::string send_compact::command = "sendcmpct";
 const uint32_t send_compact::version_minimum = version::level::bip152;
 const uint32_t send_compact::version_maximum = version::level::bip152;
+BC_CONSTEXPR size_t send_compact::wire_size;
 
 send_compact send_compact::factory(uint32_t version,
     const data_chunk& data)
 {
-    send_compact instance;
-    instance.from_data(version, data);
-    return instance;
+    return statistics::factory<send_compact>(version, data);
 }
 
 send_compact send_compact::factory(uint32_t version,
     std::istream& stream)
 {
-    send_compact instance;
-    instance.from_data(version, stream);
-    return instance;
+    return statistics::factory<send_compact>(version, stream);
 }
 
 send_compact send_compact::factory(uint32_t version,
     reader& source)
 {
-    send_compact instance;
-    instance.from_data(version, source);
-    return instance;
+    return statistics::factory<send_compact>(version, source);
 }
 
 size_t send_compact::satoshi_fixed_size(uint32_t)
@@ -97,8 +94,8 @@ void send_compact::reset()
 bool send_compact::from_data(uint32_t version,
     const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(version, istream);
+    byte_reader source(data);
+    return from_data(version, source);
 }
 
 bool send_compact::from_data(uint32_t version,
@@ -130,14 +127,28 @@ bool send_compact::from_data(uint32_t version,
     return source;
 }
 
+bool send_compact::from_wire_data(const wire_data& data)
+{
+    const auto mode = data[0];
+
+    if (mode > 1)
+    {
+        reset();
+        return false;
+    }
+
+    high_bandwidth_mode_ = (mode == 1);
+    this->version_ = load_little_endian<uint64_t>(data.data() + 1);
+    return true;
+}
+
 data_chunk send_compact::to_data(uint32_t version) const
 {
     data_chunk data;
     const auto size = serialized_size(version);
     data.reserve(size);
-    data_sink ostream(data);
-    to_data(version, ostream);
-    ostream.flush();
+    byte_writer sink(data);
+    to_data(version, sink);
     BITCOIN_ASSERT(data.size() == size);
     return data;
 }
@@ -156,6 +167,14 @@ void send_compact::to_data(uint32_t ,
     sink.write_8_bytes_little_endian(this->version_);
 }
 
+send_compact::wire_data send_compact::to_wire_data() const
+{
+    wire_data data;
+    data[0] = static_cast<uint8_t>(high_bandwidth_mode_);
+    store_little_endian(data.data() + 1, this->version_);
+    return data;
+}
+
 size_t send_compact::serialized_size(uint32_t version) const
 {
     return send_compact::satoshi_fixed_size(version);
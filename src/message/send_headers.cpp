@@ -18,9 +18,10 @@
  */
 #include <bitcoin/bitcoin/message/send_headers.hpp>
 
+#include <bitcoin/bitcoin/message/statistics.hpp>
 #include <bitcoin/bitcoin/message/version.hpp>
-#include <bitcoin/bitcoin/utility/container_sink.hpp>
-#include <bitcoin/bitcoin/utility/container_source.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
 #include <bitcoin/bitcoin/utility/ostream_writer.hpp>
 
@@ -34,25 +35,19 @@ const uint32_t send_headers::version_maximum = version::level::maximum;
 send_headers send_headers::factory(uint32_t version,
     const data_chunk& data)
 {
-    send_headers instance;
-    instance.from_data(version, data);
-    return instance;
+    return statistics::factory<send_headers>(version, data);
 }
 
 send_headers send_headers::factory(uint32_t version,
     std::istream& stream)
 {
-    send_headers instance;
-    instance.from_data(version, stream);
-    return instance;
+    return statistics::factory<send_headers>(version, stream);
 }
 
 send_headers send_headers::factory(uint32_t version,
     reader& source)
 {
-    send_headers instance;
-    instance.from_data(version, source);
-    return instance;
+    return statistics::factory<send_headers>(version, source);
 }
 
 size_t send_headers::satoshi_fixed_size(uint32_t)
@@ -96,8 +91,8 @@ void send_headers::reset()
 
 bool send_headers::from_data(uint32_t version, const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(version, istream);
+    byte_reader source(data);
+    return from_data(version, source);
 }
 
 bool send_headers::from_data(uint32_t version, std::istream& stream)
@@ -130,9 +125,8 @@ data_chunk send_headers::to_data(uint32_t version) const
     data_chunk data;
     const auto size = serialized_size(version);
     data.reserve(size);
-    data_sink ostream(data);
-    to_data(version, ostream);
-    ostream.flush();
+    byte_writer sink(data);
+    to_data(version, sink);
     BITCOIN_ASSERT(data.size() == size);
     return data;
 }
@@ -141,6 +135,10 @@ void send_headers::to_data(uint32_t, std::ostream&) const
 {
 }
 
+void send_headers::to_data(uint32_t, writer&) const
+{
+}
+
 size_t send_headers::serialized_size(uint32_t version) const
 {
     return send_headers::satoshi_fixed_size(version);
@@ -0,0 +1,294 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/message/statistics.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <bitcoin/bitcoin/log/metrics.hpp>
+#include <bitcoin/bitcoin/message/messages.hpp>
+#include <bitcoin/bitcoin/utility/asio.hpp>
+
+namespace libbitcoin {
+namespace message {
+
+static const size_t type_count = static_cast<size_t>(message_type::version) + 1;
+static const size_t operation_count = 2;
+
+// The counters of one message type and operation, each written only by the
+// owning thread, and moved out (exchanged) by merge.
+struct statistics_slot
+{
+    statistics_slot()
+      : bytes(0), nanoseconds(0)
+    {
+    }
+
+    std::atomic<uint64_t> bytes;
+    std::atomic<uint64_t> nanoseconds;
+    log::metrics::timer time;
+};
+
+// Slots are allocated by the owning thread on the first operation of their
+// type and published to merge by the slot pointer.
+struct statistics_buffer
+{
+    statistics_buffer()
+    {
+        for (auto& slot: slots)
+            slot.store(nullptr, std::memory_order_relaxed);
+    }
+
+    ~statistics_buffer()
+    {
+        for (auto& slot: slots)
+            delete slot.load(std::memory_order_relaxed);
+    }
+
+    std::atomic<statistics_slot*> slots[type_count * operation_count];
+};
+
+struct statistics_state
+{
+    // These are protected by mutex.
+    std::vector<std::unique_ptr<statistics_buffer>> buffers;
+    std::vector<statistics_buffer*> released;
+    std::mutex mutex;
+};
+
+std::atomic<bool> statistics::enabled_(false);
+
+static statistics_state& state()
+{
+    static statistics_state instance;
+    return instance;
+}
+
+// The buffer of an exited thread is reused by the next new thread, so that
+// buffers are bounded by the peak thread count. Unmerged counters are kept.
+class thread_buffer
+{
+public:
+    thread_buffer()
+    {
+        auto& shared = state();
+
+        // Critical Section
+        ///////////////////////////////////////////////////////////////////////
+        std::lock_guard<std::mutex> lock(shared.mutex);
+
+        if (shared.released.empty())
+        {
+            shared.buffers.emplace_back(new statistics_buffer);
+            buffer_ = shared.buffers.back().get();
+            return;
+        }
+
+        buffer_ = shared.released.back();
+        shared.released.pop_back();
+        ///////////////////////////////////////////////////////////////////////
+    }
+
+    ~thread_buffer()
+    {
+        auto& shared = state();
+
+        // Critical Section
+        ///////////////////////////////////////////////////////////////////////
+        std::lock_guard<std::mutex> lock(shared.mutex);
+        shared.released.push_back(buffer_);
+        ///////////////////////////////////////////////////////////////////////
+    }
+
+    statistics_buffer& buffer()
+    {
+        return *buffer_;
+    }
+
+private:
+    statistics_buffer* buffer_;
+};
+
+static statistics_buffer& local_buffer()
+{
+    static thread_local thread_buffer local;
+    return local.buffer();
+}
+
+static size_t slot_index(message_type type, statistics::operation action)
+{
+    const auto index = std::min(static_cast<size_t>(type), type_count - 1);
+    return index * operation_count + static_cast<size_t>(action);
+}
+
+void statistics::enable(bool value)
+{
+    enabled_.store(value);
+}
+
+const std::string& statistics::command(message_type type)
+{
+    static const std::string unknown;
+
+    switch (type)
+    {
+        case message_type::address:
+            return address::command;
+        case message_type::alert:
+            return alert::command;
+        case message_type::block:
+            return block::command;
+        case message_type::block_transactions:
+            return block_transactions::command;
+        case message_type::compact_block:
+            return compact_block::command;
+        case message_type::fee_filter:
+            return fee_filter::command;
+        case message_type::filter_add:
+            return filter_add::command;
+        case message_type::filter_clear:
+            return filter_clear::command;
+        case message_type::filter_load:
+            return filter_load::command;
+        case message_type::get_address:
+            return get_address::command;
+        case message_type::get_block_transactions:
+            return get_block_transactions::command;
+        case message_type::get_blocks:
+            return get_blocks::command;
+        case message_type::get_data:
+            return get_data::command;
+        case message_type::get_headers:
+            return get_headers::command;
+        case message_type::headers:
+            return headers::command;
+        case message_type::inventory:
+            return inventory::command;
+        case message_type::memory_pool:
+            return memory_pool::command;
+        case message_type::merkle_block:
+            return merkle_block::command;
+        case message_type::not_found:
+            return not_found::command;
+        case message_type::ping:
+            return ping::command;
+        case message_type::pong:
+            return pong::command;
+        case message_type::reject:
+            return reject::command;
+        case message_type::send_compact:
+            return send_compact::command;
+        case message_type::send_headers:
+            return send_headers::command;
+        case message_type::transaction:
+            return transaction::command;
+        case message_type::verack:
+            return verack::command;
+        case message_type::version:
+            return version::command;
+        case message_type::unknown:
+        default:
+            return unknown;
+    }
+}
+
+void statistics::record(message_type type, operation action, size_t bytes,
+    const asio::time_point& start)
+{
+    const auto elapsed = asio::steady_clock::now() - start;
+    const auto nanoseconds = std::max(std::chrono::duration_cast<
+        std::chrono::nanoseconds>(elapsed).count(),
+        std::chrono::nanoseconds::rep(0));
+
+    auto& pointer = local_buffer().slots[slot_index(type, action)];
+    auto slot = pointer.load(std::memory_order_relaxed);
+
+    if (slot == nullptr)
+    {
+        slot = new statistics_slot;
+        pointer.store(slot, std::memory_order_release);
+    }
+
+    // Uncontended, as only merge otherwise touches the thread's counters.
+    slot->bytes.fetch_add(bytes, std::memory_order_relaxed);
+    slot->nanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+    slot->time.record(elapsed);
+}
+
+void statistics::merge(log::metrics& metrics, const std::string& prefix)
+{
+    auto& shared = state();
+
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    std::lock_guard<std::mutex> lock(shared.mutex);
+
+    for (const auto& buffer: shared.buffers)
+    {
+        for (size_t index = 0; index < type_count * operation_count; ++index)
+        {
+            const auto slot = buffer->slots[index].load(
+                std::memory_order_acquire);
+
+            if (slot == nullptr)
+                continue;
+
+            // An operation recorded during the merge may be split between
+            // intervals, but is never lost.
+            const auto interval = slot->time.take();
+
+            if (interval.count == 0)
+                continue;
+
+            const auto bytes = slot->bytes.exchange(0,
+                std::memory_order_relaxed);
+            const auto nanoseconds = slot->nanoseconds.exchange(0,
+                std::memory_order_relaxed);
+
+            const auto type = static_cast<message_type>(
+                index / operation_count);
+            const auto action = static_cast<operation>(
+                index % operation_count);
+            const auto name = prefix + command(type) +
+                (action == operation::parse ? ".parse" : ".serialize");
+
+            metrics.get_counter(name + ".bytes").increment(bytes);
+            metrics.get_counter(name + ".nanoseconds").increment(nanoseconds);
+            metrics.get_timer(name + ".time").merge(interval);
+        }
+    }
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+void statistics::attach(log::metrics& metrics, const std::string& prefix)
+{
+    metrics.add_sampler([prefix](log::metrics& metrics)
+    {
+        merge(metrics, prefix);
+    });
+}
+
+} // namespace message
+} // namespace libbitcoin
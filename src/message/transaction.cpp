@@ -22,6 +22,7 @@
 #include <utility>
 #include <bitcoin/bitcoin/chain/input.hpp>
 #include <bitcoin/bitcoin/chain/output.hpp>
+#include <bitcoin/bitcoin/message/statistics.hpp>
 #include <bitcoin/bitcoin/message/version.hpp>
 #include <bitcoin/bitcoin/utility/data.hpp>
 #include <bitcoin/bitcoin/utility/reader.hpp>
@@ -36,25 +37,19 @@ const uint32_t transaction::version_maximum = version::level::maximum;
 transaction transaction::factory(uint32_t version,
     const data_chunk& data)
 {
-    transaction instance;
-    instance.from_data(version, data);
-    return instance;
+    return statistics::factory<transaction>(version, data);
 }
 
 transaction transaction::factory(uint32_t version,
     std::istream& stream)
 {
-    transaction instance;
-    instance.from_data(version, stream);
-    return instance;
+    return statistics::factory<transaction>(version, stream);
 }
 
 transaction transaction::factory(uint32_t version,
     reader& source)
 {
-    transaction instance;
-    instance.from_data(version, source);
-    return instance;
+    return statistics::factory<transaction>(version, source);
 }
 
 transaction::transaction()
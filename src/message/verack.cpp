@@ -18,9 +18,10 @@
  */
 #include <bitcoin/bitcoin/message/verack.hpp>
 
+#include <bitcoin/bitcoin/message/statistics.hpp>
 #include <bitcoin/bitcoin/message/version.hpp>
-#include <bitcoin/bitcoin/utility/container_sink.hpp>
-#include <bitcoin/bitcoin/utility/container_source.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
 #include <bitcoin/bitcoin/utility/ostream_writer.hpp>
 
@@ -33,23 +34,17 @@ const uint32_t verack::version_maximum = version::level::maximum;
 
 verack verack::factory(uint32_t version, const data_chunk& data)
 {
-    verack instance;
-    instance.from_data(version, data);
-    return instance;
+    return statistics::factory<verack>(version, data);
 }
 
 verack verack::factory(uint32_t version, std::istream& stream)
 {
-    verack instance;
-    instance.from_data(version, stream);
-    return instance;
+    return statistics::factory<verack>(version, stream);
 }
 
 verack verack::factory(uint32_t version, reader& source)
 {
-    verack instance;
-    instance.from_data(version, source);
-    return instance;
+    return statistics::factory<verack>(version, source);
 }
 
 verack::verack()
@@ -67,8 +62,8 @@ void verack::reset()
 
 bool verack::from_data(uint32_t version, const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(version, istream);
+    byte_reader source(data);
+    return from_data(version, source);
 }
 
 bool verack::from_data(uint32_t version, std::istream& stream)
@@ -88,9 +83,8 @@ data_chunk verack::to_data(uint32_t version) const
     data_chunk data;
     const auto size = serialized_size(version);
     data.reserve(size);
-    data_sink ostream(data);
-    to_data(version, ostream);
-    ostream.flush();
+    byte_writer sink(data);
+    to_data(version, sink);
     BITCOIN_ASSERT(data.size() == size);
     return data;
 }
@@ -99,6 +93,10 @@ void verack::to_data(uint32_t, std::ostream&) const
 {
 }
 
+void verack::to_data(uint32_t, writer&) const
+{
+}
+
 size_t verack::serialized_size(uint32_t version) const
 {
     return verack::satoshi_fixed_size(version);
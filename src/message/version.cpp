@@ -20,8 +20,9 @@
 
 #include <algorithm>
 #include <bitcoin/bitcoin/message/messages.hpp>
-#include <bitcoin/bitcoin/utility/container_sink.hpp>
-#include <bitcoin/bitcoin/utility/container_source.hpp>
+#include <bitcoin/bitcoin/message/statistics.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
 #include <bitcoin/bitcoin/utility/ostream_writer.hpp>
 
@@ -36,25 +37,19 @@ const uint32_t message::version::version_maximum = level::maximum;
 version version::factory(uint32_t version,
     const data_chunk& data)
 {
-    message::version instance;
-    instance.from_data(version, data);
-    return instance;
+    return statistics::factory<message::version>(version, data);
 }
 
 version version::factory(uint32_t version,
     std::istream& stream)
 {
-    message::version instance;
-    instance.from_data(version, stream);
-    return instance;
+    return statistics::factory<message::version>(version, stream);
 }
 
 version version::factory(uint32_t version,
     reader& source)
 {
-    message::version instance;
-    instance.from_data(version, source);
-    return instance;
+    return statistics::factory<message::version>(version, source);
 }
 
 version::version()
@@ -132,8 +127,8 @@ void version::reset()
 
 bool version::from_data(uint32_t version, const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(version, istream);
+    byte_reader source(data);
+    return from_data(version, source);
 }
 
 bool version::from_data(uint32_t version, std::istream& stream)
@@ -183,9 +178,8 @@ data_chunk version::to_data(uint32_t version) const
     data_chunk data;
     const auto size = serialized_size(version);
     data.reserve(size);
-    data_sink ostream(data);
-    to_data(version, ostream);
-    ostream.flush();
+    byte_writer sink(data);
+    to_data(version, sink);
     BITCOIN_ASSERT(data.size() == size);
     return data;
 }
@@ -20,6 +20,7 @@
 #include <bitcoin/bitcoin/settings.hpp>
 #include <bitcoin/bitcoin/chain/block.hpp>
 #include <bitcoin/bitcoin/chain/chain_state.hpp>
+#include <bitcoin/bitcoin/network_profiles.hpp>
 
 namespace libbitcoin {
 
@@ -27,28 +28,46 @@ using namespace chain;
 
 // Common default values (no settings context).
 settings::settings()
-  : timestamp_limit_seconds(2 * 60 * 60),
-    first_version(1),
-    bip34_version(2),
-    bip66_version(3),
-    bip65_version(4),
-    bip9_version_bit0(1u << 0),
-    bip9_version_bit1(1u << 1),
-    bip9_version_base(0x20000000),
-    retargeting_factor_(4),
-    block_spacing_seconds_(10 * 60),
-    retargeting_interval_seconds_(2 * 7 * 24 * 60 * 60),
+  : timestamp_limit_seconds(profiles::common::timestamp_limit_seconds),
+    cache_budget_bytes(0),
+    first_version(profiles::common::first_version),
+    bip34_version(profiles::common::bip34_version),
+    bip66_version(profiles::common::bip66_version),
+    bip65_version(profiles::common::bip65_version),
+    bip9_version_bit0(profiles::common::bip9_version_bit0),
+    bip9_version_bit1(profiles::common::bip9_version_bit1),
+    bip9_version_base(profiles::common::bip9_version_base),
+    retargeting_factor_(profiles::common::retargeting_factor),
+    block_spacing_seconds_(profiles::common::block_spacing_seconds),
+    retargeting_interval_seconds_(
+        profiles::common::retargeting_interval_seconds),
     minimum_timespan_(chain_state::minimum_timespan(
         retargeting_interval_seconds_, retargeting_factor_)),
     maximum_timespan_(chain_state::maximum_timespan(
         retargeting_interval_seconds_, retargeting_factor_)),
     retargeting_interval_(chain_state::retargeting_interval(
         retargeting_interval_seconds_, block_spacing_seconds_)),
-    initial_block_subsidy_bitcoin_(50),
-    recursive_money_(9999999989u)
+    initial_block_subsidy_bitcoin_(
+        profiles::common::initial_block_subsidy_bitcoin),
+    recursive_money_(profiles::common::recursive_money)
 {
 }
 
+// The scalar parameters of the network are those of its profile.
+template <typename Profile>
+static void populate(settings& out)
+{
+    out.proof_of_work_limit = Profile::proof_of_work_limit;
+    out.activation_threshold = Profile::activation_threshold;
+    out.enforcement_threshold = Profile::enforcement_threshold;
+    out.activation_sample = Profile::activation_sample;
+    out.bip65_freeze = Profile::bip65_freeze;
+    out.bip66_freeze = Profile::bip66_freeze;
+    out.bip34_freeze = Profile::bip34_freeze;
+    out.bip16_activation_time = Profile::bip16_activation_time;
+    out.subsidy_interval(Profile::subsidy_interval);
+}
+
 settings::settings(config::settings context)
   : settings()
 {
@@ -56,7 +75,7 @@ settings::settings(config::settings context)
     {
         case config::settings::mainnet:
         {
-            proof_of_work_limit = 0x1d00ffff;
+            populate<profiles::mainnet>(*this);
             genesis_block = chain::block::factory({
                 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
                 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -94,13 +113,6 @@ settings::settings(config::settings context)
                 0x5c, 0x38, 0x4d, 0xf7, 0xba, 0x0b, 0x8d, 0x57,
                 0x8a, 0x4c, 0x70, 0x2b, 0x6b, 0xf1, 0x1d, 0x5f,
                 0xac, 0x00, 0x00, 0x00, 0x00});
-            activation_threshold = 750;
-            enforcement_threshold = 950;
-            activation_sample = 1000;
-            bip65_freeze = 388381;
-            bip66_freeze = 363725;
-            bip34_freeze = 227931;
-            bip16_activation_time = 0x4f779a80;
             bip34_active_checkpoint = config::checkpoint(
                 "000000000000024b89b42a942fe0d9fea3bb44ab7bd1b19115dd6a759c0808b8",
                 bip34_freeze);
@@ -110,14 +122,12 @@ settings::settings(config::settings context)
             bip9_bit1_active_checkpoint = config::checkpoint(
                 "0000000000000000001c8018d9cb3b742ef25114f27563e3fc4a1902167f9893",
                 481824);
-
-            subsidy_interval_ = 210000;
             break;
         }
 
         case config::settings::testnet:
         {
-            proof_of_work_limit = 0x1d00ffff;
+            populate<profiles::testnet>(*this);
             genesis_block = chain::block::factory({
                 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
                 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -155,13 +165,6 @@ settings::settings(config::settings context)
                 0x5c, 0x38, 0x4d, 0xf7, 0xba, 0x0b, 0x8d, 0x57,
                 0x8a, 0x4c, 0x70, 0x2b, 0x6b, 0xf1, 0x1d, 0x5f,
                 0xac, 0x00, 0x00, 0x00, 0x00});
-            activation_threshold = 51;
-            enforcement_threshold = 75;
-            activation_sample = 100;
-            bip65_freeze = 581885;
-            bip66_freeze = 330776;
-            bip34_freeze = 21111;
-            bip16_activation_time = 0x4f3af580;
             bip34_active_checkpoint = config::checkpoint(
                 "0000000023b3a96d3484e5abb3755c413e7d41500f8e2a5c3f0dd01299cd8ef8",
                 bip34_freeze);
@@ -171,14 +174,12 @@ settings::settings(config::settings context)
             bip9_bit1_active_checkpoint = config::checkpoint(
                 "00000000002b980fcd729daaa248fd9316a5200e9b367f4ff2c42453e84201ca",
                 834624);
-
-            subsidy_interval_ = 210000;
             break;
         }
 
         case config::settings::regtest:
         {
-            proof_of_work_limit = 0x207fffff;
+            populate<profiles::regtest>(*this);
             genesis_block = chain::block::factory({
                 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
                 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -216,10 +217,6 @@ settings::settings(config::settings context)
                 0x5c, 0x38, 0x4d, 0xf7, 0xba, 0x0b, 0x8d, 0x57,
                 0x8a, 0x4c, 0x70, 0x2b, 0x6b, 0xf1, 0x1d, 0x5f,
                 0xac, 0x00, 0x00, 0x00, 0x00});
-            bip65_freeze = 1351;
-            bip66_freeze = 1251;
-            bip34_freeze = 0;
-            bip16_activation_time = 0x4f3af580;
             const config::checkpoint genesis_checkpoint(
                 static_cast<chain::block>(genesis_block).hash(), 0);
 
@@ -231,8 +228,6 @@ settings::settings(config::settings context)
             // genesis activation.
             bip9_bit0_active_checkpoint = genesis_checkpoint;
             bip9_bit1_active_checkpoint = genesis_checkpoint;
-
-            subsidy_interval_ = 150;
             break;
         }
 
@@ -19,9 +19,11 @@
 #include <bitcoin/bitcoin/unicode/unicode.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <cwchar>
 #include <iostream>
+#include <locale>
 #include <mutex>
 #include <stdexcept>
 #include <string>
@@ -54,7 +56,7 @@ static std::once_flag io_mutex;
 
 #ifdef WITH_ICU
 
-// Ensure validate_localization is called only once.
+// Ensure initialize_localization is called only once.
 static std::once_flag icu_mutex;
 
 #endif
@@ -85,20 +87,35 @@ std::ostream& cerr_stream()
 
 #ifdef WITH_ICU
 
-// The backend selection is ignored if invalid (in this case on Windows).
+// The normalization locale, generated once as generation is expensive.
+static std::locale normal_locale;
+
 static std::string normal_form(const std::string& value, norm_type form)
 {
-    auto backend = localization_backend_manager::global();
-    backend.select(BC_LOCALE_BACKEND);
-    const generator locale(backend);
-    return normalize(value, form, locale(BC_LOCALE_UTF8));
+    return normalize(value, form, normal_locale);
+}
+
+// ASCII text is invariant under each normalization form.
+static bool is_ascii(const std::string& value)
+{
+    for (const auto character: value)
+        if ((static_cast<uint8_t>(character) & 0x80) != 0)
+            return false;
+
+    return true;
 }
 
-// One time verifier of the localization backend manager. This is
+// One time generator and verifier of the normalization locale. The backend
+// selection is ignored if invalid (in this case on Windows). Verification is
 // necessary because boost::normalize will fail silently to perform
 // normalization if the ICU dependency is missing.
-static void validate_localization()
+static void initialize_localization()
 {
+    auto backend = localization_backend_manager::global();
+    backend.select(BC_LOCALE_BACKEND);
+    const generator locale(backend);
+    normal_locale = locale(BC_LOCALE_UTF8);
+
     const auto ascii_space = "> <";
     const auto ideographic_space = ">　<";
     const auto normal = normal_form(ideographic_space, norm_type::norm_nfkd);
@@ -111,14 +128,20 @@ static void validate_localization()
 // Normalize strings using unicode nfc normalization.
 std::string to_normal_nfc_form(const std::string& value)
 {
-    std::call_once(icu_mutex, validate_localization);
+    if (is_ascii(value))
+        return value;
+
+    std::call_once(icu_mutex, initialize_localization);
     return normal_form(value, norm_type::norm_nfc);
 }
 
 // Normalize strings using unicode nfkd normalization.
 std::string to_normal_nfkd_form(const std::string& value)
 {
-    std::call_once(icu_mutex, validate_localization);
+    if (is_ascii(value))
+        return value;
+
+    std::call_once(icu_mutex, initialize_localization);
     return normal_form(value, norm_type::norm_nfkd);
 }
 
@@ -0,0 +1,697 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/utility/async_file_writer.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <utility>
+#include <boost/filesystem.hpp>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/utility/assert.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
+
+#ifdef _MSC_VER
+    #include <fcntl.h>
+    #include <io.h>
+    #include <malloc.h>
+    #include <sys/stat.h>
+#else
+    #include <fcntl.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+// The kernel queue is driven by system calls, so there is no library
+// dependency, but it requires kernel headers that define io_uring.
+#if defined(__linux__) && defined(__has_include)
+    #if __has_include(<linux/io_uring.h>)
+        #include <linux/io_uring.h>
+        #include <sys/mman.h>
+        #include <sys/syscall.h>
+        #include <sys/uio.h>
+        #if defined(IOSQE_IO_DRAIN) && defined(__NR_io_uring_setup)
+            #define HAVE_IO_URING
+        #endif
+    #endif
+#endif
+
+namespace libbitcoin {
+
+// The page size, which satisfies the logical block size of common devices.
+const size_t aligned_buffer::alignment = 4096;
+
+const size_t async_file_writer::default_depth = 64;
+
+static const int closed = -1;
+
+// aligned_buffer
+// ----------------------------------------------------------------------------
+
+size_t aligned_buffer::align(size_t size)
+{
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+aligned_buffer::aligned_buffer(size_t size)
+  : data_(nullptr), size_(align(size))
+{
+    const auto allocation = std::max(size_, alignment);
+
+#ifdef _MSC_VER
+    data_ = static_cast<uint8_t*>(_aligned_malloc(allocation, alignment));
+#else
+    void* memory = nullptr;
+    if (posix_memalign(&memory, alignment, allocation) == 0)
+        data_ = static_cast<uint8_t*>(memory);
+#endif
+
+    if (data_ == nullptr)
+        throw std::bad_alloc();
+
+    std::memset(data_, 0, allocation);
+}
+
+aligned_buffer::~aligned_buffer()
+{
+#ifdef _MSC_VER
+    _aligned_free(data_);
+#else
+    std::free(data_);
+#endif
+}
+
+uint8_t* aligned_buffer::data()
+{
+    return data_;
+}
+
+const uint8_t* aligned_buffer::data() const
+{
+    return data_;
+}
+
+size_t aligned_buffer::size() const
+{
+    return size_;
+}
+
+// async_file_writer
+// ----------------------------------------------------------------------------
+
+struct async_file_writer::operation
+{
+    bool sync;
+    uint64_t offset;
+    aligned_buffer::ptr buffer;
+    size_t size;
+    handler handle;
+
+#ifdef HAVE_IO_URING
+    // The kernel reads the vector when the write is started.
+    iovec vector;
+#endif
+};
+
+#ifdef HAVE_IO_URING
+
+// The submission and completion rings shared with the kernel.
+struct async_file_writer::ring
+{
+    int descriptor = closed;
+    size_t capacity = 0;
+    size_t in_flight = 0;
+
+    void* submission_map = MAP_FAILED;
+    size_t submission_map_size = 0;
+    void* completion_map = MAP_FAILED;
+    size_t completion_map_size = 0;
+    io_uring_sqe* entries = static_cast<io_uring_sqe*>(MAP_FAILED);
+    size_t entries_size = 0;
+
+    unsigned* submission_head = nullptr;
+    unsigned* submission_tail = nullptr;
+    unsigned* submission_mask = nullptr;
+    unsigned* submission_array = nullptr;
+    unsigned* completion_head = nullptr;
+    unsigned* completion_tail = nullptr;
+    unsigned* completion_mask = nullptr;
+    io_uring_cqe* completions = nullptr;
+};
+
+template <typename Type>
+static Type* offset_of(void* map, uint32_t offset)
+{
+    return reinterpret_cast<Type*>(static_cast<uint8_t*>(map) + offset);
+}
+
+static int setup(unsigned entries, io_uring_params& parameters)
+{
+    return static_cast<int>(syscall(__NR_io_uring_setup, entries,
+        &parameters));
+}
+
+static int enter(int descriptor, unsigned submit, unsigned wait,
+    unsigned flags)
+{
+    return static_cast<int>(syscall(__NR_io_uring_enter, descriptor, submit,
+        wait, flags, nullptr, 0));
+}
+
+#else
+
+struct async_file_writer::ring
+{
+};
+
+#endif
+
+// Map an operating system error number to a code.
+static code to_code(int number)
+{
+    return error::boost_to_error_code(
+        boost_code(number, boost::system::system_category()));
+}
+
+async_file_writer::async_file_writer(threadpool& pool)
+  : async_file_writer(pool, default_depth)
+{
+}
+
+async_file_writer::async_file_writer(threadpool& pool, size_t depth)
+  : pool_(pool),
+    depth_(std::max(depth, size_t(1))),
+    file_(closed),
+    direct_(false),
+    draining_(false),
+    outstanding_(0)
+{
+}
+
+async_file_writer::~async_file_writer()
+{
+    close();
+}
+
+code async_file_writer::open(const path& file, bool direct)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (file_ != closed)
+        return error::operation_failed;
+
+#ifdef _MSC_VER
+    // Direct i/o is not supported by the crt.
+    direct = false;
+    file_ = _wopen(file.wstring().c_str(), _O_WRONLY | _O_CREAT | _O_BINARY,
+        _S_IREAD | _S_IWRITE);
+#else
+    auto flags = O_WRONLY | O_CREAT;
+
+    #ifdef O_CLOEXEC
+    flags |= O_CLOEXEC;
+    #endif
+
+    #ifdef O_DIRECT
+    if (direct)
+        flags |= O_DIRECT;
+    #endif
+
+    file_ = ::open(file.string().c_str(), flags, 0644);
+
+    #if defined(F_NOCACHE) && !defined(O_DIRECT)
+    if (direct && file_ != closed)
+        fcntl(file_, F_NOCACHE, 1);
+    #endif
+#endif
+
+    if (file_ == closed)
+        return to_code(errno);
+
+    direct_ = direct;
+
+    // If the kernel queue is not available operations run on the pool.
+    start_ring();
+    return error::success;
+}
+
+void async_file_writer::write(uint64_t offset, aligned_buffer::ptr buffer,
+    handler handle)
+{
+    const auto size = buffer ? buffer->size() : 0;
+    write(offset, buffer, size, handle);
+}
+
+void async_file_writer::write(uint64_t offset, aligned_buffer::ptr buffer,
+    size_t size, handler handle)
+{
+    enqueue(std::make_shared<operation>(
+        operation{ false, offset, buffer, size, handle }));
+}
+
+void async_file_writer::sync(handler handle)
+{
+    enqueue(std::make_shared<operation>(
+        operation{ true, 0, nullptr, 0, handle }));
+}
+
+void async_file_writer::enqueue(operation_ptr op)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    if (file_ == closed)
+    {
+        lock.unlock();
+        pool_.service().post(std::bind(op->handle, error::operation_failed));
+        return;
+    }
+
+    if (!op->sync)
+    {
+        const auto alignment = aligned_buffer::alignment;
+        const auto invalid = !op->buffer || op->size > op->buffer->size() ||
+            (direct_ && (op->offset % alignment != 0 ||
+                op->size % alignment != 0));
+
+        if (invalid)
+        {
+            lock.unlock();
+            pool_.service().post(std::bind(op->handle,
+                error::operation_failed));
+            return;
+        }
+    }
+
+    queued_.push_back(op);
+}
+
+void async_file_writer::submit()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (queued_.empty())
+        return;
+
+    outstanding_ += queued_.size();
+    pending_.insert(pending_.end(), queued_.begin(), queued_.end());
+    queued_.clear();
+
+    if (ring_)
+        submit_ring();
+    else
+        submit_pool();
+}
+
+code async_file_writer::close()
+{
+    submit();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this]()
+    {
+        return outstanding_ == 0;
+    });
+
+    if (file_ == closed)
+        return error::success;
+
+    stop_ring();
+
+#ifdef _MSC_VER
+    const auto result = _close(file_);
+#else
+    const auto result = ::close(file_);
+#endif
+
+    file_ = closed;
+    return result == 0 ? error::success : to_code(errno);
+}
+
+bool async_file_writer::is_open() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return file_ != closed;
+}
+
+bool async_file_writer::is_kernel_queued() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return static_cast<bool>(ring_);
+}
+
+// Post the handler and release the waiting close once all have completed.
+void async_file_writer::complete(operation_ptr op, const code& ec)
+{
+    pool_.service().post(std::bind(op->handle, ec));
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    BITCOIN_ASSERT(outstanding_ > 0);
+
+    if (--outstanding_ == 0)
+        idle_.notify_all();
+}
+
+// Execute one operation synchronously, short writes are resumed.
+code async_file_writer::execute(int file, const operation& op)
+{
+#ifdef _MSC_VER
+    if (op.sync)
+        return _commit(file) == 0 ? error::success : to_code(errno);
+
+    // Writes are serialized by the pool drain, so seek and write is safe.
+    if (_lseeki64(file, static_cast<__int64>(op.offset), SEEK_SET) < 0)
+        return to_code(errno);
+
+    auto data = op.buffer->data();
+    auto remaining = op.size;
+
+    while (remaining > 0)
+    {
+        const auto chunk = static_cast<unsigned>(std::min(remaining,
+            size_t(0x40000000)));
+        const auto written = _write(file, data, chunk);
+
+        if (written <= 0)
+            return written < 0 ? to_code(errno) : error::operation_failed;
+
+        data += written;
+        remaining -= static_cast<size_t>(written);
+    }
+
+    return error::success;
+#else
+    if (op.sync)
+        return fsync(file) == 0 ? error::success : to_code(errno);
+
+    auto data = op.buffer->data();
+    auto offset = static_cast<off_t>(op.offset);
+    auto remaining = op.size;
+
+    while (remaining > 0)
+    {
+        const auto written = pwrite(file, data, remaining, offset);
+
+        if (written < 0 && errno == EINTR)
+            continue;
+
+        if (written <= 0)
+            return written < 0 ? to_code(errno) : error::operation_failed;
+
+        data += written;
+        offset += written;
+        remaining -= static_cast<size_t>(written);
+    }
+
+    return error::success;
+#endif
+}
+
+// Pool queue.
+// ----------------------------------------------------------------------------
+// Operations run in order on one thread of the pool at a time, which makes
+// each sync a barrier without further coordination.
+
+// private, call under lock.
+void async_file_writer::submit_pool()
+{
+    if (draining_)
+        return;
+
+    draining_ = true;
+    pool_.service().post(std::bind(&async_file_writer::drain_pool, this));
+}
+
+void async_file_writer::drain_pool()
+{
+    while (true)
+    {
+        operation_ptr op;
+        int file;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            if (pending_.empty())
+            {
+                draining_ = false;
+                return;
+            }
+
+            op = pending_.front();
+            pending_.pop_front();
+            file = file_;
+        }
+
+        complete(op, execute(file, *op));
+    }
+}
+
+// Kernel queue.
+// ----------------------------------------------------------------------------
+// Operations are started together by one system call and completions are
+// reaped by a dedicated thread, which posts each handler to the pool. A sync
+// is submitted with the drain flag, which makes it a barrier in the kernel.
+
+#ifdef HAVE_IO_URING
+
+// private, call under lock.
+bool async_file_writer::start_ring()
+{
+    io_uring_params parameters;
+    std::memset(&parameters, 0, sizeof(parameters));
+
+    std::unique_ptr<ring> queue(new ring);
+    queue->descriptor = setup(static_cast<unsigned>(depth_), parameters);
+
+    // The kernel may not support io_uring or it may be disabled by policy.
+    if (queue->descriptor < 0)
+        return false;
+
+    const auto& submission = parameters.sq_off;
+    const auto& completion = parameters.cq_off;
+    const auto descriptor = queue->descriptor;
+    const auto protection = PROT_READ | PROT_WRITE;
+    const auto sharing = MAP_SHARED | MAP_POPULATE;
+
+    queue->submission_map_size = submission.array +
+        parameters.sq_entries * sizeof(unsigned);
+    queue->completion_map_size = completion.cqes +
+        parameters.cq_entries * sizeof(io_uring_cqe);
+    queue->entries_size = parameters.sq_entries * sizeof(io_uring_sqe);
+
+    queue->submission_map = mmap(nullptr, queue->submission_map_size,
+        protection, sharing, descriptor, IORING_OFF_SQ_RING);
+    queue->completion_map = mmap(nullptr, queue->completion_map_size,
+        protection, sharing, descriptor, IORING_OFF_CQ_RING);
+    queue->entries = static_cast<io_uring_sqe*>(mmap(nullptr,
+        queue->entries_size, protection, sharing, descriptor,
+        IORING_OFF_SQES));
+
+    ring_ = std::move(queue);
+
+    if (ring_->submission_map == MAP_FAILED ||
+        ring_->completion_map == MAP_FAILED ||
+        ring_->entries == MAP_FAILED)
+    {
+        stop_ring();
+        return false;
+    }
+
+    const auto sq = ring_->submission_map;
+    const auto cq = ring_->completion_map;
+    ring_->submission_head = offset_of<unsigned>(sq, submission.head);
+    ring_->submission_tail = offset_of<unsigned>(sq, submission.tail);
+    ring_->submission_mask = offset_of<unsigned>(sq, submission.ring_mask);
+    ring_->submission_array = offset_of<unsigned>(sq, submission.array);
+    ring_->completion_head = offset_of<unsigned>(cq, completion.head);
+    ring_->completion_tail = offset_of<unsigned>(cq, completion.tail);
+    ring_->completion_mask = offset_of<unsigned>(cq, completion.ring_mask);
+    ring_->completions = offset_of<io_uring_cqe>(cq, completion.cqes);
+
+    // Limit operations in flight so that completions cannot overflow.
+    ring_->capacity = std::min<size_t>({ depth_, parameters.sq_entries,
+        parameters.cq_entries });
+
+    reaper_ = std::thread(std::bind(&async_file_writer::reap_ring, this));
+    return true;
+}
+
+// private, call under lock (released while joining the reaper).
+void async_file_writer::stop_ring()
+{
+    if (!ring_)
+        return;
+
+    if (reaper_.joinable())
+    {
+        // The reaper exits on the completion of a no-op without user data.
+        const auto tail = *ring_->submission_tail;
+        const auto index = tail & *ring_->submission_mask;
+        auto& entry = ring_->entries[index];
+        std::memset(&entry, 0, sizeof(entry));
+        entry.opcode = IORING_OP_NOP;
+        ring_->submission_array[index] = index;
+        __atomic_store_n(ring_->submission_tail, tail + 1, __ATOMIC_RELEASE);
+        enter(ring_->descriptor, 1, 0, 0);
+        reaper_.join();
+    }
+
+    if (ring_->entries != MAP_FAILED)
+        munmap(ring_->entries, ring_->entries_size);
+
+    if (ring_->completion_map != MAP_FAILED)
+        munmap(ring_->completion_map, ring_->completion_map_size);
+
+    if (ring_->submission_map != MAP_FAILED)
+        munmap(ring_->submission_map, ring_->submission_map_size);
+
+    ::close(ring_->descriptor);
+    ring_.reset();
+}
+
+// private, call under lock.
+void async_file_writer::submit_ring()
+{
+    auto tail = *ring_->submission_tail;
+    const auto mask = *ring_->submission_mask;
+
+    while (!pending_.empty() && ring_->in_flight < ring_->capacity)
+    {
+        // The kernel holds a reference to the operation until completion.
+        const auto op = pending_.front();
+        pending_.pop_front();
+
+        const auto index = tail & mask;
+        auto& entry = ring_->entries[index];
+        std::memset(&entry, 0, sizeof(entry));
+        entry.fd = file_;
+        entry.user_data = reinterpret_cast<uint64_t>(new operation_ptr(op));
+
+        if (op->sync)
+        {
+            entry.opcode = IORING_OP_FSYNC;
+            entry.flags = IOSQE_IO_DRAIN;
+        }
+        else
+        {
+            op->vector.iov_base = op->buffer->data();
+            op->vector.iov_len = op->size;
+            entry.opcode = IORING_OP_WRITEV;
+            entry.addr = reinterpret_cast<uint64_t>(&op->vector);
+            entry.len = 1;
+            entry.off = op->offset;
+        }
+
+        ring_->submission_array[index] = index;
+        ++ring_->in_flight;
+        ++tail;
+    }
+
+    __atomic_store_n(ring_->submission_tail, tail, __ATOMIC_RELEASE);
+
+    // Entries not consumed by a failed or interrupted call are retried by
+    // the next, as they remain between the head and the tail.
+    const auto head = __atomic_load_n(ring_->submission_head,
+        __ATOMIC_ACQUIRE);
+
+    if (tail != head)
+        enter(ring_->descriptor, tail - head, 0, 0);
+}
+
+void async_file_writer::reap_ring()
+{
+    // The ring is not released until this thread is joined.
+    const auto queue = ring_.get();
+    const auto mask = *queue->completion_mask;
+    auto stopped = false;
+
+    while (!stopped)
+    {
+        if (enter(queue->descriptor, 0, 1, IORING_ENTER_GETEVENTS) < 0 &&
+            errno != EINTR && errno != EAGAIN && errno != EBUSY)
+            break;
+
+        auto head = *queue->completion_head;
+        const auto tail = __atomic_load_n(queue->completion_tail,
+            __ATOMIC_ACQUIRE);
+
+        for (; head != tail; ++head)
+        {
+            const auto& completion = queue->completions[head & mask];
+
+            if (completion.user_data == 0)
+            {
+                stopped = true;
+                continue;
+            }
+
+            // The reference was created under the lock.
+            const auto reference = reinterpret_cast<operation_ptr*>(
+                completion.user_data);
+            operation_ptr op;
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                op = *reference;
+                delete reference;
+                --queue->in_flight;
+                submit_ring();
+            }
+
+            const auto result = completion.res;
+            const auto ec = result < 0 ? to_code(-result) :
+                (!op->sync && static_cast<size_t>(result) < op->size ?
+                    error::operation_failed : error::success);
+
+            complete(op, ec);
+        }
+
+        __atomic_store_n(queue->completion_head, head, __ATOMIC_RELEASE);
+    }
+}
+
+#else
+
+bool async_file_writer::start_ring()
+{
+    return false;
+}
+
+void async_file_writer::stop_ring()
+{
+}
+
+void async_file_writer::submit_ring()
+{
+}
+
+void async_file_writer::reap_ring()
+{
+}
+
+#endif
+
+} // namespace libbitcoin
@@ -18,6 +18,9 @@
  */
 #include <bitcoin/bitcoin/utility/binary.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <sstream>
 #include <string>
@@ -28,6 +31,91 @@
 
 namespace libbitcoin {
 
+static BC_CONSTEXPR size_t word_bytes = sizeof(uint64_t);
+static BC_CONSTEXPR size_t word_bits = word_bytes * byte_bits;
+
+// The number of leading zero bits of a nonzero word.
+static size_t leading_zeros(uint64_t value)
+{
+    BITCOIN_ASSERT(value != 0);
+
+#if defined(__GNUC__)
+    return static_cast<size_t>(__builtin_clzll(value));
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return 63u - index;
+#else
+    size_t zeros = 0;
+    for (auto bit = uint64_t(1) << 63; (value & bit) == 0; bit >>= 1)
+        ++zeros;
+
+    return zeros;
+#endif
+}
+
+// The 64 bits from the bit position, with zeros beyond the end of the bytes.
+static uint64_t read_word(data_slice bytes, size_t position)
+{
+    const auto first = position / byte_bits;
+    const auto offset = position % byte_bits;
+    const auto size = bytes.size();
+    const auto data = bytes.data();
+    uint64_t word = 0;
+
+    if (first + word_bytes <= size)
+    {
+        word = from_big_endian_unsafe<uint64_t>(data + first);
+    }
+    else
+    {
+        for (size_t index = 0; index < word_bytes; ++index)
+            word = (word << byte_bits) |
+                (first + index < size ? data[first + index] : 0x00);
+    }
+
+    if (offset == 0)
+        return word;
+
+    const auto next = first + word_bytes;
+    const uint8_t low = next < size ? data[next] : 0x00;
+    return (word << offset) | (low >> (byte_bits - offset));
+}
+
+// The 64 bits that end at the bit position, or with zeros preceding bit 0.
+static uint64_t read_word(data_slice bytes, size_t position, size_t lead)
+{
+    return position < lead ? read_word(bytes, 0) >> (lead - position) :
+        read_word(bytes, position - lead);
+}
+
+// Merge the word into the bytes from the byte offset, truncated at the end.
+static void merge_word(data_chunk& bytes, size_t first, uint64_t word)
+{
+    const auto end = std::min(bytes.size(), first + word_bytes);
+
+    for (auto index = first; index < end; ++index)
+    {
+        bytes[index] |= static_cast<uint8_t>(word >> (word_bits - byte_bits));
+        word <<= byte_bits;
+    }
+}
+
+// The number of leading bits that are the same in each, up to the limit.
+static size_t common_prefix(data_slice left, data_slice right, size_t limit)
+{
+    for (size_t position = 0; position < limit; position += word_bits)
+    {
+        const auto difference = read_word(left, position) ^
+            read_word(right, position);
+
+        if (difference != 0)
+            return std::min(limit, position + leading_zeros(difference));
+    }
+
+    return limit;
+}
+
 binary::size_type binary::blocks_size(size_type bit_size)
 {
     return bit_size == 0 ? 0 : (bit_size - 1) / bits_per_block + 1;
@@ -128,18 +216,17 @@ binary::size_type binary::size() const
 
 void binary::append(const binary& post)
 {
-    const size_type block_offset = size() / bits_per_block;
-    const size_type offset = size() % bits_per_block;
-
-    // overkill for byte alignment
-    binary duplicate(post.size(), post.blocks());
-    duplicate.shift_right(offset);
-    resize(size() + post.size());
-    data_chunk post_shift_blocks = duplicate.blocks();
-
-    for (size_type i = 0; i < post_shift_blocks.size(); i++)
-        blocks_[block_offset + i] = blocks_[block_offset + i] |
-            post_shift_blocks[i];
+    const auto initial_size = size();
+    const auto post_size = post.size();
+    const size_type block_offset = initial_size / bits_per_block;
+    const size_type offset = initial_size % bits_per_block;
+
+    // Bits beyond the size are zero, so the post bits are merged in place.
+    resize(initial_size + post_size);
+
+    for (size_type bit = 0; bit < post_size + offset; bit += word_bits)
+        merge_word(blocks_, block_offset + bit / bits_per_block,
+            read_word(post.blocks_, bit, offset));
 }
 
 void binary::prepend(const binary& prior)
@@ -153,30 +240,18 @@ void binary::prepend(const binary& prior)
 
 void binary::shift_left(size_type distance)
 {
-    const size_type initial_size = size();
-    const size_type initial_block_count = blocks_.size();
-    size_type destination_size = 0;
-
-    if (distance < initial_size)
-        destination_size = initial_size - distance;
+    const auto initial_size = size();
+    const auto destination_size = distance < initial_size ?
+        initial_size - distance : 0;
 
-    const size_type block_offset = distance / bits_per_block;
-    const size_type offset = distance % bits_per_block;
-
-    // shift
-    for (size_type i = 0; i < initial_block_count; i++)
+    // Words are read ahead of where they are written, so this is in place.
+    for (size_type bit = 0; bit < destination_size; bit += word_bits)
     {
-        uint8_t leading_bits = 0x00;
-        uint8_t trailing_bits = 0x00;
-
-        if ((offset != 0) && ((block_offset + i + 1) < initial_block_count))
-            trailing_bits = blocks_[block_offset + i + 1] >>
-                (bits_per_block - offset);
-
-        if ((block_offset + i) < initial_block_count)
-            leading_bits = blocks_[block_offset + i] << offset;
-
-        blocks_[i] = leading_bits | trailing_bits;
+        const auto word = read_word(blocks_, distance + bit);
+        const auto first = bit / bits_per_block;
+        const auto end = std::min(blocks_.size(), first + word_bytes);
+        std::fill(blocks_.begin() + first, blocks_.begin() + end, 0x00);
+        merge_word(blocks_, first, word);
     }
 
     resize(destination_size);
@@ -184,30 +259,19 @@ void binary::shift_left(size_type distance)
 
 void binary::shift_right(size_type distance)
 {
-    const size_type initial_size = size();
-    const size_type initial_block_count = blocks_.size();
+    const auto initial_size = size();
     const size_type offset = distance % bits_per_block;
     const size_type offset_blocks = distance / bits_per_block;
-    const size_type destination_size = initial_size + distance;
-
-    for (size_type i = 0; i < offset_blocks; i++)
-        blocks_.insert(blocks_.begin(), 0x00);
+    const auto destination_size = initial_size + distance;
 
-    uint8_t previous = 0x00;
+    data_chunk shifted(blocks_size(destination_size), 0x00);
 
-    for (size_type i = 0; i < initial_block_count; i++)
-    {
-        uint8_t current = blocks_[offset_blocks + i];
-        uint8_t leading_bits = previous << (bits_per_block - offset);
-        uint8_t trailing_bits = current >> offset;
-        blocks_[offset_blocks + i] = leading_bits | trailing_bits;
-        previous = current;
-    }
+    for (size_type bit = 0; bit < initial_size + offset; bit += word_bits)
+        merge_word(shifted, offset_blocks + bit / bits_per_block,
+            read_word(blocks_, bit, offset));
 
+    blocks_.swap(shifted);
     resize(destination_size);
-
-    if (offset_blocks + initial_block_count < blocks_.size())
-        blocks_[blocks_.size() - 1] = previous << (bits_per_block - offset);
 }
 
 binary binary::substring(size_type start, size_type length) const
@@ -220,8 +284,13 @@ binary binary::substring(size_type start, size_type length) const
     if ((length == max_size_t) || ((start + length) > current_size))
         length = current_size - start;
 
-    binary result(current_size, blocks_);
-    result.shift_left(start);
+    binary result;
+    result.blocks_.resize(blocks_size(length), 0x00);
+
+    for (size_type bit = 0; bit < length; bit += word_bits)
+        merge_word(result.blocks_, bit / bits_per_block,
+            read_word(blocks_, start + bit));
+
     result.resize(length);
     return result;
 }
@@ -236,29 +305,34 @@ bool binary::is_prefix_of(const binary& field) const
     return is_prefix_of(field.blocks());
 }
 
+// The field is zero padded to the prefix size, as binary(size(), field).
 bool binary::is_prefix_of(data_slice field) const
 {
-    const binary truncated_prefix(size(), field);
-    return *this == truncated_prefix;
+    const auto bits = size();
+
+    if (field.empty())
+        return bits == 0;
+
+    return common_prefix(blocks_, field, bits) == bits;
 }
 
+// Ordered as the encoded strings, a prefix preceding what it prefixes.
 bool binary::operator<(const binary& other) const
 {
-    return encoded() < other.encoded();
+    const auto bits = std::min(size(), other.size());
+    const auto common = common_prefix(blocks_, other.blocks_, bits);
+
+    if (common < bits)
+        return other[common];
+
+    return size() < other.size();
 }
 
 bool binary::operator==(const binary& other) const
 {
-    if (size() != other.size())
-        return false;
-
-    const auto self = *this;
-
-    for (binary::size_type i = 0; i < size(); ++i)
-        if (self[i] != other[i])
-            return false;
-
-    return true;
+    const auto bits = size();
+    return bits == other.size() &&
+        common_prefix(blocks_, other.blocks_, bits) == bits;
 }
 
 bool binary::operator!=(const binary& other) const
@@ -0,0 +1,263 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/utility/binary_set.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/utility/assert.hpp>
+#include <bitcoin/bitcoin/utility/binary.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/endian.hpp>
+
+namespace libbitcoin {
+
+static BC_CONSTEXPR size_t word_bytes = sizeof(uint64_t);
+static BC_CONSTEXPR size_t word_bits = word_bytes * byte_bits;
+
+static size_t popcount(uint64_t value)
+{
+#if defined(__GNUC__)
+    return static_cast<size_t>(__builtin_popcountll(value));
+#else
+    value -= (value >> 1) & 0x5555555555555555;
+    value = (value & 0x3333333333333333) + ((value >> 2) & 0x3333333333333333);
+    value = (value + (value >> 4)) & 0x0f0f0f0f0f0f0f0f;
+    return static_cast<size_t>((value * 0x0101010101010101) >> 56);
+#endif
+}
+
+// The number of trailing zero bits of a nonzero word.
+static size_t trailing_zeros(uint64_t value)
+{
+    BITCOIN_ASSERT(value != 0);
+
+#if defined(__GNUC__)
+    return static_cast<size_t>(__builtin_ctzll(value));
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanForward64(&index, value);
+    return index;
+#else
+    size_t zeros = 0;
+    for (uint64_t bit = 1; (value & bit) == 0; bit <<= 1)
+        ++zeros;
+
+    return zeros;
+#endif
+}
+
+// A word with the given number of leading (high) bits set.
+static uint64_t leading_mask(size_t bits)
+{
+    return bits == 0 ? 0 : bits >= word_bits ? max_uint64 :
+        max_uint64 << (word_bits - bits);
+}
+
+// A word with the given number of trailing (low) bits set.
+static uint64_t trailing_mask(size_t bits)
+{
+    return bits >= word_bits ? max_uint64 : (uint64_t(1) << bits) - 1;
+}
+
+// The big endian word of the bytes at the word index, zero padded.
+static uint64_t read_word(data_slice bytes, size_t word)
+{
+    uint64_t value = 0;
+    const auto first = word * word_bytes;
+
+    for (auto index = first; index < first + word_bytes; ++index)
+        value = (value << byte_bits) |
+            (index < bytes.size() ? bytes.data()[index] : 0x00);
+
+    return value;
+}
+
+binary_set::binary_set(size_type bits)
+  : bits_(bits), stride_((bits + word_bits - 1) / word_bits), size_(0)
+{
+}
+
+binary_set::size_type binary_set::bits() const
+{
+    return bits_;
+}
+
+binary_set::size_type binary_set::size() const
+{
+    return size_;
+}
+
+bool binary_set::empty() const
+{
+    return size_ == 0;
+}
+
+void binary_set::reserve(size_type count)
+{
+    words_.reserve(count * stride_);
+}
+
+void binary_set::clear()
+{
+    words_.clear();
+    size_ = 0;
+}
+
+void binary_set::push_back(data_slice record)
+{
+    for (size_type word = 0; word < stride_; ++word)
+        words_.push_back(read_word(record, word) &
+            leading_mask(bits_ - word * word_bits));
+
+    ++size_;
+}
+
+void binary_set::push_back(uint32_t field)
+{
+    push_back(to_little_endian(field));
+}
+
+binary binary_set::operator[](size_type index) const
+{
+    BITCOIN_ASSERT(index < size_);
+    data_chunk blocks;
+    blocks.reserve(stride_ * word_bytes);
+    const auto record = words_.begin() + index * stride_;
+
+    for (auto word = record; word != record + stride_; ++word)
+        extend_data(blocks, to_big_endian(*word));
+
+    return binary(bits_, blocks);
+}
+
+bool binary_set::is_prefix(const binary& prefix, size_type index) const
+{
+    BITCOIN_ASSERT(index < size_);
+    return is_match(to_filter(prefix), index);
+}
+
+binary_set::size_type binary_set::count(const binary& prefix) const
+{
+    size_type total = 0;
+
+    const auto visit = [&total](size_type, uint64_t matches)
+    {
+        total += popcount(matches);
+    };
+
+    scan(to_filter(prefix), visit);
+    return total;
+}
+
+binary_set::index_list binary_set::match(const binary& prefix) const
+{
+    index_list out;
+
+    const auto visit = [&out](size_type base, uint64_t matches)
+    {
+        for (; matches != 0; matches &= matches - 1)
+            out.push_back(base + trailing_zeros(matches));
+    };
+
+    scan(to_filter(prefix), visit);
+    return out;
+}
+
+// private
+//-----------------------------------------------------------------------------
+
+binary_set::filter binary_set::to_filter(const binary& prefix) const
+{
+    filter out{ {}, {}, false };
+    const auto bits = std::min(prefix.size(), bits_);
+
+    // Prefix bits beyond the record width compare to the zero padding.
+    if (prefix.size() > bits_)
+    {
+        const auto excess = prefix.substring(bits_);
+        const auto& blocks = excess.blocks();
+        out.none = std::any_of(blocks.begin(), blocks.end(),
+            [](uint8_t block) { return block != 0x00; });
+    }
+
+    for (size_type word = 0; word * word_bits < bits; ++word)
+    {
+        const auto mask = leading_mask(bits - word * word_bits);
+        out.masks.push_back(mask);
+        out.values.push_back(read_word(prefix.blocks(), word) & mask);
+    }
+
+    return out;
+}
+
+bool binary_set::is_match(const filter& filter, size_type index) const
+{
+    if (filter.none)
+        return false;
+
+    const auto record = words_.begin() + index * stride_;
+
+    for (size_type word = 0; word < filter.masks.size(); ++word)
+        if ((record[word] & filter.masks[word]) != filter.values[word])
+            return false;
+
+    return true;
+}
+
+// Visit each run of up to 64 records with the bitmap of those that match.
+template <typename Visitor>
+void binary_set::scan(const filter& filter, Visitor visitor) const
+{
+    if (filter.none)
+        return;
+
+    for (size_type base = 0; base < size_; base += word_bits)
+    {
+        const auto end = std::min(size_, base + word_bits);
+        uint64_t matches = 0;
+
+        if (filter.masks.empty())
+        {
+            matches = trailing_mask(end - base);
+        }
+        else if (filter.masks.size() == 1)
+        {
+            // The common case, a prefix of up to 64 bits, is branchless.
+            const auto mask = filter.masks.front();
+            const auto value = filter.values.front();
+            auto record = words_.data() + base * stride_;
+
+            for (auto index = base; index < end; ++index, record += stride_)
+                matches |= uint64_t((*record & mask) == value) <<
+                    (index - base);
+        }
+        else
+        {
+            for (auto index = base; index < end; ++index)
+                matches |= uint64_t(is_match(filter, index)) << (index - base);
+        }
+
+        if (matches != 0)
+            visitor(base, matches);
+    }
+}
+
+} // namespace libbitcoin
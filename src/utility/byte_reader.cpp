@@ -0,0 +1,290 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/endian.hpp>
+
+namespace libbitcoin {
+
+byte_reader::byte_reader(const data_slice data)
+  : position_(data.begin()), end_(data.end()), valid_(true)
+{
+}
+
+size_t byte_reader::remaining() const
+{
+    return static_cast<size_t>(end_ - position_);
+}
+
+// Context.
+//-----------------------------------------------------------------------------
+
+byte_reader::operator bool() const
+{
+    return valid_;
+}
+
+bool byte_reader::operator!() const
+{
+    return !valid_;
+}
+
+bool byte_reader::is_exhausted() const
+{
+    return !valid_ || position_ == end_;
+}
+
+void byte_reader::invalidate()
+{
+    valid_ = false;
+}
+
+// Hashes.
+//-----------------------------------------------------------------------------
+
+hash_digest byte_reader::read_hash()
+{
+    return read_forward<hash_size>();
+}
+
+short_hash byte_reader::read_short_hash()
+{
+    return read_forward<short_hash_size>();
+}
+
+mini_hash byte_reader::read_mini_hash()
+{
+    return read_forward<mini_hash_size>();
+}
+
+// Big Endian Integers.
+//-----------------------------------------------------------------------------
+
+uint16_t byte_reader::read_2_bytes_big_endian()
+{
+    return read_big_endian<uint16_t>();
+}
+
+uint32_t byte_reader::read_4_bytes_big_endian()
+{
+    return read_big_endian<uint32_t>();
+}
+
+uint64_t byte_reader::read_8_bytes_big_endian()
+{
+    return read_big_endian<uint64_t>();
+}
+
+uint64_t byte_reader::read_variable_big_endian()
+{
+    const auto value = read_byte();
+
+    switch (value)
+    {
+        case varint_eight_bytes:
+            return read_8_bytes_big_endian();
+        case varint_four_bytes:
+            return read_4_bytes_big_endian();
+        case varint_two_bytes:
+            return read_2_bytes_big_endian();
+        default:
+            return value;
+    }
+}
+
+size_t byte_reader::read_size_big_endian()
+{
+    const auto size = read_variable_big_endian();
+
+    // This facilitates safely passing the size into a follow-on reader.
+    // Return zero allows follow-on use before testing reader state.
+    if (size <= max_size_t)
+        return static_cast<size_t>(size);
+
+    invalidate();
+    return 0;
+}
+
+// Little Endian Integers.
+//-----------------------------------------------------------------------------
+
+code byte_reader::read_error_code()
+{
+    const auto value = read_little_endian<uint32_t>();
+    return code(static_cast<error::error_code_t>(value));
+}
+
+uint16_t byte_reader::read_2_bytes_little_endian()
+{
+    return read_little_endian<uint16_t>();
+}
+
+uint32_t byte_reader::read_4_bytes_little_endian()
+{
+    return read_little_endian<uint32_t>();
+}
+
+uint64_t byte_reader::read_8_bytes_little_endian()
+{
+    return read_little_endian<uint64_t>();
+}
+
+// With the widest form in bounds the value is one load, truncated to width.
+uint64_t byte_reader::read_variable_little_endian()
+{
+    if (valid_ && remaining() > sizeof(uint64_t))
+    {
+        const auto prefix = *position_++;
+
+        if (prefix < varint_two_bytes)
+            return prefix;
+
+        const auto value = load_little_endian<uint64_t>(position_);
+        const auto size = size_t(2) << (prefix - varint_two_bytes);
+        position_ += size;
+
+        return size == sizeof(uint64_t) ? value :
+            value & ((uint64_t(1) << (size * byte_bits)) - 1);
+    }
+
+    const auto value = read_byte();
+
+    switch (value)
+    {
+        case varint_eight_bytes:
+            return read_8_bytes_little_endian();
+        case varint_four_bytes:
+            return read_4_bytes_little_endian();
+        case varint_two_bytes:
+            return read_2_bytes_little_endian();
+        default:
+            return value;
+    }
+}
+
+size_t byte_reader::read_size_little_endian()
+{
+    const auto size = read_variable_little_endian();
+
+    // This facilitates safely passing the size into a follow-on reader.
+    // Return zero allows follow-on use before testing reader state.
+    if (size <= max_size_t)
+        return static_cast<size_t>(size);
+
+    invalidate();
+    return 0;
+}
+
+uint64_t byte_reader::read_variable_base128()
+{
+    uint64_t value = 0;
+
+    // Each continued group is stored less one, so each value has one form.
+    while (true)
+    {
+        const auto byte = read_byte();
+
+        if (value > (max_uint64 >> 7))
+        {
+            invalidate();
+            return 0;
+        }
+
+        value = (value << 7) | (byte & 0x7f);
+
+        if ((byte & 0x80) == 0)
+            return value;
+
+        if (value == max_uint64)
+        {
+            invalidate();
+            return 0;
+        }
+
+        ++value;
+    }
+}
+
+// Bytes.
+//-----------------------------------------------------------------------------
+
+// Consistent with istream peek, the end is not an error until read.
+uint8_t byte_reader::peek_byte()
+{
+    return valid_ && position_ != end_ ? *position_ : 0;
+}
+
+uint8_t byte_reader::read_byte()
+{
+    const auto start = consume(1);
+    return start == nullptr ? 0 : *start;
+}
+
+data_chunk byte_reader::read_bytes()
+{
+    return read_bytes(remaining());
+}
+
+data_chunk byte_reader::read_bytes(size_t size)
+{
+    const auto start = consume(size);
+    return start == nullptr ? data_chunk{} : data_chunk(start, start + size);
+}
+
+void byte_reader::read_bytes(data_chunk& out, size_t size)
+{
+    const auto start = consume(size);
+
+    if (start == nullptr)
+        out.clear();
+    else
+        out.assign(start, start + size);
+}
+
+std::string byte_reader::read_string()
+{
+    return read_string(read_size_little_endian());
+}
+
+// Removes trailing zeros, required for bitcoin string comparisons.
+// Consistent with istream_reader, a string truncated by the end is valid.
+std::string byte_reader::read_string(size_t size)
+{
+    if (!valid_)
+        return {};
+
+    const auto start = consume(std::min(size, remaining()));
+    const auto end = std::find(start, position_, string_terminator);
+    return std::string(start, end);
+}
+
+void byte_reader::skip(size_t size)
+{
+    consume(size);
+}
+
+} // namespace libbitcoin
@@ -0,0 +1,229 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/endian.hpp>
+
+namespace libbitcoin {
+
+byte_writer::byte_writer(data_chunk& sink)
+  : sink_(sink)
+{
+}
+
+// Context.
+//-----------------------------------------------------------------------------
+
+// Appending to a chunk cannot fail (other than by allocation exception).
+byte_writer::operator bool() const
+{
+    return true;
+}
+
+bool byte_writer::operator!() const
+{
+    return false;
+}
+
+// Hashes.
+//-----------------------------------------------------------------------------
+
+void byte_writer::write_hash(const hash_digest& value)
+{
+    sink_.insert(sink_.end(), value.begin(), value.end());
+}
+
+void byte_writer::write_short_hash(const short_hash& value)
+{
+    sink_.insert(sink_.end(), value.begin(), value.end());
+}
+
+void byte_writer::write_mini_hash(const mini_hash& value)
+{
+    sink_.insert(sink_.end(), value.begin(), value.end());
+}
+
+// Big Endian Integers.
+//-----------------------------------------------------------------------------
+
+void byte_writer::write_2_bytes_big_endian(uint16_t value)
+{
+    write_big_endian<uint16_t>(value);
+}
+
+void byte_writer::write_4_bytes_big_endian(uint32_t value)
+{
+    write_big_endian<uint32_t>(value);
+}
+
+void byte_writer::write_8_bytes_big_endian(uint64_t value)
+{
+    write_big_endian<uint64_t>(value);
+}
+
+void byte_writer::write_variable_big_endian(uint64_t value)
+{
+    if (value < varint_two_bytes)
+    {
+        write_byte(static_cast<uint8_t>(value));
+    }
+    else if (value <= max_uint16)
+    {
+        write_byte(varint_two_bytes);
+        write_2_bytes_big_endian(static_cast<uint16_t>(value));
+    }
+    else if (value <= max_uint32)
+    {
+        write_byte(varint_four_bytes);
+        write_4_bytes_big_endian(static_cast<uint32_t>(value));
+    }
+    else
+    {
+        write_byte(varint_eight_bytes);
+        write_8_bytes_big_endian(value);
+    }
+}
+
+void byte_writer::write_size_big_endian(size_t value)
+{
+    write_variable_big_endian(value);
+}
+
+// Little Endian Integers.
+//-----------------------------------------------------------------------------
+
+void byte_writer::write_error_code(const code& ec)
+{
+    write_4_bytes_little_endian(static_cast<uint32_t>(ec.value()));
+}
+
+void byte_writer::write_2_bytes_little_endian(uint16_t value)
+{
+    write_little_endian<uint16_t>(value);
+}
+
+void byte_writer::write_4_bytes_little_endian(uint32_t value)
+{
+    write_little_endian<uint32_t>(value);
+}
+
+void byte_writer::write_8_bytes_little_endian(uint64_t value)
+{
+    write_little_endian<uint64_t>(value);
+}
+
+void byte_writer::write_variable_little_endian(uint64_t value)
+{
+    if (value < varint_two_bytes)
+    {
+        write_byte(static_cast<uint8_t>(value));
+        return;
+    }
+
+    // The prefix and value are written as one, the value stored in full and
+    // then truncated to its width (its low order bytes).
+    uint8_t buffer[sizeof(uint8_t) + sizeof(uint64_t)];
+    size_t size;
+
+    if (value <= max_uint16)
+    {
+        buffer[0] = varint_two_bytes;
+        size = sizeof(uint16_t);
+    }
+    else if (value <= max_uint32)
+    {
+        buffer[0] = varint_four_bytes;
+        size = sizeof(uint32_t);
+    }
+    else
+    {
+        buffer[0] = varint_eight_bytes;
+        size = sizeof(uint64_t);
+    }
+
+    store_little_endian(&buffer[1], value);
+    write_bytes(buffer, sizeof(uint8_t) + size);
+}
+
+void byte_writer::write_size_little_endian(size_t value)
+{
+    write_variable_little_endian(value);
+}
+
+void byte_writer::write_variable_base128(uint64_t value)
+{
+    uint8_t buffer[10];
+    auto position = sizeof(buffer);
+    buffer[--position] = value & 0x7f;
+
+    // Each continued group is stored less one, so each value has one form.
+    while (value > 0x7f)
+    {
+        value = (value >> 7) - 1;
+        buffer[--position] = (value & 0x7f) | 0x80;
+    }
+
+    write_bytes(&buffer[position], sizeof(buffer) - position);
+}
+
+// Bytes.
+//-----------------------------------------------------------------------------
+
+void byte_writer::write_byte(uint8_t value)
+{
+    sink_.push_back(value);
+}
+
+void byte_writer::write_bytes(const data_slice data)
+{
+    sink_.insert(sink_.end(), data.begin(), data.end());
+}
+
+void byte_writer::write_bytes(const uint8_t* data, size_t size)
+{
+    sink_.insert(sink_.end(), data, data + size);
+}
+
+void byte_writer::write_string(const std::string& value)
+{
+    write_variable_little_endian(value.size());
+    sink_.insert(sink_.end(), value.begin(), value.end());
+}
+
+void byte_writer::write_string(const std::string& value, size_t size)
+{
+    const auto length = std::min(size, value.size());
+    sink_.insert(sink_.end(), value.begin(), value.begin() + length);
+    sink_.insert(sink_.end(), size - length, string_terminator);
+}
+
+void byte_writer::skip(size_t size)
+{
+    sink_.insert(sink_.end(), size, 0x00);
+}
+
+} // namespace libbitcoin
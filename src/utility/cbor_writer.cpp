@@ -0,0 +1,127 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/utility/cbor_writer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/endian.hpp>
+
+namespace libbitcoin {
+
+// Major types.
+static constexpr uint8_t major_unsigned = 0;
+static constexpr uint8_t major_text = 3;
+static constexpr uint8_t major_array = 4;
+static constexpr uint8_t major_map = 5;
+
+// Additional information.
+static constexpr uint8_t indefinite = 31;
+static constexpr uint8_t break_code = 0xff;
+
+cbor_writer::cbor_writer(data_chunk& sink)
+  : sink_(sink)
+{
+}
+
+// Containers.
+//-----------------------------------------------------------------------------
+
+void cbor_writer::begin_object()
+{
+    sink_.push_back((major_map << 5) | indefinite);
+}
+
+void cbor_writer::end_object()
+{
+    sink_.push_back(break_code);
+}
+
+void cbor_writer::begin_array()
+{
+    sink_.push_back((major_array << 5) | indefinite);
+}
+
+void cbor_writer::end_array()
+{
+    sink_.push_back(break_code);
+}
+
+// Members and values.
+//-----------------------------------------------------------------------------
+
+void cbor_writer::write_key(const char* key)
+{
+    write_text(key, std::strlen(key));
+}
+
+void cbor_writer::write_value(const std::string& value)
+{
+    write_text(value.data(), value.size());
+}
+
+void cbor_writer::write_value(uint64_t value)
+{
+    write_head(major_unsigned, value);
+}
+
+// private
+//-----------------------------------------------------------------------------
+
+// The argument is encoded in the fewest bytes, big endian.
+void cbor_writer::write_head(uint8_t major, uint64_t value)
+{
+    const uint8_t type = major << 5;
+
+    if (value < 24)
+    {
+        sink_.push_back(type | static_cast<uint8_t>(value));
+    }
+    else if (value <= max_uint8)
+    {
+        sink_.push_back(type | 24);
+        sink_.push_back(static_cast<uint8_t>(value));
+    }
+    else if (value <= max_uint16)
+    {
+        sink_.push_back(type | 25);
+        extend_data(sink_, to_big_endian(static_cast<uint16_t>(value)));
+    }
+    else if (value <= max_uint32)
+    {
+        sink_.push_back(type | 26);
+        extend_data(sink_, to_big_endian(static_cast<uint32_t>(value)));
+    }
+    else
+    {
+        sink_.push_back(type | 27);
+        extend_data(sink_, to_big_endian(value));
+    }
+}
+
+void cbor_writer::write_text(const char* text, size_t size)
+{
+    write_head(major_text, size);
+    sink_.insert(sink_.end(), text, text + size);
+}
+
+} // namespace libbitcoin
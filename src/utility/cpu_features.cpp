@@ -0,0 +1,109 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/utility/cpu_features.hpp>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include "../math/external/aes256.h"
+#include "../math/external/cpu_features.h"
+#include "../math/external/gf2_32.h"
+#include "../math/external/scrypt_pow.h"
+#include "../math/external/sha256.h"
+#include "../math/external/sha512.h"
+#include "../math/external/sha512_avx2.h"
+
+namespace libbitcoin {
+
+static_assert(sse2_feature == CPU_FEATURE_SSE2 &&
+    ssse3_feature == CPU_FEATURE_SSSE3 &&
+    sse41_feature == CPU_FEATURE_SSE41 &&
+    avx2_feature == CPU_FEATURE_AVX2 &&
+    sha_ni_feature == CPU_FEATURE_SHA_NI &&
+    aes_ni_feature == CPU_FEATURE_AES_NI &&
+    clmul_feature == CPU_FEATURE_CLMUL &&
+    arm_sha2_feature == CPU_FEATURE_ARM_SHA2 &&
+    arm_sha512_feature == CPU_FEATURE_ARM_SHA512 &&
+    arm_aes_feature == CPU_FEATURE_ARM_AES, "cpu feature mismatch");
+
+uint32_t cpu_features_detected()
+{
+    return CPUFeaturesDetected();
+}
+
+uint32_t cpu_features()
+{
+    return CPUFeatures();
+}
+
+void set_cpu_features(uint32_t mask)
+{
+    CPUFeaturesEnable(mask);
+}
+
+std::string cpu_kernels()
+{
+    static const struct
+    {
+        uint32_t feature;
+        const char* name;
+    } names[] =
+    {
+        { sse2_feature, "sse2" },
+        { ssse3_feature, "ssse3" },
+        { sse41_feature, "sse41" },
+        { avx2_feature, "avx2" },
+        { sha_ni_feature, "sha_ni" },
+        { aes_ni_feature, "aes_ni" },
+        { clmul_feature, "clmul" },
+        { arm_sha2_feature, "arm_sha2" },
+        { arm_sha512_feature, "arm_sha512" },
+        { arm_aes_feature, "arm_aes" }
+    };
+
+    const auto features = cpu_features();
+    std::ostringstream out;
+    auto separator = "=";
+    out << "features";
+
+    for (const auto& entry: names)
+    {
+        if ((features & entry.feature) != 0)
+        {
+            out << separator << entry.name;
+            separator = ",";
+        }
+    }
+
+    if (features == 0)
+        out << "=none";
+
+    // The lanes of sha512 serve hmac-sha512 and pbkdf2 batches.
+    out << " sha256=" << SHA256Kernel();
+    out << " sha512=" << SHA512Kernel();
+#ifdef SHA512_X86
+    out << (SHA512Avx2Supported() ? "+avx2" : "");
+#endif
+    out << " aes256=" << aes256_kernel();
+    out << " scrypt=" << ScryptPowKernel();
+    out << " gf2_32=" << gf2_32_kernel();
+    return out.str();
+}
+
+} // namespace libbitcoin
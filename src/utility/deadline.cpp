@@ -45,6 +45,15 @@ deadline::deadline(threadpool& pool, const asio::duration duration)
 {
 }
 
+deadline::deadline(threadpool& pool, timer_wheel& wheel,
+    const asio::duration duration)
+  : duration_(duration),
+    timer_(pool.service()),
+    entry_(wheel.create())
+    /*, CONSTRUCT_TRACK(deadline)*/
+{
+}
+
 void deadline::start(handler handle)
 {
     start(handle, duration_);
@@ -52,6 +61,18 @@ void deadline::start(handler handle)
 
 void deadline::start(handler handle, const asio::duration duration)
 {
+    // The wheel is internally synchronized, the closure retains this.
+    if (entry_)
+    {
+        auto self = shared_from_this();
+        entry_->wheel().arm(*entry_, [self, handle](const code& ec)
+        {
+            handle(ec);
+        }, duration);
+
+        return;
+    }
+
     const auto timer_handler =
         std::bind(&deadline::handle_timer,
             shared_from_this(), _1, handle);
@@ -75,6 +96,12 @@ void deadline::start(handler handle, const asio::duration duration)
 // in the case of a race in which the timer is already canceled.
 void deadline::stop()
 {
+    if (entry_)
+    {
+        entry_->wheel().cancel(*entry_);
+        return;
+    }
+
     // Critical Section
     ///////////////////////////////////////////////////////////////////////////
     unique_lock lock(mutex_);
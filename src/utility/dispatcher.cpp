@@ -22,6 +22,7 @@
 #include <string>
 #include <bitcoin/bitcoin/utility/threadpool.hpp>
 #include <bitcoin/bitcoin/utility/work.hpp>
+#include <bitcoin/bitcoin/utility/work_stealing_pool.hpp>
 
 namespace libbitcoin {
 
@@ -30,24 +31,55 @@ dispatcher::dispatcher(threadpool& pool, const std::string& name)
 {
 }
 
-////size_t dispatcher::ordered_backlog()
-////{
-////    return heap_->ordered_backlog();
-////}
-////
-////size_t dispatcher::unordered_backlog()
-////{
-////    return heap_->unordered_backlog();
-////}
-////
-////size_t dispatcher::concurrent_backlog()
-////{
-////    return heap_->concurrent_backlog();
-////}
-////
-////size_t dispatcher::combined_backlog()
-////{
-////    return heap_->combined_backlog();
-////}
+dispatcher::dispatcher(threadpool& pool, work_stealing_pool& executor,
+    const std::string& name)
+  : heap_(std::make_shared<work>(pool, executor, name)), pool_(pool)
+{
+}
+
+size_t dispatcher::ordered_backlog() const
+{
+    return heap_->ordered_backlog();
+}
+
+size_t dispatcher::unordered_backlog() const
+{
+    return heap_->unordered_backlog();
+}
+
+size_t dispatcher::concurrent_backlog() const
+{
+    return heap_->concurrent_backlog();
+}
+
+size_t dispatcher::sequential_backlog() const
+{
+    return heap_->sequential_backlog();
+}
+
+size_t dispatcher::keyed_backlog() const
+{
+    return heap_->keyed_backlog();
+}
+
+size_t dispatcher::combined_backlog() const
+{
+    return heap_->combined_backlog();
+}
+
+size_t dispatcher::shards() const
+{
+    return heap_->shards();
+}
+
+size_t dispatcher::keyed_backlog(size_t shard) const
+{
+    return heap_->keyed_backlog(shard);
+}
+
+void dispatcher::publish(const std::string& prefix) const
+{
+    heap_->publish(prefix);
+}
 
 } // namespace libbitcoin
@@ -0,0 +1,222 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/utility/hash_writer.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+
+namespace libbitcoin {
+
+// Zeros are hashed in blocks of this size by skip and string padding.
+static const byte_array<64> zeros{};
+
+// Context.
+//-----------------------------------------------------------------------------
+
+// Hashing cannot fail.
+hash_writer::operator bool() const
+{
+    return true;
+}
+
+bool hash_writer::operator!() const
+{
+    return false;
+}
+
+// Hashes.
+//-----------------------------------------------------------------------------
+
+void hash_writer::write_hash(const hash_digest& value)
+{
+    update(value.data(), value.size());
+}
+
+void hash_writer::write_short_hash(const short_hash& value)
+{
+    update(value.data(), value.size());
+}
+
+void hash_writer::write_mini_hash(const mini_hash& value)
+{
+    update(value.data(), value.size());
+}
+
+// Big Endian Integers.
+//-----------------------------------------------------------------------------
+
+void hash_writer::write_2_bytes_big_endian(uint16_t value)
+{
+    write_big_endian<uint16_t>(value);
+}
+
+void hash_writer::write_4_bytes_big_endian(uint32_t value)
+{
+    write_big_endian<uint32_t>(value);
+}
+
+void hash_writer::write_8_bytes_big_endian(uint64_t value)
+{
+    write_big_endian<uint64_t>(value);
+}
+
+void hash_writer::write_variable_big_endian(uint64_t value)
+{
+    if (value < varint_two_bytes)
+    {
+        write_byte(static_cast<uint8_t>(value));
+    }
+    else if (value <= max_uint16)
+    {
+        write_byte(varint_two_bytes);
+        write_2_bytes_big_endian(static_cast<uint16_t>(value));
+    }
+    else if (value <= max_uint32)
+    {
+        write_byte(varint_four_bytes);
+        write_4_bytes_big_endian(static_cast<uint32_t>(value));
+    }
+    else
+    {
+        write_byte(varint_eight_bytes);
+        write_8_bytes_big_endian(value);
+    }
+}
+
+void hash_writer::write_size_big_endian(size_t value)
+{
+    write_variable_big_endian(value);
+}
+
+// Little Endian Integers.
+//-----------------------------------------------------------------------------
+
+void hash_writer::write_error_code(const code& ec)
+{
+    write_4_bytes_little_endian(static_cast<uint32_t>(ec.value()));
+}
+
+void hash_writer::write_2_bytes_little_endian(uint16_t value)
+{
+    write_little_endian<uint16_t>(value);
+}
+
+void hash_writer::write_4_bytes_little_endian(uint32_t value)
+{
+    write_little_endian<uint32_t>(value);
+}
+
+void hash_writer::write_8_bytes_little_endian(uint64_t value)
+{
+    write_little_endian<uint64_t>(value);
+}
+
+void hash_writer::write_variable_little_endian(uint64_t value)
+{
+    if (value < varint_two_bytes)
+    {
+        write_byte(static_cast<uint8_t>(value));
+    }
+    else if (value <= max_uint16)
+    {
+        write_byte(varint_two_bytes);
+        write_2_bytes_little_endian(static_cast<uint16_t>(value));
+    }
+    else if (value <= max_uint32)
+    {
+        write_byte(varint_four_bytes);
+        write_4_bytes_little_endian(static_cast<uint32_t>(value));
+    }
+    else
+    {
+        write_byte(varint_eight_bytes);
+        write_8_bytes_little_endian(value);
+    }
+}
+
+void hash_writer::write_size_little_endian(size_t value)
+{
+    write_variable_little_endian(value);
+}
+
+void hash_writer::write_variable_base128(uint64_t value)
+{
+    uint8_t buffer[10];
+    auto position = sizeof(buffer);
+    buffer[--position] = value & 0x7f;
+
+    // Each continued group is stored less one, so each value has one form.
+    while (value > 0x7f)
+    {
+        value = (value >> 7) - 1;
+        buffer[--position] = (value & 0x7f) | 0x80;
+    }
+
+    write_bytes(&buffer[position], sizeof(buffer) - position);
+}
+
+// Bytes.
+//-----------------------------------------------------------------------------
+
+void hash_writer::write_byte(uint8_t value)
+{
+    update(&value, sizeof(value));
+}
+
+void hash_writer::write_bytes(const data_slice data)
+{
+    update(data.data(), data.size());
+}
+
+void hash_writer::write_bytes(const uint8_t* data, size_t size)
+{
+    update(data, size);
+}
+
+void hash_writer::write_string(const std::string& value)
+{
+    write_variable_little_endian(value.size());
+    write_bytes(reinterpret_cast<const uint8_t*>(value.data()),
+        value.size());
+}
+
+void hash_writer::write_string(const std::string& value, size_t size)
+{
+    const auto length = std::min(size, value.size());
+    write_bytes(reinterpret_cast<const uint8_t*>(value.data()), length);
+    skip(size - length);
+}
+
+void hash_writer::skip(size_t size)
+{
+    while (size > 0)
+    {
+        const auto block = std::min(size, zeros.size());
+        update(zeros.data(), block);
+        size -= block;
+    }
+}
+
+} // namespace libbitcoin
@@ -18,12 +18,17 @@
  */
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
 
+#include <algorithm>
 #include <bitcoin/bitcoin/constants.hpp>
 #include <bitcoin/bitcoin/utility/assert.hpp>
 #include <bitcoin/bitcoin/utility/endian.hpp>
 
 namespace libbitcoin {
 
+// Bytes are read from a stream in chunks of at most this size, so that a
+// size read from the stream cannot by itself cause a large allocation.
+static constexpr size_t read_chunk_size = 64 * 1024;
+
 istream_reader::istream_reader(std::istream& stream)
   : stream_(stream)
 {
@@ -52,6 +57,12 @@ void istream_reader::invalidate()
     stream_.setstate(std::istream::failbit);
 }
 
+// The size of a stream is unknown.
+size_t istream_reader::remaining() const
+{
+    return max_size_t;
+}
+
 // Hashes.
 //-----------------------------------------------------------------------------
 
@@ -172,6 +183,36 @@ size_t istream_reader::read_size_little_endian()
     return 0;
 }
 
+uint64_t istream_reader::read_variable_base128()
+{
+    uint64_t value = 0;
+
+    // Each continued group is stored less one, so each value has one form.
+    while (true)
+    {
+        const auto byte = read_byte();
+
+        if (value > (max_uint64 >> 7))
+        {
+            invalidate();
+            return 0;
+        }
+
+        value = (value << 7) | (byte & 0x7f);
+
+        if ((byte & 0x80) == 0)
+            return value;
+
+        if (value == max_uint64)
+        {
+            invalidate();
+            return 0;
+        }
+
+        ++value;
+    }
+}
+
 // Bytes.
 //-----------------------------------------------------------------------------
 
@@ -197,21 +238,33 @@ data_chunk istream_reader::read_bytes()
     return out;
 }
 
-// Return size is guaranteed.
-// This is a memory exhaustion risk if caller does not control size.
+// Return size is guaranteed only if the reader remains valid.
+// The buffer grows as bytes arrive, so allocation is bounded by the stream.
 data_chunk istream_reader::read_bytes(size_t size)
 {
-    // TODO: avoid unnecessary default zero fill using
-    // the allocator adapter here: stackoverflow.com/a/21028912/1172329.
-    data_chunk out(size);
+    data_chunk out;
+    read_bytes(out, size);
+    return out;
+}
 
-    if (size > 0)
+void istream_reader::read_bytes(data_chunk& out, size_t size)
+{
+    out.clear();
+
+    while (out.size() < size && stream_)
     {
-        auto buffer = reinterpret_cast<char*>(out.data());
-        stream_.read(buffer, size);
+        const auto offset = out.size();
+        const auto chunk = std::min(size - offset, read_chunk_size);
+
+        // TODO: avoid unnecessary default zero fill using
+        // the allocator adapter here: stackoverflow.com/a/21028912/1172329.
+        out.resize(offset + chunk);
+        auto buffer = reinterpret_cast<char*>(out.data() + offset);
+        stream_.read(buffer, chunk);
     }
 
-    return out;
+    if (!stream_)
+        out.clear();
 }
 
 std::string istream_reader::read_string()
@@ -223,7 +276,7 @@ std::string istream_reader::read_string()
 std::string istream_reader::read_string(size_t size)
 {
     std::string out;
-    out.reserve(size);
+    out.reserve(std::min(size, read_chunk_size));
     auto terminated = false;
 
     // Read all size characters, pushing all non-null (may be many).
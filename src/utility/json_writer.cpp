@@ -0,0 +1,138 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/utility/json_writer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace libbitcoin {
+
+json_writer::json_writer(std::string& sink)
+  : sink_(sink), first_(true)
+{
+}
+
+// Containers.
+//-----------------------------------------------------------------------------
+
+void json_writer::begin_object()
+{
+    separate();
+    sink_.push_back('{');
+    first_ = true;
+}
+
+void json_writer::end_object()
+{
+    sink_.push_back('}');
+    first_ = false;
+}
+
+void json_writer::begin_array()
+{
+    separate();
+    sink_.push_back('[');
+    first_ = true;
+}
+
+void json_writer::end_array()
+{
+    sink_.push_back(']');
+    first_ = false;
+}
+
+// Members and values.
+//-----------------------------------------------------------------------------
+
+// The value that follows a key is not separated.
+void json_writer::write_key(const char* key)
+{
+    separate();
+    write_escaped(key, std::strlen(key));
+    sink_.push_back(':');
+    first_ = true;
+}
+
+void json_writer::write_value(const std::string& value)
+{
+    separate();
+    write_escaped(value.data(), value.size());
+    first_ = false;
+}
+
+void json_writer::write_value(uint64_t value)
+{
+    separate();
+    sink_.push_back('"');
+    sink_.append(std::to_string(value));
+    sink_.push_back('"');
+    first_ = false;
+}
+
+// private
+//-----------------------------------------------------------------------------
+
+void json_writer::separate()
+{
+    if (!first_)
+        sink_.push_back(',');
+}
+
+// This matches boost::property_tree::json_parser::create_escapes.
+void json_writer::write_escaped(const char* text, size_t size)
+{
+    static const char* digits = "0123456789ABCDEF";
+
+    sink_.push_back('"');
+
+    for (size_t index = 0; index < size; ++index)
+    {
+        const auto character = static_cast<uint8_t>(text[index]);
+
+        switch (character)
+        {
+            case '\b': sink_.append("\\b"); break;
+            case '\f': sink_.append("\\f"); break;
+            case '\n': sink_.append("\\n"); break;
+            case '\r': sink_.append("\\r"); break;
+            case '\t': sink_.append("\\t"); break;
+            case '/': sink_.append("\\/"); break;
+            case '"': sink_.append("\\\""); break;
+            case '\\': sink_.append("\\\\"); break;
+            default:
+            {
+                if (character >= 0x20)
+                {
+                    sink_.push_back(static_cast<char>(character));
+                    break;
+                }
+
+                sink_.append("\\u00");
+                sink_.push_back(digits[character >> 4]);
+                sink_.push_back(digits[character & 0x0f]);
+            }
+        }
+    }
+
+    sink_.push_back('"');
+}
+
+} // namespace libbitcoin
@@ -0,0 +1,367 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/utility/large_page_allocator.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <new>
+#include <string>
+#include <vector>
+#include <bitcoin/bitcoin/log/metrics.hpp>
+
+#ifdef __linux__
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+namespace libbitcoin {
+
+using namespace bc::log;
+
+typedef large_pages::mode page_mode_t;
+
+struct region
+{
+    size_t size;
+    page_mode_t mode;
+};
+
+struct state
+{
+    large_pages::policy policy;
+    large_pages::usage usage{ 0, 0, 0, 0, 0, 0 };
+    std::map<const void*, region> regions;
+};
+
+// Function statics, as tables may be allocated during static initialization.
+static state& registry()
+{
+    static state instance;
+    return instance;
+}
+
+static std::mutex& registry_mutex()
+{
+    static std::mutex instance;
+    return instance;
+}
+
+static size_t* usage_of(large_pages::usage& usage, page_mode_t mode)
+{
+    switch (mode)
+    {
+        case page_mode_t::standard:
+            return &usage.standard;
+        case page_mode_t::transparent:
+            return &usage.transparent;
+        case page_mode_t::huge_2mb:
+            return &usage.huge_2mb;
+        case page_mode_t::huge_1gb:
+            return &usage.huge_1gb;
+        default:
+            return nullptr;
+    }
+}
+
+static size_t round_up(size_t size, size_t page)
+{
+    return (size + page - 1) / page * page;
+}
+
+// Mapping.
+// ----------------------------------------------------------------------------
+// Only linux provides explicit (hugetlbfs) and advised (transparent) huge
+// pages to anonymous mappings, elsewhere allocations are taken from the heap.
+
+#ifdef __linux__
+
+static const size_t size_2mb = size_t(1) << 21;
+static const size_t size_1gb = size_t(1) << 30;
+
+#ifndef MAP_HUGE_SHIFT
+    #define MAP_HUGE_SHIFT 26
+#endif
+
+// The memory policies of mbind, as defined by numaif.h.
+static const int preferred_policy = 1;
+static const int bind_policy = 2;
+
+static void* map_anonymous(size_t size, int flags)
+{
+    const auto address = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS | flags, -1, 0);
+
+    return address == MAP_FAILED ? nullptr : address;
+}
+
+#ifdef MAP_HUGETLB
+static void* map_huge(size_t size, size_t page_bits)
+{
+    const auto flags = MAP_HUGETLB | static_cast<int>(page_bits <<
+        MAP_HUGE_SHIFT);
+
+    return map_anonymous(size, flags);
+}
+#endif
+
+// Map standard pages aligned to huge pages and advise the kernel to back
+// them with huge pages, which it does as they are faulted or by compaction.
+static void* map_transparent(size_t size, bool& advised)
+{
+    advised = false;
+    const auto slack = size + size_2mb;
+    const auto base = static_cast<uint8_t*>(map_anonymous(slack, 0));
+
+    if (base == nullptr)
+        return nullptr;
+
+    const auto address = reinterpret_cast<uintptr_t>(base);
+    const auto aligned = round_up(address, size_2mb);
+    const auto head = aligned - address;
+    const auto tail = slack - head - size;
+    const auto start = base + head;
+
+    if (head != 0)
+        munmap(base, head);
+
+    if (tail != 0)
+        munmap(start + size, tail);
+
+#ifdef MADV_HUGEPAGE
+    advised = madvise(start, size, MADV_HUGEPAGE) == 0;
+#endif
+
+    return start;
+}
+
+// Explicit huge pages are reserved from a global pool when mapped but taken
+// from a node when faulted, so binding them to a node that has exhausted its
+// pool would fault fatally. They are bound by preference instead.
+static bool bind(void* address, size_t size, int node, page_mode_t mode)
+{
+#ifdef __NR_mbind
+    static const size_t word_bits = sizeof(unsigned long) * 8;
+    const auto index = static_cast<size_t>(node);
+    std::vector<unsigned long> mask(index / word_bits + 1, 0);
+    mask[index / word_bits] |= 1ul << (index % word_bits);
+
+    const auto hugetlb = mode == page_mode_t::huge_2mb ||
+        mode == page_mode_t::huge_1gb;
+    const auto policy = hugetlb ? preferred_policy : bind_policy;
+
+    // The kernel reads one less than the given number of mask bits.
+    const auto bits = mask.size() * word_bits + 1;
+    return syscall(__NR_mbind, address, size, policy, mask.data(), bits,
+        0) == 0;
+#else
+    return false;
+#endif
+}
+
+// Map the largest pages permitted by policy, setting the size and mode.
+static void* map(size_t size, const large_pages::policy& policy,
+    region& out_region)
+{
+    const auto requested = policy.pages;
+    void* address = nullptr;
+
+#ifdef MAP_HUGETLB
+    if (requested >= page_mode_t::huge_1gb && size >= size_1gb)
+    {
+        out_region = { round_up(size, size_1gb), page_mode_t::huge_1gb };
+        address = map_huge(out_region.size, 30);
+    }
+
+    if (address == nullptr && requested >= page_mode_t::huge_2mb &&
+        size >= size_2mb)
+    {
+        out_region = { round_up(size, size_2mb), page_mode_t::huge_2mb };
+        address = map_huge(out_region.size, 21);
+    }
+#endif
+
+    if (address == nullptr && requested >= page_mode_t::transparent)
+    {
+        bool advised;
+        out_region.size = round_up(size, size_2mb);
+        address = map_transparent(out_region.size, advised);
+        out_region.mode = advised ? page_mode_t::transparent :
+            page_mode_t::standard;
+    }
+
+    if (address == nullptr)
+    {
+        const auto page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        out_region = { round_up(size, page), page_mode_t::standard };
+        address = map_anonymous(out_region.size, 0);
+    }
+
+    return address;
+}
+
+static void unmap(void* address, const region& mapped)
+{
+    munmap(address, mapped.size);
+}
+
+#else
+
+static void* map(size_t, const large_pages::policy&, region&)
+{
+    return nullptr;
+}
+
+static void unmap(void*, const region&)
+{
+}
+
+#endif
+
+// large_pages
+// ----------------------------------------------------------------------------
+
+void large_pages::configure(const policy& value)
+{
+    std::lock_guard<std::mutex> lock(registry_mutex());
+    registry().policy = value;
+}
+
+large_pages::policy large_pages::configuration()
+{
+    std::lock_guard<std::mutex> lock(registry_mutex());
+    return registry().policy;
+}
+
+void* large_pages::allocate(size_t size)
+{
+    const auto setting = configuration();
+
+    if (setting.pages == mode::heap || size < setting.minimum || size == 0)
+        return ::operator new(size);
+
+    region mapped{ 0, mode::heap };
+    const auto address = map(size, setting, mapped);
+    auto numa_fallback = false;
+
+#ifdef __linux__
+    if (address != nullptr && setting.numa_node >= 0)
+        numa_fallback = !bind(address, mapped.size, setting.numa_node,
+            mapped.mode);
+#endif
+
+    {
+        std::lock_guard<std::mutex> lock(registry_mutex());
+        auto& instance = registry();
+
+        if (mapped.mode < setting.pages)
+            ++instance.usage.page_fallbacks;
+
+        if (numa_fallback)
+            ++instance.usage.numa_fallbacks;
+
+        if (address != nullptr)
+        {
+            *usage_of(instance.usage, mapped.mode) += mapped.size;
+            instance.regions.emplace(address, mapped);
+            return address;
+        }
+    }
+
+    // The system does not provide a mapping, so use the heap.
+    return ::operator new(size);
+}
+
+void large_pages::deallocate(void* address, size_t) noexcept
+{
+    if (address == nullptr)
+        return;
+
+    region mapped;
+
+    {
+        std::lock_guard<std::mutex> lock(registry_mutex());
+        auto& instance = registry();
+        const auto it = instance.regions.find(address);
+
+        if (it == instance.regions.end())
+        {
+            ::operator delete(address);
+            return;
+        }
+
+        mapped = it->second;
+        *usage_of(instance.usage, mapped.mode) -= mapped.size;
+        instance.regions.erase(it);
+    }
+
+    unmap(address, mapped);
+}
+
+large_pages::mode large_pages::page_mode(const void* address)
+{
+    std::lock_guard<std::mutex> lock(registry_mutex());
+    const auto& regions = registry().regions;
+    const auto it = regions.find(address);
+    return it == regions.end() ? mode::heap : it->second.mode;
+}
+
+const char* large_pages::to_string(mode value)
+{
+    switch (value)
+    {
+        case mode::standard:
+            return "standard";
+        case mode::transparent:
+            return "transparent";
+        case mode::huge_2mb:
+            return "huge_2mb";
+        case mode::huge_1gb:
+            return "huge_1gb";
+        default:
+            return "heap";
+    }
+}
+
+large_pages::usage large_pages::current()
+{
+    std::lock_guard<std::mutex> lock(registry_mutex());
+    return registry().usage;
+}
+
+void large_pages::publish(metrics& metrics)
+{
+    const auto usage = current();
+    const auto set = [&metrics](mode value, size_t bytes)
+    {
+        metrics.get_gauge(std::string("pages.") + to_string(value)).set(
+            bytes);
+    };
+
+    set(mode::standard, usage.standard);
+    set(mode::transparent, usage.transparent);
+    set(mode::huge_2mb, usage.huge_2mb);
+    set(mode::huge_1gb, usage.huge_1gb);
+    metrics.get_gauge("pages.page_fallbacks").set(usage.page_fallbacks);
+    metrics.get_gauge("pages.numa_fallbacks").set(usage.numa_fallbacks);
+}
+
+} // namespace libbitcoin
@@ -0,0 +1,195 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/utility/memory_budget.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+#include <bitcoin/bitcoin/chain/redeem_script_cache.hpp>
+#include <bitcoin/bitcoin/math/public_key_cache.hpp>
+
+namespace libbitcoin {
+
+using namespace bc::chain;
+
+// static
+memory_budget& memory_budget::process()
+{
+    static memory_budget budget;
+    static std::once_flag enrolled;
+
+    std::call_once(enrolled, []()
+    {
+        auto& keys = public_key_cache::parsed_keys();
+        auto& scripts = redeem_script_cache::redeem_scripts();
+
+        budget.enroll(
+        {
+            "public keys", 1, 1,
+            [&keys]() { return keys.size() * public_key_cache::entry_size; },
+            [&keys](size_t bytes) { keys.resize(bytes); }
+        });
+
+        budget.enroll(
+        {
+            "redeem scripts", 1, 1,
+            [&scripts]() { return scripts.bytes(); },
+            [&scripts](size_t bytes) { scripts.resize(bytes); }
+        });
+    });
+
+    return budget;
+}
+
+memory_budget::memory_budget(size_t total_bytes)
+  : total_(total_bytes), next_(0)
+{
+}
+
+memory_budget::token memory_budget::enroll(const participant& cache)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto cache_token = next_++;
+    records_.emplace(cache_token, record{ cache, 0 });
+    rebalance_unlocked();
+    return cache_token;
+}
+
+bool memory_budget::withdraw(token cache)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (records_.erase(cache) == 0)
+        return false;
+
+    rebalance_unlocked();
+    return true;
+}
+
+void memory_budget::set_total(size_t total_bytes)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    total_ = total_bytes;
+    rebalance_unlocked();
+}
+
+size_t memory_budget::total() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return total_;
+}
+
+void memory_budget::rebalance()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    rebalance_unlocked();
+}
+
+// private
+// The share is divided before multiplication, as total * weight may
+// overflow. The remainder of the division is shared in the same proportion.
+void memory_budget::rebalance_unlocked()
+{
+    if (total_ == 0)
+        return;
+
+    size_t weights = 0;
+    for (const auto& entry: records_)
+        weights += entry.second.cache.weight;
+
+    if (weights == 0)
+        return;
+
+    const auto quotient = total_ / weights;
+    const auto remainder = total_ % weights;
+
+    for (auto& entry: records_)
+    {
+        auto& value = entry.second;
+        const auto weight = value.cache.weight;
+        value.limit = quotient * weight + remainder * weight / weights;
+        value.cache.resize(value.limit);
+    }
+}
+
+size_t memory_budget::shrink(size_t bytes)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<record*> ordered;
+    ordered.reserve(records_.size());
+
+    for (auto& entry: records_)
+        ordered.push_back(&entry.second);
+
+    // Stable, so caches of equal priority shrink in enrollment order.
+    std::stable_sort(ordered.begin(), ordered.end(),
+        [](const record* left, const record* right)
+        {
+            return left->cache.priority < right->cache.priority;
+        });
+
+    auto remaining = bytes;
+
+    for (auto value: ordered)
+    {
+        if (remaining == 0)
+            break;
+
+        const auto used = value->cache.usage();
+        const auto released = std::min(used, remaining);
+
+        if (released == 0)
+            continue;
+
+        value->limit = used - released;
+        value->cache.resize(value->limit);
+        remaining -= released;
+    }
+
+    return bytes - remaining;
+}
+
+size_t memory_budget::usage() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t total = 0;
+
+    for (const auto& entry: records_)
+        total += entry.second.cache.usage();
+
+    return total;
+}
+
+memory_budget::reports memory_budget::state() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    reports out;
+    out.reserve(records_.size());
+
+    for (const auto& entry: records_)
+    {
+        const auto& value = entry.second;
+        out.push_back({ value.cache.name, value.limit, value.cache.usage() });
+    }
+
+    return out;
+}
+
+} // namespace libbitcoin
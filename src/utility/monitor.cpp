@@ -18,25 +18,170 @@
  */
 #include <bitcoin/bitcoin/utility/monitor.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <string>
 #include <utility>
-////#include <bitcoin/bitcoin/log/sources.hpp>
+#include <boost/log/common.hpp>
+#include <boost/log/expressions.hpp>
+#include <boost/thread/lock_guard.hpp>
+#include <bitcoin/bitcoin/log/statsd_source.hpp>
+#include <bitcoin/bitcoin/utility/trace.hpp>
 
 // libbitcoin defines the log and tracking but does not use them.
 // These are defined in bc so that they can be used in network and blockchain.
 
 namespace libbitcoin {
 
-monitor::monitor(count_ptr counter, std::string&& name)
-  : counter_(counter), name_(std::move(name))
+using namespace std::chrono;
+
+// histogram
+// ----------------------------------------------------------------------------
+
+monitor::histogram::histogram()
+  : total_(0)
+{
+    for (auto& count: counts_)
+        count.store(0);
+}
+
+void monitor::histogram::record(duration elapsed)
+{
+    const auto value = static_cast<uint64_t>(std::max(elapsed.count(),
+        duration::rep(0)));
+
+    size_t index = 0;
+    for (auto shifted = value; shifted != 0 && index + 1 < buckets; ++index)
+        shifted >>= 1;
+
+    counts_[index].fetch_add(1, std::memory_order_relaxed);
+    total_.fetch_add(value, std::memory_order_relaxed);
+}
+
+uint64_t monitor::histogram::limit(size_t bucket)
+{
+    return uint64_t(1) << bucket;
+}
+
+uint64_t monitor::histogram::bucket(size_t index) const
+{
+    return counts_[index].load(std::memory_order_relaxed);
+}
+
+uint64_t monitor::histogram::samples() const
+{
+    uint64_t sum = 0;
+    for (const auto& count: counts_)
+        sum += count.load(std::memory_order_relaxed);
+
+    return sum;
+}
+
+monitor::duration monitor::histogram::total() const
+{
+    return duration(total_.load(std::memory_order_relaxed));
+}
+
+// Cumulative values are sent as gauges so that the exporter may publish at
+// any interval, the receiver derives rates. Empty buckets are not sent.
+void monitor::histogram::publish(const std::string& name) const
+{
+    for (size_t index = 0; index < buckets; ++index)
+    {
+        const auto count = bucket(index);
+        if (count == 0)
+            continue;
+
+        // The last bucket is unbounded.
+        const auto bound = index + 1 < buckets ?
+            ".lt_" + std::to_string(limit(index)) :
+            ".ge_" + std::to_string(limit(index - 1));
+
+        BC_STATS_GAUGE(name + bound + "us", count);
+    }
+
+    BC_STATS_GAUGE(name + ".samples", samples());
+    BC_STATS_GAUGE(name + ".microseconds", total().count());
+}
+
+// monitor
+// ----------------------------------------------------------------------------
+
+monitor::monitor(std::string&& name)
+  : name_(std::move(name)),
+#ifdef BC_TRACE
+    trace_name_(trace_events::intern(name_)),
+#else
+    trace_name_(nullptr),
+#endif
+    backlog_(0),
+    running_(0),
+    started_(0)
+{
+}
+
+void monitor::start(clock::duration waited)
+{
+    --backlog_;
+    ++running_;
+    started_.fetch_add(1, std::memory_order_relaxed);
+    latency_.record(duration_cast<duration>(waited));
+}
+
+void monitor::stop(clock::duration elapsed)
+{
+    --running_;
+    runtime_.record(duration_cast<duration>(elapsed));
+}
+
+// Properties.
+//-----------------------------------------------------------------------------
+
+const std::string& monitor::name() const
+{
+    return name_;
+}
+
+const char* monitor::trace_name() const
+{
+    return trace_name_;
+}
+
+size_t monitor::backlog() const
+{
+    return backlog_.load();
+}
+
+uint64_t monitor::started() const
+{
+    return started_.load(std::memory_order_relaxed);
+}
+
+size_t monitor::running() const
+{
+    return running_.load();
+}
+
+const monitor::histogram& monitor::latency() const
+{
+    return latency_;
+}
+
+const monitor::histogram& monitor::runtime() const
 {
-    trace(++(*counter_), "+");
+    return runtime_;
 }
 
-monitor::~monitor()
+void monitor::publish(const std::string& prefix) const
 {
-    trace(--(*counter_), "-");
+    const auto name = prefix + "." + name_;
+    BC_STATS_GAUGE(name + ".backlog", backlog());
+    BC_STATS_GAUGE(name + ".running", running());
+    BC_STATS_GAUGE(name + ".started", started());
+    latency_.publish(name + ".latency");
+    runtime_.publish(name + ".runtime");
 }
 
 } // namespace libbitcoin
@@ -23,12 +23,9 @@
 #include <iostream>
 #include <stdexcept>
 #include <bitcoin/bitcoin/constants.hpp>
-#include <bitcoin/bitcoin/formats/base_16.hpp>
 #include <bitcoin/bitcoin/utility/color.hpp>
-#include <bitcoin/bitcoin/utility/container_sink.hpp>
-#include <bitcoin/bitcoin/utility/container_source.hpp>
+#include <bitcoin/bitcoin/utility/endian.hpp>
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
-#include <bitcoin/bitcoin/utility/ostream_writer.hpp>
 
 namespace libbitcoin {
 
@@ -36,17 +33,20 @@ namespace libbitcoin {
 
 bool png::write_png(const data_chunk& data, uint32_t size, std::ostream& out)
 {
-    data_source istream(data);
-    return png::write_png(istream, size, out);
+    return png_writer(size).write(data, out);
 }
 
 bool png::write_png(const data_chunk& data, uint32_t size,
     uint32_t dots_per_inch, uint32_t margin, uint32_t inches_per_meter,
     const color& foreground, const color& background, std::ostream& out)
 {
-    data_source istream(data);
-    return png::write_png(istream, size, dots_per_inch, margin,
-        inches_per_meter, foreground, background, out);
+    png_writer::options settings(size);
+    settings.dots_per_inch = dots_per_inch;
+    settings.margin = margin;
+    settings.inches_per_meter = inches_per_meter;
+    settings.foreground = foreground;
+    settings.background = background;
+    return png_writer(settings).write(data, out);
 }
 
 bool png::write_png(std::istream& in, uint32_t size, std::ostream& out)
@@ -55,14 +55,56 @@ bool png::write_png(std::istream& in, uint32_t size, std::ostream& out)
         get_default_foreground(), get_default_background(), out);
 }
 
-extern "C" void sink_write(png_structp png_ptr, png_bytep data,
+bool png::write_png(std::istream& in, uint32_t size, uint32_t dots_per_inch,
+    uint32_t margin, uint32_t inches_per_meter, const color& foreground,
+    const color& background, std::ostream& out)
+{
+    png_writer::options settings(size);
+    settings.dots_per_inch = dots_per_inch;
+    settings.margin = margin;
+    settings.inches_per_meter = inches_per_meter;
+    settings.foreground = foreground;
+    settings.background = background;
+    return png_writer(settings).write(in, out);
+}
+
+// png_writer
+//-----------------------------------------------------------------------------
+
+// The size of the version and width that precede the qrcode modules.
+static BC_CONSTEXPR size_t qrcode_prefix = 2 * sizeof(uint32_t);
+
+BC_CONSTEXPR int32_t png_writer::default_setting;
+
+png_writer::options::options(uint32_t size)
+  : size(size),
+    dots_per_inch(png::dots_per_inch),
+    margin(png::margin),
+    inches_per_meter(png::inches_per_meter),
+    foreground(png::get_default_foreground()),
+    background(png::get_default_background()),
+    level(default_setting),
+    filters(default_setting),
+    strategy(default_setting)
+{
+}
+
+png_writer::png_writer(const options& settings)
+  : options_(settings)
+{
+}
+
+extern "C" void stream_write(png_structp png_ptr, png_bytep data,
     png_size_t length)
 {
-    static_assert(sizeof(length) <= sizeof(size_t), "png_size_t too large");
-    const auto size = static_cast<size_t>(length);
+    auto& stream = *reinterpret_cast<std::ostream*>(png_get_io_ptr(png_ptr));
+    stream.write(reinterpret_cast<const char*>(data),
+        static_cast<std::streamsize>(length));
+}
 
-    auto& sink = *reinterpret_cast<ostream_writer*>(png_get_io_ptr(png_ptr));
-    sink.write_bytes(reinterpret_cast<const uint8_t*>(data), size);
+extern "C" void stream_flush(png_structp png_ptr)
+{
+    reinterpret_cast<std::ostream*>(png_get_io_ptr(png_ptr))->flush();
 }
 
 extern "C" void error_callback(png_structp, png_const_charp error_message)
@@ -70,51 +112,80 @@ extern "C" void error_callback(png_structp, png_const_charp error_message)
     throw std::runtime_error(error_message);
 }
 
-bool png::write_png(std::istream& in, uint32_t size, uint32_t dots_per_inch,
-    uint32_t margin, uint32_t inches_per_meter, const color& foreground,
-    const color& background, std::ostream& out)
+// The modules are read in place.
+bool png_writer::write(const data_chunk& qrcode, std::ostream& out)
 {
-    if (size == 0)
+    if (qrcode.size() < qrcode_prefix)
         return false;
 
+    const auto width = from_little_endian_unsafe<uint32_t>(
+        qrcode.begin() + sizeof(uint32_t));
+
+    if (width == 0 || width > max_size_t / width ||
+        qrcode.size() - qrcode_prefix < size_t(width) * width)
+        return false;
+
+    return write(qrcode.data() + qrcode_prefix, width, out);
+}
+
+bool png_writer::write(std::istream& in, std::ostream& out)
+{
     istream_reader source(in);
+
     // Skip version.
-    source.skip(4);
-    auto width = source.read_4_bytes_little_endian();
+    source.skip(sizeof(uint32_t));
+    const auto width = source.read_4_bytes_little_endian();
 
-    if (bc::max_size_t / width < width)
+    if (!source || width == 0 || width > max_size_t / width)
         return false;
 
-    const auto area = width * width;
-    auto data = source.read_bytes(area);
+    modules_ = source.read_bytes(size_t(width) * width);
 
-    try
-    {
-        static constexpr int32_t bit_depth = 1;
-        static constexpr int32_t bits_per_byte = 8;
-        static constexpr uint8_t margin_value = 0xff;
+    if (!source)
+        return false;
 
-        if ((size == 0) || (margin > max_size_t / size))
-            return false;
+    return write(modules_.data(), width, out);
+}
 
-        if ((width + margin * 2) > max_size_t / size)
-            return false;
+// private
+// A dark module clears the dots of its row to the foreground (index zero).
+bool png_writer::write(const uint8_t* modules, uint32_t width,
+    std::ostream& out)
+{
+    static BC_CONSTEXPR int32_t bit_depth = 1;
+    static BC_CONSTEXPR size_t bits_per_byte = 8;
+    static BC_CONSTEXPR uint8_t margin_value = 0xff;
 
-        const auto margin_size = margin * size;
-        const auto realwidth = (width + margin * 2) * size;
-        const auto row_size = (realwidth + 7) / bits_per_byte;
+    const uint64_t size = options_.size;
+    const auto padded = uint64_t(width) + 2 * uint64_t(options_.margin);
 
-        data_chunk row;
-        row.reserve(row_size);
+    if (size == 0 || padded > PNG_UINT_31_MAX / size)
+        return false;
 
-        auto png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr,
-            nullptr, nullptr);
-        if (png_ptr == nullptr)
-            return false;
+    const auto margin_size = static_cast<size_t>(options_.margin * size);
+    const auto realwidth = static_cast<png_uint_32>(padded * size);
+    const auto row_size = (size_t(realwidth) + 7) / bits_per_byte;
+
+    auto png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr,
+        error_callback, nullptr);
+
+    if (png_ptr == nullptr)
+        return false;
+
+    png_infop info_ptr = nullptr;
+
+    try
+    {
+        info_ptr = png_create_info_struct(png_ptr);
 
-        auto info_ptr = png_create_info_struct(png_ptr);
         if (info_ptr == nullptr)
+        {
+            png_destroy_write_struct(&png_ptr, nullptr);
             return false;
+        }
+
+        const auto& foreground = options_.foreground;
+        const auto& background = options_.background;
 
         png_color palette[2];
         palette[0].red = foreground.red;
@@ -130,73 +201,69 @@ bool png::write_png(std::istream& in, uint32_t size, uint32_t dots_per_inch,
 
         png_set_PLTE(png_ptr, info_ptr, palette, 2);
         png_set_tRNS(png_ptr, info_ptr, alpha_values, 2, nullptr);
+        png_set_write_fn(png_ptr, &out, stream_write, stream_flush);
+
+        if (options_.level != default_setting)
+            png_set_compression_level(png_ptr, options_.level);
+
+        if (options_.filters != default_setting)
+            png_set_filter(png_ptr, PNG_FILTER_TYPE_BASE, options_.filters);
 
-        ostream_writer sink(out);
-        png_set_write_fn(png_ptr, &sink, sink_write, nullptr);
-        png_set_error_fn(png_ptr, nullptr, error_callback, nullptr);
+        if (options_.strategy != default_setting)
+            png_set_compression_strategy(png_ptr, options_.strategy);
 
         png_set_IHDR(png_ptr, info_ptr, realwidth, realwidth, bit_depth,
             PNG_COLOR_TYPE_PALETTE, PNG_INTERLACE_NONE,
             PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
 
-        png_set_pHYs(png_ptr, info_ptr, dots_per_inch * inches_per_meter,
-            dots_per_inch * inches_per_meter, PNG_RESOLUTION_METER);
+        const auto dots_per_meter = options_.dots_per_inch *
+            options_.inches_per_meter;
+
+        png_set_pHYs(png_ptr, info_ptr, dots_per_meter, dots_per_meter,
+            PNG_RESOLUTION_METER);
 
         png_write_info(png_ptr, info_ptr);
 
-        // write top margin
-        row.assign(row_size, margin_value);
-        for (size_t y = 0; y < margin_size; y++)
-            png_write_row(png_ptr, row.data());
+        // Write top margin.
+        row_.assign(row_size, margin_value);
+        for (size_t y = 0; y < margin_size; ++y)
+            png_write_row(png_ptr, row_.data());
 
-        // write data
-        uint8_t* row_ptr = nullptr;
-        auto data_ptr = data.data();
-        for (size_t y = 0; y < width; y++)
+        // Write modules, each row of modules repeated for its dots.
+        for (size_t y = 0; y < width; ++y)
         {
-            // TODO: unguarded overflow conditions.
-            auto bit = bits_per_byte - 1;
-            row.assign(row_size, margin_value);
-            row_ptr = row.data();
-            row_ptr += margin_size / bits_per_byte;
-            bit = (bits_per_byte - 1) - (margin_size % bits_per_byte);
-
-            for (size_t x = 0; x < width; x++)
+            row_.assign(row_size, margin_value);
+            auto dot = margin_size;
+
+            for (size_t x = 0; x < width; ++x, ++modules)
             {
-                for (size_t xx = 0; xx < size; xx++)
-                {
-                    *row_ptr ^= (*data_ptr & 1) << bit;
-                    bit--;
-                    if (bit < 0)
-                    {
-                        row_ptr++;
-                        bit = bits_per_byte - 1;
-                    }
-                }
-
-                data_ptr++;
+                const auto dark = static_cast<uint8_t>(*modules & 1);
+
+                for (size_t xx = 0; xx < size; ++xx, ++dot)
+                    row_[dot / bits_per_byte] ^= dark <<
+                        ((bits_per_byte - 1) - (dot % bits_per_byte));
             }
 
-            for (size_t yy = 0; yy < size; yy++)
-                png_write_row(png_ptr, row.data());
+            for (size_t yy = 0; yy < size; ++yy)
+                png_write_row(png_ptr, row_.data());
         }
 
-        // write bottom margin
-        row.assign(row_size, margin_value);
-        for (size_t y = 0; y < margin_size; y++)
-            png_write_row(png_ptr, row.data());
+        // Write bottom margin.
+        row_.assign(row_size, margin_value);
+        for (size_t y = 0; y < margin_size; ++y)
+            png_write_row(png_ptr, row_.data());
 
         png_write_end(png_ptr, info_ptr);
-        png_destroy_write_struct(&png_ptr, &info_ptr);
-
-        out.flush();
     }
-    catch (const std::runtime_error& error)
+    catch (const std::runtime_error&)
     {
+        png_destroy_write_struct(&png_ptr, &info_ptr);
         return false;
     }
 
-    return true;
+    png_destroy_write_struct(&png_ptr, &info_ptr);
+    out.flush();
+    return !out.fail();
 }
 
 #endif
@@ -0,0 +1,109 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/utility/pool_allocator.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace libbitcoin {
+
+// The class sizes, each a multiple of the pointer alignment.
+static const size_t class_sizes[chunk_pool::classes]
+{
+    16, 24, 32, 40, 48, 64, 80, 96, 128
+};
+
+// The size class of each eight byte multiple up to the maximum.
+static const uint8_t classes_by_octet[chunk_pool::maximum / 8 + 1]
+{
+    0, 0, 0, 1, 2, 3, 4, 5, 5, 6, 6, 7, 7, 8, 8, 8, 8
+};
+
+chunk_pool::lists::~lists()
+{
+    for (auto head: heads)
+    {
+        while (head != nullptr)
+        {
+            const auto next = head->next;
+            ::operator delete(head);
+            head = next;
+        }
+    }
+}
+
+chunk_pool::lists& chunk_pool::local()
+{
+    static thread_local lists instance;
+    return instance;
+}
+
+size_t chunk_pool::size_class(size_t size)
+{
+    return size == 0 || size > maximum ? classes :
+        classes_by_octet[(size + 7) / 8];
+}
+
+size_t chunk_pool::class_size(size_t index)
+{
+    return class_sizes[index];
+}
+
+void* chunk_pool::allocate(size_t size)
+{
+    const auto index = size_class(size);
+    if (index == classes)
+        return ::operator new(size);
+
+    auto& pool = local();
+    const auto head = pool.heads[index];
+
+    if (head == nullptr)
+        return ::operator new(class_sizes[index]);
+
+    pool.heads[index] = head->next;
+    --pool.sizes[index];
+    return head;
+}
+
+void chunk_pool::deallocate(void* buffer, size_t size) noexcept
+{
+    const auto index = size_class(size);
+    if (index == classes)
+    {
+        ::operator delete(buffer);
+        return;
+    }
+
+    // Retain a bounded number of buffers per class, release the excess.
+    auto& pool = local();
+    if (pool.sizes[index] == depth)
+    {
+        ::operator delete(buffer);
+        return;
+    }
+
+    const auto released = static_cast<node*>(buffer);
+    released->next = pool.heads[index];
+    pool.heads[index] = released;
+    ++pool.sizes[index];
+}
+
+} // namespace libbitcoin
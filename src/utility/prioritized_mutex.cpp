@@ -18,26 +18,105 @@
  */
 #include <bitcoin/bitcoin/utility/prioritized_mutex.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <boost/log/common.hpp>
+#include <boost/log/expressions.hpp>
+#include <boost/thread/lock_guard.hpp>
+#include <bitcoin/bitcoin/log/statsd_source.hpp>
+#include <bitcoin/bitcoin/utility/monitor.hpp>
+#include <bitcoin/bitcoin/utility/thread.hpp>
+
 namespace libbitcoin {
 
-prioritized_mutex::prioritized_mutex(bool prioritize)
-  : prioritize_(prioritize)
+using namespace std::chrono;
+
+// contention
+// ----------------------------------------------------------------------------
+
+prioritized_mutex::contention::contention()
+  : acquisitions_(0), contended_(0), preemptions_(0)
+{
+}
+
+uint64_t prioritized_mutex::contention::acquisitions() const
+{
+    return acquisitions_.load(std::memory_order_relaxed);
+}
+
+uint64_t prioritized_mutex::contention::contended() const
+{
+    return contended_.load(std::memory_order_relaxed);
+}
+
+uint64_t prioritized_mutex::contention::preemptions() const
+{
+    return preemptions_.load(std::memory_order_relaxed);
+}
+
+const monitor::histogram& prioritized_mutex::contention::wait() const
+{
+    return wait_;
+}
+
+const monitor::histogram& prioritized_mutex::contention::hold() const
+{
+    return hold_;
+}
+
+void prioritized_mutex::contention::publish(const std::string& name) const
+{
+    BC_STATS_GAUGE(name + ".acquisitions", acquisitions());
+    BC_STATS_GAUGE(name + ".contended", contended());
+    BC_STATS_GAUGE(name + ".preemptions", preemptions());
+    wait_.publish(name + ".wait");
+    hold_.publish(name + ".hold");
+}
+
+// prioritized_mutex
+// ----------------------------------------------------------------------------
+
+prioritized_mutex::prioritized_mutex(bool prioritize, bool instrument,
+    size_t spin_limit)
+  : prioritize_(prioritize),
+    instrument_(instrument),
+    spin_limit_(spin_limit),
+    spins_(0),
+    low_waiting_(0)
 {
 }
 
 void prioritized_mutex::lock_low_priority()
 {
+    const auto requested = instrument_ ? clock::now() : clock::time_point();
+    auto contended = false;
+
+    if (instrument_)
+        ++low_waiting_;
+
     if (prioritize_)
     {
-        wait_mutex_.lock();
-        next_mutex_.lock();
+        contended |= acquire(wait_mutex_);
+        contended |= acquire(next_mutex_);
     }
 
-    data_mutex_.lock();
+    contended |= acquire(data_mutex_);
+
+    if (instrument_)
+    {
+        --low_waiting_;
+        acquired(low_, requested, contended);
+    }
 }
 
 void prioritized_mutex::unlock_low_priority()
 {
+    if (instrument_)
+        released(low_);
+
     if (prioritize_)
         next_mutex_.unlock();
 
@@ -49,18 +128,107 @@ void prioritized_mutex::unlock_low_priority()
 
 void prioritized_mutex::lock_high_priority()
 {
+    const auto requested = instrument_ ? clock::now() : clock::time_point();
+    auto contended = false;
+
     if (prioritize_)
-        next_mutex_.lock();
+        contended |= acquire(next_mutex_);
 
-    data_mutex_.lock();
+    contended |= acquire(data_mutex_);
 
     if (prioritize_)
         next_mutex_.unlock();
+
+    if (instrument_)
+    {
+        if (low_waiting_.load() != 0)
+            low_.preemptions_.fetch_add(1, std::memory_order_relaxed);
+
+        acquired(high_, requested, contended);
+    }
 }
 
 void prioritized_mutex::unlock_high_priority()
 {
+    if (instrument_)
+        released(high_);
+
     data_mutex_.unlock();
 }
 
+const prioritized_mutex::contention& prioritized_mutex::low_priority() const
+{
+    return low_;
+}
+
+const prioritized_mutex::contention& prioritized_mutex::high_priority() const
+{
+    return high_;
+}
+
+void prioritized_mutex::publish(const std::string& prefix) const
+{
+    low_.publish(prefix + ".low_priority");
+    high_.publish(prefix + ".high_priority");
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+// Spin on try_lock before parking, for up to twice the recent successful spin
+// count (within the limit), moving the estimate an eighth toward each result.
+// Returns true if the lock was not acquired on the first attempt.
+bool prioritized_mutex::acquire(shared_mutex& mutex)
+{
+    if (mutex.try_lock())
+        return false;
+
+    if (spin_limit_ == 0)
+    {
+        mutex.lock();
+        return true;
+    }
+
+    const auto estimate = spins_.load(std::memory_order_relaxed);
+    const auto maximum = std::min(spin_limit_, 2 * estimate + 10);
+
+    size_t spins = 0;
+    auto locked = false;
+
+    while (!locked && spins < maximum)
+    {
+        ++spins;
+        locked = mutex.try_lock();
+    }
+
+    if (!locked)
+        mutex.lock();
+
+    const auto adjusted = spins >= estimate ?
+        estimate + (spins - estimate) / 8 :
+        estimate - (estimate - spins) / 8;
+
+    spins_.store(adjusted, std::memory_order_relaxed);
+    return true;
+}
+
+void prioritized_mutex::acquired(contention& metrics,
+    clock::time_point requested, bool contended)
+{
+    held_since_ = clock::now();
+    metrics.acquisitions_.fetch_add(1, std::memory_order_relaxed);
+
+    if (contended)
+        metrics.contended_.fetch_add(1, std::memory_order_relaxed);
+
+    metrics.wait_.record(duration_cast<monitor::duration>(held_since_ -
+        requested));
+}
+
+void prioritized_mutex::released(contention& metrics)
+{
+    metrics.hold_.record(duration_cast<monitor::duration>(clock::now() -
+        held_since_));
+}
+
 } // namespace libbitcoin
@@ -0,0 +1,336 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/utility/property_writer.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <bitcoin/bitcoin/chain/header.hpp>
+#include <bitcoin/bitcoin/chain/input.hpp>
+#include <bitcoin/bitcoin/chain/output.hpp>
+#include <bitcoin/bitcoin/chain/points_value.hpp>
+#include <bitcoin/bitcoin/chain/transaction.hpp>
+#include <bitcoin/bitcoin/config/header.hpp>
+#include <bitcoin/bitcoin/config/input.hpp>
+#include <bitcoin/bitcoin/config/transaction.hpp>
+#include <bitcoin/bitcoin/formats/base_16.hpp>
+#include <bitcoin/bitcoin/machine/rule_fork.hpp>
+#include <bitcoin/bitcoin/math/elliptic_curve.hpp>
+#include <bitcoin/bitcoin/math/stealth.hpp>
+#include <bitcoin/bitcoin/utility/tree_writer.hpp>
+#include <bitcoin/bitcoin/wallet/ec_public.hpp>
+
+namespace libbitcoin {
+
+using namespace bc::machine;
+
+// Edit with care - this must match the property order and formatting of
+// property_tree.cpp, as tests compare the two.
+
+// A property tree list is an array (json) or an object of members with the
+// element name. A list without elements is a property tree node with no
+// children, which is written as an empty value.
+template <typename Values, typename Write>
+static void write_list(tree_writer& out, const char* name,
+    const Values& values, bool json, Write write)
+{
+    if (values.empty())
+    {
+        out.write_value(std::string());
+        return;
+    }
+
+    if (json)
+        out.begin_array();
+    else
+        out.begin_object();
+
+    for (const auto& value: values)
+    {
+        if (!json)
+            out.write_key(name);
+
+        write(value);
+    }
+
+    if (json)
+        out.end_array();
+    else
+        out.end_object();
+}
+
+// headers
+
+void property_list(tree_writer& out, const config::header& header)
+{
+    const chain::header& block_header = header;
+
+    out.begin_object();
+    out.write_key("bits");
+    out.write_value(block_header.bits());
+    out.write_key("hash");
+    out.write_value(encode_hash(block_header.hash()));
+    out.write_key("merkle_tree_hash");
+    out.write_value(encode_hash(block_header.merkle()));
+    out.write_key("nonce");
+    out.write_value(block_header.nonce());
+    out.write_key("previous_block_hash");
+    out.write_value(encode_hash(block_header.previous_block_hash()));
+    out.write_key("time_stamp");
+    out.write_value(block_header.timestamp());
+    out.write_key("version");
+    out.write_value(block_header.version());
+    out.end_object();
+}
+
+void property_tree(tree_writer& out, const config::header& header)
+{
+    out.begin_object();
+    out.write_key("header");
+    property_list(out, header);
+    out.end_object();
+}
+
+void property_tree(tree_writer& out,
+    const std::vector<config::header>& headers, bool json)
+{
+    out.begin_object();
+    out.write_key("headers");
+    write_list(out, "header", headers, json,
+        [&out](const config::header& header)
+        {
+            property_list(out, header);
+        });
+    out.end_object();
+}
+
+// inputs
+
+void property_list(tree_writer& out, const chain::input& tx_input)
+{
+    // This does not support pay_multisig or pay_public_key (nonstandard).
+    // This will have default versioning, but the address version is unused.
+    const auto address = tx_input.address();
+    const auto& prevout = tx_input.previous_output();
+
+    out.begin_object();
+
+    if (address)
+    {
+        out.write_key("address_hash");
+        out.write_value(encode_base16(address.hash()));
+    }
+
+    out.write_key("previous_output");
+    out.begin_object();
+    out.write_key("hash");
+    out.write_value(encode_hash(prevout.hash()));
+    out.write_key("index");
+    out.write_value(prevout.index());
+    out.end_object();
+    out.write_key("script");
+    out.write_value(tx_input.script().to_string(rule_fork::all_rules));
+    out.write_key("sequence");
+    out.write_value(tx_input.sequence());
+
+    if (tx_input.is_segregated())
+    {
+        out.write_key("witness");
+        out.write_value(tx_input.witness().to_string());
+    }
+
+    out.end_object();
+}
+
+void property_tree(tree_writer& out, const chain::input& tx_input)
+{
+    out.begin_object();
+    out.write_key("input");
+    property_list(out, tx_input);
+    out.end_object();
+}
+
+void property_tree(tree_writer& out, const chain::input::list& tx_inputs,
+    bool json)
+{
+    out.begin_object();
+    out.write_key("inputs");
+    write_list(out, "input", tx_inputs, json,
+        [&out](const chain::input& tx_input)
+        {
+            property_list(out, tx_input);
+        });
+    out.end_object();
+}
+
+void property_tree(tree_writer& out,
+    const std::vector<config::input>& inputs, bool json)
+{
+    out.begin_object();
+    out.write_key("inputs");
+    write_list(out, "input", inputs, json,
+        [&out](const chain::input& tx_input)
+        {
+            property_list(out, tx_input);
+        });
+    out.end_object();
+}
+
+// outputs
+
+void property_list(tree_writer& out, const chain::output& tx_output)
+{
+    // This does not support pay_multisig or pay_public_key (nonstandard).
+    // This will have default versioning, but the address version is unused.
+    const auto address = tx_output.address();
+
+    out.begin_object();
+
+    if (address)
+    {
+        out.write_key("address_hash");
+        out.write_value(encode_base16(address.hash()));
+    }
+
+    out.write_key("script");
+    out.write_value(tx_output.script().to_string(rule_fork::all_rules));
+
+    if (!address)
+    {
+        uint32_t stealth_prefix;
+        ec_compressed ephemeral_key;
+
+        if (to_stealth_prefix(stealth_prefix, tx_output.script()) &&
+            extract_ephemeral_key(ephemeral_key, tx_output.script()))
+        {
+            out.write_key("stealth");
+            out.begin_object();
+            out.write_key("prefix");
+            out.write_value(stealth_prefix);
+            out.write_key("ephemeral_public_key");
+            out.write_value(wallet::ec_public(ephemeral_key).encoded());
+            out.end_object();
+        }
+    }
+
+    out.write_key("value");
+    out.write_value(tx_output.value());
+    out.end_object();
+}
+
+void property_tree(tree_writer& out, const chain::output& tx_output)
+{
+    out.begin_object();
+    out.write_key("output");
+    property_list(out, tx_output);
+    out.end_object();
+}
+
+void property_tree(tree_writer& out, const chain::output::list& tx_outputs,
+    bool json)
+{
+    out.begin_object();
+    out.write_key("outputs");
+    write_list(out, "output", tx_outputs, json,
+        [&out](const chain::output& tx_output)
+        {
+            property_list(out, tx_output);
+        });
+    out.end_object();
+}
+
+// points
+
+void property_list(tree_writer& out, const chain::point_value& point)
+{
+    out.begin_object();
+    out.write_key("hash");
+    out.write_value(encode_hash(point.hash()));
+    out.write_key("index");
+    out.write_value(point.index());
+    out.write_key("value");
+    out.write_value(point.value());
+    out.end_object();
+}
+
+void property_tree(tree_writer& out, const chain::points_value& values,
+    bool json)
+{
+    out.begin_object();
+    out.write_key("points");
+    write_list(out, "point", values.points, json,
+        [&out](const chain::point_value& point)
+        {
+            property_list(out, point);
+        });
+    out.end_object();
+}
+
+// transactions
+
+void property_list(tree_writer& out, const config::transaction& transaction,
+    bool json)
+{
+    const chain::transaction& tx = transaction;
+
+    out.begin_object();
+    out.write_key("hash");
+    out.write_value(encode_hash(tx.hash()));
+    out.write_key("inputs");
+    write_list(out, "input", tx.inputs(), json,
+        [&out](const chain::input& tx_input)
+        {
+            property_list(out, tx_input);
+        });
+    out.write_key("lock_time");
+    out.write_value(tx.locktime());
+    out.write_key("outputs");
+    write_list(out, "output", tx.outputs(), json,
+        [&out](const chain::output& tx_output)
+        {
+            property_list(out, tx_output);
+        });
+    out.write_key("version");
+    out.write_value(tx.version());
+    out.end_object();
+}
+
+void property_tree(tree_writer& out, const config::transaction& transaction,
+    bool json)
+{
+    out.begin_object();
+    out.write_key("transaction");
+    property_list(out, transaction, json);
+    out.end_object();
+}
+
+void property_tree(tree_writer& out,
+    const std::vector<config::transaction>& transactions, bool json)
+{
+    out.begin_object();
+    out.write_key("transactions");
+    write_list(out, "transaction", transactions, json,
+        [&out, json](const config::transaction& transaction)
+        {
+            property_list(out, transaction, json);
+        });
+    out.end_object();
+}
+
+} // namespace libbitcoin
@@ -20,11 +20,9 @@
 
 #include <chrono>
 #include <cstdint>
-#include <random>
-#include <boost/thread.hpp>
+#include <thread>
 #include <bitcoin/bitcoin/utility/asio.hpp>
 #include <bitcoin/bitcoin/utility/data.hpp>
-#include <bitcoin/bitcoin/utility/thread.hpp>
 
 namespace libbitcoin {
 
@@ -49,42 +47,64 @@ void pseudo_random_fill(data_chunk& out)
     return pseudo_random::fill<data_chunk>(out);
 }
 
-static uint32_t get_clock_seed()
-{
-    const auto now = high_resolution_clock::now();
-    return static_cast<uint32_t>(now.time_since_epoch().count());
-}
+// xoshiro256
+// ----------------------------------------------------------------------------
 
-std::mt19937& pseudo_random::get_twister()
+// splitmix64 expands the seed, and cannot produce the all zero state.
+xoshiro256::xoshiro256(uint64_t seed)
 {
-    // Boost.thread will clean up the thread statics using this function.
-    const auto deleter = [](std::mt19937* twister)
+    for (auto& word: state_)
     {
-        delete twister;
-    };
+        seed += 0x9e3779b97f4a7c15;
+        auto mixed = seed;
+        mixed = (mixed ^ (mixed >> 30)) * 0xbf58476d1ce4e5b9;
+        mixed = (mixed ^ (mixed >> 27)) * 0x94d049bb133111eb;
+        word = mixed ^ (mixed >> 31);
+    }
+}
 
-    // Maintain thread static state space.
-    static boost::thread_specific_ptr<std::mt19937> twister(deleter);
+// pseudo_random
+// ----------------------------------------------------------------------------
 
-    // This is thread safe because the instance is thread static.
-    if (twister.get() == nullptr)
-    {
-        // Seed with high resolution clock.
-        twister.reset(new std::mt19937(get_clock_seed()));
-    }
+// Threads seeded in the same clock tick are distinguished by thread id.
+static uint64_t get_seed()
+{
+    const auto now = high_resolution_clock::now();
+    const auto ticks = static_cast<uint64_t>(now.time_since_epoch().count());
+    const auto thread = std::hash<std::thread::id>()(std::this_thread::get_id());
+    return ticks ^ (static_cast<uint64_t>(thread) * 0x9e3779b97f4a7c15);
+}
 
-    return *twister;
+xoshiro256& pseudo_random::get_engine()
+{
+    // This is thread safe because the instance is thread static.
+    static thread_local xoshiro256 engine(get_seed());
+    return engine;
 }
 
 uint64_t pseudo_random::next()
 {
-    return next(0, max_uint64);
+    return get_engine()();
 }
 
+// Rejection of the low (2^64 % range) values makes the modulo unbiased.
 uint64_t pseudo_random::next(uint64_t begin, uint64_t end)
 {
-    std::uniform_int_distribution<uint64_t> distribution(begin, end);
-    return distribution(get_twister());
+    auto& engine = get_engine();
+
+    if (begin == 0 && end == max_uint64)
+        return engine();
+
+    const auto range = end - begin + 1;
+    const auto threshold = (0 - range) % range;
+
+    uint64_t value;
+    do
+    {
+        value = engine();
+    } while (value < threshold);
+
+    return begin + value % range;
 }
 
 asio::duration pseudo_randomize(const asio::duration& expiration,
@@ -0,0 +1,206 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/utility/rolling_bloom_filter.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/math/siphash.hpp>
+#include <bitcoin/bitcoin/message/inventory.hpp>
+#include <bitcoin/bitcoin/message/inventory_vector.hpp>
+#include <bitcoin/bitcoin/utility/assert.hpp>
+#include <bitcoin/bitcoin/utility/pseudo_random.hpp>
+
+namespace libbitcoin {
+
+using namespace bc::message;
+
+static constexpr size_t maximum_hash_functions = 50;
+static constexpr size_t generations = 3;
+static constexpr size_t bits_per_word = 64;
+
+// The number of hash functions that minimizes the size for the rate.
+static size_t to_hash_functions(double false_positive_rate)
+{
+    const auto count = std::lround(-std::log2(false_positive_rate));
+    return std::max(size_t{ 1 }, std::min(maximum_hash_functions,
+        static_cast<size_t>(std::max(count, 0l))));
+}
+
+// The bits for the rate with the hash functions, at three generations
+// (one more than the capacity, as the oldest may be partly cleared).
+static size_t to_words(size_t generation_size, size_t hash_functions,
+    double false_positive_rate)
+{
+    const auto elements = static_cast<double>(generations * generation_size);
+    const auto functions = static_cast<double>(hash_functions);
+    const auto bits = std::ceil(-functions * elements / std::log(1.0 -
+        std::exp(std::log(false_positive_rate) / functions)));
+
+    // Each position is a pair of words, holding the two generation bits.
+    const auto pairs = (static_cast<size_t>(bits) + bits_per_word - 1) /
+        bits_per_word;
+    return std::max(size_t{ 1 }, pairs) * 2;
+}
+
+rolling_bloom_filter::rolling_bloom_filter(size_t capacity,
+    double false_positive_rate)
+  : generation_size_(std::max(size_t{ 1 }, (capacity + 1) / 2)),
+    hash_functions_(to_hash_functions(false_positive_rate)),
+    words_(to_words(generation_size_, hash_functions_, false_positive_rate),
+        0),
+    key_{ pseudo_random::next(), pseudo_random::next() },
+    inserted_(0),
+    generation_(1)
+{
+    BITCOIN_ASSERT(false_positive_rate > 0.0 && false_positive_rate < 1.0);
+}
+
+// Hashing.
+//-----------------------------------------------------------------------------
+
+uint64_t rolling_bloom_filter::to_hash(const hash_digest& hash) const
+{
+    return siphash13(key_, hash);
+}
+
+// Each function is h1 + n * h2 of the halves of one hash (Kirsch and
+// Mitzenmacher). The low six bits select the bit and the value (scaled
+// without division) selects the pair of words.
+static inline void to_position(size_t& out_word, size_t& out_bit,
+    uint64_t value, size_t function, size_t pairs)
+{
+    const auto mixed = static_cast<uint32_t>(value) +
+        static_cast<uint32_t>(function) *
+        (static_cast<uint32_t>(value >> 32) | 1u);
+    out_word = 2 * static_cast<size_t>(
+        (static_cast<uint64_t>(mixed) * pairs) >> 32);
+    out_bit = mixed % bits_per_word;
+}
+
+// Insertion.
+//-----------------------------------------------------------------------------
+
+void rolling_bloom_filter::insert(const hash_digest& hash)
+{
+    if (inserted_ == generation_size_)
+        advance();
+
+    ++inserted_;
+    const auto value = to_hash(hash);
+    const auto pairs = words_.size() / 2;
+    const uint64_t low = generation_ & 1;
+    const uint64_t high = generation_ >> 1;
+
+    for (size_t function = 0; function < hash_functions_; ++function)
+    {
+        size_t word, bit;
+        to_position(word, bit, value, function, pairs);
+        const auto mask = ~(uint64_t{ 1 } << bit);
+        words_[word] = (words_[word] & mask) | (low << bit);
+        words_[word + 1] = (words_[word + 1] & mask) | (high << bit);
+    }
+}
+
+void rolling_bloom_filter::insert(const inventory& inventory)
+{
+    for (const auto& vector: inventory.inventories())
+        insert(vector.hash());
+}
+
+// Start the next generation (1, 2, 3, 1...), clearing each bit of the
+// oldest, which has the number of the next.
+void rolling_bloom_filter::advance()
+{
+    inserted_ = 0;
+    generation_ = generation_ == generations ? 1 : generation_ + 1;
+    const uint64_t low = 0 - uint64_t{ generation_ & 1 };
+    const uint64_t high = 0 - uint64_t{ generation_ >> 1 };
+
+    for (size_t word = 0; word < words_.size(); word += 2)
+    {
+        const auto first = words_[word];
+        const auto second = words_[word + 1];
+        const auto retained = (first ^ low) | (second ^ high);
+        words_[word] = first & retained;
+        words_[word + 1] = second & retained;
+    }
+}
+
+// Queries.
+//-----------------------------------------------------------------------------
+
+bool rolling_bloom_filter::contains(const hash_digest& hash) const
+{
+    const auto value = to_hash(hash);
+    const auto pairs = words_.size() / 2;
+
+    for (size_t function = 0; function < hash_functions_; ++function)
+    {
+        size_t word, bit;
+        to_position(word, bit, value, function, pairs);
+
+        if ((((words_[word] | words_[word + 1]) >> bit) & 1) == 0)
+            return false;
+    }
+
+    return true;
+}
+
+bool rolling_bloom_filter::contains(const inventory_vector& inventory) const
+{
+    return contains(inventory.hash());
+}
+
+inventory_vector::list rolling_bloom_filter::unknown(
+    const inventory& inventory) const
+{
+    inventory_vector::list out;
+
+    for (const auto& vector: inventory.inventories())
+        if (!contains(vector.hash()))
+            out.push_back(vector);
+
+    return out;
+}
+
+void rolling_bloom_filter::clear()
+{
+    std::fill(words_.begin(), words_.end(), 0);
+    key_ = { pseudo_random::next(), pseudo_random::next() };
+    inserted_ = 0;
+    generation_ = 1;
+}
+
+// Properties.
+//-----------------------------------------------------------------------------
+
+size_t rolling_bloom_filter::hash_functions() const
+{
+    return hash_functions_;
+}
+
+size_t rolling_bloom_filter::allocated() const
+{
+    return words_.size() * sizeof(uint64_t);
+}
+
+} // namespace libbitcoin
@@ -0,0 +1,256 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/utility/send_queue.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/utility/asio.hpp>
+#include <bitcoin/bitcoin/utility/deadline.hpp>
+#include <bitcoin/bitcoin/utility/socket.hpp>
+#include <bitcoin/bitcoin/utility/thread.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
+
+namespace libbitcoin {
+
+using namespace std::placeholders;
+
+#ifdef TCP_CORK
+typedef boost::asio::detail::socket_option::boolean<IPPROTO_TCP, TCP_CORK>
+    tcp_cork;
+#endif
+
+// Socket options are set on the first write, once the socket is connected.
+// Handling socket error codes creates exception safety.
+static void set_no_delay(asio::socket& socket, bool value)
+{
+    boost_code ignore;
+    socket.set_option(asio::tcp::no_delay(value), ignore);
+}
+
+static void set_cork(asio::socket& socket, bool value)
+{
+#ifdef TCP_CORK
+    boost_code ignore;
+    socket.set_option(tcp_cork(value), ignore);
+#endif
+}
+
+send_queue::send_queue(threadpool& pool, socket::ptr socket)
+  : send_queue(pool, socket, policy())
+{
+}
+
+send_queue::send_queue(threadpool& pool, socket::ptr socket,
+    const policy& policy)
+  : socket_(socket),
+    policy_(policy),
+    timer_(std::make_shared<deadline>(pool, policy.cork_latency)),
+    pending_bytes_(0),
+    writes_(0),
+    configured_(false),
+    armed_(false),
+    stopped_(false)
+{
+}
+
+void send_queue::send(const buffer& message, storage_ptr storage,
+    handler handle)
+{
+    send(message, buffer(), storage, handle);
+}
+
+void send_queue::send(const buffer& heading, const buffer& payload,
+    storage_ptr storage, handler handle)
+{
+    auto arm = false;
+
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    mutex_.lock();
+
+    if (stopped_)
+    {
+        mutex_.unlock();
+        //---------------------------------------------------------------------
+        handle(error::channel_stopped);
+        return;
+    }
+
+    pending_.push_back({ heading, payload, storage, handle });
+    pending_bytes_ += boost::asio::buffer_size(heading) +
+        boost::asio::buffer_size(payload);
+
+    if (writing_.empty())
+    {
+        if (pending_bytes_ >= policy_.cork_bytes)
+            write();
+        else if (!armed_)
+            arm = armed_ = true;
+    }
+
+    mutex_.unlock();
+    ///////////////////////////////////////////////////////////////////////////
+
+    // The timer invokes the handler on the pool, never within this call.
+    if (arm)
+        timer_->start(std::bind(&send_queue::handle_cork,
+            shared_from_this(), _1));
+}
+
+void send_queue::flush()
+{
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    unique_lock lock(mutex_);
+
+    if (!stopped_ && writing_.empty() && !pending_.empty())
+        write();
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+void send_queue::stop()
+{
+    entries failed;
+
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    mutex_.lock();
+
+    stopped_ = true;
+    failed.swap(pending_);
+    pending_bytes_ = 0;
+
+    mutex_.unlock();
+    ///////////////////////////////////////////////////////////////////////////
+
+    timer_->stop();
+    notify(failed, error::channel_stopped);
+}
+
+size_t send_queue::pending_bytes() const
+{
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    shared_lock lock(mutex_);
+
+    return pending_bytes_;
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+size_t send_queue::writes() const
+{
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    shared_lock lock(mutex_);
+
+    return writes_;
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+// private
+//-----------------------------------------------------------------------------
+
+void send_queue::notify(const entries& list, const code& ec)
+{
+    for (const auto& entry: list)
+        entry.handle(ec);
+}
+
+// The pending messages become the outstanding write, gathered in order.
+// This must be called under the lock, the write never completes within it.
+void send_queue::write()
+{
+    auto& socket = socket_->get();
+
+    if (!configured_)
+    {
+        configured_ = true;
+        set_no_delay(socket, policy_.no_delay);
+    }
+
+    if (policy_.tcp_cork)
+        set_cork(socket, true);
+
+    writing_.swap(pending_);
+    pending_bytes_ = 0;
+    buffers_.clear();
+
+    for (const auto& entry: writing_)
+    {
+        if (boost::asio::buffer_size(entry.heading) != 0)
+            buffers_.push_back(entry.heading);
+
+        if (boost::asio::buffer_size(entry.payload) != 0)
+            buffers_.push_back(entry.payload);
+    }
+
+    ++writes_;
+    boost::asio::async_write(socket, buffers_,
+        std::bind(&send_queue::handle_write, shared_from_this(), _1, _2));
+}
+
+void send_queue::handle_cork(const code&)
+{
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    unique_lock lock(mutex_);
+
+    armed_ = false;
+
+    if (!stopped_ && writing_.empty() && !pending_.empty())
+        write();
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+void send_queue::handle_write(const boost_code& ec, size_t)
+{
+    entries written;
+    entries failed;
+
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    mutex_.lock();
+
+    written.swap(writing_);
+
+    if (policy_.tcp_cork)
+        set_cork(socket_->get(), false);
+
+    if (ec)
+    {
+        stopped_ = true;
+        failed.swap(pending_);
+        pending_bytes_ = 0;
+    }
+
+    // Messages queued during the write have waited for it, so are not held.
+    else if (!stopped_ && !pending_.empty())
+        write();
+
+    mutex_.unlock();
+    ///////////////////////////////////////////////////////////////////////////
+
+    const code result = ec ? error::boost_to_error_code(ec) : error::success;
+    notify(written, result);
+    notify(failed, result);
+}
+
+} // namespace libbitcoin
@@ -18,74 +18,147 @@
  */
 #include <bitcoin/bitcoin/utility/sequencer.hpp>
 
+#include <atomic>
+#include <cstddef>
+#include <thread>
 #include <utility>
 #include <bitcoin/bitcoin/utility/asio.hpp>
 #include <bitcoin/bitcoin/utility/assert.hpp>
-#include <bitcoin/bitcoin/utility/thread.hpp>
 
 namespace libbitcoin {
 
+// The depth of nested inline invocation on this thread, across sequencers.
+static thread_local size_t inline_invocations = 0;
+
+// Counts an inline invocation for its scope, including exception unwind.
+class inline_invocation
+{
+public:
+    inline_invocation()
+    {
+        ++inline_invocations;
+    }
+
+    ~inline_invocation()
+    {
+        --inline_invocations;
+    }
+};
+
 sequencer::sequencer(asio::service& service)
-  : service_(service), executing_(false)
+  : sequencer(service, 0)
 {
 }
 
+sequencer::sequencer(asio::service& service, size_t inline_depth)
+  : service_(service),
+    inline_depth_(inline_depth),
+    count_(0),
+    head_(&stub_),
+    tail_(&stub_)
+{
+    stub_.next.store(nullptr, std::memory_order_relaxed);
+}
+
 sequencer::~sequencer()
 {
-    BITCOIN_ASSERT_MSG(actions_.empty(), "sequencer not cleared");
+    BITCOIN_ASSERT_MSG(count_ == 0, "sequencer not cleared");
+
+    // Release actions abandoned in the queue.
+    for (auto item = pop(); item != nullptr; item = pop())
+        delete item;
 }
 
 void sequencer::lock(action&& handler)
 {
-    auto post = false;
+    const auto item = new node;
+    item->handler = std::move(handler);
+    push(item);
+
+    // The locker that finds the sequence idle starts it.
+    if (count_.fetch_add(1, std::memory_order_acq_rel) == 0)
+        service_.post(next());
+}
+
+void sequencer::unlock()
+{
+    const auto prior = count_.fetch_sub(1, std::memory_order_acq_rel);
+    BITCOIN_ASSERT_MSG(prior != 0, "called unlock but sequence not locked");
+
+    // The unlocker that finds another locked action starts it.
+    if (prior > 1)
+        invoke(next());
+}
+
+// private
+//-----------------------------------------------------------------------------
+
+// Vyukov's intrusive queue, push is wait free for any number of producers.
+void sequencer::push(node* item)
+{
+    item->next.store(nullptr, std::memory_order_relaxed);
+    const auto prior = head_.exchange(item, std::memory_order_acq_rel);
+    prior->next.store(item, std::memory_order_release);
+}
 
-    // Critical Section
-    ///////////////////////////////////////////////////////////////////////
-    mutex_.lock();
+// Returns nullptr if empty or if the last push is not yet linked.
+sequencer::node* sequencer::pop()
+{
+    auto tail = tail_;
+    auto next = tail->next.load(std::memory_order_acquire);
 
-    if (executing_)
+    if (tail == &stub_)
     {
-        actions_.push(std::move(handler));
+        if (next == nullptr)
+            return nullptr;
+
+        tail_ = next;
+        tail = next;
+        next = next->next.load(std::memory_order_acquire);
     }
-    else
+
+    if (next != nullptr)
     {
-        post = true;
-        executing_ = true;
+        tail_ = next;
+        return tail;
     }
 
-    mutex_.unlock();
-    ///////////////////////////////////////////////////////////////////////
+    if (tail != head_.load(std::memory_order_acquire))
+        return nullptr;
 
-    if (post)
-        service_.post(std::move(handler));
+    // Requeue the stub so that the last item can be detached.
+    push(&stub_);
+    next = tail->next.load(std::memory_order_acquire);
+
+    if (next == nullptr)
+        return nullptr;
+
+    tail_ = next;
+    return tail;
 }
 
-void sequencer::unlock()
+// The count guarantees a pushed action, which may be momentarily unlinked.
+sequencer::action sequencer::next()
 {
-    action handler;
-
-    // Critical Section
-    ///////////////////////////////////////////////////////////////////////
-    mutex_.lock();
+    node* item;
+    while ((item = pop()) == nullptr)
+        std::this_thread::yield();
 
-    BITCOIN_ASSERT_MSG(executing_, "called unlock but sequence not locked");
+    auto handler = std::move(item->handler);
+    delete item;
+    return handler;
+}
 
-    if (actions_.empty())
-    {
-        executing_ = false;
-    }
-    else
+void sequencer::invoke(action&& handler)
+{
+    if (inline_invocations >= inline_depth_)
     {
-        executing_ = true;
-        std::swap(handler, actions_.front());
-        actions_.pop();
+        service_.post(std::move(handler));
+        return;
     }
 
-    mutex_.unlock();
-    ///////////////////////////////////////////////////////////////////////
-
-    if (handler)
-        service_.post(std::move(handler));
+    const inline_invocation invocation;
+    handler();
 }
 
 } // namespace libbitcoin
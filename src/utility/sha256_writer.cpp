@@ -0,0 +1,50 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/utility/sha256_writer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/bitcoin/math/hash.hpp>
+
+namespace libbitcoin {
+
+void sha256_writer::reset()
+{
+    context_.reset();
+}
+
+hash_digest sha256_writer::sha256_digest()
+{
+    const auto hash = context_.digest();
+    context_.reset();
+    return hash;
+}
+
+hash_digest sha256_writer::bitcoin_digest()
+{
+    return sha256_hash(sha256_digest());
+}
+
+// protected
+void sha256_writer::update(const uint8_t* data, size_t size)
+{
+    context_.write({ data, data + size });
+}
+
+} // namespace libbitcoin
@@ -22,7 +22,9 @@
 #include <cstddef>
 #include <cstdint>
 #include <stdexcept>
+#include <string>
 #include <thread>
+#include <vector>
 
 #ifdef _MSC_VER
     #include <windows.h>
@@ -40,6 +42,15 @@
     #define THREAD_PRIORITY_LOWEST PRIO_MAX
 #endif
 
+#ifdef __linux__
+    #include <sched.h>
+    #include <sys/syscall.h>
+    #ifndef MPOL_LOCAL
+        #define MPOL_LOCAL 4
+    #endif
+    #define THREAD_NAME_LIMIT 15
+#endif
+
 namespace libbitcoin {
 
 // Privately map the class enum thread priority value to an interger.
@@ -74,6 +85,84 @@ void set_priority(thread_priority priority)
 #endif
 }
 
+// Pin the thread to the set of cores, false if unsupported or invalid.
+bool set_affinity(const std::vector<size_t>& cores)
+{
+    if (cores.empty())
+        return false;
+
+#if defined(_MSC_VER)
+    DWORD_PTR mask = 0;
+    for (const auto core: cores)
+    {
+        if (core >= sizeof(DWORD_PTR) * 8)
+            return false;
+
+        mask |= DWORD_PTR(1) << core;
+    }
+
+    return SetThreadAffinityMask(GetCurrentThread(), mask) != 0;
+#elif defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (const auto core: cores)
+    {
+        if (core >= CPU_SETSIZE)
+            return false;
+
+        CPU_SET(core, &set);
+    }
+
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    return false;
+#endif
+}
+
+// Allocate from the node of the executing core, false if unsupported.
+// Windows allocates from the ideal (local) node by default.
+bool set_numa_local()
+{
+#if defined(__linux__) && defined(SYS_set_mempolicy)
+    return syscall(SYS_set_mempolicy, MPOL_LOCAL, nullptr, 0) == 0;
+#else
+    return false;
+#endif
+}
+
+// Name the thread for debuggers and profilers, false if unsupported.
+bool set_thread_name(const std::string& name)
+{
+#if defined(__linux__)
+    const auto truncated = name.substr(0, THREAD_NAME_LIMIT);
+    return pthread_setname_np(pthread_self(), truncated.c_str()) == 0;
+#elif defined(__APPLE__)
+    return pthread_setname_np(name.c_str()) == 0;
+#else
+    return false;
+#endif
+}
+
+// Apply the options to the current thread, spawned at the given index.
+void set_options(const thread_options& options, size_t index)
+{
+    set_priority(options.priority);
+
+    if (!options.cores.empty())
+    {
+        if (options.distribute)
+            set_affinity({ options.cores[index % options.cores.size()] });
+        else
+            set_affinity(options.cores);
+    }
+
+    if (options.numa_local)
+        set_numa_local();
+
+    if (!options.name.empty())
+        set_thread_name(options.name + std::to_string(index));
+}
+
 thread_priority priority(bool priority)
 {
     return priority ? thread_priority::high : thread_priority::normal;
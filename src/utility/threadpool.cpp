@@ -31,6 +31,12 @@ threadpool::threadpool(size_t number_threads, thread_priority priority)
     spawn(number_threads, priority);
 }
 
+threadpool::threadpool(size_t number_threads, const thread_options& options)
+  : size_(0)
+{
+    spawn(number_threads, options);
+}
+
 threadpool::~threadpool()
 {
     shutdown();
@@ -51,15 +57,23 @@ size_t threadpool::size() const
 
 // This is not thread safe.
 void threadpool::spawn(size_t number_threads, thread_priority priority)
+{
+    thread_options options;
+    options.priority = priority;
+    spawn(number_threads, options);
+}
+
+// This is not thread safe.
+void threadpool::spawn(size_t number_threads, const thread_options& options)
 {
     // This allows the pool to be restarted.
     service_.reset();
 
     for (size_t i = 0; i < number_threads; ++i)
-        spawn_once(priority);
+        spawn_once(options);
 }
 
-void threadpool::spawn_once(thread_priority priority)
+void threadpool::spawn_once(const thread_options& options)
 {
     ///////////////////////////////////////////////////////////////////////////
     // Critical Section
@@ -83,9 +97,11 @@ void threadpool::spawn_once(thread_priority priority)
     // Critical Section
     unique_lock lock(threads_mutex_);
 
-    threads_.push_back(asio::thread([this, priority]()
+    const auto index = threads_.size();
+
+    threads_.push_back(asio::thread([this, options, index]()
     {
-        set_priority(priority);
+        set_options(options, index);
         service_.run();
     }));
 
@@ -0,0 +1,286 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/utility/timer_wheel.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/utility/asio.hpp>
+#include <bitcoin/bitcoin/utility/assert.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
+
+namespace libbitcoin {
+
+using namespace std::placeholders;
+
+// timer
+// ----------------------------------------------------------------------------
+
+timer_wheel::timer::timer(timer_wheel& wheel)
+  : wheel_(wheel),
+    previous_(nullptr),
+    next_(nullptr),
+    slot_(0),
+    rounds_(0),
+    armed_(false)
+{
+}
+
+timer_wheel::timer::~timer()
+{
+    wheel_.cancel(*this);
+}
+
+timer_wheel& timer_wheel::timer::wheel() const
+{
+    return wheel_;
+}
+
+// timer_wheel
+// ----------------------------------------------------------------------------
+
+timer_wheel::timer_wheel(threadpool& pool, const asio::duration& resolution,
+    size_t slots)
+  : pool_(pool),
+    resolution_(std::max(resolution, asio::duration(1))),
+    start_(asio::steady_clock::now()),
+    slots_(std::max(slots, size_t(1)), nullptr),
+    next_tick_(0),
+    armed_(0),
+    stopped_(false)
+{
+    thread_.reset(new asio::thread(std::bind(&timer_wheel::run, this)));
+}
+
+timer_wheel::~timer_wheel()
+{
+    stop();
+    thread_->join();
+}
+
+timer_wheel::timer::ptr timer_wheel::create()
+{
+    return std::make_shared<timer>(*this);
+}
+
+// Each tick is a whole resolution since construction.
+uint64_t timer_wheel::current_tick() const
+{
+    return (asio::steady_clock::now() - start_) / resolution_;
+}
+
+asio::time_point timer_wheel::tick_time(uint64_t tick) const
+{
+    return start_ + resolution_ * tick;
+}
+
+// An entry visits its slot every slots_.size() ticks, and expires on the
+// visit at which it has no remaining rounds.
+void timer_wheel::link(timer& entry, uint64_t tick)
+{
+    BITCOIN_ASSERT(tick >= next_tick_);
+    const auto slot = static_cast<size_t>(tick % slots_.size());
+    auto& head = slots_[slot];
+
+    entry.slot_ = slot;
+    entry.rounds_ = (tick - next_tick_) / slots_.size();
+    entry.previous_ = nullptr;
+    entry.next_ = head;
+    entry.armed_ = true;
+
+    if (head != nullptr)
+        head->previous_ = &entry;
+
+    head = &entry;
+    ++armed_;
+}
+
+void timer_wheel::unlink(timer& entry)
+{
+    if (entry.previous_ == nullptr)
+        slots_[entry.slot_] = entry.next_;
+    else
+        entry.previous_->next_ = entry.next_;
+
+    if (entry.next_ != nullptr)
+        entry.next_->previous_ = entry.previous_;
+
+    entry.previous_ = nullptr;
+    entry.next_ = nullptr;
+    entry.armed_ = false;
+    --armed_;
+}
+
+void timer_wheel::arm(timer& entry, handler&& handle,
+    const asio::duration& duration)
+{
+    // Round up to whole ticks, expiring no sooner than the next tick.
+    const auto ticks = std::max(uint64_t(1),
+        uint64_t((duration + resolution_ - asio::duration(1)) / resolution_));
+
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    if (stopped_)
+        return;
+
+    if (entry.armed_)
+        unlink(entry);
+
+    // An idle wheel skips to the current tick, there is nothing to expire.
+    const auto now = current_tick();
+    const auto idle = (armed_ == 0);
+
+    if (idle)
+        next_tick_ = std::max(next_tick_, now);
+
+    entry.handler_ = std::move(handle);
+    link(entry, std::max(now + ticks, next_tick_));
+    lock.unlock();
+    ///////////////////////////////////////////////////////////////////////////
+
+    // The tick thread waits indefinitely only when idle.
+    if (idle)
+        wake_.notify_one();
+}
+
+void timer_wheel::cancel(timer& entry)
+{
+    handler discarded;
+
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    if (!entry.armed_)
+        return;
+
+    unlink(entry);
+
+    // The handler may own the entry, so it is destroyed outside of the lock.
+    discarded = std::move(entry.handler_);
+    entry.handler_ = nullptr;
+    lock.unlock();
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+void timer_wheel::stop()
+{
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    std::unique_lock<std::mutex> lock(mutex_);
+    stopped_ = true;
+    lock.unlock();
+    ///////////////////////////////////////////////////////////////////////////
+
+    wake_.notify_one();
+}
+
+size_t timer_wheel::armed() const
+{
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    std::lock_guard<std::mutex> lock(mutex_);
+    return armed_;
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+// Call only while holding the mutex.
+void timer_wheel::expire(uint64_t tick, handlers& expired)
+{
+    auto entry = slots_[tick % slots_.size()];
+
+    while (entry != nullptr)
+    {
+        const auto next = entry->next_;
+
+        if (entry->rounds_ == 0)
+        {
+            unlink(*entry);
+            expired.push_back(std::move(entry->handler_));
+            entry->handler_ = nullptr;
+        }
+        else
+        {
+            --entry->rounds_;
+        }
+
+        entry = next;
+    }
+}
+
+void timer_wheel::run()
+{
+    handlers expired;
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (!stopped_)
+    {
+        if (armed_ == 0)
+        {
+            wake_.wait(lock);
+            continue;
+        }
+
+        if (next_tick_ > current_tick())
+        {
+            wake_.wait_until(lock, tick_time(next_tick_));
+            continue;
+        }
+
+        // Catch up on all elapsed ticks.
+        const auto now = current_tick();
+        while (next_tick_ <= now && armed_ != 0)
+            expire(next_tick_++, expired);
+
+        if (armed_ == 0)
+            next_tick_ = now + 1;
+
+        lock.unlock();
+        //---------------------------------------------------------------------
+        for (auto& handle: expired)
+            pool_.service().post(std::bind(std::move(handle),
+                error::success));
+
+        expired.clear();
+        lock.lock();
+    }
+
+    // Discard armed handlers, which may own entries, outside of the lock.
+    handlers discarded;
+    for (auto& head: slots_)
+    {
+        while (head != nullptr)
+        {
+            discarded.push_back(std::move(head->handler_));
+            head->handler_ = nullptr;
+            unlink(*head);
+        }
+    }
+
+    lock.unlock();
+}
+
+} // namespace libbitcoin
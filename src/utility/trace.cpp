@@ -0,0 +1,332 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/utility/trace.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+    #include <pthread.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+namespace libbitcoin {
+
+typedef trace_events::event event;
+
+// Events are written only by the owning thread and published by the count.
+// A clear advances the generation, which the owner applies on its next span.
+struct trace_buffer
+{
+    trace_buffer(size_t capacity, uint64_t thread, std::string&& name)
+      : events(capacity),
+        count(0),
+        dropped(0),
+        generation(0),
+        thread(thread),
+        name(std::move(name))
+    {
+    }
+
+    std::vector<event> events;
+    std::atomic<size_t> count;
+    std::atomic<size_t> dropped;
+    std::atomic<size_t> generation;
+    const uint64_t thread;
+    const std::string name;
+};
+
+struct trace_state
+{
+    trace_state()
+      : capacity(trace_events::default_capacity),
+        generation(0),
+        epoch(std::chrono::steady_clock::now())
+    {
+    }
+
+    // These are protected by mutex.
+    std::vector<std::unique_ptr<trace_buffer>> buffers;
+    std::set<std::string> names;
+    std::mutex mutex;
+
+    std::atomic<size_t> capacity;
+    std::atomic<size_t> generation;
+    const std::chrono::steady_clock::time_point epoch;
+};
+
+std::atomic<bool> trace_events::recording_(false);
+
+// Function static, as spans may be recorded during static initialization.
+static trace_state& state()
+{
+    static trace_state instance;
+    return instance;
+}
+
+// The thread identity, the kernel thread id where available.
+static uint64_t thread_id(size_t index)
+{
+#if defined(__linux__) && defined(SYS_gettid)
+    const auto id = syscall(SYS_gettid);
+    if (id > 0)
+        return static_cast<uint64_t>(id);
+#endif
+    return index + 1;
+}
+
+static std::string thread_name(size_t index)
+{
+#if defined(__linux__)
+    char name[16] = { 0 };
+    if (pthread_getname_np(pthread_self(), name, sizeof(name)) == 0 &&
+        name[0] != 0)
+        return name;
+#endif
+    return "thread " + std::to_string(index + 1);
+}
+
+static trace_buffer& register_thread()
+{
+    auto& trace = state();
+
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    std::lock_guard<std::mutex> lock(trace.mutex);
+    const auto index = trace.buffers.size();
+    trace.buffers.emplace_back(new trace_buffer(trace.capacity.load(),
+        thread_id(index), thread_name(index)));
+
+    auto& buffer = *trace.buffers.back();
+    buffer.generation.store(trace.generation.load());
+    return buffer;
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+// Buffers are retained after thread exit so that their spans are exported.
+static trace_buffer& local_buffer()
+{
+    static thread_local trace_buffer* buffer = nullptr;
+
+    if (buffer == nullptr)
+        buffer = &register_thread();
+
+    return *buffer;
+}
+
+// Microseconds with nanosecond fraction, as expected by the format.
+static void write_microseconds(std::ostream& out, uint64_t nanoseconds)
+{
+    out << (nanoseconds / 1000) << '.' << std::setw(3) << std::setfill('0')
+        << (nanoseconds % 1000) << std::setfill(' ');
+}
+
+static void write_string(std::ostream& out, const char* text)
+{
+    static const char hex[] = "0123456789abcdef";
+    out << '"';
+
+    for (; *text != 0; ++text)
+    {
+        const auto character = static_cast<unsigned char>(*text);
+
+        if (character == '"' || character == '\\')
+            out << '\\' << *text;
+        else if (character < 0x20)
+            out << "\\u00" << hex[character >> 4] << hex[character & 0x0f];
+        else
+            out << *text;
+    }
+
+    out << '"';
+}
+
+void trace_events::start(size_t capacity)
+{
+    state().capacity.store(capacity);
+    recording_.store(true);
+}
+
+void trace_events::stop()
+{
+    recording_.store(false);
+}
+
+void trace_events::clear()
+{
+    state().generation.fetch_add(1);
+}
+
+uint64_t trace_events::now()
+{
+    const auto elapsed = std::chrono::steady_clock::now() - state().epoch;
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+        .count();
+}
+
+void trace_events::record(const char* category, const char* name,
+    uint64_t begin, uint64_t end)
+{
+    auto& buffer = local_buffer();
+    const auto generation = state().generation.load(
+        std::memory_order_acquire);
+
+    // Apply a clear, before the reset is published by the generation.
+    if (buffer.generation.load(std::memory_order_relaxed) != generation)
+    {
+        buffer.count.store(0, std::memory_order_relaxed);
+        buffer.dropped.store(0, std::memory_order_relaxed);
+        buffer.generation.store(generation, std::memory_order_release);
+    }
+
+    const auto count = buffer.count.load(std::memory_order_relaxed);
+
+    if (count == buffer.events.size())
+    {
+        buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    buffer.events[count] = { category, name, begin, end };
+    buffer.count.store(count + 1, std::memory_order_release);
+}
+
+const char* trace_events::intern(const std::string& name)
+{
+    auto& trace = state();
+
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    std::lock_guard<std::mutex> lock(trace.mutex);
+    return trace.names.insert(name).first->c_str();
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+// Buffers not yet advanced to the current generation hold no current spans.
+template <typename Function>
+static void current_buffers(Function function)
+{
+    auto& trace = state();
+
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    std::lock_guard<std::mutex> lock(trace.mutex);
+    const auto generation = trace.generation.load(std::memory_order_acquire);
+
+    for (const auto& buffer: trace.buffers)
+        if (buffer->generation.load(std::memory_order_acquire) == generation)
+            function(*buffer);
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+size_t trace_events::size()
+{
+    size_t total = 0;
+    current_buffers([&total](const trace_buffer& buffer)
+    {
+        total += buffer.count.load(std::memory_order_acquire);
+    });
+
+    return total;
+}
+
+size_t trace_events::dropped()
+{
+    size_t total = 0;
+    current_buffers([&total](const trace_buffer& buffer)
+    {
+        total += buffer.dropped.load(std::memory_order_relaxed);
+    });
+
+    return total;
+}
+
+void trace_events::write(std::ostream& out)
+{
+    // Copy the published spans, so the registry is not locked while writing.
+    struct thread_events
+    {
+        uint64_t thread;
+        std::string name;
+        std::vector<event> events;
+    };
+
+    std::vector<thread_events> threads;
+    size_t dropped = 0;
+
+    current_buffers([&threads, &dropped](const trace_buffer& buffer)
+    {
+        const auto count = buffer.count.load(std::memory_order_acquire);
+        const auto begin = buffer.events.begin();
+        dropped += buffer.dropped.load(std::memory_order_relaxed);
+        threads.push_back({ buffer.thread, buffer.name,
+            { begin, begin + count } });
+    });
+
+    auto first = true;
+    const auto separate = [&out, &first]()
+    {
+        out << (first ? "\n" : ",\n");
+        first = false;
+    };
+
+    out << "{\"displayTimeUnit\":\"ns\",\"otherData\":{\"dropped\":"
+        << dropped << "},\"traceEvents\":[";
+
+    for (const auto& thread: threads)
+    {
+        separate();
+        out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+            << thread.thread << ",\"args\":{\"name\":";
+        write_string(out, thread.name.c_str());
+        out << "}}";
+    }
+
+    for (const auto& thread: threads)
+    {
+        for (const auto& span: thread.events)
+        {
+            separate();
+            out << "{\"name\":";
+            write_string(out, span.name);
+            out << ",\"cat\":";
+            write_string(out, span.category);
+            out << ",\"ph\":\"X\",\"ts\":";
+            write_microseconds(out, span.begin);
+            out << ",\"dur\":";
+            write_microseconds(out, span.end - span.begin);
+            out << ",\"pid\":1,\"tid\":" << thread.thread << "}";
+        }
+    }
+
+    out << "\n]}\n";
+}
+
+} // namespace libbitcoin
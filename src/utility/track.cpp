@@ -0,0 +1,94 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/utility/track.hpp>
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <bitcoin/bitcoin/log/metrics.hpp>
+
+using namespace bc::log;
+
+typedef std::map<std::string, std::unique_ptr<track_counters>> counters_map;
+
+// Function statics, as tracked objects may be constructed during static
+// initialization.
+static counters_map& registry()
+{
+    static counters_map instance;
+    return instance;
+}
+
+static std::mutex& registry_mutex()
+{
+    static std::mutex instance;
+    return instance;
+}
+
+track_counters::track_counters()
+  : live(0), total(0)
+{
+}
+
+track_counters& track_registry::counters(const std::string& class_name)
+{
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    std::lock_guard<std::mutex> lock(registry_mutex());
+    auto& counters = registry()[class_name];
+
+    if (!counters)
+        counters.reset(new track_counters);
+
+    return *counters;
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+track_registry::snapshot track_registry::counts()
+{
+    snapshot out;
+
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    std::lock_guard<std::mutex> lock(registry_mutex());
+    out.reserve(registry().size());
+
+    for (const auto& entry: registry())
+        out.push_back(
+        {
+            entry.first,
+            entry.second->live.load(std::memory_order_relaxed),
+            entry.second->total.load(std::memory_order_relaxed)
+        });
+
+    return out;
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+void track_registry::publish(metrics& metrics)
+{
+    for (const auto& entry: counts())
+    {
+        const auto name = "track." + entry.class_name;
+        metrics.get_gauge(name + ".live").set(entry.live);
+        metrics.get_gauge(name + ".total").set(entry.total);
+    }
+}
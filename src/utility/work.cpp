@@ -18,48 +18,153 @@
  */
 #include <bitcoin/bitcoin/utility/work.hpp>
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 #include <bitcoin/bitcoin/utility/delegates.hpp>
+#include <bitcoin/bitcoin/utility/monitor.hpp>
 #include <bitcoin/bitcoin/utility/threadpool.hpp>
+#include <bitcoin/bitcoin/utility/work_stealing_pool.hpp>
 
 namespace libbitcoin {
 
+// The number of keyed strands, independent of the number of threads.
+static constexpr size_t keyed_shards = 16;
+
+// Fibonacci hashing spreads keys with poor low bits, such as pointers.
+static constexpr uint64_t golden_ratio = 0x9e3779b97f4a7c15;
+
+std::vector<work::shard> work::to_shards(asio::service& service,
+    const std::string& name)
+{
+    std::vector<shard> shards;
+    shards.reserve(keyed_shards);
+
+    for (size_t index = 0; index < keyed_shards; ++index)
+        shards.push_back({ asio::service::strand(service),
+            std::make_shared<monitor>(name + "_" KEYED "_" +
+                std::to_string(index)) });
+
+    return shards;
+}
+
 work::work(threadpool& pool, const std::string& name)
   : name_(name),
-    ////ordered_(std::make_shared<monitor::count>(0)),
-    ////unordered_(std::make_shared<monitor::count>(0)),
-    ////concurrent_(std::make_shared<monitor::count>(0)),
-    ////sequential_(std::make_shared<monitor::count>(0)),
+    ordered_(std::make_shared<monitor>(name + "_" ORDERED)),
+    unordered_(std::make_shared<monitor>(name + "_" UNORDERED)),
+    concurrent_(std::make_shared<monitor>(name + "_" CONCURRENT)),
+    sequential_(std::make_shared<monitor>(name + "_" SEQUENCE)),
+    service_(pool.service()),
+    executor_(nullptr),
+    strand_(service_),
+    sequence_(service_),
+    shards_(to_shards(service_, name))
+{
+}
+
+work::work(threadpool& pool, work_stealing_pool& executor,
+    const std::string& name)
+  : name_(name),
+    ordered_(std::make_shared<monitor>(name + "_" ORDERED)),
+    unordered_(std::make_shared<monitor>(name + "_" UNORDERED)),
+    concurrent_(std::make_shared<monitor>(name + "_" CONCURRENT)),
+    sequential_(std::make_shared<monitor>(name + "_" SEQUENCE)),
     service_(pool.service()),
+    executor_(&executor),
     strand_(service_),
-    sequence_(service_)
-{
-}
-
-////size_t work::ordered_backlog()
-////{
-////    return ordered_->load();
-////}
-////
-////size_t work::unordered_backlog()
-////{
-////    return unordered_->load();
-////}
-////
-////size_t work::concurrent_backlog()
-////{
-////    return concurrent_->load();
-////}
-////
-////size_t work::sequential_backlog()
-////{
-////    return sequential_->load();
-////}
-////
-////size_t work::combined_backlog()
-////{
-////    return ordered_backlog() + unordered_backlog() + concurrent_backlog();
-////}
+    sequence_(service_),
+    shards_(to_shards(service_, name))
+{
+}
+
+size_t work::ordered_backlog() const
+{
+    return ordered_->backlog();
+}
+
+size_t work::unordered_backlog() const
+{
+    return unordered_->backlog();
+}
+
+size_t work::concurrent_backlog() const
+{
+    return concurrent_->backlog();
+}
+
+size_t work::sequential_backlog() const
+{
+    return sequential_->backlog();
+}
+
+size_t work::keyed_backlog() const
+{
+    size_t backlog = 0;
+
+    for (const auto& shard: shards_)
+        backlog += shard.counter->backlog();
+
+    return backlog;
+}
+
+size_t work::combined_backlog() const
+{
+    return ordered_backlog() + unordered_backlog() + concurrent_backlog() +
+        sequential_backlog() + keyed_backlog();
+}
+
+size_t work::shards() const
+{
+    return shards_.size();
+}
+
+size_t work::keyed_backlog(size_t shard) const
+{
+    return shards_[shard].counter->backlog();
+}
+
+size_t work::to_shard(size_t hash) const
+{
+    const auto mixed = static_cast<uint64_t>(hash) * golden_ratio;
+    return static_cast<size_t>(mixed >> 32) % shards_.size();
+}
+
+const monitor& work::ordered_metrics() const
+{
+    return *ordered_;
+}
+
+const monitor& work::unordered_metrics() const
+{
+    return *unordered_;
+}
+
+const monitor& work::concurrent_metrics() const
+{
+    return *concurrent_;
+}
+
+const monitor& work::sequential_metrics() const
+{
+    return *sequential_;
+}
+
+const monitor& work::keyed_metrics(size_t shard) const
+{
+    return *shards_[shard].counter;
+}
+
+void work::publish(const std::string& prefix) const
+{
+    ordered_->publish(prefix);
+    unordered_->publish(prefix);
+    concurrent_->publish(prefix);
+    sequential_->publish(prefix);
+
+    for (const auto& shard: shards_)
+        shard.counter->publish(prefix);
+}
 
 } // namespace libbitcoin
@@ -0,0 +1,221 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/utility/work_stealing_pool.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <bitcoin/bitcoin/utility/asio.hpp>
+#include <bitcoin/bitcoin/utility/assert.hpp>
+#include <bitcoin/bitcoin/utility/thread.hpp>
+
+namespace libbitcoin {
+
+work_stealing_pool::work_stealing_pool(size_t number_threads,
+    thread_priority priority)
+  : next_(0),
+    pending_(0),
+    sleeping_(0),
+    stopped_(false),
+    aborted_(false)
+{
+    // All queues must exist before any thread may attempt to steal.
+    for (size_t index = 0; index < number_threads; ++index)
+        queues_.emplace_back(new queue);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Critical Section
+    unique_lock lock(threads_mutex_);
+
+    for (size_t index = 0; index < number_threads; ++index)
+        threads_.push_back(asio::thread([this, index, priority]()
+        {
+            run(index, priority);
+        }));
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+work_stealing_pool::~work_stealing_pool()
+{
+    shutdown();
+    join();
+}
+
+bool work_stealing_pool::empty() const
+{
+    return size() == 0;
+}
+
+size_t work_stealing_pool::size() const
+{
+    return queues_.size();
+}
+
+void work_stealing_pool::post(handler job)
+{
+    if (queues_.empty())
+        return;
+
+    // A pool thread queues to itself, otherwise distribute round robin.
+    const auto self = index_.get();
+    const auto index = self != nullptr ? *self :
+        next_.fetch_add(1) % queues_.size();
+
+    // Count before queueing so that a taken job is always counted.
+    ++pending_;
+    auto& target = *queues_[index];
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Critical Section
+    {
+        std::lock_guard<std::mutex> lock(target.mutex);
+        target.jobs.push_back(std::move(job));
+    }
+    ///////////////////////////////////////////////////////////////////////////
+
+    // The idle mutex is only taken when a thread may be sleeping.
+    if (sleeping_.load() != 0)
+        notify();
+}
+
+void work_stealing_pool::abort()
+{
+    aborted_.store(true);
+    notify();
+}
+
+void work_stealing_pool::shutdown()
+{
+    stopped_.store(true);
+    notify();
+}
+
+void work_stealing_pool::join()
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Critical Section
+    unique_lock lock(threads_mutex_);
+
+    DEBUG_ONLY(const auto this_id = boost::this_thread::get_id();)
+
+    for (auto& thread: threads_)
+    {
+        BITCOIN_ASSERT(this_id != thread.get_id());
+        BITCOIN_ASSERT(thread.joinable());
+        thread.join();
+    }
+
+    threads_.clear();
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+void work_stealing_pool::notify()
+{
+    // Taking the mutex orders the notification after any sleeper's predicate.
+    std::lock_guard<std::mutex> lock(idle_mutex_);
+    idle_.notify_all();
+}
+
+void work_stealing_pool::run(size_t index, thread_priority priority)
+{
+    set_priority(priority);
+    index_.reset(new size_t(index));
+    handler job;
+
+    const auto ready = [this]()
+    {
+        return aborted_.load() || stopped_.load() || pending_.load() != 0;
+    };
+
+    while (!aborted_.load())
+    {
+        if (pop(index, job) || steal(index, job))
+        {
+            --pending_;
+            job();
+            job = nullptr;
+            continue;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Critical Section
+        std::unique_lock<std::mutex> lock(idle_mutex_);
+
+        if (stopped_.load() && pending_.load() == 0)
+            break;
+
+        // Sleeping is counted before the predicate is tested, so a poster
+        // either observes the sleeper or the sleeper observes the job.
+        ++sleeping_;
+        idle_.wait(lock, ready);
+        --sleeping_;
+        ///////////////////////////////////////////////////////////////////////
+    }
+
+    index_.reset();
+}
+
+// The owning thread takes its most recent job, for cache locality.
+bool work_stealing_pool::pop(size_t index, handler& out)
+{
+    auto& own = *queues_[index];
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Critical Section
+    std::lock_guard<std::mutex> lock(own.mutex);
+
+    if (own.jobs.empty())
+        return false;
+
+    out = std::move(own.jobs.back());
+    own.jobs.pop_back();
+    return true;
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+// Other threads take the oldest job, starting from the next deque.
+bool work_stealing_pool::steal(size_t index, handler& out)
+{
+    const auto count = queues_.size();
+
+    for (size_t offset = 1; offset < count; ++offset)
+    {
+        auto& other = *queues_[(index + offset) % count];
+
+        ///////////////////////////////////////////////////////////////////////
+        // Critical Section
+        std::unique_lock<std::mutex> lock(other.mutex, std::try_to_lock);
+
+        if (!lock.owns_lock() || other.jobs.empty())
+            continue;
+
+        out = std::move(other.jobs.front());
+        other.jobs.pop_front();
+        return true;
+        ///////////////////////////////////////////////////////////////////////
+    }
+
+    return false;
+}
+
+} // namespace libbitcoin
@@ -0,0 +1,269 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/wallet/address_extractor.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include <bitcoin/bitcoin/chain/block.hpp>
+#include <bitcoin/bitcoin/chain/output.hpp>
+#include <bitcoin/bitcoin/chain/point.hpp>
+#include <bitcoin/bitcoin/chain/script.hpp>
+#include <bitcoin/bitcoin/chain/transaction.hpp>
+#include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/machine/instruction.hpp>
+#include <bitcoin/bitcoin/math/elliptic_curve.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/parallel.hpp>
+#include <bitcoin/bitcoin/wallet/ec_public.hpp>
+#include <bitcoin/bitcoin/wallet/payment_address.hpp>
+
+namespace libbitcoin {
+namespace wallet {
+
+using namespace bc::chain;
+using namespace bc::machine;
+
+// Fixed tuning parameter, transactions claimed together by a thread.
+static BC_CONSTEXPR size_t transaction_grain = 16;
+
+enum class match
+{
+    none,
+    key_hash,
+    script_hash,
+    public_key,
+    redeem_script
+};
+
+// Addressable patterns of payment_address::extract_output.
+static match match_output(data_slice& out, const data_chunk& bytes)
+{
+    if (script::is_pay_key_hash_pattern(out, bytes))
+        return match::key_hash;
+
+    if (script::is_pay_script_hash_pattern(out, bytes))
+        return match::script_hash;
+
+    // pay_public_key is not p2kh but we conflate for tracking.
+    if (script::is_pay_public_key_pattern(out, bytes))
+        return match::public_key;
+
+    return match::none;
+}
+
+// Addressable patterns of payment_address::extract_input, as matched by
+// script::input_pattern, walking the script bytes without decoding.
+static match match_input(data_slice& out, const data_chunk& bytes)
+{
+    size_t count = 0;
+    size_t position = 0;
+    auto push_only = true;
+    data_slice first(nullptr, nullptr);
+    data_slice last(nullptr, nullptr);
+
+    while (position < bytes.size())
+    {
+        const auto op = instruction::decode(bytes, position);
+        push_only &= op.is_valid() && op.is_push();
+        last = op.data(bytes);
+
+        if (count++ == 0)
+            first = last;
+    }
+
+    // sign_key_hash: <endorsement> <public key>
+    if (count == 2 && first.size() >= min_endorsement_size &&
+        first.size() <= max_endorsement_size && is_public_key(last))
+    {
+        out = last;
+        return match::public_key;
+    }
+
+    // sign_script_hash: push only, ending in a (non-empty) redeem script.
+    if (count > 0 && push_only && !last.empty())
+    {
+        out = last;
+        return match::redeem_script;
+    }
+
+    return match::none;
+}
+
+address_extractor::address_extractor(uint8_t p2kh_version,
+    uint8_t p2sh_version)
+  : p2kh_version_(p2kh_version), p2sh_version_(p2sh_version)
+{
+}
+
+address_extractor::row::list address_extractor::extract(
+    const transaction& tx) const
+{
+    row::list out;
+    extract(out, tx);
+    return out;
+}
+
+address_extractor::row::list address_extractor::extract(
+    const block& block) const
+{
+    row::list out;
+
+    for (const auto& tx: block.transactions())
+        extract(out, tx);
+
+    return out;
+}
+
+address_extractor::row::list address_extractor::extract(const block& block,
+    threadpool& pool) const
+{
+    const auto& txs = block.transactions();
+    std::vector<row::list> rows(txs.size());
+
+    const auto extract_one = [&](size_t index)
+    {
+        extract(rows[index], txs[index]);
+        return code(error::success);
+    };
+
+    parallel_for(pool, txs.size(), transaction_grain, extract_one);
+
+    size_t size = 0;
+    for (const auto& tx_rows: rows)
+        size += tx_rows.size();
+
+    row::list out;
+    out.reserve(size);
+
+    for (auto& tx_rows: rows)
+        out.insert(out.end(), std::make_move_iterator(tx_rows.begin()),
+            std::make_move_iterator(tx_rows.end()));
+
+    return out;
+}
+
+// private
+void address_extractor::extract(row::list& out,
+    const transaction& tx) const
+{
+    const auto& hash = tx.hash();
+    const auto& inputs = tx.inputs();
+    const auto& outputs = tx.outputs();
+
+    // The rows and data of the addresses hashed together in one batch.
+    std::vector<size_t> pending;
+    std::vector<data_slice> preimages;
+
+    const auto add = [&](match kind, data_slice data, uint32_t index,
+        uint64_t value, bool output)
+    {
+        switch (kind)
+        {
+            case match::key_hash:
+                out.push_back({ to_array<short_hash_size>(data),
+                    p2kh_version_, { hash, index }, value, output });
+                return;
+
+            case match::script_hash:
+                out.push_back({ to_array<short_hash_size>(data),
+                    p2sh_version_, { hash, index }, value, output });
+                return;
+
+            case match::redeem_script:
+                pending.push_back(out.size());
+                preimages.push_back(data);
+                out.push_back({ null_short_hash, p2sh_version_,
+                    { hash, index }, value, output });
+                return;
+
+            case match::public_key:
+            {
+                // A compressed key is hashed as serialized.
+                if (is_compressed_key(data))
+                {
+                    pending.push_back(out.size());
+                    preimages.push_back(data);
+                    out.push_back({ null_short_hash, p2kh_version_,
+                        { hash, index }, value, output });
+                    return;
+                }
+
+                // An uncompressed key must be a valid point.
+                const payment_address address(ec_public{ to_chunk(data) },
+                    p2kh_version_);
+
+                if (address)
+                    out.push_back({ address.hash(), p2kh_version_,
+                        { hash, index }, value, output });
+
+                return;
+            }
+
+            case match::none:
+            default:
+                return;
+        }
+    };
+
+    data_slice data(nullptr, nullptr);
+
+    for (uint32_t index = 0; index < inputs.size(); ++index)
+    {
+        const auto& input = inputs[index];
+        const auto metadata = input.previous_output().metadata.peek();
+
+        // A populated prevout identifies the address without ambiguity.
+        if (metadata != nullptr && metadata->cache.is_valid())
+        {
+            const auto& prevout = metadata->cache;
+            add(match_output(data, prevout.script().bytes()), data, index,
+                prevout.value(), false);
+        }
+        else
+        {
+            add(match_input(data, input.script().bytes()), data, index,
+                output::not_found, false);
+        }
+    }
+
+    for (uint32_t index = 0; index < outputs.size(); ++index)
+    {
+        const auto& output = outputs[index];
+        add(match_output(data, output.script().bytes()), data, index,
+            output.value(), true);
+    }
+
+    if (pending.empty())
+        return;
+
+    std::vector<short_hash> hashes(pending.size());
+    bitcoin_short_hash_batch(preimages.data(), preimages.size(),
+        hashes.data());
+
+    for (size_t position = 0; position < pending.size(); ++position)
+        out[pending[position]].hash = hashes[position];
+}
+
+} // namespace wallet
+} // namespace libbitcoin
@@ -0,0 +1,152 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/wallet/address_generator.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/formats/base_58.hpp>
+#include <bitcoin/bitcoin/math/checksum.hpp>
+#include <bitcoin/bitcoin/math/elliptic_curve.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/parallel.hpp>
+
+namespace libbitcoin {
+namespace wallet {
+
+static BC_CONSTEXPR size_t prefix_size = 1 + short_hash_size;
+
+// Batches claimed together by a thread.
+static BC_CONSTEXPR size_t batch_grain = 1;
+
+address_generator::address_generator(bool compress, uint8_t version)
+  : compress_(compress), version_(version)
+{
+}
+
+bool address_generator::generate(string_list& out,
+    const secret_list& secrets) const
+{
+    out.resize(secrets.size());
+    auto success = true;
+
+    for (size_t start = 0; start < secrets.size(); start += batch_size)
+    {
+        const auto count = std::min(batch_size, secrets.size() - start);
+        success &= generate(&out[start], &secrets[start], count);
+    }
+
+    return success;
+}
+
+bool address_generator::generate(string_list& out,
+    const secret_list& secrets, threadpool& pool) const
+{
+    out.resize(secrets.size());
+    const auto batches = (secrets.size() + batch_size - 1) / batch_size;
+    std::atomic<bool> success(true);
+
+    const auto generate_batch = [&](size_t batch)
+    {
+        const auto start = batch * batch_size;
+        const auto count = std::min(batch_size, secrets.size() - start);
+
+        if (!generate(&out[start], &secrets[start], count))
+            success.store(false, std::memory_order_relaxed);
+
+        return code(error::success);
+    };
+
+    parallel_for(pool, batches, batch_grain, generate_batch);
+    return success.load();
+}
+
+// private
+bool address_generator::generate(std::string* out, const ec_secret* secrets,
+    size_t count) const
+{
+    BITCOIN_ASSERT(count <= batch_size);
+    ec_compressed compressed[batch_size];
+    ec_uncompressed uncompressed[batch_size];
+    short_hash hashes[batch_size];
+    hash_digest checksums[batch_size];
+    payment payloads[batch_size];
+    bool valid[batch_size];
+    auto success = true;
+
+    std::vector<data_slice> slices;
+    slices.reserve(count);
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        if (compress_)
+        {
+            auto& point = compressed[index];
+            valid[index] = secret_to_public(point, secrets[index]);
+            slices.emplace_back(point);
+        }
+        else
+        {
+            auto& point = uncompressed[index];
+            valid[index] = secret_to_public(point, secrets[index]);
+            slices.emplace_back(point);
+        }
+
+        success &= valid[index];
+    }
+
+    bitcoin_short_hash_batch(slices.data(), count, hashes);
+    slices.clear();
+
+    // The checksum of each payload is the prefix of its bitcoin hash.
+    for (size_t index = 0; index < count; ++index)
+    {
+        auto& payload = payloads[index];
+        payload[0] = version_;
+        std::copy(hashes[index].begin(), hashes[index].end(),
+            payload.begin() + 1);
+        slices.emplace_back(payload.data(), payload.data() + prefix_size);
+    }
+
+    bitcoin_hash_batch(slices.data(), count, checksums);
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        if (!valid[index])
+        {
+            out[index].clear();
+            continue;
+        }
+
+        auto& payload = payloads[index];
+        std::copy_n(checksums[index].begin(), checksum_size,
+            payload.begin() + prefix_size);
+        encode_base58(out[index], payload);
+    }
+
+    return success;
+}
+
+} // namespace wallet
+} // namespace libbitcoin
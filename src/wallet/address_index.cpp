@@ -0,0 +1,808 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/wallet/address_index.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <boost/filesystem.hpp>
+#include <boost/system/error_code.hpp>
+#include <bitcoin/bitcoin/chain/block.hpp>
+#include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/error.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/assert.hpp>
+#include <bitcoin/bitcoin/utility/byte_reader.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/endian.hpp>
+#include <bitcoin/bitcoin/utility/parallel.hpp>
+#include <bitcoin/bitcoin/wallet/address_extractor.hpp>
+#include "../math/external/cpu_features.h"
+
+#if defined(__x86_64__) || defined(__i386__) || \
+    defined(_M_X64) || defined(_M_IX86)
+    #define ADDRESS_INDEX_SSSE3
+    #if defined(__GNUC__) || defined(__clang__)
+        #define ADDRESS_INDEX_TARGET_SSSE3 __attribute__((target("ssse3")))
+    #else
+        #define ADDRESS_INDEX_TARGET_SSSE3
+    #endif
+    #include <tmmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+    #define ADDRESS_INDEX_NEON
+    #include <arm_neon.h>
+#endif
+
+// The column format is that of Lemire, Kurz and Rupp, "Stream VByte: Faster
+// Byte-Oriented Integer Compression" (2017).
+
+namespace libbitcoin {
+namespace wallet {
+
+using namespace bc::chain;
+
+// Fixed tuning parameter, transactions claimed together by a thread.
+static BC_CONSTEXPR size_t transaction_grain = 16;
+
+// The columns of a list, in order.
+enum column : size_t
+{
+    height_column,
+    link_low_column,
+    link_high_column,
+    index_column,
+    value_low_column,
+    value_high_column,
+    column_count
+};
+
+// Key field offsets.
+static const size_t count_offset = short_hash_size;
+static const size_t offset_offset = count_offset + sizeof(uint32_t);
+
+// The values of a control byte.
+static const size_t control_values = 4;
+
+// The shuffle and data length of each control byte.
+struct control_tables
+{
+    control_tables()
+    {
+        for (size_t control = 0; control < 256; ++control)
+        {
+            uint8_t offset = 0;
+
+            for (size_t value = 0; value < control_values; ++value)
+            {
+                const auto bytes = ((control >> (2 * value)) & 0x03) + 1;
+
+                for (size_t byte = 0; byte < 4; ++byte)
+                    shuffles[control][value * 4 + byte] = byte < bytes ?
+                        offset++ : 0xff;
+            }
+
+            lengths[control] = offset;
+        }
+    }
+
+    uint8_t shuffles[256][16];
+    uint8_t lengths[256];
+};
+
+static const control_tables& tables()
+{
+    static const control_tables instance;
+    return instance;
+}
+
+static uint64_t to_zigzag(uint64_t value)
+{
+    return (value << 1) ^ (0 - (value >> 63));
+}
+
+static uint64_t from_zigzag(uint64_t value)
+{
+    return (value >> 1) ^ (0 - (value & 1));
+}
+
+static uint32_t low(uint64_t value)
+{
+    return static_cast<uint32_t>(value);
+}
+
+static uint32_t high(uint64_t value)
+{
+    return static_cast<uint32_t>(value >> 32);
+}
+
+static uint64_t join(uint32_t low, uint32_t high)
+{
+    return (static_cast<uint64_t>(high) << 32) | low;
+}
+
+// Scalar.
+//-----------------------------------------------------------------------------
+
+static void encode_column(data_chunk& out, const uint32_t* values,
+    size_t count)
+{
+    data_chunk controls((count + control_values - 1) / control_values, 0);
+    data_chunk data;
+    data.reserve(count * sizeof(uint32_t));
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        const auto value = values[index];
+        const size_t bytes = value < 0x100 ? 1 : value < 0x10000 ? 2 :
+            value < 0x1000000 ? 3 : 4;
+
+        controls[index / control_values] |= static_cast<uint8_t>(
+            (bytes - 1) << (2 * (index % control_values)));
+
+        for (size_t byte = 0; byte < bytes; ++byte)
+            data.push_back(static_cast<uint8_t>(value >> (8 * byte)));
+    }
+
+    byte_writer sink(out);
+    sink.write_variable_base128(data.size());
+    extend_data(out, controls);
+    extend_data(out, data);
+}
+
+// Decode the values from the first, returning the data read, false if the
+// data is exceeded.
+static bool decode_scalar(uint32_t* out, size_t first, size_t count,
+    const uint8_t* controls, const uint8_t*& data, const uint8_t* end)
+{
+    for (auto index = first; index < count; ++index)
+    {
+        const size_t bytes = ((controls[index / control_values] >>
+            (2 * (index % control_values))) & 0x03) + 1;
+
+        if (static_cast<size_t>(end - data) < bytes)
+            return false;
+
+        uint32_t value = 0;
+
+        for (size_t byte = 0; byte < bytes; ++byte)
+            value |= static_cast<uint32_t>(*data++) << (8 * byte);
+
+        out[index] = value;
+    }
+
+    return true;
+}
+
+// Vector.
+//-----------------------------------------------------------------------------
+
+#ifdef ADDRESS_INDEX_SSSE3
+
+static bool has_vector()
+{
+    return (CPUFeatures() & CPU_FEATURE_SSSE3) != 0;
+}
+
+// Decode four values to a shuffle, while sixteen bytes of data remain (so
+// the load is within the data). Returns the number of values decoded.
+ADDRESS_INDEX_TARGET_SSSE3
+static size_t decode_vector(uint32_t* out, size_t count,
+    const uint8_t* controls, const uint8_t*& data, const uint8_t* end)
+{
+    const auto& table = tables();
+    size_t index = 0;
+
+    for (; index + control_values <= count && end - data >= 16;
+        index += control_values)
+    {
+        const auto control = controls[index / control_values];
+        const auto shuffle = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(table.shuffles[control]));
+        const auto in = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(data));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + index),
+            _mm_shuffle_epi8(in, shuffle));
+        data += table.lengths[control];
+    }
+
+    return index;
+}
+
+#endif // ADDRESS_INDEX_SSSE3
+
+#ifdef ADDRESS_INDEX_NEON
+
+static bool has_vector()
+{
+    return true;
+}
+
+// As the SSSE3 kernel, a table index beyond the vector is zero as is a
+// shuffle index with the high bit set.
+static size_t decode_vector(uint32_t* out, size_t count,
+    const uint8_t* controls, const uint8_t*& data, const uint8_t* end)
+{
+    const auto& table = tables();
+    size_t index = 0;
+
+    for (; index + control_values <= count && end - data >= 16;
+        index += control_values)
+    {
+        const auto control = controls[index / control_values];
+        const auto shuffled = vqtbl1q_u8(vld1q_u8(data),
+            vld1q_u8(table.shuffles[control]));
+        vst1q_u32(out + index, vreinterpretq_u32_u8(shuffled));
+        data += table.lengths[control];
+    }
+
+    return index;
+}
+
+#endif // ADDRESS_INDEX_NEON
+
+// Decode a column of count values in place, false if it is not a valid
+// column. The source reads the list that ends at end.
+static bool decode_column(uint32_t* out, size_t count, byte_reader& source,
+    const uint8_t* end)
+{
+    const auto size = source.read_variable_base128();
+    const auto controls_size = (count + control_values - 1) / control_values;
+
+    if (!source || source.remaining() < controls_size ||
+        source.remaining() - controls_size < size)
+        return false;
+
+    const auto controls = end - source.remaining();
+    auto data = controls + controls_size;
+    const auto data_end = data + size;
+    source.skip(static_cast<size_t>(controls_size + size));
+    size_t first = 0;
+
+#if defined(ADDRESS_INDEX_SSSE3) || defined(ADDRESS_INDEX_NEON)
+    if (has_vector())
+        first = decode_vector(out, count, controls, data, data_end);
+#endif
+
+    return decode_scalar(out, first, count, controls, data, data_end) &&
+        data == data_end;
+}
+
+// Postings.
+//-----------------------------------------------------------------------------
+
+bool address_index::posting::operator<(const posting& other) const
+{
+    if (height != other.height)
+        return height < other.height;
+
+    if (link != other.link)
+        return link < other.link;
+
+    if (index != other.index)
+        return index < other.index;
+
+    return output < other.output;
+}
+
+bool address_index::posting::operator==(const posting& other) const
+{
+    return height == other.height && link == other.link &&
+        index == other.index && value == other.value &&
+        output == other.output;
+}
+
+// private static
+void address_index::encode(data_chunk& out, const posting::list& postings)
+{
+    BITCOIN_ASSERT(std::is_sorted(postings.begin(), postings.end()));
+    const auto count = postings.size();
+    std::vector<uint32_t> columns(column_count * count);
+    const auto column = [&columns, count](size_t value)
+    {
+        return columns.data() + value * count;
+    };
+
+    size_t height = 0;
+    uint64_t link = 0;
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        const auto& posting = postings[index];
+        const auto delta = to_zigzag(posting.link - link);
+        column(height_column)[index] = static_cast<uint32_t>(
+            posting.height - height);
+        column(link_low_column)[index] = low(delta);
+        column(link_high_column)[index] = high(delta);
+        column(index_column)[index] = (posting.index << 1) |
+            (posting.output ? 1 : 0);
+        column(value_low_column)[index] = low(posting.value);
+        column(value_high_column)[index] = high(posting.value);
+        height = posting.height;
+        link = posting.link;
+    }
+
+    for (size_t value = 0; value < column_count; ++value)
+        encode_column(out, column(value), count);
+}
+
+// private static
+bool address_index::decode(posting::list& out, size_t count, data_slice list)
+{
+    std::vector<uint32_t> columns(column_count * count);
+    const auto column = [&columns, count](size_t value)
+    {
+        return columns.data() + value * count;
+    };
+
+    byte_reader source(list);
+
+    for (size_t value = 0; value < column_count; ++value)
+        if (!decode_column(column(value), count, source, list.end()))
+            return false;
+
+    if (source.remaining() != 0)
+        return false;
+
+    size_t height = 0;
+    uint64_t link = 0;
+    out.reserve(out.size() + count);
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        height += column(height_column)[index];
+        link += from_zigzag(join(column(link_low_column)[index],
+            column(link_high_column)[index]));
+        const auto point = column(index_column)[index];
+        out.push_back({ height, link, point >> 1, join(
+            column(value_low_column)[index],
+            column(value_high_column)[index]), (point & 1) != 0 });
+    }
+
+    return true;
+}
+
+// Storage.
+//-----------------------------------------------------------------------------
+
+// Writes the prefix and lists of a segment, and then its keys.
+class segment_writer
+{
+public:
+    segment_writer(const boost::filesystem::path& file, size_t keys,
+        uint64_t postings)
+      : stream_(file.string(), std::ios::binary | std::ios::trunc),
+        offset_(address_index::prefix_size + keys * address_index::key_size)
+    {
+        data_chunk prefix;
+        byte_writer sink(prefix);
+        sink.write_4_bytes_little_endian(address_index::magic);
+        sink.write_4_bytes_little_endian(address_index::version);
+        sink.write_8_bytes_little_endian(keys);
+        sink.write_8_bytes_little_endian(postings);
+        prefix.resize(offset_, 0);
+        keys_.reserve(keys * address_index::key_size);
+        stream_.write(reinterpret_cast<const char*>(prefix.data()),
+            prefix.size());
+    }
+
+    void write(const short_hash& key, size_t count, data_slice list)
+    {
+        BITCOIN_ASSERT(count <= max_uint32);
+        byte_writer sink(keys_);
+        sink.write_short_hash(key);
+        sink.write_4_bytes_little_endian(static_cast<uint32_t>(count));
+        sink.write_8_bytes_little_endian(offset_);
+        stream_.write(reinterpret_cast<const char*>(list.data()),
+            list.size());
+        offset_ += list.size();
+    }
+
+    bool finish()
+    {
+        stream_.seekp(address_index::prefix_size);
+        stream_.write(reinterpret_cast<const char*>(keys_.data()),
+            keys_.size());
+        stream_.flush();
+        return !!stream_;
+    }
+
+private:
+    std::ofstream stream_;
+    uint64_t offset_;
+    data_chunk keys_;
+};
+
+// static
+bool address_index::merge(const path& file, const paths& segments)
+{
+    std::vector<std::unique_ptr<address_index>> indexes;
+    uint64_t postings = 0;
+
+    for (const auto& segment: segments)
+    {
+        indexes.emplace_back(new address_index);
+
+        if (!indexes.back()->open(segment))
+            return false;
+
+        postings += indexes.back()->size();
+    }
+
+    // Invoke handler(key, sources) for each key in order, with the indexes
+    // of the segments of the key (in order).
+    const auto walk = [&indexes](
+        std::function<bool(const uint8_t*, const std::vector<size_t>&)>
+            handler)
+    {
+        std::vector<size_t> cursors(indexes.size(), 0);
+        std::vector<size_t> sources;
+
+        while (true)
+        {
+            const uint8_t* key = nullptr;
+            sources.clear();
+
+            for (size_t segment = 0; segment < indexes.size(); ++segment)
+            {
+                if (cursors[segment] == indexes[segment]->keys())
+                    continue;
+
+                const auto next = indexes[segment]->key_data(
+                    cursors[segment]);
+                const auto compare = key == nullptr ? -1 :
+                    std::memcmp(next, key, short_hash_size);
+
+                if (compare < 0)
+                {
+                    key = next;
+                    sources.clear();
+                }
+
+                if (compare <= 0)
+                    sources.push_back(segment);
+            }
+
+            if (key == nullptr)
+                return true;
+
+            if (!handler(key, sources))
+                return false;
+
+            for (const auto segment: sources)
+                ++cursors[segment];
+        }
+    };
+
+    size_t keys = 0;
+    walk([&keys](const uint8_t*, const std::vector<size_t>&)
+    {
+        ++keys;
+        return true;
+    });
+
+    // The cursor of each segment is that of its key.
+    std::vector<size_t> cursors(indexes.size(), 0);
+    segment_writer writer(file, keys, postings);
+    posting::list merged;
+    data_chunk encoded;
+
+    const auto write = [&](const uint8_t* key,
+        const std::vector<size_t>& sources)
+    {
+        short_hash hash;
+        std::copy_n(key, short_hash_size, hash.begin());
+
+        if (sources.size() == 1)
+        {
+            const auto& index = *indexes[sources.front()];
+            const auto position = cursors[sources.front()]++;
+            writer.write(hash, index.count(position), index.list(position));
+            return true;
+        }
+
+        merged.clear();
+
+        for (const auto segment: sources)
+        {
+            const auto& index = *indexes[segment];
+            const auto position = cursors[segment]++;
+            const auto middle = merged.size();
+
+            if (!decode(merged, index.count(position), index.list(position)))
+                return false;
+
+            std::inplace_merge(merged.begin(), merged.begin() + middle,
+                merged.end());
+        }
+
+        encoded.clear();
+        encode(encoded, merged);
+        writer.write(hash, merged.size(), encoded);
+        return true;
+    };
+
+    return walk(write) && writer.finish();
+}
+
+// Construction.
+//-----------------------------------------------------------------------------
+
+address_index::address_index()
+  : keys_(0), size_(0)
+{
+}
+
+bool address_index::open(const path& file)
+{
+    close();
+    boost::system::error_code ec;
+
+    // An empty file cannot be mapped.
+    if (boost::filesystem::file_size(file, ec) == 0 || ec)
+        return false;
+
+    try
+    {
+        file_.open(file.string());
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+
+    if (!file_.is_open())
+        return false;
+
+    const auto begin = reinterpret_cast<const uint8_t*>(file_.data());
+    const auto size = static_cast<uint64_t>(file_.size());
+    byte_reader source({ begin, begin + std::min(file_.size(), prefix_size) });
+
+    const auto is_index = source.read_4_bytes_little_endian() == magic &&
+        source.read_4_bytes_little_endian() == version;
+    const auto keys = source.read_8_bytes_little_endian();
+    const auto postings = source.read_8_bytes_little_endian();
+
+    if (!source || !is_index || keys > (size - prefix_size) / key_size)
+    {
+        close();
+        return false;
+    }
+
+    // Keys must be ordered and lists contiguous, so reads are in the file.
+    keys_ = static_cast<size_t>(keys);
+    uint64_t offset = prefix_size + keys * key_size;
+    uint64_t total = 0;
+
+    for (size_t position = 0; position < keys_; ++position)
+    {
+        const auto key = key_data(position);
+        const auto next = from_little_endian_unsafe<uint64_t>(
+            key + offset_offset);
+
+        if (next < offset || next > size || (position > 0 &&
+            std::memcmp(key_data(position - 1), key, short_hash_size) >= 0))
+        {
+            close();
+            return false;
+        }
+
+        total += count(position);
+        offset = next;
+    }
+
+    if (total != postings)
+    {
+        close();
+        return false;
+    }
+
+    size_ = static_cast<size_t>(postings);
+    return true;
+}
+
+void address_index::close()
+{
+    if (file_.is_open())
+        file_.close();
+
+    keys_ = 0;
+    size_ = 0;
+}
+
+bool address_index::is_open() const
+{
+    return file_.is_open();
+}
+
+// Properties.
+//-----------------------------------------------------------------------------
+
+size_t address_index::keys() const
+{
+    return keys_;
+}
+
+size_t address_index::size() const
+{
+    return size_;
+}
+
+// Queries.
+//-----------------------------------------------------------------------------
+
+bool address_index::find(posting::list& out, const short_hash& key) const
+{
+    const auto position = find(key);
+
+    if (position == keys_)
+        return false;
+
+    return decode(out, count(position), list(position));
+}
+
+// private
+size_t address_index::find(const short_hash& key) const
+{
+    size_t first = 0;
+    auto last = keys_;
+
+    while (first < last)
+    {
+        const auto middle = first + (last - first) / 2;
+
+        if (std::memcmp(key_data(middle), key.data(), short_hash_size) < 0)
+            first = middle + 1;
+        else
+            last = middle;
+    }
+
+    return first < keys_ && std::memcmp(key_data(first), key.data(),
+        short_hash_size) == 0 ? first : keys_;
+}
+
+// private
+const uint8_t* address_index::key_data(size_t position) const
+{
+    BITCOIN_ASSERT(position < keys_);
+    return reinterpret_cast<const uint8_t*>(file_.data()) + prefix_size +
+        position * key_size;
+}
+
+// private
+uint32_t address_index::count(size_t position) const
+{
+    return from_little_endian_unsafe<uint32_t>(key_data(position) +
+        count_offset);
+}
+
+// private
+data_slice address_index::list(size_t position) const
+{
+    const auto begin = reinterpret_cast<const uint8_t*>(file_.data());
+    const auto first = from_little_endian_unsafe<uint64_t>(
+        key_data(position) + offset_offset);
+    const auto last = position + 1 == keys_ ? file_.size() :
+        from_little_endian_unsafe<uint64_t>(key_data(position + 1) +
+            offset_offset);
+
+    return { begin + first, begin + last };
+}
+
+// Builder.
+//-----------------------------------------------------------------------------
+
+address_index_builder::address_index_builder(
+    const address_extractor& extractor)
+  : extractor_(extractor), size_(0)
+{
+}
+
+void address_index_builder::add(const short_hash& key,
+    const posting& posting)
+{
+    postings_[key].push_back(posting);
+    ++size_;
+}
+
+void address_index_builder::add(const address_extractor::row::list& rows,
+    size_t height, uint64_t link)
+{
+    for (const auto& row: rows)
+        add(row.hash, { height, link, row.point.index(), row.value,
+            row.output });
+}
+
+void address_index_builder::add(const block& block, size_t height,
+    uint64_t link, threadpool& pool)
+{
+    const auto& txs = block.transactions();
+    std::vector<address_extractor::row::list> rows(txs.size());
+
+    const auto extract = [&](size_t index)
+    {
+        rows[index] = extractor_.extract(txs[index]);
+        return code(error::success);
+    };
+
+    parallel_for(pool, txs.size(), transaction_grain, extract);
+
+    for (size_t index = 0; index < rows.size(); ++index)
+        add(rows[index], height, link + index);
+}
+
+size_t address_index_builder::keys() const
+{
+    return postings_.size();
+}
+
+size_t address_index_builder::size() const
+{
+    return size_;
+}
+
+bool address_index_builder::store(const path& file) const
+{
+    typedef std::pair<short_hash, const posting::list*> key;
+    std::vector<key> keys;
+    keys.reserve(postings_.size());
+
+    postings_.for_each([&keys](const short_hash& hash,
+        const posting::list& postings)
+    {
+        keys.push_back({ hash, &postings });
+    });
+
+    std::sort(keys.begin(), keys.end(),
+        [](const key& left, const key& right)
+        {
+            return left.first < right.first;
+        });
+
+    segment_writer writer(file, keys.size(), size_);
+    posting::list sorted;
+    data_chunk encoded;
+
+    for (const auto& key: keys)
+    {
+        sorted = *key.second;
+        std::sort(sorted.begin(), sorted.end());
+        encoded.clear();
+        address_index::encode(encoded, sorted);
+        writer.write(key.first, sorted.size(), encoded);
+    }
+
+    return writer.finish();
+}
+
+void address_index_builder::clear()
+{
+    postings_.clear();
+    size_ = 0;
+}
+
+} // namespace wallet
+} // namespace libbitcoin
@@ -22,20546 +22,22373 @@ namespace libbitcoin {
 namespace wallet {
 namespace language {
 
-const dictionary en =
+// Each list is packed into one string of null terminated words, located by
+// a table of offsets, so that it requires no relocation (see packed_strings).
+
+static const char en_words[] =
+    "abandon\0"
+    "ability\0"
+    "able\0"
+    "about\0"
+    "above\0"
+    "absent\0"
+    "absorb\0"
+    "abstract\0"
+    "absurd\0"
+    "abuse\0"
+    "access\0"
+    "accident\0"
+    "account\0"
+    "accuse\0"
+    "achieve\0"
+    "acid\0"
+    "acoustic\0"
+    "acquire\0"
+    "across\0"
+    "act\0"
+    "action\0"
+    "actor\0"
+    "actress\0"
+    "actual\0"
+    "adapt\0"
+    "add\0"
+    "addict\0"
+    "address\0"
+    "adjust\0"
+    "admit\0"
+    "adult\0"
+    "advance\0"
+    "advice\0"
+    "aerobic\0"
+    "affair\0"
+    "afford\0"
+    "afraid\0"
+    "again\0"
+    "age\0"
+    "agent\0"
+    "agree\0"
+    "ahead\0"
+    "aim\0"
+    "air\0"
+    "airport\0"
+    "aisle\0"
+    "alarm\0"
+    "album\0"
+    "alcohol\0"
+    "alert\0"
+    "alien\0"
+    "all\0"
+    "alley\0"
+    "allow\0"
+    "almost\0"
+    "alone\0"
+    "alpha\0"
+    "already\0"
+    "also\0"
+    "alter\0"
+    "always\0"
+    "amateur\0"
+    "amazing\0"
+    "among\0"
+    "amount\0"
+    "amused\0"
+    "analyst\0"
+    "anchor\0"
+    "ancient\0"
+    "anger\0"
+    "angle\0"
+    "angry\0"
+    "animal\0"
+    "ankle\0"
+    "announce\0"
+    "annual\0"
+    "another\0"
+    "answer\0"
+    "antenna\0"
+    "antique\0"
+    "anxiety\0"
+    "any\0"
+    "apart\0"
+    "apology\0"
+    "appear\0"
+    "apple\0"
+    "approve\0"
+    "april\0"
+    "arch\0"
+    "arctic\0"
+    "area\0"
+    "arena\0"
+    "argue\0"
+    "arm\0"
+    "armed\0"
+    "armor\0"
+    "army\0"
+    "around\0"
+    "arrange\0"
+    "arrest\0"
+    "arrive\0"
+    "arrow\0"
+    "art\0"
+    "artefact\0"
+    "artist\0"
+    "artwork\0"
+    "ask\0"
+    "aspect\0"
+    "assault\0"
+    "asset\0"
+    "assist\0"
+    "assume\0"
+    "asthma\0"
+    "athlete\0"
+    "atom\0"
+    "attack\0"
+    "attend\0"
+    "attitude\0"
+    "attract\0"
+    "auction\0"
+    "audit\0"
+    "august\0"
+    "aunt\0"
+    "author\0"
+    "auto\0"
+    "autumn\0"
+    "average\0"
+    "avocado\0"
+    "avoid\0"
+    "awake\0"
+    "aware\0"
+    "away\0"
+    "awesome\0"
+    "awful\0"
+    "awkward\0"
+    "axis\0"
+    "baby\0"
+    "bachelor\0"
+    "bacon\0"
+    "badge\0"
+    "bag\0"
+    "balance\0"
+    "balcony\0"
+    "ball\0"
+    "bamboo\0"
+    "banana\0"
+    "banner\0"
+    "bar\0"
+    "barely\0"
+    "bargain\0"
+    "barrel\0"
+    "base\0"
+    "basic\0"
+    "basket\0"
+    "battle\0"
+    "beach\0"
+    "bean\0"
+    "beauty\0"
+    "because\0"
+    "become\0"
+    "beef\0"
+    "before\0"
+    "begin\0"
+    "behave\0"
+    "behind\0"
+    "believe\0"
+    "below\0"
+    "belt\0"
+    "bench\0"
+    "benefit\0"
+    "best\0"
+    "betray\0"
+    "better\0"
+    "between\0"
+    "beyond\0"
+    "bicycle\0"
+    "bid\0"
+    "bike\0"
+    "bind\0"
+    "biology\0"
+    "bird\0"
+    "birth\0"
+    "bitter\0"
+    "black\0"
+    "blade\0"
+    "blame\0"
+    "blanket\0"
+    "blast\0"
+    "bleak\0"
+    "bless\0"
+    "blind\0"
+    "blood\0"
+    "blossom\0"
+    "blouse\0"
+    "blue\0"
+    "blur\0"
+    "blush\0"
+    "board\0"
+    "boat\0"
+    "body\0"
+    "boil\0"
+    "bomb\0"
+    "bone\0"
+    "bonus\0"
+    "book\0"
+    "boost\0"
+    "border\0"
+    "boring\0"
+    "borrow\0"
+    "boss\0"
+    "bottom\0"
+    "bounce\0"
+    "box\0"
+    "boy\0"
+    "bracket\0"
+    "brain\0"
+    "brand\0"
+    "brass\0"
+    "brave\0"
+    "bread\0"
+    "breeze\0"
+    "brick\0"
+    "bridge\0"
+    "brief\0"
+    "bright\0"
+    "bring\0"
+    "brisk\0"
+    "broccoli\0"
+    "broken\0"
+    "bronze\0"
+    "broom\0"
+    "brother\0"
+    "brown\0"
+    "brush\0"
+    "bubble\0"
+    "buddy\0"
+    "budget\0"
+    "buffalo\0"
+    "build\0"
+    "bulb\0"
+    "bulk\0"
+    "bullet\0"
+    "bundle\0"
+    "bunker\0"
+    "burden\0"
+    "burger\0"
+    "burst\0"
+    "bus\0"
+    "business\0"
+    "busy\0"
+    "butter\0"
+    "buyer\0"
+    "buzz\0"
+    "cabbage\0"
+    "cabin\0"
+    "cable\0"
+    "cactus\0"
+    "cage\0"
+    "cake\0"
+    "call\0"
+    "calm\0"
+    "camera\0"
+    "camp\0"
+    "can\0"
+    "canal\0"
+    "cancel\0"
+    "candy\0"
+    "cannon\0"
+    "canoe\0"
+    "canvas\0"
+    "canyon\0"
+    "capable\0"
+    "capital\0"
+    "captain\0"
+    "car\0"
+    "carbon\0"
+    "card\0"
+    "cargo\0"
+    "carpet\0"
+    "carry\0"
+    "cart\0"
+    "case\0"
+    "cash\0"
+    "casino\0"
+    "castle\0"
+    "casual\0"
+    "cat\0"
+    "catalog\0"
+    "catch\0"
+    "category\0"
+    "cattle\0"
+    "caught\0"
+    "cause\0"
+    "caution\0"
+    "cave\0"
+    "ceiling\0"
+    "celery\0"
+    "cement\0"
+    "census\0"
+    "century\0"
+    "cereal\0"
+    "certain\0"
+    "chair\0"
+    "chalk\0"
+    "champion\0"
+    "change\0"
+    "chaos\0"
+    "chapter\0"
+    "charge\0"
+    "chase\0"
+    "chat\0"
+    "cheap\0"
+    "check\0"
+    "cheese\0"
+    "chef\0"
+    "cherry\0"
+    "chest\0"
+    "chicken\0"
+    "chief\0"
+    "child\0"
+    "chimney\0"
+    "choice\0"
+    "choose\0"
+    "chronic\0"
+    "chuckle\0"
+    "chunk\0"
+    "churn\0"
+    "cigar\0"
+    "cinnamon\0"
+    "circle\0"
+    "citizen\0"
+    "city\0"
+    "civil\0"
+    "claim\0"
+    "clap\0"
+    "clarify\0"
+    "claw\0"
+    "clay\0"
+    "clean\0"
+    "clerk\0"
+    "clever\0"
+    "click\0"
+    "client\0"
+    "cliff\0"
+    "climb\0"
+    "clinic\0"
+    "clip\0"
+    "clock\0"
+    "clog\0"
+    "close\0"
+    "cloth\0"
+    "cloud\0"
+    "clown\0"
+    "club\0"
+    "clump\0"
+    "cluster\0"
+    "clutch\0"
+    "coach\0"
+    "coast\0"
+    "coconut\0"
+    "code\0"
+    "coffee\0"
+    "coil\0"
+    "coin\0"
+    "collect\0"
+    "color\0"
+    "column\0"
+    "combine\0"
+    "come\0"
+    "comfort\0"
+    "comic\0"
+    "common\0"
+    "company\0"
+    "concert\0"
+    "conduct\0"
+    "confirm\0"
+    "congress\0"
+    "connect\0"
+    "consider\0"
+    "control\0"
+    "convince\0"
+    "cook\0"
+    "cool\0"
+    "copper\0"
+    "copy\0"
+    "coral\0"
+    "core\0"
+    "corn\0"
+    "correct\0"
+    "cost\0"
+    "cotton\0"
+    "couch\0"
+    "country\0"
+    "couple\0"
+    "course\0"
+    "cousin\0"
+    "cover\0"
+    "coyote\0"
+    "crack\0"
+    "cradle\0"
+    "craft\0"
+    "cram\0"
+    "crane\0"
+    "crash\0"
+    "crater\0"
+    "crawl\0"
+    "crazy\0"
+    "cream\0"
+    "credit\0"
+    "creek\0"
+    "crew\0"
+    "cricket\0"
+    "crime\0"
+    "crisp\0"
+    "critic\0"
+    "crop\0"
+    "cross\0"
+    "crouch\0"
+    "crowd\0"
+    "crucial\0"
+    "cruel\0"
+    "cruise\0"
+    "crumble\0"
+    "crunch\0"
+    "crush\0"
+    "cry\0"
+    "crystal\0"
+    "cube\0"
+    "culture\0"
+    "cup\0"
+    "cupboard\0"
+    "curious\0"
+    "current\0"
+    "curtain\0"
+    "curve\0"
+    "cushion\0"
+    "custom\0"
+    "cute\0"
+    "cycle\0"
+    "dad\0"
+    "damage\0"
+    "damp\0"
+    "dance\0"
+    "danger\0"
+    "daring\0"
+    "dash\0"
+    "daughter\0"
+    "dawn\0"
+    "day\0"
+    "deal\0"
+    "debate\0"
+    "debris\0"
+    "decade\0"
+    "december\0"
+    "decide\0"
+    "decline\0"
+    "decorate\0"
+    "decrease\0"
+    "deer\0"
+    "defense\0"
+    "define\0"
+    "defy\0"
+    "degree\0"
+    "delay\0"
+    "deliver\0"
+    "demand\0"
+    "demise\0"
+    "denial\0"
+    "dentist\0"
+    "deny\0"
+    "depart\0"
+    "depend\0"
+    "deposit\0"
+    "depth\0"
+    "deputy\0"
+    "derive\0"
+    "describe\0"
+    "desert\0"
+    "design\0"
+    "desk\0"
+    "despair\0"
+    "destroy\0"
+    "detail\0"
+    "detect\0"
+    "develop\0"
+    "device\0"
+    "devote\0"
+    "diagram\0"
+    "dial\0"
+    "diamond\0"
+    "diary\0"
+    "dice\0"
+    "diesel\0"
+    "diet\0"
+    "differ\0"
+    "digital\0"
+    "dignity\0"
+    "dilemma\0"
+    "dinner\0"
+    "dinosaur\0"
+    "direct\0"
+    "dirt\0"
+    "disagree\0"
+    "discover\0"
+    "disease\0"
+    "dish\0"
+    "dismiss\0"
+    "disorder\0"
+    "display\0"
+    "distance\0"
+    "divert\0"
+    "divide\0"
+    "divorce\0"
+    "dizzy\0"
+    "doctor\0"
+    "document\0"
+    "dog\0"
+    "doll\0"
+    "dolphin\0"
+    "domain\0"
+    "donate\0"
+    "donkey\0"
+    "donor\0"
+    "door\0"
+    "dose\0"
+    "double\0"
+    "dove\0"
+    "draft\0"
+    "dragon\0"
+    "drama\0"
+    "drastic\0"
+    "draw\0"
+    "dream\0"
+    "dress\0"
+    "drift\0"
+    "drill\0"
+    "drink\0"
+    "drip\0"
+    "drive\0"
+    "drop\0"
+    "drum\0"
+    "dry\0"
+    "duck\0"
+    "dumb\0"
+    "dune\0"
+    "during\0"
+    "dust\0"
+    "dutch\0"
+    "duty\0"
+    "dwarf\0"
+    "dynamic\0"
+    "eager\0"
+    "eagle\0"
+    "early\0"
+    "earn\0"
+    "earth\0"
+    "easily\0"
+    "east\0"
+    "easy\0"
+    "echo\0"
+    "ecology\0"
+    "economy\0"
+    "edge\0"
+    "edit\0"
+    "educate\0"
+    "effort\0"
+    "egg\0"
+    "eight\0"
+    "either\0"
+    "elbow\0"
+    "elder\0"
+    "electric\0"
+    "elegant\0"
+    "element\0"
+    "elephant\0"
+    "elevator\0"
+    "elite\0"
+    "else\0"
+    "embark\0"
+    "embody\0"
+    "embrace\0"
+    "emerge\0"
+    "emotion\0"
+    "employ\0"
+    "empower\0"
+    "empty\0"
+    "enable\0"
+    "enact\0"
+    "end\0"
+    "endless\0"
+    "endorse\0"
+    "enemy\0"
+    "energy\0"
+    "enforce\0"
+    "engage\0"
+    "engine\0"
+    "enhance\0"
+    "enjoy\0"
+    "enlist\0"
+    "enough\0"
+    "enrich\0"
+    "enroll\0"
+    "ensure\0"
+    "enter\0"
+    "entire\0"
+    "entry\0"
+    "envelope\0"
+    "episode\0"
+    "equal\0"
+    "equip\0"
+    "era\0"
+    "erase\0"
+    "erode\0"
+    "erosion\0"
+    "error\0"
+    "erupt\0"
+    "escape\0"
+    "essay\0"
+    "essence\0"
+    "estate\0"
+    "eternal\0"
+    "ethics\0"
+    "evidence\0"
+    "evil\0"
+    "evoke\0"
+    "evolve\0"
+    "exact\0"
+    "example\0"
+    "excess\0"
+    "exchange\0"
+    "excite\0"
+    "exclude\0"
+    "excuse\0"
+    "execute\0"
+    "exercise\0"
+    "exhaust\0"
+    "exhibit\0"
+    "exile\0"
+    "exist\0"
+    "exit\0"
+    "exotic\0"
+    "expand\0"
+    "expect\0"
+    "expire\0"
+    "explain\0"
+    "expose\0"
+    "express\0"
+    "extend\0"
+    "extra\0"
+    "eye\0"
+    "eyebrow\0"
+    "fabric\0"
+    "face\0"
+    "faculty\0"
+    "fade\0"
+    "faint\0"
+    "faith\0"
+    "fall\0"
+    "false\0"
+    "fame\0"
+    "family\0"
+    "famous\0"
+    "fan\0"
+    "fancy\0"
+    "fantasy\0"
+    "farm\0"
+    "fashion\0"
+    "fat\0"
+    "fatal\0"
+    "father\0"
+    "fatigue\0"
+    "fault\0"
+    "favorite\0"
+    "feature\0"
+    "february\0"
+    "federal\0"
+    "fee\0"
+    "feed\0"
+    "feel\0"
+    "female\0"
+    "fence\0"
+    "festival\0"
+    "fetch\0"
+    "fever\0"
+    "few\0"
+    "fiber\0"
+    "fiction\0"
+    "field\0"
+    "figure\0"
+    "file\0"
+    "film\0"
+    "filter\0"
+    "final\0"
+    "find\0"
+    "fine\0"
+    "finger\0"
+    "finish\0"
+    "fire\0"
+    "firm\0"
+    "first\0"
+    "fiscal\0"
+    "fish\0"
+    "fit\0"
+    "fitness\0"
+    "fix\0"
+    "flag\0"
+    "flame\0"
+    "flash\0"
+    "flat\0"
+    "flavor\0"
+    "flee\0"
+    "flight\0"
+    "flip\0"
+    "float\0"
+    "flock\0"
+    "floor\0"
+    "flower\0"
+    "fluid\0"
+    "flush\0"
+    "fly\0"
+    "foam\0"
+    "focus\0"
+    "fog\0"
+    "foil\0"
+    "fold\0"
+    "follow\0"
+    "food\0"
+    "foot\0"
+    "force\0"
+    "forest\0"
+    "forget\0"
+    "fork\0"
+    "fortune\0"
+    "forum\0"
+    "forward\0"
+    "fossil\0"
+    "foster\0"
+    "found\0"
+    "fox\0"
+    "fragile\0"
+    "frame\0"
+    "frequent\0"
+    "fresh\0"
+    "friend\0"
+    "fringe\0"
+    "frog\0"
+    "front\0"
+    "frost\0"
+    "frown\0"
+    "frozen\0"
+    "fruit\0"
+    "fuel\0"
+    "fun\0"
+    "funny\0"
+    "furnace\0"
+    "fury\0"
+    "future\0"
+    "gadget\0"
+    "gain\0"
+    "galaxy\0"
+    "gallery\0"
+    "game\0"
+    "gap\0"
+    "garage\0"
+    "garbage\0"
+    "garden\0"
+    "garlic\0"
+    "garment\0"
+    "gas\0"
+    "gasp\0"
+    "gate\0"
+    "gather\0"
+    "gauge\0"
+    "gaze\0"
+    "general\0"
+    "genius\0"
+    "genre\0"
+    "gentle\0"
+    "genuine\0"
+    "gesture\0"
+    "ghost\0"
+    "giant\0"
+    "gift\0"
+    "giggle\0"
+    "ginger\0"
+    "giraffe\0"
+    "girl\0"
+    "give\0"
+    "glad\0"
+    "glance\0"
+    "glare\0"
+    "glass\0"
+    "glide\0"
+    "glimpse\0"
+    "globe\0"
+    "gloom\0"
+    "glory\0"
+    "glove\0"
+    "glow\0"
+    "glue\0"
+    "goat\0"
+    "goddess\0"
+    "gold\0"
+    "good\0"
+    "goose\0"
+    "gorilla\0"
+    "gospel\0"
+    "gossip\0"
+    "govern\0"
+    "gown\0"
+    "grab\0"
+    "grace\0"
+    "grain\0"
+    "grant\0"
+    "grape\0"
+    "grass\0"
+    "gravity\0"
+    "great\0"
+    "green\0"
+    "grid\0"
+    "grief\0"
+    "grit\0"
+    "grocery\0"
+    "group\0"
+    "grow\0"
+    "grunt\0"
+    "guard\0"
+    "guess\0"
+    "guide\0"
+    "guilt\0"
+    "guitar\0"
+    "gun\0"
+    "gym\0"
+    "habit\0"
+    "hair\0"
+    "half\0"
+    "hammer\0"
+    "hamster\0"
+    "hand\0"
+    "happy\0"
+    "harbor\0"
+    "hard\0"
+    "harsh\0"
+    "harvest\0"
+    "hat\0"
+    "have\0"
+    "hawk\0"
+    "hazard\0"
+    "head\0"
+    "health\0"
+    "heart\0"
+    "heavy\0"
+    "hedgehog\0"
+    "height\0"
+    "hello\0"
+    "helmet\0"
+    "help\0"
+    "hen\0"
+    "hero\0"
+    "hidden\0"
+    "high\0"
+    "hill\0"
+    "hint\0"
+    "hip\0"
+    "hire\0"
+    "history\0"
+    "hobby\0"
+    "hockey\0"
+    "hold\0"
+    "hole\0"
+    "holiday\0"
+    "hollow\0"
+    "home\0"
+    "honey\0"
+    "hood\0"
+    "hope\0"
+    "horn\0"
+    "horror\0"
+    "horse\0"
+    "hospital\0"
+    "host\0"
+    "hotel\0"
+    "hour\0"
+    "hover\0"
+    "hub\0"
+    "huge\0"
+    "human\0"
+    "humble\0"
+    "humor\0"
+    "hundred\0"
+    "hungry\0"
+    "hunt\0"
+    "hurdle\0"
+    "hurry\0"
+    "hurt\0"
+    "husband\0"
+    "hybrid\0"
+    "ice\0"
+    "icon\0"
+    "idea\0"
+    "identify\0"
+    "idle\0"
+    "ignore\0"
+    "ill\0"
+    "illegal\0"
+    "illness\0"
+    "image\0"
+    "imitate\0"
+    "immense\0"
+    "immune\0"
+    "impact\0"
+    "impose\0"
+    "improve\0"
+    "impulse\0"
+    "inch\0"
+    "include\0"
+    "income\0"
+    "increase\0"
+    "index\0"
+    "indicate\0"
+    "indoor\0"
+    "industry\0"
+    "infant\0"
+    "inflict\0"
+    "inform\0"
+    "inhale\0"
+    "inherit\0"
+    "initial\0"
+    "inject\0"
+    "injury\0"
+    "inmate\0"
+    "inner\0"
+    "innocent\0"
+    "input\0"
+    "inquiry\0"
+    "insane\0"
+    "insect\0"
+    "inside\0"
+    "inspire\0"
+    "install\0"
+    "intact\0"
+    "interest\0"
+    "into\0"
+    "invest\0"
+    "invite\0"
+    "involve\0"
+    "iron\0"
+    "island\0"
+    "isolate\0"
+    "issue\0"
+    "item\0"
+    "ivory\0"
+    "jacket\0"
+    "jaguar\0"
+    "jar\0"
+    "jazz\0"
+    "jealous\0"
+    "jeans\0"
+    "jelly\0"
+    "jewel\0"
+    "job\0"
+    "join\0"
+    "joke\0"
+    "journey\0"
+    "joy\0"
+    "judge\0"
+    "juice\0"
+    "jump\0"
+    "jungle\0"
+    "junior\0"
+    "junk\0"
+    "just\0"
+    "kangaroo\0"
+    "keen\0"
+    "keep\0"
+    "ketchup\0"
+    "key\0"
+    "kick\0"
+    "kid\0"
+    "kidney\0"
+    "kind\0"
+    "kingdom\0"
+    "kiss\0"
+    "kit\0"
+    "kitchen\0"
+    "kite\0"
+    "kitten\0"
+    "kiwi\0"
+    "knee\0"
+    "knife\0"
+    "knock\0"
+    "know\0"
+    "lab\0"
+    "label\0"
+    "labor\0"
+    "ladder\0"
+    "lady\0"
+    "lake\0"
+    "lamp\0"
+    "language\0"
+    "laptop\0"
+    "large\0"
+    "later\0"
+    "latin\0"
+    "laugh\0"
+    "laundry\0"
+    "lava\0"
+    "law\0"
+    "lawn\0"
+    "lawsuit\0"
+    "layer\0"
+    "lazy\0"
+    "leader\0"
+    "leaf\0"
+    "learn\0"
+    "leave\0"
+    "lecture\0"
+    "left\0"
+    "leg\0"
+    "legal\0"
+    "legend\0"
+    "leisure\0"
+    "lemon\0"
+    "lend\0"
+    "length\0"
+    "lens\0"
+    "leopard\0"
+    "lesson\0"
+    "letter\0"
+    "level\0"
+    "liar\0"
+    "liberty\0"
+    "library\0"
+    "license\0"
+    "life\0"
+    "lift\0"
+    "light\0"
+    "like\0"
+    "limb\0"
+    "limit\0"
+    "link\0"
+    "lion\0"
+    "liquid\0"
+    "list\0"
+    "little\0"
+    "live\0"
+    "lizard\0"
+    "load\0"
+    "loan\0"
+    "lobster\0"
+    "local\0"
+    "lock\0"
+    "logic\0"
+    "lonely\0"
+    "long\0"
+    "loop\0"
+    "lottery\0"
+    "loud\0"
+    "lounge\0"
+    "love\0"
+    "loyal\0"
+    "lucky\0"
+    "luggage\0"
+    "lumber\0"
+    "lunar\0"
+    "lunch\0"
+    "luxury\0"
+    "lyrics\0"
+    "machine\0"
+    "mad\0"
+    "magic\0"
+    "magnet\0"
+    "maid\0"
+    "mail\0"
+    "main\0"
+    "major\0"
+    "make\0"
+    "mammal\0"
+    "man\0"
+    "manage\0"
+    "mandate\0"
+    "mango\0"
+    "mansion\0"
+    "manual\0"
+    "maple\0"
+    "marble\0"
+    "march\0"
+    "margin\0"
+    "marine\0"
+    "market\0"
+    "marriage\0"
+    "mask\0"
+    "mass\0"
+    "master\0"
+    "match\0"
+    "material\0"
+    "math\0"
+    "matrix\0"
+    "matter\0"
+    "maximum\0"
+    "maze\0"
+    "meadow\0"
+    "mean\0"
+    "measure\0"
+    "meat\0"
+    "mechanic\0"
+    "medal\0"
+    "media\0"
+    "melody\0"
+    "melt\0"
+    "member\0"
+    "memory\0"
+    "mention\0"
+    "menu\0"
+    "mercy\0"
+    "merge\0"
+    "merit\0"
+    "merry\0"
+    "mesh\0"
+    "message\0"
+    "metal\0"
+    "method\0"
+    "middle\0"
+    "midnight\0"
+    "milk\0"
+    "million\0"
+    "mimic\0"
+    "mind\0"
+    "minimum\0"
+    "minor\0"
+    "minute\0"
+    "miracle\0"
+    "mirror\0"
+    "misery\0"
+    "miss\0"
+    "mistake\0"
+    "mix\0"
+    "mixed\0"
+    "mixture\0"
+    "mobile\0"
+    "model\0"
+    "modify\0"
+    "mom\0"
+    "moment\0"
+    "monitor\0"
+    "monkey\0"
+    "monster\0"
+    "month\0"
+    "moon\0"
+    "moral\0"
+    "more\0"
+    "morning\0"
+    "mosquito\0"
+    "mother\0"
+    "motion\0"
+    "motor\0"
+    "mountain\0"
+    "mouse\0"
+    "move\0"
+    "movie\0"
+    "much\0"
+    "muffin\0"
+    "mule\0"
+    "multiply\0"
+    "muscle\0"
+    "museum\0"
+    "mushroom\0"
+    "music\0"
+    "must\0"
+    "mutual\0"
+    "myself\0"
+    "mystery\0"
+    "myth\0"
+    "naive\0"
+    "name\0"
+    "napkin\0"
+    "narrow\0"
+    "nasty\0"
+    "nation\0"
+    "nature\0"
+    "near\0"
+    "neck\0"
+    "need\0"
+    "negative\0"
+    "neglect\0"
+    "neither\0"
+    "nephew\0"
+    "nerve\0"
+    "nest\0"
+    "net\0"
+    "network\0"
+    "neutral\0"
+    "never\0"
+    "news\0"
+    "next\0"
+    "nice\0"
+    "night\0"
+    "noble\0"
+    "noise\0"
+    "nominee\0"
+    "noodle\0"
+    "normal\0"
+    "north\0"
+    "nose\0"
+    "notable\0"
+    "note\0"
+    "nothing\0"
+    "notice\0"
+    "novel\0"
+    "now\0"
+    "nuclear\0"
+    "number\0"
+    "nurse\0"
+    "nut\0"
+    "oak\0"
+    "obey\0"
+    "object\0"
+    "oblige\0"
+    "obscure\0"
+    "observe\0"
+    "obtain\0"
+    "obvious\0"
+    "occur\0"
+    "ocean\0"
+    "october\0"
+    "odor\0"
+    "off\0"
+    "offer\0"
+    "office\0"
+    "often\0"
+    "oil\0"
+    "okay\0"
+    "old\0"
+    "olive\0"
+    "olympic\0"
+    "omit\0"
+    "once\0"
+    "one\0"
+    "onion\0"
+    "online\0"
+    "only\0"
+    "open\0"
+    "opera\0"
+    "opinion\0"
+    "oppose\0"
+    "option\0"
+    "orange\0"
+    "orbit\0"
+    "orchard\0"
+    "order\0"
+    "ordinary\0"
+    "organ\0"
+    "orient\0"
+    "original\0"
+    "orphan\0"
+    "ostrich\0"
+    "other\0"
+    "outdoor\0"
+    "outer\0"
+    "output\0"
+    "outside\0"
+    "oval\0"
+    "oven\0"
+    "over\0"
+    "own\0"
+    "owner\0"
+    "oxygen\0"
+    "oyster\0"
+    "ozone\0"
+    "pact\0"
+    "paddle\0"
+    "page\0"
+    "pair\0"
+    "palace\0"
+    "palm\0"
+    "panda\0"
+    "panel\0"
+    "panic\0"
+    "panther\0"
+    "paper\0"
+    "parade\0"
+    "parent\0"
+    "park\0"
+    "parrot\0"
+    "party\0"
+    "pass\0"
+    "patch\0"
+    "path\0"
+    "patient\0"
+    "patrol\0"
+    "pattern\0"
+    "pause\0"
+    "pave\0"
+    "payment\0"
+    "peace\0"
+    "peanut\0"
+    "pear\0"
+    "peasant\0"
+    "pelican\0"
+    "pen\0"
+    "penalty\0"
+    "pencil\0"
+    "people\0"
+    "pepper\0"
+    "perfect\0"
+    "permit\0"
+    "person\0"
+    "pet\0"
+    "phone\0"
+    "photo\0"
+    "phrase\0"
+    "physical\0"
+    "piano\0"
+    "picnic\0"
+    "picture\0"
+    "piece\0"
+    "pig\0"
+    "pigeon\0"
+    "pill\0"
+    "pilot\0"
+    "pink\0"
+    "pioneer\0"
+    "pipe\0"
+    "pistol\0"
+    "pitch\0"
+    "pizza\0"
+    "place\0"
+    "planet\0"
+    "plastic\0"
+    "plate\0"
+    "play\0"
+    "please\0"
+    "pledge\0"
+    "pluck\0"
+    "plug\0"
+    "plunge\0"
+    "poem\0"
+    "poet\0"
+    "point\0"
+    "polar\0"
+    "pole\0"
+    "police\0"
+    "pond\0"
+    "pony\0"
+    "pool\0"
+    "popular\0"
+    "portion\0"
+    "position\0"
+    "possible\0"
+    "post\0"
+    "potato\0"
+    "pottery\0"
+    "poverty\0"
+    "powder\0"
+    "power\0"
+    "practice\0"
+    "praise\0"
+    "predict\0"
+    "prefer\0"
+    "prepare\0"
+    "present\0"
+    "pretty\0"
+    "prevent\0"
+    "price\0"
+    "pride\0"
+    "primary\0"
+    "print\0"
+    "priority\0"
+    "prison\0"
+    "private\0"
+    "prize\0"
+    "problem\0"
+    "process\0"
+    "produce\0"
+    "profit\0"
+    "program\0"
+    "project\0"
+    "promote\0"
+    "proof\0"
+    "property\0"
+    "prosper\0"
+    "protect\0"
+    "proud\0"
+    "provide\0"
+    "public\0"
+    "pudding\0"
+    "pull\0"
+    "pulp\0"
+    "pulse\0"
+    "pumpkin\0"
+    "punch\0"
+    "pupil\0"
+    "puppy\0"
+    "purchase\0"
+    "purity\0"
+    "purpose\0"
+    "purse\0"
+    "push\0"
+    "put\0"
+    "puzzle\0"
+    "pyramid\0"
+    "quality\0"
+    "quantum\0"
+    "quarter\0"
+    "question\0"
+    "quick\0"
+    "quit\0"
+    "quiz\0"
+    "quote\0"
+    "rabbit\0"
+    "raccoon\0"
+    "race\0"
+    "rack\0"
+    "radar\0"
+    "radio\0"
+    "rail\0"
+    "rain\0"
+    "raise\0"
+    "rally\0"
+    "ramp\0"
+    "ranch\0"
+    "random\0"
+    "range\0"
+    "rapid\0"
+    "rare\0"
+    "rate\0"
+    "rather\0"
+    "raven\0"
+    "raw\0"
+    "razor\0"
+    "ready\0"
+    "real\0"
+    "reason\0"
+    "rebel\0"
+    "rebuild\0"
+    "recall\0"
+    "receive\0"
+    "recipe\0"
+    "record\0"
+    "recycle\0"
+    "reduce\0"
+    "reflect\0"
+    "reform\0"
+    "refuse\0"
+    "region\0"
+    "regret\0"
+    "regular\0"
+    "reject\0"
+    "relax\0"
+    "release\0"
+    "relief\0"
+    "rely\0"
+    "remain\0"
+    "remember\0"
+    "remind\0"
+    "remove\0"
+    "render\0"
+    "renew\0"
+    "rent\0"
+    "reopen\0"
+    "repair\0"
+    "repeat\0"
+    "replace\0"
+    "report\0"
+    "require\0"
+    "rescue\0"
+    "resemble\0"
+    "resist\0"
+    "resource\0"
+    "response\0"
+    "result\0"
+    "retire\0"
+    "retreat\0"
+    "return\0"
+    "reunion\0"
+    "reveal\0"
+    "review\0"
+    "reward\0"
+    "rhythm\0"
+    "rib\0"
+    "ribbon\0"
+    "rice\0"
+    "rich\0"
+    "ride\0"
+    "ridge\0"
+    "rifle\0"
+    "right\0"
+    "rigid\0"
+    "ring\0"
+    "riot\0"
+    "ripple\0"
+    "risk\0"
+    "ritual\0"
+    "rival\0"
+    "river\0"
+    "road\0"
+    "roast\0"
+    "robot\0"
+    "robust\0"
+    "rocket\0"
+    "romance\0"
+    "roof\0"
+    "rookie\0"
+    "room\0"
+    "rose\0"
+    "rotate\0"
+    "rough\0"
+    "round\0"
+    "route\0"
+    "royal\0"
+    "rubber\0"
+    "rude\0"
+    "rug\0"
+    "rule\0"
+    "run\0"
+    "runway\0"
+    "rural\0"
+    "sad\0"
+    "saddle\0"
+    "sadness\0"
+    "safe\0"
+    "sail\0"
+    "salad\0"
+    "salmon\0"
+    "salon\0"
+    "salt\0"
+    "salute\0"
+    "same\0"
+    "sample\0"
+    "sand\0"
+    "satisfy\0"
+    "satoshi\0"
+    "sauce\0"
+    "sausage\0"
+    "save\0"
+    "say\0"
+    "scale\0"
+    "scan\0"
+    "scare\0"
+    "scatter\0"
+    "scene\0"
+    "scheme\0"
+    "school\0"
+    "science\0"
+    "scissors\0"
+    "scorpion\0"
+    "scout\0"
+    "scrap\0"
+    "screen\0"
+    "script\0"
+    "scrub\0"
+    "sea\0"
+    "search\0"
+    "season\0"
+    "seat\0"
+    "second\0"
+    "secret\0"
+    "section\0"
+    "security\0"
+    "seed\0"
+    "seek\0"
+    "segment\0"
+    "select\0"
+    "sell\0"
+    "seminar\0"
+    "senior\0"
+    "sense\0"
+    "sentence\0"
+    "series\0"
+    "service\0"
+    "session\0"
+    "settle\0"
+    "setup\0"
+    "seven\0"
+    "shadow\0"
+    "shaft\0"
+    "shallow\0"
+    "share\0"
+    "shed\0"
+    "shell\0"
+    "sheriff\0"
+    "shield\0"
+    "shift\0"
+    "shine\0"
+    "ship\0"
+    "shiver\0"
+    "shock\0"
+    "shoe\0"
+    "shoot\0"
+    "shop\0"
+    "short\0"
+    "shoulder\0"
+    "shove\0"
+    "shrimp\0"
+    "shrug\0"
+    "shuffle\0"
+    "shy\0"
+    "sibling\0"
+    "sick\0"
+    "side\0"
+    "siege\0"
+    "sight\0"
+    "sign\0"
+    "silent\0"
+    "silk\0"
+    "silly\0"
+    "silver\0"
+    "similar\0"
+    "simple\0"
+    "since\0"
+    "sing\0"
+    "siren\0"
+    "sister\0"
+    "situate\0"
+    "six\0"
+    "size\0"
+    "skate\0"
+    "sketch\0"
+    "ski\0"
+    "skill\0"
+    "skin\0"
+    "skirt\0"
+    "skull\0"
+    "slab\0"
+    "slam\0"
+    "sleep\0"
+    "slender\0"
+    "slice\0"
+    "slide\0"
+    "slight\0"
+    "slim\0"
+    "slogan\0"
+    "slot\0"
+    "slow\0"
+    "slush\0"
+    "small\0"
+    "smart\0"
+    "smile\0"
+    "smoke\0"
+    "smooth\0"
+    "snack\0"
+    "snake\0"
+    "snap\0"
+    "sniff\0"
+    "snow\0"
+    "soap\0"
+    "soccer\0"
+    "social\0"
+    "sock\0"
+    "soda\0"
+    "soft\0"
+    "solar\0"
+    "soldier\0"
+    "solid\0"
+    "solution\0"
+    "solve\0"
+    "someone\0"
+    "song\0"
+    "soon\0"
+    "sorry\0"
+    "sort\0"
+    "soul\0"
+    "sound\0"
+    "soup\0"
+    "source\0"
+    "south\0"
+    "space\0"
+    "spare\0"
+    "spatial\0"
+    "spawn\0"
+    "speak\0"
+    "special\0"
+    "speed\0"
+    "spell\0"
+    "spend\0"
+    "sphere\0"
+    "spice\0"
+    "spider\0"
+    "spike\0"
+    "spin\0"
+    "spirit\0"
+    "split\0"
+    "spoil\0"
+    "sponsor\0"
+    "spoon\0"
+    "sport\0"
+    "spot\0"
+    "spray\0"
+    "spread\0"
+    "spring\0"
+    "spy\0"
+    "square\0"
+    "squeeze\0"
+    "squirrel\0"
+    "stable\0"
+    "stadium\0"
+    "staff\0"
+    "stage\0"
+    "stairs\0"
+    "stamp\0"
+    "stand\0"
+    "start\0"
+    "state\0"
+    "stay\0"
+    "steak\0"
+    "steel\0"
+    "stem\0"
+    "step\0"
+    "stereo\0"
+    "stick\0"
+    "still\0"
+    "sting\0"
+    "stock\0"
+    "stomach\0"
+    "stone\0"
+    "stool\0"
+    "story\0"
+    "stove\0"
+    "strategy\0"
+    "street\0"
+    "strike\0"
+    "strong\0"
+    "struggle\0"
+    "student\0"
+    "stuff\0"
+    "stumble\0"
+    "style\0"
+    "subject\0"
+    "submit\0"
+    "subway\0"
+    "success\0"
+    "such\0"
+    "sudden\0"
+    "suffer\0"
+    "sugar\0"
+    "suggest\0"
+    "suit\0"
+    "summer\0"
+    "sun\0"
+    "sunny\0"
+    "sunset\0"
+    "super\0"
+    "supply\0"
+    "supreme\0"
+    "sure\0"
+    "surface\0"
+    "surge\0"
+    "surprise\0"
+    "surround\0"
+    "survey\0"
+    "suspect\0"
+    "sustain\0"
+    "swallow\0"
+    "swamp\0"
+    "swap\0"
+    "swarm\0"
+    "swear\0"
+    "sweet\0"
+    "swift\0"
+    "swim\0"
+    "swing\0"
+    "switch\0"
+    "sword\0"
+    "symbol\0"
+    "symptom\0"
+    "syrup\0"
+    "system\0"
+    "table\0"
+    "tackle\0"
+    "tag\0"
+    "tail\0"
+    "talent\0"
+    "talk\0"
+    "tank\0"
+    "tape\0"
+    "target\0"
+    "task\0"
+    "taste\0"
+    "tattoo\0"
+    "taxi\0"
+    "teach\0"
+    "team\0"
+    "tell\0"
+    "ten\0"
+    "tenant\0"
+    "tennis\0"
+    "tent\0"
+    "term\0"
+    "test\0"
+    "text\0"
+    "thank\0"
+    "that\0"
+    "theme\0"
+    "then\0"
+    "theory\0"
+    "there\0"
+    "they\0"
+    "thing\0"
+    "this\0"
+    "thought\0"
+    "three\0"
+    "thrive\0"
+    "throw\0"
+    "thumb\0"
+    "thunder\0"
+    "ticket\0"
+    "tide\0"
+    "tiger\0"
+    "tilt\0"
+    "timber\0"
+    "time\0"
+    "tiny\0"
+    "tip\0"
+    "tired\0"
+    "tissue\0"
+    "title\0"
+    "toast\0"
+    "tobacco\0"
+    "today\0"
+    "toddler\0"
+    "toe\0"
+    "together\0"
+    "toilet\0"
+    "token\0"
+    "tomato\0"
+    "tomorrow\0"
+    "tone\0"
+    "tongue\0"
+    "tonight\0"
+    "tool\0"
+    "tooth\0"
+    "top\0"
+    "topic\0"
+    "topple\0"
+    "torch\0"
+    "tornado\0"
+    "tortoise\0"
+    "toss\0"
+    "total\0"
+    "tourist\0"
+    "toward\0"
+    "tower\0"
+    "town\0"
+    "toy\0"
+    "track\0"
+    "trade\0"
+    "traffic\0"
+    "tragic\0"
+    "train\0"
+    "transfer\0"
+    "trap\0"
+    "trash\0"
+    "travel\0"
+    "tray\0"
+    "treat\0"
+    "tree\0"
+    "trend\0"
+    "trial\0"
+    "tribe\0"
+    "trick\0"
+    "trigger\0"
+    "trim\0"
+    "trip\0"
+    "trophy\0"
+    "trouble\0"
+    "truck\0"
+    "true\0"
+    "truly\0"
+    "trumpet\0"
+    "trust\0"
+    "truth\0"
+    "try\0"
+    "tube\0"
+    "tuition\0"
+    "tumble\0"
+    "tuna\0"
+    "tunnel\0"
+    "turkey\0"
+    "turn\0"
+    "turtle\0"
+    "twelve\0"
+    "twenty\0"
+    "twice\0"
+    "twin\0"
+    "twist\0"
+    "two\0"
+    "type\0"
+    "typical\0"
+    "ugly\0"
+    "umbrella\0"
+    "unable\0"
+    "unaware\0"
+    "uncle\0"
+    "uncover\0"
+    "under\0"
+    "undo\0"
+    "unfair\0"
+    "unfold\0"
+    "unhappy\0"
+    "uniform\0"
+    "unique\0"
+    "unit\0"
+    "universe\0"
+    "unknown\0"
+    "unlock\0"
+    "until\0"
+    "unusual\0"
+    "unveil\0"
+    "update\0"
+    "upgrade\0"
+    "uphold\0"
+    "upon\0"
+    "upper\0"
+    "upset\0"
+    "urban\0"
+    "urge\0"
+    "usage\0"
+    "use\0"
+    "used\0"
+    "useful\0"
+    "useless\0"
+    "usual\0"
+    "utility\0"
+    "vacant\0"
+    "vacuum\0"
+    "vague\0"
+    "valid\0"
+    "valley\0"
+    "valve\0"
+    "van\0"
+    "vanish\0"
+    "vapor\0"
+    "various\0"
+    "vast\0"
+    "vault\0"
+    "vehicle\0"
+    "velvet\0"
+    "vendor\0"
+    "venture\0"
+    "venue\0"
+    "verb\0"
+    "verify\0"
+    "version\0"
+    "very\0"
+    "vessel\0"
+    "veteran\0"
+    "viable\0"
+    "vibrant\0"
+    "vicious\0"
+    "victory\0"
+    "video\0"
+    "view\0"
+    "village\0"
+    "vintage\0"
+    "violin\0"
+    "virtual\0"
+    "virus\0"
+    "visa\0"
+    "visit\0"
+    "visual\0"
+    "vital\0"
+    "vivid\0"
+    "vocal\0"
+    "voice\0"
+    "void\0"
+    "volcano\0"
+    "volume\0"
+    "vote\0"
+    "voyage\0"
+    "wage\0"
+    "wagon\0"
+    "wait\0"
+    "walk\0"
+    "wall\0"
+    "walnut\0"
+    "want\0"
+    "warfare\0"
+    "warm\0"
+    "warrior\0"
+    "wash\0"
+    "wasp\0"
+    "waste\0"
+    "water\0"
+    "wave\0"
+    "way\0"
+    "wealth\0"
+    "weapon\0"
+    "wear\0"
+    "weasel\0"
+    "weather\0"
+    "web\0"
+    "wedding\0"
+    "weekend\0"
+    "weird\0"
+    "welcome\0"
+    "west\0"
+    "wet\0"
+    "whale\0"
+    "what\0"
+    "wheat\0"
+    "wheel\0"
+    "when\0"
+    "where\0"
+    "whip\0"
+    "whisper\0"
+    "wide\0"
+    "width\0"
+    "wife\0"
+    "wild\0"
+    "will\0"
+    "win\0"
+    "window\0"
+    "wine\0"
+    "wing\0"
+    "wink\0"
+    "winner\0"
+    "winter\0"
+    "wire\0"
+    "wisdom\0"
+    "wise\0"
+    "wish\0"
+    "witness\0"
+    "wolf\0"
+    "woman\0"
+    "wonder\0"
+    "wood\0"
+    "wool\0"
+    "word\0"
+    "work\0"
+    "world\0"
+    "worry\0"
+    "worth\0"
+    "wrap\0"
+    "wreck\0"
+    "wrestle\0"
+    "wrist\0"
+    "write\0"
+    "wrong\0"
+    "yard\0"
+    "year\0"
+    "yellow\0"
+    "you\0"
+    "young\0"
+    "youth\0"
+    "zebra\0"
+    "zero\0"
+    "zone\0"
+    "zoo";
+
+static const uint16_t en_offsets[dictionary_size] =
 {
-    {
-        "abandon",
-        "ability",
-        "able",
-        "about",
-        "above",
-        "absent",
-        "absorb",
-        "abstract",
-        "absurd",
-        "abuse",
-        "access",
-        "accident",
-        "account",
-        "accuse",
-        "achieve",
-        "acid",
-        "acoustic",
-        "acquire",
-        "across",
-        "act",
-        "action",
-        "actor",
-        "actress",
-        "actual",
-        "adapt",
-        "add",
-        "addict",
-        "address",
-        "adjust",
-        "admit",
-        "adult",
-        "advance",
-        "advice",
-        "aerobic",
-        "affair",
-        "afford",
-        "afraid",
-        "again",
-        "age",
-        "agent",
-        "agree",
-        "ahead",
-        "aim",
-        "air",
-        "airport",
-        "aisle",
-        "alarm",
-        "album",
-        "alcohol",
-        "alert",
-        "alien",
-        "all",
-        "alley",
-        "allow",
-        "almost",
-        "alone",
-        "alpha",
-        "already",
-        "also",
-        "alter",
-        "always",
-        "amateur",
-        "amazing",
-        "among",
-        "amount",
-        "amused",
-        "analyst",
-        "anchor",
-        "ancient",
-        "anger",
-        "angle",
-        "angry",
-        "animal",
-        "ankle",
-        "announce",
-        "annual",
-        "another",
-        "answer",
-        "antenna",
-        "antique",
-        "anxiety",
-        "any",
-        "apart",
-        "apology",
-        "appear",
-        "apple",
-        "approve",
-        "april",
-        "arch",
-        "arctic",
-        "area",
-        "arena",
-        "argue",
-        "arm",
-        "armed",
-        "armor",
-        "army",
-        "around",
-        "arrange",
-        "arrest",
-        "arrive",
-        "arrow",
-        "art",
-        "artefact",
-        "artist",
-        "artwork",
-        "ask",
-        "aspect",
-        "assault",
-        "asset",
-        "assist",
-        "assume",
-        "asthma",
-        "athlete",
-        "atom",
-        "attack",
-        "attend",
-        "attitude",
-        "attract",
-        "auction",
-        "audit",
-        "august",
-        "aunt",
-        "author",
-        "auto",
-        "autumn",
-        "average",
-        "avocado",
-        "avoid",
-        "awake",
-        "aware",
-        "away",
-        "awesome",
-        "awful",
-        "awkward",
-        "axis",
-        "baby",
-        "bachelor",
-        "bacon",
-        "badge",
-        "bag",
-        "balance",
-        "balcony",
-        "ball",
-        "bamboo",
-        "banana",
-        "banner",
-        "bar",
-        "barely",
-        "bargain",
-        "barrel",
-        "base",
-        "basic",
-        "basket",
-        "battle",
-        "beach",
-        "bean",
-        "beauty",
-        "because",
-        "become",
-        "beef",
-        "before",
-        "begin",
-        "behave",
-        "behind",
-        "believe",
-        "below",
-        "belt",
-        "bench",
-        "benefit",
-        "best",
-        "betray",
-        "better",
-        "between",
-        "beyond",
-        "bicycle",
-        "bid",
-        "bike",
-        "bind",
-        "biology",
-        "bird",
-        "birth",
-        "bitter",
-        "black",
-        "blade",
-        "blame",
-        "blanket",
-        "blast",
-        "bleak",
-        "bless",
-        "blind",
-        "blood",
-        "blossom",
-        "blouse",
-        "blue",
-        "blur",
-        "blush",
-        "board",
-        "boat",
-        "body",
-        "boil",
-        "bomb",
-        "bone",
-        "bonus",
-        "book",
-        "boost",
-        "border",
-        "boring",
-        "borrow",
-        "boss",
-        "bottom",
-        "bounce",
-        "box",
-        "boy",
-        "bracket",
-        "brain",
-        "brand",
-        "brass",
-        "brave",
-        "bread",
-        "breeze",
-        "brick",
-        "bridge",
-        "brief",
-        "bright",
-        "bring",
-        "brisk",
-        "broccoli",
-        "broken",
-        "bronze",
-        "broom",
-        "brother",
-        "brown",
-        "brush",
-        "bubble",
-        "buddy",
-        "budget",
-        "buffalo",
-        "build",
-        "bulb",
-        "bulk",
-        "bullet",
-        "bundle",
-        "bunker",
-        "burden",
-        "burger",
-        "burst",
-        "bus",
-        "business",
-        "busy",
-        "butter",
-        "buyer",
-        "buzz",
-        "cabbage",
-        "cabin",
-        "cable",
-        "cactus",
-        "cage",
-        "cake",
-        "call",
-        "calm",
-        "camera",
-        "camp",
-        "can",
-        "canal",
-        "cancel",
-        "candy",
-        "cannon",
-        "canoe",
-        "canvas",
-        "canyon",
-        "capable",
-        "capital",
-        "captain",
-        "car",
-        "carbon",
-        "card",
-        "cargo",
-        "carpet",
-        "carry",
-        "cart",
-        "case",
-        "cash",
-        "casino",
-        "castle",
-        "casual",
-        "cat",
-        "catalog",
-        "catch",
-        "category",
-        "cattle",
-        "caught",
-        "cause",
-        "caution",
-        "cave",
-        "ceiling",
-        "celery",
-        "cement",
-        "census",
-        "century",
-        "cereal",
-        "certain",
-        "chair",
-        "chalk",
-        "champion",
-        "change",
-        "chaos",
-        "chapter",
-        "charge",
-        "chase",
-        "chat",
-        "cheap",
-        "check",
-        "cheese",
-        "chef",
-        "cherry",
-        "chest",
-        "chicken",
-        "chief",
-        "child",
-        "chimney",
-        "choice",
-        "choose",
-        "chronic",
-        "chuckle",
-        "chunk",
-        "churn",
-        "cigar",
-        "cinnamon",
-        "circle",
-        "citizen",
-        "city",
-        "civil",
-        "claim",
-        "clap",
-        "clarify",
-        "claw",
-        "clay",
-        "clean",
-        "clerk",
-        "clever",
-        "click",
-        "client",
-        "cliff",
-        "climb",
-        "clinic",
-        "clip",
-        "clock",
-        "clog",
-        "close",
-        "cloth",
-        "cloud",
-        "clown",
-        "club",
-        "clump",
-        "cluster",
-        "clutch",
-        "coach",
-        "coast",
-        "coconut",
-        "code",
-        "coffee",
-        "coil",
-        "coin",
-        "collect",
-        "color",
-        "column",
-        "combine",
-        "come",
-        "comfort",
-        "comic",
-        "common",
-        "company",
-        "concert",
-        "conduct",
-        "confirm",
-        "congress",
-        "connect",
-        "consider",
-        "control",
-        "convince",
-        "cook",
-        "cool",
-        "copper",
-        "copy",
-        "coral",
-        "core",
-        "corn",
-        "correct",
-        "cost",
-        "cotton",
-        "couch",
-        "country",
-        "couple",
-        "course",
-        "cousin",
-        "cover",
-        "coyote",
-        "crack",
-        "cradle",
-        "craft",
-        "cram",
-        "crane",
-        "crash",
-        "crater",
-        "crawl",
-        "crazy",
-        "cream",
-        "credit",
-        "creek",
-        "crew",
-        "cricket",
-        "crime",
-        "crisp",
-        "critic",
-        "crop",
-        "cross",
-        "crouch",
-        "crowd",
-        "crucial",
-        "cruel",
-        "cruise",
-        "crumble",
-        "crunch",
-        "crush",
-        "cry",
-        "crystal",
-        "cube",
-        "culture",
-        "cup",
-        "cupboard",
-        "curious",
-        "current",
-        "curtain",
-        "curve",
-        "cushion",
-        "custom",
-        "cute",
-        "cycle",
-        "dad",
-        "damage",
-        "damp",
-        "dance",
-        "danger",
-        "daring",
-        "dash",
-        "daughter",
-        "dawn",
-        "day",
-        "deal",
-        "debate",
-        "debris",
-        "decade",
-        "december",
-        "decide",
-        "decline",
-        "decorate",
-        "decrease",
-        "deer",
-        "defense",
-        "define",
-        "defy",
-        "degree",
-        "delay",
-        "deliver",
-        "demand",
-        "demise",
-        "denial",
-        "dentist",
-        "deny",
-        "depart",
-        "depend",
-        "deposit",
-        "depth",
-        "deputy",
-        "derive",
-        "describe",
-        "desert",
-        "design",
-        "desk",
-        "despair",
-        "destroy",
-        "detail",
-        "detect",
-        "develop",
-        "device",
-        "devote",
-        "diagram",
-        "dial",
-        "diamond",
-        "diary",
-        "dice",
-        "diesel",
-        "diet",
-        "differ",
-        "digital",
-        "dignity",
-        "dilemma",
-        "dinner",
-        "dinosaur",
-        "direct",
-        "dirt",
-        "disagree",
-        "discover",
-        "disease",
-        "dish",
-        "dismiss",
-        "disorder",
-        "display",
-        "distance",
-        "divert",
-        "divide",
-        "divorce",
-        "dizzy",
-        "doctor",
-        "document",
-        "dog",
-        "doll",
-        "dolphin",
-        "domain",
-        "donate",
-        "donkey",
-        "donor",
-        "door",
-        "dose",
-        "double",
-        "dove",
-        "draft",
-        "dragon",
-        "drama",
-        "drastic",
-        "draw",
-        "dream",
-        "dress",
-        "drift",
-        "drill",
-        "drink",
-        "drip",
-        "drive",
-        "drop",
-        "drum",
-        "dry",
-        "duck",
-        "dumb",
-        "dune",
-        "during",
-        "dust",
-        "dutch",
-        "duty",
-        "dwarf",
-        "dynamic",
-        "eager",
-        "eagle",
-        "early",
-        "earn",
-        "earth",
-        "easily",
-        "east",
-        "easy",
-        "echo",
-        "ecology",
-        "economy",
-        "edge",
-        "edit",
-        "educate",
-        "effort",
-        "egg",
-        "eight",
-        "either",
-        "elbow",
-        "elder",
-        "electric",
-        "elegant",
-        "element",
-        "elephant",
-        "elevator",
-        "elite",
-        "else",
-        "embark",
-        "embody",
-        "embrace",
-        "emerge",
-        "emotion",
-        "employ",
-        "empower",
-        "empty",
-        "enable",
-        "enact",
-        "end",
-        "endless",
-        "endorse",
-        "enemy",
-        "energy",
-        "enforce",
-        "engage",
-        "engine",
-        "enhance",
-        "enjoy",
-        "enlist",
-        "enough",
-        "enrich",
-        "enroll",
-        "ensure",
-        "enter",
-        "entire",
-        "entry",
-        "envelope",
-        "episode",
-        "equal",
-        "equip",
-        "era",
-        "erase",
-        "erode",
-        "erosion",
-        "error",
-        "erupt",
-        "escape",
-        "essay",
-        "essence",
-        "estate",
-        "eternal",
-        "ethics",
-        "evidence",
-        "evil",
-        "evoke",
-        "evolve",
-        "exact",
-        "example",
-        "excess",
-        "exchange",
-        "excite",
-        "exclude",
-        "excuse",
-        "execute",
-        "exercise",
-        "exhaust",
-        "exhibit",
-        "exile",
-        "exist",
-        "exit",
-        "exotic",
-        "expand",
-        "expect",
-        "expire",
-        "explain",
-        "expose",
-        "express",
-        "extend",
-        "extra",
-        "eye",
-        "eyebrow",
-        "fabric",
-        "face",
-        "faculty",
-        "fade",
-        "faint",
-        "faith",
-        "fall",
-        "false",
-        "fame",
-        "family",
-        "famous",
-        "fan",
-        "fancy",
-        "fantasy",
-        "farm",
-        "fashion",
-        "fat",
-        "fatal",
-        "father",
-        "fatigue",
-        "fault",
-        "favorite",
-        "feature",
-        "february",
-        "federal",
-        "fee",
-        "feed",
-        "feel",
-        "female",
-        "fence",
-        "festival",
-        "fetch",
-        "fever",
-        "few",
-        "fiber",
-        "fiction",
-        "field",
-        "figure",
-        "file",
-        "film",
-        "filter",
-        "final",
-        "find",
-        "fine",
-        "finger",
-        "finish",
-        "fire",
-        "firm",
-        "first",
-        "fiscal",
-        "fish",
-        "fit",
-        "fitness",
-        "fix",
-        "flag",
-        "flame",
-        "flash",
-        "flat",
-        "flavor",
-        "flee",
-        "flight",
-        "flip",
-        "float",
-        "flock",
-        "floor",
-        "flower",
-        "fluid",
-        "flush",
-        "fly",
-        "foam",
-        "focus",
-        "fog",
-        "foil",
-        "fold",
-        "follow",
-        "food",
-        "foot",
-        "force",
-        "forest",
-        "forget",
-        "fork",
-        "fortune",
-        "forum",
-        "forward",
-        "fossil",
-        "foster",
-        "found",
-        "fox",
-        "fragile",
-        "frame",
-        "frequent",
-        "fresh",
-        "friend",
-        "fringe",
-        "frog",
-        "front",
-        "frost",
-        "frown",
-        "frozen",
-        "fruit",
-        "fuel",
-        "fun",
-        "funny",
-        "furnace",
-        "fury",
-        "future",
-        "gadget",
-        "gain",
-        "galaxy",
-        "gallery",
-        "game",
-        "gap",
-        "garage",
-        "garbage",
-        "garden",
-        "garlic",
-        "garment",
-        "gas",
-        "gasp",
-        "gate",
-        "gather",
-        "gauge",
-        "gaze",
-        "general",
-        "genius",
-        "genre",
-        "gentle",
-        "genuine",
-        "gesture",
-        "ghost",
-        "giant",
-        "gift",
-        "giggle",
-        "ginger",
-        "giraffe",
-        "girl",
-        "give",
-        "glad",
-        "glance",
-        "glare",
-        "glass",
-        "glide",
-        "glimpse",
-        "globe",
-        "gloom",
-        "glory",
-        "glove",
-        "glow",
-        "glue",
-        "goat",
-        "goddess",
-        "gold",
-        "good",
-        "goose",
-        "gorilla",
-        "gospel",
-        "gossip",
-        "govern",
-        "gown",
-        "grab",
-        "grace",
-        "grain",
-        "grant",
-        "grape",
-        "grass",
-        "gravity",
-        "great",
-        "green",
-        "grid",
-        "grief",
-        "grit",
-        "grocery",
-        "group",
-        "grow",
-        "grunt",
-        "guard",
-        "guess",
-        "guide",
-        "guilt",
-        "guitar",
-        "gun",
-        "gym",
-        "habit",
-        "hair",
-        "half",
-        "hammer",
-        "hamster",
-        "hand",
-        "happy",
-        "harbor",
-        "hard",
-        "harsh",
-        "harvest",
-        "hat",
-        "have",
-        "hawk",
-        "hazard",
-        "head",
-        "health",
-        "heart",
-        "heavy",
-        "hedgehog",
-        "height",
-        "hello",
-        "helmet",
-        "help",
-        "hen",
-        "hero",
-        "hidden",
-        "high",
-        "hill",
-        "hint",
-        "hip",
-        "hire",
-        "history",
-        "hobby",
-        "hockey",
-        "hold",
-        "hole",
-        "holiday",
-        "hollow",
-        "home",
-        "honey",
-        "hood",
-        "hope",
-        "horn",
-        "horror",
-        "horse",
-        "hospital",
-        "host",
-        "hotel",
-        "hour",
-        "hover",
-        "hub",
-        "huge",
-        "human",
-        "humble",
-        "humor",
-        "hundred",
-        "hungry",
-        "hunt",
-        "hurdle",
-        "hurry",
-        "hurt",
-        "husband",
-        "hybrid",
-        "ice",
-        "icon",
-        "idea",
-        "identify",
-        "idle",
-        "ignore",
-        "ill",
-        "illegal",
-        "illness",
-        "image",
-        "imitate",
-        "immense",
-        "immune",
-        "impact",
-        "impose",
-        "improve",
-        "impulse",
-        "inch",
-        "include",
-        "income",
-        "increase",
-        "index",
-        "indicate",
-        "indoor",
-        "industry",
-        "infant",
-        "inflict",
-        "inform",
-        "inhale",
-        "inherit",
-        "initial",
-        "inject",
-        "injury",
-        "inmate",
-        "inner",
-        "innocent",
-        "input",
-        "inquiry",
-        "insane",
-        "insect",
-        "inside",
-        "inspire",
-        "install",
-        "intact",
-        "interest",
-        "into",
-        "invest",
-        "invite",
-        "involve",
-        "iron",
-        "island",
-        "isolate",
-        "issue",
-        "item",
-        "ivory",
-        "jacket",
-        "jaguar",
-        "jar",
-        "jazz",
-        "jealous",
-        "jeans",
-        "jelly",
-        "jewel",
-        "job",
-        "join",
-        "joke",
-        "journey",
-        "joy",
-        "judge",
-        "juice",
-        "jump",
-        "jungle",
-        "junior",
-        "junk",
-        "just",
-        "kangaroo",
-        "keen",
-        "keep",
-        "ketchup",
-        "key",
-        "kick",
-        "kid",
-        "kidney",
-        "kind",
-        "kingdom",
-        "kiss",
-        "kit",
-        "kitchen",
-        "kite",
-        "kitten",
-        "kiwi",
-        "knee",
-        "knife",
-        "knock",
-        "know",
-        "lab",
-        "label",
-        "labor",
-        "ladder",
-        "lady",
-        "lake",
-        "lamp",
-        "language",
-        "laptop",
-        "large",
-        "later",
-        "latin",
-        "laugh",
-        "laundry",
-        "lava",
-        "law",
-        "lawn",
-        "lawsuit",
-        "layer",
-        "lazy",
-        "leader",
-        "leaf",
-        "learn",
-        "leave",
-        "lecture",
-        "left",
-        "leg",
-        "legal",
-        "legend",
-        "leisure",
-        "lemon",
-        "lend",
-        "length",
-        "lens",
-        "leopard",
-        "lesson",
-        "letter",
-        "level",
-        "liar",
-        "liberty",
-        "library",
-        "license",
-        "life",
-        "lift",
-        "light",
-        "like",
-        "limb",
-        "limit",
-        "link",
-        "lion",
-        "liquid",
-        "list",
-        "little",
-        "live",
-        "lizard",
-        "load",
-        "loan",
-        "lobster",
-        "local",
-        "lock",
-        "logic",
-        "lonely",
-        "long",
-        "loop",
-        "lottery",
-        "loud",
-        "lounge",
-        "love",
-        "loyal",
-        "lucky",
-        "luggage",
-        "lumber",
-        "lunar",
-        "lunch",
-        "luxury",
-        "lyrics",
-        "machine",
-        "mad",
-        "magic",
-        "magnet",
-        "maid",
-        "mail",
-        "main",
-        "major",
-        "make",
-        "mammal",
-        "man",
-        "manage",
-        "mandate",
-        "mango",
-        "mansion",
-        "manual",
-        "maple",
-        "marble",
-        "march",
-        "margin",
-        "marine",
-        "market",
-        "marriage",
-        "mask",
-        "mass",
-        "master",
-        "match",
-        "material",
-        "math",
-        "matrix",
-        "matter",
-        "maximum",
-        "maze",
-        "meadow",
-        "mean",
-        "measure",
-        "meat",
-        "mechanic",
-        "medal",
-        "media",
-        "melody",
-        "melt",
-        "member",
-        "memory",
-        "mention",
-        "menu",
-        "mercy",
-        "merge",
-        "merit",
-        "merry",
-        "mesh",
-        "message",
-        "metal",
-        "method",
-        "middle",
-        "midnight",
-        "milk",
-        "million",
-        "mimic",
-        "mind",
-        "minimum",
-        "minor",
-        "minute",
-        "miracle",
-        "mirror",
-        "misery",
-        "miss",
-        "mistake",
-        "mix",
-        "mixed",
-        "mixture",
-        "mobile",
-        "model",
-        "modify",
-        "mom",
-        "moment",
-        "monitor",
-        "monkey",
-        "monster",
-        "month",
-        "moon",
-        "moral",
-        "more",
-        "morning",
-        "mosquito",
-        "mother",
-        "motion",
-        "motor",
-        "mountain",
-        "mouse",
-        "move",
-        "movie",
-        "much",
-        "muffin",
-        "mule",
-        "multiply",
-        "muscle",
-        "museum",
-        "mushroom",
-        "music",
-        "must",
-        "mutual",
-        "myself",
-        "mystery",
-        "myth",
-        "naive",
-        "name",
-        "napkin",
-        "narrow",
-        "nasty",
-        "nation",
-        "nature",
-        "near",
-        "neck",
-        "need",
-        "negative",
-        "neglect",
-        "neither",
-        "nephew",
-        "nerve",
-        "nest",
-        "net",
-        "network",
-        "neutral",
-        "never",
-        "news",
-        "next",
-        "nice",
-        "night",
-        "noble",
-        "noise",
-        "nominee",
-        "noodle",
-        "normal",
-        "north",
-        "nose",
-        "notable",
-        "note",
-        "nothing",
-        "notice",
-        "novel",
-        "now",
-        "nuclear",
-        "number",
-        "nurse",
-        "nut",
-        "oak",
-        "obey",
-        "object",
-        "oblige",
-        "obscure",
-        "observe",
-        "obtain",
-        "obvious",
-        "occur",
-        "ocean",
-        "october",
-        "odor",
-        "off",
-        "offer",
-        "office",
-        "often",
-        "oil",
-        "okay",
-        "old",
-        "olive",
-        "olympic",
-        "omit",
-        "once",
-        "one",
-        "onion",
-        "online",
-        "only",
-        "open",
-        "opera",
-        "opinion",
-        "oppose",
-        "option",
-        "orange",
-        "orbit",
-        "orchard",
-        "order",
-        "ordinary",
-        "organ",
-        "orient",
-        "original",
-        "orphan",
-        "ostrich",
-        "other",
-        "outdoor",
-        "outer",
-        "output",
-        "outside",
-        "oval",
-        "oven",
-        "over",
-        "own",
-        "owner",
-        "oxygen",
-        "oyster",
-        "ozone",
-        "pact",
-        "paddle",
-        "page",
-        "pair",
-        "palace",
-        "palm",
-        "panda",
-        "panel",
-        "panic",
-        "panther",
-        "paper",
-        "parade",
-        "parent",
-        "park",
-        "parrot",
-        "party",
-        "pass",
-        "patch",
-        "path",
-        "patient",
-        "patrol",
-        "pattern",
-        "pause",
-        "pave",
-        "payment",
-        "peace",
-        "peanut",
-        "pear",
-        "peasant",
-        "pelican",
-        "pen",
-        "penalty",
-        "pencil",
-        "people",
-        "pepper",
-        "perfect",
-        "permit",
-        "person",
-        "pet",
-        "phone",
-        "photo",
-        "phrase",
-        "physical",
-        "piano",
-        "picnic",
-        "picture",
-        "piece",
-        "pig",
-        "pigeon",
-        "pill",
-        "pilot",
-        "pink",
-        "pioneer",
-        "pipe",
-        "pistol",
-        "pitch",
-        "pizza",
-        "place",
-        "planet",
-        "plastic",
-        "plate",
-        "play",
-        "please",
-        "pledge",
-        "pluck",
-        "plug",
-        "plunge",
-        "poem",
-        "poet",
-        "point",
-        "polar",
-        "pole",
-        "police",
-        "pond",
-        "pony",
-        "pool",
-        "popular",
-        "portion",
-        "position",
-        "possible",
-        "post",
-        "potato",
-        "pottery",
-        "poverty",
-        "powder",
-        "power",
-        "practice",
-        "praise",
-        "predict",
-        "prefer",
-        "prepare",
-        "present",
-        "pretty",
-        "prevent",
-        "price",
-        "pride",
-        "primary",
-        "print",
-        "priority",
-        "prison",
-        "private",
-        "prize",
-        "problem",
-        "process",
-        "produce",
-        "profit",
-        "program",
-        "project",
-        "promote",
-        "proof",
-        "property",
-        "prosper",
-        "protect",
-        "proud",
-        "provide",
-        "public",
-        "pudding",
-        "pull",
-        "pulp",
-        "pulse",
-        "pumpkin",
-        "punch",
-        "pupil",
-        "puppy",
-        "purchase",
-        "purity",
-        "purpose",
-        "purse",
-        "push",
-        "put",
-        "puzzle",
-        "pyramid",
-        "quality",
-        "quantum",
-        "quarter",
-        "question",
-        "quick",
-        "quit",
-        "quiz",
-        "quote",
-        "rabbit",
-        "raccoon",
-        "race",
-        "rack",
-        "radar",
-        "radio",
-        "rail",
-        "rain",
-        "raise",
-        "rally",
-        "ramp",
-        "ranch",
-        "random",
-        "range",
-        "rapid",
-        "rare",
-        "rate",
-        "rather",
-        "raven",
-        "raw",
-        "razor",
-        "ready",
-        "real",
-        "reason",
-        "rebel",
-        "rebuild",
-        "recall",
-        "receive",
-        "recipe",
-        "record",
-        "recycle",
-        "reduce",
-        "reflect",
-        "reform",
-        "refuse",
-        "region",
-        "regret",
-        "regular",
-        "reject",
-        "relax",
-        "release",
-        "relief",
-        "rely",
-        "remain",
-        "remember",
-        "remind",
-        "remove",
-        "render",
-        "renew",
-        "rent",
-        "reopen",
-        "repair",
-        "repeat",
-        "replace",
-        "report",
-        "require",
-        "rescue",
-        "resemble",
-        "resist",
-        "resource",
-        "response",
-        "result",
-        "retire",
-        "retreat",
-        "return",
-        "reunion",
-        "reveal",
-        "review",
-        "reward",
-        "rhythm",
-        "rib",
-        "ribbon",
-        "rice",
-        "rich",
-        "ride",
-        "ridge",
-        "rifle",
-        "right",
-        "rigid",
-        "ring",
-        "riot",
-        "ripple",
-        "risk",
-        "ritual",
-        "rival",
-        "river",
-        "road",
-        "roast",
-        "robot",
-        "robust",
-        "rocket",
-        "romance",
-        "roof",
-        "rookie",
-        "room",
-        "rose",
-        "rotate",
-        "rough",
-        "round",
-        "route",
-        "royal",
-        "rubber",
-        "rude",
-        "rug",
-        "rule",
-        "run",
-        "runway",
-        "rural",
-        "sad",
-        "saddle",
-        "sadness",
-        "safe",
-        "sail",
-        "salad",
-        "salmon",
-        "salon",
-        "salt",
-        "salute",
-        "same",
-        "sample",
-        "sand",
-        "satisfy",
-        "satoshi",
-        "sauce",
-        "sausage",
-        "save",
-        "say",
-        "scale",
-        "scan",
-        "scare",
-        "scatter",
-        "scene",
-        "scheme",
-        "school",
-        "science",
-        "scissors",
-        "scorpion",
-        "scout",
-        "scrap",
-        "screen",
-        "script",
-        "scrub",
-        "sea",
-        "search",
-        "season",
-        "seat",
-        "second",
-        "secret",
-        "section",
-        "security",
-        "seed",
-        "seek",
-        "segment",
-        "select",
-        "sell",
-        "seminar",
-        "senior",
-        "sense",
-        "sentence",
-        "series",
-        "service",
-        "session",
-        "settle",
-        "setup",
-        "seven",
-        "shadow",
-        "shaft",
-        "shallow",
-        "share",
-        "shed",
-        "shell",
-        "sheriff",
-        "shield",
-        "shift",
-        "shine",
-        "ship",
-        "shiver",
-        "shock",
-        "shoe",
-        "shoot",
-        "shop",
-        "short",
-        "shoulder",
-        "shove",
-        "shrimp",
-        "shrug",
-        "shuffle",
-        "shy",
-        "sibling",
-        "sick",
-        "side",
-        "siege",
-        "sight",
-        "sign",
-        "silent",
-        "silk",
-        "silly",
-        "silver",
-        "similar",
-        "simple",
-        "since",
-        "sing",
-        "siren",
-        "sister",
-        "situate",
-        "six",
-        "size",
-        "skate",
-        "sketch",
-        "ski",
-        "skill",
-        "skin",
-        "skirt",
-        "skull",
-        "slab",
-        "slam",
-        "sleep",
-        "slender",
-        "slice",
-        "slide",
-        "slight",
-        "slim",
-        "slogan",
-        "slot",
-        "slow",
-        "slush",
-        "small",
-        "smart",
-        "smile",
-        "smoke",
-        "smooth",
-        "snack",
-        "snake",
-        "snap",
-        "sniff",
-        "snow",
-        "soap",
-        "soccer",
-        "social",
-        "sock",
-        "soda",
-        "soft",
-        "solar",
-        "soldier",
-        "solid",
-        "solution",
-        "solve",
-        "someone",
-        "song",
-        "soon",
-        "sorry",
-        "sort",
-        "soul",
-        "sound",
-        "soup",
-        "source",
-        "south",
-        "space",
-        "spare",
-        "spatial",
-        "spawn",
-        "speak",
-        "special",
-        "speed",
-        "spell",
-        "spend",
-        "sphere",
-        "spice",
-        "spider",
-        "spike",
-        "spin",
-        "spirit",
-        "split",
-        "spoil",
-        "sponsor",
-        "spoon",
-        "sport",
-        "spot",
-        "spray",
-        "spread",
-        "spring",
-        "spy",
-        "square",
-        "squeeze",
-        "squirrel",
-        "stable",
-        "stadium",
-        "staff",
-        "stage",
-        "stairs",
-        "stamp",
-        "stand",
-        "start",
-        "state",
-        "stay",
-        "steak",
-        "steel",
-        "stem",
-        "step",
-        "stereo",
-        "stick",
-        "still",
-        "sting",
-        "stock",
-        "stomach",
-        "stone",
-        "stool",
-        "story",
-        "stove",
-        "strategy",
-        "street",
-        "strike",
-        "strong",
-        "struggle",
-        "student",
-        "stuff",
-        "stumble",
-        "style",
-        "subject",
-        "submit",
-        "subway",
-        "success",
-        "such",
-        "sudden",
-        "suffer",
-        "sugar",
-        "suggest",
-        "suit",
-        "summer",
-        "sun",
-        "sunny",
-        "sunset",
-        "super",
-        "supply",
-        "supreme",
-        "sure",
-        "surface",
-        "surge",
-        "surprise",
-        "surround",
-        "survey",
-        "suspect",
-        "sustain",
-        "swallow",
-        "swamp",
-        "swap",
-        "swarm",
-        "swear",
-        "sweet",
-        "swift",
-        "swim",
-        "swing",
-        "switch",
-        "sword",
-        "symbol",
-        "symptom",
-        "syrup",
-        "system",
-        "table",
-        "tackle",
-        "tag",
-        "tail",
-        "talent",
-        "talk",
-        "tank",
-        "tape",
-        "target",
-        "task",
-        "taste",
-        "tattoo",
-        "taxi",
-        "teach",
-        "team",
-        "tell",
-        "ten",
-        "tenant",
-        "tennis",
-        "tent",
-        "term",
-        "test",
-        "text",
-        "thank",
-        "that",
-        "theme",
-        "then",
-        "theory",
-        "there",
-        "they",
-        "thing",
-        "this",
-        "thought",
-        "three",
-        "thrive",
-        "throw",
-        "thumb",
-        "thunder",
-        "ticket",
-        "tide",
-        "tiger",
-        "tilt",
-        "timber",
-        "time",
-        "tiny",
-        "tip",
-        "tired",
-        "tissue",
-        "title",
-        "toast",
-        "tobacco",
-        "today",
-        "toddler",
-        "toe",
-        "together",
-        "toilet",
-        "token",
-        "tomato",
-        "tomorrow",
-        "tone",
-        "tongue",
-        "tonight",
-        "tool",
-        "tooth",
-        "top",
-        "topic",
-        "topple",
-        "torch",
-        "tornado",
-        "tortoise",
-        "toss",
-        "total",
-        "tourist",
-        "toward",
-        "tower",
-        "town",
-        "toy",
-        "track",
-        "trade",
-        "traffic",
-        "tragic",
-        "train",
-        "transfer",
-        "trap",
-        "trash",
-        "travel",
-        "tray",
-        "treat",
-        "tree",
-        "trend",
-        "trial",
-        "tribe",
-        "trick",
-        "trigger",
-        "trim",
-        "trip",
-        "trophy",
-        "trouble",
-        "truck",
-        "true",
-        "truly",
-        "trumpet",
-        "trust",
-        "truth",
-        "try",
-        "tube",
-        "tuition",
-        "tumble",
-        "tuna",
-        "tunnel",
-        "turkey",
-        "turn",
-        "turtle",
-        "twelve",
-        "twenty",
-        "twice",
-        "twin",
-        "twist",
-        "two",
-        "type",
-        "typical",
-        "ugly",
-        "umbrella",
-        "unable",
-        "unaware",
-        "uncle",
-        "uncover",
-        "under",
-        "undo",
-        "unfair",
-        "unfold",
-        "unhappy",
-        "uniform",
-        "unique",
-        "unit",
-        "universe",
-        "unknown",
-        "unlock",
-        "until",
-        "unusual",
-        "unveil",
-        "update",
-        "upgrade",
-        "uphold",
-        "upon",
-        "upper",
-        "upset",
-        "urban",
-        "urge",
-        "usage",
-        "use",
-        "used",
-        "useful",
-        "useless",
-        "usual",
-        "utility",
-        "vacant",
-        "vacuum",
-        "vague",
-        "valid",
-        "valley",
-        "valve",
-        "van",
-        "vanish",
-        "vapor",
-        "various",
-        "vast",
-        "vault",
-        "vehicle",
-        "velvet",
-        "vendor",
-        "venture",
-        "venue",
-        "verb",
-        "verify",
-        "version",
-        "very",
-        "vessel",
-        "veteran",
-        "viable",
-        "vibrant",
-        "vicious",
-        "victory",
-        "video",
-        "view",
-        "village",
-        "vintage",
-        "violin",
-        "virtual",
-        "virus",
-        "visa",
-        "visit",
-        "visual",
-        "vital",
-        "vivid",
-        "vocal",
-        "voice",
-        "void",
-        "volcano",
-        "volume",
-        "vote",
-        "voyage",
-        "wage",
-        "wagon",
-        "wait",
-        "walk",
-        "wall",
-        "walnut",
-        "want",
-        "warfare",
-        "warm",
-        "warrior",
-        "wash",
-        "wasp",
-        "waste",
-        "water",
-        "wave",
-        "way",
-        "wealth",
-        "weapon",
-        "wear",
-        "weasel",
-        "weather",
-        "web",
-        "wedding",
-        "weekend",
-        "weird",
-        "welcome",
-        "west",
-        "wet",
-        "whale",
-        "what",
-        "wheat",
-        "wheel",
-        "when",
-        "where",
-        "whip",
-        "whisper",
-        "wide",
-        "width",
-        "wife",
-        "wild",
-        "will",
-        "win",
-        "window",
-        "wine",
-        "wing",
-        "wink",
-        "winner",
-        "winter",
-        "wire",
-        "wisdom",
-        "wise",
-        "wish",
-        "witness",
-        "wolf",
-        "woman",
-        "wonder",
-        "wood",
-        "wool",
-        "word",
-        "work",
-        "world",
-        "worry",
-        "worth",
-        "wrap",
-        "wreck",
-        "wrestle",
-        "wrist",
-        "write",
-        "wrong",
-        "yard",
-        "year",
-        "yellow",
-        "you",
-        "young",
-        "youth",
-        "zebra",
-        "zero",
-        "zone",
-        "zoo"
-    }
+    0, 8, 16, 21, 27, 33, 40, 47, 56, 63, 69, 76, 85, 93, 100, 108, 113, 122,
+    130, 137, 141, 148, 154, 162, 169, 175, 179, 186, 194, 201, 207, 213, 221,
+    228, 236, 243, 250, 257, 263, 267, 273, 279, 285, 289, 293, 301, 307, 313,
+    319, 327, 333, 339, 343, 349, 355, 362, 368, 374, 382, 387, 393, 400, 408,
+    416, 422, 429, 436, 444, 451, 459, 465, 471, 477, 484, 490, 499, 506, 514,
+    521, 529, 537, 545, 549, 555, 563, 570, 576, 584, 590, 595, 602, 607, 613,
+    619, 623, 629, 635, 640, 647, 655, 662, 669, 675, 679, 688, 695, 703, 707,
+    714, 722, 728, 735, 742, 749, 757, 762, 769, 776, 785, 793, 801, 807, 814,
+    819, 826, 831, 838, 846, 854, 860, 866, 872, 877, 885, 891, 899, 904, 909,
+    918, 924, 930, 934, 942, 950, 955, 962, 969, 976, 980, 987, 995, 1002,
+    1007, 1013, 1020, 1027, 1033, 1038, 1045, 1053, 1060, 1065, 1072, 1078,
+    1085, 1092, 1100, 1106, 1111, 1117, 1125, 1130, 1137, 1144, 1152, 1159,
+    1167, 1171, 1176, 1181, 1189, 1194, 1200, 1207, 1213, 1219, 1225, 1233,
+    1239, 1245, 1251, 1257, 1263, 1271, 1278, 1283, 1288, 1294, 1300, 1305,
+    1310, 1315, 1320, 1325, 1331, 1336, 1342, 1349, 1356, 1363, 1368, 1375,
+    1382, 1386, 1390, 1398, 1404, 1410, 1416, 1422, 1428, 1435, 1441, 1448,
+    1454, 1461, 1467, 1473, 1482, 1489, 1496, 1502, 1510, 1516, 1522, 1529,
+    1535, 1542, 1550, 1556, 1561, 1566, 1573, 1580, 1587, 1594, 1601, 1607,
+    1611, 1620, 1625, 1632, 1638, 1643, 1651, 1657, 1663, 1670, 1675, 1680,
+    1685, 1690, 1697, 1702, 1706, 1712, 1719, 1725, 1732, 1738, 1745, 1752,
+    1760, 1768, 1776, 1780, 1787, 1792, 1798, 1805, 1811, 1816, 1821, 1826,
+    1833, 1840, 1847, 1851, 1859, 1865, 1874, 1881, 1888, 1894, 1902, 1907,
+    1915, 1922, 1929, 1936, 1944, 1951, 1959, 1965, 1971, 1980, 1987, 1993,
+    2001, 2008, 2014, 2019, 2025, 2031, 2038, 2043, 2050, 2056, 2064, 2070,
+    2076, 2084, 2091, 2098, 2106, 2114, 2120, 2126, 2132, 2141, 2148, 2156,
+    2161, 2167, 2173, 2178, 2186, 2191, 2196, 2202, 2208, 2215, 2221, 2228,
+    2234, 2240, 2247, 2252, 2258, 2263, 2269, 2275, 2281, 2287, 2292, 2298,
+    2306, 2313, 2319, 2325, 2333, 2338, 2345, 2350, 2355, 2363, 2369, 2376,
+    2384, 2389, 2397, 2403, 2410, 2418, 2426, 2434, 2442, 2451, 2459, 2468,
+    2476, 2485, 2490, 2495, 2502, 2507, 2513, 2518, 2523, 2531, 2536, 2543,
+    2549, 2557, 2564, 2571, 2578, 2584, 2591, 2597, 2604, 2610, 2615, 2621,
+    2627, 2634, 2640, 2646, 2652, 2659, 2665, 2670, 2678, 2684, 2690, 2697,
+    2702, 2708, 2715, 2721, 2729, 2735, 2742, 2750, 2757, 2763, 2767, 2775,
+    2780, 2788, 2792, 2801, 2809, 2817, 2825, 2831, 2839, 2846, 2851, 2857,
+    2861, 2868, 2873, 2879, 2886, 2893, 2898, 2907, 2912, 2916, 2921, 2928,
+    2935, 2942, 2951, 2958, 2966, 2975, 2984, 2989, 2997, 3004, 3009, 3016,
+    3022, 3030, 3037, 3044, 3051, 3059, 3064, 3071, 3078, 3086, 3092, 3099,
+    3106, 3115, 3122, 3129, 3134, 3142, 3150, 3157, 3164, 3172, 3179, 3186,
+    3194, 3199, 3207, 3213, 3218, 3225, 3230, 3237, 3245, 3253, 3261, 3268,
+    3277, 3284, 3289, 3298, 3307, 3315, 3320, 3328, 3337, 3345, 3354, 3361,
+    3368, 3376, 3382, 3389, 3398, 3402, 3407, 3415, 3422, 3429, 3436, 3442,
+    3447, 3452, 3459, 3464, 3470, 3477, 3483, 3491, 3496, 3502, 3508, 3514,
+    3520, 3526, 3531, 3537, 3542, 3547, 3551, 3556, 3561, 3566, 3573, 3578,
+    3584, 3589, 3595, 3603, 3609, 3615, 3621, 3626, 3632, 3639, 3644, 3649,
+    3654, 3662, 3670, 3675, 3680, 3688, 3695, 3699, 3705, 3712, 3718, 3724,
+    3733, 3741, 3749, 3758, 3767, 3773, 3778, 3785, 3792, 3800, 3807, 3815,
+    3822, 3830, 3836, 3843, 3849, 3853, 3861, 3869, 3875, 3882, 3890, 3897,
+    3904, 3912, 3918, 3925, 3932, 3939, 3946, 3953, 3959, 3966, 3972, 3981,
+    3989, 3995, 4001, 4005, 4011, 4017, 4025, 4031, 4037, 4044, 4050, 4058,
+    4065, 4073, 4080, 4089, 4094, 4100, 4107, 4113, 4121, 4128, 4137, 4144,
+    4152, 4159, 4167, 4176, 4184, 4192, 4198, 4204, 4209, 4216, 4223, 4230,
+    4237, 4245, 4252, 4260, 4267, 4273, 4277, 4285, 4292, 4297, 4305, 4310,
+    4316, 4322, 4327, 4333, 4338, 4345, 4352, 4356, 4362, 4370, 4375, 4383,
+    4387, 4393, 4400, 4408, 4414, 4423, 4431, 4440, 4448, 4452, 4457, 4462,
+    4469, 4475, 4484, 4490, 4496, 4500, 4506, 4514, 4520, 4527, 4532, 4537,
+    4544, 4550, 4555, 4560, 4567, 4574, 4579, 4584, 4590, 4597, 4602, 4606,
+    4614, 4618, 4623, 4629, 4635, 4640, 4647, 4652, 4659, 4664, 4670, 4676,
+    4682, 4689, 4695, 4701, 4705, 4710, 4716, 4720, 4725, 4730, 4737, 4742,
+    4747, 4753, 4760, 4767, 4772, 4780, 4786, 4794, 4801, 4808, 4814, 4818,
+    4826, 4832, 4841, 4847, 4854, 4861, 4866, 4872, 4878, 4884, 4891, 4897,
+    4902, 4906, 4912, 4920, 4925, 4932, 4939, 4944, 4951, 4959, 4964, 4968,
+    4975, 4983, 4990, 4997, 5005, 5009, 5014, 5019, 5026, 5032, 5037, 5045,
+    5052, 5058, 5065, 5073, 5081, 5087, 5093, 5098, 5105, 5112, 5120, 5125,
+    5130, 5135, 5142, 5148, 5154, 5160, 5168, 5174, 5180, 5186, 5192, 5197,
+    5202, 5207, 5215, 5220, 5225, 5231, 5239, 5246, 5253, 5260, 5265, 5270,
+    5276, 5282, 5288, 5294, 5300, 5308, 5314, 5320, 5325, 5331, 5336, 5344,
+    5350, 5355, 5361, 5367, 5373, 5379, 5385, 5392, 5396, 5400, 5406, 5411,
+    5416, 5423, 5431, 5436, 5442, 5449, 5454, 5460, 5468, 5472, 5477, 5482,
+    5489, 5494, 5501, 5507, 5513, 5522, 5529, 5535, 5542, 5547, 5551, 5556,
+    5563, 5568, 5573, 5578, 5582, 5587, 5595, 5601, 5608, 5613, 5618, 5626,
+    5633, 5638, 5644, 5649, 5654, 5659, 5666, 5672, 5681, 5686, 5692, 5697,
+    5703, 5707, 5712, 5718, 5725, 5731, 5739, 5746, 5751, 5758, 5764, 5769,
+    5777, 5784, 5788, 5793, 5798, 5807, 5812, 5819, 5823, 5831, 5839, 5845,
+    5853, 5861, 5868, 5875, 5882, 5890, 5898, 5903, 5911, 5918, 5927, 5933,
+    5942, 5949, 5958, 5965, 5973, 5980, 5987, 5995, 6003, 6010, 6017, 6024,
+    6030, 6039, 6045, 6053, 6060, 6067, 6074, 6082, 6090, 6097, 6106, 6111,
+    6118, 6125, 6133, 6138, 6145, 6153, 6159, 6164, 6170, 6177, 6184, 6188,
+    6193, 6201, 6207, 6213, 6219, 6223, 6228, 6233, 6241, 6245, 6251, 6257,
+    6262, 6269, 6276, 6281, 6286, 6295, 6300, 6305, 6313, 6317, 6322, 6326,
+    6333, 6338, 6346, 6351, 6355, 6363, 6368, 6375, 6380, 6385, 6391, 6397,
+    6402, 6406, 6412, 6418, 6425, 6430, 6435, 6440, 6449, 6456, 6462, 6468,
+    6474, 6480, 6488, 6493, 6497, 6502, 6510, 6516, 6521, 6528, 6533, 6539,
+    6545, 6553, 6558, 6562, 6568, 6575, 6583, 6589, 6594, 6601, 6606, 6614,
+    6621, 6628, 6634, 6639, 6647, 6655, 6663, 6668, 6673, 6679, 6684, 6689,
+    6695, 6700, 6705, 6712, 6717, 6724, 6729, 6736, 6741, 6746, 6754, 6760,
+    6765, 6771, 6778, 6783, 6788, 6796, 6801, 6808, 6813, 6819, 6825, 6833,
+    6840, 6846, 6852, 6859, 6866, 6874, 6878, 6884, 6891, 6896, 6901, 6906,
+    6912, 6917, 6924, 6928, 6935, 6943, 6949, 6957, 6964, 6970, 6977, 6983,
+    6990, 6997, 7004, 7013, 7018, 7023, 7030, 7036, 7045, 7050, 7057, 7064,
+    7072, 7077, 7084, 7089, 7097, 7102, 7111, 7117, 7123, 7130, 7135, 7142,
+    7149, 7157, 7162, 7168, 7174, 7180, 7186, 7191, 7199, 7205, 7212, 7219,
+    7228, 7233, 7241, 7247, 7252, 7260, 7266, 7273, 7281, 7288, 7295, 7300,
+    7308, 7312, 7318, 7326, 7333, 7339, 7346, 7350, 7357, 7365, 7372, 7380,
+    7386, 7391, 7397, 7402, 7410, 7419, 7426, 7433, 7439, 7448, 7454, 7459,
+    7465, 7470, 7477, 7482, 7491, 7498, 7505, 7514, 7520, 7525, 7532, 7539,
+    7547, 7552, 7558, 7563, 7570, 7577, 7583, 7590, 7597, 7602, 7607, 7612,
+    7621, 7629, 7637, 7644, 7650, 7655, 7659, 7667, 7675, 7681, 7686, 7691,
+    7696, 7702, 7708, 7714, 7722, 7729, 7736, 7742, 7747, 7755, 7760, 7768,
+    7775, 7781, 7785, 7793, 7800, 7806, 7810, 7814, 7819, 7826, 7833, 7841,
+    7849, 7856, 7864, 7870, 7876, 7884, 7889, 7893, 7899, 7906, 7912, 7916,
+    7921, 7925, 7931, 7939, 7944, 7949, 7953, 7959, 7966, 7971, 7976, 7982,
+    7990, 7997, 8004, 8011, 8017, 8025, 8031, 8040, 8046, 8053, 8062, 8069,
+    8077, 8083, 8091, 8097, 8104, 8112, 8117, 8122, 8127, 8131, 8137, 8144,
+    8151, 8157, 8162, 8169, 8174, 8179, 8186, 8191, 8197, 8203, 8209, 8217,
+    8223, 8230, 8237, 8242, 8249, 8255, 8260, 8266, 8271, 8279, 8286, 8294,
+    8300, 8305, 8313, 8319, 8326, 8331, 8339, 8347, 8351, 8359, 8366, 8373,
+    8380, 8388, 8395, 8402, 8406, 8412, 8418, 8425, 8434, 8440, 8447, 8455,
+    8461, 8465, 8472, 8477, 8483, 8488, 8496, 8501, 8508, 8514, 8520, 8526,
+    8533, 8541, 8547, 8552, 8559, 8566, 8572, 8577, 8584, 8589, 8594, 8600,
+    8606, 8611, 8618, 8623, 8628, 8633, 8641, 8649, 8658, 8667, 8672, 8679,
+    8687, 8695, 8702, 8708, 8717, 8724, 8732, 8739, 8747, 8755, 8762, 8770,
+    8776, 8782, 8790, 8796, 8805, 8812, 8820, 8826, 8834, 8842, 8850, 8857,
+    8865, 8873, 8881, 8887, 8896, 8904, 8912, 8918, 8926, 8933, 8941, 8946,
+    8951, 8957, 8965, 8971, 8977, 8983, 8992, 8999, 9007, 9013, 9018, 9022,
+    9029, 9037, 9045, 9053, 9061, 9070, 9076, 9081, 9086, 9092, 9099, 9107,
+    9112, 9117, 9123, 9129, 9134, 9139, 9145, 9151, 9156, 9162, 9169, 9175,
+    9181, 9186, 9191, 9198, 9204, 9208, 9214, 9220, 9225, 9232, 9238, 9246,
+    9253, 9261, 9268, 9275, 9283, 9290, 9298, 9305, 9312, 9319, 9326, 9334,
+    9341, 9347, 9355, 9362, 9367, 9374, 9383, 9390, 9397, 9404, 9410, 9415,
+    9422, 9429, 9436, 9444, 9451, 9459, 9466, 9475, 9482, 9491, 9500, 9507,
+    9514, 9522, 9529, 9537, 9544, 9551, 9558, 9565, 9569, 9576, 9581, 9586,
+    9591, 9597, 9603, 9609, 9615, 9620, 9625, 9632, 9637, 9644, 9650, 9656,
+    9661, 9667, 9673, 9680, 9687, 9695, 9700, 9707, 9712, 9717, 9724, 9730,
+    9736, 9742, 9748, 9755, 9760, 9764, 9769, 9773, 9780, 9786, 9790, 9797,
+    9805, 9810, 9815, 9821, 9828, 9834, 9839, 9846, 9851, 9858, 9863, 9871,
+    9879, 9885, 9893, 9898, 9902, 9908, 9913, 9919, 9927, 9933, 9940, 9947,
+    9955, 9964, 9973, 9979, 9985, 9992, 9999, 10005, 10009, 10016, 10023,
+    10028, 10035, 10042, 10050, 10059, 10064, 10069, 10077, 10084, 10089,
+    10097, 10104, 10110, 10119, 10126, 10134, 10142, 10149, 10155, 10161,
+    10168, 10174, 10182, 10188, 10193, 10199, 10207, 10214, 10220, 10226,
+    10231, 10238, 10244, 10249, 10255, 10260, 10266, 10275, 10281, 10288,
+    10294, 10302, 10306, 10314, 10319, 10324, 10330, 10336, 10341, 10348,
+    10353, 10359, 10366, 10374, 10381, 10387, 10392, 10398, 10405, 10413,
+    10417, 10422, 10428, 10435, 10439, 10445, 10450, 10456, 10462, 10467,
+    10472, 10478, 10486, 10492, 10498, 10505, 10510, 10517, 10522, 10527,
+    10533, 10539, 10545, 10551, 10557, 10564, 10570, 10576, 10581, 10587,
+    10592, 10597, 10604, 10611, 10616, 10621, 10626, 10632, 10640, 10646,
+    10655, 10661, 10669, 10674, 10679, 10685, 10690, 10695, 10701, 10706,
+    10713, 10719, 10725, 10731, 10739, 10745, 10751, 10759, 10765, 10771,
+    10777, 10784, 10790, 10797, 10803, 10808, 10815, 10821, 10827, 10835,
+    10841, 10847, 10852, 10858, 10865, 10872, 10876, 10883, 10891, 10900,
+    10907, 10915, 10921, 10927, 10934, 10940, 10946, 10952, 10958, 10963,
+    10969, 10975, 10980, 10985, 10992, 10998, 11004, 11010, 11016, 11024,
+    11030, 11036, 11042, 11048, 11057, 11064, 11071, 11078, 11087, 11095,
+    11101, 11109, 11115, 11123, 11130, 11137, 11145, 11150, 11157, 11164,
+    11170, 11178, 11183, 11190, 11194, 11200, 11207, 11213, 11220, 11228,
+    11233, 11241, 11247, 11256, 11265, 11272, 11280, 11288, 11296, 11302,
+    11307, 11313, 11319, 11325, 11331, 11336, 11342, 11349, 11355, 11362,
+    11370, 11376, 11383, 11389, 11396, 11400, 11405, 11412, 11417, 11422,
+    11427, 11434, 11439, 11445, 11452, 11457, 11463, 11468, 11473, 11477,
+    11484, 11491, 11496, 11501, 11506, 11511, 11517, 11522, 11528, 11533,
+    11540, 11546, 11551, 11557, 11562, 11570, 11576, 11583, 11589, 11595,
+    11603, 11610, 11615, 11621, 11626, 11633, 11638, 11643, 11647, 11653,
+    11660, 11666, 11672, 11680, 11686, 11694, 11698, 11707, 11714, 11720,
+    11727, 11736, 11741, 11748, 11756, 11761, 11767, 11771, 11777, 11784,
+    11790, 11798, 11807, 11812, 11818, 11826, 11833, 11839, 11844, 11848,
+    11854, 11860, 11868, 11875, 11881, 11890, 11895, 11901, 11908, 11913,
+    11919, 11924, 11930, 11936, 11942, 11948, 11956, 11961, 11966, 11973,
+    11981, 11987, 11992, 11998, 12006, 12012, 12018, 12022, 12027, 12035,
+    12042, 12047, 12054, 12061, 12066, 12073, 12080, 12087, 12093, 12098,
+    12104, 12108, 12113, 12121, 12126, 12135, 12142, 12150, 12156, 12164,
+    12170, 12175, 12182, 12189, 12197, 12205, 12212, 12217, 12226, 12234,
+    12241, 12247, 12255, 12262, 12269, 12277, 12284, 12289, 12295, 12301,
+    12307, 12312, 12318, 12322, 12327, 12334, 12342, 12348, 12356, 12363,
+    12370, 12376, 12382, 12389, 12395, 12399, 12406, 12412, 12420, 12425,
+    12431, 12439, 12446, 12453, 12461, 12467, 12472, 12479, 12487, 12492,
+    12499, 12507, 12514, 12522, 12530, 12538, 12544, 12549, 12557, 12565,
+    12572, 12580, 12586, 12591, 12597, 12604, 12610, 12616, 12622, 12628,
+    12633, 12641, 12648, 12653, 12660, 12665, 12671, 12676, 12681, 12686,
+    12693, 12698, 12706, 12711, 12719, 12724, 12729, 12735, 12741, 12746,
+    12750, 12757, 12764, 12769, 12776, 12784, 12788, 12796, 12804, 12810,
+    12818, 12823, 12827, 12833, 12838, 12844, 12850, 12855, 12861, 12866,
+    12874, 12879, 12885, 12890, 12895, 12900, 12904, 12911, 12916, 12921,
+    12926, 12933, 12940, 12945, 12952, 12957, 12962, 12970, 12975, 12981,
+    12988, 12993, 12998, 13003, 13008, 13014, 13020, 13026, 13031, 13037,
+    13045, 13051, 13057, 13063, 13068, 13073, 13080, 13084, 13090, 13096,
+    13102, 13107, 13112
 };
 
-const dictionary es =
+const dictionary en{ en_words, en_offsets };
+
+static const char es_words[] =
+    "ábaco\0"
+    "abdomen\0"
+    "abeja\0"
+    "abierto\0"
+    "abogado\0"
+    "abono\0"
+    "aborto\0"
+    "abrazo\0"
+    "abrir\0"
+    "abuelo\0"
+    "abuso\0"
+    "acabar\0"
+    "academia\0"
+    "acceso\0"
+    "acción\0"
+    "aceite\0"
+    "acelga\0"
+    "acento\0"
+    "aceptar\0"
+    "ácido\0"
+    "aclarar\0"
+    "acné\0"
+    "acoger\0"
+    "acoso\0"
+    "activo\0"
+    "acto\0"
+    "actriz\0"
+    "actuar\0"
+    "acudir\0"
+    "acuerdo\0"
+    "acusar\0"
+    "adicto\0"
+    "admitir\0"
+    "adoptar\0"
+    "adorno\0"
+    "aduana\0"
+    "adulto\0"
+    "aéreo\0"
+    "afectar\0"
+    "afición\0"
+    "afinar\0"
+    "afirmar\0"
+    "ágil\0"
+    "agitar\0"
+    "agonía\0"
+    "agosto\0"
+    "agotar\0"
+    "agregar\0"
+    "agrio\0"
+    "agua\0"
+    "agudo\0"
+    "águila\0"
+    "aguja\0"
+    "ahogo\0"
+    "ahorro\0"
+    "aire\0"
+    "aislar\0"
+    "ajedrez\0"
+    "ajeno\0"
+    "ajuste\0"
+    "alacrán\0"
+    "alambre\0"
+    "alarma\0"
+    "alba\0"
+    "álbum\0"
+    "alcalde\0"
+    "aldea\0"
+    "alegre\0"
+    "alejar\0"
+    "alerta\0"
+    "aleta\0"
+    "alfiler\0"
+    "alga\0"
+    "algodón\0"
+    "aliado\0"
+    "aliento\0"
+    "alivio\0"
+    "alma\0"
+    "almeja\0"
+    "almíbar\0"
+    "altar\0"
+    "alteza\0"
+    "altivo\0"
+    "alto\0"
+    "altura\0"
+    "alumno\0"
+    "alzar\0"
+    "amable\0"
+    "amante\0"
+    "amapola\0"
+    "amargo\0"
+    "amasar\0"
+    "ámbar\0"
+    "ámbito\0"
+    "ameno\0"
+    "amigo\0"
+    "amistad\0"
+    "amor\0"
+    "amparo\0"
+    "amplio\0"
+    "ancho\0"
+    "anciano\0"
+    "ancla\0"
+    "andar\0"
+    "andén\0"
+    "anemia\0"
+    "ángulo\0"
+    "anillo\0"
+    "ánimo\0"
+    "anís\0"
+    "anotar\0"
+    "antena\0"
+    "antiguo\0"
+    "antojo\0"
+    "anual\0"
+    "anular\0"
+    "anuncio\0"
+    "añadir\0"
+    "añejo\0"
+    "año\0"
+    "apagar\0"
+    "aparato\0"
+    "apetito\0"
+    "apio\0"
+    "aplicar\0"
+    "apodo\0"
+    "aporte\0"
+    "apoyo\0"
+    "aprender\0"
+    "aprobar\0"
+    "apuesta\0"
+    "apuro\0"
+    "arado\0"
+    "araña\0"
+    "arar\0"
+    "árbitro\0"
+    "árbol\0"
+    "arbusto\0"
+    "archivo\0"
+    "arco\0"
+    "arder\0"
+    "ardilla\0"
+    "arduo\0"
+    "área\0"
+    "árido\0"
+    "aries\0"
+    "armonía\0"
+    "arnés\0"
+    "aroma\0"
+    "arpa\0"
+    "arpón\0"
+    "arreglo\0"
+    "arroz\0"
+    "arruga\0"
+    "arte\0"
+    "artista\0"
+    "asa\0"
+    "asado\0"
+    "asalto\0"
+    "ascenso\0"
+    "asegurar\0"
+    "aseo\0"
+    "asesor\0"
+    "asiento\0"
+    "asilo\0"
+    "asistir\0"
+    "asno\0"
+    "asombro\0"
+    "áspero\0"
+    "astilla\0"
+    "astro\0"
+    "astuto\0"
+    "asumir\0"
+    "asunto\0"
+    "atajo\0"
+    "ataque\0"
+    "atar\0"
+    "atento\0"
+    "ateo\0"
+    "ático\0"
+    "atleta\0"
+    "átomo\0"
+    "atraer\0"
+    "atroz\0"
+    "atún\0"
+    "audaz\0"
+    "audio\0"
+    "auge\0"
+    "aula\0"
+    "aumento\0"
+    "ausente\0"
+    "autor\0"
+    "aval\0"
+    "avance\0"
+    "avaro\0"
+    "ave\0"
+    "avellana\0"
+    "avena\0"
+    "avestruz\0"
+    "avión\0"
+    "aviso\0"
+    "ayer\0"
+    "ayuda\0"
+    "ayuno\0"
+    "azafrán\0"
+    "azar\0"
+    "azote\0"
+    "azúcar\0"
+    "azufre\0"
+    "azul\0"
+    "baba\0"
+    "babor\0"
+    "bache\0"
+    "bahía\0"
+    "baile\0"
+    "bajar\0"
+    "balanza\0"
+    "balcón\0"
+    "balde\0"
+    "bambú\0"
+    "banco\0"
+    "banda\0"
+    "baño\0"
+    "barba\0"
+    "barco\0"
+    "barniz\0"
+    "barro\0"
+    "báscula\0"
+    "bastón\0"
+    "basura\0"
+    "batalla\0"
+    "batería\0"
+    "batir\0"
+    "batuta\0"
+    "baúl\0"
+    "bazar\0"
+    "bebé\0"
+    "bebida\0"
+    "bello\0"
+    "besar\0"
+    "beso\0"
+    "bestia\0"
+    "bicho\0"
+    "bien\0"
+    "bingo\0"
+    "blanco\0"
+    "bloque\0"
+    "blusa\0"
+    "boa\0"
+    "bobina\0"
+    "bobo\0"
+    "boca\0"
+    "bocina\0"
+    "boda\0"
+    "bodega\0"
+    "boina\0"
+    "bola\0"
+    "bolero\0"
+    "bolsa\0"
+    "bomba\0"
+    "bondad\0"
+    "bonito\0"
+    "bono\0"
+    "bonsái\0"
+    "borde\0"
+    "borrar\0"
+    "bosque\0"
+    "bote\0"
+    "botín\0"
+    "bóveda\0"
+    "bozal\0"
+    "bravo\0"
+    "brazo\0"
+    "brecha\0"
+    "breve\0"
+    "brillo\0"
+    "brinco\0"
+    "brisa\0"
+    "broca\0"
+    "broma\0"
+    "bronce\0"
+    "brote\0"
+    "bruja\0"
+    "brusco\0"
+    "bruto\0"
+    "buceo\0"
+    "bucle\0"
+    "bueno\0"
+    "buey\0"
+    "bufanda\0"
+    "bufón\0"
+    "búho\0"
+    "buitre\0"
+    "bulto\0"
+    "burbuja\0"
+    "burla\0"
+    "burro\0"
+    "buscar\0"
+    "butaca\0"
+    "buzón\0"
+    "caballo\0"
+    "cabeza\0"
+    "cabina\0"
+    "cabra\0"
+    "cacao\0"
+    "cadáver\0"
+    "cadena\0"
+    "caer\0"
+    "café\0"
+    "caída\0"
+    "caimán\0"
+    "caja\0"
+    "cajón\0"
+    "cal\0"
+    "calamar\0"
+    "calcio\0"
+    "caldo\0"
+    "calidad\0"
+    "calle\0"
+    "calma\0"
+    "calor\0"
+    "calvo\0"
+    "cama\0"
+    "cambio\0"
+    "camello\0"
+    "camino\0"
+    "campo\0"
+    "cáncer\0"
+    "candil\0"
+    "canela\0"
+    "canguro\0"
+    "canica\0"
+    "canto\0"
+    "caña\0"
+    "cañón\0"
+    "caoba\0"
+    "caos\0"
+    "capaz\0"
+    "capitán\0"
+    "capote\0"
+    "captar\0"
+    "capucha\0"
+    "cara\0"
+    "carbón\0"
+    "cárcel\0"
+    "careta\0"
+    "carga\0"
+    "cariño\0"
+    "carne\0"
+    "carpeta\0"
+    "carro\0"
+    "carta\0"
+    "casa\0"
+    "casco\0"
+    "casero\0"
+    "caspa\0"
+    "castor\0"
+    "catorce\0"
+    "catre\0"
+    "caudal\0"
+    "causa\0"
+    "cazo\0"
+    "cebolla\0"
+    "ceder\0"
+    "cedro\0"
+    "celda\0"
+    "célebre\0"
+    "celoso\0"
+    "célula\0"
+    "cemento\0"
+    "ceniza\0"
+    "centro\0"
+    "cerca\0"
+    "cerdo\0"
+    "cereza\0"
+    "cero\0"
+    "cerrar\0"
+    "certeza\0"
+    "césped\0"
+    "cetro\0"
+    "chacal\0"
+    "chaleco\0"
+    "champú\0"
+    "chancla\0"
+    "chapa\0"
+    "charla\0"
+    "chico\0"
+    "chiste\0"
+    "chivo\0"
+    "choque\0"
+    "choza\0"
+    "chuleta\0"
+    "chupar\0"
+    "ciclón\0"
+    "ciego\0"
+    "cielo\0"
+    "cien\0"
+    "cierto\0"
+    "cifra\0"
+    "cigarro\0"
+    "cima\0"
+    "cinco\0"
+    "cine\0"
+    "cinta\0"
+    "ciprés\0"
+    "circo\0"
+    "ciruela\0"
+    "cisne\0"
+    "cita\0"
+    "ciudad\0"
+    "clamor\0"
+    "clan\0"
+    "claro\0"
+    "clase\0"
+    "clave\0"
+    "cliente\0"
+    "clima\0"
+    "clínica\0"
+    "cobre\0"
+    "cocción\0"
+    "cochino\0"
+    "cocina\0"
+    "coco\0"
+    "código\0"
+    "codo\0"
+    "cofre\0"
+    "coger\0"
+    "cohete\0"
+    "cojín\0"
+    "cojo\0"
+    "cola\0"
+    "colcha\0"
+    "colegio\0"
+    "colgar\0"
+    "colina\0"
+    "collar\0"
+    "colmo\0"
+    "columna\0"
+    "combate\0"
+    "comer\0"
+    "comida\0"
+    "cómodo\0"
+    "compra\0"
+    "conde\0"
+    "conejo\0"
+    "conga\0"
+    "conocer\0"
+    "consejo\0"
+    "contar\0"
+    "copa\0"
+    "copia\0"
+    "corazón\0"
+    "corbata\0"
+    "corcho\0"
+    "cordón\0"
+    "corona\0"
+    "correr\0"
+    "coser\0"
+    "cosmos\0"
+    "costa\0"
+    "cráneo\0"
+    "cráter\0"
+    "crear\0"
+    "crecer\0"
+    "creído\0"
+    "crema\0"
+    "cría\0"
+    "crimen\0"
+    "cripta\0"
+    "crisis\0"
+    "cromo\0"
+    "crónica\0"
+    "croqueta\0"
+    "crudo\0"
+    "cruz\0"
+    "cuadro\0"
+    "cuarto\0"
+    "cuatro\0"
+    "cubo\0"
+    "cubrir\0"
+    "cuchara\0"
+    "cuello\0"
+    "cuento\0"
+    "cuerda\0"
+    "cuesta\0"
+    "cueva\0"
+    "cuidar\0"
+    "culebra\0"
+    "culpa\0"
+    "culto\0"
+    "cumbre\0"
+    "cumplir\0"
+    "cuna\0"
+    "cuneta\0"
+    "cuota\0"
+    "cupón\0"
+    "cúpula\0"
+    "curar\0"
+    "curioso\0"
+    "curso\0"
+    "curva\0"
+    "cutis\0"
+    "dama\0"
+    "danza\0"
+    "dar\0"
+    "dardo\0"
+    "dátil\0"
+    "deber\0"
+    "débil\0"
+    "década\0"
+    "decir\0"
+    "dedo\0"
+    "defensa\0"
+    "definir\0"
+    "dejar\0"
+    "delfín\0"
+    "delgado\0"
+    "delito\0"
+    "demora\0"
+    "denso\0"
+    "dental\0"
+    "deporte\0"
+    "derecho\0"
+    "derrota\0"
+    "desayuno\0"
+    "deseo\0"
+    "desfile\0"
+    "desnudo\0"
+    "destino\0"
+    "desvío\0"
+    "detalle\0"
+    "detener\0"
+    "deuda\0"
+    "día\0"
+    "diablo\0"
+    "diadema\0"
+    "diamante\0"
+    "diana\0"
+    "diario\0"
+    "dibujo\0"
+    "dictar\0"
+    "diente\0"
+    "dieta\0"
+    "diez\0"
+    "difícil\0"
+    "digno\0"
+    "dilema\0"
+    "diluir\0"
+    "dinero\0"
+    "directo\0"
+    "dirigir\0"
+    "disco\0"
+    "diseño\0"
+    "disfraz\0"
+    "diva\0"
+    "divino\0"
+    "doble\0"
+    "doce\0"
+    "dolor\0"
+    "domingo\0"
+    "don\0"
+    "donar\0"
+    "dorado\0"
+    "dormir\0"
+    "dorso\0"
+    "dos\0"
+    "dosis\0"
+    "dragón\0"
+    "droga\0"
+    "ducha\0"
+    "duda\0"
+    "duelo\0"
+    "dueño\0"
+    "dulce\0"
+    "dúo\0"
+    "duque\0"
+    "durar\0"
+    "dureza\0"
+    "duro\0"
+    "ébano\0"
+    "ebrio\0"
+    "echar\0"
+    "eco\0"
+    "ecuador\0"
+    "edad\0"
+    "edición\0"
+    "edificio\0"
+    "editor\0"
+    "educar\0"
+    "efecto\0"
+    "eficaz\0"
+    "eje\0"
+    "ejemplo\0"
+    "elefante\0"
+    "elegir\0"
+    "elemento\0"
+    "elevar\0"
+    "elipse\0"
+    "élite\0"
+    "elixir\0"
+    "elogio\0"
+    "eludir\0"
+    "embudo\0"
+    "emitir\0"
+    "emoción\0"
+    "empate\0"
+    "empeño\0"
+    "empleo\0"
+    "empresa\0"
+    "enano\0"
+    "encargo\0"
+    "enchufe\0"
+    "encía\0"
+    "enemigo\0"
+    "enero\0"
+    "enfado\0"
+    "enfermo\0"
+    "engaño\0"
+    "enigma\0"
+    "enlace\0"
+    "enorme\0"
+    "enredo\0"
+    "ensayo\0"
+    "enseñar\0"
+    "entero\0"
+    "entrar\0"
+    "envase\0"
+    "envío\0"
+    "época\0"
+    "equipo\0"
+    "erizo\0"
+    "escala\0"
+    "escena\0"
+    "escolar\0"
+    "escribir\0"
+    "escudo\0"
+    "esencia\0"
+    "esfera\0"
+    "esfuerzo\0"
+    "espada\0"
+    "espejo\0"
+    "espía\0"
+    "esposa\0"
+    "espuma\0"
+    "esquí\0"
+    "estar\0"
+    "este\0"
+    "estilo\0"
+    "estufa\0"
+    "etapa\0"
+    "eterno\0"
+    "ética\0"
+    "etnia\0"
+    "evadir\0"
+    "evaluar\0"
+    "evento\0"
+    "evitar\0"
+    "exacto\0"
+    "examen\0"
+    "exceso\0"
+    "excusa\0"
+    "exento\0"
+    "exigir\0"
+    "exilio\0"
+    "existir\0"
+    "éxito\0"
+    "experto\0"
+    "explicar\0"
+    "exponer\0"
+    "extremo\0"
+    "fábrica\0"
+    "fábula\0"
+    "fachada\0"
+    "fácil\0"
+    "factor\0"
+    "faena\0"
+    "faja\0"
+    "falda\0"
+    "fallo\0"
+    "falso\0"
+    "faltar\0"
+    "fama\0"
+    "familia\0"
+    "famoso\0"
+    "faraón\0"
+    "farmacia\0"
+    "farol\0"
+    "farsa\0"
+    "fase\0"
+    "fatiga\0"
+    "fauna\0"
+    "favor\0"
+    "fax\0"
+    "febrero\0"
+    "fecha\0"
+    "feliz\0"
+    "feo\0"
+    "feria\0"
+    "feroz\0"
+    "fértil\0"
+    "fervor\0"
+    "festín\0"
+    "fiable\0"
+    "fianza\0"
+    "fiar\0"
+    "fibra\0"
+    "ficción\0"
+    "ficha\0"
+    "fideo\0"
+    "fiebre\0"
+    "fiel\0"
+    "fiera\0"
+    "fiesta\0"
+    "figura\0"
+    "fijar\0"
+    "fijo\0"
+    "fila\0"
+    "filete\0"
+    "filial\0"
+    "filtro\0"
+    "fin\0"
+    "finca\0"
+    "fingir\0"
+    "finito\0"
+    "firma\0"
+    "flaco\0"
+    "flauta\0"
+    "flecha\0"
+    "flor\0"
+    "flota\0"
+    "fluir\0"
+    "flujo\0"
+    "flúor\0"
+    "fobia\0"
+    "foca\0"
+    "fogata\0"
+    "fogón\0"
+    "folio\0"
+    "folleto\0"
+    "fondo\0"
+    "forma\0"
+    "forro\0"
+    "fortuna\0"
+    "forzar\0"
+    "fosa\0"
+    "foto\0"
+    "fracaso\0"
+    "frágil\0"
+    "franja\0"
+    "frase\0"
+    "fraude\0"
+    "freír\0"
+    "freno\0"
+    "fresa\0"
+    "frío\0"
+    "frito\0"
+    "fruta\0"
+    "fuego\0"
+    "fuente\0"
+    "fuerza\0"
+    "fuga\0"
+    "fumar\0"
+    "función\0"
+    "funda\0"
+    "furgón\0"
+    "furia\0"
+    "fusil\0"
+    "fútbol\0"
+    "futuro\0"
+    "gacela\0"
+    "gafas\0"
+    "gaita\0"
+    "gajo\0"
+    "gala\0"
+    "galería\0"
+    "gallo\0"
+    "gamba\0"
+    "ganar\0"
+    "gancho\0"
+    "ganga\0"
+    "ganso\0"
+    "garaje\0"
+    "garza\0"
+    "gasolina\0"
+    "gastar\0"
+    "gato\0"
+    "gavilán\0"
+    "gemelo\0"
+    "gemir\0"
+    "gen\0"
+    "género\0"
+    "genio\0"
+    "gente\0"
+    "geranio\0"
+    "gerente\0"
+    "germen\0"
+    "gesto\0"
+    "gigante\0"
+    "gimnasio\0"
+    "girar\0"
+    "giro\0"
+    "glaciar\0"
+    "globo\0"
+    "gloria\0"
+    "gol\0"
+    "golfo\0"
+    "goloso\0"
+    "golpe\0"
+    "goma\0"
+    "gordo\0"
+    "gorila\0"
+    "gorra\0"
+    "gota\0"
+    "goteo\0"
+    "gozar\0"
+    "grada\0"
+    "gráfico\0"
+    "grano\0"
+    "grasa\0"
+    "gratis\0"
+    "grave\0"
+    "grieta\0"
+    "grillo\0"
+    "gripe\0"
+    "gris\0"
+    "grito\0"
+    "grosor\0"
+    "grúa\0"
+    "grueso\0"
+    "grumo\0"
+    "grupo\0"
+    "guante\0"
+    "guapo\0"
+    "guardia\0"
+    "guerra\0"
+    "guía\0"
+    "guiño\0"
+    "guion\0"
+    "guiso\0"
+    "guitarra\0"
+    "gusano\0"
+    "gustar\0"
+    "haber\0"
+    "hábil\0"
+    "hablar\0"
+    "hacer\0"
+    "hacha\0"
+    "hada\0"
+    "hallar\0"
+    "hamaca\0"
+    "harina\0"
+    "haz\0"
+    "hazaña\0"
+    "hebilla\0"
+    "hebra\0"
+    "hecho\0"
+    "helado\0"
+    "helio\0"
+    "hembra\0"
+    "herir\0"
+    "hermano\0"
+    "héroe\0"
+    "hervir\0"
+    "hielo\0"
+    "hierro\0"
+    "hígado\0"
+    "higiene\0"
+    "hijo\0"
+    "himno\0"
+    "historia\0"
+    "hocico\0"
+    "hogar\0"
+    "hoguera\0"
+    "hoja\0"
+    "hombre\0"
+    "hongo\0"
+    "honor\0"
+    "honra\0"
+    "hora\0"
+    "hormiga\0"
+    "horno\0"
+    "hostil\0"
+    "hoyo\0"
+    "hueco\0"
+    "huelga\0"
+    "huerta\0"
+    "hueso\0"
+    "huevo\0"
+    "huida\0"
+    "huir\0"
+    "humano\0"
+    "húmedo\0"
+    "humilde\0"
+    "humo\0"
+    "hundir\0"
+    "huracán\0"
+    "hurto\0"
+    "icono\0"
+    "ideal\0"
+    "idioma\0"
+    "ídolo\0"
+    "iglesia\0"
+    "iglú\0"
+    "igual\0"
+    "ilegal\0"
+    "ilusión\0"
+    "imagen\0"
+    "imán\0"
+    "imitar\0"
+    "impar\0"
+    "imperio\0"
+    "imponer\0"
+    "impulso\0"
+    "incapaz\0"
+    "índice\0"
+    "inerte\0"
+    "infiel\0"
+    "informe\0"
+    "ingenio\0"
+    "inicio\0"
+    "inmenso\0"
+    "inmune\0"
+    "innato\0"
+    "insecto\0"
+    "instante\0"
+    "interés\0"
+    "íntimo\0"
+    "intuir\0"
+    "inútil\0"
+    "invierno\0"
+    "ira\0"
+    "iris\0"
+    "ironía\0"
+    "isla\0"
+    "islote\0"
+    "jabalí\0"
+    "jabón\0"
+    "jamón\0"
+    "jarabe\0"
+    "jardín\0"
+    "jarra\0"
+    "jaula\0"
+    "jazmín\0"
+    "jefe\0"
+    "jeringa\0"
+    "jinete\0"
+    "jornada\0"
+    "joroba\0"
+    "joven\0"
+    "joya\0"
+    "juerga\0"
+    "jueves\0"
+    "juez\0"
+    "jugador\0"
+    "jugo\0"
+    "juguete\0"
+    "juicio\0"
+    "junco\0"
+    "jungla\0"
+    "junio\0"
+    "juntar\0"
+    "júpiter\0"
+    "jurar\0"
+    "justo\0"
+    "juvenil\0"
+    "juzgar\0"
+    "kilo\0"
+    "koala\0"
+    "labio\0"
+    "lacio\0"
+    "lacra\0"
+    "lado\0"
+    "ladrón\0"
+    "lagarto\0"
+    "lágrima\0"
+    "laguna\0"
+    "laico\0"
+    "lamer\0"
+    "lámina\0"
+    "lámpara\0"
+    "lana\0"
+    "lancha\0"
+    "langosta\0"
+    "lanza\0"
+    "lápiz\0"
+    "largo\0"
+    "larva\0"
+    "lástima\0"
+    "lata\0"
+    "látex\0"
+    "latir\0"
+    "laurel\0"
+    "lavar\0"
+    "lazo\0"
+    "leal\0"
+    "lección\0"
+    "leche\0"
+    "lector\0"
+    "leer\0"
+    "legión\0"
+    "legumbre\0"
+    "lejano\0"
+    "lengua\0"
+    "lento\0"
+    "leña\0"
+    "león\0"
+    "leopardo\0"
+    "lesión\0"
+    "letal\0"
+    "letra\0"
+    "leve\0"
+    "leyenda\0"
+    "libertad\0"
+    "libro\0"
+    "licor\0"
+    "líder\0"
+    "lidiar\0"
+    "lienzo\0"
+    "liga\0"
+    "ligero\0"
+    "lima\0"
+    "límite\0"
+    "limón\0"
+    "limpio\0"
+    "lince\0"
+    "lindo\0"
+    "línea\0"
+    "lingote\0"
+    "lino\0"
+    "linterna\0"
+    "líquido\0"
+    "liso\0"
+    "lista\0"
+    "litera\0"
+    "litio\0"
+    "litro\0"
+    "llaga\0"
+    "llama\0"
+    "llanto\0"
+    "llave\0"
+    "llegar\0"
+    "llenar\0"
+    "llevar\0"
+    "llorar\0"
+    "llover\0"
+    "lluvia\0"
+    "lobo\0"
+    "loción\0"
+    "loco\0"
+    "locura\0"
+    "lógica\0"
+    "logro\0"
+    "lombriz\0"
+    "lomo\0"
+    "lonja\0"
+    "lote\0"
+    "lucha\0"
+    "lucir\0"
+    "lugar\0"
+    "lujo\0"
+    "luna\0"
+    "lunes\0"
+    "lupa\0"
+    "lustro\0"
+    "luto\0"
+    "luz\0"
+    "maceta\0"
+    "macho\0"
+    "madera\0"
+    "madre\0"
+    "maduro\0"
+    "maestro\0"
+    "mafia\0"
+    "magia\0"
+    "mago\0"
+    "maíz\0"
+    "maldad\0"
+    "maleta\0"
+    "malla\0"
+    "malo\0"
+    "mamá\0"
+    "mambo\0"
+    "mamut\0"
+    "manco\0"
+    "mando\0"
+    "manejar\0"
+    "manga\0"
+    "maniquí\0"
+    "manjar\0"
+    "mano\0"
+    "manso\0"
+    "manta\0"
+    "mañana\0"
+    "mapa\0"
+    "máquina\0"
+    "mar\0"
+    "marco\0"
+    "marea\0"
+    "marfil\0"
+    "margen\0"
+    "marido\0"
+    "mármol\0"
+    "marrón\0"
+    "martes\0"
+    "marzo\0"
+    "masa\0"
+    "máscara\0"
+    "masivo\0"
+    "matar\0"
+    "materia\0"
+    "matiz\0"
+    "matriz\0"
+    "máximo\0"
+    "mayor\0"
+    "mazorca\0"
+    "mecha\0"
+    "medalla\0"
+    "medio\0"
+    "médula\0"
+    "mejilla\0"
+    "mejor\0"
+    "melena\0"
+    "melón\0"
+    "memoria\0"
+    "menor\0"
+    "mensaje\0"
+    "mente\0"
+    "menú\0"
+    "mercado\0"
+    "merengue\0"
+    "mérito\0"
+    "mes\0"
+    "mesón\0"
+    "meta\0"
+    "meter\0"
+    "método\0"
+    "metro\0"
+    "mezcla\0"
+    "miedo\0"
+    "miel\0"
+    "miembro\0"
+    "miga\0"
+    "mil\0"
+    "milagro\0"
+    "militar\0"
+    "millón\0"
+    "mimo\0"
+    "mina\0"
+    "minero\0"
+    "mínimo\0"
+    "minuto\0"
+    "miope\0"
+    "mirar\0"
+    "misa\0"
+    "miseria\0"
+    "misil\0"
+    "mismo\0"
+    "mitad\0"
+    "mito\0"
+    "mochila\0"
+    "moción\0"
+    "moda\0"
+    "modelo\0"
+    "moho\0"
+    "mojar\0"
+    "molde\0"
+    "moler\0"
+    "molino\0"
+    "momento\0"
+    "momia\0"
+    "monarca\0"
+    "moneda\0"
+    "monja\0"
+    "monto\0"
+    "moño\0"
+    "morada\0"
+    "morder\0"
+    "moreno\0"
+    "morir\0"
+    "morro\0"
+    "morsa\0"
+    "mortal\0"
+    "mosca\0"
+    "mostrar\0"
+    "motivo\0"
+    "mover\0"
+    "móvil\0"
+    "mozo\0"
+    "mucho\0"
+    "mudar\0"
+    "mueble\0"
+    "muela\0"
+    "muerte\0"
+    "muestra\0"
+    "mugre\0"
+    "mujer\0"
+    "mula\0"
+    "muleta\0"
+    "multa\0"
+    "mundo\0"
+    "muñeca\0"
+    "mural\0"
+    "muro\0"
+    "músculo\0"
+    "museo\0"
+    "musgo\0"
+    "música\0"
+    "muslo\0"
+    "nácar\0"
+    "nación\0"
+    "nadar\0"
+    "naipe\0"
+    "naranja\0"
+    "nariz\0"
+    "narrar\0"
+    "nasal\0"
+    "natal\0"
+    "nativo\0"
+    "natural\0"
+    "náusea\0"
+    "naval\0"
+    "nave\0"
+    "navidad\0"
+    "necio\0"
+    "néctar\0"
+    "negar\0"
+    "negocio\0"
+    "negro\0"
+    "neón\0"
+    "nervio\0"
+    "neto\0"
+    "neutro\0"
+    "nevar\0"
+    "nevera\0"
+    "nicho\0"
+    "nido\0"
+    "niebla\0"
+    "nieto\0"
+    "niñez\0"
+    "niño\0"
+    "nítido\0"
+    "nivel\0"
+    "nobleza\0"
+    "noche\0"
+    "nómina\0"
+    "noria\0"
+    "norma\0"
+    "norte\0"
+    "nota\0"
+    "noticia\0"
+    "novato\0"
+    "novela\0"
+    "novio\0"
+    "nube\0"
+    "nuca\0"
+    "núcleo\0"
+    "nudillo\0"
+    "nudo\0"
+    "nuera\0"
+    "nueve\0"
+    "nuez\0"
+    "nulo\0"
+    "número\0"
+    "nutria\0"
+    "oasis\0"
+    "obeso\0"
+    "obispo\0"
+    "objeto\0"
+    "obra\0"
+    "obrero\0"
+    "observar\0"
+    "obtener\0"
+    "obvio\0"
+    "oca\0"
+    "ocaso\0"
+    "océano\0"
+    "ochenta\0"
+    "ocho\0"
+    "ocio\0"
+    "ocre\0"
+    "octavo\0"
+    "octubre\0"
+    "oculto\0"
+    "ocupar\0"
+    "ocurrir\0"
+    "odiar\0"
+    "odio\0"
+    "odisea\0"
+    "oeste\0"
+    "ofensa\0"
+    "oferta\0"
+    "oficio\0"
+    "ofrecer\0"
+    "ogro\0"
+    "oído\0"
+    "oír\0"
+    "ojo\0"
+    "ola\0"
+    "oleada\0"
+    "olfato\0"
+    "olivo\0"
+    "olla\0"
+    "olmo\0"
+    "olor\0"
+    "olvido\0"
+    "ombligo\0"
+    "onda\0"
+    "onza\0"
+    "opaco\0"
+    "opción\0"
+    "ópera\0"
+    "opinar\0"
+    "oponer\0"
+    "optar\0"
+    "óptica\0"
+    "opuesto\0"
+    "oración\0"
+    "orador\0"
+    "oral\0"
+    "órbita\0"
+    "orca\0"
+    "orden\0"
+    "oreja\0"
+    "órgano\0"
+    "orgía\0"
+    "orgullo\0"
+    "oriente\0"
+    "origen\0"
+    "orilla\0"
+    "oro\0"
+    "orquesta\0"
+    "oruga\0"
+    "osadía\0"
+    "oscuro\0"
+    "osezno\0"
+    "oso\0"
+    "ostra\0"
+    "otoño\0"
+    "otro\0"
+    "oveja\0"
+    "óvulo\0"
+    "óxido\0"
+    "oxígeno\0"
+    "oyente\0"
+    "ozono\0"
+    "pacto\0"
+    "padre\0"
+    "paella\0"
+    "página\0"
+    "pago\0"
+    "país\0"
+    "pájaro\0"
+    "palabra\0"
+    "palco\0"
+    "paleta\0"
+    "pálido\0"
+    "palma\0"
+    "paloma\0"
+    "palpar\0"
+    "pan\0"
+    "panal\0"
+    "pánico\0"
+    "pantera\0"
+    "pañuelo\0"
+    "papá\0"
+    "papel\0"
+    "papilla\0"
+    "paquete\0"
+    "parar\0"
+    "parcela\0"
+    "pared\0"
+    "parir\0"
+    "paro\0"
+    "párpado\0"
+    "parque\0"
+    "párrafo\0"
+    "parte\0"
+    "pasar\0"
+    "paseo\0"
+    "pasión\0"
+    "paso\0"
+    "pasta\0"
+    "pata\0"
+    "patio\0"
+    "patria\0"
+    "pausa\0"
+    "pauta\0"
+    "pavo\0"
+    "payaso\0"
+    "peatón\0"
+    "pecado\0"
+    "pecera\0"
+    "pecho\0"
+    "pedal\0"
+    "pedir\0"
+    "pegar\0"
+    "peine\0"
+    "pelar\0"
+    "peldaño\0"
+    "pelea\0"
+    "peligro\0"
+    "pellejo\0"
+    "pelo\0"
+    "peluca\0"
+    "pena\0"
+    "pensar\0"
+    "peñón\0"
+    "peón\0"
+    "peor\0"
+    "pepino\0"
+    "pequeño\0"
+    "pera\0"
+    "percha\0"
+    "perder\0"
+    "pereza\0"
+    "perfil\0"
+    "perico\0"
+    "perla\0"
+    "permiso\0"
+    "perro\0"
+    "persona\0"
+    "pesa\0"
+    "pesca\0"
+    "pésimo\0"
+    "pestaña\0"
+    "pétalo\0"
+    "petróleo\0"
+    "pez\0"
+    "pezuña\0"
+    "picar\0"
+    "pichón\0"
+    "pie\0"
+    "piedra\0"
+    "pierna\0"
+    "pieza\0"
+    "pijama\0"
+    "pilar\0"
+    "piloto\0"
+    "pimienta\0"
+    "pino\0"
+    "pintor\0"
+    "pinza\0"
+    "piña\0"
+    "piojo\0"
+    "pipa\0"
+    "pirata\0"
+    "pisar\0"
+    "piscina\0"
+    "piso\0"
+    "pista\0"
+    "pitón\0"
+    "pizca\0"
+    "placa\0"
+    "plan\0"
+    "plata\0"
+    "playa\0"
+    "plaza\0"
+    "pleito\0"
+    "pleno\0"
+    "plomo\0"
+    "pluma\0"
+    "plural\0"
+    "pobre\0"
+    "poco\0"
+    "poder\0"
+    "podio\0"
+    "poema\0"
+    "poesía\0"
+    "poeta\0"
+    "polen\0"
+    "policía\0"
+    "pollo\0"
+    "polvo\0"
+    "pomada\0"
+    "pomelo\0"
+    "pomo\0"
+    "pompa\0"
+    "poner\0"
+    "porción\0"
+    "portal\0"
+    "posada\0"
+    "poseer\0"
+    "posible\0"
+    "poste\0"
+    "potencia\0"
+    "potro\0"
+    "pozo\0"
+    "prado\0"
+    "precoz\0"
+    "pregunta\0"
+    "premio\0"
+    "prensa\0"
+    "preso\0"
+    "previo\0"
+    "primo\0"
+    "príncipe\0"
+    "prisión\0"
+    "privar\0"
+    "proa\0"
+    "probar\0"
+    "proceso\0"
+    "producto\0"
+    "proeza\0"
+    "profesor\0"
+    "programa\0"
+    "prole\0"
+    "promesa\0"
+    "pronto\0"
+    "propio\0"
+    "próximo\0"
+    "prueba\0"
+    "público\0"
+    "puchero\0"
+    "pudor\0"
+    "pueblo\0"
+    "puerta\0"
+    "puesto\0"
+    "pulga\0"
+    "pulir\0"
+    "pulmón\0"
+    "pulpo\0"
+    "pulso\0"
+    "puma\0"
+    "punto\0"
+    "puñal\0"
+    "puño\0"
+    "pupa\0"
+    "pupila\0"
+    "puré\0"
+    "quedar\0"
+    "queja\0"
+    "quemar\0"
+    "querer\0"
+    "queso\0"
+    "quieto\0"
+    "química\0"
+    "quince\0"
+    "quitar\0"
+    "rábano\0"
+    "rabia\0"
+    "rabo\0"
+    "ración\0"
+    "radical\0"
+    "raíz\0"
+    "rama\0"
+    "rampa\0"
+    "rancho\0"
+    "rango\0"
+    "rapaz\0"
+    "rápido\0"
+    "rapto\0"
+    "rasgo\0"
+    "raspa\0"
+    "rato\0"
+    "rayo\0"
+    "raza\0"
+    "razón\0"
+    "reacción\0"
+    "realidad\0"
+    "rebaño\0"
+    "rebote\0"
+    "recaer\0"
+    "receta\0"
+    "rechazo\0"
+    "recoger\0"
+    "recreo\0"
+    "recto\0"
+    "recurso\0"
+    "red\0"
+    "redondo\0"
+    "reducir\0"
+    "reflejo\0"
+    "reforma\0"
+    "refrán\0"
+    "refugio\0"
+    "regalo\0"
+    "regir\0"
+    "regla\0"
+    "regreso\0"
+    "rehén\0"
+    "reino\0"
+    "reír\0"
+    "reja\0"
+    "relato\0"
+    "relevo\0"
+    "relieve\0"
+    "relleno\0"
+    "reloj\0"
+    "remar\0"
+    "remedio\0"
+    "remo\0"
+    "rencor\0"
+    "rendir\0"
+    "renta\0"
+    "reparto\0"
+    "repetir\0"
+    "reposo\0"
+    "reptil\0"
+    "res\0"
+    "rescate\0"
+    "resina\0"
+    "respeto\0"
+    "resto\0"
+    "resumen\0"
+    "retiro\0"
+    "retorno\0"
+    "retrato\0"
+    "reunir\0"
+    "revés\0"
+    "revista\0"
+    "rey\0"
+    "rezar\0"
+    "rico\0"
+    "riego\0"
+    "rienda\0"
+    "riesgo\0"
+    "rifa\0"
+    "rígido\0"
+    "rigor\0"
+    "rincón\0"
+    "riñón\0"
+    "río\0"
+    "riqueza\0"
+    "risa\0"
+    "ritmo\0"
+    "rito\0"
+    "rizo\0"
+    "roble\0"
+    "roce\0"
+    "rociar\0"
+    "rodar\0"
+    "rodeo\0"
+    "rodilla\0"
+    "roer\0"
+    "rojizo\0"
+    "rojo\0"
+    "romero\0"
+    "romper\0"
+    "ron\0"
+    "ronco\0"
+    "ronda\0"
+    "ropa\0"
+    "ropero\0"
+    "rosa\0"
+    "rosca\0"
+    "rostro\0"
+    "rotar\0"
+    "rubí\0"
+    "rubor\0"
+    "rudo\0"
+    "rueda\0"
+    "rugir\0"
+    "ruido\0"
+    "ruina\0"
+    "ruleta\0"
+    "rulo\0"
+    "rumbo\0"
+    "rumor\0"
+    "ruptura\0"
+    "ruta\0"
+    "rutina\0"
+    "sábado\0"
+    "saber\0"
+    "sabio\0"
+    "sable\0"
+    "sacar\0"
+    "sagaz\0"
+    "sagrado\0"
+    "sala\0"
+    "saldo\0"
+    "salero\0"
+    "salir\0"
+    "salmón\0"
+    "salón\0"
+    "salsa\0"
+    "salto\0"
+    "salud\0"
+    "salvar\0"
+    "samba\0"
+    "sanción\0"
+    "sandía\0"
+    "sanear\0"
+    "sangre\0"
+    "sanidad\0"
+    "sano\0"
+    "santo\0"
+    "sapo\0"
+    "saque\0"
+    "sardina\0"
+    "sartén\0"
+    "sastre\0"
+    "satán\0"
+    "sauna\0"
+    "saxofón\0"
+    "sección\0"
+    "seco\0"
+    "secreto\0"
+    "secta\0"
+    "sed\0"
+    "seguir\0"
+    "seis\0"
+    "sello\0"
+    "selva\0"
+    "semana\0"
+    "semilla\0"
+    "senda\0"
+    "sensor\0"
+    "señal\0"
+    "señor\0"
+    "separar\0"
+    "sepia\0"
+    "sequía\0"
+    "ser\0"
+    "serie\0"
+    "sermón\0"
+    "servir\0"
+    "sesenta\0"
+    "sesión\0"
+    "seta\0"
+    "setenta\0"
+    "severo\0"
+    "sexo\0"
+    "sexto\0"
+    "sidra\0"
+    "siesta\0"
+    "siete\0"
+    "siglo\0"
+    "signo\0"
+    "sílaba\0"
+    "silbar\0"
+    "silencio\0"
+    "silla\0"
+    "símbolo\0"
+    "simio\0"
+    "sirena\0"
+    "sistema\0"
+    "sitio\0"
+    "situar\0"
+    "sobre\0"
+    "socio\0"
+    "sodio\0"
+    "sol\0"
+    "solapa\0"
+    "soldado\0"
+    "soledad\0"
+    "sólido\0"
+    "soltar\0"
+    "solución\0"
+    "sombra\0"
+    "sondeo\0"
+    "sonido\0"
+    "sonoro\0"
+    "sonrisa\0"
+    "sopa\0"
+    "soplar\0"
+    "soporte\0"
+    "sordo\0"
+    "sorpresa\0"
+    "sorteo\0"
+    "sostén\0"
+    "sótano\0"
+    "suave\0"
+    "subir\0"
+    "suceso\0"
+    "sudor\0"
+    "suegra\0"
+    "suelo\0"
+    "sueño\0"
+    "suerte\0"
+    "sufrir\0"
+    "sujeto\0"
+    "sultán\0"
+    "sumar\0"
+    "superar\0"
+    "suplir\0"
+    "suponer\0"
+    "supremo\0"
+    "sur\0"
+    "surco\0"
+    "sureño\0"
+    "surgir\0"
+    "susto\0"
+    "sutil\0"
+    "tabaco\0"
+    "tabique\0"
+    "tabla\0"
+    "tabú\0"
+    "taco\0"
+    "tacto\0"
+    "tajo\0"
+    "talar\0"
+    "talco\0"
+    "talento\0"
+    "talla\0"
+    "talón\0"
+    "tamaño\0"
+    "tambor\0"
+    "tango\0"
+    "tanque\0"
+    "tapa\0"
+    "tapete\0"
+    "tapia\0"
+    "tapón\0"
+    "taquilla\0"
+    "tarde\0"
+    "tarea\0"
+    "tarifa\0"
+    "tarjeta\0"
+    "tarot\0"
+    "tarro\0"
+    "tarta\0"
+    "tatuaje\0"
+    "tauro\0"
+    "taza\0"
+    "tazón\0"
+    "teatro\0"
+    "techo\0"
+    "tecla\0"
+    "técnica\0"
+    "tejado\0"
+    "tejer\0"
+    "tejido\0"
+    "tela\0"
+    "teléfono\0"
+    "tema\0"
+    "temor\0"
+    "templo\0"
+    "tenaz\0"
+    "tender\0"
+    "tener\0"
+    "tenis\0"
+    "tenso\0"
+    "teoría\0"
+    "terapia\0"
+    "terco\0"
+    "término\0"
+    "ternura\0"
+    "terror\0"
+    "tesis\0"
+    "tesoro\0"
+    "testigo\0"
+    "tetera\0"
+    "texto\0"
+    "tez\0"
+    "tibio\0"
+    "tiburón\0"
+    "tiempo\0"
+    "tienda\0"
+    "tierra\0"
+    "tieso\0"
+    "tigre\0"
+    "tijera\0"
+    "tilde\0"
+    "timbre\0"
+    "tímido\0"
+    "timo\0"
+    "tinta\0"
+    "tío\0"
+    "típico\0"
+    "tipo\0"
+    "tira\0"
+    "tirón\0"
+    "titán\0"
+    "títere\0"
+    "título\0"
+    "tiza\0"
+    "toalla\0"
+    "tobillo\0"
+    "tocar\0"
+    "tocino\0"
+    "todo\0"
+    "toga\0"
+    "toldo\0"
+    "tomar\0"
+    "tono\0"
+    "tonto\0"
+    "topar\0"
+    "tope\0"
+    "toque\0"
+    "tórax\0"
+    "torero\0"
+    "tormenta\0"
+    "torneo\0"
+    "toro\0"
+    "torpedo\0"
+    "torre\0"
+    "torso\0"
+    "tortuga\0"
+    "tos\0"
+    "tosco\0"
+    "toser\0"
+    "tóxico\0"
+    "trabajo\0"
+    "tractor\0"
+    "traer\0"
+    "tráfico\0"
+    "trago\0"
+    "traje\0"
+    "tramo\0"
+    "trance\0"
+    "trato\0"
+    "trauma\0"
+    "trazar\0"
+    "trébol\0"
+    "tregua\0"
+    "treinta\0"
+    "tren\0"
+    "trepar\0"
+    "tres\0"
+    "tribu\0"
+    "trigo\0"
+    "tripa\0"
+    "triste\0"
+    "triunfo\0"
+    "trofeo\0"
+    "trompa\0"
+    "tronco\0"
+    "tropa\0"
+    "trote\0"
+    "trozo\0"
+    "truco\0"
+    "trueno\0"
+    "trufa\0"
+    "tubería\0"
+    "tubo\0"
+    "tuerto\0"
+    "tumba\0"
+    "tumor\0"
+    "túnel\0"
+    "túnica\0"
+    "turbina\0"
+    "turismo\0"
+    "turno\0"
+    "tutor\0"
+    "ubicar\0"
+    "úlcera\0"
+    "umbral\0"
+    "unidad\0"
+    "unir\0"
+    "universo\0"
+    "uno\0"
+    "untar\0"
+    "uña\0"
+    "urbano\0"
+    "urbe\0"
+    "urgente\0"
+    "urna\0"
+    "usar\0"
+    "usuario\0"
+    "útil\0"
+    "utopía\0"
+    "uva\0"
+    "vaca\0"
+    "vacío\0"
+    "vacuna\0"
+    "vagar\0"
+    "vago\0"
+    "vaina\0"
+    "vajilla\0"
+    "vale\0"
+    "válido\0"
+    "valle\0"
+    "valor\0"
+    "válvula\0"
+    "vampiro\0"
+    "vara\0"
+    "variar\0"
+    "varón\0"
+    "vaso\0"
+    "vecino\0"
+    "vector\0"
+    "vehículo\0"
+    "veinte\0"
+    "vejez\0"
+    "vela\0"
+    "velero\0"
+    "veloz\0"
+    "vena\0"
+    "vencer\0"
+    "venda\0"
+    "veneno\0"
+    "vengar\0"
+    "venir\0"
+    "venta\0"
+    "venus\0"
+    "ver\0"
+    "verano\0"
+    "verbo\0"
+    "verde\0"
+    "vereda\0"
+    "verja\0"
+    "verso\0"
+    "verter\0"
+    "vía\0"
+    "viaje\0"
+    "vibrar\0"
+    "vicio\0"
+    "víctima\0"
+    "vida\0"
+    "vídeo\0"
+    "vidrio\0"
+    "viejo\0"
+    "viernes\0"
+    "vigor\0"
+    "vil\0"
+    "villa\0"
+    "vinagre\0"
+    "vino\0"
+    "viñedo\0"
+    "violín\0"
+    "viral\0"
+    "virgo\0"
+    "virtud\0"
+    "visor\0"
+    "víspera\0"
+    "vista\0"
+    "vitamina\0"
+    "viudo\0"
+    "vivaz\0"
+    "vivero\0"
+    "vivir\0"
+    "vivo\0"
+    "volcán\0"
+    "volumen\0"
+    "volver\0"
+    "voraz\0"
+    "votar\0"
+    "voto\0"
+    "voz\0"
+    "vuelo\0"
+    "vulgar\0"
+    "yacer\0"
+    "yate\0"
+    "yegua\0"
+    "yema\0"
+    "yerno\0"
+    "yeso\0"
+    "yodo\0"
+    "yoga\0"
+    "yogur\0"
+    "zafiro\0"
+    "zanja\0"
+    "zapato\0"
+    "zarza\0"
+    "zona\0"
+    "zorro\0"
+    "zumo\0"
+    "zurdo";
+
+static const uint16_t es_offsets[dictionary_size] =
 {
-    {
-        "ábaco",
-        "abdomen",
-        "abeja",
-        "abierto",
-        "abogado",
-        "abono",
-        "aborto",
-        "abrazo",
-        "abrir",
-        "abuelo",
-        "abuso",
-        "acabar",
-        "academia",
-        "acceso",
-        "acción",
-        "aceite",
-        "acelga",
-        "acento",
-        "aceptar",
-        "ácido",
-        "aclarar",
-        "acné",
-        "acoger",
-        "acoso",
-        "activo",
-        "acto",
-        "actriz",
-        "actuar",
-        "acudir",
-        "acuerdo",
-        "acusar",
-        "adicto",
-        "admitir",
-        "adoptar",
-        "adorno",
-        "aduana",
-        "adulto",
-        "aéreo",
-        "afectar",
-        "afición",
-        "afinar",
-        "afirmar",
-        "ágil",
-        "agitar",
-        "agonía",
-        "agosto",
-        "agotar",
-        "agregar",
-        "agrio",
-        "agua",
-        "agudo",
-        "águila",
-        "aguja",
-        "ahogo",
-        "ahorro",
-        "aire",
-        "aislar",
-        "ajedrez",
-        "ajeno",
-        "ajuste",
-        "alacrán",
-        "alambre",
-        "alarma",
-        "alba",
-        "álbum",
-        "alcalde",
-        "aldea",
-        "alegre",
-        "alejar",
-        "alerta",
-        "aleta",
-        "alfiler",
-        "alga",
-        "algodón",
-        "aliado",
-        "aliento",
-        "alivio",
-        "alma",
-        "almeja",
-        "almíbar",
-        "altar",
-        "alteza",
-        "altivo",
-        "alto",
-        "altura",
-        "alumno",
-        "alzar",
-        "amable",
-        "amante",
-        "amapola",
-        "amargo",
-        "amasar",
-        "ámbar",
-        "ámbito",
-        "ameno",
-        "amigo",
-        "amistad",
-        "amor",
-        "amparo",
-        "amplio",
-        "ancho",
-        "anciano",
-        "ancla",
-        "andar",
-        "andén",
-        "anemia",
-        "ángulo",
-        "anillo",
-        "ánimo",
-        "anís",
-        "anotar",
-        "antena",
-        "antiguo",
-        "antojo",
-        "anual",
-        "anular",
-        "anuncio",
-        "añadir",
-        "añejo",
-        "año",
-        "apagar",
-        "aparato",
-        "apetito",
-        "apio",
-        "aplicar",
-        "apodo",
-        "aporte",
-        "apoyo",
-        "aprender",
-        "aprobar",
-        "apuesta",
-        "apuro",
-        "arado",
-        "araña",
-        "arar",
-        "árbitro",
-        "árbol",
-        "arbusto",
-        "archivo",
-        "arco",
-        "arder",
-        "ardilla",
-        "arduo",
-        "área",
-        "árido",
-        "aries",
-        "armonía",
-        "arnés",
-        "aroma",
-        "arpa",
-        "arpón",
-        "arreglo",
-        "arroz",
-        "arruga",
-        "arte",
-        "artista",
-        "asa",
-        "asado",
-        "asalto",
-        "ascenso",
-        "asegurar",
-        "aseo",
-        "asesor",
-        "asiento",
-        "asilo",
-        "asistir",
-        "asno",
-        "asombro",
-        "áspero",
-        "astilla",
-        "astro",
-        "astuto",
-        "asumir",
-        "asunto",
-        "atajo",
-        "ataque",
-        "atar",
-        "atento",
-        "ateo",
-        "ático",
-        "atleta",
-        "átomo",
-        "atraer",
-        "atroz",
-        "atún",
-        "audaz",
-        "audio",
-        "auge",
-        "aula",
-        "aumento",
-        "ausente",
-        "autor",
-        "aval",
-        "avance",
-        "avaro",
-        "ave",
-        "avellana",
-        "avena",
-        "avestruz",
-        "avión",
-        "aviso",
-        "ayer",
-        "ayuda",
-        "ayuno",
-        "azafrán",
-        "azar",
-        "azote",
-        "azúcar",
-        "azufre",
-        "azul",
-        "baba",
-        "babor",
-        "bache",
-        "bahía",
-        "baile",
-        "bajar",
-        "balanza",
-        "balcón",
-        "balde",
-        "bambú",
-        "banco",
-        "banda",
-        "baño",
-        "barba",
-        "barco",
-        "barniz",
-        "barro",
-        "báscula",
-        "bastón",
-        "basura",
-        "batalla",
-        "batería",
-        "batir",
-        "batuta",
-        "baúl",
-        "bazar",
-        "bebé",
-        "bebida",
-        "bello",
-        "besar",
-        "beso",
-        "bestia",
-        "bicho",
-        "bien",
-        "bingo",
-        "blanco",
-        "bloque",
-        "blusa",
-        "boa",
-        "bobina",
-        "bobo",
-        "boca",
-        "bocina",
-        "boda",
-        "bodega",
-        "boina",
-        "bola",
-        "bolero",
-        "bolsa",
-        "bomba",
-        "bondad",
-        "bonito",
-        "bono",
-        "bonsái",
-        "borde",
-        "borrar",
-        "bosque",
-        "bote",
-        "botín",
-        "bóveda",
-        "bozal",
-        "bravo",
-        "brazo",
-        "brecha",
-        "breve",
-        "brillo",
-        "brinco",
-        "brisa",
-        "broca",
-        "broma",
-        "bronce",
-        "brote",
-        "bruja",
-        "brusco",
-        "bruto",
-        "buceo",
-        "bucle",
-        "bueno",
-        "buey",
-        "bufanda",
-        "bufón",
-        "búho",
-        "buitre",
-        "bulto",
-        "burbuja",
-        "burla",
-        "burro",
-        "buscar",
-        "butaca",
-        "buzón",
-        "caballo",
-        "cabeza",
-        "cabina",
-        "cabra",
-        "cacao",
-        "cadáver",
-        "cadena",
-        "caer",
-        "café",
-        "caída",
-        "caimán",
-        "caja",
-        "cajón",
-        "cal",
-        "calamar",
-        "calcio",
-        "caldo",
-        "calidad",
-        "calle",
-        "calma",
-        "calor",
-        "calvo",
-        "cama",
-        "cambio",
-        "camello",
-        "camino",
-        "campo",
-        "cáncer",
-        "candil",
-        "canela",
-        "canguro",
-        "canica",
-        "canto",
-        "caña",
-        "cañón",
-        "caoba",
-        "caos",
-        "capaz",
-        "capitán",
-        "capote",
-        "captar",
-        "capucha",
-        "cara",
-        "carbón",
-        "cárcel",
-        "careta",
-        "carga",
-        "cariño",
-        "carne",
-        "carpeta",
-        "carro",
-        "carta",
-        "casa",
-        "casco",
-        "casero",
-        "caspa",
-        "castor",
-        "catorce",
-        "catre",
-        "caudal",
-        "causa",
-        "cazo",
-        "cebolla",
-        "ceder",
-        "cedro",
-        "celda",
-        "célebre",
-        "celoso",
-        "célula",
-        "cemento",
-        "ceniza",
-        "centro",
-        "cerca",
-        "cerdo",
-        "cereza",
-        "cero",
-        "cerrar",
-        "certeza",
-        "césped",
-        "cetro",
-        "chacal",
-        "chaleco",
-        "champú",
-        "chancla",
-        "chapa",
-        "charla",
-        "chico",
-        "chiste",
-        "chivo",
-        "choque",
-        "choza",
-        "chuleta",
-        "chupar",
-        "ciclón",
-        "ciego",
-        "cielo",
-        "cien",
-        "cierto",
-        "cifra",
-        "cigarro",
-        "cima",
-        "cinco",
-        "cine",
-        "cinta",
-        "ciprés",
-        "circo",
-        "ciruela",
-        "cisne",
-        "cita",
-        "ciudad",
-        "clamor",
-        "clan",
-        "claro",
-        "clase",
-        "clave",
-        "cliente",
-        "clima",
-        "clínica",
-        "cobre",
-        "cocción",
-        "cochino",
-        "cocina",
-        "coco",
-        "código",
-        "codo",
-        "cofre",
-        "coger",
-        "cohete",
-        "cojín",
-        "cojo",
-        "cola",
-        "colcha",
-        "colegio",
-        "colgar",
-        "colina",
-        "collar",
-        "colmo",
-        "columna",
-        "combate",
-        "comer",
-        "comida",
-        "cómodo",
-        "compra",
-        "conde",
-        "conejo",
-        "conga",
-        "conocer",
-        "consejo",
-        "contar",
-        "copa",
-        "copia",
-        "corazón",
-        "corbata",
-        "corcho",
-        "cordón",
-        "corona",
-        "correr",
-        "coser",
-        "cosmos",
-        "costa",
-        "cráneo",
-        "cráter",
-        "crear",
-        "crecer",
-        "creído",
-        "crema",
-        "cría",
-        "crimen",
-        "cripta",
-        "crisis",
-        "cromo",
-        "crónica",
-        "croqueta",
-        "crudo",
-        "cruz",
-        "cuadro",
-        "cuarto",
-        "cuatro",
-        "cubo",
-        "cubrir",
-        "cuchara",
-        "cuello",
-        "cuento",
-        "cuerda",
-        "cuesta",
-        "cueva",
-        "cuidar",
-        "culebra",
-        "culpa",
-        "culto",
-        "cumbre",
-        "cumplir",
-        "cuna",
-        "cuneta",
-        "cuota",
-        "cupón",
-        "cúpula",
-        "curar",
-        "curioso",
-        "curso",
-        "curva",
-        "cutis",
-        "dama",
-        "danza",
-        "dar",
-        "dardo",
-        "dátil",
-        "deber",
-        "débil",
-        "década",
-        "decir",
-        "dedo",
-        "defensa",
-        "definir",
-        "dejar",
-        "delfín",
-        "delgado",
-        "delito",
-        "demora",
-        "denso",
-        "dental",
-        "deporte",
-        "derecho",
-        "derrota",
-        "desayuno",
-        "deseo",
-        "desfile",
-        "desnudo",
-        "destino",
-        "desvío",
-        "detalle",
-        "detener",
-        "deuda",
-        "día",
-        "diablo",
-        "diadema",
-        "diamante",
-        "diana",
-        "diario",
-        "dibujo",
-        "dictar",
-        "diente",
-        "dieta",
-        "diez",
-        "difícil",
-        "digno",
-        "dilema",
-        "diluir",
-        "dinero",
-        "directo",
-        "dirigir",
-        "disco",
-        "diseño",
-        "disfraz",
-        "diva",
-        "divino",
-        "doble",
-        "doce",
-        "dolor",
-        "domingo",
-        "don",
-        "donar",
-        "dorado",
-        "dormir",
-        "dorso",
-        "dos",
-        "dosis",
-        "dragón",
-        "droga",
-        "ducha",
-        "duda",
-        "duelo",
-        "dueño",
-        "dulce",
-        "dúo",
-        "duque",
-        "durar",
-        "dureza",
-        "duro",
-        "ébano",
-        "ebrio",
-        "echar",
-        "eco",
-        "ecuador",
-        "edad",
-        "edición",
-        "edificio",
-        "editor",
-        "educar",
-        "efecto",
-        "eficaz",
-        "eje",
-        "ejemplo",
-        "elefante",
-        "elegir",
-        "elemento",
-        "elevar",
-        "elipse",
-        "élite",
-        "elixir",
-        "elogio",
-        "eludir",
-        "embudo",
-        "emitir",
-        "emoción",
-        "empate",
-        "empeño",
-        "empleo",
-        "empresa",
-        "enano",
-        "encargo",
-        "enchufe",
-        "encía",
-        "enemigo",
-        "enero",
-        "enfado",
-        "enfermo",
-        "engaño",
-        "enigma",
-        "enlace",
-        "enorme",
-        "enredo",
-        "ensayo",
-        "enseñar",
-        "entero",
-        "entrar",
-        "envase",
-        "envío",
-        "época",
-        "equipo",
-        "erizo",
-        "escala",
-        "escena",
-        "escolar",
-        "escribir",
-        "escudo",
-        "esencia",
-        "esfera",
-        "esfuerzo",
-        "espada",
-        "espejo",
-        "espía",
-        "esposa",
-        "espuma",
-        "esquí",
-        "estar",
-        "este",
-        "estilo",
-        "estufa",
-        "etapa",
-        "eterno",
-        "ética",
-        "etnia",
-        "evadir",
-        "evaluar",
-        "evento",
-        "evitar",
-        "exacto",
-        "examen",
-        "exceso",
-        "excusa",
-        "exento",
-        "exigir",
-        "exilio",
-        "existir",
-        "éxito",
-        "experto",
-        "explicar",
-        "exponer",
-        "extremo",
-        "fábrica",
-        "fábula",
-        "fachada",
-        "fácil",
-        "factor",
-        "faena",
-        "faja",
-        "falda",
-        "fallo",
-        "falso",
-        "faltar",
-        "fama",
-        "familia",
-        "famoso",
-        "faraón",
-        "farmacia",
-        "farol",
-        "farsa",
-        "fase",
-        "fatiga",
-        "fauna",
-        "favor",
-        "fax",
-        "febrero",
-        "fecha",
-        "feliz",
-        "feo",
-        "feria",
-        "feroz",
-        "fértil",
-        "fervor",
-        "festín",
-        "fiable",
-        "fianza",
-        "fiar",
-        "fibra",
-        "ficción",
-        "ficha",
-        "fideo",
-        "fiebre",
-        "fiel",
-        "fiera",
-        "fiesta",
-        "figura",
-        "fijar",
-        "fijo",
-        "fila",
-        "filete",
-        "filial",
-        "filtro",
-        "fin",
-        "finca",
-        "fingir",
-        "finito",
-        "firma",
-        "flaco",
-        "flauta",
-        "flecha",
-        "flor",
-        "flota",
-        "fluir",
-        "flujo",
-        "flúor",
-        "fobia",
-        "foca",
-        "fogata",
-        "fogón",
-        "folio",
-        "folleto",
-        "fondo",
-        "forma",
-        "forro",
-        "fortuna",
-        "forzar",
-        "fosa",
-        "foto",
-        "fracaso",
-        "frágil",
-        "franja",
-        "frase",
-        "fraude",
-        "freír",
-        "freno",
-        "fresa",
-        "frío",
-        "frito",
-        "fruta",
-        "fuego",
-        "fuente",
-        "fuerza",
-        "fuga",
-        "fumar",
-        "función",
-        "funda",
-        "furgón",
-        "furia",
-        "fusil",
-        "fútbol",
-        "futuro",
-        "gacela",
-        "gafas",
-        "gaita",
-        "gajo",
-        "gala",
-        "galería",
-        "gallo",
-        "gamba",
-        "ganar",
-        "gancho",
-        "ganga",
-        "ganso",
-        "garaje",
-        "garza",
-        "gasolina",
-        "gastar",
-        "gato",
-        "gavilán",
-        "gemelo",
-        "gemir",
-        "gen",
-        "género",
-        "genio",
-        "gente",
-        "geranio",
-        "gerente",
-        "germen",
-        "gesto",
-        "gigante",
-        "gimnasio",
-        "girar",
-        "giro",
-        "glaciar",
-        "globo",
-        "gloria",
-        "gol",
-        "golfo",
-        "goloso",
-        "golpe",
-        "goma",
-        "gordo",
-        "gorila",
-        "gorra",
-        "gota",
-        "goteo",
-        "gozar",
-        "grada",
-        "gráfico",
-        "grano",
-        "grasa",
-        "gratis",
-        "grave",
-        "grieta",
-        "grillo",
-        "gripe",
-        "gris",
-        "grito",
-        "grosor",
-        "grúa",
-        "grueso",
-        "grumo",
-        "grupo",
-        "guante",
-        "guapo",
-        "guardia",
-        "guerra",
-        "guía",
-        "guiño",
-        "guion",
-        "guiso",
-        "guitarra",
-        "gusano",
-        "gustar",
-        "haber",
-        "hábil",
-        "hablar",
-        "hacer",
-        "hacha",
-        "hada",
-        "hallar",
-        "hamaca",
-        "harina",
-        "haz",
-        "hazaña",
-        "hebilla",
-        "hebra",
-        "hecho",
-        "helado",
-        "helio",
-        "hembra",
-        "herir",
-        "hermano",
-        "héroe",
-        "hervir",
-        "hielo",
-        "hierro",
-        "hígado",
-        "higiene",
-        "hijo",
-        "himno",
-        "historia",
-        "hocico",
-        "hogar",
-        "hoguera",
-        "hoja",
-        "hombre",
-        "hongo",
-        "honor",
-        "honra",
-        "hora",
-        "hormiga",
-        "horno",
-        "hostil",
-        "hoyo",
-        "hueco",
-        "huelga",
-        "huerta",
-        "hueso",
-        "huevo",
-        "huida",
-        "huir",
-        "humano",
-        "húmedo",
-        "humilde",
-        "humo",
-        "hundir",
-        "huracán",
-        "hurto",
-        "icono",
-        "ideal",
-        "idioma",
-        "ídolo",
-        "iglesia",
-        "iglú",
-        "igual",
-        "ilegal",
-        "ilusión",
-        "imagen",
-        "imán",
-        "imitar",
-        "impar",
-        "imperio",
-        "imponer",
-        "impulso",
-        "incapaz",
-        "índice",
-        "inerte",
-        "infiel",
-        "informe",
-        "ingenio",
-        "inicio",
-        "inmenso",
-        "inmune",
-        "innato",
-        "insecto",
-        "instante",
-        "interés",
-        "íntimo",
-        "intuir",
-        "inútil",
-        "invierno",
-        "ira",
-        "iris",
-        "ironía",
-        "isla",
-        "islote",
-        "jabalí",
-        "jabón",
-        "jamón",
-        "jarabe",
-        "jardín",
-        "jarra",
-        "jaula",
-        "jazmín",
-        "jefe",
-        "jeringa",
-        "jinete",
-        "jornada",
-        "joroba",
-        "joven",
-        "joya",
-        "juerga",
-        "jueves",
-        "juez",
-        "jugador",
-        "jugo",
-        "juguete",
-        "juicio",
-        "junco",
-        "jungla",
-        "junio",
-        "juntar",
-        "júpiter",
-        "jurar",
-        "justo",
-        "juvenil",
-        "juzgar",
-        "kilo",
-        "koala",
-        "labio",
-        "lacio",
-        "lacra",
-        "lado",
-        "ladrón",
-        "lagarto",
-        "lágrima",
-        "laguna",
-        "laico",
-        "lamer",
-        "lámina",
-        "lámpara",
-        "lana",
-        "lancha",
-        "langosta",
-        "lanza",
-        "lápiz",
-        "largo",
-        "larva",
-        "lástima",
-        "lata",
-        "látex",
-        "latir",
-        "laurel",
-        "lavar",
-        "lazo",
-        "leal",
-        "lección",
-        "leche",
-        "lector",
-        "leer",
-        "legión",
-        "legumbre",
-        "lejano",
-        "lengua",
-        "lento",
-        "leña",
-        "león",
-        "leopardo",
-        "lesión",
-        "letal",
-        "letra",
-        "leve",
-        "leyenda",
-        "libertad",
-        "libro",
-        "licor",
-        "líder",
-        "lidiar",
-        "lienzo",
-        "liga",
-        "ligero",
-        "lima",
-        "límite",
-        "limón",
-        "limpio",
-        "lince",
-        "lindo",
-        "línea",
-        "lingote",
-        "lino",
-        "linterna",
-        "líquido",
-        "liso",
-        "lista",
-        "litera",
-        "litio",
-        "litro",
-        "llaga",
-        "llama",
-        "llanto",
-        "llave",
-        "llegar",
-        "llenar",
-        "llevar",
-        "llorar",
-        "llover",
-        "lluvia",
-        "lobo",
-        "loción",
-        "loco",
-        "locura",
-        "lógica",
-        "logro",
-        "lombriz",
-        "lomo",
-        "lonja",
-        "lote",
-        "lucha",
-        "lucir",
-        "lugar",
-        "lujo",
-        "luna",
-        "lunes",
-        "lupa",
-        "lustro",
-        "luto",
-        "luz",
-        "maceta",
-        "macho",
-        "madera",
-        "madre",
-        "maduro",
-        "maestro",
-        "mafia",
-        "magia",
-        "mago",
-        "maíz",
-        "maldad",
-        "maleta",
-        "malla",
-        "malo",
-        "mamá",
-        "mambo",
-        "mamut",
-        "manco",
-        "mando",
-        "manejar",
-        "manga",
-        "maniquí",
-        "manjar",
-        "mano",
-        "manso",
-        "manta",
-        "mañana",
-        "mapa",
-        "máquina",
-        "mar",
-        "marco",
-        "marea",
-        "marfil",
-        "margen",
-        "marido",
-        "mármol",
-        "marrón",
-        "martes",
-        "marzo",
-        "masa",
-        "máscara",
-        "masivo",
-        "matar",
-        "materia",
-        "matiz",
-        "matriz",
-        "máximo",
-        "mayor",
-        "mazorca",
-        "mecha",
-        "medalla",
-        "medio",
-        "médula",
-        "mejilla",
-        "mejor",
-        "melena",
-        "melón",
-        "memoria",
-        "menor",
-        "mensaje",
-        "mente",
-        "menú",
-        "mercado",
-        "merengue",
-        "mérito",
-        "mes",
-        "mesón",
-        "meta",
-        "meter",
-        "método",
-        "metro",
-        "mezcla",
-        "miedo",
-        "miel",
-        "miembro",
-        "miga",
-        "mil",
-        "milagro",
-        "militar",
-        "millón",
-        "mimo",
-        "mina",
-        "minero",
-        "mínimo",
-        "minuto",
-        "miope",
-        "mirar",
-        "misa",
-        "miseria",
-        "misil",
-        "mismo",
-        "mitad",
-        "mito",
-        "mochila",
-        "moción",
-        "moda",
-        "modelo",
-        "moho",
-        "mojar",
-        "molde",
-        "moler",
-        "molino",
-        "momento",
-        "momia",
-        "monarca",
-        "moneda",
-        "monja",
-        "monto",
-        "moño",
-        "morada",
-        "morder",
-        "moreno",
-        "morir",
-        "morro",
-        "morsa",
-        "mortal",
-        "mosca",
-        "mostrar",
-        "motivo",
-        "mover",
-        "móvil",
-        "mozo",
-        "mucho",
-        "mudar",
-        "mueble",
-        "muela",
-        "muerte",
-        "muestra",
-        "mugre",
-        "mujer",
-        "mula",
-        "muleta",
-        "multa",
-        "mundo",
-        "muñeca",
-        "mural",
-        "muro",
-        "músculo",
-        "museo",
-        "musgo",
-        "música",
-        "muslo",
-        "nácar",
-        "nación",
-        "nadar",
-        "naipe",
-        "naranja",
-        "nariz",
-        "narrar",
-        "nasal",
-        "natal",
-        "nativo",
-        "natural",
-        "náusea",
-        "naval",
-        "nave",
-        "navidad",
-        "necio",
-        "néctar",
-        "negar",
-        "negocio",
-        "negro",
-        "neón",
-        "nervio",
-        "neto",
-        "neutro",
-        "nevar",
-        "nevera",
-        "nicho",
-        "nido",
-        "niebla",
-        "nieto",
-        "niñez",
-        "niño",
-        "nítido",
-        "nivel",
-        "nobleza",
-        "noche",
-        "nómina",
-        "noria",
-        "norma",
-        "norte",
-        "nota",
-        "noticia",
-        "novato",
-        "novela",
-        "novio",
-        "nube",
-        "nuca",
-        "núcleo",
-        "nudillo",
-        "nudo",
-        "nuera",
-        "nueve",
-        "nuez",
-        "nulo",
-        "número",
-        "nutria",
-        "oasis",
-        "obeso",
-        "obispo",
-        "objeto",
-        "obra",
-        "obrero",
-        "observar",
-        "obtener",
-        "obvio",
-        "oca",
-        "ocaso",
-        "océano",
-        "ochenta",
-        "ocho",
-        "ocio",
-        "ocre",
-        "octavo",
-        "octubre",
-        "oculto",
-        "ocupar",
-        "ocurrir",
-        "odiar",
-        "odio",
-        "odisea",
-        "oeste",
-        "ofensa",
-        "oferta",
-        "oficio",
-        "ofrecer",
-        "ogro",
-        "oído",
-        "oír",
-        "ojo",
-        "ola",
-        "oleada",
-        "olfato",
-        "olivo",
-        "olla",
-        "olmo",
-        "olor",
-        "olvido",
-        "ombligo",
-        "onda",
-        "onza",
-        "opaco",
-        "opción",
-        "ópera",
-        "opinar",
-        "oponer",
-        "optar",
-        "óptica",
-        "opuesto",
-        "oración",
-        "orador",
-        "oral",
-        "órbita",
-        "orca",
-        "orden",
-        "oreja",
-        "órgano",
-        "orgía",
-        "orgullo",
-        "oriente",
-        "origen",
-        "orilla",
-        "oro",
-        "orquesta",
-        "oruga",
-        "osadía",
-        "oscuro",
-        "osezno",
-        "oso",
-        "ostra",
-        "otoño",
-        "otro",
-        "oveja",
-        "óvulo",
-        "óxido",
-        "oxígeno",
-        "oyente",
-        "ozono",
-        "pacto",
-        "padre",
-        "paella",
-        "página",
-        "pago",
-        "país",
-        "pájaro",
-        "palabra",
-        "palco",
-        "paleta",
-        "pálido",
-        "palma",
-        "paloma",
-        "palpar",
-        "pan",
-        "panal",
-        "pánico",
-        "pantera",
-        "pañuelo",
-        "papá",
-        "papel",
-        "papilla",
-        "paquete",
-        "parar",
-        "parcela",
-        "pared",
-        "parir",
-        "paro",
-        "párpado",
-        "parque",
-        "párrafo",
-        "parte",
-        "pasar",
-        "paseo",
-        "pasión",
-        "paso",
-        "pasta",
-        "pata",
-        "patio",
-        "patria",
-        "pausa",
-        "pauta",
-        "pavo",
-        "payaso",
-        "peatón",
-        "pecado",
-        "pecera",
-        "pecho",
-        "pedal",
-        "pedir",
-        "pegar",
-        "peine",
-        "pelar",
-        "peldaño",
-        "pelea",
-        "peligro",
-        "pellejo",
-        "pelo",
-        "peluca",
-        "pena",
-        "pensar",
-        "peñón",
-        "peón",
-        "peor",
-        "pepino",
-        "pequeño",
-        "pera",
-        "percha",
-        "perder",
-        "pereza",
-        "perfil",
-        "perico",
-        "perla",
-        "permiso",
-        "perro",
-        "persona",
-        "pesa",
-        "pesca",
-        "pésimo",
-        "pestaña",
-        "pétalo",
-        "petróleo",
-        "pez",
-        "pezuña",
-        "picar",
-        "pichón",
-        "pie",
-        "piedra",
-        "pierna",
-        "pieza",
-        "pijama",
-        "pilar",
-        "piloto",
-        "pimienta",
-        "pino",
-        "pintor",
-        "pinza",
-        "piña",
-        "piojo",
-        "pipa",
-        "pirata",
-        "pisar",
-        "piscina",
-        "piso",
-        "pista",
-        "pitón",
-        "pizca",
-        "placa",
-        "plan",
-        "plata",
-        "playa",
-        "plaza",
-        "pleito",
-        "pleno",
-        "plomo",
-        "pluma",
-        "plural",
-        "pobre",
-        "poco",
-        "poder",
-        "podio",
-        "poema",
-        "poesía",
-        "poeta",
-        "polen",
-        "policía",
-        "pollo",
-        "polvo",
-        "pomada",
-        "pomelo",
-        "pomo",
-        "pompa",
-        "poner",
-        "porción",
-        "portal",
-        "posada",
-        "poseer",
-        "posible",
-        "poste",
-        "potencia",
-        "potro",
-        "pozo",
-        "prado",
-        "precoz",
-        "pregunta",
-        "premio",
-        "prensa",
-        "preso",
-        "previo",
-        "primo",
-        "príncipe",
-        "prisión",
-        "privar",
-        "proa",
-        "probar",
-        "proceso",
-        "producto",
-        "proeza",
-        "profesor",
-        "programa",
-        "prole",
-        "promesa",
-        "pronto",
-        "propio",
-        "próximo",
-        "prueba",
-        "público",
-        "puchero",
-        "pudor",
-        "pueblo",
-        "puerta",
-        "puesto",
-        "pulga",
-        "pulir",
-        "pulmón",
-        "pulpo",
-        "pulso",
-        "puma",
-        "punto",
-        "puñal",
-        "puño",
-        "pupa",
-        "pupila",
-        "puré",
-        "quedar",
-        "queja",
-        "quemar",
-        "querer",
-        "queso",
-        "quieto",
-        "química",
-        "quince",
-        "quitar",
-        "rábano",
-        "rabia",
-        "rabo",
-        "ración",
-        "radical",
-        "raíz",
-        "rama",
-        "rampa",
-        "rancho",
-        "rango",
-        "rapaz",
-        "rápido",
-        "rapto",
-        "rasgo",
-        "raspa",
-        "rato",
-        "rayo",
-        "raza",
-        "razón",
-        "reacción",
-        "realidad",
-        "rebaño",
-        "rebote",
-        "recaer",
-        "receta",
-        "rechazo",
-        "recoger",
-        "recreo",
-        "recto",
-        "recurso",
-        "red",
-        "redondo",
-        "reducir",
-        "reflejo",
-        "reforma",
-        "refrán",
-        "refugio",
-        "regalo",
-        "regir",
-        "regla",
-        "regreso",
-        "rehén",
-        "reino",
-        "reír",
-        "reja",
-        "relato",
-        "relevo",
-        "relieve",
-        "relleno",
-        "reloj",
-        "remar",
-        "remedio",
-        "remo",
-        "rencor",
-        "rendir",
-        "renta",
-        "reparto",
-        "repetir",
-        "reposo",
-        "reptil",
-        "res",
-        "rescate",
-        "resina",
-        "respeto",
-        "resto",
-        "resumen",
-        "retiro",
-        "retorno",
-        "retrato",
-        "reunir",
-        "revés",
-        "revista",
-        "rey",
-        "rezar",
-        "rico",
-        "riego",
-        "rienda",
-        "riesgo",
-        "rifa",
-        "rígido",
-        "rigor",
-        "rincón",
-        "riñón",
-        "río",
-        "riqueza",
-        "risa",
-        "ritmo",
-        "rito",
-        "rizo",
-        "roble",
-        "roce",
-        "rociar",
-        "rodar",
-        "rodeo",
-        "rodilla",
-        "roer",
-        "rojizo",
-        "rojo",
-        "romero",
-        "romper",
-        "ron",
-        "ronco",
-        "ronda",
-        "ropa",
-        "ropero",
-        "rosa",
-        "rosca",
-        "rostro",
-        "rotar",
-        "rubí",
-        "rubor",
-        "rudo",
-        "rueda",
-        "rugir",
-        "ruido",
-        "ruina",
-        "ruleta",
-        "rulo",
-        "rumbo",
-        "rumor",
-        "ruptura",
-        "ruta",
-        "rutina",
-        "sábado",
-        "saber",
-        "sabio",
-        "sable",
-        "sacar",
-        "sagaz",
-        "sagrado",
-        "sala",
-        "saldo",
-        "salero",
-        "salir",
-        "salmón",
-        "salón",
-        "salsa",
-        "salto",
-        "salud",
-        "salvar",
-        "samba",
-        "sanción",
-        "sandía",
-        "sanear",
-        "sangre",
-        "sanidad",
-        "sano",
-        "santo",
-        "sapo",
-        "saque",
-        "sardina",
-        "sartén",
-        "sastre",
-        "satán",
-        "sauna",
-        "saxofón",
-        "sección",
-        "seco",
-        "secreto",
-        "secta",
-        "sed",
-        "seguir",
-        "seis",
-        "sello",
-        "selva",
-        "semana",
-        "semilla",
-        "senda",
-        "sensor",
-        "señal",
-        "señor",
-        "separar",
-        "sepia",
-        "sequía",
-        "ser",
-        "serie",
-        "sermón",
-        "servir",
-        "sesenta",
-        "sesión",
-        "seta",
-        "setenta",
-        "severo",
-        "sexo",
-        "sexto",
-        "sidra",
-        "siesta",
-        "siete",
-        "siglo",
-        "signo",
-        "sílaba",
-        "silbar",
-        "silencio",
-        "silla",
-        "símbolo",
-        "simio",
-        "sirena",
-        "sistema",
-        "sitio",
-        "situar",
-        "sobre",
-        "socio",
-        "sodio",
-        "sol",
-        "solapa",
-        "soldado",
-        "soledad",
-        "sólido",
-        "soltar",
-        "solución",
-        "sombra",
-        "sondeo",
-        "sonido",
-        "sonoro",
-        "sonrisa",
-        "sopa",
-        "soplar",
-        "soporte",
-        "sordo",
-        "sorpresa",
-        "sorteo",
-        "sostén",
-        "sótano",
-        "suave",
-        "subir",
-        "suceso",
-        "sudor",
-        "suegra",
-        "suelo",
-        "sueño",
-        "suerte",
-        "sufrir",
-        "sujeto",
-        "sultán",
-        "sumar",
-        "superar",
-        "suplir",
-        "suponer",
-        "supremo",
-        "sur",
-        "surco",
-        "sureño",
-        "surgir",
-        "susto",
-        "sutil",
-        "tabaco",
-        "tabique",
-        "tabla",
-        "tabú",
-        "taco",
-        "tacto",
-        "tajo",
-        "talar",
-        "talco",
-        "talento",
-        "talla",
-        "talón",
-        "tamaño",
-        "tambor",
-        "tango",
-        "tanque",
-        "tapa",
-        "tapete",
-        "tapia",
-        "tapón",
-        "taquilla",
-        "tarde",
-        "tarea",
-        "tarifa",
-        "tarjeta",
-        "tarot",
-        "tarro",
-        "tarta",
-        "tatuaje",
-        "tauro",
-        "taza",
-        "tazón",
-        "teatro",
-        "techo",
-        "tecla",
-        "técnica",
-        "tejado",
-        "tejer",
-        "tejido",
-        "tela",
-        "teléfono",
-        "tema",
-        "temor",
-        "templo",
-        "tenaz",
-        "tender",
-        "tener",
-        "tenis",
-        "tenso",
-        "teoría",
-        "terapia",
-        "terco",
-        "término",
-        "ternura",
-        "terror",
-        "tesis",
-        "tesoro",
-        "testigo",
-        "tetera",
-        "texto",
-        "tez",
-        "tibio",
-        "tiburón",
-        "tiempo",
-        "tienda",
-        "tierra",
-        "tieso",
-        "tigre",
-        "tijera",
-        "tilde",
-        "timbre",
-        "tímido",
-        "timo",
-        "tinta",
-        "tío",
-        "típico",
-        "tipo",
-        "tira",
-        "tirón",
-        "titán",
-        "títere",
-        "título",
-        "tiza",
-        "toalla",
-        "tobillo",
-        "tocar",
-        "tocino",
-        "todo",
-        "toga",
-        "toldo",
-        "tomar",
-        "tono",
-        "tonto",
-        "topar",
-        "tope",
-        "toque",
-        "tórax",
-        "torero",
-        "tormenta",
-        "torneo",
-        "toro",
-        "torpedo",
-        "torre",
-        "torso",
-        "tortuga",
-        "tos",
-        "tosco",
-        "toser",
-        "tóxico",
-        "trabajo",
-        "tractor",
-        "traer",
-        "tráfico",
-        "trago",
-        "traje",
-        "tramo",
-        "trance",
-        "trato",
-        "trauma",
-        "trazar",
-        "trébol",
-        "tregua",
-        "treinta",
-        "tren",
-        "trepar",
-        "tres",
-        "tribu",
-        "trigo",
-        "tripa",
-        "triste",
-        "triunfo",
-        "trofeo",
-        "trompa",
-        "tronco",
-        "tropa",
-        "trote",
-        "trozo",
-        "truco",
-        "trueno",
-        "trufa",
-        "tubería",
-        "tubo",
-        "tuerto",
-        "tumba",
-        "tumor",
-        "túnel",
-        "túnica",
-        "turbina",
-        "turismo",
-        "turno",
-        "tutor",
-        "ubicar",
-        "úlcera",
-        "umbral",
-        "unidad",
-        "unir",
-        "universo",
-        "uno",
-        "untar",
-        "uña",
-        "urbano",
-        "urbe",
-        "urgente",
-        "urna",
-        "usar",
-        "usuario",
-        "útil",
-        "utopía",
-        "uva",
-        "vaca",
-        "vacío",
-        "vacuna",
-        "vagar",
-        "vago",
-        "vaina",
-        "vajilla",
-        "vale",
-        "válido",
-        "valle",
-        "valor",
-        "válvula",
-        "vampiro",
-        "vara",
-        "variar",
-        "varón",
-        "vaso",
-        "vecino",
-        "vector",
-        "vehículo",
-        "veinte",
-        "vejez",
-        "vela",
-        "velero",
-        "veloz",
-        "vena",
-        "vencer",
-        "venda",
-        "veneno",
-        "vengar",
-        "venir",
-        "venta",
-        "venus",
-        "ver",
-        "verano",
-        "verbo",
-        "verde",
-        "vereda",
-        "verja",
-        "verso",
-        "verter",
-        "vía",
-        "viaje",
-        "vibrar",
-        "vicio",
-        "víctima",
-        "vida",
-        "vídeo",
-        "vidrio",
-        "viejo",
-        "viernes",
-        "vigor",
-        "vil",
-        "villa",
-        "vinagre",
-        "vino",
-        "viñedo",
-        "violín",
-        "viral",
-        "virgo",
-        "virtud",
-        "visor",
-        "víspera",
-        "vista",
-        "vitamina",
-        "viudo",
-        "vivaz",
-        "vivero",
-        "vivir",
-        "vivo",
-        "volcán",
-        "volumen",
-        "volver",
-        "voraz",
-        "votar",
-        "voto",
-        "voz",
-        "vuelo",
-        "vulgar",
-        "yacer",
-        "yate",
-        "yegua",
-        "yema",
-        "yerno",
-        "yeso",
-        "yodo",
-        "yoga",
-        "yogur",
-        "zafiro",
-        "zanja",
-        "zapato",
-        "zarza",
-        "zona",
-        "zorro",
-        "zumo",
-        "zurdo"
-    }
+    0, 7, 15, 21, 29, 37, 43, 50, 57, 63, 70, 76, 83, 92, 99, 107, 114, 121,
+    128, 136, 143, 151, 157, 164, 170, 177, 182, 189, 196, 203, 211, 218, 225,
+    233, 241, 248, 255, 262, 269, 277, 286, 293, 301, 307, 314, 322, 329, 336,
+    344, 350, 355, 361, 369, 375, 381, 388, 393, 400, 408, 414, 421, 430, 438,
+    445, 450, 457, 465, 471, 478, 485, 492, 498, 506, 511, 520, 527, 535, 542,
+    547, 554, 563, 569, 576, 583, 588, 595, 602, 608, 615, 622, 630, 637, 644,
+    651, 659, 665, 671, 679, 684, 691, 698, 704, 712, 718, 724, 731, 738, 746,
+    753, 760, 766, 773, 780, 788, 795, 801, 808, 816, 824, 831, 836, 843, 851,
+    859, 864, 872, 878, 885, 891, 900, 908, 916, 922, 928, 935, 940, 949, 956,
+    964, 972, 977, 983, 991, 997, 1003, 1010, 1016, 1025, 1032, 1038, 1043,
+    1050, 1058, 1064, 1071, 1076, 1084, 1088, 1094, 1101, 1109, 1118, 1123,
+    1130, 1138, 1144, 1152, 1157, 1165, 1173, 1181, 1187, 1194, 1201, 1208,
+    1214, 1221, 1226, 1233, 1238, 1245, 1252, 1259, 1266, 1272, 1278, 1284,
+    1290, 1295, 1300, 1308, 1316, 1322, 1327, 1334, 1340, 1344, 1353, 1359,
+    1368, 1375, 1381, 1386, 1392, 1398, 1407, 1412, 1418, 1426, 1433, 1438,
+    1443, 1449, 1455, 1462, 1468, 1474, 1482, 1490, 1496, 1503, 1509, 1515,
+    1521, 1527, 1533, 1540, 1546, 1555, 1563, 1570, 1578, 1587, 1593, 1600,
+    1606, 1612, 1618, 1625, 1631, 1637, 1642, 1649, 1655, 1660, 1666, 1673,
+    1680, 1686, 1690, 1697, 1702, 1707, 1714, 1719, 1726, 1732, 1737, 1744,
+    1750, 1756, 1763, 1770, 1775, 1783, 1789, 1796, 1803, 1808, 1815, 1823,
+    1829, 1835, 1841, 1848, 1854, 1861, 1868, 1874, 1880, 1886, 1893, 1899,
+    1905, 1912, 1918, 1924, 1930, 1936, 1941, 1949, 1956, 1962, 1969, 1975,
+    1983, 1989, 1995, 2002, 2009, 2016, 2024, 2031, 2038, 2044, 2050, 2059,
+    2066, 2071, 2077, 2084, 2092, 2097, 2104, 2108, 2116, 2123, 2129, 2137,
+    2143, 2149, 2155, 2161, 2166, 2173, 2181, 2188, 2194, 2202, 2209, 2216,
+    2224, 2231, 2237, 2243, 2251, 2257, 2262, 2268, 2277, 2284, 2291, 2299,
+    2304, 2312, 2320, 2327, 2333, 2341, 2347, 2355, 2361, 2367, 2372, 2378,
+    2385, 2391, 2398, 2406, 2412, 2419, 2425, 2430, 2438, 2444, 2450, 2456,
+    2465, 2472, 2480, 2488, 2495, 2502, 2508, 2514, 2521, 2526, 2533, 2541,
+    2549, 2555, 2562, 2570, 2578, 2586, 2592, 2599, 2605, 2612, 2618, 2625,
+    2631, 2639, 2646, 2654, 2660, 2666, 2671, 2678, 2684, 2692, 2697, 2703,
+    2708, 2714, 2722, 2728, 2736, 2742, 2747, 2754, 2761, 2766, 2772, 2778,
+    2784, 2792, 2798, 2807, 2813, 2822, 2830, 2837, 2842, 2850, 2855, 2861,
+    2867, 2874, 2881, 2886, 2891, 2898, 2906, 2913, 2920, 2927, 2933, 2941,
+    2949, 2955, 2962, 2970, 2977, 2983, 2990, 2996, 3004, 3012, 3019, 3024,
+    3030, 3039, 3047, 3054, 3062, 3069, 3076, 3082, 3089, 3095, 3103, 3111,
+    3117, 3124, 3132, 3138, 3144, 3151, 3158, 3165, 3171, 3180, 3189, 3195,
+    3200, 3207, 3214, 3221, 3226, 3233, 3241, 3248, 3255, 3262, 3269, 3275,
+    3282, 3290, 3296, 3302, 3309, 3317, 3322, 3329, 3335, 3342, 3350, 3356,
+    3364, 3370, 3376, 3382, 3387, 3393, 3397, 3403, 3410, 3416, 3423, 3431,
+    3437, 3442, 3450, 3458, 3464, 3472, 3480, 3487, 3494, 3500, 3507, 3515,
+    3523, 3531, 3540, 3546, 3554, 3562, 3570, 3578, 3586, 3594, 3600, 3605,
+    3612, 3620, 3629, 3635, 3642, 3649, 3656, 3663, 3669, 3674, 3683, 3689,
+    3696, 3703, 3710, 3718, 3726, 3732, 3740, 3748, 3753, 3760, 3766, 3771,
+    3777, 3785, 3789, 3795, 3802, 3809, 3815, 3819, 3825, 3833, 3839, 3845,
+    3850, 3856, 3863, 3869, 3874, 3880, 3886, 3893, 3898, 3905, 3911, 3917,
+    3921, 3929, 3934, 3943, 3952, 3959, 3966, 3973, 3980, 3984, 3992, 4001,
+    4008, 4017, 4024, 4031, 4038, 4045, 4052, 4059, 4066, 4073, 4082, 4089,
+    4097, 4104, 4112, 4118, 4126, 4134, 4141, 4149, 4155, 4162, 4170, 4178,
+    4185, 4192, 4199, 4206, 4213, 4222, 4229, 4236, 4243, 4250, 4257, 4264,
+    4270, 4277, 4284, 4292, 4301, 4308, 4316, 4323, 4332, 4339, 4346, 4353,
+    4360, 4367, 4374, 4380, 4385, 4392, 4399, 4405, 4412, 4419, 4425, 4432,
+    4440, 4447, 4454, 4461, 4468, 4475, 4482, 4489, 4496, 4503, 4511, 4518,
+    4526, 4535, 4543, 4551, 4560, 4568, 4576, 4583, 4590, 4596, 4601, 4607,
+    4613, 4619, 4626, 4631, 4639, 4646, 4654, 4663, 4669, 4675, 4680, 4687,
+    4693, 4699, 4703, 4711, 4717, 4723, 4727, 4733, 4739, 4747, 4754, 4762,
+    4769, 4776, 4781, 4787, 4796, 4802, 4808, 4815, 4820, 4826, 4833, 4840,
+    4846, 4851, 4856, 4863, 4870, 4877, 4881, 4887, 4894, 4901, 4907, 4913,
+    4920, 4927, 4932, 4938, 4944, 4950, 4957, 4963, 4968, 4975, 4982, 4988,
+    4996, 5002, 5008, 5014, 5022, 5029, 5034, 5039, 5047, 5055, 5062, 5068,
+    5075, 5082, 5088, 5094, 5100, 5106, 5112, 5118, 5125, 5132, 5137, 5143,
+    5152, 5158, 5166, 5172, 5178, 5186, 5193, 5200, 5206, 5212, 5217, 5222,
+    5231, 5237, 5243, 5249, 5256, 5262, 5268, 5275, 5281, 5290, 5297, 5302,
+    5311, 5318, 5324, 5328, 5336, 5342, 5348, 5356, 5364, 5371, 5377, 5385,
+    5394, 5400, 5405, 5413, 5419, 5426, 5430, 5436, 5443, 5449, 5454, 5460,
+    5467, 5473, 5478, 5484, 5490, 5496, 5505, 5511, 5517, 5524, 5530, 5537,
+    5544, 5550, 5555, 5561, 5568, 5574, 5581, 5587, 5593, 5600, 5606, 5614,
+    5621, 5627, 5634, 5640, 5646, 5655, 5662, 5669, 5675, 5682, 5689, 5695,
+    5701, 5706, 5713, 5720, 5727, 5731, 5739, 5747, 5753, 5759, 5766, 5772,
+    5779, 5785, 5793, 5800, 5807, 5813, 5820, 5828, 5836, 5841, 5847, 5856,
+    5863, 5869, 5877, 5882, 5889, 5895, 5901, 5907, 5912, 5920, 5926, 5933,
+    5938, 5944, 5951, 5958, 5964, 5970, 5976, 5981, 5988, 5996, 6004, 6009,
+    6016, 6025, 6031, 6037, 6043, 6050, 6057, 6065, 6071, 6077, 6084, 6093,
+    6100, 6106, 6113, 6119, 6127, 6135, 6143, 6151, 6159, 6166, 6173, 6181,
+    6189, 6196, 6204, 6211, 6218, 6226, 6235, 6244, 6252, 6259, 6267, 6276,
+    6280, 6285, 6293, 6298, 6305, 6313, 6320, 6327, 6334, 6342, 6348, 6354,
+    6362, 6367, 6375, 6382, 6390, 6397, 6403, 6408, 6415, 6422, 6427, 6435,
+    6440, 6448, 6455, 6461, 6468, 6474, 6481, 6490, 6496, 6502, 6510, 6517,
+    6522, 6528, 6534, 6540, 6546, 6551, 6559, 6567, 6576, 6583, 6589, 6595,
+    6603, 6612, 6617, 6624, 6633, 6639, 6646, 6652, 6658, 6667, 6672, 6679,
+    6685, 6692, 6698, 6703, 6708, 6717, 6723, 6730, 6735, 6743, 6752, 6759,
+    6766, 6772, 6778, 6784, 6793, 6801, 6807, 6813, 6818, 6826, 6835, 6841,
+    6847, 6854, 6861, 6868, 6873, 6880, 6885, 6893, 6900, 6907, 6913, 6919,
+    6926, 6934, 6939, 6948, 6957, 6962, 6968, 6975, 6981, 6987, 6993, 6999,
+    7006, 7012, 7019, 7026, 7033, 7040, 7047, 7054, 7059, 7067, 7072, 7079,
+    7087, 7093, 7101, 7106, 7112, 7117, 7123, 7129, 7135, 7140, 7145, 7151,
+    7156, 7163, 7168, 7172, 7179, 7185, 7192, 7198, 7205, 7213, 7219, 7225,
+    7230, 7236, 7243, 7250, 7256, 7261, 7267, 7273, 7279, 7285, 7291, 7299,
+    7305, 7314, 7321, 7326, 7332, 7338, 7346, 7351, 7360, 7364, 7370, 7376,
+    7383, 7390, 7397, 7405, 7413, 7420, 7426, 7431, 7440, 7447, 7453, 7461,
+    7467, 7474, 7482, 7488, 7496, 7502, 7510, 7516, 7524, 7532, 7538, 7545,
+    7552, 7560, 7566, 7574, 7580, 7586, 7594, 7603, 7611, 7615, 7622, 7627,
+    7633, 7641, 7647, 7654, 7660, 7665, 7673, 7678, 7682, 7690, 7698, 7706,
+    7711, 7716, 7723, 7731, 7738, 7744, 7750, 7755, 7763, 7769, 7775, 7781,
+    7786, 7794, 7802, 7807, 7814, 7819, 7825, 7831, 7837, 7844, 7852, 7858,
+    7866, 7873, 7879, 7885, 7891, 7898, 7905, 7912, 7918, 7924, 7930, 7937,
+    7943, 7951, 7958, 7964, 7971, 7976, 7982, 7988, 7995, 8001, 8008, 8016,
+    8022, 8028, 8033, 8040, 8046, 8052, 8060, 8066, 8071, 8080, 8086, 8092,
+    8100, 8106, 8113, 8121, 8127, 8133, 8141, 8147, 8154, 8160, 8166, 8173,
+    8181, 8189, 8195, 8200, 8208, 8214, 8222, 8228, 8236, 8242, 8248, 8255,
+    8260, 8267, 8273, 8280, 8286, 8291, 8298, 8304, 8311, 8317, 8325, 8331,
+    8339, 8345, 8353, 8359, 8365, 8371, 8376, 8384, 8391, 8398, 8404, 8409,
+    8414, 8422, 8430, 8435, 8441, 8447, 8452, 8457, 8465, 8472, 8478, 8484,
+    8491, 8498, 8503, 8510, 8519, 8527, 8533, 8537, 8543, 8551, 8559, 8564,
+    8569, 8574, 8581, 8589, 8596, 8603, 8611, 8617, 8622, 8629, 8635, 8642,
+    8649, 8656, 8664, 8669, 8675, 8680, 8684, 8688, 8695, 8702, 8708, 8713,
+    8718, 8723, 8730, 8738, 8743, 8748, 8754, 8762, 8769, 8776, 8783, 8789,
+    8797, 8805, 8814, 8821, 8826, 8834, 8839, 8845, 8851, 8859, 8866, 8874,
+    8882, 8889, 8896, 8900, 8909, 8915, 8923, 8930, 8937, 8941, 8947, 8954,
+    8959, 8965, 8972, 8979, 8988, 8995, 9001, 9007, 9013, 9020, 9028, 9033,
+    9039, 9047, 9055, 9061, 9068, 9076, 9082, 9089, 9096, 9100, 9106, 9114,
+    9122, 9131, 9137, 9143, 9151, 9159, 9165, 9173, 9179, 9185, 9190, 9199,
+    9206, 9215, 9221, 9227, 9233, 9241, 9246, 9252, 9257, 9263, 9270, 9276,
+    9282, 9287, 9294, 9302, 9309, 9316, 9322, 9328, 9334, 9340, 9346, 9352,
+    9361, 9367, 9375, 9383, 9388, 9395, 9400, 9407, 9415, 9421, 9426, 9433,
+    9442, 9447, 9454, 9461, 9468, 9475, 9482, 9488, 9496, 9502, 9510, 9515,
+    9521, 9529, 9538, 9546, 9556, 9560, 9568, 9574, 9582, 9586, 9593, 9600,
+    9606, 9613, 9619, 9626, 9635, 9640, 9647, 9653, 9659, 9665, 9670, 9677,
+    9683, 9691, 9696, 9702, 9709, 9715, 9721, 9726, 9732, 9738, 9744, 9751,
+    9757, 9763, 9769, 9776, 9782, 9787, 9793, 9799, 9805, 9813, 9819, 9825,
+    9834, 9840, 9846, 9853, 9860, 9865, 9871, 9877, 9886, 9893, 9900, 9907,
+    9915, 9921, 9930, 9936, 9941, 9947, 9954, 9963, 9970, 9977, 9983, 9990,
+    9996, 10006, 10015, 10022, 10027, 10034, 10042, 10051, 10058, 10067, 10076,
+    10082, 10090, 10097, 10104, 10113, 10120, 10129, 10137, 10143, 10150,
+    10157, 10164, 10170, 10176, 10184, 10190, 10196, 10201, 10207, 10214,
+    10220, 10225, 10232, 10238, 10245, 10251, 10258, 10265, 10271, 10278,
+    10287, 10294, 10301, 10309, 10315, 10320, 10328, 10336, 10342, 10347,
+    10353, 10360, 10366, 10372, 10380, 10386, 10392, 10398, 10403, 10408,
+    10413, 10420, 10430, 10439, 10447, 10454, 10461, 10468, 10476, 10484,
+    10491, 10497, 10505, 10509, 10517, 10525, 10533, 10541, 10549, 10557,
+    10564, 10570, 10576, 10584, 10591, 10597, 10603, 10608, 10615, 10622,
+    10630, 10638, 10644, 10650, 10658, 10663, 10670, 10677, 10683, 10691,
+    10699, 10706, 10713, 10717, 10725, 10732, 10740, 10746, 10754, 10761,
+    10769, 10777, 10784, 10791, 10799, 10803, 10809, 10814, 10820, 10827,
+    10834, 10839, 10847, 10853, 10861, 10869, 10874, 10882, 10887, 10893,
+    10898, 10903, 10909, 10914, 10921, 10927, 10933, 10941, 10946, 10953,
+    10958, 10965, 10972, 10976, 10982, 10988, 10993, 11000, 11005, 11011,
+    11018, 11024, 11030, 11036, 11041, 11047, 11053, 11059, 11065, 11072,
+    11077, 11083, 11089, 11097, 11102, 11109, 11117, 11123, 11129, 11135,
+    11141, 11147, 11155, 11160, 11166, 11173, 11179, 11187, 11194, 11200,
+    11206, 11212, 11219, 11225, 11234, 11242, 11249, 11256, 11264, 11269,
+    11275, 11280, 11286, 11294, 11302, 11309, 11316, 11322, 11331, 11340,
+    11345, 11353, 11359, 11363, 11370, 11375, 11381, 11387, 11394, 11402,
+    11408, 11415, 11422, 11429, 11437, 11443, 11451, 11455, 11461, 11469,
+    11476, 11484, 11492, 11497, 11505, 11512, 11517, 11523, 11529, 11536,
+    11542, 11548, 11554, 11562, 11569, 11578, 11584, 11593, 11599, 11606,
+    11614, 11620, 11627, 11633, 11639, 11645, 11649, 11656, 11664, 11672,
+    11680, 11687, 11697, 11704, 11711, 11718, 11725, 11733, 11738, 11745,
+    11753, 11759, 11768, 11775, 11783, 11791, 11797, 11803, 11810, 11816,
+    11823, 11829, 11836, 11843, 11850, 11857, 11865, 11871, 11879, 11886,
+    11894, 11902, 11906, 11912, 11920, 11927, 11933, 11939, 11946, 11954,
+    11960, 11966, 11971, 11977, 11982, 11988, 11994, 12002, 12008, 12015,
+    12023, 12030, 12036, 12043, 12048, 12055, 12061, 12068, 12077, 12083,
+    12089, 12096, 12104, 12110, 12116, 12122, 12130, 12136, 12141, 12148,
+    12155, 12161, 12167, 12176, 12183, 12189, 12196, 12201, 12211, 12216,
+    12222, 12229, 12235, 12242, 12248, 12254, 12260, 12268, 12276, 12282,
+    12291, 12299, 12306, 12312, 12319, 12327, 12334, 12340, 12344, 12350,
+    12359, 12366, 12373, 12380, 12386, 12392, 12399, 12405, 12412, 12420,
+    12425, 12431, 12436, 12444, 12449, 12454, 12461, 12468, 12476, 12484,
+    12489, 12496, 12504, 12510, 12517, 12522, 12527, 12533, 12539, 12544,
+    12550, 12556, 12561, 12567, 12574, 12581, 12590, 12597, 12602, 12610,
+    12616, 12622, 12630, 12634, 12640, 12646, 12654, 12662, 12670, 12676,
+    12685, 12691, 12697, 12703, 12710, 12716, 12723, 12730, 12738, 12745,
+    12753, 12758, 12765, 12770, 12776, 12782, 12788, 12795, 12803, 12810,
+    12817, 12824, 12830, 12836, 12842, 12848, 12855, 12861, 12870, 12875,
+    12882, 12888, 12894, 12901, 12909, 12917, 12925, 12931, 12937, 12944,
+    12952, 12959, 12966, 12971, 12980, 12984, 12990, 12995, 13002, 13007,
+    13015, 13020, 13025, 13033, 13039, 13047, 13051, 13056, 13063, 13070,
+    13076, 13081, 13087, 13095, 13100, 13108, 13114, 13120, 13129, 13137,
+    13142, 13149, 13156, 13161, 13168, 13175, 13185, 13192, 13198, 13203,
+    13210, 13216, 13221, 13228, 13234, 13241, 13248, 13254, 13260, 13266,
+    13270, 13277, 13283, 13289, 13296, 13302, 13308, 13315, 13320, 13326,
+    13333, 13339, 13348, 13353, 13360, 13367, 13373, 13381, 13387, 13391,
+    13397, 13405, 13410, 13418, 13426, 13432, 13438, 13445, 13451, 13460,
+    13466, 13475, 13481, 13487, 13494, 13500, 13505, 13513, 13521, 13528,
+    13534, 13540, 13545, 13549, 13555, 13562, 13568, 13573, 13579, 13584,
+    13590, 13595, 13600, 13605, 13611, 13618, 13624, 13631, 13637, 13642,
+    13648, 13653
 };
 
-const dictionary ja =
+const dictionary es{ es_words, es_offsets };
+
+static const char ja_words[] =
+    "あいこくしん\0"
+    "あいさつ\0"
+    "あいだ\0"
+    "あおぞら\0"
+    "あかちゃん\0"
+    "あきる\0"
+    "あけがた\0"
+    "あける\0"
+    "あこがれる\0"
+    "あさい\0"
+    "あさひ\0"
+    "あしあと\0"
+    "あじわう\0"
+    "あずかる\0"
+    "あずき\0"
+    "あそぶ\0"
+    "あたえる\0"
+    "あたためる\0"
+    "あたりまえ\0"
+    "あたる\0"
+    "あつい\0"
+    "あつかう\0"
+    "あっしゅく\0"
+    "あつまり\0"
+    "あつめる\0"
+    "あてな\0"
+    "あてはまる\0"
+    "あひる\0"
+    "あぶら\0"
+    "あぶる\0"
+    "あふれる\0"
+    "あまい\0"
+    "あまど\0"
+    "あまやかす\0"
+    "あまり\0"
+    "あみもの\0"
+    "あめりか\0"
+    "あやまる\0"
+    "あゆむ\0"
+    "あらいぐま\0"
+    "あらし\0"
+    "あらすじ\0"
+    "あらためる\0"
+    "あらゆる\0"
+    "あらわす\0"
+    "ありがとう\0"
+    "あわせる\0"
+    "あわてる\0"
+    "あんい\0"
+    "あんがい\0"
+    "あんこ\0"
+    "あんぜん\0"
+    "あんてい\0"
+    "あんない\0"
+    "あんまり\0"
+    "いいだす\0"
+    "いおん\0"
+    "いがい\0"
+    "いがく\0"
+    "いきおい\0"
+    "いきなり\0"
+    "いきもの\0"
+    "いきる\0"
+    "いくじ\0"
+    "いくぶん\0"
+    "いけばな\0"
+    "いけん\0"
+    "いこう\0"
+    "いこく\0"
+    "いこつ\0"
+    "いさましい\0"
+    "いさん\0"
+    "いしき\0"
+    "いじゅう\0"
+    "いじょう\0"
+    "いじわる\0"
+    "いずみ\0"
+    "いずれ\0"
+    "いせい\0"
+    "いせえび\0"
+    "いせかい\0"
+    "いせき\0"
+    "いぜん\0"
+    "いそうろう\0"
+    "いそがしい\0"
+    "いだい\0"
+    "いだく\0"
+    "いたずら\0"
+    "いたみ\0"
+    "いたりあ\0"
+    "いちおう\0"
+    "いちじ\0"
+    "いちど\0"
+    "いちば\0"
+    "いちぶ\0"
+    "いちりゅう\0"
+    "いつか\0"
+    "いっしゅん\0"
+    "いっせい\0"
+    "いっそう\0"
+    "いったん\0"
+    "いっち\0"
+    "いってい\0"
+    "いっぽう\0"
+    "いてざ\0"
+    "いてん\0"
+    "いどう\0"
+    "いとこ\0"
+    "いない\0"
+    "いなか\0"
+    "いねむり\0"
+    "いのち\0"
+    "いのる\0"
+    "いはつ\0"
+    "いばる\0"
+    "いはん\0"
+    "いびき\0"
+    "いひん\0"
+    "いふく\0"
+    "いへん\0"
+    "いほう\0"
+    "いみん\0"
+    "いもうと\0"
+    "いもたれ\0"
+    "いもり\0"
+    "いやがる\0"
+    "いやす\0"
+    "いよかん\0"
+    "いよく\0"
+    "いらい\0"
+    "いらすと\0"
+    "いりぐち\0"
+    "いりょう\0"
+    "いれい\0"
+    "いれもの\0"
+    "いれる\0"
+    "いろえんぴつ\0"
+    "いわい\0"
+    "いわう\0"
+    "いわかん\0"
+    "いわば\0"
+    "いわゆる\0"
+    "いんげんまめ\0"
+    "いんさつ\0"
+    "いんしょう\0"
+    "いんよう\0"
+    "うえき\0"
+    "うえる\0"
+    "うおざ\0"
+    "うがい\0"
+    "うかぶ\0"
+    "うかべる\0"
+    "うきわ\0"
+    "うくらいな\0"
+    "うくれれ\0"
+    "うけたまわる\0"
+    "うけつけ\0"
+    "うけとる\0"
+    "うけもつ\0"
+    "うける\0"
+    "うごかす\0"
+    "うごく\0"
+    "うこん\0"
+    "うさぎ\0"
+    "うしなう\0"
+    "うしろがみ\0"
+    "うすい\0"
+    "うすぎ\0"
+    "うすぐらい\0"
+    "うすめる\0"
+    "うせつ\0"
+    "うちあわせ\0"
+    "うちがわ\0"
+    "うちき\0"
+    "うちゅう\0"
+    "うっかり\0"
+    "うつくしい\0"
+    "うったえる\0"
+    "うつる\0"
+    "うどん\0"
+    "うなぎ\0"
+    "うなじ\0"
+    "うなずく\0"
+    "うなる\0"
+    "うねる\0"
+    "うのう\0"
+    "うぶげ\0"
+    "うぶごえ\0"
+    "うまれる\0"
+    "うめる\0"
+    "うもう\0"
+    "うやまう\0"
+    "うよく\0"
+    "うらがえす\0"
+    "うらぐち\0"
+    "うらない\0"
+    "うりあげ\0"
+    "うりきれ\0"
+    "うるさい\0"
+    "うれしい\0"
+    "うれゆき\0"
+    "うれる\0"
+    "うろこ\0"
+    "うわき\0"
+    "うわさ\0"
+    "うんこう\0"
+    "うんちん\0"
+    "うんてん\0"
+    "うんどう\0"
+    "えいえん\0"
+    "えいが\0"
+    "えいきょう\0"
+    "えいご\0"
+    "えいせい\0"
+    "えいぶん\0"
+    "えいよう\0"
+    "えいわ\0"
+    "えおり\0"
+    "えがお\0"
+    "えがく\0"
+    "えきたい\0"
+    "えくせる\0"
+    "えしゃく\0"
+    "えすて\0"
+    "えつらん\0"
+    "えのぐ\0"
+    "えほうまき\0"
+    "えほん\0"
+    "えまき\0"
+    "えもじ\0"
+    "えもの\0"
+    "えらい\0"
+    "えらぶ\0"
+    "えりあ\0"
+    "えんえん\0"
+    "えんかい\0"
+    "えんぎ\0"
+    "えんげき\0"
+    "えんしゅう\0"
+    "えんぜつ\0"
+    "えんそく\0"
+    "えんちょう\0"
+    "えんとつ\0"
+    "おいかける\0"
+    "おいこす\0"
+    "おいしい\0"
+    "おいつく\0"
+    "おうえん\0"
+    "おうさま\0"
+    "おうじ\0"
+    "おうせつ\0"
+    "おうたい\0"
+    "おうふく\0"
+    "おうべい\0"
+    "おうよう\0"
+    "おえる\0"
+    "おおい\0"
+    "おおう\0"
+    "おおどおり\0"
+    "おおや\0"
+    "おおよそ\0"
+    "おかえり\0"
+    "おかず\0"
+    "おがむ\0"
+    "おかわり\0"
+    "おぎなう\0"
+    "おきる\0"
+    "おくさま\0"
+    "おくじょう\0"
+    "おくりがな\0"
+    "おくる\0"
+    "おくれる\0"
+    "おこす\0"
+    "おこなう\0"
+    "おこる\0"
+    "おさえる\0"
+    "おさない\0"
+    "おさめる\0"
+    "おしいれ\0"
+    "おしえる\0"
+    "おじぎ\0"
+    "おじさん\0"
+    "おしゃれ\0"
+    "おそらく\0"
+    "おそわる\0"
+    "おたがい\0"
+    "おたく\0"
+    "おだやか\0"
+    "おちつく\0"
+    "おっと\0"
+    "おつり\0"
+    "おでかけ\0"
+    "おとしもの\0"
+    "おとなしい\0"
+    "おどり\0"
+    "おどろかす\0"
+    "おばさん\0"
+    "おまいり\0"
+    "おめでとう\0"
+    "おもいで\0"
+    "おもう\0"
+    "おもたい\0"
+    "おもちゃ\0"
+    "おやつ\0"
+    "おやゆび\0"
+    "およぼす\0"
+    "おらんだ\0"
+    "おろす\0"
+    "おんがく\0"
+    "おんけい\0"
+    "おんしゃ\0"
+    "おんせん\0"
+    "おんだん\0"
+    "おんちゅう\0"
+    "おんどけい\0"
+    "かあつ\0"
+    "かいが\0"
+    "がいき\0"
+    "がいけん\0"
+    "がいこう\0"
+    "かいさつ\0"
+    "かいしゃ\0"
+    "かいすいよく\0"
+    "かいぜん\0"
+    "かいぞうど\0"
+    "かいつう\0"
+    "かいてん\0"
+    "かいとう\0"
+    "かいふく\0"
+    "がいへき\0"
+    "かいほう\0"
+    "かいよう\0"
+    "がいらい\0"
+    "かいわ\0"
+    "かえる\0"
+    "かおり\0"
+    "かかえる\0"
+    "かがく\0"
+    "かがし\0"
+    "かがみ\0"
+    "かくご\0"
+    "かくとく\0"
+    "かざる\0"
+    "がぞう\0"
+    "かたい\0"
+    "かたち\0"
+    "がちょう\0"
+    "がっきゅう\0"
+    "がっこう\0"
+    "がっさん\0"
+    "がっしょう\0"
+    "かなざわし\0"
+    "かのう\0"
+    "がはく\0"
+    "かぶか\0"
+    "かほう\0"
+    "かほご\0"
+    "かまう\0"
+    "かまぼこ\0"
+    "かめれおん\0"
+    "かゆい\0"
+    "かようび\0"
+    "からい\0"
+    "かるい\0"
+    "かろう\0"
+    "かわく\0"
+    "かわら\0"
+    "がんか\0"
+    "かんけい\0"
+    "かんこう\0"
+    "かんしゃ\0"
+    "かんそう\0"
+    "かんたん\0"
+    "かんち\0"
+    "がんばる\0"
+    "きあい\0"
+    "きあつ\0"
+    "きいろ\0"
+    "ぎいん\0"
+    "きうい\0"
+    "きうん\0"
+    "きえる\0"
+    "きおう\0"
+    "きおく\0"
+    "きおち\0"
+    "きおん\0"
+    "きかい\0"
+    "きかく\0"
+    "きかんしゃ\0"
+    "ききて\0"
+    "きくばり\0"
+    "きくらげ\0"
+    "きけんせい\0"
+    "きこう\0"
+    "きこえる\0"
+    "きこく\0"
+    "きさい\0"
+    "きさく\0"
+    "きさま\0"
+    "きさらぎ\0"
+    "ぎじかがく\0"
+    "ぎしき\0"
+    "ぎじたいけん\0"
+    "ぎじにってい\0"
+    "ぎじゅつしゃ\0"
+    "きすう\0"
+    "きせい\0"
+    "きせき\0"
+    "きせつ\0"
+    "きそう\0"
+    "きぞく\0"
+    "きぞん\0"
+    "きたえる\0"
+    "きちょう\0"
+    "きつえん\0"
+    "ぎっちり\0"
+    "きつつき\0"
+    "きつね\0"
+    "きてい\0"
+    "きどう\0"
+    "きどく\0"
+    "きない\0"
+    "きなが\0"
+    "きなこ\0"
+    "きぬごし\0"
+    "きねん\0"
+    "きのう\0"
+    "きのした\0"
+    "きはく\0"
+    "きびしい\0"
+    "きひん\0"
+    "きふく\0"
+    "きぶん\0"
+    "きぼう\0"
+    "きほん\0"
+    "きまる\0"
+    "きみつ\0"
+    "きむずかしい\0"
+    "きめる\0"
+    "きもだめし\0"
+    "きもち\0"
+    "きもの\0"
+    "きゃく\0"
+    "きやく\0"
+    "ぎゅうにく\0"
+    "きよう\0"
+    "きょうりゅう\0"
+    "きらい\0"
+    "きらく\0"
+    "きりん\0"
+    "きれい\0"
+    "きれつ\0"
+    "きろく\0"
+    "ぎろん\0"
+    "きわめる\0"
+    "ぎんいろ\0"
+    "きんかくじ\0"
+    "きんじょ\0"
+    "きんようび\0"
+    "ぐあい\0"
+    "くいず\0"
+    "くうかん\0"
+    "くうき\0"
+    "くうぐん\0"
+    "くうこう\0"
+    "ぐうせい\0"
+    "くうそう\0"
+    "ぐうたら\0"
+    "くうふく\0"
+    "くうぼ\0"
+    "くかん\0"
+    "くきょう\0"
+    "くげん\0"
+    "ぐこう\0"
+    "くさい\0"
+    "くさき\0"
+    "くさばな\0"
+    "くさる\0"
+    "くしゃみ\0"
+    "くしょう\0"
+    "くすのき\0"
+    "くすりゆび\0"
+    "くせげ\0"
+    "くせん\0"
+    "ぐたいてき\0"
+    "くださる\0"
+    "くたびれる\0"
+    "くちこみ\0"
+    "くちさき\0"
+    "くつした\0"
+    "ぐっすり\0"
+    "くつろぐ\0"
+    "くとうてん\0"
+    "くどく\0"
+    "くなん\0"
+    "くねくね\0"
+    "くのう\0"
+    "くふう\0"
+    "くみあわせ\0"
+    "くみたてる\0"
+    "くめる\0"
+    "くやくしょ\0"
+    "くらす\0"
+    "くらべる\0"
+    "くるま\0"
+    "くれる\0"
+    "くろう\0"
+    "くわしい\0"
+    "ぐんかん\0"
+    "ぐんしょく\0"
+    "ぐんたい\0"
+    "ぐんて\0"
+    "けあな\0"
+    "けいかく\0"
+    "けいけん\0"
+    "けいこ\0"
+    "けいさつ\0"
+    "げいじゅつ\0"
+    "けいたい\0"
+    "げいのうじん\0"
+    "けいれき\0"
+    "けいろ\0"
+    "けおとす\0"
+    "けおりもの\0"
+    "げきか\0"
+    "げきげん\0"
+    "げきだん\0"
+    "げきちん\0"
+    "げきとつ\0"
+    "げきは\0"
+    "げきやく\0"
+    "げこう\0"
+    "げこくじょう\0"
+    "げざい\0"
+    "けさき\0"
+    "げざん\0"
+    "けしき\0"
+    "けしごむ\0"
+    "けしょう\0"
+    "げすと\0"
+    "けたば\0"
+    "けちゃっぷ\0"
+    "けちらす\0"
+    "けつあつ\0"
+    "けつい\0"
+    "けつえき\0"
+    "けっこん\0"
+    "けつじょ\0"
+    "けっせき\0"
+    "けってい\0"
+    "けつまつ\0"
+    "げつようび\0"
+    "げつれい\0"
+    "けつろん\0"
+    "げどく\0"
+    "けとばす\0"
+    "けとる\0"
+    "けなげ\0"
+    "けなす\0"
+    "けなみ\0"
+    "けぬき\0"
+    "げねつ\0"
+    "けねん\0"
+    "けはい\0"
+    "げひん\0"
+    "けぶかい\0"
+    "げぼく\0"
+    "けまり\0"
+    "けみかる\0"
+    "けむし\0"
+    "けむり\0"
+    "けもの\0"
+    "けらい\0"
+    "けろけろ\0"
+    "けわしい\0"
+    "けんい\0"
+    "けんえつ\0"
+    "けんお\0"
+    "けんか\0"
+    "げんき\0"
+    "けんげん\0"
+    "けんこう\0"
+    "けんさく\0"
+    "けんしゅう\0"
+    "けんすう\0"
+    "げんそう\0"
+    "けんちく\0"
+    "けんてい\0"
+    "けんとう\0"
+    "けんない\0"
+    "けんにん\0"
+    "げんぶつ\0"
+    "けんま\0"
+    "けんみん\0"
+    "けんめい\0"
+    "けんらん\0"
+    "けんり\0"
+    "こあくま\0"
+    "こいぬ\0"
+    "こいびと\0"
+    "ごうい\0"
+    "こうえん\0"
+    "こうおん\0"
+    "こうかん\0"
+    "ごうきゅう\0"
+    "ごうけい\0"
+    "こうこう\0"
+    "こうさい\0"
+    "こうじ\0"
+    "こうすい\0"
+    "ごうせい\0"
+    "こうそく\0"
+    "こうたい\0"
+    "こうちゃ\0"
+    "こうつう\0"
+    "こうてい\0"
+    "こうどう\0"
+    "こうない\0"
+    "こうはい\0"
+    "ごうほう\0"
+    "ごうまん\0"
+    "こうもく\0"
+    "こうりつ\0"
+    "こえる\0"
+    "こおり\0"
+    "ごかい\0"
+    "ごがつ\0"
+    "ごかん\0"
+    "こくご\0"
+    "こくさい\0"
+    "こくとう\0"
+    "こくない\0"
+    "こくはく\0"
+    "こぐま\0"
+    "こけい\0"
+    "こける\0"
+    "ここのか\0"
+    "こころ\0"
+    "こさめ\0"
+    "こしつ\0"
+    "こすう\0"
+    "こせい\0"
+    "こせき\0"
+    "こぜん\0"
+    "こそだて\0"
+    "こたい\0"
+    "こたえる\0"
+    "こたつ\0"
+    "こちょう\0"
+    "こっか\0"
+    "こつこつ\0"
+    "こつばん\0"
+    "こつぶ\0"
+    "こてい\0"
+    "こてん\0"
+    "ことがら\0"
+    "ことし\0"
+    "ことば\0"
+    "ことり\0"
+    "こなごな\0"
+    "こねこね\0"
+    "このまま\0"
+    "このみ\0"
+    "このよ\0"
+    "ごはん\0"
+    "こひつじ\0"
+    "こふう\0"
+    "こふん\0"
+    "こぼれる\0"
+    "ごまあぶら\0"
+    "こまかい\0"
+    "ごますり\0"
+    "こまつな\0"
+    "こまる\0"
+    "こむぎこ\0"
+    "こもじ\0"
+    "こもち\0"
+    "こもの\0"
+    "こもん\0"
+    "こやく\0"
+    "こやま\0"
+    "こゆう\0"
+    "こゆび\0"
+    "こよい\0"
+    "こよう\0"
+    "こりる\0"
+    "これくしょん\0"
+    "ころっけ\0"
+    "こわもて\0"
+    "こわれる\0"
+    "こんいん\0"
+    "こんかい\0"
+    "こんき\0"
+    "こんしゅう\0"
+    "こんすい\0"
+    "こんだて\0"
+    "こんとん\0"
+    "こんなん\0"
+    "こんびに\0"
+    "こんぽん\0"
+    "こんまけ\0"
+    "こんや\0"
+    "こんれい\0"
+    "こんわく\0"
+    "ざいえき\0"
+    "さいかい\0"
+    "さいきん\0"
+    "ざいげん\0"
+    "ざいこ\0"
+    "さいしょ\0"
+    "さいせい\0"
+    "ざいたく\0"
+    "ざいちゅう\0"
+    "さいてき\0"
+    "ざいりょう\0"
+    "さうな\0"
+    "さかいし\0"
+    "さがす\0"
+    "さかな\0"
+    "さかみち\0"
+    "さがる\0"
+    "さぎょう\0"
+    "さくし\0"
+    "さくひん\0"
+    "さくら\0"
+    "さこく\0"
+    "さこつ\0"
+    "さずかる\0"
+    "ざせき\0"
+    "さたん\0"
+    "さつえい\0"
+    "ざつおん\0"
+    "ざっか\0"
+    "ざつがく\0"
+    "さっきょく\0"
+    "ざっし\0"
+    "さつじん\0"
+    "ざっそう\0"
+    "さつたば\0"
+    "さつまいも\0"
+    "さてい\0"
+    "さといも\0"
+    "さとう\0"
+    "さとおや\0"
+    "さとし\0"
+    "さとる\0"
+    "さのう\0"
+    "さばく\0"
+    "さびしい\0"
+    "さべつ\0"
+    "さほう\0"
+    "さほど\0"
+    "さます\0"
+    "さみしい\0"
+    "さみだれ\0"
+    "さむけ\0"
+    "さめる\0"
+    "さやえんどう\0"
+    "さゆう\0"
+    "さよう\0"
+    "さよく\0"
+    "さらだ\0"
+    "ざるそば\0"
+    "さわやか\0"
+    "さわる\0"
+    "さんいん\0"
+    "さんか\0"
+    "さんきゃく\0"
+    "さんこう\0"
+    "さんさい\0"
+    "ざんしょ\0"
+    "さんすう\0"
+    "さんせい\0"
+    "さんそ\0"
+    "さんち\0"
+    "さんま\0"
+    "さんみ\0"
+    "さんらん\0"
+    "しあい\0"
+    "しあげ\0"
+    "しあさって\0"
+    "しあわせ\0"
+    "しいく\0"
+    "しいん\0"
+    "しうち\0"
+    "しえい\0"
+    "しおけ\0"
+    "しかい\0"
+    "しかく\0"
+    "じかん\0"
+    "しごと\0"
+    "しすう\0"
+    "じだい\0"
+    "したうけ\0"
+    "したぎ\0"
+    "したて\0"
+    "したみ\0"
+    "しちょう\0"
+    "しちりん\0"
+    "しっかり\0"
+    "しつじ\0"
+    "しつもん\0"
+    "してい\0"
+    "してき\0"
+    "してつ\0"
+    "じてん\0"
+    "じどう\0"
+    "しなぎれ\0"
+    "しなもの\0"
+    "しなん\0"
+    "しねま\0"
+    "しねん\0"
+    "しのぐ\0"
+    "しのぶ\0"
+    "しはい\0"
+    "しばかり\0"
+    "しはつ\0"
+    "しはらい\0"
+    "しはん\0"
+    "しひょう\0"
+    "しふく\0"
+    "じぶん\0"
+    "しへい\0"
+    "しほう\0"
+    "しほん\0"
+    "しまう\0"
+    "しまる\0"
+    "しみん\0"
+    "しむける\0"
+    "じむしょ\0"
+    "しめい\0"
+    "しめる\0"
+    "しもん\0"
+    "しゃいん\0"
+    "しゃうん\0"
+    "しゃおん\0"
+    "じゃがいも\0"
+    "しやくしょ\0"
+    "しゃくほう\0"
+    "しゃけん\0"
+    "しゃこ\0"
+    "しゃざい\0"
+    "しゃしん\0"
+    "しゃせん\0"
+    "しゃそう\0"
+    "しゃたい\0"
+    "しゃちょう\0"
+    "しゃっきん\0"
+    "じゃま\0"
+    "しゃりん\0"
+    "しゃれい\0"
+    "じゆう\0"
+    "じゅうしょ\0"
+    "しゅくはく\0"
+    "じゅしん\0"
+    "しゅっせき\0"
+    "しゅみ\0"
+    "しゅらば\0"
+    "じゅんばん\0"
+    "しょうかい\0"
+    "しょくたく\0"
+    "しょっけん\0"
+    "しょどう\0"
+    "しょもつ\0"
+    "しらせる\0"
+    "しらべる\0"
+    "しんか\0"
+    "しんこう\0"
+    "じんじゃ\0"
+    "しんせいじ\0"
+    "しんちく\0"
+    "しんりん\0"
+    "すあげ\0"
+    "すあし\0"
+    "すあな\0"
+    "ずあん\0"
+    "すいえい\0"
+    "すいか\0"
+    "すいとう\0"
+    "ずいぶん\0"
+    "すいようび\0"
+    "すうがく\0"
+    "すうじつ\0"
+    "すうせん\0"
+    "すおどり\0"
+    "すきま\0"
+    "すくう\0"
+    "すくない\0"
+    "すける\0"
+    "すごい\0"
+    "すこし\0"
+    "ずさん\0"
+    "すずしい\0"
+    "すすむ\0"
+    "すすめる\0"
+    "すっかり\0"
+    "ずっしり\0"
+    "ずっと\0"
+    "すてき\0"
+    "すてる\0"
+    "すねる\0"
+    "すのこ\0"
+    "すはだ\0"
+    "すばらしい\0"
+    "ずひょう\0"
+    "ずぶぬれ\0"
+    "すぶり\0"
+    "すふれ\0"
+    "すべて\0"
+    "すべる\0"
+    "ずほう\0"
+    "すぼん\0"
+    "すまい\0"
+    "すめし\0"
+    "すもう\0"
+    "すやき\0"
+    "すらすら\0"
+    "するめ\0"
+    "すれちがう\0"
+    "すろっと\0"
+    "すわる\0"
+    "すんぜん\0"
+    "すんぽう\0"
+    "せあぶら\0"
+    "せいかつ\0"
+    "せいげん\0"
+    "せいじ\0"
+    "せいよう\0"
+    "せおう\0"
+    "せかいかん\0"
+    "せきにん\0"
+    "せきむ\0"
+    "せきゆ\0"
+    "せきらんうん\0"
+    "せけん\0"
+    "せこう\0"
+    "せすじ\0"
+    "せたい\0"
+    "せたけ\0"
+    "せっかく\0"
+    "せっきゃく\0"
+    "ぜっく\0"
+    "せっけん\0"
+    "せっこつ\0"
+    "せっさたくま\0"
+    "せつぞく\0"
+    "せつだん\0"
+    "せつでん\0"
+    "せっぱん\0"
+    "せつび\0"
+    "せつぶん\0"
+    "せつめい\0"
+    "せつりつ\0"
+    "せなか\0"
+    "せのび\0"
+    "せはば\0"
+    "せびろ\0"
+    "せぼね\0"
+    "せまい\0"
+    "せまる\0"
+    "せめる\0"
+    "せもたれ\0"
+    "せりふ\0"
+    "ぜんあく\0"
+    "せんい\0"
+    "せんえい\0"
+    "せんか\0"
+    "せんきょ\0"
+    "せんく\0"
+    "せんげん\0"
+    "ぜんご\0"
+    "せんさい\0"
+    "せんしゅ\0"
+    "せんすい\0"
+    "せんせい\0"
+    "せんぞ\0"
+    "せんたく\0"
+    "せんちょう\0"
+    "せんてい\0"
+    "せんとう\0"
+    "せんぬき\0"
+    "せんねん\0"
+    "せんぱい\0"
+    "ぜんぶ\0"
+    "ぜんぽう\0"
+    "せんむ\0"
+    "せんめんじょ\0"
+    "せんもん\0"
+    "せんやく\0"
+    "せんゆう\0"
+    "せんよう\0"
+    "ぜんら\0"
+    "ぜんりゃく\0"
+    "せんれい\0"
+    "せんろ\0"
+    "そあく\0"
+    "そいとげる\0"
+    "そいね\0"
+    "そうがんきょう\0"
+    "そうき\0"
+    "そうご\0"
+    "そうしん\0"
+    "そうだん\0"
+    "そうなん\0"
+    "そうび\0"
+    "そうめん\0"
+    "そうり\0"
+    "そえもの\0"
+    "そえん\0"
+    "そがい\0"
+    "そげき\0"
+    "そこう\0"
+    "そこそこ\0"
+    "そざい\0"
+    "そしな\0"
+    "そせい\0"
+    "そせん\0"
+    "そそぐ\0"
+    "そだてる\0"
+    "そつう\0"
+    "そつえん\0"
+    "そっかん\0"
+    "そつぎょう\0"
+    "そっけつ\0"
+    "そっこう\0"
+    "そっせん\0"
+    "そっと\0"
+    "そとがわ\0"
+    "そとづら\0"
+    "そなえる\0"
+    "そなた\0"
+    "そふぼ\0"
+    "そぼく\0"
+    "そぼろ\0"
+    "そまつ\0"
+    "そまる\0"
+    "そむく\0"
+    "そむりえ\0"
+    "そめる\0"
+    "そもそも\0"
+    "そよかぜ\0"
+    "そらまめ\0"
+    "そろう\0"
+    "そんかい\0"
+    "そんけい\0"
+    "そんざい\0"
+    "そんしつ\0"
+    "そんぞく\0"
+    "そんちょう\0"
+    "ぞんび\0"
+    "ぞんぶん\0"
+    "そんみん\0"
+    "たあい\0"
+    "たいいん\0"
+    "たいうん\0"
+    "たいえき\0"
+    "たいおう\0"
+    "だいがく\0"
+    "たいき\0"
+    "たいぐう\0"
+    "たいけん\0"
+    "たいこ\0"
+    "たいざい\0"
+    "だいじょうぶ\0"
+    "だいすき\0"
+    "たいせつ\0"
+    "たいそう\0"
+    "だいたい\0"
+    "たいちょう\0"
+    "たいてい\0"
+    "だいどころ\0"
+    "たいない\0"
+    "たいねつ\0"
+    "たいのう\0"
+    "たいはん\0"
+    "だいひょう\0"
+    "たいふう\0"
+    "たいへん\0"
+    "たいほ\0"
+    "たいまつばな\0"
+    "たいみんぐ\0"
+    "たいむ\0"
+    "たいめん\0"
+    "たいやき\0"
+    "たいよう\0"
+    "たいら\0"
+    "たいりょく\0"
+    "たいる\0"
+    "たいわん\0"
+    "たうえ\0"
+    "たえる\0"
+    "たおす\0"
+    "たおる\0"
+    "たおれる\0"
+    "たかい\0"
+    "たかね\0"
+    "たきび\0"
+    "たくさん\0"
+    "たこく\0"
+    "たこやき\0"
+    "たさい\0"
+    "たしざん\0"
+    "だじゃれ\0"
+    "たすける\0"
+    "たずさわる\0"
+    "たそがれ\0"
+    "たたかう\0"
+    "たたく\0"
+    "ただしい\0"
+    "たたみ\0"
+    "たちばな\0"
+    "だっかい\0"
+    "だっきゃく\0"
+    "だっこ\0"
+    "だっしゅつ\0"
+    "だったい\0"
+    "たてる\0"
+    "たとえる\0"
+    "たなばた\0"
+    "たにん\0"
+    "たぬき\0"
+    "たのしみ\0"
+    "たはつ\0"
+    "たぶん\0"
+    "たべる\0"
+    "たぼう\0"
+    "たまご\0"
+    "たまる\0"
+    "だむる\0"
+    "ためいき\0"
+    "ためす\0"
+    "ためる\0"
+    "たもつ\0"
+    "たやすい\0"
+    "たよる\0"
+    "たらす\0"
+    "たりきほんがん\0"
+    "たりょう\0"
+    "たりる\0"
+    "たると\0"
+    "たれる\0"
+    "たれんと\0"
+    "たろっと\0"
+    "たわむれる\0"
+    "だんあつ\0"
+    "たんい\0"
+    "たんおん\0"
+    "たんか\0"
+    "たんき\0"
+    "たんけん\0"
+    "たんご\0"
+    "たんさん\0"
+    "たんじょうび\0"
+    "だんせい\0"
+    "たんそく\0"
+    "たんたい\0"
+    "だんち\0"
+    "たんてい\0"
+    "たんとう\0"
+    "だんな\0"
+    "たんにん\0"
+    "だんねつ\0"
+    "たんのう\0"
+    "たんぴん\0"
+    "だんぼう\0"
+    "たんまつ\0"
+    "たんめい\0"
+    "だんれつ\0"
+    "だんろ\0"
+    "だんわ\0"
+    "ちあい\0"
+    "ちあん\0"
+    "ちいき\0"
+    "ちいさい\0"
+    "ちえん\0"
+    "ちかい\0"
+    "ちから\0"
+    "ちきゅう\0"
+    "ちきん\0"
+    "ちけいず\0"
+    "ちけん\0"
+    "ちこく\0"
+    "ちさい\0"
+    "ちしき\0"
+    "ちしりょう\0"
+    "ちせい\0"
+    "ちそう\0"
+    "ちたい\0"
+    "ちたん\0"
+    "ちちおや\0"
+    "ちつじょ\0"
+    "ちてき\0"
+    "ちてん\0"
+    "ちぬき\0"
+    "ちぬり\0"
+    "ちのう\0"
+    "ちひょう\0"
+    "ちへいせん\0"
+    "ちほう\0"
+    "ちまた\0"
+    "ちみつ\0"
+    "ちみどろ\0"
+    "ちめいど\0"
+    "ちゃんこなべ\0"
+    "ちゅうい\0"
+    "ちゆりょく\0"
+    "ちょうし\0"
+    "ちょさくけん\0"
+    "ちらし\0"
+    "ちらみ\0"
+    "ちりがみ\0"
+    "ちりょう\0"
+    "ちるど\0"
+    "ちわわ\0"
+    "ちんたい\0"
+    "ちんもく\0"
+    "ついか\0"
+    "ついたち\0"
+    "つうか\0"
+    "つうじょう\0"
+    "つうはん\0"
+    "つうわ\0"
+    "つかう\0"
+    "つかれる\0"
+    "つくね\0"
+    "つくる\0"
+    "つけね\0"
+    "つける\0"
+    "つごう\0"
+    "つたえる\0"
+    "つづく\0"
+    "つつじ\0"
+    "つつむ\0"
+    "つとめる\0"
+    "つながる\0"
+    "つなみ\0"
+    "つねづね\0"
+    "つのる\0"
+    "つぶす\0"
+    "つまらない\0"
+    "つまる\0"
+    "つみき\0"
+    "つめたい\0"
+    "つもり\0"
+    "つもる\0"
+    "つよい\0"
+    "つるぼ\0"
+    "つるみく\0"
+    "つわもの\0"
+    "つわり\0"
+    "てあし\0"
+    "てあて\0"
+    "てあみ\0"
+    "ていおん\0"
+    "ていか\0"
+    "ていき\0"
+    "ていけい\0"
+    "ていこく\0"
+    "ていさつ\0"
+    "ていし\0"
+    "ていせい\0"
+    "ていたい\0"
+    "ていど\0"
+    "ていねい\0"
+    "ていひょう\0"
+    "ていへん\0"
+    "ていぼう\0"
+    "てうち\0"
+    "ておくれ\0"
+    "てきとう\0"
+    "てくび\0"
+    "でこぼこ\0"
+    "てさぎょう\0"
+    "てさげ\0"
+    "てすり\0"
+    "てそう\0"
+    "てちがい\0"
+    "てちょう\0"
+    "てつがく\0"
+    "てつづき\0"
+    "でっぱ\0"
+    "てつぼう\0"
+    "てつや\0"
+    "でぬかえ\0"
+    "てぬき\0"
+    "てぬぐい\0"
+    "てのひら\0"
+    "てはい\0"
+    "てぶくろ\0"
+    "てふだ\0"
+    "てほどき\0"
+    "てほん\0"
+    "てまえ\0"
+    "てまきずし\0"
+    "てみじか\0"
+    "てみやげ\0"
+    "てらす\0"
+    "てれび\0"
+    "てわけ\0"
+    "てわたし\0"
+    "でんあつ\0"
+    "てんいん\0"
+    "てんかい\0"
+    "てんき\0"
+    "てんぐ\0"
+    "てんけん\0"
+    "てんごく\0"
+    "てんさい\0"
+    "てんし\0"
+    "てんすう\0"
+    "でんち\0"
+    "てんてき\0"
+    "てんとう\0"
+    "てんない\0"
+    "てんぷら\0"
+    "てんぼうだい\0"
+    "てんめつ\0"
+    "てんらんかい\0"
+    "でんりょく\0"
+    "でんわ\0"
+    "どあい\0"
+    "といれ\0"
+    "どうかん\0"
+    "とうきゅう\0"
+    "どうぐ\0"
+    "とうし\0"
+    "とうむぎ\0"
+    "とおい\0"
+    "とおか\0"
+    "とおく\0"
+    "とおす\0"
+    "とおる\0"
+    "とかい\0"
+    "とかす\0"
+    "ときおり\0"
+    "ときどき\0"
+    "とくい\0"
+    "とくしゅう\0"
+    "とくてん\0"
+    "とくに\0"
+    "とくべつ\0"
+    "とけい\0"
+    "とける\0"
+    "とこや\0"
+    "とさか\0"
+    "としょかん\0"
+    "とそう\0"
+    "とたん\0"
+    "とちゅう\0"
+    "とっきゅう\0"
+    "とっくん\0"
+    "とつぜん\0"
+    "とつにゅう\0"
+    "とどける\0"
+    "ととのえる\0"
+    "とない\0"
+    "となえる\0"
+    "となり\0"
+    "とのさま\0"
+    "とばす\0"
+    "どぶがわ\0"
+    "とほう\0"
+    "とまる\0"
+    "とめる\0"
+    "ともだち\0"
+    "ともる\0"
+    "どようび\0"
+    "とらえる\0"
+    "とんかつ\0"
+    "どんぶり\0"
+    "ないかく\0"
+    "ないこう\0"
+    "ないしょ\0"
+    "ないす\0"
+    "ないせん\0"
+    "ないそう\0"
+    "なおす\0"
+    "ながい\0"
+    "なくす\0"
+    "なげる\0"
+    "なこうど\0"
+    "なさけ\0"
+    "なたでここ\0"
+    "なっとう\0"
+    "なつやすみ\0"
+    "ななおし\0"
+    "なにごと\0"
+    "なにもの\0"
+    "なにわ\0"
+    "なのか\0"
+    "なふだ\0"
+    "なまいき\0"
+    "なまえ\0"
+    "なまみ\0"
+    "なみだ\0"
+    "なめらか\0"
+    "なめる\0"
+    "なやむ\0"
+    "ならう\0"
+    "ならび\0"
+    "ならぶ\0"
+    "なれる\0"
+    "なわとび\0"
+    "なわばり\0"
+    "にあう\0"
+    "にいがた\0"
+    "にうけ\0"
+    "におい\0"
+    "にかい\0"
+    "にがて\0"
+    "にきび\0"
+    "にくしみ\0"
+    "にくまん\0"
+    "にげる\0"
+    "にさんかたんそ\0"
+    "にしき\0"
+    "にせもの\0"
+    "にちじょう\0"
+    "にちようび\0"
+    "にっか\0"
+    "にっき\0"
+    "にっけい\0"
+    "にっこう\0"
+    "にっさん\0"
+    "にっしょく\0"
+    "にっすう\0"
+    "にっせき\0"
+    "にってい\0"
+    "になう\0"
+    "にほん\0"
+    "にまめ\0"
+    "にもつ\0"
+    "にやり\0"
+    "にゅういん\0"
+    "にりんしゃ\0"
+    "にわとり\0"
+    "にんい\0"
+    "にんか\0"
+    "にんき\0"
+    "にんげん\0"
+    "にんしき\0"
+    "にんずう\0"
+    "にんそう\0"
+    "にんたい\0"
+    "にんち\0"
+    "にんてい\0"
+    "にんにく\0"
+    "にんぷ\0"
+    "にんまり\0"
+    "にんむ\0"
+    "にんめい\0"
+    "にんよう\0"
+    "ぬいくぎ\0"
+    "ぬかす\0"
+    "ぬぐいとる\0"
+    "ぬぐう\0"
+    "ぬくもり\0"
+    "ぬすむ\0"
+    "ぬまえび\0"
+    "ぬめり\0"
+    "ぬらす\0"
+    "ぬんちゃく\0"
+    "ねあげ\0"
+    "ねいき\0"
+    "ねいる\0"
+    "ねいろ\0"
+    "ねぐせ\0"
+    "ねくたい\0"
+    "ねくら\0"
+    "ねこぜ\0"
+    "ねこむ\0"
+    "ねさげ\0"
+    "ねすごす\0"
+    "ねそべる\0"
+    "ねだん\0"
+    "ねつい\0"
+    "ねっしん\0"
+    "ねつぞう\0"
+    "ねったいぎょ\0"
+    "ねぶそく\0"
+    "ねふだ\0"
+    "ねぼう\0"
+    "ねほりはほり\0"
+    "ねまき\0"
+    "ねまわし\0"
+    "ねみみ\0"
+    "ねむい\0"
+    "ねむたい\0"
+    "ねもと\0"
+    "ねらう\0"
+    "ねわざ\0"
+    "ねんいり\0"
+    "ねんおし\0"
+    "ねんかん\0"
+    "ねんきん\0"
+    "ねんぐ\0"
+    "ねんざ\0"
+    "ねんし\0"
+    "ねんちゃく\0"
+    "ねんど\0"
+    "ねんぴ\0"
+    "ねんぶつ\0"
+    "ねんまつ\0"
+    "ねんりょう\0"
+    "ねんれい\0"
+    "のいず\0"
+    "のおづま\0"
+    "のがす\0"
+    "のきなみ\0"
+    "のこぎり\0"
+    "のこす\0"
+    "のこる\0"
+    "のせる\0"
+    "のぞく\0"
+    "のぞむ\0"
+    "のたまう\0"
+    "のちほど\0"
+    "のっく\0"
+    "のばす\0"
+    "のはら\0"
+    "のべる\0"
+    "のぼる\0"
+    "のみもの\0"
+    "のやま\0"
+    "のらいぬ\0"
+    "のらねこ\0"
+    "のりもの\0"
+    "のりゆき\0"
+    "のれん\0"
+    "のんき\0"
+    "ばあい\0"
+    "はあく\0"
+    "ばあさん\0"
+    "ばいか\0"
+    "ばいく\0"
+    "はいけん\0"
+    "はいご\0"
+    "はいしん\0"
+    "はいすい\0"
+    "はいせん\0"
+    "はいそう\0"
+    "はいち\0"
+    "ばいばい\0"
+    "はいれつ\0"
+    "はえる\0"
+    "はおる\0"
+    "はかい\0"
+    "ばかり\0"
+    "はかる\0"
+    "はくしゅ\0"
+    "はけん\0"
+    "はこぶ\0"
+    "はさみ\0"
+    "はさん\0"
+    "はしご\0"
+    "ばしょ\0"
+    "はしる\0"
+    "はせる\0"
+    "ぱそこん\0"
+    "はそん\0"
+    "はたん\0"
+    "はちみつ\0"
+    "はつおん\0"
+    "はっかく\0"
+    "はづき\0"
+    "はっきり\0"
+    "はっくつ\0"
+    "はっけん\0"
+    "はっこう\0"
+    "はっさん\0"
+    "はっしん\0"
+    "はったつ\0"
+    "はっちゅう\0"
+    "はってん\0"
+    "はっぴょう\0"
+    "はっぽう\0"
+    "はなす\0"
+    "はなび\0"
+    "はにかむ\0"
+    "はぶらし\0"
+    "はみがき\0"
+    "はむかう\0"
+    "はめつ\0"
+    "はやい\0"
+    "はやし\0"
+    "はらう\0"
+    "はろうぃん\0"
+    "はわい\0"
+    "はんい\0"
+    "はんえい\0"
+    "はんおん\0"
+    "はんかく\0"
+    "はんきょう\0"
+    "ばんぐみ\0"
+    "はんこ\0"
+    "はんしゃ\0"
+    "はんすう\0"
+    "はんだん\0"
+    "ぱんち\0"
+    "ぱんつ\0"
+    "はんてい\0"
+    "はんとし\0"
+    "はんのう\0"
+    "はんぱ\0"
+    "はんぶん\0"
+    "はんぺん\0"
+    "はんぼうき\0"
+    "はんめい\0"
+    "はんらん\0"
+    "はんろん\0"
+    "ひいき\0"
+    "ひうん\0"
+    "ひえる\0"
+    "ひかく\0"
+    "ひかり\0"
+    "ひかる\0"
+    "ひかん\0"
+    "ひくい\0"
+    "ひけつ\0"
+    "ひこうき\0"
+    "ひこく\0"
+    "ひさい\0"
+    "ひさしぶり\0"
+    "ひさん\0"
+    "びじゅつかん\0"
+    "ひしょ\0"
+    "ひそか\0"
+    "ひそむ\0"
+    "ひたむき\0"
+    "ひだり\0"
+    "ひたる\0"
+    "ひつぎ\0"
+    "ひっこし\0"
+    "ひっし\0"
+    "ひつじゅひん\0"
+    "ひっす\0"
+    "ひつぜん\0"
+    "ぴったり\0"
+    "ぴっちり\0"
+    "ひつよう\0"
+    "ひてい\0"
+    "ひとごみ\0"
+    "ひなまつり\0"
+    "ひなん\0"
+    "ひねる\0"
+    "ひはん\0"
+    "ひびく\0"
+    "ひひょう\0"
+    "ひほう\0"
+    "ひまわり\0"
+    "ひまん\0"
+    "ひみつ\0"
+    "ひめい\0"
+    "ひめじし\0"
+    "ひやけ\0"
+    "ひやす\0"
+    "ひよう\0"
+    "びょうき\0"
+    "ひらがな\0"
+    "ひらく\0"
+    "ひりつ\0"
+    "ひりょう\0"
+    "ひるま\0"
+    "ひるやすみ\0"
+    "ひれい\0"
+    "ひろい\0"
+    "ひろう\0"
+    "ひろき\0"
+    "ひろゆき\0"
+    "ひんかく\0"
+    "ひんけつ\0"
+    "ひんこん\0"
+    "ひんしゅ\0"
+    "ひんそう\0"
+    "ぴんち\0"
+    "ひんぱん\0"
+    "びんぼう\0"
+    "ふあん\0"
+    "ふいうち\0"
+    "ふうけい\0"
+    "ふうせん\0"
+    "ぷうたろう\0"
+    "ふうとう\0"
+    "ふうふ\0"
+    "ふえる\0"
+    "ふおん\0"
+    "ふかい\0"
+    "ふきん\0"
+    "ふくざつ\0"
+    "ふくぶくろ\0"
+    "ふこう\0"
+    "ふさい\0"
+    "ふしぎ\0"
+    "ふじみ\0"
+    "ふすま\0"
+    "ふせい\0"
+    "ふせぐ\0"
+    "ふそく\0"
+    "ぶたにく\0"
+    "ふたん\0"
+    "ふちょう\0"
+    "ふつう\0"
+    "ふつか\0"
+    "ふっかつ\0"
+    "ふっき\0"
+    "ふっこく\0"
+    "ぶどう\0"
+    "ふとる\0"
+    "ふとん\0"
+    "ふのう\0"
+    "ふはい\0"
+    "ふひょう\0"
+    "ふへん\0"
+    "ふまん\0"
+    "ふみん\0"
+    "ふめつ\0"
+    "ふめん\0"
+    "ふよう\0"
+    "ふりこ\0"
+    "ふりる\0"
+    "ふるい\0"
+    "ふんいき\0"
+    "ぶんがく\0"
+    "ぶんぐ\0"
+    "ふんしつ\0"
+    "ぶんせき\0"
+    "ふんそう\0"
+    "ぶんぽう\0"
+    "へいあん\0"
+    "へいおん\0"
+    "へいがい\0"
+    "へいき\0"
+    "へいげん\0"
+    "へいこう\0"
+    "へいさ\0"
+    "へいしゃ\0"
+    "へいせつ\0"
+    "へいそ\0"
+    "へいたく\0"
+    "へいてん\0"
+    "へいねつ\0"
+    "へいわ\0"
+    "へきが\0"
+    "へこむ\0"
+    "べにいろ\0"
+    "べにしょうが\0"
+    "へらす\0"
+    "へんかん\0"
+    "べんきょう\0"
+    "べんごし\0"
+    "へんさい\0"
+    "へんたい\0"
+    "べんり\0"
+    "ほあん\0"
+    "ほいく\0"
+    "ぼうぎょ\0"
+    "ほうこく\0"
+    "ほうそう\0"
+    "ほうほう\0"
+    "ほうもん\0"
+    "ほうりつ\0"
+    "ほえる\0"
+    "ほおん\0"
+    "ほかん\0"
+    "ほきょう\0"
+    "ぼきん\0"
+    "ほくろ\0"
+    "ほけつ\0"
+    "ほけん\0"
+    "ほこう\0"
+    "ほこる\0"
+    "ほしい\0"
+    "ほしつ\0"
+    "ほしゅ\0"
+    "ほしょう\0"
+    "ほせい\0"
+    "ほそい\0"
+    "ほそく\0"
+    "ほたて\0"
+    "ほたる\0"
+    "ぽちぶくろ\0"
+    "ほっきょく\0"
+    "ほっさ\0"
+    "ほったん\0"
+    "ほとんど\0"
+    "ほめる\0"
+    "ほんい\0"
+    "ほんき\0"
+    "ほんけ\0"
+    "ほんしつ\0"
+    "ほんやく\0"
+    "まいにち\0"
+    "まかい\0"
+    "まかせる\0"
+    "まがる\0"
+    "まける\0"
+    "まこと\0"
+    "まさつ\0"
+    "まじめ\0"
+    "ますく\0"
+    "まぜる\0"
+    "まつり\0"
+    "まとめ\0"
+    "まなぶ\0"
+    "まぬけ\0"
+    "まねく\0"
+    "まほう\0"
+    "まもる\0"
+    "まゆげ\0"
+    "まよう\0"
+    "まろやか\0"
+    "まわす\0"
+    "まわり\0"
+    "まわる\0"
+    "まんが\0"
+    "まんきつ\0"
+    "まんぞく\0"
+    "まんなか\0"
+    "みいら\0"
+    "みうち\0"
+    "みえる\0"
+    "みがく\0"
+    "みかた\0"
+    "みかん\0"
+    "みけん\0"
+    "みこん\0"
+    "みじかい\0"
+    "みすい\0"
+    "みすえる\0"
+    "みせる\0"
+    "みっか\0"
+    "みつかる\0"
+    "みつける\0"
+    "みてい\0"
+    "みとめる\0"
+    "みなと\0"
+    "みなみかさい\0"
+    "みねらる\0"
+    "みのう\0"
+    "みのがす\0"
+    "みほん\0"
+    "みもと\0"
+    "みやげ\0"
+    "みらい\0"
+    "みりょく\0"
+    "みわく\0"
+    "みんか\0"
+    "みんぞく\0"
+    "むいか\0"
+    "むえき\0"
+    "むえん\0"
+    "むかい\0"
+    "むかう\0"
+    "むかえ\0"
+    "むかし\0"
+    "むぎちゃ\0"
+    "むける\0"
+    "むげん\0"
+    "むさぼる\0"
+    "むしあつい\0"
+    "むしば\0"
+    "むじゅん\0"
+    "むしろ\0"
+    "むすう\0"
+    "むすこ\0"
+    "むすぶ\0"
+    "むすめ\0"
+    "むせる\0"
+    "むせん\0"
+    "むちゅう\0"
+    "むなしい\0"
+    "むのう\0"
+    "むやみ\0"
+    "むよう\0"
+    "むらさき\0"
+    "むりょう\0"
+    "むろん\0"
+    "めいあん\0"
+    "めいうん\0"
+    "めいえん\0"
+    "めいかく\0"
+    "めいきょく\0"
+    "めいさい\0"
+    "めいし\0"
+    "めいそう\0"
+    "めいぶつ\0"
+    "めいれい\0"
+    "めいわく\0"
+    "めぐまれる\0"
+    "めざす\0"
+    "めした\0"
+    "めずらしい\0"
+    "めだつ\0"
+    "めまい\0"
+    "めやす\0"
+    "めんきょ\0"
+    "めんせき\0"
+    "めんどう\0"
+    "もうしあげる\0"
+    "もうどうけん\0"
+    "もえる\0"
+    "もくし\0"
+    "もくてき\0"
+    "もくようび\0"
+    "もちろん\0"
+    "もどる\0"
+    "もらう\0"
+    "もんく\0"
+    "もんだい\0"
+    "やおや\0"
+    "やける\0"
+    "やさい\0"
+    "やさしい\0"
+    "やすい\0"
+    "やすたろう\0"
+    "やすみ\0"
+    "やせる\0"
+    "やそう\0"
+    "やたい\0"
+    "やちん\0"
+    "やっと\0"
+    "やっぱり\0"
+    "やぶる\0"
+    "やめる\0"
+    "ややこしい\0"
+    "やよい\0"
+    "やわらかい\0"
+    "ゆうき\0"
+    "ゆうびんきょく\0"
+    "ゆうべ\0"
+    "ゆうめい\0"
+    "ゆけつ\0"
+    "ゆしゅつ\0"
+    "ゆせん\0"
+    "ゆそう\0"
+    "ゆたか\0"
+    "ゆちゃく\0"
+    "ゆでる\0"
+    "ゆにゅう\0"
+    "ゆびわ\0"
+    "ゆらい\0"
+    "ゆれる\0"
+    "ようい\0"
+    "ようか\0"
+    "ようきゅう\0"
+    "ようじ\0"
+    "ようす\0"
+    "ようちえん\0"
+    "よかぜ\0"
+    "よかん\0"
+    "よきん\0"
+    "よくせい\0"
+    "よくぼう\0"
+    "よけい\0"
+    "よごれる\0"
+    "よさん\0"
+    "よしゅう\0"
+    "よそう\0"
+    "よそく\0"
+    "よっか\0"
+    "よてい\0"
+    "よどがわく\0"
+    "よねつ\0"
+    "よやく\0"
+    "よゆう\0"
+    "よろこぶ\0"
+    "よろしい\0"
+    "らいう\0"
+    "らくがき\0"
+    "らくご\0"
+    "らくさつ\0"
+    "らくだ\0"
+    "らしんばん\0"
+    "らせん\0"
+    "らぞく\0"
+    "らたい\0"
+    "らっか\0"
+    "られつ\0"
+    "りえき\0"
+    "りかい\0"
+    "りきさく\0"
+    "りきせつ\0"
+    "りくぐん\0"
+    "りくつ\0"
+    "りけん\0"
+    "りこう\0"
+    "りせい\0"
+    "りそう\0"
+    "りそく\0"
+    "りてん\0"
+    "りねん\0"
+    "りゆう\0"
+    "りゅうがく\0"
+    "りよう\0"
+    "りょうり\0"
+    "りょかん\0"
+    "りょくちゃ\0"
+    "りょこう\0"
+    "りりく\0"
+    "りれき\0"
+    "りろん\0"
+    "りんご\0"
+    "るいけい\0"
+    "るいさい\0"
+    "るいじ\0"
+    "るいせき\0"
+    "るすばん\0"
+    "るりがわら\0"
+    "れいかん\0"
+    "れいぎ\0"
+    "れいせい\0"
+    "れいぞうこ\0"
+    "れいとう\0"
+    "れいぼう\0"
+    "れきし\0"
+    "れきだい\0"
+    "れんあい\0"
+    "れんけい\0"
+    "れんこん\0"
+    "れんさい\0"
+    "れんしゅう\0"
+    "れんぞく\0"
+    "れんらく\0"
+    "ろうか\0"
+    "ろうご\0"
+    "ろうじん\0"
+    "ろうそく\0"
+    "ろくが\0"
+    "ろこつ\0"
+    "ろじうら\0"
+    "ろしゅつ\0"
+    "ろせん\0"
+    "ろてん\0"
+    "ろめん\0"
+    "ろれつ\0"
+    "ろんぎ\0"
+    "ろんぱ\0"
+    "ろんぶん\0"
+    "ろんり\0"
+    "わかす\0"
+    "わかめ\0"
+    "わかやま\0"
+    "わかれる\0"
+    "わしつ\0"
+    "わじまし\0"
+    "わすれもの\0"
+    "わらう\0"
+    "われる";
+
+static const uint16_t ja_offsets[dictionary_size] =
 {
-    {
-        "あいこくしん",
-        "あいさつ",
-        "あいだ",
-        "あおぞら",
-        "あかちゃん",
-        "あきる",
-        "あけがた",
-        "あける",
-        "あこがれる",
-        "あさい",
-        "あさひ",
-        "あしあと",
-        "あじわう",
-        "あずかる",
-        "あずき",
-        "あそぶ",
-        "あたえる",
-        "あたためる",
-        "あたりまえ",
-        "あたる",
-        "あつい",
-        "あつかう",
-        "あっしゅく",
-        "あつまり",
-        "あつめる",
-        "あてな",
-        "あてはまる",
-        "あひる",
-        "あぶら",
-        "あぶる",
-        "あふれる",
-        "あまい",
-        "あまど",
-        "あまやかす",
-        "あまり",
-        "あみもの",
-        "あめりか",
-        "あやまる",
-        "あゆむ",
-        "あらいぐま",
-        "あらし",
-        "あらすじ",
-        "あらためる",
-        "あらゆる",
-        "あらわす",
-        "ありがとう",
-        "あわせる",
-        "あわてる",
-        "あんい",
-        "あんがい",
-        "あんこ",
-        "あんぜん",
-        "あんてい",
-        "あんない",
-        "あんまり",
-        "いいだす",
-        "いおん",
-        "いがい",
-        "いがく",
-        "いきおい",
-        "いきなり",
-        "いきもの",
-        "いきる",
-        "いくじ",
-        "いくぶん",
-        "いけばな",
-        "いけん",
-        "いこう",
-        "いこく",
-        "いこつ",
-        "いさましい",
-        "いさん",
-        "いしき",
-        "いじゅう",
-        "いじょう",
-        "いじわる",
-        "いずみ",
-        "いずれ",
-        "いせい",
-        "いせえび",
-        "いせかい",
-        "いせき",
-        "いぜん",
-        "いそうろう",
-        "いそがしい",
-        "いだい",
-        "いだく",
-        "いたずら",
-        "いたみ",
-        "いたりあ",
-        "いちおう",
-        "いちじ",
-        "いちど",
-        "いちば",
-        "いちぶ",
-        "いちりゅう",
-        "いつか",
-        "いっしゅん",
-        "いっせい",
-        "いっそう",
-        "いったん",
-        "いっち",
-        "いってい",
-        "いっぽう",
-        "いてざ",
-        "いてん",
-        "いどう",
-        "いとこ",
-        "いない",
-        "いなか",
-        "いねむり",
-        "いのち",
-        "いのる",
-        "いはつ",
-        "いばる",
-        "いはん",
-        "いびき",
-        "いひん",
-        "いふく",
-        "いへん",
-        "いほう",
-        "いみん",
-        "いもうと",
-        "いもたれ",
-        "いもり",
-        "いやがる",
-        "いやす",
-        "いよかん",
-        "いよく",
-        "いらい",
-        "いらすと",
-        "いりぐち",
-        "いりょう",
-        "いれい",
-        "いれもの",
-        "いれる",
-        "いろえんぴつ",
-        "いわい",
-        "いわう",
-        "いわかん",
-        "いわば",
-        "いわゆる",
-        "いんげんまめ",
-        "いんさつ",
-        "いんしょう",
-        "いんよう",
-        "うえき",
-        "うえる",
-        "うおざ",
-        "うがい",
-        "うかぶ",
-        "うかべる",
-        "うきわ",
-        "うくらいな",
-        "うくれれ",
-        "うけたまわる",
-        "うけつけ",
-        "うけとる",
-        "うけもつ",
-        "うける",
-        "うごかす",
-        "うごく",
-        "うこん",
-        "うさぎ",
-        "うしなう",
-        "うしろがみ",
-        "うすい",
-        "うすぎ",
-        "うすぐらい",
-        "うすめる",
-        "うせつ",
-        "うちあわせ",
-        "うちがわ",
-        "うちき",
-        "うちゅう",
-        "うっかり",
-        "うつくしい",
-        "うったえる",
-        "うつる",
-        "うどん",
-        "うなぎ",
-        "うなじ",
-        "うなずく",
-        "うなる",
-        "うねる",
-        "うのう",
-        "うぶげ",
-        "うぶごえ",
-        "うまれる",
-        "うめる",
-        "うもう",
-        "うやまう",
-        "うよく",
-        "うらがえす",
-        "うらぐち",
-        "うらない",
-        "うりあげ",
-        "うりきれ",
-        "うるさい",
-        "うれしい",
-        "うれゆき",
-        "うれる",
-        "うろこ",
-        "うわき",
-        "うわさ",
-        "うんこう",
-        "うんちん",
-        "うんてん",
-        "うんどう",
-        "えいえん",
-        "えいが",
-        "えいきょう",
-        "えいご",
-        "えいせい",
-        "えいぶん",
-        "えいよう",
-        "えいわ",
-        "えおり",
-        "えがお",
-        "えがく",
-        "えきたい",
-        "えくせる",
-        "えしゃく",
-        "えすて",
-        "えつらん",
-        "えのぐ",
-        "えほうまき",
-        "えほん",
-        "えまき",
-        "えもじ",
-        "えもの",
-        "えらい",
-        "えらぶ",
-        "えりあ",
-        "えんえん",
-        "えんかい",
-        "えんぎ",
-        "えんげき",
-        "えんしゅう",
-        "えんぜつ",
-        "えんそく",
-        "えんちょう",
-        "えんとつ",
-        "おいかける",
-        "おいこす",
-        "おいしい",
-        "おいつく",
-        "おうえん",
-        "おうさま",
-        "おうじ",
-        "おうせつ",
-        "おうたい",
-        "おうふく",
-        "おうべい",
-        "おうよう",
-        "おえる",
-        "おおい",
-        "おおう",
-        "おおどおり",
-        "おおや",
-        "おおよそ",
-        "おかえり",
-        "おかず",
-        "おがむ",
-        "おかわり",
-        "おぎなう",
-        "おきる",
-        "おくさま",
-        "おくじょう",
-        "おくりがな",
-        "おくる",
-        "おくれる",
-        "おこす",
-        "おこなう",
-        "おこる",
-        "おさえる",
-        "おさない",
-        "おさめる",
-        "おしいれ",
-        "おしえる",
-        "おじぎ",
-        "おじさん",
-        "おしゃれ",
-        "おそらく",
-        "おそわる",
-        "おたがい",
-        "おたく",
-        "おだやか",
-        "おちつく",
-        "おっと",
-        "おつり",
-        "おでかけ",
-        "おとしもの",
-        "おとなしい",
-        "おどり",
-        "おどろかす",
-        "おばさん",
-        "おまいり",
-        "おめでとう",
-        "おもいで",
-        "おもう",
-        "おもたい",
-        "おもちゃ",
-        "おやつ",
-        "おやゆび",
-        "およぼす",
-        "おらんだ",
-        "おろす",
-        "おんがく",
-        "おんけい",
-        "おんしゃ",
-        "おんせん",
-        "おんだん",
-        "おんちゅう",
-        "おんどけい",
-        "かあつ",
-        "かいが",
-        "がいき",
-        "がいけん",
-        "がいこう",
-        "かいさつ",
-        "かいしゃ",
-        "かいすいよく",
-        "かいぜん",
-        "かいぞうど",
-        "かいつう",
-        "かいてん",
-        "かいとう",
-        "かいふく",
-        "がいへき",
-        "かいほう",
-        "かいよう",
-        "がいらい",
-        "かいわ",
-        "かえる",
-        "かおり",
-        "かかえる",
-        "かがく",
-        "かがし",
-        "かがみ",
-        "かくご",
-        "かくとく",
-        "かざる",
-        "がぞう",
-        "かたい",
-        "かたち",
-        "がちょう",
-        "がっきゅう",
-        "がっこう",
-        "がっさん",
-        "がっしょう",
-        "かなざわし",
-        "かのう",
-        "がはく",
-        "かぶか",
-        "かほう",
-        "かほご",
-        "かまう",
-        "かまぼこ",
-        "かめれおん",
-        "かゆい",
-        "かようび",
-        "からい",
-        "かるい",
-        "かろう",
-        "かわく",
-        "かわら",
-        "がんか",
-        "かんけい",
-        "かんこう",
-        "かんしゃ",
-        "かんそう",
-        "かんたん",
-        "かんち",
-        "がんばる",
-        "きあい",
-        "きあつ",
-        "きいろ",
-        "ぎいん",
-        "きうい",
-        "きうん",
-        "きえる",
-        "きおう",
-        "きおく",
-        "きおち",
-        "きおん",
-        "きかい",
-        "きかく",
-        "きかんしゃ",
-        "ききて",
-        "きくばり",
-        "きくらげ",
-        "きけんせい",
-        "きこう",
-        "きこえる",
-        "きこく",
-        "きさい",
-        "きさく",
-        "きさま",
-        "きさらぎ",
-        "ぎじかがく",
-        "ぎしき",
-        "ぎじたいけん",
-        "ぎじにってい",
-        "ぎじゅつしゃ",
-        "きすう",
-        "きせい",
-        "きせき",
-        "きせつ",
-        "きそう",
-        "きぞく",
-        "きぞん",
-        "きたえる",
-        "きちょう",
-        "きつえん",
-        "ぎっちり",
-        "きつつき",
-        "きつね",
-        "きてい",
-        "きどう",
-        "きどく",
-        "きない",
-        "きなが",
-        "きなこ",
-        "きぬごし",
-        "きねん",
-        "きのう",
-        "きのした",
-        "きはく",
-        "きびしい",
-        "きひん",
-        "きふく",
-        "きぶん",
-        "きぼう",
-        "きほん",
-        "きまる",
-        "きみつ",
-        "きむずかしい",
-        "きめる",
-        "きもだめし",
-        "きもち",
-        "きもの",
-        "きゃく",
-        "きやく",
-        "ぎゅうにく",
-        "きよう",
-        "きょうりゅう",
-        "きらい",
-        "きらく",
-        "きりん",
-        "きれい",
-        "きれつ",
-        "きろく",
-        "ぎろん",
-        "きわめる",
-        "ぎんいろ",
-        "きんかくじ",
-        "きんじょ",
-        "きんようび",
-        "ぐあい",
-        "くいず",
-        "くうかん",
-        "くうき",
-        "くうぐん",
-        "くうこう",
-        "ぐうせい",
-        "くうそう",
-        "ぐうたら",
-        "くうふく",
-        "くうぼ",
-        "くかん",
-        "くきょう",
-        "くげん",
-        "ぐこう",
-        "くさい",
-        "くさき",
-        "くさばな",
-        "くさる",
-        "くしゃみ",
-        "くしょう",
-        "くすのき",
-        "くすりゆび",
-        "くせげ",
-        "くせん",
-        "ぐたいてき",
-        "くださる",
-        "くたびれる",
-        "くちこみ",
-        "くちさき",
-        "くつした",
-        "ぐっすり",
-        "くつろぐ",
-        "くとうてん",
-        "くどく",
-        "くなん",
-        "くねくね",
-        "くのう",
-        "くふう",
-        "くみあわせ",
-        "くみたてる",
-        "くめる",
-        "くやくしょ",
-        "くらす",
-        "くらべる",
-        "くるま",
-        "くれる",
-        "くろう",
-        "くわしい",
-        "ぐんかん",
-        "ぐんしょく",
-        "ぐんたい",
-        "ぐんて",
-        "けあな",
-        "けいかく",
-        "けいけん",
-        "けいこ",
-        "けいさつ",
-        "げいじゅつ",
-        "けいたい",
-        "げいのうじん",
-        "けいれき",
-        "けいろ",
-        "けおとす",
-        "けおりもの",
-        "げきか",
-        "げきげん",
-        "げきだん",
-        "げきちん",
-        "げきとつ",
-        "げきは",
-        "げきやく",
-        "げこう",
-        "げこくじょう",
-        "げざい",
-        "けさき",
-        "げざん",
-        "けしき",
-        "けしごむ",
-        "けしょう",
-        "げすと",
-        "けたば",
-        "けちゃっぷ",
-        "けちらす",
-        "けつあつ",
-        "けつい",
-        "けつえき",
-        "けっこん",
-        "けつじょ",
-        "けっせき",
-        "けってい",
-        "けつまつ",
-        "げつようび",
-        "げつれい",
-        "けつろん",
-        "げどく",
-        "けとばす",
-        "けとる",
-        "けなげ",
-        "けなす",
-        "けなみ",
-        "けぬき",
-        "げねつ",
-        "けねん",
-        "けはい",
-        "げひん",
-        "けぶかい",
-        "げぼく",
-        "けまり",
-        "けみかる",
-        "けむし",
-        "けむり",
-        "けもの",
-        "けらい",
-        "けろけろ",
-        "けわしい",
-        "けんい",
-        "けんえつ",
-        "けんお",
-        "けんか",
-        "げんき",
-        "けんげん",
-        "けんこう",
-        "けんさく",
-        "けんしゅう",
-        "けんすう",
-        "げんそう",
-        "けんちく",
-        "けんてい",
-        "けんとう",
-        "けんない",
-        "けんにん",
-        "げんぶつ",
-        "けんま",
-        "けんみん",
-        "けんめい",
-        "けんらん",
-        "けんり",
-        "こあくま",
-        "こいぬ",
-        "こいびと",
-        "ごうい",
-        "こうえん",
-        "こうおん",
-        "こうかん",
-        "ごうきゅう",
-        "ごうけい",
-        "こうこう",
-        "こうさい",
-        "こうじ",
-        "こうすい",
-        "ごうせい",
-        "こうそく",
-        "こうたい",
-        "こうちゃ",
-        "こうつう",
-        "こうてい",
-        "こうどう",
-        "こうない",
-        "こうはい",
-        "ごうほう",
-        "ごうまん",
-        "こうもく",
-        "こうりつ",
-        "こえる",
-        "こおり",
-        "ごかい",
-        "ごがつ",
-        "ごかん",
-        "こくご",
-        "こくさい",
-        "こくとう",
-        "こくない",
-        "こくはく",
-        "こぐま",
-        "こけい",
-        "こける",
-        "ここのか",
-        "こころ",
-        "こさめ",
-        "こしつ",
-        "こすう",
-        "こせい",
-        "こせき",
-        "こぜん",
-        "こそだて",
-        "こたい",
-        "こたえる",
-        "こたつ",
-        "こちょう",
-        "こっか",
-        "こつこつ",
-        "こつばん",
-        "こつぶ",
-        "こてい",
-        "こてん",
-        "ことがら",
-        "ことし",
-        "ことば",
-        "ことり",
-        "こなごな",
-        "こねこね",
-        "このまま",
-        "このみ",
-        "このよ",
-        "ごはん",
-        "こひつじ",
-        "こふう",
-        "こふん",
-        "こぼれる",
-        "ごまあぶら",
-        "こまかい",
-        "ごますり",
-        "こまつな",
-        "こまる",
-        "こむぎこ",
-        "こもじ",
-        "こもち",
-        "こもの",
-        "こもん",
-        "こやく",
-        "こやま",
-        "こゆう",
-        "こゆび",
-        "こよい",
-        "こよう",
-        "こりる",
-        "これくしょん",
-        "ころっけ",
-        "こわもて",
-        "こわれる",
-        "こんいん",
-        "こんかい",
-        "こんき",
-        "こんしゅう",
-        "こんすい",
-        "こんだて",
-        "こんとん",
-        "こんなん",
-        "こんびに",
-        "こんぽん",
-        "こんまけ",
-        "こんや",
-        "こんれい",
-        "こんわく",
-        "ざいえき",
-        "さいかい",
-        "さいきん",
-        "ざいげん",
-        "ざいこ",
-        "さいしょ",
-        "さいせい",
-        "ざいたく",
-        "ざいちゅう",
-        "さいてき",
-        "ざいりょう",
-        "さうな",
-        "さかいし",
-        "さがす",
-        "さかな",
-        "さかみち",
-        "さがる",
-        "さぎょう",
-        "さくし",
-        "さくひん",
-        "さくら",
-        "さこく",
-        "さこつ",
-        "さずかる",
-        "ざせき",
-        "さたん",
-        "さつえい",
-        "ざつおん",
-        "ざっか",
-        "ざつがく",
-        "さっきょく",
-        "ざっし",
-        "さつじん",
-        "ざっそう",
-        "さつたば",
-        "さつまいも",
-        "さてい",
-        "さといも",
-        "さとう",
-        "さとおや",
-        "さとし",
-        "さとる",
-        "さのう",
-        "さばく",
-        "さびしい",
-        "さべつ",
-        "さほう",
-        "さほど",
-        "さます",
-        "さみしい",
-        "さみだれ",
-        "さむけ",
-        "さめる",
-        "さやえんどう",
-        "さゆう",
-        "さよう",
-        "さよく",
-        "さらだ",
-        "ざるそば",
-        "さわやか",
-        "さわる",
-        "さんいん",
-        "さんか",
-        "さんきゃく",
-        "さんこう",
-        "さんさい",
-        "ざんしょ",
-        "さんすう",
-        "さんせい",
-        "さんそ",
-        "さんち",
-        "さんま",
-        "さんみ",
-        "さんらん",
-        "しあい",
-        "しあげ",
-        "しあさって",
-        "しあわせ",
-        "しいく",
-        "しいん",
-        "しうち",
-        "しえい",
-        "しおけ",
-        "しかい",
-        "しかく",
-        "じかん",
-        "しごと",
-        "しすう",
-        "じだい",
-        "したうけ",
-        "したぎ",
-        "したて",
-        "したみ",
-        "しちょう",
-        "しちりん",
-        "しっかり",
-        "しつじ",
-        "しつもん",
-        "してい",
-        "してき",
-        "してつ",
-        "じてん",
-        "じどう",
-        "しなぎれ",
-        "しなもの",
-        "しなん",
-        "しねま",
-        "しねん",
-        "しのぐ",
-        "しのぶ",
-        "しはい",
-        "しばかり",
-        "しはつ",
-        "しはらい",
-        "しはん",
-        "しひょう",
-        "しふく",
-        "じぶん",
-        "しへい",
-        "しほう",
-        "しほん",
-        "しまう",
-        "しまる",
-        "しみん",
-        "しむける",
-        "じむしょ",
-        "しめい",
-        "しめる",
-        "しもん",
-        "しゃいん",
-        "しゃうん",
-        "しゃおん",
-        "じゃがいも",
-        "しやくしょ",
-        "しゃくほう",
-        "しゃけん",
-        "しゃこ",
-        "しゃざい",
-        "しゃしん",
-        "しゃせん",
-        "しゃそう",
-        "しゃたい",
-        "しゃちょう",
-        "しゃっきん",
-        "じゃま",
-        "しゃりん",
-        "しゃれい",
-        "じゆう",
-        "じゅうしょ",
-        "しゅくはく",
-        "じゅしん",
-        "しゅっせき",
-        "しゅみ",
-        "しゅらば",
-        "じゅんばん",
-        "しょうかい",
-        "しょくたく",
-        "しょっけん",
-        "しょどう",
-        "しょもつ",
-        "しらせる",
-        "しらべる",
-        "しんか",
-        "しんこう",
-        "じんじゃ",
-        "しんせいじ",
-        "しんちく",
-        "しんりん",
-        "すあげ",
-        "すあし",
-        "すあな",
-        "ずあん",
-        "すいえい",
-        "すいか",
-        "すいとう",
-        "ずいぶん",
-        "すいようび",
-        "すうがく",
-        "すうじつ",
-        "すうせん",
-        "すおどり",
-        "すきま",
-        "すくう",
-        "すくない",
-        "すける",
-        "すごい",
-        "すこし",
-        "ずさん",
-        "すずしい",
-        "すすむ",
-        "すすめる",
-        "すっかり",
-        "ずっしり",
-        "ずっと",
-        "すてき",
-        "すてる",
-        "すねる",
-        "すのこ",
-        "すはだ",
-        "すばらしい",
-        "ずひょう",
-        "ずぶぬれ",
-        "すぶり",
-        "すふれ",
-        "すべて",
-        "すべる",
-        "ずほう",
-        "すぼん",
-        "すまい",
-        "すめし",
-        "すもう",
-        "すやき",
-        "すらすら",
-        "するめ",
-        "すれちがう",
-        "すろっと",
-        "すわる",
-        "すんぜん",
-        "すんぽう",
-        "せあぶら",
-        "せいかつ",
-        "せいげん",
-        "せいじ",
-        "せいよう",
-        "せおう",
-        "せかいかん",
-        "せきにん",
-        "せきむ",
-        "せきゆ",
-        "せきらんうん",
-        "せけん",
-        "せこう",
-        "せすじ",
-        "せたい",
-        "せたけ",
-        "せっかく",
-        "せっきゃく",
-        "ぜっく",
-        "せっけん",
-        "せっこつ",
-        "せっさたくま",
-        "せつぞく",
-        "せつだん",
-        "せつでん",
-        "せっぱん",
-        "せつび",
-        "せつぶん",
-        "せつめい",
-        "せつりつ",
-        "せなか",
-        "せのび",
-        "せはば",
-        "せびろ",
-        "せぼね",
-        "せまい",
-        "せまる",
-        "せめる",
-        "せもたれ",
-        "せりふ",
-        "ぜんあく",
-        "せんい",
-        "せんえい",
-        "せんか",
-        "せんきょ",
-        "せんく",
-        "せんげん",
-        "ぜんご",
-        "せんさい",
-        "せんしゅ",
-        "せんすい",
-        "せんせい",
-        "せんぞ",
-        "せんたく",
-        "せんちょう",
-        "せんてい",
-        "せんとう",
-        "せんぬき",
-        "せんねん",
-        "せんぱい",
-        "ぜんぶ",
-        "ぜんぽう",
-        "せんむ",
-        "せんめんじょ",
-        "せんもん",
-        "せんやく",
-        "せんゆう",
-        "せんよう",
-        "ぜんら",
-        "ぜんりゃく",
-        "せんれい",
-        "せんろ",
-        "そあく",
-        "そいとげる",
-        "そいね",
-        "そうがんきょう",
-        "そうき",
-        "そうご",
-        "そうしん",
-        "そうだん",
-        "そうなん",
-        "そうび",
-        "そうめん",
-        "そうり",
-        "そえもの",
-        "そえん",
-        "そがい",
-        "そげき",
-        "そこう",
-        "そこそこ",
-        "そざい",
-        "そしな",
-        "そせい",
-        "そせん",
-        "そそぐ",
-        "そだてる",
-        "そつう",
-        "そつえん",
-        "そっかん",
-        "そつぎょう",
-        "そっけつ",
-        "そっこう",
-        "そっせん",
-        "そっと",
-        "そとがわ",
-        "そとづら",
-        "そなえる",
-        "そなた",
-        "そふぼ",
-        "そぼく",
-        "そぼろ",
-        "そまつ",
-        "そまる",
-        "そむく",
-        "そむりえ",
-        "そめる",
-        "そもそも",
-        "そよかぜ",
-        "そらまめ",
-        "そろう",
-        "そんかい",
-        "そんけい",
-        "そんざい",
-        "そんしつ",
-        "そんぞく",
-        "そんちょう",
-        "ぞんび",
-        "ぞんぶん",
-        "そんみん",
-        "たあい",
-        "たいいん",
-        "たいうん",
-        "たいえき",
-        "たいおう",
-        "だいがく",
-        "たいき",
-        "たいぐう",
-        "たいけん",
-        "たいこ",
-        "たいざい",
-        "だいじょうぶ",
-        "だいすき",
-        "たいせつ",
-        "たいそう",
-        "だいたい",
-        "たいちょう",
-        "たいてい",
-        "だいどころ",
-        "たいない",
-        "たいねつ",
-        "たいのう",
-        "たいはん",
-        "だいひょう",
-        "たいふう",
-        "たいへん",
-        "たいほ",
-        "たいまつばな",
-        "たいみんぐ",
-        "たいむ",
-        "たいめん",
-        "たいやき",
-        "たいよう",
-        "たいら",
-        "たいりょく",
-        "たいる",
-        "たいわん",
-        "たうえ",
-        "たえる",
-        "たおす",
-        "たおる",
-        "たおれる",
-        "たかい",
-        "たかね",
-        "たきび",
-        "たくさん",
-        "たこく",
-        "たこやき",
-        "たさい",
-        "たしざん",
-        "だじゃれ",
-        "たすける",
-        "たずさわる",
-        "たそがれ",
-        "たたかう",
-        "たたく",
-        "ただしい",
-        "たたみ",
-        "たちばな",
-        "だっかい",
-        "だっきゃく",
-        "だっこ",
-        "だっしゅつ",
-        "だったい",
-        "たてる",
-        "たとえる",
-        "たなばた",
-        "たにん",
-        "たぬき",
-        "たのしみ",
-        "たはつ",
-        "たぶん",
-        "たべる",
-        "たぼう",
-        "たまご",
-        "たまる",
-        "だむる",
-        "ためいき",
-        "ためす",
-        "ためる",
-        "たもつ",
-        "たやすい",
-        "たよる",
-        "たらす",
-        "たりきほんがん",
-        "たりょう",
-        "たりる",
-        "たると",
-        "たれる",
-        "たれんと",
-        "たろっと",
-        "たわむれる",
-        "だんあつ",
-        "たんい",
-        "たんおん",
-        "たんか",
-        "たんき",
-        "たんけん",
-        "たんご",
-        "たんさん",
-        "たんじょうび",
-        "だんせい",
-        "たんそく",
-        "たんたい",
-        "だんち",
-        "たんてい",
-        "たんとう",
-        "だんな",
-        "たんにん",
-        "だんねつ",
-        "たんのう",
-        "たんぴん",
-        "だんぼう",
-        "たんまつ",
-        "たんめい",
-        "だんれつ",
-        "だんろ",
-        "だんわ",
-        "ちあい",
-        "ちあん",
-        "ちいき",
-        "ちいさい",
-        "ちえん",
-        "ちかい",
-        "ちから",
-        "ちきゅう",
-        "ちきん",
-        "ちけいず",
-        "ちけん",
-        "ちこく",
-        "ちさい",
-        "ちしき",
-        "ちしりょう",
-        "ちせい",
-        "ちそう",
-        "ちたい",
-        "ちたん",
-        "ちちおや",
-        "ちつじょ",
-        "ちてき",
-        "ちてん",
-        "ちぬき",
-        "ちぬり",
-        "ちのう",
-        "ちひょう",
-        "ちへいせん",
-        "ちほう",
-        "ちまた",
-        "ちみつ",
-        "ちみどろ",
-        "ちめいど",
-        "ちゃんこなべ",
-        "ちゅうい",
-        "ちゆりょく",
-        "ちょうし",
-        "ちょさくけん",
-        "ちらし",
-        "ちらみ",
-        "ちりがみ",
-        "ちりょう",
-        "ちるど",
-        "ちわわ",
-        "ちんたい",
-        "ちんもく",
-        "ついか",
-        "ついたち",
-        "つうか",
-        "つうじょう",
-        "つうはん",
-        "つうわ",
-        "つかう",
-        "つかれる",
-        "つくね",
-        "つくる",
-        "つけね",
-        "つける",
-        "つごう",
-        "つたえる",
-        "つづく",
-        "つつじ",
-        "つつむ",
-        "つとめる",
-        "つながる",
-        "つなみ",
-        "つねづね",
-        "つのる",
-        "つぶす",
-        "つまらない",
-        "つまる",
-        "つみき",
-        "つめたい",
-        "つもり",
-        "つもる",
-        "つよい",
-        "つるぼ",
-        "つるみく",
-        "つわもの",
-        "つわり",
-        "てあし",
-        "てあて",
-        "てあみ",
-        "ていおん",
-        "ていか",
-        "ていき",
-        "ていけい",
-        "ていこく",
-        "ていさつ",
-        "ていし",
-        "ていせい",
-        "ていたい",
-        "ていど",
-        "ていねい",
-        "ていひょう",
-        "ていへん",
-        "ていぼう",
-        "てうち",
-        "ておくれ",
-        "てきとう",
-        "てくび",
-        "でこぼこ",
-        "てさぎょう",
-        "てさげ",
-        "てすり",
-        "てそう",
-        "てちがい",
-        "てちょう",
-        "てつがく",
-        "てつづき",
-        "でっぱ",
-        "てつぼう",
-        "てつや",
-        "でぬかえ",
-        "てぬき",
-        "てぬぐい",
-        "てのひら",
-        "てはい",
-        "てぶくろ",
-        "てふだ",
-        "てほどき",
-        "てほん",
-        "てまえ",
-        "てまきずし",
-        "てみじか",
-        "てみやげ",
-        "てらす",
-        "てれび",
-        "てわけ",
-        "てわたし",
-        "でんあつ",
-        "てんいん",
-        "てんかい",
-        "てんき",
-        "てんぐ",
-        "てんけん",
-        "てんごく",
-        "てんさい",
-        "てんし",
-        "てんすう",
-        "でんち",
-        "てんてき",
-        "てんとう",
-        "てんない",
-        "てんぷら",
-        "てんぼうだい",
-        "てんめつ",
-        "てんらんかい",
-        "でんりょく",
-        "でんわ",
-        "どあい",
-        "といれ",
-        "どうかん",
-        "とうきゅう",
-        "どうぐ",
-        "とうし",
-        "とうむぎ",
-        "とおい",
-        "とおか",
-        "とおく",
-        "とおす",
-        "とおる",
-        "とかい",
-        "とかす",
-        "ときおり",
-        "ときどき",
-        "とくい",
-        "とくしゅう",
-        "とくてん",
-        "とくに",
-        "とくべつ",
-        "とけい",
-        "とける",
-        "とこや",
-        "とさか",
-        "としょかん",
-        "とそう",
-        "とたん",
-        "とちゅう",
-        "とっきゅう",
-        "とっくん",
-        "とつぜん",
-        "とつにゅう",
-        "とどける",
-        "ととのえる",
-        "とない",
-        "となえる",
-        "となり",
-        "とのさま",
-        "とばす",
-        "どぶがわ",
-        "とほう",
-        "とまる",
-        "とめる",
-        "ともだち",
-        "ともる",
-        "どようび",
-        "とらえる",
-        "とんかつ",
-        "どんぶり",
-        "ないかく",
-        "ないこう",
-        "ないしょ",
-        "ないす",
-        "ないせん",
-        "ないそう",
-        "なおす",
-        "ながい",
-        "なくす",
-        "なげる",
-        "なこうど",
-        "なさけ",
-        "なたでここ",
-        "なっとう",
-        "なつやすみ",
-        "ななおし",
-        "なにごと",
-        "なにもの",
-        "なにわ",
-        "なのか",
-        "なふだ",
-        "なまいき",
-        "なまえ",
-        "なまみ",
-        "なみだ",
-        "なめらか",
-        "なめる",
-        "なやむ",
-        "ならう",
-        "ならび",
-        "ならぶ",
-        "なれる",
-        "なわとび",
-        "なわばり",
-        "にあう",
-        "にいがた",
-        "にうけ",
-        "におい",
-        "にかい",
-        "にがて",
-        "にきび",
-        "にくしみ",
-        "にくまん",
-        "にげる",
-        "にさんかたんそ",
-        "にしき",
-        "にせもの",
-        "にちじょう",
-        "にちようび",
-        "にっか",
-        "にっき",
-        "にっけい",
-        "にっこう",
-        "にっさん",
-        "にっしょく",
-        "にっすう",
-        "にっせき",
-        "にってい",
-        "になう",
-        "にほん",
-        "にまめ",
-        "にもつ",
-        "にやり",
-        "にゅういん",
-        "にりんしゃ",
-        "にわとり",
-        "にんい",
-        "にんか",
-        "にんき",
-        "にんげん",
-        "にんしき",
-        "にんずう",
-        "にんそう",
-        "にんたい",
-        "にんち",
-        "にんてい",
-        "にんにく",
-        "にんぷ",
-        "にんまり",
-        "にんむ",
-        "にんめい",
-        "にんよう",
-        "ぬいくぎ",
-        "ぬかす",
-        "ぬぐいとる",
-        "ぬぐう",
-        "ぬくもり",
-        "ぬすむ",
-        "ぬまえび",
-        "ぬめり",
-        "ぬらす",
-        "ぬんちゃく",
-        "ねあげ",
-        "ねいき",
-        "ねいる",
-        "ねいろ",
-        "ねぐせ",
-        "ねくたい",
-        "ねくら",
-        "ねこぜ",
-        "ねこむ",
-        "ねさげ",
-        "ねすごす",
-        "ねそべる",
-        "ねだん",
-        "ねつい",
-        "ねっしん",
-        "ねつぞう",
-        "ねったいぎょ",
-        "ねぶそく",
-        "ねふだ",
-        "ねぼう",
-        "ねほりはほり",
-        "ねまき",
-        "ねまわし",
-        "ねみみ",
-        "ねむい",
-        "ねむたい",
-        "ねもと",
-        "ねらう",
-        "ねわざ",
-        "ねんいり",
-        "ねんおし",
-        "ねんかん",
-        "ねんきん",
-        "ねんぐ",
-        "ねんざ",
-        "ねんし",
-        "ねんちゃく",
-        "ねんど",
-        "ねんぴ",
-        "ねんぶつ",
-        "ねんまつ",
-        "ねんりょう",
-        "ねんれい",
-        "のいず",
-        "のおづま",
-        "のがす",
-        "のきなみ",
-        "のこぎり",
-        "のこす",
-        "のこる",
-        "のせる",
-        "のぞく",
-        "のぞむ",
-        "のたまう",
-        "のちほど",
-        "のっく",
-        "のばす",
-        "のはら",
-        "のべる",
-        "のぼる",
-        "のみもの",
-        "のやま",
-        "のらいぬ",
-        "のらねこ",
-        "のりもの",
-        "のりゆき",
-        "のれん",
-        "のんき",
-        "ばあい",
-        "はあく",
-        "ばあさん",
-        "ばいか",
-        "ばいく",
-        "はいけん",
-        "はいご",
-        "はいしん",
-        "はいすい",
-        "はいせん",
-        "はいそう",
-        "はいち",
-        "ばいばい",
-        "はいれつ",
-        "はえる",
-        "はおる",
-        "はかい",
-        "ばかり",
-        "はかる",
-        "はくしゅ",
-        "はけん",
-        "はこぶ",
-        "はさみ",
-        "はさん",
-        "はしご",
-        "ばしょ",
-        "はしる",
-        "はせる",
-        "ぱそこん",
-        "はそん",
-        "はたん",
-        "はちみつ",
-        "はつおん",
-        "はっかく",
-        "はづき",
-        "はっきり",
-        "はっくつ",
-        "はっけん",
-        "はっこう",
-        "はっさん",
-        "はっしん",
-        "はったつ",
-        "はっちゅう",
-        "はってん",
-        "はっぴょう",
-        "はっぽう",
-        "はなす",
-        "はなび",
-        "はにかむ",
-        "はぶらし",
-        "はみがき",
-        "はむかう",
-        "はめつ",
-        "はやい",
-        "はやし",
-        "はらう",
-        "はろうぃん",
-        "はわい",
-        "はんい",
-        "はんえい",
-        "はんおん",
-        "はんかく",
-        "はんきょう",
-        "ばんぐみ",
-        "はんこ",
-        "はんしゃ",
-        "はんすう",
-        "はんだん",
-        "ぱんち",
-        "ぱんつ",
-        "はんてい",
-        "はんとし",
-        "はんのう",
-        "はんぱ",
-        "はんぶん",
-        "はんぺん",
-        "はんぼうき",
-        "はんめい",
-        "はんらん",
-        "はんろん",
-        "ひいき",
-        "ひうん",
-        "ひえる",
-        "ひかく",
-        "ひかり",
-        "ひかる",
-        "ひかん",
-        "ひくい",
-        "ひけつ",
-        "ひこうき",
-        "ひこく",
-        "ひさい",
-        "ひさしぶり",
-        "ひさん",
-        "びじゅつかん",
-        "ひしょ",
-        "ひそか",
-        "ひそむ",
-        "ひたむき",
-        "ひだり",
-        "ひたる",
-        "ひつぎ",
-        "ひっこし",
-        "ひっし",
-        "ひつじゅひん",
-        "ひっす",
-        "ひつぜん",
-        "ぴったり",
-        "ぴっちり",
-        "ひつよう",
-        "ひてい",
-        "ひとごみ",
-        "ひなまつり",
-        "ひなん",
-        "ひねる",
-        "ひはん",
-        "ひびく",
-        "ひひょう",
-        "ひほう",
-        "ひまわり",
-        "ひまん",
-        "ひみつ",
-        "ひめい",
-        "ひめじし",
-        "ひやけ",
-        "ひやす",
-        "ひよう",
-        "びょうき",
-        "ひらがな",
-        "ひらく",
-        "ひりつ",
-        "ひりょう",
-        "ひるま",
-        "ひるやすみ",
-        "ひれい",
-        "ひろい",
-        "ひろう",
-        "ひろき",
-        "ひろゆき",
-        "ひんかく",
-        "ひんけつ",
-        "ひんこん",
-        "ひんしゅ",
-        "ひんそう",
-        "ぴんち",
-        "ひんぱん",
-        "びんぼう",
-        "ふあん",
-        "ふいうち",
-        "ふうけい",
-        "ふうせん",
-        "ぷうたろう",
-        "ふうとう",
-        "ふうふ",
-        "ふえる",
-        "ふおん",
-        "ふかい",
-        "ふきん",
-        "ふくざつ",
-        "ふくぶくろ",
-        "ふこう",
-        "ふさい",
-        "ふしぎ",
-        "ふじみ",
-        "ふすま",
-        "ふせい",
-        "ふせぐ",
-        "ふそく",
-        "ぶたにく",
-        "ふたん",
-        "ふちょう",
-        "ふつう",
-        "ふつか",
-        "ふっかつ",
-        "ふっき",
-        "ふっこく",
-        "ぶどう",
-        "ふとる",
-        "ふとん",
-        "ふのう",
-        "ふはい",
-        "ふひょう",
-        "ふへん",
-        "ふまん",
-        "ふみん",
-        "ふめつ",
-        "ふめん",
-        "ふよう",
-        "ふりこ",
-        "ふりる",
-        "ふるい",
-        "ふんいき",
-        "ぶんがく",
-        "ぶんぐ",
-        "ふんしつ",
-        "ぶんせき",
-        "ふんそう",
-        "ぶんぽう",
-        "へいあん",
-        "へいおん",
-        "へいがい",
-        "へいき",
-        "へいげん",
-        "へいこう",
-        "へいさ",
-        "へいしゃ",
-        "へいせつ",
-        "へいそ",
-        "へいたく",
-        "へいてん",
-        "へいねつ",
-        "へいわ",
-        "へきが",
-        "へこむ",
-        "べにいろ",
-        "べにしょうが",
-        "へらす",
-        "へんかん",
-        "べんきょう",
-        "べんごし",
-        "へんさい",
-        "へんたい",
-        "べんり",
-        "ほあん",
-        "ほいく",
-        "ぼうぎょ",
-        "ほうこく",
-        "ほうそう",
-        "ほうほう",
-        "ほうもん",
-        "ほうりつ",
-        "ほえる",
-        "ほおん",
-        "ほかん",
-        "ほきょう",
-        "ぼきん",
-        "ほくろ",
-        "ほけつ",
-        "ほけん",
-        "ほこう",
-        "ほこる",
-        "ほしい",
-        "ほしつ",
-        "ほしゅ",
-        "ほしょう",
-        "ほせい",
-        "ほそい",
-        "ほそく",
-        "ほたて",
-        "ほたる",
-        "ぽちぶくろ",
-        "ほっきょく",
-        "ほっさ",
-        "ほったん",
-        "ほとんど",
-        "ほめる",
-        "ほんい",
-        "ほんき",
-        "ほんけ",
-        "ほんしつ",
-        "ほんやく",
-        "まいにち",
-        "まかい",
-        "まかせる",
-        "まがる",
-        "まける",
-        "まこと",
-        "まさつ",
-        "まじめ",
-        "ますく",
-        "まぜる",
-        "まつり",
-        "まとめ",
-        "まなぶ",
-        "まぬけ",
-        "まねく",
-        "まほう",
-        "まもる",
-        "まゆげ",
-        "まよう",
-        "まろやか",
-        "まわす",
-        "まわり",
-        "まわる",
-        "まんが",
-        "まんきつ",
-        "まんぞく",
-        "まんなか",
-        "みいら",
-        "みうち",
-        "みえる",
-        "みがく",
-        "みかた",
-        "みかん",
-        "みけん",
-        "みこん",
-        "みじかい",
-        "みすい",
-        "みすえる",
-        "みせる",
-        "みっか",
-        "みつかる",
-        "みつける",
-        "みてい",
-        "みとめる",
-        "みなと",
-        "みなみかさい",
-        "みねらる",
-        "みのう",
-        "みのがす",
-        "みほん",
-        "みもと",
-        "みやげ",
-        "みらい",
-        "みりょく",
-        "みわく",
-        "みんか",
-        "みんぞく",
-        "むいか",
-        "むえき",
-        "むえん",
-        "むかい",
-        "むかう",
-        "むかえ",
-        "むかし",
-        "むぎちゃ",
-        "むける",
-        "むげん",
-        "むさぼる",
-        "むしあつい",
-        "むしば",
-        "むじゅん",
-        "むしろ",
-        "むすう",
-        "むすこ",
-        "むすぶ",
-        "むすめ",
-        "むせる",
-        "むせん",
-        "むちゅう",
-        "むなしい",
-        "むのう",
-        "むやみ",
-        "むよう",
-        "むらさき",
-        "むりょう",
-        "むろん",
-        "めいあん",
-        "めいうん",
-        "めいえん",
-        "めいかく",
-        "めいきょく",
-        "めいさい",
-        "めいし",
-        "めいそう",
-        "めいぶつ",
-        "めいれい",
-        "めいわく",
-        "めぐまれる",
-        "めざす",
-        "めした",
-        "めずらしい",
-        "めだつ",
-        "めまい",
-        "めやす",
-        "めんきょ",
-        "めんせき",
-        "めんどう",
-        "もうしあげる",
-        "もうどうけん",
-        "もえる",
-        "もくし",
-        "もくてき",
-        "もくようび",
-        "もちろん",
-        "もどる",
-        "もらう",
-        "もんく",
-        "もんだい",
-        "やおや",
-        "やける",
-        "やさい",
-        "やさしい",
-        "やすい",
-        "やすたろう",
-        "やすみ",
-        "やせる",
-        "やそう",
-        "やたい",
-        "やちん",
-        "やっと",
-        "やっぱり",
-        "やぶる",
-        "やめる",
-        "ややこしい",
-        "やよい",
-        "やわらかい",
-        "ゆうき",
-        "ゆうびんきょく",
-        "ゆうべ",
-        "ゆうめい",
-        "ゆけつ",
-        "ゆしゅつ",
-        "ゆせん",
-        "ゆそう",
-        "ゆたか",
-        "ゆちゃく",
-        "ゆでる",
-        "ゆにゅう",
-        "ゆびわ",
-        "ゆらい",
-        "ゆれる",
-        "ようい",
-        "ようか",
-        "ようきゅう",
-        "ようじ",
-        "ようす",
-        "ようちえん",
-        "よかぜ",
-        "よかん",
-        "よきん",
-        "よくせい",
-        "よくぼう",
-        "よけい",
-        "よごれる",
-        "よさん",
-        "よしゅう",
-        "よそう",
-        "よそく",
-        "よっか",
-        "よてい",
-        "よどがわく",
-        "よねつ",
-        "よやく",
-        "よゆう",
-        "よろこぶ",
-        "よろしい",
-        "らいう",
-        "らくがき",
-        "らくご",
-        "らくさつ",
-        "らくだ",
-        "らしんばん",
-        "らせん",
-        "らぞく",
-        "らたい",
-        "らっか",
-        "られつ",
-        "りえき",
-        "りかい",
-        "りきさく",
-        "りきせつ",
-        "りくぐん",
-        "りくつ",
-        "りけん",
-        "りこう",
-        "りせい",
-        "りそう",
-        "りそく",
-        "りてん",
-        "りねん",
-        "りゆう",
-        "りゅうがく",
-        "りよう",
-        "りょうり",
-        "りょかん",
-        "りょくちゃ",
-        "りょこう",
-        "りりく",
-        "りれき",
-        "りろん",
-        "りんご",
-        "るいけい",
-        "るいさい",
-        "るいじ",
-        "るいせき",
-        "るすばん",
-        "るりがわら",
-        "れいかん",
-        "れいぎ",
-        "れいせい",
-        "れいぞうこ",
-        "れいとう",
-        "れいぼう",
-        "れきし",
-        "れきだい",
-        "れんあい",
-        "れんけい",
-        "れんこん",
-        "れんさい",
-        "れんしゅう",
-        "れんぞく",
-        "れんらく",
-        "ろうか",
-        "ろうご",
-        "ろうじん",
-        "ろうそく",
-        "ろくが",
-        "ろこつ",
-        "ろじうら",
-        "ろしゅつ",
-        "ろせん",
-        "ろてん",
-        "ろめん",
-        "ろれつ",
-        "ろんぎ",
-        "ろんぱ",
-        "ろんぶん",
-        "ろんり",
-        "わかす",
-        "わかめ",
-        "わかやま",
-        "わかれる",
-        "わしつ",
-        "わじまし",
-        "わすれもの",
-        "わらう",
-        "われる"
-    }
+    0, 19, 32, 42, 55, 71, 81, 94, 104, 120, 130, 140, 153, 166, 179, 189, 199,
+    212, 228, 244, 254, 264, 277, 293, 306, 319, 329, 345, 355, 365, 375, 388,
+    398, 408, 424, 434, 447, 460, 473, 483, 499, 509, 522, 538, 551, 564, 580,
+    593, 606, 616, 629, 639, 652, 665, 678, 691, 704, 714, 724, 734, 747, 760,
+    773, 783, 793, 806, 819, 829, 839, 849, 859, 875, 885, 895, 908, 921, 934,
+    944, 954, 964, 977, 990, 1000, 1010, 1026, 1042, 1052, 1062, 1075, 1085,
+    1098, 1111, 1121, 1131, 1141, 1151, 1167, 1177, 1193, 1206, 1219, 1232,
+    1242, 1255, 1268, 1278, 1288, 1298, 1308, 1318, 1328, 1341, 1351, 1361,
+    1371, 1381, 1391, 1401, 1411, 1421, 1431, 1441, 1451, 1464, 1477, 1487,
+    1500, 1510, 1523, 1533, 1543, 1556, 1569, 1582, 1592, 1605, 1615, 1634,
+    1644, 1654, 1667, 1677, 1690, 1709, 1722, 1738, 1751, 1761, 1771, 1781,
+    1791, 1801, 1814, 1824, 1840, 1853, 1872, 1885, 1898, 1911, 1921, 1934,
+    1944, 1954, 1964, 1977, 1993, 2003, 2013, 2029, 2042, 2052, 2068, 2081,
+    2091, 2104, 2117, 2133, 2149, 2159, 2169, 2179, 2189, 2202, 2212, 2222,
+    2232, 2242, 2255, 2268, 2278, 2288, 2301, 2311, 2327, 2340, 2353, 2366,
+    2379, 2392, 2405, 2418, 2428, 2438, 2448, 2458, 2471, 2484, 2497, 2510,
+    2523, 2533, 2549, 2559, 2572, 2585, 2598, 2608, 2618, 2628, 2638, 2651,
+    2664, 2677, 2687, 2700, 2710, 2726, 2736, 2746, 2756, 2766, 2776, 2786,
+    2796, 2809, 2822, 2832, 2845, 2861, 2874, 2887, 2903, 2916, 2932, 2945,
+    2958, 2971, 2984, 2997, 3007, 3020, 3033, 3046, 3059, 3072, 3082, 3092,
+    3102, 3118, 3128, 3141, 3154, 3164, 3174, 3187, 3200, 3210, 3223, 3239,
+    3255, 3265, 3278, 3288, 3301, 3311, 3324, 3337, 3350, 3363, 3376, 3386,
+    3399, 3412, 3425, 3438, 3451, 3461, 3474, 3487, 3497, 3507, 3520, 3536,
+    3552, 3562, 3578, 3591, 3604, 3620, 3633, 3643, 3656, 3669, 3679, 3692,
+    3705, 3718, 3728, 3741, 3754, 3767, 3780, 3793, 3809, 3825, 3835, 3845,
+    3855, 3868, 3881, 3894, 3907, 3926, 3939, 3955, 3968, 3981, 3994, 4007,
+    4020, 4033, 4046, 4059, 4069, 4079, 4089, 4102, 4112, 4122, 4132, 4142,
+    4155, 4165, 4175, 4185, 4195, 4208, 4224, 4237, 4250, 4266, 4282, 4292,
+    4302, 4312, 4322, 4332, 4342, 4355, 4371, 4381, 4394, 4404, 4414, 4424,
+    4434, 4444, 4454, 4467, 4480, 4493, 4506, 4519, 4529, 4542, 4552, 4562,
+    4572, 4582, 4592, 4602, 4612, 4622, 4632, 4642, 4652, 4662, 4672, 4688,
+    4698, 4711, 4724, 4740, 4750, 4763, 4773, 4783, 4793, 4803, 4816, 4832,
+    4842, 4861, 4880, 4899, 4909, 4919, 4929, 4939, 4949, 4959, 4969, 4982,
+    4995, 5008, 5021, 5034, 5044, 5054, 5064, 5074, 5084, 5094, 5104, 5117,
+    5127, 5137, 5150, 5160, 5173, 5183, 5193, 5203, 5213, 5223, 5233, 5243,
+    5262, 5272, 5288, 5298, 5308, 5318, 5328, 5344, 5354, 5373, 5383, 5393,
+    5403, 5413, 5423, 5433, 5443, 5456, 5469, 5485, 5498, 5514, 5524, 5534,
+    5547, 5557, 5570, 5583, 5596, 5609, 5622, 5635, 5645, 5655, 5668, 5678,
+    5688, 5698, 5708, 5721, 5731, 5744, 5757, 5770, 5786, 5796, 5806, 5822,
+    5835, 5851, 5864, 5877, 5890, 5903, 5916, 5932, 5942, 5952, 5965, 5975,
+    5985, 6001, 6017, 6027, 6043, 6053, 6066, 6076, 6086, 6096, 6109, 6122,
+    6138, 6151, 6161, 6171, 6184, 6197, 6207, 6220, 6236, 6249, 6268, 6281,
+    6291, 6304, 6320, 6330, 6343, 6356, 6369, 6382, 6392, 6405, 6415, 6434,
+    6444, 6454, 6464, 6474, 6487, 6500, 6510, 6520, 6536, 6549, 6562, 6572,
+    6585, 6598, 6611, 6624, 6637, 6650, 6666, 6679, 6692, 6702, 6715, 6725,
+    6735, 6745, 6755, 6765, 6775, 6785, 6795, 6805, 6818, 6828, 6838, 6851,
+    6861, 6871, 6881, 6891, 6904, 6917, 6927, 6940, 6950, 6960, 6970, 6983,
+    6996, 7009, 7025, 7038, 7051, 7064, 7077, 7090, 7103, 7116, 7129, 7139,
+    7152, 7165, 7178, 7188, 7201, 7211, 7224, 7234, 7247, 7260, 7273, 7289,
+    7302, 7315, 7328, 7338, 7351, 7364, 7377, 7390, 7403, 7416, 7429, 7442,
+    7455, 7468, 7481, 7494, 7507, 7520, 7530, 7540, 7550, 7560, 7570, 7580,
+    7593, 7606, 7619, 7632, 7642, 7652, 7662, 7675, 7685, 7695, 7705, 7715,
+    7725, 7735, 7745, 7758, 7768, 7781, 7791, 7804, 7814, 7827, 7840, 7850,
+    7860, 7870, 7883, 7893, 7903, 7913, 7926, 7939, 7952, 7962, 7972, 7982,
+    7995, 8005, 8015, 8028, 8044, 8057, 8070, 8083, 8093, 8106, 8116, 8126,
+    8136, 8146, 8156, 8166, 8176, 8186, 8196, 8206, 8216, 8235, 8248, 8261,
+    8274, 8287, 8300, 8310, 8326, 8339, 8352, 8365, 8378, 8391, 8404, 8417,
+    8427, 8440, 8453, 8466, 8479, 8492, 8505, 8515, 8528, 8541, 8554, 8570,
+    8583, 8599, 8609, 8622, 8632, 8642, 8655, 8665, 8678, 8688, 8701, 8711,
+    8721, 8731, 8744, 8754, 8764, 8777, 8790, 8800, 8813, 8829, 8839, 8852,
+    8865, 8878, 8894, 8904, 8917, 8927, 8940, 8950, 8960, 8970, 8980, 8993,
+    9003, 9013, 9023, 9033, 9046, 9059, 9069, 9079, 9098, 9108, 9118, 9128,
+    9138, 9151, 9164, 9174, 9187, 9197, 9213, 9226, 9239, 9252, 9265, 9278,
+    9288, 9298, 9308, 9318, 9331, 9341, 9351, 9367, 9380, 9390, 9400, 9410,
+    9420, 9430, 9440, 9450, 9460, 9470, 9480, 9490, 9503, 9513, 9523, 9533,
+    9546, 9559, 9572, 9582, 9595, 9605, 9615, 9625, 9635, 9645, 9658, 9671,
+    9681, 9691, 9701, 9711, 9721, 9731, 9744, 9754, 9767, 9777, 9790, 9800,
+    9810, 9820, 9830, 9840, 9850, 9860, 9870, 9883, 9896, 9906, 9916, 9926,
+    9939, 9952, 9965, 9981, 9997, 10013, 10026, 10036, 10049, 10062, 10075,
+    10088, 10101, 10117, 10133, 10143, 10156, 10169, 10179, 10195, 10211,
+    10224, 10240, 10250, 10263, 10279, 10295, 10311, 10327, 10340, 10353,
+    10366, 10379, 10389, 10402, 10415, 10431, 10444, 10457, 10467, 10477,
+    10487, 10497, 10510, 10520, 10533, 10546, 10562, 10575, 10588, 10601,
+    10614, 10624, 10634, 10647, 10657, 10667, 10677, 10687, 10700, 10710,
+    10723, 10736, 10749, 10759, 10769, 10779, 10789, 10799, 10809, 10825,
+    10838, 10851, 10861, 10871, 10881, 10891, 10901, 10911, 10921, 10931,
+    10941, 10951, 10964, 10974, 10990, 11003, 11013, 11026, 11039, 11052,
+    11065, 11078, 11088, 11101, 11111, 11127, 11140, 11150, 11160, 11179,
+    11189, 11199, 11209, 11219, 11229, 11242, 11258, 11268, 11281, 11294,
+    11313, 11326, 11339, 11352, 11365, 11375, 11388, 11401, 11414, 11424,
+    11434, 11444, 11454, 11464, 11474, 11484, 11494, 11507, 11517, 11530,
+    11540, 11553, 11563, 11576, 11586, 11599, 11609, 11622, 11635, 11648,
+    11661, 11671, 11684, 11700, 11713, 11726, 11739, 11752, 11765, 11775,
+    11788, 11798, 11817, 11830, 11843, 11856, 11869, 11879, 11895, 11908,
+    11918, 11928, 11944, 11954, 11976, 11986, 11996, 12009, 12022, 12035,
+    12045, 12058, 12068, 12081, 12091, 12101, 12111, 12121, 12134, 12144,
+    12154, 12164, 12174, 12184, 12197, 12207, 12220, 12233, 12249, 12262,
+    12275, 12288, 12298, 12311, 12324, 12337, 12347, 12357, 12367, 12377,
+    12387, 12397, 12407, 12420, 12430, 12443, 12456, 12469, 12479, 12492,
+    12505, 12518, 12531, 12544, 12560, 12570, 12583, 12596, 12606, 12619,
+    12632, 12645, 12658, 12671, 12681, 12694, 12707, 12717, 12730, 12749,
+    12762, 12775, 12788, 12801, 12817, 12830, 12846, 12859, 12872, 12885,
+    12898, 12914, 12927, 12940, 12950, 12969, 12985, 12995, 13008, 13021,
+    13034, 13044, 13060, 13070, 13083, 13093, 13103, 13113, 13123, 13136,
+    13146, 13156, 13166, 13179, 13189, 13202, 13212, 13225, 13238, 13251,
+    13267, 13280, 13293, 13303, 13316, 13326, 13339, 13352, 13368, 13378,
+    13394, 13407, 13417, 13430, 13443, 13453, 13463, 13476, 13486, 13496,
+    13506, 13516, 13526, 13536, 13546, 13559, 13569, 13579, 13589, 13602,
+    13612, 13622, 13644, 13657, 13667, 13677, 13687, 13700, 13713, 13729,
+    13742, 13752, 13765, 13775, 13785, 13798, 13808, 13821, 13840, 13853,
+    13866, 13879, 13889, 13902, 13915, 13925, 13938, 13951, 13964, 13977,
+    13990, 14003, 14016, 14029, 14039, 14049, 14059, 14069, 14079, 14092,
+    14102, 14112, 14122, 14135, 14145, 14158, 14168, 14178, 14188, 14198,
+    14214, 14224, 14234, 14244, 14254, 14267, 14280, 14290, 14300, 14310,
+    14320, 14330, 14343, 14359, 14369, 14379, 14389, 14402, 14415, 14434,
+    14447, 14463, 14476, 14495, 14505, 14515, 14528, 14541, 14551, 14561,
+    14574, 14587, 14597, 14610, 14620, 14636, 14649, 14659, 14669, 14682,
+    14692, 14702, 14712, 14722, 14732, 14745, 14755, 14765, 14775, 14788,
+    14801, 14811, 14824, 14834, 14844, 14860, 14870, 14880, 14893, 14903,
+    14913, 14923, 14933, 14946, 14959, 14969, 14979, 14989, 14999, 15012,
+    15022, 15032, 15045, 15058, 15071, 15081, 15094, 15107, 15117, 15130,
+    15146, 15159, 15172, 15182, 15195, 15208, 15218, 15231, 15247, 15257,
+    15267, 15277, 15290, 15303, 15316, 15329, 15339, 15352, 15362, 15375,
+    15385, 15398, 15411, 15421, 15434, 15444, 15457, 15467, 15477, 15493,
+    15506, 15519, 15529, 15539, 15549, 15562, 15575, 15588, 15601, 15611,
+    15621, 15634, 15647, 15660, 15670, 15683, 15693, 15706, 15719, 15732,
+    15745, 15764, 15777, 15796, 15812, 15822, 15832, 15842, 15855, 15871,
+    15881, 15891, 15904, 15914, 15924, 15934, 15944, 15954, 15964, 15974,
+    15987, 16000, 16010, 16026, 16039, 16049, 16062, 16072, 16082, 16092,
+    16102, 16118, 16128, 16138, 16151, 16167, 16180, 16193, 16209, 16222,
+    16238, 16248, 16261, 16271, 16284, 16294, 16307, 16317, 16327, 16337,
+    16350, 16360, 16373, 16386, 16399, 16412, 16425, 16438, 16451, 16461,
+    16474, 16487, 16497, 16507, 16517, 16527, 16540, 16550, 16566, 16579,
+    16595, 16608, 16621, 16634, 16644, 16654, 16664, 16677, 16687, 16697,
+    16707, 16720, 16730, 16740, 16750, 16760, 16770, 16780, 16793, 16806,
+    16816, 16829, 16839, 16849, 16859, 16869, 16879, 16892, 16905, 16915,
+    16937, 16947, 16960, 16976, 16992, 17002, 17012, 17025, 17038, 17051,
+    17067, 17080, 17093, 17106, 17116, 17126, 17136, 17146, 17156, 17172,
+    17188, 17201, 17211, 17221, 17231, 17244, 17257, 17270, 17283, 17296,
+    17306, 17319, 17332, 17342, 17355, 17365, 17378, 17391, 17404, 17414,
+    17430, 17440, 17453, 17463, 17476, 17486, 17496, 17512, 17522, 17532,
+    17542, 17552, 17562, 17575, 17585, 17595, 17605, 17615, 17628, 17641,
+    17651, 17661, 17674, 17687, 17706, 17719, 17729, 17739, 17758, 17768,
+    17781, 17791, 17801, 17814, 17824, 17834, 17844, 17857, 17870, 17883,
+    17896, 17906, 17916, 17926, 17942, 17952, 17962, 17975, 17988, 18004,
+    18017, 18027, 18040, 18050, 18063, 18076, 18086, 18096, 18106, 18116,
+    18126, 18139, 18152, 18162, 18172, 18182, 18192, 18202, 18215, 18225,
+    18238, 18251, 18264, 18277, 18287, 18297, 18307, 18317, 18330, 18340,
+    18350, 18363, 18373, 18386, 18399, 18412, 18425, 18435, 18448, 18461,
+    18471, 18481, 18491, 18501, 18511, 18524, 18534, 18544, 18554, 18564,
+    18574, 18584, 18594, 18604, 18617, 18627, 18637, 18650, 18663, 18676,
+    18686, 18699, 18712, 18725, 18738, 18751, 18764, 18777, 18793, 18806,
+    18822, 18835, 18845, 18855, 18868, 18881, 18894, 18907, 18917, 18927,
+    18937, 18947, 18963, 18973, 18983, 18996, 19009, 19022, 19038, 19051,
+    19061, 19074, 19087, 19100, 19110, 19120, 19133, 19146, 19159, 19169,
+    19182, 19195, 19211, 19224, 19237, 19250, 19260, 19270, 19280, 19290,
+    19300, 19310, 19320, 19330, 19340, 19353, 19363, 19373, 19389, 19399,
+    19418, 19428, 19438, 19448, 19461, 19471, 19481, 19491, 19504, 19514,
+    19533, 19543, 19556, 19569, 19582, 19595, 19605, 19618, 19634, 19644,
+    19654, 19664, 19674, 19687, 19697, 19710, 19720, 19730, 19740, 19753,
+    19763, 19773, 19783, 19796, 19809, 19819, 19829, 19842, 19852, 19868,
+    19878, 19888, 19898, 19908, 19921, 19934, 19947, 19960, 19973, 19986,
+    19996, 20009, 20022, 20032, 20045, 20058, 20071, 20087, 20100, 20110,
+    20120, 20130, 20140, 20150, 20163, 20179, 20189, 20199, 20209, 20219,
+    20229, 20239, 20249, 20259, 20272, 20282, 20295, 20305, 20315, 20328,
+    20338, 20351, 20361, 20371, 20381, 20391, 20401, 20414, 20424, 20434,
+    20444, 20454, 20464, 20474, 20484, 20494, 20504, 20517, 20530, 20540,
+    20553, 20566, 20579, 20592, 20605, 20618, 20631, 20641, 20654, 20667,
+    20677, 20690, 20703, 20713, 20726, 20739, 20752, 20762, 20772, 20782,
+    20795, 20814, 20824, 20837, 20853, 20866, 20879, 20892, 20902, 20912,
+    20922, 20935, 20948, 20961, 20974, 20987, 21000, 21010, 21020, 21030,
+    21043, 21053, 21063, 21073, 21083, 21093, 21103, 21113, 21123, 21133,
+    21146, 21156, 21166, 21176, 21186, 21196, 21212, 21228, 21238, 21251,
+    21264, 21274, 21284, 21294, 21304, 21317, 21330, 21343, 21353, 21366,
+    21376, 21386, 21396, 21406, 21416, 21426, 21436, 21446, 21456, 21466,
+    21476, 21486, 21496, 21506, 21516, 21526, 21539, 21549, 21559, 21569,
+    21579, 21592, 21605, 21618, 21628, 21638, 21648, 21658, 21668, 21678,
+    21688, 21698, 21711, 21721, 21734, 21744, 21754, 21767, 21780, 21790,
+    21803, 21813, 21832, 21845, 21855, 21868, 21878, 21888, 21898, 21908,
+    21921, 21931, 21941, 21954, 21964, 21974, 21984, 21994, 22004, 22014,
+    22024, 22037, 22047, 22057, 22070, 22086, 22096, 22109, 22119, 22129,
+    22139, 22149, 22159, 22169, 22179, 22192, 22205, 22215, 22225, 22235,
+    22248, 22261, 22271, 22284, 22297, 22310, 22323, 22339, 22352, 22362,
+    22375, 22388, 22401, 22414, 22430, 22440, 22450, 22466, 22476, 22486,
+    22496, 22509, 22522, 22535, 22554, 22573, 22583, 22593, 22606, 22622,
+    22635, 22645, 22655, 22665, 22678, 22688, 22698, 22708, 22721, 22731,
+    22747, 22757, 22767, 22777, 22787, 22797, 22807, 22820, 22830, 22840,
+    22856, 22866, 22882, 22892, 22914, 22924, 22937, 22947, 22960, 22970,
+    22980, 22990, 23003, 23013, 23026, 23036, 23046, 23056, 23066, 23076,
+    23092, 23102, 23112, 23128, 23138, 23148, 23158, 23171, 23184, 23194,
+    23207, 23217, 23230, 23240, 23250, 23260, 23270, 23286, 23296, 23306,
+    23316, 23329, 23342, 23352, 23365, 23375, 23388, 23398, 23414, 23424,
+    23434, 23444, 23454, 23464, 23474, 23484, 23497, 23510, 23523, 23533,
+    23543, 23553, 23563, 23573, 23583, 23593, 23603, 23613, 23629, 23639,
+    23652, 23665, 23681, 23694, 23704, 23714, 23724, 23734, 23747, 23760,
+    23770, 23783, 23796, 23812, 23825, 23835, 23848, 23864, 23877, 23890,
+    23900, 23913, 23926, 23939, 23952, 23965, 23981, 23994, 24007, 24017,
+    24027, 24040, 24053, 24063, 24073, 24086, 24099, 24109, 24119, 24129,
+    24139, 24149, 24159, 24172, 24182, 24192, 24202, 24215, 24228, 24238,
+    24251, 24267, 24277
 };
 
-const dictionary it =
+const dictionary ja{ ja_words, ja_offsets };
+
+static const char it_words[] =
+    "abaco\0"
+    "abbaglio\0"
+    "abbinato\0"
+    "abete\0"
+    "abisso\0"
+    "abolire\0"
+    "abrasivo\0"
+    "abrogato\0"
+    "accadere\0"
+    "accenno\0"
+    "accusato\0"
+    "acetone\0"
+    "achille\0"
+    "acido\0"
+    "acqua\0"
+    "acre\0"
+    "acrilico\0"
+    "acrobata\0"
+    "acuto\0"
+    "adagio\0"
+    "addebito\0"
+    "addome\0"
+    "adeguato\0"
+    "aderire\0"
+    "adipe\0"
+    "adottare\0"
+    "adulare\0"
+    "affabile\0"
+    "affetto\0"
+    "affisso\0"
+    "affranto\0"
+    "aforisma\0"
+    "afoso\0"
+    "africano\0"
+    "agave\0"
+    "agente\0"
+    "agevole\0"
+    "aggancio\0"
+    "agire\0"
+    "agitare\0"
+    "agonismo\0"
+    "agricolo\0"
+    "agrumeto\0"
+    "aguzzo\0"
+    "alabarda\0"
+    "alato\0"
+    "albatro\0"
+    "alberato\0"
+    "albo\0"
+    "albume\0"
+    "alce\0"
+    "alcolico\0"
+    "alettone\0"
+    "alfa\0"
+    "algebra\0"
+    "aliante\0"
+    "alibi\0"
+    "alimento\0"
+    "allagato\0"
+    "allegro\0"
+    "allievo\0"
+    "allodola\0"
+    "allusivo\0"
+    "almeno\0"
+    "alogeno\0"
+    "alpaca\0"
+    "alpestre\0"
+    "altalena\0"
+    "alterno\0"
+    "alticcio\0"
+    "altrove\0"
+    "alunno\0"
+    "alveolo\0"
+    "alzare\0"
+    "amalgama\0"
+    "amanita\0"
+    "amarena\0"
+    "ambito\0"
+    "ambrato\0"
+    "ameba\0"
+    "america\0"
+    "ametista\0"
+    "amico\0"
+    "ammasso\0"
+    "ammenda\0"
+    "ammirare\0"
+    "ammonito\0"
+    "amore\0"
+    "ampio\0"
+    "ampliare\0"
+    "amuleto\0"
+    "anacardo\0"
+    "anagrafe\0"
+    "analista\0"
+    "anarchia\0"
+    "anatra\0"
+    "anca\0"
+    "ancella\0"
+    "ancora\0"
+    "andare\0"
+    "andrea\0"
+    "anello\0"
+    "angelo\0"
+    "angolare\0"
+    "angusto\0"
+    "anima\0"
+    "annegare\0"
+    "annidato\0"
+    "anno\0"
+    "annuncio\0"
+    "anonimo\0"
+    "anticipo\0"
+    "anzi\0"
+    "apatico\0"
+    "apertura\0"
+    "apode\0"
+    "apparire\0"
+    "appetito\0"
+    "appoggio\0"
+    "approdo\0"
+    "appunto\0"
+    "aprile\0"
+    "arabica\0"
+    "arachide\0"
+    "aragosta\0"
+    "araldica\0"
+    "arancio\0"
+    "aratura\0"
+    "arazzo\0"
+    "arbitro\0"
+    "archivio\0"
+    "ardito\0"
+    "arenile\0"
+    "argento\0"
+    "argine\0"
+    "arguto\0"
+    "aria\0"
+    "armonia\0"
+    "arnese\0"
+    "arredato\0"
+    "arringa\0"
+    "arrosto\0"
+    "arsenico\0"
+    "arso\0"
+    "artefice\0"
+    "arzillo\0"
+    "asciutto\0"
+    "ascolto\0"
+    "asepsi\0"
+    "asettico\0"
+    "asfalto\0"
+    "asino\0"
+    "asola\0"
+    "aspirato\0"
+    "aspro\0"
+    "assaggio\0"
+    "asse\0"
+    "assoluto\0"
+    "assurdo\0"
+    "asta\0"
+    "astenuto\0"
+    "astice\0"
+    "astratto\0"
+    "atavico\0"
+    "ateismo\0"
+    "atomico\0"
+    "atono\0"
+    "attesa\0"
+    "attivare\0"
+    "attorno\0"
+    "attrito\0"
+    "attuale\0"
+    "ausilio\0"
+    "austria\0"
+    "autista\0"
+    "autonomo\0"
+    "autunno\0"
+    "avanzato\0"
+    "avere\0"
+    "avvenire\0"
+    "avviso\0"
+    "avvolgere\0"
+    "azione\0"
+    "azoto\0"
+    "azzimo\0"
+    "azzurro\0"
+    "babele\0"
+    "baccano\0"
+    "bacino\0"
+    "baco\0"
+    "badessa\0"
+    "badilata\0"
+    "bagnato\0"
+    "baita\0"
+    "balcone\0"
+    "baldo\0"
+    "balena\0"
+    "ballata\0"
+    "balzano\0"
+    "bambino\0"
+    "bandire\0"
+    "baraonda\0"
+    "barbaro\0"
+    "barca\0"
+    "baritono\0"
+    "barlume\0"
+    "barocco\0"
+    "basilico\0"
+    "basso\0"
+    "batosta\0"
+    "battuto\0"
+    "baule\0"
+    "bava\0"
+    "bavosa\0"
+    "becco\0"
+    "beffa\0"
+    "belgio\0"
+    "belva\0"
+    "benda\0"
+    "benevole\0"
+    "benigno\0"
+    "benzina\0"
+    "bere\0"
+    "berlina\0"
+    "beta\0"
+    "bibita\0"
+    "bici\0"
+    "bidone\0"
+    "bifido\0"
+    "biga\0"
+    "bilancia\0"
+    "bimbo\0"
+    "binocolo\0"
+    "biologo\0"
+    "bipede\0"
+    "bipolare\0"
+    "birbante\0"
+    "birra\0"
+    "biscotto\0"
+    "bisesto\0"
+    "bisnonno\0"
+    "bisonte\0"
+    "bisturi\0"
+    "bizzarro\0"
+    "blando\0"
+    "blatta\0"
+    "bollito\0"
+    "bonifico\0"
+    "bordo\0"
+    "bosco\0"
+    "botanico\0"
+    "bottino\0"
+    "bozzolo\0"
+    "braccio\0"
+    "bradipo\0"
+    "brama\0"
+    "branca\0"
+    "bravura\0"
+    "bretella\0"
+    "brevetto\0"
+    "brezza\0"
+    "briglia\0"
+    "brillante\0"
+    "brindare\0"
+    "broccolo\0"
+    "brodo\0"
+    "bronzina\0"
+    "brullo\0"
+    "bruno\0"
+    "bubbone\0"
+    "buca\0"
+    "budino\0"
+    "buffone\0"
+    "buio\0"
+    "bulbo\0"
+    "buono\0"
+    "burlone\0"
+    "burrasca\0"
+    "bussola\0"
+    "busta\0"
+    "cadetto\0"
+    "caduco\0"
+    "calamaro\0"
+    "calcolo\0"
+    "calesse\0"
+    "calibro\0"
+    "calmo\0"
+    "caloria\0"
+    "cambusa\0"
+    "camerata\0"
+    "camicia\0"
+    "cammino\0"
+    "camola\0"
+    "campale\0"
+    "canapa\0"
+    "candela\0"
+    "cane\0"
+    "canino\0"
+    "canotto\0"
+    "cantina\0"
+    "capace\0"
+    "capello\0"
+    "capitolo\0"
+    "capogiro\0"
+    "cappero\0"
+    "capra\0"
+    "capsula\0"
+    "carapace\0"
+    "carcassa\0"
+    "cardo\0"
+    "carisma\0"
+    "carovana\0"
+    "carretto\0"
+    "cartolina\0"
+    "casaccio\0"
+    "cascata\0"
+    "caserma\0"
+    "caso\0"
+    "cassone\0"
+    "castello\0"
+    "casuale\0"
+    "catasta\0"
+    "catena\0"
+    "catrame\0"
+    "cauto\0"
+    "cavillo\0"
+    "cedibile\0"
+    "cedrata\0"
+    "cefalo\0"
+    "celebre\0"
+    "cellulare\0"
+    "cena\0"
+    "cenone\0"
+    "centesimo\0"
+    "ceramica\0"
+    "cercare\0"
+    "certo\0"
+    "cerume\0"
+    "cervello\0"
+    "cesoia\0"
+    "cespo\0"
+    "ceto\0"
+    "chela\0"
+    "chiaro\0"
+    "chicca\0"
+    "chiedere\0"
+    "chimera\0"
+    "china\0"
+    "chirurgo\0"
+    "chitarra\0"
+    "ciao\0"
+    "ciclismo\0"
+    "cifrare\0"
+    "cigno\0"
+    "cilindro\0"
+    "ciottolo\0"
+    "circa\0"
+    "cirrosi\0"
+    "citrico\0"
+    "cittadino\0"
+    "ciuffo\0"
+    "civetta\0"
+    "civile\0"
+    "classico\0"
+    "clinica\0"
+    "cloro\0"
+    "cocco\0"
+    "codardo\0"
+    "codice\0"
+    "coerente\0"
+    "cognome\0"
+    "collare\0"
+    "colmato\0"
+    "colore\0"
+    "colposo\0"
+    "coltivato\0"
+    "colza\0"
+    "coma\0"
+    "cometa\0"
+    "commando\0"
+    "comodo\0"
+    "computer\0"
+    "comune\0"
+    "conciso\0"
+    "condurre\0"
+    "conferma\0"
+    "congelare\0"
+    "coniuge\0"
+    "connesso\0"
+    "conoscere\0"
+    "consumo\0"
+    "continuo\0"
+    "convegno\0"
+    "coperto\0"
+    "copione\0"
+    "coppia\0"
+    "copricapo\0"
+    "corazza\0"
+    "cordata\0"
+    "coricato\0"
+    "cornice\0"
+    "corolla\0"
+    "corpo\0"
+    "corredo\0"
+    "corsia\0"
+    "cortese\0"
+    "cosmico\0"
+    "costante\0"
+    "cottura\0"
+    "covato\0"
+    "cratere\0"
+    "cravatta\0"
+    "creato\0"
+    "credere\0"
+    "cremoso\0"
+    "crescita\0"
+    "creta\0"
+    "criceto\0"
+    "crinale\0"
+    "crisi\0"
+    "critico\0"
+    "croce\0"
+    "cronaca\0"
+    "crostata\0"
+    "cruciale\0"
+    "crusca\0"
+    "cucire\0"
+    "cuculo\0"
+    "cugino\0"
+    "cullato\0"
+    "cupola\0"
+    "curatore\0"
+    "cursore\0"
+    "curvo\0"
+    "cuscino\0"
+    "custode\0"
+    "dado\0"
+    "daino\0"
+    "dalmata\0"
+    "damerino\0"
+    "daniela\0"
+    "dannoso\0"
+    "danzare\0"
+    "datato\0"
+    "davanti\0"
+    "davvero\0"
+    "debutto\0"
+    "decennio\0"
+    "deciso\0"
+    "declino\0"
+    "decollo\0"
+    "decreto\0"
+    "dedicato\0"
+    "definito\0"
+    "deforme\0"
+    "degno\0"
+    "delegare\0"
+    "delfino\0"
+    "delirio\0"
+    "delta\0"
+    "demenza\0"
+    "denotato\0"
+    "dentro\0"
+    "deposito\0"
+    "derapata\0"
+    "derivare\0"
+    "deroga\0"
+    "descritto\0"
+    "deserto\0"
+    "desiderio\0"
+    "desumere\0"
+    "detersivo\0"
+    "devoto\0"
+    "diametro\0"
+    "dicembre\0"
+    "diedro\0"
+    "difeso\0"
+    "diffuso\0"
+    "digerire\0"
+    "digitale\0"
+    "diluvio\0"
+    "dinamico\0"
+    "dinnanzi\0"
+    "dipinto\0"
+    "diploma\0"
+    "dipolo\0"
+    "diradare\0"
+    "dire\0"
+    "dirotto\0"
+    "dirupo\0"
+    "disagio\0"
+    "discreto\0"
+    "disfare\0"
+    "disgelo\0"
+    "disposto\0"
+    "distanza\0"
+    "disumano\0"
+    "dito\0"
+    "divano\0"
+    "divelto\0"
+    "dividere\0"
+    "divorato\0"
+    "doblone\0"
+    "docente\0"
+    "doganale\0"
+    "dogma\0"
+    "dolce\0"
+    "domato\0"
+    "domenica\0"
+    "dominare\0"
+    "dondolo\0"
+    "dono\0"
+    "dormire\0"
+    "dote\0"
+    "dottore\0"
+    "dovuto\0"
+    "dozzina\0"
+    "drago\0"
+    "druido\0"
+    "dubbio\0"
+    "dubitare\0"
+    "ducale\0"
+    "duna\0"
+    "duomo\0"
+    "duplice\0"
+    "duraturo\0"
+    "ebano\0"
+    "eccesso\0"
+    "ecco\0"
+    "eclissi\0"
+    "economia\0"
+    "edera\0"
+    "edicola\0"
+    "edile\0"
+    "editoria\0"
+    "educare\0"
+    "egemonia\0"
+    "egli\0"
+    "egoismo\0"
+    "egregio\0"
+    "elaborato\0"
+    "elargire\0"
+    "elegante\0"
+    "elencato\0"
+    "eletto\0"
+    "elevare\0"
+    "elfico\0"
+    "elica\0"
+    "elmo\0"
+    "elsa\0"
+    "eluso\0"
+    "emanato\0"
+    "emblema\0"
+    "emesso\0"
+    "emiro\0"
+    "emotivo\0"
+    "emozione\0"
+    "empirico\0"
+    "emulo\0"
+    "endemico\0"
+    "enduro\0"
+    "energia\0"
+    "enfasi\0"
+    "enoteca\0"
+    "entrare\0"
+    "enzima\0"
+    "epatite\0"
+    "epilogo\0"
+    "episodio\0"
+    "epocale\0"
+    "eppure\0"
+    "equatore\0"
+    "erario\0"
+    "erba\0"
+    "erboso\0"
+    "erede\0"
+    "eremita\0"
+    "erigere\0"
+    "ermetico\0"
+    "eroe\0"
+    "erosivo\0"
+    "errante\0"
+    "esagono\0"
+    "esame\0"
+    "esanime\0"
+    "esaudire\0"
+    "esca\0"
+    "esempio\0"
+    "esercito\0"
+    "esibito\0"
+    "esigente\0"
+    "esistere\0"
+    "esito\0"
+    "esofago\0"
+    "esortato\0"
+    "esoso\0"
+    "espanso\0"
+    "espresso\0"
+    "essenza\0"
+    "esso\0"
+    "esteso\0"
+    "estimare\0"
+    "estonia\0"
+    "estroso\0"
+    "esultare\0"
+    "etilico\0"
+    "etnico\0"
+    "etrusco\0"
+    "etto\0"
+    "euclideo\0"
+    "europa\0"
+    "evaso\0"
+    "evidenza\0"
+    "evitato\0"
+    "evoluto\0"
+    "evviva\0"
+    "fabbrica\0"
+    "faccenda\0"
+    "fachiro\0"
+    "falco\0"
+    "famiglia\0"
+    "fanale\0"
+    "fanfara\0"
+    "fango\0"
+    "fantasma\0"
+    "fare\0"
+    "farfalla\0"
+    "farinoso\0"
+    "farmaco\0"
+    "fascia\0"
+    "fastoso\0"
+    "fasullo\0"
+    "faticare\0"
+    "fato\0"
+    "favoloso\0"
+    "febbre\0"
+    "fecola\0"
+    "fede\0"
+    "fegato\0"
+    "felpa\0"
+    "feltro\0"
+    "femmina\0"
+    "fendere\0"
+    "fenomeno\0"
+    "fermento\0"
+    "ferro\0"
+    "fertile\0"
+    "fessura\0"
+    "festivo\0"
+    "fetta\0"
+    "feudo\0"
+    "fiaba\0"
+    "fiducia\0"
+    "fifa\0"
+    "figurato\0"
+    "filo\0"
+    "finanza\0"
+    "finestra\0"
+    "finire\0"
+    "fiore\0"
+    "fiscale\0"
+    "fisico\0"
+    "fiume\0"
+    "flacone\0"
+    "flamenco\0"
+    "flebo\0"
+    "flemma\0"
+    "florido\0"
+    "fluente\0"
+    "fluoro\0"
+    "fobico\0"
+    "focaccia\0"
+    "focoso\0"
+    "foderato\0"
+    "foglio\0"
+    "folata\0"
+    "folclore\0"
+    "folgore\0"
+    "fondente\0"
+    "fonetico\0"
+    "fonia\0"
+    "fontana\0"
+    "forbito\0"
+    "forchetta\0"
+    "foresta\0"
+    "formica\0"
+    "fornaio\0"
+    "foro\0"
+    "fortezza\0"
+    "forzare\0"
+    "fosfato\0"
+    "fosso\0"
+    "fracasso\0"
+    "frana\0"
+    "frassino\0"
+    "fratello\0"
+    "freccetta\0"
+    "frenata\0"
+    "fresco\0"
+    "frigo\0"
+    "frollino\0"
+    "fronde\0"
+    "frugale\0"
+    "frutta\0"
+    "fucilata\0"
+    "fucsia\0"
+    "fuggente\0"
+    "fulmine\0"
+    "fulvo\0"
+    "fumante\0"
+    "fumetto\0"
+    "fumoso\0"
+    "fune\0"
+    "funzione\0"
+    "fuoco\0"
+    "furbo\0"
+    "furgone\0"
+    "furore\0"
+    "fuso\0"
+    "futile\0"
+    "gabbiano\0"
+    "gaffe\0"
+    "galateo\0"
+    "gallina\0"
+    "galoppo\0"
+    "gambero\0"
+    "gamma\0"
+    "garanzia\0"
+    "garbo\0"
+    "garofano\0"
+    "garzone\0"
+    "gasdotto\0"
+    "gasolio\0"
+    "gastrico\0"
+    "gatto\0"
+    "gaudio\0"
+    "gazebo\0"
+    "gazzella\0"
+    "geco\0"
+    "gelatina\0"
+    "gelso\0"
+    "gemello\0"
+    "gemmato\0"
+    "gene\0"
+    "genitore\0"
+    "gennaio\0"
+    "genotipo\0"
+    "gergo\0"
+    "ghepardo\0"
+    "ghiaccio\0"
+    "ghisa\0"
+    "giallo\0"
+    "gilda\0"
+    "ginepro\0"
+    "giocare\0"
+    "gioiello\0"
+    "giorno\0"
+    "giove\0"
+    "girato\0"
+    "girone\0"
+    "gittata\0"
+    "giudizio\0"
+    "giurato\0"
+    "giusto\0"
+    "globulo\0"
+    "glutine\0"
+    "gnomo\0"
+    "gobba\0"
+    "golf\0"
+    "gomito\0"
+    "gommone\0"
+    "gonfio\0"
+    "gonna\0"
+    "governo\0"
+    "gracile\0"
+    "grado\0"
+    "grafico\0"
+    "grammo\0"
+    "grande\0"
+    "grattare\0"
+    "gravoso\0"
+    "grazia\0"
+    "greca\0"
+    "gregge\0"
+    "grifone\0"
+    "grigio\0"
+    "grinza\0"
+    "grotta\0"
+    "gruppo\0"
+    "guadagno\0"
+    "guaio\0"
+    "guanto\0"
+    "guardare\0"
+    "gufo\0"
+    "guidare\0"
+    "ibernato\0"
+    "icona\0"
+    "identico\0"
+    "idillio\0"
+    "idolo\0"
+    "idra\0"
+    "idrico\0"
+    "idrogeno\0"
+    "igiene\0"
+    "ignaro\0"
+    "ignorato\0"
+    "ilare\0"
+    "illeso\0"
+    "illogico\0"
+    "illudere\0"
+    "imballo\0"
+    "imbevuto\0"
+    "imbocco\0"
+    "imbuto\0"
+    "immane\0"
+    "immerso\0"
+    "immolato\0"
+    "impacco\0"
+    "impeto\0"
+    "impiego\0"
+    "importo\0"
+    "impronta\0"
+    "inalare\0"
+    "inarcare\0"
+    "inattivo\0"
+    "incanto\0"
+    "incendio\0"
+    "inchino\0"
+    "incisivo\0"
+    "incluso\0"
+    "incontro\0"
+    "incrocio\0"
+    "incubo\0"
+    "indagine\0"
+    "india\0"
+    "indole\0"
+    "inedito\0"
+    "infatti\0"
+    "infilare\0"
+    "inflitto\0"
+    "ingaggio\0"
+    "ingegno\0"
+    "inglese\0"
+    "ingordo\0"
+    "ingrosso\0"
+    "innesco\0"
+    "inodore\0"
+    "inoltrare\0"
+    "inondato\0"
+    "insano\0"
+    "insetto\0"
+    "insieme\0"
+    "insonnia\0"
+    "insulina\0"
+    "intasato\0"
+    "intero\0"
+    "intonaco\0"
+    "intuito\0"
+    "inumidire\0"
+    "invalido\0"
+    "invece\0"
+    "invito\0"
+    "iperbole\0"
+    "ipnotico\0"
+    "ipotesi\0"
+    "ippica\0"
+    "iride\0"
+    "irlanda\0"
+    "ironico\0"
+    "irrigato\0"
+    "irrorare\0"
+    "isolato\0"
+    "isotopo\0"
+    "isterico\0"
+    "istituto\0"
+    "istrice\0"
+    "italia\0"
+    "iterare\0"
+    "labbro\0"
+    "labirinto\0"
+    "lacca\0"
+    "lacerato\0"
+    "lacrima\0"
+    "lacuna\0"
+    "laddove\0"
+    "lago\0"
+    "lampo\0"
+    "lancetta\0"
+    "lanterna\0"
+    "lardoso\0"
+    "larga\0"
+    "laringe\0"
+    "lastra\0"
+    "latenza\0"
+    "latino\0"
+    "lattuga\0"
+    "lavagna\0"
+    "lavoro\0"
+    "legale\0"
+    "leggero\0"
+    "lembo\0"
+    "lentezza\0"
+    "lenza\0"
+    "leone\0"
+    "lepre\0"
+    "lesivo\0"
+    "lessato\0"
+    "lesto\0"
+    "letterale\0"
+    "leva\0"
+    "levigato\0"
+    "libero\0"
+    "lido\0"
+    "lievito\0"
+    "lilla\0"
+    "limatura\0"
+    "limitare\0"
+    "limpido\0"
+    "lineare\0"
+    "lingua\0"
+    "liquido\0"
+    "lira\0"
+    "lirica\0"
+    "lisca\0"
+    "lite\0"
+    "litigio\0"
+    "livrea\0"
+    "locanda\0"
+    "lode\0"
+    "logica\0"
+    "lombare\0"
+    "londra\0"
+    "longevo\0"
+    "loquace\0"
+    "lorenzo\0"
+    "loto\0"
+    "lotteria\0"
+    "luce\0"
+    "lucidato\0"
+    "lumaca\0"
+    "luminoso\0"
+    "lungo\0"
+    "lupo\0"
+    "luppolo\0"
+    "lusinga\0"
+    "lusso\0"
+    "lutto\0"
+    "macabro\0"
+    "macchina\0"
+    "macero\0"
+    "macinato\0"
+    "madama\0"
+    "magico\0"
+    "maglia\0"
+    "magnete\0"
+    "magro\0"
+    "maiolica\0"
+    "malafede\0"
+    "malgrado\0"
+    "malinteso\0"
+    "malsano\0"
+    "malto\0"
+    "malumore\0"
+    "mana\0"
+    "mancia\0"
+    "mandorla\0"
+    "mangiare\0"
+    "manifesto\0"
+    "mannaro\0"
+    "manovra\0"
+    "mansarda\0"
+    "mantide\0"
+    "manubrio\0"
+    "mappa\0"
+    "maratona\0"
+    "marcire\0"
+    "maretta\0"
+    "marmo\0"
+    "marsupio\0"
+    "maschera\0"
+    "massaia\0"
+    "mastino\0"
+    "materasso\0"
+    "matricola\0"
+    "mattone\0"
+    "maturo\0"
+    "mazurca\0"
+    "meandro\0"
+    "meccanico\0"
+    "mecenate\0"
+    "medesimo\0"
+    "meditare\0"
+    "mega\0"
+    "melassa\0"
+    "melis\0"
+    "melodia\0"
+    "meninge\0"
+    "meno\0"
+    "mensola\0"
+    "mercurio\0"
+    "merenda\0"
+    "merlo\0"
+    "meschino\0"
+    "mese\0"
+    "messere\0"
+    "mestolo\0"
+    "metallo\0"
+    "metodo\0"
+    "mettere\0"
+    "miagolare\0"
+    "mica\0"
+    "micelio\0"
+    "michele\0"
+    "microbo\0"
+    "midollo\0"
+    "miele\0"
+    "migliore\0"
+    "milano\0"
+    "milite\0"
+    "mimosa\0"
+    "minerale\0"
+    "mini\0"
+    "minore\0"
+    "mirino\0"
+    "mirtillo\0"
+    "miscela\0"
+    "missiva\0"
+    "misto\0"
+    "misurare\0"
+    "mitezza\0"
+    "mitigare\0"
+    "mitra\0"
+    "mittente\0"
+    "mnemonico\0"
+    "modello\0"
+    "modifica\0"
+    "modulo\0"
+    "mogano\0"
+    "mogio\0"
+    "mole\0"
+    "molosso\0"
+    "monastero\0"
+    "monco\0"
+    "mondina\0"
+    "monetario\0"
+    "monile\0"
+    "monotono\0"
+    "monsone\0"
+    "montato\0"
+    "monviso\0"
+    "mora\0"
+    "mordere\0"
+    "morsicato\0"
+    "mostro\0"
+    "motivato\0"
+    "motosega\0"
+    "motto\0"
+    "movenza\0"
+    "movimento\0"
+    "mozzo\0"
+    "mucca\0"
+    "mucosa\0"
+    "muffa\0"
+    "mughetto\0"
+    "mugnaio\0"
+    "mulatto\0"
+    "mulinello\0"
+    "multiplo\0"
+    "mummia\0"
+    "munto\0"
+    "muovere\0"
+    "murale\0"
+    "musa\0"
+    "muscolo\0"
+    "musica\0"
+    "mutevole\0"
+    "muto\0"
+    "nababbo\0"
+    "nafta\0"
+    "nanometro\0"
+    "narciso\0"
+    "narice\0"
+    "narrato\0"
+    "nascere\0"
+    "nastrare\0"
+    "naturale\0"
+    "nautica\0"
+    "naviglio\0"
+    "nebulosa\0"
+    "necrosi\0"
+    "negativo\0"
+    "negozio\0"
+    "nemmeno\0"
+    "neofita\0"
+    "neretto\0"
+    "nervo\0"
+    "nessuno\0"
+    "nettuno\0"
+    "neutrale\0"
+    "neve\0"
+    "nevrotico\0"
+    "nicchia\0"
+    "ninfa\0"
+    "nitido\0"
+    "nobile\0"
+    "nocivo\0"
+    "nodo\0"
+    "nome\0"
+    "nomina\0"
+    "nordico\0"
+    "normale\0"
+    "norvegese\0"
+    "nostrano\0"
+    "notare\0"
+    "notizia\0"
+    "notturno\0"
+    "novella\0"
+    "nucleo\0"
+    "nulla\0"
+    "numero\0"
+    "nuovo\0"
+    "nutrire\0"
+    "nuvola\0"
+    "nuziale\0"
+    "oasi\0"
+    "obbedire\0"
+    "obbligo\0"
+    "obelisco\0"
+    "oblio\0"
+    "obolo\0"
+    "obsoleto\0"
+    "occasione\0"
+    "occhio\0"
+    "occidente\0"
+    "occorrere\0"
+    "occultare\0"
+    "ocra\0"
+    "oculato\0"
+    "odierno\0"
+    "odorare\0"
+    "offerta\0"
+    "offrire\0"
+    "offuscato\0"
+    "oggetto\0"
+    "oggi\0"
+    "ognuno\0"
+    "olandese\0"
+    "olfatto\0"
+    "oliato\0"
+    "oliva\0"
+    "ologramma\0"
+    "oltre\0"
+    "omaggio\0"
+    "ombelico\0"
+    "ombra\0"
+    "omega\0"
+    "omissione\0"
+    "ondoso\0"
+    "onere\0"
+    "onice\0"
+    "onnivoro\0"
+    "onorevole\0"
+    "onta\0"
+    "operato\0"
+    "opinione\0"
+    "opposto\0"
+    "oracolo\0"
+    "orafo\0"
+    "ordine\0"
+    "orecchino\0"
+    "orefice\0"
+    "orfano\0"
+    "organico\0"
+    "origine\0"
+    "orizzonte\0"
+    "orma\0"
+    "ormeggio\0"
+    "ornativo\0"
+    "orologio\0"
+    "orrendo\0"
+    "orribile\0"
+    "ortensia\0"
+    "ortica\0"
+    "orzata\0"
+    "orzo\0"
+    "osare\0"
+    "oscurare\0"
+    "osmosi\0"
+    "ospedale\0"
+    "ospite\0"
+    "ossa\0"
+    "ossidare\0"
+    "ostacolo\0"
+    "oste\0"
+    "otite\0"
+    "otre\0"
+    "ottagono\0"
+    "ottimo\0"
+    "ottobre\0"
+    "ovale\0"
+    "ovest\0"
+    "ovino\0"
+    "oviparo\0"
+    "ovocito\0"
+    "ovunque\0"
+    "ovviare\0"
+    "ozio\0"
+    "pacchetto\0"
+    "pace\0"
+    "pacifico\0"
+    "padella\0"
+    "padrone\0"
+    "paese\0"
+    "paga\0"
+    "pagina\0"
+    "palazzina\0"
+    "palesare\0"
+    "pallido\0"
+    "palo\0"
+    "palude\0"
+    "pandoro\0"
+    "pannello\0"
+    "paolo\0"
+    "paonazzo\0"
+    "paprica\0"
+    "parabola\0"
+    "parcella\0"
+    "parere\0"
+    "pargolo\0"
+    "pari\0"
+    "parlato\0"
+    "parola\0"
+    "partire\0"
+    "parvenza\0"
+    "parziale\0"
+    "passivo\0"
+    "pasticca\0"
+    "patacca\0"
+    "patologia\0"
+    "pattume\0"
+    "pavone\0"
+    "peccato\0"
+    "pedalare\0"
+    "pedonale\0"
+    "peggio\0"
+    "peloso\0"
+    "penare\0"
+    "pendice\0"
+    "penisola\0"
+    "pennuto\0"
+    "penombra\0"
+    "pensare\0"
+    "pentola\0"
+    "pepe\0"
+    "pepita\0"
+    "perbene\0"
+    "percorso\0"
+    "perdonato\0"
+    "perforare\0"
+    "pergamena\0"
+    "periodo\0"
+    "permesso\0"
+    "perno\0"
+    "perplesso\0"
+    "persuaso\0"
+    "pertugio\0"
+    "pervaso\0"
+    "pesatore\0"
+    "pesista\0"
+    "peso\0"
+    "pestifero\0"
+    "petalo\0"
+    "pettine\0"
+    "petulante\0"
+    "pezzo\0"
+    "piacere\0"
+    "pianta\0"
+    "piattino\0"
+    "piccino\0"
+    "picozza\0"
+    "piega\0"
+    "pietra\0"
+    "piffero\0"
+    "pigiama\0"
+    "pigolio\0"
+    "pigro\0"
+    "pila\0"
+    "pilifero\0"
+    "pillola\0"
+    "pilota\0"
+    "pimpante\0"
+    "pineta\0"
+    "pinna\0"
+    "pinolo\0"
+    "pioggia\0"
+    "piombo\0"
+    "piramide\0"
+    "piretico\0"
+    "pirite\0"
+    "pirolisi\0"
+    "pitone\0"
+    "pizzico\0"
+    "placebo\0"
+    "planare\0"
+    "plasma\0"
+    "platano\0"
+    "plenario\0"
+    "pochezza\0"
+    "poderoso\0"
+    "podismo\0"
+    "poesia\0"
+    "poggiare\0"
+    "polenta\0"
+    "poligono\0"
+    "pollice\0"
+    "polmonite\0"
+    "polpetta\0"
+    "polso\0"
+    "poltrona\0"
+    "polvere\0"
+    "pomice\0"
+    "pomodoro\0"
+    "ponte\0"
+    "popoloso\0"
+    "porfido\0"
+    "poroso\0"
+    "porpora\0"
+    "porre\0"
+    "portata\0"
+    "posa\0"
+    "positivo\0"
+    "possesso\0"
+    "postulato\0"
+    "potassio\0"
+    "potere\0"
+    "pranzo\0"
+    "prassi\0"
+    "pratica\0"
+    "precluso\0"
+    "predica\0"
+    "prefisso\0"
+    "pregiato\0"
+    "prelievo\0"
+    "premere\0"
+    "prenotare\0"
+    "preparato\0"
+    "presenza\0"
+    "pretesto\0"
+    "prevalso\0"
+    "prima\0"
+    "principe\0"
+    "privato\0"
+    "problema\0"
+    "procura\0"
+    "produrre\0"
+    "profumo\0"
+    "progetto\0"
+    "prolunga\0"
+    "promessa\0"
+    "pronome\0"
+    "proposta\0"
+    "proroga\0"
+    "proteso\0"
+    "prova\0"
+    "prudente\0"
+    "prugna\0"
+    "prurito\0"
+    "psiche\0"
+    "pubblico\0"
+    "pudica\0"
+    "pugilato\0"
+    "pugno\0"
+    "pulce\0"
+    "pulito\0"
+    "pulsante\0"
+    "puntare\0"
+    "pupazzo\0"
+    "pupilla\0"
+    "puro\0"
+    "quadro\0"
+    "qualcosa\0"
+    "quasi\0"
+    "querela\0"
+    "quota\0"
+    "raccolto\0"
+    "raddoppio\0"
+    "radicale\0"
+    "radunato\0"
+    "raffica\0"
+    "ragazzo\0"
+    "ragione\0"
+    "ragno\0"
+    "ramarro\0"
+    "ramingo\0"
+    "ramo\0"
+    "randagio\0"
+    "rantolare\0"
+    "rapato\0"
+    "rapina\0"
+    "rappreso\0"
+    "rasatura\0"
+    "raschiato\0"
+    "rasente\0"
+    "rassegna\0"
+    "rastrello\0"
+    "rata\0"
+    "ravveduto\0"
+    "reale\0"
+    "recepire\0"
+    "recinto\0"
+    "recluta\0"
+    "recondito\0"
+    "recupero\0"
+    "reddito\0"
+    "redimere\0"
+    "regalato\0"
+    "registro\0"
+    "regola\0"
+    "regresso\0"
+    "relazione\0"
+    "remare\0"
+    "remoto\0"
+    "renna\0"
+    "replica\0"
+    "reprimere\0"
+    "reputare\0"
+    "resa\0"
+    "residente\0"
+    "responso\0"
+    "restauro\0"
+    "rete\0"
+    "retina\0"
+    "retorica\0"
+    "rettifica\0"
+    "revocato\0"
+    "riassunto\0"
+    "ribadire\0"
+    "ribelle\0"
+    "ribrezzo\0"
+    "ricarica\0"
+    "ricco\0"
+    "ricevere\0"
+    "riciclato\0"
+    "ricordo\0"
+    "ricreduto\0"
+    "ridicolo\0"
+    "ridurre\0"
+    "rifasare\0"
+    "riflesso\0"
+    "riforma\0"
+    "rifugio\0"
+    "rigare\0"
+    "rigettato\0"
+    "righello\0"
+    "rilassato\0"
+    "rilevato\0"
+    "rimanere\0"
+    "rimbalzo\0"
+    "rimedio\0"
+    "rimorchio\0"
+    "rinascita\0"
+    "rincaro\0"
+    "rinforzo\0"
+    "rinnovo\0"
+    "rinomato\0"
+    "rinsavito\0"
+    "rintocco\0"
+    "rinuncia\0"
+    "rinvenire\0"
+    "riparato\0"
+    "ripetuto\0"
+    "ripieno\0"
+    "riportare\0"
+    "ripresa\0"
+    "ripulire\0"
+    "risata\0"
+    "rischio\0"
+    "riserva\0"
+    "risibile\0"
+    "riso\0"
+    "rispetto\0"
+    "ristoro\0"
+    "risultato\0"
+    "risvolto\0"
+    "ritardo\0"
+    "ritegno\0"
+    "ritmico\0"
+    "ritrovo\0"
+    "riunione\0"
+    "riva\0"
+    "riverso\0"
+    "rivincita\0"
+    "rivolto\0"
+    "rizoma\0"
+    "roba\0"
+    "robotico\0"
+    "robusto\0"
+    "roccia\0"
+    "roco\0"
+    "rodaggio\0"
+    "rodere\0"
+    "roditore\0"
+    "rogito\0"
+    "rollio\0"
+    "romantico\0"
+    "rompere\0"
+    "ronzio\0"
+    "rosolare\0"
+    "rospo\0"
+    "rotante\0"
+    "rotondo\0"
+    "rotula\0"
+    "rovescio\0"
+    "rubizzo\0"
+    "rubrica\0"
+    "ruga\0"
+    "rullino\0"
+    "rumine\0"
+    "rumoroso\0"
+    "ruolo\0"
+    "rupe\0"
+    "russare\0"
+    "rustico\0"
+    "sabato\0"
+    "sabbiare\0"
+    "sabotato\0"
+    "sagoma\0"
+    "salasso\0"
+    "saldatura\0"
+    "salgemma\0"
+    "salivare\0"
+    "salmone\0"
+    "salone\0"
+    "saltare\0"
+    "saluto\0"
+    "salvo\0"
+    "sapere\0"
+    "sapido\0"
+    "saporito\0"
+    "saraceno\0"
+    "sarcasmo\0"
+    "sarto\0"
+    "sassoso\0"
+    "satellite\0"
+    "satira\0"
+    "satollo\0"
+    "saturno\0"
+    "savana\0"
+    "savio\0"
+    "saziato\0"
+    "sbadiglio\0"
+    "sbalzo\0"
+    "sbancato\0"
+    "sbarra\0"
+    "sbattere\0"
+    "sbavare\0"
+    "sbendare\0"
+    "sbirciare\0"
+    "sbloccato\0"
+    "sbocciato\0"
+    "sbrinare\0"
+    "sbruffone\0"
+    "sbuffare\0"
+    "scabroso\0"
+    "scadenza\0"
+    "scala\0"
+    "scambiare\0"
+    "scandalo\0"
+    "scapola\0"
+    "scarso\0"
+    "scatenare\0"
+    "scavato\0"
+    "scelto\0"
+    "scenico\0"
+    "scettro\0"
+    "scheda\0"
+    "schiena\0"
+    "sciarpa\0"
+    "scienza\0"
+    "scindere\0"
+    "scippo\0"
+    "sciroppo\0"
+    "scivolo\0"
+    "sclerare\0"
+    "scodella\0"
+    "scolpito\0"
+    "scomparto\0"
+    "sconforto\0"
+    "scoprire\0"
+    "scorta\0"
+    "scossone\0"
+    "scozzese\0"
+    "scriba\0"
+    "scrollare\0"
+    "scrutinio\0"
+    "scuderia\0"
+    "scultore\0"
+    "scuola\0"
+    "scuro\0"
+    "scusare\0"
+    "sdebitare\0"
+    "sdoganare\0"
+    "seccatura\0"
+    "secondo\0"
+    "sedano\0"
+    "seggiola\0"
+    "segnalato\0"
+    "segregato\0"
+    "seguito\0"
+    "selciato\0"
+    "selettivo\0"
+    "sella\0"
+    "selvaggio\0"
+    "semaforo\0"
+    "sembrare\0"
+    "seme\0"
+    "seminato\0"
+    "sempre\0"
+    "senso\0"
+    "sentire\0"
+    "sepolto\0"
+    "sequenza\0"
+    "serata\0"
+    "serbato\0"
+    "sereno\0"
+    "serio\0"
+    "serpente\0"
+    "serraglio\0"
+    "servire\0"
+    "sestina\0"
+    "setola\0"
+    "settimana\0"
+    "sfacelo\0"
+    "sfaldare\0"
+    "sfamato\0"
+    "sfarzoso\0"
+    "sfaticato\0"
+    "sfera\0"
+    "sfida\0"
+    "sfilato\0"
+    "sfinge\0"
+    "sfocato\0"
+    "sfoderare\0"
+    "sfogo\0"
+    "sfoltire\0"
+    "sforzato\0"
+    "sfratto\0"
+    "sfruttato\0"
+    "sfuggito\0"
+    "sfumare\0"
+    "sfuso\0"
+    "sgabello\0"
+    "sgarbato\0"
+    "sgonfiare\0"
+    "sgorbio\0"
+    "sgrassato\0"
+    "sguardo\0"
+    "sibilo\0"
+    "siccome\0"
+    "sierra\0"
+    "sigla\0"
+    "signore\0"
+    "silenzio\0"
+    "sillaba\0"
+    "simbolo\0"
+    "simpatico\0"
+    "simulato\0"
+    "sinfonia\0"
+    "singolo\0"
+    "sinistro\0"
+    "sino\0"
+    "sintesi\0"
+    "sinusoide\0"
+    "sipario\0"
+    "sisma\0"
+    "sistole\0"
+    "situato\0"
+    "slitta\0"
+    "slogatura\0"
+    "sloveno\0"
+    "smarrito\0"
+    "smemorato\0"
+    "smentito\0"
+    "smeraldo\0"
+    "smilzo\0"
+    "smontare\0"
+    "smottato\0"
+    "smussato\0"
+    "snellire\0"
+    "snervato\0"
+    "snodo\0"
+    "sobbalzo\0"
+    "sobrio\0"
+    "soccorso\0"
+    "sociale\0"
+    "sodale\0"
+    "soffitto\0"
+    "sogno\0"
+    "soldato\0"
+    "solenne\0"
+    "solido\0"
+    "sollazzo\0"
+    "solo\0"
+    "solubile\0"
+    "solvente\0"
+    "somatico\0"
+    "somma\0"
+    "sonda\0"
+    "sonetto\0"
+    "sonnifero\0"
+    "sopire\0"
+    "soppeso\0"
+    "sopra\0"
+    "sorgere\0"
+    "sorpasso\0"
+    "sorriso\0"
+    "sorso\0"
+    "sorteggio\0"
+    "sorvolato\0"
+    "sospiro\0"
+    "sosta\0"
+    "sottile\0"
+    "spada\0"
+    "spalla\0"
+    "spargere\0"
+    "spatola\0"
+    "spavento\0"
+    "spazzola\0"
+    "specie\0"
+    "spedire\0"
+    "spegnere\0"
+    "spelatura\0"
+    "speranza\0"
+    "spessore\0"
+    "spettrale\0"
+    "spezzato\0"
+    "spia\0"
+    "spigoloso\0"
+    "spillato\0"
+    "spinoso\0"
+    "spirale\0"
+    "splendido\0"
+    "sportivo\0"
+    "sposo\0"
+    "spranga\0"
+    "sprecare\0"
+    "spronato\0"
+    "spruzzo\0"
+    "spuntino\0"
+    "squillo\0"
+    "sradicare\0"
+    "srotolato\0"
+    "stabile\0"
+    "stacco\0"
+    "staffa\0"
+    "stagnare\0"
+    "stampato\0"
+    "stantio\0"
+    "starnuto\0"
+    "stasera\0"
+    "statuto\0"
+    "stelo\0"
+    "steppa\0"
+    "sterzo\0"
+    "stiletto\0"
+    "stima\0"
+    "stirpe\0"
+    "stivale\0"
+    "stizzoso\0"
+    "stonato\0"
+    "storico\0"
+    "strappo\0"
+    "stregato\0"
+    "stridulo\0"
+    "strozzare\0"
+    "strutto\0"
+    "stuccare\0"
+    "stufo\0"
+    "stupendo\0"
+    "subentro\0"
+    "succoso\0"
+    "sudore\0"
+    "suggerito\0"
+    "sugo\0"
+    "sultano\0"
+    "suonare\0"
+    "superbo\0"
+    "supporto\0"
+    "surgelato\0"
+    "surrogato\0"
+    "sussurro\0"
+    "sutura\0"
+    "svagare\0"
+    "svedese\0"
+    "sveglio\0"
+    "svelare\0"
+    "svenuto\0"
+    "svezia\0"
+    "sviluppo\0"
+    "svista\0"
+    "svizzera\0"
+    "svolta\0"
+    "svuotare\0"
+    "tabacco\0"
+    "tabulato\0"
+    "tacciare\0"
+    "taciturno\0"
+    "tale\0"
+    "talismano\0"
+    "tampone\0"
+    "tannino\0"
+    "tara\0"
+    "tardivo\0"
+    "targato\0"
+    "tariffa\0"
+    "tarpare\0"
+    "tartaruga\0"
+    "tasto\0"
+    "tattico\0"
+    "taverna\0"
+    "tavolata\0"
+    "tazza\0"
+    "teca\0"
+    "tecnico\0"
+    "telefono\0"
+    "temerario\0"
+    "tempo\0"
+    "temuto\0"
+    "tendone\0"
+    "tenero\0"
+    "tensione\0"
+    "tentacolo\0"
+    "teorema\0"
+    "terme\0"
+    "terrazzo\0"
+    "terzetto\0"
+    "tesi\0"
+    "tesserato\0"
+    "testato\0"
+    "tetro\0"
+    "tettoia\0"
+    "tifare\0"
+    "tigella\0"
+    "timbro\0"
+    "tinto\0"
+    "tipico\0"
+    "tipografo\0"
+    "tiraggio\0"
+    "tiro\0"
+    "titanio\0"
+    "titolo\0"
+    "titubante\0"
+    "tizio\0"
+    "tizzone\0"
+    "toccare\0"
+    "tollerare\0"
+    "tolto\0"
+    "tombola\0"
+    "tomo\0"
+    "tonfo\0"
+    "tonsilla\0"
+    "topazio\0"
+    "topologia\0"
+    "toppa\0"
+    "torba\0"
+    "tornare\0"
+    "torrone\0"
+    "tortora\0"
+    "toscano\0"
+    "tossire\0"
+    "tostatura\0"
+    "totano\0"
+    "trabocco\0"
+    "trachea\0"
+    "trafila\0"
+    "tragedia\0"
+    "tralcio\0"
+    "tramonto\0"
+    "transito\0"
+    "trapano\0"
+    "trarre\0"
+    "trasloco\0"
+    "trattato\0"
+    "trave\0"
+    "treccia\0"
+    "tremolio\0"
+    "trespolo\0"
+    "tributo\0"
+    "tricheco\0"
+    "trifoglio\0"
+    "trillo\0"
+    "trincea\0"
+    "trio\0"
+    "tristezza\0"
+    "triturato\0"
+    "trivella\0"
+    "tromba\0"
+    "trono\0"
+    "troppo\0"
+    "trottola\0"
+    "trovare\0"
+    "truccato\0"
+    "tubatura\0"
+    "tuffato\0"
+    "tulipano\0"
+    "tumulto\0"
+    "tunisia\0"
+    "turbare\0"
+    "turchino\0"
+    "tuta\0"
+    "tutela\0"
+    "ubicato\0"
+    "uccello\0"
+    "uccisore\0"
+    "udire\0"
+    "uditivo\0"
+    "uffa\0"
+    "ufficio\0"
+    "uguale\0"
+    "ulisse\0"
+    "ultimato\0"
+    "umano\0"
+    "umile\0"
+    "umorismo\0"
+    "uncinetto\0"
+    "ungere\0"
+    "ungherese\0"
+    "unicorno\0"
+    "unificato\0"
+    "unisono\0"
+    "unitario\0"
+    "unte\0"
+    "uovo\0"
+    "upupa\0"
+    "uragano\0"
+    "urgenza\0"
+    "urlo\0"
+    "usanza\0"
+    "usato\0"
+    "uscito\0"
+    "usignolo\0"
+    "usuraio\0"
+    "utensile\0"
+    "utilizzo\0"
+    "utopia\0"
+    "vacante\0"
+    "vaccinato\0"
+    "vagabondo\0"
+    "vagliato\0"
+    "valanga\0"
+    "valgo\0"
+    "valico\0"
+    "valletta\0"
+    "valoroso\0"
+    "valutare\0"
+    "valvola\0"
+    "vampata\0"
+    "vangare\0"
+    "vanitoso\0"
+    "vano\0"
+    "vantaggio\0"
+    "vanvera\0"
+    "vapore\0"
+    "varano\0"
+    "varcato\0"
+    "variante\0"
+    "vasca\0"
+    "vedetta\0"
+    "vedova\0"
+    "veduto\0"
+    "vegetale\0"
+    "veicolo\0"
+    "velcro\0"
+    "velina\0"
+    "velluto\0"
+    "veloce\0"
+    "venato\0"
+    "vendemmia\0"
+    "vento\0"
+    "verace\0"
+    "verbale\0"
+    "vergogna\0"
+    "verifica\0"
+    "vero\0"
+    "verruca\0"
+    "verticale\0"
+    "vescica\0"
+    "vessillo\0"
+    "vestale\0"
+    "veterano\0"
+    "vetrina\0"
+    "vetusto\0"
+    "viandante\0"
+    "vibrante\0"
+    "vicenda\0"
+    "vichingo\0"
+    "vicinanza\0"
+    "vidimare\0"
+    "vigilia\0"
+    "vigneto\0"
+    "vigore\0"
+    "vile\0"
+    "villano\0"
+    "vimini\0"
+    "vincitore\0"
+    "viola\0"
+    "vipera\0"
+    "virgola\0"
+    "virologo\0"
+    "virulento\0"
+    "viscoso\0"
+    "visione\0"
+    "vispo\0"
+    "vissuto\0"
+    "visura\0"
+    "vita\0"
+    "vitello\0"
+    "vittima\0"
+    "vivanda\0"
+    "vivido\0"
+    "viziare\0"
+    "voce\0"
+    "voga\0"
+    "volatile\0"
+    "volere\0"
+    "volpe\0"
+    "voragine\0"
+    "vulcano\0"
+    "zampogna\0"
+    "zanna\0"
+    "zappato\0"
+    "zattera\0"
+    "zavorra\0"
+    "zefiro\0"
+    "zelante\0"
+    "zelo\0"
+    "zenzero\0"
+    "zerbino\0"
+    "zibetto\0"
+    "zinco\0"
+    "zircone\0"
+    "zitto\0"
+    "zolla\0"
+    "zotico\0"
+    "zucchero\0"
+    "zufolo\0"
+    "zulu\0"
+    "zuppa";
+
+static const uint16_t it_offsets[dictionary_size] =
 {
-    {
-        "abaco",
-        "abbaglio",
-        "abbinato",
-        "abete",
-        "abisso",
-        "abolire",
-        "abrasivo",
-        "abrogato",
-        "accadere",
-        "accenno",
-        "accusato",
-        "acetone",
-        "achille",
-        "acido",
-        "acqua",
-        "acre",
-        "acrilico",
-        "acrobata",
-        "acuto",
-        "adagio",
-        "addebito",
-        "addome",
-        "adeguato",
-        "aderire",
-        "adipe",
-        "adottare",
-        "adulare",
-        "affabile",
-        "affetto",
-        "affisso",
-        "affranto",
-        "aforisma",
-        "afoso",
-        "africano",
-        "agave",
-        "agente",
-        "agevole",
-        "aggancio",
-        "agire",
-        "agitare",
-        "agonismo",
-        "agricolo",
-        "agrumeto",
-        "aguzzo",
-        "alabarda",
-        "alato",
-        "albatro",
-        "alberato",
-        "albo",
-        "albume",
-        "alce",
-        "alcolico",
-        "alettone",
-        "alfa",
-        "algebra",
-        "aliante",
-        "alibi",
-        "alimento",
-        "allagato",
-        "allegro",
-        "allievo",
-        "allodola",
-        "allusivo",
-        "almeno",
-        "alogeno",
-        "alpaca",
-        "alpestre",
-        "altalena",
-        "alterno",
-        "alticcio",
-        "altrove",
-        "alunno",
-        "alveolo",
-        "alzare",
-        "amalgama",
-        "amanita",
-        "amarena",
-        "ambito",
-        "ambrato",
-        "ameba",
-        "america",
-        "ametista",
-        "amico",
-        "ammasso",
-        "ammenda",
-        "ammirare",
-        "ammonito",
-        "amore",
-        "ampio",
-        "ampliare",
-        "amuleto",
-        "anacardo",
-        "anagrafe",
-        "analista",
-        "anarchia",
-        "anatra",
-        "anca",
-        "ancella",
-        "ancora",
-        "andare",
-        "andrea",
-        "anello",
-        "angelo",
-        "angolare",
-        "angusto",
-        "anima",
-        "annegare",
-        "annidato",
-        "anno",
-        "annuncio",
-        "anonimo",
-        "anticipo",
-        "anzi",
-        "apatico",
-        "apertura",
-        "apode",
-        "apparire",
-        "appetito",
-        "appoggio",
-        "approdo",
-        "appunto",
-        "aprile",
-        "arabica",
-        "arachide",
-        "aragosta",
-        "araldica",
-        "arancio",
-        "aratura",
-        "arazzo",
-        "arbitro",
-        "archivio",
-        "ardito",
-        "arenile",
-        "argento",
-        "argine",
-        "arguto",
-        "aria",
-        "armonia",
-        "arnese",
-        "arredato",
-        "arringa",
-        "arrosto",
-        "arsenico",
-        "arso",
-        "artefice",
-        "arzillo",
-        "asciutto",
-        "ascolto",
-        "asepsi",
-        "asettico",
-        "asfalto",
-        "asino",
-        "asola",
-        "aspirato",
-        "aspro",
-        "assaggio",
-        "asse",
-        "assoluto",
-        "assurdo",
-        "asta",
-        "astenuto",
-        "astice",
-        "astratto",
-        "atavico",
-        "ateismo",
-        "atomico",
-        "atono",
-        "attesa",
-        "attivare",
-        "attorno",
-        "attrito",
-        "attuale",
-        "ausilio",
-        "austria",
-        "autista",
-        "autonomo",
-        "autunno",
-        "avanzato",
-        "avere",
-        "avvenire",
-        "avviso",
-        "avvolgere",
-        "azione",
-        "azoto",
-        "azzimo",
-        "azzurro",
-        "babele",
-        "baccano",
-        "bacino",
-        "baco",
-        "badessa",
-        "badilata",
-        "bagnato",
-        "baita",
-        "balcone",
-        "baldo",
-        "balena",
-        "ballata",
-        "balzano",
-        "bambino",
-        "bandire",
-        "baraonda",
-        "barbaro",
-        "barca",
-        "baritono",
-        "barlume",
-        "barocco",
-        "basilico",
-        "basso",
-        "batosta",
-        "battuto",
-        "baule",
-        "bava",
-        "bavosa",
-        "becco",
-        "beffa",
-        "belgio",
-        "belva",
-        "benda",
-        "benevole",
-        "benigno",
-        "benzina",
-        "bere",
-        "berlina",
-        "beta",
-        "bibita",
-        "bici",
-        "bidone",
-        "bifido",
-        "biga",
-        "bilancia",
-        "bimbo",
-        "binocolo",
-        "biologo",
-        "bipede",
-        "bipolare",
-        "birbante",
-        "birra",
-        "biscotto",
-        "bisesto",
-        "bisnonno",
-        "bisonte",
-        "bisturi",
-        "bizzarro",
-        "blando",
-        "blatta",
-        "bollito",
-        "bonifico",
-        "bordo",
-        "bosco",
-        "botanico",
-        "bottino",
-        "bozzolo",
-        "braccio",
-        "bradipo",
-        "brama",
-        "branca",
-        "bravura",
-        "bretella",
-        "brevetto",
-        "brezza",
-        "briglia",
-        "brillante",
-        "brindare",
-        "broccolo",
-        "brodo",
-        "bronzina",
-        "brullo",
-        "bruno",
-        "bubbone",
-        "buca",
-        "budino",
-        "buffone",
-        "buio",
-        "bulbo",
-        "buono",
-        "burlone",
-        "burrasca",
-        "bussola",
-        "busta",
-        "cadetto",
-        "caduco",
-        "calamaro",
-        "calcolo",
-        "calesse",
-        "calibro",
-        "calmo",
-        "caloria",
-        "cambusa",
-        "camerata",
-        "camicia",
-        "cammino",
-        "camola",
-        "campale",
-        "canapa",
-        "candela",
-        "cane",
-        "canino",
-        "canotto",
-        "cantina",
-        "capace",
-        "capello",
-        "capitolo",
-        "capogiro",
-        "cappero",
-        "capra",
-        "capsula",
-        "carapace",
-        "carcassa",
-        "cardo",
-        "carisma",
-        "carovana",
-        "carretto",
-        "cartolina",
-        "casaccio",
-        "cascata",
-        "caserma",
-        "caso",
-        "cassone",
-        "castello",
-        "casuale",
-        "catasta",
-        "catena",
-        "catrame",
-        "cauto",
-        "cavillo",
-        "cedibile",
-        "cedrata",
-        "cefalo",
-        "celebre",
-        "cellulare",
-        "cena",
-        "cenone",
-        "centesimo",
-        "ceramica",
-        "cercare",
-        "certo",
-        "cerume",
-        "cervello",
-        "cesoia",
-        "cespo",
-        "ceto",
-        "chela",
-        "chiaro",
-        "chicca",
-        "chiedere",
-        "chimera",
-        "china",
-        "chirurgo",
-        "chitarra",
-        "ciao",
-        "ciclismo",
-        "cifrare",
-        "cigno",
-        "cilindro",
-        "ciottolo",
-        "circa",
-        "cirrosi",
-        "citrico",
-        "cittadino",
-        "ciuffo",
-        "civetta",
-        "civile",
-        "classico",
-        "clinica",
-        "cloro",
-        "cocco",
-        "codardo",
-        "codice",
-        "coerente",
-        "cognome",
-        "collare",
-        "colmato",
-        "colore",
-        "colposo",
-        "coltivato",
-        "colza",
-        "coma",
-        "cometa",
-        "commando",
-        "comodo",
-        "computer",
-        "comune",
-        "conciso",
-        "condurre",
-        "conferma",
-        "congelare",
-        "coniuge",
-        "connesso",
-        "conoscere",
-        "consumo",
-        "continuo",
-        "convegno",
-        "coperto",
-        "copione",
-        "coppia",
-        "copricapo",
-        "corazza",
-        "cordata",
-        "coricato",
-        "cornice",
-        "corolla",
-        "corpo",
-        "corredo",
-        "corsia",
-        "cortese",
-        "cosmico",
-        "costante",
-        "cottura",
-        "covato",
-        "cratere",
-        "cravatta",
-        "creato",
-        "credere",
-        "cremoso",
-        "crescita",
-        "creta",
-        "criceto",
-        "crinale",
-        "crisi",
-        "critico",
-        "croce",
-        "cronaca",
-        "crostata",
-        "cruciale",
-        "crusca",
-        "cucire",
-        "cuculo",
-        "cugino",
-        "cullato",
-        "cupola",
-        "curatore",
-        "cursore",
-        "curvo",
-        "cuscino",
-        "custode",
-        "dado",
-        "daino",
-        "dalmata",
-        "damerino",
-        "daniela",
-        "dannoso",
-        "danzare",
-        "datato",
-        "davanti",
-        "davvero",
-        "debutto",
-        "decennio",
-        "deciso",
-        "declino",
-        "decollo",
-        "decreto",
-        "dedicato",
-        "definito",
-        "deforme",
-        "degno",
-        "delegare",
-        "delfino",
-        "delirio",
-        "delta",
-        "demenza",
-        "denotato",
-        "dentro",
-        "deposito",
-        "derapata",
-        "derivare",
-        "deroga",
-        "descritto",
-        "deserto",
-        "desiderio",
-        "desumere",
-        "detersivo",
-        "devoto",
-        "diametro",
-        "dicembre",
-        "diedro",
-        "difeso",
-        "diffuso",
-        "digerire",
-        "digitale",
-        "diluvio",
-        "dinamico",
-        "dinnanzi",
-        "dipinto",
-        "diploma",
-        "dipolo",
-        "diradare",
-        "dire",
-        "dirotto",
-        "dirupo",
-        "disagio",
-        "discreto",
-        "disfare",
-        "disgelo",
-        "disposto",
-        "distanza",
-        "disumano",
-        "dito",
-        "divano",
-        "divelto",
-        "dividere",
-        "divorato",
-        "doblone",
-        "docente",
-        "doganale",
-        "dogma",
-        "dolce",
-        "domato",
-        "domenica",
-        "dominare",
-        "dondolo",
-        "dono",
-        "dormire",
-        "dote",
-        "dottore",
-        "dovuto",
-        "dozzina",
-        "drago",
-        "druido",
-        "dubbio",
-        "dubitare",
-        "ducale",
-        "duna",
-        "duomo",
-        "duplice",
-        "duraturo",
-        "ebano",
-        "eccesso",
-        "ecco",
-        "eclissi",
-        "economia",
-        "edera",
-        "edicola",
-        "edile",
-        "editoria",
-        "educare",
-        "egemonia",
-        "egli",
-        "egoismo",
-        "egregio",
-        "elaborato",
-        "elargire",
-        "elegante",
-        "elencato",
-        "eletto",
-        "elevare",
-        "elfico",
-        "elica",
-        "elmo",
-        "elsa",
-        "eluso",
-        "emanato",
-        "emblema",
-        "emesso",
-        "emiro",
-        "emotivo",
-        "emozione",
-        "empirico",
-        "emulo",
-        "endemico",
-        "enduro",
-        "energia",
-        "enfasi",
-        "enoteca",
-        "entrare",
-        "enzima",
-        "epatite",
-        "epilogo",
-        "episodio",
-        "epocale",
-        "eppure",
-        "equatore",
-        "erario",
-        "erba",
-        "erboso",
-        "erede",
-        "eremita",
-        "erigere",
-        "ermetico",
-        "eroe",
-        "erosivo",
-        "errante",
-        "esagono",
-        "esame",
-        "esanime",
-        "esaudire",
-        "esca",
-        "esempio",
-        "esercito",
-        "esibito",
-        "esigente",
-        "esistere",
-        "esito",
-        "esofago",
-        "esortato",
-        "esoso",
-        "espanso",
-        "espresso",
-        "essenza",
-        "esso",
-        "esteso",
-        "estimare",
-        "estonia",
-        "estroso",
-        "esultare",
-        "etilico",
-        "etnico",
-        "etrusco",
-        "etto",
-        "euclideo",
-        "europa",
-        "evaso",
-        "evidenza",
-        "evitato",
-        "evoluto",
-        "evviva",
-        "fabbrica",
-        "faccenda",
-        "fachiro",
-        "falco",
-        "famiglia",
-        "fanale",
-        "fanfara",
-        "fango",
-        "fantasma",
-        "fare",
-        "farfalla",
-        "farinoso",
-        "farmaco",
-        "fascia",
-        "fastoso",
-        "fasullo",
-        "faticare",
-        "fato",
-        "favoloso",
-        "febbre",
-        "fecola",
-        "fede",
-        "fegato",
-        "felpa",
-        "feltro",
-        "femmina",
-        "fendere",
-        "fenomeno",
-        "fermento",
-        "ferro",
-        "fertile",
-        "fessura",
-        "festivo",
-        "fetta",
-        "feudo",
-        "fiaba",
-        "fiducia",
-        "fifa",
-        "figurato",
-        "filo",
-        "finanza",
-        "finestra",
-        "finire",
-        "fiore",
-        "fiscale",
-        "fisico",
-        "fiume",
-        "flacone",
-        "flamenco",
-        "flebo",
-        "flemma",
-        "florido",
-        "fluente",
-        "fluoro",
-        "fobico",
-        "focaccia",
-        "focoso",
-        "foderato",
-        "foglio",
-        "folata",
-        "folclore",
-        "folgore",
-        "fondente",
-        "fonetico",
-        "fonia",
-        "fontana",
-        "forbito",
-        "forchetta",
-        "foresta",
-        "formica",
-        "fornaio",
-        "foro",
-        "fortezza",
-        "forzare",
-        "fosfato",
-        "fosso",
-        "fracasso",
-        "frana",
-        "frassino",
-        "fratello",
-        "freccetta",
-        "frenata",
-        "fresco",
-        "frigo",
-        "frollino",
-        "fronde",
-        "frugale",
-        "frutta",
-        "fucilata",
-        "fucsia",
-        "fuggente",
-        "fulmine",
-        "fulvo",
-        "fumante",
-        "fumetto",
-        "fumoso",
-        "fune",
-        "funzione",
-        "fuoco",
-        "furbo",
-        "furgone",
-        "furore",
-        "fuso",
-        "futile",
-        "gabbiano",
-        "gaffe",
-        "galateo",
-        "gallina",
-        "galoppo",
-        "gambero",
-        "gamma",
-        "garanzia",
-        "garbo",
-        "garofano",
-        "garzone",
-        "gasdotto",
-        "gasolio",
-        "gastrico",
-        "gatto",
-        "gaudio",
-        "gazebo",
-        "gazzella",
-        "geco",
-        "gelatina",
-        "gelso",
-        "gemello",
-        "gemmato",
-        "gene",
-        "genitore",
-        "gennaio",
-        "genotipo",
-        "gergo",
-        "ghepardo",
-        "ghiaccio",
-        "ghisa",
-        "giallo",
-        "gilda",
-        "ginepro",
-        "giocare",
-        "gioiello",
-        "giorno",
-        "giove",
-        "girato",
-        "girone",
-        "gittata",
-        "giudizio",
-        "giurato",
-        "giusto",
-        "globulo",
-        "glutine",
-        "gnomo",
-        "gobba",
-        "golf",
-        "gomito",
-        "gommone",
-        "gonfio",
-        "gonna",
-        "governo",
-        "gracile",
-        "grado",
-        "grafico",
-        "grammo",
-        "grande",
-        "grattare",
-        "gravoso",
-        "grazia",
-        "greca",
-        "gregge",
-        "grifone",
-        "grigio",
-        "grinza",
-        "grotta",
-        "gruppo",
-        "guadagno",
-        "guaio",
-        "guanto",
-        "guardare",
-        "gufo",
-        "guidare",
-        "ibernato",
-        "icona",
-        "identico",
-        "idillio",
-        "idolo",
-        "idra",
-        "idrico",
-        "idrogeno",
-        "igiene",
-        "ignaro",
-        "ignorato",
-        "ilare",
-        "illeso",
-        "illogico",
-        "illudere",
-        "imballo",
-        "imbevuto",
-        "imbocco",
-        "imbuto",
-        "immane",
-        "immerso",
-        "immolato",
-        "impacco",
-        "impeto",
-        "impiego",
-        "importo",
-        "impronta",
-        "inalare",
-        "inarcare",
-        "inattivo",
-        "incanto",
-        "incendio",
-        "inchino",
-        "incisivo",
-        "incluso",
-        "incontro",
-        "incrocio",
-        "incubo",
-        "indagine",
-        "india",
-        "indole",
-        "inedito",
-        "infatti",
-        "infilare",
-        "inflitto",
-        "ingaggio",
-        "ingegno",
-        "inglese",
-        "ingordo",
-        "ingrosso",
-        "innesco",
-        "inodore",
-        "inoltrare",
-        "inondato",
-        "insano",
-        "insetto",
-        "insieme",
-        "insonnia",
-        "insulina",
-        "intasato",
-        "intero",
-        "intonaco",
-        "intuito",
-        "inumidire",
-        "invalido",
-        "invece",
-        "invito",
-        "iperbole",
-        "ipnotico",
-        "ipotesi",
-        "ippica",
-        "iride",
-        "irlanda",
-        "ironico",
-        "irrigato",
-        "irrorare",
-        "isolato",
-        "isotopo",
-        "isterico",
-        "istituto",
-        "istrice",
-        "italia",
-        "iterare",
-        "labbro",
-        "labirinto",
-        "lacca",
-        "lacerato",
-        "lacrima",
-        "lacuna",
-        "laddove",
-        "lago",
-        "lampo",
-        "lancetta",
-        "lanterna",
-        "lardoso",
-        "larga",
-        "laringe",
-        "lastra",
-        "latenza",
-        "latino",
-        "lattuga",
-        "lavagna",
-        "lavoro",
-        "legale",
-        "leggero",
-        "lembo",
-        "lentezza",
-        "lenza",
-        "leone",
-        "lepre",
-        "lesivo",
-        "lessato",
-        "lesto",
-        "letterale",
-        "leva",
-        "levigato",
-        "libero",
-        "lido",
-        "lievito",
-        "lilla",
-        "limatura",
-        "limitare",
-        "limpido",
-        "lineare",
-        "lingua",
-        "liquido",
-        "lira",
-        "lirica",
-        "lisca",
-        "lite",
-        "litigio",
-        "livrea",
-        "locanda",
-        "lode",
-        "logica",
-        "lombare",
-        "londra",
-        "longevo",
-        "loquace",
-        "lorenzo",
-        "loto",
-        "lotteria",
-        "luce",
-        "lucidato",
-        "lumaca",
-        "luminoso",
-        "lungo",
-        "lupo",
-        "luppolo",
-        "lusinga",
-        "lusso",
-        "lutto",
-        "macabro",
-        "macchina",
-        "macero",
-        "macinato",
-        "madama",
-        "magico",
-        "maglia",
-        "magnete",
-        "magro",
-        "maiolica",
-        "malafede",
-        "malgrado",
-        "malinteso",
-        "malsano",
-        "malto",
-        "malumore",
-        "mana",
-        "mancia",
-        "mandorla",
-        "mangiare",
-        "manifesto",
-        "mannaro",
-        "manovra",
-        "mansarda",
-        "mantide",
-        "manubrio",
-        "mappa",
-        "maratona",
-        "marcire",
-        "maretta",
-        "marmo",
-        "marsupio",
-        "maschera",
-        "massaia",
-        "mastino",
-        "materasso",
-        "matricola",
-        "mattone",
-        "maturo",
-        "mazurca",
-        "meandro",
-        "meccanico",
-        "mecenate",
-        "medesimo",
-        "meditare",
-        "mega",
-        "melassa",
-        "melis",
-        "melodia",
-        "meninge",
-        "meno",
-        "mensola",
-        "mercurio",
-        "merenda",
-        "merlo",
-        "meschino",
-        "mese",
-        "messere",
-        "mestolo",
-        "metallo",
-        "metodo",
-        "mettere",
-        "miagolare",
-        "mica",
-        "micelio",
-        "michele",
-        "microbo",
-        "midollo",
-        "miele",
-        "migliore",
-        "milano",
-        "milite",
-        "mimosa",
-        "minerale",
-        "mini",
-        "minore",
-        "mirino",
-        "mirtillo",
-        "miscela",
-        "missiva",
-        "misto",
-        "misurare",
-        "mitezza",
-        "mitigare",
-        "mitra",
-        "mittente",
-        "mnemonico",
-        "modello",
-        "modifica",
-        "modulo",
-        "mogano",
-        "mogio",
-        "mole",
-        "molosso",
-        "monastero",
-        "monco",
-        "mondina",
-        "monetario",
-        "monile",
-        "monotono",
-        "monsone",
-        "montato",
-        "monviso",
-        "mora",
-        "mordere",
-        "morsicato",
-        "mostro",
-        "motivato",
-        "motosega",
-        "motto",
-        "movenza",
-        "movimento",
-        "mozzo",
-        "mucca",
-        "mucosa",
-        "muffa",
-        "mughetto",
-        "mugnaio",
-        "mulatto",
-        "mulinello",
-        "multiplo",
-        "mummia",
-        "munto",
-        "muovere",
-        "murale",
-        "musa",
-        "muscolo",
-        "musica",
-        "mutevole",
-        "muto",
-        "nababbo",
-        "nafta",
-        "nanometro",
-        "narciso",
-        "narice",
-        "narrato",
-        "nascere",
-        "nastrare",
-        "naturale",
-        "nautica",
-        "naviglio",
-        "nebulosa",
-        "necrosi",
-        "negativo",
-        "negozio",
-        "nemmeno",
-        "neofita",
-        "neretto",
-        "nervo",
-        "nessuno",
-        "nettuno",
-        "neutrale",
-        "neve",
-        "nevrotico",
-        "nicchia",
-        "ninfa",
-        "nitido",
-        "nobile",
-        "nocivo",
-        "nodo",
-        "nome",
-        "nomina",
-        "nordico",
-        "normale",
-        "norvegese",
-        "nostrano",
-        "notare",
-        "notizia",
-        "notturno",
-        "novella",
-        "nucleo",
-        "nulla",
-        "numero",
-        "nuovo",
-        "nutrire",
-        "nuvola",
-        "nuziale",
-        "oasi",
-        "obbedire",
-        "obbligo",
-        "obelisco",
-        "oblio",
-        "obolo",
-        "obsoleto",
-        "occasione",
-        "occhio",
-        "occidente",
-        "occorrere",
-        "occultare",
-        "ocra",
-        "oculato",
-        "odierno",
-        "odorare",
-        "offerta",
-        "offrire",
-        "offuscato",
-        "oggetto",
-        "oggi",
-        "ognuno",
-        "olandese",
-        "olfatto",
-        "oliato",
-        "oliva",
-        "ologramma",
-        "oltre",
-        "omaggio",
-        "ombelico",
-        "ombra",
-        "omega",
-        "omissione",
-        "ondoso",
-        "onere",
-        "onice",
-        "onnivoro",
-        "onorevole",
-        "onta",
-        "operato",
-        "opinione",
-        "opposto",
-        "oracolo",
-        "orafo",
-        "ordine",
-        "orecchino",
-        "orefice",
-        "orfano",
-        "organico",
-        "origine",
-        "orizzonte",
-        "orma",
-        "ormeggio",
-        "ornativo",
-        "orologio",
-        "orrendo",
-        "orribile",
-        "ortensia",
-        "ortica",
-        "orzata",
-        "orzo",
-        "osare",
-        "oscurare",
-        "osmosi",
-        "ospedale",
-        "ospite",
-        "ossa",
-        "ossidare",
-        "ostacolo",
-        "oste",
-        "otite",
-        "otre",
-        "ottagono",
-        "ottimo",
-        "ottobre",
-        "ovale",
-        "ovest",
-        "ovino",
-        "oviparo",
-        "ovocito",
-        "ovunque",
-        "ovviare",
-        "ozio",
-        "pacchetto",
-        "pace",
-        "pacifico",
-        "padella",
-        "padrone",
-        "paese",
-        "paga",
-        "pagina",
-        "palazzina",
-        "palesare",
-        "pallido",
-        "palo",
-        "palude",
-        "pandoro",
-        "pannello",
-        "paolo",
-        "paonazzo",
-        "paprica",
-        "parabola",
-        "parcella",
-        "parere",
-        "pargolo",
-        "pari",
-        "parlato",
-        "parola",
-        "partire",
-        "parvenza",
-        "parziale",
-        "passivo",
-        "pasticca",
-        "patacca",
-        "patologia",
-        "pattume",
-        "pavone",
-        "peccato",
-        "pedalare",
-        "pedonale",
-        "peggio",
-        "peloso",
-        "penare",
-        "pendice",
-        "penisola",
-        "pennuto",
-        "penombra",
-        "pensare",
-        "pentola",
-        "pepe",
-        "pepita",
-        "perbene",
-        "percorso",
-        "perdonato",
-        "perforare",
-        "pergamena",
-        "periodo",
-        "permesso",
-        "perno",
-        "perplesso",
-        "persuaso",
-        "pertugio",
-        "pervaso",
-        "pesatore",
-        "pesista",
-        "peso",
-        "pestifero",
-        "petalo",
-        "pettine",
-        "petulante",
-        "pezzo",
-        "piacere",
-        "pianta",
-        "piattino",
-        "piccino",
-        "picozza",
-        "piega",
-        "pietra",
-        "piffero",
-        "pigiama",
-        "pigolio",
-        "pigro",
-        "pila",
-        "pilifero",
-        "pillola",
-        "pilota",
-        "pimpante",
-        "pineta",
-        "pinna",
-        "pinolo",
-        "pioggia",
-        "piombo",
-        "piramide",
-        "piretico",
-        "pirite",
-        "pirolisi",
-        "pitone",
-        "pizzico",
-        "placebo",
-        "planare",
-        "plasma",
-        "platano",
-        "plenario",
-        "pochezza",
-        "poderoso",
-        "podismo",
-        "poesia",
-        "poggiare",
-        "polenta",
-        "poligono",
-        "pollice",
-        "polmonite",
-        "polpetta",
-        "polso",
-        "poltrona",
-        "polvere",
-        "pomice",
-        "pomodoro",
-        "ponte",
-        "popoloso",
-        "porfido",
-        "poroso",
-        "porpora",
-        "porre",
-        "portata",
-        "posa",
-        "positivo",
-        "possesso",
-        "postulato",
-        "potassio",
-        "potere",
-        "pranzo",
-        "prassi",
-        "pratica",
-        "precluso",
-        "predica",
-        "prefisso",
-        "pregiato",
-        "prelievo",
-        "premere",
-        "prenotare",
-        "preparato",
-        "presenza",
-        "pretesto",
-        "prevalso",
-        "prima",
-        "principe",
-        "privato",
-        "problema",
-        "procura",
-        "produrre",
-        "profumo",
-        "progetto",
-        "prolunga",
-        "promessa",
-        "pronome",
-        "proposta",
-        "proroga",
-        "proteso",
-        "prova",
-        "prudente",
-        "prugna",
-        "prurito",
-        "psiche",
-        "pubblico",
-        "pudica",
-        "pugilato",
-        "pugno",
-        "pulce",
-        "pulito",
-        "pulsante",
-        "puntare",
-        "pupazzo",
-        "pupilla",
-        "puro",
-        "quadro",
-        "qualcosa",
-        "quasi",
-        "querela",
-        "quota",
-        "raccolto",
-        "raddoppio",
-        "radicale",
-        "radunato",
-        "raffica",
-        "ragazzo",
-        "ragione",
-        "ragno",
-        "ramarro",
-        "ramingo",
-        "ramo",
-        "randagio",
-        "rantolare",
-        "rapato",
-        "rapina",
-        "rappreso",
-        "rasatura",
-        "raschiato",
-        "rasente",
-        "rassegna",
-        "rastrello",
-        "rata",
-        "ravveduto",
-        "reale",
-        "recepire",
-        "recinto",
-        "recluta",
-        "recondito",
-        "recupero",
-        "reddito",
-        "redimere",
-        "regalato",
-        "registro",
-        "regola",
-        "regresso",
-        "relazione",
-        "remare",
-        "remoto",
-        "renna",
-        "replica",
-        "reprimere",
-        "reputare",
-        "resa",
-        "residente",
-        "responso",
-        "restauro",
-        "rete",
-        "retina",
-        "retorica",
-        "rettifica",
-        "revocato",
-        "riassunto",
-        "ribadire",
-        "ribelle",
-        "ribrezzo",
-        "ricarica",
-        "ricco",
-        "ricevere",
-        "riciclato",
-        "ricordo",
-        "ricreduto",
-        "ridicolo",
-        "ridurre",
-        "rifasare",
-        "riflesso",
-        "riforma",
-        "rifugio",
-        "rigare",
-        "rigettato",
-        "righello",
-        "rilassato",
-        "rilevato",
-        "rimanere",
-        "rimbalzo",
-        "rimedio",
-        "rimorchio",
-        "rinascita",
-        "rincaro",
-        "rinforzo",
-        "rinnovo",
-        "rinomato",
-        "rinsavito",
-        "rintocco",
-        "rinuncia",
-        "rinvenire",
-        "riparato",
-        "ripetuto",
-        "ripieno",
-        "riportare",
-        "ripresa",
-        "ripulire",
-        "risata",
-        "rischio",
-        "riserva",
-        "risibile",
-        "riso",
-        "rispetto",
-        "ristoro",
-        "risultato",
-        "risvolto",
-        "ritardo",
-        "ritegno",
-        "ritmico",
-        "ritrovo",
-        "riunione",
-        "riva",
-        "riverso",
-        "rivincita",
-        "rivolto",
-        "rizoma",
-        "roba",
-        "robotico",
-        "robusto",
-        "roccia",
-        "roco",
-        "rodaggio",
-        "rodere",
-        "roditore",
-        "rogito",
-        "rollio",
-        "romantico",
-        "rompere",
-        "ronzio",
-        "rosolare",
-        "rospo",
-        "rotante",
-        "rotondo",
-        "rotula",
-        "rovescio",
-        "rubizzo",
-        "rubrica",
-        "ruga",
-        "rullino",
-        "rumine",
-        "rumoroso",
-        "ruolo",
-        "rupe",
-        "russare",
-        "rustico",
-        "sabato",
-        "sabbiare",
-        "sabotato",
-        "sagoma",
-        "salasso",
-        "saldatura",
-        "salgemma",
-        "salivare",
-        "salmone",
-        "salone",
-        "saltare",
-        "saluto",
-        "salvo",
-        "sapere",
-        "sapido",
-        "saporito",
-        "saraceno",
-        "sarcasmo",
-        "sarto",
-        "sassoso",
-        "satellite",
-        "satira",
-        "satollo",
-        "saturno",
-        "savana",
-        "savio",
-        "saziato",
-        "sbadiglio",
-        "sbalzo",
-        "sbancato",
-        "sbarra",
-        "sbattere",
-        "sbavare",
-        "sbendare",
-        "sbirciare",
-        "sbloccato",
-        "sbocciato",
-        "sbrinare",
-        "sbruffone",
-        "sbuffare",
-        "scabroso",
-        "scadenza",
-        "scala",
-        "scambiare",
-        "scandalo",
-        "scapola",
-        "scarso",
-        "scatenare",
-        "scavato",
-        "scelto",
-        "scenico",
-        "scettro",
-        "scheda",
-        "schiena",
-        "sciarpa",
-        "scienza",
-        "scindere",
-        "scippo",
-        "sciroppo",
-        "scivolo",
-        "sclerare",
-        "scodella",
-        "scolpito",
-        "scomparto",
-        "sconforto",
-        "scoprire",
-        "scorta",
-        "scossone",
-        "scozzese",
-        "scriba",
-        "scrollare",
-        "scrutinio",
-        "scuderia",
-        "scultore",
-        "scuola",
-        "scuro",
-        "scusare",
-        "sdebitare",
-        "sdoganare",
-        "seccatura",
-        "secondo",
-        "sedano",
-        "seggiola",
-        "segnalato",
-        "segregato",
-        "seguito",
-        "selciato",
-        "selettivo",
-        "sella",
-        "selvaggio",
-        "semaforo",
-        "sembrare",
-        "seme",
-        "seminato",
-        "sempre",
-        "senso",
-        "sentire",
-        "sepolto",
-        "sequenza",
-        "serata",
-        "serbato",
-        "sereno",
-        "serio",
-        "serpente",
-        "serraglio",
-        "servire",
-        "sestina",
-        "setola",
-        "settimana",
-        "sfacelo",
-        "sfaldare",
-        "sfamato",
-        "sfarzoso",
-        "sfaticato",
-        "sfera",
-        "sfida",
-        "sfilato",
-        "sfinge",
-        "sfocato",
-        "sfoderare",
-        "sfogo",
-        "sfoltire",
-        "sforzato",
-        "sfratto",
-        "sfruttato",
-        "sfuggito",
-        "sfumare",
-        "sfuso",
-        "sgabello",
-        "sgarbato",
-        "sgonfiare",
-        "sgorbio",
-        "sgrassato",
-        "sguardo",
-        "sibilo",
-        "siccome",
-        "sierra",
-        "sigla",
-        "signore",
-        "silenzio",
-        "sillaba",
-        "simbolo",
-        "simpatico",
-        "simulato",
-        "sinfonia",
-        "singolo",
-        "sinistro",
-        "sino",
-        "sintesi",
-        "sinusoide",
-        "sipario",
-        "sisma",
-        "sistole",
-        "situato",
-        "slitta",
-        "slogatura",
-        "sloveno",
-        "smarrito",
-        "smemorato",
-        "smentito",
-        "smeraldo",
-        "smilzo",
-        "smontare",
-        "smottato",
-        "smussato",
-        "snellire",
-        "snervato",
-        "snodo",
-        "sobbalzo",
-        "sobrio",
-        "soccorso",
-        "sociale",
-        "sodale",
-        "soffitto",
-        "sogno",
-        "soldato",
-        "solenne",
-        "solido",
-        "sollazzo",
-        "solo",
-        "solubile",
-        "solvente",
-        "somatico",
-        "somma",
-        "sonda",
-        "sonetto",
-        "sonnifero",
-        "sopire",
-        "soppeso",
-        "sopra",
-        "sorgere",
-        "sorpasso",
-        "sorriso",
-        "sorso",
-        "sorteggio",
-        "sorvolato",
-        "sospiro",
-        "sosta",
-        "sottile",
-        "spada",
-        "spalla",
-        "spargere",
-        "spatola",
-        "spavento",
-        "spazzola",
-        "specie",
-        "spedire",
-        "spegnere",
-        "spelatura",
-        "speranza",
-        "spessore",
-        "spettrale",
-        "spezzato",
-        "spia",
-        "spigoloso",
-        "spillato",
-        "spinoso",
-        "spirale",
-        "splendido",
-        "sportivo",
-        "sposo",
-        "spranga",
-        "sprecare",
-        "spronato",
-        "spruzzo",
-        "spuntino",
-        "squillo",
-        "sradicare",
-        "srotolato",
-        "stabile",
-        "stacco",
-        "staffa",
-        "stagnare",
-        "stampato",
-        "stantio",
-        "starnuto",
-        "stasera",
-        "statuto",
-        "stelo",
-        "steppa",
-        "sterzo",
-        "stiletto",
-        "stima",
-        "stirpe",
-        "stivale",
-        "stizzoso",
-        "stonato",
-        "storico",
-        "strappo",
-        "stregato",
-        "stridulo",
-        "strozzare",
-        "strutto",
-        "stuccare",
-        "stufo",
-        "stupendo",
-        "subentro",
-        "succoso",
-        "sudore",
-        "suggerito",
-        "sugo",
-        "sultano",
-        "suonare",
-        "superbo",
-        "supporto",
-        "surgelato",
-        "surrogato",
-        "sussurro",
-        "sutura",
-        "svagare",
-        "svedese",
-        "sveglio",
-        "svelare",
-        "svenuto",
-        "svezia",
-        "sviluppo",
-        "svista",
-        "svizzera",
-        "svolta",
-        "svuotare",
-        "tabacco",
-        "tabulato",
-        "tacciare",
-        "taciturno",
-        "tale",
-        "talismano",
-        "tampone",
-        "tannino",
-        "tara",
-        "tardivo",
-        "targato",
-        "tariffa",
-        "tarpare",
-        "tartaruga",
-        "tasto",
-        "tattico",
-        "taverna",
-        "tavolata",
-        "tazza",
-        "teca",
-        "tecnico",
-        "telefono",
-        "temerario",
-        "tempo",
-        "temuto",
-        "tendone",
-        "tenero",
-        "tensione",
-        "tentacolo",
-        "teorema",
-        "terme",
-        "terrazzo",
-        "terzetto",
-        "tesi",
-        "tesserato",
-        "testato",
-        "tetro",
-        "tettoia",
-        "tifare",
-        "tigella",
-        "timbro",
-        "tinto",
-        "tipico",
-        "tipografo",
-        "tiraggio",
-        "tiro",
-        "titanio",
-        "titolo",
-        "titubante",
-        "tizio",
-        "tizzone",
-        "toccare",
-        "tollerare",
-        "tolto",
-        "tombola",
-        "tomo",
-        "tonfo",
-        "tonsilla",
-        "topazio",
-        "topologia",
-        "toppa",
-        "torba",
-        "tornare",
-        "torrone",
-        "tortora",
-        "toscano",
-        "tossire",
-        "tostatura",
-        "totano",
-        "trabocco",
-        "trachea",
-        "trafila",
-        "tragedia",
-        "tralcio",
-        "tramonto",
-        "transito",
-        "trapano",
-        "trarre",
-        "trasloco",
-        "trattato",
-        "trave",
-        "treccia",
-        "tremolio",
-        "trespolo",
-        "tributo",
-        "tricheco",
-        "trifoglio",
-        "trillo",
-        "trincea",
-        "trio",
-        "tristezza",
-        "triturato",
-        "trivella",
-        "tromba",
-        "trono",
-        "troppo",
-        "trottola",
-        "trovare",
-        "truccato",
-        "tubatura",
-        "tuffato",
-        "tulipano",
-        "tumulto",
-        "tunisia",
-        "turbare",
-        "turchino",
-        "tuta",
-        "tutela",
-        "ubicato",
-        "uccello",
-        "uccisore",
-        "udire",
-        "uditivo",
-        "uffa",
-        "ufficio",
-        "uguale",
-        "ulisse",
-        "ultimato",
-        "umano",
-        "umile",
-        "umorismo",
-        "uncinetto",
-        "ungere",
-        "ungherese",
-        "unicorno",
-        "unificato",
-        "unisono",
-        "unitario",
-        "unte",
-        "uovo",
-        "upupa",
-        "uragano",
-        "urgenza",
-        "urlo",
-        "usanza",
-        "usato",
-        "uscito",
-        "usignolo",
-        "usuraio",
-        "utensile",
-        "utilizzo",
-        "utopia",
-        "vacante",
-        "vaccinato",
-        "vagabondo",
-        "vagliato",
-        "valanga",
-        "valgo",
-        "valico",
-        "valletta",
-        "valoroso",
-        "valutare",
-        "valvola",
-        "vampata",
-        "vangare",
-        "vanitoso",
-        "vano",
-        "vantaggio",
-        "vanvera",
-        "vapore",
-        "varano",
-        "varcato",
-        "variante",
-        "vasca",
-        "vedetta",
-        "vedova",
-        "veduto",
-        "vegetale",
-        "veicolo",
-        "velcro",
-        "velina",
-        "velluto",
-        "veloce",
-        "venato",
-        "vendemmia",
-        "vento",
-        "verace",
-        "verbale",
-        "vergogna",
-        "verifica",
-        "vero",
-        "verruca",
-        "verticale",
-        "vescica",
-        "vessillo",
-        "vestale",
-        "veterano",
-        "vetrina",
-        "vetusto",
-        "viandante",
-        "vibrante",
-        "vicenda",
-        "vichingo",
-        "vicinanza",
-        "vidimare",
-        "vigilia",
-        "vigneto",
-        "vigore",
-        "vile",
-        "villano",
-        "vimini",
-        "vincitore",
-        "viola",
-        "vipera",
-        "virgola",
-        "virologo",
-        "virulento",
-        "viscoso",
-        "visione",
-        "vispo",
-        "vissuto",
-        "visura",
-        "vita",
-        "vitello",
-        "vittima",
-        "vivanda",
-        "vivido",
-        "viziare",
-        "voce",
-        "voga",
-        "volatile",
-        "volere",
-        "volpe",
-        "voragine",
-        "vulcano",
-        "zampogna",
-        "zanna",
-        "zappato",
-        "zattera",
-        "zavorra",
-        "zefiro",
-        "zelante",
-        "zelo",
-        "zenzero",
-        "zerbino",
-        "zibetto",
-        "zinco",
-        "zircone",
-        "zitto",
-        "zolla",
-        "zotico",
-        "zucchero",
-        "zufolo",
-        "zulu",
-        "zuppa"
-    }
+    0, 6, 15, 24, 30, 37, 45, 54, 63, 72, 80, 89, 97, 105, 111, 117, 122, 131,
+    140, 146, 153, 162, 169, 178, 186, 192, 201, 209, 218, 226, 234, 243, 252,
+    258, 267, 273, 280, 288, 297, 303, 311, 320, 329, 338, 345, 354, 360, 368,
+    377, 382, 389, 394, 403, 412, 417, 425, 433, 439, 448, 457, 465, 473, 482,
+    491, 498, 506, 513, 522, 531, 539, 548, 556, 563, 571, 578, 587, 595, 603,
+    610, 618, 624, 632, 641, 647, 655, 663, 672, 681, 687, 693, 702, 710, 719,
+    728, 737, 746, 753, 758, 766, 773, 780, 787, 794, 801, 810, 818, 824, 833,
+    842, 847, 856, 864, 873, 878, 886, 895, 901, 910, 919, 928, 936, 944, 951,
+    959, 968, 977, 986, 994, 1002, 1009, 1017, 1026, 1033, 1041, 1049, 1056,
+    1063, 1068, 1076, 1083, 1092, 1100, 1108, 1117, 1122, 1131, 1139, 1148,
+    1156, 1163, 1172, 1180, 1186, 1192, 1201, 1207, 1216, 1221, 1230, 1238,
+    1243, 1252, 1259, 1268, 1276, 1284, 1292, 1298, 1305, 1314, 1322, 1330,
+    1338, 1346, 1354, 1362, 1371, 1379, 1388, 1394, 1403, 1410, 1420, 1427,
+    1433, 1440, 1448, 1455, 1463, 1470, 1475, 1483, 1492, 1500, 1506, 1514,
+    1520, 1527, 1535, 1543, 1551, 1559, 1568, 1576, 1582, 1591, 1599, 1607,
+    1616, 1622, 1630, 1638, 1644, 1649, 1656, 1662, 1668, 1675, 1681, 1687,
+    1696, 1704, 1712, 1717, 1725, 1730, 1737, 1742, 1749, 1756, 1761, 1770,
+    1776, 1785, 1793, 1800, 1809, 1818, 1824, 1833, 1841, 1850, 1858, 1866,
+    1875, 1882, 1889, 1897, 1906, 1912, 1918, 1927, 1935, 1943, 1951, 1959,
+    1965, 1972, 1980, 1989, 1998, 2005, 2013, 2023, 2032, 2041, 2047, 2056,
+    2063, 2069, 2077, 2082, 2089, 2097, 2102, 2108, 2114, 2122, 2131, 2139,
+    2145, 2153, 2160, 2169, 2177, 2185, 2193, 2199, 2207, 2215, 2224, 2232,
+    2240, 2247, 2255, 2262, 2270, 2275, 2282, 2290, 2298, 2305, 2313, 2322,
+    2331, 2339, 2345, 2353, 2362, 2371, 2377, 2385, 2394, 2403, 2413, 2422,
+    2430, 2438, 2443, 2451, 2460, 2468, 2476, 2483, 2491, 2497, 2505, 2514,
+    2522, 2529, 2537, 2547, 2552, 2559, 2569, 2578, 2586, 2592, 2599, 2608,
+    2615, 2621, 2626, 2632, 2639, 2646, 2655, 2663, 2669, 2678, 2687, 2692,
+    2701, 2709, 2715, 2724, 2733, 2739, 2747, 2755, 2765, 2772, 2780, 2787,
+    2796, 2804, 2810, 2816, 2824, 2831, 2840, 2848, 2856, 2864, 2871, 2879,
+    2889, 2895, 2900, 2907, 2916, 2923, 2932, 2939, 2947, 2956, 2965, 2975,
+    2983, 2992, 3002, 3010, 3019, 3028, 3036, 3044, 3051, 3061, 3069, 3077,
+    3086, 3094, 3102, 3108, 3116, 3123, 3131, 3139, 3148, 3156, 3163, 3171,
+    3180, 3187, 3195, 3203, 3212, 3218, 3226, 3234, 3240, 3248, 3254, 3262,
+    3271, 3280, 3287, 3294, 3301, 3308, 3316, 3323, 3332, 3340, 3346, 3354,
+    3362, 3367, 3373, 3381, 3390, 3398, 3406, 3414, 3421, 3429, 3437, 3445,
+    3454, 3461, 3469, 3477, 3485, 3494, 3503, 3511, 3517, 3526, 3534, 3542,
+    3548, 3556, 3565, 3572, 3581, 3590, 3599, 3606, 3616, 3624, 3634, 3643,
+    3653, 3660, 3669, 3678, 3685, 3692, 3700, 3709, 3718, 3726, 3735, 3744,
+    3752, 3760, 3767, 3776, 3781, 3789, 3796, 3804, 3813, 3821, 3829, 3838,
+    3847, 3856, 3861, 3868, 3876, 3885, 3894, 3902, 3910, 3919, 3925, 3931,
+    3938, 3947, 3956, 3964, 3969, 3977, 3982, 3990, 3997, 4005, 4011, 4018,
+    4025, 4034, 4041, 4046, 4052, 4060, 4069, 4075, 4083, 4088, 4096, 4105,
+    4111, 4119, 4125, 4134, 4142, 4151, 4156, 4164, 4172, 4182, 4191, 4200,
+    4209, 4216, 4224, 4231, 4237, 4242, 4247, 4253, 4261, 4269, 4276, 4282,
+    4290, 4299, 4308, 4314, 4323, 4330, 4338, 4345, 4353, 4361, 4368, 4376,
+    4384, 4393, 4401, 4408, 4417, 4424, 4429, 4436, 4442, 4450, 4458, 4467,
+    4472, 4480, 4488, 4496, 4502, 4510, 4519, 4524, 4532, 4541, 4549, 4558,
+    4567, 4573, 4581, 4590, 4596, 4604, 4613, 4621, 4626, 4633, 4642, 4650,
+    4658, 4667, 4675, 4682, 4690, 4695, 4704, 4711, 4717, 4726, 4734, 4742,
+    4749, 4758, 4767, 4775, 4781, 4790, 4797, 4805, 4811, 4820, 4825, 4834,
+    4843, 4851, 4858, 4866, 4874, 4883, 4888, 4897, 4904, 4911, 4916, 4923,
+    4929, 4936, 4944, 4952, 4961, 4970, 4976, 4984, 4992, 5000, 5006, 5012,
+    5018, 5026, 5031, 5040, 5045, 5053, 5062, 5069, 5075, 5083, 5090, 5096,
+    5104, 5113, 5119, 5126, 5134, 5142, 5149, 5156, 5165, 5172, 5181, 5188,
+    5195, 5204, 5212, 5221, 5230, 5236, 5244, 5252, 5262, 5270, 5278, 5286,
+    5291, 5300, 5308, 5316, 5322, 5331, 5337, 5346, 5355, 5365, 5373, 5380,
+    5386, 5395, 5402, 5410, 5417, 5426, 5433, 5442, 5450, 5456, 5464, 5472,
+    5479, 5484, 5493, 5499, 5505, 5513, 5520, 5525, 5532, 5541, 5547, 5555,
+    5563, 5571, 5579, 5585, 5594, 5600, 5609, 5617, 5626, 5634, 5643, 5649,
+    5656, 5663, 5672, 5677, 5686, 5692, 5700, 5708, 5713, 5722, 5730, 5739,
+    5745, 5754, 5763, 5769, 5776, 5782, 5790, 5798, 5807, 5814, 5820, 5827,
+    5834, 5842, 5851, 5859, 5866, 5874, 5882, 5888, 5894, 5899, 5906, 5914,
+    5921, 5927, 5935, 5943, 5949, 5957, 5964, 5971, 5980, 5988, 5995, 6001,
+    6008, 6016, 6023, 6030, 6037, 6044, 6053, 6059, 6066, 6075, 6080, 6088,
+    6097, 6103, 6112, 6120, 6126, 6131, 6138, 6147, 6154, 6161, 6170, 6176,
+    6183, 6192, 6201, 6209, 6218, 6226, 6233, 6240, 6248, 6257, 6265, 6272,
+    6280, 6288, 6297, 6305, 6314, 6323, 6331, 6340, 6348, 6357, 6365, 6374,
+    6383, 6390, 6399, 6405, 6412, 6420, 6428, 6437, 6446, 6455, 6463, 6471,
+    6479, 6488, 6496, 6504, 6514, 6523, 6530, 6538, 6546, 6555, 6564, 6573,
+    6580, 6589, 6597, 6607, 6616, 6623, 6630, 6639, 6648, 6656, 6663, 6669,
+    6677, 6685, 6694, 6703, 6711, 6719, 6728, 6737, 6745, 6752, 6760, 6767,
+    6777, 6783, 6792, 6800, 6807, 6815, 6820, 6826, 6835, 6844, 6852, 6858,
+    6866, 6873, 6881, 6888, 6896, 6904, 6911, 6918, 6926, 6932, 6941, 6947,
+    6953, 6959, 6966, 6974, 6980, 6990, 6995, 7004, 7011, 7016, 7024, 7030,
+    7039, 7048, 7056, 7064, 7071, 7079, 7084, 7091, 7097, 7102, 7110, 7117,
+    7125, 7130, 7137, 7145, 7152, 7160, 7168, 7176, 7181, 7190, 7195, 7204,
+    7211, 7220, 7226, 7231, 7239, 7247, 7253, 7259, 7267, 7276, 7283, 7292,
+    7299, 7306, 7313, 7321, 7327, 7336, 7345, 7354, 7364, 7372, 7378, 7387,
+    7392, 7399, 7408, 7417, 7427, 7435, 7443, 7452, 7460, 7469, 7475, 7484,
+    7492, 7500, 7506, 7515, 7524, 7532, 7540, 7550, 7560, 7568, 7575, 7583,
+    7591, 7601, 7610, 7619, 7628, 7633, 7641, 7647, 7655, 7663, 7668, 7676,
+    7685, 7693, 7699, 7708, 7713, 7721, 7729, 7737, 7744, 7752, 7762, 7767,
+    7775, 7783, 7791, 7799, 7805, 7814, 7821, 7828, 7835, 7844, 7849, 7856,
+    7863, 7872, 7880, 7888, 7894, 7903, 7911, 7920, 7926, 7935, 7945, 7953,
+    7962, 7969, 7976, 7982, 7987, 7995, 8005, 8011, 8019, 8029, 8036, 8045,
+    8053, 8061, 8069, 8074, 8082, 8092, 8099, 8108, 8117, 8123, 8131, 8141,
+    8147, 8153, 8160, 8166, 8175, 8183, 8191, 8201, 8210, 8217, 8223, 8231,
+    8238, 8243, 8251, 8258, 8267, 8272, 8280, 8286, 8296, 8304, 8311, 8319,
+    8327, 8336, 8345, 8353, 8362, 8371, 8379, 8388, 8396, 8404, 8412, 8420,
+    8426, 8434, 8442, 8451, 8456, 8466, 8474, 8480, 8487, 8494, 8501, 8506,
+    8511, 8518, 8526, 8534, 8544, 8553, 8560, 8568, 8577, 8585, 8592, 8598,
+    8605, 8611, 8619, 8626, 8634, 8639, 8648, 8656, 8665, 8671, 8677, 8686,
+    8696, 8703, 8713, 8723, 8733, 8738, 8746, 8754, 8762, 8770, 8778, 8788,
+    8796, 8801, 8808, 8817, 8825, 8832, 8838, 8848, 8854, 8862, 8871, 8877,
+    8883, 8893, 8900, 8906, 8912, 8921, 8931, 8936, 8944, 8953, 8961, 8969,
+    8975, 8982, 8992, 9000, 9007, 9016, 9024, 9034, 9039, 9048, 9057, 9066,
+    9074, 9083, 9092, 9099, 9106, 9111, 9117, 9126, 9133, 9142, 9149, 9154,
+    9163, 9172, 9177, 9183, 9188, 9197, 9204, 9212, 9218, 9224, 9230, 9238,
+    9246, 9254, 9262, 9267, 9277, 9282, 9291, 9299, 9307, 9313, 9318, 9325,
+    9335, 9344, 9352, 9357, 9364, 9372, 9381, 9387, 9396, 9404, 9413, 9422,
+    9429, 9437, 9442, 9450, 9457, 9465, 9474, 9483, 9491, 9500, 9508, 9518,
+    9526, 9533, 9541, 9550, 9559, 9566, 9573, 9580, 9588, 9597, 9605, 9614,
+    9622, 9630, 9635, 9642, 9650, 9659, 9669, 9679, 9689, 9697, 9706, 9712,
+    9722, 9731, 9740, 9748, 9757, 9765, 9770, 9780, 9787, 9795, 9805, 9811,
+    9819, 9826, 9835, 9843, 9851, 9857, 9864, 9872, 9880, 9888, 9894, 9899,
+    9908, 9916, 9923, 9932, 9939, 9945, 9952, 9960, 9967, 9976, 9985, 9992,
+    10001, 10008, 10016, 10024, 10032, 10039, 10047, 10056, 10065, 10074,
+    10082, 10089, 10098, 10106, 10115, 10123, 10133, 10142, 10148, 10157,
+    10165, 10172, 10181, 10187, 10196, 10204, 10211, 10219, 10225, 10233,
+    10238, 10247, 10256, 10266, 10275, 10282, 10289, 10296, 10304, 10313,
+    10321, 10330, 10339, 10348, 10356, 10366, 10376, 10385, 10394, 10403,
+    10409, 10418, 10426, 10435, 10443, 10452, 10460, 10469, 10478, 10487,
+    10495, 10504, 10512, 10520, 10526, 10535, 10542, 10550, 10557, 10566,
+    10573, 10582, 10588, 10594, 10601, 10610, 10618, 10626, 10634, 10639,
+    10646, 10655, 10661, 10669, 10675, 10684, 10694, 10703, 10712, 10720,
+    10728, 10736, 10742, 10750, 10758, 10763, 10772, 10782, 10789, 10796,
+    10805, 10814, 10824, 10832, 10841, 10851, 10856, 10866, 10872, 10881,
+    10889, 10897, 10907, 10916, 10924, 10933, 10942, 10951, 10958, 10967,
+    10977, 10984, 10991, 10997, 11005, 11015, 11024, 11029, 11039, 11048,
+    11057, 11062, 11069, 11078, 11088, 11097, 11107, 11116, 11124, 11133,
+    11142, 11148, 11157, 11167, 11175, 11185, 11194, 11202, 11211, 11220,
+    11228, 11236, 11243, 11253, 11262, 11272, 11281, 11290, 11299, 11307,
+    11317, 11327, 11335, 11344, 11352, 11361, 11371, 11380, 11389, 11399,
+    11408, 11417, 11425, 11435, 11443, 11452, 11459, 11467, 11475, 11484,
+    11489, 11498, 11506, 11516, 11525, 11533, 11541, 11549, 11557, 11566,
+    11571, 11579, 11589, 11597, 11604, 11609, 11618, 11626, 11633, 11638,
+    11647, 11654, 11663, 11670, 11677, 11687, 11695, 11702, 11711, 11717,
+    11725, 11733, 11740, 11749, 11757, 11765, 11770, 11778, 11785, 11794,
+    11800, 11805, 11813, 11821, 11828, 11837, 11846, 11853, 11861, 11871,
+    11880, 11889, 11897, 11904, 11912, 11919, 11925, 11932, 11939, 11948,
+    11957, 11966, 11972, 11980, 11990, 11997, 12005, 12013, 12020, 12026,
+    12034, 12044, 12051, 12060, 12067, 12076, 12084, 12093, 12103, 12113,
+    12123, 12132, 12142, 12151, 12160, 12169, 12175, 12185, 12194, 12202,
+    12209, 12219, 12227, 12234, 12242, 12250, 12257, 12265, 12273, 12281,
+    12290, 12297, 12306, 12314, 12323, 12332, 12341, 12351, 12361, 12370,
+    12377, 12386, 12395, 12402, 12412, 12422, 12431, 12440, 12447, 12453,
+    12461, 12471, 12481, 12491, 12499, 12506, 12515, 12525, 12535, 12543,
+    12552, 12562, 12568, 12578, 12587, 12596, 12601, 12610, 12617, 12623,
+    12631, 12639, 12648, 12655, 12663, 12670, 12676, 12685, 12695, 12703,
+    12711, 12718, 12728, 12736, 12745, 12753, 12762, 12772, 12778, 12784,
+    12792, 12799, 12807, 12817, 12823, 12832, 12841, 12849, 12859, 12868,
+    12876, 12882, 12891, 12900, 12910, 12918, 12928, 12936, 12943, 12951,
+    12958, 12964, 12972, 12981, 12989, 12997, 13007, 13016, 13025, 13033,
+    13042, 13047, 13055, 13065, 13073, 13079, 13087, 13095, 13102, 13112,
+    13120, 13129, 13139, 13148, 13157, 13164, 13173, 13182, 13191, 13200,
+    13209, 13215, 13224, 13231, 13240, 13248, 13255, 13264, 13270, 13278,
+    13286, 13293, 13302, 13307, 13316, 13325, 13334, 13340, 13346, 13354,
+    13364, 13371, 13379, 13385, 13393, 13402, 13410, 13416, 13426, 13436,
+    13444, 13450, 13458, 13464, 13471, 13480, 13488, 13497, 13506, 13513,
+    13521, 13530, 13540, 13549, 13558, 13568, 13577, 13582, 13592, 13601,
+    13609, 13617, 13627, 13636, 13642, 13650, 13659, 13668, 13676, 13685,
+    13693, 13703, 13713, 13721, 13728, 13735, 13744, 13753, 13761, 13770,
+    13778, 13786, 13792, 13799, 13806, 13815, 13821, 13828, 13836, 13845,
+    13853, 13861, 13869, 13878, 13887, 13897, 13905, 13914, 13920, 13929,
+    13938, 13946, 13953, 13963, 13968, 13976, 13984, 13992, 14001, 14011,
+    14021, 14030, 14037, 14045, 14053, 14061, 14069, 14077, 14084, 14093,
+    14100, 14109, 14116, 14125, 14133, 14142, 14151, 14161, 14166, 14176,
+    14184, 14192, 14197, 14205, 14213, 14221, 14229, 14239, 14245, 14253,
+    14261, 14270, 14276, 14281, 14289, 14298, 14308, 14314, 14321, 14329,
+    14336, 14345, 14355, 14363, 14369, 14378, 14387, 14392, 14402, 14410,
+    14416, 14424, 14431, 14439, 14446, 14452, 14459, 14469, 14478, 14483,
+    14491, 14498, 14508, 14514, 14522, 14530, 14540, 14546, 14554, 14559,
+    14565, 14574, 14582, 14592, 14598, 14604, 14612, 14620, 14628, 14636,
+    14644, 14654, 14661, 14670, 14678, 14686, 14695, 14703, 14712, 14721,
+    14729, 14736, 14745, 14754, 14760, 14768, 14777, 14786, 14794, 14803,
+    14813, 14820, 14828, 14833, 14843, 14853, 14862, 14869, 14875, 14882,
+    14891, 14899, 14908, 14917, 14925, 14934, 14942, 14950, 14958, 14967,
+    14972, 14979, 14987, 14995, 15004, 15010, 15018, 15023, 15031, 15038,
+    15045, 15054, 15060, 15066, 15075, 15085, 15092, 15102, 15111, 15121,
+    15129, 15138, 15143, 15148, 15154, 15162, 15170, 15175, 15182, 15188,
+    15195, 15204, 15212, 15221, 15230, 15237, 15245, 15255, 15265, 15274,
+    15282, 15288, 15295, 15304, 15313, 15322, 15330, 15338, 15346, 15355,
+    15360, 15370, 15378, 15385, 15392, 15400, 15409, 15415, 15423, 15430,
+    15437, 15446, 15454, 15461, 15468, 15476, 15483, 15490, 15500, 15506,
+    15513, 15521, 15530, 15539, 15544, 15552, 15562, 15570, 15579, 15587,
+    15596, 15604, 15612, 15622, 15631, 15639, 15648, 15658, 15667, 15675,
+    15683, 15690, 15695, 15703, 15710, 15720, 15726, 15733, 15741, 15750,
+    15760, 15768, 15776, 15782, 15790, 15797, 15802, 15810, 15818, 15826,
+    15833, 15841, 15846, 15851, 15860, 15867, 15873, 15882, 15890, 15899,
+    15905, 15913, 15921, 15929, 15936, 15944, 15949, 15957, 15965, 15973,
+    15979, 15987, 15993, 15999, 16006, 16015, 16022, 16027
 };
 
-const dictionary fr =
+const dictionary it{ it_words, it_offsets };
+
+static const char fr_words[] =
+    "abaisser\0"
+    "abandon\0"
+    "abdiquer\0"
+    "abeille\0"
+    "abolir\0"
+    "aborder\0"
+    "aboutir\0"
+    "aboyer\0"
+    "abrasif\0"
+    "abreuver\0"
+    "abriter\0"
+    "abroger\0"
+    "abrupt\0"
+    "absence\0"
+    "absolu\0"
+    "absurde\0"
+    "abusif\0"
+    "abyssal\0"
+    "académie\0"
+    "acajou\0"
+    "acarien\0"
+    "accabler\0"
+    "accepter\0"
+    "acclamer\0"
+    "accolade\0"
+    "accroche\0"
+    "accuser\0"
+    "acerbe\0"
+    "achat\0"
+    "acheter\0"
+    "aciduler\0"
+    "acier\0"
+    "acompte\0"
+    "acquérir\0"
+    "acronyme\0"
+    "acteur\0"
+    "actif\0"
+    "actuel\0"
+    "adepte\0"
+    "adéquat\0"
+    "adhésif\0"
+    "adjectif\0"
+    "adjuger\0"
+    "admettre\0"
+    "admirer\0"
+    "adopter\0"
+    "adorer\0"
+    "adoucir\0"
+    "adresse\0"
+    "adroit\0"
+    "adulte\0"
+    "adverbe\0"
+    "aérer\0"
+    "aéronef\0"
+    "affaire\0"
+    "affecter\0"
+    "affiche\0"
+    "affreux\0"
+    "affubler\0"
+    "agacer\0"
+    "agencer\0"
+    "agile\0"
+    "agiter\0"
+    "agrafer\0"
+    "agréable\0"
+    "agrume\0"
+    "aider\0"
+    "aiguille\0"
+    "ailier\0"
+    "aimable\0"
+    "aisance\0"
+    "ajouter\0"
+    "ajuster\0"
+    "alarmer\0"
+    "alchimie\0"
+    "alerte\0"
+    "algèbre\0"
+    "algue\0"
+    "aliéner\0"
+    "aliment\0"
+    "alléger\0"
+    "alliage\0"
+    "allouer\0"
+    "allumer\0"
+    "alourdir\0"
+    "alpaga\0"
+    "altesse\0"
+    "alvéole\0"
+    "amateur\0"
+    "ambigu\0"
+    "ambre\0"
+    "aménager\0"
+    "amertume\0"
+    "amidon\0"
+    "amiral\0"
+    "amorcer\0"
+    "amour\0"
+    "amovible\0"
+    "amphibie\0"
+    "ampleur\0"
+    "amusant\0"
+    "analyse\0"
+    "anaphore\0"
+    "anarchie\0"
+    "anatomie\0"
+    "ancien\0"
+    "anéantir\0"
+    "angle\0"
+    "angoisse\0"
+    "anguleux\0"
+    "animal\0"
+    "annexer\0"
+    "annonce\0"
+    "annuel\0"
+    "anodin\0"
+    "anomalie\0"
+    "anonyme\0"
+    "anormal\0"
+    "antenne\0"
+    "antidote\0"
+    "anxieux\0"
+    "apaiser\0"
+    "apéritif\0"
+    "aplanir\0"
+    "apologie\0"
+    "appareil\0"
+    "appeler\0"
+    "apporter\0"
+    "appuyer\0"
+    "aquarium\0"
+    "aqueduc\0"
+    "arbitre\0"
+    "arbuste\0"
+    "ardeur\0"
+    "ardoise\0"
+    "argent\0"
+    "arlequin\0"
+    "armature\0"
+    "armement\0"
+    "armoire\0"
+    "armure\0"
+    "arpenter\0"
+    "arracher\0"
+    "arriver\0"
+    "arroser\0"
+    "arsenic\0"
+    "artériel\0"
+    "article\0"
+    "aspect\0"
+    "asphalte\0"
+    "aspirer\0"
+    "assaut\0"
+    "asservir\0"
+    "assiette\0"
+    "associer\0"
+    "assurer\0"
+    "asticot\0"
+    "astre\0"
+    "astuce\0"
+    "atelier\0"
+    "atome\0"
+    "atrium\0"
+    "atroce\0"
+    "attaque\0"
+    "attentif\0"
+    "attirer\0"
+    "attraper\0"
+    "aubaine\0"
+    "auberge\0"
+    "audace\0"
+    "audible\0"
+    "augurer\0"
+    "aurore\0"
+    "automne\0"
+    "autruche\0"
+    "avaler\0"
+    "avancer\0"
+    "avarice\0"
+    "avenir\0"
+    "averse\0"
+    "aveugle\0"
+    "aviateur\0"
+    "avide\0"
+    "avion\0"
+    "aviser\0"
+    "avoine\0"
+    "avouer\0"
+    "avril\0"
+    "axial\0"
+    "axiome\0"
+    "badge\0"
+    "bafouer\0"
+    "bagage\0"
+    "baguette\0"
+    "baignade\0"
+    "balancer\0"
+    "balcon\0"
+    "baleine\0"
+    "balisage\0"
+    "bambin\0"
+    "bancaire\0"
+    "bandage\0"
+    "banlieue\0"
+    "bannière\0"
+    "banquier\0"
+    "barbier\0"
+    "baril\0"
+    "baron\0"
+    "barque\0"
+    "barrage\0"
+    "bassin\0"
+    "bastion\0"
+    "bataille\0"
+    "bateau\0"
+    "batterie\0"
+    "baudrier\0"
+    "bavarder\0"
+    "belette\0"
+    "bélier\0"
+    "belote\0"
+    "bénéfice\0"
+    "berceau\0"
+    "berger\0"
+    "berline\0"
+    "bermuda\0"
+    "besace\0"
+    "besogne\0"
+    "bétail\0"
+    "beurre\0"
+    "biberon\0"
+    "bicycle\0"
+    "bidule\0"
+    "bijou\0"
+    "bilan\0"
+    "bilingue\0"
+    "billard\0"
+    "binaire\0"
+    "biologie\0"
+    "biopsie\0"
+    "biotype\0"
+    "biscuit\0"
+    "bison\0"
+    "bistouri\0"
+    "bitume\0"
+    "bizarre\0"
+    "blafard\0"
+    "blague\0"
+    "blanchir\0"
+    "blessant\0"
+    "blinder\0"
+    "blond\0"
+    "bloquer\0"
+    "blouson\0"
+    "bobard\0"
+    "bobine\0"
+    "boire\0"
+    "boiser\0"
+    "bolide\0"
+    "bonbon\0"
+    "bondir\0"
+    "bonheur\0"
+    "bonifier\0"
+    "bonus\0"
+    "bordure\0"
+    "borne\0"
+    "botte\0"
+    "boucle\0"
+    "boueux\0"
+    "bougie\0"
+    "boulon\0"
+    "bouquin\0"
+    "bourse\0"
+    "boussole\0"
+    "boutique\0"
+    "boxeur\0"
+    "branche\0"
+    "brasier\0"
+    "brave\0"
+    "brebis\0"
+    "brèche\0"
+    "breuvage\0"
+    "bricoler\0"
+    "brigade\0"
+    "brillant\0"
+    "brioche\0"
+    "brique\0"
+    "brochure\0"
+    "broder\0"
+    "bronzer\0"
+    "brousse\0"
+    "broyeur\0"
+    "brume\0"
+    "brusque\0"
+    "brutal\0"
+    "bruyant\0"
+    "buffle\0"
+    "buisson\0"
+    "bulletin\0"
+    "bureau\0"
+    "burin\0"
+    "bustier\0"
+    "butiner\0"
+    "butoir\0"
+    "buvable\0"
+    "buvette\0"
+    "cabanon\0"
+    "cabine\0"
+    "cachette\0"
+    "cadeau\0"
+    "cadre\0"
+    "caféine\0"
+    "caillou\0"
+    "caisson\0"
+    "calculer\0"
+    "calepin\0"
+    "calibre\0"
+    "calmer\0"
+    "calomnie\0"
+    "calvaire\0"
+    "camarade\0"
+    "caméra\0"
+    "camion\0"
+    "campagne\0"
+    "canal\0"
+    "caneton\0"
+    "canon\0"
+    "cantine\0"
+    "canular\0"
+    "capable\0"
+    "caporal\0"
+    "caprice\0"
+    "capsule\0"
+    "capter\0"
+    "capuche\0"
+    "carabine\0"
+    "carbone\0"
+    "caresser\0"
+    "caribou\0"
+    "carnage\0"
+    "carotte\0"
+    "carreau\0"
+    "carton\0"
+    "cascade\0"
+    "casier\0"
+    "casque\0"
+    "cassure\0"
+    "causer\0"
+    "caution\0"
+    "cavalier\0"
+    "caverne\0"
+    "caviar\0"
+    "cédille\0"
+    "ceinture\0"
+    "céleste\0"
+    "cellule\0"
+    "cendrier\0"
+    "censurer\0"
+    "central\0"
+    "cercle\0"
+    "cérébral\0"
+    "cerise\0"
+    "cerner\0"
+    "cerveau\0"
+    "cesser\0"
+    "chagrin\0"
+    "chaise\0"
+    "chaleur\0"
+    "chambre\0"
+    "chance\0"
+    "chapitre\0"
+    "charbon\0"
+    "chasseur\0"
+    "chaton\0"
+    "chausson\0"
+    "chavirer\0"
+    "chemise\0"
+    "chenille\0"
+    "chéquier\0"
+    "chercher\0"
+    "cheval\0"
+    "chien\0"
+    "chiffre\0"
+    "chignon\0"
+    "chimère\0"
+    "chiot\0"
+    "chlorure\0"
+    "chocolat\0"
+    "choisir\0"
+    "chose\0"
+    "chouette\0"
+    "chrome\0"
+    "chute\0"
+    "cigare\0"
+    "cigogne\0"
+    "cimenter\0"
+    "cinéma\0"
+    "cintrer\0"
+    "circuler\0"
+    "cirer\0"
+    "cirque\0"
+    "citerne\0"
+    "citoyen\0"
+    "citron\0"
+    "civil\0"
+    "clairon\0"
+    "clameur\0"
+    "claquer\0"
+    "classe\0"
+    "clavier\0"
+    "client\0"
+    "cligner\0"
+    "climat\0"
+    "clivage\0"
+    "cloche\0"
+    "clonage\0"
+    "cloporte\0"
+    "cobalt\0"
+    "cobra\0"
+    "cocasse\0"
+    "cocotier\0"
+    "coder\0"
+    "codifier\0"
+    "coffre\0"
+    "cogner\0"
+    "cohésion\0"
+    "coiffer\0"
+    "coincer\0"
+    "colère\0"
+    "colibri\0"
+    "colline\0"
+    "colmater\0"
+    "colonel\0"
+    "combat\0"
+    "comédie\0"
+    "commande\0"
+    "compact\0"
+    "concert\0"
+    "conduire\0"
+    "confier\0"
+    "congeler\0"
+    "connoter\0"
+    "consonne\0"
+    "contact\0"
+    "convexe\0"
+    "copain\0"
+    "copie\0"
+    "corail\0"
+    "corbeau\0"
+    "cordage\0"
+    "corniche\0"
+    "corpus\0"
+    "correct\0"
+    "cortège\0"
+    "cosmique\0"
+    "costume\0"
+    "coton\0"
+    "coude\0"
+    "coupure\0"
+    "courage\0"
+    "couteau\0"
+    "couvrir\0"
+    "coyote\0"
+    "crabe\0"
+    "crainte\0"
+    "cravate\0"
+    "crayon\0"
+    "créature\0"
+    "créditer\0"
+    "crémeux\0"
+    "creuser\0"
+    "crevette\0"
+    "cribler\0"
+    "crier\0"
+    "cristal\0"
+    "critère\0"
+    "croire\0"
+    "croquer\0"
+    "crotale\0"
+    "crucial\0"
+    "cruel\0"
+    "crypter\0"
+    "cubique\0"
+    "cueillir\0"
+    "cuillère\0"
+    "cuisine\0"
+    "cuivre\0"
+    "culminer\0"
+    "cultiver\0"
+    "cumuler\0"
+    "cupide\0"
+    "curatif\0"
+    "curseur\0"
+    "cyanure\0"
+    "cycle\0"
+    "cylindre\0"
+    "cynique\0"
+    "daigner\0"
+    "damier\0"
+    "danger\0"
+    "danseur\0"
+    "dauphin\0"
+    "débattre\0"
+    "débiter\0"
+    "déborder\0"
+    "débrider\0"
+    "débutant\0"
+    "décaler\0"
+    "décembre\0"
+    "déchirer\0"
+    "décider\0"
+    "déclarer\0"
+    "décorer\0"
+    "décrire\0"
+    "décupler\0"
+    "dédale\0"
+    "déductif\0"
+    "déesse\0"
+    "défensif\0"
+    "défiler\0"
+    "défrayer\0"
+    "dégager\0"
+    "dégivrer\0"
+    "déglutir\0"
+    "dégrafer\0"
+    "déjeuner\0"
+    "délice\0"
+    "déloger\0"
+    "demander\0"
+    "demeurer\0"
+    "démolir\0"
+    "dénicher\0"
+    "dénouer\0"
+    "dentelle\0"
+    "dénuder\0"
+    "départ\0"
+    "dépenser\0"
+    "déphaser\0"
+    "déplacer\0"
+    "déposer\0"
+    "déranger\0"
+    "dérober\0"
+    "désastre\0"
+    "descente\0"
+    "désert\0"
+    "désigner\0"
+    "désobéir\0"
+    "dessiner\0"
+    "destrier\0"
+    "détacher\0"
+    "détester\0"
+    "détourer\0"
+    "détresse\0"
+    "devancer\0"
+    "devenir\0"
+    "deviner\0"
+    "devoir\0"
+    "diable\0"
+    "dialogue\0"
+    "diamant\0"
+    "dicter\0"
+    "différer\0"
+    "digérer\0"
+    "digital\0"
+    "digne\0"
+    "diluer\0"
+    "dimanche\0"
+    "diminuer\0"
+    "dioxyde\0"
+    "directif\0"
+    "diriger\0"
+    "discuter\0"
+    "disposer\0"
+    "dissiper\0"
+    "distance\0"
+    "divertir\0"
+    "diviser\0"
+    "docile\0"
+    "docteur\0"
+    "dogme\0"
+    "doigt\0"
+    "domaine\0"
+    "domicile\0"
+    "dompter\0"
+    "donateur\0"
+    "donjon\0"
+    "donner\0"
+    "dopamine\0"
+    "dortoir\0"
+    "dorure\0"
+    "dosage\0"
+    "doseur\0"
+    "dossier\0"
+    "dotation\0"
+    "douanier\0"
+    "double\0"
+    "douceur\0"
+    "douter\0"
+    "doyen\0"
+    "dragon\0"
+    "draper\0"
+    "dresser\0"
+    "dribbler\0"
+    "droiture\0"
+    "duperie\0"
+    "duplexe\0"
+    "durable\0"
+    "durcir\0"
+    "dynastie\0"
+    "éblouir\0"
+    "écarter\0"
+    "écharpe\0"
+    "échelle\0"
+    "éclairer\0"
+    "éclipse\0"
+    "éclore\0"
+    "écluse\0"
+    "école\0"
+    "économie\0"
+    "écorce\0"
+    "écouter\0"
+    "écraser\0"
+    "écrémer\0"
+    "écrivain\0"
+    "écrou\0"
+    "écume\0"
+    "écureuil\0"
+    "édifier\0"
+    "éduquer\0"
+    "effacer\0"
+    "effectif\0"
+    "effigie\0"
+    "effort\0"
+    "effrayer\0"
+    "effusion\0"
+    "égaliser\0"
+    "égarer\0"
+    "éjecter\0"
+    "élaborer\0"
+    "élargir\0"
+    "électron\0"
+    "élégant\0"
+    "éléphant\0"
+    "élève\0"
+    "éligible\0"
+    "élitisme\0"
+    "éloge\0"
+    "élucider\0"
+    "éluder\0"
+    "emballer\0"
+    "embellir\0"
+    "embryon\0"
+    "émeraude\0"
+    "émission\0"
+    "emmener\0"
+    "émotion\0"
+    "émouvoir\0"
+    "empereur\0"
+    "employer\0"
+    "emporter\0"
+    "emprise\0"
+    "émulsion\0"
+    "encadrer\0"
+    "enchère\0"
+    "enclave\0"
+    "encoche\0"
+    "endiguer\0"
+    "endosser\0"
+    "endroit\0"
+    "enduire\0"
+    "énergie\0"
+    "enfance\0"
+    "enfermer\0"
+    "enfouir\0"
+    "engager\0"
+    "engin\0"
+    "englober\0"
+    "énigme\0"
+    "enjamber\0"
+    "enjeu\0"
+    "enlever\0"
+    "ennemi\0"
+    "ennuyeux\0"
+    "enrichir\0"
+    "enrobage\0"
+    "enseigne\0"
+    "entasser\0"
+    "entendre\0"
+    "entier\0"
+    "entourer\0"
+    "entraver\0"
+    "énumérer\0"
+    "envahir\0"
+    "enviable\0"
+    "envoyer\0"
+    "enzyme\0"
+    "éolien\0"
+    "épaissir\0"
+    "épargne\0"
+    "épatant\0"
+    "épaule\0"
+    "épicerie\0"
+    "épidémie\0"
+    "épier\0"
+    "épilogue\0"
+    "épine\0"
+    "épisode\0"
+    "épitaphe\0"
+    "époque\0"
+    "épreuve\0"
+    "éprouver\0"
+    "épuisant\0"
+    "équerre\0"
+    "équipe\0"
+    "ériger\0"
+    "érosion\0"
+    "erreur\0"
+    "éruption\0"
+    "escalier\0"
+    "espadon\0"
+    "espèce\0"
+    "espiègle\0"
+    "espoir\0"
+    "esprit\0"
+    "esquiver\0"
+    "essayer\0"
+    "essence\0"
+    "essieu\0"
+    "essorer\0"
+    "estime\0"
+    "estomac\0"
+    "estrade\0"
+    "étagère\0"
+    "étaler\0"
+    "étanche\0"
+    "étatique\0"
+    "éteindre\0"
+    "étendoir\0"
+    "éternel\0"
+    "éthanol\0"
+    "éthique\0"
+    "ethnie\0"
+    "étirer\0"
+    "étoffer\0"
+    "étoile\0"
+    "étonnant\0"
+    "étourdir\0"
+    "étrange\0"
+    "étroit\0"
+    "étude\0"
+    "euphorie\0"
+    "évaluer\0"
+    "évasion\0"
+    "éventail\0"
+    "évidence\0"
+    "éviter\0"
+    "évolutif\0"
+    "évoquer\0"
+    "exact\0"
+    "exagérer\0"
+    "exaucer\0"
+    "exceller\0"
+    "excitant\0"
+    "exclusif\0"
+    "excuse\0"
+    "exécuter\0"
+    "exemple\0"
+    "exercer\0"
+    "exhaler\0"
+    "exhorter\0"
+    "exigence\0"
+    "exiler\0"
+    "exister\0"
+    "exotique\0"
+    "expédier\0"
+    "explorer\0"
+    "exposer\0"
+    "exprimer\0"
+    "exquis\0"
+    "extensif\0"
+    "extraire\0"
+    "exulter\0"
+    "fable\0"
+    "fabuleux\0"
+    "facette\0"
+    "facile\0"
+    "facture\0"
+    "faiblir\0"
+    "falaise\0"
+    "fameux\0"
+    "famille\0"
+    "farceur\0"
+    "farfelu\0"
+    "farine\0"
+    "farouche\0"
+    "fasciner\0"
+    "fatal\0"
+    "fatigue\0"
+    "faucon\0"
+    "fautif\0"
+    "faveur\0"
+    "favori\0"
+    "fébrile\0"
+    "féconder\0"
+    "fédérer\0"
+    "félin\0"
+    "femme\0"
+    "fémur\0"
+    "fendoir\0"
+    "féodal\0"
+    "fermer\0"
+    "féroce\0"
+    "ferveur\0"
+    "festival\0"
+    "feuille\0"
+    "feutre\0"
+    "février\0"
+    "fiasco\0"
+    "ficeler\0"
+    "fictif\0"
+    "fidèle\0"
+    "figure\0"
+    "filature\0"
+    "filetage\0"
+    "filière\0"
+    "filleul\0"
+    "filmer\0"
+    "filou\0"
+    "filtrer\0"
+    "financer\0"
+    "finir\0"
+    "fiole\0"
+    "firme\0"
+    "fissure\0"
+    "fixer\0"
+    "flairer\0"
+    "flamme\0"
+    "flasque\0"
+    "flatteur\0"
+    "fléau\0"
+    "flèche\0"
+    "fleur\0"
+    "flexion\0"
+    "flocon\0"
+    "flore\0"
+    "fluctuer\0"
+    "fluide\0"
+    "fluvial\0"
+    "folie\0"
+    "fonderie\0"
+    "fongible\0"
+    "fontaine\0"
+    "forcer\0"
+    "forgeron\0"
+    "formuler\0"
+    "fortune\0"
+    "fossile\0"
+    "foudre\0"
+    "fougère\0"
+    "fouiller\0"
+    "foulure\0"
+    "fourmi\0"
+    "fragile\0"
+    "fraise\0"
+    "franchir\0"
+    "frapper\0"
+    "frayeur\0"
+    "frégate\0"
+    "freiner\0"
+    "frelon\0"
+    "frémir\0"
+    "frénésie\0"
+    "frère\0"
+    "friable\0"
+    "friction\0"
+    "frisson\0"
+    "frivole\0"
+    "froid\0"
+    "fromage\0"
+    "frontal\0"
+    "frotter\0"
+    "fruit\0"
+    "fugitif\0"
+    "fuite\0"
+    "fureur\0"
+    "furieux\0"
+    "furtif\0"
+    "fusion\0"
+    "futur\0"
+    "gagner\0"
+    "galaxie\0"
+    "galerie\0"
+    "gambader\0"
+    "garantir\0"
+    "gardien\0"
+    "garnir\0"
+    "garrigue\0"
+    "gazelle\0"
+    "gazon\0"
+    "géant\0"
+    "gélatine\0"
+    "gélule\0"
+    "gendarme\0"
+    "général\0"
+    "génie\0"
+    "genou\0"
+    "gentil\0"
+    "géologie\0"
+    "géomètre\0"
+    "géranium\0"
+    "germe\0"
+    "gestuel\0"
+    "geyser\0"
+    "gibier\0"
+    "gicler\0"
+    "girafe\0"
+    "givre\0"
+    "glace\0"
+    "glaive\0"
+    "glisser\0"
+    "globe\0"
+    "gloire\0"
+    "glorieux\0"
+    "golfeur\0"
+    "gomme\0"
+    "gonfler\0"
+    "gorge\0"
+    "gorille\0"
+    "goudron\0"
+    "gouffre\0"
+    "goulot\0"
+    "goupille\0"
+    "gourmand\0"
+    "goutte\0"
+    "graduel\0"
+    "graffiti\0"
+    "graine\0"
+    "grand\0"
+    "grappin\0"
+    "gratuit\0"
+    "gravir\0"
+    "grenat\0"
+    "griffure\0"
+    "griller\0"
+    "grimper\0"
+    "grogner\0"
+    "gronder\0"
+    "grotte\0"
+    "groupe\0"
+    "gruger\0"
+    "grutier\0"
+    "gruyère\0"
+    "guépard\0"
+    "guerrier\0"
+    "guide\0"
+    "guimauve\0"
+    "guitare\0"
+    "gustatif\0"
+    "gymnaste\0"
+    "gyrostat\0"
+    "habitude\0"
+    "hachoir\0"
+    "halte\0"
+    "hameau\0"
+    "hangar\0"
+    "hanneton\0"
+    "haricot\0"
+    "harmonie\0"
+    "harpon\0"
+    "hasard\0"
+    "hélium\0"
+    "hématome\0"
+    "herbe\0"
+    "hérisson\0"
+    "hermine\0"
+    "héron\0"
+    "hésiter\0"
+    "heureux\0"
+    "hiberner\0"
+    "hibou\0"
+    "hilarant\0"
+    "histoire\0"
+    "hiver\0"
+    "homard\0"
+    "hommage\0"
+    "homogène\0"
+    "honneur\0"
+    "honorer\0"
+    "honteux\0"
+    "horde\0"
+    "horizon\0"
+    "horloge\0"
+    "hormone\0"
+    "horrible\0"
+    "houleux\0"
+    "housse\0"
+    "hublot\0"
+    "huileux\0"
+    "humain\0"
+    "humble\0"
+    "humide\0"
+    "humour\0"
+    "hurler\0"
+    "hydromel\0"
+    "hygiène\0"
+    "hymne\0"
+    "hypnose\0"
+    "idylle\0"
+    "ignorer\0"
+    "iguane\0"
+    "illicite\0"
+    "illusion\0"
+    "image\0"
+    "imbiber\0"
+    "imiter\0"
+    "immense\0"
+    "immobile\0"
+    "immuable\0"
+    "impact\0"
+    "impérial\0"
+    "implorer\0"
+    "imposer\0"
+    "imprimer\0"
+    "imputer\0"
+    "incarner\0"
+    "incendie\0"
+    "incident\0"
+    "incliner\0"
+    "incolore\0"
+    "indexer\0"
+    "indice\0"
+    "inductif\0"
+    "inédit\0"
+    "ineptie\0"
+    "inexact\0"
+    "infini\0"
+    "infliger\0"
+    "informer\0"
+    "infusion\0"
+    "ingérer\0"
+    "inhaler\0"
+    "inhiber\0"
+    "injecter\0"
+    "injure\0"
+    "innocent\0"
+    "inoculer\0"
+    "inonder\0"
+    "inscrire\0"
+    "insecte\0"
+    "insigne\0"
+    "insolite\0"
+    "inspirer\0"
+    "instinct\0"
+    "insulter\0"
+    "intact\0"
+    "intense\0"
+    "intime\0"
+    "intrigue\0"
+    "intuitif\0"
+    "inutile\0"
+    "invasion\0"
+    "inventer\0"
+    "inviter\0"
+    "invoquer\0"
+    "ironique\0"
+    "irradier\0"
+    "irréel\0"
+    "irriter\0"
+    "isoler\0"
+    "ivoire\0"
+    "ivresse\0"
+    "jaguar\0"
+    "jaillir\0"
+    "jambe\0"
+    "janvier\0"
+    "jardin\0"
+    "jauger\0"
+    "jaune\0"
+    "javelot\0"
+    "jetable\0"
+    "jeton\0"
+    "jeudi\0"
+    "jeunesse\0"
+    "joindre\0"
+    "joncher\0"
+    "jongler\0"
+    "joueur\0"
+    "jouissif\0"
+    "journal\0"
+    "jovial\0"
+    "joyau\0"
+    "joyeux\0"
+    "jubiler\0"
+    "jugement\0"
+    "junior\0"
+    "jupon\0"
+    "juriste\0"
+    "justice\0"
+    "juteux\0"
+    "juvénile\0"
+    "kayak\0"
+    "kimono\0"
+    "kiosque\0"
+    "label\0"
+    "labial\0"
+    "labourer\0"
+    "lacérer\0"
+    "lactose\0"
+    "lagune\0"
+    "laine\0"
+    "laisser\0"
+    "laitier\0"
+    "lambeau\0"
+    "lamelle\0"
+    "lampe\0"
+    "lanceur\0"
+    "langage\0"
+    "lanterne\0"
+    "lapin\0"
+    "largeur\0"
+    "larme\0"
+    "laurier\0"
+    "lavabo\0"
+    "lavoir\0"
+    "lecture\0"
+    "légal\0"
+    "léger\0"
+    "légume\0"
+    "lessive\0"
+    "lettre\0"
+    "levier\0"
+    "lexique\0"
+    "lézard\0"
+    "liasse\0"
+    "libérer\0"
+    "libre\0"
+    "licence\0"
+    "licorne\0"
+    "liège\0"
+    "lièvre\0"
+    "ligature\0"
+    "ligoter\0"
+    "ligue\0"
+    "limer\0"
+    "limite\0"
+    "limonade\0"
+    "limpide\0"
+    "linéaire\0"
+    "lingot\0"
+    "lionceau\0"
+    "liquide\0"
+    "lisière\0"
+    "lister\0"
+    "lithium\0"
+    "litige\0"
+    "littoral\0"
+    "livreur\0"
+    "logique\0"
+    "lointain\0"
+    "loisir\0"
+    "lombric\0"
+    "loterie\0"
+    "louer\0"
+    "lourd\0"
+    "loutre\0"
+    "louve\0"
+    "loyal\0"
+    "lubie\0"
+    "lucide\0"
+    "lucratif\0"
+    "lueur\0"
+    "lugubre\0"
+    "luisant\0"
+    "lumière\0"
+    "lunaire\0"
+    "lundi\0"
+    "luron\0"
+    "lutter\0"
+    "luxueux\0"
+    "machine\0"
+    "magasin\0"
+    "magenta\0"
+    "magique\0"
+    "maigre\0"
+    "maillon\0"
+    "maintien\0"
+    "mairie\0"
+    "maison\0"
+    "majorer\0"
+    "malaxer\0"
+    "maléfice\0"
+    "malheur\0"
+    "malice\0"
+    "mallette\0"
+    "mammouth\0"
+    "mandater\0"
+    "maniable\0"
+    "manquant\0"
+    "manteau\0"
+    "manuel\0"
+    "marathon\0"
+    "marbre\0"
+    "marchand\0"
+    "mardi\0"
+    "maritime\0"
+    "marqueur\0"
+    "marron\0"
+    "marteler\0"
+    "mascotte\0"
+    "massif\0"
+    "matériel\0"
+    "matière\0"
+    "matraque\0"
+    "maudire\0"
+    "maussade\0"
+    "mauve\0"
+    "maximal\0"
+    "méchant\0"
+    "méconnu\0"
+    "médaille\0"
+    "médecin\0"
+    "méditer\0"
+    "méduse\0"
+    "meilleur\0"
+    "mélange\0"
+    "mélodie\0"
+    "membre\0"
+    "mémoire\0"
+    "menacer\0"
+    "mener\0"
+    "menhir\0"
+    "mensonge\0"
+    "mentor\0"
+    "mercredi\0"
+    "mérite\0"
+    "merle\0"
+    "messager\0"
+    "mesure\0"
+    "métal\0"
+    "météore\0"
+    "méthode\0"
+    "métier\0"
+    "meuble\0"
+    "miauler\0"
+    "microbe\0"
+    "miette\0"
+    "mignon\0"
+    "migrer\0"
+    "milieu\0"
+    "million\0"
+    "mimique\0"
+    "mince\0"
+    "minéral\0"
+    "minimal\0"
+    "minorer\0"
+    "minute\0"
+    "miracle\0"
+    "miroiter\0"
+    "missile\0"
+    "mixte\0"
+    "mobile\0"
+    "moderne\0"
+    "moelleux\0"
+    "mondial\0"
+    "moniteur\0"
+    "monnaie\0"
+    "monotone\0"
+    "monstre\0"
+    "montagne\0"
+    "monument\0"
+    "moqueur\0"
+    "morceau\0"
+    "morsure\0"
+    "mortier\0"
+    "moteur\0"
+    "motif\0"
+    "mouche\0"
+    "moufle\0"
+    "moulin\0"
+    "mousson\0"
+    "mouton\0"
+    "mouvant\0"
+    "multiple\0"
+    "munition\0"
+    "muraille\0"
+    "murène\0"
+    "murmure\0"
+    "muscle\0"
+    "muséum\0"
+    "musicien\0"
+    "mutation\0"
+    "muter\0"
+    "mutuel\0"
+    "myriade\0"
+    "myrtille\0"
+    "mystère\0"
+    "mythique\0"
+    "nageur\0"
+    "nappe\0"
+    "narquois\0"
+    "narrer\0"
+    "natation\0"
+    "nation\0"
+    "nature\0"
+    "naufrage\0"
+    "nautique\0"
+    "navire\0"
+    "nébuleux\0"
+    "nectar\0"
+    "néfaste\0"
+    "négation\0"
+    "négliger\0"
+    "négocier\0"
+    "neige\0"
+    "nerveux\0"
+    "nettoyer\0"
+    "neurone\0"
+    "neutron\0"
+    "neveu\0"
+    "niche\0"
+    "nickel\0"
+    "nitrate\0"
+    "niveau\0"
+    "noble\0"
+    "nocif\0"
+    "nocturne\0"
+    "noirceur\0"
+    "noisette\0"
+    "nomade\0"
+    "nombreux\0"
+    "nommer\0"
+    "normatif\0"
+    "notable\0"
+    "notifier\0"
+    "notoire\0"
+    "nourrir\0"
+    "nouveau\0"
+    "novateur\0"
+    "novembre\0"
+    "novice\0"
+    "nuage\0"
+    "nuancer\0"
+    "nuire\0"
+    "nuisible\0"
+    "numéro\0"
+    "nuptial\0"
+    "nuque\0"
+    "nutritif\0"
+    "obéir\0"
+    "objectif\0"
+    "obliger\0"
+    "obscur\0"
+    "observer\0"
+    "obstacle\0"
+    "obtenir\0"
+    "obturer\0"
+    "occasion\0"
+    "occuper\0"
+    "océan\0"
+    "octobre\0"
+    "octroyer\0"
+    "octupler\0"
+    "oculaire\0"
+    "odeur\0"
+    "odorant\0"
+    "offenser\0"
+    "officier\0"
+    "offrir\0"
+    "ogive\0"
+    "oiseau\0"
+    "oisillon\0"
+    "olfactif\0"
+    "olivier\0"
+    "ombrage\0"
+    "omettre\0"
+    "onctueux\0"
+    "onduler\0"
+    "onéreux\0"
+    "onirique\0"
+    "opale\0"
+    "opaque\0"
+    "opérer\0"
+    "opinion\0"
+    "opportun\0"
+    "opprimer\0"
+    "opter\0"
+    "optique\0"
+    "orageux\0"
+    "orange\0"
+    "orbite\0"
+    "ordonner\0"
+    "oreille\0"
+    "organe\0"
+    "orgueil\0"
+    "orifice\0"
+    "ornement\0"
+    "orque\0"
+    "ortie\0"
+    "osciller\0"
+    "osmose\0"
+    "ossature\0"
+    "otarie\0"
+    "ouragan\0"
+    "ourson\0"
+    "outil\0"
+    "outrager\0"
+    "ouvrage\0"
+    "ovation\0"
+    "oxyde\0"
+    "oxygène\0"
+    "ozone\0"
+    "paisible\0"
+    "palace\0"
+    "palmarès\0"
+    "palourde\0"
+    "palper\0"
+    "panache\0"
+    "panda\0"
+    "pangolin\0"
+    "paniquer\0"
+    "panneau\0"
+    "panorama\0"
+    "pantalon\0"
+    "papaye\0"
+    "papier\0"
+    "papoter\0"
+    "papyrus\0"
+    "paradoxe\0"
+    "parcelle\0"
+    "paresse\0"
+    "parfumer\0"
+    "parler\0"
+    "parole\0"
+    "parrain\0"
+    "parsemer\0"
+    "partager\0"
+    "parure\0"
+    "parvenir\0"
+    "passion\0"
+    "pastèque\0"
+    "paternel\0"
+    "patience\0"
+    "patron\0"
+    "pavillon\0"
+    "pavoiser\0"
+    "payer\0"
+    "paysage\0"
+    "peigne\0"
+    "peintre\0"
+    "pelage\0"
+    "pélican\0"
+    "pelle\0"
+    "pelouse\0"
+    "peluche\0"
+    "pendule\0"
+    "pénétrer\0"
+    "pénible\0"
+    "pensif\0"
+    "pénurie\0"
+    "pépite\0"
+    "péplum\0"
+    "perdrix\0"
+    "perforer\0"
+    "période\0"
+    "permuter\0"
+    "perplexe\0"
+    "persil\0"
+    "perte\0"
+    "peser\0"
+    "pétale\0"
+    "petit\0"
+    "pétrir\0"
+    "peuple\0"
+    "pharaon\0"
+    "phobie\0"
+    "phoque\0"
+    "photon\0"
+    "phrase\0"
+    "physique\0"
+    "piano\0"
+    "pictural\0"
+    "pièce\0"
+    "pierre\0"
+    "pieuvre\0"
+    "pilote\0"
+    "pinceau\0"
+    "pipette\0"
+    "piquer\0"
+    "pirogue\0"
+    "piscine\0"
+    "piston\0"
+    "pivoter\0"
+    "pixel\0"
+    "pizza\0"
+    "placard\0"
+    "plafond\0"
+    "plaisir\0"
+    "planer\0"
+    "plaque\0"
+    "plastron\0"
+    "plateau\0"
+    "pleurer\0"
+    "plexus\0"
+    "pliage\0"
+    "plomb\0"
+    "plonger\0"
+    "pluie\0"
+    "plumage\0"
+    "pochette\0"
+    "poésie\0"
+    "poète\0"
+    "pointe\0"
+    "poirier\0"
+    "poisson\0"
+    "poivre\0"
+    "polaire\0"
+    "policier\0"
+    "pollen\0"
+    "polygone\0"
+    "pommade\0"
+    "pompier\0"
+    "ponctuel\0"
+    "pondérer\0"
+    "poney\0"
+    "portique\0"
+    "position\0"
+    "posséder\0"
+    "posture\0"
+    "potager\0"
+    "poteau\0"
+    "potion\0"
+    "pouce\0"
+    "poulain\0"
+    "poumon\0"
+    "pourpre\0"
+    "poussin\0"
+    "pouvoir\0"
+    "prairie\0"
+    "pratique\0"
+    "précieux\0"
+    "prédire\0"
+    "préfixe\0"
+    "prélude\0"
+    "prénom\0"
+    "présence\0"
+    "prétexte\0"
+    "prévoir\0"
+    "primitif\0"
+    "prince\0"
+    "prison\0"
+    "priver\0"
+    "problème\0"
+    "procéder\0"
+    "prodige\0"
+    "profond\0"
+    "progrès\0"
+    "proie\0"
+    "projeter\0"
+    "prologue\0"
+    "promener\0"
+    "propre\0"
+    "prospère\0"
+    "protéger\0"
+    "prouesse\0"
+    "proverbe\0"
+    "prudence\0"
+    "pruneau\0"
+    "psychose\0"
+    "public\0"
+    "puceron\0"
+    "puiser\0"
+    "pulpe\0"
+    "pulsar\0"
+    "punaise\0"
+    "punitif\0"
+    "pupitre\0"
+    "purifier\0"
+    "puzzle\0"
+    "pyramide\0"
+    "quasar\0"
+    "querelle\0"
+    "question\0"
+    "quiétude\0"
+    "quitter\0"
+    "quotient\0"
+    "racine\0"
+    "raconter\0"
+    "radieux\0"
+    "ragondin\0"
+    "raideur\0"
+    "raisin\0"
+    "ralentir\0"
+    "rallonge\0"
+    "ramasser\0"
+    "rapide\0"
+    "rasage\0"
+    "ratisser\0"
+    "ravager\0"
+    "ravin\0"
+    "rayonner\0"
+    "réactif\0"
+    "réagir\0"
+    "réaliser\0"
+    "réanimer\0"
+    "recevoir\0"
+    "réciter\0"
+    "réclamer\0"
+    "récolter\0"
+    "recruter\0"
+    "reculer\0"
+    "recycler\0"
+    "rédiger\0"
+    "redouter\0"
+    "refaire\0"
+    "réflexe\0"
+    "réformer\0"
+    "refrain\0"
+    "refuge\0"
+    "régalien\0"
+    "région\0"
+    "réglage\0"
+    "régulier\0"
+    "réitérer\0"
+    "rejeter\0"
+    "rejouer\0"
+    "relatif\0"
+    "relever\0"
+    "relief\0"
+    "remarque\0"
+    "remède\0"
+    "remise\0"
+    "remonter\0"
+    "remplir\0"
+    "remuer\0"
+    "renard\0"
+    "renfort\0"
+    "renifler\0"
+    "renoncer\0"
+    "rentrer\0"
+    "renvoi\0"
+    "replier\0"
+    "reporter\0"
+    "reprise\0"
+    "reptile\0"
+    "requin\0"
+    "réserve\0"
+    "résineux\0"
+    "résoudre\0"
+    "respect\0"
+    "rester\0"
+    "résultat\0"
+    "rétablir\0"
+    "retenir\0"
+    "réticule\0"
+    "retomber\0"
+    "retracer\0"
+    "réunion\0"
+    "réussir\0"
+    "revanche\0"
+    "revivre\0"
+    "révolte\0"
+    "révulsif\0"
+    "richesse\0"
+    "rideau\0"
+    "rieur\0"
+    "rigide\0"
+    "rigoler\0"
+    "rincer\0"
+    "riposter\0"
+    "risible\0"
+    "risque\0"
+    "rituel\0"
+    "rival\0"
+    "rivière\0"
+    "rocheux\0"
+    "romance\0"
+    "rompre\0"
+    "ronce\0"
+    "rondin\0"
+    "roseau\0"
+    "rosier\0"
+    "rotatif\0"
+    "rotor\0"
+    "rotule\0"
+    "rouge\0"
+    "rouille\0"
+    "rouleau\0"
+    "routine\0"
+    "royaume\0"
+    "ruban\0"
+    "rubis\0"
+    "ruche\0"
+    "ruelle\0"
+    "rugueux\0"
+    "ruiner\0"
+    "ruisseau\0"
+    "ruser\0"
+    "rustique\0"
+    "rythme\0"
+    "sabler\0"
+    "saboter\0"
+    "sabre\0"
+    "sacoche\0"
+    "safari\0"
+    "sagesse\0"
+    "saisir\0"
+    "salade\0"
+    "salive\0"
+    "salon\0"
+    "saluer\0"
+    "samedi\0"
+    "sanction\0"
+    "sanglier\0"
+    "sarcasme\0"
+    "sardine\0"
+    "saturer\0"
+    "saugrenu\0"
+    "saumon\0"
+    "sauter\0"
+    "sauvage\0"
+    "savant\0"
+    "savonner\0"
+    "scalpel\0"
+    "scandale\0"
+    "scélérat\0"
+    "scénario\0"
+    "sceptre\0"
+    "schéma\0"
+    "science\0"
+    "scinder\0"
+    "score\0"
+    "scrutin\0"
+    "sculpter\0"
+    "séance\0"
+    "sécable\0"
+    "sécher\0"
+    "secouer\0"
+    "sécréter\0"
+    "sédatif\0"
+    "séduire\0"
+    "seigneur\0"
+    "séjour\0"
+    "sélectif\0"
+    "semaine\0"
+    "sembler\0"
+    "semence\0"
+    "séminal\0"
+    "sénateur\0"
+    "sensible\0"
+    "sentence\0"
+    "séparer\0"
+    "séquence\0"
+    "serein\0"
+    "sergent\0"
+    "sérieux\0"
+    "serrure\0"
+    "sérum\0"
+    "service\0"
+    "sésame\0"
+    "sévir\0"
+    "sevrage\0"
+    "sextuple\0"
+    "sidéral\0"
+    "siècle\0"
+    "siéger\0"
+    "siffler\0"
+    "sigle\0"
+    "signal\0"
+    "silence\0"
+    "silicium\0"
+    "simple\0"
+    "sincère\0"
+    "sinistre\0"
+    "siphon\0"
+    "sirop\0"
+    "sismique\0"
+    "situer\0"
+    "skier\0"
+    "social\0"
+    "socle\0"
+    "sodium\0"
+    "soigneux\0"
+    "soldat\0"
+    "soleil\0"
+    "solitude\0"
+    "soluble\0"
+    "sombre\0"
+    "sommeil\0"
+    "somnoler\0"
+    "sonde\0"
+    "songeur\0"
+    "sonnette\0"
+    "sonore\0"
+    "sorcier\0"
+    "sortir\0"
+    "sosie\0"
+    "sottise\0"
+    "soucieux\0"
+    "soudure\0"
+    "souffle\0"
+    "soulever\0"
+    "soupape\0"
+    "source\0"
+    "soutirer\0"
+    "souvenir\0"
+    "spacieux\0"
+    "spatial\0"
+    "spécial\0"
+    "sphère\0"
+    "spiral\0"
+    "stable\0"
+    "station\0"
+    "sternum\0"
+    "stimulus\0"
+    "stipuler\0"
+    "strict\0"
+    "studieux\0"
+    "stupeur\0"
+    "styliste\0"
+    "sublime\0"
+    "substrat\0"
+    "subtil\0"
+    "subvenir\0"
+    "succès\0"
+    "sucre\0"
+    "suffixe\0"
+    "suggérer\0"
+    "suiveur\0"
+    "sulfate\0"
+    "superbe\0"
+    "supplier\0"
+    "surface\0"
+    "suricate\0"
+    "surmener\0"
+    "surprise\0"
+    "sursaut\0"
+    "survie\0"
+    "suspect\0"
+    "syllabe\0"
+    "symbole\0"
+    "symétrie\0"
+    "synapse\0"
+    "syntaxe\0"
+    "système\0"
+    "tabac\0"
+    "tablier\0"
+    "tactile\0"
+    "tailler\0"
+    "talent\0"
+    "talisman\0"
+    "talonner\0"
+    "tambour\0"
+    "tamiser\0"
+    "tangible\0"
+    "tapis\0"
+    "taquiner\0"
+    "tarder\0"
+    "tarif\0"
+    "tartine\0"
+    "tasse\0"
+    "tatami\0"
+    "tatouage\0"
+    "taupe\0"
+    "taureau\0"
+    "taxer\0"
+    "témoin\0"
+    "temporel\0"
+    "tenaille\0"
+    "tendre\0"
+    "teneur\0"
+    "tenir\0"
+    "tension\0"
+    "terminer\0"
+    "terne\0"
+    "terrible\0"
+    "tétine\0"
+    "texte\0"
+    "thème\0"
+    "théorie\0"
+    "thérapie\0"
+    "thorax\0"
+    "tibia\0"
+    "tiède\0"
+    "timide\0"
+    "tirelire\0"
+    "tiroir\0"
+    "tissu\0"
+    "titane\0"
+    "titre\0"
+    "tituber\0"
+    "toboggan\0"
+    "tolérant\0"
+    "tomate\0"
+    "tonique\0"
+    "tonneau\0"
+    "toponyme\0"
+    "torche\0"
+    "tordre\0"
+    "tornade\0"
+    "torpille\0"
+    "torrent\0"
+    "torse\0"
+    "tortue\0"
+    "totem\0"
+    "toucher\0"
+    "tournage\0"
+    "tousser\0"
+    "toxine\0"
+    "traction\0"
+    "trafic\0"
+    "tragique\0"
+    "trahir\0"
+    "train\0"
+    "trancher\0"
+    "travail\0"
+    "trèfle\0"
+    "tremper\0"
+    "trésor\0"
+    "treuil\0"
+    "triage\0"
+    "tribunal\0"
+    "tricoter\0"
+    "trilogie\0"
+    "triomphe\0"
+    "tripler\0"
+    "triturer\0"
+    "trivial\0"
+    "trombone\0"
+    "tronc\0"
+    "tropical\0"
+    "troupeau\0"
+    "tuile\0"
+    "tulipe\0"
+    "tumulte\0"
+    "tunnel\0"
+    "turbine\0"
+    "tuteur\0"
+    "tutoyer\0"
+    "tuyau\0"
+    "tympan\0"
+    "typhon\0"
+    "typique\0"
+    "tyran\0"
+    "ubuesque\0"
+    "ultime\0"
+    "ultrason\0"
+    "unanime\0"
+    "unifier\0"
+    "union\0"
+    "unique\0"
+    "unitaire\0"
+    "univers\0"
+    "uranium\0"
+    "urbain\0"
+    "urticant\0"
+    "usage\0"
+    "usine\0"
+    "usuel\0"
+    "usure\0"
+    "utile\0"
+    "utopie\0"
+    "vacarme\0"
+    "vaccin\0"
+    "vagabond\0"
+    "vague\0"
+    "vaillant\0"
+    "vaincre\0"
+    "vaisseau\0"
+    "valable\0"
+    "valise\0"
+    "vallon\0"
+    "valve\0"
+    "vampire\0"
+    "vanille\0"
+    "vapeur\0"
+    "varier\0"
+    "vaseux\0"
+    "vassal\0"
+    "vaste\0"
+    "vecteur\0"
+    "vedette\0"
+    "végétal\0"
+    "véhicule\0"
+    "veinard\0"
+    "véloce\0"
+    "vendredi\0"
+    "vénérer\0"
+    "venger\0"
+    "venimeux\0"
+    "ventouse\0"
+    "verdure\0"
+    "vérin\0"
+    "vernir\0"
+    "verrou\0"
+    "verser\0"
+    "vertu\0"
+    "veston\0"
+    "vétéran\0"
+    "vétuste\0"
+    "vexant\0"
+    "vexer\0"
+    "viaduc\0"
+    "viande\0"
+    "victoire\0"
+    "vidange\0"
+    "vidéo\0"
+    "vignette\0"
+    "vigueur\0"
+    "vilain\0"
+    "village\0"
+    "vinaigre\0"
+    "violon\0"
+    "vipère\0"
+    "virement\0"
+    "virtuose\0"
+    "virus\0"
+    "visage\0"
+    "viseur\0"
+    "vision\0"
+    "visqueux\0"
+    "visuel\0"
+    "vital\0"
+    "vitesse\0"
+    "viticole\0"
+    "vitrine\0"
+    "vivace\0"
+    "vivipare\0"
+    "vocation\0"
+    "voguer\0"
+    "voile\0"
+    "voisin\0"
+    "voiture\0"
+    "volaille\0"
+    "volcan\0"
+    "voltiger\0"
+    "volume\0"
+    "vorace\0"
+    "vortex\0"
+    "voter\0"
+    "vouloir\0"
+    "voyage\0"
+    "voyelle\0"
+    "wagon\0"
+    "xénon\0"
+    "yacht\0"
+    "zèbre\0"
+    "zénith\0"
+    "zeste\0"
+    "zoologie";
+
+static const uint16_t fr_offsets[dictionary_size] =
 {
-    {
-        "abaisser",
-        "abandon",
-        "abdiquer",
-        "abeille",
-        "abolir",
-        "aborder",
-        "aboutir",
-        "aboyer",
-        "abrasif",
-        "abreuver",
-        "abriter",
-        "abroger",
-        "abrupt",
-        "absence",
-        "absolu",
-        "absurde",
-        "abusif",
-        "abyssal",
-        "académie",
-        "acajou",
-        "acarien",
-        "accabler",
-        "accepter",
-        "acclamer",
-        "accolade",
-        "accroche",
-        "accuser",
-        "acerbe",
-        "achat",
-        "acheter",
-        "aciduler",
-        "acier",
-        "acompte",
-        "acquérir",
-        "acronyme",
-        "acteur",
-        "actif",
-        "actuel",
-        "adepte",
-        "adéquat",
-        "adhésif",
-        "adjectif",
-        "adjuger",
-        "admettre",
-        "admirer",
-        "adopter",
-        "adorer",
-        "adoucir",
-        "adresse",
-        "adroit",
-        "adulte",
-        "adverbe",
-        "aérer",
-        "aéronef",
-        "affaire",
-        "affecter",
-        "affiche",
-        "affreux",
-        "affubler",
-        "agacer",
-        "agencer",
-        "agile",
-        "agiter",
-        "agrafer",
-        "agréable",
-        "agrume",
-        "aider",
-        "aiguille",
-        "ailier",
-        "aimable",
-        "aisance",
-        "ajouter",
-        "ajuster",
-        "alarmer",
-        "alchimie",
-        "alerte",
-        "algèbre",
-        "algue",
-        "aliéner",
-        "aliment",
-        "alléger",
-        "alliage",
-        "allouer",
-        "allumer",
-        "alourdir",
-        "alpaga",
-        "altesse",
-        "alvéole",
-        "amateur",
-        "ambigu",
-        "ambre",
-        "aménager",
-        "amertume",
-        "amidon",
-        "amiral",
-        "amorcer",
-        "amour",
-        "amovible",
-        "amphibie",
-        "ampleur",
-        "amusant",
-        "analyse",
-        "anaphore",
-        "anarchie",
-        "anatomie",
-        "ancien",
-        "anéantir",
-        "angle",
-        "angoisse",
-        "anguleux",
-        "animal",
-        "annexer",
-        "annonce",
-        "annuel",
-        "anodin",
-        "anomalie",
-        "anonyme",
-        "anormal",
-        "antenne",
-        "antidote",
-        "anxieux",
-        "apaiser",
-        "apéritif",
-        "aplanir",
-        "apologie",
-        "appareil",
-        "appeler",
-        "apporter",
-        "appuyer",
-        "aquarium",
-        "aqueduc",
-        "arbitre",
-        "arbuste",
-        "ardeur",
-        "ardoise",
-        "argent",
-        "arlequin",
-        "armature",
-        "armement",
-        "armoire",
-        "armure",
-        "arpenter",
-        "arracher",
-        "arriver",
-        "arroser",
-        "arsenic",
-        "artériel",
-        "article",
-        "aspect",
-        "asphalte",
-        "aspirer",
-        "assaut",
-        "asservir",
-        "assiette",
-        "associer",
-        "assurer",
-        "asticot",
-        "astre",
-        "astuce",
-        "atelier",
-        "atome",
-        "atrium",
-        "atroce",
-        "attaque",
-        "attentif",
-        "attirer",
-        "attraper",
-        "aubaine",
-        "auberge",
-        "audace",
-        "audible",
-        "augurer",
-        "aurore",
-        "automne",
-        "autruche",
-        "avaler",
-        "avancer",
-        "avarice",
-        "avenir",
-        "averse",
-        "aveugle",
-        "aviateur",
-        "avide",
-        "avion",
-        "aviser",
-        "avoine",
-        "avouer",
-        "avril",
-        "axial",
-        "axiome",
-        "badge",
-        "bafouer",
-        "bagage",
-        "baguette",
-        "baignade",
-        "balancer",
-        "balcon",
-        "baleine",
-        "balisage",
-        "bambin",
-        "bancaire",
-        "bandage",
-        "banlieue",
-        "bannière",
-        "banquier",
-        "barbier",
-        "baril",
-        "baron",
-        "barque",
-        "barrage",
-        "bassin",
-        "bastion",
-        "bataille",
-        "bateau",
-        "batterie",
-        "baudrier",
-        "bavarder",
-        "belette",
-        "bélier",
-        "belote",
-        "bénéfice",
-        "berceau",
-        "berger",
-        "berline",
-        "bermuda",
-        "besace",
-        "besogne",
-        "bétail",
-        "beurre",
-        "biberon",
-        "bicycle",
-        "bidule",
-        "bijou",
-        "bilan",
-        "bilingue",
-        "billard",
-        "binaire",
-        "biologie",
-        "biopsie",
-        "biotype",
-        "biscuit",
-        "bison",
-        "bistouri",
-        "bitume",
-        "bizarre",
-        "blafard",
-        "blague",
-        "blanchir",
-        "blessant",
-        "blinder",
-        "blond",
-        "bloquer",
-        "blouson",
-        "bobard",
-        "bobine",
-        "boire",
-        "boiser",
-        "bolide",
-        "bonbon",
-        "bondir",
-        "bonheur",
-        "bonifier",
-        "bonus",
-        "bordure",
-        "borne",
-        "botte",
-        "boucle",
-        "boueux",
-        "bougie",
-        "boulon",
-        "bouquin",
-        "bourse",
-        "boussole",
-        "boutique",
-        "boxeur",
-        "branche",
-        "brasier",
-        "brave",
-        "brebis",
-        "brèche",
-        "breuvage",
-        "bricoler",
-        "brigade",
-        "brillant",
-        "brioche",
-        "brique",
-        "brochure",
-        "broder",
-        "bronzer",
-        "brousse",
-        "broyeur",
-        "brume",
-        "brusque",
-        "brutal",
-        "bruyant",
-        "buffle",
-        "buisson",
-        "bulletin",
-        "bureau",
-        "burin",
-        "bustier",
-        "butiner",
-        "butoir",
-        "buvable",
-        "buvette",
-        "cabanon",
-        "cabine",
-        "cachette",
-        "cadeau",
-        "cadre",
-        "caféine",
-        "caillou",
-        "caisson",
-        "calculer",
-        "calepin",
-        "calibre",
-        "calmer",
-        "calomnie",
-        "calvaire",
-        "camarade",
-        "caméra",
-        "camion",
-        "campagne",
-        "canal",
-        "caneton",
-        "canon",
-        "cantine",
-        "canular",
-        "capable",
-        "caporal",
-        "caprice",
-        "capsule",
-        "capter",
-        "capuche",
-        "carabine",
-        "carbone",
-        "caresser",
-        "caribou",
-        "carnage",
-        "carotte",
-        "carreau",
-        "carton",
-        "cascade",
-        "casier",
-        "casque",
-        "cassure",
-        "causer",
-        "caution",
-        "cavalier",
-        "caverne",
-        "caviar",
-        "cédille",
-        "ceinture",
-        "céleste",
-        "cellule",
-        "cendrier",
-        "censurer",
-        "central",
-        "cercle",
-        "cérébral",
-        "cerise",
-        "cerner",
-        "cerveau",
-        "cesser",
-        "chagrin",
-        "chaise",
-        "chaleur",
-        "chambre",
-        "chance",
-        "chapitre",
-        "charbon",
-        "chasseur",
-        "chaton",
-        "chausson",
-        "chavirer",
-        "chemise",
-        "chenille",
-        "chéquier",
-        "chercher",
-        "cheval",
-        "chien",
-        "chiffre",
-        "chignon",
-        "chimère",
-        "chiot",
-        "chlorure",
-        "chocolat",
-        "choisir",
-        "chose",
-        "chouette",
-        "chrome",
-        "chute",
-        "cigare",
-        "cigogne",
-        "cimenter",
-        "cinéma",
-        "cintrer",
-        "circuler",
-        "cirer",
-        "cirque",
-        "citerne",
-        "citoyen",
-        "citron",
-        "civil",
-        "clairon",
-        "clameur",
-        "claquer",
-        "classe",
-        "clavier",
-        "client",
-        "cligner",
-        "climat",
-        "clivage",
-        "cloche",
-        "clonage",
-        "cloporte",
-        "cobalt",
-        "cobra",
-        "cocasse",
-        "cocotier",
-        "coder",
-        "codifier",
-        "coffre",
-        "cogner",
-        "cohésion",
-        "coiffer",
-        "coincer",
-        "colère",
-        "colibri",
-        "colline",
-        "colmater",
-        "colonel",
-        "combat",
-        "comédie",
-        "commande",
-        "compact",
-        "concert",
-        "conduire",
-        "confier",
-        "congeler",
-        "connoter",
-        "consonne",
-        "contact",
-        "convexe",
-        "copain",
-        "copie",
-        "corail",
-        "corbeau",
-        "cordage",
-        "corniche",
-        "corpus",
-        "correct",
-        "cortège",
-        "cosmique",
-        "costume",
-        "coton",
-        "coude",
-        "coupure",
-        "courage",
-        "couteau",
-        "couvrir",
-        "coyote",
-        "crabe",
-        "crainte",
-        "cravate",
-        "crayon",
-        "créature",
-        "créditer",
-        "crémeux",
-        "creuser",
-        "crevette",
-        "cribler",
-        "crier",
-        "cristal",
-        "critère",
-        "croire",
-        "croquer",
-        "crotale",
-        "crucial",
-        "cruel",
-        "crypter",
-        "cubique",
-        "cueillir",
-        "cuillère",
-        "cuisine",
-        "cuivre",
-        "culminer",
-        "cultiver",
-        "cumuler",
-        "cupide",
-        "curatif",
-        "curseur",
-        "cyanure",
-        "cycle",
-        "cylindre",
-        "cynique",
-        "daigner",
-        "damier",
-        "danger",
-        "danseur",
-        "dauphin",
-        "débattre",
-        "débiter",
-        "déborder",
-        "débrider",
-        "débutant",
-        "décaler",
-        "décembre",
-        "déchirer",
-        "décider",
-        "déclarer",
-        "décorer",
-        "décrire",
-        "décupler",
-        "dédale",
-        "déductif",
-        "déesse",
-        "défensif",
-        "défiler",
-        "défrayer",
-        "dégager",
-        "dégivrer",
-        "déglutir",
-        "dégrafer",
-        "déjeuner",
-        "délice",
-        "déloger",
-        "demander",
-        "demeurer",
-        "démolir",
-        "dénicher",
-        "dénouer",
-        "dentelle",
-        "dénuder",
-        "départ",
-        "dépenser",
-        "déphaser",
-        "déplacer",
-        "déposer",
-        "déranger",
-        "dérober",
-        "désastre",
-        "descente",
-        "désert",
-        "désigner",
-        "désobéir",
-        "dessiner",
-        "destrier",
-        "détacher",
-        "détester",
-        "détourer",
-        "détresse",
-        "devancer",
-        "devenir",
-        "deviner",
-        "devoir",
-        "diable",
-        "dialogue",
-        "diamant",
-        "dicter",
-        "différer",
-        "digérer",
-        "digital",
-        "digne",
-        "diluer",
-        "dimanche",
-        "diminuer",
-        "dioxyde",
-        "directif",
-        "diriger",
-        "discuter",
-        "disposer",
-        "dissiper",
-        "distance",
-        "divertir",
-        "diviser",
-        "docile",
-        "docteur",
-        "dogme",
-        "doigt",
-        "domaine",
-        "domicile",
-        "dompter",
-        "donateur",
-        "donjon",
-        "donner",
-        "dopamine",
-        "dortoir",
-        "dorure",
-        "dosage",
-        "doseur",
-        "dossier",
-        "dotation",
-        "douanier",
-        "double",
-        "douceur",
-        "douter",
-        "doyen",
-        "dragon",
-        "draper",
-        "dresser",
-        "dribbler",
-        "droiture",
-        "duperie",
-        "duplexe",
-        "durable",
-        "durcir",
-        "dynastie",
-        "éblouir",
-        "écarter",
-        "écharpe",
-        "échelle",
-        "éclairer",
-        "éclipse",
-        "éclore",
-        "écluse",
-        "école",
-        "économie",
-        "écorce",
-        "écouter",
-        "écraser",
-        "écrémer",
-        "écrivain",
-        "écrou",
-        "écume",
-        "écureuil",
-        "édifier",
-        "éduquer",
-        "effacer",
-        "effectif",
-        "effigie",
-        "effort",
-        "effrayer",
-        "effusion",
-        "égaliser",
-        "égarer",
-        "éjecter",
-        "élaborer",
-        "élargir",
-        "électron",
-        "élégant",
-        "éléphant",
-        "élève",
-        "éligible",
-        "élitisme",
-        "éloge",
-        "élucider",
-        "éluder",
-        "emballer",
-        "embellir",
-        "embryon",
-        "émeraude",
-        "émission",
-        "emmener",
-        "émotion",
-        "émouvoir",
-        "empereur",
-        "employer",
-        "emporter",
-        "emprise",
-        "émulsion",
-        "encadrer",
-        "enchère",
-        "enclave",
-        "encoche",
-        "endiguer",
-        "endosser",
-        "endroit",
-        "enduire",
-        "énergie",
-        "enfance",
-        "enfermer",
-        "enfouir",
-        "engager",
-        "engin",
-        "englober",
-        "énigme",
-        "enjamber",
-        "enjeu",
-        "enlever",
-        "ennemi",
-        "ennuyeux",
-        "enrichir",
-        "enrobage",
-        "enseigne",
-        "entasser",
-        "entendre",
-        "entier",
-        "entourer",
-        "entraver",
-        "énumérer",
-        "envahir",
-        "enviable",
-        "envoyer",
-        "enzyme",
-        "éolien",
-        "épaissir",
-        "épargne",
-        "épatant",
-        "épaule",
-        "épicerie",
-        "épidémie",
-        "épier",
-        "épilogue",
-        "épine",
-        "épisode",
-        "épitaphe",
-        "époque",
-        "épreuve",
-        "éprouver",
-        "épuisant",
-        "équerre",
-        "équipe",
-        "ériger",
-        "érosion",
-        "erreur",
-        "éruption",
-        "escalier",
-        "espadon",
-        "espèce",
-        "espiègle",
-        "espoir",
-        "esprit",
-        "esquiver",
-        "essayer",
-        "essence",
-        "essieu",
-        "essorer",
-        "estime",
-        "estomac",
-        "estrade",
-        "étagère",
-        "étaler",
-        "étanche",
-        "étatique",
-        "éteindre",
-        "étendoir",
-        "éternel",
-        "éthanol",
-        "éthique",
-        "ethnie",
-        "étirer",
-        "étoffer",
-        "étoile",
-        "étonnant",
-        "étourdir",
-        "étrange",
-        "étroit",
-        "étude",
-        "euphorie",
-        "évaluer",
-        "évasion",
-        "éventail",
-        "évidence",
-        "éviter",
-        "évolutif",
-        "évoquer",
-        "exact",
-        "exagérer",
-        "exaucer",
-        "exceller",
-        "excitant",
-        "exclusif",
-        "excuse",
-        "exécuter",
-        "exemple",
-        "exercer",
-        "exhaler",
-        "exhorter",
-        "exigence",
-        "exiler",
-        "exister",
-        "exotique",
-        "expédier",
-        "explorer",
-        "exposer",
-        "exprimer",
-        "exquis",
-        "extensif",
-        "extraire",
-        "exulter",
-        "fable",
-        "fabuleux",
-        "facette",
-        "facile",
-        "facture",
-        "faiblir",
-        "falaise",
-        "fameux",
-        "famille",
-        "farceur",
-        "farfelu",
-        "farine",
-        "farouche",
-        "fasciner",
-        "fatal",
-        "fatigue",
-        "faucon",
-        "fautif",
-        "faveur",
-        "favori",
-        "fébrile",
-        "féconder",
-        "fédérer",
-        "félin",
-        "femme",
-        "fémur",
-        "fendoir",
-        "féodal",
-        "fermer",
-        "féroce",
-        "ferveur",
-        "festival",
-        "feuille",
-        "feutre",
-        "février",
-        "fiasco",
-        "ficeler",
-        "fictif",
-        "fidèle",
-        "figure",
-        "filature",
-        "filetage",
-        "filière",
-        "filleul",
-        "filmer",
-        "filou",
-        "filtrer",
-        "financer",
-        "finir",
-        "fiole",
-        "firme",
-        "fissure",
-        "fixer",
-        "flairer",
-        "flamme",
-        "flasque",
-        "flatteur",
-        "fléau",
-        "flèche",
-        "fleur",
-        "flexion",
-        "flocon",
-        "flore",
-        "fluctuer",
-        "fluide",
-        "fluvial",
-        "folie",
-        "fonderie",
-        "fongible",
-        "fontaine",
-        "forcer",
-        "forgeron",
-        "formuler",
-        "fortune",
-        "fossile",
-        "foudre",
-        "fougère",
-        "fouiller",
-        "foulure",
-        "fourmi",
-        "fragile",
-        "fraise",
-        "franchir",
-        "frapper",
-        "frayeur",
-        "frégate",
-        "freiner",
-        "frelon",
-        "frémir",
-        "frénésie",
-        "frère",
-        "friable",
-        "friction",
-        "frisson",
-        "frivole",
-        "froid",
-        "fromage",
-        "frontal",
-        "frotter",
-        "fruit",
-        "fugitif",
-        "fuite",
-        "fureur",
-        "furieux",
-        "furtif",
-        "fusion",
-        "futur",
-        "gagner",
-        "galaxie",
-        "galerie",
-        "gambader",
-        "garantir",
-        "gardien",
-        "garnir",
-        "garrigue",
-        "gazelle",
-        "gazon",
-        "géant",
-        "gélatine",
-        "gélule",
-        "gendarme",
-        "général",
-        "génie",
-        "genou",
-        "gentil",
-        "géologie",
-        "géomètre",
-        "géranium",
-        "germe",
-        "gestuel",
-        "geyser",
-        "gibier",
-        "gicler",
-        "girafe",
-        "givre",
-        "glace",
-        "glaive",
-        "glisser",
-        "globe",
-        "gloire",
-        "glorieux",
-        "golfeur",
-        "gomme",
-        "gonfler",
-        "gorge",
-        "gorille",
-        "goudron",
-        "gouffre",
-        "goulot",
-        "goupille",
-        "gourmand",
-        "goutte",
-        "graduel",
-        "graffiti",
-        "graine",
-        "grand",
-        "grappin",
-        "gratuit",
-        "gravir",
-        "grenat",
-        "griffure",
-        "griller",
-        "grimper",
-        "grogner",
-        "gronder",
-        "grotte",
-        "groupe",
-        "gruger",
-        "grutier",
-        "gruyère",
-        "guépard",
-        "guerrier",
-        "guide",
-        "guimauve",
-        "guitare",
-        "gustatif",
-        "gymnaste",
-        "gyrostat",
-        "habitude",
-        "hachoir",
-        "halte",
-        "hameau",
-        "hangar",
-        "hanneton",
-        "haricot",
-        "harmonie",
-        "harpon",
-        "hasard",
-        "hélium",
-        "hématome",
-        "herbe",
-        "hérisson",
-        "hermine",
-        "héron",
-        "hésiter",
-        "heureux",
-        "hiberner",
-        "hibou",
-        "hilarant",
-        "histoire",
-        "hiver",
-        "homard",
-        "hommage",
-        "homogène",
-        "honneur",
-        "honorer",
-        "honteux",
-        "horde",
-        "horizon",
-        "horloge",
-        "hormone",
-        "horrible",
-        "houleux",
-        "housse",
-        "hublot",
-        "huileux",
-        "humain",
-        "humble",
-        "humide",
-        "humour",
-        "hurler",
-        "hydromel",
-        "hygiène",
-        "hymne",
-        "hypnose",
-        "idylle",
-        "ignorer",
-        "iguane",
-        "illicite",
-        "illusion",
-        "image",
-        "imbiber",
-        "imiter",
-        "immense",
-        "immobile",
-        "immuable",
-        "impact",
-        "impérial",
-        "implorer",
-        "imposer",
-        "imprimer",
-        "imputer",
-        "incarner",
-        "incendie",
-        "incident",
-        "incliner",
-        "incolore",
-        "indexer",
-        "indice",
-        "inductif",
-        "inédit",
-        "ineptie",
-        "inexact",
-        "infini",
-        "infliger",
-        "informer",
-        "infusion",
-        "ingérer",
-        "inhaler",
-        "inhiber",
-        "injecter",
-        "injure",
-        "innocent",
-        "inoculer",
-        "inonder",
-        "inscrire",
-        "insecte",
-        "insigne",
-        "insolite",
-        "inspirer",
-        "instinct",
-        "insulter",
-        "intact",
-        "intense",
-        "intime",
-        "intrigue",
-        "intuitif",
-        "inutile",
-        "invasion",
-        "inventer",
-        "inviter",
-        "invoquer",
-        "ironique",
-        "irradier",
-        "irréel",
-        "irriter",
-        "isoler",
-        "ivoire",
-        "ivresse",
-        "jaguar",
-        "jaillir",
-        "jambe",
-        "janvier",
-        "jardin",
-        "jauger",
-        "jaune",
-        "javelot",
-        "jetable",
-        "jeton",
-        "jeudi",
-        "jeunesse",
-        "joindre",
-        "joncher",
-        "jongler",
-        "joueur",
-        "jouissif",
-        "journal",
-        "jovial",
-        "joyau",
-        "joyeux",
-        "jubiler",
-        "jugement",
-        "junior",
-        "jupon",
-        "juriste",
-        "justice",
-        "juteux",
-        "juvénile",
-        "kayak",
-        "kimono",
-        "kiosque",
-        "label",
-        "labial",
-        "labourer",
-        "lacérer",
-        "lactose",
-        "lagune",
-        "laine",
-        "laisser",
-        "laitier",
-        "lambeau",
-        "lamelle",
-        "lampe",
-        "lanceur",
-        "langage",
-        "lanterne",
-        "lapin",
-        "largeur",
-        "larme",
-        "laurier",
-        "lavabo",
-        "lavoir",
-        "lecture",
-        "légal",
-        "léger",
-        "légume",
-        "lessive",
-        "lettre",
-        "levier",
-        "lexique",
-        "lézard",
-        "liasse",
-        "libérer",
-        "libre",
-        "licence",
-        "licorne",
-        "liège",
-        "lièvre",
-        "ligature",
-        "ligoter",
-        "ligue",
-        "limer",
-        "limite",
-        "limonade",
-        "limpide",
-        "linéaire",
-        "lingot",
-        "lionceau",
-        "liquide",
-        "lisière",
-        "lister",
-        "lithium",
-        "litige",
-        "littoral",
-        "livreur",
-        "logique",
-        "lointain",
-        "loisir",
-        "lombric",
-        "loterie",
-        "louer",
-        "lourd",
-        "loutre",
-        "louve",
-        "loyal",
-        "lubie",
-        "lucide",
-        "lucratif",
-        "lueur",
-        "lugubre",
-        "luisant",
-        "lumière",
-        "lunaire",
-        "lundi",
-        "luron",
-        "lutter",
-        "luxueux",
-        "machine",
-        "magasin",
-        "magenta",
-        "magique",
-        "maigre",
-        "maillon",
-        "maintien",
-        "mairie",
-        "maison",
-        "majorer",
-        "malaxer",
-        "maléfice",
-        "malheur",
-        "malice",
-        "mallette",
-        "mammouth",
-        "mandater",
-        "maniable",
-        "manquant",
-        "manteau",
-        "manuel",
-        "marathon",
-        "marbre",
-        "marchand",
-        "mardi",
-        "maritime",
-        "marqueur",
-        "marron",
-        "marteler",
-        "mascotte",
-        "massif",
-        "matériel",
-        "matière",
-        "matraque",
-        "maudire",
-        "maussade",
-        "mauve",
-        "maximal",
-        "méchant",
-        "méconnu",
-        "médaille",
-        "médecin",
-        "méditer",
-        "méduse",
-        "meilleur",
-        "mélange",
-        "mélodie",
-        "membre",
-        "mémoire",
-        "menacer",
-        "mener",
-        "menhir",
-        "mensonge",
-        "mentor",
-        "mercredi",
-        "mérite",
-        "merle",
-        "messager",
-        "mesure",
-        "métal",
-        "météore",
-        "méthode",
-        "métier",
-        "meuble",
-        "miauler",
-        "microbe",
-        "miette",
-        "mignon",
-        "migrer",
-        "milieu",
-        "million",
-        "mimique",
-        "mince",
-        "minéral",
-        "minimal",
-        "minorer",
-        "minute",
-        "miracle",
-        "miroiter",
-        "missile",
-        "mixte",
-        "mobile",
-        "moderne",
-        "moelleux",
-        "mondial",
-        "moniteur",
-        "monnaie",
-        "monotone",
-        "monstre",
-        "montagne",
-        "monument",
-        "moqueur",
-        "morceau",
-        "morsure",
-        "mortier",
-        "moteur",
-        "motif",
-        "mouche",
-        "moufle",
-        "moulin",
-        "mousson",
-        "mouton",
-        "mouvant",
-        "multiple",
-        "munition",
-        "muraille",
-        "murène",
-        "murmure",
-        "muscle",
-        "muséum",
-        "musicien",
-        "mutation",
-        "muter",
-        "mutuel",
-        "myriade",
-        "myrtille",
-        "mystère",
-        "mythique",
-        "nageur",
-        "nappe",
-        "narquois",
-        "narrer",
-        "natation",
-        "nation",
-        "nature",
-        "naufrage",
-        "nautique",
-        "navire",
-        "nébuleux",
-        "nectar",
-        "néfaste",
-        "négation",
-        "négliger",
-        "négocier",
-        "neige",
-        "nerveux",
-        "nettoyer",
-        "neurone",
-        "neutron",
-        "neveu",
-        "niche",
-        "nickel",
-        "nitrate",
-        "niveau",
-        "noble",
-        "nocif",
-        "nocturne",
-        "noirceur",
-        "noisette",
-        "nomade",
-        "nombreux",
-        "nommer",
-        "normatif",
-        "notable",
-        "notifier",
-        "notoire",
-        "nourrir",
-        "nouveau",
-        "novateur",
-        "novembre",
-        "novice",
-        "nuage",
-        "nuancer",
-        "nuire",
-        "nuisible",
-        "numéro",
-        "nuptial",
-        "nuque",
-        "nutritif",
-        "obéir",
-        "objectif",
-        "obliger",
-        "obscur",
-        "observer",
-        "obstacle",
-        "obtenir",
-        "obturer",
-        "occasion",
-        "occuper",
-        "océan",
-        "octobre",
-        "octroyer",
-        "octupler",
-        "oculaire",
-        "odeur",
-        "odorant",
-        "offenser",
-        "officier",
-        "offrir",
-        "ogive",
-        "oiseau",
-        "oisillon",
-        "olfactif",
-        "olivier",
-        "ombrage",
-        "omettre",
-        "onctueux",
-        "onduler",
-        "onéreux",
-        "onirique",
-        "opale",
-        "opaque",
-        "opérer",
-        "opinion",
-        "opportun",
-        "opprimer",
-        "opter",
-        "optique",
-        "orageux",
-        "orange",
-        "orbite",
-        "ordonner",
-        "oreille",
-        "organe",
-        "orgueil",
-        "orifice",
-        "ornement",
-        "orque",
-        "ortie",
-        "osciller",
-        "osmose",
-        "ossature",
-        "otarie",
-        "ouragan",
-        "ourson",
-        "outil",
-        "outrager",
-        "ouvrage",
-        "ovation",
-        "oxyde",
-        "oxygène",
-        "ozone",
-        "paisible",
-        "palace",
-        "palmarès",
-        "palourde",
-        "palper",
-        "panache",
-        "panda",
-        "pangolin",
-        "paniquer",
-        "panneau",
-        "panorama",
-        "pantalon",
-        "papaye",
-        "papier",
-        "papoter",
-        "papyrus",
-        "paradoxe",
-        "parcelle",
-        "paresse",
-        "parfumer",
-        "parler",
-        "parole",
-        "parrain",
-        "parsemer",
-        "partager",
-        "parure",
-        "parvenir",
-        "passion",
-        "pastèque",
-        "paternel",
-        "patience",
-        "patron",
-        "pavillon",
-        "pavoiser",
-        "payer",
-        "paysage",
-        "peigne",
-        "peintre",
-        "pelage",
-        "pélican",
-        "pelle",
-        "pelouse",
-        "peluche",
-        "pendule",
-        "pénétrer",
-        "pénible",
-        "pensif",
-        "pénurie",
-        "pépite",
-        "péplum",
-        "perdrix",
-        "perforer",
-        "période",
-        "permuter",
-        "perplexe",
-        "persil",
-        "perte",
-        "peser",
-        "pétale",
-        "petit",
-        "pétrir",
-        "peuple",
-        "pharaon",
-        "phobie",
-        "phoque",
-        "photon",
-        "phrase",
-        "physique",
-        "piano",
-        "pictural",
-        "pièce",
-        "pierre",
-        "pieuvre",
-        "pilote",
-        "pinceau",
-        "pipette",
-        "piquer",
-        "pirogue",
-        "piscine",
-        "piston",
-        "pivoter",
-        "pixel",
-        "pizza",
-        "placard",
-        "plafond",
-        "plaisir",
-        "planer",
-        "plaque",
-        "plastron",
-        "plateau",
-        "pleurer",
-        "plexus",
-        "pliage",
-        "plomb",
-        "plonger",
-        "pluie",
-        "plumage",
-        "pochette",
-        "poésie",
-        "poète",
-        "pointe",
-        "poirier",
-        "poisson",
-        "poivre",
-        "polaire",
-        "policier",
-        "pollen",
-        "polygone",
-        "pommade",
-        "pompier",
-        "ponctuel",
-        "pondérer",
-        "poney",
-        "portique",
-        "position",
-        "posséder",
-        "posture",
-        "potager",
-        "poteau",
-        "potion",
-        "pouce",
-        "poulain",
-        "poumon",
-        "pourpre",
-        "poussin",
-        "pouvoir",
-        "prairie",
-        "pratique",
-        "précieux",
-        "prédire",
-        "préfixe",
-        "prélude",
-        "prénom",
-        "présence",
-        "prétexte",
-        "prévoir",
-        "primitif",
-        "prince",
-        "prison",
-        "priver",
-        "problème",
-        "procéder",
-        "prodige",
-        "profond",
-        "progrès",
-        "proie",
-        "projeter",
-        "prologue",
-        "promener",
-        "propre",
-        "prospère",
-        "protéger",
-        "prouesse",
-        "proverbe",
-        "prudence",
-        "pruneau",
-        "psychose",
-        "public",
-        "puceron",
-        "puiser",
-        "pulpe",
-        "pulsar",
-        "punaise",
-        "punitif",
-        "pupitre",
-        "purifier",
-        "puzzle",
-        "pyramide",
-        "quasar",
-        "querelle",
-        "question",
-        "quiétude",
-        "quitter",
-        "quotient",
-        "racine",
-        "raconter",
-        "radieux",
-        "ragondin",
-        "raideur",
-        "raisin",
-        "ralentir",
-        "rallonge",
-        "ramasser",
-        "rapide",
-        "rasage",
-        "ratisser",
-        "ravager",
-        "ravin",
-        "rayonner",
-        "réactif",
-        "réagir",
-        "réaliser",
-        "réanimer",
-        "recevoir",
-        "réciter",
-        "réclamer",
-        "récolter",
-        "recruter",
-        "reculer",
-        "recycler",
-        "rédiger",
-        "redouter",
-        "refaire",
-        "réflexe",
-        "réformer",
-        "refrain",
-        "refuge",
-        "régalien",
-        "région",
-        "réglage",
-        "régulier",
-        "réitérer",
-        "rejeter",
-        "rejouer",
-        "relatif",
-        "relever",
-        "relief",
-        "remarque",
-        "remède",
-        "remise",
-        "remonter",
-        "remplir",
-        "remuer",
-        "renard",
-        "renfort",
-        "renifler",
-        "renoncer",
-        "rentrer",
-        "renvoi",
-        "replier",
-        "reporter",
-        "reprise",
-        "reptile",
-        "requin",
-        "réserve",
-        "résineux",
-        "résoudre",
-        "respect",
-        "rester",
-        "résultat",
-        "rétablir",
-        "retenir",
-        "réticule",
-        "retomber",
-        "retracer",
-        "réunion",
-        "réussir",
-        "revanche",
-        "revivre",
-        "révolte",
-        "révulsif",
-        "richesse",
-        "rideau",
-        "rieur",
-        "rigide",
-        "rigoler",
-        "rincer",
-        "riposter",
-        "risible",
-        "risque",
-        "rituel",
-        "rival",
-        "rivière",
-        "rocheux",
-        "romance",
-        "rompre",
-        "ronce",
-        "rondin",
-        "roseau",
-        "rosier",
-        "rotatif",
-        "rotor",
-        "rotule",
-        "rouge",
-        "rouille",
-        "rouleau",
-        "routine",
-        "royaume",
-        "ruban",
-        "rubis",
-        "ruche",
-        "ruelle",
-        "rugueux",
-        "ruiner",
-        "ruisseau",
-        "ruser",
-        "rustique",
-        "rythme",
-        "sabler",
-        "saboter",
-        "sabre",
-        "sacoche",
-        "safari",
-        "sagesse",
-        "saisir",
-        "salade",
-        "salive",
-        "salon",
-        "saluer",
-        "samedi",
-        "sanction",
-        "sanglier",
-        "sarcasme",
-        "sardine",
-        "saturer",
-        "saugrenu",
-        "saumon",
-        "sauter",
-        "sauvage",
-        "savant",
-        "savonner",
-        "scalpel",
-        "scandale",
-        "scélérat",
-        "scénario",
-        "sceptre",
-        "schéma",
-        "science",
-        "scinder",
-        "score",
-        "scrutin",
-        "sculpter",
-        "séance",
-        "sécable",
-        "sécher",
-        "secouer",
-        "sécréter",
-        "sédatif",
-        "séduire",
-        "seigneur",
-        "séjour",
-        "sélectif",
-        "semaine",
-        "sembler",
-        "semence",
-        "séminal",
-        "sénateur",
-        "sensible",
-        "sentence",
-        "séparer",
-        "séquence",
-        "serein",
-        "sergent",
-        "sérieux",
-        "serrure",
-        "sérum",
-        "service",
-        "sésame",
-        "sévir",
-        "sevrage",
-        "sextuple",
-        "sidéral",
-        "siècle",
-        "siéger",
-        "siffler",
-        "sigle",
-        "signal",
-        "silence",
-        "silicium",
-        "simple",
-        "sincère",
-        "sinistre",
-        "siphon",
-        "sirop",
-        "sismique",
-        "situer",
-        "skier",
-        "social",
-        "socle",
-        "sodium",
-        "soigneux",
-        "soldat",
-        "soleil",
-        "solitude",
-        "soluble",
-        "sombre",
-        "sommeil",
-        "somnoler",
-        "sonde",
-        "songeur",
-        "sonnette",
-        "sonore",
-        "sorcier",
-        "sortir",
-        "sosie",
-        "sottise",
-        "soucieux",
-        "soudure",
-        "souffle",
-        "soulever",
-        "soupape",
-        "source",
-        "soutirer",
-        "souvenir",
-        "spacieux",
-        "spatial",
-        "spécial",
-        "sphère",
-        "spiral",
-        "stable",
-        "station",
-        "sternum",
-        "stimulus",
-        "stipuler",
-        "strict",
-        "studieux",
-        "stupeur",
-        "styliste",
-        "sublime",
-        "substrat",
-        "subtil",
-        "subvenir",
-        "succès",
-        "sucre",
-        "suffixe",
-        "suggérer",
-        "suiveur",
-        "sulfate",
-        "superbe",
-        "supplier",
-        "surface",
-        "suricate",
-        "surmener",
-        "surprise",
-        "sursaut",
-        "survie",
-        "suspect",
-        "syllabe",
-        "symbole",
-        "symétrie",
-        "synapse",
-        "syntaxe",
-        "système",
-        "tabac",
-        "tablier",
-        "tactile",
-        "tailler",
-        "talent",
-        "talisman",
-        "talonner",
-        "tambour",
-        "tamiser",
-        "tangible",
-        "tapis",
-        "taquiner",
-        "tarder",
-        "tarif",
-        "tartine",
-        "tasse",
-        "tatami",
-        "tatouage",
-        "taupe",
-        "taureau",
-        "taxer",
-        "témoin",
-        "temporel",
-        "tenaille",
-        "tendre",
-        "teneur",
-        "tenir",
-        "tension",
-        "terminer",
-        "terne",
-        "terrible",
-        "tétine",
-        "texte",
-        "thème",
-        "théorie",
-        "thérapie",
-        "thorax",
-        "tibia",
-        "tiède",
-        "timide",
-        "tirelire",
-        "tiroir",
-        "tissu",
-        "titane",
-        "titre",
-        "tituber",
-        "toboggan",
-        "tolérant",
-        "tomate",
-        "tonique",
-        "tonneau",
-        "toponyme",
-        "torche",
-        "tordre",
-        "tornade",
-        "torpille",
-        "torrent",
-        "torse",
-        "tortue",
-        "totem",
-        "toucher",
-        "tournage",
-        "tousser",
-        "toxine",
-        "traction",
-        "trafic",
-        "tragique",
-        "trahir",
-        "train",
-        "trancher",
-        "travail",
-        "trèfle",
-        "tremper",
-        "trésor",
-        "treuil",
-        "triage",
-        "tribunal",
-        "tricoter",
-        "trilogie",
-        "triomphe",
-        "tripler",
-        "triturer",
-        "trivial",
-        "trombone",
-        "tronc",
-        "tropical",
-        "troupeau",
-        "tuile",
-        "tulipe",
-        "tumulte",
-        "tunnel",
-        "turbine",
-        "tuteur",
-        "tutoyer",
-        "tuyau",
-        "tympan",
-        "typhon",
-        "typique",
-        "tyran",
-        "ubuesque",
-        "ultime",
-        "ultrason",
-        "unanime",
-        "unifier",
-        "union",
-        "unique",
-        "unitaire",
-        "univers",
-        "uranium",
-        "urbain",
-        "urticant",
-        "usage",
-        "usine",
-        "usuel",
-        "usure",
-        "utile",
-        "utopie",
-        "vacarme",
-        "vaccin",
-        "vagabond",
-        "vague",
-        "vaillant",
-        "vaincre",
-        "vaisseau",
-        "valable",
-        "valise",
-        "vallon",
-        "valve",
-        "vampire",
-        "vanille",
-        "vapeur",
-        "varier",
-        "vaseux",
-        "vassal",
-        "vaste",
-        "vecteur",
-        "vedette",
-        "végétal",
-        "véhicule",
-        "veinard",
-        "véloce",
-        "vendredi",
-        "vénérer",
-        "venger",
-        "venimeux",
-        "ventouse",
-        "verdure",
-        "vérin",
-        "vernir",
-        "verrou",
-        "verser",
-        "vertu",
-        "veston",
-        "vétéran",
-        "vétuste",
-        "vexant",
-        "vexer",
-        "viaduc",
-        "viande",
-        "victoire",
-        "vidange",
-        "vidéo",
-        "vignette",
-        "vigueur",
-        "vilain",
-        "village",
-        "vinaigre",
-        "violon",
-        "vipère",
-        "virement",
-        "virtuose",
-        "virus",
-        "visage",
-        "viseur",
-        "vision",
-        "visqueux",
-        "visuel",
-        "vital",
-        "vitesse",
-        "viticole",
-        "vitrine",
-        "vivace",
-        "vivipare",
-        "vocation",
-        "voguer",
-        "voile",
-        "voisin",
-        "voiture",
-        "volaille",
-        "volcan",
-        "voltiger",
-        "volume",
-        "vorace",
-        "vortex",
-        "voter",
-        "vouloir",
-        "voyage",
-        "voyelle",
-        "wagon",
-        "xénon",
-        "yacht",
-        "zèbre",
-        "zénith",
-        "zeste",
-        "zoologie"
-    }
+    0, 9, 17, 26, 34, 41, 49, 57, 64, 72, 81, 89, 97, 104, 112, 119, 127, 134,
+    142, 153, 160, 168, 177, 186, 195, 204, 213, 221, 228, 234, 242, 251, 257,
+    265, 276, 285, 292, 298, 305, 312, 322, 332, 341, 349, 358, 366, 374, 381,
+    389, 397, 404, 411, 419, 427, 437, 445, 454, 462, 470, 479, 486, 494, 500,
+    507, 515, 526, 533, 539, 548, 555, 563, 571, 579, 587, 595, 604, 611, 621,
+    627, 637, 645, 655, 663, 671, 679, 688, 695, 703, 713, 721, 728, 734, 745,
+    754, 761, 768, 776, 782, 791, 800, 808, 816, 824, 833, 842, 851, 858, 869,
+    875, 884, 893, 900, 908, 916, 923, 930, 939, 947, 955, 963, 972, 980, 988,
+    999, 1007, 1016, 1025, 1033, 1042, 1050, 1059, 1067, 1075, 1083, 1090,
+    1098, 1105, 1114, 1123, 1132, 1140, 1147, 1156, 1165, 1173, 1181, 1189,
+    1200, 1208, 1215, 1224, 1232, 1239, 1248, 1257, 1266, 1274, 1282, 1288,
+    1295, 1303, 1309, 1316, 1323, 1331, 1340, 1348, 1357, 1365, 1373, 1380,
+    1388, 1396, 1403, 1411, 1420, 1427, 1435, 1443, 1450, 1457, 1465, 1474,
+    1480, 1486, 1493, 1500, 1507, 1513, 1519, 1526, 1532, 1540, 1547, 1556,
+    1565, 1574, 1581, 1589, 1598, 1605, 1614, 1622, 1631, 1642, 1651, 1659,
+    1665, 1671, 1678, 1686, 1693, 1701, 1710, 1717, 1726, 1735, 1744, 1752,
+    1761, 1768, 1781, 1789, 1796, 1804, 1812, 1819, 1827, 1836, 1843, 1851,
+    1859, 1866, 1872, 1878, 1887, 1895, 1903, 1912, 1920, 1928, 1936, 1942,
+    1951, 1958, 1966, 1974, 1981, 1990, 1999, 2007, 2013, 2021, 2029, 2036,
+    2043, 2049, 2056, 2063, 2070, 2077, 2085, 2094, 2100, 2108, 2114, 2120,
+    2127, 2134, 2141, 2148, 2156, 2163, 2172, 2181, 2188, 2196, 2204, 2210,
+    2217, 2226, 2235, 2244, 2252, 2261, 2269, 2276, 2285, 2292, 2300, 2308,
+    2316, 2322, 2330, 2337, 2345, 2352, 2360, 2369, 2376, 2382, 2390, 2398,
+    2405, 2413, 2421, 2429, 2436, 2445, 2452, 2458, 2468, 2476, 2484, 2493,
+    2501, 2509, 2516, 2525, 2534, 2543, 2552, 2559, 2568, 2574, 2582, 2588,
+    2596, 2604, 2612, 2620, 2628, 2636, 2643, 2651, 2660, 2668, 2677, 2685,
+    2693, 2701, 2709, 2716, 2724, 2731, 2738, 2746, 2753, 2761, 2770, 2778,
+    2785, 2795, 2804, 2814, 2822, 2831, 2840, 2848, 2855, 2868, 2875, 2882,
+    2890, 2897, 2905, 2912, 2920, 2928, 2935, 2944, 2952, 2961, 2968, 2977,
+    2986, 2994, 3003, 3014, 3023, 3030, 3036, 3044, 3052, 3062, 3068, 3077,
+    3086, 3094, 3100, 3109, 3116, 3122, 3129, 3137, 3146, 3155, 3163, 3172,
+    3178, 3185, 3193, 3201, 3208, 3214, 3222, 3230, 3238, 3245, 3253, 3260,
+    3268, 3275, 3283, 3290, 3298, 3307, 3314, 3320, 3328, 3337, 3343, 3352,
+    3359, 3366, 3377, 3385, 3393, 3402, 3410, 3418, 3427, 3435, 3442, 3452,
+    3461, 3469, 3477, 3486, 3494, 3503, 3512, 3521, 3529, 3537, 3544, 3550,
+    3557, 3565, 3573, 3582, 3589, 3597, 3607, 3616, 3624, 3630, 3636, 3644,
+    3652, 3660, 3668, 3675, 3681, 3689, 3697, 3704, 3715, 3726, 3736, 3744,
+    3753, 3761, 3767, 3775, 3785, 3792, 3800, 3808, 3816, 3822, 3830, 3838,
+    3847, 3858, 3866, 3873, 3882, 3891, 3899, 3906, 3914, 3922, 3930, 3936,
+    3945, 3953, 3961, 3968, 3975, 3983, 3991, 4002, 4012, 4023, 4034, 4045,
+    4055, 4066, 4077, 4087, 4098, 4108, 4118, 4129, 4138, 4149, 4158, 4169,
+    4179, 4190, 4200, 4211, 4222, 4233, 4244, 4253, 4263, 4272, 4281, 4291,
+    4302, 4312, 4321, 4331, 4340, 4351, 4362, 4373, 4383, 4394, 4404, 4415,
+    4424, 4433, 4444, 4457, 4466, 4475, 4486, 4497, 4508, 4519, 4528, 4536,
+    4544, 4551, 4558, 4567, 4575, 4582, 4593, 4603, 4611, 4617, 4624, 4633,
+    4642, 4650, 4659, 4667, 4676, 4685, 4694, 4703, 4712, 4720, 4727, 4735,
+    4741, 4747, 4755, 4764, 4772, 4781, 4788, 4795, 4804, 4812, 4819, 4826,
+    4833, 4841, 4850, 4859, 4866, 4874, 4881, 4887, 4894, 4901, 4909, 4918,
+    4927, 4935, 4943, 4951, 4958, 4967, 4977, 4987, 4997, 5007, 5018, 5028,
+    5037, 5046, 5054, 5065, 5074, 5084, 5094, 5106, 5117, 5125, 5133, 5144,
+    5154, 5164, 5172, 5181, 5189, 5196, 5205, 5214, 5225, 5234, 5244, 5255,
+    5265, 5276, 5288, 5301, 5311, 5322, 5333, 5341, 5352, 5361, 5370, 5379,
+    5387, 5398, 5409, 5417, 5427, 5438, 5447, 5456, 5465, 5473, 5484, 5493,
+    5503, 5511, 5519, 5528, 5537, 5545, 5553, 5563, 5571, 5580, 5588, 5596,
+    5602, 5611, 5620, 5629, 5635, 5643, 5650, 5659, 5668, 5677, 5686, 5695,
+    5704, 5711, 5720, 5729, 5742, 5750, 5759, 5767, 5774, 5783, 5794, 5804,
+    5814, 5823, 5834, 5847, 5855, 5866, 5874, 5884, 5895, 5904, 5914, 5925,
+    5936, 5946, 5955, 5964, 5974, 5981, 5992, 6001, 6009, 6018, 6029, 6036,
+    6043, 6052, 6060, 6068, 6075, 6083, 6090, 6098, 6106, 6118, 6127, 6137,
+    6148, 6159, 6170, 6180, 6190, 6200, 6207, 6216, 6226, 6235, 6246, 6257,
+    6267, 6276, 6284, 6293, 6303, 6313, 6324, 6335, 6344, 6355, 6365, 6371,
+    6382, 6390, 6399, 6408, 6417, 6424, 6435, 6443, 6451, 6459, 6468, 6477,
+    6484, 6492, 6501, 6512, 6521, 6529, 6538, 6545, 6554, 6563, 6571, 6577,
+    6586, 6594, 6601, 6609, 6617, 6625, 6632, 6640, 6648, 6656, 6663, 6672,
+    6681, 6687, 6695, 6702, 6709, 6716, 6723, 6733, 6744, 6756, 6764, 6770,
+    6778, 6786, 6795, 6802, 6811, 6819, 6828, 6836, 6843, 6853, 6860, 6868,
+    6875, 6884, 6891, 6900, 6909, 6919, 6927, 6934, 6940, 6948, 6957, 6963,
+    6969, 6975, 6983, 6989, 6997, 7004, 7012, 7021, 7029, 7038, 7044, 7052,
+    7059, 7065, 7074, 7081, 7089, 7095, 7104, 7113, 7122, 7129, 7138, 7147,
+    7155, 7163, 7170, 7180, 7189, 7197, 7204, 7212, 7219, 7228, 7236, 7244,
+    7254, 7262, 7269, 7278, 7291, 7299, 7307, 7316, 7324, 7332, 7338, 7346,
+    7354, 7362, 7368, 7376, 7382, 7389, 7397, 7404, 7411, 7417, 7424, 7432,
+    7440, 7449, 7458, 7466, 7473, 7482, 7490, 7496, 7504, 7515, 7524, 7533,
+    7545, 7553, 7559, 7566, 7577, 7590, 7601, 7607, 7615, 7622, 7629, 7636,
+    7643, 7649, 7655, 7662, 7670, 7676, 7683, 7692, 7700, 7706, 7714, 7720,
+    7728, 7736, 7744, 7751, 7760, 7769, 7776, 7784, 7793, 7800, 7806, 7814,
+    7822, 7829, 7836, 7845, 7853, 7861, 7869, 7877, 7884, 7891, 7898, 7906,
+    7916, 7926, 7935, 7941, 7950, 7958, 7967, 7976, 7985, 7994, 8002, 8008,
+    8015, 8022, 8031, 8039, 8048, 8055, 8062, 8071, 8082, 8088, 8099, 8107,
+    8115, 8125, 8133, 8142, 8148, 8157, 8166, 8172, 8179, 8187, 8198, 8206,
+    8214, 8222, 8228, 8236, 8244, 8252, 8261, 8269, 8276, 8283, 8291, 8298,
+    8305, 8312, 8319, 8326, 8335, 8345, 8351, 8359, 8366, 8374, 8381, 8390,
+    8399, 8405, 8413, 8420, 8428, 8437, 8446, 8453, 8464, 8473, 8481, 8490,
+    8498, 8507, 8516, 8525, 8534, 8543, 8551, 8558, 8567, 8576, 8584, 8592,
+    8599, 8608, 8617, 8626, 8636, 8644, 8652, 8661, 8668, 8677, 8686, 8694,
+    8703, 8711, 8719, 8728, 8737, 8746, 8755, 8762, 8770, 8777, 8786, 8795,
+    8803, 8812, 8821, 8829, 8838, 8847, 8856, 8865, 8873, 8880, 8887, 8895,
+    8902, 8910, 8916, 8924, 8931, 8938, 8944, 8952, 8960, 8966, 8972, 8981,
+    8989, 8997, 9005, 9012, 9021, 9029, 9036, 9042, 9049, 9057, 9066, 9073,
+    9079, 9087, 9095, 9102, 9113, 9119, 9126, 9134, 9140, 9147, 9156, 9166,
+    9174, 9181, 9187, 9195, 9203, 9211, 9219, 9225, 9233, 9241, 9250, 9256,
+    9264, 9270, 9278, 9285, 9292, 9300, 9308, 9316, 9325, 9333, 9340, 9347,
+    9355, 9364, 9371, 9381, 9387, 9395, 9403, 9411, 9420, 9429, 9437, 9443,
+    9449, 9456, 9465, 9473, 9484, 9491, 9500, 9508, 9518, 9525, 9533, 9540,
+    9549, 9557, 9565, 9574, 9581, 9589, 9597, 9603, 9609, 9616, 9622, 9628,
+    9634, 9641, 9650, 9656, 9664, 9672, 9682, 9690, 9696, 9702, 9709, 9717,
+    9725, 9733, 9741, 9749, 9756, 9764, 9773, 9780, 9787, 9795, 9803, 9814,
+    9822, 9829, 9838, 9847, 9856, 9865, 9874, 9882, 9889, 9898, 9905, 9914,
+    9920, 9929, 9938, 9945, 9954, 9963, 9970, 9981, 9991, 10000, 10008, 10017,
+    10023, 10031, 10041, 10051, 10062, 10072, 10082, 10091, 10100, 10110,
+    10120, 10127, 10137, 10145, 10151, 10158, 10167, 10174, 10183, 10192,
+    10198, 10207, 10214, 10222, 10234, 10244, 10253, 10260, 10268, 10276,
+    10283, 10290, 10297, 10304, 10312, 10320, 10326, 10336, 10344, 10352,
+    10359, 10367, 10376, 10384, 10390, 10397, 10405, 10414, 10422, 10431,
+    10439, 10448, 10456, 10465, 10474, 10482, 10490, 10498, 10506, 10513,
+    10519, 10526, 10533, 10540, 10548, 10555, 10563, 10572, 10581, 10590,
+    10599, 10607, 10614, 10623, 10632, 10641, 10647, 10654, 10662, 10671,
+    10681, 10690, 10697, 10703, 10712, 10719, 10728, 10735, 10742, 10751,
+    10760, 10767, 10778, 10785, 10795, 10806, 10817, 10828, 10834, 10842,
+    10851, 10859, 10867, 10873, 10879, 10886, 10894, 10901, 10907, 10913,
+    10922, 10931, 10940, 10947, 10956, 10963, 10972, 10980, 10989, 10997,
+    11005, 11013, 11022, 11031, 11038, 11044, 11052, 11058, 11067, 11076,
+    11084, 11090, 11099, 11107, 11116, 11124, 11131, 11140, 11149, 11157,
+    11165, 11174, 11182, 11190, 11198, 11207, 11216, 11225, 11231, 11239,
+    11248, 11257, 11264, 11270, 11277, 11286, 11295, 11303, 11311, 11319,
+    11328, 11336, 11346, 11355, 11361, 11368, 11377, 11385, 11394, 11403,
+    11409, 11417, 11425, 11432, 11439, 11448, 11456, 11463, 11471, 11479,
+    11488, 11494, 11500, 11509, 11516, 11525, 11532, 11540, 11547, 11553,
+    11562, 11570, 11578, 11584, 11594, 11600, 11609, 11616, 11627, 11636,
+    11643, 11651, 11657, 11666, 11675, 11683, 11692, 11701, 11708, 11715,
+    11723, 11731, 11740, 11749, 11757, 11766, 11773, 11780, 11788, 11797,
+    11806, 11813, 11822, 11830, 11841, 11850, 11859, 11866, 11875, 11884,
+    11890, 11898, 11905, 11913, 11920, 11930, 11936, 11944, 11952, 11960,
+    11973, 11983, 11990, 12000, 12009, 12018, 12026, 12035, 12045, 12054,
+    12063, 12070, 12076, 12082, 12091, 12097, 12106, 12113, 12121, 12128,
+    12135, 12142, 12149, 12158, 12164, 12173, 12181, 12188, 12196, 12203,
+    12211, 12219, 12226, 12234, 12242, 12249, 12257, 12263, 12269, 12277,
+    12285, 12293, 12300, 12307, 12316, 12324, 12332, 12339, 12346, 12352,
+    12360, 12366, 12374, 12383, 12392, 12400, 12407, 12415, 12423, 12430,
+    12438, 12447, 12454, 12463, 12471, 12479, 12488, 12499, 12505, 12514,
+    12523, 12534, 12542, 12550, 12557, 12564, 12570, 12578, 12585, 12593,
+    12601, 12609, 12617, 12626, 12637, 12647, 12657, 12667, 12676, 12687,
+    12698, 12708, 12717, 12724, 12731, 12738, 12749, 12760, 12768, 12776,
+    12786, 12792, 12801, 12810, 12819, 12826, 12837, 12848, 12857, 12866,
+    12875, 12883, 12892, 12899, 12907, 12914, 12920, 12927, 12935, 12943,
+    12951, 12960, 12967, 12976, 12983, 12992, 13001, 13012, 13020, 13029,
+    13036, 13045, 13053, 13062, 13070, 13077, 13086, 13095, 13104, 13111,
+    13118, 13127, 13135, 13141, 13150, 13160, 13169, 13180, 13191, 13200,
+    13210, 13221, 13232, 13241, 13249, 13258, 13268, 13277, 13285, 13295,
+    13306, 13314, 13321, 13332, 13341, 13351, 13362, 13375, 13383, 13391,
+    13399, 13407, 13414, 13423, 13432, 13439, 13448, 13456, 13463, 13470,
+    13478, 13487, 13496, 13504, 13511, 13519, 13528, 13536, 13544, 13551,
+    13561, 13572, 13583, 13591, 13598, 13609, 13620, 13628, 13639, 13648,
+    13657, 13667, 13677, 13686, 13694, 13704, 13715, 13724, 13731, 13737,
+    13744, 13752, 13759, 13768, 13776, 13783, 13790, 13796, 13806, 13814,
+    13822, 13829, 13835, 13842, 13849, 13856, 13864, 13870, 13877, 13883,
+    13891, 13899, 13907, 13915, 13921, 13927, 13933, 13940, 13948, 13955,
+    13964, 13970, 13979, 13986, 13993, 14001, 14007, 14015, 14022, 14030,
+    14037, 14044, 14051, 14057, 14064, 14071, 14080, 14089, 14098, 14106,
+    14114, 14123, 14130, 14137, 14145, 14152, 14161, 14169, 14178, 14191,
+    14202, 14210, 14219, 14227, 14235, 14241, 14249, 14258, 14267, 14277,
+    14286, 14294, 14307, 14317, 14327, 14336, 14345, 14356, 14364, 14372,
+    14380, 14390, 14401, 14410, 14419, 14429, 14440, 14447, 14455, 14465,
+    14473, 14481, 14489, 14498, 14506, 14514, 14523, 14533, 14542, 14551,
+    14559, 14565, 14572, 14580, 14589, 14596, 14606, 14615, 14622, 14628,
+    14637, 14644, 14650, 14657, 14663, 14670, 14679, 14686, 14693, 14702,
+    14710, 14717, 14725, 14734, 14740, 14748, 14757, 14764, 14772, 14779,
+    14785, 14793, 14802, 14810, 14818, 14827, 14835, 14842, 14851, 14860,
+    14869, 14877, 14887, 14896, 14903, 14910, 14918, 14926, 14935, 14944,
+    14951, 14960, 14968, 14977, 14985, 14994, 15001, 15010, 15019, 15025,
+    15033, 15044, 15052, 15060, 15068, 15077, 15085, 15094, 15103, 15112,
+    15120, 15127, 15135, 15143, 15151, 15162, 15170, 15178, 15188, 15194,
+    15202, 15210, 15218, 15225, 15234, 15243, 15251, 15259, 15268, 15274,
+    15283, 15290, 15296, 15304, 15310, 15317, 15326, 15332, 15340, 15346,
+    15355, 15364, 15373, 15380, 15387, 15393, 15401, 15410, 15416, 15425,
+    15434, 15440, 15448, 15458, 15469, 15476, 15482, 15490, 15497, 15506,
+    15513, 15519, 15526, 15532, 15540, 15549, 15560, 15567, 15575, 15583,
+    15592, 15599, 15606, 15614, 15623, 15631, 15637, 15644, 15650, 15658,
+    15667, 15675, 15682, 15691, 15698, 15707, 15714, 15720, 15729, 15737,
+    15746, 15754, 15763, 15770, 15777, 15786, 15795, 15804, 15813, 15821,
+    15830, 15838, 15847, 15853, 15862, 15871, 15877, 15884, 15892, 15899,
+    15907, 15914, 15922, 15928, 15935, 15942, 15950, 15956, 15965, 15972,
+    15981, 15989, 15997, 16003, 16010, 16019, 16027, 16035, 16042, 16051,
+    16057, 16063, 16069, 16075, 16081, 16088, 16096, 16103, 16112, 16118,
+    16127, 16135, 16144, 16152, 16159, 16166, 16172, 16180, 16188, 16195,
+    16202, 16209, 16216, 16222, 16230, 16238, 16250, 16261, 16269, 16278,
+    16287, 16299, 16306, 16315, 16324, 16332, 16340, 16347, 16354, 16361,
+    16367, 16374, 16386, 16396, 16403, 16409, 16416, 16423, 16432, 16440,
+    16448, 16457, 16465, 16472, 16480, 16489, 16496, 16505, 16514, 16523,
+    16529, 16536, 16543, 16550, 16559, 16566, 16572, 16580, 16589, 16597,
+    16604, 16613, 16622, 16629, 16635, 16642, 16650, 16659, 16666, 16675,
+    16682, 16689, 16696, 16702, 16710, 16717, 16725, 16731, 16739, 16745,
+    16753, 16762, 16768
 };
 
-const dictionary cs =
+const dictionary fr{ fr_words, fr_offsets };
+
+static const char cs_words[] =
+    "abdikace\0"
+    "abeceda\0"
+    "adresa\0"
+    "agrese\0"
+    "akce\0"
+    "aktovka\0"
+    "alej\0"
+    "alkohol\0"
+    "amputace\0"
+    "ananas\0"
+    "andulka\0"
+    "anekdota\0"
+    "anketa\0"
+    "antika\0"
+    "anulovat\0"
+    "archa\0"
+    "arogance\0"
+    "asfalt\0"
+    "asistent\0"
+    "aspirace\0"
+    "astma\0"
+    "astronom\0"
+    "atlas\0"
+    "atletika\0"
+    "atol\0"
+    "autobus\0"
+    "azyl\0"
+    "babka\0"
+    "bachor\0"
+    "bacil\0"
+    "baculka\0"
+    "badatel\0"
+    "bageta\0"
+    "bagr\0"
+    "bahno\0"
+    "bakterie\0"
+    "balada\0"
+    "baletka\0"
+    "balkon\0"
+    "balonek\0"
+    "balvan\0"
+    "balza\0"
+    "bambus\0"
+    "bankomat\0"
+    "barbar\0"
+    "baret\0"
+    "barman\0"
+    "baroko\0"
+    "barva\0"
+    "baterka\0"
+    "batoh\0"
+    "bavlna\0"
+    "bazalka\0"
+    "bazilika\0"
+    "bazuka\0"
+    "bedna\0"
+    "beran\0"
+    "beseda\0"
+    "bestie\0"
+    "beton\0"
+    "bezinka\0"
+    "bezmoc\0"
+    "beztak\0"
+    "bicykl\0"
+    "bidlo\0"
+    "biftek\0"
+    "bikiny\0"
+    "bilance\0"
+    "biograf\0"
+    "biolog\0"
+    "bitva\0"
+    "bizon\0"
+    "blahobyt\0"
+    "blatouch\0"
+    "blecha\0"
+    "bledule\0"
+    "blesk\0"
+    "blikat\0"
+    "blizna\0"
+    "blokovat\0"
+    "bloudit\0"
+    "blud\0"
+    "bobek\0"
+    "bobr\0"
+    "bodlina\0"
+    "bodnout\0"
+    "bohatost\0"
+    "bojkot\0"
+    "bojovat\0"
+    "bokorys\0"
+    "bolest\0"
+    "borec\0"
+    "borovice\0"
+    "bota\0"
+    "boubel\0"
+    "bouchat\0"
+    "bouda\0"
+    "boule\0"
+    "bourat\0"
+    "boxer\0"
+    "bradavka\0"
+    "brambora\0"
+    "branka\0"
+    "bratr\0"
+    "brepta\0"
+    "briketa\0"
+    "brko\0"
+    "brloh\0"
+    "bronz\0"
+    "broskev\0"
+    "brunetka\0"
+    "brusinka\0"
+    "brzda\0"
+    "brzy\0"
+    "bublina\0"
+    "bubnovat\0"
+    "buchta\0"
+    "buditel\0"
+    "budka\0"
+    "budova\0"
+    "bufet\0"
+    "bujarost\0"
+    "bukvice\0"
+    "buldok\0"
+    "bulva\0"
+    "bunda\0"
+    "bunkr\0"
+    "burza\0"
+    "butik\0"
+    "buvol\0"
+    "buzola\0"
+    "bydlet\0"
+    "bylina\0"
+    "bytovka\0"
+    "bzukot\0"
+    "capart\0"
+    "carevna\0"
+    "cedr\0"
+    "cedule\0"
+    "cejch\0"
+    "cejn\0"
+    "cela\0"
+    "celer\0"
+    "celkem\0"
+    "celnice\0"
+    "cenina\0"
+    "cennost\0"
+    "cenovka\0"
+    "centrum\0"
+    "cenzor\0"
+    "cestopis\0"
+    "cetka\0"
+    "chalupa\0"
+    "chapadlo\0"
+    "charita\0"
+    "chata\0"
+    "chechtat\0"
+    "chemie\0"
+    "chichot\0"
+    "chirurg\0"
+    "chlad\0"
+    "chleba\0"
+    "chlubit\0"
+    "chmel\0"
+    "chmura\0"
+    "chobot\0"
+    "chochol\0"
+    "chodba\0"
+    "cholera\0"
+    "chomout\0"
+    "chopit\0"
+    "choroba\0"
+    "chov\0"
+    "chrapot\0"
+    "chrlit\0"
+    "chrt\0"
+    "chrup\0"
+    "chtivost\0"
+    "chudina\0"
+    "chutnat\0"
+    "chvat\0"
+    "chvilka\0"
+    "chvost\0"
+    "chyba\0"
+    "chystat\0"
+    "chytit\0"
+    "cibule\0"
+    "cigareta\0"
+    "cihelna\0"
+    "cihla\0"
+    "cinkot\0"
+    "cirkus\0"
+    "cisterna\0"
+    "citace\0"
+    "citrus\0"
+    "cizinec\0"
+    "cizost\0"
+    "clona\0"
+    "cokoliv\0"
+    "couvat\0"
+    "ctitel\0"
+    "ctnost\0"
+    "cudnost\0"
+    "cuketa\0"
+    "cukr\0"
+    "cupot\0"
+    "cvaknout\0"
+    "cval\0"
+    "cvik\0"
+    "cvrkot\0"
+    "cyklista\0"
+    "daleko\0"
+    "dareba\0"
+    "datel\0"
+    "datum\0"
+    "dcera\0"
+    "debata\0"
+    "dechovka\0"
+    "decibel\0"
+    "deficit\0"
+    "deflace\0"
+    "dekl\0"
+    "dekret\0"
+    "demokrat\0"
+    "deprese\0"
+    "derby\0"
+    "deska\0"
+    "detektiv\0"
+    "dikobraz\0"
+    "diktovat\0"
+    "dioda\0"
+    "diplom\0"
+    "disk\0"
+    "displej\0"
+    "divadlo\0"
+    "divoch\0"
+    "dlaha\0"
+    "dlouho\0"
+    "dluhopis\0"
+    "dnes\0"
+    "dobro\0"
+    "dobytek\0"
+    "docent\0"
+    "dochutit\0"
+    "dodnes\0"
+    "dohled\0"
+    "dohoda\0"
+    "dohra\0"
+    "dojem\0"
+    "dojnice\0"
+    "doklad\0"
+    "dokola\0"
+    "doktor\0"
+    "dokument\0"
+    "dolar\0"
+    "doleva\0"
+    "dolina\0"
+    "doma\0"
+    "dominant\0"
+    "domluvit\0"
+    "domov\0"
+    "donutit\0"
+    "dopad\0"
+    "dopis\0"
+    "doplnit\0"
+    "doposud\0"
+    "doprovod\0"
+    "dopustit\0"
+    "dorazit\0"
+    "dorost\0"
+    "dort\0"
+    "dosah\0"
+    "doslov\0"
+    "dostatek\0"
+    "dosud\0"
+    "dosyta\0"
+    "dotaz\0"
+    "dotek\0"
+    "dotknout\0"
+    "doufat\0"
+    "doutnat\0"
+    "dovozce\0"
+    "dozadu\0"
+    "doznat\0"
+    "dozorce\0"
+    "drahota\0"
+    "drak\0"
+    "dramatik\0"
+    "dravec\0"
+    "draze\0"
+    "drdol\0"
+    "drobnost\0"
+    "drogerie\0"
+    "drozd\0"
+    "drsnost\0"
+    "drtit\0"
+    "drzost\0"
+    "duben\0"
+    "duchovno\0"
+    "dudek\0"
+    "duha\0"
+    "duhovka\0"
+    "dusit\0"
+    "dusno\0"
+    "dutost\0"
+    "dvojice\0"
+    "dvorec\0"
+    "dynamit\0"
+    "ekolog\0"
+    "ekonomie\0"
+    "elektron\0"
+    "elipsa\0"
+    "email\0"
+    "emise\0"
+    "emoce\0"
+    "empatie\0"
+    "epizoda\0"
+    "epocha\0"
+    "epopej\0"
+    "epos\0"
+    "esej\0"
+    "esence\0"
+    "eskorta\0"
+    "eskymo\0"
+    "etiketa\0"
+    "euforie\0"
+    "evoluce\0"
+    "exekuce\0"
+    "exkurze\0"
+    "expedice\0"
+    "exploze\0"
+    "export\0"
+    "extrakt\0"
+    "facka\0"
+    "fajfka\0"
+    "fakulta\0"
+    "fanatik\0"
+    "fantazie\0"
+    "farmacie\0"
+    "favorit\0"
+    "fazole\0"
+    "federace\0"
+    "fejeton\0"
+    "fenka\0"
+    "fialka\0"
+    "figurant\0"
+    "filozof\0"
+    "filtr\0"
+    "finance\0"
+    "finta\0"
+    "fixace\0"
+    "fjord\0"
+    "flanel\0"
+    "flirt\0"
+    "flotila\0"
+    "fond\0"
+    "fosfor\0"
+    "fotbal\0"
+    "fotka\0"
+    "foton\0"
+    "frakce\0"
+    "freska\0"
+    "fronta\0"
+    "fukar\0"
+    "funkce\0"
+    "fyzika\0"
+    "galeje\0"
+    "garant\0"
+    "genetika\0"
+    "geolog\0"
+    "gilotina\0"
+    "glazura\0"
+    "glejt\0"
+    "golem\0"
+    "golfista\0"
+    "gotika\0"
+    "graf\0"
+    "gramofon\0"
+    "granule\0"
+    "grep\0"
+    "gril\0"
+    "grog\0"
+    "groteska\0"
+    "guma\0"
+    "hadice\0"
+    "hadr\0"
+    "hala\0"
+    "halenka\0"
+    "hanba\0"
+    "hanopis\0"
+    "harfa\0"
+    "harpuna\0"
+    "havran\0"
+    "hebkost\0"
+    "hejkal\0"
+    "hejno\0"
+    "hejtman\0"
+    "hektar\0"
+    "helma\0"
+    "hematom\0"
+    "herec\0"
+    "herna\0"
+    "heslo\0"
+    "hezky\0"
+    "historik\0"
+    "hladovka\0"
+    "hlasivky\0"
+    "hlava\0"
+    "hledat\0"
+    "hlen\0"
+    "hlodavec\0"
+    "hloh\0"
+    "hloupost\0"
+    "hltat\0"
+    "hlubina\0"
+    "hluchota\0"
+    "hmat\0"
+    "hmota\0"
+    "hmyz\0"
+    "hnis\0"
+    "hnojivo\0"
+    "hnout\0"
+    "hoblina\0"
+    "hoboj\0"
+    "hoch\0"
+    "hodiny\0"
+    "hodlat\0"
+    "hodnota\0"
+    "hodovat\0"
+    "hojnost\0"
+    "hokej\0"
+    "holinka\0"
+    "holka\0"
+    "holub\0"
+    "homole\0"
+    "honitba\0"
+    "honorace\0"
+    "horal\0"
+    "horda\0"
+    "horizont\0"
+    "horko\0"
+    "horlivec\0"
+    "hormon\0"
+    "hornina\0"
+    "horoskop\0"
+    "horstvo\0"
+    "hospoda\0"
+    "hostina\0"
+    "hotovost\0"
+    "houba\0"
+    "houf\0"
+    "houpat\0"
+    "houska\0"
+    "hovor\0"
+    "hradba\0"
+    "hranice\0"
+    "hravost\0"
+    "hrazda\0"
+    "hrbolek\0"
+    "hrdina\0"
+    "hrdlo\0"
+    "hrdost\0"
+    "hrnek\0"
+    "hrobka\0"
+    "hromada\0"
+    "hrot\0"
+    "hrouda\0"
+    "hrozen\0"
+    "hrstka\0"
+    "hrubost\0"
+    "hryzat\0"
+    "hubenost\0"
+    "hubnout\0"
+    "hudba\0"
+    "hukot\0"
+    "humr\0"
+    "husita\0"
+    "hustota\0"
+    "hvozd\0"
+    "hybnost\0"
+    "hydrant\0"
+    "hygiena\0"
+    "hymna\0"
+    "hysterik\0"
+    "idylka\0"
+    "ihned\0"
+    "ikona\0"
+    "iluze\0"
+    "imunita\0"
+    "infekce\0"
+    "inflace\0"
+    "inkaso\0"
+    "inovace\0"
+    "inspekce\0"
+    "internet\0"
+    "invalida\0"
+    "investor\0"
+    "inzerce\0"
+    "ironie\0"
+    "jablko\0"
+    "jachta\0"
+    "jahoda\0"
+    "jakmile\0"
+    "jakost\0"
+    "jalovec\0"
+    "jantar\0"
+    "jarmark\0"
+    "jaro\0"
+    "jasan\0"
+    "jasno\0"
+    "jatka\0"
+    "javor\0"
+    "jazyk\0"
+    "jedinec\0"
+    "jedle\0"
+    "jednatel\0"
+    "jehlan\0"
+    "jekot\0"
+    "jelen\0"
+    "jelito\0"
+    "jemnost\0"
+    "jenom\0"
+    "jepice\0"
+    "jeseter\0"
+    "jevit\0"
+    "jezdec\0"
+    "jezero\0"
+    "jinak\0"
+    "jindy\0"
+    "jinoch\0"
+    "jiskra\0"
+    "jistota\0"
+    "jitrnice\0"
+    "jizva\0"
+    "jmenovat\0"
+    "jogurt\0"
+    "jurta\0"
+    "kabaret\0"
+    "kabel\0"
+    "kabinet\0"
+    "kachna\0"
+    "kadet\0"
+    "kadidlo\0"
+    "kahan\0"
+    "kajak\0"
+    "kajuta\0"
+    "kakao\0"
+    "kaktus\0"
+    "kalamita\0"
+    "kalhoty\0"
+    "kalibr\0"
+    "kalnost\0"
+    "kamera\0"
+    "kamkoliv\0"
+    "kamna\0"
+    "kanibal\0"
+    "kanoe\0"
+    "kantor\0"
+    "kapalina\0"
+    "kapela\0"
+    "kapitola\0"
+    "kapka\0"
+    "kaple\0"
+    "kapota\0"
+    "kapr\0"
+    "kapusta\0"
+    "kapybara\0"
+    "karamel\0"
+    "karotka\0"
+    "karton\0"
+    "kasa\0"
+    "katalog\0"
+    "katedra\0"
+    "kauce\0"
+    "kauza\0"
+    "kavalec\0"
+    "kazajka\0"
+    "kazeta\0"
+    "kazivost\0"
+    "kdekoliv\0"
+    "kdesi\0"
+    "kedluben\0"
+    "kemp\0"
+    "keramika\0"
+    "kino\0"
+    "klacek\0"
+    "kladivo\0"
+    "klam\0"
+    "klapot\0"
+    "klasika\0"
+    "klaun\0"
+    "klec\0"
+    "klenba\0"
+    "klepat\0"
+    "klesnout\0"
+    "klid\0"
+    "klima\0"
+    "klisna\0"
+    "klobouk\0"
+    "klokan\0"
+    "klopa\0"
+    "kloub\0"
+    "klubovna\0"
+    "klusat\0"
+    "kluzkost\0"
+    "kmen\0"
+    "kmitat\0"
+    "kmotr\0"
+    "kniha\0"
+    "knot\0"
+    "koalice\0"
+    "koberec\0"
+    "kobka\0"
+    "kobliha\0"
+    "kobyla\0"
+    "kocour\0"
+    "kohout\0"
+    "kojenec\0"
+    "kokos\0"
+    "koktejl\0"
+    "kolaps\0"
+    "koleda\0"
+    "kolize\0"
+    "kolo\0"
+    "komando\0"
+    "kometa\0"
+    "komik\0"
+    "komnata\0"
+    "komora\0"
+    "kompas\0"
+    "komunita\0"
+    "konat\0"
+    "koncept\0"
+    "kondice\0"
+    "konec\0"
+    "konfese\0"
+    "kongres\0"
+    "konina\0"
+    "konkurs\0"
+    "kontakt\0"
+    "konzerva\0"
+    "kopanec\0"
+    "kopie\0"
+    "kopnout\0"
+    "koprovka\0"
+    "korbel\0"
+    "korektor\0"
+    "kormidlo\0"
+    "koroptev\0"
+    "korpus\0"
+    "koruna\0"
+    "koryto\0"
+    "korzet\0"
+    "kosatec\0"
+    "kostka\0"
+    "kotel\0"
+    "kotleta\0"
+    "kotoul\0"
+    "koukat\0"
+    "koupelna\0"
+    "kousek\0"
+    "kouzlo\0"
+    "kovboj\0"
+    "koza\0"
+    "kozoroh\0"
+    "krabice\0"
+    "krach\0"
+    "krajina\0"
+    "kralovat\0"
+    "krasopis\0"
+    "kravata\0"
+    "kredit\0"
+    "krejcar\0"
+    "kresba\0"
+    "kreveta\0"
+    "kriket\0"
+    "kritik\0"
+    "krize\0"
+    "krkavec\0"
+    "krmelec\0"
+    "krmivo\0"
+    "krocan\0"
+    "krok\0"
+    "kronika\0"
+    "kropit\0"
+    "kroupa\0"
+    "krovka\0"
+    "krtek\0"
+    "kruhadlo\0"
+    "krupice\0"
+    "krutost\0"
+    "krvinka\0"
+    "krychle\0"
+    "krypta\0"
+    "krystal\0"
+    "kryt\0"
+    "kudlanka\0"
+    "kufr\0"
+    "kujnost\0"
+    "kukla\0"
+    "kulajda\0"
+    "kulich\0"
+    "kulka\0"
+    "kulomet\0"
+    "kultura\0"
+    "kuna\0"
+    "kupodivu\0"
+    "kurt\0"
+    "kurzor\0"
+    "kutil\0"
+    "kvalita\0"
+    "kvasinka\0"
+    "kvestor\0"
+    "kynolog\0"
+    "kyselina\0"
+    "kytara\0"
+    "kytice\0"
+    "kytka\0"
+    "kytovec\0"
+    "kyvadlo\0"
+    "labrador\0"
+    "lachtan\0"
+    "ladnost\0"
+    "laik\0"
+    "lakomec\0"
+    "lamela\0"
+    "lampa\0"
+    "lanovka\0"
+    "lasice\0"
+    "laso\0"
+    "lastura\0"
+    "latinka\0"
+    "lavina\0"
+    "lebka\0"
+    "leckdy\0"
+    "leden\0"
+    "lednice\0"
+    "ledovka\0"
+    "ledvina\0"
+    "legenda\0"
+    "legie\0"
+    "legrace\0"
+    "lehce\0"
+    "lehkost\0"
+    "lehnout\0"
+    "lektvar\0"
+    "lenochod\0"
+    "lentilka\0"
+    "lepenka\0"
+    "lepidlo\0"
+    "letadlo\0"
+    "letec\0"
+    "letmo\0"
+    "letokruh\0"
+    "levhart\0"
+    "levitace\0"
+    "levobok\0"
+    "libra\0"
+    "lichotka\0"
+    "lidojed\0"
+    "lidskost\0"
+    "lihovina\0"
+    "lijavec\0"
+    "lilek\0"
+    "limetka\0"
+    "linie\0"
+    "linka\0"
+    "linoleum\0"
+    "listopad\0"
+    "litina\0"
+    "litovat\0"
+    "lobista\0"
+    "lodivod\0"
+    "logika\0"
+    "logoped\0"
+    "lokalita\0"
+    "loket\0"
+    "lomcovat\0"
+    "lopata\0"
+    "lopuch\0"
+    "lord\0"
+    "losos\0"
+    "lotr\0"
+    "loudal\0"
+    "louh\0"
+    "louka\0"
+    "louskat\0"
+    "lovec\0"
+    "lstivost\0"
+    "lucerna\0"
+    "lucifer\0"
+    "lump\0"
+    "lusk\0"
+    "lustrace\0"
+    "lvice\0"
+    "lyra\0"
+    "lyrika\0"
+    "lysina\0"
+    "madam\0"
+    "madlo\0"
+    "magistr\0"
+    "mahagon\0"
+    "majetek\0"
+    "majitel\0"
+    "majorita\0"
+    "makak\0"
+    "makovice\0"
+    "makrela\0"
+    "malba\0"
+    "malina\0"
+    "malovat\0"
+    "malvice\0"
+    "maminka\0"
+    "mandle\0"
+    "manko\0"
+    "marnost\0"
+    "masakr\0"
+    "maskot\0"
+    "masopust\0"
+    "matice\0"
+    "matrika\0"
+    "maturita\0"
+    "mazanec\0"
+    "mazivo\0"
+    "mazlit\0"
+    "mazurka\0"
+    "mdloba\0"
+    "mechanik\0"
+    "meditace\0"
+    "medovina\0"
+    "melasa\0"
+    "meloun\0"
+    "mentolka\0"
+    "metla\0"
+    "metoda\0"
+    "metr\0"
+    "mezera\0"
+    "migrace\0"
+    "mihnout\0"
+    "mihule\0"
+    "mikina\0"
+    "mikrofon\0"
+    "milenec\0"
+    "milimetr\0"
+    "milost\0"
+    "mimika\0"
+    "mincovna\0"
+    "minibar\0"
+    "minomet\0"
+    "minulost\0"
+    "miska\0"
+    "mistr\0"
+    "mixovat\0"
+    "mladost\0"
+    "mlha\0"
+    "mlhovina\0"
+    "mlok\0"
+    "mlsat\0"
+    "mluvit\0"
+    "mnich\0"
+    "mnohem\0"
+    "mobil\0"
+    "mocnost\0"
+    "modelka\0"
+    "modlitba\0"
+    "mohyla\0"
+    "mokro\0"
+    "molekula\0"
+    "momentka\0"
+    "monarcha\0"
+    "monokl\0"
+    "monstrum\0"
+    "montovat\0"
+    "monzun\0"
+    "mosaz\0"
+    "moskyt\0"
+    "most\0"
+    "motivace\0"
+    "motorka\0"
+    "motyka\0"
+    "moucha\0"
+    "moudrost\0"
+    "mozaika\0"
+    "mozek\0"
+    "mozol\0"
+    "mramor\0"
+    "mravenec\0"
+    "mrkev\0"
+    "mrtvola\0"
+    "mrzet\0"
+    "mrzutost\0"
+    "mstitel\0"
+    "mudrc\0"
+    "muflon\0"
+    "mulat\0"
+    "mumie\0"
+    "munice\0"
+    "muset\0"
+    "mutace\0"
+    "muzeum\0"
+    "muzikant\0"
+    "myslivec\0"
+    "mzda\0"
+    "nabourat\0"
+    "nachytat\0"
+    "nadace\0"
+    "nadbytek\0"
+    "nadhoz\0"
+    "nadobro\0"
+    "nadpis\0"
+    "nahlas\0"
+    "nahnat\0"
+    "nahodile\0"
+    "nahradit\0"
+    "naivita\0"
+    "najednou\0"
+    "najisto\0"
+    "najmout\0"
+    "naklonit\0"
+    "nakonec\0"
+    "nakrmit\0"
+    "nalevo\0"
+    "namazat\0"
+    "namluvit\0"
+    "nanometr\0"
+    "naoko\0"
+    "naopak\0"
+    "naostro\0"
+    "napadat\0"
+    "napevno\0"
+    "naplnit\0"
+    "napnout\0"
+    "naposled\0"
+    "naprosto\0"
+    "narodit\0"
+    "naruby\0"
+    "narychlo\0"
+    "nasadit\0"
+    "nasekat\0"
+    "naslepo\0"
+    "nastat\0"
+    "natolik\0"
+    "navenek\0"
+    "navrch\0"
+    "navzdory\0"
+    "nazvat\0"
+    "nebe\0"
+    "nechat\0"
+    "necky\0"
+    "nedaleko\0"
+    "nedbat\0"
+    "neduh\0"
+    "negace\0"
+    "nehet\0"
+    "nehoda\0"
+    "nejen\0"
+    "nejprve\0"
+    "neklid\0"
+    "nelibost\0"
+    "nemilost\0"
+    "nemoc\0"
+    "neochota\0"
+    "neonka\0"
+    "nepokoj\0"
+    "nerost\0"
+    "nerv\0"
+    "nesmysl\0"
+    "nesoulad\0"
+    "netvor\0"
+    "neuron\0"
+    "nevina\0"
+    "nezvykle\0"
+    "nicota\0"
+    "nijak\0"
+    "nikam\0"
+    "nikdy\0"
+    "nikl\0"
+    "nikterak\0"
+    "nitro\0"
+    "nocleh\0"
+    "nohavice\0"
+    "nominace\0"
+    "nora\0"
+    "norek\0"
+    "nositel\0"
+    "nosnost\0"
+    "nouze\0"
+    "noviny\0"
+    "novota\0"
+    "nozdra\0"
+    "nuda\0"
+    "nudle\0"
+    "nuget\0"
+    "nutit\0"
+    "nutnost\0"
+    "nutrie\0"
+    "nymfa\0"
+    "obal\0"
+    "obarvit\0"
+    "obava\0"
+    "obdiv\0"
+    "obec\0"
+    "obehnat\0"
+    "obejmout\0"
+    "obezita\0"
+    "obhajoba\0"
+    "obilnice\0"
+    "objasnit\0"
+    "objekt\0"
+    "obklopit\0"
+    "oblast\0"
+    "oblek\0"
+    "obliba\0"
+    "obloha\0"
+    "obluda\0"
+    "obnos\0"
+    "obohatit\0"
+    "obojek\0"
+    "obout\0"
+    "obrazec\0"
+    "obrna\0"
+    "obruba\0"
+    "obrys\0"
+    "obsah\0"
+    "obsluha\0"
+    "obstarat\0"
+    "obuv\0"
+    "obvaz\0"
+    "obvinit\0"
+    "obvod\0"
+    "obvykle\0"
+    "obyvatel\0"
+    "obzor\0"
+    "ocas\0"
+    "ocel\0"
+    "ocenit\0"
+    "ochladit\0"
+    "ochota\0"
+    "ochrana\0"
+    "ocitnout\0"
+    "odboj\0"
+    "odbyt\0"
+    "odchod\0"
+    "odcizit\0"
+    "odebrat\0"
+    "odeslat\0"
+    "odevzdat\0"
+    "odezva\0"
+    "odhadce\0"
+    "odhodit\0"
+    "odjet\0"
+    "odjinud\0"
+    "odkaz\0"
+    "odkoupit\0"
+    "odliv\0"
+    "odluka\0"
+    "odmlka\0"
+    "odolnost\0"
+    "odpad\0"
+    "odpis\0"
+    "odplout\0"
+    "odpor\0"
+    "odpustit\0"
+    "odpykat\0"
+    "odrazka\0"
+    "odsoudit\0"
+    "odstup\0"
+    "odsun\0"
+    "odtok\0"
+    "odtud\0"
+    "odvaha\0"
+    "odveta\0"
+    "odvolat\0"
+    "odvracet\0"
+    "odznak\0"
+    "ofina\0"
+    "ofsajd\0"
+    "ohlas\0"
+    "ohnisko\0"
+    "ohrada\0"
+    "ohrozit\0"
+    "ohryzek\0"
+    "okap\0"
+    "okenice\0"
+    "oklika\0"
+    "okno\0"
+    "okouzlit\0"
+    "okovy\0"
+    "okrasa\0"
+    "okres\0"
+    "okrsek\0"
+    "okruh\0"
+    "okupant\0"
+    "okurka\0"
+    "okusit\0"
+    "olejnina\0"
+    "olizovat\0"
+    "omak\0"
+    "omeleta\0"
+    "omezit\0"
+    "omladina\0"
+    "omlouvat\0"
+    "omluva\0"
+    "omyl\0"
+    "onehdy\0"
+    "opakovat\0"
+    "opasek\0"
+    "operace\0"
+    "opice\0"
+    "opilost\0"
+    "opisovat\0"
+    "opora\0"
+    "opozice\0"
+    "opravdu\0"
+    "oproti\0"
+    "orbital\0"
+    "orchestr\0"
+    "orgie\0"
+    "orlice\0"
+    "orloj\0"
+    "ortel\0"
+    "osada\0"
+    "oschnout\0"
+    "osika\0"
+    "osivo\0"
+    "oslava\0"
+    "oslepit\0"
+    "oslnit\0"
+    "oslovit\0"
+    "osnova\0"
+    "osoba\0"
+    "osolit\0"
+    "ospalec\0"
+    "osten\0"
+    "ostraha\0"
+    "ostuda\0"
+    "ostych\0"
+    "osvojit\0"
+    "oteplit\0"
+    "otisk\0"
+    "otop\0"
+    "otrhat\0"
+    "otrlost\0"
+    "otrok\0"
+    "otruby\0"
+    "otvor\0"
+    "ovanout\0"
+    "ovar\0"
+    "oves\0"
+    "ovlivnit\0"
+    "ovoce\0"
+    "oxid\0"
+    "ozdoba\0"
+    "pachatel\0"
+    "pacient\0"
+    "padouch\0"
+    "pahorek\0"
+    "pakt\0"
+    "palanda\0"
+    "palec\0"
+    "palivo\0"
+    "paluba\0"
+    "pamflet\0"
+    "pamlsek\0"
+    "panenka\0"
+    "panika\0"
+    "panna\0"
+    "panovat\0"
+    "panstvo\0"
+    "pantofle\0"
+    "paprika\0"
+    "parketa\0"
+    "parodie\0"
+    "parta\0"
+    "paruka\0"
+    "paryba\0"
+    "paseka\0"
+    "pasivita\0"
+    "pastelka\0"
+    "patent\0"
+    "patrona\0"
+    "pavouk\0"
+    "pazneht\0"
+    "pazourek\0"
+    "pecka\0"
+    "pedagog\0"
+    "pejsek\0"
+    "peklo\0"
+    "peloton\0"
+    "penalta\0"
+    "pendrek\0"
+    "penze\0"
+    "periskop\0"
+    "pero\0"
+    "pestrost\0"
+    "petarda\0"
+    "petice\0"
+    "petrolej\0"
+    "pevnina\0"
+    "pexeso\0"
+    "pianista\0"
+    "piha\0"
+    "pijavice\0"
+    "pikle\0"
+    "piknik\0"
+    "pilina\0"
+    "pilnost\0"
+    "pilulka\0"
+    "pinzeta\0"
+    "pipeta\0"
+    "pisatel\0"
+    "pistole\0"
+    "pitevna\0"
+    "pivnice\0"
+    "pivovar\0"
+    "placenta\0"
+    "plakat\0"
+    "plamen\0"
+    "planeta\0"
+    "plastika\0"
+    "platit\0"
+    "plavidlo\0"
+    "plaz\0"
+    "plech\0"
+    "plemeno\0"
+    "plenta\0"
+    "ples\0"
+    "pletivo\0"
+    "plevel\0"
+    "plivat\0"
+    "plnit\0"
+    "plno\0"
+    "plocha\0"
+    "plodina\0"
+    "plomba\0"
+    "plout\0"
+    "pluk\0"
+    "plyn\0"
+    "pobavit\0"
+    "pobyt\0"
+    "pochod\0"
+    "pocit\0"
+    "poctivec\0"
+    "podat\0"
+    "podcenit\0"
+    "podepsat\0"
+    "podhled\0"
+    "podivit\0"
+    "podklad\0"
+    "podmanit\0"
+    "podnik\0"
+    "podoba\0"
+    "podpora\0"
+    "podraz\0"
+    "podstata\0"
+    "podvod\0"
+    "podzim\0"
+    "poezie\0"
+    "pohanka\0"
+    "pohnutka\0"
+    "pohovor\0"
+    "pohroma\0"
+    "pohyb\0"
+    "pointa\0"
+    "pojistka\0"
+    "pojmout\0"
+    "pokazit\0"
+    "pokles\0"
+    "pokoj\0"
+    "pokrok\0"
+    "pokuta\0"
+    "pokyn\0"
+    "poledne\0"
+    "polibek\0"
+    "polknout\0"
+    "poloha\0"
+    "polynom\0"
+    "pomalu\0"
+    "pominout\0"
+    "pomlka\0"
+    "pomoc\0"
+    "pomsta\0"
+    "pomyslet\0"
+    "ponechat\0"
+    "ponorka\0"
+    "ponurost\0"
+    "popadat\0"
+    "popel\0"
+    "popisek\0"
+    "poplach\0"
+    "poprosit\0"
+    "popsat\0"
+    "popud\0"
+    "poradce\0"
+    "porce\0"
+    "porod\0"
+    "porucha\0"
+    "poryv\0"
+    "posadit\0"
+    "posed\0"
+    "posila\0"
+    "poskok\0"
+    "poslanec\0"
+    "posoudit\0"
+    "pospolu\0"
+    "postava\0"
+    "posudek\0"
+    "posyp\0"
+    "potah\0"
+    "potkan\0"
+    "potlesk\0"
+    "potomek\0"
+    "potrava\0"
+    "potupa\0"
+    "potvora\0"
+    "poukaz\0"
+    "pouto\0"
+    "pouzdro\0"
+    "povaha\0"
+    "povidla\0"
+    "povlak\0"
+    "povoz\0"
+    "povrch\0"
+    "povstat\0"
+    "povyk\0"
+    "povzdech\0"
+    "pozdrav\0"
+    "pozemek\0"
+    "poznatek\0"
+    "pozor\0"
+    "pozvat\0"
+    "pracovat\0"
+    "prahory\0"
+    "praktika\0"
+    "prales\0"
+    "praotec\0"
+    "praporek\0"
+    "prase\0"
+    "pravda\0"
+    "princip\0"
+    "prkno\0"
+    "probudit\0"
+    "procento\0"
+    "prodej\0"
+    "profese\0"
+    "prohra\0"
+    "projekt\0"
+    "prolomit\0"
+    "promile\0"
+    "pronikat\0"
+    "propad\0"
+    "prorok\0"
+    "prosba\0"
+    "proton\0"
+    "proutek\0"
+    "provaz\0"
+    "prskavka\0"
+    "prsten\0"
+    "prudkost\0"
+    "prut\0"
+    "prvek\0"
+    "prvohory\0"
+    "psanec\0"
+    "psovod\0"
+    "pstruh\0"
+    "ptactvo\0"
+    "puberta\0"
+    "puch\0"
+    "pudl\0"
+    "pukavec\0"
+    "puklina\0"
+    "pukrle\0"
+    "pult\0"
+    "pumpa\0"
+    "punc\0"
+    "pupen\0"
+    "pusa\0"
+    "pusinka\0"
+    "pustina\0"
+    "putovat\0"
+    "putyka\0"
+    "pyramida\0"
+    "pysk\0"
+    "pytel\0"
+    "racek\0"
+    "rachot\0"
+    "radiace\0"
+    "radnice\0"
+    "radon\0"
+    "raft\0"
+    "ragby\0"
+    "raketa\0"
+    "rakovina\0"
+    "rameno\0"
+    "rampouch\0"
+    "rande\0"
+    "rarach\0"
+    "rarita\0"
+    "rasovna\0"
+    "rastr\0"
+    "ratolest\0"
+    "razance\0"
+    "razidlo\0"
+    "reagovat\0"
+    "reakce\0"
+    "recept\0"
+    "redaktor\0"
+    "referent\0"
+    "reflex\0"
+    "rejnok\0"
+    "reklama\0"
+    "rekord\0"
+    "rekrut\0"
+    "rektor\0"
+    "reputace\0"
+    "revize\0"
+    "revma\0"
+    "revolver\0"
+    "rezerva\0"
+    "riskovat\0"
+    "riziko\0"
+    "robotika\0"
+    "rodokmen\0"
+    "rohovka\0"
+    "rokle\0"
+    "rokoko\0"
+    "romaneto\0"
+    "ropovod\0"
+    "ropucha\0"
+    "rorejs\0"
+    "rosol\0"
+    "rostlina\0"
+    "rotmistr\0"
+    "rotoped\0"
+    "rotunda\0"
+    "roubenka\0"
+    "roucho\0"
+    "roup\0"
+    "roura\0"
+    "rovina\0"
+    "rovnice\0"
+    "rozbor\0"
+    "rozchod\0"
+    "rozdat\0"
+    "rozeznat\0"
+    "rozhodce\0"
+    "rozinka\0"
+    "rozjezd\0"
+    "rozkaz\0"
+    "rozloha\0"
+    "rozmar\0"
+    "rozpad\0"
+    "rozruch\0"
+    "rozsah\0"
+    "roztok\0"
+    "rozum\0"
+    "rozvod\0"
+    "rubrika\0"
+    "ruchadlo\0"
+    "rukavice\0"
+    "rukopis\0"
+    "ryba\0"
+    "rybolov\0"
+    "rychlost\0"
+    "rydlo\0"
+    "rypadlo\0"
+    "rytina\0"
+    "ryzost\0"
+    "sadista\0"
+    "sahat\0"
+    "sako\0"
+    "samec\0"
+    "samizdat\0"
+    "samota\0"
+    "sanitka\0"
+    "sardinka\0"
+    "sasanka\0"
+    "satelit\0"
+    "sazba\0"
+    "sazenice\0"
+    "sbor\0"
+    "schovat\0"
+    "sebranka\0"
+    "secese\0"
+    "sedadlo\0"
+    "sediment\0"
+    "sedlo\0"
+    "sehnat\0"
+    "sejmout\0"
+    "sekera\0"
+    "sekta\0"
+    "sekunda\0"
+    "sekvoje\0"
+    "semeno\0"
+    "seno\0"
+    "servis\0"
+    "sesadit\0"
+    "seshora\0"
+    "seskok\0"
+    "seslat\0"
+    "sestra\0"
+    "sesuv\0"
+    "sesypat\0"
+    "setba\0"
+    "setina\0"
+    "setkat\0"
+    "setnout\0"
+    "setrvat\0"
+    "sever\0"
+    "seznam\0"
+    "shoda\0"
+    "shrnout\0"
+    "sifon\0"
+    "silnice\0"
+    "sirka\0"
+    "sirotek\0"
+    "sirup\0"
+    "situace\0"
+    "skafandr\0"
+    "skalisko\0"
+    "skanzen\0"
+    "skaut\0"
+    "skeptik\0"
+    "skica\0"
+    "skladba\0"
+    "sklenice\0"
+    "sklo\0"
+    "skluz\0"
+    "skoba\0"
+    "skokan\0"
+    "skoro\0"
+    "skripta\0"
+    "skrz\0"
+    "skupina\0"
+    "skvost\0"
+    "skvrna\0"
+    "slabika\0"
+    "sladidlo\0"
+    "slanina\0"
+    "slast\0"
+    "slavnost\0"
+    "sledovat\0"
+    "slepec\0"
+    "sleva\0"
+    "slezina\0"
+    "slib\0"
+    "slina\0"
+    "sliznice\0"
+    "slon\0"
+    "sloupek\0"
+    "slovo\0"
+    "sluch\0"
+    "sluha\0"
+    "slunce\0"
+    "slupka\0"
+    "slza\0"
+    "smaragd\0"
+    "smetana\0"
+    "smilstvo\0"
+    "smlouva\0"
+    "smog\0"
+    "smrad\0"
+    "smrk\0"
+    "smrtka\0"
+    "smutek\0"
+    "smysl\0"
+    "snad\0"
+    "snaha\0"
+    "snob\0"
+    "sobota\0"
+    "socha\0"
+    "sodovka\0"
+    "sokol\0"
+    "sopka\0"
+    "sotva\0"
+    "souboj\0"
+    "soucit\0"
+    "soudce\0"
+    "souhlas\0"
+    "soulad\0"
+    "soumrak\0"
+    "souprava\0"
+    "soused\0"
+    "soutok\0"
+    "souviset\0"
+    "spalovna\0"
+    "spasitel\0"
+    "spis\0"
+    "splav\0"
+    "spodek\0"
+    "spojenec\0"
+    "spolu\0"
+    "sponzor\0"
+    "spornost\0"
+    "spousta\0"
+    "sprcha\0"
+    "spustit\0"
+    "sranda\0"
+    "sraz\0"
+    "srdce\0"
+    "srna\0"
+    "srnec\0"
+    "srovnat\0"
+    "srpen\0"
+    "srst\0"
+    "srub\0"
+    "stanice\0"
+    "starosta\0"
+    "statika\0"
+    "stavba\0"
+    "stehno\0"
+    "stezka\0"
+    "stodola\0"
+    "stolek\0"
+    "stopa\0"
+    "storno\0"
+    "stoupat\0"
+    "strach\0"
+    "stres\0"
+    "strhnout\0"
+    "strom\0"
+    "struna\0"
+    "studna\0"
+    "stupnice\0"
+    "stvol\0"
+    "styk\0"
+    "subjekt\0"
+    "subtropy\0"
+    "suchar\0"
+    "sudost\0"
+    "sukno\0"
+    "sundat\0"
+    "sunout\0"
+    "surikata\0"
+    "surovina\0"
+    "svah\0"
+    "svalstvo\0"
+    "svetr\0"
+    "svatba\0"
+    "svazek\0"
+    "svisle\0"
+    "svitek\0"
+    "svoboda\0"
+    "svodidlo\0"
+    "svorka\0"
+    "svrab\0"
+    "sykavka\0"
+    "sykot\0"
+    "synek\0"
+    "synovec\0"
+    "sypat\0"
+    "sypkost\0"
+    "syrovost\0"
+    "sysel\0"
+    "sytost\0"
+    "tabletka\0"
+    "tabule\0"
+    "tahoun\0"
+    "tajemno\0"
+    "tajfun\0"
+    "tajga\0"
+    "tajit\0"
+    "tajnost\0"
+    "taktika\0"
+    "tamhle\0"
+    "tampon\0"
+    "tancovat\0"
+    "tanec\0"
+    "tanker\0"
+    "tapeta\0"
+    "tavenina\0"
+    "tazatel\0"
+    "technika\0"
+    "tehdy\0"
+    "tekutina\0"
+    "telefon\0"
+    "temnota\0"
+    "tendence\0"
+    "tenista\0"
+    "tenor\0"
+    "teplota\0"
+    "tepna\0"
+    "teprve\0"
+    "terapie\0"
+    "termoska\0"
+    "textil\0"
+    "ticho\0"
+    "tiskopis\0"
+    "titulek\0"
+    "tkadlec\0"
+    "tkanina\0"
+    "tlapka\0"
+    "tleskat\0"
+    "tlukot\0"
+    "tlupa\0"
+    "tmel\0"
+    "toaleta\0"
+    "topinka\0"
+    "topol\0"
+    "torzo\0"
+    "touha\0"
+    "toulec\0"
+    "tradice\0"
+    "traktor\0"
+    "tramp\0"
+    "trasa\0"
+    "traverza\0"
+    "trefit\0"
+    "trest\0"
+    "trezor\0"
+    "trhavina\0"
+    "trhlina\0"
+    "trochu\0"
+    "trojice\0"
+    "troska\0"
+    "trouba\0"
+    "trpce\0"
+    "trpitel\0"
+    "trpkost\0"
+    "trubec\0"
+    "truchlit\0"
+    "truhlice\0"
+    "trus\0"
+    "trvat\0"
+    "tudy\0"
+    "tuhnout\0"
+    "tuhost\0"
+    "tundra\0"
+    "turista\0"
+    "turnaj\0"
+    "tuzemsko\0"
+    "tvaroh\0"
+    "tvorba\0"
+    "tvrdost\0"
+    "tvrz\0"
+    "tygr\0"
+    "tykev\0"
+    "ubohost\0"
+    "uboze\0"
+    "ubrat\0"
+    "ubrousek\0"
+    "ubrus\0"
+    "ubytovna\0"
+    "ucho\0"
+    "uctivost\0"
+    "udivit\0"
+    "uhradit\0"
+    "ujednat\0"
+    "ujistit\0"
+    "ujmout\0"
+    "ukazatel\0"
+    "uklidnit\0"
+    "uklonit\0"
+    "ukotvit\0"
+    "ukrojit\0"
+    "ulice\0"
+    "ulita\0"
+    "ulovit\0"
+    "umyvadlo\0"
+    "unavit\0"
+    "uniforma\0"
+    "uniknout\0"
+    "upadnout\0"
+    "uplatnit\0"
+    "uplynout\0"
+    "upoutat\0"
+    "upravit\0"
+    "uran\0"
+    "urazit\0"
+    "usednout\0"
+    "usilovat\0"
+    "usmrtit\0"
+    "usnadnit\0"
+    "usnout\0"
+    "usoudit\0"
+    "ustlat\0"
+    "ustrnout\0"
+    "utahovat\0"
+    "utkat\0"
+    "utlumit\0"
+    "utonout\0"
+    "utopenec\0"
+    "utrousit\0"
+    "uvalit\0"
+    "uvolnit\0"
+    "uvozovka\0"
+    "uzdravit\0"
+    "uzel\0"
+    "uzenina\0"
+    "uzlina\0"
+    "uznat\0"
+    "vagon\0"
+    "valcha\0"
+    "valoun\0"
+    "vana\0"
+    "vandal\0"
+    "vanilka\0"
+    "varan\0"
+    "varhany\0"
+    "varovat\0"
+    "vcelku\0"
+    "vchod\0"
+    "vdova\0"
+    "vedro\0"
+    "vegetace\0"
+    "vejce\0"
+    "velbloud\0"
+    "veletrh\0"
+    "velitel\0"
+    "velmoc\0"
+    "velryba\0"
+    "venkov\0"
+    "veranda\0"
+    "verze\0"
+    "veselka\0"
+    "veskrze\0"
+    "vesnice\0"
+    "vespodu\0"
+    "vesta\0"
+    "veterina\0"
+    "veverka\0"
+    "vibrace\0"
+    "vichr\0"
+    "videohra\0"
+    "vidina\0"
+    "vidle\0"
+    "vila\0"
+    "vinice\0"
+    "viset\0"
+    "vitalita\0"
+    "vize\0"
+    "vizitka\0"
+    "vjezd\0"
+    "vklad\0"
+    "vkus\0"
+    "vlajka\0"
+    "vlak\0"
+    "vlasec\0"
+    "vlevo\0"
+    "vlhkost\0"
+    "vliv\0"
+    "vlnovka\0"
+    "vloupat\0"
+    "vnucovat\0"
+    "vnuk\0"
+    "voda\0"
+    "vodivost\0"
+    "vodoznak\0"
+    "vodstvo\0"
+    "vojensky\0"
+    "vojna\0"
+    "vojsko\0"
+    "volant\0"
+    "volba\0"
+    "volit\0"
+    "volno\0"
+    "voskovka\0"
+    "vozidlo\0"
+    "vozovna\0"
+    "vpravo\0"
+    "vrabec\0"
+    "vracet\0"
+    "vrah\0"
+    "vrata\0"
+    "vrba\0"
+    "vrcholek\0"
+    "vrhat\0"
+    "vrstva\0"
+    "vrtule\0"
+    "vsadit\0"
+    "vstoupit\0"
+    "vstup\0"
+    "vtip\0"
+    "vybavit\0"
+    "vybrat\0"
+    "vychovat\0"
+    "vydat\0"
+    "vydra\0"
+    "vyfotit\0"
+    "vyhledat\0"
+    "vyhnout\0"
+    "vyhodit\0"
+    "vyhradit\0"
+    "vyhubit\0"
+    "vyjasnit\0"
+    "vyjet\0"
+    "vyjmout\0"
+    "vyklopit\0"
+    "vykonat\0"
+    "vylekat\0"
+    "vymazat\0"
+    "vymezit\0"
+    "vymizet\0"
+    "vymyslet\0"
+    "vynechat\0"
+    "vynikat\0"
+    "vynutit\0"
+    "vypadat\0"
+    "vyplatit\0"
+    "vypravit\0"
+    "vypustit\0"
+    "vyrazit\0"
+    "vyrovnat\0"
+    "vyrvat\0"
+    "vyslovit\0"
+    "vysoko\0"
+    "vystavit\0"
+    "vysunout\0"
+    "vysypat\0"
+    "vytasit\0"
+    "vytesat\0"
+    "vytratit\0"
+    "vyvinout\0"
+    "vyvolat\0"
+    "vyvrhel\0"
+    "vyzdobit\0"
+    "vyznat\0"
+    "vzadu\0"
+    "vzbudit\0"
+    "vzchopit\0"
+    "vzdor\0"
+    "vzduch\0"
+    "vzdychat\0"
+    "vzestup\0"
+    "vzhledem\0"
+    "vzkaz\0"
+    "vzlykat\0"
+    "vznik\0"
+    "vzorek\0"
+    "vzpoura\0"
+    "vztah\0"
+    "vztek\0"
+    "xylofon\0"
+    "zabrat\0"
+    "zabydlet\0"
+    "zachovat\0"
+    "zadarmo\0"
+    "zadusit\0"
+    "zafoukat\0"
+    "zahltit\0"
+    "zahodit\0"
+    "zahrada\0"
+    "zahynout\0"
+    "zajatec\0"
+    "zajet\0"
+    "zajistit\0"
+    "zaklepat\0"
+    "zakoupit\0"
+    "zalepit\0"
+    "zamezit\0"
+    "zamotat\0"
+    "zamyslet\0"
+    "zanechat\0"
+    "zanikat\0"
+    "zaplatit\0"
+    "zapojit\0"
+    "zapsat\0"
+    "zarazit\0"
+    "zastavit\0"
+    "zasunout\0"
+    "zatajit\0"
+    "zatemnit\0"
+    "zatknout\0"
+    "zaujmout\0"
+    "zavalit\0"
+    "zavelet\0"
+    "zavinit\0"
+    "zavolat\0"
+    "zavrtat\0"
+    "zazvonit\0"
+    "zbavit\0"
+    "zbrusu\0"
+    "zbudovat\0"
+    "zbytek\0"
+    "zdaleka\0"
+    "zdarma\0"
+    "zdatnost\0"
+    "zdivo\0"
+    "zdobit\0"
+    "zdroj\0"
+    "zdvih\0"
+    "zdymadlo\0"
+    "zelenina\0"
+    "zeman\0"
+    "zemina\0"
+    "zeptat\0"
+    "zezadu\0"
+    "zezdola\0"
+    "zhatit\0"
+    "zhltnout\0"
+    "zhluboka\0"
+    "zhotovit\0"
+    "zhruba\0"
+    "zima\0"
+    "zimnice\0"
+    "zjemnit\0"
+    "zklamat\0"
+    "zkoumat\0"
+    "zkratka\0"
+    "zkumavka\0"
+    "zlato\0"
+    "zlehka\0"
+    "zloba\0"
+    "zlom\0"
+    "zlost\0"
+    "zlozvyk\0"
+    "zmapovat\0"
+    "zmar\0"
+    "zmatek\0"
+    "zmije\0"
+    "zmizet\0"
+    "zmocnit\0"
+    "zmodrat\0"
+    "zmrzlina\0"
+    "zmutovat\0"
+    "znak\0"
+    "znalost\0"
+    "znamenat\0"
+    "znovu\0"
+    "zobrazit\0"
+    "zotavit\0"
+    "zoubek\0"
+    "zoufale\0"
+    "zplodit\0"
+    "zpomalit\0"
+    "zprava\0"
+    "zprostit\0"
+    "zprudka\0"
+    "zprvu\0"
+    "zrada\0"
+    "zranit\0"
+    "zrcadlo\0"
+    "zrnitost\0"
+    "zrno\0"
+    "zrovna\0"
+    "zrychlit\0"
+    "zrzavost\0"
+    "zticha\0"
+    "ztratit\0"
+    "zubovina\0"
+    "zubr\0"
+    "zvednout\0"
+    "zvenku\0"
+    "zvesela\0"
+    "zvon\0"
+    "zvrat\0"
+    "zvukovod\0"
+    "zvyk";
+
+static const uint16_t cs_offsets[dictionary_size] =
 {
-    {
-        "abdikace",
-        "abeceda",
-        "adresa",
-        "agrese",
-        "akce",
-        "aktovka",
-        "alej",
-        "alkohol",
-        "amputace",
-        "ananas",
-        "andulka",
-        "anekdota",
-        "anketa",
-        "antika",
-        "anulovat",
-        "archa",
-        "arogance",
-        "asfalt",
-        "asistent",
-        "aspirace",
-        "astma",
-        "astronom",
-        "atlas",
-        "atletika",
-        "atol",
-        "autobus",
-        "azyl",
-        "babka",
-        "bachor",
-        "bacil",
-        "baculka",
-        "badatel",
-        "bageta",
-        "bagr",
-        "bahno",
-        "bakterie",
-        "balada",
-        "baletka",
-        "balkon",
-        "balonek",
-        "balvan",
-        "balza",
-        "bambus",
-        "bankomat",
-        "barbar",
-        "baret",
-        "barman",
-        "baroko",
-        "barva",
-        "baterka",
-        "batoh",
-        "bavlna",
-        "bazalka",
-        "bazilika",
-        "bazuka",
-        "bedna",
-        "beran",
-        "beseda",
-        "bestie",
-        "beton",
-        "bezinka",
-        "bezmoc",
-        "beztak",
-        "bicykl",
-        "bidlo",
-        "biftek",
-        "bikiny",
-        "bilance",
-        "biograf",
-        "biolog",
-        "bitva",
-        "bizon",
-        "blahobyt",
-        "blatouch",
-        "blecha",
-        "bledule",
-        "blesk",
-        "blikat",
-        "blizna",
-        "blokovat",
-        "bloudit",
-        "blud",
-        "bobek",
-        "bobr",
-        "bodlina",
-        "bodnout",
-        "bohatost",
-        "bojkot",
-        "bojovat",
-        "bokorys",
-        "bolest",
-        "borec",
-        "borovice",
-        "bota",
-        "boubel",
-        "bouchat",
-        "bouda",
-        "boule",
-        "bourat",
-        "boxer",
-        "bradavka",
-        "brambora",
-        "branka",
-        "bratr",
-        "brepta",
-        "briketa",
-        "brko",
-        "brloh",
-        "bronz",
-        "broskev",
-        "brunetka",
-        "brusinka",
-        "brzda",
-        "brzy",
-        "bublina",
-        "bubnovat",
-        "buchta",
-        "buditel",
-        "budka",
-        "budova",
-        "bufet",
-        "bujarost",
-        "bukvice",
-        "buldok",
-        "bulva",
-        "bunda",
-        "bunkr",
-        "burza",
-        "butik",
-        "buvol",
-        "buzola",
-        "bydlet",
-        "bylina",
-        "bytovka",
-        "bzukot",
-        "capart",
-        "carevna",
-        "cedr",
-        "cedule",
-        "cejch",
-        "cejn",
-        "cela",
-        "celer",
-        "celkem",
-        "celnice",
-        "cenina",
-        "cennost",
-        "cenovka",
-        "centrum",
-        "cenzor",
-        "cestopis",
-        "cetka",
-        "chalupa",
-        "chapadlo",
-        "charita",
-        "chata",
-        "chechtat",
-        "chemie",
-        "chichot",
-        "chirurg",
-        "chlad",
-        "chleba",
-        "chlubit",
-        "chmel",
-        "chmura",
-        "chobot",
-        "chochol",
-        "chodba",
-        "cholera",
-        "chomout",
-        "chopit",
-        "choroba",
-        "chov",
-        "chrapot",
-        "chrlit",
-        "chrt",
-        "chrup",
-        "chtivost",
-        "chudina",
-        "chutnat",
-        "chvat",
-        "chvilka",
-        "chvost",
-        "chyba",
-        "chystat",
-        "chytit",
-        "cibule",
-        "cigareta",
-        "cihelna",
-        "cihla",
-        "cinkot",
-        "cirkus",
-        "cisterna",
-        "citace",
-        "citrus",
-        "cizinec",
-        "cizost",
-        "clona",
-        "cokoliv",
-        "couvat",
-        "ctitel",
-        "ctnost",
-        "cudnost",
-        "cuketa",
-        "cukr",
-        "cupot",
-        "cvaknout",
-        "cval",
-        "cvik",
-        "cvrkot",
-        "cyklista",
-        "daleko",
-        "dareba",
-        "datel",
-        "datum",
-        "dcera",
-        "debata",
-        "dechovka",
-        "decibel",
-        "deficit",
-        "deflace",
-        "dekl",
-        "dekret",
-        "demokrat",
-        "deprese",
-        "derby",
-        "deska",
-        "detektiv",
-        "dikobraz",
-        "diktovat",
-        "dioda",
-        "diplom",
-        "disk",
-        "displej",
-        "divadlo",
-        "divoch",
-        "dlaha",
-        "dlouho",
-        "dluhopis",
-        "dnes",
-        "dobro",
-        "dobytek",
-        "docent",
-        "dochutit",
-        "dodnes",
-        "dohled",
-        "dohoda",
-        "dohra",
-        "dojem",
-        "dojnice",
-        "doklad",
-        "dokola",
-        "doktor",
-        "dokument",
-        "dolar",
-        "doleva",
-        "dolina",
-        "doma",
-        "dominant",
-        "domluvit",
-        "domov",
-        "donutit",
-        "dopad",
-        "dopis",
-        "doplnit",
-        "doposud",
-        "doprovod",
-        "dopustit",
-        "dorazit",
-        "dorost",
-        "dort",
-        "dosah",
-        "doslov",
-        "dostatek",
-        "dosud",
-        "dosyta",
-        "dotaz",
-        "dotek",
-        "dotknout",
-        "doufat",
-        "doutnat",
-        "dovozce",
-        "dozadu",
-        "doznat",
-        "dozorce",
-        "drahota",
-        "drak",
-        "dramatik",
-        "dravec",
-        "draze",
-        "drdol",
-        "drobnost",
-        "drogerie",
-        "drozd",
-        "drsnost",
-        "drtit",
-        "drzost",
-        "duben",
-        "duchovno",
-        "dudek",
-        "duha",
-        "duhovka",
-        "dusit",
-        "dusno",
-        "dutost",
-        "dvojice",
-        "dvorec",
-        "dynamit",
-        "ekolog",
-        "ekonomie",
-        "elektron",
-        "elipsa",
-        "email",
-        "emise",
-        "emoce",
-        "empatie",
-        "epizoda",
-        "epocha",
-        "epopej",
-        "epos",
-        "esej",
-        "esence",
-        "eskorta",
-        "eskymo",
-        "etiketa",
-        "euforie",
-        "evoluce",
-        "exekuce",
-        "exkurze",
-        "expedice",
-        "exploze",
-        "export",
-        "extrakt",
-        "facka",
-        "fajfka",
-        "fakulta",
-        "fanatik",
-        "fantazie",
-        "farmacie",
-        "favorit",
-        "fazole",
-        "federace",
-        "fejeton",
-        "fenka",
-        "fialka",
-        "figurant",
-        "filozof",
-        "filtr",
-        "finance",
-        "finta",
-        "fixace",
-        "fjord",
-        "flanel",
-        "flirt",
-        "flotila",
-        "fond",
-        "fosfor",
-        "fotbal",
-        "fotka",
-        "foton",
-        "frakce",
-        "freska",
-        "fronta",
-        "fukar",
-        "funkce",
-        "fyzika",
-        "galeje",
-        "garant",
-        "genetika",
-        "geolog",
-        "gilotina",
-        "glazura",
-        "glejt",
-        "golem",
-        "golfista",
-        "gotika",
-        "graf",
-        "gramofon",
-        "granule",
-        "grep",
-        "gril",
-        "grog",
-        "groteska",
-        "guma",
-        "hadice",
-        "hadr",
-        "hala",
-        "halenka",
-        "hanba",
-        "hanopis",
-        "harfa",
-        "harpuna",
-        "havran",
-        "hebkost",
-        "hejkal",
-        "hejno",
-        "hejtman",
-        "hektar",
-        "helma",
-        "hematom",
-        "herec",
-        "herna",
-        "heslo",
-        "hezky",
-        "historik",
-        "hladovka",
-        "hlasivky",
-        "hlava",
-        "hledat",
-        "hlen",
-        "hlodavec",
-        "hloh",
-        "hloupost",
-        "hltat",
-        "hlubina",
-        "hluchota",
-        "hmat",
-        "hmota",
-        "hmyz",
-        "hnis",
-        "hnojivo",
-        "hnout",
-        "hoblina",
-        "hoboj",
-        "hoch",
-        "hodiny",
-        "hodlat",
-        "hodnota",
-        "hodovat",
-        "hojnost",
-        "hokej",
-        "holinka",
-        "holka",
-        "holub",
-        "homole",
-        "honitba",
-        "honorace",
-        "horal",
-        "horda",
-        "horizont",
-        "horko",
-        "horlivec",
-        "hormon",
-        "hornina",
-        "horoskop",
-        "horstvo",
-        "hospoda",
-        "hostina",
-        "hotovost",
-        "houba",
-        "houf",
-        "houpat",
-        "houska",
-        "hovor",
-        "hradba",
-        "hranice",
-        "hravost",
-        "hrazda",
-        "hrbolek",
-        "hrdina",
-        "hrdlo",
-        "hrdost",
-        "hrnek",
-        "hrobka",
-        "hromada",
-        "hrot",
-        "hrouda",
-        "hrozen",
-        "hrstka",
-        "hrubost",
-        "hryzat",
-        "hubenost",
-        "hubnout",
-        "hudba",
-        "hukot",
-        "humr",
-        "husita",
-        "hustota",
-        "hvozd",
-        "hybnost",
-        "hydrant",
-        "hygiena",
-        "hymna",
-        "hysterik",
-        "idylka",
-        "ihned",
-        "ikona",
-        "iluze",
-        "imunita",
-        "infekce",
-        "inflace",
-        "inkaso",
-        "inovace",
-        "inspekce",
-        "internet",
-        "invalida",
-        "investor",
-        "inzerce",
-        "ironie",
-        "jablko",
-        "jachta",
-        "jahoda",
-        "jakmile",
-        "jakost",
-        "jalovec",
-        "jantar",
-        "jarmark",
-        "jaro",
-        "jasan",
-        "jasno",
-        "jatka",
-        "javor",
-        "jazyk",
-        "jedinec",
-        "jedle",
-        "jednatel",
-        "jehlan",
-        "jekot",
-        "jelen",
-        "jelito",
-        "jemnost",
-        "jenom",
-        "jepice",
-        "jeseter",
-        "jevit",
-        "jezdec",
-        "jezero",
-        "jinak",
-        "jindy",
-        "jinoch",
-        "jiskra",
-        "jistota",
-        "jitrnice",
-        "jizva",
-        "jmenovat",
-        "jogurt",
-        "jurta",
-        "kabaret",
-        "kabel",
-        "kabinet",
-        "kachna",
-        "kadet",
-        "kadidlo",
-        "kahan",
-        "kajak",
-        "kajuta",
-        "kakao",
-        "kaktus",
-        "kalamita",
-        "kalhoty",
-        "kalibr",
-        "kalnost",
-        "kamera",
-        "kamkoliv",
-        "kamna",
-        "kanibal",
-        "kanoe",
-        "kantor",
-        "kapalina",
-        "kapela",
-        "kapitola",
-        "kapka",
-        "kaple",
-        "kapota",
-        "kapr",
-        "kapusta",
-        "kapybara",
-        "karamel",
-        "karotka",
-        "karton",
-        "kasa",
-        "katalog",
-        "katedra",
-        "kauce",
-        "kauza",
-        "kavalec",
-        "kazajka",
-        "kazeta",
-        "kazivost",
-        "kdekoliv",
-        "kdesi",
-        "kedluben",
-        "kemp",
-        "keramika",
-        "kino",
-        "klacek",
-        "kladivo",
-        "klam",
-        "klapot",
-        "klasika",
-        "klaun",
-        "klec",
-        "klenba",
-        "klepat",
-        "klesnout",
-        "klid",
-        "klima",
-        "klisna",
-        "klobouk",
-        "klokan",
-        "klopa",
-        "kloub",
-        "klubovna",
-        "klusat",
-        "kluzkost",
-        "kmen",
-        "kmitat",
-        "kmotr",
-        "kniha",
-        "knot",
-        "koalice",
-        "koberec",
-        "kobka",
-        "kobliha",
-        "kobyla",
-        "kocour",
-        "kohout",
-        "kojenec",
-        "kokos",
-        "koktejl",
-        "kolaps",
-        "koleda",
-        "kolize",
-        "kolo",
-        "komando",
-        "kometa",
-        "komik",
-        "komnata",
-        "komora",
-        "kompas",
-        "komunita",
-        "konat",
-        "koncept",
-        "kondice",
-        "konec",
-        "konfese",
-        "kongres",
-        "konina",
-        "konkurs",
-        "kontakt",
-        "konzerva",
-        "kopanec",
-        "kopie",
-        "kopnout",
-        "koprovka",
-        "korbel",
-        "korektor",
-        "kormidlo",
-        "koroptev",
-        "korpus",
-        "koruna",
-        "koryto",
-        "korzet",
-        "kosatec",
-        "kostka",
-        "kotel",
-        "kotleta",
-        "kotoul",
-        "koukat",
-        "koupelna",
-        "kousek",
-        "kouzlo",
-        "kovboj",
-        "koza",
-        "kozoroh",
-        "krabice",
-        "krach",
-        "krajina",
-        "kralovat",
-        "krasopis",
-        "kravata",
-        "kredit",
-        "krejcar",
-        "kresba",
-        "kreveta",
-        "kriket",
-        "kritik",
-        "krize",
-        "krkavec",
-        "krmelec",
-        "krmivo",
-        "krocan",
-        "krok",
-        "kronika",
-        "kropit",
-        "kroupa",
-        "krovka",
-        "krtek",
-        "kruhadlo",
-        "krupice",
-        "krutost",
-        "krvinka",
-        "krychle",
-        "krypta",
-        "krystal",
-        "kryt",
-        "kudlanka",
-        "kufr",
-        "kujnost",
-        "kukla",
-        "kulajda",
-        "kulich",
-        "kulka",
-        "kulomet",
-        "kultura",
-        "kuna",
-        "kupodivu",
-        "kurt",
-        "kurzor",
-        "kutil",
-        "kvalita",
-        "kvasinka",
-        "kvestor",
-        "kynolog",
-        "kyselina",
-        "kytara",
-        "kytice",
-        "kytka",
-        "kytovec",
-        "kyvadlo",
-        "labrador",
-        "lachtan",
-        "ladnost",
-        "laik",
-        "lakomec",
-        "lamela",
-        "lampa",
-        "lanovka",
-        "lasice",
-        "laso",
-        "lastura",
-        "latinka",
-        "lavina",
-        "lebka",
-        "leckdy",
-        "leden",
-        "lednice",
-        "ledovka",
-        "ledvina",
-        "legenda",
-        "legie",
-        "legrace",
-        "lehce",
-        "lehkost",
-        "lehnout",
-        "lektvar",
-        "lenochod",
-        "lentilka",
-        "lepenka",
-        "lepidlo",
-        "letadlo",
-        "letec",
-        "letmo",
-        "letokruh",
-        "levhart",
-        "levitace",
-        "levobok",
-        "libra",
-        "lichotka",
-        "lidojed",
-        "lidskost",
-        "lihovina",
-        "lijavec",
-        "lilek",
-        "limetka",
-        "linie",
-        "linka",
-        "linoleum",
-        "listopad",
-        "litina",
-        "litovat",
-        "lobista",
-        "lodivod",
-        "logika",
-        "logoped",
-        "lokalita",
-        "loket",
-        "lomcovat",
-        "lopata",
-        "lopuch",
-        "lord",
-        "losos",
-        "lotr",
-        "loudal",
-        "louh",
-        "louka",
-        "louskat",
-        "lovec",
-        "lstivost",
-        "lucerna",
-        "lucifer",
-        "lump",
-        "lusk",
-        "lustrace",
-        "lvice",
-        "lyra",
-        "lyrika",
-        "lysina",
-        "madam",
-        "madlo",
-        "magistr",
-        "mahagon",
-        "majetek",
-        "majitel",
-        "majorita",
-        "makak",
-        "makovice",
-        "makrela",
-        "malba",
-        "malina",
-        "malovat",
-        "malvice",
-        "maminka",
-        "mandle",
-        "manko",
-        "marnost",
-        "masakr",
-        "maskot",
-        "masopust",
-        "matice",
-        "matrika",
-        "maturita",
-        "mazanec",
-        "mazivo",
-        "mazlit",
-        "mazurka",
-        "mdloba",
-        "mechanik",
-        "meditace",
-        "medovina",
-        "melasa",
-        "meloun",
-        "mentolka",
-        "metla",
-        "metoda",
-        "metr",
-        "mezera",
-        "migrace",
-        "mihnout",
-        "mihule",
-        "mikina",
-        "mikrofon",
-        "milenec",
-        "milimetr",
-        "milost",
-        "mimika",
-        "mincovna",
-        "minibar",
-        "minomet",
-        "minulost",
-        "miska",
-        "mistr",
-        "mixovat",
-        "mladost",
-        "mlha",
-        "mlhovina",
-        "mlok",
-        "mlsat",
-        "mluvit",
-        "mnich",
-        "mnohem",
-        "mobil",
-        "mocnost",
-        "modelka",
-        "modlitba",
-        "mohyla",
-        "mokro",
-        "molekula",
-        "momentka",
-        "monarcha",
-        "monokl",
-        "monstrum",
-        "montovat",
-        "monzun",
-        "mosaz",
-        "moskyt",
-        "most",
-        "motivace",
-        "motorka",
-        "motyka",
-        "moucha",
-        "moudrost",
-        "mozaika",
-        "mozek",
-        "mozol",
-        "mramor",
-        "mravenec",
-        "mrkev",
-        "mrtvola",
-        "mrzet",
-        "mrzutost",
-        "mstitel",
-        "mudrc",
-        "muflon",
-        "mulat",
-        "mumie",
-        "munice",
-        "muset",
-        "mutace",
-        "muzeum",
-        "muzikant",
-        "myslivec",
-        "mzda",
-        "nabourat",
-        "nachytat",
-        "nadace",
-        "nadbytek",
-        "nadhoz",
-        "nadobro",
-        "nadpis",
-        "nahlas",
-        "nahnat",
-        "nahodile",
-        "nahradit",
-        "naivita",
-        "najednou",
-        "najisto",
-        "najmout",
-        "naklonit",
-        "nakonec",
-        "nakrmit",
-        "nalevo",
-        "namazat",
-        "namluvit",
-        "nanometr",
-        "naoko",
-        "naopak",
-        "naostro",
-        "napadat",
-        "napevno",
-        "naplnit",
-        "napnout",
-        "naposled",
-        "naprosto",
-        "narodit",
-        "naruby",
-        "narychlo",
-        "nasadit",
-        "nasekat",
-        "naslepo",
-        "nastat",
-        "natolik",
-        "navenek",
-        "navrch",
-        "navzdory",
-        "nazvat",
-        "nebe",
-        "nechat",
-        "necky",
-        "nedaleko",
-        "nedbat",
-        "neduh",
-        "negace",
-        "nehet",
-        "nehoda",
-        "nejen",
-        "nejprve",
-        "neklid",
-        "nelibost",
-        "nemilost",
-        "nemoc",
-        "neochota",
-        "neonka",
-        "nepokoj",
-        "nerost",
-        "nerv",
-        "nesmysl",
-        "nesoulad",
-        "netvor",
-        "neuron",
-        "nevina",
-        "nezvykle",
-        "nicota",
-        "nijak",
-        "nikam",
-        "nikdy",
-        "nikl",
-        "nikterak",
-        "nitro",
-        "nocleh",
-        "nohavice",
-        "nominace",
-        "nora",
-        "norek",
-        "nositel",
-        "nosnost",
-        "nouze",
-        "noviny",
-        "novota",
-        "nozdra",
-        "nuda",
-        "nudle",
-        "nuget",
-        "nutit",
-        "nutnost",
-        "nutrie",
-        "nymfa",
-        "obal",
-        "obarvit",
-        "obava",
-        "obdiv",
-        "obec",
-        "obehnat",
-        "obejmout",
-        "obezita",
-        "obhajoba",
-        "obilnice",
-        "objasnit",
-        "objekt",
-        "obklopit",
-        "oblast",
-        "oblek",
-        "obliba",
-        "obloha",
-        "obluda",
-        "obnos",
-        "obohatit",
-        "obojek",
-        "obout",
-        "obrazec",
-        "obrna",
-        "obruba",
-        "obrys",
-        "obsah",
-        "obsluha",
-        "obstarat",
-        "obuv",
-        "obvaz",
-        "obvinit",
-        "obvod",
-        "obvykle",
-        "obyvatel",
-        "obzor",
-        "ocas",
-        "ocel",
-        "ocenit",
-        "ochladit",
-        "ochota",
-        "ochrana",
-        "ocitnout",
-        "odboj",
-        "odbyt",
-        "odchod",
-        "odcizit",
-        "odebrat",
-        "odeslat",
-        "odevzdat",
-        "odezva",
-        "odhadce",
-        "odhodit",
-        "odjet",
-        "odjinud",
-        "odkaz",
-        "odkoupit",
-        "odliv",
-        "odluka",
-        "odmlka",
-        "odolnost",
-        "odpad",
-        "odpis",
-        "odplout",
-        "odpor",
-        "odpustit",
-        "odpykat",
-        "odrazka",
-        "odsoudit",
-        "odstup",
-        "odsun",
-        "odtok",
-        "odtud",
-        "odvaha",
-        "odveta",
-        "odvolat",
-        "odvracet",
-        "odznak",
-        "ofina",
-        "ofsajd",
-        "ohlas",
-        "ohnisko",
-        "ohrada",
-        "ohrozit",
-        "ohryzek",
-        "okap",
-        "okenice",
-        "oklika",
-        "okno",
-        "okouzlit",
-        "okovy",
-        "okrasa",
-        "okres",
-        "okrsek",
-        "okruh",
-        "okupant",
-        "okurka",
-        "okusit",
-        "olejnina",
-        "olizovat",
-        "omak",
-        "omeleta",
-        "omezit",
-        "omladina",
-        "omlouvat",
-        "omluva",
-        "omyl",
-        "onehdy",
-        "opakovat",
-        "opasek",
-        "operace",
-        "opice",
-        "opilost",
-        "opisovat",
-        "opora",
-        "opozice",
-        "opravdu",
-        "oproti",
-        "orbital",
-        "orchestr",
-        "orgie",
-        "orlice",
-        "orloj",
-        "ortel",
-        "osada",
-        "oschnout",
-        "osika",
-        "osivo",
-        "oslava",
-        "oslepit",
-        "oslnit",
-        "oslovit",
-        "osnova",
-        "osoba",
-        "osolit",
-        "ospalec",
-        "osten",
-        "ostraha",
-        "ostuda",
-        "ostych",
-        "osvojit",
-        "oteplit",
-        "otisk",
-        "otop",
-        "otrhat",
-        "otrlost",
-        "otrok",
-        "otruby",
-        "otvor",
-        "ovanout",
-        "ovar",
-        "oves",
-        "ovlivnit",
-        "ovoce",
-        "oxid",
-        "ozdoba",
-        "pachatel",
-        "pacient",
-        "padouch",
-        "pahorek",
-        "pakt",
-        "palanda",
-        "palec",
-        "palivo",
-        "paluba",
-        "pamflet",
-        "pamlsek",
-        "panenka",
-        "panika",
-        "panna",
-        "panovat",
-        "panstvo",
-        "pantofle",
-        "paprika",
-        "parketa",
-        "parodie",
-        "parta",
-        "paruka",
-        "paryba",
-        "paseka",
-        "pasivita",
-        "pastelka",
-        "patent",
-        "patrona",
-        "pavouk",
-        "pazneht",
-        "pazourek",
-        "pecka",
-        "pedagog",
-        "pejsek",
-        "peklo",
-        "peloton",
-        "penalta",
-        "pendrek",
-        "penze",
-        "periskop",
-        "pero",
-        "pestrost",
-        "petarda",
-        "petice",
-        "petrolej",
-        "pevnina",
-        "pexeso",
-        "pianista",
-        "piha",
-        "pijavice",
-        "pikle",
-        "piknik",
-        "pilina",
-        "pilnost",
-        "pilulka",
-        "pinzeta",
-        "pipeta",
-        "pisatel",
-        "pistole",
-        "pitevna",
-        "pivnice",
-        "pivovar",
-        "placenta",
-        "plakat",
-        "plamen",
-        "planeta",
-        "plastika",
-        "platit",
-        "plavidlo",
-        "plaz",
-        "plech",
-        "plemeno",
-        "plenta",
-        "ples",
-        "pletivo",
-        "plevel",
-        "plivat",
-        "plnit",
-        "plno",
-        "plocha",
-        "plodina",
-        "plomba",
-        "plout",
-        "pluk",
-        "plyn",
-        "pobavit",
-        "pobyt",
-        "pochod",
-        "pocit",
-        "poctivec",
-        "podat",
-        "podcenit",
-        "podepsat",
-        "podhled",
-        "podivit",
-        "podklad",
-        "podmanit",
-        "podnik",
-        "podoba",
-        "podpora",
-        "podraz",
-        "podstata",
-        "podvod",
-        "podzim",
-        "poezie",
-        "pohanka",
-        "pohnutka",
-        "pohovor",
-        "pohroma",
-        "pohyb",
-        "pointa",
-        "pojistka",
-        "pojmout",
-        "pokazit",
-        "pokles",
-        "pokoj",
-        "pokrok",
-        "pokuta",
-        "pokyn",
-        "poledne",
-        "polibek",
-        "polknout",
-        "poloha",
-        "polynom",
-        "pomalu",
-        "pominout",
-        "pomlka",
-        "pomoc",
-        "pomsta",
-        "pomyslet",
-        "ponechat",
-        "ponorka",
-        "ponurost",
-        "popadat",
-        "popel",
-        "popisek",
-        "poplach",
-        "poprosit",
-        "popsat",
-        "popud",
-        "poradce",
-        "porce",
-        "porod",
-        "porucha",
-        "poryv",
-        "posadit",
-        "posed",
-        "posila",
-        "poskok",
-        "poslanec",
-        "posoudit",
-        "pospolu",
-        "postava",
-        "posudek",
-        "posyp",
-        "potah",
-        "potkan",
-        "potlesk",
-        "potomek",
-        "potrava",
-        "potupa",
-        "potvora",
-        "poukaz",
-        "pouto",
-        "pouzdro",
-        "povaha",
-        "povidla",
-        "povlak",
-        "povoz",
-        "povrch",
-        "povstat",
-        "povyk",
-        "povzdech",
-        "pozdrav",
-        "pozemek",
-        "poznatek",
-        "pozor",
-        "pozvat",
-        "pracovat",
-        "prahory",
-        "praktika",
-        "prales",
-        "praotec",
-        "praporek",
-        "prase",
-        "pravda",
-        "princip",
-        "prkno",
-        "probudit",
-        "procento",
-        "prodej",
-        "profese",
-        "prohra",
-        "projekt",
-        "prolomit",
-        "promile",
-        "pronikat",
-        "propad",
-        "prorok",
-        "prosba",
-        "proton",
-        "proutek",
-        "provaz",
-        "prskavka",
-        "prsten",
-        "prudkost",
-        "prut",
-        "prvek",
-        "prvohory",
-        "psanec",
-        "psovod",
-        "pstruh",
-        "ptactvo",
-        "puberta",
-        "puch",
-        "pudl",
-        "pukavec",
-        "puklina",
-        "pukrle",
-        "pult",
-        "pumpa",
-        "punc",
-        "pupen",
-        "pusa",
-        "pusinka",
-        "pustina",
-        "putovat",
-        "putyka",
-        "pyramida",
-        "pysk",
-        "pytel",
-        "racek",
-        "rachot",
-        "radiace",
-        "radnice",
-        "radon",
-        "raft",
-        "ragby",
-        "raketa",
-        "rakovina",
-        "rameno",
-        "rampouch",
-        "rande",
-        "rarach",
-        "rarita",
-        "rasovna",
-        "rastr",
-        "ratolest",
-        "razance",
-        "razidlo",
-        "reagovat",
-        "reakce",
-        "recept",
-        "redaktor",
-        "referent",
-        "reflex",
-        "rejnok",
-        "reklama",
-        "rekord",
-        "rekrut",
-        "rektor",
-        "reputace",
-        "revize",
-        "revma",
-        "revolver",
-        "rezerva",
-        "riskovat",
-        "riziko",
-        "robotika",
-        "rodokmen",
-        "rohovka",
-        "rokle",
-        "rokoko",
-        "romaneto",
-        "ropovod",
-        "ropucha",
-        "rorejs",
-        "rosol",
-        "rostlina",
-        "rotmistr",
-        "rotoped",
-        "rotunda",
-        "roubenka",
-        "roucho",
-        "roup",
-        "roura",
-        "rovina",
-        "rovnice",
-        "rozbor",
-        "rozchod",
-        "rozdat",
-        "rozeznat",
-        "rozhodce",
-        "rozinka",
-        "rozjezd",
-        "rozkaz",
-        "rozloha",
-        "rozmar",
-        "rozpad",
-        "rozruch",
-        "rozsah",
-        "roztok",
-        "rozum",
-        "rozvod",
-        "rubrika",
-        "ruchadlo",
-        "rukavice",
-        "rukopis",
-        "ryba",
-        "rybolov",
-        "rychlost",
-        "rydlo",
-        "rypadlo",
-        "rytina",
-        "ryzost",
-        "sadista",
-        "sahat",
-        "sako",
-        "samec",
-        "samizdat",
-        "samota",
-        "sanitka",
-        "sardinka",
-        "sasanka",
-        "satelit",
-        "sazba",
-        "sazenice",
-        "sbor",
-        "schovat",
-        "sebranka",
-        "secese",
-        "sedadlo",
-        "sediment",
-        "sedlo",
-        "sehnat",
-        "sejmout",
-        "sekera",
-        "sekta",
-        "sekunda",
-        "sekvoje",
-        "semeno",
-        "seno",
-        "servis",
-        "sesadit",
-        "seshora",
-        "seskok",
-        "seslat",
-        "sestra",
-        "sesuv",
-        "sesypat",
-        "setba",
-        "setina",
-        "setkat",
-        "setnout",
-        "setrvat",
-        "sever",
-        "seznam",
-        "shoda",
-        "shrnout",
-        "sifon",
-        "silnice",
-        "sirka",
-        "sirotek",
-        "sirup",
-        "situace",
-        "skafandr",
-        "skalisko",
-        "skanzen",
-        "skaut",
-        "skeptik",
-        "skica",
-        "skladba",
-        "sklenice",
-        "sklo",
-        "skluz",
-        "skoba",
-        "skokan",
-        "skoro",
-        "skripta",
-        "skrz",
-        "skupina",
-        "skvost",
-        "skvrna",
-        "slabika",
-        "sladidlo",
-        "slanina",
-        "slast",
-        "slavnost",
-        "sledovat",
-        "slepec",
-        "sleva",
-        "slezina",
-        "slib",
-        "slina",
-        "sliznice",
-        "slon",
-        "sloupek",
-        "slovo",
-        "sluch",
-        "sluha",
-        "slunce",
-        "slupka",
-        "slza",
-        "smaragd",
-        "smetana",
-        "smilstvo",
-        "smlouva",
-        "smog",
-        "smrad",
-        "smrk",
-        "smrtka",
-        "smutek",
-        "smysl",
-        "snad",
-        "snaha",
-        "snob",
-        "sobota",
-        "socha",
-        "sodovka",
-        "sokol",
-        "sopka",
-        "sotva",
-        "souboj",
-        "soucit",
-        "soudce",
-        "souhlas",
-        "soulad",
-        "soumrak",
-        "souprava",
-        "soused",
-        "soutok",
-        "souviset",
-        "spalovna",
-        "spasitel",
-        "spis",
-        "splav",
-        "spodek",
-        "spojenec",
-        "spolu",
-        "sponzor",
-        "spornost",
-        "spousta",
-        "sprcha",
-        "spustit",
-        "sranda",
-        "sraz",
-        "srdce",
-        "srna",
-        "srnec",
-        "srovnat",
-        "srpen",
-        "srst",
-        "srub",
-        "stanice",
-        "starosta",
-        "statika",
-        "stavba",
-        "stehno",
-        "stezka",
-        "stodola",
-        "stolek",
-        "stopa",
-        "storno",
-        "stoupat",
-        "strach",
-        "stres",
-        "strhnout",
-        "strom",
-        "struna",
-        "studna",
-        "stupnice",
-        "stvol",
-        "styk",
-        "subjekt",
-        "subtropy",
-        "suchar",
-        "sudost",
-        "sukno",
-        "sundat",
-        "sunout",
-        "surikata",
-        "surovina",
-        "svah",
-        "svalstvo",
-        "svetr",
-        "svatba",
-        "svazek",
-        "svisle",
-        "svitek",
-        "svoboda",
-        "svodidlo",
-        "svorka",
-        "svrab",
-        "sykavka",
-        "sykot",
-        "synek",
-        "synovec",
-        "sypat",
-        "sypkost",
-        "syrovost",
-        "sysel",
-        "sytost",
-        "tabletka",
-        "tabule",
-        "tahoun",
-        "tajemno",
-        "tajfun",
-        "tajga",
-        "tajit",
-        "tajnost",
-        "taktika",
-        "tamhle",
-        "tampon",
-        "tancovat",
-        "tanec",
-        "tanker",
-        "tapeta",
-        "tavenina",
-        "tazatel",
-        "technika",
-        "tehdy",
-        "tekutina",
-        "telefon",
-        "temnota",
-        "tendence",
-        "tenista",
-        "tenor",
-        "teplota",
-        "tepna",
-        "teprve",
-        "terapie",
-        "termoska",
-        "textil",
-        "ticho",
-        "tiskopis",
-        "titulek",
-        "tkadlec",
-        "tkanina",
-        "tlapka",
-        "tleskat",
-        "tlukot",
-        "tlupa",
-        "tmel",
-        "toaleta",
-        "topinka",
-        "topol",
-        "torzo",
-        "touha",
-        "toulec",
-        "tradice",
-        "traktor",
-        "tramp",
-        "trasa",
-        "traverza",
-        "trefit",
-        "trest",
-        "trezor",
-        "trhavina",
-        "trhlina",
-        "trochu",
-        "trojice",
-        "troska",
-        "trouba",
-        "trpce",
-        "trpitel",
-        "trpkost",
-        "trubec",
-        "truchlit",
-        "truhlice",
-        "trus",
-        "trvat",
-        "tudy",
-        "tuhnout",
-        "tuhost",
-        "tundra",
-        "turista",
-        "turnaj",
-        "tuzemsko",
-        "tvaroh",
-        "tvorba",
-        "tvrdost",
-        "tvrz",
-        "tygr",
-        "tykev",
-        "ubohost",
-        "uboze",
-        "ubrat",
-        "ubrousek",
-        "ubrus",
-        "ubytovna",
-        "ucho",
-        "uctivost",
-        "udivit",
-        "uhradit",
-        "ujednat",
-        "ujistit",
-        "ujmout",
-        "ukazatel",
-        "uklidnit",
-        "uklonit",
-        "ukotvit",
-        "ukrojit",
-        "ulice",
-        "ulita",
-        "ulovit",
-        "umyvadlo",
-        "unavit",
-        "uniforma",
-        "uniknout",
-        "upadnout",
-        "uplatnit",
-        "uplynout",
-        "upoutat",
-        "upravit",
-        "uran",
-        "urazit",
-        "usednout",
-        "usilovat",
-        "usmrtit",
-        "usnadnit",
-        "usnout",
-        "usoudit",
-        "ustlat",
-        "ustrnout",
-        "utahovat",
-        "utkat",
-        "utlumit",
-        "utonout",
-        "utopenec",
-        "utrousit",
-        "uvalit",
-        "uvolnit",
-        "uvozovka",
-        "uzdravit",
-        "uzel",
-        "uzenina",
-        "uzlina",
-        "uznat",
-        "vagon",
-        "valcha",
-        "valoun",
-        "vana",
-        "vandal",
-        "vanilka",
-        "varan",
-        "varhany",
-        "varovat",
-        "vcelku",
-        "vchod",
-        "vdova",
-        "vedro",
-        "vegetace",
-        "vejce",
-        "velbloud",
-        "veletrh",
-        "velitel",
-        "velmoc",
-        "velryba",
-        "venkov",
-        "veranda",
-        "verze",
-        "veselka",
-        "veskrze",
-        "vesnice",
-        "vespodu",
-        "vesta",
-        "veterina",
-        "veverka",
-        "vibrace",
-        "vichr",
-        "videohra",
-        "vidina",
-        "vidle",
-        "vila",
-        "vinice",
-        "viset",
-        "vitalita",
-        "vize",
-        "vizitka",
-        "vjezd",
-        "vklad",
-        "vkus",
-        "vlajka",
-        "vlak",
-        "vlasec",
-        "vlevo",
-        "vlhkost",
-        "vliv",
-        "vlnovka",
-        "vloupat",
-        "vnucovat",
-        "vnuk",
-        "voda",
-        "vodivost",
-        "vodoznak",
-        "vodstvo",
-        "vojensky",
-        "vojna",
-        "vojsko",
-        "volant",
-        "volba",
-        "volit",
-        "volno",
-        "voskovka",
-        "vozidlo",
-        "vozovna",
-        "vpravo",
-        "vrabec",
-        "vracet",
-        "vrah",
-        "vrata",
-        "vrba",
-        "vrcholek",
-        "vrhat",
-        "vrstva",
-        "vrtule",
-        "vsadit",
-        "vstoupit",
-        "vstup",
-        "vtip",
-        "vybavit",
-        "vybrat",
-        "vychovat",
-        "vydat",
-        "vydra",
-        "vyfotit",
-        "vyhledat",
-        "vyhnout",
-        "vyhodit",
-        "vyhradit",
-        "vyhubit",
-        "vyjasnit",
-        "vyjet",
-        "vyjmout",
-        "vyklopit",
-        "vykonat",
-        "vylekat",
-        "vymazat",
-        "vymezit",
-        "vymizet",
-        "vymyslet",
-        "vynechat",
-        "vynikat",
-        "vynutit",
-        "vypadat",
-        "vyplatit",
-        "vypravit",
-        "vypustit",
-        "vyrazit",
-        "vyrovnat",
-        "vyrvat",
-        "vyslovit",
-        "vysoko",
-        "vystavit",
-        "vysunout",
-        "vysypat",
-        "vytasit",
-        "vytesat",
-        "vytratit",
-        "vyvinout",
-        "vyvolat",
-        "vyvrhel",
-        "vyzdobit",
-        "vyznat",
-        "vzadu",
-        "vzbudit",
-        "vzchopit",
-        "vzdor",
-        "vzduch",
-        "vzdychat",
-        "vzestup",
-        "vzhledem",
-        "vzkaz",
-        "vzlykat",
-        "vznik",
-        "vzorek",
-        "vzpoura",
-        "vztah",
-        "vztek",
-        "xylofon",
-        "zabrat",
-        "zabydlet",
-        "zachovat",
-        "zadarmo",
-        "zadusit",
-        "zafoukat",
-        "zahltit",
-        "zahodit",
-        "zahrada",
-        "zahynout",
-        "zajatec",
-        "zajet",
-        "zajistit",
-        "zaklepat",
-        "zakoupit",
-        "zalepit",
-        "zamezit",
-        "zamotat",
-        "zamyslet",
-        "zanechat",
-        "zanikat",
-        "zaplatit",
-        "zapojit",
-        "zapsat",
-        "zarazit",
-        "zastavit",
-        "zasunout",
-        "zatajit",
-        "zatemnit",
-        "zatknout",
-        "zaujmout",
-        "zavalit",
-        "zavelet",
-        "zavinit",
-        "zavolat",
-        "zavrtat",
-        "zazvonit",
-        "zbavit",
-        "zbrusu",
-        "zbudovat",
-        "zbytek",
-        "zdaleka",
-        "zdarma",
-        "zdatnost",
-        "zdivo",
-        "zdobit",
-        "zdroj",
-        "zdvih",
-        "zdymadlo",
-        "zelenina",
-        "zeman",
-        "zemina",
-        "zeptat",
-        "zezadu",
-        "zezdola",
-        "zhatit",
-        "zhltnout",
-        "zhluboka",
-        "zhotovit",
-        "zhruba",
-        "zima",
-        "zimnice",
-        "zjemnit",
-        "zklamat",
-        "zkoumat",
-        "zkratka",
-        "zkumavka",
-        "zlato",
-        "zlehka",
-        "zloba",
-        "zlom",
-        "zlost",
-        "zlozvyk",
-        "zmapovat",
-        "zmar",
-        "zmatek",
-        "zmije",
-        "zmizet",
-        "zmocnit",
-        "zmodrat",
-        "zmrzlina",
-        "zmutovat",
-        "znak",
-        "znalost",
-        "znamenat",
-        "znovu",
-        "zobrazit",
-        "zotavit",
-        "zoubek",
-        "zoufale",
-        "zplodit",
-        "zpomalit",
-        "zprava",
-        "zprostit",
-        "zprudka",
-        "zprvu",
-        "zrada",
-        "zranit",
-        "zrcadlo",
-        "zrnitost",
-        "zrno",
-        "zrovna",
-        "zrychlit",
-        "zrzavost",
-        "zticha",
-        "ztratit",
-        "zubovina",
-        "zubr",
-        "zvednout",
-        "zvenku",
-        "zvesela",
-        "zvon",
-        "zvrat",
-        "zvukovod",
-        "zvyk"
-    }
+    0, 9, 17, 24, 31, 36, 44, 49, 57, 66, 73, 81, 90, 97, 104, 113, 119, 128,
+    135, 144, 153, 159, 168, 174, 183, 188, 196, 201, 207, 214, 220, 228, 236,
+    243, 248, 254, 263, 270, 278, 285, 293, 300, 306, 313, 322, 329, 335, 342,
+    349, 355, 363, 369, 376, 384, 393, 400, 406, 412, 419, 426, 432, 440, 447,
+    454, 461, 467, 474, 481, 489, 497, 504, 510, 516, 525, 534, 541, 549, 555,
+    562, 569, 578, 586, 591, 597, 602, 610, 618, 627, 634, 642, 650, 657, 663,
+    672, 677, 684, 692, 698, 704, 711, 717, 726, 735, 742, 748, 755, 763, 768,
+    774, 780, 788, 797, 806, 812, 817, 825, 834, 841, 849, 855, 862, 868, 877,
+    885, 892, 898, 904, 910, 916, 922, 928, 935, 942, 949, 957, 964, 971, 979,
+    984, 991, 997, 1002, 1007, 1013, 1020, 1028, 1035, 1043, 1051, 1059, 1066,
+    1075, 1081, 1089, 1098, 1106, 1112, 1121, 1128, 1136, 1144, 1150, 1157,
+    1165, 1171, 1178, 1185, 1193, 1200, 1208, 1216, 1223, 1231, 1236, 1244,
+    1251, 1256, 1262, 1271, 1279, 1287, 1293, 1301, 1308, 1314, 1322, 1329,
+    1336, 1345, 1353, 1359, 1366, 1373, 1382, 1389, 1396, 1404, 1411, 1417,
+    1425, 1432, 1439, 1446, 1454, 1461, 1466, 1472, 1481, 1486, 1491, 1498,
+    1507, 1514, 1521, 1527, 1533, 1539, 1546, 1555, 1563, 1571, 1579, 1584,
+    1591, 1600, 1608, 1614, 1620, 1629, 1638, 1647, 1653, 1660, 1665, 1673,
+    1681, 1688, 1694, 1701, 1710, 1715, 1721, 1729, 1736, 1745, 1752, 1759,
+    1766, 1772, 1778, 1786, 1793, 1800, 1807, 1816, 1822, 1829, 1836, 1841,
+    1850, 1859, 1865, 1873, 1879, 1885, 1893, 1901, 1910, 1919, 1927, 1934,
+    1939, 1945, 1952, 1961, 1967, 1974, 1980, 1986, 1995, 2002, 2010, 2018,
+    2025, 2032, 2040, 2048, 2053, 2062, 2069, 2075, 2081, 2090, 2099, 2105,
+    2113, 2119, 2126, 2132, 2141, 2147, 2152, 2160, 2166, 2172, 2179, 2187,
+    2194, 2202, 2209, 2218, 2227, 2234, 2240, 2246, 2252, 2260, 2268, 2275,
+    2282, 2287, 2292, 2299, 2307, 2314, 2322, 2330, 2338, 2346, 2354, 2363,
+    2371, 2378, 2386, 2392, 2399, 2407, 2415, 2424, 2433, 2441, 2448, 2457,
+    2465, 2471, 2478, 2487, 2495, 2501, 2509, 2515, 2522, 2528, 2535, 2541,
+    2549, 2554, 2561, 2568, 2574, 2580, 2587, 2594, 2601, 2607, 2614, 2621,
+    2628, 2635, 2644, 2651, 2660, 2668, 2674, 2680, 2689, 2696, 2701, 2710,
+    2718, 2723, 2728, 2733, 2742, 2747, 2754, 2759, 2764, 2772, 2778, 2786,
+    2792, 2800, 2807, 2815, 2822, 2828, 2836, 2843, 2849, 2857, 2863, 2869,
+    2875, 2881, 2890, 2899, 2908, 2914, 2921, 2926, 2935, 2940, 2949, 2955,
+    2963, 2972, 2977, 2983, 2988, 2993, 3001, 3007, 3015, 3021, 3026, 3033,
+    3040, 3048, 3056, 3064, 3070, 3078, 3084, 3090, 3097, 3105, 3114, 3120,
+    3126, 3135, 3141, 3150, 3157, 3165, 3174, 3182, 3190, 3198, 3207, 3213,
+    3218, 3225, 3232, 3238, 3245, 3253, 3261, 3268, 3276, 3283, 3289, 3296,
+    3302, 3309, 3317, 3322, 3329, 3336, 3343, 3351, 3358, 3367, 3375, 3381,
+    3387, 3392, 3399, 3407, 3413, 3421, 3429, 3437, 3443, 3452, 3459, 3465,
+    3471, 3477, 3485, 3493, 3501, 3508, 3516, 3525, 3534, 3543, 3552, 3560,
+    3567, 3574, 3581, 3588, 3596, 3603, 3611, 3618, 3626, 3631, 3637, 3643,
+    3649, 3655, 3661, 3669, 3675, 3684, 3691, 3697, 3703, 3710, 3718, 3724,
+    3731, 3739, 3745, 3752, 3759, 3765, 3771, 3778, 3785, 3793, 3802, 3808,
+    3817, 3824, 3830, 3838, 3844, 3852, 3859, 3865, 3873, 3879, 3885, 3892,
+    3898, 3905, 3914, 3922, 3929, 3937, 3944, 3953, 3959, 3967, 3973, 3980,
+    3989, 3996, 4005, 4011, 4017, 4024, 4029, 4037, 4046, 4054, 4062, 4069,
+    4074, 4082, 4090, 4096, 4102, 4110, 4118, 4125, 4134, 4143, 4149, 4158,
+    4163, 4172, 4177, 4184, 4192, 4197, 4204, 4212, 4218, 4223, 4230, 4237,
+    4246, 4251, 4257, 4264, 4272, 4279, 4285, 4291, 4300, 4307, 4316, 4321,
+    4328, 4334, 4340, 4345, 4353, 4361, 4367, 4375, 4382, 4389, 4396, 4404,
+    4410, 4418, 4425, 4432, 4439, 4444, 4452, 4459, 4465, 4473, 4480, 4487,
+    4496, 4502, 4510, 4518, 4524, 4532, 4540, 4547, 4555, 4563, 4572, 4580,
+    4586, 4594, 4603, 4610, 4619, 4628, 4637, 4644, 4651, 4658, 4665, 4673,
+    4680, 4686, 4694, 4701, 4708, 4717, 4724, 4731, 4738, 4743, 4751, 4759,
+    4765, 4773, 4782, 4791, 4799, 4806, 4814, 4821, 4829, 4836, 4843, 4849,
+    4857, 4865, 4872, 4879, 4884, 4892, 4899, 4906, 4913, 4919, 4928, 4936,
+    4944, 4952, 4960, 4967, 4975, 4980, 4989, 4994, 5002, 5008, 5016, 5023,
+    5029, 5037, 5045, 5050, 5059, 5064, 5071, 5077, 5085, 5094, 5102, 5110,
+    5119, 5126, 5133, 5139, 5147, 5155, 5164, 5172, 5180, 5185, 5193, 5200,
+    5206, 5214, 5221, 5226, 5234, 5242, 5249, 5255, 5262, 5268, 5276, 5284,
+    5292, 5300, 5306, 5314, 5320, 5328, 5336, 5344, 5353, 5362, 5370, 5378,
+    5386, 5392, 5398, 5407, 5415, 5424, 5432, 5438, 5447, 5455, 5464, 5473,
+    5481, 5487, 5495, 5501, 5507, 5516, 5525, 5532, 5540, 5548, 5556, 5563,
+    5571, 5580, 5586, 5595, 5602, 5609, 5614, 5620, 5625, 5632, 5637, 5643,
+    5651, 5657, 5666, 5674, 5682, 5687, 5692, 5701, 5707, 5712, 5719, 5726,
+    5732, 5738, 5746, 5754, 5762, 5770, 5779, 5785, 5794, 5802, 5808, 5815,
+    5823, 5831, 5839, 5846, 5852, 5860, 5867, 5874, 5883, 5890, 5898, 5907,
+    5915, 5922, 5929, 5937, 5944, 5953, 5962, 5971, 5978, 5985, 5994, 6000,
+    6007, 6012, 6019, 6027, 6035, 6042, 6049, 6058, 6066, 6075, 6082, 6089,
+    6098, 6106, 6114, 6123, 6129, 6135, 6143, 6151, 6156, 6165, 6170, 6176,
+    6183, 6189, 6196, 6202, 6210, 6218, 6227, 6234, 6240, 6249, 6258, 6267,
+    6274, 6283, 6292, 6299, 6305, 6312, 6317, 6326, 6334, 6341, 6348, 6357,
+    6365, 6371, 6377, 6384, 6393, 6399, 6407, 6413, 6422, 6430, 6436, 6443,
+    6449, 6455, 6462, 6468, 6475, 6482, 6491, 6500, 6505, 6514, 6523, 6530,
+    6539, 6546, 6554, 6561, 6568, 6575, 6584, 6593, 6601, 6610, 6618, 6626,
+    6635, 6643, 6651, 6658, 6666, 6675, 6684, 6690, 6697, 6705, 6713, 6721,
+    6729, 6737, 6746, 6755, 6763, 6770, 6779, 6787, 6795, 6803, 6810, 6818,
+    6826, 6833, 6842, 6849, 6854, 6861, 6867, 6876, 6883, 6889, 6896, 6902,
+    6909, 6915, 6923, 6930, 6939, 6948, 6954, 6963, 6970, 6978, 6985, 6990,
+    6998, 7007, 7014, 7021, 7028, 7037, 7044, 7050, 7056, 7062, 7067, 7076,
+    7082, 7089, 7098, 7107, 7112, 7118, 7126, 7134, 7140, 7147, 7154, 7161,
+    7166, 7172, 7178, 7184, 7192, 7199, 7205, 7210, 7218, 7224, 7230, 7235,
+    7243, 7252, 7260, 7269, 7278, 7287, 7294, 7303, 7310, 7316, 7323, 7330,
+    7337, 7343, 7352, 7359, 7365, 7373, 7379, 7386, 7392, 7398, 7406, 7415,
+    7420, 7426, 7434, 7440, 7448, 7457, 7463, 7468, 7473, 7480, 7489, 7496,
+    7504, 7513, 7519, 7525, 7532, 7540, 7548, 7556, 7565, 7572, 7580, 7588,
+    7594, 7602, 7608, 7617, 7623, 7630, 7637, 7646, 7652, 7658, 7666, 7672,
+    7681, 7689, 7697, 7706, 7713, 7719, 7725, 7731, 7738, 7745, 7753, 7762,
+    7769, 7775, 7782, 7788, 7796, 7803, 7811, 7819, 7824, 7832, 7839, 7844,
+    7853, 7859, 7866, 7872, 7879, 7885, 7893, 7900, 7907, 7916, 7925, 7930,
+    7938, 7945, 7954, 7963, 7970, 7975, 7982, 7991, 7998, 8006, 8012, 8020,
+    8029, 8035, 8043, 8051, 8058, 8066, 8075, 8081, 8088, 8094, 8100, 8106,
+    8115, 8121, 8127, 8134, 8142, 8149, 8157, 8164, 8170, 8177, 8185, 8191,
+    8199, 8206, 8213, 8221, 8229, 8235, 8240, 8247, 8255, 8261, 8268, 8274,
+    8282, 8287, 8292, 8301, 8307, 8312, 8319, 8328, 8336, 8344, 8352, 8357,
+    8365, 8371, 8378, 8385, 8393, 8401, 8409, 8416, 8422, 8430, 8438, 8447,
+    8455, 8463, 8471, 8477, 8484, 8491, 8498, 8507, 8516, 8523, 8531, 8538,
+    8546, 8555, 8561, 8569, 8576, 8582, 8590, 8598, 8606, 8612, 8621, 8626,
+    8635, 8643, 8650, 8659, 8667, 8674, 8683, 8688, 8697, 8703, 8710, 8717,
+    8725, 8733, 8741, 8748, 8756, 8764, 8772, 8780, 8788, 8797, 8804, 8811,
+    8819, 8828, 8835, 8844, 8849, 8855, 8863, 8870, 8875, 8883, 8890, 8897,
+    8903, 8908, 8915, 8923, 8930, 8936, 8941, 8946, 8954, 8960, 8967, 8973,
+    8982, 8988, 8997, 9006, 9014, 9022, 9030, 9039, 9046, 9053, 9061, 9068,
+    9077, 9084, 9091, 9098, 9106, 9115, 9123, 9131, 9137, 9144, 9153, 9161,
+    9169, 9176, 9182, 9189, 9196, 9202, 9210, 9218, 9227, 9234, 9242, 9249,
+    9258, 9265, 9271, 9278, 9287, 9296, 9304, 9313, 9321, 9327, 9335, 9343,
+    9352, 9359, 9365, 9373, 9379, 9385, 9393, 9399, 9407, 9413, 9420, 9427,
+    9436, 9445, 9453, 9461, 9469, 9475, 9481, 9488, 9496, 9504, 9512, 9519,
+    9527, 9534, 9540, 9548, 9555, 9563, 9570, 9576, 9583, 9591, 9597, 9606,
+    9614, 9622, 9631, 9637, 9644, 9653, 9661, 9670, 9677, 9685, 9694, 9700,
+    9707, 9715, 9721, 9730, 9739, 9746, 9754, 9761, 9769, 9778, 9786, 9795,
+    9802, 9809, 9816, 9823, 9831, 9838, 9847, 9854, 9863, 9868, 9874, 9883,
+    9890, 9897, 9904, 9912, 9920, 9925, 9930, 9938, 9946, 9953, 9958, 9964,
+    9969, 9975, 9980, 9988, 9996, 10004, 10011, 10020, 10025, 10031, 10037,
+    10044, 10052, 10060, 10066, 10071, 10077, 10084, 10093, 10100, 10109,
+    10115, 10122, 10129, 10137, 10143, 10152, 10160, 10168, 10177, 10184,
+    10191, 10200, 10209, 10216, 10223, 10231, 10238, 10245, 10252, 10261,
+    10268, 10274, 10283, 10291, 10300, 10307, 10316, 10325, 10333, 10339,
+    10346, 10355, 10363, 10371, 10378, 10384, 10393, 10402, 10410, 10418,
+    10427, 10434, 10439, 10445, 10452, 10460, 10467, 10475, 10482, 10491,
+    10500, 10508, 10516, 10523, 10531, 10538, 10545, 10553, 10560, 10567,
+    10573, 10580, 10588, 10597, 10606, 10614, 10619, 10627, 10636, 10642,
+    10650, 10657, 10664, 10672, 10678, 10683, 10689, 10698, 10705, 10713,
+    10722, 10730, 10738, 10744, 10753, 10758, 10766, 10775, 10782, 10790,
+    10799, 10805, 10812, 10820, 10827, 10833, 10841, 10849, 10856, 10861,
+    10868, 10876, 10884, 10891, 10898, 10905, 10911, 10919, 10925, 10932,
+    10939, 10947, 10955, 10961, 10968, 10974, 10982, 10988, 10996, 11002,
+    11010, 11016, 11024, 11033, 11042, 11050, 11056, 11064, 11070, 11078,
+    11087, 11092, 11098, 11104, 11111, 11117, 11125, 11130, 11138, 11145,
+    11152, 11160, 11169, 11177, 11183, 11192, 11201, 11208, 11214, 11222,
+    11227, 11233, 11242, 11247, 11255, 11261, 11267, 11273, 11280, 11287,
+    11292, 11300, 11308, 11317, 11325, 11330, 11336, 11341, 11348, 11355,
+    11361, 11366, 11372, 11377, 11384, 11390, 11398, 11404, 11410, 11416,
+    11423, 11430, 11437, 11445, 11452, 11460, 11469, 11476, 11483, 11492,
+    11501, 11510, 11515, 11521, 11528, 11537, 11543, 11551, 11560, 11568,
+    11575, 11583, 11590, 11595, 11601, 11606, 11612, 11620, 11626, 11631,
+    11636, 11644, 11653, 11661, 11668, 11675, 11682, 11690, 11697, 11703,
+    11710, 11718, 11725, 11731, 11740, 11746, 11753, 11760, 11769, 11775,
+    11780, 11788, 11797, 11804, 11811, 11817, 11824, 11831, 11840, 11849,
+    11854, 11863, 11869, 11876, 11883, 11890, 11897, 11905, 11914, 11921,
+    11927, 11935, 11941, 11947, 11955, 11961, 11969, 11978, 11984, 11991,
+    12000, 12007, 12014, 12022, 12029, 12035, 12041, 12049, 12057, 12064,
+    12071, 12080, 12086, 12093, 12100, 12109, 12117, 12126, 12132, 12141,
+    12149, 12157, 12166, 12174, 12180, 12188, 12194, 12201, 12209, 12218,
+    12225, 12231, 12240, 12248, 12256, 12264, 12271, 12279, 12286, 12292,
+    12297, 12305, 12313, 12319, 12325, 12331, 12338, 12346, 12354, 12360,
+    12366, 12375, 12382, 12388, 12395, 12404, 12412, 12419, 12427, 12434,
+    12441, 12447, 12455, 12463, 12470, 12479, 12488, 12493, 12499, 12504,
+    12512, 12519, 12526, 12534, 12541, 12550, 12557, 12564, 12572, 12577,
+    12582, 12588, 12596, 12602, 12608, 12617, 12623, 12632, 12637, 12646,
+    12653, 12661, 12669, 12677, 12684, 12693, 12702, 12710, 12718, 12726,
+    12732, 12738, 12745, 12754, 12761, 12770, 12779, 12788, 12797, 12806,
+    12814, 12822, 12827, 12834, 12843, 12852, 12860, 12869, 12876, 12884,
+    12891, 12900, 12909, 12915, 12923, 12931, 12940, 12949, 12956, 12964,
+    12973, 12982, 12987, 12995, 13002, 13008, 13014, 13021, 13028, 13033,
+    13040, 13048, 13054, 13062, 13070, 13077, 13083, 13089, 13095, 13104,
+    13110, 13119, 13127, 13135, 13142, 13150, 13157, 13165, 13171, 13179,
+    13187, 13195, 13203, 13209, 13218, 13226, 13234, 13240, 13249, 13256,
+    13262, 13267, 13274, 13280, 13289, 13294, 13302, 13308, 13314, 13319,
+    13326, 13331, 13338, 13344, 13352, 13357, 13365, 13373, 13382, 13387,
+    13392, 13401, 13410, 13418, 13427, 13433, 13440, 13447, 13453, 13459,
+    13465, 13474, 13482, 13490, 13497, 13504, 13511, 13516, 13522, 13527,
+    13536, 13542, 13549, 13556, 13563, 13572, 13578, 13583, 13591, 13598,
+    13607, 13613, 13619, 13627, 13636, 13644, 13652, 13661, 13669, 13678,
+    13684, 13692, 13701, 13709, 13717, 13725, 13733, 13741, 13750, 13759,
+    13767, 13775, 13783, 13792, 13801, 13810, 13818, 13827, 13834, 13843,
+    13850, 13859, 13868, 13876, 13884, 13892, 13901, 13910, 13918, 13926,
+    13935, 13942, 13948, 13956, 13965, 13971, 13978, 13987, 13995, 14004,
+    14010, 14018, 14024, 14031, 14039, 14045, 14051, 14059, 14066, 14075,
+    14084, 14092, 14100, 14109, 14117, 14125, 14133, 14142, 14150, 14156,
+    14165, 14174, 14183, 14191, 14199, 14207, 14216, 14225, 14233, 14242,
+    14250, 14257, 14265, 14274, 14283, 14291, 14300, 14309, 14318, 14326,
+    14334, 14342, 14350, 14358, 14367, 14374, 14381, 14390, 14397, 14405,
+    14412, 14421, 14427, 14434, 14440, 14446, 14455, 14464, 14470, 14477,
+    14484, 14491, 14499, 14506, 14515, 14524, 14533, 14540, 14545, 14553,
+    14561, 14569, 14577, 14585, 14594, 14600, 14607, 14613, 14618, 14624,
+    14632, 14641, 14646, 14653, 14659, 14666, 14674, 14682, 14691, 14700,
+    14705, 14713, 14722, 14728, 14737, 14745, 14752, 14760, 14768, 14777,
+    14784, 14793, 14801, 14807, 14813, 14820, 14828, 14837, 14842, 14849,
+    14858, 14867, 14874, 14882, 14891, 14896, 14905, 14912, 14920, 14925,
+    14931, 14940
 };
 
-const dictionary ru =
+const dictionary cs{ cs_words, cs_offsets };
+
+static const char ru_words[] =
+    "абажур\0"
+    "абзац\0"
+    "абонент\0"
+    "абордаж\0"
+    "абрикос\0"
+    "абсолют\0"
+    "абсурд\0"
+    "авангард\0"
+    "август\0"
+    "авиация\0"
+    "авизо\0"
+    "аврал\0"
+    "автор\0"
+    "агат\0"
+    "агент\0"
+    "агрегат\0"
+    "адажио\0"
+    "адвокат\0"
+    "адепт\0"
+    "адмирал\0"
+    "адрес\0"
+    "ажиотаж\0"
+    "азарт\0"
+    "азбука\0"
+    "азимут\0"
+    "азот\0"
+    "айва\0"
+    "айсберг\0"
+    "академия\0"
+    "аквариум\0"
+    "акведук\0"
+    "аккорд\0"
+    "акробат\0"
+    "аксиома\0"
+    "актер\0"
+    "актриса\0"
+    "акула\0"
+    "акцент\0"
+    "акция\0"
+    "алгебра\0"
+    "алгоритм\0"
+    "алиби\0"
+    "аллея\0"
+    "алмаз\0"
+    "алоэ\0"
+    "алтарь\0"
+    "алфавит\0"
+    "алхимик\0"
+    "алый\0"
+    "альбом\0"
+    "алюминий\0"
+    "амбар\0"
+    "амбиция\0"
+    "аметист\0"
+    "амнезия\0"
+    "ампир\0"
+    "амулет\0"
+    "амфора\0"
+    "анализ\0"
+    "ангар\0"
+    "анекдот\0"
+    "анимация\0"
+    "анкета\0"
+    "аноним\0"
+    "ансамбль\0"
+    "антиквар\0"
+    "анфилада\0"
+    "анчоус\0"
+    "апатия\0"
+    "апельсин\0"
+    "апогей\0"
+    "апофеоз\0"
+    "апрель\0"
+    "аптека\0"
+    "арахис\0"
+    "арбуз\0"
+    "аргумент\0"
+    "аренда\0"
+    "ария\0"
+    "арка\0"
+    "арлекин\0"
+    "армада\0"
+    "аромат\0"
+    "арсенал\0"
+    "артист\0"
+    "арфа\0"
+    "архив\0"
+    "аршин\0"
+    "асбест\0"
+    "аскет\0"
+    "аспирант\0"
+    "астроном\0"
+    "асфальт\0"
+    "атака\0"
+    "ателье\0"
+    "атлас\0"
+    "атом\0"
+    "атрибут\0"
+    "аудитор\0"
+    "аукцион\0"
+    "аура\0"
+    "афиша\0"
+    "афоризм\0"
+    "ацетон\0"
+    "аэропорт\0"
+    "бабочка\0"
+    "багаж\0"
+    "бадья\0"
+    "байка\0"
+    "бакалея\0"
+    "баланс\0"
+    "балет\0"
+    "балкон\0"
+    "баллада\0"
+    "бамбук\0"
+    "бампер\0"
+    "банджо\0"
+    "банк\0"
+    "баобаб\0"
+    "барабан\0"
+    "бард\0"
+    "барс\0"
+    "бархат\0"
+    "барьер\0"
+    "басня\0"
+    "бассейн\0"
+    "бастион\0"
+    "батарея\0"
+    "батон\0"
+    "батут\0"
+    "баул\0"
+    "бахрома\0"
+    "башмак\0"
+    "баян\0"
+    "бегемот\0"
+    "бегония\0"
+    "бегство\0"
+    "бездна\0"
+    "бейсбол\0"
+    "бекон\0"
+    "белок\0"
+    "белый\0"
+    "белье\0"
+    "бензин\0"
+    "бергамот\0"
+    "берег\0"
+    "берлога\0"
+    "беседа\0"
+    "биатлон\0"
+    "бигуди\0"
+    "бидон\0"
+    "бизнес\0"
+    "бикини\0"
+    "бильярд\0"
+    "бинокль\0"
+    "бинт\0"
+    "биология\0"
+    "биржа\0"
+    "бисер\0"
+    "бицепс\0"
+    "благо\0"
+    "блеск\0"
+    "блеф\0"
+    "блин\0"
+    "блокнот\0"
+    "блондин\0"
+    "блюдо\0"
+    "бляха\0"
+    "бобер\0"
+    "бобина\0"
+    "богатырь\0"
+    "бодрый\0"
+    "боевик\0"
+    "боец\0"
+    "бойлер\0"
+    "бокал\0"
+    "болид\0"
+    "бордюр\0"
+    "борода\0"
+    "борщ\0"
+    "борьба\0"
+    "босой\0"
+    "ботва\0"
+    "ботинок\0"
+    "боцман\0"
+    "бочка\0"
+    "боярин\0"
+    "брак\0"
+    "брат\0"
+    "бревно\0"
+    "бригада\0"
+    "брикет\0"
+    "бровь\0"
+    "брод\0"
+    "брокер\0"
+    "бросок\0"
+    "брюки\0"
+    "брюнет\0"
+    "бубен\0"
+    "бублик\0"
+    "бугор\0"
+    "будка\0"
+    "будущее\0"
+    "бузина\0"
+    "буйвол\0"
+    "буква\0"
+    "букет\0"
+    "буксир\0"
+    "булат\0"
+    "бульвар\0"
+    "бумага\0"
+    "бумеранг\0"
+    "бунгало\0"
+    "бунт\0"
+    "бурьян\0"
+    "буря\0"
+    "бусы\0"
+    "бутон\0"
+    "бутылка\0"
+    "буфет\0"
+    "бухта\0"
+    "быстрота\0"
+    "бюджет\0"
+    "бюро\0"
+    "бюст\0"
+    "вагон\0"
+    "важный\0"
+    "вазелин\0"
+    "вакса\0"
+    "вакуум\0"
+    "вакцина\0"
+    "валенок\0"
+    "валюта\0"
+    "вандал\0"
+    "ваниль\0"
+    "ванна\0"
+    "варенье\0"
+    "вариант\0"
+    "варьете\0"
+    "ватага\0"
+    "ватман\0"
+    "ваучер\0"
+    "вафля\0"
+    "вахта\0"
+    "ведро\0"
+    "ведьма\0"
+    "везение\0"
+    "веко\0"
+    "вексель\0"
+    "велеть\0"
+    "величие\0"
+    "велодром\0"
+    "венец\0"
+    "вентиль\0"
+    "веранда\0"
+    "верблюд\0"
+    "веревка\0"
+    "версия\0"
+    "вершина\0"
+    "веселье\0"
+    "весло\0"
+    "весна\0"
+    "весть\0"
+    "ветвь\0"
+    "ветер\0"
+    "ветчина\0"
+    "веха\0"
+    "вещь\0"
+    "веяние\0"
+    "взбучка\0"
+    "взвод\0"
+    "взгляд\0"
+    "вздох\0"
+    "взмах\0"
+    "взнос\0"
+    "взор\0"
+    "взрыв\0"
+    "вибрация\0"
+    "видение\0"
+    "визг\0"
+    "визит\0"
+    "вилка\0"
+    "вирус\0"
+    "висеть\0"
+    "висок\0"
+    "витрина\0"
+    "вихрь\0"
+    "вкус\0"
+    "влага\0"
+    "владелец\0"
+    "власть\0"
+    "влияние\0"
+    "внимание\0"
+    "внук\0"
+    "вобла\0"
+    "вода\0"
+    "водород\0"
+    "вожак\0"
+    "возглас\0"
+    "воздух\0"
+    "возить\0"
+    "возраст\0"
+    "воин\0"
+    "вокзал\0"
+    "волк\0"
+    "волна\0"
+    "волокно\0"
+    "воля\0"
+    "вопрос\0"
+    "ворота\0"
+    "восторг\0"
+    "вотум\0"
+    "вояж\0"
+    "врач\0"
+    "время\0"
+    "всадник\0"
+    "всплеск\0"
+    "вспышка\0"
+    "встреча\0"
+    "вторник\0"
+    "втулка\0"
+    "вулкан\0"
+    "вход\0"
+    "выбор\0"
+    "вывод\0"
+    "выгиб\0"
+    "выдра\0"
+    "выемка\0"
+    "вызов\0"
+    "выигрыш\0"
+    "выкуп\0"
+    "вымысел\0"
+    "выпечка\0"
+    "выпуск\0"
+    "вырез\0"
+    "выскочка\0"
+    "высота\0"
+    "выставка\0"
+    "вытяжка\0"
+    "вычет\0"
+    "вышка\0"
+    "вьюга\0"
+    "вязанка\0"
+    "вялый\0"
+    "гавань\0"
+    "гадать\0"
+    "газета\0"
+    "газон\0"
+    "галерея\0"
+    "галоп\0"
+    "галстук\0"
+    "галун\0"
+    "гамак\0"
+    "гамбит\0"
+    "гандбол\0"
+    "гантель\0"
+    "гараж\0"
+    "гардина\0"
+    "гарем\0"
+    "гармония\0"
+    "гарнир\0"
+    "гарпун\0"
+    "гвардия\0"
+    "гвоздь\0"
+    "гегемон\0"
+    "гейзер\0"
+    "гектар\0"
+    "генерал\0"
+    "гений\0"
+    "геолог\0"
+    "гепард\0"
+    "гербарий\0"
+    "герой\0"
+    "герцог\0"
+    "гжель\0"
+    "гигант\0"
+    "гильза\0"
+    "гимн\0"
+    "гипноз\0"
+    "гипотеза\0"
+    "гиря\0"
+    "гитара\0"
+    "глава\0"
+    "глагол\0"
+    "глаз\0"
+    "глина\0"
+    "глобус\0"
+    "глубина\0"
+    "глухой\0"
+    "глыба\0"
+    "глюкоза\0"
+    "глянец\0"
+    "гнев\0"
+    "гнездо\0"
+    "гном\0"
+    "гобелен\0"
+    "голова\0"
+    "голый\0"
+    "гомон\0"
+    "гондола\0"
+    "гонка\0"
+    "гора\0"
+    "горло\0"
+    "город\0"
+    "горшок\0"
+    "госпожа\0"
+    "гость\0"
+    "градус\0"
+    "грамота\0"
+    "грань\0"
+    "графа\0"
+    "гребень\0"
+    "грек\0"
+    "гречиха\0"
+    "гриб\0"
+    "гривна\0"
+    "гром\0"
+    "грохот\0"
+    "грубый\0"
+    "грудь\0"
+    "груз\0"
+    "группа\0"
+    "груша\0"
+    "грязь\0"
+    "губа\0"
+    "гудеть\0"
+    "гулять\0"
+    "гурман\0"
+    "гусли\0"
+    "густой\0"
+    "гусь\0"
+    "гуща\0"
+    "давать\0"
+    "давление\0"
+    "давний\0"
+    "дамба\0"
+    "данные\0"
+    "дарить\0"
+    "дата\0"
+    "датчик\0"
+    "дверь\0"
+    "движение\0"
+    "двойня\0"
+    "дворец\0"
+    "дебют\0"
+    "девочка\0"
+    "девушка\0"
+    "действие\0"
+    "декабрь\0"
+    "декорум\0"
+    "делить\0"
+    "дело\0"
+    "дельфин\0"
+    "демагог\0"
+    "демократ\0"
+    "день\0"
+    "депеша\0"
+    "депутат\0"
+    "дерево\0"
+    "держава\0"
+    "десерт\0"
+    "десяток\0"
+    "деталь\0"
+    "детство\0"
+    "дефицит\0"
+    "деятель\0"
+    "джаз\0"
+    "джигит\0"
+    "джинсы\0"
+    "джунгли\0"
+    "диагноз\0"
+    "диалог\0"
+    "диапазон\0"
+    "диафильм\0"
+    "диван\0"
+    "дивизия\0"
+    "диета\0"
+    "дизайн\0"
+    "дизель\0"
+    "дикий\0"
+    "дикобраз\0"
+    "диктант\0"
+    "дилижанс\0"
+    "динамика\0"
+    "диплом\0"
+    "директор\0"
+    "диск\0"
+    "дисплей\0"
+    "дитя\0"
+    "дифирамб\0"
+    "дичь\0"
+    "дневник\0"
+    "добавка\0"
+    "добро\0"
+    "добыча\0"
+    "доверие\0"
+    "догмат\0"
+    "договор\0"
+    "дождь\0"
+    "доклад\0"
+    "доктор\0"
+    "документ\0"
+    "долг\0"
+    "доллар\0"
+    "домысел\0"
+    "дорога\0"
+    "досада\0"
+    "доска\0"
+    "досье\0"
+    "дотация\0"
+    "доход\0"
+    "доцент\0"
+    "доярка\0"
+    "драгун\0"
+    "драка\0"
+    "дремота\0"
+    "дрова\0"
+    "дрожь\0"
+    "друг\0"
+    "дружба\0"
+    "дубликат\0"
+    "дукат\0"
+    "дума\0"
+    "дупло\0"
+    "духовка\0"
+    "душа\0"
+    "дуэт\0"
+    "дыня\0"
+    "дыра\0"
+    "дыхание\0"
+    "дышать\0"
+    "дюжина\0"
+    "дюйм\0"
+    "дюна\0"
+    "дядя\0"
+    "дятел\0"
+    "европа\0"
+    "егерь\0"
+    "егоза\0"
+    "единица\0"
+    "едкий\0"
+    "ежевика\0"
+    "езда\0"
+    "ельник\0"
+    "емкость\0"
+    "енот\0"
+    "ералаш\0"
+    "ермолка\0"
+    "ерунда\0"
+    "есаул\0"
+    "ехать\0"
+    "жабо\0"
+    "жажда\0"
+    "жалкий\0"
+    "жалоба\0"
+    "жалюзи\0"
+    "жандарм\0"
+    "жанр\0"
+    "жара\0"
+    "жаргон\0"
+    "жаровня\0"
+    "жатва\0"
+    "жбан\0"
+    "жгут\0"
+    "желание\0"
+    "железо\0"
+    "желтый\0"
+    "жемчуг\0"
+    "жених\0"
+    "женщина\0"
+    "жердь\0"
+    "жеребец\0"
+    "жерло\0"
+    "жест\0"
+    "живот\0"
+    "жизнь\0"
+    "жилет\0"
+    "жилье\0"
+    "жираф\0"
+    "житель\0"
+    "жнец\0"
+    "жокей\0"
+    "жребий\0"
+    "журнал\0"
+    "жюри\0"
+    "забава\0"
+    "забег\0"
+    "забияка\0"
+    "забрало\0"
+    "забыть\0"
+    "завал\0"
+    "завеса\0"
+    "завод\0"
+    "завтрак\0"
+    "завязь\0"
+    "загадка\0"
+    "заговор\0"
+    "задача\0"
+    "задел\0"
+    "задира\0"
+    "задний\0"
+    "задор\0"
+    "задумка\0"
+    "зажим\0"
+    "зазывала\0"
+    "закат\0"
+    "заклад\0"
+    "закон\0"
+    "залежь\0"
+    "залив\0"
+    "заметка\0"
+    "замок\0"
+    "замысел\0"
+    "занос\0"
+    "занятие\0"
+    "запад\0"
+    "запись\0"
+    "заплыв\0"
+    "заповедь\0"
+    "запятая\0"
+    "зарок\0"
+    "зарубка\0"
+    "заря\0"
+    "засада\0"
+    "заслуга\0"
+    "заставка\0"
+    "затея\0"
+    "затор\0"
+    "затрата\0"
+    "затылок\0"
+    "захват\0"
+    "зацепка\0"
+    "зачаток\0"
+    "зачет\0"
+    "защита\0"
+    "заявка\0"
+    "заяц\0"
+    "звезда\0"
+    "звонок\0"
+    "звук\0"
+    "здоровье\0"
+    "зебра\0"
+    "зевака\0"
+    "зелень\0"
+    "земля\0"
+    "зенит\0"
+    "зеркало\0"
+    "зерно\0"
+    "зефир\0"
+    "зигзаг\0"
+    "зима\0"
+    "злоба\0"
+    "змея\0"
+    "знак\0"
+    "знамя\0"
+    "знание\0"
+    "значение\0"
+    "зной\0"
+    "зодчий\0"
+    "зола\0"
+    "золото\0"
+    "зоопарк\0"
+    "зоркий\0"
+    "зрачок\0"
+    "зрелище\0"
+    "зрение\0"
+    "зритель\0"
+    "зубило\0"
+    "зыбкий\0"
+    "зять\0"
+    "иволга\0"
+    "игла\0"
+    "игра\0"
+    "идеал\0"
+    "идея\0"
+    "идиллия\0"
+    "идиома\0"
+    "идол\0"
+    "идти\0"
+    "иерархия\0"
+    "иероглиф\0"
+    "изба\0"
+    "известие\0"
+    "изгиб\0"
+    "издание\0"
+    "изделие\0"
+    "изотоп\0"
+    "изыск\0"
+    "изюм\0"
+    "иллюзия\0"
+    "имбирь\0"
+    "имение\0"
+    "имидж\0"
+    "империя\0"
+    "импульс\0"
+    "инвестор\0"
+    "индекс\0"
+    "индивид\0"
+    "инерция\0"
+    "инженер\0"
+    "инжир\0"
+    "институт\0"
+    "интерес\0"
+    "интрига\0"
+    "ипподром\0"
+    "ирис\0"
+    "ирония\0"
+    "искать\0"
+    "искра\0"
+    "испуг\0"
+    "истина\0"
+    "история\0"
+    "истукан\0"
+    "исход\0"
+    "итог\0"
+    "кабаре\0"
+    "кабель\0"
+    "кабина\0"
+    "каблук\0"
+    "кавалер\0"
+    "кадка\0"
+    "кадр\0"
+    "кадык\0"
+    "казак\0"
+    "казино\0"
+    "казус\0"
+    "кайма\0"
+    "кайф\0"
+    "какао\0"
+    "кактус\0"
+    "каламбур\0"
+    "калитка\0"
+    "калория\0"
+    "кальций\0"
+    "камбала\0"
+    "камень\0"
+    "камин\0"
+    "камыш\0"
+    "канал\0"
+    "кандидат\0"
+    "канкан\0"
+    "каноэ\0"
+    "каньон\0"
+    "капитал\0"
+    "капля\0"
+    "капот\0"
+    "каприз\0"
+    "капсула\0"
+    "капуста\0"
+    "капюшон\0"
+    "карабин\0"
+    "карета\0"
+    "каркас\0"
+    "карман\0"
+    "карп\0"
+    "картон\0"
+    "карьера\0"
+    "каскад\0"
+    "касторка\0"
+    "каталог\0"
+    "катер\0"
+    "катод\0"
+    "каучук\0"
+    "кафель\0"
+    "качать\0"
+    "качество\0"
+    "каша\0"
+    "кашпо\0"
+    "каштан\0"
+    "каюта\0"
+    "квадрат\0"
+    "квант\0"
+    "кварц\0"
+    "квинтет\0"
+    "квиток\0"
+    "кворум\0"
+    "квота\0"
+    "кегли\0"
+    "кекс\0"
+    "кемпинг\0"
+    "кенгуру\0"
+    "кепка\0"
+    "керосин\0"
+    "кетчуп\0"
+    "кибитка\0"
+    "кивок\0"
+    "километр\0"
+    "килька\0"
+    "кимоно\0"
+    "кинжал\0"
+    "кино\0"
+    "киоск\0"
+    "кипеть\0"
+    "кипяток\0"
+    "кирка\0"
+    "кирпич\0"
+    "кисель\0"
+    "кислота\0"
+    "кисть\0"
+    "клапан\0"
+    "кларнет\0"
+    "клевер\0"
+    "клерк\0"
+    "клетка\0"
+    "клиент\0"
+    "климат\0"
+    "клинок\0"
+    "кличка\0"
+    "клише\0"
+    "клоун\0"
+    "клуб\0"
+    "клумба\0"
+    "клык\0"
+    "клюква\0"
+    "ключ\0"
+    "клюшка\0"
+    "клякса\0"
+    "клятва\0"
+    "кляча\0"
+    "книга\0"
+    "кнопка\0"
+    "кнут\0"
+    "князь\0"
+    "ковбой\0"
+    "ковер\0"
+    "ковыль\0"
+    "когорта\0"
+    "кодекс\0"
+    "кожа\0"
+    "кожура\0"
+    "козел\0"
+    "козырь\0"
+    "койка\0"
+    "койот\0"
+    "кокос\0"
+    "коктейль\0"
+    "колбаса\0"
+    "колдун\0"
+    "колесо\0"
+    "коллаж\0"
+    "колодец\0"
+    "колпак\0"
+    "колхоз\0"
+    "кольцо\0"
+    "комар\0"
+    "комбайн\0"
+    "комедия\0"
+    "комитет\0"
+    "комната\0"
+    "компания\0"
+    "конверт\0"
+    "конгресс\0"
+    "кондитер\0"
+    "конец\0"
+    "конкурс\0"
+    "конспект\0"
+    "контакт\0"
+    "конус\0"
+    "конфуз\0"
+    "концерт\0"
+    "конь\0"
+    "копейка\0"
+    "копия\0"
+    "копна\0"
+    "копоть\0"
+    "копыто\0"
+    "копье\0"
+    "корабль\0"
+    "корень\0"
+    "корзина\0"
+    "коридор\0"
+    "кормить\0"
+    "корнет\0"
+    "король\0"
+    "корпус\0"
+    "коррида\0"
+    "корсет\0"
+    "космос\0"
+    "костюм\0"
+    "котел\0"
+    "котлета\0"
+    "коттедж\0"
+    "кофе\0"
+    "кофта\0"
+    "кочан\0"
+    "кошка\0"
+    "край\0"
+    "краска\0"
+    "кредит\0"
+    "крекер\0"
+    "кремль\0"
+    "кресло\0"
+    "кривой\0"
+    "кризис\0"
+    "крик\0"
+    "критика\0"
+    "кровать\0"
+    "кролик\0"
+    "крыло\0"
+    "крыша\0"
+    "крючок\0"
+    "кубок\0"
+    "кувшин\0"
+    "кузен\0"
+    "кузнец\0"
+    "кузов\0"
+    "кукла\0"
+    "кулак\0"
+    "кулон\0"
+    "культура\0"
+    "кумир\0"
+    "купец\0"
+    "купол\0"
+    "курица\0"
+    "курорт\0"
+    "курс\0"
+    "куртка\0"
+    "кусок\0"
+    "куст\0"
+    "кухня\0"
+    "куча\0"
+    "кювет\0"
+    "лабиринт\0"
+    "лаваш\0"
+    "лавина\0"
+    "лавка\0"
+    "лагерь\0"
+    "лагуна\0"
+    "ладонь\0"
+    "лазер\0"
+    "лайнер\0"
+    "лакей\0"
+    "лампа\0"
+    "ландшафт\0"
+    "лапоть\0"
+    "лапша\0"
+    "ларек\0"
+    "латунь\0"
+    "лауреат\0"
+    "лацкан\0"
+    "лачуга\0"
+    "лаять\0"
+    "лебедь\0"
+    "легенда\0"
+    "лежак\0"
+    "лезть\0"
+    "лекция\0"
+    "лента\0"
+    "лепесток\0"
+    "леска\0"
+    "лестница\0"
+    "лететь\0"
+    "лето\0"
+    "летчик\0"
+    "лечение\0"
+    "леший\0"
+    "лиана\0"
+    "либерал\0"
+    "ливень\0"
+    "ливрея\0"
+    "лига\0"
+    "лидер\0"
+    "лимит\0"
+    "лимон\0"
+    "линия\0"
+    "лирика\0"
+    "литр\0"
+    "лифт\0"
+    "лихой\0"
+    "лицей\0"
+    "лицо\0"
+    "ловить\0"
+    "логика\0"
+    "лодка\0"
+    "лозунг\0"
+    "локоть\0"
+    "ломать\0"
+    "лоно\0"
+    "лопата\0"
+    "лорд\0"
+    "лось\0"
+    "лошадь\0"
+    "луна\0"
+    "лучший\0"
+    "лыжа\0"
+    "льгота\0"
+    "льдина\0"
+    "любовь\0"
+    "люстра\0"
+    "лютня\0"
+    "лягушка\0"
+    "лямка\0"
+    "магазин\0"
+    "магия\0"
+    "магма\0"
+    "мадам\0"
+    "майор\0"
+    "маклер\0"
+    "максимум\0"
+    "малыш\0"
+    "мальчик\0"
+    "маляр\0"
+    "мангал\0"
+    "мандат\0"
+    "манеж\0"
+    "мантия\0"
+    "марафон\0"
+    "март\0"
+    "маршал\0"
+    "маскарад\0"
+    "масло\0"
+    "мастер\0"
+    "масштаб\0"
+    "матадор\0"
+    "материя\0"
+    "матрос\0"
+    "матч\0"
+    "мафия\0"
+    "махать\0"
+    "машина\0"
+    "маэстро\0"
+    "маяк\0"
+    "мебель\0"
+    "медаль\0"
+    "медведь\0"
+    "мелкий\0"
+    "мелодия\0"
+    "менять\0"
+    "мера\0"
+    "место\0"
+    "месяц\0"
+    "металл\0"
+    "метеор\0"
+    "метла\0"
+    "метод\0"
+    "метр\0"
+    "механизм\0"
+    "мечта\0"
+    "мешок\0"
+    "мизинец\0"
+    "микрофон\0"
+    "миксер\0"
+    "милиция\0"
+    "миллион\0"
+    "милость\0"
+    "милый\0"
+    "мимоза\0"
+    "министр\0"
+    "минута\0"
+    "митинг\0"
+    "мишень\0"
+    "мнение\0"
+    "модель\0"
+    "модуль\0"
+    "мозг\0"
+    "молва\0"
+    "молния\0"
+    "молоко\0"
+    "молчать\0"
+    "момент\0"
+    "монах\0"
+    "монета\0"
+    "монитор\0"
+    "монолог\0"
+    "мораль\0"
+    "море\0"
+    "морковь\0"
+    "мороз\0"
+    "моряк\0"
+    "мост\0"
+    "мотив\0"
+    "мотор\0"
+    "мудрый\0"
+    "мужчина\0"
+    "музей\0"
+    "музыка\0"
+    "мундир\0"
+    "муравей\0"
+    "мусор\0"
+    "мустанг\0"
+    "муфта\0"
+    "муха\0"
+    "мушкетер\0"
+    "мыло\0"
+    "мысль\0"
+    "мышь\0"
+    "мэтр\0"
+    "мюзикл\0"
+    "мягкий\0"
+    "мякиш\0"
+    "мясо\0"
+    "мятый\0"
+    "набат\0"
+    "навар\0"
+    "навык\0"
+    "наган\0"
+    "награда\0"
+    "надежда\0"
+    "надпись\0"
+    "название\0"
+    "наитие\0"
+    "наличие\0"
+    "налог\0"
+    "намек\0"
+    "напиток\0"
+    "напор\0"
+    "народ\0"
+    "наряд\0"
+    "натура\0"
+    "наука\0"
+    "нация\0"
+    "начало\0"
+    "наяда\0"
+    "небо\0"
+    "невеста\0"
+    "неделя\0"
+    "нейлон\0"
+    "нейрон\0"
+    "немой\0"
+    "неон\0"
+    "нерв\0"
+    "нести\0"
+    "нефть\0"
+    "нива\0"
+    "низкий\0"
+    "никель\0"
+    "нирвана\0"
+    "нитка\0"
+    "нить\0"
+    "ничья\0"
+    "ниша\0"
+    "новация\0"
+    "новелла\0"
+    "новость\0"
+    "нога\0"
+    "ноготь\0"
+    "ноздря\0"
+    "номер\0"
+    "норма\0"
+    "носок\0"
+    "нота\0"
+    "ночлег\0"
+    "ночь\0"
+    "ноябрь\0"
+    "нрав\0"
+    "нужда\0"
+    "нужный\0"
+    "нюанс\0"
+    "няня\0"
+    "оазис\0"
+    "обаяние\0"
+    "обвод\0"
+    "обед\0"
+    "обелиск\0"
+    "обещать\0"
+    "обзор\0"
+    "обида\0"
+    "облако\0"
+    "облик\0"
+    "обломок\0"
+    "обман\0"
+    "обморок\0"
+    "оборот\0"
+    "обочина\0"
+    "образ\0"
+    "обруч\0"
+    "обрыв\0"
+    "обувь\0"
+    "обучение\0"
+    "обхват\0"
+    "общение\0"
+    "объект\0"
+    "объятие\0"
+    "обычай\0"
+    "овес\0"
+    "овощ\0"
+    "овраг\0"
+    "овца\0"
+    "овчарка\0"
+    "огонь\0"
+    "ограда\0"
+    "огурец\0"
+    "одежда\0"
+    "одеяло\0"
+    "ожидание\0"
+    "ожог\0"
+    "озеро\0"
+    "океан\0"
+    "окно\0"
+    "окоп\0"
+    "окорок\0"
+    "окраина\0"
+    "округ\0"
+    "октава\0"
+    "октябрь\0"
+    "олень\0"
+    "олимп\0"
+    "опека\0"
+    "операция\0"
+    "описание\0"
+    "оплата\0"
+    "опора\0"
+    "оппонент\0"
+    "оправа\0"
+    "оптика\0"
+    "опыт\0"
+    "орбита\0"
+    "орган\0"
+    "орден\0"
+    "орел\0"
+    "оригинал\0"
+    "ориентир\0"
+    "оркестр\0"
+    "орнамент\0"
+    "оружие\0"
+    "осадок\0"
+    "осень\0"
+    "осина\0"
+    "осколок\0"
+    "осмотр\0"
+    "основа\0"
+    "особняк\0"
+    "осока\0"
+    "остаток\0"
+    "остров\0"
+    "отбор\0"
+    "ответ\0"
+    "отдача\0"
+    "отдел\0"
+    "отдых\0"
+    "отель\0"
+    "отец\0"
+    "отзыв\0"
+    "отказ\0"
+    "открытие\0"
+    "откуп\0"
+    "отличие\0"
+    "отпуск\0"
+    "отрасль\0"
+    "отряд\0"
+    "отсев\0"
+    "оттенок\0"
+    "отчет\0"
+    "отшиб\0"
+    "отъезд\0"
+    "офис\0"
+    "офицер\0"
+    "охапка\0"
+    "охота\0"
+    "охрана\0"
+    "оценка\0"
+    "очаг\0"
+    "очерк\0"
+    "очки\0"
+    "ошейник\0"
+    "ошибка\0"
+    "павильон\0"
+    "павлин\0"
+    "падение\0"
+    "паек\0"
+    "пакля\0"
+    "пакт\0"
+    "палата\0"
+    "палец\0"
+    "палуба\0"
+    "пальто\0"
+    "памфлет\0"
+    "память\0"
+    "панель\0"
+    "паника\0"
+    "парафин\0"
+    "парень\0"
+    "парк\0"
+    "пароход\0"
+    "партия\0"
+    "парус\0"
+    "пасека\0"
+    "паспорт\0"
+    "пастух\0"
+    "патрон\0"
+    "пауза\0"
+    "пафос\0"
+    "пахарь\0"
+    "пацан\0"
+    "пациент\0"
+    "певец\0"
+    "педагог\0"
+    "пейзаж\0"
+    "пельмень\0"
+    "пена\0"
+    "пенсия\0"
+    "пепел\0"
+    "перец\0"
+    "период\0"
+    "перо\0"
+    "персонаж\0"
+    "песня\0"
+    "песок\0"
+    "петля\0"
+    "петух\0"
+    "петь\0"
+    "пехота\0"
+    "печать\0"
+    "печень\0"
+    "пешеход\0"
+    "пешка\0"
+    "пещера\0"
+    "пианист\0"
+    "пиво\0"
+    "пиджак\0"
+    "пила\0"
+    "пилот\0"
+    "пионер\0"
+    "писатель\0"
+    "письмо\0"
+    "питание\0"
+    "пицца\0"
+    "пища\0"
+    "плагиат\0"
+    "плакат\0"
+    "план\0"
+    "платье\0"
+    "плац\0"
+    "пленка\0"
+    "плечо\0"
+    "плита\0"
+    "плод\0"
+    "площадь\0"
+    "плыть\0"
+    "плюс\0"
+    "пляж\0"
+    "победа\0"
+    "повар\0"
+    "повесть\0"
+    "повод\0"
+    "повтор\0"
+    "повязка\0"
+    "погода\0"
+    "подарок\0"
+    "подвиг\0"
+    "поднос\0"
+    "подпись\0"
+    "подруга\0"
+    "подушка\0"
+    "подход\0"
+    "подъем\0"
+    "поезд\0"
+    "позиция\0"
+    "поиск\0"
+    "покер\0"
+    "поклажа\0"
+    "покой\0"
+    "покупка\0"
+    "полдень\0"
+    "поле\0"
+    "политик\0"
+    "полный\0"
+    "полоса\0"
+    "получка\0"
+    "полынь\0"
+    "польза\0"
+    "поляна\0"
+    "пометка\0"
+    "помощь\0"
+    "помпон\0"
+    "пони\0"
+    "понятие\0"
+    "попытка\0"
+    "порог\0"
+    "портрет\0"
+    "порция\0"
+    "порыв\0"
+    "порядок\0"
+    "посадка\0"
+    "поселок\0"
+    "посох\0"
+    "постель\0"
+    "посуда\0"
+    "потеря\0"
+    "поток\0"
+    "походка\0"
+    "поцелуй\0"
+    "почва\0"
+    "поэзия\0"
+    "поэт\0"
+    "пояс\0"
+    "правда\0"
+    "праздник\0"
+    "практик\0"
+    "преграда\0"
+    "предел\0"
+    "презент\0"
+    "премия\0"
+    "препарат\0"
+    "прибор\0"
+    "привет\0"
+    "прием\0"
+    "призыв\0"
+    "приказ\0"
+    "приличие\0"
+    "пример\0"
+    "принц\0"
+    "природа\0"
+    "приступ\0"
+    "прицел\0"
+    "причина\0"
+    "приятель\0"
+    "пробка\0"
+    "провал\0"
+    "прогноз\0"
+    "продукт\0"
+    "проект\0"
+    "проза\0"
+    "прокурор\0"
+    "пропуск\0"
+    "простор\0"
+    "протеже\0"
+    "процент\0"
+    "прочерк\0"
+    "прошлое\0"
+    "пруд\0"
+    "прыжок\0"
+    "прялка\0"
+    "прямота\0"
+    "психика\0"
+    "птица\0"
+    "публика\0"
+    "пугать\0"
+    "пудра\0"
+    "пузырь\0"
+    "пульт\0"
+    "пуля\0"
+    "пункт\0"
+    "пунш\0"
+    "пурга\0"
+    "пустяк\0"
+    "путь\0"
+    "пухлый\0"
+    "пчела\0"
+    "пшеница\0"
+    "пыль\0"
+    "пышный\0"
+    "пьеса\0"
+    "пятно\0"
+    "работа\0"
+    "радар\0"
+    "раджа\0"
+    "радио\0"
+    "радость\0"
+    "радуга\0"
+    "развитие\0"
+    "разговор\0"
+    "раздел\0"
+    "разлив\0"
+    "размер\0"
+    "разница\0"
+    "разряд\0"
+    "разум\0"
+    "район\0"
+    "ракета\0"
+    "ракушка\0"
+    "рама\0"
+    "рандеву\0"
+    "рантье\0"
+    "ранчо\0"
+    "рапира\0"
+    "рапорт\0"
+    "раритет\0"
+    "раскат\0"
+    "расписка\0"
+    "рассвет\0"
+    "раствор\0"
+    "расход\0"
+    "расчет\0"
+    "ратуша\0"
+    "раунд\0"
+    "рация\0"
+    "реакция\0"
+    "реализм\0"
+    "ребенок\0"
+    "ребро\0"
+    "ребус\0"
+    "ревизор\0"
+    "регион\0"
+    "редис\0"
+    "реестр\0"
+    "режим\0"
+    "резак\0"
+    "рейтинг\0"
+    "река\0"
+    "реклама\0"
+    "ректор\0"
+    "рельс\0"
+    "ремарка\0"
+    "ремень\0"
+    "ремонт\0"
+    "реноме\0"
+    "рента\0"
+    "реплика\0"
+    "ресница\0"
+    "ресторан\0"
+    "ресурс\0"
+    "реформа\0"
+    "рецепт\0"
+    "речь\0"
+    "решение\0"
+    "ржавчина\0"
+    "рикша\0"
+    "риск\0"
+    "рисунок\0"
+    "ритм\0"
+    "рифма\0"
+    "робкий\0"
+    "родео\0"
+    "родина\0"
+    "рождение\0"
+    "роман\0"
+    "рост\0"
+    "росчерк\0"
+    "рота\0"
+    "рояль\0"
+    "рубашка\0"
+    "рубеж\0"
+    "рубль\0"
+    "рубрика\0"
+    "ругать\0"
+    "рудник\0"
+    "ружье\0"
+    "руины\0"
+    "рука\0"
+    "рулет\0"
+    "рупор\0"
+    "ручей\0"
+    "рыба\0"
+    "рыжий\0"
+    "рынок\0"
+    "рысь\0"
+    "рыцарь\0"
+    "рычаг\0"
+    "рюкзак\0"
+    "рюмка\0"
+    "рябина\0"
+    "сабля\0"
+    "сазан\0"
+    "сайгак\0"
+    "саксаул\0"
+    "сальто\0"
+    "самолет\0"
+    "самурай\0"
+    "сандвич\0"
+    "сани\0"
+    "сапог\0"
+    "сапфир\0"
+    "сарай\0"
+    "сарказм\0"
+    "сатира\0"
+    "сауна\0"
+    "сахар\0"
+    "сбруя\0"
+    "сбыт\0"
+    "свадьба\0"
+    "свежий\0"
+    "сверло\0"
+    "свеча\0"
+    "свидание\0"
+    "свист\0"
+    "свобода\0"
+    "свойство\0"
+    "связь\0"
+    "сделка\0"
+    "сеанс\0"
+    "сегмент\0"
+    "седина\0"
+    "седло\0"
+    "сезон\0"
+    "сейф\0"
+    "секрет\0"
+    "секунда\0"
+    "селение\0"
+    "семафор\0"
+    "семинар\0"
+    "семья\0"
+    "сено\0"
+    "сентябрь\0"
+    "сервис\0"
+    "сердце\0"
+    "середина\0"
+    "сержант\0"
+    "серия\0"
+    "серьга\0"
+    "сестра\0"
+    "сеть\0"
+    "сигара\0"
+    "сигнал\0"
+    "сиденье\0"
+    "сила\0"
+    "символ\0"
+    "симптом\0"
+    "синева\0"
+    "сирень\0"
+    "сирота\0"
+    "система\0"
+    "ситец\0"
+    "ситуация\0"
+    "сиять\0"
+    "сказка\0"
+    "скакун\0"
+    "скала\0"
+    "скамья\0"
+    "скачок\0"
+    "скважина\0"
+    "сквер\0"
+    "скворец\0"
+    "скелет\0"
+    "скидка\0"
+    "склад\0"
+    "скрепа\0"
+    "скрипка\0"
+    "скука\0"
+    "слабый\0"
+    "слава\0"
+    "след\0"
+    "слеза\0"
+    "слияние\0"
+    "слово\0"
+    "слон\0"
+    "служба\0"
+    "слух\0"
+    "случай\0"
+    "смена\0"
+    "смесь\0"
+    "смех\0"
+    "смола\0"
+    "смысл\0"
+    "смычок\0"
+    "смятение\0"
+    "снег\0"
+    "снимок\0"
+    "собака\0"
+    "собрание\0"
+    "событие\0"
+    "совет\0"
+    "сокол\0"
+    "солдат\0"
+    "солнце\0"
+    "соловей\0"
+    "соль\0"
+    "соната\0"
+    "соперник\0"
+    "сопка\0"
+    "сорт\0"
+    "сосед\0"
+    "сосна\0"
+    "состав\0"
+    "сосуд\0"
+    "соус\0"
+    "социолог\0"
+    "союз\0"
+    "спальня\0"
+    "спать\0"
+    "спина\0"
+    "список\0"
+    "спичка\0"
+    "спор\0"
+    "способ\0"
+    "справка\0"
+    "спутник\0"
+    "среда\0"
+    "ставка\0"
+    "стадо\0"
+    "стакан\0"
+    "сталкер\0"
+    "станция\0"
+    "старик\0"
+    "статус\0"
+    "стая\0"
+    "ствол\0"
+    "стекло\0"
+    "стена\0"
+    "степь\0"
+    "стиль\0"
+    "стихи\0"
+    "стойка\0"
+    "столица\0"
+    "стон\0"
+    "сторона\0"
+    "стоянка\0"
+    "страна\0"
+    "стрела\0"
+    "строка\0"
+    "струя\0"
+    "студия\0"
+    "стук\0"
+    "ступень\0"
+    "стыд\0"
+    "стюард\0"
+    "стяжка\0"
+    "суббота\0"
+    "субъект\0"
+    "сувенир\0"
+    "сугроб\0"
+    "судно\0"
+    "судья\0"
+    "суета\0"
+    "сумка\0"
+    "супруг\0"
+    "суть\0"
+    "сухой\0"
+    "суша\0"
+    "сфера\0"
+    "схема\0"
+    "счастье\0"
+    "счет\0"
+    "съезд\0"
+    "съемка\0"
+    "сырой\0"
+    "сырье\0"
+    "сытый\0"
+    "сыщик\0"
+    "сюжет\0"
+    "сюрприз\0"
+    "сюртук\0"
+    "табак\0"
+    "табель\0"
+    "таблица\0"
+    "табун\0"
+    "тайна\0"
+    "тайфун\0"
+    "такси\0"
+    "талант\0"
+    "талон\0"
+    "таможня\0"
+    "танец\0"
+    "танк\0"
+    "танцор\0"
+    "тарелка\0"
+    "тариф\0"
+    "творог\0"
+    "театр\0"
+    "тезис\0"
+    "текст\0"
+    "телега\0"
+    "темнота\0"
+    "темп\0"
+    "тень\0"
+    "теория\0"
+    "тепло\0"
+    "терапия\0"
+    "термин\0"
+    "терять\0"
+    "тесный\0"
+    "тетрадь\0"
+    "тетя\0"
+    "техника\0"
+    "течение\0"
+    "тигр\0"
+    "тираж\0"
+    "титул\0"
+    "тишина\0"
+    "ткань\0"
+    "товар\0"
+    "токарь\0"
+    "толк\0"
+    "толпа\0"
+    "толчок\0"
+    "тонкий\0"
+    "тонна\0"
+    "топливо\0"
+    "топор\0"
+    "торговля\0"
+    "тостер\0"
+    "точка\0"
+    "тощий\0"
+    "трава\0"
+    "традиция\0"
+    "трактор\0"
+    "трамвай\0"
+    "траншея\0"
+    "тревога\0"
+    "треск\0"
+    "трещина\0"
+    "трибуна\0"
+    "тройка\0"
+    "тропа\0"
+    "тротуар\0"
+    "труба\0"
+    "труд\0"
+    "трюк\0"
+    "тряпка\0"
+    "трясти\0"
+    "туман\0"
+    "тундра\0"
+    "тупик\0"
+    "турист\0"
+    "турнир\0"
+    "туфля\0"
+    "туча\0"
+    "тюльпан\0"
+    "тяга\0"
+    "тяжесть\0"
+    "тянуть\0"
+    "уважение\0"
+    "угол\0"
+    "удав\0"
+    "удаль\0"
+    "удар\0"
+    "удача\0"
+    "ужин\0"
+    "узел\0"
+    "узкий\0"
+    "узор\0"
+    "указ\0"
+    "уклон\0"
+    "уксус\0"
+    "улица\0"
+    "улыбка\0"
+    "умение\0"
+    "умный\0"
+    "умысел\0"
+    "унция\0"
+    "уплата\0"
+    "уран\0"
+    "урна\0"
+    "уровень\0"
+    "урок\0"
+    "усадьба\0"
+    "усердие\0"
+    "усилие\0"
+    "условие\0"
+    "услуга\0"
+    "усмешка\0"
+    "успех\0"
+    "устав\0"
+    "утка\0"
+    "утро\0"
+    "утюг\0"
+    "уход\0"
+    "участок\0"
+    "учеба\0"
+    "ученик\0"
+    "училище\0"
+    "учитель\0"
+    "ушко\0"
+    "ущерб\0"
+    "уютный\0"
+    "фабрика\0"
+    "фабула\0"
+    "фаворит\0"
+    "файл\0"
+    "факел\0"
+    "факт\0"
+    "фамилия\0"
+    "фантазия\0"
+    "фара\0"
+    "фасад\0"
+    "фаянс\0"
+    "февраль\0"
+    "феерия\0"
+    "фельетон\0"
+    "феномен\0"
+    "феодал\0"
+    "ферзь\0"
+    "фигура\0"
+    "физика\0"
+    "философ\0"
+    "фильм\0"
+    "финал\0"
+    "фишка\0"
+    "флаг\0"
+    "флейта\0"
+    "флора\0"
+    "флот\0"
+    "флюгер\0"
+    "фокус\0"
+    "фольклор\0"
+    "фонарь\0"
+    "фонд\0"
+    "фонтан\0"
+    "форма\0"
+    "фосфор\0"
+    "фото\0"
+    "фраза\0"
+    "фреска\0"
+    "фронт\0"
+    "фрукт\0"
+    "функция\0"
+    "фуражка\0"
+    "футбол\0"
+    "халат\0"
+    "хаос\0"
+    "характер\0"
+    "хата\0"
+    "хвала\0"
+    "хвост\0"
+    "хижина\0"
+    "химера\0"
+    "химия\0"
+    "хирург\0"
+    "хищник\0"
+    "хлам\0"
+    "хлеб\0"
+    "хлопок\0"
+    "хмурый\0"
+    "хобот\0"
+    "хозяин\0"
+    "хоккей\0"
+    "холм\0"
+    "холод\0"
+    "хохот\0"
+    "хребет\0"
+    "хроника\0"
+    "худоба\0"
+    "хулиган\0"
+    "хурма\0"
+    "хутор\0"
+    "цапля\0"
+    "царство\0"
+    "царь\0"
+    "цвет\0"
+    "целина\0"
+    "цемент\0"
+    "цена\0"
+    "центр\0"
+    "цепь\0"
+    "цикада\0"
+    "цикл\0"
+    "цилиндр\0"
+    "цинк\0"
+    "цирк\0"
+    "цистерна\0"
+    "цитата\0"
+    "цифра\0"
+    "цокот\0"
+    "цыпленок\0"
+    "чабан\0"
+    "чадо\0"
+    "чайник\0"
+    "чародей\0"
+    "часы\0"
+    "чашка\0"
+    "челнок\0"
+    "человек\0"
+    "чемодан\0"
+    "чепуха\0"
+    "черника\0"
+    "черта\0"
+    "чеснок\0"
+    "честь\0"
+    "четкий\0"
+    "чехол\0"
+    "чиновник\0"
+    "число\0"
+    "чистота\0"
+    "читатель\0"
+    "чтение\0"
+    "чувство\0"
+    "чудак\0"
+    "чудо\0"
+    "чулок\0"
+    "чучело\0"
+    "шаблон\0"
+    "шайба\0"
+    "шалаш\0"
+    "шалфей\0"
+    "шампунь\0"
+    "шанс\0"
+    "шапка\0"
+    "шатер\0"
+    "шахта\0"
+    "шашлык\0"
+    "шедевр\0"
+    "шепот\0"
+    "шерсть\0"
+    "шинель\0"
+    "шить\0"
+    "шкаф\0"
+    "школа\0"
+    "шкура\0"
+    "шланг\0"
+    "шлем\0"
+    "шлюпка\0"
+    "шляпа\0"
+    "шнур\0"
+    "шоколад\0"
+    "шорох\0"
+    "шофер\0"
+    "шпага\0"
+    "шпион\0"
+    "шрифт\0"
+    "штаб\0"
+    "штат\0"
+    "штора\0"
+    "штраф\0"
+    "штурман\0"
+    "штык\0"
+    "шуба\0"
+    "эволюция\0"
+    "эгоизм\0"
+    "экзамен\0"
+    "экипаж\0"
+    "экология\0"
+    "экран\0"
+    "эксперт\0"
+    "элемент\0"
+    "элита\0"
+    "эмблема\0"
+    "эмоция\0"
+    "энергия\0"
+    "эпатаж\0"
+    "эпизод\0"
+    "эпоха\0"
+    "эрудит\0"
+    "эскиз\0"
+    "эстрада\0"
+    "этаж\0"
+    "этика\0"
+    "этюд\0"
+    "эфир\0"
+    "эффект\0"
+    "эшелон\0"
+    "юбилей\0"
+    "юбка\0"
+    "юмор\0"
+    "юнга\0"
+    "юность\0"
+    "юноша\0"
+    "юрист\0"
+    "юрта\0"
+    "яблоко\0"
+    "явление\0"
+    "ягода\0"
+    "ягуар\0"
+    "ядро\0"
+    "язык\0"
+    "яйцо\0"
+    "якорь\0"
+    "январь\0"
+    "яркий\0"
+    "ярмарка\0"
+    "ярость\0"
+    "ярус\0"
+    "ясный\0"
+    "ястреб\0"
+    "яхта\0"
+    "ячейка\0"
+    "ячмень\0"
+    "ящерица\0"
+    "ящик";
+
+static const uint16_t ru_offsets[dictionary_size] =
 {
-    {
-        "абажур",
-        "абзац",
-        "абонент",
-        "абордаж",
-        "абрикос",
-        "абсолют",
-        "абсурд",
-        "авангард",
-        "август",
-        "авиация",
-        "авизо",
-        "аврал",
-        "автор",
-        "агат",
-        "агент",
-        "агрегат",
-        "адажио",
-        "адвокат",
-        "адепт",
-        "адмирал",
-        "адрес",
-        "ажиотаж",
-        "азарт",
-        "азбука",
-        "азимут",
-        "азот",
-        "айва",
-        "айсберг",
-        "академия",
-        "аквариум",
-        "акведук",
-        "аккорд",
-        "акробат",
-        "аксиома",
-        "актер",
-        "актриса",
-        "акула",
-        "акцент",
-        "акция",
-        "алгебра",
-        "алгоритм",
-        "алиби",
-        "аллея",
-        "алмаз",
-        "алоэ",
-        "алтарь",
-        "алфавит",
-        "алхимик",
-        "алый",
-        "альбом",
-        "алюминий",
-        "амбар",
-        "амбиция",
-        "аметист",
-        "амнезия",
-        "ампир",
-        "амулет",
-        "амфора",
-        "анализ",
-        "ангар",
-        "анекдот",
-        "анимация",
-        "анкета",
-        "аноним",
-        "ансамбль",
-        "антиквар",
-        "анфилада",
-        "анчоус",
-        "апатия",
-        "апельсин",
-        "апогей",
-        "апофеоз",
-        "апрель",
-        "аптека",
-        "арахис",
-        "арбуз",
-        "аргумент",
-        "аренда",
-        "ария",
-        "арка",
-        "арлекин",
-        "армада",
-        "аромат",
-        "арсенал",
-        "артист",
-        "арфа",
-        "архив",
-        "аршин",
-        "асбест",
-        "аскет",
-        "аспирант",
-        "астроном",
-        "асфальт",
-        "атака",
-        "ателье",
-        "атлас",
-        "атом",
-        "атрибут",
-        "аудитор",
-        "аукцион",
-        "аура",
-        "афиша",
-        "афоризм",
-        "ацетон",
-        "аэропорт",
-        "бабочка",
-        "багаж",
-        "бадья",
-        "байка",
-        "бакалея",
-        "баланс",
-        "балет",
-        "балкон",
-        "баллада",
-        "бамбук",
-        "бампер",
-        "банджо",
-        "банк",
-        "баобаб",
-        "барабан",
-        "бард",
-        "барс",
-        "бархат",
-        "барьер",
-        "басня",
-        "бассейн",
-        "бастион",
-        "батарея",
-        "батон",
-        "батут",
-        "баул",
-        "бахрома",
-        "башмак",
-        "баян",
-        "бегемот",
-        "бегония",
-        "бегство",
-        "бездна",
-        "бейсбол",
-        "бекон",
-        "белок",
-        "белый",
-        "белье",
-        "бензин",
-        "бергамот",
-        "берег",
-        "берлога",
-        "беседа",
-        "биатлон",
-        "бигуди",
-        "бидон",
-        "бизнес",
-        "бикини",
-        "бильярд",
-        "бинокль",
-        "бинт",
-        "биология",
-        "биржа",
-        "бисер",
-        "бицепс",
-        "благо",
-        "блеск",
-        "блеф",
-        "блин",
-        "блокнот",
-        "блондин",
-        "блюдо",
-        "бляха",
-        "бобер",
-        "бобина",
-        "богатырь",
-        "бодрый",
-        "боевик",
-        "боец",
-        "бойлер",
-        "бокал",
-        "болид",
-        "бордюр",
-        "борода",
-        "борщ",
-        "борьба",
-        "босой",
-        "ботва",
-        "ботинок",
-        "боцман",
-        "бочка",
-        "боярин",
-        "брак",
-        "брат",
-        "бревно",
-        "бригада",
-        "брикет",
-        "бровь",
-        "брод",
-        "брокер",
-        "бросок",
-        "брюки",
-        "брюнет",
-        "бубен",
-        "бублик",
-        "бугор",
-        "будка",
-        "будущее",
-        "бузина",
-        "буйвол",
-        "буква",
-        "букет",
-        "буксир",
-        "булат",
-        "бульвар",
-        "бумага",
-        "бумеранг",
-        "бунгало",
-        "бунт",
-        "бурьян",
-        "буря",
-        "бусы",
-        "бутон",
-        "бутылка",
-        "буфет",
-        "бухта",
-        "быстрота",
-        "бюджет",
-        "бюро",
-        "бюст",
-        "вагон",
-        "важный",
-        "вазелин",
-        "вакса",
-        "вакуум",
-        "вакцина",
-        "валенок",
-        "валюта",
-        "вандал",
-        "ваниль",
-        "ванна",
-        "варенье",
-        "вариант",
-        "варьете",
-        "ватага",
-        "ватман",
-        "ваучер",
-        "вафля",
-        "вахта",
-        "ведро",
-        "ведьма",
-        "везение",
-        "веко",
-        "вексель",
-        "велеть",
-        "величие",
-        "велодром",
-        "венец",
-        "вентиль",
-        "веранда",
-        "верблюд",
-        "веревка",
-        "версия",
-        "вершина",
-        "веселье",
-        "весло",
-        "весна",
-        "весть",
-        "ветвь",
-        "ветер",
-        "ветчина",
-        "веха",
-        "вещь",
-        "веяние",
-        "взбучка",
-        "взвод",
-        "взгляд",
-        "вздох",
-        "взмах",
-        "взнос",
-        "взор",
-        "взрыв",
-        "вибрация",
-        "видение",
-        "визг",
-        "визит",
-        "вилка",
-        "вирус",
-        "висеть",
-        "висок",
-        "витрина",
-        "вихрь",
-        "вкус",
-        "влага",
-        "владелец",
-        "власть",
-        "влияние",
-        "внимание",
-        "внук",
-        "вобла",
-        "вода",
-        "водород",
-        "вожак",
-        "возглас",
-        "воздух",
-        "возить",
-        "возраст",
-        "воин",
-        "вокзал",
-        "волк",
-        "волна",
-        "волокно",
-        "воля",
-        "вопрос",
-        "ворота",
-        "восторг",
-        "вотум",
-        "вояж",
-        "врач",
-        "время",
-        "всадник",
-        "всплеск",
-        "вспышка",
-        "встреча",
-        "вторник",
-        "втулка",
-        "вулкан",
-        "вход",
-        "выбор",
-        "вывод",
-        "выгиб",
-        "выдра",
-        "выемка",
-        "вызов",
-        "выигрыш",
-        "выкуп",
-        "вымысел",
-        "выпечка",
-        "выпуск",
-        "вырез",
-        "выскочка",
-        "высота",
-        "выставка",
-        "вытяжка",
-        "вычет",
-        "вышка",
-        "вьюга",
-        "вязанка",
-        "вялый",
-        "гавань",
-        "гадать",
-        "газета",
-        "газон",
-        "галерея",
-        "галоп",
-        "галстук",
-        "галун",
-        "гамак",
-        "гамбит",
-        "гандбол",
-        "гантель",
-        "гараж",
-        "гардина",
-        "гарем",
-        "гармония",
-        "гарнир",
-        "гарпун",
-        "гвардия",
-        "гвоздь",
-        "гегемон",
-        "гейзер",
-        "гектар",
-        "генерал",
-        "гений",
-        "геолог",
-        "гепард",
-        "гербарий",
-        "герой",
-        "герцог",
-        "гжель",
-        "гигант",
-        "гильза",
-        "гимн",
-        "гипноз",
-        "гипотеза",
-        "гиря",
-        "гитара",
-        "глава",
-        "глагол",
-        "глаз",
-        "глина",
-        "глобус",
-        "глубина",
-        "глухой",
-        "глыба",
-        "глюкоза",
-        "глянец",
-        "гнев",
-        "гнездо",
-        "гном",
-        "гобелен",
-        "голова",
-        "голый",
-        "гомон",
-        "гондола",
-        "гонка",
-        "гора",
-        "горло",
-        "город",
-        "горшок",
-        "госпожа",
-        "гость",
-        "градус",
-        "грамота",
-        "грань",
-        "графа",
-        "гребень",
-        "грек",
-        "гречиха",
-        "гриб",
-        "гривна",
-        "гром",
-        "грохот",
-        "грубый",
-        "грудь",
-        "груз",
-        "группа",
-        "груша",
-        "грязь",
-        "губа",
-        "гудеть",
-        "гулять",
-        "гурман",
-        "гусли",
-        "густой",
-        "гусь",
-        "гуща",
-        "давать",
-        "давление",
-        "давний",
-        "дамба",
-        "данные",
-        "дарить",
-        "дата",
-        "датчик",
-        "дверь",
-        "движение",
-        "двойня",
-        "дворец",
-        "дебют",
-        "девочка",
-        "девушка",
-        "действие",
-        "декабрь",
-        "декорум",
-        "делить",
-        "дело",
-        "дельфин",
-        "демагог",
-        "демократ",
-        "день",
-        "депеша",
-        "депутат",
-        "дерево",
-        "держава",
-        "десерт",
-        "десяток",
-        "деталь",
-        "детство",
-        "дефицит",
-        "деятель",
-        "джаз",
-        "джигит",
-        "джинсы",
-        "джунгли",
-        "диагноз",
-        "диалог",
-        "диапазон",
-        "диафильм",
-        "диван",
-        "дивизия",
-        "диета",
-        "дизайн",
-        "дизель",
-        "дикий",
-        "дикобраз",
-        "диктант",
-        "дилижанс",
-        "динамика",
-        "диплом",
-        "директор",
-        "диск",
-        "дисплей",
-        "дитя",
-        "дифирамб",
-        "дичь",
-        "дневник",
-        "добавка",
-        "добро",
-        "добыча",
-        "доверие",
-        "догмат",
-        "договор",
-        "дождь",
-        "доклад",
-        "доктор",
-        "документ",
-        "долг",
-        "доллар",
-        "домысел",
-        "дорога",
-        "досада",
-        "доска",
-        "досье",
-        "дотация",
-        "доход",
-        "доцент",
-        "доярка",
-        "драгун",
-        "драка",
-        "дремота",
-        "дрова",
-        "дрожь",
-        "друг",
-        "дружба",
-        "дубликат",
-        "дукат",
-        "дума",
-        "дупло",
-        "духовка",
-        "душа",
-        "дуэт",
-        "дыня",
-        "дыра",
-        "дыхание",
-        "дышать",
-        "дюжина",
-        "дюйм",
-        "дюна",
-        "дядя",
-        "дятел",
-        "европа",
-        "егерь",
-        "егоза",
-        "единица",
-        "едкий",
-        "ежевика",
-        "езда",
-        "ельник",
-        "емкость",
-        "енот",
-        "ералаш",
-        "ермолка",
-        "ерунда",
-        "есаул",
-        "ехать",
-        "жабо",
-        "жажда",
-        "жалкий",
-        "жалоба",
-        "жалюзи",
-        "жандарм",
-        "жанр",
-        "жара",
-        "жаргон",
-        "жаровня",
-        "жатва",
-        "жбан",
-        "жгут",
-        "желание",
-        "железо",
-        "желтый",
-        "жемчуг",
-        "жених",
-        "женщина",
-        "жердь",
-        "жеребец",
-        "жерло",
-        "жест",
-        "живот",
-        "жизнь",
-        "жилет",
-        "жилье",
-        "жираф",
-        "житель",
-        "жнец",
-        "жокей",
-        "жребий",
-        "журнал",
-        "жюри",
-        "забава",
-        "забег",
-        "забияка",
-        "забрало",
-        "забыть",
-        "завал",
-        "завеса",
-        "завод",
-        "завтрак",
-        "завязь",
-        "загадка",
-        "заговор",
-        "задача",
-        "задел",
-        "задира",
-        "задний",
-        "задор",
-        "задумка",
-        "зажим",
-        "зазывала",
-        "закат",
-        "заклад",
-        "закон",
-        "залежь",
-        "залив",
-        "заметка",
-        "замок",
-        "замысел",
-        "занос",
-        "занятие",
-        "запад",
-        "запись",
-        "заплыв",
-        "заповедь",
-        "запятая",
-        "зарок",
-        "зарубка",
-        "заря",
-        "засада",
-        "заслуга",
-        "заставка",
-        "затея",
-        "затор",
-        "затрата",
-        "затылок",
-        "захват",
-        "зацепка",
-        "зачаток",
-        "зачет",
-        "защита",
-        "заявка",
-        "заяц",
-        "звезда",
-        "звонок",
-        "звук",
-        "здоровье",
-        "зебра",
-        "зевака",
-        "зелень",
-        "земля",
-        "зенит",
-        "зеркало",
-        "зерно",
-        "зефир",
-        "зигзаг",
-        "зима",
-        "злоба",
-        "змея",
-        "знак",
-        "знамя",
-        "знание",
-        "значение",
-        "зной",
-        "зодчий",
-        "зола",
-        "золото",
-        "зоопарк",
-        "зоркий",
-        "зрачок",
-        "зрелище",
-        "зрение",
-        "зритель",
-        "зубило",
-        "зыбкий",
-        "зять",
-        "иволга",
-        "игла",
-        "игра",
-        "идеал",
-        "идея",
-        "идиллия",
-        "идиома",
-        "идол",
-        "идти",
-        "иерархия",
-        "иероглиф",
-        "изба",
-        "известие",
-        "изгиб",
-        "издание",
-        "изделие",
-        "изотоп",
-        "изыск",
-        "изюм",
-        "иллюзия",
-        "имбирь",
-        "имение",
-        "имидж",
-        "империя",
-        "импульс",
-        "инвестор",
-        "индекс",
-        "индивид",
-        "инерция",
-        "инженер",
-        "инжир",
-        "институт",
-        "интерес",
-        "интрига",
-        "ипподром",
-        "ирис",
-        "ирония",
-        "искать",
-        "искра",
-        "испуг",
-        "истина",
-        "история",
-        "истукан",
-        "исход",
-        "итог",
-        "кабаре",
-        "кабель",
-        "кабина",
-        "каблук",
-        "кавалер",
-        "кадка",
-        "кадр",
-        "кадык",
-        "казак",
-        "казино",
-        "казус",
-        "кайма",
-        "кайф",
-        "какао",
-        "кактус",
-        "каламбур",
-        "калитка",
-        "калория",
-        "кальций",
-        "камбала",
-        "камень",
-        "камин",
-        "камыш",
-        "канал",
-        "кандидат",
-        "канкан",
-        "каноэ",
-        "каньон",
-        "капитал",
-        "капля",
-        "капот",
-        "каприз",
-        "капсула",
-        "капуста",
-        "капюшон",
-        "карабин",
-        "карета",
-        "каркас",
-        "карман",
-        "карп",
-        "картон",
-        "карьера",
-        "каскад",
-        "касторка",
-        "каталог",
-        "катер",
-        "катод",
-        "каучук",
-        "кафель",
-        "качать",
-        "качество",
-        "каша",
-        "кашпо",
-        "каштан",
-        "каюта",
-        "квадрат",
-        "квант",
-        "кварц",
-        "квинтет",
-        "квиток",
-        "кворум",
-        "квота",
-        "кегли",
-        "кекс",
-        "кемпинг",
-        "кенгуру",
-        "кепка",
-        "керосин",
-        "кетчуп",
-        "кибитка",
-        "кивок",
-        "километр",
-        "килька",
-        "кимоно",
-        "кинжал",
-        "кино",
-        "киоск",
-        "кипеть",
-        "кипяток",
-        "кирка",
-        "кирпич",
-        "кисель",
-        "кислота",
-        "кисть",
-        "клапан",
-        "кларнет",
-        "клевер",
-        "клерк",
-        "клетка",
-        "клиент",
-        "климат",
-        "клинок",
-        "кличка",
-        "клише",
-        "клоун",
-        "клуб",
-        "клумба",
-        "клык",
-        "клюква",
-        "ключ",
-        "клюшка",
-        "клякса",
-        "клятва",
-        "кляча",
-        "книга",
-        "кнопка",
-        "кнут",
-        "князь",
-        "ковбой",
-        "ковер",
-        "ковыль",
-        "когорта",
-        "кодекс",
-        "кожа",
-        "кожура",
-        "козел",
-        "козырь",
-        "койка",
-        "койот",
-        "кокос",
-        "коктейль",
-        "колбаса",
-        "колдун",
-        "колесо",
-        "коллаж",
-        "колодец",
-        "колпак",
-        "колхоз",
-        "кольцо",
-        "комар",
-        "комбайн",
-        "комедия",
-        "комитет",
-        "комната",
-        "компания",
-        "конверт",
-        "конгресс",
-        "кондитер",
-        "конец",
-        "конкурс",
-        "конспект",
-        "контакт",
-        "конус",
-        "конфуз",
-        "концерт",
-        "конь",
-        "копейка",
-        "копия",
-        "копна",
-        "копоть",
-        "копыто",
-        "копье",
-        "корабль",
-        "корень",
-        "корзина",
-        "коридор",
-        "кормить",
-        "корнет",
-        "король",
-        "корпус",
-        "коррида",
-        "корсет",
-        "космос",
-        "костюм",
-        "котел",
-        "котлета",
-        "коттедж",
-        "кофе",
-        "кофта",
-        "кочан",
-        "кошка",
-        "край",
-        "краска",
-        "кредит",
-        "крекер",
-        "кремль",
-        "кресло",
-        "кривой",
-        "кризис",
-        "крик",
-        "критика",
-        "кровать",
-        "кролик",
-        "крыло",
-        "крыша",
-        "крючок",
-        "кубок",
-        "кувшин",
-        "кузен",
-        "кузнец",
-        "кузов",
-        "кукла",
-        "кулак",
-        "кулон",
-        "культура",
-        "кумир",
-        "купец",
-        "купол",
-        "курица",
-        "курорт",
-        "курс",
-        "куртка",
-        "кусок",
-        "куст",
-        "кухня",
-        "куча",
-        "кювет",
-        "лабиринт",
-        "лаваш",
-        "лавина",
-        "лавка",
-        "лагерь",
-        "лагуна",
-        "ладонь",
-        "лазер",
-        "лайнер",
-        "лакей",
-        "лампа",
-        "ландшафт",
-        "лапоть",
-        "лапша",
-        "ларек",
-        "латунь",
-        "лауреат",
-        "лацкан",
-        "лачуга",
-        "лаять",
-        "лебедь",
-        "легенда",
-        "лежак",
-        "лезть",
-        "лекция",
-        "лента",
-        "лепесток",
-        "леска",
-        "лестница",
-        "лететь",
-        "лето",
-        "летчик",
-        "лечение",
-        "леший",
-        "лиана",
-        "либерал",
-        "ливень",
-        "ливрея",
-        "лига",
-        "лидер",
-        "лимит",
-        "лимон",
-        "линия",
-        "лирика",
-        "литр",
-        "лифт",
-        "лихой",
-        "лицей",
-        "лицо",
-        "ловить",
-        "логика",
-        "лодка",
-        "лозунг",
-        "локоть",
-        "ломать",
-        "лоно",
-        "лопата",
-        "лорд",
-        "лось",
-        "лошадь",
-        "луна",
-        "лучший",
-        "лыжа",
-        "льгота",
-        "льдина",
-        "любовь",
-        "люстра",
-        "лютня",
-        "лягушка",
-        "лямка",
-        "магазин",
-        "магия",
-        "магма",
-        "мадам",
-        "майор",
-        "маклер",
-        "максимум",
-        "малыш",
-        "мальчик",
-        "маляр",
-        "мангал",
-        "мандат",
-        "манеж",
-        "мантия",
-        "марафон",
-        "март",
-        "маршал",
-        "маскарад",
-        "масло",
-        "мастер",
-        "масштаб",
-        "матадор",
-        "материя",
-        "матрос",
-        "матч",
-        "мафия",
-        "махать",
-        "машина",
-        "маэстро",
-        "маяк",
-        "мебель",
-        "медаль",
-        "медведь",
-        "мелкий",
-        "мелодия",
-        "менять",
-        "мера",
-        "место",
-        "месяц",
-        "металл",
-        "метеор",
-        "метла",
-        "метод",
-        "метр",
-        "механизм",
-        "мечта",
-        "мешок",
-        "мизинец",
-        "микрофон",
-        "миксер",
-        "милиция",
-        "миллион",
-        "милость",
-        "милый",
-        "мимоза",
-        "министр",
-        "минута",
-        "митинг",
-        "мишень",
-        "мнение",
-        "модель",
-        "модуль",
-        "мозг",
-        "молва",
-        "молния",
-        "молоко",
-        "молчать",
-        "момент",
-        "монах",
-        "монета",
-        "монитор",
-        "монолог",
-        "мораль",
-        "море",
-        "морковь",
-        "мороз",
-        "моряк",
-        "мост",
-        "мотив",
-        "мотор",
-        "мудрый",
-        "мужчина",
-        "музей",
-        "музыка",
-        "мундир",
-        "муравей",
-        "мусор",
-        "мустанг",
-        "муфта",
-        "муха",
-        "мушкетер",
-        "мыло",
-        "мысль",
-        "мышь",
-        "мэтр",
-        "мюзикл",
-        "мягкий",
-        "мякиш",
-        "мясо",
-        "мятый",
-        "набат",
-        "навар",
-        "навык",
-        "наган",
-        "награда",
-        "надежда",
-        "надпись",
-        "название",
-        "наитие",
-        "наличие",
-        "налог",
-        "намек",
-        "напиток",
-        "напор",
-        "народ",
-        "наряд",
-        "натура",
-        "наука",
-        "нация",
-        "начало",
-        "наяда",
-        "небо",
-        "невеста",
-        "неделя",
-        "нейлон",
-        "нейрон",
-        "немой",
-        "неон",
-        "нерв",
-        "нести",
-        "нефть",
-        "нива",
-        "низкий",
-        "никель",
-        "нирвана",
-        "нитка",
-        "нить",
-        "ничья",
-        "ниша",
-        "новация",
-        "новелла",
-        "новость",
-        "нога",
-        "ноготь",
-        "ноздря",
-        "номер",
-        "норма",
-        "носок",
-        "нота",
-        "ночлег",
-        "ночь",
-        "ноябрь",
-        "нрав",
-        "нужда",
-        "нужный",
-        "нюанс",
-        "няня",
-        "оазис",
-        "обаяние",
-        "обвод",
-        "обед",
-        "обелиск",
-        "обещать",
-        "обзор",
-        "обида",
-        "облако",
-        "облик",
-        "обломок",
-        "обман",
-        "обморок",
-        "оборот",
-        "обочина",
-        "образ",
-        "обруч",
-        "обрыв",
-        "обувь",
-        "обучение",
-        "обхват",
-        "общение",
-        "объект",
-        "объятие",
-        "обычай",
-        "овес",
-        "овощ",
-        "овраг",
-        "овца",
-        "овчарка",
-        "огонь",
-        "ограда",
-        "огурец",
-        "одежда",
-        "одеяло",
-        "ожидание",
-        "ожог",
-        "озеро",
-        "океан",
-        "окно",
-        "окоп",
-        "окорок",
-        "окраина",
-        "округ",
-        "октава",
-        "октябрь",
-        "олень",
-        "олимп",
-        "опека",
-        "операция",
-        "описание",
-        "оплата",
-        "опора",
-        "оппонент",
-        "оправа",
-        "оптика",
-        "опыт",
-        "орбита",
-        "орган",
-        "орден",
-        "орел",
-        "оригинал",
-        "ориентир",
-        "оркестр",
-        "орнамент",
-        "оружие",
-        "осадок",
-        "осень",
-        "осина",
-        "осколок",
-        "осмотр",
-        "основа",
-        "особняк",
-        "осока",
-        "остаток",
-        "остров",
-        "отбор",
-        "ответ",
-        "отдача",
-        "отдел",
-        "отдых",
-        "отель",
-        "отец",
-        "отзыв",
-        "отказ",
-        "открытие",
-        "откуп",
-        "отличие",
-        "отпуск",
-        "отрасль",
-        "отряд",
-        "отсев",
-        "оттенок",
-        "отчет",
-        "отшиб",
-        "отъезд",
-        "офис",
-        "офицер",
-        "охапка",
-        "охота",
-        "охрана",
-        "оценка",
-        "очаг",
-        "очерк",
-        "очки",
-        "ошейник",
-        "ошибка",
-        "павильон",
-        "павлин",
-        "падение",
-        "паек",
-        "пакля",
-        "пакт",
-        "палата",
-        "палец",
-        "палуба",
-        "пальто",
-        "памфлет",
-        "память",
-        "панель",
-        "паника",
-        "парафин",
-        "парень",
-        "парк",
-        "пароход",
-        "партия",
-        "парус",
-        "пасека",
-        "паспорт",
-        "пастух",
-        "патрон",
-        "пауза",
-        "пафос",
-        "пахарь",
-        "пацан",
-        "пациент",
-        "певец",
-        "педагог",
-        "пейзаж",
-        "пельмень",
-        "пена",
-        "пенсия",
-        "пепел",
-        "перец",
-        "период",
-        "перо",
-        "персонаж",
-        "песня",
-        "песок",
-        "петля",
-        "петух",
-        "петь",
-        "пехота",
-        "печать",
-        "печень",
-        "пешеход",
-        "пешка",
-        "пещера",
-        "пианист",
-        "пиво",
-        "пиджак",
-        "пила",
-        "пилот",
-        "пионер",
-        "писатель",
-        "письмо",
-        "питание",
-        "пицца",
-        "пища",
-        "плагиат",
-        "плакат",
-        "план",
-        "платье",
-        "плац",
-        "пленка",
-        "плечо",
-        "плита",
-        "плод",
-        "площадь",
-        "плыть",
-        "плюс",
-        "пляж",
-        "победа",
-        "повар",
-        "повесть",
-        "повод",
-        "повтор",
-        "повязка",
-        "погода",
-        "подарок",
-        "подвиг",
-        "поднос",
-        "подпись",
-        "подруга",
-        "подушка",
-        "подход",
-        "подъем",
-        "поезд",
-        "позиция",
-        "поиск",
-        "покер",
-        "поклажа",
-        "покой",
-        "покупка",
-        "полдень",
-        "поле",
-        "политик",
-        "полный",
-        "полоса",
-        "получка",
-        "полынь",
-        "польза",
-        "поляна",
-        "пометка",
-        "помощь",
-        "помпон",
-        "пони",
-        "понятие",
-        "попытка",
-        "порог",
-        "портрет",
-        "порция",
-        "порыв",
-        "порядок",
-        "посадка",
-        "поселок",
-        "посох",
-        "постель",
-        "посуда",
-        "потеря",
-        "поток",
-        "походка",
-        "поцелуй",
-        "почва",
-        "поэзия",
-        "поэт",
-        "пояс",
-        "правда",
-        "праздник",
-        "практик",
-        "преграда",
-        "предел",
-        "презент",
-        "премия",
-        "препарат",
-        "прибор",
-        "привет",
-        "прием",
-        "призыв",
-        "приказ",
-        "приличие",
-        "пример",
-        "принц",
-        "природа",
-        "приступ",
-        "прицел",
-        "причина",
-        "приятель",
-        "пробка",
-        "провал",
-        "прогноз",
-        "продукт",
-        "проект",
-        "проза",
-        "прокурор",
-        "пропуск",
-        "простор",
-        "протеже",
-        "процент",
-        "прочерк",
-        "прошлое",
-        "пруд",
-        "прыжок",
-        "прялка",
-        "прямота",
-        "психика",
-        "птица",
-        "публика",
-        "пугать",
-        "пудра",
-        "пузырь",
-        "пульт",
-        "пуля",
-        "пункт",
-        "пунш",
-        "пурга",
-        "пустяк",
-        "путь",
-        "пухлый",
-        "пчела",
-        "пшеница",
-        "пыль",
-        "пышный",
-        "пьеса",
-        "пятно",
-        "работа",
-        "радар",
-        "раджа",
-        "радио",
-        "радость",
-        "радуга",
-        "развитие",
-        "разговор",
-        "раздел",
-        "разлив",
-        "размер",
-        "разница",
-        "разряд",
-        "разум",
-        "район",
-        "ракета",
-        "ракушка",
-        "рама",
-        "рандеву",
-        "рантье",
-        "ранчо",
-        "рапира",
-        "рапорт",
-        "раритет",
-        "раскат",
-        "расписка",
-        "рассвет",
-        "раствор",
-        "расход",
-        "расчет",
-        "ратуша",
-        "раунд",
-        "рация",
-        "реакция",
-        "реализм",
-        "ребенок",
-        "ребро",
-        "ребус",
-        "ревизор",
-        "регион",
-        "редис",
-        "реестр",
-        "режим",
-        "резак",
-        "рейтинг",
-        "река",
-        "реклама",
-        "ректор",
-        "рельс",
-        "ремарка",
-        "ремень",
-        "ремонт",
-        "реноме",
-        "рента",
-        "реплика",
-        "ресница",
-        "ресторан",
-        "ресурс",
-        "реформа",
-        "рецепт",
-        "речь",
-        "решение",
-        "ржавчина",
-        "рикша",
-        "риск",
-        "рисунок",
-        "ритм",
-        "рифма",
-        "робкий",
-        "родео",
-        "родина",
-        "рождение",
-        "роман",
-        "рост",
-        "росчерк",
-        "рота",
-        "рояль",
-        "рубашка",
-        "рубеж",
-        "рубль",
-        "рубрика",
-        "ругать",
-        "рудник",
-        "ружье",
-        "руины",
-        "рука",
-        "рулет",
-        "рупор",
-        "ручей",
-        "рыба",
-        "рыжий",
-        "рынок",
-        "рысь",
-        "рыцарь",
-        "рычаг",
-        "рюкзак",
-        "рюмка",
-        "рябина",
-        "сабля",
-        "сазан",
-        "сайгак",
-        "саксаул",
-        "сальто",
-        "самолет",
-        "самурай",
-        "сандвич",
-        "сани",
-        "сапог",
-        "сапфир",
-        "сарай",
-        "сарказм",
-        "сатира",
-        "сауна",
-        "сахар",
-        "сбруя",
-        "сбыт",
-        "свадьба",
-        "свежий",
-        "сверло",
-        "свеча",
-        "свидание",
-        "свист",
-        "свобода",
-        "свойство",
-        "связь",
-        "сделка",
-        "сеанс",
-        "сегмент",
-        "седина",
-        "седло",
-        "сезон",
-        "сейф",
-        "секрет",
-        "секунда",
-        "селение",
-        "семафор",
-        "семинар",
-        "семья",
-        "сено",
-        "сентябрь",
-        "сервис",
-        "сердце",
-        "середина",
-        "сержант",
-        "серия",
-        "серьга",
-        "сестра",
-        "сеть",
-        "сигара",
-        "сигнал",
-        "сиденье",
-        "сила",
-        "символ",
-        "симптом",
-        "синева",
-        "сирень",
-        "сирота",
-        "система",
-        "ситец",
-        "ситуация",
-        "сиять",
-        "сказка",
-        "скакун",
-        "скала",
-        "скамья",
-        "скачок",
-        "скважина",
-        "сквер",
-        "скворец",
-        "скелет",
-        "скидка",
-        "склад",
-        "скрепа",
-        "скрипка",
-        "скука",
-        "слабый",
-        "слава",
-        "след",
-        "слеза",
-        "слияние",
-        "слово",
-        "слон",
-        "служба",
-        "слух",
-        "случай",
-        "смена",
-        "смесь",
-        "смех",
-        "смола",
-        "смысл",
-        "смычок",
-        "смятение",
-        "снег",
-        "снимок",
-        "собака",
-        "собрание",
-        "событие",
-        "совет",
-        "сокол",
-        "солдат",
-        "солнце",
-        "соловей",
-        "соль",
-        "соната",
-        "соперник",
-        "сопка",
-        "сорт",
-        "сосед",
-        "сосна",
-        "состав",
-        "сосуд",
-        "соус",
-        "социолог",
-        "союз",
-        "спальня",
-        "спать",
-        "спина",
-        "список",
-        "спичка",
-        "спор",
-        "способ",
-        "справка",
-        "спутник",
-        "среда",
-        "ставка",
-        "стадо",
-        "стакан",
-        "сталкер",
-        "станция",
-        "старик",
-        "статус",
-        "стая",
-        "ствол",
-        "стекло",
-        "стена",
-        "степь",
-        "стиль",
-        "стихи",
-        "стойка",
-        "столица",
-        "стон",
-        "сторона",
-        "стоянка",
-        "страна",
-        "стрела",
-        "строка",
-        "струя",
-        "студия",
-        "стук",
-        "ступень",
-        "стыд",
-        "стюард",
-        "стяжка",
-        "суббота",
-        "субъект",
-        "сувенир",
-        "сугроб",
-        "судно",
-        "судья",
-        "суета",
-        "сумка",
-        "супруг",
-        "суть",
-        "сухой",
-        "суша",
-        "сфера",
-        "схема",
-        "счастье",
-        "счет",
-        "съезд",
-        "съемка",
-        "сырой",
-        "сырье",
-        "сытый",
-        "сыщик",
-        "сюжет",
-        "сюрприз",
-        "сюртук",
-        "табак",
-        "табель",
-        "таблица",
-        "табун",
-        "тайна",
-        "тайфун",
-        "такси",
-        "талант",
-        "талон",
-        "таможня",
-        "танец",
-        "танк",
-        "танцор",
-        "тарелка",
-        "тариф",
-        "творог",
-        "театр",
-        "тезис",
-        "текст",
-        "телега",
-        "темнота",
-        "темп",
-        "тень",
-        "теория",
-        "тепло",
-        "терапия",
-        "термин",
-        "терять",
-        "тесный",
-        "тетрадь",
-        "тетя",
-        "техника",
-        "течение",
-        "тигр",
-        "тираж",
-        "титул",
-        "тишина",
-        "ткань",
-        "товар",
-        "токарь",
-        "толк",
-        "толпа",
-        "толчок",
-        "тонкий",
-        "тонна",
-        "топливо",
-        "топор",
-        "торговля",
-        "тостер",
-        "точка",
-        "тощий",
-        "трава",
-        "традиция",
-        "трактор",
-        "трамвай",
-        "траншея",
-        "тревога",
-        "треск",
-        "трещина",
-        "трибуна",
-        "тройка",
-        "тропа",
-        "тротуар",
-        "труба",
-        "труд",
-        "трюк",
-        "тряпка",
-        "трясти",
-        "туман",
-        "тундра",
-        "тупик",
-        "турист",
-        "турнир",
-        "туфля",
-        "туча",
-        "тюльпан",
-        "тяга",
-        "тяжесть",
-        "тянуть",
-        "уважение",
-        "угол",
-        "удав",
-        "удаль",
-        "удар",
-        "удача",
-        "ужин",
-        "узел",
-        "узкий",
-        "узор",
-        "указ",
-        "уклон",
-        "уксус",
-        "улица",
-        "улыбка",
-        "умение",
-        "умный",
-        "умысел",
-        "унция",
-        "уплата",
-        "уран",
-        "урна",
-        "уровень",
-        "урок",
-        "усадьба",
-        "усердие",
-        "усилие",
-        "условие",
-        "услуга",
-        "усмешка",
-        "успех",
-        "устав",
-        "утка",
-        "утро",
-        "утюг",
-        "уход",
-        "участок",
-        "учеба",
-        "ученик",
-        "училище",
-        "учитель",
-        "ушко",
-        "ущерб",
-        "уютный",
-        "фабрика",
-        "фабула",
-        "фаворит",
-        "файл",
-        "факел",
-        "факт",
-        "фамилия",
-        "фантазия",
-        "фара",
-        "фасад",
-        "фаянс",
-        "февраль",
-        "феерия",
-        "фельетон",
-        "феномен",
-        "феодал",
-        "ферзь",
-        "фигура",
-        "физика",
-        "философ",
-        "фильм",
-        "финал",
-        "фишка",
-        "флаг",
-        "флейта",
-        "флора",
-        "флот",
-        "флюгер",
-        "фокус",
-        "фольклор",
-        "фонарь",
-        "фонд",
-        "фонтан",
-        "форма",
-        "фосфор",
-        "фото",
-        "фраза",
-        "фреска",
-        "фронт",
-        "фрукт",
-        "функция",
-        "фуражка",
-        "футбол",
-        "халат",
-        "хаос",
-        "характер",
-        "хата",
-        "хвала",
-        "хвост",
-        "хижина",
-        "химера",
-        "химия",
-        "хирург",
-        "хищник",
-        "хлам",
-        "хлеб",
-        "хлопок",
-        "хмурый",
-        "хобот",
-        "хозяин",
-        "хоккей",
-        "холм",
-        "холод",
-        "хохот",
-        "хребет",
-        "хроника",
-        "худоба",
-        "хулиган",
-        "хурма",
-        "хутор",
-        "цапля",
-        "царство",
-        "царь",
-        "цвет",
-        "целина",
-        "цемент",
-        "цена",
-        "центр",
-        "цепь",
-        "цикада",
-        "цикл",
-        "цилиндр",
-        "цинк",
-        "цирк",
-        "цистерна",
-        "цитата",
-        "цифра",
-        "цокот",
-        "цыпленок",
-        "чабан",
-        "чадо",
-        "чайник",
-        "чародей",
-        "часы",
-        "чашка",
-        "челнок",
-        "человек",
-        "чемодан",
-        "чепуха",
-        "черника",
-        "черта",
-        "чеснок",
-        "честь",
-        "четкий",
-        "чехол",
-        "чиновник",
-        "число",
-        "чистота",
-        "читатель",
-        "чтение",
-        "чувство",
-        "чудак",
-        "чудо",
-        "чулок",
-        "чучело",
-        "шаблон",
-        "шайба",
-        "шалаш",
-        "шалфей",
-        "шампунь",
-        "шанс",
-        "шапка",
-        "шатер",
-        "шахта",
-        "шашлык",
-        "шедевр",
-        "шепот",
-        "шерсть",
-        "шинель",
-        "шить",
-        "шкаф",
-        "школа",
-        "шкура",
-        "шланг",
-        "шлем",
-        "шлюпка",
-        "шляпа",
-        "шнур",
-        "шоколад",
-        "шорох",
-        "шофер",
-        "шпага",
-        "шпион",
-        "шрифт",
-        "штаб",
-        "штат",
-        "штора",
-        "штраф",
-        "штурман",
-        "штык",
-        "шуба",
-        "эволюция",
-        "эгоизм",
-        "экзамен",
-        "экипаж",
-        "экология",
-        "экран",
-        "эксперт",
-        "элемент",
-        "элита",
-        "эмблема",
-        "эмоция",
-        "энергия",
-        "эпатаж",
-        "эпизод",
-        "эпоха",
-        "эрудит",
-        "эскиз",
-        "эстрада",
-        "этаж",
-        "этика",
-        "этюд",
-        "эфир",
-        "эффект",
-        "эшелон",
-        "юбилей",
-        "юбка",
-        "юмор",
-        "юнга",
-        "юность",
-        "юноша",
-        "юрист",
-        "юрта",
-        "яблоко",
-        "явление",
-        "ягода",
-        "ягуар",
-        "ядро",
-        "язык",
-        "яйцо",
-        "якорь",
-        "январь",
-        "яркий",
-        "ярмарка",
-        "ярость",
-        "ярус",
-        "ясный",
-        "ястреб",
-        "яхта",
-        "ячейка",
-        "ячмень",
-        "ящерица",
-        "ящик"
-    }
+    0, 13, 24, 39, 54, 69, 84, 97, 114, 127, 142, 153, 164, 175, 184, 195, 210,
+    223, 238, 249, 264, 275, 290, 301, 314, 327, 336, 345, 360, 377, 394, 409,
+    422, 437, 452, 463, 478, 489, 502, 513, 528, 545, 556, 567, 578, 587, 600,
+    615, 630, 639, 652, 669, 680, 695, 710, 725, 736, 749, 762, 775, 786, 801,
+    818, 831, 844, 861, 878, 895, 908, 921, 938, 951, 966, 979, 992, 1005,
+    1016, 1033, 1046, 1055, 1064, 1079, 1092, 1105, 1120, 1133, 1142, 1153,
+    1164, 1177, 1188, 1205, 1222, 1237, 1248, 1261, 1272, 1281, 1296, 1311,
+    1326, 1335, 1346, 1361, 1374, 1391, 1406, 1417, 1428, 1439, 1454, 1467,
+    1478, 1491, 1506, 1519, 1532, 1545, 1554, 1567, 1582, 1591, 1600, 1613,
+    1626, 1637, 1652, 1667, 1682, 1693, 1704, 1713, 1728, 1741, 1750, 1765,
+    1780, 1795, 1808, 1823, 1834, 1845, 1856, 1867, 1880, 1897, 1908, 1923,
+    1936, 1951, 1964, 1975, 1988, 2001, 2016, 2031, 2040, 2057, 2068, 2079,
+    2092, 2103, 2114, 2123, 2132, 2147, 2162, 2173, 2184, 2195, 2208, 2225,
+    2238, 2251, 2260, 2273, 2284, 2295, 2308, 2321, 2330, 2343, 2354, 2365,
+    2380, 2393, 2404, 2417, 2426, 2435, 2448, 2463, 2476, 2487, 2496, 2509,
+    2522, 2533, 2546, 2557, 2570, 2581, 2592, 2607, 2620, 2633, 2644, 2655,
+    2668, 2679, 2694, 2707, 2724, 2739, 2748, 2761, 2770, 2779, 2790, 2805,
+    2816, 2827, 2844, 2857, 2866, 2875, 2886, 2899, 2914, 2925, 2938, 2953,
+    2968, 2981, 2994, 3007, 3018, 3033, 3048, 3063, 3076, 3089, 3102, 3113,
+    3124, 3135, 3148, 3163, 3172, 3187, 3200, 3215, 3232, 3243, 3258, 3273,
+    3288, 3303, 3316, 3331, 3346, 3357, 3368, 3379, 3390, 3401, 3416, 3425,
+    3434, 3447, 3462, 3473, 3486, 3497, 3508, 3519, 3528, 3539, 3556, 3571,
+    3580, 3591, 3602, 3613, 3626, 3637, 3652, 3663, 3672, 3683, 3700, 3713,
+    3728, 3745, 3754, 3765, 3774, 3789, 3800, 3815, 3828, 3841, 3856, 3865,
+    3878, 3887, 3898, 3913, 3922, 3935, 3948, 3963, 3974, 3983, 3992, 4003,
+    4018, 4033, 4048, 4063, 4078, 4091, 4104, 4113, 4124, 4135, 4146, 4157,
+    4170, 4181, 4196, 4207, 4222, 4237, 4250, 4261, 4278, 4291, 4308, 4323,
+    4334, 4345, 4356, 4371, 4382, 4395, 4408, 4421, 4432, 4447, 4458, 4473,
+    4484, 4495, 4508, 4523, 4538, 4549, 4564, 4575, 4592, 4605, 4618, 4633,
+    4646, 4661, 4674, 4687, 4702, 4713, 4726, 4739, 4756, 4767, 4780, 4791,
+    4804, 4817, 4826, 4839, 4856, 4865, 4878, 4889, 4902, 4911, 4922, 4935,
+    4950, 4963, 4974, 4989, 5002, 5011, 5024, 5033, 5048, 5061, 5072, 5083,
+    5098, 5109, 5118, 5129, 5140, 5153, 5168, 5179, 5192, 5207, 5218, 5229,
+    5244, 5253, 5268, 5277, 5290, 5299, 5312, 5325, 5336, 5345, 5358, 5369,
+    5380, 5389, 5402, 5415, 5428, 5439, 5452, 5461, 5470, 5483, 5500, 5513,
+    5524, 5537, 5550, 5559, 5572, 5583, 5600, 5613, 5626, 5637, 5652, 5667,
+    5684, 5699, 5714, 5727, 5736, 5751, 5766, 5783, 5792, 5805, 5820, 5833,
+    5848, 5861, 5876, 5889, 5904, 5919, 5934, 5943, 5956, 5969, 5984, 5999,
+    6012, 6029, 6046, 6057, 6072, 6083, 6096, 6109, 6120, 6137, 6152, 6169,
+    6186, 6199, 6216, 6225, 6240, 6249, 6266, 6275, 6290, 6305, 6316, 6329,
+    6344, 6357, 6372, 6383, 6396, 6409, 6426, 6435, 6448, 6463, 6476, 6489,
+    6500, 6511, 6526, 6537, 6550, 6563, 6576, 6587, 6602, 6613, 6624, 6633,
+    6646, 6663, 6674, 6683, 6694, 6709, 6718, 6727, 6736, 6745, 6760, 6773,
+    6786, 6795, 6804, 6813, 6824, 6837, 6848, 6859, 6874, 6885, 6900, 6909,
+    6922, 6937, 6946, 6959, 6974, 6987, 6998, 7009, 7018, 7029, 7042, 7055,
+    7068, 7083, 7092, 7101, 7114, 7129, 7140, 7149, 7158, 7173, 7186, 7199,
+    7212, 7223, 7238, 7249, 7264, 7275, 7284, 7295, 7306, 7317, 7328, 7339,
+    7352, 7361, 7372, 7385, 7398, 7407, 7420, 7431, 7446, 7461, 7474, 7485,
+    7498, 7509, 7524, 7537, 7552, 7567, 7580, 7591, 7604, 7617, 7628, 7643,
+    7654, 7671, 7682, 7695, 7706, 7719, 7730, 7745, 7756, 7771, 7782, 7797,
+    7808, 7821, 7834, 7851, 7866, 7877, 7892, 7901, 7914, 7929, 7946, 7957,
+    7968, 7983, 7998, 8011, 8026, 8041, 8052, 8065, 8078, 8087, 8100, 8113,
+    8122, 8139, 8150, 8163, 8176, 8187, 8198, 8213, 8224, 8235, 8248, 8257,
+    8268, 8277, 8286, 8297, 8310, 8327, 8336, 8349, 8358, 8371, 8386, 8399,
+    8412, 8427, 8440, 8455, 8468, 8481, 8490, 8503, 8512, 8521, 8532, 8541,
+    8556, 8569, 8578, 8587, 8604, 8621, 8630, 8647, 8658, 8673, 8688, 8701,
+    8712, 8721, 8736, 8749, 8762, 8773, 8788, 8803, 8820, 8833, 8848, 8863,
+    8878, 8889, 8906, 8921, 8936, 8953, 8962, 8975, 8988, 8999, 9010, 9023,
+    9038, 9053, 9064, 9073, 9086, 9099, 9112, 9125, 9140, 9151, 9160, 9171,
+    9182, 9195, 9206, 9217, 9226, 9237, 9250, 9267, 9282, 9297, 9312, 9327,
+    9340, 9351, 9362, 9373, 9390, 9403, 9414, 9427, 9442, 9453, 9464, 9477,
+    9492, 9507, 9522, 9537, 9550, 9563, 9576, 9585, 9598, 9613, 9626, 9643,
+    9658, 9669, 9680, 9693, 9706, 9719, 9736, 9745, 9756, 9769, 9780, 9795,
+    9806, 9817, 9832, 9845, 9858, 9869, 9880, 9889, 9904, 9919, 9930, 9945,
+    9958, 9973, 9984, 10001, 10014, 10027, 10040, 10049, 10060, 10073, 10088,
+    10099, 10112, 10125, 10140, 10151, 10164, 10179, 10192, 10203, 10216,
+    10229, 10242, 10255, 10268, 10279, 10290, 10299, 10312, 10321, 10334,
+    10343, 10356, 10369, 10382, 10393, 10404, 10417, 10426, 10437, 10450,
+    10461, 10474, 10489, 10502, 10511, 10524, 10535, 10548, 10559, 10570,
+    10581, 10598, 10613, 10626, 10639, 10652, 10667, 10680, 10693, 10706,
+    10717, 10732, 10747, 10762, 10777, 10794, 10809, 10826, 10843, 10854,
+    10869, 10886, 10901, 10912, 10925, 10940, 10949, 10964, 10975, 10986,
+    10999, 11012, 11023, 11038, 11051, 11066, 11081, 11096, 11109, 11122,
+    11135, 11150, 11163, 11176, 11189, 11200, 11215, 11230, 11239, 11250,
+    11261, 11272, 11281, 11294, 11307, 11320, 11333, 11346, 11359, 11372,
+    11381, 11396, 11411, 11424, 11435, 11446, 11459, 11470, 11483, 11494,
+    11507, 11518, 11529, 11540, 11551, 11568, 11579, 11590, 11601, 11614,
+    11627, 11636, 11649, 11660, 11669, 11680, 11689, 11700, 11717, 11728,
+    11741, 11752, 11765, 11778, 11791, 11802, 11815, 11826, 11837, 11854,
+    11867, 11878, 11889, 11902, 11917, 11930, 11943, 11954, 11967, 11982,
+    11993, 12004, 12017, 12028, 12045, 12056, 12073, 12086, 12095, 12108,
+    12123, 12134, 12145, 12160, 12173, 12186, 12195, 12206, 12217, 12228,
+    12239, 12252, 12261, 12270, 12281, 12292, 12301, 12314, 12327, 12338,
+    12351, 12364, 12377, 12386, 12399, 12408, 12417, 12430, 12439, 12452,
+    12461, 12474, 12487, 12500, 12513, 12524, 12539, 12550, 12565, 12576,
+    12587, 12598, 12609, 12622, 12639, 12650, 12665, 12676, 12689, 12702,
+    12713, 12726, 12741, 12750, 12763, 12780, 12791, 12804, 12819, 12834,
+    12849, 12862, 12871, 12882, 12895, 12908, 12923, 12932, 12945, 12958,
+    12973, 12986, 13001, 13014, 13023, 13034, 13045, 13058, 13071, 13082,
+    13093, 13102, 13119, 13130, 13141, 13156, 13173, 13186, 13201, 13216,
+    13231, 13242, 13255, 13270, 13283, 13296, 13309, 13322, 13335, 13348,
+    13357, 13368, 13381, 13394, 13409, 13422, 13433, 13446, 13461, 13476,
+    13489, 13498, 13513, 13524, 13535, 13544, 13555, 13566, 13579, 13594,
+    13605, 13618, 13631, 13646, 13657, 13672, 13683, 13692, 13709, 13718,
+    13729, 13738, 13747, 13760, 13773, 13784, 13793, 13804, 13815, 13826,
+    13837, 13848, 13863, 13878, 13893, 13910, 13923, 13938, 13949, 13960,
+    13975, 13986, 13997, 14008, 14021, 14032, 14043, 14056, 14067, 14076,
+    14091, 14104, 14117, 14130, 14141, 14150, 14159, 14170, 14181, 14190,
+    14203, 14216, 14231, 14242, 14251, 14262, 14271, 14286, 14301, 14316,
+    14325, 14338, 14351, 14362, 14373, 14384, 14393, 14406, 14415, 14428,
+    14437, 14448, 14461, 14472, 14481, 14492, 14507, 14518, 14527, 14542,
+    14557, 14568, 14579, 14592, 14603, 14618, 14629, 14644, 14657, 14672,
+    14683, 14694, 14705, 14716, 14733, 14746, 14761, 14774, 14789, 14802,
+    14811, 14820, 14831, 14840, 14855, 14866, 14879, 14892, 14905, 14918,
+    14935, 14944, 14955, 14966, 14975, 14984, 14997, 15012, 15023, 15036,
+    15051, 15062, 15073, 15084, 15101, 15118, 15131, 15142, 15159, 15172,
+    15185, 15194, 15207, 15218, 15229, 15238, 15255, 15272, 15287, 15304,
+    15317, 15330, 15341, 15352, 15367, 15380, 15393, 15408, 15419, 15434,
+    15447, 15458, 15469, 15482, 15493, 15504, 15515, 15524, 15535, 15546,
+    15563, 15574, 15589, 15602, 15617, 15628, 15639, 15654, 15665, 15676,
+    15689, 15698, 15711, 15724, 15735, 15748, 15761, 15770, 15781, 15790,
+    15805, 15818, 15835, 15848, 15863, 15872, 15883, 15892, 15905, 15916,
+    15929, 15942, 15957, 15970, 15983, 15996, 16011, 16024, 16033, 16048,
+    16061, 16072, 16085, 16100, 16113, 16126, 16137, 16148, 16161, 16172,
+    16187, 16198, 16213, 16226, 16243, 16252, 16265, 16276, 16287, 16300,
+    16309, 16326, 16337, 16348, 16359, 16370, 16379, 16392, 16405, 16418,
+    16433, 16444, 16457, 16472, 16481, 16494, 16503, 16514, 16527, 16544,
+    16557, 16572, 16583, 16592, 16607, 16620, 16629, 16642, 16651, 16664,
+    16675, 16686, 16695, 16710, 16721, 16730, 16739, 16752, 16763, 16778,
+    16789, 16802, 16817, 16830, 16845, 16858, 16871, 16886, 16901, 16916,
+    16929, 16942, 16953, 16968, 16979, 16990, 17005, 17016, 17031, 17046,
+    17055, 17070, 17083, 17096, 17111, 17124, 17137, 17150, 17165, 17178,
+    17191, 17200, 17215, 17230, 17241, 17256, 17269, 17280, 17295, 17310,
+    17325, 17336, 17351, 17364, 17377, 17388, 17403, 17418, 17429, 17442,
+    17451, 17460, 17473, 17490, 17505, 17522, 17535, 17550, 17563, 17580,
+    17593, 17606, 17617, 17630, 17643, 17660, 17673, 17684, 17699, 17714,
+    17727, 17742, 17759, 17772, 17785, 17800, 17815, 17828, 17839, 17856,
+    17871, 17886, 17901, 17916, 17931, 17946, 17955, 17968, 17981, 17996,
+    18011, 18022, 18037, 18050, 18061, 18074, 18085, 18094, 18105, 18114,
+    18125, 18138, 18147, 18160, 18171, 18186, 18195, 18208, 18219, 18230,
+    18243, 18254, 18265, 18276, 18291, 18304, 18321, 18338, 18351, 18364,
+    18377, 18392, 18405, 18416, 18427, 18440, 18455, 18464, 18479, 18492,
+    18503, 18516, 18529, 18544, 18557, 18574, 18589, 18604, 18617, 18630,
+    18643, 18654, 18665, 18680, 18695, 18710, 18721, 18732, 18747, 18760,
+    18771, 18784, 18795, 18806, 18821, 18830, 18845, 18858, 18869, 18884,
+    18897, 18910, 18923, 18934, 18949, 18964, 18981, 18994, 19009, 19022,
+    19031, 19046, 19063, 19074, 19083, 19098, 19107, 19118, 19131, 19142,
+    19155, 19172, 19183, 19192, 19207, 19216, 19227, 19242, 19253, 19264,
+    19279, 19292, 19305, 19316, 19327, 19336, 19347, 19358, 19369, 19378,
+    19389, 19400, 19409, 19422, 19433, 19446, 19457, 19470, 19481, 19492,
+    19505, 19520, 19533, 19548, 19563, 19578, 19587, 19598, 19611, 19622,
+    19637, 19650, 19661, 19672, 19683, 19692, 19707, 19720, 19733, 19744,
+    19761, 19772, 19787, 19804, 19815, 19828, 19839, 19854, 19867, 19878,
+    19889, 19898, 19911, 19926, 19941, 19956, 19971, 19982, 19991, 20008,
+    20021, 20034, 20051, 20066, 20077, 20090, 20103, 20112, 20125, 20138,
+    20153, 20162, 20175, 20190, 20203, 20216, 20229, 20244, 20255, 20272,
+    20283, 20296, 20309, 20320, 20333, 20346, 20363, 20374, 20389, 20402,
+    20415, 20426, 20439, 20454, 20465, 20478, 20489, 20498, 20509, 20524,
+    20535, 20544, 20557, 20566, 20579, 20590, 20601, 20610, 20621, 20632,
+    20645, 20662, 20671, 20684, 20697, 20714, 20729, 20740, 20751, 20764,
+    20777, 20792, 20801, 20814, 20831, 20842, 20851, 20862, 20873, 20886,
+    20897, 20906, 20923, 20932, 20947, 20958, 20969, 20982, 20995, 21004,
+    21017, 21032, 21047, 21058, 21071, 21082, 21095, 21110, 21125, 21138,
+    21151, 21160, 21171, 21184, 21195, 21206, 21217, 21228, 21241, 21256,
+    21265, 21280, 21295, 21308, 21321, 21334, 21345, 21358, 21367, 21382,
+    21391, 21404, 21417, 21432, 21447, 21462, 21475, 21486, 21497, 21508,
+    21519, 21532, 21541, 21552, 21561, 21572, 21583, 21598, 21607, 21618,
+    21631, 21642, 21653, 21664, 21675, 21686, 21701, 21714, 21725, 21738,
+    21753, 21764, 21775, 21788, 21799, 21812, 21823, 21838, 21849, 21858,
+    21871, 21886, 21897, 21910, 21921, 21932, 21943, 21956, 21971, 21980,
+    21989, 22002, 22013, 22028, 22041, 22054, 22067, 22082, 22091, 22106,
+    22121, 22130, 22141, 22152, 22165, 22176, 22187, 22200, 22209, 22220,
+    22233, 22246, 22257, 22272, 22283, 22300, 22313, 22324, 22335, 22346,
+    22363, 22378, 22393, 22408, 22423, 22434, 22449, 22464, 22477, 22488,
+    22503, 22514, 22523, 22532, 22545, 22558, 22569, 22582, 22593, 22606,
+    22619, 22630, 22639, 22654, 22663, 22678, 22691, 22708, 22717, 22726,
+    22737, 22746, 22757, 22766, 22775, 22786, 22795, 22804, 22815, 22826,
+    22837, 22850, 22863, 22874, 22887, 22898, 22911, 22920, 22929, 22944,
+    22953, 22968, 22983, 22996, 23011, 23024, 23039, 23050, 23061, 23070,
+    23079, 23088, 23097, 23112, 23123, 23136, 23151, 23166, 23175, 23186,
+    23199, 23214, 23227, 23242, 23251, 23262, 23271, 23286, 23303, 23312,
+    23323, 23334, 23349, 23362, 23379, 23394, 23407, 23418, 23431, 23444,
+    23459, 23470, 23481, 23492, 23501, 23514, 23525, 23534, 23547, 23558,
+    23575, 23588, 23597, 23610, 23621, 23634, 23643, 23654, 23667, 23678,
+    23689, 23704, 23719, 23732, 23743, 23752, 23769, 23778, 23789, 23800,
+    23813, 23826, 23837, 23850, 23863, 23872, 23881, 23894, 23907, 23918,
+    23931, 23944, 23953, 23964, 23975, 23988, 24003, 24016, 24031, 24042,
+    24053, 24064, 24079, 24088, 24097, 24110, 24123, 24132, 24143, 24152,
+    24165, 24174, 24189, 24198, 24207, 24224, 24237, 24248, 24259, 24276,
+    24287, 24296, 24309, 24324, 24333, 24344, 24357, 24372, 24387, 24400,
+    24415, 24426, 24439, 24450, 24463, 24474, 24491, 24502, 24517, 24534,
+    24547, 24562, 24573, 24582, 24593, 24606, 24619, 24630, 24641, 24654,
+    24669, 24678, 24689, 24700, 24711, 24724, 24737, 24748, 24761, 24774,
+    24783, 24792, 24803, 24814, 24825, 24834, 24847, 24858, 24867, 24882,
+    24893, 24904, 24915, 24926, 24937, 24946, 24955, 24966, 24977, 24992,
+    25001, 25010, 25027, 25040, 25055, 25068, 25085, 25096, 25111, 25126,
+    25137, 25152, 25165, 25180, 25193, 25206, 25217, 25230, 25241, 25256,
+    25265, 25276, 25285, 25294, 25307, 25320, 25333, 25342, 25351, 25360,
+    25373, 25384, 25395, 25404, 25417, 25432, 25443, 25454, 25463, 25472,
+    25481, 25492, 25505, 25516, 25531, 25544, 25553, 25564, 25577, 25586,
+    25599, 25612, 25627
 };
 
-const dictionary uk =
+const dictionary ru{ ru_words, ru_offsets };
+
+static const char uk_words[] =
+    "абетка\0"
+    "або\0"
+    "абонент\0"
+    "абрикос\0"
+    "аванс\0"
+    "аварія\0"
+    "автор\0"
+    "авіація\0"
+    "агент\0"
+    "аграрій\0"
+    "агрегат\0"
+    "агітатор\0"
+    "адаптер\0"
+    "адвокат\0"
+    "адже\0"
+    "адмірал\0"
+    "адреса\0"
+    "азарт\0"
+    "азбест\0"
+    "азбука\0"
+    "азот\0"
+    "акація\0"
+    "акорд\0"
+    "акрил\0"
+    "акробат\0"
+    "аксіома\0"
+    "акт\0"
+    "актив\0"
+    "актор\0"
+    "актриса\0"
+    "акула\0"
+    "акцент\0"
+    "акція\0"
+    "алгебра\0"
+    "алгоритм\0"
+    "але\0"
+    "алергія\0"
+    "алея\0"
+    "алича\0"
+    "алмаз\0"
+    "альбом\0"
+    "альфа\0"
+    "альянс\0"
+    "амеба\0"
+    "ампер\0"
+    "аналіз\0"
+    "ананас\0"
+    "анархія\0"
+    "ангел\0"
+    "антена\0"
+    "антонім\0"
+    "апельсин\0"
+    "аптека\0"
+    "арбітр\0"
+    "арена\0"
+    "арка\0"
+    "аркуш\0"
+    "армія\0"
+    "аромат\0"
+    "арсенал\0"
+    "архів\0"
+    "асистент\0"
+    "аспект\0"
+    "астма\0"
+    "асфальт\0"
+    "атака\0"
+    "атестат\0"
+    "атлас\0"
+    "атом\0"
+    "атрибут\0"
+    "аудит\0"
+    "аудіо\0"
+    "аукціон\0"
+    "афіша\0"
+    "аіст\0"
+    "баба\0"
+    "бабуся\0"
+    "бавовна\0"
+    "багаж\0"
+    "бажання\0"
+    "базар\0"
+    "базіка\0"
+    "байка\0"
+    "бал\0"
+    "балада\0"
+    "балет\0"
+    "бали\0"
+    "балон\0"
+    "бампер\0"
+    "банан\0"
+    "банда\0"
+    "банер\0"
+    "банк\0"
+    "барабан\0"
+    "барва\0"
+    "барон\0"
+    "басейн\0"
+    "батарея\0"
+    "батько\0"
+    "батіг\0"
+    "бачення\0"
+    "баян\0"
+    "бджола\0"
+    "без\0"
+    "безлад\0"
+    "безпека\0"
+    "бекон\0"
+    "бензин\0"
+    "берег\0"
+    "бесіда\0"
+    "бетон\0"
+    "бик\0"
+    "бинт\0"
+    "благо\0"
+    "ближче\0"
+    "близнюк\0"
+    "блиск\0"
+    "блогер\0"
+    "блок\0"
+    "блондин\0"
+    "блукати\0"
+    "блюдо\0"
+    "блюз\0"
+    "блідий\0"
+    "бобер\0"
+    "боби\0"
+    "бовдур\0"
+    "богатир\0"
+    "бокс\0"
+    "болт\0"
+    "бомба\0"
+    "бондар\0"
+    "бонус\0"
+    "борг\0"
+    "борода\0"
+    "борщ\0"
+    "боулінг\0"
+    "боєць\0"
+    "брага\0"
+    "браслет\0"
+    "брат\0"
+    "бренд\0"
+    "брехня\0"
+    "бринза\0"
+    "брови\0"
+    "брокер\0"
+    "броня\0"
+    "брошура\0"
+    "брудно\0"
+    "брід\0"
+    "бугор\0"
+    "буде\0"
+    "будинок\0"
+    "будка\0"
+    "будні\0"
+    "будова\0"
+    "будівля\0"
+    "бузина\0"
+    "бузок\0"
+    "буйвіл\0"
+    "букет\0"
+    "булава\0"
+    "було\0"
+    "бульба\0"
+    "бункер\0"
+    "бунт\0"
+    "бунчук\0"
+    "бур\0"
+    "буряк\0"
+    "буріння\0"
+    "бути\0"
+    "бутон\0"
+    "буфет\0"
+    "бухта\0"
+    "бюджет\0"
+    "бюро\0"
+    "біблія\0"
+    "бігун\0"
+    "бізнес\0"
+    "бій\0"
+    "бік\0"
+    "бікіні\0"
+    "білий\0"
+    "білка\0"
+    "більше\0"
+    "бінго\0"
+    "біологія\0"
+    "бісер\0"
+    "вага\0"
+    "вагон\0"
+    "важко\0"
+    "важливо\0"
+    "вакуум\0"
+    "вакцина\0"
+    "валовий\0"
+    "валун\0"
+    "валюта\0"
+    "ванна\0"
+    "вантаж\0"
+    "ваніль\0"
+    "вапно\0"
+    "варан\0"
+    "варення\0"
+    "варта\0"
+    "варіант\0"
+    "ватра\0"
+    "вважати\0"
+    "вгору\0"
+    "вдова\0"
+    "вдячний\0"
+    "ведмідь\0"
+    "вежа\0"
+    "великий\0"
+    "верба\0"
+    "верес\0"
+    "версія\0"
+    "верхній\0"
+    "вершник\0"
+    "веселий\0"
+    "весна\0"
+    "весілля\0"
+    "ветеран\0"
+    "вечеря\0"
+    "вечір\0"
+    "вживати\0"
+    "взуття\0"
+    "взяти\0"
+    "вибачте\0"
+    "вибори\0"
+    "вибрати\0"
+    "вибух\0"
+    "вибір\0"
+    "вигадка\0"
+    "вигляд\0"
+    "вигода\0"
+    "виграш\0"
+    "вид\0"
+    "видання\0"
+    "видимий\0"
+    "визнати\0"
+    "виклик\0"
+    "викуп\0"
+    "вилазка\0"
+    "вилка\0"
+    "вимога\0"
+    "винахід\0"
+    "винний\0"
+    "вино\0"
+    "виняток\0"
+    "випадок\0"
+    "виплата\0"
+    "випічка\0"
+    "вираз\0"
+    "вирок\0"
+    "виручка\0"
+    "виріс\0"
+    "висновок\0"
+    "висота\0"
+    "витвір\0"
+    "витрата\0"
+    "витік\0"
+    "вихід\0"
+    "вишня\0"
+    "вище\0"
+    "вищий\0"
+    "виїзд\0"
+    "вказати\0"
+    "вкладка\0"
+    "включно\0"
+    "влада\0"
+    "власник\0"
+    "влучати\0"
+    "вмикач\0"
+    "вміння\0"
+    "вміщати\0"
+    "внесок\0"
+    "вниз\0"
+    "вночі\0"
+    "вовк\0"
+    "вовна\0"
+    "вогнище\0"
+    "вогонь\0"
+    "вода\0"
+    "водень\0"
+    "водний\0"
+    "водій\0"
+    "вокал\0"
+    "волога\0"
+    "вольт\0"
+    "воля\0"
+    "ворог\0"
+    "воїн\0"
+    "вперше\0"
+    "вплив\0"
+    "враження\0"
+    "врода\0"
+    "врожай\0"
+    "все\0"
+    "всесвіт\0"
+    "вставка\0"
+    "всюди\0"
+    "втеча\0"
+    "втома\0"
+    "втрата\0"
+    "вугляр\0"
+    "вуж\0"
+    "вузол\0"
+    "вузький\0"
+    "вулиця\0"
+    "вухо\0"
+    "вхід\0"
+    "вчений\0"
+    "вчинок\0"
+    "вчитель\0"
+    "вчора\0"
+    "вщент\0"
+    "вівця\0"
+    "відбір\0"
+    "відвага\0"
+    "відгук\0"
+    "відділ\0"
+    "відео\0"
+    "відмова\0"
+    "відомий\0"
+    "відсоток\0"
+    "відчути\0"
+    "відьма\0"
+    "віз\0"
+    "візит\0"
+    "візок\0"
+    "військо\0"
+    "вікно\0"
+    "вікінг\0"
+    "вініл\0"
+    "вірус\0"
+    "вірш\0"
+    "вісник\0"
+    "вісті\0"
+    "вісь\0"
+    "вісім\0"
+    "вітання\0"
+    "вітер\0"
+    "вітрило\0"
+    "вічний\0"
+    "вішати\0"
+    "гавань\0"
+    "гадати\0"
+    "гаджет\0"
+    "гадюка\0"
+    "газета\0"
+    "газон\0"
+    "галера\0"
+    "галузь\0"
+    "гальма\0"
+    "гамак\0"
+    "ганьба\0"
+    "гараж\0"
+    "гарбуз\0"
+    "гармата\0"
+    "гарний\0"
+    "гарячо\0"
+    "гасло\0"
+    "гвардія\0"
+    "гвинт\0"
+    "гель\0"
+    "генерал\0"
+    "гени\0"
+    "геном\0"
+    "генсека\0"
+    "геній\0"
+    "гепард\0"
+    "герой\0"
+    "герцог\0"
+    "гетьман\0"
+    "гладкий\0"
+    "глибина\0"
+    "глина\0"
+    "глузд\0"
+    "глухий\0"
+    "глюкоза\0"
+    "глядач\0"
+    "гном\0"
+    "гнів\0"
+    "гніздо\0"
+    "година\0"
+    "голий\0"
+    "голка\0"
+    "голос\0"
+    "гончар\0"
+    "гопак\0"
+    "гора\0"
+    "гордий\0"
+    "горила\0"
+    "горло\0"
+    "гормон\0"
+    "горобець\0"
+    "горщик\0"
+    "горіх\0"
+    "гострий\0"
+    "готель\0"
+    "готовий\0"
+    "гравець\0"
+    "грамота\0"
+    "грант\0"
+    "грати\0"
+    "граф\0"
+    "гребля\0"
+    "гриб\0"
+    "гриль\0"
+    "громада\0"
+    "гроші\0"
+    "грубо\0"
+    "груди\0"
+    "груша\0"
+    "гріх\0"
+    "губа\0"
+    "гукати\0"
+    "гурман\0"
+    "гурт\0"
+    "гуру\0"
+    "гібрид\0"
+    "гігант\0"
+    "гігієна\0"
+    "гілка\0"
+    "гірко\0"
+    "гість\0"
+    "гітара\0"
+    "дайвінг\0"
+    "далеко\0"
+    "далі\0"
+    "даремно\0"
+    "дарма\0"
+    "датчик\0"
+    "дах\0"
+    "дбати\0"
+    "два\0"
+    "двері\0"
+    "двигун\0"
+    "двір\0"
+    "двічі\0"
+    "дебати\0"
+    "дебют\0"
+    "декан\0"
+    "дельта\0"
+    "день\0"
+    "депо\0"
+    "дерево\0"
+    "держава\0"
+    "десять\0"
+    "дефект\0"
+    "дефолт\0"
+    "дефіцит\0"
+    "децибел\0"
+    "дещо\0"
+    "джаз\0"
+    "джем\0"
+    "джерело\0"
+    "джинси\0"
+    "джип\0"
+    "джоуль\0"
+    "джунглі\0"
+    "дзвін\0"
+    "дзеркало\0"
+    "диван\0"
+    "дивний\0"
+    "диво\0"
+    "дивізія\0"
+    "дизайн\0"
+    "дизель\0"
+    "дикий\0"
+    "дикун\0"
+    "дим\0"
+    "димар\0"
+    "динамік\0"
+    "диня\0"
+    "диплом\0"
+    "диск\0"
+    "дисплей\0"
+    "дитина\0"
+    "дитя\0"
+    "дно\0"
+    "доба\0"
+    "добро\0"
+    "довго\0"
+    "довжина\0"
+    "довше\0"
+    "довіра\0"
+    "договір\0"
+    "додаток\0"
+    "дозвіл\0"
+    "доказ\0"
+    "доктор\0"
+    "документ\0"
+    "долар\0"
+    "долина\0"
+    "домашня\0"
+    "домен\0"
+    "домкрат\0"
+    "донор\0"
+    "донька\0"
+    "дорога\0"
+    "доріжка\0"
+    "досада\0"
+    "досвід\0"
+    "досить\0"
+    "доступ\0"
+    "досягти\0"
+    "дотик\0"
+    "доходи\0"
+    "дохід\0"
+    "дошка\0"
+    "дощ\0"
+    "драбина\0"
+    "дракон\0"
+    "драма\0"
+    "друг\0"
+    "дружба\0"
+    "друк\0"
+    "дріт\0"
+    "дуб\0"
+    "дуель\0"
+    "дуже\0"
+    "думати\0"
+    "думка\0"
+    "дурний\0"
+    "душа\0"
+    "дюжина\0"
+    "дюйм\0"
+    "дядько\0"
+    "дякувати\0"
+    "дятел\0"
+    "діабет\0"
+    "діагноз\0"
+    "діалог\0"
+    "діамант\0"
+    "діва\0"
+    "дівка\0"
+    "дівчина\0"
+    "дід\0"
+    "дідусь\0"
+    "дійсно\0"
+    "ділянка\0"
+    "діти\0"
+    "дієвий\0"
+    "дієта\0"
+    "екватор\0"
+    "екзамен\0"
+    "екзотика\0"
+    "екологія\0"
+    "екран\0"
+    "екскурс\0"
+    "експерт\0"
+    "екстра\0"
+    "екіпаж\0"
+    "електрон\0"
+    "елемент\0"
+    "ельф\0"
+    "еліксир\0"
+    "еліпс\0"
+    "еліта\0"
+    "емаль\0"
+    "емоція\0"
+    "емперія\0"
+    "емульсія\0"
+    "емісія\0"
+    "енергія\0"
+    "епос\0"
+    "епоха\0"
+    "епіграф\0"
+    "епізод\0"
+    "епілог\0"
+    "епітет\0"
+    "епічний\0"
+    "ера\0"
+    "ерозія\0"
+    "ерудит\0"
+    "ескорт\0"
+    "ескімо\0"
+    "естет\0"
+    "етап\0"
+    "етика\0"
+    "етичний\0"
+    "етнос\0"
+    "етюд\0"
+    "ефект\0"
+    "ефір\0"
+    "ешелон\0"
+    "жаба\0"
+    "жага\0"
+    "жакет\0"
+    "жало\0"
+    "жаль\0"
+    "жанр\0"
+    "жар\0"
+    "жарт\0"
+    "жати\0"
+    "жах\0"
+    "жебрак\0"
+    "желе\0"
+    "жереб\0"
+    "жертва\0"
+    "жива\0"
+    "живий\0"
+    "живо\0"
+    "живіт\0"
+    "жила\0"
+    "жим\0"
+    "жир\0"
+    "житель\0"
+    "жити\0"
+    "житло\0"
+    "жито\0"
+    "життя\0"
+    "жмут\0"
+    "жовтий\0"
+    "жовч\0"
+    "жолоб\0"
+    "жуйка\0"
+    "журба\0"
+    "журнал\0"
+    "журі\0"
+    "жінка\0"
+    "забава\0"
+    "забутий\0"
+    "завада\0"
+    "завжди\0"
+    "завод\0"
+    "завтра\0"
+    "загар\0"
+    "загроза\0"
+    "задача\0"
+    "задній\0"
+    "зазнати\0"
+    "зазор\0"
+    "зайнято\0"
+    "заклик\0"
+    "закон\0"
+    "зал\0"
+    "залишок\0"
+    "залізо\0"
+    "замок\0"
+    "заміна\0"
+    "запаси\0"
+    "запис\0"
+    "заповіт\0"
+    "запуск\0"
+    "зараз\0"
+    "зарядка\0"
+    "заслуга\0"
+    "заспів\0"
+    "застава\0"
+    "засіб\0"
+    "затока\0"
+    "захист\0"
+    "захід\0"
+    "заявник\0"
+    "заєць\0"
+    "збирати\0"
+    "збиток\0"
+    "збори\0"
+    "зброя\0"
+    "збір\0"
+    "звалище\0"
+    "званий\0"
+    "звичка\0"
+    "звук\0"
+    "звід\0"
+    "згадка\0"
+    "згинати\0"
+    "згодом\0"
+    "зграя\0"
+    "згідно\0"
+    "здавати\0"
+    "здатний\0"
+    "здобути\0"
+    "зелений\0"
+    "земля\0"
+    "зерно\0"
+    "зима\0"
+    "зимно\0"
+    "злам\0"
+    "злива\0"
+    "злий\0"
+    "зло\0"
+    "злодій\0"
+    "злочин\0"
+    "змагання\0"
+    "зміна\0"
+    "зміст\0"
+    "змія\0"
+    "знайти\0"
+    "знання\0"
+    "значно\0"
+    "знижка\0"
+    "знову\0"
+    "знімок\0"
+    "зозуля\0"
+    "зокрема\0"
+    "золото\0"
+    "зоопарк\0"
+    "зоря\0"
+    "зошит\0"
+    "зрада\0"
+    "зразок\0"
+    "зручний\0"
+    "зрілий\0"
+    "зсув\0"
+    "зупинка\0"
+    "зустріч\0"
+    "зібрання\0"
+    "зір\0"
+    "зірка\0"
+    "йогурт\0"
+    "йод\0"
+    "йти\0"
+    "кабель\0"
+    "каблук\0"
+    "кабіна\0"
+    "кава\0"
+    "кавун\0"
+    "кадр\0"
+    "кажан\0"
+    "казати\0"
+    "казино\0"
+    "казка\0"
+    "калина\0"
+    "калорія\0"
+    "кальцій\0"
+    "камера\0"
+    "кампус\0"
+    "камінь\0"
+    "канат\0"
+    "канон\0"
+    "канцлер\0"
+    "каньйон\0"
+    "капелюх\0"
+    "каплиця\0"
+    "капот\0"
+    "капсула\0"
+    "капуста\0"
+    "капці\0"
+    "капітан\0"
+    "карабін\0"
+    "карп\0"
+    "карта\0"
+    "касета\0"
+    "катання\0"
+    "катер\0"
+    "католик\0"
+    "кафе\0"
+    "квадрат\0"
+    "квант\0"
+    "квартира\0"
+    "квасоля\0"
+    "квиток\0"
+    "квітка\0"
+    "кедр\0"
+    "келих\0"
+    "кемпінг\0"
+    "кермо\0"
+    "кетяг\0"
+    "кефір\0"
+    "кидати\0"
+    "кийок\0"
+    "килим\0"
+    "кисень\0"
+    "кислота\0"
+    "кицька\0"
+    "клавіша\0"
+    "клапан\0"
+    "клас\0"
+    "клен\0"
+    "клуб\0"
+    "ключ\0"
+    "клімат\0"
+    "клініка\0"
+    "кліп\0"
+    "кліринг\0"
+    "клітина\0"
+    "клієнт\0"
+    "книга\0"
+    "кнопка\0"
+    "князь\0"
+    "кобза\0"
+    "коваль\0"
+    "ковбой\0"
+    "ковдра\0"
+    "код\0"
+    "кодекс\0"
+    "кожен\0"
+    "кожух\0"
+    "козак\0"
+    "козел\0"
+    "колесо\0"
+    "колиска\0"
+    "коло\0"
+    "кольчуга\0"
+    "колядка\0"
+    "колір\0"
+    "комар\0"
+    "комедія\0"
+    "комфорт\0"
+    "комікс\0"
+    "конгрес\0"
+    "конкурс\0"
+    "консул\0"
+    "контакт\0"
+    "концерт\0"
+    "конюх\0"
+    "копати\0"
+    "копія\0"
+    "корабель\0"
+    "кордон\0"
+    "коридор\0"
+    "корова\0"
+    "корпус\0"
+    "корінь\0"
+    "коса\0"
+    "костюм\0"
+    "котедж\0"
+    "котрий\0"
+    "кохання\0"
+    "кошеня\0"
+    "кошик\0"
+    "кошти\0"
+    "краватка\0"
+    "крадій\0"
+    "край\0"
+    "крамниця\0"
+    "крапля\0"
+    "краса\0"
+    "кратер\0"
+    "краще\0"
+    "країна\0"
+    "кредит\0"
+    "крем\0"
+    "крига\0"
+    "крило\0"
+    "кришка\0"
+    "крок\0"
+    "кролик\0"
+    "круглий\0"
+    "крізь\0"
+    "кулак\0"
+    "культ\0"
+    "куля\0"
+    "купець\0"
+    "купол\0"
+    "купівля\0"
+    "курага\0"
+    "курка\0"
+    "курорт\0"
+    "курс\0"
+    "кут\0"
+    "кухар\0"
+    "кухня\0"
+    "кущ\0"
+    "кільце\0"
+    "кімната\0"
+    "кінець\0"
+    "кінь\0"
+    "кістка\0"
+    "кіт\0"
+    "кітель\0"
+    "кішка\0"
+    "лава\0"
+    "лавина\0"
+    "лагуна\0"
+    "лагідно\0"
+    "лад\0"
+    "лазер\0"
+    "лазур\0"
+    "лазівка\0"
+    "лайка\0"
+    "лама\0"
+    "лампа\0"
+    "ланка\0"
+    "лантух\0"
+    "ланцюг\0"
+    "лань\0"
+    "лапки\0"
+    "ласка\0"
+    "ласо\0"
+    "ласти\0"
+    "лати\0"
+    "латка\0"
+    "латунь\0"
+    "лебідь\0"
+    "лев\0"
+    "легенда\0"
+    "легко\0"
+    "легіон\0"
+    "ледачий\0"
+    "ледве\0"
+    "леді\0"
+    "лезо\0"
+    "лексика\0"
+    "лектор\0"
+    "лекція\0"
+    "лелека\0"
+    "лема\0"
+    "лепеха\0"
+    "лижа\0"
+    "лижня\0"
+    "лимон\0"
+    "липа\0"
+    "липень\0"
+    "липкий\0"
+    "лис\0"
+    "лисий\0"
+    "лист\0"
+    "лихо\0"
+    "лицар\0"
+    "лице\0"
+    "лишок\0"
+    "ловець\0"
+    "логотип\0"
+    "логіка\0"
+    "лоза\0"
+    "лозина\0"
+    "локатор\0"
+    "лом\0"
+    "лопата\0"
+    "лопух\0"
+    "лосось\0"
+    "лось\0"
+    "лотерея\0"
+    "лото\0"
+    "лоша\0"
+    "лощина\0"
+    "луна\0"
+    "лунка\0"
+    "лупа\0"
+    "любов\0"
+    "люди\0"
+    "людно\0"
+    "людство\0"
+    "люк\0"
+    "люкс\0"
+    "люлька\0"
+    "люстра\0"
+    "лютий\0"
+    "ляда\0"
+    "лякати\0"
+    "лялька\0"
+    "ляпас\0"
+    "ліана\0"
+    "лівий\0"
+    "лівша\0"
+    "ліга\0"
+    "лідер\0"
+    "ліжко\0"
+    "лізти\0"
+    "лійка\0"
+    "лікар\0"
+    "лікер\0"
+    "ліки\0"
+    "лікоть\0"
+    "ліліпут\0"
+    "лімфа\0"
+    "ліміт\0"
+    "лінгвіст\0"
+    "лінза\0"
+    "лінощі\0"
+    "лінія\0"
+    "ліпше\0"
+    "ліра\0"
+    "лірика\0"
+    "лірник\0"
+    "ліс\0"
+    "лісовик\0"
+    "літак\0"
+    "літера\0"
+    "літній\0"
+    "літо\0"
+    "ліфт\0"
+    "ліхтар\0"
+    "ліцей\0"
+    "лічба\0"
+    "мабуть\0"
+    "магазин\0"
+    "магніт\0"
+    "магія\0"
+    "мазь\0"
+    "майно\0"
+    "мак\0"
+    "макіяж\0"
+    "малеча\0"
+    "малюнок\0"
+    "маляр\0"
+    "мама\0"
+    "мамонт\0"
+    "мандри\0"
+    "манера\0"
+    "манікюр\0"
+    "марафон\0"
+    "маркер\0"
+    "мармур\0"
+    "марш\0"
+    "масив\0"
+    "маска\0"
+    "масло\0"
+    "материк\0"
+    "мати\0"
+    "матовий\0"
+    "матрос\0"
+    "матуся\0"
+    "машина\0"
+    "меблі\0"
+    "мед\0"
+    "медаль\0"
+    "медик\0"
+    "медіана\0"
+    "межа\0"
+    "мелодія\0"
+    "мельник\0"
+    "менше\0"
+    "меню\0"
+    "мережа\0"
+    "мета\0"
+    "метелик\0"
+    "метод\0"
+    "метро\0"
+    "меч\0"
+    "мийка\0"
+    "милий\0"
+    "мило\0"
+    "милість\0"
+    "минуле\0"
+    "мирно\0"
+    "митний\0"
+    "миттєво\0"
+    "мить\0"
+    "млин\0"
+    "мова\0"
+    "модем\0"
+    "можливо\0"
+    "мозок\0"
+    "мокро\0"
+    "молитва\0"
+    "молоко\0"
+    "момент\0"
+    "монах\0"
+    "монета\0"
+    "моно\0"
+    "монтаж\0"
+    "монумент\0"
+    "монітор\0"
+    "морква\0"
+    "мороз\0"
+    "мотузка\0"
+    "мох\0"
+    "мрія\0"
+    "мудрий\0"
+    "мужність\0"
+    "музей\0"
+    "музика\0"
+    "мураха\0"
+    "мури\0"
+    "мустанг\0"
+    "муха\0"
+    "мідь\0"
+    "мікроб\0"
+    "міксер\0"
+    "мільйон\0"
+    "мінерал\0"
+    "мінус\0"
+    "міністр\0"
+    "міра\0"
+    "міст\0"
+    "місяць\0"
+    "місія\0"
+    "міф\0"
+    "міхур\0"
+    "міцний\0"
+    "мішень\0"
+    "мішок\0"
+    "набрати\0"
+    "набути\0"
+    "навички\0"
+    "навколо\0"
+    "навпаки\0"
+    "навряд\0"
+    "навіть\0"
+    "нагляд\0"
+    "нагота\0"
+    "надія\0"
+    "назад\0"
+    "назва\0"
+    "накидка\0"
+    "належно\0"
+    "намет\0"
+    "намисто\0"
+    "намір\0"
+    "напевно\0"
+    "напрям\0"
+    "напій\0"
+    "наразi\0"
+    "народ\0"
+    "насос\0"
+    "наступ\0"
+    "насіння\0"
+    "натовп\0"
+    "натрій\0"
+    "натяк\0"
+    "наука\0"
+    "нафта\0"
+    "нахаба\0"
+    "нахил\0"
+    "начерк\0"
+    "небо\0"
+    "негайно\0"
+    "неділя\0"
+    "нежить\0"
+    "нейлон\0"
+    "немовля\0"
+    "неон\0"
+    "нерв\0"
+    "нести\0"
+    "нижче\0"
+    "низький\0"
+    "нині\0"
+    "нитка\0"
+    "новий\0"
+    "нога\0"
+    "ножиці\0"
+    "номер\0"
+    "норма\0"
+    "носій\0"
+    "нотатки\0"
+    "ноти\0"
+    "ньютон\0"
+    "нюх\0"
+    "нянька\0"
+    "ніж\0"
+    "ніжний\0"
+    "нікель\0"
+    "ніколи\0"
+    "німий\0"
+    "нічна\0"
+    "нічого\0"
+    "оазис\0"
+    "обачно\0"
+    "оберт\0"
+    "область\0"
+    "облік\0"
+    "обмін\0"
+    "оборот\0"
+    "образ\0"
+    "обрив\0"
+    "обробка\0"
+    "обсяг\0"
+    "обух\0"
+    "обід\0"
+    "овації\0"
+    "овес\0"
+    "овоч\0"
+    "огляд\0"
+    "огірок\0"
+    "один\0"
+    "однак\0"
+    "одяг\0"
+    "ожина\0"
+    "озеро\0"
+    "ознака\0"
+    "озноб\0"
+    "озон\0"
+    "оказія\0"
+    "океан\0"
+    "око\0"
+    "окремо\0"
+    "оксамит\0"
+    "окуляри\0"
+    "окунь\0"
+    "олень\0"
+    "олівець\0"
+    "олія\0"
+    "омана\0"
+    "омар\0"
+    "омела\0"
+    "опади\0"
+    "опера\0"
+    "опис\0"
+    "оплата\0"
+    "оптика\0"
+    "оптом\0"
+    "опікун\0"
+    "опір\0"
+    "орбіта\0"
+    "орган\0"
+    "орден\0"
+    "орел\0"
+    "оренда\0"
+    "оркестр\0"
+    "освіта\0"
+    "оселя\0"
+    "основа\0"
+    "особа\0"
+    "острів\0"
+    "осідати\0"
+    "осінь\0"
+    "отаман\0"
+    "отара\0"
+    "отвір\0"
+    "отже\0"
+    "отрута\0"
+    "офіс\0"
+    "офіцер\0"
+    "охорона\0"
+    "охоче\0"
+    "оцінка\0"
+    "очерет\0"
+    "очі\0"
+    "павук\0"
+    "пагорб\0"
+    "пазли\0"
+    "пакет\0"
+    "палац\0"
+    "палець\0"
+    "паливо\0"
+    "палуба\0"
+    "пальто\0"
+    "паляниця\0"
+    "палітра\0"
+    "пан\0"
+    "панчоха\0"
+    "папаха\0"
+    "папір\0"
+    "парад\0"
+    "парк\0"
+    "паром\0"
+    "партія\0"
+    "пасажир\0"
+    "пасивна\0"
+    "паспорт\0"
+    "паста\0"
+    "пасіка\0"
+    "патруль\0"
+    "пацюк\0"
+    "пацієнт\0"
+    "певно\0"
+    "пейзаж\0"
+    "пекар\0"
+    "пензель\0"
+    "перець\0"
+    "перо\0"
+    "персона\0"
+    "перукар\0"
+    "перший\0"
+    "період\0"
+    "пес\0"
+    "петля\0"
+    "печера\0"
+    "печиво\0"
+    "печінка\0"
+    "пильний\0"
+    "пиріг\0"
+    "писар\0"
+    "питань\0"
+    "плавати\0"
+    "плазма\0"
+    "плакат\0"
+    "план\0"
+    "пластик\0"
+    "плече\0"
+    "плита\0"
+    "площа\0"
+    "плюс\0"
+    "пляж\0"
+    "пляма\0"
+    "поблизу\0"
+    "повага\0"
+    "поверхня\0"
+    "повинен\0"
+    "повний\0"
+    "поворот\0"
+    "повінь\0"
+    "погано\0"
+    "погляд\0"
+    "погода\0"
+    "подача\0"
+    "подвиг\0"
+    "подорож\0"
+    "подруга\0"
+    "подушка\0"
+    "подяка\0"
+    "подія\0"
+    "поезія\0"
+    "поема\0"
+    "позика\0"
+    "покупка\0"
+    "поле\0"
+    "полотно\0"
+    "полуниця\0"
+    "полюс\0"
+    "політ\0"
+    "помідор\0"
+    "понад\0"
+    "поняття\0"
+    "поні\0"
+    "попит\0"
+    "попіл\0"
+    "порада\0"
+    "порив\0"
+    "порох\0"
+    "портал\0"
+    "поруч\0"
+    "порція\0"
+    "порядно\0"
+    "посадка\0"
+    "посилка\0"
+    "послуга\0"
+    "посмішка\0"
+    "посол\0"
+    "постіль\0"
+    "посуд\0"
+    "посібник\0"
+    "потреба\0"
+    "потужно\0"
+    "потяг\0"
+    "потік\0"
+    "почати\0"
+    "почуття\0"
+    "пошта\0"
+    "пошук\0"
+    "поява\0"
+    "пояс\0"
+    "право\0"
+    "прагне\0"
+    "пральня\0"
+    "прапор\0"
+    "праска\0"
+    "праця\0"
+    "предмет\0"
+    "премія\0"
+    "преса\0"
+    "прибій\0"
+    "привид\0"
+    "пригода\0"
+    "приз\0"
+    "прийом\0"
+    "прилад\0"
+    "принц\0"
+    "природа\0"
+    "присмак\0"
+    "приток\0"
+    "причеп\0"
+    "пробка\0"
+    "провал\0"
+    "прогрес\0"
+    "продаж\0"
+    "проект\0"
+    "прокат\0"
+    "проліт\0"
+    "промінь\0"
+    "пророк\0"
+    "просто\0"
+    "проти\0"
+    "профі\0"
+    "прохід\0"
+    "процес\0"
+    "проїзд\0"
+    "пряжа\0"
+    "прямий\0"
+    "прірва\0"
+    "птах\0"
+    "птиця\0"
+    "пузо\0"
+    "пульс\0"
+    "пункт\0"
+    "пустеля\0"
+    "путь\0"
+    "пшениця\0"
+    "пшоно\0"
+    "піаніно\0"
+    "південь\0"
+    "півень\0"
+    "північ\0"
+    "пігулка\0"
+    "підвал\0"
+    "підйом\0"
+    "підлога\0"
+    "підошва\0"
+    "підпис\0"
+    "підхід\0"
+    "пізно\0"
+    "пікнік\0"
+    "пілот\0"
+    "пільги\0"
+    "піна\0"
+    "пінгвін\0"
+    "піонер\0"
+    "пірат\0"
+    "пісня 	\0"
+    "пітон\0"
+    "піч\0"
+    "пішки\0"
+    "равлик\0"
+    "радар\0"
+    "радий\0"
+    "радник\0"
+    "радіо\0"
+    "разом\0"
+    "рай\0"
+    "ракета\0"
+    "рамка\0"
+    "ранг\0"
+    "ранок\0"
+    "ранчо\0"
+    "раніше\0"
+    "раптом\0"
+    "рахунок\0"
+    "реалізм\0"
+    "ребро\0"
+    "регіон\0"
+    "редакція\0"
+    "режим\0"
+    "резерв\0"
+    "резюме\0"
+    "рейс\0"
+    "рельс\0"
+    "ремонт\0"
+    "ремінь\0"
+    "ресурс\0"
+    "рецепт\0"
+    "речі\0"
+    "решта\0"
+    "риба\0"
+    "ризик\0"
+    "рис\0"
+    "ритм\0"
+    "родичі\0"
+    "розвал\0"
+    "розгін\0"
+    "розділ\0"
+    "розкол\0"
+    "розмір\0"
+    "розпад\0"
+    "розрив\0"
+    "розум\0"
+    "ролик\0"
+    "роль\0"
+    "рости\0"
+    "рот\0"
+    "рояль\0"
+    "рубін\0"
+    "рулон\0"
+    "руно\0"
+    "рута\0"
+    "рутина\0"
+    "рух\0"
+    "ручний\0"
+    "рушник\0"
+    "рюкзак\0"
+    "ряд\0"
+    "рядок\0"
+    "рятувати\0"
+    "рідина\0"
+    "рідко\0"
+    "рідне\0"
+    "ріжок\0"
+    "різати\0"
+    "різдво\0"
+    "різке\0"
+    "рік\0"
+    "ріпа\0"
+    "річка\0"
+    "садок\0"
+    "сажа\0"
+    "сазан\0"
+    "салат\0"
+    "сало\0"
+    "сапсан\0"
+    "сапфір\0"
+    "сарай\0"
+    "сатин\0"
+    "сафарі\0"
+    "свиня\0"
+    "свобода\0"
+    "свято\0"
+    "свідок\0"
+    "свіжий\0"
+    "світ\0"
+    "свічка\0"
+    "седан\0"
+    "сезон\0"
+    "секрет\0"
+    "сектор\0"
+    "секунда\0"
+    "селище\0"
+    "сенат\0"
+    "сенс\0"
+    "сервер\0"
+    "сержант\0"
+    "серп\0"
+    "серце\0"
+    "серія\0"
+    "сестра\0"
+    "сигнал\0"
+    "сидіти\0"
+    "сила\0"
+    "сильно\0"
+    "символ\0"
+    "синиця\0"
+    "синтез\0"
+    "синій\0"
+    "сир\0"
+    "система\0"
+    "сито\0"
+    "сканер\0"
+    "скарб\0"
+    "сквер\0"
+    "склад\0"
+    "скло\0"
+    "скриня\0"
+    "скіфи\0"
+    "слава\0"
+    "слайд\0"
+    "слива\0"
+    "слово\0"
+    "слон\0"
+    "слух\0"
+    "сльоза\0"
+    "слід\0"
+    "сліпий\0"
+    "смак\0"
+    "смачно\0"
+    "смерека\0"
+    "смуга\0"
+    "сміх\0"
+    "сніг\0"
+    "собака\0"
+    "собор\0"
+    "сова\0"
+    "сокира\0"
+    "сокіл\0"
+    "солдат\0"
+    "сон\0"
+    "сонце\0"
+    "соняшник\0"
+    "сопілка\0"
+    "сором\0"
+    "сорт\0"
+    "сосна\0"
+    "сотня\0"
+    "соус\0"
+    "союз\0"
+    "спадщина\0"
+    "спалах\0"
+    "спам\0"
+    "спека\0"
+    "список\0"
+    "сплав\0"
+    "спогад\0"
+    "спокій\0"
+    "спорт\0"
+    "справа\0"
+    "спрей\0"
+    "сприяти\0"
+    "спроба\0"
+    "спуск\0"
+    "спів\0"
+    "спільно\0"
+    "срібло\0"
+    "ставок\0"
+    "стажист\0"
+    "стан\0"
+    "старт\0"
+    "стать\0"
+    "стебло\0"
+    "стежка\0"
+    "стеля\0"
+    "стенд\0"
+    "стерео\0"
+    "стиль\0"
+    "стимул\0"
+    "сто\0"
+    "стовп\0"
+    "сторож\0"
+    "стояти\0"
+    "страх\0"
+    "стрес\0"
+    "стрибок\0"
+    "строго\0"
+    "стрічка\0"
+    "студія\0"
+    "ступа\0"
+    "стяг\0"
+    "стіл\0"
+    "стіна\0"
+    "субота\0"
+    "суд\0"
+    "суддя\0"
+    "судно\0"
+    "сукня\0"
+    "сума\0"
+    "сумнів\0"
+    "суміш\0"
+    "супер\0"
+    "сусід\0"
+    "сухий\0"
+    "сфера\0"
+    "схема\0"
+    "схил\0"
+    "сходи\0"
+    "сцена\0"
+    "сьомий\0"
+    "сюжет\0"
+    "сяйво\0"
+    "сідло\0"
+    "сік\0"
+    "сіль\0"
+    "сім\0"
+    "сіно\0"
+    "сірий\0"
+    "січень\0"
+    "табель\0"
+    "табло\0"
+    "табун\0"
+    "табір\0"
+    "таймер\0"
+    "таким\0"
+    "також\0"
+    "таксі\0"
+    "такт\0"
+    "талант\0"
+    "талія\0"
+    "там\0"
+    "танго\0"
+    "танець\0"
+    "танк\0"
+    "танок\0"
+    "таран\0"
+    "тарган\0"
+    "тариф\0"
+    "тато\0"
+    "тату\0"
+    "тварина\0"
+    "твердо\0"
+    "творець\0"
+    "твій\0"
+    "театр\0"
+    "тебе\0"
+    "текст\0"
+    "телефон\0"
+    "теля\0"
+    "тема\0"
+    "тембр\0"
+    "темп\0"
+    "темрява\0"
+    "темінь\0"
+    "тендер\0"
+    "теніс\0"
+    "теорія\0"
+    "тепло\0"
+    "тераса\0"
+    "термін\0"
+    "терор\0"
+    "тест\0"
+    "технік\0"
+    "теча\0"
+    "теща\0"
+    "тигр\0"
+    "тиждень\0"
+    "тип\0"
+    "типово\0"
+    "тираж\0"
+    "тире\0"
+    "тиск\0"
+    "тисяча\0"
+    "титан\0"
+    "титул\0"
+    "тихий\0"
+    "тиша\0"
+    "тобто\0"
+    "товар\0"
+    "товкач\0"
+    "товща\0"
+    "той\0"
+    "токар\0"
+    "токсин\0"
+    "толк\0"
+    "томат\0"
+    "тому\0"
+    "тонкий\0"
+    "тонна\0"
+    "тонус\0"
+    "топка\0"
+    "тополя\0"
+    "торба\0"
+    "торги\0"
+    "торф\0"
+    "тост\0"
+    "точка\0"
+    "точно\0"
+    "трава\0"
+    "тракт\0"
+    "трамвай\0"
+    "транс\0"
+    "трап\0"
+    "тренер\0"
+    "третій\0"
+    "три\0"
+    "тримати\0"
+    "триста\0"
+    "троль\0"
+    "трос\0"
+    "тротуар\0"
+    "трохи\0"
+    "троянда\0"
+    "труба\0"
+    "трюк\0"
+    "трійка\0"
+    "тріумф\0"
+    "туалет\0"
+    "тулуб\0"
+    "туман\0"
+    "тундра\0"
+    "тунель\0"
+    "турбіна\0"
+    "турист\0"
+    "турнір\0"
+    "тюльпан\0"
+    "тютюн\0"
+    "тягар\0"
+    "тягне\0"
+    "тіло\0"
+    "тільки\0"
+    "тінь\0"
+    "тісно\0"
+    "тісто\0"
+    "тітка\0"
+    "убивця\0"
+    "увага\0"
+    "удав\0"
+    "удар\0"
+    "удача\0"
+    "ужиток\0"
+    "узвар\0"
+    "узвіз\0"
+    "узлісок\0"
+    "узор\0"
+    "указ\0"
+    "уклад\0"
+    "укол\0"
+    "укус\0"
+    "улов\0"
+    "ультра\0"
+    "умова\0"
+    "унікум\0"
+    "унісон\0"
+    "унітаз\0"
+    "унія\0"
+    "упор\0"
+    "управа\0"
+    "ура\0"
+    "ураган\0"
+    "уран\0"
+    "урвище\0"
+    "уривок\0"
+    "урок\0"
+    "уряд\0"
+    "усміх\0"
+    "успіх\0"
+    "устрій\0"
+    "утопія\0"
+    "утрата\0"
+    "утіха\0"
+    "ухвала\0"
+    "ухил\0"
+    "участь\0"
+    "учень\0"
+    "уява\0"
+    "уявний\0"
+    "фаза\0"
+    "файл\0"
+    "факт\0"
+    "фальш\0"
+    "фанат\0"
+    "фантом\0"
+    "фарба\0"
+    "фартух\0"
+    "фарфор\0"
+    "фасад\0"
+    "фах\0"
+    "ферма\0"
+    "фея\0"
+    "фланг\0"
+    "флейта\0"
+    "флешка\0"
+    "флора\0"
+    "флот\0"
+    "фляга\0"
+    "флірт\0"
+    "фокус\0"
+    "фонд\0"
+    "фонтан\0"
+    "фора\0"
+    "форель\0"
+    "фортеця\0"
+    "форум\0"
+    "фото\0"
+    "фраза\0"
+    "фрегат\0"
+    "фреска\0"
+    "фронт\0"
+    "фрукт\0"
+    "фтор\0"
+    "фургон\0"
+    "фіалка\0"
+    "фіаско\0"
+    "фігура\0"
+    "фізика\0"
+    "фіксатор\0"
+    "фікція\0"
+    "філе\0"
+    "фільм\0"
+    "філія\0"
+    "фінал\0"
+    "фінік\0"
+    "фіолет\0"
+    "фіранка\0"
+    "фірма\0"
+    "фішка\0"
+    "хабар\0"
+    "халепа\0"
+    "халтура\0"
+    "хан\0"
+    "хаос\0"
+    "хапати\0"
+    "харч\0"
+    "хата\0"
+    "хатина\0"
+    "хвала\0"
+    "хватка\0"
+    "хвиля\0"
+    "хворий\0"
+    "хвоя\0"
+    "хвіртка\0"
+    "хвіст\0"
+    "хиба\0"
+    "хибно\0"
+    "хист\0"
+    "хлопець\0"
+    "хлор\0"
+    "хліб\0"
+    "хлів\0"
+    "хмара\0"
+    "хмуро\0"
+    "хміль\0"
+    "хобот\0"
+    "хомут\0"
+    "хор\0"
+    "хорда\0"
+    "хостел\0"
+    "хотіти\0"
+    "храм\0"
+    "храп\0"
+    "хребет\0"
+    "хрест\0"
+    "хробак\0"
+    "хром\0"
+    "хрущ\0"
+    "хрящ\0"
+    "хрін\0"
+    "хтось\0"
+    "худоба\0"
+    "хутко\0"
+    "хутро\0"
+    "хутір\0"
+    "хіба\0"
+    "хімія\0"
+    "хірург\0"
+    "цар\0"
+    "цариця\0"
+    "цвях\0"
+    "цегла\0"
+    "цемент\0"
+    "цензура\0"
+    "центр\0"
+    "церква\0"
+    "цех\0"
+    "цибуля\0"
+    "цикл\0"
+    "цикорій\0"
+    "цирк\0"
+    "цитата\0"
+    "цитрус\0"
+    "цифра\0"
+    "цукор\0"
+    "цунамі\0"
+    "цятка\0"
+    "цікаво\0"
+    "ціле\0"
+    "цілком\0"
+    "ціна\0"
+    "цінний\0"
+    "чавун\0"
+    "чагар\0"
+    "чадо\0"
+    "чай\0"
+    "чаклун\0"
+    "чапля\0"
+    "чари\0"
+    "чарка\0"
+    "чартер\0"
+    "чарівно\0"
+    "час\0"
+    "часник\0"
+    "часто\0"
+    "чахлий\0"
+    "чаша\0"
+    "чверть\0"
+    "чебрець\0"
+    "чемно\0"
+    "чемодан\0"
+    "чемпіон\0"
+    "червень\0"
+    "черга\0"
+    "через\0"
+    "чесний\0"
+    "честь\0"
+    "четвер\0"
+    "чиж\0"
+    "чимало\0"
+    "чинник\0"
+    "число\0"
+    "чистий\0"
+    "читач\0"
+    "чоботи\0"
+    "чобіт\0"
+    "човен\0"
+    "човник\0"
+    "чоловік\0"
+    "чорне\0"
+    "чотири\0"
+    "чохол\0"
+    "чуб\0"
+    "чудо\0"
+    "чужак\0"
+    "чужий\0"
+    "чути\0"
+    "чутка\0"
+    "чутно\0"
+    "чхати\0"
+    "чіпати\0"
+    "чіпси\0"
+    "чітко\0"
+    "шабля\0"
+    "шайба\0"
+    "шампунь\0"
+    "шанс\0"
+    "шар\0"
+    "шафа\0"
+    "шахи\0"
+    "шахта\0"
+    "швець\0"
+    "швидко\0"
+    "шериф\0"
+    "шерсть\0"
+    "шибка\0"
+    "шина\0"
+    "широко\0"
+    "ширше\0"
+    "шифр\0"
+    "шия\0"
+    "школа\0"
+    "шкіра\0"
+    "шлунок\0"
+    "шлях\0"
+    "шовк\0"
+    "шолом\0"
+    "шорти\0"
+    "шостий\0"
+    "шрам\0"
+    "штани\0"
+    "штик\0"
+    "шторм\0"
+    "штраф\0"
+    "штука\0"
+    "шукач\0"
+    "шум\0"
+    "щастя\0"
+    "щедрий\0"
+    "щирий\0"
+    "щоденник\0"
+    "щодня\0"
+    "щодо\0"
+    "щойно\0"
+    "щука\0"
+    "щур\0"
+    "щітка\0"
+    "ювелір\0"
+    "ювілей\0"
+    "юнак\0"
+    "юнга\0"
+    "юність\0"
+    "юрист\0"
+    "юстиція\0"
+    "юшка\0"
+    "яблуко\0"
+    "явище\0"
+    "явний\0"
+    "явно\0"
+    "явір\0"
+    "ягня\0"
+    "ягода\0"
+    "ягуар\0"
+    "ядро\0"
+    "язик\0"
+    "яйце\0"
+    "який\0"
+    "якщо\0"
+    "якір\0"
+    "якість\0"
+    "ялинка\0"
+    "яма\0"
+    "янтар\0"
+    "ярлик\0"
+    "ярус\0"
+    "ясла\0"
+    "ясно\0"
+    "яструб\0"
+    "яхта\0"
+    "ящик\0"
+    "ящір\0"
+    "яєчня\0"
+    "євнух\0"
+    "єврей\0"
+    "єдиний\0"
+    "їжа\0"
+    "їсти\0"
+    "ідея\0"
+    "імбир\0"
+    "імпорт\0"
+    "індекс\0"
+    "індик\0"
+    "індус\0"
+    "інжир\0"
+    "іноді\0"
+    "інститут\0"
+    "інший\0"
+    "інші\0"
+    "іржа\0"
+    "ірис\0"
+    "іспит\0"
+    "істина\0"
+    "істота";
+
+static const uint16_t uk_offsets[dictionary_size] =
 {
-    {
-        "абетка",
-        "або",
-        "абонент",
-        "абрикос",
-        "аванс",
-        "аварія",
-        "автор",
-        "авіація",
-        "агент",
-        "аграрій",
-        "агрегат",
-        "агітатор",
-        "адаптер",
-        "адвокат",
-        "адже",
-        "адмірал",
-        "адреса",
-        "азарт",
-        "азбест",
-        "азбука",
-        "азот",
-        "акація",
-        "акорд",
-        "акрил",
-        "акробат",
-        "аксіома",
-        "акт",
-        "актив",
-        "актор",
-        "актриса",
-        "акула",
-        "акцент",
-        "акція",
-        "алгебра",
-        "алгоритм",
-        "але",
-        "алергія",
-        "алея",
-        "алича",
-        "алмаз",
-        "альбом",
-        "альфа",
-        "альянс",
-        "амеба",
-        "ампер",
-        "аналіз",
-        "ананас",
-        "анархія",
-        "ангел",
-        "антена",
-        "антонім",
-        "апельсин",
-        "аптека",
-        "арбітр",
-        "арена",
-        "арка",
-        "аркуш",
-        "армія",
-        "аромат",
-        "арсенал",
-        "архів",
-        "асистент",
-        "аспект",
-        "астма",
-        "асфальт",
-        "атака",
-        "атестат",
-        "атлас",
-        "атом",
-        "атрибут",
-        "аудит",
-        "аудіо",
-        "аукціон",
-        "афіша",
-        "аіст",
-        "баба",
-        "бабуся",
-        "бавовна",
-        "багаж",
-        "бажання",
-        "базар",
-        "базіка",
-        "байка",
-        "бал",
-        "балада",
-        "балет",
-        "бали",
-        "балон",
-        "бампер",
-        "банан",
-        "банда",
-        "банер",
-        "банк",
-        "барабан",
-        "барва",
-        "барон",
-        "басейн",
-        "батарея",
-        "батько",
-        "батіг",
-        "бачення",
-        "баян",
-        "бджола",
-        "без",
-        "безлад",
-        "безпека",
-        "бекон",
-        "бензин",
-        "берег",
-        "бесіда",
-        "бетон",
-        "бик",
-        "бинт",
-        "благо",
-        "ближче",
-        "близнюк",
-        "блиск",
-        "блогер",
-        "блок",
-        "блондин",
-        "блукати",
-        "блюдо",
-        "блюз",
-        "блідий",
-        "бобер",
-        "боби",
-        "бовдур",
-        "богатир",
-        "бокс",
-        "болт",
-        "бомба",
-        "бондар",
-        "бонус",
-        "борг",
-        "борода",
-        "борщ",
-        "боулінг",
-        "боєць",
-        "брага",
-        "браслет",
-        "брат",
-        "бренд",
-        "брехня",
-        "бринза",
-        "брови",
-        "брокер",
-        "броня",
-        "брошура",
-        "брудно",
-        "брід",
-        "бугор",
-        "буде",
-        "будинок",
-        "будка",
-        "будні",
-        "будова",
-        "будівля",
-        "бузина",
-        "бузок",
-        "буйвіл",
-        "букет",
-        "булава",
-        "було",
-        "бульба",
-        "бункер",
-        "бунт",
-        "бунчук",
-        "бур",
-        "буряк",
-        "буріння",
-        "бути",
-        "бутон",
-        "буфет",
-        "бухта",
-        "бюджет",
-        "бюро",
-        "біблія",
-        "бігун",
-        "бізнес",
-        "бій",
-        "бік",
-        "бікіні",
-        "білий",
-        "білка",
-        "більше",
-        "бінго",
-        "біологія",
-        "бісер",
-        "вага",
-        "вагон",
-        "важко",
-        "важливо",
-        "вакуум",
-        "вакцина",
-        "валовий",
-        "валун",
-        "валюта",
-        "ванна",
-        "вантаж",
-        "ваніль",
-        "вапно",
-        "варан",
-        "варення",
-        "варта",
-        "варіант",
-        "ватра",
-        "вважати",
-        "вгору",
-        "вдова",
-        "вдячний",
-        "ведмідь",
-        "вежа",
-        "великий",
-        "верба",
-        "верес",
-        "версія",
-        "верхній",
-        "вершник",
-        "веселий",
-        "весна",
-        "весілля",
-        "ветеран",
-        "вечеря",
-        "вечір",
-        "вживати",
-        "взуття",
-        "взяти",
-        "вибачте",
-        "вибори",
-        "вибрати",
-        "вибух",
-        "вибір",
-        "вигадка",
-        "вигляд",
-        "вигода",
-        "виграш",
-        "вид",
-        "видання",
-        "видимий",
-        "визнати",
-        "виклик",
-        "викуп",
-        "вилазка",
-        "вилка",
-        "вимога",
-        "винахід",
-        "винний",
-        "вино",
-        "виняток",
-        "випадок",
-        "виплата",
-        "випічка",
-        "вираз",
-        "вирок",
-        "виручка",
-        "виріс",
-        "висновок",
-        "висота",
-        "витвір",
-        "витрата",
-        "витік",
-        "вихід",
-        "вишня",
-        "вище",
-        "вищий",
-        "виїзд",
-        "вказати",
-        "вкладка",
-        "включно",
-        "влада",
-        "власник",
-        "влучати",
-        "вмикач",
-        "вміння",
-        "вміщати",
-        "внесок",
-        "вниз",
-        "вночі",
-        "вовк",
-        "вовна",
-        "вогнище",
-        "вогонь",
-        "вода",
-        "водень",
-        "водний",
-        "водій",
-        "вокал",
-        "волога",
-        "вольт",
-        "воля",
-        "ворог",
-        "воїн",
-        "вперше",
-        "вплив",
-        "враження",
-        "врода",
-        "врожай",
-        "все",
-        "всесвіт",
-        "вставка",
-        "всюди",
-        "втеча",
-        "втома",
-        "втрата",
-        "вугляр",
-        "вуж",
-        "вузол",
-        "вузький",
-        "вулиця",
-        "вухо",
-        "вхід",
-        "вчений",
-        "вчинок",
-        "вчитель",
-        "вчора",
-        "вщент",
-        "вівця",
-        "відбір",
-        "відвага",
-        "відгук",
-        "відділ",
-        "відео",
-        "відмова",
-        "відомий",
-        "відсоток",
-        "відчути",
-        "відьма",
-        "віз",
-        "візит",
-        "візок",
-        "військо",
-        "вікно",
-        "вікінг",
-        "вініл",
-        "вірус",
-        "вірш",
-        "вісник",
-        "вісті",
-        "вісь",
-        "вісім",
-        "вітання",
-        "вітер",
-        "вітрило",
-        "вічний",
-        "вішати",
-        "гавань",
-        "гадати",
-        "гаджет",
-        "гадюка",
-        "газета",
-        "газон",
-        "галера",
-        "галузь",
-        "гальма",
-        "гамак",
-        "ганьба",
-        "гараж",
-        "гарбуз",
-        "гармата",
-        "гарний",
-        "гарячо",
-        "гасло",
-        "гвардія",
-        "гвинт",
-        "гель",
-        "генерал",
-        "гени",
-        "геном",
-        "генсека",
-        "геній",
-        "гепард",
-        "герой",
-        "герцог",
-        "гетьман",
-        "гладкий",
-        "глибина",
-        "глина",
-        "глузд",
-        "глухий",
-        "глюкоза",
-        "глядач",
-        "гном",
-        "гнів",
-        "гніздо",
-        "година",
-        "голий",
-        "голка",
-        "голос",
-        "гончар",
-        "гопак",
-        "гора",
-        "гордий",
-        "горила",
-        "горло",
-        "гормон",
-        "горобець",
-        "горщик",
-        "горіх",
-        "гострий",
-        "готель",
-        "готовий",
-        "гравець",
-        "грамота",
-        "грант",
-        "грати",
-        "граф",
-        "гребля",
-        "гриб",
-        "гриль",
-        "громада",
-        "гроші",
-        "грубо",
-        "груди",
-        "груша",
-        "гріх",
-        "губа",
-        "гукати",
-        "гурман",
-        "гурт",
-        "гуру",
-        "гібрид",
-        "гігант",
-        "гігієна",
-        "гілка",
-        "гірко",
-        "гість",
-        "гітара",
-        "дайвінг",
-        "далеко",
-        "далі",
-        "даремно",
-        "дарма",
-        "датчик",
-        "дах",
-        "дбати",
-        "два",
-        "двері",
-        "двигун",
-        "двір",
-        "двічі",
-        "дебати",
-        "дебют",
-        "декан",
-        "дельта",
-        "день",
-        "депо",
-        "дерево",
-        "держава",
-        "десять",
-        "дефект",
-        "дефолт",
-        "дефіцит",
-        "децибел",
-        "дещо",
-        "джаз",
-        "джем",
-        "джерело",
-        "джинси",
-        "джип",
-        "джоуль",
-        "джунглі",
-        "дзвін",
-        "дзеркало",
-        "диван",
-        "дивний",
-        "диво",
-        "дивізія",
-        "дизайн",
-        "дизель",
-        "дикий",
-        "дикун",
-        "дим",
-        "димар",
-        "динамік",
-        "диня",
-        "диплом",
-        "диск",
-        "дисплей",
-        "дитина",
-        "дитя",
-        "дно",
-        "доба",
-        "добро",
-        "довго",
-        "довжина",
-        "довше",
-        "довіра",
-        "договір",
-        "додаток",
-        "дозвіл",
-        "доказ",
-        "доктор",
-        "документ",
-        "долар",
-        "долина",
-        "домашня",
-        "домен",
-        "домкрат",
-        "донор",
-        "донька",
-        "дорога",
-        "доріжка",
-        "досада",
-        "досвід",
-        "досить",
-        "доступ",
-        "досягти",
-        "дотик",
-        "доходи",
-        "дохід",
-        "дошка",
-        "дощ",
-        "драбина",
-        "дракон",
-        "драма",
-        "друг",
-        "дружба",
-        "друк",
-        "дріт",
-        "дуб",
-        "дуель",
-        "дуже",
-        "думати",
-        "думка",
-        "дурний",
-        "душа",
-        "дюжина",
-        "дюйм",
-        "дядько",
-        "дякувати",
-        "дятел",
-        "діабет",
-        "діагноз",
-        "діалог",
-        "діамант",
-        "діва",
-        "дівка",
-        "дівчина",
-        "дід",
-        "дідусь",
-        "дійсно",
-        "ділянка",
-        "діти",
-        "дієвий",
-        "дієта",
-        "екватор",
-        "екзамен",
-        "екзотика",
-        "екологія",
-        "екран",
-        "екскурс",
-        "експерт",
-        "екстра",
-        "екіпаж",
-        "електрон",
-        "елемент",
-        "ельф",
-        "еліксир",
-        "еліпс",
-        "еліта",
-        "емаль",
-        "емоція",
-        "емперія",
-        "емульсія",
-        "емісія",
-        "енергія",
-        "епос",
-        "епоха",
-        "епіграф",
-        "епізод",
-        "епілог",
-        "епітет",
-        "епічний",
-        "ера",
-        "ерозія",
-        "ерудит",
-        "ескорт",
-        "ескімо",
-        "естет",
-        "етап",
-        "етика",
-        "етичний",
-        "етнос",
-        "етюд",
-        "ефект",
-        "ефір",
-        "ешелон",
-        "жаба",
-        "жага",
-        "жакет",
-        "жало",
-        "жаль",
-        "жанр",
-        "жар",
-        "жарт",
-        "жати",
-        "жах",
-        "жебрак",
-        "желе",
-        "жереб",
-        "жертва",
-        "жива",
-        "живий",
-        "живо",
-        "живіт",
-        "жила",
-        "жим",
-        "жир",
-        "житель",
-        "жити",
-        "житло",
-        "жито",
-        "життя",
-        "жмут",
-        "жовтий",
-        "жовч",
-        "жолоб",
-        "жуйка",
-        "журба",
-        "журнал",
-        "журі",
-        "жінка",
-        "забава",
-        "забутий",
-        "завада",
-        "завжди",
-        "завод",
-        "завтра",
-        "загар",
-        "загроза",
-        "задача",
-        "задній",
-        "зазнати",
-        "зазор",
-        "зайнято",
-        "заклик",
-        "закон",
-        "зал",
-        "залишок",
-        "залізо",
-        "замок",
-        "заміна",
-        "запаси",
-        "запис",
-        "заповіт",
-        "запуск",
-        "зараз",
-        "зарядка",
-        "заслуга",
-        "заспів",
-        "застава",
-        "засіб",
-        "затока",
-        "захист",
-        "захід",
-        "заявник",
-        "заєць",
-        "збирати",
-        "збиток",
-        "збори",
-        "зброя",
-        "збір",
-        "звалище",
-        "званий",
-        "звичка",
-        "звук",
-        "звід",
-        "згадка",
-        "згинати",
-        "згодом",
-        "зграя",
-        "згідно",
-        "здавати",
-        "здатний",
-        "здобути",
-        "зелений",
-        "земля",
-        "зерно",
-        "зима",
-        "зимно",
-        "злам",
-        "злива",
-        "злий",
-        "зло",
-        "злодій",
-        "злочин",
-        "змагання",
-        "зміна",
-        "зміст",
-        "змія",
-        "знайти",
-        "знання",
-        "значно",
-        "знижка",
-        "знову",
-        "знімок",
-        "зозуля",
-        "зокрема",
-        "золото",
-        "зоопарк",
-        "зоря",
-        "зошит",
-        "зрада",
-        "зразок",
-        "зручний",
-        "зрілий",
-        "зсув",
-        "зупинка",
-        "зустріч",
-        "зібрання",
-        "зір",
-        "зірка",
-        "йогурт",
-        "йод",
-        "йти",
-        "кабель",
-        "каблук",
-        "кабіна",
-        "кава",
-        "кавун",
-        "кадр",
-        "кажан",
-        "казати",
-        "казино",
-        "казка",
-        "калина",
-        "калорія",
-        "кальцій",
-        "камера",
-        "кампус",
-        "камінь",
-        "канат",
-        "канон",
-        "канцлер",
-        "каньйон",
-        "капелюх",
-        "каплиця",
-        "капот",
-        "капсула",
-        "капуста",
-        "капці",
-        "капітан",
-        "карабін",
-        "карп",
-        "карта",
-        "касета",
-        "катання",
-        "катер",
-        "католик",
-        "кафе",
-        "квадрат",
-        "квант",
-        "квартира",
-        "квасоля",
-        "квиток",
-        "квітка",
-        "кедр",
-        "келих",
-        "кемпінг",
-        "кермо",
-        "кетяг",
-        "кефір",
-        "кидати",
-        "кийок",
-        "килим",
-        "кисень",
-        "кислота",
-        "кицька",
-        "клавіша",
-        "клапан",
-        "клас",
-        "клен",
-        "клуб",
-        "ключ",
-        "клімат",
-        "клініка",
-        "кліп",
-        "кліринг",
-        "клітина",
-        "клієнт",
-        "книга",
-        "кнопка",
-        "князь",
-        "кобза",
-        "коваль",
-        "ковбой",
-        "ковдра",
-        "код",
-        "кодекс",
-        "кожен",
-        "кожух",
-        "козак",
-        "козел",
-        "колесо",
-        "колиска",
-        "коло",
-        "кольчуга",
-        "колядка",
-        "колір",
-        "комар",
-        "комедія",
-        "комфорт",
-        "комікс",
-        "конгрес",
-        "конкурс",
-        "консул",
-        "контакт",
-        "концерт",
-        "конюх",
-        "копати",
-        "копія",
-        "корабель",
-        "кордон",
-        "коридор",
-        "корова",
-        "корпус",
-        "корінь",
-        "коса",
-        "костюм",
-        "котедж",
-        "котрий",
-        "кохання",
-        "кошеня",
-        "кошик",
-        "кошти",
-        "краватка",
-        "крадій",
-        "край",
-        "крамниця",
-        "крапля",
-        "краса",
-        "кратер",
-        "краще",
-        "країна",
-        "кредит",
-        "крем",
-        "крига",
-        "крило",
-        "кришка",
-        "крок",
-        "кролик",
-        "круглий",
-        "крізь",
-        "кулак",
-        "культ",
-        "куля",
-        "купець",
-        "купол",
-        "купівля",
-        "курага",
-        "курка",
-        "курорт",
-        "курс",
-        "кут",
-        "кухар",
-        "кухня",
-        "кущ",
-        "кільце",
-        "кімната",
-        "кінець",
-        "кінь",
-        "кістка",
-        "кіт",
-        "кітель",
-        "кішка",
-        "лава",
-        "лавина",
-        "лагуна",
-        "лагідно",
-        "лад",
-        "лазер",
-        "лазур",
-        "лазівка",
-        "лайка",
-        "лама",
-        "лампа",
-        "ланка",
-        "лантух",
-        "ланцюг",
-        "лань",
-        "лапки",
-        "ласка",
-        "ласо",
-        "ласти",
-        "лати",
-        "латка",
-        "латунь",
-        "лебідь",
-        "лев",
-        "легенда",
-        "легко",
-        "легіон",
-        "ледачий",
-        "ледве",
-        "леді",
-        "лезо",
-        "лексика",
-        "лектор",
-        "лекція",
-        "лелека",
-        "лема",
-        "лепеха",
-        "лижа",
-        "лижня",
-        "лимон",
-        "липа",
-        "липень",
-        "липкий",
-        "лис",
-        "лисий",
-        "лист",
-        "лихо",
-        "лицар",
-        "лице",
-        "лишок",
-        "ловець",
-        "логотип",
-        "логіка",
-        "лоза",
-        "лозина",
-        "локатор",
-        "лом",
-        "лопата",
-        "лопух",
-        "лосось",
-        "лось",
-        "лотерея",
-        "лото",
-        "лоша",
-        "лощина",
-        "луна",
-        "лунка",
-        "лупа",
-        "любов",
-        "люди",
-        "людно",
-        "людство",
-        "люк",
-        "люкс",
-        "люлька",
-        "люстра",
-        "лютий",
-        "ляда",
-        "лякати",
-        "лялька",
-        "ляпас",
-        "ліана",
-        "лівий",
-        "лівша",
-        "ліга",
-        "лідер",
-        "ліжко",
-        "лізти",
-        "лійка",
-        "лікар",
-        "лікер",
-        "ліки",
-        "лікоть",
-        "ліліпут",
-        "лімфа",
-        "ліміт",
-        "лінгвіст",
-        "лінза",
-        "лінощі",
-        "лінія",
-        "ліпше",
-        "ліра",
-        "лірика",
-        "лірник",
-        "ліс",
-        "лісовик",
-        "літак",
-        "літера",
-        "літній",
-        "літо",
-        "ліфт",
-        "ліхтар",
-        "ліцей",
-        "лічба",
-        "мабуть",
-        "магазин",
-        "магніт",
-        "магія",
-        "мазь",
-        "майно",
-        "мак",
-        "макіяж",
-        "малеча",
-        "малюнок",
-        "маляр",
-        "мама",
-        "мамонт",
-        "мандри",
-        "манера",
-        "манікюр",
-        "марафон",
-        "маркер",
-        "мармур",
-        "марш",
-        "масив",
-        "маска",
-        "масло",
-        "материк",
-        "мати",
-        "матовий",
-        "матрос",
-        "матуся",
-        "машина",
-        "меблі",
-        "мед",
-        "медаль",
-        "медик",
-        "медіана",
-        "межа",
-        "мелодія",
-        "мельник",
-        "менше",
-        "меню",
-        "мережа",
-        "мета",
-        "метелик",
-        "метод",
-        "метро",
-        "меч",
-        "мийка",
-        "милий",
-        "мило",
-        "милість",
-        "минуле",
-        "мирно",
-        "митний",
-        "миттєво",
-        "мить",
-        "млин",
-        "мова",
-        "модем",
-        "можливо",
-        "мозок",
-        "мокро",
-        "молитва",
-        "молоко",
-        "момент",
-        "монах",
-        "монета",
-        "моно",
-        "монтаж",
-        "монумент",
-        "монітор",
-        "морква",
-        "мороз",
-        "мотузка",
-        "мох",
-        "мрія",
-        "мудрий",
-        "мужність",
-        "музей",
-        "музика",
-        "мураха",
-        "мури",
-        "мустанг",
-        "муха",
-        "мідь",
-        "мікроб",
-        "міксер",
-        "мільйон",
-        "мінерал",
-        "мінус",
-        "міністр",
-        "міра",
-        "міст",
-        "місяць",
-        "місія",
-        "міф",
-        "міхур",
-        "міцний",
-        "мішень",
-        "мішок",
-        "набрати",
-        "набути",
-        "навички",
-        "навколо",
-        "навпаки",
-        "навряд",
-        "навіть",
-        "нагляд",
-        "нагота",
-        "надія",
-        "назад",
-        "назва",
-        "накидка",
-        "належно",
-        "намет",
-        "намисто",
-        "намір",
-        "напевно",
-        "напрям",
-        "напій",
-        "наразi",
-        "народ",
-        "насос",
-        "наступ",
-        "насіння",
-        "натовп",
-        "натрій",
-        "натяк",
-        "наука",
-        "нафта",
-        "нахаба",
-        "нахил",
-        "начерк",
-        "небо",
-        "негайно",
-        "неділя",
-        "нежить",
-        "нейлон",
-        "немовля",
-        "неон",
-        "нерв",
-        "нести",
-        "нижче",
-        "низький",
-        "нині",
-        "нитка",
-        "новий",
-        "нога",
-        "ножиці",
-        "номер",
-        "норма",
-        "носій",
-        "нотатки",
-        "ноти",
-        "ньютон",
-        "нюх",
-        "нянька",
-        "ніж",
-        "ніжний",
-        "нікель",
-        "ніколи",
-        "німий",
-        "нічна",
-        "нічого",
-        "оазис",
-        "обачно",
-        "оберт",
-        "область",
-        "облік",
-        "обмін",
-        "оборот",
-        "образ",
-        "обрив",
-        "обробка",
-        "обсяг",
-        "обух",
-        "обід",
-        "овації",
-        "овес",
-        "овоч",
-        "огляд",
-        "огірок",
-        "один",
-        "однак",
-        "одяг",
-        "ожина",
-        "озеро",
-        "ознака",
-        "озноб",
-        "озон",
-        "оказія",
-        "океан",
-        "око",
-        "окремо",
-        "оксамит",
-        "окуляри",
-        "окунь",
-        "олень",
-        "олівець",
-        "олія",
-        "омана",
-        "омар",
-        "омела",
-        "опади",
-        "опера",
-        "опис",
-        "оплата",
-        "оптика",
-        "оптом",
-        "опікун",
-        "опір",
-        "орбіта",
-        "орган",
-        "орден",
-        "орел",
-        "оренда",
-        "оркестр",
-        "освіта",
-        "оселя",
-        "основа",
-        "особа",
-        "острів",
-        "осідати",
-        "осінь",
-        "отаман",
-        "отара",
-        "отвір",
-        "отже",
-        "отрута",
-        "офіс",
-        "офіцер",
-        "охорона",
-        "охоче",
-        "оцінка",
-        "очерет",
-        "очі",
-        "павук",
-        "пагорб",
-        "пазли",
-        "пакет",
-        "палац",
-        "палець",
-        "паливо",
-        "палуба",
-        "пальто",
-        "паляниця",
-        "палітра",
-        "пан",
-        "панчоха",
-        "папаха",
-        "папір",
-        "парад",
-        "парк",
-        "паром",
-        "партія",
-        "пасажир",
-        "пасивна",
-        "паспорт",
-        "паста",
-        "пасіка",
-        "патруль",
-        "пацюк",
-        "пацієнт",
-        "певно",
-        "пейзаж",
-        "пекар",
-        "пензель",
-        "перець",
-        "перо",
-        "персона",
-        "перукар",
-        "перший",
-        "період",
-        "пес",
-        "петля",
-        "печера",
-        "печиво",
-        "печінка",
-        "пильний",
-        "пиріг",
-        "писар",
-        "питань",
-        "плавати",
-        "плазма",
-        "плакат",
-        "план",
-        "пластик",
-        "плече",
-        "плита",
-        "площа",
-        "плюс",
-        "пляж",
-        "пляма",
-        "поблизу",
-        "повага",
-        "поверхня",
-        "повинен",
-        "повний",
-        "поворот",
-        "повінь",
-        "погано",
-        "погляд",
-        "погода",
-        "подача",
-        "подвиг",
-        "подорож",
-        "подруга",
-        "подушка",
-        "подяка",
-        "подія",
-        "поезія",
-        "поема",
-        "позика",
-        "покупка",
-        "поле",
-        "полотно",
-        "полуниця",
-        "полюс",
-        "політ",
-        "помідор",
-        "понад",
-        "поняття",
-        "поні",
-        "попит",
-        "попіл",
-        "порада",
-        "порив",
-        "порох",
-        "портал",
-        "поруч",
-        "порція",
-        "порядно",
-        "посадка",
-        "посилка",
-        "послуга",
-        "посмішка",
-        "посол",
-        "постіль",
-        "посуд",
-        "посібник",
-        "потреба",
-        "потужно",
-        "потяг",
-        "потік",
-        "почати",
-        "почуття",
-        "пошта",
-        "пошук",
-        "поява",
-        "пояс",
-        "право",
-        "прагне",
-        "пральня",
-        "прапор",
-        "праска",
-        "праця",
-        "предмет",
-        "премія",
-        "преса",
-        "прибій",
-        "привид",
-        "пригода",
-        "приз",
-        "прийом",
-        "прилад",
-        "принц",
-        "природа",
-        "присмак",
-        "приток",
-        "причеп",
-        "пробка",
-        "провал",
-        "прогрес",
-        "продаж",
-        "проект",
-        "прокат",
-        "проліт",
-        "промінь",
-        "пророк",
-        "просто",
-        "проти",
-        "профі",
-        "прохід",
-        "процес",
-        "проїзд",
-        "пряжа",
-        "прямий",
-        "прірва",
-        "птах",
-        "птиця",
-        "пузо",
-        "пульс",
-        "пункт",
-        "пустеля",
-        "путь",
-        "пшениця",
-        "пшоно",
-        "піаніно",
-        "південь",
-        "півень",
-        "північ",
-        "пігулка",
-        "підвал",
-        "підйом",
-        "підлога",
-        "підошва",
-        "підпис",
-        "підхід",
-        "пізно",
-        "пікнік",
-        "пілот",
-        "пільги",
-        "піна",
-        "пінгвін",
-        "піонер",
-        "пірат",
-        "пісня 	",
-        "пітон",
-        "піч",
-        "пішки",
-        "равлик",
-        "радар",
-        "радий",
-        "радник",
-        "радіо",
-        "разом",
-        "рай",
-        "ракета",
-        "рамка",
-        "ранг",
-        "ранок",
-        "ранчо",
-        "раніше",
-        "раптом",
-        "рахунок",
-        "реалізм",
-        "ребро",
-        "регіон",
-        "редакція",
-        "режим",
-        "резерв",
-        "резюме",
-        "рейс",
-        "рельс",
-        "ремонт",
-        "ремінь",
-        "ресурс",
-        "рецепт",
-        "речі",
-        "решта",
-        "риба",
-        "ризик",
-        "рис",
-        "ритм",
-        "родичі",
-        "розвал",
-        "розгін",
-        "розділ",
-        "розкол",
-        "розмір",
-        "розпад",
-        "розрив",
-        "розум",
-        "ролик",
-        "роль",
-        "рости",
-        "рот",
-        "рояль",
-        "рубін",
-        "рулон",
-        "руно",
-        "рута",
-        "рутина",
-        "рух",
-        "ручний",
-        "рушник",
-        "рюкзак",
-        "ряд",
-        "рядок",
-        "рятувати",
-        "рідина",
-        "рідко",
-        "рідне",
-        "ріжок",
-        "різати",
-        "різдво",
-        "різке",
-        "рік",
-        "ріпа",
-        "річка",
-        "садок",
-        "сажа",
-        "сазан",
-        "салат",
-        "сало",
-        "сапсан",
-        "сапфір",
-        "сарай",
-        "сатин",
-        "сафарі",
-        "свиня",
-        "свобода",
-        "свято",
-        "свідок",
-        "свіжий",
-        "світ",
-        "свічка",
-        "седан",
-        "сезон",
-        "секрет",
-        "сектор",
-        "секунда",
-        "селище",
-        "сенат",
-        "сенс",
-        "сервер",
-        "сержант",
-        "серп",
-        "серце",
-        "серія",
-        "сестра",
-        "сигнал",
-        "сидіти",
-        "сила",
-        "сильно",
-        "символ",
-        "синиця",
-        "синтез",
-        "синій",
-        "сир",
-        "система",
-        "сито",
-        "сканер",
-        "скарб",
-        "сквер",
-        "склад",
-        "скло",
-        "скриня",
-        "скіфи",
-        "слава",
-        "слайд",
-        "слива",
-        "слово",
-        "слон",
-        "слух",
-        "сльоза",
-        "слід",
-        "сліпий",
-        "смак",
-        "смачно",
-        "смерека",
-        "смуга",
-        "сміх",
-        "сніг",
-        "собака",
-        "собор",
-        "сова",
-        "сокира",
-        "сокіл",
-        "солдат",
-        "сон",
-        "сонце",
-        "соняшник",
-        "сопілка",
-        "сором",
-        "сорт",
-        "сосна",
-        "сотня",
-        "соус",
-        "союз",
-        "спадщина",
-        "спалах",
-        "спам",
-        "спека",
-        "список",
-        "сплав",
-        "спогад",
-        "спокій",
-        "спорт",
-        "справа",
-        "спрей",
-        "сприяти",
-        "спроба",
-        "спуск",
-        "спів",
-        "спільно",
-        "срібло",
-        "ставок",
-        "стажист",
-        "стан",
-        "старт",
-        "стать",
-        "стебло",
-        "стежка",
-        "стеля",
-        "стенд",
-        "стерео",
-        "стиль",
-        "стимул",
-        "сто",
-        "стовп",
-        "сторож",
-        "стояти",
-        "страх",
-        "стрес",
-        "стрибок",
-        "строго",
-        "стрічка",
-        "студія",
-        "ступа",
-        "стяг",
-        "стіл",
-        "стіна",
-        "субота",
-        "суд",
-        "суддя",
-        "судно",
-        "сукня",
-        "сума",
-        "сумнів",
-        "суміш",
-        "супер",
-        "сусід",
-        "сухий",
-        "сфера",
-        "схема",
-        "схил",
-        "сходи",
-        "сцена",
-        "сьомий",
-        "сюжет",
-        "сяйво",
-        "сідло",
-        "сік",
-        "сіль",
-        "сім",
-        "сіно",
-        "сірий",
-        "січень",
-        "табель",
-        "табло",
-        "табун",
-        "табір",
-        "таймер",
-        "таким",
-        "також",
-        "таксі",
-        "такт",
-        "талант",
-        "талія",
-        "там",
-        "танго",
-        "танець",
-        "танк",
-        "танок",
-        "таран",
-        "тарган",
-        "тариф",
-        "тато",
-        "тату",
-        "тварина",
-        "твердо",
-        "творець",
-        "твій",
-        "театр",
-        "тебе",
-        "текст",
-        "телефон",
-        "теля",
-        "тема",
-        "тембр",
-        "темп",
-        "темрява",
-        "темінь",
-        "тендер",
-        "теніс",
-        "теорія",
-        "тепло",
-        "тераса",
-        "термін",
-        "терор",
-        "тест",
-        "технік",
-        "теча",
-        "теща",
-        "тигр",
-        "тиждень",
-        "тип",
-        "типово",
-        "тираж",
-        "тире",
-        "тиск",
-        "тисяча",
-        "титан",
-        "титул",
-        "тихий",
-        "тиша",
-        "тобто",
-        "товар",
-        "товкач",
-        "товща",
-        "той",
-        "токар",
-        "токсин",
-        "толк",
-        "томат",
-        "тому",
-        "тонкий",
-        "тонна",
-        "тонус",
-        "топка",
-        "тополя",
-        "торба",
-        "торги",
-        "торф",
-        "тост",
-        "точка",
-        "точно",
-        "трава",
-        "тракт",
-        "трамвай",
-        "транс",
-        "трап",
-        "тренер",
-        "третій",
-        "три",
-        "тримати",
-        "триста",
-        "троль",
-        "трос",
-        "тротуар",
-        "трохи",
-        "троянда",
-        "труба",
-        "трюк",
-        "трійка",
-        "тріумф",
-        "туалет",
-        "тулуб",
-        "туман",
-        "тундра",
-        "тунель",
-        "турбіна",
-        "турист",
-        "турнір",
-        "тюльпан",
-        "тютюн",
-        "тягар",
-        "тягне",
-        "тіло",
-        "тільки",
-        "тінь",
-        "тісно",
-        "тісто",
-        "тітка",
-        "убивця",
-        "увага",
-        "удав",
-        "удар",
-        "удача",
-        "ужиток",
-        "узвар",
-        "узвіз",
-        "узлісок",
-        "узор",
-        "указ",
-        "уклад",
-        "укол",
-        "укус",
-        "улов",
-        "ультра",
-        "умова",
-        "унікум",
-        "унісон",
-        "унітаз",
-        "унія",
-        "упор",
-        "управа",
-        "ура",
-        "ураган",
-        "уран",
-        "урвище",
-        "уривок",
-        "урок",
-        "уряд",
-        "усміх",
-        "успіх",
-        "устрій",
-        "утопія",
-        "утрата",
-        "утіха",
-        "ухвала",
-        "ухил",
-        "участь",
-        "учень",
-        "уява",
-        "уявний",
-        "фаза",
-        "файл",
-        "факт",
-        "фальш",
-        "фанат",
-        "фантом",
-        "фарба",
-        "фартух",
-        "фарфор",
-        "фасад",
-        "фах",
-        "ферма",
-        "фея",
-        "фланг",
-        "флейта",
-        "флешка",
-        "флора",
-        "флот",
-        "фляга",
-        "флірт",
-        "фокус",
-        "фонд",
-        "фонтан",
-        "фора",
-        "форель",
-        "фортеця",
-        "форум",
-        "фото",
-        "фраза",
-        "фрегат",
-        "фреска",
-        "фронт",
-        "фрукт",
-        "фтор",
-        "фургон",
-        "фіалка",
-        "фіаско",
-        "фігура",
-        "фізика",
-        "фіксатор",
-        "фікція",
-        "філе",
-        "фільм",
-        "філія",
-        "фінал",
-        "фінік",
-        "фіолет",
-        "фіранка",
-        "фірма",
-        "фішка",
-        "хабар",
-        "халепа",
-        "халтура",
-        "хан",
-        "хаос",
-        "хапати",
-        "харч",
-        "хата",
-        "хатина",
-        "хвала",
-        "хватка",
-        "хвиля",
-        "хворий",
-        "хвоя",
-        "хвіртка",
-        "хвіст",
-        "хиба",
-        "хибно",
-        "хист",
-        "хлопець",
-        "хлор",
-        "хліб",
-        "хлів",
-        "хмара",
-        "хмуро",
-        "хміль",
-        "хобот",
-        "хомут",
-        "хор",
-        "хорда",
-        "хостел",
-        "хотіти",
-        "храм",
-        "храп",
-        "хребет",
-        "хрест",
-        "хробак",
-        "хром",
-        "хрущ",
-        "хрящ",
-        "хрін",
-        "хтось",
-        "худоба",
-        "хутко",
-        "хутро",
-        "хутір",
-        "хіба",
-        "хімія",
-        "хірург",
-        "цар",
-        "цариця",
-        "цвях",
-        "цегла",
-        "цемент",
-        "цензура",
-        "центр",
-        "церква",
-        "цех",
-        "цибуля",
-        "цикл",
-        "цикорій",
-        "цирк",
-        "цитата",
-        "цитрус",
-        "цифра",
-        "цукор",
-        "цунамі",
-        "цятка",
-        "цікаво",
-        "ціле",
-        "цілком",
-        "ціна",
-        "цінний",
-        "чавун",
-        "чагар",
-        "чадо",
-        "чай",
-        "чаклун",
-        "чапля",
-        "чари",
-        "чарка",
-        "чартер",
-        "чарівно",
-        "час",
-        "часник",
-        "часто",
-        "чахлий",
-        "чаша",
-        "чверть",
-        "чебрець",
-        "чемно",
-        "чемодан",
-        "чемпіон",
-        "червень",
-        "черга",
-        "через",
-        "чесний",
-        "честь",
-        "четвер",
-        "чиж",
-        "чимало",
-        "чинник",
-        "число",
-        "чистий",
-        "читач",
-        "чоботи",
-        "чобіт",
-        "човен",
-        "човник",
-        "чоловік",
-        "чорне",
-        "чотири",
-        "чохол",
-        "чуб",
-        "чудо",
-        "чужак",
-        "чужий",
-        "чути",
-        "чутка",
-        "чутно",
-        "чхати",
-        "чіпати",
-        "чіпси",
-        "чітко",
-        "шабля",
-        "шайба",
-        "шампунь",
-        "шанс",
-        "шар",
-        "шафа",
-        "шахи",
-        "шахта",
-        "швець",
-        "швидко",
-        "шериф",
-        "шерсть",
-        "шибка",
-        "шина",
-        "широко",
-        "ширше",
-        "шифр",
-        "шия",
-        "школа",
-        "шкіра",
-        "шлунок",
-        "шлях",
-        "шовк",
-        "шолом",
-        "шорти",
-        "шостий",
-        "шрам",
-        "штани",
-        "штик",
-        "шторм",
-        "штраф",
-        "штука",
-        "шукач",
-        "шум",
-        "щастя",
-        "щедрий",
-        "щирий",
-        "щоденник",
-        "щодня",
-        "щодо",
-        "щойно",
-        "щука",
-        "щур",
-        "щітка",
-        "ювелір",
-        "ювілей",
-        "юнак",
-        "юнга",
-        "юність",
-        "юрист",
-        "юстиція",
-        "юшка",
-        "яблуко",
-        "явище",
-        "явний",
-        "явно",
-        "явір",
-        "ягня",
-        "ягода",
-        "ягуар",
-        "ядро",
-        "язик",
-        "яйце",
-        "який",
-        "якщо",
-        "якір",
-        "якість",
-        "ялинка",
-        "яма",
-        "янтар",
-        "ярлик",
-        "ярус",
-        "ясла",
-        "ясно",
-        "яструб",
-        "яхта",
-        "ящик",
-        "ящір",
-        "яєчня",
-        "євнух",
-        "єврей",
-        "єдиний",
-        "їжа",
-        "їсти",
-        "ідея",
-        "імбир",
-        "імпорт",
-        "індекс",
-        "індик",
-        "індус",
-        "інжир",
-        "іноді",
-        "інститут",
-        "інший",
-        "інші",
-        "іржа",
-        "ірис",
-        "іспит",
-        "істина",
-        "істота"
-    }
+    0, 13, 20, 35, 50, 61, 74, 85, 100, 111, 128, 143, 160, 175, 190, 199, 214,
+    227, 238, 251, 264, 273, 286, 297, 308, 323, 338, 345, 356, 367, 382, 393,
+    406, 417, 432, 449, 456, 471, 480, 491, 502, 515, 526, 539, 550, 561, 574,
+    587, 602, 613, 626, 641, 658, 671, 684, 695, 704, 715, 726, 739, 754, 765,
+    782, 795, 806, 821, 832, 847, 858, 867, 882, 893, 904, 919, 930, 939, 948,
+    961, 976, 987, 1002, 1013, 1026, 1039, 1046, 1059, 1070, 1079, 1090, 1103,
+    1114, 1125, 1136, 1145, 1160, 1171, 1182, 1197, 1212, 1225, 1236, 1251,
+    1260, 1273, 1280, 1293, 1308, 1319, 1332, 1343, 1356, 1367, 1374, 1383,
+    1394, 1407, 1422, 1433, 1446, 1455, 1470, 1485, 1496, 1505, 1520, 1531,
+    1540, 1553, 1568, 1577, 1586, 1597, 1610, 1621, 1630, 1643, 1652, 1667,
+    1678, 1689, 1704, 1713, 1724, 1737, 1750, 1761, 1774, 1785, 1800, 1813,
+    1822, 1833, 1842, 1857, 1868, 1879, 1892, 1907, 1920, 1931, 1946, 1957,
+    1970, 1979, 1992, 2005, 2014, 2027, 2034, 2045, 2060, 2069, 2080, 2091,
+    2102, 2115, 2124, 2137, 2148, 2161, 2170, 2177, 2190, 2203, 2214, 2227,
+    2238, 2255, 2266, 2275, 2286, 2297, 2312, 2325, 2340, 2357, 2368, 2381,
+    2392, 2405, 2418, 2429, 2440, 2455, 2466, 2481, 2492, 2507, 2518, 2529,
+    2546, 2561, 2570, 2587, 2598, 2609, 2622, 2639, 2654, 2671, 2682, 2697,
+    2712, 2725, 2736, 2751, 2764, 2775, 2790, 2803, 2818, 2829, 2840, 2855,
+    2868, 2881, 2894, 2901, 2916, 2933, 2948, 2961, 2972, 2987, 2998, 3011,
+    3026, 3041, 3050, 3065, 3080, 3095, 3110, 3121, 3132, 3147, 3158, 3175,
+    3188, 3201, 3216, 3227, 3238, 3249, 3258, 3271, 3284, 3299, 3314, 3329,
+    3340, 3355, 3370, 3383, 3396, 3411, 3424, 3433, 3444, 3453, 3464, 3479,
+    3492, 3501, 3514, 3529, 3542, 3553, 3566, 3577, 3586, 3597, 3608, 3621,
+    3632, 3649, 3660, 3675, 3682, 3697, 3712, 3723, 3734, 3745, 3758, 3771,
+    3778, 3789, 3806, 3819, 3828, 3837, 3852, 3865, 3880, 3891, 3902, 3913,
+    3926, 3941, 3954, 3967, 3978, 3993, 4010, 4027, 4042, 4055, 4062, 4073,
+    4084, 4101, 4112, 4125, 4136, 4147, 4156, 4169, 4180, 4189, 4200, 4215,
+    4226, 4241, 4256, 4269, 4282, 4295, 4308, 4321, 4334, 4345, 4358, 4371,
+    4384, 4395, 4408, 4419, 4432, 4447, 4462, 4475, 4486, 4501, 4512, 4521,
+    4536, 4545, 4556, 4571, 4584, 4597, 4610, 4623, 4638, 4655, 4670, 4681,
+    4692, 4707, 4722, 4735, 4744, 4753, 4766, 4779, 4792, 4803, 4814, 4827,
+    4838, 4847, 4862, 4875, 4886, 4899, 4916, 4929, 4940, 4957, 4970, 4987,
+    5002, 5017, 5028, 5039, 5048, 5061, 5070, 5081, 5096, 5107, 5118, 5129,
+    5140, 5149, 5158, 5171, 5184, 5193, 5202, 5215, 5228, 5243, 5254, 5265,
+    5276, 5289, 5306, 5319, 5328, 5343, 5354, 5367, 5374, 5385, 5392, 5403,
+    5416, 5425, 5436, 5449, 5460, 5471, 5484, 5493, 5502, 5515, 5530, 5543,
+    5556, 5569, 5584, 5599, 5608, 5617, 5626, 5641, 5654, 5663, 5676, 5691,
+    5702, 5719, 5730, 5745, 5754, 5769, 5784, 5797, 5810, 5821, 5828, 5839,
+    5854, 5863, 5876, 5885, 5902, 5915, 5924, 5931, 5940, 5951, 5962, 5977,
+    5988, 6001, 6016, 6031, 6044, 6055, 6068, 6085, 6096, 6109, 6124, 6135,
+    6150, 6161, 6174, 6187, 6202, 6215, 6228, 6241, 6254, 6269, 6280, 6293,
+    6304, 6315, 6322, 6337, 6350, 6361, 6370, 6383, 6392, 6401, 6408, 6419,
+    6428, 6441, 6452, 6467, 6476, 6489, 6500, 6513, 6530, 6541, 6554, 6569,
+    6582, 6597, 6606, 6617, 6632, 6639, 6652, 6667, 6682, 6691, 6706, 6717,
+    6732, 6747, 6764, 6781, 6792, 6807, 6822, 6835, 6848, 6865, 6880, 6889,
+    6904, 6915, 6926, 6937, 6950, 6965, 6982, 6995, 7010, 7019, 7030, 7045,
+    7058, 7071, 7084, 7101, 7108, 7121, 7134, 7147, 7160, 7171, 7180, 7191,
+    7208, 7219, 7228, 7239, 7248, 7261, 7270, 7279, 7290, 7299, 7308, 7317,
+    7324, 7333, 7342, 7349, 7362, 7371, 7382, 7395, 7404, 7417, 7426, 7437,
+    7446, 7453, 7460, 7473, 7482, 7493, 7502, 7513, 7522, 7537, 7546, 7557,
+    7570, 7581, 7594, 7603, 7614, 7627, 7644, 7657, 7670, 7681, 7694, 7705,
+    7720, 7733, 7748, 7763, 7774, 7791, 7804, 7815, 7822, 7837, 7850, 7861,
+    7874, 7887, 7898, 7913, 7926, 7937, 7952, 7967, 7980, 7995, 8006, 8019,
+    8032, 8043, 8058, 8069, 8084, 8097, 8108, 8119, 8128, 8143, 8158, 8171,
+    8180, 8189, 8202, 8217, 8230, 8241, 8254, 8269, 8286, 8301, 8318, 8329,
+    8340, 8349, 8360, 8369, 8380, 8391, 8398, 8413, 8426, 8443, 8454, 8465,
+    8474, 8489, 8502, 8515, 8528, 8539, 8552, 8565, 8580, 8593, 8608, 8617,
+    8628, 8639, 8652, 8669, 8684, 8693, 8708, 8723, 8740, 8747, 8758, 8773,
+    8782, 8791, 8804, 8817, 8830, 8839, 8850, 8859, 8870, 8883, 8896, 8907,
+    8920, 8935, 8952, 8965, 8978, 8991, 9002, 9013, 9028, 9045, 9060, 9075,
+    9086, 9101, 9116, 9127, 9142, 9157, 9166, 9177, 9190, 9205, 9216, 9231,
+    9240, 9255, 9266, 9283, 9298, 9311, 9324, 9333, 9344, 9359, 9370, 9381,
+    9392, 9405, 9418, 9429, 9442, 9457, 9470, 9485, 9498, 9507, 9516, 9525,
+    9534, 9547, 9562, 9571, 9586, 9601, 9614, 9625, 9638, 9649, 9660, 9673,
+    9688, 9701, 9708, 9721, 9732, 9743, 9754, 9765, 9778, 9793, 9802, 9819,
+    9834, 9845, 9856, 9871, 9886, 9899, 9914, 9929, 9942, 9957, 9972, 9983,
+    9996, 10007, 10024, 10037, 10052, 10065, 10078, 10091, 10100, 10113, 10126,
+    10141, 10156, 10169, 10180, 10191, 10208, 10223, 10234, 10251, 10264,
+    10275, 10288, 10299, 10314, 10327, 10336, 10347, 10358, 10371, 10380,
+    10393, 10410, 10421, 10432, 10443, 10452, 10465, 10476, 10491, 10504,
+    10515, 10528, 10537, 10544, 10555, 10566, 10573, 10586, 10601, 10614,
+    10623, 10636, 10643, 10656, 10667, 10676, 10689, 10702, 10717, 10724,
+    10735, 10746, 10761, 10774, 10783, 10794, 10805, 10818, 10831, 10840,
+    10851, 10862, 10871, 10882, 10891, 10902, 10915, 10928, 10935, 10950,
+    10961, 10974, 10991, 11002, 11011, 11020, 11035, 11048, 11061, 11074,
+    11083, 11096, 11105, 11116, 11127, 11136, 11149, 11164, 11171, 11184,
+    11193, 11202, 11213, 11222, 11233, 11246, 11261, 11274, 11283, 11296,
+    11311, 11318, 11331, 11342, 11355, 11364, 11379, 11388, 11397, 11410,
+    11419, 11430, 11439, 11450, 11459, 11470, 11485, 11492, 11501, 11514,
+    11527, 11540, 11549, 11562, 11575, 11586, 11597, 11610, 11621, 11630,
+    11641, 11652, 11663, 11676, 11687, 11698, 11707, 11720, 11735, 11746,
+    11757, 11774, 11785, 11798, 11809, 11820, 11829, 11842, 11855, 11862,
+    11877, 11888, 11901, 11916, 11925, 11934, 11947, 11960, 11971, 11984,
+    11999, 12012, 12023, 12032, 12045, 12052, 12065, 12078, 12093, 12104,
+    12113, 12126, 12139, 12152, 12167, 12182, 12195, 12208, 12217, 12228,
+    12239, 12250, 12265, 12274, 12291, 12304, 12317, 12330, 12341, 12348,
+    12361, 12372, 12387, 12396, 12411, 12426, 12437, 12446, 12459, 12468,
+    12483, 12494, 12505, 12512, 12525, 12538, 12547, 12562, 12575, 12586,
+    12601, 12616, 12625, 12634, 12643, 12654, 12669, 12680, 12691, 12706,
+    12719, 12732, 12743, 12756, 12765, 12778, 12795, 12810, 12823, 12834,
+    12849, 12856, 12865, 12880, 12897, 12910, 12923, 12936, 12945, 12960,
+    12969, 12978, 12991, 13004, 13021, 13036, 13047, 13062, 13071, 13080,
+    13093, 13104, 13111, 13122, 13137, 13150, 13161, 13176, 13189, 13204,
+    13219, 13234, 13247, 13260, 13273, 13286, 13297, 13308, 13319, 13334,
+    13349, 13360, 13375, 13386, 13401, 13414, 13427, 13439, 13450, 13461,
+    13474, 13489, 13502, 13517, 13528, 13539, 13550, 13563, 13574, 13587,
+    13596, 13613, 13626, 13639, 13654, 13669, 13678, 13687, 13698, 13709,
+    13726, 13735, 13746, 13759, 13768, 13781, 13792, 13803, 13816, 13831,
+    13840, 13853, 13860, 13873, 13880, 13895, 13908, 13921, 13934, 13945,
+    13958, 13969, 13982, 13993, 14008, 14019, 14030, 14043, 14054, 14065,
+    14080, 14091, 14100, 14109, 14124, 14133, 14142, 14153, 14166, 14175,
+    14186, 14195, 14206, 14217, 14230, 14241, 14250, 14263, 14274, 14281,
+    14294, 14309, 14324, 14335, 14346, 14361, 14370, 14381, 14390, 14401,
+    14412, 14423, 14432, 14445, 14458, 14469, 14482, 14491, 14504, 14515,
+    14526, 14535, 14548, 14563, 14576, 14587, 14600, 14611, 14624, 14639,
+    14650, 14663, 14674, 14685, 14694, 14707, 14716, 14729, 14744, 14755,
+    14768, 14781, 14788, 14799, 14812, 14823, 14834, 14845, 14858, 14871,
+    14884, 14897, 14914, 14929, 14936, 14951, 14964, 14975, 14986, 14995,
+    15006, 15019, 15034, 15049, 15064, 15075, 15088, 15103, 15114, 15129,
+    15140, 15155, 15166, 15181, 15194, 15203, 15218, 15233, 15248, 15261,
+    15268, 15279, 15292, 15305, 15320, 15337, 15348, 15359, 15372, 15387,
+    15400, 15413, 15422, 15437, 15448, 15459, 15470, 15479, 15488, 15499,
+    15514, 15527, 15544, 15559, 15574, 15589, 15602, 15615, 15628, 15641,
+    15654, 15667, 15682, 15697, 15712, 15725, 15736, 15749, 15760, 15773,
+    15788, 15797, 15812, 15829, 15840, 15851, 15866, 15877, 15892, 15901,
+    15912, 15923, 15936, 15947, 15958, 15971, 15982, 15995, 16010, 16025,
+    16040, 16055, 16072, 16083, 16098, 16109, 16126, 16141, 16156, 16167,
+    16178, 16191, 16206, 16217, 16228, 16239, 16248, 16259, 16272, 16287,
+    16300, 16313, 16324, 16339, 16352, 16363, 16378, 16391, 16406, 16415,
+    16430, 16443, 16454, 16469, 16484, 16497, 16510, 16523, 16536, 16551,
+    16564, 16577, 16590, 16603, 16618, 16631, 16644, 16655, 16666, 16679,
+    16692, 16707, 16718, 16733, 16746, 16755, 16766, 16775, 16786, 16797,
+    16812, 16821, 16836, 16847, 16862, 16877, 16890, 16903, 16918, 16931,
+    16946, 16961, 16976, 16989, 17002, 17013, 17026, 17037, 17050, 17059,
+    17074, 17087, 17098, 17111, 17122, 17129, 17140, 17153, 17164, 17177,
+    17190, 17201, 17212, 17221, 17234, 17245, 17254, 17265, 17276, 17289,
+    17302, 17317, 17332, 17343, 17356, 17373, 17384, 17397, 17410, 17421,
+    17432, 17445, 17458, 17471, 17484, 17493, 17504, 17513, 17524, 17531,
+    17540, 17553, 17566, 17579, 17592, 17605, 17618, 17631, 17644, 17655,
+    17666, 17675, 17686, 17693, 17704, 17715, 17726, 17735, 17744, 17757,
+    17764, 17779, 17792, 17805, 17812, 17823, 17840, 17853, 17864, 17875,
+    17886, 17899, 17912, 17923, 17930, 17939, 17950, 17961, 17970, 17981,
+    17992, 18001, 18014, 18027, 18040, 18051, 18064, 18075, 18090, 18101,
+    18114, 18129, 18138, 18151, 18162, 18173, 18186, 18199, 18214, 18227,
+    18238, 18247, 18260, 18275, 18284, 18295, 18306, 18319, 18332, 18345,
+    18354, 18367, 18380, 18393, 18406, 18419, 18426, 18441, 18450, 18463,
+    18474, 18485, 18496, 18505, 18518, 18529, 18540, 18553, 18564, 18575,
+    18584, 18593, 18606, 18615, 18630, 18639, 18652, 18667, 18678, 18687,
+    18696, 18709, 18720, 18729, 18742, 18753, 18766, 18773, 18784, 18801,
+    18816, 18827, 18836, 18847, 18858, 18867, 18876, 18893, 18906, 18915,
+    18926, 18939, 18950, 18963, 18978, 18989, 19002, 19015, 19030, 19043,
+    19054, 19063, 19078, 19091, 19104, 19119, 19128, 19139, 19150, 19163,
+    19176, 19187, 19198, 19211, 19222, 19235, 19242, 19253, 19266, 19279,
+    19290, 19301, 19316, 19329, 19344, 19357, 19368, 19377, 19386, 19397,
+    19410, 19417, 19428, 19439, 19450, 19459, 19472, 19483, 19494, 19505,
+    19518, 19529, 19540, 19549, 19560, 19571, 19586, 19597, 19610, 19621,
+    19628, 19637, 19644, 19653, 19666, 19679, 19692, 19703, 19714, 19725,
+    19740, 19751, 19762, 19773, 19782, 19795, 19806, 19813, 19824, 19837,
+    19846, 19857, 19868, 19881, 19892, 19901, 19910, 19925, 19938, 19953,
+    19964, 19975, 19984, 19995, 20010, 20019, 20028, 20039, 20048, 20063,
+    20076, 20089, 20100, 20113, 20124, 20137, 20150, 20161, 20170, 20183,
+    20192, 20201, 20210, 20225, 20232, 20245, 20256, 20265, 20274, 20287,
+    20298, 20309, 20322, 20331, 20342, 20353, 20366, 20377, 20386, 20397,
+    20410, 20419, 20430, 20439, 20454, 20465, 20476, 20487, 20500, 20511,
+    20522, 20531, 20540, 20551, 20562, 20573, 20584, 20601, 20612, 20621,
+    20634, 20649, 20656, 20671, 20684, 20695, 20704, 20719, 20730, 20745,
+    20756, 20765, 20780, 20793, 20806, 20817, 20828, 20841, 20854, 20869,
+    20882, 20895, 20910, 20921, 20932, 20943, 20952, 20965, 20974, 20985,
+    20996, 21007, 21020, 21031, 21040, 21049, 21060, 21073, 21084, 21095,
+    21110, 21119, 21128, 21139, 21148, 21157, 21166, 21179, 21190, 21203,
+    21216, 21229, 21238, 21247, 21260, 21267, 21280, 21289, 21302, 21315,
+    21324, 21333, 21344, 21355, 21370, 21383, 21396, 21407, 21420, 21429,
+    21442, 21453, 21462, 21477, 21486, 21497, 21506, 21517, 21528, 21541,
+    21552, 21565, 21578, 21589, 21596, 21607, 21614, 21625, 21640, 21653,
+    21664, 21673, 21684, 21695, 21706, 21715, 21728, 21737, 21750, 21765,
+    21776, 21785, 21796, 21809, 21822, 21833, 21844, 21853, 21866, 21879,
+    21892, 21905, 21918, 21935, 21948, 21957, 21968, 21979, 21990, 22001,
+    22014, 22029, 22040, 22051, 22062, 22075, 22090, 22097, 22106, 22119,
+    22128, 22137, 22150, 22161, 22174, 22185, 22200, 22209, 22224, 22235,
+    22244, 22255, 22264, 22279, 22288, 22297, 22306, 22317, 22328, 22339,
+    22350, 22361, 22368, 22379, 22392, 22405, 22414, 22423, 22436, 22447,
+    22460, 22469, 22478, 22487, 22496, 22507, 22520, 22531, 22542, 22553,
+    22562, 22573, 22586, 22593, 22606, 22615, 22626, 22639, 22654, 22665,
+    22678, 22685, 22698, 22707, 22724, 22733, 22746, 22759, 22770, 22781,
+    22794, 22805, 22818, 22827, 22840, 22849, 22864, 22875, 22886, 22895,
+    22904, 22917, 22928, 22937, 22948, 22961, 22976, 22983, 22996, 23007,
+    23022, 23031, 23044, 23059, 23070, 23085, 23100, 23115, 23126, 23137,
+    23152, 23163, 23176, 23183, 23196, 23209, 23220, 23235, 23246, 23259,
+    23270, 23281, 23294, 23309, 23320, 23333, 23344, 23351, 23360, 23371,
+    23384, 23393, 23404, 23415, 23426, 23439, 23450, 23461, 23472, 23485,
+    23500, 23509, 23516, 23525, 23534, 23545, 23556, 23569, 23580, 23593,
+    23604, 23613, 23626, 23637, 23646, 23653, 23664, 23675, 23688, 23697,
+    23706, 23717, 23728, 23743, 23752, 23763, 23772, 23783, 23794, 23805,
+    23816, 23823, 23834, 23849, 23862, 23879, 23890, 23899, 23912, 23921,
+    23928, 23939, 23952, 23967, 23976, 23985, 23998, 24009, 24024, 24033,
+    24046, 24057, 24070, 24079, 24088, 24097, 24108, 24119, 24128, 24137,
+    24148, 24159, 24168, 24177, 24190, 24203, 24210, 24221, 24232, 24241,
+    24250, 24259, 24272, 24281, 24290, 24299, 24310, 24321, 24334, 24349,
+    24358, 24369, 24378, 24389, 24402, 24415, 24426, 24437, 24448, 24459,
+    24476, 24489, 24498, 24507, 24516, 24527, 24540
 };
 
-const dictionary zh_Hans =
+const dictionary uk{ uk_words, uk_offsets };
+
+static const char zh_Hans_words[] =
+    "的\0"
+    "一\0"
+    "是\0"
+    "在\0"
+    "不\0"
+    "了\0"
+    "有\0"
+    "和\0"
+    "人\0"
+    "这\0"
+    "中\0"
+    "大\0"
+    "为\0"
+    "上\0"
+    "个\0"
+    "国\0"
+    "我\0"
+    "以\0"
+    "要\0"
+    "他\0"
+    "时\0"
+    "来\0"
+    "用\0"
+    "们\0"
+    "生\0"
+    "到\0"
+    "作\0"
+    "地\0"
+    "于\0"
+    "出\0"
+    "就\0"
+    "分\0"
+    "对\0"
+    "成\0"
+    "会\0"
+    "可\0"
+    "主\0"
+    "发\0"
+    "年\0"
+    "动\0"
+    "同\0"
+    "工\0"
+    "也\0"
+    "能\0"
+    "下\0"
+    "过\0"
+    "子\0"
+    "说\0"
+    "产\0"
+    "种\0"
+    "面\0"
+    "而\0"
+    "方\0"
+    "后\0"
+    "多\0"
+    "定\0"
+    "行\0"
+    "学\0"
+    "法\0"
+    "所\0"
+    "民\0"
+    "得\0"
+    "经\0"
+    "十\0"
+    "三\0"
+    "之\0"
+    "进\0"
+    "着\0"
+    "等\0"
+    "部\0"
+    "度\0"
+    "家\0"
+    "电\0"
+    "力\0"
+    "里\0"
+    "如\0"
+    "水\0"
+    "化\0"
+    "高\0"
+    "自\0"
+    "二\0"
+    "理\0"
+    "起\0"
+    "小\0"
+    "物\0"
+    "现\0"
+    "实\0"
+    "加\0"
+    "量\0"
+    "都\0"
+    "两\0"
+    "体\0"
+    "制\0"
+    "机\0"
+    "当\0"
+    "使\0"
+    "点\0"
+    "从\0"
+    "业\0"
+    "本\0"
+    "去\0"
+    "把\0"
+    "性\0"
+    "好\0"
+    "应\0"
+    "开\0"
+    "它\0"
+    "合\0"
+    "还\0"
+    "因\0"
+    "由\0"
+    "其\0"
+    "些\0"
+    "然\0"
+    "前\0"
+    "外\0"
+    "天\0"
+    "政\0"
+    "四\0"
+    "日\0"
+    "那\0"
+    "社\0"
+    "义\0"
+    "事\0"
+    "平\0"
+    "形\0"
+    "相\0"
+    "全\0"
+    "表\0"
+    "间\0"
+    "样\0"
+    "与\0"
+    "关\0"
+    "各\0"
+    "重\0"
+    "新\0"
+    "线\0"
+    "内\0"
+    "数\0"
+    "正\0"
+    "心\0"
+    "反\0"
+    "你\0"
+    "明\0"
+    "看\0"
+    "原\0"
+    "又\0"
+    "么\0"
+    "利\0"
+    "比\0"
+    "或\0"
+    "但\0"
+    "质\0"
+    "气\0"
+    "第\0"
+    "向\0"
+    "道\0"
+    "命\0"
+    "此\0"
+    "变\0"
+    "条\0"
+    "只\0"
+    "没\0"
+    "结\0"
+    "解\0"
+    "问\0"
+    "意\0"
+    "建\0"
+    "月\0"
+    "公\0"
+    "无\0"
+    "系\0"
+    "军\0"
+    "很\0"
+    "情\0"
+    "者\0"
+    "最\0"
+    "立\0"
+    "代\0"
+    "想\0"
+    "已\0"
+    "通\0"
+    "并\0"
+    "提\0"
+    "直\0"
+    "题\0"
+    "党\0"
+    "程\0"
+    "展\0"
+    "五\0"
+    "果\0"
+    "料\0"
+    "象\0"
+    "员\0"
+    "革\0"
+    "位\0"
+    "入\0"
+    "常\0"
+    "文\0"
+    "总\0"
+    "次\0"
+    "品\0"
+    "式\0"
+    "活\0"
+    "设\0"
+    "及\0"
+    "管\0"
+    "特\0"
+    "件\0"
+    "长\0"
+    "求\0"
+    "老\0"
+    "头\0"
+    "基\0"
+    "资\0"
+    "边\0"
+    "流\0"
+    "路\0"
+    "级\0"
+    "少\0"
+    "图\0"
+    "山\0"
+    "统\0"
+    "接\0"
+    "知\0"
+    "较\0"
+    "将\0"
+    "组\0"
+    "见\0"
+    "计\0"
+    "别\0"
+    "她\0"
+    "手\0"
+    "角\0"
+    "期\0"
+    "根\0"
+    "论\0"
+    "运\0"
+    "农\0"
+    "指\0"
+    "几\0"
+    "九\0"
+    "区\0"
+    "强\0"
+    "放\0"
+    "决\0"
+    "西\0"
+    "被\0"
+    "干\0"
+    "做\0"
+    "必\0"
+    "战\0"
+    "先\0"
+    "回\0"
+    "则\0"
+    "任\0"
+    "取\0"
+    "据\0"
+    "处\0"
+    "队\0"
+    "南\0"
+    "给\0"
+    "色\0"
+    "光\0"
+    "门\0"
+    "即\0"
+    "保\0"
+    "治\0"
+    "北\0"
+    "造\0"
+    "百\0"
+    "规\0"
+    "热\0"
+    "领\0"
+    "七\0"
+    "海\0"
+    "口\0"
+    "东\0"
+    "导\0"
+    "器\0"
+    "压\0"
+    "志\0"
+    "世\0"
+    "金\0"
+    "增\0"
+    "争\0"
+    "济\0"
+    "阶\0"
+    "油\0"
+    "思\0"
+    "术\0"
+    "极\0"
+    "交\0"
+    "受\0"
+    "联\0"
+    "什\0"
+    "认\0"
+    "六\0"
+    "共\0"
+    "权\0"
+    "收\0"
+    "证\0"
+    "改\0"
+    "清\0"
+    "美\0"
+    "再\0"
+    "采\0"
+    "转\0"
+    "更\0"
+    "单\0"
+    "风\0"
+    "切\0"
+    "打\0"
+    "白\0"
+    "教\0"
+    "速\0"
+    "花\0"
+    "带\0"
+    "安\0"
+    "场\0"
+    "身\0"
+    "车\0"
+    "例\0"
+    "真\0"
+    "务\0"
+    "具\0"
+    "万\0"
+    "每\0"
+    "目\0"
+    "至\0"
+    "达\0"
+    "走\0"
+    "积\0"
+    "示\0"
+    "议\0"
+    "声\0"
+    "报\0"
+    "斗\0"
+    "完\0"
+    "类\0"
+    "八\0"
+    "离\0"
+    "华\0"
+    "名\0"
+    "确\0"
+    "才\0"
+    "科\0"
+    "张\0"
+    "信\0"
+    "马\0"
+    "节\0"
+    "话\0"
+    "米\0"
+    "整\0"
+    "空\0"
+    "元\0"
+    "况\0"
+    "今\0"
+    "集\0"
+    "温\0"
+    "传\0"
+    "土\0"
+    "许\0"
+    "步\0"
+    "群\0"
+    "广\0"
+    "石\0"
+    "记\0"
+    "需\0"
+    "段\0"
+    "研\0"
+    "界\0"
+    "拉\0"
+    "林\0"
+    "律\0"
+    "叫\0"
+    "且\0"
+    "究\0"
+    "观\0"
+    "越\0"
+    "织\0"
+    "装\0"
+    "影\0"
+    "算\0"
+    "低\0"
+    "持\0"
+    "音\0"
+    "众\0"
+    "书\0"
+    "布\0"
+    "复\0"
+    "容\0"
+    "儿\0"
+    "须\0"
+    "际\0"
+    "商\0"
+    "非\0"
+    "验\0"
+    "连\0"
+    "断\0"
+    "深\0"
+    "难\0"
+    "近\0"
+    "矿\0"
+    "千\0"
+    "周\0"
+    "委\0"
+    "素\0"
+    "技\0"
+    "备\0"
+    "半\0"
+    "办\0"
+    "青\0"
+    "省\0"
+    "列\0"
+    "习\0"
+    "响\0"
+    "约\0"
+    "支\0"
+    "般\0"
+    "史\0"
+    "感\0"
+    "劳\0"
+    "便\0"
+    "团\0"
+    "往\0"
+    "酸\0"
+    "历\0"
+    "市\0"
+    "克\0"
+    "何\0"
+    "除\0"
+    "消\0"
+    "构\0"
+    "府\0"
+    "称\0"
+    "太\0"
+    "准\0"
+    "精\0"
+    "值\0"
+    "号\0"
+    "率\0"
+    "族\0"
+    "维\0"
+    "划\0"
+    "选\0"
+    "标\0"
+    "写\0"
+    "存\0"
+    "候\0"
+    "毛\0"
+    "亲\0"
+    "快\0"
+    "效\0"
+    "斯\0"
+    "院\0"
+    "查\0"
+    "江\0"
+    "型\0"
+    "眼\0"
+    "王\0"
+    "按\0"
+    "格\0"
+    "养\0"
+    "易\0"
+    "置\0"
+    "派\0"
+    "层\0"
+    "片\0"
+    "始\0"
+    "却\0"
+    "专\0"
+    "状\0"
+    "育\0"
+    "厂\0"
+    "京\0"
+    "识\0"
+    "适\0"
+    "属\0"
+    "圆\0"
+    "包\0"
+    "火\0"
+    "住\0"
+    "调\0"
+    "满\0"
+    "县\0"
+    "局\0"
+    "照\0"
+    "参\0"
+    "红\0"
+    "细\0"
+    "引\0"
+    "听\0"
+    "该\0"
+    "铁\0"
+    "价\0"
+    "严\0"
+    "首\0"
+    "底\0"
+    "液\0"
+    "官\0"
+    "德\0"
+    "随\0"
+    "病\0"
+    "苏\0"
+    "失\0"
+    "尔\0"
+    "死\0"
+    "讲\0"
+    "配\0"
+    "女\0"
+    "黄\0"
+    "推\0"
+    "显\0"
+    "谈\0"
+    "罪\0"
+    "神\0"
+    "艺\0"
+    "呢\0"
+    "席\0"
+    "含\0"
+    "企\0"
+    "望\0"
+    "密\0"
+    "批\0"
+    "营\0"
+    "项\0"
+    "防\0"
+    "举\0"
+    "球\0"
+    "英\0"
+    "氧\0"
+    "势\0"
+    "告\0"
+    "李\0"
+    "台\0"
+    "落\0"
+    "木\0"
+    "帮\0"
+    "轮\0"
+    "破\0"
+    "亚\0"
+    "师\0"
+    "围\0"
+    "注\0"
+    "远\0"
+    "字\0"
+    "材\0"
+    "排\0"
+    "供\0"
+    "河\0"
+    "态\0"
+    "封\0"
+    "另\0"
+    "施\0"
+    "减\0"
+    "树\0"
+    "溶\0"
+    "怎\0"
+    "止\0"
+    "案\0"
+    "言\0"
+    "士\0"
+    "均\0"
+    "武\0"
+    "固\0"
+    "叶\0"
+    "鱼\0"
+    "波\0"
+    "视\0"
+    "仅\0"
+    "费\0"
+    "紧\0"
+    "爱\0"
+    "左\0"
+    "章\0"
+    "早\0"
+    "朝\0"
+    "害\0"
+    "续\0"
+    "轻\0"
+    "服\0"
+    "试\0"
+    "食\0"
+    "充\0"
+    "兵\0"
+    "源\0"
+    "判\0"
+    "护\0"
+    "司\0"
+    "足\0"
+    "某\0"
+    "练\0"
+    "差\0"
+    "致\0"
+    "板\0"
+    "田\0"
+    "降\0"
+    "黑\0"
+    "犯\0"
+    "负\0"
+    "击\0"
+    "范\0"
+    "继\0"
+    "兴\0"
+    "似\0"
+    "余\0"
+    "坚\0"
+    "曲\0"
+    "输\0"
+    "修\0"
+    "故\0"
+    "城\0"
+    "夫\0"
+    "够\0"
+    "送\0"
+    "笔\0"
+    "船\0"
+    "占\0"
+    "右\0"
+    "财\0"
+    "吃\0"
+    "富\0"
+    "春\0"
+    "职\0"
+    "觉\0"
+    "汉\0"
+    "画\0"
+    "功\0"
+    "巴\0"
+    "跟\0"
+    "虽\0"
+    "杂\0"
+    "飞\0"
+    "检\0"
+    "吸\0"
+    "助\0"
+    "升\0"
+    "阳\0"
+    "互\0"
+    "初\0"
+    "创\0"
+    "抗\0"
+    "考\0"
+    "投\0"
+    "坏\0"
+    "策\0"
+    "古\0"
+    "径\0"
+    "换\0"
+    "未\0"
+    "跑\0"
+    "留\0"
+    "钢\0"
+    "曾\0"
+    "端\0"
+    "责\0"
+    "站\0"
+    "简\0"
+    "述\0"
+    "钱\0"
+    "副\0"
+    "尽\0"
+    "帝\0"
+    "射\0"
+    "草\0"
+    "冲\0"
+    "承\0"
+    "独\0"
+    "令\0"
+    "限\0"
+    "阿\0"
+    "宣\0"
+    "环\0"
+    "双\0"
+    "请\0"
+    "超\0"
+    "微\0"
+    "让\0"
+    "控\0"
+    "州\0"
+    "良\0"
+    "轴\0"
+    "找\0"
+    "否\0"
+    "纪\0"
+    "益\0"
+    "依\0"
+    "优\0"
+    "顶\0"
+    "础\0"
+    "载\0"
+    "倒\0"
+    "房\0"
+    "突\0"
+    "坐\0"
+    "粉\0"
+    "敌\0"
+    "略\0"
+    "客\0"
+    "袁\0"
+    "冷\0"
+    "胜\0"
+    "绝\0"
+    "析\0"
+    "块\0"
+    "剂\0"
+    "测\0"
+    "丝\0"
+    "协\0"
+    "诉\0"
+    "念\0"
+    "陈\0"
+    "仍\0"
+    "罗\0"
+    "盐\0"
+    "友\0"
+    "洋\0"
+    "错\0"
+    "苦\0"
+    "夜\0"
+    "刑\0"
+    "移\0"
+    "频\0"
+    "逐\0"
+    "靠\0"
+    "混\0"
+    "母\0"
+    "短\0"
+    "皮\0"
+    "终\0"
+    "聚\0"
+    "汽\0"
+    "村\0"
+    "云\0"
+    "哪\0"
+    "既\0"
+    "距\0"
+    "卫\0"
+    "停\0"
+    "烈\0"
+    "央\0"
+    "察\0"
+    "烧\0"
+    "迅\0"
+    "境\0"
+    "若\0"
+    "印\0"
+    "洲\0"
+    "刻\0"
+    "括\0"
+    "激\0"
+    "孔\0"
+    "搞\0"
+    "甚\0"
+    "室\0"
+    "待\0"
+    "核\0"
+    "校\0"
+    "散\0"
+    "侵\0"
+    "吧\0"
+    "甲\0"
+    "游\0"
+    "久\0"
+    "菜\0"
+    "味\0"
+    "旧\0"
+    "模\0"
+    "湖\0"
+    "货\0"
+    "损\0"
+    "预\0"
+    "阻\0"
+    "毫\0"
+    "普\0"
+    "稳\0"
+    "乙\0"
+    "妈\0"
+    "植\0"
+    "息\0"
+    "扩\0"
+    "银\0"
+    "语\0"
+    "挥\0"
+    "酒\0"
+    "守\0"
+    "拿\0"
+    "序\0"
+    "纸\0"
+    "医\0"
+    "缺\0"
+    "雨\0"
+    "吗\0"
+    "针\0"
+    "刘\0"
+    "啊\0"
+    "急\0"
+    "唱\0"
+    "误\0"
+    "训\0"
+    "愿\0"
+    "审\0"
+    "附\0"
+    "获\0"
+    "茶\0"
+    "鲜\0"
+    "粮\0"
+    "斤\0"
+    "孩\0"
+    "脱\0"
+    "硫\0"
+    "肥\0"
+    "善\0"
+    "龙\0"
+    "演\0"
+    "父\0"
+    "渐\0"
+    "血\0"
+    "欢\0"
+    "械\0"
+    "掌\0"
+    "歌\0"
+    "沙\0"
+    "刚\0"
+    "攻\0"
+    "谓\0"
+    "盾\0"
+    "讨\0"
+    "晚\0"
+    "粒\0"
+    "乱\0"
+    "燃\0"
+    "矛\0"
+    "乎\0"
+    "杀\0"
+    "药\0"
+    "宁\0"
+    "鲁\0"
+    "贵\0"
+    "钟\0"
+    "煤\0"
+    "读\0"
+    "班\0"
+    "伯\0"
+    "香\0"
+    "介\0"
+    "迫\0"
+    "句\0"
+    "丰\0"
+    "培\0"
+    "握\0"
+    "兰\0"
+    "担\0"
+    "弦\0"
+    "蛋\0"
+    "沉\0"
+    "假\0"
+    "穿\0"
+    "执\0"
+    "答\0"
+    "乐\0"
+    "谁\0"
+    "顺\0"
+    "烟\0"
+    "缩\0"
+    "征\0"
+    "脸\0"
+    "喜\0"
+    "松\0"
+    "脚\0"
+    "困\0"
+    "异\0"
+    "免\0"
+    "背\0"
+    "星\0"
+    "福\0"
+    "买\0"
+    "染\0"
+    "井\0"
+    "概\0"
+    "慢\0"
+    "怕\0"
+    "磁\0"
+    "倍\0"
+    "祖\0"
+    "皇\0"
+    "促\0"
+    "静\0"
+    "补\0"
+    "评\0"
+    "翻\0"
+    "肉\0"
+    "践\0"
+    "尼\0"
+    "衣\0"
+    "宽\0"
+    "扬\0"
+    "棉\0"
+    "希\0"
+    "伤\0"
+    "操\0"
+    "垂\0"
+    "秋\0"
+    "宜\0"
+    "氢\0"
+    "套\0"
+    "督\0"
+    "振\0"
+    "架\0"
+    "亮\0"
+    "末\0"
+    "宪\0"
+    "庆\0"
+    "编\0"
+    "牛\0"
+    "触\0"
+    "映\0"
+    "雷\0"
+    "销\0"
+    "诗\0"
+    "座\0"
+    "居\0"
+    "抓\0"
+    "裂\0"
+    "胞\0"
+    "呼\0"
+    "娘\0"
+    "景\0"
+    "威\0"
+    "绿\0"
+    "晶\0"
+    "厚\0"
+    "盟\0"
+    "衡\0"
+    "鸡\0"
+    "孙\0"
+    "延\0"
+    "危\0"
+    "胶\0"
+    "屋\0"
+    "乡\0"
+    "临\0"
+    "陆\0"
+    "顾\0"
+    "掉\0"
+    "呀\0"
+    "灯\0"
+    "岁\0"
+    "措\0"
+    "束\0"
+    "耐\0"
+    "剧\0"
+    "玉\0"
+    "赵\0"
+    "跳\0"
+    "哥\0"
+    "季\0"
+    "课\0"
+    "凯\0"
+    "胡\0"
+    "额\0"
+    "款\0"
+    "绍\0"
+    "卷\0"
+    "齐\0"
+    "伟\0"
+    "蒸\0"
+    "殖\0"
+    "永\0"
+    "宗\0"
+    "苗\0"
+    "川\0"
+    "炉\0"
+    "岩\0"
+    "弱\0"
+    "零\0"
+    "杨\0"
+    "奏\0"
+    "沿\0"
+    "露\0"
+    "杆\0"
+    "探\0"
+    "滑\0"
+    "镇\0"
+    "饭\0"
+    "浓\0"
+    "航\0"
+    "怀\0"
+    "赶\0"
+    "库\0"
+    "夺\0"
+    "伊\0"
+    "灵\0"
+    "税\0"
+    "途\0"
+    "灭\0"
+    "赛\0"
+    "归\0"
+    "召\0"
+    "鼓\0"
+    "播\0"
+    "盘\0"
+    "裁\0"
+    "险\0"
+    "康\0"
+    "唯\0"
+    "录\0"
+    "菌\0"
+    "纯\0"
+    "借\0"
+    "糖\0"
+    "盖\0"
+    "横\0"
+    "符\0"
+    "私\0"
+    "努\0"
+    "堂\0"
+    "域\0"
+    "枪\0"
+    "润\0"
+    "幅\0"
+    "哈\0"
+    "竟\0"
+    "熟\0"
+    "虫\0"
+    "泽\0"
+    "脑\0"
+    "壤\0"
+    "碳\0"
+    "欧\0"
+    "遍\0"
+    "侧\0"
+    "寨\0"
+    "敢\0"
+    "彻\0"
+    "虑\0"
+    "斜\0"
+    "薄\0"
+    "庭\0"
+    "纳\0"
+    "弹\0"
+    "饲\0"
+    "伸\0"
+    "折\0"
+    "麦\0"
+    "湿\0"
+    "暗\0"
+    "荷\0"
+    "瓦\0"
+    "塞\0"
+    "床\0"
+    "筑\0"
+    "恶\0"
+    "户\0"
+    "访\0"
+    "塔\0"
+    "奇\0"
+    "透\0"
+    "梁\0"
+    "刀\0"
+    "旋\0"
+    "迹\0"
+    "卡\0"
+    "氯\0"
+    "遇\0"
+    "份\0"
+    "毒\0"
+    "泥\0"
+    "退\0"
+    "洗\0"
+    "摆\0"
+    "灰\0"
+    "彩\0"
+    "卖\0"
+    "耗\0"
+    "夏\0"
+    "择\0"
+    "忙\0"
+    "铜\0"
+    "献\0"
+    "硬\0"
+    "予\0"
+    "繁\0"
+    "圈\0"
+    "雪\0"
+    "函\0"
+    "亦\0"
+    "抽\0"
+    "篇\0"
+    "阵\0"
+    "阴\0"
+    "丁\0"
+    "尺\0"
+    "追\0"
+    "堆\0"
+    "雄\0"
+    "迎\0"
+    "泛\0"
+    "爸\0"
+    "楼\0"
+    "避\0"
+    "谋\0"
+    "吨\0"
+    "野\0"
+    "猪\0"
+    "旗\0"
+    "累\0"
+    "偏\0"
+    "典\0"
+    "馆\0"
+    "索\0"
+    "秦\0"
+    "脂\0"
+    "潮\0"
+    "爷\0"
+    "豆\0"
+    "忽\0"
+    "托\0"
+    "惊\0"
+    "塑\0"
+    "遗\0"
+    "愈\0"
+    "朱\0"
+    "替\0"
+    "纤\0"
+    "粗\0"
+    "倾\0"
+    "尚\0"
+    "痛\0"
+    "楚\0"
+    "谢\0"
+    "奋\0"
+    "购\0"
+    "磨\0"
+    "君\0"
+    "池\0"
+    "旁\0"
+    "碎\0"
+    "骨\0"
+    "监\0"
+    "捕\0"
+    "弟\0"
+    "暴\0"
+    "割\0"
+    "贯\0"
+    "殊\0"
+    "释\0"
+    "词\0"
+    "亡\0"
+    "壁\0"
+    "顿\0"
+    "宝\0"
+    "午\0"
+    "尘\0"
+    "闻\0"
+    "揭\0"
+    "炮\0"
+    "残\0"
+    "冬\0"
+    "桥\0"
+    "妇\0"
+    "警\0"
+    "综\0"
+    "招\0"
+    "吴\0"
+    "付\0"
+    "浮\0"
+    "遭\0"
+    "徐\0"
+    "您\0"
+    "摇\0"
+    "谷\0"
+    "赞\0"
+    "箱\0"
+    "隔\0"
+    "订\0"
+    "男\0"
+    "吹\0"
+    "园\0"
+    "纷\0"
+    "唐\0"
+    "败\0"
+    "宋\0"
+    "玻\0"
+    "巨\0"
+    "耕\0"
+    "坦\0"
+    "荣\0"
+    "闭\0"
+    "湾\0"
+    "键\0"
+    "凡\0"
+    "驻\0"
+    "锅\0"
+    "救\0"
+    "恩\0"
+    "剥\0"
+    "凝\0"
+    "碱\0"
+    "齿\0"
+    "截\0"
+    "炼\0"
+    "麻\0"
+    "纺\0"
+    "禁\0"
+    "废\0"
+    "盛\0"
+    "版\0"
+    "缓\0"
+    "净\0"
+    "睛\0"
+    "昌\0"
+    "婚\0"
+    "涉\0"
+    "筒\0"
+    "嘴\0"
+    "插\0"
+    "岸\0"
+    "朗\0"
+    "庄\0"
+    "街\0"
+    "藏\0"
+    "姑\0"
+    "贸\0"
+    "腐\0"
+    "奴\0"
+    "啦\0"
+    "惯\0"
+    "乘\0"
+    "伙\0"
+    "恢\0"
+    "匀\0"
+    "纱\0"
+    "扎\0"
+    "辩\0"
+    "耳\0"
+    "彪\0"
+    "臣\0"
+    "亿\0"
+    "璃\0"
+    "抵\0"
+    "脉\0"
+    "秀\0"
+    "萨\0"
+    "俄\0"
+    "网\0"
+    "舞\0"
+    "店\0"
+    "喷\0"
+    "纵\0"
+    "寸\0"
+    "汗\0"
+    "挂\0"
+    "洪\0"
+    "贺\0"
+    "闪\0"
+    "柬\0"
+    "爆\0"
+    "烯\0"
+    "津\0"
+    "稻\0"
+    "墙\0"
+    "软\0"
+    "勇\0"
+    "像\0"
+    "滚\0"
+    "厘\0"
+    "蒙\0"
+    "芳\0"
+    "肯\0"
+    "坡\0"
+    "柱\0"
+    "荡\0"
+    "腿\0"
+    "仪\0"
+    "旅\0"
+    "尾\0"
+    "轧\0"
+    "冰\0"
+    "贡\0"
+    "登\0"
+    "黎\0"
+    "削\0"
+    "钻\0"
+    "勒\0"
+    "逃\0"
+    "障\0"
+    "氨\0"
+    "郭\0"
+    "峰\0"
+    "币\0"
+    "港\0"
+    "伏\0"
+    "轨\0"
+    "亩\0"
+    "毕\0"
+    "擦\0"
+    "莫\0"
+    "刺\0"
+    "浪\0"
+    "秘\0"
+    "援\0"
+    "株\0"
+    "健\0"
+    "售\0"
+    "股\0"
+    "岛\0"
+    "甘\0"
+    "泡\0"
+    "睡\0"
+    "童\0"
+    "铸\0"
+    "汤\0"
+    "阀\0"
+    "休\0"
+    "汇\0"
+    "舍\0"
+    "牧\0"
+    "绕\0"
+    "炸\0"
+    "哲\0"
+    "磷\0"
+    "绩\0"
+    "朋\0"
+    "淡\0"
+    "尖\0"
+    "启\0"
+    "陷\0"
+    "柴\0"
+    "呈\0"
+    "徒\0"
+    "颜\0"
+    "泪\0"
+    "稍\0"
+    "忘\0"
+    "泵\0"
+    "蓝\0"
+    "拖\0"
+    "洞\0"
+    "授\0"
+    "镜\0"
+    "辛\0"
+    "壮\0"
+    "锋\0"
+    "贫\0"
+    "虚\0"
+    "弯\0"
+    "摩\0"
+    "泰\0"
+    "幼\0"
+    "廷\0"
+    "尊\0"
+    "窗\0"
+    "纲\0"
+    "弄\0"
+    "隶\0"
+    "疑\0"
+    "氏\0"
+    "宫\0"
+    "姐\0"
+    "震\0"
+    "瑞\0"
+    "怪\0"
+    "尤\0"
+    "琴\0"
+    "循\0"
+    "描\0"
+    "膜\0"
+    "违\0"
+    "夹\0"
+    "腰\0"
+    "缘\0"
+    "珠\0"
+    "穷\0"
+    "森\0"
+    "枝\0"
+    "竹\0"
+    "沟\0"
+    "催\0"
+    "绳\0"
+    "忆\0"
+    "邦\0"
+    "剩\0"
+    "幸\0"
+    "浆\0"
+    "栏\0"
+    "拥\0"
+    "牙\0"
+    "贮\0"
+    "礼\0"
+    "滤\0"
+    "钠\0"
+    "纹\0"
+    "罢\0"
+    "拍\0"
+    "咱\0"
+    "喊\0"
+    "袖\0"
+    "埃\0"
+    "勤\0"
+    "罚\0"
+    "焦\0"
+    "潜\0"
+    "伍\0"
+    "墨\0"
+    "欲\0"
+    "缝\0"
+    "姓\0"
+    "刊\0"
+    "饱\0"
+    "仿\0"
+    "奖\0"
+    "铝\0"
+    "鬼\0"
+    "丽\0"
+    "跨\0"
+    "默\0"
+    "挖\0"
+    "链\0"
+    "扫\0"
+    "喝\0"
+    "袋\0"
+    "炭\0"
+    "污\0"
+    "幕\0"
+    "诸\0"
+    "弧\0"
+    "励\0"
+    "梅\0"
+    "奶\0"
+    "洁\0"
+    "灾\0"
+    "舟\0"
+    "鉴\0"
+    "苯\0"
+    "讼\0"
+    "抱\0"
+    "毁\0"
+    "懂\0"
+    "寒\0"
+    "智\0"
+    "埔\0"
+    "寄\0"
+    "届\0"
+    "跃\0"
+    "渡\0"
+    "挑\0"
+    "丹\0"
+    "艰\0"
+    "贝\0"
+    "碰\0"
+    "拔\0"
+    "爹\0"
+    "戴\0"
+    "码\0"
+    "梦\0"
+    "芽\0"
+    "熔\0"
+    "赤\0"
+    "渔\0"
+    "哭\0"
+    "敬\0"
+    "颗\0"
+    "奔\0"
+    "铅\0"
+    "仲\0"
+    "虎\0"
+    "稀\0"
+    "妹\0"
+    "乏\0"
+    "珍\0"
+    "申\0"
+    "桌\0"
+    "遵\0"
+    "允\0"
+    "隆\0"
+    "螺\0"
+    "仓\0"
+    "魏\0"
+    "锐\0"
+    "晓\0"
+    "氮\0"
+    "兼\0"
+    "隐\0"
+    "碍\0"
+    "赫\0"
+    "拨\0"
+    "忠\0"
+    "肃\0"
+    "缸\0"
+    "牵\0"
+    "抢\0"
+    "博\0"
+    "巧\0"
+    "壳\0"
+    "兄\0"
+    "杜\0"
+    "讯\0"
+    "诚\0"
+    "碧\0"
+    "祥\0"
+    "柯\0"
+    "页\0"
+    "巡\0"
+    "矩\0"
+    "悲\0"
+    "灌\0"
+    "龄\0"
+    "伦\0"
+    "票\0"
+    "寻\0"
+    "桂\0"
+    "铺\0"
+    "圣\0"
+    "恐\0"
+    "恰\0"
+    "郑\0"
+    "趣\0"
+    "抬\0"
+    "荒\0"
+    "腾\0"
+    "贴\0"
+    "柔\0"
+    "滴\0"
+    "猛\0"
+    "阔\0"
+    "辆\0"
+    "妻\0"
+    "填\0"
+    "撤\0"
+    "储\0"
+    "签\0"
+    "闹\0"
+    "扰\0"
+    "紫\0"
+    "砂\0"
+    "递\0"
+    "戏\0"
+    "吊\0"
+    "陶\0"
+    "伐\0"
+    "喂\0"
+    "疗\0"
+    "瓶\0"
+    "婆\0"
+    "抚\0"
+    "臂\0"
+    "摸\0"
+    "忍\0"
+    "虾\0"
+    "蜡\0"
+    "邻\0"
+    "胸\0"
+    "巩\0"
+    "挤\0"
+    "偶\0"
+    "弃\0"
+    "槽\0"
+    "劲\0"
+    "乳\0"
+    "邓\0"
+    "吉\0"
+    "仁\0"
+    "烂\0"
+    "砖\0"
+    "租\0"
+    "乌\0"
+    "舰\0"
+    "伴\0"
+    "瓜\0"
+    "浅\0"
+    "丙\0"
+    "暂\0"
+    "燥\0"
+    "橡\0"
+    "柳\0"
+    "迷\0"
+    "暖\0"
+    "牌\0"
+    "秧\0"
+    "胆\0"
+    "详\0"
+    "簧\0"
+    "踏\0"
+    "瓷\0"
+    "谱\0"
+    "呆\0"
+    "宾\0"
+    "糊\0"
+    "洛\0"
+    "辉\0"
+    "愤\0"
+    "竞\0"
+    "隙\0"
+    "怒\0"
+    "粘\0"
+    "乃\0"
+    "绪\0"
+    "肩\0"
+    "籍\0"
+    "敏\0"
+    "涂\0"
+    "熙\0"
+    "皆\0"
+    "侦\0"
+    "悬\0"
+    "掘\0"
+    "享\0"
+    "纠\0"
+    "醒\0"
+    "狂\0"
+    "锁\0"
+    "淀\0"
+    "恨\0"
+    "牲\0"
+    "霸\0"
+    "爬\0"
+    "赏\0"
+    "逆\0"
+    "玩\0"
+    "陵\0"
+    "祝\0"
+    "秒\0"
+    "浙\0"
+    "貌\0"
+    "役\0"
+    "彼\0"
+    "悉\0"
+    "鸭\0"
+    "趋\0"
+    "凤\0"
+    "晨\0"
+    "畜\0"
+    "辈\0"
+    "秩\0"
+    "卵\0"
+    "署\0"
+    "梯\0"
+    "炎\0"
+    "滩\0"
+    "棋\0"
+    "驱\0"
+    "筛\0"
+    "峡\0"
+    "冒\0"
+    "啥\0"
+    "寿\0"
+    "译\0"
+    "浸\0"
+    "泉\0"
+    "帽\0"
+    "迟\0"
+    "硅\0"
+    "疆\0"
+    "贷\0"
+    "漏\0"
+    "稿\0"
+    "冠\0"
+    "嫩\0"
+    "胁\0"
+    "芯\0"
+    "牢\0"
+    "叛\0"
+    "蚀\0"
+    "奥\0"
+    "鸣\0"
+    "岭\0"
+    "羊\0"
+    "凭\0"
+    "串\0"
+    "塘\0"
+    "绘\0"
+    "酵\0"
+    "融\0"
+    "盆\0"
+    "锡\0"
+    "庙\0"
+    "筹\0"
+    "冻\0"
+    "辅\0"
+    "摄\0"
+    "袭\0"
+    "筋\0"
+    "拒\0"
+    "僚\0"
+    "旱\0"
+    "钾\0"
+    "鸟\0"
+    "漆\0"
+    "沈\0"
+    "眉\0"
+    "疏\0"
+    "添\0"
+    "棒\0"
+    "穗\0"
+    "硝\0"
+    "韩\0"
+    "逼\0"
+    "扭\0"
+    "侨\0"
+    "凉\0"
+    "挺\0"
+    "碗\0"
+    "栽\0"
+    "炒\0"
+    "杯\0"
+    "患\0"
+    "馏\0"
+    "劝\0"
+    "豪\0"
+    "辽\0"
+    "勃\0"
+    "鸿\0"
+    "旦\0"
+    "吏\0"
+    "拜\0"
+    "狗\0"
+    "埋\0"
+    "辊\0"
+    "掩\0"
+    "饮\0"
+    "搬\0"
+    "骂\0"
+    "辞\0"
+    "勾\0"
+    "扣\0"
+    "估\0"
+    "蒋\0"
+    "绒\0"
+    "雾\0"
+    "丈\0"
+    "朵\0"
+    "姆\0"
+    "拟\0"
+    "宇\0"
+    "辑\0"
+    "陕\0"
+    "雕\0"
+    "偿\0"
+    "蓄\0"
+    "崇\0"
+    "剪\0"
+    "倡\0"
+    "厅\0"
+    "咬\0"
+    "驶\0"
+    "薯\0"
+    "刷\0"
+    "斥\0"
+    "番\0"
+    "赋\0"
+    "奉\0"
+    "佛\0"
+    "浇\0"
+    "漫\0"
+    "曼\0"
+    "扇\0"
+    "钙\0"
+    "桃\0"
+    "扶\0"
+    "仔\0"
+    "返\0"
+    "俗\0"
+    "亏\0"
+    "腔\0"
+    "鞋\0"
+    "棱\0"
+    "覆\0"
+    "框\0"
+    "悄\0"
+    "叔\0"
+    "撞\0"
+    "骗\0"
+    "勘\0"
+    "旺\0"
+    "沸\0"
+    "孤\0"
+    "吐\0"
+    "孟\0"
+    "渠\0"
+    "屈\0"
+    "疾\0"
+    "妙\0"
+    "惜\0"
+    "仰\0"
+    "狠\0"
+    "胀\0"
+    "谐\0"
+    "抛\0"
+    "霉\0"
+    "桑\0"
+    "岗\0"
+    "嘛\0"
+    "衰\0"
+    "盗\0"
+    "渗\0"
+    "脏\0"
+    "赖\0"
+    "涌\0"
+    "甜\0"
+    "曹\0"
+    "阅\0"
+    "肌\0"
+    "哩\0"
+    "厉\0"
+    "烃\0"
+    "纬\0"
+    "毅\0"
+    "昨\0"
+    "伪\0"
+    "症\0"
+    "煮\0"
+    "叹\0"
+    "钉\0"
+    "搭\0"
+    "茎\0"
+    "笼\0"
+    "酷\0"
+    "偷\0"
+    "弓\0"
+    "锥\0"
+    "恒\0"
+    "杰\0"
+    "坑\0"
+    "鼻\0"
+    "翼\0"
+    "纶\0"
+    "叙\0"
+    "狱\0"
+    "逮\0"
+    "罐\0"
+    "络\0"
+    "棚\0"
+    "抑\0"
+    "膨\0"
+    "蔬\0"
+    "寺\0"
+    "骤\0"
+    "穆\0"
+    "冶\0"
+    "枯\0"
+    "册\0"
+    "尸\0"
+    "凸\0"
+    "绅\0"
+    "坯\0"
+    "牺\0"
+    "焰\0"
+    "轰\0"
+    "欣\0"
+    "晋\0"
+    "瘦\0"
+    "御\0"
+    "锭\0"
+    "锦\0"
+    "丧\0"
+    "旬\0"
+    "锻\0"
+    "垄\0"
+    "搜\0"
+    "扑\0"
+    "邀\0"
+    "亭\0"
+    "酯\0"
+    "迈\0"
+    "舒\0"
+    "脆\0"
+    "酶\0"
+    "闲\0"
+    "忧\0"
+    "酚\0"
+    "顽\0"
+    "羽\0"
+    "涨\0"
+    "卸\0"
+    "仗\0"
+    "陪\0"
+    "辟\0"
+    "惩\0"
+    "杭\0"
+    "姚\0"
+    "肚\0"
+    "捉\0"
+    "飘\0"
+    "漂\0"
+    "昆\0"
+    "欺\0"
+    "吾\0"
+    "郎\0"
+    "烷\0"
+    "汁\0"
+    "呵\0"
+    "饰\0"
+    "萧\0"
+    "雅\0"
+    "邮\0"
+    "迁\0"
+    "燕\0"
+    "撒\0"
+    "姻\0"
+    "赴\0"
+    "宴\0"
+    "烦\0"
+    "债\0"
+    "帐\0"
+    "斑\0"
+    "铃\0"
+    "旨\0"
+    "醇\0"
+    "董\0"
+    "饼\0"
+    "雏\0"
+    "姿\0"
+    "拌\0"
+    "傅\0"
+    "腹\0"
+    "妥\0"
+    "揉\0"
+    "贤\0"
+    "拆\0"
+    "歪\0"
+    "葡\0"
+    "胺\0"
+    "丢\0"
+    "浩\0"
+    "徽\0"
+    "昂\0"
+    "垫\0"
+    "挡\0"
+    "览\0"
+    "贪\0"
+    "慰\0"
+    "缴\0"
+    "汪\0"
+    "慌\0"
+    "冯\0"
+    "诺\0"
+    "姜\0"
+    "谊\0"
+    "凶\0"
+    "劣\0"
+    "诬\0"
+    "耀\0"
+    "昏\0"
+    "躺\0"
+    "盈\0"
+    "骑\0"
+    "乔\0"
+    "溪\0"
+    "丛\0"
+    "卢\0"
+    "抹\0"
+    "闷\0"
+    "咨\0"
+    "刮\0"
+    "驾\0"
+    "缆\0"
+    "悟\0"
+    "摘\0"
+    "铒\0"
+    "掷\0"
+    "颇\0"
+    "幻\0"
+    "柄\0"
+    "惠\0"
+    "惨\0"
+    "佳\0"
+    "仇\0"
+    "腊\0"
+    "窝\0"
+    "涤\0"
+    "剑\0"
+    "瞧\0"
+    "堡\0"
+    "泼\0"
+    "葱\0"
+    "罩\0"
+    "霍\0"
+    "捞\0"
+    "胎\0"
+    "苍\0"
+    "滨\0"
+    "俩\0"
+    "捅\0"
+    "湘\0"
+    "砍\0"
+    "霞\0"
+    "邵\0"
+    "萄\0"
+    "疯\0"
+    "淮\0"
+    "遂\0"
+    "熊\0"
+    "粪\0"
+    "烘\0"
+    "宿\0"
+    "档\0"
+    "戈\0"
+    "驳\0"
+    "嫂\0"
+    "裕\0"
+    "徙\0"
+    "箭\0"
+    "捐\0"
+    "肠\0"
+    "撑\0"
+    "晒\0"
+    "辨\0"
+    "殿\0"
+    "莲\0"
+    "摊\0"
+    "搅\0"
+    "酱\0"
+    "屏\0"
+    "疫\0"
+    "哀\0"
+    "蔡\0"
+    "堵\0"
+    "沫\0"
+    "皱\0"
+    "畅\0"
+    "叠\0"
+    "阁\0"
+    "莱\0"
+    "敲\0"
+    "辖\0"
+    "钩\0"
+    "痕\0"
+    "坝\0"
+    "巷\0"
+    "饿\0"
+    "祸\0"
+    "丘\0"
+    "玄\0"
+    "溜\0"
+    "曰\0"
+    "逻\0"
+    "彭\0"
+    "尝\0"
+    "卿\0"
+    "妨\0"
+    "艇\0"
+    "吞\0"
+    "韦\0"
+    "怨\0"
+    "矮\0"
+    "歇";
+
+static const uint16_t zh_Hans_offsets[dictionary_size] =
 {
-    {
-        "的",
-        "一",
-        "是",
-        "在",
-        "不",
-        "了",
-        "有",
-        "和",
-        "人",
-        "这",
-        "中",
-        "大",
-        "为",
-        "上",
-        "个",
-        "国",
-        "我",
-        "以",
-        "要",
-        "他",
-        "时",
-        "来",
-        "用",
-        "们",
-        "生",
-        "到",
-        "作",
-        "地",
-        "于",
-        "出",
-        "就",
-        "分",
-        "对",
-        "成",
-        "会",
-        "可",
-        "主",
-        "发",
-        "年",
-        "动",
-        "同",
-        "工",
-        "也",
-        "能",
-        "下",
-        "过",
-        "子",
-        "说",
-        "产",
-        "种",
-        "面",
-        "而",
-        "方",
-        "后",
-        "多",
-        "定",
-        "行",
-        "学",
-        "法",
-        "所",
-        "民",
-        "得",
-        "经",
-        "十",
-        "三",
-        "之",
-        "进",
-        "着",
-        "等",
-        "部",
-        "度",
-        "家",
-        "电",
-        "力",
-        "里",
-        "如",
-        "水",
-        "化",
-        "高",
-        "自",
-        "二",
-        "理",
-        "起",
-        "小",
-        "物",
-        "现",
-        "实",
-        "加",
-        "量",
-        "都",
-        "两",
-        "体",
-        "制",
-        "机",
-        "当",
-        "使",
-        "点",
-        "从",
-        "业",
-        "本",
-        "去",
-        "把",
-        "性",
-        "好",
-        "应",
-        "开",
-        "它",
-        "合",
-        "还",
-        "因",
-        "由",
-        "其",
-        "些",
-        "然",
-        "前",
-        "外",
-        "天",
-        "政",
-        "四",
-        "日",
-        "那",
-        "社",
-        "义",
-        "事",
-        "平",
-        "形",
-        "相",
-        "全",
-        "表",
-        "间",
-        "样",
-        "与",
-        "关",
-        "各",
-        "重",
-        "新",
-        "线",
-        "内",
-        "数",
-        "正",
-        "心",
-        "反",
-        "你",
-        "明",
-        "看",
-        "原",
-        "又",
-        "么",
-        "利",
-        "比",
-        "或",
-        "但",
-        "质",
-        "气",
-        "第",
-        "向",
-        "道",
-        "命",
-        "此",
-        "变",
-        "条",
-        "只",
-        "没",
-        "结",
-        "解",
-        "问",
-        "意",
-        "建",
-        "月",
-        "公",
-        "无",
-        "系",
-        "军",
-        "很",
-        "情",
-        "者",
-        "最",
-        "立",
-        "代",
-        "想",
-        "已",
-        "通",
-        "并",
-        "提",
-        "直",
-        "题",
-        "党",
-        "程",
-        "展",
-        "五",
-        "果",
-        "料",
-        "象",
-        "员",
-        "革",
-        "位",
-        "入",
-        "常",
-        "文",
-        "总",
-        "次",
-        "品",
-        "式",
-        "活",
-        "设",
-        "及",
-        "管",
-        "特",
-        "件",
-        "长",
-        "求",
-        "老",
-        "头",
-        "基",
-        "资",
-        "边",
-        "流",
-        "路",
-        "级",
-        "少",
-        "图",
-        "山",
-        "统",
-        "接",
-        "知",
-        "较",
-        "将",
-        "组",
-        "见",
-        "计",
-        "别",
-        "她",
-        "手",
-        "角",
-        "期",
-        "根",
-        "论",
-        "运",
-        "农",
-        "指",
-        "几",
-        "九",
-        "区",
-        "强",
-        "放",
-        "决",
-        "西",
-        "被",
-        "干",
-        "做",
-        "必",
-        "战",
-        "先",
-        "回",
-        "则",
-        "任",
-        "取",
-        "据",
-        "处",
-        "队",
-        "南",
-        "给",
-        "色",
-        "光",
-        "门",
-        "即",
-        "保",
-        "治",
-        "北",
-        "造",
-        "百",
-        "规",
-        "热",
-        "领",
-        "七",
-        "海",
-        "口",
-        "东",
-        "导",
-        "器",
-        "压",
-        "志",
-        "世",
-        "金",
-        "增",
-        "争",
-        "济",
-        "阶",
-        "油",
-        "思",
-        "术",
-        "极",
-        "交",
-        "受",
-        "联",
-        "什",
-        "认",
-        "六",
-        "共",
-        "权",
-        "收",
-        "证",
-        "改",
-        "清",
-        "美",
-        "再",
-        "采",
-        "转",
-        "更",
-        "单",
-        "风",
-        "切",
-        "打",
-        "白",
-        "教",
-        "速",
-        "花",
-        "带",
-        "安",
-        "场",
-        "身",
-        "车",
-        "例",
-        "真",
-        "务",
-        "具",
-        "万",
-        "每",
-        "目",
-        "至",
-        "达",
-        "走",
-        "积",
-        "示",
-        "议",
-        "声",
-        "报",
-        "斗",
-        "完",
-        "类",
-        "八",
-        "离",
-        "华",
-        "名",
-        "确",
-        "才",
-        "科",
-        "张",
-        "信",
-        "马",
-        "节",
-        "话",
-        "米",
-        "整",
-        "空",
-        "元",
-        "况",
-        "今",
-        "集",
-        "温",
-        "传",
-        "土",
-        "许",
-        "步",
-        "群",
-        "广",
-        "石",
-        "记",
-        "需",
-        "段",
-        "研",
-        "界",
-        "拉",
-        "林",
-        "律",
-        "叫",
-        "且",
-        "究",
-        "观",
-        "越",
-        "织",
-        "装",
-        "影",
-        "算",
-        "低",
-        "持",
-        "音",
-        "众",
-        "书",
-        "布",
-        "复",
-        "容",
-        "儿",
-        "须",
-        "际",
-        "商",
-        "非",
-        "验",
-        "连",
-        "断",
-        "深",
-        "难",
-        "近",
-        "矿",
-        "千",
-        "周",
-        "委",
-        "素",
-        "技",
-        "备",
-        "半",
-        "办",
-        "青",
-        "省",
-        "列",
-        "习",
-        "响",
-        "约",
-        "支",
-        "般",
-        "史",
-        "感",
-        "劳",
-        "便",
-        "团",
-        "往",
-        "酸",
-        "历",
-        "市",
-        "克",
-        "何",
-        "除",
-        "消",
-        "构",
-        "府",
-        "称",
-        "太",
-        "准",
-        "精",
-        "值",
-        "号",
-        "率",
-        "族",
-        "维",
-        "划",
-        "选",
-        "标",
-        "写",
-        "存",
-        "候",
-        "毛",
-        "亲",
-        "快",
-        "效",
-        "斯",
-        "院",
-        "查",
-        "江",
-        "型",
-        "眼",
-        "王",
-        "按",
-        "格",
-        "养",
-        "易",
-        "置",
-        "派",
-        "层",
-        "片",
-        "始",
-        "却",
-        "专",
-        "状",
-        "育",
-        "厂",
-        "京",
-        "识",
-        "适",
-        "属",
-        "圆",
-        "包",
-        "火",
-        "住",
-        "调",
-        "满",
-        "县",
-        "局",
-        "照",
-        "参",
-        "红",
-        "细",
-        "引",
-        "听",
-        "该",
-        "铁",
-        "价",
-        "严",
-        "首",
-        "底",
-        "液",
-        "官",
-        "德",
-        "随",
-        "病",
-        "苏",
-        "失",
-        "尔",
-        "死",
-        "讲",
-        "配",
-        "女",
-        "黄",
-        "推",
-        "显",
-        "谈",
-        "罪",
-        "神",
-        "艺",
-        "呢",
-        "席",
-        "含",
-        "企",
-        "望",
-        "密",
-        "批",
-        "营",
-        "项",
-        "防",
-        "举",
-        "球",
-        "英",
-        "氧",
-        "势",
-        "告",
-        "李",
-        "台",
-        "落",
-        "木",
-        "帮",
-        "轮",
-        "破",
-        "亚",
-        "师",
-        "围",
-        "注",
-        "远",
-        "字",
-        "材",
-        "排",
-        "供",
-        "河",
-        "态",
-        "封",
-        "另",
-        "施",
-        "减",
-        "树",
-        "溶",
-        "怎",
-        "止",
-        "案",
-        "言",
-        "士",
-        "均",
-        "武",
-        "固",
-        "叶",
-        "鱼",
-        "波",
-        "视",
-        "仅",
-        "费",
-        "紧",
-        "爱",
-        "左",
-        "章",
-        "早",
-        "朝",
-        "害",
-        "续",
-        "轻",
-        "服",
-        "试",
-        "食",
-        "充",
-        "兵",
-        "源",
-        "判",
-        "护",
-        "司",
-        "足",
-        "某",
-        "练",
-        "差",
-        "致",
-        "板",
-        "田",
-        "降",
-        "黑",
-        "犯",
-        "负",
-        "击",
-        "范",
-        "继",
-        "兴",
-        "似",
-        "余",
-        "坚",
-        "曲",
-        "输",
-        "修",
-        "故",
-        "城",
-        "夫",
-        "够",
-        "送",
-        "笔",
-        "船",
-        "占",
-        "右",
-        "财",
-        "吃",
-        "富",
-        "春",
-        "职",
-        "觉",
-        "汉",
-        "画",
-        "功",
-        "巴",
-        "跟",
-        "虽",
-        "杂",
-        "飞",
-        "检",
-        "吸",
-        "助",
-        "升",
-        "阳",
-        "互",
-        "初",
-        "创",
-        "抗",
-        "考",
-        "投",
-        "坏",
-        "策",
-        "古",
-        "径",
-        "换",
-        "未",
-        "跑",
-        "留",
-        "钢",
-        "曾",
-        "端",
-        "责",
-        "站",
-        "简",
-        "述",
-        "钱",
-        "副",
-        "尽",
-        "帝",
-        "射",
-        "草",
-        "冲",
-        "承",
-        "独",
-        "令",
-        "限",
-        "阿",
-        "宣",
-        "环",
-        "双",
-        "请",
-        "超",
-        "微",
-        "让",
-        "控",
-        "州",
-        "良",
-        "轴",
-        "找",
-        "否",
-        "纪",
-        "益",
-        "依",
-        "优",
-        "顶",
-        "础",
-        "载",
-        "倒",
-        "房",
-        "突",
-        "坐",
-        "粉",
-        "敌",
-        "略",
-        "客",
-        "袁",
-        "冷",
-        "胜",
-        "绝",
-        "析",
-        "块",
-        "剂",
-        "测",
-        "丝",
-        "协",
-        "诉",
-        "念",
-        "陈",
-        "仍",
-        "罗",
-        "盐",
-        "友",
-        "洋",
-        "错",
-        "苦",
-        "夜",
-        "刑",
-        "移",
-        "频",
-        "逐",
-        "靠",
-        "混",
-        "母",
-        "短",
-        "皮",
-        "终",
-        "聚",
-        "汽",
-        "村",
-        "云",
-        "哪",
-        "既",
-        "距",
-        "卫",
-        "停",
-        "烈",
-        "央",
-        "察",
-        "烧",
-        "迅",
-        "境",
-        "若",
-        "印",
-        "洲",
-        "刻",
-        "括",
-        "激",
-        "孔",
-        "搞",
-        "甚",
-        "室",
-        "待",
-        "核",
-        "校",
-        "散",
-        "侵",
-        "吧",
-        "甲",
-        "游",
-        "久",
-        "菜",
-        "味",
-        "旧",
-        "模",
-        "湖",
-        "货",
-        "损",
-        "预",
-        "阻",
-        "毫",
-        "普",
-        "稳",
-        "乙",
-        "妈",
-        "植",
-        "息",
-        "扩",
-        "银",
-        "语",
-        "挥",
-        "酒",
-        "守",
-        "拿",
-        "序",
-        "纸",
-        "医",
-        "缺",
-        "雨",
-        "吗",
-        "针",
-        "刘",
-        "啊",
-        "急",
-        "唱",
-        "误",
-        "训",
-        "愿",
-        "审",
-        "附",
-        "获",
-        "茶",
-        "鲜",
-        "粮",
-        "斤",
-        "孩",
-        "脱",
-        "硫",
-        "肥",
-        "善",
-        "龙",
-        "演",
-        "父",
-        "渐",
-        "血",
-        "欢",
-        "械",
-        "掌",
-        "歌",
-        "沙",
-        "刚",
-        "攻",
-        "谓",
-        "盾",
-        "讨",
-        "晚",
-        "粒",
-        "乱",
-        "燃",
-        "矛",
-        "乎",
-        "杀",
-        "药",
-        "宁",
-        "鲁",
-        "贵",
-        "钟",
-        "煤",
-        "读",
-        "班",
-        "伯",
-        "香",
-        "介",
-        "迫",
-        "句",
-        "丰",
-        "培",
-        "握",
-        "兰",
-        "担",
-        "弦",
-        "蛋",
-        "沉",
-        "假",
-        "穿",
-        "执",
-        "答",
-        "乐",
-        "谁",
-        "顺",
-        "烟",
-        "缩",
-        "征",
-        "脸",
-        "喜",
-        "松",
-        "脚",
-        "困",
-        "异",
-        "免",
-        "背",
-        "星",
-        "福",
-        "买",
-        "染",
-        "井",
-        "概",
-        "慢",
-        "怕",
-        "磁",
-        "倍",
-        "祖",
-        "皇",
-        "促",
-        "静",
-        "补",
-        "评",
-        "翻",
-        "肉",
-        "践",
-        "尼",
-        "衣",
-        "宽",
-        "扬",
-        "棉",
-        "希",
-        "伤",
-        "操",
-        "垂",
-        "秋",
-        "宜",
-        "氢",
-        "套",
-        "督",
-        "振",
-        "架",
-        "亮",
-        "末",
-        "宪",
-        "庆",
-        "编",
-        "牛",
-        "触",
-        "映",
-        "雷",
-        "销",
-        "诗",
-        "座",
-        "居",
-        "抓",
-        "裂",
-        "胞",
-        "呼",
-        "娘",
-        "景",
-        "威",
-        "绿",
-        "晶",
-        "厚",
-        "盟",
-        "衡",
-        "鸡",
-        "孙",
-        "延",
-        "危",
-        "胶",
-        "屋",
-        "乡",
-        "临",
-        "陆",
-        "顾",
-        "掉",
-        "呀",
-        "灯",
-        "岁",
-        "措",
-        "束",
-        "耐",
-        "剧",
-        "玉",
-        "赵",
-        "跳",
-        "哥",
-        "季",
-        "课",
-        "凯",
-        "胡",
-        "额",
-        "款",
-        "绍",
-        "卷",
-        "齐",
-        "伟",
-        "蒸",
-        "殖",
-        "永",
-        "宗",
-        "苗",
-        "川",
-        "炉",
-        "岩",
-        "弱",
-        "零",
-        "杨",
-        "奏",
-        "沿",
-        "露",
-        "杆",
-        "探",
-        "滑",
-        "镇",
-        "饭",
-        "浓",
-        "航",
-        "怀",
-        "赶",
-        "库",
-        "夺",
-        "伊",
-        "灵",
-        "税",
-        "途",
-        "灭",
-        "赛",
-        "归",
-        "召",
-        "鼓",
-        "播",
-        "盘",
-        "裁",
-        "险",
-        "康",
-        "唯",
-        "录",
-        "菌",
-        "纯",
-        "借",
-        "糖",
-        "盖",
-        "横",
-        "符",
-        "私",
-        "努",
-        "堂",
-        "域",
-        "枪",
-        "润",
-        "幅",
-        "哈",
-        "竟",
-        "熟",
-        "虫",
-        "泽",
-        "脑",
-        "壤",
-        "碳",
-        "欧",
-        "遍",
-        "侧",
-        "寨",
-        "敢",
-        "彻",
-        "虑",
-        "斜",
-        "薄",
-        "庭",
-        "纳",
-        "弹",
-        "饲",
-        "伸",
-        "折",
-        "麦",
-        "湿",
-        "暗",
-        "荷",
-        "瓦",
-        "塞",
-        "床",
-        "筑",
-        "恶",
-        "户",
-        "访",
-        "塔",
-        "奇",
-        "透",
-        "梁",
-        "刀",
-        "旋",
-        "迹",
-        "卡",
-        "氯",
-        "遇",
-        "份",
-        "毒",
-        "泥",
-        "退",
-        "洗",
-        "摆",
-        "灰",
-        "彩",
-        "卖",
-        "耗",
-        "夏",
-        "择",
-        "忙",
-        "铜",
-        "献",
-        "硬",
-        "予",
-        "繁",
-        "圈",
-        "雪",
-        "函",
-        "亦",
-        "抽",
-        "篇",
-        "阵",
-        "阴",
-        "丁",
-        "尺",
-        "追",
-        "堆",
-        "雄",
-        "迎",
-        "泛",
-        "爸",
-        "楼",
-        "避",
-        "谋",
-        "吨",
-        "野",
-        "猪",
-        "旗",
-        "累",
-        "偏",
-        "典",
-        "馆",
-        "索",
-        "秦",
-        "脂",
-        "潮",
-        "爷",
-        "豆",
-        "忽",
-        "托",
-        "惊",
-        "塑",
-        "遗",
-        "愈",
-        "朱",
-        "替",
-        "纤",
-        "粗",
-        "倾",
-        "尚",
-        "痛",
-        "楚",
-        "谢",
-        "奋",
-        "购",
-        "磨",
-        "君",
-        "池",
-        "旁",
-        "碎",
-        "骨",
-        "监",
-        "捕",
-        "弟",
-        "暴",
-        "割",
-        "贯",
-        "殊",
-        "释",
-        "词",
-        "亡",
-        "壁",
-        "顿",
-        "宝",
-        "午",
-        "尘",
-        "闻",
-        "揭",
-        "炮",
-        "残",
-        "冬",
-        "桥",
-        "妇",
-        "警",
-        "综",
-        "招",
-        "吴",
-        "付",
-        "浮",
-        "遭",
-        "徐",
-        "您",
-        "摇",
-        "谷",
-        "赞",
-        "箱",
-        "隔",
-        "订",
-        "男",
-        "吹",
-        "园",
-        "纷",
-        "唐",
-        "败",
-        "宋",
-        "玻",
-        "巨",
-        "耕",
-        "坦",
-        "荣",
-        "闭",
-        "湾",
-        "键",
-        "凡",
-        "驻",
-        "锅",
-        "救",
-        "恩",
-        "剥",
-        "凝",
-        "碱",
-        "齿",
-        "截",
-        "炼",
-        "麻",
-        "纺",
-        "禁",
-        "废",
-        "盛",
-        "版",
-        "缓",
-        "净",
-        "睛",
-        "昌",
-        "婚",
-        "涉",
-        "筒",
-        "嘴",
-        "插",
-        "岸",
-        "朗",
-        "庄",
-        "街",
-        "藏",
-        "姑",
-        "贸",
-        "腐",
-        "奴",
-        "啦",
-        "惯",
-        "乘",
-        "伙",
-        "恢",
-        "匀",
-        "纱",
-        "扎",
-        "辩",
-        "耳",
-        "彪",
-        "臣",
-        "亿",
-        "璃",
-        "抵",
-        "脉",
-        "秀",
-        "萨",
-        "俄",
-        "网",
-        "舞",
-        "店",
-        "喷",
-        "纵",
-        "寸",
-        "汗",
-        "挂",
-        "洪",
-        "贺",
-        "闪",
-        "柬",
-        "爆",
-        "烯",
-        "津",
-        "稻",
-        "墙",
-        "软",
-        "勇",
-        "像",
-        "滚",
-        "厘",
-        "蒙",
-        "芳",
-        "肯",
-        "坡",
-        "柱",
-        "荡",
-        "腿",
-        "仪",
-        "旅",
-        "尾",
-        "轧",
-        "冰",
-        "贡",
-        "登",
-        "黎",
-        "削",
-        "钻",
-        "勒",
-        "逃",
-        "障",
-        "氨",
-        "郭",
-        "峰",
-        "币",
-        "港",
-        "伏",
-        "轨",
-        "亩",
-        "毕",
-        "擦",
-        "莫",
-        "刺",
-        "浪",
-        "秘",
-        "援",
-        "株",
-        "健",
-        "售",
-        "股",
-        "岛",
-        "甘",
-        "泡",
-        "睡",
-        "童",
-        "铸",
-        "汤",
-        "阀",
-        "休",
-        "汇",
-        "舍",
-        "牧",
-        "绕",
-        "炸",
-        "哲",
-        "磷",
-        "绩",
-        "朋",
-        "淡",
-        "尖",
-        "启",
-        "陷",
-        "柴",
-        "呈",
-        "徒",
-        "颜",
-        "泪",
-        "稍",
-        "忘",
-        "泵",
-        "蓝",
-        "拖",
-        "洞",
-        "授",
-        "镜",
-        "辛",
-        "壮",
-        "锋",
-        "贫",
-        "虚",
-        "弯",
-        "摩",
-        "泰",
-        "幼",
-        "廷",
-        "尊",
-        "窗",
-        "纲",
-        "弄",
-        "隶",
-        "疑",
-        "氏",
-        "宫",
-        "姐",
-        "震",
-        "瑞",
-        "怪",
-        "尤",
-        "琴",
-        "循",
-        "描",
-        "膜",
-        "违",
-        "夹",
-        "腰",
-        "缘",
-        "珠",
-        "穷",
-        "森",
-        "枝",
-        "竹",
-        "沟",
-        "催",
-        "绳",
-        "忆",
-        "邦",
-        "剩",
-        "幸",
-        "浆",
-        "栏",
-        "拥",
-        "牙",
-        "贮",
-        "礼",
-        "滤",
-        "钠",
-        "纹",
-        "罢",
-        "拍",
-        "咱",
-        "喊",
-        "袖",
-        "埃",
-        "勤",
-        "罚",
-        "焦",
-        "潜",
-        "伍",
-        "墨",
-        "欲",
-        "缝",
-        "姓",
-        "刊",
-        "饱",
-        "仿",
-        "奖",
-        "铝",
-        "鬼",
-        "丽",
-        "跨",
-        "默",
-        "挖",
-        "链",
-        "扫",
-        "喝",
-        "袋",
-        "炭",
-        "污",
-        "幕",
-        "诸",
-        "弧",
-        "励",
-        "梅",
-        "奶",
-        "洁",
-        "灾",
-        "舟",
-        "鉴",
-        "苯",
-        "讼",
-        "抱",
-        "毁",
-        "懂",
-        "寒",
-        "智",
-        "埔",
-        "寄",
-        "届",
-        "跃",
-        "渡",
-        "挑",
-        "丹",
-        "艰",
-        "贝",
-        "碰",
-        "拔",
-        "爹",
-        "戴",
-        "码",
-        "梦",
-        "芽",
-        "熔",
-        "赤",
-        "渔",
-        "哭",
-        "敬",
-        "颗",
-        "奔",
-        "铅",
-        "仲",
-        "虎",
-        "稀",
-        "妹",
-        "乏",
-        "珍",
-        "申",
-        "桌",
-        "遵",
-        "允",
-        "隆",
-        "螺",
-        "仓",
-        "魏",
-        "锐",
-        "晓",
-        "氮",
-        "兼",
-        "隐",
-        "碍",
-        "赫",
-        "拨",
-        "忠",
-        "肃",
-        "缸",
-        "牵",
-        "抢",
-        "博",
-        "巧",
-        "壳",
-        "兄",
-        "杜",
-        "讯",
-        "诚",
-        "碧",
-        "祥",
-        "柯",
-        "页",
-        "巡",
-        "矩",
-        "悲",
-        "灌",
-        "龄",
-        "伦",
-        "票",
-        "寻",
-        "桂",
-        "铺",
-        "圣",
-        "恐",
-        "恰",
-        "郑",
-        "趣",
-        "抬",
-        "荒",
-        "腾",
-        "贴",
-        "柔",
-        "滴",
-        "猛",
-        "阔",
-        "辆",
-        "妻",
-        "填",
-        "撤",
-        "储",
-        "签",
-        "闹",
-        "扰",
-        "紫",
-        "砂",
-        "递",
-        "戏",
-        "吊",
-        "陶",
-        "伐",
-        "喂",
-        "疗",
-        "瓶",
-        "婆",
-        "抚",
-        "臂",
-        "摸",
-        "忍",
-        "虾",
-        "蜡",
-        "邻",
-        "胸",
-        "巩",
-        "挤",
-        "偶",
-        "弃",
-        "槽",
-        "劲",
-        "乳",
-        "邓",
-        "吉",
-        "仁",
-        "烂",
-        "砖",
-        "租",
-        "乌",
-        "舰",
-        "伴",
-        "瓜",
-        "浅",
-        "丙",
-        "暂",
-        "燥",
-        "橡",
-        "柳",
-        "迷",
-        "暖",
-        "牌",
-        "秧",
-        "胆",
-        "详",
-        "簧",
-        "踏",
-        "瓷",
-        "谱",
-        "呆",
-        "宾",
-        "糊",
-        "洛",
-        "辉",
-        "愤",
-        "竞",
-        "隙",
-        "怒",
-        "粘",
-        "乃",
-        "绪",
-        "肩",
-        "籍",
-        "敏",
-        "涂",
-        "熙",
-        "皆",
-        "侦",
-        "悬",
-        "掘",
-        "享",
-        "纠",
-        "醒",
-        "狂",
-        "锁",
-        "淀",
-        "恨",
-        "牲",
-        "霸",
-        "爬",
-        "赏",
-        "逆",
-        "玩",
-        "陵",
-        "祝",
-        "秒",
-        "浙",
-        "貌",
-        "役",
-        "彼",
-        "悉",
-        "鸭",
-        "趋",
-        "凤",
-        "晨",
-        "畜",
-        "辈",
-        "秩",
-        "卵",
-        "署",
-        "梯",
-        "炎",
-        "滩",
-        "棋",
-        "驱",
-        "筛",
-        "峡",
-        "冒",
-        "啥",
-        "寿",
-        "译",
-        "浸",
-        "泉",
-        "帽",
-        "迟",
-        "硅",
-        "疆",
-        "贷",
-        "漏",
-        "稿",
-        "冠",
-        "嫩",
-        "胁",
-        "芯",
-        "牢",
-        "叛",
-        "蚀",
-        "奥",
-        "鸣",
-        "岭",
-        "羊",
-        "凭",
-        "串",
-        "塘",
-        "绘",
-        "酵",
-        "融",
-        "盆",
-        "锡",
-        "庙",
-        "筹",
-        "冻",
-        "辅",
-        "摄",
-        "袭",
-        "筋",
-        "拒",
-        "僚",
-        "旱",
-        "钾",
-        "鸟",
-        "漆",
-        "沈",
-        "眉",
-        "疏",
-        "添",
-        "棒",
-        "穗",
-        "硝",
-        "韩",
-        "逼",
-        "扭",
-        "侨",
-        "凉",
-        "挺",
-        "碗",
-        "栽",
-        "炒",
-        "杯",
-        "患",
-        "馏",
-        "劝",
-        "豪",
-        "辽",
-        "勃",
-        "鸿",
-        "旦",
-        "吏",
-        "拜",
-        "狗",
-        "埋",
-        "辊",
-        "掩",
-        "饮",
-        "搬",
-        "骂",
-        "辞",
-        "勾",
-        "扣",
-        "估",
-        "蒋",
-        "绒",
-        "雾",
-        "丈",
-        "朵",
-        "姆",
-        "拟",
-        "宇",
-        "辑",
-        "陕",
-        "雕",
-        "偿",
-        "蓄",
-        "崇",
-        "剪",
-        "倡",
-        "厅",
-        "咬",
-        "驶",
-        "薯",
-        "刷",
-        "斥",
-        "番",
-        "赋",
-        "奉",
-        "佛",
-        "浇",
-        "漫",
-        "曼",
-        "扇",
-        "钙",
-        "桃",
-        "扶",
-        "仔",
-        "返",
-        "俗",
-        "亏",
-        "腔",
-        "鞋",
-        "棱",
-        "覆",
-        "框",
-        "悄",
-        "叔",
-        "撞",
-        "骗",
-        "勘",
-        "旺",
-        "沸",
-        "孤",
-        "吐",
-        "孟",
-        "渠",
-        "屈",
-        "疾",
-        "妙",
-        "惜",
-        "仰",
-        "狠",
-        "胀",
-        "谐",
-        "抛",
-        "霉",
-        "桑",
-        "岗",
-        "嘛",
-        "衰",
-        "盗",
-        "渗",
-        "脏",
-        "赖",
-        "涌",
-        "甜",
-        "曹",
-        "阅",
-        "肌",
-        "哩",
-        "厉",
-        "烃",
-        "纬",
-        "毅",
-        "昨",
-        "伪",
-        "症",
-        "煮",
-        "叹",
-        "钉",
-        "搭",
-        "茎",
-        "笼",
-        "酷",
-        "偷",
-        "弓",
-        "锥",
-        "恒",
-        "杰",
-        "坑",
-        "鼻",
-        "翼",
-        "纶",
-        "叙",
-        "狱",
-        "逮",
-        "罐",
-        "络",
-        "棚",
-        "抑",
-        "膨",
-        "蔬",
-        "寺",
-        "骤",
-        "穆",
-        "冶",
-        "枯",
-        "册",
-        "尸",
-        "凸",
-        "绅",
-        "坯",
-        "牺",
-        "焰",
-        "轰",
-        "欣",
-        "晋",
-        "瘦",
-        "御",
-        "锭",
-        "锦",
-        "丧",
-        "旬",
-        "锻",
-        "垄",
-        "搜",
-        "扑",
-        "邀",
-        "亭",
-        "酯",
-        "迈",
-        "舒",
-        "脆",
-        "酶",
-        "闲",
-        "忧",
-        "酚",
-        "顽",
-        "羽",
-        "涨",
-        "卸",
-        "仗",
-        "陪",
-        "辟",
-        "惩",
-        "杭",
-        "姚",
-        "肚",
-        "捉",
-        "飘",
-        "漂",
-        "昆",
-        "欺",
-        "吾",
-        "郎",
-        "烷",
-        "汁",
-        "呵",
-        "饰",
-        "萧",
-        "雅",
-        "邮",
-        "迁",
-        "燕",
-        "撒",
-        "姻",
-        "赴",
-        "宴",
-        "烦",
-        "债",
-        "帐",
-        "斑",
-        "铃",
-        "旨",
-        "醇",
-        "董",
-        "饼",
-        "雏",
-        "姿",
-        "拌",
-        "傅",
-        "腹",
-        "妥",
-        "揉",
-        "贤",
-        "拆",
-        "歪",
-        "葡",
-        "胺",
-        "丢",
-        "浩",
-        "徽",
-        "昂",
-        "垫",
-        "挡",
-        "览",
-        "贪",
-        "慰",
-        "缴",
-        "汪",
-        "慌",
-        "冯",
-        "诺",
-        "姜",
-        "谊",
-        "凶",
-        "劣",
-        "诬",
-        "耀",
-        "昏",
-        "躺",
-        "盈",
-        "骑",
-        "乔",
-        "溪",
-        "丛",
-        "卢",
-        "抹",
-        "闷",
-        "咨",
-        "刮",
-        "驾",
-        "缆",
-        "悟",
-        "摘",
-        "铒",
-        "掷",
-        "颇",
-        "幻",
-        "柄",
-        "惠",
-        "惨",
-        "佳",
-        "仇",
-        "腊",
-        "窝",
-        "涤",
-        "剑",
-        "瞧",
-        "堡",
-        "泼",
-        "葱",
-        "罩",
-        "霍",
-        "捞",
-        "胎",
-        "苍",
-        "滨",
-        "俩",
-        "捅",
-        "湘",
-        "砍",
-        "霞",
-        "邵",
-        "萄",
-        "疯",
-        "淮",
-        "遂",
-        "熊",
-        "粪",
-        "烘",
-        "宿",
-        "档",
-        "戈",
-        "驳",
-        "嫂",
-        "裕",
-        "徙",
-        "箭",
-        "捐",
-        "肠",
-        "撑",
-        "晒",
-        "辨",
-        "殿",
-        "莲",
-        "摊",
-        "搅",
-        "酱",
-        "屏",
-        "疫",
-        "哀",
-        "蔡",
-        "堵",
-        "沫",
-        "皱",
-        "畅",
-        "叠",
-        "阁",
-        "莱",
-        "敲",
-        "辖",
-        "钩",
-        "痕",
-        "坝",
-        "巷",
-        "饿",
-        "祸",
-        "丘",
-        "玄",
-        "溜",
-        "曰",
-        "逻",
-        "彭",
-        "尝",
-        "卿",
-        "妨",
-        "艇",
-        "吞",
-        "韦",
-        "怨",
-        "矮",
-        "歇"
-    }
+    0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 68, 72,
+    76, 80, 84, 88, 92, 96, 100, 104, 108, 112, 116, 120, 124, 128, 132, 136,
+    140, 144, 148, 152, 156, 160, 164, 168, 172, 176, 180, 184, 188, 192, 196,
+    200, 204, 208, 212, 216, 220, 224, 228, 232, 236, 240, 244, 248, 252, 256,
+    260, 264, 268, 272, 276, 280, 284, 288, 292, 296, 300, 304, 308, 312, 316,
+    320, 324, 328, 332, 336, 340, 344, 348, 352, 356, 360, 364, 368, 372, 376,
+    380, 384, 388, 392, 396, 400, 404, 408, 412, 416, 420, 424, 428, 432, 436,
+    440, 444, 448, 452, 456, 460, 464, 468, 472, 476, 480, 484, 488, 492, 496,
+    500, 504, 508, 512, 516, 520, 524, 528, 532, 536, 540, 544, 548, 552, 556,
+    560, 564, 568, 572, 576, 580, 584, 588, 592, 596, 600, 604, 608, 612, 616,
+    620, 624, 628, 632, 636, 640, 644, 648, 652, 656, 660, 664, 668, 672, 676,
+    680, 684, 688, 692, 696, 700, 704, 708, 712, 716, 720, 724, 728, 732, 736,
+    740, 744, 748, 752, 756, 760, 764, 768, 772, 776, 780, 784, 788, 792, 796,
+    800, 804, 808, 812, 816, 820, 824, 828, 832, 836, 840, 844, 848, 852, 856,
+    860, 864, 868, 872, 876, 880, 884, 888, 892, 896, 900, 904, 908, 912, 916,
+    920, 924, 928, 932, 936, 940, 944, 948, 952, 956, 960, 964, 968, 972, 976,
+    980, 984, 988, 992, 996, 1000, 1004, 1008, 1012, 1016, 1020, 1024, 1028,
+    1032, 1036, 1040, 1044, 1048, 1052, 1056, 1060, 1064, 1068, 1072, 1076,
+    1080, 1084, 1088, 1092, 1096, 1100, 1104, 1108, 1112, 1116, 1120, 1124,
+    1128, 1132, 1136, 1140, 1144, 1148, 1152, 1156, 1160, 1164, 1168, 1172,
+    1176, 1180, 1184, 1188, 1192, 1196, 1200, 1204, 1208, 1212, 1216, 1220,
+    1224, 1228, 1232, 1236, 1240, 1244, 1248, 1252, 1256, 1260, 1264, 1268,
+    1272, 1276, 1280, 1284, 1288, 1292, 1296, 1300, 1304, 1308, 1312, 1316,
+    1320, 1324, 1328, 1332, 1336, 1340, 1344, 1348, 1352, 1356, 1360, 1364,
+    1368, 1372, 1376, 1380, 1384, 1388, 1392, 1396, 1400, 1404, 1408, 1412,
+    1416, 1420, 1424, 1428, 1432, 1436, 1440, 1444, 1448, 1452, 1456, 1460,
+    1464, 1468, 1472, 1476, 1480, 1484, 1488, 1492, 1496, 1500, 1504, 1508,
+    1512, 1516, 1520, 1524, 1528, 1532, 1536, 1540, 1544, 1548, 1552, 1556,
+    1560, 1564, 1568, 1572, 1576, 1580, 1584, 1588, 1592, 1596, 1600, 1604,
+    1608, 1612, 1616, 1620, 1624, 1628, 1632, 1636, 1640, 1644, 1648, 1652,
+    1656, 1660, 1664, 1668, 1672, 1676, 1680, 1684, 1688, 1692, 1696, 1700,
+    1704, 1708, 1712, 1716, 1720, 1724, 1728, 1732, 1736, 1740, 1744, 1748,
+    1752, 1756, 1760, 1764, 1768, 1772, 1776, 1780, 1784, 1788, 1792, 1796,
+    1800, 1804, 1808, 1812, 1816, 1820, 1824, 1828, 1832, 1836, 1840, 1844,
+    1848, 1852, 1856, 1860, 1864, 1868, 1872, 1876, 1880, 1884, 1888, 1892,
+    1896, 1900, 1904, 1908, 1912, 1916, 1920, 1924, 1928, 1932, 1936, 1940,
+    1944, 1948, 1952, 1956, 1960, 1964, 1968, 1972, 1976, 1980, 1984, 1988,
+    1992, 1996, 2000, 2004, 2008, 2012, 2016, 2020, 2024, 2028, 2032, 2036,
+    2040, 2044, 2048, 2052, 2056, 2060, 2064, 2068, 2072, 2076, 2080, 2084,
+    2088, 2092, 2096, 2100, 2104, 2108, 2112, 2116, 2120, 2124, 2128, 2132,
+    2136, 2140, 2144, 2148, 2152, 2156, 2160, 2164, 2168, 2172, 2176, 2180,
+    2184, 2188, 2192, 2196, 2200, 2204, 2208, 2212, 2216, 2220, 2224, 2228,
+    2232, 2236, 2240, 2244, 2248, 2252, 2256, 2260, 2264, 2268, 2272, 2276,
+    2280, 2284, 2288, 2292, 2296, 2300, 2304, 2308, 2312, 2316, 2320, 2324,
+    2328, 2332, 2336, 2340, 2344, 2348, 2352, 2356, 2360, 2364, 2368, 2372,
+    2376, 2380, 2384, 2388, 2392, 2396, 2400, 2404, 2408, 2412, 2416, 2420,
+    2424, 2428, 2432, 2436, 2440, 2444, 2448, 2452, 2456, 2460, 2464, 2468,
+    2472, 2476, 2480, 2484, 2488, 2492, 2496, 2500, 2504, 2508, 2512, 2516,
+    2520, 2524, 2528, 2532, 2536, 2540, 2544, 2548, 2552, 2556, 2560, 2564,
+    2568, 2572, 2576, 2580, 2584, 2588, 2592, 2596, 2600, 2604, 2608, 2612,
+    2616, 2620, 2624, 2628, 2632, 2636, 2640, 2644, 2648, 2652, 2656, 2660,
+    2664, 2668, 2672, 2676, 2680, 2684, 2688, 2692, 2696, 2700, 2704, 2708,
+    2712, 2716, 2720, 2724, 2728, 2732, 2736, 2740, 2744, 2748, 2752, 2756,
+    2760, 2764, 2768, 2772, 2776, 2780, 2784, 2788, 2792, 2796, 2800, 2804,
+    2808, 2812, 2816, 2820, 2824, 2828, 2832, 2836, 2840, 2844, 2848, 2852,
+    2856, 2860, 2864, 2868, 2872, 2876, 2880, 2884, 2888, 2892, 2896, 2900,
+    2904, 2908, 2912, 2916, 2920, 2924, 2928, 2932, 2936, 2940, 2944, 2948,
+    2952, 2956, 2960, 2964, 2968, 2972, 2976, 2980, 2984, 2988, 2992, 2996,
+    3000, 3004, 3008, 3012, 3016, 3020, 3024, 3028, 3032, 3036, 3040, 3044,
+    3048, 3052, 3056, 3060, 3064, 3068, 3072, 3076, 3080, 3084, 3088, 3092,
+    3096, 3100, 3104, 3108, 3112, 3116, 3120, 3124, 3128, 3132, 3136, 3140,
+    3144, 3148, 3152, 3156, 3160, 3164, 3168, 3172, 3176, 3180, 3184, 3188,
+    3192, 3196, 3200, 3204, 3208, 3212, 3216, 3220, 3224, 3228, 3232, 3236,
+    3240, 3244, 3248, 3252, 3256, 3260, 3264, 3268, 3272, 3276, 3280, 3284,
+    3288, 3292, 3296, 3300, 3304, 3308, 3312, 3316, 3320, 3324, 3328, 3332,
+    3336, 3340, 3344, 3348, 3352, 3356, 3360, 3364, 3368, 3372, 3376, 3380,
+    3384, 3388, 3392, 3396, 3400, 3404, 3408, 3412, 3416, 3420, 3424, 3428,
+    3432, 3436, 3440, 3444, 3448, 3452, 3456, 3460, 3464, 3468, 3472, 3476,
+    3480, 3484, 3488, 3492, 3496, 3500, 3504, 3508, 3512, 3516, 3520, 3524,
+    3528, 3532, 3536, 3540, 3544, 3548, 3552, 3556, 3560, 3564, 3568, 3572,
+    3576, 3580, 3584, 3588, 3592, 3596, 3600, 3604, 3608, 3612, 3616, 3620,
+    3624, 3628, 3632, 3636, 3640, 3644, 3648, 3652, 3656, 3660, 3664, 3668,
+    3672, 3676, 3680, 3684, 3688, 3692, 3696, 3700, 3704, 3708, 3712, 3716,
+    3720, 3724, 3728, 3732, 3736, 3740, 3744, 3748, 3752, 3756, 3760, 3764,
+    3768, 3772, 3776, 3780, 3784, 3788, 3792, 3796, 3800, 3804, 3808, 3812,
+    3816, 3820, 3824, 3828, 3832, 3836, 3840, 3844, 3848, 3852, 3856, 3860,
+    3864, 3868, 3872, 3876, 3880, 3884, 3888, 3892, 3896, 3900, 3904, 3908,
+    3912, 3916, 3920, 3924, 3928, 3932, 3936, 3940, 3944, 3948, 3952, 3956,
+    3960, 3964, 3968, 3972, 3976, 3980, 3984, 3988, 3992, 3996, 4000, 4004,
+    4008, 4012, 4016, 4020, 4024, 4028, 4032, 4036, 4040, 4044, 4048, 4052,
+    4056, 4060, 4064, 4068, 4072, 4076, 4080, 4084, 4088, 4092, 4096, 4100,
+    4104, 4108, 4112, 4116, 4120, 4124, 4128, 4132, 4136, 4140, 4144, 4148,
+    4152, 4156, 4160, 4164, 4168, 4172, 4176, 4180, 4184, 4188, 4192, 4196,
+    4200, 4204, 4208, 4212, 4216, 4220, 4224, 4228, 4232, 4236, 4240, 4244,
+    4248, 4252, 4256, 4260, 4264, 4268, 4272, 4276, 4280, 4284, 4288, 4292,
+    4296, 4300, 4304, 4308, 4312, 4316, 4320, 4324, 4328, 4332, 4336, 4340,
+    4344, 4348, 4352, 4356, 4360, 4364, 4368, 4372, 4376, 4380, 4384, 4388,
+    4392, 4396, 4400, 4404, 4408, 4412, 4416, 4420, 4424, 4428, 4432, 4436,
+    4440, 4444, 4448, 4452, 4456, 4460, 4464, 4468, 4472, 4476, 4480, 4484,
+    4488, 4492, 4496, 4500, 4504, 4508, 4512, 4516, 4520, 4524, 4528, 4532,
+    4536, 4540, 4544, 4548, 4552, 4556, 4560, 4564, 4568, 4572, 4576, 4580,
+    4584, 4588, 4592, 4596, 4600, 4604, 4608, 4612, 4616, 4620, 4624, 4628,
+    4632, 4636, 4640, 4644, 4648, 4652, 4656, 4660, 4664, 4668, 4672, 4676,
+    4680, 4684, 4688, 4692, 4696, 4700, 4704, 4708, 4712, 4716, 4720, 4724,
+    4728, 4732, 4736, 4740, 4744, 4748, 4752, 4756, 4760, 4764, 4768, 4772,
+    4776, 4780, 4784, 4788, 4792, 4796, 4800, 4804, 4808, 4812, 4816, 4820,
+    4824, 4828, 4832, 4836, 4840, 4844, 4848, 4852, 4856, 4860, 4864, 4868,
+    4872, 4876, 4880, 4884, 4888, 4892, 4896, 4900, 4904, 4908, 4912, 4916,
+    4920, 4924, 4928, 4932, 4936, 4940, 4944, 4948, 4952, 4956, 4960, 4964,
+    4968, 4972, 4976, 4980, 4984, 4988, 4992, 4996, 5000, 5004, 5008, 5012,
+    5016, 5020, 5024, 5028, 5032, 5036, 5040, 5044, 5048, 5052, 5056, 5060,
+    5064, 5068, 5072, 5076, 5080, 5084, 5088, 5092, 5096, 5100, 5104, 5108,
+    5112, 5116, 5120, 5124, 5128, 5132, 5136, 5140, 5144, 5148, 5152, 5156,
+    5160, 5164, 5168, 5172, 5176, 5180, 5184, 5188, 5192, 5196, 5200, 5204,
+    5208, 5212, 5216, 5220, 5224, 5228, 5232, 5236, 5240, 5244, 5248, 5252,
+    5256, 5260, 5264, 5268, 5272, 5276, 5280, 5284, 5288, 5292, 5296, 5300,
+    5304, 5308, 5312, 5316, 5320, 5324, 5328, 5332, 5336, 5340, 5344, 5348,
+    5352, 5356, 5360, 5364, 5368, 5372, 5376, 5380, 5384, 5388, 5392, 5396,
+    5400, 5404, 5408, 5412, 5416, 5420, 5424, 5428, 5432, 5436, 5440, 5444,
+    5448, 5452, 5456, 5460, 5464, 5468, 5472, 5476, 5480, 5484, 5488, 5492,
+    5496, 5500, 5504, 5508, 5512, 5516, 5520, 5524, 5528, 5532, 5536, 5540,
+    5544, 5548, 5552, 5556, 5560, 5564, 5568, 5572, 5576, 5580, 5584, 5588,
+    5592, 5596, 5600, 5604, 5608, 5612, 5616, 5620, 5624, 5628, 5632, 5636,
+    5640, 5644, 5648, 5652, 5656, 5660, 5664, 5668, 5672, 5676, 5680, 5684,
+    5688, 5692, 5696, 5700, 5704, 5708, 5712, 5716, 5720, 5724, 5728, 5732,
+    5736, 5740, 5744, 5748, 5752, 5756, 5760, 5764, 5768, 5772, 5776, 5780,
+    5784, 5788, 5792, 5796, 5800, 5804, 5808, 5812, 5816, 5820, 5824, 5828,
+    5832, 5836, 5840, 5844, 5848, 5852, 5856, 5860, 5864, 5868, 5872, 5876,
+    5880, 5884, 5888, 5892, 5896, 5900, 5904, 5908, 5912, 5916, 5920, 5924,
+    5928, 5932, 5936, 5940, 5944, 5948, 5952, 5956, 5960, 5964, 5968, 5972,
+    5976, 5980, 5984, 5988, 5992, 5996, 6000, 6004, 6008, 6012, 6016, 6020,
+    6024, 6028, 6032, 6036, 6040, 6044, 6048, 6052, 6056, 6060, 6064, 6068,
+    6072, 6076, 6080, 6084, 6088, 6092, 6096, 6100, 6104, 6108, 6112, 6116,
+    6120, 6124, 6128, 6132, 6136, 6140, 6144, 6148, 6152, 6156, 6160, 6164,
+    6168, 6172, 6176, 6180, 6184, 6188, 6192, 6196, 6200, 6204, 6208, 6212,
+    6216, 6220, 6224, 6228, 6232, 6236, 6240, 6244, 6248, 6252, 6256, 6260,
+    6264, 6268, 6272, 6276, 6280, 6284, 6288, 6292, 6296, 6300, 6304, 6308,
+    6312, 6316, 6320, 6324, 6328, 6332, 6336, 6340, 6344, 6348, 6352, 6356,
+    6360, 6364, 6368, 6372, 6376, 6380, 6384, 6388, 6392, 6396, 6400, 6404,
+    6408, 6412, 6416, 6420, 6424, 6428, 6432, 6436, 6440, 6444, 6448, 6452,
+    6456, 6460, 6464, 6468, 6472, 6476, 6480, 6484, 6488, 6492, 6496, 6500,
+    6504, 6508, 6512, 6516, 6520, 6524, 6528, 6532, 6536, 6540, 6544, 6548,
+    6552, 6556, 6560, 6564, 6568, 6572, 6576, 6580, 6584, 6588, 6592, 6596,
+    6600, 6604, 6608, 6612, 6616, 6620, 6624, 6628, 6632, 6636, 6640, 6644,
+    6648, 6652, 6656, 6660, 6664, 6668, 6672, 6676, 6680, 6684, 6688, 6692,
+    6696, 6700, 6704, 6708, 6712, 6716, 6720, 6724, 6728, 6732, 6736, 6740,
+    6744, 6748, 6752, 6756, 6760, 6764, 6768, 6772, 6776, 6780, 6784, 6788,
+    6792, 6796, 6800, 6804, 6808, 6812, 6816, 6820, 6824, 6828, 6832, 6836,
+    6840, 6844, 6848, 6852, 6856, 6860, 6864, 6868, 6872, 6876, 6880, 6884,
+    6888, 6892, 6896, 6900, 6904, 6908, 6912, 6916, 6920, 6924, 6928, 6932,
+    6936, 6940, 6944, 6948, 6952, 6956, 6960, 6964, 6968, 6972, 6976, 6980,
+    6984, 6988, 6992, 6996, 7000, 7004, 7008, 7012, 7016, 7020, 7024, 7028,
+    7032, 7036, 7040, 7044, 7048, 7052, 7056, 7060, 7064, 7068, 7072, 7076,
+    7080, 7084, 7088, 7092, 7096, 7100, 7104, 7108, 7112, 7116, 7120, 7124,
+    7128, 7132, 7136, 7140, 7144, 7148, 7152, 7156, 7160, 7164, 7168, 7172,
+    7176, 7180, 7184, 7188, 7192, 7196, 7200, 7204, 7208, 7212, 7216, 7220,
+    7224, 7228, 7232, 7236, 7240, 7244, 7248, 7252, 7256, 7260, 7264, 7268,
+    7272, 7276, 7280, 7284, 7288, 7292, 7296, 7300, 7304, 7308, 7312, 7316,
+    7320, 7324, 7328, 7332, 7336, 7340, 7344, 7348, 7352, 7356, 7360, 7364,
+    7368, 7372, 7376, 7380, 7384, 7388, 7392, 7396, 7400, 7404, 7408, 7412,
+    7416, 7420, 7424, 7428, 7432, 7436, 7440, 7444, 7448, 7452, 7456, 7460,
+    7464, 7468, 7472, 7476, 7480, 7484, 7488, 7492, 7496, 7500, 7504, 7508,
+    7512, 7516, 7520, 7524, 7528, 7532, 7536, 7540, 7544, 7548, 7552, 7556,
+    7560, 7564, 7568, 7572, 7576, 7580, 7584, 7588, 7592, 7596, 7600, 7604,
+    7608, 7612, 7616, 7620, 7624, 7628, 7632, 7636, 7640, 7644, 7648, 7652,
+    7656, 7660, 7664, 7668, 7672, 7676, 7680, 7684, 7688, 7692, 7696, 7700,
+    7704, 7708, 7712, 7716, 7720, 7724, 7728, 7732, 7736, 7740, 7744, 7748,
+    7752, 7756, 7760, 7764, 7768, 7772, 7776, 7780, 7784, 7788, 7792, 7796,
+    7800, 7804, 7808, 7812, 7816, 7820, 7824, 7828, 7832, 7836, 7840, 7844,
+    7848, 7852, 7856, 7860, 7864, 7868, 7872, 7876, 7880, 7884, 7888, 7892,
+    7896, 7900, 7904, 7908, 7912, 7916, 7920, 7924, 7928, 7932, 7936, 7940,
+    7944, 7948, 7952, 7956, 7960, 7964, 7968, 7972, 7976, 7980, 7984, 7988,
+    7992, 7996, 8000, 8004, 8008, 8012, 8016, 8020, 8024, 8028, 8032, 8036,
+    8040, 8044, 8048, 8052, 8056, 8060, 8064, 8068, 8072, 8076, 8080, 8084,
+    8088, 8092, 8096, 8100, 8104, 8108, 8112, 8116, 8120, 8124, 8128, 8132,
+    8136, 8140, 8144, 8148, 8152, 8156, 8160, 8164, 8168, 8172, 8176, 8180,
+    8184, 8188
 };
 
-const dictionary zh_Hant =
+const dictionary zh_Hans{ zh_Hans_words, zh_Hans_offsets };
+
+static const char zh_Hant_words[] =
+    "的\0"
+    "一\0"
+    "是\0"
+    "在\0"
+    "不\0"
+    "了\0"
+    "有\0"
+    "和\0"
+    "人\0"
+    "這\0"
+    "中\0"
+    "大\0"
+    "為\0"
+    "上\0"
+    "個\0"
+    "國\0"
+    "我\0"
+    "以\0"
+    "要\0"
+    "他\0"
+    "時\0"
+    "來\0"
+    "用\0"
+    "們\0"
+    "生\0"
+    "到\0"
+    "作\0"
+    "地\0"
+    "於\0"
+    "出\0"
+    "就\0"
+    "分\0"
+    "對\0"
+    "成\0"
+    "會\0"
+    "可\0"
+    "主\0"
+    "發\0"
+    "年\0"
+    "動\0"
+    "同\0"
+    "工\0"
+    "也\0"
+    "能\0"
+    "下\0"
+    "過\0"
+    "子\0"
+    "說\0"
+    "產\0"
+    "種\0"
+    "面\0"
+    "而\0"
+    "方\0"
+    "後\0"
+    "多\0"
+    "定\0"
+    "行\0"
+    "學\0"
+    "法\0"
+    "所\0"
+    "民\0"
+    "得\0"
+    "經\0"
+    "十\0"
+    "三\0"
+    "之\0"
+    "進\0"
+    "著\0"
+    "等\0"
+    "部\0"
+    "度\0"
+    "家\0"
+    "電\0"
+    "力\0"
+    "裡\0"
+    "如\0"
+    "水\0"
+    "化\0"
+    "高\0"
+    "自\0"
+    "二\0"
+    "理\0"
+    "起\0"
+    "小\0"
+    "物\0"
+    "現\0"
+    "實\0"
+    "加\0"
+    "量\0"
+    "都\0"
+    "兩\0"
+    "體\0"
+    "制\0"
+    "機\0"
+    "當\0"
+    "使\0"
+    "點\0"
+    "從\0"
+    "業\0"
+    "本\0"
+    "去\0"
+    "把\0"
+    "性\0"
+    "好\0"
+    "應\0"
+    "開\0"
+    "它\0"
+    "合\0"
+    "還\0"
+    "因\0"
+    "由\0"
+    "其\0"
+    "些\0"
+    "然\0"
+    "前\0"
+    "外\0"
+    "天\0"
+    "政\0"
+    "四\0"
+    "日\0"
+    "那\0"
+    "社\0"
+    "義\0"
+    "事\0"
+    "平\0"
+    "形\0"
+    "相\0"
+    "全\0"
+    "表\0"
+    "間\0"
+    "樣\0"
+    "與\0"
+    "關\0"
+    "各\0"
+    "重\0"
+    "新\0"
+    "線\0"
+    "內\0"
+    "數\0"
+    "正\0"
+    "心\0"
+    "反\0"
+    "你\0"
+    "明\0"
+    "看\0"
+    "原\0"
+    "又\0"
+    "麼\0"
+    "利\0"
+    "比\0"
+    "或\0"
+    "但\0"
+    "質\0"
+    "氣\0"
+    "第\0"
+    "向\0"
+    "道\0"
+    "命\0"
+    "此\0"
+    "變\0"
+    "條\0"
+    "只\0"
+    "沒\0"
+    "結\0"
+    "解\0"
+    "問\0"
+    "意\0"
+    "建\0"
+    "月\0"
+    "公\0"
+    "無\0"
+    "系\0"
+    "軍\0"
+    "很\0"
+    "情\0"
+    "者\0"
+    "最\0"
+    "立\0"
+    "代\0"
+    "想\0"
+    "已\0"
+    "通\0"
+    "並\0"
+    "提\0"
+    "直\0"
+    "題\0"
+    "黨\0"
+    "程\0"
+    "展\0"
+    "五\0"
+    "果\0"
+    "料\0"
+    "象\0"
+    "員\0"
+    "革\0"
+    "位\0"
+    "入\0"
+    "常\0"
+    "文\0"
+    "總\0"
+    "次\0"
+    "品\0"
+    "式\0"
+    "活\0"
+    "設\0"
+    "及\0"
+    "管\0"
+    "特\0"
+    "件\0"
+    "長\0"
+    "求\0"
+    "老\0"
+    "頭\0"
+    "基\0"
+    "資\0"
+    "邊\0"
+    "流\0"
+    "路\0"
+    "級\0"
+    "少\0"
+    "圖\0"
+    "山\0"
+    "統\0"
+    "接\0"
+    "知\0"
+    "較\0"
+    "將\0"
+    "組\0"
+    "見\0"
+    "計\0"
+    "別\0"
+    "她\0"
+    "手\0"
+    "角\0"
+    "期\0"
+    "根\0"
+    "論\0"
+    "運\0"
+    "農\0"
+    "指\0"
+    "幾\0"
+    "九\0"
+    "區\0"
+    "強\0"
+    "放\0"
+    "決\0"
+    "西\0"
+    "被\0"
+    "幹\0"
+    "做\0"
+    "必\0"
+    "戰\0"
+    "先\0"
+    "回\0"
+    "則\0"
+    "任\0"
+    "取\0"
+    "據\0"
+    "處\0"
+    "隊\0"
+    "南\0"
+    "給\0"
+    "色\0"
+    "光\0"
+    "門\0"
+    "即\0"
+    "保\0"
+    "治\0"
+    "北\0"
+    "造\0"
+    "百\0"
+    "規\0"
+    "熱\0"
+    "領\0"
+    "七\0"
+    "海\0"
+    "口\0"
+    "東\0"
+    "導\0"
+    "器\0"
+    "壓\0"
+    "志\0"
+    "世\0"
+    "金\0"
+    "增\0"
+    "爭\0"
+    "濟\0"
+    "階\0"
+    "油\0"
+    "思\0"
+    "術\0"
+    "極\0"
+    "交\0"
+    "受\0"
+    "聯\0"
+    "什\0"
+    "認\0"
+    "六\0"
+    "共\0"
+    "權\0"
+    "收\0"
+    "證\0"
+    "改\0"
+    "清\0"
+    "美\0"
+    "再\0"
+    "採\0"
+    "轉\0"
+    "更\0"
+    "單\0"
+    "風\0"
+    "切\0"
+    "打\0"
+    "白\0"
+    "教\0"
+    "速\0"
+    "花\0"
+    "帶\0"
+    "安\0"
+    "場\0"
+    "身\0"
+    "車\0"
+    "例\0"
+    "真\0"
+    "務\0"
+    "具\0"
+    "萬\0"
+    "每\0"
+    "目\0"
+    "至\0"
+    "達\0"
+    "走\0"
+    "積\0"
+    "示\0"
+    "議\0"
+    "聲\0"
+    "報\0"
+    "鬥\0"
+    "完\0"
+    "類\0"
+    "八\0"
+    "離\0"
+    "華\0"
+    "名\0"
+    "確\0"
+    "才\0"
+    "科\0"
+    "張\0"
+    "信\0"
+    "馬\0"
+    "節\0"
+    "話\0"
+    "米\0"
+    "整\0"
+    "空\0"
+    "元\0"
+    "況\0"
+    "今\0"
+    "集\0"
+    "溫\0"
+    "傳\0"
+    "土\0"
+    "許\0"
+    "步\0"
+    "群\0"
+    "廣\0"
+    "石\0"
+    "記\0"
+    "需\0"
+    "段\0"
+    "研\0"
+    "界\0"
+    "拉\0"
+    "林\0"
+    "律\0"
+    "叫\0"
+    "且\0"
+    "究\0"
+    "觀\0"
+    "越\0"
+    "織\0"
+    "裝\0"
+    "影\0"
+    "算\0"
+    "低\0"
+    "持\0"
+    "音\0"
+    "眾\0"
+    "書\0"
+    "布\0"
+    "复\0"
+    "容\0"
+    "兒\0"
+    "須\0"
+    "際\0"
+    "商\0"
+    "非\0"
+    "驗\0"
+    "連\0"
+    "斷\0"
+    "深\0"
+    "難\0"
+    "近\0"
+    "礦\0"
+    "千\0"
+    "週\0"
+    "委\0"
+    "素\0"
+    "技\0"
+    "備\0"
+    "半\0"
+    "辦\0"
+    "青\0"
+    "省\0"
+    "列\0"
+    "習\0"
+    "響\0"
+    "約\0"
+    "支\0"
+    "般\0"
+    "史\0"
+    "感\0"
+    "勞\0"
+    "便\0"
+    "團\0"
+    "往\0"
+    "酸\0"
+    "歷\0"
+    "市\0"
+    "克\0"
+    "何\0"
+    "除\0"
+    "消\0"
+    "構\0"
+    "府\0"
+    "稱\0"
+    "太\0"
+    "準\0"
+    "精\0"
+    "值\0"
+    "號\0"
+    "率\0"
+    "族\0"
+    "維\0"
+    "劃\0"
+    "選\0"
+    "標\0"
+    "寫\0"
+    "存\0"
+    "候\0"
+    "毛\0"
+    "親\0"
+    "快\0"
+    "效\0"
+    "斯\0"
+    "院\0"
+    "查\0"
+    "江\0"
+    "型\0"
+    "眼\0"
+    "王\0"
+    "按\0"
+    "格\0"
+    "養\0"
+    "易\0"
+    "置\0"
+    "派\0"
+    "層\0"
+    "片\0"
+    "始\0"
+    "卻\0"
+    "專\0"
+    "狀\0"
+    "育\0"
+    "廠\0"
+    "京\0"
+    "識\0"
+    "適\0"
+    "屬\0"
+    "圓\0"
+    "包\0"
+    "火\0"
+    "住\0"
+    "調\0"
+    "滿\0"
+    "縣\0"
+    "局\0"
+    "照\0"
+    "參\0"
+    "紅\0"
+    "細\0"
+    "引\0"
+    "聽\0"
+    "該\0"
+    "鐵\0"
+    "價\0"
+    "嚴\0"
+    "首\0"
+    "底\0"
+    "液\0"
+    "官\0"
+    "德\0"
+    "隨\0"
+    "病\0"
+    "蘇\0"
+    "失\0"
+    "爾\0"
+    "死\0"
+    "講\0"
+    "配\0"
+    "女\0"
+    "黃\0"
+    "推\0"
+    "顯\0"
+    "談\0"
+    "罪\0"
+    "神\0"
+    "藝\0"
+    "呢\0"
+    "席\0"
+    "含\0"
+    "企\0"
+    "望\0"
+    "密\0"
+    "批\0"
+    "營\0"
+    "項\0"
+    "防\0"
+    "舉\0"
+    "球\0"
+    "英\0"
+    "氧\0"
+    "勢\0"
+    "告\0"
+    "李\0"
+    "台\0"
+    "落\0"
+    "木\0"
+    "幫\0"
+    "輪\0"
+    "破\0"
+    "亞\0"
+    "師\0"
+    "圍\0"
+    "注\0"
+    "遠\0"
+    "字\0"
+    "材\0"
+    "排\0"
+    "供\0"
+    "河\0"
+    "態\0"
+    "封\0"
+    "另\0"
+    "施\0"
+    "減\0"
+    "樹\0"
+    "溶\0"
+    "怎\0"
+    "止\0"
+    "案\0"
+    "言\0"
+    "士\0"
+    "均\0"
+    "武\0"
+    "固\0"
+    "葉\0"
+    "魚\0"
+    "波\0"
+    "視\0"
+    "僅\0"
+    "費\0"
+    "緊\0"
+    "愛\0"
+    "左\0"
+    "章\0"
+    "早\0"
+    "朝\0"
+    "害\0"
+    "續\0"
+    "輕\0"
+    "服\0"
+    "試\0"
+    "食\0"
+    "充\0"
+    "兵\0"
+    "源\0"
+    "判\0"
+    "護\0"
+    "司\0"
+    "足\0"
+    "某\0"
+    "練\0"
+    "差\0"
+    "致\0"
+    "板\0"
+    "田\0"
+    "降\0"
+    "黑\0"
+    "犯\0"
+    "負\0"
+    "擊\0"
+    "范\0"
+    "繼\0"
+    "興\0"
+    "似\0"
+    "餘\0"
+    "堅\0"
+    "曲\0"
+    "輸\0"
+    "修\0"
+    "故\0"
+    "城\0"
+    "夫\0"
+    "夠\0"
+    "送\0"
+    "筆\0"
+    "船\0"
+    "佔\0"
+    "右\0"
+    "財\0"
+    "吃\0"
+    "富\0"
+    "春\0"
+    "職\0"
+    "覺\0"
+    "漢\0"
+    "畫\0"
+    "功\0"
+    "巴\0"
+    "跟\0"
+    "雖\0"
+    "雜\0"
+    "飛\0"
+    "檢\0"
+    "吸\0"
+    "助\0"
+    "昇\0"
+    "陽\0"
+    "互\0"
+    "初\0"
+    "創\0"
+    "抗\0"
+    "考\0"
+    "投\0"
+    "壞\0"
+    "策\0"
+    "古\0"
+    "徑\0"
+    "換\0"
+    "未\0"
+    "跑\0"
+    "留\0"
+    "鋼\0"
+    "曾\0"
+    "端\0"
+    "責\0"
+    "站\0"
+    "簡\0"
+    "述\0"
+    "錢\0"
+    "副\0"
+    "盡\0"
+    "帝\0"
+    "射\0"
+    "草\0"
+    "衝\0"
+    "承\0"
+    "獨\0"
+    "令\0"
+    "限\0"
+    "阿\0"
+    "宣\0"
+    "環\0"
+    "雙\0"
+    "請\0"
+    "超\0"
+    "微\0"
+    "讓\0"
+    "控\0"
+    "州\0"
+    "良\0"
+    "軸\0"
+    "找\0"
+    "否\0"
+    "紀\0"
+    "益\0"
+    "依\0"
+    "優\0"
+    "頂\0"
+    "礎\0"
+    "載\0"
+    "倒\0"
+    "房\0"
+    "突\0"
+    "坐\0"
+    "粉\0"
+    "敵\0"
+    "略\0"
+    "客\0"
+    "袁\0"
+    "冷\0"
+    "勝\0"
+    "絕\0"
+    "析\0"
+    "塊\0"
+    "劑\0"
+    "測\0"
+    "絲\0"
+    "協\0"
+    "訴\0"
+    "念\0"
+    "陳\0"
+    "仍\0"
+    "羅\0"
+    "鹽\0"
+    "友\0"
+    "洋\0"
+    "錯\0"
+    "苦\0"
+    "夜\0"
+    "刑\0"
+    "移\0"
+    "頻\0"
+    "逐\0"
+    "靠\0"
+    "混\0"
+    "母\0"
+    "短\0"
+    "皮\0"
+    "終\0"
+    "聚\0"
+    "汽\0"
+    "村\0"
+    "雲\0"
+    "哪\0"
+    "既\0"
+    "距\0"
+    "衛\0"
+    "停\0"
+    "烈\0"
+    "央\0"
+    "察\0"
+    "燒\0"
+    "迅\0"
+    "境\0"
+    "若\0"
+    "印\0"
+    "洲\0"
+    "刻\0"
+    "括\0"
+    "激\0"
+    "孔\0"
+    "搞\0"
+    "甚\0"
+    "室\0"
+    "待\0"
+    "核\0"
+    "校\0"
+    "散\0"
+    "侵\0"
+    "吧\0"
+    "甲\0"
+    "遊\0"
+    "久\0"
+    "菜\0"
+    "味\0"
+    "舊\0"
+    "模\0"
+    "湖\0"
+    "貨\0"
+    "損\0"
+    "預\0"
+    "阻\0"
+    "毫\0"
+    "普\0"
+    "穩\0"
+    "乙\0"
+    "媽\0"
+    "植\0"
+    "息\0"
+    "擴\0"
+    "銀\0"
+    "語\0"
+    "揮\0"
+    "酒\0"
+    "守\0"
+    "拿\0"
+    "序\0"
+    "紙\0"
+    "醫\0"
+    "缺\0"
+    "雨\0"
+    "嗎\0"
+    "針\0"
+    "劉\0"
+    "啊\0"
+    "急\0"
+    "唱\0"
+    "誤\0"
+    "訓\0"
+    "願\0"
+    "審\0"
+    "附\0"
+    "獲\0"
+    "茶\0"
+    "鮮\0"
+    "糧\0"
+    "斤\0"
+    "孩\0"
+    "脫\0"
+    "硫\0"
+    "肥\0"
+    "善\0"
+    "龍\0"
+    "演\0"
+    "父\0"
+    "漸\0"
+    "血\0"
+    "歡\0"
+    "械\0"
+    "掌\0"
+    "歌\0"
+    "沙\0"
+    "剛\0"
+    "攻\0"
+    "謂\0"
+    "盾\0"
+    "討\0"
+    "晚\0"
+    "粒\0"
+    "亂\0"
+    "燃\0"
+    "矛\0"
+    "乎\0"
+    "殺\0"
+    "藥\0"
+    "寧\0"
+    "魯\0"
+    "貴\0"
+    "鐘\0"
+    "煤\0"
+    "讀\0"
+    "班\0"
+    "伯\0"
+    "香\0"
+    "介\0"
+    "迫\0"
+    "句\0"
+    "豐\0"
+    "培\0"
+    "握\0"
+    "蘭\0"
+    "擔\0"
+    "弦\0"
+    "蛋\0"
+    "沉\0"
+    "假\0"
+    "穿\0"
+    "執\0"
+    "答\0"
+    "樂\0"
+    "誰\0"
+    "順\0"
+    "煙\0"
+    "縮\0"
+    "徵\0"
+    "臉\0"
+    "喜\0"
+    "松\0"
+    "腳\0"
+    "困\0"
+    "異\0"
+    "免\0"
+    "背\0"
+    "星\0"
+    "福\0"
+    "買\0"
+    "染\0"
+    "井\0"
+    "概\0"
+    "慢\0"
+    "怕\0"
+    "磁\0"
+    "倍\0"
+    "祖\0"
+    "皇\0"
+    "促\0"
+    "靜\0"
+    "補\0"
+    "評\0"
+    "翻\0"
+    "肉\0"
+    "踐\0"
+    "尼\0"
+    "衣\0"
+    "寬\0"
+    "揚\0"
+    "棉\0"
+    "希\0"
+    "傷\0"
+    "操\0"
+    "垂\0"
+    "秋\0"
+    "宜\0"
+    "氫\0"
+    "套\0"
+    "督\0"
+    "振\0"
+    "架\0"
+    "亮\0"
+    "末\0"
+    "憲\0"
+    "慶\0"
+    "編\0"
+    "牛\0"
+    "觸\0"
+    "映\0"
+    "雷\0"
+    "銷\0"
+    "詩\0"
+    "座\0"
+    "居\0"
+    "抓\0"
+    "裂\0"
+    "胞\0"
+    "呼\0"
+    "娘\0"
+    "景\0"
+    "威\0"
+    "綠\0"
+    "晶\0"
+    "厚\0"
+    "盟\0"
+    "衡\0"
+    "雞\0"
+    "孫\0"
+    "延\0"
+    "危\0"
+    "膠\0"
+    "屋\0"
+    "鄉\0"
+    "臨\0"
+    "陸\0"
+    "顧\0"
+    "掉\0"
+    "呀\0"
+    "燈\0"
+    "歲\0"
+    "措\0"
+    "束\0"
+    "耐\0"
+    "劇\0"
+    "玉\0"
+    "趙\0"
+    "跳\0"
+    "哥\0"
+    "季\0"
+    "課\0"
+    "凱\0"
+    "胡\0"
+    "額\0"
+    "款\0"
+    "紹\0"
+    "卷\0"
+    "齊\0"
+    "偉\0"
+    "蒸\0"
+    "殖\0"
+    "永\0"
+    "宗\0"
+    "苗\0"
+    "川\0"
+    "爐\0"
+    "岩\0"
+    "弱\0"
+    "零\0"
+    "楊\0"
+    "奏\0"
+    "沿\0"
+    "露\0"
+    "桿\0"
+    "探\0"
+    "滑\0"
+    "鎮\0"
+    "飯\0"
+    "濃\0"
+    "航\0"
+    "懷\0"
+    "趕\0"
+    "庫\0"
+    "奪\0"
+    "伊\0"
+    "靈\0"
+    "稅\0"
+    "途\0"
+    "滅\0"
+    "賽\0"
+    "歸\0"
+    "召\0"
+    "鼓\0"
+    "播\0"
+    "盤\0"
+    "裁\0"
+    "險\0"
+    "康\0"
+    "唯\0"
+    "錄\0"
+    "菌\0"
+    "純\0"
+    "借\0"
+    "糖\0"
+    "蓋\0"
+    "橫\0"
+    "符\0"
+    "私\0"
+    "努\0"
+    "堂\0"
+    "域\0"
+    "槍\0"
+    "潤\0"
+    "幅\0"
+    "哈\0"
+    "竟\0"
+    "熟\0"
+    "蟲\0"
+    "澤\0"
+    "腦\0"
+    "壤\0"
+    "碳\0"
+    "歐\0"
+    "遍\0"
+    "側\0"
+    "寨\0"
+    "敢\0"
+    "徹\0"
+    "慮\0"
+    "斜\0"
+    "薄\0"
+    "庭\0"
+    "納\0"
+    "彈\0"
+    "飼\0"
+    "伸\0"
+    "折\0"
+    "麥\0"
+    "濕\0"
+    "暗\0"
+    "荷\0"
+    "瓦\0"
+    "塞\0"
+    "床\0"
+    "築\0"
+    "惡\0"
+    "戶\0"
+    "訪\0"
+    "塔\0"
+    "奇\0"
+    "透\0"
+    "梁\0"
+    "刀\0"
+    "旋\0"
+    "跡\0"
+    "卡\0"
+    "氯\0"
+    "遇\0"
+    "份\0"
+    "毒\0"
+    "泥\0"
+    "退\0"
+    "洗\0"
+    "擺\0"
+    "灰\0"
+    "彩\0"
+    "賣\0"
+    "耗\0"
+    "夏\0"
+    "擇\0"
+    "忙\0"
+    "銅\0"
+    "獻\0"
+    "硬\0"
+    "予\0"
+    "繁\0"
+    "圈\0"
+    "雪\0"
+    "函\0"
+    "亦\0"
+    "抽\0"
+    "篇\0"
+    "陣\0"
+    "陰\0"
+    "丁\0"
+    "尺\0"
+    "追\0"
+    "堆\0"
+    "雄\0"
+    "迎\0"
+    "泛\0"
+    "爸\0"
+    "樓\0"
+    "避\0"
+    "謀\0"
+    "噸\0"
+    "野\0"
+    "豬\0"
+    "旗\0"
+    "累\0"
+    "偏\0"
+    "典\0"
+    "館\0"
+    "索\0"
+    "秦\0"
+    "脂\0"
+    "潮\0"
+    "爺\0"
+    "豆\0"
+    "忽\0"
+    "托\0"
+    "驚\0"
+    "塑\0"
+    "遺\0"
+    "愈\0"
+    "朱\0"
+    "替\0"
+    "纖\0"
+    "粗\0"
+    "傾\0"
+    "尚\0"
+    "痛\0"
+    "楚\0"
+    "謝\0"
+    "奮\0"
+    "購\0"
+    "磨\0"
+    "君\0"
+    "池\0"
+    "旁\0"
+    "碎\0"
+    "骨\0"
+    "監\0"
+    "捕\0"
+    "弟\0"
+    "暴\0"
+    "割\0"
+    "貫\0"
+    "殊\0"
+    "釋\0"
+    "詞\0"
+    "亡\0"
+    "壁\0"
+    "頓\0"
+    "寶\0"
+    "午\0"
+    "塵\0"
+    "聞\0"
+    "揭\0"
+    "炮\0"
+    "殘\0"
+    "冬\0"
+    "橋\0"
+    "婦\0"
+    "警\0"
+    "綜\0"
+    "招\0"
+    "吳\0"
+    "付\0"
+    "浮\0"
+    "遭\0"
+    "徐\0"
+    "您\0"
+    "搖\0"
+    "谷\0"
+    "贊\0"
+    "箱\0"
+    "隔\0"
+    "訂\0"
+    "男\0"
+    "吹\0"
+    "園\0"
+    "紛\0"
+    "唐\0"
+    "敗\0"
+    "宋\0"
+    "玻\0"
+    "巨\0"
+    "耕\0"
+    "坦\0"
+    "榮\0"
+    "閉\0"
+    "灣\0"
+    "鍵\0"
+    "凡\0"
+    "駐\0"
+    "鍋\0"
+    "救\0"
+    "恩\0"
+    "剝\0"
+    "凝\0"
+    "鹼\0"
+    "齒\0"
+    "截\0"
+    "煉\0"
+    "麻\0"
+    "紡\0"
+    "禁\0"
+    "廢\0"
+    "盛\0"
+    "版\0"
+    "緩\0"
+    "淨\0"
+    "睛\0"
+    "昌\0"
+    "婚\0"
+    "涉\0"
+    "筒\0"
+    "嘴\0"
+    "插\0"
+    "岸\0"
+    "朗\0"
+    "莊\0"
+    "街\0"
+    "藏\0"
+    "姑\0"
+    "貿\0"
+    "腐\0"
+    "奴\0"
+    "啦\0"
+    "慣\0"
+    "乘\0"
+    "夥\0"
+    "恢\0"
+    "勻\0"
+    "紗\0"
+    "扎\0"
+    "辯\0"
+    "耳\0"
+    "彪\0"
+    "臣\0"
+    "億\0"
+    "璃\0"
+    "抵\0"
+    "脈\0"
+    "秀\0"
+    "薩\0"
+    "俄\0"
+    "網\0"
+    "舞\0"
+    "店\0"
+    "噴\0"
+    "縱\0"
+    "寸\0"
+    "汗\0"
+    "掛\0"
+    "洪\0"
+    "賀\0"
+    "閃\0"
+    "柬\0"
+    "爆\0"
+    "烯\0"
+    "津\0"
+    "稻\0"
+    "牆\0"
+    "軟\0"
+    "勇\0"
+    "像\0"
+    "滾\0"
+    "厘\0"
+    "蒙\0"
+    "芳\0"
+    "肯\0"
+    "坡\0"
+    "柱\0"
+    "盪\0"
+    "腿\0"
+    "儀\0"
+    "旅\0"
+    "尾\0"
+    "軋\0"
+    "冰\0"
+    "貢\0"
+    "登\0"
+    "黎\0"
+    "削\0"
+    "鑽\0"
+    "勒\0"
+    "逃\0"
+    "障\0"
+    "氨\0"
+    "郭\0"
+    "峰\0"
+    "幣\0"
+    "港\0"
+    "伏\0"
+    "軌\0"
+    "畝\0"
+    "畢\0"
+    "擦\0"
+    "莫\0"
+    "刺\0"
+    "浪\0"
+    "秘\0"
+    "援\0"
+    "株\0"
+    "健\0"
+    "售\0"
+    "股\0"
+    "島\0"
+    "甘\0"
+    "泡\0"
+    "睡\0"
+    "童\0"
+    "鑄\0"
+    "湯\0"
+    "閥\0"
+    "休\0"
+    "匯\0"
+    "舍\0"
+    "牧\0"
+    "繞\0"
+    "炸\0"
+    "哲\0"
+    "磷\0"
+    "績\0"
+    "朋\0"
+    "淡\0"
+    "尖\0"
+    "啟\0"
+    "陷\0"
+    "柴\0"
+    "呈\0"
+    "徒\0"
+    "顏\0"
+    "淚\0"
+    "稍\0"
+    "忘\0"
+    "泵\0"
+    "藍\0"
+    "拖\0"
+    "洞\0"
+    "授\0"
+    "鏡\0"
+    "辛\0"
+    "壯\0"
+    "鋒\0"
+    "貧\0"
+    "虛\0"
+    "彎\0"
+    "摩\0"
+    "泰\0"
+    "幼\0"
+    "廷\0"
+    "尊\0"
+    "窗\0"
+    "綱\0"
+    "弄\0"
+    "隸\0"
+    "疑\0"
+    "氏\0"
+    "宮\0"
+    "姐\0"
+    "震\0"
+    "瑞\0"
+    "怪\0"
+    "尤\0"
+    "琴\0"
+    "循\0"
+    "描\0"
+    "膜\0"
+    "違\0"
+    "夾\0"
+    "腰\0"
+    "緣\0"
+    "珠\0"
+    "窮\0"
+    "森\0"
+    "枝\0"
+    "竹\0"
+    "溝\0"
+    "催\0"
+    "繩\0"
+    "憶\0"
+    "邦\0"
+    "剩\0"
+    "幸\0"
+    "漿\0"
+    "欄\0"
+    "擁\0"
+    "牙\0"
+    "貯\0"
+    "禮\0"
+    "濾\0"
+    "鈉\0"
+    "紋\0"
+    "罷\0"
+    "拍\0"
+    "咱\0"
+    "喊\0"
+    "袖\0"
+    "埃\0"
+    "勤\0"
+    "罰\0"
+    "焦\0"
+    "潛\0"
+    "伍\0"
+    "墨\0"
+    "欲\0"
+    "縫\0"
+    "姓\0"
+    "刊\0"
+    "飽\0"
+    "仿\0"
+    "獎\0"
+    "鋁\0"
+    "鬼\0"
+    "麗\0"
+    "跨\0"
+    "默\0"
+    "挖\0"
+    "鏈\0"
+    "掃\0"
+    "喝\0"
+    "袋\0"
+    "炭\0"
+    "污\0"
+    "幕\0"
+    "諸\0"
+    "弧\0"
+    "勵\0"
+    "梅\0"
+    "奶\0"
+    "潔\0"
+    "災\0"
+    "舟\0"
+    "鑑\0"
+    "苯\0"
+    "訟\0"
+    "抱\0"
+    "毀\0"
+    "懂\0"
+    "寒\0"
+    "智\0"
+    "埔\0"
+    "寄\0"
+    "屆\0"
+    "躍\0"
+    "渡\0"
+    "挑\0"
+    "丹\0"
+    "艱\0"
+    "貝\0"
+    "碰\0"
+    "拔\0"
+    "爹\0"
+    "戴\0"
+    "碼\0"
+    "夢\0"
+    "芽\0"
+    "熔\0"
+    "赤\0"
+    "漁\0"
+    "哭\0"
+    "敬\0"
+    "顆\0"
+    "奔\0"
+    "鉛\0"
+    "仲\0"
+    "虎\0"
+    "稀\0"
+    "妹\0"
+    "乏\0"
+    "珍\0"
+    "申\0"
+    "桌\0"
+    "遵\0"
+    "允\0"
+    "隆\0"
+    "螺\0"
+    "倉\0"
+    "魏\0"
+    "銳\0"
+    "曉\0"
+    "氮\0"
+    "兼\0"
+    "隱\0"
+    "礙\0"
+    "赫\0"
+    "撥\0"
+    "忠\0"
+    "肅\0"
+    "缸\0"
+    "牽\0"
+    "搶\0"
+    "博\0"
+    "巧\0"
+    "殼\0"
+    "兄\0"
+    "杜\0"
+    "訊\0"
+    "誠\0"
+    "碧\0"
+    "祥\0"
+    "柯\0"
+    "頁\0"
+    "巡\0"
+    "矩\0"
+    "悲\0"
+    "灌\0"
+    "齡\0"
+    "倫\0"
+    "票\0"
+    "尋\0"
+    "桂\0"
+    "鋪\0"
+    "聖\0"
+    "恐\0"
+    "恰\0"
+    "鄭\0"
+    "趣\0"
+    "抬\0"
+    "荒\0"
+    "騰\0"
+    "貼\0"
+    "柔\0"
+    "滴\0"
+    "猛\0"
+    "闊\0"
+    "輛\0"
+    "妻\0"
+    "填\0"
+    "撤\0"
+    "儲\0"
+    "簽\0"
+    "鬧\0"
+    "擾\0"
+    "紫\0"
+    "砂\0"
+    "遞\0"
+    "戲\0"
+    "吊\0"
+    "陶\0"
+    "伐\0"
+    "餵\0"
+    "療\0"
+    "瓶\0"
+    "婆\0"
+    "撫\0"
+    "臂\0"
+    "摸\0"
+    "忍\0"
+    "蝦\0"
+    "蠟\0"
+    "鄰\0"
+    "胸\0"
+    "鞏\0"
+    "擠\0"
+    "偶\0"
+    "棄\0"
+    "槽\0"
+    "勁\0"
+    "乳\0"
+    "鄧\0"
+    "吉\0"
+    "仁\0"
+    "爛\0"
+    "磚\0"
+    "租\0"
+    "烏\0"
+    "艦\0"
+    "伴\0"
+    "瓜\0"
+    "淺\0"
+    "丙\0"
+    "暫\0"
+    "燥\0"
+    "橡\0"
+    "柳\0"
+    "迷\0"
+    "暖\0"
+    "牌\0"
+    "秧\0"
+    "膽\0"
+    "詳\0"
+    "簧\0"
+    "踏\0"
+    "瓷\0"
+    "譜\0"
+    "呆\0"
+    "賓\0"
+    "糊\0"
+    "洛\0"
+    "輝\0"
+    "憤\0"
+    "競\0"
+    "隙\0"
+    "怒\0"
+    "粘\0"
+    "乃\0"
+    "緒\0"
+    "肩\0"
+    "籍\0"
+    "敏\0"
+    "塗\0"
+    "熙\0"
+    "皆\0"
+    "偵\0"
+    "懸\0"
+    "掘\0"
+    "享\0"
+    "糾\0"
+    "醒\0"
+    "狂\0"
+    "鎖\0"
+    "淀\0"
+    "恨\0"
+    "牲\0"
+    "霸\0"
+    "爬\0"
+    "賞\0"
+    "逆\0"
+    "玩\0"
+    "陵\0"
+    "祝\0"
+    "秒\0"
+    "浙\0"
+    "貌\0"
+    "役\0"
+    "彼\0"
+    "悉\0"
+    "鴨\0"
+    "趨\0"
+    "鳳\0"
+    "晨\0"
+    "畜\0"
+    "輩\0"
+    "秩\0"
+    "卵\0"
+    "署\0"
+    "梯\0"
+    "炎\0"
+    "灘\0"
+    "棋\0"
+    "驅\0"
+    "篩\0"
+    "峽\0"
+    "冒\0"
+    "啥\0"
+    "壽\0"
+    "譯\0"
+    "浸\0"
+    "泉\0"
+    "帽\0"
+    "遲\0"
+    "矽\0"
+    "疆\0"
+    "貸\0"
+    "漏\0"
+    "稿\0"
+    "冠\0"
+    "嫩\0"
+    "脅\0"
+    "芯\0"
+    "牢\0"
+    "叛\0"
+    "蝕\0"
+    "奧\0"
+    "鳴\0"
+    "嶺\0"
+    "羊\0"
+    "憑\0"
+    "串\0"
+    "塘\0"
+    "繪\0"
+    "酵\0"
+    "融\0"
+    "盆\0"
+    "錫\0"
+    "廟\0"
+    "籌\0"
+    "凍\0"
+    "輔\0"
+    "攝\0"
+    "襲\0"
+    "筋\0"
+    "拒\0"
+    "僚\0"
+    "旱\0"
+    "鉀\0"
+    "鳥\0"
+    "漆\0"
+    "沈\0"
+    "眉\0"
+    "疏\0"
+    "添\0"
+    "棒\0"
+    "穗\0"
+    "硝\0"
+    "韓\0"
+    "逼\0"
+    "扭\0"
+    "僑\0"
+    "涼\0"
+    "挺\0"
+    "碗\0"
+    "栽\0"
+    "炒\0"
+    "杯\0"
+    "患\0"
+    "餾\0"
+    "勸\0"
+    "豪\0"
+    "遼\0"
+    "勃\0"
+    "鴻\0"
+    "旦\0"
+    "吏\0"
+    "拜\0"
+    "狗\0"
+    "埋\0"
+    "輥\0"
+    "掩\0"
+    "飲\0"
+    "搬\0"
+    "罵\0"
+    "辭\0"
+    "勾\0"
+    "扣\0"
+    "估\0"
+    "蔣\0"
+    "絨\0"
+    "霧\0"
+    "丈\0"
+    "朵\0"
+    "姆\0"
+    "擬\0"
+    "宇\0"
+    "輯\0"
+    "陝\0"
+    "雕\0"
+    "償\0"
+    "蓄\0"
+    "崇\0"
+    "剪\0"
+    "倡\0"
+    "廳\0"
+    "咬\0"
+    "駛\0"
+    "薯\0"
+    "刷\0"
+    "斥\0"
+    "番\0"
+    "賦\0"
+    "奉\0"
+    "佛\0"
+    "澆\0"
+    "漫\0"
+    "曼\0"
+    "扇\0"
+    "鈣\0"
+    "桃\0"
+    "扶\0"
+    "仔\0"
+    "返\0"
+    "俗\0"
+    "虧\0"
+    "腔\0"
+    "鞋\0"
+    "棱\0"
+    "覆\0"
+    "框\0"
+    "悄\0"
+    "叔\0"
+    "撞\0"
+    "騙\0"
+    "勘\0"
+    "旺\0"
+    "沸\0"
+    "孤\0"
+    "吐\0"
+    "孟\0"
+    "渠\0"
+    "屈\0"
+    "疾\0"
+    "妙\0"
+    "惜\0"
+    "仰\0"
+    "狠\0"
+    "脹\0"
+    "諧\0"
+    "拋\0"
+    "黴\0"
+    "桑\0"
+    "崗\0"
+    "嘛\0"
+    "衰\0"
+    "盜\0"
+    "滲\0"
+    "臟\0"
+    "賴\0"
+    "湧\0"
+    "甜\0"
+    "曹\0"
+    "閱\0"
+    "肌\0"
+    "哩\0"
+    "厲\0"
+    "烴\0"
+    "緯\0"
+    "毅\0"
+    "昨\0"
+    "偽\0"
+    "症\0"
+    "煮\0"
+    "嘆\0"
+    "釘\0"
+    "搭\0"
+    "莖\0"
+    "籠\0"
+    "酷\0"
+    "偷\0"
+    "弓\0"
+    "錐\0"
+    "恆\0"
+    "傑\0"
+    "坑\0"
+    "鼻\0"
+    "翼\0"
+    "綸\0"
+    "敘\0"
+    "獄\0"
+    "逮\0"
+    "罐\0"
+    "絡\0"
+    "棚\0"
+    "抑\0"
+    "膨\0"
+    "蔬\0"
+    "寺\0"
+    "驟\0"
+    "穆\0"
+    "冶\0"
+    "枯\0"
+    "冊\0"
+    "屍\0"
+    "凸\0"
+    "紳\0"
+    "坯\0"
+    "犧\0"
+    "焰\0"
+    "轟\0"
+    "欣\0"
+    "晉\0"
+    "瘦\0"
+    "禦\0"
+    "錠\0"
+    "錦\0"
+    "喪\0"
+    "旬\0"
+    "鍛\0"
+    "壟\0"
+    "搜\0"
+    "撲\0"
+    "邀\0"
+    "亭\0"
+    "酯\0"
+    "邁\0"
+    "舒\0"
+    "脆\0"
+    "酶\0"
+    "閒\0"
+    "憂\0"
+    "酚\0"
+    "頑\0"
+    "羽\0"
+    "漲\0"
+    "卸\0"
+    "仗\0"
+    "陪\0"
+    "闢\0"
+    "懲\0"
+    "杭\0"
+    "姚\0"
+    "肚\0"
+    "捉\0"
+    "飄\0"
+    "漂\0"
+    "昆\0"
+    "欺\0"
+    "吾\0"
+    "郎\0"
+    "烷\0"
+    "汁\0"
+    "呵\0"
+    "飾\0"
+    "蕭\0"
+    "雅\0"
+    "郵\0"
+    "遷\0"
+    "燕\0"
+    "撒\0"
+    "姻\0"
+    "赴\0"
+    "宴\0"
+    "煩\0"
+    "債\0"
+    "帳\0"
+    "斑\0"
+    "鈴\0"
+    "旨\0"
+    "醇\0"
+    "董\0"
+    "餅\0"
+    "雛\0"
+    "姿\0"
+    "拌\0"
+    "傅\0"
+    "腹\0"
+    "妥\0"
+    "揉\0"
+    "賢\0"
+    "拆\0"
+    "歪\0"
+    "葡\0"
+    "胺\0"
+    "丟\0"
+    "浩\0"
+    "徽\0"
+    "昂\0"
+    "墊\0"
+    "擋\0"
+    "覽\0"
+    "貪\0"
+    "慰\0"
+    "繳\0"
+    "汪\0"
+    "慌\0"
+    "馮\0"
+    "諾\0"
+    "姜\0"
+    "誼\0"
+    "兇\0"
+    "劣\0"
+    "誣\0"
+    "耀\0"
+    "昏\0"
+    "躺\0"
+    "盈\0"
+    "騎\0"
+    "喬\0"
+    "溪\0"
+    "叢\0"
+    "盧\0"
+    "抹\0"
+    "悶\0"
+    "諮\0"
+    "刮\0"
+    "駕\0"
+    "纜\0"
+    "悟\0"
+    "摘\0"
+    "鉺\0"
+    "擲\0"
+    "頗\0"
+    "幻\0"
+    "柄\0"
+    "惠\0"
+    "慘\0"
+    "佳\0"
+    "仇\0"
+    "臘\0"
+    "窩\0"
+    "滌\0"
+    "劍\0"
+    "瞧\0"
+    "堡\0"
+    "潑\0"
+    "蔥\0"
+    "罩\0"
+    "霍\0"
+    "撈\0"
+    "胎\0"
+    "蒼\0"
+    "濱\0"
+    "倆\0"
+    "捅\0"
+    "湘\0"
+    "砍\0"
+    "霞\0"
+    "邵\0"
+    "萄\0"
+    "瘋\0"
+    "淮\0"
+    "遂\0"
+    "熊\0"
+    "糞\0"
+    "烘\0"
+    "宿\0"
+    "檔\0"
+    "戈\0"
+    "駁\0"
+    "嫂\0"
+    "裕\0"
+    "徙\0"
+    "箭\0"
+    "捐\0"
+    "腸\0"
+    "撐\0"
+    "曬\0"
+    "辨\0"
+    "殿\0"
+    "蓮\0"
+    "攤\0"
+    "攪\0"
+    "醬\0"
+    "屏\0"
+    "疫\0"
+    "哀\0"
+    "蔡\0"
+    "堵\0"
+    "沫\0"
+    "皺\0"
+    "暢\0"
+    "疊\0"
+    "閣\0"
+    "萊\0"
+    "敲\0"
+    "轄\0"
+    "鉤\0"
+    "痕\0"
+    "壩\0"
+    "巷\0"
+    "餓\0"
+    "禍\0"
+    "丘\0"
+    "玄\0"
+    "溜\0"
+    "曰\0"
+    "邏\0"
+    "彭\0"
+    "嘗\0"
+    "卿\0"
+    "妨\0"
+    "艇\0"
+    "吞\0"
+    "韋\0"
+    "怨\0"
+    "矮\0"
+    "歇";
+
+static const uint16_t zh_Hant_offsets[dictionary_size] =
 {
-    {
-        "的",
-        "一",
-        "是",
-        "在",
-        "不",
-        "了",
-        "有",
-        "和",
-        "人",
-        "這",
-        "中",
-        "大",
-        "為",
-        "上",
-        "個",
-        "國",
-        "我",
-        "以",
-        "要",
-        "他",
-        "時",
-        "來",
-        "用",
-        "們",
-        "生",
-        "到",
-        "作",
-        "地",
-        "於",
-        "出",
-        "就",
-        "分",
-        "對",
-        "成",
-        "會",
-        "可",
-        "主",
-        "發",
-        "年",
-        "動",
-        "同",
-        "工",
-        "也",
-        "能",
-        "下",
-        "過",
-        "子",
-        "說",
-        "產",
-        "種",
-        "面",
-        "而",
-        "方",
-        "後",
-        "多",
-        "定",
-        "行",
-        "學",
-        "法",
-        "所",
-        "民",
-        "得",
-        "經",
-        "十",
-        "三",
-        "之",
-        "進",
-        "著",
-        "等",
-        "部",
-        "度",
-        "家",
-        "電",
-        "力",
-        "裡",
-        "如",
-        "水",
-        "化",
-        "高",
-        "自",
-        "二",
-        "理",
-        "起",
-        "小",
-        "物",
-        "現",
-        "實",
-        "加",
-        "量",
-        "都",
-        "兩",
-        "體",
-        "制",
-        "機",
-        "當",
-        "使",
-        "點",
-        "從",
-        "業",
-        "本",
-        "去",
-        "把",
-        "性",
-        "好",
-        "應",
-        "開",
-        "它",
-        "合",
-        "還",
-        "因",
-        "由",
-        "其",
-        "些",
-        "然",
-        "前",
-        "外",
-        "天",
-        "政",
-        "四",
-        "日",
-        "那",
-        "社",
-        "義",
-        "事",
-        "平",
-        "形",
-        "相",
-        "全",
-        "表",
-        "間",
-        "樣",
-        "與",
-        "關",
-        "各",
-        "重",
-        "新",
-        "線",
-        "內",
-        "數",
-        "正",
-        "心",
-        "反",
-        "你",
-        "明",
-        "看",
-        "原",
-        "又",
-        "麼",
-        "利",
-        "比",
-        "或",
-        "但",
-        "質",
-        "氣",
-        "第",
-        "向",
-        "道",
-        "命",
-        "此",
-        "變",
-        "條",
-        "只",
-        "沒",
-        "結",
-        "解",
-        "問",
-        "意",
-        "建",
-        "月",
-        "公",
-        "無",
-        "系",
-        "軍",
-        "很",
-        "情",
-        "者",
-        "最",
-        "立",
-        "代",
-        "想",
-        "已",
-        "通",
-        "並",
-        "提",
-        "直",
-        "題",
-        "黨",
-        "程",
-        "展",
-        "五",
-        "果",
-        "料",
-        "象",
-        "員",
-        "革",
-        "位",
-        "入",
-        "常",
-        "文",
-        "總",
-        "次",
-        "品",
-        "式",
-        "活",
-        "設",
-        "及",
-        "管",
-        "特",
-        "件",
-        "長",
-        "求",
-        "老",
-        "頭",
-        "基",
-        "資",
-        "邊",
-        "流",
-        "路",
-        "級",
-        "少",
-        "圖",
-        "山",
-        "統",
-        "接",
-        "知",
-        "較",
-        "將",
-        "組",
-        "見",
-        "計",
-        "別",
-        "她",
-        "手",
-        "角",
-        "期",
-        "根",
-        "論",
-        "運",
-        "農",
-        "指",
-        "幾",
-        "九",
-        "區",
-        "強",
-        "放",
-        "決",
-        "西",
-        "被",
-        "幹",
-        "做",
-        "必",
-        "戰",
-        "先",
-        "回",
-        "則",
-        "任",
-        "取",
-        "據",
-        "處",
-        "隊",
-        "南",
-        "給",
-        "色",
-        "光",
-        "門",
-        "即",
-        "保",
-        "治",
-        "北",
-        "造",
-        "百",
-        "規",
-        "熱",
-        "領",
-        "七",
-        "海",
-        "口",
-        "東",
-        "導",
-        "器",
-        "壓",
-        "志",
-        "世",
-        "金",
-        "增",
-        "爭",
-        "濟",
-        "階",
-        "油",
-        "思",
-        "術",
-        "極",
-        "交",
-        "受",
-        "聯",
-        "什",
-        "認",
-        "六",
-        "共",
-        "權",
-        "收",
-        "證",
-        "改",
-        "清",
-        "美",
-        "再",
-        "採",
-        "轉",
-        "更",
-        "單",
-        "風",
-        "切",
-        "打",
-        "白",
-        "教",
-        "速",
-        "花",
-        "帶",
-        "安",
-        "場",
-        "身",
-        "車",
-        "例",
-        "真",
-        "務",
-        "具",
-        "萬",
-        "每",
-        "目",
-        "至",
-        "達",
-        "走",
-        "積",
-        "示",
-        "議",
-        "聲",
-        "報",
-        "鬥",
-        "完",
-        "類",
-        "八",
-        "離",
-        "華",
-        "名",
-        "確",
-        "才",
-        "科",
-        "張",
-        "信",
-        "馬",
-        "節",
-        "話",
-        "米",
-        "整",
-        "空",
-        "元",
-        "況",
-        "今",
-        "集",
-        "溫",
-        "傳",
-        "土",
-        "許",
-        "步",
-        "群",
-        "廣",
-        "石",
-        "記",
-        "需",
-        "段",
-        "研",
-        "界",
-        "拉",
-        "林",
-        "律",
-        "叫",
-        "且",
-        "究",
-        "觀",
-        "越",
-        "織",
-        "裝",
-        "影",
-        "算",
-        "低",
-        "持",
-        "音",
-        "眾",
-        "書",
-        "布",
-        "复",
-        "容",
-        "兒",
-        "須",
-        "際",
-        "商",
-        "非",
-        "驗",
-        "連",
-        "斷",
-        "深",
-        "難",
-        "近",
-        "礦",
-        "千",
-        "週",
-        "委",
-        "素",
-        "技",
-        "備",
-        "半",
-        "辦",
-        "青",
-        "省",
-        "列",
-        "習",
-        "響",
-        "約",
-        "支",
-        "般",
-        "史",
-        "感",
-        "勞",
-        "便",
-        "團",
-        "往",
-        "酸",
-        "歷",
-        "市",
-        "克",
-        "何",
-        "除",
-        "消",
-        "構",
-        "府",
-        "稱",
-        "太",
-        "準",
-        "精",
-        "值",
-        "號",
-        "率",
-        "族",
-        "維",
-        "劃",
-        "選",
-        "標",
-        "寫",
-        "存",
-        "候",
-        "毛",
-        "親",
-        "快",
-        "效",
-        "斯",
-        "院",
-        "查",
-        "江",
-        "型",
-        "眼",
-        "王",
-        "按",
-        "格",
-        "養",
-        "易",
-        "置",
-        "派",
-        "層",
-        "片",
-        "始",
-        "卻",
-        "專",
-        "狀",
-        "育",
-        "廠",
-        "京",
-        "識",
-        "適",
-        "屬",
-        "圓",
-        "包",
-        "火",
-        "住",
-        "調",
-        "滿",
-        "縣",
-        "局",
-        "照",
-        "參",
-        "紅",
-        "細",
-        "引",
-        "聽",
-        "該",
-        "鐵",
-        "價",
-        "嚴",
-        "首",
-        "底",
-        "液",
-        "官",
-        "德",
-        "隨",
-        "病",
-        "蘇",
-        "失",
-        "爾",
-        "死",
-        "講",
-        "配",
-        "女",
-        "黃",
-        "推",
-        "顯",
-        "談",
-        "罪",
-        "神",
-        "藝",
-        "呢",
-        "席",
-        "含",
-        "企",
-        "望",
-        "密",
-        "批",
-        "營",
-        "項",
-        "防",
-        "舉",
-        "球",
-        "英",
-        "氧",
-        "勢",
-        "告",
-        "李",
-        "台",
-        "落",
-        "木",
-        "幫",
-        "輪",
-        "破",
-        "亞",
-        "師",
-        "圍",
-        "注",
-        "遠",
-        "字",
-        "材",
-        "排",
-        "供",
-        "河",
-        "態",
-        "封",
-        "另",
-        "施",
-        "減",
-        "樹",
-        "溶",
-        "怎",
-        "止",
-        "案",
-        "言",
-        "士",
-        "均",
-        "武",
-        "固",
-        "葉",
-        "魚",
-        "波",
-        "視",
-        "僅",
-        "費",
-        "緊",
-        "愛",
-        "左",
-        "章",
-        "早",
-        "朝",
-        "害",
-        "續",
-        "輕",
-        "服",
-        "試",
-        "食",
-        "充",
-        "兵",
-        "源",
-        "判",
-        "護",
-        "司",
-        "足",
-        "某",
-        "練",
-        "差",
-        "致",
-        "板",
-        "田",
-        "降",
-        "黑",
-        "犯",
-        "負",
-        "擊",
-        "范",
-        "繼",
-        "興",
-        "似",
-        "餘",
-        "堅",
-        "曲",
-        "輸",
-        "修",
-        "故",
-        "城",
-        "夫",
-        "夠",
-        "送",
-        "筆",
-        "船",
-        "佔",
-        "右",
-        "財",
-        "吃",
-        "富",
-        "春",
-        "職",
-        "覺",
-        "漢",
-        "畫",
-        "功",
-        "巴",
-        "跟",
-        "雖",
-        "雜",
-        "飛",
-        "檢",
-        "吸",
-        "助",
-        "昇",
-        "陽",
-        "互",
-        "初",
-        "創",
-        "抗",
-        "考",
-        "投",
-        "壞",
-        "策",
-        "古",
-        "徑",
-        "換",
-        "未",
-        "跑",
-        "留",
-        "鋼",
-        "曾",
-        "端",
-        "責",
-        "站",
-        "簡",
-        "述",
-        "錢",
-        "副",
-        "盡",
-        "帝",
-        "射",
-        "草",
-        "衝",
-        "承",
-        "獨",
-        "令",
-        "限",
-        "阿",
-        "宣",
-        "環",
-        "雙",
-        "請",
-        "超",
-        "微",
-        "讓",
-        "控",
-        "州",
-        "良",
-        "軸",
-        "找",
-        "否",
-        "紀",
-        "益",
-        "依",
-        "優",
-        "頂",
-        "礎",
-        "載",
-        "倒",
-        "房",
-        "突",
-        "坐",
-        "粉",
-        "敵",
-        "略",
-        "客",
-        "袁",
-        "冷",
-        "勝",
-        "絕",
-        "析",
-        "塊",
-        "劑",
-        "測",
-        "絲",
-        "協",
-        "訴",
-        "念",
-        "陳",
-        "仍",
-        "羅",
-        "鹽",
-        "友",
-        "洋",
-        "錯",
-        "苦",
-        "夜",
-        "刑",
-        "移",
-        "頻",
-        "逐",
-        "靠",
-        "混",
-        "母",
-        "短",
-        "皮",
-        "終",
-        "聚",
-        "汽",
-        "村",
-        "雲",
-        "哪",
-        "既",
-        "距",
-        "衛",
-        "停",
-        "烈",
-        "央",
-        "察",
-        "燒",
-        "迅",
-        "境",
-        "若",
-        "印",
-        "洲",
-        "刻",
-        "括",
-        "激",
-        "孔",
-        "搞",
-        "甚",
-        "室",
-        "待",
-        "核",
-        "校",
-        "散",
-        "侵",
-        "吧",
-        "甲",
-        "遊",
-        "久",
-        "菜",
-        "味",
-        "舊",
-        "模",
-        "湖",
-        "貨",
-        "損",
-        "預",
-        "阻",
-        "毫",
-        "普",
-        "穩",
-        "乙",
-        "媽",
-        "植",
-        "息",
-        "擴",
-        "銀",
-        "語",
-        "揮",
-        "酒",
-        "守",
-        "拿",
-        "序",
-        "紙",
-        "醫",
-        "缺",
-        "雨",
-        "嗎",
-        "針",
-        "劉",
-        "啊",
-        "急",
-        "唱",
-        "誤",
-        "訓",
-        "願",
-        "審",
-        "附",
-        "獲",
-        "茶",
-        "鮮",
-        "糧",
-        "斤",
-        "孩",
-        "脫",
-        "硫",
-        "肥",
-        "善",
-        "龍",
-        "演",
-        "父",
-        "漸",
-        "血",
-        "歡",
-        "械",
-        "掌",
-        "歌",
-        "沙",
-        "剛",
-        "攻",
-        "謂",
-        "盾",
-        "討",
-        "晚",
-        "粒",
-        "亂",
-        "燃",
-        "矛",
-        "乎",
-        "殺",
-        "藥",
-        "寧",
-        "魯",
-        "貴",
-        "鐘",
-        "煤",
-        "讀",
-        "班",
-        "伯",
-        "香",
-        "介",
-        "迫",
-        "句",
-        "豐",
-        "培",
-        "握",
-        "蘭",
-        "擔",
-        "弦",
-        "蛋",
-        "沉",
-        "假",
-        "穿",
-        "執",
-        "答",
-        "樂",
-        "誰",
-        "順",
-        "煙",
-        "縮",
-        "徵",
-        "臉",
-        "喜",
-        "松",
-        "腳",
-        "困",
-        "異",
-        "免",
-        "背",
-        "星",
-        "福",
-        "買",
-        "染",
-        "井",
-        "概",
-        "慢",
-        "怕",
-        "磁",
-        "倍",
-        "祖",
-        "皇",
-        "促",
-        "靜",
-        "補",
-        "評",
-        "翻",
-        "肉",
-        "踐",
-        "尼",
-        "衣",
-        "寬",
-        "揚",
-        "棉",
-        "希",
-        "傷",
-        "操",
-        "垂",
-        "秋",
-        "宜",
-        "氫",
-        "套",
-        "督",
-        "振",
-        "架",
-        "亮",
-        "末",
-        "憲",
-        "慶",
-        "編",
-        "牛",
-        "觸",
-        "映",
-        "雷",
-        "銷",
-        "詩",
-        "座",
-        "居",
-        "抓",
-        "裂",
-        "胞",
-        "呼",
-        "娘",
-        "景",
-        "威",
-        "綠",
-        "晶",
-        "厚",
-        "盟",
-        "衡",
-        "雞",
-        "孫",
-        "延",
-        "危",
-        "膠",
-        "屋",
-        "鄉",
-        "臨",
-        "陸",
-        "顧",
-        "掉",
-        "呀",
-        "燈",
-        "歲",
-        "措",
-        "束",
-        "耐",
-        "劇",
-        "玉",
-        "趙",
-        "跳",
-        "哥",
-        "季",
-        "課",
-        "凱",
-        "胡",
-        "額",
-        "款",
-        "紹",
-        "卷",
-        "齊",
-        "偉",
-        "蒸",
-        "殖",
-        "永",
-        "宗",
-        "苗",
-        "川",
-        "爐",
-        "岩",
-        "弱",
-        "零",
-        "楊",
-        "奏",
-        "沿",
-        "露",
-        "桿",
-        "探",
-        "滑",
-        "鎮",
-        "飯",
-        "濃",
-        "航",
-        "懷",
-        "趕",
-        "庫",
-        "奪",
-        "伊",
-        "靈",
-        "稅",
-        "途",
-        "滅",
-        "賽",
-        "歸",
-        "召",
-        "鼓",
-        "播",
-        "盤",
-        "裁",
-        "險",
-        "康",
-        "唯",
-        "錄",
-        "菌",
-        "純",
-        "借",
-        "糖",
-        "蓋",
-        "橫",
-        "符",
-        "私",
-        "努",
-        "堂",
-        "域",
-        "槍",
-        "潤",
-        "幅",
-        "哈",
-        "竟",
-        "熟",
-        "蟲",
-        "澤",
-        "腦",
-        "壤",
-        "碳",
-        "歐",
-        "遍",
-        "側",
-        "寨",
-        "敢",
-        "徹",
-        "慮",
-        "斜",
-        "薄",
-        "庭",
-        "納",
-        "彈",
-        "飼",
-        "伸",
-        "折",
-        "麥",
-        "濕",
-        "暗",
-        "荷",
-        "瓦",
-        "塞",
-        "床",
-        "築",
-        "惡",
-        "戶",
-        "訪",
-        "塔",
-        "奇",
-        "透",
-        "梁",
-        "刀",
-        "旋",
-        "跡",
-        "卡",
-        "氯",
-        "遇",
-        "份",
-        "毒",
-        "泥",
-        "退",
-        "洗",
-        "擺",
-        "灰",
-        "彩",
-        "賣",
-        "耗",
-        "夏",
-        "擇",
-        "忙",
-        "銅",
-        "獻",
-        "硬",
-        "予",
-        "繁",
-        "圈",
-        "雪",
-        "函",
-        "亦",
-        "抽",
-        "篇",
-        "陣",
-        "陰",
-        "丁",
-        "尺",
-        "追",
-        "堆",
-        "雄",
-        "迎",
-        "泛",
-        "爸",
-        "樓",
-        "避",
-        "謀",
-        "噸",
-        "野",
-        "豬",
-        "旗",
-        "累",
-        "偏",
-        "典",
-        "館",
-        "索",
-        "秦",
-        "脂",
-        "潮",
-        "爺",
-        "豆",
-        "忽",
-        "托",
-        "驚",
-        "塑",
-        "遺",
-        "愈",
-        "朱",
-        "替",
-        "纖",
-        "粗",
-        "傾",
-        "尚",
-        "痛",
-        "楚",
-        "謝",
-        "奮",
-        "購",
-        "磨",
-        "君",
-        "池",
-        "旁",
-        "碎",
-        "骨",
-        "監",
-        "捕",
-        "弟",
-        "暴",
-        "割",
-        "貫",
-        "殊",
-        "釋",
-        "詞",
-        "亡",
-        "壁",
-        "頓",
-        "寶",
-        "午",
-        "塵",
-        "聞",
-        "揭",
-        "炮",
-        "殘",
-        "冬",
-        "橋",
-        "婦",
-        "警",
-        "綜",
-        "招",
-        "吳",
-        "付",
-        "浮",
-        "遭",
-        "徐",
-        "您",
-        "搖",
-        "谷",
-        "贊",
-        "箱",
-        "隔",
-        "訂",
-        "男",
-        "吹",
-        "園",
-        "紛",
-        "唐",
-        "敗",
-        "宋",
-        "玻",
-        "巨",
-        "耕",
-        "坦",
-        "榮",
-        "閉",
-        "灣",
-        "鍵",
-        "凡",
-        "駐",
-        "鍋",
-        "救",
-        "恩",
-        "剝",
-        "凝",
-        "鹼",
-        "齒",
-        "截",
-        "煉",
-        "麻",
-        "紡",
-        "禁",
-        "廢",
-        "盛",
-        "版",
-        "緩",
-        "淨",
-        "睛",
-        "昌",
-        "婚",
-        "涉",
-        "筒",
-        "嘴",
-        "插",
-        "岸",
-        "朗",
-        "莊",
-        "街",
-        "藏",
-        "姑",
-        "貿",
-        "腐",
-        "奴",
-        "啦",
-        "慣",
-        "乘",
-        "夥",
-        "恢",
-        "勻",
-        "紗",
-        "扎",
-        "辯",
-        "耳",
-        "彪",
-        "臣",
-        "億",
-        "璃",
-        "抵",
-        "脈",
-        "秀",
-        "薩",
-        "俄",
-        "網",
-        "舞",
-        "店",
-        "噴",
-        "縱",
-        "寸",
-        "汗",
-        "掛",
-        "洪",
-        "賀",
-        "閃",
-        "柬",
-        "爆",
-        "烯",
-        "津",
-        "稻",
-        "牆",
-        "軟",
-        "勇",
-        "像",
-        "滾",
-        "厘",
-        "蒙",
-        "芳",
-        "肯",
-        "坡",
-        "柱",
-        "盪",
-        "腿",
-        "儀",
-        "旅",
-        "尾",
-        "軋",
-        "冰",
-        "貢",
-        "登",
-        "黎",
-        "削",
-        "鑽",
-        "勒",
-        "逃",
-        "障",
-        "氨",
-        "郭",
-        "峰",
-        "幣",
-        "港",
-        "伏",
-        "軌",
-        "畝",
-        "畢",
-        "擦",
-        "莫",
-        "刺",
-        "浪",
-        "秘",
-        "援",
-        "株",
-        "健",
-        "售",
-        "股",
-        "島",
-        "甘",
-        "泡",
-        "睡",
-        "童",
-        "鑄",
-        "湯",
-        "閥",
-        "休",
-        "匯",
-        "舍",
-        "牧",
-        "繞",
-        "炸",
-        "哲",
-        "磷",
-        "績",
-        "朋",
-        "淡",
-        "尖",
-        "啟",
-        "陷",
-        "柴",
-        "呈",
-        "徒",
-        "顏",
-        "淚",
-        "稍",
-        "忘",
-        "泵",
-        "藍",
-        "拖",
-        "洞",
-        "授",
-        "鏡",
-        "辛",
-        "壯",
-        "鋒",
-        "貧",
-        "虛",
-        "彎",
-        "摩",
-        "泰",
-        "幼",
-        "廷",
-        "尊",
-        "窗",
-        "綱",
-        "弄",
-        "隸",
-        "疑",
-        "氏",
-        "宮",
-        "姐",
-        "震",
-        "瑞",
-        "怪",
-        "尤",
-        "琴",
-        "循",
-        "描",
-        "膜",
-        "違",
-        "夾",
-        "腰",
-        "緣",
-        "珠",
-        "窮",
-        "森",
-        "枝",
-        "竹",
-        "溝",
-        "催",
-        "繩",
-        "憶",
-        "邦",
-        "剩",
-        "幸",
-        "漿",
-        "欄",
-        "擁",
-        "牙",
-        "貯",
-        "禮",
-        "濾",
-        "鈉",
-        "紋",
-        "罷",
-        "拍",
-        "咱",
-        "喊",
-        "袖",
-        "埃",
-        "勤",
-        "罰",
-        "焦",
-        "潛",
-        "伍",
-        "墨",
-        "欲",
-        "縫",
-        "姓",
-        "刊",
-        "飽",
-        "仿",
-        "獎",
-        "鋁",
-        "鬼",
-        "麗",
-        "跨",
-        "默",
-        "挖",
-        "鏈",
-        "掃",
-        "喝",
-        "袋",
-        "炭",
-        "污",
-        "幕",
-        "諸",
-        "弧",
-        "勵",
-        "梅",
-        "奶",
-        "潔",
-        "災",
-        "舟",
-        "鑑",
-        "苯",
-        "訟",
-        "抱",
-        "毀",
-        "懂",
-        "寒",
-        "智",
-        "埔",
-        "寄",
-        "屆",
-        "躍",
-        "渡",
-        "挑",
-        "丹",
-        "艱",
-        "貝",
-        "碰",
-        "拔",
-        "爹",
-        "戴",
-        "碼",
-        "夢",
-        "芽",
-        "熔",
-        "赤",
-        "漁",
-        "哭",
-        "敬",
-        "顆",
-        "奔",
-        "鉛",
-        "仲",
-        "虎",
-        "稀",
-        "妹",
-        "乏",
-        "珍",
-        "申",
-        "桌",
-        "遵",
-        "允",
-        "隆",
-        "螺",
-        "倉",
-        "魏",
-        "銳",
-        "曉",
-        "氮",
-        "兼",
-        "隱",
-        "礙",
-        "赫",
-        "撥",
-        "忠",
-        "肅",
-        "缸",
-        "牽",
-        "搶",
-        "博",
-        "巧",
-        "殼",
-        "兄",
-        "杜",
-        "訊",
-        "誠",
-        "碧",
-        "祥",
-        "柯",
-        "頁",
-        "巡",
-        "矩",
-        "悲",
-        "灌",
-        "齡",
-        "倫",
-        "票",
-        "尋",
-        "桂",
-        "鋪",
-        "聖",
-        "恐",
-        "恰",
-        "鄭",
-        "趣",
-        "抬",
-        "荒",
-        "騰",
-        "貼",
-        "柔",
-        "滴",
-        "猛",
-        "闊",
-        "輛",
-        "妻",
-        "填",
-        "撤",
-        "儲",
-        "簽",
-        "鬧",
-        "擾",
-        "紫",
-        "砂",
-        "遞",
-        "戲",
-        "吊",
-        "陶",
-        "伐",
-        "餵",
-        "療",
-        "瓶",
-        "婆",
-        "撫",
-        "臂",
-        "摸",
-        "忍",
-        "蝦",
-        "蠟",
-        "鄰",
-        "胸",
-        "鞏",
-        "擠",
-        "偶",
-        "棄",
-        "槽",
-        "勁",
-        "乳",
-        "鄧",
-        "吉",
-        "仁",
-        "爛",
-        "磚",
-        "租",
-        "烏",
-        "艦",
-        "伴",
-        "瓜",
-        "淺",
-        "丙",
-        "暫",
-        "燥",
-        "橡",
-        "柳",
-        "迷",
-        "暖",
-        "牌",
-        "秧",
-        "膽",
-        "詳",
-        "簧",
-        "踏",
-        "瓷",
-        "譜",
-        "呆",
-        "賓",
-        "糊",
-        "洛",
-        "輝",
-        "憤",
-        "競",
-        "隙",
-        "怒",
-        "粘",
-        "乃",
-        "緒",
-        "肩",
-        "籍",
-        "敏",
-        "塗",
-        "熙",
-        "皆",
-        "偵",
-        "懸",
-        "掘",
-        "享",
-        "糾",
-        "醒",
-        "狂",
-        "鎖",
-        "淀",
-        "恨",
-        "牲",
-        "霸",
-        "爬",
-        "賞",
-        "逆",
-        "玩",
-        "陵",
-        "祝",
-        "秒",
-        "浙",
-        "貌",
-        "役",
-        "彼",
-        "悉",
-        "鴨",
-        "趨",
-        "鳳",
-        "晨",
-        "畜",
-        "輩",
-        "秩",
-        "卵",
-        "署",
-        "梯",
-        "炎",
-        "灘",
-        "棋",
-        "驅",
-        "篩",
-        "峽",
-        "冒",
-        "啥",
-        "壽",
-        "譯",
-        "浸",
-        "泉",
-        "帽",
-        "遲",
-        "矽",
-        "疆",
-        "貸",
-        "漏",
-        "稿",
-        "冠",
-        "嫩",
-        "脅",
-        "芯",
-        "牢",
-        "叛",
-        "蝕",
-        "奧",
-        "鳴",
-        "嶺",
-        "羊",
-        "憑",
-        "串",
-        "塘",
-        "繪",
-        "酵",
-        "融",
-        "盆",
-        "錫",
-        "廟",
-        "籌",
-        "凍",
-        "輔",
-        "攝",
-        "襲",
-        "筋",
-        "拒",
-        "僚",
-        "旱",
-        "鉀",
-        "鳥",
-        "漆",
-        "沈",
-        "眉",
-        "疏",
-        "添",
-        "棒",
-        "穗",
-        "硝",
-        "韓",
-        "逼",
-        "扭",
-        "僑",
-        "涼",
-        "挺",
-        "碗",
-        "栽",
-        "炒",
-        "杯",
-        "患",
-        "餾",
-        "勸",
-        "豪",
-        "遼",
-        "勃",
-        "鴻",
-        "旦",
-        "吏",
-        "拜",
-        "狗",
-        "埋",
-        "輥",
-        "掩",
-        "飲",
-        "搬",
-        "罵",
-        "辭",
-        "勾",
-        "扣",
-        "估",
-        "蔣",
-        "絨",
-        "霧",
-        "丈",
-        "朵",
-        "姆",
-        "擬",
-        "宇",
-        "輯",
-        "陝",
-        "雕",
-        "償",
-        "蓄",
-        "崇",
-        "剪",
-        "倡",
-        "廳",
-        "咬",
-        "駛",
-        "薯",
-        "刷",
-        "斥",
-        "番",
-        "賦",
-        "奉",
-        "佛",
-        "澆",
-        "漫",
-        "曼",
-        "扇",
-        "鈣",
-        "桃",
-        "扶",
-        "仔",
-        "返",
-        "俗",
-        "虧",
-        "腔",
-        "鞋",
-        "棱",
-        "覆",
-        "框",
-        "悄",
-        "叔",
-        "撞",
-        "騙",
-        "勘",
-        "旺",
-        "沸",
-        "孤",
-        "吐",
-        "孟",
-        "渠",
-        "屈",
-        "疾",
-        "妙",
-        "惜",
-        "仰",
-        "狠",
-        "脹",
-        "諧",
-        "拋",
-        "黴",
-        "桑",
-        "崗",
-        "嘛",
-        "衰",
-        "盜",
-        "滲",
-        "臟",
-        "賴",
-        "湧",
-        "甜",
-        "曹",
-        "閱",
-        "肌",
-        "哩",
-        "厲",
-        "烴",
-        "緯",
-        "毅",
-        "昨",
-        "偽",
-        "症",
-        "煮",
-        "嘆",
-        "釘",
-        "搭",
-        "莖",
-        "籠",
-        "酷",
-        "偷",
-        "弓",
-        "錐",
-        "恆",
-        "傑",
-        "坑",
-        "鼻",
-        "翼",
-        "綸",
-        "敘",
-        "獄",
-        "逮",
-        "罐",
-        "絡",
-        "棚",
-        "抑",
-        "膨",
-        "蔬",
-        "寺",
-        "驟",
-        "穆",
-        "冶",
-        "枯",
-        "冊",
-        "屍",
-        "凸",
-        "紳",
-        "坯",
-        "犧",
-        "焰",
-        "轟",
-        "欣",
-        "晉",
-        "瘦",
-        "禦",
-        "錠",
-        "錦",
-        "喪",
-        "旬",
-        "鍛",
-        "壟",
-        "搜",
-        "撲",
-        "邀",
-        "亭",
-        "酯",
-        "邁",
-        "舒",
-        "脆",
-        "酶",
-        "閒",
-        "憂",
-        "酚",
-        "頑",
-        "羽",
-        "漲",
-        "卸",
-        "仗",
-        "陪",
-        "闢",
-        "懲",
-        "杭",
-        "姚",
-        "肚",
-        "捉",
-        "飄",
-        "漂",
-        "昆",
-        "欺",
-        "吾",
-        "郎",
-        "烷",
-        "汁",
-        "呵",
-        "飾",
-        "蕭",
-        "雅",
-        "郵",
-        "遷",
-        "燕",
-        "撒",
-        "姻",
-        "赴",
-        "宴",
-        "煩",
-        "債",
-        "帳",
-        "斑",
-        "鈴",
-        "旨",
-        "醇",
-        "董",
-        "餅",
-        "雛",
-        "姿",
-        "拌",
-        "傅",
-        "腹",
-        "妥",
-        "揉",
-        "賢",
-        "拆",
-        "歪",
-        "葡",
-        "胺",
-        "丟",
-        "浩",
-        "徽",
-        "昂",
-        "墊",
-        "擋",
-        "覽",
-        "貪",
-        "慰",
-        "繳",
-        "汪",
-        "慌",
-        "馮",
-        "諾",
-        "姜",
-        "誼",
-        "兇",
-        "劣",
-        "誣",
-        "耀",
-        "昏",
-        "躺",
-        "盈",
-        "騎",
-        "喬",
-        "溪",
-        "叢",
-        "盧",
-        "抹",
-        "悶",
-        "諮",
-        "刮",
-        "駕",
-        "纜",
-        "悟",
-        "摘",
-        "鉺",
-        "擲",
-        "頗",
-        "幻",
-        "柄",
-        "惠",
-        "慘",
-        "佳",
-        "仇",
-        "臘",
-        "窩",
-        "滌",
-        "劍",
-        "瞧",
-        "堡",
-        "潑",
-        "蔥",
-        "罩",
-        "霍",
-        "撈",
-        "胎",
-        "蒼",
-        "濱",
-        "倆",
-        "捅",
-        "湘",
-        "砍",
-        "霞",
-        "邵",
-        "萄",
-        "瘋",
-        "淮",
-        "遂",
-        "熊",
-        "糞",
-        "烘",
-        "宿",
-        "檔",
-        "戈",
-        "駁",
-        "嫂",
-        "裕",
-        "徙",
-        "箭",
-        "捐",
-        "腸",
-        "撐",
-        "曬",
-        "辨",
-        "殿",
-        "蓮",
-        "攤",
-        "攪",
-        "醬",
-        "屏",
-        "疫",
-        "哀",
-        "蔡",
-        "堵",
-        "沫",
-        "皺",
-        "暢",
-        "疊",
-        "閣",
-        "萊",
-        "敲",
-        "轄",
-        "鉤",
-        "痕",
-        "壩",
-        "巷",
-        "餓",
-        "禍",
-        "丘",
-        "玄",
-        "溜",
-        "曰",
-        "邏",
-        "彭",
-        "嘗",
-        "卿",
-        "妨",
-        "艇",
-        "吞",
-        "韋",
-        "怨",
-        "矮",
-        "歇"
-    }
+    0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 68, 72,
+    76, 80, 84, 88, 92, 96, 100, 104, 108, 112, 116, 120, 124, 128, 132, 136,
+    140, 144, 148, 152, 156, 160, 164, 168, 172, 176, 180, 184, 188, 192, 196,
+    200, 204, 208, 212, 216, 220, 224, 228, 232, 236, 240, 244, 248, 252, 256,
+    260, 264, 268, 272, 276, 280, 284, 288, 292, 296, 300, 304, 308, 312, 316,
+    320, 324, 328, 332, 336, 340, 344, 348, 352, 356, 360, 364, 368, 372, 376,
+    380, 384, 388, 392, 396, 400, 404, 408, 412, 416, 420, 424, 428, 432, 436,
+    440, 444, 448, 452, 456, 460, 464, 468, 472, 476, 480, 484, 488, 492, 496,
+    500, 504, 508, 512, 516, 520, 524, 528, 532, 536, 540, 544, 548, 552, 556,
+    560, 564, 568, 572, 576, 580, 584, 588, 592, 596, 600, 604, 608, 612, 616,
+    620, 624, 628, 632, 636, 640, 644, 648, 652, 656, 660, 664, 668, 672, 676,
+    680, 684, 688, 692, 696, 700, 704, 708, 712, 716, 720, 724, 728, 732, 736,
+    740, 744, 748, 752, 756, 760, 764, 768, 772, 776, 780, 784, 788, 792, 796,
+    800, 804, 808, 812, 816, 820, 824, 828, 832, 836, 840, 844, 848, 852, 856,
+    860, 864, 868, 872, 876, 880, 884, 888, 892, 896, 900, 904, 908, 912, 916,
+    920, 924, 928, 932, 936, 940, 944, 948, 952, 956, 960, 964, 968, 972, 976,
+    980, 984, 988, 992, 996, 1000, 1004, 1008, 1012, 1016, 1020, 1024, 1028,
+    1032, 1036, 1040, 1044, 1048, 1052, 1056, 1060, 1064, 1068, 1072, 1076,
+    1080, 1084, 1088, 1092, 1096, 1100, 1104, 1108, 1112, 1116, 1120, 1124,
+    1128, 1132, 1136, 1140, 1144, 1148, 1152, 1156, 1160, 1164, 1168, 1172,
+    1176, 1180, 1184, 1188, 1192, 1196, 1200, 1204, 1208, 1212, 1216, 1220,
+    1224, 1228, 1232, 1236, 1240, 1244, 1248, 1252, 1256, 1260, 1264, 1268,
+    1272, 1276, 1280, 1284, 1288, 1292, 1296, 1300, 1304, 1308, 1312, 1316,
+    1320, 1324, 1328, 1332, 1336, 1340, 1344, 1348, 1352, 1356, 1360, 1364,
+    1368, 1372, 1376, 1380, 1384, 1388, 1392, 1396, 1400, 1404, 1408, 1412,
+    1416, 1420, 1424, 1428, 1432, 1436, 1440, 1444, 1448, 1452, 1456, 1460,
+    1464, 1468, 1472, 1476, 1480, 1484, 1488, 1492, 1496, 1500, 1504, 1508,
+    1512, 1516, 1520, 1524, 1528, 1532, 1536, 1540, 1544, 1548, 1552, 1556,
+    1560, 1564, 1568, 1572, 1576, 1580, 1584, 1588, 1592, 1596, 1600, 1604,
+    1608, 1612, 1616, 1620, 1624, 1628, 1632, 1636, 1640, 1644, 1648, 1652,
+    1656, 1660, 1664, 1668, 1672, 1676, 1680, 1684, 1688, 1692, 1696, 1700,
+    1704, 1708, 1712, 1716, 1720, 1724, 1728, 1732, 1736, 1740, 1744, 1748,
+    1752, 1756, 1760, 1764, 1768, 1772, 1776, 1780, 1784, 1788, 1792, 1796,
+    1800, 1804, 1808, 1812, 1816, 1820, 1824, 1828, 1832, 1836, 1840, 1844,
+    1848, 1852, 1856, 1860, 1864, 1868, 1872, 1876, 1880, 1884, 1888, 1892,
+    1896, 1900, 1904, 1908, 1912, 1916, 1920, 1924, 1928, 1932, 1936, 1940,
+    1944, 1948, 1952, 1956, 1960, 1964, 1968, 1972, 1976, 1980, 1984, 1988,
+    1992, 1996, 2000, 2004, 2008, 2012, 2016, 2020, 2024, 2028, 2032, 2036,
+    2040, 2044, 2048, 2052, 2056, 2060, 2064, 2068, 2072, 2076, 2080, 2084,
+    2088, 2092, 2096, 2100, 2104, 2108, 2112, 2116, 2120, 2124, 2128, 2132,
+    2136, 2140, 2144, 2148, 2152, 2156, 2160, 2164, 2168, 2172, 2176, 2180,
+    2184, 2188, 2192, 2196, 2200, 2204, 2208, 2212, 2216, 2220, 2224, 2228,
+    2232, 2236, 2240, 2244, 2248, 2252, 2256, 2260, 2264, 2268, 2272, 2276,
+    2280, 2284, 2288, 2292, 2296, 2300, 2304, 2308, 2312, 2316, 2320, 2324,
+    2328, 2332, 2336, 2340, 2344, 2348, 2352, 2356, 2360, 2364, 2368, 2372,
+    2376, 2380, 2384, 2388, 2392, 2396, 2400, 2404, 2408, 2412, 2416, 2420,
+    2424, 2428, 2432, 2436, 2440, 2444, 2448, 2452, 2456, 2460, 2464, 2468,
+    2472, 2476, 2480, 2484, 2488, 2492, 2496, 2500, 2504, 2508, 2512, 2516,
+    2520, 2524, 2528, 2532, 2536, 2540, 2544, 2548, 2552, 2556, 2560, 2564,
+    2568, 2572, 2576, 2580, 2584, 2588, 2592, 2596, 2600, 2604, 2608, 2612,
+    2616, 2620, 2624, 2628, 2632, 2636, 2640, 2644, 2648, 2652, 2656, 2660,
+    2664, 2668, 2672, 2676, 2680, 2684, 2688, 2692, 2696, 2700, 2704, 2708,
+    2712, 2716, 2720, 2724, 2728, 2732, 2736, 2740, 2744, 2748, 2752, 2756,
+    2760, 2764, 2768, 2772, 2776, 2780, 2784, 2788, 2792, 2796, 2800, 2804,
+    2808, 2812, 2816, 2820, 2824, 2828, 2832, 2836, 2840, 2844, 2848, 2852,
+    2856, 2860, 2864, 2868, 2872, 2876, 2880, 2884, 2888, 2892, 2896, 2900,
+    2904, 2908, 2912, 2916, 2920, 2924, 2928, 2932, 2936, 2940, 2944, 2948,
+    2952, 2956, 2960, 2964, 2968, 2972, 2976, 2980, 2984, 2988, 2992, 2996,
+    3000, 3004, 3008, 3012, 3016, 3020, 3024, 3028, 3032, 3036, 3040, 3044,
+    3048, 3052, 3056, 3060, 3064, 3068, 3072, 3076, 3080, 3084, 3088, 3092,
+    3096, 3100, 3104, 3108, 3112, 3116, 3120, 3124, 3128, 3132, 3136, 3140,
+    3144, 3148, 3152, 3156, 3160, 3164, 3168, 3172, 3176, 3180, 3184, 3188,
+    3192, 3196, 3200, 3204, 3208, 3212, 3216, 3220, 3224, 3228, 3232, 3236,
+    3240, 3244, 3248, 3252, 3256, 3260, 3264, 3268, 3272, 3276, 3280, 3284,
+    3288, 3292, 3296, 3300, 3304, 3308, 3312, 3316, 3320, 3324, 3328, 3332,
+    3336, 3340, 3344, 3348, 3352, 3356, 3360, 3364, 3368, 3372, 3376, 3380,
+    3384, 3388, 3392, 3396, 3400, 3404, 3408, 3412, 3416, 3420, 3424, 3428,
+    3432, 3436, 3440, 3444, 3448, 3452, 3456, 3460, 3464, 3468, 3472, 3476,
+    3480, 3484, 3488, 3492, 3496, 3500, 3504, 3508, 3512, 3516, 3520, 3524,
+    3528, 3532, 3536, 3540, 3544, 3548, 3552, 3556, 3560, 3564, 3568, 3572,
+    3576, 3580, 3584, 3588, 3592, 3596, 3600, 3604, 3608, 3612, 3616, 3620,
+    3624, 3628, 3632, 3636, 3640, 3644, 3648, 3652, 3656, 3660, 3664, 3668,
+    3672, 3676, 3680, 3684, 3688, 3692, 3696, 3700, 3704, 3708, 3712, 3716,
+    3720, 3724, 3728, 3732, 3736, 3740, 3744, 3748, 3752, 3756, 3760, 3764,
+    3768, 3772, 3776, 3780, 3784, 3788, 3792, 3796, 3800, 3804, 3808, 3812,
+    3816, 3820, 3824, 3828, 3832, 3836, 3840, 3844, 3848, 3852, 3856, 3860,
+    3864, 3868, 3872, 3876, 3880, 3884, 3888, 3892, 3896, 3900, 3904, 3908,
+    3912, 3916, 3920, 3924, 3928, 3932, 3936, 3940, 3944, 3948, 3952, 3956,
+    3960, 3964, 3968, 3972, 3976, 3980, 3984, 3988, 3992, 3996, 4000, 4004,
+    4008, 4012, 4016, 4020, 4024, 4028, 4032, 4036, 4040, 4044, 4048, 4052,
+    4056, 4060, 4064, 4068, 4072, 4076, 4080, 4084, 4088, 4092, 4096, 4100,
+    4104, 4108, 4112, 4116, 4120, 4124, 4128, 4132, 4136, 4140, 4144, 4148,
+    4152, 4156, 4160, 4164, 4168, 4172, 4176, 4180, 4184, 4188, 4192, 4196,
+    4200, 4204, 4208, 4212, 4216, 4220, 4224, 4228, 4232, 4236, 4240, 4244,
+    4248, 4252, 4256, 4260, 4264, 4268, 4272, 4276, 4280, 4284, 4288, 4292,
+    4296, 4300, 4304, 4308, 4312, 4316, 4320, 4324, 4328, 4332, 4336, 4340,
+    4344, 4348, 4352, 4356, 4360, 4364, 4368, 4372, 4376, 4380, 4384, 4388,
+    4392, 4396, 4400, 4404, 4408, 4412, 4416, 4420, 4424, 4428, 4432, 4436,
+    4440, 4444, 4448, 4452, 4456, 4460, 4464, 4468, 4472, 4476, 4480, 4484,
+    4488, 4492, 4496, 4500, 4504, 4508, 4512, 4516, 4520, 4524, 4528, 4532,
+    4536, 4540, 4544, 4548, 4552, 4556, 4560, 4564, 4568, 4572, 4576, 4580,
+    4584, 4588, 4592, 4596, 4600, 4604, 4608, 4612, 4616, 4620, 4624, 4628,
+    4632, 4636, 4640, 4644, 4648, 4652, 4656, 4660, 4664, 4668, 4672, 4676,
+    4680, 4684, 4688, 4692, 4696, 4700, 4704, 4708, 4712, 4716, 4720, 4724,
+    4728, 4732, 4736, 4740, 4744, 4748, 4752, 4756, 4760, 4764, 4768, 4772,
+    4776, 4780, 4784, 4788, 4792, 4796, 4800, 4804, 4808, 4812, 4816, 4820,
+    4824, 4828, 4832, 4836, 4840, 4844, 4848, 4852, 4856, 4860, 4864, 4868,
+    4872, 4876, 4880, 4884, 4888, 4892, 4896, 4900, 4904, 4908, 4912, 4916,
+    4920, 4924, 4928, 4932, 4936, 4940, 4944, 4948, 4952, 4956, 4960, 4964,
+    4968, 4972, 4976, 4980, 4984, 4988, 4992, 4996, 5000, 5004, 5008, 5012,
+    5016, 5020, 5024, 5028, 5032, 5036, 5040, 5044, 5048, 5052, 5056, 5060,
+    5064, 5068, 5072, 5076, 5080, 5084, 5088, 5092, 5096, 5100, 5104, 5108,
+    5112, 5116, 5120, 5124, 5128, 5132, 5136, 5140, 5144, 5148, 5152, 5156,
+    5160, 5164, 5168, 5172, 5176, 5180, 5184, 5188, 5192, 5196, 5200, 5204,
+    5208, 5212, 5216, 5220, 5224, 5228, 5232, 5236, 5240, 5244, 5248, 5252,
+    5256, 5260, 5264, 5268, 5272, 5276, 5280, 5284, 5288, 5292, 5296, 5300,
+    5304, 5308, 5312, 5316, 5320, 5324, 5328, 5332, 5336, 5340, 5344, 5348,
+    5352, 5356, 5360, 5364, 5368, 5372, 5376, 5380, 5384, 5388, 5392, 5396,
+    5400, 5404, 5408, 5412, 5416, 5420, 5424, 5428, 5432, 5436, 5440, 5444,
+    5448, 5452, 5456, 5460, 5464, 5468, 5472, 5476, 5480, 5484, 5488, 5492,
+    5496, 5500, 5504, 5508, 5512, 5516, 5520, 5524, 5528, 5532, 5536, 5540,
+    5544, 5548, 5552, 5556, 5560, 5564, 5568, 5572, 5576, 5580, 5584, 5588,
+    5592, 5596, 5600, 5604, 5608, 5612, 5616, 5620, 5624, 5628, 5632, 5636,
+    5640, 5644, 5648, 5652, 5656, 5660, 5664, 5668, 5672, 5676, 5680, 5684,
+    5688, 5692, 5696, 5700, 5704, 5708, 5712, 5716, 5720, 5724, 5728, 5732,
+    5736, 5740, 5744, 5748, 5752, 5756, 5760, 5764, 5768, 5772, 5776, 5780,
+    5784, 5788, 5792, 5796, 5800, 5804, 5808, 5812, 5816, 5820, 5824, 5828,
+    5832, 5836, 5840, 5844, 5848, 5852, 5856, 5860, 5864, 5868, 5872, 5876,
+    5880, 5884, 5888, 5892, 5896, 5900, 5904, 5908, 5912, 5916, 5920, 5924,
+    5928, 5932, 5936, 5940, 5944, 5948, 5952, 5956, 5960, 5964, 5968, 5972,
+    5976, 5980, 5984, 5988, 5992, 5996, 6000, 6004, 6008, 6012, 6016, 6020,
+    6024, 6028, 6032, 6036, 6040, 6044, 6048, 6052, 6056, 6060, 6064, 6068,
+    6072, 6076, 6080, 6084, 6088, 6092, 6096, 6100, 6104, 6108, 6112, 6116,
+    6120, 6124, 6128, 6132, 6136, 6140, 6144, 6148, 6152, 6156, 6160, 6164,
+    6168, 6172, 6176, 6180, 6184, 6188, 6192, 6196, 6200, 6204, 6208, 6212,
+    6216, 6220, 6224, 6228, 6232, 6236, 6240, 6244, 6248, 6252, 6256, 6260,
+    6264, 6268, 6272, 6276, 6280, 6284, 6288, 6292, 6296, 6300, 6304, 6308,
+    6312, 6316, 6320, 6324, 6328, 6332, 6336, 6340, 6344, 6348, 6352, 6356,
+    6360, 6364, 6368, 6372, 6376, 6380, 6384, 6388, 6392, 6396, 6400, 6404,
+    6408, 6412, 6416, 6420, 6424, 6428, 6432, 6436, 6440, 6444, 6448, 6452,
+    6456, 6460, 6464, 6468, 6472, 6476, 6480, 6484, 6488, 6492, 6496, 6500,
+    6504, 6508, 6512, 6516, 6520, 6524, 6528, 6532, 6536, 6540, 6544, 6548,
+    6552, 6556, 6560, 6564, 6568, 6572, 6576, 6580, 6584, 6588, 6592, 6596,
+    6600, 6604, 6608, 6612, 6616, 6620, 6624, 6628, 6632, 6636, 6640, 6644,
+    6648, 6652, 6656, 6660, 6664, 6668, 6672, 6676, 6680, 6684, 6688, 6692,
+    6696, 6700, 6704, 6708, 6712, 6716, 6720, 6724, 6728, 6732, 6736, 6740,
+    6744, 6748, 6752, 6756, 6760, 6764, 6768, 6772, 6776, 6780, 6784, 6788,
+    6792, 6796, 6800, 6804, 6808, 6812, 6816, 6820, 6824, 6828, 6832, 6836,
+    6840, 6844, 6848, 6852, 6856, 6860, 6864, 6868, 6872, 6876, 6880, 6884,
+    6888, 6892, 6896, 6900, 6904, 6908, 6912, 6916, 6920, 6924, 6928, 6932,
+    6936, 6940, 6944, 6948, 6952, 6956, 6960, 6964, 6968, 6972, 6976, 6980,
+    6984, 6988, 6992, 6996, 7000, 7004, 7008, 7012, 7016, 7020, 7024, 7028,
+    7032, 7036, 7040, 7044, 7048, 7052, 7056, 7060, 7064, 7068, 7072, 7076,
+    7080, 7084, 7088, 7092, 7096, 7100, 7104, 7108, 7112, 7116, 7120, 7124,
+    7128, 7132, 7136, 7140, 7144, 7148, 7152, 7156, 7160, 7164, 7168, 7172,
+    7176, 7180, 7184, 7188, 7192, 7196, 7200, 7204, 7208, 7212, 7216, 7220,
+    7224, 7228, 7232, 7236, 7240, 7244, 7248, 7252, 7256, 7260, 7264, 7268,
+    7272, 7276, 7280, 7284, 7288, 7292, 7296, 7300, 7304, 7308, 7312, 7316,
+    7320, 7324, 7328, 7332, 7336, 7340, 7344, 7348, 7352, 7356, 7360, 7364,
+    7368, 7372, 7376, 7380, 7384, 7388, 7392, 7396, 7400, 7404, 7408, 7412,
+    7416, 7420, 7424, 7428, 7432, 7436, 7440, 7444, 7448, 7452, 7456, 7460,
+    7464, 7468, 7472, 7476, 7480, 7484, 7488, 7492, 7496, 7500, 7504, 7508,
+    7512, 7516, 7520, 7524, 7528, 7532, 7536, 7540, 7544, 7548, 7552, 7556,
+    7560, 7564, 7568, 7572, 7576, 7580, 7584, 7588, 7592, 7596, 7600, 7604,
+    7608, 7612, 7616, 7620, 7624, 7628, 7632, 7636, 7640, 7644, 7648, 7652,
+    7656, 7660, 7664, 7668, 7672, 7676, 7680, 7684, 7688, 7692, 7696, 7700,
+    7704, 7708, 7712, 7716, 7720, 7724, 7728, 7732, 7736, 7740, 7744, 7748,
+    7752, 7756, 7760, 7764, 7768, 7772, 7776, 7780, 7784, 7788, 7792, 7796,
+    7800, 7804, 7808, 7812, 7816, 7820, 7824, 7828, 7832, 7836, 7840, 7844,
+    7848, 7852, 7856, 7860, 7864, 7868, 7872, 7876, 7880, 7884, 7888, 7892,
+    7896, 7900, 7904, 7908, 7912, 7916, 7920, 7924, 7928, 7932, 7936, 7940,
+    7944, 7948, 7952, 7956, 7960, 7964, 7968, 7972, 7976, 7980, 7984, 7988,
+    7992, 7996, 8000, 8004, 8008, 8012, 8016, 8020, 8024, 8028, 8032, 8036,
+    8040, 8044, 8048, 8052, 8056, 8060, 8064, 8068, 8072, 8076, 8080, 8084,
+    8088, 8092, 8096, 8100, 8104, 8108, 8112, 8116, 8120, 8124, 8128, 8132,
+    8136, 8140, 8144, 8148, 8152, 8156, 8160, 8164, 8168, 8172, 8176, 8180,
+    8184, 8188
 };
 
+const dictionary zh_Hant{ zh_Hant_words, zh_Hant_offsets };
+
 // Word lists from:
 // github.com/bitcoin/bips/blob/master/bip-0039/bip-0039-wordlists.md
 const dictionary_list all
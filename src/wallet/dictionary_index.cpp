@@ -0,0 +1,186 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/wallet/dictionary_index.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <bitcoin/bitcoin/utility/assert.hpp>
+#include <bitcoin/bitcoin/utility/collection.hpp>
+#include <bitcoin/bitcoin/utility/string.hpp>
+#include <bitcoin/bitcoin/wallet/dictionary.hpp>
+
+namespace libbitcoin {
+namespace wallet {
+
+// A slot holds the word position plus one (zero is empty) in its low bits
+// and the top bits of the word hash in its high bits.
+static constexpr size_t position_bits = 16;
+static constexpr uint32_t position_mask = (1u << position_bits) - 1u;
+static constexpr size_t fingerprint_shift = 64 - position_bits;
+
+// Slots are at least twice the words, so probe sequences are short.
+static size_t slot_count(size_t size)
+{
+    size_t count = 2;
+    while (count < 2 * size)
+        count <<= 1;
+
+    return count;
+}
+
+dictionary_index::dictionary_index(const dictionary& lexicon)
+  : dictionary_index(lexicon.strings, lexicon.offsets, lexicon.size())
+{
+}
+
+dictionary_index::dictionary_index(const char* words,
+    const uint16_t* offsets, size_t size)
+  : words_(words),
+    offsets_(offsets),
+    size_(size),
+    mask_(slot_count(size) - 1),
+    slots_(mask_ + 1, 0)
+{
+    BITCOIN_ASSERT(size < position_mask);
+
+    for (size_t position = 0; position < size; ++position)
+    {
+        const auto word = words + offsets[position];
+        const auto value = hash(word, std::strlen(word));
+        const auto fingerprint = static_cast<uint32_t>(value >>
+            fingerprint_shift);
+        auto slot = value & mask_;
+
+        // A repeated word keeps its first position, as with a linear search.
+        if (find(word) != -1)
+            continue;
+
+        while (slots_[slot] != 0)
+            slot = (slot + 1) & mask_;
+
+        slots_[slot] = (fingerprint << position_bits) |
+            static_cast<uint32_t>(position + 1);
+    }
+}
+
+// FNV-1a, words are short so this is cheaper than a cryptographic hash.
+uint64_t dictionary_index::hash(const char* word, size_t length)
+{
+    uint64_t value = 0xcbf29ce484222325;
+
+    for (size_t index = 0; index < length; ++index)
+    {
+        value ^= static_cast<uint8_t>(word[index]);
+        value *= 0x100000001b3;
+    }
+
+    return value;
+}
+
+int dictionary_index::find(const std::string& word) const
+{
+    const auto value = hash(word.data(), word.size());
+    const auto fingerprint = static_cast<uint32_t>(value >> fingerprint_shift);
+
+    for (auto slot = value & mask_; slots_[slot] != 0;
+        slot = (slot + 1) & mask_)
+    {
+        const auto entry = slots_[slot];
+        if ((entry >> position_bits) != fingerprint)
+            continue;
+
+        const auto position = (entry & position_mask) - 1u;
+        if (word == words_ + offsets_[position])
+            return static_cast<int>(position);
+    }
+
+    return -1;
+}
+
+size_t dictionary_index::size() const
+{
+    return size_;
+}
+
+// Built-in indexes.
+// ----------------------------------------------------------------------------
+
+struct built_in_index
+{
+    const dictionary* lexicon;
+    const dictionary_index index;
+};
+
+// The dictionaries are constant-initialized, so they are complete when these
+// are constructed, unlike language::all.
+static const built_in_index built_in_indexes[] =
+{
+    { &language::en, { language::en } },
+    { &language::es, { language::es } },
+    { &language::ja, { language::ja } },
+    { &language::it, { language::it } },
+    { &language::fr, { language::fr } },
+    { &language::cs, { language::cs } },
+    { &language::ru, { language::ru } },
+    { &language::uk, { language::uk } },
+    { &language::zh_Hans, { language::zh_Hans } },
+    { &language::zh_Hant, { language::zh_Hant } }
+};
+
+const dictionary_index* find_index(const dictionary& lexicon)
+{
+    for (const auto& built_in: built_in_indexes)
+        if (built_in.lexicon == &lexicon)
+            return &built_in.index;
+
+    return nullptr;
+}
+
+int find_word(const dictionary& lexicon, const std::string& word)
+{
+    const auto index = find_index(lexicon);
+    return index == nullptr ? find_position(lexicon, word) : index->find(word);
+}
+
+dictionary_list find_lexicons(const string_list& words,
+    const dictionary_list& lexicons)
+{
+    dictionary_list out;
+
+    for (const auto lexicon: lexicons)
+    {
+        const auto index = find_index(*lexicon);
+        const auto contains = [&](const std::string& word)
+        {
+            return (index == nullptr ? find_position(*lexicon, word) :
+                index->find(word)) != -1;
+        };
+
+        if (std::all_of(words.begin(), words.end(), contains))
+            out.push_back(lexicon);
+    }
+
+    return out;
+}
+
+} // namespace wallet
+} // namespace libbitcoin
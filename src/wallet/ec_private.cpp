@@ -29,6 +29,7 @@
 #include <bitcoin/bitcoin/math/elliptic_curve.hpp>
 #include <bitcoin/bitcoin/math/hash.hpp>
 #include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/secure_allocator.hpp>
 #include <bitcoin/bitcoin/wallet/ec_public.hpp>
 #include <bitcoin/bitcoin/wallet/hd_private.hpp>
 #include <bitcoin/bitcoin/wallet/payment_address.hpp>
@@ -104,6 +105,11 @@ bool ec_private::is_wif(data_slice decoded)
         decoded.data()[1 + ec_secret_size] == compressed_sentinel;
 }
 
+ec_private::~ec_private()
+{
+    zeroize(secret_.data(), secret_.size());
+}
+
 // Factories.
 // ----------------------------------------------------------------------------
 
@@ -32,6 +32,7 @@
 #include <bitcoin/bitcoin/utility/string.hpp>
 #include <bitcoin/bitcoin/utility/container_sink.hpp>
 #include <bitcoin/bitcoin/utility/ostream_writer.hpp>
+#include <bitcoin/bitcoin/wallet/dictionary_index.hpp>
 #include <bitcoin/bitcoin/wallet/electrum_dictionary.hpp>
 #include "../math/external/pkcs5_pbkdf2.h"
 
@@ -47,6 +48,10 @@ static const auto hmac_data = to_chunk(seed_version);
 
 #ifdef WITH_ICU
 
+// The v1 dictionary is constant-initialized, so it is complete at this time.
+static const dictionary_index index_v1(language::electrum::en_v1.strings,
+    language::electrum::en_v1.offsets, language::electrum::en_v1.size());
+
 static size_t special_modulo(int32_t index_distance, size_t dictionary_size)
 {
     return index_distance < 0 ? 
@@ -73,9 +78,9 @@ static data_chunk old_mnemonic_decode(const word_list& mnemonic)
 
     for (size_t i = 0; i < mnemonic.size() / 3; i += 3)
     {
-        const auto first = find_position(lexicon, mnemonic[i]);
-        const auto second = find_position(lexicon, mnemonic[i+1]);
-        const auto third = find_position(lexicon, mnemonic[i+2]);
+        const auto first = index_v1.find(mnemonic[i]);
+        const auto second = index_v1.find(mnemonic[i+1]);
+        const auto third = index_v1.find(mnemonic[i+2]);
 
         if ((first == -1) || (second == -1) || (third == -1))
             return {};
@@ -142,10 +147,12 @@ static cpp_int mnemonic_decode(const word_list& mnemonic,
 {
     cpp_int entropy = 0;
     const auto dictionary_size = lexicon.size();
+    const auto index = find_index(lexicon);
 
     for (const auto& word: boost::adaptors::reverse(mnemonic))
     {
-        const auto position = find_position(lexicon, word);
+        const auto position = index == nullptr ?
+            find_position(lexicon, word) : index->find(word);
         if (position == -1)
             return { 1 };
 
@@ -208,7 +215,8 @@ bool validate_mnemonic(const word_list& mnemonic, const dictionary& lexicon,
 bool validate_mnemonic(const word_list& mnemonic,
     const dictionary_list& lexicons, const seed prefix)
 {
-    for (const auto& lexicon: lexicons)
+    // Only lexicons containing every word may validate.
+    for (const auto& lexicon: find_lexicons(mnemonic, lexicons))
         if (validate_mnemonic(mnemonic, *lexicon, prefix))
             return true;
 
@@ -23,1638 +23,1777 @@ namespace wallet {
 namespace language {
 namespace electrum {
 
-const dictionary_v1 en_v1 =
+// Each list is packed into one string of null terminated words, located by
+// a table of offsets, so that it requires no relocation (see packed_strings).
+
+static const char en_v1_words[] =
+    "like\0"
+    "just\0"
+    "love\0"
+    "know\0"
+    "never\0"
+    "want\0"
+    "time\0"
+    "out\0"
+    "there\0"
+    "make\0"
+    "look\0"
+    "eye\0"
+    "down\0"
+    "only\0"
+    "think\0"
+    "heart\0"
+    "back\0"
+    "then\0"
+    "into\0"
+    "about\0"
+    "more\0"
+    "away\0"
+    "still\0"
+    "them\0"
+    "take\0"
+    "thing\0"
+    "even\0"
+    "through\0"
+    "long\0"
+    "always\0"
+    "world\0"
+    "too\0"
+    "friend\0"
+    "tell\0"
+    "try\0"
+    "hand\0"
+    "thought\0"
+    "over\0"
+    "here\0"
+    "other\0"
+    "need\0"
+    "smile\0"
+    "again\0"
+    "much\0"
+    "cry\0"
+    "been\0"
+    "night\0"
+    "ever\0"
+    "little\0"
+    "said\0"
+    "end\0"
+    "some\0"
+    "those\0"
+    "around\0"
+    "mind\0"
+    "people\0"
+    "girl\0"
+    "leave\0"
+    "dream\0"
+    "left\0"
+    "turn\0"
+    "myself\0"
+    "give\0"
+    "nothing\0"
+    "really\0"
+    "off\0"
+    "before\0"
+    "something\0"
+    "find\0"
+    "walk\0"
+    "wish\0"
+    "good\0"
+    "once\0"
+    "place\0"
+    "ask\0"
+    "stop\0"
+    "keep\0"
+    "watch\0"
+    "seem\0"
+    "everything\0"
+    "wait\0"
+    "got\0"
+    "yet\0"
+    "made\0"
+    "remember\0"
+    "start\0"
+    "alone\0"
+    "run\0"
+    "hope\0"
+    "maybe\0"
+    "believe\0"
+    "body\0"
+    "hate\0"
+    "after\0"
+    "close\0"
+    "talk\0"
+    "stand\0"
+    "own\0"
+    "each\0"
+    "hurt\0"
+    "help\0"
+    "home\0"
+    "god\0"
+    "soul\0"
+    "new\0"
+    "many\0"
+    "two\0"
+    "inside\0"
+    "should\0"
+    "true\0"
+    "first\0"
+    "fear\0"
+    "mean\0"
+    "better\0"
+    "play\0"
+    "another\0"
+    "gone\0"
+    "change\0"
+    "use\0"
+    "wonder\0"
+    "someone\0"
+    "hair\0"
+    "cold\0"
+    "open\0"
+    "best\0"
+    "any\0"
+    "behind\0"
+    "happen\0"
+    "water\0"
+    "dark\0"
+    "laugh\0"
+    "stay\0"
+    "forever\0"
+    "name\0"
+    "work\0"
+    "show\0"
+    "sky\0"
+    "break\0"
+    "came\0"
+    "deep\0"
+    "door\0"
+    "put\0"
+    "black\0"
+    "together\0"
+    "upon\0"
+    "happy\0"
+    "such\0"
+    "great\0"
+    "white\0"
+    "matter\0"
+    "fill\0"
+    "past\0"
+    "please\0"
+    "burn\0"
+    "cause\0"
+    "enough\0"
+    "touch\0"
+    "moment\0"
+    "soon\0"
+    "voice\0"
+    "scream\0"
+    "anything\0"
+    "stare\0"
+    "sound\0"
+    "red\0"
+    "everyone\0"
+    "hide\0"
+    "kiss\0"
+    "truth\0"
+    "death\0"
+    "beautiful\0"
+    "mine\0"
+    "blood\0"
+    "broken\0"
+    "very\0"
+    "pass\0"
+    "next\0"
+    "forget\0"
+    "tree\0"
+    "wrong\0"
+    "air\0"
+    "mother\0"
+    "understand\0"
+    "lip\0"
+    "hit\0"
+    "wall\0"
+    "memory\0"
+    "sleep\0"
+    "free\0"
+    "high\0"
+    "realize\0"
+    "school\0"
+    "might\0"
+    "skin\0"
+    "sweet\0"
+    "perfect\0"
+    "blue\0"
+    "kill\0"
+    "breath\0"
+    "dance\0"
+    "against\0"
+    "fly\0"
+    "between\0"
+    "grow\0"
+    "strong\0"
+    "under\0"
+    "listen\0"
+    "bring\0"
+    "sometimes\0"
+    "speak\0"
+    "pull\0"
+    "person\0"
+    "become\0"
+    "family\0"
+    "begin\0"
+    "ground\0"
+    "real\0"
+    "small\0"
+    "father\0"
+    "sure\0"
+    "feet\0"
+    "rest\0"
+    "young\0"
+    "finally\0"
+    "land\0"
+    "across\0"
+    "today\0"
+    "different\0"
+    "guy\0"
+    "line\0"
+    "fire\0"
+    "reason\0"
+    "reach\0"
+    "second\0"
+    "slowly\0"
+    "write\0"
+    "eat\0"
+    "smell\0"
+    "mouth\0"
+    "step\0"
+    "learn\0"
+    "three\0"
+    "floor\0"
+    "promise\0"
+    "breathe\0"
+    "darkness\0"
+    "push\0"
+    "earth\0"
+    "guess\0"
+    "save\0"
+    "song\0"
+    "above\0"
+    "along\0"
+    "both\0"
+    "color\0"
+    "house\0"
+    "almost\0"
+    "sorry\0"
+    "anymore\0"
+    "brother\0"
+    "okay\0"
+    "dear\0"
+    "game\0"
+    "fade\0"
+    "already\0"
+    "apart\0"
+    "warm\0"
+    "beauty\0"
+    "heard\0"
+    "notice\0"
+    "question\0"
+    "shine\0"
+    "began\0"
+    "piece\0"
+    "whole\0"
+    "shadow\0"
+    "secret\0"
+    "street\0"
+    "within\0"
+    "finger\0"
+    "point\0"
+    "morning\0"
+    "whisper\0"
+    "child\0"
+    "moon\0"
+    "green\0"
+    "story\0"
+    "glass\0"
+    "kid\0"
+    "silence\0"
+    "since\0"
+    "soft\0"
+    "yourself\0"
+    "empty\0"
+    "shall\0"
+    "angel\0"
+    "answer\0"
+    "baby\0"
+    "bright\0"
+    "dad\0"
+    "path\0"
+    "worry\0"
+    "hour\0"
+    "drop\0"
+    "follow\0"
+    "power\0"
+    "war\0"
+    "half\0"
+    "flow\0"
+    "heaven\0"
+    "act\0"
+    "chance\0"
+    "fact\0"
+    "least\0"
+    "tired\0"
+    "children\0"
+    "near\0"
+    "quite\0"
+    "afraid\0"
+    "rise\0"
+    "sea\0"
+    "taste\0"
+    "window\0"
+    "cover\0"
+    "nice\0"
+    "trust\0"
+    "lot\0"
+    "sad\0"
+    "cool\0"
+    "force\0"
+    "peace\0"
+    "return\0"
+    "blind\0"
+    "easy\0"
+    "ready\0"
+    "roll\0"
+    "rose\0"
+    "drive\0"
+    "held\0"
+    "music\0"
+    "beneath\0"
+    "hang\0"
+    "mom\0"
+    "paint\0"
+    "emotion\0"
+    "quiet\0"
+    "clear\0"
+    "cloud\0"
+    "few\0"
+    "pretty\0"
+    "bird\0"
+    "outside\0"
+    "paper\0"
+    "picture\0"
+    "front\0"
+    "rock\0"
+    "simple\0"
+    "anyone\0"
+    "meant\0"
+    "reality\0"
+    "road\0"
+    "sense\0"
+    "waste\0"
+    "bit\0"
+    "leaf\0"
+    "thank\0"
+    "happiness\0"
+    "meet\0"
+    "men\0"
+    "smoke\0"
+    "truly\0"
+    "decide\0"
+    "self\0"
+    "age\0"
+    "book\0"
+    "form\0"
+    "alive\0"
+    "carry\0"
+    "escape\0"
+    "damn\0"
+    "instead\0"
+    "able\0"
+    "ice\0"
+    "minute\0"
+    "throw\0"
+    "catch\0"
+    "leg\0"
+    "ring\0"
+    "course\0"
+    "goodbye\0"
+    "lead\0"
+    "poem\0"
+    "sick\0"
+    "corner\0"
+    "desire\0"
+    "known\0"
+    "problem\0"
+    "remind\0"
+    "shoulder\0"
+    "suppose\0"
+    "toward\0"
+    "wave\0"
+    "drink\0"
+    "jump\0"
+    "woman\0"
+    "pretend\0"
+    "sister\0"
+    "week\0"
+    "human\0"
+    "joy\0"
+    "crack\0"
+    "grey\0"
+    "pray\0"
+    "surprise\0"
+    "dry\0"
+    "knee\0"
+    "less\0"
+    "search\0"
+    "bleed\0"
+    "caught\0"
+    "clean\0"
+    "embrace\0"
+    "future\0"
+    "king\0"
+    "son\0"
+    "sorrow\0"
+    "chest\0"
+    "hug\0"
+    "remain\0"
+    "sat\0"
+    "worth\0"
+    "blow\0"
+    "daddy\0"
+    "final\0"
+    "parent\0"
+    "tight\0"
+    "also\0"
+    "create\0"
+    "lonely\0"
+    "safe\0"
+    "cross\0"
+    "dress\0"
+    "evil\0"
+    "silent\0"
+    "bone\0"
+    "fate\0"
+    "perhaps\0"
+    "anger\0"
+    "class\0"
+    "scar\0"
+    "snow\0"
+    "tiny\0"
+    "tonight\0"
+    "continue\0"
+    "control\0"
+    "dog\0"
+    "edge\0"
+    "mirror\0"
+    "month\0"
+    "suddenly\0"
+    "comfort\0"
+    "given\0"
+    "loud\0"
+    "quickly\0"
+    "gaze\0"
+    "plan\0"
+    "rush\0"
+    "stone\0"
+    "town\0"
+    "battle\0"
+    "ignore\0"
+    "spirit\0"
+    "stood\0"
+    "stupid\0"
+    "yours\0"
+    "brown\0"
+    "build\0"
+    "dust\0"
+    "hey\0"
+    "kept\0"
+    "pay\0"
+    "phone\0"
+    "twist\0"
+    "although\0"
+    "ball\0"
+    "beyond\0"
+    "hidden\0"
+    "nose\0"
+    "taken\0"
+    "fail\0"
+    "float\0"
+    "pure\0"
+    "somehow\0"
+    "wash\0"
+    "wrap\0"
+    "angry\0"
+    "cheek\0"
+    "creature\0"
+    "forgotten\0"
+    "heat\0"
+    "rip\0"
+    "single\0"
+    "space\0"
+    "special\0"
+    "weak\0"
+    "whatever\0"
+    "yell\0"
+    "anyway\0"
+    "blame\0"
+    "job\0"
+    "choose\0"
+    "country\0"
+    "curse\0"
+    "drift\0"
+    "echo\0"
+    "figure\0"
+    "grew\0"
+    "laughter\0"
+    "neck\0"
+    "suffer\0"
+    "worse\0"
+    "yeah\0"
+    "disappear\0"
+    "foot\0"
+    "forward\0"
+    "knife\0"
+    "mess\0"
+    "somewhere\0"
+    "stomach\0"
+    "storm\0"
+    "beg\0"
+    "idea\0"
+    "lift\0"
+    "offer\0"
+    "breeze\0"
+    "field\0"
+    "five\0"
+    "often\0"
+    "simply\0"
+    "stuck\0"
+    "win\0"
+    "allow\0"
+    "confuse\0"
+    "enjoy\0"
+    "except\0"
+    "flower\0"
+    "seek\0"
+    "strength\0"
+    "calm\0"
+    "grin\0"
+    "gun\0"
+    "heavy\0"
+    "hill\0"
+    "large\0"
+    "ocean\0"
+    "shoe\0"
+    "sigh\0"
+    "straight\0"
+    "summer\0"
+    "tongue\0"
+    "accept\0"
+    "crazy\0"
+    "everyday\0"
+    "exist\0"
+    "grass\0"
+    "mistake\0"
+    "sent\0"
+    "shut\0"
+    "surround\0"
+    "table\0"
+    "ache\0"
+    "brain\0"
+    "destroy\0"
+    "heal\0"
+    "nature\0"
+    "shout\0"
+    "sign\0"
+    "stain\0"
+    "choice\0"
+    "doubt\0"
+    "glance\0"
+    "glow\0"
+    "mountain\0"
+    "queen\0"
+    "stranger\0"
+    "throat\0"
+    "tomorrow\0"
+    "city\0"
+    "either\0"
+    "fish\0"
+    "flame\0"
+    "rather\0"
+    "shape\0"
+    "spin\0"
+    "spread\0"
+    "ash\0"
+    "distance\0"
+    "finish\0"
+    "image\0"
+    "imagine\0"
+    "important\0"
+    "nobody\0"
+    "shatter\0"
+    "warmth\0"
+    "became\0"
+    "feed\0"
+    "flesh\0"
+    "funny\0"
+    "lust\0"
+    "shirt\0"
+    "trouble\0"
+    "yellow\0"
+    "attention\0"
+    "bare\0"
+    "bite\0"
+    "money\0"
+    "protect\0"
+    "amaze\0"
+    "appear\0"
+    "born\0"
+    "choke\0"
+    "completely\0"
+    "daughter\0"
+    "fresh\0"
+    "friendship\0"
+    "gentle\0"
+    "probably\0"
+    "six\0"
+    "deserve\0"
+    "expect\0"
+    "grab\0"
+    "middle\0"
+    "nightmare\0"
+    "river\0"
+    "thousand\0"
+    "weight\0"
+    "worst\0"
+    "wound\0"
+    "barely\0"
+    "bottle\0"
+    "cream\0"
+    "regret\0"
+    "relationship\0"
+    "stick\0"
+    "test\0"
+    "crush\0"
+    "endless\0"
+    "fault\0"
+    "itself\0"
+    "rule\0"
+    "spill\0"
+    "art\0"
+    "circle\0"
+    "join\0"
+    "kick\0"
+    "mask\0"
+    "master\0"
+    "passion\0"
+    "quick\0"
+    "raise\0"
+    "smooth\0"
+    "unless\0"
+    "wander\0"
+    "actually\0"
+    "broke\0"
+    "chair\0"
+    "deal\0"
+    "favorite\0"
+    "gift\0"
+    "note\0"
+    "number\0"
+    "sweat\0"
+    "box\0"
+    "chill\0"
+    "clothes\0"
+    "lady\0"
+    "mark\0"
+    "park\0"
+    "poor\0"
+    "sadness\0"
+    "tie\0"
+    "animal\0"
+    "belong\0"
+    "brush\0"
+    "consume\0"
+    "dawn\0"
+    "forest\0"
+    "innocent\0"
+    "pen\0"
+    "pride\0"
+    "stream\0"
+    "thick\0"
+    "clay\0"
+    "complete\0"
+    "count\0"
+    "draw\0"
+    "faith\0"
+    "press\0"
+    "silver\0"
+    "struggle\0"
+    "surface\0"
+    "taught\0"
+    "teach\0"
+    "wet\0"
+    "bless\0"
+    "chase\0"
+    "climb\0"
+    "enter\0"
+    "letter\0"
+    "melt\0"
+    "metal\0"
+    "movie\0"
+    "stretch\0"
+    "swing\0"
+    "vision\0"
+    "wife\0"
+    "beside\0"
+    "crash\0"
+    "forgot\0"
+    "guide\0"
+    "haunt\0"
+    "joke\0"
+    "knock\0"
+    "plant\0"
+    "pour\0"
+    "prove\0"
+    "reveal\0"
+    "steal\0"
+    "stuff\0"
+    "trip\0"
+    "wood\0"
+    "wrist\0"
+    "bother\0"
+    "bottom\0"
+    "crawl\0"
+    "crowd\0"
+    "fix\0"
+    "forgive\0"
+    "frown\0"
+    "grace\0"
+    "loose\0"
+    "lucky\0"
+    "party\0"
+    "release\0"
+    "surely\0"
+    "survive\0"
+    "teacher\0"
+    "gently\0"
+    "grip\0"
+    "speed\0"
+    "suicide\0"
+    "travel\0"
+    "treat\0"
+    "vein\0"
+    "written\0"
+    "cage\0"
+    "chain\0"
+    "conversation\0"
+    "date\0"
+    "enemy\0"
+    "however\0"
+    "interest\0"
+    "million\0"
+    "page\0"
+    "pink\0"
+    "proud\0"
+    "sway\0"
+    "themselves\0"
+    "winter\0"
+    "church\0"
+    "cruel\0"
+    "cup\0"
+    "demon\0"
+    "experience\0"
+    "freedom\0"
+    "pair\0"
+    "pop\0"
+    "purpose\0"
+    "respect\0"
+    "shoot\0"
+    "softly\0"
+    "state\0"
+    "strange\0"
+    "bar\0"
+    "birth\0"
+    "curl\0"
+    "dirt\0"
+    "excuse\0"
+    "lord\0"
+    "lovely\0"
+    "monster\0"
+    "order\0"
+    "pack\0"
+    "pants\0"
+    "pool\0"
+    "scene\0"
+    "seven\0"
+    "shame\0"
+    "slide\0"
+    "ugly\0"
+    "among\0"
+    "blade\0"
+    "blonde\0"
+    "closet\0"
+    "creek\0"
+    "deny\0"
+    "drug\0"
+    "eternity\0"
+    "gain\0"
+    "grade\0"
+    "handle\0"
+    "key\0"
+    "linger\0"
+    "pale\0"
+    "prepare\0"
+    "swallow\0"
+    "swim\0"
+    "tremble\0"
+    "wheel\0"
+    "won\0"
+    "cast\0"
+    "cigarette\0"
+    "claim\0"
+    "college\0"
+    "direction\0"
+    "dirty\0"
+    "gather\0"
+    "ghost\0"
+    "hundred\0"
+    "loss\0"
+    "lung\0"
+    "orange\0"
+    "present\0"
+    "swear\0"
+    "swirl\0"
+    "twice\0"
+    "wild\0"
+    "bitter\0"
+    "blanket\0"
+    "doctor\0"
+    "everywhere\0"
+    "flash\0"
+    "grown\0"
+    "knowledge\0"
+    "numb\0"
+    "pressure\0"
+    "radio\0"
+    "repeat\0"
+    "ruin\0"
+    "spend\0"
+    "unknown\0"
+    "buy\0"
+    "clock\0"
+    "devil\0"
+    "early\0"
+    "false\0"
+    "fantasy\0"
+    "pound\0"
+    "precious\0"
+    "refuse\0"
+    "sheet\0"
+    "teeth\0"
+    "welcome\0"
+    "add\0"
+    "ahead\0"
+    "block\0"
+    "bury\0"
+    "caress\0"
+    "content\0"
+    "depth\0"
+    "despite\0"
+    "distant\0"
+    "marry\0"
+    "purple\0"
+    "threw\0"
+    "whenever\0"
+    "bomb\0"
+    "dull\0"
+    "easily\0"
+    "grasp\0"
+    "hospital\0"
+    "innocence\0"
+    "normal\0"
+    "receive\0"
+    "reply\0"
+    "rhyme\0"
+    "shade\0"
+    "someday\0"
+    "sword\0"
+    "toe\0"
+    "visit\0"
+    "asleep\0"
+    "bought\0"
+    "center\0"
+    "consider\0"
+    "flat\0"
+    "hero\0"
+    "history\0"
+    "ink\0"
+    "insane\0"
+    "muscle\0"
+    "mystery\0"
+    "pocket\0"
+    "reflection\0"
+    "shove\0"
+    "silently\0"
+    "smart\0"
+    "soldier\0"
+    "spot\0"
+    "stress\0"
+    "train\0"
+    "type\0"
+    "view\0"
+    "whether\0"
+    "bus\0"
+    "energy\0"
+    "explain\0"
+    "holy\0"
+    "hunger\0"
+    "inch\0"
+    "magic\0"
+    "mix\0"
+    "noise\0"
+    "nowhere\0"
+    "prayer\0"
+    "presence\0"
+    "shock\0"
+    "snap\0"
+    "spider\0"
+    "study\0"
+    "thunder\0"
+    "trail\0"
+    "admit\0"
+    "agree\0"
+    "bag\0"
+    "bang\0"
+    "bound\0"
+    "butterfly\0"
+    "cute\0"
+    "exactly\0"
+    "explode\0"
+    "familiar\0"
+    "fold\0"
+    "further\0"
+    "pierce\0"
+    "reflect\0"
+    "scent\0"
+    "selfish\0"
+    "sharp\0"
+    "sink\0"
+    "spring\0"
+    "stumble\0"
+    "universe\0"
+    "weep\0"
+    "women\0"
+    "wonderful\0"
+    "action\0"
+    "ancient\0"
+    "attempt\0"
+    "avoid\0"
+    "birthday\0"
+    "branch\0"
+    "chocolate\0"
+    "core\0"
+    "depress\0"
+    "drunk\0"
+    "especially\0"
+    "focus\0"
+    "fruit\0"
+    "honest\0"
+    "match\0"
+    "palm\0"
+    "perfectly\0"
+    "pillow\0"
+    "pity\0"
+    "poison\0"
+    "roar\0"
+    "shift\0"
+    "slightly\0"
+    "thump\0"
+    "truck\0"
+    "tune\0"
+    "twenty\0"
+    "unable\0"
+    "wipe\0"
+    "wrote\0"
+    "coat\0"
+    "constant\0"
+    "dinner\0"
+    "drove\0"
+    "egg\0"
+    "eternal\0"
+    "flight\0"
+    "flood\0"
+    "frame\0"
+    "freak\0"
+    "gasp\0"
+    "glad\0"
+    "hollow\0"
+    "motion\0"
+    "peer\0"
+    "plastic\0"
+    "root\0"
+    "screen\0"
+    "season\0"
+    "sting\0"
+    "strike\0"
+    "team\0"
+    "unlike\0"
+    "victim\0"
+    "volume\0"
+    "warn\0"
+    "weird\0"
+    "attack\0"
+    "await\0"
+    "awake\0"
+    "built\0"
+    "charm\0"
+    "crave\0"
+    "despair\0"
+    "fought\0"
+    "grant\0"
+    "grief\0"
+    "horse\0"
+    "limit\0"
+    "message\0"
+    "ripple\0"
+    "sanity\0"
+    "scatter\0"
+    "serve\0"
+    "split\0"
+    "string\0"
+    "trick\0"
+    "annoy\0"
+    "blur\0"
+    "boat\0"
+    "brave\0"
+    "clearly\0"
+    "cling\0"
+    "connect\0"
+    "fist\0"
+    "forth\0"
+    "imagination\0"
+    "iron\0"
+    "jock\0"
+    "judge\0"
+    "lesson\0"
+    "milk\0"
+    "misery\0"
+    "nail\0"
+    "naked\0"
+    "ourselves\0"
+    "poet\0"
+    "possible\0"
+    "princess\0"
+    "sail\0"
+    "size\0"
+    "snake\0"
+    "society\0"
+    "stroke\0"
+    "torture\0"
+    "toss\0"
+    "trace\0"
+    "wise\0"
+    "bloom\0"
+    "bullet\0"
+    "cell\0"
+    "check\0"
+    "cost\0"
+    "darling\0"
+    "during\0"
+    "footstep\0"
+    "fragile\0"
+    "hallway\0"
+    "hardly\0"
+    "horizon\0"
+    "invisible\0"
+    "journey\0"
+    "midnight\0"
+    "mud\0"
+    "nod\0"
+    "pause\0"
+    "relax\0"
+    "shiver\0"
+    "sudden\0"
+    "value\0"
+    "youth\0"
+    "abuse\0"
+    "admire\0"
+    "blink\0"
+    "breast\0"
+    "bruise\0"
+    "constantly\0"
+    "couple\0"
+    "creep\0"
+    "curve\0"
+    "difference\0"
+    "dumb\0"
+    "emptiness\0"
+    "gotta\0"
+    "honor\0"
+    "plain\0"
+    "planet\0"
+    "recall\0"
+    "rub\0"
+    "ship\0"
+    "slam\0"
+    "soar\0"
+    "somebody\0"
+    "tightly\0"
+    "weather\0"
+    "adore\0"
+    "approach\0"
+    "bond\0"
+    "bread\0"
+    "burst\0"
+    "candle\0"
+    "coffee\0"
+    "cousin\0"
+    "crime\0"
+    "desert\0"
+    "flutter\0"
+    "frozen\0"
+    "grand\0"
+    "heel\0"
+    "hello\0"
+    "language\0"
+    "level\0"
+    "movement\0"
+    "pleasure\0"
+    "powerful\0"
+    "random\0"
+    "rhythm\0"
+    "settle\0"
+    "silly\0"
+    "slap\0"
+    "sort\0"
+    "spoken\0"
+    "steel\0"
+    "threaten\0"
+    "tumble\0"
+    "upset\0"
+    "aside\0"
+    "awkward\0"
+    "bee\0"
+    "blank\0"
+    "board\0"
+    "button\0"
+    "card\0"
+    "carefully\0"
+    "complain\0"
+    "crap\0"
+    "deeply\0"
+    "discover\0"
+    "drag\0"
+    "dread\0"
+    "effort\0"
+    "entire\0"
+    "fairy\0"
+    "giant\0"
+    "gotten\0"
+    "greet\0"
+    "illusion\0"
+    "jeans\0"
+    "leap\0"
+    "liquid\0"
+    "march\0"
+    "mend\0"
+    "nervous\0"
+    "nine\0"
+    "replace\0"
+    "rope\0"
+    "spine\0"
+    "stole\0"
+    "terror\0"
+    "accident\0"
+    "apple\0"
+    "balance\0"
+    "boom\0"
+    "childhood\0"
+    "collect\0"
+    "demand\0"
+    "depression\0"
+    "eventually\0"
+    "faint\0"
+    "glare\0"
+    "goal\0"
+    "group\0"
+    "honey\0"
+    "kitchen\0"
+    "laid\0"
+    "limb\0"
+    "machine\0"
+    "mere\0"
+    "mold\0"
+    "murder\0"
+    "nerve\0"
+    "painful\0"
+    "poetry\0"
+    "prince\0"
+    "rabbit\0"
+    "shelter\0"
+    "shore\0"
+    "shower\0"
+    "soothe\0"
+    "stair\0"
+    "steady\0"
+    "sunlight\0"
+    "tangle\0"
+    "tease\0"
+    "treasure\0"
+    "uncle\0"
+    "begun\0"
+    "bliss\0"
+    "canvas\0"
+    "cheer\0"
+    "claw\0"
+    "clutch\0"
+    "commit\0"
+    "crimson\0"
+    "crystal\0"
+    "delight\0"
+    "doll\0"
+    "existence\0"
+    "express\0"
+    "fog\0"
+    "football\0"
+    "gay\0"
+    "goose\0"
+    "guard\0"
+    "hatred\0"
+    "illuminate\0"
+    "mass\0"
+    "math\0"
+    "mourn\0"
+    "rich\0"
+    "rough\0"
+    "skip\0"
+    "stir\0"
+    "student\0"
+    "style\0"
+    "support\0"
+    "thorn\0"
+    "tough\0"
+    "yard\0"
+    "yearn\0"
+    "yesterday\0"
+    "advice\0"
+    "appreciate\0"
+    "autumn\0"
+    "bank\0"
+    "beam\0"
+    "bowl\0"
+    "capture\0"
+    "carve\0"
+    "collapse\0"
+    "confusion\0"
+    "creation\0"
+    "dove\0"
+    "feather\0"
+    "girlfriend\0"
+    "glory\0"
+    "government\0"
+    "harsh\0"
+    "hop\0"
+    "inner\0"
+    "loser\0"
+    "moonlight\0"
+    "neighbor\0"
+    "neither\0"
+    "peach\0"
+    "pig\0"
+    "praise\0"
+    "screw\0"
+    "shield\0"
+    "shimmer\0"
+    "sneak\0"
+    "stab\0"
+    "subject\0"
+    "throughout\0"
+    "thrown\0"
+    "tower\0"
+    "twirl\0"
+    "wow\0"
+    "army\0"
+    "arrive\0"
+    "bathroom\0"
+    "bump\0"
+    "cease\0"
+    "cookie\0"
+    "couch\0"
+    "courage\0"
+    "dim\0"
+    "guilt\0"
+    "howl\0"
+    "hum\0"
+    "husband\0"
+    "insult\0"
+    "led\0"
+    "lunch\0"
+    "mock\0"
+    "mostly\0"
+    "natural\0"
+    "nearly\0"
+    "needle\0"
+    "nerd\0"
+    "peaceful\0"
+    "perfection\0"
+    "pile\0"
+    "price\0"
+    "remove\0"
+    "roam\0"
+    "sanctuary\0"
+    "serious\0"
+    "shiny\0"
+    "shook\0"
+    "sob\0"
+    "stolen\0"
+    "tap\0"
+    "vain\0"
+    "void\0"
+    "warrior\0"
+    "wrinkle\0"
+    "affection\0"
+    "apologize\0"
+    "blossom\0"
+    "bounce\0"
+    "bridge\0"
+    "cheap\0"
+    "crumble\0"
+    "decision\0"
+    "descend\0"
+    "desperately\0"
+    "dig\0"
+    "dot\0"
+    "flip\0"
+    "frighten\0"
+    "heartbeat\0"
+    "huge\0"
+    "lazy\0"
+    "lick\0"
+    "odd\0"
+    "opinion\0"
+    "process\0"
+    "puzzle\0"
+    "quietly\0"
+    "retreat\0"
+    "score\0"
+    "sentence\0"
+    "separate\0"
+    "situation\0"
+    "skill\0"
+    "soak\0"
+    "square\0"
+    "stray\0"
+    "taint\0"
+    "task\0"
+    "tide\0"
+    "underneath\0"
+    "veil\0"
+    "whistle\0"
+    "anywhere\0"
+    "bedroom\0"
+    "bid\0"
+    "bloody\0"
+    "burden\0"
+    "careful\0"
+    "compare\0"
+    "concern\0"
+    "curtain\0"
+    "decay\0"
+    "defeat\0"
+    "describe\0"
+    "double\0"
+    "dreamer\0"
+    "driver\0"
+    "dwell\0"
+    "evening\0"
+    "flare\0"
+    "flicker\0"
+    "grandma\0"
+    "guitar\0"
+    "harm\0"
+    "horrible\0"
+    "hungry\0"
+    "indeed\0"
+    "lace\0"
+    "melody\0"
+    "monkey\0"
+    "nation\0"
+    "object\0"
+    "obviously\0"
+    "rainbow\0"
+    "salt\0"
+    "scratch\0"
+    "shown\0"
+    "shy\0"
+    "stage\0"
+    "stun\0"
+    "third\0"
+    "tickle\0"
+    "useless\0"
+    "weakness\0"
+    "worship\0"
+    "worthless\0"
+    "afternoon\0"
+    "beard\0"
+    "boyfriend\0"
+    "bubble\0"
+    "busy\0"
+    "certain\0"
+    "chin\0"
+    "concrete\0"
+    "desk\0"
+    "diamond\0"
+    "doom\0"
+    "drawn\0"
+    "due\0"
+    "felicity\0"
+    "freeze\0"
+    "frost\0"
+    "garden\0"
+    "glide\0"
+    "harmony\0"
+    "hopefully\0"
+    "hunt\0"
+    "jealous\0"
+    "lightning\0"
+    "mama\0"
+    "mercy\0"
+    "peel\0"
+    "physical\0"
+    "position\0"
+    "pulse\0"
+    "punch\0"
+    "quit\0"
+    "rant\0"
+    "respond\0"
+    "salty\0"
+    "sane\0"
+    "satisfy\0"
+    "savior\0"
+    "sheep\0"
+    "slept\0"
+    "social\0"
+    "sport\0"
+    "tuck\0"
+    "utter\0"
+    "valley\0"
+    "wolf\0"
+    "aim\0"
+    "alas\0"
+    "alter\0"
+    "arrow\0"
+    "awaken\0"
+    "beaten\0"
+    "belief\0"
+    "brand\0"
+    "ceiling\0"
+    "cheese\0"
+    "clue\0"
+    "confidence\0"
+    "connection\0"
+    "daily\0"
+    "disguise\0"
+    "eager\0"
+    "erase\0"
+    "essence\0"
+    "everytime\0"
+    "expression\0"
+    "fan\0"
+    "flag\0"
+    "flirt\0"
+    "foul\0"
+    "fur\0"
+    "giggle\0"
+    "glorious\0"
+    "ignorance\0"
+    "law\0"
+    "lifeless\0"
+    "measure\0"
+    "mighty\0"
+    "muse\0"
+    "north\0"
+    "opposite\0"
+    "paradise\0"
+    "patience\0"
+    "patient\0"
+    "pencil\0"
+    "petal\0"
+    "plate\0"
+    "ponder\0"
+    "possibly\0"
+    "practice\0"
+    "slice\0"
+    "spell\0"
+    "stock\0"
+    "strife\0"
+    "strip\0"
+    "suffocate\0"
+    "suit\0"
+    "tender\0"
+    "tool\0"
+    "trade\0"
+    "velvet\0"
+    "verse\0"
+    "waist\0"
+    "witch\0"
+    "aunt\0"
+    "bench\0"
+    "bold\0"
+    "cap\0"
+    "certainly\0"
+    "click\0"
+    "companion\0"
+    "creator\0"
+    "dart\0"
+    "delicate\0"
+    "determine\0"
+    "dish\0"
+    "dragon\0"
+    "drama\0"
+    "drum\0"
+    "dude\0"
+    "everybody\0"
+    "feast\0"
+    "forehead\0"
+    "former\0"
+    "fright\0"
+    "fully\0"
+    "gas\0"
+    "hook\0"
+    "hurl\0"
+    "invite\0"
+    "juice\0"
+    "manage\0"
+    "moral\0"
+    "possess\0"
+    "raw\0"
+    "rebel\0"
+    "royal\0"
+    "scale\0"
+    "scary\0"
+    "several\0"
+    "slight\0"
+    "stubborn\0"
+    "swell\0"
+    "talent\0"
+    "tea\0"
+    "terrible\0"
+    "thread\0"
+    "torment\0"
+    "trickle\0"
+    "usually\0"
+    "vast\0"
+    "violence\0"
+    "weave\0"
+    "acid\0"
+    "agony\0"
+    "ashamed\0"
+    "awe\0"
+    "belly\0"
+    "blend\0"
+    "blush\0"
+    "character\0"
+    "cheat\0"
+    "common\0"
+    "company\0"
+    "coward\0"
+    "creak\0"
+    "danger\0"
+    "deadly\0"
+    "defense\0"
+    "define\0"
+    "depend\0"
+    "desperate\0"
+    "destination\0"
+    "dew\0"
+    "duck\0"
+    "dusty\0"
+    "embarrass\0"
+    "engine\0"
+    "example\0"
+    "explore\0"
+    "foe\0"
+    "freely\0"
+    "frustrate\0"
+    "generation\0"
+    "glove\0"
+    "guilty\0"
+    "health\0"
+    "hurry\0"
+    "idiot\0"
+    "impossible\0"
+    "inhale\0"
+    "jaw\0"
+    "kingdom\0"
+    "mention\0"
+    "mist\0"
+    "moan\0"
+    "mumble\0"
+    "mutter\0"
+    "observe\0"
+    "ode\0"
+    "pathetic\0"
+    "pattern\0"
+    "pie\0"
+    "prefer\0"
+    "puff\0"
+    "rape\0"
+    "rare\0"
+    "revenge\0"
+    "rude\0"
+    "scrape\0"
+    "spiral\0"
+    "squeeze\0"
+    "strain\0"
+    "sunset\0"
+    "suspend\0"
+    "sympathy\0"
+    "thigh\0"
+    "throne\0"
+    "total\0"
+    "unseen\0"
+    "weapon\0"
+    "weary";
+
+static const uint16_t en_v1_offsets[dictionary_size_v1] =
 {
-    {
-        "like",
-        "just",
-        "love",
-        "know",
-        "never",
-        "want",
-        "time",
-        "out",
-        "there",
-        "make",
-        "look",
-        "eye",
-        "down",
-        "only",
-        "think",
-        "heart",
-        "back",
-        "then",
-        "into",
-        "about",
-        "more",
-        "away",
-        "still",
-        "them",
-        "take",
-        "thing",
-        "even",
-        "through",
-        "long",
-        "always",
-        "world",
-        "too",
-        "friend",
-        "tell",
-        "try",
-        "hand",
-        "thought",
-        "over",
-        "here",
-        "other",
-        "need",
-        "smile",
-        "again",
-        "much",
-        "cry",
-        "been",
-        "night",
-        "ever",
-        "little",
-        "said",
-        "end",
-        "some",
-        "those",
-        "around",
-        "mind",
-        "people",
-        "girl",
-        "leave",
-        "dream",
-        "left",
-        "turn",
-        "myself",
-        "give",
-        "nothing",
-        "really",
-        "off",
-        "before",
-        "something",
-        "find",
-        "walk",
-        "wish",
-        "good",
-        "once",
-        "place",
-        "ask",
-        "stop",
-        "keep",
-        "watch",
-        "seem",
-        "everything",
-        "wait",
-        "got",
-        "yet",
-        "made",
-        "remember",
-        "start",
-        "alone",
-        "run",
-        "hope",
-        "maybe",
-        "believe",
-        "body",
-        "hate",
-        "after",
-        "close",
-        "talk",
-        "stand",
-        "own",
-        "each",
-        "hurt",
-        "help",
-        "home",
-        "god",
-        "soul",
-        "new",
-        "many",
-        "two",
-        "inside",
-        "should",
-        "true",
-        "first",
-        "fear",
-        "mean",
-        "better",
-        "play",
-        "another",
-        "gone",
-        "change",
-        "use",
-        "wonder",
-        "someone",
-        "hair",
-        "cold",
-        "open",
-        "best",
-        "any",
-        "behind",
-        "happen",
-        "water",
-        "dark",
-        "laugh",
-        "stay",
-        "forever",
-        "name",
-        "work",
-        "show",
-        "sky",
-        "break",
-        "came",
-        "deep",
-        "door",
-        "put",
-        "black",
-        "together",
-        "upon",
-        "happy",
-        "such",
-        "great",
-        "white",
-        "matter",
-        "fill",
-        "past",
-        "please",
-        "burn",
-        "cause",
-        "enough",
-        "touch",
-        "moment",
-        "soon",
-        "voice",
-        "scream",
-        "anything",
-        "stare",
-        "sound",
-        "red",
-        "everyone",
-        "hide",
-        "kiss",
-        "truth",
-        "death",
-        "beautiful",
-        "mine",
-        "blood",
-        "broken",
-        "very",
-        "pass",
-        "next",
-        "forget",
-        "tree",
-        "wrong",
-        "air",
-        "mother",
-        "understand",
-        "lip",
-        "hit",
-        "wall",
-        "memory",
-        "sleep",
-        "free",
-        "high",
-        "realize",
-        "school",
-        "might",
-        "skin",
-        "sweet",
-        "perfect",
-        "blue",
-        "kill",
-        "breath",
-        "dance",
-        "against",
-        "fly",
-        "between",
-        "grow",
-        "strong",
-        "under",
-        "listen",
-        "bring",
-        "sometimes",
-        "speak",
-        "pull",
-        "person",
-        "become",
-        "family",
-        "begin",
-        "ground",
-        "real",
-        "small",
-        "father",
-        "sure",
-        "feet",
-        "rest",
-        "young",
-        "finally",
-        "land",
-        "across",
-        "today",
-        "different",
-        "guy",
-        "line",
-        "fire",
-        "reason",
-        "reach",
-        "second",
-        "slowly",
-        "write",
-        "eat",
-        "smell",
-        "mouth",
-        "step",
-        "learn",
-        "three",
-        "floor",
-        "promise",
-        "breathe",
-        "darkness",
-        "push",
-        "earth",
-        "guess",
-        "save",
-        "song",
-        "above",
-        "along",
-        "both",
-        "color",
-        "house",
-        "almost",
-        "sorry",
-        "anymore",
-        "brother",
-        "okay",
-        "dear",
-        "game",
-        "fade",
-        "already",
-        "apart",
-        "warm",
-        "beauty",
-        "heard",
-        "notice",
-        "question",
-        "shine",
-        "began",
-        "piece",
-        "whole",
-        "shadow",
-        "secret",
-        "street",
-        "within",
-        "finger",
-        "point",
-        "morning",
-        "whisper",
-        "child",
-        "moon",
-        "green",
-        "story",
-        "glass",
-        "kid",
-        "silence",
-        "since",
-        "soft",
-        "yourself",
-        "empty",
-        "shall",
-        "angel",
-        "answer",
-        "baby",
-        "bright",
-        "dad",
-        "path",
-        "worry",
-        "hour",
-        "drop",
-        "follow",
-        "power",
-        "war",
-        "half",
-        "flow",
-        "heaven",
-        "act",
-        "chance",
-        "fact",
-        "least",
-        "tired",
-        "children",
-        "near",
-        "quite",
-        "afraid",
-        "rise",
-        "sea",
-        "taste",
-        "window",
-        "cover",
-        "nice",
-        "trust",
-        "lot",
-        "sad",
-        "cool",
-        "force",
-        "peace",
-        "return",
-        "blind",
-        "easy",
-        "ready",
-        "roll",
-        "rose",
-        "drive",
-        "held",
-        "music",
-        "beneath",
-        "hang",
-        "mom",
-        "paint",
-        "emotion",
-        "quiet",
-        "clear",
-        "cloud",
-        "few",
-        "pretty",
-        "bird",
-        "outside",
-        "paper",
-        "picture",
-        "front",
-        "rock",
-        "simple",
-        "anyone",
-        "meant",
-        "reality",
-        "road",
-        "sense",
-        "waste",
-        "bit",
-        "leaf",
-        "thank",
-        "happiness",
-        "meet",
-        "men",
-        "smoke",
-        "truly",
-        "decide",
-        "self",
-        "age",
-        "book",
-        "form",
-        "alive",
-        "carry",
-        "escape",
-        "damn",
-        "instead",
-        "able",
-        "ice",
-        "minute",
-        "throw",
-        "catch",
-        "leg",
-        "ring",
-        "course",
-        "goodbye",
-        "lead",
-        "poem",
-        "sick",
-        "corner",
-        "desire",
-        "known",
-        "problem",
-        "remind",
-        "shoulder",
-        "suppose",
-        "toward",
-        "wave",
-        "drink",
-        "jump",
-        "woman",
-        "pretend",
-        "sister",
-        "week",
-        "human",
-        "joy",
-        "crack",
-        "grey",
-        "pray",
-        "surprise",
-        "dry",
-        "knee",
-        "less",
-        "search",
-        "bleed",
-        "caught",
-        "clean",
-        "embrace",
-        "future",
-        "king",
-        "son",
-        "sorrow",
-        "chest",
-        "hug",
-        "remain",
-        "sat",
-        "worth",
-        "blow",
-        "daddy",
-        "final",
-        "parent",
-        "tight",
-        "also",
-        "create",
-        "lonely",
-        "safe",
-        "cross",
-        "dress",
-        "evil",
-        "silent",
-        "bone",
-        "fate",
-        "perhaps",
-        "anger",
-        "class",
-        "scar",
-        "snow",
-        "tiny",
-        "tonight",
-        "continue",
-        "control",
-        "dog",
-        "edge",
-        "mirror",
-        "month",
-        "suddenly",
-        "comfort",
-        "given",
-        "loud",
-        "quickly",
-        "gaze",
-        "plan",
-        "rush",
-        "stone",
-        "town",
-        "battle",
-        "ignore",
-        "spirit",
-        "stood",
-        "stupid",
-        "yours",
-        "brown",
-        "build",
-        "dust",
-        "hey",
-        "kept",
-        "pay",
-        "phone",
-        "twist",
-        "although",
-        "ball",
-        "beyond",
-        "hidden",
-        "nose",
-        "taken",
-        "fail",
-        "float",
-        "pure",
-        "somehow",
-        "wash",
-        "wrap",
-        "angry",
-        "cheek",
-        "creature",
-        "forgotten",
-        "heat",
-        "rip",
-        "single",
-        "space",
-        "special",
-        "weak",
-        "whatever",
-        "yell",
-        "anyway",
-        "blame",
-        "job",
-        "choose",
-        "country",
-        "curse",
-        "drift",
-        "echo",
-        "figure",
-        "grew",
-        "laughter",
-        "neck",
-        "suffer",
-        "worse",
-        "yeah",
-        "disappear",
-        "foot",
-        "forward",
-        "knife",
-        "mess",
-        "somewhere",
-        "stomach",
-        "storm",
-        "beg",
-        "idea",
-        "lift",
-        "offer",
-        "breeze",
-        "field",
-        "five",
-        "often",
-        "simply",
-        "stuck",
-        "win",
-        "allow",
-        "confuse",
-        "enjoy",
-        "except",
-        "flower",
-        "seek",
-        "strength",
-        "calm",
-        "grin",
-        "gun",
-        "heavy",
-        "hill",
-        "large",
-        "ocean",
-        "shoe",
-        "sigh",
-        "straight",
-        "summer",
-        "tongue",
-        "accept",
-        "crazy",
-        "everyday",
-        "exist",
-        "grass",
-        "mistake",
-        "sent",
-        "shut",
-        "surround",
-        "table",
-        "ache",
-        "brain",
-        "destroy",
-        "heal",
-        "nature",
-        "shout",
-        "sign",
-        "stain",
-        "choice",
-        "doubt",
-        "glance",
-        "glow",
-        "mountain",
-        "queen",
-        "stranger",
-        "throat",
-        "tomorrow",
-        "city",
-        "either",
-        "fish",
-        "flame",
-        "rather",
-        "shape",
-        "spin",
-        "spread",
-        "ash",
-        "distance",
-        "finish",
-        "image",
-        "imagine",
-        "important",
-        "nobody",
-        "shatter",
-        "warmth",
-        "became",
-        "feed",
-        "flesh",
-        "funny",
-        "lust",
-        "shirt",
-        "trouble",
-        "yellow",
-        "attention",
-        "bare",
-        "bite",
-        "money",
-        "protect",
-        "amaze",
-        "appear",
-        "born",
-        "choke",
-        "completely",
-        "daughter",
-        "fresh",
-        "friendship",
-        "gentle",
-        "probably",
-        "six",
-        "deserve",
-        "expect",
-        "grab",
-        "middle",
-        "nightmare",
-        "river",
-        "thousand",
-        "weight",
-        "worst",
-        "wound",
-        "barely",
-        "bottle",
-        "cream",
-        "regret",
-        "relationship",
-        "stick",
-        "test",
-        "crush",
-        "endless",
-        "fault",
-        "itself",
-        "rule",
-        "spill",
-        "art",
-        "circle",
-        "join",
-        "kick",
-        "mask",
-        "master",
-        "passion",
-        "quick",
-        "raise",
-        "smooth",
-        "unless",
-        "wander",
-        "actually",
-        "broke",
-        "chair",
-        "deal",
-        "favorite",
-        "gift",
-        "note",
-        "number",
-        "sweat",
-        "box",
-        "chill",
-        "clothes",
-        "lady",
-        "mark",
-        "park",
-        "poor",
-        "sadness",
-        "tie",
-        "animal",
-        "belong",
-        "brush",
-        "consume",
-        "dawn",
-        "forest",
-        "innocent",
-        "pen",
-        "pride",
-        "stream",
-        "thick",
-        "clay",
-        "complete",
-        "count",
-        "draw",
-        "faith",
-        "press",
-        "silver",
-        "struggle",
-        "surface",
-        "taught",
-        "teach",
-        "wet",
-        "bless",
-        "chase",
-        "climb",
-        "enter",
-        "letter",
-        "melt",
-        "metal",
-        "movie",
-        "stretch",
-        "swing",
-        "vision",
-        "wife",
-        "beside",
-        "crash",
-        "forgot",
-        "guide",
-        "haunt",
-        "joke",
-        "knock",
-        "plant",
-        "pour",
-        "prove",
-        "reveal",
-        "steal",
-        "stuff",
-        "trip",
-        "wood",
-        "wrist",
-        "bother",
-        "bottom",
-        "crawl",
-        "crowd",
-        "fix",
-        "forgive",
-        "frown",
-        "grace",
-        "loose",
-        "lucky",
-        "party",
-        "release",
-        "surely",
-        "survive",
-        "teacher",
-        "gently",
-        "grip",
-        "speed",
-        "suicide",
-        "travel",
-        "treat",
-        "vein",
-        "written",
-        "cage",
-        "chain",
-        "conversation",
-        "date",
-        "enemy",
-        "however",
-        "interest",
-        "million",
-        "page",
-        "pink",
-        "proud",
-        "sway",
-        "themselves",
-        "winter",
-        "church",
-        "cruel",
-        "cup",
-        "demon",
-        "experience",
-        "freedom",
-        "pair",
-        "pop",
-        "purpose",
-        "respect",
-        "shoot",
-        "softly",
-        "state",
-        "strange",
-        "bar",
-        "birth",
-        "curl",
-        "dirt",
-        "excuse",
-        "lord",
-        "lovely",
-        "monster",
-        "order",
-        "pack",
-        "pants",
-        "pool",
-        "scene",
-        "seven",
-        "shame",
-        "slide",
-        "ugly",
-        "among",
-        "blade",
-        "blonde",
-        "closet",
-        "creek",
-        "deny",
-        "drug",
-        "eternity",
-        "gain",
-        "grade",
-        "handle",
-        "key",
-        "linger",
-        "pale",
-        "prepare",
-        "swallow",
-        "swim",
-        "tremble",
-        "wheel",
-        "won",
-        "cast",
-        "cigarette",
-        "claim",
-        "college",
-        "direction",
-        "dirty",
-        "gather",
-        "ghost",
-        "hundred",
-        "loss",
-        "lung",
-        "orange",
-        "present",
-        "swear",
-        "swirl",
-        "twice",
-        "wild",
-        "bitter",
-        "blanket",
-        "doctor",
-        "everywhere",
-        "flash",
-        "grown",
-        "knowledge",
-        "numb",
-        "pressure",
-        "radio",
-        "repeat",
-        "ruin",
-        "spend",
-        "unknown",
-        "buy",
-        "clock",
-        "devil",
-        "early",
-        "false",
-        "fantasy",
-        "pound",
-        "precious",
-        "refuse",
-        "sheet",
-        "teeth",
-        "welcome",
-        "add",
-        "ahead",
-        "block",
-        "bury",
-        "caress",
-        "content",
-        "depth",
-        "despite",
-        "distant",
-        "marry",
-        "purple",
-        "threw",
-        "whenever",
-        "bomb",
-        "dull",
-        "easily",
-        "grasp",
-        "hospital",
-        "innocence",
-        "normal",
-        "receive",
-        "reply",
-        "rhyme",
-        "shade",
-        "someday",
-        "sword",
-        "toe",
-        "visit",
-        "asleep",
-        "bought",
-        "center",
-        "consider",
-        "flat",
-        "hero",
-        "history",
-        "ink",
-        "insane",
-        "muscle",
-        "mystery",
-        "pocket",
-        "reflection",
-        "shove",
-        "silently",
-        "smart",
-        "soldier",
-        "spot",
-        "stress",
-        "train",
-        "type",
-        "view",
-        "whether",
-        "bus",
-        "energy",
-        "explain",
-        "holy",
-        "hunger",
-        "inch",
-        "magic",
-        "mix",
-        "noise",
-        "nowhere",
-        "prayer",
-        "presence",
-        "shock",
-        "snap",
-        "spider",
-        "study",
-        "thunder",
-        "trail",
-        "admit",
-        "agree",
-        "bag",
-        "bang",
-        "bound",
-        "butterfly",
-        "cute",
-        "exactly",
-        "explode",
-        "familiar",
-        "fold",
-        "further",
-        "pierce",
-        "reflect",
-        "scent",
-        "selfish",
-        "sharp",
-        "sink",
-        "spring",
-        "stumble",
-        "universe",
-        "weep",
-        "women",
-        "wonderful",
-        "action",
-        "ancient",
-        "attempt",
-        "avoid",
-        "birthday",
-        "branch",
-        "chocolate",
-        "core",
-        "depress",
-        "drunk",
-        "especially",
-        "focus",
-        "fruit",
-        "honest",
-        "match",
-        "palm",
-        "perfectly",
-        "pillow",
-        "pity",
-        "poison",
-        "roar",
-        "shift",
-        "slightly",
-        "thump",
-        "truck",
-        "tune",
-        "twenty",
-        "unable",
-        "wipe",
-        "wrote",
-        "coat",
-        "constant",
-        "dinner",
-        "drove",
-        "egg",
-        "eternal",
-        "flight",
-        "flood",
-        "frame",
-        "freak",
-        "gasp",
-        "glad",
-        "hollow",
-        "motion",
-        "peer",
-        "plastic",
-        "root",
-        "screen",
-        "season",
-        "sting",
-        "strike",
-        "team",
-        "unlike",
-        "victim",
-        "volume",
-        "warn",
-        "weird",
-        "attack",
-        "await",
-        "awake",
-        "built",
-        "charm",
-        "crave",
-        "despair",
-        "fought",
-        "grant",
-        "grief",
-        "horse",
-        "limit",
-        "message",
-        "ripple",
-        "sanity",
-        "scatter",
-        "serve",
-        "split",
-        "string",
-        "trick",
-        "annoy",
-        "blur",
-        "boat",
-        "brave",
-        "clearly",
-        "cling",
-        "connect",
-        "fist",
-        "forth",
-        "imagination",
-        "iron",
-        "jock",
-        "judge",
-        "lesson",
-        "milk",
-        "misery",
-        "nail",
-        "naked",
-        "ourselves",
-        "poet",
-        "possible",
-        "princess",
-        "sail",
-        "size",
-        "snake",
-        "society",
-        "stroke",
-        "torture",
-        "toss",
-        "trace",
-        "wise",
-        "bloom",
-        "bullet",
-        "cell",
-        "check",
-        "cost",
-        "darling",
-        "during",
-        "footstep",
-        "fragile",
-        "hallway",
-        "hardly",
-        "horizon",
-        "invisible",
-        "journey",
-        "midnight",
-        "mud",
-        "nod",
-        "pause",
-        "relax",
-        "shiver",
-        "sudden",
-        "value",
-        "youth",
-        "abuse",
-        "admire",
-        "blink",
-        "breast",
-        "bruise",
-        "constantly",
-        "couple",
-        "creep",
-        "curve",
-        "difference",
-        "dumb",
-        "emptiness",
-        "gotta",
-        "honor",
-        "plain",
-        "planet",
-        "recall",
-        "rub",
-        "ship",
-        "slam",
-        "soar",
-        "somebody",
-        "tightly",
-        "weather",
-        "adore",
-        "approach",
-        "bond",
-        "bread",
-        "burst",
-        "candle",
-        "coffee",
-        "cousin",
-        "crime",
-        "desert",
-        "flutter",
-        "frozen",
-        "grand",
-        "heel",
-        "hello",
-        "language",
-        "level",
-        "movement",
-        "pleasure",
-        "powerful",
-        "random",
-        "rhythm",
-        "settle",
-        "silly",
-        "slap",
-        "sort",
-        "spoken",
-        "steel",
-        "threaten",
-        "tumble",
-        "upset",
-        "aside",
-        "awkward",
-        "bee",
-        "blank",
-        "board",
-        "button",
-        "card",
-        "carefully",
-        "complain",
-        "crap",
-        "deeply",
-        "discover",
-        "drag",
-        "dread",
-        "effort",
-        "entire",
-        "fairy",
-        "giant",
-        "gotten",
-        "greet",
-        "illusion",
-        "jeans",
-        "leap",
-        "liquid",
-        "march",
-        "mend",
-        "nervous",
-        "nine",
-        "replace",
-        "rope",
-        "spine",
-        "stole",
-        "terror",
-        "accident",
-        "apple",
-        "balance",
-        "boom",
-        "childhood",
-        "collect",
-        "demand",
-        "depression",
-        "eventually",
-        "faint",
-        "glare",
-        "goal",
-        "group",
-        "honey",
-        "kitchen",
-        "laid",
-        "limb",
-        "machine",
-        "mere",
-        "mold",
-        "murder",
-        "nerve",
-        "painful",
-        "poetry",
-        "prince",
-        "rabbit",
-        "shelter",
-        "shore",
-        "shower",
-        "soothe",
-        "stair",
-        "steady",
-        "sunlight",
-        "tangle",
-        "tease",
-        "treasure",
-        "uncle",
-        "begun",
-        "bliss",
-        "canvas",
-        "cheer",
-        "claw",
-        "clutch",
-        "commit",
-        "crimson",
-        "crystal",
-        "delight",
-        "doll",
-        "existence",
-        "express",
-        "fog",
-        "football",
-        "gay",
-        "goose",
-        "guard",
-        "hatred",
-        "illuminate",
-        "mass",
-        "math",
-        "mourn",
-        "rich",
-        "rough",
-        "skip",
-        "stir",
-        "student",
-        "style",
-        "support",
-        "thorn",
-        "tough",
-        "yard",
-        "yearn",
-        "yesterday",
-        "advice",
-        "appreciate",
-        "autumn",
-        "bank",
-        "beam",
-        "bowl",
-        "capture",
-        "carve",
-        "collapse",
-        "confusion",
-        "creation",
-        "dove",
-        "feather",
-        "girlfriend",
-        "glory",
-        "government",
-        "harsh",
-        "hop",
-        "inner",
-        "loser",
-        "moonlight",
-        "neighbor",
-        "neither",
-        "peach",
-        "pig",
-        "praise",
-        "screw",
-        "shield",
-        "shimmer",
-        "sneak",
-        "stab",
-        "subject",
-        "throughout",
-        "thrown",
-        "tower",
-        "twirl",
-        "wow",
-        "army",
-        "arrive",
-        "bathroom",
-        "bump",
-        "cease",
-        "cookie",
-        "couch",
-        "courage",
-        "dim",
-        "guilt",
-        "howl",
-        "hum",
-        "husband",
-        "insult",
-        "led",
-        "lunch",
-        "mock",
-        "mostly",
-        "natural",
-        "nearly",
-        "needle",
-        "nerd",
-        "peaceful",
-        "perfection",
-        "pile",
-        "price",
-        "remove",
-        "roam",
-        "sanctuary",
-        "serious",
-        "shiny",
-        "shook",
-        "sob",
-        "stolen",
-        "tap",
-        "vain",
-        "void",
-        "warrior",
-        "wrinkle",
-        "affection",
-        "apologize",
-        "blossom",
-        "bounce",
-        "bridge",
-        "cheap",
-        "crumble",
-        "decision",
-        "descend",
-        "desperately",
-        "dig",
-        "dot",
-        "flip",
-        "frighten",
-        "heartbeat",
-        "huge",
-        "lazy",
-        "lick",
-        "odd",
-        "opinion",
-        "process",
-        "puzzle",
-        "quietly",
-        "retreat",
-        "score",
-        "sentence",
-        "separate",
-        "situation",
-        "skill",
-        "soak",
-        "square",
-        "stray",
-        "taint",
-        "task",
-        "tide",
-        "underneath",
-        "veil",
-        "whistle",
-        "anywhere",
-        "bedroom",
-        "bid",
-        "bloody",
-        "burden",
-        "careful",
-        "compare",
-        "concern",
-        "curtain",
-        "decay",
-        "defeat",
-        "describe",
-        "double",
-        "dreamer",
-        "driver",
-        "dwell",
-        "evening",
-        "flare",
-        "flicker",
-        "grandma",
-        "guitar",
-        "harm",
-        "horrible",
-        "hungry",
-        "indeed",
-        "lace",
-        "melody",
-        "monkey",
-        "nation",
-        "object",
-        "obviously",
-        "rainbow",
-        "salt",
-        "scratch",
-        "shown",
-        "shy",
-        "stage",
-        "stun",
-        "third",
-        "tickle",
-        "useless",
-        "weakness",
-        "worship",
-        "worthless",
-        "afternoon",
-        "beard",
-        "boyfriend",
-        "bubble",
-        "busy",
-        "certain",
-        "chin",
-        "concrete",
-        "desk",
-        "diamond",
-        "doom",
-        "drawn",
-        "due",
-        "felicity",
-        "freeze",
-        "frost",
-        "garden",
-        "glide",
-        "harmony",
-        "hopefully",
-        "hunt",
-        "jealous",
-        "lightning",
-        "mama",
-        "mercy",
-        "peel",
-        "physical",
-        "position",
-        "pulse",
-        "punch",
-        "quit",
-        "rant",
-        "respond",
-        "salty",
-        "sane",
-        "satisfy",
-        "savior",
-        "sheep",
-        "slept",
-        "social",
-        "sport",
-        "tuck",
-        "utter",
-        "valley",
-        "wolf",
-        "aim",
-        "alas",
-        "alter",
-        "arrow",
-        "awaken",
-        "beaten",
-        "belief",
-        "brand",
-        "ceiling",
-        "cheese",
-        "clue",
-        "confidence",
-        "connection",
-        "daily",
-        "disguise",
-        "eager",
-        "erase",
-        "essence",
-        "everytime",
-        "expression",
-        "fan",
-        "flag",
-        "flirt",
-        "foul",
-        "fur",
-        "giggle",
-        "glorious",
-        "ignorance",
-        "law",
-        "lifeless",
-        "measure",
-        "mighty",
-        "muse",
-        "north",
-        "opposite",
-        "paradise",
-        "patience",
-        "patient",
-        "pencil",
-        "petal",
-        "plate",
-        "ponder",
-        "possibly",
-        "practice",
-        "slice",
-        "spell",
-        "stock",
-        "strife",
-        "strip",
-        "suffocate",
-        "suit",
-        "tender",
-        "tool",
-        "trade",
-        "velvet",
-        "verse",
-        "waist",
-        "witch",
-        "aunt",
-        "bench",
-        "bold",
-        "cap",
-        "certainly",
-        "click",
-        "companion",
-        "creator",
-        "dart",
-        "delicate",
-        "determine",
-        "dish",
-        "dragon",
-        "drama",
-        "drum",
-        "dude",
-        "everybody",
-        "feast",
-        "forehead",
-        "former",
-        "fright",
-        "fully",
-        "gas",
-        "hook",
-        "hurl",
-        "invite",
-        "juice",
-        "manage",
-        "moral",
-        "possess",
-        "raw",
-        "rebel",
-        "royal",
-        "scale",
-        "scary",
-        "several",
-        "slight",
-        "stubborn",
-        "swell",
-        "talent",
-        "tea",
-        "terrible",
-        "thread",
-        "torment",
-        "trickle",
-        "usually",
-        "vast",
-        "violence",
-        "weave",
-        "acid",
-        "agony",
-        "ashamed",
-        "awe",
-        "belly",
-        "blend",
-        "blush",
-        "character",
-        "cheat",
-        "common",
-        "company",
-        "coward",
-        "creak",
-        "danger",
-        "deadly",
-        "defense",
-        "define",
-        "depend",
-        "desperate",
-        "destination",
-        "dew",
-        "duck",
-        "dusty",
-        "embarrass",
-        "engine",
-        "example",
-        "explore",
-        "foe",
-        "freely",
-        "frustrate",
-        "generation",
-        "glove",
-        "guilty",
-        "health",
-        "hurry",
-        "idiot",
-        "impossible",
-        "inhale",
-        "jaw",
-        "kingdom",
-        "mention",
-        "mist",
-        "moan",
-        "mumble",
-        "mutter",
-        "observe",
-        "ode",
-        "pathetic",
-        "pattern",
-        "pie",
-        "prefer",
-        "puff",
-        "rape",
-        "rare",
-        "revenge",
-        "rude",
-        "scrape",
-        "spiral",
-        "squeeze",
-        "strain",
-        "sunset",
-        "suspend",
-        "sympathy",
-        "thigh",
-        "throne",
-        "total",
-        "unseen",
-        "weapon",
-        "weary"
-    }
+    0, 5, 10, 15, 20, 26, 31, 36, 40, 46, 51, 56, 60, 65, 70, 76, 82, 87, 92,
+    97, 103, 108, 113, 119, 124, 129, 135, 140, 148, 153, 160, 166, 170, 177,
+    182, 186, 191, 199, 204, 209, 215, 220, 226, 232, 237, 241, 246, 252, 257,
+    264, 269, 273, 278, 284, 291, 296, 303, 308, 314, 320, 325, 330, 337, 342,
+    350, 357, 361, 368, 378, 383, 388, 393, 398, 403, 409, 413, 418, 423, 429,
+    434, 445, 450, 454, 458, 463, 472, 478, 484, 488, 493, 499, 507, 512, 517,
+    523, 529, 534, 540, 544, 549, 554, 559, 564, 568, 573, 577, 582, 586, 593,
+    600, 605, 611, 616, 621, 628, 633, 641, 646, 653, 657, 664, 672, 677, 682,
+    687, 692, 696, 703, 710, 716, 721, 727, 732, 740, 745, 750, 755, 759, 765,
+    770, 775, 780, 784, 790, 799, 804, 810, 815, 821, 827, 834, 839, 844, 851,
+    856, 862, 869, 875, 882, 887, 893, 900, 909, 915, 921, 925, 934, 939, 944,
+    950, 956, 966, 971, 977, 984, 989, 994, 999, 1006, 1011, 1017, 1021, 1028,
+    1039, 1043, 1047, 1052, 1059, 1065, 1070, 1075, 1083, 1090, 1096, 1101,
+    1107, 1115, 1120, 1125, 1132, 1138, 1146, 1150, 1158, 1163, 1170, 1176,
+    1183, 1189, 1199, 1205, 1210, 1217, 1224, 1231, 1237, 1244, 1249, 1255,
+    1262, 1267, 1272, 1277, 1283, 1291, 1296, 1303, 1309, 1319, 1323, 1328,
+    1333, 1340, 1346, 1353, 1360, 1366, 1370, 1376, 1382, 1387, 1393, 1399,
+    1405, 1413, 1421, 1430, 1435, 1441, 1447, 1452, 1457, 1463, 1469, 1474,
+    1480, 1486, 1493, 1499, 1507, 1515, 1520, 1525, 1530, 1535, 1543, 1549,
+    1554, 1561, 1567, 1574, 1583, 1589, 1595, 1601, 1607, 1614, 1621, 1628,
+    1635, 1642, 1648, 1656, 1664, 1670, 1675, 1681, 1687, 1693, 1697, 1705,
+    1711, 1716, 1725, 1731, 1737, 1743, 1750, 1755, 1762, 1766, 1771, 1777,
+    1782, 1787, 1794, 1800, 1804, 1809, 1814, 1821, 1825, 1832, 1837, 1843,
+    1849, 1858, 1863, 1869, 1876, 1881, 1885, 1891, 1898, 1904, 1909, 1915,
+    1919, 1923, 1928, 1934, 1940, 1947, 1953, 1958, 1964, 1969, 1974, 1980,
+    1985, 1991, 1999, 2004, 2008, 2014, 2022, 2028, 2034, 2040, 2044, 2051,
+    2056, 2064, 2070, 2078, 2084, 2089, 2096, 2103, 2109, 2117, 2122, 2128,
+    2134, 2138, 2143, 2149, 2159, 2164, 2168, 2174, 2180, 2187, 2192, 2196,
+    2201, 2206, 2212, 2218, 2225, 2230, 2238, 2243, 2247, 2254, 2260, 2266,
+    2270, 2275, 2282, 2290, 2295, 2300, 2305, 2312, 2319, 2325, 2333, 2340,
+    2349, 2357, 2364, 2369, 2375, 2380, 2386, 2394, 2401, 2406, 2412, 2416,
+    2422, 2427, 2432, 2441, 2445, 2450, 2455, 2462, 2468, 2475, 2481, 2489,
+    2496, 2501, 2505, 2512, 2518, 2522, 2529, 2533, 2539, 2544, 2550, 2556,
+    2563, 2569, 2574, 2581, 2588, 2593, 2599, 2605, 2610, 2617, 2622, 2627,
+    2635, 2641, 2647, 2652, 2657, 2662, 2670, 2679, 2687, 2691, 2696, 2703,
+    2709, 2718, 2726, 2732, 2737, 2745, 2750, 2755, 2760, 2766, 2771, 2778,
+    2785, 2792, 2798, 2805, 2811, 2817, 2823, 2828, 2832, 2837, 2841, 2847,
+    2853, 2862, 2867, 2874, 2881, 2886, 2892, 2897, 2903, 2908, 2916, 2921,
+    2926, 2932, 2938, 2947, 2957, 2962, 2966, 2973, 2979, 2987, 2992, 3001,
+    3006, 3013, 3019, 3023, 3030, 3038, 3044, 3050, 3055, 3062, 3067, 3076,
+    3081, 3088, 3094, 3099, 3109, 3114, 3122, 3128, 3133, 3143, 3151, 3157,
+    3161, 3166, 3171, 3177, 3184, 3190, 3195, 3201, 3208, 3214, 3218, 3224,
+    3232, 3238, 3245, 3252, 3257, 3266, 3271, 3276, 3280, 3286, 3291, 3297,
+    3303, 3308, 3313, 3322, 3329, 3336, 3343, 3349, 3358, 3364, 3370, 3378,
+    3383, 3388, 3397, 3403, 3408, 3414, 3422, 3427, 3434, 3440, 3445, 3451,
+    3458, 3464, 3471, 3476, 3485, 3491, 3500, 3507, 3516, 3521, 3528, 3533,
+    3539, 3546, 3552, 3557, 3564, 3568, 3577, 3584, 3590, 3598, 3608, 3615,
+    3623, 3630, 3637, 3642, 3648, 3654, 3659, 3665, 3673, 3680, 3690, 3695,
+    3700, 3706, 3714, 3720, 3727, 3732, 3738, 3749, 3758, 3764, 3775, 3782,
+    3791, 3795, 3803, 3810, 3815, 3822, 3832, 3838, 3847, 3854, 3860, 3866,
+    3873, 3880, 3886, 3893, 3906, 3912, 3917, 3923, 3931, 3937, 3944, 3949,
+    3955, 3959, 3966, 3971, 3976, 3981, 3988, 3996, 4002, 4008, 4015, 4022,
+    4029, 4038, 4044, 4050, 4055, 4064, 4069, 4074, 4081, 4087, 4091, 4097,
+    4105, 4110, 4115, 4120, 4125, 4133, 4137, 4144, 4151, 4157, 4165, 4170,
+    4177, 4186, 4190, 4196, 4203, 4209, 4214, 4223, 4229, 4234, 4240, 4246,
+    4253, 4262, 4270, 4277, 4283, 4287, 4293, 4299, 4305, 4311, 4318, 4323,
+    4329, 4335, 4343, 4349, 4356, 4361, 4368, 4374, 4381, 4387, 4393, 4398,
+    4404, 4410, 4415, 4421, 4428, 4434, 4440, 4445, 4450, 4456, 4463, 4470,
+    4476, 4482, 4486, 4494, 4500, 4506, 4512, 4518, 4524, 4532, 4539, 4547,
+    4555, 4562, 4567, 4573, 4581, 4588, 4594, 4599, 4607, 4612, 4618, 4631,
+    4636, 4642, 4650, 4659, 4667, 4672, 4677, 4683, 4688, 4699, 4706, 4713,
+    4719, 4723, 4729, 4740, 4748, 4753, 4757, 4765, 4773, 4779, 4786, 4792,
+    4800, 4804, 4810, 4815, 4820, 4827, 4832, 4839, 4847, 4853, 4858, 4864,
+    4869, 4875, 4881, 4887, 4893, 4898, 4904, 4910, 4917, 4924, 4930, 4935,
+    4940, 4949, 4954, 4960, 4967, 4971, 4978, 4983, 4991, 4999, 5004, 5012,
+    5018, 5022, 5027, 5037, 5043, 5051, 5061, 5067, 5074, 5080, 5088, 5093,
+    5098, 5105, 5113, 5119, 5125, 5131, 5136, 5143, 5151, 5158, 5169, 5175,
+    5181, 5191, 5196, 5205, 5211, 5218, 5223, 5229, 5237, 5241, 5247, 5253,
+    5259, 5265, 5273, 5279, 5288, 5295, 5301, 5307, 5315, 5319, 5325, 5331,
+    5336, 5343, 5351, 5357, 5365, 5373, 5379, 5386, 5392, 5401, 5406, 5411,
+    5418, 5424, 5433, 5443, 5450, 5458, 5464, 5470, 5476, 5484, 5490, 5494,
+    5500, 5507, 5514, 5521, 5530, 5535, 5540, 5548, 5552, 5559, 5566, 5574,
+    5581, 5592, 5598, 5607, 5613, 5621, 5626, 5633, 5639, 5644, 5649, 5657,
+    5661, 5668, 5676, 5681, 5688, 5693, 5699, 5703, 5709, 5717, 5724, 5733,
+    5739, 5744, 5751, 5757, 5765, 5771, 5777, 5783, 5787, 5792, 5798, 5808,
+    5813, 5821, 5829, 5838, 5843, 5851, 5858, 5866, 5872, 5880, 5886, 5891,
+    5898, 5906, 5915, 5920, 5926, 5936, 5943, 5951, 5959, 5965, 5974, 5981,
+    5991, 5996, 6004, 6010, 6021, 6027, 6033, 6040, 6046, 6051, 6061, 6068,
+    6073, 6080, 6085, 6091, 6100, 6106, 6112, 6117, 6124, 6131, 6136, 6142,
+    6147, 6156, 6163, 6169, 6173, 6181, 6188, 6194, 6200, 6206, 6211, 6216,
+    6223, 6230, 6235, 6243, 6248, 6255, 6262, 6268, 6275, 6280, 6287, 6294,
+    6301, 6306, 6312, 6319, 6325, 6331, 6337, 6343, 6349, 6357, 6364, 6370,
+    6376, 6382, 6388, 6396, 6403, 6410, 6418, 6424, 6430, 6437, 6443, 6449,
+    6454, 6459, 6465, 6473, 6479, 6487, 6492, 6498, 6510, 6515, 6520, 6526,
+    6533, 6538, 6545, 6550, 6556, 6566, 6571, 6580, 6589, 6594, 6599, 6605,
+    6613, 6620, 6628, 6633, 6639, 6644, 6650, 6657, 6662, 6668, 6673, 6681,
+    6688, 6697, 6705, 6713, 6720, 6728, 6738, 6746, 6755, 6759, 6763, 6769,
+    6775, 6782, 6789, 6795, 6801, 6807, 6814, 6820, 6827, 6834, 6845, 6852,
+    6858, 6864, 6875, 6880, 6890, 6896, 6902, 6908, 6915, 6922, 6926, 6931,
+    6936, 6941, 6950, 6958, 6966, 6972, 6981, 6986, 6992, 6998, 7005, 7012,
+    7019, 7025, 7032, 7040, 7047, 7053, 7058, 7064, 7073, 7079, 7088, 7097,
+    7106, 7113, 7120, 7127, 7133, 7138, 7143, 7150, 7156, 7165, 7172, 7178,
+    7184, 7192, 7196, 7202, 7208, 7215, 7220, 7230, 7239, 7244, 7251, 7260,
+    7265, 7271, 7278, 7285, 7291, 7297, 7304, 7310, 7319, 7325, 7330, 7337,
+    7343, 7348, 7356, 7361, 7369, 7374, 7380, 7386, 7393, 7402, 7408, 7416,
+    7421, 7431, 7439, 7446, 7457, 7468, 7474, 7480, 7485, 7491, 7497, 7505,
+    7510, 7515, 7523, 7528, 7533, 7540, 7546, 7554, 7561, 7568, 7575, 7583,
+    7589, 7596, 7603, 7609, 7616, 7625, 7632, 7638, 7647, 7653, 7659, 7665,
+    7672, 7678, 7683, 7690, 7697, 7705, 7713, 7721, 7726, 7736, 7744, 7748,
+    7757, 7761, 7767, 7773, 7780, 7791, 7796, 7801, 7807, 7812, 7818, 7823,
+    7828, 7836, 7842, 7850, 7856, 7862, 7867, 7873, 7883, 7890, 7901, 7908,
+    7913, 7918, 7923, 7931, 7937, 7946, 7956, 7965, 7970, 7978, 7989, 7995,
+    8006, 8012, 8016, 8022, 8028, 8038, 8047, 8055, 8061, 8065, 8072, 8078,
+    8085, 8093, 8099, 8104, 8112, 8123, 8130, 8136, 8142, 8146, 8151, 8158,
+    8167, 8172, 8178, 8185, 8191, 8199, 8203, 8209, 8214, 8218, 8226, 8233,
+    8237, 8243, 8248, 8255, 8263, 8270, 8277, 8282, 8291, 8302, 8307, 8313,
+    8320, 8325, 8335, 8343, 8349, 8355, 8359, 8366, 8370, 8375, 8380, 8388,
+    8396, 8406, 8416, 8424, 8431, 8438, 8444, 8452, 8461, 8469, 8481, 8485,
+    8489, 8494, 8503, 8513, 8518, 8523, 8528, 8532, 8540, 8548, 8555, 8563,
+    8571, 8577, 8586, 8595, 8605, 8611, 8616, 8623, 8629, 8635, 8640, 8645,
+    8656, 8661, 8669, 8678, 8686, 8690, 8697, 8704, 8712, 8720, 8728, 8736,
+    8742, 8749, 8758, 8765, 8773, 8780, 8786, 8794, 8800, 8808, 8816, 8823,
+    8828, 8837, 8844, 8851, 8856, 8863, 8870, 8877, 8884, 8894, 8902, 8907,
+    8915, 8921, 8925, 8931, 8936, 8942, 8949, 8957, 8966, 8974, 8984, 8994,
+    9000, 9010, 9017, 9022, 9030, 9035, 9044, 9049, 9057, 9062, 9068, 9072,
+    9081, 9088, 9094, 9101, 9107, 9115, 9125, 9130, 9138, 9148, 9153, 9159,
+    9164, 9173, 9182, 9188, 9194, 9199, 9204, 9212, 9218, 9223, 9231, 9238,
+    9244, 9250, 9257, 9263, 9268, 9274, 9281, 9286, 9290, 9295, 9301, 9307,
+    9314, 9321, 9328, 9334, 9342, 9349, 9354, 9365, 9376, 9382, 9391, 9397,
+    9403, 9411, 9421, 9432, 9436, 9441, 9447, 9452, 9456, 9463, 9472, 9482,
+    9486, 9495, 9503, 9510, 9515, 9521, 9530, 9539, 9548, 9556, 9563, 9569,
+    9575, 9582, 9591, 9600, 9606, 9612, 9618, 9625, 9631, 9641, 9646, 9653,
+    9658, 9664, 9671, 9677, 9683, 9689, 9694, 9700, 9705, 9709, 9719, 9725,
+    9735, 9743, 9748, 9757, 9767, 9772, 9779, 9785, 9790, 9795, 9805, 9811,
+    9820, 9827, 9834, 9840, 9844, 9849, 9854, 9861, 9867, 9874, 9880, 9888,
+    9892, 9898, 9904, 9910, 9916, 9924, 9931, 9940, 9946, 9953, 9957, 9966,
+    9973, 9981, 9989, 9997, 10002, 10011, 10017, 10022, 10028, 10036, 10040,
+    10046, 10052, 10058, 10068, 10074, 10081, 10089, 10096, 10102, 10109,
+    10116, 10124, 10131, 10138, 10148, 10160, 10164, 10169, 10175, 10185,
+    10192, 10200, 10208, 10212, 10219, 10229, 10240, 10246, 10253, 10260,
+    10266, 10272, 10283, 10290, 10294, 10302, 10310, 10315, 10320, 10327,
+    10334, 10342, 10346, 10355, 10363, 10367, 10374, 10379, 10384, 10389,
+    10397, 10402, 10409, 10416, 10424, 10431, 10438, 10446, 10455, 10461,
+    10468, 10474, 10481, 10488
 };
 
+const dictionary_v1 en_v1{ en_v1_words, en_v1_offsets };
+
 } // namespace electrum
 } // namespace language
 } // namespace wallet
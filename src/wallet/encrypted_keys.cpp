@@ -22,6 +22,7 @@
 #include <cstddef>
 #include <algorithm>
 #include <stdexcept>
+#include <vector>
 #include <boost/locale.hpp>
 #include <bitcoin/bitcoin/define.hpp>
 #include <bitcoin/bitcoin/math/checksum.hpp>
@@ -32,6 +33,7 @@
 #include <bitcoin/bitcoin/utility/assert.hpp>
 #include <bitcoin/bitcoin/utility/data.hpp>
 #include <bitcoin/bitcoin/utility/endian.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
 #include <bitcoin/bitcoin/wallet/ec_private.hpp>
 #include <bitcoin/bitcoin/wallet/ec_public.hpp>
 #include "parse_encrypted_keys/parse_encrypted_key.hpp"
@@ -134,10 +136,14 @@ static one_byte point_sign(const one_byte& single, const hash_digest& hash)
 
 #ifdef WITH_ICU
 
+// Arbitrary scrypt parameters from BIP38, shared by token and private.
+static constexpr uint64_t scrypt_N = 16384u;
+static constexpr uint32_t scrypt_p = 8u;
+static constexpr uint32_t scrypt_r = 8u;
+
 static hash_digest scrypt_token(data_slice data, data_slice salt)
 {
-    // Arbitrary scrypt parameters from BIP38.
-    return scrypt<hash_size>(data, salt, 16384u, 8u, 8u);
+    return scrypt<hash_size>(data, salt, scrypt_N, scrypt_p, scrypt_r);
 }
 
 #endif
@@ -152,8 +158,7 @@ static long_hash scrypt_pair(data_slice data, data_slice salt)
 
 static long_hash scrypt_private(data_slice data, data_slice salt)
 {
-    // Arbitrary scrypt parameters from BIP38.
-    return scrypt<long_hash_size>(data, salt, 16384u, 8u, 8u);
+    return scrypt<long_hash_size>(data, salt, scrypt_N, scrypt_p, scrypt_r);
 }
 
 #endif
@@ -392,10 +397,11 @@ bool encrypt(encrypted_private& out_private, const ec_secret& secret,
 // decrypt private_key
 // ----------------------------------------------------------------------------
 
+// The token is the scrypt_token of the passphrase and owner salt.
 static bool decrypt_multiplied(ec_secret& out_secret,
-    const parse_encrypted_private& parse, const std::string& passphrase)
+    const parse_encrypted_private& parse, const hash_digest& token)
 {
-    auto secret = scrypt_token(normal(passphrase), parse.owner_salt());
+    auto secret = token;
 
     if (parse.lot_sequence())
         secret = bitcoin_hash(splice(secret, parse.entropy()));
@@ -430,13 +436,13 @@ static bool decrypt_multiplied(ec_secret& out_secret,
     return true;
 }
 
+// The key is the scrypt_private of the passphrase and salt.
 static bool decrypt_secret(ec_secret& out_secret,
-    const parse_encrypted_private& parse, const std::string& passphrase)
+    const parse_encrypted_private& parse, const long_hash& key)
 {
     auto encrypt1 = splice(parse.entropy(), parse.data1());
     auto encrypt2 = parse.data2();
-    const auto derived = split(scrypt_private(normal(passphrase),
-        parse.salt()));
+    const auto derived = split(key);
 
     aes256_decrypt(derived.right, encrypt1);
     aes256_decrypt(derived.right, encrypt2);
@@ -461,8 +467,10 @@ bool decrypt(ec_secret& out_secret, uint8_t& out_version, bool& out_compressed,
         return false;
 
     const auto success = parse.multiplied() ?
-        decrypt_multiplied(out_secret, parse, passphrase) :
-        decrypt_secret(out_secret, parse, passphrase);
+        decrypt_multiplied(out_secret, parse,
+            scrypt_token(normal(passphrase), parse.owner_salt())) :
+        decrypt_secret(out_secret, parse,
+            scrypt_private(normal(passphrase), parse.salt()));
 
     if (success)
     {
@@ -473,6 +481,81 @@ bool decrypt(ec_secret& out_secret, uint8_t& out_version, bool& out_compressed,
     return success;
 }
 
+// The token and private scrypt parameters are the same, and a token is the
+// first half of the corresponding long derivation (pbkdf2 output blocks are
+// independent of length), so both kinds of key share one scrypt batch.
+bool decrypt(ek_decryption_list& out_secrets,
+    const encrypted_private_list& keys, const std::string& passphrase,
+    threadpool& pool, size_t memory_budget)
+{
+    std::vector<parse_encrypted_private> parses;
+    std::vector<data_chunk> salts;
+    parses.reserve(keys.size());
+    salts.reserve(keys.size());
+
+    for (const auto& key: keys)
+    {
+        parses.emplace_back(key);
+        const auto& parse = parses.back();
+
+        if (!parse.valid())
+            salts.emplace_back();
+        else if (parse.multiplied())
+            salts.push_back(parse.owner_salt());
+        else
+            salts.push_back(to_chunk(parse.salt()));
+    }
+
+    // Only valid keys are derived.
+    const auto password = normal(passphrase);
+    std::vector<data_slice> data_slices;
+    std::vector<data_slice> salt_slices;
+
+    for (size_t index = 0; index < keys.size(); ++index)
+    {
+        if (parses[index].valid())
+        {
+            data_slices.push_back(password);
+            salt_slices.push_back(salts[index]);
+        }
+    }
+
+    std::vector<data_chunk> derived(data_slices.size());
+    scrypt_batch(data_slices.data(), salt_slices.data(), derived.size(),
+        scrypt_N, scrypt_p, scrypt_r, long_hash_size, derived.data(), pool,
+        memory_budget);
+
+    auto success = true;
+    auto next = derived.begin();
+    out_secrets.resize(keys.size());
+
+    for (size_t index = 0; index < keys.size(); ++index)
+    {
+        const auto& parse = parses[index];
+        auto& out = out_secrets[index];
+        out.valid = false;
+
+        if (parse.valid())
+        {
+            const auto key = to_array<long_hash_size>(*next++);
+            out.valid = parse.multiplied() ?
+                decrypt_multiplied(out.secret, parse,
+                    slice<0, hash_size>(key)) :
+                decrypt_secret(out.secret, parse, key);
+        }
+
+        if (out.valid)
+        {
+            out.version = parse.address_version();
+            out.compressed = parse.compressed();
+        }
+
+        success &= out.valid;
+    }
+
+    return success;
+}
+
 // decrypt public_key
 // ----------------------------------------------------------------------------
 
@@ -0,0 +1,238 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/wallet/hd_cache.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <bitcoin/bitcoin/math/hash.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/endian.hpp>
+#include <bitcoin/bitcoin/wallet/hd_private.hpp>
+#include <bitcoin/bitcoin/wallet/hd_public.hpp>
+#include "../math/external/zeroize.h"
+
+namespace libbitcoin {
+namespace wallet {
+
+// The key of a node is the root digest followed by the big endian indexes
+// of its path, so the key of each prefix is a prefix of the key.
+static size_t key_size(size_t depth)
+{
+    return hash_size + depth * sizeof(uint32_t);
+}
+
+struct hd_cache::state
+{
+    template <typename Node>
+    struct nodes
+    {
+        typedef std::pair<std::string, Node> entry;
+        typedef std::list<entry> list;
+
+        // Most recently used first.
+        list order;
+        std::unordered_map<std::string, typename list::iterator> index;
+    };
+
+    state(size_t capacity)
+      : capacity(capacity)
+    {
+    }
+
+    static void erase(hd_private& node)
+    {
+        hd_cache::zeroize(node);
+    }
+
+    static void erase(hd_public&)
+    {
+    }
+
+    static hd_private derive(const hd_private& node, uint32_t index)
+    {
+        return node.derive_private(index);
+    }
+
+    static hd_public derive(const hd_public& node, uint32_t index)
+    {
+        return node.derive_public(index);
+    }
+
+    static std::string to_key(const hd_public& root, const path& indexes)
+    {
+        const auto& lineage = root.lineage();
+        sha256_context context;
+        context.write(root.chain_code());
+        context.write(root.point());
+        context.write(to_little_endian(lineage.prefixes));
+        context.write(to_array(lineage.depth));
+        context.write(to_little_endian(lineage.parent_fingerprint));
+        context.write(to_little_endian(lineage.child_number));
+        const auto digest = context.digest();
+
+        std::string key(key_size(indexes.size()), 0);
+        auto it = std::copy(digest.begin(), digest.end(), key.begin());
+
+        for (const auto index: indexes)
+        {
+            const auto bytes = to_big_endian(index);
+            it = std::copy(bytes.begin(), bytes.end(), it);
+        }
+
+        return key;
+    }
+
+    // Call only while holding the mutex.
+    template <typename Node>
+    bool find(Node& out, nodes<Node>& cache, const std::string& key)
+    {
+        const auto it = cache.index.find(key);
+        if (it == cache.index.end())
+            return false;
+
+        cache.order.splice(cache.order.begin(), cache.order, it->second);
+        out = it->second->second;
+        return true;
+    }
+
+    // Call only while holding the mutex.
+    template <typename Node>
+    void insert(nodes<Node>& cache, const std::string& key, const Node& node)
+    {
+        if (capacity == 0 || cache.index.find(key) != cache.index.end())
+            return;
+
+        cache.order.emplace_front(key, node);
+        cache.index.emplace(key, cache.order.begin());
+
+        if (cache.order.size() <= capacity)
+            return;
+
+        auto& last = cache.order.back();
+        erase(last.second);
+        cache.index.erase(last.first);
+        cache.order.pop_back();
+    }
+
+    // Call only while holding the mutex.
+    template <typename Node>
+    void clear(nodes<Node>& cache)
+    {
+        for (auto& entry: cache.order)
+            erase(entry.second);
+
+        cache.index.clear();
+        cache.order.clear();
+    }
+
+    template <typename Node>
+    Node derive(nodes<Node>& cache, const Node& root, const path& indexes)
+    {
+        if (!root || indexes.empty())
+            return root;
+
+        const auto key = to_key(root, indexes);
+        auto depth = indexes.size() - 1;
+        auto node = root;
+
+        // Resume from the longest cached proper prefix of the path.
+        mutex.lock();
+        for (; depth > 0; --depth)
+            if (find(node, cache, key.substr(0, key_size(depth))))
+                break;
+        mutex.unlock();
+
+        // Derive the remaining levels outside of the lock.
+        for (; depth < indexes.size(); ++depth)
+        {
+            node = derive(node, indexes[depth]);
+            if (!node)
+                return {};
+
+            // The final node is not cached.
+            if (depth + 1 < indexes.size())
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                insert(cache, key.substr(0, key_size(depth + 1)), node);
+            }
+        }
+
+        return node;
+    }
+
+    const size_t capacity;
+
+    // These are protected by mutex.
+    nodes<hd_private> privates;
+    nodes<hd_public> publics;
+    mutable std::mutex mutex;
+};
+
+hd_cache::hd_cache(size_t capacity)
+  : state_(new state(capacity))
+{
+}
+
+hd_cache::~hd_cache()
+{
+    clear();
+}
+
+hd_private hd_cache::derive_private(const hd_private& root,
+    const path& indexes)
+{
+    return state_->derive(state_->privates, root, indexes);
+}
+
+hd_public hd_cache::derive_public(const hd_public& root, const path& indexes)
+{
+    return state_->derive(state_->publics, root, indexes);
+}
+
+void hd_cache::clear()
+{
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    state_->clear(state_->privates);
+    state_->clear(state_->publics);
+}
+
+size_t hd_cache::size() const
+{
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    return state_->privates.order.size() + state_->publics.order.size();
+}
+
+size_t hd_cache::capacity() const
+{
+    return state_->capacity;
+}
+
+void hd_cache::zeroize(hd_private& node)
+{
+    ::zeroize(node.secret_.data(), node.secret_.size());
+}
+
+} // namespace wallet
+} // namespace libbitcoin
@@ -35,6 +35,7 @@
 #include <bitcoin/bitcoin/utility/data.hpp>
 #include <bitcoin/bitcoin/utility/endian.hpp>
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
+#include <bitcoin/bitcoin/utility/secure_allocator.hpp>
 #include <bitcoin/bitcoin/utility/serializer.hpp>
 #include <bitcoin/bitcoin/wallet/ec_private.hpp>
 #include <bitcoin/bitcoin/wallet/ec_public.hpp>
@@ -106,6 +107,11 @@ hd_private::hd_private(const ec_secret& secret,
 {
 }
 
+hd_private::~hd_private()
+{
+    zeroize(secret_.data(), secret_.size());
+}
+
 // Factories.
 // ----------------------------------------------------------------------------
 
@@ -199,6 +205,11 @@ std::string hd_private::encoded() const
     return encode_base58(to_hd_key());
 }
 
+void hd_private::encoded(std::string& out) const
+{
+    encode_base58(out, to_hd_key());
+}
+
 /// Accessors.
 // ----------------------------------------------------------------------------
 
@@ -18,9 +18,17 @@
  */
 #include <bitcoin/bitcoin/wallet/hd_public.hpp>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
 #include <cstdint>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 #include <boost/program_options.hpp>
 #include <bitcoin/bitcoin/constants.hpp>
 #include <bitcoin/bitcoin/define.hpp>
@@ -33,6 +41,7 @@
 #include <bitcoin/bitcoin/utility/data.hpp>
 #include <bitcoin/bitcoin/utility/endian.hpp>
 #include <bitcoin/bitcoin/utility/istream_reader.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
 #include <bitcoin/bitcoin/wallet/ec_public.hpp>
 #include <bitcoin/bitcoin/wallet/hd_private.hpp>
 
@@ -53,7 +62,7 @@ hd_public::hd_public()
 
 hd_public::hd_public(const hd_public& other)
   : valid_(other.valid_), chain_(other.chain_), lineage_(other.lineage_),
-    point_(other.point_)
+    point_(other.point_), encoded_(other.encoded_)
 {
 }
 
@@ -170,7 +179,12 @@ hd_public::operator const ec_compressed&() const
 
 std::string hd_public::encoded() const
 {
-    return encode_base58(to_hd_key());
+    return cached_encoding();
+}
+
+void hd_public::encoded(std::string& out) const
+{
+    out.assign(cached_encoding());
 }
 
 // Accessors.
@@ -240,6 +254,147 @@ hd_public hd_public::derive_public(uint32_t index) const
     return hd_public(child, intermediate.right, lineage);
 }
 
+// The number of children derived per claim.
+static BC_CONSTEXPR size_t derive_block_size = 64;
+
+// Claims and derives blocks of the range in order until exhausted.
+struct hd_public::deriver
+{
+    deriver(const hd_public& parent, uint32_t first, size_t count,
+        hd_public* out)
+      : hmac(parent.chain_),
+        point(parent.point_),
+        lineage(
+        {
+            parent.lineage_.prefixes,
+            static_cast<uint8_t>(parent.lineage_.depth + 1),
+            parent.fingerprint(),
+            0
+        }),
+        first(first),
+        count(count),
+        out(out),
+        next(0),
+        running(0)
+    {
+    }
+
+    void derive(size_t start, size_t size)
+    {
+        std::array<ec_secret, derive_block_size> tweaks;
+        std::array<hd_chain_code, derive_block_size> chains;
+        std::array<ec_compressed, derive_block_size> points;
+
+        for (size_t offset = 0; offset < size; ++offset)
+        {
+            const auto index = static_cast<uint32_t>(first + start + offset);
+            const auto intermediate = split(hmac.digest(
+                splice(point, to_big_endian(index))));
+            tweaks[offset] = intermediate.left;
+            chains[offset] = intermediate.right;
+        }
+
+        // The returned child key Ki is point(parse256(IL)) + Kpar.
+        ec_add(points.data(), point, tweaks.data(), size);
+
+        for (size_t offset = 0; offset < size; ++offset)
+        {
+            auto& child = out[start + offset];
+
+            if (points[offset] == null_compressed_point)
+            {
+                child = {};
+                continue;
+            }
+
+            auto child_lineage = lineage;
+            child_lineage.child_number =
+                static_cast<uint32_t>(first + start + offset);
+            child = hd_public(points[offset], chains[offset], child_lineage);
+        }
+    }
+
+    void run()
+    {
+        mutex.lock();
+        ++running;
+        mutex.unlock();
+
+        size_t start;
+        while ((start = next.fetch_add(derive_block_size)) < count)
+            derive(start, std::min(derive_block_size, count - start));
+
+        mutex.lock();
+        const auto idle = (--running == 0);
+        mutex.unlock();
+
+        if (idle)
+            finished.notify_all();
+    }
+
+    // Wait for all claimed blocks to complete, call only after run().
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        finished.wait(lock, [this]() { return running == 0; });
+    }
+
+    const hmac_sha512_context hmac;
+    const ec_compressed point;
+    const hd_lineage lineage;
+    const uint32_t first;
+    const size_t count;
+    hd_public* const out;
+    std::atomic<size_t> next;
+
+    // This is protected by mutex.
+    size_t running;
+    std::mutex mutex;
+    std::condition_variable finished;
+};
+
+bool hd_public::derive_public_range(uint32_t first, size_t count,
+    std::vector<hd_public>& out) const
+{
+    if (!valid_ || lineage_.depth == max_uint8 ||
+        first >= hd_first_hardened_key ||
+        count > hd_first_hardened_key - first)
+        return false;
+
+    out.resize(count);
+    deriver(*this, first, count, out.data()).run();
+    return true;
+}
+
+bool hd_public::derive_public_range(uint32_t first, size_t count,
+    std::vector<hd_public>& out, threadpool& pool) const
+{
+    const auto blocks = (count + derive_block_size - 1) / derive_block_size;
+
+    // There is no benefit in dispatching fewer than two blocks.
+    if (pool.empty() || blocks < 2)
+        return derive_public_range(first, count, out);
+
+    if (!valid_ || lineage_.depth == max_uint8 ||
+        first >= hd_first_hardened_key ||
+        count > hd_first_hardened_key - first)
+        return false;
+
+    out.resize(count);
+    const auto derive = std::make_shared<deriver>(*this, first, count,
+        out.data());
+
+    // The calling thread is one of the derivers.
+    const auto jobs = std::min(pool.size(), blocks - 1);
+
+    for (size_t job = 0; job < jobs; ++job)
+        pool.service().post([derive]() { derive->run(); });
+
+    derive->run();
+    derive->wait();
+    return true;
+}
+
 // Helpers.
 // ----------------------------------------------------------------------------
 
@@ -249,6 +404,17 @@ uint32_t hd_public::fingerprint() const
     return from_big_endian_unsafe<uint32_t>(message_digest.begin());
 }
 
+// private
+const std::string& hd_public::cached_encoding() const
+{
+    return encoded_->get([this]()
+    {
+        std::string out;
+        encode_base58(out, to_hd_key());
+        return out;
+    });
+}
+
 // Operators.
 // ----------------------------------------------------------------------------
 
@@ -258,6 +424,7 @@ hd_public& hd_public::operator=(const hd_public& other)
     chain_ = other.chain_;
     lineage_ = other.lineage_;
     point_ = other.point_;
+    encoded_ = other.encoded_;
     return *this;
 }
 
@@ -28,6 +28,7 @@
 #include <bitcoin/bitcoin/utility/collection.hpp>
 #include <bitcoin/bitcoin/utility/string.hpp>
 #include <bitcoin/bitcoin/wallet/dictionary.hpp>
+#include <bitcoin/bitcoin/wallet/dictionary_index.hpp>
 #include "../math/external/pkcs5_pbkdf2.h"
 
 namespace libbitcoin {
@@ -56,12 +57,18 @@ bool validate_mnemonic(const word_list& words, const dictionary& lexicon)
 
     BITCOIN_ASSERT((entropy_bits % byte_bits) == 0);
 
+    if (check_bits > hash_size * byte_bits)
+        return false;
+
     size_t bit = 0;
     data_chunk data((total_bits + byte_bits - 1) / byte_bits, 0);
+    const auto index = find_index(lexicon);
 
     for (const auto& word: words)
     {
-        const auto position = find_position(lexicon, word);
+        const auto position = index == nullptr ?
+            find_position(lexicon, word) : index->find(word);
+
         if (position == -1)
             return false;
 
@@ -75,9 +82,22 @@ bool validate_mnemonic(const word_list& words, const dictionary& lexicon)
         }
     }
 
-    data.resize(entropy_bits / byte_bits);
-    const auto mnemonic = create_mnemonic(data, lexicon);
-    return std::equal(mnemonic.begin(), mnemonic.end(), words.begin());
+    // The words are valid if their checksum bits match those of the entropy,
+    // which is equivalent to matching the mnemonic of the entropy.
+    const auto entropy_end = data.data() + entropy_bits / byte_bits;
+    const auto hash = sha256_hash(data_slice(data.data(), entropy_end));
+
+    for (size_t check = 0; check < check_bits; ++check)
+    {
+        const auto word_bit = entropy_bits + check;
+        const auto expected = hash[check / byte_bits] & bip39_shift(check);
+        const auto actual = data[word_bit / byte_bits] & bip39_shift(word_bit);
+
+        if ((expected == 0) != (actual == 0))
+            return false;
+    }
+
+    return true;
 }
 
 word_list create_mnemonic(data_slice entropy, const dictionary &lexicon)
@@ -123,7 +143,8 @@ word_list create_mnemonic(data_slice entropy, const dictionary &lexicon)
 bool validate_mnemonic(const word_list& mnemonic,
     const dictionary_list& lexicons)
 {
-    for (const auto& lexicon: lexicons)
+    // Only lexicons containing every word may validate.
+    for (const auto& lexicon: find_lexicons(mnemonic, lexicons))
         if (validate_mnemonic(mnemonic, *lexicon))
             return true;
 
@@ -49,12 +49,13 @@ payment_address::payment_address()
 
 payment_address::payment_address(payment_address&& other)
   : valid_(other.valid_), version_(other.version_),
-    hash_(std::move(other.hash_))
+    hash_(std::move(other.hash_)), encoded_(std::move(other.encoded_))
 {
 }
 
 payment_address::payment_address(const payment_address& other)
-  : valid_(other.valid_), version_(other.version_), hash_(other.hash_)
+  : valid_(other.valid_), version_(other.version_), hash_(other.hash_),
+    encoded_(other.encoded_)
 {
 }
 
@@ -169,7 +170,23 @@ payment_address::operator const short_hash&() const
 
 std::string payment_address::encoded() const
 {
-    return encode_base58(wrap(version_, hash_));
+    return cached_encoding();
+}
+
+void payment_address::encoded(std::string& out) const
+{
+    out.assign(cached_encoding());
+}
+
+// private
+const std::string& payment_address::cached_encoding() const
+{
+    return encoded_->get([this]()
+    {
+        std::string out;
+        encode_base58(out, wrap(version_, hash_));
+        return out;
+    });
 }
 
 // Accessors.
@@ -201,6 +218,7 @@ payment_address& payment_address::operator=(const payment_address& other)
     valid_ = other.valid_;
     version_ = other.version_;
     hash_ = other.hash_;
+    encoded_ = other.encoded_;
     return *this;
 }
 
@@ -306,42 +324,22 @@ payment_address::list payment_address::extract_input(
 payment_address::list payment_address::extract_output(
     const chain::script& script, uint8_t p2kh_version, uint8_t p2sh_version)
 {
-    const auto pattern = script.output_pattern();
+    // Addressable patterns are matched on the script bytes, without decoding.
+    const auto& bytes = script.bytes();
+    data_slice data(bytes);
 
-    switch (pattern)
-    {
-        case script_pattern::pay_key_hash:
-        {
-            return
-            {
-                { to_array<short_hash_size>(script[2].data()), p2kh_version }
-            };
-        }
-        case script_pattern::pay_script_hash:
-        {
-            return
-            {
-                { to_array<short_hash_size>(script[1].data()), p2sh_version }
-            };
-        }
-        case script_pattern::pay_public_key:
-        {
-            return
-            {
-                // pay_public_key is not p2kh but we conflate for tracking.
-                { ec_public{ script[0].data() }, p2kh_version }
-            };
-        }
+    if (chain::script::is_pay_key_hash_pattern(data, bytes))
+        return { { to_array<short_hash_size>(data), p2kh_version } };
 
-        // Bare multisig and null data do not associate a payment address.
-        case script_pattern::pay_multisig:
-        case script_pattern::pay_null_data:
-        case script_pattern::non_standard:
-        default:
-        {
-            return {};
-        }
-    }
+    if (chain::script::is_pay_script_hash_pattern(data, bytes))
+        return { { to_array<short_hash_size>(data), p2sh_version } };
+
+    // pay_public_key is not p2kh but we conflate for tracking.
+    if (chain::script::is_pay_public_key_pattern(data, bytes))
+        return { { ec_public{ to_chunk(data) }, p2kh_version } };
+
+    // Bare multisig and null data do not associate a payment address.
+    return {};
 }
 
 } // namespace wallet
@@ -18,15 +18,18 @@
  */
 #include <bitcoin/bitcoin/wallet/qrcode.hpp>
 
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <string>
 #include <bitcoin/bitcoin/constants.hpp>
 #include <bitcoin/bitcoin/define.hpp>
+#include <bitcoin/bitcoin/utility/byte_writer.hpp>
 #include <bitcoin/bitcoin/utility/data.hpp>
 #include <bitcoin/bitcoin/utility/container_sink.hpp>
 #include <bitcoin/bitcoin/utility/container_source.hpp>
-#include <bitcoin/bitcoin/utility/istream_reader.hpp>
 #include <bitcoin/bitcoin/utility/ostream_writer.hpp>
+#include <bitcoin/bitcoin/utility/string.hpp>
 
 #ifdef WITH_QRENCODE
 
@@ -62,29 +65,68 @@ bool qr::encode(std::istream& in, uint32_t version, error_recovery_level level,
     std::string qr_string;
     getline(in, qr_string);
 
-    const auto qrcode = QRcode_encodeString(qr_string.c_str(), version,
-        level, mode, case_sensitive);
+    encoder coder(version, level, mode, case_sensitive);
+    const auto& code = coder.encode(qr_string);
 
-    if (qrcode == nullptr)
-        return false;
-
-    const auto area = qrcode->width * qrcode->width;
-    if ((area == 0) || (qrcode->width > max_int32 / qrcode->width))
+    if (code.empty())
         return false;
 
-    auto width_ptr = reinterpret_cast<const uint8_t*>(&qrcode->width);
-    auto version_ptr = reinterpret_cast<const uint8_t*>(&qrcode->version);
-
-    // Write out raw format of QRcode structure (defined in qrencode.h).
-    // Format written is:
-    // int version
-    // int width
-    // unsigned char* data (of width^2 length)
     ostream_writer sink(out);
-    sink.write_bytes(version_ptr, sizeof(int));
-    sink.write_bytes(width_ptr, sizeof(int));
-    sink.write_bytes(qrcode->data, area);
+    sink.write_bytes(code);
     out.flush();
+    return true;
+}
+
+// qr::encoder
+//-----------------------------------------------------------------------------
+
+qr::encoder::encoder(uint32_t version, error_recovery_level level,
+    encode_mode mode, bool case_sensitive)
+  : version_(version), level_(level), mode_(mode),
+    case_sensitive_(case_sensitive)
+{
+}
+
+// Write out raw format of QRcode structure (defined in qrencode.h).
+// Format written is:
+// int version (four bytes, little endian)
+// int width (four bytes, little endian)
+// unsigned char* data (of width^2 length)
+const data_chunk& qr::encoder::encode(const std::string& text)
+{
+    code_.clear();
+
+    const auto qrcode = QRcode_encodeString(text.c_str(), version_, level_,
+        mode_, case_sensitive_);
+
+    if (qrcode == nullptr)
+        return code_;
+
+    const auto width = qrcode->width;
+
+    if (width > 0 && width <= max_int32 / width)
+    {
+        const auto area = static_cast<size_t>(width) * width;
+        code_.reserve(2 * sizeof(uint32_t) + area);
+        byte_writer sink(code_);
+        sink.write_4_bytes_little_endian(qrcode->version);
+        sink.write_4_bytes_little_endian(width);
+        sink.write_bytes(qrcode->data, area);
+    }
+
+    QRcode_free(qrcode);
+    return code_;
+}
+
+bool qr::encoder::encode(const string_list& texts, handler handle)
+{
+    for (size_t index = 0; index < texts.size(); ++index)
+    {
+        const auto& code = encode(texts[index]);
+
+        if (code.empty() || !handle(index, code))
+            return false;
+    }
 
     return true;
 }
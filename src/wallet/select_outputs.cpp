@@ -19,16 +19,82 @@
 #include <bitcoin/bitcoin/wallet/select_outputs.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <random>
+#include <vector>
 #include <bitcoin/bitcoin/constants.hpp>
+#include <bitcoin/bitcoin/math/limits.hpp>
+#include <bitcoin/bitcoin/utility/asio.hpp>
 #include <bitcoin/bitcoin/utility/assert.hpp>
+#include <bitcoin/bitcoin/utility/pseudo_random.hpp>
 #include <bitcoin/bitcoin/chain/points_value.hpp>
+#include <bitcoin/bitcoin/wallet/unspent_index.hpp>
 
 namespace libbitcoin {
 namespace wallet {
 
 using namespace bc::chain;
 
+// The clock is read once per this many tries, as it costs more than a try.
+static constexpr size_t clock_interval = 1024;
+
+select_outputs::budget::budget(uint64_t input_fee, uint64_t cost_of_change,
+    size_t maximum_tries, asio::duration timeout)
+  : input_fee(input_fee),
+    cost_of_change(cost_of_change),
+    maximum_tries(maximum_tries),
+    timeout(timeout)
+{
+}
+
+// Tracks the tries and time remaining to a selection.
+struct select_outputs::search
+{
+    search(const budget& limits)
+      : cost_of_change(limits.cost_of_change),
+        timeout(limits.timeout),
+        start(asio::steady_clock::now()),
+        tries(limits.maximum_tries),
+        until_clock(clock_interval)
+    {
+    }
+
+    // Spend the tries of a step, false if the budget is exhausted.
+    bool spend(size_t steps=1)
+    {
+        if (tries < steps)
+        {
+            tries = 0;
+            return false;
+        }
+
+        tries -= steps;
+
+        if (timeout == asio::duration::zero())
+            return true;
+
+        if (until_clock > steps)
+        {
+            until_clock -= steps;
+            return true;
+        }
+
+        until_clock = clock_interval;
+        if (asio::steady_clock::now() - start < timeout)
+            return true;
+
+        tries = 0;
+        return false;
+    }
+
+    const uint64_t cost_of_change;
+    const asio::duration timeout;
+    const asio::time_point start;
+    size_t tries;
+    size_t until_clock;
+};
+
 void select_outputs::greedy(points_value& out, const points_value& unspent,
     uint64_t minimum_value)
 {
@@ -111,11 +177,263 @@ void select_outputs::individual(points_value& out, const points_value& unspent,
     std::sort(out.points.begin(), out.points.end(), lesser);
 }
 
+// Depth-first search over inclusion and then omission of each output, in
+// descending order of effective value, for the set of least excess within
+// the cost of change. Branches that cannot reach the minimum or that exceed
+// the maximum are abandoned, as are branches that omit an output of the same
+// value as an omitted predecessor (they repeat the predecessor's branch).
+bool select_outputs::branch_and_bound(std::vector<size_t>& out,
+    const values& effective, uint64_t minimum_value, search& limits)
+{
+    const auto maximum_value = ceiling_add(minimum_value,
+        limits.cost_of_change);
+
+    auto found = false;
+    auto best_excess = max_uint64;
+    uint64_t selected = 0;
+    uint64_t available = 0;
+    std::vector<size_t> selection;
+
+    for (const auto value: effective)
+        available += value;
+
+    for (size_t index = 0; limits.spend(); ++index)
+    {
+        auto backtrack = false;
+
+        if (selected + available < minimum_value || selected > maximum_value)
+        {
+            backtrack = true;
+        }
+        else if (selected >= minimum_value)
+        {
+            backtrack = true;
+            const auto excess = selected - minimum_value;
+
+            if (excess < best_excess)
+            {
+                out = selection;
+                best_excess = excess;
+                found = true;
+
+                // There is no better set.
+                if (excess == 0)
+                    break;
+            }
+        }
+
+        // The end is never passed, as all branches backtrack there.
+        if (backtrack)
+        {
+            // The omission branch of every included output is exhausted.
+            if (selection.empty())
+                break;
+
+            // Restore the outputs passed since the last included output.
+            for (--index; index > selection.back(); --index)
+                available += effective[index];
+
+            // Omit the last included output and continue with the next.
+            selected -= effective[index];
+            selection.pop_back();
+        }
+        else
+        {
+            available -= effective[index];
+
+            if (selection.empty() || selection.back() == index - 1 ||
+                effective[index] != effective[index - 1])
+            {
+                selection.push_back(index);
+                selected += effective[index];
+            }
+        }
+    }
+
+    return found;
+}
+
+// The smallest sufficient output or, if smaller, the subset of insufficient
+// outputs of least excess found by random inclusion passes. The initial
+// subset is the fewest insufficient outputs, in case no pass completes.
+void select_outputs::knapsack(std::vector<size_t>& out,
+    const values& effective, uint64_t minimum_value, search& limits)
+{
+    const auto sufficient = [minimum_value](uint64_t value)
+    {
+        return value >= minimum_value;
+    };
+
+    // Effective values descend, so the smallest sufficient precedes lesser.
+    const auto lesser = static_cast<size_t>(std::distance(effective.begin(),
+        std::partition_point(effective.begin(), effective.end(),
+            sufficient)));
+
+    const auto take_larger = [&out, lesser]()
+    {
+        out.assign(1, lesser - 1);
+    };
+
+    uint64_t best_total = 0;
+    auto count = lesser;
+
+    while (count < effective.size() && best_total < minimum_value)
+        best_total += effective[count++];
+
+    if (best_total < minimum_value)
+    {
+        BITCOIN_ASSERT(lesser > 0);
+        take_larger();
+        return;
+    }
+
+    // Replace the last of them with the smallest that suffices in its place.
+    const auto prefix = best_total - effective[count - 1];
+    const auto reaches = [prefix, minimum_value](uint64_t value)
+    {
+        return prefix + value >= minimum_value;
+    };
+
+    const auto last = static_cast<size_t>(std::distance(effective.begin(),
+        std::partition_point(effective.begin() + (count - 1),
+            effective.end(), reaches))) - 1u;
+
+    best_total = prefix + effective[last];
+
+    const auto size = effective.size() - lesser;
+    std::vector<bool> best(size, false);
+    std::fill(best.begin(), best.begin() + (count - 1 - lesser), true);
+    best[last - lesser] = true;
+
+    std::vector<bool> included(size);
+    std::mt19937_64 twister(pseudo_random::next());
+
+    while (best_total != minimum_value && limits.spend(2 * size))
+    {
+        uint64_t total = 0;
+        uint64_t bits = 0;
+        auto reached = false;
+        std::fill(included.begin(), included.end(), false);
+
+        // The first pass includes at random, the second includes the rest.
+        for (size_t pass = 0; pass < 2 && !reached; ++pass)
+        {
+            for (size_t index = 0; index < size; ++index)
+            {
+                if (pass == 0)
+                {
+                    if (index % 64 == 0)
+                        bits = twister();
+
+                    if (((bits >> (index % 64)) & 1) == 0)
+                        continue;
+                }
+                else if (included[index])
+                {
+                    continue;
+                }
+
+                const auto value = effective[lesser + index];
+                total += value;
+                included[index] = true;
+
+                // Record and then drop the output to seek a closer total.
+                if (total >= minimum_value)
+                {
+                    reached = true;
+
+                    if (total < best_total)
+                    {
+                        best_total = total;
+                        best = included;
+                    }
+
+                    total -= value;
+                    included[index] = false;
+                }
+            }
+        }
+    }
+
+    if (lesser > 0 && effective[lesser - 1] <= best_total)
+    {
+        take_larger();
+        return;
+    }
+
+    out.clear();
+    for (size_t index = 0; index < size; ++index)
+        if (best[index])
+            out.push_back(lesser + index);
+}
+
+bool select_outputs::select(points_value& out, const unspent_index& unspent,
+    uint64_t minimum_value, const budget& limits)
+{
+    out.points.clear();
+    const auto& points = unspent.points();
+    const auto input_fee = limits.input_fee;
+
+    const auto positive = [input_fee](const point_value& point)
+    {
+        return point.value() > input_fee;
+    };
+
+    // Values descend, so the outputs of positive effective value are first.
+    const auto end = std::partition_point(points.begin(), points.end(),
+        positive);
+
+    values effective;
+    uint64_t total = 0;
+    effective.reserve(std::distance(points.begin(), end));
+
+    for (auto point = points.begin(); point != end; ++point)
+    {
+        effective.push_back(point->value() - input_fee);
+        total = ceiling_add(total, effective.back());
+    }
+
+    // The minimum required value does not exist.
+    if (total < minimum_value)
+        return false;
+
+    search remaining(limits);
+    std::vector<size_t> selection;
+    auto changeless = branch_and_bound(selection, effective, minimum_value,
+        remaining);
+
+    // The knapsack set may also happen to be within the cost of change.
+    if (!changeless)
+    {
+        knapsack(selection, effective, minimum_value, remaining);
+
+        uint64_t selected = 0;
+        for (const auto index: selection)
+            selected += effective[index];
+
+        changeless = (selected - minimum_value <= limits.cost_of_change);
+    }
+
+    // Return in descending order by value.
+    std::sort(selection.begin(), selection.end());
+    out.points.reserve(selection.size());
+
+    for (const auto index: selection)
+        out.points.push_back(points[index]);
+
+    return changeless;
+}
+
 void select_outputs::select(points_value& out, const points_value& unspent,
     uint64_t minimum_value, algorithm option)
 {
     switch(option)
     {
+        case algorithm::branch_and_bound:
+        {
+            select(out, unspent_index(unspent), minimum_value);
+            break;
+        }
         case algorithm::individual:
         {
             individual(out, unspent, minimum_value);
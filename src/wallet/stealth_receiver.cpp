@@ -18,10 +18,23 @@
  */
 #include <bitcoin/bitcoin/wallet/stealth_receiver.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <bitcoin/bitcoin/chain/stealth_record.hpp>
+#include <bitcoin/bitcoin/constants.hpp>
 #include <bitcoin/bitcoin/math/elliptic_curve.hpp>
+#include <bitcoin/bitcoin/math/hash.hpp>
 #include <bitcoin/bitcoin/math/stealth.hpp>
 #include <bitcoin/bitcoin/utility/binary.hpp>
+#include <bitcoin/bitcoin/utility/data.hpp>
+#include <bitcoin/bitcoin/utility/endian.hpp>
+#include <bitcoin/bitcoin/utility/threadpool.hpp>
 #include <bitcoin/bitcoin/wallet/payment_address.hpp>
 #include <bitcoin/bitcoin/wallet/stealth_address.hpp>
 
@@ -72,5 +85,214 @@ bool stealth_receiver::derive_private(ec_secret& out_private,
         spend_private_);
 }
 
+// Scan.
+//-----------------------------------------------------------------------------
+// Store records are: height[4] prefix[4] ephemeral[32] hash[20] tx_hash[32].
+
+static BC_CONSTEXPR size_t height_offset = 0;
+static BC_CONSTEXPR size_t prefix_offset = height_offset + sizeof(uint32_t);
+static BC_CONSTEXPR size_t ephemeral_offset = prefix_offset + sizeof(uint32_t);
+static BC_CONSTEXPR size_t hash_offset = ephemeral_offset + hash_size;
+static BC_CONSTEXPR size_t tx_hash_offset = hash_offset + short_hash_size;
+static BC_CONSTEXPR size_t record_size = tx_hash_offset + hash_size;
+
+// The number of records filtered and matched per handler round.
+static BC_CONSTEXPR size_t scan_chunk = 4096;
+
+// A filter reduced to a mask and value over the big endian reading of the
+// (little endian) prefix, which orders the bits as does binary.
+struct prefix_filter
+{
+    prefix_filter(const binary& filter)
+      : mask(0), value(0), none(false)
+    {
+        const auto bits = std::min(filter.size(), binary::size_type(32));
+        auto blocks = filter.blocks();
+        blocks.resize(std::max(blocks.size(), sizeof(uint32_t)), 0x00);
+
+        // Bits beyond the prefix width compare to zero padding.
+        for (auto bit = bits; bit < filter.size(); ++bit)
+            none |= filter[bit];
+
+        mask = bits == 0 ? 0 : max_uint32 << (32 - bits);
+        value = from_big_endian_unsafe<uint32_t>(blocks.begin()) & mask;
+    }
+
+    bool is_prefix_of(const uint8_t* record) const
+    {
+        return !none && (from_big_endian_unsafe<uint32_t>(
+            &record[prefix_offset]) & mask) == value;
+    }
+
+    uint32_t mask;
+    uint32_t value;
+    bool none;
+};
+
+static chain::stealth_record to_record(const uint8_t* record)
+{
+    hash_digest ephemeral;
+    short_hash public_key_hash;
+    hash_digest transaction_hash;
+    std::copy_n(&record[ephemeral_offset], hash_size, ephemeral.begin());
+    std::copy_n(&record[hash_offset], short_hash_size, public_key_hash.begin());
+    std::copy_n(&record[tx_hash_offset], hash_size, transaction_hash.begin());
+
+    return
+    {
+        from_little_endian_unsafe<uint32_t>(&record[height_offset]),
+        from_little_endian_unsafe<uint32_t>(&record[prefix_offset]),
+        std::move(ephemeral),
+        std::move(public_key_hash),
+        std::move(transaction_hash)
+    };
+}
+
+// Filter the records of a chunk, returning the offsets of the survivors.
+static void filter_chunk(std::vector<const uint8_t*>& out,
+    const uint8_t* first, size_t count, size_t start_height,
+    const prefix_filter& filter)
+{
+    out.clear();
+    for (auto record = first; record != first + count * record_size;
+        record += record_size)
+    {
+        if (from_little_endian_unsafe<uint32_t>(&record[height_offset]) >=
+            start_height && filter.is_prefix_of(record))
+            out.push_back(record);
+    }
+}
+
+// The filtered record pays the receiver (this computes the shared secret).
+bool stealth_receiver::is_match(const uint8_t* record) const
+{
+    // The store excludes the assumed sign byte of the ephemeral key.
+    ec_compressed ephemeral;
+    ephemeral[0] = ec_even_sign;
+    std::copy_n(&record[ephemeral_offset], hash_size, ephemeral.begin() + 1);
+
+    ec_compressed receiver_public;
+    if (!uncover_stealth(receiver_public, ephemeral, scan_private_,
+        spend_public_))
+        return false;
+
+    const auto hash = bitcoin_short_hash(receiver_public);
+    return std::equal(hash.begin(), hash.end(), &record[hash_offset]);
+}
+
+// Claims and matches filtered records in order until exhausted.
+struct stealth_receiver::matcher
+{
+    matcher(const stealth_receiver& receiver,
+        const std::vector<const uint8_t*>& records)
+      : receiver(receiver),
+        records(records),
+        matches(records.size(), 0),
+        next(0),
+        running(0)
+    {
+    }
+
+    void run()
+    {
+        mutex.lock();
+        ++running;
+        mutex.unlock();
+
+        size_t index;
+        while ((index = next.fetch_add(1)) < records.size())
+            matches[index] = receiver.is_match(records[index]) ? 1 : 0;
+
+        mutex.lock();
+        const auto idle = (--running == 0);
+        mutex.unlock();
+
+        if (idle)
+            finished.notify_all();
+    }
+
+    // Wait for all claimed records to complete, call only after run().
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        finished.wait(lock, [this]() { return running == 0; });
+    }
+
+    const stealth_receiver& receiver;
+    const std::vector<const uint8_t*> records;
+
+    // Each element is written only by the thread that claimed it.
+    std::vector<uint8_t> matches;
+    std::atomic<size_t> next;
+
+    // This is protected by mutex.
+    size_t running;
+    std::mutex mutex;
+    std::condition_variable finished;
+};
+
+bool stealth_receiver::scan(data_slice records, size_t start_height,
+    scan_handler handler) const
+{
+    if (records.size() % record_size != 0)
+        return false;
+
+    const prefix_filter filter(address_.filter());
+    const auto count = records.size() / record_size;
+    std::vector<const uint8_t*> survivors;
+
+    for (size_t first = 0; first < count; first += scan_chunk)
+    {
+        filter_chunk(survivors, records.data() + first * record_size,
+            std::min(scan_chunk, count - first), start_height, filter);
+
+        for (const auto record: survivors)
+            if (is_match(record))
+                handler(to_record(record));
+    }
+
+    return true;
+}
+
+bool stealth_receiver::scan(data_slice records, size_t start_height,
+    scan_handler handler, threadpool& pool) const
+{
+    if (pool.empty())
+        return scan(records, start_height, handler);
+
+    if (records.size() % record_size != 0)
+        return false;
+
+    const prefix_filter filter(address_.filter());
+    const auto count = records.size() / record_size;
+    std::vector<const uint8_t*> survivors;
+
+    for (size_t first = 0; first < count; first += scan_chunk)
+    {
+        filter_chunk(survivors, records.data() + first * record_size,
+            std::min(scan_chunk, count - first), start_height, filter);
+
+        if (survivors.empty())
+            continue;
+
+        const auto match = std::make_shared<matcher>(*this, survivors);
+
+        // The calling thread is one of the matchers.
+        const auto jobs = std::min(pool.size(), survivors.size() - 1);
+
+        for (size_t job = 0; job < jobs; ++job)
+            pool.service().post([match]() { match->run(); });
+
+        match->run();
+        match->wait();
+
+        for (size_t index = 0; index < survivors.size(); ++index)
+            if (match->matches[index] != 0)
+                handler(to_record(survivors[index]));
+    }
+
+    return true;
+}
+
 } // namespace wallet
 } // namespace libbitcoin
@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/bitcoin/wallet/unspent_index.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/bitcoin/chain/point_value.hpp>
+#include <bitcoin/bitcoin/chain/points_value.hpp>
+#include <bitcoin/bitcoin/math/limits.hpp>
+
+namespace libbitcoin {
+namespace wallet {
+
+using namespace bc::chain;
+
+unspent_index::unspent_index()
+  : value_(0)
+{
+}
+
+unspent_index::unspent_index(const points_value& unspent)
+  : points_(unspent.points), value_(0)
+{
+    std::sort(points_.begin(), points_.end(), greater);
+
+    // Duplicates are dropped for consistency with insert.
+    points_.erase(std::unique(points_.begin(), points_.end()), points_.end());
+
+    for (const auto& point: points_)
+        value_ = ceiling_add(value_, point.value());
+}
+
+// The point breaks value ties so that each output has one position.
+bool unspent_index::greater(const point_value& left, const point_value& right)
+{
+    return left.value() > right.value() ||
+        (left.value() == right.value() && left < right);
+}
+
+bool unspent_index::insert(const point_value& point)
+{
+    const auto it = std::lower_bound(points_.begin(), points_.end(), point,
+        greater);
+
+    if (it != points_.end() && *it == point)
+        return false;
+
+    points_.insert(it, point);
+    value_ = ceiling_add(value_, point.value());
+    return true;
+}
+
+bool unspent_index::erase(const point_value& point)
+{
+    const auto it = std::lower_bound(points_.begin(), points_.end(), point,
+        greater);
+
+    if (it == points_.end() || *it != point)
+        return false;
+
+    points_.erase(it);
+    value_ = floor_subtract(value_, point.value());
+    return true;
+}
+
+void unspent_index::clear()
+{
+    points_.clear();
+    value_ = 0;
+}
+
+const point_value::list& unspent_index::points() const
+{
+    return points_;
+}
+
+size_t unspent_index::size() const
+{
+    return points_.size();
+}
+
+uint64_t unspent_index::value() const
+{
+    return value_;
+}
+
+} // namespace wallet
+} // namespace libbitcoin
@@ -0,0 +1,247 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "bench.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iterator>
+#include <new>
+#include <bitcoin/bitcoin.hpp>
+
+#ifdef __linux__
+    #include <cstring>
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+// The replaceable allocation functions are counted for the whole process,
+// including allocations made within the library.
+static std::atomic<uint64_t> allocation_count(0);
+
+void* operator new(size_t size)
+{
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+
+    if (auto memory = std::malloc(size == 0 ? 1 : size))
+        return memory;
+
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size)
+{
+    return ::operator new(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    std::free(memory);
+}
+
+namespace libbitcoin {
+namespace bench {
+
+static const char* event_names[events]
+{
+    "cycles",
+    "instructions",
+    "l1d_misses",
+    "llc_misses",
+    "branch_misses"
+};
+
+#ifdef __linux__
+
+// Open a counter of the event for the calling thread on any core, disabled
+// and excluding the kernel, -1 if unavailable.
+static int open_event(uint32_t type, uint64_t config)
+{
+    perf_event_attr attributes;
+    std::memset(&attributes, 0, sizeof(attributes));
+    attributes.size = sizeof(attributes);
+    attributes.type = type;
+    attributes.config = config;
+    attributes.disabled = 1;
+    attributes.exclude_kernel = 1;
+    attributes.exclude_hv = 1;
+
+    return static_cast<int>(syscall(__NR_perf_event_open, &attributes, 0, -1,
+        -1, 0));
+}
+
+event_counters::event_counters(bool enabled)
+{
+    static const uint64_t l1d_read_miss =
+        PERF_COUNT_HW_CACHE_L1D |
+        (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+        (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+
+    std::fill(std::begin(descriptors_), std::end(descriptors_), -1);
+
+    if (!enabled)
+        return;
+
+    descriptors_[event_cycles] = open_event(PERF_TYPE_HARDWARE,
+        PERF_COUNT_HW_CPU_CYCLES);
+    descriptors_[event_instructions] = open_event(PERF_TYPE_HARDWARE,
+        PERF_COUNT_HW_INSTRUCTIONS);
+    descriptors_[event_l1d_misses] = open_event(PERF_TYPE_HW_CACHE,
+        l1d_read_miss);
+    descriptors_[event_llc_misses] = open_event(PERF_TYPE_HARDWARE,
+        PERF_COUNT_HW_CACHE_MISSES);
+    descriptors_[event_branch_misses] = open_event(PERF_TYPE_HARDWARE,
+        PERF_COUNT_HW_BRANCH_MISSES);
+}
+
+event_counters::~event_counters()
+{
+    for (const auto descriptor: descriptors_)
+        if (descriptor >= 0)
+            close(descriptor);
+}
+
+void event_counters::start()
+{
+    for (const auto descriptor: descriptors_)
+    {
+        if (descriptor >= 0)
+        {
+            ioctl(descriptor, PERF_EVENT_IOC_RESET, 0);
+            ioctl(descriptor, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+}
+
+void event_counters::stop(event_samples& out)
+{
+    for (size_t event = 0; event < events; ++event)
+    {
+        const auto descriptor = descriptors_[event];
+
+        if (descriptor >= 0)
+            ioctl(descriptor, PERF_EVENT_IOC_DISABLE, 0);
+    }
+
+    for (size_t event = 0; event < events; ++event)
+    {
+        uint64_t count;
+        const auto descriptor = descriptors_[event];
+
+        if (descriptor >= 0 &&
+            read(descriptor, &count, sizeof(count)) == sizeof(count))
+            out.values[event].push_back(count);
+    }
+}
+
+#else
+
+event_counters::event_counters(bool)
+{
+    std::fill(std::begin(descriptors_), std::end(descriptors_), -1);
+}
+
+event_counters::~event_counters()
+{
+}
+
+void event_counters::start()
+{
+}
+
+void event_counters::stop(event_samples&)
+{
+}
+
+#endif
+
+bool event_counters::available() const
+{
+    const auto open = [](int descriptor)
+    {
+        return descriptor >= 0;
+    };
+
+    return std::any_of(std::begin(descriptors_), std::end(descriptors_), open);
+}
+
+void write_events(std::ostream& out, const std::string& prefix,
+    const event_samples& values, size_t operations)
+{
+    const auto divisor = static_cast<double>(std::max(operations, size_t(1)));
+
+    for (size_t event = 0; event < events; ++event)
+    {
+        const auto& sampled = values.values[event];
+
+        if (sampled.empty())
+            continue;
+
+        out << ", \"" << prefix << "_" << event_names[event] << "_per_op\": "
+            << std::fixed << std::setprecision(2)
+            << median(sampled) / divisor;
+    }
+}
+
+uint64_t elapsed(const asio::time_point& start)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        asio::steady_clock::now() - start).count();
+}
+
+uint64_t median(samples values)
+{
+    if (values.empty())
+        return 0;
+
+    const auto middle = values.begin() + values.size() / 2;
+    std::nth_element(values.begin(), middle, values.end());
+    return *middle;
+}
+
+uint64_t percentile(samples values, size_t percent)
+{
+    if (values.empty())
+        return 0;
+
+    const auto rank = std::min(values.size() * percent / 100,
+        values.size() - 1);
+
+    const auto nth = values.begin() + rank;
+    std::nth_element(values.begin(), nth, values.end());
+    return *nth;
+}
+
+uint64_t allocations()
+{
+    return allocation_count.load(std::memory_order_relaxed);
+}
+
+} // namespace bench
+} // namespace libbitcoin
@@ -0,0 +1,130 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_BENCH_BENCH_HPP
+#define LIBBITCOIN_BENCH_BENCH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+
+namespace libbitcoin {
+namespace bench {
+
+typedef std::vector<uint64_t> samples;
+
+/// The forks enforced by a mainnet node.
+static const uint32_t mainnet_forks =
+    machine::rule_fork::difficult |
+    machine::rule_fork::retarget |
+    machine::rule_fork::bip16_rule |
+    machine::rule_fork::bip30_rule |
+    machine::rule_fork::bip34_rule |
+    machine::rule_fork::bip66_rule |
+    machine::rule_fork::bip65_rule |
+    machine::rule_fork::bip90_rule |
+    machine::rule_fork::bip9_bit0_group |
+    machine::rule_fork::bip9_bit1_group;
+
+/// The hardware events counted around benchmarked regions.
+enum counter_event
+{
+    event_cycles,
+    event_instructions,
+    event_l1d_misses,
+    event_llc_misses,
+    event_branch_misses,
+    events
+};
+
+/// The samples of each hardware event, empty for an uncounted event.
+struct event_samples
+{
+    samples values[events];
+};
+
+/// Counts hardware events of the calling thread between start and stop,
+/// using perf_event on Linux. If counting is not enabled, or an event is not
+/// available on the platform (or to the user), the event is not sampled.
+class event_counters
+  : noncopyable
+{
+public:
+    event_counters(bool enabled);
+    ~event_counters();
+
+    /// True if any event is counted.
+    bool available() const;
+
+    /// Reset and start counting.
+    void start();
+
+    /// Stop counting, appending the count of each available event to out.
+    void stop(event_samples& out);
+
+private:
+    int descriptors_[events];
+};
+
+/// Write the median of each sampled event divided by the operations, as
+/// json properties named by the prefix and event, nothing if none sampled.
+void write_events(std::ostream& out, const std::string& prefix,
+    const event_samples& values, size_t operations);
+
+/// The nanoseconds elapsed since start.
+uint64_t elapsed(const asio::time_point& start);
+
+/// The median of the samples, zero if there are none.
+uint64_t median(samples values);
+
+/// The value at the percent rank of the samples, zero if there are none.
+uint64_t percentile(samples values, size_t percent);
+
+/// The number of heap allocations (operator new) made by the process.
+uint64_t allocations();
+
+/// Benchmark validation stages over each block of the corpus file, with
+/// hardware event counts if counted.
+/// Write the results as json, false if the corpus or any block is invalid.
+bool bench_blocks(std::ostream& out, std::ostream& error,
+    const std::string& path, size_t iterations, bool counted);
+
+/// Replay the validation of each block of the capture file, serially if
+/// threads is zero, otherwise on a pool of that many threads.
+/// Write the results as json, false if the captures or any block is invalid.
+bool bench_replay(std::ostream& out, std::ostream& error,
+    const std::string& path, size_t iterations, size_t threads);
+
+/// Benchmark script evaluation and verification of opcode and template
+/// scripts, with hardware event counts if counted.
+/// Write the results as json, false if any script fails.
+bool bench_scripts(std::ostream& out, size_t iterations, bool counted);
+
+/// Benchmark threadpool, dispatcher, sequencer, subscriber and deadline
+/// handoffs on pools of one thread doubling up to threads (zero for the
+/// number of cores). Write the latency
+/// percentiles and rates as json, false if any handoff fails.
+bool bench_threads(std::ostream& out, size_t iterations, size_t threads);
+
+} // namespace bench
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,269 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "bench.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include "corpus.hpp"
+
+namespace libbitcoin {
+namespace bench {
+
+using namespace bc::chain;
+using namespace bc::machine;
+
+// Each corpus block is run through the stages of block validation, and the
+// median duration of each stage over the iterations is reported, with the
+// median hardware event counts per transaction if counted.
+
+enum block_stage
+{
+    stage_deserialize,
+    stage_hash,
+    stage_check,
+    stage_accept,
+    stage_connect,
+    stage_sighash,
+    stages
+};
+
+static const char* stage_names[stages]
+{
+    "deserialize",
+    "hash",
+    "check",
+    "accept",
+    "connect",
+    "sighash"
+};
+
+struct block_result
+{
+    const corpus_block* source;
+    hash_digest hash;
+    size_t transactions;
+    size_t inputs;
+    code ec;
+    samples durations[stages];
+    event_samples events[stages];
+};
+
+// The state of the block with the header values of the block standing in
+// for those of its predecessors. Activations are by height (bip90) and the
+// bip9 checkpoints, so only the contextual header checks are not modeled.
+static chain_state make_state(const block& block, size_t height,
+    const settings& settings)
+{
+    const auto& header = block.header();
+    chain_state::data values;
+    values.height = height;
+    values.hash = header.hash();
+    values.bits.self = header.bits();
+    values.bits.ordered.push_back(header.bits());
+    values.version.self = header.version();
+    values.version.ordered.push_back(header.version());
+    values.timestamp.self = header.timestamp();
+    values.timestamp.retarget = header.timestamp();
+    values.timestamp.ordered.push_back(header.timestamp());
+
+    const auto& bit0 = settings.bip9_bit0_active_checkpoint;
+    const auto& bit1 = settings.bip9_bit1_active_checkpoint;
+    values.bip9_bit0_hash = height > bit0.height() ? bit0.hash() : null_hash;
+    values.bip9_bit1_hash = height > bit1.height() ? bit1.hash() : null_hash;
+
+    return { std::move(values), chain_state::checkpoints{}, mainnet_forks, 0,
+        settings };
+}
+
+// The previous output script stands in for the script code, which exercises
+// the legacy and the bip143 (witness input) serializations of each input.
+static size_t generate_signature_hashes(const block& block)
+{
+    size_t count = 0;
+    const auto& txs = block.transactions();
+
+    for (auto tx = txs.begin() + 1; tx != txs.end(); ++tx)
+    {
+        const auto& inputs = tx->inputs();
+
+        for (uint32_t index = 0; index < inputs.size(); ++index)
+        {
+            const auto& input = inputs[index];
+            const auto& prevout = input.previous_output().metadata->cache;
+            const auto version = input.is_segregated() ?
+                script_version::zero : script_version::unversioned;
+
+            script::generate_signature_hash(*tx, index, prevout.script(),
+                sighash_algorithm::all, version, prevout.value());
+            ++count;
+        }
+    }
+
+    return count;
+}
+
+static code run(block_result& out, const corpus_block& source,
+    const settings& settings, event_counters& counters)
+{
+    block block;
+    counters.start();
+    auto start = asio::steady_clock::now();
+
+    if (!block.from_data(source.data, true))
+        return error::bad_stream;
+
+    out.durations[stage_deserialize].push_back(elapsed(start));
+    counters.stop(out.events[stage_deserialize]);
+
+    counters.start();
+    start = asio::steady_clock::now();
+    block.generate_merkle_root();
+    out.durations[stage_hash].push_back(elapsed(start));
+    counters.stop(out.events[stage_hash]);
+
+    code ec;
+    counters.start();
+    start = asio::steady_clock::now();
+
+    if ((ec = block.check(settings.max_money(),
+        settings.timestamp_limit_seconds, settings.proof_of_work_limit)))
+        return ec;
+
+    out.durations[stage_check].push_back(elapsed(start));
+    counters.stop(out.events[stage_check]);
+
+    const auto state = make_state(block, source.height, settings);
+    corpus_source prevouts(source.prevouts);
+
+    if ((ec = block.populate_previous_outputs(state, prevouts)))
+        return ec;
+
+    counters.start();
+    start = asio::steady_clock::now();
+
+    if ((ec = block.accept(state, settings, true, false)))
+        return ec;
+
+    out.durations[stage_accept].push_back(elapsed(start));
+    counters.stop(out.events[stage_accept]);
+    counters.start();
+    start = asio::steady_clock::now();
+
+    if ((ec = block.connect(state)))
+        return ec;
+
+    out.durations[stage_connect].push_back(elapsed(start));
+    counters.stop(out.events[stage_connect]);
+    counters.start();
+    start = asio::steady_clock::now();
+    out.inputs = generate_signature_hashes(block);
+    out.durations[stage_sighash].push_back(elapsed(start));
+    counters.stop(out.events[stage_sighash]);
+
+    out.hash = block.hash();
+    out.transactions = block.transactions().size();
+    return error::success;
+}
+
+static void write_json(std::ostream& out, const std::string& path,
+    size_t iterations, const std::vector<block_result>& results)
+{
+    uint64_t totals[stages] = {};
+
+    out << "{" << std::endl;
+    out << "  \"corpus\": \"" << path << "\"," << std::endl;
+    out << "  \"iterations\": " << iterations << "," << std::endl;
+    out << "  \"blocks\": [" << std::endl;
+
+    for (size_t index = 0; index < results.size(); ++index)
+    {
+        const auto& result = results[index];
+        out << "    { \"height\": " << result.source->height
+            << ", \"hash\": \"" << encode_hash(result.hash)
+            << "\", \"size\": " << result.source->data.size()
+            << ", \"transactions\": " << result.transactions
+            << ", \"inputs\": " << result.inputs;
+
+        if (result.ec)
+            out << ", \"error\": \"" << result.ec.message() << "\"";
+
+        for (size_t stage = 0; stage < stages; ++stage)
+        {
+            const auto value = median(result.durations[stage]);
+            totals[stage] += value;
+            out << ", \"" << stage_names[stage] << "_ns\": " << value;
+            write_events(out, stage_names[stage], result.events[stage],
+                result.transactions);
+        }
+
+        out << " }" << (index + 1 < results.size() ? "," : "") << std::endl;
+    }
+
+    out << "  ]," << std::endl;
+    out << "  \"totals\": {";
+
+    for (size_t stage = 0; stage < stages; ++stage)
+        out << (stage == 0 ? " " : ", ") << "\"" << stage_names[stage]
+            << "_ns\": " << totals[stage];
+
+    out << " }" << std::endl;
+    out << "}" << std::endl;
+}
+
+bool bench_blocks(std::ostream& out, std::ostream& error,
+    const std::string& path, size_t iterations, bool counted)
+{
+    corpus blocks;
+
+    if (!read_corpus(blocks, path))
+    {
+        error << "Invalid corpus: " << path << std::endl;
+        return false;
+    }
+
+    const settings settings(config::settings::mainnet);
+    event_counters counters(counted);
+    std::vector<block_result> results(blocks.size());
+    auto failed = false;
+
+    for (size_t index = 0; index < blocks.size(); ++index)
+    {
+        auto& result = results[index];
+        result.source = &blocks[index];
+        result.hash = null_hash;
+        result.transactions = 0;
+        result.inputs = 0;
+
+        // A block that fails is reported, as its timings are not comparable.
+        for (size_t count = 0; count < iterations && !result.ec; ++count)
+            result.ec = run(result, blocks[index], settings, counters);
+
+        failed |= static_cast<bool>(result.ec);
+    }
+
+    write_json(out, path, iterations, results);
+    return !failed;
+}
+
+} // namespace bench
+} // namespace libbitcoin
@@ -0,0 +1,142 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "corpus.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <bitcoin/bitcoin.hpp>
+
+namespace libbitcoin {
+namespace bench {
+
+using namespace bc::chain;
+
+static bool read_prevout(output_point& out, std::istream& fields)
+{
+    std::string encoded_hash;
+    std::string encoded_script;
+    uint32_t index;
+    size_t height;
+    int coinbase;
+    uint32_t median_time_past;
+    uint64_t value;
+
+    if (!(fields >> encoded_hash >> index >> height >> coinbase >> median_time_past
+        >> value >> encoded_script))
+        return false;
+
+    hash_digest digest;
+    data_chunk encoded;
+
+    if (!decode_hash(digest, encoded_hash) ||
+        !decode_base16(encoded, encoded_script))
+        return false;
+
+    out = output_point(digest, index);
+    auto& metadata = *out.metadata;
+    metadata.confirmed = true;
+    metadata.coinbase = coinbase != 0;
+    metadata.height = height;
+    metadata.median_time_past = median_time_past;
+    metadata.cache = output(value, script(encoded, false));
+    return true;
+}
+
+bool read_corpus(corpus& out, const std::string& path)
+{
+    bc::ifstream file(path);
+
+    if (!file.good())
+        return false;
+
+    out.clear();
+    std::string line;
+
+    while (std::getline(file, line))
+    {
+        if (line.empty() || line.front() == '#')
+            continue;
+
+        std::istringstream fields(line);
+        std::string kind;
+        fields >> kind;
+
+        if (kind == "block")
+        {
+            corpus_block block;
+            std::string encoded;
+
+            if (!(fields >> block.height >> encoded) ||
+                !decode_base16(block.data, encoded))
+                return false;
+
+            out.push_back(std::move(block));
+        }
+        else if (kind == "prevout")
+        {
+            output_point prevout;
+
+            if (out.empty() || !read_prevout(prevout, fields))
+                return false;
+
+            out.back().prevouts.push_back(std::move(prevout));
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    for (auto& block: out)
+    {
+        auto& prevouts = block.prevouts;
+        std::sort(prevouts.begin(), prevouts.end());
+        prevouts.erase(std::unique(prevouts.begin(), prevouts.end()),
+            prevouts.end());
+    }
+
+    return true;
+}
+
+corpus_source::corpus_source(const output_point::list& prevouts)
+  : prevouts_(prevouts)
+{
+}
+
+code corpus_source::populate(const output_point::list& points)
+{
+    for (const auto& point: points)
+    {
+        const auto it = std::lower_bound(prevouts_.begin(), prevouts_.end(),
+            point);
+
+        if (it != prevouts_.end() && *it == point)
+            point.metadata = it->metadata;
+        else
+            point.metadata = output_point::validation{};
+    }
+
+    return error::success;
+}
+
+} // namespace bench
+} // namespace libbitcoin
@@ -0,0 +1,69 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_BENCH_CORPUS_HPP
+#define LIBBITCOIN_BENCH_CORPUS_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+
+namespace libbitcoin {
+namespace bench {
+
+/// A block of the corpus with the previous outputs spent by its inputs.
+struct corpus_block
+{
+    size_t height;
+    data_chunk data;
+
+    /// Sorted and distinct, each with its metadata populated.
+    chain::output_point::list prevouts;
+};
+
+typedef std::vector<corpus_block> corpus;
+
+/// Read a corpus file, false if it cannot be opened or is malformed.
+/// Each line is a record of whitespace separated fields, a block:
+///   block <height> <block-base16>
+/// followed by a line for each previous output spent by the block:
+///   prevout <hash> <index> <height> <coinbase> <mtp> <value> <script-base16>
+/// where hash is in display (reversed) order, coinbase is 0 or 1, mtp is the
+/// median time past of the previous output's block and value is in satoshi.
+/// Empty lines and lines starting with '#' are ignored.
+bool read_corpus(corpus& out, const std::string& path);
+
+/// The previous outputs of a corpus block, as a source for population.
+class corpus_source
+  : public chain::prevout_source
+{
+public:
+    corpus_source(const chain::output_point::list& prevouts);
+
+    /// Points not in the corpus are left not found.
+    code populate(const chain::output_point::list& points) override;
+
+private:
+    const chain::output_point::list& prevouts_;
+};
+
+} // namespace bench
+} // namespace libbitcoin
+
+#endif
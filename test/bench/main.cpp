@@ -0,0 +1,89 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cstddef>
+#include <cstdlib>
+#include <string>
+#include <bitcoin/bitcoin.hpp>
+#include "bench.hpp"
+
+BC_USE_LIBBITCOIN_MAIN
+
+using namespace bc;
+using namespace bc::bench;
+
+// Write the median results of each benchmark over the iterations as json.
+// With --counters the blocks and scripts benchmarks also report hardware
+// event counts, where the platform permits.
+static const auto usage =
+    "Usage: libbitcoin-bench [--counters] blocks <corpus-file> [iterations]\n"
+    "       libbitcoin-bench replay <capture-file> [iterations] [threads]\n"
+    "       libbitcoin-bench [--counters] scripts [iterations]\n"
+    "       libbitcoin-bench threads [iterations] [threads]";
+
+static const size_t default_iterations = 10;
+
+int bc::main(int argc, char* argv[])
+{
+    set_utf8_stdio();
+
+    // The counters option precedes the command.
+    const auto counted = argc > 1 && std::string(argv[1]) == "--counters";
+
+    if (counted)
+    {
+        --argc;
+        ++argv;
+
+        if (!event_counters(true).available())
+            bc::cerr << "Hardware event counters are unavailable."
+                << std::endl;
+    }
+
+    const std::string command(argc > 1 ? argv[1] : "");
+    const auto blocks = command == "blocks";
+    const auto replay = command == "replay";
+    const auto threaded = command == "threads";
+    const auto scripts = command == "scripts";
+    const auto arguments = blocks || replay ? 3 : 2;
+    const auto optional = replay || threaded ? 2 : 1;
+
+    if ((!blocks && !replay && !threaded && !scripts) ||
+        (counted && !blocks && !scripts) ||
+        argc < arguments || argc > arguments + optional)
+    {
+        bc::cerr << usage << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const size_t iterations = argc > arguments ?
+        std::stoul(argv[arguments]) : default_iterations;
+
+    // Replay is serial by default, threads scale to the cores by default.
+    const size_t threads = argc > arguments + 1 ?
+        std::stoul(argv[arguments + 1]) : 0;
+
+    const auto success = blocks ?
+        bench_blocks(bc::cout, bc::cerr, argv[2], iterations, counted) :
+        replay ?
+        bench_replay(bc::cout, bc::cerr, argv[2], iterations, threads) :
+        threaded ? bench_threads(bc::cout, iterations, threads) :
+        bench_scripts(bc::cout, iterations, counted);
+
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
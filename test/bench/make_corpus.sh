@@ -0,0 +1,53 @@
+#!/bin/bash
+###############################################################################
+#  Copyright (c) 2014-2015 libbitcoin developers (see COPYING).
+#
+###############################################################################
+# Write a libbitcoin-bench corpus of the mainnet blocks at the given heights,
+# for use as: libbitcoin-bench blocks <corpus-file> [iterations]
+#
+# Requires jq and a bitcoin-cli connected to a synced (unpruned) node of
+# version 25 or later, for the prevouts of getblock verbosity 3.
+#
+# Usage: make_corpus.sh <height>... > corpus.txt
+#
+# A representative corpus spans eras of the chain, for example:
+#   make_corpus.sh 100000 200000 300000 400000 500000 600000 700000 800000
+
+set -e
+
+BITCOIN_CLI=${BITCOIN_CLI:-bitcoin-cli}
+
+declare -A MEDIAN_TIMES
+
+# Set MTP to the median time past of the block at the height (cached).
+median_time()
+{
+    local HEIGHT=$1
+    if [[ -z "${MEDIAN_TIMES[$HEIGHT]}" ]]; then
+        local HASH=$($BITCOIN_CLI getblockhash "$HEIGHT")
+        MEDIAN_TIMES[$HEIGHT]=$($BITCOIN_CLI getblockheader "$HASH" | jq '.mediantime')
+    fi
+    MTP=${MEDIAN_TIMES[$HEIGHT]}
+}
+
+if [[ $# -eq 0 ]]; then
+    echo "Usage: make_corpus.sh <height>..." >&2
+    exit 1
+fi
+
+echo "# libbitcoin-bench corpus, mainnet heights: $*"
+
+for HEIGHT in "$@"; do
+    HASH=$($BITCOIN_CLI getblockhash "$HEIGHT")
+    echo "block $HEIGHT $($BITCOIN_CLI getblock "$HASH" 0)"
+
+    # txid vout height generated satoshi script, for each non-coinbase input.
+    while IFS=$'\t' read -r TXID INDEX PREVOUT_HEIGHT COINBASE VALUE SCRIPT; do
+        median_time "$PREVOUT_HEIGHT"
+        echo "prevout $TXID $INDEX $PREVOUT_HEIGHT $COINBASE $MTP $VALUE $SCRIPT"
+    done < <($BITCOIN_CLI getblock "$HASH" 3 | jq -r '.tx[1:][].vin[] |
+        [.txid, .vout, .prevout.height, (if .prevout.generated then 1 else 0 end),
+        (.prevout.value * 100000000 | round), .prevout.scriptPubKey.hex] |
+        @tsv')
+done
@@ -0,0 +1,276 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "bench.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+
+namespace libbitcoin {
+namespace bench {
+
+using namespace bc::chain;
+
+// Each captured block is replayed through check, accept and connect under
+// its captured chain state and previous outputs, serially or on a pool, and
+// the median duration of each stage (and of its timed parts) is reported.
+
+enum replay_stage
+{
+    replay_rebuild,
+    replay_check,
+    replay_accept,
+    replay_connect,
+    replay_stages
+};
+
+static const char* replay_names[replay_stages]
+{
+    "rebuild",
+    "check",
+    "accept",
+    "connect"
+};
+
+enum timing_part
+{
+    part_merkle_root,
+    part_coinbase,
+    part_double_spend,
+    part_sigops,
+    part_finality,
+    part_connect,
+    part_signatures,
+    parts
+};
+
+static const char* part_names[parts]
+{
+    "merkle_root",
+    "coinbase",
+    "double_spend",
+    "sigops",
+    "finality",
+    "inputs",
+    "signatures"
+};
+
+struct replay_result
+{
+    hash_digest hash;
+    size_t height;
+    size_t size;
+    size_t transactions;
+    size_t inputs;
+    code ec;
+    samples durations[replay_stages];
+    samples timings[parts];
+};
+
+static void record(replay_result& out, const validation_timing& timing)
+{
+    const validation_timing::duration values[parts]
+    {
+        timing.merkle_root,
+        timing.coinbase,
+        timing.double_spend,
+        timing.sigops,
+        timing.finality,
+        timing.connect,
+        timing.signatures
+    };
+
+    for (size_t part = 0; part < parts; ++part)
+        out.timings[part].push_back(values[part].count());
+}
+
+static code replay(replay_result& out, const validation_capture& capture,
+    const settings& settings, threadpool* pool)
+{
+    block block;
+    auto start = asio::steady_clock::now();
+
+    if (!capture.to_block(block))
+        return error::bad_stream;
+
+    const auto state = capture.to_state(settings);
+    out.durations[replay_rebuild].push_back(elapsed(start));
+
+    validation_timing timing;
+    block.metadata.timing = &timing;
+
+    code ec;
+    start = asio::steady_clock::now();
+
+    if ((ec = pool == nullptr ?
+        block.check(settings.max_money(), settings.timestamp_limit_seconds,
+            settings.proof_of_work_limit) :
+        block.check(settings.max_money(), settings.timestamp_limit_seconds,
+            settings.proof_of_work_limit, *pool)))
+        return ec;
+
+    out.durations[replay_check].push_back(elapsed(start));
+    start = asio::steady_clock::now();
+
+    if ((ec = pool == nullptr ? block.accept(*state, settings) :
+        block.accept(*state, settings, *pool)))
+        return ec;
+
+    out.durations[replay_accept].push_back(elapsed(start));
+    start = asio::steady_clock::now();
+
+    if ((ec = pool == nullptr ? block.connect(*state) :
+        block.connect(*state, *pool)))
+        return ec;
+
+    out.durations[replay_connect].push_back(elapsed(start));
+    record(out, timing);
+
+    out.hash = block.hash();
+    out.height = state->height();
+    out.size = capture.block_data().size();
+    out.transactions = block.transactions().size();
+    out.inputs = capture.previous_outputs().size();
+    return error::success;
+}
+
+static void write_json(std::ostream& out, const std::string& path,
+    size_t iterations, size_t threads,
+    const std::vector<replay_result>& results)
+{
+    uint64_t totals[replay_stages] = {};
+
+    out << "{" << std::endl;
+    out << "  \"captures\": \"" << path << "\"," << std::endl;
+    out << "  \"iterations\": " << iterations << "," << std::endl;
+    out << "  \"threads\": " << threads << "," << std::endl;
+    out << "  \"blocks\": [" << std::endl;
+
+    for (size_t index = 0; index < results.size(); ++index)
+    {
+        const auto& result = results[index];
+        out << "    { \"height\": " << result.height
+            << ", \"hash\": \"" << encode_hash(result.hash)
+            << "\", \"size\": " << result.size
+            << ", \"transactions\": " << result.transactions
+            << ", \"inputs\": " << result.inputs;
+
+        if (result.ec)
+            out << ", \"error\": \"" << result.ec.message() << "\"";
+
+        for (size_t stage = 0; stage < replay_stages; ++stage)
+        {
+            const auto value = median(result.durations[stage]);
+            totals[stage] += value;
+            out << ", \"" << replay_names[stage] << "_ns\": " << value;
+        }
+
+        for (size_t part = 0; part < parts; ++part)
+            out << ", \"" << part_names[part] << "_ns\": "
+                << median(result.timings[part]);
+
+        out << " }" << (index + 1 < results.size() ? "," : "") << std::endl;
+    }
+
+    out << "  ]," << std::endl;
+    out << "  \"totals\": {";
+
+    for (size_t stage = 0; stage < replay_stages; ++stage)
+        out << (stage == 0 ? " " : ", ") << "\"" << replay_names[stage]
+            << "_ns\": " << totals[stage];
+
+    out << " }" << std::endl;
+    out << "}" << std::endl;
+}
+
+// Captures are concatenated in the file, which is read to its end.
+static bool read_captures(std::vector<validation_capture>& out,
+    const std::string& path)
+{
+    bc::ifstream file(path, std::ifstream::in | std::ifstream::binary);
+
+    if (!file.good())
+        return false;
+
+    out.clear();
+
+    while (file.peek() != std::ifstream::traits_type::eof())
+    {
+        out.push_back(validation_capture::factory(file));
+
+        if (!out.back().is_valid())
+            return false;
+    }
+
+    return !out.empty();
+}
+
+bool bench_replay(std::ostream& out, std::ostream& error,
+    const std::string& path, size_t iterations, size_t threads)
+{
+    std::vector<validation_capture> captures;
+
+    if (!read_captures(captures, path))
+    {
+        error << "Invalid captures: " << path << std::endl;
+        return false;
+    }
+
+    // Zero threads replays serially on the calling thread.
+    std::shared_ptr<threadpool> pool;
+
+    if (threads > 0)
+        pool = std::make_shared<threadpool>(threads);
+
+    const settings settings(config::settings::mainnet);
+    std::vector<replay_result> results(captures.size());
+    auto failed = false;
+
+    for (size_t index = 0; index < captures.size(); ++index)
+    {
+        auto& result = results[index];
+        result.hash = null_hash;
+        result.height = captures[index].values().height;
+        result.size = captures[index].block_data().size();
+        result.transactions = 0;
+        result.inputs = 0;
+
+        // A block that fails is reported, as its timings are not comparable.
+        for (size_t count = 0; count < iterations && !result.ec; ++count)
+            result.ec = replay(result, captures[index], settings, pool.get());
+
+        failed |= static_cast<bool>(result.ec);
+    }
+
+    if (pool)
+    {
+        pool->shutdown();
+        pool->join();
+    }
+
+    write_json(out, path, iterations, threads, results);
+    return !failed;
+}
+
+} // namespace bench
+} // namespace libbitcoin
@@ -0,0 +1,297 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "bench.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+
+namespace libbitcoin {
+namespace bench {
+
+using namespace bc::chain;
+using namespace bc::machine;
+
+// Each case spends a single output of a synthetic transaction. The previous
+// output script is evaluated by interpreter::run (following the input script)
+// and the input is verified by script::verify, with the median duration and
+// allocation count of each reported. Hardware event counts, if counted, are
+// reported per script operation of the run and per verify.
+
+static const uint64_t case_value = 100000;
+
+// Under the limit of 201 counted operations per script.
+static const size_t hash_count = 100;
+static const size_t shuffle_count = 30;
+static const size_t nesting_depth = 100;
+
+struct script_case
+{
+    std::string name;
+    transaction tx;
+    script prevout_script;
+};
+
+struct script_result
+{
+    const script_case* source;
+    size_t operations;
+    code ec;
+    samples run_durations;
+    samples run_allocations;
+    samples verify_durations;
+    samples verify_allocations;
+    event_samples run_events;
+    event_samples verify_events;
+};
+
+static ec_secret make_secret(uint8_t index)
+{
+    return sha256_hash(data_chunk{ index });
+}
+
+static ec_compressed make_point(const ec_secret& secret)
+{
+    ec_compressed point;
+    secret_to_public(point, secret);
+    return point;
+}
+
+static transaction make_transaction(const script& input_script)
+{
+    const output_point spent{ sha256_hash(data_chunk{}), 0 };
+    return
+    {
+        1, 0,
+        { { spent, input_script, max_input_sequence } },
+        { { case_value, {} } }
+    };
+}
+
+// The endorsements of the secrets are pushed after the prefix operations.
+static script_case make_case(const std::string& name,
+    const script& prevout_script, const std::vector<ec_secret>& secrets,
+    operation::list&& prefix)
+{
+    auto tx = make_transaction({});
+    auto ops = std::move(prefix);
+
+    for (const auto& secret: secrets)
+    {
+        endorsement endorsement;
+        script::create_endorsement(endorsement, secret, prevout_script, tx,
+            0, sighash_algorithm::all);
+        ops.emplace_back(std::move(endorsement));
+    }
+
+    return { name, make_transaction(script(std::move(ops))), prevout_script };
+}
+
+static script_case make_unsigned_case(const std::string& name,
+    operation::list&& ops)
+{
+    return { name, make_transaction({}), script(std::move(ops)) };
+}
+
+static std::vector<script_case> make_cases()
+{
+    std::vector<script_case> cases;
+    const auto secret = make_secret(0);
+    const auto point = make_point(secret);
+
+    // op_check_sig.
+    cases.push_back(make_case("pay_key",
+        script::to_pay_public_key_pattern(point), { secret }, {}));
+
+    // op_dup, op_hash160, op_equalverify and op_check_sig.
+    cases.push_back(make_case("pay_key_hash",
+        script::to_pay_key_hash_pattern(bitcoin_short_hash(point)),
+        { secret }, { { to_chunk(point) } }));
+
+    // op_check_multisig, m of m for m in [1, 15].
+    for (uint8_t count = 1; count <= 15; ++count)
+    {
+        std::vector<ec_secret> secrets;
+        point_list points;
+
+        for (uint8_t index = 0; index < count; ++index)
+        {
+            secrets.push_back(make_secret(index));
+            points.push_back(make_point(secrets.back()));
+        }
+
+        const auto name = "check_multisig_" + std::to_string(count) + "_of_" +
+            std::to_string(count);
+
+        // The dummy value precedes the endorsements, in key order.
+        cases.push_back(make_case(name,
+            script::to_pay_multisig_pattern(count, points), secrets,
+            { { opcode::push_size_0 } }));
+    }
+
+    // op_hash160 repeated over its own result.
+    operation::list hashes{ { data_chunk(32, 0x42) } };
+
+    for (size_t count = 0; count < hash_count; ++count)
+        hashes.emplace_back(opcode::hash160);
+
+    cases.push_back(make_unsigned_case("hash160", std::move(hashes)));
+
+    // Stack shuffles that leave the stack as they find it.
+    operation::list shuffles
+    {
+        { opcode::push_positive_1 },
+        { opcode::push_positive_2 },
+        { opcode::push_positive_3 }
+    };
+
+    for (size_t count = 0; count < shuffle_count; ++count)
+    {
+        shuffles.emplace_back(opcode::rot);
+        shuffles.emplace_back(opcode::swap);
+        shuffles.emplace_back(opcode::over);
+        shuffles.emplace_back(opcode::drop);
+        shuffles.emplace_back(opcode::dup);
+        shuffles.emplace_back(opcode::nip);
+    }
+
+    cases.push_back(make_unsigned_case("stack_shuffle", std::move(shuffles)));
+
+    // Nested op_if, each branch taken.
+    operation::list nested;
+
+    for (size_t count = 0; count < nesting_depth; ++count)
+    {
+        nested.emplace_back(opcode::push_positive_1);
+        nested.emplace_back(opcode::if_);
+    }
+
+    nested.emplace_back(opcode::push_positive_1);
+
+    for (size_t count = 0; count < nesting_depth; ++count)
+        nested.emplace_back(opcode::endif);
+
+    cases.push_back(make_unsigned_case("nested_if", std::move(nested)));
+    return cases;
+}
+
+static code run(script_result& out, const script_case& source,
+    event_counters& counters)
+{
+    const auto& tx = source.tx;
+    const auto& prevout_script = source.prevout_script;
+
+    program input(tx.inputs().front().script(), tx, 0, mainnet_forks);
+    auto ec = interpreter::run(input);
+
+    if (ec)
+        return ec;
+
+    auto allocated = allocations();
+    counters.start();
+    auto start = asio::steady_clock::now();
+    program prevout(prevout_script, input);
+    ec = interpreter::run(prevout);
+    out.run_durations.push_back(elapsed(start));
+    counters.stop(out.run_events);
+    out.run_allocations.push_back(allocations() - allocated);
+
+    if (ec)
+        return ec;
+
+    if (!prevout.stack_result(false))
+        return error::stack_false;
+
+    allocated = allocations();
+    counters.start();
+    start = asio::steady_clock::now();
+    ec = script::verify(tx, 0, mainnet_forks, prevout_script, case_value);
+    out.verify_durations.push_back(elapsed(start));
+    counters.stop(out.verify_events);
+    out.verify_allocations.push_back(allocations() - allocated);
+    return ec;
+}
+
+static void write_json(std::ostream& out, size_t iterations,
+    const std::vector<script_result>& results)
+{
+    out << "{" << std::endl;
+    out << "  \"iterations\": " << iterations << "," << std::endl;
+    out << "  \"scripts\": [" << std::endl;
+
+    for (size_t index = 0; index < results.size(); ++index)
+    {
+        const auto& result = results[index];
+        const auto run_ns = median(result.run_durations);
+        const auto operations = result.operations;
+
+        out << "    { \"name\": \"" << result.source->name
+            << "\", \"operations\": " << operations;
+
+        if (result.ec)
+            out << ", \"error\": \"" << result.ec.message() << "\"";
+
+        out << ", \"run_ns\": " << run_ns
+            << ", \"run_ns_per_operation\": "
+            << (operations == 0 ? 0 : run_ns / operations)
+            << ", \"run_allocations\": " << median(result.run_allocations)
+            << ", \"verify_ns\": " << median(result.verify_durations)
+            << ", \"verify_allocations\": "
+            << median(result.verify_allocations);
+
+        write_events(out, "run", result.run_events, operations);
+        write_events(out, "verify", result.verify_events, 1);
+
+        out << " }" << (index + 1 < results.size() ? "," : "") << std::endl;
+    }
+
+    out << "  ]" << std::endl;
+    out << "}" << std::endl;
+}
+
+bool bench_scripts(std::ostream& out, size_t iterations, bool counted)
+{
+    const auto cases = make_cases();
+    event_counters counters(counted);
+    std::vector<script_result> results(cases.size());
+    auto failed = false;
+
+    for (size_t index = 0; index < cases.size(); ++index)
+    {
+        const auto& source = cases[index];
+        auto& result = results[index];
+        result.source = &source;
+        result.operations = source.prevout_script.operations().size() +
+            source.tx.inputs().front().script().operations().size();
+
+        for (size_t count = 0; count < iterations && !result.ec; ++count)
+            result.ec = run(result, source, counters);
+
+        failed |= static_cast<bool>(result.ec);
+    }
+
+    write_json(out, iterations, results);
+    return !failed;
+}
+
+} // namespace bench
+} // namespace libbitcoin
@@ -0,0 +1,313 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "bench.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+
+namespace libbitcoin {
+namespace bench {
+
+// Each case hands off jobs from the calling thread to a pool and records the
+// latency from handoff to invocation of each job. The rate is the number of
+// jobs (or notifications) completed per second of the whole case.
+
+typedef std::function<void()> job;
+typedef std::function<void(job&&)> handoff;
+
+// The jobs handed off per iteration of each case.
+static const size_t jobs_per_iteration = 1000;
+
+// The subscription counts of the relay fan-out cases.
+static const size_t subscriber_counts[] = { 10, 1000, 100000 };
+
+// Deadlines are canceled long before they could expire.
+static const asio::duration deadline_duration = asio::seconds(60);
+
+struct thread_result
+{
+    std::string name;
+    size_t threads;
+    size_t operations;
+    uint64_t elapsed_ns;
+    samples latencies;
+    code ec;
+};
+
+static void wait(const std::atomic<size_t>& pending)
+{
+    while (pending.load(std::memory_order_acquire) != 0)
+        std::this_thread::yield();
+}
+
+// The thread counts, doubling from one up to and including the maximum.
+static std::vector<size_t> scale(size_t maximum)
+{
+    std::vector<size_t> counts;
+
+    for (size_t count = 1; count < maximum; count *= 2)
+        counts.push_back(count);
+
+    counts.push_back(std::max(maximum, size_t(1)));
+    return counts;
+}
+
+static thread_result measure(const std::string& name, size_t threads,
+    size_t iterations, handoff post)
+{
+    const auto operations = iterations * jobs_per_iteration;
+    thread_result result{ name, threads, operations, 0, samples(operations),
+        error::success };
+
+    auto& latencies = result.latencies;
+    std::atomic<size_t> pending(operations);
+    const auto start = asio::steady_clock::now();
+
+    for (size_t index = 0; index < operations; ++index)
+    {
+        const auto posted = asio::steady_clock::now();
+        post([&latencies, &pending, index, posted]()
+        {
+            latencies[index] = elapsed(posted);
+            pending.fetch_sub(1, std::memory_order_release);
+        });
+    }
+
+    wait(pending);
+    result.elapsed_ns = elapsed(start);
+    return result;
+}
+
+static thread_result bench_threadpool(size_t threads, size_t iterations)
+{
+    threadpool pool(threads);
+    auto& service = pool.service();
+
+    const auto result = measure("threadpool_post", threads, iterations,
+        [&service](job&& handler)
+        {
+            service.post(std::move(handler));
+        });
+
+    pool.shutdown();
+    pool.join();
+    return result;
+}
+
+static std::vector<thread_result> bench_dispatcher(size_t threads,
+    size_t iterations)
+{
+    threadpool pool(threads);
+    dispatcher dispatch(pool, "bench");
+    std::vector<thread_result> results;
+
+    results.push_back(measure("dispatcher_ordered", threads, iterations,
+        [&dispatch](job&& handler)
+        {
+            dispatch.ordered(std::move(handler));
+        }));
+
+    results.push_back(measure("dispatcher_unordered", threads, iterations,
+        [&dispatch](job&& handler)
+        {
+            dispatch.unordered(std::move(handler));
+        }));
+
+    results.push_back(measure("dispatcher_concurrent", threads, iterations,
+        [&dispatch](job&& handler)
+        {
+            dispatch.concurrent(std::move(handler));
+        }));
+
+    pool.shutdown();
+    pool.join();
+    return results;
+}
+
+// Each job is a lock and unlock round trip through the sequencer.
+static thread_result bench_sequencer(size_t threads, size_t iterations)
+{
+    threadpool pool(threads);
+    const auto sequence = std::make_shared<sequencer>(pool.service());
+
+    const auto result = measure("sequencer_round_trip", threads, iterations,
+        [sequence](job&& handler)
+        {
+            sequence->lock([sequence, handler]()
+            {
+                handler();
+                sequence->unlock();
+            });
+        });
+
+    pool.shutdown();
+    pool.join();
+    return result;
+}
+
+// Each iteration subscribes the count of handlers and relays once, recording
+// the latency from relay to the last notification.
+static thread_result bench_subscriber(size_t threads, size_t iterations,
+    size_t count)
+{
+    typedef subscriber<code> code_subscriber;
+
+    threadpool pool(threads);
+    const auto subscribers = std::make_shared<code_subscriber>(pool,
+        "bench");
+
+    thread_result result{ "subscriber_relay_" + std::to_string(count),
+        threads, iterations * count, 0, {}, error::success };
+
+    subscribers->start();
+
+    for (size_t iteration = 0; iteration < iterations; ++iteration)
+    {
+        std::atomic<size_t> pending(count);
+
+        for (size_t index = 0; index < count; ++index)
+            subscribers->subscribe([&pending](const code&)
+            {
+                pending.fetch_sub(1, std::memory_order_release);
+            }, error::service_stopped);
+
+        const auto start = asio::steady_clock::now();
+        subscribers->relay(error::success);
+        wait(pending);
+
+        result.latencies.push_back(elapsed(start));
+        result.elapsed_ns += result.latencies.back();
+    }
+
+    subscribers->stop();
+    pool.shutdown();
+    pool.join();
+    return result;
+}
+
+// Each job arms its own deadline and cancels it, recording the latency from
+// arm to the canceled handler. An expired deadline is a failure.
+static thread_result bench_deadline(size_t threads, size_t iterations)
+{
+    threadpool pool(threads);
+    const auto operations = iterations * jobs_per_iteration;
+    std::vector<deadline::ptr> timers;
+    timers.reserve(operations);
+
+    for (size_t index = 0; index < operations; ++index)
+        timers.push_back(std::make_shared<deadline>(pool, deadline_duration));
+
+    std::atomic<bool> expired(false);
+    size_t next = 0;
+
+    auto result = measure("deadline_arm_cancel", threads, iterations,
+        [&timers, &expired, &next](job&& handler)
+        {
+            const auto& timer = timers[next++];
+            timer->start([&expired, handler](const code& ec)
+            {
+                if (!ec)
+                    expired.store(true);
+
+                handler();
+            });
+
+            timer->stop();
+        });
+
+    if (expired.load())
+        result.ec = error::operation_failed;
+
+    pool.shutdown();
+    pool.join();
+    return result;
+}
+
+static void write_json(std::ostream& out, size_t iterations,
+    const std::vector<thread_result>& results)
+{
+    out << "{" << std::endl;
+    out << "  \"iterations\": " << iterations << "," << std::endl;
+    out << "  \"cases\": [" << std::endl;
+
+    for (size_t index = 0; index < results.size(); ++index)
+    {
+        const auto& result = results[index];
+        const auto per_second = result.elapsed_ns == 0 ? 0 :
+            result.operations * 1000000000 / result.elapsed_ns;
+
+        out << "    { \"name\": \"" << result.name
+            << "\", \"threads\": " << result.threads
+            << ", \"operations\": " << result.operations;
+
+        if (result.ec)
+            out << ", \"error\": \"" << result.ec.message() << "\"";
+
+        out << ", \"p50_ns\": " << percentile(result.latencies, 50)
+            << ", \"p99_ns\": " << percentile(result.latencies, 99)
+            << ", \"operations_per_second\": " << per_second
+            << " }" << (index + 1 < results.size() ? "," : "") << std::endl;
+    }
+
+    out << "  ]" << std::endl;
+    out << "}" << std::endl;
+}
+
+bool bench_threads(std::ostream& out, size_t iterations, size_t threads)
+{
+    std::vector<thread_result> results;
+
+    for (const auto count: scale(thread_default(threads)))
+    {
+        results.push_back(bench_threadpool(count, iterations));
+
+        const auto dispatched = bench_dispatcher(count, iterations);
+        results.insert(results.end(), dispatched.begin(), dispatched.end());
+
+        results.push_back(bench_sequencer(count, iterations));
+
+        for (const auto subscriptions: subscriber_counts)
+            results.push_back(bench_subscriber(count, iterations,
+                subscriptions));
+
+        results.push_back(bench_deadline(count, iterations));
+    }
+
+    write_json(out, iterations, results);
+
+    const auto failed = [](const thread_result& result)
+    {
+        return static_cast<bool>(result.ec);
+    };
+
+    return std::none_of(results.begin(), results.end(), failed);
+}
+
+} // namespace bench
+} // namespace libbitcoin
@@ -17,6 +17,9 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <future>
 #include <bitcoin/bitcoin.hpp>
 
 using namespace bc;
@@ -267,6 +270,157 @@ BOOST_AUTO_TEST_CASE(block__from_data__insufficient_transaction_bytes__failure)
     BOOST_REQUIRE(!instance.is_valid());
 }
 
+static chain::block get_witness_block(size_t count)
+{
+    chain::transaction::list transactions;
+
+    for (uint32_t index = 0; index < count; ++index)
+    {
+        const chain::witness witness(data_stack{ { 0x42 }, { 0x01, 0x02 } });
+        const chain::input input({ null_hash, index }, {}, witness, 0);
+        const chain::output output(index,
+            chain::script(chain::script::to_pay_key_hash_pattern({})));
+        transactions.push_back({ 1, 0, { input }, { output } });
+    }
+
+    return { chain::header{}, std::move(transactions) };
+}
+
+BOOST_AUTO_TEST_CASE(block__from_data__threadpool_witness__matches_sequential)
+{
+    threadpool pool(4);
+    const auto data = get_witness_block(100).to_data(true);
+
+    chain::block expected;
+    chain::block instance;
+    BOOST_REQUIRE(expected.from_data(data, true));
+    BOOST_REQUIRE(instance.from_data(data, true, pool));
+    BOOST_REQUIRE(instance == expected);
+    BOOST_REQUIRE(instance.to_hashes(true) == expected.to_hashes(true));
+    BOOST_REQUIRE(instance.to_data(true) == data);
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(block__from_data__threadpool_strip_witness__matches_sequential)
+{
+    threadpool pool(4);
+    const auto data = get_witness_block(100).to_data(true);
+
+    chain::block expected;
+    chain::block instance;
+    BOOST_REQUIRE(expected.from_data(data, false));
+    BOOST_REQUIRE(instance.from_data(data, false, pool));
+    BOOST_REQUIRE(instance == expected);
+    BOOST_REQUIRE(instance.to_data(false) == expected.to_data(false));
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(block__from_data__encoding_witness__retains_encoding)
+{
+    const auto expected = get_witness_block(10);
+    const auto data = std::make_shared<const data_chunk>(expected.to_data(true));
+
+    chain::block instance;
+    BOOST_REQUIRE(instance.from_data(data, 0, true));
+    BOOST_REQUIRE(instance == expected);
+    BOOST_REQUIRE(instance.is_retained(true));
+    BOOST_REQUIRE(!instance.is_retained(false));
+    BOOST_REQUIRE(instance.to_data(true) == *data);
+    BOOST_REQUIRE(instance.to_data(false) == expected.to_data(false));
+    BOOST_REQUIRE_EQUAL(instance.serialized_size(true), data->size());
+    BOOST_REQUIRE_EQUAL(instance.serialized_size(false), expected.serialized_size(false));
+    BOOST_REQUIRE(instance.transactions().back().is_retained(true));
+    BOOST_REQUIRE(instance.to_hashes(true) == expected.to_hashes(true));
+}
+
+BOOST_AUTO_TEST_CASE(block__from_data__encoding_strip_witness__matches_sequential)
+{
+    const auto data = std::make_shared<const data_chunk>(
+        get_witness_block(10).to_data(true));
+
+    chain::block expected;
+    chain::block instance;
+    BOOST_REQUIRE(expected.from_data(*data, false));
+    BOOST_REQUIRE(instance.from_data(data, 0, false));
+    BOOST_REQUIRE(instance == expected);
+    BOOST_REQUIRE(!instance.is_retained(false));
+    BOOST_REQUIRE(instance.to_data(false) == expected.to_data(false));
+}
+
+BOOST_AUTO_TEST_CASE(block__from_data__encoding_offset__retains_encoding)
+{
+    const chain::block genesis = settings(bc::config::settings::mainnet).genesis_block;
+    const auto raw_block = genesis.to_data();
+    auto buffer = data_chunk{ 0x2a, 0x2a };
+    extend_data(buffer, raw_block);
+    const auto data = std::make_shared<const data_chunk>(std::move(buffer));
+
+    const auto instance = chain::block::factory(data, 2);
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(instance.is_retained(false));
+    BOOST_REQUIRE(instance.is_retained(true));
+    BOOST_REQUIRE(to_chunk(instance.encoding()) == raw_block);
+    BOOST_REQUIRE(instance.to_data() == raw_block);
+    BOOST_REQUIRE_EQUAL(instance.serialized_size(), raw_block.size());
+}
+
+BOOST_AUTO_TEST_CASE(block__from_data__encoding_truncated__failure)
+{
+    auto buffer = get_witness_block(10).to_data(true);
+    buffer.resize(buffer.size() - 1);
+    const auto data = std::make_shared<const data_chunk>(std::move(buffer));
+
+    chain::block instance;
+    BOOST_REQUIRE(!instance.from_data(data, 0, true));
+    BOOST_REQUIRE(!instance.is_valid());
+    BOOST_REQUIRE(instance.encoding().empty());
+}
+
+BOOST_AUTO_TEST_CASE(block__from_data__encoding_then_set_header__releases_encoding)
+{
+    const chain::block genesis = settings(bc::config::settings::mainnet).genesis_block;
+    const auto raw_block = genesis.to_data();
+    auto instance = chain::block::factory(
+        std::make_shared<const data_chunk>(raw_block));
+
+    auto header = instance.header();
+    header.set_nonce(header.nonce() + 1);
+    instance.set_header(header);
+    BOOST_REQUIRE(instance.encoding().empty());
+    BOOST_REQUIRE(instance.to_data() != raw_block);
+    BOOST_REQUIRE_EQUAL(instance.to_data().size(), raw_block.size());
+}
+
+BOOST_AUTO_TEST_CASE(block__from_data__threadpool_truncated__failure)
+{
+    threadpool pool(4);
+    auto data = get_witness_block(100).to_data(true);
+    data.resize(data.size() - 1);
+
+    chain::block instance;
+    BOOST_REQUIRE(!instance.from_data(data, true, pool));
+    BOOST_REQUIRE(!instance.is_valid());
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(block__from_data__threadpool_insufficient_transaction_bytes__failure)
+{
+    threadpool pool;
+    const data_chunk data = to_chunk(base16_literal(
+        "010000007f110631052deeee06f0754a3629ad7663e56359fd5f3aa7b3e30a00"
+        "000000005f55996827d9712147a8eb6d7bae44175fe0bcfa967e424a25bfe9f4"
+        "dc118244d67fb74c9d8e2f1bea5ee82a03010000000100000000000000000000"
+        "00000000000000000000000000000000000000000000ffffffff07049d8e2f1b"
+        "0114ffffffff0100f2052a0100000043410437b36a7221bc977dce712728a954"));
+
+    chain::block instance;
+    BOOST_REQUIRE(!instance.from_data(data, false, pool));
+    BOOST_REQUIRE(!instance.is_valid());
+}
+
 BOOST_AUTO_TEST_CASE(block__genesis__mainnet__valid_structure)
 {
     const chain::block genesis = settings(bc::config::settings::mainnet).genesis_block;
@@ -291,6 +445,42 @@ BOOST_AUTO_TEST_CASE(block__genesis__regtest__valid_structure)
     BOOST_REQUIRE(genesis.header().merkle() == genesis.generate_merkle_root());
 }
 
+BOOST_AUTO_TEST_CASE(block__subsidy__profiles__same_as_settings)
+{
+    static const size_t heights[] = { 0, 1, 149, 150, 300, 209999, 210000, 420000, 64 * 210000 };
+    const settings mainnet(bc::config::settings::mainnet);
+    const settings regtest(bc::config::settings::regtest);
+    const auto initial = mainnet.bitcoin_to_satoshi(mainnet.initial_block_subsidy_bitcoin());
+
+    for (const auto height: heights)
+    {
+        BOOST_REQUIRE_EQUAL(chain::block::subsidy<profiles::mainnet>(height), chain::block::subsidy(height, mainnet.subsidy_interval(), initial));
+        BOOST_REQUIRE_EQUAL(chain::block::subsidy<profiles::testnet>(height), chain::block::subsidy(height, mainnet.subsidy_interval(), initial));
+        BOOST_REQUIRE_EQUAL(chain::block::subsidy<profiles::regtest>(height), chain::block::subsidy(height, regtest.subsidy_interval(), initial));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(block__check__mainnet_profile_genesis__same_as_settings)
+{
+    const settings configuration(bc::config::settings::mainnet);
+    const chain::block genesis = configuration.genesis_block;
+    const auto expected = genesis.check(configuration.max_money(), configuration.timestamp_limit_seconds, configuration.proof_of_work_limit);
+    BOOST_REQUIRE_EQUAL(genesis.check<profiles::mainnet>(), expected);
+    BOOST_REQUIRE_EQUAL(genesis.header().check<profiles::mainnet>(), genesis.header().check(configuration.timestamp_limit_seconds, configuration.proof_of_work_limit));
+
+    threadpool pool(2);
+    BOOST_REQUIRE_EQUAL(genesis.check<profiles::mainnet>(pool), expected);
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(block__check__regtest_profile_mainnet_genesis__same_as_settings)
+{
+    const settings configuration(bc::config::settings::regtest);
+    const chain::block genesis = settings(bc::config::settings::mainnet).genesis_block;
+    BOOST_REQUIRE_EQUAL(genesis.check<profiles::regtest>(), genesis.check(configuration.max_money(), configuration.timestamp_limit_seconds, configuration.proof_of_work_limit));
+}
+
 
 BOOST_AUTO_TEST_CASE(block__factory_1__genesis_mainnet__success)
 {
@@ -355,6 +545,22 @@ BOOST_AUTO_TEST_CASE(block__factory_3__genesis_mainnet__success)
     BOOST_REQUIRE(genesis.header().merkle() == block.generate_merkle_root());
 }
 
+BOOST_AUTO_TEST_CASE(block__heap_size__default__zero)
+{
+    chain::block instance;
+    BOOST_REQUIRE_EQUAL(instance.heap_size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(block__heap_size__transactions__includes_transactions)
+{
+    const chain::transaction tx{ 1, 0, { { { null_hash, 0 }, {}, 0 } }, { { 1, {} } } };
+    chain::block instance;
+    instance.set_transactions({ tx, tx });
+    const auto& txs = instance.transactions();
+    BOOST_REQUIRE_EQUAL(instance.heap_size(), txs.capacity() * sizeof(chain::transaction) +
+        txs[0].heap_size() + txs[1].heap_size());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(block_generate_merkle_root_tests)
@@ -714,4 +920,554 @@ BOOST_AUTO_TEST_CASE(block__is_forward_reference__forward_reference__true)
 
 BOOST_AUTO_TEST_SUITE_END()
 
+BOOST_AUTO_TEST_SUITE(block_is_internal_double_spend_tests)
+
+BOOST_AUTO_TEST_CASE(block__is_internal_double_spend__no_transactions__false)
+{
+    chain::block value;
+    BOOST_REQUIRE(!value.is_internal_double_spend());
+}
+
+BOOST_AUTO_TEST_CASE(block__is_internal_double_spend__distinct_spends__false)
+{
+    const auto hash = bitcoin_hash(to_chunk(std::string("previous")));
+    chain::transaction coinbase{ 1, 0, { { { null_hash, chain::point::null_index }, {}, 0 } }, {} };
+    chain::transaction first{ 1, 0, { { { hash, 0 }, {}, 0 }, { { hash, 1 }, {}, 0 } }, {} };
+    chain::transaction second{ 1, 0, { { { hash, 2 }, {}, 0 } }, {} };
+    chain::block value;
+    value.set_transactions({ coinbase, first, second });
+    BOOST_REQUIRE(!value.is_internal_double_spend());
+}
+
+BOOST_AUTO_TEST_CASE(block__is_internal_double_spend__spent_across_transactions__true)
+{
+    const auto hash = bitcoin_hash(to_chunk(std::string("previous")));
+    chain::transaction coinbase{ 1, 0, { { { null_hash, chain::point::null_index }, {}, 0 } }, {} };
+    chain::transaction first{ 1, 0, { { { hash, 0 }, {}, 0 }, { { hash, 1 }, {}, 0 } }, {} };
+    chain::transaction second{ 2, 0, { { { hash, 1 }, {}, 0 } }, {} };
+    chain::block value;
+    value.set_transactions({ coinbase, first, second });
+    BOOST_REQUIRE(value.is_internal_double_spend());
+}
+
+BOOST_AUTO_TEST_CASE(block__is_internal_double_spend__spent_within_transaction__true)
+{
+    const auto hash = bitcoin_hash(to_chunk(std::string("previous")));
+    chain::transaction coinbase{ 1, 0, { { { null_hash, chain::point::null_index }, {}, 0 } }, {} };
+    chain::transaction first{ 1, 0, { { { hash, 3 }, {}, 0 }, { { hash, 3 }, {}, 0 } }, {} };
+    chain::block value;
+    value.set_transactions({ coinbase, first });
+    BOOST_REQUIRE(value.is_internal_double_spend());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(block_check_internal_spends_tests)
+
+// Test helper.
+static chain::block make_spending_block(size_t transactions, size_t inputs)
+{
+    const auto hash = bitcoin_hash(to_chunk(std::string("previous")));
+    chain::transaction::list txs
+    {
+        { 1, 0, { { { null_hash, chain::point::null_index }, {}, 0 } }, {} }
+    };
+
+    uint32_t index = 0;
+
+    for (size_t tx = 0; tx < transactions; ++tx)
+    {
+        chain::input::list spends;
+
+        for (size_t input = 0; input < inputs; ++input)
+            spends.push_back({ { hash, index++ }, {}, 0 });
+
+        txs.push_back({ 1, 0, std::move(spends), {} });
+    }
+
+    chain::block value;
+    value.set_transactions(std::move(txs));
+    return value;
+}
+
+BOOST_AUTO_TEST_CASE(block__check_internal_spends__no_transactions__success)
+{
+    chain::block value;
+    BOOST_REQUIRE_EQUAL(value.check_internal_spends(), error::success);
+}
+
+BOOST_AUTO_TEST_CASE(block__check_internal_spends__forward_reference__forward_reference)
+{
+    chain::block value;
+    chain::transaction after{ 2, 0, {}, {} };
+    chain::transaction before{ 1, 0, { { { after.hash(), 0 }, {}, 0 } }, {} };
+    value.set_transactions({ before, after });
+    BOOST_REQUIRE_EQUAL(value.check_internal_spends(), error::forward_reference);
+}
+
+BOOST_AUTO_TEST_CASE(block__check_internal_spends__duplicate_after_reference__forward_reference)
+{
+    chain::block value;
+    chain::transaction duplicate{ 2, 0, {}, {} };
+    chain::transaction between{ 1, 0, { { { duplicate.hash(), 0 }, {}, 0 } }, {} };
+    value.set_transactions({ duplicate, between, duplicate });
+    BOOST_REQUIRE(value.is_forward_reference());
+    BOOST_REQUIRE_EQUAL(value.check_internal_spends(), error::forward_reference);
+}
+
+BOOST_AUTO_TEST_CASE(block__check_internal_spends__double_spend_then_forward__forward_reference)
+{
+    const auto hash = bitcoin_hash(to_chunk(std::string("previous")));
+    chain::transaction coinbase{ 1, 0, { { { null_hash, chain::point::null_index }, {}, 0 } }, {} };
+    chain::transaction last{ 9, 0, {}, {} };
+    chain::transaction first{ 1, 0, { { { hash, 0 }, {}, 0 }, { { hash, 0 }, {}, 0 } }, {} };
+    chain::transaction second{ 2, 0, { { { last.hash(), 0 }, {}, 0 } }, {} };
+    chain::block value;
+    value.set_transactions({ coinbase, first, second, last });
+    BOOST_REQUIRE_EQUAL(value.check_internal_spends(), error::forward_reference);
+}
+
+BOOST_AUTO_TEST_CASE(block__check_internal_spends__stress_distinct__success)
+{
+    const auto value = make_spending_block(200, 100);
+    BOOST_REQUIRE_EQUAL(value.total_non_coinbase_inputs(), 20000u);
+    BOOST_REQUIRE_EQUAL(value.check_internal_spends(), error::success);
+    BOOST_REQUIRE(!value.is_internal_double_spend());
+    BOOST_REQUIRE(!value.is_forward_reference());
+}
+
+BOOST_AUTO_TEST_CASE(block__check_internal_spends__stress_double_spend__double_spend)
+{
+    auto value = make_spending_block(200, 100);
+    auto txs = value.transactions();
+    const auto spent = txs[1].inputs().front().previous_output();
+    txs.push_back({ 1, 0, { { spent, {}, 0 } }, {} });
+    value.set_transactions(std::move(txs));
+    BOOST_REQUIRE_EQUAL(value.check_internal_spends(),
+        error::block_internal_double_spend);
+    BOOST_REQUIRE(value.is_internal_double_spend());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(block_connect_tests)
+
+static chain::chain_state::data get_connect_values()
+{
+    chain::chain_state::data values;
+    values.height = 1;
+    values.bits.ordered.push_back(0x1d00ffff);
+    values.version.ordered.push_back(1);
+    values.timestamp.ordered.push_back(1231006505);
+    values.timestamp.retarget = 0;
+    return values;
+}
+
+static chain::block get_connect_block(size_t inputs)
+{
+    const chain::transaction coinbase
+    {
+        1, 0, { { { null_hash, chain::point::null_index }, {}, 0 } }, {}
+    };
+
+    chain::input::list spends;
+
+    for (uint32_t index = 0; index < inputs; ++index)
+        spends.push_back({ { null_hash, index }, {}, 0 });
+
+    chain::block value;
+    value.set_transactions({ coinbase, { 1, 0, std::move(spends), {} } });
+    return value;
+}
+
+BOOST_AUTO_TEST_CASE(block__connect__empty_threadpool_missing_prevouts__missing_previous_output)
+{
+    threadpool pool;
+    const settings settings(config::settings::mainnet);
+    const chain::chain_state state(get_connect_values(), chain::chain_state::checkpoints{}, 0, 0, settings);
+    const auto value = get_connect_block(10);
+    BOOST_REQUIRE_EQUAL(value.connect(state, pool).value(), error::missing_previous_output);
+}
+
+BOOST_AUTO_TEST_CASE(block__connect__threadpool_missing_prevouts__missing_previous_output)
+{
+    threadpool pool(4);
+    const settings settings(config::settings::mainnet);
+    const chain::chain_state state(get_connect_values(), chain::chain_state::checkpoints{}, 0, 0, settings);
+    const auto value = get_connect_block(100);
+    BOOST_REQUIRE_EQUAL(value.connect(state, pool).value(), error::missing_previous_output);
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(block__connect__threadpool_coinbase_only__success)
+{
+    threadpool pool(4);
+    const settings settings(config::settings::mainnet);
+    const chain::chain_state state(get_connect_values(), chain::chain_state::checkpoints{}, 0, 0, settings);
+    auto value = get_connect_block(0);
+    value.set_transactions({ value.transactions().front() });
+    BOOST_REQUIRE_EQUAL(value.connect(state, pool).value(), error::success);
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(block__connect__timing_attached__records_inputs)
+{
+    const settings settings(config::settings::mainnet);
+    const chain::chain_state state(get_connect_values(), chain::chain_state::checkpoints{}, 0, 0, settings);
+    const auto value = get_connect_block(10);
+    chain::validation_timing timing;
+    value.metadata.timing = &timing;
+    BOOST_REQUIRE_EQUAL(value.connect(state).value(), error::missing_previous_output);
+    BOOST_REQUIRE_EQUAL(timing.input_count, 10u);
+    BOOST_REQUIRE_EQUAL(timing.signature_count, 0u);
+    BOOST_REQUIRE(timing.connect > chain::validation_timing::duration::zero());
+}
+
+BOOST_AUTO_TEST_CASE(block__connect__threadpool_timing_attached__records_inputs)
+{
+    threadpool pool(4);
+    const settings settings(config::settings::mainnet);
+    const chain::chain_state state(get_connect_values(), chain::chain_state::checkpoints{}, 0, 0, settings);
+    const auto value = get_connect_block(100);
+    chain::validation_timing timing;
+    value.metadata.timing = &timing;
+    BOOST_REQUIRE_EQUAL(value.connect(state, pool).value(), error::missing_previous_output);
+    BOOST_REQUIRE_EQUAL(timing.input_count, 100u);
+    BOOST_REQUIRE_EQUAL(timing.signature_count, 0u);
+    BOOST_REQUIRE(timing.connect > chain::validation_timing::duration::zero());
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(block__connect__threadpool_mixed_failures__first_failure_in_block_order)
+{
+    threadpool pool(4);
+    const settings settings(config::settings::mainnet);
+    const chain::chain_state state(get_connect_values(), chain::chain_state::checkpoints{}, 0, 0, settings);
+    const auto value = get_connect_block(100);
+
+    // The first input fails script verification, the remainder lack prevouts.
+    const auto& spend = value.transactions().back().inputs().front();
+    spend.previous_output().metadata->cache = { 0, {} };
+
+    const auto expected = value.connect(state);
+    BOOST_REQUIRE(expected);
+    BOOST_REQUIRE(expected.value() != error::missing_previous_output);
+    BOOST_REQUIRE_EQUAL(value.connect(state, pool).value(), expected.value());
+    pool.shutdown();
+    pool.join();
+}
+
+
+static const uint64_t parallel_max_money = 2100000000000000;
+
+static chain::block get_parallel_block(size_t count)
+{
+    // The coinbase script is the minimum valid size.
+    const chain::script coinbase_script(data_chunk{ 0x00, 0x00 }, false);
+    chain::transaction::list transactions
+    {
+        { 1, 0, { { { null_hash, chain::point::null_index }, coinbase_script, 0 } }, { { 1, {} } } }
+    };
+
+    for (uint32_t index = 1; index < count; ++index)
+        transactions.push_back({ index, 0, { { { null_hash, index }, {}, 0 } }, { { 1, {} } } });
+
+    chain::block value;
+    value.set_transactions(std::move(transactions));
+    return value;
+}
+
+BOOST_AUTO_TEST_CASE(block__generate_merkle_root__threadpool__matches_serial)
+{
+    threadpool pool(4);
+    const auto value = get_parallel_block(100);
+    BOOST_REQUIRE(value.generate_merkle_root(false, pool) == value.generate_merkle_root());
+    BOOST_REQUIRE(value.to_hashes(false, pool) == value.to_hashes());
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(block__signature_operations__threadpool__matches_serial)
+{
+    threadpool pool(4);
+    const auto value = get_parallel_block(100);
+    BOOST_REQUIRE_EQUAL(value.signature_operations(true, true, pool), value.signature_operations(true, true));
+    BOOST_REQUIRE_EQUAL(value.fees(pool), value.fees());
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(block__check_transactions__threadpool_valid__success)
+{
+    threadpool pool(4);
+    const auto value = get_parallel_block(100);
+    BOOST_REQUIRE_EQUAL(value.check_transactions(parallel_max_money, pool).value(), error::success);
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(block__check_transactions__threadpool_mixed_failures__first_failure_in_block_order)
+{
+    threadpool pool(4);
+    auto value = get_parallel_block(100);
+    auto transactions = value.transactions();
+    transactions[50].set_outputs({});
+    transactions[70].set_outputs({ { parallel_max_money + 1, {} } });
+    value.set_transactions(std::move(transactions));
+    BOOST_REQUIRE_EQUAL(value.check_transactions(parallel_max_money).value(), error::empty_transaction);
+    BOOST_REQUIRE_EQUAL(value.check_transactions(parallel_max_money, pool).value(), error::empty_transaction);
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(block_populate_previous_outputs_tests)
+
+static const auto external1 = hash_literal("000000000019d6689c085ae165831e934ff763ae46a2a6c172b3f1b60a8ce26f");
+static const auto external2 = hash_literal("4a5e1e4baab89f3a32518a88c31bc87f618f76673e2cc77ab2127b7afdeda33b");
+
+class failing_source
+  : public chain::prevout_source
+{
+public:
+    code populate(const chain::output_point::list&) override
+    {
+        return error::operation_failed;
+    }
+};
+
+static chain::chain_state::data get_populate_values()
+{
+    chain::chain_state::data values;
+    values.height = 42;
+    values.bits.ordered.push_back(0x1d00ffff);
+    values.version.ordered.push_back(1);
+    values.timestamp.ordered.push_back(1231006505);
+    values.timestamp.retarget = 0;
+    return values;
+}
+
+static chain::output get_output(uint64_t value)
+{
+    return { value, chain::script(data_chunk{ 0x51 }, false) };
+}
+
+// The second transaction spends each external point, the first twice.
+// The third spends an output of the second and an external point again.
+static chain::block get_populate_block()
+{
+    const chain::transaction coinbase
+    {
+        1, 0, { { { null_hash, chain::point::null_index }, {}, 0 } }, { get_output(50) }
+    };
+
+    const chain::transaction first
+    {
+        1, 0,
+        {
+            { { external2, 0 }, {}, 0 },
+            { { external1, 3 }, {}, 0 },
+            { { external1, 3 }, {}, 0 }
+        },
+        { get_output(10), get_output(20) }
+    };
+
+    const chain::transaction second
+    {
+        1, 0,
+        {
+            { { first.hash(), 1 }, {}, 0 },
+            { { coinbase.hash(), 0 }, {}, 0 },
+            { { first.hash(), 2 }, {}, 0 },
+            { { external2, 0 }, {}, 0 }
+        },
+        { get_output(30) }
+    };
+
+    chain::block value;
+    value.set_transactions({ coinbase, first, second });
+    return value;
+}
+
+BOOST_AUTO_TEST_CASE(block__missing_previous_outputs__in_block_and_duplicate_spends__distinct_external_sorted)
+{
+    const auto value = get_populate_block();
+    const auto points = value.missing_previous_outputs();
+    BOOST_REQUIRE_EQUAL(points.size(), 2u);
+    BOOST_REQUIRE(points[0] < points[1]);
+    BOOST_REQUIRE(std::count(points.begin(), points.end(), chain::output_point(external1, 3)) == 1);
+    BOOST_REQUIRE(std::count(points.begin(), points.end(), chain::output_point(external2, 0)) == 1);
+}
+
+BOOST_AUTO_TEST_CASE(block__missing_previous_outputs__coinbase_only__empty)
+{
+    chain::block value;
+    BOOST_REQUIRE(value.missing_previous_outputs().empty());
+    value.set_transactions({ get_populate_block().transactions().front() });
+    BOOST_REQUIRE(value.missing_previous_outputs().empty());
+}
+
+BOOST_AUTO_TEST_CASE(block__populate_previous_outputs__utxo_set__scattered)
+{
+    const settings settings(config::settings::mainnet);
+    const chain::chain_state state(get_populate_values(), chain::chain_state::checkpoints{}, 0, 0, settings);
+    const auto value = get_populate_block();
+
+    chain::utxo_set source;
+    BOOST_REQUIRE(source.insert({ external1, 3 }, get_output(1), 7, true));
+    BOOST_REQUIRE_EQUAL(value.populate_previous_outputs(state, source).value(), error::success);
+
+    const auto& txs = value.transactions();
+    const auto& first = txs[1].inputs();
+    const auto& second = txs[2].inputs();
+
+    // Missing from the source.
+    BOOST_REQUIRE(!first[0].previous_output().metadata->cache.is_valid());
+    BOOST_REQUIRE(!second[3].previous_output().metadata->cache.is_valid());
+
+    // Found in the source, and scattered to both spends.
+    for (size_t index = 1; index < 3; ++index)
+    {
+        const auto& prevout = *first[index].previous_output().metadata;
+        BOOST_REQUIRE(prevout.cache == get_output(1));
+        BOOST_REQUIRE(prevout.confirmed);
+        BOOST_REQUIRE(prevout.coinbase);
+        BOOST_REQUIRE_EQUAL(prevout.height, 7u);
+    }
+
+    // Outputs of earlier transactions of the block, without the source.
+    const auto& internal = *second[0].previous_output().metadata;
+    BOOST_REQUIRE(internal.cache == get_output(20));
+    BOOST_REQUIRE(!internal.confirmed);
+    BOOST_REQUIRE(!internal.coinbase);
+    BOOST_REQUIRE_EQUAL(internal.height, 42u);
+    BOOST_REQUIRE_EQUAL(internal.median_time_past, state.median_time_past());
+
+    const auto& coinbase = *second[1].previous_output().metadata;
+    BOOST_REQUIRE(coinbase.cache == get_output(50));
+    BOOST_REQUIRE(coinbase.coinbase);
+
+    // An index beyond the outputs of the transaction is missing.
+    BOOST_REQUIRE(!second[2].previous_output().metadata->cache.is_valid());
+}
+
+BOOST_AUTO_TEST_CASE(block__populate_previous_outputs__source_failure__error)
+{
+    const settings settings(config::settings::mainnet);
+    const chain::chain_state state(get_populate_values(), chain::chain_state::checkpoints{}, 0, 0, settings);
+    const auto value = get_populate_block();
+    failing_source source;
+    BOOST_REQUIRE_EQUAL(value.populate_previous_outputs(state, source).value(), error::operation_failed);
+}
+
+BOOST_AUTO_TEST_CASE(block__populate_previous_outputs__threadpool__handler_invoked)
+{
+    threadpool pool(2);
+    const settings settings(config::settings::mainnet);
+    const chain::chain_state state(get_populate_values(), chain::chain_state::checkpoints{}, 0, 0, settings);
+    const auto value = get_populate_block();
+
+    chain::utxo_set source;
+    BOOST_REQUIRE(source.insert({ external2, 0 }, get_output(2), 3, false));
+
+    std::promise<code> complete;
+    value.populate_previous_outputs(state, source, pool, [&complete](const code& ec)
+    {
+        complete.set_value(ec);
+    });
+
+    BOOST_REQUIRE_EQUAL(complete.get_future().get().value(), error::success);
+    BOOST_REQUIRE(value.transactions()[1].inputs()[0].previous_output().metadata->cache == get_output(2));
+    BOOST_REQUIRE(value.transactions()[2].inputs()[3].previous_output().metadata->cache == get_output(2));
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(block__populate_previous_outputs__empty_threadpool__invoked_inline)
+{
+    threadpool pool;
+    const settings settings(config::settings::mainnet);
+    const chain::chain_state state(get_populate_values(), chain::chain_state::checkpoints{}, 0, 0, settings);
+    const auto value = get_populate_block();
+    failing_source source;
+
+    code result;
+    value.populate_previous_outputs(state, source, pool, [&result](const code& ec)
+    {
+        result = ec;
+    });
+
+    BOOST_REQUIRE_EQUAL(result.value(), error::operation_failed);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(block_utxo_delta_tests)
+
+static const chain::input get_coinbase_input(uint8_t value)
+{
+    return { { null_hash, chain::point::null_index }, { { value }, false }, 0 };
+}
+
+// The set element of an unspent output, as in the bitcoind set hash.
+static data_chunk get_element(const hash_digest& hash, uint32_t index,
+    uint32_t height, bool coinbase, const chain::output& output)
+{
+    return build_chunk(
+    {
+        hash,
+        to_little_endian<uint32_t>(index),
+        to_little_endian<uint32_t>(height << 1 | (coinbase ? 1 : 0)),
+        output.to_data()
+    });
+}
+
+BOOST_AUTO_TEST_CASE(block__utxo_delta__spend_of_prior_block__remaining_outputs)
+{
+    const chain::output unspendable{ 0, { { 0x6a }, false } };
+    const chain::transaction first{ 1, 0, { get_coinbase_input(1) }, { { 50, {} } } };
+    const chain::transaction second{ 1, 0, { get_coinbase_input(2) }, { { 25, {} } } };
+    const chain::transaction spend{ 1, 0, { { { first.hash(), 0 }, {}, 0 } }, { { 40, {} }, unspendable } };
+
+    auto& prevout = *spend.inputs()[0].previous_output().metadata;
+    prevout.cache = first.outputs()[0];
+    prevout.height = 1;
+    prevout.coinbase = true;
+
+    chain::block prior;
+    prior.set_transactions({ first });
+    chain::block value;
+    value.set_transactions({ second, spend });
+
+    muhash expected;
+    expected.insert(get_element(second.hash(), 0, 2, true, second.outputs()[0]));
+    expected.insert(get_element(spend.hash(), 0, 2, false, spend.outputs()[0]));
+
+    auto set = prior.utxo_delta(1);
+    set *= value.utxo_delta(2);
+    BOOST_REQUIRE(set.digest() == expected.digest());
+}
+
+BOOST_AUTO_TEST_CASE(block__utxo_delta__threadpool__serial_result)
+{
+    chain::transaction::list transactions;
+
+    for (uint8_t index = 0; index < 20; ++index)
+        transactions.push_back({ 1, 0, { get_coinbase_input(index) }, { { index, {} } } });
+
+    chain::block value;
+    value.set_transactions(std::move(transactions));
+
+    threadpool pool(4);
+    BOOST_REQUIRE(value.utxo_delta(42, pool).digest() == value.utxo_delta(42).digest());
+    pool.shutdown();
+    pool.join();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,185 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::chain;
+
+BOOST_AUTO_TEST_SUITE(block_archive_tests)
+
+static const hash_digest parent_hash = hash_literal(
+    "4a5e1e4baab89f3a32518a88c31bc87f618f76673e2cc77ab2127b7afdeda33b");
+
+// A coinbase and transactions that spend outputs of one parent to a shared
+// script, with every other transaction segregated.
+static block get_block(size_t count)
+{
+    const auto shared = script(script::to_pay_key_hash_pattern(
+        bitcoin_short_hash(to_chunk(parent_hash))));
+
+    transaction::list transactions;
+    transactions.push_back({ 1, 0,
+        { { point{ null_hash, point::null_index }, script{}, 0xffffffff } },
+        { { 5000000000, shared } } });
+
+    for (uint32_t index = 0; index < count; ++index)
+    {
+        const auto stack = index % 2 == 0 ? witness() :
+            witness(data_stack{ { 0x42 }, { 0x01, 0x02 } });
+
+        const input spend({ parent_hash, index }, {}, stack, index);
+        const output pay(index * 1000, shared);
+        const output change(index, script(script::to_pay_key_hash_pattern(
+            bitcoin_short_hash(to_chunk(to_little_endian(index))))));
+        transactions.push_back({ 2, index, { spend }, { pay, change } });
+    }
+
+    block out(header{}, std::move(transactions));
+    header head;
+    head.set_merkle(out.generate_merkle_root());
+    return { std::move(head), transaction::list(out.transactions()) };
+}
+
+BOOST_AUTO_TEST_CASE(block_archive__read__block__round_trip)
+{
+    const auto expected = get_block(10);
+    const auto dictionary = script_dictionary::train({ expected });
+    const auto data = block_archive::encode(expected, dictionary);
+
+    block_archive archive(dictionary);
+    BOOST_REQUIRE(archive.open(data));
+    BOOST_REQUIRE(archive.header() == expected.header());
+    BOOST_REQUIRE_EQUAL(archive.size(), 11u);
+
+    block instance;
+    BOOST_REQUIRE(archive.read(instance));
+    BOOST_REQUIRE(instance == expected);
+    BOOST_REQUIRE(instance.to_data(true) == expected.to_data(true));
+}
+
+BOOST_AUTO_TEST_CASE(block_archive__read__transaction__random_access)
+{
+    const auto expected = get_block(10);
+    const script_dictionary dictionary;
+    const auto data = block_archive::encode(expected, dictionary);
+
+    block_archive archive(dictionary);
+    BOOST_REQUIRE(archive.open(data));
+
+    for (size_t position = archive.size(); position > 0; --position)
+    {
+        transaction instance;
+        BOOST_REQUIRE(archive.read(instance, position - 1));
+        BOOST_REQUIRE(instance == expected.transactions()[position - 1]);
+        BOOST_REQUIRE(instance.hash(true) ==
+            expected.transactions()[position - 1].hash(true));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(block_archive__read__out_of_range__false)
+{
+    const script_dictionary dictionary;
+    const auto data = block_archive::encode(get_block(2), dictionary);
+
+    block_archive archive(dictionary);
+    BOOST_REQUIRE(archive.open(data));
+
+    transaction instance;
+    BOOST_REQUIRE(!archive.read(instance, 3));
+    BOOST_REQUIRE_EQUAL(archive.size(3), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(block_archive__encode__repeated_hashes_and_scripts__smaller)
+{
+    const auto expected = get_block(100);
+    const auto dictionary = script_dictionary::train({ expected });
+    const auto plain = block_archive::encode(expected, script_dictionary{});
+    const auto trained = block_archive::encode(expected, dictionary);
+
+    BOOST_REQUIRE_EQUAL(dictionary.size(), 1u);
+    BOOST_REQUIRE_LT(plain.size(), expected.serialized_size(true));
+    BOOST_REQUIRE_LT(trained.size(), plain.size());
+}
+
+BOOST_AUTO_TEST_CASE(block_archive__open__truncated__false)
+{
+    const script_dictionary dictionary;
+    auto data = block_archive::encode(get_block(2), dictionary);
+    data.pop_back();
+
+    block_archive archive(dictionary);
+    BOOST_REQUIRE(!archive.open(data));
+    BOOST_REQUIRE(!archive.is_open());
+    BOOST_REQUIRE_EQUAL(archive.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(block_archive__read__corrupt_transaction__only_that_fails)
+{
+    const auto expected = get_block(2);
+    const script_dictionary dictionary;
+    auto data = block_archive::encode(expected, dictionary);
+
+    block_archive archive(dictionary);
+    BOOST_REQUIRE(archive.open(data));
+
+    // Set an undefined flag on the unsegregated second transaction.
+    const auto second = data.size() - archive.size(2) - archive.size(1);
+    BOOST_REQUIRE_EQUAL(data[second + 1], 0x00);
+    data[second + 1] = 0x02;
+
+    transaction instance;
+    BOOST_REQUIRE(!archive.read(instance, 1));
+    BOOST_REQUIRE(archive.read(instance, 2));
+    BOOST_REQUIRE(instance == expected.transactions()[2]);
+
+    block all;
+    BOOST_REQUIRE(!archive.read(all));
+}
+
+BOOST_AUTO_TEST_CASE(block_archive__read__unknown_script_reference__false)
+{
+    const auto expected = get_block(2);
+    const auto dictionary = script_dictionary::train({ expected });
+    const auto data = block_archive::encode(expected, dictionary);
+
+    const script_dictionary empty;
+    block_archive archive(empty);
+    BOOST_REQUIRE(archive.open(data));
+
+    transaction instance;
+    BOOST_REQUIRE(!archive.read(instance, 0));
+}
+
+BOOST_AUTO_TEST_CASE(block_archive__read__block_merkle_mismatch__false)
+{
+    const auto valid = get_block(2);
+    const block expected(header{}, transaction::list(valid.transactions()));
+    const script_dictionary dictionary;
+    const auto data = block_archive::encode(expected, dictionary);
+
+    block_archive archive(dictionary);
+    BOOST_REQUIRE(archive.open(data));
+
+    block instance;
+    BOOST_REQUIRE(!archive.read(instance));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,173 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::chain;
+using namespace bc::machine;
+
+BOOST_AUTO_TEST_SUITE(block_assembler_tests)
+
+static const auto external = hash_literal("000000000019d6689c085ae165831e934ff763ae46a2a6c172b3f1b60a8ce26f");
+static const auto parent_block = hash_literal("4a5e1e4baab89f3a32518a88c31bc87f618f76673e2cc77ab2127b7afdeda33b");
+
+// Test helpers.
+static chain_state get_state(const settings& settings)
+{
+    chain_state::data values;
+    values.height = 42;
+    values.bits.ordered.push_back(0x1d00ffff);
+    values.version.ordered.push_back(1);
+    values.timestamp.ordered.push_back(1231006505);
+    values.timestamp.retarget = 0;
+    values.bip9_bit1_hash = settings.bip9_bit1_active_checkpoint.hash();
+    return { std::move(values), chain_state::checkpoints{}, rule_fork::all_rules, 0, settings };
+}
+
+static transaction get_spend(const output_point& point, uint64_t value,
+    uint32_t locktime=0, uint32_t sequence=max_input_sequence)
+{
+    return { 1, locktime, { { point, {}, sequence } }, { { value, script(data_chunk{ 0x51 }, false) } } };
+}
+
+static uint64_t get_subsidy(const settings& settings)
+{
+    return block::subsidy(42, settings.subsidy_interval(),
+        settings.bitcoin_to_satoshi(settings.initial_block_subsidy_bitcoin()));
+}
+
+BOOST_AUTO_TEST_CASE(block_assembler__assemble__empty_pool__coinbase_only_valid)
+{
+    const settings settings(config::settings::mainnet);
+    const auto state = get_state(settings);
+    transaction_pool_index pool;
+    const block_assembler instance(pool);
+    const script pay_to(data_chunk{ 0x51 }, false);
+
+    const auto value = instance.assemble(state, settings, parent_block, pay_to, 1231006505);
+    BOOST_REQUIRE_EQUAL(value.transactions().size(), 1u);
+    BOOST_REQUIRE(value.header().previous_block_hash() == parent_block);
+    BOOST_REQUIRE_GT(value.header().timestamp(), state.median_time_past());
+    BOOST_REQUIRE_EQUAL(value.header().bits(), state.work_required());
+    BOOST_REQUIRE(value.is_valid_merkle_root());
+    BOOST_REQUIRE(value.is_valid_coinbase_script(42));
+    BOOST_REQUIRE(value.is_valid_witness_commitment());
+    BOOST_REQUIRE(value.transactions().front().outputs().front().script() == pay_to);
+    BOOST_REQUIRE_EQUAL(value.transactions().front().outputs().front().value(), get_subsidy(settings));
+}
+
+BOOST_AUTO_TEST_CASE(block_assembler__assemble__transactions__fees_claimed_commitment_valid)
+{
+    const settings settings(config::settings::mainnet);
+    const auto state = get_state(settings);
+    transaction_pool_index pool;
+    const auto parent = get_spend({ external, 0 }, 90);
+    const auto child = get_spend({ parent.hash(), 0 }, 80);
+    BOOST_REQUIRE(pool.insert(parent, 10, 1));
+    BOOST_REQUIRE(pool.insert(child, 10, 1));
+
+    const block_assembler instance(pool);
+    const auto value = instance.assemble(state, settings, parent_block, {}, 0);
+    const auto& txs = value.transactions();
+    BOOST_REQUIRE_EQUAL(txs.size(), 3u);
+    BOOST_REQUIRE(txs[1] == parent);
+    BOOST_REQUIRE(txs[2] == child);
+    BOOST_REQUIRE(value.is_valid_merkle_root());
+    BOOST_REQUIRE(value.is_valid_witness_commitment());
+    BOOST_REQUIRE_EQUAL(txs.front().outputs().front().value(), get_subsidy(settings) + 20u);
+}
+
+BOOST_AUTO_TEST_CASE(block_assembler__select__child_pays_for_parent__package_first)
+{
+    const settings settings(config::settings::mainnet);
+    const auto state = get_state(settings);
+    transaction_pool_index pool;
+    const auto parent = get_spend({ external, 0 }, 90);
+    const auto child = get_spend({ parent.hash(), 0 }, 80);
+    const auto other = get_spend({ external, 1 }, 90);
+    BOOST_REQUIRE(pool.insert(parent, 1, 0));
+    BOOST_REQUIRE(pool.insert(other, 100, 0));
+    BOOST_REQUIRE(pool.insert(child, 1000, 0));
+
+    const block_assembler instance(pool);
+    const auto selected = instance.select(state, 0);
+    BOOST_REQUIRE_EQUAL(selected.size(), 3u);
+    BOOST_REQUIRE(selected[0]->hash == parent.hash());
+    BOOST_REQUIRE(selected[1]->hash == child.hash());
+    BOOST_REQUIRE(selected[2]->hash == other.hash());
+}
+
+BOOST_AUTO_TEST_CASE(block_assembler__select__weight_limit__highest_rate_selected)
+{
+    const settings settings(config::settings::mainnet);
+    const auto state = get_state(settings);
+    transaction_pool_index pool;
+    const auto low = get_spend({ external, 0 }, 90);
+    const auto high = get_spend({ external, 1 }, 90);
+    BOOST_REQUIRE(pool.insert(low, 1, 0));
+    BOOST_REQUIRE(pool.insert(high, 2, 0));
+
+    // Space for one transaction after the coinbase reservation.
+    const auto weight = block_assembler::coinbase_weight + 4 * high.virtual_size();
+    const block_assembler instance(pool, weight);
+    const auto selected = instance.select(state, 0);
+    BOOST_REQUIRE_EQUAL(selected.size(), 1u);
+    BOOST_REQUIRE(selected[0]->hash == high.hash());
+}
+
+BOOST_AUTO_TEST_CASE(block_assembler__select__non_final__excluded_with_descendants)
+{
+    const settings settings(config::settings::mainnet);
+    const auto state = get_state(settings);
+    transaction_pool_index pool;
+    const auto locked = get_spend({ external, 0 }, 90, 100, 0);
+    const auto child = get_spend({ locked.hash(), 0 }, 80);
+    const auto other = get_spend({ external, 1 }, 90);
+    BOOST_REQUIRE(pool.insert(locked, 10, 0));
+    BOOST_REQUIRE(pool.insert(child, 10, 0));
+    BOOST_REQUIRE(pool.insert(other, 1, 0));
+
+    const block_assembler instance(pool);
+    const auto selected = instance.select(state, 0);
+    BOOST_REQUIRE_EQUAL(selected.size(), 1u);
+    BOOST_REQUIRE(selected[0]->hash == other.hash());
+}
+
+BOOST_AUTO_TEST_CASE(block_assembler__select__pool_changed__refreshed)
+{
+    const settings settings(config::settings::mainnet);
+    const auto state = get_state(settings);
+    transaction_pool_index pool;
+    const auto first = get_spend({ external, 0 }, 90);
+    BOOST_REQUIRE(pool.insert(first, 1, 0));
+
+    const block_assembler instance(pool);
+    BOOST_REQUIRE_EQUAL(instance.select(state, 0).size(), 1u);
+
+    const auto second = get_spend({ external, 1 }, 90);
+    BOOST_REQUIRE(pool.insert(second, 5, 0));
+    const auto selected = instance.select(state, 0);
+    BOOST_REQUIRE_EQUAL(selected.size(), 2u);
+    BOOST_REQUIRE(selected[0]->hash == second.hash());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
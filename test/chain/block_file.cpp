@@ -0,0 +1,127 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <fstream>
+#include <string>
+#include <boost/filesystem.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::chain;
+
+static const uint32_t mainnet_magic = 0xd9b4bef9;
+
+// Test helpers.
+static boost::filesystem::path write_file(const data_chunk& data)
+{
+    const auto file = boost::filesystem::temp_directory_path() /
+        boost::filesystem::unique_path("block_file-%%%%-%%%%.dat");
+    std::ofstream stream(file.string(), std::ios::binary);
+    stream.write(reinterpret_cast<const char*>(data.data()), data.size());
+    return file;
+}
+
+static void append_frame(data_chunk& out, uint32_t magic,
+    const data_chunk& block)
+{
+    extend_data(out, to_little_endian(magic));
+    extend_data(out, to_little_endian(static_cast<uint32_t>(block.size())));
+    extend_data(out, block);
+}
+
+BOOST_AUTO_TEST_SUITE(block_file_tests)
+
+BOOST_AUTO_TEST_CASE(block_file__open__missing__false)
+{
+    block_file instance(mainnet_magic);
+    BOOST_REQUIRE(!instance.open("missing-block-file.dat"));
+    BOOST_REQUIRE(!instance.is_open());
+
+    data_slice slice(nullptr, nullptr);
+    BOOST_REQUIRE(!instance.next(slice));
+}
+
+BOOST_AUTO_TEST_CASE(block_file__next__padded_frames__slices_in_order)
+{
+    const block genesis = settings(config::settings::mainnet).genesis_block;
+    const block testnet = settings(config::settings::testnet).genesis_block;
+    const auto first = genesis.to_data(true);
+    const auto second = testnet.to_data(true);
+
+    data_chunk data(7, 0x00);
+    append_frame(data, mainnet_magic, first);
+    data.resize(data.size() + 3, 0x42);
+    append_frame(data, mainnet_magic, second);
+
+    // Frames of other networks, undersized and truncated frames are skipped.
+    append_frame(data, 0x0709110b, first);
+    append_frame(data, mainnet_magic, data_chunk(10, 0x00));
+    extend_data(data, to_little_endian(mainnet_magic));
+    extend_data(data, to_little_endian(uint32_t(1000)));
+    data.resize(data.size() + 200, 0x00);
+
+    const auto path = write_file(data);
+    block_file instance(mainnet_magic);
+    BOOST_REQUIRE(instance.open(path));
+    BOOST_REQUIRE_EQUAL(instance.data().size(), data.size());
+
+    data_slice slice(nullptr, nullptr);
+    BOOST_REQUIRE(instance.next(slice));
+    BOOST_REQUIRE(std::equal(slice.begin(), slice.end(), first.begin()));
+    BOOST_REQUIRE_EQUAL(slice.size(), first.size());
+
+    // The slice is in place, not a copy.
+    BOOST_REQUIRE(slice.begin() == instance.data().begin() + 7 +
+        block_file::frame_size);
+
+    BOOST_REQUIRE(instance.next(slice));
+    BOOST_REQUIRE_EQUAL(slice.size(), second.size());
+    BOOST_REQUIRE(std::equal(slice.begin(), slice.end(), second.begin()));
+    BOOST_REQUIRE(!instance.next(slice));
+
+    instance.close();
+    BOOST_REQUIRE(!instance.is_open());
+    BOOST_REQUIRE_EQUAL(instance.position(), 0u);
+    boost::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(block_file__open__reopen__restarts)
+{
+    const block genesis = settings(config::settings::mainnet).genesis_block;
+    data_chunk data;
+    append_frame(data, mainnet_magic, genesis.to_data(true));
+    const auto path = write_file(data);
+
+    block_file instance(mainnet_magic);
+    data_slice slice(nullptr, nullptr);
+    BOOST_REQUIRE(instance.open(path));
+    BOOST_REQUIRE(instance.next(slice));
+    BOOST_REQUIRE_EQUAL(instance.position(), data.size());
+    BOOST_REQUIRE(instance.open(path));
+    BOOST_REQUIRE_EQUAL(instance.position(), 0u);
+    BOOST_REQUIRE(instance.next(slice));
+    BOOST_REQUIRE(block::factory(data_chunk(slice.begin(), slice.end()),
+        true) == genesis);
+
+    instance.close();
+    boost::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
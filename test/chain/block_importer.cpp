@@ -0,0 +1,155 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include <boost/filesystem.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::chain;
+
+static const uint32_t mainnet_magic = 0xd9b4bef9;
+
+// Test helpers.
+static boost::filesystem::path write_file(const data_chunk& data)
+{
+    const auto file = boost::filesystem::temp_directory_path() /
+        boost::filesystem::unique_path("block_importer-%%%%-%%%%.dat");
+    std::ofstream stream(file.string(), std::ios::binary);
+    stream.write(reinterpret_cast<const char*>(data.data()), data.size());
+    return file;
+}
+
+static void append_frame(data_chunk& out, const data_chunk& block)
+{
+    extend_data(out, to_little_endian(mainnet_magic));
+    extend_data(out, to_little_endian(static_cast<uint32_t>(block.size())));
+    extend_data(out, block);
+}
+
+BOOST_AUTO_TEST_SUITE(block_importer_tests)
+
+BOOST_AUTO_TEST_CASE(block_importer__import__mixed__in_order_with_codes)
+{
+    const settings mainnet(config::settings::mainnet);
+    const block first = mainnet.genesis_block;
+    const block second = settings(config::settings::testnet).genesis_block;
+    const block third = settings(config::settings::regtest).genesis_block;
+
+    data_chunk data;
+    append_frame(data, first.to_data(true));
+    append_frame(data, second.to_data(true));
+    append_frame(data, third.to_data(true));
+    append_frame(data, data_chunk(81, 0xff));
+    const auto path = write_file(data);
+
+    block_file file(mainnet_magic);
+    BOOST_REQUIRE(file.open(path));
+
+    std::vector<code> codes;
+    std::vector<hash_digest> hashes;
+    const block_importer instance(mainnet);
+    const auto result = instance.import(file, [&](const code& ec, block&& value)
+    {
+        codes.push_back(ec);
+        hashes.push_back(value.hash());
+        return true;
+    });
+
+    BOOST_REQUIRE_EQUAL(result, error::success);
+    BOOST_REQUIRE_EQUAL(codes.size(), 4u);
+    BOOST_REQUIRE_EQUAL(codes[0], error::success);
+    BOOST_REQUIRE_EQUAL(codes[1], error::success);
+
+    // The regtest genesis exceeds the mainnet proof of work limit.
+    BOOST_REQUIRE(codes[2]);
+    BOOST_REQUIRE_EQUAL(codes[3], error::bad_stream);
+    BOOST_REQUIRE(hashes[0] == first.hash());
+    BOOST_REQUIRE(hashes[1] == second.hash());
+    BOOST_REQUIRE(hashes[2] == third.hash());
+
+    file.close();
+    boost::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(block_importer__import__handler_stops__stopping_code)
+{
+    const settings mainnet(config::settings::mainnet);
+    const block genesis = mainnet.genesis_block;
+    const block regtest = settings(config::settings::regtest).genesis_block;
+
+    data_chunk data;
+    append_frame(data, genesis.to_data(true));
+    append_frame(data, regtest.to_data(true));
+
+    for (size_t count = 0; count < 100; ++count)
+        append_frame(data, genesis.to_data(true));
+
+    const auto path = write_file(data);
+    block_file file(mainnet_magic);
+    BOOST_REQUIRE(file.open(path));
+
+    size_t delivered = 0;
+    const block_importer instance(mainnet, true, 1);
+    const auto result = instance.import(file, [&](const code& ec, block&&)
+    {
+        ++delivered;
+        return !ec;
+    });
+
+    BOOST_REQUIRE(result);
+    BOOST_REQUIRE_EQUAL(delivered, 2u);
+
+    file.close();
+    boost::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(block_importer__import__shallow_queues__all_delivered)
+{
+    const settings mainnet(config::settings::mainnet);
+    const block genesis = mainnet.genesis_block;
+    const auto block_data = genesis.to_data(true);
+
+    data_chunk data;
+    for (size_t count = 0; count < 500; ++count)
+        append_frame(data, block_data);
+
+    const auto path = write_file(data);
+    block_file file(mainnet_magic);
+    BOOST_REQUIRE(file.open(path));
+
+    size_t delivered = 0;
+    const block_importer instance(mainnet, true, 2);
+    const auto result = instance.import(file, [&](const code& ec, block&& value)
+    {
+        delivered += (!ec && value.is_valid()) ? 1 : 0;
+        return true;
+    });
+
+    BOOST_REQUIRE_EQUAL(result, error::success);
+    BOOST_REQUIRE_EQUAL(delivered, 500u);
+
+    file.close();
+    boost::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,232 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <memory>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::chain;
+
+// Test helpers.
+static const uint32_t regtest_bits = 0x207fffff;
+
+static chain_state::ptr get_genesis_state(const settings& settings)
+{
+    chain_state::data values;
+    values.height = 0;
+    values.hash = null_hash;
+    values.bip9_bit0_hash = null_hash;
+    values.bip9_bit1_hash = null_hash;
+    values.bits.self = regtest_bits;
+    values.version.self = 1;
+    values.timestamp.self = 1000;
+    values.timestamp.retarget = 1000;
+    return std::make_shared<chain_state>(std::move(values),
+        chain_state::checkpoints{}, 0, 0, settings);
+}
+
+static script get_true_script()
+{
+    return script({ machine::opcode::push_positive_1 });
+}
+
+static transaction get_spend(const output_point& point, uint64_t value)
+{
+    return transaction(1, 0, { { point, {}, max_input_sequence } },
+        { { value, get_true_script() } });
+}
+
+// Mine a child of the parent with a unique coinbase, setting its state.
+static block get_child(const chain_state::ptr& parent, transaction::list txs,
+    const settings& settings, chain_state::ptr& out_state)
+{
+    const auto height = static_cast<uint8_t>(parent->height() + 1);
+    const script coinbase_script(data_chunk{ 1, height }, false);
+    const transaction coinbase(1, 0,
+        { { output_point{ null_hash, point::null_index }, coinbase_script,
+            max_input_sequence } },
+        { { 0, get_true_script() } });
+
+    txs.insert(txs.begin(), coinbase);
+    block instance(header{}, std::move(txs));
+    header child(4, parent->hash(), instance.generate_merkle_root(),
+        1000 + height, regtest_bits, 0);
+
+    while (!child.is_valid_proof_of_work(settings.proof_of_work_limit))
+        child.set_nonce(child.nonce() + 1);
+
+    instance.set_header(child);
+    out_state = std::make_shared<chain_state>(*parent, child, settings);
+    return instance;
+}
+
+struct pipeline_result
+{
+    code ec;
+    std::vector<code> codes;
+};
+
+static pipeline_result validate(block_pipeline& instance, utxo_set& source,
+    std::vector<block>& blocks, std::vector<chain_state::ptr>& states)
+{
+    pipeline_result result;
+    size_t index = 0;
+
+    const auto next = [&](block& out_block, chain_state::ptr& out_state)
+    {
+        if (index == blocks.size())
+            return false;
+
+        out_block = std::move(blocks[index]);
+        out_state = states[index++];
+        return true;
+    };
+
+    const auto handler = [&](const code& ec, block&& value,
+        const chain_state& state)
+    {
+        result.codes.push_back(ec);
+
+        if (ec)
+            return false;
+
+        source.insert(value, state.height());
+        return source.erase(value);
+    };
+
+    result.ec = instance.validate(source, next, handler);
+    return result;
+}
+
+BOOST_AUTO_TEST_SUITE(block_pipeline_tests)
+
+BOOST_AUTO_TEST_CASE(block_pipeline__validate__no_blocks__success)
+{
+    const settings regtest(config::settings::regtest);
+    utxo_set source;
+    std::vector<block> blocks;
+    std::vector<chain_state::ptr> states;
+    block_pipeline instance(regtest);
+    const auto result = validate(instance, source, blocks, states);
+    BOOST_REQUIRE_EQUAL(result.ec, error::success);
+    BOOST_REQUIRE(result.codes.empty());
+    BOOST_REQUIRE_EQUAL(instance.metrics().blocks, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(block_pipeline__validate__uncommitted_parent_outputs__success)
+{
+    const settings regtest(config::settings::regtest);
+    const output_point funding{ hash_literal(
+        "0000000000000000000000000000000000000000000000000000000000000001"),
+        0 };
+
+    utxo_set source;
+    source.insert(funding, { 100, get_true_script() }, 0, false);
+
+    // Each block spends an output of its parent, so none can be populated
+    // from the source until the parent is committed.
+    std::vector<block> blocks;
+    std::vector<chain_state::ptr> states;
+    auto state = get_genesis_state(regtest);
+    auto point = funding;
+
+    for (size_t count = 0; count < 4; ++count)
+    {
+        const auto spend = get_spend(point, 100);
+        blocks.push_back(get_child(state, { spend }, regtest, state));
+        states.push_back(state);
+        point = output_point{ spend.hash(), 0 };
+    }
+
+    block_pipeline_options options;
+    options.depth = 2;
+    block_pipeline instance(regtest, options);
+    const auto result = validate(instance, source, blocks, states);
+    BOOST_REQUIRE_EQUAL(result.ec, error::success);
+    BOOST_REQUIRE_EQUAL(result.codes.size(), 4u);
+    BOOST_REQUIRE_EQUAL(instance.metrics().blocks, 4u);
+    BOOST_REQUIRE(!source.contains(funding));
+    BOOST_REQUIRE(source.contains(point));
+}
+
+BOOST_AUTO_TEST_CASE(block_pipeline__validate__uncommitted_double_spend__stops)
+{
+    const settings regtest(config::settings::regtest);
+    const output_point funding{ hash_literal(
+        "0000000000000000000000000000000000000000000000000000000000000001"),
+        0 };
+
+    utxo_set source;
+    source.insert(funding, { 100, get_true_script() }, 0, false);
+
+    std::vector<block> blocks;
+    std::vector<chain_state::ptr> states;
+    auto state = get_genesis_state(regtest);
+    blocks.push_back(get_child(state, { get_spend(funding, 100) }, regtest,
+        state));
+    states.push_back(state);
+    blocks.push_back(get_child(state, { get_spend(funding, 99) }, regtest,
+        state));
+    states.push_back(state);
+    blocks.push_back(get_child(state, {}, regtest, state));
+    states.push_back(state);
+
+    block_pipeline instance(regtest);
+    const auto result = validate(instance, source, blocks, states);
+    BOOST_REQUIRE_EQUAL(result.ec, error::double_spend);
+    BOOST_REQUIRE_EQUAL(result.codes.size(), 2u);
+    BOOST_REQUIRE_EQUAL(result.codes[0], error::success);
+    BOOST_REQUIRE_EQUAL(result.codes[1], error::double_spend);
+}
+
+BOOST_AUTO_TEST_CASE(block_pipeline__validate__check_failure__delivered_in_order)
+{
+    const settings regtest(config::settings::regtest);
+    utxo_set source;
+    std::vector<block> blocks;
+    std::vector<chain_state::ptr> states;
+    auto state = get_genesis_state(regtest);
+    blocks.push_back(get_child(state, {}, regtest, state));
+    states.push_back(state);
+    blocks.push_back(block{});
+    states.push_back(state);
+    blocks.push_back(get_child(state, {}, regtest, state));
+    states.push_back(state);
+
+    block_pipeline instance(regtest);
+    const auto result = validate(instance, source, blocks, states);
+    BOOST_REQUIRE_EQUAL(result.ec, error::invalid_proof_of_work);
+    BOOST_REQUIRE_EQUAL(result.codes.size(), 2u);
+    BOOST_REQUIRE_EQUAL(result.codes[0], error::success);
+    BOOST_REQUIRE_EQUAL(instance.metrics().blocks, 2u);
+}
+
+BOOST_AUTO_TEST_CASE(block_pipeline_metrics__utilization__half__expected)
+{
+    block_pipeline_metrics instance;
+    instance.elapsed = std::chrono::milliseconds(100);
+    BOOST_REQUIRE_EQUAL(instance.utilization(std::chrono::milliseconds(100),
+        2), 0.5);
+    BOOST_REQUIRE_EQUAL(block_pipeline_metrics().utilization(
+        std::chrono::milliseconds(1)), 0.0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
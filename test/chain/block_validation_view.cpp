@@ -0,0 +1,180 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::chain;
+
+BOOST_AUTO_TEST_SUITE(block_validation_view_tests)
+
+static const auto external = hash_literal("000000000019d6689c085ae165831e934ff763ae46a2a6c172b3f1b60a8ce26f");
+
+static chain_state::data get_values()
+{
+    chain_state::data values;
+    values.height = 1;
+    values.bits.ordered.push_back(0x1d00ffff);
+    values.version.ordered.push_back(1);
+    values.timestamp.ordered.push_back(1231006505);
+    values.timestamp.retarget = 0;
+    return values;
+}
+
+static void populate(const input& input, uint64_t value)
+{
+    input.previous_output().metadata->cache =
+        output(value, script(data_chunk{ 0x51 }, false));
+}
+
+// The coinbase, a spend of two external outputs of 100 and 50 paying 120,
+// and a spend of an unpopulated external output paying 10.
+static block get_block()
+{
+    const script coinbase_script(data_chunk{ 0x00, 0x00 }, false);
+    const transaction coinbase
+    {
+        1, 0, { { { null_hash, point::null_index }, coinbase_script, 0 } }, { { 50, {} } }
+    };
+
+    const transaction first
+    {
+        1, 0,
+        {
+            { { external, 0 }, script(data_chunk{ 0xac }, false), 7 },
+            { { external, 1 }, {}, 8 }
+        },
+        { { 120, {} } }
+    };
+
+    const transaction second
+    {
+        1, 0, { { { external, 2 }, {}, 9 } }, { { 10, {} } }
+    };
+
+    block value;
+    value.set_transactions({ coinbase, first, second });
+    const auto& inputs = value.transactions()[1].inputs();
+    populate(inputs[0], 100);
+    populate(inputs[1], 50);
+    return value;
+}
+
+BOOST_AUTO_TEST_CASE(block_validation_view__construct__block__flattened_in_block_order)
+{
+    const auto value = get_block();
+    const block_validation_view view(value);
+    BOOST_REQUIRE_EQUAL(view.size(), 3u);
+    BOOST_REQUIRE_EQUAL(view.transactions(), 2u);
+    BOOST_REQUIRE(view.points()[0] == point(external, 0));
+    BOOST_REQUIRE(view.points()[2] == point(external, 2));
+    BOOST_REQUIRE_EQUAL(view.values()[0], 100u);
+    BOOST_REQUIRE_EQUAL(view.values()[1], 50u);
+    BOOST_REQUIRE_EQUAL(view.values()[2], output::not_found);
+    BOOST_REQUIRE_EQUAL(view.previous_scripts()[0].size(), 1u);
+    BOOST_REQUIRE(view.previous_scripts()[2].empty());
+    BOOST_REQUIRE_EQUAL(view.scripts()[0].size(), 1u);
+    BOOST_REQUIRE_EQUAL(view.scripts()[0].data()[0], 0xac);
+    BOOST_REQUIRE(view.scripts()[1].empty());
+    BOOST_REQUIRE_EQUAL(view.sequences()[1], 8u);
+    BOOST_REQUIRE_EQUAL(view.positions()[1], 1u);
+    BOOST_REQUIRE_EQUAL(view.positions()[2], 2u);
+    BOOST_REQUIRE_EQUAL(view.indexes()[1], 1u);
+    BOOST_REQUIRE_EQUAL(view.indexes()[2], 0u);
+}
+
+BOOST_AUTO_TEST_CASE(block_validation_view__construct__empty_block__empty)
+{
+    const block value;
+    const block_validation_view view(value);
+    BOOST_REQUIRE_EQUAL(view.size(), 0u);
+    BOOST_REQUIRE_EQUAL(view.transactions(), 0u);
+    BOOST_REQUIRE_EQUAL(view.fees(), 0u);
+    BOOST_REQUIRE(!view.is_internal_double_spend());
+}
+
+BOOST_AUTO_TEST_CASE(block_validation_view__fees__populated__matches_block)
+{
+    const auto value = get_block();
+    const block_validation_view view(value);
+    BOOST_REQUIRE_EQUAL(view.fees(), 30u);
+    BOOST_REQUIRE_EQUAL(view.fees(), value.fees());
+}
+
+BOOST_AUTO_TEST_CASE(block_validation_view__is_overspent__missing_prevout__true)
+{
+    const auto value = get_block();
+    const block_validation_view view(value);
+    BOOST_REQUIRE(view.is_overspent());
+    BOOST_REQUIRE(value.transactions()[2].is_overspent());
+}
+
+BOOST_AUTO_TEST_CASE(block_validation_view__is_overspent__populated__false)
+{
+    const auto value = get_block();
+    populate(value.transactions()[2].inputs()[0], 10);
+    const block_validation_view view(value);
+    BOOST_REQUIRE(!view.is_overspent());
+}
+
+BOOST_AUTO_TEST_CASE(block_validation_view__is_internal_double_spend__distinct__false)
+{
+    const auto value = get_block();
+    const block_validation_view view(value);
+    BOOST_REQUIRE(!view.is_internal_double_spend());
+    BOOST_REQUIRE(!value.is_internal_double_spend());
+}
+
+BOOST_AUTO_TEST_CASE(block_validation_view__is_internal_double_spend__duplicate__true)
+{
+    auto value = get_block();
+    auto transactions = value.transactions();
+    transactions.push_back({ 1, 0, { { { external, 1 }, {}, 0 } }, {} });
+    value.set_transactions(std::move(transactions));
+    const block_validation_view view(value);
+    BOOST_REQUIRE(view.is_internal_double_spend());
+    BOOST_REQUIRE(value.is_internal_double_spend());
+}
+
+BOOST_AUTO_TEST_CASE(block_validation_view__signature_operations__populated__matches_block)
+{
+    const auto value = get_block();
+    const block_validation_view view(value);
+    BOOST_REQUIRE_EQUAL(view.signature_operations(true, true), value.signature_operations(true, true));
+    BOOST_REQUIRE_EQUAL(view.signature_operations(false, false), value.signature_operations(false, false));
+    BOOST_REQUIRE_GT(view.signature_operations(false, false), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(block_validation_view__connect__missing_prevout__matches_block)
+{
+    threadpool pool(2);
+    const settings settings(config::settings::mainnet);
+    const chain_state state(get_values(), chain_state::checkpoints{}, 0, 0, settings);
+    const auto value = get_block();
+    const block_validation_view view(value);
+    const auto expected = value.connect_transactions(state);
+    BOOST_REQUIRE(expected);
+    BOOST_REQUIRE_EQUAL(view.connect(state, pool).value(), expected.value());
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
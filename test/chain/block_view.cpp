@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::chain;
+
+BOOST_AUTO_TEST_SUITE(block_view_tests)
+
+BOOST_AUTO_TEST_CASE(block_view__constructor__default__invalid)
+{
+    const block_view instance;
+    BOOST_REQUIRE(!instance.is_valid());
+    BOOST_REQUIRE(instance.data().empty());
+    BOOST_REQUIRE(instance.header().empty());
+    BOOST_REQUIRE(instance.transactions().empty());
+}
+
+BOOST_AUTO_TEST_CASE(block_view__constructor__insufficient_bytes__invalid)
+{
+    const chain::block genesis = settings(bc::config::settings::mainnet).genesis_block;
+    const auto data = genesis.to_data();
+    const data_slice truncated(data.data(), data.data() + data.size() - 1);
+    BOOST_REQUIRE(!block_view(truncated).is_valid());
+}
+
+BOOST_AUTO_TEST_CASE(block_view__properties__genesis__expected)
+{
+    const chain::block genesis = settings(bc::config::settings::mainnet).genesis_block;
+    const auto data = genesis.to_data();
+    const block_view instance(data);
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE_EQUAL(instance.serialized_size(), data.size());
+    BOOST_REQUIRE_EQUAL(encode_base16(instance.header()), encode_base16(genesis.header().to_data()));
+    BOOST_REQUIRE_EQUAL(encode_hash(instance.hash()), encode_hash(genesis.hash()));
+    BOOST_REQUIRE_EQUAL(instance.transactions().size(), 1u);
+
+    const auto& tx = *instance.transactions().begin();
+    BOOST_REQUIRE(tx.is_valid());
+    BOOST_REQUIRE_EQUAL(encode_hash(tx.hash()), encode_hash(genesis.transactions().front().hash()));
+}
+
+BOOST_AUTO_TEST_CASE(block_view__transactions__multiple__match_block)
+{
+    const auto raw_block = to_chunk(base16_literal(
+        "010000007f110631052deeee06f0754a3629ad7663e56359fd5f3aa7b3e30a0000000"
+        "0005f55996827d9712147a8eb6d7bae44175fe0bcfa967e424a25bfe9f4dc118244d6"
+        "7fb74c9d8e2f1bea5ee82a03010000000100000000000000000000000000000000000"
+        "00000000000000000000000000000ffffffff07049d8e2f1b0114ffffffff0100f205"
+        "2a0100000043410437b36a7221bc977dce712728a954e3b5d88643ed5aef46660ddcf"
+        "eeec132724cd950c1fdd008ad4a2dfd354d6af0ff155fc17c1ee9ef802062feb07ef1"
+        "d065f0ac000000000100000001260fd102fab456d6b169f6af4595965c03c2296ecf2"
+        "5bfd8790e7aa29b404eff010000008c493046022100c56ad717e07229eb93ecef2a32"
+        "a42ad041832ffe66bd2e1485dc6758073e40af022100e4ba0559a4cebbc7ccb5d14d1"
+        "312634664bac46f36ddd35761edaae20cefb16f01410417e418ba79380f462a60d8dd"
+        "12dcef8ebfd7ab1741c5c907525a69a8743465f063c1d9182eea27746aeb9f1f52583"
+        "040b1bc341b31ca0388139f2f323fd59f8effffffff0200ffb2081d0000001976a914"
+        "fc7b44566256621affb1541cc9d59f08336d276b88ac80f0fa02000000001976a9146"
+        "17f0609c9fabb545105f7898f36b84ec583350d88ac00000000010000000122cd6da2"
+        "6eef232381b1a670aa08f4513e9f91a9fd129d912081a3dd138cb013010000008c493"
+        "0460221009339c11b83f234b6c03ebbc4729c2633cbc8cbd0d15774594bfedc45c4f9"
+        "9e2f022100ae0135094a7d651801539df110a028d65459d24bc752d7512bc8a9f78b4"
+        "ab368014104a2e06c38dc72c4414564f190478e3b0d01260f09b8520b196c2f6ec3d0"
+        "6239861e49507f09b7568189efe8d327c3384a4e488f8c534484835f8020b3669e5ae"
+        "bffffffff0200ac23fc060000001976a914b9a2c9700ff9519516b21af338d28d53dd"
+        "f5349388ac00743ba40b0000001976a914eb675c349c474bec8dea2d79d12cff6f330"
+        "ab48788ac00000000"));
+
+    const block_view instance(raw_block);
+    const auto expected = instance.to_block();
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(expected.is_valid());
+    BOOST_REQUIRE_EQUAL(instance.transactions().size(), 3u);
+    BOOST_REQUIRE_EQUAL(encode_hash(instance.hash()), encode_hash(expected.hash()));
+
+    size_t index = 0;
+    for (const auto& tx: instance.transactions())
+    {
+        const auto& transaction = expected.transactions()[index++];
+        BOOST_REQUIRE_EQUAL(encode_hash(tx.hash()), encode_hash(transaction.hash()));
+        BOOST_REQUIRE_EQUAL(tx.inputs().size(), transaction.inputs().size());
+        BOOST_REQUIRE_EQUAL(tx.outputs().size(), transaction.outputs().size());
+    }
+
+    BOOST_REQUIRE_EQUAL(index, 3u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
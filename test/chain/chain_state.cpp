@@ -58,4 +58,106 @@ BOOST_AUTO_TEST_CASE(chain_state__work_required_retarget__overflow_patch_enabled
     BOOST_REQUIRE_EQUAL(work, settings.proof_of_work_limit);
 }
 
+// Derive header states from a genesis state, tracking the expected histories.
+BOOST_AUTO_TEST_CASE(chain_state__header_states__rolling_summaries__match_histories)
+{
+    settings settings(config::settings::mainnet);
+    settings.activation_sample = 4;
+    settings.activation_threshold = 3;
+    settings.enforcement_threshold = 4;
+    const auto forks = machine::rule_fork::bip34_activations |
+        machine::rule_fork::bip34_rule | machine::rule_fork::bip66_rule |
+        machine::rule_fork::bip65_rule;
+
+    chain::chain_state::data values;
+    values.height = 0;
+    values.hash = null_hash;
+    values.bip9_bit0_hash = null_hash;
+    values.bip9_bit1_hash = null_hash;
+    values.bits.self = 0x1d00ffff;
+    values.version.self = 1;
+    values.timestamp.self = 1000;
+    values.timestamp.retarget = 1000;
+
+    auto state = std::make_shared<chain::chain_state>(std::move(values),
+        chain::chain_state::checkpoints{}, forks, 0, settings);
+
+    const std::vector<uint32_t> header_versions
+    {
+        1, 2, 2, 3, 2, 4, 4, 4, 4, 1, 4, 4, 3, 3, 3, 3, 4, 4, 4, 4
+    };
+
+    const std::vector<uint32_t> header_times
+    {
+        1012, 1003, 1030, 1004, 1001, 1050, 1050, 1020, 1011, 1100,
+        1090, 1005, 1200, 1210, 1190, 1205, 1300, 1250, 1260, 1280
+    };
+
+    std::vector<uint32_t> versions{ 1 };
+    std::vector<uint32_t> times{ 1000 };
+
+    for (size_t index = 0; index < header_versions.size(); ++index)
+    {
+        const chain::header header(header_versions[index], state->hash(),
+            null_hash, header_times[index], 0x1d00ffff, 0);
+        state = std::make_shared<chain::chain_state>(*state, header, settings);
+
+        // The histories exclude the new header's own values.
+        const auto version_start = versions.size() -
+            std::min(versions.size(), settings.activation_sample);
+        const auto time_start = times.size() -
+            std::min(times.size(), size_t(11));
+        std::vector<uint32_t> sorted(times.begin() + time_start, times.end());
+        std::sort(sorted.begin(), sorted.end());
+
+        const auto count = [&](uint32_t minimum)
+        {
+            return static_cast<size_t>(std::count_if(
+                versions.begin() + version_start, versions.end(),
+                [=](uint32_t version) { return version >= minimum; }));
+        };
+
+        auto minimum_version = settings.first_version;
+        if (count(4) >= settings.enforcement_threshold)
+            minimum_version = 4;
+        else if (count(3) >= settings.enforcement_threshold)
+            minimum_version = 3;
+        else if (count(2) >= settings.enforcement_threshold)
+            minimum_version = 2;
+
+        const auto bip34 = count(2) >= settings.activation_threshold &&
+            header_versions[index] >= 2;
+
+        BOOST_REQUIRE_EQUAL(state->median_time_past(), sorted[sorted.size() / 2]);
+        BOOST_REQUIRE_EQUAL(state->minimum_block_version(), minimum_version);
+        BOOST_REQUIRE_EQUAL(state->is_enabled(machine::rule_fork::bip34_rule), bip34);
+
+        versions.push_back(header_versions[index]);
+        times.push_back(header_times[index]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(chain_state__from_index__shared_index__checkpoint_conflict)
+{
+    const settings settings(config::settings::mainnet);
+    const auto hash = hash_literal("4a5e1e4baab89f3a32518a88c31bc87f618f76673e2cc77ab2127b7afdeda33b");
+    const auto index = std::make_shared<const config::checkpoint_index>(
+        config::checkpoint::list{ { hash, 1 } });
+
+    chain::chain_state::data values;
+    values.height = 1;
+    values.bits.ordered.push_back(0x1d00ffff);
+    values.version.ordered.push_back(1);
+    values.timestamp.ordered.push_back(1231006505);
+    values.timestamp.retarget = 0;
+
+    const auto state = chain::chain_state::from_index(std::move(values),
+        index, 0, 0, settings);
+    BOOST_REQUIRE(state);
+    BOOST_REQUIRE(state->is_under_checkpoint());
+    BOOST_REQUIRE(!state->is_checkpoint_conflict(hash));
+    BOOST_REQUIRE(state->is_checkpoint_conflict(null_hash));
+    BOOST_REQUIRE_EQUAL(index.use_count(), 2);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -225,4 +225,43 @@ BOOST_AUTO_TEST_CASE(compact__constructor2__hash__round_trips)
     BOOST_REQUIRE(to_uint256(primes) == compact(to_uint256(primes)));
 }
 
+// expand
+
+BOOST_AUTO_TEST_CASE(compact__expand__mainnet_limit__expected)
+{
+    hash_digest target;
+    BOOST_REQUIRE(compact::expand(target, 0x1d00ffff));
+    BOOST_REQUIRE_EQUAL(encode_hash(target), "00000000ffff0000000000000000000000000000000000000000000000000000");
+}
+
+BOOST_AUTO_TEST_CASE(compact__expand__small_exponent__shifted_right)
+{
+    hash_digest target;
+    BOOST_REQUIRE(compact::expand(target, 0x02123456));
+    BOOST_REQUIRE(uint256_t(target) == uint256_t(0x1234));
+}
+
+BOOST_AUTO_TEST_CASE(compact__expand__negative__zero)
+{
+    hash_digest target;
+    BOOST_REQUIRE(compact::expand(target, 0x04923456));
+    BOOST_REQUIRE(target == null_hash);
+}
+
+BOOST_AUTO_TEST_CASE(compact__expand__overflow__false_zero)
+{
+    hash_digest target;
+    BOOST_REQUIRE(!compact::expand(target, factory(252, false, 0xff)));
+    BOOST_REQUIRE(target == null_hash);
+}
+
+BOOST_AUTO_TEST_CASE(compact__expand__high_zero_mantissa_byte__matches_big)
+{
+    // The mantissa high byte is zero and would be beyond the hash.
+    static const uint32_t bits = 0x2100ffff;
+    hash_digest target;
+    BOOST_REQUIRE(compact::expand(target, bits));
+    BOOST_REQUIRE(uint256_t(target) == compact(bits));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
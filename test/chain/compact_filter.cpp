@@ -0,0 +1,143 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::chain;
+
+BOOST_AUTO_TEST_SUITE(compact_filter_tests)
+
+// The bip158 reference vectors are those of the testnet genesis block.
+static const std::string encoded_testnet_genesis =
+    "0100000000000000000000000000000000000000000000000000000000000000000000003ba3edfd7a7b12b27ac72c3e67768f617fc81bc3888a51323a9fb8aa4b1e5e4adae5494dffff001d1aa4ae18"
+    "0101000000010000000000000000000000000000000000000000000000000000000000000000ffffffff4d04ffff001d0104455468652054696d65732030332f4a616e2f32303039204368616e63656c6c6f72206f6e206272696e6b206f66207365636f6e64206261696c6f757420666f722062616e6b73ffffffff0100f2052a01000000434104678afdb0fe5548271967f1a67130b7105cd6a828e03909a67962e0ea1f61deb649f6bc3f4cef38c4f35504e51ec112de5c384df7ba0b8d578a4c702b6bf11d5fac00000000";
+
+static block testnet_genesis()
+{
+    data_chunk data;
+    BOOST_REQUIRE(decode_base16(data, encoded_testnet_genesis));
+    return block::factory(data);
+}
+
+static script make_script(uint8_t seed)
+{
+    return { script::to_pay_key_hash_pattern(short_hash{ { seed } }) };
+}
+
+// A coinbase paying to script 1 and a spend of script 2 paying to script 3.
+static block make_block(bool cached)
+{
+    const input coinbase_input(output_point(null_hash, point::null_index),
+        script{}, max_input_sequence);
+    const transaction coinbase(1u, 0u, { coinbase_input },
+        { { 50u, make_script(1) } });
+
+    const input spend_input(output_point(hash_literal(
+        "4a5e1e4baab89f3a32518a88c31bc87f618f76673e2cc77ab2127b7afdeda33b"), 0),
+        script{}, max_input_sequence);
+    const transaction spend(1u, 0u, { spend_input },
+        { { 40u, make_script(3) } });
+
+    chain::block out(header{}, { coinbase, spend });
+
+    if (cached)
+        out.transactions().back().inputs().front().previous_output().metadata
+            ->cache = output(41u, make_script(2));
+
+    return out;
+}
+
+BOOST_AUTO_TEST_CASE(compact_filter__build__testnet_genesis__expected)
+{
+    compact_filter instance;
+    data_chunk filter;
+    BOOST_REQUIRE(instance.build(filter, testnet_genesis()));
+    BOOST_REQUIRE_EQUAL(encode_base16(filter), "019dfca8");
+}
+
+BOOST_AUTO_TEST_CASE(compact_filter__to_header__testnet_genesis__expected)
+{
+    compact_filter instance;
+    data_chunk filter;
+    BOOST_REQUIRE(instance.build(filter, testnet_genesis()));
+    BOOST_REQUIRE(compact_filter::to_header(filter, null_hash) == hash_literal(
+        "21584579b7eb08997773e5aeff3a7f932700042d0ed2a6129012b7d7ae81b750"));
+}
+
+BOOST_AUTO_TEST_CASE(compact_filter__build__uncached_prevout__false)
+{
+    compact_filter instance;
+    data_chunk filter;
+    BOOST_REQUIRE(!instance.build(filter, make_block(false)));
+}
+
+BOOST_AUTO_TEST_CASE(compact_filter__match__outputs_and_prevouts__true)
+{
+    const auto block = make_block(true);
+    const auto hash = block.hash();
+    compact_filter instance;
+    data_chunk filter;
+    BOOST_REQUIRE(instance.build(filter, block));
+    BOOST_REQUIRE(compact_filter::match(filter, hash, make_script(1).bytes()));
+    BOOST_REQUIRE(compact_filter::match(filter, hash, make_script(2).bytes()));
+    BOOST_REQUIRE(compact_filter::match(filter, hash, make_script(3).bytes()));
+    BOOST_REQUIRE(!compact_filter::match(filter, hash, make_script(4).bytes()));
+}
+
+BOOST_AUTO_TEST_CASE(compact_filter__match_any__one_member__true)
+{
+    const auto block = make_block(true);
+    compact_filter instance;
+    data_chunk filter;
+    BOOST_REQUIRE(instance.build(filter, block));
+
+    const data_stack scripts
+    {
+        make_script(4).bytes(),
+        make_script(5).bytes(),
+        make_script(2).bytes()
+    };
+
+    BOOST_REQUIRE(instance.match_any(filter, block.hash(), scripts));
+}
+
+BOOST_AUTO_TEST_CASE(compact_filter__match_any__no_members__false)
+{
+    const auto block = make_block(true);
+    compact_filter instance;
+    data_chunk filter;
+    BOOST_REQUIRE(instance.build(filter, block));
+
+    const data_stack scripts
+    {
+        make_script(4).bytes(),
+        make_script(5).bytes()
+    };
+
+    BOOST_REQUIRE(!instance.match_any(filter, block.hash(), scripts));
+}
+
+BOOST_AUTO_TEST_CASE(compact_filter__match__empty_filter__false)
+{
+    BOOST_REQUIRE(!compact_filter::match({ 0x00 }, null_hash,
+        make_script(1).bytes()));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
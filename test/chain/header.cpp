@@ -422,6 +422,23 @@ BOOST_AUTO_TEST_CASE(header__is_valid_proof_of_work__hash_less_than_bits__return
     BOOST_REQUIRE(instance.is_valid_proof_of_work(settings.proof_of_work_limit, false));
 }
 
+BOOST_AUTO_TEST_CASE(header__is_valid_proof_of_work__bits_exceeds_changed_limit__returns_false)
+{
+    const settings settings(bc::config::settings::mainnet);
+    const chain::header instance(
+        4u,
+        hash_literal("000000000000000003ddc1e929e2944b8b0039af9aa0d826c480a83d8b39c373"),
+        hash_literal("a6cb0b0d6531a71abe2daaa4a991e5498e1b6b0b51549568d0f9d55329b905df"),
+        1474388414u,
+        402972254u,
+        2842832236u);
+
+    // The limit is not retained from a previous network.
+    BOOST_REQUIRE(instance.is_valid_proof_of_work(settings.proof_of_work_limit, false));
+    BOOST_REQUIRE(!instance.is_valid_proof_of_work(0x1700ffff, false));
+    BOOST_REQUIRE(instance.is_valid_proof_of_work(settings.proof_of_work_limit, false));
+}
+
 BOOST_AUTO_TEST_CASE(header__is_valid_scrypt_proof_of_work__hash_greater_than_bits__returns_false)
 {
     const settings settings(bc::config::settings::mainnet);
@@ -451,6 +468,23 @@ BOOST_AUTO_TEST_CASE(header__is_valid_scrypt_proof_of_work__hash_less_than_bits_
     BOOST_REQUIRE(!instance.is_valid_proof_of_work(settings.proof_of_work_limit, false));
 }
 
+BOOST_AUTO_TEST_CASE(header__is_valid_proof_of_work__scrypt_pow_hash__matches_scrypt)
+{
+    const settings settings(bc::config::settings::mainnet);
+    const chain::header instance(
+        536870912u,
+        hash_literal("313ced849aafeff324073bb2bd31ecdcc365ed215a34e827bb797ad33d158542"),
+        hash_literal("5163359dde15eb3f49cbd0926981f065ef1405fc9d4cece8818662b3b65f5dc6"),
+        1535119178u,
+        436332170u,
+        2135224651u);
+
+    const auto pow_hash = scrypt_hash(instance.to_data());
+    BOOST_REQUIRE(instance.is_valid_proof_of_work(settings.proof_of_work_limit, pow_hash));
+    BOOST_REQUIRE(!instance.is_valid_proof_of_work(settings.proof_of_work_limit, instance.hash()));
+    BOOST_REQUIRE_EQUAL(instance.check(settings.timestamp_limit_seconds, settings.proof_of_work_limit, pow_hash), error::success);
+}
+
 BOOST_AUTO_TEST_CASE(header__proof1__genesis_mainnet__expected)
 {
     BOOST_REQUIRE_EQUAL(chain::header::proof(0x1d00ffff), 0x0000000100010001);
@@ -539,4 +573,27 @@ BOOST_AUTO_TEST_CASE(header__operator_boolean_not_equals__differs__returns_true)
     BOOST_REQUIRE(instance != expected);
 }
 
+BOOST_AUTO_TEST_CASE(header__heap_size__always__zero)
+{
+    const chain::header instance(10u, null_hash, null_hash, 531234u, 6523454u, 68644u);
+    BOOST_REQUIRE_EQUAL(instance.heap_size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(header__to_wire_data__always__matches_to_data)
+{
+    const chain::header expected(10u, hash_literal(
+        "000000000019d6689c085ae165831e934ff763ae46a2a6c172b3f1b60a8ce26f"),
+        hash_literal("4a5e1e4baab89f3a32518a88c31bc87f618f76673e2cc77ab2127b7afdeda33b"),
+        531234u, 6523454u, 68644u);
+
+    const auto data = expected.to_wire_data();
+    BOOST_REQUIRE_EQUAL(chain::header::wire_size, chain::header::satoshi_fixed_size());
+    BOOST_REQUIRE(data_chunk(data.begin(), data.end()) == expected.to_data());
+
+    chain::header instance;
+    BOOST_REQUIRE(instance.from_wire_data(data));
+    BOOST_REQUIRE(expected == instance);
+    BOOST_REQUIRE(expected.hash() == instance.hash());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
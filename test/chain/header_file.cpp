@@ -0,0 +1,241 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <fstream>
+#include <boost/filesystem.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::chain;
+
+static const uint32_t easy_bits = 0x207fffff;
+
+// Test helpers.
+static boost::filesystem::path temporary_file()
+{
+    return boost::filesystem::temp_directory_path() /
+        boost::filesystem::unique_path("header_file-%%%%-%%%%.dat");
+}
+
+// Versions and timestamps are distinct by height and branch.
+static size_t extend(header_index& index, size_t position, size_t count,
+    uint32_t branch)
+{
+    for (size_t block = 0; block < count; ++block)
+    {
+        const auto height = static_cast<uint32_t>(index.height(position) + 1);
+        const header next(height + branch, index.header(position).hash(),
+            null_hash, 1000 * height + branch, easy_bits, branch);
+        BOOST_REQUIRE(index.insert(next));
+        position = index.find(next.hash());
+    }
+
+    return position;
+}
+
+static header_index get_index()
+{
+    header_index index({ 1, null_hash, null_hash, 0, easy_bits, 0 });
+    const auto fork = extend(index, 0, 20, 0);
+    extend(index, fork, 30, 0);
+    extend(index, fork, 10, 7);
+    return index;
+}
+
+static void require_equal(const header_index& expected, const header_file& file)
+{
+    BOOST_REQUIRE_EQUAL(file.size(), expected.size());
+    BOOST_REQUIRE_EQUAL(file.top(), expected.top());
+
+    for (size_t position = 0; position < expected.size(); ++position)
+    {
+        BOOST_REQUIRE(file.header(position) == expected.header(position));
+        BOOST_REQUIRE(file.hash(position) == expected.header(position).hash());
+        BOOST_REQUIRE(file.work(position) == expected.work(position));
+        BOOST_REQUIRE_EQUAL(file.height(position), expected.height(position));
+        BOOST_REQUIRE_EQUAL(file.parent(position), expected.parent(position));
+        BOOST_REQUIRE_EQUAL(file.skip(position), expected.skip(position));
+    }
+}
+
+static void require_equal(const shared_window<uint32_t>& window,
+    const header_index& index, size_t top, const chain_state::range& range,
+    uint32_t (header::*property)() const)
+{
+    BOOST_REQUIRE_EQUAL(window.size(), range.count);
+
+    for (size_t offset = 0; offset < range.count; ++offset)
+    {
+        const auto height = range.high + 1 - range.count + offset;
+        const auto& header = index.header(index.ancestor(top, height));
+        BOOST_REQUIRE_EQUAL(window[offset], (header.*property)());
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(header_file_tests)
+
+BOOST_AUTO_TEST_CASE(header_file__open__missing__false)
+{
+    header_file file;
+    BOOST_REQUIRE(!file.open("missing-header-file.dat"));
+    BOOST_REQUIRE(!file.is_open());
+}
+
+BOOST_AUTO_TEST_CASE(header_file__open__foreign__false)
+{
+    const auto path = temporary_file();
+    {
+        std::ofstream stream(path.string(), std::ios::binary);
+        stream << std::string(header_file::prefix_size + header_file::record_size, 'x');
+    }
+
+    header_file file;
+    BOOST_REQUIRE(!file.open(path));
+    BOOST_REQUIRE(!header_file::store(path, get_index()));
+    boost::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(header_file__store__index__entries_equal)
+{
+    const auto index = get_index();
+    const auto path = temporary_file();
+    BOOST_REQUIRE(header_file::store(path, index));
+    BOOST_REQUIRE_EQUAL(boost::filesystem::file_size(path),
+        header_file::prefix_size + index.size() * header_file::record_size);
+
+    header_file file;
+    BOOST_REQUIRE(file.open(path));
+    require_equal(index, file);
+
+    for (size_t height = 0; height <= index.height(index.top()); ++height)
+        BOOST_REQUIRE_EQUAL(file.ancestor(file.top(), height), index.ancestor(index.top(), height));
+
+    BOOST_REQUIRE_EQUAL(file.ancestor(0, 1), header_index::not_found);
+    file.close();
+    boost::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(header_file__store__extended_index__appended)
+{
+    auto index = get_index();
+    const auto path = temporary_file();
+    BOOST_REQUIRE(header_file::store(path, index));
+
+    // Extend the shorter branch beyond the top.
+    const auto fork = index.ancestor(index.top(), 20);
+    extend(index, index.size() - 1, 25, 7);
+    BOOST_REQUIRE(index.ancestor(index.top(), 20) == fork);
+    BOOST_REQUIRE(header_file::store(path, index));
+
+    header_file file;
+    BOOST_REQUIRE(file.open(path));
+    require_equal(index, file);
+    file.close();
+
+    // The stored entries must be those of the index.
+    BOOST_REQUIRE(!header_file::store(path, get_index()));
+    BOOST_REQUIRE(!header_file::store(path, header_index({ 2, null_hash, null_hash, 0, easy_bits, 0 })));
+    boost::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(header_file__construct_index__file__equal)
+{
+    const auto index = get_index();
+    const auto path = temporary_file();
+    BOOST_REQUIRE(header_file::store(path, index));
+
+    header_file file;
+    BOOST_REQUIRE(file.open(path));
+    const header_index restored(file);
+    file.close();
+
+    BOOST_REQUIRE_EQUAL(restored.size(), index.size());
+    BOOST_REQUIRE_EQUAL(restored.top(), index.top());
+    BOOST_REQUIRE(restored.locator(restored.top()) == index.locator(index.top()));
+
+    for (size_t position = 0; position < index.size(); ++position)
+        BOOST_REQUIRE_EQUAL(restored.find(index.header(position).hash()), position);
+
+    boost::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(header_file__populate__top__windows_of_branch)
+{
+    const auto index = get_index();
+    const auto path = temporary_file();
+    BOOST_REQUIRE(header_file::store(path, index));
+
+    header_file file;
+    BOOST_REQUIRE(file.open(path));
+
+    const auto top = index.top();
+    const auto height = index.height(top);
+    chain_state::map map;
+    map.bits = { 12, height - 1 };
+    map.bits_self = height;
+    map.version = { 20, height - 1 };
+    map.version_self = height;
+    map.timestamp = { 11, height - 1 };
+    map.timestamp_self = height;
+    map.timestamp_retarget = 3;
+    map.bip9_bit0_height = 5;
+    map.bip9_bit1_height = chain_state::map::unrequested;
+
+    chain_state::data data;
+    BOOST_REQUIRE(file.populate(data, map, top));
+    BOOST_REQUIRE_EQUAL(data.height, height);
+    BOOST_REQUIRE(data.hash == index.header(top).hash());
+    BOOST_REQUIRE(data.bip9_bit0_hash == index.header(index.ancestor(top, 5)).hash());
+    BOOST_REQUIRE(data.bip9_bit1_hash == null_hash);
+
+    const auto& header = index.header(top);
+    BOOST_REQUIRE_EQUAL(data.bits.self, header.bits());
+    BOOST_REQUIRE_EQUAL(data.version.self, header.version());
+    BOOST_REQUIRE_EQUAL(data.timestamp.self, header.timestamp());
+    BOOST_REQUIRE_EQUAL(data.timestamp.retarget, index.header(index.ancestor(top, 3)).timestamp());
+
+    require_equal(data.bits.ordered, index, top, map.bits, &header::bits);
+    require_equal(data.version.ordered, index, top, map.version, &header::version);
+    require_equal(data.timestamp.ordered, index, top, map.timestamp, &header::timestamp);
+    file.close();
+    boost::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(header_file__populate__window_above_entry__false)
+{
+    const auto index = get_index();
+    const auto path = temporary_file();
+    BOOST_REQUIRE(header_file::store(path, index));
+
+    header_file file;
+    BOOST_REQUIRE(file.open(path));
+
+    chain_state::map map{};
+    map.bits = { 2, index.height(index.top()) + 1 };
+
+    chain_state::data data;
+    BOOST_REQUIRE(!file.populate(data, map, index.top()));
+    BOOST_REQUIRE(!file.populate(data, map, index.size()));
+    file.close();
+    boost::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
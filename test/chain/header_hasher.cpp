@@ -0,0 +1,79 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::chain;
+
+BOOST_AUTO_TEST_SUITE(header_hasher_tests)
+
+static const header expected_header(
+    10u,
+    hash_literal("000000000000000003ddc1e929e2944b8b0039af9aa0d826c480a83d8b39c373"),
+    hash_literal("a6cb0b0d6531a71abe2daaa4a991e5498e1b6b0b51549568d0f9d55329b905df"),
+    1474388414u,
+    402972254u,
+    2842832236u);
+
+static hash_digest nonce_hash(uint32_t nonce)
+{
+    auto copy = expected_header;
+    copy.set_nonce(nonce);
+    return bitcoin_hash(copy.to_data());
+}
+
+BOOST_AUTO_TEST_CASE(header_hasher__hash__header_nonce__header_hash)
+{
+    const header_hasher hasher(expected_header);
+    BOOST_REQUIRE(hasher.hash(expected_header.nonce()) == expected_header.hash());
+}
+
+BOOST_AUTO_TEST_CASE(header_hasher__hash__nonce_list__expected)
+{
+    const header_hasher hasher(expected_header);
+    const std::vector<uint32_t> nonces{ 0, 1, 42, 0xffffffff, 7, 8, 9, 10, 11, 12, 13 };
+    hash_list hashes(nonces.size());
+    hasher.hash(nonces.data(), nonces.size(), hashes.data());
+
+    for (size_t index = 0; index < nonces.size(); ++index)
+        BOOST_REQUIRE(hashes[index] == nonce_hash(nonces[index]));
+}
+
+BOOST_AUTO_TEST_CASE(header_hasher__hash__consecutive_wrapping__expected)
+{
+    // Exceeds a nonce chunk, and the nonce wraps to zero.
+    static const uint32_t first = 0xffffffff - 99;
+    const header_hasher hasher(expected_header);
+    hash_list hashes(150);
+    hasher.hash(first, hashes.size(), hashes.data());
+
+    for (size_t index = 0; index < hashes.size(); ++index)
+        BOOST_REQUIRE(hashes[index] == nonce_hash(static_cast<uint32_t>(first + index)));
+}
+
+BOOST_AUTO_TEST_CASE(header_hasher__hash__zero_count__no_change)
+{
+    const header_hasher hasher(expected_header);
+    hash_digest hash = null_hash;
+    hasher.hash(uint32_t(0), 0, &hash);
+    BOOST_REQUIRE(hash == null_hash);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,168 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::chain;
+
+static const uint32_t easy_bits = 0x207fffff;
+
+// Test helpers.
+static header make_header(const hash_digest& previous, uint32_t nonce,
+    uint32_t bits=easy_bits)
+{
+    return{ 1, previous, null_hash, 0, bits, nonce };
+}
+
+static size_t extend(header_index& index, size_t position, size_t count,
+    uint32_t nonce)
+{
+    for (size_t block = 0; block < count; ++block)
+    {
+        const auto next = make_header(index.header(position).hash(), nonce);
+        BOOST_REQUIRE(index.insert(next));
+        position = index.find(next.hash());
+    }
+
+    return position;
+}
+
+static size_t walk_ancestor(const header_index& index, size_t position,
+    size_t height)
+{
+    while (index.height(position) > height)
+        position = index.parent(position);
+
+    return position;
+}
+
+BOOST_AUTO_TEST_SUITE(header_index_tests)
+
+BOOST_AUTO_TEST_CASE(header_index__construct__genesis__top)
+{
+    const auto genesis = make_header(null_hash, 0);
+    const header_index index(genesis);
+    BOOST_REQUIRE_EQUAL(index.size(), 1u);
+    BOOST_REQUIRE_EQUAL(index.top(), 0u);
+    BOOST_REQUIRE_EQUAL(index.find(genesis.hash()), 0u);
+    BOOST_REQUIRE_EQUAL(index.height(0), 0u);
+    BOOST_REQUIRE_EQUAL(index.parent(0), header_index::not_found);
+    BOOST_REQUIRE(index.work(0) == genesis.proof());
+    BOOST_REQUIRE_EQUAL(index.locator(0).size(), 1u);
+    BOOST_REQUIRE_EQUAL(index.locate({}), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(header_index__insert__orphan_or_duplicate__false)
+{
+    const auto genesis = make_header(null_hash, 0);
+    header_index index(genesis);
+    BOOST_REQUIRE(!index.insert(genesis));
+    BOOST_REQUIRE(!index.insert(make_header(hash_literal(
+        "000000000019d6689c085ae165831e934ff763ae46a2a6c172b3f1b60a8ce26f"),
+        1)));
+    BOOST_REQUIRE_EQUAL(index.find(null_hash), header_index::not_found);
+    BOOST_REQUIRE_EQUAL(index.size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(header_index__ancestor__linear__cumulative_work)
+{
+    header_index index(make_header(null_hash, 0));
+    const auto top = extend(index, 0, 1000, 1);
+    BOOST_REQUIRE_EQUAL(index.top(), top);
+    BOOST_REQUIRE_EQUAL(index.height(top), 1000u);
+    BOOST_REQUIRE(index.work(top) == index.work(0) * 1001);
+    BOOST_REQUIRE_EQUAL(index.ancestor(top, 1001), header_index::not_found);
+
+    // Positions are in insertion order, which is height order here.
+    for (size_t height = 0; height <= 1000; ++height)
+        BOOST_REQUIRE_EQUAL(index.ancestor(top, height), height);
+}
+
+BOOST_AUTO_TEST_CASE(header_index__ancestor__random_tree__same_as_walk)
+{
+    std::mt19937 random(7);
+    header_index index(make_header(null_hash, 0));
+    index.reserve(2001);
+
+    for (uint32_t nonce = 1; nonce <= 2000; ++nonce)
+    {
+        const auto parent = random() % index.size();
+        BOOST_REQUIRE(index.insert(make_header(index.header(parent).hash(),
+            nonce)));
+    }
+
+    for (size_t test = 0; test < 2000; ++test)
+    {
+        const size_t position = random() % index.size();
+        const size_t height = random() % (index.height(position) + 1);
+        BOOST_REQUIRE_EQUAL(index.ancestor(position, height),
+            walk_ancestor(index, position, height));
+
+        const size_t other = random() % index.size();
+        auto first = position;
+        auto second = other;
+
+        while (first != second)
+        {
+            if (index.height(first) >= index.height(second))
+                first = index.parent(first);
+            else
+                second = index.parent(second);
+        }
+
+        BOOST_REQUIRE_EQUAL(index.fork_point(position, other), first);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(header_index__top__heavier_branch__reorganized)
+{
+    header_index index(make_header(null_hash, 0));
+    const auto main = extend(index, 0, 100, 1);
+    const auto fork = index.ancestor(main, 60);
+    const auto main_locator = index.locator(main);
+
+    // An equal work branch does not displace the first.
+    const auto branch = extend(index, fork, 40, 2);
+    BOOST_REQUIRE_EQUAL(index.top(), main);
+    BOOST_REQUIRE_EQUAL(index.fork_point(main, branch), fork);
+
+    const auto longer = extend(index, branch, 1, 2);
+    BOOST_REQUIRE_EQUAL(index.top(), longer);
+    BOOST_REQUIRE_EQUAL(index.fork_point(longer, main), fork);
+    BOOST_REQUIRE_EQUAL(index.fork_point(fork, longer), fork);
+
+    // The main locator meets the new top branch at or below the fork.
+    const auto located = index.locate(main_locator);
+    BOOST_REQUIRE(index.height(located) <= 60u);
+    BOOST_REQUIRE_EQUAL(index.ancestor(main, index.height(located)),
+        located);
+
+    const auto locator = index.locator(longer);
+    BOOST_REQUIRE_EQUAL(locator.size(), block::locator_heights(101).size());
+    BOOST_REQUIRE(locator.front() == index.header(longer).hash());
+    BOOST_REQUIRE(locator.back() == index.header(0).hash());
+    BOOST_REQUIRE_EQUAL(index.locate(locator), longer);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -167,7 +167,7 @@ BOOST_AUTO_TEST_CASE(input__is_locked__enabled_block_type_sequence_age_equals_mi
     static const auto age = 7u;
     static const auto sequence_enabled_block_type_minimum = age;
     input instance({}, {}, sequence_enabled_block_type_minimum);
-    auto& prevout = instance.previous_output().metadata;
+    auto& prevout = *instance.previous_output().metadata;
     prevout.height = 42;
     BOOST_REQUIRE(!instance.is_locked(prevout.height + age, 0));
 }
@@ -177,7 +177,7 @@ BOOST_AUTO_TEST_CASE(input__is_locked__enabled_block_type_sequence_age_above_min
     static const auto age = 7u;
     static const auto sequence_enabled_block_type_minimum = age - 1;
     input instance({}, {}, sequence_enabled_block_type_minimum);
-    auto& prevout = instance.previous_output().metadata;
+    auto& prevout = *instance.previous_output().metadata;
     prevout.height = 42;
     BOOST_REQUIRE(!instance.is_locked(prevout.height + age, 0));
 }
@@ -187,7 +187,7 @@ BOOST_AUTO_TEST_CASE(input__is_locked__enabled_block_type_sequence_age_below_min
     static const auto age = 7u;
     static const auto sequence_enabled_block_type_minimum = age + 1;
     input instance({}, {}, sequence_enabled_block_type_minimum);
-    auto& prevout = instance.previous_output().metadata;
+    auto& prevout = *instance.previous_output().metadata;
     prevout.height = 42;
     BOOST_REQUIRE(instance.is_locked(prevout.height + age, 0));
 }
@@ -197,7 +197,7 @@ BOOST_AUTO_TEST_CASE(input__is_locked__disabled_block_type_sequence_age_below_mi
     static const auto age = 7u;
     static const auto sequence_disabled_block_type_minimum = relative_locktime_disabled | (age + 1);
     input instance({}, {}, sequence_disabled_block_type_minimum);
-    auto& prevout = instance.previous_output().metadata;
+    auto& prevout = *instance.previous_output().metadata;
     prevout.height = 42;
     BOOST_REQUIRE(!instance.is_locked(prevout.height + age, 0));
 }
@@ -208,7 +208,7 @@ BOOST_AUTO_TEST_CASE(input__is_locked__enabled_time_type_sequence_age_equals_min
     static const auto age_seconds = 7u << relative_locktime_seconds_shift;
     static const auto sequence_enabled_time_type_minimum = relative_locktime_time_locked | age;
     input instance({}, {}, sequence_enabled_time_type_minimum);
-    auto& prevout = instance.previous_output().metadata;
+    auto& prevout = *instance.previous_output().metadata;
     prevout.median_time_past = 42;
     BOOST_REQUIRE(!instance.is_locked(0, prevout.median_time_past + age_seconds));
 }
@@ -219,7 +219,7 @@ BOOST_AUTO_TEST_CASE(input__is_locked__enabled_time_type_sequence_age_above_mini
     static const auto age_seconds = 7u << relative_locktime_seconds_shift;
     static const auto sequence_enabled_time_type_minimum = relative_locktime_time_locked | (age - 1);
     input instance({}, {}, sequence_enabled_time_type_minimum);
-    auto& prevout = instance.previous_output().metadata;
+    auto& prevout = *instance.previous_output().metadata;
     prevout.median_time_past = 42;
     BOOST_REQUIRE(!instance.is_locked(0, prevout.median_time_past + age_seconds));
 }
@@ -230,7 +230,7 @@ BOOST_AUTO_TEST_CASE(input__is_locked__enabled_time_type_sequence_age_below_mini
     static const auto age_seconds = 7u << relative_locktime_seconds_shift;
     static const auto sequence_enabled_time_type_minimum = relative_locktime_time_locked | (age + 1);
     input instance({}, {}, sequence_enabled_time_type_minimum);
-    auto& prevout = instance.previous_output().metadata;
+    auto& prevout = *instance.previous_output().metadata;
     prevout.median_time_past = 42;
     BOOST_REQUIRE(instance.is_locked(0, prevout.median_time_past + age_seconds));
 }
@@ -241,7 +241,7 @@ BOOST_AUTO_TEST_CASE(input__is_locked__disabled_time_type_sequence_age_below_min
     static const auto age_seconds = 7u << relative_locktime_seconds_shift;
     static const auto sequence_disabled_time_type_minimum = relative_locktime_disabled | relative_locktime_time_locked | (age + 1);
     input instance({}, {}, sequence_disabled_time_type_minimum);
-    auto& prevout = instance.previous_output().metadata;
+    auto& prevout = *instance.previous_output().metadata;
     prevout.median_time_past = 42;
     BOOST_REQUIRE(!instance.is_locked(0, prevout.median_time_past + age_seconds));
 }
@@ -266,6 +266,36 @@ BOOST_AUTO_TEST_CASE(input__signature_operations__bip16_active_cache_empty__retu
     BOOST_REQUIRE_EQUAL(script.sigops(false), instance.signature_operations(true, false));
 }
 
+// Test helper.
+static input pay_script_hash_input(const data_chunk& embedded)
+{
+    const script redeem(embedded, false);
+    input instance;
+    instance.set_script(script(script::operation::list{ { embedded } }));
+    auto& cache = instance.previous_output().metadata->cache;
+    cache.set_value(42);
+    cache.set_script(script::to_pay_script_hash_pattern(bitcoin_short_hash(redeem.to_data(false))));
+    return instance;
+}
+
+BOOST_AUTO_TEST_CASE(input__signature_operations__bip16_active_cache_populated__returns_embedded_sigops)
+{
+    const auto instance = pay_script_hash_input(to_chunk(base16_literal("52ae")));
+    BOOST_REQUIRE_EQUAL(instance.signature_operations(true, false), 2u);
+    BOOST_REQUIRE_EQUAL(instance.signature_operations(true, false), 2u);
+    BOOST_REQUIRE_EQUAL(instance.signature_operations(false, false), 0u);
+    BOOST_REQUIRE_EQUAL(instance.signature_operations(true, true), 8u);
+}
+
+BOOST_AUTO_TEST_CASE(input__signature_operations__set_script_after_cached__recounted)
+{
+    auto instance = pay_script_hash_input(to_chunk(base16_literal("52ae")));
+    BOOST_REQUIRE_EQUAL(instance.signature_operations(true, false), 2u);
+    const auto embedded = to_chunk(base16_literal("53ae"));
+    instance.set_script(script(script::operation::list{ { embedded } }));
+    BOOST_REQUIRE_EQUAL(instance.signature_operations(true, false), 3u);
+}
+
 BOOST_AUTO_TEST_CASE(input__previous_output_setter_1__roundtrip__success)
 {
     const output_point value
@@ -390,4 +420,16 @@ BOOST_AUTO_TEST_CASE(input__operator_boolean_not_equals__differs__returns_true)
     BOOST_REQUIRE(alpha != beta);
 }
 
+BOOST_AUTO_TEST_CASE(input__heap_size__populated_previous_output__includes_output)
+{
+    const auto instance = input::factory(valid_raw_input);
+    const auto initial = instance.heap_size();
+    BOOST_REQUIRE_GE(initial, instance.script().serialized_size(false));
+
+    const output prevout(42, script(data_chunk(100, 0x51), false));
+    instance.previous_output().metadata->cache = prevout;
+    BOOST_REQUIRE_EQUAL(instance.heap_size(), initial +
+        sizeof(output_point::validation) + prevout.heap_size());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,183 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::chain;
+
+BOOST_AUTO_TEST_SUITE(merkle_tree_tests)
+
+static hash_list leaves(size_t count)
+{
+    hash_list hashes;
+    for (size_t index = 0; index < count; ++index)
+        hashes.push_back(bitcoin_hash(to_chunk(to_little_endian(static_cast<uint32_t>(index)))));
+
+    return hashes;
+}
+
+static hash_digest expected_root(hash_list hashes)
+{
+    while (hashes.size() > 1)
+        merkle_hash_level(hashes);
+
+    return hashes.empty() ? null_hash : hashes.front();
+}
+
+static block make_block(size_t count, uint32_t nonce=0)
+{
+    transaction::list transactions;
+    for (size_t index = 0; index < count; ++index)
+        transactions.push_back({ 1, static_cast<uint32_t>(index), { { { null_hash, 0 }, {}, 0 } }, { { 1, {} } } });
+
+    header header;
+    header.set_nonce(nonce);
+    return block(std::move(header), std::move(transactions));
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree__construct__empty__null_root)
+{
+    const merkle_tree tree(hash_list{});
+    BOOST_REQUIRE_EQUAL(tree.size(), 0u);
+    BOOST_REQUIRE(tree.root() == null_hash);
+    BOOST_REQUIRE(tree.all_levels().empty());
+    BOOST_REQUIRE(tree.branch(0).empty());
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree__construct__single__leaf_root_empty_branch)
+{
+    const auto hashes = leaves(1);
+    const merkle_tree tree(hashes);
+    BOOST_REQUIRE_EQUAL(tree.size(), 1u);
+    BOOST_REQUIRE(tree.root() == hashes.front());
+    BOOST_REQUIRE(tree.branch(0).empty());
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree__root__sizes__expected)
+{
+    for (size_t count = 1; count <= 33; ++count)
+    {
+        const auto hashes = leaves(count);
+        const merkle_tree tree(hashes);
+        BOOST_REQUIRE_EQUAL(tree.size(), count);
+        BOOST_REQUIRE(tree.root() == expected_root(hashes));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree__branch__all_indexes__proves_root)
+{
+    for (size_t count = 1; count <= 33; ++count)
+    {
+        const auto hashes = leaves(count);
+        const merkle_tree tree(hashes);
+
+        for (size_t index = 0; index < count; ++index)
+        {
+            const auto branch = tree.branch(index);
+            BOOST_REQUIRE_EQUAL(branch.size(), tree.all_levels().size() - 1u);
+            BOOST_REQUIRE(merkle_tree::root(hashes[index], branch, index) == tree.root());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree__branch__odd_last__self_sibling)
+{
+    const auto hashes = leaves(3);
+    const merkle_tree tree(hashes);
+    const auto branch = tree.branch(2);
+    BOOST_REQUIRE_EQUAL(branch.size(), 2u);
+    BOOST_REQUIRE(branch[0] == hashes[2]);
+    BOOST_REQUIRE(branch[1] == merkle_hash(hashes[0], hashes[1]));
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree__branch__out_of_range__empty)
+{
+    const merkle_tree tree(leaves(5));
+    BOOST_REQUIRE(tree.branch(5).empty());
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree__construct__block__generated_merkle_root)
+{
+    const auto instance = make_block(7);
+    const merkle_tree tree(instance);
+    BOOST_REQUIRE_EQUAL(tree.size(), 7u);
+    BOOST_REQUIRE(tree.root() == instance.generate_merkle_root());
+}
+
+BOOST_AUTO_TEST_CASE(coinbase_merkle__root__changed_first_leaf__expected)
+{
+    for (size_t count = 1; count <= 33; ++count)
+    {
+        auto hashes = leaves(count);
+        const coinbase_merkle incremental(hashes);
+        BOOST_REQUIRE_EQUAL(incremental.size(), count);
+        BOOST_REQUIRE(incremental.branch() == merkle_tree(hashes).branch(0));
+
+        for (uint32_t extranonce = 0; extranonce < 3; ++extranonce)
+        {
+            hashes.front() = bitcoin_hash(to_chunk(to_little_endian(extranonce)));
+            BOOST_REQUIRE(incremental.root(hashes.front()) == expected_root(hashes));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(coinbase_merkle__construct__block__generated_merkle_roots)
+{
+    const auto instance = make_block(9);
+    const auto& coinbase = instance.transactions().front();
+    BOOST_REQUIRE(coinbase_merkle(instance).root(coinbase.hash()) == instance.generate_merkle_root());
+    BOOST_REQUIRE(coinbase_merkle(instance, true).root(coinbase.hash(true)) == instance.generate_merkle_root(true));
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree_cache__get__same_block__cached)
+{
+    merkle_tree_cache cache(2);
+    const auto instance = make_block(5);
+    const auto tree = cache.get(instance);
+    BOOST_REQUIRE(tree->root() == instance.generate_merkle_root());
+    BOOST_REQUIRE(cache.get(instance) == tree);
+    BOOST_REQUIRE(cache.get(instance, true) != tree);
+    BOOST_REQUIRE_EQUAL(cache.size(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree_cache__get__over_capacity__evicts_oldest)
+{
+    merkle_tree_cache cache(1);
+    const auto first = make_block(2);
+    const auto second = make_block(3, 42);
+
+    const auto tree = cache.get(first);
+    cache.get(second);
+    BOOST_REQUIRE_EQUAL(cache.size(), 1u);
+    BOOST_REQUIRE(cache.get(first) != tree);
+
+    cache.clear();
+    BOOST_REQUIRE_EQUAL(cache.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree_cache__get__zero_capacity__not_cached)
+{
+    merkle_tree_cache cache(0);
+    const auto instance = make_block(2);
+    BOOST_REQUIRE(cache.get(instance) != cache.get(instance));
+    BOOST_REQUIRE_EQUAL(cache.size(), 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -17,6 +17,8 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <random>
 #include <bitcoin/bitcoin.hpp>
 
 using namespace bc;
@@ -230,4 +232,76 @@ BOOST_AUTO_TEST_CASE(output__operator_boolean_not_equals__differs__returns_true)
     BOOST_REQUIRE(alpha != beta);
 }
 
+BOOST_AUTO_TEST_CASE(output__to_compact__values__roundtrip)
+{
+    static const uint64_t values[] =
+    {
+        0, 1, 9, 10, 643, 5000000000, 2099999997690000, (uint64_t(1) << 56) - 1,
+        uint64_t(1) << 56, max_uint64 - 1, chain::output::not_found
+    };
+
+    for (const auto value: values)
+    {
+        const chain::output instance(value, chain::script{});
+        const auto compact = instance.to_compact();
+        BOOST_REQUIRE_EQUAL(instance.compact_size(), compact.size());
+
+        chain::output result;
+        BOOST_REQUIRE(result.from_compact(compact));
+        BOOST_REQUIRE_EQUAL(result.value(), value);
+        BOOST_REQUIRE(result == instance);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(output__to_compact__round_value__single_byte)
+{
+    // One coin is 10^8, so the value is one group and the script is empty.
+    const chain::output instance(100000000, chain::script{});
+    BOOST_REQUIRE_EQUAL(encode_base16(instance.to_compact()), "0904");
+}
+
+BOOST_AUTO_TEST_CASE(output__from_compact__escaped_below_limit__invalid)
+{
+    // The value one has a shorter form than the escape.
+    const auto data = to_chunk(base16_literal(
+        "8efefefefefefeff00010000000000000004"));
+    chain::output instance;
+    BOOST_REQUIRE(!instance.from_compact(data));
+    BOOST_REQUIRE(!instance.is_valid());
+}
+
+BOOST_AUTO_TEST_CASE(output__from_compact__decompressed_at_limit__invalid)
+{
+    // This code decompresses to 2^56, which must be escaped.
+    const auto data = to_chunk(base16_literal("87fefefefefefefe7d04"));
+    chain::output instance;
+    BOOST_REQUIRE(!instance.from_compact(data));
+}
+
+BOOST_AUTO_TEST_CASE(output__from_compact__random__symmetrical)
+{
+    std::mt19937_64 random(42);
+
+    for (size_t round = 0; round < 10000; ++round)
+    {
+        data_chunk data(random() % 24);
+        for (auto& byte: data)
+            byte = static_cast<uint8_t>(random() % 256);
+
+        chain::output instance;
+        if (instance.from_compact(data))
+        {
+            const auto compact = instance.to_compact();
+            BOOST_REQUIRE(std::equal(compact.begin(), compact.end(),
+                data.begin()));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(output__heap_size__valid_output__script_heap_size)
+{
+    const auto instance = chain::output::factory(valid_raw_output);
+    BOOST_REQUIRE_EQUAL(instance.heap_size(), instance.script().heap_size());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
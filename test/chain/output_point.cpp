@@ -189,8 +189,8 @@ BOOST_AUTO_TEST_CASE(output_point__is_mature__mature_coinbase_prevout__returns_t
 {
     size_t target_height = 162u;
     chain::output_point instance(hash1, 42);
-    instance.metadata.height = 50u;
-    instance.metadata.coinbase = true;
+    instance.metadata->height = 50u;
+    instance.metadata->coinbase = true;
     BOOST_REQUIRE(!instance.is_null());
     BOOST_REQUIRE(instance.is_mature(target_height));
 }
@@ -199,8 +199,8 @@ BOOST_AUTO_TEST_CASE(output_point__is_mature__immature_coinbase_prevout__returns
 {
     size_t target_height = 162u;
     chain::output_point instance(hash1, 42);
-    instance.metadata.height = 100u;
-    instance.metadata.coinbase = true;
+    instance.metadata->height = 100u;
+    instance.metadata->coinbase = true;
     BOOST_REQUIRE(!instance.is_null());
     BOOST_REQUIRE(!instance.is_mature(target_height));
 }
@@ -209,8 +209,8 @@ BOOST_AUTO_TEST_CASE(output_point__is_mature__immature_coinbase_prevout_null_inp
 {
     size_t target_height = 162u;
     chain::output_point instance(null_hash, chain::point::null_index);
-    instance.metadata.height = 100u;
-    instance.metadata.coinbase = true;
+    instance.metadata->height = 100u;
+    instance.metadata->coinbase = true;
     BOOST_REQUIRE(instance.is_null());
     BOOST_REQUIRE(instance.is_mature(target_height));
 }
@@ -219,8 +219,8 @@ BOOST_AUTO_TEST_CASE(output_point__is_mature__mature_non_coinbase_prevout__retur
 {
     size_t target_height = 162u;
     chain::output_point instance(hash1, 42);
-    instance.metadata.height = 50u;
-    instance.metadata.coinbase = false;
+    instance.metadata->height = 50u;
+    instance.metadata->coinbase = false;
     BOOST_REQUIRE(!instance.is_null());
     BOOST_REQUIRE(instance.is_mature(target_height));
 }
@@ -229,12 +229,28 @@ BOOST_AUTO_TEST_CASE(output_point__is_mature__immature_non_coinbase_prevout__ret
 {
     size_t target_height = 162u;
     chain::output_point instance(hash1, 42);
-    instance.metadata.height = 100u;
-    instance.metadata.coinbase = false;
+    instance.metadata->height = 100u;
+    instance.metadata->coinbase = false;
     BOOST_REQUIRE(!instance.is_null());
     BOOST_REQUIRE(instance.is_mature(target_height));
 }
 
+BOOST_AUTO_TEST_CASE(output_point__is_mature__unpopulated__true_unallocated)
+{
+    const chain::output_point instance(hash1, 42);
+    BOOST_REQUIRE(instance.is_mature(162u));
+    BOOST_REQUIRE(!instance.metadata);
+}
+
+BOOST_AUTO_TEST_CASE(output_point__copy__populated__copies_metadata)
+{
+    chain::output_point instance(hash1, 42);
+    instance.metadata->height = 100u;
+    const auto copy = instance;
+    BOOST_REQUIRE(copy.metadata.peek() != instance.metadata.peek());
+    BOOST_REQUIRE_EQUAL(copy.metadata->height, 100u);
+}
+
 BOOST_AUTO_TEST_CASE(output_point__operator_assign_equals_1__always__matches_equivalent)
 {
     chain::output_point expected;
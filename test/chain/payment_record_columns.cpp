@@ -0,0 +1,123 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::chain;
+
+BOOST_AUTO_TEST_SUITE(payment_record_columns_tests)
+
+static payment_record::list make_records(bool wire)
+{
+    payment_record::list records;
+
+    for (uint32_t row = 0; row < 10; ++row)
+    {
+        const auto link = wire ? max_uint64 : 4096u + row * 250u;
+        const auto index = row == 4 ? point::null_index : row;
+        records.emplace_back(link, index, 5000u + row, row % 3 == 0);
+
+        if (wire)
+        {
+            hash_digest hash(null_hash);
+            hash[0] = static_cast<uint8_t>(row);
+            records.back().set_height(500 + row);
+            records.back().set_hash(std::move(hash));
+        }
+    }
+
+    return records;
+}
+
+BOOST_AUTO_TEST_CASE(payment_record_columns__constructor_1__always__invalid)
+{
+    const payment_record_columns instance;
+    BOOST_REQUIRE(!instance.is_valid());
+}
+
+BOOST_AUTO_TEST_CASE(payment_record_columns__factory__wire_roundtrip__expected)
+{
+    const payment_record_columns expected(make_records(true));
+    const auto data = expected.to_data(true);
+    BOOST_REQUIRE_EQUAL(data.size(), expected.serialized_size(true));
+
+    const auto instance = payment_record_columns::factory(data, true);
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(instance == expected);
+}
+
+BOOST_AUTO_TEST_CASE(payment_record_columns__factory__store_roundtrip__expected)
+{
+    const payment_record_columns expected(make_records(false));
+    const auto data = expected.to_data(false);
+    BOOST_REQUIRE_EQUAL(data.size(), expected.serialized_size(false));
+
+    // Delta links, packed flags and base128 indexes beat fixed rows.
+    const auto rows = expected.records().size();
+    BOOST_REQUIRE_LT(data.size(), rows * payment_record::satoshi_fixed_size(false));
+
+    const auto instance = payment_record_columns::factory(data, false);
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(instance == expected);
+}
+
+BOOST_AUTO_TEST_CASE(payment_record_columns__from_data__height_range__matching_rows)
+{
+    const payment_record_columns expected(make_records(true));
+    const auto data = expected.to_data(true);
+
+    payment_record_columns instance;
+    byte_reader source(data);
+    BOOST_REQUIRE(instance.from_data(source, 503, 505));
+    BOOST_REQUIRE(source.is_exhausted());
+
+    const auto& records = instance.records();
+    BOOST_REQUIRE_EQUAL(records.size(), 3u);
+    BOOST_REQUIRE(records[0] == expected.records()[3]);
+    BOOST_REQUIRE(records[1] == expected.records()[4]);
+    BOOST_REQUIRE(records[2] == expected.records()[5]);
+}
+
+BOOST_AUTO_TEST_CASE(payment_record_columns__from_data__outside_range__skipped)
+{
+    const payment_record_columns expected(make_records(true));
+    auto data = expected.to_data(true);
+    extend_data(data, expected.to_data(true));
+
+    payment_record_columns instance;
+    byte_reader source(data);
+    BOOST_REQUIRE(instance.from_data(source, 0, 499));
+    BOOST_REQUIRE(instance.records().empty());
+    BOOST_REQUIRE(instance.from_data(source, true));
+    BOOST_REQUIRE(instance == expected);
+    BOOST_REQUIRE(source.is_exhausted());
+}
+
+BOOST_AUTO_TEST_CASE(payment_record_columns__from_data__truncated__invalid)
+{
+    const payment_record_columns expected(make_records(false));
+    auto data = expected.to_data(false);
+    data.pop_back();
+
+    const auto instance = payment_record_columns::factory(data, false);
+    BOOST_REQUIRE(!instance.is_valid());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <unordered_set>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::chain;
+
+BOOST_AUTO_TEST_SUITE(point_link_tests)
+
+BOOST_AUTO_TEST_CASE(point_link__size__twelve_bytes)
+{
+    BOOST_REQUIRE_EQUAL(sizeof(point_link), 12u);
+    BOOST_REQUIRE_LT(sizeof(point_link) * 2, sizeof(hash_digest) + sizeof(uint32_t));
+}
+
+BOOST_AUTO_TEST_CASE(point_link__constructor_1__always__unlinked_null_index)
+{
+    const point_link instance;
+    BOOST_REQUIRE(!instance.is_linked());
+    BOOST_REQUIRE_EQUAL(instance.link(), transaction::validation::unlinked);
+    BOOST_REQUIRE_EQUAL(instance.index(), point::null_index);
+}
+
+BOOST_AUTO_TEST_CASE(point_link__constructor_2__high_link__round_trips)
+{
+    const uint64_t link = 0x0123456789abcdef;
+    const point_link instance(link, 42);
+    BOOST_REQUIRE(instance.is_linked());
+    BOOST_REQUIRE_EQUAL(instance.link(), link);
+    BOOST_REQUIRE_EQUAL(instance.index(), 42u);
+}
+
+BOOST_AUTO_TEST_CASE(point_link__constructor_3__linked_transaction__link_and_index)
+{
+    transaction tx;
+    BOOST_REQUIRE(!point_link(tx, 1).is_linked());
+    BOOST_REQUIRE(!tx.metadata);
+
+    tx.metadata.get().link = 1234;
+    const point_link instance(tx, 1);
+    BOOST_REQUIRE_EQUAL(instance.link(), 1234u);
+    BOOST_REQUIRE_EQUAL(instance.index(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(point_link__to_point__hash__round_trips)
+{
+    const auto hash = hash_literal("4a5e1e4baab89f3a32518a88c31bc87f618f76673e2cc77ab2127b7afdeda33b");
+    const output_point expected{ hash, 7 };
+    const point_link instance(expected, 99);
+    BOOST_REQUIRE_EQUAL(instance.link(), 99u);
+    BOOST_REQUIRE(instance.to_point(hash) == expected);
+}
+
+BOOST_AUTO_TEST_CASE(point_link__operators__link_then_index__expected)
+{
+    const point_link first(1, 5);
+    const point_link second(2, 0);
+    const point_link third(2, 1);
+    BOOST_REQUIRE(first < second);
+    BOOST_REQUIRE(second < third);
+    BOOST_REQUIRE(!(third < second));
+    BOOST_REQUIRE(second == point_link(2, 0));
+    BOOST_REQUIRE(second != third);
+    BOOST_REQUIRE(point_link(uint64_t(1) << 32, 0) != point_link(1, 0));
+}
+
+BOOST_AUTO_TEST_CASE(point_link__hash__sequential_links__distinct)
+{
+    std::unordered_set<point_link> points;
+
+    for (uint64_t link = 0; link < 1000; ++link)
+        for (uint32_t index = 0; index < 4; ++index)
+            BOOST_REQUIRE(points.emplace(link, index).second);
+
+    std::unordered_set<size_t> hashes;
+
+    for (const auto& point: points)
+        hashes.insert(point.hash());
+
+    BOOST_REQUIRE_EQUAL(hashes.size(), points.size());
+    BOOST_REQUIRE_EQUAL(points.count(point_link(999, 3)), 1u);
+    BOOST_REQUIRE_EQUAL(points.count(point_link(999, 4)), 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
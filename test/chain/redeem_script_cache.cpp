@@ -0,0 +1,169 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <memory>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::chain;
+
+BOOST_AUTO_TEST_SUITE(redeem_script_cache_tests)
+
+#define MULTISIG_1_OF_2 "1 [03dcfd9e580de35d8c2060d76dbf9e5561fe20febd2e64380e860a4d59f15ac864] [02440e0304bf8d32b2012994393c6a477acf238dd6adb4c3cef5bfa72f30c9861c] 2 checkmultisig"
+
+static redeem_script_cache::script_ptr make_script(const std::string& mnemonic)
+{
+    const auto instance = std::make_shared<script>();
+    BOOST_REQUIRE(instance->from_string(mnemonic));
+    return instance;
+}
+
+static short_hash to_hash(const redeem_script_cache::script_ptr& script)
+{
+    return bitcoin_short_hash(script->bytes());
+}
+
+BOOST_AUTO_TEST_CASE(redeem_script_cache__construct__default__disabled)
+{
+    redeem_script_cache cache;
+    const auto script = make_script(MULTISIG_1_OF_2);
+    const auto hash = to_hash(script);
+    BOOST_REQUIRE(!cache.enabled());
+    BOOST_REQUIRE_EQUAL(cache.capacity(), 0u);
+    cache.insert(hash, script);
+
+    redeem_script_cache::entry entry;
+    BOOST_REQUIRE(!cache.find(entry, hash, script->bytes()));
+    BOOST_REQUIRE_EQUAL(cache.size(), 0u);
+    BOOST_REQUIRE_EQUAL(cache.bytes(), 0u);
+    BOOST_REQUIRE_EQUAL(cache.hits(), 0u);
+    BOOST_REQUIRE_EQUAL(cache.misses(), 0u);
+    BOOST_REQUIRE_EQUAL(cache.hit_rate(), 0.0f);
+}
+
+BOOST_AUTO_TEST_CASE(redeem_script_cache__find__inserted__shared_decoded_with_sigops)
+{
+    redeem_script_cache cache(100000);
+    const auto script = make_script(MULTISIG_1_OF_2);
+    const auto hash = to_hash(script);
+    BOOST_REQUIRE(cache.enabled());
+
+    redeem_script_cache::entry entry;
+    BOOST_REQUIRE(!cache.find(entry, hash, script->bytes()));
+    cache.insert(hash, script);
+    BOOST_REQUIRE(cache.find(entry, hash, script->bytes()));
+    BOOST_REQUIRE_EQUAL(entry.script, script);
+    BOOST_REQUIRE_EQUAL(entry.sigops, 2u);
+    BOOST_REQUIRE_EQUAL(cache.size(), 1u);
+    BOOST_REQUIRE_GT(cache.bytes(), redeem_script_cache::entry_overhead);
+    BOOST_REQUIRE_EQUAL(cache.hits(), 1u);
+    BOOST_REQUIRE_EQUAL(cache.misses(), 1u);
+    BOOST_REQUIRE_EQUAL(cache.hit_rate(), 0.5f);
+}
+
+BOOST_AUTO_TEST_CASE(redeem_script_cache__find__distinct_bytes__miss)
+{
+    redeem_script_cache cache(100000);
+    const auto script = make_script(MULTISIG_1_OF_2);
+    const auto hash = to_hash(script);
+    cache.insert(hash, script);
+
+    auto bytes = script->bytes();
+    bytes.back() ^= 1;
+
+    redeem_script_cache::entry entry;
+    BOOST_REQUIRE(!cache.find(entry, hash, bytes));
+    BOOST_REQUIRE(!cache.find(entry, null_short_hash, script->bytes()));
+    BOOST_REQUIRE_EQUAL(cache.misses(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(redeem_script_cache__insert__full__bounded)
+{
+    const auto make_indexed = [](uint8_t index)
+    {
+        return make_script("[" + encode_base16(data_chunk{ index }) + "] drop " MULTISIG_1_OF_2);
+    };
+
+    // Scripts of the same shape have the same cost.
+    redeem_script_cache probe(100000);
+    const auto first = make_indexed(0);
+    probe.insert(to_hash(first), first);
+    redeem_script_cache cache(2 * probe.bytes());
+
+    for (uint8_t index = 0; index < 10; ++index)
+    {
+        const auto script = make_indexed(index);
+        cache.insert(to_hash(script), script);
+        BOOST_REQUIRE_LE(cache.bytes(), cache.capacity());
+    }
+
+    BOOST_REQUIRE_EQUAL(cache.size(), 2u);
+    BOOST_REQUIRE_EQUAL(cache.bytes(), cache.capacity());
+}
+
+BOOST_AUTO_TEST_CASE(redeem_script_cache__resize__zero__empty_disabled)
+{
+    redeem_script_cache cache(100000);
+    const auto script = make_script(MULTISIG_1_OF_2);
+    cache.insert(to_hash(script), script);
+    BOOST_REQUIRE_EQUAL(cache.size(), 1u);
+    cache.resize(0);
+    BOOST_REQUIRE(!cache.enabled());
+    BOOST_REQUIRE_EQUAL(cache.size(), 0u);
+    BOOST_REQUIRE_EQUAL(cache.bytes(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(redeem_script_cache__clear__populated__empty_counters_retained)
+{
+    redeem_script_cache cache(100000);
+    const auto script = make_script(MULTISIG_1_OF_2);
+    const auto hash = to_hash(script);
+    cache.insert(hash, script);
+
+    redeem_script_cache::entry entry;
+    BOOST_REQUIRE(cache.find(entry, hash, script->bytes()));
+    cache.clear();
+    BOOST_REQUIRE(cache.enabled());
+    BOOST_REQUIRE_EQUAL(cache.size(), 0u);
+    BOOST_REQUIRE_EQUAL(cache.bytes(), 0u);
+    BOOST_REQUIRE_EQUAL(cache.hits(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(redeem_script_cache__redeem_scripts__p2sh_verify__cached_and_reused)
+{
+    auto& cache = redeem_script_cache::redeem_scripts();
+    cache.resize(100000);
+
+    // [1 1 drop] leaves a true stack.
+    const data_chunk redeem{ 0x51, 0x51, 0x75 };
+    const script input_script(script::operation::list{ { redeem } });
+    const script prevout_script(script::to_pay_script_hash_pattern(bitcoin_short_hash(redeem)));
+    const transaction tx{ 1, 0, { { { null_hash, 0 }, input_script, 0 } }, { { 1, {} } } };
+    const auto forks = machine::rule_fork::bip16_rule;
+    const auto hits = cache.hits();
+
+    BOOST_REQUIRE_EQUAL(script::verify(tx, 0, forks, prevout_script, 1).value(), error::success);
+    BOOST_REQUIRE_EQUAL(cache.size(), 1u);
+    BOOST_REQUIRE_EQUAL(script::verify(tx, 0, forks, prevout_script, 1).value(), error::success);
+    BOOST_REQUIRE_EQUAL(cache.hits(), hits + 1u);
+    cache.resize(0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
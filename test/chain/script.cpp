@@ -95,7 +95,7 @@ transaction new_tx(const script_test& test)
 
     // Assign output script to input's prevout validation metadata.
     output_point outpoint;
-    outpoint.metadata.cache.set_script(std::move(output_script));
+    outpoint.metadata->cache.set_script(std::move(output_script));
 
     // Cosntruct transaction with one input and no outputs.
     return transaction
@@ -130,6 +130,50 @@ std::string test_name(const script_test& test)
     return out.str();
 }
 
+transaction sighash_transaction()
+{
+    return transaction
+    {
+        1,
+        42,
+        input::list
+        {
+            { { hash_literal("b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee097"), 0 }, script{}, 0xffffffff },
+            { { hash_literal("0bb3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee0"), 1 }, script{ { opcode::push_positive_1 } }, 0xfffffffe },
+            { { hash_literal("970bb3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496e"), 2 }, script{}, 42 }
+        },
+        output::list
+        {
+            { 100000, script::to_pay_key_hash_pattern(short_hash{}) },
+            { 200000, script::to_pay_key_hash_pattern(short_hash{ { 42 } }) }
+        }
+    };
+}
+
+// The unoptimized preimage construction, used to verify the cached midstates.
+hash_digest sighash_reference(const transaction& tx, uint32_t index,
+    const script& script_code, uint8_t sighash_type)
+{
+    input::list ins;
+    const auto& inputs = tx.inputs();
+    const auto any = (sighash_type & sighash_algorithm::anyone_can_pay) != 0;
+
+    for (uint32_t position = 0; position < inputs.size(); ++position)
+    {
+        const auto& input = inputs[position];
+
+        if (position == index)
+            ins.emplace_back(input.previous_output(), script_code, input.sequence());
+        else if (!any)
+            ins.emplace_back(input.previous_output(), script{}, input.sequence());
+    }
+
+    const transaction out(tx.version(), tx.locktime(), ins, tx.outputs());
+    auto serialized = out.to_data(true, false);
+    extend_data(serialized, to_little_endian(static_cast<uint32_t>(sighash_type)));
+    return bitcoin_hash(serialized);
+}
+
 BOOST_AUTO_TEST_SUITE(script_tests)
 
 // Serialization tests.
@@ -604,6 +648,37 @@ BOOST_AUTO_TEST_CASE(script__checksig__normal__success)
     BOOST_REQUIRE(script::check_signature(signature, sighash_algorithm::single, pubkey, script_code, parent_tx, index));
 }
 
+BOOST_AUTO_TEST_CASE(script__record_signatures__attached_then_detached__counts_attached_checks)
+{
+    data_chunk tx_data;
+    decode_base16(tx_data, "0100000002dc38e9359bd7da3b58386204e186d9408685f427f5e513666db735aa8a6b2169000000006a47304402205d8feeb312478e468d0b514e63e113958d7214fa572acd87079a7f0cc026fc5c02200fa76ea05bf243af6d0f9177f241caf606d01fcfd5e62d6befbca24e569e5c27032102100a1a9ca2c18932d6577c58f225580184d0e08226d41959874ac963e3c1b2feffffffffdc38e9359bd7da3b58386204e186d9408685f427f5e513666db735aa8a6b2169010000006b4830450220087ede38729e6d35e4f515505018e659222031273b7366920f393ee3ab17bc1e022100ca43164b757d1a6d1235f13200d4b5f76dd8fda4ec9fc28546b2df5b1211e8df03210275983913e60093b767e85597ca9397fb2f418e57f998d6afbbc536116085b1cbffffffff0140899500000000001976a914fcc9b36d38cf55d7d5b4ee4dddb6b2c17612f48c88ac00000000");
+    transaction parent_tx;
+    BOOST_REQUIRE(parent_tx.from_data(tx_data));
+
+    data_chunk distinguished;
+    decode_base16(distinguished, "304402205d8feeb312478e468d0b514e63e113958d7214fa572acd87079a7f0cc026fc5c02200fa76ea05bf243af6d0f9177f241caf606d01fcfd5e62d6befbca24e569e5c27");
+
+    data_chunk pubkey;
+    decode_base16(pubkey, "02100a1a9ca2c18932d6577c58f225580184d0e08226d41959874ac963e3c1b2fe");
+
+    data_chunk script_data;
+    decode_base16(script_data, "76a914fcc9b36d38cf55d7d5b4ee4dddb6b2c17612f48c88ac");
+
+    script script_code;
+    BOOST_REQUIRE(script_code.from_data(script_data, false));
+
+    ec_signature signature;
+    BOOST_REQUIRE(parse_signature(signature, distinguished, true));
+
+    machine::script_profile::operation_metrics metrics{ 0, {} };
+    script::record_signatures(&metrics);
+    BOOST_REQUIRE(script::check_signature(signature, sighash_algorithm::single, pubkey, script_code, parent_tx, 0));
+    BOOST_REQUIRE(!script::check_signature(signature, sighash_algorithm::single, pubkey, script_code, parent_tx, 1));
+    script::record_signatures(nullptr);
+    BOOST_REQUIRE(script::check_signature(signature, sighash_algorithm::single, pubkey, script_code, parent_tx, 0));
+    BOOST_REQUIRE_EQUAL(metrics.count, 2u);
+}
+
 BOOST_AUTO_TEST_CASE(script__create_endorsement__single_input_single_output__expected)
 {
     data_chunk tx_data;
@@ -667,6 +742,63 @@ BOOST_AUTO_TEST_CASE(script__generate_signature_hash__all__expected)
     BOOST_REQUIRE_EQUAL(result, expected);
 }
 
+BOOST_AUTO_TEST_CASE(script__generate_signature_hash__all_multiple_inputs__expected)
+{
+    const auto tx = sighash_transaction();
+    const script prevout_script(script::to_pay_key_hash_pattern(short_hash{ { 1 } }));
+    const auto sighash_type = sighash_algorithm::all;
+
+    for (uint32_t index = 0; index < tx.inputs().size(); ++index)
+    {
+        const auto sighash = script::generate_signature_hash(tx, index, prevout_script, sighash_type);
+        BOOST_REQUIRE_EQUAL(encode_base16(sighash), encode_base16(sighash_reference(tx, index, prevout_script, sighash_type)));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(script__generate_signature_hash__all_anyone_can_pay_multiple_inputs__expected)
+{
+    const auto tx = sighash_transaction();
+    const script prevout_script(script::to_pay_key_hash_pattern(short_hash{ { 1 } }));
+    const auto sighash_type = sighash_algorithm::all | sighash_algorithm::anyone_can_pay;
+
+    for (uint32_t index = 0; index < tx.inputs().size(); ++index)
+    {
+        const auto sighash = script::generate_signature_hash(tx, index, prevout_script, sighash_type);
+        BOOST_REQUIRE_EQUAL(encode_base16(sighash), encode_base16(sighash_reference(tx, index, prevout_script, sighash_type)));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(script__generate_signature_hash__all_codeseparator__stripped)
+{
+    const auto tx = sighash_transaction();
+    const script stripped(script::to_pay_key_hash_pattern(short_hash{ { 1 } }));
+    auto ops = stripped.operations();
+    ops.insert(ops.begin(), operation{ opcode::codeseparator });
+    const script prevout_script(ops);
+    const auto sighash_type = sighash_algorithm::all;
+
+    const auto sighash = script::generate_signature_hash(tx, 1, prevout_script, sighash_type);
+    BOOST_REQUIRE_EQUAL(encode_base16(sighash), encode_base16(sighash_reference(tx, 1, stripped, sighash_type)));
+}
+
+BOOST_AUTO_TEST_CASE(script__generate_signature_hash__all_modified_transaction__expected)
+{
+    auto tx = sighash_transaction();
+    const script prevout_script(script::to_pay_key_hash_pattern(short_hash{ { 1 } }));
+    const auto sighash_type = sighash_algorithm::all;
+    const auto original = script::generate_signature_hash(tx, 2, prevout_script, sighash_type);
+
+    tx.set_locktime(tx.locktime() + 1);
+    const auto sighash = script::generate_signature_hash(tx, 2, prevout_script, sighash_type);
+    BOOST_REQUIRE(sighash != original);
+    BOOST_REQUIRE_EQUAL(encode_base16(sighash), encode_base16(sighash_reference(tx, 2, prevout_script, sighash_type)));
+
+    auto outputs = tx.outputs();
+    outputs.pop_back();
+    tx.set_outputs(outputs);
+    BOOST_REQUIRE_EQUAL(encode_base16(script::generate_signature_hash(tx, 2, prevout_script, sighash_type)), encode_base16(sighash_reference(tx, 2, prevout_script, sighash_type)));
+}
+
 // Ad-hoc test cases.
 //-----------------------------------------------------------------------------
 
@@ -696,7 +828,7 @@ BOOST_AUTO_TEST_CASE(script__native__block_290329_tx__valid)
     BOOST_REQUIRE_GT(tx.inputs().size(), index);
 
     const auto& input = tx.inputs()[index];
-    auto& prevout = input.previous_output().metadata.cache;
+    auto& prevout = input.previous_output().metadata->cache;
 
     prevout.set_script(script::factory(decoded_script, false));
     BOOST_REQUIRE(prevout.script().is_valid());
@@ -735,7 +867,7 @@ BOOST_AUTO_TEST_CASE(script__native__block_438513_tx__valid)
     BOOST_REQUIRE_GT(tx.inputs().size(), index);
 
     const auto& input = tx.inputs()[index];
-    auto& prevout = input.previous_output().metadata.cache;
+    auto& prevout = input.previous_output().metadata->cache;
 
     prevout.set_script(script::factory(decoded_script, false));
     BOOST_REQUIRE(prevout.script().is_valid());
@@ -772,7 +904,7 @@ BOOST_AUTO_TEST_CASE(script__native__block_481824_tx__valid)
     BOOST_REQUIRE_GT(tx.inputs().size(), index);
 
     const auto& input = tx.inputs()[index];
-    auto& prevout = input.previous_output().metadata.cache;
+    auto& prevout = input.previous_output().metadata->cache;
 
     prevout.set_value(value);
     prevout.set_script(script::factory(decoded_script, false));
@@ -809,7 +941,7 @@ BOOST_AUTO_TEST_CASE(script__native__testnet_block_892321_tx_missing_witness__in
     BOOST_REQUIRE_GT(tx.inputs().size(), index);
 
     const auto& input = tx.inputs()[index];
-    auto& prevout = input.previous_output().metadata.cache;
+    auto& prevout = input.previous_output().metadata->cache;
 
     prevout.set_value(value);
     prevout.set_script(script::factory(decoded_script, false));
@@ -831,13 +963,13 @@ BOOST_AUTO_TEST_CASE(script__native__bip143_native_p2wpkh_tx__valid)
     BOOST_REQUIRE(tx.from_data(decoded_tx, true, true));
     BOOST_REQUIRE_EQUAL(tx.inputs().size(), 2u);
 
-    auto& prevout0 = tx.inputs()[0].previous_output().metadata.cache;
+    auto& prevout0 = tx.inputs()[0].previous_output().metadata->cache;
     BOOST_REQUIRE(decode_base16(decoded_script, "2103c9f4836b9a4f77fc0d81f7bcb01b7f1b35916864b9476c241ce9fc198bd25432ac"));
     prevout0.set_script(script::factory(decoded_script, false));
     prevout0.set_value(625000000);
     BOOST_REQUIRE(prevout0.script().is_valid());
 
-    auto& prevout1 = tx.inputs()[1].previous_output().metadata.cache;
+    auto& prevout1 = tx.inputs()[1].previous_output().metadata->cache;
     BOOST_REQUIRE(decode_base16(decoded_script, "00141d0f172a0ecb48aee1be1f2687d2963ae33f71a1"));
     prevout1.set_script(script::factory(decoded_script, false));
     prevout1.set_value(600000000);
@@ -877,7 +1009,7 @@ BOOST_AUTO_TEST_CASE(script__native__bip143_p2sh_p2wpkh_tx__valid)
     BOOST_REQUIRE(tx.from_data(decoded_tx, true, true));
     BOOST_REQUIRE_EQUAL(tx.inputs().size(), 1u);
 
-    auto& prevout0 = tx.inputs()[0].previous_output().metadata.cache;
+    auto& prevout0 = tx.inputs()[0].previous_output().metadata->cache;
     BOOST_REQUIRE(decode_base16(decoded_script, "a9144733f37cf4db86fbc2efed2500b4f4e49f31202387"));
     prevout0.set_script(script::factory(decoded_script, false));
     prevout0.set_value(1000000000);
@@ -909,13 +1041,13 @@ BOOST_AUTO_TEST_CASE(script__native__bip143_native_p2wsh_1_tx__valid)
     BOOST_REQUIRE(tx.from_data(decoded_tx, true, true));
     BOOST_REQUIRE_EQUAL(tx.inputs().size(), 2u);
 
-    auto& prevout0 = tx.inputs()[0].previous_output().metadata.cache;
+    auto& prevout0 = tx.inputs()[0].previous_output().metadata->cache;
     BOOST_REQUIRE(decode_base16(decoded_script, "21036d5c20fa14fb2f635474c1dc4ef5909d4568e5569b79fc94d3448486e14685f8ac"));
     prevout0.set_script(script::factory(decoded_script, false));
     prevout0.set_value(156250000);
     BOOST_REQUIRE(prevout0.script().is_valid());
 
-    auto& prevout1 = tx.inputs()[1].previous_output().metadata.cache;
+    auto& prevout1 = tx.inputs()[1].previous_output().metadata->cache;
     BOOST_REQUIRE(decode_base16(decoded_script, "00205d1b56b63d714eebe542309525f484b7e9d6f686b3781b6f61ef925d66d6f6a0"));
     prevout1.set_script(script::factory(decoded_script, false));
     prevout1.set_value(4900000000);
@@ -950,13 +1082,13 @@ BOOST_AUTO_TEST_CASE(script__native__bip143_native_p2wsh_2_tx__valid)
     BOOST_REQUIRE(decode_base16(decoded_tx, "01000000000102e9b542c5176808107ff1df906f46bb1f2583b16112b95ee5380665ba7fcfc0010000000000ffffffff80e68831516392fcd100d186b3c2c7b95c80b53c77e77c35ba03a66b429a2a1b0000000000ffffffff0280969800000000001976a914de4b231626ef508c9a74a8517e6783c0546d6b2888ac80969800000000001976a9146648a8cd4531e1ec47f35916de8e259237294d1e88ac02483045022100f6a10b8604e6dc910194b79ccfc93e1bc0ec7c03453caaa8987f7d6c3413566002206216229ede9b4d6ec2d325be245c5b508ff0339bf1794078e20bfe0babc7ffe683270063ab68210392972e2eb617b2388771abe27235fd5ac44af8e61693261550447a4c3e39da98ac024730440220032521802a76ad7bf74d0e2c218b72cf0cbc867066e2e53db905ba37f130397e02207709e2188ed7f08f4c952d9d13986da504502b8c3be59617e043552f506c46ff83275163ab68210392972e2eb617b2388771abe27235fd5ac44af8e61693261550447a4c3e39da98ac00000000"));
     BOOST_REQUIRE(tx.from_data(decoded_tx, true, true));
 
-    auto& prevout0 = tx.inputs()[0].previous_output().metadata.cache;
+    auto& prevout0 = tx.inputs()[0].previous_output().metadata->cache;
     BOOST_REQUIRE(decode_base16(decoded_script, "0020ba468eea561b26301e4cf69fa34bde4ad60c81e70f059f045ca9a79931004a4d"));
     prevout0.set_script(script::factory(decoded_script, false));
     prevout0.set_value(16777215);
     BOOST_REQUIRE(prevout0.script().is_valid());
 
-    auto& prevout1 = tx.inputs()[1].previous_output().metadata.cache;
+    auto& prevout1 = tx.inputs()[1].previous_output().metadata->cache;
     BOOST_REQUIRE(decode_base16(decoded_script, "0020d9bbfbe56af7c4b7f960a70d7ea107156913d9e5a26b0a71429df5e097ca6537"));
     prevout1.set_script(script::factory(decoded_script, false));
     prevout1.set_value(16777215);
@@ -999,13 +1131,13 @@ BOOST_AUTO_TEST_CASE(script__native__bip143_native_p2wsh_2_tx__valid)
     BOOST_REQUIRE(tx.from_data(decoded_tx, true, true));
     BOOST_REQUIRE_EQUAL(tx.inputs().size(), 2u);
 
-    auto& prevout2 = tx.inputs()[0].previous_output().metadata.cache;
+    auto& prevout2 = tx.inputs()[0].previous_output().metadata->cache;
     BOOST_REQUIRE(decode_base16(decoded_script, "0020d9bbfbe56af7c4b7f960a70d7ea107156913d9e5a26b0a71429df5e097ca6537"));
     prevout2.set_script(script::factory(decoded_script, false));
     prevout2.set_value(16777215);
     BOOST_REQUIRE(prevout2.script().is_valid());
 
-    auto& prevout3 = tx.inputs()[1].previous_output().metadata.cache;
+    auto& prevout3 = tx.inputs()[1].previous_output().metadata->cache;
     BOOST_REQUIRE(decode_base16(decoded_script, "0020ba468eea561b26301e4cf69fa34bde4ad60c81e70f059f045ca9a79931004a4d"));
     prevout3.set_script(script::factory(decoded_script, false));
     prevout3.set_value(16777215);
@@ -1029,7 +1161,7 @@ BOOST_AUTO_TEST_CASE(script__native__bip143_p2sh_p2wsh_tx__valid)
     BOOST_REQUIRE(tx.from_data(decoded_tx, true, true));
     BOOST_REQUIRE_EQUAL(tx.inputs().size(), 1u);
 
-    auto& prevout0 = tx.inputs()[0].previous_output().metadata.cache;
+    auto& prevout0 = tx.inputs()[0].previous_output().metadata->cache;
     BOOST_REQUIRE(decode_base16(decoded_script, "a9149993a429037b5d912407a71c252019287b8d27a587"));
     prevout0.set_script(script::factory(decoded_script, false));
     prevout0.set_value(987654321);
@@ -1061,7 +1193,7 @@ BOOST_AUTO_TEST_CASE(script__native__bip143_no_find_and_delete_tx__valid)
     BOOST_REQUIRE(tx.from_data(decoded_tx, true, true));
     BOOST_REQUIRE_EQUAL(tx.inputs().size(), 1u);
 
-    auto& prevout0 = tx.inputs()[0].previous_output().metadata.cache;
+    auto& prevout0 = tx.inputs()[0].previous_output().metadata->cache;
     BOOST_REQUIRE(decode_base16(decoded_script, "00209e1be07558ea5cc8e02ed1d80c0911048afad949affa36d5c3951e3159dbea19"));
     prevout0.set_script(script::factory(decoded_script, false));
     prevout0.set_value(200000);
@@ -1080,4 +1212,479 @@ BOOST_AUTO_TEST_CASE(script__native__bip143_no_find_and_delete_tx__valid)
     BOOST_REQUIRE_EQUAL(result0.value(), error::incorrect_signature);
 }
 
+// Standard verification tests.
+//------------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(script__verify_standard__script_vectors__same_as_interpreted)
+{
+    const std::vector<script_test_list> lists
+    {
+        valid_bip16_scripts, invalidated_bip16_scripts, valid_bip65_scripts,
+        invalid_bip65_scripts, invalidated_bip65_scripts,
+        valid_multisig_scripts, invalid_multisig_scripts,
+        valid_context_free_scripts, invalid_context_free_scripts
+    };
+
+    const std::vector<uint32_t> forks
+    {
+        rule_fork::no_rules, rule_fork::bip66_rule, rule_fork::all_rules
+    };
+
+    for (const auto& list: lists)
+    {
+        for (const auto& test: list)
+        {
+            const auto tx = new_tx(test);
+            const auto name = test_name(test);
+            BOOST_REQUIRE_MESSAGE(tx.is_valid(), name);
+            const auto& prevout = tx.inputs()[0].previous_output().metadata->cache;
+
+            for (const auto rules: forks)
+            {
+                const auto interpreted = script::verify_interpreted(tx, 0, rules, prevout.script(), prevout.value());
+                BOOST_CHECK_MESSAGE(script::verify(tx, 0, rules) == interpreted, name);
+
+                if (script::verify_standard(tx, 0, rules, prevout.script(), prevout.value()))
+                    BOOST_CHECK_MESSAGE(interpreted == error::success, name);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(script__verify__shared_context__same_as_unshared)
+{
+    const std::vector<script_test_list> lists
+    {
+        valid_bip16_scripts, invalidated_bip16_scripts,
+        valid_multisig_scripts, invalid_multisig_scripts,
+        valid_context_free_scripts, invalid_context_free_scripts
+    };
+
+    verification_context context;
+
+    for (const auto& list: lists)
+    {
+        for (const auto& test: list)
+        {
+            const auto tx = new_tx(test);
+            const auto name = test_name(test);
+            BOOST_REQUIRE_MESSAGE(tx.is_valid(), name);
+            const auto expected = script::verify(tx, 0, rule_fork::all_rules);
+            BOOST_CHECK_MESSAGE(script::verify(tx, 0, rule_fork::all_rules, context) == expected, name);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(script__verify__multisig_pool__same_as_serial)
+{
+    const std::vector<script_test_list> lists
+    {
+        valid_bip16_scripts, invalidated_bip16_scripts,
+        valid_multisig_scripts, invalid_multisig_scripts,
+        valid_context_free_scripts, invalid_context_free_scripts
+    };
+
+    threadpool pool(2);
+    verification_context context;
+    context.set_multisig_pool(&pool);
+
+    for (const auto& list: lists)
+    {
+        for (const auto& test: list)
+        {
+            const auto tx = new_tx(test);
+            const auto name = test_name(test);
+            BOOST_REQUIRE_MESSAGE(tx.is_valid(), name);
+
+            for (const auto forks: { rule_fork::no_rules, rule_fork::all_rules })
+            {
+                const auto expected = script::verify(tx, 0, forks);
+                BOOST_CHECK_MESSAGE(script::verify(tx, 0, forks, context) == expected, name);
+            }
+        }
+    }
+
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(script__verify_standard__bip143_native_p2wpkh_tx__same_as_interpreted)
+{
+    transaction tx;
+    data_chunk decoded_tx;
+    data_chunk decoded_script;
+    BOOST_REQUIRE(decode_base16(decoded_tx, "01000000000102fff7f7881a8099afa6940d42d1e7f6362bec38171ea3edf433541db4e4ad969f00000000494830450221008b9d1dc26ba6a9cb62127b02742fa9d754cd3bebf337f7a55d114c8e5cdd30be022040529b194ba3f9281a99f2b1c0a19c0489bc22ede944ccf4ecbab4cc618ef3ed01eeffffffef51e1b804cc89d182d279655c3aa89e815b1b309fe287d9b2b55d57b90ec68a0100000000ffffffff02202cb206000000001976a9148280b37df378db99f66f85c95a783a76ac7a6d5988ac9093510d000000001976a9143bde42dbee7e4dbe6a21b2d50ce2f0167faa815988ac000247304402203609e17b84f6a7d30c80bfa610b5b4542f32a8a0d5447a12fb1366d7f01cc44a0220573a954c4518331561406f90300e8f3358f51928d43c212a8caed02de67eebee0121025476c2e83188368da1ff3e292e7acafcdb3566bb0ad253f62fc70f07aeee635711000000"));
+    BOOST_REQUIRE(tx.from_data(decoded_tx, true, true));
+    BOOST_REQUIRE_EQUAL(tx.inputs().size(), 2u);
+
+    BOOST_REQUIRE(decode_base16(decoded_script, "00141d0f172a0ecb48aee1be1f2687d2963ae33f71a1"));
+    const auto prevout = script::factory(decoded_script, false);
+    static const uint64_t value = 600000000;
+
+    // P2WPKH witness program.
+    const auto forks = rule_fork::bip141_rule | rule_fork::bip143_rule;
+    BOOST_REQUIRE(script::verify_standard(tx, 1, forks, prevout, value));
+    BOOST_REQUIRE_EQUAL(script::verify_interpreted(tx, 1, forks, prevout, value).value(), error::success);
+
+    // The interpreter determines the failure code.
+    BOOST_REQUIRE(!script::verify_standard(tx, 1, rule_fork::bip141_rule, prevout, value));
+    BOOST_REQUIRE(!script::verify_standard(tx, 1, rule_fork::bip143_rule, prevout, value));
+    BOOST_REQUIRE(!script::verify_standard(tx, 1, forks, prevout, value + 1));
+    BOOST_REQUIRE_EQUAL(script::verify(tx, 1, rule_fork::bip141_rule, prevout, value).value(), error::stack_false);
+    BOOST_REQUIRE_EQUAL(script::verify(tx, 1, rule_fork::bip143_rule, prevout, value).value(), error::unexpected_witness);
+}
+
+BOOST_AUTO_TEST_CASE(script__verify_standard__bip143_p2sh_p2wpkh_tx__same_as_interpreted)
+{
+    transaction tx;
+    data_chunk decoded_tx;
+    data_chunk decoded_script;
+    BOOST_REQUIRE(decode_base16(decoded_tx, "01000000000101db6b1b20aa0fd7b23880be2ecbd4a98130974cf4748fb66092ac4d3ceb1a5477010000001716001479091972186c449eb1ded22b78e40d009bdf0089feffffff02b8b4eb0b000000001976a914a457b684d7f0d539a46a45bbc043f35b59d0d96388ac0008af2f000000001976a914fd270b1ee6abcaea97fea7ad0402e8bd8ad6d77c88ac02473044022047ac8e878352d3ebbde1c94ce3a10d057c24175747116f8288e5d794d12d482f0220217f36a485cae903c713331d877c1f64677e3622ad4010726870540656fe9dcb012103ad1d8e89212f0b92c74d23bb710c00662ad1470198ac48c43f7d6f93a2a2687392040000"));
+    BOOST_REQUIRE(tx.from_data(decoded_tx, true, true));
+    BOOST_REQUIRE_EQUAL(tx.inputs().size(), 1u);
+
+    BOOST_REQUIRE(decode_base16(decoded_script, "a9144733f37cf4db86fbc2efed2500b4f4e49f31202387"));
+    const auto prevout = script::factory(decoded_script, false);
+    static const uint64_t value = 1000000000;
+
+    // P2SH-P2WPKH witness program.
+    const auto forks = rule_fork::bip16_rule | rule_fork::bip141_rule | rule_fork::bip143_rule;
+    BOOST_REQUIRE(script::verify_standard(tx, 0, forks, prevout, value));
+    BOOST_REQUIRE_EQUAL(script::verify_interpreted(tx, 0, forks, prevout, value).value(), error::success);
+
+    // The interpreter determines the failure code.
+    BOOST_REQUIRE(!script::verify_standard(tx, 0, rule_fork::bip141_rule | rule_fork::bip143_rule, prevout, value));
+    BOOST_REQUIRE(!script::verify_standard(tx, 0, rule_fork::bip16_rule | rule_fork::bip141_rule, prevout, value));
+    BOOST_REQUIRE_EQUAL(script::verify(tx, 0, rule_fork::bip16_rule | rule_fork::bip141_rule, prevout, value).value(), error::stack_false);
+}
+
+// Serialized patterns.
+//-----------------------------------------------------------------------------
+
+static bool byte_patterns_match(const script& instance)
+{
+    const auto& ops = instance.operations();
+    const auto& bytes = instance.bytes();
+    data_slice data(bytes);
+
+    return script::is_pay_null_data_pattern(bytes) == script::is_pay_null_data_pattern(ops)
+        && script::is_pay_public_key_pattern(data, bytes) == script::is_pay_public_key_pattern(ops)
+        && script::is_pay_key_hash_pattern(data, bytes) == script::is_pay_key_hash_pattern(ops)
+        && script::is_pay_script_hash_pattern(data, bytes) == script::is_pay_script_hash_pattern(ops)
+        && script::is_pay_witness_script_hash_pattern(data, bytes) == script::is_pay_witness_script_hash_pattern(ops);
+}
+
+BOOST_AUTO_TEST_CASE(script__byte_patterns__script_vectors__same_as_operations)
+{
+    const std::vector<script_test_list> lists
+    {
+        valid_bip16_scripts, invalidated_bip16_scripts, valid_bip65_scripts,
+        invalid_bip65_scripts, invalidated_bip65_scripts,
+        valid_multisig_scripts, invalid_multisig_scripts,
+        valid_context_free_scripts, invalid_context_free_scripts
+    };
+
+    for (const auto& list: lists)
+    {
+        for (const auto& test: list)
+        {
+            script input;
+            script output;
+            const auto name = test_name(test);
+
+            if (input.from_string(test.input))
+                BOOST_CHECK_MESSAGE(byte_patterns_match(input), name);
+
+            if (output.from_string(test.output))
+                BOOST_CHECK_MESSAGE(byte_patterns_match(output), name);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(script__byte_patterns__encodings__same_as_operations)
+{
+    const std::vector<std::string> encodings
+    {
+        "76a914000102030405060708090a0b0c0d0e0f1011121388ac",
+        "76a94c14000102030405060708090a0b0c0d0e0f1011121388ac",
+        "76a94d1400000102030405060708090a0b0c0d0e0f1011121388ac",
+        "76a914000102030405060708090a0b0c0d0e0f10111288ac",
+        "76a914000102030405060708090a0b0c0d0e0f1011121388acac",
+        "a914000102030405060708090a0b0c0d0e0f1011121387",
+        "a94c14000102030405060708090a0b0c0d0e0f1011121387",
+        "0020000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f",
+        "2102000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1fac",
+        "4c2102000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1fac",
+        "6a", "6a00", "6a0100", "6a0110", "6a0111", "6a0181", "6a51",
+        "6a0401020304", "6a4c0401020304", "6a4c", "76a9", ""
+    };
+
+    for (const auto& encoded: encodings)
+    {
+        data_chunk bytes;
+        BOOST_REQUIRE(decode_base16(bytes, encoded));
+        script instance(bytes, false);
+        BOOST_CHECK_MESSAGE(byte_patterns_match(instance), encoded);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(script__is_pay_key_hash_pattern__bytes__hash_view)
+{
+    const short_hash hash
+    {
+        {
+            0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19
+        }
+    };
+
+    script instance(script::to_pay_key_hash_pattern(hash));
+    const auto& bytes = instance.bytes();
+    data_slice out(bytes);
+    BOOST_REQUIRE(script::is_pay_key_hash_pattern(out, bytes));
+    BOOST_REQUIRE(out.data() == bytes.data() + 3);
+    BOOST_REQUIRE(to_array<short_hash_size>(out) == hash);
+    BOOST_REQUIRE(instance.output_pattern() == script_pattern::pay_key_hash);
+    BOOST_REQUIRE_EQUAL(instance.sigops(false), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(script__is_pay_script_hash_pattern__bytes__hash_view)
+{
+    const short_hash hash
+    {
+        {
+            0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19
+        }
+    };
+
+    script instance(script::to_pay_script_hash_pattern(hash));
+    const auto& bytes = instance.bytes();
+    data_slice out(bytes);
+    BOOST_REQUIRE(script::is_pay_script_hash_pattern(out, bytes));
+    BOOST_REQUIRE(to_array<short_hash_size>(out) == hash);
+    BOOST_REQUIRE(instance.output_pattern() == script_pattern::pay_script_hash);
+    BOOST_REQUIRE_EQUAL(instance.sigops(true), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(script__sigops__bytes_checksig_variants__counted)
+{
+    const auto bytes = to_chunk(base16_literal("acadaeaf"));
+    BOOST_REQUIRE_EQUAL(script::sigops(bytes, false), 42u);
+    BOOST_REQUIRE_EQUAL(script::sigops(bytes, true), 42u);
+}
+
+BOOST_AUTO_TEST_CASE(script__sigops__bytes_positive_multisig__accurate_only)
+{
+    const auto bytes = to_chunk(base16_literal("52ae"));
+    BOOST_REQUIRE_EQUAL(script::sigops(bytes, false), 20u);
+    BOOST_REQUIRE_EQUAL(script::sigops(bytes, true), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(script__sigops__bytes_push_data__not_counted)
+{
+    const auto bytes = to_chunk(base16_literal("02acac4c01acac"));
+    BOOST_REQUIRE_EQUAL(script::sigops(bytes, false), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(script__sigops__bytes_truncated_push__counts_to_failure)
+{
+    BOOST_REQUIRE_EQUAL(script::sigops(to_chunk(base16_literal("ac4c")), false), 1u);
+    BOOST_REQUIRE_EQUAL(script::sigops(to_chunk(base16_literal("ac05acac")), false), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(script__sigops__from_data__matches_operations)
+{
+    script instance;
+    BOOST_REQUIRE(instance.from_data(to_chunk(base16_literal("acad52ae")), false));
+    BOOST_REQUIRE_EQUAL(instance.sigops(false), 22u);
+    BOOST_REQUIRE_EQUAL(instance.sigops(true), 4u);
+
+    instance.from_operations(operation::list{ { opcode::checksig } });
+    BOOST_REQUIRE_EQUAL(instance.sigops(false), 1u);
+}
+
+// Compact serialization.
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(script__to_compact__templates__hash_only_roundtrip)
+{
+    const short_hash short_value
+    {
+        {
+            0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19
+        }
+    };
+
+    hash_digest long_value;
+    std::fill(long_value.begin(), long_value.end(), 0x42);
+
+    const script scripts[] =
+    {
+        script(script::to_pay_key_hash_pattern(short_value)),
+        script(script::to_pay_script_hash_pattern(short_value))
+    };
+
+    // Witness programs are matched on their bytes, with a zero version.
+    data_chunk p2wpkh{ 0x00, 0x14 };
+    extend_data(p2wpkh, short_value);
+    data_chunk p2wsh{ 0x00, 0x20 };
+    extend_data(p2wsh, long_value);
+    const script witness_scripts[] =
+    {
+        script(p2wpkh, false),
+        script(p2wsh, false)
+    };
+
+    for (size_t index = 0; index < 2; ++index)
+    {
+        const auto compact = scripts[index].to_compact();
+        BOOST_REQUIRE_EQUAL(compact.size(), 1u + short_hash_size);
+        BOOST_REQUIRE_EQUAL(compact[0], index);
+        BOOST_REQUIRE_EQUAL(scripts[index].compact_size(), compact.size());
+
+        script instance;
+        BOOST_REQUIRE(instance.from_compact(compact));
+        BOOST_REQUIRE(instance == scripts[index]);
+    }
+
+    for (size_t index = 0; index < 2; ++index)
+    {
+        const auto compact = witness_scripts[index].to_compact();
+        BOOST_REQUIRE_EQUAL(compact[0], 2u + index);
+        BOOST_REQUIRE_EQUAL(compact.size(),
+            1u + witness_scripts[index].bytes().size() - 2u);
+
+        script instance;
+        BOOST_REQUIRE(instance.from_compact(compact));
+        BOOST_REQUIRE(instance == witness_scripts[index]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(script__to_compact__raw__size_prefixed_roundtrip)
+{
+    const script empty;
+    const auto empty_compact = empty.to_compact();
+    BOOST_REQUIRE_EQUAL(encode_base16(empty_compact), "04");
+
+    script empty_instance;
+    BOOST_REQUIRE(empty_instance.from_compact(empty_compact));
+    BOOST_REQUIRE(empty_instance.empty());
+
+    // A non-minimal push of a key hash is not a template and is kept raw.
+    data_chunk bytes{ 0x76, 0xa9, 0x4c, 0x14 };
+    bytes.resize(bytes.size() + short_hash_size, 0x07);
+    extend_data(bytes, data_chunk{ 0x88, 0xac });
+    const script raw(bytes, false);
+    const auto compact = raw.to_compact();
+    BOOST_REQUIRE_EQUAL(compact[0], 4u + bytes.size());
+    BOOST_REQUIRE_EQUAL(compact.size(), 1u + bytes.size());
+    BOOST_REQUIRE_EQUAL(raw.compact_size(), compact.size());
+
+    script instance;
+    BOOST_REQUIRE(instance.from_compact(compact));
+    BOOST_REQUIRE(instance.to_data(false) == bytes);
+}
+
+BOOST_AUTO_TEST_CASE(script__from_compact__raw_template__invalid)
+{
+    const short_hash hash{ {} };
+    const script instance(script::to_pay_key_hash_pattern(hash));
+    const auto& bytes = instance.bytes();
+
+    data_chunk compact{ static_cast<uint8_t>(4u + bytes.size()) };
+    extend_data(compact, bytes);
+
+    script result;
+    BOOST_REQUIRE(!result.from_compact(compact));
+}
+
+BOOST_AUTO_TEST_CASE(script__from_compact__truncated__invalid)
+{
+    const data_chunk compact{ 0x00, 0x01, 0x02 };
+    script instance;
+    BOOST_REQUIRE(!instance.from_compact(compact));
+    BOOST_REQUIRE(!instance.is_valid());
+}
+
+BOOST_AUTO_TEST_CASE(script__heap_size__default__zero)
+{
+    script instance;
+    BOOST_REQUIRE_EQUAL(instance.heap_size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(script__heap_size__decoded_operations__increases)
+{
+    data_chunk data;
+    BOOST_REQUIRE(decode_base16(data, "76a914fcc9b36d38cf55d7d5b4ee4dddb6b2c17612f48c88ac"));
+    const script instance(data, false);
+    const auto initial = instance.heap_size();
+    BOOST_REQUIRE_GE(initial, data.size());
+    BOOST_REQUIRE_EQUAL(instance.operations().size(), 5u);
+    BOOST_REQUIRE_GE(instance.heap_size(), initial + 5u * sizeof(machine::operation) + short_hash_size);
+}
+
+BOOST_AUTO_TEST_CASE(script__witness_extract_embedded_script__p2wsh__cached_in_place)
+{
+    const data_chunk embedded{ 0x75, 0x51 };
+    const script program_script({ { opcode::push_size_0 }, { to_chunk(sha256_hash(embedded)) } });
+    const witness instance(data_stack{ { 0x07 }, embedded });
+
+    script buffer;
+    witness::iterator end;
+    const script* out = nullptr;
+    BOOST_REQUIRE(instance.extract_embedded_script(out, end, buffer, program_script));
+    BOOST_REQUIRE(out != &buffer);
+    BOOST_REQUIRE(*out == script(embedded, false));
+    BOOST_REQUIRE(end == std::next(instance.begin()));
+
+    const script* again = nullptr;
+    BOOST_REQUIRE(instance.extract_embedded_script(again, end, buffer, program_script));
+    BOOST_REQUIRE_EQUAL(again, out);
+}
+
+BOOST_AUTO_TEST_CASE(script__witness_extract_embedded_script__p2wsh_mismatch__false)
+{
+    const data_chunk embedded{ 0x75, 0x51 };
+    const script program_script({ { opcode::push_size_0 }, { to_chunk(sha256_hash(data_chunk{ 0x51 })) } });
+    const witness instance(data_stack{ { 0x07 }, embedded });
+
+    script buffer;
+    witness::iterator end;
+    const script* out = nullptr;
+    BOOST_REQUIRE(!instance.extract_embedded_script(out, end, buffer, program_script));
+}
+
+BOOST_AUTO_TEST_CASE(script__witness_extract_embedded_script__p2wpkh__buffer_same_as_copied)
+{
+    const auto program_script = script(to_chunk(base16_literal("00141d0f172a0ecb48aee1be1f2687d2963ae33f71a1")), false);
+    const witness instance(data_stack{ { 0x30 }, { 0x02 } });
+
+    script buffer;
+    witness::iterator end;
+    const script* out = nullptr;
+    BOOST_REQUIRE(instance.extract_embedded_script(out, end, buffer, program_script));
+    BOOST_REQUIRE_EQUAL(out, &buffer);
+    BOOST_REQUIRE(end == instance.end());
+
+    script copied;
+    data_stack stack;
+    BOOST_REQUIRE(instance.extract_embedded_script(copied, stack, program_script));
+    BOOST_REQUIRE(buffer == copied);
+    BOOST_REQUIRE(stack == instance.stack());
+}
+
+BOOST_AUTO_TEST_CASE(script__witness_verify__p2wsh_in_place_stack__success)
+{
+    const data_chunk embedded{ 0x75, 0x51 };
+    const script program_script({ { opcode::push_size_0 }, { to_chunk(sha256_hash(embedded)) } });
+    const transaction tx{ 1, 0, { { { null_hash, 0 }, {}, 0 } }, { { 1, {} } } };
+    const auto forks = rule_fork::all_rules;
+
+    const witness valid(data_stack{ { 0x07 }, embedded });
+    BOOST_REQUIRE_EQUAL(valid.verify(tx, 0, forks, program_script, 1).value(), error::success);
+
+    // The unpopped element is evaluated, leaving an unclean stack.
+    const witness unclean(data_stack{ { 0x07 }, { 0x07 }, embedded });
+    BOOST_REQUIRE_EQUAL(unclean.verify(tx, 0, forks, program_script, 1).value(), error::stack_false);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
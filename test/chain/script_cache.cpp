@@ -0,0 +1,175 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::chain;
+
+BOOST_AUTO_TEST_SUITE(script_cache_tests)
+
+static const auto hash1 = hash_literal("000000000019d6689c085ae165831e934ff763ae46a2a6c172b3f1b60a8ce26f");
+static const auto forks1 = static_cast<uint32_t>(machine::rule_fork::all_rules);
+static const size_t bytes_per_shard = script_cache::entry_size * script_cache::shard_count;
+
+BOOST_AUTO_TEST_CASE(script_cache__construct__default__disabled)
+{
+    script_cache cache;
+    BOOST_REQUIRE(!cache.enabled());
+    BOOST_REQUIRE_EQUAL(cache.capacity(), 0u);
+    cache.insert(hash1, 0, forks1);
+    BOOST_REQUIRE(!cache.contains(hash1, 0, forks1));
+    BOOST_REQUIRE_EQUAL(cache.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(script_cache__construct__budget_below_shard_count__disabled)
+{
+    script_cache cache(bytes_per_shard - 1);
+    BOOST_REQUIRE(!cache.enabled());
+}
+
+BOOST_AUTO_TEST_CASE(script_cache__contains__inserted__true)
+{
+    script_cache cache(4 * bytes_per_shard);
+    BOOST_REQUIRE(cache.enabled());
+    BOOST_REQUIRE_EQUAL(cache.capacity(), 4u * script_cache::shard_count);
+    BOOST_REQUIRE(!cache.contains(hash1, 1, forks1));
+    cache.insert(hash1, 1, forks1);
+    BOOST_REQUIRE(cache.contains(hash1, 1, forks1));
+    BOOST_REQUIRE_EQUAL(cache.size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(script_cache__contains__inserted_and_missing__counted)
+{
+    script_cache cache(4 * bytes_per_shard);
+    cache.insert(hash1, 1, forks1);
+    BOOST_REQUIRE(cache.contains(hash1, 1, forks1));
+    BOOST_REQUIRE(!cache.contains(hash1, 2, forks1));
+    BOOST_REQUIRE_EQUAL(cache.hits(), 1u);
+    BOOST_REQUIRE_EQUAL(cache.misses(), 1u);
+    BOOST_REQUIRE_EQUAL(cache.hit_rate(), 0.5f);
+}
+
+BOOST_AUTO_TEST_CASE(script_cache__contains__distinct_element__false)
+{
+    script_cache cache(4 * bytes_per_shard);
+    cache.insert(hash1, 1, forks1);
+    auto hash = hash1;
+    hash[0] ^= 1;
+    BOOST_REQUIRE(!cache.contains(hash, 1, forks1));
+    BOOST_REQUIRE(!cache.contains(hash1, 0, forks1));
+    BOOST_REQUIRE(!cache.contains(hash1, 1, forks1 ^ 1));
+}
+
+BOOST_AUTO_TEST_CASE(script_cache__insert__forks_change__cleared)
+{
+    script_cache cache(4 * bytes_per_shard);
+    cache.insert(hash1, 0, forks1);
+    cache.insert(hash1, 1, forks1);
+    BOOST_REQUIRE_EQUAL(cache.size(), 2u);
+
+    const auto forks2 = forks1 ^ 1;
+    cache.insert(hash1, 2, forks2);
+    BOOST_REQUIRE_EQUAL(cache.size(), 1u);
+    BOOST_REQUIRE(!cache.contains(hash1, 0, forks1));
+    BOOST_REQUIRE(cache.contains(hash1, 2, forks2));
+}
+
+BOOST_AUTO_TEST_CASE(script_cache__insert__full__bounded)
+{
+    script_cache cache(bytes_per_shard);
+
+    for (uint32_t index = 0; index < 1000; ++index)
+    {
+        cache.insert(hash1, index, forks1);
+        BOOST_REQUIRE(cache.contains(hash1, index, forks1));
+    }
+
+    BOOST_REQUIRE_EQUAL(cache.size(), cache.capacity());
+}
+
+BOOST_AUTO_TEST_CASE(script_cache__resize__zero__disabled_empty)
+{
+    script_cache cache(4 * bytes_per_shard);
+    cache.insert(hash1, 0, forks1);
+    cache.resize(0);
+    BOOST_REQUIRE(!cache.enabled());
+    BOOST_REQUIRE_EQUAL(cache.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(script_cache__clear__inserted__empty)
+{
+    script_cache cache(4 * bytes_per_shard);
+    cache.insert(hash1, 0, forks1);
+    cache.clear();
+    BOOST_REQUIRE_EQUAL(cache.size(), 0u);
+    BOOST_REQUIRE(!cache.contains(hash1, 0, forks1));
+}
+
+BOOST_AUTO_TEST_CASE(script_cache__load__stored_under_secret__hit_under_stored_forks)
+{
+    static const auto secret = hash1;
+    const auto path = boost::filesystem::temp_directory_path() /
+        boost::filesystem::unique_path("script_cache-%%%%-%%%%.dat");
+
+    script_cache cache(4 * bytes_per_shard);
+    cache.set_secret(secret);
+    cache.insert(hash1, 1, forks1);
+    cache.insert(hash1, 2, forks1);
+    BOOST_REQUIRE(cache.store(path));
+
+    threadpool pool(2);
+    script_cache restarted(4 * bytes_per_shard);
+    restarted.set_secret(secret);
+    BOOST_REQUIRE_EQUAL(restarted.load(path, pool, asio::seconds(60)), 2u);
+    BOOST_REQUIRE(restarted.contains(hash1, 1, forks1));
+    BOOST_REQUIRE(restarted.contains(hash1, 2, forks1));
+
+    // The stored forks are retained, so a further insertion does not clear.
+    restarted.insert(hash1, 3, forks1);
+    BOOST_REQUIRE_EQUAL(restarted.size(), 3u);
+
+    pool.shutdown();
+    pool.join();
+    boost::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(script_cache__load__full__bounded_by_capacity)
+{
+    const auto path = boost::filesystem::temp_directory_path() /
+        boost::filesystem::unique_path("script_cache-%%%%-%%%%.dat");
+
+    script_cache cache(4 * bytes_per_shard);
+    cache.set_secret(hash1);
+
+    for (uint32_t index = 0; index < cache.capacity(); ++index)
+        cache.insert(hash1, index, forks1);
+
+    BOOST_REQUIRE(cache.store(path));
+
+    threadpool pool(0);
+    script_cache restarted(bytes_per_shard);
+    restarted.set_secret(hash1);
+    BOOST_REQUIRE_EQUAL(restarted.load(path, pool, asio::seconds(60)), restarted.capacity());
+    BOOST_REQUIRE_EQUAL(restarted.size(), restarted.capacity());
+    BOOST_REQUIRE_EQUAL(restarted.evictions(), 0u);
+    boost::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,93 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::chain;
+
+BOOST_AUTO_TEST_SUITE(script_dictionary_tests)
+
+static transaction pay(const std::vector<data_chunk>& scripts)
+{
+    output::list outputs;
+
+    for (const auto& bytes: scripts)
+        outputs.emplace_back(1, script(bytes, false));
+
+    return { 1, 0, {}, std::move(outputs) };
+}
+
+BOOST_AUTO_TEST_CASE(script_dictionary__train__sample__frequent_descending)
+{
+    const block sample(header{},
+    {
+        pay({ { 0x51 }, { 0x52 }, { 0x53 }, { 0x52 } }),
+        pay({ { 0x52 }, { 0x51 }, { 0x54 }, { 0x55 }, { 0x55 } })
+    });
+
+    const auto dictionary = script_dictionary::train({ sample });
+    BOOST_REQUIRE_EQUAL(dictionary.size(), 3u);
+    BOOST_REQUIRE_EQUAL(dictionary.find({ 0x52 }), 0u);
+    BOOST_REQUIRE_EQUAL(dictionary.find({ 0x51 }), 1u);
+    BOOST_REQUIRE_EQUAL(dictionary.find({ 0x55 }), 2u);
+    BOOST_REQUIRE_EQUAL(dictionary.find({ 0x53 }), 3u);
+    BOOST_REQUIRE(dictionary.at(0).bytes() == data_chunk{ 0x52 });
+}
+
+BOOST_AUTO_TEST_CASE(script_dictionary__train__size__truncated)
+{
+    const block sample(header{},
+    {
+        pay({ { 0x51 }, { 0x52 }, { 0x51 }, { 0x52 }, { 0x51 } })
+    });
+
+    const auto dictionary = script_dictionary::train({ sample }, 1);
+    BOOST_REQUIRE_EQUAL(dictionary.size(), 1u);
+    BOOST_REQUIRE_EQUAL(dictionary.find({ 0x51 }), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(script_dictionary__from_data__to_data__round_trip)
+{
+    const script_dictionary expected({ { 0x51 }, {}, { 0x00, 0x14 } });
+    script_dictionary instance;
+    BOOST_REQUIRE(instance.from_data(expected.to_data()));
+    BOOST_REQUIRE_EQUAL(instance.size(), 3u);
+    BOOST_REQUIRE_EQUAL(instance.find({}), 1u);
+    BOOST_REQUIRE(instance.to_data() == expected.to_data());
+}
+
+BOOST_AUTO_TEST_CASE(script_dictionary__from_data__duplicate__false)
+{
+    const script_dictionary duplicated({ { 0x51 }, { 0x51 } });
+    script_dictionary instance;
+    BOOST_REQUIRE(!instance.from_data(duplicated.to_data()));
+    BOOST_REQUIRE(instance.empty());
+}
+
+BOOST_AUTO_TEST_CASE(script_dictionary__from_data__truncated__false)
+{
+    auto data = script_dictionary({ { 0x51, 0x52 } }).to_data();
+    data.pop_back();
+    script_dictionary instance;
+    BOOST_REQUIRE(!instance.from_data(data));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
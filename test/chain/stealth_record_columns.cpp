@@ -0,0 +1,128 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::chain;
+
+BOOST_AUTO_TEST_SUITE(stealth_record_columns_tests)
+
+static stealth_record::list make_records()
+{
+    stealth_record::list records;
+
+    for (uint32_t row = 0; row < 10; ++row)
+    {
+        hash_digest ephemeral(null_hash);
+        short_hash key_hash(null_short_hash);
+        hash_digest tx_hash(null_hash);
+        ephemeral[0] = static_cast<uint8_t>(row);
+        key_hash[1] = static_cast<uint8_t>(row);
+        tx_hash[2] = static_cast<uint8_t>(row);
+
+        // Prefixes alternate 0x..00 and 0x..ff in the leading byte.
+        const uint32_t prefix = row % 2 == 0 ? 0x12345600 : 0x123456ff;
+        records.emplace_back(1000 + row * 3, prefix, ephemeral, key_hash,
+            tx_hash);
+    }
+
+    return records;
+}
+
+BOOST_AUTO_TEST_CASE(stealth_record_columns__constructor_1__always__invalid)
+{
+    const stealth_record_columns instance;
+    BOOST_REQUIRE(!instance.is_valid());
+}
+
+BOOST_AUTO_TEST_CASE(stealth_record_columns__from_data__empty__valid)
+{
+    const stealth_record_columns expected(stealth_record::list{});
+    const auto data = expected.to_data();
+    BOOST_REQUIRE_EQUAL(data.size(), expected.serialized_size());
+
+    const auto instance = stealth_record_columns::factory(data);
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(instance.records().empty());
+}
+
+BOOST_AUTO_TEST_CASE(stealth_record_columns__factory__roundtrip__expected)
+{
+    const stealth_record_columns expected(make_records());
+    const auto data = expected.to_data();
+    BOOST_REQUIRE_EQUAL(data.size(), expected.serialized_size());
+
+    // Delta heights take one byte per row after the first.
+    const auto rows = expected.records().size();
+    BOOST_REQUIRE_LT(data.size(), rows * stealth_record::satoshi_fixed_size(false));
+
+    const auto instance = stealth_record_columns::factory(data);
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(instance == expected);
+}
+
+BOOST_AUTO_TEST_CASE(stealth_record_columns__from_data__filter__matching_rows)
+{
+    const stealth_record_columns expected(make_records());
+    const auto data = expected.to_data();
+
+    stealth_record_columns instance;
+    byte_reader source(data);
+    BOOST_REQUIRE(instance.from_data(source, 1006, binary("11111111")));
+    BOOST_REQUIRE(source.is_exhausted());
+
+    // Rows 3, 5, 7 and 9 are odd (0xff) and at or above height 1006.
+    const auto& records = instance.records();
+    BOOST_REQUIRE_EQUAL(records.size(), 4u);
+    BOOST_REQUIRE(records[0] == expected.records()[3]);
+    BOOST_REQUIRE(records[3] == expected.records()[9]);
+}
+
+BOOST_AUTO_TEST_CASE(stealth_record_columns__from_data__below_start__skipped)
+{
+    const stealth_record_columns expected(make_records());
+    auto data = expected.to_data();
+    const auto size = data.size();
+    extend_data(data, expected.to_data());
+
+    stealth_record_columns instance;
+    byte_reader source(data);
+    BOOST_REQUIRE(instance.from_data(source, 2000, {}));
+    BOOST_REQUIRE(instance.records().empty());
+
+    // The skipped set is followed by the next.
+    BOOST_REQUIRE_EQUAL(data.size() - size, expected.serialized_size());
+    BOOST_REQUIRE(instance.from_data(source));
+    BOOST_REQUIRE(instance == expected);
+    BOOST_REQUIRE(source.is_exhausted());
+}
+
+BOOST_AUTO_TEST_CASE(stealth_record_columns__from_data__truncated__invalid)
+{
+    const stealth_record_columns expected(make_records());
+    auto data = expected.to_data();
+    data.pop_back();
+
+    const auto instance = stealth_record_columns::factory(data);
+    BOOST_REQUIRE(!instance.is_valid());
+    BOOST_REQUIRE(instance.records().empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
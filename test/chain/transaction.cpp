@@ -234,6 +234,53 @@ BOOST_AUTO_TEST_CASE(transaction__constructor_5__valid_input__returns_input_init
     BOOST_REQUIRE(instance.is_valid());
 }
 
+BOOST_AUTO_TEST_CASE(transaction__constructor_6__copy__shares_inputs_and_outputs)
+{
+    const auto expected = chain::transaction::factory(
+        to_chunk(base16_literal(TX1)));
+
+    const chain::transaction instance(expected);
+    BOOST_REQUIRE(instance == expected);
+    BOOST_REQUIRE(&instance.inputs() == &expected.inputs());
+    BOOST_REQUIRE(&instance.outputs() == &expected.outputs());
+}
+
+BOOST_AUTO_TEST_CASE(transaction__set_version__copy__does_not_detach)
+{
+    const auto expected = chain::transaction::factory(
+        to_chunk(base16_literal(TX1)));
+
+    chain::transaction instance(expected);
+    instance.set_version(42);
+    const auto& shared = instance;
+    BOOST_REQUIRE(&shared.inputs() == &expected.inputs());
+}
+
+BOOST_AUTO_TEST_CASE(transaction__inputs__mutable_copy__detaches_from_original)
+{
+    const auto expected = chain::transaction::factory(
+        to_chunk(base16_literal(TX1)));
+
+    chain::transaction instance(expected);
+    instance.inputs().front().set_sequence(42);
+    const auto& shared = instance;
+    BOOST_REQUIRE(&shared.inputs() != &expected.inputs());
+    BOOST_REQUIRE(&shared.outputs() == &expected.outputs());
+    BOOST_REQUIRE(expected.inputs().front().sequence() != 42u);
+    BOOST_REQUIRE(instance != expected);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__strip_witness__copy_without_witness__does_not_detach)
+{
+    const auto expected = chain::transaction::factory(
+        to_chunk(base16_literal(TX1)));
+
+    chain::transaction instance(expected);
+    instance.strip_witness();
+    const auto& shared = instance;
+    BOOST_REQUIRE(&shared.inputs() == &expected.inputs());
+}
+
 BOOST_AUTO_TEST_CASE(transaction__is_coinbase__empty_inputs__returns_false)
 {
     chain::transaction instance;
@@ -456,6 +503,25 @@ BOOST_AUTO_TEST_CASE(transaction__from_data__insufficient_output_bytes__failure)
     BOOST_REQUIRE(!instance.is_valid());
 }
 
+BOOST_AUTO_TEST_CASE(transaction__from_data__input_count_exceeds_bytes__failure)
+{
+    // A 100000 input count prefix followed by two bytes cannot be satisfied.
+    data_chunk data = to_chunk(base16_literal("01000000fea08601000000"));
+    chain::transaction instance;
+    BOOST_REQUIRE(!instance.from_data(data));
+    BOOST_REQUIRE(!instance.is_valid());
+    BOOST_REQUIRE(instance.inputs().empty());
+}
+
+BOOST_AUTO_TEST_CASE(transaction__from_data__stream_input_count_exceeds_bytes__failure)
+{
+    data_chunk data = to_chunk(base16_literal("01000000fea08601000000"));
+    data_source stream(data);
+    chain::transaction instance;
+    BOOST_REQUIRE(!instance.from_data(stream));
+    BOOST_REQUIRE(!instance.is_valid());
+}
+
 // TODO: update test for v4 store serialization (input with witness).
 ////BOOST_AUTO_TEST_CASE(transaction__from_data__compare_wire_to_store__success)
 ////{
@@ -740,9 +806,9 @@ BOOST_AUTO_TEST_CASE(transaction__total_input_value__cache__returns_cache_value_
     chain::transaction instance;
     auto& inputs = instance.inputs();
     inputs.emplace_back();
-    inputs.back().previous_output().metadata.cache.set_value(123u);
+    inputs.back().previous_output().metadata->cache.set_value(123u);
     inputs.emplace_back();
-    inputs.back().previous_output().metadata.cache.set_value(321u);
+    inputs.back().previous_output().metadata->cache.set_value(321u);
     BOOST_REQUIRE_EQUAL(instance.total_input_value(), 444u);
 }
 
@@ -772,9 +838,9 @@ BOOST_AUTO_TEST_CASE(transaction__fees__nonempty__returns_outputs_minus_inputs)
     chain::transaction instance;
     auto& inputs = instance.inputs();
     inputs.emplace_back();
-    inputs.back().previous_output().metadata.cache.set_value(123u);
+    inputs.back().previous_output().metadata->cache.set_value(123u);
     inputs.emplace_back();
-    inputs.back().previous_output().metadata.cache.set_value(321u);
+    inputs.back().previous_output().metadata->cache.set_value(321u);
     instance.outputs().emplace_back();
     instance.outputs().back().set_value(44u);
     BOOST_REQUIRE_EQUAL(instance.fees(), 400u);
@@ -823,7 +889,7 @@ BOOST_AUTO_TEST_CASE(transaction__is_missing_previous_outputs__inputs_with_cache
 {
     chain::transaction instance;
     instance.inputs().emplace_back();
-    instance.inputs().back().previous_output().metadata.cache.set_value(123u);
+    instance.inputs().back().previous_output().metadata->cache.set_value(123u);
     BOOST_REQUIRE(!instance.is_missing_previous_outputs());
 }
 
@@ -846,7 +912,7 @@ BOOST_AUTO_TEST_CASE(transaction__is_missing_previous_outputs__inputs_with_cache
 ////{
 ////    chain::transaction instance;
 ////    instance.inputs().emplace_back();
-////    instance.inputs().back().previous_output().metadata.cache.set_value(123u);
+////    instance.inputs().back().previous_output().metadata->cache.set_value(123u);
 ////    BOOST_REQUIRE_EQUAL(instance.missing_previous_outputs().size(), 0u);
 ////}
 
@@ -867,7 +933,7 @@ BOOST_AUTO_TEST_CASE(transaction__is_confirmed_double_spend__unspent_inputs__ret
 {
     chain::transaction instance;
     instance.inputs().emplace_back();
-    instance.inputs().back().previous_output().metadata.spent = false;
+    instance.inputs().back().previous_output().metadata->spent = false;
     BOOST_REQUIRE(!instance.is_confirmed_double_spend());
 }
 
@@ -875,7 +941,7 @@ BOOST_AUTO_TEST_CASE(transaction__is_confirmed_double_spend__spent_input__return
 {
     chain::transaction instance;
     instance.inputs().emplace_back();
-    instance.inputs().back().previous_output().metadata.spent = true;
+    instance.inputs().back().previous_output().metadata->spent = true;
     BOOST_REQUIRE(instance.is_confirmed_double_spend());
 }
 
@@ -937,7 +1003,7 @@ BOOST_AUTO_TEST_CASE(transaction__is_mature__mature_coinbase_prevout__returns_tr
 {
     chain::transaction instance;
     instance.inputs().emplace_back(chain::output_point{ hash1, 42 }, chain::script{}, 0);
-    instance.inputs().back().previous_output().metadata.coinbase = true;
+    instance.inputs().back().previous_output().metadata->coinbase = true;
     BOOST_REQUIRE(!instance.inputs().back().previous_output().is_null());
     BOOST_REQUIRE(instance.is_mature(453));
 }
@@ -946,8 +1012,8 @@ BOOST_AUTO_TEST_CASE(transaction__is_mature__premature_coinbase_prevout__returns
 {
     chain::transaction instance;
     instance.inputs().emplace_back(chain::output_point{ hash1, 42 }, chain::script{}, 0);
-    instance.inputs().back().previous_output().metadata.height = 20;
-    instance.inputs().back().previous_output().metadata.coinbase = true;
+    instance.inputs().back().previous_output().metadata->height = 20;
+    instance.inputs().back().previous_output().metadata->coinbase = true;
     BOOST_REQUIRE(!instance.inputs().back().previous_output().is_null());
     BOOST_REQUIRE(!instance.is_mature(50));
 }
@@ -956,8 +1022,8 @@ BOOST_AUTO_TEST_CASE(transaction__is_mature__premature_coinbase_prevout_null_inp
 {
     chain::transaction instance;
     instance.inputs().emplace_back(chain::output_point{ null_hash, chain::point::null_index }, chain::script{}, 0);
-    instance.inputs().back().previous_output().metadata.height = 20;
-    instance.inputs().back().previous_output().metadata.coinbase = true;
+    instance.inputs().back().previous_output().metadata->height = 20;
+    instance.inputs().back().previous_output().metadata->coinbase = true;
     BOOST_REQUIRE(instance.inputs().back().previous_output().is_null());
     BOOST_REQUIRE(instance.is_mature(50));
 }
@@ -966,7 +1032,7 @@ BOOST_AUTO_TEST_CASE(transaction__is_mature__mature_non_coinbase_prevout__return
 {
     chain::transaction instance;
     instance.inputs().emplace_back(chain::output_point{ hash1, 42 }, chain::script{}, 0);
-    instance.inputs().back().previous_output().metadata.coinbase = false;
+    instance.inputs().back().previous_output().metadata->coinbase = false;
     BOOST_REQUIRE(!instance.inputs().back().previous_output().is_null());
     BOOST_REQUIRE(instance.is_mature(453));
 }
@@ -975,8 +1041,8 @@ BOOST_AUTO_TEST_CASE(transaction__is_mature__premature_non_coinbase_prevout__ret
 {
     chain::transaction instance;
     instance.inputs().emplace_back(chain::output_point{ hash1, 42 }, chain::script{}, 0);
-    instance.inputs().back().previous_output().metadata.height = 20;
-    instance.inputs().back().previous_output().metadata.coinbase = false;
+    instance.inputs().back().previous_output().metadata->height = 20;
+    instance.inputs().back().previous_output().metadata->coinbase = false;
     BOOST_REQUIRE(!instance.inputs().back().previous_output().is_null());
     BOOST_REQUIRE(instance.is_mature(50));
 }
@@ -1050,4 +1116,414 @@ BOOST_AUTO_TEST_CASE(transaction__hash__block320670__success)
     BOOST_REQUIRE(data == instance.to_data());
 }
 
+chain::transaction segregated_transaction()
+{
+    chain::transaction tx
+    {
+        2,
+        42,
+        chain::input::list
+        {
+            { { hash_literal("b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee097"), 7 }, chain::script{}, 0xffffffff },
+            { { hash_literal("0bb3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee0"), 1 }, chain::script{}, 0xfffffffe }
+        },
+        chain::output::list
+        {
+            { 100000, chain::script::to_pay_key_hash_pattern(short_hash{}) }
+        }
+    };
+
+    auto inputs = tx.inputs();
+    inputs[0].set_witness(chain::witness{ data_stack{ { 0x01, 0x02 }, { 0x03 } } });
+    tx.set_inputs(std::move(inputs));
+    return tx;
+}
+
+BOOST_AUTO_TEST_CASE(transaction__hash__from_data_unsegregated__matches_serialization)
+{
+    static const auto data = to_chunk(base16_literal(TX4));
+    chain::transaction instance;
+    BOOST_REQUIRE(instance.from_data(data));
+    BOOST_REQUIRE_EQUAL(encode_hash(instance.hash()), encode_hash(bitcoin_hash(data)));
+    BOOST_REQUIRE_EQUAL(encode_hash(instance.hash(true)), encode_hash(bitcoin_hash(data)));
+}
+
+BOOST_AUTO_TEST_CASE(transaction__hash__from_data_segregated__matches_serialization)
+{
+    const auto tx = segregated_transaction();
+    const auto data = tx.to_data(true, true);
+    chain::transaction instance;
+    BOOST_REQUIRE(instance.from_data(data, true, true));
+    BOOST_REQUIRE(instance.is_segregated());
+    BOOST_REQUIRE_EQUAL(encode_hash(instance.hash()), encode_hash(bitcoin_hash(tx.to_data(true, false))));
+    BOOST_REQUIRE_EQUAL(encode_hash(instance.hash(true)), encode_hash(bitcoin_hash(data)));
+}
+
+BOOST_AUTO_TEST_CASE(transaction__hash__from_data_segregated_stripped__matches_serialization)
+{
+    const auto tx = segregated_transaction();
+    chain::transaction instance;
+    BOOST_REQUIRE(instance.from_data(tx.to_data(true, true), true, false));
+    BOOST_REQUIRE(!instance.is_segregated());
+    BOOST_REQUIRE_EQUAL(encode_hash(instance.hash()), encode_hash(bitcoin_hash(tx.to_data(true, false))));
+}
+
+BOOST_AUTO_TEST_CASE(transaction__serialized_size__segregated__matches_serialization)
+{
+    const auto tx = segregated_transaction();
+    BOOST_REQUIRE_EQUAL(tx.serialized_size(true, false), tx.to_data(true, false).size());
+    BOOST_REQUIRE_EQUAL(tx.serialized_size(true, true), tx.to_data(true, true).size());
+    BOOST_REQUIRE_EQUAL(tx.serialized_size(false, true), tx.to_data(false, true).size());
+}
+
+BOOST_AUTO_TEST_CASE(transaction__serialized_size__set_inputs_after_cached__recomputed)
+{
+    auto tx = segregated_transaction();
+    const auto base = tx.serialized_size(true, false);
+    const auto total = tx.serialized_size(true, true);
+    auto inputs = tx.inputs();
+    inputs.pop_back();
+    tx.set_inputs(std::move(inputs));
+    BOOST_REQUIRE_LT(tx.serialized_size(true, false), base);
+    BOOST_REQUIRE_LT(tx.serialized_size(true, true), total);
+    BOOST_REQUIRE_EQUAL(tx.serialized_size(true, false), tx.to_data(true, false).size());
+    BOOST_REQUIRE_EQUAL(tx.serialized_size(true, true), tx.to_data(true, true).size());
+}
+
+BOOST_AUTO_TEST_CASE(transaction__serialized_size__strip_witness_after_cached__base_size)
+{
+    auto tx = segregated_transaction();
+    const auto base = tx.serialized_size(true, false);
+    BOOST_REQUIRE_GT(tx.serialized_size(true, true), base);
+    tx.strip_witness();
+    BOOST_REQUIRE_EQUAL(tx.serialized_size(true, true), base);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__serialized_size__copy_after_cached__matches_serialization)
+{
+    const auto tx = segregated_transaction();
+    tx.serialized_size(true, true);
+    const chain::transaction copy(tx);
+    BOOST_REQUIRE_EQUAL(copy.serialized_size(true, true), tx.to_data(true, true).size());
+}
+
+BOOST_AUTO_TEST_CASE(transaction__from_data__encoding_offset__retains_encoding)
+{
+    const auto raw_tx = to_chunk(base16_literal(TX4));
+    auto buffer = data_chunk{ 0x2a, 0x2a, 0x2a };
+    extend_data(buffer, raw_tx);
+    buffer.push_back(0x2a);
+    const auto data = std::make_shared<const data_chunk>(std::move(buffer));
+
+    chain::transaction instance;
+    BOOST_REQUIRE(instance.from_data(data, 3));
+    BOOST_REQUIRE(instance == chain::transaction::factory(raw_tx));
+    BOOST_REQUIRE(instance.is_retained(false));
+    BOOST_REQUIRE(instance.is_retained(true));
+    BOOST_REQUIRE(to_chunk(instance.encoding()) == raw_tx);
+    BOOST_REQUIRE(instance.to_data() == raw_tx);
+    BOOST_REQUIRE_EQUAL(instance.serialized_size(), raw_tx.size());
+    BOOST_REQUIRE_EQUAL(encode_hash(instance.hash()), encode_hash(bitcoin_hash(raw_tx)));
+}
+
+BOOST_AUTO_TEST_CASE(transaction__from_data__encoding_offset_past_end__failure)
+{
+    const auto data = std::make_shared<const data_chunk>(data_chunk(10));
+    chain::transaction instance;
+    BOOST_REQUIRE(!instance.from_data(data, 11));
+    BOOST_REQUIRE(!instance.from_data(chain::transaction::encoding_ptr{}));
+    BOOST_REQUIRE(!instance.is_valid());
+    BOOST_REQUIRE(instance.encoding().empty());
+}
+
+BOOST_AUTO_TEST_CASE(transaction__from_data__encoding_segregated__retains_witness_encoding)
+{
+    const auto tx = segregated_transaction();
+    const auto data = std::make_shared<const data_chunk>(tx.to_data(true, true));
+
+    chain::transaction instance;
+    BOOST_REQUIRE(instance.from_data(data, 0, true));
+    BOOST_REQUIRE(instance.is_retained(true));
+    BOOST_REQUIRE(!instance.is_retained(false));
+    BOOST_REQUIRE(instance.to_data(true, true) == *data);
+    BOOST_REQUIRE(instance.to_data(true, false) == tx.to_data(true, false));
+    BOOST_REQUIRE_EQUAL(instance.serialized_size(true, false), tx.serialized_size(true, false));
+    BOOST_REQUIRE_EQUAL(encode_hash(instance.hash(true)), encode_hash(tx.hash(true)));
+}
+
+BOOST_AUTO_TEST_CASE(transaction__from_data__encoding_segregated_stripped__not_reused)
+{
+    const auto tx = segregated_transaction();
+    const auto data = std::make_shared<const data_chunk>(tx.to_data(true, true));
+
+    chain::transaction instance;
+    BOOST_REQUIRE(instance.from_data(data, 0, false));
+    BOOST_REQUIRE(!instance.is_segregated());
+    BOOST_REQUIRE(!instance.is_retained(false));
+    BOOST_REQUIRE(!instance.is_retained(true));
+    BOOST_REQUIRE(instance.to_data(true, true) == tx.to_data(true, false));
+}
+
+BOOST_AUTO_TEST_CASE(transaction__from_data__encoding_lazy__defers_witness_until_access)
+{
+    const auto tx = segregated_transaction();
+    const auto data = std::make_shared<const data_chunk>(tx.to_data(true, true));
+
+    chain::transaction instance;
+    BOOST_REQUIRE(instance.from_data(data, 0, true, true));
+    BOOST_REQUIRE(instance.is_segregated());
+
+    const auto& witness = instance.inputs().front().witness();
+    BOOST_REQUIRE(witness.is_deferred());
+    BOOST_REQUIRE(!instance.inputs().back().witness().is_deferred());
+    BOOST_REQUIRE_EQUAL(witness.serialized_size(true), tx.inputs().front().witness().serialized_size(true));
+    BOOST_REQUIRE_EQUAL(encode_hash(instance.hash(true)), encode_hash(tx.hash(true)));
+    BOOST_REQUIRE(instance.to_data(true, true) == *data);
+    BOOST_REQUIRE(witness.is_deferred());
+
+    BOOST_REQUIRE(witness.stack() == tx.inputs().front().witness().stack());
+    BOOST_REQUIRE(!witness.is_deferred());
+    BOOST_REQUIRE(instance == tx);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__from_data__encoding_lazy_copy__serializes_deferred_witness)
+{
+    const auto tx = segregated_transaction();
+    const auto data = std::make_shared<const data_chunk>(tx.to_data(true, true));
+    const auto instance = chain::transaction::factory(data, 0, true, true);
+
+    auto inputs = instance.inputs();
+    BOOST_REQUIRE(inputs.front().witness().is_deferred());
+    BOOST_REQUIRE(inputs.front().witness().to_data(false) == tx.inputs().front().witness().to_data(false));
+    BOOST_REQUIRE(inputs.front().witness().to_data(true) == tx.inputs().front().witness().to_data(true));
+
+    chain::transaction copy(instance.version(), instance.locktime(), std::move(inputs), instance.outputs());
+    BOOST_REQUIRE(copy.to_data(true, true) == *data);
+    BOOST_REQUIRE_EQUAL(copy.serialized_size(true, true), data->size());
+}
+
+BOOST_AUTO_TEST_CASE(transaction__from_data__encoding_then_set_locktime__releases_encoding)
+{
+    const auto raw_tx = to_chunk(base16_literal(TX4));
+    const auto data = std::make_shared<const data_chunk>(raw_tx);
+
+    auto instance = chain::transaction::factory(data);
+    const auto copy = instance;
+    instance.set_locktime(instance.locktime() + 1);
+    BOOST_REQUIRE(instance.encoding().empty());
+    BOOST_REQUIRE(instance.to_data() != raw_tx);
+    BOOST_REQUIRE_EQUAL(instance.to_data().size(), raw_tx.size());
+    BOOST_REQUIRE(copy.is_retained(false));
+    BOOST_REQUIRE(copy.to_data() == raw_tx);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__from_data__encoding_then_mutable_inputs__releases_encoding)
+{
+    const auto data = std::make_shared<const data_chunk>(to_chunk(base16_literal(TX4)));
+    auto instance = chain::transaction::factory(data);
+    instance.inputs().front().set_sequence(42);
+    BOOST_REQUIRE(!instance.is_retained(false));
+    BOOST_REQUIRE_EQUAL(chain::transaction::factory(instance.to_data()).inputs().front().sequence(), 42u);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__recycle__unsegregated__equals_from_data)
+{
+    static const auto raw_tx = to_chunk(base16_literal(TX4));
+    chain::transaction instance;
+    BOOST_REQUIRE(instance.recycle(raw_tx));
+    BOOST_REQUIRE(instance == chain::transaction::factory(raw_tx));
+    BOOST_REQUIRE(instance.to_data() == raw_tx);
+    BOOST_REQUIRE_EQUAL(encode_hash(instance.hash()), encode_hash(bitcoin_hash(raw_tx)));
+}
+
+BOOST_AUTO_TEST_CASE(transaction__recycle__segregated__equals_from_data)
+{
+    const auto tx = segregated_transaction();
+    const auto data = tx.to_data(true, true);
+    chain::transaction instance;
+    BOOST_REQUIRE(instance.recycle(to_chunk(base16_literal(TX4))));
+    BOOST_REQUIRE(instance.recycle(data, true, true));
+    BOOST_REQUIRE(instance.is_segregated());
+    BOOST_REQUIRE(instance == tx);
+    BOOST_REQUIRE(instance.to_data(true, true) == data);
+    BOOST_REQUIRE_EQUAL(encode_hash(instance.hash(true)), encode_hash(bitcoin_hash(data)));
+}
+
+BOOST_AUTO_TEST_CASE(transaction__recycle__twice__retains_capacity)
+{
+    static const auto raw_tx = to_chunk(base16_literal(TX4));
+    chain::transaction instance;
+    BOOST_REQUIRE(instance.recycle(raw_tx));
+    const auto inputs = instance.inputs().data();
+    const auto outputs = instance.outputs().data();
+    const auto script = instance.inputs().front().script().bytes().data();
+    BOOST_REQUIRE(instance.recycle(raw_tx));
+    BOOST_REQUIRE(instance.inputs().data() == inputs);
+    BOOST_REQUIRE(instance.outputs().data() == outputs);
+    BOOST_REQUIRE(instance.inputs().front().script().bytes().data() == script);
+    BOOST_REQUIRE(instance == chain::transaction::factory(raw_tx));
+}
+
+BOOST_AUTO_TEST_CASE(transaction__recycle__segregated_twice__retains_witness_capacity)
+{
+    const auto data = segregated_transaction().to_data(true, true);
+    chain::transaction instance;
+    BOOST_REQUIRE(instance.recycle(data, true, true));
+    const auto element = instance.inputs().front().witness().stack().front().data();
+    BOOST_REQUIRE(instance.recycle(data, true, true));
+    BOOST_REQUIRE(instance.inputs().front().witness().stack().front().data() == element);
+    BOOST_REQUIRE(instance.to_data(true, true) == data);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__recycle__segregated_then_unsegregated__strips_witness)
+{
+    const auto tx = segregated_transaction();
+    const auto base = tx.to_data(true, false);
+    chain::transaction instance;
+    BOOST_REQUIRE(instance.recycle(tx.to_data(true, true), true, true));
+    BOOST_REQUIRE(instance.recycle(base, true, true));
+    BOOST_REQUIRE(!instance.is_segregated());
+    BOOST_REQUIRE(instance == chain::transaction::factory(base, true, true));
+    BOOST_REQUIRE(instance.to_data(true, true) == base);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__witness_from_data__stream_count_exceeds_elements__invalid)
+{
+    // A count of 2,000,000 elements followed by a single one byte element.
+    const auto data = to_chunk(base16_literal("fe80841e0001aa"));
+    data_source stream(data);
+    chain::witness instance;
+    BOOST_REQUIRE(!instance.from_data(stream, true));
+    BOOST_REQUIRE(!instance.is_valid());
+}
+
+BOOST_AUTO_TEST_CASE(transaction__witness_from_data__stream_elements__valid)
+{
+    const auto data = to_chunk(base16_literal("0201aa02bbcc"));
+    data_source stream(data);
+    chain::witness instance;
+    BOOST_REQUIRE(instance.from_data(stream, true));
+    BOOST_REQUIRE_EQUAL(instance.stack().size(), 2u);
+    BOOST_REQUIRE_EQUAL(encode_base16(instance.stack().back()), "bbcc");
+}
+
+BOOST_AUTO_TEST_CASE(transaction__validation_queries__unpopulated__metadata_not_allocated)
+{
+    const auto instance = chain::transaction::factory(to_chunk(base16_literal(TX4)));
+    BOOST_REQUIRE(instance.is_missing_previous_outputs());
+    BOOST_REQUIRE(!instance.missing_previous_outputs().empty());
+    BOOST_REQUIRE(!instance.is_confirmed_double_spend());
+    BOOST_REQUIRE_EQUAL(instance.total_input_value(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.signature_operations(), max_size_t);
+    BOOST_REQUIRE_EQUAL(instance.accept().value(), error::operation_failed);
+    BOOST_REQUIRE_EQUAL(instance.connect().value(), error::operation_failed);
+    BOOST_REQUIRE(!instance.metadata);
+
+    for (const auto& input: instance.inputs())
+        BOOST_REQUIRE(!input.previous_output().metadata);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__recycle__copy__does_not_change_copy)
+{
+    static const auto raw_tx = to_chunk(base16_literal(TX4));
+    auto instance = chain::transaction::factory(raw_tx);
+    const auto copy = instance;
+    BOOST_REQUIRE(instance.recycle(segregated_transaction().to_data(true, true), true, true));
+    BOOST_REQUIRE(copy == chain::transaction::factory(raw_tx));
+    BOOST_REQUIRE(instance == segregated_transaction());
+}
+
+BOOST_AUTO_TEST_CASE(transaction__recycle__populated_metadata__reset)
+{
+    static const auto raw_tx = to_chunk(base16_literal(TX4));
+    chain::transaction instance;
+    BOOST_REQUIRE(instance.recycle(raw_tx));
+    instance.metadata.get().link = 42;
+    instance.inputs()[0].previous_output().metadata.get().height = 42;
+    BOOST_REQUIRE(instance.recycle(raw_tx));
+    BOOST_REQUIRE_EQUAL(instance.metadata.get().link, chain::transaction::validation::unlinked);
+    BOOST_REQUIRE_EQUAL(instance.inputs()[0].previous_output().metadata.get().height, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__recycle__insufficient_input_bytes__failure)
+{
+    chain::transaction instance;
+    BOOST_REQUIRE(instance.recycle(to_chunk(base16_literal(TX4))));
+    BOOST_REQUIRE(!instance.recycle(to_chunk(base16_literal("0000000103"))));
+    BOOST_REQUIRE(!instance.is_valid());
+}
+
+BOOST_AUTO_TEST_CASE(transaction__virtual_size__segregated__weight_rounded_up)
+{
+    const auto tx = segregated_transaction();
+    const auto weight = 3u * tx.to_data(true, false).size() + tx.to_data(true, true).size();
+    BOOST_REQUIRE_EQUAL(tx.weight(), weight);
+    BOOST_REQUIRE_EQUAL(tx.virtual_size(), (weight + 3u) / 4u);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__fee_rate__segregated__fees_per_kilobyte)
+{
+    auto tx = segregated_transaction();
+    auto inputs = tx.inputs();
+    inputs[0].previous_output().metadata->cache.set_value(150000);
+    inputs[1].previous_output().metadata->cache.set_value(50000);
+    tx.set_inputs(std::move(inputs));
+    BOOST_REQUIRE_EQUAL(tx.fees(), 100000u);
+    BOOST_REQUIRE_EQUAL(tx.fee_rate(), 100000u * 1000u / tx.virtual_size());
+}
+
+BOOST_AUTO_TEST_CASE(transaction__fee_rate__overflow__returns_max_uint64)
+{
+    auto tx = segregated_transaction();
+    auto inputs = tx.inputs();
+    inputs[0].previous_output().metadata->cache.set_value(max_uint64 - 1);
+    inputs[1].previous_output().metadata->cache.set_value(0);
+    tx.set_inputs(std::move(inputs));
+    BOOST_REQUIRE_EQUAL(tx.fee_rate(), max_uint64);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__heap_size__case_1__includes_inputs_and_outputs)
+{
+    static const auto raw_tx = to_chunk(base16_literal(TX1));
+    const auto tx = chain::transaction::factory(raw_tx);
+    BOOST_REQUIRE(tx.is_valid());
+
+    auto expected = tx.inputs().capacity() * sizeof(chain::input) +
+        tx.outputs().capacity() * sizeof(chain::output);
+
+    for (const auto& input: tx.inputs())
+        expected += input.heap_size();
+
+    for (const auto& output: tx.outputs())
+        expected += output.heap_size();
+
+    BOOST_REQUIRE_EQUAL(tx.heap_size(), expected);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__heap_size__sighash_precomputation__increases)
+{
+    static const auto raw_tx = to_chunk(base16_literal(TX1));
+    const auto tx = chain::transaction::factory(raw_tx);
+    const auto initial = tx.heap_size();
+    BOOST_REQUIRE(tx.sighash_precomputation());
+    BOOST_REQUIRE_GT(tx.heap_size(), initial);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__metadata__deserialized__unallocated)
+{
+    static const auto raw_tx = to_chunk(base16_literal(TX1));
+    const auto tx = chain::transaction::factory(raw_tx);
+    BOOST_REQUIRE(!tx.metadata);
+    BOOST_REQUIRE(!tx.inputs()[0].previous_output().metadata);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__outputs_hash__set_outputs__recomputed)
+{
+    chain::transaction tx{ 1, 0, {}, { { 1, {} } } };
+    const auto first = tx.outputs_hash();
+    tx.set_outputs({ { 2, {} } });
+    BOOST_REQUIRE(tx.outputs_hash() != first);
+    BOOST_REQUIRE(tx.outputs_hash() == chain::script::to_outputs(tx));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
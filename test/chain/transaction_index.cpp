@@ -0,0 +1,296 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <fstream>
+#include <boost/filesystem.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::chain;
+
+// Test helpers.
+static boost::filesystem::path temporary_file()
+{
+    return boost::filesystem::temp_directory_path() /
+        boost::filesystem::unique_path("transaction_index-%%%%-%%%%.dat");
+}
+
+static hash_digest get_hash(uint64_t value)
+{
+    return bitcoin_hash(to_chunk(to_little_endian(value)));
+}
+
+// Distinct locations and hashes from first.
+static transaction_index::entry::list get_entries(size_t first, size_t count)
+{
+    transaction_index::entry::list entries;
+
+    for (auto value = first; value < first + count; ++value)
+        entries.push_back({ get_hash(value), { static_cast<uint32_t>(
+            value % 7), value * 3, static_cast<uint32_t>(value) } });
+
+    return entries;
+}
+
+static void require_found(const transaction_index::entry::list& entries,
+    const transaction_index& index)
+{
+    for (const auto& entry: entries)
+    {
+        transaction_index::location location;
+        BOOST_REQUIRE(index.find(location, entry.hash));
+        BOOST_REQUIRE_EQUAL(location.file, entry.location.file);
+        BOOST_REQUIRE_EQUAL(location.offset, entry.location.offset);
+        BOOST_REQUIRE_EQUAL(location.length, entry.location.length);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(transaction_index_tests)
+
+BOOST_AUTO_TEST_CASE(transaction_index__open__missing__false)
+{
+    transaction_index instance;
+    BOOST_REQUIRE(!instance.open(temporary_file()));
+    BOOST_REQUIRE(!instance.is_open());
+}
+
+BOOST_AUTO_TEST_CASE(transaction_index__open__not_index__false)
+{
+    const auto file = temporary_file();
+
+    {
+        std::ofstream stream(file.string(), std::ios::binary);
+        stream << std::string(100, 'x');
+    }
+
+    transaction_index instance;
+    BOOST_REQUIRE(!instance.open(file));
+    boost::filesystem::remove(file);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_index__open__truncated__false)
+{
+    const auto file = temporary_file();
+    threadpool pool(0);
+    BOOST_REQUIRE(transaction_index::store(file, get_entries(0, 100), pool));
+    boost::filesystem::resize_file(file,
+        boost::filesystem::file_size(file) - 1);
+
+    transaction_index instance;
+    BOOST_REQUIRE(!instance.open(file));
+    boost::filesystem::remove(file);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_index__store__empty__finds_none)
+{
+    const auto file = temporary_file();
+    threadpool pool(0);
+    BOOST_REQUIRE(transaction_index::store(file, {}, pool));
+
+    transaction_index instance;
+    transaction_index::location location;
+    BOOST_REQUIRE(instance.open(file));
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.partitions(), 1u);
+    BOOST_REQUIRE(!instance.find(location, get_hash(0)));
+    instance.close();
+    boost::filesystem::remove(file);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_index__store__partitions__finds_all)
+{
+    const auto file = temporary_file();
+    const auto count = 3 * transaction_index::partition_target + 42;
+    const auto entries = get_entries(0, count);
+    threadpool pool(4);
+    BOOST_REQUIRE(transaction_index::store(file, entries, pool));
+    pool.shutdown();
+    pool.join();
+
+    transaction_index instance;
+    BOOST_REQUIRE(instance.open(file));
+    BOOST_REQUIRE_EQUAL(instance.size(), count);
+    BOOST_REQUIRE_EQUAL(instance.partitions(), 4u);
+
+    // Pilots and remaps cost less than two bytes for each transaction.
+    BOOST_REQUIRE_LT(boost::filesystem::file_size(file),
+        transaction_index::prefix_size + 4 * transaction_index::partition_size +
+        count * (transaction_index::record_size + 2));
+    require_found(entries, instance);
+    instance.close();
+    boost::filesystem::remove(file);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_index__find__not_stored__false)
+{
+    const auto file = temporary_file();
+    threadpool pool(0);
+    BOOST_REQUIRE(transaction_index::store(file, get_entries(0, 1000), pool));
+
+    transaction_index instance;
+    transaction_index::location location;
+    BOOST_REQUIRE(instance.open(file));
+
+    for (uint64_t value = 1000; value < 2000; ++value)
+        BOOST_REQUIRE(!instance.find(location, get_hash(value)));
+
+    instance.close();
+    boost::filesystem::remove(file);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_index__store__duplicate__first)
+{
+    const auto file = temporary_file();
+    auto entries = get_entries(0, 10);
+    const auto first = entries;
+    entries.push_back({ entries[3].hash, { 9, 9, 9 } });
+    threadpool pool(0);
+    BOOST_REQUIRE(transaction_index::store(file, entries, pool));
+
+    transaction_index instance;
+    BOOST_REQUIRE(instance.open(file));
+    BOOST_REQUIRE_EQUAL(instance.size(), 10u);
+    require_found(first, instance);
+    instance.close();
+    boost::filesystem::remove(file);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_index__entries__stored__all)
+{
+    const auto file = temporary_file();
+    const auto entries = get_entries(0, 500);
+    threadpool pool(0);
+    BOOST_REQUIRE(transaction_index::store(file, entries, pool));
+
+    transaction_index instance;
+    BOOST_REQUIRE(instance.open(file));
+    transaction_index::entry::list stored;
+    instance.entries(stored);
+    BOOST_REQUIRE_EQUAL(stored.size(), entries.size());
+
+    // Stored entries are found at their own location.
+    require_found(stored, instance);
+    instance.close();
+    boost::filesystem::remove(file);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_index__collect__block__transaction_slices)
+{
+    const transaction first
+    {
+        1,
+        0,
+        input::list{ { { null_hash, 7 }, script{}, 0xffffffff } },
+        output::list{ { 100, script::to_pay_key_hash_pattern(short_hash{}) } }
+    };
+
+    const transaction second
+    {
+        2,
+        0,
+        input::list{ { { first.hash(), 0 }, script{}, 0xffffffff } },
+        output::list{ { 50, script{} }, { 49, script{} } }
+    };
+
+    const block instance(header{}, transaction::list{ first, second });
+    const auto data = instance.to_data(true);
+
+    transaction_index::entry::list entries;
+    transaction_index::collect(entries, instance, 5, 1000);
+    BOOST_REQUIRE_EQUAL(entries.size(), 2u);
+
+    for (size_t index = 0; index < entries.size(); ++index)
+    {
+        const auto& tx = instance.transactions()[index];
+        const auto& location = entries[index].location;
+        const auto begin = data.begin() + (location.offset - 1000);
+        BOOST_REQUIRE(entries[index].hash == tx.hash());
+        BOOST_REQUIRE_EQUAL(location.file, 5u);
+        BOOST_REQUIRE(data_chunk(begin, begin + location.length) ==
+            tx.to_data(true, true));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(transaction_index__merge__segments__union_first)
+{
+    const auto first = temporary_file();
+    const auto second = temporary_file();
+    const auto merged = temporary_file();
+    const auto left = get_entries(0, 300);
+    auto right = get_entries(300, 300);
+    right.push_back({ left[0].hash, { 9, 9, 9 } });
+    threadpool pool(2);
+    BOOST_REQUIRE(transaction_index::store(first, left, pool));
+    BOOST_REQUIRE(transaction_index::store(second, right, pool));
+    BOOST_REQUIRE(transaction_index::merge(merged, { first, second }, pool));
+    pool.shutdown();
+    pool.join();
+
+    transaction_index instance;
+    BOOST_REQUIRE(instance.open(merged));
+    BOOST_REQUIRE_EQUAL(instance.size(), 600u);
+    require_found(left, instance);
+    right.pop_back();
+    require_found(right, instance);
+    instance.close();
+    boost::filesystem::remove(first);
+    boost::filesystem::remove(second);
+    boost::filesystem::remove(merged);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_index_set__merge__added__single_segment)
+{
+    const auto first = temporary_file();
+    const auto second = temporary_file();
+    const auto merged = temporary_file();
+    const auto left = get_entries(0, 200);
+    const auto right = get_entries(200, 200);
+    threadpool pool(2);
+    BOOST_REQUIRE(transaction_index::store(first, left, pool));
+    BOOST_REQUIRE(transaction_index::store(second, right, pool));
+
+    transaction_index_set instance;
+    transaction_index::location location;
+    BOOST_REQUIRE(!instance.find(location, left[0].hash));
+    BOOST_REQUIRE(instance.add(first));
+    BOOST_REQUIRE(instance.add(second));
+    BOOST_REQUIRE(!instance.add(merged));
+    BOOST_REQUIRE_EQUAL(instance.segments(), 2u);
+    BOOST_REQUIRE_EQUAL(instance.size(), 400u);
+    BOOST_REQUIRE(instance.find(location, right[7].hash));
+    BOOST_REQUIRE_EQUAL(location.offset, right[7].location.offset);
+
+    BOOST_REQUIRE(instance.merge(merged, pool));
+    pool.shutdown();
+    pool.join();
+    BOOST_REQUIRE_EQUAL(instance.segments(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.size(), 400u);
+    BOOST_REQUIRE(instance.find(location, left[3].hash));
+    BOOST_REQUIRE_EQUAL(location.offset, left[3].location.offset);
+    BOOST_REQUIRE(instance.find(location, right[7].hash));
+    BOOST_REQUIRE_EQUAL(location.offset, right[7].location.offset);
+    BOOST_REQUIRE(!instance.find(location, get_hash(400)));
+    boost::filesystem::remove(first);
+    boost::filesystem::remove(second);
+    boost::filesystem::remove(merged);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,233 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::chain;
+
+BOOST_AUTO_TEST_SUITE(transaction_package_tests)
+
+static const auto external = hash_literal("000000000019d6689c085ae165831e934ff763ae46a2a6c172b3f1b60a8ce26f");
+
+// Test helpers.
+static chain_state::data get_values()
+{
+    chain_state::data values;
+    values.height = 42;
+    values.bits.ordered.push_back(0x1d00ffff);
+    values.version.ordered.push_back(1);
+    values.timestamp.ordered.push_back(1231006505);
+    values.timestamp.retarget = 0;
+    return values;
+}
+
+static output get_output(uint64_t value)
+{
+    return { value, script(data_chunk{ 0x51 }, false) };
+}
+
+static transaction get_spend(const output_point& point, uint64_t value)
+{
+    return { 1, 0, { { point, {}, 0 } }, { get_output(value) } };
+}
+
+static bool populate(utxo_set& source)
+{
+    for (uint32_t index = 0; index < 4; ++index)
+        if (!source.insert({ external, index }, get_output(100), 1, false))
+            return false;
+
+    return true;
+}
+
+// ordering
+
+BOOST_AUTO_TEST_CASE(transaction_package__transactions__child_before_parent__parent_first)
+{
+    const auto parent = get_spend({ external, 0 }, 90);
+    const auto child = get_spend({ parent.hash(), 0 }, 80);
+    const auto grandchild = get_spend({ child.hash(), 0 }, 70);
+    const auto other = get_spend({ external, 1 }, 90);
+    const transaction_package instance({ grandchild, child, other, parent });
+
+    const auto& txs = instance.transactions();
+    BOOST_REQUIRE_EQUAL(txs.size(), 4u);
+    BOOST_REQUIRE_EQUAL(instance.levels(), 3u);
+    BOOST_REQUIRE(txs[0] == other);
+    BOOST_REQUIRE(txs[1] == parent);
+    BOOST_REQUIRE(txs[2] == child);
+    BOOST_REQUIRE(txs[3] == grandchild);
+    BOOST_REQUIRE(instance.parents(0).empty());
+    BOOST_REQUIRE(instance.parents(1).empty());
+    BOOST_REQUIRE_EQUAL(instance.parents(2).size(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.parents(2)[0], 1u);
+    BOOST_REQUIRE_EQUAL(instance.parents(3)[0], 2u);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_package__missing_previous_outputs__in_package__excluded)
+{
+    const auto parent = get_spend({ external, 0 }, 90);
+    const auto child = get_spend({ parent.hash(), 0 }, 80);
+    const transaction_package instance({ child, parent });
+    const auto points = instance.missing_previous_outputs();
+    BOOST_REQUIRE_EQUAL(points.size(), 1u);
+    BOOST_REQUIRE(points[0] == output_point(external, 0));
+}
+
+// populate_previous_outputs
+
+BOOST_AUTO_TEST_CASE(transaction_package__populate_previous_outputs__in_package__unconfirmed)
+{
+    const settings settings(config::settings::mainnet);
+    const chain_state state(get_values(), chain_state::checkpoints{}, 0, 0, settings);
+    const auto parent = get_spend({ external, 0 }, 90);
+    const auto child = get_spend({ parent.hash(), 0 }, 80);
+    const transaction_package instance({ child, parent });
+
+    utxo_set source;
+    BOOST_REQUIRE(populate(source));
+    BOOST_REQUIRE_EQUAL(instance.populate_previous_outputs(state, source).value(), error::success);
+
+    const auto& txs = instance.transactions();
+    const auto& external_prevout = *txs[0].inputs()[0].previous_output().metadata;
+    BOOST_REQUIRE(external_prevout.cache == get_output(100));
+    BOOST_REQUIRE(external_prevout.confirmed);
+    BOOST_REQUIRE_EQUAL(external_prevout.height, 1u);
+
+    const auto& internal_prevout = *txs[1].inputs()[0].previous_output().metadata;
+    BOOST_REQUIRE(internal_prevout.cache == get_output(90));
+    BOOST_REQUIRE(!internal_prevout.confirmed);
+    BOOST_REQUIRE_EQUAL(internal_prevout.height, 42u);
+}
+
+// validate
+
+BOOST_AUTO_TEST_CASE(transaction_package__validate__parent_and_child__success)
+{
+    const settings settings(config::settings::mainnet);
+    const chain_state state(get_values(), chain_state::checkpoints{}, 0, 0, settings);
+    const auto parent = get_spend({ external, 0 }, 90);
+    const auto child = get_spend({ parent.hash(), 0 }, 80);
+    const transaction_package instance({ child, parent });
+
+    utxo_set source;
+    BOOST_REQUIRE(populate(source));
+    BOOST_REQUIRE(!instance.populate_previous_outputs(state, source));
+
+    const auto results = instance.validate(state, settings.max_money());
+    BOOST_REQUIRE_EQUAL(results.size(), 2u);
+    BOOST_REQUIRE_EQUAL(results[0].value(), error::success);
+    BOOST_REQUIRE_EQUAL(results[1].value(), error::success);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_package__validate__failed_parent__orphan_child)
+{
+    const settings settings(config::settings::mainnet);
+    const chain_state state(get_values(), chain_state::checkpoints{}, 0, 0, settings);
+
+    // The parent spends more than its previous output.
+    const auto parent = get_spend({ external, 0 }, 200);
+    const auto child = get_spend({ parent.hash(), 0 }, 80);
+    const auto grandchild = get_spend({ child.hash(), 0 }, 70);
+    const transaction_package instance({ grandchild, child, parent });
+
+    utxo_set source;
+    BOOST_REQUIRE(populate(source));
+    BOOST_REQUIRE(!instance.populate_previous_outputs(state, source));
+
+    const auto results = instance.validate(state, settings.max_money());
+    BOOST_REQUIRE_EQUAL(results[0].value(), error::spend_exceeds_value);
+    BOOST_REQUIRE_EQUAL(results[1].value(), error::orphan_transaction);
+    BOOST_REQUIRE_EQUAL(results[2].value(), error::orphan_transaction);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_package__validate__double_spend__later_rejected)
+{
+    const settings settings(config::settings::mainnet);
+    const chain_state state(get_values(), chain_state::checkpoints{}, 0, 0, settings);
+    const auto first = get_spend({ external, 0 }, 90);
+    const auto second = get_spend({ external, 0 }, 80);
+    const transaction_package instance({ first, second });
+
+    utxo_set source;
+    BOOST_REQUIRE(populate(source));
+    BOOST_REQUIRE(!instance.populate_previous_outputs(state, source));
+
+    const auto results = instance.validate(state, settings.max_money());
+    BOOST_REQUIRE_EQUAL(results[0].value(), error::success);
+    BOOST_REQUIRE_EQUAL(results[1].value(), error::double_spend);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_package__validate__duplicate__duplicate_transaction)
+{
+    const settings settings(config::settings::mainnet);
+    const chain_state state(get_values(), chain_state::checkpoints{}, 0, 0, settings);
+    const auto parent = get_spend({ external, 0 }, 90);
+    const transaction_package instance({ parent, parent });
+
+    utxo_set source;
+    BOOST_REQUIRE(populate(source));
+    BOOST_REQUIRE(!instance.populate_previous_outputs(state, source));
+
+    const auto results = instance.validate(state, settings.max_money());
+    BOOST_REQUIRE_EQUAL(results[0].value(), error::success);
+    BOOST_REQUIRE_EQUAL(results[1].value(), error::duplicate_transaction);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_package__validate__threadpool__same_as_serial)
+{
+    threadpool pool(4);
+    const settings settings(config::settings::mainnet);
+    const chain_state state(get_values(), chain_state::checkpoints{}, 0, 0, settings);
+
+    transaction::list txs;
+    for (uint32_t index = 0; index < 4; ++index)
+    {
+        // Even chains are valid, odd chains fail at the root.
+        const auto root = get_spend({ external, index }, index % 2 == 0 ? 90 : 200);
+        const auto child = get_spend({ root.hash(), 0 }, 80);
+        txs.push_back(child);
+        txs.push_back(root);
+    }
+
+    const transaction_package instance(txs);
+
+    utxo_set source;
+    BOOST_REQUIRE(populate(source));
+    BOOST_REQUIRE(!instance.populate_previous_outputs(state, source));
+
+    const auto serial = instance.validate(state, settings.max_money());
+    const auto parallel = instance.validate(state, settings.max_money(), pool);
+    BOOST_REQUIRE_EQUAL(instance.levels(), 2u);
+    BOOST_REQUIRE_EQUAL(parallel.size(), serial.size());
+
+    for (size_t position = 0; position < serial.size(); ++position)
+        BOOST_REQUIRE_EQUAL(parallel[position].value(), serial[position].value());
+
+    BOOST_REQUIRE_EQUAL(serial[0].value(), error::success);
+    BOOST_REQUIRE_EQUAL(serial[1].value(), error::spend_exceeds_value);
+    BOOST_REQUIRE_EQUAL(serial[5].value(), error::orphan_transaction);
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
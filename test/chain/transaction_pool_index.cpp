@@ -0,0 +1,247 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::chain;
+
+BOOST_AUTO_TEST_SUITE(transaction_pool_index_tests)
+
+static const auto external = hash_literal("000000000019d6689c085ae165831e934ff763ae46a2a6c172b3f1b60a8ce26f");
+
+// Test helpers.
+static transaction get_spend(const output_point::list& points, uint64_t value)
+{
+    input::list inputs;
+    for (const auto& point: points)
+        inputs.push_back({ point, {}, 0 });
+
+    return { 1, 0, std::move(inputs), { { value, script(data_chunk{ 0x51 }, false) } } };
+}
+
+// insert
+
+BOOST_AUTO_TEST_CASE(transaction_pool_index__insert__chain__ancestor_and_descendant_totals)
+{
+    transaction_pool_index instance;
+    const auto parent = get_spend({ { external, 0 } }, 90);
+    const auto child = get_spend({ { parent.hash(), 0 } }, 80);
+    BOOST_REQUIRE(instance.insert(parent, 10, 1));
+    BOOST_REQUIRE(instance.insert(child, 20, 2));
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+    BOOST_REQUIRE_EQUAL(instance.virtual_size(), parent.virtual_size() + child.virtual_size());
+
+    const auto first = instance.find(parent.hash());
+    BOOST_REQUIRE(first != nullptr);
+    BOOST_REQUIRE_EQUAL(first->ancestors.count, 1u);
+    BOOST_REQUIRE_EQUAL(first->descendants.count, 2u);
+    BOOST_REQUIRE_EQUAL(first->descendants.fees, 30u);
+    BOOST_REQUIRE_EQUAL(first->descendants.sigops, 3u);
+    BOOST_REQUIRE_EQUAL(first->descendants.size, parent.virtual_size() + child.virtual_size());
+
+    const auto second = instance.find(child.hash());
+    BOOST_REQUIRE(second != nullptr);
+    BOOST_REQUIRE_EQUAL(second->ancestors.count, 2u);
+    BOOST_REQUIRE_EQUAL(second->ancestors.fees, 30u);
+    BOOST_REQUIRE_EQUAL(second->descendants.count, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_pool_index__insert__diamond__ancestors_counted_once)
+{
+    transaction_pool_index instance;
+    const auto root = get_spend({ { external, 0 } }, 90);
+    const auto left = get_spend({ { root.hash(), 0 } }, 80);
+    const auto right = get_spend({ { external, 1 } }, 80);
+    const auto right_child = get_spend({ { right.hash(), 0 }, { root.hash(), 1 } }, 70);
+    const auto bottom = get_spend({ { left.hash(), 0 }, { right_child.hash(), 0 } }, 60);
+    BOOST_REQUIRE(instance.insert(root, 1, 0));
+    BOOST_REQUIRE(instance.insert(left, 2, 0));
+    BOOST_REQUIRE(instance.insert(right, 4, 0));
+    BOOST_REQUIRE(instance.insert(right_child, 8, 0));
+    BOOST_REQUIRE(instance.insert(bottom, 16, 0));
+
+    BOOST_REQUIRE_EQUAL(instance.find(bottom.hash())->ancestors.count, 5u);
+    BOOST_REQUIRE_EQUAL(instance.find(bottom.hash())->ancestors.fees, 31u);
+    BOOST_REQUIRE_EQUAL(instance.find(root.hash())->descendants.count, 4u);
+    BOOST_REQUIRE_EQUAL(instance.find(root.hash())->descendants.fees, 27u);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_pool_index__insert__duplicate_or_conflict__false)
+{
+    transaction_pool_index instance;
+    const auto first = get_spend({ { external, 0 } }, 90);
+    const auto conflict = get_spend({ { external, 0 } }, 80);
+    BOOST_REQUIRE(instance.insert(first, 10, 0));
+    BOOST_REQUIRE(!instance.insert(first, 10, 0));
+    BOOST_REQUIRE(!instance.insert(conflict, 20, 0));
+    BOOST_REQUIRE(instance.spender({ external, 0 })->hash == first.hash());
+    BOOST_REQUIRE(instance.spender({ external, 1 }) == nullptr);
+}
+
+// erase
+
+BOOST_AUTO_TEST_CASE(transaction_pool_index__erase__middle__removes_descendants_updates_ancestors)
+{
+    transaction_pool_index instance;
+    const auto parent = get_spend({ { external, 0 } }, 90);
+    const auto child = get_spend({ { parent.hash(), 0 } }, 80);
+    const auto grandchild = get_spend({ { child.hash(), 0 } }, 70);
+    BOOST_REQUIRE(instance.insert(parent, 10, 1));
+    BOOST_REQUIRE(instance.insert(child, 20, 2));
+    BOOST_REQUIRE(instance.insert(grandchild, 30, 3));
+
+    BOOST_REQUIRE_EQUAL(instance.erase(child.hash()), 2u);
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    BOOST_REQUIRE(instance.find(child.hash()) == nullptr);
+    BOOST_REQUIRE(instance.find(grandchild.hash()) == nullptr);
+    BOOST_REQUIRE(instance.spender({ parent.hash(), 0 }) == nullptr);
+    BOOST_REQUIRE_EQUAL(instance.find(parent.hash())->descendants.count, 1u);
+    BOOST_REQUIRE_EQUAL(instance.find(parent.hash())->descendants.fees, 10u);
+    BOOST_REQUIRE_EQUAL(instance.virtual_size(), parent.virtual_size());
+    BOOST_REQUIRE_EQUAL(instance.erase(child.hash()), 0u);
+}
+
+// confirm
+
+BOOST_AUTO_TEST_CASE(transaction_pool_index__confirm__root__descendants_retained)
+{
+    transaction_pool_index instance;
+    const auto parent = get_spend({ { external, 0 } }, 90);
+    const auto child = get_spend({ { parent.hash(), 0 } }, 80);
+    BOOST_REQUIRE(instance.insert(parent, 10, 1));
+    BOOST_REQUIRE(instance.insert(child, 20, 2));
+
+    BOOST_REQUIRE(!instance.confirm(child.hash()));
+    BOOST_REQUIRE(instance.confirm(parent.hash()));
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+
+    const auto remaining = instance.find(child.hash());
+    BOOST_REQUIRE_EQUAL(remaining->ancestors.count, 1u);
+    BOOST_REQUIRE_EQUAL(remaining->ancestors.fees, 20u);
+
+    // The child is now a root.
+    BOOST_REQUIRE(instance.confirm(child.hash()));
+    BOOST_REQUIRE(instance.empty());
+}
+
+// evict
+
+BOOST_AUTO_TEST_CASE(transaction_pool_index__evict__lowest_descendant_rate__package_removed)
+{
+    transaction_pool_index instance;
+    const auto low = get_spend({ { external, 0 } }, 90);
+    const auto high = get_spend({ { external, 1 } }, 90);
+    const auto low_child = get_spend({ { low.hash(), 0 } }, 80);
+    BOOST_REQUIRE(instance.insert(low, 1, 0));
+    BOOST_REQUIRE(instance.insert(high, 1000, 0));
+    BOOST_REQUIRE(instance.insert(low_child, 2, 0));
+    BOOST_REQUIRE(instance.lowest()->hash == low.hash());
+
+    BOOST_REQUIRE_EQUAL(instance.evict(), 2u);
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    BOOST_REQUIRE(instance.lowest()->hash == high.hash());
+    BOOST_REQUIRE_EQUAL(instance.evict(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.evict(), 0u);
+    BOOST_REQUIRE(instance.lowest() == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_pool_index__evict__child_pays_for_parent__parent_retained)
+{
+    transaction_pool_index instance;
+    const auto parent = get_spend({ { external, 0 } }, 90);
+    const auto other = get_spend({ { external, 1 } }, 90);
+    const auto child = get_spend({ { parent.hash(), 0 } }, 80);
+    BOOST_REQUIRE(instance.insert(parent, 1, 0));
+    BOOST_REQUIRE(instance.insert(other, 50, 0));
+    BOOST_REQUIRE(instance.lowest()->hash == parent.hash());
+
+    // The child raises the descendant rate of its parent above the other.
+    BOOST_REQUIRE(instance.insert(child, 1000, 0));
+    BOOST_REQUIRE(instance.lowest()->hash == other.hash());
+}
+
+BOOST_AUTO_TEST_CASE(transaction_pool_index__insert__reused_slot__consistent)
+{
+    transaction_pool_index instance;
+    for (uint32_t index = 0; index < 8; ++index)
+        BOOST_REQUIRE(instance.insert(get_spend({ { external, index } }, 90), index + 1, 0));
+
+    while (instance.size() > 4)
+        BOOST_REQUIRE_EQUAL(instance.evict(), 1u);
+
+    const auto parent = get_spend({ { external, 100 } }, 90);
+    const auto child = get_spend({ { parent.hash(), 0 } }, 80);
+    BOOST_REQUIRE(instance.insert(parent, 1, 0));
+    BOOST_REQUIRE(instance.insert(child, 3, 0));
+    BOOST_REQUIRE_EQUAL(instance.size(), 6u);
+    BOOST_REQUIRE_EQUAL(instance.find(parent.hash())->descendants.count, 2u);
+    BOOST_REQUIRE_EQUAL(instance.find(child.hash())->ancestors.count, 2u);
+    BOOST_REQUIRE(instance.lowest()->hash == parent.hash());
+}
+
+// visit
+
+BOOST_AUTO_TEST_CASE(transaction_pool_index__visit__ancestor_rate__highest_first)
+{
+    transaction_pool_index instance;
+    const auto parent = get_spend({ { external, 0 } }, 90);
+    const auto child = get_spend({ { parent.hash(), 0 } }, 80);
+    const auto other = get_spend({ { external, 1 } }, 90);
+    BOOST_REQUIRE(instance.insert(parent, 10, 0));
+    BOOST_REQUIRE(instance.insert(child, 1000, 0));
+    BOOST_REQUIRE(instance.insert(other, 100, 0));
+
+    hash_list order;
+    BOOST_REQUIRE(instance.visit([&order](const transaction_pool_index::entry& value)
+    {
+        order.push_back(value.hash);
+        return true;
+    }));
+
+    BOOST_REQUIRE_EQUAL(order.size(), 3u);
+    BOOST_REQUIRE(order[0] == child.hash());
+    BOOST_REQUIRE(order[1] == other.hash());
+    BOOST_REQUIRE(order[2] == parent.hash());
+
+    // Confirming the parent leaves the child with only its own rate.
+    BOOST_REQUIRE(instance.confirm(parent.hash()));
+    BOOST_REQUIRE(instance.ancestors(*instance.find(child.hash())).empty());
+    BOOST_REQUIRE_EQUAL(instance.find(child.hash())->ancestors.fees, 1000u);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_pool_index__descendants__chain__excludes_self)
+{
+    transaction_pool_index instance;
+    const auto parent = get_spend({ { external, 0 } }, 90);
+    const auto child = get_spend({ { parent.hash(), 0 } }, 80);
+    const auto grandchild = get_spend({ { child.hash(), 0 } }, 70);
+    BOOST_REQUIRE(instance.insert(parent, 1, 0));
+    BOOST_REQUIRE(instance.insert(child, 1, 0));
+    BOOST_REQUIRE(instance.insert(grandchild, 1, 0));
+
+    const auto descendants = instance.descendants(*instance.find(parent.hash()));
+    BOOST_REQUIRE_EQUAL(descendants.size(), 2u);
+    const auto ancestors = instance.ancestors(*instance.find(grandchild.hash()));
+    BOOST_REQUIRE_EQUAL(ancestors.size(), 2u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,96 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::chain;
+
+BOOST_AUTO_TEST_SUITE(transaction_recycler_tests)
+
+BOOST_AUTO_TEST_CASE(transaction_recycler__acquire__empty__new_transaction)
+{
+    transaction_recycler instance(2);
+    const auto tx = instance.acquire();
+    BOOST_REQUIRE(tx);
+    BOOST_REQUIRE(!tx->is_valid());
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_recycler__acquire__released__same_transaction)
+{
+    transaction_recycler instance(2);
+    auto tx = instance.acquire();
+    const auto address = tx.get();
+    tx.reset();
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    BOOST_REQUIRE(instance.acquire().get() == address);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_recycler__release__full__deleted)
+{
+    transaction_recycler instance(1);
+    auto first = instance.acquire();
+    auto second = instance.acquire();
+    first.reset();
+    second.reset();
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_recycler__release__recycler_destroyed__deleted)
+{
+    transaction_recycler::ptr tx;
+
+    {
+        transaction_recycler instance(1);
+        tx = instance.acquire();
+    }
+
+    // Releases without the recycler (verified by leak checkers).
+    tx.reset();
+    BOOST_REQUIRE(!tx);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_recycler__acquire__recycle_released__retains_capacity)
+{
+    const transaction source
+    {
+        1,
+        0,
+        input::list{ { { null_hash, 7 }, script{}, 0xffffffff } },
+        output::list{ { 100, script::to_pay_key_hash_pattern(short_hash{}) } }
+    };
+
+    const auto raw_tx = source.to_data();
+    transaction_recycler instance(1);
+    auto tx = instance.acquire();
+    BOOST_REQUIRE(tx->recycle(raw_tx));
+    const auto address = tx.get();
+    const auto inputs = tx->inputs().data();
+    tx.reset();
+
+    tx = instance.acquire();
+    BOOST_REQUIRE(tx.get() == address);
+    BOOST_REQUIRE(tx->recycle(raw_tx));
+    BOOST_REQUIRE(tx->inputs().data() == inputs);
+    BOOST_REQUIRE(*tx == source);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,120 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::chain;
+using namespace bc::machine;
+
+BOOST_AUTO_TEST_SUITE(transaction_signer_tests)
+
+static const auto secret = hash_literal("ce8f4b713ffdd2658900845251890f30371856be201cd1f5b3d970f793634333");
+static const auto expected = "3045022100e428d3cc67a724cb6cfe8634aa299e58f189d9c46c02641e936c40cc16c7e8ed0220083949910fe999c21734a1f33e42fca15fb463ea2e08f0a1bccd952aacaadbb801";
+
+static transaction get_transaction()
+{
+    data_chunk tx_data;
+    decode_base16(tx_data, "0100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee0970100000000ffffffff01905f0100000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac00000000");
+    return transaction::factory(tx_data);
+}
+
+static script get_prevout_script()
+{
+    script prevout_script;
+    prevout_script.from_string("dup hash160 [88350574280395ad2c3e2ee20e322073d94e5e40] equalverify checksig");
+    return prevout_script;
+}
+
+BOOST_AUTO_TEST_CASE(transaction_signer__sign__empty__true_empty)
+{
+    const auto tx = get_transaction();
+    const transaction_signer instance(tx);
+    transaction_signer::endorsements out;
+    BOOST_REQUIRE(instance.sign(out));
+    BOOST_REQUIRE(out.empty());
+}
+
+BOOST_AUTO_TEST_CASE(transaction_signer__add__inputs__in_order_of_addition)
+{
+    const auto tx = get_transaction();
+    transaction_signer instance(tx);
+    instance.add(0, secret, get_prevout_script(), sighash_algorithm::all);
+    instance.add(0, secret, get_prevout_script(), sighash_algorithm::single, script_version::zero, 42);
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+    BOOST_REQUIRE_EQUAL(instance.inputs()[1].sighash_type, sighash_algorithm::single);
+    BOOST_REQUIRE(instance.inputs()[1].version == script_version::zero);
+    BOOST_REQUIRE_EQUAL(instance.inputs()[1].value, 42u);
+    instance.clear();
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_signer__sign__invalid_index__false_empty)
+{
+    const auto tx = get_transaction();
+    transaction_signer instance(tx);
+    instance.add(1, secret, get_prevout_script(), sighash_algorithm::all, script_version::zero, 42);
+    transaction_signer::endorsements out;
+    BOOST_REQUIRE(!instance.sign(out));
+    BOOST_REQUIRE(out.empty());
+}
+
+BOOST_AUTO_TEST_CASE(transaction_signer__sign__single_input__expected)
+{
+    const auto tx = get_transaction();
+    transaction_signer instance(tx);
+    instance.add(0, secret, get_prevout_script(), sighash_algorithm::all);
+    transaction_signer::endorsements out;
+    BOOST_REQUIRE(instance.sign(out));
+    BOOST_REQUIRE_EQUAL(out.size(), 1u);
+    BOOST_REQUIRE_EQUAL(encode_base16(out[0]), expected);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_signer__sign__pool__matches_create_endorsement_in_order)
+{
+    const auto tx = get_transaction();
+    const auto prevout_script = get_prevout_script();
+    transaction_signer instance(tx);
+
+    for (size_t count = 0; count < 20; ++count)
+    {
+        const auto version = count % 2 == 0 ? script_version::unversioned : script_version::zero;
+        instance.add(0, secret, prevout_script, sighash_algorithm::all, version, count);
+    }
+
+    threadpool pool(4);
+    transaction_signer::endorsements out;
+    BOOST_REQUIRE(instance.sign(out, pool));
+    BOOST_REQUIRE_EQUAL(out.size(), 20u);
+    BOOST_REQUIRE_EQUAL(encode_base16(out[0]), expected);
+
+    for (size_t position = 0; position < out.size(); ++position)
+    {
+        const auto& input = instance.inputs()[position];
+        endorsement endorsement;
+        BOOST_REQUIRE(script::create_endorsement(endorsement, secret, prevout_script, tx, 0, input.sighash_type, input.version, input.value));
+        BOOST_REQUIRE(out[position] == endorsement);
+    }
+
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
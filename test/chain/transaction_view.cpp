@@ -0,0 +1,171 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::chain;
+using namespace bc::machine;
+
+BOOST_AUTO_TEST_SUITE(transaction_view_tests)
+
+transaction view_transaction(bool segregated)
+{
+    transaction tx
+    {
+        2,
+        42,
+        input::list
+        {
+            { { hash_literal("b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee097"), 7 }, script{}, 0xffffffff },
+            { { hash_literal("0bb3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee0"), 1 }, script{ { opcode::push_positive_1 } }, 0xfffffffe }
+        },
+        output::list
+        {
+            { 100000, script::to_pay_key_hash_pattern(short_hash{}) }
+        }
+    };
+
+    if (segregated)
+    {
+        auto inputs = tx.inputs();
+        inputs[0].set_witness(witness{ data_stack{ { 0x01, 0x02 }, { 0x03 } } });
+        tx.set_inputs(std::move(inputs));
+    }
+
+    return tx;
+}
+
+BOOST_AUTO_TEST_CASE(transaction_view__constructor__default__invalid)
+{
+    const transaction_view instance;
+    BOOST_REQUIRE(!instance.is_valid());
+    BOOST_REQUIRE(instance.data().empty());
+    BOOST_REQUIRE(instance.inputs().empty());
+    BOOST_REQUIRE(instance.outputs().empty());
+}
+
+BOOST_AUTO_TEST_CASE(transaction_view__constructor__insufficient_bytes__invalid)
+{
+    const auto data = view_transaction(false).to_data();
+    const data_slice truncated(data.data(), data.data() + data.size() - 1);
+    BOOST_REQUIRE(!transaction_view(truncated).is_valid());
+}
+
+BOOST_AUTO_TEST_CASE(transaction_view__constructor__trailing_bytes__excluded)
+{
+    auto data = view_transaction(false).to_data();
+    const auto size = data.size();
+    data.push_back(0xff);
+    const transaction_view instance(data);
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE_EQUAL(instance.serialized_size(), size);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_view__properties__unsegregated__expected)
+{
+    const auto tx = view_transaction(false);
+    const auto data = tx.to_data();
+    const transaction_view instance(data);
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(!instance.is_segregated());
+    BOOST_REQUIRE(instance.data().data() == data.data());
+    BOOST_REQUIRE_EQUAL(instance.version(), 2u);
+    BOOST_REQUIRE_EQUAL(instance.locktime(), 42u);
+    BOOST_REQUIRE_EQUAL(instance.inputs().size(), 2u);
+    BOOST_REQUIRE_EQUAL(instance.outputs().size(), 1u);
+    BOOST_REQUIRE(instance.witnesses().empty());
+    BOOST_REQUIRE_EQUAL(encode_base16(instance.hash()), encode_base16(tx.hash()));
+    BOOST_REQUIRE_EQUAL(encode_base16(instance.witness_hash()), encode_base16(tx.hash()));
+}
+
+BOOST_AUTO_TEST_CASE(transaction_view__inputs__unsegregated__expected)
+{
+    const auto tx = view_transaction(false);
+    const auto data = tx.to_data();
+    const transaction_view instance(data);
+
+    size_t index = 0;
+    for (const auto& input: instance.inputs())
+    {
+        const auto& expected = tx.inputs()[index++];
+        BOOST_REQUIRE(input.is_valid());
+        BOOST_REQUIRE_EQUAL(encode_base16(input.data()), encode_base16(expected.to_data()));
+        BOOST_REQUIRE_EQUAL(encode_base16(input.previous_output()), encode_base16(expected.previous_output().to_data()));
+        BOOST_REQUIRE_EQUAL(encode_hash(input.previous_output_hash()), encode_hash(expected.previous_output().hash()));
+        BOOST_REQUIRE_EQUAL(input.previous_output_index(), expected.previous_output().index());
+        BOOST_REQUIRE_EQUAL(encode_base16(input.script()), encode_base16(expected.script().to_data(false)));
+        BOOST_REQUIRE_EQUAL(input.sequence(), expected.sequence());
+    }
+
+    BOOST_REQUIRE_EQUAL(index, 2u);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_view__outputs__unsegregated__expected)
+{
+    const auto tx = view_transaction(false);
+    const auto data = tx.to_data();
+    const transaction_view instance(data);
+    const auto output = *instance.outputs().begin();
+    const auto& expected = tx.outputs().front();
+    BOOST_REQUIRE(output.is_valid());
+    BOOST_REQUIRE_EQUAL(output.value(), expected.value());
+    BOOST_REQUIRE_EQUAL(encode_base16(output.script()), encode_base16(expected.script().to_data(false)));
+    BOOST_REQUIRE_EQUAL(encode_base16(output.data()), encode_base16(expected.to_data()));
+}
+
+BOOST_AUTO_TEST_CASE(transaction_view__properties__segregated__expected)
+{
+    const auto tx = view_transaction(true);
+    const auto data = tx.to_data(true, true);
+    const transaction_view instance(data);
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(instance.is_segregated());
+    BOOST_REQUIRE_EQUAL(instance.serialized_size(), data.size());
+    BOOST_REQUIRE_EQUAL(instance.inputs().size(), 2u);
+    BOOST_REQUIRE_EQUAL(instance.outputs().size(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.witnesses().size(), 2u);
+    BOOST_REQUIRE_EQUAL(encode_base16(instance.hash()), encode_base16(tx.hash()));
+    BOOST_REQUIRE_EQUAL(encode_base16(instance.witness_hash()), encode_base16(tx.hash(true)));
+}
+
+BOOST_AUTO_TEST_CASE(transaction_view__witnesses__segregated__expected)
+{
+    const auto data = view_transaction(true).to_data(true, true);
+    const transaction_view instance(data);
+    auto witness = instance.witnesses().begin();
+    BOOST_REQUIRE_EQUAL(witness->size(), 2u);
+    BOOST_REQUIRE_EQUAL(encode_base16(witness->element(0)), "0102");
+    BOOST_REQUIRE_EQUAL(encode_base16(witness->element(1)), "03");
+    BOOST_REQUIRE(witness->element(2).empty());
+    ++witness;
+    BOOST_REQUIRE_EQUAL(witness->size(), 0u);
+    BOOST_REQUIRE(++witness == instance.witnesses().end());
+}
+
+BOOST_AUTO_TEST_CASE(transaction_view__to_transaction__segregated__round_trips)
+{
+    const auto tx = view_transaction(true);
+    const auto data = tx.to_data(true, true);
+    const transaction_view instance(data);
+    BOOST_REQUIRE(instance.to_transaction(true) == tx);
+    BOOST_REQUIRE(!instance.to_transaction().is_segregated());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
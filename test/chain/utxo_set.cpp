@@ -0,0 +1,328 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <map>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::chain;
+using namespace bc::machine;
+
+BOOST_AUTO_TEST_SUITE(utxo_set_tests)
+
+static const auto hash1 = hash_literal("000000000019d6689c085ae165831e934ff763ae46a2a6c172b3f1b60a8ce26f");
+static const auto hash2 = hash_literal("4a5e1e4baab89f3a32518a88c31bc87f618f76673e2cc77ab2127b7afdeda33b");
+static const short_hash short1 = base16_literal("18c0bd8d1818f1bf99cb1df2269c645318ef7b73");
+
+static output to_output(uint64_t value, const operation::list& ops)
+{
+    return output(value, script(ops));
+}
+
+static void require_round_trip(const output& value, size_t height,
+    bool coinbase)
+{
+    utxo_set set;
+    const output_point point(hash1, 7);
+    BOOST_REQUIRE(set.insert(point, value, height, coinbase));
+
+    output out;
+    size_t out_height;
+    bool out_coinbase;
+    BOOST_REQUIRE(set.find(out, out_height, out_coinbase, point));
+    BOOST_REQUIRE(out == value);
+    BOOST_REQUIRE_EQUAL(out.script().to_data(false), value.script().to_data(false));
+    BOOST_REQUIRE_EQUAL(out_height, height);
+    BOOST_REQUIRE_EQUAL(out_coinbase, coinbase);
+}
+
+BOOST_AUTO_TEST_CASE(utxo_set__construct__default__empty)
+{
+    utxo_set set;
+    output out;
+    size_t height;
+    bool coinbase;
+    BOOST_REQUIRE_EQUAL(set.size(), 0u);
+    BOOST_REQUIRE(!set.contains(output_point(hash1, 0)));
+    BOOST_REQUIRE(!set.find(out, height, coinbase, output_point(hash1, 0)));
+    BOOST_REQUIRE(!set.erase(output_point(hash1, 0)));
+}
+
+BOOST_AUTO_TEST_CASE(utxo_set__insert__duplicate__false)
+{
+    utxo_set set;
+    const auto value = to_output(42, script::to_pay_key_hash_pattern(short1));
+    BOOST_REQUIRE(set.insert(output_point(hash1, 0), value, 1, false));
+    BOOST_REQUIRE(!set.insert(output_point(hash1, 0), value, 2, false));
+    BOOST_REQUIRE(set.insert(output_point(hash1, 1), value, 2, false));
+    BOOST_REQUIRE(set.insert(output_point(hash2, 0), value, 2, false));
+    BOOST_REQUIRE_EQUAL(set.size(), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(utxo_set__insert__unspendable__not_stored)
+{
+    utxo_set set;
+    const auto value = to_output(0, script::to_pay_null_data_pattern(to_chunk(short1)));
+    BOOST_REQUIRE(set.insert(output_point(hash1, 0), value, 1, false));
+    BOOST_REQUIRE(!set.contains(output_point(hash1, 0)));
+    BOOST_REQUIRE_EQUAL(set.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(utxo_set__erase__inserted__removed)
+{
+    utxo_set set;
+    const auto value = to_output(42, script::to_pay_script_hash_pattern(short1));
+    BOOST_REQUIRE(set.insert(output_point(hash1, 3), value, 1, false));
+    BOOST_REQUIRE(set.contains(output_point(hash1, 3)));
+    BOOST_REQUIRE(set.erase(output_point(hash1, 3)));
+    BOOST_REQUIRE(!set.contains(output_point(hash1, 3)));
+    BOOST_REQUIRE(!set.erase(output_point(hash1, 3)));
+    BOOST_REQUIRE_EQUAL(set.size(), 0u);
+    BOOST_REQUIRE(set.insert(output_point(hash1, 3), value, 1, false));
+    BOOST_REQUIRE_EQUAL(set.size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(utxo_set__find__templates__round_trip)
+{
+    data_chunk witness_key_hash{ 0x00, 0x14 };
+    extend_data(witness_key_hash, short1);
+    data_chunk witness_script_hash{ 0x00, 0x20 };
+    extend_data(witness_script_hash, hash2);
+
+    require_round_trip(to_output(5000000000, script::to_pay_key_hash_pattern(short1)), 0, true);
+    require_round_trip(to_output(1, script::to_pay_script_hash_pattern(short1)), 1, false);
+    require_round_trip(output(0x7fffffff, script(witness_key_hash, false)), 500000, false);
+    require_round_trip(output(123456789, script(witness_script_hash, false)), 600000, true);
+}
+
+BOOST_AUTO_TEST_CASE(utxo_set__find__non_template__round_trip)
+{
+    // A key hash push of push_one_size is not the template, and is stored raw.
+    data_chunk non_minimal{ 0x76, 0xa9, 0x4c, 0x14 };
+    extend_data(non_minimal, short1);
+    extend_data(non_minimal, data_chunk{ 0x88, 0xac });
+
+    const ec_compressed point = base16_literal("0279be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798");
+    require_round_trip(output(10, script(non_minimal, false)), 2, false);
+    require_round_trip(to_output(20, { { to_chunk(point) }, { opcode::checksig } }), 3, true);
+    require_round_trip(output(30, script()), 4, false);
+}
+
+BOOST_AUTO_TEST_CASE(utxo_set__find__values__round_trip)
+{
+    const auto ops = script::to_pay_key_hash_pattern(short1);
+    require_round_trip(to_output(0, ops), 0, false);
+    require_round_trip(to_output(2100000000000000, ops), 0, false);
+    require_round_trip(to_output(max_uint64, ops), max_uint32, false);
+    require_round_trip(to_output(max_uint64 - 1, ops), 0, false);
+    require_round_trip(to_output(1000000000000000000, ops), 0, false);
+}
+
+BOOST_AUTO_TEST_CASE(utxo_set__erase__many__consistent)
+{
+    utxo_set set;
+    std::map<output_point, output> expected;
+
+    // Growth, rehashing over erased slots and compaction are all exercised.
+    for (uint32_t round = 0; round < 4; ++round)
+    {
+        for (uint32_t index = 0; index < 20000; ++index)
+        {
+            hash_digest hash = hash1;
+            hash[0] = static_cast<uint8_t>(round);
+            const output_point point(hash, index);
+            const auto value = index % 3 == 0 ?
+                output(index, script(data_chunk(index % 50, 0x51), false)) :
+                to_output(index * 1000, script::to_pay_key_hash_pattern(short1));
+
+            BOOST_REQUIRE(set.insert(point, value, round, false));
+            expected.emplace(point, value);
+        }
+
+        for (auto it = expected.begin(); it != expected.end();)
+        {
+            if (pseudo_random::next(0, 2) == 0)
+            {
+                ++it;
+                continue;
+            }
+
+            BOOST_REQUIRE(set.erase(it->first));
+            it = expected.erase(it);
+        }
+    }
+
+    BOOST_REQUIRE_EQUAL(set.size(), expected.size());
+
+    output out;
+    size_t height;
+    bool coinbase;
+    for (const auto& entry: expected)
+    {
+        BOOST_REQUIRE(set.find(out, height, coinbase, entry.first));
+        BOOST_REQUIRE(out == entry.second);
+        BOOST_REQUIRE_EQUAL(height, entry.first.hash()[0]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(utxo_set__insert_erase__block__spends_removed)
+{
+    const auto pay = script::to_pay_key_hash_pattern(short1);
+    const transaction coinbase(1, 0,
+    {
+        input(output_point(null_hash, point::null_index), script(), 0)
+    },
+    {
+        to_output(25, pay), to_output(0, script::to_pay_null_data_pattern(to_chunk(short1))), to_output(26, pay)
+    });
+
+    const output_point external(hash2, 5);
+    const transaction spend(1, 0,
+    {
+        input(output_point(coinbase.hash(), 0), script(), 0),
+        input(external, script(), 0)
+    },
+    {
+        to_output(50, pay)
+    });
+
+    utxo_set set;
+    BOOST_REQUIRE(set.insert(external, to_output(1, pay), 1, false));
+
+    const block value(header(), { coinbase, spend });
+    set.insert(value, 2);
+    BOOST_REQUIRE_EQUAL(set.size(), 4u);
+    BOOST_REQUIRE(set.erase(value));
+    BOOST_REQUIRE_EQUAL(set.size(), 2u);
+    BOOST_REQUIRE(!set.contains(external));
+    BOOST_REQUIRE(!set.contains(output_point(coinbase.hash(), 0)));
+    BOOST_REQUIRE(!set.contains(output_point(coinbase.hash(), 1)));
+    BOOST_REQUIRE(set.contains(output_point(coinbase.hash(), 2)));
+    BOOST_REQUIRE(set.contains(output_point(spend.hash(), 0)));
+
+    output out;
+    size_t height;
+    bool is_coinbase;
+    BOOST_REQUIRE(set.find(out, height, is_coinbase, output_point(coinbase.hash(), 2)));
+    BOOST_REQUIRE_EQUAL(height, 2u);
+    BOOST_REQUIRE(is_coinbase);
+    BOOST_REQUIRE(!set.erase(value));
+}
+
+BOOST_AUTO_TEST_CASE(utxo_set__insert__block_duplicate__replaced)
+{
+    const transaction coinbase(1, 0,
+    {
+        input(output_point(null_hash, point::null_index), script(), 0)
+    },
+    {
+        to_output(25, script::to_pay_key_hash_pattern(short1))
+    });
+
+    utxo_set set;
+    const block value(header(), { coinbase });
+    set.insert(value, 91812);
+    set.insert(value, 91842);
+
+    output out;
+    size_t height;
+    bool is_coinbase;
+    BOOST_REQUIRE_EQUAL(set.size(), 1u);
+    BOOST_REQUIRE(set.find(out, height, is_coinbase, output_point(coinbase.hash(), 0)));
+    BOOST_REQUIRE_EQUAL(height, 91842u);
+}
+
+BOOST_AUTO_TEST_CASE(utxo_set__clear__populated__released)
+{
+    utxo_set set(1000);
+    BOOST_REQUIRE_GT(set.allocated(), 0u);
+    BOOST_REQUIRE(set.insert(output_point(hash1, 0), to_output(1, script::to_pay_key_hash_pattern(short1)), 1, false));
+    set.clear();
+    BOOST_REQUIRE_EQUAL(set.size(), 0u);
+    BOOST_REQUIRE_EQUAL(set.allocated(), 0u);
+    BOOST_REQUIRE(!set.contains(output_point(hash1, 0)));
+    BOOST_REQUIRE(set.insert(output_point(hash1, 0), to_output(1, script::to_pay_key_hash_pattern(short1)), 1, false));
+    BOOST_REQUIRE(set.contains(output_point(hash1, 0)));
+}
+
+BOOST_AUTO_TEST_CASE(utxo_set__insert_compact__round_trip__found)
+{
+    utxo_set set;
+    const auto value = to_output(42, script::to_pay_key_hash_pattern(short1));
+    const auto compact = value.to_compact();
+    BOOST_REQUIRE(set.insert_compact(hash1, 3, compact, 100, true));
+    BOOST_REQUIRE(!set.insert_compact(hash1, 3, compact, 100, true));
+
+    output out;
+    size_t height;
+    bool coinbase;
+    BOOST_REQUIRE(set.find(out, height, coinbase, output_point(hash1, 3)));
+    BOOST_REQUIRE(out == value);
+    BOOST_REQUIRE_EQUAL(height, 100u);
+    BOOST_REQUIRE(coinbase);
+}
+
+BOOST_AUTO_TEST_CASE(utxo_set__visit__inserted__point_order)
+{
+    utxo_set set;
+    const auto value = to_output(42, script::to_pay_key_hash_pattern(short1));
+    BOOST_REQUIRE(set.insert(output_point(hash2, 1), value, 1, false));
+    BOOST_REQUIRE(set.insert(output_point(hash1, 300), value, 2, true));
+    BOOST_REQUIRE(set.insert(output_point(hash2, 0), value, 3, false));
+    BOOST_REQUIRE(set.insert(output_point(hash1, 2), value, 4, false));
+
+    std::vector<output_point> points;
+    std::vector<size_t> heights;
+    BOOST_REQUIRE(set.visit([&](const output_point& point, const output& output, size_t height, bool)
+    {
+        BOOST_REQUIRE(output == value);
+        points.push_back(point);
+        heights.push_back(height);
+        return true;
+    }));
+
+    // hash1 and hash2 are ordered as bytes (hash2 begins 0x3b, hash1 0x6f).
+    BOOST_REQUIRE_EQUAL(points.size(), 4u);
+    BOOST_REQUIRE(points[0] == output_point(hash2, 0));
+    BOOST_REQUIRE(points[1] == output_point(hash2, 1));
+    BOOST_REQUIRE(points[2] == output_point(hash1, 2));
+    BOOST_REQUIRE(points[3] == output_point(hash1, 300));
+    BOOST_REQUIRE(heights == std::vector<size_t>({ 3, 1, 4, 2 }));
+}
+
+BOOST_AUTO_TEST_CASE(utxo_set__visit__handler_false__stopped)
+{
+    utxo_set set;
+    const auto value = to_output(42, script::to_pay_key_hash_pattern(short1));
+    BOOST_REQUIRE(set.insert(output_point(hash1, 0), value, 1, false));
+    BOOST_REQUIRE(set.insert(output_point(hash1, 1), value, 1, false));
+
+    size_t visits = 0;
+    BOOST_REQUIRE(!set.visit([&](const output_point&, const output&, size_t, bool)
+    {
+        ++visits;
+        return false;
+    }));
+
+    BOOST_REQUIRE_EQUAL(visits, 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
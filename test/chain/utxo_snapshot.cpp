@@ -0,0 +1,270 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <boost/filesystem.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::chain;
+using namespace bc::machine;
+
+BOOST_AUTO_TEST_SUITE(utxo_snapshot_tests)
+
+static const auto block_hash = hash_literal("000000000019d6689c085ae165831e934ff763ae46a2a6c172b3f1b60a8ce26f");
+static const size_t block_height = 42;
+
+// Test helpers.
+static boost::filesystem::path write_file(const data_chunk& data)
+{
+    const auto file = boost::filesystem::temp_directory_path() /
+        boost::filesystem::unique_path("utxo_snapshot-%%%%-%%%%.dat");
+    std::ofstream stream(file.string(), std::ios::binary);
+    stream.write(reinterpret_cast<const char*>(data.data()), data.size());
+    return file;
+}
+
+// Coinbase transactions only, so that the block delta is the set of outputs.
+static block get_block()
+{
+    transaction::list transactions;
+
+    for (uint8_t tx = 0; tx < 40; ++tx)
+    {
+        const input coinbase{ { null_hash, point::null_index }, script(data_chunk{ tx, 0x51 }, false), 0 };
+        short_hash key;
+        key.fill(tx);
+
+        transactions.push_back(
+        {
+            1, 0, { coinbase },
+            {
+                { 5000000000u - tx, script(script::to_pay_key_hash_pattern(key)) },
+                { tx, script(data_chunk{ 0x51, tx }, false) },
+                { 0, script(script::to_pay_null_data_pattern(data_chunk{ tx })) },
+                { 1234567u * tx, script(script::to_pay_script_hash_pattern(key)) }
+            }
+        });
+    }
+
+    block value;
+    value.set_transactions(std::move(transactions));
+    return value;
+}
+
+static data_chunk get_snapshot(const utxo_set& set, size_t chunk_size)
+{
+    std::ostringstream stream;
+    utxo_snapshot_writer writer(stream, block_hash, block_height, chunk_size);
+    BOOST_REQUIRE(writer.write(set));
+    BOOST_REQUIRE(writer.finish());
+    BOOST_REQUIRE_EQUAL(writer.size(), set.size());
+    const auto text = stream.str();
+    return data_chunk(text.begin(), text.end());
+}
+
+static void require_equal(const utxo_set& expected, const utxo_set& actual)
+{
+    BOOST_REQUIRE_EQUAL(actual.size(), expected.size());
+
+    BOOST_REQUIRE(expected.visit([&](const output_point& point, const output& value, size_t height, bool coinbase)
+    {
+        output out;
+        size_t out_height;
+        bool out_coinbase;
+        return actual.find(out, out_height, out_coinbase, point) &&
+            out == value && out_height == height && out_coinbase == coinbase;
+    }));
+}
+
+BOOST_AUTO_TEST_CASE(utxo_snapshot__open__missing__false)
+{
+    utxo_snapshot snapshot;
+    BOOST_REQUIRE(!snapshot.open("missing-utxo-snapshot.dat"));
+    BOOST_REQUIRE(!snapshot.is_open());
+}
+
+BOOST_AUTO_TEST_CASE(utxo_snapshot__open__written__expected_properties)
+{
+    utxo_set set;
+    const auto value = get_block();
+    set.insert(value, block_height);
+
+    const auto file = write_file(get_snapshot(set, 256));
+    utxo_snapshot snapshot;
+    BOOST_REQUIRE(snapshot.open(file));
+    BOOST_REQUIRE(snapshot.block_hash() == block_hash);
+    BOOST_REQUIRE_EQUAL(snapshot.height(), block_height);
+    BOOST_REQUIRE_EQUAL(snapshot.size(), 120u);
+    BOOST_REQUIRE_GT(snapshot.chunks(), 10u);
+    BOOST_REQUIRE(snapshot.set_hash() == value.utxo_delta(block_height).digest());
+    snapshot.close();
+    boost::filesystem::remove(file);
+}
+
+BOOST_AUTO_TEST_CASE(utxo_snapshot__open__truncated__false)
+{
+    utxo_set set;
+    set.insert(get_block(), block_height);
+    auto data = get_snapshot(set, 256);
+    data.pop_back();
+
+    const auto file = write_file(data);
+    utxo_snapshot snapshot;
+    BOOST_REQUIRE(!snapshot.open(file));
+    BOOST_REQUIRE(!snapshot.is_open());
+    boost::filesystem::remove(file);
+}
+
+BOOST_AUTO_TEST_CASE(utxo_snapshot__load__threadpool__equal_set)
+{
+    utxo_set set;
+    set.insert(get_block(), block_height);
+
+    const auto file = write_file(get_snapshot(set, 256));
+    utxo_snapshot snapshot;
+    BOOST_REQUIRE(snapshot.open(file));
+
+    threadpool pool(4);
+    utxo_set loaded;
+    BOOST_REQUIRE_EQUAL(snapshot.load(loaded, pool).value(), error::success);
+    require_equal(set, loaded);
+
+    pool.shutdown();
+    pool.join();
+    snapshot.close();
+    boost::filesystem::remove(file);
+}
+
+BOOST_AUTO_TEST_CASE(utxo_snapshot__load__empty_threadpool_single_chunk__equal_set)
+{
+    utxo_set set;
+    set.insert(get_block(), block_height);
+
+    const auto file = write_file(get_snapshot(set, utxo_snapshot_writer::default_chunk_size));
+    utxo_snapshot snapshot;
+    BOOST_REQUIRE(snapshot.open(file));
+    BOOST_REQUIRE_EQUAL(snapshot.chunks(), 1u);
+
+    threadpool pool;
+    utxo_set loaded;
+    BOOST_REQUIRE_EQUAL(snapshot.load(loaded, pool).value(), error::success);
+    require_equal(set, loaded);
+    snapshot.close();
+    boost::filesystem::remove(file);
+}
+
+BOOST_AUTO_TEST_CASE(utxo_snapshot__load__empty_set__success)
+{
+    const auto file = write_file(get_snapshot(utxo_set{}, 256));
+    utxo_snapshot snapshot;
+    BOOST_REQUIRE(snapshot.open(file));
+    BOOST_REQUIRE_EQUAL(snapshot.chunks(), 0u);
+    BOOST_REQUIRE(snapshot.set_hash() == muhash().digest());
+
+    threadpool pool;
+    utxo_set loaded;
+    BOOST_REQUIRE_EQUAL(snapshot.load(loaded, pool).value(), error::success);
+    BOOST_REQUIRE_EQUAL(loaded.size(), 0u);
+    snapshot.close();
+    boost::filesystem::remove(file);
+}
+
+BOOST_AUTO_TEST_CASE(utxo_snapshot__load__corrupt_payload__bad_stream)
+{
+    utxo_set set;
+    set.insert(get_block(), block_height);
+    auto data = get_snapshot(set, 256);
+
+    // The first payload follows the header and the first chunk frame.
+    data[4 + 1 + 32 + 4 + 4 + 4 + 32 + 10] ^= 0x01;
+
+    const auto file = write_file(data);
+    utxo_snapshot snapshot;
+    BOOST_REQUIRE(snapshot.open(file));
+
+    threadpool pool(2);
+    utxo_set loaded;
+    BOOST_REQUIRE_EQUAL(snapshot.load(loaded, pool).value(), error::bad_stream);
+
+    pool.shutdown();
+    pool.join();
+    snapshot.close();
+    boost::filesystem::remove(file);
+}
+
+BOOST_AUTO_TEST_CASE(utxo_snapshot__load__incorrect_set_hash__bad_stream)
+{
+    utxo_set set;
+    set.insert(get_block(), block_height);
+    auto data = get_snapshot(set, 256);
+    data.back() ^= 0x01;
+
+    const auto file = write_file(data);
+    utxo_snapshot snapshot;
+    BOOST_REQUIRE(snapshot.open(file));
+
+    threadpool pool;
+    utxo_set loaded;
+    BOOST_REQUIRE_EQUAL(snapshot.load(loaded, pool).value(), error::bad_stream);
+    snapshot.close();
+    boost::filesystem::remove(file);
+}
+
+BOOST_AUTO_TEST_CASE(utxo_snapshot__load__present_output__unspent_duplicate)
+{
+    utxo_set set;
+    const auto value = get_block();
+    set.insert(value, block_height);
+
+    const auto file = write_file(get_snapshot(set, 256));
+    utxo_snapshot snapshot;
+    BOOST_REQUIRE(snapshot.open(file));
+
+    threadpool pool;
+    utxo_set loaded;
+    const auto& tx = value.transactions().back();
+    BOOST_REQUIRE(loaded.insert({ tx.hash(), 0 }, tx.outputs()[0], 1, true));
+    BOOST_REQUIRE_EQUAL(snapshot.load(loaded, pool).value(), error::unspent_duplicate);
+    snapshot.close();
+    boost::filesystem::remove(file);
+}
+
+BOOST_AUTO_TEST_CASE(utxo_snapshot_writer__write__unordered_or_unspendable__false)
+{
+    std::ostringstream stream;
+    utxo_snapshot_writer writer(stream, block_hash, block_height);
+    const output value{ 42, script(data_chunk{ 0x51 }, false) };
+    const output unspendable{ 0, script(script::to_pay_null_data_pattern(data_chunk{ 42 })) };
+
+    BOOST_REQUIRE(writer.write({ block_hash, 1 }, value, 1, false));
+    BOOST_REQUIRE(!writer.write({ block_hash, 1 }, value, 1, false));
+    BOOST_REQUIRE(!writer.write({ block_hash, 0 }, value, 1, false));
+    BOOST_REQUIRE(!writer.write({ block_hash, 2 }, unspendable, 1, false));
+    BOOST_REQUIRE(writer.write({ block_hash, 5 }, value, 1, false));
+    BOOST_REQUIRE(writer.finish());
+    BOOST_REQUIRE(!writer.finish());
+    BOOST_REQUIRE(!writer.write({ block_hash, 6 }, value, 1, false));
+    BOOST_REQUIRE_EQUAL(writer.size(), 2u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,175 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <sstream>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::chain;
+
+BOOST_AUTO_TEST_SUITE(validation_capture_tests)
+
+static const auto external = hash_literal("000000000019d6689c085ae165831e934ff763ae46a2a6c172b3f1b60a8ce26f");
+
+static chain_state::data get_values()
+{
+    chain_state::data values;
+    values.height = 1;
+    values.hash = external;
+    values.bits.self = 0x1d00ffff;
+    values.bits.ordered.push_back(0x1d00ffff);
+    values.version.self = 1;
+    values.version.ordered.push_back(1);
+    values.timestamp.self = 1231006506;
+    values.timestamp.ordered.push_back(1231006505);
+    values.timestamp.retarget = 1231006505;
+    return values;
+}
+
+// The coinbase and a spend of a populated coinbase output and an unpopulated
+// external output.
+static block get_block()
+{
+    const script coinbase_script(data_chunk{ 0x00, 0x00 }, false);
+    const transaction coinbase
+    {
+        1, 0, { { { null_hash, point::null_index }, coinbase_script, 0 } }, { { 50, {} } }
+    };
+
+    const transaction spend
+    {
+        1, 0,
+        {
+            { { external, 0 }, script(data_chunk{ 0xac }, false), 7 },
+            { { external, 1 }, {}, 8 }
+        },
+        { { 120, {} } }
+    };
+
+    block value;
+    value.set_transactions({ coinbase, spend });
+    auto& metadata = *value.transactions()[1].inputs()[0].previous_output().metadata;
+    metadata.cache = output(100, script(data_chunk{ 0x51 }, false));
+    metadata.coinbase = true;
+    metadata.confirmed = true;
+    metadata.height = 42;
+    metadata.median_time_past = 1231006500;
+    return value;
+}
+
+BOOST_AUTO_TEST_CASE(validation_capture__constructor__default__invalid)
+{
+    const validation_capture instance;
+    BOOST_REQUIRE(!instance.is_valid());
+    BOOST_REQUIRE(instance.previous_outputs().empty());
+}
+
+BOOST_AUTO_TEST_CASE(validation_capture__constructor__block__previous_outputs_in_block_order)
+{
+    const settings settings(config::settings::mainnet);
+    const chain_state state(get_values(), chain_state::checkpoints{}, 0, 0, settings);
+    const validation_capture instance(get_block(), state);
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE_EQUAL(instance.previous_outputs().size(), 2u);
+    BOOST_REQUIRE_EQUAL(instance.previous_outputs()[0].cache.value(), 100u);
+    BOOST_REQUIRE(!instance.previous_outputs()[1].cache.is_valid());
+}
+
+BOOST_AUTO_TEST_CASE(validation_capture__factory__round_trip__expected)
+{
+    const settings settings(config::settings::mainnet);
+    const chain_state state(get_values(), chain_state::checkpoints{}, 0, 0, settings);
+    const auto value = get_block();
+    const validation_capture expected(value, state);
+    const auto instance = validation_capture::factory(expected.to_data());
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(instance.block_data() == expected.block_data());
+    BOOST_REQUIRE_EQUAL(instance.forks(), state.forks());
+    BOOST_REQUIRE_EQUAL(instance.values().height, 1u);
+    BOOST_REQUIRE(instance.values().hash == external);
+    BOOST_REQUIRE_EQUAL(instance.values().bits.self, 0x1d00ffffu);
+    BOOST_REQUIRE_EQUAL(instance.values().timestamp.retarget, 1231006505u);
+    BOOST_REQUIRE_EQUAL(instance.values().timestamp.ordered.size(), 1u);
+
+    const auto& prevout = instance.previous_outputs()[0];
+    BOOST_REQUIRE(prevout.coinbase);
+    BOOST_REQUIRE(prevout.confirmed);
+    BOOST_REQUIRE(!prevout.spent);
+    BOOST_REQUIRE_EQUAL(prevout.height, 42u);
+    BOOST_REQUIRE_EQUAL(prevout.median_time_past, 1231006500u);
+    BOOST_REQUIRE(prevout.cache == value.transactions()[1].inputs()[0].previous_output().metadata->cache);
+}
+
+BOOST_AUTO_TEST_CASE(validation_capture__factory__concatenated_stream__reads_each)
+{
+    const settings settings(config::settings::mainnet);
+    const chain_state state(get_values(), chain_state::checkpoints{}, 0, 0, settings);
+    const validation_capture expected(get_block(), state);
+    std::stringstream stream;
+    expected.to_data(stream);
+    expected.to_data(stream);
+    BOOST_REQUIRE(validation_capture::factory(stream).is_valid());
+    BOOST_REQUIRE(validation_capture::factory(stream).is_valid());
+    BOOST_REQUIRE(!validation_capture::factory(stream).is_valid());
+}
+
+BOOST_AUTO_TEST_CASE(validation_capture__from_data__bad_magic__false)
+{
+    auto data = validation_capture(get_block(), chain_state(get_values(),
+        chain_state::checkpoints{}, 0, 0, settings(config::settings::mainnet))).to_data();
+    data[0] ^= 0xff;
+    validation_capture instance;
+    BOOST_REQUIRE(!instance.from_data(data));
+    BOOST_REQUIRE(!instance.is_valid());
+}
+
+BOOST_AUTO_TEST_CASE(validation_capture__to_block__round_trip__metadata_populated)
+{
+    const settings settings(config::settings::mainnet);
+    const chain_state state(get_values(), chain_state::checkpoints{}, 0, 0, settings);
+    const auto expected = get_block();
+    const auto instance = validation_capture::factory(validation_capture(expected, state).to_data());
+
+    block value;
+    BOOST_REQUIRE(instance.to_block(value));
+    BOOST_REQUIRE(value == expected);
+    const auto& inputs = value.transactions()[1].inputs();
+    BOOST_REQUIRE_EQUAL(inputs[0].previous_output().metadata->cache.value(), 100u);
+    BOOST_REQUIRE_EQUAL(inputs[0].previous_output().metadata->height, 42u);
+    BOOST_REQUIRE(!inputs[1].previous_output().metadata->cache.is_valid());
+    BOOST_REQUIRE_EQUAL(value.fees(), expected.fees());
+}
+
+BOOST_AUTO_TEST_CASE(validation_capture__to_state__round_trip__expected)
+{
+    const settings settings(config::settings::mainnet);
+    const chain_state expected(get_values(), chain_state::checkpoints{}, 0, 0, settings);
+    const auto instance = validation_capture::factory(validation_capture(get_block(), expected).to_data());
+    const auto state = instance.to_state(settings);
+    BOOST_REQUIRE(state);
+    BOOST_REQUIRE_EQUAL(state->height(), expected.height());
+    BOOST_REQUIRE(state->hash() == expected.hash());
+    BOOST_REQUIRE_EQUAL(state->enabled_forks(), expected.enabled_forks());
+    BOOST_REQUIRE_EQUAL(state->median_time_past(), expected.median_time_past());
+    BOOST_REQUIRE_EQUAL(state->work_required(), expected.work_required());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
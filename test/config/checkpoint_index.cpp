@@ -0,0 +1,101 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::config;
+
+BOOST_AUTO_TEST_SUITE(checkpoint_index_tests)
+
+#define CHECKPOINT_A "000000000019d6689c085ae165831e934ff763ae46a2a6c172b3f1b60a8ce26f:0"
+#define CHECKPOINT_B "0000000069e244f73d78e8fd29ba2fd2ed618bd6fa2ee92559f542fdb26e7c1d:11111"
+#define CHECKPOINT_C "000000002dd5588a74784eaa7ab0507a18ad16a236e7b1ce69f00d7ddfb5d0a6:33333"
+
+BOOST_AUTO_TEST_CASE(checkpoint_index__construct__empty__not_covered)
+{
+    const checkpoint_index index({});
+    BOOST_REQUIRE(index.checkpoints().empty());
+    BOOST_REQUIRE_EQUAL(index.top_height(), 0u);
+    BOOST_REQUIRE(!index.covered(0));
+    BOOST_REQUIRE(index.validate(null_hash, 0));
+    BOOST_REQUIRE(index.find(0) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(checkpoint_index__construct__unordered__sorted)
+{
+    const checkpoint_index index({ checkpoint(CHECKPOINT_C), checkpoint(CHECKPOINT_A), checkpoint(CHECKPOINT_B) });
+    const auto& checks = index.checkpoints();
+    BOOST_REQUIRE_EQUAL(checks.size(), 3u);
+    BOOST_REQUIRE_EQUAL(checks[0].height(), 0u);
+    BOOST_REQUIRE_EQUAL(checks[1].height(), 11111u);
+    BOOST_REQUIRE_EQUAL(checks[2].height(), 33333u);
+    BOOST_REQUIRE_EQUAL(index.top_height(), 33333u);
+}
+
+BOOST_AUTO_TEST_CASE(checkpoint_index__covered__top_height__inclusive)
+{
+    const checkpoint_index index({ checkpoint(CHECKPOINT_C), checkpoint(CHECKPOINT_B) });
+    BOOST_REQUIRE(index.covered(0));
+    BOOST_REQUIRE(index.covered(33333));
+    BOOST_REQUIRE(!index.covered(33334));
+}
+
+BOOST_AUTO_TEST_CASE(checkpoint_index__validate__checkpoint_heights__matches_hash_only)
+{
+    const checkpoint b(CHECKPOINT_B);
+    const checkpoint c(CHECKPOINT_C);
+    const checkpoint_index index({ c, b });
+    BOOST_REQUIRE(index.validate(b.hash(), 11111));
+    BOOST_REQUIRE(!index.validate(c.hash(), 11111));
+    BOOST_REQUIRE(index.validate(c.hash(), 33333));
+    BOOST_REQUIRE(!index.validate(null_hash, 33333));
+}
+
+BOOST_AUTO_TEST_CASE(checkpoint_index__validate__uncheckpointed_height__true)
+{
+    const checkpoint_index index({ checkpoint(CHECKPOINT_B), checkpoint(CHECKPOINT_C) });
+    BOOST_REQUIRE(index.validate(null_hash, 11112));
+    BOOST_REQUIRE(index.validate(null_hash, 42));
+}
+
+BOOST_AUTO_TEST_CASE(checkpoint_index__validate__matches_checkpoint_validate)
+{
+    const checkpoint b(CHECKPOINT_B);
+    const checkpoint c(CHECKPOINT_C);
+    const checkpoint conflict(c.hash(), b.height());
+    const checkpoint::list checks{ c, b, conflict };
+    const checkpoint_index index(checks);
+
+    for (const auto height: { size_t(0), size_t(11111), size_t(33333) })
+        for (const auto& hash: { null_hash, b.hash(), c.hash() })
+            BOOST_REQUIRE_EQUAL(index.validate(hash, height),
+                checkpoint::validate(hash, height, checks));
+}
+
+BOOST_AUTO_TEST_CASE(checkpoint_index__find__heights__expected)
+{
+    const checkpoint b(CHECKPOINT_B);
+    const checkpoint_index index({ checkpoint(CHECKPOINT_C), b });
+    BOOST_REQUIRE(index.find(11110) == nullptr);
+    BOOST_REQUIRE(index.find(11111) != nullptr);
+    BOOST_REQUIRE(*index.find(11111) == b);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -103,4 +103,61 @@ TEST_FORMAT(normal_decimal, "4.2", 420000, mbtc_decimal_places)
 TEST_FORMAT(leading_zero, "0.42", 42000, mbtc_decimal_places)
 TEST_FORMAT(internal_leading_zero, "0.042", 4200, mbtc_decimal_places)
 
+// Character ranges:
+BOOST_AUTO_TEST_CASE(base10_from_chars__range__parses_range_only)
+{
+    const std::string text = "4.2,0.101";
+    const auto data = text.data();
+    uint64_t result;
+    BOOST_REQUIRE(base10_from_chars(result, data, data + 3, mbtc_decimal_places));
+    BOOST_REQUIRE_EQUAL(result, 420000u);
+    BOOST_REQUIRE(!base10_from_chars(result, data + 4, data + text.size(), ubtc_decimal_places));
+    BOOST_REQUIRE(base10_from_chars(result, data + 4, data + text.size(), ubtc_decimal_places, false));
+    BOOST_REQUIRE_EQUAL(result, 11u);
+    BOOST_REQUIRE(!base10_from_chars(result, data, data + text.size(), mbtc_decimal_places));
+}
+
+BOOST_AUTO_TEST_CASE(base10_to_chars__amounts__matches_encode_base10)
+{
+    char buffer[base10_maximum_size];
+    const auto end = buffer + base10_maximum_size;
+
+    const std::vector<uint64_t> amounts{ 0, 1, 42, 4200, 1000000, 2099999997690000, max_uint64 };
+    const std::vector<uint8_t> decimal_places{ 0, 2, 5, 8, 30, 255 };
+
+    for (const auto amount: amounts)
+    {
+        for (const auto places: decimal_places)
+        {
+            const auto written = base10_to_chars(buffer, end, amount, places);
+            BOOST_REQUIRE(written != nullptr);
+            BOOST_REQUIRE_EQUAL(std::string(buffer, written), encode_base10(amount, places));
+
+            uint64_t result;
+            BOOST_REQUIRE(base10_from_chars(result, buffer, written, places));
+            BOOST_REQUIRE_EQUAL(result, amount);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(base10_to_chars__short_buffer__nullptr)
+{
+    char buffer[5];
+    BOOST_REQUIRE(base10_to_chars(buffer, buffer + 4, 4200, mbtc_decimal_places) == nullptr);
+    const auto end = base10_to_chars(buffer, buffer + 5, 4200, mbtc_decimal_places);
+    BOOST_REQUIRE(end == buffer + 5);
+    BOOST_REQUIRE_EQUAL(std::string(buffer, end), "0.042");
+}
+
+BOOST_AUTO_TEST_CASE(encode_base10__column__appended_with_delimiters)
+{
+    std::string out = "amount\n";
+    encode_base10(out, { 0, 42000, 1000000 }, mbtc_decimal_places);
+    BOOST_REQUIRE_EQUAL(out, "amount\n0\n0.42\n10\n");
+
+    out.clear();
+    encode_base10(out, { 1, 2 }, 0, ',');
+    BOOST_REQUIRE_EQUAL(out, "1,2,");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -80,4 +80,78 @@ BOOST_AUTO_TEST_CASE(base16_array_test)
     BOOST_REQUIRE(converted == expected);
 }
 
+// Sizes span the wide kernels and the scalar remainder.
+BOOST_AUTO_TEST_CASE(base16_sequence_round_trip_test)
+{
+    for (size_t size = 0; size < 100; ++size)
+    {
+        data_chunk data(size);
+        for (size_t byte = 0; byte < size; ++byte)
+            data[byte] = static_cast<uint8_t>(byte * 37 + 11);
+
+        std::string expected;
+        for (const auto byte: data)
+        {
+            expected += "0123456789abcdef"[byte >> 4];
+            expected += "0123456789abcdef"[byte & 0x0f];
+        }
+
+        data_chunk decoded;
+        BOOST_REQUIRE_EQUAL(encode_base16(data), expected);
+        BOOST_REQUIRE(decode_base16(decoded, expected));
+        BOOST_REQUIRE(decoded == data);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(base16_upper_case_test)
+{
+    const auto hex_str = "0123456789ABCDEFabcdef0123456789ABCDEFABCDEF0123456789abcdefABCDEF";
+    data_chunk data;
+    BOOST_REQUIRE(decode_base16(data, hex_str));
+    BOOST_REQUIRE_EQUAL(encode_base16(data), "0123456789abcdefabcdef0123456789abcdefabcdef0123456789abcdefabcdef");
+}
+
+BOOST_AUTO_TEST_CASE(base16_invalid_character_test)
+{
+    const std::string valid(128, 'a');
+    data_chunk data;
+
+    for (const auto character: std::string("gG/:@`x \x80\xff"))
+    {
+        for (size_t position = 0; position < valid.size(); position += 7)
+        {
+            auto invalid = valid;
+            invalid[position] = character;
+            BOOST_REQUIRE(!decode_base16(data, invalid));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(base16_buffer_test)
+{
+    const data_chunk data{ 0x01, 0xff, 0x42, 0xbc };
+    char buffer[9] = "--------";
+    encode_base16(buffer, data);
+    BOOST_REQUIRE_EQUAL(std::string(buffer), "01ff42bc");
+
+    std::string reused = "previous value";
+    encode_base16(reused, data);
+    BOOST_REQUIRE_EQUAL(reused, "01ff42bc");
+}
+
+BOOST_AUTO_TEST_CASE(base16_encode_hash_test)
+{
+    const auto& hex_str = "000000000019d6689c085ae165831e934ff763ae46a2a6c172b3f1b60a8ce26f";
+    const auto hash = hash_literal(hex_str);
+    BOOST_REQUIRE_EQUAL(encode_hash(hash), hex_str);
+
+    char buffer[2 * hash_size];
+    encode_hash(buffer, hash);
+    BOOST_REQUIRE_EQUAL(std::string(buffer, sizeof(buffer)), hex_str);
+
+    hash_digest decoded;
+    BOOST_REQUIRE(decode_hash(decoded, hex_str));
+    BOOST_REQUIRE(decoded == hash);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -210,4 +210,85 @@ BOOST_AUTO_TEST_CASE(base_32__decode_base32__empty_prefix2__false)
     BOOST_REQUIRE(!decode_base32(decoded, "1qzzfhee"));
 }
 
+// encode_base32 (out)
+
+BOOST_AUTO_TEST_CASE(base_32__decode_base32__invalid_checksum_reused_out__false_cleared)
+{
+    base32 decoded;
+    decoded.prefix = "bc";
+    decoded.payload = { 1, 2, 3 };
+    BOOST_REQUIRE(!decode_base32(decoded, "A1G7SGD8"));
+    BOOST_REQUIRE(decoded.prefix.empty());
+    BOOST_REQUIRE(decoded.payload.empty());
+}
+
+BOOST_AUTO_TEST_CASE(base_32__encode_base32__reused_out__expected)
+{
+    data_chunk payload;
+    BOOST_REQUIRE(decode_base16(payload, "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f"));
+    std::string encoded = "previous value longer than the encoding";
+    encode_base32(encoded, { "abcdef", payload });
+    BOOST_REQUIRE_EQUAL(encoded, "abcdef1qpzry9x8gf2tvdw0s3jn54khce6mua7lmqqqxw");
+    encode_base32(encoded, { "a", {} });
+    BOOST_REQUIRE_EQUAL(encoded, "a12uel5l");
+}
+
+// batch
+
+BOOST_AUTO_TEST_CASE(base_32__encode_base32__batch__matches_single)
+{
+    data_chunk payload;
+    BOOST_REQUIRE(decode_base16(payload, "18171918161c01100b1d0819171d130d10171d16191c01100b03191d1b1903031d130b190303190d181d01190303190d"));
+    const std::vector<base32> values
+    {
+        { "split", payload }, { "split", {} }, { "a", {} }, { "split", payload }, { "?", {} }
+    };
+
+    string_list encoded(1, "previous");
+    encode_base32(encoded, values);
+    BOOST_REQUIRE_EQUAL(encoded.size(), values.size());
+
+    for (size_t index = 0; index < values.size(); ++index)
+        BOOST_REQUIRE_EQUAL(encoded[index], encode_base32(values[index]));
+}
+
+BOOST_AUTO_TEST_CASE(base_32__decode_base32__batch_valid__true_expected)
+{
+    const string_list encoded
+    {
+        "abcdef1qpzry9x8gf2tvdw0s3jn54khce6mua7lmqqqxw",
+        "A12UEL5L",
+        "a12uel5l",
+        "split1checkupstagehandshakeupstreamerranterredcaperred2y9e3w"
+    };
+
+    std::vector<base32> decoded;
+    BOOST_REQUIRE(decode_base32(decoded, encoded));
+    BOOST_REQUIRE_EQUAL(decoded.size(), encoded.size());
+    BOOST_REQUIRE_EQUAL(decoded[0].prefix, "abcdef");
+    BOOST_REQUIRE_EQUAL(encode_base16(decoded[0].payload), "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f");
+    BOOST_REQUIRE_EQUAL(decoded[1].prefix, "a");
+    BOOST_REQUIRE(decoded[1].payload.empty());
+    BOOST_REQUIRE_EQUAL(encode_base32(decoded[2]), encoded[2]);
+    BOOST_REQUIRE_EQUAL(encode_base32(decoded[3]), encoded[3]);
+}
+
+BOOST_AUTO_TEST_CASE(base_32__decode_base32__batch_invalid__false_cleared)
+{
+    const string_list encoded
+    {
+        "a12uel5l",
+        "A1G7SGD8",
+        "a12uel5l"
+    };
+
+    std::vector<base32> decoded;
+    BOOST_REQUIRE(!decode_base32(decoded, encoded));
+    BOOST_REQUIRE_EQUAL(decoded.size(), encoded.size());
+    BOOST_REQUIRE_EQUAL(decoded[0].prefix, "a");
+    BOOST_REQUIRE(decoded[1].prefix.empty());
+    BOOST_REQUIRE(decoded[1].payload.empty());
+    BOOST_REQUIRE_EQUAL(decoded[2].prefix, "a");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -100,4 +100,47 @@ BOOST_AUTO_TEST_CASE(base58_array_test)
     BOOST_REQUIRE(converted == expected);
 }
 
+BOOST_AUTO_TEST_CASE(base58_array_encode_test)
+{
+    const byte_array<25> address
+    {
+        {
+            0x00, 0x5c, 0xc8, 0x7f, 0x4a, 0x3f, 0xdf, 0xe3,
+            0xa2, 0x34, 0x6b, 0x69, 0x53, 0x26, 0x7c, 0xa8,
+            0x67, 0x28, 0x26, 0x30, 0xd3, 0xf9, 0xb7, 0x8e,
+            0x64
+        }
+    };
+    BOOST_REQUIRE_EQUAL(encode_base58(address), "19TbMSWwHvnxAKy12iNm3KdbGfzfaMFViT");
+
+    std::string reused = "previous";
+    encode_base58(reused, address);
+    BOOST_REQUIRE_EQUAL(reused, "19TbMSWwHvnxAKy12iNm3KdbGfzfaMFViT");
+}
+
+BOOST_AUTO_TEST_CASE(base58_array_extended_key_roundtrip_test)
+{
+    const std::string encoded = "xpub661MyMwAqRbcFtXgS5sYJABqqG9YLmC4Q1Rdap9gSE8NqtwybGhePY2gZ29ESFjqJoCu1Rupje8YtGqsefD265TMg7usUDFdp6W1EGMcet8";
+    byte_array<82> key;
+    BOOST_REQUIRE(decode_base58(key, encoded));
+    BOOST_REQUIRE_EQUAL(encode_base58(key), encoded);
+    BOOST_REQUIRE_EQUAL(encode_base58(to_chunk(key)), encoded);
+}
+
+BOOST_AUTO_TEST_CASE(base58_array_wrong_size_test)
+{
+    byte_array<24> shorter;
+    byte_array<26> longer;
+    BOOST_REQUIRE(!decode_base58(shorter, "19TbMSWwHvnxAKy12iNm3KdbGfzfaMFViT"));
+    BOOST_REQUIRE(!decode_base58(longer, "19TbMSWwHvnxAKy12iNm3KdbGfzfaMFViT"));
+}
+
+BOOST_AUTO_TEST_CASE(base58_invalid_character_test)
+{
+    data_chunk decoded;
+    byte_array<25> converted;
+    BOOST_REQUIRE(!decode_base58(decoded, "19TbMSWwHvnxAKy12iNm3KdbGfzfaMFVi0"));
+    BOOST_REQUIRE(!decode_base58(converted, "19TbMSWwHvnxAKy12iNm3KdbGfzfaMFVi0"));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
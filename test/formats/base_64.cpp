@@ -18,6 +18,7 @@
  */
 #include <boost/test/unit_test.hpp>
 
+#include <sstream>
 #include <bitcoin/bitcoin.hpp>
 
 using namespace bc;
@@ -84,4 +85,63 @@ BOOST_AUTO_TEST_CASE(decode_base64_invalid_test)
     BOOST_REQUIRE(!decode_base64(result, "!@#$%^&*()"));
 }
 
+BOOST_AUTO_TEST_CASE(decode_base64_misplaced_padding_test)
+{
+    data_chunk result;
+    BOOST_REQUIRE(!decode_base64(result, "TQ==TWFu"));
+    BOOST_REQUIRE(!decode_base64(result, "TW=u"));
+    BOOST_REQUIRE(!decode_base64(result, "T==="));
+}
+
+BOOST_AUTO_TEST_CASE(encode_base64_string_reuse_test)
+{
+    std::string out("unrelated content of some length");
+    encode_base64(out, data_chunk(BASE64_DATA_BOOK));
+    BOOST_REQUIRE_EQUAL(out, BASE64_BOOK);
+}
+
+BOOST_AUTO_TEST_CASE(encode_base64_long_round_trip_test)
+{
+    // Long enough to exercise vector kernels and every scalar remainder.
+    for (size_t size = 0; size < 200; ++size)
+    {
+        data_chunk decoded(size);
+        for (size_t index = 0; index < size; ++index)
+            decoded[index] = static_cast<uint8_t>(index * 37 + size);
+
+        const auto encoded = encode_base64(decoded);
+        BOOST_REQUIRE_EQUAL(encoded.size(), ((size + 2) / 3) * 4);
+
+        data_chunk result;
+        BOOST_REQUIRE(decode_base64(result, encoded));
+        BOOST_REQUIRE(result == decoded);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(decode_base64_long_invalid_character_test)
+{
+    const data_chunk decoded(120, 0x5a);
+    const auto encoded = encode_base64(decoded);
+    data_chunk result;
+
+    for (size_t index = 0; index < encoded.size(); ++index)
+    {
+        auto corrupt = encoded;
+        corrupt[index] = '*';
+        BOOST_REQUIRE(!decode_base64(result, corrupt));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(encode_base64_stream_test)
+{
+    // Larger than one stream chunk and not a multiple of three.
+    data_chunk decoded(10000);
+    for (size_t index = 0; index < decoded.size(); ++index)
+        decoded[index] = static_cast<uint8_t>(index);
+
+    std::ostringstream stream;
+    encode_base64(stream, decoded);
+    BOOST_REQUIRE_EQUAL(stream.str(), encode_base64(decoded));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
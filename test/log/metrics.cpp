@@ -0,0 +1,155 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::log;
+
+BOOST_AUTO_TEST_SUITE(metrics_tests)
+
+BOOST_AUTO_TEST_CASE(metrics__timer_bin__values__log_linear)
+{
+    BOOST_REQUIRE_EQUAL(metrics::timer::bin(0), 0u);
+    BOOST_REQUIRE_EQUAL(metrics::timer::bin(7), 7u);
+    BOOST_REQUIRE_EQUAL(metrics::timer::bin(8), 8u);
+    BOOST_REQUIRE_EQUAL(metrics::timer::bin(15), 15u);
+    BOOST_REQUIRE_EQUAL(metrics::timer::bin(16), 16u);
+    BOOST_REQUIRE_EQUAL(metrics::timer::bin(17), 16u);
+    BOOST_REQUIRE_EQUAL(metrics::timer::bin(max_uint64), metrics::timer::bins - 1);
+}
+
+BOOST_AUTO_TEST_CASE(metrics__timer_floor__bin__inverse_of_bin)
+{
+    for (size_t bin = 0; bin < metrics::timer::bins; ++bin)
+        BOOST_REQUIRE_EQUAL(metrics::timer::bin(metrics::timer::floor(bin)), bin);
+}
+
+BOOST_AUTO_TEST_CASE(metrics__timer_take__samples__percentiles_and_reset)
+{
+    metrics::timer instance;
+
+    for (uint64_t value = 1; value <= 100; ++value)
+        instance.record(value * 1000);
+
+    const auto snapshot = instance.take();
+    BOOST_REQUIRE_EQUAL(snapshot.count, 100u);
+    BOOST_REQUIRE_EQUAL(snapshot.maximum, 100000u);
+    BOOST_REQUIRE_EQUAL(snapshot.total, 5050000u);
+
+    // Within the 12.5% bin width of the exact percentile.
+    const auto p50 = snapshot.percentile(0.5);
+    const auto p99 = snapshot.percentile(0.99);
+    BOOST_REQUIRE(p50 >= 50000 * 7 / 8 && p50 <= 50000 * 9 / 8);
+    BOOST_REQUIRE(p99 >= 99000 * 7 / 8 && p99 <= 100000);
+
+    BOOST_REQUIRE_EQUAL(instance.take().count, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(metrics__timer_merge__snapshots__combined)
+{
+    metrics::timer first;
+    metrics::timer second;
+    metrics::timer instance;
+    first.record(10);
+    first.record(20);
+    second.record(5000);
+
+    instance.record(30);
+    instance.merge(first.take());
+    instance.merge(second.take());
+
+    const auto snapshot = instance.take();
+    BOOST_REQUIRE_EQUAL(snapshot.count, 4u);
+    BOOST_REQUIRE_EQUAL(snapshot.total, 5060u);
+    BOOST_REQUIRE_EQUAL(snapshot.maximum, 5000u);
+    BOOST_REQUIRE_EQUAL(snapshot.bins[metrics::timer::bin(5000)], 1u);
+}
+
+BOOST_AUTO_TEST_CASE(metrics__collect__updated__statsd_lines)
+{
+    metrics instance;
+    instance.get_counter("blocks").increment(3);
+    instance.get_gauge("height").set(42);
+    instance.get_gauge("idle");
+
+    const auto datagrams = instance.collect("bn.", 1432);
+    BOOST_REQUIRE_EQUAL(datagrams.size(), 1u);
+    BOOST_REQUIRE_EQUAL(datagrams[0], "bn.blocks:3|c\nbn.height:42|g");
+
+    // Counters reset and unchanged gauges are not resent.
+    BOOST_REQUIRE(instance.collect("bn.", 1432).empty());
+}
+
+BOOST_AUTO_TEST_CASE(metrics__collect__timer__aggregates)
+{
+    metrics instance;
+    instance.get_timer("validate").record(asio::microseconds(2048));
+
+    // Percentiles are bin midpoints, bounded by the maximum sample.
+    const auto datagrams = instance.collect("", 1432);
+    BOOST_REQUIRE_EQUAL(datagrams.size(), 1u);
+    BOOST_REQUIRE_EQUAL(datagrams[0],
+        "validate.count:1|c\n"
+        "validate.mean:2.048|g\n"
+        "validate.max:2.048|g\n"
+        "validate.p50:2.048|g\n"
+        "validate.p90:2.048|g\n"
+        "validate.p99:2.048|g");
+}
+
+BOOST_AUTO_TEST_CASE(metrics__collect__exceeds_mtu__split_datagrams)
+{
+    metrics instance;
+    instance.get_counter("a").increment();
+    instance.get_counter("b").increment();
+    instance.get_counter("c").increment();
+
+    // Each line is 5 bytes, two fit in 11 bytes with the separator.
+    const auto datagrams = instance.collect("", 11);
+    BOOST_REQUIRE_EQUAL(datagrams.size(), 2u);
+    BOOST_REQUIRE_EQUAL(datagrams[0], "a:1|c\nb:1|c");
+    BOOST_REQUIRE_EQUAL(datagrams[1], "c:1|c");
+}
+
+BOOST_AUTO_TEST_CASE(metrics__get_counter__same_name__same_instance)
+{
+    metrics instance;
+    BOOST_REQUIRE(&instance.get_counter("x") == &instance.get_counter("x"));
+    BOOST_REQUIRE(&instance.get_counter("x") != &instance.get_counter("y"));
+}
+
+BOOST_AUTO_TEST_CASE(metrics__collect__sampler__sets_gauge_before_collection)
+{
+    metrics instance;
+    uint64_t value = 0;
+    instance.add_sampler([&value](metrics& out)
+    {
+        out.get_gauge("sampled").set(++value);
+    });
+
+    BOOST_REQUIRE_EQUAL(instance.collect("", 1432).front(), "sampled:1|g");
+    BOOST_REQUIRE_EQUAL(instance.collect("", 1432).front(), "sampled:2|g");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,74 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::log;
+
+BOOST_AUTO_TEST_SUITE(source_tests)
+
+BOOST_AUTO_TEST_CASE(source__enabled__default__all)
+{
+    BOOST_REQUIRE(threshold() == severity::verbose);
+    BOOST_REQUIRE(enabled(severity::verbose));
+    BOOST_REQUIRE(enabled(severity::fatal));
+}
+
+BOOST_AUTO_TEST_CASE(source__enabled__info_threshold__below_disabled)
+{
+    set_threshold(severity::info);
+    BOOST_REQUIRE(!enabled(severity::verbose));
+    BOOST_REQUIRE(!enabled(severity::debug));
+    BOOST_REQUIRE(enabled(severity::info));
+    BOOST_REQUIRE(enabled(severity::fatal));
+    set_threshold(severity::verbose);
+}
+
+BOOST_AUTO_TEST_CASE(source__log__below_threshold__arguments_not_evaluated)
+{
+    size_t evaluated = 0;
+    const auto argument = [&evaluated]()
+    {
+        return ++evaluated;
+    };
+
+    set_threshold(severity::error);
+    LOG_VERBOSE("test") << argument();
+    LOG_DEBUG("test") << argument();
+    LOG_WARNING("test") << argument();
+    set_threshold(severity::verbose);
+    BOOST_REQUIRE_EQUAL(evaluated, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(source__log__nested_if__else_binds_outer)
+{
+    auto outer = false;
+
+    if (false)
+        LOG_DEBUG("test") << "unreachable";
+    else
+        outer = true;
+
+    BOOST_REQUIRE(outer);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
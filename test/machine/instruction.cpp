@@ -0,0 +1,146 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::chain;
+using namespace bc::machine;
+
+BOOST_AUTO_TEST_SUITE(instruction_tests)
+
+// The compact decoding must match operation decoding in every position.
+static bool decodes_as_operations(const data_chunk& bytes)
+{
+    const script instance(bytes, false);
+    const auto& ops = instance.operations();
+    const auto instructions = instruction::decode(bytes);
+
+    if (ops.size() != instructions.size())
+        return false;
+
+    for (size_t index = 0; index < ops.size(); ++index)
+    {
+        const auto& op = ops[index];
+        const auto& instruction = instructions[index];
+        const auto data = instruction.data(bytes);
+
+        if (op.code() != instruction.code() ||
+            op.is_valid() != instruction.is_valid() ||
+            op.is_oversized() != instruction.is_oversized() ||
+            op.data() != to_chunk(data))
+            return false;
+    }
+
+    return true;
+}
+
+BOOST_AUTO_TEST_CASE(instruction__constructor_default__always__invalid_disabled)
+{
+    const instruction instance;
+    BOOST_REQUIRE(!instance.is_valid());
+    BOOST_REQUIRE(instance.is_disabled());
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(instruction__decode__empty__empty)
+{
+    BOOST_REQUIRE(instruction::decode(data_chunk{}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(instruction__decode__pay_key_hash__expected)
+{
+    const auto bytes = to_chunk(base16_literal("76a91406ccef231c2db72526df9338894ccf9355e8f12188ac"));
+    const auto instructions = instruction::decode(bytes);
+    BOOST_REQUIRE_EQUAL(instructions.size(), 5u);
+    BOOST_REQUIRE(instructions[0].code() == opcode::dup);
+    BOOST_REQUIRE(instructions[1].code() == opcode::hash160);
+    BOOST_REQUIRE(instructions[2].code() == opcode::push_size_20);
+    BOOST_REQUIRE_EQUAL(instructions[2].offset(), 3u);
+    BOOST_REQUIRE_EQUAL(instructions[2].size(), 20u);
+    BOOST_REQUIRE_EQUAL(encode_base16(instructions[2].data(bytes)), "06ccef231c2db72526df9338894ccf9355e8f121");
+    BOOST_REQUIRE(instructions[3].code() == opcode::equalverify);
+    BOOST_REQUIRE(instructions[4].code() == opcode::checksig);
+    BOOST_REQUIRE(decodes_as_operations(bytes));
+}
+
+BOOST_AUTO_TEST_CASE(instruction__decode__size_prefixed_pushes__expected)
+{
+    const auto bytes = to_chunk(base16_literal("4c02aabb4d0100cc4e01000000dd"));
+    const auto instructions = instruction::decode(bytes);
+    BOOST_REQUIRE_EQUAL(instructions.size(), 3u);
+    BOOST_REQUIRE(instructions[0].code() == opcode::push_one_size);
+    BOOST_REQUIRE_EQUAL(encode_base16(instructions[0].data(bytes)), "aabb");
+    BOOST_REQUIRE(instructions[1].code() == opcode::push_two_size);
+    BOOST_REQUIRE_EQUAL(encode_base16(instructions[1].data(bytes)), "cc");
+    BOOST_REQUIRE(instructions[2].code() == opcode::push_four_size);
+    BOOST_REQUIRE_EQUAL(encode_base16(instructions[2].data(bytes)), "dd");
+    BOOST_REQUIRE(decodes_as_operations(bytes));
+}
+
+BOOST_AUTO_TEST_CASE(instruction__decode__truncated_push__trailing_invalid)
+{
+    const auto bytes = to_chunk(base16_literal("0051030102"));
+    const auto instructions = instruction::decode(bytes);
+    BOOST_REQUIRE_EQUAL(instructions.size(), 3u);
+    BOOST_REQUIRE(instructions[0].is_valid());
+    BOOST_REQUIRE(instructions[1].is_valid());
+    BOOST_REQUIRE(!instructions[2].is_valid());
+    BOOST_REQUIRE(decodes_as_operations(bytes));
+}
+
+BOOST_AUTO_TEST_CASE(instruction__decode__truncated_size_prefix__trailing_invalid)
+{
+    BOOST_REQUIRE(decodes_as_operations(to_chunk(base16_literal("4c"))));
+    BOOST_REQUIRE(decodes_as_operations(to_chunk(base16_literal("4d01"))));
+    BOOST_REQUIRE(decodes_as_operations(to_chunk(base16_literal("4e010000"))));
+    BOOST_REQUIRE(decodes_as_operations(to_chunk(base16_literal("4e02000000ff"))));
+}
+
+BOOST_AUTO_TEST_CASE(instruction__decode__oversized_push__valid_oversized)
+{
+    data_chunk bytes{ 0x4d, 0x09, 0x02 };
+    bytes.resize(bytes.size() + max_push_data_size + 1u, 0x42);
+    const auto instructions = instruction::decode(bytes);
+    BOOST_REQUIRE_EQUAL(instructions.size(), 1u);
+    BOOST_REQUIRE(instructions[0].is_valid());
+    BOOST_REQUIRE(instructions[0].is_oversized());
+    BOOST_REQUIRE(decodes_as_operations(bytes));
+}
+
+BOOST_AUTO_TEST_CASE(instruction__decode__every_single_byte__as_operations)
+{
+    for (size_t value = 0; value <= max_uint8; ++value)
+    {
+        const data_chunk bytes{ static_cast<uint8_t>(value), 0x01, 0x02 };
+        BOOST_REQUIRE_MESSAGE(decodes_as_operations(bytes), value);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(instruction__script_instructions__pay_witness__patterns)
+{
+    const auto bytes = to_chunk(base16_literal("00141d0f172a0ecb48aee1be1f2687d2963ae33f71a1"));
+    const script instance(bytes, false);
+    BOOST_REQUIRE(script::is_witness_program_pattern(instance.instructions()));
+    BOOST_REQUIRE(!script::is_pay_key_hash_pattern(instance.instructions()));
+    BOOST_REQUIRE(instance.version() == script_version::zero);
+    BOOST_REQUIRE_EQUAL(encode_base16(instance.witness_program()), "1d0f172a0ecb48aee1be1f2687d2963ae33f71a1");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
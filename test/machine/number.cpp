@@ -219,6 +219,55 @@ BOOST_AUTO_TEST_CASE(check_operators)
     }
 }
 
+BOOST_AUTO_TEST_CASE(number__element__values__same_as_data)
+{
+    for (size_t i = 0; i < number_values_count; ++i)
+    {
+        for (size_t j = 0; j < number_offsets_count; ++j)
+        {
+            const auto a = number_values[i];
+            const auto b = number_offsets[j];
+
+            for (const auto value: { a, -a, a + b, a - b, -a + b, -a - b })
+            {
+                const number instance(value);
+                BOOST_REQUIRE(instance.element() == stack_element(instance.data()));
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(number__element__int64_extremes__round_trips)
+{
+    for (const auto value: { max_int64, min_int64 + 1 })
+    {
+        const auto element = number(value).element();
+        BOOST_REQUIRE(element.size() <= number::max_encoded_size);
+
+        number instance;
+        BOOST_REQUIRE(instance.set_data(element, number::max_encoded_size));
+        BOOST_REQUIRE_EQUAL(instance.int64(), value);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(number__element__zero__empty)
+{
+    BOOST_REQUIRE(number().element().empty());
+}
+
+BOOST_AUTO_TEST_CASE(number__set_data__element__expected)
+{
+    number instance;
+    BOOST_REQUIRE(instance.set_data(stack_element{ 0x81, 0x80 }, 4));
+    BOOST_REQUIRE_EQUAL(instance.int64(), -129);
+}
+
+BOOST_AUTO_TEST_CASE(number__set_data__oversized_element__false)
+{
+    number instance;
+    BOOST_REQUIRE(!instance.set_data(stack_element{ 1, 2, 3, 4, 5 }, 4));
+}
+
 #else
 
 // big_number value generators
@@ -692,4 +692,69 @@ BOOST_AUTO_TEST_CASE(operation__from_string__checklocktimeverify__nop3_checksequ
     BOOST_REQUIRE(value.data().empty());
 }
 
+BOOST_AUTO_TEST_CASE(operation__properties__all_opcodes__expected_categories)
+{
+    for (size_t value = 0; value <= max_uint8; ++value)
+    {
+        const auto code = static_cast<opcode>(value);
+        const auto properties = operation::properties(code);
+
+        const auto push = value <= 96 && code != opcode::reserved_80;
+        const auto positive = code >= opcode::push_positive_1 &&
+            code <= opcode::push_positive_16;
+        const auto conditional = code == opcode::if_ ||
+            code == opcode::notif || code == opcode::else_ ||
+            code == opcode::endif;
+
+        BOOST_REQUIRE_EQUAL((properties & operation::push) != 0, push);
+        BOOST_REQUIRE_EQUAL((properties & operation::positive) != 0,
+            positive);
+        BOOST_REQUIRE_EQUAL((properties & operation::conditional) != 0,
+            conditional);
+        BOOST_REQUIRE_EQUAL((properties & operation::relaxed_push) != 0,
+            value <= 96);
+        BOOST_REQUIRE_EQUAL((properties & operation::counted) != 0,
+            value >= 97);
+        BOOST_REQUIRE_EQUAL((properties & operation::version) != 0,
+            positive || code == opcode::push_size_0);
+        BOOST_REQUIRE_EQUAL((properties & operation::numeric) != 0,
+            positive || code == opcode::push_negative_1);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(operation__is_disabled__all_opcodes__named_disabled_only)
+{
+    static const std::vector<opcode> disabled
+    {
+        opcode::disabled_verif, opcode::disabled_vernotif,
+        opcode::disabled_cat, opcode::disabled_substr, opcode::disabled_left,
+        opcode::disabled_right, opcode::disabled_invert, opcode::disabled_and,
+        opcode::disabled_or, opcode::disabled_xor, opcode::disabled_mul2,
+        opcode::disabled_div2, opcode::disabled_mul, opcode::disabled_div,
+        opcode::disabled_mod, opcode::disabled_lshift, opcode::disabled_rshift
+    };
+
+    size_t count = 0;
+    for (size_t value = 0; value <= max_uint8; ++value)
+        if (operation::is_disabled(static_cast<opcode>(value)))
+            ++count;
+
+    BOOST_REQUIRE_EQUAL(count, disabled.size());
+
+    for (const auto code: disabled)
+        BOOST_REQUIRE(operation::is_disabled(code));
+}
+
+BOOST_AUTO_TEST_CASE(operation__is_reserved__all_opcodes__expected)
+{
+    for (size_t value = 0; value <= max_uint8; ++value)
+    {
+        const auto code = static_cast<opcode>(value);
+        const auto expected = code == opcode::reserved_80 ||
+            code == opcode::reserved_98 || code == opcode::reserved_137 ||
+            code == opcode::reserved_138 || code >= opcode::reserved_186;
+        BOOST_REQUIRE_EQUAL(operation::is_reserved(code), expected);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
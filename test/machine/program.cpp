@@ -0,0 +1,115 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::machine;
+
+BOOST_AUTO_TEST_SUITE(program_tests)
+
+// Conditional stack.
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(program__conditional__default__closed_succeeded)
+{
+    const program instance;
+    BOOST_REQUIRE(instance.closed());
+    BOOST_REQUIRE(instance.succeeded());
+}
+
+BOOST_AUTO_TEST_CASE(program__conditional__open_true__succeeded)
+{
+    program instance;
+    instance.open(true);
+    BOOST_REQUIRE(!instance.closed());
+    BOOST_REQUIRE(instance.succeeded());
+    instance.close();
+    BOOST_REQUIRE(instance.closed());
+    BOOST_REQUIRE(instance.succeeded());
+}
+
+BOOST_AUTO_TEST_CASE(program__conditional__open_false__not_succeeded)
+{
+    program instance;
+    instance.open(false);
+    BOOST_REQUIRE(!instance.succeeded());
+    instance.close();
+    BOOST_REQUIRE(instance.closed());
+    BOOST_REQUIRE(instance.succeeded());
+}
+
+BOOST_AUTO_TEST_CASE(program__conditional__negate__toggles_top)
+{
+    program instance;
+    instance.open(true);
+    instance.negate();
+    BOOST_REQUIRE(!instance.succeeded());
+    instance.negate();
+    BOOST_REQUIRE(instance.succeeded());
+    instance.negate();
+    BOOST_REQUIRE(!instance.succeeded());
+    instance.close();
+    BOOST_REQUIRE(instance.succeeded());
+}
+
+BOOST_AUTO_TEST_CASE(program__conditional__negate_above_false__not_succeeded)
+{
+    program instance;
+    instance.open(false);
+    instance.open(false);
+    instance.negate();
+    BOOST_REQUIRE(!instance.succeeded());
+    instance.close();
+    BOOST_REQUIRE(!instance.succeeded());
+    instance.negate();
+    BOOST_REQUIRE(instance.succeeded());
+    instance.close();
+    BOOST_REQUIRE(instance.closed());
+}
+
+BOOST_AUTO_TEST_CASE(program__conditional__deep_nesting__first_false_restored)
+{
+    static const size_t depth = 10000;
+
+    program instance;
+    instance.open(true);
+    instance.open(false);
+
+    for (size_t level = 0; level < depth; ++level)
+    {
+        instance.open((level % 2) == 0);
+        instance.negate();
+    }
+
+    BOOST_REQUIRE(!instance.succeeded());
+
+    for (size_t level = 0; level < depth; ++level)
+        instance.close();
+
+    BOOST_REQUIRE(!instance.succeeded());
+    instance.negate();
+    BOOST_REQUIRE(instance.succeeded());
+    instance.close();
+    BOOST_REQUIRE(instance.succeeded());
+    instance.close();
+    BOOST_REQUIRE(instance.closed());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,120 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::chain;
+using namespace bc::machine;
+
+BOOST_AUTO_TEST_SUITE(script_profile_tests)
+
+BOOST_AUTO_TEST_CASE(script_profile__construct__default__empty)
+{
+    const script_profile instance;
+    BOOST_REQUIRE_EQUAL(instance.operation(opcode::dup).count, 0u);
+    BOOST_REQUIRE(instance.operation(opcode::dup).elapsed ==
+        script_profile::duration::zero());
+    BOOST_REQUIRE_EQUAL(instance.depth(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.inputs(), 0u);
+    BOOST_REQUIRE(instance.input_elapsed() == script_profile::duration::zero());
+}
+
+BOOST_AUTO_TEST_CASE(script_profile__record__values__accumulated)
+{
+    script_profile instance;
+    instance.record_operation(opcode::dup, script_profile::duration(3));
+    instance.record_operation(opcode::dup, script_profile::duration(4));
+    instance.record_depth(5);
+    instance.record_depth(2);
+    instance.record_input(script_profile::duration(10));
+    BOOST_REQUIRE_EQUAL(instance.operation(opcode::dup).count, 2u);
+    BOOST_REQUIRE_EQUAL(instance.operation(opcode::dup).elapsed.count(), 7);
+    BOOST_REQUIRE_EQUAL(instance.depth(), 5u);
+    BOOST_REQUIRE_EQUAL(instance.inputs(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.input_elapsed().count(), 10);
+}
+
+BOOST_AUTO_TEST_CASE(script_profile__merge__two_profiles__combined)
+{
+    script_profile first;
+    first.record_operation(opcode::dup, script_profile::duration(3));
+    first.record_depth(2);
+    first.record_input(script_profile::duration(10));
+
+    script_profile second;
+    second.record_operation(opcode::dup, script_profile::duration(4));
+    second.record_operation(opcode::drop, script_profile::duration(1));
+    second.record_depth(7);
+    second.record_input(script_profile::duration(20));
+
+    first.merge(second);
+    BOOST_REQUIRE_EQUAL(first.operation(opcode::dup).count, 2u);
+    BOOST_REQUIRE_EQUAL(first.operation(opcode::dup).elapsed.count(), 7);
+    BOOST_REQUIRE_EQUAL(first.operation(opcode::drop).count, 1u);
+    BOOST_REQUIRE_EQUAL(first.depth(), 7u);
+    BOOST_REQUIRE_EQUAL(first.inputs(), 2u);
+    BOOST_REQUIRE_EQUAL(first.input_elapsed().count(), 30);
+}
+
+BOOST_AUTO_TEST_CASE(script_profile__reset__recorded__empty)
+{
+    script_profile instance;
+    instance.record_operation(opcode::dup, script_profile::duration(3));
+    instance.record_depth(2);
+    instance.record_input(script_profile::duration(10));
+    instance.reset();
+    BOOST_REQUIRE_EQUAL(instance.operation(opcode::dup).count, 0u);
+    BOOST_REQUIRE_EQUAL(instance.depth(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.inputs(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(script_profile__evaluate__profiled_context__operations_counted)
+{
+    script_profile profile;
+    verification_context context(profile);
+    script instance;
+    BOOST_REQUIRE(instance.from_string("1 2 dup drop add"));
+    const transaction tx;
+
+    program evaluated(instance, tx, 0, 0, context);
+    BOOST_REQUIRE(!evaluated.evaluate());
+    BOOST_REQUIRE_EQUAL(profile.operation(opcode::push_positive_1).count, 1u);
+    BOOST_REQUIRE_EQUAL(profile.operation(opcode::push_positive_2).count, 1u);
+    BOOST_REQUIRE_EQUAL(profile.operation(opcode::dup).count, 1u);
+    BOOST_REQUIRE_EQUAL(profile.operation(opcode::drop).count, 1u);
+    BOOST_REQUIRE_EQUAL(profile.operation(opcode::add).count, 1u);
+    BOOST_REQUIRE_EQUAL(profile.depth(), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(script_profile__evaluate__unprofiled_context__not_recorded)
+{
+    script_profile profile;
+    verification_context context;
+    script instance;
+    BOOST_REQUIRE(instance.from_string("1 dup"));
+    const transaction tx;
+
+    program evaluated(instance, tx, 0, 0, context);
+    BOOST_REQUIRE(!evaluated.evaluate());
+    BOOST_REQUIRE(context.profile() == nullptr);
+    BOOST_REQUIRE_EQUAL(profile.operation(opcode::dup).count, 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
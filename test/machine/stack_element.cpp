@@ -0,0 +1,108 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::machine;
+
+BOOST_AUTO_TEST_SUITE(stack_element_tests)
+
+static const size_t inline_size = stack_element::inline_capacity;
+
+BOOST_AUTO_TEST_CASE(stack_element__constructor_default__always__empty)
+{
+    const stack_element instance;
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE(instance.begin() == instance.end());
+    BOOST_REQUIRE(instance.to_data().empty());
+}
+
+BOOST_AUTO_TEST_CASE(stack_element__constructor_data__inline_size__expected)
+{
+    const data_chunk data(inline_size, 0x42);
+    const stack_element instance(data);
+    BOOST_REQUIRE_EQUAL(instance.size(), inline_size);
+    BOOST_REQUIRE(instance.to_data() == data);
+    BOOST_REQUIRE_EQUAL(instance.front(), 0x42);
+    BOOST_REQUIRE_EQUAL(instance.back(), 0x42);
+}
+
+BOOST_AUTO_TEST_CASE(stack_element__constructor_move__heap_size__retains_buffer)
+{
+    data_chunk data(inline_size + 1, 0x24);
+    const auto expected = data;
+    const auto pointer = data.data();
+    const stack_element instance(std::move(data));
+    BOOST_REQUIRE_EQUAL(instance.size(), inline_size + 1);
+    BOOST_REQUIRE(instance.data() == pointer);
+    BOOST_REQUIRE(instance.to_data() == expected);
+}
+
+BOOST_AUTO_TEST_CASE(stack_element__constructor_initializer_list__always__expected)
+{
+    const stack_element instance{ 0x01, 0x02, 0x03 };
+    BOOST_REQUIRE_EQUAL(instance.size(), 3u);
+    BOOST_REQUIRE_EQUAL(instance[0], 0x01);
+    BOOST_REQUIRE_EQUAL(instance[1], 0x02);
+    BOOST_REQUIRE_EQUAL(instance[2], 0x03);
+}
+
+BOOST_AUTO_TEST_CASE(stack_element__copy__inline_and_heap__equal)
+{
+    const stack_element small(data_chunk(10, 0x11));
+    const stack_element large(data_chunk(inline_size * 2, 0x22));
+    const auto small_copy = small;
+    auto large_copy = small;
+    large_copy = large;
+    BOOST_REQUIRE(small_copy == small);
+    BOOST_REQUIRE(large_copy == large);
+    BOOST_REQUIRE(small_copy.data() != small.data());
+    BOOST_REQUIRE(large_copy.data() != large.data());
+}
+
+BOOST_AUTO_TEST_CASE(stack_element__move_assign__heap_to_inline__expected)
+{
+    stack_element instance(data_chunk(inline_size * 2, 0x33));
+    stack_element other(data_chunk(5, 0x44));
+    instance = std::move(other);
+    BOOST_REQUIRE(instance.to_data() == data_chunk(5, 0x44));
+    BOOST_REQUIRE(other.empty());
+}
+
+BOOST_AUTO_TEST_CASE(stack_element__equality__different_values__not_equal)
+{
+    const stack_element first{ 0x01, 0x02 };
+    const stack_element second{ 0x01, 0x03 };
+    const stack_element third{ 0x01 };
+    BOOST_REQUIRE(first != second);
+    BOOST_REQUIRE(first != third);
+    BOOST_REQUIRE(first == stack_element({ 0x01, 0x02 }));
+}
+
+BOOST_AUTO_TEST_CASE(stack_element__data_slice__always__same_bytes)
+{
+    const data_chunk data{ 0xde, 0xad, 0xbe, 0xef };
+    const stack_element instance(data);
+    const data_slice slice(instance);
+    BOOST_REQUIRE_EQUAL(encode_base16(slice), "deadbeef");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,109 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::chain;
+using namespace bc::machine;
+
+BOOST_AUTO_TEST_SUITE(verification_context_tests)
+
+BOOST_AUTO_TEST_CASE(verification_context__acquire__empty__reserved)
+{
+    verification_context instance;
+    const auto stack = instance.acquire();
+    BOOST_REQUIRE(stack.empty());
+    BOOST_REQUIRE_GE(stack.capacity(), max_stack_size);
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(verification_context__release__reserved__retained_cleared)
+{
+    verification_context instance;
+    auto stack = instance.acquire();
+    stack.emplace_back(data_chunk{ 42 });
+    const auto data = stack.data();
+    instance.release(std::move(stack));
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+
+    const auto reused = instance.acquire();
+    BOOST_REQUIRE(reused.empty());
+    BOOST_REQUIRE(reused.data() == data);
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(verification_context__release__unreserved__not_retained)
+{
+    verification_context instance;
+    instance.release(verification_context::element_stack{});
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(verification_context__multisig_pool__default__nullptr)
+{
+    verification_context instance;
+    BOOST_REQUIRE(instance.multisig_pool() == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(verification_context__set_multisig_pool__pool__program_reports)
+{
+    threadpool pool(1);
+    verification_context instance;
+    instance.set_multisig_pool(&pool);
+    BOOST_REQUIRE(instance.multisig_pool() == &pool);
+
+    const script empty;
+    const transaction tx;
+    const program input(empty, tx, 0, 0, instance);
+    BOOST_REQUIRE(input.multisig_pool() == &pool);
+
+    instance.set_multisig_pool(nullptr);
+    BOOST_REQUIRE(input.multisig_pool() == nullptr);
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(verification_context__program__destruct__stacks_returned)
+{
+    verification_context instance;
+    const script empty;
+    const transaction tx;
+
+    {
+        program input(empty, tx, 0, 0, instance);
+        BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+
+        // The moved primary stack is not returned twice.
+        program prevout(empty, std::move(input), true);
+    }
+
+    BOOST_REQUIRE_EQUAL(instance.size(), 3u);
+
+    {
+        program input(empty, tx, 0, 0, instance);
+        BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+        program prevout(empty, input);
+        BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    }
+
+    BOOST_REQUIRE_EQUAL(instance.size(), 4u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
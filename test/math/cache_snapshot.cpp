@@ -0,0 +1,210 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <boost/filesystem.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+// Test helpers.
+static boost::filesystem::path temporary_file()
+{
+    return boost::filesystem::temp_directory_path() /
+        boost::filesystem::unique_path("cache_snapshot-%%%%-%%%%.dat");
+}
+
+static hash_list make_keys(size_t count)
+{
+    hash_list keys;
+
+    for (size_t index = 0; index < count; ++index)
+        keys.push_back(sha256_hash(to_chunk(to_little_endian(
+            static_cast<uint32_t>(index)))));
+
+    return keys;
+}
+
+static const auto secret1 = hash_literal("000000000019d6689c085ae165831e934ff763ae46a2a6c172b3f1b60a8ce26f");
+static const auto salt1 = cache_snapshot::to_salt(secret1, "test");
+
+BOOST_AUTO_TEST_SUITE(cache_snapshot_tests)
+
+BOOST_AUTO_TEST_CASE(cache_snapshot__to_salt__distinct_names__distinct_salts)
+{
+    BOOST_REQUIRE(salt1 == cache_snapshot::to_salt(secret1, "test"));
+    BOOST_REQUIRE(salt1 != cache_snapshot::to_salt(secret1, "other"));
+    BOOST_REQUIRE(salt1 != cache_snapshot::to_salt(null_hash, "test"));
+}
+
+BOOST_AUTO_TEST_CASE(cache_snapshot__open__stored__expected_size_and_tag)
+{
+    const auto path = temporary_file();
+    const auto keys = make_keys(cache_snapshot::chunk_keys + 10);
+    BOOST_REQUIRE(cache_snapshot::store(path, salt1, 42, keys));
+    BOOST_REQUIRE_EQUAL(boost::filesystem::file_size(path),
+        cache_snapshot::prefix_size + (keys.size() + 2) * hash_size);
+
+    cache_snapshot snapshot;
+    BOOST_REQUIRE(snapshot.open(path, salt1));
+    BOOST_REQUIRE(snapshot.is_open());
+    BOOST_REQUIRE_EQUAL(snapshot.size(), keys.size());
+    BOOST_REQUIRE_EQUAL(snapshot.tag(), 42u);
+    snapshot.close();
+    BOOST_REQUIRE(!snapshot.is_open());
+    BOOST_REQUIRE_EQUAL(snapshot.size(), 0u);
+    boost::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(cache_snapshot__open__other_salt__false)
+{
+    const auto path = temporary_file();
+    BOOST_REQUIRE(cache_snapshot::store(path, salt1, 0, make_keys(3)));
+
+    cache_snapshot snapshot;
+    BOOST_REQUIRE(!snapshot.open(path, cache_snapshot::to_salt(secret1, "other")));
+    BOOST_REQUIRE(!snapshot.is_open());
+    boost::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(cache_snapshot__open__missing_or_truncated__false)
+{
+    const auto path = temporary_file();
+    cache_snapshot snapshot;
+    BOOST_REQUIRE(!snapshot.open(path, salt1));
+
+    BOOST_REQUIRE(cache_snapshot::store(path, salt1, 0, make_keys(3)));
+    boost::filesystem::resize_file(path, boost::filesystem::file_size(path) - 1);
+    BOOST_REQUIRE(!snapshot.open(path, salt1));
+    boost::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(cache_snapshot__load__stored__all_keys)
+{
+    const auto path = temporary_file();
+    const auto keys = make_keys(3 * cache_snapshot::chunk_keys + 1);
+    BOOST_REQUIRE(cache_snapshot::store(path, salt1, 0, keys));
+
+    cache_snapshot snapshot;
+    BOOST_REQUIRE(snapshot.open(path, salt1));
+
+    threadpool pool(4);
+    sharded_map<hash_digest, bool> loaded(keys.size());
+    const auto count = snapshot.load(pool, asio::seconds(60),
+        [&loaded](const hash_digest& key)
+        {
+            loaded.insert(key, true);
+            return true;
+        });
+
+    BOOST_REQUIRE_EQUAL(count, keys.size());
+    BOOST_REQUIRE_EQUAL(loaded.size(), keys.size());
+
+    for (const auto& key: keys)
+        BOOST_REQUIRE(loaded.contains(key));
+
+    pool.shutdown();
+    pool.join();
+    boost::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(cache_snapshot__load__corrupt_chunk__chunk_skipped)
+{
+    const auto path = temporary_file();
+    const auto keys = make_keys(2 * cache_snapshot::chunk_keys);
+    BOOST_REQUIRE(cache_snapshot::store(path, salt1, 0, keys));
+
+    // Flip a byte of the first key of the second chunk.
+    {
+        std::fstream stream(path.string(), std::ios::binary | std::ios::in |
+            std::ios::out);
+        stream.seekp(cache_snapshot::prefix_size +
+            (cache_snapshot::chunk_keys + 1) * hash_size);
+        stream.put(static_cast<char>(keys[cache_snapshot::chunk_keys][0] ^ 1));
+    }
+
+    cache_snapshot snapshot;
+    BOOST_REQUIRE(snapshot.open(path, salt1));
+
+    threadpool pool(2);
+    std::atomic<size_t> inserted(0);
+    const auto count = snapshot.load(pool, asio::seconds(60),
+        [&inserted](const hash_digest&)
+        {
+            ++inserted;
+            return true;
+        });
+
+    const size_t expected = cache_snapshot::chunk_keys;
+    BOOST_REQUIRE_EQUAL(count, expected);
+    BOOST_REQUIRE_EQUAL(inserted, expected);
+    pool.shutdown();
+    pool.join();
+    boost::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(cache_snapshot__load__insert_refused__stops)
+{
+    const auto path = temporary_file();
+    BOOST_REQUIRE(cache_snapshot::store(path, salt1, 0, make_keys(100)));
+
+    cache_snapshot snapshot;
+    BOOST_REQUIRE(snapshot.open(path, salt1));
+
+    threadpool pool(0);
+    size_t inserted = 0;
+    const auto count = snapshot.load(pool, asio::seconds(60),
+        [&inserted](const hash_digest&)
+        {
+            if (inserted == 10)
+                return false;
+
+            ++inserted;
+            return true;
+        });
+
+    BOOST_REQUIRE_EQUAL(count, 10u);
+    BOOST_REQUIRE_EQUAL(inserted, 10u);
+    boost::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(cache_snapshot__load__expired__none)
+{
+    const auto path = temporary_file();
+    BOOST_REQUIRE(cache_snapshot::store(path, salt1, 0, make_keys(100)));
+
+    cache_snapshot snapshot;
+    BOOST_REQUIRE(snapshot.open(path, salt1));
+
+    threadpool pool(0);
+    const auto count = snapshot.load(pool, asio::duration::zero(),
+        [](const hash_digest&)
+        {
+            return true;
+        });
+
+    BOOST_REQUIRE_EQUAL(count, 0u);
+    boost::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(crypto_tests)
+
+// FIPS-197 appendix C.3.
+#define AES256_KEY "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f"
+#define AES256_PLAIN "00112233445566778899aabbccddeeff"
+#define AES256_CYPHER "8ea2b7ca516745bfeafc49904b496089"
+
+BOOST_AUTO_TEST_CASE(crypto__aes256_encrypt__fips_197__expected)
+{
+    auto block = base16_literal(AES256_PLAIN);
+    aes256_encrypt(base16_literal(AES256_KEY), block);
+    BOOST_REQUIRE_EQUAL(encode_base16(block), AES256_CYPHER);
+}
+
+BOOST_AUTO_TEST_CASE(crypto__aes256_decrypt__fips_197__expected)
+{
+    auto block = base16_literal(AES256_CYPHER);
+    aes256_decrypt(base16_literal(AES256_KEY), block);
+    BOOST_REQUIRE_EQUAL(encode_base16(block), AES256_PLAIN);
+}
+
+BOOST_AUTO_TEST_CASE(crypto__aes256_encrypt__blocks__single_block_results)
+{
+    const auto key = base16_literal(AES256_KEY);
+
+    // The count is not a multiple of the pipelined block count.
+    std::vector<aes_block> blocks(11);
+    for (size_t index = 0; index < blocks.size(); ++index)
+        blocks[index].fill(static_cast<uint8_t>(index));
+
+    auto expected = blocks;
+    for (auto& block: expected)
+        aes256_encrypt(key, block);
+
+    aes256_encrypt(key, blocks.data(), blocks.size());
+    BOOST_REQUIRE(blocks == expected);
+}
+
+BOOST_AUTO_TEST_CASE(crypto__aes256_decrypt__blocks__round_trip)
+{
+    const auto key = base16_literal(AES256_KEY);
+
+    std::vector<aes_block> blocks(11);
+    for (size_t index = 0; index < blocks.size(); ++index)
+        blocks[index].fill(static_cast<uint8_t>(index * 3));
+
+    const auto plain = blocks;
+    aes256_encrypt(key, blocks.data(), blocks.size());
+    BOOST_REQUIRE(blocks != plain);
+
+    aes256_decrypt(key, blocks.data(), blocks.size());
+    BOOST_REQUIRE(blocks == plain);
+}
+
+BOOST_AUTO_TEST_CASE(crypto__aes256_encrypt__no_blocks__no_effect)
+{
+    aes256_encrypt(base16_literal(AES256_KEY), nullptr, 0);
+    aes256_decrypt(base16_literal(AES256_KEY), nullptr, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,78 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(ec_point_table_tests)
+
+#define POINT "0309ba8621aefd3b6ba4ca6d11a4746e8df8d35d9b51b383338f627ba7fc732731"
+#define SECRET1 "ce8f4b713ffdd2658900845251890f30371856be201cd1f5b3d970f793634333"
+#define SECRET2 "0000000000000000000000000000000000000000000000000000000000000001"
+#define SECRET3 "fffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364140"
+#define ORDER "fffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364141"
+
+BOOST_AUTO_TEST_CASE(ec_point_table__constructor__invalid_point__false)
+{
+    const ec_point_table table(null_compressed_point);
+    BOOST_REQUIRE(!table);
+
+    ec_compressed out;
+    BOOST_REQUIRE(!table.multiply(out, base16_literal(SECRET1)));
+}
+
+BOOST_AUTO_TEST_CASE(ec_point_table__multiply__compressed__ec_multiply)
+{
+    const ec_point_table table(base16_literal(POINT));
+    BOOST_REQUIRE(table);
+
+    for (const ec_secret& scalar: { base16_literal(SECRET1),
+        base16_literal(SECRET2), base16_literal(SECRET3) })
+    {
+        ec_compressed expected = base16_literal(POINT);
+        BOOST_REQUIRE(ec_multiply(expected, scalar));
+
+        ec_compressed out;
+        BOOST_REQUIRE(table.multiply(out, scalar));
+        BOOST_REQUIRE_EQUAL(encode_base16(out), encode_base16(expected));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ec_point_table__multiply__uncompressed__ec_multiply)
+{
+    const ec_point_table table(base16_literal(POINT));
+    ec_uncompressed expected;
+    BOOST_REQUIRE(decompress(expected, base16_literal(POINT)));
+    BOOST_REQUIRE(ec_multiply(expected, base16_literal(SECRET1)));
+
+    ec_uncompressed out;
+    BOOST_REQUIRE(table.multiply(out, base16_literal(SECRET1)));
+    BOOST_REQUIRE_EQUAL(encode_base16(out), encode_base16(expected));
+}
+
+BOOST_AUTO_TEST_CASE(ec_point_table__multiply__invalid_scalar__false)
+{
+    const ec_point_table table(base16_literal(POINT));
+    ec_compressed out;
+    BOOST_REQUIRE(!table.multiply(out, null_hash));
+    BOOST_REQUIRE(!table.multiply(out, base16_literal(ORDER)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
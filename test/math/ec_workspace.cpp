@@ -0,0 +1,156 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(ec_workspace_tests)
+
+#define POINT "0309ba8621aefd3b6ba4ca6d11a4746e8df8d35d9b51b383338f627ba7fc732731"
+#define SECRET1 "ce8f4b713ffdd2658900845251890f30371856be201cd1f5b3d970f793634333"
+#define SECRET2 "0000000000000000000000000000000000000000000000000000000000000001"
+#define ORDER "fffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364141"
+
+BOOST_AUTO_TEST_CASE(ec_workspace__push__invalid_point__false_appended_invalid)
+{
+    ec_workspace workspace;
+    BOOST_REQUIRE(!workspace.push(null_compressed_point));
+    BOOST_REQUIRE_EQUAL(workspace.size(), 1u);
+    BOOST_REQUIRE(!workspace.valid(0));
+
+    ec_compressed out;
+    BOOST_REQUIRE(!workspace.compress(out, 0));
+    BOOST_REQUIRE(!workspace.add(0, base16_literal(SECRET1)));
+}
+
+BOOST_AUTO_TEST_CASE(ec_workspace__push__secret__secret_to_public)
+{
+    ec_compressed expected;
+    BOOST_REQUIRE(secret_to_public(expected, base16_literal(SECRET1)));
+
+    ec_workspace workspace;
+    BOOST_REQUIRE(workspace.push(ec_secret(base16_literal(SECRET1))));
+
+    ec_compressed out;
+    BOOST_REQUIRE(workspace.compress(out, 0));
+    BOOST_REQUIRE_EQUAL(encode_base16(out), encode_base16(expected));
+}
+
+BOOST_AUTO_TEST_CASE(ec_workspace__push__order__false)
+{
+    ec_workspace workspace;
+    BOOST_REQUIRE(!workspace.push(ec_secret(base16_literal(ORDER))));
+    BOOST_REQUIRE(!workspace.valid(0));
+}
+
+BOOST_AUTO_TEST_CASE(ec_workspace__add_multiply__chained__expected)
+{
+    ec_compressed expected = base16_literal(POINT);
+    BOOST_REQUIRE(ec_add(expected, base16_literal(SECRET1)));
+    BOOST_REQUIRE(ec_multiply(expected, base16_literal(SECRET1)));
+    BOOST_REQUIRE(ec_negate(expected));
+
+    ec_workspace workspace;
+    BOOST_REQUIRE(workspace.push(ec_compressed(base16_literal(POINT))));
+    BOOST_REQUIRE(workspace.add(0, base16_literal(SECRET1)));
+    BOOST_REQUIRE(workspace.multiply(0, base16_literal(SECRET1)));
+    BOOST_REQUIRE(workspace.negate(0));
+
+    ec_compressed out;
+    BOOST_REQUIRE(workspace.compress(out, 0));
+    BOOST_REQUIRE_EQUAL(encode_base16(out), encode_base16(expected));
+}
+
+BOOST_AUTO_TEST_CASE(ec_workspace__multiply__order__false_invalidated)
+{
+    ec_workspace workspace;
+    BOOST_REQUIRE(workspace.push(ec_compressed(base16_literal(POINT))));
+    BOOST_REQUIRE(!workspace.multiply(0, base16_literal(ORDER)));
+    BOOST_REQUIRE(!workspace.valid(0));
+}
+
+BOOST_AUTO_TEST_CASE(ec_workspace__sum__points__ec_sum)
+{
+    const ec_compressed point = base16_literal(POINT);
+    ec_compressed generator;
+    BOOST_REQUIRE(secret_to_public(generator, base16_literal(SECRET2)));
+
+    ec_compressed expected;
+    BOOST_REQUIRE(ec_sum(expected, { point, generator, point }));
+
+    ec_workspace workspace;
+    BOOST_REQUIRE(workspace.push(point));
+    BOOST_REQUIRE(workspace.push(ec_secret(base16_literal(SECRET2))));
+    BOOST_REQUIRE(workspace.sum({ 0, 1, 0 }));
+    BOOST_REQUIRE_EQUAL(workspace.size(), 3u);
+
+    ec_compressed out;
+    BOOST_REQUIRE(workspace.compress(out, 2));
+    BOOST_REQUIRE_EQUAL(encode_base16(out), encode_base16(expected));
+}
+
+BOOST_AUTO_TEST_CASE(ec_workspace__sum__negation__false)
+{
+    ec_workspace workspace;
+    BOOST_REQUIRE(workspace.push(ec_compressed(base16_literal(POINT))));
+    BOOST_REQUIRE(workspace.push(ec_compressed(base16_literal(POINT))));
+    BOOST_REQUIRE(workspace.negate(1));
+    BOOST_REQUIRE(!workspace.sum({ 0, 1 }));
+    BOOST_REQUIRE(!workspace.valid(2));
+}
+
+BOOST_AUTO_TEST_CASE(ec_workspace__sum__invalid_index__false)
+{
+    ec_workspace workspace;
+    BOOST_REQUIRE(workspace.push(ec_compressed(base16_literal(POINT))));
+    BOOST_REQUIRE(!workspace.sum({ 0, 42 }));
+    BOOST_REQUIRE(!workspace.sum({}));
+}
+
+BOOST_AUTO_TEST_CASE(ec_workspace__compress__all__invalid_nulled)
+{
+    ec_workspace workspace;
+    BOOST_REQUIRE(workspace.push(ec_compressed(base16_literal(POINT))));
+    BOOST_REQUIRE(!workspace.push(null_compressed_point));
+
+    point_list out;
+    BOOST_REQUIRE(!workspace.compress(out));
+    BOOST_REQUIRE_EQUAL(out.size(), 2u);
+    BOOST_REQUIRE_EQUAL(encode_base16(out[0]), POINT);
+    BOOST_REQUIRE(out[1] == null_compressed_point);
+}
+
+BOOST_AUTO_TEST_CASE(ec_workspace__decompress__point__decompress)
+{
+    ec_uncompressed expected;
+    BOOST_REQUIRE(decompress(expected, base16_literal(POINT)));
+
+    ec_workspace workspace;
+    BOOST_REQUIRE(workspace.push(ec_compressed(base16_literal(POINT))));
+
+    ec_uncompressed out;
+    BOOST_REQUIRE(workspace.decompress(out, 0));
+    BOOST_REQUIRE_EQUAL(encode_base16(out), encode_base16(expected));
+
+    workspace.clear();
+    BOOST_REQUIRE_EQUAL(workspace.size(), 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
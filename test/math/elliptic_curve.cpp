@@ -16,6 +16,7 @@
  * You should have received a copy of the GNU Affero General Public License
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
+#include <thread>
 #include <boost/test/unit_test.hpp>
 #include <bitcoin/bitcoin.hpp>
 
@@ -42,6 +43,19 @@ BOOST_AUTO_TEST_SUITE(elliptic_curve_tests)
 // EC_SUM
 #define GENERATOR_POINT_MULT_4 "02e493dbf1c10d80f3581e4904930b1404cc6c13900ee0758474fa94abe8c4cd13"
 
+// BIP340 test vectors 0, 1 and 4
+#define SCHNORR_SECRET0 "0000000000000000000000000000000000000000000000000000000000000003"
+#define SCHNORR_POINT0 "f9308a019258c31049344f85f89d5229b531c845836f99b08601f113bce036f9"
+#define SCHNORR_SIGNATURE0 "e907831f80848d1069a5371b402410364bdf1c5f8307b0084c55f1ce2dca821525f66a4a85ea8b71e482a74f382d2ce5ebeee8fdb2172f477df4900d310536c0"
+#define SCHNORR_SECRET1 "b7e151628aed2a6abf7158809cf4f3c762e7160f38b4da56a784d9045190cfef"
+#define SCHNORR_POINT1 "dff1d77f2a671c5f36183726db2341be58feae1da2deced843240f7b502ba659"
+#define SCHNORR_AUXILIARY1 "0000000000000000000000000000000000000000000000000000000000000001"
+#define SCHNORR_MESSAGE1 "243f6a8885a308d313198a2e03707344a4093822299f31d0082efa98ec4e6c89"
+#define SCHNORR_SIGNATURE1 "6896bd60eeae296db48a229ff71dfe071bde413e6d43f917dc8dcf8c78de33418906d11ac976abccb20b091292bff4ea897efcb639ea871cfa95f6de339e4b0a"
+#define SCHNORR_POINT4 "d69c3509bb99e412e68b0fe8544e72837dfa30746d8be2aa65975f29d22dc7b9"
+#define SCHNORR_MESSAGE4 "4df3c3f68fcc83b27e9d42c90431a72499f17875c81a599b566c9889b9696703"
+#define SCHNORR_SIGNATURE4 "00000000000000000000003b78ce563f89a0ed9414f5aa28ad0d96d6795f9c6376afb1548af603b3eb45c9f8207dee1060cb71c04e80f593060b07d28308d7f4"
+
 BOOST_AUTO_TEST_CASE(elliptic_curve__secret_to_public__positive__test)
 {
     ec_compressed point;
@@ -131,6 +145,65 @@ BOOST_AUTO_TEST_CASE(elliptic_curve__verify_signature__negative__test)
     BOOST_REQUIRE(!verify_signature(point, sighash, signature));
 }
 
+BOOST_AUTO_TEST_CASE(elliptic_curve__parse_endorsement__slice__refers_to_endorsement)
+{
+    uint8_t sighash_type;
+    data_slice distinguished(nullptr, nullptr);
+    const data_chunk endorsement{ 0x30, 0x06, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x41 };
+    BOOST_REQUIRE(parse_endorsement(sighash_type, distinguished, endorsement));
+    BOOST_REQUIRE_EQUAL(sighash_type, 0x41u);
+    BOOST_REQUIRE_EQUAL(distinguished.size(), endorsement.size() - 1u);
+    BOOST_REQUIRE(distinguished.data() == endorsement.data());
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__parse_endorsement__slice_empty__false)
+{
+    uint8_t sighash_type;
+    data_slice distinguished(nullptr, nullptr);
+    BOOST_REQUIRE(!parse_endorsement(sighash_type, distinguished, data_chunk{}));
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__parse_signature__strict_and_lax__same_signature)
+{
+    der_signature distinguished;
+    BOOST_REQUIRE(decode_base16(distinguished, SIGNATURE2));
+
+    ec_signature strict;
+    ec_signature lax;
+    BOOST_REQUIRE(parse_signature(strict, distinguished, true));
+    BOOST_REQUIRE(parse_signature(lax, distinguished, false));
+    BOOST_REQUIRE(strict == lax);
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__parse_signature__excessive_padding_lax__same_signature)
+{
+    der_signature distinguished;
+    der_signature padded;
+    BOOST_REQUIRE(decode_base16(distinguished, SIGNATURE2));
+    BOOST_REQUIRE(decode_base16(padded, "304602220000bc494fbd09a8e77d8266e2abdea9aef08b9e71b451c7d8de9f63cda33a62437802206b93edd6af7c659db42c579eb34a3a4cb60c28b5a6bc86fd5266d42f6b8bb67d"));
+
+    ec_signature expected;
+    ec_signature signature;
+    BOOST_REQUIRE(parse_signature(expected, distinguished, true));
+    BOOST_REQUIRE(parse_signature(signature, padded, false));
+    BOOST_REQUIRE(signature == expected);
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__parse_signature__excessive_padding_strict__false)
+{
+    ec_signature signature;
+    der_signature padded;
+    BOOST_REQUIRE(decode_base16(padded, "304602220000bc494fbd09a8e77d8266e2abdea9aef08b9e71b451c7d8de9f63cda33a62437802206b93edd6af7c659db42c579eb34a3a4cb60c28b5a6bc86fd5266d42f6b8bb67d"));
+    BOOST_REQUIRE(!parse_signature(signature, padded, true));
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__parse_signature__empty__false)
+{
+    ec_signature signature;
+    BOOST_REQUIRE(!parse_signature(signature, data_chunk{}, true));
+    BOOST_REQUIRE(!parse_signature(signature, data_chunk{}, false));
+}
+
 BOOST_AUTO_TEST_CASE(elliptic_curve__ec_add__positive__test)
 {
     ec_secret secret1{ { 1, 2, 3 } };
@@ -195,4 +268,129 @@ BOOST_AUTO_TEST_CASE(elliptic_curve__ec_sum_test)
     BOOST_REQUIRE_EQUAL(encode_base16(output), GENERATOR_POINT_MULT_4);
 }
 
+BOOST_AUTO_TEST_CASE(elliptic_curve__ec_initialize__sign_on_threads__same_signature)
+{
+    ec_initialize();
+    const ec_secret secret = base16_literal(SECRET3);
+    const hash_digest sighash = hash_literal(SIGHASH3);
+
+    ec_signature signature;
+    BOOST_REQUIRE(sign(signature, secret, sighash));
+
+    // Each thread signs with its own randomized context, signing is rfc6979.
+    ec_signature other;
+    auto result = false;
+    std::thread thread([&]()
+    {
+        result = sign(other, secret, sighash);
+    });
+
+    thread.join();
+    BOOST_REQUIRE(result);
+    BOOST_REQUIRE_EQUAL(encode_base16(other), encode_base16(signature));
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__sign_schnorr__bip340_vector_0__expected)
+{
+    schnorr_signature signature;
+    BOOST_REQUIRE(sign_schnorr(signature, base16_literal(SCHNORR_SECRET0),
+        null_hash, null_hash));
+    BOOST_REQUIRE_EQUAL(encode_base16(signature), SCHNORR_SIGNATURE0);
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__sign_schnorr__bip340_vector_1__expected)
+{
+    schnorr_signature signature;
+    BOOST_REQUIRE(sign_schnorr(signature, base16_literal(SCHNORR_SECRET1),
+        base16_literal(SCHNORR_MESSAGE1), base16_literal(SCHNORR_AUXILIARY1)));
+    BOOST_REQUIRE_EQUAL(encode_base16(signature), SCHNORR_SIGNATURE1);
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__verify_schnorr__bip340_vectors__true)
+{
+    BOOST_REQUIRE(verify_schnorr(base16_literal(SCHNORR_POINT0), null_hash,
+        base16_literal(SCHNORR_SIGNATURE0)));
+    BOOST_REQUIRE(verify_schnorr(base16_literal(SCHNORR_POINT1),
+        base16_literal(SCHNORR_MESSAGE1), base16_literal(SCHNORR_SIGNATURE1)));
+    BOOST_REQUIRE(verify_schnorr(base16_literal(SCHNORR_POINT4),
+        base16_literal(SCHNORR_MESSAGE4), base16_literal(SCHNORR_SIGNATURE4)));
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__verify_schnorr__bip340_invalid_vectors__false)
+{
+    const ec_xonly point = base16_literal(SCHNORR_POINT1);
+    const hash_digest message = base16_literal(SCHNORR_MESSAGE1);
+
+    // Vector 5, the point is not on the curve.
+    BOOST_REQUIRE(!verify_schnorr(base16_literal("eefdea4cdb677750a420fee807eacf21eb9898ae79b9768766e4faa04a2d4a34"), message,
+        base16_literal("6cff5c3ba86c69ea4b7376f31a9bcb4f74c1976089b2d9963da2e5543e17776969e89b4c5564d00349106b8497785dd7d1d713a8ae82b32fa79d5f7fc407d39b")));
+
+    // Vector 6, R has odd y.
+    BOOST_REQUIRE(!verify_schnorr(point, message,
+        base16_literal("fff97bd5755eeea420453a14355235d382f6472f8568a18b2f057a14602975563cc27944640ac607cd107ae10923d9ef7a73c643e166be5ebeafa34b1ac553e2")));
+
+    // Vector 7, the message is negated.
+    BOOST_REQUIRE(!verify_schnorr(point, message,
+        base16_literal("1fa62e331edbc21c394792d2ab1100a7b432b013df3f6ff4f99fcb33e0e1515f28890b3edb6e7189b630448b515ce4f8622a954cfe545735aaea5134fccdb2bd")));
+
+    // Vector 8, s is negated.
+    BOOST_REQUIRE(!verify_schnorr(point, message,
+        base16_literal("6cff5c3ba86c69ea4b7376f31a9bcb4f74c1976089b2d9963da2e5543e177769961764b3aa9b2ffcb6ef947b6887a226e8d7c93e00c5ed0c1834ff0d0c2e6da6")));
+
+    // Vector 12, the nonce is the field size.
+    BOOST_REQUIRE(!verify_schnorr(point, message,
+        base16_literal("fffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f69e89b4c5564d00349106b8497785dd7d1d713a8ae82b32fa79d5f7fc407d39b")));
+
+    // Vector 13, s is the curve order.
+    BOOST_REQUIRE(!verify_schnorr(point, message,
+        base16_literal("6cff5c3ba86c69ea4b7376f31a9bcb4f74c1976089b2d9963da2e5543e177769fffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364141")));
+}
+
+static std::vector<schnorr_check> schnorr_checks(size_t count)
+{
+    std::vector<schnorr_check> checks(count);
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        auto& check = checks[index];
+        const auto secret = sha256_hash(to_chunk(to_little_endian(index)));
+        check.message = bitcoin_hash(to_chunk(secret));
+
+        ec_compressed point;
+        BOOST_REQUIRE(secret_to_public(point, secret));
+        std::copy_n(point.begin() + 1, ec_xonly_size, check.point.begin());
+        BOOST_REQUIRE(sign_schnorr(check.signature, secret, check.message));
+    }
+
+    return checks;
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__verify_schnorr__empty_batch__true)
+{
+    BOOST_REQUIRE(verify_schnorr(nullptr, 0));
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__verify_schnorr__small_batch__expected)
+{
+    auto checks = schnorr_checks(4);
+    BOOST_REQUIRE(verify_schnorr(checks.data(), checks.size()));
+
+    checks[2].message[0] ^= 1;
+    BOOST_REQUIRE(!verify_schnorr(checks.data(), checks.size()));
+}
+
+// This is large enough to verify by multi-scalar multiplication.
+BOOST_AUTO_TEST_CASE(elliptic_curve__verify_schnorr__large_batch__expected)
+{
+    auto checks = schnorr_checks(128);
+    BOOST_REQUIRE(verify_schnorr(checks.data(), checks.size()));
+
+    std::swap(checks[3].signature, checks[100].signature);
+    BOOST_REQUIRE(!verify_schnorr(checks.data(), checks.size()));
+
+    std::swap(checks[3].signature, checks[100].signature);
+    checks.back().signature.back() ^= 1;
+    BOOST_REQUIRE(!verify_schnorr(checks.data(), checks.size()));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
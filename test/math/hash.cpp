@@ -58,6 +58,145 @@ BOOST_AUTO_TEST_CASE(sha256_hash_test)
     BOOST_REQUIRE_EQUAL(encode_base16(hash), "3a6eb0790f39ac87c94f3856b2dd2c5d110e6811602261a9a923d3bb23adc8b7");
 }
 
+BOOST_AUTO_TEST_CASE(sha256_hash_vectors_test)
+{
+    for (const auto& result: sha256_tests)
+    {
+        data_chunk data;
+        BOOST_REQUIRE(decode_base16(data, result.input));
+        BOOST_REQUIRE_EQUAL(encode_base16(sha256_hash(data)), result.result);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sha256_hash_batch__vectors__expected)
+{
+    std::vector<data_chunk> chunks(sha256_tests.size());
+    std::vector<data_slice> slices;
+
+    for (size_t index = 0; index < chunks.size(); ++index)
+    {
+        BOOST_REQUIRE(decode_base16(chunks[index], sha256_tests[index].input));
+        slices.emplace_back(chunks[index]);
+    }
+
+    hash_list hashes(slices.size());
+    sha256_hash_batch(slices.data(), slices.size(), hashes.data());
+
+    for (size_t index = 0; index < hashes.size(); ++index)
+        BOOST_REQUIRE_EQUAL(encode_base16(hashes[index]), sha256_tests[index].result);
+}
+
+BOOST_AUTO_TEST_CASE(sha256_hash_batch__mixed_lengths__sha256_hash)
+{
+    data_chunk data(300);
+    for (size_t index = 0; index < data.size(); ++index)
+        data[index] = static_cast<uint8_t>(index * 7);
+
+    // Lengths span empty, one and two padding blocks and multiple blocks.
+    std::vector<data_slice> slices;
+    for (size_t length = 0; length < data.size(); length += 3)
+        slices.emplace_back(data.data(), data.data() + length);
+
+    hash_list hashes(slices.size());
+    sha256_hash_batch(slices.data(), slices.size(), hashes.data());
+
+    for (size_t index = 0; index < hashes.size(); ++index)
+        BOOST_REQUIRE(hashes[index] == sha256_hash(slices[index]));
+}
+
+BOOST_AUTO_TEST_CASE(sha256_hash_batch__empty__no_output)
+{
+    hash_digest hash = null_hash;
+    sha256_hash_batch(nullptr, 0, &hash);
+    BOOST_REQUIRE(hash == null_hash);
+}
+
+BOOST_AUTO_TEST_CASE(bitcoin_hash_batch__mixed_lengths__bitcoin_hash)
+{
+    data_chunk data(100);
+    for (size_t index = 0; index < data.size(); ++index)
+        data[index] = static_cast<uint8_t>(index);
+
+    std::vector<data_slice> slices;
+    for (size_t length = 0; length < data.size(); ++length)
+        slices.emplace_back(data.data() + length, data.data() + data.size());
+
+    hash_list hashes(slices.size());
+    bitcoin_hash_batch(slices.data(), slices.size(), hashes.data());
+
+    for (size_t index = 0; index < hashes.size(); ++index)
+        BOOST_REQUIRE(hashes[index] == bitcoin_hash(slices[index]));
+}
+
+BOOST_AUTO_TEST_CASE(bitcoin_short_hash__compressed_point__ripemd160_of_sha256)
+{
+    const auto point = base16_literal("020641fde3a85beb8321033516de7ec01c35de96e945bf76c3768784a905471986");
+    const data_chunk data(point.begin(), point.end());
+    BOOST_REQUIRE(bitcoin_short_hash(point) == ripemd160_hash(sha256_hash(data)));
+    BOOST_REQUIRE(bitcoin_short_hash(point) == bitcoin_short_hash(data));
+}
+
+BOOST_AUTO_TEST_CASE(bitcoin_short_hash_batch__mixed_lengths__bitcoin_short_hash)
+{
+    data_chunk data(67);
+    for (size_t index = 0; index < data.size(); ++index)
+        data[index] = static_cast<uint8_t>(index * 3);
+
+    // The count is not a multiple of the lane count.
+    std::vector<data_slice> slices;
+    for (size_t length = 0; length < data.size(); ++length)
+        slices.emplace_back(data.data() + length, data.data() + data.size());
+
+    short_hash_list hashes(slices.size());
+    bitcoin_short_hash_batch(slices.data(), slices.size(), hashes.data());
+
+    for (size_t index = 0; index < hashes.size(); ++index)
+        BOOST_REQUIRE(hashes[index] == bitcoin_short_hash(slices[index]));
+}
+
+BOOST_AUTO_TEST_CASE(bitcoin_short_hash_batch__empty__no_output)
+{
+    short_hash hash = null_short_hash;
+    bitcoin_short_hash_batch(nullptr, 0, &hash);
+    BOOST_REQUIRE(hash == null_short_hash);
+}
+
+BOOST_AUTO_TEST_CASE(merkle_hash__two_hashes__bitcoin_hash_of_concatenation)
+{
+    const auto left = sha256_hash(to_chunk(to_little_endian<uint32_t>(1)));
+    const auto right = sha256_hash(to_chunk(to_little_endian<uint32_t>(2)));
+    const auto expected = bitcoin_hash(build_chunk({ left, right }));
+    BOOST_REQUIRE(merkle_hash(left, right) == expected);
+}
+
+BOOST_AUTO_TEST_CASE(merkle_hash_level__empty__empty)
+{
+    hash_list level;
+    merkle_hash_level(level);
+    BOOST_REQUIRE(level.empty());
+}
+
+BOOST_AUTO_TEST_CASE(merkle_hash_level__various_sizes__pairwise_merkle_hashes)
+{
+    for (uint32_t size = 1; size < 40; ++size)
+    {
+        hash_list level;
+        for (uint32_t index = 0; index < size; ++index)
+            level.push_back(sha256_hash(to_chunk(to_little_endian(index))));
+
+        hash_list expected;
+        for (size_t index = 0; index < level.size(); index += 2)
+        {
+            const auto& left = level[index];
+            const auto& right = index + 1 < level.size() ? level[index + 1] : left;
+            expected.push_back(bitcoin_hash(build_chunk({ left, right })));
+        }
+
+        merkle_hash_level(level);
+        BOOST_REQUIRE(level == expected);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(sha512_hash_test)
 {
     const data_chunk chunk{ 'd', 'a', 't', 'a' };
@@ -81,6 +220,32 @@ BOOST_AUTO_TEST_CASE(hmac_sha512_hash_test)
     BOOST_REQUIRE_EQUAL(encode_base16(long_hash), "3c5953a18f7303ec653ba170ae334fafa08e3846f2efe317b87efce82376253cb52a8c31ddcde5a3a2eee183c2b34cb91f85e64ddbc325f7692b199473579c58");
 }
 
+BOOST_AUTO_TEST_CASE(hmac_sha512_hash_batch__mixed_lengths__hmac_sha512_hash)
+{
+    data_chunk data(300);
+    for (size_t index = 0; index < data.size(); ++index)
+        data[index] = static_cast<uint8_t>(index * 5);
+
+    // Messages span one and two padding blocks and multiple blocks, keys
+    // span empty, a partial block and a hashed key. The count is not a
+    // multiple of the lane count.
+    std::vector<data_slice> messages;
+    std::vector<data_slice> keys;
+    for (size_t index = 0; index < 23; ++index)
+    {
+        messages.emplace_back(data.data(), data.data() + index * 13);
+        keys.emplace_back(data.data() + index, data.data() + index * 11);
+    }
+
+    long_hash_list hashes(messages.size());
+    hmac_sha512_hash_batch(messages.data(), keys.data(), messages.size(),
+        hashes.data());
+
+    for (size_t index = 0; index < hashes.size(); ++index)
+        BOOST_REQUIRE(hashes[index] ==
+            hmac_sha512_hash(messages[index], keys[index]));
+}
+
 BOOST_AUTO_TEST_CASE(pkcs5_pbkdf2_hmac_sha512_test)
 {
     for (const auto& result: pkcs5_pbkdf2_hmac_sha512_tests)
@@ -90,6 +255,80 @@ BOOST_AUTO_TEST_CASE(pkcs5_pbkdf2_hmac_sha512_test)
     }
 }
 
+BOOST_AUTO_TEST_CASE(pkcs5_pbkdf2_hmac_sha512_batch_test)
+{
+    // Ten derivations fill two sets of lanes and leave two to complete alone.
+    std::vector<data_chunk> passphrases;
+    std::vector<data_chunk> salts;
+
+    for (size_t round = 0; round < 2; ++round)
+    {
+        for (const auto& result: pkcs5_pbkdf2_hmac_sha512_tests)
+        {
+            passphrases.push_back(to_chunk(result.passphrase));
+            salts.push_back(to_chunk(result.salt));
+        }
+    }
+
+    const std::vector<data_slice> passphrase_slices(passphrases.begin(),
+        passphrases.end());
+    const std::vector<data_slice> salt_slices(salts.begin(), salts.end());
+
+    for (const auto& vector: pkcs5_pbkdf2_hmac_sha512_tests)
+    {
+        std::vector<long_hash> hashes(passphrases.size());
+        pkcs5_pbkdf2_hmac_sha512_batch(passphrase_slices.data(),
+            salt_slices.data(), hashes.size(), vector.iterations,
+            hashes.data());
+
+        for (size_t index = 0; index < hashes.size(); ++index)
+            BOOST_REQUIRE(hashes[index] == pkcs5_pbkdf2_hmac_sha512(
+                passphrases[index], salts[index], vector.iterations));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(scrypt_batch__budgets__matches_scrypt)
+{
+    std::vector<data_chunk> data;
+    std::vector<data_chunk> salts;
+
+    for (uint8_t index = 0; index < 5; ++index)
+    {
+        data.push_back(data_chunk(index, 0x2a));
+        salts.push_back(data_chunk(4, index));
+    }
+
+    const std::vector<data_slice> data_slices(data.begin(), data.end());
+    const std::vector<data_slice> salt_slices(salts.begin(), salts.end());
+    const auto lane = scrypt_scratch_size(1024, 2);
+    threadpool pool(3);
+
+    for (const auto budget: { size_t(0), lane, 4 * lane, 1000 * lane })
+    {
+        std::vector<data_chunk> hashes(data.size());
+        scrypt_batch(data_slices.data(), salt_slices.data(), hashes.size(),
+            1024, 3, 2, 40, hashes.data(), pool, budget);
+
+        for (size_t index = 0; index < hashes.size(); ++index)
+            BOOST_REQUIRE(hashes[index] == scrypt(data[index], salts[index],
+                1024, 3, 2, 40));
+    }
+
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(scrypt_batch__invalid_N__throws)
+{
+    const data_slice data(null_hash);
+    threadpool pool(1);
+    data_chunk hash;
+    BOOST_REQUIRE_THROW(scrypt_batch(&data, &data, 1, 1000, 1, 1, 32, &hash,
+        pool, 0), std::runtime_error);
+    pool.shutdown();
+    pool.join();
+}
+
 BOOST_AUTO_TEST_CASE(scrypt_hash_test)
 {
     for (const auto& result: scrypt_hash_tests)
@@ -100,4 +339,49 @@ BOOST_AUTO_TEST_CASE(scrypt_hash_test)
     }
 }
 
+BOOST_AUTO_TEST_CASE(scrypt_hash__non_header_size__matches_scrypt)
+{
+    const data_chunk data{ 'p', 'a', 's', 's', 'w', 'o', 'r', 'd' };
+    BOOST_REQUIRE(scrypt_hash(data) == scrypt<hash_size>(data, data, 1024, 1,
+        1));
+}
+
+BOOST_AUTO_TEST_CASE(scrypt_hash_batch__mixed_sizes__matches_scrypt_hash)
+{
+    // Exceeds two groups of the widest mix with a remainder and a short input.
+    std::vector<data_chunk> data;
+    for (const auto& result: scrypt_hash_tests)
+    {
+        data_chunk chunk;
+        BOOST_REQUIRE(decode_base16(chunk, result.input));
+        data.push_back(chunk);
+    }
+
+    for (size_t index = 0; data.size() < 21u; ++index)
+    {
+        auto chunk = data[index];
+        chunk[index % chunk.size()] ^= 0x5a;
+        data.push_back(chunk);
+    }
+
+    data[9] = data_chunk{ 42 };
+
+    std::vector<data_slice> slices(data.begin(), data.end());
+    hash_list hashes(data.size());
+    scrypt_hash_batch(slices.data(), slices.size(), hashes.data());
+
+    for (size_t index = 0; index < data.size(); ++index)
+        BOOST_REQUIRE(hashes[index] == scrypt<hash_size>(data[index],
+            data[index], 1024, 1, 1));
+
+    for (size_t index = 0; index < scrypt_hash_tests.size(); ++index)
+        BOOST_REQUIRE_EQUAL(encode_base16(hashes[index]),
+            scrypt_hash_tests[index].result);
+}
+
+BOOST_AUTO_TEST_CASE(scrypt_hash_lanes__always__positive)
+{
+    BOOST_REQUIRE_GT(scrypt_hash_lanes(), 0u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
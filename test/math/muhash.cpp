@@ -0,0 +1,106 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(muhash_tests)
+
+// A 32 byte element of which the first byte is the value.
+static data_chunk element(uint8_t value)
+{
+    data_chunk out(32, 0);
+    out.front() = value;
+    return out;
+}
+
+BOOST_AUTO_TEST_CASE(muhash__digest__empty__hash_of_one)
+{
+    data_chunk one(384, 0);
+    one.front() = 1;
+    BOOST_REQUIRE(muhash().digest() == sha256_hash(one));
+}
+
+// Test vector of the bitcoind muhash tests (displayed as uint256).
+BOOST_AUTO_TEST_CASE(muhash__digest__insert_insert_remove__expected)
+{
+    muhash set;
+    set.insert(element(0));
+    set.insert(element(1));
+    set.remove(element(2));
+    BOOST_REQUIRE_EQUAL(encode_hash(set.digest()),
+        "10d312b100cbd32ada024a6646e40d3482fcff103668d2625f10002a607d5863");
+}
+
+BOOST_AUTO_TEST_CASE(muhash__digest__insert_order__independent)
+{
+    muhash forward;
+    muhash reverse;
+
+    for (uint8_t value = 0; value < 8; ++value)
+    {
+        forward.insert(element(value));
+        reverse.insert(element(7 - value));
+    }
+
+    BOOST_REQUIRE(forward.digest() == reverse.digest());
+}
+
+BOOST_AUTO_TEST_CASE(muhash__remove__inserted__empty)
+{
+    muhash set;
+    set.remove(element(1));
+    set.insert(element(2));
+    set.insert(element(1));
+    set.remove(element(2));
+    BOOST_REQUIRE(set.digest() == muhash().digest());
+}
+
+BOOST_AUTO_TEST_CASE(muhash__remove__other__not_empty)
+{
+    muhash set;
+    set.insert(element(1));
+    set.remove(element(2));
+    BOOST_REQUIRE(set.digest() != muhash().digest());
+}
+
+BOOST_AUTO_TEST_CASE(muhash__multiply_divide__sets__expected)
+{
+    muhash left;
+    left.insert(element(1));
+    left.remove(element(3));
+
+    muhash right;
+    right.insert(element(2));
+    right.insert(element(3));
+
+    muhash expected;
+    expected.insert(element(1));
+    expected.insert(element(2));
+
+    auto combined = left;
+    combined *= right;
+    BOOST_REQUIRE(combined.digest() == expected.digest());
+
+    combined /= right;
+    BOOST_REQUIRE(combined.digest() == left.digest());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,64 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(murmur3_tests)
+
+// Reference vectors are those of the satoshi client.
+
+BOOST_AUTO_TEST_CASE(murmur3__empty__expected)
+{
+    BOOST_REQUIRE_EQUAL(murmur3(0x00000000, data_chunk{}), 0x00000000u);
+    BOOST_REQUIRE_EQUAL(murmur3(0xfba4c795, data_chunk{}), 0x6a396f08u);
+    BOOST_REQUIRE_EQUAL(murmur3(0xffffffff, data_chunk{}), 0x81f16f39u);
+}
+
+BOOST_AUTO_TEST_CASE(murmur3__partial_block__expected)
+{
+    BOOST_REQUIRE_EQUAL(murmur3(0x00000000, data_chunk{ 0x00 }), 0x514e28b7u);
+    BOOST_REQUIRE_EQUAL(murmur3(0xfba4c795, data_chunk{ 0x00 }), 0xea3f0b17u);
+    BOOST_REQUIRE_EQUAL(murmur3(0x00000000, data_chunk{ 0xff }), 0xfd6cf10du);
+    BOOST_REQUIRE_EQUAL(murmur3(0x00000000, base16_literal("0011")), 0x16c6b7abu);
+    BOOST_REQUIRE_EQUAL(murmur3(0x00000000, base16_literal("001122")), 0x8eb51c3du);
+}
+
+BOOST_AUTO_TEST_CASE(murmur3__blocks__expected)
+{
+    BOOST_REQUIRE_EQUAL(murmur3(0x00000000, base16_literal("00112233")), 0xb4471bf8u);
+    BOOST_REQUIRE_EQUAL(murmur3(0x00000000, base16_literal("0011223344")), 0xe2301fa8u);
+    BOOST_REQUIRE_EQUAL(murmur3(0x00000000, base16_literal("00112233445566")), 0xb074502cu);
+    BOOST_REQUIRE_EQUAL(murmur3(0x00000000, base16_literal("0011223344556677")), 0x8034d2a0u);
+    BOOST_REQUIRE_EQUAL(murmur3(0x00000000, base16_literal("001122334455667788")), 0xb4698defu);
+}
+
+BOOST_AUTO_TEST_CASE(murmur3__seeds__equals_each_seed)
+{
+    const uint32_t seeds[] = { 0x00000000, 0xfba4c795, 0xffffffff };
+    const auto data = base16_literal("001122334455667788");
+    uint32_t out[3];
+    murmur3(seeds, 3, data, out);
+    BOOST_REQUIRE_EQUAL(out[0], murmur3(seeds[0], data));
+    BOOST_REQUIRE_EQUAL(out[1], murmur3(seeds[1], data));
+    BOOST_REQUIRE_EQUAL(out[2], murmur3(seeds[2], data));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
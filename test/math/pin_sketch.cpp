@@ -0,0 +1,164 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+// Each test restores the default kernels, even on failure.
+struct pin_sketch_fixture
+{
+    ~pin_sketch_fixture()
+    {
+        set_cpu_features(all_features);
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(pin_sketch_tests, pin_sketch_fixture)
+
+// The distinct nonzero elements of a deterministic sequence.
+static pin_sketch::elements make_elements(size_t count, uint32_t seed)
+{
+    pin_sketch::elements out;
+
+    for (uint32_t index = 0; out.size() < count; ++index)
+        out.push_back((seed + index) * 0x9e3779b9u | 1u);
+
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+static pin_sketch make_sketch(size_t capacity,
+    const pin_sketch::elements& values)
+{
+    pin_sketch out(capacity);
+
+    for (const auto value: values)
+        out.add(value);
+
+    return out;
+}
+
+BOOST_AUTO_TEST_CASE(pin_sketch__to_data__single_element__odd_powers)
+{
+    const auto sketch = make_sketch(3, { 0x80000000 });
+    BOOST_REQUIRE_EQUAL(encode_base16(sketch.to_data()),
+        "00000080726d0420e842804e");
+}
+
+BOOST_AUTO_TEST_CASE(pin_sketch__to_data__portable__same_as_detected)
+{
+    const auto values = make_elements(10, 42);
+    const auto expected = make_sketch(20, values).to_data();
+    set_cpu_features(no_features);
+    BOOST_REQUIRE(make_sketch(20, values).to_data() == expected);
+}
+
+BOOST_AUTO_TEST_CASE(pin_sketch__from_data__round_trip__equal)
+{
+    const auto sketch = make_sketch(5, make_elements(3, 7));
+    pin_sketch copy(0);
+    BOOST_REQUIRE(copy.from_data(sketch.to_data()));
+    BOOST_REQUIRE_EQUAL(copy.capacity(), 5u);
+    BOOST_REQUIRE(copy == sketch);
+}
+
+BOOST_AUTO_TEST_CASE(pin_sketch__from_data__partial_element__false)
+{
+    pin_sketch sketch(0);
+    BOOST_REQUIRE(!sketch.from_data(data_chunk(7, 0x2a)));
+}
+
+BOOST_AUTO_TEST_CASE(pin_sketch__add__twice__empty)
+{
+    auto sketch = make_sketch(4, make_elements(3, 1));
+    for (const auto value: make_elements(3, 1))
+        sketch.add(value);
+
+    BOOST_REQUIRE(sketch == pin_sketch(4));
+}
+
+BOOST_AUTO_TEST_CASE(pin_sketch__add__zero__ignored)
+{
+    pin_sketch sketch(4);
+    sketch.add(0);
+    BOOST_REQUIRE(sketch == pin_sketch(4));
+}
+
+BOOST_AUTO_TEST_CASE(pin_sketch__decode__empty__success_empty)
+{
+    pin_sketch::elements out{ 42 };
+    BOOST_REQUIRE(pin_sketch(10).decode(out));
+    BOOST_REQUIRE(out.empty());
+}
+
+BOOST_AUTO_TEST_CASE(pin_sketch__decode__within_capacity__expected)
+{
+    for (size_t count = 1; count <= 30; ++count)
+    {
+        const auto values = make_elements(count, 1000 + count);
+        pin_sketch::elements out;
+        BOOST_REQUIRE(make_sketch(30, values).decode(out));
+        BOOST_REQUIRE(out == values);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(pin_sketch__decode__portable__expected)
+{
+    set_cpu_features(no_features);
+    const auto values = make_elements(50, 9);
+    pin_sketch::elements out;
+    BOOST_REQUIRE(make_sketch(64, values).decode(out));
+    BOOST_REQUIRE(out == values);
+}
+
+BOOST_AUTO_TEST_CASE(pin_sketch__decode__beyond_capacity__false)
+{
+    pin_sketch::elements out;
+    BOOST_REQUIRE(!make_sketch(20, make_elements(30, 5)).decode(out));
+    BOOST_REQUIRE(out.empty());
+}
+
+BOOST_AUTO_TEST_CASE(pin_sketch__operator_xor_equals__symmetric_difference__decodes)
+{
+    const auto common = make_elements(500, 3);
+    auto local = common;
+    auto remote = common;
+    local.push_back(11);
+    local.push_back(13);
+    remote.push_back(17);
+
+    auto sketch = make_sketch(8, local);
+    sketch ^= make_sketch(10, remote);
+    BOOST_REQUIRE_EQUAL(sketch.capacity(), 8u);
+
+    pin_sketch::elements out;
+    BOOST_REQUIRE(sketch.decode(out));
+    BOOST_REQUIRE(out == pin_sketch::elements({ 11, 13, 17 }));
+}
+
+BOOST_AUTO_TEST_CASE(pin_sketch__estimate_capacity__sizes__difference_plus_fraction)
+{
+    BOOST_REQUIRE_EQUAL(pin_sketch::estimate_capacity(100, 80, 0.25, 1000), 41u);
+    BOOST_REQUIRE_EQUAL(pin_sketch::estimate_capacity(80, 100, 0.25, 1000), 41u);
+    BOOST_REQUIRE_EQUAL(pin_sketch::estimate_capacity(0, 0, 0.25, 1000), 1u);
+    BOOST_REQUIRE_EQUAL(pin_sketch::estimate_capacity(5000, 0, 0.25, 1000), 1000u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
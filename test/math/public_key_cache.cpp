@@ -0,0 +1,133 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(public_key_cache_tests)
+
+#define COMPRESSED2 "03bc88a1bd6ebac38e9a9ed58eda735352ad10650e235499b7318315cc26c9b55b"
+#define SIGHASH2 "ed8f9b40c2d349c8a7e58cebe79faa25c21b6bb85b874901f72a1b3f1ad0a67f"
+#define SIGNATURE2 "3045022100bc494fbd09a8e77d8266e2abdea9aef08b9e71b451c7d8de9f63cda33a62437802206b93edd6af7c659db42c579eb34a3a4cb60c28b5a6bc86fd5266d42f6b8bb67d"
+
+static const ec_compressed point2 = base16_literal(COMPRESSED2);
+static const public_key_cache::parsed_key parsed2{ { 42 } };
+
+BOOST_AUTO_TEST_CASE(public_key_cache__construct__default__disabled)
+{
+    public_key_cache cache;
+    BOOST_REQUIRE(!cache.enabled());
+    BOOST_REQUIRE_EQUAL(cache.capacity(), 0u);
+    cache.insert(point2, parsed2);
+
+    public_key_cache::parsed_key parsed;
+    BOOST_REQUIRE(!cache.find(parsed, point2));
+    BOOST_REQUIRE_EQUAL(cache.size(), 0u);
+    BOOST_REQUIRE_EQUAL(cache.hits(), 0u);
+    BOOST_REQUIRE_EQUAL(cache.misses(), 0u);
+    BOOST_REQUIRE_EQUAL(cache.hit_rate(), 0.0f);
+}
+
+BOOST_AUTO_TEST_CASE(public_key_cache__find__inserted__hit)
+{
+    public_key_cache cache(10 * public_key_cache::entry_size);
+    BOOST_REQUIRE(cache.enabled());
+    BOOST_REQUIRE_EQUAL(cache.capacity(), 10u);
+
+    public_key_cache::parsed_key parsed;
+    BOOST_REQUIRE(!cache.find(parsed, point2));
+    cache.insert(point2, parsed2);
+    BOOST_REQUIRE(cache.find(parsed, point2));
+    BOOST_REQUIRE(parsed == parsed2);
+    BOOST_REQUIRE_EQUAL(cache.size(), 1u);
+    BOOST_REQUIRE_EQUAL(cache.hits(), 1u);
+    BOOST_REQUIRE_EQUAL(cache.misses(), 1u);
+    BOOST_REQUIRE_EQUAL(cache.hit_rate(), 0.5f);
+}
+
+BOOST_AUTO_TEST_CASE(public_key_cache__find__distinct_point__miss)
+{
+    public_key_cache cache(10 * public_key_cache::entry_size);
+    cache.insert(point2, parsed2);
+
+    auto point = point2;
+    point[1] ^= 1;
+
+    public_key_cache::parsed_key parsed;
+    BOOST_REQUIRE(!cache.find(parsed, point));
+    BOOST_REQUIRE(!cache.find(parsed, data_slice{ point2.data(), point2.data() + 32 }));
+    BOOST_REQUIRE_EQUAL(cache.misses(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(public_key_cache__insert__full__bounded)
+{
+    public_key_cache cache(16 * public_key_cache::entry_size);
+    public_key_cache::parsed_key parsed;
+
+    for (uint8_t index = 0; index < 64; ++index)
+    {
+        auto point = point2;
+        point[1] = index;
+        cache.insert(point, parsed2);
+        BOOST_REQUIRE(cache.find(parsed, point));
+        BOOST_REQUIRE(cache.size() <= cache.capacity());
+    }
+
+    BOOST_REQUIRE_EQUAL(cache.size(), 16u);
+}
+
+BOOST_AUTO_TEST_CASE(public_key_cache__resize__smaller__evicts)
+{
+    public_key_cache cache(16 * public_key_cache::entry_size);
+
+    for (uint8_t index = 0; index < 16; ++index)
+    {
+        auto point = point2;
+        point[1] = index;
+        cache.insert(point, parsed2);
+    }
+
+    BOOST_REQUIRE_EQUAL(cache.size(), 16u);
+    cache.resize(4 * public_key_cache::entry_size);
+    BOOST_REQUIRE_EQUAL(cache.size(), 4u);
+    cache.resize(0);
+    BOOST_REQUIRE(!cache.enabled());
+    BOOST_REQUIRE_EQUAL(cache.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(public_key_cache__parsed_keys__verify_signature__hit_on_reuse)
+{
+    ec_signature signature;
+    der_signature distinguished;
+    const hash_digest sighash = hash_literal(SIGHASH2);
+    BOOST_REQUIRE(decode_base16(distinguished, SIGNATURE2));
+    BOOST_REQUIRE(parse_signature(signature, distinguished, true));
+
+    auto& cache = public_key_cache::parsed_keys();
+    cache.resize(10 * public_key_cache::entry_size);
+    const auto hits = cache.hits();
+    const data_slice point(point2);
+    BOOST_REQUIRE(verify_signature(point, sighash, signature));
+    BOOST_REQUIRE(verify_signature(point, sighash, signature));
+    BOOST_REQUIRE_EQUAL(cache.hits(), hits + 1u);
+    cache.resize(0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
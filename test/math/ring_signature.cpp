@@ -120,6 +120,90 @@ BOOST_AUTO_TEST_CASE(ring_signature__verify__valid__round_trip)
     BOOST_REQUIRE(verify(valid_public_rings, valid_digest, signature));
 }
 
+BOOST_AUTO_TEST_CASE(ring_signature__verify__pool_valid__round_trip)
+{
+    threadpool pool(2);
+    ring_signature signature;
+    signature.proofs = valid_proofs;
+    BOOST_REQUIRE(sign(signature, valid_secrets, valid_public_rings, valid_digest, valid_salts));
+    BOOST_REQUIRE(verify(valid_public_rings, valid_digest, signature, pool));
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(ring_signature__verify__pool_modified_proof__false)
+{
+    threadpool pool(2);
+    ring_signature signature;
+    signature.proofs = valid_proofs;
+    BOOST_REQUIRE(sign(signature, valid_secrets, valid_public_rings, valid_digest, valid_salts));
+    signature.proofs[1][2][31] ^= 0x01;
+    BOOST_REQUIRE(!verify(valid_public_rings, valid_digest, signature, pool));
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(ring_signature__verify__batch_mixed__expected)
+{
+    threadpool pool(2);
+    ring_signature signature;
+    signature.proofs = valid_proofs;
+    BOOST_REQUIRE(sign(signature, valid_secrets, valid_public_rings, valid_digest, valid_salts));
+
+    // Enough signatures to verify with key tables.
+    std::vector<ring_signature> signatures(10, signature);
+    signatures[3].proofs[0][1][31] ^= 0x01;
+    signatures[7].proofs.pop_back();
+    hash_list digests(signatures.size(), valid_digest);
+    digests[5][0] ^= 0x01;
+
+    const auto result = verify(valid_public_rings, digests, signatures, pool);
+    BOOST_REQUIRE_EQUAL(result.size(), signatures.size());
+
+    for (size_t index = 0; index < result.size(); ++index)
+        BOOST_REQUIRE_EQUAL(result[index], index != 3 && index != 5 && index != 7);
+
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(ring_signature__verify__batch_small__expected)
+{
+    threadpool pool(2);
+    ring_signature signature;
+    signature.proofs = valid_proofs;
+    BOOST_REQUIRE(sign(signature, valid_secrets, valid_public_rings, valid_digest, valid_salts));
+
+    std::vector<ring_signature> signatures(2, signature);
+    signatures[1].proofs[2][0][31] ^= 0x01;
+    const hash_list digests(signatures.size(), valid_digest);
+
+    const auto result = verify(valid_public_rings, digests, signatures, pool);
+    BOOST_REQUIRE_EQUAL(result.size(), 2u);
+    BOOST_REQUIRE(result[0]);
+    BOOST_REQUIRE(!result[1]);
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(ring_signature__verify__batch_mismatched_digests__all_false)
+{
+    threadpool pool(2);
+    ring_signature signature;
+    signature.proofs = valid_proofs;
+    BOOST_REQUIRE(sign(signature, valid_secrets, valid_public_rings, valid_digest, valid_salts));
+
+    const std::vector<ring_signature> signatures(2, signature);
+    const hash_list digests(1, valid_digest);
+
+    const auto result = verify(valid_public_rings, digests, signatures, pool);
+    BOOST_REQUIRE_EQUAL(result.size(), 2u);
+    BOOST_REQUIRE(!result[0]);
+    BOOST_REQUIRE(!result[1]);
+    pool.shutdown();
+    pool.join();
+}
+
 const hash_digest negative_digest
 {
     0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xff,
@@ -0,0 +1,85 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <unordered_set>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(salted_hash_tests)
+
+BOOST_AUTO_TEST_CASE(salted_hash__hash_salt__always__stable)
+{
+    const auto& salt = hash_salt();
+    BOOST_REQUIRE(&salt == &hash_salt());
+    BOOST_REQUIRE(salt.first != 0 || salt.second != 0);
+}
+
+BOOST_AUTO_TEST_CASE(salted_hash__hash_digest__always__siphash13_of_salt)
+{
+    const auto hash = bitcoin_hash(to_chunk(std::string("salted")));
+    BOOST_REQUIRE_EQUAL(salted_hash<hash_digest>()(hash),
+        static_cast<size_t>(siphash13(hash_salt(), hash)));
+}
+
+BOOST_AUTO_TEST_CASE(salted_hash__short_hash__always__siphash13_of_salt)
+{
+    const auto hash = bitcoin_short_hash(to_chunk(std::string("salted")));
+    BOOST_REQUIRE_EQUAL(salted_hash<short_hash>()(hash),
+        static_cast<size_t>(siphash13(hash_salt(), hash)));
+}
+
+BOOST_AUTO_TEST_CASE(salted_hash__points__index__distinct)
+{
+    const auto hash = bitcoin_hash(to_chunk(std::string("point")));
+    const chain::point first{ hash, 0 };
+    const chain::output_point second{ hash, 1 };
+    const salted_hash<chain::point> hasher;
+    BOOST_REQUIRE_EQUAL(hasher(first),
+        static_cast<size_t>(siphash13(hash_salt(), hash, 0)));
+    BOOST_REQUIRE_EQUAL(salted_hash<chain::output_point>()(second),
+        static_cast<size_t>(siphash13(hash_salt(), hash, 1)));
+    BOOST_REQUIRE(hasher(first) != hasher(second));
+}
+
+BOOST_AUTO_TEST_CASE(salted_hash__unordered_set__output_points__found)
+{
+    std::unordered_set<chain::output_point, salted_hash<chain::output_point>>
+        points;
+
+    const auto hash = bitcoin_hash(to_chunk(std::string("points")));
+
+    for (uint32_t index = 0; index < 100; ++index)
+        points.insert({ hash, index });
+
+    BOOST_REQUIRE_EQUAL(points.size(), 100u);
+    BOOST_REQUIRE(points.find({ hash, 42 }) != points.end());
+    BOOST_REQUIRE(points.find({ null_hash, 42 }) == points.end());
+}
+
+BOOST_AUTO_TEST_CASE(salted_hash__payment_address__always__short_hash)
+{
+    const auto hash = bitcoin_short_hash(to_chunk(std::string("address")));
+    const wallet::payment_address address(hash);
+    BOOST_REQUIRE_EQUAL(salted_hash<wallet::payment_address>()(address),
+        salted_hash<short_hash>()(hash));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
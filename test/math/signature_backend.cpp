@@ -0,0 +1,135 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(signature_backend_tests)
+
+#define COMPRESSED2 "03bc88a1bd6ebac38e9a9ed58eda735352ad10650e235499b7318315cc26c9b55b"
+#define SIGHASH2 "ed8f9b40c2d349c8a7e58cebe79faa25c21b6bb85b874901f72a1b3f1ad0a67f"
+#define SIGNATURE2 "3045022100bc494fbd09a8e77d8266e2abdea9aef08b9e71b451c7d8de9f63cda33a62437802206b93edd6af7c659db42c579eb34a3a4cb60c28b5a6bc86fd5266d42f6b8bb67d"
+
+static ec_signature get_signature2()
+{
+    ec_signature signature;
+    der_signature distinguished;
+    BOOST_REQUIRE(decode_base16(distinguished, SIGNATURE2));
+    BOOST_REQUIRE(parse_signature(signature, distinguished, false));
+    return signature;
+}
+
+// Records each submission and returns a configured result.
+class test_backend
+  : public signature_backend
+{
+public:
+    test_backend(size_t minimum, bool result)
+      : minimum_(minimum), result_(result), batches(0), checks(0)
+    {
+    }
+
+    std::string name() const override
+    {
+        return "test";
+    }
+
+    size_t minimum_batch() const override
+    {
+        return minimum_;
+    }
+
+    void submit(const ecdsa_checks& ecdsa, const schnorr_checks& schnorr,
+        result_handler handler) override
+    {
+        ++batches;
+        checks += ecdsa.size() + schnorr.size();
+        point = ecdsa.empty() ? data_chunk{} : ecdsa.front().point;
+        handler(result_);
+    }
+
+    const size_t minimum_;
+    const bool result_;
+    size_t batches;
+    size_t checks;
+    data_chunk point;
+};
+
+BOOST_AUTO_TEST_CASE(signature_backend__get_signature_backend__default__cpu)
+{
+    const auto backend = get_signature_backend();
+    BOOST_REQUIRE(backend);
+    BOOST_REQUIRE_EQUAL(backend->name(), "cpu");
+    BOOST_REQUIRE_EQUAL(backend->minimum_batch(), max_size_t);
+}
+
+BOOST_AUTO_TEST_CASE(signature_backend__cpu_submit__valid_and_invalid__expected)
+{
+    const ec_compressed point = base16_literal(COMPRESSED2);
+    signature_backend::ecdsa_checks checks
+    {
+        { to_chunk(point), hash_literal(SIGHASH2), get_signature2() }
+    };
+
+    cpu_signature_backend backend;
+    auto valid = false;
+    backend.submit(checks, {}, [&](bool result) { valid = result; });
+    BOOST_REQUIRE(valid);
+
+    checks.front().signature[10] = 110;
+    backend.submit(checks, {}, [&](bool result) { valid = result; });
+    BOOST_REQUIRE(!valid);
+}
+
+BOOST_AUTO_TEST_CASE(signature_backend__set_signature_backend__minimum_batch__dispatched)
+{
+    threadpool pool(2);
+    const ec_compressed point = base16_literal(COMPRESSED2);
+    const auto backend = std::make_shared<test_backend>(2, false);
+    set_signature_backend(backend);
+    BOOST_REQUIRE_EQUAL(get_signature_backend()->name(), "test");
+
+    // Smaller batches fall back to the cpu.
+    signature_batch batch;
+    BOOST_REQUIRE(batch.add(point, hash_literal(SIGHASH2), get_signature2()));
+    BOOST_REQUIRE(batch.verify());
+    BOOST_REQUIRE(batch.verify(pool));
+    BOOST_REQUIRE_EQUAL(backend->batches, 0u);
+
+    // The backend result is that of the batch, as submitted.
+    BOOST_REQUIRE(batch.add(point, hash_literal(SIGHASH2), get_signature2()));
+    BOOST_REQUIRE(!batch.verify());
+    BOOST_REQUIRE(!batch.verify(pool));
+    BOOST_REQUIRE_EQUAL(backend->batches, 2u);
+    BOOST_REQUIRE_EQUAL(backend->checks, 4u);
+    BOOST_REQUIRE(backend->point == to_chunk(point));
+
+    set_signature_backend(nullptr);
+    BOOST_REQUIRE_EQUAL(get_signature_backend()->name(), "cpu");
+    BOOST_REQUIRE(batch.verify());
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,179 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(signature_batch_tests)
+
+#define SECRET1 "8010b1bb119ad37d4b65a1022a314897b1b3614b345974332cb1b9582cf03536"
+#define COMPRESSED2 "03bc88a1bd6ebac38e9a9ed58eda735352ad10650e235499b7318315cc26c9b55b"
+#define SIGHASH2 "ed8f9b40c2d349c8a7e58cebe79faa25c21b6bb85b874901f72a1b3f1ad0a67f"
+#define SIGNATURE2 "3045022100bc494fbd09a8e77d8266e2abdea9aef08b9e71b451c7d8de9f63cda33a62437802206b93edd6af7c659db42c579eb34a3a4cb60c28b5a6bc86fd5266d42f6b8bb67d"
+#define SCHNORR_POINT1 "dff1d77f2a671c5f36183726db2341be58feae1da2deced843240f7b502ba659"
+#define SCHNORR_MESSAGE1 "243f6a8885a308d313198a2e03707344a4093822299f31d0082efa98ec4e6c89"
+#define SCHNORR_SIGNATURE1 "6896bd60eeae296db48a229ff71dfe071bde413e6d43f917dc8dcf8c78de33418906d11ac976abccb20b091292bff4ea897efcb639ea871cfa95f6de339e4b0a"
+
+static ec_signature get_signature2()
+{
+    ec_signature signature;
+    der_signature distinguished;
+    BOOST_REQUIRE(decode_base16(distinguished, SIGNATURE2));
+    BOOST_REQUIRE(parse_signature(signature, distinguished, false));
+    return signature;
+}
+
+BOOST_AUTO_TEST_CASE(signature_batch__verify__empty__true)
+{
+    threadpool pool(2);
+    signature_batch batch;
+    BOOST_REQUIRE(batch.empty());
+    BOOST_REQUIRE(batch.verify());
+    BOOST_REQUIRE(batch.verify(pool));
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(signature_batch__add__invalid_point__false)
+{
+    signature_batch batch;
+    const ec_compressed point = null_compressed_point;
+    BOOST_REQUIRE(!batch.add(point, hash_literal(SIGHASH2), get_signature2()));
+    BOOST_REQUIRE(batch.empty());
+    BOOST_REQUIRE(!batch.verify());
+}
+
+BOOST_AUTO_TEST_CASE(signature_batch__verify__valid__true)
+{
+    signature_batch batch;
+    const ec_compressed point = base16_literal(COMPRESSED2);
+    BOOST_REQUIRE(batch.add(point, hash_literal(SIGHASH2), get_signature2()));
+    BOOST_REQUIRE_EQUAL(batch.size(), 1u);
+    BOOST_REQUIRE(batch.verify());
+}
+
+BOOST_AUTO_TEST_CASE(signature_batch__verify__pool_valid__true)
+{
+    threadpool pool(4);
+    signature_batch batch;
+    const ec_secret secret = hash_literal(SECRET1);
+    ec_compressed compressed;
+    ec_uncompressed uncompressed;
+    BOOST_REQUIRE(secret_to_public(compressed, secret));
+    BOOST_REQUIRE(secret_to_public(uncompressed, secret));
+
+    for (uint8_t index = 0; index < 16; ++index)
+    {
+        ec_signature signature;
+        const auto hash = bitcoin_hash(data_chunk{ index });
+        BOOST_REQUIRE(sign(signature, secret, hash));
+        BOOST_REQUIRE(batch.add(compressed, hash, signature));
+        BOOST_REQUIRE(batch.add(uncompressed, hash, signature));
+    }
+
+    BOOST_REQUIRE_EQUAL(batch.size(), 32u);
+    BOOST_REQUIRE(batch.verify(pool));
+    BOOST_REQUIRE(batch.verify());
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(signature_batch__verify__pool_one_invalid__false)
+{
+    threadpool pool(4);
+    signature_batch batch;
+    const ec_compressed point = base16_literal(COMPRESSED2);
+    const hash_digest sighash = hash_literal(SIGHASH2);
+    auto signature = get_signature2();
+
+    for (size_t index = 0; index < 8; ++index)
+        BOOST_REQUIRE(batch.add(point, sighash, signature));
+
+    // Invalidate one of the checks.
+    signature[10] = 110;
+    BOOST_REQUIRE(batch.add(point, sighash, signature));
+    BOOST_REQUIRE(!batch.verify(pool));
+    BOOST_REQUIRE(!batch.verify());
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(signature_batch__clear__invalid__valid_empty)
+{
+    signature_batch batch;
+    const ec_compressed point = base16_literal(COMPRESSED2);
+    BOOST_REQUIRE(batch.add(point, hash_literal(SIGHASH2), get_signature2()));
+    BOOST_REQUIRE(!batch.add(null_compressed_point, hash_literal(SIGHASH2), get_signature2()));
+    BOOST_REQUIRE(!batch.verify());
+    batch.clear();
+    BOOST_REQUIRE(batch.empty());
+    BOOST_REQUIRE(batch.verify());
+}
+
+BOOST_AUTO_TEST_CASE(signature_batch__add_schnorr__valid__true)
+{
+    threadpool pool(2);
+    signature_batch batch;
+    batch.add_schnorr(base16_literal(SCHNORR_POINT1),
+        base16_literal(SCHNORR_MESSAGE1), base16_literal(SCHNORR_SIGNATURE1));
+    BOOST_REQUIRE_EQUAL(batch.size(), 1u);
+    BOOST_REQUIRE(batch.verify());
+    BOOST_REQUIRE(batch.verify(pool));
+    pool.shutdown();
+    pool.join();
+}
+
+// This is large enough to be verified in chunks over the pool.
+BOOST_AUTO_TEST_CASE(signature_batch__verify__pool_schnorr_one_invalid__false)
+{
+    threadpool pool(4);
+    signature_batch batch;
+    const ec_compressed point = base16_literal(COMPRESSED2);
+    BOOST_REQUIRE(batch.add(point, hash_literal(SIGHASH2), get_signature2()));
+
+    for (size_t index = 0; index < 600; ++index)
+    {
+        ec_compressed public_key;
+        schnorr_signature signature;
+        const auto secret = sha256_hash(to_chunk(to_little_endian(index)));
+        const auto message = bitcoin_hash(to_chunk(secret));
+        BOOST_REQUIRE(secret_to_public(public_key, secret));
+        BOOST_REQUIRE(sign_schnorr(signature, secret, message));
+
+        ec_xonly xonly;
+        std::copy_n(public_key.begin() + 1, ec_xonly_size, xonly.begin());
+        batch.add_schnorr(xonly, message, signature);
+    }
+
+    BOOST_REQUIRE_EQUAL(batch.size(), 601u);
+    BOOST_REQUIRE(batch.verify(pool));
+
+    // Invalidate one of the checks.
+    auto signature = base16_literal(SCHNORR_SIGNATURE1);
+    signature[40] ^= 1;
+    batch.add_schnorr(base16_literal(SCHNORR_POINT1),
+        base16_literal(SCHNORR_MESSAGE1), signature);
+    BOOST_REQUIRE(!batch.verify(pool));
+    BOOST_REQUIRE(!batch.verify());
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,173 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(signature_cache_tests)
+
+#define COMPRESSED2 "03bc88a1bd6ebac38e9a9ed58eda735352ad10650e235499b7318315cc26c9b55b"
+#define SIGHASH2 "ed8f9b40c2d349c8a7e58cebe79faa25c21b6bb85b874901f72a1b3f1ad0a67f"
+
+static const ec_compressed point2 = base16_literal(COMPRESSED2);
+static const hash_digest sighash2 = hash_literal(SIGHASH2);
+static const ec_signature signature2{ { 42 } };
+
+BOOST_AUTO_TEST_CASE(signature_cache__construct__default__disabled)
+{
+    signature_cache cache;
+    BOOST_REQUIRE(!cache.enabled());
+    BOOST_REQUIRE_EQUAL(cache.capacity(), 0u);
+    cache.insert(sighash2, point2, signature2);
+    BOOST_REQUIRE(!cache.contains(sighash2, point2, signature2));
+    BOOST_REQUIRE_EQUAL(cache.size(), 0u);
+    BOOST_REQUIRE_EQUAL(cache.hits(), 0u);
+    BOOST_REQUIRE_EQUAL(cache.misses(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__contains__inserted__hit)
+{
+    signature_cache cache(10 * signature_cache::entry_size);
+    BOOST_REQUIRE(cache.enabled());
+    BOOST_REQUIRE_EQUAL(cache.capacity(), 10u);
+    BOOST_REQUIRE(!cache.contains(sighash2, point2, signature2));
+    cache.insert(sighash2, point2, signature2);
+    BOOST_REQUIRE(cache.contains(sighash2, point2, signature2));
+    BOOST_REQUIRE_EQUAL(cache.size(), 1u);
+    BOOST_REQUIRE_EQUAL(cache.hits(), 1u);
+    BOOST_REQUIRE_EQUAL(cache.misses(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__contains__distinct_element__miss)
+{
+    signature_cache cache(10 * signature_cache::entry_size);
+    cache.insert(sighash2, point2, signature2);
+
+    auto sighash = sighash2;
+    sighash[0] ^= 1;
+    auto point = point2;
+    point[1] ^= 1;
+    auto signature = signature2;
+    signature[0] ^= 1;
+
+    BOOST_REQUIRE(!cache.contains(sighash, point2, signature2));
+    BOOST_REQUIRE(!cache.contains(sighash2, point, signature2));
+    BOOST_REQUIRE(!cache.contains(sighash2, point2, signature));
+    BOOST_REQUIRE_EQUAL(cache.misses(), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__insert__full__bounded)
+{
+    signature_cache cache(16 * signature_cache::entry_size);
+
+    for (uint8_t index = 0; index < 64; ++index)
+    {
+        auto sighash = sighash2;
+        sighash[0] = index;
+        cache.insert(sighash, point2, signature2);
+        BOOST_REQUIRE(cache.contains(sighash, point2, signature2));
+        BOOST_REQUIRE(cache.size() <= cache.capacity());
+    }
+
+    BOOST_REQUIRE_EQUAL(cache.size(), 16u);
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__insert__full__evictions_counted)
+{
+    signature_cache cache(16 * signature_cache::entry_size);
+
+    for (uint8_t index = 0; index < 64; ++index)
+    {
+        auto sighash = sighash2;
+        sighash[0] = index;
+        cache.insert(sighash, point2, signature2);
+    }
+
+    BOOST_REQUIRE_EQUAL(cache.evictions(), 48u);
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__resize__smaller__evicts)
+{
+    signature_cache cache(16 * signature_cache::entry_size);
+
+    for (uint8_t index = 0; index < 16; ++index)
+    {
+        auto sighash = sighash2;
+        sighash[0] = index;
+        cache.insert(sighash, point2, signature2);
+    }
+
+    BOOST_REQUIRE_EQUAL(cache.size(), 16u);
+    cache.resize(4 * signature_cache::entry_size);
+    BOOST_REQUIRE_EQUAL(cache.size(), 4u);
+    cache.resize(0);
+    BOOST_REQUIRE(!cache.enabled());
+    BOOST_REQUIRE_EQUAL(cache.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__clear__inserted__empty)
+{
+    signature_cache cache(10 * signature_cache::entry_size);
+    cache.insert(sighash2, point2, signature2);
+    cache.clear();
+    BOOST_REQUIRE_EQUAL(cache.size(), 0u);
+    BOOST_REQUIRE(!cache.contains(sighash2, point2, signature2));
+    BOOST_REQUIRE(cache.enabled());
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__store__no_secret__false)
+{
+    const auto path = boost::filesystem::temp_directory_path() /
+        boost::filesystem::unique_path("signature_cache-%%%%-%%%%.dat");
+
+    signature_cache cache(10 * signature_cache::entry_size);
+    cache.insert(sighash2, point2, signature2);
+    BOOST_REQUIRE(!cache.store(path));
+    BOOST_REQUIRE(!boost::filesystem::exists(path));
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__load__stored_under_secret__hit)
+{
+    static const auto secret = hash_literal(SIGHASH2);
+    const auto path = boost::filesystem::temp_directory_path() /
+        boost::filesystem::unique_path("signature_cache-%%%%-%%%%.dat");
+
+    signature_cache cache(10 * signature_cache::entry_size);
+    cache.set_secret(secret);
+    cache.insert(sighash2, point2, signature2);
+    BOOST_REQUIRE(cache.store(path));
+
+    threadpool pool(2);
+    signature_cache restarted(10 * signature_cache::entry_size);
+    BOOST_REQUIRE_EQUAL(restarted.load(path, pool, asio::seconds(60)), 0u);
+    restarted.set_secret(secret);
+    BOOST_REQUIRE_EQUAL(restarted.load(path, pool, asio::seconds(60)), 1u);
+    BOOST_REQUIRE(restarted.contains(sighash2, point2, signature2));
+
+    signature_cache other(10 * signature_cache::entry_size);
+    other.set_secret(null_hash);
+    BOOST_REQUIRE_EQUAL(other.load(path, pool, asio::seconds(60)), 0u);
+
+    pool.shutdown();
+    pool.join();
+    boost::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,133 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(siphash_tests)
+
+// Reference vectors are keyed by the bytes 0x00..0x0f.
+static const siphash_key key{ 0x0706050403020100, 0x0f0e0d0c0b0a0908 };
+
+static data_chunk sequence(size_t size)
+{
+    data_chunk out(size);
+
+    for (size_t byte = 0; byte < size; ++byte)
+        out[byte] = static_cast<uint8_t>(byte);
+
+    return out;
+}
+
+BOOST_AUTO_TEST_CASE(siphash__slice__empty__expected)
+{
+    BOOST_REQUIRE_EQUAL(siphash(key, data_chunk{}), 0x726fdb47dd0e0e31u);
+}
+
+BOOST_AUTO_TEST_CASE(siphash__slice__one_byte__expected)
+{
+    BOOST_REQUIRE_EQUAL(siphash(key, sequence(1)), 0x74f839c593dc67fdu);
+}
+
+BOOST_AUTO_TEST_CASE(siphash__slice__one_word__expected)
+{
+    BOOST_REQUIRE_EQUAL(siphash(key, sequence(8)), 0x93f5f5799a932462u);
+}
+
+BOOST_AUTO_TEST_CASE(siphash__slice__fifteen_bytes__expected)
+{
+    BOOST_REQUIRE_EQUAL(siphash(key, sequence(15)), 0xa129ca6149be45e5u);
+}
+
+BOOST_AUTO_TEST_CASE(siphash__hash__sequence__expected)
+{
+    hash_digest hash;
+    const auto data = sequence(hash_size);
+    std::copy(data.begin(), data.end(), hash.begin());
+    BOOST_REQUIRE_EQUAL(siphash(key, hash), 0x7127512f72f27cceu);
+}
+
+BOOST_AUTO_TEST_CASE(siphash__hash__arbitrary__equals_slice)
+{
+    const auto hash = bitcoin_hash(to_chunk(std::string("siphash")));
+    BOOST_REQUIRE_EQUAL(siphash(key, hash), siphash(key, data_slice(hash)));
+}
+
+BOOST_AUTO_TEST_CASE(siphash13__slice__empty__expected)
+{
+    BOOST_REQUIRE_EQUAL(siphash13(key, data_chunk{}), 0xabac0158050fc4dcu);
+}
+
+BOOST_AUTO_TEST_CASE(siphash13__slice__one_byte__expected)
+{
+    BOOST_REQUIRE_EQUAL(siphash13(key, sequence(1)), 0xc9f49bf37d57ca93u);
+}
+
+BOOST_AUTO_TEST_CASE(siphash13__slice__fifteen_bytes__expected)
+{
+    BOOST_REQUIRE_EQUAL(siphash13(key, sequence(15)), 0xd320d86d2a519956u);
+}
+
+BOOST_AUTO_TEST_CASE(siphash13__hash__sequence__expected)
+{
+    hash_digest hash;
+    const auto data = sequence(hash_size);
+    std::copy(data.begin(), data.end(), hash.begin());
+    BOOST_REQUIRE_EQUAL(siphash13(key, hash), 0x81157b6c16a7b60du);
+    BOOST_REQUIRE_EQUAL(siphash13(key, hash), siphash13(key, data));
+}
+
+BOOST_AUTO_TEST_CASE(siphash13__hash_index__sequence__equals_slice)
+{
+    hash_digest hash;
+    auto data = sequence(hash_size);
+    std::copy(data.begin(), data.end(), hash.begin());
+    extend_data(data, to_little_endian(uint32_t(0x01020304)));
+    BOOST_REQUIRE_EQUAL(siphash13(key, hash, 0x01020304), 0x118892e8c7210810u);
+    BOOST_REQUIRE_EQUAL(siphash13(key, hash, 0x01020304),
+        siphash13(key, data));
+}
+
+BOOST_AUTO_TEST_CASE(siphash__to_siphash_key__sequence__little_endian_words)
+{
+    hash_digest hash;
+    const auto data = sequence(hash_size);
+    std::copy(data.begin(), data.end(), hash.begin());
+    const auto result = to_siphash_key(hash);
+    BOOST_REQUIRE_EQUAL(result.first, key.first);
+    BOOST_REQUIRE_EQUAL(result.second, key.second);
+}
+
+BOOST_AUTO_TEST_CASE(siphash__hash_list__batch_and_remainder__equals_each)
+{
+    hash_list hashes;
+    for (uint8_t value = 0; value < 7; ++value)
+        hashes.push_back(sha256_hash(data_chunk{ value }));
+
+    const auto result = siphash(key, hashes);
+    BOOST_REQUIRE_EQUAL(result.size(), hashes.size());
+
+    for (size_t index = 0; index < hashes.size(); ++index)
+        BOOST_REQUIRE_EQUAL(result[index], siphash(key, hashes[index]));
+
+    BOOST_REQUIRE(siphash(key, hash_list{}).empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
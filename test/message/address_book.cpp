@@ -0,0 +1,138 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::message;
+
+BOOST_AUTO_TEST_SUITE(address_book_tests)
+
+// Test helpers.
+static network_address get_address(uint8_t group, uint8_t host,
+    uint16_t port, uint32_t timestamp=1)
+{
+    const ip_address ip
+    {
+        {
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0xff, 0xff, 10, group, 0x00, host
+        }
+    };
+
+    return { timestamp, 1, ip, port };
+}
+
+BOOST_AUTO_TEST_CASE(address_book__construct__empty)
+{
+    const address_book instance(4, 8);
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 32u);
+
+    network_address out;
+    BOOST_REQUIRE(!instance.sample(out));
+}
+
+BOOST_AUTO_TEST_CASE(address_book__insert__new__found)
+{
+    address_book instance;
+    const auto value = get_address(1, 2, 8333);
+    BOOST_REQUIRE(instance.insert(value));
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    BOOST_REQUIRE(instance.contains(value.ip(), 8333));
+    BOOST_REQUIRE(!instance.contains(value.ip(), 8334));
+    BOOST_REQUIRE(*instance.find(value.ip(), 8333) == value);
+}
+
+BOOST_AUTO_TEST_CASE(address_book__insert__unspecified_port__false)
+{
+    address_book instance;
+    BOOST_REQUIRE(!instance.insert(get_address(1, 2, 0)));
+    BOOST_REQUIRE(instance.empty());
+}
+
+BOOST_AUTO_TEST_CASE(address_book__insert__existing__updated_not_counted)
+{
+    address_book instance;
+    BOOST_REQUIRE(instance.insert(get_address(1, 2, 8333, 10)));
+    BOOST_REQUIRE(!instance.insert(get_address(1, 2, 8333, 5)));
+    BOOST_REQUIRE_EQUAL(instance.find(get_address(1, 2, 8333).ip(), 8333)->timestamp(), 10u);
+    BOOST_REQUIRE(!instance.insert(get_address(1, 2, 8333, 20)));
+    BOOST_REQUIRE_EQUAL(instance.find(get_address(1, 2, 8333).ip(), 8333)->timestamp(), 20u);
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(address_book__insert__one_group__bounded_by_bucket)
+{
+    address_book instance(16, 4);
+    for (uint8_t host = 0; host < 100; ++host)
+        instance.insert(get_address(7, host, 8333));
+
+    // All addresses of a network group share one bucket.
+    BOOST_REQUIRE_LE(instance.size(), 4u);
+}
+
+BOOST_AUTO_TEST_CASE(address_book__insert__address_message__single_pass_count)
+{
+    address_book instance;
+    const address message(
+    {
+        get_address(1, 1, 8333),
+        get_address(2, 1, 8333),
+        get_address(1, 1, 8333)
+    });
+
+    BOOST_REQUIRE_EQUAL(instance.insert(message), 2u);
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(address_book__erase__stored__removed)
+{
+    address_book instance;
+    const auto value = get_address(1, 2, 8333);
+    BOOST_REQUIRE(instance.insert(value));
+    BOOST_REQUIRE(!instance.erase(value.ip(), 8334));
+    BOOST_REQUIRE(instance.erase(value.ip(), 8333));
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE(!instance.contains(value.ip(), 8333));
+}
+
+BOOST_AUTO_TEST_CASE(address_book__sample__stored__returns_stored)
+{
+    address_book instance;
+    const auto value = get_address(1, 2, 8333);
+    BOOST_REQUIRE(instance.insert(value));
+
+    network_address out;
+    BOOST_REQUIRE(instance.sample(out));
+    BOOST_REQUIRE(out == value);
+}
+
+BOOST_AUTO_TEST_CASE(address_book__clear__stored__empty)
+{
+    address_book instance;
+    BOOST_REQUIRE(instance.insert(get_address(1, 2, 8333)));
+    instance.clear();
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE(!instance.contains(get_address(1, 2, 8333).ip(), 8333));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
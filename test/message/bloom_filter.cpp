@@ -0,0 +1,109 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::message;
+
+BOOST_AUTO_TEST_SUITE(bloom_filter_tests)
+
+static chain::transaction make_payment(const short_hash& hash)
+{
+    const chain::script script(chain::script::to_pay_key_hash_pattern(hash));
+    return { 1u, 0u, {}, { { 42u, script } } };
+}
+
+static chain::transaction make_spend(const chain::output_point& point)
+{
+    return { 1u, 0u, { { point, chain::script{}, max_input_sequence } }, {} };
+}
+
+// Reference vector is that of the satoshi client (three bytes, five hashes).
+BOOST_AUTO_TEST_CASE(bloom_filter__insert__reference__expected_filter)
+{
+    bloom_filter instance(data_chunk(3, 0x00), 5, 0, bloom_filter::all);
+    instance.insert(to_chunk(base16_literal("99108ad8ed9bb6274d3980bab5a85c048f0950c8")));
+    BOOST_REQUIRE(instance.contains(to_chunk(base16_literal("99108ad8ed9bb6274d3980bab5a85c048f0950c8"))));
+    BOOST_REQUIRE(!instance.contains(to_chunk(base16_literal("19108ad8ed9bb6274d3980bab5a85c048f0950c8"))));
+
+    instance.insert(to_chunk(base16_literal("b5a2c786d9ef4658287ced5914b37a1b4aa32eee")));
+    instance.add(filter_add(to_chunk(base16_literal("b9300670b4c5366e95b2699e8b18bc75e5f729c5"))));
+    BOOST_REQUIRE(instance.filter() == (data_chunk{ 0x61, 0x4e, 0x9b }));
+}
+
+BOOST_AUTO_TEST_CASE(bloom_filter__is_valid__excess_hash_functions__false)
+{
+    const bloom_filter instance(data_chunk(3, 0x00), max_filter_functions + 1,
+        0, bloom_filter::none);
+    BOOST_REQUIRE(!instance.is_valid());
+}
+
+BOOST_AUTO_TEST_CASE(bloom_filter__contains__empty_filter__true)
+{
+    const bloom_filter instance(filter_load({}, 5, 0, bloom_filter::none));
+    BOOST_REQUIRE(instance.contains(to_chunk(std::string("anything"))));
+}
+
+BOOST_AUTO_TEST_CASE(bloom_filter__match__output_data_update_all__spend_matched)
+{
+    const short_hash hash{ { 0x42 } };
+    const auto payment = make_payment(hash);
+    const chain::output_point point(payment.hash(), 0);
+
+    bloom_filter instance(data_chunk(64, 0x00), 10, 7, bloom_filter::all);
+    instance.insert(hash);
+    BOOST_REQUIRE(!instance.contains(point));
+    BOOST_REQUIRE(instance.match(payment));
+    BOOST_REQUIRE(instance.contains(point));
+    BOOST_REQUIRE(instance.match(make_spend(point)));
+}
+
+BOOST_AUTO_TEST_CASE(bloom_filter__match__key_hash_update_public_key_only__spend_not_matched)
+{
+    const short_hash hash{ { 0x42 } };
+    const auto payment = make_payment(hash);
+    const chain::output_point point(payment.hash(), 0);
+
+    bloom_filter instance(data_chunk(64, 0x00), 10, 7,
+        bloom_filter::pay_public_key_only);
+    instance.insert(hash);
+    BOOST_REQUIRE(instance.match(payment));
+    BOOST_REQUIRE(!instance.contains(point));
+}
+
+BOOST_AUTO_TEST_CASE(bloom_filter__to_merkle_block__transaction_hash__matched)
+{
+    chain::transaction::list transactions
+    {
+        make_payment(short_hash{ { 0x01 } }),
+        make_payment(short_hash{ { 0x02 } })
+    };
+
+    chain::header header(1u, null_hash, null_hash, 0u, 0u, 42u);
+    header.set_merkle(chain::block(header, transactions).generate_merkle_root());
+    const chain::block block(header, transactions);
+
+    bloom_filter instance(data_chunk(64, 0x00), 10, 7, bloom_filter::none);
+    instance.insert(transactions[1].hash());
+    const auto result = instance.to_merkle_block(block);
+    BOOST_REQUIRE(result == merkle_block(block, { false, true }));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,88 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::message;
+
+BOOST_AUTO_TEST_SUITE(compact_block_builder_tests)
+
+// Distinct transactions, by locktime.
+static chain::block make_block(size_t count)
+{
+    chain::transaction::list transactions;
+
+    for (uint32_t locktime = 0; locktime < count; ++locktime)
+        transactions.emplace_back(1u, locktime, chain::input::list{},
+            chain::output::list{});
+
+    chain::header header(1u, null_hash, null_hash, 0u, 0u, 42u);
+    header.set_merkle(chain::block(header, transactions).generate_merkle_root());
+    return { header, std::move(transactions) };
+}
+
+BOOST_AUTO_TEST_CASE(compact_block_builder__message__block__coinbase_prefilled)
+{
+    const auto block = make_block(7);
+    const compact_block_builder instance(block, false, 42);
+    const auto message = instance.message();
+    BOOST_REQUIRE(message->header() == block.header());
+    BOOST_REQUIRE_EQUAL(message->nonce(), 42u);
+    BOOST_REQUIRE_EQUAL(message->short_ids().size(), 6u);
+    BOOST_REQUIRE_EQUAL(message->transactions().size(), 1u);
+    BOOST_REQUIRE_EQUAL(message->transactions().front().index(), 0u);
+    BOOST_REQUIRE(message->transactions().front().transaction() == block.transactions().front());
+}
+
+BOOST_AUTO_TEST_CASE(compact_block_builder__message__block__short_ids_match_reconstructor)
+{
+    const auto block = make_block(7);
+    const compact_block_builder instance(block, false, 42);
+    const auto message = instance.message();
+    compact_reconstructor reconstructor(*message, false);
+    const auto& transactions = block.transactions();
+
+    for (size_t index = 1; index < transactions.size(); ++index)
+        BOOST_REQUIRE(message->short_ids()[index - 1] ==
+            reconstructor.to_short_id(transactions[index].hash()));
+
+    BOOST_REQUIRE_EQUAL(reconstructor.initialize(), error::success);
+
+    for (const auto& tx: transactions)
+        reconstructor.match(tx);
+
+    chain::block result;
+    BOOST_REQUIRE_EQUAL(reconstructor.assemble(result), error::success);
+    BOOST_REQUIRE(result == block);
+}
+
+BOOST_AUTO_TEST_CASE(compact_block_builder__payload__block__round_trips)
+{
+    const auto block = make_block(3);
+    const compact_block_builder instance(block, false);
+    const auto payload = instance.payload();
+    const auto version = compact_block::version_maximum;
+    BOOST_REQUIRE_EQUAL(payload->size(), instance.message()->serialized_size(version));
+
+    const auto result = compact_block::factory(version, *payload);
+    BOOST_REQUIRE(result == *instance.message());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,169 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::message;
+
+BOOST_AUTO_TEST_SUITE(compact_reconstructor_tests)
+
+// Distinct transactions, by locktime.
+static chain::transaction::list make_transactions(size_t count)
+{
+    chain::transaction::list out;
+
+    for (uint32_t locktime = 0; locktime < count; ++locktime)
+        out.emplace_back(1u, locktime, chain::input::list{},
+            chain::output::list{});
+
+    return out;
+}
+
+static chain::block make_block(size_t count)
+{
+    auto transactions = make_transactions(count);
+    chain::header header(1u, null_hash, null_hash, 0u, 0u, 42u);
+    header.set_merkle(chain::block(header, transactions).generate_merkle_root());
+    return { header, std::move(transactions) };
+}
+
+// The coinbase is prefilled and all others are short ids.
+static compact_block make_compact(const chain::block& block, uint64_t nonce)
+{
+    compact_block compact;
+    compact.set_header(block.header());
+    compact.set_nonce(nonce);
+    compact.set_transactions(
+    {
+        prefilled_transaction(0, block.transactions().front())
+    });
+
+    compact_reconstructor instance(compact, false);
+    compact_block::short_id_list ids;
+    const auto& transactions = block.transactions();
+
+    for (auto tx = transactions.begin() + 1; tx != transactions.end(); ++tx)
+        ids.push_back(instance.to_short_id(tx->hash()));
+
+    compact.set_short_ids(ids);
+    return compact;
+}
+
+BOOST_AUTO_TEST_CASE(compact_reconstructor__to_short_id__different_nonce__different)
+{
+    const auto block = make_block(2);
+    const auto hash = block.transactions().back().hash();
+    compact_reconstructor first(make_compact(block, 1), false);
+    compact_reconstructor second(make_compact(block, 2), false);
+    BOOST_REQUIRE(first.to_short_id(hash) != second.to_short_id(hash));
+}
+
+BOOST_AUTO_TEST_CASE(compact_reconstructor__assemble__all_in_pool__expected_block)
+{
+    const auto block = make_block(5);
+    compact_reconstructor instance(make_compact(block, 7), false);
+    BOOST_REQUIRE_EQUAL(instance.initialize(), error::success);
+    BOOST_REQUIRE_EQUAL(instance.missing(), 4u);
+
+    // The pool holds every transaction, in reverse order.
+    const auto& pool = block.transactions();
+    for (auto tx = pool.rbegin(); tx != pool.rend(); ++tx)
+        instance.match(*tx);
+
+    BOOST_REQUIRE_EQUAL(instance.missing(), 0u);
+
+    chain::block result;
+    BOOST_REQUIRE_EQUAL(instance.assemble(result), error::success);
+    BOOST_REQUIRE(result == block);
+}
+
+BOOST_AUTO_TEST_CASE(compact_reconstructor__request__partial_pool__differential_indexes)
+{
+    const auto block = make_block(6);
+    compact_reconstructor instance(make_compact(block, 7), false);
+    BOOST_REQUIRE_EQUAL(instance.initialize(), error::success);
+
+    // Positions 2, 4 and 5 are missing.
+    const auto& pool = block.transactions();
+    BOOST_REQUIRE(instance.match(pool[1]));
+    BOOST_REQUIRE(instance.match(pool[3]));
+    BOOST_REQUIRE(!instance.match(pool[3]));
+    BOOST_REQUIRE_EQUAL(instance.missing(), 3u);
+
+    const auto request = instance.request();
+    BOOST_REQUIRE(request.block_hash() == block.hash());
+    BOOST_REQUIRE(request.indexes() == (std::vector<uint64_t>{ 2, 1, 0 }));
+
+    block_transactions response(block.hash(), { pool[2], pool[4], pool[5] });
+    BOOST_REQUIRE_EQUAL(instance.fill(std::move(response)), error::success);
+    BOOST_REQUIRE_EQUAL(instance.missing(), 0u);
+
+    chain::block result;
+    BOOST_REQUIRE_EQUAL(instance.assemble(result), error::success);
+    BOOST_REQUIRE(result == block);
+}
+
+BOOST_AUTO_TEST_CASE(compact_reconstructor__fill__wrong_count__bad_stream)
+{
+    const auto block = make_block(3);
+    compact_reconstructor instance(make_compact(block, 7), false);
+    BOOST_REQUIRE_EQUAL(instance.initialize(), error::success);
+    block_transactions response(block.hash(), { block.transactions()[1] });
+    BOOST_REQUIRE_EQUAL(instance.fill(std::move(response)), error::bad_stream);
+}
+
+BOOST_AUTO_TEST_CASE(compact_reconstructor__assemble__incomplete__operation_failed)
+{
+    const auto block = make_block(3);
+    compact_reconstructor instance(make_compact(block, 7), false);
+    BOOST_REQUIRE_EQUAL(instance.initialize(), error::success);
+    chain::block result;
+    BOOST_REQUIRE_EQUAL(instance.assemble(result), error::operation_failed);
+}
+
+BOOST_AUTO_TEST_CASE(compact_reconstructor__assemble__wrong_transaction__merkle_mismatch)
+{
+    const auto block = make_block(3);
+    compact_reconstructor instance(make_compact(block, 7), false);
+    BOOST_REQUIRE_EQUAL(instance.initialize(), error::success);
+    const auto other = make_transactions(9).back();
+    block_transactions response(block.hash(), { block.transactions()[1], other });
+    BOOST_REQUIRE_EQUAL(instance.fill(std::move(response)), error::success);
+    chain::block result;
+    BOOST_REQUIRE_EQUAL(instance.assemble(result), error::merkle_mismatch);
+}
+
+BOOST_AUTO_TEST_CASE(compact_reconstructor__initialize__prefilled_out_of_range__bad_stream)
+{
+    auto compact = make_compact(make_block(3), 7);
+    compact.transactions().front().set_index(3);
+    compact_reconstructor instance(compact, false);
+    BOOST_REQUIRE_EQUAL(instance.initialize(), error::bad_stream);
+}
+
+BOOST_AUTO_TEST_CASE(compact_reconstructor__initialize__duplicate_short_ids__operation_failed)
+{
+    auto compact = make_compact(make_block(3), 7);
+    compact.short_ids().back() = compact.short_ids().front();
+    compact_reconstructor instance(compact, false);
+    BOOST_REQUIRE_EQUAL(instance.initialize(), error::operation_failed);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,65 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::message;
+
+BOOST_AUTO_TEST_SUITE(encoded_tests)
+
+static const uint32_t magic = 0xd9b4bef9;
+
+BOOST_AUTO_TEST_CASE(encoded__create__ping__serialized_message)
+{
+    const ping packet(42);
+    const auto version = version::level::maximum;
+    const auto instance = encoded::create(version, packet, magic);
+    BOOST_REQUIRE_EQUAL(instance->version(), version);
+    BOOST_REQUIRE_EQUAL(instance->magic(), magic);
+    BOOST_REQUIRE_EQUAL(instance->command(), ping::command);
+    BOOST_REQUIRE(instance->data() == serialize(version, packet, magic));
+    BOOST_REQUIRE(to_chunk(instance->payload()) == packet.to_data(version));
+}
+
+BOOST_AUTO_TEST_CASE(encoding_cache__get__same_version__shared)
+{
+    const ping packet(42);
+    const auto version = version::level::maximum;
+    encoding_cache instance;
+    const auto first = instance.get(version, packet, magic);
+    const auto second = instance.get(version, packet, magic);
+    BOOST_REQUIRE(first == second);
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(encoding_cache__get__distinct_version__distinct_encodings)
+{
+    const ping packet(42);
+    encoding_cache instance;
+    const auto first = instance.get(version::level::maximum, packet, magic);
+    const auto second = instance.get(version::level::minimum, packet, magic);
+    const auto third = instance.get(version::level::maximum, packet, magic + 1);
+    BOOST_REQUIRE(first != second);
+    BOOST_REQUIRE(first != third);
+    BOOST_REQUIRE_EQUAL(second->version(), version::level::minimum);
+    BOOST_REQUIRE_EQUAL(instance.size(), 3u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -164,4 +164,17 @@ BOOST_AUTO_TEST_CASE(fee_filter__operator_boolean_not_equals__differs__returns_t
     BOOST_REQUIRE(instance != expected);
 }
 
+BOOST_AUTO_TEST_CASE(fee_filter__to_wire_data__always__matches_to_data)
+{
+    const message::fee_filter expected(6434u);
+    const auto data = expected.to_wire_data();
+    BOOST_REQUIRE(data_chunk(data.begin(), data.end()) ==
+        expected.to_data(message::fee_filter::version_maximum));
+
+    message::fee_filter instance;
+    BOOST_REQUIRE(instance.from_wire_data(data));
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(expected == instance);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
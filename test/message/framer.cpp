@@ -0,0 +1,127 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::message;
+
+BOOST_AUTO_TEST_SUITE(framer_tests)
+
+static const uint32_t magic = 0xd9b4bef9;
+static const auto level = version::level::maximum;
+
+struct frames
+{
+    std::vector<std::string> commands;
+    std::vector<data_chunk> payloads;
+    std::vector<bool> zero_copy;
+    data_slice chunk{ data_chunk{} };
+
+    framer::handler handler()
+    {
+        return [this](const heading& head, data_slice payload)
+        {
+            commands.push_back(head.command());
+            payloads.push_back(to_chunk(payload));
+            zero_copy.push_back(payload.begin() >= chunk.begin() &&
+                payload.end() <= chunk.end());
+        };
+    }
+};
+
+static data_chunk two_messages()
+{
+    auto data = serialize(level, ping(42), magic);
+    extend_data(data, serialize(level, verack(), magic));
+    return data;
+}
+
+BOOST_AUTO_TEST_CASE(framer__write__whole_messages__zero_copy)
+{
+    frames out;
+    framer instance(magic, level, true);
+    const auto data = two_messages();
+    out.chunk = data;
+    BOOST_REQUIRE_EQUAL(instance.write(data, out.handler()), error::success);
+    BOOST_REQUIRE_EQUAL(out.commands.size(), 2u);
+    BOOST_REQUIRE_EQUAL(out.commands[0], ping::command);
+    BOOST_REQUIRE_EQUAL(out.commands[1], verack::command);
+    BOOST_REQUIRE(out.payloads[0] == ping(42).to_data(level));
+    BOOST_REQUIRE(out.payloads[1].empty());
+    BOOST_REQUIRE(out.zero_copy[0]);
+    BOOST_REQUIRE_EQUAL(instance.needed(), heading::satoshi_fixed_size());
+}
+
+BOOST_AUTO_TEST_CASE(framer__write__single_bytes__resumed)
+{
+    frames out;
+    framer instance(magic, level, true);
+    const auto data = two_messages();
+
+    for (const auto byte: data)
+    {
+        const data_chunk chunk{ byte };
+        out.chunk = chunk;
+        BOOST_REQUIRE_EQUAL(instance.write(chunk, out.handler()), error::success);
+    }
+
+    BOOST_REQUIRE_EQUAL(out.commands.size(), 2u);
+    BOOST_REQUIRE(out.payloads[0] == ping(42).to_data(level));
+    BOOST_REQUIRE(!out.zero_copy[0]);
+}
+
+BOOST_AUTO_TEST_CASE(framer__write__wrong_magic__bad_stream_until_reset)
+{
+    frames out;
+    framer instance(magic + 1, level, true);
+    const auto data = two_messages();
+    BOOST_REQUIRE_EQUAL(instance.write(data, out.handler()), error::bad_stream);
+    BOOST_REQUIRE_EQUAL(instance.write(data, out.handler()), error::bad_stream);
+    BOOST_REQUIRE(out.commands.empty());
+}
+
+BOOST_AUTO_TEST_CASE(framer__write__corrupt_payload__bad_stream)
+{
+    frames out;
+    framer instance(magic, level, true);
+    auto data = serialize(level, ping(42), magic);
+    data.back() ^= 0xff;
+    BOOST_REQUIRE_EQUAL(instance.write(data, out.handler()), error::bad_stream);
+    BOOST_REQUIRE(out.commands.empty());
+
+    instance.reset();
+    const auto valid = serialize(level, ping(42), magic);
+    BOOST_REQUIRE_EQUAL(instance.write(valid, out.handler()), error::success);
+    BOOST_REQUIRE_EQUAL(out.commands.size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(framer__write__oversized_payload__bad_stream)
+{
+    frames out;
+    framer instance(magic, level, false);
+    const auto size = heading::maximum_payload_size(level, false) + 1;
+    const heading head(magic, ping::command, static_cast<uint32_t>(size), 0);
+    BOOST_REQUIRE_EQUAL(instance.write(head.to_data(), out.handler()), error::bad_stream);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -742,4 +742,138 @@ BOOST_AUTO_TEST_CASE(headers__is_sequential__disordered__false)
     BOOST_REQUIRE(!instance.is_sequential());
 }
 
+// The first three mainnet block headers.
+#define HEADER0 "0100000000000000000000000000000000000000000000000000000000000000000000003ba3edfd7a7b12b27ac72c3e67768f617fc81bc3888a51323a9fb8aa4b1e5e4a29ab5f49ffff001d1dac2b7c"
+#define HEADER1 "010000006fe28c0ab6f1b372c1a6a246ae63f74f931e8365e15a089c68d6190000000000982051fd1e4ba744bbbe680e1fee14677ba1a3c3540bf7b1cdb606e857233e0e61bc6649ffff001d01e36299"
+#define HEADER2 "010000004860eb18bf1b1620e37e9490fc8a427514416fd75159ab86688e9a8300000000d5fdcc541e25de1c7a5addedf24858b8bb665c9f36ef744ee42c316022c90f9bb0bc6649ffff001d08d2bd61"
+
+static header get_header(const std::string& encoded)
+{
+    data_chunk data;
+    BOOST_REQUIRE(decode_base16(data, encoded));
+    return header(chain::header::factory(data));
+}
+
+static const settings mainnet(config::settings::mainnet);
+
+BOOST_AUTO_TEST_CASE(headers__check_all__empty__success)
+{
+    size_t index = 42;
+    const headers instance;
+    BOOST_REQUIRE_EQUAL(instance.check_all(index, mainnet.timestamp_limit_seconds, mainnet.proof_of_work_limit), error::success);
+    BOOST_REQUIRE_EQUAL(index, 42u);
+}
+
+BOOST_AUTO_TEST_CASE(headers__check_all__sequential__success_and_hashes_cached)
+{
+    size_t index = 42;
+    const headers instance({ get_header(HEADER0), get_header(HEADER1), get_header(HEADER2) });
+    BOOST_REQUIRE_EQUAL(instance.check_all(index, mainnet.timestamp_limit_seconds, mainnet.proof_of_work_limit), error::success);
+    BOOST_REQUIRE_EQUAL(index, 42u);
+
+    hash_list hashes;
+    instance.to_hashes(hashes);
+    BOOST_REQUIRE_EQUAL(hashes.size(), 3u);
+    BOOST_REQUIRE_EQUAL(encode_hash(hashes[0]), "000000000019d6689c085ae165831e934ff763ae46a2a6c172b3f1b60a8ce26f");
+    BOOST_REQUIRE_EQUAL(encode_hash(hashes[1]), "00000000839a8e6886ab5951d76f411475428afc90947ee320161bbf18eb6048");
+    BOOST_REQUIRE_EQUAL(encode_hash(hashes[2]), "000000006a625f06636b8bb6ac7b960a8d03705d1ace08b1a19da3fdcc99ddbd");
+}
+
+BOOST_AUTO_TEST_CASE(headers__check_all__disordered__invalid_previous_block)
+{
+    size_t index = 42;
+    const headers instance({ get_header(HEADER0), get_header(HEADER2), get_header(HEADER1) });
+    BOOST_REQUIRE_EQUAL(instance.check_all(index, mainnet.timestamp_limit_seconds, mainnet.proof_of_work_limit), error::invalid_previous_block);
+    BOOST_REQUIRE_EQUAL(index, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(headers__check_all__insufficient_work__invalid_proof_of_work)
+{
+    size_t index = 42;
+    auto last = get_header(HEADER2);
+    last.set_nonce(0);
+    const headers instance({ get_header(HEADER0), get_header(HEADER1), last });
+    BOOST_REQUIRE_EQUAL(instance.check_all(index, mainnet.timestamp_limit_seconds, mainnet.proof_of_work_limit), error::invalid_proof_of_work);
+    BOOST_REQUIRE_EQUAL(index, 2u);
+}
+
+BOOST_AUTO_TEST_CASE(headers__check_all__threadpool_failures__first_failure)
+{
+    threadpool pool(2);
+    size_t index = 42;
+    auto middle = get_header(HEADER1);
+    middle.set_nonce(0);
+
+    // The unlinked last header is preceded by the failed proof of work.
+    const headers instance({ get_header(HEADER0), middle, get_header(HEADER2) });
+    BOOST_REQUIRE_EQUAL(instance.check_all(index, mainnet.timestamp_limit_seconds, mainnet.proof_of_work_limit, pool), error::invalid_proof_of_work);
+    BOOST_REQUIRE_EQUAL(index, 1u);
+
+    const headers sequential({ get_header(HEADER0), get_header(HEADER1), get_header(HEADER2) });
+    BOOST_REQUIRE_EQUAL(sequential.check_all(index, mainnet.timestamp_limit_seconds, mainnet.proof_of_work_limit, pool), error::success);
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(headers__check_all__scrypt_sha256_work__first_invalid_proof_of_work)
+{
+    threadpool pool(2);
+    size_t index = 42;
+
+    // The sha256 work of these headers is not scrypt work.
+    const headers instance({ get_header(HEADER0), get_header(HEADER1), get_header(HEADER2) });
+    BOOST_REQUIRE_EQUAL(instance.check_all(index, mainnet.timestamp_limit_seconds, mainnet.proof_of_work_limit, true), error::invalid_proof_of_work);
+    BOOST_REQUIRE_EQUAL(index, 0u);
+
+    index = 42;
+    BOOST_REQUIRE_EQUAL(instance.check_all(index, mainnet.timestamp_limit_seconds, mainnet.proof_of_work_limit, pool, true), error::invalid_proof_of_work);
+    BOOST_REQUIRE_EQUAL(index, 0u);
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(headers__serialize__contiguous__matches_message_serialize)
+{
+    const uint32_t magic = 0xd9b4bef9;
+    const headers instance({ get_header(HEADER0), get_header(HEADER1), get_header(HEADER2) });
+
+    data_chunk serialized;
+    BOOST_REQUIRE(decode_base16(serialized, HEADER0 HEADER1 HEADER2));
+
+    data_chunk out;
+    headers::serialize(serialized, magic, out);
+    BOOST_REQUIRE(out == message::serialize(version::level::maximum, instance, magic));
+}
+
+BOOST_AUTO_TEST_CASE(headers__serialize__strided_records__matches_message_serialize)
+{
+    // Exceeds one hash group, with records of the header_file stride.
+    static const size_t count = 150;
+    const uint32_t magic = 0xd9b4bef9;
+    const auto stride = chain::header_file::record_size;
+    data_chunk records(count * stride, 0xff);
+    header::list elements;
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        auto element = get_header(HEADER1);
+        element.set_nonce(static_cast<uint32_t>(index));
+        const auto data = static_cast<const chain::header&>(element).to_data();
+        std::copy(data.begin(), data.end(), records.begin() + index * stride);
+        elements.push_back(element);
+    }
+
+    data_chunk out;
+    headers::serialize(records.data(), count, stride, magic, out);
+    BOOST_REQUIRE(out == message::serialize(version::level::maximum, headers(elements), magic));
+}
+
+BOOST_AUTO_TEST_CASE(headers__serialize__empty__matches_message_serialize)
+{
+    const uint32_t magic = 0xd9b4bef9;
+    data_chunk out{ 42 };
+    headers::serialize(data_chunk{}, magic, out);
+    BOOST_REQUIRE(out == message::serialize(version::level::maximum, headers(), magic));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -420,4 +420,18 @@ BOOST_AUTO_TEST_CASE(reject__operator_boolean_not_equals__differs__returns_true)
     BOOST_REQUIRE(instance != expected);
 }
 
+BOOST_AUTO_TEST_CASE(inventory_vector__to_wire_data__always__matches_to_data)
+{
+    const message::inventory_vector expected(
+        message::inventory_vector::type_id::block,
+        hash_literal("4a5e1e4baab89f3a32518a88c31bc87f618f76673e2cc77ab2127b7afdeda33b"));
+    const auto data = expected.to_wire_data();
+    BOOST_REQUIRE(data_chunk(data.begin(), data.end()) ==
+        expected.to_data(message::version::level::minimum));
+
+    message::inventory_vector instance;
+    BOOST_REQUIRE(instance.from_wire_data(data));
+    BOOST_REQUIRE(expected == instance);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
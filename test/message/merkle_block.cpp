@@ -137,6 +137,52 @@ BOOST_AUTO_TEST_CASE(merkle_block__constructor_5__always__equals_params)
     BOOST_REQUIRE(flags == instance.flags());
 }
 
+// Distinct transactions, by locktime.
+static chain::block make_block(size_t count)
+{
+    chain::transaction::list transactions;
+
+    for (uint32_t locktime = 0; locktime < count; ++locktime)
+        transactions.emplace_back(1u, locktime, chain::input::list{},
+            chain::output::list{});
+
+    chain::header header(1u, null_hash, null_hash, 0u, 0u, 42u);
+    header.set_merkle(chain::block(header, transactions).generate_merkle_root());
+    return { header, std::move(transactions) };
+}
+
+BOOST_AUTO_TEST_CASE(merkle_block__constructor_6__no_matches__merkle_root)
+{
+    const auto block = make_block(3);
+    const message::merkle_block instance(block, { false, false, false });
+    BOOST_REQUIRE(instance.header() == block.header());
+    BOOST_REQUIRE_EQUAL(instance.total_transactions(), 3u);
+    BOOST_REQUIRE(instance.hashes() == hash_list{ block.header().merkle() });
+    BOOST_REQUIRE(instance.flags() == data_chunk{ 0x00 });
+}
+
+BOOST_AUTO_TEST_CASE(merkle_block__constructor_6__one_match__partial_tree)
+{
+    const auto block = make_block(3);
+    const auto hashes = block.to_hashes();
+    const message::merkle_block instance(block, { false, true, false });
+
+    // Depth first bits: root, left, tx0, tx1, right (1, 1, 0, 1, 0).
+    BOOST_REQUIRE(instance.flags() == data_chunk{ 0x0b });
+    BOOST_REQUIRE_EQUAL(instance.hashes().size(), 3u);
+    BOOST_REQUIRE(instance.hashes()[0] == hashes[0]);
+    BOOST_REQUIRE(instance.hashes()[1] == hashes[1]);
+    BOOST_REQUIRE(instance.hashes()[2] == merkle_hash(hashes[2], hashes[2]));
+}
+
+BOOST_AUTO_TEST_CASE(merkle_block__constructor_6__single_transaction__leaf)
+{
+    const auto block = make_block(1);
+    const message::merkle_block instance(block, { true });
+    BOOST_REQUIRE(instance.hashes() == block.to_hashes());
+    BOOST_REQUIRE(instance.flags() == data_chunk{ 0x01 });
+}
+
 BOOST_AUTO_TEST_CASE(from_data_insufficient_data_fails)
 {
     const data_chunk data{ 10 };
@@ -48,4 +48,49 @@ BOOST_AUTO_TEST_CASE(messages__variable_uint_size__eight_byte__expected)
     BOOST_REQUIRE_EQUAL(variable_uint_size(value), 9u);
 }
 
+BOOST_AUTO_TEST_CASE(messages__serialize__ping__heading_and_payload)
+{
+    static const uint32_t magic = 0xd9b4bef9;
+    const ping packet(42);
+    const auto version = version::level::maximum;
+    const auto data = serialize(version, packet, magic);
+    const auto heading_size = heading::satoshi_fixed_size();
+    BOOST_REQUIRE_EQUAL(data.size(), heading_size + packet.serialized_size(version));
+
+    const data_chunk payload(data.begin() + heading_size, data.end());
+    BOOST_REQUIRE(payload == packet.to_data(version));
+
+    const auto head = heading::factory({ data.begin(), data.begin() + heading_size });
+    BOOST_REQUIRE_EQUAL(head.magic(), magic);
+    BOOST_REQUIRE_EQUAL(head.command(), ping::command);
+    BOOST_REQUIRE_EQUAL(head.payload_size(), payload.size());
+    BOOST_REQUIRE_EQUAL(head.checksum(), bitcoin_checksum(payload));
+}
+
+BOOST_AUTO_TEST_CASE(messages__serialize__reused_buffer__same_encoding_no_reallocation)
+{
+    static const uint32_t magic = 0xd9b4bef9;
+    const auto version = version::level::maximum;
+    const auto expected = serialize(version, ping(7), magic);
+
+    // A larger message sizes the buffer, the smaller fits its capacity.
+    data_chunk buffer;
+    serialize(version, reject(reject::reason_code::invalid, "tx", "reason"), magic, buffer);
+    const auto capacity = buffer.capacity();
+    const auto address = buffer.data();
+
+    serialize(version, ping(7), magic, buffer);
+    BOOST_REQUIRE(buffer == expected);
+    BOOST_REQUIRE_EQUAL(buffer.capacity(), capacity);
+    BOOST_REQUIRE(buffer.data() == address);
+}
+
+BOOST_AUTO_TEST_CASE(messages__serialize__empty_payload__heading_only)
+{
+    static const uint32_t magic = 0xd9b4bef9;
+    const auto version = version::level::maximum;
+    BOOST_REQUIRE_EQUAL(serialize(version, verack(), magic).size(), heading::satoshi_fixed_size());
+    BOOST_REQUIRE_EQUAL(serialize(version, send_headers(), magic).size(), heading::satoshi_fixed_size());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
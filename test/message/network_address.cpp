@@ -462,4 +462,23 @@ BOOST_AUTO_TEST_CASE(network_address__operator_boolean_not_equals__differs__retu
     BOOST_REQUIRE(instance != expected);
 }
 
+BOOST_AUTO_TEST_CASE(network_address__to_wire_data__always__matches_timestamped_to_data)
+{
+    const message::network_address expected
+    {
+        734678u,
+        5357534u,
+        base16_literal("127544abcdefa7b6d3e91486c57000aa"),
+        123u
+    };
+
+    const auto data = expected.to_wire_data();
+    BOOST_REQUIRE(data_chunk(data.begin(), data.end()) ==
+        expected.to_data(message::version::level::minimum, true));
+
+    message::network_address instance;
+    BOOST_REQUIRE(instance.from_wire_data(data));
+    BOOST_REQUIRE(equal(expected, instance, true));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -252,4 +252,17 @@ BOOST_AUTO_TEST_CASE(ping__operator_boolean_not_equals__differs__returns_true)
     BOOST_REQUIRE(instance != expected);
 }
 
+BOOST_AUTO_TEST_CASE(ping__to_wire_data__bip31__matches_to_data)
+{
+    const message::ping expected(4306550u);
+    const auto data = expected.to_wire_data();
+    BOOST_REQUIRE(data_chunk(data.begin(), data.end()) ==
+        expected.to_data(message::version::level::bip31));
+
+    message::ping instance;
+    BOOST_REQUIRE(instance.from_wire_data(data));
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(expected == instance);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -167,4 +167,19 @@ BOOST_AUTO_TEST_CASE(pong__operator_boolean_not_equals__differs__returns_true)
     BOOST_REQUIRE(instance != expected);
 }
 
+BOOST_AUTO_TEST_CASE(pong__to_wire_data__always__matches_to_data)
+{
+    const message::pong expected(4306550u);
+    const auto data = expected.to_wire_data();
+    BOOST_REQUIRE_EQUAL(message::pong::wire_size, message::pong::satoshi_fixed_size(
+        message::version::level::minimum));
+    BOOST_REQUIRE(data_chunk(data.begin(), data.end()) ==
+        expected.to_data(message::version::level::minimum));
+
+    message::pong instance;
+    BOOST_REQUIRE(instance.from_wire_data(data));
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(expected == instance);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
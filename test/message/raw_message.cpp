@@ -0,0 +1,89 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::message;
+
+BOOST_AUTO_TEST_SUITE(raw_message_tests)
+
+static const uint32_t magic = 0xd9b4bef9;
+
+static message::block make_block()
+{
+    const chain::transaction tx{ 1, 0, { { { null_hash, 0 }, {}, 0 } },
+        { { 42, {} } } };
+    const chain::header header(1u, null_hash, null_hash, 0u, 0u, 42u);
+    return { header, { tx } };
+}
+
+BOOST_AUTO_TEST_CASE(raw_message__to_data__serialized_block__expected)
+{
+    const auto block = make_block();
+    const auto payload = block.to_data(message::version::level::canonical);
+    const raw_message instance(magic, message::block::command, payload);
+    BOOST_REQUIRE_EQUAL(instance.size(), heading::satoshi_fixed_size() +
+        payload.size());
+    BOOST_REQUIRE(instance.to_data() ==
+        serialize(message::version::level::canonical, block, magic));
+}
+
+BOOST_AUTO_TEST_CASE(raw_message__head__checksum__not_computed)
+{
+    const data_chunk payload{ 1, 2, 3 };
+    const raw_message instance(magic, message::block::command, payload, 42u);
+    const auto& head = instance.head();
+    const auto parsed = heading::factory(data_chunk(head.begin(), head.end()));
+    BOOST_REQUIRE(parsed.is_valid());
+    BOOST_REQUIRE_EQUAL(parsed.magic(), magic);
+    BOOST_REQUIRE_EQUAL(parsed.command(), message::block::command);
+    BOOST_REQUIRE_EQUAL(parsed.payload_size(), payload.size());
+    BOOST_REQUIRE_EQUAL(parsed.checksum(), 42u);
+}
+
+BOOST_AUTO_TEST_CASE(raw_message__to_buffers__always__payload_not_copied)
+{
+    const data_chunk payload{ 1, 2, 3 };
+    const raw_message instance(magic, message::block::command, payload);
+    const auto buffers = instance.to_buffers();
+    BOOST_REQUIRE(boost::asio::buffer_cast<const uint8_t*>(buffers[0]) ==
+        instance.head().data());
+    BOOST_REQUIRE_EQUAL(boost::asio::buffer_size(buffers[0]),
+        heading::satoshi_fixed_size());
+    BOOST_REQUIRE(boost::asio::buffer_cast<const uint8_t*>(buffers[1]) ==
+        payload.data());
+    BOOST_REQUIRE_EQUAL(boost::asio::buffer_size(buffers[1]), payload.size());
+}
+
+BOOST_AUTO_TEST_CASE(raw_message__storage__shared__payload_outlives_owner)
+{
+    raw_message::const_ptr instance;
+    {
+        const auto storage = std::make_shared<const data_chunk>(
+            data_chunk{ 1, 2, 3 });
+        instance = std::make_shared<const raw_message>(magic,
+            message::block::command, *storage, storage);
+    }
+
+    BOOST_REQUIRE(instance->payload().size() == 3u);
+    BOOST_REQUIRE_EQUAL(instance->payload().data()[2], 3u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,118 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::message;
+
+BOOST_AUTO_TEST_SUITE(reconciliation_set_tests)
+
+static hash_digest make_hash(uint32_t value)
+{
+    return sha256_hash(to_chunk(to_little_endian(value)));
+}
+
+BOOST_AUTO_TEST_CASE(reconciliation_set__to_short_id__salt_order__same)
+{
+    const reconciliation_set local(1, 2);
+    const reconciliation_set remote(2, 1);
+    const reconciliation_set other(1, 3);
+    const auto hash = make_hash(42);
+    BOOST_REQUIRE_NE(local.to_short_id(hash), 0u);
+    BOOST_REQUIRE_EQUAL(local.to_short_id(hash), remote.to_short_id(hash));
+    BOOST_REQUIRE_NE(local.to_short_id(hash), other.to_short_id(hash));
+}
+
+BOOST_AUTO_TEST_CASE(reconciliation_set__insert__duplicate__false)
+{
+    reconciliation_set set(1, 2);
+    BOOST_REQUIRE(set.insert(make_hash(1)));
+    BOOST_REQUIRE(!set.insert(make_hash(1)));
+    BOOST_REQUIRE_EQUAL(set.size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(reconciliation_set__erase__present__true)
+{
+    reconciliation_set set(1, 2);
+    set.insert(make_hash(1));
+    BOOST_REQUIRE(!set.erase(make_hash(2)));
+    BOOST_REQUIRE(set.erase(make_hash(1)));
+    BOOST_REQUIRE(set.empty());
+}
+
+BOOST_AUTO_TEST_CASE(reconciliation_set__capacity__sizes__estimated)
+{
+    reconciliation_set set(1, 2);
+    for (uint32_t value = 0; value < 100; ++value)
+        set.insert(make_hash(value));
+
+    BOOST_REQUIRE_EQUAL(set.capacity(80), 41u);
+    BOOST_REQUIRE_EQUAL(set.capacity(100000),
+        reconciliation_set::max_capacity);
+}
+
+BOOST_AUTO_TEST_CASE(reconciliation_set__to_inventory__differences__local_inventory_remote_missing)
+{
+    reconciliation_set local(7, 9);
+    reconciliation_set remote(9, 7);
+
+    for (uint32_t value = 0; value < 200; ++value)
+    {
+        local.insert(make_hash(value));
+        remote.insert(make_hash(value));
+    }
+
+    local.insert(make_hash(1000));
+    local.insert(make_hash(1001));
+    remote.insert(make_hash(2000));
+
+    const auto sketch = remote.sketch(remote.capacity(local.size()));
+    reconciliation_set::short_id_list differences;
+    BOOST_REQUIRE(local.differences(differences, sketch));
+    BOOST_REQUIRE_EQUAL(differences.size(), 3u);
+
+    reconciliation_set::short_id_list missing;
+    const auto announce = local.to_inventory(differences, missing);
+    BOOST_REQUIRE_EQUAL(announce.inventories().size(), 2u);
+    BOOST_REQUIRE_EQUAL(missing.size(), 1u);
+    BOOST_REQUIRE_EQUAL(missing.front(), remote.to_short_id(make_hash(2000)));
+
+    for (const auto& inventory: announce.inventories())
+    {
+        BOOST_REQUIRE(inventory.type() ==
+            inventory_vector::type_id::witness_transaction);
+        BOOST_REQUIRE(inventory.hash() == make_hash(1000) ||
+            inventory.hash() == make_hash(1001));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(reconciliation_set__differences__beyond_capacity__false)
+{
+    reconciliation_set local(7, 9);
+    reconciliation_set remote(9, 7);
+
+    for (uint32_t value = 0; value < 50; ++value)
+        local.insert(make_hash(value));
+
+    reconciliation_set::short_id_list differences;
+    BOOST_REQUIRE(!local.differences(differences, remote.sketch(10)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -197,4 +197,24 @@ BOOST_AUTO_TEST_CASE(send_compact__operator_boolean_not_equals__differs__returns
     BOOST_REQUIRE(instance != expected);
 }
 
+BOOST_AUTO_TEST_CASE(send_compact__to_wire_data__always__matches_to_data)
+{
+    const message::send_compact expected(true, 164);
+    const auto data = expected.to_wire_data();
+    BOOST_REQUIRE(data_chunk(data.begin(), data.end()) ==
+        expected.to_data(message::send_compact::version_minimum));
+
+    message::send_compact instance;
+    BOOST_REQUIRE(instance.from_wire_data(data));
+    BOOST_REQUIRE(expected == instance);
+}
+
+BOOST_AUTO_TEST_CASE(send_compact__from_wire_data__invalid_mode__failure)
+{
+    message::send_compact::wire_data data{ { 2 } };
+    message::send_compact instance;
+    BOOST_REQUIRE(!instance.from_wire_data(data));
+    BOOST_REQUIRE(!instance.is_valid());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,159 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::message;
+
+BOOST_AUTO_TEST_SUITE(statistics_tests)
+
+// Statistics are process-wide, so each case starts from drained counters and
+// leaves recording disabled.
+struct statistics_fixture
+{
+    statistics_fixture()
+    {
+        statistics::enable(false);
+        log::metrics discard;
+        statistics::merge(discard);
+    }
+
+    ~statistics_fixture()
+    {
+        statistics::enable(false);
+    }
+};
+
+static const auto level = version::level::maximum;
+
+BOOST_AUTO_TEST_CASE(statistics__command__types__expected)
+{
+    BOOST_REQUIRE_EQUAL(statistics::command(message_type::headers), "headers");
+    BOOST_REQUIRE_EQUAL(statistics::command(message_type::inventory), "inv");
+    BOOST_REQUIRE_EQUAL(statistics::command(message_type::unknown), "");
+}
+
+BOOST_AUTO_TEST_CASE(statistics__type__messages__expected)
+{
+    BOOST_REQUIRE(statistics::type<headers>() == message_type::headers);
+    BOOST_REQUIRE(statistics::type<get_data>() == message_type::get_data);
+    BOOST_REQUIRE(statistics::type<version>() == message_type::version);
+}
+
+BOOST_FIXTURE_TEST_CASE(statistics__factory__disabled__not_recorded, statistics_fixture)
+{
+    const auto data = ping(42).to_data(level);
+    BOOST_REQUIRE(ping::factory(level, data).is_valid());
+
+    log::metrics metrics;
+    statistics::merge(metrics);
+    BOOST_REQUIRE_EQUAL(metrics.get_counter("message.ping.parse.bytes").value(), 0);
+    BOOST_REQUIRE_EQUAL(metrics.get_timer("message.ping.parse.time").take().count, 0u);
+}
+
+BOOST_FIXTURE_TEST_CASE(statistics__factory__enabled__recorded, statistics_fixture)
+{
+    const auto data = ping(42).to_data(level);
+    statistics::enable();
+    BOOST_REQUIRE(ping::factory(level, data).is_valid());
+    BOOST_REQUIRE(ping::factory(level, data).is_valid());
+
+    log::metrics metrics;
+    statistics::merge(metrics);
+    BOOST_REQUIRE_EQUAL(metrics.get_counter("message.ping.parse.bytes").value(), 16);
+    BOOST_REQUIRE_EQUAL(metrics.get_timer("message.ping.parse.time").take().count, 2u);
+
+    // The counters are moved into the metrics.
+    log::metrics again;
+    statistics::merge(again);
+    BOOST_REQUIRE_EQUAL(again.get_counter("message.ping.parse.bytes").value(), 0);
+}
+
+BOOST_FIXTURE_TEST_CASE(statistics__factory__invalid__recorded_without_bytes, statistics_fixture)
+{
+    const data_chunk truncated{ 0x01, 0x02 };
+    statistics::enable();
+    BOOST_REQUIRE(!ping::factory(level, truncated).is_valid());
+
+    log::metrics metrics;
+    statistics::merge(metrics);
+    BOOST_REQUIRE_EQUAL(metrics.get_counter("message.ping.parse.bytes").value(), 0);
+    BOOST_REQUIRE_EQUAL(metrics.get_timer("message.ping.parse.time").take().count, 1u);
+}
+
+BOOST_FIXTURE_TEST_CASE(statistics__serialize__enabled__payload_recorded, statistics_fixture)
+{
+    const message::headers instance({ chain::header{}, chain::header{} });
+    statistics::enable();
+    const auto data = message::serialize(level, instance, 0);
+    BOOST_REQUIRE_EQUAL(data.size(), heading::satoshi_fixed_size() +
+        instance.serialized_size(level));
+
+    log::metrics metrics;
+    statistics::merge(metrics, "p2p.");
+    const auto& bytes = metrics.get_counter("p2p.headers.serialize.bytes");
+    BOOST_REQUIRE_EQUAL(bytes.value(), int64_t(instance.serialized_size(level)));
+    BOOST_REQUIRE_EQUAL(metrics.get_timer("p2p.headers.serialize.time").take().count, 1u);
+    BOOST_REQUIRE_EQUAL(metrics.get_counter("p2p.headers.parse.bytes").value(), 0);
+}
+
+BOOST_FIXTURE_TEST_CASE(statistics__factory__threads__merged, statistics_fixture)
+{
+    const auto data = inventory({ { inventory::type_id::block, null_hash } })
+        .to_data(level);
+
+    statistics::enable();
+    const auto parse = [&data]()
+    {
+        for (auto count = 0; count < 10; ++count)
+            inventory::factory(level, data);
+    };
+
+    std::thread first(parse);
+    std::thread second(parse);
+    first.join();
+    second.join();
+
+    // Counters of exited threads are retained until merged.
+    log::metrics metrics;
+    statistics::merge(metrics);
+    BOOST_REQUIRE_EQUAL(metrics.get_counter("message.inv.parse.bytes").value(),
+        int64_t(20 * data.size()));
+    BOOST_REQUIRE_EQUAL(metrics.get_timer("message.inv.parse.time").take().count, 20u);
+}
+
+BOOST_FIXTURE_TEST_CASE(statistics__attach__collect__merged, statistics_fixture)
+{
+    log::metrics metrics;
+    statistics::attach(metrics);
+    statistics::enable();
+    verack::factory(level, data_chunk{});
+
+    const auto datagrams = metrics.collect("bc.", 1024);
+    BOOST_REQUIRE_EQUAL(datagrams.size(), 1u);
+    BOOST_REQUIRE(datagrams.front().find("bc.message.verack.parse.time.count:1|c") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -31,6 +31,7 @@ BOOST_AUTO_TEST_CASE(settings__construct__default_context__expected)
     settings configuration;
     BOOST_REQUIRE_EQUAL(configuration.block_spacing_seconds(), 600);
     BOOST_REQUIRE_EQUAL(configuration.timestamp_limit_seconds, 7200);
+    BOOST_REQUIRE_EQUAL(configuration.cache_budget_bytes, 0u);
     BOOST_REQUIRE_EQUAL(configuration.retargeting_interval_seconds(), 1209600);
     BOOST_REQUIRE_EQUAL(configuration.minimum_timespan(), 302400);
     BOOST_REQUIRE_EQUAL(configuration.maximum_timespan(), 4838400);
@@ -275,6 +276,55 @@ BOOST_AUTO_TEST_CASE(settings__construct__regtest_context__expected)
     BOOST_REQUIRE_EQUAL(configuration.max_money(), 1499999998350);
 }
 
+// profiles
+//-----------------------------------------------------------------------------
+
+// Profile members are copied, as they are declared but not defined.
+template <typename Profile>
+static void require_profile(const settings& configuration)
+{
+    BOOST_REQUIRE_EQUAL(configuration.timestamp_limit_seconds, uint32_t(Profile::timestamp_limit_seconds));
+    BOOST_REQUIRE_EQUAL(configuration.proof_of_work_limit, uint32_t(Profile::proof_of_work_limit));
+    BOOST_REQUIRE_EQUAL(configuration.block_spacing_seconds(), uint32_t(Profile::block_spacing_seconds));
+    BOOST_REQUIRE_EQUAL(configuration.retargeting_interval_seconds(), uint32_t(Profile::retargeting_interval_seconds));
+    BOOST_REQUIRE_EQUAL(configuration.minimum_timespan(), uint32_t(Profile::minimum_timespan));
+    BOOST_REQUIRE_EQUAL(configuration.maximum_timespan(), uint32_t(Profile::maximum_timespan));
+    BOOST_REQUIRE_EQUAL(configuration.retargeting_interval(), size_t(Profile::retargeting_interval));
+    BOOST_REQUIRE_EQUAL(configuration.initial_block_subsidy_bitcoin(), uint64_t(Profile::initial_block_subsidy_bitcoin));
+    BOOST_REQUIRE_EQUAL(configuration.bitcoin_to_satoshi(configuration.initial_block_subsidy_bitcoin()), uint64_t(Profile::initial_block_subsidy_satoshi));
+    BOOST_REQUIRE_EQUAL(configuration.subsidy_interval(), uint64_t(Profile::subsidy_interval));
+    BOOST_REQUIRE_EQUAL(configuration.max_money(), uint64_t(Profile::max_money));
+    BOOST_REQUIRE_EQUAL(configuration.first_version, uint32_t(Profile::first_version));
+    BOOST_REQUIRE_EQUAL(configuration.bip34_version, uint32_t(Profile::bip34_version));
+    BOOST_REQUIRE_EQUAL(configuration.bip66_version, uint32_t(Profile::bip66_version));
+    BOOST_REQUIRE_EQUAL(configuration.bip65_version, uint32_t(Profile::bip65_version));
+    BOOST_REQUIRE_EQUAL(configuration.bip9_version_bit0, uint32_t(Profile::bip9_version_bit0));
+    BOOST_REQUIRE_EQUAL(configuration.bip9_version_bit1, uint32_t(Profile::bip9_version_bit1));
+    BOOST_REQUIRE_EQUAL(configuration.bip9_version_base, uint32_t(Profile::bip9_version_base));
+    BOOST_REQUIRE_EQUAL(configuration.activation_threshold, size_t(Profile::activation_threshold));
+    BOOST_REQUIRE_EQUAL(configuration.enforcement_threshold, size_t(Profile::enforcement_threshold));
+    BOOST_REQUIRE_EQUAL(configuration.activation_sample, size_t(Profile::activation_sample));
+    BOOST_REQUIRE_EQUAL(configuration.bip65_freeze, size_t(Profile::bip65_freeze));
+    BOOST_REQUIRE_EQUAL(configuration.bip66_freeze, size_t(Profile::bip66_freeze));
+    BOOST_REQUIRE_EQUAL(configuration.bip34_freeze, size_t(Profile::bip34_freeze));
+    BOOST_REQUIRE_EQUAL(configuration.bip16_activation_time, uint32_t(Profile::bip16_activation_time));
+}
+
+BOOST_AUTO_TEST_CASE(settings__construct__mainnet_context__mainnet_profile)
+{
+    require_profile<profiles::mainnet>(settings(config::settings::mainnet));
+}
+
+BOOST_AUTO_TEST_CASE(settings__construct__testnet_context__testnet_profile)
+{
+    require_profile<profiles::testnet>(settings(config::settings::testnet));
+}
+
+BOOST_AUTO_TEST_CASE(settings__construct__regtest_context__regtest_profile)
+{
+    require_profile<profiles::regtest>(settings(config::settings::regtest));
+}
+
 // setter methods
 //-----------------------------------------------------------------------------
 
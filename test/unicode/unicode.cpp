@@ -52,6 +52,22 @@ BOOST_AUTO_TEST_CASE(unicode__to_normal_nfkd_form__validate__test)
     BOOST_REQUIRE_EQUAL(normalized.c_str(), ascii_space_sandwich);
 }
 
+BOOST_AUTO_TEST_CASE(unicode__to_normal_nfkd_form__ascii__unchanged)
+{
+    const std::string ascii = "TREZOR \t~\x7f";
+    BOOST_REQUIRE_EQUAL(to_normal_nfkd_form(ascii), ascii);
+    BOOST_REQUIRE_EQUAL(to_normal_nfc_form(ascii), ascii);
+}
+
+BOOST_AUTO_TEST_CASE(unicode__to_normal_nfkd_form__repeated__same)
+{
+    const auto ideographic_space_sandwich = "space->　<-space";
+    const auto first = to_normal_nfkd_form(ideographic_space_sandwich);
+    const auto second = to_normal_nfkd_form(ideographic_space_sandwich);
+    BOOST_REQUIRE_EQUAL(first, second);
+    BOOST_REQUIRE_EQUAL(second, "space-> <-space");
+}
+
 #endif
 
 // Use of L is not recommended as it will only work for ascii.
@@ -0,0 +1,210 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <cstring>
+#include <future>
+#include <memory>
+#include <boost/filesystem.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(async_file_writer_tests)
+
+// A unique file in the working directory, removed on destruct.
+struct temporary_file
+{
+    temporary_file()
+      : pool(2),
+        path(boost::filesystem::unique_path("async_file_writer-%%%%%%%%"))
+    {
+    }
+
+    ~temporary_file()
+    {
+        pool.shutdown();
+        pool.join();
+        boost::system::error_code ignore;
+        boost::filesystem::remove(path, ignore);
+    }
+
+    data_chunk read()
+    {
+        boost::filesystem::ifstream file(path, std::ios::binary);
+        return data_chunk(std::istreambuf_iterator<char>(file),
+            std::istreambuf_iterator<char>());
+    }
+
+    threadpool pool;
+    boost::filesystem::path path;
+};
+
+static async_file_writer::handler promise_handler(
+    std::shared_ptr<std::promise<code>> promise)
+{
+    return [promise](const code& ec)
+    {
+        promise->set_value(ec);
+    };
+}
+
+static aligned_buffer::ptr make_buffer(uint8_t fill)
+{
+    const auto buffer = std::make_shared<aligned_buffer>(
+        aligned_buffer::alignment);
+    std::memset(buffer->data(), fill, buffer->size());
+    return buffer;
+}
+
+BOOST_AUTO_TEST_CASE(aligned_buffer__construct__size__rounded_aligned_zeroized)
+{
+    const aligned_buffer buffer(1);
+    const auto address = reinterpret_cast<uintptr_t>(buffer.data());
+    BOOST_REQUIRE_EQUAL(buffer.size(), aligned_buffer::alignment);
+    BOOST_REQUIRE_EQUAL(address % aligned_buffer::alignment, 0u);
+    BOOST_REQUIRE_EQUAL(buffer.data()[0], 0u);
+    BOOST_REQUIRE_EQUAL(buffer.data()[buffer.size() - 1], 0u);
+}
+
+BOOST_AUTO_TEST_CASE(aligned_buffer__align__boundaries__expected)
+{
+    const auto alignment = aligned_buffer::alignment;
+    BOOST_REQUIRE_EQUAL(aligned_buffer::align(0), 0u);
+    BOOST_REQUIRE_EQUAL(aligned_buffer::align(1), alignment);
+    BOOST_REQUIRE_EQUAL(aligned_buffer::align(alignment), alignment);
+    BOOST_REQUIRE_EQUAL(aligned_buffer::align(alignment + 1), 2 * alignment);
+}
+
+BOOST_AUTO_TEST_CASE(async_file_writer__write__not_open__operation_failed)
+{
+    temporary_file file;
+    async_file_writer writer(file.pool);
+    const auto written = std::make_shared<std::promise<code>>();
+    writer.write(0, make_buffer(42), promise_handler(written));
+    BOOST_REQUIRE_EQUAL(written->get_future().get(), error::operation_failed);
+    BOOST_REQUIRE(!writer.is_open());
+}
+
+BOOST_AUTO_TEST_CASE(async_file_writer__open__twice__operation_failed)
+{
+    temporary_file file;
+    async_file_writer writer(file.pool);
+    BOOST_REQUIRE_EQUAL(writer.open(file.path), error::success);
+    BOOST_REQUIRE_EQUAL(writer.open(file.path), error::operation_failed);
+    BOOST_REQUIRE(writer.is_open());
+    BOOST_REQUIRE_EQUAL(writer.close(), error::success);
+    BOOST_REQUIRE(!writer.is_open());
+}
+
+BOOST_AUTO_TEST_CASE(async_file_writer__submit__batch_with_barriers__written_in_place)
+{
+    static const size_t writes = 12;
+    const auto size = aligned_buffer::alignment;
+    temporary_file file;
+
+    // A depth below the batch size leaves operations pending in the writer.
+    async_file_writer writer(file.pool, 4);
+    BOOST_REQUIRE_EQUAL(writer.open(file.path), error::success);
+
+    std::vector<std::shared_ptr<std::promise<code>>> promises;
+
+    for (size_t index = 0; index < writes; ++index)
+    {
+        promises.push_back(std::make_shared<std::promise<code>>());
+        writer.write(index * size, make_buffer(static_cast<uint8_t>(index)),
+            promise_handler(promises.back()));
+
+        if (index % 4 == 3)
+        {
+            promises.push_back(std::make_shared<std::promise<code>>());
+            writer.sync(promise_handler(promises.back()));
+        }
+    }
+
+    writer.submit();
+
+    for (const auto& promise: promises)
+        BOOST_REQUIRE_EQUAL(promise->get_future().get(), error::success);
+
+    BOOST_REQUIRE_EQUAL(writer.close(), error::success);
+
+    const auto data = file.read();
+    BOOST_REQUIRE_EQUAL(data.size(), writes * size);
+
+    for (size_t index = 0; index < writes; ++index)
+    {
+        BOOST_REQUIRE_EQUAL(data[index * size], index);
+        BOOST_REQUIRE_EQUAL(data[index * size + size - 1], index);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(async_file_writer__write__partial_buffer__size_written)
+{
+    temporary_file file;
+    async_file_writer writer(file.pool);
+    BOOST_REQUIRE_EQUAL(writer.open(file.path), error::success);
+
+    const auto written = std::make_shared<std::promise<code>>();
+    writer.write(3, make_buffer(42), 5, promise_handler(written));
+
+    // Close submits queued operations.
+    BOOST_REQUIRE_EQUAL(writer.close(), error::success);
+    BOOST_REQUIRE_EQUAL(written->get_future().get(), error::success);
+    BOOST_REQUIRE(file.read() == (data_chunk{ 0, 0, 0, 42, 42, 42, 42, 42 }));
+}
+
+BOOST_AUTO_TEST_CASE(async_file_writer__write__size_exceeds_buffer__operation_failed)
+{
+    temporary_file file;
+    async_file_writer writer(file.pool);
+    BOOST_REQUIRE_EQUAL(writer.open(file.path), error::success);
+
+    const auto buffer = make_buffer(42);
+    const auto written = std::make_shared<std::promise<code>>();
+    writer.write(0, buffer, buffer->size() + 1, promise_handler(written));
+    BOOST_REQUIRE_EQUAL(written->get_future().get(), error::operation_failed);
+    BOOST_REQUIRE_EQUAL(writer.close(), error::success);
+}
+
+BOOST_AUTO_TEST_CASE(async_file_writer__write__direct_unaligned__operation_failed)
+{
+    temporary_file file;
+    async_file_writer writer(file.pool);
+
+    // Direct i/o is not supported by every file system.
+    if (writer.open(file.path, true))
+        return;
+
+    const auto offset = std::make_shared<std::promise<code>>();
+    const auto size = std::make_shared<std::promise<code>>();
+    const auto aligned = std::make_shared<std::promise<code>>();
+    writer.write(1, make_buffer(42), promise_handler(offset));
+    writer.write(0, make_buffer(42), 1, promise_handler(size));
+    writer.write(0, make_buffer(42), promise_handler(aligned));
+    writer.submit();
+
+    BOOST_REQUIRE_EQUAL(offset->get_future().get(), error::operation_failed);
+    BOOST_REQUIRE_EQUAL(size->get_future().get(), error::operation_failed);
+    BOOST_REQUIRE_EQUAL(aligned->get_future().get(), error::success);
+    BOOST_REQUIRE_EQUAL(writer.close(), error::success);
+    BOOST_REQUIRE_EQUAL(file.read().size(), aligned_buffer::alignment);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
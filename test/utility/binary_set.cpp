@@ -0,0 +1,121 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(binary_set_tests)
+
+BOOST_AUTO_TEST_CASE(binary_set__construct__bits__empty)
+{
+    const binary_set instance(32);
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.bits(), 32u);
+}
+
+BOOST_AUTO_TEST_CASE(binary_set__push_back__data__truncated)
+{
+    binary_set instance(12);
+    instance.push_back(data_chunk{ 0xba, 0xad, 0xf0, 0x0d });
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    BOOST_REQUIRE_EQUAL(instance[0].encoded(), "101110101010");
+}
+
+BOOST_AUTO_TEST_CASE(binary_set__push_back__field__little_endian)
+{
+    binary_set instance(32);
+    instance.push_back(uint32_t(0x0df0adba));
+    BOOST_REQUIRE(instance[0] == binary(32, uint32_t(0x0df0adba)));
+}
+
+BOOST_AUTO_TEST_CASE(binary_set__match__prefix__expected_indexes)
+{
+    binary_set instance(32);
+
+    for (uint32_t field = 0; field < 200; ++field)
+        instance.push_back(field);
+
+    // The low byte of the field is the leading byte of the record.
+    const binary prefix("0000001");
+    const binary_set::index_list expected{ 2, 3 };
+    BOOST_REQUIRE(instance.match(prefix) == expected);
+    BOOST_REQUIRE_EQUAL(instance.count(prefix), 2u);
+    BOOST_REQUIRE(instance.is_prefix(prefix, 3));
+    BOOST_REQUIRE(!instance.is_prefix(prefix, 4));
+}
+
+BOOST_AUTO_TEST_CASE(binary_set__match__empty_prefix__all)
+{
+    binary_set instance(8);
+
+    for (uint32_t field = 0; field < 70; ++field)
+        instance.push_back(field);
+
+    BOOST_REQUIRE_EQUAL(instance.count(binary()), 70u);
+    BOOST_REQUIRE_EQUAL(instance.match(binary()).size(), 70u);
+}
+
+BOOST_AUTO_TEST_CASE(binary_set__match__prefix_beyond_width__padding)
+{
+    binary_set instance(4);
+    instance.push_back(data_chunk{ 0xaf });
+    BOOST_REQUIRE_EQUAL(instance.count(binary("10100000")), 1u);
+    BOOST_REQUIRE_EQUAL(instance.count(binary("10101111")), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(binary_set__match__multiple_words__expected)
+{
+    binary_set instance(160);
+    const auto first = base16_literal("0123456789abcdef0123456789abcdef01234567");
+    const auto second = base16_literal("0123456789abcdef0123456789abcdef01234568");
+    instance.push_back(first);
+    instance.push_back(second);
+    instance.push_back(first);
+
+    const binary_set::index_list expected{ 0, 2 };
+    BOOST_REQUIRE(instance.match(binary(160, first)) == expected);
+    BOOST_REQUIRE_EQUAL(instance.count(binary(150, first)), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(binary_set__match__agrees_with_binary__expected)
+{
+    binary_set instance(32);
+    uint32_t field = 0x12345678;
+
+    for (size_t index = 0; index < 1000; ++index)
+    {
+        field = field * 1103515245u + 12345u;
+        instance.push_back(field);
+    }
+
+    const binary prefix(8, uint32_t(0xa5));
+
+    for (const auto index: instance.match(prefix))
+        BOOST_REQUIRE(prefix.is_prefix_of(instance[index]));
+
+    size_t expected = 0;
+    for (size_t index = 0; index < instance.size(); ++index)
+        expected += prefix.is_prefix_of(instance[index]) ? 1 : 0;
+
+    BOOST_REQUIRE_EQUAL(instance.count(prefix), expected);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,157 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(byte_reader_tests)
+
+BOOST_AUTO_TEST_CASE(byte_reader__roundtrip__byte_writer__expected)
+{
+    data_chunk data;
+    byte_writer writer(data);
+    writer.write_byte(0x80);
+    writer.write_2_bytes_little_endian(0x8040);
+    writer.write_4_bytes_little_endian(0x80402010);
+    writer.write_8_bytes_little_endian(0x8040201011223344);
+    writer.write_4_bytes_big_endian(0x80402010);
+    writer.write_variable_little_endian(1234);
+    writer.write_variable_base128(0x4000);
+    writer.write_bytes(to_chunk(to_little_endian<uint32_t>(0xbadf00d)));
+    writer.write_string("hello");
+    writer.write_string("abc", 5);
+    writer.write_hash(null_hash);
+
+    byte_reader reader(data);
+    BOOST_REQUIRE_EQUAL(reader.read_byte(), 0x80u);
+    BOOST_REQUIRE_EQUAL(reader.read_2_bytes_little_endian(), 0x8040u);
+    BOOST_REQUIRE_EQUAL(reader.read_4_bytes_little_endian(), 0x80402010u);
+    BOOST_REQUIRE_EQUAL(reader.read_8_bytes_little_endian(), 0x8040201011223344u);
+    BOOST_REQUIRE_EQUAL(reader.read_4_bytes_big_endian(), 0x80402010u);
+    BOOST_REQUIRE_EQUAL(reader.read_variable_little_endian(), 1234u);
+    BOOST_REQUIRE_EQUAL(reader.read_variable_base128(), 0x4000u);
+    BOOST_REQUIRE_EQUAL(from_little_endian_unsafe<uint32_t>(reader.read_bytes(4).begin()), 0xbadf00du);
+    BOOST_REQUIRE_EQUAL(reader.read_string(), "hello");
+    BOOST_REQUIRE_EQUAL(reader.read_string(5), "abc");
+    BOOST_REQUIRE(reader.read_hash() == null_hash);
+    BOOST_REQUIRE(reader);
+    BOOST_REQUIRE(reader.is_exhausted());
+}
+
+BOOST_AUTO_TEST_CASE(byte_reader__read_4_bytes__insufficient__invalid_and_unconsumed)
+{
+    const data_chunk data{ 0x01, 0x02, 0x03 };
+    byte_reader reader(data);
+    BOOST_REQUIRE_EQUAL(reader.read_4_bytes_little_endian(), 0u);
+    BOOST_REQUIRE(!reader);
+    BOOST_REQUIRE_EQUAL(reader.remaining(), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(byte_reader__read_bytes__excessive_size__empty_invalid)
+{
+    const data_chunk data{ 0x01, 0x02, 0x03 };
+    byte_reader reader(data);
+    BOOST_REQUIRE(reader.read_bytes(max_size_t).empty());
+    BOOST_REQUIRE(!reader);
+}
+
+BOOST_AUTO_TEST_CASE(byte_reader__read_bytes_out__sufficient__reuses_capacity)
+{
+    const data_chunk data{ 0x01, 0x02, 0x03 };
+    byte_reader reader(data);
+    data_chunk out;
+    out.reserve(8);
+    const auto capacity = out.data();
+    reader.read_bytes(out, 2);
+    BOOST_REQUIRE(reader);
+    BOOST_REQUIRE(out.data() == capacity);
+    BOOST_REQUIRE(out == (data_chunk{ 0x01, 0x02 }));
+}
+
+BOOST_AUTO_TEST_CASE(byte_reader__read_bytes_out__excessive_size__empty_invalid)
+{
+    const data_chunk data{ 0x01, 0x02, 0x03 };
+    byte_reader reader(data);
+    data_chunk out{ 0x2a };
+    reader.read_bytes(out, 4);
+    BOOST_REQUIRE(!reader);
+    BOOST_REQUIRE(out.empty());
+}
+
+BOOST_AUTO_TEST_CASE(byte_reader__read_count__fits_remaining__expected)
+{
+    const data_chunk data{ 0x02, 0x01, 0x02, 0x03, 0x04 };
+    byte_reader reader(data);
+    BOOST_REQUIRE_EQUAL(read_count(reader, 2, 10), 2u);
+    BOOST_REQUIRE(reader);
+    BOOST_REQUIRE_EQUAL(reader.remaining(), 4u);
+}
+
+BOOST_AUTO_TEST_CASE(byte_reader__read_count__exceeds_remaining__zero_invalid)
+{
+    const data_chunk data{ 0x03, 0x01, 0x02, 0x03, 0x04 };
+    byte_reader reader(data);
+    BOOST_REQUIRE_EQUAL(read_count(reader, 2, 10), 0u);
+    BOOST_REQUIRE(!reader);
+}
+
+BOOST_AUTO_TEST_CASE(byte_reader__read_count__exceeds_maximum__zero_invalid)
+{
+    const data_chunk data{ 0x03, 0x01, 0x02, 0x03, 0x04 };
+    byte_reader reader(data);
+    BOOST_REQUIRE_EQUAL(read_count(reader, 1, 2), 0u);
+    BOOST_REQUIRE(!reader);
+}
+
+BOOST_AUTO_TEST_CASE(byte_reader__peek_byte__exhausted__valid)
+{
+    const data_chunk data{ 0x2a };
+    byte_reader reader(data);
+    BOOST_REQUIRE_EQUAL(reader.peek_byte(), 0x2au);
+    BOOST_REQUIRE_EQUAL(reader.read_byte(), 0x2au);
+    BOOST_REQUIRE_EQUAL(reader.peek_byte(), 0u);
+    BOOST_REQUIRE(reader);
+    BOOST_REQUIRE(reader.is_exhausted());
+}
+
+BOOST_AUTO_TEST_CASE(byte_reader__transaction_from_data__same_as_istream_reader)
+{
+    const auto data = to_chunk(base16_literal(
+        "0100000001f08e44a96bfb5ae63eda1a6620adae37ee37ee4777fb0336e1bbbc"
+        "4de65310fc010000006a473044022050d8368cacf9bf1b8fb1f7cfd9aff63294"
+        "789eb1760139e7ef41f083726dadc4022067796354aba8f2e02363c5e510aa7e"
+        "2830b115472fb31de67d16972867f13945012103e589480b2f746381fca01a9b"
+        "12c517b7a482a203c8b2742985da0ac72cc078f2ffffffff02f0c9c467000000"
+        "001976a914d9d78e26df4e4601cf9b26d09c7b280ee764469f88ac80c4600f00"
+        "0000001976a9141ee32412020a324b93b1a1acfdfff6ab9ca8fac288ac000000"
+        "00"));
+
+    chain::transaction expected;
+    data_source stream(data);
+    istream_reader source(stream);
+    BOOST_REQUIRE(expected.from_data(source));
+
+    const auto instance = chain::transaction::factory(data);
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(instance == expected);
+    BOOST_REQUIRE(instance.to_data() == data);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
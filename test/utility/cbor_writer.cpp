@@ -0,0 +1,64 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(cbor_writer_tests)
+
+BOOST_AUTO_TEST_CASE(cbor_writer__write__nested__expected)
+{
+    data_chunk cbor;
+    cbor_writer writer(cbor);
+    writer.begin_object();
+    writer.write_key("a");
+    writer.write_value(1u);
+    writer.write_key("b");
+    writer.begin_array();
+    writer.write_value("x");
+    writer.end_array();
+    writer.end_object();
+    BOOST_REQUIRE_EQUAL(encode_base16(cbor), "bf61610161629f6178ffff");
+}
+
+BOOST_AUTO_TEST_CASE(cbor_writer__write_value__integers__shortest_encoding)
+{
+    data_chunk cbor;
+    cbor_writer writer(cbor);
+    writer.write_value(23u);
+    writer.write_value(24u);
+    writer.write_value(256u);
+    writer.write_value(65536u);
+    writer.write_value(4294967296u);
+    BOOST_REQUIRE_EQUAL(encode_base16(cbor),
+        "17" "1818" "190100" "1a00010000" "1b0000000100000000");
+}
+
+BOOST_AUTO_TEST_CASE(cbor_writer__write_value__long_text__length_prefix)
+{
+    data_chunk cbor;
+    cbor_writer writer(cbor);
+    writer.write_value(std::string(24, 'a'));
+    BOOST_REQUIRE_EQUAL(cbor.size(), 26u);
+    BOOST_REQUIRE_EQUAL(cbor[0], 0x78);
+    BOOST_REQUIRE_EQUAL(cbor[1], 24u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,115 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(cold_ptr_tests)
+
+BOOST_AUTO_TEST_CASE(cold_ptr__constructor__default__unallocated)
+{
+    const cold_ptr<size_t> instance;
+    BOOST_REQUIRE(!instance);
+    BOOST_REQUIRE(instance.peek() == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(cold_ptr__get__unallocated__default_allocated)
+{
+    cold_ptr<data_chunk> instance;
+    BOOST_REQUIRE(instance->empty());
+    BOOST_REQUIRE(instance);
+    BOOST_REQUIRE(instance.peek() == &instance.get());
+}
+
+BOOST_AUTO_TEST_CASE(cold_ptr__assign__value__allocated)
+{
+    cold_ptr<size_t> instance;
+    instance = 42u;
+    BOOST_REQUIRE(instance);
+    BOOST_REQUIRE_EQUAL(*instance, 42u);
+}
+
+BOOST_AUTO_TEST_CASE(cold_ptr__copy__unallocated__unallocated)
+{
+    const cold_ptr<data_chunk> instance;
+    const auto copy = instance;
+    BOOST_REQUIRE(!copy);
+}
+
+BOOST_AUTO_TEST_CASE(cold_ptr__copy__allocated__deep_copy)
+{
+    cold_ptr<data_chunk> instance;
+    *instance = data_chunk{ 1, 2, 3 };
+    const auto copy = instance;
+    BOOST_REQUIRE(copy.peek() != instance.peek());
+    BOOST_REQUIRE(*copy.peek() == (data_chunk{ 1, 2, 3 }));
+
+    instance->clear();
+    BOOST_REQUIRE(*copy.peek() == (data_chunk{ 1, 2, 3 }));
+}
+
+BOOST_AUTO_TEST_CASE(cold_ptr__move__allocated__transfers_allocation)
+{
+    cold_ptr<data_chunk> instance;
+    *instance = data_chunk{ 1, 2, 3 };
+    const auto value = instance.peek();
+    const auto moved = std::move(instance);
+    BOOST_REQUIRE(moved.peek() == value);
+    BOOST_REQUIRE(!instance);
+}
+
+BOOST_AUTO_TEST_CASE(cold_ptr__reset__allocated__unallocated)
+{
+    cold_ptr<data_chunk> instance;
+    *instance = data_chunk{ 1, 2, 3 };
+    instance.reset();
+    BOOST_REQUIRE(!instance);
+    BOOST_REQUIRE(instance->empty());
+}
+
+BOOST_AUTO_TEST_CASE(cold_ptr__get__concurrent__single_allocation)
+{
+    static const size_t threads = 8;
+    cold_ptr<std::atomic<size_t>> instance;
+    std::vector<std::thread> workers;
+    std::vector<std::atomic<size_t>*> values(threads);
+
+    for (size_t index = 0; index < threads; ++index)
+        workers.emplace_back([&instance, &values, index]()
+        {
+            values[index] = &instance.get();
+            ++instance.get();
+        });
+
+    for (auto& worker: workers)
+        worker.join();
+
+    for (const auto value: values)
+        BOOST_REQUIRE(value == instance.peek());
+
+    BOOST_REQUIRE_EQUAL(instance->load(), threads);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,162 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <bitcoin/bitcoin.hpp>
+
+// Coroutines require C++20, there are no tests under prior standards.
+#ifdef BC_COROUTINES
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(coroutine_tests)
+
+static task<size_t> forty_two()
+{
+    co_return 42;
+}
+
+static task<size_t> add_one(task<size_t> value)
+{
+    co_return (co_await value) + 1;
+}
+
+static task<void> throws()
+{
+    throw std::runtime_error("test");
+    co_return;
+}
+
+static task<std::thread::id> resumed_thread(threadpool& pool)
+{
+    co_await schedule(pool);
+    co_return std::this_thread::get_id();
+}
+
+static task<void> increment(threadpool& pool, std::atomic<size_t>& count)
+{
+    co_await schedule(pool);
+    ++count;
+}
+
+static task<code> result(threadpool& pool, code value)
+{
+    co_await schedule(pool);
+    co_return value;
+}
+
+static task<code> delayed(threadpool& pool)
+{
+    co_return co_await delay(pool, asio::milliseconds(1));
+}
+
+static task<code> waited(deadline::ptr timer)
+{
+    co_return co_await wait(timer, asio::milliseconds(1));
+}
+
+BOOST_AUTO_TEST_CASE(coroutine__frame_pool__reallocate__reused)
+{
+    const auto first = frame_pool::allocate(100);
+    frame_pool::deallocate(first, 100);
+    const auto second = frame_pool::allocate(120);
+    BOOST_REQUIRE(first == second);
+    frame_pool::deallocate(second, 120);
+}
+
+BOOST_AUTO_TEST_CASE(coroutine__sync_wait__nested_tasks__expected_value)
+{
+    BOOST_REQUIRE_EQUAL(sync_wait(add_one(forty_two())), 43u);
+}
+
+BOOST_AUTO_TEST_CASE(coroutine__sync_wait__throws__rethrown)
+{
+    BOOST_REQUIRE_THROW(sync_wait(throws()), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(coroutine__schedule__pool__resumed_on_pool_thread)
+{
+    threadpool pool(1);
+    const auto thread = sync_wait(resumed_thread(pool));
+    BOOST_REQUIRE(thread != std::this_thread::get_id());
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(coroutine__when_all__concurrent_tasks__all_completed)
+{
+    static const size_t count = 100;
+    threadpool pool(4);
+    std::atomic<size_t> counter(0);
+    std::vector<task<void>> tasks;
+
+    for (size_t index = 0; index < count; ++index)
+        tasks.push_back(increment(pool, counter));
+
+    sync_wait(when_all(std::move(tasks)));
+    BOOST_REQUIRE_EQUAL(counter.load(), count);
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(coroutine__when_all__failure__first_failure)
+{
+    threadpool pool(2);
+    std::vector<task<code>> tasks;
+    tasks.push_back(result(pool, error::success));
+    tasks.push_back(result(pool, error::bad_stream));
+    tasks.push_back(result(pool, error::operation_failed));
+    BOOST_REQUIRE_EQUAL(sync_wait(when_all(std::move(tasks))),
+        error::bad_stream);
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(coroutine__when_all__empty__success)
+{
+    BOOST_REQUIRE_EQUAL(sync_wait(when_all(std::vector<task<code>>{})),
+        error::success);
+}
+
+BOOST_AUTO_TEST_CASE(coroutine__delay__elapsed__success)
+{
+    threadpool pool(1);
+    BOOST_REQUIRE_EQUAL(sync_wait(delayed(pool)), error::success);
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(coroutine__wait__deadline_expired__success)
+{
+    threadpool pool(1);
+    const auto timer = std::make_shared<deadline>(pool);
+    BOOST_REQUIRE_EQUAL(sync_wait(waited(timer)), error::success);
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
@@ -0,0 +1,119 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+// Each test restores the default kernels, even on failure.
+struct cpu_features_fixture
+{
+    ~cpu_features_fixture()
+    {
+        set_cpu_features(all_features);
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(cpu_features_tests, cpu_features_fixture)
+
+struct results
+{
+    std::vector<hash_digest> sha256;
+    std::vector<long_hash> hmac_sha512;
+    std::vector<hash_digest> scrypt;
+    std::vector<aes_block> aes;
+    std::string base16;
+    std::string base64;
+};
+
+// Exercise each dispatched kernel, with batches that fill and remain.
+static results compute()
+{
+    std::vector<data_chunk> messages;
+    for (size_t index = 0; index < 19; ++index)
+        messages.emplace_back(index * 37, static_cast<uint8_t>(index));
+
+    std::vector<data_slice> slices;
+    for (const auto& message: messages)
+        slices.emplace_back(message);
+
+    const data_chunk header(80, 0x2a);
+    const std::vector<data_slice> headers(9, header);
+    const std::vector<data_slice> keys(slices.rbegin(), slices.rend());
+
+    results out;
+    out.sha256.resize(slices.size());
+    sha256_hash_batch(slices.data(), slices.size(), out.sha256.data());
+    out.hmac_sha512.resize(slices.size());
+    hmac_sha512_hash_batch(slices.data(), keys.data(), slices.size(),
+        out.hmac_sha512.data());
+    out.scrypt.resize(headers.size());
+    scrypt_hash_batch(headers.data(), headers.size(), out.scrypt.data());
+
+    aes_secret secret;
+    secret.fill(0x42);
+    out.aes.resize(7);
+    for (size_t index = 0; index < out.aes.size(); ++index)
+        out.aes[index].fill(static_cast<uint8_t>(index));
+
+    aes256_encrypt(secret, out.aes.data(), out.aes.size());
+    out.base16 = encode_base16(messages.back());
+    out.base64 = encode_base64(messages.back());
+    return out;
+}
+
+BOOST_AUTO_TEST_CASE(cpu_features__set_cpu_features__none__disabled)
+{
+    set_cpu_features(no_features);
+    BOOST_REQUIRE_EQUAL(cpu_features(), 0u);
+    set_cpu_features(all_features);
+    BOOST_REQUIRE_EQUAL(cpu_features(), cpu_features_detected());
+}
+
+BOOST_AUTO_TEST_CASE(cpu_features__cpu_kernels__none__portable)
+{
+    set_cpu_features(no_features);
+    const auto kernels = cpu_kernels();
+    BOOST_REQUIRE(kernels.find("features=none") != std::string::npos);
+    BOOST_REQUIRE(kernels.find("sha256=portable ") != std::string::npos);
+    BOOST_REQUIRE(kernels.find("sha512=portable ") != std::string::npos);
+    BOOST_REQUIRE(kernels.find("aes256=portable ") != std::string::npos);
+    BOOST_REQUIRE(kernels.find("scrypt=portable ") != std::string::npos);
+    BOOST_REQUIRE(kernels.find("gf2_32=portable") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(cpu_features__kernels__none__same_as_detected)
+{
+    const auto expected = compute();
+    set_cpu_features(no_features);
+    const auto portable = compute();
+    set_cpu_features(all_features);
+    const auto restored = compute();
+
+    BOOST_REQUIRE(portable.sha256 == expected.sha256);
+    BOOST_REQUIRE(portable.hmac_sha512 == expected.hmac_sha512);
+    BOOST_REQUIRE(portable.scrypt == expected.scrypt);
+    BOOST_REQUIRE(portable.aes == expected.aes);
+    BOOST_REQUIRE_EQUAL(portable.base16, expected.base16);
+    BOOST_REQUIRE_EQUAL(portable.base64, expected.base64);
+    BOOST_REQUIRE(restored.sha256 == expected.sha256);
+    BOOST_REQUIRE(restored.aes == expected.aes);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
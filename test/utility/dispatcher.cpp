@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(dispatcher_tests)
+
+BOOST_AUTO_TEST_CASE(dispatcher__ordered_by__unstarted__keyed_backlog)
+{
+    threadpool pool(0);
+    dispatcher instance(pool, "test");
+
+    for (size_t key = 0; key < 100; ++key)
+        instance.ordered_by(key, [](){});
+
+    size_t total = 0;
+    for (size_t shard = 0; shard < instance.shards(); ++shard)
+        total += instance.keyed_backlog(shard);
+
+    BOOST_REQUIRE_EQUAL(instance.keyed_backlog(), 100u);
+    BOOST_REQUIRE_EQUAL(total, 100u);
+    BOOST_REQUIRE_EQUAL(instance.combined_backlog(), 100u);
+    BOOST_REQUIRE_EQUAL(instance.ordered_backlog(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(dispatcher__ordered_by__many_keys__ordered_per_key)
+{
+    static const size_t keys = 32;
+    static const size_t jobs = 200;
+
+    threadpool pool(4);
+    dispatcher instance(pool, "test");
+    std::mutex mutex;
+    std::vector<std::vector<size_t>> sequences(keys);
+    auto done = std::make_shared<std::promise<void>>();
+    size_t remaining = keys * jobs;
+
+    for (size_t job = 0; job < jobs; ++job)
+    {
+        for (size_t key = 0; key < keys; ++key)
+        {
+            instance.ordered_by(key, [&, key, job, done]()
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                sequences[key].push_back(job);
+
+                if (--remaining == 0)
+                    done->set_value();
+            });
+        }
+    }
+
+    done->get_future().wait();
+    pool.shutdown();
+    pool.join();
+
+    for (const auto& sequence: sequences)
+    {
+        BOOST_REQUIRE_EQUAL(sequence.size(), jobs);
+
+        for (size_t job = 0; job < jobs; ++job)
+            BOOST_REQUIRE_EQUAL(sequence[job], job);
+    }
+
+    BOOST_REQUIRE_EQUAL(instance.keyed_backlog(), 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
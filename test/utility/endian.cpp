@@ -17,6 +17,8 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include <boost/test/unit_test.hpp>
+
+#include <list>
 #include <bitcoin/bitcoin.hpp>
 
 using namespace bc;
@@ -167,4 +169,40 @@ BOOST_AUTO_TEST_CASE(endian__round_trip64__big_to_big__expected)
     BOOST_REQUIRE_EQUAL(from_big_endian_unsafe<uint64_t>(big_endian.begin()), expected);
 }
 
+BOOST_AUTO_TEST_CASE(endian__store_load_little_endian__round_trip__expected_bytes)
+{
+    byte_array<4> data;
+    store_little_endian<uint32_t>(data.data(), 0x01020304);
+    BOOST_REQUIRE_EQUAL(data[0], 0x04);
+    BOOST_REQUIRE_EQUAL(data[3], 0x01);
+    BOOST_REQUIRE_EQUAL(load_little_endian<uint32_t>(data.data()), 0x01020304u);
+}
+
+BOOST_AUTO_TEST_CASE(endian__store_load_big_endian__round_trip__expected_bytes)
+{
+    byte_array<2> data;
+    store_big_endian<uint16_t>(data.data(), 0x0102);
+    BOOST_REQUIRE_EQUAL(data[0], 0x01);
+    BOOST_REQUIRE_EQUAL(data[1], 0x02);
+    BOOST_REQUIRE_EQUAL(load_big_endian<uint16_t>(data.data()), 0x0102u);
+}
+
+BOOST_AUTO_TEST_CASE(endian__from_little_endian_unsafe__contiguous_and_list__same)
+{
+    const data_chunk data{ 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+    const std::list<uint8_t> list(data.begin(), data.end());
+    BOOST_REQUIRE_EQUAL(from_little_endian_unsafe<uint64_t>(data.begin()), 0x0807060504030201u);
+    BOOST_REQUIRE_EQUAL(from_little_endian_unsafe<uint64_t>(list.begin()), 0x0807060504030201u);
+    BOOST_REQUIRE_EQUAL(from_little_endian_unsafe<uint16_t>(data.data() + 6), 0x0807u);
+}
+
+BOOST_AUTO_TEST_CASE(endian__from_big_endian_unsafe__contiguous_and_list__same)
+{
+    const data_chunk data{ 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+    const std::list<uint8_t> list(data.begin(), data.end());
+    BOOST_REQUIRE_EQUAL(from_big_endian_unsafe<uint64_t>(data.begin()), 0x0102030405060708u);
+    BOOST_REQUIRE_EQUAL(from_big_endian_unsafe<uint64_t>(list.begin()), 0x0102030405060708u);
+    BOOST_REQUIRE_EQUAL(from_big_endian_unsafe<uint32_t>(data.data() + 4), 0x05060708u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
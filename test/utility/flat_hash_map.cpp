@@ -0,0 +1,213 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+// Test helpers.
+static hash_digest make_key(uint32_t value)
+{
+    hash_digest key{ {} };
+    const auto bytes = to_little_endian(value);
+    std::copy(bytes.begin(), bytes.end(), key.begin());
+    return key;
+}
+
+// All keys collide, so each probe spans groups.
+struct colliding_hash
+{
+    size_t operator()(const hash_digest&) const
+    {
+        return 42;
+    }
+};
+
+BOOST_AUTO_TEST_SUITE(flat_hash_map_tests)
+
+BOOST_AUTO_TEST_CASE(flat_hash_map__construct__default__empty)
+{
+    const flat_hash_map<hash_digest, size_t> instance;
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 0u);
+    BOOST_REQUIRE(!instance.contains(null_hash));
+    BOOST_REQUIRE(instance.find(null_hash) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(flat_hash_map__construct__entries__reserved)
+{
+    flat_hash_map<hash_digest, size_t> instance(1000);
+    const auto capacity = instance.capacity();
+    BOOST_REQUIRE(capacity * 7 >= 1000u * 8);
+
+    for (uint32_t value = 0; value < 1000; ++value)
+        BOOST_REQUIRE(instance.insert(make_key(value), value));
+
+    BOOST_REQUIRE_EQUAL(instance.capacity(), capacity);
+    BOOST_REQUIRE_EQUAL(instance.size(), 1000u);
+}
+
+BOOST_AUTO_TEST_CASE(flat_hash_map__insert__duplicate__false_unchanged)
+{
+    flat_hash_map<hash_digest, std::string> instance;
+    BOOST_REQUIRE(instance.insert(null_hash, "first"));
+    BOOST_REQUIRE(!instance.insert(null_hash, "second"));
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    BOOST_REQUIRE_EQUAL(*instance.find(null_hash), "first");
+}
+
+BOOST_AUTO_TEST_CASE(flat_hash_map__subscript__missing__default_inserted)
+{
+    flat_hash_map<hash_digest, size_t> instance;
+    BOOST_REQUIRE_EQUAL(instance[null_hash], 0u);
+    instance[null_hash] += 5;
+    instance[make_key(1)] = 7;
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+    BOOST_REQUIRE_EQUAL(*instance.find(null_hash), 5u);
+    BOOST_REQUIRE_EQUAL(*instance.find(make_key(1)), 7u);
+}
+
+BOOST_AUTO_TEST_CASE(flat_hash_map__erase__colliding_keys__others_found)
+{
+    flat_hash_map<hash_digest, uint32_t, colliding_hash> instance;
+
+    for (uint32_t value = 0; value < 100; ++value)
+        BOOST_REQUIRE(instance.insert(make_key(value), value));
+
+    for (uint32_t value = 0; value < 100; value += 2)
+        BOOST_REQUIRE(instance.erase(make_key(value)));
+
+    BOOST_REQUIRE(!instance.erase(make_key(0)));
+    BOOST_REQUIRE_EQUAL(instance.size(), 50u);
+
+    for (uint32_t value = 0; value < 100; ++value)
+    {
+        const auto found = instance.find(make_key(value));
+        BOOST_REQUIRE_EQUAL(found != nullptr, value % 2 == 1);
+
+        if (found != nullptr)
+            BOOST_REQUIRE_EQUAL(*found, value);
+    }
+
+    // Erased slots are reused.
+    for (uint32_t value = 0; value < 100; value += 2)
+        BOOST_REQUIRE(instance.insert(make_key(value), value));
+
+    BOOST_REQUIRE_EQUAL(instance.size(), 100u);
+}
+
+BOOST_AUTO_TEST_CASE(flat_hash_map__clear__populated__empty_retains_capacity)
+{
+    flat_hash_map<hash_digest, size_t> instance;
+
+    for (uint32_t value = 0; value < 100; ++value)
+        instance.insert(make_key(value), value);
+
+    const auto capacity = instance.capacity();
+    instance.clear();
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE_EQUAL(instance.capacity(), capacity);
+    BOOST_REQUIRE(!instance.contains(make_key(1)));
+    BOOST_REQUIRE(instance.insert(make_key(1), 1));
+}
+
+BOOST_AUTO_TEST_CASE(flat_hash_map__shrink_to_fit__erased__capacity_released)
+{
+    flat_hash_map<hash_digest, size_t> instance;
+
+    for (uint32_t value = 0; value < 100; ++value)
+        instance.insert(make_key(value), value);
+
+    for (uint32_t value = 1; value < 100; ++value)
+        instance.erase(make_key(value));
+
+    const auto capacity = instance.capacity();
+    instance.shrink_to_fit();
+    BOOST_REQUIRE_LT(instance.capacity(), capacity);
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    BOOST_REQUIRE_EQUAL(*instance.find(make_key(0)), 0u);
+    instance.clear();
+    instance.shrink_to_fit();
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 0u);
+    BOOST_REQUIRE(!instance.contains(make_key(0)));
+}
+
+BOOST_AUTO_TEST_CASE(flat_hash_map__for_each__populated__each_entry)
+{
+    flat_hash_map<hash_digest, uint32_t> instance;
+
+    for (uint32_t value = 0; value < 100; ++value)
+        instance.insert(make_key(value), value);
+
+    size_t count = 0;
+    uint64_t sum = 0;
+    instance.for_each([&](const hash_digest& key, uint32_t value)
+    {
+        BOOST_REQUIRE(key == make_key(value));
+        sum += value;
+        ++count;
+    });
+
+    BOOST_REQUIRE_EQUAL(count, 100u);
+    BOOST_REQUIRE_EQUAL(sum, 4950u);
+}
+
+BOOST_AUTO_TEST_CASE(flat_hash_map__random_operations__same_as_unordered_map)
+{
+    std::mt19937 random(11);
+    flat_hash_map<hash_digest, uint32_t> instance;
+    std::unordered_map<hash_digest, uint32_t> expected;
+
+    for (uint32_t operation = 0; operation < 50000; ++operation)
+    {
+        const auto key = make_key(random() % 2000);
+
+        switch (random() % 3)
+        {
+            case 0:
+                BOOST_REQUIRE_EQUAL(instance.insert(key, operation),
+                    expected.emplace(key, operation).second);
+                break;
+            case 1:
+                BOOST_REQUIRE_EQUAL(instance.erase(key),
+                    expected.erase(key) != 0);
+                break;
+            default:
+            {
+                const auto found = instance.find(key);
+                const auto it = expected.find(key);
+                BOOST_REQUIRE_EQUAL(found != nullptr, it != expected.end());
+
+                if (found != nullptr)
+                    BOOST_REQUIRE_EQUAL(*found, it->second);
+            }
+        }
+
+        BOOST_REQUIRE_EQUAL(instance.size(), expected.size());
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
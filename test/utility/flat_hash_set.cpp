@@ -0,0 +1,69 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(flat_hash_set_tests)
+
+BOOST_AUTO_TEST_CASE(flat_hash_set__insert__duplicate__false)
+{
+    flat_hash_set<hash_digest> instance;
+    BOOST_REQUIRE(instance.insert(null_hash));
+    BOOST_REQUIRE(!instance.insert(null_hash));
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    BOOST_REQUIRE(instance.contains(null_hash));
+}
+
+BOOST_AUTO_TEST_CASE(flat_hash_set__erase__present__removed)
+{
+    flat_hash_set<hash_digest> instance(10);
+    BOOST_REQUIRE(instance.insert(null_hash));
+    BOOST_REQUIRE(instance.erase(null_hash));
+    BOOST_REQUIRE(!instance.erase(null_hash));
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE(!instance.contains(null_hash));
+}
+
+BOOST_AUTO_TEST_CASE(flat_hash_set__points__index__distinct)
+{
+    const auto hash = bitcoin_hash(to_chunk(std::string("points")));
+    flat_hash_set<chain::point> instance;
+
+    for (uint32_t index = 0; index < 1000; ++index)
+        BOOST_REQUIRE(instance.insert({ hash, index }));
+
+    BOOST_REQUIRE(!instance.insert(chain::output_point{ hash, 7 }));
+    BOOST_REQUIRE(instance.contains({ hash, 999 }));
+    BOOST_REQUIRE(!instance.contains({ hash, 1000 }));
+    BOOST_REQUIRE(!instance.contains({ null_hash, 0 }));
+
+    size_t count = 0;
+    instance.for_each([&count](const chain::point&) { ++count; });
+    BOOST_REQUIRE_EQUAL(count, 1000u);
+
+    instance.clear();
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,64 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(json_writer_tests)
+
+BOOST_AUTO_TEST_CASE(json_writer__write__nested__expected)
+{
+    std::string json;
+    json_writer writer(json);
+    writer.begin_object();
+    writer.write_key("a");
+    writer.write_value(42u);
+    writer.write_key("b");
+    writer.begin_array();
+    writer.write_value("x");
+    writer.begin_object();
+    writer.end_object();
+    writer.end_array();
+    writer.write_key("c");
+    writer.write_value("y");
+    writer.end_object();
+    BOOST_REQUIRE_EQUAL(json, "{\"a\":\"42\",\"b\":[\"x\",{}],\"c\":\"y\"}");
+}
+
+BOOST_AUTO_TEST_CASE(json_writer__write_value__escapes__property_tree_escapes)
+{
+    std::string json;
+    json_writer writer(json);
+    writer.write_value(std::string("a/\"\\\n\x01", 6));
+    BOOST_REQUIRE_EQUAL(json, "\"a\\/\\\"\\\\\\n\\u0001\"");
+}
+
+BOOST_AUTO_TEST_CASE(json_writer__write__reused_buffer__appends)
+{
+    std::string json;
+    json_writer first(json);
+    first.write_value(1u);
+    json.clear();
+    json_writer second(json);
+    second.write_value(2u);
+    BOOST_REQUIRE_EQUAL(json, "\"2\"");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,142 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(keyed_pending_tests)
+
+struct element
+{
+    typedef std::shared_ptr<element> ptr;
+
+    element(size_t id)
+      : key(id), stopped(error::success), closed(false)
+    {
+    }
+
+    void stop(const code& ec)
+    {
+        stopped = ec;
+    }
+
+    void close()
+    {
+        closed = true;
+    }
+
+    const size_t key;
+    code stopped;
+    bool closed;
+};
+
+struct key_of
+{
+    size_t operator()(const element& value) const
+    {
+        return value.key;
+    }
+};
+
+typedef keyed_pending<element, size_t, key_of> keyed;
+
+BOOST_AUTO_TEST_CASE(keyed_pending__store__unique__success)
+{
+    keyed instance(10);
+    BOOST_REQUIRE_EQUAL(instance.store(std::make_shared<element>(1)), error::success);
+    BOOST_REQUIRE_EQUAL(instance.store(std::make_shared<element>(2)), error::success);
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+    BOOST_REQUIRE(instance.exists(1));
+    BOOST_REQUIRE(instance.exists(2));
+    BOOST_REQUIRE(!instance.exists(3));
+}
+
+BOOST_AUTO_TEST_CASE(keyed_pending__store__duplicate_key__address_in_use)
+{
+    keyed instance(10);
+    const auto first = std::make_shared<element>(1);
+    BOOST_REQUIRE_EQUAL(instance.store(first), error::success);
+    BOOST_REQUIRE_EQUAL(instance.store(std::make_shared<element>(1)), error::address_in_use);
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    BOOST_REQUIRE(instance.find(1) == first);
+}
+
+BOOST_AUTO_TEST_CASE(keyed_pending__store__stopped__service_stopped)
+{
+    keyed instance(10);
+    instance.stop(error::channel_stopped);
+    BOOST_REQUIRE_EQUAL(instance.store(std::make_shared<element>(1)), error::service_stopped);
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(keyed_pending__remove__other_element_same_key__retained)
+{
+    keyed instance(10);
+    const auto first = std::make_shared<element>(1);
+    BOOST_REQUIRE_EQUAL(instance.store(first), error::success);
+    instance.remove(std::make_shared<element>(1));
+    BOOST_REQUIRE(instance.exists(1));
+    instance.remove(first);
+    BOOST_REQUIRE(!instance.exists(1));
+    BOOST_REQUIRE(!instance.find(1));
+}
+
+BOOST_AUTO_TEST_CASE(keyed_pending__remove_key__stored__returns_element)
+{
+    keyed instance(10);
+    const auto first = std::make_shared<element>(1);
+    BOOST_REQUIRE_EQUAL(instance.store(first), error::success);
+    BOOST_REQUIRE(instance.remove(1) == first);
+    BOOST_REQUIRE(!instance.remove(1));
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(keyed_pending__stop__stored__broadcast_once)
+{
+    keyed instance(10);
+    const auto first = std::make_shared<element>(1);
+    const auto second = std::make_shared<element>(2);
+    BOOST_REQUIRE_EQUAL(instance.store(first), error::success);
+    BOOST_REQUIRE_EQUAL(instance.store(second), error::success);
+
+    instance.stop(error::channel_stopped);
+    BOOST_REQUIRE_EQUAL(first->stopped, error::channel_stopped);
+    BOOST_REQUIRE_EQUAL(second->stopped, error::channel_stopped);
+
+    // Idempotent, elements are not stopped again.
+    instance.stop(error::service_stopped);
+    BOOST_REQUIRE_EQUAL(first->stopped, error::channel_stopped);
+    BOOST_REQUIRE_EQUAL(instance.collection().size(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(keyed_pending__close__stored__closed_and_cleared)
+{
+    keyed instance(10);
+    const auto first = std::make_shared<element>(1);
+    BOOST_REQUIRE_EQUAL(instance.store(first), error::success);
+    instance.close();
+    BOOST_REQUIRE(first->closed);
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
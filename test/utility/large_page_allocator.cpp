@@ -0,0 +1,147 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+// The policy is process-wide, so each case restores the default.
+struct large_pages_fixture
+{
+    ~large_pages_fixture()
+    {
+        large_pages::configure(large_pages::policy());
+    }
+};
+
+static const size_t table_size = size_t(4) << 20;
+
+static void configure(large_pages::mode pages)
+{
+    large_pages::policy policy;
+    policy.pages = pages;
+    large_pages::configure(policy);
+}
+
+BOOST_FIXTURE_TEST_SUITE(large_page_allocator_tests, large_pages_fixture)
+
+BOOST_AUTO_TEST_CASE(large_pages__allocate__default_policy__heap)
+{
+    const auto before = large_pages::current();
+    const auto address = large_pages::allocate(table_size);
+    BOOST_REQUIRE(large_pages::page_mode(address) == large_pages::mode::heap);
+    BOOST_REQUIRE_EQUAL(large_pages::current().standard, before.standard);
+    large_pages::deallocate(address, table_size);
+}
+
+BOOST_AUTO_TEST_CASE(large_pages__allocate__below_minimum__heap)
+{
+    configure(large_pages::mode::standard);
+    const auto address = large_pages::allocate(42);
+    BOOST_REQUIRE(large_pages::page_mode(address) == large_pages::mode::heap);
+    large_pages::deallocate(address, 42);
+}
+
+BOOST_AUTO_TEST_CASE(large_pages__allocate__standard__mapped_and_counted)
+{
+    configure(large_pages::mode::standard);
+    const auto before = large_pages::current().standard;
+    const auto address = large_pages::allocate(table_size);
+    std::memset(address, 0xff, table_size);
+
+#ifdef __linux__
+    BOOST_REQUIRE(large_pages::page_mode(address) ==
+        large_pages::mode::standard);
+    BOOST_REQUIRE_EQUAL(large_pages::current().standard, before + table_size);
+#endif
+
+    large_pages::deallocate(address, table_size);
+    BOOST_REQUIRE(large_pages::page_mode(address) == large_pages::mode::heap);
+    BOOST_REQUIRE_EQUAL(large_pages::current().standard, before);
+}
+
+BOOST_AUTO_TEST_CASE(large_pages__allocate__huge_unavailable__falls_back)
+{
+    // The system may not reserve huge pages or advise transparent pages.
+    configure(large_pages::mode::huge_1gb);
+    const auto address = large_pages::allocate(table_size);
+    std::memset(address, 0xff, table_size);
+
+    const auto mode = large_pages::page_mode(address);
+    BOOST_REQUIRE(mode != large_pages::mode::huge_1gb);
+
+#ifdef __linux__
+    BOOST_REQUIRE(mode != large_pages::mode::heap);
+    BOOST_REQUIRE_EQUAL(reinterpret_cast<uintptr_t>(address) % 4096, 0u);
+#endif
+
+    BOOST_REQUIRE_GT(large_pages::current().page_fallbacks, 0u);
+    large_pages::deallocate(address, table_size);
+}
+
+BOOST_AUTO_TEST_CASE(large_pages__to_string__modes__expected)
+{
+    BOOST_REQUIRE_EQUAL(large_pages::to_string(large_pages::mode::heap),
+        "heap");
+    BOOST_REQUIRE_EQUAL(large_pages::to_string(large_pages::mode::standard),
+        "standard");
+    BOOST_REQUIRE_EQUAL(large_pages::to_string(
+        large_pages::mode::transparent), "transparent");
+    BOOST_REQUIRE_EQUAL(large_pages::to_string(large_pages::mode::huge_2mb),
+        "huge_2mb");
+    BOOST_REQUIRE_EQUAL(large_pages::to_string(large_pages::mode::huge_1gb),
+        "huge_1gb");
+}
+
+BOOST_AUTO_TEST_CASE(large_pages__publish__metrics__gauges_set)
+{
+    log::metrics metrics;
+    large_pages::publish(metrics);
+    std::string lines;
+
+    for (const auto& datagram: metrics.collect("bc.", 1400))
+        lines += datagram + "\n";
+
+    BOOST_REQUIRE(lines.find("bc.pages.standard:") != std::string::npos);
+    BOOST_REQUIRE(lines.find("bc.pages.transparent:") != std::string::npos);
+    BOOST_REQUIRE(lines.find("bc.pages.huge_2mb:") != std::string::npos);
+    BOOST_REQUIRE(lines.find("bc.pages.huge_1gb:") != std::string::npos);
+    BOOST_REQUIRE(lines.find("bc.pages.page_fallbacks:") != std::string::npos);
+    BOOST_REQUIRE(lines.find("bc.pages.numa_fallbacks:") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(large_page_allocator__vector__push_back__expected)
+{
+    configure(large_pages::mode::transparent);
+    std::vector<uint32_t, large_page_allocator<uint32_t>> values;
+
+    for (uint32_t value = 0; value < table_size; ++value)
+        values.push_back(value);
+
+    for (uint32_t value = 0; value < table_size; ++value)
+        BOOST_REQUIRE_EQUAL(values[value], value);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,133 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <string>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(memory_budget_tests)
+
+// A cache of fixed usage, up to its limit.
+struct test_cache
+{
+    memory_budget::participant participant(const std::string& name,
+        size_t weight, size_t priority)
+    {
+        return
+        {
+            name, weight, priority,
+            [this]() { return std::min(used, limit); },
+            [this](size_t bytes) { limit = bytes; ++resizes; }
+        };
+    }
+
+    size_t used = 0;
+    size_t limit = max_size_t;
+    size_t resizes = 0;
+};
+
+BOOST_AUTO_TEST_CASE(memory_budget__enroll__zero_total__unmanaged)
+{
+    test_cache cache;
+    memory_budget instance;
+    instance.enroll(cache.participant("cache", 1, 1));
+    BOOST_REQUIRE_EQUAL(instance.total(), 0u);
+    BOOST_REQUIRE_EQUAL(cache.resizes, 0u);
+    BOOST_REQUIRE_EQUAL(cache.limit, max_size_t);
+}
+
+BOOST_AUTO_TEST_CASE(memory_budget__set_total__weights__shared_by_weight)
+{
+    test_cache first;
+    test_cache second;
+    memory_budget instance(1000);
+    instance.enroll(first.participant("first", 1, 1));
+    BOOST_REQUIRE_EQUAL(first.limit, 1000u);
+
+    const auto token = instance.enroll(second.participant("second", 3, 1));
+    BOOST_REQUIRE_EQUAL(first.limit, 250u);
+    BOOST_REQUIRE_EQUAL(second.limit, 750u);
+
+    instance.set_total(2000);
+    BOOST_REQUIRE_EQUAL(first.limit, 500u);
+    BOOST_REQUIRE_EQUAL(second.limit, 1500u);
+
+    BOOST_REQUIRE(instance.withdraw(token));
+    BOOST_REQUIRE(!instance.withdraw(token));
+    BOOST_REQUIRE_EQUAL(first.limit, 2000u);
+}
+
+BOOST_AUTO_TEST_CASE(memory_budget__shrink__priorities__lowest_first)
+{
+    test_cache low;
+    test_cache high;
+    low.used = 300;
+    high.used = 400;
+    memory_budget instance(1000);
+    instance.enroll(high.participant("high", 1, 2));
+    instance.enroll(low.participant("low", 1, 1));
+    BOOST_REQUIRE_EQUAL(instance.usage(), 700u);
+
+    BOOST_REQUIRE_EQUAL(instance.shrink(200), 200u);
+    BOOST_REQUIRE_EQUAL(low.limit, 100u);
+    BOOST_REQUIRE_EQUAL(high.limit, 500u);
+
+    BOOST_REQUIRE_EQUAL(instance.shrink(300), 300u);
+    BOOST_REQUIRE_EQUAL(low.limit, 0u);
+    BOOST_REQUIRE_EQUAL(high.limit, 200u);
+
+    // Only the bytes in use can be released.
+    BOOST_REQUIRE_EQUAL(instance.shrink(1000), 200u);
+    BOOST_REQUIRE_EQUAL(instance.usage(), 0u);
+
+    // Rebalance restores the shares.
+    instance.rebalance();
+    BOOST_REQUIRE_EQUAL(low.limit, 500u);
+    BOOST_REQUIRE_EQUAL(instance.usage(), 700u);
+}
+
+BOOST_AUTO_TEST_CASE(memory_budget__state__enrolled__in_enrollment_order)
+{
+    test_cache first;
+    test_cache second;
+    first.used = 10;
+    memory_budget instance(100);
+    instance.enroll(first.participant("first", 1, 1));
+    instance.enroll(second.participant("second", 1, 1));
+
+    const auto state = instance.state();
+    BOOST_REQUIRE_EQUAL(state.size(), 2u);
+    BOOST_REQUIRE_EQUAL(state[0].name, "first");
+    BOOST_REQUIRE_EQUAL(state[0].limit, 50u);
+    BOOST_REQUIRE_EQUAL(state[0].usage, 10u);
+    BOOST_REQUIRE_EQUAL(state[1].name, "second");
+}
+
+BOOST_AUTO_TEST_CASE(memory_budget__process__enrolled__library_caches)
+{
+    const auto state = memory_budget::process().state();
+    BOOST_REQUIRE_EQUAL(state.size(), 2u);
+    BOOST_REQUIRE_EQUAL(state[0].name, "public keys");
+    BOOST_REQUIRE_EQUAL(state[1].name, "redeem scripts");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,99 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(monitor_tests)
+
+BOOST_AUTO_TEST_CASE(monitor__histogram__record__expected_buckets)
+{
+    monitor::histogram instance;
+    instance.record(monitor::duration(0));
+    instance.record(monitor::duration(1));
+    instance.record(monitor::duration(2));
+    instance.record(monitor::duration(3));
+    instance.record(monitor::duration(1000));
+    BOOST_REQUIRE_EQUAL(instance.bucket(0), 1u);
+    BOOST_REQUIRE_EQUAL(instance.bucket(1), 1u);
+    BOOST_REQUIRE_EQUAL(instance.bucket(2), 2u);
+    BOOST_REQUIRE_EQUAL(instance.bucket(10), 1u);
+    BOOST_REQUIRE_EQUAL(instance.samples(), 5u);
+    BOOST_REQUIRE_EQUAL(instance.total().count(), 1006);
+}
+
+BOOST_AUTO_TEST_CASE(monitor__histogram__record_maximum__last_bucket)
+{
+    monitor::histogram instance;
+    instance.record(monitor::duration::max());
+    BOOST_REQUIRE_EQUAL(instance.bucket(monitor::histogram::buckets - 1), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(monitor__track__invoke__counted)
+{
+    const auto instance = std::make_shared<monitor>("test");
+    size_t calls = 0;
+    auto handler = monitor::track(instance, [&calls]() { ++calls; });
+    BOOST_REQUIRE_EQUAL(instance->name(), "test");
+    BOOST_REQUIRE_EQUAL(instance->backlog(), 1u);
+    BOOST_REQUIRE_EQUAL(instance->started(), 0u);
+
+    handler();
+    BOOST_REQUIRE_EQUAL(calls, 1u);
+    BOOST_REQUIRE_EQUAL(instance->backlog(), 0u);
+    BOOST_REQUIRE_EQUAL(instance->running(), 0u);
+    BOOST_REQUIRE_EQUAL(instance->started(), 1u);
+    BOOST_REQUIRE_EQUAL(instance->latency().samples(), 1u);
+    BOOST_REQUIRE_EQUAL(instance->runtime().samples(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(monitor__dispatcher_ordered__blocked_strand__backlog)
+{
+    threadpool pool(1);
+    dispatcher dispatch(pool, "test");
+    std::promise<void> blocked;
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    std::promise<void> complete;
+
+    dispatch.ordered([&blocked, released]()
+    {
+        blocked.set_value();
+        released.wait();
+    });
+
+    blocked.get_future().wait();
+    dispatch.ordered([&complete]() { complete.set_value(); });
+    BOOST_REQUIRE_EQUAL(dispatch.ordered_backlog(), 1u);
+    BOOST_REQUIRE_EQUAL(dispatch.combined_backlog(), 1u);
+
+    release.set_value();
+    complete.get_future().wait();
+    pool.shutdown();
+    pool.join();
+    BOOST_REQUIRE_EQUAL(dispatch.ordered_backlog(), 0u);
+    BOOST_REQUIRE_EQUAL(dispatch.combined_backlog(), 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
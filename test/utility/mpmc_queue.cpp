@@ -0,0 +1,309 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(mpmc_queue_tests)
+
+BOOST_AUTO_TEST_CASE(mpmc_queue__capacity__not_power_of_two__rounded_up)
+{
+    BOOST_REQUIRE_EQUAL(mpmc_queue<size_t>(0).capacity(), 2u);
+    BOOST_REQUIRE_EQUAL(mpmc_queue<size_t>(5).capacity(), 8u);
+    BOOST_REQUIRE_EQUAL(mpmc_queue<size_t>(16).capacity(), 16u);
+}
+
+BOOST_AUTO_TEST_CASE(mpmc_queue__try_pop__empty__false)
+{
+    mpmc_queue<size_t> instance(4);
+    size_t value;
+    mpmc_queue<size_t>::list values;
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE(!instance.try_pop(value));
+    BOOST_REQUIRE_EQUAL(instance.try_pop(values, 4), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(mpmc_queue__try_push__full__false)
+{
+    mpmc_queue<std::string> instance(2);
+    BOOST_REQUIRE(instance.try_push("a"));
+    BOOST_REQUIRE(instance.try_push(std::string("b")));
+    BOOST_REQUIRE(!instance.try_push("c"));
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+
+    std::string value;
+    BOOST_REQUIRE(instance.try_pop(value));
+    BOOST_REQUIRE_EQUAL(value, "a");
+    BOOST_REQUIRE(instance.try_push("c"));
+    BOOST_REQUIRE(instance.try_pop(value));
+    BOOST_REQUIRE_EQUAL(value, "b");
+    BOOST_REQUIRE(instance.try_pop(value));
+    BOOST_REQUIRE_EQUAL(value, "c");
+    BOOST_REQUIRE(instance.empty());
+}
+
+BOOST_AUTO_TEST_CASE(mpmc_queue__try_push_batch__exceeds_capacity__partial)
+{
+    mpmc_queue<size_t> instance(4);
+    const std::vector<size_t> values{ 1, 2, 3, 4, 5, 6 };
+    BOOST_REQUIRE_EQUAL(instance.try_push(values.begin(), values.end()), 4u);
+    BOOST_REQUIRE_EQUAL(instance.try_push(values.begin(), values.end()), 0u);
+
+    mpmc_queue<size_t>::list out;
+    BOOST_REQUIRE_EQUAL(instance.try_pop(out, 3), 3u);
+    BOOST_REQUIRE_EQUAL(instance.try_pop(out, 3), 1u);
+    BOOST_REQUIRE(out == mpmc_queue<size_t>::list({ 1, 2, 3, 4 }));
+}
+
+BOOST_AUTO_TEST_CASE(mpmc_queue__try_push_batch__move_iterator__moved)
+{
+    mpmc_queue<std::string> instance(4);
+    std::vector<std::string> values{ "a", "b" };
+    BOOST_REQUIRE_EQUAL(instance.try_push(std::make_move_iterator(
+        values.begin()), std::make_move_iterator(values.end())), 2u);
+
+    std::string value;
+    BOOST_REQUIRE(instance.try_pop(value));
+    BOOST_REQUIRE_EQUAL(value, "a");
+}
+
+BOOST_AUTO_TEST_CASE(mpmc_queue__close__queued__drained_then_false)
+{
+    mpmc_queue<size_t> instance(4);
+    BOOST_REQUIRE(instance.push(size_t(42)));
+    instance.close();
+    BOOST_REQUIRE(instance.closed());
+    BOOST_REQUIRE(!instance.try_push(size_t(1)));
+    BOOST_REQUIRE(!instance.push(size_t(1)));
+
+    size_t value;
+    BOOST_REQUIRE(instance.pop(value));
+    BOOST_REQUIRE_EQUAL(value, 42u);
+    BOOST_REQUIRE(!instance.pop(value));
+
+    mpmc_queue<size_t>::list values;
+    BOOST_REQUIRE_EQUAL(instance.pop(values, 4), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(mpmc_queue__pop__blocked_consumer__woken_by_push)
+{
+    mpmc_queue<size_t> instance(4);
+    auto popped = std::async(std::launch::async, [&instance]()
+    {
+        size_t value = 0;
+        return instance.pop(value) ? value : 0;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    BOOST_REQUIRE(instance.push(size_t(42)));
+    BOOST_REQUIRE_EQUAL(popped.get(), 42u);
+}
+
+BOOST_AUTO_TEST_CASE(mpmc_queue__pop__blocked_consumer__woken_by_close)
+{
+    mpmc_queue<size_t> instance(4);
+    auto popped = std::async(std::launch::async, [&instance]()
+    {
+        size_t value;
+        return instance.pop(value);
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    instance.close();
+    BOOST_REQUIRE(!popped.get());
+}
+
+BOOST_AUTO_TEST_CASE(mpmc_queue__push__blocked_producer__woken_by_pop)
+{
+    mpmc_queue<size_t> instance(2);
+    const std::vector<size_t> values{ 1, 2, 3, 4, 5 };
+    auto pushed = std::async(std::launch::async, [&]()
+    {
+        return instance.push(values.begin(), values.end());
+    });
+
+    mpmc_queue<size_t>::list out;
+    while (out.size() < values.size())
+        instance.pop(out, values.size());
+
+    BOOST_REQUIRE_EQUAL(pushed.get(), values.size());
+    BOOST_REQUIRE(out == values);
+}
+
+BOOST_AUTO_TEST_CASE(mpmc_queue__push_pop__concurrent__all_once_in_producer_order)
+{
+    static const size_t producers = 4;
+    static const size_t consumers = 4;
+    static const size_t count = 20000;
+    mpmc_queue<size_t> instance(64);
+    std::vector<std::thread> threads;
+    std::vector<std::vector<size_t>> received(consumers);
+
+    for (size_t producer = 0; producer < producers; ++producer)
+    {
+        threads.emplace_back([&, producer]()
+        {
+            std::vector<size_t> batch;
+            for (size_t index = 0; index < count; ++index)
+            {
+                batch.push_back(producer * count + index);
+
+                if (batch.size() == 7 || index + 1 == count)
+                {
+                    instance.push(batch.begin(), batch.end());
+                    batch.clear();
+                }
+            }
+        });
+    }
+
+    for (size_t consumer = 0; consumer < consumers; ++consumer)
+    {
+        threads.emplace_back([&, consumer]()
+        {
+            size_t value;
+            mpmc_queue<size_t>::list values;
+
+            while (consumer % 2 == 0 ? instance.pop(values, 5) != 0 :
+                instance.pop(value))
+            {
+                if (consumer % 2 != 0)
+                    values.push_back(value);
+
+                received[consumer].insert(received[consumer].end(),
+                    values.begin(), values.end());
+                values.clear();
+            }
+        });
+    }
+
+    for (size_t producer = 0; producer < producers; ++producer)
+        threads[producer].join();
+
+    instance.close();
+
+    for (size_t consumer = 0; consumer < consumers; ++consumer)
+        threads[producers + consumer].join();
+
+    // Each value is popped once, and each consumer sees each producer's
+    // values in the order pushed.
+    std::vector<size_t> seen(producers * count, 0);
+
+    for (const auto& values: received)
+    {
+        std::vector<size_t> last(producers, 0);
+        std::vector<bool> first(producers, true);
+
+        for (const auto value: values)
+        {
+            const auto producer = value / count;
+            BOOST_REQUIRE(first[producer] || value > last[producer]);
+            first[producer] = false;
+            last[producer] = value;
+            ++seen[value];
+        }
+    }
+
+    for (const auto times: seen)
+        BOOST_REQUIRE_EQUAL(times, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(mpmc_queue__pop_pool__empty__parked_until_push)
+{
+    threadpool pool(2);
+    mpmc_queue<size_t> instance(4);
+    std::promise<size_t> popped;
+
+    instance.pop(pool, [&popped](const code& ec, size_t value)
+    {
+        popped.set_value(ec ? 0 : value);
+    });
+
+    BOOST_REQUIRE(instance.push(size_t(42)));
+    BOOST_REQUIRE_EQUAL(popped.get_future().get(), 42u);
+
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(mpmc_queue__pop_pool__closed__service_stopped)
+{
+    threadpool pool(1);
+    mpmc_queue<size_t> instance(4);
+    std::promise<code> popped;
+
+    instance.pop(pool, [&popped](const code& ec, size_t)
+    {
+        popped.set_value(ec);
+    });
+
+    instance.close();
+    BOOST_REQUIRE_EQUAL(popped.get_future().get(), error::service_stopped);
+
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(mpmc_queue__pop_pool__consumers__all_values_delivered)
+{
+    static const size_t count = 10000;
+    threadpool pool(4);
+    mpmc_queue<size_t> instance(32);
+    std::atomic<size_t> total(0);
+    std::atomic<size_t> delivered(0);
+    std::promise<void> done;
+
+    // Each consumer pops again after each value, parking while empty.
+    std::function<void(const code&, size_t)> consume =
+        [&](const code& ec, size_t value)
+        {
+            if (ec)
+                return;
+
+            total += value;
+            if (++delivered == count)
+                done.set_value();
+
+            instance.pop(pool, consume);
+        };
+
+    for (size_t consumer = 0; consumer < 3; ++consumer)
+        instance.pop(pool, consume);
+
+    for (size_t value = 1; value <= count; ++value)
+        BOOST_REQUIRE(instance.push(value));
+
+    done.get_future().get();
+    BOOST_REQUIRE_EQUAL(total.load(), count * (count + 1) / 2);
+
+    instance.close();
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,164 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(once_cell_tests)
+
+BOOST_AUTO_TEST_CASE(once_cell__constructor__default__empty)
+{
+    const once_cell<size_t> instance;
+    BOOST_REQUIRE(!instance);
+}
+
+BOOST_AUTO_TEST_CASE(once_cell__get__twice__factory_invoked_once)
+{
+    size_t calls = 0;
+    const once_cell<size_t> instance;
+    const auto factory = [&calls]() { return ++calls + 41; };
+    BOOST_REQUIRE_EQUAL(instance.get(factory), 42u);
+    BOOST_REQUIRE_EQUAL(instance.get(factory), 42u);
+    BOOST_REQUIRE_EQUAL(calls, 1u);
+    BOOST_REQUIRE(instance);
+}
+
+BOOST_AUTO_TEST_CASE(once_cell__set__set__false)
+{
+    const once_cell<size_t> instance;
+    BOOST_REQUIRE(instance.set(42u));
+    BOOST_REQUIRE(!instance.set(24u));
+    BOOST_REQUIRE_EQUAL(instance.get([]() { return size_t(0); }), 42u);
+}
+
+BOOST_AUTO_TEST_CASE(once_cell__reset__set__recomputes)
+{
+    const once_cell<data_chunk> instance;
+    instance.set(data_chunk{ 1, 2, 3 });
+    instance.reset();
+    BOOST_REQUIRE(!instance);
+    BOOST_REQUIRE(instance.get([]() { return data_chunk{ 4 }; }) == data_chunk{ 4 });
+}
+
+BOOST_AUTO_TEST_CASE(once_cell__copy__set__copies_value)
+{
+    once_cell<data_chunk> instance;
+    instance.set(data_chunk{ 1, 2, 3 });
+    const auto copy = instance;
+    BOOST_REQUIRE(copy);
+    BOOST_REQUIRE(copy.get([]() { return data_chunk{}; }) == (data_chunk{ 1, 2, 3 }));
+}
+
+BOOST_AUTO_TEST_CASE(once_cell__move__set__moves_value)
+{
+    once_cell<data_chunk> instance;
+    instance.set(data_chunk{ 1, 2, 3 });
+    const auto moved = std::move(instance);
+    BOOST_REQUIRE(moved);
+    BOOST_REQUIRE(!instance);
+    BOOST_REQUIRE(moved.get([]() { return data_chunk{}; }) == (data_chunk{ 1, 2, 3 }));
+}
+
+BOOST_AUTO_TEST_CASE(once_cell__get__concurrent__factory_invoked_once)
+{
+    static const size_t threads = 8;
+    std::atomic<size_t> calls(0);
+    const once_cell<size_t> instance;
+    std::vector<std::thread> workers;
+    std::vector<size_t> results(threads, 0);
+
+    for (size_t index = 0; index < threads; ++index)
+        workers.emplace_back([&, index]()
+        {
+            results[index] = instance.get([&calls]()
+            {
+                return ++calls + 41;
+            });
+        });
+
+    for (auto& worker: workers)
+        worker.join();
+
+    BOOST_REQUIRE_EQUAL(calls.load(), 1u);
+
+    for (const auto result: results)
+        BOOST_REQUIRE_EQUAL(result, 42u);
+}
+
+BOOST_AUTO_TEST_CASE(once_cell__get__factory_throws__empty_then_recomputes)
+{
+    const once_cell<size_t> instance;
+    BOOST_REQUIRE_THROW(instance.get([]() -> size_t
+    {
+        throw std::runtime_error("factory");
+    }), std::runtime_error);
+
+    BOOST_REQUIRE(!instance);
+    BOOST_REQUIRE_EQUAL(instance.get([]() { return size_t(42); }), 42u);
+}
+
+BOOST_AUTO_TEST_CASE(once_cell__get__concurrent_factory_throws__waiting_reader_computes)
+{
+    std::atomic<bool> claimed(false);
+    std::atomic<bool> release(false);
+    const once_cell<size_t> instance;
+
+    std::thread thrower([&]()
+    {
+        try
+        {
+            instance.get([&]() -> size_t
+            {
+                claimed.store(true);
+
+                while (!release.load())
+                    std::this_thread::yield();
+
+                throw std::runtime_error("factory");
+            });
+        }
+        catch (const std::runtime_error&)
+        {
+        }
+    });
+
+    while (!claimed.load())
+        std::this_thread::yield();
+
+    // The reader waits on the busy cell until the factory throws.
+    size_t result = 0;
+    std::thread reader([&]()
+    {
+        result = instance.get([]() { return size_t(42); });
+    });
+
+    release.store(true);
+    thrower.join();
+    reader.join();
+    BOOST_REQUIRE_EQUAL(result, 42u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,78 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(packed_strings_tests)
+
+static const char test_strings[] = "alpha\0" "\0" "gamma";
+static const uint16_t test_offsets[3] = { 0, 6, 7 };
+static const packed_strings<3> test_list{ test_strings, test_offsets };
+
+BOOST_AUTO_TEST_CASE(packed_strings__subscript__always__expected)
+{
+    BOOST_REQUIRE_EQUAL(test_list.size(), 3u);
+    BOOST_REQUIRE_EQUAL(test_list[0], "alpha");
+    BOOST_REQUIRE_EQUAL(test_list[1], "");
+    BOOST_REQUIRE_EQUAL(test_list[2], "gamma");
+}
+
+BOOST_AUTO_TEST_CASE(packed_strings__iterators__always__expected)
+{
+    BOOST_REQUIRE_EQUAL(std::distance(test_list.begin(), test_list.end()), 3);
+    BOOST_REQUIRE_EQUAL(test_list.begin()[2], "gamma");
+    BOOST_REQUIRE_EQUAL(*(test_list.end() - 1), "gamma");
+
+    std::vector<std::string> strings(test_list.begin(), test_list.end());
+    BOOST_REQUIRE_EQUAL(strings.size(), 3u);
+    BOOST_REQUIRE_EQUAL(strings[0], "alpha");
+    BOOST_REQUIRE_EQUAL(find_position(test_list, std::string("gamma")), 2);
+    BOOST_REQUIRE_EQUAL(find_position(test_list, std::string("beta")), -1);
+}
+
+BOOST_AUTO_TEST_CASE(packed_strings__equality__same_strings__equal)
+{
+    static const char other_strings[] = "\0alpha\0\0gamma";
+    static const uint16_t other_offsets[3] = { 1, 7, 8 };
+    const packed_strings<3> other{ other_strings, other_offsets };
+    const packed_strings<3> different{ other_strings, test_offsets };
+    BOOST_REQUIRE(test_list == other);
+    BOOST_REQUIRE(test_list != different);
+}
+
+BOOST_AUTO_TEST_CASE(packed_strings__dictionary__all_languages__dictionary_size)
+{
+    for (const auto lexicon: wallet::language::all)
+    {
+        BOOST_REQUIRE_EQUAL(lexicon->size(), wallet::dictionary_size);
+        BOOST_REQUIRE(std::none_of(lexicon->begin(), lexicon->end(),
+            [](const char* word) { return std::strlen(word) == 0; }));
+    }
+
+    BOOST_REQUIRE_EQUAL(wallet::language::en[0], "abandon");
+    BOOST_REQUIRE_EQUAL(wallet::language::en[2047], "zoo");
+    BOOST_REQUIRE_EQUAL(wallet::language::electrum::en_v1[1625], "weary");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,161 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(parallel_tests)
+
+BOOST_AUTO_TEST_CASE(parallel__parallel_for__empty_pool__serial_all_invoked)
+{
+    threadpool pool;
+    std::vector<size_t> visits(10, 0);
+    const auto visit = [&visits](size_t index)
+    {
+        ++visits[index];
+        return code(error::success);
+    };
+
+    BOOST_REQUIRE_EQUAL(parallel_for(pool, visits.size(), 3, visit).value(), error::success);
+    BOOST_REQUIRE(visits == std::vector<size_t>(10, 1));
+}
+
+BOOST_AUTO_TEST_CASE(parallel__parallel_for__pool__each_invoked_once)
+{
+    threadpool pool(4);
+    std::vector<std::atomic<size_t>> visits(1000);
+    for (auto& visit: visits)
+        visit.store(0);
+
+    const auto visit = [&visits](size_t index)
+    {
+        ++visits[index];
+        return code(error::success);
+    };
+
+    BOOST_REQUIRE_EQUAL(parallel_for(pool, visits.size(), 7, visit).value(), error::success);
+
+    for (const auto& visit: visits)
+        BOOST_REQUIRE_EQUAL(visit.load(), 1u);
+
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(parallel__parallel_for__pool_failures__earliest_failure)
+{
+    threadpool pool(4);
+    std::vector<std::atomic<bool>> visited(1000);
+    for (auto& visit: visited)
+        visit.store(false);
+
+    const auto fail = [&visited](size_t index)
+    {
+        visited[index] = true;
+
+        if (index == 300)
+            return code(error::bad_stream);
+
+        if (index > 300 && index % 10 == 0)
+            return code(error::operation_failed);
+
+        return code(error::success);
+    };
+
+    BOOST_REQUIRE_EQUAL(parallel_for(pool, visited.size(), 5, fail).value(), error::bad_stream);
+
+    // All indexes preceding the failure have completed.
+    for (size_t index = 0; index < 300; ++index)
+        BOOST_REQUIRE(visited[index].load());
+
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(parallel__parallel_for__pool_throws__earliest_rethrown)
+{
+    threadpool pool(4);
+    const auto thrower = [](size_t index)
+    {
+        if (index == 500)
+            throw std::runtime_error("first");
+
+        if (index > 500)
+            throw std::logic_error("later");
+
+        return code(error::success);
+    };
+
+    try
+    {
+        parallel_for(pool, 1000, 10, thrower);
+        BOOST_FAIL("expected exception");
+    }
+    catch (const std::runtime_error& ex)
+    {
+        BOOST_REQUIRE_EQUAL(std::string(ex.what()), "first");
+    }
+
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(parallel__parallel_reduce__pool_sum__expected)
+{
+    threadpool pool(4);
+    const auto map = [](size_t index) { return uint64_t(index); };
+    const auto add = [](uint64_t left, uint64_t right) { return left + right; };
+    BOOST_REQUIRE_EQUAL(parallel_reduce(pool, 1001, 16, uint64_t{ 0 }, map, add), 500500u);
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(parallel__parallel_reduce__non_commutative__ordered)
+{
+    threadpool pool(4);
+    const auto map = [](size_t index) { return std::string(1, char('a' + index % 26)); };
+    const auto concatenate = [](std::string left, const std::string& right) { return left + right; };
+
+    std::string expected;
+    for (size_t index = 0; index < 260; ++index)
+        expected += char('a' + index % 26);
+
+    BOOST_REQUIRE_EQUAL(parallel_reduce(pool, 260, 3, std::string(), map, concatenate), expected);
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(parallel__parallel_reduce__empty__identity)
+{
+    threadpool pool(2);
+    const auto map = [](size_t) { return true; };
+    const auto all = [](bool left, bool right) { return left && right; };
+    BOOST_REQUIRE(parallel_reduce(pool, 0, 1, true, map, all));
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
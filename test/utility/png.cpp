@@ -144,6 +144,113 @@ BOOST_AUTO_TEST_CASE(png__size_one__success)
     BOOST_REQUIRE_EQUAL(std::memcmp(out.data(), expected_data, expected_data_length), 0);
 }
 
+// An encoded qrcode of alternating modules.
+static data_chunk get_qrcode(uint32_t width)
+{
+    data_chunk out;
+    byte_writer sink(out);
+    sink.write_4_bytes_little_endian(1);
+    sink.write_4_bytes_little_endian(width);
+
+    for (size_t module = 0; module < width * width; ++module)
+        sink.write_byte(module % 3 == 0 ? 0x01 : 0x00);
+
+    return out;
+}
+
+BOOST_AUTO_TEST_CASE(png_writer__write__default_options__write_png)
+{
+    const auto qrcode = get_qrcode(21);
+
+    data_chunk expected;
+    data_sink expected_stream(expected);
+    BOOST_REQUIRE(png::write_png(qrcode, 2, expected_stream));
+
+    data_chunk out;
+    data_sink ostream(out);
+    png_writer writer(png_writer::options(2));
+    BOOST_REQUIRE(writer.write(qrcode, ostream));
+    BOOST_REQUIRE(out == expected);
+}
+
+BOOST_AUTO_TEST_CASE(png_writer__write__stream__same_as_chunk)
+{
+    const auto qrcode = get_qrcode(21);
+    png_writer writer(png_writer::options(3));
+
+    data_chunk expected;
+    data_sink expected_stream(expected);
+    BOOST_REQUIRE(writer.write(qrcode, expected_stream));
+
+    data_chunk out;
+    data_sink ostream(out);
+    data_source istream(qrcode);
+    BOOST_REQUIRE(writer.write(istream, ostream));
+    BOOST_REQUIRE(out == expected);
+}
+
+BOOST_AUTO_TEST_CASE(png_writer__write__reused__same_images)
+{
+    png_writer writer(png_writer::options(4));
+    const auto small = get_qrcode(21);
+    const auto large = get_qrcode(33);
+
+    data_chunk first;
+    data_sink first_stream(first);
+    BOOST_REQUIRE(writer.write(large, first_stream));
+
+    data_chunk second;
+    data_sink second_stream(second);
+    BOOST_REQUIRE(writer.write(small, second_stream));
+
+    data_chunk third;
+    data_sink third_stream(third);
+    BOOST_REQUIRE(writer.write(large, third_stream));
+    BOOST_REQUIRE(third == first);
+    BOOST_REQUIRE(second != first);
+}
+
+BOOST_AUTO_TEST_CASE(png_writer__write__compression_settings__smaller_than_stored)
+{
+    const auto qrcode = get_qrcode(33);
+
+    png_writer::options stored(4);
+    stored.level = 0;
+
+    png_writer::options compressed(4);
+    compressed.level = 9;
+    compressed.filters = PNG_FILTER_NONE;
+    compressed.strategy = 3;
+
+    data_chunk large;
+    data_sink large_stream(large);
+    BOOST_REQUIRE(png_writer(stored).write(qrcode, large_stream));
+
+    data_chunk small;
+    data_sink small_stream(small);
+    BOOST_REQUIRE(png_writer(compressed).write(qrcode, small_stream));
+    BOOST_REQUIRE_LT(small.size(), large.size());
+}
+
+BOOST_AUTO_TEST_CASE(png_writer__write__truncated__false)
+{
+    auto qrcode = get_qrcode(21);
+    qrcode.pop_back();
+
+    data_chunk out;
+    data_sink ostream(out);
+    png_writer writer(png_writer::options(1));
+    BOOST_REQUIRE(!writer.write(qrcode, ostream));
+}
+
+BOOST_AUTO_TEST_CASE(png_writer__write__zero_size__false)
+{
+    data_chunk out;
+    data_sink ostream(out);
+    png_writer writer(png_writer::options(0));
+    BOOST_REQUIRE(!writer.write(get_qrcode(21), ostream));
+}
+
 #endif // WITH_PNG
 
 BOOST_AUTO_TEST_SUITE_END()
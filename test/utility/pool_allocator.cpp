@@ -0,0 +1,85 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(pool_allocator_tests)
+
+BOOST_AUTO_TEST_CASE(chunk_pool__size_class__common_sizes__smallest_fit)
+{
+    BOOST_REQUIRE_EQUAL(chunk_pool::class_size(chunk_pool::size_class(1)), 16u);
+    BOOST_REQUIRE_EQUAL(chunk_pool::class_size(chunk_pool::size_class(20)), 24u);
+    BOOST_REQUIRE_EQUAL(chunk_pool::class_size(chunk_pool::size_class(25)), 32u);
+    BOOST_REQUIRE_EQUAL(chunk_pool::class_size(chunk_pool::size_class(33)), 40u);
+    BOOST_REQUIRE_EQUAL(chunk_pool::class_size(chunk_pool::size_class(34)), 40u);
+    BOOST_REQUIRE_EQUAL(chunk_pool::class_size(chunk_pool::size_class(72)), 80u);
+    BOOST_REQUIRE_EQUAL(chunk_pool::class_size(chunk_pool::size_class(128)), 128u);
+}
+
+BOOST_AUTO_TEST_CASE(chunk_pool__size_class__zero_or_large__not_pooled)
+{
+    BOOST_REQUIRE_EQUAL(chunk_pool::size_class(0), chunk_pool::classes);
+    BOOST_REQUIRE_EQUAL(chunk_pool::size_class(chunk_pool::maximum + 1),
+        chunk_pool::classes);
+}
+
+BOOST_AUTO_TEST_CASE(chunk_pool__allocate__after_deallocate__reuses_buffer)
+{
+    const auto first = chunk_pool::allocate(33);
+    chunk_pool::deallocate(first, 33);
+
+    // A 34 byte buffer is of the same class, so is taken from the cache.
+    const auto second = chunk_pool::allocate(34);
+    BOOST_REQUIRE(first == second);
+    chunk_pool::deallocate(second, 34);
+}
+
+BOOST_AUTO_TEST_CASE(pool_allocator__vector__push_back__expected)
+{
+    pooled_chunk instance;
+
+    for (uint8_t byte = 0; byte < 200; ++byte)
+        instance.push_back(byte);
+
+    BOOST_REQUIRE_EQUAL(instance.size(), 200u);
+    BOOST_REQUIRE_EQUAL(instance[42], 42u);
+    BOOST_REQUIRE_EQUAL(instance.back(), 199u);
+}
+
+BOOST_AUTO_TEST_CASE(secure_allocator__vector__assign__expected)
+{
+    secure_chunk instance(32, 0x2a);
+    BOOST_REQUIRE_EQUAL(instance.size(), 32u);
+    BOOST_REQUIRE_EQUAL(instance.front(), 0x2a);
+}
+
+BOOST_AUTO_TEST_CASE(secure_allocator__zeroize__buffer__zeros)
+{
+    data_chunk buffer(32, 0xff);
+    zeroize(buffer.data(), buffer.size());
+    BOOST_REQUIRE(buffer == data_chunk(32, 0x00));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
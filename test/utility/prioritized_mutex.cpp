@@ -0,0 +1,89 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(prioritized_mutex_tests)
+
+BOOST_AUTO_TEST_CASE(prioritized_mutex__lock__not_instrumented__no_metrics)
+{
+    prioritized_mutex instance;
+    instance.lock_high_priority();
+    instance.unlock_high_priority();
+    instance.lock_low_priority();
+    instance.unlock_low_priority();
+    BOOST_REQUIRE_EQUAL(instance.high_priority().acquisitions(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.low_priority().acquisitions(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(prioritized_mutex__lock__instrumented__counted)
+{
+    prioritized_mutex instance(true, true);
+    instance.lock_high_priority();
+    instance.unlock_high_priority();
+    instance.lock_low_priority();
+    instance.unlock_low_priority();
+    instance.lock_low_priority();
+    instance.unlock_low_priority();
+
+    const auto& high = instance.high_priority();
+    const auto& low = instance.low_priority();
+    BOOST_REQUIRE_EQUAL(high.acquisitions(), 1u);
+    BOOST_REQUIRE_EQUAL(high.contended(), 0u);
+    BOOST_REQUIRE_EQUAL(high.wait().samples(), 1u);
+    BOOST_REQUIRE_EQUAL(high.hold().samples(), 1u);
+    BOOST_REQUIRE_EQUAL(low.acquisitions(), 2u);
+    BOOST_REQUIRE_EQUAL(low.hold().samples(), 2u);
+    BOOST_REQUIRE_EQUAL(low.preemptions(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(prioritized_mutex__lock_low_priority__held__contended)
+{
+    prioritized_mutex instance(true, true, 100);
+    std::atomic<bool> low_locked(false);
+
+    // The high priority lock is held while the low priority lock is waiting.
+    instance.lock_high_priority();
+
+    std::thread low([&]()
+    {
+        instance.lock_low_priority();
+        low_locked = true;
+        instance.unlock_low_priority();
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    BOOST_REQUIRE(!low_locked);
+    instance.unlock_high_priority();
+    low.join();
+
+    const auto& low_metrics = instance.low_priority();
+    BOOST_REQUIRE_EQUAL(low_metrics.acquisitions(), 1u);
+    BOOST_REQUIRE_EQUAL(low_metrics.contended(), 1u);
+    BOOST_REQUIRE_GE(low_metrics.wait().total().count(), 5000);
+    BOOST_REQUIRE_EQUAL(instance.high_priority().acquisitions(), 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
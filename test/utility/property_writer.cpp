@@ -0,0 +1,96 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <sstream>
+#include <string>
+#include <vector>
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+#define TX1 \
+"0100000001f08e44a96bfb5ae63eda1a6620adae37ee37ee4777fb0336e1bbbc" \
+"4de65310fc010000006a473044022050d8368cacf9bf1b8fb1f7cfd9aff63294" \
+"789eb1760139e7ef41f083726dadc4022067796354aba8f2e02363c5e510aa7e" \
+"2830b115472fb31de67d16972867f13945012103e589480b2f746381fca01a9b" \
+"12c517b7a482a203c8b2742985da0ac72cc078f2ffffffff02f0c9c467000000" \
+"001976a914d9d78e26df4e4601cf9b26d09c7b280ee764469f88ac80c4600f00" \
+"0000001976a9141ee32412020a324b93b1a1acfdfff6ab9ca8fac288ac000000" \
+"00"
+
+// The property tree written as compact json, without the trailing newline.
+static std::string to_json(const pt::ptree& tree)
+{
+    std::ostringstream stream;
+    pt::write_json(stream, tree, false);
+    auto json = stream.str();
+    json.pop_back();
+    return json;
+}
+
+BOOST_AUTO_TEST_SUITE(property_writer_tests)
+
+BOOST_AUTO_TEST_CASE(property_writer__property_tree__header__matches_property_tree)
+{
+    const config::header header(chain::header(10u, null_hash, null_hash,
+        531234u, 6523454u, 68644u));
+
+    std::string json;
+    json_writer writer(json);
+    property_tree(writer, header);
+    BOOST_REQUIRE_EQUAL(json, to_json(property_tree(header)));
+}
+
+BOOST_AUTO_TEST_CASE(property_writer__property_tree__transaction_json__matches_property_tree)
+{
+    const config::transaction tx(chain::transaction::factory(
+        to_chunk(base16_literal(TX1))));
+
+    std::string json;
+    json_writer writer(json);
+    property_tree(writer, tx, true);
+    BOOST_REQUIRE_EQUAL(json, to_json(property_tree(tx, true)));
+}
+
+BOOST_AUTO_TEST_CASE(property_writer__property_tree__transactions_not_json__matches_property_tree)
+{
+    const std::vector<config::transaction> txs
+    {
+        chain::transaction::factory(to_chunk(base16_literal(TX1))),
+        chain::transaction{}
+    };
+
+    std::string json;
+    json_writer writer(json);
+    property_tree(writer, txs, false);
+    BOOST_REQUIRE_EQUAL(json, to_json(property_tree(txs, false)));
+}
+
+BOOST_AUTO_TEST_CASE(property_writer__property_tree__empty_points__matches_property_tree)
+{
+    const chain::points_value values;
+
+    std::string json;
+    json_writer writer(json);
+    property_tree(writer, values, true);
+    BOOST_REQUIRE_EQUAL(json, to_json(property_tree(values, true)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -82,4 +82,48 @@ BOOST_AUTO_TEST_CASE(pseudo_random__pseudo_randomize__superminute_ratio_255__exp
     BOOST_REQUIRE(result >= minimum);
 }
 
+BOOST_AUTO_TEST_CASE(pseudo_random__next__bounded__within_range)
+{
+    for (size_t count = 0; count < 1000; ++count)
+    {
+        const auto value = pseudo_random::next(10, 13);
+        BOOST_REQUIRE_GE(value, 10u);
+        BOOST_REQUIRE_LE(value, 13u);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(pseudo_random__next__single_value_range__value)
+{
+    BOOST_REQUIRE_EQUAL(pseudo_random::next(42, 42), 42u);
+}
+
+BOOST_AUTO_TEST_CASE(pseudo_random__next__bounded__all_values_drawn)
+{
+    std::array<size_t, 5> counts{};
+    for (size_t count = 0; count < 1000; ++count)
+        ++counts[pseudo_random::next(0, 4)];
+
+    for (const auto count: counts)
+        BOOST_REQUIRE_GT(count, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(pseudo_random__fill__partial_word__filled)
+{
+    // The chance of eleven zero bytes from a uniform source is negligible.
+    data_chunk data(11, 0);
+    pseudo_random::fill(data);
+    BOOST_REQUIRE(data != data_chunk(11, 0));
+}
+
+BOOST_AUTO_TEST_CASE(pseudo_random__xoshiro256__same_seed__same_sequence)
+{
+    xoshiro256 first(42);
+    xoshiro256 second(42);
+    xoshiro256 third(43);
+    const auto value = first();
+    BOOST_REQUIRE_EQUAL(value, second());
+    BOOST_REQUIRE_NE(value, third());
+    BOOST_REQUIRE_NE(first(), value);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,131 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(reader_tests)
+
+// A reader that overrides only the required members, relying on defaults.
+class minimal_reader
+  : public reader
+{
+public:
+    minimal_reader(const data_chunk& data)
+      : source_(data)
+    {
+    }
+
+    operator bool() const override { return source_; }
+    bool operator!() const override { return !source_; }
+    bool is_exhausted() const override { return source_.is_exhausted(); }
+    void invalidate() override { source_.invalidate(); }
+
+    hash_digest read_hash() override { return source_.read_hash(); }
+    short_hash read_short_hash() override { return source_.read_short_hash(); }
+    mini_hash read_mini_hash() override { return source_.read_mini_hash(); }
+
+    uint16_t read_2_bytes_big_endian() override { return source_.read_2_bytes_big_endian(); }
+    uint32_t read_4_bytes_big_endian() override { return source_.read_4_bytes_big_endian(); }
+    uint64_t read_8_bytes_big_endian() override { return source_.read_8_bytes_big_endian(); }
+    uint64_t read_variable_big_endian() override { return source_.read_variable_big_endian(); }
+    size_t read_size_big_endian() override { return source_.read_size_big_endian(); }
+
+    code read_error_code() override { return source_.read_error_code(); }
+    uint16_t read_2_bytes_little_endian() override { return source_.read_2_bytes_little_endian(); }
+    uint32_t read_4_bytes_little_endian() override { return source_.read_4_bytes_little_endian(); }
+    uint64_t read_8_bytes_little_endian() override { return source_.read_8_bytes_little_endian(); }
+    uint64_t read_variable_little_endian() override { return source_.read_variable_little_endian(); }
+    size_t read_size_little_endian() override { return source_.read_size_little_endian(); }
+
+    uint8_t peek_byte() override { return source_.peek_byte(); }
+    uint8_t read_byte() override { return source_.read_byte(); }
+
+    data_chunk read_bytes() override { return source_.read_bytes(); }
+    data_chunk read_bytes(size_t size) override { return source_.read_bytes(size); }
+    std::string read_string() override { return source_.read_string(); }
+    std::string read_string(size_t size) override { return source_.read_string(size); }
+    void skip(size_t size) override { source_.skip(size); }
+
+private:
+    byte_reader source_;
+};
+
+BOOST_AUTO_TEST_CASE(reader__remaining__default__unknown)
+{
+    const data_chunk data{ 0x01, 0x02 };
+    minimal_reader source(data);
+    BOOST_REQUIRE_EQUAL(source.remaining(), max_size_t);
+}
+
+BOOST_AUTO_TEST_CASE(reader__read_count__default_remaining__bounded_by_maximum_only)
+{
+    const data_chunk data{ 0xfd, 0x00, 0x01 };
+    minimal_reader source(data);
+    BOOST_REQUIRE_EQUAL(read_count(source, 1, 256), 256u);
+    BOOST_REQUIRE(source);
+}
+
+BOOST_AUTO_TEST_CASE(reader__read_variable_base128__default__byte_writer)
+{
+    data_chunk data;
+    byte_writer writer(data);
+    writer.write_variable_base128(0);
+    writer.write_variable_base128(0x7f);
+    writer.write_variable_base128(0x4000);
+    writer.write_variable_base128(max_uint64);
+
+    minimal_reader source(data);
+    BOOST_REQUIRE_EQUAL(source.read_variable_base128(), 0u);
+    BOOST_REQUIRE_EQUAL(source.read_variable_base128(), 0x7fu);
+    BOOST_REQUIRE_EQUAL(source.read_variable_base128(), 0x4000u);
+    BOOST_REQUIRE_EQUAL(source.read_variable_base128(), max_uint64);
+    BOOST_REQUIRE(source);
+    BOOST_REQUIRE(source.is_exhausted());
+}
+
+BOOST_AUTO_TEST_CASE(reader__read_variable_base128__default_truncated__invalid)
+{
+    const data_chunk data{ 0x80, 0x80 };
+    minimal_reader source(data);
+    BOOST_REQUIRE_EQUAL(source.read_variable_base128(), 0u);
+    BOOST_REQUIRE(!source);
+}
+
+BOOST_AUTO_TEST_CASE(reader__read_variable_base128__default_overflow__invalid)
+{
+    const data_chunk data(11, 0xff);
+    minimal_reader source(data);
+    BOOST_REQUIRE_EQUAL(source.read_variable_base128(), 0u);
+    BOOST_REQUIRE(!source);
+}
+
+BOOST_AUTO_TEST_CASE(reader__read_bytes_out__default__replaced)
+{
+    const data_chunk data{ 0x01, 0x02, 0x03 };
+    minimal_reader instance(data);
+    reader& source = instance;
+    data_chunk out{ 0xff, 0xff, 0xff, 0xff };
+    source.read_bytes(out, 2);
+    BOOST_REQUIRE(out == (data_chunk{ 0x01, 0x02 }));
+    BOOST_REQUIRE(source);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
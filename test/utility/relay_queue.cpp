@@ -0,0 +1,61 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(relay_queue_tests)
+
+BOOST_AUTO_TEST_CASE(relay_queue__push__first__schedule)
+{
+    relay_queue<size_t> instance;
+    BOOST_REQUIRE(instance.push(1));
+    BOOST_REQUIRE(!instance.push(2));
+}
+
+BOOST_AUTO_TEST_CASE(relay_queue__drain__queued__ordered_and_rescheduled)
+{
+    relay_queue<size_t, std::string> instance;
+    BOOST_REQUIRE(instance.push(1, "a"));
+    BOOST_REQUIRE(!instance.push(2, "b"));
+
+    std::vector<size_t> values;
+    std::string text;
+    instance.drain([&](size_t value, const std::string& letter)
+    {
+        values.push_back(value);
+        text += letter;
+
+        // Pushed during the drain, delivered by the same drain.
+        if (value == 1)
+            BOOST_REQUIRE(!instance.push(3, "c"));
+    });
+
+    BOOST_REQUIRE(values == std::vector<size_t>({ 1, 2, 3 }));
+    BOOST_REQUIRE_EQUAL(text, "abc");
+
+    // The queue is idle after the drain.
+    BOOST_REQUIRE(instance.push(4, "d"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,103 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(resubscriber_tests)
+
+typedef resubscriber<size_t> size_resubscriber;
+
+BOOST_AUTO_TEST_CASE(resubscriber__invoke__renewed__retained_in_order)
+{
+    threadpool pool(1);
+    const auto instance = std::make_shared<size_resubscriber>(pool, "test");
+    std::vector<size_t> calls;
+    instance->start();
+
+    instance->subscribe([&calls](size_t value)
+    {
+        calls.push_back(10 + value);
+        return true;
+    }, 0);
+
+    instance->subscribe([&calls](size_t value)
+    {
+        calls.push_back(20 + value);
+        return false;
+    }, 0);
+
+    instance->subscribe([&calls](size_t value)
+    {
+        calls.push_back(30 + value);
+        return value == 1;
+    }, 0);
+
+    instance->invoke(1);
+    instance->invoke(2);
+    instance->invoke(3);
+    BOOST_REQUIRE(calls == std::vector<size_t>({ 11, 21, 31, 12, 32, 13 }));
+
+    // Clear the remaining subscription.
+    instance->stop();
+    instance->invoke(0);
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(resubscriber__relay__burst__all_delivered_in_order)
+{
+    static const size_t count = 100;
+    threadpool pool(2);
+    const auto instance = std::make_shared<size_resubscriber>(pool, "test");
+    std::vector<size_t> values;
+    std::promise<void> complete;
+    instance->start();
+
+    instance->subscribe([&values, &complete](size_t value)
+    {
+        values.push_back(value);
+
+        if (value + 1 == count)
+            complete.set_value();
+
+        return value + 1 < count;
+    }, 0);
+
+    for (size_t value = 0; value < count; ++value)
+        instance->relay(value);
+
+    complete.get_future().wait();
+    BOOST_REQUIRE_EQUAL(values.size(), count);
+
+    for (size_t value = 0; value < count; ++value)
+        BOOST_REQUIRE_EQUAL(values[value], value);
+
+    instance->stop();
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,104 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(ring_buffer_tests)
+
+BOOST_AUTO_TEST_CASE(ring_buffer__capacity__not_power_of_two__rounded_up)
+{
+    BOOST_REQUIRE_EQUAL(ring_buffer<size_t>(0).capacity(), 2u);
+    BOOST_REQUIRE_EQUAL(ring_buffer<size_t>(5).capacity(), 8u);
+    BOOST_REQUIRE_EQUAL(ring_buffer<size_t>(16).capacity(), 16u);
+}
+
+BOOST_AUTO_TEST_CASE(ring_buffer__pop__empty__false)
+{
+    ring_buffer<size_t> instance(4);
+    size_t value;
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE(!instance.pop(value));
+}
+
+BOOST_AUTO_TEST_CASE(ring_buffer__push__full__false)
+{
+    ring_buffer<std::string> instance(2);
+    BOOST_REQUIRE(instance.push("a"));
+    BOOST_REQUIRE(instance.push(std::string("b")));
+    BOOST_REQUIRE(!instance.push("c"));
+
+    std::string value;
+    BOOST_REQUIRE(instance.pop(value));
+    BOOST_REQUIRE_EQUAL(value, "a");
+    BOOST_REQUIRE(instance.push("c"));
+    BOOST_REQUIRE(instance.pop(value));
+    BOOST_REQUIRE_EQUAL(value, "b");
+    BOOST_REQUIRE(instance.pop(value));
+    BOOST_REQUIRE_EQUAL(value, "c");
+    BOOST_REQUIRE(instance.empty());
+}
+
+BOOST_AUTO_TEST_CASE(ring_buffer__push__concurrent_producers__all_popped_in_order)
+{
+    static const size_t producers = 4;
+    static const size_t count = 10000;
+    ring_buffer<size_t> instance(64);
+    std::vector<std::thread> threads;
+
+    for (size_t producer = 0; producer < producers; ++producer)
+    {
+        threads.emplace_back([&, producer]()
+        {
+            for (size_t index = 0; index < count; ++index)
+                while (!instance.push(producer * count + index))
+                    std::this_thread::yield();
+        });
+    }
+
+    // Values of each producer are popped in the order pushed.
+    std::vector<size_t> next(producers, 0);
+    size_t value;
+
+    for (size_t popped = 0; popped < producers * count;)
+    {
+        if (!instance.pop(value))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        const auto producer = value / count;
+        BOOST_REQUIRE_EQUAL(value % count, next[producer]++);
+        ++popped;
+    }
+
+    for (auto& thread: threads)
+        thread.join();
+
+    BOOST_REQUIRE(instance.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
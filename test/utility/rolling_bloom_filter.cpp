@@ -0,0 +1,113 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::message;
+
+BOOST_AUTO_TEST_SUITE(rolling_bloom_filter_tests)
+
+// Test helpers.
+static hash_digest get_hash(uint32_t index)
+{
+    return sha256_hash(to_chunk(to_little_endian(index)));
+}
+
+BOOST_AUTO_TEST_CASE(rolling_bloom_filter__contains__empty__false)
+{
+    const rolling_bloom_filter instance(100, 0.001);
+    BOOST_REQUIRE(!instance.contains(get_hash(0)));
+    BOOST_REQUIRE_EQUAL(instance.hash_functions(), 10u);
+    BOOST_REQUIRE_GT(instance.allocated(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(rolling_bloom_filter__contains__inserted__true)
+{
+    rolling_bloom_filter instance(100, 0.001);
+    instance.insert(get_hash(1));
+    BOOST_REQUIRE(instance.contains(get_hash(1)));
+    BOOST_REQUIRE(!instance.contains(get_hash(2)));
+}
+
+BOOST_AUTO_TEST_CASE(rolling_bloom_filter__insert__inventory__unknown_excludes_inserted)
+{
+    rolling_bloom_filter instance(100, 0.001);
+    const inventory known({ get_hash(1), get_hash(2) }, inventory::type_id::transaction);
+    instance.insert(known);
+    BOOST_REQUIRE(instance.contains(known.inventories()[0]));
+    BOOST_REQUIRE(instance.contains(known.inventories()[1]));
+
+    const inventory announced({ get_hash(3), get_hash(1), get_hash(4) }, inventory::type_id::block);
+    const auto unknown = instance.unknown(announced);
+    BOOST_REQUIRE_EQUAL(unknown.size(), 2u);
+    BOOST_REQUIRE(unknown[0].hash() == get_hash(3));
+    BOOST_REQUIRE(unknown[1].hash() == get_hash(4));
+    BOOST_REQUIRE(unknown[0].type() == inventory::type_id::block);
+}
+
+BOOST_AUTO_TEST_CASE(rolling_bloom_filter__insert__beyond_capacity__recent_retained_oldest_dropped)
+{
+    static const uint32_t capacity = 1000;
+    rolling_bloom_filter instance(capacity, 0.001);
+
+    for (uint32_t index = 0; index < 4 * capacity; ++index)
+        instance.insert(get_hash(index));
+
+    // At least the capacity of most recent hashes is retained.
+    for (uint32_t index = 3 * capacity; index < 4 * capacity; ++index)
+        BOOST_REQUIRE(instance.contains(get_hash(index)));
+
+    size_t retained = 0;
+    for (uint32_t index = 0; index < capacity; ++index)
+        retained += instance.contains(get_hash(index)) ? 1 : 0;
+
+    // The oldest are cleared, but for false positives.
+    BOOST_REQUIRE_LT(retained, capacity / 10);
+}
+
+BOOST_AUTO_TEST_CASE(rolling_bloom_filter__contains__at_capacity__false_positive_rate_bounded)
+{
+    static const uint32_t capacity = 2000;
+    static const uint32_t queries = 20000;
+    rolling_bloom_filter instance(capacity, 0.01);
+
+    for (uint32_t index = 0; index < capacity; ++index)
+        instance.insert(get_hash(index));
+
+    size_t positives = 0;
+    for (uint32_t index = capacity; index < capacity + queries; ++index)
+        positives += instance.contains(get_hash(index)) ? 1 : 0;
+
+    // The expected count is under 200, allowing for variance.
+    BOOST_REQUIRE_LT(positives, 400u);
+}
+
+BOOST_AUTO_TEST_CASE(rolling_bloom_filter__clear__inserted__not_contained)
+{
+    rolling_bloom_filter instance(100, 0.001);
+    instance.insert(get_hash(1));
+    instance.clear();
+    BOOST_REQUIRE(!instance.contains(get_hash(1)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,144 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <future>
+#include <memory>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(send_queue_tests)
+
+// A connected pair of loopback sockets, the queue writes to the peer.
+struct connection
+{
+    connection()
+      : pool(2),
+        local(std::make_shared<bc::socket>(pool)),
+        acceptor(service, asio::endpoint(asio::ipv4::loopback(), 0)),
+        peer(service)
+    {
+        local->get().connect(acceptor.local_endpoint());
+        acceptor.accept(peer);
+    }
+
+    ~connection()
+    {
+        local->stop();
+        pool.shutdown();
+        pool.join();
+    }
+
+    data_chunk read(size_t size)
+    {
+        data_chunk data(size);
+        boost::asio::read(peer, boost::asio::buffer(data));
+        return data;
+    }
+
+    threadpool pool;
+    bc::socket::ptr local;
+    asio::service service;
+    asio::acceptor acceptor;
+    asio::socket peer;
+};
+
+static send_queue::handler promise_handler(
+    std::shared_ptr<std::promise<code>> promise)
+{
+    return [promise](const code& ec)
+    {
+        promise->set_value(ec);
+    };
+}
+
+BOOST_AUTO_TEST_CASE(send_queue__send__under_cork_bytes__gathered_into_one_write)
+{
+    connection pair;
+    send_queue::policy policy;
+    policy.cork_bytes = 5;
+    policy.cork_latency = asio::seconds(60);
+    const auto queue = std::make_shared<send_queue>(pair.pool, pair.local,
+        policy);
+
+    const auto heading = std::make_shared<const data_chunk>(data_chunk{ 1, 2 });
+    const auto payload = std::make_shared<const data_chunk>(data_chunk{ 3 });
+    const auto message = std::make_shared<const data_chunk>(data_chunk{ 4, 5 });
+    const auto first = std::make_shared<std::promise<code>>();
+    const auto second = std::make_shared<std::promise<code>>();
+
+    queue->send(boost::asio::buffer(*heading), boost::asio::buffer(*payload),
+        heading, promise_handler(first));
+    BOOST_REQUIRE_EQUAL(queue->pending_bytes(), 3u);
+    BOOST_REQUIRE_EQUAL(queue->writes(), 0u);
+
+    queue->send(boost::asio::buffer(*message), message,
+        promise_handler(second));
+    BOOST_REQUIRE_EQUAL(queue->writes(), 1u);
+
+    BOOST_REQUIRE(pair.read(5) == (data_chunk{ 1, 2, 3, 4, 5 }));
+    BOOST_REQUIRE_EQUAL(first->get_future().get(), error::success);
+    BOOST_REQUIRE_EQUAL(second->get_future().get(), error::success);
+    BOOST_REQUIRE_EQUAL(queue->pending_bytes(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(send_queue__send__cork_latency__written)
+{
+    connection pair;
+    send_queue::policy policy;
+    policy.cork_bytes = 1000;
+    policy.cork_latency = asio::milliseconds(1);
+    const auto queue = std::make_shared<send_queue>(pair.pool, pair.local,
+        policy);
+
+    const auto message = std::make_shared<const data_chunk>(data_chunk{ 42 });
+    const auto sent = std::make_shared<std::promise<code>>();
+    queue->send(boost::asio::buffer(*message), message,
+        promise_handler(sent));
+
+    BOOST_REQUIRE(pair.read(1) == data_chunk{ 42 });
+    BOOST_REQUIRE_EQUAL(sent->get_future().get(), error::success);
+    BOOST_REQUIRE_EQUAL(queue->writes(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(send_queue__stop__pending__channel_stopped)
+{
+    connection pair;
+    send_queue::policy policy;
+    policy.cork_bytes = 1000;
+    policy.cork_latency = asio::seconds(60);
+    const auto queue = std::make_shared<send_queue>(pair.pool, pair.local,
+        policy);
+
+    const auto message = std::make_shared<const data_chunk>(data_chunk{ 42 });
+    const auto pending = std::make_shared<std::promise<code>>();
+    const auto late = std::make_shared<std::promise<code>>();
+    queue->send(boost::asio::buffer(*message), message,
+        promise_handler(pending));
+    queue->stop();
+    queue->send(boost::asio::buffer(*message), message,
+        promise_handler(late));
+
+    BOOST_REQUIRE_EQUAL(pending->get_future().get(), error::channel_stopped);
+    BOOST_REQUIRE_EQUAL(late->get_future().get(), error::channel_stopped);
+    BOOST_REQUIRE_EQUAL(queue->writes(), 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,91 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(seqlocked_tests)
+
+struct pair_value
+{
+    uint64_t value;
+    uint64_t complement;
+    uint32_t flags;
+};
+
+BOOST_AUTO_TEST_CASE(seqlocked__load__default__value_initialized)
+{
+    const seqlocked<pair_value> instance;
+    const auto value = instance.load();
+    BOOST_REQUIRE_EQUAL(value.value, 0u);
+    BOOST_REQUIRE_EQUAL(value.complement, 0u);
+    BOOST_REQUIRE_EQUAL(value.flags, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(seqlocked__store__value__loaded)
+{
+    seqlocked<pair_value> instance({ 1, 2, 3 });
+    BOOST_REQUIRE_EQUAL(instance.load().value, 1u);
+
+    instance.store({ 4, 5, 6 });
+    pair_value value;
+    BOOST_REQUIRE(instance.try_load(value));
+    BOOST_REQUIRE_EQUAL(value.value, 4u);
+    BOOST_REQUIRE_EQUAL(value.complement, 5u);
+    BOOST_REQUIRE_EQUAL(value.flags, 6u);
+}
+
+BOOST_AUTO_TEST_CASE(seqlocked__load__concurrent_store__never_torn)
+{
+    seqlocked<pair_value> instance({ 0, ~uint64_t(0), 0 });
+    std::atomic<bool> stop(false);
+    std::atomic<size_t> torn(0);
+
+    std::vector<std::thread> readers;
+    for (size_t reader = 0; reader < 3; ++reader)
+    {
+        readers.emplace_back([&]()
+        {
+            while (!stop)
+            {
+                const auto value = instance.load();
+                if (value.complement != ~value.value)
+                    ++torn;
+            }
+        });
+    }
+
+    for (uint64_t value = 1; value < 20000; ++value)
+        instance.store({ value, ~value, 0 });
+
+    stop = true;
+    for (auto& reader: readers)
+        reader.join();
+
+    BOOST_REQUIRE_EQUAL(torn.load(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.load().value, 19999u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
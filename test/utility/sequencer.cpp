@@ -0,0 +1,142 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(sequencer_tests)
+
+BOOST_AUTO_TEST_CASE(sequencer__lock__concurrent_lockers__not_concurrent)
+{
+    static const size_t lockers = 4;
+    static const size_t actions = 500;
+
+    threadpool pool(4);
+    const auto instance = std::make_shared<sequencer>(pool.service());
+    auto done = std::make_shared<std::promise<void>>();
+    size_t executing = 0;
+    size_t overlaps = 0;
+    size_t completed = 0;
+
+    const auto action = [&, done]()
+    {
+        // Any overlap of actions would be visible as a count above one.
+        if (++executing != 1)
+            ++overlaps;
+
+        --executing;
+        if (++completed == lockers * actions)
+            done->set_value();
+
+        instance->unlock();
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t thread = 0; thread < lockers; ++thread)
+    {
+        threads.emplace_back([&]()
+        {
+            for (size_t count = 0; count < actions; ++count)
+                instance->lock(action);
+        });
+    }
+
+    for (auto& thread: threads)
+        thread.join();
+
+    done->get_future().wait();
+    pool.shutdown();
+    pool.join();
+    BOOST_REQUIRE_EQUAL(overlaps, 0u);
+    BOOST_REQUIRE_EQUAL(completed, lockers * actions);
+}
+
+BOOST_AUTO_TEST_CASE(sequencer__unlock__inline_depth__next_invoked_inline)
+{
+    threadpool pool(0);
+    const auto instance = std::make_shared<sequencer>(pool.service(), 1);
+    std::vector<size_t> order;
+
+    // The first action is posted, so it is run on this thread by the service.
+    instance->lock([&]() { order.push_back(1); });
+    instance->lock([&]() { order.push_back(2); instance->unlock(); });
+    instance->lock([&]() { order.push_back(3); instance->unlock(); });
+    BOOST_REQUIRE(order.empty());
+
+    pool.service().poll();
+    BOOST_REQUIRE(order == (std::vector<size_t>{ 1 }));
+
+    // The second runs inline, within which the third exceeds the depth.
+    instance->unlock();
+    BOOST_REQUIRE(order == (std::vector<size_t>{ 1, 2 }));
+
+    pool.service().reset();
+    pool.service().poll();
+    BOOST_REQUIRE(order == (std::vector<size_t>{ 1, 2, 3 }));
+}
+
+BOOST_AUTO_TEST_CASE(sequencer__unlock__zero_inline_depth__next_posted)
+{
+    threadpool pool(0);
+    const auto instance = std::make_shared<sequencer>(pool.service());
+    std::vector<size_t> order;
+
+    instance->lock([&]() { order.push_back(1); });
+    instance->lock([&]() { order.push_back(2); instance->unlock(); });
+    pool.service().poll();
+    BOOST_REQUIRE(order == (std::vector<size_t>{ 1 }));
+
+    instance->unlock();
+    BOOST_REQUIRE(order == (std::vector<size_t>{ 1 }));
+
+    pool.service().reset();
+    pool.service().poll();
+    BOOST_REQUIRE(order == (std::vector<size_t>{ 1, 2 }));
+}
+
+BOOST_AUTO_TEST_CASE(sequencer__unlock__inline_handler_throws__depth_restored)
+{
+    threadpool pool(0);
+    const auto instance = std::make_shared<sequencer>(pool.service(), 1);
+    std::vector<size_t> order;
+
+    instance->lock([&]() { order.push_back(1); });
+    instance->lock([&]() { order.push_back(2); throw std::runtime_error("handler"); });
+    instance->lock([&]() { order.push_back(3); instance->unlock(); });
+    pool.service().poll();
+    BOOST_REQUIRE(order == (std::vector<size_t>{ 1 }));
+
+    // The second runs inline and throws, leaving the sequence locked.
+    BOOST_REQUIRE_THROW(instance->unlock(), std::runtime_error);
+    BOOST_REQUIRE(order == (std::vector<size_t>{ 1, 2 }));
+
+    // The third is again within the inline depth.
+    instance->unlock();
+    BOOST_REQUIRE(order == (std::vector<size_t>{ 1, 2, 3 }));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
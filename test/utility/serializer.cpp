@@ -528,4 +528,165 @@ BOOST_AUTO_TEST_CASE(read_bytes_to_eof)
     BOOST_REQUIRE_EQUAL(false, !source);
 }
 
+BOOST_AUTO_TEST_CASE(roundtrip_variable_base128)
+{
+    static const uint64_t values[] =
+    {
+        0, 1, 0x7f, 0x80, 0x407f, 0x4080, 0xffffffff, max_uint64 - 1, max_uint64
+    };
+
+    for (const auto expected: values)
+    {
+        const auto size = message::variable_base128_size(expected);
+        data_chunk data(size);
+        auto source = make_safe_deserializer(data.begin(), data.end());
+        auto sink = make_unsafe_serializer(data.begin());
+
+        sink.write_variable_base128(expected);
+
+        const auto result = source.read_variable_base128();
+
+        BOOST_REQUIRE_EQUAL(expected, result);
+        BOOST_REQUIRE((bool)source);
+        BOOST_REQUIRE(source.is_exhausted());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(write_variable_base128__boundaries__expected)
+{
+    data_chunk one(1);
+    data_chunk two(2);
+    data_chunk three(3);
+    make_unsafe_serializer(one.begin()).write_variable_base128(0x7f);
+    make_unsafe_serializer(two.begin()).write_variable_base128(0x80);
+    make_unsafe_serializer(three.begin()).write_variable_base128(0x4080);
+    BOOST_REQUIRE_EQUAL(encode_base16(one), "7f");
+    BOOST_REQUIRE_EQUAL(encode_base16(two), "8000");
+    BOOST_REQUIRE_EQUAL(encode_base16(three), "808000");
+    BOOST_REQUIRE_EQUAL(message::variable_base128_size(0x407f), 2u);
+    BOOST_REQUIRE_EQUAL(message::variable_base128_size(0x4080), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(read_variable_base128__overflow__invalid)
+{
+    // The eleventh group would exceed 64 bits.
+    const data_chunk data(11, 0xff);
+    auto source = make_safe_deserializer(data.begin(), data.end());
+    BOOST_REQUIRE_EQUAL(source.read_variable_base128(), 0u);
+    BOOST_REQUIRE(!source);
+}
+
+BOOST_AUTO_TEST_CASE(read_variable_base128__truncated__invalid)
+{
+    const data_chunk data{ 0x80 };
+    auto source = make_safe_deserializer(data.begin(), data.end());
+    source.read_variable_base128();
+    BOOST_REQUIRE(!source);
+}
+
+// Each form is read both with and without the widest form in bounds.
+BOOST_AUTO_TEST_CASE(read_variable_little_endian__padded_and_unpadded__expected)
+{
+    static const uint64_t values[] =
+    {
+        0xfc, 0xfd, 0xffff, 0x10000, 0xffffffff, 0x100000000, max_uint64
+    };
+
+    for (const auto value: values)
+    {
+        data_chunk data;
+        byte_writer sink(data);
+        sink.write_variable_little_endian(value);
+        const auto size = data.size();
+
+        for (size_t padding = 0; padding <= sizeof(uint64_t); ++padding)
+        {
+            auto source = make_safe_deserializer(data.begin(), data.end());
+            byte_reader reader(data);
+            BOOST_REQUIRE_EQUAL(source.read_variable_little_endian(), value);
+            BOOST_REQUIRE_EQUAL(reader.read_variable_little_endian(), value);
+            BOOST_REQUIRE_EQUAL(source.remaining(), padding);
+            BOOST_REQUIRE_EQUAL(reader.remaining(), padding);
+            data.push_back(0xff);
+        }
+
+        data.resize(size - 1);
+        auto source = make_safe_deserializer(data.begin(), data.end());
+        source.read_variable_little_endian();
+        BOOST_REQUIRE(!source);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(write_variable_little_endian__writers__same)
+{
+    static const uint64_t values[] = { 0xfc, 0xfd, 0x10000, 0x100000000 };
+    static const std::string expected[] =
+    {
+        "fc", "fdfd00", "fe00000100", "ff0000000001000000"
+    };
+
+    for (size_t index = 0; index < 4; ++index)
+    {
+        data_chunk bytes;
+        byte_writer sink(bytes);
+        sink.write_variable_little_endian(values[index]);
+
+        data_chunk streamed;
+        data_sink stream(streamed);
+        ostream_writer writer(stream);
+        writer.write_variable_little_endian(values[index]);
+        stream.flush();
+
+        data_chunk serialized(bytes.size());
+        make_unsafe_serializer(serialized.begin())
+            .write_variable_little_endian(values[index]);
+
+        BOOST_REQUIRE_EQUAL(encode_base16(bytes), expected[index]);
+        BOOST_REQUIRE(streamed == bytes);
+        BOOST_REQUIRE(serialized == bytes);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(deserializer__remaining__safe__unread_bytes)
+{
+    const data_chunk data{ 0x01, 0x02, 0x03 };
+    auto source = make_safe_deserializer(data.begin(), data.end());
+    BOOST_REQUIRE_EQUAL(source.remaining(), 3u);
+    source.read_byte();
+    BOOST_REQUIRE_EQUAL(source.remaining(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(deserializer__remaining__unsafe__unknown)
+{
+    const data_chunk data{ 0x01, 0x02, 0x03 };
+    auto source = make_unsafe_deserializer(data.begin());
+    BOOST_REQUIRE_EQUAL(source.remaining(), max_size_t);
+}
+
+BOOST_AUTO_TEST_CASE(istream_reader__remaining__unknown)
+{
+    const data_chunk data{ 0x01, 0x02, 0x03 };
+    data_source stream(data);
+    istream_reader source(stream);
+    BOOST_REQUIRE_EQUAL(source.remaining(), max_size_t);
+}
+
+BOOST_AUTO_TEST_CASE(istream_reader__read_bytes__excessive_size__empty_invalid)
+{
+    const data_chunk data{ 0x01, 0x02, 0x03 };
+    data_source stream(data);
+    istream_reader source(stream);
+    BOOST_REQUIRE(source.read_bytes(max_size_t).empty());
+    BOOST_REQUIRE(!source);
+}
+
+BOOST_AUTO_TEST_CASE(istream_reader__read_bytes__multiple_chunks__expected)
+{
+    const data_chunk data(200000, 0x2a);
+    data_source stream(data);
+    istream_reader source(stream);
+    BOOST_REQUIRE(source.read_bytes(data.size()) == data);
+    BOOST_REQUIRE(source);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
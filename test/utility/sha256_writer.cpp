@@ -0,0 +1,78 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(sha256_writer_tests)
+
+template <typename Writer>
+static void write_values(Writer& sink)
+{
+    sink.write_byte(0x80);
+    sink.write_2_bytes_little_endian(0x8040);
+    sink.write_4_bytes_little_endian(0x80402010);
+    sink.write_8_bytes_little_endian(0x8040201011223344);
+    sink.write_4_bytes_big_endian(0x80402010);
+    sink.write_variable_little_endian(1234);
+    sink.write_variable_big_endian(0x123456789a);
+    sink.write_variable_base128(0x4000);
+    sink.write_little_endian(uint16_t(42));
+    sink.write_bytes(to_chunk(to_little_endian<uint32_t>(0xbadf00d)));
+    sink.write_string("hello");
+    sink.write_string("abc", 5);
+    sink.write_hash(null_hash);
+    sink.skip(100);
+}
+
+BOOST_AUTO_TEST_CASE(sha256_writer__digests__values__same_as_byte_writer)
+{
+    data_chunk data;
+    byte_writer bytes(data);
+    write_values(bytes);
+
+    sha256_writer sink;
+    write_values(sink);
+    BOOST_REQUIRE(sink);
+    BOOST_REQUIRE(sha256_hash(data) == sink.sha256_digest());
+
+    write_values(sink);
+    BOOST_REQUIRE(bitcoin_hash(data) == sink.bitcoin_digest());
+}
+
+BOOST_AUTO_TEST_CASE(sha256_writer__bitcoin_digest__transaction__hash)
+{
+    const chain::transaction tx{ 1, 0, { { { null_hash, 0 }, {}, 0 } },
+        { { 1, {} } } };
+
+    sha256_writer sink;
+    tx.to_data(sink);
+    BOOST_REQUIRE(sink.bitcoin_digest() == tx.hash());
+}
+
+BOOST_AUTO_TEST_CASE(sha256_writer__reset__partial_message__empty_message)
+{
+    sha256_writer sink;
+    sink.write_string("discarded");
+    sink.reset();
+    BOOST_REQUIRE(sink.sha256_digest() == sha256_hash(data_chunk{}));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,235 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+// Test helpers.
+static hash_digest make_key(uint32_t value)
+{
+    hash_digest key{ {} };
+    const auto bytes = to_little_endian(value);
+    std::copy(bytes.begin(), bytes.end(), key.begin());
+    return key;
+}
+
+typedef sharded_map<hash_digest, uint32_t> map;
+
+BOOST_AUTO_TEST_SUITE(sharded_map_tests)
+
+BOOST_AUTO_TEST_CASE(sharded_map__construct__default__disabled)
+{
+    map instance;
+    BOOST_REQUIRE(!instance.enabled());
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.shards(), map::default_shards);
+    BOOST_REQUIRE(!instance.insert(make_key(1), 1));
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(sharded_map__construct__shards__power_of_two)
+{
+    BOOST_REQUIRE_EQUAL(map(10, 0).shards(), 1u);
+    BOOST_REQUIRE_EQUAL(map(10, 1).shards(), 1u);
+    BOOST_REQUIRE_EQUAL(map(10, 3).shards(), 4u);
+    BOOST_REQUIRE_EQUAL(map(10, 64).shards(), 64u);
+}
+
+BOOST_AUTO_TEST_CASE(sharded_map__find__inserted__value_hit)
+{
+    map instance(10);
+    BOOST_REQUIRE(instance.insert(make_key(1), 42));
+
+    uint32_t value = 0;
+    BOOST_REQUIRE(instance.find(value, make_key(1)));
+    BOOST_REQUIRE_EQUAL(value, 42u);
+    BOOST_REQUIRE(!instance.find(value, make_key(2)));
+    BOOST_REQUIRE(instance.contains(make_key(1)));
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.cost(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.hits(), 2u);
+    BOOST_REQUIRE_EQUAL(instance.misses(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.insertions(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.hit_rate(), 2.0f / 3.0f);
+}
+
+BOOST_AUTO_TEST_CASE(sharded_map__insert__present__unchanged)
+{
+    map instance(10);
+    BOOST_REQUIRE(instance.insert(make_key(1), 42));
+    BOOST_REQUIRE(!instance.insert(make_key(1), 24, 2));
+
+    uint32_t value = 0;
+    BOOST_REQUIRE(instance.find(value, make_key(1)));
+    BOOST_REQUIRE_EQUAL(value, 42u);
+    BOOST_REQUIRE_EQUAL(instance.cost(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(sharded_map__insert__cost_exceeds_capacity__false)
+{
+    map instance(10);
+    BOOST_REQUIRE(!instance.insert(make_key(1), 1, 11));
+    BOOST_REQUIRE(instance.insert(make_key(1), 1, 10));
+    BOOST_REQUIRE_EQUAL(instance.cost(), 10u);
+}
+
+BOOST_AUTO_TEST_CASE(sharded_map__insert__full__bounded_by_cost)
+{
+    map instance(100);
+
+    for (uint32_t index = 0; index < 1000; ++index)
+    {
+        BOOST_REQUIRE(instance.insert(make_key(index), index, 1 + index % 3));
+        BOOST_REQUIRE(instance.contains(make_key(index)));
+        BOOST_REQUIRE_LE(instance.cost(), instance.capacity());
+    }
+
+    BOOST_REQUIRE_GT(instance.evictions(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.insertions(), 1000u);
+    BOOST_REQUIRE_EQUAL(instance.size(), instance.insertions() - instance.evictions());
+}
+
+BOOST_AUTO_TEST_CASE(sharded_map__insert__full_referenced__evicts_unreferenced)
+{
+    map instance(2, 1);
+    BOOST_REQUIRE(instance.insert(make_key(1), 1));
+    BOOST_REQUIRE(instance.insert(make_key(2), 2));
+    BOOST_REQUIRE(instance.contains(make_key(1)));
+    BOOST_REQUIRE(instance.insert(make_key(3), 3));
+    BOOST_REQUIRE(instance.contains(make_key(1)));
+    BOOST_REQUIRE(!instance.contains(make_key(2)));
+    BOOST_REQUIRE(instance.contains(make_key(3)));
+    BOOST_REQUIRE_EQUAL(instance.evictions(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(sharded_map__insert__full_single_shard__reuses_any_shard_capacity)
+{
+    // Capacity is shared, so the shard of a key may evict from another shard.
+    map instance(1, 16);
+
+    for (uint32_t index = 0; index < 100; ++index)
+    {
+        BOOST_REQUIRE(instance.insert(make_key(index), index));
+        BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sharded_map__resize__smaller__evicts)
+{
+    map instance(16);
+
+    for (uint32_t index = 0; index < 16; ++index)
+        instance.insert(make_key(index), index);
+
+    BOOST_REQUIRE_EQUAL(instance.size(), 16u);
+    instance.resize(4);
+    BOOST_REQUIRE_EQUAL(instance.size(), 4u);
+    BOOST_REQUIRE_EQUAL(instance.cost(), 4u);
+    instance.resize(0);
+    BOOST_REQUIRE(!instance.enabled());
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.cost(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(sharded_map__clear__inserted__empty_counters_retained)
+{
+    map instance(10);
+    instance.insert(make_key(1), 1);
+    BOOST_REQUIRE(instance.contains(make_key(1)));
+    instance.clear();
+    BOOST_REQUIRE(instance.enabled());
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.cost(), 0u);
+    BOOST_REQUIRE(!instance.contains(make_key(1)));
+    BOOST_REQUIRE_EQUAL(instance.hits(), 1u);
+    BOOST_REQUIRE(instance.insert(make_key(1), 1));
+    BOOST_REQUIRE(instance.contains(make_key(1)));
+}
+
+BOOST_AUTO_TEST_CASE(sharded_map__visit__inserted_and_cleared__visits_present_entries)
+{
+    map instance(10, 4);
+    instance.insert(make_key(1), 1);
+    instance.insert(make_key(2), 2);
+    instance.insert(make_key(3), 3);
+
+    uint32_t total = 0;
+    size_t count = 0;
+    instance.visit([&](const hash_digest& key, uint32_t value)
+    {
+        BOOST_REQUIRE(key == make_key(value));
+        total += value;
+        ++count;
+    });
+
+    BOOST_REQUIRE_EQUAL(count, 3u);
+    BOOST_REQUIRE_EQUAL(total, 6u);
+
+    instance.clear();
+    instance.visit([&](const hash_digest&, uint32_t)
+    {
+        ++count;
+    });
+
+    BOOST_REQUIRE_EQUAL(count, 3u);
+}
+
+BOOST_AUTO_TEST_CASE(sharded_map__insert__concurrent__bounded)
+{
+    static const size_t threads = 4;
+    static const uint32_t count = 10000;
+    map instance(256);
+    std::atomic<bool> exceeded(false);
+    std::vector<std::thread> workers;
+
+    for (size_t thread = 0; thread < threads; ++thread)
+    {
+        workers.emplace_back([&instance, &exceeded, thread]()
+        {
+            uint32_t value;
+
+            for (uint32_t index = 0; index < count; ++index)
+            {
+                const auto key = make_key(index * threads + thread);
+                instance.insert(key, index);
+                instance.find(value, key);
+
+                if (instance.cost() > instance.capacity())
+                    exceeded = true;
+            }
+        });
+    }
+
+    for (auto& worker: workers)
+        worker.join();
+
+    BOOST_REQUIRE(!exceeded);
+    BOOST_REQUIRE_EQUAL(instance.cost(), instance.size());
+    BOOST_REQUIRE_LE(instance.size(), 256u);
+    BOOST_REQUIRE_EQUAL(instance.size(), instance.insertions() - instance.evictions());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(shared_snapshot_tests)
+
+BOOST_AUTO_TEST_CASE(shared_snapshot__load__default__empty)
+{
+    const shared_snapshot<std::string> instance;
+    BOOST_REQUIRE(!instance.load());
+}
+
+BOOST_AUTO_TEST_CASE(shared_snapshot__store__retained_by_reader)
+{
+    shared_snapshot<std::string> instance(
+        std::make_shared<const std::string>("first"));
+    const auto first = instance.load();
+
+    instance.store(std::make_shared<const std::string>("second"));
+    instance.store(std::make_shared<const std::string>("third"));
+    BOOST_REQUIRE_EQUAL(*first, "first");
+    BOOST_REQUIRE_EQUAL(*instance.load(), "third");
+    BOOST_REQUIRE(first.unique());
+}
+
+BOOST_AUTO_TEST_CASE(shared_snapshot__load__concurrent_store__consistent)
+{
+    typedef std::vector<size_t> values;
+    shared_snapshot<values> instance(std::make_shared<const values>(4, 0));
+    std::atomic<bool> stop(false);
+    std::atomic<size_t> inconsistent(0);
+
+    std::vector<std::thread> readers;
+    for (size_t reader = 0; reader < 3; ++reader)
+    {
+        readers.emplace_back([&]()
+        {
+            while (!stop)
+            {
+                const auto snapshot = instance.load();
+                for (const auto value: *snapshot)
+                    if (value != snapshot->front())
+                        ++inconsistent;
+            }
+        });
+    }
+
+    for (size_t value = 1; value < 20000; ++value)
+        instance.store(std::make_shared<const values>(4, value));
+
+    stop = true;
+    for (auto& reader: readers)
+        reader.join();
+
+    BOOST_REQUIRE_EQUAL(inconsistent.load(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.load()->front(), 19999u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,119 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(shared_window_tests)
+
+typedef shared_window<uint32_t> window;
+
+static std::vector<uint32_t> values(const window& instance)
+{
+    return { instance.begin(), instance.end() };
+}
+
+BOOST_AUTO_TEST_CASE(shared_window__construct__default__empty)
+{
+    const window instance;
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE(instance.begin() == instance.end());
+}
+
+BOOST_AUTO_TEST_CASE(shared_window__construct__initializer_list__ordered)
+{
+    const window instance{ 1, 2, 3 };
+    BOOST_REQUIRE_EQUAL(instance.size(), 3u);
+    BOOST_REQUIRE_EQUAL(instance.front(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.back(), 3u);
+    BOOST_REQUIRE_EQUAL(instance[1], 2u);
+    BOOST_REQUIRE_EQUAL(*instance.crbegin(), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(shared_window__pop_front__values__slides)
+{
+    window instance{ 1, 2, 3 };
+    instance.pop_front();
+    instance.push_back(4);
+    BOOST_REQUIRE(values(instance) == (std::vector<uint32_t>{ 2, 3, 4 }));
+}
+
+BOOST_AUTO_TEST_CASE(shared_window__push_back__copy_at_end__shares_storage)
+{
+    const window parent{ 1, 2, 3 };
+    window child(parent);
+    child.push_back(4);
+    BOOST_REQUIRE(child.begin() == parent.begin());
+    BOOST_REQUIRE(values(parent) == (std::vector<uint32_t>{ 1, 2, 3 }));
+    BOOST_REQUIRE(values(child) == (std::vector<uint32_t>{ 1, 2, 3, 4 }));
+}
+
+BOOST_AUTO_TEST_CASE(shared_window__push_back__sibling__copies_storage)
+{
+    const window parent{ 1, 2, 3 };
+    window first(parent);
+    window second(parent);
+    first.push_back(4);
+    second.push_back(5);
+    BOOST_REQUIRE(first.begin() == parent.begin());
+    BOOST_REQUIRE(second.begin() != parent.begin());
+    BOOST_REQUIRE(values(first) == (std::vector<uint32_t>{ 1, 2, 3, 4 }));
+    BOOST_REQUIRE(values(second) == (std::vector<uint32_t>{ 1, 2, 3, 5 }));
+    BOOST_REQUIRE(values(parent) == (std::vector<uint32_t>{ 1, 2, 3 }));
+}
+
+BOOST_AUTO_TEST_CASE(shared_window__push_back__sliding_beyond_capacity__expected)
+{
+    window instance;
+    std::vector<window> history;
+
+    for (uint32_t value = 0; value < 1000; ++value)
+    {
+        instance.push_back(value);
+
+        if (instance.size() > 11)
+            instance.pop_front();
+
+        history.push_back(instance);
+    }
+
+    BOOST_REQUIRE_EQUAL(instance.size(), 11u);
+    BOOST_REQUIRE_EQUAL(instance.front(), 989u);
+    BOOST_REQUIRE_EQUAL(instance.back(), 999u);
+
+    // Earlier windows are unaffected by later extension.
+    BOOST_REQUIRE_EQUAL(history[500].front(), 490u);
+    BOOST_REQUIRE_EQUAL(history[500].back(), 500u);
+}
+
+BOOST_AUTO_TEST_CASE(shared_window__clear__values__empty)
+{
+    window instance{ 1, 2, 3 };
+    instance.clear();
+    BOOST_REQUIRE(instance.empty());
+    instance.push_back(42);
+    BOOST_REQUIRE_EQUAL(instance.front(), 42u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
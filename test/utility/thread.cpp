@@ -18,7 +18,9 @@
  */
 #include <boost/test/unit_test.hpp>
 
+#include <future>
 #include <stdexcept>
+#include <string>
 #include <bitcoin/bitcoin.hpp>
 
 #ifdef _MSC_VER
@@ -112,4 +114,42 @@ BOOST_AUTO_TEST_CASE(thread__set_thread_priority__invalid__throws_invalid_argume
     BOOST_REQUIRE_THROW(set_priority(static_cast<thread_priority>(42)), std::invalid_argument);
 }
 
+BOOST_AUTO_TEST_CASE(thread__set_affinity__empty__false)
+{
+    BOOST_REQUIRE(!set_affinity({}));
+}
+
+#ifdef __linux__
+
+BOOST_AUTO_TEST_CASE(thread__threadpool__options__named_and_pinned)
+{
+    thread_options options;
+    options.cores = { 0 };
+    options.numa_local = true;
+    options.name = "bc_test_";
+
+    std::promise<std::string> name;
+    std::promise<bool> pinned;
+    threadpool pool(1, options);
+
+    pool.service().post([&name, &pinned]()
+    {
+        char buffer[16] = { 0 };
+        pthread_getname_np(pthread_self(), buffer, sizeof(buffer));
+        name.set_value(buffer);
+
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        pthread_getaffinity_np(pthread_self(), sizeof(set), &set);
+        pinned.set_value(CPU_COUNT(&set) == 1 && CPU_ISSET(0, &set));
+    });
+
+    BOOST_REQUIRE_EQUAL(name.get_future().get(), "bc_test_0");
+    BOOST_REQUIRE(pinned.get_future().get());
+    pool.shutdown();
+    pool.join();
+}
+
+#endif
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,151 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <thread>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(timer_wheel_tests)
+
+BOOST_AUTO_TEST_CASE(timer_wheel__arm__elapsed__invoked_with_success)
+{
+    threadpool pool(1);
+    timer_wheel wheel(pool);
+    const auto entry = wheel.create();
+    std::promise<code> result;
+    const auto start = asio::steady_clock::now();
+
+    wheel.arm(*entry, [&result](const code& ec) { result.set_value(ec); },
+        asio::milliseconds(5));
+
+    BOOST_REQUIRE_EQUAL(result.get_future().get(), error::success);
+    BOOST_REQUIRE(asio::steady_clock::now() - start >= asio::milliseconds(5));
+    BOOST_REQUIRE_EQUAL(wheel.armed(), 0u);
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(timer_wheel__cancel__armed__not_invoked)
+{
+    threadpool pool(1);
+    timer_wheel wheel(pool);
+    const auto canceled = wheel.create();
+    const auto entry = wheel.create();
+    std::atomic<bool> invoked(false);
+    std::promise<void> complete;
+
+    wheel.arm(*canceled, [&invoked](const code&) { invoked = true; },
+        asio::milliseconds(2));
+    BOOST_REQUIRE_EQUAL(wheel.armed(), 1u);
+    wheel.cancel(*canceled);
+    BOOST_REQUIRE_EQUAL(wheel.armed(), 0u);
+
+    // The later timer expires after the canceled timer would have.
+    wheel.arm(*entry, [&complete](const code&) { complete.set_value(); },
+        asio::milliseconds(10));
+
+    complete.get_future().wait();
+    BOOST_REQUIRE(!invoked);
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(timer_wheel__arm__rearmed__only_last_invoked)
+{
+    threadpool pool(1);
+    timer_wheel wheel(pool);
+    const auto entry = wheel.create();
+    std::atomic<size_t> first(0);
+    std::promise<void> complete;
+
+    wheel.arm(*entry, [&first](const code&) { ++first; },
+        asio::milliseconds(2));
+    wheel.arm(*entry, [&complete](const code&) { complete.set_value(); },
+        asio::milliseconds(4));
+
+    BOOST_REQUIRE_EQUAL(wheel.armed(), 1u);
+    complete.get_future().wait();
+    BOOST_REQUIRE_EQUAL(first.load(), 0u);
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(timer_wheel__arm__beyond_one_revolution__expires_in_order)
+{
+    static const size_t count = 20;
+    threadpool pool(1);
+
+    // A revolution is 8ms, so most timers require multiple rounds.
+    timer_wheel wheel(pool, asio::milliseconds(1), 8);
+    std::vector<timer_wheel::timer::ptr> entries;
+    std::vector<size_t> order;
+    std::promise<void> complete;
+
+    for (size_t index = 0; index < count; ++index)
+        entries.push_back(wheel.create());
+
+    // Arm in reverse, with distinct expirations two ticks apart.
+    for (size_t index = count; index > 0; --index)
+    {
+        const auto position = index - 1;
+        wheel.arm(*entries[position], [&, position](const code&)
+        {
+            order.push_back(position);
+            if (order.size() == count)
+                complete.set_value();
+        }, asio::milliseconds(2 * (position + 1)));
+    }
+
+    complete.get_future().wait();
+
+    for (size_t index = 0; index < count; ++index)
+        BOOST_REQUIRE_EQUAL(order[index], index);
+
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(timer_wheel__deadline__attached__expires_and_stops)
+{
+    threadpool pool(1);
+    timer_wheel wheel(pool);
+    const auto timer = std::make_shared<deadline>(pool, wheel,
+        asio::milliseconds(2));
+    std::promise<code> result;
+    std::atomic<bool> stopped_invoked(false);
+
+    timer->start([&stopped_invoked](const code&) { stopped_invoked = true; });
+    timer->stop();
+    BOOST_REQUIRE_EQUAL(wheel.armed(), 0u);
+
+    timer->start([&result](const code& ec) { result.set_value(ec); });
+    BOOST_REQUIRE_EQUAL(result.get_future().get(), error::success);
+    BOOST_REQUIRE(!stopped_invoked);
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
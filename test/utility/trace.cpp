@@ -0,0 +1,189 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+#include <string>
+#include <thread>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(trace_tests)
+
+// Recording is process-wide, so each case starts from a stopped and cleared
+// recorder and leaves it stopped.
+struct trace_fixture
+{
+    trace_fixture()
+    {
+        trace_events::stop();
+        trace_events::clear();
+    }
+
+    ~trace_fixture()
+    {
+        trace_events::stop();
+        trace_events::clear();
+    }
+};
+
+static size_t occurrences(const std::string& text, const std::string& part)
+{
+    size_t count = 0;
+    for (auto at = text.find(part); at != std::string::npos;
+        at = text.find(part, at + part.size()))
+        ++count;
+
+    return count;
+}
+
+BOOST_FIXTURE_TEST_CASE(trace__span__not_recording__not_recorded, trace_fixture)
+{
+    {
+        trace_span span("test", "stopped");
+    }
+
+    BOOST_REQUIRE_EQUAL(trace_events::size(), 0u);
+}
+
+BOOST_FIXTURE_TEST_CASE(trace__span__recording__recorded, trace_fixture)
+{
+    trace_events::start();
+
+    {
+        trace_span span("test", "recorded");
+    }
+
+    BOOST_REQUIRE_EQUAL(trace_events::size(), 1u);
+    BOOST_REQUIRE_EQUAL(trace_events::dropped(), 0u);
+}
+
+BOOST_FIXTURE_TEST_CASE(trace__span__stopped_during_span__recorded, trace_fixture)
+{
+    trace_events::start();
+
+    {
+        trace_span span("test", "stopped");
+        trace_events::stop();
+    }
+
+    BOOST_REQUIRE_EQUAL(trace_events::size(), 1u);
+}
+
+BOOST_FIXTURE_TEST_CASE(trace__clear__recorded__empty, trace_fixture)
+{
+    trace_events::start();
+    trace_events::record("test", "cleared", 1, 2);
+    BOOST_REQUIRE_EQUAL(trace_events::size(), 1u);
+
+    trace_events::clear();
+    BOOST_REQUIRE_EQUAL(trace_events::size(), 0u);
+
+    trace_events::record("test", "after", 3, 4);
+    BOOST_REQUIRE_EQUAL(trace_events::size(), 1u);
+}
+
+BOOST_FIXTURE_TEST_CASE(trace__record__threads__each_thread_recorded, trace_fixture)
+{
+    trace_events::start();
+    const auto work = []()
+    {
+        for (auto span = 0; span < 10; ++span)
+            trace_events::record("test", "thread", 1, 2);
+    };
+
+    std::thread first(work);
+    std::thread second(work);
+    first.join();
+    second.join();
+
+    // Buffers of exited threads are exported.
+    BOOST_REQUIRE_EQUAL(trace_events::size(), 20u);
+
+    std::ostringstream out;
+    trace_events::write(out);
+    BOOST_REQUIRE_EQUAL(occurrences(out.str(), "\"ph\":\"X\""), 20u);
+}
+
+BOOST_FIXTURE_TEST_CASE(trace__record__full_buffer__dropped, trace_fixture)
+{
+    trace_events::start(4);
+
+    // A new thread allocates its buffer with the current capacity.
+    std::thread thread([]()
+    {
+        for (auto span = 0; span < 10; ++span)
+            trace_events::record("test", "full", 1, 2);
+    });
+
+    thread.join();
+    trace_events::start();
+    BOOST_REQUIRE_EQUAL(trace_events::size(), 4u);
+    BOOST_REQUIRE_EQUAL(trace_events::dropped(), 6u);
+}
+
+BOOST_FIXTURE_TEST_CASE(trace__write__span__expected_event, trace_fixture)
+{
+    trace_events::start();
+    trace_events::record("category", "name", 1500, 3001);
+
+    std::ostringstream out;
+    trace_events::write(out);
+    const auto text = out.str();
+    BOOST_REQUIRE_EQUAL(text.find("{\"displayTimeUnit\":\"ns\""), 0u);
+    BOOST_REQUIRE(text.find("\"name\":\"name\",\"cat\":\"category\",\"ph\":\"X\",\"ts\":1.500,\"dur\":1.501,") != std::string::npos);
+    BOOST_REQUIRE_EQUAL(occurrences(text, "\"name\":\"thread_name\",\"ph\":\"M\""), 1u);
+    BOOST_REQUIRE_EQUAL(text.substr(text.size() - 4), "\n]}\n");
+}
+
+BOOST_FIXTURE_TEST_CASE(trace__write__escaped_name__escaped, trace_fixture)
+{
+    trace_events::start();
+    trace_events::record("test", "a\"b\\c\n", 0, 0);
+
+    std::ostringstream out;
+    trace_events::write(out);
+    BOOST_REQUIRE(out.str().find("\"name\":\"a\\\"b\\\\c\\u000a\"") != std::string::npos);
+}
+
+BOOST_FIXTURE_TEST_CASE(trace__write__empty__no_events, trace_fixture)
+{
+    std::ostringstream out;
+    trace_events::write(out);
+    BOOST_REQUIRE_EQUAL(occurrences(out.str(), "\"ph\":\"X\""), 0u);
+    BOOST_REQUIRE(out.str().find("\"dropped\":0") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(trace__intern__equal_names__same_pointer)
+{
+    const auto first = trace_events::intern(std::string("interned"));
+    const auto second = trace_events::intern(std::string("interned"));
+    BOOST_REQUIRE_EQUAL(first, second);
+    BOOST_REQUIRE_EQUAL(std::string(first), "interned");
+}
+
+BOOST_AUTO_TEST_CASE(trace__now__always__nondecreasing)
+{
+    const auto first = trace_events::now();
+    const auto second = trace_events::now();
+    BOOST_REQUIRE_GE(second, first);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
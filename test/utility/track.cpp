@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::log;
+
+BOOST_AUTO_TEST_SUITE(track_tests)
+
+class tracked
+  : track<tracked>
+{
+public:
+    tracked()
+      : CONSTRUCT_TRACK(tracked)
+    {
+    }
+};
+
+static size_t live(const std::string& class_name)
+{
+    for (const auto& entry: track_registry::counts())
+        if (entry.class_name == class_name)
+            return entry.live;
+
+    return 0;
+}
+
+BOOST_AUTO_TEST_CASE(track__construct__destruct__live_restored_total_increased)
+{
+    auto& counters = track_registry::counters("tracked");
+    const auto initial_live = counters.live.load();
+    const auto initial_total = counters.total.load();
+
+    {
+        const tracked first;
+        const tracked second;
+        BOOST_REQUIRE_EQUAL(live("tracked"), initial_live + 2);
+    }
+
+    BOOST_REQUIRE_EQUAL(live("tracked"), initial_live);
+    BOOST_REQUIRE_EQUAL(counters.total.load(), initial_total + 2);
+}
+
+BOOST_AUTO_TEST_CASE(track_registry__counters__same_name__same_instance)
+{
+    BOOST_REQUIRE(&track_registry::counters("x") ==
+        &track_registry::counters("x"));
+    BOOST_REQUIRE(&track_registry::counters("x") !=
+        &track_registry::counters("y"));
+}
+
+BOOST_AUTO_TEST_CASE(track_registry__publish__live_instance__live_gauge)
+{
+    const std::unique_ptr<tracked> instance(new tracked);
+    metrics registry;
+    track_registry::publish(registry);
+    BOOST_REQUIRE_EQUAL(registry.get_gauge("track.tracked.live").value(),
+        live("tracked"));
+    BOOST_REQUIRE_GE(registry.get_gauge("track.tracked.total").value(), 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,117 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+
+BOOST_AUTO_TEST_SUITE(work_stealing_pool_tests)
+
+BOOST_AUTO_TEST_CASE(work_stealing_pool__size__three_threads__three)
+{
+    work_stealing_pool pool(3);
+    BOOST_REQUIRE(!pool.empty());
+    BOOST_REQUIRE_EQUAL(pool.size(), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(work_stealing_pool__empty__default__true)
+{
+    work_stealing_pool pool;
+    BOOST_REQUIRE(pool.empty());
+    BOOST_REQUIRE_EQUAL(pool.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(work_stealing_pool__post__external_jobs__all_executed)
+{
+    static const size_t jobs = 1000;
+    std::atomic<size_t> count(0);
+
+    {
+        work_stealing_pool pool(4);
+
+        for (size_t job = 0; job < jobs; ++job)
+            pool.post([&count]() { ++count; });
+
+        pool.shutdown();
+        pool.join();
+    }
+
+    BOOST_REQUIRE_EQUAL(count.load(), jobs);
+}
+
+BOOST_AUTO_TEST_CASE(work_stealing_pool__post__nested_jobs__all_executed)
+{
+    static const size_t parents = 10;
+    static const size_t children = 100;
+    std::atomic<size_t> count(0);
+
+    {
+        work_stealing_pool pool(4);
+
+        for (size_t parent = 0; parent < parents; ++parent)
+        {
+            pool.post([&pool, &count]()
+            {
+                for (size_t child = 0; child < children; ++child)
+                    pool.post([&count]() { ++count; });
+            });
+        }
+
+        // Shutdown drains the jobs, including those posted by other jobs.
+        pool.shutdown();
+        pool.join();
+    }
+
+    BOOST_REQUIRE_EQUAL(count.load(), parents * children);
+}
+
+BOOST_AUTO_TEST_CASE(work_stealing_pool__destructor__pending_jobs__all_executed)
+{
+    static const size_t jobs = 100;
+    std::atomic<size_t> count(0);
+
+    {
+        work_stealing_pool pool(2);
+
+        for (size_t job = 0; job < jobs; ++job)
+            pool.post([&count]() { ++count; });
+    }
+
+    BOOST_REQUIRE_EQUAL(count.load(), jobs);
+}
+
+BOOST_AUTO_TEST_CASE(work_stealing_pool__dispatcher_concurrent__executor__executed)
+{
+    threadpool pool(1);
+    work_stealing_pool executor(2);
+    dispatcher dispatch(pool, executor, "test");
+    std::promise<bool> promise;
+
+    dispatch.concurrent([&promise]() { promise.set_value(true); });
+    BOOST_REQUIRE(promise.get_future().get());
+
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
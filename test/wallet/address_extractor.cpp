@@ -0,0 +1,158 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::chain;
+using namespace bc::wallet;
+
+BOOST_AUTO_TEST_SUITE(address_extractor_tests)
+
+// $ bx base16-encode "Satoshi" | bx sha256 | bx ec-to-public
+#define COMPRESSED "03d24123978d696a6c964f2dcb1d1e000d4150102fbbcc37f020401e35fb4cb745"
+// $ bx base16-encode "Satoshi" | bx sha256 | bx ec-to-public -u
+#define UNCOMPRESSED "04d24123978d696a6c964f2dcb1d1e000d4150102fbbcc37f020401e35fb4cb74561a3362716303b0469f04c3d0e3cbc4b5b62a2da7add6ecc3b254404b12d2f83"
+#define COMPRESSED_HASH "f85beb6356d0813ddb0dbb14230a249fe931a135"
+#define UNCOMPRESSED_HASH "96ec4e06c665b7bd62cbe3d232f7c2d34016e136"
+#define SCRIPT_HASH "18c0bd8d1818f1bf99cb1df2269c645318ef7b73"
+
+static script make_script(const std::string& mnemonic)
+{
+    script instance;
+    BOOST_REQUIRE(instance.from_string(mnemonic));
+    return instance;
+}
+
+static const data_chunk endorsement(71, 0x30);
+
+static transaction make_transaction()
+{
+    const auto sign_key_hash = make_script("[" + encode_base16(endorsement) + "] [" COMPRESSED "]");
+    const auto sign_script_hash = make_script("zero [" + encode_base16(endorsement) + "] [51]");
+    const auto non_standard = make_script("dup drop");
+
+    return
+    {
+        1, 0,
+        {
+            { { null_hash, 0 }, sign_key_hash, 0 },
+            { { null_hash, 1 }, sign_script_hash, 0 },
+            { { null_hash, 2 }, non_standard, 0 }
+        },
+        {
+            { 1, make_script("dup hash160 [" COMPRESSED_HASH "] equalverify checksig") },
+            { 2, make_script("hash160 [" SCRIPT_HASH "] equal") },
+            { 3, make_script("[" COMPRESSED "] checksig") },
+            { 4, make_script("[" UNCOMPRESSED "] checksig") },
+            { 5, make_script("return [42]") }
+        }
+    };
+}
+
+static void require_row(const address_extractor::row& row,
+    const payment_address& expected, const point& point, uint64_t value,
+    bool output)
+{
+    BOOST_REQUIRE(expected);
+    BOOST_REQUIRE_EQUAL(encode_base16(row.hash), encode_base16(expected.hash()));
+    BOOST_REQUIRE_EQUAL(row.version, expected.version());
+    BOOST_REQUIRE(row.point == point);
+    BOOST_REQUIRE_EQUAL(row.value, value);
+    BOOST_REQUIRE_EQUAL(row.output, output);
+}
+
+BOOST_AUTO_TEST_CASE(address_extractor__extract__transaction__same_as_payment_address)
+{
+    const auto tx = make_transaction();
+    const auto& hash = tx.hash();
+    const auto& inputs = tx.inputs();
+    const auto& outputs = tx.outputs();
+    const address_extractor instance;
+    const auto rows = instance.extract(tx);
+    BOOST_REQUIRE_EQUAL(rows.size(), 6u);
+
+    const auto extract_input = [&](size_t index)
+    {
+        return payment_address::extract_input(inputs[index].script()).front();
+    };
+
+    const auto extract_output = [&](size_t index)
+    {
+        return payment_address::extract_output(outputs[index].script()).front();
+    };
+
+    require_row(rows[0], extract_input(0), { hash, 0 }, output::not_found, false);
+    require_row(rows[1], extract_input(1), { hash, 1 }, output::not_found, false);
+    require_row(rows[2], extract_output(0), { hash, 0 }, 1, true);
+    require_row(rows[3], extract_output(1), { hash, 1 }, 2, true);
+    require_row(rows[4], extract_output(2), { hash, 2 }, 3, true);
+    require_row(rows[5], extract_output(3), { hash, 3 }, 4, true);
+    BOOST_REQUIRE_EQUAL(encode_base16(rows[4].hash), COMPRESSED_HASH);
+    BOOST_REQUIRE_EQUAL(encode_base16(rows[5].hash), UNCOMPRESSED_HASH);
+}
+
+BOOST_AUTO_TEST_CASE(address_extractor__extract__populated_prevout__prevout_address_and_value)
+{
+    const auto tx = make_transaction();
+    const auto prevout = make_script("hash160 [" SCRIPT_HASH "] equal");
+    tx.inputs()[0].previous_output().metadata->cache = output{ 42, prevout };
+
+    const address_extractor instance(payment_address::testnet_p2kh, payment_address::testnet_p2sh);
+    const auto rows = instance.extract(tx);
+    BOOST_REQUIRE_EQUAL(rows.size(), 6u);
+
+    const auto expected = payment_address::extract_output(prevout, payment_address::testnet_p2kh, payment_address::testnet_p2sh).front();
+    require_row(rows[0], expected, { tx.hash(), 0 }, 42, false);
+    BOOST_REQUIRE_EQUAL(rows[0].version, payment_address::testnet_p2sh);
+}
+
+BOOST_AUTO_TEST_CASE(address_extractor__extract__block_pool__same_as_serial)
+{
+    transaction::list txs;
+    for (uint32_t lock_time = 0; lock_time < 40; ++lock_time)
+    {
+        auto tx = make_transaction();
+        tx.set_locktime(lock_time);
+        txs.push_back(tx);
+    }
+
+    block instance;
+    instance.set_transactions(std::move(txs));
+
+    threadpool pool(2);
+    const address_extractor extractor;
+    const auto serial = extractor.extract(instance);
+    const auto concurrent = extractor.extract(instance, pool);
+    BOOST_REQUIRE_EQUAL(serial.size(), 40u * 6u);
+    BOOST_REQUIRE_EQUAL(concurrent.size(), serial.size());
+
+    for (size_t index = 0; index < serial.size(); ++index)
+    {
+        BOOST_REQUIRE(concurrent[index].hash == serial[index].hash);
+        BOOST_REQUIRE(concurrent[index].point == serial[index].point);
+        BOOST_REQUIRE_EQUAL(concurrent[index].value, serial[index].value);
+        BOOST_REQUIRE_EQUAL(concurrent[index].output, serial[index].output);
+    }
+
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,111 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::wallet;
+
+BOOST_AUTO_TEST_SUITE(address_generator_tests)
+
+// $ bx base16-encode "Satoshi" | bx sha256
+#define SECRET "002688cc350a5333a87fa622eacec626c3d1c0ebf9f3793de3885fa254d7e393"
+#define ADDRESS_COMPRESSED "1PeChFbhxDD9NLbU21DfD55aQBC4ZTR3tE"
+#define ADDRESS_UNCOMPRESSED "1Em1SX7qQq1pTmByqLRafhL1ypx2V786tP"
+#define ADDRESS_COMPRESSED_TESTNET "n4A9zJggmEeQ9T55jaC32zHuGAnmSzPU2L"
+
+static secret_list make_secrets(size_t count)
+{
+    secret_list secrets;
+    for (size_t index = 0; index < count; ++index)
+        secrets.push_back(sha256_hash(to_chunk(to_little_endian(index))));
+
+    return secrets;
+}
+
+static std::string expected_address(const ec_secret& secret, bool compress,
+    uint8_t version)
+{
+    ec_compressed point;
+    BOOST_REQUIRE(secret_to_public(point, secret));
+    return payment_address(ec_public(point, compress), version).encoded();
+}
+
+BOOST_AUTO_TEST_CASE(address_generator__generate__secret__expected)
+{
+    ec_secret secret;
+    BOOST_REQUIRE(decode_base16(secret, SECRET));
+    string_list out;
+
+    BOOST_REQUIRE(address_generator().generate(out, { secret }));
+    BOOST_REQUIRE_EQUAL(out.size(), 1u);
+    BOOST_REQUIRE_EQUAL(out[0], ADDRESS_COMPRESSED);
+
+    BOOST_REQUIRE(address_generator(false).generate(out, { secret }));
+    BOOST_REQUIRE_EQUAL(out[0], ADDRESS_UNCOMPRESSED);
+
+    const address_generator testnet(true, payment_address::testnet_p2kh);
+    BOOST_REQUIRE(testnet.generate(out, { secret }));
+    BOOST_REQUIRE_EQUAL(out[0], ADDRESS_COMPRESSED_TESTNET);
+}
+
+BOOST_AUTO_TEST_CASE(address_generator__generate__invalid_secret__empty_false)
+{
+    auto secrets = make_secrets(3);
+    secrets[1] = null_hash;
+    string_list out;
+
+    BOOST_REQUIRE(!address_generator().generate(out, secrets));
+    BOOST_REQUIRE_EQUAL(out.size(), 3u);
+    BOOST_REQUIRE(out[1].empty());
+    BOOST_REQUIRE_EQUAL(out[0], expected_address(secrets[0], true, 0x00));
+    BOOST_REQUIRE_EQUAL(out[2], expected_address(secrets[2], true, 0x00));
+}
+
+BOOST_AUTO_TEST_CASE(address_generator__generate__multiple_batches__expected)
+{
+    const auto count = 2 * address_generator::batch_size + 3;
+    const auto secrets = make_secrets(count);
+    string_list out;
+
+    BOOST_REQUIRE(address_generator(false).generate(out, secrets));
+    BOOST_REQUIRE_EQUAL(out.size(), count);
+
+    for (size_t index = 0; index < count; ++index)
+        BOOST_REQUIRE_EQUAL(out[index],
+            expected_address(secrets[index], false, 0x00));
+}
+
+BOOST_AUTO_TEST_CASE(address_generator__generate__pool__same_as_serial)
+{
+    const auto secrets = make_secrets(5 * address_generator::batch_size + 1);
+    const address_generator generator;
+    threadpool pool(4);
+    string_list serial;
+    string_list parallel;
+
+    BOOST_REQUIRE(generator.generate(serial, secrets));
+    BOOST_REQUIRE(generator.generate(parallel, secrets, pool));
+    BOOST_REQUIRE(serial == parallel);
+
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,305 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <fstream>
+#include <boost/filesystem.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::chain;
+using namespace bc::wallet;
+
+typedef address_index::posting posting;
+
+struct address_index_fixture
+{
+    ~address_index_fixture()
+    {
+        set_cpu_features(all_features);
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(address_index_tests, address_index_fixture)
+
+// Test helpers.
+static boost::filesystem::path temporary_file()
+{
+    return boost::filesystem::temp_directory_path() /
+        boost::filesystem::unique_path("address_index-%%%%-%%%%.dat");
+}
+
+static short_hash get_key(uint8_t value)
+{
+    short_hash key{};
+    key[0] = value;
+    key[19] = value;
+    return key;
+}
+
+// Deterministic postings of widely ranging fields, links not following
+// heights.
+static posting::list get_postings(size_t count, uint64_t seed)
+{
+    posting::list postings;
+    auto state = seed;
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        state = state * 6364136223846793005 + 1442695040888963407;
+        const auto bits = state >> 16;
+        postings.push_back(
+        {
+            static_cast<size_t>(index / 3 + (bits & 0x3)),
+            bits % 2 == 0 ? bits & 0xffff : state,
+            static_cast<uint32_t>((bits >> 8) & (index % 2 == 0 ? 0xff :
+                0x7fffffff)),
+            index % 5 == 0 ? output::not_found : (bits >> 20) & 0xffffffffff,
+            (bits & 0x10) != 0
+        });
+    }
+
+    std::sort(postings.begin(), postings.end());
+    return postings;
+}
+
+static void require_equal(const posting::list& left,
+    const posting::list& right)
+{
+    BOOST_REQUIRE_EQUAL(left.size(), right.size());
+
+    for (size_t index = 0; index < left.size(); ++index)
+        BOOST_REQUIRE(left[index] == right[index]);
+}
+
+static void store(const boost::filesystem::path& file,
+    const std::vector<posting::list>& lists, uint8_t first_key)
+{
+    address_index_builder builder;
+
+    for (size_t index = 0; index < lists.size(); ++index)
+        for (const auto& posting: lists[index])
+            builder.add(get_key(static_cast<uint8_t>(first_key + index)),
+                posting);
+
+    BOOST_REQUIRE(builder.store(file));
+}
+
+BOOST_AUTO_TEST_CASE(address_index__open__missing__false)
+{
+    address_index instance;
+    BOOST_REQUIRE(!instance.open(temporary_file()));
+    BOOST_REQUIRE(!instance.is_open());
+}
+
+BOOST_AUTO_TEST_CASE(address_index__open__truncated__false)
+{
+    const auto file = temporary_file();
+    store(file, { get_postings(10, 1), get_postings(10, 2) }, 0);
+    boost::filesystem::resize_file(file, address_index::prefix_size +
+        address_index::key_size);
+
+    address_index instance;
+    BOOST_REQUIRE(!instance.open(file));
+    boost::filesystem::remove(file);
+}
+
+BOOST_AUTO_TEST_CASE(address_index__store__empty__finds_none)
+{
+    const auto file = temporary_file();
+    BOOST_REQUIRE(address_index_builder().store(file));
+
+    address_index instance;
+    posting::list out;
+    BOOST_REQUIRE(instance.open(file));
+    BOOST_REQUIRE_EQUAL(instance.keys(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE(!instance.find(out, get_key(0)));
+    instance.close();
+    boost::filesystem::remove(file);
+}
+
+BOOST_AUTO_TEST_CASE(address_index__find__stored__ordered_postings)
+{
+    const auto file = temporary_file();
+    const std::vector<posting::list> lists
+    {
+        get_postings(1, 1), get_postings(3, 2), get_postings(4, 3),
+        get_postings(5, 4), get_postings(1000, 5)
+    };
+
+    store(file, lists, 10);
+
+    address_index instance;
+    BOOST_REQUIRE(instance.open(file));
+    BOOST_REQUIRE_EQUAL(instance.keys(), 5u);
+    BOOST_REQUIRE_EQUAL(instance.size(), 1013u);
+
+    for (size_t index = 0; index < lists.size(); ++index)
+    {
+        posting::list out;
+        BOOST_REQUIRE(instance.find(out, get_key(
+            static_cast<uint8_t>(10 + index))));
+        require_equal(out, lists[index]);
+    }
+
+    posting::list out;
+    BOOST_REQUIRE(!instance.find(out, get_key(9)));
+    BOOST_REQUIRE(!instance.find(out, get_key(15)));
+    BOOST_REQUIRE(out.empty());
+    instance.close();
+    boost::filesystem::remove(file);
+}
+
+BOOST_AUTO_TEST_CASE(address_index__find__portable__same_as_vector)
+{
+    const auto file = temporary_file();
+    const auto postings = get_postings(100000, 6);
+    store(file, { postings }, 0);
+
+    address_index instance;
+    posting::list vector;
+    posting::list portable;
+    BOOST_REQUIRE(instance.open(file));
+    BOOST_REQUIRE(instance.find(vector, get_key(0)));
+    set_cpu_features(no_features);
+    BOOST_REQUIRE(instance.find(portable, get_key(0)));
+    require_equal(vector, postings);
+    require_equal(portable, postings);
+    instance.close();
+    boost::filesystem::remove(file);
+}
+
+BOOST_AUTO_TEST_CASE(address_index__find__delta_coded__compact)
+{
+    const auto file = temporary_file();
+    posting::list postings;
+
+    // Consecutive heights and links encode to a byte in each column (two in
+    // that of the low value word) and a quarter byte of control in each.
+    for (uint32_t index = 0; index < 10000; ++index)
+        postings.push_back({ 500000 + index, 1000000 + index, 0, 5000,
+            true });
+
+    store(file, { postings }, 0);
+    BOOST_REQUIRE_LT(boost::filesystem::file_size(file), 10000u * 9);
+
+    address_index instance;
+    posting::list out;
+    BOOST_REQUIRE(instance.open(file));
+    BOOST_REQUIRE(instance.find(out, get_key(0)));
+    require_equal(out, postings);
+    instance.close();
+    boost::filesystem::remove(file);
+}
+
+BOOST_AUTO_TEST_CASE(address_index__merge__segments__merged_postings)
+{
+    const auto first = temporary_file();
+    const auto second = temporary_file();
+    const auto merged = temporary_file();
+    const auto shared_first = get_postings(300, 7);
+    const auto shared_second = get_postings(200, 8);
+    const auto only_first = get_postings(50, 9);
+    const auto only_second = get_postings(60, 10);
+
+    // Keys 1 and 2 in the first, 2 and 3 in the second.
+    store(first, { only_first, shared_first }, 1);
+    store(second, { shared_second, only_second }, 2);
+    BOOST_REQUIRE(address_index::merge(merged, { first, second }));
+
+    address_index instance;
+    BOOST_REQUIRE(instance.open(merged));
+    BOOST_REQUIRE_EQUAL(instance.keys(), 3u);
+    BOOST_REQUIRE_EQUAL(instance.size(), 610u);
+
+    auto expected = shared_first;
+    expected.insert(expected.end(), shared_second.begin(),
+        shared_second.end());
+    std::stable_sort(expected.begin(), expected.end());
+
+    posting::list out;
+    BOOST_REQUIRE(instance.find(out, get_key(1)));
+    require_equal(out, only_first);
+    out.clear();
+    BOOST_REQUIRE(instance.find(out, get_key(2)));
+    require_equal(out, expected);
+    out.clear();
+    BOOST_REQUIRE(instance.find(out, get_key(3)));
+    require_equal(out, only_second);
+    instance.close();
+    boost::filesystem::remove(first);
+    boost::filesystem::remove(second);
+    boost::filesystem::remove(merged);
+}
+
+BOOST_AUTO_TEST_CASE(address_index__merge__missing_segment__false)
+{
+    BOOST_REQUIRE(!address_index::merge(temporary_file(),
+        { temporary_file() }));
+}
+
+BOOST_AUTO_TEST_CASE(address_index_builder__add__block__extracted_postings)
+{
+    const auto key_hash = get_key(0x42);
+    const auto script_hash = get_key(0x43);
+    const auto pay_key = script::to_pay_key_hash_pattern(key_hash);
+    const auto pay_script = script::to_pay_script_hash_pattern(script_hash);
+
+    const transaction first
+    {
+        1, 0,
+        { { { null_hash, 0 }, script{}, 0 } },
+        { { 10, pay_key }, { 20, pay_script } }
+    };
+
+    const transaction second
+    {
+        1, 0,
+        { { { first.hash(), 0 }, script{}, 0 } },
+        { { 30, script{} }, { 40, pay_key } }
+    };
+
+    const block instance(header{}, transaction::list{ first, second });
+    address_index_builder builder;
+    threadpool pool(2);
+    builder.add(instance, 100, 7000, pool);
+    pool.shutdown();
+    pool.join();
+    BOOST_REQUIRE_EQUAL(builder.keys(), 2u);
+    BOOST_REQUIRE_EQUAL(builder.size(), 3u);
+
+    const auto file = temporary_file();
+    BOOST_REQUIRE(builder.store(file));
+
+    address_index index;
+    posting::list out;
+    BOOST_REQUIRE(index.open(file));
+    BOOST_REQUIRE(index.find(out, key_hash));
+    require_equal(out, { { 100, 7000, 0, 10, true },
+        { 100, 7001, 1, 40, true } });
+    out.clear();
+    BOOST_REQUIRE(index.find(out, script_hash));
+    require_equal(out, { { 100, 7000, 1, 20, true } });
+    index.close();
+    boost::filesystem::remove(file);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
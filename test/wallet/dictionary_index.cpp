@@ -0,0 +1,108 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::wallet;
+
+BOOST_AUTO_TEST_SUITE(dictionary_index_tests)
+
+BOOST_AUTO_TEST_CASE(dictionary_index__find__all_languages__matches_find_position)
+{
+    for (const auto lexicon: language::all)
+    {
+        const auto index = find_index(*lexicon);
+        BOOST_REQUIRE(index != nullptr);
+        BOOST_REQUIRE_EQUAL(index->size(), dictionary_size);
+
+        for (const auto word: *lexicon)
+            BOOST_REQUIRE_EQUAL(index->find(word),
+                find_position(*lexicon, std::string(word)));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(dictionary_index__find__missing__negative)
+{
+    const dictionary_index index(language::en);
+    BOOST_REQUIRE_EQUAL(index.find(""), -1);
+    BOOST_REQUIRE_EQUAL(index.find("abando"), -1);
+    BOOST_REQUIRE_EQUAL(index.find("abandonn"), -1);
+    BOOST_REQUIRE_EQUAL(index.find("Abandon"), -1);
+    BOOST_REQUIRE_EQUAL(index.find("ábaco"), -1);
+}
+
+BOOST_AUTO_TEST_CASE(dictionary_index__find__repeated_word__first_position)
+{
+    const char words[] = "alpha\0" "beta\0" "alpha\0" "gamma";
+    const uint16_t offsets[] = { 0, 6, 11, 17 };
+    const dictionary_index index(words, offsets, 4);
+    BOOST_REQUIRE_EQUAL(index.find("alpha"), 0);
+    BOOST_REQUIRE_EQUAL(index.find("beta"), 1);
+    BOOST_REQUIRE_EQUAL(index.find("gamma"), 3);
+    BOOST_REQUIRE_EQUAL(index.find("delta"), -1);
+}
+
+BOOST_AUTO_TEST_CASE(dictionary_index__find_index__copy__null)
+{
+    const auto copy = language::en;
+    BOOST_REQUIRE(find_index(copy) == nullptr);
+    BOOST_REQUIRE(find_index(language::en) != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(dictionary_index__find_word__copy__matches_built_in)
+{
+    const auto copy = language::fr;
+    BOOST_REQUIRE_EQUAL(find_word(copy, "abaisser"), 0);
+    BOOST_REQUIRE_EQUAL(find_word(language::fr, "abaisser"), 0);
+    BOOST_REQUIRE_EQUAL(find_word(copy, "zoologie"), 2047);
+    BOOST_REQUIRE_EQUAL(find_word(language::fr, "zoologie"), 2047);
+    BOOST_REQUIRE_EQUAL(find_word(copy, "ability"), -1);
+    BOOST_REQUIRE_EQUAL(find_word(language::fr, "ability"), -1);
+}
+
+BOOST_AUTO_TEST_CASE(dictionary_index__find_lexicons__english_words__en)
+{
+    const string_list words{ "abandon", "zoo", "ability" };
+    const auto lexicons = find_lexicons(words);
+    BOOST_REQUIRE_EQUAL(lexicons.size(), 1u);
+    BOOST_REQUIRE(lexicons.front() == &language::en);
+}
+
+BOOST_AUTO_TEST_CASE(dictionary_index__find_lexicons__mixed_words__empty)
+{
+    const string_list words{ "ability", "abaisser" };
+    BOOST_REQUIRE(find_lexicons(words).empty());
+}
+
+BOOST_AUTO_TEST_CASE(dictionary_index__find_lexicons__shared_word__en_fr)
+{
+    const string_list words{ "abandon" };
+    const auto lexicons = find_lexicons(words);
+    BOOST_REQUIRE_EQUAL(lexicons.size(), 2u);
+    BOOST_REQUIRE(lexicons[0] == &language::en);
+    BOOST_REQUIRE(lexicons[1] == &language::fr);
+}
+
+BOOST_AUTO_TEST_CASE(dictionary_index__find_lexicons__no_words__all)
+{
+    BOOST_REQUIRE_EQUAL(find_lexicons({}).size(), language::all.size());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
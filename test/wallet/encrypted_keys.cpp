@@ -332,6 +332,54 @@ BOOST_AUTO_TEST_CASE(encrypted__decrypt_private__vector_9_multiplied__expected)
     BOOST_REQUIRE(!out_is_compressed);
 }
 
+BOOST_AUTO_TEST_CASE(encrypted__decrypt_private__list_vectors_1_3_5__expected)
+{
+    const encrypted_private_list keys
+    {
+        base58_literal("6PRNFFkZc2NZ6dJqFfhRoFNMR9Lnyj7dYGrzdgXXVMXcxoKTePPX1dWByq"),
+        base58_literal("6PYLtMnXvfG3oJde97zRyLYFZCYizPU5T3LwgdYJz1fRhh16bU7u6PPmY7"),
+        base58_literal("6PfLGnQs6VZnrNpmVKfjotbnQuaJK4KZoPFrAjx1JMJUa1Ft8gnf5WxfKd")
+    };
+
+    threadpool pool(2);
+    ek_decryption_list secrets;
+    BOOST_REQUIRE(decrypt(secrets, keys, "Satoshi", pool));
+    pool.shutdown();
+    pool.join();
+
+    BOOST_REQUIRE_EQUAL(secrets.size(), 3u);
+    BOOST_REQUIRE(secrets[0].valid);
+    BOOST_REQUIRE_EQUAL(encode_base16(secrets[0].secret), "09c2686880095b1a4c249ee3ac4eea8a014f11e6f986d0b5025ac1f39afbd9ae");
+    BOOST_REQUIRE_EQUAL(secrets[0].version, 0x00);
+    BOOST_REQUIRE(!secrets[0].compressed);
+    BOOST_REQUIRE(secrets[1].valid);
+    BOOST_REQUIRE_EQUAL(encode_base16(secrets[1].secret), "09c2686880095b1a4c249ee3ac4eea8a014f11e6f986d0b5025ac1f39afbd9ae");
+    BOOST_REQUIRE(secrets[1].compressed);
+    BOOST_REQUIRE(secrets[2].valid);
+    BOOST_REQUIRE_EQUAL(encode_base16(secrets[2].secret), "c2c8036df268f498099350718c4a3ef3984d2be84618c2650f5171dcc5eb660a");
+    BOOST_REQUIRE(!secrets[2].compressed);
+}
+
+BOOST_AUTO_TEST_CASE(encrypted__decrypt_private__list_wrong_passphrase_zero_budget__partial)
+{
+    const encrypted_private_list keys
+    {
+        base58_literal("6PRVWUbkzzsbcVac2qwfssoUJAN1Xhrg6bNk8J7Nzm5H7kxEbn2Nh2ZoGg"),
+        base58_literal("6PRNFFkZc2NZ6dJqFfhRoFNMR9Lnyj7dYGrzdgXXVMXcxoKTePPX1dWByq")
+    };
+
+    threadpool pool(2);
+    ek_decryption_list secrets;
+    BOOST_REQUIRE(!decrypt(secrets, keys, "Satoshi", pool, 0));
+    pool.shutdown();
+    pool.join();
+
+    BOOST_REQUIRE_EQUAL(secrets.size(), 2u);
+    BOOST_REQUIRE(!secrets[0].valid);
+    BOOST_REQUIRE(secrets[1].valid);
+    BOOST_REQUIRE_EQUAL(encode_base16(secrets[1].secret), "09c2686880095b1a4c249ee3ac4eea8a014f11e6f986d0b5025ac1f39afbd9ae");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 // ----------------------------------------------------------------------------
@@ -0,0 +1,109 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::wallet;
+
+BOOST_AUTO_TEST_SUITE(hd_cache_tests)
+
+#define SHORT_SEED "000102030405060708090a0b0c0d0e0f"
+
+static hd_private to_root()
+{
+    data_chunk seed;
+    BOOST_REQUIRE(decode_base16(seed, SHORT_SEED));
+    return hd_private(seed, hd_private::mainnet);
+}
+
+static hd_private derive_uncached(const hd_private& root,
+    const hd_cache::path& indexes)
+{
+    auto node = root;
+    for (const auto index: indexes)
+        node = node.derive_private(index);
+
+    return node;
+}
+
+BOOST_AUTO_TEST_CASE(hd_cache__derive_private__empty_path__root)
+{
+    hd_cache cache;
+    const auto root = to_root();
+    BOOST_REQUIRE(cache.derive_private(root, {}) == root);
+    BOOST_REQUIRE_EQUAL(cache.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(hd_cache__derive_private__bip84_paths__expected)
+{
+    hd_cache cache;
+    const auto root = to_root();
+    const auto hard = hd_first_hardened_key;
+
+    for (uint32_t index = 0; index < 5; ++index)
+    {
+        const hd_cache::path path{ 84 + hard, hard, hard, 0, index };
+        BOOST_REQUIRE(cache.derive_private(root, path) ==
+            derive_uncached(root, path));
+    }
+
+    // Only the four intermediate levels are cached.
+    BOOST_REQUIRE_EQUAL(cache.size(), 4u);
+}
+
+BOOST_AUTO_TEST_CASE(hd_cache__derive_public__path__expected)
+{
+    hd_cache cache;
+    const auto root = to_root();
+    const hd_public root_public = root;
+    const hd_cache::path path{ 1, 2, 3 };
+
+    const auto expected = derive_uncached(root, path).to_public();
+    BOOST_REQUIRE(cache.derive_public(root_public, path) == expected);
+    BOOST_REQUIRE(cache.derive_public(root_public, path) == expected);
+    BOOST_REQUIRE_EQUAL(cache.size(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(hd_cache__derive_private__capacity__evicts)
+{
+    hd_cache cache(3);
+    const auto root = to_root();
+
+    for (uint32_t index = 0; index < 10; ++index)
+    {
+        const hd_cache::path path{ index, 0 };
+        BOOST_REQUIRE(cache.derive_private(root, path) ==
+            derive_uncached(root, path));
+    }
+
+    BOOST_REQUIRE_EQUAL(cache.size(), 3u);
+    cache.clear();
+    BOOST_REQUIRE_EQUAL(cache.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(hd_cache__derive_public__hardened__invalid)
+{
+    hd_cache cache;
+    const hd_public root_public = to_root();
+    BOOST_REQUIRE(!cache.derive_public(root_public,
+        { 0, hd_first_hardened_key }));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -95,4 +95,76 @@ BOOST_AUTO_TEST_CASE(hd_public__derive_public__long_seed__expected)
     BOOST_REQUIRE_EQUAL(m0xH1yH2_pub.encoded(), "xpub6FnCn6nSzZAw5Tw7cgR9bi15UV96gLZhjDstkXXxvCLsUXBGXPdSnLFbdpq8p9HmGsApME5hQTZ3emM2rnY5agb9rXpVGyy3bdW6EEgAtqt");
 }
 
+BOOST_AUTO_TEST_CASE(hd_public__derive_public_range__short_seed__matches_derive_public)
+{
+    data_chunk seed;
+    BOOST_REQUIRE(decode_base16(seed, SHORT_SEED));
+
+    const hd_private m(seed, hd_private::mainnet);
+    const hd_public m_pub = m;
+
+    // More than one block, not a multiple of the block size.
+    std::vector<hd_public> children;
+    BOOST_REQUIRE(m_pub.derive_public_range(5, 150, children));
+    BOOST_REQUIRE_EQUAL(children.size(), 150u);
+
+    for (uint32_t index = 0; index < children.size(); ++index)
+        BOOST_REQUIRE(children[index] == m_pub.derive_public(5 + index));
+}
+
+BOOST_AUTO_TEST_CASE(hd_public__derive_public_range__threadpool__matches_derive_public)
+{
+    data_chunk seed;
+    BOOST_REQUIRE(decode_base16(seed, LONG_SEED));
+
+    const hd_private m(seed, hd_private::mainnet);
+    const hd_public m_pub = m;
+    threadpool pool(4);
+
+    std::vector<hd_public> children;
+    BOOST_REQUIRE(m_pub.derive_public_range(0, 1000, children, pool));
+    BOOST_REQUIRE_EQUAL(children.size(), 1000u);
+    pool.shutdown();
+    pool.join();
+
+    for (uint32_t index = 0; index < children.size(); ++index)
+        BOOST_REQUIRE(children[index] == m_pub.derive_public(index));
+}
+
+BOOST_AUTO_TEST_CASE(hd_public__derive_public_range__hardened__false)
+{
+    data_chunk seed;
+    BOOST_REQUIRE(decode_base16(seed, SHORT_SEED));
+
+    const hd_private m(seed, hd_private::mainnet);
+    const hd_public m_pub = m;
+
+    std::vector<hd_public> children;
+    BOOST_REQUIRE(!m_pub.derive_public_range(hd_first_hardened_key - 1, 2,
+        children));
+    BOOST_REQUIRE(m_pub.derive_public_range(hd_first_hardened_key - 1, 1,
+        children));
+    BOOST_REQUIRE_EQUAL(children.size(), 1u);
+    BOOST_REQUIRE(!hd_public().derive_public_range(0, 1, children));
+}
+
+BOOST_AUTO_TEST_CASE(hd_public__encoded__buffer_and_private_cached__expected)
+{
+    data_chunk seed;
+    BOOST_REQUIRE(decode_base16(seed, SHORT_SEED));
+    const hd_private m(seed, hd_private::mainnet);
+
+    // The private encoding is independent of the cached public encoding.
+    const auto& base = static_cast<const hd_public&>(m);
+    BOOST_REQUIRE_EQUAL(base.encoded().substr(0, 4), "xpub");
+    BOOST_REQUIRE_EQUAL(m.encoded().substr(0, 4), "xprv");
+    const hd_public m_pub = m;
+
+    std::string out;
+    m_pub.encoded(out);
+    BOOST_REQUIRE_EQUAL(out, "xpub661MyMwAqRbcFtXgS5sYJABqqG9YLmC4Q1Rdap9gSE8NqtwybGhePY2gZ29ESFjqJoCu1Rupje8YtGqsefD265TMg7usUDFdp6W1EGMcet8");
+    BOOST_REQUIRE_EQUAL(m_pub.encoded(), out);
+    BOOST_REQUIRE_EQUAL(m.to_public().encoded(), out);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -242,4 +242,42 @@ BOOST_AUTO_TEST_CASE(message__verify_message__electrum_incorrect_address__false)
 
 BOOST_AUTO_TEST_SUITE_END()
 
+BOOST_AUTO_TEST_CASE(message__verify_messages__mixed__per_message_results)
+{
+    const payment_address compressed(base16_literal(SECRET));
+    const payment_address uncompressed({ base16_literal(SECRET), 0x00, false });
+    const auto message1 = to_chunk(std::string("Compressed"));
+    const auto message2 = to_chunk(std::string("Uncompressed"));
+
+    const std::vector<signed_message> messages
+    {
+        { message1, compressed, base16_literal(SIGNATURE_COMPRESSED) },
+        { message2, uncompressed, base16_literal(SIGNATURE_UNCOMPRESSED) },
+        { message2, compressed, base16_literal(SIGNATURE_UNCOMPRESSED) }
+    };
+
+    threadpool pool(2);
+    const auto result = verify_messages(messages, pool);
+    pool.shutdown();
+    pool.join();
+
+    BOOST_REQUIRE_EQUAL(result.valid.size(), 3u);
+    BOOST_REQUIRE(result.valid[0]);
+    BOOST_REQUIRE(result.valid[1]);
+    BOOST_REQUIRE(!result.valid[2]);
+    BOOST_REQUIRE_EQUAL(result.valid_count, 2u);
+    BOOST_REQUIRE_GE(result.throughput(), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(message__verify_messages__empty__empty)
+{
+    threadpool pool(1);
+    const auto result = verify_messages({}, pool);
+    pool.shutdown();
+    pool.join();
+
+    BOOST_REQUIRE(result.valid.empty());
+    BOOST_REQUIRE_EQUAL(result.valid_count, 0u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
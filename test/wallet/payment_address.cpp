@@ -282,4 +282,28 @@ BOOST_AUTO_TEST_CASE(payment_address__hash__compressed_point__expected)
     BOOST_REQUIRE_EQUAL(encode_base16(address.hash()), COMPRESSED_HASH);
 }
 
+// encoded:
+
+BOOST_AUTO_TEST_CASE(payment_address__encoded__buffer__expected)
+{
+    const payment_address address(ec_public(COMPRESSED));
+    std::string out("reused");
+    address.encoded(out);
+    BOOST_REQUIRE_EQUAL(out, ADDRESS_COMPRESSED);
+    BOOST_REQUIRE_EQUAL(address.encoded(), ADDRESS_COMPRESSED);
+}
+
+BOOST_AUTO_TEST_CASE(payment_address__encoded__cached_then_assigned__expected)
+{
+    const payment_address script_address(ADDRESS_SCRIPT);
+    payment_address address(ec_public(COMPRESSED));
+    BOOST_REQUIRE_EQUAL(address.encoded(), ADDRESS_COMPRESSED);
+
+    const auto copy = address;
+    BOOST_REQUIRE_EQUAL(copy.encoded(), ADDRESS_COMPRESSED);
+
+    address = script_address;
+    BOOST_REQUIRE_EQUAL(address.encoded(), ADDRESS_SCRIPT);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
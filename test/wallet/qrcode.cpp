@@ -113,6 +113,52 @@ BOOST_AUTO_TEST_CASE(qrcode__invoke__qrencode_data__success)
     BOOST_REQUIRE(std::memcmp(encoded_qrcode.data(), expected_data, expected_data_length) == 0);
 }
 
+BOOST_AUTO_TEST_CASE(qrcode__encoder__encode__same_as_encode)
+{
+    static const std::string address = "bitcoin:1L4M4obtbpexxuKpLrDimMEYWB2Rx2yzus";
+    qr::encoder encoder;
+    BOOST_REQUIRE(encoder.encode(address) == qr::encode(to_chunk(address)));
+}
+
+BOOST_AUTO_TEST_CASE(qrcode__encoder__encode_batch__each_in_order)
+{
+    const string_list texts
+    {
+        "bitcoin:1L4M4obtbpexxuKpLrDimMEYWB2Rx2yzus",
+        "bitcoin:1L4M4obtbpexxuKpLrDimMEYWB2Rx2yzus?amount=1",
+        "bitcoin:1L4M4obtbpexxuKpLrDimMEYWB2Rx2yzus?amount=2"
+    };
+
+    std::vector<data_chunk> codes;
+    const auto handler = [&](size_t index, const data_chunk& code)
+    {
+        BOOST_REQUIRE_EQUAL(index, codes.size());
+        codes.push_back(code);
+        return true;
+    };
+
+    qr::encoder encoder;
+    BOOST_REQUIRE(encoder.encode(texts, handler));
+    BOOST_REQUIRE_EQUAL(codes.size(), texts.size());
+
+    for (size_t index = 0; index < texts.size(); ++index)
+        BOOST_REQUIRE(codes[index] == qr::encode(to_chunk(texts[index])));
+}
+
+BOOST_AUTO_TEST_CASE(qrcode__encoder__encode_batch__handler_false__stops)
+{
+    const string_list texts{ "a", "b", "c" };
+    size_t calls = 0;
+    const auto handler = [&](size_t, const data_chunk&)
+    {
+        return ++calls < 2;
+    };
+
+    qr::encoder encoder;
+    BOOST_REQUIRE(!encoder.encode(texts, handler));
+    BOOST_REQUIRE_EQUAL(calls, 2u);
+}
+
 #endif // WITH_QRENCODE
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -30,4 +30,110 @@ BOOST_AUTO_TEST_SUITE(select_outputs_tests)
 ////    BOOST_REQUIRE(true);
 ////}
 
+static chain::point_value make_point(uint32_t index, uint64_t value)
+{
+    return { { null_hash, index }, value };
+}
+
+static unspent_index make_index(const std::vector<uint64_t>& values)
+{
+    chain::points_value unspent;
+    for (uint32_t index = 0; index < values.size(); ++index)
+        unspent.points.push_back(make_point(index, values[index]));
+
+    return { unspent };
+}
+
+BOOST_AUTO_TEST_CASE(select_outputs__select__branch_and_bound_exact__changeless)
+{
+    const auto unspent = make_index({ 1, 2, 3, 4, 5, 10, 20, 50 });
+    chain::points_value out;
+    BOOST_REQUIRE(select_outputs::select(out, unspent, 37));
+    BOOST_REQUIRE_EQUAL(out.value(), 37u);
+    BOOST_REQUIRE(out.points.front().value() >= out.points.back().value());
+}
+
+BOOST_AUTO_TEST_CASE(select_outputs__select__branch_and_bound_cost_of_change__least_excess)
+{
+    const auto unspent = make_index({ 100, 60, 45 });
+    const select_outputs::budget limits(0, 10);
+    chain::points_value out;
+    BOOST_REQUIRE(select_outputs::select(out, unspent, 102, limits));
+    BOOST_REQUIRE_EQUAL(out.value(), 105u);
+    BOOST_REQUIRE_EQUAL(out.points.size(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(select_outputs__select__input_fee__effective_values)
+{
+    // Effective values are 90, 50 and 35, the 5 output is of no value.
+    const auto unspent = make_index({ 100, 60, 45, 5 });
+    const select_outputs::budget limits(10);
+    chain::points_value out;
+    BOOST_REQUIRE(select_outputs::select(out, unspent, 85, limits));
+    BOOST_REQUIRE_EQUAL(out.value(), 105u);
+    BOOST_REQUIRE_EQUAL(out.points.size(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(select_outputs__select__no_changeless_set__knapsack_sufficient)
+{
+    const auto unspent = make_index({ 1000, 300, 200, 7 });
+    chain::points_value out;
+    BOOST_REQUIRE(!select_outputs::select(out, unspent, 450));
+    BOOST_REQUIRE(out.value() >= 450u);
+    BOOST_REQUIRE_EQUAL(out.value(), 500u);
+}
+
+BOOST_AUTO_TEST_CASE(select_outputs__select__no_changeless_set__smallest_larger)
+{
+    const auto unspent = make_index({ 1000, 300, 200 });
+    chain::points_value out;
+    BOOST_REQUIRE(!select_outputs::select(out, unspent, 600));
+    BOOST_REQUIRE_EQUAL(out.points.size(), 1u);
+    BOOST_REQUIRE_EQUAL(out.value(), 1000u);
+}
+
+BOOST_AUTO_TEST_CASE(select_outputs__select__insufficient__empty)
+{
+    const auto unspent = make_index({ 10, 20 });
+    chain::points_value out;
+    out.points.push_back(make_point(42, 42));
+    BOOST_REQUIRE(!select_outputs::select(out, unspent, 31));
+    BOOST_REQUIRE(out.points.empty());
+}
+
+BOOST_AUTO_TEST_CASE(select_outputs__select__zero_tries__sufficient)
+{
+    const auto unspent = make_index({ 40, 30, 20, 10 });
+    const select_outputs::budget limits(0, 0, 0);
+    chain::points_value out;
+    BOOST_REQUIRE(!select_outputs::select(out, unspent, 55));
+    BOOST_REQUIRE(out.value() >= 55u);
+}
+
+BOOST_AUTO_TEST_CASE(select_outputs__select__large_set_bounded__sufficient)
+{
+    chain::points_value points;
+    for (uint32_t index = 0; index < 20000; ++index)
+        points.points.push_back(make_point(index, 1000 + (index * 7919) % 100000));
+
+    const unspent_index unspent(points);
+    const select_outputs::budget limits(0, 0, 10000);
+    chain::points_value out;
+    select_outputs::select(out, unspent, 5000001, limits);
+    BOOST_REQUIRE(out.value() >= 5000001u);
+}
+
+BOOST_AUTO_TEST_CASE(select_outputs__select__branch_and_bound_algorithm__changeless)
+{
+    chain::points_value unspent;
+    unspent.points.push_back(make_point(0, 7));
+    unspent.points.push_back(make_point(1, 3));
+    unspent.points.push_back(make_point(2, 5));
+
+    chain::points_value out;
+    select_outputs::select(out, unspent, 8,
+        select_outputs::algorithm::branch_and_bound);
+    BOOST_REQUIRE_EQUAL(out.value(), 8u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
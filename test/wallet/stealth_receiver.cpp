@@ -85,4 +85,144 @@ BOOST_AUTO_TEST_CASE(stealth_receiver__exchange_between_sender_and_receiver__alw
     BOOST_REQUIRE_EQUAL(payment_address(receiver_public, version), derived_address);
 }
 
+static data_chunk to_records(const chain::stealth_record::list& records)
+{
+    data_chunk out;
+    for (const auto& record: records)
+        extend_data(out, record.to_data(false));
+
+    return out;
+}
+
+struct scan_fixture
+{
+    scan_fixture(const binary& filter)
+      : receiver(to_scan(), to_spend(), filter, payment_address::testnet_p2kh)
+    {
+        const stealth_address address(receiver.stealth_address());
+        ec_secret ephemeral_private;
+        BOOST_REQUIRE(decode_base16(ephemeral_private, EPHEMERAL_PRIVATE));
+
+        const stealth_sender sender(ephemeral_private, address, data_chunk{},
+            binary{}, payment_address::testnet_p2kh);
+        BOOST_REQUIRE(sender);
+        BOOST_REQUIRE(extract_ephemeral_key(ephemeral, sender.stealth_script()));
+        payment_hash = sender.payment_address().hash();
+    }
+
+    static ec_secret to_scan()
+    {
+        const hd_private main_key(MAIN_KEY, hd_private::testnet);
+        return main_key.derive_private(0 + hd_first_hardened_key).secret();
+    }
+
+    static ec_secret to_spend()
+    {
+        const hd_private main_key(MAIN_KEY, hd_private::testnet);
+        return main_key.derive_private(1 + hd_first_hardened_key).secret();
+    }
+
+    chain::stealth_record to_record(size_t height, uint32_t prefix,
+        bool pays) const
+    {
+        return
+        {
+            height, prefix, ephemeral, pays ? payment_hash : null_short_hash,
+            hash_digest{ { static_cast<uint8_t>(height) } }
+        };
+    }
+
+    stealth_receiver receiver;
+    ec_compressed ephemeral;
+    short_hash payment_hash;
+};
+
+BOOST_AUTO_TEST_CASE(stealth_receiver__scan__payments__expected)
+{
+    const scan_fixture fixture(binary{});
+    BOOST_REQUIRE(fixture.receiver);
+
+    const chain::stealth_record::list records
+    {
+        fixture.to_record(10, 42, true),
+        fixture.to_record(100, 42, false),
+        fixture.to_record(101, 42, true),
+        fixture.to_record(102, 7, true)
+    };
+
+    chain::stealth_record::list matches;
+    BOOST_REQUIRE(fixture.receiver.scan(to_records(records), 50,
+        [&](const chain::stealth_record& record)
+        {
+            matches.push_back(record);
+        }));
+
+    BOOST_REQUIRE_EQUAL(matches.size(), 2u);
+    BOOST_REQUIRE(matches[0] == records[2]);
+    BOOST_REQUIRE(matches[1] == records[3]);
+}
+
+BOOST_AUTO_TEST_CASE(stealth_receiver__scan__filter__skips_other_prefixes)
+{
+    // The filter is the four high bits of the first (low order) byte.
+    const scan_fixture fixture(binary(4, data_chunk{ 0xa0 }));
+    BOOST_REQUIRE(fixture.receiver);
+
+    const chain::stealth_record::list records
+    {
+        fixture.to_record(1, 0x123456af, true),
+        fixture.to_record(2, 0x123456fa, true)
+    };
+
+    chain::stealth_record::list matches;
+    BOOST_REQUIRE(fixture.receiver.scan(to_records(records), 0,
+        [&](const chain::stealth_record& record)
+        {
+            matches.push_back(record);
+        }));
+
+    BOOST_REQUIRE_EQUAL(matches.size(), 1u);
+    BOOST_REQUIRE(matches[0] == records[0]);
+}
+
+BOOST_AUTO_TEST_CASE(stealth_receiver__scan__threadpool__matches_serial)
+{
+    const scan_fixture fixture(binary{});
+    BOOST_REQUIRE(fixture.receiver);
+
+    chain::stealth_record::list records;
+    for (size_t height = 0; height < 100; ++height)
+        records.push_back(fixture.to_record(height, 0, height % 7 == 0));
+
+    const auto packed = to_records(records);
+    chain::stealth_record::list serial;
+    chain::stealth_record::list parallel;
+    threadpool pool(4);
+
+    BOOST_REQUIRE(fixture.receiver.scan(packed, 0,
+        [&](const chain::stealth_record& record)
+        {
+            serial.push_back(record);
+        }));
+
+    BOOST_REQUIRE(fixture.receiver.scan(packed, 0,
+        [&](const chain::stealth_record& record)
+        {
+            parallel.push_back(record);
+        }, pool));
+
+    pool.shutdown();
+    pool.join();
+    BOOST_REQUIRE_EQUAL(serial.size(), 15u);
+    BOOST_REQUIRE(serial == parallel);
+}
+
+BOOST_AUTO_TEST_CASE(stealth_receiver__scan__partial_record__false)
+{
+    const scan_fixture fixture(binary{});
+    const data_chunk packed(chain::stealth_record::satoshi_fixed_size(false) + 1);
+    BOOST_REQUIRE(!fixture.receiver.scan(packed, 0,
+        [](const chain::stealth_record&) {}));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
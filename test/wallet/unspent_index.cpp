@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) 2011-2017 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace bc;
+using namespace bc::wallet;
+
+BOOST_AUTO_TEST_SUITE(unspent_index_tests)
+
+static chain::point_value make_point(uint32_t index, uint64_t value)
+{
+    return { { null_hash, index }, value };
+}
+
+BOOST_AUTO_TEST_CASE(unspent_index__construct__unsorted__descending)
+{
+    chain::points_value unspent;
+    unspent.points.push_back(make_point(0, 5));
+    unspent.points.push_back(make_point(1, 50));
+    unspent.points.push_back(make_point(2, 20));
+    unspent.points.push_back(make_point(1, 50));
+
+    const unspent_index index(unspent);
+    BOOST_REQUIRE_EQUAL(index.size(), 3u);
+    BOOST_REQUIRE_EQUAL(index.value(), 75u);
+    BOOST_REQUIRE_EQUAL(index.points()[0].value(), 50u);
+    BOOST_REQUIRE_EQUAL(index.points()[1].value(), 20u);
+    BOOST_REQUIRE_EQUAL(index.points()[2].value(), 5u);
+}
+
+BOOST_AUTO_TEST_CASE(unspent_index__insert__duplicate__false)
+{
+    unspent_index index;
+    BOOST_REQUIRE(index.insert(make_point(0, 10)));
+    BOOST_REQUIRE(index.insert(make_point(1, 10)));
+    BOOST_REQUIRE(!index.insert(make_point(0, 10)));
+    BOOST_REQUIRE(index.insert(make_point(2, 30)));
+    BOOST_REQUIRE_EQUAL(index.size(), 3u);
+    BOOST_REQUIRE_EQUAL(index.value(), 50u);
+    BOOST_REQUIRE_EQUAL(index.points().front().value(), 30u);
+}
+
+BOOST_AUTO_TEST_CASE(unspent_index__erase__present_and_missing__expected)
+{
+    unspent_index index;
+    BOOST_REQUIRE(index.insert(make_point(0, 10)));
+    BOOST_REQUIRE(index.insert(make_point(1, 10)));
+    BOOST_REQUIRE(index.insert(make_point(2, 30)));
+    BOOST_REQUIRE(index.erase(make_point(1, 10)));
+    BOOST_REQUIRE(!index.erase(make_point(1, 10)));
+    BOOST_REQUIRE(!index.erase(make_point(2, 31)));
+    BOOST_REQUIRE_EQUAL(index.size(), 2u);
+    BOOST_REQUIRE_EQUAL(index.value(), 40u);
+    BOOST_REQUIRE(index.points().back() == make_point(0, 10));
+}
+
+BOOST_AUTO_TEST_CASE(unspent_index__clear__empty)
+{
+    unspent_index index;
+    BOOST_REQUIRE(index.insert(make_point(0, 10)));
+    index.clear();
+    BOOST_REQUIRE_EQUAL(index.size(), 0u);
+    BOOST_REQUIRE_EQUAL(index.value(), 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()